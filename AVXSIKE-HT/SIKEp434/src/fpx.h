@@ -47,6 +47,8 @@ void fp2div2(f2elm_t r, const f2elm_t a);
 void fp2correction(f2elm_t r);
 void fp2sqr_mont(f2elm_t r, const f2elm_t a);
 void fp2mul_mont(f2elm_t r, const f2elm_t a, const f2elm_t b);
+void fp2mul_prepare(felm_t bs, f2elm_t b);
+void fp2mul_mont_bs(f2elm_t r, const f2elm_t a, const f2elm_t b, const felm_t bs);
 void fp2inv_mont(f2elm_t r);
 void to_fp2mont(f2elm_t r, const f2elm_t a);
 void from_fp2mont(f2elm_t r, const f2elm_t a);
@@ -33,6 +33,9 @@
 #define VSHL(X, Y)            _mm512_slli_epi64(X, Y)
 #define VSRA(X, Y)            _mm512_srai_epi64(X, Y)
 
+// comparison operations
+#define VCMPEQ(X, Y)          _mm512_cmpeq_epi64_mask(X, Y)
+
 // broadcast operations
 #define VZERO                 _mm512_setzero_si512()
 #define VSET1(X)              _mm512_set1_epi64(X)
@@ -48,5 +51,20 @@
 #define VALIGNR(X, Y, Z)      _mm512_alignr_epi64(X, Y ,Z)
 #define VMALIGNR(W, X, Y, Z)  _mm512_maskz_alignr_epi64(W, X, Y, Z)
 #define VMBLEND(X, Y, Z)      _mm512_mask_blend_epi64(X, Y, Z)
+#define VUNPACKLO(X, Y)       _mm512_unpacklo_epi64(X, Y)
+#define VUNPACKHI(X, Y)       _mm512_unpackhi_epi64(X, Y)
+#define VPERMV2(X, Y, Z)      _mm512_permutex2var_epi64(X, Y, Z)
+#define VSHUF128(X, Y, Z)     _mm512_shuffle_i64x2(X, Y, Z)
+
+// concatenated shift right (AVX-512VBMI2, emulated with two shifts without it)
+#if defined(__AVX512VBMI2__)
+#define VSHRDV(X, Y, Z)       _mm512_shrdv_epi64(X, Y, Z)
+#else
+#define VSHRDV(X, Y, Z)       VOR(_mm512_srlv_epi64(X, Z), _mm512_sllv_epi64(Y, VSUB(VSET1(64), Z)))
+#endif
+
+// masked byte memory operations (AVX-512BW)
+#define VZLOAD8(X, Y)         _mm512_maskz_loadu_epi8(X, Y)
+#define VMSTORE8(X, Y, Z)     _mm512_mask_storeu_epi8(X, Y, Z)
 
 #endif
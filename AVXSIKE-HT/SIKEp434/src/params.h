@@ -15,6 +15,7 @@
 #define BOB                     1 
 #define OALICE_BITS             216  
 #define OBOB_BITS               218
+#define OBOB_EXPON              137
 #define MASK_ALICE              0xFF 
 #define MASK_BOB                0x01 
 #define GFP_BYTES               55
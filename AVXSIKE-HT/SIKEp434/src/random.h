@@ -4,4 +4,12 @@
 // Generate random bytes and output the result to random_array
 int randombytes(unsigned char* random_array, unsigned long long nbytes);
 
+// Replace the source the per-thread generators are (re)seeded from, NULL restores
+// getrandom(); the source must be thread-safe and randombytes() aborts if it fails
+void randombytes_set_entropy(int (*entropy)(unsigned char *x, unsigned long long xlen));
+
+// Force a reseed of the calling thread's generator on its next use, e.g. after the
+// process was restored from a snapshot; fork() is handled without it
+void randombytes_reseed();
+
 #endif
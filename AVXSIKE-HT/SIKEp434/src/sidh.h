@@ -57,32 +57,64 @@ static const uint64_t B_gen[6*NWORDS] = {
 };
 
 // Fixed parameters for isogeny tree computation
-static const unsigned int strat_Alice[MAX_Alice-1] = { 
-  48, 28, 16, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 
-  2, 1, 1, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 
-  1, 1, 13, 7, 4, 2, 1, 1, 2, 1, 1, 3, 2, 1, 1, 
-  1, 1, 5, 4, 2, 1, 1, 2, 1, 1, 2, 1, 1, 1, 21, 
-  12, 7, 4, 2, 1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 
-  5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 9, 5, 3, 2, 1, 
-  1, 1, 1, 2, 1, 1, 1, 4, 2, 1, 1, 1, 2, 1, 1 };
+// The strategies are optimal for the measured costs of xDBLe/xTPLe and of 
+// eval_4_isog_multi/eval_3_isog_multi at n stacked points, with phiP, phiQ, 
+// phiR (kg) and without (ss), of this implementation with at most 
+// MAX_INT_POINTS_* stacked points (generated by tools/strategy.c).
+static const unsigned int strat_Alice_kg[MAX_Alice-1] = { 
+  48, 27, 15, 8, 4, 3, 2, 1, 1, 1, 2, 1, 1, 4, 2, 1,
+  1, 2, 1, 1, 7, 4, 2, 1, 1, 2, 1, 1, 3, 2, 1, 1,
+  1, 1, 12, 7, 4, 2, 1, 1, 2, 1, 1, 3, 2, 1, 1, 1,
+  1, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 21, 12, 7, 4,
+  2, 1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 5, 3, 2, 1,
+  1, 1, 1, 2, 1, 1, 1, 9, 5, 3, 2, 1, 1, 1, 1, 2,
+  1, 1, 1, 4, 2, 1, 1, 1, 2, 1, 1 };
 
-static const unsigned int strat_Bob[MAX_Bob-1] = { 
-  66, 33, 17, 9, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 4, 
-  2, 1, 1, 1, 2, 1, 1, 8, 4, 2, 1, 1, 1, 2, 1, 1, 4, 
-  2, 1, 1, 2, 1, 1, 16, 8, 4, 2, 1, 1, 1, 2, 1, 1, 
-  4, 2, 1, 1, 2, 1, 1, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 
-  1, 1, 2, 1, 1, 32, 16, 8, 4, 3, 1, 1, 1, 1, 2, 1, 
-  1, 4, 2, 1, 1, 2, 1, 1, 8, 4, 2, 1, 1, 2, 1, 1, 4, 
-  2, 1, 1, 2, 1, 1, 16, 8, 4, 2, 1, 1, 2, 1, 1, 4, 
-  2, 1, 1, 2, 1, 1, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 
-  1, 2, 1, 1 };
+static const unsigned int strat_Alice_ss[MAX_Alice-1] = { 
+  48, 27, 15, 8, 4, 3, 2, 1, 1, 1, 2, 1, 1, 4, 2, 1,
+  1, 2, 1, 1, 7, 4, 2, 1, 1, 2, 1, 1, 3, 2, 1, 1,
+  1, 1, 12, 7, 4, 2, 1, 1, 2, 1, 1, 3, 2, 1, 1, 1,
+  1, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 21, 12, 7, 4,
+  2, 1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 5, 3, 2, 1,
+  1, 1, 1, 2, 1, 1, 1, 9, 5, 3, 2, 1, 1, 1, 1, 2,
+  1, 1, 1, 4, 2, 1, 1, 1, 2, 1, 1 };
+
+static const unsigned int strat_Bob_kg[MAX_Bob-1] = { 
+  54, 33, 20, 12, 7, 5, 3, 2, 1, 1, 1, 2, 1, 1, 1, 3,
+  2, 1, 1, 1, 1, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1,
+  8, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 3, 2, 1, 1,
+  1, 1, 1, 13, 8, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1,
+  3, 2, 1, 1, 1, 1, 1, 5, 3, 2, 1, 1, 1, 1, 1, 2,
+  1, 1, 1, 21, 13, 8, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1,
+  1, 3, 2, 1, 1, 1, 1, 1, 5, 3, 2, 1, 1, 1, 1, 1,
+  2, 1, 1, 1, 8, 5, 3, 2, 1, 1, 1, 1, 1, 2, 1, 1,
+  1, 3, 2, 1, 1, 1, 1, 1 };
+
+static const unsigned int strat_Bob_ss[MAX_Bob-1] = { 
+  54, 33, 20, 12, 7, 5, 3, 2, 1, 1, 1, 2, 1, 1, 1, 3,
+  2, 1, 1, 1, 1, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1,
+  8, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 3, 2, 1, 1,
+  1, 1, 1, 13, 8, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1,
+  3, 2, 1, 1, 1, 1, 1, 5, 3, 2, 1, 1, 1, 1, 1, 2,
+  1, 1, 1, 21, 13, 8, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1,
+  1, 3, 2, 1, 1, 1, 1, 1, 5, 3, 2, 1, 1, 1, 1, 1,
+  2, 1, 1, 1, 8, 5, 3, 2, 1, 1, 1, 1, 1, 2, 1, 1,
+  1, 3, 2, 1, 1, 1, 1, 1 };
   
 
-void random_mod_order_B(__m512i *random_digits, uint8_t *sk);
+// Bob's public key in Montgomery form with the constants of his curve: 
+// A, A24plus = A+2C, C24 = 4C (C = 1, or projective with make PROJECTIVE_A=1), 
+// and an optional ladder table 
+typedef struct { f2elm_t PKB[3]; f2elm_t A; f2elm_t A24plus; f2elm_t C24; f2elm_t (*table)[2]; } prepared_pkB;
+typedef prepared_pkB prepared_pkB_t[1];
+
+void mod_order_B(__m512i *digits, uint8_t *sk, const uint8_t *r);
 
 void EphemeralKeyGeneration_A(const __m512i *PrivateKeyA, __m512i *PublicKeyA);
 void EphemeralKeyGeneration_B(const __m512i *PrivateKeyB, __m512i *PublicKeyB);
 void EphemeralSecretAgreement_A(const __m512i *PrivateKeyA, const __m512i *PublicKeyB, __m512i *SharedSecretA);
+void PreparePublicKey_B(const __m512i *PublicKeyB, prepared_pkB_t ppk, f2elm_t (*table)[2]);
+void EphemeralSecretAgreement_A_prepared(const __m512i *PrivateKeyA, const prepared_pkB_t ppk, __m512i *SharedSecretA);
 void EphemeralSecretAgreement_B(const __m512i *PrivateKeyB, const __m512i *PublicKeyA, __m512i *SharedSecretB);
 
 #endif
@@ -0,0 +1,99 @@
+//
+//  rng.c
+//
+//  Created by Bassham, Lawrence E (Fed) on 8/29/17.
+//  Copyright © 2017 Bassham, Lawrence E (Fed). All rights reserved.
+//
+//  Modified to use standalone implementation of AES included in aes_c.c
+
+#include <string.h>
+#include "rng.h"
+
+AES256_CTR_DRBG_struct  DRBG_ctx;
+
+void
+randombytes_init(unsigned char *entropy_input,
+                 unsigned char *personalization_string,
+                 int security_strength)
+{
+    unsigned char   seed_material[48];
+    
+    (void)security_strength;  // Unused parameter
+    memcpy(seed_material, entropy_input, 48);
+    if (personalization_string)
+        for (int i=0; i<48; i++)
+            seed_material[i] ^= personalization_string[i];
+    memset(DRBG_ctx.Key, 0x00, 32);
+    memset(DRBG_ctx.V, 0x00, 16);
+    AES256_CTR_DRBG_Update(seed_material, DRBG_ctx.Key, DRBG_ctx.V);
+    DRBG_ctx.reseed_counter = 1;
+}
+
+int
+randombytes(unsigned char *x, unsigned long long xlen)
+{
+    unsigned char   block[16];
+    int             i = 0;
+    
+    while ( xlen > 0 ) {
+        //increment V
+        for (int j=15; j>=0; j--) {
+            if ( DRBG_ctx.V[j] == 0xff )
+                DRBG_ctx.V[j] = 0x00;
+            else {
+                DRBG_ctx.V[j]++;
+                break;
+            }
+        }
+        AES256_ECB(DRBG_ctx.Key, DRBG_ctx.V, block);
+        if ( xlen > 15 ) {
+            memcpy(x+i, block, 16);
+            i += 16;
+            xlen -= 16;
+        }
+        else {
+            memcpy(x+i, block, xlen);
+            xlen = 0;
+        }
+    }
+    AES256_CTR_DRBG_Update(NULL, DRBG_ctx.Key, DRBG_ctx.V);
+    DRBG_ctx.reseed_counter++;
+    
+    return RNG_SUCCESS;
+}
+
+void
+AES256_CTR_DRBG_Update(unsigned char *provided_data,
+                       unsigned char *Key,
+                       unsigned char *V)
+{
+    unsigned char   temp[48];
+    
+    for (int i=0; i<3; i++) {
+        //increment V
+        for (int j=15; j>=0; j--) {
+            if ( V[j] == 0xff )
+                V[j] = 0x00;
+            else {
+                V[j]++;
+                break;
+            }
+        }
+        
+        AES256_ECB(Key, V, temp+16*i);
+    }
+    if ( provided_data != NULL )
+        for (int i=0; i<48; i++)
+            temp[i] ^= provided_data[i];
+    memcpy(Key, temp, 32);
+    memcpy(V, temp+32, 16);
+}
+
+
+
+
+
+
+
+
+
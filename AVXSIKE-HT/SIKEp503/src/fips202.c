@@ -34,6 +34,10 @@ static void store64(uint8_t *x, uint64_t u)
 #include "intrin.h"
 
 extern void  KeccakP1600times8_PermuteAll_24rounds(void *states);
+extern void  KeccakP1600times8_AddBytes(void *states, unsigned int instanceIndex, const unsigned char *data, unsigned int offset, unsigned int length);
+extern void  KeccakP1600times8_AddLanesAll(void *states, const unsigned char *data, unsigned int laneCount, unsigned int laneOffset);
+extern void  KeccakP1600times8_ExtractBytes(const void *states, unsigned int instanceIndex, unsigned char *data, unsigned int offset, unsigned int length);
+extern void  KeccakP1600times8_ExtractLanesAll(const void *states, unsigned char *data, unsigned int laneCount, unsigned int laneOffset);
 
 static void keccak_absorb_8x1w(__m512i *s, unsigned int r, const uint8_t *m0, const uint8_t *m1, 
                                const uint8_t *m2, const uint8_t *m3, const uint8_t *m4, const uint8_t *m5,
@@ -142,3 +146,72 @@ void shake256_8x1w(uint8_t *out0, uint8_t *out1, uint8_t *out2, uint8_t *out3,
     }
   }
 }
+
+// absorb 8 inputs of mlen bytes at m + k*stride (k = 0..7): the full lanes are 
+// gathered into the state vectors by KeccakP1600times8_AddLanesAll, only the 
+// bytes of a last partial lane are added instance by instance 
+static void keccak_absorb_8x1w_strided(__m512i *s, unsigned int r, const uint8_t *m, unsigned long long stride, 
+                                       unsigned long long int mlen, unsigned char p)
+{
+  unsigned int k;
+
+  while (mlen >= r) {
+    KeccakP1600times8_AddLanesAll(s, m, r/8, stride/8);
+    KeccakP1600times8_PermuteAll_24rounds(s);
+    mlen -= r;
+    m += r;
+  }
+
+  KeccakP1600times8_AddLanesAll(s, m, mlen/8, stride/8);
+  if (mlen & 7) 
+    for (k = 0; k < 8; k++) 
+      KeccakP1600times8_AddBytes(s, k, m+k*stride+(mlen & ~7ULL), mlen & ~7ULL, mlen & 7);
+
+  s[mlen/8] = VXOR(s[mlen/8], VSET1((uint64_t)p << 8*(mlen & 7)));
+  s[r/8-1] = VXOR(s[r/8-1], VSET1(0x8000000000000000ULL));
+}
+
+void shake256_8x1w_strided(uint8_t *out, unsigned long long outstride, unsigned long long outlen,
+                           const uint8_t *in, unsigned long long instride, unsigned long long inlen)
+{
+  __m512i s[25];
+  unsigned long long len;
+  unsigned int i, k;
+
+  assert(outstride % 8 == 0 && instride % 8 == 0);
+
+  for (i = 0; i < 25; i++) s[i] = VZERO;
+
+  /* Absorb input */
+  keccak_absorb_8x1w_strided(s, SHAKE256_RATE, in, instride, inlen, 0x1F);
+
+  /* Squeeze output */
+  while (outlen > 0) {
+    KeccakP1600times8_PermuteAll_24rounds(s);
+    len = (outlen < SHAKE256_RATE) ? outlen : SHAKE256_RATE;
+    KeccakP1600times8_ExtractLanesAll(s, out, len/8, outstride/8);
+    if (len & 7)
+      for (k = 0; k < 8; k++)
+        KeccakP1600times8_ExtractBytes(s, k, out+k*outstride+(len & ~7ULL), len & ~7ULL, len & 7);
+    out += len;
+    outlen -= len;
+  }
+}
+
+void shake256_8x1w_vec(__m512i *out, unsigned long long outlen,
+                       const uint8_t *in, unsigned long long instride, unsigned long long inlen)
+{
+  __m512i s[25];
+  unsigned int i;
+
+  assert(outlen <= SHAKE256_RATE && instride % 8 == 0);
+
+  for (i = 0; i < 25; i++) s[i] = VZERO;
+
+  keccak_absorb_8x1w_strided(s, SHAKE256_RATE, in, instride, inlen, 0x1F);
+  KeccakP1600times8_PermuteAll_24rounds(s);
+
+  // the output words are the state lanes, which hold the 8 instances in their 64-bit elements
+  for (i = 0; i < outlen/8; i++) out[i] = s[i];
+  if (outlen & 7) out[i] = VAND(s[i], VSET1((1ULL << 8*(outlen & 7)) - 1));
+}
@@ -2,9 +2,13 @@
 #define FIPS202_H
 
 #include <stdint.h>
+#include "intrin.h"
 
 #define SHAKE256_RATE 136
 
+// row stride of n-byte strings for the strided SHAKE256 below (a multiple of 8 bytes)
+#define SHAKE_STRIDE(n) (((n)+7) & ~7)
+
 void shake256_8x1w(uint8_t *out0, uint8_t *out1, uint8_t *out2, uint8_t *out3, 
                    uint8_t *out4, uint8_t *out5, uint8_t *out6, uint8_t *out7,
                    unsigned long long outlen,
@@ -12,4 +16,15 @@ void shake256_8x1w(uint8_t *out0, uint8_t *out1, uint8_t *out2, uint8_t *out3,
                    const uint8_t *in4, const uint8_t *in5, const uint8_t *in6, const uint8_t *in7,
                    unsigned long long inlen);
 
+// SHAKE256 of the 8 inputs in + k*instride to the 8 outputs out + k*outstride (k = 0..7), 
+// the strides are multiples of 8 bytes
+void shake256_8x1w_strided(uint8_t *out, unsigned long long outstride, unsigned long long outlen,
+                           const uint8_t *in, unsigned long long instride, unsigned long long inlen);
+
+// SHAKE256 of the 8 inputs in + k*instride squeezed into lane-interleaved vectors: 
+// out[i] holds the i-th 64-bit word of the 8 outputs (outlen <= SHAKE256_RATE), 
+// the bytes of a last partial word are cleared 
+void shake256_8x1w_vec(__m512i *out, unsigned long long outlen,
+                       const uint8_t *in, unsigned long long instride, unsigned long long inlen);
+
 #endif
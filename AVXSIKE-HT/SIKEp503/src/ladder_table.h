@@ -0,0 +1,2025 @@
+// Fixed-basis ladder tables of LADDER3PT_fixed computed by tools/strategy.c
+// (./strategy tables > src/ladder_table.h), do not edit.
+// ladder_table_X[i] = { XR0+ZR0, XR0-ZR0 } (real and imaginary parts) for 
+// R0 = [2^i]Q, where Q is the basis point of X_gen on E0.
+
+#ifndef _LADDER_TABLE_H
+#define _LADDER_TABLE_H
+
+#include "curve.h"
+
+static const uint64_t ladder_table_A[OALICE_BITS][4][NWORDS] = {
+  { { 0x0DA5441F40FE9, 0x4C802F17E7A6C, 0x30DECF2221F32, 0x27C8F1CD5C45E, 0x1E660B6D44449, 0x42965CB23E44F, 0x487E875EFFDA2, 0x2FBF564F0E29D, 0x4E105B4135DF4, 0x005C0DF6C9D42 },
+    { 0x53F8D00AF2B91, 0x6D4196C57686B, 0x4BD837EDF5B8C, 0x3EC770D79E0DC, 0x634A8A4CE83E8, 0x107FB0E8135A1, 0x441055B3D5D8A, 0x17628BBA9FA16, 0x53702E68C87C5, 0x0063A6EF19136 },
+    { 0x0DA5441F40DEB, 0x4C802F17E7A6C, 0x30DECF2221F32, 0x27C8F1CD5C45E, 0x46660B6D44449, 0x222858A7AC87C, 0x609680EA1F84C, 0x5CEAA1CF68FB8, 0x564D0B601972E, 0x00F64727C8482 },
+    { 0x53F8D00AF2B8F, 0x6D4196C57686B, 0x4BD837EDF5B8C, 0x3EC770D79E0DC, 0x3B4A8A4CE83E8, 0x2776396C8D424, 0x07EC49A14E70E, 0x0F075BD63B983, 0x173C3721A037A, 0x016542C41F17E } },
+  { { 0x56ACFD13D088B, 0x5BF99FF49B049, 0x74EB33AD3E764, 0x54E95D401EA27, 0x0509368DD8EF3, 0x0DEFE7A78EB15, 0x58BE4E9379748, 0x7595FCC21F850, 0x3C8160CF03864, 0x01BE57C726B65 },
+    { 0x4A2DBF8B6CACF, 0x4ED0CA11425F9, 0x15A2C6A90D95D, 0x38C1AE9214A62, 0x47FB8D8FDEFB2, 0x3F1D03F5BBF83, 0x12DEC6374298D, 0x1D44D75AFA230, 0x76152C64B5BB3, 0x001F1037FF998 },
+    { 0x7D0F239089E85, 0x0A7EA8198DD56, 0x3FBAEE27F0D3F, 0x46D10F88A201E, 0x696B3D860DEEE, 0x7A43C4E49A507, 0x6C2BE5B81FEF7, 0x31B1666DB8169, 0x005055ACE59EB, 0x00CDCF48977E7 },
+    { 0x3272757254329, 0x6DB47C85E9AD8, 0x1DFFA1AFD8140, 0x17C6FB2F5EC2B, 0x2E0A731F62A0C, 0x5E1D6BBC0796A, 0x2754A028D673C, 0x4EBDA8F19A507, 0x0FEC929255487, 0x00FBB70C283A5 } },
+  { { 0x2900F11CF0D63, 0x1BCBD0672C96C, 0x2452AC6CCBBE3, 0x73FB51BFB91EF, 0x42D6905AC0E90, 0x47EB1243B6A19, 0x548B5CA8B9D6A, 0x37B3A5F14164D, 0x6B547BE86C93F, 0x0115A98AB224D },
+    { 0x51D5589A36117, 0x5FDFFE8D8D45C, 0x1F061423BEB18, 0x6908EC3F88A58, 0x6CDC40D54070E, 0x198C28A26E1DE, 0x5F6396EB2561C, 0x5C37E45F2DCA9, 0x18453B08C0535, 0x00E4F4F02A47D },
+    { 0x134D1863FE169, 0x36023FA960097, 0x30FF829A0C823, 0x68659AFEEDB2B, 0x0E1C2043584A4, 0x01DCEBB26ECEB, 0x70F7437D1899D, 0x1DC72FC3B3F1A, 0x3310CDDA24633, 0x00F2B9A6E482E },
+    { 0x135B7B3599F6F, 0x1C1F95E6E9F3B, 0x202C0A66750FE, 0x6E7833CB5FB51, 0x6115B3DF9E0F7, 0x585FF4A938AEA, 0x79AC8621C3053, 0x614258D7CB9BC, 0x6227575EF7B60, 0x01164EE3E5009 } },
+  { { 0x0DAAAFD6A2931, 0x005711988FE2B, 0x13E7691069009, 0x00A67E9B0BD8E, 0x0A814555F4D11, 0x110C5DE4E67CF, 0x7A17C51468A48, 0x0150ADB7E820B, 0x2319D6A189BD4, 0x01F2E490DBD43 },
+    { 0x6561DEAAD64C1, 0x5962BF8F40332, 0x0556627C57F5D, 0x4DFC49CDBEE28, 0x224AB61367712, 0x59B92683DA26E, 0x087C4DC7A1558, 0x40244EBF456E3, 0x15E228875E8FF, 0x0063B3E1BC96E },
+    { 0x79089562E1201, 0x33059E3C97FCA, 0x0EF22DEE34B82, 0x70BE2261D0C1F, 0x0DC791B037FF1, 0x7B5FD861F9671, 0x6554FEA6019E7, 0x7945CD92D07EA, 0x180495E399D36, 0x01066B3C1767C },
+    { 0x425E8D2E4C121, 0x7CC7DF9BCD35C, 0x3067E1A08DE10, 0x11127A723FC15, 0x121EEF867077E, 0x058F0323076D7, 0x631EB69C35F35, 0x428B417BEEAD1, 0x5F8A61DC73832, 0x0143C27F01CB8 } },
+  { { 0x25E42C6C8C5C8, 0x5F2E869DC9976, 0x0D88D76888CB8, 0x270AFAAE5F67F, 0x7C1E12B67CA15, 0x120360E6C734C, 0x27B4FF97DA017, 0x3A6E39D7D10E4, 0x3685EB1A9E65E, 0x015A298F16E92 },
+    { 0x447B6DBE9CBC4, 0x56A5383944F78, 0x19720C31E6A54, 0x5F0B357A7C0E6, 0x1DF44D890AA40, 0x27036D8A1A1C5, 0x48D813DB00B26, 0x50FC140D0497A, 0x756F7E4283DD0, 0x007379BC759A2 },
+    { 0x18015EF343EF0, 0x3B098B27DF07F, 0x709F41571DC52, 0x37C69B0996326, 0x041405822415E, 0x1CBE7EBB2E9EB, 0x4FDF92DEF01D6, 0x364C51899F3E4, 0x16F96D86B84C3, 0x0151A5A488974 },
+    { 0x3CC8C5F1E2450, 0x00D5C8E4BF570, 0x40E1E27B64800, 0x5DAC8C62776DB, 0x451CFC7F9DADE, 0x45C34EFC25268, 0x3B13C4631A2F7, 0x2FE966900F653, 0x49664E696ED03, 0x00F37B8033324 } },
+  { { 0x02E3322B66F30, 0x5EE2E2804395B, 0x712080F88D833, 0x644B174398A37, 0x044C0727A5D5D, 0x2B01BDA420180, 0x5D3FD91BB48BA, 0x3D37791AEE4A1, 0x5762154BA93EF, 0x013A15D5DDAEA },
+    { 0x3A608D50BD0CA, 0x42A3A8B1BE899, 0x589B8D5BDF0B6, 0x43EBD2097954D, 0x7B5DA60D7CA1D, 0x09F6F6E709A02, 0x4FCDCA0058DFC, 0x174E47B3D2739, 0x19C17329EDFD4, 0x007658EC5094C },
+    { 0x4046368856DF6, 0x417B106D24A1F, 0x41BD0375B3556, 0x0A5C71B3094EF, 0x1542735136321, 0x5FFEF50B290CF, 0x75D1659A015F2, 0x0D51D3DAEB888, 0x349476097AEDF, 0x012611DB0D336 },
+    { 0x2A929A32F9BF8, 0x44D559E3980B4, 0x61F174A8DEF5E, 0x3471CB4E7F272, 0x782292F1DCF5D, 0x7B022BC0C5D3B, 0x4AFADFDD212C3, 0x6DAB2C0F490C3, 0x030E5898B4DAB, 0x00C58D8BD81BF } },
+  { { 0x75337123140CC, 0x3616A8E694CF4, 0x1D4ADE97947E7, 0x3DFAB99465B66, 0x338152D3FDAF3, 0x5890DDF333C9F, 0x15C2ACABA1762, 0x2EC530A3BBFFC, 0x01303FEBE6AB6, 0x00E9DE11B4CCE },
+    { 0x19527F28E2651, 0x2D59E8F399A28, 0x6939A99F19157, 0x71D099DA591AC, 0x6FB792734EC3C, 0x46091289FEE85, 0x4227D01774EB8, 0x6A12EA829078A, 0x0700A701A5192, 0x002A2DA56E53A },
+    { 0x0ADD0DD58A36C, 0x208E4D3206412, 0x065C98EFD51D9, 0x75F580C244D14, 0x32B3AA3737E0A, 0x55EECADCD4B16, 0x57D0A42957723, 0x4E761EFD7109D, 0x6AEC185CFCB73, 0x01B75EE50CFAE },
+    { 0x5EF2A228BE5DD, 0x52570DC63B10B, 0x2232A55B131EE, 0x41F27306FF1C1, 0x32DC7160F45AD, 0x03C77A7C9845F, 0x064E87A75C40F, 0x4778F77FE6DD7, 0x3E7B15D69F718, 0x010FA36E6B9DE } },
+  { { 0x3573915AC1D11, 0x07FA7B83B22F4, 0x4E3419615BB37, 0x62BF34B140E3A, 0x29BAE6A88CA86, 0x33BD93545B3E6, 0x18A176939DCB4, 0x34DD51DC3CB0D, 0x2754EFAA12D5E, 0x015A779CF1B1E },
+    { 0x07DE130D52DC6, 0x02A58BACDD7DE, 0x7E5A483F031F6, 0x5ECC85FFB6A42, 0x74F59F5F1E648, 0x2B950980CE0C2, 0x76F9E3E561908, 0x479763F9ED194, 0x6977307B0B5B0, 0x00673C0D692E7 },
+    { 0x1C705E099060B, 0x6EE5995AD7FEF, 0x2827C786764EA, 0x5A123062B5880, 0x2B7EE787EFEE0, 0x7A020CAD34E34, 0x008A61E78E2C4, 0x2F72A84A227B7, 0x4D703E86D94C6, 0x00DA20FE1ABDD },
+    { 0x584C19FED722E, 0x2953E2439922D, 0x40E116F0B6461, 0x0D499935E9301, 0x45F1A3828F7C5, 0x49E00CDC5C5FA, 0x4E8CAE65DDEBE, 0x0E75A6B9E0318, 0x12E28A2A410B9, 0x015A94603A5FE } },
+  { { 0x22A646C6A27CD, 0x5BF4CC71C5AF2, 0x5C4846C3116DC, 0x3E17644D79462, 0x2511D3C5ADD59, 0x6585836EEC3B3, 0x5000B2FD1EB7E, 0x6C44934E8F37B, 0x24034F3BD07F7, 0x0093A4CFA4811 },
+    { 0x28BD2F3CF7ADD, 0x6FD6FDE06EE18, 0x7667525902BB4, 0x47961A0EB37AD, 0x575117066B86A, 0x23BFC65AC3485, 0x40B15DECBD148, 0x013D0E5D94D2E, 0x7FB2AC1656DAF, 0x00800EA7ED8D6 },
+    { 0x1E02981A94EF9, 0x3B35622B5AE37, 0x02B32AA08E601, 0x3462D7A1EFCD0, 0x324C423DFA6B3, 0x244A314AE1B2E, 0x7AF3A48B8C29D, 0x6FF479967B0D5, 0x46B14699C2C39, 0x009B365585A35 },
+    { 0x69CF004B083C5, 0x25268EA6E1EA6, 0x1BF535E68021A, 0x7F04CC8A5EDFC, 0x40745220867E7, 0x2C9B5D15C3745, 0x12A2EDE5A2FAE, 0x35358F24D4A27, 0x52DB12285AED2, 0x0166480DFD087 } },
+  { { 0x4CEFA0D22D17B, 0x037504B69F85F, 0x2F6D340B1B209, 0x34E2CA9FD1646, 0x548C035ABF774, 0x785255B3B5F38, 0x0AF3E84D5CA9D, 0x7CCAF1BF06E48, 0x3826B03880DBA, 0x006B20E3F72A8 },
+    { 0x661F99F0E9953, 0x3D9E1B2E8D8CD, 0x4FEDCCA2207FD, 0x295432DAEA747, 0x0CA6A467CAD60, 0x0FA43FAF9B716, 0x4C223FCC1CD4D, 0x6A64264BA23DF, 0x0D369129EE7B3, 0x00BF4397464D5 },
+    { 0x401A462706EAF, 0x7FCD435283BA6, 0x538A5FAE67AEC, 0x43D62F7A2F943, 0x3492D9C454936, 0x21C5D3FA2F171, 0x35FE720A2C8DC, 0x0579145182B02, 0x698F1B21723C6, 0x00D407A30C256 },
+    { 0x490E0C8149415, 0x729E6508D4E6E, 0x53E50F7DC86B4, 0x29762F5216E4C, 0x044ABA15917EB, 0x51BFC24A87345, 0x4EE66380F13BB, 0x4B508970EA660, 0x19C18FDD2A361, 0x0112C89D2D19B } },
+  { { 0x623790741443D, 0x4AC2C1254E75C, 0x14668557F127B, 0x12033D15A11AC, 0x57F6A33E6C974, 0x33D91F52D1D15, 0x609FB799EA5A4, 0x2561734E0310C, 0x3AF80E1EA0633, 0x01D6D64ED5A4D },
+    { 0x287819039FD73, 0x594A93FF41C1E, 0x534590C6C47FE, 0x561CB6C103A2D, 0x1741C5D1D4082, 0x7505E9230EBB6, 0x16CB8EB4E936E, 0x4E1B49785957B, 0x77FCCC6B44889, 0x00331C2972CC1 },
+    { 0x6AF807AAF5B93, 0x514706113091C, 0x07C2C7E2DEF13, 0x45DF1A4B73987, 0x552D6EAD04A80, 0x5A38EC7671F47, 0x6DBFBC5D008A6, 0x1E523784ECB89, 0x4E6404A7B3E75, 0x00FE99FE50C06 },
+    { 0x119559DF30D53, 0x62DF34129077A, 0x3EDE8148677CC, 0x71CFCBC77CBCD, 0x7A3EC24ADFEBF, 0x35F61A3E05C9C, 0x2FA6DC061A54D, 0x4E2E031DB4384, 0x4CE837D2AAA57, 0x0104092855978 } },
+  { { 0x62B77B9AA7448, 0x1793058CEDF8A, 0x0B6223784653E, 0x6FD14713F03A6, 0x334BD7289044A, 0x055EA63CFE45C, 0x367E73527A62B, 0x089026862DC78, 0x3BF8DD0B0AC98, 0x01B9C3971A2A6 },
+    { 0x729AA0C23B565, 0x68A60FE143E45, 0x66BC1796E222A, 0x25E68A7DF2666, 0x315D6786D448D, 0x5814281AD69AF, 0x245D4779205B5, 0x1C99047D13A4C, 0x169CF179F10B6, 0x0074E70C3101D },
+    { 0x3D276FA7DC2A4, 0x47612260B776D, 0x7AD32902F5A9E, 0x4EFD8EC746A63, 0x0FC2C461A994A, 0x5410E0145DF19, 0x04097C6B46DED, 0x62BACB550B04D, 0x395B0B0FA977E, 0x00BF35D015C7E },
+    { 0x5DD1D37519D2B, 0x68F9CC8C2160D, 0x2178838FC89EC, 0x64CA4DFB20BBC, 0x576CE8AE32FE5, 0x1125D483AA2F8, 0x6C1231DF6CD3E, 0x1EAF73CAA181D, 0x2C294945DEFBA, 0x015545AEBD516 } },
+  { { 0x58F1BDD1BB992, 0x6C7756ADC4847, 0x797DD87E4D0CB, 0x38CBF407020F1, 0x01E0A12821149, 0x4BC58531668FB, 0x7B8B0195CDD85, 0x2C2CF819A273F, 0x051415F883103, 0x003E9E7AD13D2 },
+    { 0x682080DB6FE8F, 0x77504191F741C, 0x1D92CB5B71476, 0x0BD5B42A0554A, 0x20D7D138889DE, 0x0F2990CABCBBA, 0x523FBD1045AD8, 0x65B6CBA65F517, 0x44E78FB13DFAB, 0x00B4B1654E2D1 },
+    { 0x073E5125B4B92, 0x3B153627BFBF1, 0x7ABD2E0321B5F, 0x3C972FDE095A0, 0x206F8F89F6ADC, 0x2A7419280430E, 0x217DEFD45AF29, 0x5B721E4F74DB2, 0x4714FB5F74A32, 0x00FA0BBEE1A98 },
+    { 0x46FD9FD9FEB47, 0x408FC1FD2FFCE, 0x4095E63502D2C, 0x61EFA798AEC9C, 0x039EE8B43A467, 0x79D2953660FF4, 0x651B81D9AE806, 0x620E3B0B16A44, 0x6E8F551FCE8FD, 0x00D01A32DCD22 } },
+  { { 0x5A6F0CEFD85BE, 0x7A521DFE5D3E9, 0x11157B7686E49, 0x61C6DF3023162, 0x266193A13D53C, 0x5A6752795041D, 0x0856A7E488153, 0x3E77D3944F489, 0x0DD0F829B5D03, 0x00641B5E989FB },
+    { 0x711DB61C28FE4, 0x5A29A0E15B014, 0x5AE3A8931328A, 0x3FB0CA5A57832, 0x185DAA8034876, 0x633DBEA342BA4, 0x28CF98AF99859, 0x5D9D3B0634DE2, 0x652EFD7E291C7, 0x00F44DFFC0054 },
+    { 0x3F3FD2641A0FC, 0x28FCD393418EF, 0x5924C84E1CA49, 0x1E78591D53DD4, 0x0183CC6690242, 0x3EE0CA71E4CA0, 0x0057E26902A79, 0x1B7589E5C029D, 0x3A706E11FEA49, 0x00EEF9B2EF044 },
+    { 0x035E9950A249A, 0x73C4F972EEC8F, 0x23061B32F86B5, 0x2C732B962A331, 0x7D40249E15BF6, 0x6CE65397A3CFA, 0x6DB3566C198B3, 0x0F5B014844034, 0x6DDEA7618C2B7, 0x00F6CFC7EFA84 } },
+  { { 0x23CCF0E742816, 0x3C60A18708925, 0x75121A9B3DEAE, 0x5EF0402EEE25D, 0x65D24DB4266EB, 0x0AE1E09B2944B, 0x136098EEA8B1D, 0x594BC236E9AB6, 0x11662BCB92F40, 0x0042AC12B169A },
+    { 0x78161DEEFC190, 0x7C6ADC74D0C36, 0x34E6AE6B6A610, 0x751A5CA3A3680, 0x3D44E82300AAA, 0x048A7C4CE67CF, 0x2E6C1D123C291, 0x2637F82C684A0, 0x3602A851E528F, 0x00C6A17D37A3D },
+    { 0x27C0A7E9DE6AC, 0x75667E8EC93FF, 0x6BDB85B453ACF, 0x2C69575C362CB, 0x40D0AFB9B0075, 0x29A0FA58064DE, 0x69CAD60F6C90E, 0x6EF958F03F709, 0x5F64407B90617, 0x010604F6F7D77 },
+    { 0x26A9A2DD87B40, 0x04A3750D9F8D4, 0x547F486BD3D02, 0x141BEBE3DB0C9, 0x597C038565982, 0x48E1FCDF504E8, 0x2F299AF3C7D8F, 0x03FE400DD2282, 0x5A9D229F01308, 0x00FBEAAEF1C4A } },
+  { { 0x28C3BFA8CABB3, 0x73822E9F862F3, 0x0C155DA96A31F, 0x70726B252A153, 0x3DAF4C9E6F864, 0x1984B3DA517F6, 0x31D33D2254FF5, 0x52597ED16FFD3, 0x79821552DFE98, 0x019DA2206291A },
+    { 0x767B9F430B638, 0x4F45A34CD0142, 0x498F9697C16CB, 0x5715E014B1994, 0x164458E436F30, 0x0EC1A3C252A5B, 0x6F8A9E2F88409, 0x6949BEAF3F51D, 0x459A2B7016D4F, 0x004DEA40EFBC3 },
+    { 0x6C55A6BFE5A81, 0x7BF5E0BC35161, 0x526F61D65837D, 0x5E49F7CA60439, 0x1EA567C91709B, 0x49F6DDC8A3CE2, 0x2B0E23E3CA590, 0x5C5D4046A8ED1, 0x1B6045BC9DC2B, 0x01401C90C7BED },
+    { 0x0ED55220AC40E, 0x61C905468F99F, 0x28EDA70C226B2, 0x0205150F1FF38, 0x020635BED20B5, 0x00BBB37FE46CD, 0x2CA62A9978DF1, 0x735015C618B7E, 0x3482E83C5BE4B, 0x014552E384197 } },
+  { { 0x0E5A3BA4E0D1C, 0x4A8FCA7835D18, 0x6152FF25E728B, 0x7B2E40508D5A9, 0x5809C977FC57E, 0x218F2ADC15FC4, 0x26E70D9615684, 0x1675CDD52B928, 0x553C2F1072946, 0x0006B41878B6D },
+    { 0x6710931D3000E, 0x65DD000D8B854, 0x31C65A6BEC011, 0x0FE92B3155AED, 0x7A86157DFD6D5, 0x43B00444A6320, 0x3A5293E71E69E, 0x05CAA113CAAA6, 0x07C94BA573921, 0x00BA1E8940B5A },
+    { 0x4F777FB26AF10, 0x7A3D43263F8ED, 0x1C0EFFF1AD5A0, 0x6F823F50DCF52, 0x21C2B333592AD, 0x37D68F1CA6D15, 0x6CA7E9EDC6461, 0x1585CA7C43104, 0x5505184F07938, 0x00FE61BE0758F },
+    { 0x42162BAFBEE82, 0x50280732E13F2, 0x0B48F88999417, 0x6A58DD9BCEEE3, 0x5BAAF0AFF42C0, 0x12FE4F3A56F94, 0x16B1855E7B88B, 0x1D9FB93E1E9A2, 0x2BE2AF29F62BE, 0x00C496B8AA215 } },
+  { { 0x187ACCC332DFE, 0x1B4F7C6B44297, 0x6F6623A44B8FA, 0x787DF46F35620, 0x3E82C8CBB53FC, 0x0ED5F125B03BF, 0x5D1F4BF97977B, 0x443806ED36500, 0x00DDF66A36693, 0x0102027EFF859 },
+    { 0x6B0277BC9B4B6, 0x6550AB7A948AA, 0x6CA0BFA9A3D36, 0x6EFA69E2B2FFD, 0x0460D5351AA39, 0x1984856A9EC29, 0x3305E760440E9, 0x7E136BCCCFC7E, 0x3E4B8C2298D5A, 0x0088BF1C173D0 },
+    { 0x6238CC48F7F36, 0x631AA7B209080, 0x32CD82F4C4491, 0x71A856CDC242D, 0x36C8BDE6E24DC, 0x0470BC30F6355, 0x04A006CFEE293, 0x0875BB1248FBF, 0x1768353CB2C32, 0x00979AE3293C2 },
+    { 0x59CDA58A010C4, 0x4551B90AC6784, 0x49590D9F65BF5, 0x34261FBFF5EB8, 0x3A432EF7A892A, 0x423D0202CD541, 0x09D25C64191E0, 0x5F4014C9CDDF6, 0x1A456D8693E00, 0x011F83B63AEE2 } },
+  { { 0x58209EA1DD646, 0x725C7C359BEA4, 0x36636C1E4ACFD, 0x52C828F14B9E8, 0x272C2EAF84CC2, 0x631D2AF759DFE, 0x4AD8DAFFC21C0, 0x3D65E2086381A, 0x6FAD9DAB479A2, 0x013EBAF75AAD7 },
+    { 0x78BDCCF8730E6, 0x1770A19FE443D, 0x66EEC42BEE43E, 0x7899228C33801, 0x15E5811D1B38D, 0x4B1315F7C0292, 0x04BF35D4F198C, 0x143139EF5F4A8, 0x2F0FF2FA770B0, 0x004936AE6CC38 },
+    { 0x639EA03A0C354, 0x21835CA452D71, 0x23FBA8265591A, 0x4FC521129F4EC, 0x0EB05BF2EF316, 0x27BFB2ABF49D4, 0x1DA9F3D070F41, 0x09D0721BC61A4, 0x13C4629AEE9EE, 0x01A616217899C },
+    { 0x43A4DF20007EC, 0x74DB328F549B0, 0x7162857E0D85E, 0x4AE7D3A9CC1B9, 0x0CE00147E2D55, 0x7E9D6E01C2EF0, 0x52C1906CB5440, 0x0AA136BD36F8D, 0x52BD7B384D630, 0x00D8B4ABCCB05 } },
+  { { 0x70BB2277A9197, 0x47720236EAFDA, 0x7EC2BBC7258FF, 0x3EBB611547BFF, 0x7F8E8822A14AE, 0x5DF7E8073DECD, 0x098D6CCC4A177, 0x37E468BB86E7F, 0x715E482F3AEB0, 0x003A8697516E7 },
+    { 0x41AD814014AC1, 0x240EED19FE91A, 0x0B1AD56D14179, 0x1F191E628E84A, 0x5BEAADA6D2785, 0x6E068C5BCCDE2, 0x40B6BEB2077BF, 0x70A0D8BFE7FFC, 0x7F14B90F1D83C, 0x00BE60E3B3B66 },
+    { 0x65231B9543149, 0x449C92CC73020, 0x5409F9A5E65EE, 0x573BA3E891E44, 0x538295E7201E0, 0x3B4D1383D4124, 0x6B09A06FDD7EF, 0x19B733558B42E, 0x31D621BCD44A7, 0x00DDDA98ABCBF },
+    { 0x231245D35CFF1, 0x12383BE2AFC26, 0x7FD9541480241, 0x184B2B2E5D7C3, 0x583FD2C2699BB, 0x58E081A067A3D, 0x67B0B2E02FE35, 0x7B2AAAE16A014, 0x3991F007F8C2A, 0x00BC90F35EFB7 } },
+  { { 0x28B6E6C149A43, 0x388AC3689C02F, 0x461712C035AB2, 0x53B892A6893D5, 0x118687B1374A0, 0x648A1E7A6A816, 0x0BA88A6242D98, 0x761CDF9694A2C, 0x113F72159D94E, 0x0168163BA37A5 },
+    { 0x75CE5369C0177, 0x55D8ACAF77E95, 0x6FC6090170AC9, 0x3039410DE02A9, 0x21B557ECB9827, 0x7C45CFE1BCD26, 0x23BEC2998CC7B, 0x5357480A603D9, 0x0690CCB910468, 0x002D5D9F78382 },
+    { 0x08CBD402613EF, 0x69DA8811B2081, 0x008A505A62420, 0x31B2D8FEFDB22, 0x5C23C7BC07B17, 0x70D4F549CAACD, 0x50AF598B88D0B, 0x40153F5B751FD, 0x566E71991A529, 0x009CAC18A2945 },
+    { 0x642AE85B61507, 0x30AA72BBDDC65, 0x581434074A89B, 0x47E7165E20039, 0x5C30B3F7FC450, 0x46A2F5B794A8F, 0x790E2498302B7, 0x4ADEC87CBC3D8, 0x1030F6C0FCC6E, 0x00FC13559E393 } },
+  { { 0x2955E3F2BDED2, 0x1BB6BC9B0B25E, 0x1FBB6E390B28E, 0x3CEE0390E76AE, 0x4338CFE1FD9A4, 0x153BB627DAC04, 0x7FF2AF12C1403, 0x1169DC2733E5B, 0x601DBA3155F5E, 0x00A184B998C04 },
+    { 0x54E7194A10993, 0x5A64570B5EE82, 0x13A2F754C8E4C, 0x47CC505055038, 0x4EF98B16C6935, 0x787734756D5CF, 0x3E45B0F54DA39, 0x7F49045403FE8, 0x5706AC3C0059D, 0x0066322A7D35A },
+    { 0x4D5BF27DE09AC, 0x2F8B616A87124, 0x0CBB1D29B5F85, 0x50DCF80CAAC8D, 0x1711E64F8BEF4, 0x6BE6D916DB49B, 0x15E5FF0C6B8BA, 0x5F9A37AC92662, 0x4BC5555ED9888, 0x01271F1CF7D9D },
+    { 0x72F82A85CB7B9, 0x09459045EF5F7, 0x05B163321DBD4, 0x2DBE4B5CB27E1, 0x2DDE565CFBFCF, 0x43589C4963BF5, 0x4AF10CA2417AD, 0x7739ECBA925BE, 0x51A1D75CD9E2A, 0x00A80086620DA } },
+  { { 0x08802AC03F867, 0x7509E61BF0E3C, 0x01D2886F97F4F, 0x55DEAA3A21903, 0x22E6C122864AB, 0x6CF73F4B18E3E, 0x2C42530142AA7, 0x7354F4655B747, 0x68CDB30023B93, 0x01C219402AD7B },
+    { 0x4E580058FC99A, 0x07C30076CC666, 0x139EB7652652F, 0x773F2982EF974, 0x609AAAB93B102, 0x0386ABE3DDCE4, 0x4CF380DB644FF, 0x07ECEF1D7229D, 0x5969B9E15F068, 0x00505D42C63CB },
+    { 0x795FB224422AB, 0x7369F356E5371, 0x3D4AB5F21DCD3, 0x4EE4901F1C615, 0x61B283E750DA4, 0x5A799C941F5BE, 0x4BA0A031EF56A, 0x1E189C7B9DDF3, 0x142B912D9242D, 0x01119DB5ACAE2 },
+    { 0x1B7AFDD84DF6A, 0x56A8ED264ED1D, 0x2AF979EE6E83B, 0x138F3451AE50A, 0x31FBC2FE3829A, 0x27B5D0EDF5AA3, 0x4BF3FA73E5DCD, 0x626051B9635A8, 0x7FB335F3A0338, 0x010E0ADD11623 } },
+  { { 0x1FCEE3F748158, 0x277CDB7CC2E6E, 0x6C6B78E12BE88, 0x1DA5FBA1A934B, 0x471FC1FF5E54C, 0x5EA38D8D45763, 0x75EC05B84492F, 0x2159287C9877A, 0x4565B879B88A6, 0x012F6F15B5BF9 },
+    { 0x7DBCE37DE1A68, 0x48DA75C102319, 0x01E54E22CBEBB, 0x57E5EE8CD65D4, 0x0F9E5A95E1093, 0x40026413A280E, 0x25A2F742C2CCC, 0x667C38F83C7D2, 0x31DA63C322521, 0x0043709FEA3CF },
+    { 0x0C4FA82C3AD4C, 0x2D8CE51D94776, 0x5D76687490DFE, 0x6595802812737, 0x0D559EC0CF41D, 0x43AFAAC35EC5E, 0x7D702C8E8704D, 0x3F1F77FB6EA4B, 0x5DFA6E8CBE5AC, 0x01016DDA530E0 },
+    { 0x2055CAF7422E4, 0x56A737A592F04, 0x7DFC77CFFC88A, 0x6FFD90DF65347, 0x5B6C827F88C93, 0x5C83C6F244FD9, 0x50DE1783C7455, 0x7DCCE60D4F625, 0x5BFEC81927452, 0x01093A1CF1914 } },
+  { { 0x1E087590CBC52, 0x267081FBE2D52, 0x05978F2A2D4BC, 0x70334BD635942, 0x648DD255574E5, 0x0F9BF04CFF414, 0x692FCEFD59420, 0x398ACC4AEB60F, 0x3E904F8C6DCE1, 0x013E4DEB6F6CA },
+    { 0x493CEA184BF5A, 0x68357FC168485, 0x0730DC192BCDA, 0x63351E7C9CACA, 0x77D8092AF7741, 0x5A02EE60D513A, 0x0795D43F65649, 0x01B7900B92704, 0x11C7A32F66A67, 0x006980133B6C2 },
+    { 0x3A3818B12E2A6, 0x4785E92F076F3, 0x72B38C534AB86, 0x6E8AAC75FDAA6, 0x638B61418BDB5, 0x3C646EAF242E1, 0x2B378209EAAF9, 0x10051B4571FE4, 0x65010B7ECD6DB, 0x010D32BBEF9E1 },
+    { 0x1E2FB21E7555A, 0x7E0134B126EB9, 0x2D7A55EE3B1AC, 0x012BF51E8A127, 0x4474BA7CC7CF3, 0x7897AB7B3BF23, 0x496E36D6E54FF, 0x3FA41766DA28F, 0x455A3D69C1C02, 0x012B08943FA09 } },
+  { { 0x34641293416EF, 0x7862CE2F8BC58, 0x09E56F150396D, 0x66C51D2F08653, 0x5AF72E7E5376A, 0x132221AD66887, 0x096FC43052E05, 0x2ADF4C2F39BB1, 0x250CE645D3588, 0x01D421097AF59 },
+    { 0x7FBE56718FA86, 0x7223C5E884775, 0x19403534923DD, 0x1305DA8E7ECC5, 0x078955B7337F1, 0x4E67D8437BD7C, 0x5238893FF6404, 0x4FAB86334D60A, 0x679B82746EF11, 0x00E337F117193 },
+    { 0x6D22FCB2849D7, 0x78671A33EE565, 0x716831C129D97, 0x3D43A6C782BE1, 0x47E03205FAA9A, 0x0B7B1BE335872, 0x487A85E6ACFEF, 0x29A1547E5C2B3, 0x39207CDE43BEF, 0x010E637D5F578 },
+    { 0x48E3561729502, 0x73A3F8268CFB0, 0x47BD7B75D681A, 0x2AFB3C88EFC3C, 0x0699986F47A0E, 0x7BC237969D812, 0x247F54FA00992, 0x7AC6696B34A57, 0x22DFCF9012D9F, 0x00E0BCF1603A6 } },
+  { { 0x6A328C20C0386, 0x75F8DCCB78A3E, 0x6D0E672EB8BE4, 0x61B03D2725447, 0x146D35EB76413, 0x35FCDEAB300DB, 0x1D55C113A523E, 0x59F210C341315, 0x0E44FEEE320F3, 0x00D94017B35D3 },
+    { 0x7300621CFDC4A, 0x749BF3CE72CCE, 0x018754BF4D843, 0x7F6A6EA508306, 0x3CC77DBE2C13B, 0x28BB6797935D5, 0x57EC6D367E8AF, 0x150BC1E2A6F57, 0x3ABD687DDD437, 0x009364DF13AF1 },
+    { 0x35205F21D4C26, 0x7C903090DEB15, 0x36D20148B256A, 0x201DD9B455A26, 0x07D7D8394E74E, 0x3BCDC76755894, 0x6D0C20D2A6255, 0x36B164B24C222, 0x2150F45B6F7A6, 0x015F53801D7CC },
+    { 0x0714CC8FE8068, 0x090170EB36200, 0x184D1DB774510, 0x1564A3EF184F7, 0x1365F58C089B6, 0x0AE182AB5128D, 0x458EF4B63E967, 0x7F3C9DA466D43, 0x363BF45764DA9, 0x009102456330A } },
+  { { 0x563007FD898E6, 0x442CC455BBDEE, 0x0B52FED027DC3, 0x3952869284D1C, 0x0987B577EED4D, 0x01D8FEBC32105, 0x373B443991E86, 0x30C5DEB8F37EC, 0x09DFA403F1DC9, 0x0060540FB76AC },
+    { 0x33FA8A428D24C, 0x754B31A4EC91D, 0x2CD4B24513EBC, 0x14F9EEC944E3E, 0x38D1523529892, 0x21D9256BD423F, 0x5720A0B6E80EB, 0x5A7B22AFDD0D2, 0x141FFECF53667, 0x006CBA38E1E18 },
+    { 0x5DC491CB897C4, 0x4BDEAEB208005, 0x755FD5A152CC1, 0x091F8AD8B3EBB, 0x3E2EA02C311CD, 0x0105AEF8ECAE1, 0x1FAF4A0D4C04B, 0x6733F0D9EC25E, 0x5E3ABBFFDC414, 0x010775E81DF18 },
+    { 0x5BCD6EBE88B4A, 0x277BC91910D13, 0x6A0E4FFB4D438, 0x2AB2507AC3085, 0x2DB599A269A2B, 0x215F7D2498E2C, 0x545AA1832A83F, 0x37194F0142E51, 0x2BDE86953F605, 0x014594DB90622 } },
+  { { 0x1550D15DFF55C, 0x5AAE0FFA36629, 0x481FCC5250737, 0x0395FB660CE02, 0x6C8014852192F, 0x2469A3C0139BE, 0x17D021B2D081E, 0x17CA95085E564, 0x4C420F7A33BC3, 0x005DE0B9D1D0B },
+    { 0x5720528296441, 0x02BBD81DB6EA5, 0x6D9EEC99B1D38, 0x5CECB32FDE0A5, 0x40219AA3BBF33, 0x771701288475B, 0x686879393F353, 0x4B3D7D5A23CF2, 0x276FDD0D83B42, 0x004AF6655BAD5 },
+    { 0x4748E8D40E1A2, 0x1307877D72581, 0x0527484F2EC9C, 0x57206E6AA5D49, 0x15A9BF2FD4011, 0x3F46135AD8CE2, 0x79D8A0E59BF04, 0x156E45348DD91, 0x475AFECD71F2C, 0x01284758E801E },
+    { 0x270E2F76A972D, 0x47639EB5FCA63, 0x43B6EEA80314E, 0x12665ACB19F14, 0x78E8C55EA6882, 0x2E0A5FF17E47D, 0x382886FADF70B, 0x38E5388C556DE, 0x1D001D2342258, 0x00DB93B4DF240 } },
+  { { 0x22BDA6AFD3AA1, 0x72F1E88DA4B59, 0x437FF535CC3E1, 0x3A82A591FA769, 0x4ECFBDC2209DB, 0x2B34E89843479, 0x314DAB92F1061, 0x3B35BA31B6C25, 0x1D598637543EF, 0x00506C45A958F },
+    { 0x796E9D4B6B30E, 0x3CD6BC70E659E, 0x53ED799777DBF, 0x1DD9A07AFFE79, 0x7CAA8A39C8ABF, 0x220D757197867, 0x0BD73DC238FCB, 0x666957AE4C81D, 0x3980C292A2E19, 0x00425AF26F25D },
+    { 0x20EE8C8BC3A95, 0x45C1A70AB263E, 0x58DEA226F92A5, 0x44902EDC5AF03, 0x6935A516B820E, 0x42C8F8FE34E49, 0x440803538CE75, 0x3BDFE6DD60203, 0x6CF9B3F2C5753, 0x00D24811457B5 },
+    { 0x1F3CC07228B98, 0x69E3B821D3D37, 0x5390AA9A979C9, 0x5A6B0CD8C2D6C, 0x06A075423219E, 0x3ED6D5DD6D684, 0x128CE00C67A74, 0x291204EDCF896, 0x4E253283343D5, 0x00CB85BD916DE } },
+  { { 0x7917B69816D4E, 0x4528F800767D4, 0x2EB608FE6DFD8, 0x254A18CA4378F, 0x21B3E21360B62, 0x0EECC9D395517, 0x3CB6E391F4559, 0x3D9BC4C0B5586, 0x731EE1154FC3B, 0x011C57D5B3CC9 },
+    { 0x4458A87031EC5, 0x3A8BD1D813535, 0x07C5AF31A2EB1, 0x235F33886EACA, 0x4DE70AF501DAF, 0x0A300DF780817, 0x719D18E524188, 0x4AEBAED203047, 0x03877462497AB, 0x00FAB310B8636 },
+    { 0x62667EDA01E4A, 0x7BF805B774839, 0x575151AC3F7A8, 0x012ABBCC86BA8, 0x6AEB01D131047, 0x6F20FD1679B3F, 0x3892A8A6305B3, 0x64EA7084B3D7A, 0x2F977A5AD32E7, 0x00A0A7AAB22EE },
+    { 0x42900B5DFC295, 0x5A8F9A5ACD70A, 0x720C662D27133, 0x41396AF39EA23, 0x41ADBF8ECD821, 0x28103520E8B9C, 0x25B949F1232B0, 0x3887906060BD0, 0x7C59764202240, 0x00FE5DC6716E3 } },
+  { { 0x4D7F06414B67D, 0x255B6F734A06F, 0x3B73D96460C40, 0x130606B226D7D, 0x5E66E6470A465, 0x2CDB3C21B06D7, 0x7F4E4E7DDC680, 0x1E2934BCBDF0A, 0x506D7471A172A, 0x00652D07DF383 },
+    { 0x77E622C451536, 0x07EDBD302A988, 0x4B950ECBCF409, 0x03C6F5884216F, 0x7F37C4C46D38F, 0x690116AB13F1E, 0x0651BB0F66C2C, 0x7C2884A215EE2, 0x4E6FE1D1E31E0, 0x0047DA1A8532B },
+    { 0x38C9896FF28DD, 0x74ACDA7255AAB, 0x5FE88A9D7C1D6, 0x72E34BA3B1361, 0x3A3CA4CB0DC83, 0x6E5D5E3C16D1B, 0x0FAB22990C617, 0x50085FCD6E3B8, 0x396ADC047BCB9, 0x0120FE1AC1239 },
+    { 0x52CC4387E7E32, 0x32062D6392EDD, 0x768F49E6D8E27, 0x2CBEAA116912A, 0x474075F77892A, 0x0F4F1155D96AE, 0x03B3B4CF944A0, 0x4F8B3584818BB, 0x2B42A6987D97B, 0x01144B52C75D9 } },
+  { { 0x408440F97B655, 0x58E552239C194, 0x4B8EF15B3535D, 0x0A73272772F0A, 0x30D5BBE358350, 0x397B10A212C9F, 0x085BF66C06473, 0x48B5D25E8DBDE, 0x26AC1E02C303E, 0x00DEA20F43434 },
+    { 0x35CCC21C5023F, 0x365506302C975, 0x6AEA731C6855D, 0x1D6D672B6B2AF, 0x5A118D9EB4A22, 0x1B5508A6EE0BA, 0x3ADE130D1CB40, 0x783E354C7512D, 0x255A568520D7F, 0x004AEC7AF5300 },
+    { 0x5E01723C9C8AF, 0x009E85C26B88E, 0x2DD8A76E675B3, 0x37B243D8722AC, 0x018866AA95068, 0x7B358D29655CC, 0x7E856F008F4C9, 0x21DDC102B4D62, 0x5AABADD6D87A2, 0x010B77731C4CA },
+    { 0x725982BADB875, 0x7D7F9673EB026, 0x48EF4F58B82E5, 0x4E77C5EC6F02F, 0x6ED8C2D5FF308, 0x54D260D4C9EF8, 0x13D1C79BAE021, 0x6941966474DC5, 0x4987EDB605210, 0x0144065A1A0EB } },
+  { { 0x3A3D31D5B007F, 0x6A9A6A1E1820D, 0x5DDD731758D3D, 0x2971BC07E3DB6, 0x336DF86C5787E, 0x3AC6973A0A0FD, 0x1EA9E352D6DAD, 0x5467A9BC68C48, 0x318B7765D8B5A, 0x00DF1DBB58688 },
+    { 0x1C92E3728906E, 0x6EA1370346314, 0x12BCA37B00A29, 0x285F7170858B2, 0x0F2CCBCB4B195, 0x0BB8BD122D579, 0x3ECF1A6533A36, 0x4E1BEDDCC32D5, 0x4039A8B4D0FF2, 0x0050E153E6D6E },
+    { 0x4E3F16E0BE7D3, 0x2CADCF1A2D2C6, 0x4C5ED33A55DF5, 0x193EDDADFBE02, 0x4E95B5E1CA2C5, 0x0B0A68C49EBF8, 0x568C8EFF0054D, 0x7F7EC1FFD7B3D, 0x17E3C2B2E27D6, 0x0042A63DAC5F4 },
+    { 0x5E3C2C603CDD6, 0x56D2129862935, 0x3A4EB7702D6AC, 0x7BEC831C294B0, 0x71BD99AC83DA4, 0x354DE88A1B58C, 0x707D11477A25A, 0x5EED29ADE296C, 0x0AFB7DDD0C393, 0x011B917D6E118 } },
+  { { 0x5D9FD3B65F6CE, 0x155B484703C89, 0x1A6D0BF71A3CE, 0x426480B334D0B, 0x0EDF068D7EE90, 0x278BBD21D4241, 0x166152FB33415, 0x5B43FC56E3DB2, 0x196BF31C0256B, 0x0151B7B14A52F },
+    { 0x48CEFBB8FBD20, 0x2309789F51231, 0x544D7018E7603, 0x587CFCD899831, 0x36FA6B35A654E, 0x73DF8587C0401, 0x0A13963F59628, 0x5667605F9597B, 0x005CD39B7740B, 0x00CF1110313DA },
+    { 0x1D3C9DCDFCF9A, 0x7AC23CD881FC4, 0x7096FF25009FC, 0x22DFA455393A0, 0x37409209C0AB5, 0x15A44DE79D31F, 0x433FEA40125AC, 0x381C760A34361, 0x68DD8E3C81E67, 0x00AA1AFBDF545 },
+    { 0x389E46796E3A2, 0x646976F407E8F, 0x4099DD4EDB38B, 0x798084C43D42F, 0x2BC9ECF398330, 0x684EEAF2FB5D5, 0x59CB8A6B6167F, 0x68DED0ADB8C67, 0x2FE7109A33E52, 0x00FF8BB6E097E } },
+  { { 0x498556BDE2D35, 0x36CE23AE41D22, 0x16CB0A40CEA8B, 0x6A5C107059EE5, 0x113260358ABFE, 0x3B13E9AD6380B, 0x023ABF2F93DEC, 0x5819DC1D6FA89, 0x455742EBDBB0A, 0x003F643894DD5 },
+    { 0x579FDD1283D4F, 0x26EA176D9218D, 0x617D3F894D08C, 0x2119D73906501, 0x46D05C6305724, 0x3E6B77E128655, 0x442D09E4CF18D, 0x5D60714DCC217, 0x0BECD2628E9F9, 0x00D7463056EF9 },
+    { 0x63ADF380D2ED7, 0x059665B4327CC, 0x14D9ABD802693, 0x7DA9EE0F21461, 0x7B604EDE28B14, 0x0FDBD902D265F, 0x0307DA0F7B914, 0x3147E7D97EE78, 0x346A58DD7C448, 0x01093DA21A589 },
+    { 0x7496E36F3E493, 0x121F7E9A983C0, 0x2565510DE2A3B, 0x31F78A0F20B92, 0x545E81D8417E4, 0x4A334009224A7, 0x7C1D89A16ACAA, 0x2809BE7C0CFAB, 0x0AD0922372081, 0x012AECC7D0482 } },
+  { { 0x70D666D466A46, 0x447E19521AAAF, 0x4E1956861094F, 0x113D4E5A18951, 0x104DE77CC528F, 0x31E30BDFE9DEF, 0x2938F259F4FF8, 0x53A1EB08F9735, 0x30668C3A61DCD, 0x01669AF2A48FC },
+    { 0x204178951AA8D, 0x40D16BA2784F9, 0x47428BFBF2B3A, 0x2AC9043E1F7E7, 0x66BB46AC23C8C, 0x18C2AEF8FE4ED, 0x164B9987B4742, 0x5E42256CF4B67, 0x4E88099B36F83, 0x007E6EC15B7EF },
+    { 0x6FE42A5EEBB74, 0x39CCF998845C1, 0x7C06139B5EABB, 0x3DCEDAAC876BA, 0x16DF256613C0E, 0x728D3D76180ED, 0x6B1854A642676, 0x71E969459619D, 0x67E18FEAB2021, 0x013E9B3CFC54E },
+    { 0x15AAF38CA842F, 0x1E4836788B5F7, 0x74FBFC246A1BF, 0x07922A832354C, 0x16736529BDCFA, 0x3EC622A7174AD, 0x2BC0CFE63DBBE, 0x3AE5E59513D8D, 0x59D6FDB5A4B42, 0x017BE3E21A636 } },
+  { { 0x00CE8249A59CD, 0x5790F74F5E57D, 0x4B93863662AA4, 0x1A45FF7530483, 0x2208682401334, 0x78039D3E63DA9, 0x3BC3D60E7BA15, 0x4568C4011755F, 0x3F80A7CF9EC17, 0x0118054DA5805 },
+    { 0x479D7A85472EF, 0x0BE5F4829C889, 0x1121A72F99912, 0x18AB379A0B22B, 0x230429BDE0FD2, 0x27DDCD3BB5D24, 0x072ACD5B8BD1E, 0x32DE97262480C, 0x46EE57595E9E4, 0x00567BC28283B },
+    { 0x531DFACF485FD, 0x36DC16834052A, 0x3586F874B0626, 0x54D75120117CD, 0x700C021BAE1BD, 0x2425E46287B6A, 0x1A70BEDE46792, 0x2E0A8AABCE153, 0x245DADCD8594F, 0x012FF230EE79D },
+    { 0x769BFBFB0217D, 0x136C916A21B61, 0x620DF73C78E0A, 0x66A57A686D078, 0x57085ACA20EDB, 0x551ED7D521DCD, 0x401F8730D18D3, 0x1BC4738BDB70B, 0x41653D3A17361, 0x011550CC01A53 } },
+  { { 0x57DAAB9991074, 0x26D8748E8D628, 0x2CA8DD1F096DD, 0x7600D448DB3E1, 0x0AB4C63B0543A, 0x2C7B2B855ECA8, 0x1AB90203C617E, 0x7329F5B6BCCC5, 0x7E91E188D307B, 0x00CAB7542C232 },
+    { 0x69D2AB8969657, 0x68A5B0E02F60C, 0x290D7788E9516, 0x04E630BFB8727, 0x6BA46C7F628F9, 0x3D76847621930, 0x3B32347A586DD, 0x3BD53EAE67C90, 0x6062001B33098, 0x007466B1500FE },
+    { 0x5E1C6FAA81190, 0x6504B29E43379, 0x71BB0D1EE3C12, 0x4B40C8BE5E54F, 0x0FD43734E99E5, 0x1E8419FD4D980, 0x5B43002C46F06, 0x622C04F30A946, 0x2D430845C01F0, 0x00D07BBEA11A4 },
+    { 0x7F5E1416E1011, 0x58F1453364416, 0x66EA844AB20FD, 0x5B2EC23B03B50, 0x48ACA9529AD98, 0x245CCEAA133C1, 0x3D4DAC692EBD6, 0x4FB8A662029E8, 0x2D9B9335485E1, 0x00FCBF67AB9F8 } },
+  { { 0x6C723153A02BB, 0x65B5893F6CD9D, 0x32ED584F78B07, 0x22DBA6420B335, 0x530F0B515D300, 0x56CCE8185F1E7, 0x5A856A0A8670D, 0x16B9CA5606750, 0x1C3630C9C3FD7, 0x00F2D4FC16EE9 },
+    { 0x04B228DA54566, 0x268E44E23EDD3, 0x7FA950DF27187, 0x38FD85FCA9807, 0x70ACBC1DCB89E, 0x0C5EA9650DE19, 0x6D49592A86279, 0x43A2638977538, 0x7AAEF3BC66D7A, 0x00BEC109801C7 },
+    { 0x3CCBDA46F7C35, 0x575F78E8A826B, 0x7EAE7C760ED11, 0x0E0763865BA3E, 0x14D7120497281, 0x0C99986CE3240, 0x7BA4F9E92D3E2, 0x2ACA0343615F8, 0x3F99AF7E7AFA2, 0x018A2900430EF },
+    { 0x31C431595460A, 0x3E26FD3801D92, 0x19AFA325CAC13, 0x6F9A0358B0628, 0x07A11C536C8D3, 0x6DEFBFAE7AC6F, 0x7193D182B9181, 0x758103080F3FD, 0x11DDE5C7FA720, 0x00CD98B7D3AAA } },
+  { { 0x198BB4E7E5CA4, 0x13BC5BCC69E3A, 0x16BC1166CD716, 0x15EB2FECFD841, 0x1193B333718AE, 0x2272280F036D5, 0x70212B8D8446E, 0x16B090FBC6EE5, 0x0AA3B9D4F98E2, 0x00F863EE4AD38 },
+    { 0x494DC96FC4025, 0x69205DE93239C, 0x52FC93ED56AEF, 0x441237A25BDC4, 0x003651AE67C2E, 0x439EA11CB2DF5, 0x56E307865B484, 0x190F8096C93BE, 0x0E35607ADF4D6, 0x004E71012A315 },
+    { 0x5CF95C764253C, 0x05E33B4A6F1B1, 0x7095E454913C4, 0x6957CA8769D7A, 0x4BF1ECA180FA7, 0x0C01141D956B1, 0x18AF7FB448473, 0x15568F2304CE4, 0x489AF890C295C, 0x0046F70EEBA70 },
+    { 0x32CF24270A615, 0x50B1A94932BC1, 0x51BFBF05544E8, 0x26F79FEE7F605, 0x2F9531B41597D, 0x182618689CACB, 0x624EBF3DF6B8C, 0x25EC2CF946168, 0x51EC27239EF37, 0x011BCB53AF333 } },
+  { { 0x6871DDCEB7FD7, 0x3C8FF31FF8B47, 0x34734A4FE9754, 0x355D037081B67, 0x2E95EBD5EB5CE, 0x4ECE94205E541, 0x5DEDEB5CC0E27, 0x37773E5547705, 0x71909A53FD6D4, 0x0157291785C88 },
+    { 0x0ED67A0F3FE42, 0x6AC4AA775BAB8, 0x00AE03D3852B7, 0x6A0F9456EBE58, 0x419007586CBD5, 0x4D83EDAB6E3D2, 0x601A30559C133, 0x0BEADD3169FFB, 0x61D0232D26329, 0x00D5897FC1E81 },
+    { 0x359D638537DC7, 0x204BFBBB2C060, 0x275AD129DEAA3, 0x1FE7680C3A869, 0x7D338FDE538BA, 0x1036488636E69, 0x47A4A1C9294E5, 0x22F76E5DE85E1, 0x3288156D87877, 0x014A4DF36DEE8 },
+    { 0x718E72345E580, 0x71DF2086F0AA3, 0x762D9EBA5DF42, 0x5F46A2A86CAB6, 0x17D663954EB11, 0x52C560AEE8096, 0x3ADA8EC26140C, 0x1EC3DF645D29C, 0x77BF2960A0670, 0x0105C8E535CC3 } },
+  { { 0x2806D61B0DB66, 0x03D362513A023, 0x5BB6AA55B6C6B, 0x112BBEC72C861, 0x160439CDDE884, 0x0ABB39AC38947, 0x02201F5222307, 0x385D5C8416446, 0x4B50B233BAFF2, 0x01CBF0B2556A1 },
+    { 0x7A7A3314C3F1A, 0x2551094FEB54D, 0x0BD182A4334AC, 0x622D8C68D2F46, 0x043A9B0FAE595, 0x08FE3257B06D8, 0x314FF04DA1551, 0x308ADCF90EB27, 0x33B93CCD5C91A, 0x00B2E8340BF34 },
+    { 0x255ECD2F93AC8, 0x66BBEFF4A53B1, 0x2076273ECC7E6, 0x30129C3123691, 0x3DB3B0F7C001E, 0x3523F1998B99C, 0x2DD1AA94D6E45, 0x64E8208C2020E, 0x20FF5F4EC2E04, 0x00CE0B736660A },
+    { 0x1E32BC09069D2, 0x179B3FD9FAECF, 0x3370BF3DEFD42, 0x2D0D21A93DE2D, 0x5F0283489B31B, 0x4D2AB7D78BE87, 0x21AF4970CE5B9, 0x10E889685AFE6, 0x5CDD2C953A3EE, 0x013AFAD07A4F1 } },
+  { { 0x5BAF3DBBE2B1B, 0x07E246AA354AF, 0x18B59990B147F, 0x54F0DDF0EB4CE, 0x40F3C1A463C5C, 0x0BC71865721F2, 0x0272DD695A812, 0x53101ACBE9D4B, 0x774132B6FC82F, 0x0102256CAE439 },
+    { 0x74C1EBD6CFBF9, 0x751859D832328, 0x1E5D466B6488C, 0x1B5651A445160, 0x0147BD5A4DD76, 0x6CA1212BA34F0, 0x1BF888C23A08D, 0x7E7E133F8E316, 0x118B339E3A64B, 0x00D5EA2613340 },
+    { 0x794640C4CC231, 0x74A413AB496C6, 0x5B07485471321, 0x0054270BEF77A, 0x63FBAA700EB8C, 0x23E280A6CE92E, 0x51C1530A804E4, 0x14DED96C9DD6E, 0x0319B99614C4D, 0x00014ECB9F457 },
+    { 0x01BACD72604BD, 0x1794DA657BDCD, 0x7CF5A1F1EB1E1, 0x7B8C64EDB9ACC, 0x7733856E00363, 0x08C71B24A86D6, 0x1BFC60281F1D9, 0x280F9E9AE3F62, 0x6C31B6FED9A41, 0x01224099A5FAD } },
+  { { 0x649ED78991ACC, 0x64937C7D52A7D, 0x047B4482785CB, 0x0440404A419CB, 0x200CBED342E20, 0x4A6FF77FACEAF, 0x610B41CF9FD22, 0x5FF639BDE4ACA, 0x40AB49E2EC158, 0x0141D203802B3 },
+    { 0x02F1FC585DE96, 0x1E1675F0A4D4A, 0x27187FD5AD2ED, 0x5090A4882D834, 0x1ED154460145B, 0x6C4CDE87243DB, 0x568A23371411C, 0x60AA7DCBB9FC6, 0x476E9A0BF028A, 0x0026C74D4673A },
+    { 0x7532ED1A85348, 0x23DA32314E370, 0x6E4B922B2140C, 0x659E824FE8619, 0x32896387CF288, 0x32D19B804DF3C, 0x5A5E49B3799DF, 0x032AC172DA9AC, 0x3B44B86300CF0, 0x01676F01E3AF4 },
+    { 0x2BE499B22E522, 0x34380C451ADEB, 0x011BB794C9604, 0x169A39CEF31C3, 0x3D537B3562D07, 0x76AE49DA588B4, 0x3BB5B11112C5D, 0x161DDA3771C64, 0x348C36A848014, 0x00DF72E8066D6 } },
+  { { 0x44B16A675BF7F, 0x52127729BA605, 0x2E76130A51C90, 0x41C604A39BCAC, 0x23424AFCE6A84, 0x417F8AAA70B4B, 0x3C75D12E2A472, 0x4D5EBF6062C2B, 0x23A4309D77185, 0x008058C6E9344 },
+    { 0x679401BDC8387, 0x163652FBFC195, 0x30AAB1574D016, 0x1B79583A2D66E, 0x3E35AE9F45B5A, 0x4723E40B77539, 0x0E3C29BAC6D82, 0x3E8357B9FFB1C, 0x002E294DCFE03, 0x0083756052D7E },
+    { 0x0DA3A0A8091C3, 0x473CB9EEFDFD2, 0x22327157A00EF, 0x2756E027BB237, 0x1247AD6D497C4, 0x31BDC3EEFB6A2, 0x5B7195AA4C9F1, 0x6B98982249C7C, 0x1759D33D40F4B, 0x00BDE6942274D },
+    { 0x4625187F2A815, 0x60857B64DBEFB, 0x32D34DD08B977, 0x617851FB44677, 0x66D738A164DE2, 0x676D7F33E2082, 0x0835531F75F05, 0x698D9C092DD15, 0x3744D98D478BC, 0x00EA82A0B97E0 } },
+  { { 0x5FEE062195AEB, 0x38719061E0029, 0x13DBC23E576BB, 0x6D13E778C3D24, 0x7BB8E041D4C87, 0x25DBC191A75B7, 0x5309872ECAF28, 0x3D8C4C81D2DF2, 0x1D61BC85AC9F9, 0x012497349F858 },
+    { 0x6BF3CE8FF2630, 0x1B0FF6D9C4EE3, 0x45E5348E6DE70, 0x20474DBB2E38E, 0x126231BD1EC04, 0x3CBA745A6EAE7, 0x3490C73126369, 0x781170AAFF5D1, 0x2F3BEF2FE547C, 0x00419A403462B },
+    { 0x137B6E90F416D, 0x32B659A20D6F0, 0x3002441E991D3, 0x09F94DF71775B, 0x757F28023FC03, 0x22AE7469926EB, 0x3B27F5021DD5F, 0x6F22A186C72CE, 0x78FDECC3D856D, 0x011B88872BC7C },
+    { 0x0CB7416B6E928, 0x25E8710F21883, 0x0121EFB55CF3A, 0x1B77DF092F93B, 0x4EDF7C2ED86DF, 0x036C5B0C841E2, 0x3741096B36C7B, 0x3EDFC7D90265D, 0x0E2ADD5529A7E, 0x00E13DD167A2B } },
+  { { 0x4C7BB65DD3CFA, 0x7BF3DDCDD55A0, 0x3B27BDDCAB3FB, 0x1929F0EE028FE, 0x07EE4379BD3CE, 0x586AB2F1376EB, 0x6D25957BF1045, 0x2272918B24A8E, 0x7B0F43755EBF3, 0x0080169CFAB5E },
+    { 0x0ED3C26E3DDBB, 0x147869D597AF4, 0x1C6303C74CA6F, 0x3E8F8283F7352, 0x0543418610CBA, 0x0BAD3374C15E9, 0x390A5360723F3, 0x51DB0A31AFA9D, 0x3AD784A4794B6, 0x00B885C27C45A },
+    { 0x35AC23420E27E, 0x3DF9A3BA2FAAE, 0x4998FB8664B55, 0x0E92E3FA822F4, 0x1C42A0C26B83E, 0x1EBAF6A7DA3B1, 0x41A7DCC60B130, 0x6F726AD3BF4FC, 0x12E6BC711AC4C, 0x009E084BFAB52 },
+    { 0x5AC62F8C9316B, 0x38DE6EFBF54CC, 0x2B05130125100, 0x65273C941A0C3, 0x7BEC2CF196284, 0x51BE7F98249D2, 0x2AA32E894A415, 0x115B4E206EFF2, 0x612066BF26436, 0x00E72AB12F90B } },
+  { { 0x4945FE4BFC3B0, 0x4F4FA2C71C1B3, 0x213D4CE01A0CD, 0x0E9FD2D223CDC, 0x121FD2B063641, 0x2ED4530170F12, 0x31A49A687DD6A, 0x3D96732FC3E82, 0x65FCE96F174C0, 0x00B0E8F37AA4D },
+    { 0x30CCBB48CA919, 0x1A6A0B36404F0, 0x072896B06F675, 0x20E268F7B007F, 0x0DA19FC95163D, 0x3A0C490DD8382, 0x357F955FD5F23, 0x36405DE871110, 0x1587C44B34C32, 0x007A7B442A7C3 },
+    { 0x38319C2F72A12, 0x16F1492A89A79, 0x2D5C80BA513A5, 0x5E9A617C459BF, 0x6B26FF14CBBF8, 0x37949F7850818, 0x7B2102E6AF086, 0x28BBC98C9BA31, 0x7B69A7E239006, 0x0119EFDEEE7A8 },
+    { 0x2513444E6098F, 0x14EDD6DC8C090, 0x51A2FDBF77C9F, 0x136DE06E11326, 0x45CD406A7CF3D, 0x408D1E6E14577, 0x707A88EE810DE, 0x276938A2CDE25, 0x0BE07667585D7, 0x009A84681C108 } },
+  { { 0x35472AAD789C9, 0x6031C24B76004, 0x0C56A22082DC6, 0x617C6EB2E1AF5, 0x463919C5B13B9, 0x0D026B00A199F, 0x7AC640AB99C81, 0x176A159BE5F54, 0x4D2F75CD8EE38, 0x01E83324585FC },
+    { 0x12436F702DFC5, 0x51368DDBE5E16, 0x73FD7ACFEBE8F, 0x1E3B3EDFD94C1, 0x58A6487192F40, 0x3D3489CD1B79B, 0x5E7FE3CE09CDB, 0x0F10418E9ABF0, 0x7E9913119C660, 0x00B5AD11B3BD2 },
+    { 0x5FB280976D98B, 0x35B1BAAF9C34F, 0x37FD773EC46B7, 0x0D1B5711ADB7F, 0x319EB1E400F90, 0x44B770C7E6653, 0x15E82C918448A, 0x4A0B2C5E7AADD, 0x18E055A9CA9C0, 0x00EE2D5458AE4 },
+    { 0x5E63837A1B161, 0x732F58C515330, 0x7F0BC82D6C60D, 0x5772B74944ABF, 0x78BD8E13A3793, 0x57082D9F5BD27, 0x2FF4B6D78498B, 0x7DB417F938C25, 0x0C421D70252C4, 0x00CB445448377 } },
+  { { 0x6B729604B549C, 0x3EF328B05AB48, 0x3E79D2AAE0B27, 0x23A5721A2CE73, 0x398BF83151900, 0x43786D8627C13, 0x24E64349F3463, 0x3B1BD2B55FF33, 0x77D80A1CEE069, 0x01A82DDC12AC4 },
+    { 0x7DD91595F573E, 0x775ECA9F63907, 0x420F932590DF9, 0x36CBC424CBD17, 0x73DF351DB3F27, 0x48476157ACD89, 0x2F5AD67CE3937, 0x19C69AB1ACB14, 0x3B300834DB2A8, 0x0059F901FECDC },
+    { 0x798A534A634FE, 0x472603B7159E9, 0x7DF5278B1A5EC, 0x380326DE6F2BA, 0x000BFC4D1934E, 0x3AB3CE87CEEA3, 0x288BB09F99816, 0x4393E99838F42, 0x52E4DA6D44AFD, 0x00CC60CE1A9C9 },
+    { 0x37CC3318B27EE, 0x641A940DDDFB7, 0x4A873AA35BE92, 0x24C3570522F1D, 0x4893F5B6D689A, 0x46FFA4388512C, 0x2AB23309DB7AE, 0x4000B8820E836, 0x5D5CD8A6433B2, 0x014BF1B856B7E } },
+  { { 0x23D17E4DC9E4A, 0x27B2CF43BB5A8, 0x5F52217078F8F, 0x4790C841843BF, 0x077132A0BBAAC, 0x147ED7F50AD0F, 0x38524B78894CB, 0x47B5EE044258E, 0x53FE9DE2DE797, 0x0145751B1CACC },
+    { 0x36015AFB76E28, 0x2F30739355477, 0x1827872DC3812, 0x088C9E06B7ACF, 0x524129D45B0C2, 0x14C3D5735BA2A, 0x3E89B37F830E1, 0x4EF036ED8E86B, 0x72D1A81F4FF25, 0x004B252BB645A },
+    { 0x1632EB8625DAE, 0x76A09DBBB6C85, 0x6715561D8750A, 0x4032458FB085C, 0x42F7DB6B78873, 0x54FAB842F375F, 0x4A1D47E390AE4, 0x5ECB736BA8B11, 0x11ADCA8A147E7, 0x01885BECBF300 },
+    { 0x21EA3D7D0FF8C, 0x29C5C3EEA7A4B, 0x618AD75639F4F, 0x7936BB1AD913F, 0x17AEC8B823583, 0x04E32968A07B2, 0x3FBF240E390F6, 0x1911881EE9CD2, 0x219D571340269, 0x012421441F92A } },
+  { { 0x4FAF7BB170505, 0x2E21313DF495E, 0x57565BC7F7006, 0x22E95F93B7494, 0x642F8E7C939BA, 0x3122AB5021C77, 0x4D0F9F54C117C, 0x0FCB89D1D01A3, 0x2A7081BD8259F, 0x0134399584854 },
+    { 0x0E7AF04E663CB, 0x59F9C118E6B20, 0x56EB826772B4A, 0x7098D4BCA150A, 0x338D68304C89F, 0x685B2F0C389DB, 0x7452C8E9EE6A6, 0x38826E3F449F9, 0x43D07C1F8F4B4, 0x008AF4F568C2C },
+    { 0x1549EDC091133, 0x50B065479691E, 0x7C89B99E139ED, 0x32DB2DF1C9618, 0x49A49DAA39798, 0x00F78DEFAE977, 0x3499C96A68785, 0x5B4B6275F4C90, 0x1B601FE4C637B, 0x01295C6054EDA },
+    { 0x7FF031336CC25, 0x27D377A152511, 0x05262C4FDA3FD, 0x14DED9CA31542, 0x5F94E4D5DECEF, 0x00777974ADDA9, 0x3BBD9B0411FE9, 0x23F1EF9FA53EC, 0x7B967D338F535, 0x00D245792DBCC } },
+  { { 0x4AE74CD52DA58, 0x78848AA2DA3F2, 0x6EF6544C41EDD, 0x625D010563CBE, 0x1A3D3B927A84B, 0x652A0BED3E7FB, 0x5E01F042AA87D, 0x6A450CE1FE4DC, 0x007FF95978AF5, 0x00F1E044C1C9C },
+    { 0x1B73219217B1D, 0x72265434E8C2C, 0x72A55549C60AC, 0x0E8908E46AC1E, 0x139E4B5D5401B, 0x3E2009F2EF40E, 0x1154699E61E0C, 0x56C97F126C0AE, 0x4349A6B569263, 0x009A0F4CB4F7F },
+    { 0x7500060DA3BE0, 0x687BAA4A9AA5D, 0x1C970193B52BE, 0x7C04AAF806A0B, 0x5C8AB5430BE38, 0x7F30501E45C87, 0x3D4DFA4607078, 0x5D0048E8DBB8A, 0x22BA3C3687D6A, 0x0045145B354CC },
+    { 0x71F53D2800719, 0x034AF69DF72CF, 0x0C49087DE583D, 0x0FA019D332EF8, 0x3C6D719159646, 0x1E0960E29F371, 0x4B7525F1CEBB9, 0x51A85A27D509E, 0x76B89AF206047, 0x0168DA18FD1C5 } },
+  { { 0x5AF0A0BF4C22E, 0x047BD03586BB6, 0x10F5D0F7E3DE9, 0x7A4FDF09D72E4, 0x7AC3CBEB20CD5, 0x77DD82FBA808A, 0x5EE100D25C355, 0x70CC570C470CE, 0x1C0F3F23696AB, 0x00FA4E065041E },
+    { 0x02CB8E6DDAB3A, 0x777D544AADC69, 0x0C3717C36FFCC, 0x655AD430B55A5, 0x6298646B93662, 0x3CA9CA2F1FDEA, 0x7B083928F9620, 0x68AD1862DB8D8, 0x33C326CC4CF71, 0x00B5F74C0521E },
+    { 0x1AB448C5C04E8, 0x12DF2B60B6B8D, 0x46F5E9A69252D, 0x458BDEAA27E86, 0x4339D2817B11B, 0x6141F8911CEA5, 0x06B878D99FCA3, 0x006F5133D8E6C, 0x1EAEAA9F4B732, 0x0103A186D3E0E },
+    { 0x6C53B519A7E04, 0x528A8BC35E2C9, 0x2498E11FBAD6A, 0x4A3AED65D8238, 0x537B773802E30, 0x71763212A3466, 0x778A2D65F11DB, 0x0CC3F3DBAE7BD, 0x3A8E0F165C37A, 0x010989C5E037C } },
+  { { 0x61A1BCBCC8681, 0x0B0D970B9905E, 0x317A7F9AB1512, 0x7EF5C06521B6B, 0x346214BE361FB, 0x52B73E3AA35FF, 0x7212066E356AE, 0x5BE0B8657E040, 0x3CEF2D2A0DE64, 0x0172034A5D414 },
+    { 0x48067D59136B6, 0x084F2D096367F, 0x3FDC90F0737A8, 0x4C846BFCC3D5C, 0x46C611D4E0DFC, 0x23D4C50292116, 0x48FFFAF979EE2, 0x078C2FD79B374, 0x76361EA728A19, 0x00A48E050E15B },
+    { 0x797465A93AC59, 0x5CA2A7DA5F875, 0x3DED741447CFC, 0x3F2110C87978E, 0x48663E1068169, 0x4646F7C6DEE20, 0x647A7DF18F72C, 0x5019352AB0C26, 0x13D1D34C0B142, 0x00E7B11583B83 },
+    { 0x10D6BC2F85D6E, 0x3612096FD6EFA, 0x0A720EEB5ED23, 0x2A501C009B4ED, 0x14E8AEF7BBB8D, 0x2643B4C8E1210, 0x228CA681A39ED, 0x05BACA582D4A0, 0x0BFFDE5288000, 0x01259B66BAF4E } },
+  { { 0x64E35E0F43A70, 0x41B8A930F530F, 0x79A8EA9C7F509, 0x69A3BB53F308B, 0x3B41E27798834, 0x3EB8DDF4877EE, 0x1FB9B8AE058B9, 0x2AAE257A3B648, 0x764375EE3C25D, 0x01574C6C71DF7 },
+    { 0x19D5B1A76DE39, 0x7FD03A1E5E499, 0x42C427681C53D, 0x785213ECBDDCE, 0x68256C3276158, 0x4E96419505EC9, 0x0A7C3C6CBBBB8, 0x08224B456CD37, 0x294FB8BD6071F, 0x00E0A71BF78FA },
+    { 0x29C2844A63C56, 0x4D85AAE81A1B3, 0x095A90ECCBF85, 0x18515D68DEFA7, 0x216AC87152529, 0x65C90109E5C72, 0x3FEA8437C9511, 0x1D21B955B73F3, 0x2098B2F054510, 0x00FE1C4C8CE13 },
+    { 0x7E5F09788AAFF, 0x10AFD22829CA2, 0x70CCFAC7667E1, 0x5C3FB01AA6A94, 0x1D6B8F9F297E9, 0x58281D7D64A72, 0x75B4483BE0B76, 0x20B39108E068D, 0x1AA648625F368, 0x01126D7023398 } },
+  { { 0x7EA5352C4034E, 0x1E9753AE4C175, 0x24694EA39773D, 0x542751889F76F, 0x2FFBCB405C380, 0x3637410C7F622, 0x30FE817275669, 0x2D582ECD890E4, 0x77F3645D44E93, 0x004BEB9BE39DD },
+    { 0x15D95D199242A, 0x7B2259FBE822F, 0x359935BFE56C8, 0x6A1628B5905B7, 0x63422B304CECF, 0x3BCA378ABAC5A, 0x617A93F29794E, 0x75EEB93C611B9, 0x14A25E7205079, 0x006F8EFCE4586 },
+    { 0x6F050CFAA7242, 0x5EAFFB5119FEB, 0x36EAEE5ABA2AD, 0x1F991DDD0D36F, 0x7D56E3CD1E7BD, 0x5A904FE4ADE75, 0x5B741976A51AB, 0x4887DA95A1A0C, 0x32330B893A74B, 0x0113729F62ABD },
+    { 0x4F0716C27B2E2, 0x7A927D45B8166, 0x3A6A96FD4E1CB, 0x154E85DD095D0, 0x688A15E91CEC1, 0x7B2FAEEBD667D, 0x4FEAB8DA30A13, 0x4B49FD7C94529, 0x02210478586E8, 0x00A0A234736BE } },
+  { { 0x6D7CE0717ECBA, 0x765DEA3962920, 0x4BC6DAAFE2558, 0x29DC3CCD41E42, 0x2C72D0534F14F, 0x31EE85A8FD97A, 0x5F791D3D6C31F, 0x5D50DF55EE47F, 0x5E1F7FC667812, 0x011739F3F3676 },
+    { 0x7C739D8CA6F23, 0x4563AE7436511, 0x3FC94A942B4E0, 0x22C91C1DAC18C, 0x48C29BF380744, 0x759BA1342F623, 0x537179A670160, 0x57DD09DB1DE7E, 0x57A86DD458DC3, 0x00498194FCA8C },
+    { 0x240E2B53E34A4, 0x0E780B57BF339, 0x57492EB6E3B54, 0x1BD077A5CC2EF, 0x728A577C17D23, 0x682D1FB8C28F6, 0x745CD8E371635, 0x7A7E4F5A76280, 0x55D4450747CFC, 0x0101D59CF42C3 },
+    { 0x5062F9965729B, 0x2CB720BD4ECED, 0x20DEFBFFB1004, 0x1C968EA679669, 0x22517AFF2BDF2, 0x496DEF8B351EF, 0x722DD7BB9A3B1, 0x4663D3745B666, 0x14EBED00D4A8B, 0x013802AC082CD } },
+  { { 0x6A0905375686C, 0x1D108438CA63C, 0x3413F8645645D, 0x41F48B3D56844, 0x48619CA2A45B2, 0x0BFED7C549B2D, 0x0370746FC6ABC, 0x4C344406DE58D, 0x55C987B6E4815, 0x004FDBF752A73 },
+    { 0x2B744FD418AB0, 0x5380C758E3FAD, 0x58BC8EE218BA3, 0x5E13C3DB06480, 0x0021BA029F9CA, 0x3DE6A411A0EFE, 0x1F69F5DCFC83A, 0x770A87B84ED65, 0x213A740D7A737, 0x00409CCDC7F05 },
+    { 0x4788A82518D22, 0x2099CD0A1971F, 0x52721847F64F4, 0x3D8FD961A06B6, 0x2DC726CAFB550, 0x5B714F8A57D49, 0x3DCDB80B17F78, 0x4F1D11751E3B1, 0x09635736AC077, 0x00F8798C2C3DA },
+    { 0x44C3DB501B082, 0x33BF8E583BB94, 0x500AD9FA99F47, 0x4A349A357321A, 0x64B0195C45645, 0x265FCF9621E7D, 0x237AF1619B03D, 0x46FC6B3093021, 0x6F97CAF6BAC93, 0x012ACFE76E4ED } },
+  { { 0x649FBB0B9C13B, 0x07E648894BFF4, 0x00B961B744A9A, 0x588FE3974865A, 0x3AE73EFBA5223, 0x0791B6F93493F, 0x007110634232D, 0x7B487810A52EB, 0x2355977E7DB5E, 0x01339FD485FEF },
+    { 0x37B170AC23647, 0x37C47924ECDC0, 0x716E09271D3CB, 0x38200710D3B84, 0x1A83626D57C9D, 0x4CFB77556267A, 0x03DC20B396E52, 0x5A58A3CC43588, 0x08AF4B1FDA598, 0x0053AD41F159E },
+    { 0x6FDE95E14F835, 0x07B5C095C8B8D, 0x6DA9995F25D2E, 0x06A12BC268169, 0x521733CE73945, 0x36AA5C75C9D32, 0x10F20C263F853, 0x446F060F1D1C2, 0x0C3517D59715C, 0x0069EB076E365 },
+    { 0x2C4BCF255BFD3, 0x5E7AFDD41961E, 0x1240CBE2BBAD6, 0x7F15BAC93C616, 0x533B2ED4B51E9, 0x57948EA739BB5, 0x75178767E35B0, 0x0BCC0E6A69C2F, 0x6C6B1A5945574, 0x00E60CBB17B7E } },
+  { { 0x678A18230E100, 0x7EDA383039D1B, 0x169E48DC4F855, 0x3AEB4E1593829, 0x441CAC16EE61A, 0x4384DF94CE31E, 0x2761A9594ED80, 0x4273DCC01D062, 0x34438CCFF2DD9, 0x00CD0019A47B7 },
+    { 0x511AFEC32BD61, 0x16C5FD4943A65, 0x12BE45639DACE, 0x7DFA34DD95B9B, 0x60B4B1829FA13, 0x0AE4EFB8DB528, 0x5A1C20C01ECAD, 0x6EF841E70F523, 0x00C243F4BCE78, 0x004691B5E412C },
+    { 0x1EC88509BAA56, 0x40C393E46EF04, 0x773BE23616A1B, 0x59583B0354C7B, 0x43AEE45A53FD8, 0x3495D3FE91D92, 0x256F4DFE715C0, 0x02865A24F8FB8, 0x39E51E36A0CD2, 0x00D974559F066 },
+    { 0x01873CFC6E0F1, 0x7A42F4C39258E, 0x52370D1FDAE1B, 0x588DD13A66BBA, 0x40225F2705543, 0x58F87745B8B4D, 0x7F99CD9010E04, 0x07D47753B2C67, 0x76B718AA56B86, 0x00F1AA689675A } },
+  { { 0x2C8899900EA85, 0x1AE99FB89267C, 0x4D76FC14F2804, 0x39DE1ED3894E0, 0x535C03CB486AC, 0x2256C60573C09, 0x0B54CDDB5E032, 0x1907CCEDECECF, 0x282C152F9C20C, 0x00E34C95112DA },
+    { 0x3E97A65BA7662, 0x1CA05AE4913B3, 0x64C46F063C690, 0x59085F27CFF88, 0x6511421D21C95, 0x0ABC0EE3327E7, 0x20A37C98A13DC, 0x57FC4D7ECAADD, 0x5D404C3819594, 0x002D389A72E18 },
+    { 0x7C52E26D20423, 0x470BD1C066119, 0x69FCF2078D3EA, 0x643E81EEA3491, 0x4E2D5078F15FD, 0x0B99C450E8160, 0x3BB9776CD3A09, 0x7CD04A685D0C8, 0x12764B1F95736, 0x014F6F7F739FB },
+    { 0x2BFCCE173152E, 0x524AC59BCE7AA, 0x3C8B45FE7CFCE, 0x3F907F0C83881, 0x43F927E0562BD, 0x0BF7F3099BF57, 0x43DBC06971355, 0x5B9D6566C3B86, 0x73824CAF3626B, 0x012BA4D846079 } },
+  { { 0x1C113C0E61C45, 0x2539EFA17730C, 0x2808726EACACF, 0x41438017B8936, 0x6880371A6E9AA, 0x395344B8A6FC3, 0x747E84AF67F42, 0x702E1958FF682, 0x21CFB3C06F693, 0x0191F5AF651ED },
+    { 0x13C44037A2DC2, 0x0E036C09E7000, 0x0756F148F1E50, 0x22B0448A2A2FD, 0x2B1EAD6AD7248, 0x4192E01E4B518, 0x29910E581EC85, 0x60499056160D4, 0x32EF28126212A, 0x0076EDF6E39F3 },
+    { 0x4142B22134001, 0x01C4634B1E7CF, 0x24A3246C54A33, 0x0C74482E65462, 0x099898B91439E, 0x5DCFC36C4E3D3, 0x6B46766A3B8E9, 0x7C21F1F14B87D, 0x07CC8A81B5E5E, 0x00F4D46BCBE8C },
+    { 0x3349CD282530A, 0x7C067D5776E93, 0x7F140C010A1CE, 0x4E2CBF2F1DA51, 0x57FE2041C678A, 0x2F652992EFE55, 0x6B299C1BC6CAF, 0x4D7FAB77A51E1, 0x007089B2F6BA2, 0x0150FE41C9C81 } },
+  { { 0x6EC8E53ABFC23, 0x084BAE7EB0FE5, 0x0B71F198F014E, 0x2802E837B68FA, 0x66153AA374DB1, 0x17EE21D25E6E2, 0x4F5E310F78B27, 0x4F8F470CB4569, 0x599C32D22791C, 0x00C5D9EBB33DA },
+    { 0x390E6A9B1F72A, 0x0770140CE934E, 0x0C975D4C5BEC5, 0x2A94707ACAFCC, 0x6397554C433E9, 0x72D7AAC3F8A91, 0x2A5DBC0E3B068, 0x69BE2DDC150F3, 0x550CAC14B96F0, 0x0067AAEB85603 },
+    { 0x7837B2107D017, 0x1779E6378A70A, 0x467D166D73933, 0x1C79BCF5A276D, 0x5407C96687789, 0x525768AD47E94, 0x0C0B1FA6F03F2, 0x17850E84A8614, 0x7544B7F25A872, 0x0130B1A3C2C33 },
+    { 0x56215A13C2F22, 0x7C68145E734B8, 0x11A397CE28F59, 0x69A8DFB0B6315, 0x79098AAC7D030, 0x10405FCE7CA11, 0x74D6567FEF7C6, 0x0103611605A33, 0x55C77E5A7786A, 0x01647D5738E7E } },
+  { { 0x24888349153A2, 0x3B461546FFEA6, 0x33E1350A6281B, 0x334026E16E806, 0x648082179A9B5, 0x50C0CC20F13A1, 0x571D0C942D942, 0x00DC450B426A9, 0x086D9BA306017, 0x015D624788BC9 },
+    { 0x5E411C5843368, 0x729D44580756B, 0x1ECCC966099BF, 0x37D26E2684D82, 0x701E230B64122, 0x21D13B77A1A9B, 0x444DC34CB69FA, 0x081E317B36815, 0x512CF68129269, 0x00ABA1B879B90 },
+    { 0x00EFAAA96020C, 0x36DF1BB00BCCE, 0x144EC85692E8E, 0x0B331AE42851A, 0x490F45027FFEC, 0x632DE8622DC6A, 0x576D37CC24591, 0x27180725DC358, 0x45DFEDEEA1AF8, 0x01485EECC2755 },
+    { 0x0D4C89DE969B6, 0x068C72D70CA39, 0x51657AEA2D4F7, 0x4183A9C2ECA74, 0x5F2F26A133499, 0x01B9CEB953F4D, 0x0E1D0EEF90409, 0x0B3382BE41137, 0x121069091436C, 0x00EA67154F220 } },
+  { { 0x52881718DE73F, 0x11515F332D998, 0x17530848CEF8A, 0x20EDECA93058F, 0x4F177B9E975CE, 0x797EF1CF8F302, 0x14EB9DE72F672, 0x256C7D25C054D, 0x4E6B47C8EC245, 0x0109143E6F564 },
+    { 0x4BB2C116091A5, 0x1B835D238409E, 0x4E017623E31A1, 0x6F10758C507AA, 0x632C289343B5C, 0x7626BB10454A7, 0x51EB676600BCA, 0x1487B86DE792B, 0x4122DC0386075, 0x007CA6643E62C },
+    { 0x27AC5A0EECB45, 0x28EDD0CAFCF54, 0x5FD8CFBEAFE7B, 0x226F695E694D8, 0x4961C1366261A, 0x238870501C735, 0x14F0AFCE2A31E, 0x3807EB4A548EB, 0x20BF99104507D, 0x002C0CE6E2BFC },
+    { 0x3F88E072A28C1, 0x34D4EFFAC2E09, 0x2F7920891184A, 0x20D268ACCDCB5, 0x1DF6ADF686B1F, 0x542E51EA9F2E6, 0x2BFD3C01BB8E7, 0x2DAB1D88A652A, 0x05CB4717F3EFE, 0x01417CC965F7E } },
+  { { 0x79C6A71429020, 0x226CC17BC2EE9, 0x126CD6A0046B1, 0x65E14A5D666B8, 0x06C499FA1A771, 0x75528F2238A87, 0x60507D7A47D32, 0x28D9B34ADC7DB, 0x7EBC193D471BC, 0x0192F6CD7ACDD },
+    { 0x24293283A2722, 0x5C2489534A65C, 0x173BAB3F483F3, 0x5DC5BE525EC0E, 0x4C5D55392F104, 0x636E76CC2EBC2, 0x54365562906D2, 0x600C184BA1E07, 0x40D6AC2F0257D, 0x007A2182801E4 },
+    { 0x602F4F95B26C8, 0x7E23DDA6FD8B5, 0x766DEF1BD2312, 0x1C9805BB384D0, 0x5F42BC244C752, 0x27E1EB2AB182E, 0x1E11C8E7BBA08, 0x10D213DDF03F0, 0x604CA52A86FD5, 0x0142E14C3D21D },
+    { 0x40D81E5D193C6, 0x39813A6010BC9, 0x25CF869CCBEC1, 0x21FD6F5063688, 0x5E4A41692D4B2, 0x2C7C9BB7B47D0, 0x2CCF68EF80A11, 0x1A22DFAE1A60A, 0x6A0333C21BD46, 0x00BFACAC50571 } },
+  { { 0x737769B5C88DF, 0x2065BF3E9FA18, 0x32CFD91AD7700, 0x05417F119D28F, 0x2C9CD7183663D, 0x1322020191A4E, 0x0F73F955E3204, 0x0A9A9E23BD800, 0x0D3A7D1A2319A, 0x01695A2E891EA },
+    { 0x6255E3D2CF9BC, 0x5566FAF9BC79E, 0x1F4FF1B1EB7E0, 0x11DDF10736C13, 0x41B0FAA3FE4FD, 0x565C59AC96610, 0x0AAD6D013CB09, 0x034D6A4A2EDF3, 0x479EF1E4DFA9E, 0x00E940E213C94 },
+    { 0x13FB1BD722921, 0x4C8482291F9E0, 0x702387638205A, 0x2EBAD65374DF9, 0x58EB6E501523C, 0x4962566A3E257, 0x59C507AF27173, 0x6728C7BA2D55F, 0x27CD93B4A8514, 0x01329AA4BC72D },
+    { 0x6F531F69BBA7E, 0x3E263095525F4, 0x616B5E3AD4821, 0x2F57B6BEDCA64, 0x3DB990D2D801A, 0x4A89FBDFF5E29, 0x0F71579263DDE, 0x35F64A7AD8E9E, 0x3F3FA4726CAF8, 0x00F4B9A3E7EB2 } },
+  { { 0x57CE8BDE8FF42, 0x3D747A4D18627, 0x4B823D771C666, 0x1D8EBDC13C8AE, 0x345713762EB05, 0x0213D083A56C8, 0x0C57267005B26, 0x184D58D65E93B, 0x7165355820B1A, 0x0156A3C3B9ABC },
+    { 0x41364BC6D2EA2, 0x38AD6D4408294, 0x1A3EF6980FDAC, 0x64BF91B5A9303, 0x6259DEAADDEE1, 0x3AB6AEB82CDE7, 0x32E3A65C25078, 0x54BE0AD69E07A, 0x6CD85F3FC43DC, 0x00563D5887A96 },
+    { 0x699323C23207C, 0x49398E63F3E3D, 0x575F0DA8A7237, 0x246B95528F422, 0x4CEBE767D9A74, 0x0FB7057D6B6ED, 0x7226448DF9A49, 0x5F13ABB41AD4C, 0x61610B46D57B8, 0x00F2B3C6FCA87 },
+    { 0x4420D6810F044, 0x50FF7292C72E2, 0x2D0FA88C809F1, 0x716D046812E7A, 0x6B2824A225613, 0x6FD0244C55AB6, 0x25EAF6D40CC8F, 0x5253CAAA4143B, 0x57B4658FE90C3, 0x00CDE264A2858 } },
+  { { 0x17BDA61FB7846, 0x40238D5332346, 0x1DA4878DDBD3D, 0x2E0D60F911A37, 0x4DD07107003ED, 0x2B22CB07B7C67, 0x5F6A4AFE92715, 0x6E3F929EF2E87, 0x0DC2EB943DD4A, 0x00EC0BFD55DD3 },
+    { 0x5814194594F60, 0x1841BF3BDC047, 0x1C9C7B40E365C, 0x124FF25867AF1, 0x6CD8075ECA877, 0x45FC0D4E08AE8, 0x40484C1317A02, 0x78CB024D8327F, 0x043237CAEAF02, 0x00F823FFFB36C },
+    { 0x59A2E69249896, 0x6718F76089FC5, 0x08967D9306FFA, 0x166508292B2A2, 0x14753342C7890, 0x3819237B79EEB, 0x524FD5888EB96, 0x2946094AD6168, 0x79074E6329B28, 0x01222D650270F },
+    { 0x531BA07FDE0A4, 0x2CB77AFD7A05E, 0x1E84533F80DF0, 0x3FCCE16D0F6A8, 0x16FFD78FE2661, 0x71DE05B829D32, 0x2E6DD1EB99891, 0x0A4378972AE47, 0x025EE83F70A7D, 0x00F7B79B3BF54 } },
+  { { 0x6F06AE96632F2, 0x1CDF3CCA4CD0B, 0x4CFCDE659A515, 0x00988FDCEFAA8, 0x0E5E473547F82, 0x5D1E14563C1AF, 0x07D35104B080F, 0x6724AC4627212, 0x38CFCD4750362, 0x010690CE2A683 },
+    { 0x5EE02E485A1F3, 0x20B4C9DF1E8E6, 0x70941F607ECB1, 0x6F794E9D92AAC, 0x138E3E9B8C782, 0x745139CE92149, 0x63E5190822895, 0x5BA3CC7EF0FA6, 0x38E8CB76B9BDB, 0x00AD24F0D6B14 },
+    { 0x7699E3A528412, 0x41766EAC5B53D, 0x4C8C9EC4F1187, 0x4101234B15117, 0x484A353656FD1, 0x46A388C1173FC, 0x0E682975DBDFB, 0x428EE03350193, 0x67CCEBECED75B, 0x0099CC079A6E4 },
+    { 0x476DB04E4D7FB, 0x5CAA87251A743, 0x4559AB29BA067, 0x335854585D154, 0x06A694E433C22, 0x44DA4A3AE3EFB, 0x0C647D6C8A36B, 0x12ED4B5DCD0D8, 0x794DF3BC4AE27, 0x014DBF2E343EB } },
+  { { 0x77CC9CE42A05E, 0x3625D0A0A0BBF, 0x7675F69F7D2F6, 0x3128068BFAF14, 0x70C9C20D0BE36, 0x2C5BAA042DC55, 0x40BB958720019, 0x21D1FE39EC939, 0x17ABE2B0635B7, 0x0178E9DD4D514 },
+    { 0x1F92C4D183140, 0x154A2542C58FC, 0x50B3DBA29FB87, 0x7B3E220C8470F, 0x63E913B4C0EBD, 0x38A261C6B35C9, 0x041DB33C5AB37, 0x31C3A3D921450, 0x1DFF389768B31, 0x008CE12A3A1A7 },
+    { 0x0A7025672B58A, 0x3DE3AFDAE9450, 0x6265B3BE6FA1F, 0x7F63F9E4B83C4, 0x7747750EA3058, 0x0BCE04130B373, 0x6F8FF586910CC, 0x2ACAF5F5F57BB, 0x785F2F8DE2A03, 0x00D1142063CB4 },
+    { 0x308D56618A7AA, 0x2733D9DF9C6F3, 0x34F7E055CFDAC, 0x510E814B8B00F, 0x2AF2532C67BC0, 0x2E2C1E2BF615C, 0x1CA0DF5625808, 0x07B749C2614C3, 0x33A4A2F45D942, 0x00A3BC21F2843 } },
+  { { 0x5019813DC0E8E, 0x6E3FAEEA756D2, 0x128A46A49981D, 0x452B73037F253, 0x5DF22D83F6C90, 0x2844A32846FEC, 0x1A76E6E5E08FA, 0x05F584B5AB2F1, 0x09E915F6F4BB4, 0x01672A1BD27E4 },
+    { 0x249D0FB3A8ED3, 0x69D4D196B151C, 0x21B6B54346056, 0x6D9563E1F7371, 0x798638B2ADE81, 0x013645CA2C301, 0x1AC726650BE29, 0x113C525863B97, 0x7E38A4B4E8D6B, 0x00A5C3D24516A },
+    { 0x441A41C19ED20, 0x2DDB4F579D8E1, 0x57A717C3913FB, 0x006CD97861C14, 0x50899D2D0E938, 0x35E61D71F8E62, 0x5A76F0993C307, 0x232428C48F3C7, 0x64632488838F7, 0x00AC560BBB017 },
+    { 0x378C247E9900F, 0x43ACDD6B65210, 0x66481A06C2358, 0x44AAC8DEE8D14, 0x210A2A3336100, 0x18B488B6528B0, 0x16CF588F2A4B8, 0x1DEAFE4DAB34F, 0x31879270AE212, 0x00CFAEC5945AE } },
+  { { 0x43DD76CB2A9DA, 0x4DB0A9F701D37, 0x7F08AC4112BC1, 0x2DFCDF2D1235B, 0x2D270BF99176B, 0x05B0D6C4A8BFF, 0x4B77C0A47E3B1, 0x73363756AD313, 0x55B192A236F3B, 0x015CDCE8004F7 },
+    { 0x48F542B06BDB1, 0x553B993C3CD74, 0x334D2696E404B, 0x4FE744A4031FB, 0x4A586849CCC27, 0x6EBD7132F8ED2, 0x000310793DB0C, 0x1E1E2D000538B, 0x39442D1AA61D3, 0x0064CA65D85AB },
+    { 0x5D72EB6AAC56A, 0x04E5624069A05, 0x130EE7A812469, 0x69D8894F9AA58, 0x3A5D8CFCA71B3, 0x11346CCD63F38, 0x2AFB1344DD011, 0x5BB6775790936, 0x164A167AEAB07, 0x00BBB41BFA4B5 },
+    { 0x3E065BFDF2659, 0x3204D903CE208, 0x2BC57BC6247AE, 0x5F9F49B72AFE0, 0x4E95CB851F258, 0x2BEB0791303DC, 0x5D1421B9D0523, 0x3F36D1B96D736, 0x0214238F18FE9, 0x014128DA1C05D } },
+  { { 0x51594A89443F1, 0x09BC46F2581CB, 0x5C55D613651AD, 0x3577542B75544, 0x6FD081ACEF418, 0x248AB32819B98, 0x5F1A506DBDE60, 0x6DA1399790C0B, 0x47483E5B2BF17, 0x006AE26A44B3E },
+    { 0x03895B7C52C05, 0x315B7D2379217, 0x7114571FB5A45, 0x1570515B0D1B7, 0x6484E858B7108, 0x05B27EF52D8EF, 0x65BADED3A90DB, 0x56C7DD5570730, 0x46B14CCB96857, 0x00853199838DB },
+    { 0x1DDEA470E9B77, 0x63E42A3A6B5C0, 0x1F1E718C7A6BE, 0x2F0B5F20F3D9C, 0x417673C0471E0, 0x739BB824B9FE3, 0x78E5A938BA703, 0x4AD9AFBD10642, 0x4B84D4E674BFC, 0x00D1858AC8EEA },
+    { 0x4FFCB2F56194F, 0x211393E6EBD13, 0x78A66A372F487, 0x246C821E50096, 0x1A137BD8B1FB5, 0x7F46E78A3DBCC, 0x2BD248FD345E1, 0x27DA5D0A4825B, 0x63B35FE5ED7DE, 0x00E454F167984 } },
+  { { 0x0E4BE1DD3A3C2, 0x44C4F7C0A8813, 0x3892F9D8A16E0, 0x589FDC61BF0EE, 0x435C52E8C3624, 0x1150310152069, 0x554AEFE65C071, 0x0B05D14707EA9, 0x32E81D3BE5AD4, 0x00901A78C1F8B },
+    { 0x4ED1E9AB29AE0, 0x4DBF05EE9F963, 0x6CF19EC463366, 0x2AD091CE609E8, 0x41124BA3FC125, 0x16FB4289A8DBF, 0x2296F442B11FB, 0x36D8E6AFBEB9A, 0x4E5750B186078, 0x00923F1028661 },
+    { 0x71FB2F5F2E320, 0x596F2D4477654, 0x4B1B107E0CAD2, 0x0F301F66803B0, 0x7E4D9E7414D25, 0x446C7AEF15AED, 0x261EBC873FE59, 0x1D2B25F69BDE5, 0x74F40A344A299, 0x012CD9437E2B8 },
+    { 0x3D00FC54BADF4, 0x3D43065FCD8DA, 0x76815A0536FD7, 0x241240C3C661F, 0x3875059DB762C, 0x69945BC5C1348, 0x286F87958EA2F, 0x197E22B5414AF, 0x121A777BEAC08, 0x00CF75CB1B407 } },
+  { { 0x2C253D6382D30, 0x55D501F251AC1, 0x7E56DB4B41538, 0x67FAD956716DE, 0x2E9536318CB12, 0x1CD23F45C7ABA, 0x345505911F076, 0x1CBDBEF82BD98, 0x507F82706BA0D, 0x011238E34CCCA },
+    { 0x6EE7FD5D707B2, 0x0E4CD9AD05985, 0x4143899712FD4, 0x3E9AD92A1F619, 0x68A5F78E15708, 0x6B4344F82EFAA, 0x6E4C3BE3D9FEF, 0x7EE84D498DC5C, 0x306620557C72C, 0x00634E93A2D77 },
+    { 0x3BA9C4065919A, 0x25DE228FD9420, 0x6FE73D7E00AF6, 0x048F622AC4E68, 0x22F21A97E31DA, 0x4DACD0653FCE4, 0x38FEB62C8B440, 0x696F4620ED6D0, 0x2ED0155E74894, 0x0015F6934ED2E },
+    { 0x52441480FADB6, 0x0123188868501, 0x3098FD18E3741, 0x034EE76EE32C9, 0x7AE5E00BB1C50, 0x7AE2DB36DBA8B, 0x059C1AB28DB57, 0x13BDC0047D5A3, 0x605FD04EC7724, 0x013ADCB63EFBD } },
+  { { 0x13EC20C3B7446, 0x77BCD19001802, 0x714764BA5BF1B, 0x37479DD846440, 0x0EEEEF31DA021, 0x7517BEE248ADE, 0x509F21F74C344, 0x24651E01C84AB, 0x36124EA19664C, 0x00AF90F64DF30 },
+    { 0x1AC066A311C3A, 0x5054E3DFF1F48, 0x4E7AC53A82A42, 0x55B467C8C8A34, 0x60FA5E08BE83D, 0x369C4DF093E16, 0x2115120E93583, 0x0A7427916164E, 0x7B330F87ADBC8, 0x00B050A7C501C },
+    { 0x528DD3B7EEC44, 0x3B7F151430E6E, 0x0E6BE7BE08E21, 0x159E33FC4483F, 0x56A3FD9B91FD1, 0x41B20384BC06B, 0x5D206F1C86E9E, 0x47088928D6ED6, 0x22665EFB3C95A, 0x018DEA622B9FD },
+    { 0x0DCE051E16740, 0x322263E103E1D, 0x646DD15CD7CB3, 0x10E3B4057706B, 0x34C25566887F9, 0x663E9FE27CF23, 0x7301F7F4C1113, 0x0A99CB9EA7D44, 0x33AC11C2771C7, 0x011CB60331E91 } },
+  { { 0x73DBAB6CA36C8, 0x77F7E513434DA, 0x1F247ABD577F8, 0x60DC6B6770165, 0x1F4C0D4BEC837, 0x089939CD791C1, 0x23537BF07B478, 0x05F708FFF14E3, 0x3F51D1EA73AB8, 0x00B3B1CC4F975 },
+    { 0x4F0614361257B, 0x39EEF413C4D5F, 0x5BA9E8802BAE8, 0x22B724FC04C1C, 0x1980A4C07EA6B, 0x548672F6EB9E5, 0x7DAC015E21BBD, 0x0B9965ADFD986, 0x30A7A4206C10E, 0x005ABC0A1CC23 },
+    { 0x5515363DDB65E, 0x2302F8B28B31C, 0x230D18D4BEC51, 0x17DFAB65EE0D2, 0x0D8B576C2E111, 0x6A8DFFA5088A4, 0x1744FAE8F9735, 0x1388BDF3070A6, 0x5809452EF3905, 0x006881F19D182 },
+    { 0x473B9EAE7DD9B, 0x0DCE874C57747, 0x45DA01F922FF9, 0x6C08CB6B9B5F7, 0x7431C5F95C147, 0x48DEC47054695, 0x6D19DDA5B3DBD, 0x1E414BB18B09D, 0x0A3E930EBC3B1, 0x010701EFC244B } },
+  { { 0x5D443EBE634BA, 0x72B0163416E4E, 0x555EDACB6A2F5, 0x2ABED7ABE2D48, 0x65CB54CE3982A, 0x068D11C6F1DCF, 0x45D6D20E000AF, 0x08A7EFB6F314B, 0x1D5F756DA9352, 0x011F79FA1EDCC },
+    { 0x7303470399283, 0x59F83995490F7, 0x0F54E05E3379F, 0x37D4F59FCEB43, 0x5C563091BB439, 0x6AD163168A8DB, 0x471DAAC418EA3, 0x6F3E2812BD868, 0x438F8781AA069, 0x009739C40BDCB },
+    { 0x39BA171C07458, 0x5FC4E0987009E, 0x264E78C166B28, 0x455BBC4DBCA4D, 0x4289E4DEB0092, 0x74C47A992E31C, 0x60CA2971E511D, 0x568C3F4D0E3CB, 0x473A8403A7570, 0x00C538CED43D4 },
+    { 0x382A88E422FA5, 0x671F65AD2CC77, 0x41AE32AE059F6, 0x38D47B189AB40, 0x364FB465F2ED9, 0x63BC3E4D488DE, 0x294E5F5405C00, 0x0BD5BB3FEAEFC, 0x1B921D54CBE26, 0x00BE89CDFFF2D } },
+  { { 0x6A19D33A490EA, 0x29B1721996797, 0x18D99F7DBB7AE, 0x03A31C51D1CC8, 0x019483D8243E9, 0x7DFD320AF50D5, 0x26A11ECF71BE0, 0x06300C4589999, 0x126F0113EC5B7, 0x013F525347BAA },
+    { 0x3CBEF9B7F8647, 0x61E259F13F113, 0x17F73426A63A8, 0x5D85AFB51CABD, 0x5E421E98C8A69, 0x6CFA701D6F9FB, 0x4DE03C520767D, 0x1446DDD345055, 0x6FF58DA48DAB0, 0x005038265A7FF },
+    { 0x4D205239762A2, 0x1CC5EC7E76809, 0x30EBC1ADBEC6D, 0x21C2C8411486F, 0x1A8D49A9BA273, 0x11D8756CEA65B, 0x2AC1CD9C26F69, 0x022A4A9BC77D7, 0x1CF629F0D67C3, 0x019A96A866ED0 },
+    { 0x6BFF0E6FDC3A3, 0x4C6599B9F3818, 0x74872D093D194, 0x4F59F3280E083, 0x2B9FA2D5BC664, 0x36D97E9FCD5CE, 0x7B237189D150B, 0x2C3290C252672, 0x24CEFD57C5D0D, 0x00FFF75531996 } },
+  { { 0x3583DA370A68A, 0x47B342BC3FF49, 0x4EE840AEBCB27, 0x4FE6FDDD0134F, 0x4517DBE0F48C2, 0x031346E468C59, 0x47E300A88469B, 0x64760BFE61466, 0x07276977AEB81, 0x012A3287545AB },
+    { 0x157F1CCB8F177, 0x64C75E28B18F9, 0x755062A464932, 0x2AF8060213FF5, 0x69A78ECACBCDC, 0x7DC5E5A5E51A2, 0x0EDE705A9FE9D, 0x3AB56AA67ED9E, 0x4DC93E267836B, 0x003F07B33B88A },
+    { 0x6057805D24E8A, 0x426B47B2C426A, 0x5599642BF8982, 0x76982AB1066A5, 0x5FCE04BAF0D7E, 0x633853741A4F6, 0x6BA33E212B068, 0x237643F2F41FF, 0x20838A7E10376, 0x0152E76A104CF },
+    { 0x6B0539A8AF115, 0x5E49EB027722F, 0x3B1EADC9BB33E, 0x00B8B01023B43, 0x108292DCBCBF1, 0x05E5BD07E0275, 0x4010C8E6256DE, 0x1D25DBBB997BD, 0x78AA164CF769F, 0x00C5160D6CD1D } },
+  { { 0x7E08877402E68, 0x6DF00FF996B76, 0x33A4DD219243E, 0x579FBF645F9B7, 0x1B0D957BD0B42, 0x49831F8E51E97, 0x2D1BC176DBC40, 0x48B5BB1E5FB89, 0x29EFE82B26416, 0x0176CD0BA3870 },
+    { 0x431CEF829B14A, 0x4870496B323D6, 0x71D8720B72D34, 0x0C62D169AADCD, 0x120319B074DBE, 0x5EC1AFF59FC70, 0x61B11DBE3C1CA, 0x6B79D01ABE347, 0x76120B6B2C56F, 0x007FFC1C24BBE },
+    { 0x5EC1B11B00EDE, 0x59B668E5AED36, 0x67E17BCB9AD49, 0x529C3114392CF, 0x76B1FB4963B2F, 0x55697C7992618, 0x2F5EC6EE1D62A, 0x49284E00656BB, 0x6AE52507BA249, 0x01215A6B3E94D },
+    { 0x14203A97BD132, 0x1369B69F19B6D, 0x5E96CB9FF70C5, 0x25D24D5E5F6F7, 0x12052E9CFE255, 0x643E27DE48E75, 0x5930296CAE881, 0x7CD960230DCBC, 0x6CF41752B7626, 0x0109DC1B5714A } },
+  { { 0x7D446462D30FC, 0x6C929A5E0AEF2, 0x00B643C8F61A8, 0x57B0BC856FADE, 0x3D4F7CD1BE96A, 0x0BEB1974CF12E, 0x253A712184DFA, 0x58248BECF02FC, 0x066ED95F98019, 0x00D1D1CF0B73B },
+    { 0x16F3D5045AEEE, 0x4BA372F587A1D, 0x68782863283CB, 0x32D11C83ECE23, 0x4C834FDB7D379, 0x6F98C284BA030, 0x359298CB5C9E1, 0x2DE416172C986, 0x45C7BF590B36C, 0x00652015DCEDB },
+    { 0x359E39639966A, 0x2BA87292E433E, 0x1B729B97DAF54, 0x4A51A542AD6CE, 0x38DA73F2E469F, 0x02AFEBE8600E2, 0x7C1284AF06A90, 0x710EA1F235921, 0x71451617F167D, 0x0117823B99A52 },
+    { 0x6BFC10495A988, 0x5F43F47A07BBA, 0x4F605B57C34D5, 0x49576F301AF90, 0x260A90D058F5C, 0x6DE83249521D6, 0x78CB94768DC68, 0x06B02E3894BBA, 0x390E5FABFE599, 0x00BFB8745807D } },
+  { { 0x120D6FD32027C, 0x545912A0C5EF2, 0x3E5DBF63D83C4, 0x5CAF778BCB187, 0x13CFB850572B7, 0x2FB2B5D7B0B93, 0x1F01B503590E3, 0x21FC313282717, 0x1BACCF7792E16, 0x018329E8A9AD3 },
+    { 0x713561C127B15, 0x03CACB9E2F32A, 0x3CC5410CC723E, 0x4C8301B4603ED, 0x66411D84291B3, 0x3C27C293BAFC0, 0x36F60B9371169, 0x084F7BC9F7A1D, 0x3B0D02998ABBF, 0x0083A25D03611 },
+    { 0x47CD29225BB84, 0x44774C5F42C68, 0x21BB299C6DBA6, 0x79060CA3F8F23, 0x607CC009BAF1F, 0x113BFC919FF1B, 0x2D374B852A6D7, 0x539342CBBDD35, 0x03F3C596E32D5, 0x00E87377827C1 },
+    { 0x100C57A49373F, 0x2A2582297C78E, 0x7CE2AA5F3EDA6, 0x5F5DD4A9126B5, 0x15C4EDECCD30C, 0x22B2E250FEFBB, 0x6CABFFF6E11D0, 0x50FDA8140AA79, 0x5C399C17AB10B, 0x00BFD1D85B059 } },
+  { { 0x527E0E4CF006D, 0x141C253A43B29, 0x2D1B6AF4AAC26, 0x21365831824B4, 0x0A199A65CC929, 0x0742E2E554C67, 0x3A4686CBA59B0, 0x759A70C1DD6E6, 0x167F34B0A200F, 0x00FF319BEE628 },
+    { 0x41466DB40BAF7, 0x51C36D3B9298D, 0x4A60558B84F59, 0x3CA80E9119001, 0x471A197D85E12, 0x7F66D3B98F0EE, 0x14DC9D2804EEF, 0x29B650325B47A, 0x40663EA293933, 0x007194DC4A4CE },
+    { 0x61C7A50D022C7, 0x0C35EB2F05CA5, 0x1B1FC8C964EC3, 0x1E2190EDF9895, 0x47B2FD07B9C30, 0x4766C2A3AD9DB, 0x7A6F8D6E836C4, 0x6BD82C70B967D, 0x083854EC8F471, 0x017AD9DB2408B },
+    { 0x435D495B40D93, 0x2346FC8246509, 0x0AEBCA196309B, 0x7B7A3CAED80E6, 0x6D0AADD508CEF, 0x4E06CD0DF864F, 0x53A4073264970, 0x7DB31A8476D49, 0x41D8CD15A2D83, 0x00CA2CB26037C } },
+  { { 0x2B759D3235F5D, 0x4CC19B19709C1, 0x10F6FAFB47CE7, 0x605FEECCE8751, 0x25DA688112DF8, 0x350D9E8D61674, 0x31EC7D60B6660, 0x750E21EFE4AAD, 0x27C34D8542F7B, 0x0107E8B2582B4 },
+    { 0x29A2649E71003, 0x3741A97C27E8D, 0x47AD39022AF1D, 0x33E5A9BA43F03, 0x1B138FFB98147, 0x29A39FA61A43F, 0x07460983629B8, 0x65FF6BA6EB274, 0x3614398B24B0E, 0x00711A9CF9380 },
+    { 0x49E1EC9EBBB09, 0x1AD89555BD9F2, 0x64A5DFD431B30, 0x3A672AFD2C8E4, 0x55FCB2903CF0B, 0x6B6C59C342089, 0x2827E47810991, 0x5A0C7211D77C9, 0x2A1A24BBE5287, 0x00FCD292516E3 },
+    { 0x3C5BB351609D5, 0x391CE294BDBC5, 0x70D7257E518FF, 0x35030262864D3, 0x6E74E71431248, 0x666B9C78ECEAC, 0x3372174AFFCDE, 0x41453CE69F019, 0x5CCEF74B91C25, 0x013D3FF34A7F4 } },
+  { { 0x2BE24AEB885E9, 0x287AF3C50D69C, 0x6299BD7359B6B, 0x7BFB77516324F, 0x19490EF758DA1, 0x1B7B83915373D, 0x414EC955C3846, 0x31A584323DA24, 0x23D4EF50920BF, 0x00DD9E0BF617F },
+    { 0x634CF8CF550D4, 0x1524D7F834D15, 0x303FFE7FD00AA, 0x4E0A3C943D003, 0x0FD1A23B29CCD, 0x79F3331032D2E, 0x6EB3451F29470, 0x3924F45D32E16, 0x16B66B9C01C7E, 0x00951D48D44D5 },
+    { 0x05F957D028181, 0x3F60888D8E11C, 0x56479470A2E07, 0x0997242E0ABD0, 0x0E5295B762817, 0x62453B57DFC81, 0x423B20089E93F, 0x337BA84A6212C, 0x2C5996A3F646E, 0x013AA3F970FEC },
+    { 0x199B7D708C5DC, 0x238472FEC5AFE, 0x0F4F62E589D8F, 0x3BC83C274AB7D, 0x2CFD12D1AD56E, 0x7DD7DC4DAF4E2, 0x138290CB5E889, 0x569F7104BF8AD, 0x50E1568EF9E25, 0x0124960ED6502 } },
+  { { 0x4EDEF751FBD5D, 0x0180DE4EF432C, 0x058566A49AB0F, 0x201BE62BB3444, 0x4EEB54F9689F6, 0x359CCE0B44C2D, 0x74F2301567E8E, 0x372DDEC0C21A7, 0x6E14E6BE924B1, 0x0122C329E8805 },
+    { 0x1FCC60582A42D, 0x3E8F3C348B97F, 0x23D89D4DFEAED, 0x77EC5BE16515F, 0x636BAD33F3625, 0x10AC87EE32B1D, 0x7B5E6EF241C7B, 0x1184D0385D79F, 0x5B6F5B92C75F4, 0x00742A9FBBD98 },
+    { 0x536919B597803, 0x72D22A2451F28, 0x2006959BF21BB, 0x222F378122A90, 0x6BA7E66D4DE12, 0x03904D347A472, 0x7B6AF720BBAF1, 0x7426A8956678A, 0x7F63B4BE709C9, 0x019D33C6002B7 },
+    { 0x237B9D8BFBBEB, 0x2A62D02005915, 0x1BC55BDD6017C, 0x03E5A3E26A272, 0x171335E1A4D9C, 0x782F78DC570F6, 0x38F6509E4A49D, 0x1BC14366B925E, 0x2F6A3FD14B222, 0x00FF3BABB23E9 } },
+  { { 0x37E17F0AD6C0F, 0x6BD79E5CEDC59, 0x2EDE750E4F13F, 0x394C233CF861A, 0x2885E2A7726D7, 0x606CEBAE8B972, 0x221456FE2417A, 0x09981B1B6E886, 0x7F5FE7ABD42AC, 0x008EE3CFAB146 },
+    { 0x4835725033923, 0x00DF002550BCA, 0x67CB45CF473FA, 0x10F5A620988A8, 0x784162A0F51E4, 0x0B34EB7888452, 0x2566F7868B717, 0x1DDAFACAE84BC, 0x6B3E889387A96, 0x00DD584A46A8C },
+    { 0x03066754C84F7, 0x50B2776037FE7, 0x75798BF10D4CA, 0x18DA1EC56D629, 0x00C609543C25A, 0x28BFD572419B2, 0x68B9B1E0D7707, 0x351CD85E5EA54, 0x2F0A9A0C5E70B, 0x009A4F029F480 },
+    { 0x07AE120E1A82D, 0x4B2C5349777CD, 0x2DED49800CA15, 0x2ED6066D9D6E9, 0x64E74131501DB, 0x25FCE2E5E9272, 0x7030241248018, 0x28C7F7790A4D8, 0x19EF3196C6E2D, 0x010D90C7AEA12 } },
+  { { 0x59BD48C145649, 0x29A3AE42400CC, 0x03FF40E981434, 0x275F674D0CB0B, 0x293C2EFD78D4D, 0x0B56EA4DCA447, 0x501580A5D04EE, 0x624CE347FCFFF, 0x4C40CB203517C, 0x00922F1C68B01 },
+    { 0x1FE2B07B0A9CA, 0x089AB37230992, 0x4B617BED8AC3E, 0x5D67004039FEA, 0x5F8FABC4E7F6C, 0x6F21EBAB6723A, 0x3F36C99604ABA, 0x30C834A5F4772, 0x358D944159215, 0x00C44BC92FE5C },
+    { 0x73363483A39DD, 0x02828ED65AA88, 0x33D948AF7092C, 0x7C7F6D136F20B, 0x56E6252E8464A, 0x7DA21690E6AB5, 0x60E8BEB18EEF4, 0x156BB6FA51452, 0x726441B4FEFB8, 0x009DDFE454A6F },
+    { 0x47F88D1BFFD46, 0x146B5FC416632, 0x26914FF5DA6C3, 0x10659C1DBDAC0, 0x53013A036ABD7, 0x02780E9BA2C48, 0x0AAD7495F66B6, 0x7B76BF249E411, 0x4C1C46B01D3F5, 0x00E119BE7880A } },
+  { { 0x7D998EEE4C81A, 0x04B7BB10900D4, 0x5F50ECD0513CF, 0x383BD31DD3FF7, 0x14F54667FB70C, 0x3D6F6A4C8C645, 0x26DFF549769D4, 0x2EA3CC965FBE6, 0x629098E46A136, 0x013096652D337 },
+    { 0x02ED74FFE2C47, 0x2ABAB1D4813A9, 0x3A4F690E554E4, 0x58D93E738FCC4, 0x31CFC85687814, 0x5400493CCB7FC, 0x07713E9444B08, 0x2D37103CCEEF6, 0x16AFA2FB8BCFF, 0x00897CF0659EF },
+    { 0x4767A02C3289C, 0x12859517034FC, 0x5292E9E06A45F, 0x5D09B2C0EC9E3, 0x3B436FD867E76, 0x38316E6D4B0AD, 0x173B660AB9BC3, 0x423D3F4A23354, 0x4C204B3F64136, 0x013040EB76A71 },
+    { 0x222B5538AF047, 0x0C3C70DFF4BC0, 0x3CE36CACEAFF7, 0x3C1FAD47037DB, 0x5709277332FF4, 0x4BDF5857EE96A, 0x5C2A00C586B9E, 0x1C2471965FB17, 0x40E18A5666079, 0x0165A877622AF } },
+  { { 0x6C89F2D145538, 0x5B2CDB3976ED9, 0x43646A1739C3A, 0x4B3438ED1513D, 0x47192FC01D851, 0x4F527BD869038, 0x1BDED01F8A1AC, 0x14444752604BB, 0x7D8D7CF90FAFF, 0x00FF5B8B95543 },
+    { 0x517BD1AFCC339, 0x138ACA4AFB4F7, 0x51CEAC2718D3A, 0x40495139F6847, 0x063BDB5BB52F4, 0x4695C0B7F57E3, 0x627AE10459746, 0x57227F5F97D6F, 0x55EAB3B305E59, 0x008028AC3BC99 },
+    { 0x522031EF05166, 0x19EEE99BE8816, 0x381B5BB77F258, 0x40D2B63051364, 0x471A0F3CECA12, 0x5E5E1FD78147B, 0x7B773622664BA, 0x249E71E086849, 0x06EEFCF704F5D, 0x00AA682105DD4 },
+    { 0x6576E8A0165C3, 0x733DDDE8C77A6, 0x656B8343A341C, 0x10D383E623C39, 0x7343673AD87C5, 0x46D44CE6633C1, 0x797F0723A9B5B, 0x6C903F59A0148, 0x7289FAAC96FD5, 0x0113B022DC7D2 } },
+  { { 0x3807D5C5AC364, 0x03F9EE53FA530, 0x0FCBD57990209, 0x24F23D946D58D, 0x2010CB98AFDFF, 0x32CD738B552E5, 0x1717F8214C72C, 0x7EDBC4D06615B, 0x271612566B93B, 0x0035C26B23F76 },
+    { 0x5AA1561A9196D, 0x714869291DE04, 0x07192DD6CBA06, 0x15C997A6A9BE1, 0x4D344E666CA45, 0x79F1B562181EA, 0x3752CEFA45C79, 0x2AA97B1C168D1, 0x78CFA411666BA, 0x0080252D35F02 },
+    { 0x6537903A25272, 0x47B9FAD140888, 0x28133E82A8150, 0x455125C1119F0, 0x14AFFDE0CA3AF, 0x3C5F507DFFC86, 0x65EAE152D58DD, 0x165F203F8734E, 0x6B0C8EB7FAA89, 0x00EE163D3EA43 },
+    { 0x0F1D43E178E31, 0x2BB64D9896CBD, 0x68D7D75502529, 0x11B4440B13B07, 0x6BDF70951E957, 0x731ABE1A4ED70, 0x043C993F359D9, 0x27CC10D696F67, 0x2EF3651793641, 0x00B3DC38F146E } },
+  { { 0x39550270639C0, 0x19B0D705FC871, 0x0FF7440B93B9C, 0x0D60B66A0BC9F, 0x659FBD2A0B89E, 0x30814CEF06F4D, 0x3B45C901C858C, 0x16DB7F07385F0, 0x68DFDE8CCB678, 0x00C7D1D5404DB },
+    { 0x4D0C0AEB49244, 0x4C86068B72080, 0x4B38A4EC5620E, 0x391F23B1DC27F, 0x34714820E6B11, 0x17FD67B2DE007, 0x175AE204564DE, 0x04BA69D5A3FD7, 0x75113EB9F0379, 0x0066670C1CBCE },
+    { 0x14CE5F63AE3DC, 0x45EA1E8420C0B, 0x22BF833065967, 0x5F9F083A7B857, 0x2C8F70166C47D, 0x07DD419F143B4, 0x52A4D984A8073, 0x395DB7E256FB1, 0x0A5FA12C73EF8, 0x01AE15CF4D615 },
+    { 0x12AD510833D4C, 0x33B6660AF2015, 0x2042444C4745C, 0x40ED20AABB2E4, 0x323016ED54551, 0x4E082C5C4905A, 0x18065BD26CE12, 0x2A39366913E0E, 0x656A94C0EECCB, 0x015CB5342CA89 } },
+  { { 0x17235E406AEF4, 0x33B8A2B60BF84, 0x71CB48350D61D, 0x1A99E968E2B30, 0x1D14C1B7CA941, 0x1F0B7A5E70C2C, 0x39E0A0D5B92A8, 0x0FA85452D2585, 0x2DEE3520D27A3, 0x00C7730FF0AFA },
+    { 0x54EBC111389A3, 0x1D744BF186A67, 0x562A76C1C9E91, 0x0DEE2B41FDD55, 0x3680DA1911B89, 0x411740ADA07BF, 0x7EBADAEE93AB9, 0x33C8B3848D2F9, 0x6E0F65FAA7295, 0x00E3D92959193 },
+    { 0x5F679436F19D6, 0x7F25BBC9042A7, 0x6D939DC12F99D, 0x3BA900AC608CB, 0x423EB6E531358, 0x6B71AF03D3DB3, 0x6742274ADA913, 0x548B916DE4315, 0x0783B895BB0DF, 0x00EDC5C789AA5 },
+    { 0x08982D48E9C83, 0x1D7D1B60DD111, 0x376C1363D5A86, 0x4294037409AAD, 0x5E399996EC697, 0x3831ECE0BA985, 0x501335F5A18DA, 0x5FAEC6889D7C1, 0x3D457C516824F, 0x00E66F97A29FB } },
+  { { 0x35B93CBE3AFCB, 0x587705C0EB39F, 0x5C1A3274CB908, 0x1AE4F18679F08, 0x08DDDA03F1C6E, 0x11F578A532839, 0x29341A03173A2, 0x7B423CBCF0FFD, 0x66A1ED99BA6E8, 0x0181819010DF7 },
+    { 0x43AD4AA46BB3E, 0x705F7822C9AF3, 0x68C05D63BAF63, 0x750296234C519, 0x67B727A4FD41D, 0x7E431F9D4A047, 0x4C4CBAD0AD830, 0x3FB8B4060E21D, 0x185A8046A77DD, 0x00742D6BBBBC7 },
+    { 0x34711509AC437, 0x0682F26364BA5, 0x0A47249640198, 0x12A566CD8B673, 0x131AA808B110A, 0x16CC6113EC0A7, 0x6B1092B2FFA49, 0x2559F1B5A6E8A, 0x4FBFE8175EE56, 0x00A3C2369FC01 },
+    { 0x4A89976CE29D8, 0x18B596ED34B9B, 0x18FF7E21DA3CE, 0x48C6882951451, 0x1FF0841158268, 0x18D847045E236, 0x670444FFF4546, 0x0D5294F4A997D, 0x3D07DD211E4FF, 0x00905389F05B8 } },
+  { { 0x724A741A0172E, 0x1E997FED80C61, 0x558B684585AF4, 0x702CC7C71B3EC, 0x38F23A44C3E50, 0x20AC3BF62F9EE, 0x234E47041A7D1, 0x166CB6C0D9FC8, 0x7FF7E269DE38F, 0x00941D93169A0 },
+    { 0x750A6794A56A1, 0x436020DC214AB, 0x2BFF79DB9AB81, 0x47F8AA7C1AF09, 0x54CEAF13C3B82, 0x455037FB92112, 0x72160437A37D4, 0x6F2C768DE57E1, 0x5EF65BBBA64CF, 0x00BAC9103E2C5 },
+    { 0x59770DBD76DBE, 0x07BE3C66C9A89, 0x1197F7234A46D, 0x0754C69262883, 0x27C299E5BC096, 0x1FF1FEDEC3C9A, 0x1E29B596CDF0F, 0x785F2DC32EE40, 0x2D79A6C9D9507, 0x0168675C9500C },
+    { 0x5A2BF1D4CD131, 0x5A3C992ADA187, 0x2B2A289232703, 0x09FF1BA317116, 0x4D5DA23AD8721, 0x636C53609192F, 0x241511F3E9BBA, 0x65BDDEE37DF68, 0x751BAE5848EF1, 0x0148140DF8AE7 } },
+  { { 0x4DEF3F52CB6FE, 0x55C24720E1877, 0x7B729254BB4CB, 0x32550E55A9D87, 0x7049A5DD00918, 0x09587FFEE5AFD, 0x5AABFE12D1459, 0x5EC103E5940AD, 0x542C6DE60FD9C, 0x0064BFC965BAA },
+    { 0x3E9A2B23A6B40, 0x0D45B7FFDAE15, 0x59460BDD46464, 0x29CA02F6A83C7, 0x4E42260CE2FCC, 0x55F2659254691, 0x788999D07EE60, 0x72F4EE243E2B6, 0x146811279284E, 0x00A835D6FAF16 },
+    { 0x1AAD31400A2E2, 0x3146D86624A72, 0x14B65A18D73BC, 0x44C94E64C31F1, 0x44A69E1E8AB70, 0x1969F9FB91453, 0x39800DBDBEAFB, 0x1A74EEDF7DB12, 0x2AF7512947BB3, 0x00EDE30EECAB0 },
+    { 0x6819C04C652C4, 0x1921D66CD3ACA, 0x09EB123831D3E, 0x42E3D17AB4A77, 0x037C5EF849E86, 0x187B07AF13876, 0x1575E5410BDC2, 0x0B0F158DCAAEB, 0x6EAF9056F19B1, 0x013D8C2F8ABCC } },
+  { { 0x3E88C2109C66E, 0x3B873A8B93862, 0x3D31A13BE7901, 0x41355AD9D82CB, 0x03A8C8A265722, 0x4D48C959FD047, 0x09FA32141D5CF, 0x01FCCFD8C0DE1, 0x7EC49BDCA7FAD, 0x01E06EF51DE44 },
+    { 0x447A5AF5E3D90, 0x21BCDF69D7F76, 0x0167ECFD8FE23, 0x4C8335E832ED1, 0x07665F0C28E73, 0x1EEC9EFAB0498, 0x66EEDD255179C, 0x1C6BE22AC0F42, 0x6E18033233765, 0x00697FC751C0B },
+    { 0x2B2F544E1AAD0, 0x70E0ED1AAB25B, 0x0A7B3CE4596B9, 0x2EA558A2C5F97, 0x113155F9ECCA0, 0x5DF381E8BD3FC, 0x79F79342B2BDB, 0x21FCA79CD4AA2, 0x055997F23CE5F, 0x00EF4F7B63DFB },
+    { 0x4CFFFFDDD2272, 0x0EB84F5C1F62A, 0x6F76022511E70, 0x34867DA9AE1CD, 0x6F0107B1F125C, 0x7E7B802F19F0A, 0x1668EAC09F30F, 0x35C2217F2E7CB, 0x398A4397C5945, 0x010EB09B67476 } },
+  { { 0x1C986AEBBC537, 0x18572160A4717, 0x5DD8BBFDD38DC, 0x533E2FB4F33B8, 0x23267A0165D65, 0x153C2C74065F7, 0x0F44B4EF19EE0, 0x493777D182346, 0x64745E041440A, 0x017B878301A22 },
+    { 0x599EE1BD50740, 0x564BA58277313, 0x0008D750CD536, 0x1D87114954C21, 0x7270042E3931B, 0x15AA3ABEDAA9E, 0x0FA4696666B83, 0x18CA2ABBBF4B5, 0x142878674CBA9, 0x009B1E788D857 },
+    { 0x14CB9010F829B, 0x2A699FF5C04E1, 0x5559372AE4921, 0x54223A1D42BCA, 0x39E67A3448A05, 0x5E9B52B57A262, 0x2CC28EF6E36B3, 0x7A5E724EBC17D, 0x40CDE40F6F14F, 0x00CD289DD73A5 },
+    { 0x184F1AA1564D8, 0x76BF0D0665B3A, 0x4BA0424E09762, 0x16D346A67D031, 0x58AEED7E218B6, 0x6F23A02CFF3D8, 0x3DC90C63A6447, 0x67ECBCE83DFED, 0x329FD72CC8A64, 0x0101515E3E595 } },
+  { { 0x0F846725DE5E6, 0x751D2BC00176B, 0x553DF47E52A61, 0x0AFDE14A7D6E1, 0x62343F42683B1, 0x3546FDA0EBD9A, 0x124614DE9C3A6, 0x56E968647824C, 0x10D30DCF6A2B8, 0x016539DB3DF2F },
+    { 0x02FF4302B2F60, 0x515DD28FDD0D1, 0x721A9FB7FC344, 0x4C3D4B3D544CC, 0x19412546E583C, 0x681E5C2F1F522, 0x5C702274C99ED, 0x4108A37175494, 0x34DD91E59C52A, 0x0049B1FF5979B },
+    { 0x505EA9847CB08, 0x07C3987FBBFE1, 0x6AF32042124A6, 0x5E590154B5942, 0x54A2D9C7B3BAF, 0x66FCDC9CD7E4B, 0x00E865AC0731A, 0x577BD1BEF156E, 0x4B140A98A7C97, 0x012BFDAFE81EB },
+    { 0x76390CE9550BA, 0x00E2E73D4C9F9, 0x648133E8ED95B, 0x1B8746CA2736C, 0x7F4DE32F98BA3, 0x0B8CB960713B1, 0x0BE4AAFC32B1C, 0x05CAC5A372AA7, 0x4FC9F909B7FC8, 0x00BDBF362093C } },
+  { { 0x4A6887EDCBE25, 0x54D21CFAC8FD1, 0x337ED580EEE9A, 0x1918CF4848FAC, 0x3713E25F8EF3E, 0x0A571D93EFBB4, 0x720727185D111, 0x4099FE5D62C0B, 0x49A827CFD45EC, 0x0127307A19323 },
+    { 0x29EE806881DF2, 0x24B6C2CC7C741, 0x2C9B8016CEFA0, 0x7160BB2AC3C09, 0x61AED7C60E8DB, 0x75243642E333A, 0x2642852C1FC08, 0x1D65BBC60CA47, 0x5F8AA0F661FD0, 0x007E9F973EF15 },
+    { 0x1B8CC0CC86D8D, 0x69568D6967B5F, 0x59CE016ABDDD6, 0x47381775330AC, 0x58D7910312055, 0x21FFD71FF6AE5, 0x629E06860A1C4, 0x3815FCBF5F8DD, 0x3FD2124D84FD3, 0x00F92A1442048 },
+    { 0x3C8C0BE356982, 0x491EC169660F5, 0x030459B112755, 0x411B67C825676, 0x5B2FCF09F9423, 0x0E5C334F8D4AE, 0x3416AF30C577D, 0x0EA6EED6D45C9, 0x45B0516091B97, 0x01450CD829904 } },
+  { { 0x3D29FF929123A, 0x43BB63DA8F675, 0x16100DE5B1207, 0x68BCC9293AC67, 0x15C698EA01B90, 0x1849EE9EAB56D, 0x55249162936E9, 0x2BC5D3B199B84, 0x4E047DA92EBB2, 0x00DDBEAA4C3CA },
+    { 0x6B8B80ED13288, 0x2791CD7EF607A, 0x4AB8F4DED5A81, 0x54BBD7FB866ED, 0x7022C405BBEAD, 0x3369BEE00DA3D, 0x63429AA56343C, 0x7C876ED466B75, 0x6D32320F19F0D, 0x005C3FFB16B55 },
+    { 0x15AAEC8A7DB7A, 0x25D2EE458845F, 0x4DBDF05621184, 0x7722B5FF08318, 0x525AF0A6AE626, 0x4E91CC6D58AFE, 0x6F31A039CB2D6, 0x5D816A5069718, 0x1DB01AFE33FDA, 0x00D24EDCDA182 },
+    { 0x01F218AD4EF44, 0x4A6BEC45A8BC7, 0x0CA501D926F38, 0x021C6F0A71499, 0x1103A60331A93, 0x78A8FAFFFCA9C, 0x77ABAD3AA2BFF, 0x0BCBF233A385B, 0x59CA7C377F18C, 0x0102A3497CEF2 } },
+  { { 0x08BBE6C195FF0, 0x0ED292219CF67, 0x4E24DD0C503AF, 0x2888A9B399F73, 0x4EE79157CDF77, 0x2514DC14E047B, 0x307AEC23ABACA, 0x6331B579E619A, 0x5058FFB53921E, 0x013F48027FC17 },
+    { 0x716984255775C, 0x5CC6D978401CF, 0x5CA6E99FC2E0F, 0x4C0C8C5491E47, 0x274A704F6DDD0, 0x2A4B4680BD33E, 0x59AFEE58AA8E4, 0x415E11D937BF3, 0x205F346880E2F, 0x00905F0797C15 },
+    { 0x7145C5C39F72E, 0x583F7BFAE465D, 0x33B9C31B19B30, 0x6A3B49A405A19, 0x6AC80AFBBA12F, 0x7389E3A8A5211, 0x4F7EB33E3CC11, 0x4E6AAB41B3DE1, 0x56C0975B4C10B, 0x011996A330CE0 },
+    { 0x5F8739B52B45E, 0x3661F5D503C61, 0x65427652A83A1, 0x12552C7704600, 0x608855EBE47DB, 0x01E5FCF11BCFF, 0x5AE4FE9E5FC47, 0x55CC337A668CC, 0x18EA37E13BECC, 0x01563961D5E64 } },
+  { { 0x10A777EFDBF07, 0x3C1EFC83255B5, 0x1E619DA197B9A, 0x6B33F2C1CCC5D, 0x2E291C9189434, 0x2414CB467884E, 0x15C8CB3368D58, 0x2A2AE01AF41F8, 0x59D70AFF9E9A9, 0x01928ADB0EF38 },
+    { 0x623AE4D293ADE, 0x37371871ECA9E, 0x45DB1FF751103, 0x68FF5127720A0, 0x7F1D71D809829, 0x32BBB38E19EC5, 0x4AF46A9B81676, 0x7BF3E2E11FDCE, 0x45FF120F5EFD5, 0x00B8D8FEF355E },
+    { 0x5B333F8BAB229, 0x6881377458733, 0x5A87616AE666D, 0x0EFE8C37A7D80, 0x120BCB77AE368, 0x51F46AD4F0FE3, 0x54B0DB602A8FE, 0x7EFDFE136A19A, 0x7BD12CE9D628F, 0x0148A00B56F78 },
+    { 0x460F6094EC37E, 0x511D2A3C833CE, 0x47A9691C15EB8, 0x6E220905DA153, 0x4750142F20884, 0x145458308A723, 0x21BA7A56333E8, 0x6BC025A4D335B, 0x37DCF70E6011C, 0x01232467EBB1C } },
+  { { 0x3467859E873E5, 0x0571B104E099E, 0x3C8A9D504CC5D, 0x71AAED4655F80, 0x13A87C798503E, 0x6166E56821FE2, 0x618C2844D3A95, 0x6D8292686FBB4, 0x3252F29451809, 0x01ABA8A1AB02D },
+    { 0x30CE03F303172, 0x0393466B85999, 0x56DC70A1B110E, 0x18C76965421AB, 0x5ABEDBE81D408, 0x26CD4C3DD1516, 0x59F783B7209A9, 0x13D6D423F8B68, 0x16CD9F755C180, 0x0049DC02865B2 },
+    { 0x7AF959A952D55, 0x561870665133E, 0x018744969B80D, 0x0E3F5189E9344, 0x630FA464BF400, 0x57F075C846EB9, 0x472263FA3F70A, 0x0179E784C0DA8, 0x657F8B8BBA9A0, 0x011531F5CFDE8 },
+    { 0x4A939413CB850, 0x6A6E2D7F29158, 0x20882EF04FC99, 0x1BEC619426818, 0x395C2852CDCFD, 0x791ED757F9F2C, 0x28CE3BC1A00BE, 0x136C4326E17CD, 0x62724EDD600B1, 0x00DF48EB7952A } },
+  { { 0x4EA9A3B043FE9, 0x411D3A2DEFD31, 0x73A7D15E3FEE9, 0x01EADCA186724, 0x3DFB561C9003A, 0x277995EE07A1C, 0x17C102E471D9C, 0x2E072B6B162BC, 0x00F65DCE58764, 0x017750894E9BB },
+    { 0x1B9FB65B1F48F, 0x7ABB5C7E9A43E, 0x29C13EA23484E, 0x4718AB6F8538C, 0x1CE9A27125684, 0x4977702FB7C01, 0x268AFD8E99898, 0x5CEA53BD3ED50, 0x2D42A193B70E7, 0x004E250ABEB24 },
+    { 0x6C51B9136BB69, 0x1662106978101, 0x3F81CFE89B5AD, 0x79A28E6F5472B, 0x5ED328246CECB, 0x67194EA0D9D1A, 0x64626177D6B63, 0x3F5A03B544013, 0x07092FB32C064, 0x015D3AF4986C5 },
+    { 0x40D0656E339F9, 0x582BDA929BD73, 0x155BAD4FE1BF1, 0x41EF5E971F515, 0x30ECD1C039E77, 0x06CD1F710F4FD, 0x3B162DE5C639C, 0x05295E819FA39, 0x2520330B3846C, 0x00EB52149FCC2 } },
+  { { 0x2095C0CCF9894, 0x1A24A4A3897CB, 0x0CB295D014360, 0x4960B34B6429E, 0x46DBFBE79D9E0, 0x28340AB123ADD, 0x13EF62966AE6B, 0x526B7574A1E07, 0x70CE4178BD90C, 0x00F1461DC9897 },
+    { 0x7EBEF4E0068D5, 0x6FCBB2D903CD7, 0x5468B41186E59, 0x6A57D8FC42D4B, 0x00D52D267AF6F, 0x1F3CE7CB0567F, 0x5BCE4C9262937, 0x07896176F42C2, 0x1F3A1718082C5, 0x00AFCF45721B1 },
+    { 0x6A9CA1C57B170, 0x6A6CA127A3860, 0x5ECACFC72C016, 0x53F5E4D25E6CD, 0x0FACDACC28E87, 0x41CF4B471C0AE, 0x3EEEF4F9C5843, 0x4DFF931913F39, 0x52AEF7ABA03B7, 0x01EC875E85A42 },
+    { 0x013F2265F251D, 0x65388356ADE72, 0x42EBA08826EC2, 0x63CB69404A61D, 0x08EF5C4A19152, 0x5615C9698B202, 0x0D1B111F71EBB, 0x5CC67AC9D5300, 0x01E13B38EB5FE, 0x013C6AB767C03 } },
+  { { 0x7AEDDE202C553, 0x75A818D3295BC, 0x7BDAFBE733661, 0x150E8D4A179B3, 0x4A4117A14AF64, 0x4709AA58A181F, 0x46800C8B65954, 0x3B4F1A7BC3A73, 0x1DF42BFEAE2A5, 0x00B68EFCCBCC6 },
+    { 0x6CC1F267428B8, 0x1196CB43D199F, 0x2DF8FC961445B, 0x4409BD565D1B9, 0x7FF5D89B06632, 0x2CEE515C4B067, 0x73B0615C0945C, 0x31A9E92CC8667, 0x45BFED774F55F, 0x0073A5EF7DF28 },
+    { 0x089D0287F0AB5, 0x65D133AEE8DF5, 0x6754B04BB73B4, 0x404C57B8C9005, 0x415476AFE4E01, 0x7DA23603E3DD5, 0x4583E581BE17F, 0x5725641B8CD59, 0x7CBDFC3C26DA5, 0x00DB9B7FC02FF },
+    { 0x5D6E54CC40C84, 0x2D91AD39C6300, 0x1CE231E02405C, 0x68C6C7EBC4C74, 0x6809560FDEE3D, 0x7059BE7DF957B, 0x2D2FC8F7E80E9, 0x2A2760C317A8F, 0x24E25C1FAE3D5, 0x012EE0702249D } },
+  { { 0x2386B8D634D71, 0x4674B9D0C1435, 0x7CE906865B57E, 0x252D3A85ACDAE, 0x75FB4E81C1946, 0x73085ACEA059F, 0x4EAE090BB15B9, 0x28340EEA1F434, 0x77813A1F36377, 0x00E3F3856A466 },
+    { 0x6FCAEB600FF2D, 0x0D02280A1C460, 0x20D6EF05B1940, 0x4F30364185FEC, 0x48A03A77C6E0F, 0x4E30B158232EB, 0x1EB95D31DB35A, 0x123801A84A39C, 0x6B2174E501FA7, 0x006F155FD3E1F },
+    { 0x029743A92899B, 0x01727226AB4C5, 0x2712BC69E2444, 0x7E037AE0F6BF0, 0x7B99CF36CF351, 0x7B4CA0A663BC1, 0x53B860A47B12B, 0x45A84CB26AC6A, 0x4629E2E92F5BC, 0x003B27164BC27 },
+    { 0x0F9A216AA9FE3, 0x5FF259B01AAB2, 0x124AE1C328B01, 0x731DFA0E2BFCF, 0x0E867182FDC5F, 0x4FD4EEFB0228C, 0x5D987E3D708B9, 0x13A32B8A68286, 0x332B2F9DD82D5, 0x0159A329FE7C0 } },
+  { { 0x6289D090A0B31, 0x1220FFB813A35, 0x4E3A49A977502, 0x7A12ACFFEBA91, 0x28330C3222370, 0x4B8E9688513DA, 0x4C0706ED8EAAB, 0x11F760CC666AD, 0x75DBF5F0B727A, 0x00092BF365C44 },
+    { 0x07B63DAE22926, 0x6046C6A2E6D12, 0x63759CB4ADBA1, 0x1F0F95E6BEF6C, 0x15909B43A6A9B, 0x088F71D72A411, 0x61BA2F05DB3C6, 0x4DC9A3E4007C6, 0x73DC52113DD25, 0x009B1D0A25E0A },
+    { 0x2F1462229AAFF, 0x2ECD826E91BFD, 0x28BD043EEF96E, 0x124F4E6F66F55, 0x221486C6E594C, 0x36BD27376F0D5, 0x0BF69548C0522, 0x1537FA3C144D7, 0x4AA403AC6DDDF, 0x00FAF580C7BF0 },
+    { 0x0B52A7F90F57E, 0x5046A4B082CF0, 0x02474435CE3F5, 0x036F84B81DA6B, 0x253296B9DC461, 0x1E2B0C994B5AA, 0x5BCAB77276E79, 0x393267F43927F, 0x049FFDE77D036, 0x00B99C5AAFE23 } },
+  { { 0x2312756425ED0, 0x18BF14F73A8A3, 0x3B1D6F1CAC376, 0x0E83D94686033, 0x443B8DCEAE704, 0x1088D38569561, 0x4E1D55AA25A58, 0x77092B84F4EE2, 0x5229F1433D62E, 0x00DA5C7B33144 },
+    { 0x0640F4A8D2B35, 0x409200868C68F, 0x2FF53484615AB, 0x12B6AE7E26F6A, 0x3747C8039622F, 0x47723F0B15027, 0x488B75A0C1741, 0x297708F668C64, 0x13368D6C96502, 0x007F07FC9DCC1 },
+    { 0x62DCCD6C275A8, 0x2A2751AC62641, 0x671686B0A4FD1, 0x683F9D20DC4BB, 0x5A0B80756C95C, 0x3A58CCD5702F8, 0x467F70DF52305, 0x24A2AC8521E3E, 0x758BED10921D7, 0x00FDD54C355CB },
+    { 0x14D98E5B92CE5, 0x62B80501B8E90, 0x60EAE78B05F95, 0x575DFB30CFB56, 0x171A797F72B46, 0x5C4B08D7C47E4, 0x673DCD8C71EA3, 0x0909995388D3C, 0x55B34CB401501, 0x012E5AAE9981C } },
+  { { 0x15645A85B84E0, 0x7CAF351316478, 0x31BC48653BE82, 0x5925D53C3887B, 0x09A87CA4FE5D3, 0x74C6686F20D76, 0x7610F334FB42A, 0x6BBD566E063BA, 0x166A31A47C7BF, 0x011D0FD334C67 },
+    { 0x6CF2CB15AC6ED, 0x5F9CED5E9527D, 0x3EF326F73624B, 0x585D894E13DC9, 0x625E4577C80FC, 0x2D67E69355596, 0x04859D96FBA7E, 0x717832FD75B69, 0x3883BDFB413CC, 0x00870C0F9C589 },
+    { 0x645A46439296C, 0x2ED577857B5C4, 0x129A5B03D54BE, 0x6EE84628554A4, 0x43F5BE8BF33A9, 0x1F93BD44EB1AD, 0x542420509E598, 0x51637BEA95BB5, 0x24991840C27A4, 0x012C61A300B36 },
+    { 0x15B4FCD48040F, 0x53898716307DB, 0x2A225707D055E, 0x2932949FFD5F0, 0x7F2FC83DAE723, 0x54133410DC773, 0x2E42D29F63306, 0x4137E36F610E9, 0x7DF6FBBFCD485, 0x00F6A70231442 } },
+  { { 0x55E85AF3310B2, 0x71AD7818B6130, 0x2C8FBBDEA7098, 0x52C49846D1275, 0x4FE4D1B8A3F40, 0x3456F66142F02, 0x69E37B12C4434, 0x119273792C709, 0x0D00AF4EAC0CE, 0x013E5F8E45B0F },
+    { 0x7049ACE28FCCF, 0x5125FDD718963, 0x331FAD5A927AE, 0x00223BEA5E764, 0x7ECB43FD473B7, 0x490E9A3E62228, 0x08C69E7810320, 0x7428960C21B66, 0x2EAAFA3F3A805, 0x006CC933CDC1D },
+    { 0x0F00D2D22D57A, 0x39D5E29924625, 0x598CD9C6259C0, 0x39D72147E0D58, 0x1E1C30F487677, 0x7342C76928192, 0x4BFB1B5DDFEA9, 0x390F6ED346F3C, 0x473AAB906ED31, 0x01A81224B785D },
+    { 0x42CA1C3287915, 0x5212AFF0BDFDA, 0x046E32CB41A55, 0x2BA14F3BD3FBD, 0x09A931AE3E154, 0x2491FE5D47D14, 0x6BD6A56CBBA57, 0x70B97CF2C8925, 0x75CA66D2894C4, 0x010FBC9F5B46C } },
+  { { 0x6A8405AF1C267, 0x71BCBD093E078, 0x35F0F165C71AC, 0x35AC05EDD2891, 0x15C986F71D48B, 0x3E6861318FE64, 0x1218418CDE3B7, 0x0811F3C50917A, 0x04ECEF655CB42, 0x012C1178227D1 },
+    { 0x40E5FD00ACCCD, 0x15EE8A3960A88, 0x73E6EFF119147, 0x132F5F60612FC, 0x50F2D0D2A3C67, 0x60937B8DDEA61, 0x709AE378EFC6A, 0x330292D5DB009, 0x79B00FA292C1B, 0x00C2FE29C8FEE },
+    { 0x47776AFC129BB, 0x194DA9CAEA330, 0x6EB3ABF2C99DD, 0x749E8FA58C8E8, 0x69AF0D493188E, 0x1F5BFF6B30F9F, 0x34237CDD918CB, 0x35F4FA140B64E, 0x4F38F9C2447F7, 0x005BED105433D },
+    { 0x24384A4BEA015, 0x32058243A6198, 0x3357E4839FED9, 0x728A2ED48497A, 0x385543786F1E2, 0x1FCE21448A2C5, 0x100EC674B0B77, 0x11334A47BD05B, 0x4B6AF99931E7B, 0x01024CC0EDE73 } },
+  { { 0x624BBFB183098, 0x6A7CE0D47F7C4, 0x6242CA841F3B8, 0x0432999ABCC3E, 0x0C61615090518, 0x5A00FE41C6641, 0x7CE62EB667D60, 0x60723DAAE4A35, 0x57565BA03F953, 0x0114DA2B01B67 },
+    { 0x596D1F160CA52, 0x682D88B7568CC, 0x243AF829A33A5, 0x54667F195235D, 0x66262357722DC, 0x1C0BF422310F2, 0x3F2476D3A99DD, 0x12AEC317FA413, 0x58579842A0265, 0x008C5DF03095A },
+    { 0x2DFF25F7E88B2, 0x2DED053EE908A, 0x5570057FD8CF9, 0x42EF16963B5DA, 0x1AE46E91B3C70, 0x2AAE903C9C7C5, 0x406C927F0C074, 0x07C4DA4AD0AE3, 0x6EC87830AF62B, 0x009C1A8A81CEC },
+    { 0x28275343FC022, 0x610834C74A973, 0x17AAE2C46ACD3, 0x6AFCCDF9914B9, 0x32C18E3924070, 0x015FEE7F61722, 0x717D48391AD2C, 0x0041E8DBF1103, 0x498FBA71CE951, 0x00A2680C57A62 } },
+  { { 0x3D3746C19B59D, 0x775C97928CD32, 0x5988B87405265, 0x7D29660E8D722, 0x461DD3847CA2E, 0x47E818B255A4E, 0x23E2732F214A8, 0x3E0C9FE8540F4, 0x60DD8B6A9F175, 0x01D5119F7C1A6 },
+    { 0x03531D93336CE, 0x3C4396ABF7E3D, 0x4D20183E5CC4E, 0x23A67BA1CFEEE, 0x614675B42AAD5, 0x4A88E9054BEE1, 0x1F9950CA5A4EF, 0x2EB6604570BCD, 0x28B91308E4CFC, 0x0060E252881D5 },
+    { 0x4315F23D66417, 0x2068FFA7B308E, 0x0D3F6DD48E3A8, 0x7D0F6311F7962, 0x466B96D89C626, 0x03B427E4F040D, 0x1F4699AFD48CD, 0x53D7C82AF1E10, 0x1D4641EAEC67E, 0x012E0D3644E50 },
+    { 0x38D66A9E3851A, 0x0D655932F4B1B, 0x4CA212EBB9F7B, 0x60F8DEF1A10C8, 0x51F9F98678C0C, 0x65F7A523288E9, 0x795A539BD567C, 0x0A56C8468104F, 0x1F5A598EAAF35, 0x00C744875EC19 } },
+  { { 0x2DA91AF1A1D08, 0x6D001D22D1C2A, 0x2867FC93EAA98, 0x39A982A1E9B65, 0x3D8F21EED6701, 0x5FDBB8D7D84A7, 0x236A486E3C968, 0x258DBE847D498, 0x68EEB34D63B53, 0x0192E45B00DC4 },
+    { 0x2A5BCE98C3009, 0x5BD316477A320, 0x64F0E37E5FF71, 0x09426D7E75E0D, 0x3F07AE124C59A, 0x6587A27060779, 0x6E8804F209ED7, 0x3509FA8985668, 0x46F62E60507AC, 0x0064264929A87 },
+    { 0x0AD78CB9BB5BC, 0x5A31D99C958E2, 0x7BEB419EDC86E, 0x765620165E1ED, 0x1872661649943, 0x51C2E9B526825, 0x0947742C5F676, 0x28F0E4664E5AE, 0x289E628960AA8, 0x00B8A10F92354 },
+    { 0x09FE0374AEC59, 0x25CD0483BDA04, 0x0691BA0E99651, 0x37AC504C0E0B7, 0x30DFB31A79760, 0x17273CCE862B1, 0x00FF79B826E5A, 0x2E3888743D6D4, 0x10D340B6F6B9F, 0x00ADDC5B43357 } },
+  { { 0x55E20C750FCB5, 0x0BE65D093B096, 0x746014FA66CD9, 0x3A69476057A53, 0x0893F06CA067D, 0x265D9789004B0, 0x69169F1F6B2CF, 0x004725C3BB03E, 0x23D5E3C1FA7FF, 0x01938BF3A3968 },
+    { 0x0CD16E6ED9788, 0x1C2D1171BFF79, 0x208C7E89D7EFF, 0x24E933167BFA3, 0x142BC9C37BD76, 0x287979250092C, 0x2381942BA2E81, 0x3492E27ED132B, 0x4FB04FDB35B3C, 0x005E37C7CA862 },
+    { 0x6FEEE7C765ABB, 0x11F1B97AAA6AE, 0x22B65FD009C3E, 0x67C6B0E54F79D, 0x72435E80DAF5F, 0x341932C3B95CD, 0x1994A067D01DB, 0x607C9CED9D94C, 0x4899027B197A9, 0x00B73BA54B0FE },
+    { 0x5ACE327F141A6, 0x31F8206DE3EC1, 0x2D516CA8714CA, 0x26808EC95E9C6, 0x393C17591BE85, 0x1CA033ED4E9CE, 0x24CE61E8F0451, 0x084D5B713B273, 0x1AC2D296D30B1, 0x01125DB917C8C } },
+  { { 0x1E1BFA13EFC91, 0x5DE63F9625452, 0x4C8D16E72834C, 0x384C3142C8677, 0x312ED940C4889, 0x08A8417E6FF60, 0x5292775E33529, 0x4E7938E2EC7DA, 0x60F4A2A109E79, 0x00C549121F902 },
+    { 0x69163EB0A461A, 0x7313E71D29976, 0x57765A8660E13, 0x43BF15EC5D488, 0x54AF089804142, 0x743852BD532CA, 0x1E8C29DF406A5, 0x0CD172E8CA593, 0x6E53F43F65F7B, 0x005CBC608830C },
+    { 0x27552D21BD429, 0x141CAAA83D758, 0x3685F83682753, 0x02FE9DFD5F68C, 0x2B95F7682165C, 0x7297BF65B6F71, 0x29272CA25C6CA, 0x4ECC07A849E37, 0x6FFBCFBB3643E, 0x00871009C7601 },
+    { 0x64F7E50160D74, 0x142B74B55F1A2, 0x19BB35D76C4F4, 0x211A504BC77C8, 0x2A49317F6B34B, 0x338B92C1E0202, 0x4A1CDD44F15B4, 0x70B4588AEF57A, 0x3E15FB42B4B13, 0x0108E061C3BA4 } },
+  { { 0x4FF696EFCE115, 0x11D1554AA75A2, 0x557DE1A3F0FFA, 0x731A18576B6AF, 0x7493A53961722, 0x3663242434971, 0x1473E3A66662A, 0x0BC663E46F50D, 0x7021E05509D74, 0x01CE6A423355D },
+    { 0x6FF01D3015309, 0x32F5164521F16, 0x78B7040486F6E, 0x5249662050DA9, 0x2C29E710A73A5, 0x48C0DCEA39745, 0x3680BD3CBC5C6, 0x79E9E31B2B81E, 0x1350E3003678A, 0x00A3AB92A00E0 },
+    { 0x6684BE34FC6ED, 0x6263DEC17F27E, 0x04FC71EB303C1, 0x6371F00BF7B79, 0x2B8AC65B2B231, 0x10BB5F63D2BC5, 0x3B0687750A2AF, 0x2C8366736DEE7, 0x49468896296D9, 0x00E99A36894A6 },
+    { 0x41DC73F8957B1, 0x1CBCA0FE6813B, 0x7B34FF47BBF95, 0x609C6E1A27F05, 0x69BB99CF31CF5, 0x696909576D0CE, 0x28F841ABDE0F4, 0x520C15FE051DA, 0x678EF2A359BAC, 0x012011B5DF5B8 } },
+  { { 0x1A3EEB731273A, 0x38E2BF6823612, 0x5EFB018BBC26C, 0x1148F4A6A68C2, 0x4F887D00CD9BF, 0x118A03F1FE9D7, 0x5E35EF28784F4, 0x694DD087BAABD, 0x2D2E04CEA2029, 0x0105010C4885A },
+    { 0x6A10C8BAD80BA, 0x6656CEE738B26, 0x6891D22C97566, 0x2B927E221A4FF, 0x6C19BAD035CE6, 0x7461FC33955FD, 0x50E38146A1352, 0x4FD02BF53147F, 0x1F99924B4CD8B, 0x009D68942C992 },
+    { 0x3ED779FF79972, 0x5BE621DDDEFC6, 0x7136A5D381CE6, 0x026AE8B14939D, 0x7F0E2D3B8CD82, 0x49AF22BBEA199, 0x28A257D578F49, 0x5072E64F9A145, 0x6AE1C6CE34402, 0x00FF141BCE483 },
+    { 0x00F7F65F32F86, 0x4731D624094A9, 0x2ED624ACCA4A5, 0x3865556BE80D6, 0x5735C626A0625, 0x3EBDD86599A9B, 0x2FFF6AF44687B, 0x745AF4D3840DA, 0x673CEA43E454A, 0x00E81C67491B5 } },
+  { { 0x16A7140992676, 0x4671E9993B7C9, 0x1D42623924700, 0x0E2BF2DE42CBF, 0x59617AB2EA6B5, 0x54CE609342FE7, 0x59587D2D5B42E, 0x5D7697A295B30, 0x4A5EE43D2C8E9, 0x0138D99037EE4 },
+    { 0x065670C919374, 0x453865F36096B, 0x7AFCF60875E6B, 0x781A1A957F798, 0x69A82F84C137B, 0x2FECADB812B2C, 0x6BA689C9F9712, 0x69D8282ED0CA8, 0x4B819C7043492, 0x006319F6202CD },
+    { 0x4EBB4D6FB45FA, 0x4853E9897A0C0, 0x23B8F2D800DBB, 0x6ED23598959B6, 0x78B5BF95E9A08, 0x532399BCACF6D, 0x47B379F89A689, 0x4888EAD36D21C, 0x2490FFD437DFD, 0x019B9D63D2466 },
+    { 0x48C098D6792D0, 0x15A6ABD8F57CE, 0x598ACDBCE2A3F, 0x2E7D16A4E1EE4, 0x3F7A5C4ECF848, 0x76FE2D2C59702, 0x492F1880E789E, 0x37C1365051A8B, 0x53BAF27EC395F, 0x0113AF1845EBE } },
+  { { 0x7F189D1811B23, 0x25D75C346D35A, 0x336D015DF5E65, 0x3F89FF64172FB, 0x583C6C89AFE3F, 0x05258BB4670E1, 0x2C56855A47CA0, 0x3CA828596AC6D, 0x7C3B9D38E40DD, 0x017727452D014 },
+    { 0x6891D6D626D9C, 0x14FE29B47A498, 0x77C97DF2C7581, 0x2E1364B75DC16, 0x53BA67DCC3252, 0x4C8719DE2B1EA, 0x1D360DDB9A8CB, 0x1F6F4178A2F3B, 0x5CA51753578BA, 0x006AD9712EC12 },
+    { 0x198B1B3097C95, 0x51F5D8442743D, 0x6910478F37766, 0x3F17D2B640737, 0x5FE367C92ED0A, 0x27B8E785CDE92, 0x73D29E5E58463, 0x1515DAEDAF2ED, 0x35D641C60700A, 0x00D9CC63B19BC },
+    { 0x74639A9184048, 0x3F76AEA4C8322, 0x5990156132DEE, 0x07721A688B8EE, 0x5AEE5CDB4D22D, 0x3D4765148FF28, 0x32038CA800627, 0x5A05C4CDB5A8C, 0x2E895B35957FD, 0x010D3B34C08A7 } },
+  { { 0x6A2E8CBEDC7EA, 0x4637F5028AC4F, 0x4069D47B07806, 0x234F8D8C4D70E, 0x01CC5DF033E3D, 0x1EDD360922477, 0x5953270FABF96, 0x614B93982C127, 0x329FCA35A076C, 0x0130AE27745C3 },
+    { 0x0E06770FFF473, 0x3BA4E86DB0A21, 0x011AD9D43712E, 0x55F498672C657, 0x5416F6B03253F, 0x73E321373F1B7, 0x22432325DA163, 0x1CBFEC152CAFD, 0x780C3A4BA257E, 0x009788D45BE2B },
+    { 0x6168C0D5907EE, 0x7F6233E03F3C7, 0x573FBEB21593A, 0x6DA647DF81E47, 0x23B4A6439DE5B, 0x7555E1FB90151, 0x38E6FD22A7803, 0x2748428FB5D83, 0x3FB5B4A617AE4, 0x00435F58342D7 },
+    { 0x467412C09AA99, 0x28C44066D5E6D, 0x339A94D5456AE, 0x15DD61B5BC99C, 0x2E913AAE32D47, 0x187E5452CC116, 0x7547EA88ED945, 0x1BB810C6450A0, 0x71214E3043BF3, 0x00CC6412370F2 } },
+  { { 0x344C9DE508657, 0x562B5817C313F, 0x4FAA564AE7670, 0x5691E155B68C5, 0x1134499BB0A46, 0x3160ED5DDA67F, 0x5524086315F4B, 0x75B55CC200BCF, 0x2A9D661C8FE0D, 0x018C98C5454B2 },
+    { 0x0A15D5E97705E, 0x14F00C6C0CFE8, 0x1B44E7218D0A2, 0x74831B8CFEF01, 0x00D4E1B4961B4, 0x13812602F8AB4, 0x0947AF8B269BB, 0x0E2A0E6A09DE8, 0x6D72362C004E4, 0x006657143B5A2 },
+    { 0x5B7B3BA10BF33, 0x13B6D9F579F3E, 0x6BB6FDD97F7F7, 0x3D05E3A54674F, 0x16CEF8BF8C63B, 0x2F24390F43E2E, 0x14B7E80903431, 0x1C97BF752E087, 0x5E747F37E30AF, 0x00EE10B94E333 },
+    { 0x2F1EE7E8E4720, 0x7419BA69E7EAE, 0x1C412C639EC64, 0x04C10150A49AE, 0x5B14EEC393D83, 0x4BFD862220F13, 0x07106C8ADF4F9, 0x347904B4C9EBE, 0x345092A6BCDDE, 0x015BC4CB36FE3 } },
+  { { 0x5156192020A2B, 0x79BE80E164D71, 0x3523E12F0C632, 0x7524DAC5A1FED, 0x17D447D10CA54, 0x69E74ED8C3B51, 0x43421026C9AB2, 0x4826DB5A738C2, 0x601A20EB2EBFB, 0x012F6C2ACFA29 },
+    { 0x3BEE695D12798, 0x1C2FE54E5187C, 0x0A6B4156C81CC, 0x643267A59F123, 0x405F1F978EE22, 0x3E0BA39E21EB4, 0x78E50D580A9F9, 0x3A6C176A36677, 0x0B738C9322FBE, 0x00575BBBCD7C8 },
+    { 0x5FD120487DA81, 0x3B17081C3B81E, 0x50B3165A2242D, 0x798105CEFB861, 0x5384D379E429B, 0x58A1CEF8B82DE, 0x159BDCD6547CB, 0x1DA9F35CFB1D7, 0x646C98D385A38, 0x0055D02B61222 },
+    { 0x796E2BF040F46, 0x4DF2B15E2D9FE, 0x3655858958A70, 0x315DE818A9081, 0x42DF25407492B, 0x52D0392F12B40, 0x1CF8D9170E189, 0x2C57B92569CEE, 0x4010CDD382564, 0x00D100D3FC5A6 } },
+  { { 0x48EF3D9CE4161, 0x6C93F61AFA11C, 0x49171A88146E1, 0x02B160C63F3F9, 0x4329B80238049, 0x4967D7117958D, 0x4B96894D4E673, 0x346C8FDCDBF13, 0x18D65CD85FC10, 0x0126DE301FDA2 },
+    { 0x64479CED18EC5, 0x53B146AF097F1, 0x7526902C5CC53, 0x1CF9766D0C8B6, 0x4C8CAE2AEA7C0, 0x54F38B12D3E72, 0x3FA574F7F473B, 0x45A3BB2E20B96, 0x1D794918AB81B, 0x006130F5A28E2 },
+    { 0x3869499FCDBE7, 0x07A2295C41D4B, 0x1C4AC3BCA5E26, 0x21443D30BE15D, 0x070A352EF82AB, 0x6CBFCEF551755, 0x032C66C53DBF6, 0x0E5B999CDF9D5, 0x3564E6FB75718, 0x00F552E0A2842 },
+    { 0x5C7F097F24D33, 0x4F933CB9E2BC2, 0x66AE51BD83ADD, 0x3A950D64BF83B, 0x3CE99CB24BE84, 0x3DE0D4EFDBAF2, 0x649DC77ADC028, 0x2AEEBA80BDDD5, 0x359FD47448058, 0x00A2FD7A16BB7 } },
+  { { 0x3A727AD9C6466, 0x497E0F84ACDAB, 0x3A9787709F02D, 0x1B6733BD0898E, 0x34F56F63CB327, 0x225D370358A1C, 0x07CC7736B8854, 0x6E26B381B0767, 0x593DD2621B72C, 0x0151955057543 },
+    { 0x231EBA0EB76CE, 0x5885229C55C34, 0x0A2DBC951611B, 0x5C25AB8B84BD3, 0x5F14AA990E8DF, 0x246FE5C7BFF00, 0x4A2613AA515ED, 0x44AE36AAFE2B6, 0x3298E0E356981, 0x0081AB32A0CF7 },
+    { 0x5AB62496641E6, 0x015347F3D538D, 0x0D0A48E77FC68, 0x4CFE84328EA03, 0x3801C50A82C3F, 0x11CF64082FB2D, 0x7F2AC89A9F1D9, 0x67EB663C68B43, 0x4B2AAF7AE3521, 0x00D07E0B9D6F8 },
+    { 0x6ED1D5EAA0B0E, 0x7AAE8EAD1C87C, 0x70A9784B48C9E, 0x3E67F43BD7B5F, 0x5AD5BAED41CBA, 0x3FBCE19BD233D, 0x511215A25C7A5, 0x6483BF8A6B0E2, 0x318C46822FCB9, 0x01209C6B54E30 } },
+  { { 0x47CD35C892C18, 0x4266BAB7D4E24, 0x016D65061F91A, 0x2AC0A08C84B8C, 0x2A4716B3A21C8, 0x4D6D41F9C6EE8, 0x4D0A8FC8FAEE4, 0x619D97FA13C98, 0x1279F1202C15E, 0x0103CECFFABBC },
+    { 0x0139DF7D144A2, 0x55D0605A1CA31, 0x2BD39A76FA441, 0x6C534F9C2A910, 0x3B1AAEEF44033, 0x0976E1C7D9B3E, 0x15AC748D0E749, 0x5C7DAD9F84DAB, 0x17047ED2B9268, 0x000B85A11F272 },
+    { 0x4DAA5B70B2F6A, 0x1ADB6364E1C5C, 0x5B48B21F2867A, 0x3E2289BEEB29A, 0x5E8371ABFFFB3, 0x7D227FA1D4FE3, 0x6C014A7BEAF5F, 0x7707B3EA5AA4A, 0x54D55755DBDC7, 0x00B9BD236060E },
+    { 0x3786C15E7C22A, 0x16D3B466E4C15, 0x01E2F11CE4E72, 0x379B850DFB607, 0x26533307D4CFF, 0x32AD860B1E68C, 0x434702EFEF471, 0x79E8C1CD78099, 0x3B09E92CF1A74, 0x010905E8AA528 } },
+  { { 0x41F19596CF948, 0x516610F4F1293, 0x432291E713702, 0x0A27BDA68D427, 0x262B6DDC1D9CF, 0x1F350C4703E50, 0x2D86DEEA34E20, 0x22A306270B1BF, 0x31F3FD71E40C3, 0x015FE914ADBA6 },
+    { 0x5D14CD227EF57, 0x5EF4978A3934A, 0x0B84BB3797103, 0x16B6B64B84ECF, 0x4BAE9E880C34F, 0x391FC09008E60, 0x21E80F3766D0A, 0x789EC8C964203, 0x0ABF2CEBC38A9, 0x006484B023BC8 },
+    { 0x5363F795D8732, 0x7464016632D66, 0x5045D2B3F4F1C, 0x10625370CE6B3, 0x2F4859DE7EC7A, 0x7436CB93BA5A7, 0x5336291EA4A42, 0x5370C0859BE2E, 0x258FC66626FA0, 0x0126C4683FEBF },
+    { 0x3CD0139BCA103, 0x3FD817995E32B, 0x78923AC32A4F5, 0x36D4AC5E8597C, 0x2432396580920, 0x75E361E82B841, 0x1A6E04D1BC993, 0x60BC20C697473, 0x2E107E9FDE18E, 0x00BDFF6285891 } },
+  { { 0x2515B20E5722B, 0x59D0D29CD924D, 0x6BE86C77B1178, 0x17E7067D5341F, 0x6816EE9C83D18, 0x2328B9B86C0A9, 0x5CA0EC2577E39, 0x3190912F5E879, 0x4C93F14CC100E, 0x006D08C2B8FAC },
+    { 0x498732CE4DE22, 0x34AA9D079C98F, 0x09C00B9DF1217, 0x6F0FD14471B2F, 0x4C091FD4D4BB0, 0x780D99750B572, 0x62B0E0D0FBCDC, 0x121AD8A9AE621, 0x6544FECEEBBED, 0x00BFF21AECFF9 },
+    { 0x52E5ABB03C94B, 0x1482201B2B93A, 0x7E50580E6ECC9, 0x5F1DD81DEEB8B, 0x1ED5D2837BCE0, 0x2405E2EC2452A, 0x4A771A3966954, 0x74DCF546198AA, 0x1260C0CCE8FED, 0x00E173DFC5888 },
+    { 0x64411A46D3C84, 0x43B666CECB12E, 0x34BDD70BEF1CA, 0x7559D8F5488A2, 0x39C0512DE34ED, 0x5BD1CFEAF5A8E, 0x15D02CB89854B, 0x16FB7564EC8AF, 0x174EC213D7AA4, 0x00DF6D51DC654 } },
+  { { 0x182F173E3923D, 0x781145A251030, 0x7778FD82669C2, 0x6995EF4811EFD, 0x6164B19A8EC69, 0x7871E857391D1, 0x471C367A78759, 0x79A02BDDAB0C0, 0x34935CB040876, 0x00579847FECDD },
+    { 0x54E0D8BE2F46E, 0x1CED0E4DB7F83, 0x59B664AE5F2FE, 0x3BE362964BADF, 0x22A000FDD7657, 0x71529A5FC1442, 0x4D8EDE4E872A5, 0x2295ADA137A3C, 0x76D7A7B2D9BC5, 0x003F6E9B1D8DA },
+    { 0x005C92C8DE9A5, 0x2CD2E409690AE, 0x1036EE169BA62, 0x56B726D64DACA, 0x68E0008C22AEE, 0x6D4D77DE878BE, 0x382122B6C1DEE, 0x0EE88D358AF3C, 0x339E1B5442480, 0x00F81988EB63C },
+    { 0x38B0DEB9FFF86, 0x51B176653F7EB, 0x42E75410395AF, 0x424D697144BBC, 0x0688D76AB324A, 0x1CA82634DA4E8, 0x57D2DCAE2AA37, 0x71D250A441B0E, 0x48923363E769E, 0x012C29554F61F } },
+  { { 0x5CEF292FA60B3, 0x16407D66F0FEE, 0x3AAD238EC886F, 0x4384A4CB516B9, 0x0CA6A97BA76DF, 0x71689D66BB3D1, 0x5028BA827ACC4, 0x0C73D20B893DA, 0x2A43695C5B516, 0x0150E5FE5F779 },
+    { 0x4E936C833051F, 0x024C39822C428, 0x05AC6092CBC85, 0x59F801097EC5E, 0x2C1145301C971, 0x34F2E6BFB7911, 0x22D6F6559B95B, 0x3B8D6BCE7FAF3, 0x54EB9E1213A37, 0x00A741E408C5C },
+    { 0x22A656E465B0D, 0x2A52414BEB2B4, 0x681759CFF0416, 0x0DE94AAB96E58, 0x28649AB77CBBB, 0x1A7C5EFEBEA43, 0x3821F2EC238CF, 0x14AE0348F8E48, 0x5319FB2E5A734, 0x0122E09E19A10 },
+    { 0x47F3904418819, 0x38ECFB6B1B715, 0x158B6A25F64A2, 0x0D367BD420326, 0x24C73CAD7237D, 0x075143793C70F, 0x3C9BA60087CBE, 0x0ABA3E227439E, 0x529BA5DF850B9, 0x00D3AB75E459E } },
+  { { 0x2BEE1580537EF, 0x254CD196596AA, 0x43941B787421D, 0x71F7764EF1199, 0x7527A3D998166, 0x7CED6E3E671F8, 0x16CBD6DB5AABB, 0x56476FB917DA7, 0x6434BD9D51F27, 0x00E7BA6DA5F88 },
+    { 0x7B8394330CA6E, 0x5AD9A14ABEA9C, 0x1B891CCEB2440, 0x68A3518DE0C65, 0x1A1F34FA2A67E, 0x15BF621BB3933, 0x55C9A636A5F6A, 0x377668B058A96, 0x749BC3037EF9C, 0x0063DF55B7DB9 },
+    { 0x5B4DC9139C72D, 0x6FCE39CB82449, 0x772E52848084F, 0x61A7AF6E33232, 0x6E3AB95E774EB, 0x462C8302EB75E, 0x76AF1EC43CA02, 0x2460BC597BCAF, 0x4886261EB9C70, 0x01A4499FA32AC },
+    { 0x5F22169553A8A, 0x1E898705A234D, 0x28776E1B63DD1, 0x19A6B879299EF, 0x78FE4A423FB26, 0x7BD9B16D6624D, 0x589AB50CCCF36, 0x230DD180BFFA0, 0x01DCEC86550A2, 0x00B5ECD49A0D1 } },
+  { { 0x3AD536A0044CE, 0x2C13748F26F89, 0x7001BFB267474, 0x240B9B41C120F, 0x0F8CDAD620BA0, 0x5AFAB8AB84694, 0x0F9A5BB9526FE, 0x31C2295410941, 0x46008AF46C9F2, 0x0132D837E63D4 },
+    { 0x571D2B4F8DD31, 0x2145D01CF15D0, 0x74639A06E46B5, 0x012E128FCA243, 0x4A85AAFE41497, 0x579F24091968E, 0x7DFEFFE664812, 0x67F2AF8C64621, 0x6EB62566B24B7, 0x007A4A6645479 },
+    { 0x45A4314BFC02A, 0x16392D5B3F845, 0x7C86352105AE9, 0x3A2EFA8C96FA3, 0x26CB2C880CAF5, 0x266537E5716F9, 0x21381778FD2EE, 0x518A89CAAB23D, 0x3621854ABB9B8, 0x019D10EB0F1DA },
+    { 0x7808BC2DC106B, 0x7E9681EB26E32, 0x32238B94B970F, 0x2D0448FB90AF8, 0x16DFA19F13D38, 0x6FAA2AC2E6165, 0x303F45D489C9D, 0x1B1FDB2E93B29, 0x7F3732552BAFC, 0x0099F4C1599BD } },
+  { { 0x599CC61D6E1E9, 0x5487242D1FDE9, 0x2ED1839FDF167, 0x5F9D14D56A09B, 0x179C21D036C29, 0x0D26E374AD1EC, 0x05D30976008FD, 0x036CE87BC083B, 0x25DA5323BF92C, 0x0174B54A45D1D },
+    { 0x2B62345C2F082, 0x5A7AC296F9780, 0x08D80C1C3B501, 0x2D88CCE908D86, 0x38759D0293475, 0x05F3A1DBEABE3, 0x5C3E1D4332593, 0x71BAA9B43890D, 0x4ABF154E081E4, 0x008A8A026C3B7 },
+    { 0x2F669BEB9DBB5, 0x4CC0AA25198AA, 0x3E6EC3CB2CDE7, 0x15E2DFF091774, 0x729EA9F28CE59, 0x3E505AD287046, 0x503403A513139, 0x71CC7D06A4D14, 0x4B8A48EBE6D7E, 0x0090B7C432E59 },
+    { 0x4FBF32ACA58F6, 0x37EF34BFC83FF, 0x26FF80C56DFBE, 0x55DA7C8EB5054, 0x56D49A883A689, 0x3489FC825DEDF, 0x01072E7F6DF67, 0x28E5417D1ED22, 0x383BD0978227D, 0x00FE628E196F1 } },
+  { { 0x49D53456EBB5C, 0x35F03C5BCFDEB, 0x526E447E501E3, 0x5148D2D82C81C, 0x2BA54B928B79D, 0x6296F8340B351, 0x0A198E13350B9, 0x05B13D16C7FD8, 0x61385B2F4AF26, 0x00A5AACD3A448 },
+    { 0x0B1F4E478FAAC, 0x18E9A0823A5F2, 0x616E4DE507E98, 0x2EAF0E74E8D25, 0x3BA4C0C332A34, 0x0E3CE2602AA51, 0x48207114343DB, 0x1E1586EB9695A, 0x6F13FFFC87249, 0x0089017E1E0A9 },
+    { 0x2312B42D10ADE, 0x7786B5447070E, 0x051032511CD3A, 0x560FF8D16893E, 0x6C23AE864F08F, 0x306F2D77890DF, 0x4EC90872F49BB, 0x14BE67D175EB1, 0x75C0C09DFFA2F, 0x015A7B8BD95BD },
+    { 0x08C14A4470F8A, 0x0C20B4655EBC8, 0x2B40EF27257E9, 0x00E236A8C3796, 0x608D4BBE2E736, 0x0A4CA8C443F8F, 0x571B018758FE7, 0x6BB55803AA44F, 0x15ABC04C37514, 0x0114AF77BAF82 } },
+  { { 0x7623777CE5B83, 0x6C265162C0A6D, 0x660C1E2772F53, 0x7FBCCCB8028D5, 0x1B9DA7C8F6496, 0x541261BF03498, 0x6210AE8ABB2AD, 0x19848825B2826, 0x0ED78C0E87D16, 0x0073D0AE02BAD },
+    { 0x0B5EFAFB0F387, 0x57A77F877E42C, 0x0BEF3E0597111, 0x2E99A184B83E6, 0x71A61E74E5DB9, 0x6B5B9D6A9C54D, 0x7BE7D3134346C, 0x23A9909D95FD4, 0x0CEB586E89D26, 0x00D8A382B3ED5 },
+    { 0x67F4CB26EDBB5, 0x794ED9D253856, 0x1FE8D10027AB0, 0x70CDB297C811A, 0x789B40DF2F392, 0x35DA3EBB13E51, 0x3233FBE4294FC, 0x16BED51C6BA79, 0x23ECC9A086976, 0x0111F54EDC8E5 },
+    { 0x18DC8E7DF9D9B, 0x5380ACB09F2BF, 0x010042C974AAC, 0x3885C0A8FF0B7, 0x64118A319DF44, 0x4DE62347544AC, 0x08437EDB1D724, 0x1B41CD62AA27A, 0x5FD9DBD678615, 0x00DB1E735DF85 } },
+  { { 0x7300DA70A1EC2, 0x7764ED04AA902, 0x3D417C4752FED, 0x3A44CB68EB708, 0x3114754F8CA83, 0x0C172F2436C22, 0x4FCE61C3CBB12, 0x6A38E7B2AA453, 0x28CD00BA86272, 0x0123408924DA0 },
+    { 0x265FC9B25C310, 0x792915ED5B2A8, 0x05CE2469E38A4, 0x0EA26DEECC3FD, 0x10ABE3A65FAF1, 0x3B16CC1113472, 0x0AC2F07B1D999, 0x0EAB85DCC6330, 0x6517873A0DA96, 0x00CCD53A3CD43 },
+    { 0x47C718A4E32B0, 0x1FEA7292BE586, 0x53D08F0D33C6C, 0x3DF9D69FBA9B8, 0x36787CACE535D, 0x5066ACB800327, 0x040E61ED61F45, 0x40FC4A9158092, 0x5068155656414, 0x00E74486DFF5D },
+    { 0x33386220F9400, 0x5972E3B30A821, 0x1CE61678D339C, 0x5C626671B532D, 0x30A57E1F7464E, 0x64C6832D48AA2, 0x19E7C4E25F520, 0x497A344A118C8, 0x629C21B38F9F7, 0x011319915045A } },
+  { { 0x2A1D0742D4644, 0x15E8C02CB63DE, 0x093ABE0D42E95, 0x30CE3F4D9C889, 0x2E0A098A592B1, 0x5C2D4AD647420, 0x1B58A103EF26F, 0x62EB8C32B762E, 0x26DA32A483F3E, 0x003B10B5A301D },
+    { 0x40B69F24B198F, 0x1AE071F5871E2, 0x48E220BBAFD03, 0x1B9E674E41E2F, 0x3EB9C695654C0, 0x3C6BBC963A441, 0x2C01ACADE5845, 0x3C6BDF73AA843, 0x0E88F8E295653, 0x00ABF10878393 },
+    { 0x5DD22A586C454, 0x64A0A069B6C81, 0x25E5F30DC6109, 0x408A52E33F8F4, 0x7FF8FD4DB345B, 0x585C0FC7660C0, 0x7AB3024AF189D, 0x3FAA037AABD8A, 0x2DC3A70C41056, 0x0103EDE742243 },
+    { 0x1BF06B500962F, 0x369D53865A1A0, 0x2DBDDE37FFA46, 0x2E51E23FB41BC, 0x2C91EF85F9EF6, 0x429842C8419A4, 0x3D9F5BE2A027D, 0x5717B4CB85BD6, 0x705B0AAD64E2F, 0x00BF9BAC41E8B } },
+  { { 0x3BF6DACEBAA22, 0x55E53E46F188B, 0x657F561CA5DC0, 0x72F7F6ED54325, 0x4C3E521E98EFF, 0x294B4D21F9900, 0x5849970047F9A, 0x7C0922FC7FDC1, 0x036322831C4AB, 0x007BD25A9F1B5 },
+    { 0x10C3F403AFE98, 0x6EE338E840BAF, 0x2A12FD62A9B77, 0x7C52B4B5C7D60, 0x6AD99C22B37BB, 0x43CD758FEFDF0, 0x62E3CE15AF2B0, 0x4F99CCCED5AE1, 0x4E68B3B9A04C6, 0x008C8CAEBCA4A },
+    { 0x2E114E3A3C75E, 0x3506DCCE2A644, 0x757AD4D76B3F2, 0x566FD656F8A31, 0x59F9BFA9FDC9A, 0x25F97CB1CF6AD, 0x13AE1F9D3D17B, 0x14EC785E9028A, 0x22EEC9BDCE227, 0x00F9FCD02A702 },
+    { 0x2DD7F56CF0AEE, 0x2A7C54515925C, 0x684C4935C5C55, 0x2F2F6B9B74090, 0x4A4CB13978F7A, 0x0F5CF45BEC30E, 0x3C9F53B721070, 0x44CFD460D8785, 0x4F8B1889B4ECF, 0x014A98C7FDB3D } },
+  { { 0x3B391E8CDE275, 0x2F1BEC7EB65B6, 0x7B9E227F5CB47, 0x2955647C131CD, 0x29123DE253818, 0x64E5165DB1235, 0x1643A18C8209F, 0x7A9A9C301BC40, 0x60622D28DA60E, 0x01D9C49014A33 },
+    { 0x58BF81536AF63, 0x6E8F3D3B54CE0, 0x55DE3E629ADE6, 0x16240D6BE3003, 0x17172418E3109, 0x758F2D07ECF89, 0x66C2F3C7F89B3, 0x104BE0EFB67D4, 0x2B7B122E08342, 0x009558A44CD26 },
+    { 0x2EAA0D91058EB, 0x4F1529F11F4DE, 0x26E12EEDB16CE, 0x7571E73E471CD, 0x6C0F8493DC48C, 0x33DE0061A3FC5, 0x66CA5ED21E217, 0x4A182BA18AEB6, 0x252FD28FCE8CF, 0x010271BA66179 },
+    { 0x5E08ABDA64417, 0x2220F40D9FFC0, 0x16DF9A579B3D2, 0x04A611D55C8DC, 0x694B341731B83, 0x309D7624FAA1C, 0x5A72E2765A4B0, 0x25538BDF5ABA3, 0x2BFDDB6B89186, 0x0133A71A758DE } },
+  { { 0x7336F091D6FA4, 0x2456EC4061DE5, 0x2251A44CFB611, 0x62FB11C0E149A, 0x4EC4BCC9CB6E7, 0x258BACB3903A4, 0x2A693C66836DE, 0x68D24DB08A0B7, 0x5D11C55466AFE, 0x00A117F94B6A5 },
+    { 0x6910249221435, 0x2D7857EFFF8BD, 0x6D5DD53F8A139, 0x104730A5357B4, 0x0CE2279E7CB61, 0x611B34330D621, 0x3A1DC60AB97BB, 0x003DB43C8DB27, 0x305E3E3913DAD, 0x008058CCE5EE9 },
+    { 0x1DCCFC5408ABE, 0x607C4FF7F6679, 0x073AFDC6A9261, 0x7D0B56DB9BAF0, 0x589D243B475C2, 0x0D6264BE99048, 0x46B60EBA59926, 0x650100DB13973, 0x2904DDC66EF64, 0x007A198679B92 },
+    { 0x2E5BC592BF6C5, 0x65B1679B7FE13, 0x429DBC32763FA, 0x2867C3689337D, 0x4C012677B5A73, 0x6BD2ED9AF0B73, 0x30A7ABD28C0CA, 0x6657FDFDAF0FA, 0x58387679BCD5B, 0x00ABCBB6679B3 } },
+  { { 0x0D3879E2BA79B, 0x58FA1A07C2277, 0x282C23D1B702B, 0x06CCD905F30B9, 0x270C80C9C711B, 0x3EC455B962CC4, 0x4BC0148891BE9, 0x1C7586A315C4E, 0x07572DBC5E6C8, 0x002045A6979C0 },
+    { 0x50A29962E87F1, 0x4D20449570240, 0x2B18EC2E869CE, 0x5360A52589E23, 0x24FCFD7383C4B, 0x71DCD20346043, 0x729ADCF2BBF99, 0x0F310A7550B78, 0x76F2F4B85D2F4, 0x0025550C679F8 },
+    { 0x76527B626951D, 0x118904D7F6EA5, 0x3779F346553C0, 0x13E45FBD0AF7E, 0x3A6CA29AF7ECB, 0x452A8BC9EABAF, 0x3F23C90C65EAF, 0x0A0F60E6C50BB, 0x341B4C412CFBD, 0x00EDD30FAFBB5 },
+    { 0x15133F856B315, 0x79293509BB2FF, 0x5AD165E1B544C, 0x69A31B06B7F99, 0x6DB20C3E44861, 0x0A23E7E437F3C, 0x162FC0CA57CBF, 0x3E118C7967DE3, 0x327184BDE8BB3, 0x00F476B6BF31E } },
+  { { 0x56C00261EDCD2, 0x20EBAEB80876B, 0x35A595B184038, 0x054B805398D18, 0x35335F331C54B, 0x1BDF9EBEAF86C, 0x677167E252FFF, 0x3CF4C4D4270A7, 0x3129DC0A799C9, 0x005DFAB7A8522 },
+    { 0x753D2D98DF7AC, 0x7AA2920652DEC, 0x64E8371833008, 0x4618B82497613, 0x6A5251D2A3263, 0x7E787BD7B032E, 0x612E7D36F31F4, 0x2EC39B1837C10, 0x6B53548E06AE1, 0x00D80B81AFAE9 },
+    { 0x5ACFCD3B4ECD4, 0x3B3133428DCAA, 0x029D562282E17, 0x63A2DFE00199F, 0x09E96E824DC0D, 0x067B6A9BA1348, 0x029942437CD94, 0x64411CD768DDC, 0x752DED63F5DE1, 0x00A6A9548D093 },
+    { 0x2DD52B04A13B8, 0x08E9B3EE9D586, 0x053D06985D48C, 0x45B0DC03F60F9, 0x3FB509E7B0123, 0x31E9FAA1120AE, 0x493127F349EBF, 0x79C69AA126A6E, 0x6B3A0FDE24E00, 0x00E71E3197A1C } },
+  { { 0x3A2D735C5F3BE, 0x513D030B23EE0, 0x03C741A24B893, 0x01CB94F492EB0, 0x701DD146414E9, 0x71F04A4747BB1, 0x3F70B670DDB68, 0x3D89A817BF190, 0x695ADDC8470EC, 0x005694E612F68 },
+    { 0x2535B79168B80, 0x43C54FC7261DA, 0x0E43FC807192F, 0x5A2DBC18A0519, 0x6CDBEAA0412DE, 0x0C7363F5EBD7A, 0x59C8DA95457AD, 0x3848EE4ABE110, 0x202C0420939A8, 0x00A2C0EAD4A07 },
+    { 0x06CB29B3CB128, 0x3F19B95A294F0, 0x1AD6939D34764, 0x447C3721FBB51, 0x0C60FDC010BCF, 0x5F0D8460AE08E, 0x03660AAE1C964, 0x0C60B16DD42EE, 0x55BC103DA44C4, 0x00B69D40AE985 },
+    { 0x3086ADD66EA42, 0x4B831828D5127, 0x0F4B6A1E7C7DB, 0x21BA7AC4187C1, 0x5A6F921AD3A70, 0x1B7BE7D9887D6, 0x3507406C97BBB, 0x6AB07892D9D32, 0x20B8A223B1DDE, 0x00CFB938EF2FF } },
+  { { 0x6EC19E9F0F032, 0x239966D487515, 0x67BE41EE5BEF4, 0x403A7581176E9, 0x6C67B1AFE9708, 0x3830E40908237, 0x43D3FB90142C4, 0x7C16189DF7ADB, 0x0953E663A08D9, 0x018AFCB371E0C },
+    { 0x257A9E23A98E2, 0x7492ABD014983, 0x27C6E3F7CAB4E, 0x26A22F0BBF179, 0x7FC1636F2C19A, 0x022FBE397BEED, 0x0CF22948C3836, 0x5679D41369606, 0x72E3E45B82200, 0x00DD854F67D8F },
+    { 0x39AEC5EBB57CE, 0x6BC7C57810E13, 0x30C23E22E2D35, 0x57DFDA2D66D6A, 0x51D89E828686B, 0x3E78CDB1135F9, 0x6C7A923E5A4B1, 0x2CD2B50578BA9, 0x7F11DD19447A7, 0x00DC60B0C4152 },
+    { 0x0EF94EFD2173C, 0x02C007D741C72, 0x0E142EDF5009F, 0x20A45294698C7, 0x22B30F705D578, 0x570568A6AB416, 0x70281F85F1D82, 0x0EE9CD27F516A, 0x35DF3B4885BD1, 0x00EB348E153EA } },
+  { { 0x294A1033097D4, 0x0799758F91972, 0x3C05EB4696519, 0x1169045E9888D, 0x51AE4DADC3E87, 0x23F6F89C1A6D1, 0x2C6AF7995B1D6, 0x4FE37498A5661, 0x1A82FC60B9556, 0x01C024AE1EB0B },
+    { 0x5822623FFF0CD, 0x2413F981E3B5E, 0x284A79752327B, 0x0C4A71D529AB6, 0x7AE416B3B6945, 0x25F3EC38E105E, 0x17AB44B2B1745, 0x2E583EAD77A3F, 0x1DFE38B3D54DD, 0x002B733D5C59F },
+    { 0x16A42BAEB37E4, 0x2EB1888487ADF, 0x7584816C78F16, 0x567BD1351DEEC, 0x7ADED0AEF8E11, 0x6DE0A49A3CB37, 0x415302AFA2DBA, 0x4633AEBA1FE4C, 0x00172AF1B8665, 0x0125AB9653E23 },
+    { 0x02EA41CF6D9C1, 0x3FA0C5FC7C0F7, 0x1F300BA5BDC53, 0x29E46A46485ED, 0x1237DC8FAAF31, 0x34FB866DE07A2, 0x387879C947873, 0x7914674956AAF, 0x7B86CC6A37CC8, 0x00E78E7064E32 } },
+  { { 0x3C0FC02E1AA8F, 0x6E8CCCC0F7664, 0x2B3CD65A71E05, 0x38F363FD4D44A, 0x62359B613A0C5, 0x2217CF9ABA575, 0x695473DE6B351, 0x4F56741053F3B, 0x0138390B527F4, 0x014472A7D4249 },
+    { 0x3D7C23B1C9B4A, 0x51EF0FC100C88, 0x5703F8E37D319, 0x066C55A3FC357, 0x2D7CF541589BF, 0x5C5B4C04071B4, 0x4958672B0BEC7, 0x1BDD6A7CEB181, 0x67E64143B8855, 0x00D007F8548C5 },
+    { 0x3E97FE0A025A3, 0x11AE8B3C42F6F, 0x626C319835589, 0x687535AF67E7F, 0x45219ED45C56D, 0x10DB05BCF6FEB, 0x68100A01CB74D, 0x223A433FFBAA1, 0x2BD4EB27C574B, 0x0174260E41518 },
+    { 0x55CF60E4B7DCA, 0x1D44860A530BD, 0x5EA47843EAB10, 0x021181D11A138, 0x5C370DBFB3EDD, 0x16092A1238225, 0x4C49A4EE1558C, 0x35BAE2C4EA188, 0x0A09B10F20DC8, 0x011D38F3691CF } },
+  { { 0x53B2B564CB17B, 0x3D335A197DB58, 0x1531642E43343, 0x149D119A4EA9D, 0x4B9FC8BACCBFC, 0x353CF01101904, 0x7B6D5810E50A8, 0x79C9558BA8A23, 0x1EC52D3E22253, 0x010A98D37D28D },
+    { 0x17F4C96B1ACEE, 0x5931C0769EE59, 0x0DEE1AC92389D, 0x022A864778663, 0x058D6B8F9D603, 0x698F4B5699514, 0x2FA4C320BAB32, 0x22B41A461A8AB, 0x759BD086BC259, 0x0044A139264A7 },
+    { 0x6183F3E6B96BD, 0x13753F5F3CF27, 0x7B57D051124E2, 0x281E84BE1A10E, 0x48F0D8E381C4C, 0x61F5A41A5ED6E, 0x51D702B424ABE, 0x468C02D93885B, 0x21B8AF8EF8EEE, 0x014B9C34D7F27 },
+    { 0x5D5B43BE4B0E6, 0x71AE7B6A6EF9F, 0x16DE934AC5102, 0x344E9E0018F41, 0x7EA43F3ECCCC4, 0x3F1E9F346808A, 0x1D0E7DEB573D8, 0x48BD0B465DA5B, 0x2FD75529AE7CF, 0x0103806496CE7 } },
+  { { 0x46FD7F240536E, 0x0086252A61888, 0x0196A594A35C2, 0x733EAB9B64193, 0x5B46D88BFB085, 0x53D626E71F598, 0x1B95325074EE3, 0x139C633137B84, 0x75D3864F4E288, 0x00B09BE9137D4 },
+    { 0x5112EF01837DF, 0x3A368524E71C9, 0x79A62E4A92F53, 0x4932BAE68089D, 0x61A33ACB8DCA4, 0x025F735DD37B7, 0x5342FF8001D46, 0x782D9817B3300, 0x7A76A1B8FD705, 0x009FF83706E3E },
+    { 0x319315A7CBEDA, 0x35E3897C9DF58, 0x188EBC680EC23, 0x4C47CDC5D3C9A, 0x38EF408CCA555, 0x59CFD89919112, 0x06E99DF637627, 0x666E96D6A4812, 0x70A323332AF70, 0x011396CF83FD7 },
+    { 0x54B7805151433, 0x7877C84206BA2, 0x43DB5E98BE3B1, 0x520F74A23E664, 0x6F3A46DA146C2, 0x3F90D5CCAE1E9, 0x61A9D8FBC1954, 0x7497CB39E085E, 0x7B226474D1241, 0x015E9AFCA756D } },
+  { { 0x40DEFB6593A8E, 0x6C581F589A708, 0x63457E9AFBE72, 0x0296CC64E118C, 0x0460A8189A665, 0x5D6757292EE92, 0x51C0F412BE4A1, 0x6DE4880535AE5, 0x2D80C80A20BB9, 0x00EF7FB1BD2A2 },
+    { 0x4EF8507544A22, 0x624C9387889AE, 0x11607B75B2F90, 0x72029F969E8FE, 0x449C6E12A3D4A, 0x362F3613AA9A0, 0x5AF927BE7F135, 0x7BC65FF65E128, 0x02C7BD8A9CCDB, 0x007654DE68470 },
+    { 0x17639928F18BE, 0x4F3D0162DB8E2, 0x10533618F2479, 0x7CC0C65B1C787, 0x41D3B96B4436A, 0x2ADFFD49CE18A, 0x1BFA25B89DD03, 0x1D0192B6452FC, 0x247FEBAF8420C, 0x0039B6B9D9396 },
+    { 0x35BDA0EDDAEAA, 0x695769901FC96, 0x1707B7EDE1711, 0x3ECF2BED46806, 0x526AE5820049F, 0x25F08C31115C8, 0x5F440D4AB3658, 0x4BBDF5073B872, 0x70B4535BCB1ED, 0x00EF7923E9254 } },
+  { { 0x1E4E9A125198E, 0x7AE9518200870, 0x3033BE3F5B021, 0x1B5B179BBE936, 0x12DFB2A552B6B, 0x772D5B8799EA4, 0x561470A91DBE6, 0x5C1FE30209913, 0x777961ADB377D, 0x018F6E4E88B3A },
+    { 0x204D06E1A045A, 0x092DDE13401B8, 0x3B69A88805E73, 0x6FFCD011A0356, 0x414DAF43EBC72, 0x23AD22D369C5B, 0x07165941D63AB, 0x341F7605CEA99, 0x499636558DBD3, 0x002A96E15FE21 },
+    { 0x117D46A70F132, 0x5B689CA155E27, 0x4F0AA3077B340, 0x71A58981548D5, 0x22E145F81E7A8, 0x252DF3108DCBA, 0x2A5CF8470CDB8, 0x0D74E173E6E49, 0x419CE5F0683A2, 0x00F8F286647A7 },
+    { 0x4017F67E6FA78, 0x39ABED0517115, 0x3592600B8399D, 0x419FEA8E5C397, 0x3E773F8763419, 0x25C8AF86DDBD0, 0x05A299F6FD8DA, 0x33E28B15ED725, 0x5E935F44F0A4D, 0x010ADB0A81F0E } },
+  { { 0x3D49C27F0701D, 0x06DECA4909425, 0x757A093A29350, 0x23F4C0B043CBE, 0x051A0C02192B7, 0x26EDD25007BEE, 0x5C5C775BC7B22, 0x112BA801B79EC, 0x3E4FF0C8CF0B4, 0x00DF5B74678ED },
+    { 0x5F389790B4873, 0x11C0083997705, 0x44DEB5D98A43B, 0x50BBD14DA52DE, 0x50D3B5F33746C, 0x17D2D27B9C40B, 0x61FE3C587EAF6, 0x631DA7D59DDFC, 0x7CF7568B37F75, 0x003381EBF7301 },
+    { 0x2EAFABE76E587, 0x36CC9DD468286, 0x37E4808D4FFA3, 0x562C2988501C9, 0x107288C032D6B, 0x7A982C04F56BE, 0x590002EA15AAE, 0x06B4797FA0CA9, 0x49BA46433EBF6, 0x0090614115564 },
+    { 0x479E52C9F2A11, 0x1A55D15BC1FD5, 0x0994857680023, 0x1BE7341A818CF, 0x18332C590C280, 0x343B87D519FFE, 0x7A8220715F0C6, 0x5DEAFF4F290F3, 0x2B7E7DB5295DB, 0x00D52F87787E6 } },
+  { { 0x5A9CC9C98AF84, 0x48B38A7A87E2E, 0x35C73C73A7604, 0x31118015C6516, 0x767DB9559FE7E, 0x6FB75362D905C, 0x37BEC9594C43D, 0x75376747B7FF4, 0x336A196813399, 0x00BA8302FE797 },
+    { 0x0D5D4BDD4B5C8, 0x27594B40C5A7F, 0x1F311A3B1B492, 0x2486A1C9106F3, 0x37239AAF69497, 0x1F467D99854F9, 0x3A175DB37F163, 0x0077F220FFE91, 0x4A101344F4C33, 0x00B6F6D154294 },
+    { 0x1F771D00315F2, 0x12141C376EC11, 0x3AFCDFE32D867, 0x6BD577C81782E, 0x107C40EC2EDDC, 0x612AA4F683F9B, 0x35CD5BD9ECCEF, 0x4ABF69260A6B1, 0x4E4E45FE18440, 0x01A9012CA7A87 },
+    { 0x212A9305EA630, 0x1DB7F7FE70401, 0x1AFDEFF2CC1B1, 0x78AF986BE0EFA, 0x7D49CAF8274BC, 0x6C08273B7AABA, 0x09D1FC3C1CE1E, 0x21D62A5F27855, 0x1DE8493DCF5F6, 0x00F13F6D4E9A4 } },
+  { { 0x6E05846AFFD39, 0x0D66AB9F4F7F6, 0x4585D5C1944E5, 0x2E2B1301511C5, 0x4A5FD0D642E7D, 0x4D6BC1D1120EB, 0x18712442E5A9A, 0x16C36C0BB913A, 0x52CDE7913636F, 0x011B964400E61 },
+    { 0x5A0ABE9B76DA0, 0x17FA0D18E3B6F, 0x09CC893447810, 0x5535BA8C59DA6, 0x2B73A4127E000, 0x61B92B2B55A15, 0x709C2869E1B92, 0x58EBC63554614, 0x3641F65E697B1, 0x00513A74F6C02 },
+    { 0x1DAA0527F0441, 0x09D15ECAC9BBC, 0x4B1D006A7E516, 0x46906119F6EDB, 0x4A1C52FBA6D5D, 0x2E35C50CBBBD7, 0x49811C9A2406B, 0x2ECCFA7440AF3, 0x103E8D4308C0F, 0x0067305908F08 },
+    { 0x466C9F196EA82, 0x356DDB71CC3DC, 0x6A4759488846A, 0x3885871BC8C1B, 0x28AABF6A51F77, 0x3687A0399910D, 0x7415C0B79B388, 0x6BEAF60B7AE37, 0x39DF61A49A28A, 0x00B2D4D3FD991 } },
+  { { 0x5ED72AE61D0BC, 0x2B39B22C1C95D, 0x62B6C7D5C0700, 0x0E13B1EA959BF, 0x5352477669669, 0x3CC663F24E872, 0x24598D38248AC, 0x3E13FFECAFC76, 0x0A7908C91F5A6, 0x012E29C024D06 },
+    { 0x504F6B4D11CF4, 0x7984D05147BC0, 0x61E44BD712B7A, 0x77F4CD2DB8E0E, 0x03375CBD76EFC, 0x3481B47033C0E, 0x60BE5598BC788, 0x379D27499C3CA, 0x467DDA450F589, 0x00AF10DE07C86 },
+    { 0x59029E0980CC8, 0x2D31E89621AA8, 0x5143EB6F54953, 0x32CFC3EB04929, 0x09CEEC4B38206, 0x709166AD0AC76, 0x46FB0E14C660F, 0x07B0927A86EB6, 0x64796803C2B65, 0x00592C6100A74 },
+    { 0x62E9E841D752A, 0x2B02FAB96B512, 0x4EE8CA37156CF, 0x1F308010E762F, 0x591F10F78DA99, 0x5DF5B06F0BF41, 0x62620FA60F84D, 0x2EBDBD9170878, 0x71D35566EDD81, 0x013E10B287437 } },
+  { { 0x007C363E928FD, 0x30127735A3D1D, 0x399702FAAAB01, 0x14F445E6D7AF7, 0x5EC81B9BD5D85, 0x4E2FFFEC86B85, 0x3C28FE60CF106, 0x4435F1FD5B450, 0x7CB858A09EBBC, 0x0040362E3CC1E },
+    { 0x20FAA2748EFBF, 0x1926267747F78, 0x75319133551EF, 0x26EF317C2D45E, 0x313C91FDD64F8, 0x4D3BE5993222A, 0x12CE2ADDA86E3, 0x6023051E4CD06, 0x4EAD1B9EAE0F7, 0x0029BB7761BFD },
+    { 0x368B0978B1B81, 0x2CDAFFBEBDFA5, 0x04648607CA2F9, 0x3C0249D0C87C6, 0x2E3AFF737A5F6, 0x7F8BC580D6CFA, 0x0E696EEBFC459, 0x50FE8129BA2E6, 0x3AE7C02FA7C81, 0x00E1C8E8B2BD6 },
+    { 0x36356FC0B491F, 0x6E0865698CE90, 0x6D276BDC36369, 0x0C65956EFAF5C, 0x4B966448A0343, 0x2D65D0073C1D0, 0x7030155ACEEE9, 0x67AD3E4C45A24, 0x42710AD419D35, 0x010EB97A7B675 } },
+  { { 0x38C661EEA1440, 0x6F9C004294878, 0x2AAE81BD46724, 0x32ACCF4911510, 0x61ED97FD28A98, 0x4B9AB8E309A52, 0x6B1E06682D062, 0x37DE0E06099B1, 0x6D7032E405170, 0x00A26F0CE7797 },
+    { 0x64F27093A4280, 0x690ABDF9C3E60, 0x70EBA39AB03DD, 0x0E25E05EB8185, 0x6012C012EF65E, 0x73E7796331A17, 0x2F732987272E6, 0x78D499E5E20A8, 0x2C82AF49B50ED, 0x00BA68C3AC4F9 },
+    { 0x18E28E0E4E1F6, 0x1E971FE5F85B0, 0x0C4A4AA4531FB, 0x6B639321C0858, 0x6D980A6C9533F, 0x2879DE72C2C14, 0x27C36AECA47B4, 0x09583F41D07E7, 0x0B4371E21D764, 0x00A6B967C6034 },
+    { 0x6EC0BEA2ECDFC, 0x21E243F3E73B4, 0x60F1ECADF0B8D, 0x31D73D7D9389C, 0x48982AFD6C84A, 0x24423F1D0B6AC, 0x443F5D5194E38, 0x073D9DE62C5FE, 0x71CB7DDEE0064, 0x01416F99E3CBB } },
+  { { 0x35E33437BA079, 0x76DE7B4CAD927, 0x61D44304E4A18, 0x5B954EB842E9C, 0x508BE95A3E401, 0x7CB78A0915F70, 0x46F8C4F4B5EA7, 0x7CB270954A022, 0x0BF3AB3F278AA, 0x00D399DA991D5 },
+    { 0x4662B02FD624D, 0x4E447E4CCDCCC, 0x2A8EEBBFB0402, 0x4E653D716AF8D, 0x589E42669B9A1, 0x5E99AB29B7710, 0x7DC2DC60D05E1, 0x35A68C6E24D70, 0x4E3EA9AD4681C, 0x007A3C08365A1 },
+    { 0x094A7635FEB91, 0x72E866CAA8CC0, 0x5928182FCBBF6, 0x0828A60927227, 0x75E5AD54C0A43, 0x5AFBCD7022167, 0x359C22965988F, 0x6A9EC291EDCD3, 0x75BF2A9DAF29E, 0x00F982A533C29 },
+    { 0x0184CF08B9A7B, 0x54B085D2F3C91, 0x1AC2EF436301B, 0x4C1B23C762DF4, 0x4B7D768F20617, 0x727CC23AE3C97, 0x1B1080D35EBC9, 0x647D1886D2146, 0x5979DF27AA4C6, 0x012EAA305EC20 } },
+  { { 0x5814E2C36FE26, 0x2A1C6E582CC86, 0x5368D39F5E864, 0x6A222D24F8DAB, 0x08E5BB83870F0, 0x353B11CCCABB9, 0x4AB79656414E0, 0x0C063E95D5460, 0x01D1394EDB3DD, 0x012418F305E54 },
+    { 0x74933D779138E, 0x1EFA232CE14C4, 0x3730D39638C09, 0x334F0388325D4, 0x37E5ED7F69BA2, 0x297265195FD4F, 0x09CFE80DAA8A2, 0x31C8AFD036C91, 0x534050A7A4459, 0x00821C5DB3250 },
+    { 0x34E0713194F0A, 0x29741F69B54AF, 0x2FEADF436CB8A, 0x5AA6E186E77DD, 0x58D0D3F1A56D3, 0x73C858ECCC9D0, 0x06F58D1508354, 0x6900926EB77C1, 0x7DF7DB4751969, 0x0121B1D402F54 },
+    { 0x78D8F969F1DE6, 0x06FE9FB624ABC, 0x2E16F1835C303, 0x2A48C12B8EFAF, 0x59A5B152AAC44, 0x5DCEB836AC706, 0x022CF971A6589, 0x01458F7803E02, 0x2B17B955C0187, 0x01597E758B6C9 } },
+  { { 0x58953E52ABEF2, 0x038AE37B6DE1B, 0x1455E46C5DCA8, 0x24751F191B91E, 0x6D8CF338DB565, 0x1A447B84B30E2, 0x4524D10952E5F, 0x6EBBE42E885FA, 0x54FF4E2923C7F, 0x0122A3423A66F },
+    { 0x3FDDBB4FE7C35, 0x20EA28D55FA5E, 0x106884DAAF95F, 0x2B740959DFDE8, 0x424A95DF61538, 0x4D1801F7E5EC1, 0x32FE70E189E21, 0x199AFECB76E76, 0x0C3ED4C02E994, 0x00450AF6D4E02 },
+    { 0x6702AC3181DDC, 0x6D9791D1FAB69, 0x31904CE9F13BC, 0x37037114F2515, 0x338BD6E6A31C5, 0x19AED3CB49D5C, 0x3F1C0F5CC2488, 0x453F1DD3C2237, 0x4A2D5951A43F5, 0x011A45C1D1A5F },
+    { 0x63FABBAD5DC15, 0x5970AC4C4994C, 0x4BB7B7030ADDD, 0x0A13A37CAD5C3, 0x4159DCD65E609, 0x7F777B470AAEB, 0x6C27032C85A35, 0x6DB351CB8A224, 0x79CA28C626243, 0x00CC02CD333EC } },
+  { { 0x01EF3DF275C16, 0x3C2E6BF9DB4CF, 0x410C30AD02C86, 0x29CA0E913DC4B, 0x2881E9DC2CC82, 0x4CF24AC2D176F, 0x69E836E0D4413, 0x258536615BF53, 0x658FFED42A770, 0x00DF69E428530 },
+    { 0x54DC41EF9F8C0, 0x67DB286DBD4C8, 0x06B8636F7B53A, 0x7E4DDC8C7C5FD, 0x29A99B0D75FB7, 0x43ABA22EE2E73, 0x31B6FF205679A, 0x2F166E999FF78, 0x71D444BC81113, 0x0067553CB99CF },
+    { 0x4D4E0D87948A0, 0x655F29EE3494C, 0x175113F9723CB, 0x529F201AAA1E0, 0x6078511B360C8, 0x69065C8D52570, 0x11D9E3923D6D7, 0x79B17D68A72A4, 0x567D5EF7A0E81, 0x0108182B0EC58 },
+    { 0x6740A81697EA4, 0x052E9F4DDDEBE, 0x102BDEFD3646B, 0x4B192D37C4248, 0x37BB80B3C805B, 0x1AAB3CE370EB1, 0x148ABF685AEBD, 0x6B04DDD4D2942, 0x64223D77E333D, 0x012921C39C67F } },
+  { { 0x00B24354C1625, 0x6A1818EE3FBDE, 0x7193C9B423187, 0x0A8E1362AA565, 0x15E80945CACD1, 0x345554522D254, 0x46FCD23D4F8F7, 0x6762B365E4EB2, 0x59A58C5FEDC32, 0x006F9E8AC4301 },
+    { 0x052F8D280FC7B, 0x722F60BC1B5B8, 0x62F04E74F3C69, 0x2D3D62A7FB9F4, 0x0B0F60D9F9A55, 0x537C51276BDA6, 0x6D2BFA5BE10C7, 0x110650F0A516F, 0x17377B15BAEC0, 0x005496F95CDEB },
+    { 0x4FFBCC9A5BE2D, 0x6AF546788DFB4, 0x257EB32B031AF, 0x3F2902A9EFA55, 0x44915670B467D, 0x548EBCFAFE94F, 0x54375B9BBD674, 0x1E29489291992, 0x41DA80F8D14AE, 0x013667DC87A77 },
+    { 0x55001C8800433, 0x719253366DC46, 0x55E4AED3A4BB1, 0x51FFC691BB51D, 0x797A4C8C88D9C, 0x78BD1F8456D9F, 0x33B386D1E46B4, 0x192BA96416B2E, 0x5E59F409F1E41, 0x012C765AA268E } },
+  { { 0x137FA6C02DA7D, 0x71718A84A488B, 0x09F2D9FF615BC, 0x4B3D99412FB95, 0x111F938ADC586, 0x17C697B52C4DA, 0x57E5E4C09D8ED, 0x7BD68EAD7E1BD, 0x27CE531A36063, 0x013FA46316EDA },
+    { 0x5E6BA3F836CF0, 0x30B25C2D0AF52, 0x165872BDA74FA, 0x4FDEE0059CA3C, 0x5632721E35C6E, 0x5E06D4C087F60, 0x409A7A0FF815D, 0x6F2F31CAAAC5E, 0x69A9B15A930BE, 0x00858D435979E },
+    { 0x624A5B8DF4CCF, 0x08E74AD97CF83, 0x31B14BBF6FBA9, 0x2EE87173A3A80, 0x4622E3F47CD18, 0x2F4D5BA699648, 0x03EBDC085ADA5, 0x63E5C0BF63DCD, 0x00617F25E77F7, 0x00FC734C2BB9F },
+    { 0x0AADFCB33F478, 0x00B476BE8D2E6, 0x0EC43CC4E3F80, 0x3032A8F6A7BB3, 0x4CF40F10DD7BF, 0x314536F8441D7, 0x57C0158CE6989, 0x0402A1B18923D, 0x59D65FD12845C, 0x013B48286CBEC } },
+  { { 0x18F43A3D2B483, 0x3A927D5AF35D7, 0x4168FD422CC26, 0x0B8E89A570E5F, 0x422ED9402BF1C, 0x16D14AEF297BE, 0x24CD62F00B7F2, 0x679C2EAD59881, 0x7ECE6F0AC020D, 0x005D5EE351FF2 },
+    { 0x3F0300B416DC5, 0x6B16DEC554611, 0x232B8B85C6903, 0x19015C6983BFE, 0x4A4363E80829E, 0x4D2C60AC0C0D0, 0x4D694786BF674, 0x57139C1C63B59, 0x13C7A3B383715, 0x00F0AB4832609 },
+    { 0x3C804A858AF57, 0x4CB7440D5CB4E, 0x481C815678960, 0x538B67959563C, 0x086811DDE9F20, 0x578A86E5004EC, 0x490A959C5279B, 0x724704F1ED039, 0x6BCDA809BDB3F, 0x00BFD933EEDE1 },
+    { 0x475828DD808D7, 0x3C0ECC94753C2, 0x73DD24CC967C4, 0x5D3203161ED5C, 0x1B706E2C23394, 0x1C9EA496F87E2, 0x4C11F819905A5, 0x6E9941E5CCA57, 0x07634C79EFAFC, 0x0107E3BB8FAA1 } },
+  { { 0x1711DC4280FAC, 0x2BD7F886F29F3, 0x211139C56286F, 0x2F87AA82517DF, 0x46D068EE70AFF, 0x355E42A7BE55E, 0x6C0EECF033DFE, 0x6B4B0C3D5C45A, 0x297E5ECCAD46A, 0x00ECA99A13EA4 },
+    { 0x43E4688D998B2, 0x25AFEBE8FEE88, 0x19752B0575430, 0x2965D6E779C6E, 0x4A5AE8C4BBB34, 0x33CEAFF108D7F, 0x598C892838ACF, 0x2978EC9FA6D9F, 0x739A14065573C, 0x00660C05E5151 },
+    { 0x5CDF6F384ACAC, 0x2B5866D8EA653, 0x0E189C28AC8E6, 0x1B9A4AA5A07F5, 0x35086D6FA4AD8, 0x1FCA5B8D0E48D, 0x73660FF881BEA, 0x475CC6C8CB9DE, 0x541EA3330CAD9, 0x01938DF4BDC25 },
+    { 0x2BC4C7FE54F14, 0x2108C5F14C424, 0x3C973896C7292, 0x4FFD6B9F525A9, 0x0748AD93DE9C8, 0x0A5B4D17BEBF4, 0x772073CC81C25, 0x6ED2C9E7BD96B, 0x49C33014231FB, 0x0151918784D2E } },
+  { { 0x75B494C9535C5, 0x7ECE8D5C10FE7, 0x49763CC7942DE, 0x0C3DC423056D9, 0x0468B5AEEA19D, 0x21481537A795C, 0x2B7E189AF43AD, 0x02386F747C1FB, 0x278AC5AFDBB48, 0x011F33EFA7610 },
+    { 0x50E456488E6CE, 0x078CFA9A9B0BE, 0x75DF1613058CE, 0x77075D4A168A3, 0x146F610B2B669, 0x4980D1240EAC2, 0x7A6513A8DEC9E, 0x3B6B6F7454910, 0x0DF46BFD652E7, 0x00431461ACE58 },
+    { 0x7FCAE22C689AB, 0x18259B6DD23E5, 0x50545C110CA36, 0x29BF3AB8151AA, 0x617525DC9A040, 0x0E4610E23940D, 0x558702F40BC80, 0x26CAF3D9E5655, 0x53E01AE9D1632, 0x011A3A5C628BF },
+    { 0x0A0120CE9C3C0, 0x3362734D7D51A, 0x1F7E988599166, 0x667EAC6089310, 0x6F9A656840F70, 0x5C72D9BF2D7D8, 0x357C1CA87A6CC, 0x42957B5B930C7, 0x6039C5AE9F663, 0x00D949F4DC67B } },
+  { { 0x2BAE2B172BBCF, 0x444FF648449F6, 0x70ED80F099C0E, 0x6A68E39EB9EFF, 0x3468C9E2E7FCE, 0x02E1B325748DA, 0x2B40B7DD847DC, 0x2AB657F1AC39E, 0x3042A2BD096CD, 0x0148A4A5E2E9F },
+    { 0x72CB409F31E43, 0x616C223277102, 0x399E4D1CF4F21, 0x38ACD1468B03F, 0x2A19AC4D41D43, 0x69A1F146B65A3, 0x4473EAD6E0503, 0x508E828ACF2FC, 0x20B8077B20F56, 0x00C8050DA2BE5 },
+    { 0x785F7A80E3343, 0x69EB58073F541, 0x5367F4A923987, 0x05BA31200063A, 0x73C2664A7085A, 0x6D0FA737C3A97, 0x68D4341B76EA6, 0x376B7C800DC91, 0x217AE5DB86EA0, 0x00FD51AB2EB1E },
+    { 0x3A98287531879, 0x1B5BB9D0039E9, 0x5A3306069FF3D, 0x5BC5223A5C44A, 0x1E255546A8FBD, 0x287A522EF2781, 0x28BED73CAEAB6, 0x2A0C26A6AC3FE, 0x6C5780D1EC29A, 0x00EB13A74BCD7 } },
+  { { 0x714A0BBAF3C95, 0x659DD53444129, 0x287982E1551BF, 0x6FD19A5FC377A, 0x60B319CCE90F3, 0x143C4A9164457, 0x6FA5607E373A6, 0x48A46F2E600D3, 0x0CDAAD1FE5EEF, 0x012B093EA270A },
+    { 0x25234E7858890, 0x7FB3D91ADF98D, 0x1EE2C777DBB57, 0x0876617A30FD1, 0x4A5DF2F85487F, 0x1C78A2F32E19F, 0x6AAD2F651A606, 0x4E8A2867B3E2B, 0x611BD41E1D3DC, 0x008FFCDC9C2E6 },
+    { 0x1862DC4B397ED, 0x62054F0DEA9A9, 0x0B13640F4B97F, 0x2FEF786865FB1, 0x5ADFEEA6E0A78, 0x1E1395475B7C5, 0x25A7873A345F9, 0x5883167C920D5, 0x05B0CF8476458, 0x0056FC89AF19C },
+    { 0x30445F1359E68, 0x138A325D3DDBC, 0x477BF63DEBA81, 0x6DF2B9131417C, 0x36D40B0C66BBF, 0x2FCD71DB0C359, 0x2DBD643D96354, 0x1FF96FFC09AA9, 0x5E2911FF45976, 0x00A5DEEEB2609 } },
+  { { 0x12C7565124A47, 0x3E1F3BD794DE9, 0x6DB830576E76E, 0x1B98D80FD21F3, 0x68762CC963DF8, 0x042D2E6F9768C, 0x7EADD74F9CCF8, 0x17E6AE787D455, 0x3F874E49052EC, 0x0086A5A275A4B },
+    { 0x21CAD5150B459, 0x6837D372952FA, 0x2DFF0698B7FC4, 0x1AA5FE00218E2, 0x293CDE03B9C9B, 0x4997F8A6353DA, 0x23DF92E12D929, 0x3CDEC0ACBF5C8, 0x22891E30A1AAA, 0x00455E6C0A55E },
+    { 0x382DC62D97EB3, 0x7B0708B138E24, 0x16F43DFD0AA1D, 0x7AD9CBE5F81E2, 0x716829CBB2B98, 0x119F0E44973F7, 0x2290D05D6B419, 0x756AFEBED0E6F, 0x01C7C8FA6AE97, 0x0135AA6E2E785 },
+    { 0x2A292A5EAC70B, 0x2781E701C3C4E, 0x6A0819C50BD94, 0x465F2B4EE3C54, 0x2CD59236A5103, 0x18413247066F3, 0x784BE8C304F2D, 0x38B8B71E81FD5, 0x344BE381C5E56, 0x00BD3DE313C04 } },
+  { { 0x16A0D5A9345FA, 0x439E8F8EE9E51, 0x0F6972BA4C866, 0x7B927DF4B628D, 0x4E1977058BFAD, 0x1749282585CC0, 0x647263CCC986A, 0x4326F34D7D1AE, 0x3D64393C14E7B, 0x0125EF8097684 },
+    { 0x1A5A7F40659AE, 0x5ECF29D658566, 0x7AE9183F3BD67, 0x2F819603FC8FC, 0x6412CF693D83C, 0x1F16229C7C112, 0x1FF9B92B4F0EF, 0x22C32DB9E9FBE, 0x3263BD5DA5FD8, 0x00F9588D6A2FF },
+    { 0x061283B8B4214, 0x5C8FFC34C013F, 0x7806CB105D7B7, 0x317D6B726F58E, 0x5C68A1CA6CBD5, 0x58EA22A1018DD, 0x257837F56C477, 0x0987B7EB5FD3F, 0x459AC3870A718, 0x004C665D10692 },
+    { 0x033A58CD0C7BA, 0x0C2B8CA78F9F5, 0x557D2601771F3, 0x4CBAB91DC7D5D, 0x1FB4B41745BE4, 0x7E79FFA0D45F3, 0x62048A4A7B1D6, 0x181E5E1CD6F90, 0x1613DA3015F68, 0x00FC61C975E0A } },
+  { { 0x771106141B209, 0x493D7B5557A11, 0x2DE5ADC41260D, 0x788C91867E4DF, 0x51D7205765BE5, 0x639E82502B41D, 0x5614945D2632F, 0x4EBB8D0DE3635, 0x1401E0FA3A4DB, 0x00B26849EFE50 },
+    { 0x3F60D88B3F394, 0x5F33F215C5A0E, 0x12BC52C83F1AC, 0x6ED9D9251F9D8, 0x6A950A19E3061, 0x4721D4C112162, 0x7D893158AA849, 0x701ABBD0CD535, 0x5FFBF37E080BC, 0x00A9451B27EE6 },
+    { 0x7048783731415, 0x6799D59BB55A0, 0x40C8407BE716A, 0x7F3A8DF7801E1, 0x00CAC2B38FE61, 0x2998B3DB0D85C, 0x39A579C06FC68, 0x6A74F16EBEC15, 0x68FB27A47F22B, 0x008457584561B },
+    { 0x12B48EF424FD0, 0x6155DB12CE605, 0x37902C40CC7A0, 0x765B6E7162EBB, 0x2193B935ECA72, 0x1565BC6339F83, 0x2FA9AAF7F4A64, 0x017143CE97A8E, 0x1F57F1829ED32, 0x00B16E584BC3B } },
+  { { 0x44D880A949636, 0x1C47AF0231344, 0x273180C0A5303, 0x55207CBE91AD4, 0x6B5C750512B5E, 0x335CC7A7A331F, 0x7239CEF63A2D9, 0x6F8D8270AEE8E, 0x3A83043210F9A, 0x0079ECE96A99F },
+    { 0x0B6A62FB05314, 0x6A3F89D3CE677, 0x7726AEE9D6FF9, 0x22307C805B0BD, 0x53915656D9D28, 0x7A73F2F894E0E, 0x6A80F73A9D692, 0x1236A60B1B9C1, 0x05651A5DA41E5, 0x008B0AB5230EA },
+    { 0x418991BBA23C4, 0x74234E61F9D17, 0x05512F37FE145, 0x5BFF589E9BA50, 0x7485970E144A6, 0x0C491BCB0347B, 0x70D68AFCEBA94, 0x3DC43579143B1, 0x7E347816162BD, 0x00DF94DACBCCA },
+    { 0x47F640079F1BA, 0x485F91F71EF2A, 0x3EE4F1F9F17B4, 0x5C15679112240, 0x534E091AC865D, 0x1D5152CAAF1C6, 0x0C4802407EB4E, 0x719C554742349, 0x68099BD4C1247, 0x00B40C98375E3 } },
+  { { 0x684AFA6AD299D, 0x1F33DF9D39330, 0x33175ACD493D0, 0x2A8B8FFECA2FC, 0x05D8F3D4E02C3, 0x217EB38DCA673, 0x2D67FCADE0D83, 0x228FB844EDE57, 0x4421F1E51CB2E, 0x0185AD5B0715C },
+    { 0x407B053910BF3, 0x453C4063E281B, 0x7B68E7A406D9E, 0x78358EF8EF915, 0x1856463AA5034, 0x358F5556A4777, 0x14B88369CBAE7, 0x382D5F00CAF01, 0x286828F9AB8BB, 0x009A4D98B4E23 },
+    { 0x74021EB77166F, 0x32062ADB1FCD8, 0x76A7510E8DFF3, 0x6CDBE2B8EDAC2, 0x1F2800F7B0F1C, 0x7238546C0D343, 0x0FBB14ED45D93, 0x08F378364F7AA, 0x6345128103E1A, 0x011F949CC2E2A },
+    { 0x1274C736C0E99, 0x173F19EAA7192, 0x0B6BDAFA68B69, 0x1172D1A96E4C1, 0x6F77D02EA0C51, 0x10782B015D668, 0x3E83F18434E4D, 0x30DA93A35DE10, 0x199DB044334D5, 0x011B3B5DCCE46 } },
+  { { 0x5F670300BD891, 0x294CE664A92FE, 0x37FD7D629005B, 0x5B0C0A3B5E9E2, 0x3A5022C46C950, 0x1208A026D4494, 0x6DAE30E024978, 0x4960D0DEB44A6, 0x127CE44E7BD45, 0x00C56BEF81AC8 },
+    { 0x2D9AFB3E3189E, 0x74D888989A805, 0x785F68E52F405, 0x1503AF12C9478, 0x2F753AA20FED4, 0x51917423B377A, 0x6884F83DD14FA, 0x701A4AC27AB91, 0x426DDC3FF900F, 0x008BA9A2B4FC4 },
+    { 0x74667B022EE49, 0x601364D7875B4, 0x24F5B72B74502, 0x385BEB2784BC4, 0x42106A6C14334, 0x25F3DAE5D1E14, 0x759BD9E7C6773, 0x321EE791651BC, 0x33A721E98AD72, 0x00FB28748FC7E },
+    { 0x2C7B4EEA72050, 0x72D4F3A875192, 0x44A642B3852D6, 0x6FFF6F2EA95AB, 0x7DD5878D94EB2, 0x04DC33B375318, 0x417573C88FC73, 0x4417087ED9BAF, 0x5B795104CC218, 0x01422075389F3 } },
+  { { 0x39896B1F3EEEA, 0x276AA10AC2D9A, 0x080B2AE275467, 0x38367B1841263, 0x04982D97C9057, 0x6E9850A39E136, 0x46C23F86EC6CF, 0x46172228ED45B, 0x2FD8EB2B9D7FB, 0x01674863076F7 },
+    { 0x09B0FAEB42D21, 0x5821F4215480A, 0x508C0D0ED3C0F, 0x0343016E08ED4, 0x38AF4371E0C1F, 0x5664A49CA4C66, 0x587160379DDDE, 0x49C7591DE4B2D, 0x563B9C01DC2E4, 0x006A48F742824 },
+    { 0x169FDCBBF5FCA, 0x0A1086BE77A69, 0x5965E08E903EF, 0x30580FAD6C8F7, 0x0F0050F599DD9, 0x5F5962E13284C, 0x7372FCA6F9F0D, 0x2F974B67A084A, 0x4A37FB7AF5684, 0x00754765E4B36 },
+    { 0x0ECF0F75E64BF, 0x2D4EC8890D217, 0x231809A5924BB, 0x7102DFD94AD5E, 0x2AD46D88CC6E4, 0x08D9DEA759BF0, 0x248FAD6560536, 0x6034C811BAAE2, 0x31BA2EEA40111, 0x0098EEA34A22F } },
+  { { 0x24D8340A1EA3B, 0x12D822473CA7D, 0x4F4B934C08491, 0x0C76B134AEB55, 0x5912E009D9F77, 0x0B9B667F525E7, 0x552744D0FD2F6, 0x54A76F4C0485D, 0x20B5AA497A767, 0x00D526DC82E1E },
+    { 0x5D7AE254A2E5E, 0x7B9D2CB786CEE, 0x79705BBC8DADE, 0x1E5F96F21F5A3, 0x3750FB504C51D, 0x030485B6F90E7, 0x33BC4B35FDBCC, 0x63D5DCB3A231A, 0x0CAA8522D8129, 0x007FA054719B9 },
+    { 0x6DDD1FAC6BD2D, 0x2DB81F5369564, 0x296E9F050835A, 0x5798B5D20A4B6, 0x7FB5FF30623DF, 0x4238707A4C0D9, 0x7A1AECF01E609, 0x14B2882A5689B, 0x5E7EAF3907D30, 0x005B3899BEA5B },
+    { 0x7BE0E1C6E4A32, 0x1E765CA527A97, 0x6ABA8CE946D60, 0x617C73E08CB0C, 0x590410CB9FE32, 0x47B2DFBF7B2DB, 0x1AE8D4C1E9E05, 0x68608C64F0A3D, 0x3AAC69FEDFB9C, 0x00F368D0A0AEA } },
+  { { 0x336E5F4409468, 0x0B023AD5932A9, 0x652D0558CB261, 0x2773BA57EA30F, 0x4EA30A69F4539, 0x50505FAC47C4C, 0x636DE7B9E4BF8, 0x512CB0DFE2C22, 0x12F56973D8C19, 0x01C6D1AC3F233 },
+    { 0x01A70CAF4E2B3, 0x0BE2C7448B505, 0x7D551AA85273B, 0x1A82401D9C409, 0x2F65D207279AC, 0x7E3AEF289645C, 0x7D5113D5FBE4D, 0x46A4C1A47CF75, 0x61C915C3A7E3E, 0x003FE0135AA51 },
+    { 0x5B6E1D59E70B4, 0x45B29F270FF16, 0x0A6AA2E64DB6C, 0x072876F4DD65B, 0x32C6152A686FC, 0x4C52700AD41DE, 0x06951B78BF116, 0x6D7232A58D069, 0x6192B230BBE5F, 0x010F4E2DC1E0E },
+    { 0x770620223948F, 0x74D7E2B089232, 0x181DDE6AB9304, 0x6342AA9D6A3AC, 0x1DC6E6918E010, 0x37F125303FC78, 0x2688F8A95800E, 0x07678A20D8957, 0x5FA45586C0416, 0x0104C155069A2 } },
+  { { 0x60E5D77FD500F, 0x63A2C0A6EE043, 0x2CD704B83C799, 0x3BEFDFB064885, 0x2D3B07CC2539D, 0x7B7C5079E4606, 0x2FCAFB6780830, 0x2A2496C9F311D, 0x29597B811A4B1, 0x00B402AB1D885 },
+    { 0x582999D530FA8, 0x2B5A46E72D272, 0x42CE4B8AB5C96, 0x28FC3F44D9D47, 0x0FDB851CBEB3C, 0x01B6196B67690, 0x0AF183F125AFB, 0x47127C98EAEFD, 0x6E02A98AE9C46, 0x00D87F0D84A5B },
+    { 0x645025165E45F, 0x27DC49637FE1E, 0x16B0E8B2EA04D, 0x30F0C87E90A95, 0x6DD16929C6F8F, 0x390B77585CF55, 0x7D65A41E91D74, 0x65B4911F2482D, 0x5FDF0DED97F44, 0x0074B8316BA48 },
+    { 0x7D8D090ECC18C, 0x634C56462270A, 0x40475E5349C32, 0x06F291B8B0B67, 0x71320786416D0, 0x26ABAABEFE96E, 0x7E8426F5C5441, 0x177D631218913, 0x13D200B92B1A0, 0x0111FBCBA78C0 } },
+  { { 0x24ACDD0DD8773, 0x4343265CC9C32, 0x13D5F88E546A7, 0x081FF34BE79EE, 0x40A5E23230E9B, 0x0FC04EB131AAD, 0x6B9D9AD0C8C75, 0x1DF7FCB01CC77, 0x1D45D036F66C7, 0x01B64427E97C4 },
+    { 0x4D2F435155C33, 0x3E8E1D33E49E0, 0x2B7ADA70994EC, 0x66386AB8BE53F, 0x7599E41917A5D, 0x009AFF668A9FE, 0x750CC88CE641F, 0x3230C81245C4F, 0x76829211DB965, 0x00A19889DEE5F },
+    { 0x41B64EBA3DF07, 0x536CDC43FFB42, 0x6CC9C32862067, 0x7AD5282C33FCE, 0x7914E0BA681B3, 0x7242DF31CA699, 0x7250E77A76F2C, 0x7BEDC20821170, 0x2B6AB1ACA321B, 0x01278D2836184 },
+    { 0x0B6DAFC76E25F, 0x499413F6C712F, 0x676EB5C2E18E3, 0x6DA6CABFC0923, 0x44133B3AA05BB, 0x3F1E209463B79, 0x6A72BB129FBC0, 0x5BDBB767176DF, 0x765FA5928A04E, 0x01483E4C7861B } },
+  { { 0x10998B4FA42B0, 0x4BF2A0518C97F, 0x220757396A33B, 0x7371259E61F07, 0x0DD2079B59215, 0x24A7AFD6AA720, 0x4CC353416BECD, 0x6E9B8DF772C24, 0x22930F95DB6C8, 0x0109C39B0B8A5 },
+    { 0x18F8750A7F0C8, 0x63F99F314862A, 0x4CF76ED58B9AE, 0x7B27F33F9B335, 0x447523AA2C2D5, 0x48525FFD326E5, 0x471A993EC32EA, 0x0E97C41043DF0, 0x5D26151CBD6D3, 0x00934569F347B },
+    { 0x02B1F3A39AC38, 0x6AF1C0A16773E, 0x339CEEDAA440B, 0x49D3DC3410C6E, 0x16FFE39A8F174, 0x56E7B0576698E, 0x66D78537D756A, 0x31622F12F54AA, 0x2789718665F14, 0x00E649F534384 },
+    { 0x48F671A886B92, 0x521D496247293, 0x57676E168B92C, 0x20D4201871228, 0x68F3553E06F23, 0x220709A5F575F, 0x5ADDA4151C39D, 0x29946006A2486, 0x3A6CAF9960464, 0x015399804148B } },
+  { { 0x39CF021CC55D4, 0x043457C28A60A, 0x04420A6DBD91F, 0x0275D52C91EEC, 0x2FCACF8E56C9E, 0x668ACF3AB32DD, 0x65E0C265C7CEF, 0x55AA7D8D9AE7E, 0x459198704781C, 0x00C1319B856A3 },
+    { 0x75F0986756AB6, 0x150C8D25BC505, 0x2D6C2618B06DF, 0x61EA6DF4C3C5E, 0x4B430BA37A224, 0x705B069DA24C2, 0x08972DA50B346, 0x603CF7C2767C9, 0x78E7FB105211E, 0x00BBC91DF32D6 },
+    { 0x3A7B31513CEE6, 0x2B12B03215B60, 0x3C53A3EAB5D83, 0x6386A7FE2B8D6, 0x728AD90F73A34, 0x74D3E8E2DA465, 0x745173F6297A2, 0x2111D34EFE44B, 0x1C5284162FCAB, 0x0125ECF3E6D59 },
+    { 0x41AAC0A91D518, 0x263BB81FDCDCD, 0x4B1674DFB8C36, 0x403F4C5387A94, 0x5715907CBC204, 0x224165D632E42, 0x3C80F40886E76, 0x1204445AC609B, 0x15B254DDF3A9D, 0x00EF1294E4D19 } },
+  { { 0x4BCE39078684F, 0x7B3B99D77961A, 0x72DB2FF18C6F5, 0x153CE8EB129C2, 0x4AA10B42AEA62, 0x7392961F80FCA, 0x3135DF7E8EEE4, 0x6EF1C5F57BAB0, 0x1E38261C7C245, 0x014A9870BA1B9 },
+    { 0x2403A543EA6A2, 0x26D18F113CFAA, 0x029D55738EC0A, 0x4B27FC8461F28, 0x71BEC42D6AE7C, 0x5F39D3567402B, 0x0922CE22ED5C9, 0x423BE618CA144, 0x7CC0BD9270C9F, 0x006CE26A25FDE },
+    { 0x2A66A0D448EAF, 0x3C58B9EC5F58E, 0x1E916D9A06725, 0x1DD3E02A61DB3, 0x370F20A78FC70, 0x562C596617DAC, 0x7354A8CEF1711, 0x51B83C4588B59, 0x688CDD8BF86B0, 0x00B3433F0434D },
+    { 0x0A95C5D1CDD8E, 0x33DA29C5B0A8B, 0x409888522D324, 0x46FED99A68FC8, 0x795B84A0535E6, 0x5BAA6207483D3, 0x7704EADCB74FF, 0x759E7698C3B13, 0x702185189F272, 0x013DD5D1FA973 } },
+  { { 0x4EF77329A3E21, 0x07E3F14BCE8B9, 0x0DC6C585FE22D, 0x71CCAD55C12D6, 0x343DE9BA7CA84, 0x323C29D858CB5, 0x19F644A451561, 0x07665E74D16C0, 0x7062BD70D34D5, 0x00E48284FB3F8 },
+    { 0x5BC228A745CD4, 0x0915F37662624, 0x4E46F4A22F8CE, 0x1BB96E8E333F0, 0x75014A3B4B9A1, 0x5B6AD0670C526, 0x241D1009BEFB6, 0x66A6CF686DAFB, 0x30487F43F7271, 0x00DC6FF160526 },
+    { 0x6785B3241E773, 0x0B2DFB1D46A5C, 0x2AEAF7F66DC5E, 0x705D01A24FFD5, 0x7BC74FABEF418, 0x44AE0CCE4C816, 0x5206E5B7CEA09, 0x3D48B9C2AC760, 0x57E00235595DC, 0x01A2066EB4B5F },
+    { 0x5130106217956, 0x4C006B8A61FBD, 0x488C08FB5EFEF, 0x70CFF18BFBFC5, 0x055FA314CD4D6, 0x1E5BD384F8629, 0x26522CBB4BA7C, 0x67D82C4D23C4F, 0x156FC3879161F, 0x010B54533A46D } },
+  { { 0x2360AA23772D9, 0x2FD23B2BA0D7D, 0x0F4DAD8441949, 0x38DDD585976E9, 0x19F29CBD2C6F1, 0x55F2A80921680, 0x134B1A0776098, 0x4861B4F161665, 0x34E0854B4B1BF, 0x016782C9358C5 },
+    { 0x2018BFFF776A5, 0x2FC0D763FA0BF, 0x59DEC34792AF7, 0x17BC2E377418C, 0x647DABE76DA72, 0x6C59D44DE713E, 0x5086C565DDEB6, 0x65A77CE354134, 0x71AF3773C7F07, 0x0035D00098AA9 },
+    { 0x51EC4EA02BD4F, 0x16A5A24F38145, 0x26D97EF544E86, 0x718E3E09096F2, 0x79150BF4804DC, 0x170FC22E85B49, 0x2ED5F88993839, 0x582F44FEB2E9F, 0x4C396F46B1ED7, 0x00FF7E61C67B5 },
+    { 0x3D442E5B7ED9B, 0x5D4176198890D, 0x66AE263E591C3, 0x3179579F46C1E, 0x5A7C75F45E8BA, 0x7B26C9E0DB2B4, 0x5D236773DB5D8, 0x23FAB3170EA89, 0x4FF0CB29779FD, 0x0116B4253041B } },
+  { { 0x5C3E05F94C582, 0x6D000BBAAFAD5, 0x1D99BBBC0A557, 0x27A28CF3E5C6E, 0x5EA8E4CB776B0, 0x7E06F522D82EE, 0x55E7568788435, 0x05BAC25136CE7, 0x1EA953790B63A, 0x00564F15167B3 },
+    { 0x6381D9531F7FD, 0x368E65A5D04ED, 0x03DCD43D39FC0, 0x1CA1FC32682B6, 0x02DD09B99471C, 0x120BD59AE8183, 0x3E6561C64CE61, 0x4BFB3B86E2423, 0x6C72227BFD1AD, 0x001C42A580072 },
+    { 0x0FAD84F31FACC, 0x4C1F25EB0D745, 0x4412BD8FA3E7D, 0x71698D6FDCC96, 0x6ED4C35F09886, 0x745F62CEE75AE, 0x79D1D1E33A4F8, 0x1DF06AF25040E, 0x6FB39E47E270D, 0x00F937A6FC978 },
+    { 0x2882F1DB92CDD, 0x78105F7EC0153, 0x34B546436E9D6, 0x47EB35B9F583A, 0x6676DB9E8EC12, 0x1B4D74516CFE1, 0x6639295E0B42D, 0x74EA36F1559D3, 0x3DDCC5A4E4BBE, 0x0111965D05ADC } },
+  { { 0x5EAB3FA21230F, 0x2D423D8F131F6, 0x7041850A7C27E, 0x45C5C756F118A, 0x226674B76037D, 0x0F1CD3CB8BD9F, 0x202EB9D63BF5C, 0x24B4672DD4F77, 0x280D9CD02DAC1, 0x019C413892342 },
+    { 0x6477A49BB8CE2, 0x4C18AA7645114, 0x6A24F99FA0156, 0x4A1C2073091F0, 0x33F673AFE4E4E, 0x2C6A74E13E00E, 0x1286A8EBA932B, 0x255E89B2DABC2, 0x44AB88F715504, 0x0088C56E9464C },
+    { 0x0E4CDAF69CBBF, 0x39A9475601B18, 0x69D6F52CE3EB3, 0x16B931597D81C, 0x1AC37D5CD1476, 0x2EFE681E566E7, 0x03BEAB414C8C2, 0x3C259533FDEB9, 0x2D7592437B5FE, 0x014AFE3945FB9 },
+    { 0x3F409D6AD33A8, 0x7DAECC41B1174, 0x6C5844CE6AABF, 0x564E493F95F4B, 0x2879FFFF433D3, 0x4102D26708A0A, 0x13BE11D81C877, 0x1F3921EFB90D2, 0x370DAC5B270F1, 0x00DBFE0E25F91 } },
+  { { 0x1AA88F2B7ABA3, 0x5BA978A6554D8, 0x7560B5227FD4B, 0x039E515A4D4DA, 0x14D5C83031B96, 0x420C219C7DAC0, 0x376FBFC5D9F42, 0x40BACCD30D1A0, 0x71E5872FAD260, 0x01C5DC8F98D73 },
+    { 0x00DA93E3D16D7, 0x14174288D538F, 0x55F180450C93E, 0x5693DCD1B5192, 0x32A106350DD89, 0x02B54BA2C8A93, 0x79DDA7026567B, 0x075E678A636B6, 0x572B38D8F8851, 0x0043942C183A9 },
+    { 0x321FAEE10AB15, 0x32C0029DE3770, 0x1F475284109FF, 0x46B699741BBB1, 0x5F19CF896D897, 0x0CE1D84C57E59, 0x3D94040ABE168, 0x7D2667915B407, 0x3370A21057F55, 0x0101510F32330 },
+    { 0x5C2D83159A0DF, 0x2EBEDD40EA8BC, 0x7D4C293B06A53, 0x3F315FEE90671, 0x7E8DDAD01A49A, 0x412183A5FE6AD, 0x64E6B3AE6023F, 0x71850EB65ACEE, 0x216DC60A3580F, 0x012140F67A4D1 } },
+  { { 0x041EC86C8E36A, 0x4A055F5121D39, 0x358EA027836F7, 0x4C32E5AEBFE7B, 0x3445B66B82213, 0x6E081A945F00B, 0x3C65ECCBA4A7A, 0x03C388BD4C0C6, 0x0F2D8DC7CC3BC, 0x006914AAAE7AE },
+    { 0x113010427CECE, 0x6D1E789D54C89, 0x5B33F89D44B35, 0x3C77519D251F5, 0x634343755DC04, 0x2DC5BCC21C4EE, 0x228B16DEC1D19, 0x17D94D9A93B57, 0x430C332C69DAF, 0x004F99BD73E40 },
+    { 0x554A0495AE268, 0x2437A374FDDB3, 0x707DCF4986444, 0x302C195374608, 0x0C3CF3D3122FF, 0x02AD14241055B, 0x1E21D336EE6D4, 0x7E0D6874DC469, 0x3D88ED72AB336, 0x00A1A50FF65B4 },
+    { 0x019F824F34780, 0x160F294664B14, 0x5F11E190B9692, 0x35A83A9BE90E0, 0x7D2CBD2AA2671, 0x14B5D6CF2B1A5, 0x49ECED1F76C62, 0x64CAFC8366DB8, 0x6A62F284C2A4D, 0x00B316CE299D6 } },
+  { { 0x5AA93F65093B7, 0x1218577DF3FB5, 0x602A35A3B38F1, 0x348D7380F2D2E, 0x64F340516987B, 0x408DA7898DBB3, 0x0CBE1FAFDBF3D, 0x7228047A63226, 0x66C5C9F2C7158, 0x016B70033E5D6 },
+    { 0x0C9351863B807, 0x4330E07CD3DB3, 0x2C7A5EDCA9078, 0x25F02C45BB12A, 0x0226E07F42C7C, 0x608BFB51AB3E4, 0x5F1CC2E446F3F, 0x3A6EC147796BC, 0x25EBCF6FF306E, 0x0064DD8A9ABFA },
+    { 0x0B9169E093D39, 0x3EA2038D6582B, 0x743DF40CE89E2, 0x54BB00997B428, 0x52BC341C14B15, 0x157BC5BD96877, 0x27006E0C80322, 0x00E273FC04A4D, 0x7D8CF211A7A95, 0x01850AFDD34E9 },
+    { 0x29BACCDA67D79, 0x4D2B32EF0D82D, 0x58D26B1C3C9B5, 0x79B022857D525, 0x78E025E93E2C9, 0x67D7B0EE960C4, 0x16E42F8AD1522, 0x271B70BEDC52A, 0x157F744119D1A, 0x0135DD9FF4A8E } },
+  { { 0x75EA4D0A803D4, 0x7E198C3095DFC, 0x1936216B24CA4, 0x3E95C0220603E, 0x25A98966426A4, 0x29B20084D7DD1, 0x3E52FF346ED43, 0x26E28BF81A291, 0x2D105806EBBB5, 0x019827C5D64EF },
+    { 0x3A02AE15FFABD, 0x2AF43414ED8CB, 0x1DC94137B1B75, 0x486E1825F274A, 0x6ED2F2131B4A6, 0x066B92F6DC371, 0x1BB8AF92FC6FF, 0x2A37B0458AFDA, 0x03EA19325927D, 0x00B6706017223 },
+    { 0x4D10D10D0E746, 0x30E12378AE37B, 0x62F89705C4207, 0x47F6C7964D469, 0x1F1D32D472282, 0x5E06A7568764F, 0x47A637154DE72, 0x150190BBD78E5, 0x1144AB165D161, 0x011BF9A791311 },
+    { 0x24B46F932DF9B, 0x3728A7178AD9B, 0x4449BCFB3D601, 0x24F12FDBF37B6, 0x63B206B6B40B5, 0x0FD9AF19DB4EA, 0x6124FF7812757, 0x630C675000846, 0x747026B3FA986, 0x01064F0F3866D } },
+  { { 0x61B20B22FDEAD, 0x5A6658CB02A68, 0x41CF29EB13655, 0x3C810CE8844B3, 0x57ECA3FF683FA, 0x7D1A928042E97, 0x7D67251131F06, 0x2E1EBA98D8E48, 0x13299087B5532, 0x018D5B6ADEF88 },
+    { 0x1A3F865494D95, 0x777143F1992A5, 0x410F1DD3BDA93, 0x47F9AC688875A, 0x213217DB8C8CF, 0x7DB8443BE6282, 0x4DC5D9A20BD89, 0x752440D847EE2, 0x1C14E895874C3, 0x003FDDD00EE25 },
+    { 0x0FD9D5F4A6155, 0x2BCE5BD5AD421, 0x0EB1C6EDFDEEA, 0x23BBAACFD68F4, 0x6AC3DD238D6B8, 0x44F50DC87160A, 0x743C26A60C65D, 0x01B652AF7DEBF, 0x2445F6ADD19E0, 0x01548B803CEA0 },
+    { 0x4144206B9B15F, 0x31A38A5BBB050, 0x669D2C8E7251C, 0x616E6C667FD4E, 0x777980CB29A5A, 0x7661224947A23, 0x3246ABD227A4C, 0x10564B300BEA4, 0x6604B95F38F7E, 0x0107CC0430247 } },
+  { { 0x50B4E18E6E761, 0x3E0DCD13613FA, 0x05A36916D0E58, 0x49381E31D24F6, 0x7F0479E296AE0, 0x66506445CDF37, 0x43F7CD60E6493, 0x1A90DC571CDB3, 0x5E1DC65476E6C, 0x0086C6CD5084B },
+    { 0x3C4E6EA2E665A, 0x0C8BD15FFEDE5, 0x758548E972A5D, 0x205F8D80BDA22, 0x45B74E4C7B3FA, 0x176A0755DD0F0, 0x0BA9A6E4ED07C, 0x128D36F9EDFEB, 0x3634950A70169, 0x00D0C7B822FA7 },
+    { 0x2C818FFD374BF, 0x424271A193C3B, 0x76FF58B5E4F00, 0x298C2ED3300F3, 0x4CF6FD2D60564, 0x1D1010D4B54E8, 0x4274A9572B852, 0x0102D2D62E4BC, 0x18B2A361B26F6, 0x013EC7A1E4A81 },
+    { 0x4846865A76D16, 0x7FF993479D357, 0x6AFDDCBB37B3B, 0x4C4251D6A62DD, 0x140074D485A7C, 0x23F7ED0A0C1C0, 0x0DBA3E2D6F102, 0x37349A4CCB01D, 0x4904D2795D889, 0x01256B1A3C8F6 } },
+  { { 0x653881233BB12, 0x4AEE110A27433, 0x624EACAD4F0CC, 0x7659B1572DE6F, 0x0D2046952AA56, 0x09606A8ABC13F, 0x793E88F0B526F, 0x29C2F764462EF, 0x108CFB6027EA3, 0x0139AAEF8DCDE },
+    { 0x1D96416794D2C, 0x2434E602DD6BE, 0x7FCA8B07FEE55, 0x543196FF11EB8, 0x1BC15B3EA6183, 0x1112253B1F412, 0x774EB662930A8, 0x5D6107D36774D, 0x46152D5D63375, 0x006378A27A53D },
+    { 0x703AE80258E30, 0x66B648A2FD9DE, 0x13A487C3B087A, 0x3DEDB39B5C001, 0x62FAE92B74D8F, 0x5CAAF0630D43F, 0x7A7C51EB5DE8A, 0x1F43E231917E2, 0x100F1D245E91F, 0x0075299963709 },
+    { 0x07E85175F438E, 0x14D8D2154B027, 0x21A4F2886E4B0, 0x307221B5B69D7, 0x61F8FE4A830BB, 0x5969D0D0BE0B1, 0x6684117B3538C, 0x42385185E9F85, 0x6B605D6336F1F, 0x0147B924CA801 } },
+  { { 0x4A84654841902, 0x604B070BAEFFB, 0x54241FAAD3702, 0x6430ACD75ECD2, 0x07ED6FB95A269, 0x348E9C97201D7, 0x17B85771A6260, 0x55B6B1E8FB3FB, 0x0E034510166EC, 0x001DBC2EA155A },
+    { 0x24D35006D0D12, 0x63E081E369561, 0x18664ECB0181B, 0x449C0624CE036, 0x524CE88BCFB2F, 0x676FA0BAFAF51, 0x05CFCDDCD0A51, 0x0F1734B813AB6, 0x453AC4686FF99, 0x00264BFAA75DD },
+    { 0x04349FCE09DB4, 0x610C443560478, 0x22CA1F04F5317, 0x5D9AE917FF04D, 0x06EB69C1421E8, 0x0B4235431A5CD, 0x468D603D79346, 0x4264B528CF71B, 0x127FF4FABC28E, 0x00EBEC06F4DA4 },
+    { 0x30208C701B54A, 0x1C09A25A59410, 0x5C545F68CACC8, 0x4D085C5F39DE8, 0x0B204C35FD3EF, 0x4AA43CFE7F8DA, 0x269F503E3CB45, 0x5AAE908C4AA5B, 0x792CEE8F5D000, 0x00FDCBD668FB9 } },
+  { { 0x7DDB84188ACB0, 0x4C368D1CDE4E9, 0x3E4308E968D44, 0x23A345839A519, 0x47285AE7DA705, 0x58AD26FFEFFC0, 0x42BE4B11AC909, 0x5E085A1A6ED9A, 0x7F9E4CF6A539D, 0x01DEB44588B8F },
+    { 0x7EBF24D7C0C7F, 0x6ACE8BF4D9CDF, 0x11E9CCAB5A54E, 0x16745A6C3DD50, 0x0ACF71E512534, 0x7FA1BFA92325B, 0x2D0661CFAE028, 0x3D97BEDD68882, 0x66107FBF66D82, 0x00477CE0C2B5D },
+    { 0x0C94BE07F4CB4, 0x0BC934BEC12AE, 0x4C87C1A51800C, 0x12CF8E22B92CB, 0x4FDBB496872BD, 0x54F5BB23B9019, 0x275985B4FEA8A, 0x516EE2A670DA4, 0x58A395E48F1C3, 0x00FCC03D17190 },
+    { 0x06AC14A5574AD, 0x0FC0A9888B35A, 0x78A4180E42094, 0x47853E1A0C9A9, 0x6AB364F14846F, 0x218E84A536433, 0x045F4E482646F, 0x0A1B9D9F25D43, 0x787B796477189, 0x01340953F59E1 } },
+  { { 0x75C40180EE224, 0x4C96289055F02, 0x15EFAACAA8004, 0x7B1AA05F2F3D4, 0x618961141A77D, 0x2A7D09ABEC5DB, 0x2EC57C492AE43, 0x7E71F72EF1B08, 0x7A00E63732A61, 0x0135808072D56 },
+    { 0x449DB7E52E751, 0x32341A2ECFBB8, 0x256AA9B38A439, 0x66A832D5A567D, 0x090026292B75B, 0x3C6B0D7FF0E2A, 0x118EE75266EB7, 0x2286180321735, 0x6120FB09756B3, 0x008F635EB3DCA },
+    { 0x5C5B388E015AC, 0x4071CE529D436, 0x678259402A7C4, 0x3A75361ECF309, 0x2054DB1A2B055, 0x516ADB6779421, 0x429D2B7702CDB, 0x0C4C0886BEEB7, 0x6610D0805ADA5, 0x00C19CF81E105 },
+    { 0x02BD0371B269D, 0x0449C187E2B6A, 0x4B5B8CA4CCB5F, 0x3DA225253A357, 0x0B425DD531713, 0x330D6F0DB1BE5, 0x51FFEEE5C1C0C, 0x31A8A0AD53B4F, 0x6DF1E5199BF67, 0x011CAC8F6EF21 } },
+  { { 0x15CBD1671F319, 0x0CA90B2F8AF85, 0x748E20A0E9F7C, 0x6CBF2815E4EC5, 0x413B3B72039A2, 0x5C94EDC37BB73, 0x73C181C947AD0, 0x13F969C99BE98, 0x6726D8482C5B6, 0x017DCE0EF2A85 },
+    { 0x24A47A21EB01D, 0x1A851EF270D1F, 0x3AA728C00DAC1, 0x4BEC2F03E2325, 0x24FBA5F7D0C0F, 0x42EC5E4E713A9, 0x4A5CF620E3C2C, 0x6BB18739FA1F5, 0x0686974FA9994, 0x0076709C21183 },
+    { 0x483586280B3BF, 0x34965ACAAF11D, 0x7296F069777CA, 0x5598E6A2FD699, 0x6235D02960E07, 0x442EABFEDF1D7, 0x656F0ABC41008, 0x355AE55DA2F8C, 0x67F32AD7E6C82, 0x013F5D18A5884 },
+    { 0x2E6CB7125E439, 0x6ED69612E2694, 0x5BB1D8C745069, 0x181629979D7B0, 0x403E9BEC8D2BB, 0x545CADA6AD1A4, 0x2E32D590A34EF, 0x7BAC4FF543EEB, 0x5AA0701F0FD3F, 0x011521E6BE3CC } },
+  { { 0x739C87E1F600F, 0x05B264C3B811B, 0x62594040BC9F9, 0x340300E795154, 0x2A560C2160FD2, 0x20EDA610037D9, 0x57138B9BEB01B, 0x3ED82E46E4E7F, 0x49DB2E13925F7, 0x015E9C0D5DA90 },
+    { 0x0886C1D5E123A, 0x7507CE3FC0D22, 0x3D303A4629E53, 0x55A9745359105, 0x20739A9114E5E, 0x68CF589F16386, 0x12912C9FEFFBE, 0x3F4F8E3D3001E, 0x2187806E9AC0B, 0x00A6208D28F00 },
+    { 0x3F82D1DB04DCB, 0x736ECA4B75890, 0x729970C8769C5, 0x18BA1077BC3D0, 0x307AEFC1D2309, 0x47B0ED3CD9EC1, 0x387D5BE7C544C, 0x118D7D13A3005, 0x2A191D021A315, 0x00A74A26FFE00 },
+    { 0x2C7202AF2703E, 0x06AF205B205F1, 0x0EC9477B43A5B, 0x30EC91EDBBEC2, 0x695A417937A53, 0x3D343376DEB70, 0x28A2AFD21C786, 0x24DF1C0454A2B, 0x6EBFB207FCD48, 0x00B1AF46ED4FD } },
+  { { 0x43A4788A4CB79, 0x420FDA603E3DA, 0x16EAB5D972424, 0x6E6BE60FAE377, 0x2A4444C95B5BA, 0x422F90C448FA7, 0x6141643BC6464, 0x367C53F92E982, 0x347C8BF214899, 0x00BDF9F10D9D7 },
+    { 0x4AF720DECBB7E, 0x6E2785733701A, 0x7A576EEACFDF1, 0x48A86F1235D93, 0x74BC82133925E, 0x6AC10C6DA6976, 0x3D3FEBAE2A286, 0x0CB41148FE442, 0x7BB9574E083A3, 0x00751DDDBDBB3 },
+    { 0x404FFE46C9AE3, 0x4551688B4A658, 0x6A8F693343B0D, 0x4E35F55650604, 0x17B61B763356F, 0x03767ED9BF667, 0x03FAB2E223A70, 0x794DAF3353810, 0x33261271CB877, 0x0114D4C6C542D },
+    { 0x0BFA71334F5CE, 0x10FF9E633A30D, 0x39F2198AF3B60, 0x36864D8BDDF38, 0x77712B0F62FFE, 0x7EE2A2C4CF52C, 0x14D61754D1A1A, 0x71C3A0C43715E, 0x0405387617502, 0x00B0F0CDA27B6 } },
+  { { 0x67720394A4B55, 0x7B57AC8D59F2F, 0x151234157921A, 0x2F6E3BD706D0F, 0x31B9CEF3B5CC6, 0x20B07F921CCE2, 0x18B460E7E54DE, 0x16E5D8890D4A4, 0x2803F6CAC34AF, 0x0041C18334D8F },
+    { 0x46BE2CA6E8AD6, 0x27E5A73BD7C3E, 0x2A1BD02B65DC5, 0x1A981B60DE00E, 0x0E251F4D5C370, 0x1B8271C8BF734, 0x7991074E46EDA, 0x27738D14773A5, 0x22BCF1ED4E689, 0x00B77F325EEB9 },
+    { 0x074861A56F8E7, 0x588911C1B7931, 0x4F984343ED679, 0x70EE47E124305, 0x2CB597F9CBEE2, 0x43C347D584099, 0x3B72ADEA26130, 0x55D9577A66B77, 0x5DF6CEBBE0875, 0x013C4B899370F },
+    { 0x5BB351561E5F6, 0x61764952C8C00, 0x0470EC37FF13B, 0x3721E5A7B1810, 0x46417C1881A64, 0x13AE32BC50A4D, 0x1625456E9D89B, 0x5E240C000557F, 0x56E6584FA95CD, 0x00BBF25032BCE } },
+  { { 0x736F234A64160, 0x2D1CF21DD6FFD, 0x2D19E5CC74857, 0x6518DA471EF89, 0x3AE11AFC56DF4, 0x45E46E51B18F6, 0x1C53BE8158718, 0x056E2BB99164B, 0x1A40DF9CD6CBB, 0x01A698F1CC345 },
+    { 0x1A2F287D0EBAF, 0x547F1C1749137, 0x11A07695CB8F0, 0x5E2E66B2426D7, 0x3FDDDCED55C4C, 0x4763EF30AB2EE, 0x5B716FAF11984, 0x5ACC20C4434F4, 0x3471C4A786034, 0x00793B2B76E5F },
+    { 0x1962EC054FAE0, 0x722ECE657BC36, 0x7428128BE08B0, 0x506B9B36BC30A, 0x72D1395BF3B47, 0x3D557884372CC, 0x0C0A1574D5BD0, 0x4CBB63E73B68A, 0x01DC902055891, 0x014B844BCCDEC },
+    { 0x19C051BA5E6C3, 0x5D73B9525D82D, 0x162EB656B3791, 0x758BEDF4A282F, 0x615D0EA5A7381, 0x06B58CEE57392, 0x38DA2709E7FBD, 0x69AD2429C4029, 0x618ED0C916052, 0x009E503F6D9A0 } },
+  { { 0x3523AD39D276C, 0x6CCEF6C53DF15, 0x095ECC56E028B, 0x16C397FF97A82, 0x6C64A4D88CE3B, 0x563E7F84D366D, 0x2EB3D280F251C, 0x7F26D7C61379E, 0x22907D0314AA7, 0x007E91E698619 },
+    { 0x7AE8988EE3718, 0x2B4D17846A8B9, 0x386BA98B421ED, 0x43FD5922BB260, 0x3F7208E574072, 0x38ED6D085EFAA, 0x3F66D1C4E7A8B, 0x64B9B7B1348B4, 0x64BC52838215F, 0x00D32376655F6 },
+    { 0x37840E1BB46FA, 0x41633AC429084, 0x69290F806C5F3, 0x0EAEBCB3C8652, 0x569C7619715C3, 0x121C833AC1F8C, 0x2224175DB8A71, 0x4A04CF58C6E54, 0x1312763D01A28, 0x01725B95B9144 },
+    { 0x128F5DE24359A, 0x1E8B084828F7C, 0x6985E1988B9B7, 0x50AF7C932D8CB, 0x67B3145697063, 0x403D324B61F15, 0x45D3565C830EC, 0x6E18A3DA1FD61, 0x408C130CEF2BA, 0x00D08B522E7FF } },
+  { { 0x7685DB7E79BFB, 0x7A763E6C30837, 0x55682EF92295E, 0x642D57A196739, 0x3A77BD937948A, 0x71708CCD830ED, 0x399A9C8424D44, 0x3EBBE58294E6B, 0x5ED507E482F93, 0x00D4661304803 },
+    { 0x6BD0398BF86B1, 0x384F67EBA07AC, 0x27DDABC258219, 0x1539077D11220, 0x2C3DF3659B482, 0x4BA977B3C11DB, 0x4A7E0A4B4EC0D, 0x43F4E7EACB026, 0x2E5D1D8A7D8D1, 0x006DA0580B3DD },
+    { 0x65B0C24588141, 0x1DFAEE70C48C7, 0x6A20185658A3C, 0x3CEAD58B866DA, 0x02E327861100F, 0x5176C0EE01569, 0x3C7F45CC20CA1, 0x65E72862A967C, 0x553DF9146CF25, 0x019F1C1B5D4E6 },
+    { 0x50B4D76599A75, 0x47C7D9A295913, 0x3DF6D452580E0, 0x7FD2F0577BF33, 0x1D460A42DE6E2, 0x5845217BB3367, 0x345334171E581, 0x676BB6B481A53, 0x4E238EE0AE374, 0x00B38E636A6F5 } },
+  { { 0x2442EB665F5BA, 0x70D1D71561C93, 0x4259F98C84877, 0x3736DAC6683ED, 0x77039AA03FFF4, 0x5439255528FC8, 0x3A282CFE0F3B5, 0x66CE8ADCFF79A, 0x43860DEE895F7, 0x003BE3967DFDF },
+    { 0x5152D9F384D38, 0x3290806A6F8B2, 0x117E8E3EB1B0C, 0x700B51558D7EE, 0x05F9CB6A47C45, 0x07715E30B1EE6, 0x6414028364985, 0x535676D41948B, 0x5684117E4FF73, 0x005CFB46BE7FE },
+    { 0x0C4CC6C5CD276, 0x2F90F68CD7E10, 0x27DBA8EF06FB6, 0x1C232D7B69AB4, 0x0F742634C22E5, 0x26A3D1C0CB15F, 0x14CE8178BD0F6, 0x7852C1E5D2161, 0x7FB75830EBCD3, 0x0134F0F127885 },
+    { 0x3246F1FC3DD3C, 0x10CDC58181339, 0x54D4189028292, 0x73C7331BA8920, 0x7E5FDC6ABEC06, 0x3A054EF1DDFDB, 0x2404CEB43DD01, 0x0AB5C54353754, 0x0BCC475B44FC1, 0x00D430197463D } },
+  { { 0x5EC4F118D7EDA, 0x43011DF21D268, 0x40A88F61EF906, 0x3F8785A795A3F, 0x5DB5121CD8FC5, 0x00146CB9AA1F1, 0x2259C941BF1FE, 0x6B430247096FA, 0x45C6C68EB090F, 0x01DA419C5C7D4 },
+    { 0x222D7210ADB0F, 0x06A6EEB456280, 0x6CEA371364432, 0x762482D86EEA1, 0x7262995F43816, 0x558776F7F3774, 0x7A4D0CF188E49, 0x21D1F2345F8BE, 0x6BBE75654E918, 0x008E5CC8897E4 },
+    { 0x643E52E775B86, 0x1B3946ABD0A6D, 0x759CFAD7DEC42, 0x16B2A72C01DA6, 0x7DE8390897E5D, 0x54D330DC76E28, 0x532F1F45A331B, 0x22784E25E7F66, 0x446DF8B0F9754, 0x010CB4B1D32C8 },
+    { 0x056FDD5CBAF9B, 0x77A385AB530D7, 0x7F900036FEB06, 0x47D57CA6A3DEB, 0x32F06DDEFA7D7, 0x4F26544956019, 0x45E4195D2B6EB, 0x10205D84F7847, 0x5D585F8C3A9CA, 0x00E2D818927FB } },
+  { { 0x5AF674ADF6B05, 0x62EBF8BC1BB9C, 0x4B41D1D698236, 0x1FC63CC59A098, 0x29AA34F6A30C5, 0x20AA036F5D991, 0x407E912C7E0A6, 0x678B7F68FAE0F, 0x1667779ECB45A, 0x0164DB9640DEF },
+    { 0x36C9C9972DD86, 0x4317274575DFA, 0x2BACB141993BE, 0x217A322DD6DCC, 0x58C688F3361DD, 0x14D2DF33E2DA5, 0x6A4B1F4322A1D, 0x39F8ED3F15585, 0x286A17602C9B3, 0x00643935DAA1D },
+    { 0x6FC7CA95034AF, 0x715E5329BB3B4, 0x13BEA3CEDAD67, 0x30D59C20ABD21, 0x71A7735176C65, 0x7A2B24FCE3247, 0x4FB41C2F38F81, 0x37B093A75E415, 0x50479AB335BBB, 0x009AD266C2E22 },
+    { 0x6E79A42FBC662, 0x519E02C4F10CE, 0x1185D4ACA17A3, 0x267290346A2E8, 0x5DE1B696A910E, 0x4700337A6C611, 0x1E6240F20B5BF, 0x3BB517F07F893, 0x56DBE39B2E6D3, 0x01526D033D2A7 } },
+  { { 0x51E6A8B7B716E, 0x15BF9B53C0AAD, 0x1888DD3EAD46D, 0x62747C0D9D071, 0x25C6684C53786, 0x72D1A47410067, 0x18DB798F37EDF, 0x161242ECF4C23, 0x3E725E3432D1F, 0x0042D0D94F91C },
+    { 0x507AD2FCDB9C3, 0x60FE0E46BA1D4, 0x3C13BB22073F3, 0x5F8DFEE14251D, 0x5F7172776B6D1, 0x478DF3C8AF1B5, 0x2B9AD2E2ACE20, 0x7D4926337E024, 0x2B64FA6DC2447, 0x003EF873AFED4 },
+    { 0x314E5E65259F8, 0x1B6C3C0716586, 0x0590DB1C86A55, 0x1AB1DE2F66BB4, 0x0C82CBF6EDBAC, 0x39B3FBF17C279, 0x5C628B9FD4C52, 0x6DA87514CC204, 0x691058B9E08F5, 0x00C951DE007B2 },
+    { 0x5B8574E398D3F, 0x7D5C0779719A0, 0x515A98E938B04, 0x4712F96844749, 0x103A745E20C8F, 0x1A39AA863B21F, 0x12334B3DFC6C5, 0x0048626E50FAE, 0x5585FCFD7BC51, 0x010625DC01A8F } },
+  { { 0x5F6B71B527024, 0x43D50944D7DFB, 0x55A559AFBA02B, 0x6BE9D0EED71AF, 0x1A582AB159664, 0x6C2586E8FB97D, 0x5C06007564F6F, 0x59330A15CA658, 0x6EE67D28D1D98, 0x019C3A53B0F5C },
+    { 0x27DC1F5044F7C, 0x3812745E8A50A, 0x7C81AB2648C1A, 0x6E6C418DA4259, 0x098BFCBDAC3D2, 0x232435B93172A, 0x513A7E27C8B36, 0x22F51A0D0AF07, 0x3AC931A6FDCC7, 0x00DA9480112C3 },
+    { 0x05D7C3A42BE5E, 0x05611F7EC9BB4, 0x0DE2355AECE4D, 0x338179BF4F5B1, 0x40EC9462666D7, 0x0F33BC5CDC0B3, 0x006150CDB9D93, 0x4B61CF260D65B, 0x21878924F2355, 0x00BEA2A78D137 },
+    { 0x40503DA4112D4, 0x3EB566B3563B7, 0x1BB9396C762E2, 0x766BC4930DC4D, 0x2A84FD9E1026A, 0x18765C444FFDE, 0x4FCA0F089635C, 0x2627617978A34, 0x2FA7D3C426302, 0x01070A74C36E0 } },
+  { { 0x134F6ABA22BF3, 0x1A3F2FB04E2F2, 0x33BAB0E16DE12, 0x1A0D53FA14F2B, 0x2C289E8681647, 0x674DAD7CC14AB, 0x46ECF5F7532AD, 0x6DCDBAEBC099A, 0x35580FE3C275C, 0x00B541AB64E77 },
+    { 0x41E1AE43C9E4F, 0x4EFCE813A8EA9, 0x1D276367B882C, 0x4DCCE1D1D8DBB, 0x3D5002B7249E1, 0x55532A143512A, 0x4ABAC428109E1, 0x68DD79AA76D9C, 0x5E7F3A60460C3, 0x007E7258982AF },
+    { 0x0CC8D83D0D2BB, 0x53EA0B2EDAFFF, 0x69BF38DED01DB, 0x59B8884CF69A1, 0x2C1EB43CE5E90, 0x7D47192C54E54, 0x451596E6AF281, 0x504CD65A5907D, 0x0E313A5CF227D, 0x00FF7CFFB6F1B },
+    { 0x42F2C4C0EAF3D, 0x7581A788D68F6, 0x7CC227AF16D0E, 0x371EE933BE379, 0x1687BA9ACD995, 0x7B8BFB4FBD31C, 0x588FB697BF8A0, 0x06E4C591D3A69, 0x4A09F2F5835A7, 0x00CE4442F3598 } },
+  { { 0x68A17DB270A56, 0x14E343D8DC3E2, 0x7C3E59B3A0A2C, 0x3D69F85F73479, 0x751D6C0C16225, 0x513B8F27A0399, 0x136D3B20EA1A2, 0x4788DF5719490, 0x4452DE2F4D1CC, 0x009ECB76275AE },
+    { 0x6109AC534B57D, 0x4AD35294D05A6, 0x1BD6BD1D2DC73, 0x51FA9456B7AA1, 0x7FF01BF7669C8, 0x0495961EB4612, 0x3879D3A3C4580, 0x7BE4962EE8FF5, 0x2CC8FA99FA6E8, 0x0083A87365198 },
+    { 0x2F25B7F21D9E6, 0x043709E3E57A0, 0x608FA8542F886, 0x76AAF49C819E2, 0x2C144D3239CF0, 0x0DC096C5FCEAD, 0x2B9766915518D, 0x7C7C2BA8392DC, 0x6564C43812130, 0x013BC002B941F },
+    { 0x0960558D15C59, 0x026C6358F8B10, 0x2F6D9A09806A1, 0x01A00F17F8A95, 0x09108AB7676D5, 0x0B807EB8D558F, 0x3FDFE906B8E3A, 0x41926497B581C, 0x56034837EDD6D, 0x011C80E911BF3 } },
+  { { 0x5CBA5B2365FD2, 0x3C79C2B2C62A5, 0x6258AF9F12B33, 0x2436AE316B44A, 0x15EA90249140B, 0x55AB25E8B649F, 0x5915F54A8E784, 0x62C30AB6B4FC8, 0x53C5546DD34AC, 0x016B474ED6535 },
+    { 0x5845232D0963E, 0x75400730484DA, 0x61FE98FD4B1AE, 0x2A771CBDE7A55, 0x4EA7B0C3987B9, 0x7392BF4BFE0A0, 0x60783F56A4C3C, 0x51961DEABD638, 0x18E1B0216E8CB, 0x004CFDDF4F273 },
+    { 0x7ACAA02DF1576, 0x1BC7D0BAECFFF, 0x27F45FB4C463F, 0x3D6E9DD1C52F0, 0x4D047D363E6C3, 0x1D73695D0A8E1, 0x3DE69A0D6AF57, 0x7A133FC4BFA72, 0x52F929E98FAD7, 0x014D6B662455D },
+    { 0x365E499D0DE02, 0x1E0B158876FB4, 0x4B1D005CCAEC7, 0x20E53F608D367, 0x455327B787752, 0x42C7CB21745DA, 0x60DB23A93022C, 0x1A11772DEA655, 0x1F19D2E727BEF, 0x00D1129812BB6 } },
+  { { 0x09D3735017C60, 0x23236987F5695, 0x15150A7E6E78B, 0x119A3BC8CA893, 0x464B055ED8039, 0x0A2533483A49B, 0x0C00560D05474, 0x2CAED3344BBBE, 0x30C63B52457C0, 0x013FB0121BFB3 },
+    { 0x3CB5674AEC91F, 0x64F2969EF9CC7, 0x1B6A8B00F3E19, 0x03D12297017CC, 0x7B221F900F317, 0x664E255EB5159, 0x5348BD6403923, 0x7469A9CC092A5, 0x65DA17164B844, 0x005F0E4C7719F },
+    { 0x2EACE70400B16, 0x347289F446150, 0x54EC30208E806, 0x4CC4AAD1E2CCD, 0x4C3BBE9DF2444, 0x39B64FEC820F0, 0x1273C318ABCF2, 0x426B6428280E3, 0x5851914A9BCB9, 0x0127C215F0023 },
+    { 0x6E593CA5DB06B, 0x28348A91FE56E, 0x306E0FAEA09C8, 0x4BB19D7DB3942, 0x57202F71520FD, 0x2056507255269, 0x68DF59C64211A, 0x57420A5574654, 0x31426EA4826FD, 0x00DC9C27D87B2 } },
+  { { 0x4389B67B0751C, 0x106669A3CF218, 0x59DFED8EBF22C, 0x7FABFAC356129, 0x6105062EA5F0D, 0x00BEFB8BB190E, 0x3D9448B8AC037, 0x7C72F237DB1C0, 0x3A9F427C15CCB, 0x01BD260B0307A },
+    { 0x39180DF3F0C3F, 0x67A459EBD3C86, 0x64D9BA2645BBE, 0x177D72314657A, 0x1B389AC4A37DC, 0x63D043CE64C64, 0x046083C0A55E6, 0x2541E47B97309, 0x7E88AE62ED12B, 0x00B6C4D8B0C18 },
+    { 0x26B02B58BA1C6, 0x4215283A57F25, 0x78C2BD18E63F8, 0x7700A4434E918, 0x58BCD73AEDB9B, 0x60606E7869A52, 0x6647B84B8CC78, 0x3231C433DD1AD, 0x292AF18B678E0, 0x01275155F48BC },
+    { 0x3DFED9FCA9151, 0x225A0647E11B7, 0x491D24D54996D, 0x5DA4F4DCA27C3, 0x02F30B9D47550, 0x449D4A7E0DA80, 0x6EBEB9588C432, 0x6EE9200D2A273, 0x588F94E19E658, 0x013DC3CE4A1E1 } },
+  { { 0x0D0A9A54FE68A, 0x75E71529064FA, 0x04AFC9416F114, 0x5FF5727D90401, 0x5FE09A51C7A6A, 0x27BFCCAED1ED0, 0x72A49A5C92B9F, 0x6BD8D950546F3, 0x13ABBB62A8009, 0x0088D0CD7B52A },
+    { 0x29A8D9F97C1FC, 0x3011A91CD4253, 0x70FB596794CA1, 0x7C448F7319D79, 0x592724CBFF851, 0x7EB1CF1DF017E, 0x7EAF5745B2715, 0x15ED7F8082BBF, 0x64653E34BFE4D, 0x009F2BFD83E6C },
+    { 0x54037F9457D6E, 0x5728D5910E5B6, 0x33FA59EB0F21F, 0x00A3B67B9EBBB, 0x5591D0481C6F8, 0x40083311F0484, 0x409D9B1C434AC, 0x07E273D67C808, 0x569A091BA6097, 0x0129937B922E1 },
+    { 0x3D591724F8F2A, 0x13D043B95CD58, 0x0A22391227F4A, 0x2D6E82B433385, 0x17427EC0CC7F9, 0x1E8E0BF5894A3, 0x692887DC71A2E, 0x693A2441A5EF4, 0x64DC0AA909BF4, 0x014C76892C398 } },
+  { { 0x1228AFF7F99E9, 0x0FB7457268A04, 0x2A1145AB3A1F9, 0x23320FCF8098D, 0x378B697EDCB1F, 0x28795E03EE584, 0x4E01914C8BC6E, 0x0FD39C661411C, 0x3E3787FD86A08, 0x01E49CDDF17FB },
+    { 0x5B25AC95E53FF, 0x43D86CA8170AC, 0x16A1B47BA3357, 0x0CDC068917CFB, 0x3AF2E0C118ED1, 0x1B8621A447258, 0x0AE5A5742B02C, 0x57B7120A76168, 0x4962EE03C75B1, 0x00C5105B96376 },
+    { 0x54A65BC1EED35, 0x2F8FA1047B71B, 0x743D5EB08FD71, 0x6BC7AD51BEA6E, 0x6E5D813296FEB, 0x761001A0789E3, 0x465FE6D96E3CE, 0x4EFCA527DB493, 0x6BD80E25334F4, 0x00E6E617BD01B },
+    { 0x00901BBD07361, 0x2CB18053D4D00, 0x0192F78ABEC20, 0x14D5F0809F437, 0x76E9470A42720, 0x2B43C7065CEFA, 0x1C8061153D253, 0x6BCFFC2932838, 0x14A810DB087D2, 0x01213245F581E } },
+  { { 0x32B7DEB590211, 0x35CC6C01C2F7C, 0x5A884D26C7E96, 0x7E29E79BDD5DF, 0x13664621F0804, 0x7D21E5B5B487A, 0x46FE64803A0E9, 0x3D1AC77A55441, 0x62974E21B3E20, 0x00A14B7EDAAAA },
+    { 0x47348A1EAB986, 0x10C015619A973, 0x40CB7AD41E36E, 0x476F84744459E, 0x5D355B36AA75E, 0x4EFC90C20D1A6, 0x33E189BA29B81, 0x07ECDDF840E0E, 0x790F382F8A82C, 0x00562FC29EC6B },
+    { 0x2524D656E91E5, 0x5C9B53375B9FC, 0x014E16E53CD99, 0x4D8E8EF5DE53C, 0x4AB17C2AAD200, 0x5F435EAB0B303, 0x4D0FA6392FF9A, 0x3B5DBB0C406FE, 0x11B03F1E0A003, 0x01020584D7FEE },
+    { 0x7C1CC6767D332, 0x6D29BB731B643, 0x1119F17FA3013, 0x7EFEE2334F390, 0x06773080CF58F, 0x1DC09A979B8A0, 0x06838E179AC17, 0x0B52555ABB471, 0x5E0D95CA36EAE, 0x010CB2D5DEAE2 } },
+  { { 0x68E40ED68220C, 0x12A029EFC40A9, 0x6ECD7C85BBC54, 0x4EA8CD68BE340, 0x07E891E74B85F, 0x73B32EF1A04C5, 0x558AA0ED8D786, 0x2AF1473782B71, 0x4862356B28F2A, 0x017E63B35F81E },
+    { 0x2BEA985FA8BBB, 0x3F3C2ADCBB2E7, 0x3C1648DB383DA, 0x756CEE97F2B67, 0x3E9B22D912AB6, 0x6B69747434191, 0x7DCB9A48F48FC, 0x4DDE0CEB5A60F, 0x415D4D1D814F2, 0x00B5200465F8C },
+    { 0x5827CE7A6569A, 0x2FB86C03BAB5C, 0x0ED7F5BD31052, 0x112C22F66D24E, 0x6D148FAC4866A, 0x0382F1D283CA9, 0x3B2ED387B3B02, 0x5D9FDFDAE4D07, 0x5D4507C4846F6, 0x0119882E63FE9 },
+    { 0x1C147CBA4959B, 0x7936B930B585A, 0x5E259034EE650, 0x61A6C23273D2F, 0x744DCD1B06C42, 0x3368020377AE2, 0x3278E483BE3AC, 0x3F80FF07E5E52, 0x540655087B82D, 0x00CAD3E74406A } },
+  { { 0x6FDF2EEC55BF5, 0x3244634C490AD, 0x300706DAC2ECB, 0x5784C1F995D6B, 0x6B7AF34F18D7C, 0x0F96FFDB4DFE2, 0x0B94FA5776267, 0x24E99CC324CEF, 0x7B6D72438FEFC, 0x014FAE9A487F6 },
+    { 0x62B40B0C3DDC0, 0x6F3CDAF284BD7, 0x08FC55BB8A28A, 0x453CB1C6E2034, 0x1F2AB1D46774B, 0x702A6F699F211, 0x67642978576CD, 0x5E0AA57AE0628, 0x55BFCA5F9C92F, 0x00D45EB360A9A },
+    { 0x54B37CDD483B7, 0x2770313321BB9, 0x3ED7F93476558, 0x0381BD2DEAD88, 0x7A12715E87E16, 0x3ADBB74C7A68C, 0x7753FCB36FBDF, 0x380919CCA0911, 0x614AF0D1995BC, 0x013B2BE80BCA3 },
+    { 0x7F242D062C23A, 0x76D2856BA7085, 0x648B782B7C64C, 0x3A6818D2E77ED, 0x25F4FE909DC86, 0x772688BFD8090, 0x25A97DE79657F, 0x77CD0A5442376, 0x6C9F6692C5CFA, 0x00FE54582AD8F } },
+  { { 0x1569F364FDE67, 0x26D3B5EDE2395, 0x4FE0141A11389, 0x36EE525D0DF63, 0x0D45F48AC1C0D, 0x6595B59760FF1, 0x33304AFF86C79, 0x2349BC4DD0A72, 0x1A5959D7A8381, 0x01355EBD23876 },
+    { 0x79D006AD83321, 0x479D78123693F, 0x06A145041588F, 0x46A84B419E87F, 0x4B7FD8FD2EC14, 0x41D65CFDFA835, 0x0F27E9098DE4E, 0x3C9DDE32A9BF8, 0x004A83DDC15FE, 0x009E456DCC591 },
+    { 0x78D8310B1D9E7, 0x0232C8EA91C00, 0x59460E28E3C81, 0x77F6C613A3850, 0x6C5B80A14D925, 0x1AEF2CF37BA3A, 0x4C34FD856CEB6, 0x1790432DAB121, 0x7A400E12063AE, 0x00E75FC0C6383 },
+    { 0x318443D7FC191, 0x46B511AE3BCAF, 0x5C707E5723055, 0x14B47633FABA4, 0x187823EACB2C6, 0x39567CB8B7BC0, 0x19986A2AD0630, 0x492DC48CDA7C7, 0x4BB135501A21B, 0x01438138A768C } },
+  { { 0x5F350AFD27621, 0x77ECD45E1EA20, 0x4E991A21798EA, 0x78913E4C711DD, 0x7829D1D707D7C, 0x43C3679F0CD22, 0x6D994139B2A43, 0x4EFA8DD7EAE9A, 0x243CB9F897E1F, 0x00A8ACBF35A1B },
+    { 0x080B7DD069935, 0x12CC159D4E845, 0x763188F160543, 0x5FE649B9710A1, 0x04B2A56D5B59D, 0x3768B5029237D, 0x4842C89B73586, 0x10BD27BC7CDDC, 0x473504E430DE5, 0x009938708F869 },
+    { 0x79683ACA1BA89, 0x3CB5F87C99256, 0x5F2D78A0DD7F7, 0x75611A083AC52, 0x5124D8A22A4F7, 0x6CD1DBC7AA0FA, 0x476D233A2A778, 0x6757F8B8F675C, 0x083376DA10E29, 0x0130467AC2F61 },
+    { 0x595EECFD4FB83, 0x5588D8EF0A5EF, 0x187B4837049F2, 0x3D8933793E024, 0x3BA1980F67F72, 0x4A6101E1DAF87, 0x021C3CAA9FED1, 0x6928A4F406A45, 0x37878EED2D8E4, 0x00AC4C1F4794D } },
+  { { 0x05FD27EEB51C5, 0x4DD7D7E8D3390, 0x601CED1B1C8C5, 0x0B6C03B0D74AB, 0x28E5268369ED4, 0x0EE5F5523EC93, 0x4FE2C1F182750, 0x4B3E53CA79CF9, 0x28F8909E47B67, 0x00ED6F30CAB13 },
+    { 0x2FDC80F68B1CD, 0x3880745A5462A, 0x13086DE2EF4EB, 0x62EDCE588A18D, 0x4511ECE82E5AC, 0x3F8C24BA06008, 0x37B0B431C195E, 0x512C4B4455F9A, 0x3E8DB8681083A, 0x008DAEC0322D3 },
+    { 0x168A0183EB41F, 0x3A26158F4BA85, 0x6E5FCA35E52DE, 0x33531A512A3CD, 0x09EFC0768BBC8, 0x25AF5C4641C97, 0x04A6F0B5BB90E, 0x5D3CB5FAA49FD, 0x13049562DE0EC, 0x00E725949D6FB },
+    { 0x1562119966D4F, 0x29AB4DB8FEC26, 0x5BA4C22DF0AB6, 0x5100F8F6EAFE3, 0x74FD770AD5A45, 0x6CB32849E9F0F, 0x4BDEE3F6EC306, 0x2FAC6FEA69209, 0x4EEFCD5EC3D02, 0x00D1A8198D7DC } },
+  { { 0x2D6F83F001D56, 0x2412A95E41E3B, 0x2B89989EDDBEA, 0x17A8930252C06, 0x56B8129848727, 0x3D64892578C36, 0x6B95B25A70CD1, 0x54A2B652A97E4, 0x23635158AC0A9, 0x01AA5FAE6E7EE },
+    { 0x6F42786A8E24A, 0x483EB5689E0D5, 0x6D237065D5D2C, 0x4D1B06EF72572, 0x1D586EEBBA6A3, 0x13BB1C2881788, 0x5152BA5084D83, 0x7C2EFD187493F, 0x1FACBA090AA68, 0x00577C8562C7C },
+    { 0x333EDE2DB403A, 0x4E9CECCE285E0, 0x10F8733E77A4D, 0x6DB3163D75471, 0x71978F7A3074A, 0x12A3B75826BFB, 0x7B965EC20B082, 0x2D6E05BE8640E, 0x1BF4C78993D7F, 0x00ECADF3E7BCF },
+    { 0x65B3C72A7E4DC, 0x223C42B8A576D, 0x57898124C5E28, 0x68E2401FBEF12, 0x59DEE016C1C8A, 0x00540003C47D4, 0x18150DB1FD294, 0x1441459F3D192, 0x5B3CE35AC7391, 0x00E84CF695720 } },
+  { { 0x4AAC0F1E61597, 0x390B44F46354D, 0x20F9D9DDF2D48, 0x14F7BF2A4C90A, 0x785200502CEFC, 0x02918DA2C9FA7, 0x1B4A17AF1A006, 0x42B749DFCAF62, 0x2C204957A5A7E, 0x00AA449433FAB },
+    { 0x20A08E0497784, 0x57E0E2EFCF683, 0x327B58EAC4FF4, 0x7F52934C1D656, 0x113877435ECDE, 0x102F438F5CBF3, 0x376E6401A3D71, 0x781DC66E72710, 0x3D1163393B8CD, 0x006366A380A08 },
+    { 0x3C188273C263D, 0x715FAFAB60E23, 0x11E92CB253A30, 0x3FB2B98FB0280, 0x7751EF4BEFF67, 0x111AD79135130, 0x2E66E883E50D6, 0x508B25D1D565B, 0x3B3D84CDAE5B5, 0x0101E3034D51B },
+    { 0x500F3C24874D2, 0x405A83B5FD644, 0x3870D05BA6528, 0x43DFED86349B6, 0x25A677425FA78, 0x3A0F3AD295759, 0x016EB8636AB4F, 0x65F73A4D72EC4, 0x0D3B2B60A2C6F, 0x009F195C578F5 } },
+  { { 0x03F38101D3CAD, 0x1DD197FCE9FE5, 0x71DD0FD4FA8DC, 0x6E26C1D8542A6, 0x2993A0085F44F, 0x60372B7301EAA, 0x656B4FAE91902, 0x399F9719BE3A3, 0x595F191693842, 0x00A3A190549F8 },
+    { 0x1FC3B0D63BF96, 0x3A2EC7483FD91, 0x10146F8CB1B13, 0x5FB15A7D36A8F, 0x2C5F40CFEE1A7, 0x13378DEBDA490, 0x261ED70454FB4, 0x5B620A869D9DC, 0x410760FAC0B0F, 0x00124C8CD70B2 },
+    { 0x39A003AB4871D, 0x49D6759C95143, 0x7ABE2C7C0DA1C, 0x66D36F10B1421, 0x57136B4BB288D, 0x05E9FDF3E70C0, 0x411207F8A953D, 0x37B51B94C8671, 0x42438882E9DE7, 0x00EA2EB44F33C },
+    { 0x697D5D0888C06, 0x36FCC04C98054, 0x24EA21127A375, 0x0E664343ABCFE, 0x52552C0227237, 0x2F7ABBA580716, 0x26435C0B21750, 0x6E0747BE705F0, 0x5B62E9853FFDD, 0x0108C5281BC42 } },
+  { { 0x4F3946CA8835D, 0x3CA538CB1932D, 0x5720100CB9AF0, 0x1A43436732554, 0x34DE2B2E7C59F, 0x73269EDC50871, 0x6B9DA3674006E, 0x1B33D3F047E30, 0x5A367D2AA25C6, 0x006978597F41D },
+    { 0x5A8411D684434, 0x0388E01C0991A, 0x7804C41D47801, 0x4342233D1E0EF, 0x72050985D9F4F, 0x6CE806496F19B, 0x7E42DD1F260E7, 0x1BDE3EA56F490, 0x4CD366C3853DB, 0x002F52A543A59 },
+    { 0x7C4867BCDCCAD, 0x6E247949F4F3C, 0x5BF81E87A4457, 0x72A34474DA713, 0x2C2EAE769224D, 0x4C33C6A067FD1, 0x5B5443F071F0C, 0x6BC6C06F446DC, 0x04602FA2FB362, 0x01397F74F0B4D },
+    { 0x7C2E9D47E8BD0, 0x5A6E3A116BCE4, 0x6F3205093AD1E, 0x359764AD17A12, 0x49B94D6E138CB, 0x748F9B77A58CA, 0x0AE6B660345F9, 0x17A2A98002EA8, 0x0A0F7231F2357, 0x00E763DE961E6 } },
+  { { 0x7E95B0AB75F89, 0x19E5F2ACE8C59, 0x4538AC117A0F4, 0x53685121E6B7F, 0x51668B3397501, 0x2099A4C5721C2, 0x23E009207B349, 0x1269E18750A4A, 0x7701896CBEFA0, 0x008FE0F68C8A2 },
+    { 0x143E7C92CF3B4, 0x72663F0A653CD, 0x28FA123D10215, 0x1F43FCA25930D, 0x71BA9DE47E0A1, 0x13CDA1ED308C3, 0x1B428070BF2D5, 0x0E0896BE95DA3, 0x6188BC5491DFA, 0x002AF07009163 },
+    { 0x344E6822AFB41, 0x2DADB84121FAF, 0x16A4ECD149C1B, 0x00E21C4275096, 0x64633D4D098C0, 0x6D1155DAFFC77, 0x4E007E201ACD8, 0x30052BDF466DC, 0x0114FB880CBDE, 0x0116550C7D86C },
+    { 0x187F5F1AD2920, 0x40F12E78B5B4D, 0x5F5482133597D, 0x613ADB4A0C402, 0x6813AB14D912D, 0x6EAA309ACC1E2, 0x55911A5AAD3B1, 0x0EC1A9BF1D5D8, 0x2A84AF632EADE, 0x012491D508BA8 } },
+  { { 0x3C1FF722549CD, 0x121CAC8593115, 0x6C974FB857A3A, 0x753B4583753DF, 0x6658FD32D7F1A, 0x6C1468113F9E1, 0x4E1D4696F4BA1, 0x03B41F9F54643, 0x7D4DA6E4C4EC5, 0x005E5667E51BF },
+    { 0x09CD7E814F6F6, 0x1669F712503EB, 0x11EFF4EEFF8FA, 0x143D3345BF1CB, 0x3E681250A6A4C, 0x6813137B9E3E1, 0x6678B5D4B0E6A, 0x0D7AA5B79D2AE, 0x7FCB1EBA85312, 0x00C1924D14BBB },
+    { 0x1F34A6BB5DD59, 0x3CAD80814EF9A, 0x62D03661D4FD1, 0x75795E02DA512, 0x40EB71ACC2212, 0x159DCAF57B138, 0x142013389E61A, 0x5F24E618A1C9C, 0x73DEAC6D84347, 0x0149556C4C504 },
+    { 0x3CEB9F114801A, 0x76BC868F0E857, 0x514638F348DD8, 0x6B4BF87A41131, 0x79726EB501AC2, 0x10D1CD940F072, 0x243507BBCF6B0, 0x454DAA8EDA116, 0x5CA007C7FE252, 0x0137BE4B17D13 } },
+  { { 0x4B02DAE7A7EC1, 0x4DC46D6640141, 0x4A471A7A2FA15, 0x306D61F2460C6, 0x74D7EF878CFE5, 0x65BAD837383E9, 0x6909BA14C3D91, 0x463EB547F3FA2, 0x204FA99A92812, 0x00F2A503E3E52 },
+    { 0x4B28EC0A8F4F3, 0x212E44CB8F6C1, 0x295C564D7EFED, 0x15F7343624791, 0x41C0EAE11CB65, 0x7DBC4250D7CED, 0x0595B4D9BDC2A, 0x60A02F3FDA896, 0x3EECDBD82E042, 0x00EC31AC10D10 },
+    { 0x2CC13D96207AD, 0x435777E3E2B6F, 0x6506328AEBBBB, 0x523579A373782, 0x1869F1435302B, 0x4222816B4EDDD, 0x60E15210BA0C9, 0x456544783DC96, 0x1A56429FAAAB3, 0x0132642D201C4 },
+    { 0x44A56CE869995, 0x72518EE899765, 0x106638CA4A749, 0x00059C26DFB1F, 0x69981C1F830DF, 0x00A53E559B187, 0x7196706635371, 0x30C59BAAC69F3, 0x33C1DA4892D5D, 0x0111CC3F187C6 } },
+  { { 0x7BEF30C4E8CB9, 0x1699D57476132, 0x12F7AD18EEA54, 0x5B6299675F516, 0x167EC8FC419AC, 0x2379D958233BB, 0x2E745E4AD48E4, 0x6089EB9D57744, 0x0A2E592AD1D08, 0x01C995C095645 },
+    { 0x4255CA4AEEE14, 0x572FE15BD1CCE, 0x62C461DAEA400, 0x24BB86C078D76, 0x556DE1687B304, 0x46C1CB8419863, 0x3FD2199480390, 0x1247D54AFFAD5, 0x320A2782BFA31, 0x0087C114CD570 },
+    { 0x7AAE9E310792B, 0x0C4417C1DC3AB, 0x3006FDA019228, 0x5534EF0FC5992, 0x037F6725B4E2D, 0x36904B750864B, 0x7CF9A2326980B, 0x5B33ADBBDB6BB, 0x16B58628E1098, 0x00CCBF2975832 },
+    { 0x47D3689B00870, 0x45F5C7FD82805, 0x2E7358A57E48C, 0x3E6D9A7DA063B, 0x561D9FDF1C660, 0x72E0C864AD0E5, 0x5F14F50C63F60, 0x203CA11084DE1, 0x481544EC81D8C, 0x00F55649E464E } },
+  { { 0x0BD8B3CA3C5B7, 0x1FC8E09EB4EBD, 0x3DD470787D1E2, 0x0EFE49CE3AB06, 0x6A371AD2B08CD, 0x68EA7FE5AAFBE, 0x497E72666FD5C, 0x3F46FA31717A5, 0x274022EBBE419, 0x01C8586D6A937 },
+    { 0x14CCBD40C50BF, 0x3E35722AA7670, 0x3F5662B33098B, 0x367DEB471CE2D, 0x2F5D12EB4641F, 0x16B96E9255797, 0x5F1127CDEE6A6, 0x09C1512125878, 0x4BC769F0EDC8D, 0x00B40EF84B535 },
+    { 0x4094A9A5169B7, 0x18AC3495C5FBE, 0x7A21726CADFBE, 0x51CD8E7BA1953, 0x3476940D5A923, 0x5F2F52AF29793, 0x6826B809F9146, 0x7C112EB2E5D83, 0x1E75384168EB1, 0x011E663B0095B },
+    { 0x3D7595EAF8587, 0x1DDEF9A464271, 0x59A02E393375C, 0x343D065D1A1CE, 0x605A7196F03B9, 0x1F998E0FE1335, 0x5A30B0DE18E89, 0x6B30F5906DA7C, 0x2196F87F7DDAC, 0x00B881B742213 } },
+  { { 0x7ADC0C74E966E, 0x282AC2EBA7D66, 0x535348CFBC7C8, 0x24888726F16B9, 0x53248C86A8B6C, 0x543176DF430BD, 0x31ACB71A27F30, 0x281C5D7CFE061, 0x7F9EBC3920248, 0x00747B5553347 },
+    { 0x4D401EF6C33A3, 0x41A7D09304B40, 0x74BB2041170F4, 0x083E6CC5270B5, 0x2E03174024370, 0x68D276B784FCD, 0x7FA6A9CA8E668, 0x484ADF0206B51, 0x203EB6667F4F6, 0x005DC8CE6615F },
+    { 0x05AE0768F1E04, 0x0E318F7EADABA, 0x66986F92C6343, 0x5D0059884168F, 0x4FEDF3F9668F5, 0x6CEADA11D9D16, 0x331DB966D93F5, 0x1181A533CCEE9, 0x2353DFE201521, 0x012E9B660D8F6 },
+    { 0x4046572B34855, 0x6370EBBB48BB8, 0x5622BCF756CD2, 0x2A97937793586, 0x6BFC20104292F, 0x0301879B30024, 0x3E96D31F861A0, 0x40FA9DE8A42A7, 0x0695611C675EF, 0x00E84973977D8 } },
+  { { 0x2A9578E62A8FA, 0x499D21D934F60, 0x59967A3760163, 0x7D1ABEA760DC6, 0x78A2A60B41190, 0x017DD3C7F52A3, 0x2E4690B7E666C, 0x417AB7D4FA934, 0x0E916938A3337, 0x01208E63AD414 },
+    { 0x6EED9613B4221, 0x4E8CDA726FDD0, 0x1146989A30C75, 0x2447993AAF1BC, 0x7D42F1C210877, 0x05854AD4E8368, 0x6CEF27AB0EB79, 0x36226F14FCBB2, 0x43A73DF05ADA1, 0x0072A38A382C1 },
+    { 0x0525481F31F40, 0x65B0E0D169EA9, 0x2553ACDF4E3CB, 0x6275E88942AF2, 0x51523D3092D7A, 0x561B769F8B7DD, 0x23FC9CCCBBF14, 0x547E3CF7EAD15, 0x2CBE118B0C78A, 0x001F35F4F565E },
+    { 0x5458C5AEB63B3, 0x1B53AAFDB1FA1, 0x7BF12C7F09ABD, 0x286373FDB49BB, 0x745AE853500FD, 0x61A575B016890, 0x47EB442F28E44, 0x32E1211AF6CED, 0x7EBCE7CD7CA14, 0x00C72B0DA3CCE } },
+  { { 0x02121BA1A649F, 0x2B3FEF84781B2, 0x4F931068D5485, 0x0045BFDE380DD, 0x15D3F9E3CEFE0, 0x07F30BBA7065D, 0x280C08F8A9AE9, 0x064FBD17D5B2C, 0x435786928C789, 0x00EDEFBAB3435 },
+    { 0x49829AF20E754, 0x5EC162716A64A, 0x7CC74FE4A060E, 0x547820A6F4DB2, 0x3C8B90C1B3FD7, 0x4E73DD5FA5DB8, 0x6303927CF1848, 0x7D70D17BB029E, 0x41C10877424D4, 0x0087EFCFED929 },
+    { 0x46C17A9B9D1EB, 0x460C9978CFC5D, 0x4B98C13759577, 0x023EFFD86E344, 0x61F70FDEE52A9, 0x564695C642E2C, 0x5039503953614, 0x7A840F1A6251C, 0x08DA26D1AC2F2, 0x008D7A4D0CF36 },
+    { 0x1B54BDDF8D9C6, 0x4DB8BD0C50DF1, 0x5C24D50CC93BD, 0x3C28C9F504E22, 0x28A413B0AE180, 0x613494989B2E4, 0x0E53E569C9F28, 0x768DB8183C0F0, 0x57D9EEA5EC656, 0x00F9620463303 } },
+  { { 0x7AB67173A0070, 0x2CA5BEBB9D1B7, 0x6E828E8A017BF, 0x7E6326F8B4997, 0x0D1B3BD599C52, 0x4667B507A5A11, 0x612E79B9B4B1B, 0x12DB391EDB8E7, 0x451B4660E56BA, 0x00C28F81FDDDF },
+    { 0x66504EC04BFB2, 0x77CB1B00BBD0E, 0x45D753E7BFD5C, 0x38CE88FAE2C88, 0x6399719D8B48A, 0x29887D49020AD, 0x7CEA9AC43A4A6, 0x1240616AD841A, 0x717B0D025FA54, 0x00C33009C2D84 },
+    { 0x3D1160BA4C016, 0x241EC8DEC6326, 0x6309DAAE6463A, 0x4BBB8665F3479, 0x37849D800ED40, 0x2E4230A18DA09, 0x214B79F692C34, 0x632B2277A68BB, 0x503680A40A52B, 0x00433C0254A79 },
+    { 0x66C71B98E2C82, 0x4AA5A3F91E6B9, 0x582F0B1CB3A1B, 0x1CD5FDAC34C98, 0x49E6241A8DAA2, 0x130491348841C, 0x6F3650C490F5F, 0x5B80C8585088C, 0x53F8917A2BD2B, 0x00E9C7C5113B0 } },
+  { { 0x0DD4B0EF3AC53, 0x54221A025E3F2, 0x38C9CA6C80CA9, 0x48FFC2C1EDD08, 0x12282F4517853, 0x569138B0A61D6, 0x401BF4931F1A9, 0x017E83FD9411E, 0x38F1201166783, 0x0044F0E8000A1 },
+    { 0x3A0E067FEFEEA, 0x16A82A835BE95, 0x03CB3F3663B71, 0x4B355352AE00B, 0x3DA209A26DEDA, 0x16D43D9774B33, 0x04A816E218D70, 0x7751F2B41A31D, 0x327A6A48F572A, 0x004593174DD3C },
+    { 0x08D84475D9867, 0x2AAE2FD622E4B, 0x7D2AF4A13B6B6, 0x6334240E9E444, 0x631C87BA36E16, 0x420740570F584, 0x66B2B32F3D246, 0x2E77DCF478F50, 0x5B6C821EABB65, 0x011D985741372 },
+    { 0x672D399DB9478, 0x6171C4BEE6198, 0x6B39165902B17, 0x5A3350341CE4C, 0x707F4FD40D815, 0x40FBB16C9DC33, 0x1D972564CCE0C, 0x1D0F20C065517, 0x2F6C7CF6685DC, 0x0134CFCDC2589 } },
+  { { 0x0D3A4256C27C0, 0x246DD5A89FCBB, 0x55ECC0CD28262, 0x4A9D0A3ADBBD0, 0x0A099CE88D041, 0x33BA8099932D5, 0x6602D2888129B, 0x5ECEE9C5900E8, 0x1537F77D48976, 0x0050676AB3A60 },
+    { 0x606A3BAB3F921, 0x760C105BEFCA6, 0x45E3AA94C73B8, 0x40984EE0F22A5, 0x1651863BF5C14, 0x6652E4701F805, 0x5659DC2C331FF, 0x78CA551D28E74, 0x2CBF89C2410E8, 0x006E780949655 },
+    { 0x38B73E636B144, 0x57B9787D65D7D, 0x201C041B974B1, 0x608D0727C98B7, 0x64B73C56C6F68, 0x2DBCC4A9747BF, 0x79F6E4A8ED318, 0x4B1A71DDFC5EC, 0x0152B87BE5D4B, 0x00EA2AC6BD993 },
+    { 0x53730EEEF6E17, 0x42CE24A7B13E5, 0x1D6F82D4CBA10, 0x2FB4FB068C194, 0x3E9945AB49111, 0x2ADFFEB08F0A7, 0x4FB55CE23638E, 0x7233A9249DD64, 0x4831890F1D4B4, 0x00BDFF6063DAC } },
+  { { 0x38301F3E8DEA8, 0x7B4C11F74865F, 0x6ABBADE2500F8, 0x069B9B881CBE9, 0x32717C5726F77, 0x5C3578A2EBAB3, 0x7CB136C28CBF9, 0x16AF4BE3B1E1B, 0x7F006592369FE, 0x017C346B68734 },
+    { 0x00078252FBF08, 0x7D4A9E72771CF, 0x19B5F60F5C3FF, 0x06F947A3DDE51, 0x45F1A7F0C860A, 0x0A4945B2A0A8B, 0x1457593EEBBBB, 0x217F43E357B33, 0x39B958D7501B9, 0x001FE204D94EE },
+    { 0x393EC493DF9AC, 0x03E958F951DC9, 0x0338B913ED460, 0x702E1117D3D07, 0x0B78A841B8CA6, 0x66694BA79714F, 0x66A76536A3243, 0x3809DB6D0A337, 0x7BAC30E26FB78, 0x0087FAF102115 },
+    { 0x198BAB5EE9082, 0x678AC691EA51F, 0x106A9A5764B7B, 0x7C0ED45773E4D, 0x55F9DD957EA37, 0x68D5C40C6E553, 0x62C3C626D20BC, 0x7ADB63613B625, 0x4845C62927FA8, 0x0112DEC7E684B } },
+  { { 0x5724F9ED060B6, 0x6FB85C6E5708C, 0x6AE6238A5AFCE, 0x21DF346B1CD23, 0x19B7CF51BE7B8, 0x133BF8AA7E80A, 0x2755C4072143E, 0x725EC0A6729E0, 0x1188C0E294EED, 0x004DDC8C13A32 },
+    { 0x6153F69F58A56, 0x4387F9C497E9D, 0x527213C39B975, 0x0FA6817411BA5, 0x381B85AE01DA7, 0x6653D140AD14C, 0x1F5C4D327A792, 0x6351E4CAE72FC, 0x53E478964A4AF, 0x0080E9E09B42F },
+    { 0x119F7E05E8DDE, 0x657F498D3EE69, 0x281B256819B50, 0x1177FE8EBF8AD, 0x395DAB64EE053, 0x006D092623CF6, 0x14B55813F24B7, 0x78F9BFB863DFF, 0x2AD1F0B2734E2, 0x00F6886505EAB },
+    { 0x6C882E7583D72, 0x416C67A867421, 0x5C3DF3598F786, 0x28617EA1F0AC9, 0x1C7346556470D, 0x0A8124FDF2238, 0x67988E895645B, 0x76729954F1DB5, 0x441AA039A0AF0, 0x0092CADBC0519 } },
+  { { 0x0C1817405145C, 0x27A8D09959739, 0x25932CBE46AAB, 0x37C0FC765171C, 0x27BD528A9ADB2, 0x0F8A0D8E23B5B, 0x309C11AFC9244, 0x2B34805D21477, 0x375FEABEE037C, 0x01636533D7477 },
+    { 0x20AFC2BF1C9F3, 0x40A802BE891F9, 0x38B40B4020BC2, 0x4B5FAEB8399F8, 0x539C08A47A021, 0x5491072E92EAD, 0x5B5C4F9607C1E, 0x41C263C1626C0, 0x06426629C1FFF, 0x008AFA72C5885 },
+    { 0x3FAE7AB41B540, 0x5AE17C1937DC5, 0x0A8695CB4E121, 0x531B702E20462, 0x7CDC63328D8F1, 0x0881EAF20FFA8, 0x2168BC993659E, 0x60F594F6E88F4, 0x55A171974069B, 0x01278D28E1D2D },
+    { 0x2A65F8ADCC4EF, 0x0B0E43D4DF1CA, 0x6C97A5AF0ACA8, 0x3EE604B69EDCB, 0x5791638EEC023, 0x42704CBE65EE1, 0x6371428F601F9, 0x6A83D3FD49602, 0x1477E30C3F7AE, 0x012249A4B840E } },
+  { { 0x0C06106D371B2, 0x4DCE9D7AC3F95, 0x6802EC5C9844B, 0x2C5D44534F420, 0x24940C4E79F4F, 0x3C55EB5418928, 0x27E5818A9AF3A, 0x73058BA34D095, 0x57DF2AB89B942, 0x01A5082B41E71 },
+    { 0x6BA04AE94CEBF, 0x420C5C3F08D49, 0x7E5B357E86849, 0x7E96F33E41D64, 0x24103536A2652, 0x647A4953A7B76, 0x58B1B765FB536, 0x7561F51ADF9EC, 0x577401B6E04BF, 0x00784C7034C9E },
+    { 0x01A5AF22F62CA, 0x0D532996196B1, 0x63F189CD2CCD6, 0x60DA3050158CD, 0x37299849029AC, 0x414732272F380, 0x76172FB71BF9C, 0x6434C8BAA9558, 0x564065C89CF76, 0x0158DE38A8F08 },
+    { 0x5ABBB27DE78BD, 0x4EA613DD2C9E2, 0x137039814A3C5, 0x1F3BBEA467AD1, 0x5048103D02B64, 0x55AFFC7EA2081, 0x79C0756132C3D, 0x7F8D45354A39F, 0x408CFC206BE2F, 0x01712528BDDAA } },
+  { { 0x293BCAAB684E7, 0x7A182CB93AD5B, 0x5423D0295CC39, 0x5E30DB7954E91, 0x1685F1B0DDCCF, 0x0081246AA8193, 0x1205B07374717, 0x601E8E47E3F94, 0x7CA2E7A48D637, 0x00D2DFBFCD182 },
+    { 0x67B62343E6037, 0x491E2BDB615B1, 0x790408F8D820F, 0x0106B894B9BD2, 0x550B464E73E21, 0x5216C7A4BA32E, 0x4340DE1072A68, 0x082E26F9C73B7, 0x0CC922FB8C8D7, 0x00C81734E39F1 },
+    { 0x2178D9325BF6F, 0x295A2FD0E8B7D, 0x0A0176F20DDA5, 0x5BA1D0184690F, 0x393F0436C5FF1, 0x08594531F8B59, 0x7E5D79966DD6B, 0x57FED85A6F3AA, 0x1FA0AD83C3C4E, 0x0124173A6EC65 },
+    { 0x5F733A91A6C7F, 0x12B98CDC518A1, 0x3F6079F0995DB, 0x70CF7463C241E, 0x00342228701DB, 0x5A71969A81388, 0x1479762E1DA9F, 0x1D8A92FEC5F8D, 0x5C0314E561615, 0x0121CE6F00756 } },
+  { { 0x575F9DBD06E25, 0x291CCC1C165ED, 0x070DD9F4D315A, 0x70D2E9715DA33, 0x7CC502E86198B, 0x032ADD198B8B8, 0x143428D223A9C, 0x350ECD8D962F2, 0x1CA97982E31C7, 0x0115DE9D1F329 },
+    { 0x19E452E1F60C1, 0x3CDC012C2C158, 0x632D867AF0563, 0x1D844CD1D5565, 0x1F9F10DDD6243, 0x5F41BF4ECCABB, 0x5F82833B81E6A, 0x63A2C8D4D0CD2, 0x6469ED938ED6B, 0x0066A01DB5B42 },
+    { 0x6ACEF85C9DF39, 0x4E43C523B7B2F, 0x5D74A67335E4B, 0x48FAB9CC630BB, 0x08444332B2D72, 0x41EEAE940A299, 0x207068817692E, 0x43CA7D9B91AD4, 0x46F7D3E4E655A, 0x0169B35C9E3DA },
+    { 0x29CFF778F78AD, 0x488A76F5EBA3A, 0x3A877395C4784, 0x0B5CAAE6A690E, 0x1BD4BC167B154, 0x4FAAED0065854, 0x075F2341999F0, 0x4889D4354CFAA, 0x523A498F27B9F, 0x013EF935CF4F2 } },
+  { { 0x2711DBAE7056E, 0x55625BB45A2F4, 0x672E5CE132D49, 0x1818E160A8350, 0x11940568DB234, 0x037F1050927F0, 0x3D33E6E1E61C6, 0x59DA76184F4C6, 0x4D704338ECEE4, 0x0116DCB0B3CAC },
+    { 0x1810C3F17B2C1, 0x54A8E2A06A311, 0x37A02EE18CF14, 0x4C372F8DC0225, 0x20A8D4DF28337, 0x3CD1DEAB5789C, 0x3D0B05E6F2A4E, 0x6C58FC26BAE5F, 0x26D5849B28A0B, 0x006A7301515AF },
+    { 0x1D1E5424026F6, 0x179C1338D0390, 0x737F9754FD07D, 0x19578C7A9824C, 0x2B73328001F5E, 0x0C02474A8A57B, 0x168E5A1FEFD06, 0x032B5B3D18ADF, 0x680212A4F4DA0, 0x00D1B7BE08E54 },
+    { 0x4A39BAE76C587, 0x128BA6C04338A, 0x3349A09550F07, 0x314DD45F96E5A, 0x70648B4A8E77B, 0x67363A4CB9932, 0x7224DCE87AD42, 0x6D983A5D743FB, 0x48F8DF9321A49, 0x00D8F337DE20F } },
+  { { 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x2BFFFFFFFFFFF, 0x0B7B44423CF41, 0x21EDF9F6BC4C2, 0x3BD2680DCDFB6, 0x61E6045C6BDDA, 0x0080CDEA83023 },
+    { 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x2BFFFFFFFFFFF, 0x0B7B44423CF41, 0x21EDF9F6BC4C2, 0x3BD2680DCDFB6, 0x61E6045C6BDDA, 0x0080CDEA83023 },
+    { 0x13F3DC34028B7, 0x7E319E61B1BC8, 0x522B4B82C9628, 0x31F54C76BD22E, 0x3D45DE6A1E991, 0x737DFD05F3E42, 0x30AD94B75E9F5, 0x16D9FFE01E378, 0x2BCAB108D5927, 0x00BFF65D8D02C },
+    { 0x26E4845BE810B, 0x376F9EFCD27CA, 0x2CF72B30F1004, 0x495A123DD9D1B, 0x1686EB5CD85DB, 0x53C6DB1B64F3D, 0x4FA204E20A77C, 0x2919DB2AB1EB5, 0x242CFC1F02A34, 0x014A68BD69357 } },
+  { { 0x78AABB3F2F5EB, 0x5115B0DD2F60C, 0x7FF8F6AAFE28D, 0x49B9B6BC61FA9, 0x5BC33DD74A029, 0x7491F6DCA52A2, 0x1CE18C4EAFFD7, 0x479E8DA969151, 0x1FE6ED337122A, 0x0082810450870 },
+    { 0x716073B77171B, 0x757C98D16526D, 0x6F7D353E85120, 0x04B1D65CCA528, 0x58AB35F5453A0, 0x3923D2925094A, 0x3CB90418BC59C, 0x32B7C9BD02F78, 0x605F7EF54CD4E, 0x00E927F2C4544 },
+    { 0x075544C0D0A11, 0x2EEA4F22D09F3, 0x0007095501D72, 0x364649439E056, 0x543CC228B5FD6, 0x395B1A2C4EA62, 0x6AD65B8C41330, 0x27AB128DCED87, 0x67B1243E3E53F, 0x0180B6A5BB81E },
+    { 0x0E9F8C488E8E1, 0x0A83672E9AD92, 0x1082CAC17AEDF, 0x7B4E29A335AD7, 0x5754CA0ABAC5F, 0x74C93E76A33BA, 0x4AFEE3C234D6B, 0x3C91D67A34F60, 0x2738927C62A1B, 0x011A0FB747B4A } }
+};
+
+static const uint64_t ladder_table_B[OBOB_BITS-1][4][NWORDS] = {
+  { { 0x515E84AD0A596, 0x744B13EE7C171, 0x1DB73F6311F94, 0x2A82B6E3931FA, 0x509C76DF73F08, 0x68D37C571B8A2, 0x2574B11D1140A, 0x075498344DB38, 0x7271014C010DF, 0x006EC2D5CB251 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x515E84AD0A398, 0x744B13EE7C171, 0x1DB73F6311F94, 0x2A82B6E3931FA, 0x789C76DF73F08, 0x4865784C89CCF, 0x3D8CAAA830EB4, 0x347FE3B4A8853, 0x7AADB16AE4A19, 0x0108FC06C9991 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x57624736BC626, 0x0F045A2560577, 0x3F751DBFC3065, 0x7240EA03F329B, 0x128393DBC70A8, 0x42A18AAC678A4, 0x6EC643A7AF2B5, 0x180DED246D6D4, 0x58574BD5D67F2, 0x004223103910D },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x20A220322E300, 0x7BA69AE44D82A, 0x08F33EB0698EC, 0x4847A29D61C31, 0x582328335A51C, 0x1CCA7112608AF, 0x057AB1137606B, 0x534CDE8EF4D6D, 0x15A08133F68AC, 0x00D715B9FEE13 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x5E30514A81C22, 0x67167047B2D91, 0x4012EA13FB8FD, 0x33AEE49844014, 0x57E81963E735D, 0x5D762590031EB, 0x091CC35EDB65C, 0x72111DC51D3B0, 0x7901895161792, 0x017F05537AA76 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x1A430D36F90D4, 0x18546D5991146, 0x07BEE8EA8FE51, 0x6BA49FA1F7207, 0x796FB26402691, 0x2FE9AD0DC1217, 0x75DE136049E7E, 0x519E974A3A0BD, 0x34C3B15821F61, 0x01353BA61EE55 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x63C8464CB6951, 0x4640DAE81DC60, 0x7DF060E754E4B, 0x034E1ED786810, 0x78663D9BD53DC, 0x45767EA208C0C, 0x782EA082D322D, 0x3ABFF1980071B, 0x20E39FF30B9E7, 0x01A9542CDA7E9 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x4B7A212E50D61, 0x093983715D794, 0x4D9B53A32665C, 0x22A5DF69BF7B1, 0x6BF81D19507AD, 0x112D02E50C703, 0x2F0EE9FFBA289, 0x6D4D7E8440067, 0x5DFDB164BF36E, 0x00F9E5E37A225 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x37096B8F7EC1D, 0x2953628A83724, 0x14C6132050488, 0x467605A28E8F2, 0x48775C087988B, 0x44CB6329423B2, 0x53E9061AFB9C2, 0x481309075BFF9, 0x5676B845D46BF, 0x01A58BF23064E },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x4115734C6647D, 0x05F68FDEF70B1, 0x42485A776B9FE, 0x132052B0D38B2, 0x6EABAE316CC0C, 0x624F3FAB63E50, 0x3C15D48FFA578, 0x455C1A6E1E3AF, 0x3C4E9132F906E, 0x010BB9486682D },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x05ECF495A4815, 0x6EBA2069A6280, 0x2717BEEB1D825, 0x0447ECC5A55FA, 0x559D5D4B2568F, 0x28A037F6A22D0, 0x51BD960AEA6D8, 0x7EEE023F6DA3C, 0x7BF9032EB9853, 0x0173F1A22DC16 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x7B33A8F606A77, 0x590391FC5D5A8, 0x08E962E00DFA3, 0x2385F3047A72E, 0x727AD63F6A155, 0x2566A4FADD772, 0x277BF216DA12A, 0x44B8ACB75A208, 0x4B7877CC32931, 0x013C1A45E4260 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x3367EFE9B1F49, 0x0577F93F87A6E, 0x7292668A14377, 0x45F57F5DFAB50, 0x66E9F3586FDB4, 0x4F1FE2D17DBD3, 0x4A2CD47E19CF5, 0x0AD281C439CA4, 0x3113AA49311BD, 0x018B48CC93B5A },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x7B839AB003FEF, 0x63CA4F676EE1A, 0x30D49F6CF97E8, 0x18A05024AA4C4, 0x2FD718A8F7AE0, 0x35730A2545A0B, 0x2124C7ECEB9EF, 0x3D7BFD3B0A216, 0x54CC3B1DE3AF1, 0x0130D3B6BB423 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x095EDEBD1492D, 0x404C060B8AF04, 0x266D9A762B879, 0x401B996902FFC, 0x390929C84D142, 0x49D66BD2B3719, 0x7BD643805927A, 0x49EFED9059F78, 0x78E56EB94F1DA, 0x017CC9BC18375 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x6D43B5688A093, 0x5414DA2927F8C, 0x1E383CB7C0756, 0x0668E1345903B, 0x1DC75F679CFA0, 0x5DCE122CEC75B, 0x6BDAE593FFFEC, 0x2221469F70CC7, 0x475859FD4FE78, 0x00E2A6C81DD9A },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x52B04D127E18B, 0x0D716F3D7051E, 0x1F48A893F02E3, 0x30829A0830E07, 0x262CFA3399677, 0x6E7DDF8F017C6, 0x7BF6846D0BC62, 0x1A43A3A751CCC, 0x740BEB62C0DA9, 0x015E3920CB989 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x494C60E9AF145, 0x654D89AEA4877, 0x1DD6DE6CE37B1, 0x130642B19DE59, 0x3DC15A121D5B1, 0x2B57131AC2010, 0x1B3D4C3575C38, 0x2E35666F8F994, 0x3C30732F59F20, 0x00BD500DD1515 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x6F0BBCAD70923, 0x13C83D47995B0, 0x44F1F8AB3E50D, 0x0E7ECB1DA3984, 0x0770A7634808E, 0x028FBEDC9A3AB, 0x77E5323AE9C21, 0x1AE42CA283587, 0x73DE9550F55AC, 0x015AE0BE82181 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x4EF25E378A655, 0x1DC028E7E0BB2, 0x34A22E42C0990, 0x03CFA5813DBEA, 0x1434FDE6B7728, 0x5BD82C52EE8E1, 0x762A21DBADB50, 0x695D1327A7810, 0x675A6BF593FAD, 0x0142F22CB2FE2 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x3920CE1B0664F, 0x7064AAA1F537D, 0x15184DD27A205, 0x558E378A55A0C, 0x7C3FBCFA9DD15, 0x20CE94928066E, 0x2B6F3BC8AB63A, 0x5A0200820B340, 0x3FC81E8DA065C, 0x016E072D705D1 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x12D493CCE4D09, 0x059B3388B2285, 0x7E622C5DF81F6, 0x2A4A3EA60BD02, 0x14C7C1492D18B, 0x3AAEA036CF83C, 0x102CCBA489B55, 0x15E8AE92CDFA1, 0x3D8869130A8E2, 0x014AE84E29B49 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x70B8600627063, 0x4ECD4BF597805, 0x4A8F009F4E6DF, 0x66383A705B748, 0x5AC3E8822B157, 0x11E0165748C60, 0x6F8E4B30C64AC, 0x05BC25A92F917, 0x647BC98B26732, 0x017D28040F4CC },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x6013DB0F18811, 0x4F481E1EEA46E, 0x1BFB0A3818A1D, 0x0A53974851A8D, 0x051BF53899813, 0x10201DFD87859, 0x41AD094B65F00, 0x4F3EA4DA0D61A, 0x432CCF480AE09, 0x00A18F4D5CE5F },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x6E2C684E31048, 0x6A58A361A77AC, 0x0D5141B1A50C6, 0x53DF042A503BE, 0x159F328EA7564, 0x14D6129003D91, 0x6458F423F5840, 0x5C233F921D829, 0x66CF43A9F5D4D, 0x0189CA2E9EE4F },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x546067B8E7110, 0x2EFE5F1125B1C, 0x3A3BB82011123, 0x6C0DB4B592FE3, 0x4F467EE48A5A3, 0x69AD63CA3612C, 0x2ADE3D5232CF6, 0x7E31F94246D41, 0x42660AA574991, 0x00E8C964BB0F0 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x33EB0D1E3ECB5, 0x1A79EE4F91380, 0x5C386BCA46A43, 0x781BB79A61CDF, 0x57DD9B088AF7B, 0x74AF27FCF9515, 0x0546F273F54CC, 0x51BF1C1D39B35, 0x07B3AB6698751, 0x015CEFBC94719 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x78A30CE09B3E7, 0x0F90D31F04861, 0x7FA0B6B95506D, 0x4DC83183983B9, 0x6CEFF6CDDF96A, 0x62DA7D737E903, 0x7DC1360EEEA77, 0x13CBB5B2BCB32, 0x21D94C8C5E762, 0x00A6BC6032953 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x2B96841AB4860, 0x470F8A7F78447, 0x7CF99B26F45BF, 0x6DECF70843200, 0x1C509B64BF41D, 0x3C1F4EDE76FD5, 0x32598F90C9A87, 0x61CE21C3DA852, 0x3EA13B09091E6, 0x01968F43D332C },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x4011FC4A1A8E2, 0x38713D0335D0A, 0x547A4886E19FB, 0x15508C8275773, 0x71F1F00D8A6C9, 0x61BA6E1E23E12, 0x3EADBA2809C65, 0x768E054105DB0, 0x74AF95384C271, 0x009BDEF4714B9 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x3BD3F460125A0, 0x12403B18D0844, 0x4A5C0E031862E, 0x4ECF8E78DF446, 0x157ADEAC93590, 0x13E84C7662D53, 0x208AFFD13FAF9, 0x5763F2316E7C0, 0x7BFEA949510F6, 0x018E729CD6073 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x0C8C131B92FDA, 0x18A4931574F64, 0x4468D3D69C6EC, 0x1328B7CD43ACC, 0x3E526A8874A26, 0x4FABDC4AB7454, 0x3B48B47FEF6F6, 0x1BC09E10A04A0, 0x087D84E235E7D, 0x0109E1F055208 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x5CB43DF4598F8, 0x5C19649C81194, 0x38D37B1287A62, 0x5F5FE57A581A0, 0x5CEF8FAC70457, 0x514F6AD28C14E, 0x3374A87EE0D11, 0x02A3B34AA45AA, 0x64CDB9F39BE84, 0x017B53C91AD6B },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x4D405DCE20684, 0x094CC8870516B, 0x31CDDA9731726, 0x128466CF2D968, 0x1F94F67EB44EE, 0x54A0543A6C454, 0x776E2C0DA5548, 0x20E2E2ECBA43F, 0x5E0D106A7D6A2, 0x0156B385B4BEE },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x11319A1100EA4, 0x0478E017F1151, 0x5D192771A0D2C, 0x214F7755177FD, 0x74EB8CD9408E8, 0x2749F190CDB0D, 0x2F90A294DAE69, 0x587DB779D6FAA, 0x23BFED9E249A4, 0x01A8BD6FEE372 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x5659D7DDC1204, 0x762E70ED93619, 0x01D4C99E99CCC, 0x21CEE9116876B, 0x2DF76CA287F42, 0x1DBA8E9081A7C, 0x393FD58289288, 0x0697D4202F661, 0x0C32CE395F02D, 0x00E12A4900F0F },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x04D14D88E7864, 0x67EA1696E56C5, 0x377FD1F1992A4, 0x7F90B28A7D659, 0x5A318F1815412, 0x2400698E7F950, 0x392D61105A4A2, 0x410D1D90B46EA, 0x1FFFFA047D626, 0x01BA8C536591B },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x3A4A0167C44C2, 0x715E39F474928, 0x6D62666D16DBF, 0x117766631246C, 0x6D50E2FA5F179, 0x6D6745A8A7527, 0x2B47E59C3DFDD, 0x57CAB986ECB0B, 0x58B17C30A663D, 0x0104A08FFD171 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x7B0182C7D7C98, 0x01A63C409CDA5, 0x47C0BB020866A, 0x1FA5DDAD2437A, 0x37B902EEDFEC0, 0x00A800FAC5D44, 0x40D686925AFAA, 0x7D33CA2AE19DF, 0x6BC201D16590C, 0x01789AADBCB85 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x13B949246212C, 0x182EB85F98A83, 0x29C53F5A9CC5C, 0x391D79C154A60, 0x5CC9BAE53FE7C, 0x713CA0EDE6ED4, 0x603139E8CE74B, 0x2426F7FABAB61, 0x4E4764863FA44, 0x0154A64CBE6BF },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x2D55670850E85, 0x191B6188A4217, 0x52C70C92871B0, 0x2A372224A95FE, 0x7E1C0390B4ABC, 0x32E85E25A3C5C, 0x67205793CB8C2, 0x42329D4FE0BCC, 0x64A4DA894386D, 0x019011D6398EB },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x0E2AE47F93443, 0x31BD5177CD711, 0x34C307C3593E3, 0x18F7E4B9475C7, 0x346734B127D00, 0x6987AA414CB35, 0x1B3C092B286CB, 0x62A13AB313EB3, 0x08A43FE47AED3, 0x017297B43FEA0 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x69BBF6494FC32, 0x2DACA29C28B0F, 0x59D2D4972723E, 0x7F19A9B55E27F, 0x2A4EBD1A547F3, 0x51EDBA89A3026, 0x53F814D86D4ED, 0x38ECC2247442F, 0x771D64F68A8D4, 0x018B442A27843 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x4B02B41AA82E2, 0x48C0DAD21ADD5, 0x30A385DF40208, 0x5FCF6865E26E1, 0x6775BAE53ECB3, 0x34DADF0E25BBF, 0x2AE157487A180, 0x67EF3868F5F5E, 0x02C94C768CBF1, 0x01285D8850219 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x7BE03A5C20F0B, 0x6AF2BAC82D137, 0x412AFDDF01360, 0x307064042349E, 0x114566719BCFE, 0x007D58A6EA66B, 0x64120D4130AC8, 0x26D51C486C6DE, 0x0AC84351D20D8, 0x017CD9E7F8397 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x46FB4DB47136B, 0x5D5D2A490E3C3, 0x135B89634F2DA, 0x7572FE36369A7, 0x148030C42EA1E, 0x061633FE3A786, 0x45503DA7F37C7, 0x3501207CE0614, 0x73FB8D542131F, 0x017591F6B399A },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x7D2D4CD29154C, 0x410D41CAD736B, 0x2546537A1689B, 0x54945A6893CE7, 0x73A960F77D47A, 0x55843DA2FBA6C, 0x6CE67BEED2744, 0x11F4A3388C6D4, 0x6734330AA19EB, 0x017BCD51B5B76 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x0DAF353A8EDB4, 0x1D496E19937D7, 0x1A45CD6CA5CEE, 0x61D4C2CC2C3D9, 0x25C216E05C806, 0x2D35618FF77FB, 0x2B0D125FB60DC, 0x60F22AE9C48C1, 0x231658D1E6DDB, 0x00A45D5EB9053 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x7D21708140068, 0x4BDA0879A3CC9, 0x2332559B03771, 0x22DA0EE598E70, 0x36BAFD5256211, 0x5D3418D2207ED, 0x0C2A2B60A5FD2, 0x009A86B4A0A1C, 0x2711AD0E35F2E, 0x01A58362EE6E7 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x0B4C6D47B3DCE, 0x5727C14EDB980, 0x07FB1EE3B9A61, 0x2BE567607A358, 0x1EE357E8867D1, 0x12871476E3C71, 0x2743B94BCBE95, 0x3694A9C1B9692, 0x5E0E9C492BBB6, 0x015AE439C624A },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x05BBDFDFBF849, 0x288EC99BFD5C0, 0x0489907DF5966, 0x118FC8F29D6BE, 0x7162DEBA35387, 0x28635E2B72C2A, 0x55D0BE86E3A08, 0x35B0A4B9DACCF, 0x4454AAABDF11D, 0x01795944B83AA },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x6605B1725B979, 0x1B1EF04140D3D, 0x7F34155E57609, 0x3E0B4E03E625C, 0x49B18299EA1E4, 0x53B1D5F4FF8E2, 0x4132E45B9B543, 0x5FF9051C1AE4E, 0x706715A84B585, 0x00F00AE1C9ACB },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x0C052BF0FB817, 0x5A62BAFEADB40, 0x6927276365701, 0x7270E944583C3, 0x748CC5AD5A7C1, 0x16ABC9E9917DE, 0x0108542CA0376, 0x7A542483109EF, 0x4B796428F83AF, 0x0150691EA31CA },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x23BC62852EBB7, 0x2343969DAFFA6, 0x7DECB7B487D67, 0x709ED91B0E460, 0x2D071C5A6203E, 0x1BD3353AB8A72, 0x1BB09E17B9C8D, 0x3BA77735BA183, 0x2F452C432FC48, 0x00C44A4FDA107 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x37537580E1DA3, 0x457C0D38F3805, 0x7BEA848999D37, 0x4AD10268597E0, 0x671DEBF4AC80A, 0x2F7DBBD6FFD23, 0x4BE469EDD73EE, 0x40EE150A88FC2, 0x0399B88DD74B8, 0x01E90563FF589 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x28BEECD66E93D, 0x1D20831FC9764, 0x50CD8FF314501, 0x1EB7CBCEF2253, 0x38F2C6529AAD2, 0x599DA09F29687, 0x045A5887F11AD, 0x0764763F13654, 0x2740A55C9FCCD, 0x0104E4A51878E },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x15A132335D3C1, 0x09EC5A9C46CDC, 0x1FCDD774A0E99, 0x7378501459387, 0x063E38430BC1F, 0x055903BDEB1FB, 0x483A9F828CE95, 0x6D4825E36F917, 0x01D42C7495DD5, 0x01482E8264A53 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x609295CB51A73, 0x4DB3BDDCD462C, 0x72FB122E4FAB2, 0x635F05F729EE1, 0x2E955A87CBE7E, 0x231F9620F7CCC, 0x47A44C612A8D0, 0x6DEADC01A279B, 0x72D8259D15F45, 0x00EE489DC86B9 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x6BF79D7791DF3, 0x6AB9828FABE55, 0x0651A6AED3E37, 0x48910ECAE976C, 0x13D99399C35C5, 0x00C8936C2977F, 0x5FCA707AD3A66, 0x43EB48A8A7C4A, 0x4E79BFB820156, 0x016AB3CB87913 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x605EBD3E3701B, 0x3D30B5DCCB804, 0x0A1381FF2FA29, 0x1F0F88FEED929, 0x721F7D3D2B423, 0x23347D523B374, 0x0B124E4753F0F, 0x2630AEE2E1170, 0x10E4F96FD783E, 0x00C8CC7E2B176 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x382F6DC73A338, 0x1F184520FC37D, 0x608A39A2B81D3, 0x0C8E4A0657EBE, 0x78FE8BD45A76A, 0x519635B9539F1, 0x0DCC53992FE8D, 0x1A2875091E24C, 0x4EE44ED1BD8E7, 0x017130BA16929 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x65BA5CB69A574, 0x31946F9100DEF, 0x0DCF0A1E3266F, 0x1664D133051EA, 0x2862F22266247, 0x0FBEA02853399, 0x4C932EE0EFEBC, 0x4A759E331DFE6, 0x4FE749F668CAF, 0x00CB18E35F2C1 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x7378AF4E59453, 0x2A728A9CF310F, 0x374C59D913817, 0x3310E066EB12C, 0x32A480B46CD3F, 0x0B2618EDEB982, 0x1274C00144CB8, 0x691C3CB9E3B4D, 0x3AB2C40E5731E, 0x012E80D0226E1 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x6F43174A012E1, 0x5F9E37B17DE19, 0x379E5A8F11D34, 0x49395ED8EF16E, 0x7274B9C3C34AC, 0x1B4E6423A591A, 0x55CF1F47EE541, 0x053D38630D116, 0x611E88265A351, 0x01186A09CE245 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x2618754B1CC50, 0x4C5E519F36FD0, 0x38BF3D1006DC9, 0x34346DDB0B635, 0x4F88A2CE11CF0, 0x056130A4E4ECE, 0x1C4FEE79E349B, 0x06B457DDF5AD8, 0x3220E92D5B86C, 0x018ADEC55D48C },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x31A6BFAB85140, 0x26ED4B100F221, 0x1B0140DDE26B2, 0x08D33308A4A12, 0x42C3D58AC6056, 0x33A918BCDE5F8, 0x2E7F15AACEAF5, 0x3468B493C68FC, 0x488520699EFFE, 0x00BF5BBDDE079 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x7EC24063B9566, 0x5371F20D982BE, 0x13F78BCA9A6F5, 0x274651DEAE321, 0x0A19B216AAA52, 0x01F54684FE184, 0x617F44CF1463D, 0x517028E0BDC99, 0x62E48A043FF1A, 0x013C39A72AFEC },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x3E17955246384, 0x1FEC0E5ABD91E, 0x1B38044EC1852, 0x33F1D61283DEB, 0x50BD3D8376D0E, 0x4C0AA5E389F4D, 0x1EC72A6BFD084, 0x2CCB4A740B14F, 0x3CEB25F3329AD, 0x00FC051829EAE },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x4F3CF4658B7E9, 0x548D94E8B2015, 0x732074327952A, 0x55672C974DF06, 0x64064B008B287, 0x1235969A6DAAF, 0x392213A30B8F4, 0x6BF5C24A1A136, 0x25EB89B725749, 0x019AB1AA04DD4 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x72DF9FED42233, 0x1800C012A6BCF, 0x0F3118BED0190, 0x787F8D321828F, 0x2C7A1721C9CFC, 0x0E811E866E89F, 0x60174E9EFFBE7, 0x5DFF952752974, 0x343CD78027D7C, 0x016133087E057 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x77B65F0AA87BA, 0x3085A0F7AF7D9, 0x49246DF127183, 0x68AF29BF2DA9A, 0x294F93F634238, 0x187BB065DB78A, 0x6F70FC4B236E5, 0x783241362C99C, 0x569A50E6D4EC2, 0x01998AAD8CF2C },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x10B942C481776, 0x1D38287FD762E, 0x056629B9C2E50, 0x4DB14F30C5802, 0x7DA43B4BED072, 0x4041D5804798F, 0x20BB1C811FDE8, 0x46CADDB408339, 0x32918A1190649, 0x00FD080F20346 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x0B45B5FF2969F, 0x6DD793B4434AB, 0x1ED8383A76442, 0x15874514104FA, 0x5243CA69AED39, 0x57C9784D1E069, 0x242E0D5445B13, 0x780455FC31EB3, 0x04F3D6A2F6051, 0x01E1DC55F8A33 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x0D16DC4C572E3, 0x27192C741A255, 0x521FE4A7F5053, 0x00D28F462FD22, 0x14C21689F2FBE, 0x4140DDED41712, 0x228FF9C89583D, 0x105D22892BA0D, 0x498A79E3E648D, 0x00EA3EFA28FA9 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x5B60679208B84, 0x69C4562987DA2, 0x0B07EE53A4D5C, 0x597354996FAC2, 0x00E7069C4A891, 0x29CD306088189, 0x32B1D64028FAE, 0x208C77B71888B, 0x53525E5DF86ED, 0x017840805A16E },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x45C99D773AA70, 0x7E8B56DA8B866, 0x22907A9404880, 0x0793FA4C643A0, 0x469611F413B45, 0x2081388E90214, 0x0E0A8DBE3353C, 0x3A7F0877C4B0D, 0x637D1E1E561FF, 0x00AB33E7A2C87 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x3D824DC78C93A, 0x6A1E510E4A1C2, 0x7F910ED4B4678, 0x64DE16D8A08F8, 0x142C1449432C8, 0x7D7C16173C727, 0x5F9D65C8C1877, 0x558BB9974CDBE, 0x0B7FA9917D633, 0x018F86D054E31 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x3D874DE22D37E, 0x5158FD30F68F4, 0x1491F85107732, 0x37A2828EDCC1F, 0x5002024CD0151, 0x6D5C2AC2AC1D8, 0x1FD3E7BB79808, 0x6CFF043966AFD, 0x1BAF7A8C8AC87, 0x0093F62197129 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x7EFE1AD07B828, 0x480F7C94BA901, 0x5230E0C121083, 0x0A6A4F4A081C6, 0x5439FA49D198B, 0x36F7B659C4306, 0x7C589D7BB9876, 0x37E33A1CDBB67, 0x07CC379B0EE90, 0x015457A07A440 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x1638323DF9156, 0x5A7A39EDD8EB3, 0x42A7275F79509, 0x1A3926B8599C6, 0x3526D8DBD3849, 0x41339F4E13626, 0x79A2EA2592C47, 0x259C12982E105, 0x3BFD5F21151A7, 0x011A148CC3FDD },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x75769EB0CC3C2, 0x03AB61FED6FF2, 0x67F4C219B0E65, 0x1C362480EAC20, 0x04EC2B7CC82FF, 0x1830357A63DAF, 0x74F800EFE9C8E, 0x027AFF7133C90, 0x138DB585753A6, 0x0176446342B54 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x555DFFD0E7CCE, 0x2B58596DDEA73, 0x05E9DC7858016, 0x61BA5C214CA4D, 0x5E776B2AFED63, 0x08EC43DF3284D, 0x6FDD6FA1E4F64, 0x696B3F637574C, 0x3068AEDCB0C7D, 0x01296C782C366 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x593F28E402A47, 0x451BFCE9AA6C1, 0x3C837CE8520C1, 0x2C96D48C0ACE8, 0x2B37AF5404059, 0x300533E293465, 0x13FE5B42573C0, 0x7D3D265A34CF7, 0x28E6AD853BB8C, 0x0179F0C069E67 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x559978649B57B, 0x5FB42E324DB48, 0x6BC8B2825C2C2, 0x47EE46434BEE4, 0x490CA8AA2127C, 0x373F2D9DA0B46, 0x39EAC20CD6869, 0x655976087CFF6, 0x56FBDADE5A8F5, 0x00C81A15FC663 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x5A14C5B4FCF0C, 0x2B481793652F5, 0x549B86B4BB801, 0x53F16B704A9C9, 0x3E7D780102B12, 0x2AFD33D000A5C, 0x40E31CDB105C6, 0x41E7443E5EF49, 0x64726F89AD1F6, 0x0122D4D8ED792 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x068E0CA9166D8, 0x3E752EB63B635, 0x4D836363F446A, 0x1C38723C2B35F, 0x2023AD535C846, 0x2C864D02396D7, 0x52B867103C214, 0x09BD6B9F08840, 0x3296764D29D48, 0x0114A27157571 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x431AC405A4D75, 0x10F6E65D8E048, 0x36AC320B6FF67, 0x61C26BAD78A78, 0x3FC81FB7BD400, 0x41F86556DCC71, 0x145D6CF770EB9, 0x0A3159B103A76, 0x5D74D04336277, 0x018BB4CBC1468 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x1C4D859A3A4E5, 0x44054D22296C6, 0x42D7D320A1D52, 0x6A2A9794F2E2F, 0x142C38823712C, 0x4E10A00FD7604, 0x6E6F0100A49DA, 0x3D712AA0B9395, 0x7B4CA7BF0E38D, 0x0092A4B4096B1 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x0EB76550832D8, 0x371936799EEC1, 0x0D1E660BD0EEB, 0x0ED959A1A5993, 0x78B0BBD6A9169, 0x71A3716968200, 0x7F8CF49363342, 0x1418B7AD683BD, 0x1302D0A36610B, 0x017B02DD56068 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x3BE772BABE99C, 0x09A003EBB8CD0, 0x3A9415A15F29F, 0x200FC572E6B1C, 0x470124971B6EF, 0x1014E0BEC6BE4, 0x55F290697C566, 0x165E328D7F6E2, 0x3D94EC1D0AD49, 0x00DD58D748A0E },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x1FAB9BA69DCE6, 0x091DDD048FAE7, 0x00CA411F73271, 0x036C0C316732E, 0x6BA7856537ADF, 0x62620BB273E57, 0x69F11EF952D8C, 0x495BB85345652, 0x6196EE9A8E9C1, 0x0137E98EE4306 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x75ED2AC972FF2, 0x529AC7FAA0B91, 0x123D4E896CA4B, 0x5DAC1BAEAEA89, 0x0A7CDBE4AE616, 0x6EA30D4C1C453, 0x7F87F33670DB1, 0x28C9F26A6B1F6, 0x1439DED14C77E, 0x00EF5BA3F6D94 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x7928F30ABDBCA, 0x50F742AB17C49, 0x630B4428A4146, 0x1E0F0574584BF, 0x4539AB771EE90, 0x294FDE8888014, 0x4735080C3BD5E, 0x045AE08AC8E5E, 0x34A56BCEC81DC, 0x01565BDAF7DFF },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x1A0C5ACC6B770, 0x19E85F6400237, 0x6ACB932CE8AAA, 0x1F1D027090174, 0x2B01BDEC70BE2, 0x06C998A8A2D25, 0x5B300D565A57A, 0x384E1A8924E7C, 0x74AF905F6BCEF, 0x0139EBE9360A6 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x6ED9E2A3AFA12, 0x398A7CA486740, 0x1F3E2FE25378A, 0x2A2CECDECC891, 0x74BED5640DF21, 0x153C67D200859, 0x76792F9173463, 0x0FAB51E1CD666, 0x48C6F017E6927, 0x016E79BD05F64 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x12AA5AB130980, 0x00DBF48702276, 0x1958EC108C12D, 0x5378A38733C2F, 0x0185989BA6E0F, 0x4BC08AE7C1705, 0x6CEED30D6164C, 0x6AC5974A940AA, 0x677C0C943AF62, 0x009DE452D3F57 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x26A6184BF2DA9, 0x2A14CFD8EF2F7, 0x58BD3413C998A, 0x15B5546324326, 0x1F82501B902C7, 0x108995701B38E, 0x6CF519D5F44C6, 0x25A6AA1E5250A, 0x12366C27C33CE, 0x01A1E9C42A41B },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x6C9661719E9E5, 0x75F6699D89320, 0x37BE676B71126, 0x1BD044C95E2A6, 0x241AE7E83694F, 0x2DE63C6F4D834, 0x2544341CD1206, 0x7BA0F4143C6C1, 0x1356896EE63E6, 0x015D6AE3C9FBD },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x06DBF6C0C859A, 0x57DC458D3692A, 0x777B7F3A6A7C1, 0x1D16C56D69A0B, 0x44D0A955692A9, 0x3CDA3E59DB844, 0x2442F1725C336, 0x5A347701AE3B0, 0x35D911738DEC2, 0x01244261361F4 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x5C529962F5ABC, 0x0888AD68E7354, 0x18F3B52AC5757, 0x2144DC05B8B84, 0x24EFCCD07BCBC, 0x0B9202C8F7658, 0x3A53BA6E2E2F8, 0x6F3DEA316BC8B, 0x18359C53CA632, 0x00EE29FE4E660 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x1C87BF37D1EA5, 0x70DA98FA26DDD, 0x2DA6FB0E4F36E, 0x222C1780DAC69, 0x13E8125C0C1DD, 0x177CF74D88635, 0x276C6287C3B98, 0x4A646CA48659E, 0x28F73332749AF, 0x0172FC870A7FB },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x1153F49DE7E21, 0x704486B1BFBF1, 0x31AF29FC44BE3, 0x0E97B4F8E3943, 0x308333760DE42, 0x429560B9346EE, 0x4BBE3E0C3463D, 0x5A1B7EC39B30F, 0x31F0A36A50E4C, 0x0090254562CF0 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x49A8E79EC858E, 0x321348559C7D4, 0x1FF70D16D40A4, 0x220BD1042F737, 0x77199524AD9B0, 0x36CBFF02D0BDB, 0x602459D39D239, 0x49CEABCDC4666, 0x4EB2C96C56B96, 0x01997556DB4E4 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x1DB9B095266FC, 0x038E04B46593B, 0x23A1BF117DA23, 0x122B477C9A7B0, 0x532E68376BAD3, 0x59299CAEDE1AF, 0x64183FA05CE33, 0x3E1FD9E712A81, 0x0BEAE8E0A45A4, 0x0133882D60B9D },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x5D366172A0A93, 0x517C7BE69535F, 0x35FD76954B275, 0x0BB891487AD01, 0x1EFB676CC6606, 0x1FE35185C540B, 0x75AC340A54CD9, 0x587CF6BC099B1, 0x7DFA31E9E48B6, 0x01446A8C3E71A },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x35F7A7BEAFFCF, 0x61A9D4F347BAD, 0x5348B91948BDE, 0x289E30B32DF6B, 0x25E061B81C76E, 0x68F3E5EF99EEA, 0x3FD729DA6A1A0, 0x0E6BB51E33A56, 0x37CC8B6E808E8, 0x00D4C1D2BB150 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x2B30E774CFDA9, 0x38101449E7F6A, 0x1ABD740851ED6, 0x0DD69031FEF58, 0x394ACAB0C056D, 0x67397DBFBDD4A, 0x556B8AC044E4B, 0x679C36C69B060, 0x2B5300DAECC1A, 0x017FE254E3195 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x7C941C6B645B1, 0x0E7FC37A91FCD, 0x3B23427EF1201, 0x3E1DDA170A652, 0x5B71CC135FEF6, 0x75C97C288D3D3, 0x55B39AF87ED9C, 0x7689A1E15E9E4, 0x3CA859CC5FC5A, 0x0122F3FD97079 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x00A3D025EABB7, 0x2B7F9D768EAEF, 0x04F8389A88030, 0x6E978B06D9647, 0x7D0ABFF7F4F17, 0x4DD3B3A9ABA52, 0x5F53265DAB976, 0x18B8667470EDC, 0x55D7F3488B5F7, 0x0176CB159E14C },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x38F2D5D36F965, 0x19F8F8C9A708F, 0x49FFF248BA0A7, 0x6959B218E3970, 0x2287C46925F27, 0x596585A69832C, 0x318D3C615DAE7, 0x38B1AEDEC43F7, 0x51B141ABDC81F, 0x009C232595678 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x33112DFFF6ADE, 0x21DB1FC684D4E, 0x3A3D6EA69E79B, 0x6D2F88FF136BC, 0x0997DB86B1DC3, 0x17027260B3918, 0x6B15767A5259E, 0x544CC85D83618, 0x6E62AA8178883, 0x019657C573500 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x4A803A18559E2, 0x55931B27F833D, 0x0D1B1B1A4FC91, 0x7AFBD5042CB29, 0x300D27E6CB333, 0x422EF88128438, 0x1F6284C8C2A97, 0x5655F8C69581D, 0x5B9B69F91B475, 0x016642867A0C8 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x56704A1942F1A, 0x76A63A1CA3570, 0x16C5C2A18E60F, 0x6D3846AFC6FFF, 0x55D0D7FE2250E, 0x0FA0297C5020A, 0x5554B689336BA, 0x2B591C181E4EF, 0x3E119649322E9, 0x01C7CE37BF9C7 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x0136CDE2E065E, 0x68DE030B6B6E8, 0x3534E4D1F4060, 0x26289E2024004, 0x066906475DF94, 0x45E9BFEC3BA71, 0x792B15BAE76E0, 0x5A4E8D9AE2407, 0x1B87C3C0CE488, 0x0139CFE48CBF0 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x1FB0E08C63625, 0x2F92AB3795FBF, 0x5101D202E8EFD, 0x6C95E54288D33, 0x09A485A25407C, 0x57BE0F6788E62, 0x25D871C26A31B, 0x2893CE9FE364E, 0x1591B6637680E, 0x019CB62016C3B },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x39D83F1AF2D03, 0x7C11DA5F025C0, 0x3E20E6D433C32, 0x2B03EFA0A1603, 0x360A414687402, 0x0BAD83E5EBE56, 0x6285D540A7947, 0x69D21C367F8FE, 0x788C8ED3946F8, 0x0129A639200D9 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x4EF02B54A2FED, 0x364BB8C137281, 0x0B11DE48934F7, 0x0ED213EFFB4D8, 0x61C7C92357FF8, 0x10D6F294BCAB7, 0x7A717D243128A, 0x35AFE5C8F2CEB, 0x6B1322DCAD0F0, 0x0149D598C14EA },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x487D2EC7E0AC7, 0x5C0BC08048C84, 0x66983C1088472, 0x4FF26849316B1, 0x487A8F1C4CB43, 0x61306FB960E62, 0x06656E51952F4, 0x577A8D450D68B, 0x39DCA36C1F362, 0x00DEB2CFECA81 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x55DDE1F89AECA, 0x2CFEB9453BE90, 0x27227E08ABDF2, 0x0EFAA14ECCCE4, 0x2DB613794B66F, 0x0B4DF7AF7FAA3, 0x59487AD2F182F, 0x7182124B63714, 0x05DC5AEEA39B3, 0x0171E0022B27D },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x3936C7BA734D4, 0x384096D24029F, 0x616654B9E7104, 0x5D25CB861197F, 0x3E6ADEC4281B5, 0x0CE040821FD89, 0x59593B254AE68, 0x4C73A232591E4, 0x3605A7BBF667F, 0x00CC1F2286628 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x3658F527A7652, 0x471445EFBA84E, 0x19DA625801191, 0x68D59DC249129, 0x73A9C947A62CA, 0x27766CD00ABAD, 0x1F26955F978A6, 0x13E5F67887769, 0x5CA1A371473D7, 0x0124F13E6D02E },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x154C1277AF734, 0x102AB91E25EDA, 0x12A4E293E1BF0, 0x67D882457D308, 0x7D5367E245622, 0x4C0B273B04618, 0x628BC6485B608, 0x3CBE11FAB12D1, 0x2EC73DD96D1C6, 0x0101A450B34CD },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x398A2920E2FEC, 0x575C692FC51FB, 0x01F9CE3B12AE9, 0x43E0CB84DEBC6, 0x5A41B18527BA9, 0x3BBFB85C8CD11, 0x55C2535A4B1C0, 0x315D3210AFAB7, 0x4D02BDFB4AC0C, 0x011B34A4DDFE0 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x438887901BB80, 0x3D661F6404D1A, 0x7886EA8835362, 0x3E1E4B689767D, 0x1E3918C1B8C17, 0x56AD0AE6DBFB8, 0x149AF6DB5DA65, 0x66629311C8E92, 0x0F9C85ED987F1, 0x00EA58434718D },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x248BD21A56A3C, 0x57ABBCDA0AE69, 0x3C2F156E391E6, 0x41196CADA83D6, 0x57A7BF77BBDC9, 0x00F335ABCA48A, 0x3A3D1D071BC8E, 0x0C35C21E5CF9F, 0x297A0DE21A16B, 0x016E14816AE1D },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x1EE42BB96E97C, 0x1135224D7B6DC, 0x48026E1F21C33, 0x11C7C29D89CA0, 0x6DA55379A8A5F, 0x37FBB67817D62, 0x2A65A309E3D63, 0x4D25FC39E0270, 0x396F0EA67C064, 0x00BC20F436298 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x58B3CB4A31C90, 0x51B16F6E941BE, 0x0BA52BB33CB77, 0x26A4DB9208002, 0x52F0DF72E7D66, 0x18501D5B24AC6, 0x0D970129A47E0, 0x3975AD134391B, 0x59DA491DC8E32, 0x01A471FEEA114 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x2B2DA513005A0, 0x1D9F9857837F4, 0x2A578FAADDC7B, 0x29575E004F43A, 0x681BDB41CBCE5, 0x660813C214868, 0x62D00AA309167, 0x017F04E6834E9, 0x5CB475A093DF3, 0x0136458F890DF },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x7966474782E34, 0x6D932D7A1699B, 0x4C13FA75247C4, 0x62F0D7D598927, 0x504A93F16EBA2, 0x2B8CC00BD2345, 0x15328E8435D00, 0x33CCFE37AC647, 0x6091E3EA9BC7D, 0x01C9C24EE53F2 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x40AF86EBEDAB6, 0x661E3295C8150, 0x1B93702EA4448, 0x7FA14E72E30FE, 0x542B66FFCF81E, 0x4744D740FF384, 0x742DADCD2E76B, 0x56A179EE6C96A, 0x46B631FA65E53, 0x00EBE4C323667 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x4FFBEAAE16B5D, 0x06F4C1BC009B3, 0x78802343D5736, 0x31BB39FAD071D, 0x220D009DAE2B0, 0x2DA6D32B6AA62, 0x34FE6444B5125, 0x0BAC2B3DAE241, 0x580AF2E4957E6, 0x0157F79660D20 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x496AC4C5B6787, 0x7EC650BC8276B, 0x6A14225DB01B8, 0x301959310444D, 0x51A27C1797901, 0x701DB02596D85, 0x6BC8FCC08C36D, 0x6954AA5A4F7D7, 0x063B4EFC0A938, 0x00E729D5B6CF4 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x21FA4C994B3F8, 0x1164C4D9C656A, 0x505FD61FF752C, 0x1605106E930D9, 0x475F82DBE7910, 0x2C97DB08BCEC9, 0x2474DF359847D, 0x5332CD6782CC5, 0x2DCB4178F1E3A, 0x0174A000F681A },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x122829B048A18, 0x6A4723A50DEBA, 0x4C3950A9EDCB5, 0x664A7E248E83D, 0x3630111386806, 0x2F34A782F8225, 0x7898564AC393B, 0x3BE7DC0E5FFA0, 0x5547CADB07D00, 0x012E79925A69F },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x14838FB6177CD, 0x46F78EE8B4EE7, 0x657F551B39BF6, 0x1B5816536B5F1, 0x352ED08915D99, 0x6A88F55A5F2CD, 0x5A0C3B1777F8C, 0x3B0A5DA1F8C18, 0x44E4C5AD4258F, 0x014CDF4E14127 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x6CEDAACB94D25, 0x398863F556C7B, 0x4415B55072ECD, 0x326B8D81DCD63, 0x1FC01744AD56F, 0x747B2D61602A6, 0x5F1CB66960F53, 0x05A60655870F5, 0x3CB215A88E01B, 0x00F078FCF7B06 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x41FCDB202B531, 0x78E827E7FD470, 0x2C6A3A3F87221, 0x1F3C74B663395, 0x049538B81A667, 0x0BAEBF17AAE99, 0x013E6F4729723, 0x3FD7E374715D9, 0x3DB02B50A07BD, 0x01CA6CDFD06B5 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x10DA5F651AE65, 0x40FA36E5244AC, 0x6FFEB1FE2F8ED, 0x216195C1B79AD, 0x390F0CE9A4837, 0x431CD4F3553A4, 0x40F9810559E73, 0x17C5534198279, 0x31D565005FC2A, 0x00FF2909DFB26 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x4A66D163861FD, 0x191AF219A4786, 0x1E2FD5CAE7F5A, 0x77C3DCD5D1742, 0x56D45254C5600, 0x1042D47150C2E, 0x511BC97A72F58, 0x5E2F03AED5461, 0x20B5D8831F055, 0x015E423E21F33 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x5CF495C9F6BEF, 0x6826BDF143137, 0x1824D1DC49996, 0x4F3B6C41D1B11, 0x374C245F5E9DE, 0x1D372B5990740, 0x4DB8908E14946, 0x66CAE8D68274E, 0x7C68C04104519, 0x00CB58A2FB1D6 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x5A6CB6F9545FC, 0x420017BE7D1D1, 0x1549EE5931979, 0x47617B44D6930, 0x0E3A6DB6D61C8, 0x1006D8A11C8D8, 0x443E2746E86F0, 0x0CFAEE07506A7, 0x6154EB733FCF1, 0x01B352549C21E },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x26B57439CA61E, 0x5F480177ED2D4, 0x449B0ABE9187C, 0x51CD43CD93982, 0x69E8C56A1A5DB, 0x6B142F529B0CE, 0x57A5A387079B6, 0x6554C6472F0CF, 0x722195A2DE0BB, 0x00F76780E49D0 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x2C83FC4E20DC2, 0x301FB28D3331A, 0x73EE22725235A, 0x7ABEDFEFD35E1, 0x295058FFDC316, 0x78A5BF1F12E8B, 0x45B869BAD1DBD, 0x7902C59A34759, 0x0772072E74B55, 0x011DE8DD4C59F },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x3B0CB488D14D0, 0x146E2C19EC909, 0x5695FEBC9B8EC, 0x02CF2E6889737, 0x5D3721444575F, 0x7334BDB9CA051, 0x4B4ABAF227B51, 0x2E552C581B425, 0x5F11DEACAB448, 0x010519A4F7AAD },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x7CF927633F6F0, 0x4DE3CF9044486, 0x4B12FB5F8B6F2, 0x7C0655B064B62, 0x44F7CF5AC050A, 0x24B6C0D01EF7D, 0x4D342C1BFFA06, 0x725CF95723E9F, 0x3A1C31C3081DD, 0x0155AFA8ED334 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x7782EF5ACEFBC, 0x717ACEEDC1318, 0x236AA97D1AE5F, 0x66581B48F4BEC, 0x7F99B23027596, 0x3DCD25C6F37F9, 0x3F4D19A7F71F3, 0x6B5AEF4084339, 0x2334124ACFA93, 0x014BB9885D40A },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x5729877A9EFE1, 0x5450484CCF260, 0x4EB476B899163, 0x7422DF1A94892, 0x61C4557B7C9EF, 0x60A5BCF18E7F4, 0x076BB418E84FB, 0x04DA41FE19F85, 0x308609C5A4207, 0x01C86EDA94226 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x6BB82122621E1, 0x7E90365CE68B6, 0x7D4690AF75721, 0x19F03E24ABE80, 0x4D5F8301A3D0D, 0x4D0BE1E1A7578, 0x01DE6B63FC0B8, 0x6C36F6D1D81C9, 0x2CB45300F8EFB, 0x00F618863319F },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x461E117FE7360, 0x7D86004091417, 0x75CB8DC8637BF, 0x5FE6C78772EB9, 0x3A0EAEA388575, 0x2B06DB702C30D, 0x5464C972C7ECE, 0x402DB6B61978C, 0x4D06307D2A7C3, 0x0166D08CC6EF7 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x62B970F94CC94, 0x49B0E036A4ACA, 0x40CFBCD266A5A, 0x0B34F7A26CC3A, 0x48431AAAB2B6A, 0x08EDD1E5117A8, 0x3496567656002, 0x2333437E27CE8, 0x18834164D035E, 0x014D6662BD5AA },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x0D2AA58877826, 0x5E4AE28F3AE46, 0x266A65862A219, 0x5EC90561B481E, 0x203AD7A004961, 0x7B3BE0A31DFC0, 0x6807B1CF69D19, 0x78A1E93E9F7EE, 0x7BBD77280AF91, 0x017204C505439 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x35CF30C77B41A, 0x28439F98A5F1A, 0x5B121511EF2D1, 0x7400C3FDC1F81, 0x276910B9D3531, 0x72039241DE833, 0x4720C9D4F1E71, 0x6067F28FAC118, 0x4466BD56D9112, 0x01356AB7F4FC8 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x01EFCEB837DE7, 0x638453953480D, 0x5EB14A2B84356, 0x3D11A4A226414, 0x78BD534BF20AC, 0x721A901CAC3C3, 0x5844562163AE4, 0x122FC87314BAC, 0x4DF38C8C3E332, 0x01E594E962776 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x1299380D0322D, 0x500C179610D74, 0x785F950A2C60D, 0x07965241C23A3, 0x0AAB3A9BF367C, 0x3F07C5875203B, 0x2D38C89684619, 0x27D776B4AE453, 0x4CFA3C52F9229, 0x00F606E80EABC },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x5AEEE7EE63F66, 0x5099AEC6F0991, 0x63C1E1B26E85F, 0x37F4662C36314, 0x64AC8AF96E9FC, 0x15739EA15B815, 0x7037AABA6DF43, 0x0A78835ED354A, 0x0687AA91E78AA, 0x018F65E6BB121 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x0774488247F56, 0x769FE000F82C6, 0x4CB6136879F35, 0x1FF5ED0D9058C, 0x77103F108E902, 0x14C0334465427, 0x4526D74E90175, 0x0D8C20BC0FF26, 0x7FF45A383AAF2, 0x012DBBC21B7EF },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x599021A5C0A14, 0x4BE00BE0F5B30, 0x0A9EAEA2E83EF, 0x65730A094A9F8, 0x387414F252693, 0x0797A9F863B19, 0x402A155D0BF6A, 0x07116780248FA, 0x1892ECBC3882E, 0x01B5AB2278CC1 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x0CE4AA93FB8B8, 0x6FD6710F6E040, 0x6143956DAAE9E, 0x7EBFBD8BFF71C, 0x0A5A035129AFE, 0x3D03F796F070F, 0x177C43F43E766, 0x5623FB4B73E21, 0x64B2B017C6933, 0x00C340B34003F },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x78F4128CAF417, 0x198000F245F32, 0x56C3262EFAF44, 0x1535BA9200E44, 0x5BBD7948F58C0, 0x0872D28BD1A0E, 0x57447AF3D0443, 0x01DCB5444D486, 0x7F915DDDC51A8, 0x01B771E65167D },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x26385057EF98D, 0x30C2B09A3C45D, 0x2C640205C6A9B, 0x4EC23D7F91629, 0x7B94F5BCFEBE5, 0x51D175668BE32, 0x5AE514E1B96EE, 0x5BE097EF21CE0, 0x63E3E7792681C, 0x013AEDA7B9533 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x6D09E5A5C9178, 0x0A91A77CAC66D, 0x1C1B6E899A21C, 0x63ED255535C00, 0x655F1AACD7E09, 0x7B979CED5A1CC, 0x371BD96F7A7D3, 0x3CFB1A4E249DC, 0x6F31DAC7DCFE4, 0x01CB44D4EF3EF },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x5C0DB54B4ED22, 0x57992F27E0D53, 0x352661C7D5C19, 0x4B1FFB8F9EDBC, 0x06955F9AAE3F9, 0x3CE1B8DFD030E, 0x5531DA8E7D615, 0x11DEFB4DDBAC1, 0x5CE5C37F5CE1F, 0x00FA373396573 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x2D9EB053C5278, 0x528E3880AEA97, 0x4EEC7989A2A22, 0x5921B74860A4B, 0x09A87558FA524, 0x62B5C82BA7F8A, 0x6B54BCAFD0EC5, 0x0A9297131B0A9, 0x2DE7F8B8911FC, 0x014A46127E93F },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x23C544D1A44DE, 0x5258D4A5131AC, 0x36597F7B65EBB, 0x3BD828BDAA388, 0x440076709509C, 0x398F483DD45E0, 0x29B701922E237, 0x30F892AD7351D, 0x452F30E6E0732, 0x0119F55FAC561 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x1DD68CCB86C93, 0x195A7FB6FB07C, 0x65FE09C8D5C98, 0x6DEC391AA89DB, 0x2D05754A1FF73, 0x0C46250E82E55, 0x6AB0D80BF870C, 0x24D90D9749C0D, 0x20535D82E7D77, 0x016E278553A8E },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x40C5D8F512C7F, 0x4EF231B91874E, 0x5FC220CB32FC1, 0x07C9003F5A8AC, 0x2F1B2E7B50B4F, 0x6DF7713A28736, 0x493F77D16BCB8, 0x39B508388B48A, 0x10A617CD773A9, 0x012F03E5E410C },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x0B86794FFF271, 0x083E41DA8EA34, 0x60C7319E0ADDC, 0x15FC6169B87BA, 0x381D7268EE307, 0x3746D383AD2B6, 0x72309BF05FF19, 0x22E44BDCCE3BA, 0x44276216B9B55, 0x01655A6A0FB3A },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x7594ADDF91D29, 0x51B0336F4422C, 0x128C627761A3E, 0x161AEA7407CB3, 0x422E8A065C1A0, 0x7D722D395A62D, 0x72A1C876A00BD, 0x6F6B74362C827, 0x68C6D90588D8F, 0x016763961B5B5 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x1CDC67A236AB5, 0x1B11B159C8BF3, 0x153AAC649671D, 0x0A63D16B4584D, 0x78CD08A5E0BBD, 0x5B917837DE341, 0x58D1A2D6947BE, 0x61A9FB000D2CE, 0x60B600CAC46AC, 0x019386DD68C0A },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x322C10D69AEB3, 0x7AF9C4473F9E7, 0x3E0E3FC48BC26, 0x5A2AFA0371CA5, 0x2369B7B0AE13A, 0x17FAC55170D77, 0x69259137232DA, 0x40E8A29597D14, 0x579B9B0D123A2, 0x01408A6BE51B3 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x3F34523DE0C7A, 0x02A4A3E1AC0E7, 0x1917CAE557586, 0x69684A7693020, 0x65B7C1FDE222D, 0x27BEC93C3BC03, 0x4CEDCE0223DFA, 0x66F67BB7CE062, 0x291C7D7E1F5B3, 0x01B1E497547DF },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x46C802B25CAB4, 0x4DBD148839955, 0x023234D3DC257, 0x70D8805DD0C78, 0x61A531485C85B, 0x22594D89C2833, 0x6A11E77FD0398, 0x335E20F908F4E, 0x26B0F0AC3FC50, 0x01268FB0E4843 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x1E82D1BD5B62C, 0x12D2CE32DE5F6, 0x223B46A00E56B, 0x2D3ECEFFC6838, 0x08327CA8ACF96, 0x04D2429BFBD81, 0x2F0E4F593684A, 0x7974FD7F6B292, 0x77F7A23410A87, 0x015595EB0E374 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x0AE35B2DBB13C, 0x50F9B2659A4E7, 0x4961EE3FA8E3B, 0x33BAFF71C7ACF, 0x592D7D3F2DDCD, 0x5C8601F989A32, 0x451AB60C1B631, 0x420AFD08B9CD5, 0x29B910B7AF662, 0x0106C4B6944E9 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x42416F2135E07, 0x41C95A3E2325C, 0x785B2FB1A2C18, 0x027FCE8CC1724, 0x43F6DE97D96AE, 0x6345A35208C91, 0x6F1DF122C52B5, 0x19835DA5F4B9C, 0x015142E3952DD, 0x00D1918C482EA },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x55C90C4073009, 0x04083CC4053A3, 0x70060AA8CC0D6, 0x2276CAF1B0473, 0x26CDAF5034CEF, 0x20397B245F273, 0x30801D58DDD06, 0x01520F5AFB925, 0x5B714992F3C80, 0x017C26D5370E7 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x0EC487CF6182D, 0x591D462E75F28, 0x058F44F52C807, 0x0366AB766AD1A, 0x671CB860AA3F0, 0x3A9486836C0CD, 0x5D889E0E872A4, 0x797D0C9DDFBAD, 0x7F7A7532A2C60, 0x0145AC9B58816 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x1119811A0D52F, 0x411C8B87984DB, 0x7CD7DD5590655, 0x555A3ED839448, 0x7FF3FFE9EA6E7, 0x4A0C3B3C0B4E9, 0x6CC97BA4E6A65, 0x294A4A560A26A, 0x4BDD2EA7A00E1, 0x01233861C2F65 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x0353D89DE3796, 0x59985C7B20490, 0x476D3747CD2C2, 0x3E961C28268AA, 0x355512B6B3956, 0x76DD777C083E9, 0x7E73714DF4A9B, 0x6E6D67B78F444, 0x5ADB8A437794F, 0x01DD23E6841B2 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x6B24027E101DA, 0x1B8EDB834C399, 0x7796A93F7EA0B, 0x71BC9E5BCC4FC, 0x26C7CF0AA60D0, 0x4635F7ACB0C82, 0x215A1E039EA17, 0x3368099D08D8F, 0x72B9686525977, 0x00F4D72165465 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x1F2FC87CC2BD8, 0x320EE1E015045, 0x2C00F746A071D, 0x124DF494E0B58, 0x1E0700779D04E, 0x78B0A20BF437D, 0x2AF5C07564827, 0x6E27B34EE3DE2, 0x3D6DA2A771FF7, 0x016FE30E1A5F3 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x59E2C3DC0EA18, 0x3853B1283DC66, 0x5EB93F62F54B8, 0x6AC13340F9B6E, 0x6E6D577F9361A, 0x0CF914864F5E5, 0x3D41FDD4CEDA7, 0x6FC7AB8066373, 0x075475C70225E, 0x01434BA4B26C1 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x559F2910A7693, 0x21E3BE31C2E75, 0x6010A3D99F335, 0x673A842639FE0, 0x4FBC487B9C73F, 0x093F163A2833A, 0x65B422DE69F05, 0x32166E793644E, 0x55B57E772D079, 0x007A7D45D8986 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x2EF6D889E0655, 0x04BC44275A485, 0x7256CD9D91441, 0x2E98599818053, 0x00EE45FE12A87, 0x45C7CF5663140, 0x77D5E665D9455, 0x343CD13DB2C6D, 0x0DBB30C9900F3, 0x015B126A6D4DA },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x461009DF42997, 0x09755069A26A3, 0x52635F87C3E6A, 0x336661CCB158F, 0x14C5765998523, 0x5F3D16746C923, 0x7901B60CC96B0, 0x014CEC4610E67, 0x4C2997B14D9E9, 0x012A075A048FF },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x059188AA948C3, 0x5BE97C7224E05, 0x5DB31E6B00E47, 0x2DECED8416ABE, 0x6BDA0EE2E4F28, 0x640C27BBF0A7A, 0x7F68803770CFA, 0x01F825E656B2D, 0x04951E6D3F83E, 0x010BC90FD1312 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x513CC05E6864E, 0x1FACB1DFC53E4, 0x6126C39A0E056, 0x4F9676D4A2E04, 0x7C76F8E1E1B5E, 0x13B42C046E365, 0x1713052FB3C00, 0x26667C9FD7A7E, 0x7E019DAE0F647, 0x01564DF63B488 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x4CB8DD6521394, 0x7BA6CFB7BCABC, 0x4FE8861142B0C, 0x55CFDD77322BF, 0x1A59D2C3448C8, 0x26871E405405D, 0x210AAEA566AC1, 0x16A97368FA3D8, 0x22A3A8DEC50EE, 0x00D280F6831B1 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x4DD3D2D8D30A6, 0x60A199AF8161D, 0x0CD4BA76F7888, 0x337C23EF357DB, 0x24CE5D31FD3BA, 0x656657B8628D5, 0x6A79E43E94940, 0x46917411457D2, 0x32762642DF77A, 0x01BEC63810F2F },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x16B26103B44F4, 0x0A86B130D6B5E, 0x5F5066CF07C46, 0x7F61E151DFDFB, 0x0AEB1CE85C7BE, 0x2F7476E11CCA9, 0x189C6E27B2319, 0x482773F954356, 0x24FBCC14224AE, 0x00D56C2CEE222 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x2A868934355BD, 0x038F34FED8F21, 0x5CAB1C523C9F7, 0x72EA145F48B5F, 0x08A56BBE4A152, 0x0B158BDDDE735, 0x4541211D5B48E, 0x14242B8F2BB2B, 0x227FA8856B36D, 0x007E89234E0BF },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x553EE3BE99CF3, 0x20607CEAEA310, 0x1DEC7FFDC825F, 0x36692D5AD1E8B, 0x3778E2950A8AA, 0x22AEB194BD8AE, 0x41EFC693A6EEB, 0x7CEBD630255AF, 0x3649D99C86810, 0x0121836431BC2 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x3070AF36B5B43, 0x3FD9C889736EC, 0x3680E74F6F043, 0x510DA4DFB75CB, 0x12FF421154986, 0x45C6AE0FA850A, 0x48C1C9BA5B953, 0x6323BEDCA8760, 0x5CAB033970050, 0x014D6C375E575 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x1B01DFFA4A13B, 0x0FFF760BAA196, 0x08E978FF3C54C, 0x053E2C1D7C073, 0x5442065D52BD2, 0x34FEAF2AF2E00, 0x2D86EF23B7FDF, 0x160210C19B58D, 0x3F70E9F143F08, 0x012463EB18415 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x71A2B0F62AC23, 0x43FF406288831, 0x5DF7A4F61E413, 0x3CD82F42E9904, 0x2E78BD354E86B, 0x4D33EBFCED40C, 0x26F252B29EBB8, 0x515E97642AA92, 0x396341E11A419, 0x01F01D7FF7961 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x2381FCAB5A76D, 0x699C2F1E96505, 0x4CAEDA6FE55D7, 0x33554BE6542C5, 0x0B32FBB9DF841, 0x21145320880A2, 0x24670435FE577, 0x4C8A5AA153843, 0x26B67B2C0C939, 0x010B41F14F36C },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x105AD0BAA63D0, 0x03E292F08C6FB, 0x2DD9C0B6FCA8E, 0x27CF7C53DCD29, 0x24BDC4CA6F218, 0x2FDB58E7AB3F1, 0x68C5034047F61, 0x37DCD51E1BD17, 0x2F2DF2CE6CE62, 0x0161C49528365 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x50D7C3590339A, 0x1B9893EE18FAA, 0x55CBA415EEB5C, 0x5D4156342C6AC, 0x37D62095907B6, 0x3D9304A045004, 0x1DB0450C0647C, 0x6B4F9E98B1F1D, 0x0B454DBC7F607, 0x00D0CE16459D1 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x14AC6A7F018DA, 0x4BF1A90124D42, 0x78DD8748FF821, 0x19CAF1E8B6F35, 0x6A24C9D3861F9, 0x5D2D203E8B686, 0x5995E3A695255, 0x6F0AA907AAAB5, 0x14925F7CF5182, 0x018814CC0C29D },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x1313BA532ACA2, 0x1406A6BC95367, 0x0B9D646F3DED3, 0x426D6CDBB6431, 0x1461B76F7553A, 0x50C9C9921BCBC, 0x0F1346ED1B83C, 0x69CA082FA5E9D, 0x621842E8CD817, 0x0177E974B3ADC },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x5BCF8FFDF3443, 0x3A42C1F99B6D2, 0x06737BDB3F354, 0x25C9D5C713CA9, 0x03B0E7060270C, 0x37B15E32C2CD0, 0x0D16F7BEDE4BB, 0x1E7BE12006BE4, 0x46C8F6EF40CB0, 0x01296A5D8AA8C },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x7420B2C01DF3D, 0x6D5766F843F8A, 0x0548FC23A9BD1, 0x0AC9A6EDAB1B0, 0x5E29056DC71A1, 0x7A9CEB6F63230, 0x33102607D3FF5, 0x653EA755E9835, 0x2283A5A749B56, 0x010896FA4C793 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x09E3D76E0755A, 0x558CF78D3BE79, 0x45B76DE39A731, 0x48EDF11D542DB, 0x0B4E47E6A66E0, 0x088B8DE80F5E2, 0x4DAEF5950794B, 0x41C43CFFE3AD8, 0x70A56D548888E, 0x01E86C07CA712 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x7BE27D520BF0C, 0x5632F94FB1CBE, 0x2D575BA478E4F, 0x267DF7C7BD3AA, 0x4DBD27FEA15C8, 0x192AAC3CC6E09, 0x00399FAA200D4, 0x039FB18CAA501, 0x586C8552D9ACD, 0x010C6EFB7EECD },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x1381BFEAB1355, 0x3A7518E656DE3, 0x0A906F27AA11F, 0x2D9B3026AB1F8, 0x3B927F232ABC2, 0x425FA085BC208, 0x49D98A3455F20, 0x5D4C86F3D98A0, 0x25224A328B0FB, 0x010C3A5A7559C },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x4DEAD0CC90889, 0x09B3873353404, 0x2E638B0D7D1E2, 0x164203A25DD6D, 0x01BDB418109E1, 0x6FCDAFE381EB1, 0x68CED14B20815, 0x435C2ACC3D772, 0x2DEB439363E00, 0x010417C500FBB },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x79F8BCAE89D2F, 0x766FCF07B7B6D, 0x00604FD4638A2, 0x462BB12702532, 0x1EFBA2DA15D6F, 0x231757AFFD98E, 0x72B329D71964B, 0x3DD919372E6F2, 0x0711CE1CF97A8, 0x019949DD3037F },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x401D33D5BF6A9, 0x3A890521CE6A4, 0x750F7D4459844, 0x7E2B68718CFDF, 0x7E625AAF0D6F8, 0x194E85242AB6B, 0x146D4C5922DF2, 0x7BE412FA5FBDC, 0x6A3B68C01A67A, 0x0142DA14072D4 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x55C21851E6397, 0x28B56A5650EC1, 0x125A2D2D0B84D, 0x5B533E5240CFB, 0x00C91383FDF5F, 0x3C2769832A5CB, 0x6902C70C86DEA, 0x151C7FAE53762, 0x7D7982A10F7AA, 0x016AC970C1112 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x0ED0EA6007C43, 0x34053F1BDC1C2, 0x284FBBD109D62, 0x0E07D5BEAF15D, 0x25437AA8869A9, 0x178091BC52ACB, 0x61DC9C5D2B50D, 0x58BE59266A464, 0x5259ACEC40D69, 0x00ADCD6CCA81F },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x25F0567D3F40A, 0x7A3E6934C40BE, 0x3B20F11E0309E, 0x4BA31A00C21AB, 0x336923AB2BD1C, 0x629BD85CAD5D4, 0x43B90E5EAD943, 0x7AC50F07E628D, 0x08A5B0049C057, 0x013609DA7D70E },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x76B9EECE5ECC6, 0x3F722DE50CCB3, 0x410AAEECC94A2, 0x2B1C92D18A4C9, 0x0798640F003E9, 0x232223911588B, 0x4C27638EC0E94, 0x61825F02F7F09, 0x00A6C25DDFF70, 0x0133FA72B13B9 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x1B4D411E5566A, 0x2A3928FB50F51, 0x643194931FD44, 0x4D76A21D0D1F0, 0x32C5079B0C86F, 0x015EB92B2A27D, 0x2934A724F388B, 0x768D3D7FA2A85, 0x7C127652F0A79, 0x01A29BA180327 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x1F1A3FECF1068, 0x319B32784F331, 0x231A3FB7DDFE3, 0x177959B9D784D, 0x3B66801CF13DE, 0x62B1C6CB51155, 0x0D63193EC110B, 0x3D912CB35D8F2, 0x60672602F6E78, 0x00AA061C3A2A3 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x1D27E57C42EA7, 0x30C074F06ECDE, 0x428CF7BB03B1E, 0x7919237381803, 0x4DF2AF47174B6, 0x31760D35293AE, 0x6E054597E1568, 0x2661DBE5E075C, 0x02F25035FE49B, 0x013EDB9C07D34 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x3D1C6FFEFBF3D, 0x08A7BFE78B71C, 0x17669BDF9530A, 0x33810BF2223D4, 0x13BC9677953D1, 0x34E24C53C5E47, 0x3EBF3C6FEB600, 0x6D3EF2C87C851, 0x5FF821445C1DD, 0x00E87E27CA200 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x7D9875CC77745, 0x239F3F603F912, 0x271B2B42E0C79, 0x759C1BE49671F, 0x5485F1E420069, 0x55BD8EF6109BA, 0x69108BC450BA0, 0x37C4314CBA86D, 0x32999F370EF1B, 0x0181754031E20 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x0C849EA58CF79, 0x67955F0E85E71, 0x177FD3ED42415, 0x2386A53B44380, 0x73463FF85B8FB, 0x5FEC0DE45C9F2, 0x41868E8368726, 0x13FD8DF3003E9, 0x7AC429F64039C, 0x00A145BED05BE },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x03C853408130E, 0x10034851D40DA, 0x5FCBC54C78FBB, 0x2D2D560276249, 0x469DF98E6F418, 0x7FD07C95272FD, 0x00306EB65019F, 0x4695A9E8390F4, 0x2EFD96B83141F, 0x0168AD5648B83 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x289E90737234C, 0x179090FDF498C, 0x377CBFAE06490, 0x5682A96F147D4, 0x2F6B656F24502, 0x61984D8C14ACB, 0x388CD67C5C96F, 0x41B62FDF6E0C5, 0x7359CDB3581C7, 0x009EA7992C149 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x50E35F7F3B516, 0x21140C3C61BE6, 0x2BD6ADE99B76E, 0x7B82136FF44FE, 0x4CAE3647DD211, 0x62EED2BB6E991, 0x72A5F79243597, 0x606CCE392DDFA, 0x67AF2CBA69809, 0x01865AD6E9EB8 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x1BF491800B7A4, 0x3E164907D7DA6, 0x59EFBA3580C5F, 0x7407031941BEA, 0x60BEB93290A12, 0x20EA641D4F615, 0x303DE53E9A33F, 0x588D265513EEC, 0x50E946B6AF9CE, 0x01025FFE27DBB },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x39D5A30AC496D, 0x6B03D5511EA6B, 0x1F34DEACCD721, 0x7BA57F14AFD20, 0x2C9E60005E433, 0x2CA6BC8329DA2, 0x5E4D04DFC718B, 0x0CB9C80E3F3A9, 0x4FA61BB690B4D, 0x019C03D8A5470 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x18575B30DD28F, 0x6AF54762AAD61, 0x6EC110FDB6062, 0x165D378DAED90, 0x45A4F25DD4D55, 0x0648C1E00FC79, 0x6935D6C7DF6B2, 0x7F3315A587041, 0x61C5FBB533D55, 0x00A6F5B1E8428 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x6C2B7CE54A188, 0x05B7FA4B58BE0, 0x5794178330A9B, 0x28D9F018EF448, 0x474D32398DA4C, 0x75F94E823A420, 0x106F1EAC1078C, 0x59892C0C44F46, 0x6110F56528336, 0x01613E350DF4C },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x4CD8CCF1E14E0, 0x10BFD5861050B, 0x16A92059FBEFA, 0x10C407F338AA3, 0x581FA5349A40B, 0x42056FE3F60C0, 0x7489CCCC739D0, 0x2D6F8B2CE14AF, 0x22573CBEDD84F, 0x00E7CA4F82F5B },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x6BBB1443F88DE, 0x2DA2098B9166A, 0x4B5535D6AFCB7, 0x56F266664DDC4, 0x04C64E41ACCA3, 0x1316454394523, 0x4D5D113660C86, 0x02BE16E25BD4D, 0x57F00373B30DF, 0x013256D6C2991 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x4CB411B35AF86, 0x5A68A2D3A21E6, 0x6E04D989C5B14, 0x0C4E0D96F24F9, 0x02AA7E9C59B5F, 0x06F267FCEA54C, 0x15C707C7EA79D, 0x7FA5E5F9301F6, 0x71B13E277B6AB, 0x00DEBACDE223D },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x7807B8B1EA127, 0x7E679BA4D3ED7, 0x6698356E828E1, 0x29060650CD45B, 0x0EBFA5D13B6CA, 0x5EC87A498E3F7, 0x3B31F6637BFFC, 0x2EC5339F0906D, 0x325B18AC9A945, 0x018EE6BCE2CE0 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x63F93C197BCBD, 0x67F7B452EDD70, 0x6371D97B4606A, 0x59BED6D431769, 0x73C8E0B990BDC, 0x095BB19A4CDCB, 0x4BD2060D88ACA, 0x169B984FC2C31, 0x7BA0F37819927, 0x01177B3F4F110 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x44117DA5A5842, 0x7EC8D4A8DC19E, 0x6849ADB1CE78C, 0x4311B30778F74, 0x20146D52CB399, 0x3E5D1C3F209B6, 0x0C9735F916A01, 0x1D08E03161CD4, 0x532BBA7D7A69F, 0x0173958E476ED },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x43BCE7F21A506, 0x19686C8DB0947, 0x6F8AC1D83F7E8, 0x39EFD0353341B, 0x3AB947A71A6F7, 0x400F1CF5EDD19, 0x5D866BFFF346C, 0x60BA771340AD7, 0x7104F70362A95, 0x014F09EAE5BFB },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x7C98688F8C1BC, 0x293612A9329C4, 0x5BFD184437CAD, 0x571FCA7F994FE, 0x3363AF4F048C5, 0x4857E8B50BD20, 0x5508E7417BA11, 0x61F1EEC7AC491, 0x2B27C48E9BFFC, 0x01CDABBFF352B },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x577842B0F8A54, 0x233F8C3D73060, 0x589DF1BEC9D84, 0x471BED8383C16, 0x5804C34B2A476, 0x634EBA1B7624F, 0x1F3A3813ECBE2, 0x5B5A73FD9899D, 0x32CDD6A4106B4, 0x00E019F995C1E },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x3E3B5714F0B69, 0x55267F2F6A229, 0x157DEF9D5D25D, 0x2A720A2EADE7B, 0x5A03C33012593, 0x58B39879419B4, 0x3B9431B164F02, 0x03A059CFFB2BE, 0x48CFE2C486FB6, 0x00D8C9A55E514 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x3C661F480CF2F, 0x05005A804552F, 0x25E7EDF22F3D2, 0x45054859CA0E7, 0x756FAEFBA59A1, 0x7F7FE0F680ECB, 0x7D3779280EE26, 0x29B17BCC66368, 0x42EF54C6DAF8F, 0x012A671E32394 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x4C8EB6F40E178, 0x596FDDC5707D3, 0x4DAD0DBFF4E96, 0x6B3CA2B777193, 0x27349F1A8E0AB, 0x2D0D12838EB48, 0x3D64416F112CE, 0x1F7F3F775C2CD, 0x4829A68B4106A, 0x019A8AC80847D },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x2549DBA119C3C, 0x5A002C6B95EEB, 0x2BC2C89355A64, 0x24FAA4D6BF4E5, 0x14A26AF6C6D71, 0x4F576D4A1D100, 0x7897DEBCD10F6, 0x491F8A2B9632C, 0x0F3C8960C35DC, 0x00D36B8A01E43 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x0B45A5C8617CA, 0x441F31D2604E0, 0x0209BF1D37088, 0x4B264AA1B3DEF, 0x09B68D88A3AE8, 0x3E27EF56B4F18, 0x1B83CFA1E7AE3, 0x3D7CB16EBBC92, 0x4516308D611EA, 0x01473E21DCCEB },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x5ACEDCA8E5EEA, 0x4847C21605EBB, 0x0B65E1DDE7200, 0x67DCA688B9905, 0x1FDA85EBB3053, 0x7052CAF3BB3BB, 0x2C0AF575ED87B, 0x587E0BA3FA377, 0x6817E083613C4, 0x012A81D9F42CE },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x7E56BB79311FC, 0x31087549A9067, 0x22A755934CD51, 0x008195FB1ABBC, 0x4FBC98173CBBF, 0x753C575C7FF9F, 0x079E2C9B046ED, 0x0196371D02676, 0x10892077B88AB, 0x01CAB83997FCD },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x5227005310E78, 0x12A7876841CFA, 0x6798D65D774EC, 0x66D359BC25696, 0x51AB00F639958, 0x39099381D493D, 0x1D0C8F141B050, 0x51F5C68C38080, 0x3B45E08CF6BAB, 0x0105A62E1BFB1 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x01FB93DBFA764, 0x2A87A00C4CD30, 0x50C6688071FC3, 0x5FD30E2E7FCE1, 0x593BC43AF01FD, 0x15CFE8AD709CD, 0x4F47233D5D6AC, 0x6F0A5B1E49ECB, 0x090B909056EBE, 0x019A693E204C6 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x6BB13B3AAA4E4, 0x441DD0B1C27D1, 0x7BE001BD2AC07, 0x70C2B00EF1D22, 0x6A4A18FD3C39B, 0x51C3A2441F29C, 0x43F962F02D4C4, 0x1B4BA253C5CCE, 0x68A1AF2E9A489, 0x010B694B340EF },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x185BD5EA73360, 0x4808E23C54019, 0x47A203ADEEFD5, 0x02757A5D35B14, 0x5C8123AB1F0C5, 0x180BABCA72FBC, 0x0B090DCE1AA83, 0x1005FDA1CA8B5, 0x265760A5DBFC4, 0x012EA318E3235 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x7070D7120ACEC, 0x6C5ECA6371E5E, 0x69FD0D38E5D0E, 0x253C62642C837, 0x48338BD5DF044, 0x043919C70C101, 0x5E07585089EFE, 0x408D7C29768E7, 0x1208A8A73211B, 0x00F028969849E },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x36FB7B2D645C2, 0x66730600C5C74, 0x6087EE9B0B666, 0x0563C86F0E0FD, 0x12938D5D122C8, 0x20A9FD5E332C2, 0x3D72CA07A0FB1, 0x2D9FA3AD61016, 0x7026D02634046, 0x01ACD5DDD597C },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x131C33E21CFA0, 0x785476F4FCE6F, 0x1BD6113582D75, 0x4BB939F7B9627, 0x352ACDECAAFCF, 0x3384ACB512448, 0x5EEE16E0E1525, 0x219F28E000FF2, 0x692764FA060FA, 0x00FF43BB7DC90 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x6A5E2ED09749F, 0x261C7AB481350, 0x7472937815159, 0x001FEBCB20514, 0x6BFCBBB13029A, 0x0AE374706D656, 0x3B8003F9D5711, 0x032DCAFFED23D, 0x2E635073871DC, 0x01CCD6E6CC0D9 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x254567E955A99, 0x3E7EDB91F4437, 0x6C64C722A5A04, 0x2D895382868F6, 0x5E44334AF2F14, 0x4367B931CC2FA, 0x231702FAB18D5, 0x0B1088C55CCEA, 0x36BBFCC6FA2FE, 0x01170D547367A },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x57B052DED27B5, 0x1AAE2DE97E780, 0x35BCBE4DFF8F5, 0x2FB4672921B00, 0x47DF0036F6A14, 0x618341B705EA1, 0x413B3B9DAEB2C, 0x21558D415687C, 0x6F9334C44E7EE, 0x0175265E87FF7 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x6E49C05183EF3, 0x13FDC359D3F07, 0x3C011ED162004, 0x1E39651B9308D, 0x1D890C8397A7B, 0x5FC482452477B, 0x6F7B789A42A29, 0x647092E065C96, 0x5C7D589DC887F, 0x00B89FFC9C626 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x60DBE44F24008, 0x2B4BD302D160B, 0x320D2A63BE35B, 0x63850BEB9B949, 0x42AFEC5770079, 0x5FB15F1F7BE37, 0x4D88BCBD2543B, 0x6FD9A7390EC53, 0x5314B06E2EE57, 0x014191194FC6A },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x7CF9FEAEC802A, 0x5FC09D6FB5C16, 0x30B54248F65BE, 0x5731081228DF5, 0x00F727F8E959F, 0x7200A4C8A02E1, 0x6CC9542FCFBEC, 0x7A3D486E0352D, 0x524E0CEAAC419, 0x00D4473D2B53F },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x4DD7A58D00D4F, 0x177E9D66334BF, 0x17C9B3C0D5212, 0x4A16349848DAA, 0x60C4ADA94F1ED, 0x43080C89695DB, 0x1109169BD9900, 0x5013B7148D60D, 0x56CDD0C3C827B, 0x0187DB23EE065 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x308DFEFB14CCF, 0x2706AFC47ADB7, 0x1564F080AA362, 0x2E921A311E239, 0x2310211C0F4C1, 0x100385CDAD055, 0x0F5607351BB5E, 0x4A0B38F7BFCB2, 0x69B72DE6C2ED7, 0x0112C0E6EBC4E },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x745AA4FB42840, 0x684FC49F13C66, 0x09F6F144976BD, 0x2C7D479480CD1, 0x2D5ECA03EABF4, 0x72FA0238FA7F7, 0x2C50578469EC1, 0x0803113285CE5, 0x646B0D9A6CAEF, 0x01A61FA14EB44 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x74493C47AC02C, 0x1738ECA057BFD, 0x08DCE833BEF00, 0x1F6ED6EB08DDC, 0x795FC498B11EF, 0x18DF23D4AF166, 0x23634F297B4A7, 0x5089CABD07231, 0x31CA6D42D2E93, 0x0157142324BB8 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x610755BDB2097, 0x5D21AD08DC349, 0x353F4D254B066, 0x0B0366AF0D119, 0x174B660AB09F2, 0x34E13DB771F59, 0x78238BB72E3B9, 0x2D1F9F1256563, 0x793D20AE2FEC8, 0x01ECC014443F4 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x19CC1445D4E53, 0x30C3E398F0F3D, 0x299026C09FF11, 0x60F136F1B8B22, 0x7AD42304FB941, 0x0562BCFEC0D82, 0x7441380A242E1, 0x504DF89BF5BD3, 0x57B9E41A1FD6C, 0x0100F5B98A09D },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x5E8D16B123EBE, 0x13BCDE3C2EE98, 0x554EEB7B2D594, 0x2325711FD20CC, 0x24D957A9F0607, 0x2E565E16DD626, 0x192C052881A4D, 0x3EC05B02C68E2, 0x2689CD002B2F6, 0x0124BDFC3B548 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x65A5D5FD4F228, 0x098AC919CD3CD, 0x1310F68EEAE8D, 0x6A2CECF62041A, 0x5155CA76A890C, 0x16626FF1ABEF6, 0x2EEFC378E0D53, 0x10CC29D4BB893, 0x36C18DB83FAF7, 0x01208C648E4F6 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x3FCDD228B87B0, 0x5D3AEB4F4E94E, 0x132F5789CC7BE, 0x48AF1F9162D0B, 0x0C3A2319E05A2, 0x6285F985D0B61, 0x60AC1E5853C64, 0x7D8C10A9D8DCE, 0x454F7C7F66C5C, 0x019B8EE13CBED },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x10E8670E50F56, 0x5154229EDCDAE, 0x68ED3B5B1CE52, 0x43AE8857980A8, 0x5049F57385BF8, 0x50A04D91648B6, 0x7A28E8B294E2F, 0x5B8F1AFC904B1, 0x0D262B22DDD88, 0x01516D637477C },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x32DD31F4F8682, 0x2F2589851A197, 0x3CAF3EA1225D7, 0x1A43CE480FE41, 0x4A17E266100F3, 0x44C9328997ED2, 0x2EAEFF94C6FB6, 0x6578D2DC57CDF, 0x54F1EC6D29D3E, 0x01AA711592AAD },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x1C40E3120E966, 0x02E40BB0CAC0B, 0x21EC2F31F58FF, 0x00033218C1A30, 0x0FFC73CEAAAE2, 0x49EA88AFE40BE, 0x7ABFEED2CD100, 0x0A106B588BF7F, 0x5AE7B3AB96391, 0x00D85CF440DAD },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x2658883A403F8, 0x26FF417E16359, 0x24E6A618C1B85, 0x14BB8D7FC5722, 0x08887E950EDDB, 0x05A0C68462588, 0x318B5FA441532, 0x76A5B7343F407, 0x2593385FEF216, 0x0160DC455737B },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x233E6A903FA1E, 0x77403450158A6, 0x1FA8F2EB7781F, 0x5AE9258CA5AC9, 0x69FAF9259EF30, 0x0B9B0DA7ED5C9, 0x0572BCCC8805F, 0x6B87A2159ED84, 0x766B9E1F38789, 0x0151014452B8C },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x43C1A4FF9ADA2, 0x731DDA0371D29, 0x16D8E31E27666, 0x7DDEC5885E0AA, 0x764F8AFFA11C9, 0x31BA12666C98F, 0x4A1834B26E488, 0x7045B0A75E49E, 0x4C2377E09AB45, 0x01CBC63BBB5B6 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x145D6234C55F6, 0x4490A05DB7DB6, 0x26E86F3061261, 0x75D11034FE525, 0x33BDF480A7C86, 0x6009CC8BB2420, 0x13A6C9078E559, 0x3FF5547728756, 0x6DEAC5E11B2B1, 0x00FDDB6AF55FB },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x2445D4686F2FB, 0x65F9194EC51EA, 0x3352ECBC37E31, 0x318948F4C43CF, 0x3CDAD61074486, 0x55CF2E15B7984, 0x67F3DC9EC88EA, 0x7A5BB95E0A854, 0x661E4A2C00A01, 0x018B652173E15 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x44E25F6C0D0B3, 0x58F8ED47AB5CE, 0x710132E8E62FA, 0x152AA63BD9006, 0x023BA6717D87F, 0x2BC3B3B594C9D, 0x2DD780519CDDA, 0x02C70E5867EEF, 0x166C4F11D47E6, 0x015DFA0EF7E5E },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x3AE2C6FDBE58D, 0x6133961928343, 0x31380E755E968, 0x4A7B8148E5F85, 0x4925F3BF8669D, 0x2BD2B37C5AC59, 0x1E7A6CBD6E13E, 0x5743D8613292C, 0x3AA00586D0DF6, 0x01CAB500C3199 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x23083FA9E434F, 0x6A2E13C7D977A, 0x0B6C987973D91, 0x64B5D3B6D316B, 0x02B897E023479, 0x3B5676909A8E2, 0x2DF3C6DF07184, 0x61F7CBABF037C, 0x77A3B16FA062D, 0x00E82C291948C },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x1910CA88DE466, 0x11AE1A2B85264, 0x2D188D131ADF2, 0x38A238607EF1E, 0x3C558870D15C4, 0x152F91EC9FF05, 0x140F537233728, 0x278A69284C5BD, 0x3E9015695AAB3, 0x01ED2F94C15FD },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x30C719986AAEE, 0x04F2DE278F4EF, 0x0F010B34ED186, 0x417B00C9B54C0, 0x3707139BEAFD2, 0x6ACC68AD6AFEB, 0x22AED9B84D8C8, 0x306E8F63501D3, 0x5BFAB1FA4C203, 0x00F54B8C25646 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x7EF16A84922E5, 0x534DEE8F4C304, 0x1CD5D17D4F6A2, 0x7772F5D785DDE, 0x7644C03442D54, 0x0AD563FBFB59E, 0x18EE44031330B, 0x3A5F85C391127, 0x6CCE2D4D3B0DD, 0x018347EA2BF63 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x5C180695EF635, 0x0E7C880AAC1D5, 0x058132F72D2C8, 0x45CD018FD3A15, 0x03ECE98ED2358, 0x2DBC84FF34C45, 0x4CBC6F8EB00E2, 0x315DC0859E95B, 0x28AA6BB68873B, 0x01464AAF754D7 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x2955FD45DF522, 0x7896892D3F144, 0x26A6AD89F9131, 0x76C9E98D57FC1, 0x5718F0920ACAB, 0x2FA7D61924CE7, 0x6FDC5C0E982BD, 0x245C93F4BA830, 0x1B90374029E09, 0x012856F2ACFAB },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x092EEFE4D37A2, 0x3FB6561F930E1, 0x04A69874BCAFE, 0x1AD8237787152, 0x23342A6E4116C, 0x3F339EC08D150, 0x45E0C2CE93FC9, 0x2FFEB88736674, 0x265352CF86C41, 0x0114D70A16CAC },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x2495914B84306, 0x064BE8663E55B, 0x486294050CFB2, 0x45C7C6718D73D, 0x08AC471E1DE1D, 0x41231869E28A5, 0x7672B1735C776, 0x3D3CD0DEDADAF, 0x00537BA53E988, 0x018E9B7CFE58E },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x1E10C6152DA88, 0x28A75E5F727AD, 0x1B46927BE8F93, 0x19B8BD1645C18, 0x43993DE73C279, 0x5917841DF2E07, 0x2452868954431, 0x558627654AA44, 0x5C3078B226E50, 0x01480F94B3DFE },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x126C8515EE20A, 0x719B8A9027A7B, 0x0C26B83631449, 0x2A135F95CEA06, 0x455E1FE5D3731, 0x422430DC69C91, 0x1454D8C732F48, 0x1AA67C9919EEE, 0x43F87A2332B82, 0x01C0850628F7D },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x6F4C737326406, 0x3D7B303D3559F, 0x358586039EE94, 0x3AC5448A3E9C0, 0x44329EAF2522F, 0x7FD7E21F539AE, 0x3DB0AF1A91C08, 0x01FBED01C3686, 0x0DF61849F43CB, 0x00F0470E41FD3 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x40564AF2BB3E9, 0x75B990AD22DED, 0x714B78A3B6712, 0x03F33FBB5563D, 0x69AC8C4158517, 0x74DF1D08CDD53, 0x442766E646766, 0x28254C208CF57, 0x78A79F591FAF7, 0x01648BA810CA6 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x2CA583C5B447B, 0x0F76DC986C8CD, 0x14EF9D34A6054, 0x79A809C13A197, 0x17FCD959408C6, 0x05B37ACA9C686, 0x1479DB0DA3F2F, 0x1A047B09874DA, 0x785B4798B3860, 0x00ED773DCE0E2 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x237AFCC93F2C9, 0x2D644C47B53DB, 0x074B44819EE5C, 0x09E8BCF0F8C50, 0x698C758428797, 0x270605F85779A, 0x2A7A971F1E75A, 0x31B6EF827090E, 0x32FA872E1D9FD, 0x01E5A78E156D6 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x288CD6E30B5B3, 0x1154891D25F2E, 0x49929233F8875, 0x057FDC8AFD50F, 0x09E1730830A3C, 0x2A3A33B4C506A, 0x588701B006100, 0x7B7DCA55EB568, 0x1B8BBABA159D5, 0x00F409940D4F2 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x6B8BC2A7C19BA, 0x7D9614E1E4E28, 0x2DC9C94DD1D65, 0x60E80F78B84B3, 0x0D7103F7C332C, 0x12A2C3C92AEF3, 0x1970C079FF429, 0x25F412FB0BA0A, 0x73E6AE4CEB638, 0x017F58CF4F175 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x1EC04F1DAC1DE, 0x0AB4FCD43C5BA, 0x4400C5BEDB3EE, 0x4214DDF9D9069, 0x141313577E4FE, 0x14C015ECB53DC, 0x367A5AE38E774, 0x2953055EDB72E, 0x00EA7C89D23BD, 0x00A80433B396B },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x26A703F6C4635, 0x123E3D444AE9E, 0x381F4C7B534DE, 0x2EECF2600FBB6, 0x2E9CB40C5E1F7, 0x245FD77650A1B, 0x0383B40942DCF, 0x0AA5958586810, 0x6AAF145285D2A, 0x008512CD805DD },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x27539B1C0F871, 0x36CE63CCC5610, 0x3097E38E1AAAB, 0x6815B0DEB16B6, 0x434168F73AE3E, 0x0EE6B5B4A5A5D, 0x0D7482C1ABFC2, 0x71E19F35E9F99, 0x4A74C66776E73, 0x01533C5BE1271 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x109C382B5516F, 0x6DCE26C40854C, 0x065BC4F976381, 0x2C8265486089D, 0x7C63CF083A895, 0x19AF26C20EF73, 0x0108F5378C898, 0x30CDB765C01B5, 0x584014DAAD820, 0x018FCDAB64293 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x0E19C8E734D03, 0x2E0EF5BF93ACE, 0x4835B55992A50, 0x1791CED619E59, 0x0A125C2EB9305, 0x11240E1262F30, 0x020E8EEFBDE01, 0x1F8AF3384576B, 0x63AB63D611917, 0x01708C4A922AA },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x193BBA6F3AC15, 0x6A076EC1AE78E, 0x5694E97005A48, 0x098BC7B3F9E9E, 0x75B05FE8DFF17, 0x08C6F15B12FA0, 0x7DAF9FA80968C, 0x41FCEB2BB7BB8, 0x2C0641061C99F, 0x013905199B0A7 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x403E2AFACE45D, 0x5B428C5647C9E, 0x6F1B9875A618C, 0x32C5BA9E03516, 0x1C69DC1A90C6F, 0x4200FBA50EF56, 0x5053A966F1EF6, 0x0E04A241FFD03, 0x29FAF62FB2835, 0x014FBA76842DB },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x3B7165CEA5853, 0x00761B0D3E93B, 0x6D6856AC345B1, 0x469558984B10D, 0x5EEE1B3EFF5A5, 0x085D2C5D19358, 0x27E216C36B4C2, 0x536810346D968, 0x5FB040AB204D8, 0x01849F5985B69 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x31DE3E0BA2509, 0x6A7B20A8B5DCB, 0x54EAACD1FF72A, 0x1236322584F64, 0x0B901F35E6E0D, 0x5ADC10AB6CC8C, 0x58751F24BB822, 0x1F06FAAD5947F, 0x3D71749DCBC53, 0x00ABBEDE50421 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x555904A956ED1, 0x5352DB8F2FBE0, 0x308874EAB2C2B, 0x410E256B2F9BB, 0x6049869544349, 0x5C28055B1CCCF, 0x2ED9B8289DB6D, 0x0B27D99A16A12, 0x5956F2A3BDE36, 0x01B66802E496B },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x48D54417373C7, 0x2E221C6ED1EC6, 0x7A74DFD669566, 0x30354869AB902, 0x3FE85443851E0, 0x325B13EBA39A0, 0x5E91FCC11B932, 0x162932456F3C2, 0x6519FABC1C037, 0x014C9BF4C64A8 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x38233F4C64F31, 0x786E6FEB1C2DC, 0x518E3CA2566AD, 0x15F87577FA129, 0x2709F7693855E, 0x244D63812FE1F, 0x657DDE6B5EF6F, 0x764B7F50498F4, 0x0F059164D6709, 0x00C78041547C6 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x38F82F23F842F, 0x37A22EF2FC3B0, 0x5C833ABF87230, 0x2AF7B36310FA0, 0x5198318814E0C, 0x560975C31DFDE, 0x72135C98A49A0, 0x7CB5160A3DEEF, 0x69B664E2496CB, 0x01BFF4695D2A6 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x07A40CD59C871, 0x3FC089D909592, 0x0CFCB462FF8AD, 0x627269C070C08, 0x321FD4A77F073, 0x56C246A8DC759, 0x16BD4EF102913, 0x68B0A3941D8F9, 0x3D3D35D754225, 0x0125912D7C167 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x4F3B1514FF1C7, 0x29CD16CA364C2, 0x75352BAEC6258, 0x7FE2794A820CA, 0x61B859D18C8E5, 0x1EE663EF3AF78, 0x00A82711A0BF6, 0x758ACABBEC0E1, 0x0D88CB43F7EAB, 0x00DED97D8852B },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x118C4B1E734D9, 0x136B6A81408F5, 0x09654B3AC84A6, 0x1263141895DC2, 0x15FF785F91F82, 0x799CF2BC8E666, 0x777484FE2171F, 0x19B488B1EB837, 0x09FDA439F6CA2, 0x019050184189E },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x0F19DBE22A8D1, 0x440EAA0071FFB, 0x30E2AE841E0F3, 0x043BF4ECA3EC5, 0x3F5FEF9683164, 0x73C3B8E06BED0, 0x4B2820E21D3C3, 0x34A1DFC4A3433, 0x749B26D2EE6C1, 0x00BE4846DDB23 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x572BCA5B1C578, 0x359A843A8F8FB, 0x7B3AD5EBBF613, 0x1A323EB5B068A, 0x354BFAB97ABA4, 0x5D1D123B0FBB8, 0x661E01E148EE4, 0x4D7F36CEBEE54, 0x28EA360333210, 0x013A99323D2DA },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x540EF1F20BC28, 0x2E5160F6E63FC, 0x7681FE39C6CEC, 0x343856B5CF706, 0x119B90ADCE1DA, 0x49F6B6EDA41B5, 0x7E28A4546EC92, 0x415AB1F833562, 0x68730CC5B9842, 0x012B75E7A1795 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x50A1ECF29C1B3, 0x3F74C2372B8E3, 0x6C3758665FE9A, 0x6B137C909A720, 0x738E0D123DA33, 0x55F09EC513F0A, 0x5832D44FA9249, 0x1BB03361CBA07, 0x05A23FA00F893, 0x018A026B095B6 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x2B34885CA7BCB, 0x57DBCB5D588C1, 0x7B9CA41F5198F, 0x7B96F0BD97DFA, 0x7D43532F053F2, 0x42F58626F439F, 0x70AC044BB85DA, 0x03622EB36BA5B, 0x6DFB663C339AA, 0x01009A9DB1667 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x444FB32951D7F, 0x48643E4401E6D, 0x48FD642E293B8, 0x32C7D3B6D6D64, 0x68EB266850652, 0x34A69CAA22C5C, 0x735A185E587A8, 0x3B5BD859DC9AE, 0x7808746E08004, 0x01C7AD8464737 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x525F094531E0B, 0x2D2B5B86CB529, 0x62B48748C9C5D, 0x42471A3318250, 0x2E440DFD8C9A6, 0x48804BE572D8E, 0x6B6BD7F113BB8, 0x68C1DEDAACF37, 0x216C78C5A8DA4, 0x0102630E740AC },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x397A6883C45F6, 0x6511707D12249, 0x15CBF46B6A8DB, 0x3208C27799D48, 0x0F4DC42563DEA, 0x39B4D248B33DA, 0x6D2E9E58D9412, 0x33CBD1ED05EC7, 0x71C0A357EEB7C, 0x01702859698EC },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x3C1C4D00F4892, 0x13D616FC1C7F4, 0x3D0A301A2B631, 0x7D0FA5CA227D8, 0x5FC2962611C83, 0x2498605ED3724, 0x2097E20A80868, 0x259305DACBA6E, 0x3D91D1A57297F, 0x0123B222D099F },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x6D97155CCC929, 0x4915000E902E3, 0x1875E88AACF48, 0x7BD1F4D477B0F, 0x1DB096903D7C2, 0x5BA0C9B976287, 0x4CB6D6B81E2BC, 0x310B76AE0AD65, 0x46B8D2E004E25, 0x01658E1E0865C },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x21E4478B95761, 0x26A7EBFF7A1F4, 0x52D703D4E157D, 0x292DDCE2BD6DC, 0x6F9481419D5ED, 0x35CB3A1C2541B, 0x4A0541F31C229, 0x6170127C05156, 0x0D885D7C0D962, 0x00F9FDF6DF40A },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x3A19958B7C197, 0x7E85C8AA62789, 0x0CA04C0D4B1C7, 0x303D8F4BC0C20, 0x3AA5E86F94D82, 0x7732169165E46, 0x01B47FE7F7D70, 0x194A632DF4046, 0x0A0ECF69C3FD3, 0x014828A36FC7C },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x73C2E346CD1B5, 0x008B46890E0F3, 0x00F09E51086CD, 0x14C9F94CC44BC, 0x5718D0D37906B, 0x040EAD4BCBC82, 0x75A730F794EC9, 0x0EC599C3A1598, 0x0BC29B201880C, 0x00C6D6790215A },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x7DC98C9905495, 0x51EBD7E762757, 0x1765997D7426F, 0x13C340CF507CB, 0x5ACA17F7D6DB1, 0x75A7AC18E9A6C, 0x318981D62DAF9, 0x2AAEEC908338B, 0x7CCEAFE2B4FAA, 0x01A0ECAD36F20 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x221E1EDCEF149, 0x241996482307E, 0x0FB6508DA98CD, 0x7972FEC4678A5, 0x3BD5F6CB9B768, 0x29F65213EF94A, 0x11A7A206AB003, 0x7CDF65697DC03, 0x08F8DF228F573, 0x00BB5CEF3C4F2 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x2127A052A8EE9, 0x0BC337FFF8607, 0x10CC67C0090B8, 0x38C7723C57DEF, 0x2F7A168CE3DF3, 0x539DCB409BC92, 0x7D024470BD416, 0x4E6B5532889BB, 0x1BCB7AEAF5005, 0x018CBE28D0B77 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x6D61515EC2FD1, 0x62A11FEA670C0, 0x33BBBE488AC7A, 0x3A8F67F93E6FF, 0x6DF634D5C538D, 0x0B77ECE77FDA2, 0x279CECBF35AC8, 0x12B8F3359AC14, 0x316E107CEBFC4, 0x0091F2399719A },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x1224D6F5F470F, 0x25A060C057C2D, 0x21C4E00DFBC34, 0x70D2037E389AB, 0x6F27C667F2F7E, 0x19AD00AB8EC69, 0x009C809235658, 0x289363F99807C, 0x529E1C1A25ABD, 0x014C06FEC8A58 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x4EE295D30EE07, 0x732CBA2390DA9, 0x7BFA10CA4ED10, 0x70A51215A22EF, 0x393878EAA5A58, 0x13323A3A0E048, 0x70F9CBE2119C3, 0x461981094E3A5, 0x762C26A988940, 0x012436A3A8725 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x116F780A315CD, 0x2B51F6712F708, 0x03C4B2B12CC04, 0x691B56929CCB1, 0x43B34568B7022, 0x5F2D1E847876F, 0x4432D6D82CB69, 0x3649565AFDBAF, 0x125A334FCAD1C, 0x01211A2C37F10 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x5501096A3E8BD, 0x4E54F32E4E64B, 0x066ECB1647644, 0x0A946F496519C, 0x40F264DD82A2E, 0x6D6CABC0C77C1, 0x2005AB4518EA3, 0x707687FEFDD85, 0x2EBD52609F57D, 0x010010CAF83D8 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x3F22695B9FF4A, 0x3EBEDAF0C493F, 0x58051888C5ECA, 0x1F38BAF534EFD, 0x4D26C2C5A5744, 0x188E71D4C7D5C, 0x1F11DEFCE606B, 0x4B63B365EE61E, 0x75EC1C65D7515, 0x01931456736FC },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x0E98A637877CA, 0x5F95B2B9F7300, 0x2C94C50934775, 0x04FFB14DC6111, 0x47D45C3072FD5, 0x3FF31825FF6E9, 0x12C0EE27E960D, 0x7B66F5FBB23B3, 0x216DC54B9751A, 0x00FADAD69E37F },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x519691D9882AC, 0x2ACF90E99E153, 0x63DBE67E97C4C, 0x541AED01D6E76, 0x359241E30EDAE, 0x11451AAE04DFF, 0x708990FFE4941, 0x1B7EC60FAA09B, 0x25CC38718503C, 0x0189CACB5DCE9 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x6C7DA21B5966A, 0x7EFE5CDDC3C4C, 0x5F7F009AFDA11, 0x29DB61FCE237A, 0x5C720225894B2, 0x707E84AF0C815, 0x461BA5395D950, 0x0D5ABE1834F88, 0x3842FEC9D26D6, 0x0108F10E6CE9A },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x0AEB2429831FE, 0x40E4A8157B634, 0x34CF1C9D29294, 0x02ED35778FD3F, 0x2EE47A8C03942, 0x7A08A7A6B1AE3, 0x0E8ED66750B53, 0x6BC51AABE1224, 0x5E772D86F3F73, 0x01B34A642955E },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x363F5E67F7674, 0x05ED2116AEE5A, 0x0C415333B5AA5, 0x27180BA461404, 0x586DD06E5A5FC, 0x7838ADCC1D600, 0x78F9A57B9BC33, 0x4E5533C833690, 0x328858E8377E2, 0x01388230C235F },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x1DDF3AE893E72, 0x7D4C3C97399F6, 0x485263916A058, 0x3170E25CD1FF3, 0x778B8E2CBC97F, 0x1A4EFF95776FA, 0x6920E845568A8, 0x3DF8BEB1A41D4, 0x489A37116D2EA, 0x0185C888F7EC9 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x7ED638DFD547E, 0x2A18ACEBE85C9, 0x4E74F6C1ABC04, 0x0AFFF0B07D607, 0x07BE1437E87A8, 0x0BA75CE354772, 0x43264A6093521, 0x04D31A984FE92, 0x663E78BFB68E1, 0x00BF014C8D094 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x28B3D2798D96E, 0x173CB9246AC33, 0x0519B2360DFCE, 0x0805007BA664A, 0x58D673440658C, 0x5D0299F463398, 0x5BE8CE056FF3A, 0x242C20B735899, 0x6892E438CED1B, 0x01ACF3DFFA792 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x5F8A8CC3FA232, 0x0E246B2EAB1DD, 0x6B42A2B4BC1D3, 0x1A8695B2E0E03, 0x6B9282034EECC, 0x1EBFD2E06B64F, 0x1A8B0CFB541FF, 0x251EA6C9AC715, 0x17A347336E490, 0x01177E1691759 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x7AA76A5E99AA8, 0x684A60F25FBCB, 0x19850A33BACF9, 0x04473CA48D7E7, 0x59C6CA8DEA44D, 0x091A7A3CB1297, 0x1800172B2F51E, 0x051BAB265CD2B, 0x0685A03C77C08, 0x018D4BC0C42A8 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x7D515299B37F8, 0x713EE67F144EC, 0x40743A9116F03, 0x06C74E263D74E, 0x5E5205D6A70FD, 0x446E2A48B40A5, 0x5B7F9A4928C8A, 0x061CFCFA17CC9, 0x6A251BEBD0095, 0x00F8A3BE9923D },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x525965CC71B36, 0x7E021D29B48ED, 0x3DCE18B4AFCDB, 0x028B524AEC3EC, 0x72A8A24E14B10, 0x449F133E18BCC, 0x3B6BDE8B07E11, 0x395C5C41BEA0C, 0x15E7A8EEF092E, 0x019A7B8DB9E2A },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x6713E75DCEFB2, 0x2A37F39B4152C, 0x5302055298525, 0x6B996EE8EBCFB, 0x7D8980AADC7CE, 0x30740BA47DD09, 0x273232F6B0518, 0x2390B23124998, 0x2F1542BC2A7B9, 0x00D38337400D6 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x6AF4710D0B094, 0x49723D5051E2F, 0x791FC838DF6C7, 0x76C6D78D5A969, 0x06DC8714172D4, 0x232D172DD0D8A, 0x2ED18AF28094B, 0x4920D02C13E71, 0x7B3083592B99C, 0x01C8BF752F37A },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x48A9542B4A66C, 0x081E7BD49F019, 0x3A8358BDF15DC, 0x7894B79398E81, 0x4305EB427A57E, 0x57C5DA692E2F6, 0x4864F98E601A8, 0x16B69EECF9F85, 0x180AF708831FB, 0x00D43563D990A },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x5FC6A931BF107, 0x3B16D97DF9084, 0x26145E4A4E232, 0x6A2DB5FC92888, 0x7ED8126C7982F, 0x0F2D1CC0BA3DF, 0x7C7C23741CB10, 0x4FA09C05FF764, 0x27F098264F15D, 0x016DF0BE5194D },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x764992A1816CB, 0x40E1CC86ECE8A, 0x51743539C4B20, 0x20D58EEA65260, 0x2B9DFA1CB9F0D, 0x74352B77032DD, 0x5FECABF262124, 0x7F997E8E230A2, 0x05511852BA6FA, 0x009C4A8E52197 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x5E703D22908E4, 0x03A733CC31E03, 0x6F9BADA90FAF4, 0x713ACC7B4CC78, 0x4B3B0B872481D, 0x25B9B5B52D434, 0x132B4D90B7A33, 0x6CCDADD92C416, 0x145F056EEB4F7, 0x01DC54FABBBA6 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x30581DDE53BDC, 0x36B7BAE6A14F8, 0x57FD51A48AB1A, 0x63BDF6520D819, 0x0ACE472052CB6, 0x3ABFCA71CD0F0, 0x285825E0D85B1, 0x0BD7DDBEF3CF1, 0x4BAACF84EAB43, 0x0109760E388E0 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x63BD161E52522, 0x1D901963B05DE, 0x66C1CA1770B9C, 0x771F4742ED6DB, 0x2328316091DE8, 0x64BA076174DA8, 0x4E223E97E4337, 0x2CB0FFAA7C98C, 0x68E1EE3775F2F, 0x00CF0B17D73FF },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x2AE412B386D84, 0x4B59207E1C09E, 0x479FFA3DAA5FA, 0x207905344A8B4, 0x4A465611E1C3C, 0x4F124F387B1B0, 0x3DBE8C9D06841, 0x305CE1AD749D5, 0x5F07B277C257A, 0x018E4A683F1D7 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x5DCA6388BFEDB, 0x28D7081F7866F, 0x2242FA0629E50, 0x5E980C167C20C, 0x11CC48F28627C, 0x337497AB81328, 0x3C0749DA3CAE4, 0x630E79B36F9BD, 0x02B649145F280, 0x01C45D28A517A },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x6473E46AABF91, 0x649DE9C918854, 0x44BD326061FA3, 0x0690A84C2B890, 0x734E10A483303, 0x6A81B71F8269A, 0x37FE1D5A2F381, 0x418DC459F3BD3, 0x7F84BA1267548, 0x010A99F210A6F },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x192FE8BD51A30, 0x2C1332ED93299, 0x7949B1D32EA94, 0x241444F796AD3, 0x5C54DFAD90532, 0x23E0DC5C51E5F, 0x4CA2B42A6357F, 0x6ACFF192A0297, 0x13D2BC4AAAA65, 0x016960D68B532 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x6BC129A604214, 0x659BDB1BDE93D, 0x4D93E69684FA4, 0x5C536573B7A74, 0x482D9C812E00E, 0x22D779098C1EB, 0x3FB59137E6403, 0x6EDD37B063FAB, 0x4BB6FC5BEC4BC, 0x00E65F9BE6E17 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x25546C2B151FD, 0x5FE649FB02488, 0x721BE53C0BADB, 0x4E024CE2853D5, 0x685356038D4E8, 0x6ACA20EEDACB7, 0x2FCE4B1D2BBEE, 0x1BE0F97C6694F, 0x28852E3B616ED, 0x0193CFD578A04 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x5BCF21D594557, 0x1FD0114B8937D, 0x2A50958546D30, 0x43B33DD8BA9FF, 0x0BD041BE68062, 0x35AD3E075A9E0, 0x725D75CF3619D, 0x74898C3BB64A2, 0x1FFF6F7AFAD1B, 0x00CE8B5BF8C4B },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x6C6260B8F3D14, 0x318C1CCD7F32F, 0x232F3C6278D4C, 0x20BE5F6B0EC7A, 0x52027134F8A51, 0x4C14E9BB99AEA, 0x32EF997E64145, 0x549B8E0E7B00D, 0x38756C02DFBAA, 0x01589A66C4A3D },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x37E8440B195A0, 0x1F259EE5F0029, 0x1FD3A67EFFDB9, 0x603A2EC292402, 0x49A0635D42723, 0x08737F7849FB1, 0x2E6A71484FC70, 0x68255DE09D71A, 0x7AADF065AF094, 0x0103E470CE38D },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x2F781D836D40B, 0x03C10A06BE16A, 0x79FD93C5FAAB1, 0x05FE66A63F8A3, 0x101F990CC1704, 0x5114463A821C5, 0x15BAFC499C123, 0x0F577B03DD748, 0x025CDB4CC0EA1, 0x01E76CBAB7522 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x7F6971173A3B3, 0x074481BB00541, 0x6DBFC80BE3111, 0x7B2746307F799, 0x36B3352193383, 0x2F4E6EC61AC41, 0x3CE3C2230BAD8, 0x161EF13FABDC1, 0x4321F92990369, 0x011A64A8A3DA1 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x79999F67B46C2, 0x1086660021944, 0x1F97B109786E1, 0x01EB53F10D107, 0x5F3CEF311F215, 0x7D422F78EBEFA, 0x5A7230F40C45B, 0x384501D49D1F1, 0x7096950302208, 0x016E1D93582C9 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x27453D14A4D4C, 0x287F413B50134, 0x743492DCB46D6, 0x682C862939B02, 0x6F8EF1B395A9B, 0x694375E7378AA, 0x35FB4550DF0C5, 0x204244AA5685B, 0x3AD724EF0EDD2, 0x00CE8B4F331F1 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x3BF5CB36E9957, 0x2BEF64DB295B9, 0x62D141E7C96AE, 0x192E246955BEE, 0x2DC3D3B301376, 0x18D84F719CECB, 0x0B8434E0C6100, 0x4092147F5ABD9, 0x0A3FA5C684B76, 0x01730F732E512 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x660C476A20FE1, 0x4A8B4E64A95FF, 0x36E248BFA1918, 0x0725D9710B3A9, 0x09E9E698869B8, 0x6E140DD6336CC, 0x7A79CB912DA94, 0x13CF33B832333, 0x4716322C815D2, 0x00B7CD7DE670D },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x62818A00FEBBC, 0x2D8EC5DF96555, 0x0F76D2FC0282A, 0x37D20ABD793E3, 0x6437F715F4473, 0x11B8D666A318C, 0x48A1261C6E7FB, 0x11887539613E8, 0x283627C73FB8C, 0x01D0521B116CC },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x37025D01BD7F4, 0x5DA7473D7C150, 0x30981BA1E2DCF, 0x1EC3A7B371E3D, 0x4FF0E2CA5F0C1, 0x7926ACFCB3F8C, 0x3BD849DB4B395, 0x314B792A6331B, 0x69CBAFEA11BCE, 0x012FF00C1DC3F },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x140E04B803518, 0x606E3DF66B20D, 0x5C84522BDF0E4, 0x5906A0B3513DD, 0x3242DC94E118F, 0x098E27CCED3B9, 0x4906C0519DD2A, 0x1DF9A617CBF9A, 0x4223B5D65BCB8, 0x01E83B3400B80 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x239F2BEDC7668, 0x22A78236367F2, 0x32EB7D2EE3135, 0x6D6D094A24E30, 0x1EB24A7B325AA, 0x520D48461408D, 0x1ACB50B4AE0F2, 0x289A03DFADDAE, 0x31EFDD7CCB7B1, 0x010A48E91B79C },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x04A774C6D2C78, 0x31B571DAC203B, 0x4E8F033FE41F7, 0x4B69EE04F461E, 0x1760913BE7CB1, 0x14521E0EB83EA, 0x7506E91E8B938, 0x10CEC838C2FA3, 0x4661A39F566CD, 0x01894D0974D21 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x61CBB194047C6, 0x7631E61C24CE7, 0x2326FA7E6C69C, 0x46F68CA9D1B8B, 0x50316FA327D5B, 0x2B5DDFCD5AD89, 0x1BC7731AB2DC2, 0x190ED0B5FF690, 0x30D15D5326146, 0x00A0C833C6155 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x4863FE4F054C7, 0x5928CC86C7ACA, 0x55B1051B1FEB9, 0x3267664AF55E8, 0x2D75D17BE3B1A, 0x4098B061B7EB9, 0x217810AFB0CCB, 0x742BFAB16F02E, 0x3729F4C3F4D00, 0x0161C7CA12B3A },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x2A9064AAC23FF, 0x0987EFE5CA87C, 0x0E635E6F0058F, 0x74E430C717409, 0x209CA7E9D23DE, 0x0E9EDF1954C3B, 0x0BFC5DE700E3C, 0x3D30A2CD6F674, 0x05138AF01F5FB, 0x00BA36E922F76 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x51BE32B9CF866, 0x71D185034A6B6, 0x118574DEDBD61, 0x41147F9925398, 0x04EB41EAFFB2A, 0x672194F3A6B8E, 0x3D3D232979BA0, 0x709115205597B, 0x7E821FB001192, 0x0152C3F0846ED },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x2E87A6ADFEAB6, 0x609FC7CA57757, 0x0824004DA28BD, 0x41B6949C17FB0, 0x63170653C6912, 0x4590D1F403ED4, 0x41E0303D16FE2, 0x1F71ED9A5F0B3, 0x5F00B5CB6D2A7, 0x0150F749812D7 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x2FB26B8FFABF9, 0x5D05C9B7C9E6D, 0x7B7AE21CD57DC, 0x23BF55208C90F, 0x570D1814D7519, 0x4D696FBC26E05, 0x10E9B90011B6E, 0x4FD84A75EC313, 0x0636991D3C7D6, 0x0169BE94FAFC7 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x66A8253413EE1, 0x68FA9A24890C8, 0x36B3F29751670, 0x6765290DA9E4D, 0x1CA95361D7C55, 0x5F7764B996822, 0x40D79B62A05A8, 0x2A47B6BB9E05B, 0x788A44BBA74FE, 0x0155BC251D753 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x70B329ACDC5DB, 0x4A1EC6E03451E, 0x0585B5D704200, 0x3977F59602DA9, 0x6DA6C509435E2, 0x7F75AED021A00, 0x50E818A9655EF, 0x6B64B13E28837, 0x391E52B9B9C92, 0x01A30EBFBE4ED },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x43E4AB1EB8FAD, 0x19E395BD4C72E, 0x359BF65BFD61C, 0x58EC1D677401B, 0x1D517153E8F80, 0x5BFC4351DBA08, 0x24FC3A0748976, 0x5DD20ACB65C6B, 0x330B95C58EBBF, 0x011396AC1E0DE },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x3B77A7CCC142E, 0x03FBF7BFDF622, 0x7F90E632BD0B4, 0x0B721EED7CD78, 0x320A50C7F4829, 0x222CEA59BA5A0, 0x148452FE3629E, 0x20E1B5B342D2D, 0x1358B80B02044, 0x013761DBE131D },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x5B3F04DDE0B4A, 0x1651AE66C4B37, 0x6310498BF2010, 0x1DF97587DE4F8, 0x75CA089CEDE2C, 0x7EA56BF974C68, 0x6A99BE48CC48D, 0x16CE6F689E813, 0x533C215CA0324, 0x0108E6E2AC5D3 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x19E2BD09C99AE, 0x0FB0ACA667446, 0x2EBD20BC11150, 0x340AF187578E1, 0x6BD8D30C301EB, 0x1E04668739A4D, 0x434EF47FA3950, 0x5812F090DEB26, 0x0A276258DA78D, 0x01737A86E36A1 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x5DBB911B64BBC, 0x3C17644579A4A, 0x4AFE14985853B, 0x3509E943DB407, 0x1382DD416567F, 0x1FC616F218D06, 0x2BA5B9B798156, 0x154641E5FF564, 0x230AC96B4EB65, 0x0153BDB0C79A3 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x50D95CA679C04, 0x67AA4B33E9933, 0x59DFB97CAE1FD, 0x07A86ABD3B4F0, 0x6C11C64A3B34C, 0x45D0D007B8A92, 0x0A2FB073A5509, 0x2D8C50B6AAEB5, 0x28D588D5787B5, 0x0165F0F54C136 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x6D1D3535AD23A, 0x38A87A9758D62, 0x0CD795B6EAC4C, 0x640588D1AE020, 0x4923E6D0F8DAF, 0x2349D53C2FD88, 0x68522171DE043, 0x61F1BBF99DFEE, 0x7133C2954293B, 0x016133615F2A1 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x675219638D750, 0x28DA22108A8D9, 0x582CFEA9DAAFA, 0x359A8FE55A88D, 0x351BFAB9D8D9E, 0x5676981B57EDC, 0x4AF196A98698A, 0x7D4B20FFE1E57, 0x6D1DC2D850E6B, 0x016D364A8DECE },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x221C49868332E, 0x3CEF8FB242A29, 0x46B7B4BDFC997, 0x1E13291F43BB7, 0x2BEA431544287, 0x3695BDC3F6B1B, 0x1985CA0C86BC7, 0x60397B3295337, 0x06DFA21BB5EEA, 0x010BEA54CEF36 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x62CAFFEC7738E, 0x7051A0C693635, 0x182A83ABF2BB5, 0x45B8F67839D02, 0x77C42C4A05312, 0x4B5C2425A273D, 0x7960158670751, 0x4238D9BABA319, 0x7F5D64F4D364F, 0x01C1E341AEE56 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x2A280A120BF34, 0x2B27CFA46274E, 0x19F2AD6CDEE13, 0x0B46F5616FF38, 0x1876E1F7191C7, 0x094B1EC2469A5, 0x7FF8F69AC145C, 0x2EC7A057E07A6, 0x1DE28C807BEB7, 0x01411304B085C },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x48DE5371E1061, 0x4C3A46488C61C, 0x085BC8D0FEF43, 0x42CEE9834E4C4, 0x0F682F0976925, 0x6D22E3E551A59, 0x3786A41C9EBB7, 0x4372FB3F6DF1D, 0x5A0C90D2FFD1E, 0x01633D58B4CB5 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x68982254C2FEF, 0x56C7D1659FEF2, 0x1B6203B374A07, 0x65F241E8E2F4E, 0x6F016C5EA071D, 0x2249B8212A91B, 0x2443301E6B80A, 0x55FBFD24E1C5C, 0x6A02CC73D5CEC, 0x010CF527E4EBE },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x6406AB05E9849, 0x0285B2183E4AB, 0x4E9C730A0F6EA, 0x0CF2AA713D0CA, 0x425D828E108A1, 0x11987690F7B96, 0x71B2C22118111, 0x604FE96BB8606, 0x4CE77E7C9EE7B, 0x017F13EAC8415 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x31D54931D9AD1, 0x4068D89F36A04, 0x20BB12415E86B, 0x43F85177021CC, 0x5ADA2D0ACBEF2, 0x413940A97A1E3, 0x36906033CA458, 0x5127E7201A292, 0x798321452657D, 0x0095D839A81B1 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x18A1840D8EC59, 0x4C08FAB3B7C2D, 0x6AC532B09769D, 0x267A7F6F4493E, 0x39909104C162F, 0x0BCFE8447405E, 0x49A6D27B1A6E1, 0x690E40E6B1398, 0x189B4092E5547, 0x019FB5743B562 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x3017AFDDEC06D, 0x0BAC742B7E8FA, 0x0652BB4536813, 0x1DEBB68618D8F, 0x1192BFC0CDEBC, 0x6332401D37C30, 0x782016A675246, 0x499C53281B86C, 0x5F01E3BC3F892, 0x015CE98D82B0E },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x1EFBE666E528C, 0x76B742E0BB70A, 0x12A5D7EBD1928, 0x2B35CB514DE2F, 0x7E069225EC5EF, 0x389BDFF52E48D, 0x798BF797A8046, 0x0301E0D573828, 0x224450BD83EC4, 0x01889838DDE26 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x1BBA06E83FDC0, 0x1FB8F04B1A50C, 0x4E5868FD2F419, 0x35DCA2D22028F, 0x4CEC67063FF8C, 0x669B1D169AD4C, 0x469659C3F8FF3, 0x63C567D9CEED1, 0x5FA88D7DED041, 0x0109A88877AF2 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x7ECBEEA3E01C9, 0x05A235DC3BA56, 0x3BD3A5A578907, 0x598C2B96457B0, 0x3F731DB68ED7F, 0x3A57E4F54C6B7, 0x7DC23A6F54EEA, 0x283A316E84204, 0x38A5F0A0813EA, 0x0156C74BE57C2 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x708D94AE36EFF, 0x46A86B4B80DD6, 0x5D7516BD3CE0A, 0x77E2A6A5E4DE2, 0x4AE47AA2C6820, 0x5E3AF726CD453, 0x59E8297E6A171, 0x27AB9A3767297, 0x4B855B3079A8F, 0x00CAB50954712 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x2F797FD40C3F4, 0x7FDAD068A124C, 0x5CAB597D5D161, 0x2EF9A4AFD2E05, 0x00FB16B0C19FE, 0x278B6E65AC6D7, 0x67C32DC943645, 0x4073017BD2FE8, 0x61C49A846DA63, 0x01936FD0B31D2 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x48DCF73F650BA, 0x777E52791EA83, 0x61883F74233B6, 0x154CA10FD99B8, 0x7F748A0565CCC, 0x31649AA2E3050, 0x01C8EFB41E17B, 0x076E94EE66522, 0x5B70E7E7DFCB3, 0x015D95BFF7E5C },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x4DA4A5A5D3B5F, 0x4D6D8D7A031BD, 0x0179DF8C0808E, 0x50B67C01400FE, 0x3A94B019255AD, 0x7A4B2A3400654, 0x47DFFF5B096E1, 0x5C5E4DE4727D4, 0x374DEF4DB306A, 0x01482B2150C98 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x3A13600B00DED, 0x2783F1B63EC29, 0x5632F785E84A8, 0x4A8145E80CEE6, 0x353AE64C0C23B, 0x3DA52E7407090, 0x0F5D081FA1C4B, 0x0EB97C64F3848, 0x71ED42A2DFDD4, 0x010D30B9E0D19 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x20794D90ABD25, 0x57CA4F7F18073, 0x17465C0784379, 0x1201C2E0D5C8E, 0x6D8E62365026C, 0x31E0F0642027D, 0x4F36D6854DEAD, 0x07EED150858A7, 0x489E60D91D2B5, 0x019BF5BF4E4A5 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x4DCCF41A77E9B, 0x73AC0B98D69AB, 0x7176E8E6CA8F5, 0x712E0040FB3DF, 0x55E26C4439A89, 0x2BFF94D6357FB, 0x7EB22F558A663, 0x189F92CDA5492, 0x59B630781155C, 0x01661ECFA7397 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x210EAD944B722, 0x5F5A92DEE9DE9, 0x6744F867F71BD, 0x2FBAF264F4BC6, 0x5F7CAA2D28A04, 0x25C033A6919F1, 0x714BE05E7012B, 0x2A1032312BD3A, 0x1B9689AFF6215, 0x01A33D1D61CA1 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x60DB294445CBC, 0x5D897E3982947, 0x13C6D05572AEE, 0x6CE3EF4B1A81C, 0x764591EA051EB, 0x6F91D336F65BA, 0x30328BD519C87, 0x5B5A8FEE35251, 0x33F9EDE180B14, 0x00CBBD27506F7 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x6126C70438B86, 0x6BB7C2D8A91AB, 0x5DFC502D843D1, 0x09BAAFF3A239B, 0x3AED2CDFEFB47, 0x4F47A7313DF3C, 0x467134CDB09D6, 0x02CEB8C51B77A, 0x4535554392B22, 0x014D4084E2769 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x26416D1FFD4E8, 0x24E9210FD759C, 0x7114A25EEE53E, 0x06735CE6E49E3, 0x340B94A0E9D42, 0x06141818F4FF8, 0x0338ADC315E0A, 0x2F184738F6316, 0x338E9F3BB4B5E, 0x010B98D10739F },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x384549202F5E0, 0x1D18E1B0ABDB0, 0x22E3A0BEA9B62, 0x238F750C4F9E7, 0x11FEADD1B59A4, 0x25E0339FD7251, 0x6B65DF70FC381, 0x169CF1983B59E, 0x4D0C35A5C8269, 0x01B489AB007A3 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x17BE40D0A3926, 0x3FD2F2D7F092B, 0x3E3C31AD0BFD5, 0x25D79ED0891F3, 0x4A2F11927D508, 0x61FB49B59E06E, 0x4CD802C7D3003, 0x3949997B21CCF, 0x0780C2D2A77D8, 0x00FDFC8A220F3 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x564D7FB995B55, 0x62E418A50039F, 0x3AFD572569A10, 0x24EA47038FE42, 0x5954FEA09EB24, 0x7003D8CADABC0, 0x4D68F4A960B27, 0x36D789B9FB6E3, 0x3B0D65BE31496, 0x01BE5ADBDFAB5 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x54E93CC77FB73, 0x54DE3D8FC0BE4, 0x090A76841BE9F, 0x6583A7CEE5CA7, 0x6BA594E7BDCE6, 0x10AA905A69936, 0x0262E55502721, 0x590FAAD921CF2, 0x206EA6737889F, 0x00FDFFF53FAAC },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x7474489C0D777, 0x0B8051BFBB818, 0x2973E73DE8385, 0x7938BC1FAF95F, 0x1D9AADC509F3C, 0x187A04659F9EC, 0x3DD19762B1D25, 0x4224678FCB69D, 0x5DE270698C632, 0x016007A2843CA },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x275299BD673BD, 0x1EA0D404A7801, 0x414D90ABD34C0, 0x5FE16B66F52C4, 0x08D85F11F043D, 0x288848164883B, 0x2834C8D60016C, 0x482F9AB198D3D, 0x6180570E1651E, 0x012B1EB2BE888 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x2795215FD7695, 0x6907275ED0D56, 0x1DEC0F7F12E79, 0x686B351FD469D, 0x27074CFD8B314, 0x04B51166858BF, 0x02BFBD2FD8017, 0x00AFDBC0C142B, 0x449BE5B38CAD7, 0x0101875A61B33 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x6E0729D8849BF, 0x27E2D7EA53246, 0x33533AE247857, 0x2C9D1E54DA717, 0x1D7EB57C57CE0, 0x087E1D9D712B9, 0x23CE205FE5D0D, 0x1BBC69D3A555E, 0x2F9F4BCF5E45C, 0x010172A5029F0 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x7762CB36D802A, 0x0FBE2C2673044, 0x7F48DAB15E217, 0x6058F6AEB0696, 0x540A17F7BF9DF, 0x388FA9A129615, 0x19F0B1EB2D5DE, 0x32EA428B4B9AD, 0x29AD22550351D, 0x01E4D6D3C94AD },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x31AAB6407E4F6, 0x3C9F06D2DC178, 0x1E3E15980BB23, 0x63273563C82F4, 0x5E3C25DAE3F9A, 0x52C01DAF65EEE, 0x0C95A74653CAA, 0x28370ADE4CC74, 0x762727A07384A, 0x010ADA48FE4B2 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x0136507CF0F9C, 0x088B298D9B5BA, 0x6EF66D9B9041D, 0x76427AE653C10, 0x72EF18CA61439, 0x1E1F092E340D5, 0x39F3347736D32, 0x0D93F2262DCBA, 0x00FDB6A0F5582, 0x01AA986C07E83 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x08AB5BDA3BE46, 0x28D88ECF73A0D, 0x3CF1AD43A04D7, 0x427D9E5ECBB04, 0x46E11FF876190, 0x0820329F5CB84, 0x5863C58F51FA1, 0x41ACBB7DC3557, 0x197057FBDDA06, 0x0122581B41D49 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x2F3124EFAA052, 0x4F2DDD689E01A, 0x63EA71D31E77F, 0x5FF08B45040A0, 0x4DACF80E159F3, 0x716496778EA7D, 0x1E74C4C1272BE, 0x0249C95CCDC57, 0x6400B8746CD0E, 0x01576368A7ED4 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x328156CDD6200, 0x6F446477F274C, 0x595EC75FD4EA3, 0x56AE7893C2CA1, 0x21B7417457B47, 0x648D8229557DB, 0x498C4B12F6825, 0x146F55C67BCAC, 0x2CD86815439E2, 0x01514548E8830 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x2415A4F462622, 0x56CEC355E2AEA, 0x61FE23CDFC792, 0x780E355AD127E, 0x73D79144EA9C2, 0x309860CCFF38F, 0x49F4281009707, 0x321B1ACEDA77E, 0x1976859159AB4, 0x01C30F809C3F6 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x787360A4003A4, 0x207E031E69F7F, 0x3AAEFF445098C, 0x72B676B6CE5BA, 0x4D2FB2286A61C, 0x389F59EC2E331, 0x0E8EC0FABD82E, 0x036D2D0AADFAD, 0x495D39E9DDE88, 0x00F373DA166E3 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x66DE62EC9E2F3, 0x01CC19212DDEF, 0x7D775150C6C9D, 0x22F1760572D67, 0x28A01244A23EB, 0x4C14820FD4128, 0x36BBD0BD7C334, 0x4167B64E5895D, 0x5C64247065901, 0x017E51532E4F9 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x288C7ECDBD6F1, 0x767FD78329CBE, 0x2EC392EDD481E, 0x33CBAB14144A9, 0x7991A8EAF5CE3, 0x0F0B95FDD77A1, 0x7346440E3E8E1, 0x7B348CEFD6F8C, 0x465809C344B24, 0x013813BB008F3 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x33A632F1DC67A, 0x0AD4DD3E939B8, 0x251FEF0CE5878, 0x180FD2BC1E45D, 0x113613B3E80D4, 0x11D52B46BDAF5, 0x031DDB1B87E98, 0x0B6DF54926467, 0x51871F61D26B7, 0x0157E83DF5B63 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x30A1630A8C214, 0x3CACAB9711847, 0x53B92F4EAABDA, 0x1808B0B454860, 0x322B0C8C53E37, 0x0BC3E37A01338, 0x5DA620E82E52C, 0x55B55160EB307, 0x60B3528B19421, 0x00AD78D960DB5 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x4AF999129B33C, 0x58AE611C6BC76, 0x55334ED4924F7, 0x25DEFA4EC04D6, 0x58731162C2028, 0x3449450E7BAE4, 0x048D25A27B2CA, 0x74E45087E8EB4, 0x405ABC03725EE, 0x012A62855040A },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x409B5B8886434, 0x7FF2E23BE5307, 0x7CF9AC915D40D, 0x598DBAEC4D790, 0x067A71E377C11, 0x5444F1C9F9EAA, 0x543918CE8A790, 0x50AF9AB363F10, 0x347A2A6BD3ADC, 0x00E9162FFA81D },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x15A29231E6A7C, 0x36C8BBE4D4EDA, 0x6A0AE0615F50C, 0x52048A9A60E71, 0x63C8D4457A961, 0x157129C1DC2E0, 0x688CE76CF768D, 0x16168FC769A56, 0x1B42D35E84E75, 0x0190802A24C20 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x5C5EE695B5638, 0x038C644AD284C, 0x47C63A7244DB0, 0x7E43CE0EC8F34, 0x3004F6D9AAEFB, 0x28C6D0E928823, 0x6D215983AEFBC, 0x1F1285053D280, 0x7A37B3FC085D8, 0x00CFB36B3C97A },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x4ECBE9B616108, 0x1A1154FEF8D0C, 0x600F2E75353BB, 0x5F55B62C3EE59, 0x2A450962D29B1, 0x0018D77FB14A1, 0x011C695DC0A80, 0x5D9B54DFCBC5E, 0x3A5167A09DE3C, 0x01A7F8E9F5FC6 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x029EDF773DF9C, 0x4F8D5420E7F95, 0x145DBC17CBEFA, 0x77F3B31563B57, 0x75488DF6570C6, 0x6816F04CA1163, 0x36DD94922F384, 0x1B254E3209C74, 0x65953FE4A23B2, 0x00C4A5E767A68 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x380211A81AC5D, 0x09AD562C3E67A, 0x0EB052F48592B, 0x579F202A678DF, 0x4DEEBC806F947, 0x7E65BC3C7E479, 0x76033126AA3E3, 0x5ED1AA9F672F7, 0x77191559260AE, 0x01A5764F87F76 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x384E994686B8D, 0x173F68B1107BA, 0x42339DAFA1FBD, 0x0D80579B56162, 0x68A91609D1EF9, 0x15977A8263AC6, 0x49E5CE2839C8E, 0x789F28A30140A, 0x41A40764EEE6C, 0x00CCB9D179DDE },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x7A754DD8ABA25, 0x3AA7900FE4090, 0x745D5CE001223, 0x6EA6132F8F23B, 0x5216383727B5E, 0x5BA68E71023DE, 0x5EEA20C2F71B5, 0x4DDB93457EB4E, 0x4E5CE37577B27, 0x0125A4C0F57AF },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x6F85D07557439, 0x5B20327CB9FB5, 0x174CCCB881F73, 0x311F822EF0EEF, 0x2E8F270153DB9, 0x7FB361C6D182C, 0x48316E7E52518, 0x2A36560C52DF3, 0x5A4C29660077D, 0x00DD7C9383D47 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x6E8A95581C628, 0x73548086EB114, 0x79C62E42F55CF, 0x17EFD7EF8F0D1, 0x3097B13AAEEFA, 0x141E958C40CE5, 0x68A75209476F7, 0x050EA53209A90, 0x132732AC515AE, 0x0181A5E4BF14A },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x5CEC06C68A394, 0x46EFA0CAD3C15, 0x6642CD832FD3A, 0x763F0DC5051BE, 0x68BEC82806536, 0x73FAD8117BA29, 0x432F02ACBB90E, 0x79E0CC4B65170, 0x72C52900D7BE8, 0x00887FED9E29F },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x5799F86BA4534, 0x346D247C36142, 0x6D62FB4669744, 0x306BADC6FAB00, 0x0F51CDCD63BF0, 0x0D092FB7CEC3B, 0x26098AF7E17F7, 0x6718014A7A587, 0x5D5EBA1CA076E, 0x01BF8C9685B6B },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x2389787C835B6, 0x5F205BF091A49, 0x4853C8110C44B, 0x6E165038C0B26, 0x5C5ACF1F0C353, 0x3A022C4C052AF, 0x140F1A324ADD6, 0x6B3F8FAF1122A, 0x2817C69A0A61A, 0x00F09787F6021 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x4CB704D4B7355, 0x6F2A96CC230C3, 0x3E88BE9F9C36A, 0x44E8AD58CB696, 0x74E275A537B98, 0x77F8B8FF8F6DE, 0x10F78DB54192D, 0x0D12431BC681B, 0x692E7F68A9DE0, 0x017EB31B3936B },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x268F625222A49, 0x128E5BE4D6DBE, 0x45D6D2925FA3C, 0x44510C1FF3233, 0x35100E72620EF, 0x7C468C7132460, 0x765309BEF46D1, 0x1DFABB1843AE7, 0x4B029EFD9F783, 0x00F65E9F8B89C },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x6E8BAFCE55D63, 0x3D45057E7D2AC, 0x79E4FAD571A2C, 0x4E9CABF3531DE, 0x217584B87B6A8, 0x3AFAEDE474BDA, 0x0B51ECA055ACA, 0x7491EB383BFDC, 0x0CB19D2FB65D9, 0x01A3609B421AE },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x55CE8FD5E6435, 0x04884408CECC5, 0x7E2850CD96324, 0x2AA3A85D43AF1, 0x6383D9425F11C, 0x773B17A6C4F16, 0x62BA06747AA58, 0x08E27202391D4, 0x45F3932C98B38, 0x0114C66E2B540 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x4E2562496BF01, 0x1D45FC7F20751, 0x410C75D23FF30, 0x060CD240C051A, 0x1ACDAAEDA1A0C, 0x637D4A2292161, 0x2B3A7D7718521, 0x7D31F80F71869, 0x7678BCCDFD88A, 0x0184D41C51EDB },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x6B49BE70D9D75, 0x51C321B31E7A7, 0x78423B0325E9D, 0x0DFF3E6EC5839, 0x4454EDD168CA7, 0x77EC8C7A26679, 0x0719E0B9C4AA5, 0x082FC030905E6, 0x2BD949009E55C, 0x0130D1DC411EE },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x61F2FA2A92A6D, 0x1B92F9A4FDA28, 0x73121E083676A, 0x431F2D7BA24D5, 0x20A4BFABA9047, 0x447D04B769372, 0x1D06CA25445B7, 0x2D0D13D82C582, 0x3DF74025F9CA9, 0x0160619CF0C1A },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x02DA932E32AFD, 0x14CF746BF5DB6, 0x7ABBCB228099A, 0x416D31476CC59, 0x1A5AC25E67EEA, 0x1D29EB16D7AC3, 0x3AF334E050F07, 0x05AA2DAAE186A, 0x62867DDD90B99, 0x00D764C679A42 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x1DA33DC0976A3, 0x746C89642DCEA, 0x6C2A5D3415C3E, 0x5FFCEC29D63C5, 0x00CA54BA04F69, 0x0A8D5A6FE5ED7, 0x3892F9EADCC83, 0x7070530DC1578, 0x2BCE25154B7BE, 0x018B7D0248DB8 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x2A4D3E158D7A3, 0x293A28E799B31, 0x350F86FE2428E, 0x2D72F967B5827, 0x66A3CF4ED362A, 0x0B5DBBB0C7DBD, 0x3D95DC28734E2, 0x14D37CCD38423, 0x4301018781968, 0x0161014680F6A },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x597BA8087C009, 0x7CEE78C67092B, 0x0F3C1F03EC84C, 0x68C6E0C621940, 0x34C822352E5AD, 0x56F94FEFB14FE, 0x72AFF6464DB27, 0x3DF97A7F3495F, 0x0BB8CEE211E89, 0x017447AF9011B },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x2C94AE14D2AFD, 0x747F751746437, 0x7993957651496, 0x379EB09BEF145, 0x08FC0D94F7E3A, 0x3085EDF089333, 0x7DE6C150AA43C, 0x7FF6720694FE3, 0x2C8120A999E15, 0x00F074A8F184C },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x6B107D90D11A5, 0x135084833C895, 0x0769F90DC0C01, 0x32956B7B4868A, 0x6AB05EDFFF798, 0x680BC933D9AA0, 0x37B533F0FB9E2, 0x621AE06A26448, 0x0B81219F67871, 0x015F87AE25F8E },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x31A4B0125CE09, 0x5D3B25629CDAD, 0x5A85C5F0E7F3F, 0x7A3243810981D, 0x11A68DF383D92, 0x7ADC24EF2F3E9, 0x6E9B6EC807A3B, 0x2D191739BE1CB, 0x61B33067957E0, 0x0107C777D3A0B },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x27085EA05DF0C, 0x68B32D18EBFC3, 0x27E434CAF23C9, 0x5222797DD7EE5, 0x37E33570C767F, 0x1E94444904269, 0x750280BCEE269, 0x38F5C95304F0D, 0x65FCBA931AA72, 0x012D981C000EE },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x2678A3ADBE446, 0x32F901CE1793A, 0x44287301F6644, 0x7CD74C10553AA, 0x65E349EC260C3, 0x4ABF3FBCFE0FB, 0x25A275D59E865, 0x2A1FB130F6718, 0x21F34D5B433F4, 0x01960A3BE74D4 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x45FFAF40B586D, 0x2568E066E8238, 0x696142BDCAB5F, 0x1BCDD271CE402, 0x5DDE7D83C1202, 0x2D0288968C96D, 0x44CFBBA753643, 0x739F4F9AF15A2, 0x49326875D06C7, 0x018F5BAEF58B2 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x3CCB99E9C99FB, 0x459DF46316BD9, 0x7FA90F9C78726, 0x7B13587987A09, 0x639C38D6232DC, 0x3446C117D0B30, 0x617EFF5D53973, 0x55F2596960B34, 0x1181000FCC4C8, 0x00F2FD8BFCDE7 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x1139A86B4EF7F, 0x671DF1E63EBFB, 0x048B54660CA91, 0x3A4BD74D4C0AF, 0x3DC513E7E5CC9, 0x4576D685AF56D, 0x7CD546F09C5BC, 0x406109C0E651B, 0x439D667CC3074, 0x0196EBB7AFEA3 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x64CE47759DB2F, 0x62D1F14283E8E, 0x29C239EA983B6, 0x040FB6A04EA29, 0x2D92F6048544D, 0x4452683D1365D, 0x74EDE6918A1C0, 0x77F1659C1B437, 0x7949F7D9328E2, 0x01238FDB753CC },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x61D2EB311A261, 0x5C1A84CFA11AB, 0x038FD7D8C75C5, 0x3F5822F09F99C, 0x7107A47059E46, 0x41487EF5C49DC, 0x4331D1672BDEB, 0x6D86679C935B0, 0x32EB4DF025E7B, 0x0160E852860F3 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x7935D7C2AA799, 0x49C55964EBC2F, 0x6F126916EDC86, 0x1E4F894E6C5D9, 0x6FFC9FDC6D5F9, 0x26F1E7E1524D6, 0x50B96E9DA42C1, 0x5F9CED61C21D9, 0x4FD6785734845, 0x00D5FC018297A },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x669F9139A260C, 0x1CC98A082EF0A, 0x3ACAF8C7507D7, 0x2BB9C29420479, 0x050DC44F1497F, 0x2FE107010E767, 0x1AE32102B933B, 0x26A1AF153052B, 0x6C33736471F97, 0x01C7C53A243BB },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x70CC16DC06B26, 0x474C6804732A5, 0x2D596766DFCCC, 0x276866A3FB478, 0x6271FE73D0295, 0x12ABA2B7BB464, 0x7465661191609, 0x284BE5FAF9E01, 0x3F1B99ED30664, 0x011980454B018 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x22E166EA57E4C, 0x0E3A3314B28D5, 0x03693703D444A, 0x4559B30A796D8, 0x7BDAD9AF0A7E9, 0x497390DA523CB, 0x3C1B7B9225000, 0x35DD552F36D9E, 0x24EFFE3B19A1F, 0x014887CAA9C7E },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x5525B5928FC5A, 0x5D8251EE11031, 0x4A7B3F2423FFD, 0x65E2C2B9A0ED0, 0x207DAADAE6918, 0x01959C7742E35, 0x47A922FFA62C8, 0x6F295A7A77981, 0x3891D0539DDEA, 0x0140E1CF32BAD },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x2C1E5CF77C385, 0x3CD020B88957C, 0x3459A4F4E3FA9, 0x11BEE5F46AF0A, 0x095681DC423E9, 0x2B2D25B9B1A65, 0x25ABD8E0D9FB5, 0x7F95A978CDA70, 0x5DA36D560EFB6, 0x01CEE30CE96FD },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x3F8214A76F277, 0x70EB29D5879F4, 0x1CCB922C8B3D2, 0x70BB44B785AD7, 0x5244C6E2D9655, 0x1BD2CFE216FE5, 0x378E4206D00E5, 0x0105F88E49351, 0x76105C79E9FC3, 0x011EFD3ACCEA6 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x1978B0A1D7FF2, 0x51B0646E209F0, 0x7FBA75F7DE565, 0x37D94B04370C2, 0x72AB6A265F7DB, 0x0E330F20AAC8F, 0x4BDF6E451DD25, 0x4DCA3FC7345DE, 0x74A7D29B86FC7, 0x011445A0C1B95 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x71971AC3A8518, 0x296AB9433418E, 0x372FA7F3F8284, 0x09E6D739FE922, 0x5DC4556107B46, 0x23C8690664269, 0x44CF24B0B5F07, 0x3691DB247D7C6, 0x5BDAE8F8CB1B1, 0x00FA0B3567013 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x0F7841C25D3D8, 0x2942CDE69E872, 0x2944725CC2753, 0x070234F64EED7, 0x5A13261B16DDE, 0x40942879CFE9A, 0x5261F40112A6F, 0x31786403DF469, 0x25AB826ED1072, 0x01A1921C92A2A },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x1B0D2F90B1D28, 0x3C780E67B114B, 0x576352F93E20F, 0x6BBC47A2E09E4, 0x2D3B6944F7B43, 0x0ED049C6F7A7C, 0x00D0E1089C78A, 0x03D2BB5E0ECD1, 0x33A079399660B, 0x014F524B485A1 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x7560956F70C67, 0x52D254138C21E, 0x630E1FCC8E03B, 0x373C8DF7F5307, 0x6F165DE7D87B5, 0x0897C5271F3A3, 0x032D3AE93F406, 0x1D0D48C858814, 0x7A8A7E1B3B215, 0x01381E5669BA3 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x55B95F6E84EBD, 0x0B1540DFD9E17, 0x4C1B338123849, 0x1D127CB3BC811, 0x75942268DBC98, 0x3EB47F8BBF990, 0x4CB83F8CAC5F6, 0x1E136F030A57E, 0x0C5444D238260, 0x0103C27B11894 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x0E0A49893D3FD, 0x5F38208CC53DE, 0x3E79570EA89F0, 0x165150583D988, 0x323F07EE2C828, 0x3653D3916AD92, 0x7D2BFB65E5984, 0x656CE09BCE4F5, 0x000F17CE69196, 0x014C9DAE0B91E },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x7057D547E693F, 0x0F3727EE6226E, 0x2DFC98F5242DE, 0x371C95B848518, 0x6A8B9FF01CA0B, 0x09A813A166080, 0x7C903ACF63963, 0x7816DB9010065, 0x12B14D754AD50, 0x00CABE3CEB416 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x0870FECF8268C, 0x3C2F11C621243, 0x1AE7173B6C77B, 0x29D5694C5D2F7, 0x00DC5B968C61B, 0x60F350893F4F5, 0x6505E3A318B34, 0x5AA27B408A48F, 0x6285099385FCE, 0x016BBDE5E3B0D },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x53305439BFA9A, 0x5E61A16A02BEE, 0x01CC224275120, 0x003CF3B5B6F21, 0x433490CEE1AF2, 0x1E842D66DFA66, 0x59D1FF3017002, 0x7C51670B5DB41, 0x14E352545B2D9, 0x016673FD3FFB6 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x041E1EE3AE890, 0x5943F2C65B8C5, 0x494EE1C70F612, 0x0E1B0869224F5, 0x1FC841DA6784E, 0x6E760E5C9E058, 0x6174F74793E4D, 0x7AAC291F73419, 0x1DCD2F3DBFCE7, 0x0182F6609F66B },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x34A3A57164FD4, 0x5CC2F16A124E5, 0x2AAF6C95235DD, 0x543CA0E4A4F4E, 0x1B13EB63C8A9A, 0x7646111ADC507, 0x510A28437D239, 0x562900F4D9622, 0x41875F096905C, 0x012F59B91E381 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x0ECC2F60F19F1, 0x611B96D5467B8, 0x6995FAFDC8F1D, 0x16892AA83E567, 0x349E6238ECDE4, 0x116E55BDDA628, 0x6E054314EC9AE, 0x272FB29AFABAC, 0x773B5F41B5C40, 0x01F8B20635E43 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x2599EB1549F87, 0x619978B8D2ED6, 0x59E4101475DE3, 0x33ACBE361792D, 0x6D310C6631E50, 0x440E89DE498D9, 0x1455373297CC5, 0x13E2E8EEACB3A, 0x4CF02028BADC5, 0x0108AC0846642 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x0EDF6ABCDA4B6, 0x3FA9C5CCD9A80, 0x2E1812D9A00B6, 0x4C62811B5FE30, 0x0001AA4F580D0, 0x39CDC26F7ED50, 0x6BA9F47E10CA8, 0x2279138B19BF8, 0x268C785327302, 0x01A539D8ED528 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x496926A941B5E, 0x3417A9E011E1D, 0x5AD5A0A7AFB79, 0x2BCA5442AB79D, 0x7DCE43A4D1A34, 0x313D58AF5FA54, 0x3560D41B90A09, 0x12D2261114037, 0x421BCF1D423F4, 0x01276F96312DC },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x1892508A1802B, 0x04DFBFD776DD9, 0x17020BE4AB421, 0x26837E236E02C, 0x52EA889DA309D, 0x261D31C4EB331, 0x2098C13393268, 0x24AE9E79E956C, 0x1900A8F8C2045, 0x0111C49EB1D5A },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x7A4E5F360DE21, 0x43D73ECFF3A30, 0x4E7723B42E1E5, 0x1F90CFE354695, 0x3C11DBEDA63AE, 0x67E8F4234644F, 0x460C2B92F77BB, 0x2607C7F23AFB4, 0x7C8AC664111A9, 0x010DD9F65F396 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x7CDD5C9007F1C, 0x1C1F8A546C8AC, 0x3908AD6ADD7F9, 0x11EEAF3AF6ED0, 0x5F53FADAAE2D6, 0x1C49D7EA3285F, 0x4E42DB71F790A, 0x0024B2334696E, 0x334CC81A27FFB, 0x01A4381496276 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x48A4ACF86EEB2, 0x26D471F883F99, 0x59207C141A117, 0x0E451D7FF5DBC, 0x3583112173F15, 0x39A411D369294, 0x3D6A72B37D7B5, 0x21821F282263C, 0x1AF9A44DF473C, 0x012C54DDB7E8D },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x7C53B8F447EAB, 0x01DE106751F8C, 0x5CACC2BDC5BF0, 0x215323C53AA23, 0x69E324E5B60D8, 0x7C8511A92A9E6, 0x5D33559AAB716, 0x4630AB8598039, 0x2A9DBD331A161, 0x010229A0AE141 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x65AE5E8CAD6A9, 0x7512FBA957323, 0x7B17CBEFF1984, 0x71435AB01D5FA, 0x0A48EBE31303E, 0x45E85350B5B27, 0x13D7562E00950, 0x7537CEAD993AB, 0x66D8F07E8DE1F, 0x0101088DB34BD },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x44FD0792BF523, 0x62BD09971FF17, 0x65CA52EB3AE8D, 0x3D319E34D0313, 0x77988332DBF0C, 0x2BA2FB7213676, 0x4677631C32815, 0x50D66C071B55D, 0x5A06404935610, 0x01B6E9470BC0C },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x754CBD2C6584D, 0x559E248C2B5CC, 0x1A25E7EA85B5C, 0x2143312D7832F, 0x0D68A6C3608D8, 0x27EC3704C4CAA, 0x15EE19E6802B8, 0x62FB2C4714754, 0x74B308A70E599, 0x00BF8A4184138 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x25239B9E4F6E4, 0x723E37F2066A6, 0x446EDF782C18A, 0x29CD74439A5B3, 0x1BA978AF2EEBE, 0x73C4C61CE6FAE, 0x3CAFA76E4408E, 0x7D45DCF656778, 0x49491150516B7, 0x015FF795D3B6C },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x3420F37075B98, 0x0DDA34ECD791A, 0x7923A54D8E545, 0x7842EE25DA5B5, 0x57329AE22B7BE, 0x2CDA04270083D, 0x40DEDC06587D9, 0x64570E92106DE, 0x77122FDB48DC6, 0x00C163C6DD254 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x0DFDADBCE8539, 0x0924B788FF9C6, 0x70F1F65915FD3, 0x23B0536FC5517, 0x59274B8BAFDDE, 0x0463E614ED64D, 0x54F83B664C58F, 0x114C6F0218721, 0x3F75BA1512C18, 0x018F4ADEA0358 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x6DBD4B9E0C2CD, 0x7B65095A6CA6B, 0x07E3357470B44, 0x3049C6A72634D, 0x18EED61C8F65B, 0x7498396A35DEE, 0x3B2D65D7AA937, 0x6C177204EA041, 0x3AEC32F32EABD, 0x0136C97FC1C23 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x10D13A26D75A6, 0x7F958AB78FDD2, 0x7B111F381C00D, 0x0A69850B162CA, 0x51FE157066081, 0x72590DC355E97, 0x16238E4CFD161, 0x0D850669A7184, 0x4C4F8C35C66DC, 0x0174C92DD3352 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x0F656BFFA5F8E, 0x70C054452513F, 0x5D8712316520E, 0x2745C676C9A47, 0x4F75FED4070AD, 0x03D75F4230B07, 0x5E905FADBAF74, 0x3B23C1093E97E, 0x5B53A434D07CE, 0x0168136E6F98C },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x41F495BB8E3A7, 0x3E042DE2531A0, 0x354C0DD19F501, 0x3CF999935E386, 0x264B3486A0978, 0x0DB1B37810E2E, 0x0537832D040C2, 0x10028CD8623FE, 0x604B7B1788B90, 0x00FD7F242A054 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x5601BE617E713, 0x4FF34B073CC15, 0x116E79220FBF5, 0x16A21F2088D17, 0x6A6E7C0B2F3EB, 0x71F94E63ADD40, 0x502C98321AF59, 0x38083B0F81F59, 0x2696E46381885, 0x01CE4285B1F90 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x7ED1E4466E07D, 0x0B1F42CEEE2F6, 0x5940E741C7910, 0x543D56D91A7BA, 0x2B3B0F1727E45, 0x673283EC3A74E, 0x45561D331DF5D, 0x32FCC1E033D8C, 0x33503BE8BB110, 0x01B6906C14B2B },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x0CD5068CCDD21, 0x77B79700B2684, 0x3F3B53A5E35D7, 0x5EA36BB7280F2, 0x3E02FB6C3B83C, 0x4BE74F82A0256, 0x138778D50E691, 0x50C02B7829BFF, 0x30F7591413AA4, 0x0113C149A21F5 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } },
+  { { 0x6EB5C3598C86F, 0x5F9A5AA294EDD, 0x52D979E1AFA3C, 0x04D9146E1CEF3, 0x558E18B538D08, 0x2268839CEA722, 0x254F33BBAB10E, 0x0A68BDA481E62, 0x2B5AE76AE0EF3, 0x00860A117B0C3 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 },
+    { 0x2C24528F327ED, 0x6A6BE205DFE22, 0x1ADC38DC1103E, 0x6A54929BE037C, 0x0F513D77D3A53, 0x530A665993D66, 0x31EEA9B24EE70, 0x286532AB52F26, 0x0AF238021B42A, 0x00A88E4153B44 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x57FFFFFFFFFFF, 0x16F6888479E82, 0x43DBF3ED78984, 0x77A4D01B9BF6C, 0x43CC08B8D7BB4, 0x01019BD506047 } }
+};
+
+#endif
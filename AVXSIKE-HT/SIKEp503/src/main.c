@@ -9,9 +9,12 @@
 
 #include "sidh.h"
 #include "sike.h"
+#include "pairing.h"
 #include "utils.h"
 #include <time.h>
 #include <string.h>
+#include <unistd.h>
+#include <sys/wait.h>
 
 
 // the function to measure CPU cycles 
@@ -31,6 +34,13 @@ extern uint64_t read_tsc();
   end_cycles = read_tsc();                            \
   diff_cycles = (end_cycles-start_cycles)/(ITER)
 
+// T = min(T, cycles of one run of X), for comparing variants that differ by a few percent
+#define MEASURE_MIN(X, T)                             \
+  start_cycles = read_tsc();                          \
+  (X);                                                \
+  end_cycles = read_tsc();                            \
+  if (end_cycles-start_cycles < (T)) T = end_cycles-start_cycles
+
 
 // simple test for sidh (just test one lane)
 void test_sidh()
@@ -132,6 +142,333 @@ void test_sike()
   else            printf("\x1b[31mNOT EQUAL!\x1b[0m\n");
 }
 
+// 8-lane test for sike with prepared public keys and ladder tables
+void test_sike_prepared()
+{
+  // 8 instances
+  uint8_t sk[INSTANCES][CRYPTO_SECRETKEYBYTES] = { 0 };
+  uint8_t pk[INSTANCES][CRYPTO_PUBLICKEYBYTES] = { 0 };
+  uint8_t ct[INSTANCES][CRYPTO_CIPHERTEXTBYTES] = { 0 };
+  uint8_t ssa[INSTANCES][CRYPTO_BYTES] = { 0 };
+  uint8_t ssb[INSTANCES][CRYPTO_BYTES] = { 0 };
+  static f2elm_t table[OALICE_BITS][2];
+  static prepared_pk_t ppk;
+  int i, wrong = 0;
+
+  crypto_kem_keypair((uint8_t *)pk, (uint8_t *)sk);
+  crypto_kem_enc_prepare(ppk, (uint8_t *)pk, table);
+
+  for (i = 0; i < 2; i++) {
+    crypto_kem_enc_prepared((uint8_t *)ct, (uint8_t *)ssa, ppk);
+    crypto_kem_dec((uint8_t *)ssb, (uint8_t *)ct, (uint8_t *)sk);
+    wrong |= memcmp(ssa, ssb, INSTANCES*CRYPTO_BYTES);
+  }
+
+  puts("\n*******************************************************************");
+  puts("PREPARED PUBLIC KEY TEST:");
+  puts("-------------------------------------------------------------------");
+  if (wrong == 0) printf("\x1b[32mALL EQUAL!\x1b[0m\n");
+  else            printf("\x1b[31mNOT EQUAL!\x1b[0m\n");
+}
+
+// deterministic key generation and encapsulation: equal coins give equal outputs
+void test_sike_derand()
+{
+  uint8_t sk[2][INSTANCES][CRYPTO_SECRETKEYBYTES] = { 0 };
+  uint8_t pk[2][INSTANCES][CRYPTO_PUBLICKEYBYTES] = { 0 };
+  uint8_t ct[2][INSTANCES][CRYPTO_CIPHERTEXTBYTES] = { 0 };
+  uint8_t ssa[2][INSTANCES][CRYPTO_BYTES] = { 0 };
+  uint8_t ssb[INSTANCES][CRYPTO_BYTES] = { 0 };
+  uint8_t kcoins[CRYPTO_KEYPAIR_COINBYTES], ecoins[CRYPTO_ENC_COINBYTES];
+  int i, wrong = 0;
+
+  for (i = 0; i < CRYPTO_KEYPAIR_COINBYTES; i++) kcoins[i] = (uint8_t)(3*i+1);
+  for (i = 0; i < CRYPTO_ENC_COINBYTES; i++) ecoins[i] = (uint8_t)(5*i+2);
+
+  for (i = 0; i < 2; i++) {
+    crypto_kem_keypair_derand((uint8_t *)pk[i], (uint8_t *)sk[i], kcoins);
+    crypto_kem_enc_derand((uint8_t *)ct[i], (uint8_t *)ssa[i], (uint8_t *)pk[i], ecoins);
+  }
+  crypto_kem_dec((uint8_t *)ssb, (uint8_t *)ct[0], (uint8_t *)sk[0]);
+
+  wrong |= memcmp(sk[0], sk[1], sizeof(sk[0])) | memcmp(pk[0], pk[1], sizeof(pk[0]));
+  wrong |= memcmp(ct[0], ct[1], sizeof(ct[0])) | memcmp(ssa[0], ssa[1], sizeof(ssa[0]));
+  wrong |= memcmp(ssa[0], ssb, sizeof(ssb));
+
+  puts("\n*******************************************************************");
+  puts("DERAND TEST:");
+  puts("-------------------------------------------------------------------");
+  if (wrong == 0) printf("\x1b[32mALL EQUAL!\x1b[0m\n");
+  else            printf("\x1b[31mNOT EQUAL!\x1b[0m\n");
+}
+
+// implicit rejection: lanes with a modified ct (a flipped bit in c0 or c1, or c0 
+// re-encoded non-canonically as x+p) must be rejected, i.e. their shared secret 
+// H(s||ct) changes with s, while the others still decapsulate to the sender's secret
+void test_sike_reject()
+{
+  uint8_t sk[INSTANCES][CRYPTO_SECRETKEYBYTES] = { 0 };
+  uint8_t pk[INSTANCES][CRYPTO_PUBLICKEYBYTES] = { 0 };
+  uint8_t ct[INSTANCES][CRYPTO_CIPHERTEXTBYTES] = { 0 };
+  uint8_t ssa[INSTANCES][CRYPTO_BYTES] = { 0 };
+  uint8_t ssb[2][INSTANCES][CRYPTO_BYTES] = { 0 };
+  uint8_t pb[GFP_BYTES] = { 0 };
+  unsigned int c;
+  int i, k, wrong = 0;
+
+  // p as a radix-64 string
+  for (i = 0; i < NWORDS*BRADIX; i++)
+    if ((p503[i/BRADIX] >> (i%BRADIX)) & 1) pb[i/8] |= 1 << (i%8);
+
+  crypto_kem_keypair((uint8_t *)pk, (uint8_t *)sk);
+  crypto_kem_enc((uint8_t *)ct, (uint8_t *)ssa, (uint8_t *)pk);
+
+  ct[1][0] ^= 1;
+  ct[3][CRYPTO_PUBLICKEYBYTES-1] ^= 1;
+  ct[5][CRYPTO_CIPHERTEXTBYTES-1] ^= 0x80;
+  for (i = 0, c = 0; i < GFP_BYTES; i++) {
+    c += ct[7][i] + pb[i];
+    ct[7][i] = (uint8_t)c; c >>= 8;
+  }
+  crypto_kem_dec((uint8_t *)ssb[0], (uint8_t *)ct, (uint8_t *)sk);
+  for (k = 0; k < INSTANCES; k++) sk[k][0] ^= 1;
+  crypto_kem_dec((uint8_t *)ssb[1], (uint8_t *)ct, (uint8_t *)sk);
+
+  for (k = 0; k < INSTANCES; k += 2) {
+    wrong |= memcmp(ssa[k], ssb[0][k], CRYPTO_BYTES) | memcmp(ssa[k], ssb[1][k], CRYPTO_BYTES);
+    wrong |= memcmp(ssb[0][k+1], ssb[1][k+1], CRYPTO_BYTES) == 0;
+  }
+
+  puts("\n*******************************************************************");
+  puts("REJECTION TEST:");
+  puts("-------------------------------------------------------------------");
+  if (wrong == 0) printf("\x1b[32mALL EQUAL!\x1b[0m\n");
+  else            printf("\x1b[31mNOT EQUAL!\x1b[0m\n");
+}
+
+// fork test: parent and child must draw different bytes after the fork
+void test_randombytes_fork()
+{
+  unsigned char a[64], b[64];
+  int fd[2], wrong = 1;
+  pid_t pid;
+
+  randombytes(a, 1);                              // seed the generator before forking
+  if (pipe(fd) == 0) {
+    pid = fork();
+    if (pid == 0) {
+      randombytes(b, sizeof(b));
+      _exit(write(fd[1], b, sizeof(b)) != sizeof(b));
+    }
+    if (pid > 0) {
+      randombytes(a, sizeof(a));
+      wrong = read(fd[0], b, sizeof(b)) != sizeof(b) || memcmp(a, b, sizeof(a)) == 0;
+      waitpid(pid, NULL, 0);
+    }
+    close(fd[0]); close(fd[1]);
+  }
+
+  puts("\n*******************************************************************");
+  puts("FORK TEST:");
+  puts("-------------------------------------------------------------------");
+  if (wrong == 0) printf("\x1b[32mALL EQUAL!\x1b[0m\n");
+  else            printf("\x1b[31mNOT EQUAL!\x1b[0m\n");
+}
+
+// mKEM test: one encapsulation to 2*INSTANCES-3 recipients, the last batch is partial,
+// and implicit rejection of modified ciphertexts in the first batch
+void test_mkem()
+{
+  uint8_t sk[2*INSTANCES][CRYPTO_SECRETKEYBYTES] = { 0 };
+  uint8_t pk[2*INSTANCES][CRYPTO_PUBLICKEYBYTES] = { 0 };
+  uint8_t ct[2*INSTANCES][CRYPTO_CIPHERTEXTBYTES] = { 0 };
+  uint8_t ct0[CRYPTO_PUBLICKEYBYTES] = { 0 };
+  uint8_t c1[2*INSTANCES][MSG_BYTES] = { 0 };
+  uint8_t ssa[CRYPTO_BYTES] = { 0 };
+  uint8_t ssb[2*INSTANCES][CRYPTO_BYTES] = { 0 };
+  uint8_t ssr[2][INSTANCES][CRYPTO_BYTES] = { 0 };
+  const int n = 2*INSTANCES-3;
+  int k, wrong = 0;
+
+  crypto_kem_keypair((uint8_t *)pk[0], (uint8_t *)sk[0]);
+  crypto_kem_keypair((uint8_t *)pk[INSTANCES], (uint8_t *)sk[INSTANCES]);
+  crypto_mkem_enc(ct0, (uint8_t *)c1, ssa, (uint8_t *)pk, n);
+
+  // recipient k receives c0 || c1[k]
+  for (k = 0; k < 2*INSTANCES; k++) {
+    memcpy(ct[k], ct0, CRYPTO_PUBLICKEYBYTES);
+    memcpy(&ct[k][CRYPTO_PUBLICKEYBYTES], c1[k], MSG_BYTES);
+  }
+  crypto_mkem_dec((uint8_t *)ssb[0], (uint8_t *)ct[0], (uint8_t *)sk[0]);
+  crypto_mkem_dec((uint8_t *)ssb[INSTANCES], (uint8_t *)ct[INSTANCES], (uint8_t *)sk[INSTANCES]);
+
+  for (k = 0; k < n; k++) wrong |= memcmp(ssa, ssb[k], CRYPTO_BYTES);
+
+  // implicit rejection: odd lanes get a modified c1 or c0 and must be rejected with 
+  // a key that also depends on c1, the others still decapsulate to the sender's secret
+  ct[1][CRYPTO_CIPHERTEXTBYTES-1] ^= 0x80;
+  ct[3][0] ^= 1;
+  ct[5][CRYPTO_PUBLICKEYBYTES] ^= 1;
+  ct[7][CRYPTO_CIPHERTEXTBYTES-1] ^= 1;
+  crypto_mkem_dec((uint8_t *)ssr[0], (uint8_t *)ct[0], (uint8_t *)sk[0]);
+  for (k = 1; k < INSTANCES; k += 2) ct[k][CRYPTO_CIPHERTEXTBYTES-2] ^= 1;
+  crypto_mkem_dec((uint8_t *)ssr[1], (uint8_t *)ct[0], (uint8_t *)sk[0]);
+
+  for (k = 0; k < INSTANCES; k += 2) {
+    wrong |= memcmp(ssa, ssr[0][k], CRYPTO_BYTES) | memcmp(ssa, ssr[1][k], CRYPTO_BYTES);
+    wrong |= memcmp(ssa, ssr[0][k+1], CRYPTO_BYTES) == 0;
+    wrong |= memcmp(ssr[0][k+1], ssr[1][k+1], CRYPTO_BYTES) == 0;
+  }
+
+  puts("\n*******************************************************************");
+  puts("MKEM TEST:");
+  puts("-------------------------------------------------------------------");
+  if (wrong == 0) printf("\x1b[32mALL EQUAL!\x1b[0m\n");
+  else            printf("\x1b[31mNOT EQUAL!\x1b[0m\n");
+}
+
+// pairing test helpers: x-coordinate j of a basis, lanes where a = b or a = conj(b)
+static void load_basis_x(f2elm_t x, const uint64_t *gen, const int j)
+{
+  int i;
+
+  for (i = 0; i < NWORDS; i++) {
+    x[0][i] = VSET1(gen[i + 2*j*NWORDS]);
+    x[1][i] = VSET1(gen[i + (2*j+1)*NWORDS]);
+  }
+}
+
+static __mmask8 fp2equal_lanes(const f2elm_t a, const f2elm_t b)
+{
+  f2elm_t s, t;
+  __m512i d = VZERO;
+  int i;
+
+  fp2copy(s, a); fp2correction(s);
+  fp2copy(t, b); fp2correction(t);
+  for (i = 0; i < NWORDS; i++) d = VOR(d, VOR(VXOR(s[0][i], t[0][i]), VXOR(s[1][i], t[1][i])));
+
+  return VCMPEQ(d, VZERO);
+}
+
+static __mmask8 fp2equal_pm_lanes(const f2elm_t a, const f2elm_t b)
+{
+  f2elm_t t;
+
+  fp2copy(t, b);
+  fpneg(t[1]);
+
+  return fp2equal_lanes(a, b) | fp2equal_lanes(a, t);
+}
+
+// checks on the basis (P, Q) of E0[b^e] (b = 2 for ALICE, 3 for BOB) in every lane:
+// - y recovered from x is on the curve
+// - g = e(P, Q) has order exactly b^e
+// - e([bm+1]P, Q) = g^(bm+1) up to the sign of y, for random m in every lane
+// - dlog recovers random exponents k from g^k
+static __mmask8 test_pairing_basis(const int AliceOrBob)
+{
+  const uint64_t *gen = (AliceOrBob == ALICE) ? A_gen : B_gen;
+  const int b = (AliceOrBob == ALICE) ? 2 : 3;
+  const int e = (AliceOrBob == ALICE) ? OALICE_BITS : OBOB_EXPON;
+  const int nbits = (AliceOrBob == ALICE) ? OALICE_BITS : OBOB_BITS-1;
+  const int nvects = (AliceOrBob == ALICE) ? SK_A_VECTS : SK_B_VECTS;
+  point_affine_t P, Q, R;
+  point_proj_t S;
+  f2elm_t A, A24plus, C24, one, t, u, g, h;
+  __m512i m[SK_A_VECTS+SK_B_VECTS] = { 0 }, k[SK_A_VECTS+SK_B_VECTS] = { 0 };
+  __mmask8 ok = 0xFF;
+  int i;
+
+  // A = 6, A24plus = 8, C24 = 4
+  for (i = 0; i < NWORDS; i++) {
+    one[0][i] = VSET1(mont_R[i]);
+    one[1][i] = VZERO;
+  }
+  fp2add(t, one, one);
+  fp2add(C24, t, t);
+  fp2add(A, C24, t);
+  fp2add(A24plus, C24, C24);
+
+  load_basis_x(P->x, gen, 0);
+  load_basis_x(Q->x, gen, 1);
+  recover_y(P->y, P->x, A);
+  recover_y(Q->y, Q->x, A);
+
+  // y^2 = x^3 + A*x^2 + x
+  fp2add(t, P->x, A);
+  fp2mul_mont(t, t, P->x);
+  fp2add(t, t, one);
+  fp2mul_mont(t, t, P->x);
+  fp2sqr_mont(u, P->y);
+  ok &= fp2equal_lanes(t, u);
+
+  // g^(b^(e-1)) != 1, g^(b^e) = 1
+  if (AliceOrBob == ALICE) Tate_pairing_2e(g, P, Q, A);
+  else                     Tate_pairing_3e(g, P, Q, A);
+  fp2copy(t, g);
+  for (i = 0; i < e; i++) {
+    if (i == e-1) ok &= ~fp2equal_lanes(t, one);
+    fp2sqr_mont(u, t);
+    if (b == 3) fp2mul_mont(t, u, t);
+    else        fp2copy(t, u);
+  }
+  ok &= fp2equal_lanes(t, one);
+
+  // R = [bm+1]P = P + [m]([b]P), of order b^e as P, with [b]P - P = [b-1]P 
+  for (i = 0; i < nvects; i++) m[i] = set_vector(random(), random(), random(), random(), random(), random(), random(), random());
+  for (i = 0; i < nvects; i++) m[i] = VXOR(m[i], VSHL(set_vector(random(), random(), random(), random(), random(), random(), random(), random()), 31));
+  if (nbits & 63) m[nbits>>6] = VAND(m[nbits>>6], VSET1((1ULL << (nbits&63))-1));
+  fp2copy(S->X, P->x);
+  fp2copy(S->Z, one);
+  xDBL(S, S, A24plus, C24);
+  fp2inv_mont(S->Z);
+  fp2mul_mont(u, S->X, S->Z);           // u = x([2]P)
+  if (b == 3) {
+    fp2copy(S->X, P->x);
+    fp2copy(S->Z, one);
+    xTPL(S, S, C24, A24plus);           // A24minus = A-2 = 4 = C24
+    fp2inv_mont(S->Z);
+    fp2mul_mont(t, S->X, S->Z);         // t = x([3]P)
+    LADDER3PT(P->x, t, u, m, AliceOrBob, S, A);
+  } else {
+    LADDER3PT(P->x, u, P->x, m, AliceOrBob, S, A);
+  }
+  fp2inv_mont(S->Z);
+  fp2mul_mont(R->x, S->X, S->Z);
+  recover_y(R->y, R->x, A);
+
+  if (AliceOrBob == ALICE) Tate_pairing_2e(h, R, Q, A);
+  else                     Tate_pairing_3e(h, R, Q, A);
+  fp2pow_mont(t, g, m, nbits);
+  fp2sqr_mont(u, t);
+  if (b == 3) fp2mul_mont(u, u, t);
+  fp2mul_mont(t, u, g);
+  ok &= fp2equal_pm_lanes(h, t);
+
+  // log_g(g^m) = m
+  fp2pow_mont(h, g, m, nbits);
+  if (AliceOrBob == ALICE) dlog_2e(k, h, g);
+  else                     dlog_3e(k, h, g);
+  for (i = 0; i < nvects; i++) ok &= VCMPEQ(k[i], m[i]);
+
+  return ok;
+}
+
+void test_pairing()
+{
+  __mmask8 ok;
+
+  srandom((int)time(NULL));
+  ok = test_pairing_basis(ALICE) & test_pairing_basis(BOB);
+
+  puts("\n*******************************************************************");
+  puts("PAIRING TEST:");
+  puts("-------------------------------------------------------------------");
+  if (ok == 0xFF) printf("\x1b[32mALL EQUAL!\x1b[0m\n");
+  else            printf("\x1b[31mNOT EQUAL!\x1b[0m\n");
+}
+
 void timing_sike()
 {
   // 8 instances
@@ -140,8 +477,13 @@ void timing_sike()
   uint8_t ct[INSTANCES][CRYPTO_CIPHERTEXTBYTES] = { 0 };
   uint8_t ssa[INSTANCES][CRYPTO_BYTES] = { 0 };
   uint8_t ssb[INSTANCES][CRYPTO_BYTES] = { 0 };
+  static f2elm_t table[OALICE_BITS][2];
+  static prepared_pk_t ppk, ppk0;
+  uint8_t pk2[2*INSTANCES][CRYPTO_PUBLICKEYBYTES];
+  uint8_t ct0[CRYPTO_PUBLICKEYBYTES];
+  uint8_t c1[2*INSTANCES][MSG_BYTES];
 
-  uint64_t start_cycles, end_cycles, diff_cycles;
+  uint64_t start_cycles, end_cycles, diff_cycles, min_cycles, min0_cycles;
   int i;
 
   puts("\n*******************************************************************");
@@ -155,16 +497,85 @@ void timing_sike()
   MEASURE_TIME(crypto_kem_enc((uint8_t *)ct, (uint8_t *)ssa, (uint8_t *)pk), ITER_S);
   printf("* ENCAPS : %ld\n", diff_cycles);
 
+  crypto_kem_enc_prepare(ppk, (uint8_t *)pk, table);
+  LOAD_CACHE(crypto_kem_enc_prepared((uint8_t *)ct, (uint8_t *)ssa, ppk), ITER_S);
+  MEASURE_TIME(crypto_kem_enc_prepared((uint8_t *)ct, (uint8_t *)ssa, ppk), ITER_M);
+  printf("* ENCAPS (prepared pk): %ld\n", diff_cycles);
+
+  // the per-key ladder table against the prepared pk alone: min of ITER_S runs, 
+  // interleaved so that a change of the clock affects both
+  crypto_kem_enc_prepare(ppk0, (uint8_t *)pk, NULL);
+  min_cycles = min0_cycles = (uint64_t)-1;
+  for (i = 0; i < ITER_S; i++) {
+    MEASURE_MIN(crypto_kem_enc_prepared((uint8_t *)ct, (uint8_t *)ssa, ppk), min_cycles);
+    MEASURE_MIN(crypto_kem_enc_prepared((uint8_t *)ct, (uint8_t *)ssa, ppk0), min0_cycles);
+  }
+  printf("* ENCAPS (prepared pk with ladder table, min): %ld\n", min_cycles);
+  printf("* ENCAPS (prepared pk without ladder table, min): %ld\n", min0_cycles);
+  min_cycles = (uint64_t)-1;
+  for (i = 0; i < ITER_S; i++) {
+    MEASURE_MIN(crypto_kem_enc_prepare(ppk, (uint8_t *)pk, table), min_cycles);
+  }
+  printf("* PREPARE PK (with ladder table, min): %ld\n", min_cycles);
+
+  // one mKEM encapsulation to 2*INSTANCES recipients, pk[k] is used twice
+  memcpy(pk2[0], pk, INSTANCES*CRYPTO_PUBLICKEYBYTES);
+  memcpy(pk2[INSTANCES], pk, INSTANCES*CRYPTO_PUBLICKEYBYTES);
+  LOAD_CACHE(crypto_mkem_enc(ct0, (uint8_t *)c1, (uint8_t *)ssa, (uint8_t *)pk2, 2*INSTANCES), ITER_S);
+  MEASURE_TIME(crypto_mkem_enc(ct0, (uint8_t *)c1, (uint8_t *)ssa, (uint8_t *)pk2, 2*INSTANCES), ITER_S);
+  printf("* MKEM ENCAPS (%d recipients): %ld\n", 2*INSTANCES, diff_cycles);
+
   LOAD_CACHE(crypto_kem_dec((uint8_t *)ssb, (uint8_t *)ct, (uint8_t *)sk), ITER_S);
   MEASURE_TIME(crypto_kem_dec((uint8_t *)ssb, (uint8_t *)ct, (uint8_t *)sk), ITER_S);
   printf("* DECAPS : %ld\n", diff_cycles);
 }
 
+void timing_pairing()
+{
+  point_affine_t P, Q;
+  f2elm_t A, g, h;
+  __m512i k[SK_A_VECTS+SK_B_VECTS];
+  uint64_t start_cycles, end_cycles, diff_cycles;
+  int i;
+
+  // the timings do not depend on the values (the inputs are not valid points)
+  for (i = 0; i < NWORDS; i++) {
+    P->x[0][i] = P->y[0][i] = Q->x[0][i] = Q->y[0][i] = A[0][i] = g[0][i] = h[0][i] = VSET1(mont_R[i]);
+    P->x[1][i] = P->y[1][i] = Q->x[1][i] = Q->y[1][i] = A[1][i] = g[1][i] = h[1][i] = VSET1(i);
+  }
+
+  puts("\n*******************************************************************");
+  puts("Execution Time (pairings):\n");
+
+  LOAD_CACHE(Tate_pairing_2e(g, P, Q, A), 10);
+  MEASURE_TIME(Tate_pairing_2e(g, P, Q, A), ITER_S);
+  printf("* TATE PAIRING 2^eA : %ld\n", diff_cycles);
+
+  LOAD_CACHE(Tate_pairing_3e(g, P, Q, A), 10);
+  MEASURE_TIME(Tate_pairing_3e(g, P, Q, A), ITER_S);
+  printf("* TATE PAIRING 3^eB : %ld\n", diff_cycles);
+
+  LOAD_CACHE(dlog_2e(k, h, g), 10);
+  MEASURE_TIME(dlog_2e(k, h, g), ITER_S);
+  printf("* DLOG 2^eA : %ld\n", diff_cycles);
+
+  LOAD_CACHE(dlog_3e(k, h, g), 10);
+  MEASURE_TIME(dlog_3e(k, h, g), ITER_S);
+  printf("* DLOG 3^eB : %ld\n", diff_cycles);
+}
+
 int main()
 {
   // test_sidh();
   // timing_sidh();
   test_sike();
+  test_sike_prepared();
+  test_sike_derand();
+  test_sike_reject();
+  test_randombytes_fork();
+  test_mkem();
+  test_pairing();
   timing_sike();
+  timing_pairing();
   return 0;
 }
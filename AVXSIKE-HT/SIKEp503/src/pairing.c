@@ -0,0 +1,442 @@
+/********************************************************************************************
+* Reduced Tate pairings and Pohlig-Hellman discrete logarithms, 8 lanes
+*
+* The 2^eA and 3^eB pairings run a Miller loop over homogeneous projective points that keeps
+* the value as a fraction, followed by the final exponentiation to the power (p^2-1)/2^eA 
+* resp. (p^2-1)/3^eB. The discrete logarithms in the groups of 2^eA-th and 3^eB-th roots
+* of unity are windowed Pohlig-Hellman with a per-lane table lookup.
+*********************************************************************************************/
+
+#include "pairing.h"
+
+// windows of the Pohlig-Hellman discrete logarithms (table sizes 2^DLOG_W2 and
+// 3^DLOG_W3, at most DLOG_TABLE)
+#define DLOG_W2     5
+#define DLOG_W3     3
+#define DLOG_TABLE  32
+#define DLOG_WORDS  ((SK_A_VECTS > SK_B_VECTS) ? SK_A_VECTS : SK_B_VECTS)
+
+// projective point (X:Y:Z) on the Montgomery curve y^2 = x^3 + A*x^2 + x
+typedef struct { f2elm_t X; f2elm_t Y; f2elm_t Z; } point_full_proj;
+typedef point_full_proj point_full_proj_t[1];
+
+static void fp2one(f2elm_t r)
+{
+  int i;
+
+  for (i = 0; i < NWORDS; i++) {
+    r[0][i] = VSET1(mont_R[i]);
+    r[1][i] = VZERO;
+  }
+}
+
+// r = conjugate of a, which is a^(-1) for a of norm 1
+static void fp2conj(f2elm_t r, const f2elm_t a)
+{
+  fp2copy(r, a);
+  fpneg(r[1]);
+}
+
+// r = a in the lanes of mask, r unchanged in the others
+static void fp2select(f2elm_t r, const f2elm_t a, const __mmask8 mask)
+{
+  int i;
+
+  for (i = 0; i < NWORDS; i++) {
+    r[0][i] = VMBLEND(mask, r[0][i], a[0][i]);
+    r[1][i] = VMBLEND(mask, r[1][i], a[1][i]);
+  }
+}
+
+// lanes where a = b, both reduced by fpcorrection
+static __mmask8 fpequal(const felm_t a, const felm_t b)
+{
+  __m512i t = VZERO;
+  int i;
+
+  for (i = 0; i < NWORDS; i++) t = VOR(t, VXOR(a[i], b[i]));
+
+  return VCMPEQ(t, VZERO);
+}
+
+static __mmask8 fp2equal(const f2elm_t a, const f2elm_t b)
+{
+  return fpequal(a[0], b[0]) & fpequal(a[1], b[1]);
+}
+
+// r = a^(b^n) for b = 2 or 3
+static void fp2pow_b(f2elm_t r, const f2elm_t a, const int b, const int n)
+{
+  f2elm_t t;
+  int i;
+
+  fp2copy(r, a);
+  for (i = 0; i < n; i++) {
+    fp2sqr_mont(t, r);
+    if (b == 3) fp2mul_mont(r, t, r);
+    else        fp2copy(r, t);
+  }
+}
+
+// square root r = sqrt(a) in GF(p^2) for a square a, following Hamburg's trick
+// with one exponentiation in GF(p) for the norm and one for the half-trace
+void fp2sqrt_mont(f2elm_t r, const f2elm_t a)
+{
+  felm_t t0, t1, t2, t3;
+  __mmask8 mask;
+  int i;
+
+  // t1 = (a0^2+a1^2)^((p+1)/4) = 2^(eA-2) * 3^eB
+  fpsqr_mont(t0, a[0]);
+  fpsqr_mont(t1, a[1]);
+  fpadd(t1, t0, t1);
+  for (i = 0; i < OALICE_BITS-2; i++) fpsqr_mont(t1, t1);
+  for (i = 0; i < OBOB_EXPON; i++) {
+    fpsqr_mont(t0, t1);
+    fpmul_mont(t1, t0, t1);
+  }
+
+  // t0 = (a0+t1)/2, which is 0 only if a1 = 0 and a0 is a non-square in GF(p),
+  // then (a0-t1)/2 = a0 is taken instead
+  fpadd(t0, a[0], t1);
+  fpdiv2(t0, t0);
+  fpcorrection(t0);
+  fpzero(t2);
+  mask = fpequal(t0, t2);
+  for (i = 0; i < NWORDS; i++) t0[i] = VMBLEND(mask, t0[i], a[0][i]);
+
+  // t1 = t0^((p+1)/4), t2 = a1/(2*t1)
+  fpcopy(t2, t0);
+  fpinv_chain_mont(t2);
+  fpmul_mont(t1, t0, t2);
+  fpmul_mont(t2, t2, a[1]);
+  fpdiv2(t2, t2);
+
+  // r = t1 + t2*i if t0 is a square, r = t2 - t1*i otherwise
+  fpsqr_mont(t3, t1);
+  fpcorrection(t0);
+  fpcorrection(t3);
+  mask = fpequal(t0, t3);
+  fpcopy(t0, t1);
+  fpneg(t0);
+  for (i = 0; i < NWORDS; i++) {
+    r[0][i] = VMBLEND(mask, t2[i], t1[i]);
+    r[1][i] = VMBLEND(mask, t0[i], t2[i]);
+  }
+}
+
+// r = a^k with a different exponent k (nbits bits in 64-bit words) in every lane
+void fp2pow_mont(f2elm_t r, const f2elm_t a, const __m512i *k, const int nbits)
+{
+  f2elm_t t, s;
+  __mmask8 mask;
+  int i;
+
+  fp2copy(s, a);
+  fp2one(r);
+  for (i = nbits-1; i >= 0; i--) {
+    fp2sqr_mont(r, r);
+    fp2mul_mont(t, r, s);
+    mask = VCMPEQ(VAND(VSHR(k[i>>6], i&63), VSET1(1)), VSET1(1));
+    fp2select(r, t, mask);
+  }
+}
+
+// y-coordinate y = sqrt(x^3 + A*x^2 + x) of the point with x-coordinate x, the
+// sign of y is unspecified
+void recover_y(f2elm_t y, const f2elm_t x, const f2elm_t A)
+{
+  f2elm_t t, one;
+
+  fp2one(one);
+  fp2add(t, x, A);
+  fp2mul_mont(t, t, x);
+  fp2add(t, t, one);
+  fp2mul_mont(t, t, x);                 // t = x^3 + A*x^2 + x
+  fp2sqrt_mont(y, t);
+}
+
+// Miller doubling step: T = 2T and the line functions at Q give f = f * n/d with
+// n/d = l_{T,T}(Q)/v_{2T}(Q), where
+//   l_{T,T}(Q) = (Ld*(Z*yQ-Y) - Ln*(Z*xQ-X)) / (Ld*Z), Ln = 3X^2+2AXZ+Z^2, Ld = 2YZ
+//   v_{2T}(Q)  = (Ld^2*Z*xQ - Xn) / (Ld^2*Z), Xn = Ln^2*Z - (AZ+2X)*Ld^2
+static void miller_dbl(point_full_proj_t T, f2elm_t n, f2elm_t d, const point_affine_t Q, const f2elm_t A)
+{
+  f2elm_t t0, t1, t2, ln, ld, ld2, zx, xn;
+
+  fp2sqr_mont(t0, T->X);
+  fp2sqr_mont(t1, T->Z);
+  fp2mul_mont(t2, T->X, T->Z);
+  fp2mul_mont(t2, t2, A);
+  fp2add(ln, t0, t0);
+  fp2add(ln, ln, t0);
+  fp2add(ln, ln, t2);
+  fp2add(ln, ln, t2);
+  fp2add(ln, ln, t1);                   // ln = 3X^2+2AXZ+Z^2
+  fp2mul_mont(ld, T->Y, T->Z);
+  fp2add(ld, ld, ld);                   // ld = 2YZ
+
+  // n = Ld*(Ld*(Z*yQ-Y) - Ln*(Z*xQ-X))
+  fp2mul_mont(zx, T->Z, Q->x);
+  fp2mul_mont(t0, T->Z, Q->y);
+  fp2sub(t0, t0, T->Y);
+  fp2mul_mont(t0, t0, ld);
+  fp2sub(t1, zx, T->X);
+  fp2mul_mont(t1, t1, ln);
+  fp2sub(t0, t0, t1);
+  fp2mul_mont(n, t0, ld);
+
+  // xn = Ln^2*Z - (AZ+2X)*Ld^2, d = Ld^2*Z*xQ - xn
+  fp2sqr_mont(ld2, ld);
+  fp2sqr_mont(t0, ln);
+  fp2mul_mont(t0, t0, T->Z);
+  fp2mul_mont(t1, A, T->Z);
+  fp2add(t1, t1, T->X);
+  fp2add(t1, t1, T->X);
+  fp2mul_mont(t1, t1, ld2);
+  fp2sub(xn, t0, t1);
+  fp2mul_mont(d, ld2, zx);
+  fp2sub(d, d, xn);
+
+  // 2T = (Xn*Ld : Ln*(X*Ld^2-Xn) - Y*Ld^3 : Z*Ld^3)
+  fp2mul_mont(t0, T->X, ld2);
+  fp2sub(t0, t0, xn);
+  fp2mul_mont(t0, t0, ln);
+  fp2mul_mont(ld2, ld2, ld);            // ld2 = Ld^3
+  fp2mul_mont(t1, T->Y, ld2);
+  fp2sub(T->Y, t0, t1);
+  fp2mul_mont(T->X, xn, ld);
+  fp2mul_mont(T->Z, T->Z, ld2);
+}
+
+// Miller addition step: T = T + S and f = f * n/d with n/d = l_{T,S}(Q)/v_{T+S}(Q),
+// where for Mn = Y2*Z1-Y1*Z2, Md = X2*Z1-X1*Z2, W = Z1*Z2 (T = (X1:Y1:Z1), S = (X2:Y2:Z2))
+//   l_{T,S}(Q)  = (Md*(Z1*yQ-Y1) - Mn*(Z1*xQ-X1)) / (Md*Z1)
+//   v_{T+S}(Q)  = (Md^2*W*xQ - Xn) / (Md^2*W), Xn = Mn^2*W - (AW+X1*Z2+X2*Z1)*Md^2
+static void miller_add(point_full_proj_t T, f2elm_t n, f2elm_t d, const point_full_proj_t S, const point_affine_t Q, const f2elm_t A)
+{
+  f2elm_t t0, t1, mn, md, md2, w, xz1, xz2, yz1, xn;
+
+  fp2mul_mont(yz1, T->Y, S->Z);
+  fp2mul_mont(t0, S->Y, T->Z);
+  fp2sub(mn, t0, yz1);                  // mn = Y2*Z1-Y1*Z2
+  fp2mul_mont(xz1, T->X, S->Z);
+  fp2mul_mont(xz2, S->X, T->Z);
+  fp2sub(md, xz2, xz1);                 // md = X2*Z1-X1*Z2
+  fp2mul_mont(w, T->Z, S->Z);
+
+  // n = Md*Z2*(Md*(Z1*yQ-Y1) - Mn*(Z1*xQ-X1))
+  fp2mul_mont(t0, T->Z, Q->y);
+  fp2sub(t0, t0, T->Y);
+  fp2mul_mont(t0, t0, md);
+  fp2mul_mont(t1, T->Z, Q->x);
+  fp2sub(t1, t1, T->X);
+  fp2mul_mont(t1, t1, mn);
+  fp2sub(t0, t0, t1);
+  fp2mul_mont(t0, t0, md);
+  fp2mul_mont(n, t0, S->Z);
+
+  // xn = Mn^2*W - (AW+X1*Z2+X2*Z1)*Md^2, d = Md^2*W*xQ - xn
+  fp2sqr_mont(md2, md);
+  fp2sqr_mont(t0, mn);
+  fp2mul_mont(t0, t0, w);
+  fp2mul_mont(t1, A, w);
+  fp2add(t1, t1, xz1);
+  fp2add(t1, t1, xz2);
+  fp2mul_mont(t1, t1, md2);
+  fp2sub(xn, t0, t1);
+  fp2mul_mont(d, md2, w);
+  fp2mul_mont(d, d, Q->x);
+  fp2sub(d, d, xn);
+
+  // T+S = (Xn*Md : Mn*(X1*Z2*Md^2-Xn) - Y1*Z2*Md^3 : W*Md^3)
+  fp2mul_mont(t0, xz1, md2);
+  fp2sub(t0, t0, xn);
+  fp2mul_mont(t0, t0, mn);
+  fp2mul_mont(md2, md2, md);            // md2 = Md^3
+  fp2mul_mont(t1, yz1, md2);
+  fp2sub(T->Y, t0, t1);
+  fp2mul_mont(T->X, xn, md);
+  fp2mul_mont(T->Z, w, md2);
+}
+
+// final exponentiation r = (n/d)^(p-1) = a/conj(a) = a^2/(a0^2+a1^2) for a = conj(n)*d,
+// the remaining factor (p+1)/ord is applied by the caller
+static void final_exp_p1(f2elm_t r, const f2elm_t n, const f2elm_t d)
+{
+  f2elm_t a;
+  felm_t t0, t1;
+
+  fp2conj(a, n);
+  fp2mul_mont(a, a, d);
+  fpsqr_mont(t0, a[0]);
+  fpsqr_mont(t1, a[1]);
+  fpadd(t0, t0, t1);
+  fpinv_mont(t0);
+  fp2sqr_mont(r, a);
+  fpmul_mont(r[0], r[0], t0);
+  fpmul_mont(r[1], r[1], t0);
+}
+
+static void point_init(point_full_proj_t T, const point_affine_t P)
+{
+  fp2copy(T->X, P->x);
+  fp2copy(T->Y, P->y);
+  fp2one(T->Z);
+}
+
+// reduced Tate pairing r = e_{2^eA}(P, Q) = f_{2^eA,P}(Q)^((p^2-1)/2^eA) of P of order
+// exactly 2^eA and Q not in <P> on the curve with coefficient A, for 8 independent lanes
+void Tate_pairing_2e(f2elm_t r, const point_affine_t P, const point_affine_t Q, const f2elm_t A)
+{
+  point_full_proj_t T;
+  f2elm_t n, d, ln, ld;
+  int i;
+
+  point_init(T, P);
+  fp2one(n);
+  fp2one(d);
+
+  // Miller loop f_{2^eA,P}, kept as the fraction n/d
+  for (i = 0; i < OALICE_BITS-1; i++) {
+    miller_dbl(T, ln, ld, Q, A);
+    fp2sqr_mont(n, n);
+    fp2mul_mont(n, n, ln);
+    fp2sqr_mont(d, d);
+    fp2mul_mont(d, d, ld);
+  }
+
+  // T has order 2: the tangent is the vertical line (Z*xQ-X)/Z and 2T = O
+  fp2mul_mont(ln, T->Z, Q->x);
+  fp2sub(ln, ln, T->X);
+  fp2sqr_mont(n, n);
+  fp2mul_mont(n, n, ln);
+  fp2sqr_mont(d, d);
+  fp2mul_mont(d, d, T->Z);
+
+  // (p^2-1)/2^eA = (p-1) * 3^eB
+  final_exp_p1(r, n, d);
+  fp2pow_b(r, r, 3, OBOB_EXPON);
+}
+
+// reduced Tate pairing r = e_{3^eB}(P, Q) = f_{3^eB,P}(Q)^((p^2-1)/3^eB) of P of order
+// exactly 3^eB and Q not in <P> on the curve with coefficient A, for 8 independent lanes
+void Tate_pairing_3e(f2elm_t r, const point_affine_t P, const point_affine_t Q, const f2elm_t A)
+{
+  point_full_proj_t T, T2;
+  f2elm_t n, d, n2, d2, ln, ld;
+  int i;
+
+  point_init(T, P);
+  fp2one(n);
+  fp2one(d);
+
+  // Miller loop f_{3^eB,P}: f_{3T} = f_T^3 * l_{T,T}/v_{2T} * l_{T,2T}/v_{3T}
+  for (i = 0; i < OBOB_EXPON-1; i++) {
+    fp2copy(T2->X, T->X);
+    fp2copy(T2->Y, T->Y);
+    fp2copy(T2->Z, T->Z);
+    miller_dbl(T2, ln, ld, Q, A);
+    miller_add(T, n2, d2, T2, Q, A);
+    fp2mul_mont(ln, ln, n2);
+    fp2mul_mont(ld, ld, d2);
+    fp2sqr_mont(n2, n);
+    fp2mul_mont(n, n2, n);
+    fp2mul_mont(n, n, ln);
+    fp2sqr_mont(d2, d);
+    fp2mul_mont(d, d2, d);
+    fp2mul_mont(d, d, ld);
+  }
+
+  // T has order 3: 2T = -T, so v_{2T} and l_{T,2T} are the same vertical line and
+  // v_{3T} = 1, which leaves f_{3T} = f_T^3 * l_{T,T}
+  fp2copy(T2->X, T->X);
+  fp2copy(T2->Y, T->Y);
+  fp2copy(T2->Z, T->Z);
+  miller_dbl(T2, ln, ld, Q, A);         // ln = l_{T,T} * Ld*Z * Ld
+  fp2add(ld, T->Y, T->Y);
+  fp2mul_mont(ld, ld, T->Z);            // ld = Ld = 2YZ
+  fp2sqr_mont(d2, ld);
+  fp2mul_mont(d2, d2, T->Z);            // d2 = Ld^2*Z
+  fp2sqr_mont(n2, n);
+  fp2mul_mont(n, n2, n);
+  fp2mul_mont(n, n, ln);
+  fp2sqr_mont(n2, d);
+  fp2mul_mont(d, n2, d);
+  fp2mul_mont(d, d, d2);
+
+  // (p^2-1)/3^eB = (p-1) * 2^eA
+  final_exp_p1(r, n, d);
+  fp2pow_b(r, r, 2, OALICE_BITS);
+}
+
+// discrete logarithm h = g^k for g of order b^e, windowed Pohlig-Hellman with windows
+// of w digits: digit i is found by matching (h*g^(-k mod b^pos))^(b^(e-pos-w)) in
+// the table g^(j*b^(e-w)), k is written into kwords 64-bit words of every lane
+static void dlog_ph(__m512i *k, const int kwords, const f2elm_t h, const f2elm_t g, const int b, const int e, const int w)
+{
+  f2elm_t tab[DLOG_TABLE], t, r, gi;
+  __m512i digit[OALICE_BITS], c[2*DLOG_WORDS], carry, m, s;
+  int i, j, n, pos, wi, bw, stride, mult, nd, dbits;
+  __mmask8 mask;
+
+  for (bw = 1, i = 0; i < w; i++) bw *= b;
+  for (dbits = 0; (1 << dbits) < bw; dbits++);
+
+  // tab[j] = g^(j*b^(e-w)), the elements of order dividing b^w
+  fp2pow_b(t, g, b, e-w);
+  fp2one(tab[0]);
+  for (j = 1; j < bw; j++) fp2mul_mont(tab[j], tab[j-1], t);
+  for (j = 0; j < bw; j++) fp2correction(tab[j]);
+
+  fp2copy(r, h);
+  fp2conj(gi, g);                       // gi = g^(-b^pos)
+  for (n = 0, pos = 0; pos < e; n++, pos += wi) {
+    wi = (e-pos < w) ? e-pos : w;
+    for (stride = 1, i = wi; i < w; i++) stride *= b;
+
+    // r^(b^(e-pos-wi)) = g^(digit*b^(e-wi)) = tab[digit*stride]
+    fp2pow_b(t, r, b, e-pos-wi);
+    fp2correction(t);
+    digit[n] = VZERO;
+    for (j = 0; j*stride < bw; j++) {
+      mask = fp2equal(t, tab[j*stride]);
+      digit[n] = VMBLEND(mask, digit[n], VSET1(j));
+    }
+
+    // r = r * g^(-digit*b^pos), gi = gi^(b^wi)
+    if (pos+wi < e) {
+      fp2pow_mont(t, gi, &digit[n], dbits);
+      fp2mul_mont(r, r, t);
+      fp2pow_b(gi, gi, b, wi);
+    }
+  }
+
+  // k = sum digit[i]*b^(pos_i) by Horner's rule in 32-bit chunks
+  nd = 2*kwords;
+  for (j = 0; j < nd; j++) c[j] = VZERO;
+  for (i = n-1; i >= 0; i--) {
+    wi = (i == n-1) ? 0 : w;
+    for (mult = 1, j = 0; j < wi; j++) mult *= b;
+    m = VSET1(mult);
+    carry = digit[i];
+    for (j = 0; j < nd; j++) {
+      s = VADD(VMUL(c[j], m), carry);
+      c[j] = VAND(s, VSET1(0xFFFFFFFF));
+      carry = VSHR(s, 32);
+    }
+  }
+  for (j = 0; j < kwords; j++) k[j] = VOR(c[2*j], VSHL(c[2*j+1], 32));
+}
+
+// k = log_g(h) in [0, 2^eA) for g of order 2^eA, into SK_A_VECTS words of every lane
+void dlog_2e(__m512i *k, const f2elm_t h, const f2elm_t g)
+{
+  dlog_ph(k, SK_A_VECTS, h, g, 2, OALICE_BITS, DLOG_W2);
+}
+
+// k = log_g(h) in [0, 3^eB) for g of order 3^eB, into SK_B_VECTS words of every lane
+void dlog_3e(__m512i *k, const f2elm_t h, const f2elm_t g)
+{
+  dlog_ph(k, SK_B_VECTS, h, g, 3, OBOB_EXPON, DLOG_W3);
+}
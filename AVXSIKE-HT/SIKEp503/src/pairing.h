@@ -0,0 +1,23 @@
+/********************************************************************************************
+* Reduced Tate pairings and Pohlig-Hellman discrete logarithms, 8 lanes
+*********************************************************************************************/
+
+#ifndef _PAIRING_H
+#define _PAIRING_H
+
+#include "curve.h"
+
+// affine point (x, y) on the Montgomery curve y^2 = x^3 + A*x^2 + x
+typedef struct { f2elm_t x; f2elm_t y; } point_affine;
+typedef point_affine point_affine_t[1];
+
+void fp2sqrt_mont(f2elm_t r, const f2elm_t a);
+void fp2pow_mont(f2elm_t r, const f2elm_t a, const __m512i *k, const int nbits);
+void recover_y(f2elm_t y, const f2elm_t x, const f2elm_t A);
+
+void Tate_pairing_2e(f2elm_t r, const point_affine_t P, const point_affine_t Q, const f2elm_t A);
+void Tate_pairing_3e(f2elm_t r, const point_affine_t P, const point_affine_t Q, const f2elm_t A);
+void dlog_2e(__m512i *k, const f2elm_t h, const f2elm_t g);
+void dlog_3e(__m512i *k, const f2elm_t h, const f2elm_t g);
+
+#endif
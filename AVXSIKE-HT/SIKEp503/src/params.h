@@ -15,6 +15,7 @@
 #define BOB                     1 
 #define OALICE_BITS             250  
 #define OBOB_BITS               253
+#define OBOB_EXPON              159
 #define MASK_ALICE              0x03 
 #define MASK_BOB                0x0F 
 #define GFP_BYTES               63
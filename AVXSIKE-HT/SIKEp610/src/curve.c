@@ -33,12 +33,43 @@ void xDBL(const point_proj_t P, point_proj_t Q, const f2elm_t A24plus, const f2e
   fp2mul_mont(Q->Z, Q->Z, t1);          // Z2 = [A24plus*[(X1+Z1)^2-(X1-Z1)^2] + C24*(X1-Z1)^2]*[(X1+Z1)^2-(X1-Z1)^2]
 }
 
+// xDBL with A24plus and C24 prepared by fp2mul_prepare, Q may be P
+static void xDBL_bs(const point_proj *P, point_proj *Q, const f2elm_t A24plus, const f2elm_t C24, felm_t *cs)
+{
+  f2elm_t t0, t1;
+
+  mp2_sub_p2(t0, P->X, P->Z);           // t0 = X1-Z1
+  mp2_add(t1, P->X, P->Z);              // t1 = X1+Z1
+  fp2sqr_mont(t0, t0);                  // t0 = (X1-Z1)^2
+  fp2sqr_mont(t1, t1);                  // t1 = (X1+Z1)^2
+  fp2mul_mont_bs(Q->Z, t0, C24, cs[1]); // Z2 = C24*(X1-Z1)^2
+  fp2mul_mont(Q->X, t1, Q->Z);          // X2 = C24*(X1-Z1)^2*(X1+Z1)^2
+  mp2_sub_p2(t1, t1, t0);               // t1 = (X1+Z1)^2-(X1-Z1)^2
+  fp2mul_mont_bs(t0, t1, A24plus, cs[0]); // t0 = A24plus*[(X1+Z1)^2-(X1-Z1)^2]
+  mp2_add(Q->Z, Q->Z, t0);              // Z2 = A24plus*[(X1+Z1)^2-(X1-Z1)^2] + C24*(X1-Z1)^2
+  fp2mul_mont(Q->Z, Q->Z, t1);          // Z2 = [A24plus*[(X1+Z1)^2-(X1-Z1)^2] + C24*(X1-Z1)^2]*[(X1+Z1)^2-(X1-Z1)^2]
+}
+
+// e-fold doubling: the curve constants are prepared once for the e steps, which then
+// run in place on Q
 void xDBLe(const point_proj_t P, point_proj_t Q, const f2elm_t A24plus, const f2elm_t C24, const int e)
 {
+  f2elm_t a24, c24;
+  felm_t cs[2];
   int i;
 
-  pointcopy(Q, P);
-  for (i = 0; i < e; i++) xDBL(Q, Q, A24plus, C24);
+  if (e < 2) {
+    if (e == 0) pointcopy(Q, P);
+    else xDBL(P, Q, A24plus, C24);
+    return;
+  }
+
+  fp2copy(a24, A24plus);
+  fp2copy(c24, C24);
+  fp2mul_prepare(cs[0], a24);
+  fp2mul_prepare(cs[1], c24);
+  xDBL_bs(P, Q, a24, c24, cs);
+  for (i = 1; i < e; i++) xDBL_bs(Q, Q, a24, c24, cs);
 }
 
 void get_2_isog(const point_proj_t P, f2elm_t A, f2elm_t C)
@@ -97,6 +128,62 @@ void eval_4_isog(point_proj_t P, f2elm_t *coeff)
   fp2mul_mont(P->Z, P->Z, t0);                    // Zfinal
 }
 
+// eval_4_isog at two points with coefficients prepared by fp2mul_prepare, the
+// two independent evaluations are interleaved
+static void eval_4_isog_x2(point_proj *P, point_proj *Q, f2elm_t *coeff, felm_t *cs)
+{
+  f2elm_t t0, t1, s0, s1;
+
+  mp2_add(t0, P->X, P->Z);                        // t0 = X+Z
+  mp2_add(s0, Q->X, Q->Z);
+  mp2_sub_p2(t1, P->X, P->Z);                     // t1 = X-Z
+  mp2_sub_p2(s1, Q->X, Q->Z);
+  fp2mul_mont_bs(P->X, t0, coeff[1], cs[1]);      // X = (X+Z)*coeff[1]
+  fp2mul_mont_bs(Q->X, s0, coeff[1], cs[1]);
+  fp2mul_mont_bs(P->Z, t1, coeff[2], cs[2]);      // Z = (X-Z)*coeff[2]
+  fp2mul_mont_bs(Q->Z, s1, coeff[2], cs[2]);
+  fp2mul_mont(t0, t0, t1);                        // t0 = (X+Z)*(X-Z)
+  fp2mul_mont(s0, s0, s1);
+  fp2mul_mont_bs(t0, t0, coeff[0], cs[0]);        // t0 = coeff[0]*(X+Z)*(X-Z)
+  fp2mul_mont_bs(s0, s0, coeff[0], cs[0]);
+  mp2_add(t1, P->X, P->Z);                        // t1 = (X-Z)*coeff[2] + (X+Z)*coeff[1]
+  mp2_add(s1, Q->X, Q->Z);
+  mp2_sub_p2(P->Z, P->X, P->Z);                   // Z = (X-Z)*coeff[2] - (X+Z)*coeff[1]
+  mp2_sub_p2(Q->Z, Q->X, Q->Z);
+  fp2sqr_mont(t1, t1);                            // t1 = [(X-Z)*coeff[2] + (X+Z)*coeff[1]]^2
+  fp2sqr_mont(s1, s1);
+  fp2sqr_mont(P->Z, P->Z);                        // Z = [(X-Z)*coeff[2] - (X+Z)*coeff[1]]^2
+  fp2sqr_mont(Q->Z, Q->Z);
+  mp2_add(P->X, t1, t0);                          // X = coeff[0]*(X+Z)*(X-Z) + [(X-Z)*coeff[2] + (X+Z)*coeff[1]]^2
+  mp2_add(Q->X, s1, s0);
+  mp2_sub_p2(t0, P->Z, t0);                       // t0 = [(X-Z)*coeff[2] - (X+Z)*coeff[1]]^2 - coeff[0]*(X+Z)*(X-Z)
+  mp2_sub_p2(s0, Q->Z, s0);
+  fp2mul_mont(P->X, P->X, t1);                    // Xfinal
+  fp2mul_mont(Q->X, Q->X, s1);
+  fp2mul_mont(P->Z, P->Z, t0);                    // Zfinal
+  fp2mul_mont(Q->Z, Q->Z, s0);
+}
+
+// eval_4_isog at the n points pts[] and, when they are not NULL, at phiP, phiQ and phiR.
+// The coefficients are prepared once for all the points, which are then evaluated two at a time
+void eval_4_isog_multi(point_proj_t *pts, const int n, point_proj_t phiP, point_proj_t phiQ, point_proj_t phiR, f2elm_t *coeff)
+{
+  point_proj *Q[MAX_INT_POINTS_ALICE+3];
+  felm_t cs[3];
+  int i, m = 0;
+
+  for (i = 0; i < n; i++) Q[m++] = pts[i];
+  if (phiP != NULL) {
+    Q[m++] = phiP; Q[m++] = phiQ; Q[m++] = phiR;
+  }
+
+  fp2mul_prepare(cs[0], coeff[0]);
+  fp2mul_prepare(cs[1], coeff[1]);
+  fp2mul_prepare(cs[2], coeff[2]);
+  for (i = 0; i+1 < m; i += 2) eval_4_isog_x2(Q[i], Q[i+1], coeff, cs);
+  if (i < m) eval_4_isog(Q[i], coeff);
+}
+
 void xTPL(const point_proj_t P, point_proj_t Q, const f2elm_t A24minus, const f2elm_t A24plus)  
 {
   f2elm_t t0, t1, t2, t3, t4, t5, t6;
@@ -125,12 +212,55 @@ void xTPL(const point_proj_t P, point_proj_t Q, const f2elm_t A24minus, const f2
   fp2mul_mont(Q->Z, t0, t1);                      // Z3 = 2*Z*t1
 }
 
+// xTPL with A24minus and A24plus prepared by fp2mul_prepare, Q may be P
+static void xTPL_bs(const point_proj *P, point_proj *Q, const f2elm_t A24minus, const f2elm_t A24plus, felm_t *cs)
+{
+  f2elm_t t0, t1, t2, t3, t4, t5, t6;
+
+  mp2_sub_p2(t0, P->X, P->Z);                     // t0 = X-Z
+  fp2sqr_mont(t2, t0);                            // t2 = (X-Z)^2
+  mp2_add(t1, P->X, P->Z);                        // t1 = X+Z
+  fp2sqr_mont(t3, t1);                            // t3 = (X+Z)^2
+  mp2_add(t4, P->X, P->X);                        // t4 = 2*X
+  mp2_add(t0, P->Z, P->Z);                        // t0 = 2*Z
+  fp2sqr_mont(t1, t4);                            // t1 = 4*X^2
+  mp2_sub_p2(t1, t1, t3);                         // t1 = 4*X^2 - (X+Z)^2
+  mp2_sub_p2(t1, t1, t2);                         // t1 = 4*X^2 - (X+Z)^2 - (X-Z)^2
+  fp2mul_mont_bs(t5, t3, A24plus, cs[1]);         // t5 = A24plus*(X+Z)^2
+  fp2mul_mont(t3, t3, t5);                        // t3 = A24plus*(X+Z)^4
+  fp2mul_mont_bs(t6, t2, A24minus, cs[0]);        // t6 = A24minus*(X-Z)^2
+  fp2mul_mont(t2, t2, t6);                        // t2 = A24minus*(X-Z)^4
+  mp2_sub_p2(t3, t2, t3);                         // t3 = A24minus*(X-Z)^4 - A24plus*(X+Z)^4
+  mp2_sub_p2(t2, t5, t6);                         // t2 = A24plus*(X+Z)^2 - A24minus*(X-Z)^2
+  fp2mul_mont(t1, t1, t2);                        // t1 = [4*X^2 - (X+Z)^2 - (X-Z)^2]*[A24plus*(X+Z)^2 - A24minus*(X-Z)^2]
+  fp2add(t2, t3, t1);                             // t2 = [4*X^2 - (X+Z)^2 - (X-Z)^2]*[A24plus*(X+Z)^2 - A24minus*(X-Z)^2] + A24minus*(X-Z)^4 - A24plus*(X+Z)^4
+  fp2sqr_mont(t2, t2);                            // t2 = t2^2
+  fp2mul_mont(Q->X, t4, t2);                      // X3 = 2*X*t2
+  fp2sub(t1, t3, t1);                             // t1 = A24minus*(X-Z)^4 - A24plus*(X+Z)^4 - [4*X^2 - (X+Z)^2 - (X-Z)^2]*[A24plus*(X+Z)^2 - A24minus*(X-Z)^2]
+  fp2sqr_mont(t1, t1);                            // t1 = t1^2
+  fp2mul_mont(Q->Z, t0, t1);                      // Z3 = 2*Z*t1
+}
+
+// e-fold tripling: the curve constants are prepared once for the e steps, which then
+// run in place on Q
 void xTPLe(const point_proj_t P, point_proj_t Q, const f2elm_t A24minus, const f2elm_t A24plus, const int e)
 {
+  f2elm_t a24m, a24p;
+  felm_t cs[2];
   int i;
 
-  pointcopy(Q, P);
-  for (i = 0; i < e; i++) xTPL(Q, Q, A24minus, A24plus);
+  if (e < 2) {
+    if (e == 0) pointcopy(Q, P);
+    else xTPL(P, Q, A24minus, A24plus);
+    return;
+  }
+
+  fp2copy(a24m, A24minus);
+  fp2copy(a24p, A24plus);
+  fp2mul_prepare(cs[0], a24m);
+  fp2mul_prepare(cs[1], a24p);
+  xTPL_bs(P, Q, a24m, a24p, cs);
+  for (i = 1; i < e; i++) xTPL_bs(Q, Q, a24m, a24p, cs);
 }
 
 void get_3_isog(const point_proj_t P, f2elm_t A24minus, f2elm_t A24plus, f2elm_t* coeff)
@@ -171,6 +301,53 @@ void eval_3_isog(point_proj_t Q, const f2elm_t *coeff)
   fp2mul_mont(Q->Z, Q->Z, t0);                  // Z3final = Z*[coeff1*(X-Z) - coeff0*(X+Z)]^2
 }
 
+// eval_3_isog at two points with coefficients prepared by fp2mul_prepare, the
+// two independent evaluations are interleaved
+static void eval_3_isog_x2(point_proj *P, point_proj *Q, f2elm_t *coeff, felm_t *cs)
+{
+  f2elm_t t0, t1, t2, s0, s1, s2;
+
+  mp2_add(t0, P->X, P->Z);                      // t0 = X+Z
+  mp2_add(s0, Q->X, Q->Z);
+  mp2_sub_p2(t1, P->X, P->Z);                   // t1 = X-Z
+  mp2_sub_p2(s1, Q->X, Q->Z);
+  fp2mul_mont_bs(t0, t0, coeff[0], cs[0]);      // t0 = coeff0*(X+Z)
+  fp2mul_mont_bs(s0, s0, coeff[0], cs[0]);
+  fp2mul_mont_bs(t1, t1, coeff[1], cs[1]);      // t1 = coeff1*(X-Z)
+  fp2mul_mont_bs(s1, s1, coeff[1], cs[1]);
+  mp2_add(t2, t0, t1);                          // t2 = coeff0*(X+Z) + coeff1*(X-Z)
+  mp2_add(s2, s0, s1);
+  mp2_sub_p2(t0, t1, t0);                       // t0 = coeff1*(X-Z) - coeff0*(X+Z)
+  mp2_sub_p2(s0, s1, s0);
+  fp2sqr_mont(t2, t2);                          // t2 = [coeff0*(X+Z) + coeff1*(X-Z)]^2
+  fp2sqr_mont(s2, s2);
+  fp2sqr_mont(t0, t0);                          // t0 = [coeff1*(X-Z) - coeff0*(X+Z)]^2
+  fp2sqr_mont(s0, s0);
+  fp2mul_mont(P->X, P->X, t2);                  // X3final = X*[coeff0*(X+Z) + coeff1*(X-Z)]^2
+  fp2mul_mont(Q->X, Q->X, s2);
+  fp2mul_mont(P->Z, P->Z, t0);                  // Z3final = Z*[coeff1*(X-Z) - coeff0*(X+Z)]^2
+  fp2mul_mont(Q->Z, Q->Z, s0);
+}
+
+// eval_3_isog at the n points pts[] and, when they are not NULL, at phiP, phiQ and phiR.
+// The coefficients are prepared once for all the points, which are then evaluated two at a time
+void eval_3_isog_multi(point_proj_t *pts, const int n, point_proj_t phiP, point_proj_t phiQ, point_proj_t phiR, f2elm_t *coeff)
+{
+  point_proj *Q[MAX_INT_POINTS_BOB+3];
+  felm_t cs[2];
+  int i, m = 0;
+
+  for (i = 0; i < n; i++) Q[m++] = pts[i];
+  if (phiP != NULL) {
+    Q[m++] = phiP; Q[m++] = phiQ; Q[m++] = phiR;
+  }
+
+  fp2mul_prepare(cs[0], coeff[0]);
+  fp2mul_prepare(cs[1], coeff[1]);
+  for (i = 0; i+1 < m; i += 2) eval_3_isog_x2(Q[i], Q[i+1], coeff, cs);
+  if (i < m) eval_3_isog(Q[i], coeff);
+}
+
 void inv_3_way(f2elm_t r1, f2elm_t r2, f2elm_t r3)
 {
   f2elm_t t0, t1, t2, t3;
@@ -210,6 +387,32 @@ void get_A(const f2elm_t xP, const f2elm_t xQ, const f2elm_t xR, f2elm_t A)
   fp2sub(A, A, t1);                             // Afinal = A-t1
 }
 
+// projective version of get_A: (A:C) with C = 4*xP*xQ*xR, without the inversion
+void get_A_proj(const f2elm_t xP, const f2elm_t xQ, const f2elm_t xR, f2elm_t A, f2elm_t C)
+{
+  f2elm_t t0, t1, one;
+  int i;
+
+  for (i = 0; i < NWORDS; i++) { 
+    one[0][i] = VSET1(mont_R[i]);
+    one[1][i] = VZERO;
+  }
+
+  fp2add(t1, xP, xQ);                           // t1 = xP+xQ
+  fp2mul_mont(t0, xP, xQ);                      // t0 = xP*xQ
+  fp2mul_mont(A, xR, t1);                       // A = xR*t1
+  fp2add(A, t0, A);                             // A = A+t0
+  fp2mul_mont(t0, t0, xR);                      // t0 = t0*xR
+  fp2sub(A, A, one);                            // A = A-1
+  fp2add(t0, t0, t0);                           // t0 = t0+t0
+  fp2add(t1, t1, xR);                           // t1 = t1+xR
+  fp2add(t0, t0, t0);                           // t0 = t0+t0
+  fp2sqr_mont(A, A);                            // A = A^2
+  fp2mul_mont(t1, t1, t0);                      // t1 = t1*t0
+  fp2sub(A, A, t1);                             // Afinal = A-t1*t0
+  fp2copy(C, t0);                               // Cfinal = t0
+}
+
 void j_inv(const f2elm_t A, const f2elm_t C, f2elm_t jinv)
 {
   f2elm_t t0, t1;
@@ -257,6 +460,33 @@ void xDBLADD(point_proj_t P, point_proj_t Q, const f2elm_t XPQ, const f2elm_t ZP
   fp2mul_mont(Q->X, Q->X, ZPQ);                   // XQ = ZPQ*[(XP+ZP)*(XQ-ZQ)+(XP-ZP)*(XQ+ZQ)]^2 
 }
 
+// xDBLADD with the projective constants A24plus = A+2C and C24 = 4C 
+void xDBLADD_proj(point_proj_t P, point_proj_t Q, const f2elm_t XPQ, const f2elm_t ZPQ, const f2elm_t A24plus, const f2elm_t C24)
+{
+  f2elm_t t0, t1, t2;
+
+  mp2_add(t0, P->X, P->Z);                        // t0 = XP+ZP
+  mp2_sub_p2(t1, P->X, P->Z);                     // t1 = XP-ZP
+  fp2sqr_mont(P->X, t0);                          // XP = (XP+ZP)^2
+  mp2_sub_p2(t2, Q->X, Q->Z);                     // t2 = XQ-ZQ
+  mp2_add(Q->X, Q->X, Q->Z);                      // XQ = XQ+ZQ
+  fp2mul_mont(t0, t0, t2);                        // t0 = (XP+ZP)*(XQ-ZQ)
+  fp2sqr_mont(P->Z, t1);                          // ZP = (XP-ZP)^2
+  fp2mul_mont(t1, t1, Q->X);                      // t1 = (XP-ZP)*(XQ+ZQ)
+  mp2_sub_p2(t2, P->X, P->Z);                     // t2 = (XP+ZP)^2-(XP-ZP)^2
+  fp2mul_mont(P->Z, C24, P->Z);                   // ZP = C24*(XP-ZP)^2
+  fp2mul_mont(P->X, P->X, P->Z);                  // XP = C24*(XP+ZP)^2*(XP-ZP)^2
+  fp2mul_mont(Q->X, A24plus, t2);                 // XQ = A24plus*[(XP+ZP)^2-(XP-ZP)^2]
+  mp2_sub_p2(Q->Z, t0, t1);                       // ZQ = (XP+ZP)*(XQ-ZQ)-(XP-ZP)*(XQ+ZQ)
+  mp2_add(P->Z, Q->X, P->Z);                      // ZP = A24plus*[(XP+ZP)^2-(XP-ZP)^2]+C24*(XP-ZP)^2
+  mp2_add(Q->X, t0, t1);                          // XQ = (XP+ZP)*(XQ-ZQ)+(XP-ZP)*(XQ+ZQ)
+  fp2mul_mont(P->Z, P->Z, t2);                    // ZP = [A24plus*[(XP+ZP)^2-(XP-ZP)^2]+C24*(XP-ZP)^2]*[(XP+ZP)^2-(XP-ZP)^2]
+  fp2sqr_mont(Q->Z, Q->Z);                        // ZQ = [(XP+ZP)*(XQ-ZQ)-(XP-ZP)*(XQ+ZQ)]^2
+  fp2sqr_mont(Q->X, Q->X);                        // XQ = [(XP+ZP)*(XQ-ZQ)+(XP-ZP)*(XQ+ZQ)]^2
+  fp2mul_mont(Q->Z, Q->Z, XPQ);                   // ZQ = xPQ*[(XP+ZP)*(XQ-ZQ)-(XP-ZP)*(XQ+ZQ)]^2
+  fp2mul_mont(Q->X, Q->X, ZPQ);                   // XQ = ZPQ*[(XP+ZP)*(XQ-ZQ)+(XP-ZP)*(XQ+ZQ)]^2 
+}
+
 static void swap_points(point_proj_t P, point_proj_t Q, const __m512i option)
 {
   __m512i temp;
@@ -321,3 +551,156 @@ void LADDER3PT(const f2elm_t xP, const f2elm_t xQ, const f2elm_t xPQ, const __m5
   mask = VSUB(VZERO, swap);
   swap_points(R, R2, mask);
 }
+
+// LADDER3PT on a curve given by the projective constants A24plus = A+2C and C24 = 4C, 
+// so that the secret agreement does not need an affine A 
+void LADDER3PT_proj(const f2elm_t xP, const f2elm_t xQ, const f2elm_t xPQ, const __m512i* m, const int AliceOrBob, point_proj_t R, const f2elm_t A24plus, const f2elm_t C24)
+{
+  point_proj_t R0, R2;
+  __m512i mask, swap, bit, prevbit = VZERO;
+  int i, nbits;
+
+  if (AliceOrBob == ALICE) nbits = OALICE_BITS;
+  else                     nbits = OBOB_BITS - 1;
+
+  // initializing points 
+  fp2copy(R0->X, xQ);                   // R0 = <xQ, 1>
+  fp2copy(R2->X, xPQ);                  // R2 = <xPQ, 1>
+  fp2copy(R->X, xP);                    // R = <xP, 1>
+  for (i = 0; i < NWORDS; i++) {
+    R0->Z[0][i] = R2->Z[0][i] = R->Z[0][i] = VSET1(mont_R[i]);
+    R0->Z[1][i] = R2->Z[1][i] = R->Z[1][i] = VZERO;
+  }
+
+  // Main loop
+  for (i = 0; i < nbits; i++) {
+    bit = VAND(VSRA(m[i>>6], i&63), VSET1(1));
+    swap = VXOR(bit, prevbit);
+    prevbit = bit;
+    mask = VSUB(VZERO, swap);
+
+    swap_points(R, R2, mask);
+    xDBLADD_proj(R0, R2, R->X, R->Z, A24plus, C24);
+  }
+  swap = VXOR(VZERO, prevbit);
+  mask = VSUB(VZERO, swap);
+  swap_points(R, R2, mask);
+}
+
+// Fixed-basis Montgomery ladder for the key generation of Alice and Bob. 
+// All 8 lanes share the public basis, so R0 = [2^i]Q of every ladder step is 
+// a constant and each step reduces to a differential addition. The tables 
+// ladder_table_A/B of ladder_table.h (generated by tools/strategy.c) hold 
+// XR0+ZR0 and XR0-ZR0 of a single lane and are broadcast on use; they are 
+// projective, so no inversion is needed. 
+
+#include "ladder_table.h"
+
+// the Q part of xDBLADD, where tp = XP+ZP and tm = XP-ZP are read from a table
+static void xADD_fixed(point_proj_t Q, const f2elm_t tp, const f2elm_t tm, const f2elm_t XPQ, const f2elm_t ZPQ)
+{
+  f2elm_t t0, t1, t2;
+
+  mp2_sub_p2(t2, Q->X, Q->Z);                     // t2 = XQ-ZQ
+  mp2_add(Q->X, Q->X, Q->Z);                      // XQ = XQ+ZQ
+  fp2mul_mont(t0, tp, t2);                        // t0 = (XP+ZP)*(XQ-ZQ)
+  fp2mul_mont(t1, tm, Q->X);                      // t1 = (XP-ZP)*(XQ+ZQ)
+  mp2_sub_p2(Q->Z, t0, t1);                       // ZQ = (XP+ZP)*(XQ-ZQ)-(XP-ZP)*(XQ+ZQ)
+  mp2_add(Q->X, t0, t1);                          // XQ = (XP+ZP)*(XQ-ZQ)+(XP-ZP)*(XQ+ZQ)
+  fp2sqr_mont(Q->Z, Q->Z);                        // ZQ = [(XP+ZP)*(XQ-ZQ)-(XP-ZP)*(XQ+ZQ)]^2
+  fp2sqr_mont(Q->X, Q->X);                        // XQ = [(XP+ZP)*(XQ-ZQ)+(XP-ZP)*(XQ+ZQ)]^2
+  fp2mul_mont(Q->Z, Q->Z, XPQ);                   // ZQ = xPQ*[(XP+ZP)*(XQ-ZQ)-(XP-ZP)*(XQ+ZQ)]^2
+  fp2mul_mont(Q->X, Q->X, ZPQ);                   // XQ = ZPQ*[(XP+ZP)*(XQ-ZQ)+(XP-ZP)*(XQ+ZQ)]^2 
+}
+
+void LADDER3PT_fixed(const f2elm_t xP, const f2elm_t xPQ, const __m512i* m, const int AliceOrBob, point_proj_t R)
+{
+  point_proj_t R2;
+  f2elm_t tp, tm;
+  const uint64_t (*tab)[4][NWORDS];
+  __m512i mask, swap, bit, prevbit = VZERO;
+  int i, j, nbits;
+
+  if (AliceOrBob == ALICE) { nbits = OALICE_BITS;   tab = ladder_table_A; }
+  else                     { nbits = OBOB_BITS - 1; tab = ladder_table_B; }
+
+  // initializing points 
+  fp2copy(R2->X, xPQ);                  // R2 = <xPQ, 1>
+  fp2copy(R->X, xP);                    // R = <xP, 1>
+  for (i = 0; i < NWORDS; i++) {
+    R2->Z[0][i] = R->Z[0][i] = VSET1(mont_R[i]);
+    R2->Z[1][i] = R->Z[1][i] = VZERO;
+  }
+
+  // Main loop
+  for (i = 0; i < nbits; i++) {
+    bit = VAND(VSRA(m[i>>6], i&63), VSET1(1));
+    swap = VXOR(bit, prevbit);
+    prevbit = bit;
+    mask = VSUB(VZERO, swap);
+
+    for (j = 0; j < NWORDS; j++) {
+      tp[0][j] = VSET1(tab[i][0][j]); tp[1][j] = VSET1(tab[i][1][j]);
+      tm[0][j] = VSET1(tab[i][2][j]); tm[1][j] = VSET1(tab[i][3][j]);
+    }
+
+    swap_points(R, R2, mask);
+    xADD_fixed(R2, tp, tm, R->X, R->Z);
+  }
+  swap = VXOR(VZERO, prevbit);
+  mask = VSUB(VZERO, swap);
+  swap_points(R, R2, mask);
+}
+
+// Ladder over a per-lane table, for a public key that is used in many secret 
+// agreements (see PreparePublicKey_B). 
+// tab[i] = { XR0+ZR0, XR0-ZR0 } for R0 = [2^i]Q on the curve (A24plus, C24)
+void ladder_table_vec(f2elm_t (*tab)[2], const f2elm_t xQ, const f2elm_t A24plus, const f2elm_t C24, const int nbits)
+{
+  point_proj_t R0;
+  int i;
+
+  fp2copy(R0->X, xQ);                   // R0 = <xQ, 1>
+  for (i = 0; i < NWORDS; i++) {
+    R0->Z[0][i] = VSET1(mont_R[i]);
+    R0->Z[1][i] = VZERO;
+  }
+
+  for (i = 0; i < nbits; i++) {
+    mp2_add(tab[i][0], R0->X, R0->Z);   // tab[i][0] = XR0+ZR0
+    mp2_sub_p2(tab[i][1], R0->X, R0->Z);// tab[i][1] = XR0-ZR0
+    xDBL(R0, R0, A24plus, C24);
+  }
+}
+
+void LADDER3PT_table(const f2elm_t xP, const f2elm_t xPQ, const __m512i* m, const int AliceOrBob, f2elm_t (*tab)[2], point_proj_t R)
+{
+  point_proj_t R2;
+  __m512i mask, swap, bit, prevbit = VZERO;
+  int i, nbits;
+
+  if (AliceOrBob == ALICE) nbits = OALICE_BITS;
+  else                     nbits = OBOB_BITS - 1;
+
+  // initializing points 
+  fp2copy(R2->X, xPQ);                  // R2 = <xPQ, 1>
+  fp2copy(R->X, xP);                    // R = <xP, 1>
+  for (i = 0; i < NWORDS; i++) {
+    R2->Z[0][i] = R->Z[0][i] = VSET1(mont_R[i]);
+    R2->Z[1][i] = R->Z[1][i] = VZERO;
+  }
+
+  // Main loop
+  for (i = 0; i < nbits; i++) {
+    bit = VAND(VSRA(m[i>>6], i&63), VSET1(1));
+    swap = VXOR(bit, prevbit);
+    prevbit = bit;
+    mask = VSUB(VZERO, swap);
+
+    swap_points(R, R2, mask);
+    xADD_fixed(R2, tab[i][0], tab[i][1], R->X, R->Z);
+  }
+  swap = VXOR(VZERO, prevbit);
+  mask = VSUB(VZERO, swap);
+  swap_points(R, R2, mask);
+}
@@ -24,16 +24,24 @@ void get_2_isog(const point_proj_t P, f2elm_t A, f2elm_t C);
 void eval_2_isog(point_proj_t P, point_proj_t Q);
 void get_4_isog(const point_proj_t P, f2elm_t A24plus, f2elm_t C24, f2elm_t *coeff);
 void eval_4_isog(point_proj_t P, f2elm_t *coeff);
+void eval_4_isog_multi(point_proj_t *pts, const int n, point_proj_t phiP, point_proj_t phiQ, point_proj_t phiR, f2elm_t *coeff);
 
 void xTPL(const point_proj_t P, point_proj_t Q, const f2elm_t A24minus, const f2elm_t A24plus);
 void xTPLe(const point_proj_t P, point_proj_t Q, const f2elm_t A24minus, const f2elm_t A24plus, const int e);
 void get_3_isog(const point_proj_t P, f2elm_t A24minus, f2elm_t A24plus, f2elm_t* coeff);
 void eval_3_isog(point_proj_t Q, const f2elm_t *coeff);
+void eval_3_isog_multi(point_proj_t *pts, const int n, point_proj_t phiP, point_proj_t phiQ, point_proj_t phiR, f2elm_t *coeff);
 
 void inv_3_way(f2elm_t r1, f2elm_t r2, f2elm_t r3);
 void get_A(const f2elm_t xP, const f2elm_t xQ, const f2elm_t xR, f2elm_t A);
+void get_A_proj(const f2elm_t xP, const f2elm_t xQ, const f2elm_t xR, f2elm_t A, f2elm_t C);
 void j_inv(const f2elm_t A, const f2elm_t C, f2elm_t jinv);
 void xDBLADD(point_proj_t P, point_proj_t Q, const f2elm_t XPQ, const f2elm_t ZPQ, const f2elm_t A24);
+void xDBLADD_proj(point_proj_t P, point_proj_t Q, const f2elm_t XPQ, const f2elm_t ZPQ, const f2elm_t A24plus, const f2elm_t C24);
 void LADDER3PT(const f2elm_t xP, const f2elm_t xQ, const f2elm_t xPQ, const __m512i* m, const int AliceOrBob, point_proj_t R, const f2elm_t A);
+void LADDER3PT_proj(const f2elm_t xP, const f2elm_t xQ, const f2elm_t xPQ, const __m512i* m, const int AliceOrBob, point_proj_t R, const f2elm_t A24plus, const f2elm_t C24);
+void LADDER3PT_fixed(const f2elm_t xP, const f2elm_t xPQ, const __m512i* m, const int AliceOrBob, point_proj_t R);
+void ladder_table_vec(f2elm_t (*tab)[2], const f2elm_t xQ, const f2elm_t A24plus, const f2elm_t C24, const int nbits);
+void LADDER3PT_table(const f2elm_t xP, const f2elm_t xPQ, const __m512i* m, const int AliceOrBob, f2elm_t (*tab)[2], point_proj_t R);
 
 #endif 
\ No newline at end of file
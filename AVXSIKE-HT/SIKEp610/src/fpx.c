@@ -17,7 +17,7 @@ int8_t ct_compare(const uint8_t *a, const uint8_t *b, unsigned int len)
     for (unsigned int i = 0; i < len; i++)
         r |= a[i] ^ b[i];
 
-    return (-(int8_t)r) >> (8*sizeof(uint8_t)-1);
+    return (int8_t)((-(int32_t)r) >> (8*sizeof(int32_t)-1));
 }
 
 void ct_cmov(uint8_t *r, const uint8_t *a, unsigned int len, int8_t selector) 
@@ -903,6 +903,35 @@ void fp2mul_mont(f2elm_t r, const f2elm_t a, const f2elm_t b)
   rdc_mont(r[0], tt1);                  // r0 = a0b0-a1b1 mod 2p                (only be used here)
  }
 
+// Prepare b for repeated multiplications fp2mul_mont_bs(r, a, b, bs): b is corrected to [0, p]
+// in place and bs = b0+b1 is precomputed
+void fp2mul_prepare(felm_t bs, f2elm_t b)
+{
+  fpcorrection_p4(b[0], b[0]);
+  fpcorrection_p4(b[1], b[1]);
+  mp_addfast(bs, b[0], b[1]);           // bs = b0+b1           in [0, 4p]
+}
+
+// GF(p^2) multiplication r = a*b where b and bs have been prepared by fp2mul_prepare
+void fp2mul_mont_bs(f2elm_t r, const f2elm_t a, const f2elm_t b, const felm_t bs)
+{
+  felm_t t1;
+  dfelm_t tt1, tt2, tt3;
+  f2elm_t ta;
+
+  fpcorrection_p4(ta[0], a[0]);
+  fpcorrection_p4(ta[1], a[1]);
+
+  mp_addfast(t1, ta[0], ta[1]);           // t1 = a0+a1           in [0, 4p]
+  mp_mul(tt1, ta[0], b[0]);               // tt1 = a0*b0          in [0, 4p^2]
+  mp_mul(tt2, ta[1], b[1]);               // tt2 = a1*b1          in [0, 4p^2]
+  mp_mul(tt3, t1, bs);                  // tt3 = (a0+a1)(b0+b1) in [0, 16p^2]
+  mp_dblsubfast(tt3, tt1, tt2);         // tt3 = a0b1+a1b0      in [0, 8p^2]    (only be used here)
+  mp_subaddfast(tt1, tt1, tt2);         // tt1 = a0b0-a1b1      in [0, p*2^612] (only be used here)
+  rdc_mont(r[1], tt3);                  // r1 = a0b1+a1b0 mod 2p                (only be used here)
+  rdc_mont(r[0], tt1);                  // r0 = a0b0-a1b1 mod 2p                (only be used here)
+}
+
 // GF(p^2) inversion using Montgomery arithmetic
 void fp2inv_mont(f2elm_t r)
 {
@@ -0,0 +1,2453 @@
+// Fixed-basis ladder tables of LADDER3PT_fixed computed by tools/strategy.c
+// (./strategy tables > src/ladder_table.h), do not edit.
+// ladder_table_X[i] = { XR0+ZR0, XR0-ZR0 } (real and imaginary parts) for 
+// R0 = [2^i]Q, where Q is the basis point of X_gen on E0.
+
+#ifndef _LADDER_TABLE_H
+#define _LADDER_TABLE_H
+
+#include "curve.h"
+
+static const uint64_t ladder_table_A[OALICE_BITS][4][NWORDS] = {
+  { { 0x25B91D7C945D9, 0x734BEF8259517, 0x3E1E616C072F8, 0x417ADE291A8F4, 0x4A9FAA2D2CABF, 0x169FD5EC8E9D9, 0x4C94587C1C766, 0x08E32C99E8E5D, 0x0A7472D15197F, 0x0042F27EB2B38, 0x7E2F0460A661C, 0x19D1FB53493C5 },
+    { 0x3C001E8B3AA23, 0x2519663C11528, 0x340899BA298F8, 0x3010A77B2FF02, 0x018E22684A2D2, 0x4FA9E90A7B44A, 0x3CE2F006F57BA, 0x5A9C3F51D98E0, 0x7B6FA76EF62D0, 0x415BEA22EA74D, 0x374E4D25FBF90, 0x0A273544BB684 },
+    { 0x25B91D7C945CB, 0x734BEF8259517, 0x3E1E616C072F8, 0x417ADE291A8F4, 0x4A9FAA2D2CABF, 0x169FD5EC8E9D9, 0x31D82F064486D, 0x78B6DE7433073, 0x0FBBFD98ADFBE, 0x01A285D888279, 0x38D7230C1C4E3, 0x300DE49101EB6 },
+    { 0x3C001E8B3AA21, 0x2519663C11528, 0x340899BA298F8, 0x3010A77B2FF02, 0x018E22684A2D2, 0x4FA9E90A7B44A, 0x0235C58868EBB, 0x6A95EB0351DBF, 0x20C30466DECD9, 0x0AB2B60B2D857, 0x3FAF7619E83F6, 0x31E69FBB43814 } },
+  { { 0x665F93E82C1F1, 0x58C92E9A615E5, 0x169D52C393333, 0x584601B2D6AB1, 0x3D6FBDE84B2FE, 0x0E8A68DA5535B, 0x4FD8205FAD493, 0x6DA78AD0D849F, 0x69B17AD1C528B, 0x65D99E02C47BD, 0x5A4F6E75DF483, 0x32D3BCBF17DFB },
+    { 0x38C8311D6578B, 0x4BFC85FA4D4BB, 0x7ED8C26CC0A33, 0x66E98AF295FE2, 0x53814BB356D20, 0x42B09EE1C63B0, 0x0655068FABE55, 0x2C0C1D7DC2962, 0x4FE09774724E1, 0x6C1E7B4269FB7, 0x39B0C89CC83BB, 0x161DE1C4892AF },
+    { 0x7A49BD1FF1557, 0x638F5BB029489, 0x5CC736B784B7F, 0x1ADD7BE6B2347, 0x6E89E4C487FCF, 0x5DFEE67DAA0BE, 0x583EAFAB1F410, 0x4A1C7CCC5463B, 0x545311D41EDB4, 0x740BF25305DDA, 0x7D910629E298E, 0x1CE7BCFAD1015 },
+    { 0x149AF07CB1F9D, 0x2E96027B0F770, 0x2B42021528AD5, 0x479A2FC0FE9AB, 0x1DDAB7573DBD9, 0x6EEAB66E34AD2, 0x2D16DCA53283B, 0x35C18241CDDA9, 0x0D42A5B8316B9, 0x036BD5E831C43, 0x5EC211DE5D806, 0x1DE50F0FB5F01 } },
+  { { 0x69FA0F995AFFA, 0x1A72CCE5706EC, 0x6EA558928A736, 0x1BEE50AAED61D, 0x1DC4CFFE3D871, 0x4AEFD7FCD35D2, 0x1D0D726166E9C, 0x7330ECEBA55D4, 0x0B22C46D55963, 0x6C646BD287090, 0x0334D4AC014B9, 0x29F0A1FE798FE },
+    { 0x0C7A9DE9D1FDD, 0x11A394FF5B515, 0x6E62B185C0D6C, 0x4D41A12A89725, 0x75D967249857F, 0x11903C5C5C4FC, 0x7C3032FEAA2C8, 0x4C98264A76A1B, 0x14A6A568A0AEE, 0x2C7C8758C65B7, 0x56CD05B6F4D0C, 0x1BA7AF9BA472B },
+    { 0x74B544D99EE26, 0x281E0B012EE6C, 0x1CD4E8200158B, 0x4DD4FE81ED953, 0x0E53F01245017, 0x2C29DFA5F72CE, 0x032B4AA0A7BD1, 0x1F79388B823FD, 0x5D50223C9F9E1, 0x51C752C632DCA, 0x54BDABCB2B608, 0x160228491C2DC },
+    { 0x5B23791F3273D, 0x0B98B59CFEDA4, 0x3846843DB53D6, 0x7802DD1873B79, 0x4D0868DA23142, 0x437D483C55075, 0x6054F2AA0F475, 0x2C0C79DB1DAD8, 0x5C33BCC9C709F, 0x145725CB41615, 0x0C84CC5FC5E15, 0x28BB2CCBFF2D8 } },
+  { { 0x6890F92D7783A, 0x2EFB383863896, 0x6948B66F6A9BD, 0x1673B829E12BA, 0x458B08659C4F6, 0x0EBFCE2E4D0B9, 0x7FC14F95FAA7C, 0x00777D5455A06, 0x6D0D7C54DB0E4, 0x64F2569861730, 0x03BCE41409B5A, 0x1AA8A774670ED },
+    { 0x72BD626FD266C, 0x2E7DFFFDE9CD5, 0x52E2ECD8CD922, 0x09C1EC9C8891D, 0x1AEAC52585DBE, 0x3CB450EC60603, 0x599E10660CA5E, 0x3AC51907BA8EB, 0x7DC79BF9E9F84, 0x0F6D62F956629, 0x3224A142273BC, 0x0DEF50C2783E8 },
+    { 0x5E0F0DDABCAA4, 0x01F74A56429F2, 0x6B0F0D5284CB6, 0x697CFFA17B439, 0x525FB45255067, 0x69F2998E50F0D, 0x3402D727ACA47, 0x7C12356664C45, 0x54278F77E51AF, 0x7005C2A456349, 0x3C183258E2DED, 0x0E86BFDA07AE9 },
+    { 0x2567087ED8F4A, 0x78AFE55E4EB7F, 0x680EB54B61DDE, 0x61E452817ADD1, 0x4FE21F3796523, 0x6A5EAAB582C8F, 0x1EC9C18FAD130, 0x5CD353A9DA3CF, 0x4CBAEF0860946, 0x5BC5E04B541A1, 0x0436C68ED9188, 0x2919BDC7E6454 } },
+  { { 0x20BDB0DE81955, 0x0CC4E25C13A7C, 0x360F18952264C, 0x478A1CBE0BA92, 0x351E8631A99F0, 0x3DC5DAF69DC37, 0x3F9A846C5E32B, 0x4E2B8D0F86280, 0x58BA4C88F3CD8, 0x2F21B5375203E, 0x4E7C1E2FCC506, 0x3C73A6556CBD6 },
+    { 0x6C7896B7C58BC, 0x129077F02EA81, 0x3F4C0B7AD6343, 0x1624C6CB9CA76, 0x0E1881C06346D, 0x4DA71B16A1BCC, 0x6CDAFC7F05F70, 0x0141602783FF0, 0x1A12D3248F212, 0x107C90F6D592C, 0x7CAA6A253DC48, 0x1BD0653FF91A4 },
+    { 0x61AD87E137C9F, 0x2AA85A94BC061, 0x68C33978124E6, 0x7116DE50292F4, 0x25943430BA15A, 0x6704BFD2FA258, 0x5B6D6B429527D, 0x47CE715AA22C4, 0x399A84E2242CA, 0x59E6FC358FE2F, 0x53F65F736A743, 0x3213037582037 },
+    { 0x5748DAFF5BC70, 0x316769F287C55, 0x66ECAC4B59FAF, 0x16C38CDCC1761, 0x3218D1833CB39, 0x4A6FB1C83F030, 0x4778783FEC3C8, 0x4701F50206918, 0x424E10D11A36C, 0x2E143166C34BE, 0x5446FFFAEA0B6, 0x22304BC173DA0 } },
+  { { 0x74C7519DA6DDB, 0x2C938219D04C5, 0x750EC19951F6F, 0x65E154F7B0979, 0x6E282A6FDCFEF, 0x6A230A87B76E6, 0x79B3FD2113B30, 0x6545906DE7476, 0x12A513558B52E, 0x6CE8C6FD060BB, 0x255988A7C8880, 0x3501DBCC8AD36 },
+    { 0x2F74289BA1CA5, 0x755C2AD0C18A0, 0x4098A4B5D5005, 0x09C136B57AC36, 0x0E9BCB10ED307, 0x4036742BC355F, 0x6F85F09572C1F, 0x505685BE4C9DA, 0x6109DA4F05261, 0x0AF2307A4233F, 0x62D9089A7E182, 0x127F6CAEBF1BB },
+    { 0x7D1F233812DA7, 0x614B94E73DB16, 0x0C60D27CA5308, 0x6D74EE3E28207, 0x2D1707FE535DD, 0x2D7915F161469, 0x19601A98A8CA4, 0x6836CBDDADF84, 0x23B30F1B49F30, 0x7C2531535415D, 0x534B9A25D5D6B, 0x29E6FE93DBBD7 },
+    { 0x49AE44C554D45, 0x0E189F0ED7841, 0x3797D7CC3297B, 0x45F5FA0D0EA4B, 0x5D17347BAB0C4, 0x18634A714CF98, 0x43F67164EA99D, 0x47CD510619127, 0x480C7D529C933, 0x623C5307C0117, 0x1381B9EDA3F17, 0x29056AF0710F7 } },
+  { { 0x27315ABF63A34, 0x39F17D0A1A5B0, 0x56F91B8BC2F1E, 0x1694543A17265, 0x716FE0C15554C, 0x1B4323430BCA3, 0x42CB4A494EA59, 0x26D7432E61174, 0x739AFF76BD606, 0x63FF2DF8EB40C, 0x5AA97535DE3E5, 0x3F89941D733DE },
+    { 0x61E8081C5873B, 0x221F7C6744AF8, 0x03AC42EFE4BCA, 0x761432934962C, 0x5AEAAC961CF40, 0x79D27A7FE6133, 0x6398668B0AE74, 0x407BAE3EAA9C4, 0x5D77F53545352, 0x603D910744142, 0x3F16270D94D8B, 0x0BF243710DCC3 },
+    { 0x7178DADFA3840, 0x22A4AD3C1ADB5, 0x5E448C4C78B17, 0x54FCE342ABEE5, 0x132C4A96A419C, 0x3C69A5FF543AF, 0x5876F1A6C9743, 0x31196B268C25B, 0x49E7FD200318B, 0x19E21D413A84A, 0x0BAAF350BEC27, 0x26F05F5BD5677 },
+    { 0x09FB789E313AF, 0x348999E6250AD, 0x733A16EB0755A, 0x7FA4EA2A38B61, 0x48D5B7E32F026, 0x5DB53BD8065A8, 0x757A54F73D2B7, 0x6FFA955071032, 0x5A38219078DC4, 0x28346B92EC275, 0x3100E3A18B019, 0x27A5E5C3332A9 } },
+  { { 0x38E071FE20A04, 0x722D126396791, 0x303F355CCC733, 0x5FA30404F5E6A, 0x5B11F3AE11866, 0x3B9B40D01D4E3, 0x1D524DCF438AB, 0x487BDE75E242A, 0x5CAB2494A1E37, 0x154C72C09E535, 0x5CB218C666E5D, 0x2A7A853D80205 },
+    { 0x2D4C349DA9E1F, 0x77FC07AFE9B19, 0x79E36F3099752, 0x767E42ED3CC82, 0x06493CC6859E8, 0x2489777A31BA3, 0x022739F758C01, 0x6E50AE34969F7, 0x08F36B2AF51AA, 0x10A3E7451723A, 0x5DFFF541F961B, 0x1E390DBA1FA2D },
+    { 0x535CB0ECA87CC, 0x72E745FBAD4DD, 0x0C94B043013C6, 0x7E389397C7098, 0x25FB1E7FBDFEE, 0x0C8C1666B6992, 0x6895689C74F3B, 0x6B4FCD2449E80, 0x1EB80FE5EAE83, 0x7FE6D5C4DEEE8, 0x3E64EC4CF2220, 0x4592FBDACA9DD },
+    { 0x4F99FEA570295, 0x110B74F7A5C74, 0x366EDF59AD2D7, 0x527E9EF8B08B2, 0x47E88FD157636, 0x3D8797CC616FF, 0x4A14F3A50E8CD, 0x41587404031FA, 0x3DFF9E331D218, 0x609B037A6BA09, 0x2893303BDBC33, 0x382F69662DA6B } },
+  { { 0x474FE6BAFAF57, 0x4A573025FD60F, 0x2A8C90093AF58, 0x50038C5947A52, 0x217EBB8DA7BFA, 0x4EA43F635615E, 0x2EE4CFA9D2A66, 0x589D17F59CECB, 0x5ADB429EFF6AB, 0x66157405AA0C6, 0x40B000E5DA482, 0x423E2282F7DCC },
+    { 0x660A493830F10, 0x086C74E80C619, 0x37FB7CA956926, 0x3D302D5B1EE80, 0x6B902AE6F212A, 0x48A7878D8FF4D, 0x13B678A046302, 0x1B07448B578B6, 0x5D63B7626F4C6, 0x5A1BAD5E8F6BE, 0x138500E42A111, 0x16F87F2949556 },
+    { 0x1FEA99F50270F, 0x64D758EE93C28, 0x1E016FEB08C0D, 0x7387EE42BA500, 0x69EACD1F8A8E1, 0x4B306CE308686, 0x24E74E805B6ED, 0x6B2B74146E91A, 0x17DCCC8C3F24B, 0x192B0F8D0AAA6, 0x1FCF357D4B97B, 0x1DAAB5E40FDF6 },
+    { 0x759FF24DD1F82, 0x6AE840BC7C840, 0x09BF6761246F9, 0x34FA1A53642F7, 0x63C2FE497B776, 0x2CE324D5E9D93, 0x568CDB9176C60, 0x57B0D2AD6D1C3, 0x62C902CFA4A6E, 0x6D8C71EA2FAA1, 0x41CC5B501F868, 0x2CB56F2A76ABE } },
+  { { 0x5C3BBDA2612CF, 0x3177E72C2EF37, 0x76828F1E1CECA, 0x66E987A641016, 0x2704EAEDC4B00, 0x3FC7902E5919E, 0x3495536AC1FA3, 0x5D7A73331921C, 0x4A4281C618BF8, 0x28393634CE8ED, 0x3650F6E0D8848, 0x2E6B506959999 },
+    { 0x698E2355B19CE, 0x339DEDA18A7D9, 0x55684A856FB9E, 0x75B64DA94FED6, 0x0481277C87DB3, 0x602404F27912D, 0x161BA92B7A8FF, 0x780D082B67CDA, 0x5C6378499F241, 0x7CBA43D3FCB4D, 0x31C757B104591, 0x1919AB386B7AE },
+    { 0x7D4808E655953, 0x06A96389E057F, 0x033C530EBC3F4, 0x51C7A46F2949D, 0x0AF286D935FE6, 0x282373B42ECE2, 0x29500C363061D, 0x32713FF719DC6, 0x38EA8FDE06199, 0x5264AB808F4B9, 0x2A8D07F6C837F, 0x158F479DE2F72 },
+    { 0x22383E7828FA2, 0x2AB1E562B093D, 0x747D9CE5A7A09, 0x477B7EA33DD7C, 0x60F23ED597642, 0x424E0AFC88A64, 0x1C0AE4AE04FB8, 0x21B2DAFC4E606, 0x279BB0BF3C446, 0x0A82066E4229A, 0x4303E4BEE3260, 0x2274A507159E7 } },
+  { { 0x262B81BE72F28, 0x19FF970406B8A, 0x0063B0F3F52E3, 0x756C638698239, 0x58D304AF99877, 0x2112599CAF80E, 0x27AA57785FB1C, 0x62234A7ED072F, 0x774CCDDA463F8, 0x22767B1170CB1, 0x28249A66C6785, 0x1D369C726FCD8 },
+    { 0x27ECDCB16F1D9, 0x33DB9EAA519E6, 0x661AE7F564871, 0x0423A4B21A54D, 0x1A95D9D105E6F, 0x2B0B3352800DF, 0x1A93C49AEC2F7, 0x4BED33D6E5B52, 0x7F228C6FC4B04, 0x4DCD40ECF7663, 0x50AC6A859CF73, 0x17D133DAD2BB0 },
+    { 0x17A1753685B58, 0x093165ED35E3A, 0x23C4E35C72A21, 0x7C5B427C48618, 0x55A290CA87501, 0x113F11DD70DBF, 0x3ACCEFAE9DEB1, 0x7662CB9184A1B, 0x126C22E36CD48, 0x0A8B4B36965B3, 0x5B2A1EF7DCAF4, 0x31D1BF7521CE9 },
+    { 0x44E64C1BEB12F, 0x26C9D5F5386A6, 0x6F153942437AB, 0x604F439FF9788, 0x4CBF52273AD1C, 0x59CB57F11A2C6, 0x28A80612D6A22, 0x6501510C15F27, 0x0A93C9B79DE90, 0x44E7C287ADC78, 0x7BE1793E0F3B8, 0x33565D04AA255 } },
+  { { 0x7C3BF772CC2D7, 0x01CF9A82EAEF8, 0x3753654133AC2, 0x2C19E191CFDF8, 0x150E7D59E3BC5, 0x131EF037CAF26, 0x5457E9082622E, 0x3C5809BE8127B, 0x1CD4F3F33032E, 0x5FD6639345C6F, 0x13901776DE7E0, 0x2FD14220F7D5D },
+    { 0x20DFD8E530E9A, 0x4139942509637, 0x330D02938587C, 0x7BB59DEC930E2, 0x63639FA1D4EE3, 0x6CF22FED10B56, 0x41904A49D405F, 0x1F6C4C2AD6249, 0x016D02A927C5B, 0x07BCBC89C3AC3, 0x61B151FABCBD5, 0x0D766941475C3 },
+    { 0x7BCDC706C8D47, 0x08A0CFDB330CE, 0x5204FC292EC0C, 0x16536087BBAEA, 0x1807C7F143F7F, 0x501FBA40BB454, 0x2301E49D97101, 0x4052F8CF018F1, 0x3BBF995A4B88E, 0x37DCF12364DF5, 0x28E7725B6A12E, 0x3DAB85B7B2AD5 },
+    { 0x4707AF27BDCDC, 0x6AB8250CD4DF5, 0x1170F812C993A, 0x560B3F3E1B395, 0x6F96B8D9AAAC9, 0x22AA4B0BF32CC, 0x577293E6286B9, 0x11C585052ED16, 0x2FC3FC9C5AEEA, 0x1ED86EBF637A9, 0x56CC2275914AC, 0x278029B3E7E44 } },
+  { { 0x4AD40B71058D2, 0x455D5555B44A6, 0x63304A8534DE6, 0x5C1F3EF85F2B9, 0x16AFF4C659E3E, 0x6B01FA7066F30, 0x73F19946F834A, 0x20EE6AE842891, 0x74B766482B93B, 0x643845657C1F7, 0x40F204F4F57E0, 0x45954954EAD2B },
+    { 0x0835FA36DCD37, 0x2E152A357426A, 0x1FD7AED232C53, 0x0764539E0C081, 0x6257193C28205, 0x21418262BCCCA, 0x1FB75906BBA36, 0x07A936B8A8361, 0x03260C3E7B9F8, 0x39DBFBB8E6D0C, 0x259F278D32310, 0x11D35724161F2 },
+    { 0x1D143B0D4B78E, 0x5B6E6E5BB2F6F, 0x5977650B30096, 0x178B41E7F9DA1, 0x1A7BE92806914, 0x14FE5FEA12FC2, 0x337D45195D357, 0x0662D12F7FE69, 0x5B5173269B0C1, 0x03C9CA0216180, 0x55E11F0ED0D38, 0x1E070A3626976 },
+    { 0x5F97A062E309F, 0x340D7D9E2601D, 0x6D75278222772, 0x13C6D6FAE4598, 0x66A18892128C5, 0x0AB291FD1C53A, 0x795C870565CD3, 0x1024DCDB8D9FC, 0x24F025232B6AA, 0x3252F0F305F03, 0x703CD759626B8, 0x2C8CCA78F0D37 } },
+  { { 0x44031631C8261, 0x71E8C1D1C21D0, 0x19B72536409C5, 0x336478630C029, 0x5A8BB62548B67, 0x5AEE0BA70E7F4, 0x2E06441EAF4EA, 0x27FD6EAED8F49, 0x00FD1DC7A43CF, 0x7BBEDD39576AC, 0x74D76AED936A6, 0x3BC5F18D9908E },
+    { 0x13F2DEBE813E2, 0x299B6A6524BBD, 0x5FCCA05A34F77, 0x090720989EEA3, 0x6E14B327A01F1, 0x014C9DF64ABBE, 0x467A5267D739A, 0x11CD93CC0C607, 0x1A39759EF066F, 0x5D2702CD5FBDB, 0x106D3A377D962, 0x1DBA288856725 },
+    { 0x1B03E53DB3045, 0x75334B5FBE036, 0x23F696C914D77, 0x6274EF4C3F16C, 0x57B4268091E6D, 0x013B5D1F9B96A, 0x11E99A23C2C34, 0x20FE2945CD83B, 0x7ADEBDECE0900, 0x7D8A403A4BF46, 0x5BD6AFEE34903, 0x3803620C3C7E3 },
+    { 0x099ED1241ED44, 0x1627D874F258A, 0x605CB58B3DD7B, 0x40D55C510505F, 0x6FCB05C5B1210, 0x4A8C7319B6BFF, 0x61FDB38C8403F, 0x558A061343893, 0x6CBF2354BBE39, 0x461700356AF21, 0x7487FF205F05A, 0x1BC0DDA6FC89B } },
+  { { 0x2075F5D82CB8F, 0x72294C5804ACF, 0x090BCBE3E1139, 0x6D37AC2566C84, 0x5698A5B744E37, 0x0542C5080BFB9, 0x54162B40349B4, 0x22DA956FF997A, 0x67A2BCCEFA582, 0x3D647CD8B4FB7, 0x6FF8C78FFBF71, 0x1A8337DA67ACA },
+    { 0x616E762A017F2, 0x1488953E45B00, 0x5C826C7EC4001, 0x0F126EB491A38, 0x26344D8E5449E, 0x211D58233E8C3, 0x74DAE677BE82C, 0x03C18E0090D63, 0x515A0C30ADE09, 0x769592212CC03, 0x008A3843F0C7B, 0x18DAA577BDEE8 },
+    { 0x7335AAA4191CF, 0x0E301F531F1CC, 0x3DDB1627A1931, 0x575D11386481D, 0x3783B411DC58E, 0x0C88C01D98F76, 0x26B5B20DA0D16, 0x6D85CA2999070, 0x34589C786B940, 0x0EA6FFD332462, 0x5F3EAA531D833, 0x30B04D871860E },
+    { 0x0E38FC29DCF4C, 0x6ABFA924ECB4D, 0x7C9AFC2782585, 0x7D2E6DA0A8ADD, 0x2EAA97B6856DD, 0x36F3723662516, 0x3F157A18F22C7, 0x214E65CA54D9F, 0x49EC1FAFFCC73, 0x2E7200BDA2AFC, 0x3963963C39CB2, 0x27CF76148BEFB } },
+  { { 0x518443B3230C8, 0x5D8BC198A956D, 0x49A8F9EED558E, 0x30545A7058EE2, 0x2FE56F83FF7F4, 0x05CDBC89CA011, 0x31DD7F1C49B7B, 0x35100EF22E676, 0x122F11176FE4D, 0x5CCF3A73ECC5E, 0x0FC5BEACE272F, 0x2E61CC9BECCDB },
+    { 0x7964BC95A292C, 0x005A2BBF61A84, 0x5207E68AB4C2B, 0x608683099F498, 0x387A6C9525F4D, 0x0BCAEA5BF3FF2, 0x028C700EDE855, 0x69D0553248517, 0x0AD7899AB4C30, 0x0C913B1C155C0, 0x219264558C47D, 0x0A21268D56502 },
+    { 0x01F6061587CEA, 0x6516168F5EAEE, 0x416FDF055C73B, 0x150E784451B88, 0x3E4A213974FB4, 0x25D1D814B3DBB, 0x045EEA0405288, 0x5E89DF6FDEA98, 0x3B84339CCB0FC, 0x4371B3692EF30, 0x19A88D66A5134, 0x1C9018EC1252A },
+    { 0x4F437D0F2CA22, 0x7CCA87FDA28D0, 0x262AB0F7E612C, 0x5D74D2BA132B7, 0x6934499790A66, 0x1DB0D88EC4AE2, 0x25FD58E5CA3CE, 0x6030F793A58EA, 0x61426AC1FDE5B, 0x15C552560EF58, 0x2B1FE91EF1868, 0x24EA93A494F8F } },
+  { { 0x2828409498927, 0x34FC34D859750, 0x77C6E9249188E, 0x2A1821763BD44, 0x091CAF2B20B8D, 0x70756D9B5A62D, 0x50579F4F43B6E, 0x01A4C05002F69, 0x3B9535639ECEA, 0x7C48DEA126798, 0x6093391ED5743, 0x3AC9C93E1808E },
+    { 0x6535E8DF05505, 0x66BA60283AC28, 0x4F165D9CCBD44, 0x2B28BB9BD3BC0, 0x748DF19587444, 0x511690A27E3B4, 0x6E10F2D6189EB, 0x30F0B8E745C7A, 0x22EC3E424C624, 0x261EF9FFE3C59, 0x28B421D26AA9F, 0x157CE1682C1BD },
+    { 0x4BB7EE1E7FE89, 0x4B5038AF70E78, 0x08A64673191A1, 0x5D3BCF8CFD6F4, 0x36FA076A57B78, 0x7BB9FCA8D6AC0, 0x3490D17283BC2, 0x67CE75057C7D9, 0x76FA167B2CC99, 0x6EAD94B7B1FA9, 0x5A3C6B500CA6C, 0x182E2C7EC6496 },
+    { 0x6454B390BA229, 0x0866A492B3609, 0x53536FD08BA98, 0x2827590748562, 0x5A55E2B380D3F, 0x015A0EED8B95D, 0x49E3B71A03564, 0x779356C2A1008, 0x05BDF70B45A9F, 0x23842C4790E5B, 0x75EBD0E4A4C00, 0x39A2601C1BD9E } },
+  { { 0x2C6F891ED7FAA, 0x112BB3B89175B, 0x214474361385F, 0x562C9F76FC16F, 0x00FF26D9D5946, 0x58250EE57F14F, 0x18B7BC6933584, 0x6988F9D3B1EFC, 0x7A0F7B0F64650, 0x05A63C6683BA2, 0x11E900AF852B8, 0x206C2B6D86E02 },
+    { 0x045DD1F665B7A, 0x2AC2A9D5D13D2, 0x5AFECE1F3D582, 0x3C918A50A06D7, 0x330B9686EA594, 0x5FA4D64DD3C28, 0x4EBCD375B9BDD, 0x22D6345E6D5B9, 0x772DFAB19E964, 0x7529C44693D99, 0x7BA4B1ADEB141, 0x10954C5E364A1 },
+    { 0x04EAB6441BAD8, 0x4525B486FB3D3, 0x5B97BCE8B538C, 0x5EA95A772BCC2, 0x2F12C803F6132, 0x603BB685A60B3, 0x0E77661805E71, 0x3E78936C62FC3, 0x7FC302B86B132, 0x7080917ABB0E8, 0x0DE7357F41A74, 0x246EFDF7108A1 },
+    { 0x501D9FF17DB08, 0x212772D34799F, 0x7626329820074, 0x3FFBEB4B9FE99, 0x25356AEF7E77B, 0x5F019E718BBD3, 0x758314531D330, 0x530710101B5EA, 0x6262D1F1F4081, 0x01CF92478F606, 0x71300D731BAF7, 0x33FD656300596 } },
+  { { 0x0D755884C1213, 0x3B19BD89B46DF, 0x4020BD2B3C3FC, 0x27517282E402C, 0x42971C50B27D6, 0x718AC67F57432, 0x2A469CE7CE775, 0x7E34C89BA04D7, 0x44A44D274CC71, 0x2B123653811FF, 0x62434BA9BE8B9, 0x1E82FE7245991 },
+    { 0x44F003D60D50C, 0x1FFE08FE34B24, 0x020DD43668D21, 0x237F0B4481155, 0x04D6D517C44A9, 0x5E0456EDAE509, 0x797C13D33B5FF, 0x50B4EA7ABE005, 0x0193BED49BBD4, 0x68F1DCDB0D4A7, 0x2CD92DA029CC4, 0x16D8367F2CEF2 },
+    { 0x722FB6329208D, 0x4A46F7972B3DB, 0x21BC1E7A20D4F, 0x489FD2618CFAF, 0x4B330E633976C, 0x78C8E1D2D9587, 0x0E68D95370677, 0x36575B92077E1, 0x3EBAEE384BFC1, 0x534D5A794F96B, 0x67549BD0AFD1E, 0x2C651A888C0B2 },
+    { 0x73C3D17EDB98A, 0x1C90C3B02FD65, 0x78A31C56CDBF4, 0x05ED68532B7A3, 0x5106AB2D893C9, 0x7F3E69AD5CA96, 0x2C8A1977C78A9, 0x270D930A71108, 0x432E582A7425C, 0x0175E92A61EF0, 0x750E100E88A4E, 0x324CF6EE6218C } },
+  { { 0x50163FFD7F003, 0x638BBD2ACC07B, 0x1AD09A482E51A, 0x703215D9B5B3A, 0x7901E694BAEB4, 0x085028AF1ACEA, 0x2759B4140FBA6, 0x65423279EA879, 0x49BC65CA5B739, 0x707BA8247741C, 0x773D208FA22E5, 0x2FD793EE6F779 },
+    { 0x282F04AA6F3FE, 0x24455B4671D53, 0x369C727826717, 0x1B9B4E8391A1C, 0x7729F26BD5FAF, 0x3C36795C91DDB, 0x23AC7A9901B02, 0x6D9CD829E9A19, 0x4C2390E7AE5A2, 0x6C6C6ADE16D9F, 0x05ACCE9FC7407, 0x0A715AF90E5E0 },
+    { 0x5503844F1F3E5, 0x404A3A00BFEBF, 0x6A07C7D982983, 0x4FBF36E6F143D, 0x2A5EE5A1CB9D4, 0x07A17F5D29E05, 0x157E0EA63AB5D, 0x730CEF8DA62DC, 0x65262D3F7B81E, 0x696680E63BBF9, 0x27DB52B736B0B, 0x1F98940828ACE },
+    { 0x67180B3603588, 0x3060945E36619, 0x5D713223F4DC8, 0x6F08F520AEC43, 0x229E1F4275B29, 0x1B322AA305E0D, 0x2A5985B8F2F6D, 0x6B6D65495541A, 0x13F1959C47D9A, 0x0E58ED158F725, 0x4F64E67E02073, 0x2BE57E7759146 } },
+  { { 0x204DBAFC6F947, 0x36850ABF1DC36, 0x41F0C6904445E, 0x0AE569DE1AA8D, 0x5FF4EF3425404, 0x7ADB28E82D214, 0x16D12FBD05458, 0x74D4B7614CE09, 0x4957E251A2DDD, 0x73AC38990205C, 0x6E8F1952DFE43, 0x23B37A275C73F },
+    { 0x23763C8F330E0, 0x4B45ACE81F6A3, 0x1594F533A7CB3, 0x69185A183D31E, 0x118453A0ED06A, 0x3C2DC82C0F760, 0x1CB725E15FB7D, 0x7D9E054084B3B, 0x26AF392990D03, 0x1B5BC94A3A676, 0x0BA944E5717DB, 0x1F8918309DEB0 },
+    { 0x6F41164085B1D, 0x6B485EDC77FAE, 0x4E40908188A6B, 0x1DF4EE395EA57, 0x386BDED11278D, 0x329D4A87586A4, 0x684A5C8F6F544, 0x4E2A6FA0628C3, 0x36E2F9555C96F, 0x44A6D272691DA, 0x22CFFD8642147, 0x2389423679EAC },
+    { 0x1D52465BE48F2, 0x0B4C30AA8ED17, 0x606E6CAB5F5D8, 0x4FF67E3BC61BC, 0x68A7BE386D21D, 0x0B1CBA2C41C16, 0x3E5B7896A2846, 0x182EB81152976, 0x5986EC7B4925C, 0x4CA9B525ECC7A, 0x0D00C5FF4CBEC, 0x20FCDEB076168 } },
+  { { 0x64FED0DCFC2BB, 0x0EB17BD258613, 0x2E7FA573F9037, 0x40C89962037A5, 0x65071881E5266, 0x12BF29CF5CC17, 0x1824217DC6C0D, 0x1A2C86293ED35, 0x78E246A85F954, 0x6E7A76CC85A17, 0x666FB1CAEF4F2, 0x16FDB047CBFF1 },
+    { 0x6FF73BBE74678, 0x0B7E0A5C19D09, 0x77C74AFFFAFE2, 0x2B2FD669FE82C, 0x403CD7BAA4F2D, 0x3E374FBD3ABED, 0x53E16E4986ACF, 0x6E0606CE5D393, 0x20E697B519A92, 0x444A2A1218D95, 0x43A88CEABC19F, 0x208A9AFC0392B },
+    { 0x21606CDB61993, 0x744813BF2FAF7, 0x55A511203FC26, 0x32639001D9F5B, 0x24C30A0C5E4EE, 0x7C58C37B4E50E, 0x41AA7539B079A, 0x67DFAFCF8AE05, 0x11991098C92BB, 0x6B517351C0CEC, 0x57EED8F410F40, 0x133AA482386A9 },
+    { 0x4A31EE5C343AA, 0x2CB91F90BE9A6, 0x149AD31DEE001, 0x5496F51503456, 0x69EF999E84DA7, 0x0E3DF6BD835E8, 0x7C0A9EC6C6F6A, 0x3BCE32BCD9B83, 0x5B83DCC6C84EE, 0x7912D212753A5, 0x24F36D5DB1CC7, 0x206E9953B977A } },
+  { { 0x5743CB05B68F9, 0x3712266FFB546, 0x7625DB5580C14, 0x63F49FCB31FBE, 0x3D01203DBAFC8, 0x1D77824F048CF, 0x77009B4A68116, 0x0AEB1381B06E6, 0x755EA795F690F, 0x75AFB4EB61628, 0x4A01D5191DF65, 0x27932A45BDD60 },
+    { 0x65D50B6F6010E, 0x59C3B7710E625, 0x1FE09FF8263B8, 0x427558FCDB434, 0x2318AAA66E2FE, 0x389B5CCE46E3D, 0x20252F1EFE2F8, 0x0A0C815CC1BB2, 0x1F45E6DB0428C, 0x4229D463EB672, 0x5FB6601EFE38C, 0x16D354462CC98 },
+    { 0x202D5E9EB1097, 0x620131878AB5C, 0x2B06E9E93D261, 0x175397BBFF839, 0x50426282097FA, 0x24C19940011A6, 0x2ABCCC1002A56, 0x70C94ACF03B56, 0x6ACA1AD44BBE1, 0x1D4762DF2F388, 0x04637CD0D4B71, 0x2F38CF90622F6 },
+    { 0x002A2CC960376, 0x276295591A567, 0x7BE72CAFB457E, 0x2F2EDB40D1650, 0x538A64605E637, 0x229A2BACA48B6, 0x7D80BDCFD848F, 0x4E1BEFAF9B5E4, 0x3203F373F6109, 0x18D3D2E815E7E, 0x3D6054056135D, 0x1673B6534A588 } },
+  { { 0x18D3D95FB9391, 0x449125D6983E9, 0x64936EE2FEEA5, 0x6E2DF6229E2FB, 0x388BD9F83C895, 0x76D885B367DAE, 0x6AE639CDD4C56, 0x7D8076B7EB80B, 0x38A233F7D0455, 0x7B991E0FB04F9, 0x24FF7841D289B, 0x1E071A1FB597D },
+    { 0x43F03119CF9B7, 0x4672A6EE50849, 0x508BD51257806, 0x33B1F3D097AB5, 0x49F0868172DDC, 0x7C86CD177FF69, 0x74BA6F356D078, 0x4C196CFB8386A, 0x6E914EAC75542, 0x20A971DF083E5, 0x73C7BCEA08009, 0x2608EA0EC32B6 },
+    { 0x7787C3FD05D49, 0x419FA8C29EEEB, 0x28E8D99C3C9A5, 0x58DBF7E9042CE, 0x7D48CE789FBA8, 0x2AA4FA052A2DD, 0x70E98C9B51E24, 0x3A43F2C636466, 0x34A366CC36C2D, 0x1246B411A6D1E, 0x3ABA838D93DF9, 0x1D68ABF6D39EC },
+    { 0x216F6467738D7, 0x54FD4EDAD1BD8, 0x56AFFFB6897C5, 0x5BBA885E5F606, 0x7B7B221D8E206, 0x599045A415E29, 0x2135B7E470EA4, 0x01C29F3F317CC, 0x1E4EB8EA62DE4, 0x1645943BEFC31, 0x5C694EEA24125, 0x2955DF5F90D91 } },
+  { { 0x699A5BA583186, 0x44981C7DBC2A3, 0x532AB8E148FFE, 0x776476B2D704D, 0x66C4E199E4E78, 0x03EE555C8323A, 0x6E510EF0F26C7, 0x03B68B8A55F75, 0x02ADA7CD26355, 0x70D1BCFEA7803, 0x5793D6910F20D, 0x3F16671368336 },
+    { 0x03A960697B97A, 0x443F6DCC0C505, 0x332D3F02F1EE7, 0x04FDB9253739D, 0x773F6CF917FC7, 0x1C27A88E14C7A, 0x67F5CA683BA5B, 0x1B34EF664D393, 0x03144F2A0334A, 0x655B8719234D1, 0x3298C997B2EA9, 0x109D061A6FF94 },
+    { 0x7FD35B5B42604, 0x1A9650545BB11, 0x33E727CF437A5, 0x7FBF955A7AC3C, 0x7005D4BCD1E27, 0x66D93634F6FE3, 0x1831EBF22C8BA, 0x5591F20D0F23E, 0x1F17FBA11B6AA, 0x1724E4EFCCB17, 0x4111B72723829, 0x3066E8A27F4CD },
+    { 0x0E6255DAA3EE4, 0x7089BF183867C, 0x21CB2656AB2D2, 0x2240DC0281B33, 0x4E51CF19C25AB, 0x4B19178210111, 0x2C5EC089D6F4F, 0x6DD254E1FCEA3, 0x7624FE8118553, 0x11AFA8228B9E9, 0x1C3F1CD7E8796, 0x1F27FFDAAD513 } },
+  { { 0x4EBD47BCC0AEC, 0x19B537EAFE864, 0x1E0E6A836A8E7, 0x19ABE8CC609B4, 0x440641200E970, 0x71DCCD3BF946C, 0x075620AB17F39, 0x79FB0047356C7, 0x6EE11B2F1C5C5, 0x7CE08BF73ED7A, 0x160EE76238D3A, 0x2440F470CE1CF },
+    { 0x3BE9A555001A7, 0x2E783330A152C, 0x14C0BC66D1D86, 0x5C0493BC23CCE, 0x70C226DA4A849, 0x0153FEBBA0AFA, 0x46BE886A46D82, 0x0A1CCC20537D7, 0x5E7E95B4B1F33, 0x06F1CF895F2C7, 0x327E2E312C468, 0x1E2EC57EEEB3E },
+    { 0x6A30D587ACABC, 0x622150238EEB8, 0x7055222F6B5C3, 0x00418BD37ED2B, 0x4D2CF9BDE14F9, 0x609C9F033E2DE, 0x6B2F7E0251DAF, 0x6AA55B6D360AD, 0x6014D15176463, 0x74E1D18F24F45, 0x0ADA0200F8A7F, 0x09B80D5C728C3 },
+    { 0x1A6F8174A0C21, 0x409F70404600D, 0x6310D1DBFD301, 0x21DB294375F62, 0x55CA1AAA08A79, 0x17C747C25AB61, 0x40CD87865BD7C, 0x71886E4EDB440, 0x26FBF6988DD0A, 0x2A1C10065DA0A, 0x6C1D40FB5E7A9, 0x1967E8784B142 } },
+  { { 0x639D3BAB37418, 0x51B5DA81CE2FB, 0x5E716922C4FF6, 0x7C9E346FBDECE, 0x00B3A83D3AF09, 0x6816C5163871E, 0x6116548615288, 0x2063CB4A2875C, 0x108AEC90F8A5C, 0x650EFDB3D6E45, 0x489889820B63B, 0x2DC6DB5B8EAE4 },
+    { 0x7CBF8D0D6C228, 0x4CC3BE10BB2C4, 0x6D075D5CF5C64, 0x2AF85F9DC396A, 0x2F77AF7E2CA54, 0x6AA98F6EBF821, 0x4D67753CAB274, 0x6F6F4EACF3C49, 0x43B1F21248134, 0x1C6CA5BD6F61C, 0x6C95BAB87A3BD, 0x1E8D5D94CA9EB },
+    { 0x063D26D3B04F0, 0x27A67BB440844, 0x64F47F40FB305, 0x291589703365A, 0x76BB0DD0A2758, 0x6422E74032652, 0x224108FCBE4E7, 0x3601EC32495BA, 0x61D6B6A38AB11, 0x48E8696A94643, 0x35941D6D95771, 0x2A3B3AC2E181D },
+    { 0x4AE19065CC85C, 0x21FF0F6E68258, 0x649A4AA47B7EE, 0x64BD190C0E8C0, 0x105347D410CCA, 0x30EF04EEE039F, 0x25B45A116041E, 0x0A629F5491FE9, 0x4379125494297, 0x790891EF112F3, 0x75A2986689D07, 0x31B99E8F30CFC } },
+  { { 0x336405F45C23C, 0x544585D873A5B, 0x54F6147370C4E, 0x385DE6C81F915, 0x416FFFDCF28F8, 0x403FD8BBC6A00, 0x39AC4AF3B521F, 0x57FF9412FF5FD, 0x0776FE24464BE, 0x32E74011FA3C3, 0x1F6A1C3A1B86F, 0x161F7944AF2F6 },
+    { 0x379A487D5E299, 0x4BE1896188DA3, 0x4D10B5D26B7DA, 0x0A990277F0F7E, 0x35D9C4422A14E, 0x0EFDA92F8A299, 0x3F24071DA5578, 0x6D942E1457142, 0x1B02D555CD121, 0x564F7222767C8, 0x758E2C902F0D6, 0x1BF03CF82ADB5 },
+    { 0x1783D605C2F4E, 0x5CFC553B733D0, 0x4CFCC58C95492, 0x02204ED18EFE4, 0x0A366CB33F464, 0x5300DA479E8E6, 0x24DBAAF694745, 0x25C29BE5C2E8E, 0x0A9208D107B71, 0x4128EA8E96C38, 0x6BE3BA8AAF53A, 0x1BBE731BD70AE },
+    { 0x7128A0723CEA3, 0x0B2CFC91F3115, 0x0A84CCDA3FB65, 0x24FA929E09A4B, 0x0F8D4208E5936, 0x30E9E0AF3ADCD, 0x6B7713A167D33, 0x46ECD02EE45E3, 0x074AE5A03956F, 0x24ECC4E45A1E5, 0x442C2908E77C5, 0x318B09FD82E9B } },
+  { { 0x5A26947BC1C6F, 0x554396E65218F, 0x29FC125F72956, 0x3520630066D59, 0x470E400F09D52, 0x23F185A1953CA, 0x2EE02333E020A, 0x57CA130EC08A2, 0x34F87DAEC397A, 0x62FDAFA8F3AAE, 0x0E61063602EA2, 0x1DC179FFA4A0B },
+    { 0x71BE4E2437D83, 0x1F5CECAA8F335, 0x704BB523643F6, 0x16095C7AF9F61, 0x497E1DE28CCD2, 0x47231C9C0C79A, 0x3C987E497B39B, 0x074A5265FDA23, 0x03E09E2D28FDE, 0x12ECF2E04B6EB, 0x2381AACEAD49C, 0x103643DB045FA },
+    { 0x2D9325D81A855, 0x55339A15DBA9C, 0x3A8EBB3286C6D, 0x3E903DE74F4E5, 0x7B3CA0F5F1D0D, 0x3FF5E52005BE6, 0x1EC695478F119, 0x1C4EFB66F43F9, 0x1D1626D518C90, 0x6CB694C61D2D2, 0x4ABDF19E665F7, 0x3A7B51F92F6F3 },
+    { 0x4838FB954816B, 0x7D1348620436C, 0x5FBC2306212EF, 0x539A3811B442F, 0x221A9CA44EF70, 0x615EB9977C025, 0x5F8B9C781DF0B, 0x304092EA52009, 0x45D429E3DB8E9, 0x0333604F7A850, 0x36359C28871F6, 0x1BB33942966CB } },
+  { { 0x2A8D42EE422D2, 0x07E776E6280F3, 0x7AA0C78E6261E, 0x0571BAE628930, 0x087A745B5DF4F, 0x1B0B303590DB6, 0x3014EF99FD303, 0x158748DEC546E, 0x52938D5114505, 0x53CB9AEC4BB54, 0x38D7540B35AD2, 0x30EA4B838B41D },
+    { 0x6F5E7923E217F, 0x0DEEB871C5362, 0x31D18C9225E1E, 0x340C135B31AAC, 0x63AE4BF7EC67B, 0x19DF47F0ABEC5, 0x468DC62BE5753, 0x327DA8EF2782E, 0x75E6286B7868F, 0x2D96BEF4F6554, 0x67FA7E8397E1D, 0x251E21141BF41 },
+    { 0x409D4101E666E, 0x41932BF1F4466, 0x25C182DD717E6, 0x1C05CEDB2F86F, 0x6D242BA300CFA, 0x33256FDB70905, 0x7B194E4EDD34C, 0x25C114F0B18C2, 0x274A07AE27BF9, 0x6D84EE71B4B4C, 0x0E0EED887AA0B, 0x39C4283673745 },
+    { 0x3472DA02E30EB, 0x778C8DE4339DF, 0x7116A6123FDC4, 0x269A1B2797AA9, 0x493793CBB0D10, 0x4EBB0F309A4A7, 0x7B8E5902A0D4C, 0x08DD086422FBB, 0x04911927A1926, 0x12B184DD02D49, 0x7506375C1FD85, 0x29397D9AC1E77 } },
+  { { 0x0F945A58051A4, 0x253CB5DBF5E43, 0x5B3E0519C9A70, 0x6D7F5FEAD869A, 0x4B20D3EED964B, 0x38573564367F9, 0x76F97533DA2BE, 0x059207FCC08B6, 0x24F9FD0301946, 0x47399F3B7C66B, 0x788DEDB53A766, 0x2D2F62ACFDC20 },
+    { 0x0F3C187B83E7B, 0x5BFF6F512109F, 0x674B82EF1BA31, 0x4F5EB99DAD8E5, 0x4F5D864B051F0, 0x63B88EF4C3AFE, 0x1F831359D48EC, 0x4A53B10083736, 0x557650BD5903D, 0x648ACE7FCCF51, 0x177F455E7A9D7, 0x2853438E0712B },
+    { 0x60CDBD0C4AB52, 0x16993DD8D7FFE, 0x5019982FBAE55, 0x13C512AA2A418, 0x77516E1B4D1F8, 0x1AA7EC175D2D5, 0x6C2E31CAD2626, 0x0BF28B3269BA4, 0x63F6AF3170E0B, 0x316E5C69BA6B1, 0x3B88379CFC9EA, 0x212B20DE968C8 },
+    { 0x2238E8C439E5F, 0x667FE40E28FCA, 0x33D6A873EF046, 0x6CBA8C0022296, 0x3614E1B109C4C, 0x31C8735546528, 0x169FDCAF2BC2B, 0x52C59F3D1073F, 0x00018A0EA20CA, 0x782F76EAE1E58, 0x712CF060AB737, 0x27047AEC4BEED } },
+  { { 0x04C6B7A8E15A7, 0x65567D785F8A5, 0x0ABB8E0EAAB69, 0x228C68A12F79F, 0x2A06E319166BF, 0x46B42FCE5BA3F, 0x4F5DEA8C6B803, 0x7DBEC3386F54E, 0x10F80F5A6A1C9, 0x256634EFBB427, 0x1CEEA12E26E4C, 0x28B8D27EDFF0E },
+    { 0x6171D7CB4099D, 0x473212254D1FD, 0x0147681F4875D, 0x7F956D927A6C3, 0x27200441BB54E, 0x2C3964AA2C064, 0x73B0636446063, 0x48FC2E8D585F7, 0x22B0E533312EC, 0x2EBD895FDE741, 0x4A9CAC262DCFF, 0x1B1C3BC4CF12C },
+    { 0x4ED1F05677FB7, 0x404A9EB880A4F, 0x2C9E3D1881AD5, 0x6F9FABBB89833, 0x1BB51D14A6DE6, 0x6B1D45A786D46, 0x2C01EE0C8E331, 0x507FEA403F1B4, 0x66E4249291544, 0x02264E31FA87E, 0x195B0632C3556, 0x4874F8EBACDBF },
+    { 0x0A39BB536FDFB, 0x5787C6BF821F6, 0x46C2544806849, 0x1399677B2BCCD, 0x132C183611390, 0x663A96E4F6B0D, 0x2BC02D71977AE, 0x1FBAE6D9A8003, 0x4C12CD28589EC, 0x08AE2DA8B4696, 0x5581B45B72705, 0x282692B51E6B9 } },
+  { { 0x68EEC905760E6, 0x42B7D62FBFCE8, 0x42A89D5806BB3, 0x57DC070B74A51, 0x0556E46771B0A, 0x5750EB15D8971, 0x07986B4EA6A13, 0x1A8301EBE0875, 0x1F2BF01C4B8AA, 0x7241D7C0F6897, 0x1FFC56613A128, 0x2AA76DCE40FCD },
+    { 0x5FAC82B900150, 0x38076854146EB, 0x2029D55E1F3E0, 0x1F252BA39BF5E, 0x5B36E85C083BA, 0x7AE947D7E0160, 0x3C0EC79251832, 0x4F2A032F4D3C8, 0x110B6F733E0F8, 0x2C0B1B36C1717, 0x359A2841B9A88, 0x150F0078EEFE2 },
+    { 0x50ECB37C60802, 0x07B14919EBAA7, 0x32A866A5A6B9D, 0x75285E8D16B01, 0x19817EF6E9398, 0x204609694A65A, 0x5DA129383FE20, 0x34C34AD379343, 0x45121CF6A861C, 0x606064E29B188, 0x1DC77623B48B7, 0x3E8350C7CD922 },
+    { 0x17E0DFC4F973C, 0x1A4A4D498ACCE, 0x65ECD560A81D1, 0x136E4CA412F6B, 0x4C264CDAB8A7C, 0x183B78FD30474, 0x1098AF48DF9B6, 0x3FB8248814FF1, 0x67F98C8B1CF1B, 0x21BD598A7A86B, 0x71DAA6C0B8B48, 0x2F6D46B7F7BDD } },
+  { { 0x7A024EFC64F7A, 0x6F74DFFDC2251, 0x4267F863CD651, 0x25099D48584B1, 0x6744780FA487D, 0x3508C4E9547D5, 0x7EAD802AAD203, 0x65B341115A945, 0x594441333AC71, 0x369C7EE8473C7, 0x72E3E3C1BFFBC, 0x43B1971F857D5 },
+    { 0x3370595E2BD15, 0x1A0873CC824BB, 0x4E060A7246F27, 0x20EE3244E1A6F, 0x6C20B1F8F3CCA, 0x2A08F57D24D11, 0x29618E1D13E2B, 0x68B01325185A7, 0x3A02544A32FA5, 0x182435FD047AC, 0x4C9B5828234F8, 0x1F75C31DFDB05 },
+    { 0x1077B6973002E, 0x459228FC547A9, 0x4B94DDF29804F, 0x085DA47EFC499, 0x4EC68D15C1F6E, 0x47E93F5D769CB, 0x69B8C4CA36580, 0x1C5A7F5F47B12, 0x5133CF6F6DD91, 0x27A83865298CB, 0x2252B64620D64, 0x2D7DDD60BEEC3 },
+    { 0x7B0DD1ED1709B, 0x5B908E9E0E606, 0x4793D0A467D55, 0x2E09183DA3F69, 0x1EEE22F68EF04, 0x549367B15CE22, 0x69237DFBBBD49, 0x5DC5ED5BCC21B, 0x248F6646B9680, 0x1B69398212F9C, 0x58DA5A2E98F74, 0x24173C52532A0 } },
+  { { 0x5D1CAED097F44, 0x33ACA7311BC4D, 0x69CA41572C1E7, 0x48C98E6939D2C, 0x07E955ABED285, 0x05C336814D447, 0x6F17459B996B0, 0x591DAD86CA281, 0x66D56633AFBBB, 0x0F421E22AC0C9, 0x0CB7B889BCA7E, 0x26258AFCF6640 },
+    { 0x0B62F173C47E8, 0x15BACBB0994C9, 0x5331A4DAE6C7F, 0x3A2DD3B03B7F8, 0x2C0BAB01212BE, 0x0B73EC7F85E8D, 0x4A6751146A259, 0x2BBDA8AE70FF6, 0x7C38A3F3563BA, 0x5DE4C15EF8483, 0x0EE78313957B4, 0x1FE393EA59478 },
+    { 0x093A90117E18A, 0x2F04017AF7FC6, 0x4A7F33FE80AFE, 0x79210DD7A2939, 0x1BB86D51C121C, 0x714469AFCC76A, 0x7E227E08FF3C5, 0x6D92473D15E0C, 0x09C42BA8780B4, 0x2D69DC4FB5E21, 0x055907F0D23A4, 0x093C53D89100B },
+    { 0x7E2CE55AFD2D0, 0x4572A323CFE3F, 0x439A6EDDF186F, 0x69F34BFEFAAF6, 0x17903C3783225, 0x7973191D57BB4, 0x1D15BB9935322, 0x7ADC91F48C0EC, 0x7EFE6C1EC2DED, 0x59A26633B0C4F, 0x101B8A0170DFD, 0x2E1427809E5A1 } },
+  { { 0x057A665BA9F15, 0x6CBB2EC869825, 0x3AB11DD876CB0, 0x09A482E89289D, 0x4E62369271FD8, 0x5BAACE7EF2C52, 0x15DF850A796C4, 0x066603E3B65AB, 0x0452B655DD8FE, 0x01A618850EC0F, 0x124EC34895768, 0x32A6F01612561 },
+    { 0x1D4A34E95054E, 0x2DC9A2201B72F, 0x7E47380974B42, 0x2B41376C3228C, 0x6CDE9DB18D9F6, 0x0DB521E657EE4, 0x0927D076E71E1, 0x2270D92A4DF2F, 0x44E1FBBFAD658, 0x054B86BFD3168, 0x3527ED317D085, 0x1594D5E87B811 },
+    { 0x3AEB536A9DC1F, 0x73D8E2948A99F, 0x2F9DD1F430AA6, 0x7E303C4EA99D7, 0x421011F5A1A60, 0x7F3B7C47DCE69, 0x5D4735BCE621F, 0x63343B2EC54DD, 0x626185341DF1C, 0x506496B83010C, 0x1F50191B05632, 0x1DD8F89D33703 },
+    { 0x65E4C3F9BD32C, 0x09DD84A62837C, 0x6709B5C622C24, 0x692AF4DECAA7D, 0x1CCD54A20C5F0, 0x29395CE026DB0, 0x3D6657010582C, 0x5C24B31D2629B, 0x10CA4D1D425EA, 0x73893E70DB2B3, 0x7704312248A3F, 0x1EBC5F5DC670B } },
+  { { 0x6DFED32E73E92, 0x2382DB30FD002, 0x60DA775BB5D2E, 0x29D825C7B67B5, 0x31847CE2BDD25, 0x25318D40B8D82, 0x3C5583FCF4763, 0x6707CC7187444, 0x74A419A1B0888, 0x7685D81652886, 0x29D3244056CEB, 0x27B5403EC2B28 },
+    { 0x75692829D0B89, 0x0FD8ECC9608A2, 0x3A8DDC5C01B60, 0x6138199D217F6, 0x68994EE93ADB6, 0x022EBE20C7A17, 0x78B2586E4BFEF, 0x523C903170B6D, 0x08FE4C7203BFE, 0x11768FA26E245, 0x1F2E71C5646D1, 0x06E447AC9AD57 },
+    { 0x353B540A564A4, 0x547C307B016B7, 0x76BC4854A22D1, 0x5F0A018C04E7F, 0x06EB0347D4039, 0x160F639DB8D75, 0x0E2AAD9432161, 0x15691AE246690, 0x31AA9EF4F75E4, 0x3563851214876, 0x53C3B0AC4AC63, 0x1600A3F952BC0 },
+    { 0x3576E19B796D9, 0x1F3AD6CBCC59E, 0x777AC39F9953F, 0x0EC7F3D42AD86, 0x4B91EECA70636, 0x0DBDBB8E69783, 0x3305AFA03F7E6, 0x1BF6D7B1F4DC7, 0x1484C2FE46B64, 0x7847DBB230DE5, 0x236A0B1F4366F, 0x2674964EBA908 } },
+  { { 0x2D0A0E3AD03A5, 0x3474F0891C0D0, 0x60623F01EC30A, 0x09ABF14ABF24E, 0x058F936418448, 0x3F8D32CF2C7C4, 0x74FBE1F321E15, 0x33E154C771FA4, 0x2A6684C60CC14, 0x772F9474ECBDB, 0x7B9443800C519, 0x30FEA9A0235B9 },
+    { 0x3116EDEB5974D, 0x147815CE1EAC1, 0x19DE989042AE1, 0x33EEA4041B3D8, 0x2E52527D65BB0, 0x49AD505D4B574, 0x1334C10D84670, 0x49BF5B5DA7A67, 0x0EE760C0A929B, 0x67C5A1B828EF9, 0x533271F554BB5, 0x1772589B78668 },
+    { 0x3744E46602F1B, 0x13C30DAA44467, 0x6870DBB7D198A, 0x434441FC304F2, 0x29478C218686C, 0x66024B8707466, 0x7EC3E6B4EB178, 0x6B9138939B0A5, 0x0498378F8D92A, 0x4B77889079C44, 0x752881A5B661F, 0x326C62AE3FC6D },
+    { 0x412422F7D0A3D, 0x1763C6FE13F76, 0x5AC343F7F907A, 0x60C52166E0BC6, 0x5635001911281, 0x7887F1F74E27A, 0x2A850EC4AE22D, 0x6610B1A4E2B69, 0x5E8FE39EC5EC6, 0x51C87CABF91E1, 0x5669D66770BC8, 0x243E52312F6FE } },
+  { { 0x28CA39E895DD0, 0x052363679AB0E, 0x48A6037E6CD1B, 0x5427BF2F2E607, 0x1057E8F796FED, 0x0E8E90B9CABD9, 0x794D2C2CDCA43, 0x2273EE49EF523, 0x692F6F64A1004, 0x2C2FD0F2DBAED, 0x09959A6502663, 0x3FC72484246F9 },
+    { 0x5E29F34E4AE6B, 0x08FB346CDD2EC, 0x6A198B3A1ACDE, 0x298DC8B811AD7, 0x6298B64270326, 0x1AE94AA6A3854, 0x67E5B8C068E31, 0x48D123BC3BDEB, 0x6F5F3E4704B9E, 0x43FFCB51F1D45, 0x31BD78B929EB8, 0x1DFD485994D15 },
+    { 0x348290E3FB6BE, 0x70B53446E7254, 0x06A6F0FC38CDE, 0x73F5A836E8109, 0x655E90692B653, 0x238202107C79A, 0x3274AE03A8C85, 0x1ACA2D4D918E2, 0x241D075F43979, 0x36C24EE5D7847, 0x0FEBCBAAE8DD3, 0x367C0FC69B9FA },
+    { 0x13B4A0360A405, 0x1FD694EF20D1F, 0x0C28FBE9580CC, 0x7A6942C92AE49, 0x3A4921C61AFF7, 0x78052E92FAB03, 0x1F587768F7555, 0x53F9D2FC23D9A, 0x5454BEAE16088, 0x79182059854AB, 0x4DFA4E9310D9D, 0x2CFC2ED0E3FFC } },
+  { { 0x34ABD09D84522, 0x6534D0806DCF2, 0x20EA358F622CA, 0x7D45111B74107, 0x0EFBDEC5329D3, 0x4D33D635ED256, 0x44D62C1A90A2D, 0x02CF1A2A0CF8E, 0x23FDB80181654, 0x1CCAFD0E73AFB, 0x5C9B204221626, 0x4953F318B0D11 },
+    { 0x3927D2EE9593C, 0x133A57138266C, 0x4F7D6FEEC607F, 0x2947471038744, 0x4999AEBDD11C2, 0x548602F129F74, 0x6C14DA03977D8, 0x59088DE6DB454, 0x3D08BEB659DC7, 0x099DD24FBE08B, 0x2C5A0F9A9F928, 0x15FE07FF0B5FC },
+    { 0x03706586346EA, 0x3004538C44F0A, 0x62A4241046E73, 0x24A5BC2AC9E02, 0x704385CD437A7, 0x6C538255F7BE4, 0x326C1BB20EA7B, 0x6338E56FBC71E, 0x7D8AEACC97116, 0x50431A146E8D2, 0x58F036D70B579, 0x2BF7BB695909E },
+    { 0x0CB4C90E32852, 0x3DDD3A4049747, 0x69967412E7FB3, 0x781B84A940335, 0x3D680E60040AE, 0x4498022EFDDEC, 0x565AE5F2776B7, 0x192F5C307A60C, 0x16B1196404265, 0x74485E923E760, 0x6069FDD2E2542, 0x1EABDF7CF2DC8 } },
+  { { 0x6E26165690765, 0x105DB637DDFE2, 0x67688B54B414B, 0x4706006152606, 0x52AA6BEB7FA36, 0x56B0211BB60DD, 0x76D552491DC8A, 0x07548BE9D79E7, 0x25A1E4D5FCE70, 0x20910DE0A28F1, 0x2E36F10654C1B, 0x2905E563C6B9C },
+    { 0x1259E291C177D, 0x2408D324B5F14, 0x15D1A0243DF42, 0x0B655492576D2, 0x1FF0244E43B77, 0x65BC0DEA94B93, 0x45BC8B3A6D2D9, 0x12A5DC32F7064, 0x6B434B13E801B, 0x30FE65323D623, 0x30B356A57D54B, 0x124ADC4F17659 },
+    { 0x18F94B11DCE79, 0x3B584C7AE16F5, 0x0FFA51FAB5228, 0x0F27860202239, 0x01379DB24FE01, 0x6F763450EC6D5, 0x1660D1989D317, 0x2BBDE1E247EAF, 0x4B3EDC363305D, 0x21B8200E41C8A, 0x4B9F0C4A947F0, 0x1894E7FFD18FC },
+    { 0x7794710BDE79B, 0x00C8F00657693, 0x479A8C9496FC8, 0x22184C2B8A676, 0x4640D11751D8F, 0x4E8553CD63CAF, 0x752BFF7427EFB, 0x0FCDCE652A888, 0x7861C87BB4DEA, 0x5BA014440E030, 0x7ECB7D2296DBC, 0x183D50C9EA450 } },
+  { { 0x0635741AAD166, 0x21E62E262A7DA, 0x343EEFED1AF74, 0x650FD2CA883C1, 0x4C395748A351B, 0x5E7E6B8157EC0, 0x412A63E28B74F, 0x573B9D335672E, 0x7C1851B39E440, 0x1C08773E0DD86, 0x12326931D36F7, 0x26FF63721551C },
+    { 0x76763F3674132, 0x5DDB0E0EF8005, 0x6C537187A102F, 0x082A52FDFBEFF, 0x18CE5A1F21BC2, 0x7D4D932E2771F, 0x477D0E441ED31, 0x391879A35FE35, 0x2B9B716FEE70C, 0x4264D7956F29D, 0x5DB886ACEE5C8, 0x13A6FA191F807 },
+    { 0x1200B4FED5516, 0x34CA85460B289, 0x118324EC1A7AF, 0x3C9E7547331B4, 0x3B727CC5BB186, 0x0DB58DA37404D, 0x3C45CD680B7AE, 0x21AD96276AA7D, 0x7C4C74073F262, 0x0344C4B7C142B, 0x492A08786FB3E, 0x1B42C0067E0E3 },
+    { 0x2461ECB976D70, 0x1D2C9AF3AE6FC, 0x55838AD892B16, 0x63B78812623FA, 0x02F317AE4C986, 0x0637040ED85EB, 0x351860FC441C1, 0x27D7B870AE0DD, 0x1567FE36F9013, 0x2035677690A09, 0x22FD8EB0981FB, 0x221AE58849AF9 } },
+  { { 0x72537162FA61B, 0x56EEAF980BD07, 0x140D9AF568043, 0x4BD8580007DEA, 0x16F4AF2995931, 0x5BF592771D69F, 0x1D1DA3304F708, 0x1660052B209B3, 0x1D8454DADB785, 0x735824FDB9AB2, 0x031E812068F25, 0x1E9FD4D687022 },
+    { 0x5B41118C8B193, 0x650CF83997A62, 0x42640FF5A2223, 0x79D78A11A95E9, 0x7D5FEA5648F18, 0x3A6DD17EE4F22, 0x1462EC8E812DE, 0x46037705B46D4, 0x1A140DE3478B7, 0x3D43AFC63AC61, 0x7781CAF997081, 0x23C4FE76AB706 },
+    { 0x17DCB5DF02605, 0x2F8D3C56B7157, 0x0D11E10E594D5, 0x4C236D804F3EF, 0x2DCE1FC4BAFF5, 0x5EDEACAC129E5, 0x2BC06DE1FE406, 0x10005671EC6D3, 0x2EE5F5D5C65AC, 0x65D57BEF7749C, 0x6532A66BE9EDB, 0x2C556C61E647B },
+    { 0x6D75806F67B67, 0x0AA02C0233545, 0x1B7148856C146, 0x66095EFE1BBC0, 0x1BFEF7BE3FEF0, 0x2BD712960A7BE, 0x60102217D28C1, 0x518AC8BABBC24, 0x024DC046914A9, 0x6CE933184CF40, 0x0D7E62EC8BE02, 0x27A835DA0B460 } },
+  { { 0x514817F41228A, 0x04125745262C0, 0x21177543C28E7, 0x3944E5220F17F, 0x7942D0B757A28, 0x0C7034530D66E, 0x5B42EA8ACEE7A, 0x3B6218C12D3CC, 0x2C87289BD544E, 0x280221EFF9831, 0x07544F9C444BE, 0x382C8527D4BDC },
+    { 0x36FB1A5E04761, 0x79D87F3F903C8, 0x257AA6D823CEC, 0x7096CA9F749D2, 0x12C8B3CDD68F1, 0x19FFD0033E7BC, 0x5D43742AB8D86, 0x50EBE79335421, 0x0557EB363E593, 0x6655021D2F855, 0x570AB87336032, 0x2780C97B8A4E0 },
+    { 0x38AFD186C0732, 0x3AD9EB0FDAC02, 0x05787F5C216DB, 0x42B961A38E642, 0x716483D3EF6F3, 0x7BA22160D3024, 0x6F05915919FE9, 0x240C93BC6E173, 0x05E88ADB89FBE, 0x23E3C38177C73, 0x5CD7096A94EDE, 0x3B333415A9DE2 },
+    { 0x18832FF70B2B7, 0x16F5948C20048, 0x354EAFD35E5F3, 0x7A14AEBBFBD3E, 0x4F92E5419FF87, 0x183668EEAD7BD, 0x48E883CFAE4D0, 0x48C1E3A5D093A, 0x1BE91F551DA3F, 0x7A5F6F509840F, 0x661ED0339AEF7, 0x25F7A61F6FBB6 } },
+  { { 0x79B7BD45DC463, 0x7C41F18888949, 0x41A840EB3176A, 0x095BCE477E867, 0x512EDAFAAD8F0, 0x78931AB54055F, 0x3A272CC5087A6, 0x19A6678E21E30, 0x5A265093EE6BD, 0x40C59A322D6D5, 0x4A1995211330E, 0x3C358C8DA785A },
+    { 0x56673BC9E7255, 0x46C163CBFD8A3, 0x76A770AA683A9, 0x62742137335FA, 0x5C3B637C968B9, 0x4E63D9B724393, 0x05CA1F392678B, 0x7890A2EF9FB12, 0x0F9AF45EBECE6, 0x76B083CC34FCC, 0x426D8463AA5F8, 0x14EAB25228BB8 },
+    { 0x7BE42738B4591, 0x7E6D7E9A366C9, 0x5F1518581367B, 0x323E91D77826C, 0x5D5EED6071F7C, 0x18AA07F3AFDD3, 0x717AA85B18832, 0x458DC5F47FDAE, 0x17DA3C103A49C, 0x416413096B6F0, 0x0E727CFC8E3AF, 0x2251F9D8DEEE3 },
+    { 0x1A29E80A06935, 0x59EB5E59BA440, 0x28E746D349141, 0x7E7EBCBDE48F5, 0x0ABB8DDD8BA2B, 0x33D58DA5B2CB2, 0x58B36DD11E761, 0x7AE8F1041EF5F, 0x0A620AEA0F953, 0x468F2170E26A0, 0x09719E8FE783B, 0x1ABE8C830920E } },
+  { { 0x06937385E9FC3, 0x56D8D9876F77A, 0x0EA8907B31040, 0x1DB21E4D16A3E, 0x2C149E260FDE6, 0x1211543EC9326, 0x503048638E164, 0x3434ACC30E6A7, 0x06591B361DA0C, 0x68D74A5C3777C, 0x07E0615FB22DB, 0x3ED751EDF8778 },
+    { 0x4714B80D2EAD3, 0x06762229770AD, 0x294D9A631305C, 0x5C74DBEEC9588, 0x1AFD8E410C538, 0x4C6A9E2CC5520, 0x684385EBE3E77, 0x2608D01D8D245, 0x61A3097A46A92, 0x399F4D971B15A, 0x5A91DFA701070, 0x2646261AF3DB2 },
+    { 0x1F8407BACD67D, 0x2A9FE1CF571D3, 0x46C6176DC7B4F, 0x3CED3C5C002E3, 0x51DB9943B10B6, 0x4050A23428424, 0x6EB8AFEFCE667, 0x3D2446FDB60B6, 0x4BB8ADF2C31F2, 0x5C92F43441859, 0x5088117F2DC15, 0x1C3FB0F3F8016 },
+    { 0x3527635904103, 0x2BE334B873D24, 0x131B01912D995, 0x12B7F749DA578, 0x7CB1D43A79A21, 0x6B484E0A06391, 0x646F54755558C, 0x6FEC9DB8718C3, 0x2336861F90536, 0x1933A128B36EB, 0x4195D30A41EE8, 0x2317F24439684 } },
+  { { 0x2FB5AAA9F22C7, 0x5E31A88156C01, 0x3CE066C5BA561, 0x3D44176288CDF, 0x4774EDF2BBE72, 0x23A8F21C79B98, 0x08AA8E89E55F2, 0x5F3F54A681942, 0x4385B951A7130, 0x3AB4DC0CD118C, 0x663A10AE15DF0, 0x339A66E91FC4F },
+    { 0x3F68E1AE3856D, 0x1F65F73EACA70, 0x505461ECE76FD, 0x1A013581F82A1, 0x185315DAF2816, 0x2D0868D3A8886, 0x59FBACF1294BF, 0x6D84C51A9998E, 0x3BF5C680DE9D9, 0x13F26FF032B3B, 0x105EDF4DDE411, 0x18AFD681FB3DA },
+    { 0x0CD2F0CE8A29D, 0x22B6021F2B769, 0x5B478B940F80C, 0x1D2D7753A2698, 0x66BC47A18161F, 0x3CD63B40164C1, 0x537161D408ABD, 0x03923A3032B47, 0x4074E98F56D04, 0x2F37EF9BC639D, 0x4B638A5F9C082, 0x2CB1B3279294C },
+    { 0x76430B18BBEB5, 0x58F43A1C01E98, 0x4A45A659FF7D5, 0x217997E3973F7, 0x0398495DE35D0, 0x569CA6243F927, 0x632B0094F443F, 0x1B655FC3FB98E, 0x50B7807F4CCB4, 0x01F29AE7D7D29, 0x199C71EC27299, 0x1C76469E15201 } },
+  { { 0x0674EEC91B039, 0x1125BA41C67DA, 0x5306785A737C9, 0x557B18FBFDDDF, 0x28F87048C5DC2, 0x5B7DC238EBE4D, 0x3F35EF64361AB, 0x629DF628B91D1, 0x1EFB85215AD9B, 0x3BBD726C6F36B, 0x3FC6CAE99C2CB, 0x1CDB76EEBDFE7 },
+    { 0x51AB92115FBD9, 0x279A2F03122C9, 0x6426629E2B5AC, 0x418277A21F2F7, 0x4939DA4E974EE, 0x4429B524DAD1E, 0x2D561A05B0AD5, 0x27C4B4F38D21B, 0x3C630C642249C, 0x2FB59B31918AF, 0x2435E722A017A, 0x21488C9E20C19 },
+    { 0x28A0A50A1957D, 0x0D974C883A672, 0x33F8D0300E2D8, 0x49BAB1C4C9091, 0x551CA1D1DF4A4, 0x5C59CB98EA3DF, 0x5FBAF989AA327, 0x016758396AFED, 0x7804633C187FF, 0x1D535227AEF09, 0x67AD512BC729C, 0x10F94F9EDCDFB },
+    { 0x0100BDBAEDD2B, 0x4AF8281E6AB8C, 0x7BC45B025FAC9, 0x5CFD4AFE8734C, 0x134E257532131, 0x3E6245EE45EF4, 0x294241CFB5D1B, 0x68F925765D3BA, 0x2AF59C7AF3777, 0x017670AF1941E, 0x6B5278E98DA4F, 0x3222AD44EC63C } },
+  { { 0x66A39CA537C65, 0x01C6AD2302886, 0x166A4A9E91349, 0x2CB68AE3D7E6F, 0x7F408F31C351E, 0x63FAF60FD8E24, 0x4E436B36F1C90, 0x3962CF5F00D67, 0x0291E6813A8D7, 0x62339B786246E, 0x32F5EEB8FFF55, 0x3538A59CF1E17 },
+    { 0x18C4974A25073, 0x180A7E1B605BB, 0x08E9C57E9405D, 0x1042E830D9B16, 0x1574F717780BE, 0x132D2CCFAA12D, 0x3F935F4A9CB03, 0x1966B0CAFC13D, 0x3612A4324389F, 0x0BFCD30A5E046, 0x7CBD033B74730, 0x08B1C42791DAE },
+    { 0x2FC12ED65464F, 0x131600D3871B4, 0x1ABBCCB4D971D, 0x6EAE9D1BD6019, 0x530D2AE6937FE, 0x028633885EF36, 0x607FE046B8C0C, 0x0696A523C2D7D, 0x457943BD44C65, 0x7355FEFEA1940, 0x6D88C4356FF8E, 0x28322BFCF8B02 },
+    { 0x391F9643E9397, 0x3D468EE3A3642, 0x67F7C4D1808D0, 0x1EE118ACD01B5, 0x1D4A211EE1631, 0x5F871B237312C, 0x5F83F99E69639, 0x4B898E8875031, 0x2AD18F8DCBB8F, 0x162FD787496F0, 0x42F7BC6E30395, 0x29EA60F74BC1A } },
+  { { 0x05A86EC3267ED, 0x519D3A180CDB7, 0x67A570E1634E4, 0x3053DF4C91FC8, 0x742E0A0648A24, 0x6BE1F4DD18E77, 0x348CCFC17D46B, 0x362A3A66B4DAA, 0x1D6EA51588B5D, 0x59BC716744209, 0x403094EBC0E42, 0x2478A9BCEE8A0 },
+    { 0x218B7ABD161C4, 0x5E4ED14FC1E5A, 0x2927DEDD042E3, 0x2AF58A6C94470, 0x39CAAD4E9C0B7, 0x13BC90AA3F629, 0x3DADCE1BABF32, 0x32AE0AF86375F, 0x18755B7802C58, 0x70001E262AD7B, 0x23EC777E4BC31, 0x21984285CF5F6 },
+    { 0x76A3CDACEA2A7, 0x02020D5D5EB53, 0x26FCACAA6D854, 0x087326DAEF0D2, 0x1E4ED6C790DC7, 0x2C2C3761E0095, 0x4C91B34F05C70, 0x2F634BE2BF1DC, 0x56D404CD0898B, 0x1495C40C50940, 0x0B1158A1EF03E, 0x2A13F771AA922 },
+    { 0x7BB4B01A327C6, 0x5337E362E333F, 0x5E273920597F9, 0x3EDDC49B233C6, 0x43078C2C4B053, 0x4025D889F49F8, 0x0AA0589BF8CC2, 0x72F21859974AA, 0x6F2FE2B719C5B, 0x125DEE4CEA25C, 0x3B76FDF3B611A, 0x21127B0E1C632 } },
+  { { 0x2109E78FF00B2, 0x58783FBBFF76A, 0x46931D3B2ABB8, 0x1AFF4C36090E1, 0x760D9B9CFCA1B, 0x3F2690609F812, 0x2FB585FEE5105, 0x70FCA78068592, 0x09B920283D279, 0x38BEEA039770D, 0x7952C1159B6AD, 0x304811B32BC1C },
+    { 0x0C4AFC2EEA80D, 0x5F583780E41F5, 0x5571300C19F03, 0x2C1AF15A4F5D7, 0x053448E3035A8, 0x13B3B85572CD5, 0x44AD1E0187865, 0x67C3CCE600C70, 0x34EF3CDADC5F5, 0x29698C1289265, 0x415A1280B5234, 0x10111CBCCD285 },
+    { 0x3798065BB70C4, 0x150FE3BE911C9, 0x76701FDD6BCEF, 0x65E220DBD8FE6, 0x7F9128E4873B2, 0x34BDE490EB996, 0x2E40C49727099, 0x2556FCDA55E37, 0x2D253D0A510B4, 0x736E927D0639A, 0x4CE9944D11570, 0x0DF10F1F3F170 },
+    { 0x0DBB2D6CF542B, 0x4E0137B3F8224, 0x3AB03697F6967, 0x19C7A78E46AB9, 0x7F83623984915, 0x426FBAABCF39B, 0x7E6A6431A8615, 0x044D15475A0BE, 0x02533EE72CCC6, 0x03F1077EE0D28, 0x5F153F7B1A9E2, 0x317181F28723A } },
+  { { 0x170B13238FDB0, 0x1CD8994148B83, 0x7586DBF2219C3, 0x35D80C68CADB0, 0x39318AF223074, 0x512F3E62AC43F, 0x3DCCB239D60C1, 0x5CE5752C2C3FA, 0x203D527BEEBC6, 0x26D3D00B7A5A1, 0x00DA696F9794B, 0x18E560FAB4744 },
+    { 0x3D642DC8EB6CA, 0x535CB969DFCBF, 0x5E49B77397ED0, 0x36CA0FE8CA631, 0x0A8FD0C415918, 0x5C4B774E8AC8D, 0x16C0C195B9A15, 0x0B674693982DF, 0x1823E5E3733A5, 0x00A431FFB2468, 0x211A79DC4668D, 0x0F4990F5C782F },
+    { 0x5F0892EEDCDDC, 0x7E6518831D75B, 0x2B1EC8586DD94, 0x10E23575AE8FB, 0x575D21E71BF1F, 0x6A1F9BACEC060, 0x6C668E2329916, 0x5BA6950484159, 0x00B1DFFE07F7E, 0x51B3E00DDDE06, 0x7EFE42DBFF1C0, 0x31336CBFE6D47 },
+    { 0x2ED74A4DA1BFA, 0x4C9012625AAE7, 0x673DB7B99A496, 0x518497F4B9D49, 0x7B45BFB600C8C, 0x351362277BF87, 0x2198AB1548AE2, 0x18A670088F691, 0x5AE38D8A357A1, 0x67D27A4F044D6, 0x2BF13FEFD1765, 0x2E66EE939FD25 } },
+  { { 0x3E62D4B88DF0B, 0x35D1F83720DF8, 0x596E980021CFE, 0x52BF4FED96FB2, 0x02C1D4DC464BF, 0x04B788DE847A1, 0x0F4E1D326B93F, 0x375E4AD7EBF7F, 0x34ADD894777D7, 0x5072F52965F86, 0x71A00988C25B2, 0x095FBC6774044 },
+    { 0x53650E97539D0, 0x20AA52115DE32, 0x72122C4D9F61F, 0x4A1550ABF01BA, 0x51474A92531B9, 0x1FD6800DA982B, 0x11B2DE632DF5F, 0x465D474C6203A, 0x62C2278E1FC49, 0x64E35AC2E9DFC, 0x7FD500F84621C, 0x210F887CE04D3 },
+    { 0x20041F3440D25, 0x373C29A9FEDB2, 0x560F4EFA42071, 0x0A4342C3E3FE3, 0x5FE5633B6FAE7, 0x310D8AECD0854, 0x00D7138CECF23, 0x0F83A47C14E1E, 0x1E6360E2CC7BE, 0x45B1EBDE929EF, 0x13288499243F1, 0x29B7C43027F63 },
+    { 0x6D0501209E2D8, 0x1518C34347249, 0x742FC353D16F9, 0x78CD53C91CD20, 0x1FDBC983CA818, 0x3EA5CE0F7A119, 0x698820F5E2E1D, 0x0A96A47F98DAF, 0x1E18AD8B4645D, 0x00C5D1D528D01, 0x7CC6B4AE76B81, 0x2961B5C44DF25 } },
+  { { 0x401E8422235C5, 0x35927AC1CE52A, 0x0B9F1AE52B15C, 0x131A2CC7F5BF7, 0x6851B44ECF4DE, 0x02CA9C834B0F8, 0x041AE374AFDCC, 0x55E1DB96C77D9, 0x2DE1EC785DAFF, 0x780C0D8E6971D, 0x19C2ECEF68769, 0x1BDB3A703CDA7 },
+    { 0x26C85CAA37C33, 0x1E06E8EEAD8C5, 0x1EC9BF1740F1F, 0x6E9F1B3B43EA3, 0x562F14AF611A6, 0x15A107A974CA0, 0x453CCCFAB2DE1, 0x6F34680C7B613, 0x1B77CEE6E0E62, 0x0485B61B9542A, 0x2DF4479602F71, 0x160C1A83CA656 },
+    { 0x0965F9023E507, 0x5E1D1F03307AA, 0x79543533A471E, 0x5B742F39DFAC1, 0x2F01633DB7657, 0x3F59E5AA3711A, 0x222831BAB0EDD, 0x49A9CB334B278, 0x4FE2D9F576CAA, 0x422442D5F7B86, 0x5B9D05512773F, 0x321BBC8BBFA1B },
+    { 0x516683678EABB, 0x6F819B3D3B123, 0x62B9BCBD10BF8, 0x55034ACB64C80, 0x7AA480E9DD8C7, 0x2DF9C48812223, 0x57F3B7347075A, 0x1C5DD5A23EF24, 0x76287FEF3E564, 0x5F87E70B1606B, 0x2ECD17298B242, 0x38A5FC4DE1B45 } },
+  { { 0x59F60590AB385, 0x7BBDA82E57561, 0x3A79E8AEC18EC, 0x661AE3F74DAD8, 0x57D5F54F58828, 0x35C20F8D5A39C, 0x36E2C20B81DB3, 0x1A9DDA7273015, 0x67ADA6E738F5F, 0x6248BDB6C2053, 0x30E11FA50BA4C, 0x2129CA9EE193F },
+    { 0x74C099A00E1A1, 0x2C6E4DAC26226, 0x5251FD92C22ED, 0x25F4ABCD18718, 0x1C4CF2A502287, 0x082A902D5C012, 0x0FD0566AEB092, 0x177B454932F87, 0x508CAE4E37CD6, 0x3C56C7E689F62, 0x02678563DA37D, 0x1E591168F510B },
+    { 0x1392EEA41DE3B, 0x223E8029CC1EA, 0x2CE4E8EFE357E, 0x04CEB0F9C5EF7, 0x11D40CAD59DF5, 0x7DED0913D053C, 0x11B08478557C8, 0x7034464AA587E, 0x0B89FA655E67C, 0x48AA327AF63F6, 0x455A20F95ECB1, 0x3D5508C7B6E76 },
+    { 0x5ACBD7948D705, 0x78C074C60BFD4, 0x5515BF2A3CC06, 0x155C0B327D205, 0x702F823D432FE, 0x3340A1F01BA2B, 0x36F9D902BBE36, 0x05E2849D75B23, 0x3B22D36C46FAA, 0x6D4AAA37B4A87, 0x32C78FF3056A7, 0x2ABEE21105E84 } },
+  { { 0x60AB248B204B6, 0x358CF8FBEAFE9, 0x391DFA646C458, 0x396E79180856C, 0x2308BE03FA0CB, 0x24D2194684D95, 0x568D59D110691, 0x6BA9C0DA38C4A, 0x02AA3768396DC, 0x5EDB81ED95AA6, 0x6F62EA7F2EF67, 0x2BAA0A22DDC24 },
+    { 0x5A38933E40F36, 0x3A58C303A4992, 0x5B287930C8B02, 0x082DAA2B7CDD6, 0x49E1BEA71BD05, 0x457A2433A08A2, 0x363F7CFE042E8, 0x676FAE5B4C024, 0x05AE6C452C0AF, 0x60D0657B37E3A, 0x600899FF5DE3F, 0x1D0000511BEB7 },
+    { 0x456E46BDC1534, 0x1560B8EF611BC, 0x31652786F422C, 0x0A0B6EB4ECFCF, 0x0E97A7DBE3D02, 0x16B999B96D4FF, 0x0CE59C6D57A25, 0x4E64D1F5D6787, 0x73A728AFBD1C7, 0x42B8AA305B023, 0x049448C051807, 0x44471198F1F64 },
+    { 0x4100E84CFCECA, 0x6DADD41C538B2, 0x7FE64D6E002B1, 0x28D7C6C3848A6, 0x22EF3CC3A2E2F, 0x5A31B7651B283, 0x2D36DDFA3FFAE, 0x7095D04F87542, 0x352BFCF892F63, 0x20F182516AB46, 0x26DBDE8A36D99, 0x2A35D9424FAAC } },
+  { { 0x31A1C4BFCCED6, 0x1E92BDF4995E4, 0x7524986F00ADC, 0x0842E1F345E0F, 0x78F6E63230DD2, 0x0D9DC2C5B41D2, 0x59A45C5A99449, 0x6814D7633FA13, 0x578F54779B2DB, 0x34A190DC4438D, 0x7B75F4D33A823, 0x1763F6BF979CC },
+    { 0x74170BEF6695A, 0x2CA2FBE2501A7, 0x36247E671AFEF, 0x7B20C8E037B88, 0x397295BAFCA8C, 0x3E2914D61549E, 0x78BB5C77D4951, 0x41DBC6691B2E8, 0x6A33D46ED5B95, 0x3D72E6F1DC126, 0x43D143BBCCD36, 0x1D18558505DE3 },
+    { 0x37850B33679D8, 0x7C15CA0370F79, 0x1A9826332FEF2, 0x7B401664C2524, 0x640409B618532, 0x6E49BFB0FED48, 0x58E33B02B3403, 0x45F7643AB2088, 0x512E6F432EEEC, 0x651735D84B62E, 0x3089E6AF1CB29, 0x336ABDADA624D },
+    { 0x00CE3649F3D36, 0x129E4DD12DC6F, 0x7EB80B10622AE, 0x6D92C515617A7, 0x579D30BABB460, 0x4873B8655ACA6, 0x2D9DD805753ED, 0x74136787B6B2C, 0x316FA15F0F58D, 0x0A0A23F13F9C6, 0x2B631F5D14EBC, 0x2F27ADBE8FFF4 } },
+  { { 0x058314FE485B7, 0x0D0FF67F00A23, 0x6E72A1EAFC060, 0x605D6CD48911B, 0x45A0FAA480EE6, 0x7BA553A7F4E61, 0x7F6B1BC99FA31, 0x7FE5C428BE1A8, 0x22875F1C49250, 0x18F9598893E8F, 0x309002967E5D3, 0x267B64548984B },
+    { 0x3A744C42BE723, 0x03F2F5111758F, 0x225F79ECED7E8, 0x0E0114C3F9CD7, 0x2A92FBC16F248, 0x7C4E40F7E4D37, 0x75258AC51AF36, 0x5A4057678FD28, 0x75E516DCD1149, 0x03668A57DB4B4, 0x4CFFA44073666, 0x1BD95BEED76A8 },
+    { 0x10608891FB2CF, 0x59D55E1CCD5D8, 0x71EB7DAE0FC32, 0x3F3A1CA06FE39, 0x302D9C40A6792, 0x077E5DF32E49A, 0x120DE5250296B, 0x4CA6E47397C75, 0x3E9E804EFD7FE, 0x11F39057CFBC2, 0x73832777B5BA4, 0x1DBA1213A369F },
+    { 0x5EC45223CA673, 0x7EE01474EE036, 0x34C45F5B9752C, 0x389CC44E6FD55, 0x559398435941F, 0x0F671F58E6A93, 0x5F9A2D29167C5, 0x254B33354EEB8, 0x72FF77447B504, 0x7514609402B84, 0x37D280148516B, 0x2BFB43DC3AFBA } },
+  { { 0x005E9D2FDCA2D, 0x05160A8CC5768, 0x2D8008C886CD0, 0x2D229B615FE62, 0x73FD882FF9E8C, 0x55BD854EC014F, 0x3B5C8D2AB92D0, 0x2C00B7987EEF9, 0x1C85A9E1E0237, 0x7D539F2ABE977, 0x20E12E76E9414, 0x3DC49635114EF },
+    { 0x1D8445DDA72AC, 0x6F1CB44321D72, 0x7CD7DC216BF35, 0x1E69996A5B2BF, 0x37BA4A9DED701, 0x34764334903FC, 0x02E96A1BD1C14, 0x644C0A5439B52, 0x53BCB5D298936, 0x77CD87A2A01C7, 0x0A7A47BB31DE1, 0x22DFB8BE8B998 },
+    { 0x35A9A475E31E3, 0x5E4777F9BD628, 0x19C3324760619, 0x0496564BE90D3, 0x649FA290E00D8, 0x1FC9283709F0D, 0x36DB356C9ED0C, 0x5E8708151180B, 0x4BF4F1EF347C3, 0x51317D10111DD, 0x74332086FB540, 0x20E4773309172 },
+    { 0x1227CB2402D68, 0x78860ABE7879D, 0x088C1DAFB4198, 0x591BBFDE262D6, 0x4E293894AC835, 0x1FB6714DC52D4, 0x6184E538EBBB5, 0x6DCEA97696B86, 0x481A60562B530, 0x7E48F06AEB465, 0x5E677AE3EA34C, 0x2E3745AF4B754 } },
+  { { 0x7795A72BCC248, 0x3DE3DAAC87697, 0x7B2E6B538A385, 0x71FC48E4DBD96, 0x4C5FD38CD2A88, 0x58248AE54EE82, 0x4F884DA3333CC, 0x0FDDE3991FC55, 0x04A9DE9D67189, 0x1AC3C3E333B8F, 0x5334C3870F681, 0x3384896F9FE4F },
+    { 0x1DCC2F33C8A05, 0x071C029B15195, 0x2695D00A50B45, 0x44087F1EAC029, 0x46D0712C7A032, 0x4B52495CEC445, 0x5E47F67D2C06D, 0x0DD7D4266C549, 0x06E0AF4F79825, 0x1B9C23AABECBF, 0x7C42E52992115, 0x13C247B756794 },
+    { 0x58A5E8D410CC0, 0x16F429FAD33DC, 0x39B842453C028, 0x1B521A9AED546, 0x2D7A65C031CB9, 0x294F6B1647AD9, 0x1DB480236FA36, 0x36E1B2664BD81, 0x21EBA6102C841, 0x07024F3BA5367, 0x4379944FBF040, 0x4127568906C44 },
+    { 0x31B41725F9C79, 0x7F3562780A8F5, 0x744AE7CFEF254, 0x24141A9D48E01, 0x5B410D48B888B, 0x0BE53E1F21BB8, 0x1C949124AFDDD, 0x0737499F9C31D, 0x3D33F54800A7C, 0x6CABFB9D0EA0B, 0x262FAD6F1DD7D, 0x20EA961490316 } },
+  { { 0x04B56442DE9BD, 0x6D6298F066F2B, 0x3C6F804DC218C, 0x23029EC10A804, 0x4B5327E9041FA, 0x2B0FC2F819937, 0x333ADCFB87009, 0x5DF14F4882984, 0x31013EB0A53F5, 0x5A174F0E53B33, 0x1F9543C1583B8, 0x1CA11D65CA829 },
+    { 0x30287D26F91A1, 0x22D921F0F41DC, 0x05786E51AFE1D, 0x2F8D77A2F2CD3, 0x104713C6EFF5C, 0x7E1AB0215E5CE, 0x7B85CBACAA1D7, 0x51DB2EDBD8A0E, 0x3F8F681010FEC, 0x415A411935094, 0x3A6AD84CBCE68, 0x09B69504D27FD },
+    { 0x66C3DDE5124E9, 0x02537F183B749, 0x3FF372FBAB350, 0x06744F011F26D, 0x033606C4A7C2A, 0x586662EA95D2F, 0x17FBFEF2AF945, 0x3868CF44D7AC3, 0x60250A3955572, 0x17070506A01EB, 0x55A0BAA886FAD, 0x20C69D15A9FC7 },
+    { 0x3739A201D6B93, 0x429034C623401, 0x5A28A97FC20C8, 0x0B3598D03A19A, 0x1606765B047CA, 0x3385DBAC1F0AA, 0x0658C0A2ECF2B, 0x760DC5B94E6E1, 0x4C73F70B3BDF6, 0x4EEA0DC698E65, 0x36789A7F2240D, 0x2270B9F3291C6 } },
+  { { 0x60564CAB2D7F4, 0x37583A2171B19, 0x5C02B7F307D2A, 0x7BEE00959A3E6, 0x558DF3642A366, 0x1A4A943D04011, 0x4E04FFDEA33AF, 0x6670562B858BB, 0x435AC7900FFAA, 0x12E4B91DAB232, 0x63E5F048C02A7, 0x12046CA9787C3 },
+    { 0x5EE6A2D50F5D3, 0x407775A2364E0, 0x3179016B33A0E, 0x1B662146442DA, 0x63AE01754B2CC, 0x3829356916CB1, 0x30DAE7A5E2171, 0x20788B16CA9DB, 0x6C3692689EC05, 0x30FAD3A9B56F0, 0x2F38E6914181C, 0x0C10ACF3E71FC },
+    { 0x1556C020F579E, 0x72B58ACDC2A88, 0x0853D4D3A8714, 0x64B8D2833C6F1, 0x5F0D50BD38ED0, 0x0F3B821F06519, 0x2E3F78403B0A2, 0x5CF87ECD7CDAD, 0x445A4A23141BE, 0x1EAF1C9EB0D80, 0x5A0332730FBEE, 0x2F0C59B1F66B8 },
+    { 0x05CF7E8F0FCEF, 0x33A922A23B002, 0x31289213A38F0, 0x661060C1F7A78, 0x481067F419713, 0x59BB7F2463C94, 0x3989D52D0E8E9, 0x0499C1EB6F649, 0x7D2F3F0D0A7FB, 0x4F04FBAFA324B, 0x3F452F7D83A44, 0x289712FBC4D38 } },
+  { { 0x3D009DAA58087, 0x4E6AE1B8670E6, 0x7C5DDA1A0F2C8, 0x6D92F87DBD79C, 0x25DA9343C6BF3, 0x4FB88945C56B3, 0x09878A4EF1C31, 0x35D21AC9FDACA, 0x19EBEB14FD966, 0x1FBF934C132F4, 0x1781416FFE5C7, 0x2B2E0CE947794 },
+    { 0x37CB66D319E80, 0x3CC1500E4ED00, 0x5CC82A810A67C, 0x61801CAED8228, 0x7D8101068E6E7, 0x14679CEEFDCC3, 0x37035F49BF86F, 0x3F4B9B60728AA, 0x1622878EFAF44, 0x01694EE4820EC, 0x25D08929335C5, 0x1B0A61D958184 },
+    { 0x55E38C9595BE9, 0x187FE14114207, 0x69A6F0811BB47, 0x0E35BD2044965, 0x5DF129170DAA6, 0x635A4F7892DD9, 0x7CE76A19129A0, 0x741042C2C6928, 0x45A9DABBAA375, 0x21FC27131BB1D, 0x0BCC946FEDF73, 0x2ACDB67DC5FEF },
+    { 0x3F685FC91D16E, 0x1167E412D3A97, 0x2FBBA0B268522, 0x637992F870DB1, 0x40B4134F65E7C, 0x2DE6524FC1024, 0x14DBB3D7ED956, 0x4A8860A2CBE65, 0x401811690066D, 0x4A877217948A0, 0x57BACC3B029B2, 0x2AF0914994245 } },
+  { { 0x59DF1D6AD37EF, 0x3E5D914033EE1, 0x4F7337D296C28, 0x356A885DDFBCB, 0x18FE29B1D800C, 0x34A5BD653FB21, 0x7408302F158A2, 0x347633E8B06F6, 0x0957622A07A10, 0x179E0FD6074A4, 0x28190D5E8F680, 0x2199DF383DF52 },
+    { 0x0AB5E81088944, 0x559AF1396A83C, 0x27CE15908F528, 0x6D794217F6CB7, 0x0F0B99C2A44D6, 0x02E2E130FA28A, 0x7904BCE48D978, 0x007AB189A9F28, 0x3EAE1738F0204, 0x089C562B741A7, 0x4B3365EC38AB2, 0x212A6DB564418 },
+    { 0x3B3FFFFF905FF, 0x384C86E915A5A, 0x215918CFD46EA, 0x31F9207A71F23, 0x75F05D8958FE9, 0x133E26735DF0E, 0x2F528EBBC8608, 0x79C1DCDB10F61, 0x1BF3E0A11D5BF, 0x03FD6B6B369EB, 0x5F2B7BDEE2A6A, 0x3D943E0D0FC95 },
+    { 0x1E3C2CBCE96BE, 0x0A09E8A9EFA45, 0x7ADAB66EDB773, 0x230F6D3D967E4, 0x3FDA09A441213, 0x6A9B0DE440366, 0x79AEB4210DA49, 0x4408A632B6918, 0x24F2BECDBBF2E, 0x19A8E131BD5D2, 0x553652E15FA06, 0x243DC5A6C1AC6 } },
+  { { 0x4B4507E94F033, 0x3AD21E3048861, 0x514411A0073A8, 0x4C30D3B338236, 0x152CD3E6FE125, 0x258367856A2D2, 0x5D905E0C85D38, 0x6BAA80CF4D5AE, 0x6CF2E97F75860, 0x03DF5C8FAAEFC, 0x67490851B9FBC, 0x16C59A6F1EBBA },
+    { 0x4D8ADD754E41C, 0x6112F994314C9, 0x4FD0C4695009B, 0x39B5850BEB418, 0x0B39247FB3154, 0x4CE9370480EC2, 0x4AC99DADDC583, 0x02B5DE794CBC5, 0x08DF919420372, 0x0D5986D09C272, 0x5956DD1868189, 0x19102EEA8D4FE },
+    { 0x08C731E83B15B, 0x7A2A28C962B52, 0x369FAC4477780, 0x72BF9BF9D2BD4, 0x082C6C0EADE5B, 0x765B8F6087D30, 0x5ADDEC89383ED, 0x48FB908E9BBA1, 0x6A6531D225D39, 0x7301973712AE6, 0x5709DEE3EDCE2, 0x29D9B984A71D5 },
+    { 0x508A3738D28D6, 0x058E22FFDBC28, 0x1F127552C7517, 0x151D909EF77CD, 0x00142491F8356, 0x53086220D9AD3, 0x349013F61FE2E, 0x1084EDBCD19A8, 0x2B39404799CB5, 0x6014729209EB3, 0x349A78D23741C, 0x350991D29C231 } },
+  { { 0x3A692374B79BE, 0x77D20BEB65B62, 0x2376839F4507F, 0x55D7B3C8DA9C5, 0x488A6A16F4FCE, 0x72276948C694F, 0x3F62C7B3AD62F, 0x60094EB9F3755, 0x094F7C0CB3AF0, 0x7250961AD958E, 0x1C8DBEBFB5D39, 0x10CEFB9EED0C5 },
+    { 0x1A37AC3BC5B4B, 0x52F4A27B1163E, 0x7FB3333618D1B, 0x58B310CE5B045, 0x6A33A7D99CDF4, 0x6F264EF672C1C, 0x6915B00E85C0E, 0x75D016210EF51, 0x4F5E565BC88F4, 0x5967526914FFF, 0x1DF6BDC15658B, 0x1DACD24F8FB3C },
+    { 0x5DC8CC38A0EDC, 0x2732836367629, 0x5CEBE4AB961A9, 0x5E355F85A78AB, 0x63BE20F1C6620, 0x1FAFB3D8F371D, 0x279D764C57174, 0x54AC7AC475025, 0x483CB5E420BF9, 0x195FA47FF071B, 0x4B9389F23F3BC, 0x1C6664AAB3C8C },
+    { 0x7E3DB8A940C99, 0x1CC7569CDB107, 0x54E8F13948EEB, 0x0AF74DBE72700, 0x5EEFDE9099431, 0x29835FCD41B93, 0x3B8338C82B699, 0x769714BE320F5, 0x79525F7CDDB4A, 0x2FA1E588B3A2A, 0x7A1A0CCEE0F39, 0x1D9A6FF6A9BBF } },
+  { { 0x2DE6CE727CD50, 0x0C60856851B33, 0x18684FC144DF0, 0x0684BCC99E58E, 0x2967D039B7F55, 0x7400C83BB34D5, 0x0D4F77709FCC7, 0x46A21295BEA7B, 0x57C3555CEF390, 0x57691B07663A1, 0x6BA784D303D8D, 0x326596142955B },
+    { 0x15CC70059DA7C, 0x04B5CFBB69F6F, 0x2632060D7DEBC, 0x4182C0D5AD337, 0x6C0899E91B7EA, 0x6494317828212, 0x428BBAC49FA42, 0x3E72225D92CBB, 0x5EAEB5F3E53AF, 0x7B3215EFBBD0B, 0x7BA12378462C2, 0x15FB4AE786588 },
+    { 0x4B14092C8FC6A, 0x15B7A39B787ED, 0x601B6B3118B12, 0x42FFB2B88D020, 0x1A78B26E28AB3, 0x59675143470D7, 0x05B7D7D60A281, 0x1CC44EAED71FD, 0x6AC6BA0F5CD72, 0x1ADD8949A9443, 0x6BBD79AA970C8, 0x2312B5A4AB7EE },
+    { 0x44FB421ED13AE, 0x0DD415A3A2CE2, 0x20EEEBD02FDE8, 0x03B7EC5FF97B2, 0x7648AE592D8B6, 0x0B7B4D1377490, 0x6EC2D1655070F, 0x2B0F0DA0CF65D, 0x370F97BC1BC17, 0x1B3955ACB1BF4, 0x251FC9834F777, 0x23EA1BE6634AD } },
+  { { 0x0C7DA210FB1CC, 0x6541D457566CE, 0x4025F97C97BAC, 0x65B1650547C28, 0x69B2DA3AAD441, 0x55AF0EF2638A1, 0x548EF9ED58248, 0x3CBAA7074BB5B, 0x23529379C21F2, 0x6CA1308AE1747, 0x3650CAF2DF025, 0x38F4D489EBB93 },
+    { 0x77DF5925DB7ED, 0x4FF9EBBCE3C5E, 0x69790B0515D2C, 0x5818C768E48A5, 0x577DC74D3F971, 0x2FC6D5B236A3C, 0x03DF760297F59, 0x517AE244E20FA, 0x2BD93D2A636EC, 0x7D35BE1809493, 0x71F0D41A58DF4, 0x0BFC2C054E3D6 },
+    { 0x0691D63F1539A, 0x11B7752F7D40C, 0x052674C154515, 0x5AD1316DD3250, 0x24E4919DB1140, 0x727EB4B70A983, 0x6D66B463609D9, 0x2BF85CC07EBD6, 0x25DF3F5CA4464, 0x73B8D5A2600D8, 0x1DAE511044DDE, 0x2576A5D2507AC },
+    { 0x79D9A38085225, 0x7AF3FE18FE845, 0x4FFE4F6BB3475, 0x346B4D47A1003, 0x5B73FDD854034, 0x25E9E753F9CF9, 0x3D8F20344E999, 0x1652B267ACA74, 0x637F24C64E406, 0x7675C37A2DEAC, 0x12CCE7E595E58, 0x2801CF3F54038 } },
+  { { 0x757B3AED8A4EA, 0x063466654AD6C, 0x51796C9E21B0C, 0x46CD05C4E4E2B, 0x309AAD4993DA7, 0x40FC478C23FAC, 0x5B500B44ABE99, 0x6AF0D2026CF24, 0x3D5AD11C554D1, 0x318E6FEFC2E1F, 0x50C7EDF3BF4F5, 0x157147ED2F495 },
+    { 0x65E4E08044E59, 0x10CBD81F82ECD, 0x078230B1DB118, 0x75745D7C7D6C1, 0x59E0734E5CA88, 0x3B0C5357A1F34, 0x56D6C833FA4ED, 0x65B5F3E4396F1, 0x64498C4C92672, 0x7650570689976, 0x1E3710DA243A2, 0x16C507AFB000B },
+    { 0x213F084D2B3B4, 0x13A2F2EF31E8D, 0x4E02CAFCF126D, 0x21B7F691FA425, 0x01F8567E929CB, 0x62E005E7F228E, 0x154CEBFC55272, 0x2702E25EBCF63, 0x101DE81D354CF, 0x745BA3FE72AD5, 0x3BA85A3600A32, 0x2D19CC819C8FD },
+    { 0x7C8D00F7B7239, 0x4525AAAF042B3, 0x16951D72BDFE4, 0x2EFF0CE7D1E26, 0x1DEC9D8AFC488, 0x1658D5E403DBF, 0x0CE11A86FBA28, 0x13B61F632030A, 0x4CEE54C171387, 0x005ADC4C12717, 0x503EBAFE5A9BB, 0x15D73B092494F } },
+  { { 0x32554B768D572, 0x3DDC6FD9C5604, 0x076BE165230D2, 0x7D7EDA9B0D5C7, 0x798FAD23943DC, 0x42D08F9618DDB, 0x706884846FE82, 0x5A995A09DF4EB, 0x1187AC8629C5E, 0x566CA0712CBF3, 0x476FF77E499ED, 0x2F0218F95F854 },
+    { 0x1F966C9C0651E, 0x5723FAD92150A, 0x2399FC5B666F4, 0x40E238924199D, 0x734C34E2572E5, 0x2C0119F0AAE50, 0x1C0EDD8D6AA62, 0x3EFFC506FC37D, 0x3E8BDB1628011, 0x621D78245AF85, 0x3B3A2A157E970, 0x1A41F0CDC77EF },
+    { 0x3CAE61BF906DC, 0x1C357C3D7EC27, 0x31E4D753553A4, 0x5B3780A9633ED, 0x3B31A8ED73779, 0x6516A3EC54130, 0x58561544ABCC0, 0x323570F785671, 0x1A984DDF04F0E, 0x1C4AAB510C9C8, 0x3811B8D009027, 0x3D6E55CA2F2D9 },
+    { 0x22227BF5F2908, 0x7FE662AD2AC71, 0x1B3ABAD233032, 0x12F438582A943, 0x76BA97E3287B5, 0x2EB96EF7490F6, 0x72E2FD832509B, 0x3B95DEBE944E9, 0x1C363890C7C9A, 0x7F4695C889D5F, 0x679F7755FC8AB, 0x17B5B81EEC6AF } },
+  { { 0x6188A4DEAEBE2, 0x34DC896C9422D, 0x75E3423A7FFFB, 0x5910153C7554A, 0x59A9B81042445, 0x47C3B2685EEBD, 0x07E1719329D8C, 0x10BC72A36038F, 0x18ABD614E5260, 0x22FD406D26AE3, 0x780042C09DD51, 0x1C4EA4A0091FA },
+    { 0x270064E8325A1, 0x78103608E4C66, 0x42261EE85CD26, 0x39498E2885FE3, 0x2674C0DE23191, 0x634DCE57B6696, 0x1FB73183B67D5, 0x5B0975D6961B2, 0x376BBE7E9F77D, 0x10E3F991B84B3, 0x5F40879A23BC6, 0x11C68F3A24142 },
+    { 0x18B0893E59256, 0x69C8016ADCE2D, 0x07C9D01D7B144, 0x64EE196E4BEC5, 0x1DF30087E4EF4, 0x43F8EA5BCC596, 0x2EA68ACA2433C, 0x53067D9FC2B02, 0x6D37241A03C9A, 0x550BD198E7F9C, 0x4699703AB8063, 0x0DC2828BE4B28 },
+    { 0x422A701D365D5, 0x27E087B6ED243, 0x077862205ACFB, 0x4A3A2C2DE5F42, 0x1E7FC7A196941, 0x50021B814EC62, 0x47FBD3E04BB81, 0x58F1728BF9F32, 0x372F3144ED86F, 0x17CF313991643, 0x20D93EF791331, 0x316360BBBE704 } },
+  { { 0x74A8329207D5A, 0x3D0F290B78554, 0x7E81433D30CD2, 0x2FB618BFAE03C, 0x06BAC25CA943E, 0x6A9119582C7DA, 0x378F8B0258D23, 0x67F5477E24183, 0x00259D51C8942, 0x7059954F4EB27, 0x75CBE289B58CE, 0x2CCB3F26ED280 },
+    { 0x5599452AE7F83, 0x7BAC60EF6EB6F, 0x5F847E13BC2E5, 0x73A2AD15C0AED, 0x007622317E208, 0x78CF84EB5F5A8, 0x58BBDA73FEBC6, 0x02A0D8DCF6E84, 0x70612B52633F3, 0x75213855313F6, 0x623F9266CAFE5, 0x26168F5C1E8A7 },
+    { 0x63945C811CF78, 0x17B8421E047CF, 0x7A56B38808109, 0x10F1CBBAFF0F3, 0x754FA6EF2331D, 0x6F1D5690384AD, 0x374E0FBA55C5B, 0x3708CDBB14461, 0x7C0D73F9041DC, 0x61D3C835B1112, 0x56A4FF6E6BA80, 0x31E74F0C96143 },
+    { 0x18562F6FEAD91, 0x61C918E3A5333, 0x2B2F54544B670, 0x6CC959D0C207F, 0x43F50DCB7C6C1, 0x28E933AE64C20, 0x7CA2754BB2453, 0x65A357E78D737, 0x11FDE6AD83AEB, 0x4F93A084923DF, 0x41B159256CC9A, 0x23E7866F1F4B0 } },
+  { { 0x5F8AB0C9BABEB, 0x171528EA11188, 0x42651C08D9189, 0x5DEE1CC07CD70, 0x01E40529DBBFC, 0x6A38578E46F21, 0x7376EB6900687, 0x3887AB338101E, 0x036965C41848E, 0x3B81AF49EB080, 0x2A889C91EF64F, 0x321D3B4D40C88 },
+    { 0x5C3F1EB8A6CA5, 0x27C1684CE52FE, 0x63BBE1EE6B431, 0x4BC195C5EA657, 0x14B66C02AD850, 0x786ADECD74819, 0x0557E384FD2A1, 0x1B9411D07B907, 0x2805530A855AA, 0x74C1ADCD037F5, 0x23A8D631814A1, 0x0DE1DE8C32581 },
+    { 0x529263F2429AD, 0x3462838B10B87, 0x5C7B4BC95451E, 0x0D99AABC60D3C, 0x5397EB40A9FE1, 0x18777D3A6BBAC, 0x34B7E3B6E71E9, 0x29105ED6FA130, 0x4E780E887D32A, 0x68A37F92C6021, 0x583A21F07C2AD, 0x3A199AC198BB4 },
+    { 0x264FC019E7211, 0x11FB8FCAD9E00, 0x1CF97EC9376F6, 0x7C39A07F91C85, 0x65104A1EC493D, 0x3FE9E550E1629, 0x1CFB9FE148E49, 0x4A1ED831E41D2, 0x66DE28785AE54, 0x5D07386D41287, 0x0BFEB5DE7E4E2, 0x2D7BED6500DD4 } },
+  { { 0x734C660278834, 0x4D63FB302CFE4, 0x75C685F9ABE77, 0x2E75B594D0F69, 0x1BEBA58A0EF20, 0x3C1BB681F6288, 0x5DA5227EC03F3, 0x05ACA1C650A05, 0x748112CB817DC, 0x6D28112034BC8, 0x6249A9904E3D3, 0x26B1BFEA8126D },
+    { 0x347E1C12A728A, 0x0C40A867D2461, 0x6D90E9462B771, 0x6FE40FFB064DB, 0x3F7D64C9CBF05, 0x120177107074F, 0x73EDCA36FFB37, 0x6BEA58AF23E74, 0x4248E64193870, 0x1CC6BF1581711, 0x00B54A73E631C, 0x1D792AE875B87 },
+    { 0x6FEB59926ABB8, 0x60453F7DBDB95, 0x4E772FA740C1A, 0x258088E032DB3, 0x677416AFC99F4, 0x042F7AFC743F9, 0x67668C0C4E3AF, 0x71AEAE43A2D86, 0x787DF8CE81000, 0x7213DFA0EA9EB, 0x2EB86EBB507CA, 0x3FDE8F5124A73 },
+    { 0x232C0B00F9B82, 0x4521D227AF5F0, 0x67F0253A46238, 0x2B34396F9DBBE, 0x391EE796ECD55, 0x78CCDDDA427FB, 0x1CA28D59C4958, 0x44764BC313097, 0x6575FACBB1CEC, 0x550A49664876E, 0x7D52B92804B33, 0x32058E7E06717 } },
+  { { 0x462F3AA5B6B66, 0x410FEB3E4A44A, 0x33399A56C902F, 0x7659E7F6D0464, 0x505F2C3BDF629, 0x78ADE6A5BB2E2, 0x2A096EBFF8943, 0x3BFD3259645DB, 0x5898B5E955F74, 0x612C427FAC752, 0x57A66EF7772DC, 0x22E10F5597ED2 },
+    { 0x233A6AF5489C0, 0x6FA3F14DCBA11, 0x335654BB8548F, 0x2F820B0588528, 0x2C11CFF6279A7, 0x11C49786F937F, 0x1BCC8A389CD4E, 0x5733065EB5BBA, 0x320D712E53D8C, 0x3AEABD2520F6D, 0x753D78969D826, 0x124676DBE5890 },
+    { 0x43AF07364CE22, 0x61233BE445944, 0x6436B7313264A, 0x25AE698267125, 0x024B00A8A8FA0, 0x2CE7CEEF17990, 0x072988DCA0113, 0x022536EE5A913, 0x1488AECC95B08, 0x421FA1757E328, 0x4A364892A4933, 0x12CC252595012 },
+    { 0x10CB9B6FA89BE, 0x476A71923550B, 0x1574E6046E526, 0x7C428D40845EE, 0x181BB659A95EF, 0x040F559EFD302, 0x4EB6D761C38CE, 0x1ADED8E272E4D, 0x3622D16EEABA3, 0x1C947B2274AE0, 0x3F40DEAEE8639, 0x173564EA00A40 } },
+  { { 0x2EF18505B4C53, 0x0E5CAAE0C91F5, 0x6280FDDF8B361, 0x456F3F0AC9F30, 0x3410711254154, 0x2F7CD979836E9, 0x2E2E69BF81FEB, 0x72215DBFBFB0F, 0x79B2DC67FA4DF, 0x7D7830CF88E83, 0x59AA00F0F1FB8, 0x2614490B6FAB5 },
+    { 0x51225F90D0346, 0x327ABD103E9DB, 0x2D121241CB46F, 0x6FAAA3B90E5A4, 0x75C1F579E8DAA, 0x44A83FAA20854, 0x3928C13804780, 0x147A2745C9586, 0x6E299794FD2C8, 0x3D9925E6A1E39, 0x5C8E86E5E6E43, 0x0F848D6B7C127 },
+    { 0x35C8315DC03E7, 0x1BC40872F9B6A, 0x64CF414DDC084, 0x218B2BFBD446E, 0x0F6209762EA9A, 0x31BAB3B4497D2, 0x2FE84E6624DFC, 0x0D8ABD0265449, 0x4F4E80ABDA828, 0x744C6645C89D6, 0x690A9E8FA2E20, 0x0726DCF9C6424 },
+    { 0x7659310335D92, 0x491F4055867FD, 0x18D637852DBD5, 0x408AB9A84085A, 0x0F5C03352912C, 0x1E52E71706408, 0x4E727F2D6A114, 0x553828E23C666, 0x74017666C9409, 0x74A36934110A5, 0x7D3159FBF679C, 0x2316DEF2DF9B8 } },
+  { { 0x31ECAE35D7688, 0x1C403CD299076, 0x0AE9F1BB05045, 0x578EB37DAB167, 0x339E5CE7E6CBE, 0x63DC53491F525, 0x66EAD6FA40E41, 0x6CDB331AAFDA6, 0x11D91E8B9F717, 0x21EB9D448751C, 0x32C5A11459D51, 0x2E508EAB38F75 },
+    { 0x63E4D61BD47E4, 0x794993F0CF6EA, 0x3D975C8E977CB, 0x14CB24C3B4ACF, 0x471A670551268, 0x5C006D5CCCF65, 0x4C53530B65B27, 0x0818D5D2C8295, 0x2DC034D010071, 0x12B487A7A529D, 0x551CB5AA225CE, 0x20B1C83258DC9 },
+    { 0x7307CAA00BF68, 0x00D3290D5C155, 0x0498871BBE99E, 0x3E97A2C6D5858, 0x74ECF29F1257B, 0x70B7982B6CF94, 0x2A7CFAB92CE9F, 0x283ABEE4E8246, 0x401E5D6973844, 0x3F57FEB888D82, 0x745D04A778A17, 0x4335CEFD1C599 },
+    { 0x70AC8AC9DF432, 0x794F1515A279E, 0x0FFA6372C1A0E, 0x4821BF0B79ED8, 0x39F40B876157E, 0x0B2EA84544D4A, 0x5D11A9659C766, 0x55023C5793356, 0x3C90A3E994AC9, 0x1200763FD1B56, 0x3AB578FB229D4, 0x208F8E26AFB20 } },
+  { { 0x5E2407AE29CEC, 0x61A42B7A2B0E6, 0x05D28FA1FCD7C, 0x55E39F31567DD, 0x19704B878F308, 0x20177F9ADBAE9, 0x3CEE1D8130A86, 0x4F0A9CF31BC61, 0x40C82C78BE8AC, 0x430FEDDDC2F9E, 0x053A631C253A5, 0x2423E7BD68E0A },
+    { 0x0BA8F4BF14ED6, 0x3CC230176C0B2, 0x1CED1BFA8FB18, 0x2A617EE0850B8, 0x04AAE9591FB4D, 0x23AE45EB0B2AD, 0x1E23E1B546C48, 0x777AF01988CE5, 0x71AE3A7EA54E5, 0x0FEEE2D89D2E8, 0x4DBB0BBB5D4CB, 0x0FBE2CA521FFD },
+    { 0x77F7558FF7608, 0x236F32967F895, 0x3C230053B081D, 0x491DBE86095CF, 0x50370F5A3AF71, 0x336E863798B1C, 0x5E9CED7A136F7, 0x774AD1F89AFDB, 0x4462EEA6C6C7A, 0x35097A5C9BC95, 0x5E15C57E15AF9, 0x3E5173B33FC59 },
+    { 0x1FF00E885448C, 0x7D5B3AF62FA6F, 0x63F7A391DA884, 0x77669E38BD3EA, 0x0A3B3991D4CFE, 0x688CEBF3ADD07, 0x3F3039E1AB4E5, 0x0F31D69523370, 0x74758717EDDAD, 0x631B541254B63, 0x76E184BDC5371, 0x2760FAD684E44 } },
+  { { 0x152B483D1A658, 0x23FA05B3B7617, 0x682D6585FE8EE, 0x0C66F67748965, 0x262B8100777CC, 0x3E788AE18F114, 0x2987332A5D03C, 0x2E937CC2794CB, 0x745B41CF025C1, 0x43D965C5F3741, 0x3F7943B54E929, 0x24F90EDB538BF },
+    { 0x12D2E33A37142, 0x23EDB4B87220E, 0x147F2CCB06E83, 0x6778402065E29, 0x01A09F0AFEC7D, 0x09F3EC5584955, 0x04D136FB51916, 0x5DA98C5958D80, 0x085DB60B27A3F, 0x357D08C6380CF, 0x583CF190C36BE, 0x1E50144C51AAA },
+    { 0x7DF4F5B04DD06, 0x1881716AD1FF8, 0x19D2297508A32, 0x216FE40930098, 0x2B86AB8227102, 0x62A631AF75246, 0x229573072FB9B, 0x7BA811C196F9F, 0x436D843CA1C8B, 0x007481906C46D, 0x23A16E7F5983B, 0x2D1459C3DA969 },
+    { 0x59A2447A1EA1E, 0x4B4F35C91DBAF, 0x388B48A82D958, 0x6CC4294752F1A, 0x3DEBF4FDD45B0, 0x345AE0F701EA7, 0x55B4056E23B3F, 0x6BEC310236A31, 0x33995C0799E59, 0x32C95473EFAAA, 0x7A7AB8F59259F, 0x2EDE3ADEEDC9B } },
+  { { 0x5234E275D0224, 0x6141A379980E1, 0x1C2C8685C6733, 0x6E363E2077316, 0x7926E100C8107, 0x02028678B5183, 0x34FBD14CFD12B, 0x758EAAFED7D97, 0x339FBB8D5B634, 0x6E667FADAB172, 0x5A6987C59625B, 0x06AB023E849E4 },
+    { 0x4A2BE3A6760C8, 0x15EE43D6890C4, 0x331A5EF10A987, 0x197B877D9D399, 0x4CD3FC56CADEA, 0x113119E402EB4, 0x5BA1628EEFCD9, 0x5A4098E7448BD, 0x6F0697437ACCB, 0x66511570CE6CC, 0x59019735FDEDA, 0x0A9985F718F5C },
+    { 0x7E018DA98ED1E, 0x34ADFBC58F863, 0x6DFC88A54C54B, 0x19B2377500D4C, 0x4E0AFB113B3C2, 0x1CC6B5922C09F, 0x27AB787120F80, 0x7DA9E4EAA37B4, 0x748F3E228B3F1, 0x52C64632A1A42, 0x702EAABF3F629, 0x2C1C756EDB03B },
+    { 0x66779FC3A3884, 0x4BA38E4B8AAE6, 0x0D46966C8ADC4, 0x40B8F515FAF48, 0x6A491E2321B00, 0x04B067DD03529, 0x0830F643A2515, 0x7B97ACEE151E0, 0x10D1649D0856F, 0x5C51716C51900, 0x5036832952BE7, 0x2D47A49CF751E } },
+  { { 0x7EB6ABF03F5C1, 0x3F7341EEB4215, 0x645A25FC3BDB1, 0x37CDF7E61CFD5, 0x529D4F83A6401, 0x438C4D2122B50, 0x31354358E8D84, 0x6E36F507D5D8F, 0x21E307A1C6676, 0x12568952EA89D, 0x2ACF9C8BA6E57, 0x078D003F1AFDF },
+    { 0x1404A8C4BC932, 0x003ACDCFC4D06, 0x664B763680D25, 0x5A34B32E8391F, 0x2BFB2031AEA0C, 0x6EC24739A41E9, 0x1090D74F5AE3C, 0x61771EB4BEAD9, 0x63ABEC11A6CB2, 0x26C64AD658F1B, 0x001F29BED80C3, 0x1DC9EB182447C },
+    { 0x3876511406435, 0x5654D338A153A, 0x5DDAC1EFAA846, 0x5725223C3F963, 0x7077A81DD9E4E, 0x7B333CC7115FD, 0x589FCB512E675, 0x1F7B7821B1C2C, 0x3648E67C14371, 0x4D2684E898556, 0x64B04A5032DA0, 0x287017EC31172 },
+    { 0x356F77E8D3B28, 0x543165EFF59F3, 0x31B070A55E61D, 0x51FB9D2DCA218, 0x555054A1788A7, 0x499D80DE80141, 0x1C398AF5E4E19, 0x2D37E2ECCB034, 0x26559F064EACD, 0x2F0D4EBCCDCCF, 0x0963CBA2F0FAA, 0x252B9443BF87D } },
+  { { 0x75595C9CAC64A, 0x000C8C2259FA0, 0x30B3A458565B7, 0x6219FEF1D0AF0, 0x535174DA04ADE, 0x766460BBB43FD, 0x5E602D7B2B954, 0x181E5D20D410E, 0x2F32C6A9E21D7, 0x673C981F20505, 0x6B9EDDF93642A, 0x3C00BE3FCCB31 },
+    { 0x2D8B0BC216233, 0x3F236F1EBF8AA, 0x00AC2DDFFEDF9, 0x3BF1B6909E480, 0x337A7DC44D258, 0x5D4D1A721704C, 0x4E112E7C1CBE0, 0x111979CC4D9C7, 0x3AEAFF7881D71, 0x6208FD6864C39, 0x06D68305E5DA7, 0x1E240321A25ED },
+    { 0x556307B5E26C6, 0x4CC3131CEAD60, 0x5B3BA3B52225A, 0x2987CFB454E8B, 0x34E02A9EE90B2, 0x7CAF4F58C91AF, 0x01FBF29B1A800, 0x259C6791B7108, 0x68E39824B55CD, 0x20C3DEE506357, 0x06982E5ADABBA, 0x35769FCA388E3 },
+    { 0x760916A2E389B, 0x2F764CC8B9311, 0x78D38FCD80ABD, 0x5AA4C81AB9546, 0x0E57F6AA71BE9, 0x5E0B9779A8DEE, 0x197BC5D77D2DE, 0x4B102FA113E85, 0x3D71BC0A8BEE3, 0x534F7A22A3E2C, 0x2A75292A93A0F, 0x2D3744C347268 } },
+  { { 0x5D6C876E0FB1C, 0x4B51E9032BD70, 0x5B15D3A32648A, 0x55244ABB58291, 0x5F44399ACCDDC, 0x24129001FBBC5, 0x65FBAA33164C2, 0x28BB7AF3AD5B6, 0x5247EF707A24B, 0x6EC8BFA8E2FBA, 0x705B489B4016D, 0x26AC7ED40A9A0 },
+    { 0x5E91808CB8262, 0x168F969004650, 0x59AE82224511F, 0x59CCE4D85ACC0, 0x3CC25AFED1E6A, 0x60DDCBB34C9DE, 0x2E8C9A7D4F8BF, 0x3D12A29977B1E, 0x625AEC69688C8, 0x33DEA7870E0F3, 0x2C4A90DE0B79D, 0x05B54D4B54FE9 },
+    { 0x6F7BD053BADC4, 0x05D1B2038F647, 0x4C783681130B8, 0x1049FD4EECB88, 0x0C7640E28ACA5, 0x1237200C08465, 0x12D1A1B1F92E4, 0x55DFBDDECDA8C, 0x0D539F57D8ADD, 0x5381D294AE483, 0x6DFBFFFCDF3E0, 0x24AA355AF9DD4 },
+    { 0x73E8E1F873C28, 0x242E3B13F977F, 0x465B1F1D59EF5, 0x59A41C4E67659, 0x201217AE7735C, 0x49D8EB7921D60, 0x1B51A4A48643C, 0x2E7AD6BAFAF7B, 0x149D5EE7F2166, 0x53A26FB70379C, 0x1A0750E47FDB7, 0x24DD71F566F89 } },
+  { { 0x2B6FD0F2BBD9B, 0x3C9392A6E8030, 0x218350A6F7231, 0x70D5C87E359B5, 0x7FF7F60531B80, 0x532E3BFE2F6CD, 0x085E12B3E677B, 0x517EF43E0D829, 0x0F1DACF05A6F2, 0x6910ADF1DCA97, 0x65AA8AC153C7F, 0x189D5F2A52324 },
+    { 0x203063A5F50A8, 0x4C3F96D097894, 0x56CE170D1B03E, 0x72D54683F97FA, 0x1077204CA9A9F, 0x0A60ED9B9BC5B, 0x6A22D6FA313EB, 0x6867B18E223D5, 0x0CFCFED3D19DB, 0x017FAB924003A, 0x2EA049DD40F2A, 0x068C59A9622F9 },
+    { 0x18D5CC467A82D, 0x09461D49322DB, 0x24078E1292C9D, 0x3E66910D6C323, 0x2B8E3243AA969, 0x595B8CD74FD54, 0x26766E2E53F67, 0x601B01B639905, 0x5186CF8237BB0, 0x1856AB83156AF, 0x14394298C4A95, 0x343AD52FE3500 },
+    { 0x34AE8767FF568, 0x2B554EE3DFF9B, 0x72333D31323F1, 0x275E0BB00B616, 0x1562DE5F3B868, 0x5AAF5353B062A, 0x15236FEAD8E00, 0x53C94A3F08445, 0x35F445B51E1AE, 0x718B235CA006D, 0x078382A20F33C, 0x2B22EEA3FE34C } },
+  { { 0x0D1F1619A538A, 0x774A195A446F8, 0x626273713650E, 0x5ED6D7D5D31AF, 0x3D64546F8F0C2, 0x5F0C1B719167D, 0x0CBE9B72802CC, 0x5F1EE79A3EF13, 0x3ECD170DB9D7C, 0x4117495CC4DB1, 0x3A81916613340, 0x136EFB29E39DE },
+    { 0x5D8E698D195EB, 0x247F30FA461E5, 0x50111C1987E65, 0x1AFF9DFB40CE6, 0x2A5D98B5FBF63, 0x2B9C97EC8C6B8, 0x547D941829551, 0x1C1E47429C819, 0x4C4253C8B44A1, 0x7577559698EC9, 0x5B3E047F665D2, 0x26D7686611D03 },
+    { 0x27AEB0BBEE710, 0x3C5AED735C3D6, 0x631B5268D2FCB, 0x2ABF11CC1F688, 0x6BC9C63FE1EF3, 0x0E8471A33C4B9, 0x0AF62C28137B1, 0x13B93224B9709, 0x1A596A3B8A249, 0x635A4BF8E6F23, 0x63409ADDA7610, 0x256FB9D32E7CF },
+    { 0x497D599ED147F, 0x1FB94FD7F0168, 0x7A9A316591712, 0x18BA91979F088, 0x75C92770C709A, 0x189E82CF528BB, 0x065FDBF188502, 0x623DF17967976, 0x3223CD3BCA0EE, 0x77D291840C62B, 0x50E0253C90D95, 0x27B1C2ECCBB64 } },
+  { { 0x5BE644B3B34AF, 0x39DA96184C6AD, 0x090279B7F124F, 0x41AE893220F0C, 0x28F62FB50570F, 0x522B256DCEBCA, 0x6037DB605482E, 0x63E1C1EAEE283, 0x227D5418957AE, 0x0F5CE0198A479, 0x08B578DF0254B, 0x356BD9AD4C886 },
+    { 0x4652A481A9944, 0x667F1036878D8, 0x492239CA6ACE5, 0x732193FE48667, 0x6EC33C0F976C1, 0x674B7590AD020, 0x3C4C92216C260, 0x65E46F96DA34D, 0x4D9D66FEC8FFD, 0x12E0A0545E6D5, 0x424C8546006F0, 0x2273B77498360 },
+    { 0x057D7E3FC3773, 0x2F52F3B76B8C7, 0x599575A3C880A, 0x0BF9F8DEA2783, 0x508812F67FE3B, 0x575AA6171BAA6, 0x68F96B8B74F3D, 0x3F9C8DE02114D, 0x44253C92E945A, 0x434DC8D26CAA4, 0x4CAF793EE7560, 0x36DDFFA539FBC },
+    { 0x52896B54D2CAE, 0x79C30D34ADE11, 0x1C0A27C3E3B97, 0x38147D208A5BF, 0x234197CAE7019, 0x6A07F5D77B7FE, 0x75F20298FD8BB, 0x28E28E8045E77, 0x29EB73DAD1F7F, 0x6BCBD892AAE05, 0x2055E93F13FD5, 0x2D64B8980769B } },
+  { { 0x79236DA335B15, 0x54A14FAD32D84, 0x31FA6D372620B, 0x120052D10942F, 0x5BF82593E3D90, 0x743F50171A23E, 0x7AE08E41A4F4B, 0x6621BE2E71D61, 0x29E6792EC1E6C, 0x3558059D0C6EB, 0x6629D41DE1AC1, 0x16995E31A2E29 },
+    { 0x19351E2D9E7A1, 0x4BB5D5DCC8CEA, 0x4111EBF2313BC, 0x02845CA1F404C, 0x2D7E05D641664, 0x5525EADD66966, 0x59D991EB723FC, 0x58D67B524D0BA, 0x3880D8AA3E73C, 0x61A518634A5EF, 0x60272951348B4, 0x1043CCB1E4E4A },
+    { 0x1F41DCB4BA2BD, 0x3F4851D46F85E, 0x0BF0090ADF78B, 0x514BBD7F4FA36, 0x29ED0E7EF1B32, 0x31BDB79950CA6, 0x498DE8A4F5370, 0x6B6785897AE71, 0x53B5615DF17F7, 0x572F6A7254D9F, 0x14F4720495D20, 0x385562051299F },
+    { 0x70B2A742F57BB, 0x7E8C643437D42, 0x738C25D1EFFFD, 0x4AF4A5AF5369C, 0x34DE95CBFBD0B, 0x58A75E39381D9, 0x4012F67F819D6, 0x50F1A307B457F, 0x289DF4755AAD6, 0x681A5290F5B0D, 0x5E24C37530361, 0x2274FFBCAC0CF } },
+  { { 0x5F8829E6F7F55, 0x6493514ACC0E2, 0x255FA77572B86, 0x21B3A9EE649BB, 0x08774C2BC75F9, 0x3CC5B535ED308, 0x383709871D977, 0x1898604EF438C, 0x60DB4B78DA4C2, 0x7C7CEB2F8BF93, 0x100A30F38B711, 0x17C77BC342C33 },
+    { 0x6001843835033, 0x5F03AFF5143A0, 0x7969E4FD0C9F5, 0x6059C7DEA216B, 0x23A102F1E9B94, 0x713C9F40FD51F, 0x1B7F43FDD5A6A, 0x0FF4AB343CF9B, 0x24A6AF328A149, 0x628E237D20149, 0x742B0E0D084D2, 0x11072EBD7306F },
+    { 0x0088C1913FF31, 0x67EF67B7F25D3, 0x6A9F75747B0A5, 0x79EC1C2DC7814, 0x1B05F1CABC680, 0x7944A3AE6867F, 0x0A4D0DAA48587, 0x25E1A5AB1FECA, 0x6000BF67F2433, 0x60B04937DF65B, 0x4C34A1CBE7D99, 0x39D57678A22DD },
+    { 0x32869C417C855, 0x45BD3BC697D4D, 0x1EECE2C8BB442, 0x16B2FD0719849, 0x75B1156DB310D, 0x26CE27BF29FE1, 0x3765E782E7E3C, 0x672847CB28798, 0x4ED08D841B867, 0x603A35C9F16CB, 0x1D0CDD6473F2F, 0x2FB98FE3D12AA } },
+  { { 0x37C5164F4FDE6, 0x6AB4FD731E4F6, 0x28C5710895BAB, 0x32CC31F37C3B4, 0x27C45C147390A, 0x144E1F0E0CAD9, 0x1E27BCBFBA920, 0x24CE2EC57ED42, 0x2F15A8A95D7B0, 0x4D2F84479A3C0, 0x66F38378F0E0B, 0x0A1BF6651040E },
+    { 0x47E596A02956B, 0x4AC0C616BD1FD, 0x6E13919AB098B, 0x633D94CEB7F51, 0x16433DEB5791F, 0x2BCF71BE0CC1C, 0x14A2286A152AF, 0x5357157E9302B, 0x226BC6880B3CC, 0x0F8589A398DE3, 0x7B13D4F717525, 0x1DDBAA3D7355C },
+    { 0x1BB568600DD02, 0x363973BF50A4F, 0x510979EBBCAC0, 0x1D1107A685D0B, 0x5E6DF7467342A, 0x77463217C1BD5, 0x025371DB1B62D, 0x4A63BC6E5CD90, 0x51B4A58E16196, 0x435F0D1092DA3, 0x21E0BE4B0A4E3, 0x2157D161C2942 },
+    { 0x18CE2D38FAD61, 0x53B46AB2F3B14, 0x70D90B110CD18, 0x3779D74BA0ACE, 0x37B8A9CB5EEA7, 0x15674B2238CDA, 0x208053CE1A65C, 0x3158C43B9B506, 0x38F6C75999129, 0x36D07A6183ECD, 0x7996DD1C82FB8, 0x33A6FF7FCA800 } },
+  { { 0x6E8C7E14450D4, 0x022B0A086AFC1, 0x6024056B3C28E, 0x5FF66AB44334A, 0x1A3119B35D918, 0x584AAF093AA56, 0x68289A8F45C63, 0x606F3DCB9F94C, 0x3B3140F10E5AE, 0x03F6C44FF4110, 0x65B2A26521791, 0x3EEE9A27CA93A },
+    { 0x3466DC4049A34, 0x1898A82659DC5, 0x603E7D6585D96, 0x2F0F838A45C84, 0x0790E98E4F37F, 0x1EB5D9E786F8E, 0x182D440C42FA6, 0x6F969F0AE42CE, 0x089B7A64675C6, 0x37D5520FC6BD5, 0x311386500A686, 0x16CFF733D7429 },
+    { 0x1D3E2CA69E9FE, 0x1C4889B7160CB, 0x4A545651A81EA, 0x1B9999AD36A20, 0x4330F42F394FA, 0x0F539F6288BBC, 0x4F54EFD440466, 0x01DEA81753B5D, 0x5B0141A20514E, 0x20244A5B0CB2F, 0x6E83CA55BE7D1, 0x24B30E2756499 },
+    { 0x68749D785DD04, 0x52F911CBEC5C2, 0x790CB5E015300, 0x1E3B31FAEE1ED, 0x1F23F2E65A37E, 0x3BD3250D58C43, 0x6CC2D6D67133E, 0x213A7AF1CBCD9, 0x1C15C0B3D9EC1, 0x22DDCA1537DE7, 0x2F4E483ABDD8F, 0x2837BB8D93D56 } },
+  { { 0x48156523E591F, 0x7DD3F56AFD658, 0x1A4429FB18DA4, 0x74EA3EBFF027F, 0x03F70F3B94277, 0x465DD1311552F, 0x6C618523337D2, 0x56AB85D8B0437, 0x26233BBD9BD23, 0x4E0D430308A93, 0x24EB670101F8F, 0x358BA404ED3A7 },
+    { 0x65837E67B50FE, 0x60D82896661AB, 0x34324AD9F28ED, 0x7CE6B20AC7F1E, 0x7407574B95691, 0x1564E3BFCB132, 0x3592888EBA0BE, 0x6C88DCC49A7E9, 0x3750EB93484AC, 0x41639B10EB188, 0x6A2D90DA41B38, 0x1D95A42971741 },
+    { 0x4EDE3E8948BAF, 0x5E33D2F350B9F, 0x5B5BECCA965A0, 0x6C10CBE64C3F2, 0x13A045593EEC2, 0x6625EFD42F08F, 0x15D6624E67EC4, 0x1651C1F3AC265, 0x56D4A75191253, 0x502565235622E, 0x0FED46CF3BFF0, 0x1DA25F1217805 },
+    { 0x302EA0F5B29D0, 0x5AFB03CFF5B3E, 0x45196FE784104, 0x29A9A4025AC81, 0x534E7FD00DDDE, 0x39FCB32AA9DD6, 0x1729CB46E341A, 0x629869E81008A, 0x7A7AEEF83A677, 0x7FE6B147BCB1E, 0x50E25554FE08E, 0x2154505BB6ED0 } },
+  { { 0x3F222E993F26D, 0x61766F9806170, 0x36D72A010B3AB, 0x46DC652DE4A8A, 0x4E7C84614E3A7, 0x729E275FCA14A, 0x06C87D8A47510, 0x01B3907CC9B53, 0x6A7F1B3516AB2, 0x098531EE3FB9A, 0x036B438329023, 0x2C1C0A99F55F0 },
+    { 0x0943B7EB69AC4, 0x06FBFAE9B138F, 0x029B2D3C65007, 0x5429656060B13, 0x5D773E2D9C154, 0x1B317DBCBD76E, 0x734E8E9BAA97A, 0x6B922825B5F6E, 0x75BC1016B9865, 0x503216CCCF117, 0x477F528024BB7, 0x1B6AC7F128F11 },
+    { 0x1BDFF74CEB75D, 0x599239E6D1F75, 0x3163BCD9FC953, 0x5D8318F8774C0, 0x3D0DB1F25CF3E, 0x09E2ADB25629A, 0x5F91EC68F3686, 0x305D4EFFC8304, 0x3E5266A63D97E, 0x1C63501D787F6, 0x4E135C9E24246, 0x10C522DC05028 },
+    { 0x2FDDC26A95464, 0x4C4AE39F8D9D6, 0x63AEFC439246A, 0x6E2D0575731F4, 0x4045ED842E465, 0x6F8616B38C692, 0x3CA5B5AE1576A, 0x782F552E1AB2B, 0x0F027521E0A73, 0x74429EE598D3E, 0x6C22AF2A112C0, 0x2E8296CF9AAB2 } },
+  { { 0x409042BB297AB, 0x1A443ADEEA08E, 0x67DFC8FD7ADBB, 0x3356CAE512820, 0x6688BD6A330BD, 0x49FAD7ED75868, 0x686A029A553AA, 0x7FEE946BEB95B, 0x3704EFA889ED1, 0x4A856BF1DC5D7, 0x41FBA693846FF, 0x3621EB26E65BF },
+    { 0x5C590220B70E0, 0x510DD7BECE5CF, 0x54959A331D7D2, 0x0536723483DA8, 0x656B605CEFAF6, 0x4C66689F9C99B, 0x11BCAA67269D5, 0x165EECF5E58F8, 0x5D92FB0A222BD, 0x3C4F69B288D96, 0x6F779A789F034, 0x24168A30794FA },
+    { 0x287B53A331A4B, 0x5D1BEEF01E3D9, 0x12A80642018C2, 0x383045615150F, 0x13E7C36C5371D, 0x07A5B5E7B03F5, 0x797E5162135C0, 0x17E3B020CF28A, 0x400ACDB314A40, 0x78A7751F1B465, 0x5B8411C9287B1, 0x3651BC906BEB1 },
+    { 0x1E8176C478596, 0x42D96346EA500, 0x20C756AF9D270, 0x32252BD7877EB, 0x5175CB0EE4B95, 0x3314D78E88783, 0x4560A9C3D1EB3, 0x75B5FC5C59283, 0x3EDDED6C099F1, 0x7DBFBB98035EF, 0x59D82D521E538, 0x219C24E8A6BD3 } },
+  { { 0x025BDBC2526FE, 0x3DFEEB330F5E4, 0x79348A8F33A00, 0x3AB2A13E4B4FD, 0x2A84FD448C3D9, 0x21F47B670CADA, 0x54EC79CA3770D, 0x05CF29C954B02, 0x4DDFB95384D5C, 0x5621EBC5A8F81, 0x54B7320B7010D, 0x1B672C6F67B68 },
+    { 0x060EE452736E8, 0x01385C9C7755F, 0x5157A1ED5A5F7, 0x6441689AE4359, 0x3B38E219F5BC4, 0x5284FC40FC30F, 0x74A5194468425, 0x0866B6DFB9B9B, 0x24F8AAB088B20, 0x6EE6CEF8AF834, 0x6E35E27C6695E, 0x185634AAA62B7 },
+    { 0x4EAD50D81AA4A, 0x6FA8705872E27, 0x0B6CC4B63AAF9, 0x7A2C8F163A3A4, 0x6FF9C0748A61E, 0x01638C4004C11, 0x6E6859D0C3436, 0x7E63A58EDBE45, 0x2BB12FB31545A, 0x4CCA1095B9F6E, 0x03317A0D3CD10, 0x37E4BDD04B3EB },
+    { 0x247CCA3A78406, 0x5043F295969F7, 0x77B29A4BBC62F, 0x183C8781435C2, 0x44470D08F03C7, 0x0B393A4EEE251, 0x12190AC69AF75, 0x64128FD9EB8E3, 0x360B866ECB510, 0x18F89F5460000, 0x7353D1473FEFF, 0x21662B866478D } },
+  { { 0x071EC9160165E, 0x642905DC70329, 0x6A1E0462E1A21, 0x670652ED90CFB, 0x3E22D4EB7809D, 0x438E4830BF71E, 0x216601DE25A85, 0x39B415EA54835, 0x05F1ABFB8CB2C, 0x51B898996CE42, 0x7762B4CFF6DA7, 0x36D744AB93FAA },
+    { 0x76C80211521C4, 0x15416AA56D13D, 0x2ABD197F04C17, 0x3553A48C59C2C, 0x0778C721F3CF4, 0x100C6F9539054, 0x27422E9BDFF22, 0x2EB3B0368B82C, 0x2CE52731042DD, 0x7255AA56059A3, 0x7E8D5CFCE46B2, 0x1A0DC6A5DE0C4 },
+    { 0x3CEAE94D05FAE, 0x0CA3CA3318359, 0x36204FF11C551, 0x07D1A27DD6686, 0x5E89ED76FF5FC, 0x371A2802D7B49, 0x40CED3E7B5FBD, 0x3CA67D9115C58, 0x08BC7835A58AC, 0x3C44EBB9EE7FC, 0x21EF11E7E8746, 0x1EEF5028EE819 },
+    { 0x499572FFE3BAA, 0x0F01DE26258F2, 0x61258BC47D1B6, 0x2A34CE94E5CB8, 0x2457591BA8E0E, 0x07C1EC06D93A3, 0x391048F1F6C67, 0x797973D6CA218, 0x4394579A0162E, 0x47531FD8AF516, 0x5FB7D1DAD607F, 0x238E07C6E2D57 } },
+  { { 0x5A70139F5166A, 0x690545483D99D, 0x627618359D453, 0x42851661081E4, 0x63C69C92BFD2A, 0x6C413B892492C, 0x6C35B618C8E48, 0x66B2254792DB2, 0x25C6431A0EB95, 0x1B1679D8EF7D7, 0x100FDFB5EF684, 0x37D2570120086 },
+    { 0x50BB35A1C9E4A, 0x77B847F54F4E3, 0x50B9883E5DBF9, 0x70986B647897C, 0x20DF5AFAA5567, 0x1E0A55B42C17F, 0x4A59A334129DD, 0x401699CFCA341, 0x59FFD5BD1392E, 0x1CBAF593C7545, 0x16DA039C83E23, 0x127249D483B16 },
+    { 0x7B03131DD5E82, 0x5C69C7A5B7EB5, 0x3CAE7977ADE18, 0x1BC8E3D87595A, 0x348A8FE1ADFEC, 0x126C91F4A9C7C, 0x3D20951CBDCE0, 0x6EF15A5AA9867, 0x0196CD0335D64, 0x4D2135E2CDF0B, 0x4ACA7B4614AC9, 0x3A8FA492D21B8 },
+    { 0x17EC13ACCFFA2, 0x489FFEE2DFD73, 0x079B6738F8CA5, 0x41B14AABDB0FA, 0x0C3F41A991C9D, 0x27EC1864466BD, 0x73DA08F933BBE, 0x143DB31D7D2EE, 0x451EF8190A5E0, 0x7645AA4DF176B, 0x1D4CADBCCB9C8, 0x2AA9A845CAFC0 } },
+  { { 0x65859C07CFAAF, 0x0504C1E83D289, 0x155870D79134C, 0x00CAC18A11A1E, 0x6260907264941, 0x1E44237AC6F45, 0x72F6F483636C4, 0x78570B03F41E5, 0x78D1117EF75C1, 0x790036BA98F11, 0x11C3CC6280122, 0x2B587692DF35F },
+    { 0x65021C8A00D35, 0x0EBDC1391F90A, 0x61DCD5ECB42D5, 0x14E8CDA136E3F, 0x03DFC964E17E1, 0x63CCF66FAFB97, 0x3D18D75F18FEB, 0x36F52F3D9A02F, 0x63DB7209E857C, 0x419215FD2096A, 0x2DFC027B2C53C, 0x1620955CECF0A },
+    { 0x2F1A209C8B149, 0x1DD33FDF7A7C5, 0x6663177B57FC3, 0x3E21E950794CD, 0x358E68928BD22, 0x4CDD744347590, 0x18C1160A33532, 0x3D99146653DCE, 0x049A7614D9346, 0x7C41BBFEFF9A9, 0x194AFDF9311AE, 0x2C95151227FDF },
+    { 0x4BC83FDDAC30D, 0x36391D035A094, 0x2B2EA669A7F70, 0x3A7E76CD2B705, 0x01FBCE2087FD9, 0x20A9CDB669C2A, 0x66635454BCDAC, 0x629528629D0E1, 0x2705A4F14A651, 0x6BB678F4BEE6A, 0x4207FD798CF8D, 0x2788FA8E3E758 } },
+  { { 0x3EB389B59A3B9, 0x1BF5266C8F73F, 0x4C6979D33B003, 0x646572BE722BB, 0x5A5788FEA09FB, 0x335417998961E, 0x41AEC540E49DE, 0x67502E7797AAB, 0x48F14E6A52A10, 0x7533ED5E34D33, 0x46D858C83C1D6, 0x17315F03882B1 },
+    { 0x1C9E215D8EF63, 0x13835FDDDB626, 0x4D4DE00DD93AA, 0x475669C5E6C40, 0x3F02FA9A5E715, 0x39F9CE41B8460, 0x6FB265BCA5C22, 0x17520C929DE81, 0x0941D4DF982DC, 0x7749FD9E08E38, 0x186A08E270890, 0x1FEADB1F7C25F },
+    { 0x6AD9588AE2CB7, 0x1DE40CB209413, 0x06FE9380210A1, 0x0D91865F36A55, 0x35C581A693A95, 0x66639A9B83489, 0x703607368268A, 0x4AF16D745BB5B, 0x32FD665B5F1DC, 0x39A6421748171, 0x6DCCDB15959E9, 0x1F8CA05AC2EF8 },
+    { 0x79133442AD4E5, 0x109C6DB696731, 0x53EFCBF803BBA, 0x6F5BDD8F5B95B, 0x1AF8415BC2FD2, 0x68897B58F88F3, 0x19F8CBFAF98B5, 0x6E72A64F2BC2A, 0x0FE46BA5873DD, 0x1DA9FD0B59D32, 0x216BB92FD56B5, 0x2AB3E602BB6AA } },
+  { { 0x3FA63A252BCAC, 0x642911AF56C8A, 0x21108C75C746E, 0x59807E0096A74, 0x3EEE9D36D6BC8, 0x12708E682DC8D, 0x0D6386915A90D, 0x1BAA81AC91565, 0x686848EDA9F06, 0x2F5C3C7520DC1, 0x6DB611A4E3970, 0x3486566430C1C },
+    { 0x607B8B6A787AA, 0x1BC00F0C5D29C, 0x34EFE16607496, 0x51B0E196B02DF, 0x27684A30C6DC3, 0x32364344B0AD6, 0x4A62F651E5F71, 0x2240BA0B96D5D, 0x5DF86F9C03DDC, 0x7DFF048143D60, 0x76AB69F854BC9, 0x14256ECB158FA },
+    { 0x3C9B13C4E391E, 0x2579EA0D86585, 0x30C2D09CE5617, 0x1321D05A8C3FC, 0x2730A4CFDB8D0, 0x6E8F3B561C70B, 0x605E1CF8D039C, 0x4D16F19E02671, 0x73E7147AFA4C7, 0x64581725CB56E, 0x4D16FEB077ECC, 0x34CB6C9A0A874 },
+    { 0x45017971883D2, 0x1B081F944A326, 0x2B3A6E594FCF2, 0x3818F26CBB9B5, 0x176C4C95AAC39, 0x48ECE6BF49F1F, 0x34C196ADD6BAB, 0x11F1ECC174602, 0x7D94D82154294, 0x15B4484FC6E9B, 0x6BCC012DA9218, 0x19C581CB027E7 } },
+  { { 0x4778DCB8EC137, 0x2E301DA7C3B79, 0x3E2AD1AEA0D03, 0x0C42FF16D138B, 0x130B7ED2CE9CA, 0x3BF8BC862F25D, 0x6EB9426096944, 0x25688E8F34A53, 0x6EB6DEFEF92EE, 0x569482B7723BA, 0x38A4D739E6BB1, 0x2FF0D7818B70E },
+    { 0x23536B0385806, 0x1BD9931FD499D, 0x4FE4CB18C4A7B, 0x1C20F695F7619, 0x058FE8472DD91, 0x5D05A6FE1DDDB, 0x7036E7A01B2C4, 0x1907E467BDABF, 0x01C1440AF06EB, 0x65D5DB1F5652E, 0x335AA7462E1F9, 0x1361241C75784 },
+    { 0x2EDC859EC669B, 0x40E961993A10A, 0x1EB5891FED8AD, 0x7331F5E402EA8, 0x505B8F91162AD, 0x4753D5A3A6E92, 0x288D12F45A86C, 0x7BA26C3D4CA25, 0x72E15C481DB58, 0x1B843A950665E, 0x6CD7B0BA80F87, 0x3238515C6CBBB },
+    { 0x1237F9A305F96, 0x11EDC44C289CF, 0x77BE19BFBA40C, 0x38C8534F3849E, 0x75DB425F249E9, 0x5E74381D4B2E0, 0x60F5DA94BFC35, 0x2471CA9E86EAE, 0x474F4E4C08201, 0x15AB3EB92E82F, 0x5A0AF662DA6BF, 0x18631557C3C96 } },
+  { { 0x556FA058617DF, 0x01B3B0AEE27E1, 0x31BDB18A2157C, 0x6C6848EA24E0C, 0x421FF0D323853, 0x57D1B24D23FD9, 0x0CF447E05ABCE, 0x36F36CD6BFA91, 0x06E5E8DCDCD6C, 0x3623AA875EBDB, 0x64667B0E8AB5D, 0x3D0C6582A170C },
+    { 0x4F1F18BAA1CD6, 0x6B670EB62A7FE, 0x324A575947757, 0x5949EEE3A1673, 0x4F6CBE36ED54D, 0x62F68324176E5, 0x0C727D4C45F86, 0x248DC8DC6BCF3, 0x27B57A5D14391, 0x636CF2BDF6BF3, 0x269A426A0B34C, 0x166AEB5189CE5 },
+    { 0x6430638F619E3, 0x623EBE305AC2E, 0x0322FEBB3B732, 0x209CC171FDE06, 0x182947783B41C, 0x4087707ECD3A4, 0x72F4128597D51, 0x2A3AD6540E0C5, 0x422EF31FA5900, 0x1403DFDB1BD14, 0x55164E8FB6DE3, 0x1877140112A93 },
+    { 0x000244F76522A, 0x47E6829D17658, 0x63A648F15470C, 0x253D09CB0AE7B, 0x35D6CA2BFF4D0, 0x46D644B5D12E2, 0x70BF3E1C3CB45, 0x662787672DD38, 0x6A0212565D876, 0x33C9AA7D9D5AF, 0x546B71B8E3CA9, 0x178D348D9F28F } },
+  { { 0x0079063735AEA, 0x14F60FCEF66C3, 0x15D22E356C248, 0x3E9F8944D3213, 0x684F9C5DF300A, 0x7165F1EBF7889, 0x1BDA6A7CC07CE, 0x50DA856669DB9, 0x2D2DAF4273DBD, 0x34F3F92C46713, 0x5AF5F3D27D514, 0x31E924C05484B },
+    { 0x4D745740A7241, 0x017EEFC488744, 0x76301E88042BC, 0x37BE323E26DB6, 0x3E5A314F8A2FF, 0x5BC4AE6174B31, 0x1052D0EBA2C66, 0x70BD239181023, 0x10F55C68C95D8, 0x1239F7275CFD7, 0x091982C00F1C0, 0x1DA18488C1643 },
+    { 0x6DCCEF4B6914C, 0x5E848CB9DDE71, 0x3695FA914A813, 0x210E433CDE76F, 0x655198C8900EE, 0x415C33BA1120D, 0x50C73026DB36D, 0x285EE67D8CED6, 0x1647F6E755874, 0x25249D896E9D5, 0x07DFB0C1E6FB9, 0x3247C6B6A7386 },
+    { 0x74AAC89B80951, 0x18394A53D09F4, 0x3B659749F3B75, 0x3D1E681F0F33B, 0x402D72E63BB59, 0x51185F2EAAEA2, 0x3E60AFB014AC7, 0x5B8A071E19767, 0x609AD74858425, 0x2FF8139EBCA28, 0x237436ACFE160, 0x1A30946D9E3D3 } },
+  { { 0x70DCC58D6CFCB, 0x1ED476917E2FF, 0x3F44D22A96D4F, 0x70062295F537C, 0x117F849F0AB68, 0x56125409B7378, 0x6F1CD76040D34, 0x3664CD6B32E34, 0x3AED9F165B36E, 0x6C8B9F0885DE5, 0x42EC4AF0EBE5A, 0x3914445DB6C84 },
+    { 0x2F335FAB0258B, 0x619882B05D916, 0x507DBFD865255, 0x2E563686141B5, 0x5A9FE3074A7FC, 0x597FA53DEEB5E, 0x0FD3E73017CEF, 0x7918148716CE6, 0x0A29C410C7B09, 0x369C268A042C7, 0x34B740D9AF79B, 0x0B6CB04D44069 },
+    { 0x584D71783EF57, 0x002016FE2952B, 0x018B1447AF2E5, 0x164ECBE921CB8, 0x127F6E3FD0E32, 0x345B2F92E0920, 0x3E5CA7FA598FC, 0x45C70B1F3E31E, 0x52D38CF5D8BBD, 0x1A70FC1799CC5, 0x17102B1F28CA7, 0x2F3F9A3A2956E },
+    { 0x498520B38B17D, 0x67451CA4DB2BE, 0x114CA73D343ED, 0x0A8B292FC6B61, 0x02AAD7F839D16, 0x7D076F114FE48, 0x71522F656066D, 0x159A4D9494C75, 0x48B361351EA35, 0x1AFD1754FD52D, 0x04C0D04542EB7, 0x2A7114645A4BA } },
+  { { 0x4FEFB048A731E, 0x4B3C3EF046760, 0x77D494D5BD176, 0x3DCD1E45BFA1F, 0x120A716B4FCCC, 0x0044DFE035334, 0x62638BA69FFE3, 0x710314A308A46, 0x23741FFC8A213, 0x6808B305CDC6A, 0x1A79DC5783033, 0x3AEFDF59157A4 },
+    { 0x26D9F43186B62, 0x3613A9349324E, 0x510128BDB8813, 0x0BAF5FCFBFFF1, 0x13096027A04FA, 0x2AF21F7BC071E, 0x489FF63D765BD, 0x2E6E61B06112D, 0x74D0B490313F1, 0x0D9E127A65371, 0x28169235C73E3, 0x1558A8676B461 },
+    { 0x2FFF32B8AF038, 0x4CD60EB9382F6, 0x5CF63309474E5, 0x20CB605286D7B, 0x334A18D0EAA3B, 0x3E64F972C4640, 0x16728A4EADB45, 0x17A136BFAF9C7, 0x24BD026C455CC, 0x16951551130DF, 0x0C0D0B0EF2DD9, 0x18E52C4230D7D },
+    { 0x6A53A66F77C3C, 0x32100009B4A39, 0x6386C58F469BC, 0x76558437F33E7, 0x5B7C08DB097F7, 0x5660D6ABF0CC6, 0x010184DD620A4, 0x4CA34D4C59794, 0x1C4A99472CEE4, 0x75917037039C5, 0x087487FA3AAEA, 0x19753852C36CD } },
+  { { 0x5904A4926CF6C, 0x46889CEF95C89, 0x61A089E922D90, 0x664CCA61C1B3D, 0x71218836B0056, 0x0CFCD68DFF759, 0x765351C2010AD, 0x58A1ACFEC737A, 0x2F03DD9B17A36, 0x05489FD102FD9, 0x27DF38901200D, 0x23A337219142B },
+    { 0x6749CBEB17E90, 0x5CDD16D5D0713, 0x31E5936775A28, 0x011B19637952B, 0x4C22F89A8BDE7, 0x08937CAB9BEDD, 0x191E86DCEB181, 0x557639C2ECE2C, 0x04958B88FF76D, 0x552820DCE2EA1, 0x5CEDEAC530740, 0x1B12479014443 },
+    { 0x313E2A61B9BA2, 0x716DD5E9FB324, 0x06CBEEBFAD2E7, 0x0BBDECFE297AE, 0x2BE46417E98E7, 0x4CC2FBCD25A92, 0x3EA17FCC9E53E, 0x50F625E8BCAAE, 0x707F21C5281A2, 0x21AECFEF84BA3, 0x6901B82C5B10F, 0x487E7387FB5C9 },
+    { 0x4715C5BB7E384, 0x6F540C9F379F2, 0x2F8056FED391C, 0x198428C1890DC, 0x4541ADF8A8055, 0x1039E4F01B101, 0x4279B5D152FF6, 0x7287710692E2C, 0x3D7388EDD1E87, 0x5680BCE1E4E86, 0x620446BD5B88A, 0x1AD0DCA52F6A5 } },
+  { { 0x76F0029037FBE, 0x784657BD17F0A, 0x65AB531E3CF99, 0x05D897EAE4888, 0x395F63B9E1315, 0x348C8E1B06181, 0x77B59C1F3B162, 0x227C7564F6918, 0x0802112E89272, 0x1370FCE5A27A5, 0x223CB5130E54B, 0x300A653B39A65 },
+    { 0x23E64FD8B5509, 0x232A19E649D77, 0x4E45AF077E50D, 0x2CED776C197BB, 0x04DAA15B86133, 0x6AF0CCF774A18, 0x4284C7CAD9A37, 0x08395126D830D, 0x3F509120F2044, 0x606DD7568C924, 0x4F084B0C1C240, 0x095C6CB5D164F },
+    { 0x3E93D06753C0C, 0x29B86FDF65566, 0x45FAADBCC0AA0, 0x15A7FEAC7DCBA, 0x1FAD585B4729C, 0x213FAB1BB3FBE, 0x57A31233FF108, 0x5A412706EA846, 0x2072CC51AA273, 0x47E26EFBCE50C, 0x7422F143D10EC, 0x27A25DF35607B },
+    { 0x30CDC741E1E9B, 0x5ED2DD33C0B27, 0x11BA957B75D30, 0x1944678E9D7EF, 0x4950874E0CCBE, 0x57B4F6474E837, 0x6CD93A3C7673A, 0x6209686F81E5A, 0x32B9E59D6741D, 0x2FF249E8E1E62, 0x4974B586018CF, 0x20D8C0E4FF884 } },
+  { { 0x4D5794614D39A, 0x63B1D60F12AA5, 0x36E065CF86CD0, 0x50370A23BE138, 0x4416FD86FACF5, 0x511C06F1C0D55, 0x6DEFF68C9F541, 0x2F99F62B9573F, 0x4127CEF3A0BC5, 0x41B9453A10D5E, 0x31D339F777447, 0x1B02AB254190E },
+    { 0x06430F8660D3E, 0x44E4AC815C5C1, 0x118406DB2AD94, 0x07A729D969C95, 0x03A582008670D, 0x1984F8B9BB922, 0x40F7DA90FE6D1, 0x7255B5C751379, 0x20540B2B65EB3, 0x5F1C733A56941, 0x771797D862E4E, 0x0BEE59CB543A4 },
+    { 0x66F33A6E806A6, 0x7DDFDAEE156A4, 0x0D73601847584, 0x31618E8483844, 0x6604E311C54E9, 0x5C5A74441D977, 0x7088A52DA1BE9, 0x1C57F84293744, 0x518D3620971E8, 0x0913A3C7D6361, 0x470360872B61B, 0x2559A54010F85 },
+    { 0x104C21021E40A, 0x19319B80CAEE4, 0x3BE0DEE51FBC6, 0x6D1E47C06C837, 0x0EA8341B5DAF9, 0x3F96565D6C23A, 0x1EFF308907D35, 0x151313CDB259F, 0x2EF839F02F1F4, 0x5EC20C85FA3EB, 0x5B7B912262B74, 0x1EF67C623AB5A } },
+  { { 0x2E30E7BE75A55, 0x19DE1A4167727, 0x2743D2797D48D, 0x6027D9815481B, 0x12BEFFA1EDB3E, 0x58E93D2AD83DD, 0x611405F9A878A, 0x3ADC45EA4CE69, 0x1C64CF9E907DB, 0x535ED766F49E3, 0x18A3B9BF63FBA, 0x2FB788F8086D5 },
+    { 0x4A3668190272F, 0x689804758219B, 0x00660784E9D8D, 0x794F5E7CE901C, 0x70D7123490E88, 0x6195BCAB68789, 0x5848E4426840B, 0x0C5B5302A6DBB, 0x26D2CD322863E, 0x06C76BCACA7C3, 0x28700C3DB4961, 0x0A01BD0120AF8 },
+    { 0x715B8AC3628FB, 0x548DC47E3CDB7, 0x0E0B8BF2F44A1, 0x1F64470D5F822, 0x4902C1E216E1F, 0x749EA23B9D610, 0x559525ABEE3E2, 0x6E954B91EE02E, 0x1F04CA4906A8A, 0x003102308A996, 0x293D05692B692, 0x2E2996DBF4DF9 },
+    { 0x6A9704D2C6AED, 0x2787235386E8B, 0x6E437CD90590D, 0x30DFD2226DCE3, 0x1FF4E1F91BAA3, 0x70B42C4BEB2A1, 0x535FD357DA2E0, 0x11E3E38684FAA, 0x021670B5ADC47, 0x5AE4988687E05, 0x486CEA70CBBE7, 0x2DA33623B0639 } },
+  { { 0x56F451DD3D1A3, 0x2F3B7013FE1CC, 0x72BEBFA209EA7, 0x7634385478BA1, 0x4D71E356633A6, 0x4C0186642EC52, 0x5DD4E10E7E7A4, 0x3A2CBC635227D, 0x15011091C13F0, 0x79F9FDF40E065, 0x703EBEF8E6F36, 0x2AE27DB170BFA },
+    { 0x14B455F2B06F3, 0x7F12E6DEFFD5D, 0x1252FA9087DB0, 0x36FB5ADAF9AFA, 0x632AF7E38A0E8, 0x47B02F7230EC9, 0x1B5234195FAEF, 0x57251B58B41AD, 0x0C667D529A7E2, 0x1F428206BA7AA, 0x42646BDF02ECD, 0x29217FFC57BE5 },
+    { 0x4F8F9B7D422CF, 0x54835B0A63B28, 0x268778180079B, 0x113BB28D45222, 0x7FC141623219F, 0x0BA2692C2C2BF, 0x7F7385E1965CB, 0x33BA5B53CC8DF, 0x0E9DA78DEB34B, 0x37BFFF0A67304, 0x2FECC768993A2, 0x26520796915A2 },
+    { 0x34FF40E6F02D5, 0x6EEF240824E33, 0x4146BB8456A47, 0x3420E56679B5F, 0x3D7D89DB23427, 0x700D45A3B8CEE, 0x1CA34A5D8F416, 0x7CA8DCDAA8EC4, 0x6DE867850032B, 0x64B063AB9B5A2, 0x65C0AB2C2A074, 0x22209F27BB820 } },
+  { { 0x0A3E4E2649312, 0x54DBD4B557C6A, 0x3A91B643E1D46, 0x5251DA71D3F45, 0x0F6A282EEAC2D, 0x21B46F66D75C7, 0x1A428CEA1CA09, 0x02ED999719ADB, 0x125623F69AEBD, 0x0DEDEB81E6091, 0x44C2E6A17F335, 0x188E8A903785D },
+    { 0x7A5983B66F903, 0x5CB73C6263872, 0x3B9A103A761B6, 0x2C5C92D83EF15, 0x2E3453055C2E7, 0x651552CA06FC3, 0x39EDD6D1D7605, 0x33454BFFB36F4, 0x124274020ABB1, 0x1F314975AF686, 0x4FBE3CD416790, 0x07CE1E647E80F },
+    { 0x3F19D38E60EFA, 0x4564A954A3EC5, 0x47B019F816811, 0x37D69194396B5, 0x54287AA3B8479, 0x3AEFFAD87A811, 0x0FC29296673D9, 0x6237C954BE469, 0x472BE2D70F066, 0x336B036FD704E, 0x287DD43907DDD, 0x2B0A11C513AF2 },
+    { 0x34225E948046F, 0x0A23B08C70620, 0x56AC1487F4977, 0x6DAC1E90459A8, 0x3E59236EDE27E, 0x589114A25E553, 0x48A5B3B355738, 0x241BDCA2CD1AD, 0x5C9E7523B4D0A, 0x6701BDEEBC391, 0x4711655121571, 0x2DBF36C6AF76C } },
+  { { 0x09B3AD7E21861, 0x7BC908327E427, 0x5147CDACA7EDA, 0x25BBD3AF66C70, 0x2104825854ADA, 0x55AAC6E1BAEBB, 0x2931FE4F387BB, 0x69DC046C3175F, 0x71F18D69E820F, 0x77E9359F69276, 0x300571B38CC7A, 0x070015FB5E0CB },
+    { 0x72ABFC526F443, 0x39B55089EDA40, 0x3DA387F6A4341, 0x30DE00B697D00, 0x1B941FAD0EFC4, 0x0261F04A57EBD, 0x7329C774FE62D, 0x7F9242DF1F6B4, 0x64CE950244323, 0x3F99859FD5AB2, 0x6D64F1F47C1F9, 0x18BE86032F82A },
+    { 0x2620F1B5D8D69, 0x1F3E5D08A129D, 0x7988AD8731E51, 0x267D143A97B35, 0x0DDE0C3388E12, 0x6C71B96D5A6A5, 0x3F57864DB6F06, 0x127BA8CDDD903, 0x5ADD489C6DBCB, 0x532E3BD6CD6E9, 0x0B24AC24F5E4C, 0x2C76D2CC133A6 },
+    { 0x75192BEF1D661, 0x244D20DA9CBA5, 0x28462044A1869, 0x7AA37EE08809B, 0x5E31067767AAF, 0x612ECF300B235, 0x1FB2428F7BE82, 0x3DF0653F6BE70, 0x628B72ED9D71E, 0x4D74F639A4101, 0x138AABD86996B, 0x1B891573E0DAE } },
+  { { 0x7486BEFA587F2, 0x417C4BCE5273C, 0x44893FA4DD141, 0x6F50960E12693, 0x5B373755DBA4F, 0x7FBF9BE4E1175, 0x024752C2E8A14, 0x0848DAACCA1DD, 0x2BF83AFD238B3, 0x5A9ACB6C26C31, 0x6EB807FEB28E9, 0x40CBA1375CFC4 },
+    { 0x54FB9660EF57B, 0x31E6EDB13BF41, 0x293B7F502A76C, 0x0BC9FFCDCCAF7, 0x55E97E1BE0EAA, 0x5941CA6BB637A, 0x57DC6D52A838F, 0x773F49FFD35A9, 0x66055A0E6E51D, 0x0257659D49CF9, 0x4051E9BA5EC92, 0x145C3491F1914 },
+    { 0x3DD8E0D8BF162, 0x49ABB65E7C878, 0x2BE278B6D7800, 0x466FEF3F399F1, 0x470D9BA5E2EDD, 0x1C8A0D9E4D3E5, 0x435318AD5E20D, 0x0AF5B45B03860, 0x3A7796A3CCFD6, 0x34FE1F30F1BDB, 0x16B2D8E1147A7, 0x1E56AB6C14D00 },
+    { 0x4C3364FB2BA0D, 0x4302687D26591, 0x5FE7341685353, 0x3284F3992D155, 0x658D83739CA2E, 0x00801DD55A66C, 0x22BDBB0E2CEF9, 0x27F1E55B0D36E, 0x1E1A90E98AA5A, 0x1C90FB2A1011E, 0x0B06A565B3DE7, 0x1A10F6E7A5419 } },
+  { { 0x02690AF254501, 0x243C3D75B377E, 0x10D1ED5851035, 0x3EEEDDECE9922, 0x039BF2C7E12DC, 0x573EAE8B7156B, 0x1EE9BC2071A39, 0x173D40B602407, 0x172C07830315E, 0x189F8B610EB50, 0x3B28FAC2B60EE, 0x1B5BDA15F4BBB },
+    { 0x06E16FE763B85, 0x1E1C8B9B66CB9, 0x36CDBE1A0033D, 0x058F0738DED3C, 0x453F6C29879A4, 0x16952091BB997, 0x2B379B78FCD74, 0x56991C0916426, 0x122AA48EF5B2A, 0x5C6A7F23794C1, 0x12C6BAE03BE86, 0x1E16DE7DB46C8 },
+    { 0x4AD45D25E54C3, 0x09E4E48EFEDD3, 0x1521552B66B5A, 0x5DA181473E317, 0x7101DFCA8EE4F, 0x36B0ADA08CD79, 0x50BF5E1A39A0B, 0x15056DF1F6009, 0x1DD43D7BD9EC0, 0x637AF667C252D, 0x7FEF2FB329ED0, 0x163B112024C4F },
+    { 0x721DD3C2E65A9, 0x25DAC1A7EFF99, 0x041C90E8EFC7C, 0x4933198C921F0, 0x145B7EB7232F5, 0x7672CF577F100, 0x3C0D549FAF920, 0x6FABEDE434037, 0x5A5AD67C06685, 0x122723725C7B9, 0x505F6439C72A9, 0x28FEC9FD7EE41 } },
+  { { 0x227E461210F3B, 0x78C869278CE49, 0x48F599B5508A9, 0x58DC9507B0DC4, 0x6AC70D2CFAC19, 0x505FEDAB6E07E, 0x1602FA0159B3E, 0x437BDFA84C094, 0x059E2539C1194, 0x47A5829AAF3FF, 0x0A806754873FE, 0x20DBB42821970 },
+    { 0x73DCD874C58B2, 0x30C177C498BD4, 0x1D00574ED98BD, 0x2229ECF04AA5C, 0x454BAE1F5BF8A, 0x6694A485E19E1, 0x0BC5DA4E21443, 0x7269A5036FC94, 0x225413DA1F7A6, 0x01E576C1DAF07, 0x107D14917C2F5, 0x0DB1EEA5ED65F },
+    { 0x435E38ACE3519, 0x30B33E39F62CF, 0x3D9054733DBE1, 0x7D37DA852FD27, 0x188D8D8FE6368, 0x496D172CE5B6D, 0x5B555B49DD6DF, 0x64C9451DDEFED, 0x20EB726D6AD1C, 0x1C98DDBC8ACC6, 0x643E66C122330, 0x0AC26D5D8CE03 },
+    { 0x399BCE40290D2, 0x5102B24E1B403, 0x569C6E11EEF18, 0x70A93CD0B7195, 0x58C55BD611D6C, 0x2DBC5D45CF41A, 0x785A6D66F5494, 0x3E8854FCD494B, 0x316092C986D8B, 0x50670CB1FA2A9, 0x4A520E3A8CFA6, 0x2D0974B3C629A } },
+  { { 0x33CD4FBC334D8, 0x7EEDF68A231C6, 0x393804F692596, 0x6EC2EC41B6A1A, 0x7758E1AFB79DC, 0x41641DE39CF35, 0x5824F274DCED4, 0x22F81B03C8644, 0x6B907588E4056, 0x2446355F61207, 0x5531F71604AB1, 0x13900A2D3CFA9 },
+    { 0x621BFA86B1DFD, 0x78CB934B3956F, 0x5C5521A5F557C, 0x02E14BEDBCDDE, 0x5D0CCFF244BFD, 0x372A0FB4A1A2D, 0x768012BC648AC, 0x78042611A3394, 0x17FD4CBB67D38, 0x21CCEAADDF73F, 0x441C7CEE4BD2A, 0x0C065F788D75B },
+    { 0x299DEDB483266, 0x0935755E6BD51, 0x594DB304C4B79, 0x240E059389266, 0x66A13A3351509, 0x126C3A5C50A27, 0x0E5D9A31A9298, 0x2CADF6A9DDA30, 0x492C3E65246EB, 0x467A7D5AF4688, 0x23C16D251359D, 0x2625C6A1691B1 },
+    { 0x05487FC9EA0F5, 0x5979E4FA052CF, 0x643EA579E9339, 0x4C88E475766E1, 0x5ABC336328B1F, 0x55F140755CD1B, 0x48DE934EB8A21, 0x0849B54382736, 0x1A761A80DC5E0, 0x1D0ADA20ED3B4, 0x3D332B68A7792, 0x244FAF05142B5 } },
+  { { 0x775326D53CE44, 0x2937DFE982808, 0x207BD839D4D9B, 0x0C45BA828973F, 0x7881E11913FA4, 0x7694DC778BAC9, 0x495B9FE57972D, 0x68C2EB70EA10A, 0x6CB40B6B9ABD6, 0x0940CCEDC66EF, 0x1D548BEA8E885, 0x3FB9BCC8591B1 },
+    { 0x72829831931AA, 0x17FC112E66CBD, 0x6092A9A850DA1, 0x1712A2C80BEAB, 0x4B061D138A8F8, 0x590729BF3DE39, 0x5B654193FB6E7, 0x70A8EEB702A64, 0x7E1B372931209, 0x2045A282EC68F, 0x44FB64E4EAF0F, 0x0FF902C39765B },
+    { 0x539156BB49204, 0x3F88B9FD90AF5, 0x5EE569D33364B, 0x754679B170989, 0x3A4396BB76E11, 0x6772F23057265, 0x49868447747E6, 0x459EAA55BA1DE, 0x67B0DA8304B85, 0x1523066E15992, 0x1078EAB39622C, 0x2FFA704759199 },
+    { 0x624A3ECF31D02, 0x60BD6BEBEFF98, 0x5F9134B45DD52, 0x47F3D2157719E, 0x616B7CED633A5, 0x10F15A6FD9330, 0x4EABFD4B79435, 0x1D6AF6B136B15, 0x3570FD91B5CED, 0x4F868F8E06E97, 0x0662C508E80E6, 0x316A42B092DEC } },
+  { { 0x727D8B6145806, 0x4C095079F6253, 0x25EBF11414326, 0x05D1F23B40C75, 0x27571EEE1AAAD, 0x1C91842D921CD, 0x07352B86E346F, 0x10F4D4A3272BD, 0x675A97E329983, 0x0B5621E03E86D, 0x4EC5DB24FECAF, 0x1B38712A89C9E },
+    { 0x761CF2FA30C2A, 0x777163880C46B, 0x73F8893F5FF04, 0x64F798B4DBA29, 0x6B89C2803AE23, 0x0430752EBA37C, 0x24D39F250C9B1, 0x3A7470502237F, 0x2FA565C2E43C7, 0x19AEFACF7E454, 0x4C9C8681C4930, 0x1CBCE93511F90 },
+    { 0x5E8293B30EAF4, 0x1551CC0C95BED, 0x53BF4EBF8E999, 0x2DBAA5579CE14, 0x14D602C5A41B7, 0x3BFD606420901, 0x083A6D03B5100, 0x726730A35439A, 0x2E3A0BC087717, 0x402D440AF8413, 0x722C58BFD4813, 0x24DF59D15EF71 },
+    { 0x09EC5BF2940C8, 0x559446A92A0E5, 0x1C2124DC1659D, 0x7CC01AD7FB1F0, 0x0B0404432A39B, 0x76BFA8CD80818, 0x229152C178A2A, 0x789473AF560AA, 0x6A362F5B0F513, 0x5EA4E1C4D99A3, 0x6DA1B6CAF25A1, 0x274CD69E9AA04 } },
+  { { 0x1C8D15645BA22, 0x7838E883BD241, 0x3D6A084F6663A, 0x05DC6862BC475, 0x4911A31D262F6, 0x4FF10E77F413E, 0x1FFD1726364DC, 0x2942CD663C65B, 0x5F9310E8D56A7, 0x5F20B5201DB43, 0x253817B308BA9, 0x3D752F622AE56 },
+    { 0x4432E681AE457, 0x33C6971465E75, 0x12595FEB5B63A, 0x277D0F62A6E83, 0x1EC9DEF8F743E, 0x7AF1FD2063B0F, 0x7F2E696D5A6C3, 0x2D00D603FB9F4, 0x4CAC5DD0294FA, 0x2FB4AE96BC3FF, 0x0B6BD02E32105, 0x0C77C85417173 },
+    { 0x58B1A835A5660, 0x34B00ABF1EAE8, 0x23B95020C16A5, 0x3C2F5E048C383, 0x7BB9E4FF1D7B8, 0x372E14BC80865, 0x4817843F6A78A, 0x2FAEA36237B77, 0x78532AFB13F28, 0x2649A79326831, 0x1C2ED9E1AD6B8, 0x2F6CB96562FC5 },
+    { 0x00E84FCE3AD73, 0x51DDEDD07E317, 0x22D6F84253BF4, 0x4C2D0636D91FD, 0x74539CD8F380F, 0x717821957CD51, 0x41FCC86D73F86, 0x27CA8399AC7E4, 0x73D1B5DC0F568, 0x00A4D1C9F8698, 0x4F571CDAD60F0, 0x251E74AB75210 } },
+  { { 0x1F4B8ACE13D21, 0x4BFED98C8F1BE, 0x2444C26B609B6, 0x00E08FC35EC18, 0x53F6D933B1AB6, 0x30706C461D12B, 0x451FAE1E35E6D, 0x3B270B85D29BC, 0x1F50FFAA291A3, 0x5A890BFF82EEC, 0x02DC88DD70591, 0x41B0B0B000BB9 },
+    { 0x637AFCCFB6DB9, 0x76D5A1A90DCAA, 0x3FEA3966006A9, 0x317B032F0AB2D, 0x02B22A505E3A8, 0x0A036D4F55F27, 0x17142264F094A, 0x03952DCCE5D51, 0x79E26F3FFDCF7, 0x7D1426827BF76, 0x678FCE9C84490, 0x249B99A87C97A },
+    { 0x7F149225946E5, 0x34A32247C1B36, 0x709680889C861, 0x4184B9D8BB6E8, 0x1203A75BD9D26, 0x266A4FE22FB1D, 0x7E801EADD83C3, 0x38DFD1696CCDB, 0x102E6331534BF, 0x01A791CCD5B79, 0x5B5156DE4E4FA, 0x331489ECD742D },
+    { 0x3EE535CCD6E57, 0x4AF3639928DC9, 0x6E9FFD543926A, 0x324E49F764421, 0x3DE71C5FDA76A, 0x5240A336815A7, 0x5B4BDB60F659A, 0x43CF8371FCA99, 0x6F4C0F3B6D067, 0x1EA111E00D7A9, 0x5BCDDE988497E, 0x2646C1A71B0A1 } },
+  { { 0x3E1D7E8249D83, 0x312F2D7170814, 0x28A773602C9C2, 0x01A62094BFBB5, 0x2856E601CCD95, 0x48F966665081E, 0x3138DE0259B1B, 0x058E994425714, 0x6264F885A436F, 0x1DD8A56EFAB64, 0x7C6AEE7003A81, 0x3456BB0BD8913 },
+    { 0x2068F34EB6C66, 0x0C3A1456D4024, 0x5A1A6B1C9E1EA, 0x729F23440F44E, 0x0E86A1D00F664, 0x4BFB9AF98386B, 0x2BF3A3FD7F451, 0x102130626D6DD, 0x644821A00BC54, 0x430ED8A02EFFA, 0x4DD3A2BB40CDB, 0x0C140859E6A39 },
+    { 0x5EA78E9E3CD33, 0x73608FD0E8DA8, 0x0ACBBF7AD678C, 0x28A342779DC41, 0x2090CF2363217, 0x395772E372D78, 0x7914D9A2C5345, 0x363C4B5C75818, 0x0760C78683E84, 0x38BAAF7B4F870, 0x778E0C3ACEB42, 0x34EA999B90A25 },
+    { 0x4B2A7AB7B3984, 0x41140CF07DFCD, 0x303D4B5D67941, 0x704E618DA290D, 0x6FD7E1837A761, 0x60726065B135B, 0x5E77DD752CA62, 0x2327A9742D81B, 0x1B626A23730D3, 0x67C0C629AB08D, 0x7222F60A8F62D, 0x2AFA6DAB132E9 } },
+  { { 0x0FCCB44DBA69B, 0x3BAECD91C06E9, 0x1FE3EAF7D034C, 0x22EE7DA05D654, 0x1AC9B04CE3135, 0x27851A69440DE, 0x3F29F282B2E58, 0x0A172988DDD04, 0x5BAB6EF8566D4, 0x706E545170363, 0x765A105A2E466, 0x209C26A1AF294 },
+    { 0x74CD310786DA7, 0x462D0D4D4AD79, 0x5B00BCF0F8925, 0x5553205A8100E, 0x2CEF03A726483, 0x312B7971C9FD5, 0x0CE9F23642032, 0x07BA7F26468B7, 0x35BFAA38DD468, 0x09F61DB9E7E74, 0x17374A1449588, 0x1E4B2DD192C50 },
+    { 0x5779B68D78C2D, 0x4B66944B06BC3, 0x3A3AD9BE2A581, 0x0261E3AFEE7C6, 0x7AD3F02B87F30, 0x145C1E6646023, 0x74AD2FF70DD41, 0x08FFCA4BA4EF7, 0x7930A2063CC63, 0x100F55E4CBBC5, 0x512C6393CF01A, 0x0ADD5581FB2CF },
+    { 0x03DC127825293, 0x25ADA0FA8B3A2, 0x5445833AFDCE4, 0x3BDA04398DAEF, 0x55954A0706958, 0x384DCBEE5BBB7, 0x4D51EE4C5082D, 0x78BE85E001F3D, 0x7D6D96EF6CB03, 0x10C78312876E2, 0x132D344482F2A, 0x330803430DE6A } },
+  { { 0x2E26AD77A8973, 0x29A19A730A4F2, 0x069FE08131BFC, 0x0F04D8B4D107A, 0x635499D6A2327, 0x0C18DF6CA9B3D, 0x3365E34744D92, 0x52A06D6D151CC, 0x2C42993F73159, 0x4E99DB5CB3EC3, 0x0AF7BDA360E6F, 0x1C1827F59082E },
+    { 0x1453DA51A4562, 0x4C64FAB36D155, 0x594EEB48A9990, 0x4DAA45B6E3909, 0x76D3AFB8487CE, 0x09E1BBF92BBE3, 0x378AF1D24CB1D, 0x3D98C12531891, 0x03135D1499B30, 0x76303FB1AC6B9, 0x1CB232D450989, 0x06E4B035FFAD8 },
+    { 0x15D0B99D445E5, 0x01F2482D4E45D, 0x100C39738AF72, 0x1095DB1A33824, 0x419319F9FC827, 0x377E2290D2F02, 0x0DBA069FEC0CA, 0x7210A738C9E2A, 0x75D25BB4BA027, 0x10444792599B2, 0x3F9EBD927E778, 0x1ABCF9A5EF9AA },
+    { 0x2239026A9946C, 0x7E29F37FEA915, 0x3C61CD23121E3, 0x3F327C2B48F22, 0x7141F517532AF, 0x4D6EC8C7ECB94, 0x00E549331969A, 0x62D3EFEE3A23B, 0x64CC6A21C48A5, 0x2D2CFC9F8F854, 0x0B7F988320E29, 0x271B09ADE9498 } },
+  { { 0x168AC378CC5C8, 0x220B28646F2EB, 0x7BC7EC00B78D6, 0x472D28CBA0D8C, 0x632D25894CC33, 0x1E3B09BCF4383, 0x6911DA63A2A0F, 0x0708E950A98EE, 0x117F83D66D55A, 0x081DDDCF9C6D2, 0x4FDEE165B6499, 0x21957D77A1712 },
+    { 0x0F9F26CC857C5, 0x2D2FF46BC13F4, 0x459CBDABE2DBC, 0x299FFA8B62FEE, 0x2C5037F4374EE, 0x23EE41CE7E99A, 0x409CD944F9163, 0x751E646B8B881, 0x6404BF2F5E8DC, 0x3767ACE4551EF, 0x16C4C74079F3D, 0x27368A3050AB8 },
+    { 0x3F222FB5E9F76, 0x65033D98B2F5C, 0x50105BFE2E431, 0x00F76C88E870C, 0x4EE7526C46BCF, 0x2BA10731ACA8D, 0x2729F0FBE48CB, 0x6012B4D095BE7, 0x19AEAFE81276A, 0x68D534AA14DE1, 0x1B00E416AB832, 0x13353F9042045 },
+    { 0x73AC21B91B085, 0x60C68FDFAEE04, 0x7AB810E53C945, 0x10E63A713BE37, 0x68DC187261DBF, 0x0827DEC13A5C7, 0x27F67CAA1E0AD, 0x794FBF69656A5, 0x4D8E40DC03197, 0x3DAF4006ADE66, 0x4284DE5F82412, 0x2B698F5FFAF81 } },
+  { { 0x7489B0A0E798B, 0x17084CD135808, 0x08EF5641DD440, 0x4B769BC0EF30F, 0x75BDA40C21A11, 0x3A5AD140473EA, 0x05F866811D2EC, 0x7724432654827, 0x0B6BFC2D2C97D, 0x4512BE88113DC, 0x6381F7BF18384, 0x30AFAC250DA2E },
+    { 0x7733CE21F975C, 0x05ABA8F4D69FC, 0x52924EB72DB93, 0x08CC6FA26242C, 0x28CF83D05AC7F, 0x2A17F00BC7887, 0x5215527749BF1, 0x08190ADDE7A8B, 0x715D2E31360CA, 0x1A90A7C18979F, 0x686DE8203BD13, 0x1C208E9D834BD },
+    { 0x239C1D69BF80F, 0x67C435281C2F0, 0x587983FA24DB2, 0x5DAECC581A583, 0x40EE689A6ACC9, 0x7B04E1BB423B2, 0x14B9EBB5902F5, 0x5F176D61E4030, 0x56AAAE5BAB914, 0x7F154FE1BBD8B, 0x29954F3FA84BD, 0x2ECB0C73500C9 },
+    { 0x7874038D3E06C, 0x2AF8D6B7CCB84, 0x6081796EBDA76, 0x4F1AC069889D9, 0x75668913C1D31, 0x61AD88163E721, 0x19C3A3DACA80B, 0x3C7B743DD0740, 0x77995AD28EE59, 0x4AF9C85A2556E, 0x5D0E888494811, 0x32B28FC6F8530 } },
+  { { 0x440DF7F53961A, 0x706990AD75BB9, 0x57B8F6DAADBED, 0x3F1FF0981B395, 0x08D72ACB4554C, 0x3939B8A8043D5, 0x3CCB541A308C1, 0x4C40A56BA4368, 0x66B3B88AD4BB8, 0x5FF1811D8E649, 0x7C38710997408, 0x215C51549CE5B },
+    { 0x0ACCDBD856485, 0x53CAE679326C7, 0x1BC6FB14E2520, 0x3AFCEC6B390F9, 0x1AA042164AC5F, 0x104A18E3BC596, 0x00581A71C7DE4, 0x29FA184092AD5, 0x27C017B1FFDF7, 0x6E8A5710E4FEA, 0x730913543C91F, 0x16FB8A7D75F3C },
+    { 0x72714AF1A0E18, 0x4F77D5CBB54D6, 0x1E9A0E5B54DFC, 0x2343503E2919C, 0x6C2F32E0FDD5D, 0x39C1A868903F2, 0x36FBA1A2725D0, 0x39CA7CF2D566A, 0x60455B626CE02, 0x1F45D26F56712, 0x084BF61FB66DA, 0x141ADDFF00289 },
+    { 0x6B659F6A0B9EF, 0x6900905498352, 0x31C052F26F8E7, 0x5FCE5DB9721A7, 0x0A278FBA3ED7E, 0x334B03EE598CF, 0x28AC90B7BAFD4, 0x1E7F75278D952, 0x298FB785D0474, 0x68BEAF62956E0, 0x5F48AA10CBD8A, 0x230F7970866D0 } },
+  { { 0x6542CE597F90E, 0x133281B994B1E, 0x7DE90B9788000, 0x29AB77DC52FD3, 0x25EA71AEFF794, 0x4F1A5ABA278A3, 0x79C7F9776345E, 0x744D634F47020, 0x40812E382B771, 0x11D95CD3EDBC4, 0x49B502F7E7DD2, 0x1CBE609D45201 },
+    { 0x009EBB15CAE8B, 0x6B8552CE6BA88, 0x55E2A106EE33C, 0x25F3D24FA1E44, 0x23D3B5A16F5E0, 0x0F5CE79913743, 0x07035D321F642, 0x0B2B5DD03BB56, 0x74BADAEA28643, 0x159222AB7F15A, 0x2806DA1F2A3C5, 0x1C268B30FA3B5 },
+    { 0x44D7642EB85FE, 0x4DA24955E3520, 0x15D7D0208D041, 0x221088DDD7C11, 0x35FC339916895, 0x530BBBF7F9B3D, 0x58138CAD49A21, 0x21AEFBF52BAA7, 0x49A511BB10AED, 0x703459188E567, 0x1D585C93F12AB, 0x1FDBB608A69CB },
+    { 0x165A43F09A453, 0x5B01F9F0B8DF3, 0x79D548D9456B8, 0x124D456EDC257, 0x1853173DCF68D, 0x738E3963479C5, 0x74991D5BE4F5C, 0x5DD88BFD2DF8A, 0x17B240D7D4424, 0x2C01FF9C1ABD7, 0x2637D17C676B3, 0x24191F0A4307D } },
+  { { 0x0E4FB3AF2E4A9, 0x3FFB680977E2D, 0x547BB6F6B2F32, 0x7414A30531976, 0x2DB8E5572F059, 0x4850D05631078, 0x3B77242DBFCA2, 0x17C5B83840F10, 0x4E6414FEB55D8, 0x01F5F4A07699C, 0x02FC67351F2BF, 0x06F85ABFA47EB },
+    { 0x4C18F3EB23279, 0x4EA9B063A4285, 0x6A78BAD5E5925, 0x64B5817D7E123, 0x1E89CC71DD63F, 0x1A003E16AC49C, 0x36A606946210F, 0x0A9DD8F06CD1C, 0x37073C4010229, 0x196A9AC14608C, 0x21510E3914DC9, 0x17CC1C718ED4E },
+    { 0x45B49CE01E6D7, 0x54779AE61648B, 0x34974ECD50157, 0x6F6DD38C8CAE9, 0x286938AF7978F, 0x0EA2C115A29FA, 0x4A9C199FCBD94, 0x2E7BE3BCA28D4, 0x354DAFF0CA5B0, 0x3CA04288912E6, 0x200DE2F965943, 0x245123D06BD1B },
+    { 0x44BC0ED4B0917, 0x1DFCDD428D7A4, 0x48FD75E537FCA, 0x44170472B09B7, 0x34ABF908D16AC, 0x2F16A9AA0531E, 0x032592A68314E, 0x7F729BAEF4C85, 0x24BDAC880D4E5, 0x76AC2E8451BB7, 0x1C12DB0C639AA, 0x1A84CAA8F0689 } },
+  { { 0x66F0D3811C7B1, 0x24A79E0B35442, 0x2AA04D24B8342, 0x74E1256BF1657, 0x264647372CDE7, 0x777458A1DE6F5, 0x2E0A04C3BCC90, 0x348566C644EBC, 0x4131274953109, 0x7FEC709FCE2D6, 0x382579B11A35B, 0x16B4130D4954B },
+    { 0x0BBDDC52427BA, 0x7492ECB96AF3E, 0x7E6E422F381EF, 0x5A00982065404, 0x52C415116CAE2, 0x6501A20F44A13, 0x0F6739B86E52E, 0x5DD98D8F7C17B, 0x07E2DD6CCEC3B, 0x6DABDB45C6B90, 0x6AE31BB52A495, 0x1449649456087 },
+    { 0x4724AEDD2204B, 0x668F33A0E3067, 0x0E31A9FFE88B6, 0x15A859B33E8DE, 0x26CE79EE8DE9B, 0x0126B7DA97A25, 0x5CE974E85FF87, 0x2D1DE1946A68D, 0x72B5965A883AA, 0x5B3BA19134928, 0x4D8ED80B4C7A2, 0x15C35898DF6EA },
+    { 0x604C0404FB94C, 0x75A3F17DFA8CF, 0x7D8B24EACB48F, 0x1A606F8F5E54C, 0x2C171C82B4350, 0x0F64C0422FFEA, 0x5594B127AFB08, 0x7C61254D2F8C1, 0x2023B7064122C, 0x653C54559610B, 0x036796494B178, 0x29EB37463F616 } },
+  { { 0x0A1E2CBDAA1DC, 0x58072F735C442, 0x5EE837BAFFD13, 0x5932A914AF89E, 0x7DEE31EAD23A1, 0x78E7CB68FF03F, 0x3F0B80B48AE7D, 0x12ED46945BD39, 0x5EB5B611E8DC9, 0x4C215C87FF730, 0x767D7CCB742AD, 0x2455494898787 },
+    { 0x65A66566871B9, 0x0936FD10D73BC, 0x3880BBF1D4015, 0x7D4F60992F6B0, 0x2B2C9C9FFCE56, 0x6AEAEFCCE94B7, 0x0F4062D4F1F3A, 0x6A4EFBB7C9A4E, 0x5F5306609CF8B, 0x521B4B2EDCEB9, 0x651F05AB2E9E3, 0x18A9DE5667DDB },
+    { 0x337868CCC822E, 0x5D713FC685567, 0x6A495251D094E, 0x4F16D3D89E2E0, 0x251DEFB033E3E, 0x7BFC97911C6DA, 0x5A05493364850, 0x3F415BAF987C2, 0x1F37ADFCB9FE0, 0x629CB06DFC45B, 0x1B1128DC89289, 0x3F9733E3F1703 },
+    { 0x6BB0A1E68736D, 0x6456006EB2869, 0x210EA58670A5F, 0x270CC08153F4B, 0x7F1BA3022568C, 0x489D5A2748BE9, 0x04014FB72857F, 0x5DCBE43D68983, 0x3FC7915EDBA75, 0x417DB114F8F8D, 0x6CECD7A4FB161, 0x1D2F512932405 } },
+  { { 0x54C3664617DA9, 0x692E7A036BB22, 0x7EA35CCE4708B, 0x0265CBEA9B27A, 0x228222F5DC76F, 0x6FE6B3E5665E1, 0x6419BE798B3E9, 0x36AF5029D6D0F, 0x4250B3A14AFD4, 0x56B5503CCC6A6, 0x5A890D068E26C, 0x24135D5AD4634 },
+    { 0x00E1A38BE5F74, 0x1539DEB2CAE62, 0x52C77BA28E2E8, 0x711883AAAA9FD, 0x1BEF1E0D60DA5, 0x05D0BE8BDE300, 0x69F5597D4BD71, 0x06D88352F6141, 0x1A1599AB14D7A, 0x6FB8E4F2413CD, 0x4601ED3F01978, 0x1CF126644F029 },
+    { 0x6CCA2BAC4FA15, 0x57C0E3A395CE0, 0x0839CCB959AEB, 0x56CE7B38877C4, 0x4C4A58E735C20, 0x4ACD36A9A381A, 0x3CE15C7626E2A, 0x76C7009FC3978, 0x3AAC2DEE23F0F, 0x2469D53343A82, 0x4F5A9125C8955, 0x0B8845B4DBA35 },
+    { 0x2BBFCF9BA5758, 0x601C008BEE190, 0x7E7ACE0DACBE0, 0x6D20A1FCF6E72, 0x5F864DA8B4EF4, 0x13E94B5B2A20F, 0x30054F675FD92, 0x69D56AAFD70CC, 0x5D7EE315D0046, 0x3988EE1F3844E, 0x7D079BB71B6A9, 0x3176B67116BB2 } },
+  { { 0x5B6C01E62D8AD, 0x11911117F4F71, 0x54488B436404D, 0x11142CE6C86CC, 0x5B6ACFA797D81, 0x2F645FC376DA7, 0x7799C3942132C, 0x6BABBBB552378, 0x4DB06B609BE93, 0x18F4D83D879F9, 0x1DBFEFD333AC6, 0x0AFC2623F78DA },
+    { 0x292206AB054E3, 0x0A56E42FBA3B1, 0x68FEB02AF308A, 0x5635C023C2D92, 0x26268B73A6211, 0x0C10B581D10E5, 0x6921CCBB00C2C, 0x13BBBE8E7D41D, 0x3A425A1E3313F, 0x784CAA6E7BCB3, 0x155DBAE208BB1, 0x0D07E58A0C9F5 },
+    { 0x7FDB742DADEFB, 0x3775181B1F7F8, 0x7FB4EB181F26D, 0x2D274B6D47BFC, 0x428ADF3D2C1C0, 0x6AC905D21A86A, 0x616047DE4C645, 0x6B86DEB16D2F5, 0x0E50C0719556A, 0x041E985B35EBD, 0x379D1D8553F43, 0x25CDDFD80CB34 },
+    { 0x7EB9D0F353A19, 0x0A8C4F16BAD1C, 0x50E607B54F8DE, 0x7E91A263B2CA0, 0x23BB02A9153B3, 0x08D8872156B66, 0x339405261F8C4, 0x3AB3698929FB2, 0x395D12EC0F529, 0x7BD1AD1AA0F8A, 0x57CCB3F599A24, 0x269904FD5A54D } },
+  { { 0x5D2AD450E2F45, 0x3A80E16678258, 0x34D6A7FC40A37, 0x239A0CB0887D4, 0x1243DFF41E453, 0x33CB3C0925033, 0x76B91123E611C, 0x3E537D7EFD096, 0x6BF5571295F64, 0x151842398E5E2, 0x4D1EA95B10E84, 0x1F241ECD8AA75 },
+    { 0x637B3FAC064D2, 0x5FD6603B2F54F, 0x7C600F8E44B6A, 0x4B8A6F050A109, 0x1E79F7E718F3B, 0x50B56CE4A0C61, 0x726A061002A1D, 0x5105FD1764123, 0x22591277653C7, 0x45FEB72A57E24, 0x0AFF1BA884328, 0x15C1EF8B977A6 },
+    { 0x0914D6B78348B, 0x0D37D9CE46749, 0x59C45F071243E, 0x0064C5511F3F9, 0x77626678810AD, 0x3E626BBD50A45, 0x6666D80F3341B, 0x57DEF24F9FFF3, 0x3DBF20E62E4B0, 0x71CADC7C66E71, 0x781C61A7BD1E6, 0x2006B9016217D },
+    { 0x2523569B9D030, 0x6E484001D4225, 0x04B97F14538B1, 0x7625A8DB1CEAE, 0x75E77D90F8A7B, 0x1B704D91C8C17, 0x76B61CC0D54F5, 0x2BB344E3B32A5, 0x3EEF928AF69E5, 0x4276CA6B69122, 0x0D74572B3ADD4, 0x2FE7A900E7A7F } },
+  { { 0x589FAE4B66B42, 0x38586A185D08E, 0x5AC74EF56576A, 0x5FADDA55B77BC, 0x7949B9C1F7266, 0x070649910C58D, 0x14BF6852A5450, 0x4B493A7B32BEB, 0x1FCABA75CCB7F, 0x082D71985E5EC, 0x3E69FB5E06A78, 0x2376CF9749C4C },
+    { 0x0CAC03A3B40D1, 0x40E803CFD476C, 0x685CBEB6885FB, 0x2EB32C5D1A1D5, 0x1A91A9FA0273E, 0x7D9395CEEF6F6, 0x48794BF729FCE, 0x65D1E6E30AC7F, 0x051A36A656FA4, 0x4F31326B82D9E, 0x1B68E0C61BFE9, 0x097B7DCB9CD39 },
+    { 0x362CC7DEE72F2, 0x51CF04E39DED8, 0x4FA186E1CC6D1, 0x1B0F3337E8C6B, 0x7D083B77603D9, 0x59A11DBFAFAF7, 0x2357CC3525C73, 0x72AEA95F1CEA2, 0x50A47407F3112, 0x4624BAD393E31, 0x69617D75C3CFE, 0x27E251A6C63F8 },
+    { 0x7045FB6F23521, 0x00600949B74E4, 0x36AE830EFD6BF, 0x748F188648D24, 0x6F43A5D6A92EC, 0x6D48DA594A478, 0x52241E4A80E35, 0x6CD50D873F6AE, 0x087B02B30F2FC, 0x1629B4ACA76CB, 0x0213E58C5082F, 0x2FEFC1BEAEABC } },
+  { { 0x50CC27A519B00, 0x6751F228AD53A, 0x6AFF55C0DAD02, 0x2E9BEE3DF5AA7, 0x5260022D2CAEE, 0x4C57C4D973D96, 0x5C312566BE841, 0x6548508286F0F, 0x225831FF1F370, 0x59199916D562B, 0x416331C1E0BC0, 0x28A8F375C6A40 },
+    { 0x7EA00FF17674D, 0x188D3851A76B3, 0x1CA74C6676D71, 0x69089C9B11D3B, 0x5FF4D527E2184, 0x5622FF6175873, 0x6DD6228F3EE55, 0x0CB792C3D78ED, 0x762B6706FCCDB, 0x55CE3C7765452, 0x1F394F9D31FC0, 0x1AB16A4A2F24B },
+    { 0x3C64D9F4C89D2, 0x0A9A7E115EA0E, 0x4FB95F39F1C18, 0x70CA79C3126D3, 0x016278D788F88, 0x70BB151E4C818, 0x2C01C4BCF07DD, 0x30727BA12C385, 0x13025A069A671, 0x4EA3C4601EE94, 0x63DC89130B7E6, 0x111252E2928F0 },
+    { 0x285A414143A09, 0x08F237D442D01, 0x2A6A5CC374F5D, 0x01D92F5075F86, 0x3991B0B05ABE7, 0x4FB23D389F56E, 0x447A6B8817419, 0x2B58318EAE897, 0x0BB137C57D5D3, 0x66384FB886F44, 0x15FB6126B274B, 0x2E890B1FF8595 } },
+  { { 0x79E0C648CA8AC, 0x095AF3271EBF8, 0x0520D0B52AE3C, 0x04AA85129B441, 0x0BA39F5DA1EBB, 0x7DAA57D8620B3, 0x200889096D005, 0x265377CFFE404, 0x3E819874D035F, 0x4E94DF9E2D7EA, 0x24D6010700F61, 0x15125744D5424 },
+    { 0x1FB643B4938B7, 0x495EB850DF8CE, 0x320FBF020F634, 0x0D27B57EEF38B, 0x7D5F179E38EF8, 0x7740346EB8916, 0x3389883A6AC12, 0x74D0EC6EFE489, 0x269DC8807632E, 0x3D50F41094E95, 0x4397FD40AE4B2, 0x13C8224A4F4BD },
+    { 0x6DA0E8458B5C0, 0x14E56CE0AB108, 0x46CF0AD6E11F7, 0x7A3A9AE13E7DA, 0x06A3FE2899DC6, 0x3FAA43CB98C2F, 0x247B71F2102D8, 0x178DC71095E49, 0x42F097F8977AF, 0x5AD99021163BD, 0x6E11B28883209, 0x2BB7A79A50A09 },
+    { 0x2FEC66A2FD55F, 0x6F45B529E714D, 0x2C4EFB3840641, 0x4EEB1B1991A2D, 0x27711EC71189F, 0x15B23E447844B, 0x08066401E07A1, 0x7C30A40A87AC1, 0x081B843038CE8, 0x4E4D057704410, 0x2A5A224776B93, 0x16DCC42B37659 } },
+  { { 0x42517AF775A0F, 0x7F36AF872FEE1, 0x03EEE8E393BE0, 0x74282F5C044FD, 0x59DE5A6653E7E, 0x10A27FF8FF853, 0x2C3CBD666F733, 0x5502AFB64086A, 0x7CE060EFE8675, 0x3F18DE1F11FD0, 0x38FD193392D13, 0x189B17734EBDF },
+    { 0x781D317927F81, 0x6EB9B548442FD, 0x3737E2D4C012C, 0x2A08CFDDAACA2, 0x76EEC54EE07D7, 0x082E3AE02E538, 0x306124B30EE91, 0x7CB8AF250F603, 0x0EC160A3A2387, 0x08550BB50CD58, 0x55CA67F4A08AB, 0x1174C405396C0 },
+    { 0x79BF4F00AE501, 0x5946FE76CAB07, 0x62C1A5C3A689A, 0x1A92A174CFFCF, 0x74517C03E1271, 0x3C7F151394077, 0x7C9B1248C639C, 0x6A506F5CD15FE, 0x097CD65820243, 0x1685E8B960993, 0x4629B91370176, 0x295D22BD29601 },
+    { 0x1181FB895319B, 0x4DF0A4B65DF28, 0x5EE63C943EF8D, 0x444C48B9829B0, 0x373BFD74054EA, 0x45C23EC5AF1FD, 0x581212C0AE727, 0x45A5DBB3B222A, 0x2616EEEFBC58E, 0x3B5390465F3F2, 0x13CDB74C003D8, 0x1AEDE861C411C } },
+  { { 0x7509AD11DF699, 0x4F34F48A9DAC9, 0x2EF0FAF8F1884, 0x1C238D5DEB97B, 0x7485C6D05D83F, 0x4279934F0AF6A, 0x310F468350C97, 0x278770385B1E6, 0x2287318073258, 0x7EB1ADA3C17A3, 0x006A1C17657B6, 0x304FAD2983E5A },
+    { 0x47CA60C3A0D5B, 0x68050A26D3292, 0x3BEC87ACB7295, 0x4BC049C30D500, 0x73403B520424F, 0x19388B7938313, 0x1991F9D1120CF, 0x22F86F4AB8CE5, 0x23A9863E3D959, 0x2E4FED5D8CBF5, 0x56E07C8457087, 0x0A9F0F54AD4D8 },
+    { 0x1C5BE67A97847, 0x36DD3B611ABF6, 0x29AF90F8B1475, 0x793A32C2AE22B, 0x6BD8ED96D0178, 0x57BE626F3FBF1, 0x0C6898F6A0474, 0x5A4AC668CFFC9, 0x325D9A4BEC9D0, 0x46D5ABF0199DA, 0x372337BC32821, 0x32260076A252D },
+    { 0x7DA6AEB4B1B87, 0x721619F67A405, 0x54CF96C04DFA0, 0x7B8E71830BE8C, 0x3896C80ACDCD8, 0x1AD55B3C7AAC7, 0x3D3F38D8C4376, 0x5068DCE8F5CB9, 0x0F48E6F604A27, 0x47B6FB54ED58E, 0x4BDC3B245B0B6, 0x29D4A79AD6411 } },
+  { { 0x40E2888D4E01C, 0x1A0339A9C10F4, 0x0431E9783DE7D, 0x4DB479B7A48B1, 0x128F7B8A241C0, 0x24AAAAE4361F5, 0x703C3995260C4, 0x298179D1DDCE6, 0x41FAE9AC35B32, 0x0311110F82F95, 0x543D488025183, 0x46142C8C4970A },
+    { 0x7B4F901E1A398, 0x46D97114CD108, 0x73ECFF756D15E, 0x4C71C235A860D, 0x69F798CE9E7C9, 0x71899FD68300F, 0x38E38298C93E1, 0x6EB59A5FAEBB6, 0x2D45F83C7B217, 0x582EE80DFA7F6, 0x3FF36E0728169, 0x21DF73072E30D },
+    { 0x2DC60B06A9B8E, 0x282960B023B8A, 0x48A31130D8013, 0x485616C742729, 0x08664224B3ED7, 0x7045304C00BAE, 0x7736AF8C56D77, 0x2C25E8C715315, 0x400B1A1757838, 0x1FF70642B220B, 0x49CFC87EA7A51, 0x2192ABD418C78 },
+    { 0x64CC6D27178C0, 0x70F2D970B3046, 0x51F7BD0121C7D, 0x6F3BB5C59C4AC, 0x699BFDB662D4E, 0x3BC36082425A8, 0x49EDEFB230A59, 0x18F0839FDC8F5, 0x6E805051CD693, 0x4707451B3AC1F, 0x57F224982F683, 0x27BC5D2A45D86 } },
+  { { 0x59268593D17E4, 0x28E3A4DFD595A, 0x42D6096BA3995, 0x467424D11FD77, 0x1897B5308C7D7, 0x656D41667D337, 0x4F527BA471F5F, 0x49967E3B1EEA6, 0x2CC1B5E48944B, 0x0FEC6DE98DD40, 0x6C16CBF50981F, 0x35DE081DB209C },
+    { 0x14BBF90A1DA0D, 0x720DBE0E7D8A2, 0x68C256CCFB829, 0x60C22A3360ACF, 0x5BDCDF214CA30, 0x629E91CA0CCE5, 0x314EAFB1E991C, 0x56B505B6A4B48, 0x6F9A646F8829F, 0x59B46EF25D5CB, 0x72E722C8BEE8F, 0x1935416B807AE },
+    { 0x40249DEB67B00, 0x12E49C7EF7B08, 0x681407877D034, 0x01DD12CDFE207, 0x7DEEF72B4E238, 0x0B6B9CCE88244, 0x1CDA2F6F7EFAA, 0x10CF9EDB9A585, 0x6E9BD5A466E82, 0x17CD47F7F3B3D, 0x00826EC9D7359, 0x1501F618978C4 },
+    { 0x7851C7221222D, 0x62111FC9691C8, 0x1EE5C1B242E54, 0x61FAD89913315, 0x7A627154ADBC1, 0x2AAF139613F12, 0x1740C0A7C8DCD, 0x303421D108DA8, 0x72ADA78B86EC4, 0x53DC2E3C3C9EB, 0x46E6E0255C51A, 0x30FC9D07355C9 } },
+  { { 0x720F897F60FC5, 0x723B9614CB58C, 0x3DC1E31587D8D, 0x2285EE1189297, 0x7398A027A6F29, 0x3553DE2A23BBB, 0x69526BB57A957, 0x5F1BD1591E8F8, 0x32EF239E17903, 0x14247FF6DF4E9, 0x1FE91971B96C4, 0x3A8D20EE35EEE },
+    { 0x506D397621AD8, 0x394279699C1EC, 0x7DEF01C821EC2, 0x2A2EC55DCB5EF, 0x7476450B6BD6A, 0x6996002B04D08, 0x706A1872F2473, 0x4949AE86A4CCB, 0x72E3C71932F9F, 0x1EE70D394AB0E, 0x30C7B4CB7A255, 0x1A71064048A3A },
+    { 0x17B9DB7FFE783, 0x65B48E9B1D4B1, 0x6505B2243C036, 0x022AC491F2FA8, 0x69ECCE7DE7E62, 0x1CE5204DDF048, 0x77955082775D5, 0x292A21C0EB211, 0x4F51757C3AFAF, 0x70D23A9096432, 0x218D8E1BC3431, 0x1698CDBB80F45 },
+    { 0x01FAEB7C77E1C, 0x7E2D0B5F28AE5, 0x2BD00F207B632, 0x558DCE681BE9B, 0x478ED286034A1, 0x69B24A2A6754E, 0x5C1F015B12320, 0x5CC1308C18BD2, 0x59CC67CD4EDF9, 0x6CACDC59D4ECB, 0x57A314768D0F8, 0x2F477416665C5 } },
+  { { 0x3114716AF7C01, 0x712D37A67090D, 0x05B139DDE68CC, 0x48FD3104E9A3B, 0x2B79C2BF0EF09, 0x2D19E2F180587, 0x33FE744E748F2, 0x40EA09877A661, 0x0F571594B5918, 0x5D4F8469609FB, 0x281EAFCCCC73B, 0x1BC11C81E7942 },
+    { 0x7F3B2DF9319C1, 0x1D30D75BBA41C, 0x78C19C6417B3F, 0x67BC0D1CBC4DA, 0x65D6B0106721F, 0x192881F811DAF, 0x6913BBFDE636C, 0x04D8D3FA69873, 0x2FA08ECAAF534, 0x09B5BE35D1B9D, 0x212EFAF0CFB46, 0x1DBC290BB905E },
+    { 0x158DD6C3A9CA9, 0x3074DB7A226A9, 0x149931D110F29, 0x72BF02EF60E41, 0x7B15B0E70F596, 0x2B6FBFD7B44CA, 0x1A48142E523F6, 0x105CDD73E618D, 0x25F4D013ED3AE, 0x23E2884B540EF, 0x2ED4B0A6F52FA, 0x21F836B5DA602 },
+    { 0x7E34609266C9D, 0x585EE44083A97, 0x1E131B4B6F9DC, 0x5ED3B798AC9B5, 0x510ABD93BA914, 0x58E40C4F867F7, 0x68BD5F5174935, 0x0F385FE11686D, 0x19578EA6A36D1, 0x499D84BF16229, 0x3D435F6FBD578, 0x319C915C5A090 } },
+  { { 0x12BC2BDC79954, 0x482E82AF630F7, 0x095615B3766D0, 0x37903E2B5FA66, 0x03FFA9407E8DB, 0x5BFFC81829B3D, 0x67FD9BD928D3B, 0x24A91954E13EC, 0x46B35942E1485, 0x65F990F3239B2, 0x3E92E29C9A6A4, 0x112E5D8E272B3 },
+    { 0x38D1301FF70BF, 0x6F9C775E20556, 0x4C6C5CA7F3CFE, 0x72A176ED6E43A, 0x4F0210A5F5D1E, 0x2F9409DEFC4C3, 0x1B2119B9E145D, 0x14A4E9BEE2D0B, 0x60965CBD64620, 0x4251CD86021C0, 0x794E6587637CF, 0x080213D37A53D },
+    { 0x4C37561B87008, 0x2AD37F45589CB, 0x56D4576B05739, 0x26415D0867771, 0x5177D9689FE38, 0x1AD610CD4B7EC, 0x350F8DD3B1A39, 0x0948F497837D1, 0x05241E84E5755, 0x73B1351C1C8A0, 0x75FA7CC9ECB92, 0x32E6762B50DF7 },
+    { 0x61A18C4C8044D, 0x27FDC3A5BE6BB, 0x7BA8533F83B4C, 0x0E3EEF93FEA3C, 0x62938EDB16E52, 0x467C6EC643D60, 0x21480F34C2A58, 0x2E8BC31D93EC8, 0x30EC65DF75293, 0x6A1A26E6A8BD1, 0x1F62652DF1288, 0x2619825A98BDB } },
+  { { 0x33231F09A0F0C, 0x59E56A958DEF1, 0x311B0553BE7C7, 0x48FF0B8F92FC0, 0x343B8AF806974, 0x4A3FB454A10BC, 0x2EAA63C6DEF57, 0x0C1D6C2CAF1DC, 0x0FABCCF8E1E81, 0x1646447E936A5, 0x61E8F08DA52D4, 0x1970B12BB6188 },
+    { 0x3B47FB312A2BC, 0x59DC990FE9872, 0x5303388CABFF0, 0x1DABBA38F91BC, 0x16F90DB2F690D, 0x52C5B08DEC04E, 0x1D04053EC190D, 0x0B0C036101FEF, 0x12997099D0C8B, 0x169934F0325F8, 0x6EDF3077A48A2, 0x1E2B637FB498F },
+    { 0x2719401203CCE, 0x68D9B2D4D4FC4, 0x7138962FD6CAD, 0x4CE92B027B93D, 0x7A83DBA0AF5D1, 0x45DF8E4D5F87C, 0x3FDFEF5F4A57B, 0x1661DA66028C7, 0x28B71BB979A22, 0x5996FDDD8CDDF, 0x69E2A7B260B3A, 0x35329741AE20A },
+    { 0x2897C257B3810, 0x16100EBE93104, 0x3ABC544E61F14, 0x40716A5572E27, 0x58FE1BEED6553, 0x677F83C4B3BBF, 0x05599FEDA72EF, 0x51D9845BF2719, 0x0A0AC33CE6A6C, 0x02D68A3E71F09, 0x39F3A9402A159, 0x28996221BC0F1 } },
+  { { 0x2B6034EFBA881, 0x54BB4BB6FF6E4, 0x18E8A406B4134, 0x0A5580D145C1F, 0x0AF3818DFAAA2, 0x1764C529F6476, 0x23DA6EF19F07E, 0x353492D272D0E, 0x6EB4E7F389E2D, 0x2016B0ABCA29F, 0x1262AE47FF672, 0x34A5C0EDE5052 },
+    { 0x58B67CFF52981, 0x1BCB2FEE226DF, 0x0F9866119BF9B, 0x190370641EA73, 0x30AAC07DBAEDA, 0x1CF5EE6B30534, 0x668E477939381, 0x765A0812FC669, 0x47C919F81AB70, 0x4AAC32F9C7F83, 0x3CA308E946DEE, 0x06625FD192E0A },
+    { 0x5250ED1CB1CD5, 0x63321D3FD0C6D, 0x141FB88604A0C, 0x285C5EC301D2A, 0x56E01DB1BC124, 0x458FFD45EA66F, 0x31F3B7DB4A992, 0x0145C45842A8C, 0x5BB55DACA6EC4, 0x0AD55AAEF9DA9, 0x27ADD24E22D68, 0x25DC49DE8DD76 },
+    { 0x2A5541A35A185, 0x41ED73610A5B5, 0x4BB88C633C008, 0x1BB14AC255BF3, 0x442C52190C48F, 0x4F60FB7A8D558, 0x19352BE74797F, 0x5D63D06351785, 0x1B28451045B99, 0x513F5E43663E0, 0x72DEA9A9880E9, 0x253925CA69E34 } },
+  { { 0x599813FFCFB37, 0x47DFD4B46CCF6, 0x098A574588BC1, 0x62590B08E108B, 0x16A910014C1E6, 0x74CFD5D3AA984, 0x5A0CFEAEA09A7, 0x131CE39FC7F48, 0x62EAF2B2D7AA4, 0x77E83B2FDA0F3, 0x19391493DFA31, 0x253BAFA4714A1 },
+    { 0x50E127D00AE15, 0x2D6B960AA7182, 0x3B5DC6F447E5F, 0x2E6583355A835, 0x79FE6F8279A3D, 0x204F565828390, 0x3208FC2B0C9C7, 0x74AB69B135354, 0x466F15A19C5F1, 0x57F267066FE92, 0x03B90D00AEBD8, 0x0E029F729C568 },
+    { 0x5CA67AEE527A5, 0x4CCCF4445F4A9, 0x03246C7900FA5, 0x406A91756C714, 0x5900B3AA324A3, 0x62021D7408CE7, 0x3A4A76D519F17, 0x6AA77678EC42D, 0x604A1B4B1FC0F, 0x75CC83BD6D3BE, 0x714D1E9D7BA92, 0x0AFD887FB9AAC },
+    { 0x1C2D1DE9E78FD, 0x0FB2DD69AE96E, 0x397CD3ED4939F, 0x35543DAD64114, 0x11CC66BCA936A, 0x64FC234701EAD, 0x35829A2E1364B, 0x5559D67302FBC, 0x19A83B791B8FB, 0x67846A227EBB6, 0x6CD0CB424F12A, 0x31DBDCA2EA422 } },
+  { { 0x175F5B0B40521, 0x52D640E6274F7, 0x7FEF17575DB5A, 0x5E215E8BAD1D4, 0x3E1C5B288C5C3, 0x2036EE16445B0, 0x2665EB1948FC9, 0x78E3BE98F8E01, 0x7AFE4FCFD14C5, 0x19EAB660EDB7A, 0x3940D68E840CD, 0x2CF738101D4A2 },
+    { 0x057674E988FDF, 0x53863D6572952, 0x72448E9575E77, 0x02CE7BA1C81A8, 0x26E43D8286CD9, 0x7E1EB1A425CE2, 0x687FDF8C9B671, 0x4A5BF22F960EB, 0x611AB4EF18EA3, 0x48E9684EA2D3E, 0x4EC4FE537CC66, 0x1C1CAFBBC7263 },
+    { 0x60C4D1B7AF509, 0x28AD8D157D561, 0x01D619FB468BC, 0x63DA327046FA5, 0x522D00767C709, 0x628702A958B47, 0x2EA5B954B95A8, 0x7A9A0F130B762, 0x3E8EE975BEFF5, 0x474F8EBDF1B32, 0x00F1295C053DB, 0x2B04033B2C7BD },
+    { 0x55B7510329D7F, 0x5DD90C9B5FF3F, 0x5B0CCCE705B73, 0x7D95302678E5C, 0x6A739DDFAE58E, 0x08BDAAC585A49, 0x17A14D45919E3, 0x6763F3ED231B9, 0x498D728401958, 0x195D75D05A324, 0x3F8E08C15334B, 0x298956C11EB82 } },
+  { { 0x18FF523EC55B3, 0x780257D565296, 0x52C120296C227, 0x239B2F6A7EF95, 0x763CCF5709C4E, 0x233459B740893, 0x45C5EB6E66D5F, 0x781439E1E04F4, 0x28AE183CDF1FF, 0x14B14583B000C, 0x07D754C9A67C0, 0x244DE1F295E03 },
+    { 0x276AC5EDD4D92, 0x4C99FC070D7DF, 0x22A25CD84F87F, 0x20D728DE79B46, 0x1CF4E7CA2FA70, 0x1238C5FF61C9D, 0x141ED026938F2, 0x7B30400A1E350, 0x63A4198B854EA, 0x63E23BD1BFE44, 0x37F099354D499, 0x209A255FA2806 },
+    { 0x1A04FBF147D13, 0x0DD10D05D7D0A, 0x08673D92B9276, 0x00D89DF5AA2DC, 0x1C2448A66985C, 0x20E7621E4EE5A, 0x50F04F180B862, 0x599EB007455AA, 0x588144BF5BF4B, 0x3F1B836B2093B, 0x07A59AB207237, 0x14F5E7311ECF2 },
+    { 0x0705306354E50, 0x29A4979ABD42D, 0x2C5E543BC1B5B, 0x2111CD3D19393, 0x46DC38AA9A8C1, 0x3CEE57754C8EB, 0x728390789BF92, 0x2F861B169A798, 0x57A563317935A, 0x3AFD57E98D3B7, 0x0099BF92CD143, 0x1D1EBDE64AE81 } },
+  { { 0x0EDFD5E185C3C, 0x0D61F0D3CC350, 0x296371AD43FEB, 0x58EA6095B542E, 0x6B323A0B8AA33, 0x113486181432F, 0x079CEAC6B400F, 0x06E46846F4A73, 0x5A35E58D66F6A, 0x29A6EA56F79D1, 0x68DFF27AC26B9, 0x231BD443DEAA1 },
+    { 0x3AC7FEC7D8F19, 0x4201C43F17A87, 0x2A74428A9242F, 0x2B3477C73CD22, 0x34D562C6D2494, 0x0BBBF846A9426, 0x7A6FD20BB57AF, 0x43DFC41A352F0, 0x76A27CE51E7EE, 0x761F48BEBFFB2, 0x09F41F38F5C13, 0x18664825A7AAB },
+    { 0x0A16EBF83EA8C, 0x67A9D44CEEABB, 0x7507E72384C57, 0x2DB5E88295AF7, 0x7D160659AA114, 0x295C5A7EC22D1, 0x16D3DEB532DF8, 0x64B4149948258, 0x0066EEEC3041A, 0x0ADB7ED88C091, 0x71763967BE7C0, 0x2E94A82AF559D },
+    { 0x6169089415B47, 0x6BBA4FE7F5B9C, 0x7AAB528B8C6A4, 0x2BEDD4D6314A4, 0x164EF43CA4BAE, 0x73D2D8A90BDE4, 0x4E82DECEC85A2, 0x2A8E962ADABFA, 0x627225B711B15, 0x0C9E540FF1DB2, 0x7AA4BC859BAED, 0x15F21FE55B46C } },
+  { { 0x22FA210348851, 0x4AFB1F441EF18, 0x443FBE29B695A, 0x3EE5C0788D613, 0x25265DBE5507E, 0x2C8DB62109CF6, 0x7BAEEE4B534A9, 0x2EB9E25E3E254, 0x649443F71B884, 0x6B13F91212330, 0x6401A1E5B79AE, 0x25FA821B9459A },
+    { 0x459C91368F915, 0x2E0CA7EB3E671, 0x67F3DC181E1E0, 0x5262C9BA2CA27, 0x7BA2315E864AC, 0x65A3224971D64, 0x0910AA599ACF4, 0x27DFF9D51BC6F, 0x2DDB75CD2FCC2, 0x5908CE50E9BE8, 0x4F6FC48F80718, 0x103990C2AEAEE },
+    { 0x19C28725F0BD3, 0x6E92AFA986A1F, 0x52FD9628106F1, 0x56508C4F9FA55, 0x7CE2E5147DFAA, 0x07EC20172C0B3, 0x30362A165748D, 0x6D3D8CD0CD319, 0x31BDCE3CA5718, 0x6634D93E598F1, 0x080474ACB64DF, 0x1E2CF97034F7F },
+    { 0x6D26FD0647CF9, 0x3696491B50791, 0x227B0CCE4E4DC, 0x0C27B05FB96CF, 0x281A5FC59AE1B, 0x2C9651E364ABA, 0x39DDCAAF555D2, 0x3E039AC49AF84, 0x50E3340973880, 0x372584524E33A, 0x533241B9222A7, 0x22086B3E9DFA6 } },
+  { { 0x08669C6D2E709, 0x1F613C84AC3C0, 0x4F5872BA0C063, 0x4F80895B7FC8C, 0x35F6839D315BB, 0x49BD5A6AA1FFF, 0x43CD7EE217A8B, 0x0E6EDA49FC850, 0x7906FBC53193C, 0x1BD5492752E25, 0x60FC82EBABE6B, 0x34C48E4273520 },
+    { 0x02FBA7299B767, 0x6963C4FEB225F, 0x680443F4222AA, 0x02AD5E17E2516, 0x581EA08DC659C, 0x5228F06292B4B, 0x6A3BF75D258BE, 0x66E2D2C839E03, 0x0E9245DB07FAB, 0x10984289AD352, 0x4E7FD3F19358E, 0x199DF03B0993E },
+    { 0x71538696F5B9F, 0x49F9B41BBE735, 0x4832AD5C5482B, 0x4F070D9F2C048, 0x3BE33D542CF7B, 0x47B5ED62EB6E5, 0x1C7C86806BF43, 0x6157CD1921379, 0x41803DF08E69D, 0x4FAFCDF2C0094, 0x2E647398929BF, 0x1754DFA5E8279 },
+    { 0x32C8920942AF9, 0x15EDBC9F5E1D0, 0x028EDEC4153F6, 0x590BD6759D14E, 0x774DDB2D81547, 0x2B55049F18019, 0x4F9C6765656C4, 0x5343E656782B4, 0x582B98A71249A, 0x17EB4FB31FFFE, 0x29937AB246DB2, 0x1D7969FB6F194 } },
+  { { 0x3EDAE2C409C5A, 0x1211521730611, 0x20CEB22D229E2, 0x5F2F191FC030C, 0x685087BA307BA, 0x33BC1A6828FAA, 0x7FC3DB71E1DC7, 0x2B6547249F892, 0x48E3F57190F3D, 0x134B5BC753470, 0x10BD142C7A74E, 0x27C3344AF4B3E },
+    { 0x3ED7CB70BD4B4, 0x24FB631992CAA, 0x44D379CBE8F7C, 0x43FDC06CEE82E, 0x4E0D327C47C38, 0x5CB0E105027D0, 0x27C14414BA2A2, 0x5DA51FCA3F5C3, 0x08ECE4AE01F52, 0x36C0A0C67F330, 0x1FE6061C03AD3, 0x127FC78CBA13C },
+    { 0x15BFAE9F61AD6, 0x5A0CC5512B788, 0x29FCB612AA76E, 0x390E54F30D264, 0x341709ADAB085, 0x429FFC1BE3A9E, 0x74555E36EF603, 0x4B6DBCF30A4D6, 0x3DABF6F451FEC, 0x6239575BCF22A, 0x3C3496E653579, 0x4C11FE42E40CD },
+    { 0x4EF63B06FECE8, 0x38D5846B7419D, 0x1E9C777EBE998, 0x16A3C68B9DABD, 0x05E06F74FF8AC, 0x32204AF0B754C, 0x0F1A3106C2E82, 0x67B65330F8CC7, 0x048A4CE62F6DD, 0x633F3723695F9, 0x724DA30C3C178, 0x2B04D606F2712 } },
+  { { 0x1AC8F7F165C3D, 0x4B7FEC1EC56CD, 0x493782BC161DE, 0x1C8FB133920F8, 0x704DE2071E1EC, 0x39ACF994535F9, 0x54B9E648BFF52, 0x7EAE6DBB7035B, 0x221CA3B9C9FE2, 0x7EABF8437E86D, 0x2DB9C9796EFA9, 0x0B00B262EA3A1 },
+    { 0x48F9F889419E8, 0x2BE0A94F48359, 0x004461F8AC454, 0x27B6B79B063E7, 0x3D564B1A3B820, 0x35606EBC48760, 0x470B485759DA9, 0x62F8CB7983113, 0x7828A49D4021C, 0x49318DCD61370, 0x770E8358B3E99, 0x152B0DDF37FC3 },
+    { 0x2BA5A3C05E4A9, 0x22C39099B9892, 0x4FE53D9DD914D, 0x29E7B9A0C25DE, 0x7C9C62142567E, 0x14301394F90BB, 0x6EF2E48E6F6D8, 0x0587DDF9CEF1D, 0x5F6139E280209, 0x31E604A584B2B, 0x4A4BF76D5D01A, 0x1F3145369D01D },
+    { 0x6FBE46DD5187C, 0x5CD2DEEF50BE7, 0x456EA91F36C66, 0x01FE7A14745FB, 0x57AE04AB5C122, 0x4AFA4AF1BB76F, 0x16D681B18CB7A, 0x0F9BDB2D98FC0, 0x3C990AEF65B09, 0x3EA34BEAEDD8C, 0x6710298D0130E, 0x2C44744794561 } },
+  { { 0x75DB5AAA76B71, 0x473BD95A4C0DE, 0x66979C34CBD27, 0x169469EB04E9B, 0x59A5614DB9AEF, 0x1828D3ACC3C9D, 0x7E5A6A811462C, 0x306984C29CC02, 0x457DDC220B316, 0x404971A8830CD, 0x2654B5881A2D2, 0x1E4994BCF79E1 },
+    { 0x1649A19F303C9, 0x40AF85FAB8097, 0x201B0388FCA1F, 0x1A9D77205A9CB, 0x1F1BA49F8D59E, 0x4653E648F6FAA, 0x69A059F73570B, 0x45E9C3FF83894, 0x743DB7CAF639C, 0x0183C29F2EF9A, 0x3EEDE713AB807, 0x1437887432475 },
+    { 0x48547B37FAC33, 0x5CDB63BFD05D1, 0x1CB3378EA9056, 0x1610AC8FE25E2, 0x33351895CB3F4, 0x742250B15AE7B, 0x349CB2F678263, 0x7E70EB937231A, 0x1C1FA61EEC25D, 0x606D0CE70D2B4, 0x6C1D4316587C2, 0x158A983721525 },
+    { 0x0EB21D9943759, 0x6B7DE368EA112, 0x68C6E648F3278, 0x5FA001714DF8D, 0x7B92BBB33D938, 0x7FA0AD56C77C2, 0x00BE470FB2C40, 0x6C8F6FCBF47CA, 0x68723513BCA3B, 0x64618C336ABC3, 0x6AE604C5CC748, 0x2B089C02A6F63 } },
+  { { 0x7D01759D58429, 0x1745603AB7DEE, 0x0BC247E3E127C, 0x7737382899DA6, 0x79BC1914E9800, 0x4A3EFF07EB5B4, 0x57F42AC4073C5, 0x45EC139E13DDC, 0x79A401D819E6F, 0x35D81696C23A7, 0x4B23D8BD2391D, 0x1667CB549858F },
+    { 0x4D1F83DE1011F, 0x62E773DEE8F63, 0x256417BCCF39A, 0x3FB5D344BA371, 0x4306096066DFB, 0x5AA287E080317, 0x6A8D531522228, 0x5BB11123C8A9F, 0x6B445D3A8725D, 0x3A643DAA7D62A, 0x2359C198D6D8D, 0x169A04951C5F0 },
+    { 0x16CF8D4A103DD, 0x6043CE756203D, 0x603D7270DCA52, 0x50707E2961C43, 0x529F9AFB93FA5, 0x1182B94E97F86, 0x5F0DE54318F7E, 0x0B4233FFAEAB2, 0x095B78E50E5C1, 0x5BDF98CBA7845, 0x70356B7ED1EC8, 0x1D1052165748D },
+    { 0x75ECEABA38451, 0x22894DC01E2D5, 0x1F0DFB02FBB6D, 0x36B578BD51B4D, 0x00BCA6C7326A6, 0x5DA1F8B19A1DA, 0x35EADC2A9CB48, 0x18209BDAC43BB, 0x42EDA24E1A4FF, 0x15B91BF86842C, 0x54042315F3702, 0x1578859B407D1 } },
+  { { 0x7B03F90E8C59D, 0x585AF04B1DF8D, 0x3EFAECFA12836, 0x41BE48094CFB6, 0x0F4ACB6B03B34, 0x787AA6FDC119D, 0x3427EA57CBCDD, 0x345249B302779, 0x3F1E7AD3BD0F0, 0x1DAA664B79246, 0x44F322DA99DC5, 0x2546A62AC7E79 },
+    { 0x35B6F211FF179, 0x15D710E5B0FD6, 0x764D7C751A7EF, 0x73967ED11B2C6, 0x1D8DB0E249245, 0x4CD0EEBFC9700, 0x59B6B259647AF, 0x497A4FFC428EA, 0x4D7FDC0DF8B5D, 0x17B57B167303B, 0x2A17A03877ED7, 0x1DFF892A3BF5F },
+    { 0x498FB704DBF1B, 0x2924A65F17F71, 0x7DD9DE7F082AD, 0x6025F07EC32E1, 0x600522992DCF5, 0x362578038B97B, 0x741A0FE8357B1, 0x3C6D8AE19F251, 0x6D83464BAC597, 0x61EF75AD11544, 0x2BC0E3ABEFB0C, 0x371423486E965 },
+    { 0x0985D572C7F89, 0x47010633A9FCD, 0x6003C3D3AA781, 0x0ADF5B2D78F5F, 0x29C893125A12A, 0x0680FDA78DC6B, 0x1DD0D32B085A4, 0x4F91381760C97, 0x16DB396A09E1B, 0x416E698814733, 0x3DC77120EC881, 0x1AB3A3BCDBA9C } },
+  { { 0x5612E432EAABA, 0x4AC8B99280F3C, 0x3070475F7D7E0, 0x4D1469E385E7B, 0x3496D9266B13E, 0x136CEE94D887C, 0x5A0CBB919F837, 0x2754751770913, 0x5F70FFCAEA6BB, 0x0A99DEB9C1488, 0x4F05A764A032F, 0x0F299C13B153D },
+    { 0x0D2EDE8B60156, 0x6B8934FF76ED7, 0x17D8DDA9AF158, 0x7F6DE92430619, 0x03567D735280B, 0x390E8F41F9147, 0x19060AAD576CF, 0x14D5AA6CCB62F, 0x0B7BE3E8820CC, 0x61AC68F781423, 0x2F8F66E7486AA, 0x2412855F46C89 },
+    { 0x7299693177692, 0x26FFCBF8E7B2A, 0x6A3ED1148E80A, 0x5034765AD88E8, 0x7AA975E167E7A, 0x001B75EA936C3, 0x29948D1637D0A, 0x11874F46E070F, 0x1DFEF8B3E5983, 0x264BACDC07D92, 0x196B2DE96F738, 0x22945AF09371A },
+    { 0x0F8077369694E, 0x130B8FDF2B511, 0x6247CD2C8B321, 0x7CBF7CF7065E9, 0x68B9C663EF5A3, 0x6C7EFB34099CF, 0x5CEEE6C15B4F8, 0x2EA9FD644CD54, 0x5CCE63CBD2C7B, 0x10283825436FE, 0x35DDF99022BA8, 0x3086CACE423B9 } },
+  { { 0x27D0C67E53B68, 0x57F7927C58BAE, 0x4253399AE3574, 0x2C88551601F82, 0x091DEAA211BE9, 0x3B73D566D9305, 0x52CB6AD683ACD, 0x72EC7D7F98AA3, 0x5C9C4A0C5535E, 0x7416DBEB058BE, 0x6B7857CA14D83, 0x2AB331E936C45 },
+    { 0x7A29284F9202B, 0x0BEB5EE0A2970, 0x09C535CC47DF2, 0x4081D088D886C, 0x114433DBD037A, 0x0EC3A6E8D277E, 0x4EA30129DB209, 0x5232BFF21F1E3, 0x1558FE950827E, 0x313EE115D6DEA, 0x08BE6962697B1, 0x1687D6E9B1C84 },
+    { 0x03B9471DD87EC, 0x0C7825674BB1C, 0x3CF6AD6F0E856, 0x5F0D4205CA960, 0x51327DBBA77E0, 0x2E9E786169F25, 0x3022AE133C5E1, 0x3352F44F2EA6B, 0x043D99CD3039C, 0x7B46EB6E85D3A, 0x70A0BF3E77EAF, 0x149945D2FF124 },
+    { 0x270269579E2C7, 0x6C7B27DD2DEE0, 0x433D14602496D, 0x748BF8C8DCB1A, 0x207460250CFB4, 0x0FE3165A55DFB, 0x29E1CB0CF6EC7, 0x2A0F1A29F7CD0, 0x61F74FEA6CA43, 0x44AB06B655243, 0x215AAEE74BF21, 0x2F6EAB3FF609D } },
+  { { 0x40DC35B2CCD69, 0x2EB76212FDA31, 0x669E6BD4D5024, 0x797B8C382A52D, 0x45B6704CDE3D5, 0x5DD07FC7E617C, 0x31660012F8307, 0x17A6F2CFF2953, 0x15AAA43841CFC, 0x41DFF20870DD3, 0x6AED2206BA848, 0x26DD36B159D12 },
+    { 0x7A9AF180FDDE7, 0x01A6FC604D257, 0x5BCB4067040A8, 0x583303A7438EC, 0x7F78A427F02B0, 0x00938C028DB4C, 0x09A902451ACE8, 0x6AEEF7ADEB1E7, 0x16A8DDA4DC3E6, 0x12EA7F692E610, 0x42A5E955F108F, 0x17CFC61EE2BDC },
+    { 0x42DBE524EA217, 0x5668ECC6E522C, 0x4430A3166BBC3, 0x2DFE630555294, 0x3ABC52466B19E, 0x6FF42D2D135C2, 0x195320415DCCA, 0x13CE695D8A718, 0x498D5D5AC65A1, 0x026670CCDDD74, 0x6747336AE0CB7, 0x2B3E283CE60CB },
+    { 0x3B36996DD9F95, 0x6071415EF8BA8, 0x2612A4226D744, 0x14C9409F313C7, 0x15C8D62619326, 0x210BBDD354C23, 0x5155648BE6F94, 0x046B39FD9DCF4, 0x144C97DAEBFCF, 0x35E4A12D3CFF1, 0x476AEA31294B7, 0x34784F3EE6512 } },
+  { { 0x4050A3753540E, 0x07B4AE8527D12, 0x5A066DCB2D70C, 0x16AE6922CD53C, 0x294025FA6044B, 0x02F4510B5599F, 0x7311D5F46CA15, 0x1D3610A76EA91, 0x5FDDD2962C529, 0x3286957525DAC, 0x49EE27A077A00, 0x31685342C3347 },
+    { 0x13F4DAB10F7DC, 0x77B0C8F157EF8, 0x074242AD24B50, 0x7254AF76BE96C, 0x58ADDAB9AE261, 0x595693D01111D, 0x7C106EFED4163, 0x2EA814791290A, 0x073379DC5B610, 0x224B736A876CA, 0x398409749DEE9, 0x113DB63D0F831 },
+    { 0x4A7AD1F676E56, 0x47D2BB98BCAF4, 0x21B96C8AA8904, 0x7347362575564, 0x3C855CBF0D6BB, 0x31D5AE241EE17, 0x0EFE3FBDDACF5, 0x1D3F595A67757, 0x5A0905375755E, 0x0536569615C9E, 0x0ECEC9D60EF2C, 0x0C046B21DE622 },
+    { 0x05FF1A4075568, 0x3DFACF2053094, 0x1D8616D0D1F75, 0x29C10F18C9924, 0x6CE749079E4D6, 0x70E2A9386970E, 0x1FC289FD103F3, 0x7E805DCE09CEA, 0x0E25B2543C425, 0x11B521B8A49E4, 0x0AAEC853F8BCB, 0x27223F844A384 } },
+  { { 0x560B0D700F86B, 0x09578AB985E07, 0x5BB1CED998FF9, 0x0C161CB9FE776, 0x7DF6D0816C640, 0x19F65281E78AD, 0x27ABF219764D6, 0x5A98B958B5E20, 0x768B20521B050, 0x1490DD7B6C045, 0x500FEE5C386B0, 0x29AC2B35913E6 },
+    { 0x552BD6EA67188, 0x3BBE2A2E1948F, 0x528F9B81D1A7D, 0x387D92C945957, 0x5918CE1B7AFD5, 0x73FFDFD429847, 0x7265D2B73CFE5, 0x6F1837E78BBB8, 0x0E5F2874B20E6, 0x79C79759429C4, 0x32A0194AF25B9, 0x11BA3CF0FFEBF },
+    { 0x232D3A5A58B07, 0x79FE8EE84DE66, 0x5EF50D2E7FD91, 0x0688BE3044F0F, 0x5716C93ABC6C7, 0x37FF2C8E0DE2C, 0x0D6FB655DE1A8, 0x7FE0B79EC8B2D, 0x2748ABF3733CF, 0x03976AFA2E958, 0x263189A206E16, 0x0C1F1094DCD0A },
+    { 0x12DB72E4CBD08, 0x0B93D63D83C5A, 0x54C6E08AA1A24, 0x542934B5A1374, 0x0CBBF2988520C, 0x7B3F3945946A7, 0x464539FF3A7BD, 0x0BE79BACBF05E, 0x636D4E0F15645, 0x780CA30A39648, 0x27D1B93FDC81F, 0x27F0E5DB74365 } },
+  { { 0x69D52FCA61C59, 0x57A72A95C96BF, 0x39A78AA8AF59F, 0x4F86545568E73, 0x52D04107F673A, 0x4B38D91C9BA65, 0x4DE266393FA53, 0x434B499F72FC9, 0x534E5D8BF364B, 0x5470D7FE592B1, 0x0F1699D1C4AF0, 0x2756E153C4C48 },
+    { 0x5DE2D4A341A24, 0x0179A616519A9, 0x70D76FB43F5C0, 0x7FE6F78C739FE, 0x2B6BE927658EE, 0x45857704C1E98, 0x6040659CED9F0, 0x5B5F3576BE414, 0x22A3CE50C6599, 0x6A0237CFF7883, 0x6BB26BDEDA6E7, 0x091C34A7A52E0 },
+    { 0x1C1D4BB95BCDB, 0x0C27245B3955E, 0x7A8DF80E9C17E, 0x44CD5B25C5BE5, 0x37D479E6E1968, 0x0ADDC05B07E79, 0x2084A697BAA60, 0x3B49830A0D7FC, 0x5B5F3B8F8A11D, 0x1FCAFDC9D1D6B, 0x692B66CC5B77E, 0x13C04D1C54218 },
+    { 0x415DAB8CFA4F0, 0x2091198686113, 0x068928680E2B7, 0x7D200EDABF466, 0x2A330B75CEFDB, 0x7825F954C3629, 0x52D2550C32ADC, 0x77156FAAE9CB0, 0x3F5575E8BCABF, 0x001394C25273F, 0x53A1B97FAECE5, 0x2BBE5BB50D9F3 } },
+  { { 0x283AAD53CBB73, 0x683D65212F044, 0x13E2A8BF888B5, 0x6B2BCE81AA863, 0x3A13C3B9169B9, 0x629EB98EACCBB, 0x11B06B9AD12C8, 0x14826095466A6, 0x32E659EE4E062, 0x5452837879FAD, 0x5472F8BBBA9D9, 0x30D11AC6933EF },
+    { 0x01F5A941DD9C3, 0x5AC29758B61D8, 0x7E92D04AB9A7A, 0x1D744B90CFD39, 0x0FD1FC2D8A0F5, 0x1F87A3E2B01F0, 0x67FEE4F6ACC1A, 0x195FADBF80D18, 0x111E9D7E07328, 0x327B70792016C, 0x384C59D61A6ED, 0x13BE7CEB584C5 },
+    { 0x474AD5A4D0DAF, 0x668CDA1524D3C, 0x21EE6050DA511, 0x708C7FB05C628, 0x6DD416946B145, 0x1CE3669C60C86, 0x12C291F5D8B5A, 0x22A2B71358C71, 0x21B516DFF5275, 0x526AFC3170881, 0x1233F6C48942E, 0x2F57D86F28CCB },
+    { 0x6D623BE743F79, 0x242DCECE8B4CA, 0x2C6EB41AB9648, 0x6B89E69B10567, 0x7CAE22F58799A, 0x501FB98988571, 0x3A565B5629AA5, 0x4320CE197BEE7, 0x53B2A7BB2D629, 0x1DF8B10C2F525, 0x110EDAFE220E9, 0x2B3F76CAC4248 } },
+  { { 0x7B6F2C67068E1, 0x77C8B80AC61E1, 0x7AC87F74C8DE0, 0x5D9E3CDE119DE, 0x69CB20C20E9D1, 0x0934F894D4BD7, 0x4B42A64F6B55E, 0x2F27479C8FAED, 0x4315DFD03D109, 0x46AFE91CF37B1, 0x375AD2CDD4F99, 0x2476E2EEA4C56 },
+    { 0x1DC8D159FFE96, 0x7D0A5A9056917, 0x45FD7AE16C313, 0x1381706B21A04, 0x2B1CC16D68394, 0x4DC4BAE5A0E94, 0x78BAE6EE514F6, 0x3A24BC9E1172B, 0x3E466E20802D6, 0x0EDCAFB7067A7, 0x7322E5A863949, 0x145EEE84D6A8A },
+    { 0x1E6270EA99CE9, 0x30B906D742E4F, 0x3BF3B15D1000D, 0x709CADEFC268C, 0x3C21A874DEEBB, 0x41A8EA75D18F9, 0x01CE3BA6F281F, 0x13108C656C747, 0x5F43151D0F130, 0x77E307AC25DB0, 0x74FDF41E8BE69, 0x07A4C6DC18741 },
+    { 0x7AAE6C4F99196, 0x1CE25E83E215D, 0x5F620B7866564, 0x19693793F02F8, 0x75F6FE5E22E58, 0x5FC1907C8DA3A, 0x7190211ECE3BA, 0x5AB35B8FC53D8, 0x59337E7B38517, 0x39B67F526A804, 0x6DC67FE7FF3F9, 0x197677A467497 } },
+  { { 0x627F8D6EFA410, 0x1687B66B9D504, 0x405B9E17B3BE1, 0x339777BD112A3, 0x4D7848318F58B, 0x32392F098387C, 0x1FCC5D32E898D, 0x7571A7EC0AE5C, 0x3DB0654CD7E7A, 0x0853B2529C8CB, 0x7D74D17D2B436, 0x30BC40F294902 },
+    { 0x06195E7B5F885, 0x766BF86843C39, 0x3DC99AB586C81, 0x23B86A55FFF1C, 0x2EEE9BF1D3711, 0x466423BCC3A72, 0x216ABD5B76E02, 0x3BBE159C91D22, 0x5809FC100CF73, 0x798C7C7E29813, 0x22676883630F8, 0x26190315ADDC4 },
+    { 0x2E089FF94978E, 0x3A3C6F1A4F6AE, 0x2BF4ED6CCE2DC, 0x47D2BA4E12287, 0x7F1E841183E0C, 0x50089459F9A55, 0x4ED36D39E7C44, 0x3C4EC941741AB, 0x576414DBFE5A8, 0x24EEA67CA5CFA, 0x1C01B0D6A7148, 0x236B2584FE10D },
+    { 0x57C83AD4C0AAB, 0x648A2AB64A94F, 0x25FC8DF33022A, 0x6683ECA340BD4, 0x292448DA7260C, 0x6FF883F5F9984, 0x68ECC76ED46E2, 0x7371035A72921, 0x048D60B9666ED, 0x2CC7D9BD06D2F, 0x775164F18A6DA, 0x24389562BC6FB } },
+  { { 0x0EA87DDD07426, 0x71A70D7CEF438, 0x776B49999F5A0, 0x367B837EA7152, 0x637D9DB6182BC, 0x13990A9F7E41A, 0x56CD41869889A, 0x342D09B5ABAAD, 0x7ACBF28BADD91, 0x270C831FFC983, 0x0012BDF1580C4, 0x391725CB847AC },
+    { 0x0DFBE26F423CE, 0x5FF2ADBD2F012, 0x161AF1EB3CBB9, 0x31A1A730D0226, 0x1AEB0769FCA9A, 0x1D8FD3C866B8F, 0x5306342CFFFB2, 0x0B97110F20DE2, 0x05F435BBA61A1, 0x092A961981F2E, 0x41C7B9BDB1BB2, 0x1DBFDB184B855 },
+    { 0x630850D057640, 0x0412333590674, 0x753F0A853E5E8, 0x2EAEE012BCC2A, 0x6AF2F918B943E, 0x2A4713DF0EE6C, 0x629E7D5694E5E, 0x760073D56A0E2, 0x6A551BA116FBF, 0x40D341EDCA14A, 0x55F7A36C704B9, 0x238C584331CF1 },
+    { 0x0E0F2D527B5C8, 0x3A9186D6513EB, 0x486AAB91F0C97, 0x3EE26CBE82AC6, 0x47CC96C8A1417, 0x68FA1A4F87BE3, 0x2B2178443B606, 0x29A8B1D3CFA51, 0x0F566A31A9791, 0x774DED1BB2E7A, 0x6CABB6382CF3D, 0x20F7108F00887 } },
+  { { 0x17C666CA9AF7F, 0x1A4B9D031EAC8, 0x7481FD9349B8E, 0x57038E0AA9175, 0x1C7A900B24DDE, 0x34E6B99E458FA, 0x7EBCD1E8C55AA, 0x104283508FABA, 0x3CDEAA7785C3B, 0x7A6618CB9C13C, 0x5D36FB61ED004, 0x1438E6E065AB5 },
+    { 0x42045D690FBFB, 0x252EB1192FB71, 0x0DB04018267B4, 0x2057E5958613B, 0x555BBF82E11B0, 0x67E3A04202E88, 0x59C8949F05995, 0x6987F5DA08358, 0x417F11303C6EC, 0x4C0338A607450, 0x3C4D3E78176DF, 0x1DE93AEEE6895 },
+    { 0x104191B370911, 0x6B82036ED6D22, 0x5994BE0E843C2, 0x35D7B2C1DD5A7, 0x26D9497C497AF, 0x4F038E08540A6, 0x03CF7BE84ECB6, 0x142BA7556A05D, 0x5D1B73B8AA03F, 0x2D09A6F108474, 0x3A3535556BECB, 0x367262AF4525D },
+    { 0x69AFE161283AB, 0x6400F1B91E954, 0x60627716DF9A6, 0x0A2923763227B, 0x0BB60A2CD0AF1, 0x15C07B757458F, 0x3E0431984F0DB, 0x42178636415D9, 0x2EEC4DBE57DAC, 0x34C6D0F6C7DAC, 0x09EE158CF3085, 0x1BBF83A2E78C4 } },
+  { { 0x0D7364062E2BE, 0x7A808AB09A655, 0x5F901E3B4DE50, 0x516CFF1BA3CB5, 0x787EB5CA68AFF, 0x6B98F286298F9, 0x1AB4E28B11DE5, 0x46888D8796E6B, 0x0C6011CCE8CEE, 0x747A6B5E87A00, 0x2193B3E2A9EC9, 0x2888D4D336A89 },
+    { 0x1EC61C17A9446, 0x40AAC9FE65ABD, 0x40A77D52B4D49, 0x2E7BE5915ED03, 0x418EA35163F34, 0x18403DEA73F42, 0x04F217F09090E, 0x62BEA3FA5126F, 0x131A50E5C491B, 0x6CCDCD5A3818F, 0x2C04EFFDAE709, 0x17BD2B0A164AF },
+    { 0x4D6CCB9F4B322, 0x4DA0F03A712EF, 0x2DA5DA4BBE6B2, 0x70270362D6E25, 0x2300B42CC47EA, 0x51552FAE0BC31, 0x5F717E9B4A2FF, 0x2030DD31EDB06, 0x78357A0045354, 0x351665FFEB29A, 0x27F389F4F30E9, 0x230D49A4D417D },
+    { 0x361634B313232, 0x13007AA40E855, 0x4A610EE551A57, 0x5788909B6DB16, 0x707D27E628252, 0x17DE24FC5CAC2, 0x083475F1313C8, 0x771A593EBEE68, 0x400E61F7BD225, 0x353ABD7FBDD74, 0x08DF8734FDC88, 0x1D692427CDF0D } },
+  { { 0x3689B63616A2C, 0x12A67572A50F2, 0x411EE1E89E2A6, 0x269420D722B98, 0x39C1B881FC0AF, 0x35F13E28536EB, 0x24535E6FB068A, 0x51058D89CE802, 0x4BAB530130915, 0x20347C258C462, 0x34284B5564FBB, 0x22E6AC0742BFB },
+    { 0x182FF0033484C, 0x2D403B7779462, 0x00E5CA28B47BA, 0x21E2AA71F9D92, 0x754D88C84624A, 0x1E727DA0CC376, 0x40988F9703329, 0x3DB8B1CB68384, 0x63877C2E5AF5D, 0x31A5A46CCB4FC, 0x35A46E84A5B56, 0x16188469FA0A8 },
+    { 0x6D4C846E1582E, 0x2EE6A7039660C, 0x1CB21C5528264, 0x5938E0845AD68, 0x656E564591ACF, 0x6670283288811, 0x307DEAA9E339F, 0x466E1024E3838, 0x76ED87F916BE4, 0x39C4D82A0FF34, 0x432FA53EA89C6, 0x0869151D72128 },
+    { 0x3448666E0F032, 0x147E00AF25639, 0x579CCF2FF113D, 0x2B452A85FE67A, 0x2A7C3981A0296, 0x76CF7495076F7, 0x4A1438F05F3D7, 0x51E63E5195EFD, 0x0A16F8C913951, 0x7B2AE02601190, 0x6EA6B96519CE5, 0x1B4C19FD931D0 } },
+  { { 0x3BEECD50C94B8, 0x0D3482277A6F5, 0x1DC6EAD3ACA2D, 0x0ED3AAA97A006, 0x3BC4593D19400, 0x6AEA18D3C561B, 0x3923B790EC337, 0x5FAEAA3CA02B7, 0x4E44BD73C832E, 0x28014A0E60291, 0x17BE984043E77, 0x2C2418579A7A5 },
+    { 0x65683C409D6A2, 0x63B2561644F45, 0x4EB6284DF5A2C, 0x17A4B69230A04, 0x5D075E189FF44, 0x249F20DB39CFB, 0x0CA274EAD74EF, 0x6946969835FE5, 0x034753B4E1929, 0x6533C265F4AD2, 0x58DEEF222BF89, 0x08F15DBC24648 },
+    { 0x5DC32E05785AC, 0x7F97668C057D4, 0x2E8C173E2BE37, 0x6B183D86A8E10, 0x5984C0F3F2518, 0x1523F2F90D484, 0x4A1324615565B, 0x52698CC5F93DF, 0x461221559D649, 0x04F941F081FAB, 0x634E72601F776, 0x2C85D8283487A },
+    { 0x2B2B5FE88D2B2, 0x75C1C42AE38E8, 0x1AD996AB9150D, 0x100342F7BA3D1, 0x2F877C46A12A2, 0x51FB6521B540F, 0x52A91FA0E154A, 0x2DF492F976042, 0x3B0B978238219, 0x15917D51FAEF9, 0x365FC9B641A8D, 0x238C7733B4040 } },
+  { { 0x06185DB786AB4, 0x1ADEDCC614C50, 0x3D3F56DF6B1A8, 0x108E82C0FB53F, 0x4030797411FFC, 0x225A111D79D9B, 0x374AF5F5941D9, 0x377141F4706BF, 0x106D7AA3EE9A2, 0x6280E61E8EB1E, 0x2754085E58E3B, 0x2A20CE805A152 },
+    { 0x4E4B8E75252FB, 0x5EC0851E86FDA, 0x304EFC0ED7486, 0x7FBCB2FC8A6F0, 0x43C3168BF993C, 0x41E857A606254, 0x00B879C362792, 0x2BC1100F94BD2, 0x7611BC2FB9921, 0x7F04ED8017FB0, 0x6CE1931E7E6EE, 0x0E46F03DD578F },
+    { 0x60857DB1B375A, 0x6794BCA82CD49, 0x1D312C5704702, 0x280294D1A8ACF, 0x24BE79E320C6F, 0x3439E5161C70A, 0x64DDAFE2E792F, 0x5129342887827, 0x5CC50D3D77784, 0x5D59EEC777607, 0x2F06ECB13D77F, 0x1FD3338E79CF6 },
+    { 0x7964F97BCE661, 0x733FBC838C4BB, 0x5735BC1658147, 0x7811C489F68C1, 0x42F5BEF35496F, 0x55DE4A780BA23, 0x18E422B653C56, 0x28209949A8780, 0x57F9FA045B1B0, 0x2D644FA6138B1, 0x0DF6B9372A4D9, 0x1D8CC0FA14FAD } },
+  { { 0x4CE9BE82F69A4, 0x28C569EE9A62E, 0x5F6969355223B, 0x63574686F2009, 0x30CF2F02ACEEE, 0x785551D9CA0F6, 0x5A4057343E57C, 0x074477C0944DF, 0x2801469274DC2, 0x41F79DC872CF1, 0x7CA1714AD912C, 0x421069425EB34 },
+    { 0x2DF9536A2F7F7, 0x41CF03029E390, 0x6378B3ADC66D8, 0x0827D604F151B, 0x0CA89A29FE345, 0x48CA1F38A93D3, 0x14E57BFC7A53A, 0x76769F9AA2F7E, 0x231DD8A5C78C9, 0x551C89020FAE8, 0x125827C40D6FE, 0x12FEA2E4538C9 },
+    { 0x615529A4F8034, 0x6F2807B128B3E, 0x03804AB273149, 0x3431EAB068AEF, 0x5865B47FDDD2B, 0x79B3DC70C24B1, 0x67F98C6286952, 0x29D44A1F26B2B, 0x7BF7B595EAF03, 0x75EC89E65D5B9, 0x29C14C2DD68AB, 0x34FB24A3D194F },
+    { 0x0CB841E5B9F75, 0x3CC8323DA2EC5, 0x367D20C470CD8, 0x6C2C7669651A8, 0x56D78775BBF18, 0x48576D396FB4F, 0x47E294554EBDA, 0x2C00A0CD4F962, 0x4A46D1911CD5A, 0x07E157BF34887, 0x25EBD0825B2BC, 0x2BCD4832360A6 } },
+  { { 0x6F8A954A8E461, 0x4C6B45DD6310B, 0x7DEC1B5B667F7, 0x526D63FFCF47C, 0x2BE33CA93F6EE, 0x1E5AD116949EA, 0x0E5C454B604A2, 0x5BE668BE18096, 0x026FA6F330C92, 0x2656595E93D68, 0x198A7375E1D4D, 0x2CF7F39176F36 },
+    { 0x497232711E263, 0x7C94ECE5AC697, 0x7505DBD32CDBC, 0x5CACB313E6B9E, 0x7BB1F365CCA4B, 0x6223514A3A20D, 0x010476EBA4F06, 0x4749BA70F7271, 0x532E296FF207E, 0x0DBDA783E9169, 0x0D50EDBA2AF70, 0x24EC06F24579C },
+    { 0x01772AD722913, 0x6F766A91DE13E, 0x1D77E72E54F90, 0x0D0F7C17387BA, 0x7033711F63639, 0x394DE196F9588, 0x5C99FF379DF0B, 0x7AD9E434B0920, 0x6BFBF40BE3412, 0x63B79806F9A6B, 0x4F99FB10F0AAE, 0x2A83CAC47C277 },
+    { 0x29D03B1F209CF, 0x0EBAF4D419100, 0x1A824A09D9AF1, 0x4F8B50793FAEC, 0x6FF0408E918EE, 0x55C649708A3EC, 0x6B9D35A919E12, 0x0A38EEF97CF68, 0x7874EBA362C24, 0x6F575BD989326, 0x385B205265C0F, 0x2AC4FC8DE3827 } },
+  { { 0x283B487339A82, 0x77BFF2001D7C4, 0x4662B6DC8DC5B, 0x65A80B1106EB6, 0x5FB0F71928D0E, 0x097EBE24F7D60, 0x261D3EC4EA756, 0x54737F2F7D819, 0x1665076D3D9F7, 0x718DEF2567E9C, 0x3767B096B60FB, 0x2892335189DEB },
+    { 0x0DDF8F83DADC7, 0x307F79EF5DDF2, 0x39D7042715526, 0x65E7B1F8D1CED, 0x624DBB6CB0F40, 0x0788F040137EB, 0x2B95B5376E8FB, 0x330FBF92DAEC1, 0x219DEEA573731, 0x3BD5540F2A7A6, 0x09A4CC2BAF2E3, 0x1407B1BE2CBB7 },
+    { 0x3C0EDF8D800DE, 0x0BBA29E9604D2, 0x114896CCDB55D, 0x64AF056405D21, 0x0867613BC3454, 0x331F6070C517D, 0x4AC5E32115D02, 0x019613537182F, 0x1BF517B3F8031, 0x424DAF45EA82E, 0x674217879A5C1, 0x2132A4F3FFECF },
+    { 0x4E5BA1CBAFE99, 0x19A95D1DC3572, 0x5E8DFA3C80E9B, 0x7FC00AA706822, 0x0849AF1B078CE, 0x4E69FEBA87E81, 0x3AE1FA7F60850, 0x6CDBAD4C35322, 0x776731A03E028, 0x68BD8A137C1AC, 0x28A381BC30594, 0x36FEE0634A759 } },
+  { { 0x116E0BB672F9D, 0x6D003522447F8, 0x3DDA9C63774DB, 0x3BBA84A3AD9F2, 0x7A589953B6789, 0x7AC215A093C61, 0x1A7404AF89562, 0x21D5BC79893FC, 0x7D091D0B54D13, 0x719BE5FDFCED4, 0x309A4D30DA3EC, 0x16DB04C6573CA },
+    { 0x1B2C0F142C267, 0x6B3AF304F26E2, 0x4C6C0FABA8371, 0x4C746FF3BF4B9, 0x157A197A4C057, 0x3A0EA20FFD39C, 0x5478A27E492F7, 0x088AAFF1AB600, 0x63D70EADF1DEC, 0x2B88FF8EEB278, 0x61F296B730F79, 0x02DA6F8A017E7 },
+    { 0x2733E14D444F9, 0x512EBB1412C76, 0x51AA9AD83F771, 0x064C4FD08411C, 0x327FB87098730, 0x66BE01B5F866E, 0x1E02C22027980, 0x3404CD0D4F475, 0x4AC20A142665F, 0x1BE49EF42CFB1, 0x2B66330DAC78B, 0x3D90C11BB33A3 },
+    { 0x5FAD792F8DABD, 0x007F33037E316, 0x48C42398092E0, 0x6A4C0479B7BD6, 0x2563A4E189453, 0x64C1BB7E311BB, 0x387D6C51BDC6F, 0x2852AD3CB2C76, 0x7ACA6D0806400, 0x692B43AA1DFFE, 0x68AD4FE67A808, 0x26E36905F5BD1 } },
+  { { 0x38E6A5A0E3D90, 0x7CB65AEC27060, 0x35C860DC704C1, 0x5A255EB73E849, 0x315C78B395E20, 0x116B3810BAA62, 0x05B90F9D32D5D, 0x6E053C2ECF6FD, 0x579ACDF6E7D5E, 0x0FEB08ADD31A5, 0x7ADB597277A8E, 0x279830C6B43DB },
+    { 0x0E7F2A3FE037C, 0x4819F86B2830D, 0x14205DFEAC308, 0x13C3B008BB3B4, 0x24360761113EA, 0x305C75CA03253, 0x38EC309FF1EC0, 0x2051907C7C8A1, 0x7379CB862D4B1, 0x02D80D85BEBD2, 0x754497BD4B548, 0x29BB370B70164 },
+    { 0x4B1E9341A4DBE, 0x32E7F28AEE64A, 0x52013179B380C, 0x48CA194F4E913, 0x33965F415179D, 0x77DE55B1FA9FF, 0x24F8E1ADF8FFA, 0x1161F032FC710, 0x6D0F6718915B2, 0x3D36836B44425, 0x4C05668E9C473, 0x42A9A8C2856A3 },
+    { 0x593C6BADAB20C, 0x6CDF49B95A745, 0x7205A9F4ECE59, 0x206307B76A9B9, 0x38208642CE85C, 0x6526EDB44ED84, 0x2922837D59DA3, 0x6489783B87C30, 0x642E092703E94, 0x5FD798FF76A62, 0x27E131BF9B7ED, 0x28584E414D110 } },
+  { { 0x40E5234663EBE, 0x205269D202FCB, 0x5F498E4459CD4, 0x310A7E6E9D4CE, 0x17FBE80618308, 0x41C0E834CD2FE, 0x31EE25FB906D3, 0x7D1D28FBE0246, 0x69834D93E9AAE, 0x5ECBB80A557EE, 0x6734DF2F628B9, 0x1D62639583E1D },
+    { 0x603446856ECD8, 0x5F318462EC003, 0x6DCF017A78C63, 0x56242026FC9D5, 0x2884C745719EB, 0x08BB99CAF29F4, 0x0119CF30AFA97, 0x3B35306220C3B, 0x13B20E4BB8833, 0x3899CC5F5D193, 0x2FEF440D9BCAC, 0x28C144837882C },
+    { 0x53950098B2B16, 0x089C8723FD6BA, 0x21492947E10C2, 0x28420B4319D30, 0x173F35ED6CEA2, 0x3B5FEB043F15D, 0x3559ACEB4CB58, 0x075AB30039D46, 0x4105FB5564343, 0x40166C3B05939, 0x1C7BB2D8EC320, 0x2CBBAE0FF25F0 },
+    { 0x007202D3A0944, 0x02CC4AF28885B, 0x54A2D9A34F115, 0x77F9B959E6C8C, 0x274763D9AC864, 0x39D0E8CCD0BDE, 0x2A05BF5713DAC, 0x757FDD37C1F02, 0x76C7B0C2F8F72, 0x676680D0701C6, 0x70460EF502597, 0x255B0B231E012 } },
+  { { 0x2C0684A28648A, 0x2A1478EFA06AE, 0x6E43E933D3CCE, 0x70597E9F430A5, 0x7E8EE9C033BF5, 0x413245978AAFA, 0x5E042FA54BB18, 0x29DD3904332B9, 0x724742841DC6C, 0x531534A9C5AB5, 0x479E7AB7E3A58, 0x10EF4DFAB38F6 },
+    { 0x34B19AE1C0DD2, 0x3B7C324A143F5, 0x379738E3AE483, 0x300FD5C62E191, 0x220E63496E474, 0x24AE71E1F68B4, 0x0CCB5DDD76857, 0x708F9E02A285D, 0x7E982B99EFD49, 0x3885CF9A86599, 0x0B8B7B45B2ED3, 0x1A87EFA31DA0C },
+    { 0x377766B92577C, 0x42C2FDC59C616, 0x3FCF38B09D036, 0x49BD6B9AC0F53, 0x20C830BCDD4ED, 0x2253153A1ED3C, 0x06299CAA724D1, 0x2C5E11928DADC, 0x4632F9713D744, 0x667C2DDA1080D, 0x024925937E2DB, 0x32F795364C46A },
+    { 0x5523122D74534, 0x50B9B79B7ACCE, 0x31CBEF9F8FAA3, 0x451D2C6167D6A, 0x09F018E1922F9, 0x710B935EB9E62, 0x78F56126505F4, 0x6AFB11376F110, 0x2E94AA2891437, 0x342309A47CB4A, 0x3484EE5CC8540, 0x2588B3C6A1963 } },
+  { { 0x301CB48C715AC, 0x3C1B61738567D, 0x3A29C52D95B1E, 0x5E1FCBAF3A105, 0x55FE83F74A2CE, 0x72E6C4E28B3E4, 0x20F23BF52EE42, 0x1CD9DB7A3495C, 0x4877882DB3FBD, 0x6F268F0DB7C49, 0x7E5A7373DF4DE, 0x2C02F2F87FBA1 },
+    { 0x1F6DDC597C9D1, 0x47C7BE3A6006C, 0x55FB063D49B54, 0x20C9EB6BB701B, 0x1E9811896285E, 0x0871944C65838, 0x005BBA56EE778, 0x474EE6152F4A5, 0x1B590CB714870, 0x054D309B229C5, 0x3DE15C8F005DD, 0x16B5BC144328A },
+    { 0x34F1D2035D098, 0x266F6C3D2B497, 0x245A868410FAB, 0x10776F04C8464, 0x1547A09F0C960, 0x5F01CE2622E95, 0x0F84433AB05E8, 0x4679095635343, 0x01476C1E3D92A, 0x4B9BDDE14F924, 0x10AE8C8657ACF, 0x1D40C18EF3CA1 },
+    { 0x3FD7F6D0E9BA7, 0x62E85BEF4E773, 0x48502B27285EA, 0x74638F2A41E67, 0x6FAF19AFFFE83, 0x1BA41108BE021, 0x401DDD3478FDB, 0x0531CC3A9139F, 0x5EFA0DB37EB7F, 0x5AACE409C85C6, 0x0DA8D2924BE8E, 0x1DA429CF16B3C } },
+  { { 0x206BBE3A5DD8F, 0x30C41AD99D200, 0x74EA1A85A27B1, 0x2B580833BC042, 0x3CA29B92612AB, 0x0CAE502899516, 0x573041E398DA7, 0x2698DE15E3D82, 0x580D679D71888, 0x48ADA6E243EF3, 0x213FED26C3D4A, 0x445F202B081E2 },
+    { 0x77946469B48AF, 0x16E8DB1EF246E, 0x28F6681413A9D, 0x666E8B282BDE1, 0x56DD834688255, 0x7359BC783FAC3, 0x69B49A9610F50, 0x4819AE11D8949, 0x2545F8CB96CB7, 0x25800979176B1, 0x36ECDF7DAE8D8, 0x2329D589B4983 },
+    { 0x0016593C99C53, 0x5608F2A7CF10E, 0x2D2D13856039D, 0x0A1AF838566AF, 0x60A4A0011B6DA, 0x2C8D376C93C03, 0x6BC0204EE7F3C, 0x695ED2B60182F, 0x482758ECFD3ED, 0x13D7360FDE86E, 0x6C757111947CB, 0x23F9817F97CF0 },
+    { 0x2AAE2C325E957, 0x70B784DEE7515, 0x4CAAAF9B19FC3, 0x392566761E5DF, 0x46A01767350F7, 0x1DDBBA5934C27, 0x70F781D00D00B, 0x79E851E1EA830, 0x3BB51C4E2B7CE, 0x70D46106340E0, 0x43D20B56FB5F8, 0x21183E6157B4D } },
+  { { 0x470B69865696F, 0x1A837099CFFC3, 0x539BE96BB4665, 0x40355135B0342, 0x7C51B9D228686, 0x44CB06E8102A5, 0x37CB95D128CC0, 0x5CB238D80D636, 0x06835C31F69C2, 0x7D8C8D3021C51, 0x14B6C9363435F, 0x20AC8553A40EF },
+    { 0x688CC7A78336A, 0x4980800C08133, 0x7CD4D9ACEFC91, 0x2BF7A8AC80F9B, 0x6BE7CA8669DF4, 0x28FD553B9B2F2, 0x64CEC8E44BC38, 0x26D43C5AFA6B3, 0x476C78998226E, 0x2FD9D7AED65AD, 0x3786CBB8108B2, 0x2431BA33ACD21 },
+    { 0x57EB3C3C9DD59, 0x56A48121018B1, 0x289BA06B7DF65, 0x2209D65653C71, 0x51CE67C264504, 0x0D86790B9F7A2, 0x07E6FD3F3B322, 0x28C14988F068C, 0x76E11920F74F3, 0x50C942C07FE5B, 0x0DE80289CED7B, 0x4454C3F91AF30 },
+    { 0x0BE8C8C525844, 0x0D316C5F3FEF1, 0x0D3A6D81237F8, 0x01AC8613485DC, 0x3D218BAEFDA14, 0x55FAE6E5F0BE1, 0x6AAE6C2F0CC51, 0x692B659B3B216, 0x0B28648C39634, 0x5BED62CEA9C48, 0x65D20C2DCED5D, 0x29E8515F55044 } },
+  { { 0x7D1D0D51B2254, 0x7C5C2254C0B61, 0x5430921CE5FB4, 0x0BFCEA87DA84B, 0x0003D6AC27898, 0x12EDF60AA864B, 0x711DB60F236D7, 0x2CD2D7311D1CF, 0x5EA3612364703, 0x0356C5E419DF8, 0x2D6ADBB3ACA54, 0x3FDB4E0DDA154 },
+    { 0x1B0BEFD16B938, 0x4630CCC2520B2, 0x31D31C9D82B34, 0x72932642493AF, 0x06099BBC8ECD0, 0x13A6A900AF06C, 0x78CBB4CC5B7D0, 0x7040B0231CA6A, 0x4A0F86DCD02D6, 0x43E068AD390EE, 0x451ABC036AA86, 0x162D1F1D24AF2 },
+    { 0x5A8F2DF805C14, 0x273804647F8AF, 0x7AE8FC9A91AD9, 0x4ECB4164282CB, 0x3EFDD10CBA0D5, 0x56158CCE2CBC5, 0x55CA35E24467C, 0x164C1A19D1E9F, 0x12CFD0AB96CEA, 0x1E8C0071C921D, 0x1AF552747C074, 0x24D49AB302B2C },
+    { 0x20404B8F2F73C, 0x4F708147777B2, 0x00EA086A08D3E, 0x611465ADC1EA9, 0x300946A43B19C, 0x19D633D2DA08C, 0x211CE8F96335C, 0x70F4484F0DB7A, 0x36B4A7683E47F, 0x738FC4F18FD0C, 0x255C6365F1368, 0x2F294FFCCA4E9 } },
+  { { 0x5A1EB63A0AC7A, 0x1643F01AC1309, 0x3BF421ECB9824, 0x66AAB18FFE06B, 0x60B1A3ED01761, 0x73E62C9863468, 0x52505FF0DBB91, 0x249BEB10D14CB, 0x693F707F32254, 0x4A97CEEB55D97, 0x66C2128A12DF3, 0x32012366CACEA },
+    { 0x6B8C0BF755FCD, 0x73EBC0F282FB6, 0x0F8BA3076ED4D, 0x5BA8CE3E3C639, 0x0068ADF2EAC9B, 0x273F4C805C617, 0x4F1A7285CD35E, 0x183C2BEFF8F7F, 0x2721C1829CF10, 0x4F89369FB8810, 0x3F95D3F8C1B54, 0x111E764DBEBD9 },
+    { 0x6D3A9B3D005FE, 0x1405C65AC82F9, 0x0D5FEEA3F6789, 0x2786CBA961330, 0x372B7A7F6793C, 0x317DFB205FCD7, 0x643CA190B74F9, 0x6CA20EEC49DF6, 0x28F4A83D79870, 0x286356C838C5B, 0x4A0209DDE7019, 0x3D6E2F835D252 },
+    { 0x66E95F2DC43D1, 0x38A8314CE3197, 0x3277862C03DD7, 0x3AAF7DE852106, 0x64F83B1F54770, 0x1C3222A34A6E9, 0x5C5A5D728619C, 0x37ECFEBB0AF35, 0x6811378F99C07, 0x369A316D9CF4A, 0x2CB8FBDB333A3, 0x37FFE352AAE7B } },
+  { { 0x2090BE2FF2126, 0x70A6E91E82BD1, 0x0E2DA5EF72516, 0x667C93C3E2377, 0x6F7A40EB15D0F, 0x1419CC2475B07, 0x17D2F17375350, 0x1209810C6D397, 0x70341CD5CCE89, 0x67E138A37D17F, 0x25C03EFD91A96, 0x133E86841E6B7 },
+    { 0x3AF766374D892, 0x4FE3B4156C9FA, 0x7C2FBEAB2BB8B, 0x4DA5901BF4126, 0x6A2D05F1B60DD, 0x47BCFA9A88862, 0x3008FD2B4E421, 0x6647C2C59794E, 0x26E6D1EC274A6, 0x77D2CA55A8F91, 0x30646C50514EF, 0x1C5FD404654F7 },
+    { 0x3AC62ECAD1B0E, 0x25A8A26E1AEDC, 0x3E2468FFEE6F1, 0x25AFAEFC400E4, 0x783F8AAABFE40, 0x28C5A1298F52E, 0x00147B57D0525, 0x410CE02F5139F, 0x4575473EFBCB1, 0x1279502B291A4, 0x1748BB3010098, 0x21E64BAED0B17 },
+    { 0x5A1C3B915A660, 0x177363760EEC8, 0x0FEBEEAD2FEAD, 0x409B5B15B6C6E, 0x4EB12C118DEF3, 0x245A9E5A936BD, 0x26CE233D1142E, 0x78097EE24BFBB, 0x08E5DF60549F1, 0x45E586E8FD09E, 0x17DD426E9BEF8, 0x3236CDF09F779 } },
+  { { 0x75768A119F194, 0x0049F75AFFE6F, 0x18EFBBC1F3760, 0x39D5C1AA43C3F, 0x2B2C87C19A710, 0x6E98282E4E220, 0x570EABD207C03, 0x5D82DD970B40E, 0x64882FAD06E49, 0x58446E787EDA6, 0x3350555BB7ADE, 0x21E6F88C9BA40 },
+    { 0x48932077A8B87, 0x12A4738920117, 0x00DC598907B96, 0x50708C8145CF9, 0x5980507636611, 0x78812967B7754, 0x557B55EA4E7A3, 0x206B820A20E7C, 0x673013EC623A6, 0x631D00CDD5BF4, 0x44554D8508F86, 0x14928D7DAD5DF },
+    { 0x49BF74995F008, 0x5EBC32276B229, 0x66D51B6EB818B, 0x0EE168B2C7F5F, 0x1334936955F4B, 0x052124EBAF966, 0x0D256D4B247A2, 0x7C203226EAF7C, 0x0600458A65763, 0x26E596CF0A306, 0x7E032E36C8A2A, 0x3B19D940C2A09 },
+    { 0x4E26EE310435B, 0x1F7E44362BA6E, 0x59F6F0BB574F1, 0x20EA5FE7682D6, 0x6448EC591A099, 0x18C7906AE8FAE, 0x18896A6DB99BD, 0x7F09803F95707, 0x46DF7D2A12822, 0x2A79774002973, 0x4E378F8DC3753, 0x363E4DCD1941D } },
+  { { 0x4E8D6ACF2E25F, 0x4273F93218F90, 0x44AB3E510B645, 0x24BD9AA1900ED, 0x225CFF4F1B13E, 0x56A6CD52E7DD3, 0x37E6D94374D7B, 0x52F65CA21E284, 0x11D2979951295, 0x004283BBCAE06, 0x25D178D1812DE, 0x15E219068B123 },
+    { 0x037D39BDC2D73, 0x1271BB357056D, 0x4706A4368BF49, 0x3F386B6BE3091, 0x591E7BCE6281C, 0x074B0B3DE45DD, 0x01CC82DACF398, 0x3208A36F93050, 0x7EF0342DCDC5C, 0x37E9EE5032DD8, 0x16C34CEEC54F0, 0x06114183A29D7 },
+    { 0x13A34BD05FCA1, 0x24D131AA8BB21, 0x70CCCABBED253, 0x4BA5A45C4E190, 0x653011F22FD04, 0x32B125F69D8B9, 0x64CE0F0D9F6FB, 0x1ED86814CD09B, 0x49F6BB6DE0BFA, 0x057E28D050605, 0x15B1AEE680E2C, 0x1296DCBEAC019 },
+    { 0x217D3B98A49A1, 0x1A73AD2CFF37C, 0x3B137C4D03E6F, 0x7066AC93956EB, 0x4BFB6597B8FF7, 0x1FC5A4455DF7B, 0x4C5715D0D054C, 0x149881C82797F, 0x26FECD38BF7F2, 0x13FC9B18F0392, 0x67C792F263C40, 0x25F30A67270B0 } },
+  { { 0x19813CC2BF68D, 0x6F46C1728DCA0, 0x1F5B2AE743BCC, 0x438A2D01954AD, 0x5149803B32B3C, 0x552CF00EB08FB, 0x61C6E908F47AA, 0x687F27CBC8BDA, 0x5DD2F96D54B67, 0x0875A4ABA02E9, 0x0BBF3B0FF9DB9, 0x082914B46241E },
+    { 0x23CC31C46DA33, 0x5B7CB1B78F463, 0x630404652CC81, 0x0BB91E0B9E94E, 0x0DF79681F031A, 0x25E5578A481B8, 0x3543A322CB621, 0x4577F037398F8, 0x79A70B69F7D1E, 0x2AA0AD90A6F58, 0x7521E27C4D859, 0x14D8FB07DF814 },
+    { 0x4C532FF12E00D, 0x570F4949EE5F5, 0x55194295DEAD9, 0x7B6CA3BC98AF6, 0x59826C7496E25, 0x7BC6A11200643, 0x66E346458050B, 0x45CC356F1731B, 0x46ADADB1A24DF, 0x7F5EEB749E9F0, 0x4A85BE91F7BD6, 0x2E3FABA1C6CC7 },
+    { 0x18BDADCB9C2CB, 0x12BBB1A851666, 0x019B812B78C76, 0x0A63B008A9965, 0x369F2FBF32101, 0x38FB7D529C0AB, 0x69506D45331E6, 0x509A4D82C1054, 0x4AE2DB5D69A77, 0x6468A01F23BE0, 0x10C1ED502A30A, 0x261E7B74CC752 } },
+  { { 0x24468D7A1A697, 0x6D19A82BA16D8, 0x0B4E89E202975, 0x4AB785360566F, 0x07AD9D9057DC8, 0x0813C0241CAD5, 0x208FDB64867E9, 0x413B7C18F787C, 0x1511FAE59E783, 0x629CEE0B7C089, 0x52EB8693FB11F, 0x18CB886715FB8 },
+    { 0x74CF03A44012C, 0x378AFCD766F65, 0x374E6631044DA, 0x4A858EF045F09, 0x399CE7350B976, 0x5503D5D6A2B34, 0x7E3B601860F98, 0x61CAC48410AC8, 0x30C94A5C04652, 0x413D7ACAA0A99, 0x4DC9CB526D10A, 0x0B9035BB8C32A },
+    { 0x5E16082BADEA3, 0x2CE049DAFB70B, 0x12DB93B4A159A, 0x4D1C2F2C851E5, 0x77BD0491A2F94, 0x1C799DDC9BA63, 0x53EA799D738CA, 0x084ED89689FD8, 0x327870DC21C8F, 0x751F4139C83A9, 0x21E68E1AA7861, 0x2404AEF301338 },
+    { 0x07621519F8D78, 0x19F504ECD9E56, 0x1444699A7196A, 0x78D5C74A3C581, 0x04CB009BE7D5B, 0x63E25465223CD, 0x2E731CB8DF767, 0x0480253DE1800, 0x06D779D4027AA, 0x60545B2898716, 0x0B512FCD12714, 0x26FFD613240A4 } },
+  { { 0x2570CFD4FCF7D, 0x344D1351C9666, 0x24BB37375C212, 0x561525948D638, 0x23CA76F7ABE1C, 0x447F77B257E42, 0x431BC2EE7F472, 0x7EBC76819BDA7, 0x2AF7776085377, 0x63E097AC0FB3B, 0x5ACB6C063E45D, 0x3BEC7BFF9B7F4 },
+    { 0x680888EA643FD, 0x485BA2F8A74B0, 0x305ADAFEC27DA, 0x34D034CFF6612, 0x6B184F7A61E1C, 0x3F4926307FA11, 0x76CA58AF50801, 0x14962C06CB43A, 0x24C183D86036E, 0x3228E394DBA55, 0x673332B4D1194, 0x10942E58893D2 },
+    { 0x2F586D65331E9, 0x0B18E7FE49B74, 0x24E7F578372F4, 0x24C874D752535, 0x5DDCDA4479927, 0x5140EBDFC32CF, 0x49ADDCFA24DB9, 0x1B7FA079A75E6, 0x2788FE920C814, 0x4AD6903EC1BAF, 0x322C438235F1A, 0x26A6FB992A72A },
+    { 0x2700F2B0D3989, 0x25AAE31B19755, 0x72A849D378050, 0x2FC82AF9EA286, 0x5496C67EE70B0, 0x636141306EAFA, 0x4CE9CC896CA96, 0x770D4FA8D6DCC, 0x60D74292054DA, 0x51772CA27B3A5, 0x45619760CE224, 0x32ABDC05560F6 } },
+  { { 0x59887169806C7, 0x1CEBB4507EAF7, 0x6A38BB07B07AA, 0x2FBC6B9086056, 0x688670CCDE5AC, 0x0406E15336AC9, 0x492D94CD5310A, 0x1B33DE9756170, 0x311589E0B1B26, 0x14AF5D75F94CF, 0x49CDA91A58385, 0x330D2D4A9F4D4 },
+    { 0x2C7D3D8C503D2, 0x064FF68DA50E8, 0x09EE8937317E3, 0x19147517169E3, 0x0378F4F45ABB3, 0x14E7431A98144, 0x4C250794ACBE4, 0x3BA969D29D486, 0x09975BD135497, 0x5F7D2C1CD7A3B, 0x4835E2162DF1D, 0x13098820B7F6A },
+    { 0x4C1AD1B187D9B, 0x66CB1433F2E3D, 0x6878A987C2A86, 0x5AB92B7DFE0F2, 0x0A33BC5F99EF5, 0x5C62B62890FC8, 0x1ADB279B5AD26, 0x7D98008DE0275, 0x7584CC4FC40AA, 0x2E64116461B55, 0x4CF5187E3D117, 0x107FF9BA9E186 },
+    { 0x3DAF0C86025E8, 0x3356A973FC7CD, 0x6E8A7FC2E40E3, 0x4BA34BF450B37, 0x1318D3C80CB58, 0x3A578903EA091, 0x02E7013BBB1A8, 0x0F0F8F65A0BC2, 0x1CD55EFBC17C2, 0x73B201443576B, 0x1F9BA31BF5543, 0x24DD6B429EC7A } },
+  { { 0x51BDFEDC5745E, 0x25893816ED67C, 0x685C5C310A93D, 0x7CD784AEB47DB, 0x0F0941487675B, 0x00589A14C0114, 0x660DFB191E5EB, 0x1D7BB7EC180AC, 0x33EBA333B6DCE, 0x640ECD64076F0, 0x0539BF87394F4, 0x1FE06D9E84518 },
+    { 0x157821AABC5BC, 0x4575DE750C7C2, 0x444E014A9093D, 0x71937CCAF2211, 0x390BDD8F0BE0B, 0x7766C285BDFC2, 0x0C6EEB7B927A6, 0x37C745131DEEA, 0x007B82293572F, 0x5EBFA04F99B43, 0x53109EC51975D, 0x09C09F060E2FA },
+    { 0x4E048C426B6E4, 0x218F494F425AC, 0x44A603F5DA1CF, 0x086A6EE216168, 0x0F2A50FFE1C3B, 0x4275C619C3418, 0x04C941C244928, 0x40C901584ACA7, 0x78E3BD4051FB5, 0x30E68B5947525, 0x69F19F01E7FD7, 0x3C86E0648FF35 },
+    { 0x5C566BC6C072E, 0x79CCDBBFC3760, 0x64233EAC2989A, 0x4B42BC180E80B, 0x04397C92C363C, 0x18475CA61F3A5, 0x4F9E0E8696327, 0x5CC61A188A77F, 0x2DD8E55FB9D8D, 0x128F74AB99A31, 0x31A16FD6D7E04, 0x22D89D816659C } },
+  { { 0x21E225458B734, 0x3DBB2A97019E0, 0x24DD97D157337, 0x36BF9C3315BA3, 0x536FCC1DB37CF, 0x6C819C376C8BC, 0x7EAE135772DE1, 0x5D5123A4EC686, 0x5EFFA40F15627, 0x4D13219D4C30E, 0x49E317B79EB89, 0x27E6583DE1CE9 },
+    { 0x3D84E632A8DE7, 0x3B2288978B7ED, 0x335F08EFA306E, 0x663BB3CD2BA51, 0x29465FD0C471B, 0x2BAE373645087, 0x5A3B204E8810E, 0x6BD97455B4984, 0x767F7AFB26CF1, 0x35986908BF09A, 0x1E78C36A1718F, 0x167FB0BBA3AD5 },
+    { 0x71B3B55D8595E, 0x1DA3E3D996F28, 0x538D336662D58, 0x06A16A12F55EC, 0x3BB24FC1C3270, 0x039AD8AF339DF, 0x241DE61B863D5, 0x3F9A5D87AD4BB, 0x5B26620714E25, 0x379FBFD6D132D, 0x190887D1B1E57, 0x02C3AB83D8DB1 },
+    { 0x3885151D4A9F1, 0x6A711B37FC2A6, 0x141CA70C22C78, 0x39735CDE477B5, 0x5F501A5DE664B, 0x26F0C627D5C8E, 0x4D5C17742DC58, 0x7697D4AFE3259, 0x65C90A7B18A01, 0x257F61684789A, 0x24B093401FD4A, 0x2DD2169711D93 } },
+  { { 0x65185B77FBB25, 0x4CF18BC7E1D59, 0x207AC02932B8C, 0x7D9ACC0086915, 0x352965885190E, 0x3588053D51790, 0x2CE1BEA5260B4, 0x57F17B95449E7, 0x32AE091B3BAEA, 0x13056A27C4E2B, 0x047E45C580F3F, 0x262CC405B0746 },
+    { 0x5DC58C9A09402, 0x4F7EC6188D8D1, 0x787970718D3E5, 0x37E01FFE14C15, 0x5762F9616F19D, 0x177B25039989A, 0x2BB48E92477DC, 0x7361318C5AAA0, 0x0C7A9BC11C5AE, 0x14296A24F81A4, 0x7E6C2B0F9CE02, 0x1367AA22B8F57 },
+    { 0x459EA7C415B09, 0x24760457F1C86, 0x3785DC203E0E8, 0x07BA1DFAE880B, 0x42E2D28CE82A9, 0x1A3655102BD65, 0x32C03F240700E, 0x60EF2A395FE49, 0x4E8D7E963B2DD, 0x78F4B55D53BE6, 0x7543CB4227EEE, 0x1F63A744F3F94 },
+    { 0x11DD072A628BA, 0x588CAEEF58EDF, 0x2C66C4D4B257F, 0x7B7DB80314D01, 0x3C58FF7A15F7E, 0x77927F3AC8E2F, 0x5DEC17C2DE997, 0x5E2BE720CC9AF, 0x1E3D1C7B796B7, 0x0FE1F0A9660C0, 0x77D9512819E2C, 0x2D692862BF37C } },
+  { { 0x0200FE639B1D1, 0x48AB5CF02F3D6, 0x1351C7AF3501A, 0x2DE29335CAB48, 0x22DC61510E038, 0x4184444F487A1, 0x5A284E2BCBFA9, 0x414FC840BD665, 0x4B7F3060B43CD, 0x2976BCA5B2745, 0x7E01A39971B40, 0x3B6ED8AE227F6 },
+    { 0x52EEE1749BA66, 0x7B0DE904AB007, 0x504AAFE86BAB4, 0x12B827CE00100, 0x00A674F42D9F0, 0x58635C0A3946D, 0x550CF13AA6188, 0x02B140A225280, 0x37A2980A103D8, 0x76B746D2776BB, 0x3054CD7656761, 0x1BAAFE2F9FA25 },
+    { 0x00E6722D25E47, 0x72A3A769DC289, 0x0E835AB0ECF51, 0x18C5E92F7DA03, 0x215254CE18ABE, 0x1E9C8FEA95090, 0x78DA025C0D55C, 0x4DB22CB7B10C8, 0x51BEC2AE1EA04, 0x7D99EED158A06, 0x726AA8B81AA17, 0x27B97F1B55F22 },
+    { 0x38999915041A2, 0x6B32B91B0BC9D, 0x22A2283200EB0, 0x7296C89E6BE84, 0x30CE1DC0CC826, 0x45CBF84D124D2, 0x5CB5D9BCC0670, 0x3FA5492C8B5FB, 0x503E06067BEA4, 0x55BDB081994FA, 0x392BC61C677DB, 0x34052AEE84D9A } },
+  { { 0x7703A9B391E09, 0x3AE0E1EAAD968, 0x5FF069BB3166B, 0x0CCF5B11619CB, 0x237E86A9C8A98, 0x51D8BD57AA970, 0x29538AA687158, 0x5E010B96F240C, 0x1382F92BDE206, 0x65FD31A0BC46E, 0x5A7CF49410FBE, 0x2A73B16490474 },
+    { 0x75996F17CFF66, 0x10FB78EBEB32B, 0x32B206AC1BFBE, 0x0A16D192EECC8, 0x24B72C358314F, 0x1E4E7279269FA, 0x1D9EF29326698, 0x2730EA9D466C7, 0x344C3ADE3C44D, 0x43420BABC9160, 0x4F9DDB756585B, 0x2149DB56BB941 },
+    { 0x2AB817FDF6B09, 0x38E601BDD904A, 0x57B4649C39EE1, 0x7A491E889CDB1, 0x15C46032C6010, 0x0AAAEACA42FB1, 0x357CC0EBFEFE0, 0x1FFB883CF596A, 0x569F8760681CE, 0x2F6C6D9855EA6, 0x31D01DBC2AC08, 0x2D0EFFDF0C454 },
+    { 0x45EFCBE006886, 0x40A56D51D509B, 0x2284CF1DF114E, 0x152E7B7EC8B10, 0x27107E1C9C65D, 0x72108C36B0481, 0x3053F526B8469, 0x6DA9442C3EE89, 0x1269E8934A739, 0x5A26AB92C09F8, 0x46BE18F3B9443, 0x2326BCC3920AC } },
+  { { 0x3BF07D8515B2E, 0x6F624BE4654E9, 0x47FC0363FD338, 0x3AB3B44B89541, 0x0B1569B7D18EA, 0x1671234181D10, 0x393EF5B4DD631, 0x7660A6D840C21, 0x3CF780F746D2A, 0x7D99082C10E9C, 0x247FF2BCE4992, 0x10E37D53939DC },
+    { 0x521531708894F, 0x7FD1C16746669, 0x418FA918FDFE2, 0x74357E476BD67, 0x66BA9DE2F1225, 0x55B691B6DA083, 0x1503F70E08FCF, 0x782F65EB59B9D, 0x3EF6C82830097, 0x117E833C624BF, 0x57F950BD789DB, 0x19AD29DC66A3B },
+    { 0x0DCE8056C60CE, 0x59BD7358057FC, 0x5BE8BD4961B90, 0x6F34566205520, 0x08AA2D0EDF982, 0x7CF6B5E63CA3C, 0x379C0AED44781, 0x27411045DF610, 0x03F06ED4687D1, 0x52AB0B406A8D0, 0x1BD5724B8FC09, 0x33F8E6BE44C31 },
+    { 0x28F100BA4F5B5, 0x1C157748ABD2B, 0x7AAB79151D8BD, 0x040C4B2D9EC41, 0x749D9F2D015B9, 0x42C6D87286801, 0x23B499F9D3A5D, 0x6E2CD8CF4ED6A, 0x05709D446668C, 0x62DB2FC653169, 0x11068B533B2DF, 0x34D33F1F9682F } },
+  { { 0x05E82AA16F2AD, 0x46A82651BECA2, 0x0EAF20D7F4663, 0x72B1D319F38C9, 0x52042519276E5, 0x49F00AA6DBC3B, 0x6F00D8817A940, 0x6C756311C6F6B, 0x211DFD74E8891, 0x5A1148D90D8F0, 0x5534D636B0B90, 0x28492E98DB541 },
+    { 0x34C4CC59274D0, 0x35B8DE5F771B3, 0x3412CEA4768F2, 0x2A8A2E0C9710C, 0x5DAD0A5BF3F6D, 0x4C8803B00C423, 0x25878DA27EA6E, 0x4906904E4976A, 0x6AD0BEDFECDFD, 0x112EBEB9EB656, 0x7D9DD1C63B365, 0x147304449BAAF },
+    { 0x115201ECA619B, 0x4E79F2D650854, 0x0F0C602C0AB81, 0x3EFE5A41B989F, 0x22642D5435966, 0x690A94A4B5AC3, 0x6B1D9BB15F824, 0x23EFFB9FAE025, 0x316937093D9FB, 0x6A89D25BA9B4F, 0x66DF092A05667, 0x3C1A15723D44A },
+    { 0x21CABCF97B30C, 0x7C7BF5B576F62, 0x6393C798E0ECB, 0x7BDD76668649A, 0x53C7C9DED49BD, 0x0752F29E3FAFC, 0x7D0030049F2D5, 0x7C0456CA8CCDA, 0x593F05276DB88, 0x2A18EE059D429, 0x22F8D82670C57, 0x1644A639B9114 } },
+  { { 0x0B48C2C1EA0C5, 0x376B836B6E1D1, 0x15E6A6D0E146B, 0x3B71C95765618, 0x6A021A67852D3, 0x12E86E29E58DD, 0x4F7594299336F, 0x30734E0CF0174, 0x0943893CA882C, 0x6D6F0F88FB453, 0x13D168EFFDE7B, 0x3727886A83989 },
+    { 0x501C655850C03, 0x56E545816753E, 0x1BBA1C46A8DEA, 0x74F958EC2A8D0, 0x1EADAE43CBD73, 0x652451FE1BA32, 0x413149415CB05, 0x2B1233E302A67, 0x352627CBFDBD2, 0x253239DDA88F1, 0x75774CBA376BD, 0x156633D93AB0C },
+    { 0x769A79F6868CB, 0x3FBBC88096E01, 0x0D486E02ADA2E, 0x122138C420DEE, 0x6DF0B1E9CED03, 0x05EC07FBB28C9, 0x010DDBCC731BC, 0x136808D0ECA02, 0x52C6B5D5BCD07, 0x5927A9F1E04C0, 0x169EB584B32F5, 0x3E49BF2949998 },
+    { 0x35B7DEFB11D37, 0x7EA676E8669CB, 0x180B81025A5DD, 0x2842DFAA800B1, 0x7BA03EB923C02, 0x7713F4D71A2AF, 0x592C511CF0E5D, 0x02705BB15E41F, 0x392B66A8E99B9, 0x5B9AFE5995353, 0x72683984C0B12, 0x21519C44D8B22 } },
+  { { 0x695B71A5B1735, 0x68DBE56AF2CDE, 0x64B990636929F, 0x78497B94793A8, 0x16F45F50A411E, 0x21A90653628BD, 0x305F1596FB4E4, 0x3CB7FA61DAD8F, 0x41AA0A8705C5D, 0x1F9CA8B8B395E, 0x639E362DECFF5, 0x328BD9A0D4D3E },
+    { 0x6D3DCD9F8BA19, 0x194E121BF8E76, 0x01EF8A7A927E9, 0x7DA8BADC53A04, 0x74F8CBAC15F4B, 0x17AE2653B2C03, 0x4D5BE2D808E33, 0x2C813B6B982B4, 0x173AC12D3B332, 0x302F72EB3C1A4, 0x218A3E3FDA04C, 0x1CC9FB9620CA7 },
+    { 0x6EEF25F6FBE31, 0x3CCDB1B888B37, 0x705E1F63F65C7, 0x1F7ACB2AA78AA, 0x1E0050ADDF97B, 0x70FDA4058F61C, 0x3C85597A88230, 0x6E1BE176DF826, 0x1E0171B2227DC, 0x58C9333B7B47C, 0x1BCD755D662F0, 0x1CA31A67B9F75 },
+    { 0x12B4272FB2D19, 0x64F2ED6B4CC85, 0x41AC1874C9FB2, 0x06B91763B9AC6, 0x654A08F79B507, 0x0DB2AB02C22EF, 0x771C713F0D220, 0x64460ECE758A2, 0x26B10B32F0A9F, 0x536FBE89E66A8, 0x08CFB11A4E0F5, 0x2B1EFB8B84F3C } },
+  { { 0x457FCB467EDB2, 0x1604C0A8125B3, 0x3B58C1D674D6C, 0x46BE9BAF29677, 0x69278AD7E77A2, 0x66CD26E754E49, 0x365284C6CD739, 0x01322B4E9E8E3, 0x2DA02DFA61CAB, 0x71F9F14F182ED, 0x540C761BC7F0B, 0x184AC95072AFC },
+    { 0x4354EB9457744, 0x567D5D05752FB, 0x5774FC3CBE0E1, 0x0B8D2D08E221D, 0x7100DADF81D13, 0x6E1A21DE1659E, 0x54E23B790A0C5, 0x2BCEBEB04C11A, 0x39D7561E9E52D, 0x01768B6C98362, 0x6F586A38C3AAF, 0x200B18E7705D8 },
+    { 0x27D43A75A6638, 0x48CA57E6F4391, 0x6B8D3BE7C4C70, 0x17A4BACF18C33, 0x0436AA285EC03, 0x0D0C157FAC00A, 0x363C0D392FC31, 0x039DCF054C68A, 0x1A97F4F9703BF, 0x7770C1A3F67D6, 0x4C39645ABE491, 0x16168506A48FC },
+    { 0x708355AE8988C, 0x70ECA7B8BD35D, 0x290891E8EF208, 0x586652FBCBE93, 0x2C23313B1A590, 0x40BE0FEBBD7A9, 0x00F5D01724E13, 0x51D524C3E2650, 0x159FC8776D504, 0x006AAA03E1D4B, 0x0C7A1E7222FD2, 0x229A1FFB2083D } },
+  { { 0x6DADA93643221, 0x3141483A6BC55, 0x02B44D361C0E0, 0x7DE4D72F4A1BF, 0x727377BC812B5, 0x56E4BF965F2B9, 0x7C5652126068C, 0x1C86ECF4AB86D, 0x2892896186000, 0x15C04E578A8B0, 0x22BDDA056E067, 0x1D3572BFAFAC9 },
+    { 0x458A4104076DC, 0x5C52C5B8AAB3B, 0x359B7CD3D1C9C, 0x03FF90EB31B12, 0x2A2C74375B785, 0x7C3AEC84544B9, 0x69445AD014617, 0x18DB28CD0AC5B, 0x0550C00500A96, 0x0DB370E5FD822, 0x4E17C1EB7EE42, 0x20AE93AB783E5 },
+    { 0x52D8DED7F45F1, 0x07FA6EA8730A9, 0x73BBEE6491FD9, 0x295B38017AA9D, 0x6D0E18443796A, 0x31EA4E2F14FC8, 0x42AF40032B468, 0x096CB63559841, 0x41DCC65DF58DC, 0x49346FE4FD3E9, 0x3FE1E40AAE517, 0x137261B3EDCC1 },
+    { 0x3858C802BC650, 0x3C4EE534B5471, 0x57244620A085A, 0x400B75D03C281, 0x44E1E75DB916D, 0x629EA21D53416, 0x3F5604155D2FC, 0x44AE4795A2E26, 0x3C8B6F6C9232A, 0x6923953678D71, 0x3C90C19E218E4, 0x2C680F72855D5 } },
+  { { 0x380CBFDE9D154, 0x6066D3B009DA7, 0x4B1D248D0A1EE, 0x69DAB5156D3F6, 0x4589D99D42BCD, 0x66A61092310F2, 0x06A3EC28FB092, 0x2EE0A9ECD581E, 0x50D5B50092DDD, 0x40FDE182DE135, 0x5CBC217AAD086, 0x36B06C82BAB88 },
+    { 0x17DD2D3AB4E7D, 0x0346E1412C59E, 0x53672CA27AAF8, 0x4C4C76F8D3B99, 0x450244ED8CF73, 0x0C4449080A4EA, 0x18986344BB643, 0x2E86D1861BC20, 0x1FE9730323730, 0x42AE935D57903, 0x6ED189A4813D4, 0x1EB9446272986 },
+    { 0x510CD8C2A9006, 0x01C02F623931B, 0x4A39BAFB15491, 0x2D23FFF704835, 0x5C65E5C997536, 0x24A9B0DE70E21, 0x59735A29BAD45, 0x5D4F40691598D, 0x3741BBC06B396, 0x4175EC6FB9B96, 0x69BD50A76C761, 0x240BB9EB94A01 },
+    { 0x1D86E2B8D4E85, 0x653E747C37BCC, 0x7C6276E750167, 0x18D4462E96818, 0x66F6B81E87916, 0x6390F675CE322, 0x65D4C5C76C87A, 0x0A0558AB7D116, 0x6BDBE322FDAE2, 0x7EAD70D4FC6AB, 0x54E97035119C9, 0x21105A9E70189 } },
+  { { 0x17BDCB048220E, 0x338A4DA6C8EC2, 0x54B21FE012D12, 0x292EE559EBC63, 0x62365B40CDCAA, 0x672FAA84E8CB9, 0x1FC3602A82596, 0x0D14166A92B84, 0x0BAD3617FAA8C, 0x1F4B17171E45C, 0x0CCD3C59451DE, 0x355121D0489FF },
+    { 0x5EB64AE46F1E1, 0x49B7B00C42BE1, 0x3889E577751F4, 0x295BD87D49FED, 0x4C83D88692E68, 0x4E2BF0F000079, 0x532CFB5CBFA9C, 0x24B8A6DC077CB, 0x57D4DB12BFFFD, 0x0BD6E9604B743, 0x4D446F4FF19ED, 0x08BD421CEB8F6 },
+    { 0x6363136A03F16, 0x11E1EE22F7591, 0x58715C6A6F6B3, 0x2EC520F3B1FD2, 0x04FC6B92E1DDC, 0x651EED992B4F7, 0x7CFFE6E88F54B, 0x29376E6EA3C05, 0x524CDED536561, 0x1A0F82E5523F0, 0x32A4A8B3A2EEF, 0x1524E2F3AEFB1 },
+    { 0x7209872C9948B, 0x7C8A8C6278340, 0x530CE3736D359, 0x0947F4C8E3EFC, 0x35AC746DFBDF6, 0x01F8130855486, 0x2205943C4731E, 0x5CE7F4EA353DF, 0x3765FEB864547, 0x2524DB58E877F, 0x751C1BF5E9FC0, 0x2ABFC007D5ED7 } },
+  { { 0x16D08792972A4, 0x13CA9A8CFC40F, 0x224F57396A441, 0x740A91F60C2F5, 0x27A34851DA896, 0x79F6B27B17D8B, 0x1EDF3B00538B5, 0x58A91D32DB028, 0x5C2BE2B8D3578, 0x00BB21A6C160C, 0x3046C2C5C2302, 0x0F20226C0BBC7 },
+    { 0x3E10215B7BEFB, 0x7B5CB1F979E57, 0x06E837F4502BF, 0x4206BC41A5A9E, 0x5D6B650F3C26A, 0x0AF9EA6747D4C, 0x75B29793C180E, 0x66BE16D10CE33, 0x6F38A3471334E, 0x01EF121173706, 0x1309305ABA760, 0x11C388AE96F20 },
+    { 0x5C700B8833FA0, 0x616B2ABB77187, 0x041DE06E4F5D7, 0x3F753B021B090, 0x685C4454C06FF, 0x07EA3603115F7, 0x774D6E7288CB0, 0x5528EF58FCF25, 0x56A5C2B377E6C, 0x02D299C75B9F7, 0x50B1665023373, 0x236E81791ED87 },
+    { 0x515BB5E767AF5, 0x3CDA51685E404, 0x362962840BABD, 0x3142DC6EA7AEC, 0x1DC634FB1D5C1, 0x4D3011C9A2741, 0x1AC9568EE6408, 0x7EB015C420425, 0x4D0E8FD6F2EA1, 0x1AC61AFA445EB, 0x6593968EC24DC, 0x2CAB0B8A218FE } },
+  { { 0x586CBAA73F55F, 0x126E9278D2CC7, 0x607A9B1A5F8EE, 0x03FE3F8A23BC5, 0x5CE6FB3C995DD, 0x10932DDED72FC, 0x64C4AB7D93EF8, 0x660EEBF80ACB0, 0x14ED58C31E788, 0x64EE933C67C74, 0x70210549E46BA, 0x493988480B545 },
+    { 0x249A2C10DE86B, 0x0CF7ED7AA7617, 0x33F47CCAA751A, 0x0C355172A0B11, 0x554369125BB72, 0x5C4F4425A3DB6, 0x72FED4FC86717, 0x0C17F1C51FE76, 0x56E0BFC70FB1E, 0x740B393F68151, 0x1EC87F1B7277A, 0x18115EA73E630 },
+    { 0x5E0401D4894EF, 0x0310A48764722, 0x07B0243B7EC6A, 0x09257BEFC3C90, 0x313CBD2A122B8, 0x139F6D349229B, 0x63FEE7BE4DF8F, 0x78F0EA091E112, 0x133E865F081FD, 0x1A3CFE021F33D, 0x5F77968F2BC10, 0x2C32E0C26CCDA },
+    { 0x1340FDB86C4D7, 0x44742DE33D542, 0x73FFF8EEEEEE2, 0x1F1EA823A1A74, 0x2F2A3042F6D9B, 0x60380F5FADCED, 0x5F8106009248E, 0x3ABD8E97E834E, 0x77918A2E21006, 0x041F110F8A499, 0x1A57A9B5863FE, 0x21B94F50046AE } },
+  { { 0x74E28C881B975, 0x50443795751B0, 0x3F338793444F6, 0x2B01D06AEAD51, 0x5F55C165CB1A2, 0x7710EF4AB50F0, 0x21C816819DBAB, 0x487B682779F5A, 0x37B1BA0FC1F0C, 0x6210559B540D2, 0x67CEAE2149ED8, 0x48D6C8A5E2BC5 },
+    { 0x02CC9F3D90162, 0x6E5DAF5731C9A, 0x0BB20FA4EB49B, 0x27E307572B8DC, 0x518C93679EF5F, 0x0CB9730F4C07C, 0x02DCD4C997FBB, 0x2AF6AF7FE427D, 0x3139CA19BF641, 0x6F67BA531C8A3, 0x47FD31EA3F34E, 0x0827CCDDA0E50 },
+    { 0x2D315FC70B423, 0x1196DC134968A, 0x2BE580BFA2648, 0x5B5C809FE7F34, 0x39FECD2CE3C9A, 0x5379CD0827814, 0x3A94AEC3ABC7B, 0x79B237FACFEA7, 0x1CF4C4FE163ED, 0x43468FDF4CC06, 0x7A78352EBAAA6, 0x2996DFA8C43BC },
+    { 0x6765557FEE548, 0x1061196F4C645, 0x6A9E2BF9ADB18, 0x649F0AB9506FE, 0x39EE0BDBB7A12, 0x1FEA2E7E0FE51, 0x41348643CF7C1, 0x05B633D0A7408, 0x797E876C25410, 0x43327ACFD7A2F, 0x3876BF04AE447, 0x2BFC958DB3A3A } },
+  { { 0x548A29A56724C, 0x315F861DB5C35, 0x491676F81E658, 0x07911B4E371A7, 0x2DEAA48F87A81, 0x690138A0D7749, 0x3B181EC192E08, 0x48F85E60F0778, 0x2861E7A36A127, 0x1EE6C2E71163D, 0x4BAEB5F39A7BE, 0x295FC43AAC766 },
+    { 0x102AAEEB84514, 0x7DFBB6C36550B, 0x6CD2E5E170F9B, 0x10C2746D39374, 0x2F0238DE4B6FA, 0x057FB2AB154E1, 0x52BD9F7649B19, 0x544C95F3A7FDA, 0x12749698A0343, 0x53343C774CB3B, 0x1DE63BDE24788, 0x10DC367696FEC },
+    { 0x31C113FDAF4A0, 0x3D2C036A2EEF2, 0x46E3A9BFCDB5E, 0x625356F809B9A, 0x79EAA0EE5C9AD, 0x2584CFE725A9B, 0x0DB8F4C63114C, 0x282C5EB97EBCA, 0x12440627B6105, 0x5EAAE55F85DF5, 0x4DD2A43B0CACB, 0x3FB294294068E },
+    { 0x3335EE9AF78DE, 0x275CFA4DD2763, 0x3459F15E6F5E7, 0x17F2D16DF8914, 0x324DD97117609, 0x5C8EDF4B72C25, 0x72B76E747F300, 0x18D2904C57FD9, 0x3E7E816B7A99D, 0x3B9DFB7173199, 0x17467D788BFD3, 0x1F62FB85BD2C0 } },
+  { { 0x5190374B551D6, 0x4AAEC04336DDB, 0x16797E470F2EC, 0x63F8E6F1797D3, 0x5A1A520D2E714, 0x53D2A09E0B8FA, 0x51DA49CFD4A4F, 0x0345B981124B6, 0x31A29C42B25D3, 0x18057C23FADB8, 0x06D9EC18196D5, 0x36697F508AE78 },
+    { 0x17301F4EB0A50, 0x47D811D584B00, 0x0E43C78A40CC3, 0x60BFE414982A3, 0x5F64BB76402F0, 0x000C76BC6236D, 0x7969110D03E82, 0x16050FBE63C5C, 0x0B267B36C5D4F, 0x32A3021049517, 0x42E34EBAF8982, 0x1772694AB9283 },
+    { 0x2D6DB46AC1E02, 0x5ACF99B3D4A35, 0x15CA8B36D7333, 0x0F71B659CE292, 0x3FC10207A4FDC, 0x4D6A9545D5D7A, 0x7541F18DE202B, 0x3B1A22B6CB9F0, 0x61352B4A1C924, 0x5112EE2AE7932, 0x530311D3C3B36, 0x38C6D479E0BDD },
+    { 0x1DB7DD51B7CB6, 0x522D3F1587C19, 0x2C6DA33B7F9C8, 0x33F672783ADE5, 0x43A2F3678DD9D, 0x78D9C3296BA1A, 0x63C62ACE7D681, 0x4B362655F79A2, 0x2C8BFA31E4C40, 0x33098427B3B1F, 0x60082DB2493FF, 0x1E49AF6A60562 } },
+  { { 0x355AB07361009, 0x43B3F4EAF41DD, 0x60AD1492C4AF4, 0x16EE57597B3AB, 0x4F42D873A9DEB, 0x4081C78B94D6B, 0x7E7136A651C75, 0x5C75B18864D2A, 0x69C2847AF3ED0, 0x78838F79CCDAF, 0x221CD0D4059F9, 0x3B07A91E47FC9 },
+    { 0x2F83AA14FE0FF, 0x21882641B22F6, 0x4A21610544F2E, 0x60EE14526EFF5, 0x05F262223252D, 0x4920D4C0D4A14, 0x08AE5639069A7, 0x72F4AFE98B122, 0x1B78F8C19374C, 0x3737246C5E774, 0x0C5FBC2EF667F, 0x15A4C9B760612 },
+    { 0x52E0E30E7CFA7, 0x2E813010D7FBE, 0x4C1C9A6CB7C93, 0x5273E86CF8819, 0x72DC3F31CDFA8, 0x4C6837A9C2E20, 0x30F41E41D9871, 0x2597FA524FD39, 0x3458B2F9C2DB5, 0x7DB5B31E90D4D, 0x7F441BBF8A9D2, 0x2645AD260DDB6 },
+    { 0x4BC0257CD5355, 0x002D87BEF3D55, 0x4184EA72EB9A9, 0x0471320BEACE6, 0x7B423D0697D34, 0x3BF4DEDE6B3D8, 0x15D09A1448E93, 0x1EF95210BD8FB, 0x1832ED918A524, 0x449B1553EFB9A, 0x5BB6B248C08F3, 0x2B0D47A8BBC3D } },
+  { { 0x6D69FA9B374A0, 0x62DC2AB65B6C8, 0x10BA82777D0C1, 0x0B07DD796F14B, 0x3D6B5D59E4F37, 0x106889DD9198D, 0x6F4F504AFBD43, 0x0233BE15F345E, 0x118B57FA24BFF, 0x3B29C47C4B017, 0x52E61EDF6A3A4, 0x1F2B1538A2959 },
+    { 0x02AA2F33367E1, 0x191F05791E47A, 0x2D5055762750A, 0x4D6EA979C8C47, 0x383EB4B6B1CE7, 0x58BE48316FB67, 0x5384D97B7B458, 0x03EDE2AD7BDED, 0x4A171B7C4F316, 0x7643515899568, 0x71384086EA103, 0x1D295FAE713F8 },
+    { 0x598E145AC5118, 0x49350AEF2AD88, 0x5683488727406, 0x70984B6917102, 0x35698528393A0, 0x5883B697515D6, 0x272C8E32B5B17, 0x1948F2D1A831E, 0x48C52CE063448, 0x6C0AE001ADE74, 0x4C816534430E8, 0x1FF7607AAB652 },
+    { 0x3134B6842A89B, 0x58A0F81C7F259, 0x50E7CD50DD828, 0x09ECEABDB5037, 0x608366D97D8E1, 0x59B88A6ED1468, 0x326FA4BD46E2A, 0x75D510B808268, 0x44C036130C9B0, 0x19530409A3A62, 0x1F904FF960AE6, 0x2C40897AA657B } },
+  { { 0x1A7F4EDC0C806, 0x2EEE24FDE43B4, 0x4428CA3D7A779, 0x4345A57C33EA4, 0x3CD3C781E2C84, 0x0DC71F05EBC60, 0x5A6A36B3DECB5, 0x1131E7C99CA56, 0x74905FA1F38A0, 0x183732B16CB4B, 0x13EB43DD01172, 0x0AB1D59EE33A8 },
+    { 0x3E02935A0E078, 0x7F3476B458698, 0x715EB566E5DCC, 0x514C46CC5FA90, 0x559E343DA79D5, 0x1CE11424F0476, 0x0E06151E0BEC7, 0x62F740DB13B9B, 0x7BB011813F923, 0x21AE7FE1C562A, 0x5A6E764A5C68A, 0x1873830265555 },
+    { 0x15C0298D1E7DC, 0x4992E1C4DC2D6, 0x084590CE37014, 0x17925F608F1FA, 0x276F2AE1531B1, 0x1A4E57F55E6FE, 0x6EDBE1723447E, 0x6A869E3226845, 0x4F1411E9DF608, 0x6B78E943CD6C4, 0x29AF66E40280D, 0x243D064F46B2F },
+    { 0x4B4F70B79398A, 0x67C8A38CCF473, 0x12A1ACEFF2EB1, 0x2A8A27BF0E74E, 0x6CCF2F59D3664, 0x0648296414C13, 0x21F928DB575E5, 0x2BC6B884E5FE8, 0x585F9B07F7374, 0x432581CF51A86, 0x1F99FA112752C, 0x1C16231E8F389 } },
+  { { 0x12EBF90490D32, 0x19EBA3BC962F9, 0x434B95B40AAD3, 0x38B96A54EF3C5, 0x148FAAC66C671, 0x50C03F879CF9E, 0x132314B7D66FC, 0x249E03DD5088D, 0x294616DC52D6C, 0x6991049F718DF, 0x3AD30E93357B7, 0x224AD5A727EFC },
+    { 0x53FD92A4503B1, 0x69DD4798D87AF, 0x1B0FE48C3FC85, 0x5365AB284AE43, 0x52487708625DC, 0x45DC86FE77B39, 0x59AC47F34DCB9, 0x211B0698DC5AE, 0x4FA2AD1E38F6F, 0x79C7E1B57A137, 0x4CF01366639EA, 0x14A6E8E0C6426 },
+    { 0x22D1B4031DB16, 0x6291A4A4E65C4, 0x5455D553A5411, 0x2838A33213B90, 0x70B5CDB73B57F, 0x1C9F410D8A6BA, 0x03B5FFBAA1B39, 0x43B6141E4C084, 0x433A6398FD90C, 0x09AA75EB09273, 0x0F9400F88325C, 0x323095E986916 },
+    { 0x1C2AE75BCCC17, 0x38FCE1E657B3D, 0x741A8B553B229, 0x35ACA73AA9FB8, 0x49679DA2C0079, 0x65B5A192E571D, 0x61DE7CCB53BE4, 0x35E94156D1FC4, 0x4B8CEAD33DC51, 0x712FFD7EF3087, 0x30F7E2BFF29F9, 0x31F9F48D6E79F } },
+  { { 0x5387A619736F7, 0x1F0DBCA2D7BC9, 0x7F0151EF2C7AB, 0x79B4F7CB209BA, 0x4D8AC617571CC, 0x05F45AC7CBD64, 0x0E70537CA88D8, 0x396D3FAF2570A, 0x39122784CA910, 0x261235AEDAC40, 0x056A569B8B969, 0x2B753D43BE3EC },
+    { 0x6AB8103A5C0C9, 0x3A24EBDCBD786, 0x5DCEE434DA4A4, 0x4231FF778EC02, 0x74B5FA3330BC0, 0x0069CCD9415A4, 0x1FAC30B6D01FA, 0x48735F74EBA43, 0x6E4822A22EB9B, 0x133E1A18EF341, 0x26011DF016B1A, 0x228F6E5936E27 },
+    { 0x2562991F5DE19, 0x29EA7A7087136, 0x741EED99ACBCD, 0x26A74B42E02CF, 0x328E901AF2E1B, 0x279FC77E3866B, 0x04AAC8A714A23, 0x52F3108D20F4E, 0x3104434A8436A, 0x624A278484419, 0x5DB99F68E2C2E, 0x17CCC1C857632 },
+    { 0x264CEC453C261, 0x010A2FC857C49, 0x258B4A54FCACF, 0x768C29CC33EE9, 0x2950FAB9AEB3E, 0x2C19B343535E7, 0x476F58A34AA71, 0x05FF454691E95, 0x4207F5AAF80C0, 0x79D94B0F6E5F8, 0x0B8572BABF890, 0x2BF5C44520B6C } },
+  { { 0x18483B4A988DB, 0x18DBEA71894D6, 0x1156C28BE1535, 0x243AD4324ECEB, 0x1FC86CD1D50D1, 0x3EE0F787BD3C0, 0x25F5814EEC64E, 0x19AB2895E432F, 0x5DB2F63B0384E, 0x19BBE40E2F5D2, 0x66C440E623D46, 0x2CBA8F3DE2064 },
+    { 0x04B397C889B5C, 0x4E8A02669B8FA, 0x5487502CB48CD, 0x328CE64D2FC75, 0x6E2EABD606613, 0x22F0AEFDE3A6A, 0x0624DEF78D2CF, 0x18F0BC14C0F1D, 0x1C639C83BC98C, 0x3DAD1A48ED718, 0x16E0F11B17E1D, 0x120454C293C42 },
+    { 0x78C9EC2825AA9, 0x6AE427CDD062E, 0x551103880F5CB, 0x4E1338B0B7283, 0x645AB45F29038, 0x39AF6ED22FA87, 0x71E820F6CB541, 0x73F8430F15F14, 0x339D9166AF087, 0x1D567C858C7E3, 0x482FC3ED60282, 0x47B1469A08C71 },
+    { 0x1F223431F6520, 0x1C37709FBB486, 0x46C9BF1C9738E, 0x45AE88824512E, 0x44AAA90688377, 0x06DD7617002AD, 0x475311467CF4C, 0x1FA6E5274A4D3, 0x1E47912C16631, 0x4974B853329C6, 0x2EF4567767C34, 0x1BBDBBCC11A7F } },
+  { { 0x40BDA2A8C11CA, 0x1C83386834E6D, 0x03B32F94D6AFC, 0x5476DD9BCA886, 0x60AE3A499E28C, 0x07A430A61B529, 0x7EB4592B4BDB6, 0x00D64EFE6BDC1, 0x578E9F992B529, 0x703F1D173185C, 0x742D5A6B46530, 0x2F9E8EEE4715C },
+    { 0x32B9074AED5C3, 0x0014084689426, 0x05BC8267EC03B, 0x472A2B2644CFC, 0x4F49F2AB1649F, 0x15C8408E799B4, 0x5D3F53FE0F60E, 0x16A2331EEC05D, 0x06194CFE87326, 0x696C6D81D5011, 0x4B9FCBE062237, 0x26EB39B0A95EC },
+    { 0x14EC097942FEC, 0x7A91F53C52FDB, 0x62FEA05F3D1D3, 0x186F8C8946A9C, 0x588F40B9C21DE, 0x5E729A023DA16, 0x20415E6A82FE8, 0x291B2A0B810D0, 0x75B6613E7FA3B, 0x29ED88245D88E, 0x5A589907B5EA4, 0x1626080310E2B },
+    { 0x7371009A39CB3, 0x363DAAA82FCF3, 0x4844D2F8020E6, 0x37AF8F8617760, 0x4E913CA92EC6B, 0x14D92D3BD6FFE, 0x64EE3850B4614, 0x7A72E5A9F33CF, 0x3ABD1CE9805B5, 0x78A152CF8F902, 0x0ED1FE81C955A, 0x2BD62E1A08DD0 } },
+  { { 0x34A85F447E0A2, 0x716D71CC4F3CF, 0x427510172CEB6, 0x7FB696257B08B, 0x15F5B295F7C01, 0x704F3171D439E, 0x223843941694A, 0x1366F53714FC7, 0x3119CFD592113, 0x6ABF3BA5AF2CD, 0x3636ECB4B0750, 0x3DB305FB31FCE },
+    { 0x417B5E58C73A8, 0x1FAFF78AC7F77, 0x0F87B4F5E2203, 0x77834EFC589EE, 0x1042B99C37CE5, 0x12B0EFE54A584, 0x350382B4C0A86, 0x003FF0DD09198, 0x25B2AE5C4ACB3, 0x26004F2AD0331, 0x4CE7395F336FF, 0x0D48CAA500BBC },
+    { 0x20089100B6E44, 0x79D2FC1301457, 0x0814211F6A7C3, 0x57D4D35BE7D49, 0x379C085FA2F8E, 0x4C4B019D577DE, 0x25BE13451CA12, 0x73272E5D3CB55, 0x4AE5F29BC556D, 0x53DE02133641A, 0x1113699953778, 0x1A657FEF4E0CE },
+    { 0x1B42A26CB4366, 0x642BA016DBE76, 0x7DF3E2A2A22FF, 0x504906BC8507B, 0x3A6DF0E5961E8, 0x0188BA92662DC, 0x3B5FB63213440, 0x7B59F95B0401F, 0x4DB00406A856D, 0x214809A551A42, 0x6B6BD18889EED, 0x28D8A888508DA } },
+  { { 0x29ECB6B17634A, 0x7D49EA891C826, 0x7BF893B1CBFA0, 0x67826772FAF5E, 0x195FA5FAE4B56, 0x0F97F8DFD3E25, 0x63673B7868DDF, 0x19E335999B6E2, 0x5AF9AB0B5B526, 0x10428464DF98E, 0x3B1973252DC28, 0x2E5E12DCDA2D8 },
+    { 0x04628B6AE4762, 0x5B7731D00C5FC, 0x49FAE3BE4B418, 0x49F097944E466, 0x1B2796F7C7AC5, 0x314A109B5CE9C, 0x68C1ABA53B6CA, 0x34FB87EAE68EF, 0x66D1687E95FE4, 0x42BAA73D029D5, 0x76C2116675D6D, 0x107DC6594A160 },
+    { 0x57D70C9CD44B4, 0x5EA1F9A2432F5, 0x14BCA56A29C74, 0x01AD74AA87443, 0x6D3E7CF6119C2, 0x7D3FC4274CB9B, 0x6430A8ECB323D, 0x5111511F8C488, 0x1EEDF09173A35, 0x32900EB4FE23D, 0x3BCE7FFAA4211, 0x3EAECD9B690CB },
+    { 0x7D8CFAF7912B0, 0x522FA05374052, 0x02C2719546BD6, 0x5D12ABCF71552, 0x31E2F899DDC4B, 0x7A23058BE9074, 0x3D8A1F69C53EA, 0x08A4D11725659, 0x374F6211C0F11, 0x3D0C2888C9D23, 0x15D6B2C4A617A, 0x263A313C3BEF8 } },
+  { { 0x6E5E597BDDE1C, 0x3DD644309FC6C, 0x31F1DC4218903, 0x3D8C2A474C594, 0x5347F7C9D1DAC, 0x66BBBD11EB414, 0x2BED045F551A4, 0x3EE18599068E2, 0x3E8A9B678EB79, 0x427F59D50572E, 0x421BBF56F0760, 0x12689DE387484 },
+    { 0x61F01CF899CC2, 0x5F34B5B158BB1, 0x1550E671C1270, 0x76F561C1955FC, 0x1584B1FFED7B1, 0x6EC84D1FEE1C2, 0x5D35B073EE9BE, 0x5AFB1A0008090, 0x1181A637F457B, 0x0DDE898E8652C, 0x2CF2CCC94AA4F, 0x070184772772B },
+    { 0x02E5241FB605E, 0x5085AC2E78EAB, 0x0E6503EFF7ED1, 0x458359195D7BD, 0x3B1CF85B7DA50, 0x16256095D97B9, 0x7BC17299673C8, 0x1277BF63DCB2A, 0x69B2809CE428F, 0x6AD0008C14758, 0x3898B3FED0170, 0x18A4F465530C1 },
+    { 0x661B4E56D1008, 0x5BFC96280C973, 0x1CD54BA402952, 0x53F2053A9189B, 0x773CA8A501EF1, 0x77E1C386978EF, 0x0430989753384, 0x44B5DEEA64EBF, 0x7FE3C8393A1DE, 0x50DE690FAE252, 0x31DA3EAB1C363, 0x223FF2D79682E } },
+  { { 0x64C5938C9ACA1, 0x53F43AB70C186, 0x0FF3852402967, 0x5BC5BE3F375EB, 0x5F9F05768C044, 0x6EF54728A60D0, 0x1971C704DE14A, 0x245AC7F2BE644, 0x71BE5BD16899E, 0x1A08FA1BBB263, 0x01B4061DC7495, 0x3474E62041802 },
+    { 0x1A88B389995F7, 0x27CDB8463272E, 0x4F41DE562F722, 0x06268BFD065A9, 0x36F00DA652866, 0x00043C371DA3D, 0x429AFB95AB903, 0x53C00C545353F, 0x3D776992C9D92, 0x47A6622133D94, 0x7A59372679A1C, 0x1FEF641B98DC9 },
+    { 0x28AF7C8B2ECD7, 0x3C027E4737256, 0x79CED735D385F, 0x3783C69463952, 0x16A221807E4D1, 0x20580BBAC13A1, 0x2BC32204EA70F, 0x452DA40B4E405, 0x332800710E59D, 0x4D6BFAC528CDD, 0x143786E68DC4B, 0x33689D943BABC },
+    { 0x38ABB45C34921, 0x68A381B793DBC, 0x6A69CCBD64B7E, 0x1A19B5E8CDD6D, 0x2E63975AA1525, 0x62EFCD0384BA7, 0x433E0CA428CDA, 0x4F365DDC5878D, 0x3344677333DF6, 0x5C69B5DA8F1ED, 0x4A4FF0F36F510, 0x2404CBAC89680 } },
+  { { 0x77FBCF8271F6C, 0x6B026B3220F98, 0x6E0580F0F8928, 0x1254725777495, 0x12A42BF8A3D1D, 0x19BB444828A68, 0x64B5FFF7C11A2, 0x63C14C30FEE52, 0x37A14C488EB76, 0x3C5F8EC9DA2FF, 0x47F75996E765E, 0x432D045E33A89 },
+    { 0x3FE04F437128E, 0x7861B52911B65, 0x0787B80223970, 0x6D3DEF55C7D94, 0x377F7726713E7, 0x2584908EE9AED, 0x17AD9A1D243EC, 0x297210C071B08, 0x72B70B8785006, 0x1E463701512C9, 0x5BC905C695EC1, 0x0D894414A613A },
+    { 0x472BDB927930C, 0x5957CB8C46C3B, 0x141813B51B029, 0x21F453A8224A2, 0x1DC5A4175CB32, 0x0243389207DF0, 0x13B4674274BDA, 0x0A188F00ABE42, 0x60538D479A998, 0x15E90B51D47D8, 0x701ABA0526865, 0x2F830B9DD2B4E },
+    { 0x55201325F3D08, 0x30D1AD58B4188, 0x60568C50C04DC, 0x4C4E1A79F928B, 0x1E4F0C97E5D1C, 0x426E162D96BB9, 0x2275E90999D91, 0x188CE2AF97F27, 0x47B7380D3E1BF, 0x0A9BC58054942, 0x59BAF2C6F27B3, 0x2A5C59E7CA067 } },
+  { { 0x040B370FB71D7, 0x7803730F5F17D, 0x61C5A5272E524, 0x6E0C9F73654C2, 0x4B1533FA86C83, 0x588A364B4765F, 0x08D34908CB921, 0x43AED2A34B4E9, 0x5DE27A7247F3B, 0x33A279E7B9BEE, 0x219B4C8AD9431, 0x27BC5EA938D0B },
+    { 0x4A30B59C3AD1C, 0x1942F0AC06AB0, 0x6C9407035C26F, 0x6F8929C0AC6B3, 0x23D54D594476C, 0x57C077CCC0F94, 0x7FD12E4A4D09B, 0x4B01C5177485B, 0x4EA6459C583FD, 0x3B57ACC20AA2F, 0x23F599719674F, 0x279BA58BECBB2 },
+    { 0x248913819F1F5, 0x0DE70F910EE83, 0x6E5BCB24D395D, 0x105FB7A1087F3, 0x0419849EDFC17, 0x31DA26C92D659, 0x5618E03D466CE, 0x4CF68B1EAB537, 0x08BC62CE9A2E2, 0x0C54CDF098402, 0x598BF1A7F96AB, 0x265CCBF44B25D },
+    { 0x3B34BFBD86508, 0x0B3B261AB80B9, 0x220F1BA4EC997, 0x57C21F798D08D, 0x65E90664D9120, 0x069336BCFC539, 0x077862876FB7D, 0x4765CBC3F1238, 0x42C493BAF13E8, 0x13CE5E3A2C996, 0x6E8525C71934E, 0x277EFECD487E7 } },
+  { { 0x1F4C400D536D8, 0x2D351FFCE75CA, 0x38617CAAD0FA9, 0x22D10F5B4D2F5, 0x636D0E5F3A16D, 0x2B066FA927962, 0x184030EB2C02F, 0x7F44DC12654F3, 0x18CC12BF80FEA, 0x013EB6AE5BB47, 0x210FC226F7010, 0x3CAAA5453C1F4 },
+    { 0x0B7E4D4A01FBF, 0x00647EF1A0CE1, 0x5C25E5AE66748, 0x79A0B3472BD6C, 0x5C3C2C9AF9C4F, 0x0D57B080AF9CA, 0x012C8F8CF11CA, 0x5C7B5CB791592, 0x5692FBABFC7A4, 0x6AC2AD231D65E, 0x6ACAF75BBCAB1, 0x0C2AEC3073FA7 },
+    { 0x0ECA5D968A44A, 0x0E9CDC3405B88, 0x66F4EB2029CB8, 0x79B72DEA376B4, 0x041E65BD4414F, 0x7F344B167E5D3, 0x1CDBB0D054548, 0x3C3BB495308DD, 0x3E59469192863, 0x0F789DECD0185, 0x37E1996F42C02, 0x395FDE3C35F84 },
+    { 0x527DB6397C02B, 0x5BC831926F777, 0x11A23260FADA3, 0x644F34B462F8B, 0x42C1E6C9E89CB, 0x42EE037ACFCF6, 0x7A5D03E4CB111, 0x6761CB0FFF2B6, 0x6B4EA063BF90F, 0x2539D1876FBBE, 0x5E3E03E78ECFD, 0x1EDE32DD41763 } },
+  { { 0x30CDC50F68CC7, 0x30D20421F14C9, 0x4AEF72B04FAF3, 0x736CA964B2091, 0x03BEF4356E5C7, 0x1076445E75AE3, 0x3DE60E4F4298F, 0x00442E3042097, 0x4ECBAAFCF766F, 0x1E80B72AD442A, 0x16FA35D65E70E, 0x099B937705EC0 },
+    { 0x14C090195FFB1, 0x4D82FC60982C3, 0x007D56AD98738, 0x66ADD192BA68F, 0x47F04FEAE634B, 0x6EEBB366A95EF, 0x614033A909A82, 0x4E705C7D540F1, 0x6DEC33B6A2A7C, 0x47727BEC0E0E9, 0x7C1C2B686CD26, 0x1F3B4105FCEEA },
+    { 0x77DE922EBB2BF, 0x787A346991E27, 0x052A3A15B9DC4, 0x61991579B7F2E, 0x1B7B05C1A16E3, 0x7290EB01D38B3, 0x4DCD272A7157C, 0x2BED6337FC189, 0x15481AB42304E, 0x72115D0CD31F4, 0x7CB205644234C, 0x2C6ACDFA5928B },
+    { 0x07810B3472CF3, 0x3BF673E0F247D, 0x62454E1892D42, 0x404A080BF77DF, 0x23E00F233F3EA, 0x319D076FC0CB3, 0x208340FD5C649, 0x1A97A6FEF22B3, 0x4B4F012D7B6F9, 0x178330F64E03E, 0x75B3AD04C88AF, 0x25E5A01E9E7B9 } },
+  { { 0x36285EEC5A191, 0x5AB395F726FBC, 0x30F2EA80C21B7, 0x6E8C9FC924DFA, 0x1DB7E2FFA8FB8, 0x504CE7A33CBF1, 0x21C40FC6E7DD9, 0x1F717FF0BEAB2, 0x5FC6BC8E02D4A, 0x6B158DB2CAA1F, 0x2B4F4CBEABCFE, 0x2FFEDB6D2379A },
+    { 0x49C2FB3BC209F, 0x774DE48E0B348, 0x111CC67591D61, 0x58A45230B37F3, 0x253572AA058D1, 0x2ECD39A9F8276, 0x39ED2CAB3DD19, 0x75F8EB35B7364, 0x06780579CBB35, 0x7273365C56229, 0x0A6962F2D7D0E, 0x1BEEDBCDA29E3 },
+    { 0x36649960154FF, 0x55AF2CEF33065, 0x4D83F70275678, 0x1F9A2D4F39E5F, 0x128C3BBB7D177, 0x66BAA34C9E2EF, 0x762F1941850B4, 0x2B61113599F14, 0x625890884DDAC, 0x7D12DF2816000, 0x316033CEB8360, 0x2F23D046F8A97 },
+    { 0x2797A9DC93823, 0x00AF303B75D1A, 0x1E36E4E7210D9, 0x07AE368A973C4, 0x43CDE0327B400, 0x20BB135D339CA, 0x196031209ECEA, 0x6F497F77C7BF8, 0x6BDEF627F4EE9, 0x5B921C3A5295A, 0x5FE5A8DC97A64, 0x2D32A24DEDA4D } },
+  { { 0x14AB4D931CAD4, 0x2F9E9B8264B0C, 0x14B8ABE10E8AE, 0x1EB87CDC561C5, 0x498FFEE332628, 0x2A5535ACEF9B3, 0x379CC0941F675, 0x60077596F5D74, 0x132F284FCC969, 0x2913D7BFA7501, 0x2DA583253AFBA, 0x2680AED58B975 },
+    { 0x7B433CBABB8A7, 0x5BA79CDDC679B, 0x32C3B8BF492C8, 0x66DBB9F6BD962, 0x40061E5951A97, 0x304396107930C, 0x412B1C35D82BD, 0x33F52483F0730, 0x5B13D380BB09B, 0x2B60B09E76F9F, 0x06DE7D3099FA7, 0x12370408B21F7 },
+    { 0x19CA209CA0DDA, 0x503E745715048, 0x709B07F9A84D1, 0x56630013A8A62, 0x733BF4BEE242B, 0x6CE3A7433FCBF, 0x0A2AD55D3B463, 0x01EC02F8D6BBB, 0x7A738C7307149, 0x33DA26343A2DB, 0x6CD9F655EA2EF, 0x4878844386995 },
+    { 0x3A5C440F53BF9, 0x0CFDDDA805ECB, 0x044D1F8E81890, 0x594AC3A628D8A, 0x54578F77578EC, 0x138893CFCA8AE, 0x5D81094225C9F, 0x5F253F5C4B784, 0x4C7197534622C, 0x605BA1DDF3293, 0x2D8F6FC23BDB9, 0x20E676363930C } },
+  { { 0x2DA95223B24B3, 0x321EAE7003CB7, 0x072645BFE9C63, 0x0EEB5842EAD64, 0x14EAACDF5ABCD, 0x2180D70F30CB9, 0x311C01D464C00, 0x11178F5CD5F54, 0x52FF37A20E616, 0x32143E7AF90E0, 0x746B9052CF6DA, 0x252BEC58B2D87 },
+    { 0x79E101F01C48C, 0x1476AC9C2E327, 0x32D2605DBF539, 0x48CC69D82C6F2, 0x4DFE5E19D19D1, 0x6BF12BC653D07, 0x7BFA9A42A2953, 0x5CDC55FF6811B, 0x2E58C0163E797, 0x5DF90253E8D1A, 0x759537A925DC6, 0x0BEB4A92EE3B5 },
+    { 0x1618AEF91FCA7, 0x7298026CB6CE8, 0x4C91951C1DDB8, 0x6D4ED2605AA41, 0x25741B915344C, 0x410849B640B2D, 0x0C199AD253B2B, 0x7E1EB75E5EE6A, 0x46703EA569BD9, 0x4B9D64C9AD2C1, 0x4C374388E0786, 0x3C88189C02FEF },
+    { 0x2E3DB8283AAEA, 0x09800B13A1562, 0x66B2A97B1E7B1, 0x0D39CEC77AF32, 0x13946D87895AD, 0x3292ADF0C21E4, 0x1B082528BD362, 0x404E5E594E9B1, 0x690AB7F4A9CCD, 0x51DC0B454B6C9, 0x71DAA064D6F74, 0x22A7D2A534393 } },
+  { { 0x0E9D41A01C5DC, 0x4772B32E1BED0, 0x7830F8F810070, 0x448C65478DE5E, 0x75EEF72975D6E, 0x7D09F871CF303, 0x5220446F821B8, 0x4EAC22799CF3F, 0x350D402B2213E, 0x59A8E5135A3C5, 0x64B3B81CBCAA6, 0x28C6002FA4956 },
+    { 0x626D4D9CC8B85, 0x145986833CA1B, 0x51F97445490C8, 0x773B1457A6956, 0x32BBDDF418808, 0x59A7FEC0AA8CA, 0x6B86ED09D4E94, 0x2C789F159DA77, 0x59BAD09872F2D, 0x76E872B7F5E52, 0x26A30141F20E1, 0x0E873A0124267 },
+    { 0x323729F259462, 0x215B2DE58A090, 0x279022A869C01, 0x2414E4D06C283, 0x7F50981DFAF14, 0x68841EB083208, 0x503265DCCBB63, 0x2DFBD540B9CF0, 0x2F7FC7D46C659, 0x789799C30ED85, 0x7C08390F12B37, 0x4B96BB53EFA18 },
+    { 0x277EF4426C459, 0x6752149EE516D, 0x0D8C2C0FBAE23, 0x6D9A440383F2B, 0x3A93BE4717720, 0x2CB8C09CCB977, 0x515BF5C55262E, 0x13E7E6219F0E7, 0x535AFAFC8415A, 0x739DB83DC145F, 0x20622CB5C0ED5, 0x1F04C19EE2480 } },
+  { { 0x76932D26BD145, 0x4969558C498FD, 0x2DDB32700A092, 0x1045EBAD4A8B4, 0x3A2C3161460C5, 0x6F66A8DE424D3, 0x78EEC62FC77E3, 0x15D47874A3809, 0x625181CB5FC61, 0x5E25C08D4636A, 0x14D559E88D0CA, 0x19422E0FB29C5 },
+    { 0x302475C7937AC, 0x201581A8E1FF1, 0x1D866D5C2A893, 0x25568B37D8C57, 0x215ED276E2D1F, 0x034104CDEEEEC, 0x4F95339FE20D3, 0x2CCAAA7967AC2, 0x517E194D0B19F, 0x39D5C420EC57B, 0x335B39BAEB5BD, 0x1C6D9AA7A43F4 },
+    { 0x3DD3DBC410425, 0x321E985DD5E27, 0x32CA14A0DA5D2, 0x69870AC6B7F52, 0x50A88CFDA8F73, 0x52E4E7321B160, 0x6A7321484DD4E, 0x125DD22979066, 0x44A8ED6026656, 0x722B2D0F2AA95, 0x024AFF9642E53, 0x1EE86794FDA50 },
+    { 0x5FC7C8D508890, 0x21051E0267FC4, 0x40BB3E7B83271, 0x1A9251022AAFA, 0x133AA1DF4B791, 0x560E2B79D3FD2, 0x06E8AA5F98DCD, 0x3829D4E1EA396, 0x3C879A0F4DCCE, 0x02943B3EEA799, 0x608A9C3CC50F5, 0x2FAB697F5BFA0 } },
+  { { 0x4B68688BB1F4D, 0x7FB3583F66704, 0x66316C8D315B9, 0x3CDAA393436BE, 0x6608CD08EF5D7, 0x3A684379B97C6, 0x2FB729A9374D8, 0x042B4872C0E6E, 0x076A8273ABD80, 0x02D34879C5993, 0x6902DC377957E, 0x2556BC854382A },
+    { 0x160E8DE20D851, 0x2D4841DBF9AEA, 0x7B73E22F4AA15, 0x79BEDEDC1AABA, 0x255B2E88055C8, 0x1386B6B8D5D07, 0x236CFD8D56410, 0x4D8AC4C9E41FA, 0x0A57DCDEBCD5F, 0x72750FFE92D62, 0x32C696EB18E3D, 0x19A2D48CD77D1 },
+    { 0x55E9274DC615F, 0x50B55280662B2, 0x063AF7D9E3159, 0x0F9CE7DFBC38E, 0x7E9142ECD81E9, 0x7741B00168D71, 0x5BD3CD1F12078, 0x4779A63C41E31, 0x4200949B0E742, 0x6B3D58C0932BB, 0x05FF401702C41, 0x0640A02291AE9 },
+    { 0x2449911F3C2DD, 0x7A96DCDB34804, 0x66A020E71B4FB, 0x2D664668CAB48, 0x4DF9E90367BC7, 0x3CCAABB6F1F0A, 0x4249C0D22394F, 0x774FDD090B261, 0x441DE1D32FD95, 0x7B39E97C2907A, 0x1A81E472F697A, 0x1DA6E07963331 } },
+  { { 0x53E769384356A, 0x45616DD69B0C8, 0x5C6CFA2AF6C16, 0x344DE22E2A9DD, 0x70871EB404548, 0x1B2B00D7BDD71, 0x3822C4950BEE8, 0x7F0FC520FC6AA, 0x12AED72708736, 0x45B8F72CCD14F, 0x0CE1DBA70B882, 0x251D58749AC15 },
+    { 0x39CA7B06C4428, 0x0435B35144CFE, 0x0213E499DC4DA, 0x6EA32E1BC7C41, 0x1A8DC5F222F10, 0x29AC489717DD8, 0x6A9CF16B3BA63, 0x36830E7F3B9E7, 0x50921ACB0D278, 0x5F12070F5A213, 0x20B75228F4604, 0x0F34190FEB746 },
+    { 0x156D0042DA28A, 0x516BC2A8BDFC9, 0x51DCD0E1B417D, 0x36DFB23484677, 0x56B26C56C5742, 0x77E449405DA3C, 0x7995ADA122FAB, 0x33EB809E24C0C, 0x49015D860DD5F, 0x77555449AD957, 0x5D233EBF07D64, 0x39BFC87F5256A },
+    { 0x7A15664AB56C8, 0x2C5E8D970127E, 0x3DC641C8F8A95, 0x197D0D566E685, 0x6891989A73E94, 0x7ABAFE068CBF0, 0x30F8A69AAA68D, 0x71267FEDA5C46, 0x340B318EA07E5, 0x099612705AE14, 0x535C5C585C76C, 0x2E8E6CBCEEDB3 } },
+  { { 0x2BD69CF676316, 0x2DCAF9353A87D, 0x479ACD5876DF5, 0x048392B694226, 0x76F04A9BE228D, 0x542174308C4C0, 0x66D54DD985B0F, 0x62DF57832EAF9, 0x3811C611D4DC3, 0x01E91D68DC983, 0x46D41A151B106, 0x27DA5DCE6A841 },
+    { 0x216281A11DD61, 0x4C32CA815A0D7, 0x716FCA0923075, 0x33D6B3604DFAC, 0x1F32DF5DC9A3D, 0x5EDBBEB1958FA, 0x5ADCB0E641251, 0x055607E382F66, 0x38459BDEA57EF, 0x1A7564F1F9F7A, 0x60EC08DEB2694, 0x25473E01EBB6B },
+    { 0x4B2AC8E4B4B74, 0x77291987B6D18, 0x6C51F2BD045B3, 0x21FC9CDC8BBDD, 0x5B0A38D2B7586, 0x22AC16EC5342C, 0x41A5DBCEE9777, 0x00B77DC1886EE, 0x61D886FAEC12C, 0x452D8BD7976DA, 0x3279D617573DE, 0x2BF6BAF568F72 },
+    { 0x0A7B31981A983, 0x462D7250812C2, 0x5C066AAA1672E, 0x3CD8F7A7A5BB7, 0x38BE690502796, 0x546B357EAEE48, 0x0018C215F78E8, 0x5EA75448BBC01, 0x76BF69D06A9A5, 0x4E564A59D98B6, 0x315EB31A28E4B, 0x24005E38014BE } },
+  { { 0x74DB2DFF4D45E, 0x770D9E19BD68C, 0x4083DBF716E84, 0x210B1D74F12B7, 0x0392D52C82E82, 0x0FE42210C4AD8, 0x20D381B94312F, 0x0FDF02DD7FB95, 0x38B119EFF3128, 0x30AA82ED70B77, 0x379AA2FD4D751, 0x346A475E1EB35 },
+    { 0x73D47808963FB, 0x0DBB050B9732E, 0x10F078C3FF925, 0x5CCF68321D4D0, 0x59C7A9FC60C1A, 0x0F720EE09817A, 0x49C11B8651930, 0x3CC0EA0E82764, 0x6E58E9DF03737, 0x1D35E437827CB, 0x77ACBF9374A70, 0x1835EF455BEE7 },
+    { 0x1463C13C18F4C, 0x51BDE1F379D44, 0x1C27D5ECC297F, 0x41FD21A3FBF70, 0x3BA82AD955985, 0x07794E9ED853F, 0x59AA4F40C4FC1, 0x1B1A44E0BFDE2, 0x2FBA987372D67, 0x657F2097DC41A, 0x56FAF1F5A7909, 0x2ECD0F48524D0 },
+    { 0x3E61E97920C59, 0x79B281BC04FB0, 0x7D71F02649674, 0x4F90D84FC1CF0, 0x476D36A0D0394, 0x74BDA783162B7, 0x34F0A1F504ECD, 0x6C8C19A94CD9D, 0x69EBEE7FF94DC, 0x797FCF2AAF230, 0x4D0DFD748122E, 0x30ECDF1E1C4C1 } },
+  { { 0x6087D2C9C5F2D, 0x5A080166B9CE3, 0x0F7E1DEF869B1, 0x27FCBD8A5579F, 0x1094517D1254B, 0x7CE55A4224AEB, 0x7DC0ED9379EEE, 0x3F5C1D716B92E, 0x5EA4F8FD8900E, 0x48ACB7E5D5C6D, 0x6D86268A9B40C, 0x387EBB08FD3E6 },
+    { 0x641A1FCC2C967, 0x49B91D4199280, 0x2760694CBAA8F, 0x2ED68B439D9E3, 0x602111E7DB18D, 0x430521921C32A, 0x63D508A36FCEE, 0x50BDD8242A225, 0x5BDC6E250BA45, 0x535959935B5AA, 0x111DA74C73643, 0x1B35AB01CC93D },
+    { 0x616D1B5AB43D5, 0x082E37CED48BD, 0x11B0A58BEC3EF, 0x29F30B99D0616, 0x7D37C942B5F56, 0x6B9EDA6418678, 0x63A9C45ABC37F, 0x01720DEE7755C, 0x037946FDC85CF, 0x6E859EEBA51D2, 0x34F38E7C3E08C, 0x259C75281C184 },
+    { 0x11DD4BCF026F7, 0x1EC6101B6F0FD, 0x066927E3503D9, 0x609717B3CC569, 0x56A3FB4F65BAF, 0x2FB58D810FA29, 0x08103A63A0BBF, 0x068DADD2F755C, 0x093831A15FDF9, 0x3C995C9014400, 0x501A5415860B7, 0x345EE48E06EDD } },
+  { { 0x074E992561F38, 0x2F16FB9B29A8A, 0x2D4103A9D2F0F, 0x0507671C21A57, 0x3F6B011230E3C, 0x574CE40DBD6D8, 0x36780ED4E881E, 0x5996A48A664FD, 0x5B10F764C39EE, 0x34A204798F7EC, 0x014721D0ECD8E, 0x10B8AED526D30 },
+    { 0x1D03884532A3E, 0x4BC84988255C4, 0x268E262E9390B, 0x01B4D6B4D27DA, 0x665FAF4DDB10A, 0x0CEFCDEA630AE, 0x00FE2BD41A3FD, 0x769A5EEC1316D, 0x6308C8DADED93, 0x0D9574BE47A62, 0x1957209117C97, 0x17706FC9DFB7A },
+    { 0x74FA9239877D4, 0x53F2DDB113079, 0x2291C49B080EA, 0x2DA0D7151EEB6, 0x65B849BC8C879, 0x16E4181123503, 0x6F6CD32973119, 0x28C33148B79BE, 0x0222EDB53E108, 0x5105977F41518, 0x452BC35EA700D, 0x30B4669116218 },
+    { 0x5C100CD198CB4, 0x490A281A233E7, 0x1CC3DBBC55FAD, 0x7871330201992, 0x3293912DA027F, 0x1A8F0BACBB8A0, 0x3E8CBA8FA7B3E, 0x1137A7C6F74BB, 0x463B3BF8E0ABF, 0x1D25A5BFDC042, 0x4B73D8314E7C5, 0x2A64E22E4E1D8 } },
+  { { 0x6F64B53CB027D, 0x511C9F86E786E, 0x65A66A447459F, 0x3310979CADE2F, 0x208A47755CBE8, 0x42270957C15BE, 0x238CE2E713CF6, 0x2E07BBCF6B4B5, 0x5DE216A941BBD, 0x6BA7BD2CB5A4F, 0x734483F82F69E, 0x09B6999C392AB },
+    { 0x7B1424ECDD7F2, 0x125F6DCFAEDA2, 0x5F2779B991E06, 0x7051602552559, 0x312691B97BAC4, 0x6F2FB838E8EB5, 0x5FDDA9907B444, 0x49C179C8A6F1F, 0x7A282D5FFE3BB, 0x62FE0D6427023, 0x36D88A8F182D5, 0x1D450F3B7FD85 },
+    { 0x666F9A437015B, 0x4E238EF674422, 0x27597384A7695, 0x3A5EC34EFF3E7, 0x55AEB2B8A6E74, 0x75CDBD5B42D8F, 0x49472D48443CD, 0x75FD537F3F18C, 0x357943BFE51F6, 0x4F2A97D1D6D57, 0x669E3CD555E8D, 0x27A10EF8A780D },
+    { 0x1413636B1C9DE, 0x653946A8FB86A, 0x329D203F9CB1D, 0x730BFF60BD9C8, 0x64E143299C156, 0x60D0915254364, 0x199B2BE864764, 0x1E5EC39D17690, 0x05763C3470919, 0x7969B1EA22044, 0x7058D38911AD4, 0x1F1E893AEAE71 } },
+  { { 0x47EE849740A1B, 0x3F7BC0EED5363, 0x691FCCD837E76, 0x40E157EDB2543, 0x6EA03EBD26E78, 0x49FEA65795DD1, 0x01636F749ED45, 0x306B2F8CC50B6, 0x7383A8C879C68, 0x52FDDC3FF254A, 0x2C31B6341B03E, 0x25764C94C5779 },
+    { 0x495C98776C46D, 0x160749AEA1D45, 0x388A29027293C, 0x3D7CE4AA9D1D8, 0x71E5F307FFA76, 0x7352D0CB96A1E, 0x18A33C0E0BA75, 0x55B26F12CABA1, 0x0EE2900C11D63, 0x3761177907D74, 0x608C181BFD09E, 0x0FD3EB0EB0B07 },
+    { 0x0D3AFD248C77B, 0x642B0CC03D0C3, 0x48F8E6CD76AED, 0x6ECFF34C3A709, 0x20452728C7848, 0x45565B8382BB4, 0x6B0122AB39377, 0x7916E43F63C4A, 0x36C00160B3A2E, 0x54DA58D5BBCB2, 0x04D55996DF846, 0x3CC2220703171 },
+    { 0x28A40FEA1305D, 0x62ACDF63C6EBA, 0x5D6B69AE7AC25, 0x3EAC79F7F8A45, 0x77CB912D6A2CF, 0x50F9532D40815, 0x7751EFEC968E7, 0x434CDE2505224, 0x0823747B8DBB1, 0x3F0EC11239E4B, 0x10F4A5AD3D61A, 0x2331D2CBD0D5C } },
+  { { 0x6EA4F95FE4AE8, 0x41B7DAE3A6F1E, 0x3FCC2CCB6E1FC, 0x7B95A09741212, 0x7313EBB45F750, 0x4D9FEF844B974, 0x4EF29A535B3E7, 0x5CFD71F7743A3, 0x60C0EF1964F9F, 0x4D4BFDB17E653, 0x318E73B5F76E6, 0x19763E1863137 },
+    { 0x5721F9DE26C08, 0x56CD808FC2429, 0x0B65FD8F6E31D, 0x28A3D389B9B59, 0x08EBEA3E755A9, 0x13536B93FC871, 0x1D90B00A1FDCE, 0x75059EE41A7AC, 0x0B20C00B49864, 0x71FFBDB397E0E, 0x106CC458FB285, 0x1B6F9653341F4 },
+    { 0x179BC709CC3E4, 0x5C3C495A25674, 0x51EE8F578EE1F, 0x70289F8CC7579, 0x292022C62E0E5, 0x66FD96C6F61E6, 0x0A017087FE733, 0x0AB8B658A11B5, 0x0A757C1C650BD, 0x603613C723CEC, 0x0C62B3CFFA14A, 0x28A94FACC87CC },
+    { 0x4801A8DF8B0AE, 0x13025201ABC9A, 0x428E9805D4007, 0x5BCE8A7118BCD, 0x46B99A06D8169, 0x5F027DE428405, 0x01550C8B34C3D, 0x14FD240001598, 0x7C193AE5C0D20, 0x5DF003B222067, 0x48B04A0E96E61, 0x327CCABF63AE7 } },
+  { { 0x00046BF1690F3, 0x2E203B0AC14B7, 0x4E6E9568F44F2, 0x289AF9107204E, 0x60B224E38AA4D, 0x25F62A0A097C2, 0x0D5E9007D3012, 0x3E086D7BE566E, 0x17C63ECE98A95, 0x6599BCE5D2555, 0x6C48A119B20C6, 0x08B678E159152 },
+    { 0x22E73B7A55BA0, 0x68031D6AC130D, 0x2FFB4194E47A4, 0x1BD5F87140A7E, 0x5EB0DB1028A97, 0x7F4F2299DF5FF, 0x615F24A4AAE3D, 0x5247860E5BAFF, 0x0B42E1DC08561, 0x5694F10EF4349, 0x4359FAA1046AC, 0x19F4EA9B5667A },
+    { 0x069A97EE4223F, 0x4A612E65EDDBC, 0x6B18F31C91803, 0x300B503018E74, 0x1ADB40F39A359, 0x57B8FE7EB32E2, 0x0604F49EFA8A8, 0x57A1DE6A386BB, 0x509EF071D797A, 0x5AA15A1479601, 0x762BFBC7F1961, 0x20F595252D26E },
+    { 0x03C2162BCA32E, 0x3F32B0A59C179, 0x174D393943FF6, 0x39C5E8CF7DFFE, 0x10C54ECA97E5C, 0x3DCE18350406A, 0x4B21FBF5BF172, 0x5C1598EA815BE, 0x06CEF5E322190, 0x1BF888C0012C0, 0x67FAD3187BA96, 0x241FBBD26391C } },
+  { { 0x6362024B37C35, 0x265D89B30AED8, 0x6A32F081E3FE7, 0x07946CB972273, 0x1DE3AB0E1D93A, 0x3F339B86FD828, 0x214DD9C5D6F2C, 0x1BDCE7C57547A, 0x67450D2D6BEE7, 0x7110259F9BD30, 0x64FFF1169B4E4, 0x40A98E8EC5466 },
+    { 0x414D98448D621, 0x441E4DBF64C37, 0x5E0C8FDDBFD99, 0x0BB92A1DA9B8B, 0x2D0C23C4CCD4C, 0x5C733730A1B9E, 0x4E07066B5A923, 0x10DDF02EE10FD, 0x29A6F92AB3D36, 0x3FAF9AE4EF56A, 0x514AB6DDA224D, 0x1455483B3BA0A },
+    { 0x5B3FE863A190D, 0x6063F7D51B818, 0x1F2171D690677, 0x7C1FE72532FD4, 0x3E52E15AB197E, 0x54A7F64B9A2F7, 0x47A2F6F7B23AE, 0x0C4CD3B8530C9, 0x6B62F351B36D5, 0x239BBA3E2EB55, 0x7FEF2C59FD2DB, 0x32EC73B659164 },
+    { 0x0F9ADD2080313, 0x788DFE7EC6D74, 0x05F588B5A1067, 0x72E36BE52A8C3, 0x09414A98CA375, 0x47C00B2D2CBCE, 0x2F340C90C9A7F, 0x518C4390F6813, 0x3CD6BB6A8AE0B, 0x25EF8D9EBC3D7, 0x69E54CD858EDC, 0x2F589B70AA3A6 } },
+  { { 0x3D2DABE23F6EC, 0x10C85796AACB2, 0x57E7AB51CBEDA, 0x7BD14605F64C1, 0x2BF91E0B2978A, 0x41328E6317702, 0x6DA2CB9D9DFA2, 0x0A715B873AB92, 0x321CE66F3C0BF, 0x18882BCEA8908, 0x42CECB5BDD517, 0x20C943572C226 },
+    { 0x13F2B87CD2D9F, 0x28F008F4D653D, 0x7AFC34A7E9C44, 0x46677D25CBC3C, 0x3B3F7953092F2, 0x5DC2EA4039432, 0x09B0AC697085D, 0x78BFD4DBB305D, 0x65E327848DA40, 0x43387AC9B1E83, 0x01FA2CCE79284, 0x165DB488C3D5D },
+    { 0x532E78BB020EC, 0x49063A0302409, 0x6B5F110995943, 0x19A2CDEA21ACF, 0x7E09C065D6806, 0x02234BC133165, 0x758AC300E50BA, 0x4D6151CAEE2BC, 0x14D4C2158F018, 0x260DF4F5D1D95, 0x601B2BECBF64F, 0x30BD4F00F225F },
+    { 0x733CCF317DAE1, 0x50CBD534338CF, 0x1170F39899CEA, 0x058876B78869E, 0x6AEEB2691C33B, 0x372F72D8F25D1, 0x5783975FC6A1E, 0x0167EDB735BC5, 0x37B46ACBE0D95, 0x620944B9AB7CC, 0x517430DA3414B, 0x24DAC46AD0FBD } },
+  { { 0x12840361E9152, 0x4B7105B438B55, 0x051EAEEFA9224, 0x120F976A8781A, 0x187081527598E, 0x2A91FD133CCD0, 0x4E7CDCD4FDAE1, 0x7D839D413A842, 0x75DC71141C69D, 0x7ECFEB34F095C, 0x61B57D494DE38, 0x266DE3A130F29 },
+    { 0x0288B05FAB1D5, 0x6956130665813, 0x21F3AA5096B73, 0x6259DD791077B, 0x414643CCF5267, 0x4299735BB2A5C, 0x2F94DBD1FBBB4, 0x280E569886FB4, 0x1AF9387A43DA8, 0x2F6F50A31B0DB, 0x0882204429617, 0x0ECA5EF9E1C11 },
+    { 0x1146F95E9A3F2, 0x6D89A0F56BE6F, 0x6B70B46AED91B, 0x563A71A4A0FE8, 0x7820918A64DFB, 0x43DE822A57967, 0x42712697ADE1A, 0x74CDDC8C1DC91, 0x59D5C6D5BE3A9, 0x305B6EC7AD1C1, 0x0AF9CA09FBCDE, 0x2AC99A0030E5B },
+    { 0x13A52EE6EB419, 0x57AA7CE1BDD60, 0x310476B398983, 0x1F432295982C5, 0x5A48FDA6209D2, 0x3966EC19E10CD, 0x282AE4882718A, 0x5C5AF506BC492, 0x0CB78B5AAC3AF, 0x5394A8A293B5F, 0x1C96DCBF0B969, 0x2BF3886E4E80B } },
+  { { 0x2BA52D7CEF656, 0x23CFF7FC7287D, 0x587F81A0424AB, 0x0670BF13F3622, 0x22725B9C8428E, 0x3E5E56C2F575E, 0x0A4DEAFF5774C, 0x2BADA53326A1A, 0x7676E2E996BF9, 0x0A05983613620, 0x58558ADACF827, 0x2E4F7B79DF014 },
+    { 0x595A41A2E2183, 0x32FF2932FFDEB, 0x4AADE4AFB927A, 0x7534CD26A124A, 0x761274B2DF1E0, 0x7F13E1A50BABB, 0x709F86DDFE999, 0x1058644BF4AD2, 0x42FABCEFD4772, 0x74D9BE719B303, 0x2AD821FF93B3C, 0x198DFB489A57B },
+    { 0x0C6BEF288F10C, 0x01B86291A4D3D, 0x5F899D23BE128, 0x0495421AF5511, 0x35AD15000207D, 0x6438EEBB0EDA0, 0x156AD58E73FA3, 0x34517E22682A9, 0x7C474B9AFCD81, 0x2948D94FBA35B, 0x46803F0F2289B, 0x3C540C3B5F9A3 },
+    { 0x2D616B2493245, 0x4933D8E4FBAB7, 0x79021EFA260BB, 0x5653D000CBA88, 0x2E6F1334A0208, 0x2A70C418EEB38, 0x6DAA2BA690696, 0x1CB87AAD0B8F5, 0x4F10C2EE9C1A7, 0x6831DE9E5E7DF, 0x0EA6A4BF7CE73, 0x2D83956056765 } },
+  { { 0x694244F98BDD1, 0x0AF40B40AE6A7, 0x4937BE6A08764, 0x3D7110C2C9FB5, 0x05FAB67B03A64, 0x0B588CCD69AD1, 0x4561E0070B2FD, 0x76046B46F98E8, 0x65557A5D5031C, 0x1B2144EE02C25, 0x729CCFE7D3F1A, 0x173647D7DDAB2 },
+    { 0x51B48E8718A14, 0x6A2BD4BD6BE16, 0x1E03361813911, 0x4116DC6DF86F2, 0x38B3B556AE85F, 0x459A4B804A30A, 0x30695153AD22E, 0x1C495E4DAD910, 0x2BE72D8A96325, 0x065B42BA80985, 0x7BFF057F36260, 0x05D1D1D86CDC7 },
+    { 0x0DE21746E4FB5, 0x75FDDC4C317E0, 0x0622961519C1D, 0x7FFA47891AF49, 0x21DF8741529C7, 0x331BA8421A82E, 0x5C61B73F2052F, 0x0C699BB8A3158, 0x498C411D404C4, 0x6CF7979FA6AFF, 0x63E2E9C06F9B8, 0x2C1677E171BD5 },
+    { 0x00CA99698E318, 0x44A6B1FCC5154, 0x3B5DF81C6D17F, 0x1070F092271E1, 0x5F63D9952B940, 0x361136035AB33, 0x70DEC6E67DFA8, 0x728A9557E712A, 0x2137D2DD08229, 0x0CE11F308B6D5, 0x312F15BED8762, 0x2785B71FA731A } },
+  { { 0x2C23915D7CF2D, 0x30B30F50236D4, 0x1EE146D20D4A3, 0x27F1409A5BD70, 0x120A8BAB2E492, 0x0B8D9C3313141, 0x78345BA00CD18, 0x535B482BF2890, 0x271EF2E8DD418, 0x623CA9156B5E7, 0x17BC6D2B7A046, 0x33E4AF5839189 },
+    { 0x548EE42572894, 0x0A515516E3254, 0x3E567A1F5860E, 0x767CF56661716, 0x6C0D79C905053, 0x0FA7ABC022634, 0x52584E5254B3C, 0x2896681BBF65E, 0x423A8379054C9, 0x008A6A2EBDFA9, 0x527E15897AA33, 0x0BF1633922EFE },
+    { 0x7DE026FBB3383, 0x08280FD9EA37B, 0x598F581E5922C, 0x74DFBC31CDD3B, 0x32BA8D367C172, 0x4BB09CCA9CAD0, 0x38A0B710015B2, 0x2EE3080EECFCF, 0x720CDAC737B28, 0x6AED418CC873D, 0x268AE390E7AF3, 0x4164AAD293EC0 },
+    { 0x40A1C45202D9C, 0x6A18349FBC28D, 0x67EB5F44E2F2E, 0x2A49B2F40E698, 0x5C80E946C96CC, 0x067BB5090BCF5, 0x7FAB48061C5D2, 0x10AB33D6C1CDC, 0x3D7BDCF7F90A8, 0x10A259BD6F3B4, 0x5D58393D8DB62, 0x2E54EE2175D55 } },
+  { { 0x025875B935485, 0x459A5FFD1E037, 0x0B67A9FF609A3, 0x2C99E49FAC91C, 0x23E2D2C1B8ED6, 0x15DBFB5CD2548, 0x4929275AED9EF, 0x15A61DDAAD836, 0x4BE51D39DE399, 0x52B9D9D6CF741, 0x5D509B7FD7A4B, 0x4226A815D926F },
+    { 0x432B9BD73AF86, 0x5098082D68113, 0x534BA521B915A, 0x679BEFDCA85EC, 0x0FAF8728F0DAB, 0x739611E82120E, 0x6A0D6185E737E, 0x628B6670BD86E, 0x75628B1FA01D8, 0x34FF9E3788E79, 0x1104A5E5C3F56, 0x178ED64B107D6 },
+    { 0x6D6128A78C425, 0x054C8AEBE609E, 0x684D7D0A589FA, 0x5C6F178970743, 0x03267B1E9C219, 0x0F318BA6F5441, 0x0C6EE44F9716C, 0x5627B8EAD7FA0, 0x1348018012F49, 0x642A8EB7718C8, 0x0C14C783B88AD, 0x22268A8A2AC13 },
+    { 0x655AC74704FB2, 0x6271A24C43EB9, 0x3D545DD21ADEF, 0x534B48761E55B, 0x3A7EDF311C40D, 0x79347D33C441F, 0x57F65C5D79BF6, 0x03D2487CBA6C0, 0x55644CF584573, 0x4522BCE00E79C, 0x70EF3A4E5F4A3, 0x1AB77B954BFBF } },
+  { { 0x5997F5F5D7292, 0x27A3E13404F7E, 0x68548F36B71BD, 0x65F38210C5718, 0x65BD0746D5056, 0x407DEAC6B1AFC, 0x61814F8042CD9, 0x74CD3CCB49E02, 0x6ED8F1748B751, 0x4919CE0FC204E, 0x5841AC1AFD3A5, 0x3D22C60F001F1 },
+    { 0x2DC38F363D1BB, 0x6B646C2130B5E, 0x6109175525062, 0x45DE80246D1A1, 0x1401347A4F07D, 0x5C65E6F71FDCB, 0x0D5641733EE87, 0x6660104F48416, 0x73CEC2CDA4ED8, 0x4FC694F724491, 0x03E2AD58B7F66, 0x1E7C4A29FF0A6 },
+    { 0x157AB9BE4434C, 0x7F615D80F21F2, 0x7376CCEC4BBBA, 0x0EE4CE4E73C53, 0x19CFAD6FEFBC9, 0x70655AB21F1B2, 0x29CA5AA900A69, 0x3E99E588BEAD5, 0x6980869E4AF18, 0x484E99CD14C80, 0x3089DBBE6CD09, 0x2957FB2F01ADC },
+    { 0x0704416E5A175, 0x18F01A2696F9D, 0x55E166B3527DF, 0x2A0F677A61792, 0x57F26D7917C12, 0x3200A5C8F91F1, 0x5B075B6F51717, 0x34E63A295AD57, 0x39A4E5D9C5B29, 0x4E7822537EEFF, 0x10EDEB2257663, 0x1B6D9834AE66C } },
+  { { 0x58B178F957A0D, 0x0E1BC0F8E63EE, 0x07F42A8651B19, 0x1AA4ED9CB8840, 0x04273BE91DD58, 0x6732B64307553, 0x7C2DEA87C43E3, 0x2085C30E2C506, 0x681941EFC4978, 0x103F8F494779E, 0x4BA24775B8C54, 0x277D93104CE01 },
+    { 0x34F4DDC55835F, 0x3C82038CA7DD8, 0x57C65D9F8055C, 0x41F0D4FFEF20C, 0x114EC0D290EC1, 0x43FC9EEFDDF34, 0x2BC03706D8DC1, 0x041BC5683D446, 0x703CF857974C4, 0x39934B60062DE, 0x7F22509FFC517, 0x13AFE249CA26E },
+    { 0x5A11AD258F19B, 0x1C9F39ACD08EB, 0x5A1816C7C6185, 0x6814FAE7D0DF3, 0x2B9D3683CEA7F, 0x0878C62261887, 0x5E7E69568FCD5, 0x7E2F388A3CA3D, 0x610288A20F7D3, 0x54D12020AC6B5, 0x68D1FE50CED03, 0x20C74C27FB88D },
+    { 0x2D4EF94A6F9EF, 0x40CF35D1B8A63, 0x2CC19F3C3AD83, 0x70198BE10E7B0, 0x63DAEE8DAE616, 0x020EC0D792A7D, 0x0256D84B7EDE4, 0x19309B35FFC9A, 0x7AB4C3E82178F, 0x59834C51BB396, 0x4B0CDD310C13D, 0x1E3F96DD681DF } },
+  { { 0x34143C89C153D, 0x5E9700F93D7FE, 0x0F378F05CF538, 0x7925AC771C6B9, 0x5765AFFC7EAFC, 0x54DF8B2A15E26, 0x31896FA2EA9B0, 0x293463CBCAFB8, 0x4DCF5A1E203B1, 0x67BAF177AD405, 0x4065A9D3CCC00, 0x116DB73A162D4 },
+    { 0x4C6C6B421E542, 0x7DE823784A3A8, 0x3D3DFEAC65F21, 0x1938CB5523EEB, 0x035799703ECE3, 0x32F4A005FD6FB, 0x41AFBD09BCE4F, 0x5E9548B4EBBE2, 0x358733CBDB30D, 0x54C0757B51007, 0x20B420519A3F2, 0x12BFF69682ED4 },
+    { 0x7D420C312A8DD, 0x292A1460EB22A, 0x0D4C1DF0215D3, 0x02EB157E48D0E, 0x10A59D3C81521, 0x2FC1922F132BE, 0x0E3EAB9203E98, 0x1BA8664924783, 0x042F6F69265B8, 0x0C60C010BDE27, 0x1EFC8549D6575, 0x18DBF092022FB },
+    { 0x7682085D63332, 0x4F179554C160F, 0x51038D9DF1C48, 0x286AC1580D00C, 0x7A12338FA7551, 0x05A0D16812140, 0x0B12C84E52A41, 0x3779C6D185AA0, 0x5E7DE296C7D9F, 0x592574E616DE9, 0x2B56B1BDCF286, 0x2234072C23766 } },
+  { { 0x17B36E3E93D43, 0x3B9E1895591F9, 0x42E7C0D05E093, 0x106579056060A, 0x77AF2B5F32FC3, 0x61E9DBF23F1F7, 0x49F4EBBC941CB, 0x554FA5BDE172A, 0x5A51C667F02B0, 0x505E6D263D736, 0x321982F54A842, 0x236BBA632BBC2 },
+    { 0x4D41673B1D168, 0x3F9BB1C5F085D, 0x0CC34EA0507F5, 0x55E21EE5D5028, 0x3C0338824CF49, 0x07559EDCF020A, 0x6B2E5CBF83CF3, 0x068A0B9E7935D, 0x6B55E08880422, 0x67047CFD6ECF7, 0x560D56A68D9DF, 0x1B3B62E5E496E },
+    { 0x1061995331099, 0x1D7D15CF1F0EB, 0x6305A23E06A6E, 0x4BC1925D71C2B, 0x0CA5C953E143A, 0x0E43C754FCC48, 0x4E1C40D69413D, 0x6E453EBB7D687, 0x3A59CFA737BD4, 0x27EE44FFA0826, 0x05B05ADA4DD3F, 0x4A1621F7DCBB1 },
+    { 0x791166F99505E, 0x3BAA04CA06EF0, 0x20DF178C2E793, 0x6C1F3E79CB73B, 0x4D63E99E3B56E, 0x6A1EE374E3ECB, 0x72EA15C920799, 0x77185A44F67C9, 0x4922926F48561, 0x00FEF6C1B1F5B, 0x48829F06A6807, 0x2D476E0961CC4 } },
+  { { 0x172FA9946A576, 0x0DDE57943290D, 0x772B5B66D5824, 0x0123F26486833, 0x13D7B178C9EF5, 0x4BF97B659389E, 0x4FF8DAF099B55, 0x17073CFDDA0E1, 0x2EC26308F0725, 0x375BFF0F38809, 0x2032433732BBA, 0x2A5DC3D0C09D2 },
+    { 0x2B0FDD8F19230, 0x167F15F273343, 0x4286FFCBD7B04, 0x04EEC0846C87D, 0x6B71415A19279, 0x1902B2348CB5C, 0x298C645698D91, 0x1548428BDC3A5, 0x4726DA8000857, 0x2E213AB258115, 0x4EC6DF54617FA, 0x0F2CB9DB0B467 },
+    { 0x41A21ACF511DC, 0x494E9410A849B, 0x3D82813C3347C, 0x3BCD40A7ECCED, 0x607DC5A10F5CB, 0x1F3D6161D5DC5, 0x5A9533E6A8E75, 0x7AC85B1B2B7FC, 0x6A7E3E056EC72, 0x7A635E456FBF6, 0x2BF8850D065A2, 0x3EB50F68AFA8A },
+    { 0x5F5DE95ABE62A, 0x5010EC5FC21E8, 0x293591A5C103F, 0x7042240D0D6B9, 0x19CE7A78F4428, 0x2F0B6D5EC6968, 0x305B2B2714B12, 0x2CDC5A0C74395, 0x75AFEACF6D5BC, 0x1612DA366A777, 0x3594CFD196B0B, 0x1CF0EE02197C3 } },
+  { { 0x5C208E9FEC7D1, 0x0ECD8DA947D1C, 0x3AA5E9432FC89, 0x68F45BA5618F8, 0x59C21611A8CD5, 0x60700570F1B39, 0x3574C9009644B, 0x1B4C07AB9AB18, 0x3E98308F4BEBE, 0x317487C3A718B, 0x4C20D36769846, 0x2A68197B6ABDE },
+    { 0x4A49E6D320904, 0x509C59D6CFB4D, 0x370CAE61422E3, 0x68E8BFB4AE99E, 0x41B3C8DAE3CF6, 0x6D16C0D061B99, 0x29404C214DB61, 0x7660AE617ABEC, 0x3FC4866186276, 0x053B67F9A36FF, 0x58269B57DA12F, 0x05CF71690F634 },
+    { 0x115ED96A831FB, 0x0A37B4D78B2F5, 0x1CBF7239ACAE9, 0x561416C4B6198, 0x22D21C128C109, 0x34BB3A37CF8B1, 0x412AF621AA81B, 0x0B27BF814E62B, 0x743BFA663449A, 0x4CBB65F659BE8, 0x31FD0E5977574, 0x2593A2897DBA6 },
+    { 0x00C8FB76D1E84, 0x6B64198E0CE1F, 0x7740A395B15C9, 0x4AD94EACC8AA0, 0x7628FB4E9AC92, 0x708E6BAD4D37B, 0x12A8E045026C1, 0x5768FA70433CF, 0x78115E1C7E197, 0x47DF2E9BC5E54, 0x0E9BCC4B12993, 0x2B2DF3E659C33 } },
+  { { 0x00C1299D5DC7D, 0x5090585B37E20, 0x2F3F173FEA69A, 0x4F83F6BD83736, 0x09FEF838170A0, 0x339725BBCDE84, 0x0A27CD58E5F18, 0x3F6023FAA12A3, 0x4887F0A09F643, 0x140C75BFD0C46, 0x7C94A63E13489, 0x26488408E9C74 },
+    { 0x13BDDC1BF0857, 0x77D3DE52349C8, 0x13110D820B54C, 0x189D3417B9D4B, 0x1DC644EE2AAAD, 0x2D6E52412B474, 0x6BC093BE1FC77, 0x76C5C0B5FBAD5, 0x341F3428AA001, 0x7D7AC5379F91C, 0x01D6B32792684, 0x1B449E864F692 },
+    { 0x52960858334AF, 0x78AA7C8C73198, 0x57EB0FB2D762F, 0x674E3A106DD65, 0x75A93CBE2DE5A, 0x50108D4219BAE, 0x1A0D3361B9BF1, 0x3804D4DF59E12, 0x7AE7E48A0E137, 0x6FF270C6D0727, 0x7D8C02809A515, 0x0BA207940AB47 },
+    { 0x3DF9257DA33EF, 0x6493840DAEA61, 0x54AA04CE2C40C, 0x4E505C7FEA6A5, 0x3797470EC4090, 0x7D585AD20D030, 0x6B28A0FF24150, 0x7C50EF81D28F9, 0x77E99856F1511, 0x36FF5B64CDA7B, 0x1F5BA28F5C909, 0x223BCC7277F4F } },
+  { { 0x5E5C9C98CE1E2, 0x564A0B95DDF02, 0x38045F08AE408, 0x6EA5D707CBC14, 0x124225AB11701, 0x4312B476BB187, 0x46A167903190D, 0x60967D7993AB3, 0x45C77AEB90286, 0x47AEC72BF78E1, 0x2A8BD3050E317, 0x1456F3BBD6939 },
+    { 0x3A5A474E2019E, 0x0EAD7A5FBA102, 0x254391AB188E5, 0x4A9F302A6F92A, 0x2E7BBDFCBCF02, 0x5484CBC8E82BD, 0x156B912F6E6B9, 0x758DDDBCE9F57, 0x0F3BBF56EFF2B, 0x58604D4E0714E, 0x78AFCBF05C963, 0x17B3FC327DE9E },
+    { 0x2F271A88B1478, 0x3051B047A8D98, 0x24EF9B2AE90F9, 0x18F2B4685C8A2, 0x65474C9246AAF, 0x52C415719919C, 0x575941885B06F, 0x74375AF11900B, 0x4AE1015AB4FDB, 0x5723D5ED99F84, 0x6A1C69F08CB45, 0x141D05C4D21EE },
+    { 0x4802F5FEB013E, 0x6E967DF07F5CE, 0x49B80BC264FA3, 0x3BA2B66874B90, 0x02AB45674EF28, 0x3D785E471BC18, 0x1B23D1758D0E2, 0x1B728E58D7A7E, 0x1C5908CF8694D, 0x5920B352C31EA, 0x656DBBE9C1039, 0x35059CD6FEE0E } },
+  { { 0x33AC451681B6F, 0x0AF6028F549F5, 0x069EB08F63BF1, 0x7BFD6A168389B, 0x730E48BD58CBA, 0x45F4F319630CC, 0x4C7270F18BDE2, 0x26798793C6416, 0x559AFE3968B87, 0x3861B80F24B02, 0x7983EC33E7E5F, 0x35BB54A9E9C3A },
+    { 0x4EA1E71196E14, 0x67259113488FD, 0x18CC2112CCFC8, 0x1E84FE126D3B3, 0x779260D015945, 0x711CA3F0EF0A6, 0x370E69C3AC36F, 0x4991F4D299DA4, 0x271FE24B9274E, 0x5E0D602854F1E, 0x5393E2A961E13, 0x1851CA71F5B60 },
+    { 0x2E852ADA5667B, 0x6D7C5AE75AAA6, 0x63E8F7D06F78D, 0x68F7023099908, 0x7AC6DD2DC6797, 0x7115BA0DBB10A, 0x2057F7CE79147, 0x083B694E637D4, 0x36981A5D45813, 0x2D3ED80951598, 0x408A3737706DF, 0x150FF0254DD4F },
+    { 0x622399D0DFD64, 0x272FFE29D53F9, 0x5DBC89D9B63C0, 0x56C75F386CD2F, 0x7FE11B88F47A9, 0x62331D1A69CBD, 0x5D5D2F22FF390, 0x1842C6C8DADE2, 0x4074FC9C32C1D, 0x5AA77A7E37153, 0x5AEA02E03C3CF, 0x34E9E9A763AEC } },
+  { { 0x0B7B2710DB1EA, 0x047E7515AD012, 0x3EFB81BA8EA05, 0x34C3A9637663E, 0x5B6DB6D2C183E, 0x07334E1C8A502, 0x6A195BDBCADBA, 0x1DD5ADB7932CE, 0x0BE357739A38C, 0x69877B781A98F, 0x3E310209A2753, 0x2E4F4460708EF },
+    { 0x1F1D407AA6545, 0x1E86D2BD011EA, 0x7F211C0D63037, 0x0C3B4886D91CB, 0x70CCC2276696C, 0x7F3EBA6874675, 0x41AA362BA3BD0, 0x4C163AF6533D0, 0x70BF4E72DBDE1, 0x51553DB5927C4, 0x22FC3FCB915FB, 0x267DF70B88B02 },
+    { 0x0AFDAF99CBA8E, 0x717C724360464, 0x61FAEE7362A6B, 0x47FDFCF8CBB81, 0x05CC9AF8D7A4C, 0x4990EACA029AD, 0x45176E4535540, 0x542D17EC0A9B0, 0x7C6A0EEBA9279, 0x739611EC04DA1, 0x6EC29F13A72AA, 0x1DE6DCED46DBC },
+    { 0x27429B39424A1, 0x5A718E892A6FB, 0x2FB90A44A7C0F, 0x67821D16ACF1C, 0x2F214AF4BCAD0, 0x2A7093DC5BC5D, 0x6751BEB789583, 0x50B748AB4F1D7, 0x34CCAD5CFF803, 0x6EB33878F7342, 0x38B876CA346A1, 0x23D75C526268E } },
+  { { 0x2AC23C5D5F7CF, 0x6544FA90FF28D, 0x2CBAF9C86F371, 0x5121F005A9258, 0x11E4AE26A6A70, 0x56972AEC257A1, 0x364EC6504D1E7, 0x05D96302C6076, 0x7156E6584BB32, 0x736D29114FF51, 0x3A2EFC7C0F950, 0x0EBE9E3C9CC31 },
+    { 0x07983E76D4F33, 0x5BB7BB9E2B2F0, 0x50C1ADA6D19BF, 0x64851ED4A4268, 0x347D0FD217D71, 0x69CCE924DC380, 0x430E2A528AD0D, 0x30F8A491FDF0A, 0x5CA6DE8E97A11, 0x2152946C6D9AE, 0x52EAE8CAEC12A, 0x12D20C1188402 },
+    { 0x0222F274C5EC1, 0x67A841C05D9F1, 0x664AB365AF973, 0x6AE29E1D0A19F, 0x12C3A94BB3305, 0x2568E22F4E58F, 0x1D3B1259B77E4, 0x4653C0777E0D4, 0x0FC95D4107B9B, 0x5AE1E44D7E9A7, 0x65A7F8D58D795, 0x1D91D1AF18694 },
+    { 0x4CB91976D9F31, 0x208C74FCA3606, 0x47E558C728D9D, 0x3490A0B1B43C2, 0x5D7A4A0F6B13B, 0x217EAA6445C7C, 0x45B8CA3EBEA57, 0x56DD3D60C5F68, 0x7CEA18972D6E5, 0x546E9E97E1385, 0x34FEFC8B6A9FB, 0x1E0173EAAC3F5 } },
+  { { 0x21D9590C91D00, 0x39711CB5FADC4, 0x4F7A4472B99F0, 0x3241178DEBE17, 0x6FEFFDDCF942B, 0x6D49BAB03B18A, 0x55D69963145E1, 0x2F6D9F31CA608, 0x42CCD1CE95152, 0x4EC9801F13648, 0x1BEF57AC52A4B, 0x2334009C57FD0 },
+    { 0x4E5D4A352C400, 0x4F43F37977589, 0x437287DB4C93F, 0x350AF67C767FE, 0x32E5B37E7D539, 0x0C30077D384A5, 0x4229B0748CECC, 0x6C1780FAA17CF, 0x232390499BF03, 0x0400CFA6C8CCF, 0x0CEB0B8284EB7, 0x10ECCE6D6F353 },
+    { 0x1E9D6494E0F70, 0x27874F6173168, 0x7EDDC2B8F7CED, 0x0FC4665B7AE28, 0x34EF68DBDEF04, 0x564C9161508D2, 0x78F8DDD9E2D35, 0x7BD0A8B871022, 0x5250EF9087AB3, 0x5F1D40C2789F8, 0x0F14A7D798744, 0x23B3F5DD081D0 },
+    { 0x63BF5EAFA2D7E, 0x30DC1A58FB070, 0x1078335DC3035, 0x0863752771775, 0x75610539C5DD8, 0x098D002568ABA, 0x2326B92AE6F3C, 0x511807D9524A5, 0x4CA28780993E8, 0x0977CF840112E, 0x1747B991B6AA8, 0x36D49C161AE4B } },
+  { { 0x148D31BA824C8, 0x25B1FEBD2485C, 0x07FEFD6ED4B57, 0x36C8BD2B13923, 0x5B768F51FCA67, 0x4F6D356A4007B, 0x13A095041EC77, 0x0184E2AC37057, 0x2E097F4ED9DC2, 0x21AD1B8FEDCC7, 0x121A366E56E85, 0x30986363827BC },
+    { 0x7955C0A4CD71D, 0x75DD0C79E97BA, 0x5837C0DB785D1, 0x080ED8B719523, 0x03CA09FF51BE8, 0x4FA244D34EFE5, 0x1367A8EB43057, 0x12B3E615756AB, 0x45A046BF61AE7, 0x0ED69169334AF, 0x4AB973E90829F, 0x11D83B74D6D5D },
+    { 0x794CFC0BE5692, 0x429BD43F185DA, 0x26DB14F9C9706, 0x77153089B9C99, 0x5BE5044F22EC6, 0x565455CB12B69, 0x77BCA2444B7CE, 0x7841D70361C37, 0x1235C3AD22098, 0x5AE1A79F3FB80, 0x217EDF3022A0D, 0x396D830779F13 },
+    { 0x2F7BDD3460E19, 0x136B4616D8529, 0x484FFE0119F5C, 0x65645450C997E, 0x2F3DE836E6560, 0x1B27A7836C16E, 0x5EC360461B280, 0x7DCE5B6C2DA74, 0x0B071E815FFD9, 0x20CFBA2E63AA5, 0x258C8BBE5CC61, 0x2C8E06D8CD96B } },
+  { { 0x350C441100A71, 0x3BFE72511211F, 0x45E54690684EA, 0x345093A4D8AC8, 0x2DD0521284646, 0x3EA01C94831CD, 0x0BD56F0C080E6, 0x16394D7C3DB07, 0x2F56122D59889, 0x1BEDB4A2A046C, 0x3FCD0B3D4A71E, 0x2DDF73B020EB0 },
+    { 0x2F566086A8A68, 0x0CBB26F7C82BC, 0x39D323D580DD3, 0x3A2D6E778ED71, 0x279F8754DB106, 0x59D73C203F5FB, 0x30D782B618F58, 0x62E5F69695E73, 0x37766F7DDF3D5, 0x722AC31492455, 0x26F08AB62667A, 0x137B833ABB8AC },
+    { 0x5879E15329821, 0x7E2E981FE2545, 0x7BB9DDCD03709, 0x0F725D3BABA39, 0x1E74C39F0282C, 0x459FA8739BCCE, 0x79E1E2C8B422A, 0x1DF7884CF1E62, 0x5634C6A5F1C39, 0x4598668E7DF08, 0x2FB368BF75E64, 0x1DE8B25DB5C17 },
+    { 0x69A9002F9351A, 0x40772C259703D, 0x0AE756E15D60D, 0x25F1C2C10FD82, 0x052DEF40FCFA0, 0x37C0E996832EE, 0x244CD17642C39, 0x1C68151CAD608, 0x1523286B64E3B, 0x423AEABDCBE17, 0x559CE72B3B8A4, 0x1DC7C67A5C1CD } },
+  { { 0x04D601E77CCD4, 0x6298E94F84B31, 0x5C0F056A4C12D, 0x5CEA906A2C409, 0x2C495A7961F4F, 0x433086BEEAF98, 0x555B19B293EE8, 0x43B4FCA68B504, 0x664058A9F5043, 0x7662075390F70, 0x5B23B21721716, 0x27DA2A8E1CD60 },
+    { 0x0038D0B833505, 0x27152B4236B31, 0x68B61A25DA751, 0x40E1A09A955AA, 0x5580F13C943ED, 0x236C3362E7D87, 0x71C100BD7A627, 0x48E2AEF4537E7, 0x4C0F9F8B4AD35, 0x7660BCB06EE10, 0x1646ED988357F, 0x17F6FC9FE8795 },
+    { 0x22A1F402E97BC, 0x18A9E6D69FFC7, 0x729DA7A54CF51, 0x221D256D99057, 0x2503BBF936E9E, 0x5BFE840C2C2DC, 0x1DFA2048461DE, 0x6BF0844C6755E, 0x36F0AD9874419, 0x304B05DED130A, 0x56F8B4E187FFC, 0x22A785702BF9D },
+    { 0x4087F619CB449, 0x5345E0FF3F620, 0x762EED25E3BAE, 0x5EBF927F53863, 0x169570795DC35, 0x67B489A6C1F9A, 0x38A7551234227, 0x688AD02789B4C, 0x6153DCB3D9E4F, 0x486FB1A9EB981, 0x28F05B0475AEA, 0x366DB8A0E1910 } },
+  { { 0x1EED6B029CD17, 0x7B8C8C296BB0A, 0x0E9E68E1F9F3D, 0x72F7571A66764, 0x697E79A8FD8EB, 0x1100E807C0529, 0x7B2B4BC03812A, 0x20049F9858C99, 0x37D2383F42E6B, 0x4E08AAFE75124, 0x4DA71562BD57D, 0x197A2C3A636E8 },
+    { 0x7463B1BBFB7C0, 0x60269670B8413, 0x631B1D8A95BAD, 0x3935D05CB177D, 0x0D4AF2D2B1D9A, 0x78F3BCF3F1ECB, 0x3C692132B31A5, 0x5CDAC5E9A8885, 0x0BD26C2EE2CF0, 0x7D87996A458B2, 0x1E3B41DE0282A, 0x1AEC3F56EEB1A },
+    { 0x1A008C73E49C5, 0x507D3A23BED95, 0x08A10B43DAD22, 0x67223D3F3D871, 0x1026696D65389, 0x2E4B32C51599C, 0x1828B9A87AD1F, 0x7F09F6EB19306, 0x62CAA9B4606E0, 0x302776D773CA2, 0x58CF329488B1D, 0x366CE7748E050 },
+    { 0x591DAE9EEB254, 0x2D4233E5D7767, 0x45BEA3D711DDF, 0x72814E98D47E5, 0x5087BC6408903, 0x699037AA44D37, 0x68A036C924749, 0x6F6D0F328FB42, 0x02DD56FF2861A, 0x60FCA97E43C69, 0x307BF39BE9441, 0x1D46F5F66075F } },
+  { { 0x3E2B265CAB1AD, 0x10F457EC0C781, 0x00AA4AFAB4A39, 0x61724DF191F8D, 0x200F0918F0215, 0x0B9CF06DB032C, 0x385DF3418A49E, 0x2E8D8D264885D, 0x68AD4F7C982A6, 0x072B03A6080DC, 0x27D6332D9D7D1, 0x39E31B67C32ED },
+    { 0x68AFB721C415F, 0x4DF9A06B0B1F1, 0x270FB05A97021, 0x0AE2300D4D699, 0x526B65348439B, 0x6D7E6FA7DDAC9, 0x1FFBADC9D19BB, 0x20BA378AECDE7, 0x19B3AE9068F07, 0x7F431A8F5675C, 0x750917EE75780, 0x0DA2C64C6A8CE },
+    { 0x6CE4E9D7FA713, 0x69344322B548D, 0x7F30056B750B5, 0x4FF202B65D2CE, 0x68FCF2C0B068E, 0x32DF969A0EC18, 0x39A3FDAED1B1D, 0x1246AE1D88821, 0x5F59ED6B1D303, 0x600163E7A5AED, 0x2603A990462EF, 0x397C53BFABF3A },
+    { 0x487BADF0E67E9, 0x49F9FBAA05936, 0x513847E207C63, 0x0CFD94B6F2050, 0x5D3F640155B7A, 0x3DCDC7F926BC7, 0x043A34344E7F2, 0x5BB9062AA9F76, 0x429C01EDBB3D0, 0x57034C612F19E, 0x0A725C87C2BAD, 0x32BCE67F7CE3C } },
+  { { 0x31316FA99533C, 0x37AEC0C865925, 0x1C93D630A91C4, 0x42C341AE79CA2, 0x00C6D0E2536C5, 0x1CBA666D0CCD8, 0x72B4A57B69EC1, 0x7F67D9FDE211D, 0x0884B8D857F3C, 0x080F8DB009B2B, 0x269FC5CB49EEA, 0x475D9C184DC03 },
+    { 0x69218E8E54E1B, 0x4C7761C76CBD6, 0x6423574D20D1B, 0x4010F5913F772, 0x1D1B921DC9318, 0x69D7EB76F74DC, 0x0750D2A9290DA, 0x0D0A4F46C22A5, 0x6B242E18B23D7, 0x46C8D12F48281, 0x08B531A72ECE7, 0x16603ABFC8ECA },
+    { 0x3BE8C8D1E2C5A, 0x414C2319CBD50, 0x0D663937B1791, 0x10C4E618BA88C, 0x2DE47F49F3DE3, 0x14EBE93B7D39F, 0x0A391185E7AA8, 0x1E1FFF92636E5, 0x0D785BC11F076, 0x04039F3C826C4, 0x5E02CECEBDB59, 0x262C06E293F90 },
+    { 0x1D1CF9D98DE8B, 0x7CA478CE20F02, 0x0B72E7E149E94, 0x5579525E63FA9, 0x5C18DADBF341A, 0x619534CD5DD76, 0x31C6C4A46A647, 0x7C440B249AC63, 0x02ECCA70AE6D7, 0x03BC4B379415D, 0x52BF16C0E680C, 0x1E62E0F068FEE } },
+  { { 0x6925E6A3BE4CF, 0x726191C8B08F2, 0x2A9F169247151, 0x251ECC8B775AE, 0x5823F265DBDB3, 0x36154C72DDBE9, 0x354D38F7707E1, 0x14F78D13C7FE2, 0x56C82221DA956, 0x7D208911D0F84, 0x73C57BE8B400F, 0x34A20504A7B76 },
+    { 0x50AA351A1D05D, 0x3813A2316FB62, 0x42333683D851A, 0x16C8FBE990E28, 0x3FA1B1EC21FA5, 0x652BDF12F50A5, 0x3E3720447A51C, 0x0563D076F27D9, 0x499C4A342958D, 0x40AE4553DC662, 0x4B03C813C64A0, 0x1ADA2B956F29A },
+    { 0x6B87F2ABE5F01, 0x0030DD67AEA96, 0x33EBC423EF282, 0x316FDD919D093, 0x1E3499888F50A, 0x233E28C64C5CE, 0x1126E8EDEE3B9, 0x30AA75E5105D4, 0x33B8AF4AC466A, 0x4C3E59638CDC3, 0x206BBC636E2EB, 0x3A7CDB2B52997 },
+    { 0x43C8AD3D16299, 0x67015C634ABF5, 0x32ECE38F3145F, 0x04E1F560FEC7B, 0x72A1A281532EF, 0x093DE890A6E62, 0x2200705767858, 0x0C8FD61A04E99, 0x6700D84C0FFDA, 0x08240F6D3043B, 0x7AE12AC3A23DE, 0x16FF3A86919FB } },
+  { { 0x27058187A90D5, 0x3249C10EF936B, 0x379FC84D64044, 0x3E24FEE2F15AE, 0x3E03EC99A1024, 0x10204323B38C3, 0x1B0FCDEEA6206, 0x79DA7866588EB, 0x5392021C5F395, 0x00A57BA06479F, 0x5D34C212062C6, 0x34EAC5D275611 },
+    { 0x0F2EBFEEBE7A5, 0x1C3B3B8D32CF3, 0x2A769212C21B1, 0x4393BDEDA82E7, 0x5BC7A471DD350, 0x4664063C3DCC2, 0x02D1504B31FF5, 0x4DFF44C183B80, 0x0FFA51FA0C297, 0x1DCACE05E9585, 0x2D831737B3B62, 0x0E78CECC4F44A },
+    { 0x375A639DEE08B, 0x34F00EE6934D0, 0x4654F5D469838, 0x0249C77A3B19F, 0x4F213B6D71A3A, 0x7FFD3C5FA641F, 0x57E1FD98903DC, 0x1806F67C41F72, 0x26C1F8EE89B66, 0x48608598E722A, 0x30479AED730E7, 0x354972C83C6DC },
+    { 0x5DF00166E387F, 0x067461C6DD054, 0x1C987AFE47F3C, 0x1267476720577, 0x693493BC7456B, 0x0BC50C00E47AD, 0x1D8239594F55D, 0x31B2F16150364, 0x43CE94CFF7769, 0x417468E37BB3B, 0x6C8FD3B486AE1, 0x268296FEF2BB7 } },
+  { { 0x4D1F2E56CD412, 0x41D875772138D, 0x57A3D3A143170, 0x6514119AE4328, 0x35B9F182C70EC, 0x770B6DB69A142, 0x3D389513B4085, 0x687E6B6A1E410, 0x046045E762AB5, 0x57EFF8226CA15, 0x161BE73FA4F77, 0x258E20767C788 },
+    { 0x7A5B1AD0814D3, 0x2FE959000D60D, 0x79BAA40A49DE8, 0x519EB8EFE079F, 0x7D7C2BFA6567B, 0x5CC04E5B31A0E, 0x6C6D822173C2D, 0x6F937AC882EB7, 0x7D7CE6FF22669, 0x0740072F97138, 0x56E27C9A4C9A5, 0x21B3EF4E044E9 },
+    { 0x1E88889382884, 0x5E55EA96B59CB, 0x49E683E873286, 0x63A496FD58922, 0x6D1AEF8AEDD82, 0x4B8AA3BC92708, 0x2238F39FADF4D, 0x5C3D45A9B9360, 0x3DBBDB5791946, 0x30A4197D50AC1, 0x54F66D9CC1496, 0x14E367959B297 },
+    { 0x2EC9E5E1163A1, 0x40BC0534069F4, 0x378951D5668DD, 0x524532F315A9B, 0x68C4E05A978E5, 0x281CC17C8CF62, 0x27149F219EAEF, 0x74A9A14B62D8F, 0x65FC623C2935A, 0x014C9068FC294, 0x6B84BD9B81D06, 0x278865B47DC53 } },
+  { { 0x3207BEB42BCA5, 0x3BEF0124B49F8, 0x5FD6F1E989893, 0x19C85A15DC8CF, 0x5E9A2746C17FB, 0x677454F2FBFEE, 0x0642898D5AA75, 0x4AF20AD6F3D9A, 0x6642FF2BB250F, 0x6A811850CF2C5, 0x1BF6E389B7602, 0x30B6278DF1770 },
+    { 0x00C27F4516176, 0x34FE09F87031F, 0x4E37EB88F5D12, 0x50172817134B8, 0x2C9CA5C88059D, 0x28471C7B3FB56, 0x7A035A024B532, 0x05F711D2434FC, 0x2C28AFE57B5C1, 0x0DF87F2215C4D, 0x36D625D9A041B, 0x0C0BC34FFD8C2 },
+    { 0x378B0A32D9B39, 0x150753FB05A6E, 0x64201EF471F31, 0x723922C38D42E, 0x633E0B4519F4B, 0x5BB7AB4E12589, 0x4DB68196F2836, 0x2D7B26A73F892, 0x29B34CCEDEBD8, 0x65339AF9FE8F3, 0x288CE0517B402, 0x30090DF7F8FDF },
+    { 0x17845008C4704, 0x391BA6EC686AD, 0x33E181FA10AE5, 0x0B83F1CB04353, 0x7EFA31A92A44D, 0x4B704286CFCAB, 0x430862C3B4678, 0x3087AF15CE224, 0x6B49B6D30C056, 0x2B1FCD5CC62BE, 0x6D197E7F1D9A0, 0x21E132F35EC11 } },
+  { { 0x3821029810536, 0x43219C130822C, 0x57F781838895B, 0x6466893778020, 0x6D5B68FB5E5DC, 0x76E2AB540C6DA, 0x2C3A97D2EC762, 0x76F4884216FA7, 0x274D0AF52D101, 0x5379765C9E262, 0x3CB18B6ACD5F1, 0x3AA00D03DDA35 },
+    { 0x7EC88A4889D4A, 0x70A89E27B3102, 0x74E1AAD12FC1D, 0x7EF4378BD2162, 0x414BEB4C9EF21, 0x63FE810E27AD3, 0x0333F7AEBAC78, 0x5827EFF9594E1, 0x06E1AD408C17B, 0x7D811A61C3B75, 0x5B2D066281176, 0x1461273D1C672 },
+    { 0x5BE4E0AD16B7E, 0x75F6257D75729, 0x70DA7CE8112B8, 0x1F09789811B55, 0x2E9E39DBD3CF4, 0x25ADAADC1A916, 0x35AFFFF8F2882, 0x67E528CA541D8, 0x3A804BDF69165, 0x580C2EF89CFFE, 0x074007C8F86EA, 0x3ABC292F18214 },
+    { 0x4D947DDC5E092, 0x66E1A2C12C761, 0x16FB90D7A1489, 0x7FCFFBC201281, 0x7529F37D85E42, 0x0F547436C7F7D, 0x0FD18D11743CA, 0x60EB5A1BA519C, 0x68194358F8062, 0x35223ED7F0BB1, 0x543CFEFD7EB75, 0x2F6CF693D6990 } },
+  { { 0x327314D8A79E0, 0x59B8B43635405, 0x5F52CC8103720, 0x6AB6DA41B6A50, 0x0CD5D8CC48F2A, 0x09ACD78F38F94, 0x3A63D8A92BEF2, 0x74094BEA608BF, 0x0EF0208B52572, 0x4688FA7B5BC2D, 0x7C0D49DA4BF2D, 0x088373219D220 },
+    { 0x6B63C97020B8E, 0x41C724B67FB40, 0x54237D8BAC780, 0x2860195EDCCD7, 0x5CE3290617276, 0x4C908A6AE7D18, 0x76C659BF2C61A, 0x1CE192EE47D5D, 0x3AAF965A9419E, 0x1D36F175FD0D6, 0x0AB4861DA280E, 0x1B52A5DC48DAD },
+    { 0x11D74AF73B74A, 0x3C9BFA1F90EA7, 0x732DDD87CE0A8, 0x61B66EEBDB040, 0x6C798E5AE36F5, 0x2B5E71271C002, 0x154203820E6EE, 0x770F769D5AF12, 0x0365CCABFB468, 0x5B63EC5A8095F, 0x1B3F6E3A0B416, 0x2D1DBDEA22189 },
+    { 0x1EB13E8A9FA2E, 0x0D6127B4461C3, 0x7D5ECBF49FE85, 0x2E1C4E05464BD, 0x241B2F7FEA038, 0x11B31C1CC5EC2, 0x3EF61CCEC44F8, 0x7261305520CE8, 0x1B253579DD22D, 0x30AC1E515820C, 0x2B3E7B4A5EFF8, 0x2C7549E117266 } },
+  { { 0x185089DA25A3B, 0x03A5665ABA2A0, 0x30D4B1B4B86CC, 0x65634268634CC, 0x5A67CE8D319F5, 0x74FF3254970B0, 0x7BEA98DC5264B, 0x245D9FB9D124A, 0x0439014EED10F, 0x58E1765D35687, 0x203E6FFBF9782, 0x132015A092982 },
+    { 0x635E302F3702D, 0x2BC12A5A53368, 0x2E8B904812001, 0x20616401EA136, 0x283F9815C4272, 0x561F32FE2635A, 0x2EBB692677A1C, 0x49924CAA419CF, 0x41FE5DD21DB1D, 0x7B52B5FF853E7, 0x097498DEBB626, 0x1E5EB5C1DA377 },
+    { 0x024108B708135, 0x752912D3AEB43, 0x4F8123749C70E, 0x617E4E2EEE949, 0x5E059A4AC61F9, 0x3549D1D0FC0FC, 0x34C692F2745D3, 0x2E96A6561DAB7, 0x20DC83436451D, 0x3246D2411333D, 0x430AED22318BE, 0x3251F87B3F674 },
+    { 0x30B15594D266D, 0x090D0E3BD2CCC, 0x58288D3BF1477, 0x1D3D2ABA96387, 0x2D52A8048FCDB, 0x13CA859B83400, 0x6F0256DD20C82, 0x3A6C1D5012626, 0x0D6D31F9DDCCC, 0x124D3B85A4851, 0x7E41DBB7151BA, 0x2C55E801AAEA7 } },
+  { { 0x53C18D4BD709D, 0x0BA823AE3F25C, 0x51662FD0EE01C, 0x2267ACD6E2C82, 0x139407A18E73B, 0x45748A4B6B77D, 0x186C434A8973C, 0x782B443508ABD, 0x123615E614AC2, 0x66CE52A911EDD, 0x446DD782D00E6, 0x2F45BAE34D050 },
+    { 0x69C6A078E8DE8, 0x7E757DB75843F, 0x38F58BF805CC8, 0x650703398999D, 0x2FC7EC9E4D009, 0x4EC9BF1076598, 0x15EAD8D4ACF58, 0x0F3B7E70BC6BD, 0x118E2DD096D12, 0x41D7133FEDE7E, 0x75FE955AF504C, 0x0CF6CA7A180F7 },
+    { 0x5B5606EA996F9, 0x1C4F600858431, 0x6CCBA4719C878, 0x362898FEA9CDE, 0x3D779CAD73E3C, 0x699C8EB944EF0, 0x045C2E65A8C62, 0x7953575887C57, 0x57236A9320811, 0x17002DE343429, 0x79DDD3B8AED27, 0x09A48783C5527 },
+    { 0x0D543D87959C0, 0x2BF51F4C1A4F9, 0x113DFD7BFDE3D, 0x42BA026910698, 0x7EA9549B08437, 0x163BD03B3D2A7, 0x5DD8B2A64B0B9, 0x097BE395AA7B8, 0x7C89D8E83C48C, 0x4F73CDA63B301, 0x4AA70AB16B359, 0x2DAD48FCE72A4 } },
+  { { 0x2CAB4661317C2, 0x470456B32798C, 0x6229A97258D7E, 0x569A4DAC595B2, 0x424B8B67A3E8F, 0x45072D91D84DC, 0x32FA9483E8F15, 0x73C834C669616, 0x0760BB127678B, 0x5CEA7ABC0F0EB, 0x236524C7495C8, 0x23232CF8B0393 },
+    { 0x6E242F6457A63, 0x5AF87B02F88B7, 0x457E0D3A46B17, 0x17EE4DB6B9C10, 0x76E625F86A8CC, 0x501D2C9A57A7C, 0x682927B1ECE2F, 0x524DE4E3AF702, 0x5AD84E945C237, 0x7D98A6C0A60AC, 0x7A7BF90A9D7D4, 0x074869B7CE64F },
+    { 0x04CECCF3773A0, 0x72C1962667776, 0x2ED51B50428F4, 0x5DCA074C15DB3, 0x31DA84FAC9E31, 0x3F8A4E21C133E, 0x58CB00CE23462, 0x7CAA1E663C1E0, 0x62A5357141476, 0x7C3F594540E3A, 0x4C8976250AC2F, 0x1E589A6C632ED },
+    { 0x6848CF4B9032F, 0x2351DD33642A3, 0x4CF5E47B450FC, 0x6E13A1FC8A984, 0x39E0BF9E56663, 0x4B77D7D9D97F7, 0x7FE4C20B9E26A, 0x57CCEDABA13D3, 0x641DCF4BD87C9, 0x2664733E2B551, 0x13D00ABB205EE, 0x278DDB74148A1 } },
+  { { 0x0508333BC4486, 0x3ED8402DE4AB9, 0x1785BAA83B379, 0x57A3BC1E2B80E, 0x50AD4DA062541, 0x1569CD3C32193, 0x07CCB00E62C08, 0x69E056CFA86CB, 0x436BFA8BFAB60, 0x696ABEEFC4A05, 0x6FDD173711005, 0x2191DBAA094CE },
+    { 0x55FB11A0D14B5, 0x5A8EE26EEF9BD, 0x075EE96CCCAE7, 0x6A8D921280B88, 0x11C4D35783E7A, 0x6F0DF717FA70B, 0x5F98F0FB73DC1, 0x1A5E163E7F6A2, 0x724BC59003133, 0x15483ADDAD320, 0x564AF5430676D, 0x16531597C5294 },
+    { 0x4416BE688DA08, 0x0E67E2B1DEB8A, 0x7A960B9F63D54, 0x14C45F7D8B8F0, 0x6F50F5BD6DD90, 0x1D538B1DFEAA9, 0x42C2C7EE3A1F5, 0x471B1A08399C9, 0x4701957678189, 0x67DD68C8113FA, 0x2B4E173992107, 0x2BF6F5780E716 },
+    { 0x39EFEDF95D95B, 0x304772FD5ED21, 0x3793FAFECA8FC, 0x0F299E86445E0, 0x38025D0669DDA, 0x5EF31ADABDAC5, 0x2EB6E30BB015C, 0x00C7F26788F47, 0x49D9102BD8C7F, 0x5A4B9AB5A57E3, 0x0C52144A30092, 0x19008739DD8F0 } },
+  { { 0x439EDBB17611C, 0x268FCF025F708, 0x6A6C359EC6C20, 0x239982B243000, 0x3399E9D01376E, 0x0AEA9CC3BC2F2, 0x06E3A0E73092A, 0x354973D0C7B86, 0x2B515E185BC3A, 0x6D278F5F06951, 0x2002CB54308B1, 0x1088A511354A3 },
+    { 0x0343C4CFAD449, 0x4E845C890F1D9, 0x5A05E29AF7649, 0x7605407FF7970, 0x61E78A1C69A21, 0x5FA1B074F7DF4, 0x43DE8D0DF6C35, 0x5C311EA883201, 0x5FC69C0BFCB46, 0x4B63975BEA797, 0x050C9949AED28, 0x15436D4AB329A },
+    { 0x75ACE58C3EBCC, 0x71467DCCB6001, 0x0DBD3FA7DB680, 0x02E379758BA86, 0x176B3DC41ADDA, 0x2604939719865, 0x424003ADDC37D, 0x0D6F5BF5DFE25, 0x79C56F6B94638, 0x5911853699BFE, 0x0F4C54523F7AA, 0x1CC9E9D2050CD },
+    { 0x1DBFB3159B49D, 0x75D4D8A7DAC05, 0x76A8AA85212B0, 0x331B54AA11FA3, 0x10C42C7E9C4F0, 0x32B5470194AF4, 0x7AFDD8B533EEC, 0x0B0FA1E4EA01C, 0x7AB2B2A98604B, 0x6F38994BAE619, 0x72A46CFB1435A, 0x3719DA8E3AD7F } },
+  { { 0x1D5CB05990843, 0x014FF0E90176B, 0x5AAC02B878057, 0x65C4C2E423CD2, 0x4AB30A3E32C15, 0x4AE82ED79F313, 0x6AE9DE1011CD3, 0x71ED69DC8168D, 0x6F638D5EE862E, 0x59F2B753D7F90, 0x093EEB706039F, 0x07755B5F94E5A },
+    { 0x6059777973635, 0x68D4DD0139A17, 0x7879A361587F6, 0x1BD8945FC3A7F, 0x1BC2BAC510D5F, 0x5282BFBC0F777, 0x2DE29FCB25BE9, 0x3F9CF0104739B, 0x3F6DB60325768, 0x2EC97381C51D7, 0x192F2DE0EE83F, 0x193A40069F002 },
+    { 0x15B1402CDCC39, 0x115AABAD62EDA, 0x46E2A6EC38186, 0x58B47912B3A11, 0x602BC1F6BD712, 0x46C1A5473B98F, 0x5B1A757A97EE7, 0x0D924148DF134, 0x67E88A92C00D3, 0x1809FC3A7058A, 0x3B40063D5DB5D, 0x2E86DD74D9C1B },
+    { 0x1ABB5C7AF2C77, 0x6155FFECE3EE9, 0x3E4422EBAA6B1, 0x10ECA29683667, 0x5193DC683DAE2, 0x28D0BBE5862FC, 0x60790A51160E6, 0x376EB80769A56, 0x0B0DE97E2345B, 0x2D66AF17373C3, 0x0293039544065, 0x23D941BA77E7B } },
+  { { 0x7C24960F4547D, 0x5EBF043C76518, 0x335BCF0C034B0, 0x02203C6B44ABA, 0x337B0E58135F4, 0x35644614A4074, 0x5E850D117B49D, 0x5A8BDBF0D0C20, 0x556B8E5329D8B, 0x104D961D972F5, 0x06F835AF527E6, 0x28D8198602A28 },
+    { 0x3280EA7DC8721, 0x2565A54F56A2D, 0x73B39EFDF5131, 0x4647BA65C3F7D, 0x54969877E7C1A, 0x4A3B59A8EA000, 0x66D8782DBB616, 0x5E455331488E8, 0x7C608E23BABA6, 0x4C1192D4FDE26, 0x0A18A074DDC91, 0x212E245C0D595 },
+    { 0x440F0072B78AB, 0x6BC7EFF264BEE, 0x5EFF432A4DCFC, 0x26A619819A173, 0x32AEB5AC4F77D, 0x64A4D791CE69D, 0x56D9A02D56001, 0x64E686C9DABF0, 0x092DDB889EAB3, 0x36488E6D2FAE5, 0x14BEE29310A10, 0x2596BD1EC0F8E },
+    { 0x15708F3848865, 0x5836E11BD844E, 0x74C2F6CC11738, 0x2E26818D23CD2, 0x577718FAEF233, 0x7F1C9EB238908, 0x758FBC46708DF, 0x660BD71D2E5E8, 0x4CA31098807B6, 0x0B1DE2AEA479B, 0x723F86F785021, 0x1CBBEB8118CFA } },
+  { { 0x2EB708F610618, 0x455C22E851CC6, 0x419919D9466DB, 0x2921A861ABFF9, 0x0BF6E7296E212, 0x5E33692958BCC, 0x268D9A8061481, 0x18FF4561A78C0, 0x375DAAC466311, 0x0DE48B166E7B9, 0x5B6C8963D4FC2, 0x2E12E71E2D797 },
+    { 0x27D0D82B52C43, 0x6C395A9217100, 0x6247DFD9B9635, 0x5D8CC118C894F, 0x7E66F63835401, 0x42D1BCEC0FC3F, 0x338A3560D7AF5, 0x462E109A20C0A, 0x4548292BFB7E8, 0x4FD93A8B678B1, 0x1575B4FA96804, 0x1589B21BBF9CF },
+    { 0x228D1443CF8B4, 0x6CF2D16C3F817, 0x2163CD8FD4B57, 0x063CC40D68A96, 0x45663FD1A8D7E, 0x647D5A3548CD1, 0x0C8C028114812, 0x7A5EC083573AD, 0x2F99C29502065, 0x6812705BE0B72, 0x4719249792998, 0x42F0439920F8C },
+    { 0x74EE71280838B, 0x48108EC799D43, 0x1A8A894111704, 0x38C7EC9DBDB0F, 0x5E3918F939BAF, 0x00DDD4DE2173A, 0x18DD0263856F7, 0x1CDAB64E959DC, 0x01C401834D027, 0x0617E6A01B553, 0x6827A68E21254, 0x1C449EEE60392 } },
+  { { 0x4977AB8BF2E8C, 0x18A19F1C94EDA, 0x331018873E3F9, 0x06FDD9D71B5BB, 0x0DA2410E6C52E, 0x16D3BDBA70410, 0x114D59FB2F075, 0x28CE8A34E3BD5, 0x09594E985BC23, 0x4D937AE8C4746, 0x10302EC81D7B0, 0x3CE3BEE4B1AC6 },
+    { 0x2317E7A326B98, 0x1BD62CAAABDBA, 0x1E869290E6DC3, 0x18E2C545F0A21, 0x764C0787A597C, 0x45BBD98B5EB0D, 0x7CA8C25727C3C, 0x69F52F5A2A7CB, 0x2D5EA168B5F67, 0x2BB6134A4FC45, 0x0E3E795FE65DB, 0x094D24B9481E3 },
+    { 0x3EC8CA3240B94, 0x05AF422DDD868, 0x06B08B1756FF3, 0x5800FB55F56E1, 0x7949036A0DBBF, 0x7B5CBECE19349, 0x1AF11A196B98D, 0x6A70837D61B3A, 0x122BB69214DF3, 0x4E335DFEABB2F, 0x3F11FD120A25F, 0x34427A60B5E61 },
+    { 0x382AA70E2B758, 0x27E6CAC950D6A, 0x1974FE75D55EF, 0x665DA136E8C06, 0x438B2CB3D99E2, 0x27F2FAD335F72, 0x599FAE28072CD, 0x4DC12045EF345, 0x0BFE5B320E0F9, 0x2336A26F44FDC, 0x6E9B606964145, 0x27F4119194B84 } },
+  { { 0x03C9545ACBD70, 0x306572AAFCEFB, 0x52EFB350D2721, 0x7E9E18EB7A36F, 0x7FB93A3EC573B, 0x0E5D213E3ECE5, 0x05A5C00892390, 0x3401F5259286E, 0x415057FABFC1C, 0x1DE00641EAEC6, 0x58C492D8294D6, 0x12439BFF7FA0B },
+    { 0x1DB5A5CAC2D50, 0x6CED49F5534CC, 0x23EA6C23CA630, 0x134ED64D067A8, 0x119B688F1846C, 0x41BD82C87F79E, 0x5AC46F0C08036, 0x3E04B8359174F, 0x341D16E5DBB5F, 0x22913214694F1, 0x585737160287D, 0x0FD5E1620B889 },
+    { 0x7C85AB02C5D3E, 0x32C0F7B29EB81, 0x5BB796511B4EE, 0x5D6F3E621BDC2, 0x1BE9D72EFB786, 0x018CA68B0BD47, 0x29E25FCC834A2, 0x0F97DA6107B73, 0x0EB1E0F85AA97, 0x1ABBB3A2EA936, 0x407301EEF90CD, 0x27E1A8CE95B2D },
+    { 0x0F0B35D3887CA, 0x4245F3C926F35, 0x55B32E74EB81C, 0x22807A1928767, 0x026D1C67CD7E5, 0x3D2042CDCF1B3, 0x47C0C0D3115A5, 0x2CFE2E4408F73, 0x34E38721F6FC5, 0x68B442AFCF7CE, 0x4A243ED2C9321, 0x1DE7A1D9E3B15 } },
+  { { 0x519D4EED2F8B4, 0x1DB16FB58D644, 0x361DE9A78919C, 0x47C391BD7B2E7, 0x4234BE57303FA, 0x1C1E78AAB89C6, 0x22DD7C606F331, 0x185E74DC331C7, 0x288CABA6ABE42, 0x6CA44CF3369F4, 0x1627840B9AF38, 0x3BED655C020A6 },
+    { 0x36CDD70CF599A, 0x637C0BCDBDA40, 0x1A02CFEAE6607, 0x4C17D44C7AE7E, 0x36C73DAA86BDF, 0x257C4A7F3EA01, 0x2C22732000722, 0x3D4DE636DE4ED, 0x623B002A2DBFF, 0x4F1410C14F078, 0x3D2245643F949, 0x1B8605D7C1621 },
+    { 0x3B8C8ACB36B08, 0x7BDF7E386E0FE, 0x367C5062BF6E4, 0x0048E9512949A, 0x50C7B515F0852, 0x174AB6C3EB85C, 0x06C9A46856E90, 0x475B0703C9A51, 0x0DB94344FFEEB, 0x0822F353E848D, 0x298B229F115CC, 0x22013FB32B4CC },
+    { 0x1E0CC919C13D2, 0x29F918C2A3E01, 0x713CFD59D05FD, 0x732E056004E8D, 0x00973BB4AEC6B, 0x5736FC7CD1937, 0x32C28AD629DFE, 0x3F9994F7D4E42, 0x3F7E79202FE45, 0x0211E4EBBFDDA, 0x161021E276F5A, 0x28D77135BF1FA } },
+  { { 0x626667518AAC3, 0x4CD4468292D2D, 0x40FA0D92A6F0F, 0x50EA0645404ED, 0x4786049C18735, 0x13FE6D8E84249, 0x4AF3A285DEF28, 0x0D960C8FE21CF, 0x6A52A0ACF1886, 0x27C048AF229D8, 0x64EDCB6F445CD, 0x1B15C57AC857C },
+    { 0x3C14CEDF0F2D5, 0x3AE2FCBB12106, 0x29E51B6570713, 0x6507786C21C03, 0x64BA5A0A6450B, 0x547B85F0D4CE9, 0x6C331C97EC80B, 0x689559AA24B62, 0x61EEA1C041373, 0x6CCDE8062A737, 0x47CF60C0280F3, 0x0B18D753554C1 },
+    { 0x2D477DDBD2083, 0x6A32D6CA2B2E9, 0x6CE1C7FC91319, 0x30964CB8342CA, 0x1E9F2DF8C9BA8, 0x6E6B212808811, 0x0B2970902C299, 0x6A71560C8847E, 0x279A7E9283EA7, 0x71D85F2D25849, 0x021C4C894560D, 0x2820DEB2A2876 },
+    { 0x22415E9E9D713, 0x3D875A80B1D09, 0x409366521521E, 0x13451A2878551, 0x6FFB8D1CED441, 0x5B43B74FA95B6, 0x6965FB11B8A5D, 0x25BCB534443A9, 0x60773CC7EBAAF, 0x1965678391251, 0x60D1E9B3FA645, 0x29A0893ACA7D7 } },
+  { { 0x13FACF5071698, 0x6FAB2C11F4E00, 0x5100A057C11C5, 0x2E289E04C2F87, 0x3A31C23D31F1A, 0x7E522166AFBD9, 0x228F849BACCAF, 0x068EDEDB81D90, 0x454B5810E31BC, 0x57883B6C57B72, 0x59BD81B108935, 0x462061F4970E3 },
+    { 0x5195390994A4A, 0x758DE3C4B6C15, 0x6413E5D1B0FE7, 0x63D9A6E5B6FC1, 0x675A93AFFF4F9, 0x0AF4EBAFAF7D1, 0x446939132C160, 0x78CC7A701BAD5, 0x36F1BBCEEC30A, 0x42D6DDE350922, 0x64085E8954183, 0x1AEC1E57C5505 },
+    { 0x7C0D0A39BC30E, 0x156759601AEB3, 0x0289C728F65AF, 0x6B25923F421FA, 0x491E5ECCCE980, 0x0F6C0BCF8DF4E, 0x2A0EE4D38F757, 0x29242B38862EE, 0x006CF4F0B9345, 0x5468A9EDFC7ED, 0x13E29C488EC1E, 0x2DD11A8F3D8D2 },
+    { 0x0BA201CCC60A0, 0x3DC5669498FC8, 0x2417FE8C295EC, 0x54E090AB5A728, 0x555CF6F7C36F1, 0x6F89C14BBED5B, 0x4BE3F0E05AD74, 0x69BC68CD9B6FB, 0x3A23B6CB977BD, 0x026B8DE00836E, 0x3CA39B2FFC946, 0x292292454380C } },
+  { { 0x740497CCA7BE3, 0x0B9333BECCD41, 0x15CAD88600814, 0x7C8E589F60A4A, 0x15272F41BDB9C, 0x22117DFF3ACF4, 0x6AF556CAB8A07, 0x397543CF7D2E6, 0x10F6986164064, 0x7F16637A59C44, 0x4ABB0C463DE1A, 0x3B125C80EDB9F },
+    { 0x6A8822F68941B, 0x0F66CE8AE4825, 0x50E6C4F1E033A, 0x74E1E9AF386B5, 0x467A8430DB22C, 0x2DA9F324C8F2F, 0x2B7FB1FF821E9, 0x1C78644C7FC5E, 0x5F37A61E92478, 0x70640CDE24C59, 0x7F4B30F098921, 0x1E5FA635607CA },
+    { 0x310875ACC0021, 0x30A818303E218, 0x27A318D4ECD64, 0x489918E3C8DE0, 0x1AACF0F70D00F, 0x2B1499B26E8D9, 0x7E4D1BE1A8FCA, 0x315DB3A9DF622, 0x54AC14B943C18, 0x1CDF83B1CFF3B, 0x2D5B51C16E4FB, 0x1D4608500E882 },
+    { 0x248460B745795, 0x6B7BDC0EE90C2, 0x664693130C47A, 0x0566CB3C61995, 0x7ED0D84B21F0F, 0x500DCFB23AEC3, 0x6CF9940C0A5CF, 0x595F2B24A93CB, 0x24325A38AB7B3, 0x5DBA344059E96, 0x4B20C570E6016, 0x21082DBED4CC7 } },
+  { { 0x3FE92CA0BA844, 0x07C8F45D3C017, 0x3C502CA59336A, 0x1244193BBBB32, 0x61C3ACD63A908, 0x6C2A5583A96BC, 0x737AA76E3DE45, 0x51E5DDEF76A00, 0x778AD987A507F, 0x3BBD4B3536442, 0x2A913FE152E55, 0x1CE2D4EF99C01 },
+    { 0x3A5E3DA782E3E, 0x59955D0E3C5E1, 0x0321EBD4DDDF1, 0x34E10C4F1C50F, 0x776D22ACE4395, 0x2DA69877D39EE, 0x6E1DD6B9B9B81, 0x5E020A91394C3, 0x26D28CF678CCB, 0x1FFF6944665BD, 0x46BCCADE5E8BB, 0x18AEA7696B155 },
+    { 0x2CE9B76BE9C26, 0x423F7AD7C2566, 0x0803417E859D3, 0x6E0471D8CE9F0, 0x37764F23EE36B, 0x2F946E06FDA76, 0x44840E6B6966D, 0x1D11DE7155C32, 0x450D1890F8AD4, 0x3110C6BC2B7D9, 0x2464CAC897451, 0x141F942118676 },
+    { 0x17B42605D150C, 0x09B74A9CB7343, 0x43478EFCC34D7, 0x77A78F26CDCB8, 0x595512D5EC4AE, 0x442DADA0D0092, 0x366A6BC27025D, 0x62A1460371F47, 0x07E916A3842F2, 0x1F810935D35BF, 0x4364D13526755, 0x1C820581552C5 } },
+  { { 0x10F6E21C1A569, 0x132D91D9C19DE, 0x4CDD6E48CBE4A, 0x4A792EAA791E2, 0x740D9B92A7C65, 0x37CCC5C3D305F, 0x31EA2FDC0EA09, 0x6435F3650D16F, 0x7B5FB84FD73C5, 0x053D8954074C9, 0x6DA2C813BF1EC, 0x41CCE4191ED1F },
+    { 0x7EF9FA456B959, 0x75627B9D661FD, 0x5116F00EE7378, 0x0C9EFB669343C, 0x491C009875D91, 0x40E623570BFC5, 0x260E317CDB6CE, 0x4D3B748C4E1C3, 0x77D6E976D1F07, 0x469CD0DEC67C9, 0x07DD81027B257, 0x2759AC4E77A43 },
+    { 0x1D50BE9E12CA9, 0x3D327C1AF86BE, 0x4D493EA658BF7, 0x544AF60FBCABB, 0x759F69FA9C76B, 0x64E41BA44891D, 0x7C3D316751DCC, 0x6AB8643341588, 0x3429F82006A02, 0x5F4A0F01A106C, 0x701CEB89671D7, 0x2EAECA50078DF },
+    { 0x479FC0173554F, 0x2CF31916DC9C7, 0x2406FECC3A479, 0x40A6557A91618, 0x462C2E3BB48AE, 0x327D106796CE5, 0x5094C6302A275, 0x6BA51716AFFD7, 0x0F377878928E7, 0x369B7A54B9CAC, 0x23D9E990E1563, 0x27220C27EB6A1 } },
+  { { 0x7CFD1DAC9FB9B, 0x76971E4F94DF9, 0x1118F85E4E473, 0x50305B9F4F883, 0x469FDF963D9BE, 0x7EC91F0D47C9C, 0x3D18314CD8E51, 0x3B26C49A009EF, 0x058C5D97D0B8F, 0x3A73C9F6FCA79, 0x3C1B3C4FD516E, 0x28E968921DA79 },
+    { 0x024A065A6B429, 0x3222A8713E07E, 0x12E472A685B19, 0x2118BD2CF6709, 0x3D7B4D328C106, 0x72DAD092C5346, 0x0110B8AD2176F, 0x0FFFFFAD4A175, 0x6B8C38CF3ACA2, 0x25557DDEA6DA9, 0x44622230366FD, 0x181B90B263214 },
+    { 0x60DF5A53F12CF, 0x36AD4DB32AC25, 0x2AC91A79DAE03, 0x79429EAAAB931, 0x691F5EB4B615C, 0x697D2378A2E4F, 0x7C4EBA4354208, 0x7D9D6A57D436A, 0x4161E72EF7C0F, 0x0FF8503E57DAD, 0x2A15E01B6BBC2, 0x24D62FDB1A03E },
+    { 0x37475F56590AB, 0x462CC3E21FFB7, 0x162B90BF8FB8F, 0x5B1204A0AF361, 0x2498D3454BF3A, 0x31C30F2111049, 0x64148DB953B59, 0x5CBC227098BF2, 0x60D9688C7233B, 0x6022003893D67, 0x44B2C2ADDFECC, 0x32369CCEDA885 } },
+  { { 0x256C5BE2A1D0D, 0x2CFED582839FB, 0x61E9F7F3B0D3E, 0x46D662AF3FCDA, 0x4AC25FD97D88A, 0x54763D71F5C77, 0x3349773EE6BDB, 0x21D26B71F8887, 0x33AB089938B68, 0x043DBBDEA467F, 0x538BE0B20E122, 0x289266C1E334A },
+    { 0x64E9807BB3EF5, 0x05EB0713857D0, 0x5CE89DCABD36F, 0x398D7BADD712C, 0x6E9721FCF99E5, 0x0A4F8A39E3832, 0x1EDA66AEBDBB5, 0x48A34B0EA6F1F, 0x259E7FDC245D2, 0x65CDC022BD6C1, 0x44BEB4852D794, 0x144818EC776AE },
+    { 0x2A6D33B28D627, 0x10B786D07B36E, 0x30C34E234A3B7, 0x419D200203020, 0x5B15DA02B9FF8, 0x6292F6B129AF8, 0x4BB9CF554FA79, 0x1EF34A6660491, 0x451F6D76A4E24, 0x07688E55DBA71, 0x0BF86DA78A254, 0x055BD8786CC44 },
+    { 0x09CE4BE6E48CD, 0x4BBD122624AD0, 0x2C97C9452591E, 0x63EEB6B216050, 0x1C8635FE56C68, 0x0436904D46B70, 0x66593ACB45ED3, 0x7E0057233B254, 0x157CC35A28EA8, 0x48C61442DAED5, 0x647E7E7A9996F, 0x333E69661CDE4 } },
+  { { 0x28C22DA203BBD, 0x639BBE686C92F, 0x7DFF9E3658684, 0x545A3CE17ED71, 0x4EE0CD8E86975, 0x387BF48BA20F1, 0x5D673E28A76E1, 0x59E940EDDFE16, 0x4D2EDE57AEE0B, 0x216AA95DA64D3, 0x6E840E603CB39, 0x295AF88023B6D },
+    { 0x1BFE9A5AEF8BC, 0x0643806C4D285, 0x716AE3D748A2D, 0x5525DB177A3F8, 0x06D20768BA871, 0x220ABC7E34A77, 0x2A05D97FEF2B6, 0x4560C64B1B133, 0x064BB5B86DC83, 0x572F4C2BAD00C, 0x2045B052354CA, 0x14E280CDE5280 },
+    { 0x27C9D061B8993, 0x27F1B0EC231AD, 0x06766D596CD4C, 0x69758E47E3A5B, 0x5C2697E8A928D, 0x0E03497DC32ED, 0x5980E43F2FBBD, 0x3F24C66A60572, 0x43D6EC120794A, 0x706711F7D4F6D, 0x787DDFB09CF11, 0x05C07F8328464 },
+    { 0x21C49B88AAB12, 0x07C4B0EADEDB6, 0x7E5774656EDDF, 0x020000298C224, 0x69A1EFD036BF9, 0x74606942EB9C4, 0x5CA415356D108, 0x1EF6F98674755, 0x39DEBC61D155E, 0x5AAAAA0A5F56A, 0x3EBF3C33B0688, 0x30084AC9C284F } },
+  { { 0x4CAB724E6B46E, 0x650D15CAECC25, 0x695698988E40B, 0x26D94BC11024B, 0x363DAFAF5CC1F, 0x16E79F82A8845, 0x7A7F25236B9DA, 0x18B3AB9C49DE6, 0x6F0CE483C2F64, 0x4428D42E1044A, 0x271F8D4CE5FBD, 0x439CF8C9ECD0D },
+    { 0x66A35848BE54D, 0x7745BA999ABFC, 0x6364F35C3D31B, 0x1F20745FC97D5, 0x6D099472817BF, 0x467CFDD227F42, 0x7F8FC214E0D0C, 0x4EA9E7F3E9D54, 0x0E189D01976A0, 0x4EE379ED17198, 0x46700504B2386, 0x137A3CC581E1F },
+    { 0x3F1793B2F2250, 0x29A76B60C0F79, 0x408E74FA33815, 0x34ACD9C2E129C, 0x7F828F0FBB21C, 0x3591CC5034548, 0x6A3DA2F284D44, 0x7ABEA24680E86, 0x677DEE116459C, 0x3CEC8C79DFF5B, 0x4FF43E86FE109, 0x32270F485A794 },
+    { 0x2650F401CA08B, 0x4EE31E408CD49, 0x3217F23D99A00, 0x0C9724675E560, 0x26CE7E8A7E2C7, 0x3E57AA73D2A7C, 0x1FC5DD24006C6, 0x303841CD3A1E6, 0x21E9D959B2EFD, 0x10860030B9A32, 0x4A1EED181A2A1, 0x2EA6654E262DF } },
+  { { 0x4BFA08ED06ED7, 0x15BD3D9B97CC4, 0x605DC9C2ADD38, 0x01A37A1429006, 0x4457919C1A851, 0x6E17EF0D9FA0C, 0x5D51BCED45C7B, 0x5EE1B94DCFA7C, 0x2AB793CEA745E, 0x5292143ACE95D, 0x3B1E89A764437, 0x1EDCC48168953 },
+    { 0x05F1FB6E59732, 0x6574946E967A2, 0x113FD3B8707B8, 0x74395DA63CFF6, 0x7CC19B5C9E768, 0x133039F022D8F, 0x7497D8ABB7847, 0x0DBA02DC21511, 0x3BB2F7727CAAD, 0x0B980092F5300, 0x328F94C1DE548, 0x1EDBA4269DC47 },
+    { 0x0F2CA1DD76625, 0x2CF3F77B0061A, 0x5A640124647A5, 0x452790BC7E649, 0x7C507E72C8562, 0x5591B18BD783A, 0x0E77611A6E2ED, 0x30F0DF6223B2A, 0x2D7162273CB2E, 0x023BC49ECBFB4, 0x0A1649B0E2CFC, 0x3A78F834B220D },
+    { 0x29C1B771430A6, 0x48A1605068836, 0x636D5DD9601DA, 0x2369AC0FE58DA, 0x53493905928E8, 0x31DBE943186CD, 0x26ED0B6B86B0B, 0x02AE3347689F8, 0x635D824ABFD16, 0x3F6EF44D9CF43, 0x3A3F95E8D5D0F, 0x2E7906C6AC04E } },
+  { { 0x4BD4016D49250, 0x1F15D8ED71FF3, 0x64CC2B745BDC5, 0x2896E71E76F70, 0x5B34735D0C9B2, 0x1FD1540840D63, 0x47BFCA20B6E2C, 0x728CFF89004CE, 0x41E2D05880919, 0x4A97EB29A4B35, 0x03CBE4A58DAC8, 0x137E2556F24B0 },
+    { 0x480126A2F691A, 0x41DF4FC465A35, 0x6F463A3A53960, 0x271D3A105AEEA, 0x083F8C06F4743, 0x2C3C51A0A0E7F, 0x378ACC5FCC2A4, 0x3239ACB70922B, 0x038ABFF814FA1, 0x5B4941775A39F, 0x6296CDD85AD90, 0x0E2731A59093B },
+    { 0x717873F338532, 0x38B8A58B08FB3, 0x0E5ABEC33784A, 0x1405676665F50, 0x55348A1616088, 0x34B4DF756F828, 0x3BBDD08BA1EDB, 0x62FA23996C635, 0x793DEB68A2064, 0x0D6535F890245, 0x4D8EA7DA27678, 0x39E9791B2FB69 },
+    { 0x23B5D3745C89A, 0x193BB56936B7B, 0x55D0F402D5FC8, 0x7ABDCB5A20DFE, 0x033905462C7C5, 0x6FECA07926AE6, 0x7E2625EA91C05, 0x6700DBBA90DEA, 0x712E1C832871B, 0x31AF4E9026A0F, 0x5A6A51527BF5E, 0x279F7EEEC5D2D } },
+  { { 0x44423AA8B5813, 0x004B4330359E5, 0x2988590CAA7EC, 0x6FF97EDFAC76B, 0x55EA6C7A1A1EE, 0x5602632999CF5, 0x46C9ACA1F026D, 0x3CAB97C3FCBB8, 0x0B32616020E92, 0x635634D59EA92, 0x5D54C8050CC07, 0x2E946A8D6308C },
+    { 0x4A51EA42A9EE5, 0x577D46C0A7E09, 0x08A877B474313, 0x1B6EB3FD596E8, 0x33D599BCCF752, 0x18552C7D0B8C6, 0x46112288510F1, 0x0D92DAAF2FFEA, 0x4D803F27E3A0D, 0x2C484973528A2, 0x1700ABEB1AE48, 0x13E00256390BD },
+    { 0x2284D00E17251, 0x5064D56A07704, 0x613C5FCDAA2EE, 0x349BC20B3793B, 0x2CA65ED76ABE4, 0x3CBB0EDE3F598, 0x2D89EE32C6272, 0x175564BA96008, 0x6709F37E85F89, 0x11A2AE5AA0604, 0x2E5CD20A6D0E3, 0x15BB5D3B320A9 },
+    { 0x728FF395AE4C7, 0x73D1F7EA83A43, 0x19F9222790671, 0x35B18A1447569, 0x21B4CFB5BEE5C, 0x42A86934D44FD, 0x4B383834D8080, 0x71499C17BE0FC, 0x526389FC64C53, 0x6E120771727A8, 0x2E843D7F5F033, 0x2B80949B963D8 } },
+  { { 0x39EE3443ADECF, 0x7F17C25CC5119, 0x6DDE18B23A855, 0x5625D35422E4F, 0x7ABB6C7502358, 0x73F7705F84803, 0x460ADDE2BD330, 0x4D796F3AD6AA3, 0x52DFCE51CA88B, 0x14A296CF40730, 0x1DE0463B54C2D, 0x37ED52FA7CC94 },
+    { 0x2A7BA2EBE391F, 0x49738E1DFAD0C, 0x05BE01F2A0656, 0x01E98AFB5AAA8, 0x5821B2B1C2871, 0x5B55FBF270E64, 0x13820829522DD, 0x29AC2B0B23F6D, 0x084C9C9B627B3, 0x0327E3EEE4C53, 0x4BDC6B4F33AC4, 0x1549275A295C2 },
+    { 0x2ABDD86AE6789, 0x1A639947E0E6C, 0x20635B595FE71, 0x49DFF0543EA28, 0x3B1ABA2D192A0, 0x2BC8800107ACE, 0x01C8A16934690, 0x4B3473DBC8857, 0x6053717453E34, 0x55074CFF63F8F, 0x17C19AF945D65, 0x344C3393A9FF4 },
+    { 0x5EF1A40C3BD2D, 0x5D4AA96196CC0, 0x47C1E22D14585, 0x098AB01EF72F1, 0x446654C42E38E, 0x3149B5187FD71, 0x253F9CC227889, 0x6C086DD655920, 0x2F20F576AB129, 0x247684958C5A4, 0x2E46BE456B65B, 0x3169733B30830 } },
+  { { 0x6A98DDA77CE3B, 0x01615A7BF174E, 0x4FFFA3D56A8B8, 0x0FA3BE1A116EF, 0x34CAD31C5A7FA, 0x28CB3303C5314, 0x7F951CFF53E16, 0x06325265B0BA3, 0x5202B7CC9E852, 0x1823106607DB3, 0x74593594BD8D2, 0x2E31F02ECB204 },
+    { 0x6783F337A82DD, 0x3034B6BDA58F7, 0x09A427A89D6CE, 0x76D67013B7C04, 0x486AC17A93F33, 0x4EB9F5539077C, 0x694250E02C7D7, 0x7B174C1B253B0, 0x7077257941302, 0x335DA4E9F4C43, 0x2E722B4430AA3, 0x22E8921E5B568 },
+    { 0x3E6BD7321BEB5, 0x17F734EEAC054, 0x1A8F4C8070B69, 0x73139B29DBEEF, 0x258D0D4EFCFC5, 0x11B15E790243D, 0x2014682A18C62, 0x1A155919B956E, 0x1B55A10ECCE7D, 0x17CAFB34D85EB, 0x5C87EE13009EE, 0x2A266ED90B91E },
+    { 0x6A69FEB8A6F25, 0x5B4E1F00895E3, 0x3A74930411A80, 0x2DC371521F139, 0x63879DF21F148, 0x2EE58D49CE4CB, 0x4BF36F72DBC19, 0x070B6F9EF2412, 0x7B528C0F62964, 0x0995317F67931, 0x0C3897045401B, 0x2BDD93371239F } },
+  { { 0x51691CA40D111, 0x356F1A219EC1D, 0x58BFF28951BE3, 0x350C2B598A0F2, 0x40E17E73CA6E4, 0x6F7C0E7D24F88, 0x56261ECA99863, 0x30FDC4609AE43, 0x52A6B47C6FB8A, 0x062FDB01870DB, 0x0DD06CDE37736, 0x3AB2460C92D21 },
+    { 0x3F8BD155DB763, 0x028EC9FEC64FF, 0x0A28252D954D9, 0x6C2410B9A462D, 0x3B71067859FB8, 0x606FD17E91223, 0x0C79748792AF1, 0x4C0745BCA523E, 0x6933E0007B1E9, 0x02808EEC31896, 0x5539D7E64EEF1, 0x15BB89B985827 },
+    { 0x37BE7D55A8929, 0x405968891F4CB, 0x652EEAA3DA50A, 0x0079B806DB3A9, 0x1B9D58F7F02FA, 0x5B611BA9D2389, 0x10D7A91E07223, 0x3ECE4238C7196, 0x775D2F8A7F891, 0x3ED38E5AA14BE, 0x11F0FDB7E1311, 0x14E8F78043095 },
+    { 0x05E9A4A4BE581, 0x3E77BF0F177E6, 0x5606F2711E369, 0x677A2A91305D2, 0x0D346CCDDF5C1, 0x4D19104AB95BC, 0x352428269B525, 0x5FC50B375E788, 0x475D1186DCDE6, 0x094D48F095CDC, 0x131659E7622F4, 0x351D66DEA04C8 } },
+  { { 0x21C3F355DC083, 0x2E6516DF79704, 0x10258F78A176A, 0x50122EF67144D, 0x3CA1E5D255344, 0x074CE9458D415, 0x71BD1628AE066, 0x59CCF854F8D9D, 0x6DBDA391C1B64, 0x6D2BDEE0450A4, 0x1B387F18E0D2E, 0x1EE5FE0BD20F6 },
+    { 0x34E16E09C7DA2, 0x5CBB364E0D0DF, 0x3482AB1FF0D25, 0x44A0C422D3038, 0x217A9501BA95E, 0x2D3095F1694E8, 0x44C6504CB1B97, 0x59DCA60875632, 0x5465B5F775033, 0x458B949ADB4DC, 0x638DF44197AB5, 0x24FFADFF50842 },
+    { 0x784A865E223D3, 0x159339CDBD05B, 0x606046E12AF73, 0x32935315E0EC5, 0x1BC16614A9991, 0x17DBAD112ACA3, 0x30AD517A0AA7D, 0x346FF9893B59C, 0x29F561F7FC2B5, 0x7070C838B8070, 0x570905E375CDF, 0x239FAE53F9C99 },
+    { 0x3D04D2534F420, 0x4C4F28E9543EA, 0x454C77D8CF25F, 0x61575A744CEAB, 0x13573721C09D5, 0x7AFEE5B2B1C71, 0x0930B9B5BC587, 0x592DF3A9E907F, 0x2036A8E47E52E, 0x3E99CF6F5F646, 0x59DE0F3DBCC84, 0x23DE508DD82FB } },
+  { { 0x2F0C28D9782AA, 0x366A4010E5264, 0x1B3C798470840, 0x1F93E6483FFAE, 0x5D1FD44DAC9CA, 0x130DE69E59482, 0x17A5146E6CD33, 0x13AA1D9AFA25A, 0x4D92FDB4D6323, 0x14ECBCB60DF04, 0x7E945E8D3071B, 0x2835538CAB7BC },
+    { 0x1C308D163CDF5, 0x7294D4BC4B8D5, 0x3279EDF0369D0, 0x7A778C64BEDAB, 0x332DB110EDE8E, 0x19E912FD215DE, 0x34CF8AA6752D6, 0x6701DC2A00274, 0x2ED13FDF46548, 0x250330ACEB408, 0x548543585FC98, 0x12CBCBC07ACBD },
+    { 0x20C1ECCF9F562, 0x559E1D455E907, 0x733ABE8AACC0B, 0x16B723AED160F, 0x4AB15C4A9310C, 0x2406573B80A9F, 0x0AF7931B0C919, 0x181A5A3B64CFA, 0x615E8F14AA4E9, 0x639ACACC57FF5, 0x71BD9D3FA5BA1, 0x2B38C1DA2209E },
+    { 0x538B3A91A9C15, 0x5AA8EB3750FB6, 0x2F59E37CC84AF, 0x294A538D03916, 0x448A2F0A65130, 0x4E4ED4761AB09, 0x5AFE1E48F1944, 0x18D1A9A6FEF15, 0x312056711FBA4, 0x2EB69BD43865F, 0x7B3016BB8D855, 0x3225AB8570AAD } },
+  { { 0x69069BE318CB0, 0x283A53FB4E250, 0x3DD4901094DD2, 0x6E82A7D0F2132, 0x5B60C7DB3663A, 0x53505045380B4, 0x7535AFAF388F0, 0x0D3888660CE1E, 0x0C5E19F2FA397, 0x59245C08A8229, 0x46F058CC1A1D8, 0x28BA0F59CE0D2 },
+    { 0x08CC59F799204, 0x56819990F56FD, 0x26517C88BF921, 0x4FB4E9DB6A11A, 0x5CEADBA0098E9, 0x60B007558E1C5, 0x40C0FC319B5FE, 0x520960071050E, 0x6F96327421A9C, 0x210DF43335FBD, 0x4E1293F792144, 0x1842F098E8D95 },
+    { 0x1F64D9F145234, 0x7258F51012A70, 0x2CE3DB88085E9, 0x54993D357CCA4, 0x4A4B58E94D2F1, 0x3E62A39006C18, 0x1E8F545B7E7E4, 0x7B6E3DC6A4CB5, 0x6ACDC5DB33203, 0x12C833A0F96B3, 0x4FBCB2649619E, 0x2157238F44766 },
+    { 0x5BDF7CD3A37D2, 0x53646D6BCF991, 0x58C0FEC50CE7D, 0x3F74631DE8501, 0x5815032F67C1F, 0x03AEA83F854E0, 0x448A70A0BAE72, 0x0B816B4316785, 0x568D15F7F588B, 0x64C7C9C0F394B, 0x6243C7B4A39BC, 0x1AA52F6546C14 } },
+  { { 0x16A51DFA680CF, 0x19D74000D805E, 0x5981B1E7B3BF4, 0x241BAB96454D1, 0x4982773B3CCCC, 0x27E55AB408197, 0x5EE375728C13A, 0x62E71081177A2, 0x7BD1E16111765, 0x02CEC5CCC7622, 0x11BAA820EA47A, 0x190BB9E9DA683 },
+    { 0x0E14CEF88A778, 0x34CEED754E154, 0x3B2AF52F40700, 0x07A0CFAFAC45B, 0x088EB601124C9, 0x0D2CFD6EA0960, 0x344C7F52CE0B0, 0x607321388D22E, 0x2C2BC799566B4, 0x67F9A987E872D, 0x42357A8E0DC96, 0x0CD1EF3534CA3 },
+    { 0x271773FB09E5B, 0x46111BA3D894D, 0x71F828E5908AB, 0x03AF17D9322CF, 0x25C07C34C33CB, 0x469887FF892AF, 0x22380457BA3D1, 0x513C6D67359CD, 0x3BB93A3EF2C11, 0x3FC934F894F96, 0x63F0B6EE2BB56, 0x3BBDC79BB86B7 },
+    { 0x55CAD862BD486, 0x233B723234ACA, 0x3C72C2F8D118E, 0x76461871D2275, 0x6C239F4DFAE92, 0x1A30319AF7EB2, 0x7371BB833CEE1, 0x0F031BECBE185, 0x26393B3F8EA81, 0x7FDE0F18003A1, 0x7387D228FA18E, 0x253E4C21F7888 } },
+  { { 0x470676C53A55E, 0x2978F17A0C363, 0x72D8FC99AD6D3, 0x3A259AF002249, 0x06485AF493533, 0x4AE3750D6A051, 0x75E0902D6E294, 0x41A449EEE9CE8, 0x0D2E7EA45440D, 0x2A67642F209CA, 0x05578E5067D4B, 0x2548EAAA0B0DA },
+    { 0x46CAAEEAC9BAC, 0x070C9CBDFDB0D, 0x6AB5CA69CD7A4, 0x004CE432E85A6, 0x3F6AB0901AF83, 0x0CA0EB5058566, 0x1355D79EBC62D, 0x5723E4E8DB845, 0x771210B542A51, 0x4A045830001F6, 0x30CABF553810C, 0x1C91C91013ABE },
+    { 0x464ABFD22EA96, 0x1BDF498EDD469, 0x3DFF2F5C41C1D, 0x3F1607FA91ABD, 0x49CAFBBAC6079, 0x4A3CE23209B34, 0x2EC9E4DCB9802, 0x34CD3875592E6, 0x66C21A3DE60C5, 0x7289805D1C918, 0x1F7B78E721C9F, 0x14532F8996B48 },
+    { 0x62F8FC56E1B66, 0x27941B86742A4, 0x16175CB6AAE6B, 0x07A22FBA5890F, 0x13BFE9595A524, 0x6314A7EE9F1BA, 0x55CC7656D5C01, 0x6601347710C66, 0x4242C8A735FC4, 0x195DBCF1ED439, 0x279C4695668CD, 0x25DA86EE2AAAE } },
+  { { 0x07D46A6137AB3, 0x337B012E36F5C, 0x50F2109A14F0C, 0x4CE3AC5DA10A5, 0x3491343FCA08F, 0x7078569ABBA57, 0x365092D394373, 0x4DA4CA74A2037, 0x09B6236182966, 0x31806D149A382, 0x6509B5CD9EF6A, 0x25489D00FD2F3 },
+    { 0x0C7ADB2B05CEF, 0x28EA8BFE1140F, 0x3094C1D9074CF, 0x01AF936052E2E, 0x2A95291F03EE2, 0x5694CF47B1A3E, 0x29AE3457F4356, 0x440296FBC1843, 0x1ECF2BA451C89, 0x133896CC574B6, 0x32BF33B02EF70, 0x162B15B7BE50C },
+    { 0x0303BD228C34B, 0x4E69F0551D45E, 0x12A0AECB00875, 0x377B70C881613, 0x336C87ED73F56, 0x6BC4D24528389, 0x6E1C24EBC201E, 0x103A7B335479A, 0x2CF629E71B3F6, 0x22ACA5C6FB771, 0x0E7FDB006DF67, 0x05C97BE1797AC },
+    { 0x6A1729A63FA1B, 0x7EF02DF8A0D19, 0x7C3C1ECA5E3C2, 0x30FAD55A5419D, 0x71889787E8296, 0x00BC65A41681B, 0x44860F8C5BD24, 0x55AF1E019753F, 0x3CD68AD288864, 0x30DE8D3043450, 0x56BDD45A52B0D, 0x265074B0DF115 } },
+  { { 0x558EFAE0FA86D, 0x3ABA9BDD0B7C5, 0x67568C93FCFB2, 0x010B591FC17C3, 0x6FC1AE97D19AD, 0x339D0E6149DC4, 0x46465E0F516F1, 0x566C823B5CAE9, 0x0ACB6E37BE540, 0x1D6B72B71FF05, 0x4C280EB0D0516, 0x17D294D7F3D00 },
+    { 0x58CB3BD5D91D9, 0x7DBF3D66C8624, 0x3159A3288B328, 0x62D0AB430F12D, 0x5ACE7D3D2DDC5, 0x128968DB99889, 0x7DDEDA0AAB942, 0x7B60F4A6A3408, 0x761DDA1ED8AD6, 0x4999F61E437F2, 0x686824DCB6F65, 0x2AAFC236583FF },
+    { 0x17954E67486D1, 0x38AEC8A317406, 0x7EED1883C5063, 0x038B67619D5C6, 0x5A28E2F9101CE, 0x2C48606AF5115, 0x39B99776E7061, 0x5C1DB8C0E9C25, 0x2BAEFF67C5F1D, 0x56659E073FD34, 0x208C2A8AA3BDD, 0x1F32FC83324F6 },
+    { 0x0E2C96CF30D45, 0x67A0454F15E95, 0x260F22C16C452, 0x04AE8EE18E374, 0x403BA00E2C624, 0x38D5374CBEDD8, 0x6D024923E3EBE, 0x553C5C9D8E75E, 0x2DC251DD0991F, 0x1659AD7D949C0, 0x10D2176D48DB1, 0x270055E101586 } },
+  { { 0x76F69F20B235D, 0x7588DCCA3233F, 0x69C69C8C4F9BE, 0x5E9983B4BB9A4, 0x620FECE8AEF82, 0x18C303CA708E5, 0x1AF4A4666C222, 0x1F016F135F0D0, 0x2680B071E9415, 0x6E56977B780C4, 0x11F63431B3FBE, 0x26515E1B6A7FB },
+    { 0x421DEA14E41F5, 0x4F257A13C1D21, 0x2C16F02A011AC, 0x29C7CEAC85E64, 0x09862404F1E03, 0x5C74B2441B53C, 0x2D8092FABE711, 0x653BFCA89CFE0, 0x511E439E721A5, 0x17CF049B61AE2, 0x7933B7F1F7516, 0x27520AC625149 },
+    { 0x2617740214DD9, 0x364C6D6988328, 0x1959114A87539, 0x5EBA6CEB6BD59, 0x28285578BD2B2, 0x18C9C6341D2A1, 0x2A55050904128, 0x7B7FCF2F34D5D, 0x55C9442CA8A6A, 0x2C77E383E0F2F, 0x39C78E247126A, 0x3E91FA4A13F00 },
+    { 0x794E6D400F4E1, 0x1982E05E689D1, 0x0A845F902DE4B, 0x094FD212526C9, 0x568EAB09675A5, 0x1083C87375B95, 0x71A80BB78D3F5, 0x39EA1EAB3DB02, 0x4082D8176555F, 0x6C3B39424AD57, 0x2A9E3B02567AF, 0x25C0019F22242 } },
+  { { 0x4A7D4FB3B36AF, 0x7E3B68A4142B9, 0x270CA9498250B, 0x05E40A49F5367, 0x66DC02111083D, 0x160C2E7425A0E, 0x0B1928ECD834C, 0x0376D709CB279, 0x2EA72AECA619B, 0x74AA8DE6F418C, 0x3F52EB24A85FC, 0x0832F9B698D7A },
+    { 0x2F154468521BD, 0x4BF0084C4582B, 0x725F6528A0AF0, 0x7538DB4260635, 0x530D3034B1997, 0x48C04ADA148DC, 0x0DC660A0FBA65, 0x03E9C11CD8128, 0x5F7C4543D4887, 0x7754C3FFA8741, 0x19ED28A8DE8D4, 0x1ECDF134352DC },
+    { 0x32F0B44B914BD, 0x63E3296661E17, 0x4AF795B1F6D7A, 0x2CAB12592AC0E, 0x3BE14841AC7F8, 0x68C0F183786FD, 0x68F47225B754E, 0x428FCDB0E2FCD, 0x08A56BD30237F, 0x1DBF49E7CDE29, 0x1D0A6DDBB23C1, 0x272389A5BC3A4 },
+    { 0x1B540D6139A01, 0x5CD92BB044064, 0x32755B7E1F07E, 0x2D687E26E74E7, 0x4C8DB089B1FA9, 0x38795EAADC4C0, 0x2A0DFE8800155, 0x324961C059F67, 0x558DA1DA19FD0, 0x6F9343DCA7443, 0x22F9F25C6E36C, 0x2E6F7CCFC2E49 } },
+  { { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 },
+    { 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x3FFFFFFFFFFFF, 0x22A96AC0B9B80, 0x47FCD5D8BC26F, 0x52A9AE7BF4504, 0x64AB65F421884, 0x04309479F6232, 0x13DFB53B440C8 },
+    { 0x3163C48AF428E, 0x77A6572D075B4, 0x31AC68B84938B, 0x317D79EEF32D4, 0x744CAB90D50DC, 0x1A24404D7B6FC, 0x28727E92D5211, 0x266F0A3200A6A, 0x052C141D36443, 0x4FBB0210FA874, 0x4A48DD9F426BF, 0x49433C30F7E62 },
+    { 0x63194F0CA386B, 0x22FB234CBD8A5, 0x2F5FDECCCEBF5, 0x2E0D1F2726527, 0x094266BC3BAFB, 0x6A8E29796C101, 0x50D563064B5DC, 0x43BC39C5DE4BC, 0x03B4616FB7907, 0x59574ECE45962, 0x7334A5CF81CB4, 0x24DDAE30CF96C } },
+  { { 0x10EDDDC7CD58B, 0x3B3E495FCDB1B, 0x063F86D1A9B85, 0x3A0C9B63014C0, 0x1DFD5A28FB882, 0x6F672EA55030C, 0x7CD442BB75064, 0x06D240338FC5F, 0x550DA19293504, 0x1371B07DA5690, 0x09193FB676151, 0x03479B10DF9BA },
+    { 0x6FB1BB5523B9B, 0x632B78AFE5FF3, 0x1029846FA7455, 0x3E756BCD39CB7, 0x186F979E1CFCC, 0x78BBA3D91059D, 0x2F4F5EB527F6A, 0x1B2D6C1DA5A2E, 0x6DDE4F35B3FC0, 0x1A9C75251BA51, 0x17EE06A1BD692, 0x07CE7C37A609B },
+    { 0x6F12223832A73, 0x44C1B6A0324E4, 0x79C0792E5647A, 0x45F3649CFEB3F, 0x6202A5D70477D, 0x1098D15AAFCF3, 0x487E92C5FE69C, 0x09276B7DE887E, 0x5045BB6555505, 0x35E51B6A9DA78, 0x7F47E93D76314, 0x2477CF65A87D5 },
+    { 0x104E44AADC463, 0x1CD487501A00C, 0x6FD67B9058BAA, 0x418A9432C6348, 0x67906861E3033, 0x07445C26EFA62, 0x160376CC4B796, 0x74CC3F93D2AB0, 0x37750DC234A48, 0x2EBA56C3276B7, 0x707322522EDD3, 0x1FF0EE3EE20F4 } }
+};
+
+static const uint64_t ladder_table_B[OBOB_BITS-1][4][NWORDS] = {
+  { { 0x65A9F586DB4A7, 0x6E25E21B2BCD8, 0x6AB0EE0D612E1, 0x4C0C164130CEA, 0x08FD2304ECDAA, 0x7853BCFA982AB, 0x52F5C5BEAD174, 0x14D8C5099F1A7, 0x083662EA5CCC8, 0x696A272BAFC0C, 0x7B2971CC1AE6B, 0x1121C38A5CF7A },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x65A9F586DB499, 0x6E25E21B2BCD8, 0x6AB0EE0D612E1, 0x4C0C164130CEA, 0x08FD2304ECDAA, 0x7853BCFA982AB, 0x38399C48D527B, 0x04AC76E3E93BD, 0x0D7DEDB1B9308, 0x6AC9BA858534D, 0x35D1907790D32, 0x275DACC815A6B },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x6A655889084C8, 0x085C151148863, 0x44E2576B4AF8B, 0x23709CDE93967, 0x6DB60D2291632, 0x30A967DE6F5FF, 0x6ED1AC583E5F0, 0x5F3EB36567A97, 0x198A1751078E7, 0x395A6CC4D5EF7, 0x5053297B61AB3, 0x07F47154C3C08 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x441FF1BB6885E, 0x35AE57F93125A, 0x3B2A0E6455991, 0x341D6C052FCC8, 0x5027F026A6459, 0x0E7FECDD5C31D, 0x666D4BEDCDA73, 0x179FF913055B0, 0x0827CB0908601, 0x35C2F96F605F6, 0x657D136FF82F1, 0x24CDADFDE8602 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x51A95E9F3418B, 0x49115076B3000, 0x13FB6615F21BF, 0x07B8DDD1CE9B9, 0x105F8339FE19A, 0x6DB05C42AC7C6, 0x34DE6F31564B3, 0x118F569AA2F53, 0x4F49A325DDEE9, 0x10B983C8FAFEA, 0x01BD1C60E360E, 0x25F0F5062A5F8 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x573678BEEDF0F, 0x399A8F4F845A2, 0x723439BD98A03, 0x21BD3F71E4A8B, 0x1A1752D1C223E, 0x6FE645A10F789, 0x62E27C880FD4C, 0x214DCE1A8137D, 0x2F0C95DF28DF2, 0x487719D8BD910, 0x2A659E3FBD757, 0x2944564C3EB61 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x230EA89550095, 0x76A0CA920EAF1, 0x3CD51DACCEEF3, 0x28E9C65D4CAC1, 0x130DA3AE72164, 0x7446CB0D73448, 0x024A371E83630, 0x06BD0CA0AFDF6, 0x5354D470AB468, 0x4A7DBB8EAE054, 0x4F8F4B192600A, 0x079C1EFF8A848 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x51631336A4E69, 0x13566BA7CE5D5, 0x37238E5A4CF70, 0x0F348D71C1595, 0x09A2BBA81E642, 0x1FC64D0406244, 0x4DA7EE3EA76EC, 0x65067573BAD05, 0x1444EC079B4E7, 0x24D43C32029DF, 0x3501CDF76787B, 0x2838784CBD7CE },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x0FF3F10839240, 0x3FC29B9BC6D0C, 0x22755ABCC7174, 0x2EA4F4B4B21B5, 0x57819E1D57316, 0x4C6443301C212, 0x07E18A270AC5E, 0x02D53E7BC18C7, 0x73F1B651F0E34, 0x306E0B9B1A779, 0x502457E56EF61, 0x10EF19CDEF8BF },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x21075FA70C28A, 0x36BF0ACC33E54, 0x54E892FFF38EC, 0x38CCA8373FF12, 0x4868AEE78C429, 0x7F70A6BB17B4C, 0x04C9A7A9A7F86, 0x7DA92CCCD3B6A, 0x6E2990D8C41F5, 0x0E2B931B42890, 0x3B8BB4D67A0CD, 0x35C1114CC3A7C },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x3062CA497DDCB, 0x736FDFC133B54, 0x35912195282C2, 0x7E158310F3794, 0x3BC71E3ADA56F, 0x4A13C3F76F23B, 0x3E47431ADAA29, 0x382C947E07286, 0x25DCEDE386359, 0x27D3AAAF79584, 0x0CD222DE2CB9B, 0x1C4DAE0D90FDF },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x35C33115D390B, 0x596C754013D51, 0x4D01EBD5FFAF6, 0x4807F0B223EC7, 0x68DAD6EBCEB90, 0x64E2AF6051D6F, 0x41CD87F78E91F, 0x2DF45896AED27, 0x235577EAD5D92, 0x19F06D5F445E6, 0x19049FB7600D5, 0x1CC42EB01A24B },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x43E722F4655C5, 0x28E4CB97A8B4A, 0x62DEB79779121, 0x279E3C335D688, 0x33D525BE1F7F9, 0x5EA8C6E713906, 0x7A60C0F941DF0, 0x59885757EBF51, 0x5FF526B590245, 0x2E99448D1CF3C, 0x5F64A37B84040, 0x098204718A4BE },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x7C4C676AF5349, 0x6C3ACDF9A4522, 0x3BD22D161E2C7, 0x2AC4606AD7BB7, 0x089E4AEB7AD2A, 0x12814879AE2AD, 0x45E1BA4850676, 0x0B779DAF86AB7, 0x7EF4369FDF795, 0x0E4FFF1DA908E, 0x2FEFBD0738238, 0x2BF310CF2EE96 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x25B82CB65E650, 0x444B9935807EC, 0x5B9EB109AB552, 0x67C999025AE70, 0x3FC878FE7715F, 0x05B16D2990563, 0x0C31D0D05CC40, 0x21429E2F55B8B, 0x5D64AC14A6ABC, 0x2939F5E8C61DE, 0x49D9025EDEC08, 0x12A7B0C282481 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x5B3F5EC9CE9EE, 0x64D0C5C70A4B3, 0x6DB8AF9F1BD66, 0x58C35C8974607, 0x7D0262E71F75A, 0x68D97AAA9924F, 0x5B2F5593B2BA3, 0x7FC1D5D022250, 0x1A2EB07F501C4, 0x50DBB43A523D8, 0x5AD4184374712, 0x30365AE830452 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x2E232CD480E7A, 0x28463A0862441, 0x583AD5084E007, 0x509527C3BE8D5, 0x6CA212381485A, 0x3C85A4A2F1629, 0x7B71075243AC5, 0x18F63EA1856B6, 0x47489365A5E87, 0x71C3C6CC9FF56, 0x5282A355D2BA8, 0x092A3A40A6944 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x78586DAA01EBE, 0x2EEA7B4328C16, 0x3740DBE24CB81, 0x257593E5C1423, 0x0C8761E1E3E57, 0x368EC1874C958, 0x4B127B014A1FF, 0x21C30A715D53E, 0x0F7C2758FFF04, 0x5F51DE1D656FD, 0x41029B13721FB, 0x2C340A3592485 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x60F6228F68BDD, 0x38C05130C2743, 0x37332F71600E6, 0x6A967A1CE7F16, 0x264D86BE99218, 0x4740AFA3000B3, 0x7CDB2E706852D, 0x5BB02A1D3F5FC, 0x68B79A0D49685, 0x51CE0910A203A, 0x0392DEDA90853, 0x21D36FA9F341B },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x2748ED62BBD4B, 0x27C2C432C9788, 0x7DC27C22C2C8F, 0x582D4287E1AF6, 0x28D128163EE21, 0x0DAAA3E89B9CB, 0x16FEE2FD1F051, 0x6F90DEE12BE1F, 0x2B45FF45296E3, 0x65AC2F423D61B, 0x1A3B8AE0DC925, 0x25009E42830E4 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x44BE94F7EADE4, 0x0D385EABB5EE9, 0x203259A863791, 0x4C28BCAFA17A5, 0x4EEBBDC4CA4E7, 0x265D37C222C57, 0x07C3D6E5DDDFC, 0x7C17D379AE96B, 0x79EFBC44321C4, 0x37E1870AE3FE8, 0x01A847ED094D7, 0x03960D06250C6 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x58EF0781D242A, 0x0C3DC64B193D4, 0x4CE7B4E776C63, 0x41CF8BCD382C8, 0x18AC1772686F9, 0x4DA3D6CB394D9, 0x1B99257CA9FE8, 0x63189792455FE, 0x7210921063ACF, 0x401D707BC89AC, 0x56C152F66703B, 0x258EC603215DD },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x7CA1D88022A7B, 0x01E86F4120994, 0x5A520CBDA800F, 0x4ECABF1630CD3, 0x4E783FA3EB65F, 0x4208B7866865E, 0x185E7C150BA10, 0x75D594C1AD8C6, 0x1CA0CA62185CA, 0x6A8A0EF40AFFC, 0x08CFB9EF0C682, 0x100D0564DF3AF },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x39387C52E034F, 0x2C4161F4E4D88, 0x397DBD14464B9, 0x6433F4B311D2E, 0x4BA07C7668BA9, 0x155AC6BB4373B, 0x40778553F11E0, 0x06C3C4535D859, 0x33026EC376612, 0x240C8D1235D96, 0x091EBE6A735E9, 0x2979A0DC35187 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x73800F61B1BEC, 0x0BEDE5E06A596, 0x1300302ED6E93, 0x45FD8028E5C33, 0x049E5DA4F94F4, 0x165E3D34710E4, 0x5FB0C6AA1E4A0, 0x71405A1C83D58, 0x2C6E07FD68F17, 0x37105AE3DBD5C, 0x01AA3EC1B7587, 0x156DCD173D620 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x2B0B7A8CD0EFE, 0x7CDA80B293C07, 0x2B508E9E19253, 0x27DD255047113, 0x63356191E5498, 0x6F7D329D2404E, 0x6755FCE366831, 0x3CDE59A503003, 0x549D4EF107651, 0x40E79F3AF82FD, 0x5A2549C7DA6DD, 0x25C9B08D82E0B },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x5A35D99371D5A, 0x664237F3EC050, 0x330C703E7BBA3, 0x01C2573CC46FD, 0x03CB68DADB9AF, 0x390413EDECB81, 0x2D8AF2FA4400B, 0x07364D63A27A0, 0x21E3EA7DBDFAB, 0x633D7ED26A9F3, 0x37DBD8AB0E071, 0x1475F51ED07C4 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x390A2300FF0B6, 0x4D38DBC4AEBBB, 0x4627F0989210E, 0x26BBC85C1E6A3, 0x362E1DD17EE18, 0x261F5DB721469, 0x17125E31C8453, 0x47B500568F59D, 0x5B6FA01EE9931, 0x6890B12A27026, 0x7300DD6B1D65F, 0x1AD2EDFB6E965 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x181F617D6A974, 0x2243BE4730660, 0x77248CA378C24, 0x0F7A0E80A2677, 0x1F5DB04A1133D, 0x55224FC6D4900, 0x01DC286DCAE54, 0x404CD0E93F396, 0x094B2BAB6C42C, 0x7A4AAF8FA59DC, 0x157E2BDE031AE, 0x1488122E32D10 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x3B29DBDF54EDC, 0x0D738AD79C318, 0x0CD0FCAADFB29, 0x1E72D2A85C2E1, 0x7BCEB5223A0DF, 0x1ABFFE73DF4F6, 0x243A55C6BE4A8, 0x715F83A721892, 0x36FFE03FC658C, 0x34FD5C262667F, 0x1A967514D9379, 0x310DC39DF6BAE },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x3115DFB723F5F, 0x399504961D93F, 0x509EC698473AE, 0x29FDDCB7B9C26, 0x719C3F9103412, 0x1B71EB75B45EB, 0x067FF470AE905, 0x53B3D933276B6, 0x46B6D09BAE687, 0x5C10CA32554FE, 0x776E948F4800D, 0x08DE1C0D51C92 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x55C549661F555, 0x1354794AEC95F, 0x0A5D9BA333502, 0x2CAD0877AE4A5, 0x337A196401D42, 0x33D489D72E953, 0x6373AF2846D7D, 0x200A9CAD871E6, 0x606174E5ECE0C, 0x46C756491DBB7, 0x7A10612C2A9A2, 0x2856D70557511 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x3E6B4895AFAF7, 0x04F0C60FA79FF, 0x7D768508A5617, 0x42CE8A47D824C, 0x53B0EFB467029, 0x324B64AE36C80, 0x311F63CE4766C, 0x058E494CCCFAD, 0x02B621AA7CE9A, 0x55EF1B9656A1B, 0x049FA61403348, 0x2236FAA7C67E5 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x280C4A0CA845F, 0x058D08277B099, 0x67BA6C5442BCE, 0x4E07F320C270A, 0x336B0A86A2582, 0x79663E80B72BE, 0x3E0E0BE56FB95, 0x57DB4A1BEC88F, 0x5055180E4B950, 0x0DF561557C8C5, 0x3FB1C4BD24580, 0x2A3D4C85A89E6 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x1EBAE96B95A0F, 0x45A2004629DA9, 0x0B658CD18A791, 0x00B27E936C4A2, 0x33ECC7F731F95, 0x67471AAA3DFDC, 0x7B63FCD97D7FF, 0x5C91E03307561, 0x1D698202C5578, 0x36AE541EAA40B, 0x06D7B12A791B3, 0x13EB70C51CA51 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x44AB869C69BB1, 0x21BFDE5ED0644, 0x4E8686A1DAB1B, 0x2736E47EB7D7E, 0x50D6C4173B4E0, 0x34B0188BF852C, 0x7237574351E5F, 0x6B29CBC1B1D63, 0x696F84FC8A294, 0x3ECB1FC74057D, 0x7525680CC5698, 0x2F091AB280065 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x7645D38DB8D2C, 0x1138070E93295, 0x376A483086DBC, 0x2D799ED5BA595, 0x02FE9755B6CB7, 0x2223AB5BAFBB2, 0x2E51DAC11A6E9, 0x786CB4ADCCA7B, 0x6C7E2893CCC87, 0x43D5244550AD2, 0x0DC48C1692409, 0x1E2D027FA3527 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x008A2D2DB58B6, 0x265841847892B, 0x25EE6CD7AAEE2, 0x15CC5AE347AEF, 0x06B74985A0D7C, 0x77995C6715FA7, 0x11BD0F883423E, 0x1A8DD124C6919, 0x345CCEBE29BF5, 0x0C5A5DC5A401A, 0x2BC9B4BB29A0F, 0x1F77D51F0E045 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x383D1AA6409F5, 0x0450C9C113E29, 0x4748EDABF78A9, 0x17906166366ED, 0x4BF207A3F17CC, 0x687491B9A79C1, 0x28F078F7EC309, 0x1AB01B5AD2C7A, 0x0FFE0C6F52184, 0x755433F81447D, 0x025B1203D0C62, 0x13E467291D176 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x5C1FE9036377D, 0x63C5CABA4A50A, 0x29B4FE465AE33, 0x567C461429CF7, 0x3AEB1B3C80070, 0x40A69549EF3FC, 0x38867AD34A253, 0x26AA678871574, 0x06EC6FA3ECC81, 0x3D7468746EEC1, 0x181669855DDEC, 0x1A76D79D56E71 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x3A9DC8B3D6D91, 0x45E8DFE05E8CE, 0x5DCE10441B4D0, 0x0F92C2EE1B34C, 0x11036DEC60081, 0x2FAE130A5BD76, 0x112E6530F3441, 0x3093D40E18FEC, 0x7C87B6F276AF6, 0x2FCC844488942, 0x7EE7A05608B6D, 0x13A7CD7A7F982 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x101A3624AB57D, 0x647735165E139, 0x38ACE7C41F6BD, 0x727E091B14CB2, 0x058C1507882B1, 0x0D3C0679EB72B, 0x088B82DFE7D13, 0x78EFFA9EF73F6, 0x232385D73D025, 0x4235677D10BCA, 0x5AF3A78F5E108, 0x1EDE93DA97A95 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x5AD01052312CA, 0x085D9DE6B707C, 0x533B8B3BD0575, 0x12EC6147DE2A8, 0x478A5095D6FD9, 0x56808CF0DB8B9, 0x6F9CB69F43436, 0x77671CA5B762F, 0x71629FE48E618, 0x4D50CCB36C109, 0x7389FC30A7315, 0x09B6515E09EC4 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x6083CE70C2750, 0x31088DB033108, 0x5C9A16AF0E9C0, 0x70ACAD695DCED, 0x077BA3E321815, 0x1ECA622F9B17C, 0x584B9D768E223, 0x1EF4A60E7A31B, 0x1D13F186A4430, 0x142FE058B719F, 0x029D69895E979, 0x230ABA3C3A010 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x6BCB79072E97B, 0x7F789DA0BDB52, 0x7D71073BD948E, 0x3BD5F6E1E5EAE, 0x149C6829E2B0C, 0x0280504E3FCA2, 0x53F70212F6543, 0x187ABEE500731, 0x26B4C570B99F9, 0x7CC1B2074FFAC, 0x55276B92FE792, 0x24D3E60235329 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x7AFAB0DE77541, 0x755DE04E6F0B1, 0x0B01188B46AB9, 0x407D0F6C7E682, 0x369D63906A39F, 0x42CFFE6E68AFE, 0x61B18C5E1E516, 0x7185B8F8651AF, 0x6A36E6AF7925B, 0x77607E8B81E1A, 0x2EC53FDE38E51, 0x2734EEA679E03 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x25780297DE068, 0x4BDAA6FA44BC8, 0x6E5A016528E74, 0x765994A0ACC83, 0x656375013C0B9, 0x5166816441094, 0x059E65984000F, 0x4BC1D545F6A21, 0x761A687E88988, 0x64A094CCD4DFA, 0x15A67509FE611, 0x05CC1D2B53F7E },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x6FF2B933C7E54, 0x7C2310F3CE5CE, 0x6F3CD531B17DA, 0x35821B0798F1C, 0x672649A5DAE60, 0x196B65E5C05D1, 0x42D20AB53C59F, 0x65710EFD1F329, 0x37C3F7F98B470, 0x0E88519DC7871, 0x1E76BFEC73885, 0x261E65AC2DE05 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x054B638814D29, 0x5CCDFA4CB7973, 0x3B464B3EE5788, 0x199FF3BF9C291, 0x00DB413109949, 0x161CF1BBBB52B, 0x5066B8A19DFF1, 0x4272D30E2EBFE, 0x1F27A43201EC2, 0x7553D272CDCD8, 0x3842017AA6816, 0x0E8F5E84E74C7 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x2F8172F7CE50B, 0x7FA1DA3E9AB3C, 0x508828FC3244A, 0x2BB4609633990, 0x2B7F6F2DFF615, 0x04CA0DEC7BDB5, 0x4544280AF5F43, 0x1BCF41A0C6ED3, 0x034EF548CB093, 0x3123726690CC8, 0x2BBE0EBD7AC59, 0x23DD020D0F77D },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x38D9A499815F6, 0x7D0C7BC44FAD0, 0x4A3EC40520A92, 0x6D50DDF3A189D, 0x1E6B35414F430, 0x79DC4BC9A0271, 0x7B9F4D46B35BF, 0x1DBBE2D4A8A5C, 0x773352F7CBFC6, 0x054B9A7587A54, 0x20D2AF207A2D7, 0x06913A005D1D7 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x52BCEFDA759E0, 0x42A68D28014FA, 0x1BE8E42E9C179, 0x78AA81882A7CA, 0x712C4FC9A8B11, 0x19A1F9C515355, 0x38B59510389DB, 0x55FFDDE9FCD46, 0x4189BD8E4F4E9, 0x4884C40FE91B3, 0x5EA1FBBC568F6, 0x23B4F9B8E2138 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x203EAA387BB99, 0x5F1667ED898A8, 0x301DF2A046674, 0x7CC69AAC1B96B, 0x76094A315D145, 0x33BC0D5D3C8F9, 0x2BAD8068CDA8C, 0x7ECB78B8B5A3C, 0x0E04CA8D13964, 0x3367EB73B6C1E, 0x22531C483B54D, 0x03A83485C1094 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x41D0DBD123A29, 0x65601593783EC, 0x3DE3C562C9E60, 0x5111D7B579012, 0x3256B5933E1D8, 0x0FDCA5E8E2365, 0x43EB2ABAB8566, 0x1F7B9104E5865, 0x5A73D9CB633FC, 0x00B60EE3773BE, 0x460DBECEB65E2, 0x26A5F898CFF5B },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x298B273881389, 0x68E0D005B8231, 0x26CE7508CD53F, 0x73DBBA17FCB7B, 0x4C7A1A44FF728, 0x015DA76F3FEA4, 0x3A3766775DBD5, 0x6584EF711CC19, 0x385592350E5BC, 0x6E6D1552E4EC4, 0x2C97271E08A7D, 0x0AE9E829F10AF },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x40BC520E948AD, 0x2DDB0CFE6AA8C, 0x240AA51F38A7E, 0x1CC7ECEEFD2F6, 0x270C387F20490, 0x5D7B9C108D730, 0x0853097944BEB, 0x1B4A9214435E7, 0x1F63D5D62EFCF, 0x1DBC7E6280E1B, 0x60A8EDCC5ADD2, 0x2789FCD30727E },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x21AC56C05A95E, 0x440CBF391B35A, 0x1F77A6AEA67A8, 0x094F707D82F63, 0x34AF13D81D7E3, 0x48A7F775D5D93, 0x7B167EBC4D3D4, 0x19DD1DE90F6CD, 0x247D9712E0FE6, 0x2D1A700FE6CF5, 0x3DD7032266842, 0x0DB8F6BA9B554 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x27E83AF95BDFC, 0x7046B753083ED, 0x6F6FC425EA881, 0x2D789EA70945B, 0x48B34A0EB2543, 0x38D6D32663525, 0x4412FE0A6A02C, 0x48FEAEBD84D32, 0x0EA7AF02A9A97, 0x259B0A55649B0, 0x0400819B5AE77, 0x2189E7321923A },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x0765C9905F774, 0x707C521AB51B5, 0x3F6A2C4F5B114, 0x6D4549B1B44B8, 0x6BE85DEC3F600, 0x2486F1912779D, 0x4592F51A039DA, 0x59E1D551C48E6, 0x3396AF5334C94, 0x6F6B913721DE2, 0x2C43F3554C2E8, 0x0F266824FB420 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x5D75DCCE23B2E, 0x373D810514551, 0x04DC1CD0D97B4, 0x573EAB48EF746, 0x0D9BBCB35D095, 0x745A33CF392F1, 0x5F7F0F4D34850, 0x363647FD0EF2A, 0x231E2C20CF75C, 0x274C63B8B1F10, 0x2E2E6990C7F19, 0x310908156B18C },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x6A5BF30B05037, 0x721EF4EE41BA6, 0x3A1C37C4293A7, 0x310CC1054B305, 0x21423CDD12B2C, 0x6D30C26EB0A68, 0x10F21AB7DB9EB, 0x4D7AD10E59C58, 0x067EF8F21FC8F, 0x0CF54A7957180, 0x4C2EA936D764B, 0x1592387D41CF2 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x6C0765A51276F, 0x02B4942A4A68B, 0x4FA218956530F, 0x723DE6E4C0DA1, 0x48754CB61BCE4, 0x6ADED81D494BE, 0x11FC332212BD9, 0x415BA7E74417E, 0x5BA2C7CD33330, 0x67A55E73EF2CE, 0x1D58289BB884C, 0x234CCBCE79A87 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x7234BA9C54AE9, 0x61F3B5C536B64, 0x2D8E6FF354B6E, 0x0F349C59891AD, 0x1D3B401FB5FF4, 0x358AED2985529, 0x741B1EA277413, 0x083B4A7D65C51, 0x03219B2E179A8, 0x061A76B2B945E, 0x15A687BEB8B7C, 0x1D94A97788948 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x65BEB3FA6D90F, 0x5833983394D01, 0x31FB58CCF9CFD, 0x659BC421C229E, 0x6A97866B59C2D, 0x5C749E2F2D82C, 0x03B6DF330DF7E, 0x7E6945977843D, 0x4FF0483907C6E, 0x533A8E8903412, 0x36833ABC627E3, 0x1E8BA4EAA6CB9 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x0664E242CACD3, 0x69B260791A822, 0x604021D692447, 0x4D2C08A9B462C, 0x42BFF03EA64AC, 0x5F7EFDEE83FF6, 0x5CA7DDD60A395, 0x4FCA1E63015FB, 0x0FBA6FA1DC7AF, 0x19E95185059D6, 0x53786FDF2DD9E, 0x0CB58CAB04E49 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x2980E1F8ECD81, 0x5BC83B47D349B, 0x3ABBC99F88B68, 0x60166A4674E9A, 0x2B281397F309F, 0x0ABCE8D486DB0, 0x047C78034C059, 0x4A58D2B6951C3, 0x011D9D488ADA1, 0x7CF4F71AC0FF0, 0x0D9BFD7CC9F8C, 0x2A730BD35929D },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x7604D7F1DF300, 0x64D12BCED4CB1, 0x1C0C7ECBEA08D, 0x2B4574248A9E5, 0x68470CC68FDB3, 0x2359C4831A168, 0x3AC80E5C64A7B, 0x53255206464B5, 0x441C3363703BB, 0x7A1DCB179FBF6, 0x7AB3C36268F3D, 0x10EDAFC783238 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x4EBC077E5B0BC, 0x09DBD52F33D60, 0x585FE2E32143F, 0x2C86B345B9824, 0x14C40FD197E61, 0x37FA7F3946E5C, 0x7317008776F18, 0x26F6015B7A9B6, 0x3490A16C195E8, 0x2B78C0BD4FBE2, 0x46B19C34FFDEF, 0x2898179ED5A60 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x353D8A91E530A, 0x10FCB5ABCE0B7, 0x466D871873DDF, 0x737D0B4AA6EA4, 0x172133089E2F0, 0x3C420A25081BD, 0x0FA210C4E2188, 0x4278599A0B41A, 0x5C1A0D0BDC13D, 0x17B2B71132FDA, 0x0FCBE17AD7CCF, 0x057909D2558DF },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x0F86998923168, 0x7F91717528772, 0x7881DF3576EB0, 0x4D100BF347C93, 0x7901C2D2C840C, 0x4CFEABDF04DFE, 0x4397520EA3D46, 0x235DB2FB7FAF2, 0x3C7AE89470DF3, 0x557891A657CCC, 0x5CFCAE9AD9E94, 0x23F621FCC7875 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x08452782040D4, 0x45D518ABC9B80, 0x5383713E2A4D1, 0x786E4B245E965, 0x7C485472EFF8C, 0x6406DF558D41D, 0x72DD6137F2DB9, 0x23ED9402E7A69, 0x38476BB40EFEF, 0x11F9ED901C893, 0x57EC749475C21, 0x19505BDE64F26 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x50E28680A4166, 0x26B2258834B57, 0x0B88538C2B786, 0x4519EDF46C793, 0x4FC73D1B73889, 0x4026BDEBE75F7, 0x39D5C34F1CBC6, 0x2AB764768E636, 0x2A6A7E3B3C50C, 0x36F3828F2DD87, 0x5C9F374099BDD, 0x28642F066BEA2 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x60906E4E3355B, 0x1C57586D1AA61, 0x333CD6E90E660, 0x31E526FF6E4E2, 0x388C27E62759D, 0x2FE2468F9FE2E, 0x703DF9F4B90C8, 0x370DED8FAF645, 0x69887F0D37FC2, 0x1466C13225C2E, 0x6133E55D4157C, 0x17E36EF54EF61 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x080DCBDEA17C9, 0x4CB17CB152814, 0x2EEADDA6CBBB3, 0x19ABBBCD52783, 0x09EF5216AE22D, 0x512C6AAF618C1, 0x6198480226F82, 0x54FEFBB9C2B35, 0x07EC35C558CB6, 0x6DF855BEEBB72, 0x30B7C454ECD37, 0x26ED2C0F6902F },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x267855AE70EBD, 0x30CE2A96F7733, 0x725C8990EC0DF, 0x4A0EC1DE08E8F, 0x4961B84585365, 0x17E7231E686E0, 0x15357B8DD2C88, 0x7052CF214B404, 0x2E36461ABDAD1, 0x44513200487E8, 0x6899CDAD0DCEE, 0x15A8A8C14AEA0 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x72BAA542664DB, 0x46997B38F361A, 0x49FFABFF069EF, 0x7F88BD92012A0, 0x7058403738139, 0x07B260C7D8BEB, 0x720C69598AD5D, 0x1A580F3DA0018, 0x3D010F2F8DB63, 0x53977ED13EF87, 0x70EC31E8816F0, 0x2A3868C227AF8 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x609C0C9CA28E1, 0x3BE0085746B36, 0x6CEA980F5B31D, 0x155B098066562, 0x76D6472524D4B, 0x317167F414267, 0x3E64691E00C84, 0x45AA33F77F598, 0x6296DF38B6D3B, 0x204864A29C839, 0x7A14D6B2B38DA, 0x21424CFBB4966 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x320C6FE62095D, 0x22EDD91BBD29A, 0x240263EDCFF68, 0x68DCF097DF69A, 0x594D4FE0937C7, 0x07DE325FAEC2F, 0x2A231BEE16F16, 0x39ACEA371DC3C, 0x667CE68916FB6, 0x46DB6BDF1647F, 0x027ADBDC1BF6C, 0x24DA669997C1B },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x55D3BED0968C6, 0x12A869B626B27, 0x07A86E064D87D, 0x0D8E9460AA4BD, 0x79DE7084E31BB, 0x47B107BAE0AB0, 0x0F6EABFCE2516, 0x719EB4354BD3E, 0x272DBCCE9695D, 0x588AD41A56E1E, 0x2FE21401FC152, 0x18D4ACEFC7FE8 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x6E30BF79FDC80, 0x133DA3ABFB4C6, 0x3D46FD5198766, 0x600F124EA629C, 0x54C5B16311715, 0x2A352C24905B0, 0x74BF9B1DE3BC9, 0x4F6112985AA2F, 0x105F4C8535D58, 0x5DB12F23140BF, 0x1186C0005805B, 0x22695BF617E32 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x359632F632AB7, 0x61E296B9149E5, 0x32325D04AE450, 0x5C5E60B0D41F2, 0x6F0CA792DDE20, 0x6D92518C8B734, 0x20CC077144FC4, 0x628963F0DAACF, 0x26BD716D7357C, 0x27A568E65183D, 0x24D1A83E91573, 0x14B559459993B },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x5CD4714167A57, 0x5DDCA903A43C7, 0x30BCEC4D65B7C, 0x0672BD5287165, 0x4309A1643A943, 0x2BE5CA6D3B920, 0x007A7B209E063, 0x573D04BEA9EE0, 0x557AEE8CE8DB9, 0x32C118F8C6FBB, 0x7BD69C7A45C3C, 0x2641C0791AA93 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x7B2EDC69FBAD6, 0x1724D4B5E3B0D, 0x7FBEF0CDD5FEF, 0x721CD7E853BAC, 0x58E63C8A33EF7, 0x718427068502B, 0x2C5946688B53C, 0x06311E4443C2D, 0x1EC44323496FB, 0x1425C78FF2262, 0x56217BAD3D24D, 0x140717DE1B7A8 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x7C35BFB11CF28, 0x655B9A62B4369, 0x67051FEF47667, 0x3153D19D5BA69, 0x0D529CC2AF877, 0x37399D585BC2E, 0x33594A919B919, 0x708D857CF6B2D, 0x74E70AC9A5D7B, 0x2536564D85C90, 0x27703D57D45FA, 0x1B01BDBEA1911 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x4A6F78BFD6D37, 0x11DA970295965, 0x259792828EF29, 0x437BB6B5305FF, 0x13750E47A4B02, 0x03859D551A647, 0x1CCC3C906372C, 0x532B769CD665C, 0x7EEE5D0EE6DD0, 0x0DD50251B6388, 0x05B153D2E0204, 0x0EE61767BB55D },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x50AA3C7A843A5, 0x31A53174DCA37, 0x26282492ED607, 0x215580F85C819, 0x786208C54CA5E, 0x2D95CB641070F, 0x4D8EE3F7D811D, 0x7CA889E4E2794, 0x6644F18DC4060, 0x68472F970AC39, 0x23BAC3564F08A, 0x25727A80E98B8 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x04FAF35E31B25, 0x120943E5A4AA1, 0x0D47ECE7B9E42, 0x647772853AF62, 0x3FA66CA1E3DDB, 0x3F8221C842FE7, 0x0A9E2F1485E2F, 0x6E969EDC15451, 0x338A00A270633, 0x63052C033F4C8, 0x7A20CBE56142D, 0x20C1408E83ED9 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x5DF8870976C51, 0x1A985134D16A5, 0x03F1D19366139, 0x6CB926DCE475B, 0x3FB032E2CC723, 0x6B885AAB6D164, 0x122C3557AEB7E, 0x3F819024F4271, 0x01D8D175CE4E2, 0x24C0A721D51CD, 0x2BA06492A2739, 0x2D0D60D119E55 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x57FC645EDCFE3, 0x5D920EEF73538, 0x4B2700A4A6CAC, 0x13FBB29EA7390, 0x2FB81DB766E0C, 0x46B2B077A640D, 0x0AECEC5A082E1, 0x133E56CA3043A, 0x044D688F2086E, 0x15950C1868D53, 0x502811B0A8AF0, 0x15533790EF634 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x53B3B2361CFA1, 0x13CDCEB6294FD, 0x3BB88AF8A0F1B, 0x1FE5564E456AD, 0x0C1226F6106BA, 0x1B066F7C88A81, 0x6A7A1CDEC367B, 0x340DE658CEB4B, 0x0DA300D6FC6B3, 0x1D54807C0347D, 0x4B9AFEC0381A8, 0x359C2C01644A1 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x050B1967EE711, 0x518969A33DA8C, 0x68608CEEF1010, 0x2BD3A3ACD439B, 0x5D7EE9E2CF8DF, 0x11C8B89D4513E, 0x6621F615FF978, 0x3B50E0D019E7D, 0x774ED2E39F760, 0x5B5F61C406583, 0x2BA298F49E7A4, 0x081895748BA90 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x1A0539F2685E9, 0x554D1BD59B52E, 0x109517F59C332, 0x77873B4D5904D, 0x388DD7C8C5105, 0x451421D9442C4, 0x375552ADF1321, 0x44ED2433D6680, 0x41A7E2B388569, 0x7780AC76531EA, 0x1C46F5A701C73, 0x2BCEA55C799A5 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x2A3409B20E858, 0x78E7FF31341F1, 0x08B59F13267D9, 0x3366480E3418C, 0x73F19AE005C32, 0x791324B220B83, 0x562044A6D158A, 0x20936F3239EE3, 0x415201205436F, 0x50C00210151DD, 0x12396E1E917AF, 0x0A853F1A0BA96 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x5FE9AE7C4D8BC, 0x4FEA3706700AA, 0x11727D1FED104, 0x4ACDA6B586D05, 0x001B619E37F6A, 0x16AF7C261DD93, 0x7CFB1DE613449, 0x77CD03C71FB6E, 0x73E5DABC177A1, 0x2E50A19CD2409, 0x317B1F43177A3, 0x28BF7F12424C0 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x27F9A670208AE, 0x27CA5CB9DBC2C, 0x42D02165DE6E6, 0x4FD675C9686A0, 0x1347772EA21F3, 0x0BBF79207CC1B, 0x09445FB4A4C78, 0x2B37734917728, 0x7E2CBCF8A3F68, 0x17D8E146338B9, 0x7E47D3D685DD5, 0x0BDAFCD5FCC7E },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x456187B681C8E, 0x0A2B31FC66775, 0x7A7927F898D55, 0x3DDF1E8CCD5C6, 0x0B3177F11847E, 0x7D2803869C89F, 0x045D6DC386982, 0x0B21409EFBB91, 0x0A965CC48D5D7, 0x029B240704E52, 0x67ED9BFFE3C0A, 0x2FC14428DF788 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x66F575B14BC9B, 0x5D584D1A966E2, 0x7A33BE4BB1BF3, 0x2C9A425227200, 0x443186E55FB4E, 0x5DEF2536800C2, 0x4787D18B15D90, 0x437CFCED1FA1F, 0x723D08DF7859E, 0x54FA5509CF9AB, 0x1E33BB78913CF, 0x072273D52D9E0 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x7C4D18A3A46AF, 0x7A6E4B9CE3E22, 0x26F7C996A05D5, 0x674C5969275E0, 0x69A3BDB999696, 0x48F4FD51C8D25, 0x0AC570E0B5F58, 0x2644DE343EE67, 0x470D62BE9D239, 0x53814F9DC0C7D, 0x184CB14D4D9BD, 0x26A288F388E41 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x62B6F6E8E2E61, 0x0DC5C247DE496, 0x2A6CA8F02D793, 0x625A0A1C3D53F, 0x0D6A41D99711D, 0x4B68B009C5082, 0x66410DBD258DF, 0x1A1803300EFD1, 0x2092A22FA3A40, 0x24BE834C0AF0B, 0x40149D3F952A7, 0x13283118A05CE },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x42D2B1238A363, 0x4611D22FDB665, 0x4A5823B64981A, 0x5E7E5317CA6A2, 0x7A84F74DC777A, 0x1FC787DC05026, 0x1CDD4553CB95F, 0x7CDB0806A35C8, 0x59BC674C167E4, 0x7B78FBD897924, 0x56C454F812B4B, 0x2596FCB802125 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x13DD01994E1FF, 0x3270BD7F62542, 0x60E2686831FE5, 0x73577A2478116, 0x52C279CBECBCB, 0x5998E5092E922, 0x42D8CEAB25B61, 0x35DAA01C5B07B, 0x067BC0116F5AB, 0x7711EB9B7F40C, 0x346F70E5C152E, 0x15B729B9DA3DF },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x6E5CC0CFFAD75, 0x57308CADF3AD5, 0x095FF0733C8AE, 0x677F9A70AFA3B, 0x4ABE9843826AE, 0x73874B4F5E503, 0x228CB628E1968, 0x54A041AA8995F, 0x4939690AF43FB, 0x280EAF8789A28, 0x52B3E10096E78, 0x34E7DEBF979A3 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x1A904DBCEC8EF, 0x588550E119436, 0x0CC9D99637BF3, 0x1F8EF0699D135, 0x54B7CBA5AE6FD, 0x39F17B63A08FF, 0x3E5A464996FBF, 0x2056F12DB2B96, 0x53F7CFC4A79B5, 0x3FCAD34EC6BDE, 0x415F79FF48092, 0x159BD71D3FE43 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x0C8EE18F80A2B, 0x6816F58AA86ED, 0x4C7745D9F9E39, 0x534528B97B28A, 0x79DFD2C97D33F, 0x3996298B7299C, 0x7080C13E5F464, 0x4A91DA4E6043D, 0x5FC6F5EB66517, 0x4A36295DE96A1, 0x0E264CAFA3379, 0x1446C046959E5 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x2DBEDBC94CB5B, 0x2BC643B14B04B, 0x2ED4133313EE3, 0x43A13DF0F2880, 0x21781D3345C62, 0x1E78E07A61854, 0x265B129B50D31, 0x5B689A428DACE, 0x3B6843729232E, 0x4A6139FAE3F58, 0x72800111B1D04, 0x108CC35EEA84F },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x6ABDDFFDECE33, 0x27F39DF5510E9, 0x3EC7AF615D3A2, 0x25466F4D88EA4, 0x33E5035CB58C0, 0x469706FB539FC, 0x65FE94FAEFB25, 0x7E0470A7E06A9, 0x3D4D77442616B, 0x19F8A7C6F45DF, 0x345CE05F3D523, 0x2E5F609CA0D1E },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x0E3D88D1DC4A4, 0x42EAC4D69AA75, 0x5F0929F62034C, 0x688F611DB2669, 0x46270BBCC38A9, 0x01CE74727F22C, 0x305112587562E, 0x227A3AB61BECE, 0x5679C3064C3A7, 0x24AEB6B0FE643, 0x1A9716E87F7AB, 0x0984D610C124B },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x6AD16E80C7CF0, 0x7E5D84E3E522D, 0x6F07299CF24F2, 0x259C872705A38, 0x6C504F714160A, 0x279C19DC29612, 0x2E93D16F5B195, 0x6225A7FD9302B, 0x12ECA2538A0D7, 0x62D3482C7009F, 0x7193FBE835760, 0x287933AD7EA23 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x731F0A1C8C331, 0x1C6E7B81A68D6, 0x546537E734A22, 0x24571158F2A26, 0x28A1F15DBC30F, 0x4A2DF861D38B3, 0x1FEEC1DF1002C, 0x28E9C0584A29F, 0x57B147CB05BEB, 0x317D86FD77CC0, 0x4942BCE29D475, 0x1A5935CA421EA },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x0BE1998F0D265, 0x404819314EB53, 0x49E2F70A57D35, 0x6EEDDB1DBD604, 0x7AEA423EDD54C, 0x106D98C90FAD2, 0x230846D40A426, 0x0F420B49B3DFB, 0x37600C9BAD998, 0x2DFADC0E75765, 0x57468E17E124D, 0x2E6D8C9E38A68 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x30193D9EB48F7, 0x5B4B93C3F7A0C, 0x7E882CDA55AE9, 0x4952BC94F1F96, 0x089B33476A2FA, 0x0FA9014D9DD0E, 0x5CAFFC91505AC, 0x7A331B83ECF9E, 0x66FCE403241C2, 0x404B3A1747C41, 0x64ACD807066B6, 0x1A7772F5C8144 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x183DEC51888FB, 0x5B3453446B0F4, 0x18974D9E09B21, 0x1015D0D921026, 0x746D31F177900, 0x62A4F46AC0C54, 0x0F714E28994B6, 0x7CA7654F15EA4, 0x07F2B91C7D7C1, 0x78FF82E153293, 0x17AAA5186A012, 0x21919F0E908F1 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x4AAF0DBABD2FF, 0x6D02F4D0494E3, 0x70CBF752CC503, 0x5AD3A33788034, 0x5C8F228BC58B0, 0x610842DF6A59A, 0x48682EFD81F80, 0x39ABCB96B186C, 0x41504451CB956, 0x037C7F5521BB8, 0x4C9F34F3905A6, 0x0DBFF01B6FDAB },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x2D19A9197F32D, 0x5D40E46BB69F4, 0x0B21C0D493D82, 0x64D2CEC139282, 0x64A167A71DA84, 0x04986A7E83D15, 0x7C61FEEC379F8, 0x3AF1B11F524BE, 0x7B54C7D1D4D70, 0x490A042F55F96, 0x7B127B7A80A07, 0x33305079AE3A5 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x71C10B3B3FCEE, 0x064FC6BB9C1F3, 0x4D03B217FE5BD, 0x759020B5E3671, 0x52565F6374863, 0x62B57CEF6D717, 0x19E139D27DF14, 0x19A442072DDB6, 0x7E268ED073781, 0x5B4151609CF2E, 0x591BC157A7F2C, 0x1B097FED01F65 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x77771213236CA, 0x2A9915BB1A3B9, 0x7D0DBB0B27332, 0x63337EC6BE904, 0x48780B86966D1, 0x3F7F374D52ED7, 0x2EE928022886D, 0x0093E2288FEE5, 0x108A1D04E165E, 0x0E6BFDFB3CB1B, 0x29D67A7A8E9DB, 0x307136D2B40BD },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x40FC499B95B66, 0x041A5ACAFA1CF, 0x637FA3F687491, 0x4D6224635D22B, 0x166DBC302DE6E, 0x6485FCD61F4E6, 0x50F8FCA39AABB, 0x77856AD47E903, 0x2A07C00762914, 0x7E08482CBBD21, 0x01AAE8F294954, 0x18E385700FED4 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x397A5D04FB28A, 0x2AE1DD37F1EC9, 0x174305857338B, 0x2C5592882F9E2, 0x06B793E8B8ADB, 0x0B455BBE5B52A, 0x792C75C69074D, 0x068A2DD573EA6, 0x55FE1CDC8F226, 0x5B7360D0B0B3F, 0x057FE0227F848, 0x2F23EC63345A0 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x3D9369787DCB1, 0x7B20CC93BEDEC, 0x436F6A952B7DB, 0x059A0D4FF1B36, 0x39CD1CEC6B758, 0x239AA03A53B31, 0x5C39FDC34709C, 0x4A4E691FBE918, 0x4E4A862748667, 0x00AD9BA9FDA2A, 0x3AFF153B5B14A, 0x0D1FDE628A2A8 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x5285762907C83, 0x2CD79219C8110, 0x1754540988FA5, 0x24F7EC205D98F, 0x3D8DA8AB377DE, 0x1555AEF6F8A71, 0x0D367565D471A, 0x2530A262A1ADA, 0x50013E65EBEF2, 0x0BEBDFC38B057, 0x7675121C32560, 0x1CBED74820C71 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x62F32BF9023A2, 0x17BD4A28FA1DE, 0x39D1D9DB8AC98, 0x0B1B4A51783C2, 0x170062A906C2A, 0x3D7D5777A945B, 0x4A2032CA1260A, 0x2C51A80DD8031, 0x191BEFB8B8F45, 0x367D8DBC4BD58, 0x4855D542F0C2A, 0x0B766B9A1C103 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x4CC47653F9FBA, 0x213AC44C537C8, 0x299A5D39AA5C7, 0x4505EC2F0D327, 0x43809E928F422, 0x5BF322CDD57F0, 0x5AE42E0E308DA, 0x28DA11C5CEA42, 0x0F1C2D8CB6320, 0x53C047702E5F4, 0x6EA9CA7CA6B54, 0x2D91317B5442B },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x2CCE843DA2D10, 0x66E3395FC5D0C, 0x0DC36B42CFB47, 0x2BE73614D776F, 0x61EAB573FF25B, 0x7C3A66779B051, 0x32D629DD5D8F6, 0x6AA9E56948CB1, 0x7F7EA6E05CDF5, 0x0AEE10BAA7A10, 0x127A3DB8128C4, 0x18295DC46F305 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x63ED49388D63E, 0x15A05BBA2D15F, 0x63605E00BEDF1, 0x63902D046613E, 0x37245D07B6F4B, 0x191FF4743670E, 0x33D8F8C39F122, 0x495B92B5500EA, 0x68997BEDC999F, 0x79EF9B56EF550, 0x451F4D6FE59B3, 0x1A15902433608 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x12EE73327FFBF, 0x4A85B3F1A28AA, 0x7C81A276BB6AF, 0x58C700FBCCB33, 0x3159FD4EB5762, 0x1EF9AACCC9C89, 0x7CE151BECF878, 0x59A615E375938, 0x471E73F62DC44, 0x3F5A782E32C45, 0x638F6862A16B8, 0x17734418141E0 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x670DFDBEE36D1, 0x53D20EB7F3C3B, 0x4A26D15CD06A7, 0x136FDBCAFE2D2, 0x3BE2233CBFC83, 0x46B634BF4F8A2, 0x58D6EF70EA79A, 0x3B6D593C75326, 0x15ECF89F412F9, 0x18F60D8044E13, 0x56BC805644EA1, 0x2D08D7F3DD15A },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x3F2B1E66CA26E, 0x4CBF810EBF4FF, 0x3731CD7113A0C, 0x176D67C5D1B2F, 0x344D7846DBB09, 0x4EF930E542E33, 0x111D9E276C82A, 0x0500B89AA69CB, 0x78FF48B9820C4, 0x244FC70AD9CD2, 0x1DAA4E9FB4CDE, 0x11E4E7EE92D17 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x121BB18F7A6E6, 0x4DD2BB6639512, 0x5278A5FCCDEF0, 0x263F7885E9839, 0x3CAECEC4AA145, 0x77DCF0205E6B1, 0x059DF56FDCEBA, 0x2D88D414D81ED, 0x0B3D8087090E6, 0x605BDC44A672E, 0x6B0A052994D90, 0x33A0AFE59C8BE },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x24E2072F493CE, 0x25FDCF6B3DADB, 0x0EAE6AA08C097, 0x6759341D9205B, 0x4BF7DC87FD88A, 0x6D740635A3530, 0x30AB6E310BD73, 0x04F3078F53BA1, 0x0D3950FB0C8CD, 0x4793C0CB1351E, 0x7F445459B9E05, 0x0DF6F53F17E9C },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x1CB3B653D9FF6, 0x5810F69407324, 0x5E46A29F2EA63, 0x63446BB50E311, 0x71ED7E79A9339, 0x00502E5ECE4B7, 0x3C08E021FECB8, 0x6574E434DF67A, 0x5641258512F24, 0x6C1C70D2C3272, 0x1259C622BC500, 0x2E21FA8393371 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x3AFD0AA0FD5A6, 0x3CE73270FA8A7, 0x6C03FF4D8F526, 0x099B2BA821981, 0x277802CDAB6A2, 0x6385A73859C7D, 0x467695B9424CA, 0x4F5E788FA6820, 0x616C25B765008, 0x22A49C5F2C421, 0x692C555712162, 0x11BE41BAA8448 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x1BD8D63BEADBC, 0x6097F7C747D10, 0x15ED9480A6480, 0x7E20E3C6A98DA, 0x4BEF99A1345AD, 0x5D561AD8B2151, 0x0A73585459BBF, 0x2E89201FC4E43, 0x0D962184C30CC, 0x0488D7B0D923C, 0x2E905E1CD8C45, 0x336EB95BF9D0D },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x6A5EFF5EA63EF, 0x3EBFE14317DD3, 0x75D92E76C98DC, 0x147C187AC7695, 0x25AC607F37ECC, 0x30DC36F779BAE, 0x571B35EC79168, 0x4E8A87866647F, 0x78ED6DF14829B, 0x3D5095E365050, 0x50919B2CD09EB, 0x14A8E62E2BF2E },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x351F39AF04441, 0x1770FEA28342A, 0x2CC2D9C16C259, 0x441C735D20191, 0x7320C0DB67C42, 0x35A15B352C1D2, 0x3FD534A081C93, 0x58B4DF37659CC, 0x1667E632788CB, 0x7A8F915A855D1, 0x10DA33EDE78AE, 0x2DBCF8AB4171A },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x637684DD4F624, 0x5C75FF965192B, 0x052923AC66561, 0x29F667F9A5E8E, 0x56A4C3878AD83, 0x19DDFFA39AEDD, 0x01723167451C1, 0x075D3909942CD, 0x4372466B53FFB, 0x657F93587D967, 0x03F500634FB3D, 0x0F868AC613F5B },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x12A68D02681B6, 0x2ECA826FDF910, 0x78567743B8294, 0x00391B646CBEC, 0x5DF73978F7866, 0x0C7B1831A67E2, 0x645D77F18563F, 0x7C4CA7DF9E223, 0x19A88F5D47DA8, 0x62D44CDB74AC6, 0x658DFC91D415D, 0x33A105BEE09E0 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x6BD080FB47FC2, 0x46C1476AEECAF, 0x6C13A4486990F, 0x4A2C319A0904C, 0x7CD5E28D76953, 0x5413522B4889F, 0x34A7483E39B41, 0x45AD1A5D00ECB, 0x495B06E0E35F9, 0x493A36B689A60, 0x3A86B6911C823, 0x12CCB285D114A },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x78BFB6C65DE72, 0x2E919CD633C87, 0x402A6904F6A7D, 0x5C792E5D74B1F, 0x57101B655D614, 0x3429D493364C1, 0x667BF7EA891DC, 0x616998DE781C9, 0x005574EAFD9EE, 0x6446379D9A031, 0x72E965715BB36, 0x1FEA565A60BA2 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x180D679A78A59, 0x4A253107EB36E, 0x5D6F6A1947E2A, 0x1349ED2F050AF, 0x5C24975BCD602, 0x300676F20EBC0, 0x607CF209934B2, 0x296E775243262, 0x53F27D9218F96, 0x161099E0E2B85, 0x78142098E3F6F, 0x0FC0698B8B009 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x25C1E973D2C57, 0x0A55BE2CECBA3, 0x0736A7D0B6303, 0x4EA0FD34BCC0A, 0x37A30AFDE3EF5, 0x7D4894EC540D4, 0x5BD25EF190339, 0x1ED354FBD66CC, 0x7C2F42F3A2DBF, 0x6442AD05D9D71, 0x09D6CDE391061, 0x1EB1D40CD1EDE },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x150587CC7C7AA, 0x606017EBB28C0, 0x52E872B855166, 0x5C7CD4718C16F, 0x2C3F9685625DE, 0x0FFFE4C5B8A4D, 0x796285DA9D337, 0x2A32744B59F94, 0x3E5150EB74886, 0x4E70132394F75, 0x3C970CBA8BF94, 0x14CA4CF793269 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x1B0FBF6A52F90, 0x1F0BCE6CE3F62, 0x0F88455E553C5, 0x666E9D50BEB19, 0x33C4E96315EF9, 0x6C605F87FA4A4, 0x19236A05FA2AD, 0x02F192A28E6E7, 0x79046041137D5, 0x2FEC7740A2AB9, 0x63C5B30E6B2F5, 0x2546AD3F6B53B },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x11D94E3EB9C06, 0x74A2D40332205, 0x335FDB03D6DB5, 0x4EF6AF81B7416, 0x526227F7C36BE, 0x023B62EDCA8DE, 0x13DB18598BAA7, 0x4592E50CD263F, 0x4225DB1B3E9A7, 0x331EECEC89FE0, 0x79FC2E6CBF9BF, 0x1580C5E948F9B },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x3DF92D9C01260, 0x5C86116A8814F, 0x73DA4CDB9EAFC, 0x7B9B1BA9088C2, 0x42B72565A26D5, 0x10F2FD79502BC, 0x5E1F830280B63, 0x1019708BE0BB3, 0x41E3104282CD1, 0x3FDD4B53DAA1A, 0x31AD3B5CC7876, 0x2E81B54F8B97F },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x651AA866C6764, 0x41B85625E3C38, 0x4C11691453618, 0x186635AF43C7A, 0x01965B4B06B2C, 0x25D0CA497D797, 0x5E29C1D19AA7A, 0x0F1A50D80F38B, 0x4CB7338239519, 0x699B766B79409, 0x564979B817362, 0x2383D85E7E684 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x45A6346F5A064, 0x1E9D605015B01, 0x1D7C7BAC8A54A, 0x7B4D5BA7D7806, 0x30E75FAD78600, 0x5E136C5F7F72D, 0x306B71B0D26D8, 0x0BEFEC4CEA8DC, 0x0C36CD84023EC, 0x611F97662085A, 0x33134C0CC7393, 0x2A0ED34C6D9C5 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x2969D92728084, 0x27427B24E77C2, 0x2E6B0AE096473, 0x6EE23775717EB, 0x4C4D37E3ED23F, 0x57B91F33CAF17, 0x7569B5558EB77, 0x0372E56757D23, 0x1B3157406A702, 0x47152064FA495, 0x44C3DE0B46C45, 0x0CA55E75DF5D8 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x39AC25BF102A4, 0x4B53BD6A21823, 0x026C26B8F8DAE, 0x337343D3B48E4, 0x590A39870DF9A, 0x53DB3FB9552B1, 0x6CC0EEE84C313, 0x615C3C87CAEEE, 0x783EAAFE5D0E7, 0x0CD26318F9247, 0x7E63D52D691F0, 0x2277F70E8975C },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x451B574D4D526, 0x056281B56B8F7, 0x425EF3F46446E, 0x66E43B5CC0472, 0x3C44A3B553600, 0x21E2543B69601, 0x1EE828E9615DF, 0x41E4E99430760, 0x777E26592F0F4, 0x1BF6FBC128A68, 0x36D2A72A61757, 0x140371DD96C88 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x51B4D6D15A924, 0x382DD94222BF7, 0x4FB19379D2637, 0x3FB796D3EDD1C, 0x21CB68DDF6DA2, 0x212521F8E4329, 0x27789B4FA729A, 0x7FF51E5DC6DAF, 0x2E25B3ABBF604, 0x1F2307E57C2DB, 0x38DA003117D22, 0x1F7C6C27BE5A6 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x70E16B8FD6346, 0x502A1DD2DD0F1, 0x06EA6F12E2DAD, 0x24403FC1E4DD9, 0x48791CE379789, 0x3E45B23CEF666, 0x574CEC01D17B0, 0x6C0866AB3CF9B, 0x0B9DB216E416C, 0x7457710A13540, 0x07ADF9272055A, 0x20A894DCB6458 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x2779C90999444, 0x6224600830539, 0x166067FF2F436, 0x7ABD219800171, 0x044900E4EC593, 0x4FA4795192E5C, 0x7D921C0864E1E, 0x6C00319AEA8A2, 0x305EC19BDC477, 0x51C64BA7CA546, 0x2E6D0506F5B3F, 0x2868E16C1EA7F },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x5C09160642CC6, 0x104DBBB3A4765, 0x5F206979662F9, 0x6987FCD7B4C6D, 0x628D7DF441D06, 0x4E05C5D7F3743, 0x03EB84C40F487, 0x32CDC010D5674, 0x3E4C264B6556B, 0x6B5DB254E7074, 0x6E10497FF6DFD, 0x0A40E8D3E18BD },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x15E4E5A1ADEA0, 0x08A990B6BE13E, 0x4A7BCC34D48F6, 0x64BF43FC39C41, 0x04940EAD76373, 0x2A340B8D17230, 0x30604D8109692, 0x6CCDA233360D6, 0x19AC437282DE4, 0x10852E9F2E622, 0x14EE1CDC94698, 0x21B79CD898A64 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x6B52CF45F5D48, 0x719FEC22C5D41, 0x49F9F19412234, 0x2E9A016C9AB88, 0x0BD19C90E3A33, 0x30162AC088060, 0x59624CFD5D58B, 0x0D28FD1FC1D11, 0x6072D289FF49E, 0x6FB5955BDD629, 0x6F4A1E4428785, 0x15376A7D974FD },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x1AB5BD68D1732, 0x400069F87F517, 0x203FE19489DED, 0x71584157F61BC, 0x47BC4FA5DE227, 0x0F66205721C4C, 0x1CC7D9BB2D3F0, 0x05E1DC9F74857, 0x1AB43BF7E81C2, 0x476A1F4767D59, 0x4BAD38D7F516E, 0x2D9066DF947A7 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x40127CFB3A12F, 0x7FC2D11BFB906, 0x235E0ECED3155, 0x6C94309B5A89E, 0x430B1F2A26248, 0x3079DF47257AF, 0x42F75C1A4822C, 0x1D53D32BAB3BE, 0x0FD3CD78F9D95, 0x63A6DB401E4D3, 0x66165C8742114, 0x16F886DB3A5E3 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x6837821B660EB, 0x071BDDD744D2E, 0x3ECACB67EB986, 0x52D5217EC7E3A, 0x5AEACD6DCEC1A, 0x1FA5F93F84B15, 0x1614AC1D2A72E, 0x4A520C8AC2C9C, 0x0228DAB4F4B4F, 0x50D5C0FF1BA13, 0x34C942B07001E, 0x22C53C489C29F },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x44E054A32195C, 0x1108F7C4C3DB9, 0x7E393DCEB295B, 0x32E207C8CFCBE, 0x21EB295567A56, 0x448DB4C7B34D6, 0x06AE43022455C, 0x174FD37DC6B14, 0x1BEDFE5FB3FE0, 0x6CA3B6459A4CF, 0x15CC6553DC816, 0x0F091907CBABD },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x214503F935858, 0x2B72DB31B40FA, 0x37C8C513B6E0B, 0x3C886083CD01C, 0x178EE12F191F3, 0x61FEA1258E849, 0x131E98CE5EAFD, 0x7DEC5E23CEA2B, 0x710C8D86A8783, 0x2B5F9DA748BF3, 0x00E8FDF6F2ABD, 0x33AAFE270C8B2 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x16AC653CCC7FE, 0x07F569D537835, 0x75DFA8616EA85, 0x1C2C6BA1E13A6, 0x0AD0ABCE4FE78, 0x24FFD3E2055C1, 0x3C8BD6F4E8930, 0x4C2497571E892, 0x78B69CCBB5C04, 0x46BCBE6F3D390, 0x3CF25B2AE9CD5, 0x1C6F2BBB662B8 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x58957BFB04AF8, 0x078AA58E7CD28, 0x6861075F770BB, 0x0CBE67A1EACB1, 0x423D1438CADBD, 0x74E7544D72B7A, 0x0B33AACFC3EDD, 0x156CFAE84A174, 0x5CE97DEFB2020, 0x108EB05D12694, 0x08DC06AEAE071, 0x2EBF35AF432C8 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x0490E66803AB1, 0x2B848C31A12B2, 0x44A51E1FE1485, 0x67512FA6BACCB, 0x454369B90E063, 0x6AB7F887FB902, 0x5AAA786E30CA9, 0x3D6A2086E2916, 0x2D3225F889F7A, 0x011508BA31597, 0x1C27A0146B551, 0x1020BEA163FF6 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x7FB3AD5C15657, 0x7666B4F5A58E8, 0x41502D74E23D5, 0x4FE734894E946, 0x3A3B67233AA37, 0x1E3BDBD491503, 0x2C75483ED16FE, 0x4655DE30B0F23, 0x485A6648DDEA5, 0x4C6DE7E43A69E, 0x091A1FF10CD9E, 0x3792CAA69653E },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x1FBCF085817EF, 0x32AE99A569201, 0x4147CB40B8F55, 0x46737731CA7ED, 0x2EE88870F204F, 0x419DDF9F1C88F, 0x6052E6B50A78C, 0x5A0F1E01D1381, 0x2AA7E199EDC45, 0x3F1C0C7DCF46F, 0x7177661BA5F13, 0x13ABC9040CF62 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x7C53F74F37E1F, 0x365FDC665AA75, 0x24A3CE10AF91B, 0x6D270F98290C2, 0x63890BED6B50C, 0x70AD0D187C4F1, 0x2F4742314D531, 0x71147C46CFB20, 0x3F81775E021D2, 0x52459EC203BA8, 0x25D3BE22C4DAB, 0x33EB1D2768647 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x2344454086A47, 0x7C63DFD3F6030, 0x764B8731B6550, 0x74C0BFC809ACF, 0x50E15D357F844, 0x780EE83FE11D1, 0x57305D27DC839, 0x75E908144D633, 0x1377A8E82AC49, 0x2EC752A61B592, 0x2B68898AB7494, 0x1D8D0031E36A4 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x7DA8159A014D7, 0x072CFBD5CA650, 0x627ADFE34C128, 0x68BBF375525B9, 0x67FD20C3ECB1A, 0x27B2FF8AFBE49, 0x31A8BD75B92F0, 0x6C88860AA04AB, 0x779E2B423B043, 0x203C504359833, 0x277937F0BCF98, 0x25B5815564288 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x29D3B8640ECAD, 0x6F188FEA0FD5A, 0x205B48873DFA8, 0x26D37A3869528, 0x71259F4A7C1D9, 0x166BAB47A3BE6, 0x6EF48513387D9, 0x63378F343DD0C, 0x6948786D8E2BD, 0x71BE57E2FE1C6, 0x2B4D8698E5E6C, 0x127DE55BCBB6F },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x4C151BA6CD0E7, 0x2740FB9808504, 0x594264F63F0FA, 0x6D2295BE099FA, 0x41622C7F4182D, 0x438878145D140, 0x0139D715E8890, 0x1724C0EB3B4FC, 0x40DE4F0C27C9F, 0x710AD8F026BA3, 0x1E5A11B4FA167, 0x2A66285A2648F },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x689BD5CABA1FA, 0x491DE9532AA93, 0x6AA3563870110, 0x53BFAEBD53379, 0x27EADF050FE8C, 0x434AF1AA8A791, 0x43DF96E061B25, 0x1E555860B472A, 0x09C62C97D9EC5, 0x3C8D675FC4292, 0x4743F74FF1E8A, 0x1B7AD960A37DB },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x5B9E43EB814A4, 0x20BA5EBEC29B6, 0x2BF8DF9FF00E8, 0x24BABC4B6BC45, 0x044549E7AE894, 0x2AD009B8988F2, 0x178BAE7CE30EE, 0x694A8582CFDDB, 0x38D7B85A4C2C3, 0x3BBE73EB5BC82, 0x71E126779F0D2, 0x245C5C171D880 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x3EDF179355E11, 0x1C15F9C5F5EF5, 0x291CC514D16CD, 0x6F33F749E3A5C, 0x4ACD58B0DC7AF, 0x143EA1E88056A, 0x010B4AF7CB60D, 0x70729A36B5856, 0x1E95B7A238CC3, 0x7E1FAB2F8C4ED, 0x77AE40D1AF1CB, 0x17E4AEF477CB9 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x24E758FB42CE9, 0x727D468E947B4, 0x0B6C177B18D83, 0x633B1DC82F705, 0x5C424D534F80B, 0x4FD8E9DDDE71B, 0x3CB126426C2B5, 0x24CC8649821F2, 0x224FAF1A826ED, 0x65B7DA71F3388, 0x4F809662E669F, 0x3C610740A895F },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x23A1FA6EDE097, 0x090224AB8727C, 0x0C668BFB68082, 0x0C2D6D7C94AED, 0x77EC763795764, 0x79E6BC3BDAE1D, 0x2664851379859, 0x40A72E8C87DC2, 0x46FFE83E50DA1, 0x5597BD81EF003, 0x6850F4C4E8C2D, 0x163D3C571A276 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x67647421737BD, 0x47584C68C6C26, 0x12660010D71C1, 0x203A97BAA25FC, 0x7664A3C46AD37, 0x2E6E0A47793AD, 0x00F313D48BE54, 0x38ED0E08DCC52, 0x4B1C2C804DE1F, 0x063504705B38F, 0x236BEC1014833, 0x21365609AF90A },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x1F90FC46BD826, 0x6FCB2B0C024DF, 0x6308E25611633, 0x2224952B8CFC7, 0x2FEB669D89713, 0x334EFA5F3E664, 0x1EBD33B9279B8, 0x08781864B2278, 0x3CC6714C07581, 0x18057B587A58A, 0x381EC988A5CA2, 0x0C74AF04E98D4 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x08E15D89341A6, 0x413F445D492ED, 0x151B5E8BAA507, 0x0F1F39216FA8F, 0x2754A369762A7, 0x4073BFB8E45A4, 0x602D0152C773F, 0x475143368D9A6, 0x14E38BB3DF6B7, 0x6E690DDBF40AE, 0x596A7F69AEE86, 0x23BEAA27BF241 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x454BE84310EAB, 0x2E1A23EAEA32B, 0x029E4AE7B0FB4, 0x1FC5C2A825544, 0x783E48FA3FC55, 0x6F2B8D756ABB3, 0x663F398B924DB, 0x31F3939FDB619, 0x5F45A050FA094, 0x3D1033E1D3ABC, 0x57765F31858CF, 0x15A4AB69C2470 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x12A31E180A2A3, 0x5C4EAB0572A1A, 0x1B18AF4E398F7, 0x7703FECB8763E, 0x6DADD2FE2978F, 0x4CE397112535D, 0x0FCF102D613A4, 0x43C0D6BDFDCEC, 0x5FC4067569F2B, 0x656FA4AECEC0A, 0x7AC891A24EEC6, 0x1FC481773121F },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x378913DF83589, 0x6AAFB68EE8C24, 0x738A5F7A36EC4, 0x2565B0249B782, 0x60C1D84FBE736, 0x4F4DEE89416B4, 0x0F247C43B478E, 0x2F00D9C0F13C3, 0x0BCE7C94864B6, 0x5D475C850027F, 0x7D84EF944AAAF, 0x25FF371A46A49 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x59E804636B6B1, 0x3E50CB93C050E, 0x0A573C3ECDC24, 0x5CCBD722F7D74, 0x0FA96C7222E86, 0x4F83D022329C5, 0x6CFAD41CF0F49, 0x40F59F38E74CC, 0x732DE8D7B3DB1, 0x5C5150FAB0AE9, 0x3E7ADAD441748, 0x2B9D7A3BF32AE },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x08B7FD08A43BE, 0x060987AD7E1D2, 0x25AC7EC2B4631, 0x76FFBBAAE40F1, 0x1DA49931367DE, 0x05C8D4689856A, 0x3D78B0C855623, 0x5EBC13B7829E7, 0x05BB41A519884, 0x618135DD46F0D, 0x224C9CBB1FCA9, 0x14429BA81D7AF },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x366E7C2C9D8A6, 0x64D92C2C5ACBC, 0x11CC392570661, 0x22C9EBFDA0F2C, 0x105B0E7FF6C13, 0x475B32EB94331, 0x4365C7D4FE29D, 0x26306F398A1B4, 0x2A456BF1EBB61, 0x35D569E307C2F, 0x287FA8BE8CBF2, 0x1F793D0F108C7 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x13B419D456B8F, 0x38849736AE45C, 0x3A74148F0A42B, 0x0F3782EBECE3F, 0x049EF33015DEE, 0x07A48531C0C32, 0x77126970617BC, 0x47A16A4BF3429, 0x1A981C08572CE, 0x5776E8FF640BF, 0x71A623C4152FC, 0x17082D0720533 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x4DD92B72408B9, 0x1B6602D102D83, 0x30E8058E05CDA, 0x0E8688A0E5E71, 0x733157AE9EFCB, 0x03C0B24E8E02E, 0x7F0873081F4E6, 0x24437EFBD7169, 0x13FE8BF86A36C, 0x3416E4F6E66FB, 0x50E4C29531552, 0x1A498CAC5C8BB },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x7FB7A66005D7B, 0x26E1E697AEFC7, 0x41A5B1ACC57EA, 0x22157B4C55487, 0x0A5DE24C2E226, 0x30CD6FF3875EA, 0x01484EEC4807F, 0x15004F8FB40DA, 0x219C5F4B17B3F, 0x101E614BCF02C, 0x09895B40C7D31, 0x1C164F2A6652E },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x6162D066036A1, 0x311BAC00913EF, 0x518EFB745FBC9, 0x23CAADB432FC0, 0x0FE9148D5102E, 0x19D0B0FB06789, 0x29B3D3A47B439, 0x2266F22EB2B87, 0x5B25A0C16CE78, 0x3B9C26409E4F5, 0x2B2FB66D31E4D, 0x2D488A3CCEBBC },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x6B104F744287A, 0x7FCE277F349D9, 0x36A289E75E82C, 0x7395993ACD1A0, 0x4C39478CCF62D, 0x40AF50675137D, 0x73457F702E12C, 0x65A628979DEF4, 0x34152FB4A1CBA, 0x026E4220CB64F, 0x69D1C27DC6DE2, 0x0881456B4DD42 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x74518AAF27162, 0x0732500B3B020, 0x53AA868BC4805, 0x2023D71004D98, 0x06B10E53680D0, 0x3F62829278F32, 0x08897B2E5D12A, 0x2F784DCC69A1C, 0x22E173B7FB954, 0x2920DBB4DC787, 0x1C38FE6E5C908, 0x26DD29372FC5F },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x79994EC9A98F3, 0x494580E874C4F, 0x79FABEF40033C, 0x25790906BB006, 0x6BC1D8E7E83E2, 0x4333E6C760479, 0x11F2C085A1564, 0x194F28DAF594D, 0x1943648DFE62B, 0x0DAF40D5D4468, 0x32E3C5DFA7831, 0x198C7BC49711A },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x5EC2C917FB64F, 0x1973A1BEBA9B6, 0x13AB6CDA59CC1, 0x259F69EB5D2F3, 0x56DF2E97B1F2F, 0x4A415F5AE6EB0, 0x6F2A0A0B7DF7D, 0x7084AB949C000, 0x0AAD1136CF06D, 0x06F1E53A3D391, 0x4FA0CF2DD16A4, 0x34B648925130E },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x0609F934242F1, 0x7A785606E0DEC, 0x093D51EFFB94C, 0x5CC74B3D5309C, 0x709F322E7EA59, 0x7B0C5E806EC42, 0x74AE8E87C9ADC, 0x18FD0577A36CE, 0x47E7AB7C26DBD, 0x5ECCBE9BD05FE, 0x1B318D4306076, 0x1BD33AB18CE35 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x1F14C9C77DDC7, 0x0EDC4B1EDD17C, 0x10CB92C1E030F, 0x6ED4900FC035F, 0x772DA5DD5FA11, 0x164EFFF4969FD, 0x7ACA71DA45A11, 0x01A621EFBE555, 0x51A4877E8055E, 0x5F335B49AAB46, 0x67ABFD5B4F6E0, 0x32875E76B69ED },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x3F62DE8782D2B, 0x0219C065BDEF1, 0x2B325FA090878, 0x4F9E75F43AE11, 0x3CF735ADBC60D, 0x2BFF5526C3CB9, 0x4CB311ADA305B, 0x6BC3CEF2EB335, 0x73237F4A03F79, 0x3ACEDA43717DD, 0x21F67B2A4B0E2, 0x1A004B15A063A },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x519BFB9B287FD, 0x297F2773F3CCB, 0x01E742BCED810, 0x1C1B56F4E9621, 0x4AC38F17A2799, 0x2AFCCF6F22210, 0x6C4D17D00D91E, 0x6744F8524E077, 0x611F14D0F2186, 0x386A620D088B1, 0x25760C3D59267, 0x2E016E71CB190 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x379BBE150AE4B, 0x16D6E18750D0A, 0x7E8B839D1E229, 0x5721021F4FF9B, 0x74F6EAEAC8B0D, 0x6B37846145A23, 0x02E2E6330FF28, 0x5F0D853C14A5A, 0x7A7092AED4522, 0x76650DA01F9B4, 0x736B7646B8C67, 0x1D74194709DD0 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x03659E072072D, 0x6AC0998F0FB04, 0x4962C838506F8, 0x18ADB93552264, 0x3E00F835CF449, 0x53286B5F6F6DE, 0x7706059D0D9D8, 0x7A258B8480A86, 0x4346E39F1D2B8, 0x2179E110B3020, 0x4FEFC7F964358, 0x2D64529E61A63 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x2F405D7194C3E, 0x684A7DED6B911, 0x6E8B41AD137F3, 0x5356CCE3E1834, 0x75B614BD441B2, 0x27B6FB344D42F, 0x59721475A54FA, 0x5F040A112A974, 0x27E218D36C03B, 0x63F5CD1DA2B65, 0x3094E76681C10, 0x16804C2D2D0C2 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x358787A5291C6, 0x0B2AB459F5D52, 0x336D70380AB02, 0x5049693AD8BF8, 0x24B17B2008D54, 0x68AE03120490C, 0x5B1A5F1A36B47, 0x09FD8F10AB1D4, 0x075D87CD080EF, 0x63544D12A31A9, 0x49895BC2D1816, 0x352106BEBD7D6 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x7157329665846, 0x60C5428B31CAD, 0x4531483458B80, 0x085554197FB6E, 0x61ECF83842C72, 0x2827CA74CD202, 0x2A15177510900, 0x338648AFB6CD8, 0x4E4955DBEE72A, 0x1FF45CC876E7B, 0x1C221C023F2DD, 0x12DDA1F08E6A3 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x1C21E4C3AB5B6, 0x1B7F9AB3B0899, 0x3895F9F37FF52, 0x705CC205FB6B8, 0x702282818BCD6, 0x53EE279937AF5, 0x6FA55AB50D1D0, 0x01F9980079558, 0x4D5435B353897, 0x45112EB9CAFE2, 0x765ECAA431EC5, 0x38FFCF3086E35 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x63944AD2A4368, 0x7D51D5B445B0B, 0x7CA2EE5A4F5D8, 0x5969D8E9D4F15, 0x385EAD5081D2F, 0x641732F396B01, 0x678300E7EDB62, 0x696187E35E06A, 0x56261CEA758B3, 0x352A1CCB06357, 0x66BE0D425926E, 0x07EA04461CF64 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x3BB760DD1580C, 0x545399AB62239, 0x2652FFBF112ED, 0x0134F41118DAA, 0x0210EB7A03EFC, 0x4C325D5DA0EFE, 0x13368F7BF1C88, 0x120C74CE36EC7, 0x6AEC95A771FBF, 0x0A4F82CD0F23E, 0x7F1DE98D284E0, 0x2B62DD93A19D8 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x18A38C2DC5746, 0x75CCCE6979FEB, 0x4F85C87ACA836, 0x6020571610C75, 0x5F139476625E5, 0x71CC673D92D17, 0x31FD06610733A, 0x2243553B70DC7, 0x47C61F3EC264A, 0x2B00526B01B24, 0x02EE0EAA82A47, 0x0EF973F1CFB86 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x05B8D34466F16, 0x62A589DC37A3D, 0x059121E861A46, 0x55E655D531374, 0x58C2D228BE572, 0x61F46D03E4C44, 0x23B36C7313849, 0x4838E4C1A753D, 0x4EAB600F1F48F, 0x3C12F0DF3B74A, 0x3C2246184C896, 0x1C9A7F0DA4B13 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x4EC3705A28316, 0x722FEB3F7C174, 0x674950BB8AAAE, 0x0D4742B8807E0, 0x15DE6B7948581, 0x67BEE5C07716A, 0x43A7D0B752BC9, 0x7726DBE6C7AAB, 0x2BBEDD313B126, 0x2D1965D0E439F, 0x017E19454A940, 0x1C51AD7606054 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x14DE6846152A6, 0x4BB5D43F3898B, 0x1BA06B7EEE1FB, 0x575C3C9D70ED5, 0x482F9A0BA9F2D, 0x171281F947A2E, 0x6E2D4BD634ABC, 0x3730047BA4FB5, 0x0AF3AC3C9AC25, 0x2FD817229C3D3, 0x2250A68BB65D7, 0x2135410ED77F3 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x5F3B6C7C79EFF, 0x4780665F96379, 0x4F6BB903CA8E6, 0x04655BAE8BDDB, 0x4B447A963AC66, 0x6832F719EB687, 0x4133E9222F753, 0x2EA0866CBB55E, 0x519189714D207, 0x5D061EC3D22F4, 0x4AA32AF50F816, 0x1B9E6EED48190 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x656D8B4DD0C95, 0x368888D87A0B1, 0x22ED3C9549C65, 0x021800CF8AA7E, 0x321F1ABE60359, 0x63812D7572332, 0x6DC92A1D22B00, 0x40E0A5EE7E2DB, 0x010A96254F92E, 0x251C2E3FF11AF, 0x3C8B26B2C364F, 0x2CCE7390D087A },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x42999A8A08841, 0x5F3FB46090618, 0x1C9F331DDADBC, 0x7DD6100C1BA1B, 0x30C4A877CBD92, 0x30FBC836AB0F9, 0x384B26C14A194, 0x756D843FF8DC7, 0x275A79012FAA0, 0x1BB56AE4A1B1A, 0x349589D6B9EC3, 0x11D4BDFBD47E3 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x6B3BE85DA4075, 0x68B679F38F358, 0x34B005F1B5345, 0x6A299EEA7A63A, 0x0D58AD75B5C11, 0x4878851455B08, 0x38C57E62C65FD, 0x61B5F839C8293, 0x31742A7B66968, 0x703082DC8F3A5, 0x3E8E897F0C23C, 0x2801C385253E0 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x250C56C7DF298, 0x1D429616693FE, 0x7491527894F02, 0x01966474F8899, 0x7F852E790742C, 0x2427081AF2A54, 0x5C4DB3C716B2D, 0x3D2B9D366773C, 0x75ECF6CA42A5C, 0x47B5D2C81E46B, 0x6F456A9BA2F2C, 0x12CF018BA95B5 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x72121A28A2908, 0x29708D440D60C, 0x6B6DF89165900, 0x1BE0CA11D9B75, 0x03CCCE5C38FC3, 0x6B3D4F3A43591, 0x58DCC167F5975, 0x0BA246FA5CEB3, 0x6B4B0E42355DE, 0x5DFD1F1E485A5, 0x3E670C17D0521, 0x1CE81384A372F },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x74A71F54C36A4, 0x1D3C97EBAEB35, 0x037E2AE9CE781, 0x179950094664B, 0x1A880C7022A37, 0x2A313CE520585, 0x0B26D44C9E577, 0x5E7C11CC6FD00, 0x5212D87C61133, 0x2EED02489D54D, 0x1BC8BA895759B, 0x0DEAFB8BCDB49 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x7C2439AE2CA7C, 0x1999D4531AAF5, 0x404F5D0742E46, 0x6A34751EBA3B1, 0x6C9CD5F8324D3, 0x17C43798734E3, 0x2614430B32901, 0x311B95CB89004, 0x475ABE2954737, 0x27AA9A7600D59, 0x0F2D1045FB2AD, 0x292C86000BC53 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x7F238C7EF2BE0, 0x32E1500F09EE2, 0x4A9F730401163, 0x3DB3059F431AD, 0x0A2928162BD8D, 0x5168518420409, 0x1A35F70453C32, 0x0B5318CA3669F, 0x204B7DE2A25F8, 0x18A2B7E0CD829, 0x4E102BC4BF56E, 0x161FF216008F4 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x51A55C5DACF42, 0x68057CA4FEDCF, 0x570CAA9E16A8D, 0x65CC2AD9FE439, 0x59485D4F4257C, 0x0AFA5AAB849A6, 0x5325BBA61625F, 0x62EC48EA2670A, 0x1062DD59E90E1, 0x63EDDACC89028, 0x03C94476FFC07, 0x38FFEF28E7BEC },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x414AD8C85802E, 0x659D300DA70C1, 0x399D1CBD5B98C, 0x5A54AED4EF9E7, 0x0FFD115D3F0DA, 0x36D2B775ADD67, 0x2C1E5A0DF6B66, 0x7EA3CDB6836FF, 0x2A3BAC4AD5C48, 0x4D6547F1E8E6D, 0x274815EF75602, 0x19F574A41F5B5 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x6C90B4251D33E, 0x2B1BD81578A93, 0x0B38DC1AEE61F, 0x76BABD7FBEF83, 0x7F28937A6A4C2, 0x2CA439D7D6B54, 0x41A414FD62AB5, 0x022D166F1A567, 0x186B660E30605, 0x1125D0E3E55A7, 0x1CB14E4AE939E, 0x273B971436CAF },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x549ED72B0905A, 0x2357D16B5F930, 0x271CE5BD36A7C, 0x09E666D1BF4DA, 0x2C3A42B3EECAA, 0x023D936015CCA, 0x150002FD6E06F, 0x77063DB19BDE1, 0x3001AEF35FA61, 0x5570878BD731F, 0x3D5EF7B7CAED6, 0x0ACCEA432CD25 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x4502E13143DB2, 0x632FDDB78A68B, 0x09BEFCA2766A5, 0x504DF5D2CDA88, 0x4F6FD021DEABE, 0x3FBAD3500491D, 0x30F58A7EF17FD, 0x7EB27402E4CE6, 0x02B2412411078, 0x37B2403FFB7AC, 0x29AF1B2C0CB3F, 0x2336CD8AEE840 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x0290EA0316DF9, 0x39D67796BAE48, 0x6AD5E298AD567, 0x52348C0737837, 0x11F2EF09B7A0C, 0x0C1D724377296, 0x52EAF4A031D26, 0x0C32DEB1CB3C7, 0x0AB16215593EC, 0x658DB27E8255F, 0x0117435A4BF9C, 0x0A7720A82866A },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x20F4CF4B67E83, 0x60FD41E3AA7DC, 0x5AC50493280B6, 0x1EA32A4C1876E, 0x5F7902BB88B61, 0x0C5DF49F76384, 0x77BA4E5B4EB5E, 0x1566C7A898356, 0x438B8220C035C, 0x0D3B366DBB1EB, 0x2695D9A87B0FD, 0x2D3D66C8D19D9 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x4B274B8817402, 0x24ED4CF088F23, 0x6EAF6CEECB2DA, 0x01680812D1CDC, 0x6CD27995977FF, 0x71512610B587D, 0x74AF79A0E2869, 0x16BEAC7D1892C, 0x225B0BDEAD4DF, 0x38EA4F7615A2B, 0x6BFEC2DFE27AB, 0x17E0A76E270FF },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x3168B741C1D98, 0x4DB46C0D11FB4, 0x48C46FC08C96D, 0x26ADC2F3795E1, 0x46105DE1C5198, 0x50B3D60BFF7DC, 0x071901D4ACA62, 0x2AF43C29F4A96, 0x3DC8857090010, 0x06BF7A325E649, 0x19845199897CA, 0x23F061EAABF99 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x4EEBC0E360DA5, 0x0EC79F9AF7D1B, 0x5F85C21E88C90, 0x0D84754C3F399, 0x477E822C1970A, 0x337C2B6E31D21, 0x70F6A8146BE35, 0x2E0B038F3D33B, 0x6FEBF6CC2253C, 0x0443A1E7C82C7, 0x2EC2D6AC7D302, 0x0BCE2A99F5E54 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x28B51DE72C933, 0x7392105510377, 0x1A4FF299B46CE, 0x1435B30B5E0B6, 0x25E0B5BDB7638, 0x7F49BBFFBAD43, 0x43CA57002D0F6, 0x6AB4D1E760FC3, 0x277EA420F512F, 0x277C90379F526, 0x2C90717FDE636, 0x22982066A560B },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x0D75F9E99EADB, 0x00A8BE27204A2, 0x2A6923D6327BE, 0x4C26F1503D59F, 0x19A84D0561223, 0x1F7FFD5BA753E, 0x1D0A619A29051, 0x79645529F8B0E, 0x3DB0A6BC84F0D, 0x79C0B1D7E4624, 0x239B0195AEE1A, 0x0E1CA033F1241 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x67D7634894E7F, 0x3CEC87B5E9890, 0x365BDA36A37F5, 0x184E950BF5291, 0x4019781071FDA, 0x407489C3FD053, 0x4ACD5F362D1D5, 0x2B38835F0193C, 0x24356C2D50DB0, 0x622EF82DBA4C3, 0x509E021B02ADF, 0x1FEBD4EC09CB2 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x30977B7F0D343, 0x4E9D603764EBD, 0x6516C664CEA3C, 0x4C64CB5E71BDC, 0x3FA483BD80440, 0x122C7B1DB222E, 0x1EAA287E0784B, 0x0D0CAD8CF1192, 0x23DDB7DD89B8C, 0x2BE590223563A, 0x52292F1CDEF5A, 0x17D2A5893C01A },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x4B662CD5ED483, 0x0787FADCEC825, 0x14DAD90DCC78B, 0x22C158B4E5DC0, 0x0AC0197CC4437, 0x7072D884EF829, 0x5B6D804522F58, 0x7E5F5F25E3955, 0x4E28C5B1DC2B0, 0x7B5C25F112697, 0x1F22280B55DB3, 0x1F280F87BA652 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x20CBB90306465, 0x7BBA2EA111072, 0x18161EEF3D10C, 0x0545DCB701712, 0x30DACBBEEB636, 0x0507C40DD3624, 0x7FE322E739029, 0x55E939ECCF019, 0x2E9FE3B726589, 0x79BAF3C38E760, 0x6750BC1ABBFA3, 0x1C0478495962E },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x2C29383FF213D, 0x583DA23390A64, 0x74FE84D2AB430, 0x1F180173EE2BC, 0x0AC4712A20C63, 0x0B5526E655D9C, 0x7EEA054436FCD, 0x426643C52E48C, 0x7137BA595CEC2, 0x785CA354ED864, 0x5764FC37B8525, 0x3195F986E106F },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x193C0C33BF546, 0x041EE12B4CA13, 0x5EBC15A2F06F1, 0x38F56C84A9913, 0x76440916248F3, 0x0BEE2AD17DE2A, 0x6B60159F47C4A, 0x0022C9B1E18D9, 0x2ED15585441F9, 0x694E536D939F2, 0x291425F407622, 0x14160731E5E60 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x452A1605CC4C4, 0x0219BEF7A28A5, 0x7AEF186C6DDE7, 0x7AD169FE44200, 0x3860BEF6B4AF9, 0x2F32AC0690F29, 0x25C062DFDC12F, 0x754B68E3938D3, 0x4968161578906, 0x330AB3C8631D5, 0x0290518A56CBA, 0x160A999CB8810 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x5D1B2792B8759, 0x5EF6CFB88917A, 0x7BE3B5A418296, 0x31FDC8932DEA6, 0x1558A6FDF0137, 0x1C99CA654694B, 0x6ADB76C1A34AF, 0x48217A5825DD3, 0x5C6E5E9A3928D, 0x1688A65532A3A, 0x7F94CDC08AFDE, 0x16FC2F6C526C4 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x1DB0B0015C7A3, 0x5F4770BADFD9C, 0x470F7B889E67F, 0x08343A82425BF, 0x7CB14680AE7FC, 0x745D26A184AE2, 0x1E2DB2D1440B4, 0x3F55F0A41A59D, 0x1DAC7EA1E1C4C, 0x4B0F70CEB222E, 0x6E7066FCA78A8, 0x1CA8E2EA2D743 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x220F46ED7E724, 0x34D8B5324AC34, 0x28FB325C6B78C, 0x1CD435A9B7C73, 0x10E42C514C205, 0x71A3C86707677, 0x3714CFDD2AC2B, 0x1F14468A2427E, 0x0A426825938C5, 0x54621A1B8F487, 0x0E83842100877, 0x18C43438526DF },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x66DE1DC09D566, 0x508AD502402F9, 0x233AA1810941C, 0x4A10B89AED8D5, 0x7DE033017FBCA, 0x0233747E1B33F, 0x6026C117C3342, 0x1464F692CA40B, 0x2F9A48BEBC570, 0x65597303CB568, 0x6FDB43CA6B7BB, 0x33A4DFE54CE65 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x58EBADAC4C342, 0x3A628217C02EE, 0x1FBFCE1B30F86, 0x0FFA089A8ADF4, 0x65979B98B5D43, 0x754290AFB2689, 0x7106C078A4CEC, 0x00387B78FC53F, 0x5A82FDCF2EAE6, 0x4DCB1B5EA0F78, 0x58A6885DF0527, 0x0C04156CC8793 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x107CD4C5BFCCA, 0x50F357425ADF8, 0x1BA841562C22D, 0x6FDE87C73CF7B, 0x32992CA8D1162, 0x515946A289878, 0x35AFB6AC75DA0, 0x4BD08C51861C3, 0x55EB229281897, 0x66C044B23481C, 0x73FABBA101383, 0x2E1A86ED4BCD7 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x727F22720E183, 0x558003B0833BE, 0x4784695CF9F9F, 0x1B2F25CF204AE, 0x79F03D0D12AB9, 0x54CF26A4A342B, 0x157F5A69E1411, 0x3746DEA532D62, 0x4F2A3B2779891, 0x23C2FE386A12B, 0x65649A84A2144, 0x155B63068593C },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x0F248FDB639AB, 0x29988BBFB0F0E, 0x442B4F9860F58, 0x5C3984CE70128, 0x735777FE25218, 0x2B72A81BE0C3B, 0x29F8E59F10F81, 0x01A3AE16823E5, 0x79EE6CD7FE374, 0x3D2C8F40F7583, 0x4371527479FDD, 0x32EF7C53F2E29 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x5B418A71AAAFE, 0x4CE37E32A8CEC, 0x765462A04B0B7, 0x2D893AE645194, 0x0F6B160DDB5AD, 0x717C008EE8EC4, 0x1EF479073D3BA, 0x5DD0AD3C5DB83, 0x6A6AF6E9C2B57, 0x772EB15F468DB, 0x02AC62B98FD84, 0x1742838D6FCF6 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x379302AE01F78, 0x05416F5881FCD, 0x4FAFD5E61908D, 0x2B14706B3E78A, 0x41165FD806374, 0x143A82CB7C0EF, 0x2259F09681AD0, 0x2A6130B16D92A, 0x269668CF4711F, 0x7BC04E8CCB33A, 0x7D538B0A02769, 0x31C46FF34527A },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x39A526C512655, 0x1635C11E06A4D, 0x5BF7B7C6522B7, 0x35C6646169F7D, 0x4AB0BD35778AF, 0x061F860434448, 0x195F41BA49D78, 0x67873D7ABDD55, 0x765784590E29C, 0x668213F69D741, 0x4549A19F81084, 0x1D87272DDB8AF },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x15D9B1C9F31DD, 0x7C9C364B47CAB, 0x0CD0D0F3896BA, 0x0806C71AB59C6, 0x6EE6DCEB3B8B3, 0x5655D89097FB5, 0x0B6A5D0C2B17C, 0x18CFF1432A30A, 0x2CB519062D0C2, 0x76C0E0499002F, 0x6D474EF641C3C, 0x1FBEAF856D231 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x14E5949E5D954, 0x632D0C0886455, 0x36E324C97C2A3, 0x33D104CFFD990, 0x0B0D8C40743CF, 0x1A4622A3EEFF7, 0x17075AEF41A31, 0x21D0BDA25956C, 0x7CEEDC3F4EEAB, 0x048DE43C6E3D1, 0x491D89DDA4A50, 0x13A62CCE207C8 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x7E0BE17D74DC4, 0x247255767BE42, 0x2425E10384FD9, 0x3AF0FE0044062, 0x369B65AEFD8C2, 0x686FCB83FE2C3, 0x66FC45D097D02, 0x1B2873E9FC002, 0x320148111673B, 0x436F63CE2FBF7, 0x7B5882F570DE0, 0x1C4FC541748D5 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x2432B277F0441, 0x64C5A42850161, 0x74B00486A477C, 0x1E549BFC49BC3, 0x5DCF9D14FF04C, 0x491BD34A655C7, 0x036A64EB606B9, 0x7A4F44C1D2268, 0x02FCD6D0C37B4, 0x6B474BE360DCB, 0x51FBBA16880A3, 0x0BE28408B2C6A },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x16E36074CE437, 0x44DFD19859231, 0x4D5FE8D362228, 0x2CA9CDE9D134C, 0x6BD3E6B2427B8, 0x6E8D84C1DA8C8, 0x716C75F25D3D2, 0x042FFB552D4C1, 0x35DFFA3C65FD2, 0x2D4C41AFB3B05, 0x60C1057944537, 0x28784E9F59493 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x4117114789F7D, 0x62B081FC72077, 0x4C6349E18B31D, 0x632CC6395003E, 0x50C531F8DEB52, 0x43C40767FF1C0, 0x3A513AD31E7EE, 0x22DA7139205E9, 0x0F444142202F8, 0x295756E34E466, 0x080902AE8BCC2, 0x1D86F3482E47E },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x7AB06A066203B, 0x59B30580F5787, 0x0A5DDB5F5345A, 0x453859F2FAC94, 0x6A5FE3B829EFA, 0x2154712806912, 0x3E05F45484871, 0x2E4003C638AF2, 0x601EECD9E1914, 0x2EE6A947139F2, 0x1967AB8F37F86, 0x235488B060B64 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x047EF7DCCFBAE, 0x34AA14C95590C, 0x28A67ADF65005, 0x6DE79803050A1, 0x4D5C3115174E6, 0x552B0CB81456D, 0x54AA1DBB7580E, 0x7BB83CFA16867, 0x236B8427AA391, 0x223D035860D03, 0x429ABE0C607C5, 0x169CBBBE11D4A },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x1AC5010125692, 0x373D357623741, 0x0C54915EAC2CD, 0x4C5A119B9B861, 0x40F6196BE4E9F, 0x7E980F363EF52, 0x15C8C0A9C02A0, 0x10342B1258043, 0x6BE7C85BC10F1, 0x2CD7830E30C26, 0x0941E61529583, 0x1EEDB1961AF15 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x3599029FD4BD8, 0x2DF05569C3802, 0x0B3809906D4FC, 0x7C1A361D7AFD2, 0x7A1212B6A50EB, 0x3022C84F8F46F, 0x71E6C83B3AFAC, 0x6A7093A8AA3D8, 0x01D3ED34B4FFC, 0x38946A43B71ED, 0x54C884F6AB25D, 0x10329C453DB23 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x381BEE4F3B712, 0x1DFABD20C786C, 0x1FB7AE63AFD5E, 0x1BC8A6D48D29D, 0x00873D4CD53CB, 0x1466691A6ADFE, 0x5616C951DB7ED, 0x17B56E6EE91DF, 0x509E28E72DBA1, 0x4D370974182B8, 0x0058182D2C9E8, 0x23622BB1EA926 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x5F97C45E151CE, 0x4967308687AE1, 0x302D700CEC16E, 0x30A8F7FAABC5F, 0x3AE1E39F3E08C, 0x543D5066F35CE, 0x23090DDC9005E, 0x08A70D4BCA9D0, 0x698F60035B565, 0x032928D011201, 0x1E22B42121F6A, 0x1180D1524923D },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x1F2830DC3D154, 0x4804AFFE85BA5, 0x5A90F1A25C308, 0x6CB730CFE194D, 0x2B571BF528874, 0x1FB9DAD1014B3, 0x0AC658D494B5C, 0x43BCD6A48CCCB, 0x4BE442C701CBB, 0x137CA7C2B008E, 0x3334DB5C9D419, 0x205EE4EF8BC1F },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x740564BF38161, 0x398E9C9BCB1F8, 0x5F5A198E51908, 0x7FA5FC6102237, 0x38907A103229D, 0x5087C744B3797, 0x02823C96EA5F8, 0x35EB98F55C058, 0x4BA1E6368E330, 0x25730689CA922, 0x096EBFBB4CDD7, 0x209BA5803A765 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x198A1EA53B6FF, 0x7101068F82376, 0x5CEB06B5DAD5D, 0x7D24D4247D1CC, 0x136D508AA4EEC, 0x5F9538DB14D69, 0x33F2046D39B8C, 0x79E2667340F47, 0x0D4AC66A8F417, 0x65B9213851A62, 0x1C98A8D89A471, 0x203CBF12D8340 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x27AD1041B01D2, 0x198C139F82616, 0x5F6B76A3379C5, 0x48537F6326CDA, 0x2E1C5FECBB328, 0x49FEAF637A9BA, 0x646FEACD2A280, 0x4783BFD438B9A, 0x51086D22B7578, 0x770FD4688CAC3, 0x591B403D60A0F, 0x21697DD42AE65 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x2A43DA7CDBA8C, 0x34A02D76ABB7F, 0x5CFD9038236B6, 0x35258C5962766, 0x2D5EAE88B1D53, 0x21FD722B087DE, 0x7B617F8FA2E26, 0x177A417E0B0F5, 0x65D293E86EC5D, 0x2BBC4423505B3, 0x673118D5B8CEF, 0x2AEC3558170C8 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x5B3FEF2E6E6A4, 0x4B28C264E9598, 0x0B42D62D1E32C, 0x77FD2FAF46C33, 0x7FAB7B530EDC1, 0x2998F12F2937A, 0x16555AF6FBA9D, 0x7804CDF606810, 0x73D675A7401A4, 0x557AA3DF11FF1, 0x23753CE4E63AF, 0x0ABDDBDCD03F4 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x1E82735E29E60, 0x70BD839DD161F, 0x5503F797FE3C8, 0x66AF6EDA66E87, 0x37DCAA6D354DA, 0x34920B99D89D5, 0x2276D7EFBBAEC, 0x3727062785FF1, 0x648F91B15B341, 0x3FBE2CD797F57, 0x65C9D2BC58DE8, 0x2D315715220AB },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x32A284FC21EB1, 0x49B98DC3F7F5D, 0x67B9D098191B8, 0x486106B1585E8, 0x17B79B7313595, 0x166BFA7713ABB, 0x023CBFEB088C7, 0x6C6B5AB4E38DB, 0x6FEB9CAD91FAB, 0x3E823FC3EC500, 0x78D1C130890B0, 0x1A4427EDAE0CD },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x0AFDD817A6217, 0x7B797EB0CA7CE, 0x72C3D5B5B7B25, 0x333AA48B50106, 0x3581CF232F91C, 0x56BEFD836AA7B, 0x1EC79FEF26BA2, 0x2A573038447C4, 0x4B6304CAEF61E, 0x4F68DE9171FA2, 0x2CD7A761A4CDF, 0x294368FF1E098 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x3D7E84DAC62D5, 0x27809E39A2814, 0x2EDC91D691CA8, 0x7DBE4669A1B86, 0x095A1BCFA3F0A, 0x47EABD86EE838, 0x6226CF5CD04F9, 0x00C392C30708A, 0x0063EDBD2F9A8, 0x4347E2954ECF1, 0x550BC60FAF308, 0x150EDD35794AF },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x39C3FDF22B547, 0x17899CCB9E6FE, 0x0496C8A6E5B94, 0x4DED27B6A33CF, 0x59E937296138C, 0x4593CFBF595B1, 0x1FE58CB2F5E2A, 0x6DF9F75071D11, 0x3B682CDCBD108, 0x35B8810595413, 0x346A0869A17C3, 0x135EAAA689198 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x519477AA7F416, 0x09361F506BDFC, 0x28C8122A38459, 0x44E94B3C10174, 0x42C34613EE87C, 0x4302C8D077A42, 0x1EE1124CC2AC8, 0x395269E07A4F7, 0x6301E715149B6, 0x4BCE6947A859A, 0x4B8338833CC6D, 0x16BE241CD653E },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x62463C4F18F20, 0x60EC4EF55A70D, 0x2CB785015D98B, 0x2BE0C6A478002, 0x5B764AEAF4918, 0x4E7364F308B3B, 0x6BC53C920504D, 0x08CF91DDBE092, 0x5D4FBA888D1B5, 0x5306D3C1E951F, 0x2469D6CC17557, 0x1946F47020B69 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x29E02F712CE6A, 0x7FF244DAA802B, 0x125A56ABF563C, 0x62E4B0899B582, 0x3B0A205365691, 0x6312EA28B219F, 0x47FB293F061A7, 0x6F8BFF22507F5, 0x65B6B573E3442, 0x2C89D5F8F758D, 0x6C0474F68177D, 0x15B565BEC8F73 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x57872062E9C82, 0x4205E36A48E8C, 0x3D4958FC9A978, 0x4D2796BBBF3BF, 0x5108430796511, 0x05A94C9A71EE1, 0x1ACF37813D60B, 0x175263E8FA204, 0x6B4E9BA3AA54E, 0x0F157AE543E48, 0x4B3C8F6E3F3A2, 0x20DDE84BBEACC },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x74FBAA336564C, 0x055BF93C297A1, 0x1AB223246B1F8, 0x444D0E0109A05, 0x3896FDDB3CD38, 0x0C750E1831F65, 0x355B4AB05DC64, 0x3615BB5C25095, 0x6407E42B5BC2C, 0x7E0B02F706CFD, 0x5F76CED9D78FA, 0x2195EF5E31C3D },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x45BE35E725B94, 0x66F62BEF746AB, 0x75FA9E39462D4, 0x1D12072AB9E46, 0x334C8E15E1CA7, 0x27C5822A4782A, 0x6DEEBA3D80960, 0x6B5D64F6AF5F3, 0x72DE35F8E1D21, 0x42EB64811EB7E, 0x1F874D812BCA7, 0x2B58D05D70842 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x3BD728C7EFCE0, 0x5956A2F3AF123, 0x6363531CD3EFE, 0x23FE69552B0C1, 0x45C204DAD3E62, 0x3BD18D384D16C, 0x48CE91E8E074D, 0x4653A863ABFB6, 0x269EC9A9A8588, 0x13EA7F35EB4FB, 0x3B3B1D246B7E1, 0x1C74D281B2649 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x04D3A11A2ED42, 0x0E5045734D180, 0x650E65DFF26BE, 0x7E515F067260F, 0x69A52FF45CFAC, 0x73FBDFB9B3231, 0x726689F9523EF, 0x46D016FEFB7D9, 0x7E0C7550DE768, 0x02F12E5B2A165, 0x101436AFAD37E, 0x219065CDAF5E9 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x5C1C3CC9D5628, 0x201E217CA73EB, 0x66366B823B73E, 0x3BB941FE989F4, 0x74B336607199A, 0x053146E13E595, 0x7C90623337171, 0x04D5E5EC45DA7, 0x6CAABEB9FA72E, 0x0211B1ED0A89C, 0x227C26173953D, 0x1C0632A5025B8 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x1095128E508F8, 0x7BEFF7C0D0A24, 0x3C1DA3E9F072F, 0x08BAC9F391B67, 0x762AD81606EB8, 0x253FB49EA3857, 0x7FB3FB7199AB1, 0x27CE852788E48, 0x4D7144A30A8B4, 0x4D3F83E2EB401, 0x60457FE7986E4, 0x214F9707AA76B },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x5103E5F52EAFF, 0x718A7E431A9D2, 0x1560769F905BC, 0x21EF0E437A40C, 0x7C54FBFB86779, 0x12455EFD7B129, 0x2A35A1EE4A7A1, 0x54AD75A9C6977, 0x087CA555A236E, 0x565C3DC17F3D6, 0x1A40CB64C1A69, 0x0CBFA9C18857B },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x22ACBFDBD62A5, 0x45A866BAA442E, 0x642C01327EBAE, 0x3585802F71E86, 0x0DD8BC858B7AF, 0x7F41852876C33, 0x3252C014CE422, 0x6B14460C8D47D, 0x6D7D5BAEF5AB7, 0x14B8FDD424BF8, 0x471CF25E544C3, 0x292FCB6BEC847 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x475EBB47D714F, 0x1776198B2E03D, 0x48F61C12637A0, 0x7628D20946E66, 0x2EAE8B1A1B866, 0x431627A8AF289, 0x4F7DCD39D49DC, 0x60A423CD6E826, 0x05C96E355DF68, 0x2F7AC2189B986, 0x6AF2462710E62, 0x1A855FC188815 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x13EAAFE303945, 0x5D6B51DA0D473, 0x746C2D85A4DD8, 0x36B5601B86E9F, 0x5A1604E73D3E5, 0x45CE471D46E59, 0x2BBAB13DE7DB4, 0x0825608180A82, 0x34656DD0D8DB5, 0x7E2FB70AA7371, 0x30B0E7A25D950, 0x306F313EAF31D },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x5AAF47C82EA20, 0x0B4AD082B7BCA, 0x40275491DEC3A, 0x2705FC0143DD5, 0x6CA8FC48722C2, 0x5C1ADB329A682, 0x527F393854976, 0x5EE58956A7A81, 0x754A17AE94293, 0x53469A8575ABD, 0x3E69C59CDB4C6, 0x1AE04D5683359 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x2270EEB89FFCE, 0x697822C735D71, 0x0A6F7A11C1950, 0x6C56770B5C5EB, 0x491570C52E1D0, 0x21014034BC36D, 0x7CACEC86AE16D, 0x0A11A55F55C17, 0x2FEF5C8F61CBA, 0x7B770C0D3B75A, 0x4F76EE0C30F61, 0x2996F2A73F42F },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x3DF9C2C7669A9, 0x4FE2860D88B9B, 0x0B8DFCF29E6A8, 0x0CE5C753C7FEC, 0x58C81097C8831, 0x62D973255D1A3, 0x042768B73D178, 0x421C32F28FED4, 0x4B793BD6FF2B7, 0x5A221473A733A, 0x6A3AB47630F96, 0x0D3B21FA7E957 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x621A09674C9BD, 0x7F11384E320A0, 0x760D9450F64AD, 0x1752CCD44AE91, 0x42FF0215CA6E5, 0x756A6580C1F40, 0x253C0A4EE4FA5, 0x21AD295D904FF, 0x52F3F8D844A73, 0x02B473B2E6411, 0x4DCE1E4E267D0, 0x26C92DD15B6E0 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x05BFEAD0D4F02, 0x3513874D7F8C4, 0x720FAB3AA9905, 0x5B5C638DC8AD2, 0x40CB2A521E65A, 0x42AC0E0C967E2, 0x43B3B6DCC737A, 0x16F7A1E5C5713, 0x5C442EC6780C0, 0x4C38D66AC3C8A, 0x09B4EFD4617F9, 0x1ACDC5992F1BE },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x0C676FCFF57D0, 0x301EC10E3378A, 0x77C2EA7B32CA8, 0x0A0B9AEB08F37, 0x557DFAB826226, 0x2F649823A4135, 0x493E90ED99612, 0x654E8F24CBCE7, 0x2AEB9A8D526B4, 0x17FE21D0A82F1, 0x6F6D68BC38F90, 0x1F02DAF53038A },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x526A7616681CD, 0x3A7A7D368BEFB, 0x266C772AA89E8, 0x7F16476F48C55, 0x4306B7428991D, 0x5CD0A8FF02FBF, 0x21C29A7341D0D, 0x269CC482A3232, 0x29404D1F9E51F, 0x4539AA968DB2A, 0x6F4C916F040A8, 0x08F1145EAF3CB },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x0E0C2F5B1C011, 0x14DEBB969A8D8, 0x38E155AC717ED, 0x785B2A6024A5E, 0x75B1C0CAE2AE9, 0x3678FBD0A8A24, 0x2608015FE429D, 0x70B2105B58889, 0x4C1C25FEAB733, 0x56976B796B53C, 0x4828C05974FB8, 0x21C65D9C6236C },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x44850FFA2D8CC, 0x69AE06C691E69, 0x30CBC6AD26476, 0x1935AE680537A, 0x5978925A92915, 0x144BC28B630D1, 0x0E1E3E673523F, 0x50FAFB33E4798, 0x133FD2DB903C3, 0x1BA6F72970BA2, 0x68ABFD776731A, 0x1BF5B09C6A679 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x4605B0653868A, 0x29586B42487F7, 0x711FB5B7357B3, 0x6BEDCB51CC8DC, 0x3CAFF88244934, 0x55EF214DCD8EF, 0x37B5C44CB4A0A, 0x3E58AF476F8D0, 0x377F05711EA6F, 0x55D683B51FC30, 0x5D4D0EBB8C087, 0x1FEDB10D68AC9 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x3721F13A6466B, 0x6D035CFB90823, 0x3089EA85993BA, 0x27AB041602A1F, 0x06079B85D39FB, 0x1D95836D4910B, 0x54E4201CD38C4, 0x40F2BDDDC34B3, 0x2D5AD666D1F54, 0x305EC7DF612E7, 0x7DC488C7F099D, 0x18AAD9C879639 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x783370743281B, 0x5881D54D9BAC5, 0x0323EB7EDF313, 0x6E86A5304A042, 0x7BFBDC9E02613, 0x281F599BCA07D, 0x330E77F85DA80, 0x3C3BCE980E727, 0x38859D98FFA20, 0x72C458521B543, 0x6D3DBE6291D16, 0x215654A99B26C },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x6C73D43FF18D7, 0x24FFC7E979B97, 0x407503D1D3CEE, 0x2A6EC94D97D1B, 0x2AACBF3B9BC16, 0x154113E17A930, 0x2118EFA2F4641, 0x3DCB2AF22245C, 0x42B9FF25DDBC3, 0x7A739E21B37EE, 0x11B85ED5DF0FB, 0x1DEA212224DA3 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x777F947D63D19, 0x132157E690210, 0x277229AFD6FBE, 0x109C341E62BB1, 0x79372C8F9153E, 0x4F1A2EBD24E4D, 0x23F9B2B4E1099, 0x06652DA359D9F, 0x5E4F67F8ED3ED, 0x2BA282713E3D4, 0x4AA02CCEF925F, 0x25EBBCEBB59E6 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x208211D8376C9, 0x3CE448B5DDF5D, 0x433865FE67422, 0x47F6B1FA764B3, 0x2382AC39DDF94, 0x725DFA74F76A4, 0x638396FF275AD, 0x7AD1D94E1CF0D, 0x74A03FE8DD77F, 0x4AD10F5DDE6AD, 0x6DF34824016FA, 0x1251F1E5B64AD },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x1AEC8D43D5AF1, 0x623236DC14873, 0x0D02E3BE14ADC, 0x457318D34B48D, 0x456A58C9A7EB8, 0x04B51F6B5A22F, 0x7CEC41F3D4F56, 0x35303ACC4EEE7, 0x3ED448A5A5821, 0x4498A472CD2BA, 0x7D6E77D29313E, 0x22832455A90A4 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x57D4F242E3F6D, 0x37F72685E0896, 0x49E955031085E, 0x31966BBDF727A, 0x178B453486129, 0x5609E7893E537, 0x435C764531EE7, 0x4357B8FDD7100, 0x114A77266447D, 0x708AB5A726B79, 0x561CD5DDD34A4, 0x1C5F7A1357171 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x20A8472DAF153, 0x6A9A90EE15902, 0x34EB8E6635249, 0x565A4B2A90A77, 0x3ADB1170C461C, 0x0CB368F088736, 0x03A30C0C370DC, 0x4842553DC11A9, 0x27C2108415EBA, 0x43B1D9CBD1611, 0x57781E215B9FF, 0x3491FCBECDB01 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x2843320610AF9, 0x64AFC931C08D5, 0x1358C13B2DE4F, 0x1FBA06D69B4FD, 0x5BDD3A708DBD2, 0x0B7AF3AF42419, 0x2E95F23118E06, 0x67813FCFE38BC, 0x119FE926FA080, 0x7CCCA8714FBE8, 0x264D37DC71364, 0x122C828F14E95 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x7D1C0510F4303, 0x7746B2D5B1010, 0x3319BC9F46A6F, 0x6AE5C3AD6A244, 0x05F3C0EC054B6, 0x0004F22F9AD83, 0x32DB0D2E01397, 0x6DABA1D7023A7, 0x7071B666F7ECE, 0x70BC1C7B0C24C, 0x78674BBF63432, 0x34C40546D5B7A },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x6EE15CA158C55, 0x7861E5AC3E7C0, 0x4C26DF67DB4B8, 0x294AFE75F5881, 0x68A43030FCB39, 0x72B442BEFAF17, 0x1C02EA36943A3, 0x67D3969D21C03, 0x10A7979F9BA08, 0x11C80ACFF4545, 0x5B26BDD92C5B0, 0x0CF929DF111D6 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x3B025225F1115, 0x3AA2BED013EA1, 0x21137A95FBCC0, 0x215F4434DAD32, 0x6A3DD8065159C, 0x3DBE71C5089B1, 0x13CFE1829AFD5, 0x6DE1866E7E2C9, 0x31053254FAA39, 0x0F7E0365D01E3, 0x290242D522D8C, 0x2999C05E17003 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x4A23D771E9194, 0x3C7DC2C3F1150, 0x2D49CB9DED8AB, 0x2A9CC801A5FA4, 0x30B56A41476F8, 0x0B62B4FE3ED1A, 0x4350C63197927, 0x4A143301730B2, 0x386D93A0029A7, 0x5BF0650EBAD2D, 0x7970135993959, 0x0A0CD099A987C },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x2A607404E95BE, 0x25F148D9A4B74, 0x54ECBFE3ACB4D, 0x19433D12FC96E, 0x2C27CFF70ADC9, 0x0182271CB51B4, 0x3E368AD44CA21, 0x2805535657798, 0x5C10242AD0858, 0x5458B7AD525DB, 0x225E4012AC215, 0x2F69A707DA70E },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x023C01805DD77, 0x1BFFEA780B91E, 0x7BF5480595E60, 0x025EF8E5E60B4, 0x1252319789C69, 0x4111794304B2C, 0x56D53642C4FDD, 0x09AF281EC8006, 0x34438A22AD4C7, 0x50088E488F27D, 0x25D91FC28263E, 0x15BC34D67DE88 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x4C353D05A1033, 0x15F3101F1E3B2, 0x140EAEE93F4F8, 0x0AE6EFA5A0032, 0x1C7F92B5C9B83, 0x122D455CC3AA3, 0x33E9E25C80334, 0x1002044D89575, 0x5EC80D3CA3476, 0x2143580A3BC20, 0x7899A7900C833, 0x38C839A60A732 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x01495736B193B, 0x430EA70922428, 0x04261442F60F9, 0x706319191EDED, 0x6204FE40E5D13, 0x026C2A2291927, 0x47343C2BD7176, 0x66FD00B753509, 0x1F0647B838803, 0x6EB3A0FB9F350, 0x796C05891B89C, 0x21635478DC245 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x0089CF207DB4B, 0x26E82EF62F27C, 0x0D59DC178B24F, 0x7BD6F3C100947, 0x0DCABEC95875B, 0x2E2226A178AD7, 0x52F97FCAC7C5F, 0x077B3BDA2CC1D, 0x0231E36CB263A, 0x7666B96AB9EF1, 0x08AB5F595E077, 0x23A1F7E6F745C },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x1B58ADC599903, 0x31E5908C6688B, 0x563560C200558, 0x7F5F4CDA3B3EE, 0x553A751BC56DC, 0x146B27A6CE225, 0x32D5D4C013DB6, 0x634F56F63A48E, 0x2799EF5A76B57, 0x1F39D2FC232A6, 0x65E1ED41A9558, 0x0884E6123192B },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x6988B99FE1951, 0x634094F98FA4A, 0x51B758E9AF653, 0x6363D332D53CA, 0x38F8B868BEF1B, 0x1A4E88B4544C4, 0x7DE26C9407377, 0x0F632A6924681, 0x3E48FFC152261, 0x6D10B249C6858, 0x3253D6AA8C81E, 0x2D6A10469903F },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x55FEAF425C302, 0x3435D52B5A86F, 0x1335E55A2E4D6, 0x59511CD14E4FB, 0x2BE143CF0643C, 0x3E10BEF3E2155, 0x2DBE976901FFC, 0x145B4CD16AF90, 0x4CE87488ADC10, 0x0E262164E4C10, 0x67B99D720EF0F, 0x205FD65A65733 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x5D5C78F6BB720, 0x16BE4CC424733, 0x6F03D4E4A32A3, 0x437AF4C86ED72, 0x562C67FE8D2C4, 0x55F16B97A7AD0, 0x7E4E0D2B74A53, 0x5398D20E6CD59, 0x6D2CB2590A4E6, 0x0E30FB9B4E3CA, 0x4CF06F13B6BD8, 0x216E703E204CA },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x7CD39D04C04C1, 0x3358569CB2828, 0x230765B6EA3E5, 0x782CADA72AF74, 0x4C0DC89369440, 0x41204734B5F00, 0x534E0B1E15F5F, 0x5317A7661F584, 0x258B7B49E0357, 0x38F85D141219F, 0x670D85DF324E0, 0x13B2009EB516F },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x6B436B2212989, 0x30354A36AC2DA, 0x3AA2D22D71D69, 0x7702BA8611079, 0x5C1A11517A358, 0x58C8F445B9031, 0x21DB0C2E02F25, 0x5055C4DC5393F, 0x3ADF1DB6CEEF0, 0x02F7DB46D419E, 0x17A0308392E5B, 0x1D8E0E6FF6A20 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x414910283D69F, 0x200E054EDC928, 0x7AFB3A851BAD3, 0x62638F017BCFE, 0x517546D4C2E6D, 0x4A0CF9B393BA9, 0x4570109B2B5D2, 0x069DBA4F36EF5, 0x586312C8E9432, 0x4BDE1EAB25895, 0x0205CB5D1182A, 0x0E0668BB1EDD3 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x4D9C47B061641, 0x230AC666E7577, 0x121C91D7B2F70, 0x4955AAEE29036, 0x654B102360411, 0x0B3E8542B61A1, 0x754ED617EA2FA, 0x2B01A0584F739, 0x18675149255B6, 0x32DDCF0BCE77A, 0x0F114C5F15444, 0x2D7D21E76C888 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x210166F1D7EFC, 0x33A3886655180, 0x07A8457DC94F9, 0x72097D8EE573E, 0x103F3CE01F629, 0x2505964B4DAF9, 0x109F9B5767CE3, 0x50F35EFEC4F1D, 0x0E724620967B3, 0x4CA1445F05FFD, 0x2C08AEA6D106C, 0x12A3DC3A2DA86 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x603563FC85410, 0x373691111C814, 0x40CB72506C7F1, 0x488438C06E4DC, 0x304A1381274EC, 0x39BEF14608FA2, 0x104A2C93A2F83, 0x18F97137FFA0C, 0x4B09ACA27E4F5, 0x09C63B42D5D5A, 0x51758833E3796, 0x343AC5ACFE7FD },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x77EE40546C085, 0x4AE6109397427, 0x236862223CF7F, 0x73DA62597C338, 0x1593F6E1ABA08, 0x1ECAFAEC05C82, 0x035CF0D025AB9, 0x3E6D31A42DB96, 0x403336266DE57, 0x60B5F62A0DD19, 0x7F6006FA8E826, 0x24496E0E468D1 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x4DFD167076949, 0x77F92948034C9, 0x2C50C5202BC30, 0x0C92B92B6DC45, 0x63BF9FE92B7F0, 0x5A99AA477FFA6, 0x4D150506C715D, 0x3EACEDDBED34E, 0x26637C4FDC89D, 0x41BF6C776AA11, 0x38F667B509C76, 0x26124CC0CE313 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x44F398363A505, 0x7474CB8E34A38, 0x43C43F8A3C7CE, 0x71FF552FBEBB6, 0x7D191C9EDD9A3, 0x34377D74CC8D8, 0x53AFD07110CAB, 0x12CC8446973C3, 0x011A83979AE68, 0x44EDF71C60674, 0x6711D071658A8, 0x13C594E06F4B9 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x3E7A94606054D, 0x417DF2726C7AE, 0x2FE3A727F2F1E, 0x7CB6E636A9822, 0x7D4CA97F0018D, 0x78C2875DDF298, 0x49B9228F88975, 0x3B9B611DEC866, 0x05EC4108A313B, 0x4BB5101B18E0F, 0x1230F1687C89B, 0x33CF48A2364F8 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x1753CCB6A3DD7, 0x46BD2484AF657, 0x00CB1ED8D8196, 0x6DAC3B48991C2, 0x0BDB57735F75E, 0x6B0FC3D6DA707, 0x22A7CB187A196, 0x6FB29862030DE, 0x304AAA231D925, 0x658B54C16C882, 0x029DF3CEACDC6, 0x1A91F1D06D0E4 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x1009904CF564B, 0x7A5BE9C703ACE, 0x6449A0839ED91, 0x1412021C64F6C, 0x731D395D549DB, 0x10640C951B36F, 0x6C058A6D55E66, 0x3493E2993CC15, 0x2A58C4F39B418, 0x09D239A7CCDCE, 0x391CBAD6AF4EF, 0x2F59168E9EC40 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x082E997B025DA, 0x30C808FB96DA5, 0x369CC0BC81876, 0x6C7631341D7C4, 0x0FDF9A0B52152, 0x7ABB5C04F801B, 0x1C263F0D5617C, 0x760D783FF8DB2, 0x47A67CF712839, 0x30A9F0FC183DE, 0x74C944AAAA03B, 0x18886EEB08BDA },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x472D3BC74CA22, 0x033FA03D9772D, 0x76B188A9B0CA0, 0x4E1D13E2B907E, 0x4FF48F30724D3, 0x2120EA68DA567, 0x0EE1F247D7354, 0x2A623B15C40CE, 0x2535A64FC4FFA, 0x501AD5FCFBD6D, 0x57F4026285F25, 0x34CBC0C246C23 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x4A6830F3A21CA, 0x26AD349664FA6, 0x1ED8081C894CD, 0x4552284FC0500, 0x376F7FFA5546D, 0x694E239427F3B, 0x741AF03BD4D43, 0x2ACF910673CF4, 0x49203C83FC938, 0x27E392D7E66C9, 0x209BB57407223, 0x1CE94EEDDCDE6 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x6C949413E9AA2, 0x43B28B1877178, 0x0F4D133604B48, 0x3F0057706E12B, 0x3388E808A709D, 0x4C573EF9ACE84, 0x02758521F290C, 0x5B30FDBD9DF0B, 0x5CE274521A4FC, 0x19B84E6723D22, 0x266EB708D33AB, 0x33197C978F8F9 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x74273D71F4B4E, 0x68BA1FE40900A, 0x70638A4BBCD50, 0x3BAE4A85D1FEE, 0x30F01759B1AB5, 0x44126D5C604ED, 0x0675E1637EED3, 0x23FE2F658999F, 0x25E4585117325, 0x04348DA90DC4E, 0x79F1B1F231B39, 0x1C049EAB5F41F },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x2E3C7299B5684, 0x768D80DC2A6AA, 0x65C1FC97D056E, 0x28DA40B0F9360, 0x161793974E29F, 0x545C075CD0137, 0x7B566BE087266, 0x5CAD4197D822E, 0x264B591A55E64, 0x4412C3AA8B87A, 0x416410926B51C, 0x207EA5693D413 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x5CEA421931A62, 0x0212A9035AA7C, 0x7A66D0A0C6881, 0x4211FFE904F44, 0x13D7E257B7138, 0x144348E6C728D, 0x6E91AEF45E704, 0x2307531EF2624, 0x55547D1896E6F, 0x096984BDF1F8B, 0x72426D98206CB, 0x0D2401EDD23F9 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x7C24993EAB6CC, 0x5E02BD8B1E5B5, 0x0041CB6F0D6CC, 0x3E5157AA8022C, 0x65B8333251F5A, 0x44FBACBE028D1, 0x7DEEF694ABCEA, 0x0F1FFD4F255D8, 0x657308505197D, 0x4820382310B2A, 0x624CAABF12C1B, 0x1C20B6F7866EE },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x5663268829158, 0x7054142617291, 0x2CE9DC40D5DE6, 0x724406930C41A, 0x0E5C53B210C5B, 0x74FA8FA8992C1, 0x371110111394D, 0x7F99178EE1FD5, 0x36B6491F7279A, 0x77933EDB7CA23, 0x18ED813A75F9D, 0x19753F6746FAD },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x6BA93B178DDE8, 0x242DC2641447E, 0x41F3A1EDDB783, 0x1F7C711C13882, 0x654DE247B61C4, 0x1E71685290DCC, 0x6095F56F7E27F, 0x00A23CBDE9758, 0x0111ACD965568, 0x796841111A8FF, 0x5A7FDD8665C3C, 0x1BC4BDB2D15B9 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x110A919748705, 0x3A6B96CCB4840, 0x035F5AE4170AB, 0x458899BF118E3, 0x63757E7BFE3A0, 0x4DD244E0AB306, 0x128AC14DA529E, 0x6983504709452, 0x0E690802AE84A, 0x12CD335A27196, 0x2A6868B872DE8, 0x080BC366A2558 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x2B019BEE4218F, 0x4EDC25CF5ED6F, 0x36C8250262A4A, 0x132B40A665A30, 0x5F91A0ACAFC91, 0x3503D66B69E5F, 0x1B1F0EBEA4A14, 0x56BCD70397C59, 0x50083E05332A0, 0x39AC9E2780330, 0x49C1B8C0BB155, 0x29CFB20BB567D },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x60E5E440AB434, 0x12730855259EC, 0x23E7562E2BF98, 0x7EC3F9A8CB4D4, 0x0FC3E4F833340, 0x4C344FBCDA9E2, 0x48140EC188AC9, 0x419D4C52B93FA, 0x3FA16B7DEB7D2, 0x30E0AF0362D0C, 0x7500028AA4391, 0x1875EDB3E200E },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x4894AA855C4E0, 0x24CE9771A8FCA, 0x29861C62EA73E, 0x4B9A3C355003B, 0x739956BD3D705, 0x3267778A95831, 0x60A9F27A8FB6E, 0x7E6410FEEDA54, 0x62DD9F8DD44B9, 0x21856E3A7ADF7, 0x773F5064D7444, 0x24071C2A369EA },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x632DB0A375D20, 0x3C892BA2DF32B, 0x704439388498D, 0x2B355AE8C344D, 0x5B43E3049A76E, 0x2BEE4554BFF97, 0x36180D667D833, 0x48CBE2546B37D, 0x11D8E77D3A1C9, 0x70B0E386127FE, 0x793EE3FC79F45, 0x0FD09C819E2B1 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x2E1C9DBF8D6A6, 0x0E737032BE1D5, 0x58B277FE78968, 0x73564D403358C, 0x06EFF0669CA6D, 0x6FE4213228D23, 0x48ECA69332490, 0x23FA1ED3710E3, 0x7EFB1338C9A1F, 0x5CAB54F5C62C7, 0x3C633FFCD21EA, 0x254EF9827CE60 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x6253842737C17, 0x2E369B35A4ACC, 0x00390E2196A31, 0x2046B67AA5AC8, 0x6F9F0906120B3, 0x561F5D4AF9BF6, 0x56E979DDE9763, 0x1D3841EF26C27, 0x044AE34AC570F, 0x795129E834486, 0x3C6B97C7B5260, 0x212E9A1A69D57 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x0370E7F497D31, 0x0B867147B8EE0, 0x490279ABD0637, 0x279C1EAA4879F, 0x0AE6CB390C1B3, 0x7FBADC54DF41A, 0x36DFD7435D7D8, 0x5947D072C01AC, 0x426C007214A9E, 0x3279F2C100E5A, 0x44EE004E665A1, 0x2A7988B639EF9 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x7973813E48F30, 0x069AD7CE5DD30, 0x37D664105F816, 0x006DEECFE4DB2, 0x5F907B5E1A633, 0x6DBE70A3BFED3, 0x28DCB952C01BA, 0x6AEB9C48A94B7, 0x31356E71B5F54, 0x58F0D2EF678B2, 0x6C2FB3740E506, 0x0C89B0B601B62 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x6D32DA61515E6, 0x358BBE462A782, 0x318CBA623B6E4, 0x7B82B574D76FC, 0x3EBF70378CC1E, 0x6ACD3F29B0E36, 0x66346B01E402E, 0x50F364233837A, 0x302ED23FF6E8D, 0x7B9B040058893, 0x1995B89981A17, 0x29CB7C44DE582 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x323C2DF2B9590, 0x37BF33AEE8E7D, 0x7205E2C331753, 0x2F7F5D9B313DF, 0x54DD89ECEDF9F, 0x0A07898F0FFBB, 0x518105F2F1E20, 0x026A8364DCAA4, 0x34990EFC1BD92, 0x0C29DA7349DDB, 0x4773874AF353E, 0x15CB37A863830 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x2FF4B9FC7CF2E, 0x3D704CFA6EFB2, 0x67E62742D0AFF, 0x0C767639F3074, 0x4CFFBAD9F1FA2, 0x74AF7C0A7AFFE, 0x2ADD149DDC2D1, 0x1DB81680F2C07, 0x1C2B1E90282AA, 0x1AC46DD22D2F3, 0x57B8D08E40EBA, 0x1FB9E89633173 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x41F454F90433B, 0x7F6EDB633161C, 0x0EF2B783BF99F, 0x47004637DBFC6, 0x75A6E48413F5B, 0x185E1D2D6A5A9, 0x01FB15DC6DA91, 0x6736E70CEA661, 0x6D74CB11F617F, 0x3BA6463B539AB, 0x65E8E44DC2DB6, 0x045BD777579AE },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x316D4C102835D, 0x036BA63F52DD9, 0x0D8B6100C596B, 0x6CFCE4C339B97, 0x5155F39760D85, 0x65D07072FB305, 0x4C8A71F87F0AC, 0x6F9C55C02C161, 0x3C49E2BAEB1F0, 0x1DC0DC986AFD3, 0x65A918CBAC603, 0x28E9D4972DE83 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x01395D4A8724D, 0x617FCFCF60F08, 0x2ECFBF91DFD8A, 0x66C72482F0452, 0x7D7D5556EA483, 0x7B37BD9000495, 0x373D796769D0E, 0x12DDD9950CB4C, 0x6E288CDA73968, 0x6733AAFEA560C, 0x3CF78422C13B0, 0x123296A01614F },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x2D78E370C80D5, 0x2AB1983A76B98, 0x02BF9937721B9, 0x062BA918ED2D8, 0x6EA5D2162D1E8, 0x110F6CC3CACB3, 0x0118AD3EEBD3B, 0x2C04D4347347C, 0x616C97E1DCE99, 0x136247EB11F7F, 0x036C54E0E742C, 0x311708877F503 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x7ECFC7A40B582, 0x7833F94ADA6B0, 0x43966CFD18825, 0x133FF9B526727, 0x1FB53AB776B7F, 0x5C5A8BC8E14FD, 0x2DB14CC7473CD, 0x08770A670AC64, 0x10E2ED972C98D, 0x64D6771E9BC63, 0x333F877CF9D2B, 0x1A6A8797D4612 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x777A318E4C518, 0x7472A172BCB8C, 0x03A1124655358, 0x2A4C1719C1DA5, 0x46EC9F8BE64AA, 0x4E4B4503D7082, 0x05C94D1805668, 0x0B45C4160FFC1, 0x7AFAEEA96F42E, 0x2EE2763DA73FF, 0x3C4D4ACC8CB96, 0x22E66648C6686 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x4387BF3062052, 0x3DBCBBE8742B2, 0x0BDDAC8AC647C, 0x0CC79D0C984C1, 0x13C88B37BBE08, 0x2D050B4FC93A6, 0x5C0E2F8540585, 0x064EC9C7EE548, 0x325B9BDEB02EA, 0x6EB8B825A51B6, 0x073F6A75A5723, 0x2229ACBBF07D3 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x41F5F75C7F268, 0x39E220A73A6D1, 0x4301DB4BAC28A, 0x419F1652C4C94, 0x32E392F254185, 0x5AF1779BC803C, 0x60F2D8B6984F0, 0x149FD67876ED1, 0x0BADA6638E0B8, 0x0B78682422142, 0x6713BA129206E, 0x2E5E82C62FE2B },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x16E530DB53F91, 0x25AFF63E34D39, 0x6193AE1E9C93E, 0x289CDBD05A291, 0x6D9E2BFBF7357, 0x71CA11E6F3B43, 0x050CADCE6F434, 0x31A95C8EAE14B, 0x39896F5CD0A70, 0x127DC584B23A3, 0x026BC15C89530, 0x1CFC75C5ECF6C },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x1F7629186BDD9, 0x189EECD7CAE98, 0x0BE96BA7E23AE, 0x14BAEE2D8F5D3, 0x3DD83F0490237, 0x308357DF0D5DD, 0x4B312AC833105, 0x71C4F2BD324EC, 0x6366E705B5A40, 0x0199940174D11, 0x7B9088C995C8F, 0x1D52B9764DBD4 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x319E75535B0D0, 0x017B07B0547EA, 0x236A311F48F5E, 0x0820F1120D8E3, 0x3A1A7E1502002, 0x78972BD4DB5F6, 0x000A7EE53362A, 0x4FAC4BFEF59D6, 0x052A8D2472E6C, 0x5031EDE43019E, 0x6C831778FDDB1, 0x0DEFD706A0CE7 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x3423E9B89372C, 0x51B518FBFE32D, 0x7A238148E06D4, 0x79EFEAAFDB97B, 0x5284D324793B2, 0x6BE422C44CBDB, 0x591CE2622323B, 0x6DADDD2C861D2, 0x32E045796D92B, 0x09ED10710D211, 0x5F22D8D0B9BFF, 0x26FF2549154B2 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x5572D18697F30, 0x260F4BF458867, 0x6A9DDEEBDA27E, 0x566E2112D87CB, 0x6DB630DF833F3, 0x0DD2858C8935E, 0x3B8B79CA83842, 0x772DD8CAC2BAC, 0x245F9C2A43348, 0x1CB7C1FA43BF6, 0x757B62D0A08C6, 0x20D50C34E05ED },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x026CEE0A3261A, 0x766CF9C33C3C8, 0x371DD8F4A7E22, 0x74AD554DB0CBB, 0x478C733BCA235, 0x0865FA3D8A742, 0x51AA06300E489, 0x6A47300E05B14, 0x6F2D85EF5267B, 0x15B35F5293AD6, 0x540591C160F8E, 0x2FD8A3E8E5EDA },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x15C83F981E7FA, 0x2E4185909633A, 0x615C67CD6BFD6, 0x32DA73D2E6577, 0x2CE8759B67A58, 0x66F11DB53FEAC, 0x15C01239D6334, 0x552497843C39A, 0x496AB88DB72AE, 0x322DFD9DAAC99, 0x63613AC3C30F9, 0x165061BBBB7AC },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x0E8C2C8E99770, 0x39FD394AAAD6C, 0x457FF880D6569, 0x551A94C8E53C8, 0x0A64FDA5FF9C2, 0x5B4370BB90E0B, 0x6F579304E76F0, 0x6F6168014B152, 0x3C967F31F2678, 0x25A6930CC7ACB, 0x3E4A7C8B752AC, 0x3670CD9AE7FE1 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x6901BC2D23133, 0x705D3F6B24475, 0x03833E3103060, 0x5B4F1CB275C87, 0x791722F4DEB51, 0x3F71ECE7E126E, 0x1C8F2CA3A7C4A, 0x020EA383AEB44, 0x4B2719AC151B7, 0x016B2EB17C060, 0x6C35C18197FEE, 0x0F8EF132174B8 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x0676F4D35F111, 0x3A7B824579B89, 0x28B214604D493, 0x7AD4BED56C2EA, 0x168AD2E1BC15D, 0x52B1A78BFE222, 0x4C3213C0965B6, 0x50D2C722F8FFB, 0x58716E65C4E58, 0x432C28949A1BF, 0x24409E467C09F, 0x263C2318015D7 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x0DFAEE520D1D3, 0x3F4B3FDB46DE2, 0x6A5D0A2178E7E, 0x2ADBE92476BC9, 0x3AFE5C951B984, 0x04E36A2C444DE, 0x19116DCEBB617, 0x3E9F4084EF190, 0x5F3EAD36871A8, 0x0A2466A4C650D, 0x10EA15E3D5D5E, 0x1FC2EB7D79F00 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x48183EB261EBF, 0x12D2A88E0ECD4, 0x7EAF01931DBE9, 0x7D67DF702B234, 0x0B34ABD78AB79, 0x688E600F3B44C, 0x794A64D4156C2, 0x6860D2F446285, 0x49B5EBB11B98E, 0x00955B7CE3B38, 0x3585E7777E899, 0x29A0BF0F43EFB },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x5CD056EFEEFFA, 0x5CA9290400AF8, 0x28219958A5EAC, 0x0A015CCE3AD45, 0x7EDB9E74C52AA, 0x362C54728DF84, 0x2EA6867A0BF6F, 0x796A9F91D14B4, 0x72163AB96BB73, 0x1470D2D588FDE, 0x5C42DD725079C, 0x1A65ABC1E81E6 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x5D8AB12C46664, 0x5D076FCCB12B7, 0x61BF65956D624, 0x7063837ED1CCB, 0x7D9F639084D77, 0x3AFC845C90D53, 0x7E537BB9D1B48, 0x3BC944C26330D, 0x6549C3F13456B, 0x0F7C08FECFACF, 0x6E586D9F4D988, 0x361AE3BB39D72 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x672C4749E34EF, 0x006ED72F808AE, 0x037C18DBB1ACD, 0x62ECD0A71489B, 0x486E27BB06E09, 0x7858ACB207A36, 0x10D57AF9415B3, 0x0BC7A685474F5, 0x7BE95C7D2911D, 0x080C1D8623197, 0x44BA5AB7327C0, 0x1CF670C3D74A3 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x6BD965EFD325F, 0x4BB6272A9B558, 0x673D63255DA6F, 0x56E705EF50BD3, 0x0298FFA4F0E8A, 0x0BEA65C8D74C3, 0x61D9FEE265AC0, 0x38445903F4479, 0x2333A633E8CC3, 0x6BE6FA95127D9, 0x290FD6ABDFB9F, 0x1D78884C8A070 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x59B8E506403C9, 0x4BBFF067E6A6F, 0x546B28C2AF5A4, 0x374A2294584B1, 0x72A08788238FD, 0x696943F498D59, 0x65164924DC1BA, 0x209040C91C18A, 0x693F262474FD9, 0x429875B3DA5FD, 0x0AFD0F854F94F, 0x04720AC77AE46 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x2FE02D9E2EE77, 0x6932B998E8A78, 0x0DDA4CB708A9B, 0x0A5418F0EC739, 0x6410FB0897E77, 0x78A5034E91813, 0x11C25C6180163, 0x44ABF840E0305, 0x44A999F985A31, 0x089CACDA98573, 0x684A33C23F4DA, 0x265D76BB6B159 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x41D10B794EDAE, 0x1162CC7DE7258, 0x587BD540E1604, 0x424F651982A22, 0x00F6076F81DDA, 0x73DDD47D06372, 0x090AF05FE967E, 0x75B70579B63EF, 0x50C1D2ED3B5D2, 0x5573F0B80BABA, 0x66E73D633849C, 0x1A95443800973 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x2A493C1FA0552, 0x076EDD89B1016, 0x7E9D9E6EFEDC9, 0x186E364B7B0D2, 0x44C314AF72F72, 0x032FC5E215757, 0x3A2C31DC2D7D3, 0x42F1F5976230A, 0x4F0540AEF29BE, 0x4DB7A53582E9E, 0x48BEF7F2887F1, 0x2F71089B3909A },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x08883BD7F1123, 0x7435F285F9EF4, 0x615E4B217FD02, 0x01AF3DCBF267E, 0x7A1FD437B008A, 0x2BF768684E1A9, 0x6652DAB5E8CA3, 0x676F0F713E54D, 0x414B6B02AC7F1, 0x6E22512BBF5F7, 0x374511AA8B342, 0x15A3F20D3156F },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x3CD44D7B09871, 0x5F3AB7B18C7AC, 0x5D189DBB49987, 0x333B0DE3D7128, 0x35B5F64F4E137, 0x3EEA9650A6183, 0x4629DE6FFF755, 0x4596D8B7DA94E, 0x247C66721BFFE, 0x4213119E970E7, 0x467419AD9638C, 0x22666D9E54244 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x7892AD3FEFD6F, 0x1AD2B6167840C, 0x5295095590C0B, 0x1E72750FD9B48, 0x61C9DDFD21ACF, 0x345CD1E2D01B5, 0x6D3762F7C779F, 0x51EC5978C6637, 0x1B9F69FFEE6A1, 0x1727585CD715D, 0x5E08B9DA3F94E, 0x16E6E46A5F144 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x4F10FA4D30EEF, 0x59774A0999505, 0x65E5A86F4BB0F, 0x14922F1607B25, 0x3CF4B216C957B, 0x19AC9911B0C7B, 0x2E3BB108B7E17, 0x276D943E22BDC, 0x4F4FEBB64378A, 0x5D993C1CA45C1, 0x080EE7C043E16, 0x2F45BB38987CC },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x2D06A2BD7EBE9, 0x526F4B8D85E69, 0x5CBBE1430C50E, 0x77181A6DCAF30, 0x24C9226ECE293, 0x7B74C04972E12, 0x0C93B3967AD76, 0x0AB4D69D86668, 0x27C9F903AE05A, 0x2AA136EB0D07D, 0x29A0EDF1D5AEB, 0x1643141CA12C9 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x5CA3C1FD66E89, 0x4595D58F32428, 0x5D33793A97E4D, 0x7DE1475922F04, 0x322D8719975A8, 0x766172DBFC2AE, 0x1C2D8471AC983, 0x3D8379813B087, 0x3C729E2405ADC, 0x4582D3D11572D, 0x4362EA966F754, 0x3673A17D99555 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x36EF545FDF913, 0x36ECD284F7918, 0x5B6964F9E8E1C, 0x5125F53F8B9D2, 0x65E8B0C5D1028, 0x40BE2662ADF47, 0x67FFB11EB1F04, 0x518F39BA5D132, 0x79E47FD131E28, 0x2185959B84C0A, 0x602903FD5A06D, 0x180D47A390881 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x2B0A10C282DD7, 0x5D07852F6C7D3, 0x1075FE8E64EB0, 0x02E9BD8564E0B, 0x0D07EC24C2835, 0x64E4E48C17E36, 0x74BCAA2A71137, 0x2961CBCDCCAAC, 0x1DF34D849A61C, 0x2633D4BBF1D80, 0x00AE3560FE255, 0x232DD350EE129 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x169E7855A5A84, 0x4565FFEFB9D7D, 0x72FD0048A10A8, 0x2CFAACEB3F4F9, 0x7A80008277612, 0x24B54BF75B0B2, 0x183670491D8E5, 0x5886B48A81EC0, 0x29234FF80565E, 0x33F5AFCC18DC7, 0x4C86431263C26, 0x0BD498D71BBD6 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x34F43D518FA2C, 0x6E7D10241F620, 0x7A61B722C89F0, 0x7828F7E52BF38, 0x02342DB595EF7, 0x56040BE1C35B9, 0x78A7B15E37BBB, 0x36BB8590ED74E, 0x2D15B3E0A1EB2, 0x57137EA8E7647, 0x1CF8DB4DEE391, 0x2047D1845A029 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x64413C4CFA2A5, 0x202953DABF142, 0x617FD7C426D9D, 0x7B15D5EB995C2, 0x27878CFDC388B, 0x756B39CA341DF, 0x6EA7EA6C7109C, 0x76D4327693B9C, 0x140A4FE6C0812, 0x69158F6F0A878, 0x5EAC81349177D, 0x1D66082716E64 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x2E6D20CC6FB31, 0x221DD722C3F6F, 0x7311DFFAEC51B, 0x6EF9560DA55DC, 0x5289C12CDD6F8, 0x735D3C2EBF0B8, 0x4D11E21849F6E, 0x771AB0798AEF4, 0x7C61BD12A68D2, 0x77B5CDFEFECC4, 0x746931588FB8E, 0x30BCC6572C579 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x421719D790AA2, 0x2D2B83C0E65CB, 0x58428BD4011EF, 0x549E03A5EF800, 0x6CD3BEF842044, 0x4B2544E948D3C, 0x0D39C5A852FB0, 0x1EACEC6618EC4, 0x12326A61B8BE6, 0x24390C044C1A6, 0x37412117267BF, 0x0862B53A579A7 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x4F436577D4ED6, 0x76DC31C0D5961, 0x0BCFD18F4ECC0, 0x46CEBB57162C5, 0x2FEC4F9123D37, 0x7658E5D19B60D, 0x2F98A6A8A892C, 0x23C8E8F9B9B68, 0x4A85F49CA1A7D, 0x1F2B6CE2645FC, 0x3EECD6EBB2D6E, 0x2244C890C8647 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x311C9037499E0, 0x55E361B84FD2F, 0x0FD4531450185, 0x08DA2A5ED528E, 0x520DF91B9FB20, 0x38EB51A5416A4, 0x45EEEE7A7C75F, 0x19DEE7BB8C7C4, 0x4203F1D6EFE47, 0x7D4B247CD9DEE, 0x5AC8366C704B8, 0x1CE480C0EA615 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x02D7826336318, 0x127A1D8E5B775, 0x56FD83B94E4CE, 0x7F11BD0B45131, 0x0B5B6A677A694, 0x50E0CA42B9046, 0x42ADAB72F9CD2, 0x28EB22F0E5684, 0x4D53159C85462, 0x298DDAB9CD758, 0x4F1203086C504, 0x25AFD9246B88A },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x2B6C6D6567061, 0x75BBBF24B4E39, 0x78A8935725B6B, 0x5F76CE1373599, 0x76096B8AB1EF6, 0x63481AA49D657, 0x7A87B308A5135, 0x18521E2F02C17, 0x77B0C16398E3B, 0x77B647FBC0DE1, 0x4D3DAFF604A2A, 0x11E09ABADDDFF },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x2BCBD365D3CF9, 0x1B4ACC254E678, 0x3846A3A19D26A, 0x3A66C4D3D107E, 0x77069A526A098, 0x4E5111910D267, 0x2B2CD6C952770, 0x560202E8D64E4, 0x15C317D1F8F06, 0x34C817466BDB4, 0x2D178A238FE3A, 0x258003D8CEAAC },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x63661EDD09D17, 0x2D955C036C334, 0x0E708C7ABFDA8, 0x31468A741F3F3, 0x50037222BD0BA, 0x48F7EA8954B34, 0x3B2C8C09666E2, 0x56911B6EF9911, 0x48D2EB8931A95, 0x018998E1BFAB6, 0x035C2ABF10962, 0x0DE8E90038F18 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x2914A5E9EF507, 0x2860E1F1BCD23, 0x7EEEC9C31103D, 0x357CC3F86E487, 0x2CD38A7F3BC4C, 0x61B7F94DA8B3A, 0x077B277F64833, 0x6BA7F5E4861C3, 0x37EE45FB52BC8, 0x7D841AF3A1BB6, 0x471146CB45DFB, 0x2B6C44D8A1101 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x120874452D7B0, 0x04672289F841F, 0x18F412958E040, 0x21F8B27F6F7D1, 0x729234B157445, 0x002D94485C6F2, 0x03CE2441BDD14, 0x3F19B6CD68CA5, 0x220046C53E69E, 0x17B4ED3A56328, 0x5AB29C89DB56D, 0x1D5CDAC75D973 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x664CDBB5545E8, 0x70557B29E11C5, 0x0781363A32E52, 0x5ACB5254CDF8F, 0x52C5EAA5EC4F4, 0x2C60E0D7134CA, 0x2E3EE4F3467BD, 0x47C770883FC64, 0x152035DED1937, 0x0647B56173535, 0x7C800ABF895C2, 0x33C1F4FE38190 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x461B2187C1CE5, 0x7B2C7C1D18D6B, 0x5AE967398CC8F, 0x044EBC1365AD7, 0x327B1E1FCC2D3, 0x04AB015967D37, 0x0CAE23C190FE0, 0x1E30686BC8A2F, 0x42F63F1C4D2AD, 0x506A974FBE3E7, 0x22545B3C88177, 0x0F61F44FDE267 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x578A728D6B62D, 0x482A4666E88ED, 0x3CF657D2A2554, 0x25B95D9595F76, 0x23A130ED7BAD5, 0x3259108E6E8B6, 0x70445C19EC41C, 0x259D22221AB3B, 0x61DE119BA9699, 0x00C11697E230E, 0x528899F39C9F3, 0x2314DD2A411BB },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x233DBC15D613B, 0x5F881A17D166E, 0x2B303F78DA218, 0x7A81D820861EB, 0x1F58C8858CBAA, 0x296ED8E5E8D7F, 0x7B07E7FA0DB2D, 0x1BADDD9A053F8, 0x715F991E4BD03, 0x637ACAF46177C, 0x7F8BDFB6F5C24, 0x15ACA3523A632 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x3879E4B6FBB95, 0x2169A61F527D0, 0x5CCB9B54DC4DE, 0x05CB3D8932DC8, 0x71476A2C6EBC4, 0x32DB041FB2A6F, 0x2640E4352910F, 0x5A2FB967C5529, 0x3C35E25864A63, 0x30CF20B516908, 0x3157E789C6DB5, 0x2B86A87DE576C },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x0C576750C64FC, 0x47F374115EE41, 0x71824469CF8CB, 0x2D80C751FBB11, 0x544A35B50A5C6, 0x0C9060C245FAA, 0x3E012FB2B460F, 0x7F5F6F539E28C, 0x6E08B4E21BD50, 0x58B46DFDD3613, 0x4D643451348C4, 0x1163DF68F9340 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x7CCF9DE03CC4A, 0x17E52B50C23E5, 0x020CCA90B5BC0, 0x4DFE501AF1778, 0x2BA7C9C53E818, 0x6BA371E63A24B, 0x3BD60977F7051, 0x2A4B333BA17E3, 0x3991748BD61F9, 0x6D6F992C0400C, 0x2A8CF7124FC63, 0x35D182D1A18BA },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x46002F5C344EC, 0x1C5DCD0A7C856, 0x43B6DD3E6E36C, 0x3BE8522AFA2BF, 0x55B13E69169D5, 0x4BF688DECD167, 0x0C0A8A06768B4, 0x1FC8F2BF0FB25, 0x1FA6D13DB55EC, 0x4927E47C2ACDF, 0x5B55C4006286E, 0x2088FAB2285CF },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x681CD32F15AC4, 0x4E36F7FD4B9BA, 0x793D5FE7417A1, 0x704192C72B91D, 0x3CC839C01C822, 0x65D7FB1EE2FDA, 0x6715E877F3BBF, 0x6547C3C4821EC, 0x090ECC767A1D3, 0x35070DBBE40C1, 0x52E8D1D863E4A, 0x2121021549227 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x4B73B24792760, 0x6441A1A33742F, 0x4800B0BBAF982, 0x3F0ADC910E7CB, 0x6CED2FC632B9C, 0x2607C1293A830, 0x7BE93EC1791D6, 0x5C07BA1A369D9, 0x0F3CDDC7A918B, 0x510D4379F6EC5, 0x4FAECB0EFDBAC, 0x11787563966F7 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x1C36BDE546260, 0x385B316D800DE, 0x6A5FCCA082E65, 0x113E87C475237, 0x391459FC8EB77, 0x4D1CBAF55183B, 0x18E5A9F98F6A9, 0x6F2F4E02963FB, 0x439BFE2DC2219, 0x3A81F54DD1858, 0x6857BE3CA2E8F, 0x2ED4729F7A3E4 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x11A7AEE3269FC, 0x0E6DCF42C39DD, 0x6AF5BE8C80E35, 0x382D6D565D8C4, 0x31A9812C857C5, 0x20C85BEC44B6B, 0x5B689DC31F40D, 0x0E296EE2B4DF0, 0x0A0646C497066, 0x7F7E8241A9715, 0x2BC787346F7A7, 0x1166F0B86204C },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x07E3FECB659B8, 0x3EEDDF04E681C, 0x4E9FEB41AA7BB, 0x5609DD5FAA13C, 0x67E339ABEA2E0, 0x4C49681FD2728, 0x4B7FC58D06878, 0x43BC63B6E2EC7, 0x149F98318B1A7, 0x3EAFF5685F2FD, 0x37A9C7B43ABF5, 0x1CA9575C5A438 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x3D1F3A3074B92, 0x4D9B79DB6CDD5, 0x1E09BA1D18EE4, 0x03DBD5E8053D6, 0x7FA34C42F0BB5, 0x08BA1DC8E7A1B, 0x51745FE43A568, 0x060F649E8D4C8, 0x38D2DB3EC29F1, 0x63DBC2346030A, 0x0E8BD73119946, 0x1D24384F7BB9E },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x04E4F8B1F14FE, 0x3B3FDA4A74345, 0x202CA8E37D989, 0x515D4E9979C2D, 0x32EAD104CC603, 0x635BAC0B8A614, 0x2047DEF80A336, 0x596CB9C3B1A89, 0x21EED1C48A61D, 0x37BE1266A5C1D, 0x7C299B7E5D7DB, 0x2FD0360F97C6D },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x6B0AFA6CB21EE, 0x5081ADAF1BA89, 0x5E7F2D4D4B363, 0x2DB67B7453003, 0x76FD0C537E529, 0x4D5DA8F4647C4, 0x39B0194816BFF, 0x34F42ECDD6ADB, 0x4CFF860F867D4, 0x48FB2CC509264, 0x13D58FFC0ADDF, 0x08322A610F8D7 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x2021E7861224C, 0x700325D74F47D, 0x195E70786CD71, 0x63A9F394D888C, 0x4FE0925E02155, 0x7645AE2CE8BB6, 0x787FE82D1EF6E, 0x52AF9AA685986, 0x39B78972C14DD, 0x738EE3E66270A, 0x6078C7E08FE56, 0x26D1B79168F77 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x70C1D2FEBA90E, 0x473AE59248328, 0x357A2E11EBA71, 0x3818C923AEB49, 0x1B3EBAC9FD740, 0x43C2F27AADDB4, 0x0356C57469EF9, 0x76283FB77162D, 0x3D2989280519A, 0x1B3777EF49755, 0x2AA80B3756089, 0x1E7A140DFD1FD },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x7CF7E3B366E1C, 0x3615EE06E0DF0, 0x0D8E9A54726D8, 0x76C242FFD5130, 0x7433D35D3A1AE, 0x075C1EB37084C, 0x630DBF8012F54, 0x7248E59ED2D0C, 0x5EF091EABAE96, 0x7EC66950BC058, 0x715067A6C01B8, 0x2BF6E4A55404F },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x3C31552E7329D, 0x0863027D6AB82, 0x406D9242B855E, 0x4E824CC45DE23, 0x031C0F67B87F9, 0x70F812DBA35D3, 0x092A0611C70EA, 0x6D81A66484F59, 0x10082A9B064EC, 0x63D0B4B13B725, 0x4E48EFC21FB75, 0x0E9433E42879F },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x2445656F6A2AD, 0x3F7224FA38C8F, 0x65B3AE10D6328, 0x32557883D6347, 0x2723249432AA0, 0x6DAAD1FDC2F69, 0x3FC300212C35C, 0x181917ADE10FE, 0x415B420583914, 0x65A0A1FBE7722, 0x595C579E872D4, 0x324C2083CA0EE },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x63BA7A306463E, 0x3F395E6DD0A42, 0x2C834C71430CB, 0x02942CCB563C4, 0x48916F83C5B7A, 0x69979C7B0581A, 0x410EB6CE63559, 0x6CA0CCF14AFD1, 0x71592C2E16F70, 0x21A2991EC5232, 0x4813AF930E8F0, 0x1FAFCDDD7BD07 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x34F0CA13610B2, 0x60F775E98D675, 0x70D2AD7E26E4A, 0x4CCB300F5BE7E, 0x0F4B3BB3FF06C, 0x7116E8A8DB74E, 0x678C8D637266B, 0x19611B527AD66, 0x45036A00ED0CC, 0x5A590E4288BD9, 0x306D981FEA696, 0x1F024C8C10364 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x6D658FC94DEEC, 0x2B35BF9EDE908, 0x192E8FE370B03, 0x7C3BFD9008CFD, 0x127DD431F2DB6, 0x140F7F2CDFA2C, 0x3560B8774C175, 0x3EB504E72DFA9, 0x60C4819D84C97, 0x2B797D827A746, 0x27C55CE235F2E, 0x0B19F220761FC },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x6F8AC05328104, 0x666C08C31CC8B, 0x328D584104FFF, 0x43030E6A3AF77, 0x568BC29387CF0, 0x44B6DE1B32224, 0x2731D353DECC5, 0x53F90E0618549, 0x143608CAF743B, 0x6E43E3DAD66C9, 0x7C7E1779B0E30, 0x27946B2FC016C },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x38A7CA3C08EA6, 0x7365F74DA690C, 0x315B741D3BA6C, 0x6EB38E8A3227F, 0x46098EFF3A530, 0x3BD5E57124170, 0x08C57F6C8A778, 0x6C2E10CD8296A, 0x051C521ED16C9, 0x0F6FD80F785DB, 0x18ED082B0160C, 0x1B324923CB9B5 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x6FE47B1724CAC, 0x4E3262AD11D19, 0x586EB86BF14A4, 0x6FBC10EC8A741, 0x0DF98C410D434, 0x1402D74B668F6, 0x1553EBBCFFFAC, 0x63D812F1D9947, 0x44125CE5F1617, 0x0753AF468342B, 0x10D353E1384BD, 0x332A5FA461261 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x564CC0965B1A9, 0x1F5B734071C2E, 0x0CC6BB8328EAF, 0x735D3BD846418, 0x742D0B22C6DF3, 0x7DE850556B898, 0x18F6BA9BDC86A, 0x78FBD48F17717, 0x3C7D14ECF8D9E, 0x4A6A06409BDE3, 0x7F02C4AC79307, 0x08DE9258A29D9 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x3DFBAF02FDBB3, 0x1523CD1001B20, 0x16C566EE2002D, 0x5767E77A02BA6, 0x5D3BCBB824114, 0x7F4893F349011, 0x51FF411705CB2, 0x20AD0379FEEA4, 0x3649F65F7B994, 0x53380C4EF3B13, 0x55D94510983C4, 0x2FD0E8B9A68A2 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x4B443FE715A9B, 0x5C533707373DF, 0x453BB58FE7474, 0x0CC8B7AB87EA3, 0x27734C289DD49, 0x4247F8BD97DB8, 0x55BF8C8CF6E3A, 0x57514E40DD0DF, 0x1B2641AA847ED, 0x2A6F6688ACC41, 0x59F56AEFBD789, 0x1DD2636EDEFC3 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x2025590E710BD, 0x5DD6F06339480, 0x6E078A6247ECA, 0x2CAA75470405A, 0x2E55E4E255638, 0x2D121A14E4B9C, 0x5105C67424FA6, 0x39A3DE6E40282, 0x2EFD070C840FC, 0x3D54EDE8E1F07, 0x58BCD89C168AC, 0x24044AB1DB69F },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x190881C4A9460, 0x49FE659201385, 0x4E329D1D04D9E, 0x23E0152D6051D, 0x741022AF38003, 0x569009F5896E1, 0x49BBAD98DBA65, 0x26040A3FFC964, 0x2FA47664DF34B, 0x25774A65687CE, 0x40150C83681A1, 0x182F80970F67B },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x46111F5207A50, 0x0F5CD3E493C1B, 0x1644D6849A277, 0x40F6FC5878C56, 0x00E74C5461005, 0x20C44376F6F95, 0x743370742F3C3, 0x35D574D21BB45, 0x4AF69F01F07AB, 0x1DF329206A472, 0x55164DA7F4ACD, 0x3173A86E5F6DD },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x1BFB011C896CC, 0x1CCB5AC57BDCF, 0x65D9A1F8C41ED, 0x5F0A6DC9FB34C, 0x15826F8797FAE, 0x4BF19FF29EF4D, 0x6A8AA9BEAFFA9, 0x25087B26BBDA4, 0x387525D9803E4, 0x7EB9421433C9F, 0x2DD72A2EEF39E, 0x13F857A292EAC },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x3AAF70C36AFC2, 0x375E64EE95612, 0x3162A404DD22C, 0x4A458ABA7A156, 0x5E9FF3776BA8A, 0x58E37BF0A04A9, 0x680AF57D8FC9D, 0x68910ACE7A38C, 0x328711CD4853A, 0x05E3FA11522C9, 0x565A9948861CA, 0x27BA402AF6997 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x3E76DA4A1EC87, 0x5052D92AAB63C, 0x39485F774E798, 0x63467CBEC38E0, 0x418149614BF03, 0x4818F69B4923B, 0x0411D88EB9504, 0x7348F6802E12F, 0x747AED8F42350, 0x28E24BD3C1947, 0x736B8E8B5AE3A, 0x141E1E50ABEB3 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x28A50E851F2EF, 0x3B851DDF1F22E, 0x7A41D4C05AE98, 0x3C0DDA75B6E7E, 0x3E0ECCE8654E2, 0x694096BCF11BD, 0x5F7E4366FA8B4, 0x5A48D583E8F49, 0x04062231FE23F, 0x28A6FBBEFABC0, 0x1995977E072F8, 0x26BA627F95C4B },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x6D50241CE8D66, 0x1CAF7F9D07D9C, 0x7F1F96F1693A2, 0x5C372527EEE93, 0x439624EA8B92D, 0x2BD550FF77020, 0x614A3DEC53DE9, 0x54249214E420F, 0x526FF2D4A5043, 0x7AE5FEBC592F4, 0x5619E7AEA672C, 0x169F1E6CB760B },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x05F760254412A, 0x0FA122139A06C, 0x6E89AFEF109C2, 0x5DF3022FB03AB, 0x16ED78A8F3D8F, 0x0DDCD48810E80, 0x597BADA498983, 0x72D9DBD8A3BB6, 0x5CC7E81BB467A, 0x01A4EF5FA2C04, 0x183FACBD55509, 0x2C21401F2CF35 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x0B85E22D4941B, 0x69F78FC03AAB0, 0x61A01F2F69D6E, 0x6D892A5EC8817, 0x4556F3DF4AB2F, 0x43B4962FDEC05, 0x4C6AE15FE728E, 0x518236EB099D1, 0x4EE74B5A38BC7, 0x72F1AFCE06F80, 0x72A263E0E57E1, 0x0411663096B8D },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x2786B5ABC30E1, 0x2B0C44AB0C3E3, 0x018BCDB8B2357, 0x587B4B754F95A, 0x2CA451E251F0E, 0x07D6171F19BD9, 0x6D1B1BA81C938, 0x503B2E71B6E3A, 0x1455958D0CD87, 0x43F864F300104, 0x204E9D6F55D85, 0x28F72DA82974F },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x202B7CC2CBC58, 0x3552FD54C6656, 0x6DF4607D3F5D5, 0x055B1572B745D, 0x6FD5A0FFEBD1B, 0x2AE404F8646A5, 0x3C70356DAF59D, 0x7713F27AE1FA5, 0x5976D7BE9CBA5, 0x15A7DCDD555AC, 0x39AA48E30E2D3, 0x1625C422A242A },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x085F79CD5CE16, 0x507E2AEE49E44, 0x2EF37A6940736, 0x205C2E5A781DF, 0x32A565E3CA3C0, 0x75B930E3F6546, 0x22A9276BCE44C, 0x06068D4DE796F, 0x39BD70236D18A, 0x0E4CA692C4A0E, 0x28E23A7C668E8, 0x1ED31E15DDC33 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x677025950D6F6, 0x44B0E1DAED93A, 0x14062BE009378, 0x0782771718F1B, 0x747871497E4EF, 0x5738496B94025, 0x24978889811DA, 0x6F9C2FC3D1EDB, 0x3F15A35E11BC2, 0x48A987EC3D8B4, 0x73069CF20227F, 0x168728631EC4F },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x31EC130F1F170, 0x2620BA9D80BCE, 0x3F8FDDD10E39A, 0x0B9B3876E939E, 0x06CFCB84A6771, 0x25837A9B5FCC3, 0x3E66F9837BCF2, 0x3A731838CE731, 0x2940583607B38, 0x7B55B94DEB0FA, 0x68C8B46038410, 0x188B7870972FE },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x687BA19297785, 0x458E00CD67CFC, 0x1FEC7E77C8662, 0x62B6DC1806C34, 0x315A299F806D4, 0x1F964364A931E, 0x0833D79D2B6B9, 0x34D859C306B52, 0x3CD9BCEF833B1, 0x7DDB943921BD4, 0x17A4E1BBAC3FF, 0x10D1CF52853C8 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x2B487B590144F, 0x0160736DC758E, 0x3EBBE5892D777, 0x690F64880DC47, 0x584FE3F29ABA7, 0x35368EE20A6C5, 0x2B546D19A3A7E, 0x0D78F5096364B, 0x4D1CAAD4886A7, 0x7D25722AAD267, 0x7B8C9CAA249F5, 0x2ADBE7164E20E },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x7546CF274BA8F, 0x5495EA7F4BCDA, 0x28DABBEBBCE93, 0x34C972B78033D, 0x3498DC6AFB285, 0x195A6F5AE62CB, 0x57530B707A239, 0x118F9451A8920, 0x13EBE6B67B623, 0x6DA704D229BA3, 0x6E7F29B91DD76, 0x2074EDAB30FA9 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x22CD1AD1A59E1, 0x169A0D4258992, 0x5EA44CB3259E0, 0x30178618D035F, 0x631BEA5651992, 0x55F17E41C2383, 0x5F0AD2B27A177, 0x2CDD7D8146EE8, 0x626B1CCEB80AB, 0x364043015458F, 0x0808D40EA86C8, 0x207636D671E6E },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x4C233E8CD0AC3, 0x2140121CEBFE7, 0x1D13B5BA23624, 0x4979F5CFF751D, 0x7FD14185BC4D4, 0x7AB3C8C1694CC, 0x7D4B9B5642DE4, 0x5B278CB625429, 0x7E3B464F1DC46, 0x32C056DE43DED, 0x23FC880072B97, 0x1FBCFF8E786B7 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x130F8B91836F3, 0x373CEEBA3745A, 0x47287E8F8BA32, 0x4A252ABC9F039, 0x310A331A57552, 0x7C1146305BBB7, 0x7C0C857B1F6A1, 0x6A89F9C55976B, 0x04F62306F7479, 0x25E83BD5AFCA1, 0x771696C4E78A3, 0x2DAAF68A4BBD0 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x0CA4534187836, 0x111D71768506C, 0x27E6DFCF261F6, 0x384FF9D2DBB43, 0x77EC9B8EAF0CE, 0x0BDBBCFDD3D0C, 0x609ACF78AA5E1, 0x039B9621F7B35, 0x32EF58D293427, 0x1F61070EA9447, 0x1E495943C7132, 0x1E5AE3C5C4BD8 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x05693BDDED840, 0x4B3B69B4C9331, 0x09814D9B6DDF6, 0x1B8640F208BF5, 0x05D529083FB2D, 0x5947C13C52345, 0x0026FE48ED043, 0x67D8376BF2FD8, 0x0A1174E80D3C0, 0x363AB04EE132E, 0x7CEB86DD75778, 0x2344AF67F79C0 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x6EAE399AF00C5, 0x4F06B7A8F3D96, 0x23AA68A1E94ED, 0x2D7C806E30BFC, 0x1623F4465DF87, 0x420FB7A15A640, 0x1B1DD58B96350, 0x6EA21A7E5DB11, 0x6B8CB71D750DD, 0x156FA82FFEE91, 0x5DD8AA66FE3C9, 0x10B9F75E36903 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x3E27840386567, 0x3012986437927, 0x3ECDD2BE90EAC, 0x7E72CD420B1FB, 0x20BF8FAA8AC91, 0x1E1198BA3E4E4, 0x2EF3EC4AC48E5, 0x79840C72BF9B7, 0x42C7BE93EDC36, 0x6BC450C5A3421, 0x55A65F59B274B, 0x288D11B98F2AB },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x2BC4F29CB6374, 0x19C9ED5F87CBA, 0x0077078E06781, 0x2AA3F24E3B04B, 0x46186A9D17117, 0x5B10E90B4DDA7, 0x05EF9F9E47962, 0x3274DFF335B3D, 0x0902E10A9FA3A, 0x498229089EB80, 0x317DEBBF2F6C0, 0x170954517315E },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x41BB854B4A69A, 0x14804F30ACD8B, 0x5212B60313E0A, 0x1004840EF646B, 0x36F8670FF8FBD, 0x2ECDF3295DC60, 0x197AB1E9C06FB, 0x49E8EEB0B1481, 0x33F1B8E31C86C, 0x15A12B95215B3, 0x07AF6588041CF, 0x18A04353DF4C2 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x3091033354C06, 0x233C7246D3697, 0x5FEC81BA3B7B8, 0x7705A32BF6656, 0x4EBCC8A93491E, 0x1FA5798A3C1F2, 0x48CC106941113, 0x256D19A937AD6, 0x21EDD53B923C4, 0x48FF4FD8D56B7, 0x082F7E71C9235, 0x0EB421C011D1C },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x7E4D167134CBA, 0x32DFF3871C69D, 0x0AA91C63E2B52, 0x140E812BD2B7F, 0x29BA723D4DDBC, 0x45AB559DE3C14, 0x11EE8CD069B1E, 0x602A4BCD359A3, 0x313F0AB66C459, 0x1A99C5D7534DA, 0x4C549DE3F4D43, 0x1A83B3362FE75 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x5CC4C4549EF3B, 0x116174E16E472, 0x1BC683A694085, 0x28ACA637A4264, 0x0AEE3CB355C1D, 0x0272F00F548D3, 0x04F0B99BC1539, 0x7EC465353A17D, 0x558C439112A98, 0x51D5069F1EBBD, 0x69E96A9F1986A, 0x1EC6315926DDE },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x4C7129D2A2C25, 0x4FA66C2E15B5C, 0x3161630EC5E59, 0x4C05D2BAEE3EB, 0x17375B2A417AD, 0x2B836C6CE56BC, 0x42FCC6EC566CD, 0x68431D58A73B1, 0x095016DB9EE3F, 0x2C28426B8DA85, 0x7CC2FC22AA572, 0x21A2F707440A7 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x132B1EB8203A7, 0x2E035C03D5489, 0x2F03A582FEB56, 0x67BCEAABB2E71, 0x023F3052A93FF, 0x48BD8EA5C18A5, 0x4F361D84E72F6, 0x3B1F34D37E29E, 0x54D0ABF2D0878, 0x6A1FCBD47774F, 0x4C27B8A5F3F11, 0x159F61357DD3A },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x598731FA1F1BB, 0x198B8ACE282AD, 0x0DFC06E7409E4, 0x64EC74203B57B, 0x72DB78C6BF422, 0x44C0B1AB1D114, 0x1F3519CE198CF, 0x581FD4A2B3D66, 0x65AA7DE12403D, 0x4ECDFD6D50788, 0x1A0F344E43C49, 0x30D883CD201EC },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x4B6386026998C, 0x056C48015557A, 0x01C7F2B2DEA31, 0x6040A86FEFA63, 0x396728406DDCA, 0x2EA8B65F39F12, 0x69DDC2317E59E, 0x7582F18B8872D, 0x3D040F768B8F0, 0x11AE3767B0549, 0x1C9D34056FC45, 0x2712CED92CD73 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x281426FCA1B02, 0x646A414CEF89D, 0x55F6E0D958A9E, 0x1BBF7B5E56874, 0x5160CF885DA7A, 0x2FFE7F25DD4E8, 0x7E7E0AAA14322, 0x3EF042B998069, 0x4120FABDB6F7D, 0x72DDD01972790, 0x4A9812D1129C8, 0x25B7997BFCC7B },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x3A34314ED5449, 0x01D2D41A3B79E, 0x598978CDCF6A6, 0x2D4953721CF95, 0x11D92CB17FB99, 0x537FA045C9E79, 0x1F91328944968, 0x167764AB9AE78, 0x7B499842F6308, 0x0A71942A8ECFC, 0x1FE12DC81DF57, 0x257044B540B7D },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x6116BD9E5479B, 0x553BF393C9771, 0x2D07493207223, 0x633A232F16EB2, 0x10E2499764C1E, 0x255ADEF943B4A, 0x65E163D5709E2, 0x4FE0781193D1F, 0x267575C35706D, 0x2297140AC8C77, 0x6C39AC9571156, 0x2A9712DBCAB36 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x0E6645DFD6AE3, 0x61BD08171F696, 0x06C0BBFBA7EE2, 0x1C4BFB1981217, 0x1A2D56E462314, 0x4F1BCB1F5B6DE, 0x176BB9B979E72, 0x72E36DE224BFD, 0x7F51826B73D80, 0x0FD1F6E7165AC, 0x675B7E40161F4, 0x203EA55F8FB48 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x19FD6F2A38691, 0x5B9AD4BA5DD1E, 0x778D7AB5A8350, 0x212FF4BB96F5D, 0x184115FAC724A, 0x4BFD0F9C02B34, 0x116DA8EEEC9DD, 0x4A41505CB58BF, 0x013DE8DA2A555, 0x2C4C82CE507CE, 0x3193E515C2F1A, 0x2AF5A05CB09CA },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x0AAC89AB5E8D9, 0x6BFAC6D1FC447, 0x760760EC1E15F, 0x494AD1A847899, 0x21285F8EE7300, 0x1B9170829D1AC, 0x41A9D481A27A8, 0x5548E0149760F, 0x3BE7BFDA379D1, 0x31EA8F0155F15, 0x2FBD3C80026AA, 0x1DD0E34C82E01 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x6440434626D23, 0x683564004585E, 0x1289A8A3245AB, 0x675E2A5A035BE, 0x7CC253DDF33D6, 0x5E86A231B1225, 0x64246674C8B73, 0x72B364E339060, 0x0B5C7CCEB8BEA, 0x61F958EE2C447, 0x504C392C3D314, 0x24BC8BAE1EA27 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x1F36777C530BC, 0x7B39D6802820C, 0x36ADD4170FB62, 0x1C06C5C656D1F, 0x1B09BD26B6309, 0x22614E6E79CF1, 0x0DEC1ACE594CF, 0x06D51B7EC8EC4, 0x26CE0F5642C5A, 0x50F6473CCF23A, 0x65A8A86BCF478, 0x1A418F7EC651D },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x72E4188CAA316, 0x458809EF7A08D, 0x251D4B9202688, 0x229D3DA66971D, 0x3D7D31B26DBFE, 0x5FCDE0858E0DB, 0x417F0B851C448, 0x77273671F31DB, 0x6E6A513D9CA8B, 0x1E582300064B1, 0x320D3ED0A5EA4, 0x1AE11A7AD1A65 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x65A848B986996, 0x507865F6FC861, 0x2438C4697C977, 0x6E4DE971456F5, 0x402E7139A477B, 0x0EB2660A1B790, 0x6F60AC2A7BCF3, 0x5983E935385FE, 0x538B41730A685, 0x68B8EBDA2FF32, 0x33F994615FB9A, 0x126CE6B5BA80D },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x2C9E4B4100DFA, 0x515BA24ED617C, 0x38BF818BDBDCD, 0x010B65CFED21A, 0x1EC03943D6A5D, 0x60286CF3A01BE, 0x1B1B1AC2F780D, 0x7D1B797EAA420, 0x2019EF00F6BF0, 0x526D50992A444, 0x1C42655AD039A, 0x1C39F9EB71256 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x782560417BD14, 0x7F1F8918DC406, 0x75BB6EFEB6C56, 0x210E77F3D238D, 0x2E8824BBBCE27, 0x78368EAE21900, 0x6A6D9808D362E, 0x6BF5EF6E95A71, 0x5EBB4DACA034D, 0x25D2855D5F12A, 0x5E61255ACFBD1, 0x209E7A819779C },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x1ADF2B0162238, 0x511C1BCEA09A6, 0x73D163E957F5E, 0x7D49AAB8DFD22, 0x0F14B106C89C9, 0x0A4994B340638, 0x3E7F6B5CEC2A3, 0x5CCC96BCB1208, 0x773817A609040, 0x7E18821141008, 0x40D5B82E9E042, 0x23F0EB0F8472B },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x37B8083DAE0B5, 0x3A0B6DB618DD1, 0x2378D8CD623BD, 0x2301BF1634D42, 0x56446D641D871, 0x3AF5709112253, 0x419F57A1F15E9, 0x1E298E4F03951, 0x0B28DDE45AE60, 0x20E7EA1334EBA, 0x6E78DCCD8BE39, 0x1B1E6D1DB3D70 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x17F4749748F43, 0x3F5F919F2DCCB, 0x020DF3D2F55D9, 0x58F7A30163857, 0x4F0672DAB8108, 0x576D7AC5F0554, 0x491C90E5BCDE0, 0x24C8AF1C23374, 0x124A81B7479A3, 0x7A16BBA0DB4C2, 0x3A66DC3BD2CB8, 0x2EE0CAC7D387B },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x0B50A2D39F2E8, 0x359F361AC59C5, 0x5887E60CAF13D, 0x0B46C4032F7B5, 0x71C802046EB88, 0x6E9469D535D23, 0x0857A843100DC, 0x002AB2B637BA5, 0x1F7F37443CB8A, 0x399BD880E8D67, 0x029CDBEC604CA, 0x15E6CFD7AA528 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x5058F52766C82, 0x0DE2AF5433141, 0x48DA92A278A06, 0x779201F275226, 0x6C375094BB9A1, 0x120B5B3806D27, 0x5F2E684DA3E8E, 0x2B0CDB2F765B2, 0x0CB16F7E71778, 0x4C51100F260F4, 0x11997021C69D5, 0x2651FFD4D14A2 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x220A6C56242BF, 0x2898421C30CF6, 0x701325B65FFBC, 0x011CEE77AA9A2, 0x6F7278FF99D1D, 0x58814366FE9BD, 0x5296226492EE3, 0x7CAA136BD44D7, 0x36E75060484C1, 0x16E3CE9A18374, 0x273434C912BDA, 0x256585ABC38AB },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x02FCD350E0B81, 0x741DBA8AEA7A7, 0x4ED2D30A40724, 0x130605DF438BE, 0x110B4746AA959, 0x77A0875DDD486, 0x43830D3C7D2A0, 0x0D2D846EDB612, 0x6B6FE57A840B8, 0x397E8D96AAAFC, 0x7088CDF1A4C6F, 0x2768E2D2CAC61 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x334F2FFB1197E, 0x299A9404F3B8A, 0x5AFF4B2C24471, 0x16A4C63DA69A8, 0x43E69AC5C64C8, 0x7969E05A970D2, 0x5E3363EFFD607, 0x316FC446DC86B, 0x6BBAE3FE3B401, 0x3641906EEFDBF, 0x4E040D4445C7A, 0x1DC8A784F7200 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x648F7F90C7DA2, 0x10507BA36954A, 0x5C6A0360F9172, 0x12B8B4C2B2740, 0x77076752122A0, 0x1E2279DDD57BF, 0x4F73A6A1897AE, 0x741C47D25722E, 0x0E76B015BFFFA, 0x5530C1B5BAABB, 0x6D290E4DB269E, 0x22446EED4191A },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x1286A55A2CB3D, 0x70AE4671429F1, 0x778948422D9AE, 0x27BA827D5ADB8, 0x4816FFE7460E0, 0x3697D21CC1775, 0x5FBAF5E47D023, 0x16AF1BB185329, 0x49AD04913CFE0, 0x0364B6AE278E6, 0x421CEAAE661EC, 0x0E50653C099A3 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x17B702D5E8D5F, 0x0884FCE9B1FEF, 0x52433DC44F829, 0x48AFFFFF1D672, 0x751BEB4E15C83, 0x383892AFEC032, 0x5E99869E428F2, 0x2DA39F7BE37FB, 0x6F5E3D40A5BAD, 0x75F25A39F371C, 0x759714ED050F2, 0x28E9D801E4666 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x2206B65B414BA, 0x3F746AF17714F, 0x3C15CC5F03AEE, 0x1EF65C90917B2, 0x4E724487D232A, 0x064246B370A7E, 0x6A1DB0CB9D61F, 0x7F562D88F6452, 0x2C1839C74E9DE, 0x0736369C4B1F7, 0x3160C679EC362, 0x0B79A20B4764C },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x0D8A53F023E38, 0x2E3AD68D4DA5A, 0x04071A7BE72E4, 0x28B53A651192E, 0x71655C990F80A, 0x0AAC6FA395565, 0x0F11B5D3D404E, 0x1D8D07D938673, 0x6DB4F25EF85F2, 0x495631C721345, 0x1C14A1163B6D1, 0x2B3E1451267F9 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x58E45001ECD4B, 0x071CB50BC73FB, 0x5EC777A4AEA1A, 0x43506397BCEEF, 0x09549CCE8CAF6, 0x6685DB09744B7, 0x494B78F153B63, 0x7CB75F2EE51C2, 0x643CD4B5CE367, 0x03706AD2F9895, 0x773EE8447CE5A, 0x19AC5DA7471B4 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x36D67ED1EAB51, 0x63464E774730A, 0x47567FE631BC1, 0x704DECF12A8CB, 0x0D0E77765009A, 0x7CA8ACC7A6C8D, 0x50688FCB9A73F, 0x1FD54A45EB889, 0x1CE6BC76BC800, 0x45B7BBB1A2CA4, 0x6BA06F59283E1, 0x2C69BE11AFEE6 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x2B913A2A386FF, 0x6F2297933F822, 0x40598FB0C73C7, 0x2E39AB5855AB7, 0x2881672018C4E, 0x641C4B9FFAD24, 0x74F0AA81F5857, 0x332571DE7148D, 0x4841E50AC70EA, 0x34574DB530C86, 0x4C0EEBDB6E44B, 0x22EBCDE3B1A35 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x06E866D034D51, 0x57C6B3C2DCF3F, 0x2632FFC6DEB30, 0x78DC885CDFECB, 0x76AF9EE157E47, 0x4212160C23678, 0x5E6A82BE92C4C, 0x02B513AB06C74, 0x693C26613812A, 0x03809196189EC, 0x4A3E5F922ED9A, 0x22ABF5272657D },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x444F1B8F73FFD, 0x37D2B30775EE9, 0x38370A1EAC49D, 0x3C3B6F69EC389, 0x3CDEC47F6D4F8, 0x071983D92EE70, 0x5338CAC825E23, 0x0C50754BC0285, 0x108399350799A, 0x200695034F583, 0x32316A03F2C04, 0x26A83CE37A780 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x14A996DCDD07F, 0x1A6A9FF3FCCAE, 0x65243CC238DC6, 0x66C31D8AFD9F6, 0x1C65524639BF0, 0x563B727FFB4D8, 0x7F40F42588D23, 0x7A5C82589B81C, 0x6BB410129D3D1, 0x79F638C1CB9D4, 0x1734DE652012B, 0x255FD537485E4 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x4F542CB56EAA0, 0x59F197CA61E7D, 0x240CC8B57827F, 0x5824E9CBBB832, 0x285B558E84014, 0x49ECEDCF34990, 0x323C7E0774141, 0x2F9BE108C2A3E, 0x2262B1E883F14, 0x27F2139C416B4, 0x18FAF6BE41EC7, 0x1400BB1D3558D },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x36E59C4BC47FA, 0x61B018A375D3F, 0x3F83FF7DDFAAB, 0x5B051866F94B2, 0x4BA35BC89EB4C, 0x408E00B580E26, 0x2B9938D0D33E8, 0x4DDEB9CF7ADB5, 0x30F08BC3152BC, 0x75D4F77EDF9AC, 0x6B1DD9385386E, 0x1DD07F254AD68 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x5827568226C1D, 0x1001B1D56108F, 0x38E01CDEEC8BA, 0x0609E7EDDD03E, 0x75CD046F2199A, 0x60CBC0EEF3CA4, 0x67CF789F085E4, 0x49323CA9DF956, 0x56DACA119E22D, 0x24A2FD0085AA7, 0x2B028EC1B3AEF, 0x16605EB9AF8AA },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x057AC559E1F63, 0x2A33A266B86A5, 0x7BA7B493C29E8, 0x076F3884430D5, 0x2DB5EDA44C1ED, 0x5E4DB882386AB, 0x0FAA215034931, 0x0DF3D1E68076F, 0x22AE689C3F08F, 0x6AAD8FF2C1C86, 0x6FBBAAE373F21, 0x39C7C6E3728F6 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x62D3287CD3FC7, 0x5D7DFE9ACE82A, 0x482CC05D249F9, 0x50F13FB351FDC, 0x042C7FFE8B433, 0x469A02D0B0B05, 0x00445A6773F2B, 0x5F579F6E7A9B4, 0x488285A891E85, 0x6ABFA432E3D6A, 0x1C304F9551A01, 0x10ACA3B112FB9 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x19F0FF42331D1, 0x154F360D6DE72, 0x5FFD535B4CE2F, 0x4CC717D122B7F, 0x2FB85ABB5A83B, 0x62F291660CFCE, 0x7A19CAA348496, 0x151BB0FEB707B, 0x503B4FB720544, 0x3EE80BB277552, 0x60D9AEA0DF89A, 0x2D592C0DBB55C },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x3F9CF66EA54AE, 0x2DC8A98E109C2, 0x1C502FE3EF020, 0x57FDE6E08D7E0, 0x1028C886A4579, 0x0464B53F28C9F, 0x23C45828B4F52, 0x187855C09C4E8, 0x4C9570331E7BD, 0x66B5E44893D53, 0x190AB1A695D10, 0x06132A14CD14D },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x543932EE568A0, 0x6D6D6B275D3B8, 0x0B8E1C6972B55, 0x024DCEA698C01, 0x46FD95BE4761C, 0x087AAC83E4751, 0x4C94E190825D6, 0x14684AF1A1DB9, 0x25DFE8E0E6718, 0x31E14F3384F3B, 0x3398632BCEA3A, 0x28B274368CA20 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x36BDFB444E56B, 0x6C89F27E1BE99, 0x7A489978817A3, 0x79ED4250879B1, 0x2A972A610A760, 0x0966CA60D40D5, 0x39EF76F2BAFC6, 0x422A5C5338FB5, 0x351E8DE58CE5F, 0x3FB28E71D7557, 0x1F790CBCD6570, 0x157FB2ABFF011 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x6F44D67193FE7, 0x26F1333DBFFA3, 0x1C5B1724AF17B, 0x781CF79975627, 0x249E4E985A674, 0x65674B2F2A224, 0x4E1BDC4121A08, 0x40E4D21FD97F7, 0x24BD5ADED24C9, 0x0A130145C8D17, 0x70D9409246B10, 0x25AF8691D7382 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x699276620DA46, 0x60276A9A5B197, 0x3EB17A8E9AE68, 0x656CEB8834358, 0x3BC6C92A7D267, 0x0543AEC7107BA, 0x4EAB5B6FCB8FB, 0x55104F555E96A, 0x10DB8457EA56B, 0x4E9021AFDC3D1, 0x08ECB62A69B6D, 0x138B82B721284 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x4FC38D5BA403A, 0x54F3390C1D322, 0x48FA9E93DBA07, 0x2299D939FFE13, 0x63994136E7139, 0x3D2BCA2FFFF2F, 0x0462C491B7FCC, 0x2A4A28D7C350F, 0x329127528F911, 0x64EF656A8E51B, 0x52ACC9A6D9664, 0x35C1BA8E581EC },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x76BB44D463D8E, 0x34C046F16CE1F, 0x7C404CEF3CED2, 0x2A942A93A9DA4, 0x5BEF70EBC1F49, 0x2897E6BE699A9, 0x121502053ACCE, 0x544EB5A432E14, 0x7E17CDACB42AD, 0x1C37AB6706F74, 0x76A31B6558B70, 0x1D131860EB857 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x1D3AB2F682BBE, 0x66B490C59174C, 0x3A025E5DF5319, 0x1E30BBE2CFD5E, 0x19DE9B54F8468, 0x078F9B7873EFE, 0x76E52E124BA49, 0x5F016BAC55882, 0x708BAE50CC52E, 0x4D96E84E5AE1C, 0x34AD640513FA3, 0x1A92A5654F0B9 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x14A9C01E9AC68, 0x3C020F1816558, 0x4A640E6CCC6E0, 0x5A448BA6A5238, 0x4906F1E82B235, 0x1AD1BA028FBE8, 0x57DB187434138, 0x6104144A2496B, 0x28D22FB35A87C, 0x1D0B0B13A44E1, 0x323FC5D76714C, 0x08591BEFA48C2 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x36861F0CBD2F6, 0x413CBBBB3E19E, 0x2952FA225197D, 0x718FA30B04E48, 0x78B3F4671A7CF, 0x0172424E0C919, 0x6B63A21B0F559, 0x52C822352B7E4, 0x4CCF1B0C552D7, 0x623996E8F7F7F, 0x2C2A25CE5403A, 0x2DFE3B4DAB98F },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x47C89CB65E42D, 0x7BBD6251DBD2A, 0x4F89D331D39BA, 0x2426B14B36707, 0x1669C1F567C1E, 0x07BA5A523E4F8, 0x2A6B7F0801C78, 0x5635D60405521, 0x5326A884A537B, 0x6E07CBEEFF4A2, 0x0E260FBFC76AD, 0x1CD171FBA60FC },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x234F940112733, 0x48050A29A99F9, 0x782289C58887C, 0x41B11574965B9, 0x6A71A56230347, 0x148E7595500E1, 0x32A0E7E96EFD3, 0x2C945E503FB32, 0x0827F4D690FA3, 0x12F114FB55BF1, 0x000F61218290B, 0x1F8B158AE050C },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x68E46BC8D9E8E, 0x5049F83839C03, 0x31565D582F68C, 0x10AF73F63C1E0, 0x285FED38D9FE3, 0x36E75181020C9, 0x1763E46D91B45, 0x32DB007D7C573, 0x64A06054A260B, 0x49D11E9A058A3, 0x46FD541B055BF, 0x18F5EC97C0CA5 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x3F3F98E6BA508, 0x4CF9769F4986C, 0x2DBD280201533, 0x50B82163B9739, 0x5570FD096CA02, 0x3E28A0A87AC6C, 0x06D79596A450B, 0x5E6B70D92398B, 0x4FFAB65D04554, 0x19237221BB888, 0x1B060FCEB25DC, 0x2F14F224B04B4 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x7D446E4935E42, 0x66F37AC1DC5B7, 0x463B6CE4985E3, 0x628CD811D7A63, 0x488D966FACA67, 0x66B4B4F939242, 0x5A086DC2BD5E3, 0x36C343089B2E2, 0x04BAA0C7FC328, 0x78F062CDAB51B, 0x6D25AF58E3CE2, 0x10A1B34766168 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x6181A04933B40, 0x6DEFF78797751, 0x7C87D005094E1, 0x717ED58656390, 0x2A3B149193795, 0x330D49C4F4A23, 0x35B39E78A50EA, 0x11AF9227C6B4A, 0x244E4B75FFC96, 0x6E2F4CD19FDC2, 0x612969FEEFC3C, 0x2A582A60251B2 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x3608047FEA32B, 0x4026107548E15, 0x17058A37945D6, 0x1CFFBCCA553B5, 0x691E5458D7707, 0x3EADA58F52580, 0x114BFECC01701, 0x683543B83AD4A, 0x6B53FDBFF4E87, 0x11821AC18A9C2, 0x77D9DF5403B39, 0x1D2FF83F0D69A },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x67DB3C60A5F73, 0x156429A25D657, 0x5CAC7ED328CB4, 0x69A2AB8E8B38D, 0x39074F6FD7099, 0x679F364520260, 0x276E8298B1D60, 0x523D898BFB45F, 0x3F0F05DA75810, 0x026DAFAEE92A5, 0x2F6DF09C644ED, 0x286CFEE71189A },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x52EAEA8C9AB22, 0x562683B4E2F9E, 0x596BDEC483293, 0x4A74E384B19B2, 0x33694448BD9F9, 0x518F8D26EC029, 0x7BD04470FA640, 0x1C183FFFB4F59, 0x40B001CD798C9, 0x0D169F676ED50, 0x13D8971E04D2F, 0x10F82A113C3EC },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x137EFE44EC65A, 0x334A822A7FD8A, 0x054775940D7D0, 0x20455D241A2A6, 0x358DEC67EDBA2, 0x012213F19904C, 0x370690067AEE8, 0x5C8DAC829FECB, 0x1E765EADE0A3A, 0x3A3DBFFF26C70, 0x5D72817463EF1, 0x2B29CA58E1018 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x0B5B4A96D8AC2, 0x0C67BA3694116, 0x362B683BB6EE7, 0x4981FB393907F, 0x3C7FC66D3389D, 0x26EABB0EFDA3C, 0x0ED1E433B20B1, 0x6C69A97C985F4, 0x0E1C5C35DB451, 0x4D4A1DCA961DD, 0x527167FD975B9, 0x2885CFB83C3E9 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x5DD4C60D2BD8A, 0x55B95CEC5C939, 0x373F2E2A3D08F, 0x63B6B4C1B665D, 0x1B01ADACDA2F7, 0x761451D68F5CE, 0x4A5D20429C2DF, 0x1E06CDA8F6579, 0x765078376B8E6, 0x53D772156BA50, 0x332B323E14439, 0x289A215C3EE9C },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x2665BA795DFC4, 0x68C7F55AF9B52, 0x6A4542FE5D60E, 0x3A9466554C8F6, 0x317EE9AAF5679, 0x24B4E66EF1075, 0x7E8D529FF9F80, 0x60974736B87C5, 0x3A08B68AE7E27, 0x02A72BC2FED3D, 0x42573DADAC167, 0x15EDCCF126529 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x189AB8E186C92, 0x0CBEF38DDA379, 0x72CBBE249DA9F, 0x516E6B76D223A, 0x56F799ED02F1A, 0x3191E87AE83D5, 0x3F585E9033578, 0x3F62D890F12C2, 0x079762E396E36, 0x2124299C713A8, 0x337EFA013D7A9, 0x23B261366DF9E },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x41382611514D1, 0x3332CCFE83FD6, 0x0D314F3AE3481, 0x6CA4B7B9286E2, 0x410FC996581DD, 0x6B369BAB64DDB, 0x3220866ADB68E, 0x1007F0DDFB0AB, 0x5120520E641A2, 0x4ED65FB2E6CC5, 0x261E1400888E1, 0x15EADFA801545 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x496273F529923, 0x1CB40E88AF789, 0x72D80669702FD, 0x71CCCC3BDB810, 0x725F354BC2579, 0x13F6F6296170E, 0x229FF8E02F895, 0x6DFF75EE999D1, 0x50E92A9EE589C, 0x56591B153B186, 0x710455C15864C, 0x2CCEF517AED82 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x72B30E471F7A4, 0x6C7BDA98B9270, 0x52CF31A932A6B, 0x0035EC581BD47, 0x1F125030F0F7E, 0x0F286A40F7C89, 0x572FF4CD56DAD, 0x68F6706B236F8, 0x1EEF7478B18F7, 0x5F10F8F7A3DC9, 0x34B7AA5281D38, 0x1019F224046A4 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x0943AEAA41CFE, 0x3D5497BFE8C46, 0x7AC187152A4E6, 0x56A4144BE0666, 0x64008CCCE043C, 0x00E61C04A4CC8, 0x68487EEDBA7FC, 0x7A8EE164A6A0B, 0x0ED3FF3E6D3C4, 0x2C0B92609C157, 0x0D91C77EE802D, 0x34998703E511B },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x6843883CA9597, 0x4F94D388AA388, 0x200AA9AF213CD, 0x688F0F016EE34, 0x7B9F1A81381B1, 0x431314E1D6C51, 0x130B77F175678, 0x26E21E1F6355A, 0x70CE1B13E393A, 0x00CFBD51F0495, 0x369150036BF49, 0x04E9AF529835E },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x0EFECBD15DBC5, 0x4497756C89F2E, 0x3BC945DB80B06, 0x14257A64CECB4, 0x24F170B232C5A, 0x1D6181D61FC2A, 0x6CDC13FA2E462, 0x5850235A47315, 0x756C4BB02BD7C, 0x0603EE86463FE, 0x659D77D349FCE, 0x2943BAC4188AC },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x617AFA006235C, 0x391187A580617, 0x01BF731583872, 0x3333978549491, 0x3AA9C39CDFD3A, 0x4A082559D9D6B, 0x5A4D50D985946, 0x1A5F718F9D15F, 0x0386041B386F9, 0x1EA1AC2AD82B0, 0x0887B7E33ECFF, 0x1FF32DEE0CA49 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x1EC63C1B7D074, 0x07CF4E946E9A2, 0x6922D5916A911, 0x605BFD7A73BB3, 0x00B0DAE316D04, 0x31AE6FD4C360E, 0x518BA17FC57A8, 0x42F396755FA4D, 0x234B12438D6E1, 0x10783ECD57451, 0x7FD2B9BD5FC6E, 0x2D4E557BC912E },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x5E0EE71FA597F, 0x1BEE6887AB288, 0x7FE056996C0E4, 0x480A54E94CA9C, 0x3B832DAF35C6B, 0x2F220FCF821D2, 0x46939DFF3969B, 0x56E469D9B090E, 0x650CD6CDA0A52, 0x2332FF5CC0694, 0x73CDAD66F0A4B, 0x151FA60CB8D78 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x67565632BE4D1, 0x720E6A06EEA28, 0x4B44E4E9CB94D, 0x5099A11BE2CC1, 0x639D211FBC521, 0x5144E3A9FCDAF, 0x6ADA61C4173A4, 0x5A9730AD8EBA4, 0x3C23048662147, 0x623AF59DBB43D, 0x12F41CC5AAE3F, 0x2A698E75A6CCD },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x616A9647D8D0E, 0x6499A831DCC04, 0x5F8D82290E465, 0x2B18B59370EE0, 0x0691573D87258, 0x7E148A1005B6D, 0x5994C25825366, 0x66BF4A17CDF01, 0x6104C90E59EC6, 0x3BEFB9F94EA5A, 0x77C3FF1EF72E1, 0x10C3B67B14FC7 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x7C2040B45B4A8, 0x2C935DE8A3F21, 0x1894CFB3A8399, 0x79428B92D7B81, 0x1BDEF49D853A9, 0x11D49929D5BA5, 0x3B0B589813997, 0x6D82CF1934647, 0x6981D2FF51008, 0x77D111D57C3BB, 0x5EC3D6C17D064, 0x184AFC05325C3 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x0605BEE025209, 0x3A565919DCAAE, 0x7DD319335846F, 0x7617F27317D04, 0x6952148F72F4C, 0x1222597C6BDAA, 0x7311A205DE4F7, 0x1F3074E11B692, 0x51B31D09FC064, 0x141A681A30FB7, 0x6E64F8EF0E601, 0x24C6F6E691A54 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x698E9AC76F0ED, 0x335B41F59F096, 0x2C91DEE39D2AB, 0x724960486F25F, 0x0319EEEAB8A45, 0x324B20E598BF9, 0x5464760B76CD7, 0x427515FFB75FD, 0x4BD2505EE6E8F, 0x645C0361B9F5F, 0x2518A4D6E155D, 0x281C09A9377A2 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x73325949CBEBF, 0x60976E30FFE4E, 0x3AB4AA1DD6120, 0x01AA4A49D5CDC, 0x09872C73EA53D, 0x2097C35A0B109, 0x0A3D8D0FD6543, 0x7D9EC3E98C7DD, 0x03399D1CF12A1, 0x70E555B28ECE3, 0x25DB9D24E4992, 0x21A9B1A3A38FD },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x483947E607237, 0x6723BEB7C467F, 0x1CDA260D3F1EE, 0x0F9010FAD8704, 0x39B8D5DD43756, 0x569B2EBB95D73, 0x34BD4F4D4446B, 0x4E9C97F0C5C93, 0x38480966B5B90, 0x1D1E6C0616292, 0x07498C34FD284, 0x236FB7DB5B702 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x13F63E2E2EEBB, 0x4B8E076EE1FD9, 0x2F5048F036620, 0x0F73D6B388AA0, 0x3B2C9C0E3195C, 0x309898AF80FCC, 0x1518C3267A10B, 0x542E1AD060B49, 0x012C42D587245, 0x42CD51485E44A, 0x08AD7AFDC2D78, 0x13CA56172F1B7 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x76EFF75026957, 0x441A47AACF7CF, 0x074C2B88E56DE, 0x4056769C2C52E, 0x053110D7EC97B, 0x6500508762C88, 0x3AAC202E9D996, 0x2AE8871852FB9, 0x7D7E253A9E1A8, 0x5BAB9CF19D1EC, 0x4B45714515EA0, 0x184EF33A1521D },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x20F83761FD35C, 0x7FE2E2D88EDB7, 0x52F5C0F91783A, 0x3F8EEB3D86F19, 0x6B92C310BE8AE, 0x1AA958044EBBB, 0x651E017E334AE, 0x19E12A00D6C65, 0x6BA734AC9C94D, 0x7C587D8A8029B, 0x5E50B0D2E0D22, 0x135CBE4F5FB78 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x3CBC93CAEF7A8, 0x5A0F67B113090, 0x1DABDF223E538, 0x652AC9BD8A216, 0x6B2EDCE3ACC13, 0x662ECF9649F4F, 0x7A1D9CFD74657, 0x428F2CE9D64CC, 0x1B62E9E0174B9, 0x61B36BAA753A6, 0x04481F358FB50, 0x32CD36E8B8248 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x452B2A68FFD41, 0x5BA48BC0F4667, 0x2410F7678C95A, 0x65A4B2D55C0DC, 0x622A8B4D13FEC, 0x53F566467788A, 0x3A5A8CAAB0BA5, 0x7360027A522E4, 0x33B43C76AC88C, 0x17793F6D3366A, 0x5298B406B8E70, 0x1205C99305ECA },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x7484DAAF06367, 0x53EF9B3258791, 0x6A7BF7CBB4ACD, 0x1DB1EF8A13E82, 0x451238201F47A, 0x0A5CBF209CC7F, 0x48F522E990A99, 0x664DFC51ACBE9, 0x019CC904767F2, 0x6914D58BC6547, 0x16265E3E933EB, 0x1C7293208414C },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x2050B15C45DB4, 0x25339C5952A34, 0x2E680A3298367, 0x2FDD58EFBDBF0, 0x2F00AE6451C0B, 0x46111375AF01D, 0x066AF40422E72, 0x4ACB686E7748A, 0x2D14745AF0570, 0x6818F6E3C78B6, 0x6CF4F196701ED, 0x0E1D84A3C2CF3 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x7682E53F5F1BA, 0x7BC1150CEF618, 0x177C14625C501, 0x3409A4326964A, 0x6A668BF426F65, 0x131179C45C78B, 0x29A9B5190463A, 0x69A0548DCC4AE, 0x31DDBDB7F81AB, 0x3BFA9D5AD1DBB, 0x538D78647623F, 0x1B7A130A565D5 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x79273B4F00B90, 0x6B93A00B9AA49, 0x74B96E9F8605D, 0x1C0C60B8F1DC3, 0x2E17DFA0AE7EF, 0x58E06A28AA796, 0x1EB6F1378BAB4, 0x27C8052052A1A, 0x384FDAE99EE4E, 0x000CB9EDBADEE, 0x57E1BCAD7B7F7, 0x084A02FE27AB3 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x6B5CA02E54F18, 0x6248F36AD16C3, 0x7BC096BCD11FC, 0x1164FFFFA3408, 0x1F8C8189E5818, 0x006AA82763751, 0x5C82213D91350, 0x314BF20427839, 0x67FED1209F540, 0x61A44BD5113B7, 0x7CCAB9D20B2EC, 0x29002D9266187 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x207E648741327, 0x3238AB930CC0D, 0x0D945D753EF90, 0x4B5F269403DCE, 0x0897CE46C0250, 0x028AD7160233D, 0x03D17D6327731, 0x491A406F5F5EA, 0x298997E01C3CC, 0x65ACDAB1AD061, 0x34B79F59D1D60, 0x140A5FA591F7B },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x28CB276BE7979, 0x377F70526EB79, 0x6F23D200191E7, 0x28284D093ED53, 0x59EB683D43E01, 0x3D6EC65EF576E, 0x12159421EE2BF, 0x28F2E6BCCFDE1, 0x40F0A1A77CB33, 0x39293239DCBC1, 0x1E055FAA974C1, 0x36ADE53B8DDCD },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x2806E84D17B51, 0x48DD8CA2941CC, 0x0F17E05A4A9DE, 0x301C12180241B, 0x3D622C78694E0, 0x417B8F3BD7441, 0x27F9BBBD6ED43, 0x24961767B230E, 0x60179A9C7E85B, 0x2BF5804F72836, 0x46787A3EB0A11, 0x20E7B82CA9BCB },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x59E31EC5C2001, 0x7FCF256E204A0, 0x3F45258A71D56, 0x122A692035B97, 0x30070B78E604E, 0x783BE942F5182, 0x7795096EF32EA, 0x0AFD44F11C583, 0x65D8532F2CF9F, 0x29DEA3EB7A699, 0x5F82E42E15723, 0x312D83DE139A8 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x0369C839884D0, 0x53AA4C3D63678, 0x4D72676086FD2, 0x504A3AC9A34D5, 0x66EE34DBCD1A5, 0x640A91B29B20F, 0x5BB0F26D20DAF, 0x0E71AE3AD7457, 0x735C83341B089, 0x7C90EE46A9A06, 0x3C41B3AC11BFA, 0x0E1A82C0C8025 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x5B5C82D87AFB0, 0x73C911A738475, 0x311D4FB4177C9, 0x4E3F150B3A83A, 0x355B627189367, 0x72B43960E4E07, 0x7DA32D9F310A2, 0x5377465E106DB, 0x46B3CC5497D62, 0x4A5BBA4CC69B6, 0x48114A70CEF66, 0x31FA9762FE481 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x72BFB0E271423, 0x3ABCEDAB4F460, 0x7E608A262959C, 0x14378D2949628, 0x261A5BB969256, 0x117F3DE9A7B4B, 0x3E809C1542216, 0x3E1D5B49CEF12, 0x6D3202E4A6281, 0x3A5C091DF3EE8, 0x1456E28118C05, 0x10EB4664E8A08 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x027FFB01E14B5, 0x0C236360926C4, 0x1CADE82D36213, 0x5D577C3F259CE, 0x6E7DAFA2BB064, 0x31082DE08E850, 0x6F7EB60A69F54, 0x3154B1D91B54B, 0x1BF517D74569F, 0x5DB2BCCF80089, 0x53B6F2DBC346C, 0x3260964DEB8CE },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x22610982C4905, 0x5F20225E80F77, 0x68E01F14FF94F, 0x6AF6C7A17622E, 0x4C3B2B3B13A3A, 0x1A34D3B21AC85, 0x1F045732548C9, 0x54E38CE1FB4E1, 0x5EB514235AC60, 0x1046320C5D726, 0x54F6D7F1C35E9, 0x100B9D767A70A },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x6F9EBE7BE4CCF, 0x2976EA7A4BC25, 0x328A4C9F1275B, 0x1D7C2A23504CF, 0x55AB43B5AEAE3, 0x36F301DED1FAC, 0x2F26A105C8AC7, 0x348073DE36AB1, 0x192CC434DDC9A, 0x4CF9B817B6AE5, 0x4E406941C8A80, 0x2D41645C32BEF },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x1547E005E7FC6, 0x4604F0A03DB82, 0x61DC3BD1FEA6A, 0x3F6415B855264, 0x2776C30EC3740, 0x7F73DA4D07646, 0x0C8EFB00CB7A7, 0x72205F37C737E, 0x2DBC22B1BC64D, 0x34120EA76A32D, 0x15967D62130E8, 0x11C9990B699FE },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x6EC6F52FDBDC6, 0x3BA28A5B51831, 0x094097DF38570, 0x1094C140F859E, 0x07E70E3CA924E, 0x134DFFA2E4EDD, 0x2EB0D4D2324F6, 0x136BE2A8B579E, 0x73529C419DF11, 0x61025EC905347, 0x5787CBD3A78B9, 0x1C993BE4CD9A4 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x3E7A1B5D34A73, 0x1D8E13480824F, 0x26196F34F7154, 0x0DB54BED078F5, 0x4653636F0350B, 0x0E836A0D229F5, 0x1BE517B568A92, 0x0D2B97E3FE297, 0x112DA200C66EB, 0x0B3A0A82B9444, 0x0CCB35B59EC24, 0x133965F8DF785 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x29464DFD18B57, 0x48B61E5720D08, 0x3C87E187CD777, 0x6E3A0441BE6C0, 0x6B2567A66D615, 0x2E268F0519CEC, 0x46735FC121667, 0x6ED34554FC6D1, 0x5B5375B97A0B1, 0x287E68B3603B6, 0x1890C57295D83, 0x394BE43E6D25F },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x42AD8720AE16E, 0x5D7E83E19C78A, 0x6159CBE1CF9CA, 0x0AAA6866377A2, 0x663BBE562AA6C, 0x46F481EFC9444, 0x00378EF8174EA, 0x37E70D797EDD1, 0x0FD2468338E95, 0x748B53B4A3527, 0x549FDD0647B6E, 0x1D7A198CAB5D5 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x2462D99E92D90, 0x27132CDA15D0C, 0x3EC01B0331827, 0x2F198D7FD9F18, 0x5DE953A79DBDF, 0x236D3AAB0A138, 0x5781ABE437558, 0x292220CD15ED0, 0x66BC51CB79342, 0x20438B2B37DC9, 0x1F442AF78A931, 0x35C1C33989FBD },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x5577D29DF6A54, 0x2E0EEF892E0DB, 0x4B91D1311ECF5, 0x01F1FF286BA97, 0x7E71409309BCD, 0x668297754E6DC, 0x13A0C8A1E333C, 0x56A892FC47782, 0x5C445D3EF91F6, 0x3C722B15BB70A, 0x5A7D50476C530, 0x23945B73380CF },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x76433A5CEEAEE, 0x370A3650DABBA, 0x230DC0C0A2E2E, 0x50E685616F964, 0x6570626A9E521, 0x30FB598B20A63, 0x21DCAE5A8BBA4, 0x3FE05006274FA, 0x7CFF83FDD960E, 0x563372168937C, 0x12E3339A313B5, 0x2B66239FA7D9F },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x1B3062EE5820B, 0x71FE78B290068, 0x3204C225558B6, 0x352D6A68E5A47, 0x0B1FA53A4A7A3, 0x330368B7130D0, 0x421B56D486484, 0x19A72AE55E54F, 0x4429144880F72, 0x0ECF7EFB68CA1, 0x160EE210C9FAB, 0x223422D2072E3 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x5E41F88249741, 0x57B5BE9066B75, 0x7707FE5A5EA63, 0x7A28CF9616932, 0x0B40DF7F4F819, 0x50BDC372D783D, 0x4B37C522E798E, 0x131FCA06BA1EB, 0x7BADE7F384C01, 0x4052EA008ABBA, 0x701C89707E5E6, 0x2E59E540FF1BD },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x2E9A1C5CF2471, 0x37D1551501956, 0x72446BA60F753, 0x00018D5EF9D08, 0x6CECA146B6530, 0x1EA8E48222A26, 0x54059CDA9774D, 0x658D4785A0AA4, 0x0BB3845677AE5, 0x5DED1573AD88A, 0x63897952A31FD, 0x16B18D5740193 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x261B4AD0E4D5D, 0x2CFC5F1F52248, 0x784E5BB6C15D5, 0x336C20B25FB8E, 0x5B1A9536A81C9, 0x122F29B0C6D79, 0x28D921D882BDB, 0x1683F7D1E3FE3, 0x7B22C6340471E, 0x41F92078E11AF, 0x2DA4C1B1A29AE, 0x345E2EC1096D6 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x72787E2844EAD, 0x59B97B4A2F1B9, 0x7E012D792050C, 0x18E77B9A232F9, 0x21866435703F5, 0x2EC29815AA350, 0x1F1983DFFE2AE, 0x698DE83DB5AC3, 0x0CF31C426F8D3, 0x1A320D8633ADA, 0x19AD88FEAD570, 0x0797D2E7C94FA },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x144E4F79C8121, 0x7BDC0F9136723, 0x0B0966ACBE5F7, 0x0C31C03F524D6, 0x797E1EF87D338, 0x216866D19F390, 0x222062FCED153, 0x1AB5A5D5549C3, 0x6779C3C73A0BE, 0x14563F55D62CF, 0x11A8073322753, 0x220A3861B29F1 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x39B4C9D465C67, 0x7E9B577A85760, 0x78AB91E35D4F8, 0x6537AB4E6B0A6, 0x0ED36E307448C, 0x376BF61D8466E, 0x2A4DAEBDB0210, 0x62B72BE054ADB, 0x4B296C7B56CFF, 0x2257AF71700A4, 0x63C7E55D6B3C1, 0x169DADFD6BFB6 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x00361ED60EAB9, 0x340BE6CD11113, 0x23D7A6B039F32, 0x36E1F3C313ED2, 0x197B9A2E9DFB7, 0x2503CF2ACAC08, 0x335B27F00F798, 0x37EFC29E00BE3, 0x1C2D9BBCD463F, 0x7EA91E0A6943E, 0x26030C1739BBF, 0x19B21F861821E },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x05783913407B9, 0x1A9344F9CA0E6, 0x5120C2CD08E7E, 0x2710627B1F33E, 0x1211894620BED, 0x4467BD644FD07, 0x36AE94E5F59BB, 0x6C28B8E871781, 0x1B7E66BF158B0, 0x7C1DC630C9C70, 0x184C872D1D4DA, 0x093A91B555D25 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x4A930301A7C57, 0x5C32BDD55F647, 0x2E6629E63AB00, 0x49BEF61197B91, 0x43C72622B0696, 0x710D8C39DA464, 0x11BB435B1AD8A, 0x37ECB12D555B7, 0x78C4D24DE0DE8, 0x181EFE64FD87E, 0x1BB4BC293AC28, 0x261BF734EC247 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x5F2955372E3CE, 0x56EB326366F19, 0x25EE96B379E96, 0x52FBAC0B71DEC, 0x52863C469E908, 0x6508FFB4C745F, 0x257416F7290F1, 0x18EC1AF52C805, 0x108352FFCC5A7, 0x7E2F7D2691CEF, 0x7B5FE4DAE3592, 0x0F6DABF5CD0B6 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x06AF55337A9A2, 0x7E4E6C666EBDF, 0x02537C789FA14, 0x16E6FB6728E61, 0x3AF978980976B, 0x1D346B72594EB, 0x44AC8EC8BB772, 0x625DE5B7D3894, 0x65B46FB0BD1EC, 0x2467821A9F159, 0x2429D95BBAECC, 0x3290F410F9219 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x1A1196432E6C9, 0x557181F6DBBF9, 0x5C7E21270D3F1, 0x6673EA76B5A99, 0x73B51E5FD45D7, 0x61322360E2886, 0x08CA6787ED05D, 0x429AA490E0515, 0x4261511F9446B, 0x52BF1D8CAA87A, 0x1D2CE69B9EF92, 0x043545DD7747E },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x7CC77CD4874C5, 0x08FE18B177811, 0x3EE62EC2F7D41, 0x4FBD85A58A7D2, 0x05D0C8BAD496C, 0x4A608342FB6FB, 0x5473CE16C8E3C, 0x7F5389597E20F, 0x7FB444A229102, 0x7E4A4913170C5, 0x58A6309EC91FF, 0x2448C007B1C44 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x375B5268BB17B, 0x7A08FF9A008C7, 0x6340BDF935F41, 0x502CC0433420C, 0x1BDF6CB1E7D5B, 0x267BAA792C917, 0x0C5EECAB45271, 0x4331A8C9517F6, 0x64A4A2F305E93, 0x72DF2C65C3843, 0x451B5F5AC38E6, 0x0B0E269184640 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x15E3B4BF61197, 0x50825F80EE92A, 0x7F70C4AC6140A, 0x298F42BD4D437, 0x72365B73C239D, 0x4BE064332F18F, 0x2543EED9C2224, 0x2ECE28C90145D, 0x533DD36BCED36, 0x12FFF9D97B567, 0x45E30A2B1FE08, 0x213C8F10A7437 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x114BE8A9D126F, 0x259B20CB14898, 0x5486D43405E51, 0x58CDD36D9684D, 0x66F55407BDC41, 0x0D2BEEBCB4285, 0x6409581E5D21A, 0x3492971BF4557, 0x648635EDBAA88, 0x59C95272DE0F9, 0x143B8B7DD226A, 0x09BEB3DFE8C69 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x21C75CEAAB565, 0x33249A58B144E, 0x23DB56C98F682, 0x4E0C93A4FB723, 0x102E4344DF373, 0x0829BBEDBA427, 0x10B0A8EBFA71B, 0x37FE227282B81, 0x4A3A24D9394E3, 0x5CFAD1C6F825E, 0x04FFC3E1BB168, 0x2AC41FFCD2223 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x0EBAC85A4203A, 0x6681A23FF5EC3, 0x69AA6A91C650D, 0x6EB81E24A0F51, 0x436611F3E2B76, 0x13910DC334517, 0x67256072915EF, 0x64133F0008179, 0x488002226DA0D, 0x73B37D26FD4D2, 0x34734B6997E84, 0x1465C417C0D6C },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x0C5E6BB51D8BA, 0x22D4383BD70AF, 0x47779D9D7905A, 0x65A5A53810543, 0x504AD4834F466, 0x490DE4C9EFC69, 0x60A1A30620A6E, 0x05CBDB5152475, 0x0194F9A2ABD76, 0x5EC46F9274DD0, 0x32D780D9C0B1E, 0x3773F2ABE36BF },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x13F2B4DC892CB, 0x5D436D685A89A, 0x0448AA7F46CEF, 0x6067C8A3F7B77, 0x461456B492E1C, 0x30ADA6D94BCD1, 0x3A6CE75C1AD06, 0x405CBFA62888E, 0x711085872AEAA, 0x34C83195C499A, 0x0E75FEADF4628, 0x1E3673D46A975 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x0BFF3C06A4B1D, 0x3EEADB58D5566, 0x2FCBADB94220F, 0x6D81D163054AD, 0x1D994A891C885, 0x28B5AB82EABC9, 0x0AE4CDA0798F8, 0x6B67814A19E6A, 0x66223EC4F7D02, 0x0986C52162154, 0x0EA487FD49A18, 0x30CF733A96986 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x53E2366CF6F8F, 0x57451481F9452, 0x50B7678A8F0A8, 0x48291A699BD14, 0x6D1A58A0948EA, 0x194F949C11F2D, 0x11BE1F2A20A27, 0x1F2108F573621, 0x2DA3C6694B193, 0x38601E256C4B4, 0x13C794C7FC29F, 0x16C46B724B12F },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x5E5AE73D173ED, 0x1C8904D55C04A, 0x745313F5B28D5, 0x0DA6AA0C272BB, 0x638FBC3975D39, 0x33968A1C4D109, 0x36DBA67DA4309, 0x4024E4BF1A911, 0x12DA8ADB72F79, 0x4E818DD236657, 0x2209DD0FEF1BC, 0x2FF8C6280B391 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x4BD8482491306, 0x0F66CC1E36DFF, 0x62E27BA6B1ECD, 0x46EF5DECD700A, 0x12C2AA04F77B2, 0x021EE31EFCD44, 0x2816C526A1618, 0x582A4F95160BE, 0x6BF6255AF76FA, 0x15625F9195351, 0x1866197B26459, 0x1E05837C18F26 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x46BBCE3D25AC8, 0x44AF00448B197, 0x173425D10B801, 0x059C3AB92DC2C, 0x289BDCF36E2ED, 0x4F23CA48811AE, 0x1A740E7B4CB77, 0x138D8265C368C, 0x35183C6DC7CF4, 0x11364A377F2CA, 0x66AB52F5F13EB, 0x231B0AFCEC62F },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x600E45DE68B34, 0x0D90699105E03, 0x59E10EBB84221, 0x5A66AA2DCE04B, 0x2A401CD7E36A2, 0x3A0487E77E919, 0x2BBC670DF3D43, 0x1B2B10C2544E7, 0x7FA74F6A05193, 0x0CFDA89B21E7E, 0x12AB099EFE4F8, 0x199EF6BDF0B3A },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x41FEBC13C8B96, 0x02C6A97F918A7, 0x7295FEBC235BB, 0x562B779A1BFE0, 0x192DF03C12BDB, 0x4A482BDD19564, 0x30486285395D8, 0x599666C8C9C32, 0x4F1ED974EB9E4, 0x7C535A2E79FD1, 0x4BACF7AD5739B, 0x2DDEE6DC913FA },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x735057A183DDE, 0x46EB79C907F3B, 0x408252BAB921F, 0x3FB814731FD53, 0x439635171E8F5, 0x7F81D17627822, 0x2F623AD844C53, 0x13BE01BE316F6, 0x02EAC7D7EAFCA, 0x381A82D68F061, 0x51B6BD5345B07, 0x1DCE47719BF6B },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x0B099FFDC6476, 0x1640507C5D4DD, 0x5A37E8BE64397, 0x661907CC38B5C, 0x29791D968CDF3, 0x13C3C2AF3DB79, 0x6100396726FE8, 0x5DAD88DAC8C94, 0x22E997ED6188B, 0x06485055ED1AF, 0x5596B4CE71D70, 0x2449AB6B4AE3C },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x5F30F9CD24720, 0x1F67D793267FE, 0x35F8790D3FA8B, 0x716BFC7222716, 0x2E99BDF8B0BC6, 0x251075EEA9750, 0x70A114265D15F, 0x6BC9D91B2B7C1, 0x168EF01AFCCCE, 0x348866CCCEC4B, 0x340B0B46A1F38, 0x0E34D4F0A2B52 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x318ECC4992F60, 0x45356CE15D22A, 0x06EE7F4760F48, 0x6A8417DC8DA2A, 0x2CC4D9F5B643F, 0x23D312CE0F582, 0x2E675E48C6198, 0x44CC7E56F3433, 0x2A7F91144E90F, 0x70FB20A1C7EDE, 0x56EA19DBF7A73, 0x24680FCB30261 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x0B6E2A0D689D3, 0x39A517FB8155E, 0x1C037BE959CF8, 0x595A0077BEB59, 0x49F5CFA677330, 0x251EE20841E8C, 0x2BC3B2B9C9146, 0x67B29E251123E, 0x716CD32FA5598, 0x4AADABB6F4694, 0x229258EF5AC84, 0x12398C1C26A2C },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x00872AAC66383, 0x02ACF30721493, 0x0F2F46298A20A, 0x6FA25DD2DC645, 0x4DBDA5CCC8014, 0x0F724D04A2006, 0x1C978558B6C21, 0x68BD2C2920569, 0x0D45CED11FC80, 0x7B0FFFD4026BE, 0x50487FEDD0295, 0x15C5AE9D593F6 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x3D54EFBFFF1CC, 0x6EFFA25C054DE, 0x7A69BF8BEC142, 0x6D6B083A3784E, 0x3E9D40ACF98F4, 0x3A507E67CA6CA, 0x495FDBAEDC5DB, 0x0CE0156854BD8, 0x0EB9B94AC08F1, 0x18BDAA75539C2, 0x7851AAC34D602, 0x1F28012421F91 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x3E69EBB8DA104, 0x31E0A9D628162, 0x03EB818709A02, 0x4E0A539442661, 0x2F5E5979324FD, 0x2473B6B600E15, 0x28CBEB8940DAF, 0x62D9C97B5DAE2, 0x4FF061AF69A11, 0x59140C0708B06, 0x60EEFCEA0824C, 0x2DE62FB3A830E },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x2C6A7AA2A6524, 0x6DFD601CB780E, 0x3DF23E55D4263, 0x1A914BF3B78EC, 0x134F3DE5DEA43, 0x640FAD10A5203, 0x7B457C6698106, 0x1383423E00C8A, 0x1F4D29405E28D, 0x5FDF5FC1F445C, 0x11BA943A01D6A, 0x1B95B3ECAC93B },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x35F01E76DA972, 0x06761600BB8DC, 0x61F1150306AC2, 0x666FBB14798F7, 0x1AD9D95F10044, 0x73784328B2215, 0x6359D9CF4B20F, 0x3D23F8648C0F3, 0x712F0F94D3EA4, 0x1478604BAA77E, 0x62AC8607F31C3, 0x1BD53BDDBA029 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } },
+  { { 0x7494F6AC4C3FA, 0x2891B462099D4, 0x776E9825CBE19, 0x33C4B6039BE43, 0x04ED41CC3990B, 0x7592B1AD85F75, 0x467E48647F169, 0x2B6C9E9FD93AC, 0x636984DABEF71, 0x4B31BB61069AC, 0x58D41E1E5DA9C, 0x1D1229965AF60 },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x1882A3940CC20, 0x19202454B1319, 0x6C6434F30980A, 0x1CB120743100E, 0x04382C0A6AECB, 0x5B17A7EBBD79A, 0x39C308D2A1594, 0x1C9EAAB8B9254, 0x0513ED978331D, 0x68021888A0CCF, 0x4E68D3BBA829A, 0x2814F2F55F579 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x4552D58173700, 0x0FF9ABB1784DE, 0x25535CF7E8A09, 0x4956CBE843109, 0x086128F3EC465, 0x27BF6A7688190 } }
+};
+
+#endif
@@ -15,6 +15,7 @@
 #define BOB                     1 
 #define OALICE_BITS             305  
 #define OBOB_BITS               305
+#define OBOB_EXPON              192
 #define MASK_ALICE              0x01 
 #define MASK_BOB                0xFF 
 #define GFP_BYTES               77
@@ -0,0 +1,2805 @@
+// Straight-line isogeny tree traversals compiled from the strategy tables of
+// sidh.h by tools/strategy.c (./strategy compile > src/traversal.h), do not edit.
+// On input pts[0] holds the kernel point, the point that is multiplied lives
+// in pts[npts] right above the npts stacked points.
+// The traversals of Alice include the initial 2-isogeny of the odd e2.
+
+#ifndef _TRAVERSAL_H
+#define _TRAVERSAL_H
+
+#include "sidh.h"
+
+static void traverse_Alice_kg(point_proj_t *pts, f2elm_t A24plus, f2elm_t C24, point_proj_t phiP, point_proj_t phiQ, point_proj_t phiR)
+{
+  f2elm_t coeff[3];
+  point_proj_t S;
+
+  xDBLe(pts[0], pts[1], A24plus, C24, 130);
+  xDBLe(pts[1], pts[2], A24plus, C24, 74);
+  xDBLe(pts[2], pts[3], A24plus, C24, 42);
+  xDBLe(pts[3], pts[4], A24plus, C24, 24);
+  xDBLe(pts[4], pts[5], A24plus, C24, 14);
+  xDBLe(pts[5], pts[6], A24plus, C24, 8);
+  xDBLe(pts[6], pts[7], A24plus, C24, 6);
+  xDBLe(pts[7], pts[8], A24plus, C24, 4);
+  xDBLe(pts[8], S, A24plus, C24, 2);
+  get_2_isog(S, A24plus, C24);
+  eval_2_isog(pts[0], S);
+  eval_2_isog(pts[1], S);
+  eval_2_isog(pts[2], S);
+  eval_2_isog(pts[3], S);
+  eval_2_isog(pts[4], S);
+  eval_2_isog(pts[5], S);
+  eval_2_isog(pts[6], S);
+  eval_2_isog(pts[7], S);
+  eval_2_isog(pts[8], S);
+  eval_2_isog(phiP, S);
+  eval_2_isog(phiQ, S);
+  eval_2_isog(phiR, S);
+  get_4_isog(pts[8], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 8, phiP, phiQ, phiR, coeff);
+
+  xDBLe(pts[7], pts[8], A24plus, C24, 2);
+  get_4_isog(pts[8], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 8, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[7], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 7, phiP, phiQ, phiR, coeff);
+
+  xDBLe(pts[6], pts[7], A24plus, C24, 2);
+  xDBLe(pts[7], pts[8], A24plus, C24, 2);
+  get_4_isog(pts[8], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 8, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[7], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 7, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[6], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 6, phiP, phiQ, phiR, coeff);
+
+  xDBLe(pts[5], pts[6], A24plus, C24, 4);
+  xDBLe(pts[6], pts[7], A24plus, C24, 2);
+  get_4_isog(pts[7], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 7, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[6], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 6, phiP, phiQ, phiR, coeff);
+
+  xDBLe(pts[5], pts[6], A24plus, C24, 2);
+  get_4_isog(pts[6], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 6, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[5], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 5, phiP, phiQ, phiR, coeff);
+
+  xDBLe(pts[4], pts[5], A24plus, C24, 6);
+  xDBLe(pts[5], pts[6], A24plus, C24, 4);
+  xDBLe(pts[6], pts[7], A24plus, C24, 2);
+  get_4_isog(pts[7], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 7, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[6], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 6, phiP, phiQ, phiR, coeff);
+
+  xDBLe(pts[5], pts[6], A24plus, C24, 2);
+  get_4_isog(pts[6], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 6, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[5], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 5, phiP, phiQ, phiR, coeff);
+
+  xDBLe(pts[4], pts[5], A24plus, C24, 2);
+  xDBLe(pts[5], pts[6], A24plus, C24, 2);
+  get_4_isog(pts[6], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 6, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[5], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 5, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[4], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 4, phiP, phiQ, phiR, coeff);
+
+  xDBLe(pts[3], pts[4], A24plus, C24, 10);
+  xDBLe(pts[4], pts[5], A24plus, C24, 6);
+  xDBLe(pts[5], pts[6], A24plus, C24, 4);
+  xDBLe(pts[6], pts[7], A24plus, C24, 2);
+  get_4_isog(pts[7], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 7, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[6], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 6, phiP, phiQ, phiR, coeff);
+
+  xDBLe(pts[5], pts[6], A24plus, C24, 2);
+  get_4_isog(pts[6], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 6, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[5], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 5, phiP, phiQ, phiR, coeff);
+
+  xDBLe(pts[4], pts[5], A24plus, C24, 2);
+  xDBLe(pts[5], pts[6], A24plus, C24, 2);
+  get_4_isog(pts[6], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 6, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[5], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 5, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[4], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 4, phiP, phiQ, phiR, coeff);
+
+  xDBLe(pts[3], pts[4], A24plus, C24, 4);
+  xDBLe(pts[4], pts[5], A24plus, C24, 2);
+  xDBLe(pts[5], pts[6], A24plus, C24, 2);
+  get_4_isog(pts[6], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 6, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[5], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 5, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[4], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 4, phiP, phiQ, phiR, coeff);
+
+  xDBLe(pts[3], pts[4], A24plus, C24, 2);
+  get_4_isog(pts[4], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 4, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[3], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 3, phiP, phiQ, phiR, coeff);
+
+  xDBLe(pts[2], pts[3], A24plus, C24, 18);
+  xDBLe(pts[3], pts[4], A24plus, C24, 10);
+  xDBLe(pts[4], pts[5], A24plus, C24, 6);
+  xDBLe(pts[5], pts[6], A24plus, C24, 4);
+  xDBLe(pts[6], pts[7], A24plus, C24, 2);
+  get_4_isog(pts[7], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 7, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[6], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 6, phiP, phiQ, phiR, coeff);
+
+  xDBLe(pts[5], pts[6], A24plus, C24, 2);
+  get_4_isog(pts[6], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 6, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[5], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 5, phiP, phiQ, phiR, coeff);
+
+  xDBLe(pts[4], pts[5], A24plus, C24, 2);
+  xDBLe(pts[5], pts[6], A24plus, C24, 2);
+  get_4_isog(pts[6], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 6, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[5], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 5, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[4], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 4, phiP, phiQ, phiR, coeff);
+
+  xDBLe(pts[3], pts[4], A24plus, C24, 4);
+  xDBLe(pts[4], pts[5], A24plus, C24, 2);
+  xDBLe(pts[5], pts[6], A24plus, C24, 2);
+  get_4_isog(pts[6], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 6, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[5], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 5, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[4], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 4, phiP, phiQ, phiR, coeff);
+
+  xDBLe(pts[3], pts[4], A24plus, C24, 2);
+  get_4_isog(pts[4], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 4, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[3], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 3, phiP, phiQ, phiR, coeff);
+
+  xDBLe(pts[2], pts[3], A24plus, C24, 8);
+  xDBLe(pts[3], pts[4], A24plus, C24, 4);
+  xDBLe(pts[4], pts[5], A24plus, C24, 2);
+  xDBLe(pts[5], pts[6], A24plus, C24, 2);
+  get_4_isog(pts[6], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 6, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[5], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 5, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[4], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 4, phiP, phiQ, phiR, coeff);
+
+  xDBLe(pts[3], pts[4], A24plus, C24, 2);
+  get_4_isog(pts[4], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 4, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[3], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 3, phiP, phiQ, phiR, coeff);
+
+  xDBLe(pts[2], pts[3], A24plus, C24, 4);
+  xDBLe(pts[3], pts[4], A24plus, C24, 2);
+  get_4_isog(pts[4], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 4, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[3], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 3, phiP, phiQ, phiR, coeff);
+
+  xDBLe(pts[2], pts[3], A24plus, C24, 2);
+  get_4_isog(pts[3], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 3, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[2], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 2, phiP, phiQ, phiR, coeff);
+
+  xDBLe(pts[1], pts[2], A24plus, C24, 32);
+  xDBLe(pts[2], pts[3], A24plus, C24, 18);
+  xDBLe(pts[3], pts[4], A24plus, C24, 10);
+  xDBLe(pts[4], pts[5], A24plus, C24, 6);
+  xDBLe(pts[5], pts[6], A24plus, C24, 4);
+  xDBLe(pts[6], pts[7], A24plus, C24, 2);
+  get_4_isog(pts[7], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 7, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[6], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 6, phiP, phiQ, phiR, coeff);
+
+  xDBLe(pts[5], pts[6], A24plus, C24, 2);
+  get_4_isog(pts[6], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 6, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[5], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 5, phiP, phiQ, phiR, coeff);
+
+  xDBLe(pts[4], pts[5], A24plus, C24, 2);
+  xDBLe(pts[5], pts[6], A24plus, C24, 2);
+  get_4_isog(pts[6], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 6, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[5], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 5, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[4], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 4, phiP, phiQ, phiR, coeff);
+
+  xDBLe(pts[3], pts[4], A24plus, C24, 4);
+  xDBLe(pts[4], pts[5], A24plus, C24, 2);
+  xDBLe(pts[5], pts[6], A24plus, C24, 2);
+  get_4_isog(pts[6], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 6, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[5], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 5, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[4], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 4, phiP, phiQ, phiR, coeff);
+
+  xDBLe(pts[3], pts[4], A24plus, C24, 2);
+  get_4_isog(pts[4], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 4, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[3], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 3, phiP, phiQ, phiR, coeff);
+
+  xDBLe(pts[2], pts[3], A24plus, C24, 8);
+  xDBLe(pts[3], pts[4], A24plus, C24, 4);
+  xDBLe(pts[4], pts[5], A24plus, C24, 2);
+  xDBLe(pts[5], pts[6], A24plus, C24, 2);
+  get_4_isog(pts[6], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 6, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[5], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 5, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[4], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 4, phiP, phiQ, phiR, coeff);
+
+  xDBLe(pts[3], pts[4], A24plus, C24, 2);
+  get_4_isog(pts[4], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 4, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[3], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 3, phiP, phiQ, phiR, coeff);
+
+  xDBLe(pts[2], pts[3], A24plus, C24, 4);
+  xDBLe(pts[3], pts[4], A24plus, C24, 2);
+  get_4_isog(pts[4], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 4, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[3], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 3, phiP, phiQ, phiR, coeff);
+
+  xDBLe(pts[2], pts[3], A24plus, C24, 2);
+  get_4_isog(pts[3], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 3, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[2], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 2, phiP, phiQ, phiR, coeff);
+
+  xDBLe(pts[1], pts[2], A24plus, C24, 14);
+  xDBLe(pts[2], pts[3], A24plus, C24, 8);
+  xDBLe(pts[3], pts[4], A24plus, C24, 4);
+  xDBLe(pts[4], pts[5], A24plus, C24, 2);
+  xDBLe(pts[5], pts[6], A24plus, C24, 2);
+  get_4_isog(pts[6], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 6, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[5], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 5, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[4], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 4, phiP, phiQ, phiR, coeff);
+
+  xDBLe(pts[3], pts[4], A24plus, C24, 2);
+  get_4_isog(pts[4], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 4, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[3], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 3, phiP, phiQ, phiR, coeff);
+
+  xDBLe(pts[2], pts[3], A24plus, C24, 4);
+  xDBLe(pts[3], pts[4], A24plus, C24, 2);
+  get_4_isog(pts[4], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 4, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[3], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 3, phiP, phiQ, phiR, coeff);
+
+  xDBLe(pts[2], pts[3], A24plus, C24, 2);
+  get_4_isog(pts[3], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 3, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[2], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 2, phiP, phiQ, phiR, coeff);
+
+  xDBLe(pts[1], pts[2], A24plus, C24, 6);
+  xDBLe(pts[2], pts[3], A24plus, C24, 4);
+  xDBLe(pts[3], pts[4], A24plus, C24, 2);
+  get_4_isog(pts[4], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 4, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[3], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 3, phiP, phiQ, phiR, coeff);
+
+  xDBLe(pts[2], pts[3], A24plus, C24, 2);
+  get_4_isog(pts[3], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 3, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[2], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 2, phiP, phiQ, phiR, coeff);
+
+  xDBLe(pts[1], pts[2], A24plus, C24, 2);
+  xDBLe(pts[2], pts[3], A24plus, C24, 2);
+  get_4_isog(pts[3], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 3, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[2], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 2, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[1], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 1, phiP, phiQ, phiR, coeff);
+
+  xDBLe(pts[0], pts[1], A24plus, C24, 56);
+  xDBLe(pts[1], pts[2], A24plus, C24, 32);
+  xDBLe(pts[2], pts[3], A24plus, C24, 18);
+  xDBLe(pts[3], pts[4], A24plus, C24, 10);
+  xDBLe(pts[4], pts[5], A24plus, C24, 6);
+  xDBLe(pts[5], pts[6], A24plus, C24, 4);
+  xDBLe(pts[6], pts[7], A24plus, C24, 2);
+  get_4_isog(pts[7], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 7, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[6], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 6, phiP, phiQ, phiR, coeff);
+
+  xDBLe(pts[5], pts[6], A24plus, C24, 2);
+  get_4_isog(pts[6], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 6, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[5], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 5, phiP, phiQ, phiR, coeff);
+
+  xDBLe(pts[4], pts[5], A24plus, C24, 2);
+  xDBLe(pts[5], pts[6], A24plus, C24, 2);
+  get_4_isog(pts[6], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 6, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[5], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 5, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[4], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 4, phiP, phiQ, phiR, coeff);
+
+  xDBLe(pts[3], pts[4], A24plus, C24, 4);
+  xDBLe(pts[4], pts[5], A24plus, C24, 2);
+  xDBLe(pts[5], pts[6], A24plus, C24, 2);
+  get_4_isog(pts[6], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 6, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[5], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 5, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[4], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 4, phiP, phiQ, phiR, coeff);
+
+  xDBLe(pts[3], pts[4], A24plus, C24, 2);
+  get_4_isog(pts[4], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 4, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[3], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 3, phiP, phiQ, phiR, coeff);
+
+  xDBLe(pts[2], pts[3], A24plus, C24, 8);
+  xDBLe(pts[3], pts[4], A24plus, C24, 4);
+  xDBLe(pts[4], pts[5], A24plus, C24, 2);
+  xDBLe(pts[5], pts[6], A24plus, C24, 2);
+  get_4_isog(pts[6], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 6, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[5], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 5, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[4], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 4, phiP, phiQ, phiR, coeff);
+
+  xDBLe(pts[3], pts[4], A24plus, C24, 2);
+  get_4_isog(pts[4], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 4, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[3], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 3, phiP, phiQ, phiR, coeff);
+
+  xDBLe(pts[2], pts[3], A24plus, C24, 4);
+  xDBLe(pts[3], pts[4], A24plus, C24, 2);
+  get_4_isog(pts[4], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 4, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[3], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 3, phiP, phiQ, phiR, coeff);
+
+  xDBLe(pts[2], pts[3], A24plus, C24, 2);
+  get_4_isog(pts[3], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 3, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[2], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 2, phiP, phiQ, phiR, coeff);
+
+  xDBLe(pts[1], pts[2], A24plus, C24, 14);
+  xDBLe(pts[2], pts[3], A24plus, C24, 8);
+  xDBLe(pts[3], pts[4], A24plus, C24, 4);
+  xDBLe(pts[4], pts[5], A24plus, C24, 2);
+  xDBLe(pts[5], pts[6], A24plus, C24, 2);
+  get_4_isog(pts[6], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 6, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[5], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 5, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[4], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 4, phiP, phiQ, phiR, coeff);
+
+  xDBLe(pts[3], pts[4], A24plus, C24, 2);
+  get_4_isog(pts[4], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 4, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[3], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 3, phiP, phiQ, phiR, coeff);
+
+  xDBLe(pts[2], pts[3], A24plus, C24, 4);
+  xDBLe(pts[3], pts[4], A24plus, C24, 2);
+  get_4_isog(pts[4], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 4, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[3], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 3, phiP, phiQ, phiR, coeff);
+
+  xDBLe(pts[2], pts[3], A24plus, C24, 2);
+  get_4_isog(pts[3], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 3, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[2], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 2, phiP, phiQ, phiR, coeff);
+
+  xDBLe(pts[1], pts[2], A24plus, C24, 6);
+  xDBLe(pts[2], pts[3], A24plus, C24, 4);
+  xDBLe(pts[3], pts[4], A24plus, C24, 2);
+  get_4_isog(pts[4], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 4, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[3], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 3, phiP, phiQ, phiR, coeff);
+
+  xDBLe(pts[2], pts[3], A24plus, C24, 2);
+  get_4_isog(pts[3], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 3, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[2], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 2, phiP, phiQ, phiR, coeff);
+
+  xDBLe(pts[1], pts[2], A24plus, C24, 2);
+  xDBLe(pts[2], pts[3], A24plus, C24, 2);
+  get_4_isog(pts[3], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 3, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[2], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 2, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[1], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 1, phiP, phiQ, phiR, coeff);
+
+  xDBLe(pts[0], pts[1], A24plus, C24, 24);
+  xDBLe(pts[1], pts[2], A24plus, C24, 14);
+  xDBLe(pts[2], pts[3], A24plus, C24, 8);
+  xDBLe(pts[3], pts[4], A24plus, C24, 4);
+  xDBLe(pts[4], pts[5], A24plus, C24, 2);
+  xDBLe(pts[5], pts[6], A24plus, C24, 2);
+  get_4_isog(pts[6], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 6, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[5], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 5, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[4], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 4, phiP, phiQ, phiR, coeff);
+
+  xDBLe(pts[3], pts[4], A24plus, C24, 2);
+  get_4_isog(pts[4], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 4, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[3], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 3, phiP, phiQ, phiR, coeff);
+
+  xDBLe(pts[2], pts[3], A24plus, C24, 4);
+  xDBLe(pts[3], pts[4], A24plus, C24, 2);
+  get_4_isog(pts[4], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 4, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[3], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 3, phiP, phiQ, phiR, coeff);
+
+  xDBLe(pts[2], pts[3], A24plus, C24, 2);
+  get_4_isog(pts[3], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 3, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[2], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 2, phiP, phiQ, phiR, coeff);
+
+  xDBLe(pts[1], pts[2], A24plus, C24, 6);
+  xDBLe(pts[2], pts[3], A24plus, C24, 4);
+  xDBLe(pts[3], pts[4], A24plus, C24, 2);
+  get_4_isog(pts[4], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 4, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[3], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 3, phiP, phiQ, phiR, coeff);
+
+  xDBLe(pts[2], pts[3], A24plus, C24, 2);
+  get_4_isog(pts[3], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 3, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[2], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 2, phiP, phiQ, phiR, coeff);
+
+  xDBLe(pts[1], pts[2], A24plus, C24, 2);
+  xDBLe(pts[2], pts[3], A24plus, C24, 2);
+  get_4_isog(pts[3], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 3, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[2], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 2, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[1], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 1, phiP, phiQ, phiR, coeff);
+
+  xDBLe(pts[0], pts[1], A24plus, C24, 10);
+  xDBLe(pts[1], pts[2], A24plus, C24, 6);
+  xDBLe(pts[2], pts[3], A24plus, C24, 4);
+  xDBLe(pts[3], pts[4], A24plus, C24, 2);
+  get_4_isog(pts[4], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 4, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[3], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 3, phiP, phiQ, phiR, coeff);
+
+  xDBLe(pts[2], pts[3], A24plus, C24, 2);
+  get_4_isog(pts[3], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 3, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[2], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 2, phiP, phiQ, phiR, coeff);
+
+  xDBLe(pts[1], pts[2], A24plus, C24, 2);
+  xDBLe(pts[2], pts[3], A24plus, C24, 2);
+  get_4_isog(pts[3], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 3, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[2], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 2, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[1], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 1, phiP, phiQ, phiR, coeff);
+
+  xDBLe(pts[0], pts[1], A24plus, C24, 4);
+  xDBLe(pts[1], pts[2], A24plus, C24, 2);
+  xDBLe(pts[2], pts[3], A24plus, C24, 2);
+  get_4_isog(pts[3], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 3, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[2], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 2, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[1], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 1, phiP, phiQ, phiR, coeff);
+
+  xDBLe(pts[0], pts[1], A24plus, C24, 2);
+  get_4_isog(pts[1], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 1, phiP, phiQ, phiR, coeff);
+
+  get_4_isog(pts[0], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 0, phiP, phiQ, phiR, coeff);
+}
+
+static void traverse_Alice_ss(point_proj_t *pts, f2elm_t A24plus, f2elm_t C24)
+{
+  f2elm_t coeff[3];
+  point_proj_t S;
+
+  xDBLe(pts[0], pts[1], A24plus, C24, 130);
+  xDBLe(pts[1], pts[2], A24plus, C24, 74);
+  xDBLe(pts[2], pts[3], A24plus, C24, 42);
+  xDBLe(pts[3], pts[4], A24plus, C24, 24);
+  xDBLe(pts[4], pts[5], A24plus, C24, 14);
+  xDBLe(pts[5], pts[6], A24plus, C24, 8);
+  xDBLe(pts[6], pts[7], A24plus, C24, 6);
+  xDBLe(pts[7], pts[8], A24plus, C24, 4);
+  xDBLe(pts[8], S, A24plus, C24, 2);
+  get_2_isog(S, A24plus, C24);
+  eval_2_isog(pts[0], S);
+  eval_2_isog(pts[1], S);
+  eval_2_isog(pts[2], S);
+  eval_2_isog(pts[3], S);
+  eval_2_isog(pts[4], S);
+  eval_2_isog(pts[5], S);
+  eval_2_isog(pts[6], S);
+  eval_2_isog(pts[7], S);
+  eval_2_isog(pts[8], S);
+  get_4_isog(pts[8], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 8, NULL, NULL, NULL, coeff);
+
+  xDBLe(pts[7], pts[8], A24plus, C24, 2);
+  get_4_isog(pts[8], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 8, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[7], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 7, NULL, NULL, NULL, coeff);
+
+  xDBLe(pts[6], pts[7], A24plus, C24, 2);
+  xDBLe(pts[7], pts[8], A24plus, C24, 2);
+  get_4_isog(pts[8], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 8, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[7], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 7, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[6], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 6, NULL, NULL, NULL, coeff);
+
+  xDBLe(pts[5], pts[6], A24plus, C24, 4);
+  xDBLe(pts[6], pts[7], A24plus, C24, 2);
+  get_4_isog(pts[7], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 7, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[6], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 6, NULL, NULL, NULL, coeff);
+
+  xDBLe(pts[5], pts[6], A24plus, C24, 2);
+  get_4_isog(pts[6], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 6, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[5], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 5, NULL, NULL, NULL, coeff);
+
+  xDBLe(pts[4], pts[5], A24plus, C24, 6);
+  xDBLe(pts[5], pts[6], A24plus, C24, 4);
+  xDBLe(pts[6], pts[7], A24plus, C24, 2);
+  get_4_isog(pts[7], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 7, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[6], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 6, NULL, NULL, NULL, coeff);
+
+  xDBLe(pts[5], pts[6], A24plus, C24, 2);
+  get_4_isog(pts[6], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 6, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[5], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 5, NULL, NULL, NULL, coeff);
+
+  xDBLe(pts[4], pts[5], A24plus, C24, 2);
+  xDBLe(pts[5], pts[6], A24plus, C24, 2);
+  get_4_isog(pts[6], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 6, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[5], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 5, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[4], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 4, NULL, NULL, NULL, coeff);
+
+  xDBLe(pts[3], pts[4], A24plus, C24, 10);
+  xDBLe(pts[4], pts[5], A24plus, C24, 6);
+  xDBLe(pts[5], pts[6], A24plus, C24, 4);
+  xDBLe(pts[6], pts[7], A24plus, C24, 2);
+  get_4_isog(pts[7], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 7, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[6], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 6, NULL, NULL, NULL, coeff);
+
+  xDBLe(pts[5], pts[6], A24plus, C24, 2);
+  get_4_isog(pts[6], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 6, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[5], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 5, NULL, NULL, NULL, coeff);
+
+  xDBLe(pts[4], pts[5], A24plus, C24, 2);
+  xDBLe(pts[5], pts[6], A24plus, C24, 2);
+  get_4_isog(pts[6], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 6, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[5], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 5, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[4], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 4, NULL, NULL, NULL, coeff);
+
+  xDBLe(pts[3], pts[4], A24plus, C24, 4);
+  xDBLe(pts[4], pts[5], A24plus, C24, 2);
+  xDBLe(pts[5], pts[6], A24plus, C24, 2);
+  get_4_isog(pts[6], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 6, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[5], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 5, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[4], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 4, NULL, NULL, NULL, coeff);
+
+  xDBLe(pts[3], pts[4], A24plus, C24, 2);
+  get_4_isog(pts[4], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 4, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[3], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 3, NULL, NULL, NULL, coeff);
+
+  xDBLe(pts[2], pts[3], A24plus, C24, 18);
+  xDBLe(pts[3], pts[4], A24plus, C24, 10);
+  xDBLe(pts[4], pts[5], A24plus, C24, 6);
+  xDBLe(pts[5], pts[6], A24plus, C24, 4);
+  xDBLe(pts[6], pts[7], A24plus, C24, 2);
+  get_4_isog(pts[7], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 7, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[6], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 6, NULL, NULL, NULL, coeff);
+
+  xDBLe(pts[5], pts[6], A24plus, C24, 2);
+  get_4_isog(pts[6], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 6, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[5], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 5, NULL, NULL, NULL, coeff);
+
+  xDBLe(pts[4], pts[5], A24plus, C24, 2);
+  xDBLe(pts[5], pts[6], A24plus, C24, 2);
+  get_4_isog(pts[6], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 6, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[5], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 5, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[4], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 4, NULL, NULL, NULL, coeff);
+
+  xDBLe(pts[3], pts[4], A24plus, C24, 4);
+  xDBLe(pts[4], pts[5], A24plus, C24, 2);
+  xDBLe(pts[5], pts[6], A24plus, C24, 2);
+  get_4_isog(pts[6], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 6, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[5], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 5, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[4], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 4, NULL, NULL, NULL, coeff);
+
+  xDBLe(pts[3], pts[4], A24plus, C24, 2);
+  get_4_isog(pts[4], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 4, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[3], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 3, NULL, NULL, NULL, coeff);
+
+  xDBLe(pts[2], pts[3], A24plus, C24, 8);
+  xDBLe(pts[3], pts[4], A24plus, C24, 4);
+  xDBLe(pts[4], pts[5], A24plus, C24, 2);
+  xDBLe(pts[5], pts[6], A24plus, C24, 2);
+  get_4_isog(pts[6], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 6, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[5], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 5, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[4], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 4, NULL, NULL, NULL, coeff);
+
+  xDBLe(pts[3], pts[4], A24plus, C24, 2);
+  get_4_isog(pts[4], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 4, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[3], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 3, NULL, NULL, NULL, coeff);
+
+  xDBLe(pts[2], pts[3], A24plus, C24, 4);
+  xDBLe(pts[3], pts[4], A24plus, C24, 2);
+  get_4_isog(pts[4], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 4, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[3], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 3, NULL, NULL, NULL, coeff);
+
+  xDBLe(pts[2], pts[3], A24plus, C24, 2);
+  get_4_isog(pts[3], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 3, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[2], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 2, NULL, NULL, NULL, coeff);
+
+  xDBLe(pts[1], pts[2], A24plus, C24, 32);
+  xDBLe(pts[2], pts[3], A24plus, C24, 18);
+  xDBLe(pts[3], pts[4], A24plus, C24, 10);
+  xDBLe(pts[4], pts[5], A24plus, C24, 6);
+  xDBLe(pts[5], pts[6], A24plus, C24, 4);
+  xDBLe(pts[6], pts[7], A24plus, C24, 2);
+  get_4_isog(pts[7], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 7, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[6], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 6, NULL, NULL, NULL, coeff);
+
+  xDBLe(pts[5], pts[6], A24plus, C24, 2);
+  get_4_isog(pts[6], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 6, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[5], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 5, NULL, NULL, NULL, coeff);
+
+  xDBLe(pts[4], pts[5], A24plus, C24, 2);
+  xDBLe(pts[5], pts[6], A24plus, C24, 2);
+  get_4_isog(pts[6], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 6, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[5], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 5, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[4], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 4, NULL, NULL, NULL, coeff);
+
+  xDBLe(pts[3], pts[4], A24plus, C24, 4);
+  xDBLe(pts[4], pts[5], A24plus, C24, 2);
+  xDBLe(pts[5], pts[6], A24plus, C24, 2);
+  get_4_isog(pts[6], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 6, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[5], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 5, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[4], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 4, NULL, NULL, NULL, coeff);
+
+  xDBLe(pts[3], pts[4], A24plus, C24, 2);
+  get_4_isog(pts[4], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 4, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[3], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 3, NULL, NULL, NULL, coeff);
+
+  xDBLe(pts[2], pts[3], A24plus, C24, 8);
+  xDBLe(pts[3], pts[4], A24plus, C24, 4);
+  xDBLe(pts[4], pts[5], A24plus, C24, 2);
+  xDBLe(pts[5], pts[6], A24plus, C24, 2);
+  get_4_isog(pts[6], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 6, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[5], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 5, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[4], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 4, NULL, NULL, NULL, coeff);
+
+  xDBLe(pts[3], pts[4], A24plus, C24, 2);
+  get_4_isog(pts[4], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 4, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[3], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 3, NULL, NULL, NULL, coeff);
+
+  xDBLe(pts[2], pts[3], A24plus, C24, 4);
+  xDBLe(pts[3], pts[4], A24plus, C24, 2);
+  get_4_isog(pts[4], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 4, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[3], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 3, NULL, NULL, NULL, coeff);
+
+  xDBLe(pts[2], pts[3], A24plus, C24, 2);
+  get_4_isog(pts[3], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 3, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[2], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 2, NULL, NULL, NULL, coeff);
+
+  xDBLe(pts[1], pts[2], A24plus, C24, 14);
+  xDBLe(pts[2], pts[3], A24plus, C24, 8);
+  xDBLe(pts[3], pts[4], A24plus, C24, 4);
+  xDBLe(pts[4], pts[5], A24plus, C24, 2);
+  xDBLe(pts[5], pts[6], A24plus, C24, 2);
+  get_4_isog(pts[6], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 6, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[5], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 5, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[4], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 4, NULL, NULL, NULL, coeff);
+
+  xDBLe(pts[3], pts[4], A24plus, C24, 2);
+  get_4_isog(pts[4], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 4, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[3], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 3, NULL, NULL, NULL, coeff);
+
+  xDBLe(pts[2], pts[3], A24plus, C24, 4);
+  xDBLe(pts[3], pts[4], A24plus, C24, 2);
+  get_4_isog(pts[4], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 4, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[3], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 3, NULL, NULL, NULL, coeff);
+
+  xDBLe(pts[2], pts[3], A24plus, C24, 2);
+  get_4_isog(pts[3], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 3, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[2], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 2, NULL, NULL, NULL, coeff);
+
+  xDBLe(pts[1], pts[2], A24plus, C24, 6);
+  xDBLe(pts[2], pts[3], A24plus, C24, 4);
+  xDBLe(pts[3], pts[4], A24plus, C24, 2);
+  get_4_isog(pts[4], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 4, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[3], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 3, NULL, NULL, NULL, coeff);
+
+  xDBLe(pts[2], pts[3], A24plus, C24, 2);
+  get_4_isog(pts[3], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 3, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[2], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 2, NULL, NULL, NULL, coeff);
+
+  xDBLe(pts[1], pts[2], A24plus, C24, 2);
+  xDBLe(pts[2], pts[3], A24plus, C24, 2);
+  get_4_isog(pts[3], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 3, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[2], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 2, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[1], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 1, NULL, NULL, NULL, coeff);
+
+  xDBLe(pts[0], pts[1], A24plus, C24, 56);
+  xDBLe(pts[1], pts[2], A24plus, C24, 32);
+  xDBLe(pts[2], pts[3], A24plus, C24, 18);
+  xDBLe(pts[3], pts[4], A24plus, C24, 10);
+  xDBLe(pts[4], pts[5], A24plus, C24, 6);
+  xDBLe(pts[5], pts[6], A24plus, C24, 4);
+  xDBLe(pts[6], pts[7], A24plus, C24, 2);
+  get_4_isog(pts[7], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 7, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[6], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 6, NULL, NULL, NULL, coeff);
+
+  xDBLe(pts[5], pts[6], A24plus, C24, 2);
+  get_4_isog(pts[6], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 6, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[5], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 5, NULL, NULL, NULL, coeff);
+
+  xDBLe(pts[4], pts[5], A24plus, C24, 2);
+  xDBLe(pts[5], pts[6], A24plus, C24, 2);
+  get_4_isog(pts[6], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 6, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[5], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 5, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[4], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 4, NULL, NULL, NULL, coeff);
+
+  xDBLe(pts[3], pts[4], A24plus, C24, 4);
+  xDBLe(pts[4], pts[5], A24plus, C24, 2);
+  xDBLe(pts[5], pts[6], A24plus, C24, 2);
+  get_4_isog(pts[6], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 6, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[5], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 5, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[4], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 4, NULL, NULL, NULL, coeff);
+
+  xDBLe(pts[3], pts[4], A24plus, C24, 2);
+  get_4_isog(pts[4], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 4, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[3], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 3, NULL, NULL, NULL, coeff);
+
+  xDBLe(pts[2], pts[3], A24plus, C24, 8);
+  xDBLe(pts[3], pts[4], A24plus, C24, 4);
+  xDBLe(pts[4], pts[5], A24plus, C24, 2);
+  xDBLe(pts[5], pts[6], A24plus, C24, 2);
+  get_4_isog(pts[6], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 6, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[5], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 5, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[4], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 4, NULL, NULL, NULL, coeff);
+
+  xDBLe(pts[3], pts[4], A24plus, C24, 2);
+  get_4_isog(pts[4], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 4, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[3], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 3, NULL, NULL, NULL, coeff);
+
+  xDBLe(pts[2], pts[3], A24plus, C24, 4);
+  xDBLe(pts[3], pts[4], A24plus, C24, 2);
+  get_4_isog(pts[4], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 4, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[3], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 3, NULL, NULL, NULL, coeff);
+
+  xDBLe(pts[2], pts[3], A24plus, C24, 2);
+  get_4_isog(pts[3], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 3, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[2], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 2, NULL, NULL, NULL, coeff);
+
+  xDBLe(pts[1], pts[2], A24plus, C24, 14);
+  xDBLe(pts[2], pts[3], A24plus, C24, 8);
+  xDBLe(pts[3], pts[4], A24plus, C24, 4);
+  xDBLe(pts[4], pts[5], A24plus, C24, 2);
+  xDBLe(pts[5], pts[6], A24plus, C24, 2);
+  get_4_isog(pts[6], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 6, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[5], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 5, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[4], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 4, NULL, NULL, NULL, coeff);
+
+  xDBLe(pts[3], pts[4], A24plus, C24, 2);
+  get_4_isog(pts[4], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 4, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[3], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 3, NULL, NULL, NULL, coeff);
+
+  xDBLe(pts[2], pts[3], A24plus, C24, 4);
+  xDBLe(pts[3], pts[4], A24plus, C24, 2);
+  get_4_isog(pts[4], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 4, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[3], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 3, NULL, NULL, NULL, coeff);
+
+  xDBLe(pts[2], pts[3], A24plus, C24, 2);
+  get_4_isog(pts[3], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 3, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[2], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 2, NULL, NULL, NULL, coeff);
+
+  xDBLe(pts[1], pts[2], A24plus, C24, 6);
+  xDBLe(pts[2], pts[3], A24plus, C24, 4);
+  xDBLe(pts[3], pts[4], A24plus, C24, 2);
+  get_4_isog(pts[4], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 4, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[3], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 3, NULL, NULL, NULL, coeff);
+
+  xDBLe(pts[2], pts[3], A24plus, C24, 2);
+  get_4_isog(pts[3], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 3, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[2], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 2, NULL, NULL, NULL, coeff);
+
+  xDBLe(pts[1], pts[2], A24plus, C24, 2);
+  xDBLe(pts[2], pts[3], A24plus, C24, 2);
+  get_4_isog(pts[3], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 3, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[2], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 2, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[1], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 1, NULL, NULL, NULL, coeff);
+
+  xDBLe(pts[0], pts[1], A24plus, C24, 24);
+  xDBLe(pts[1], pts[2], A24plus, C24, 14);
+  xDBLe(pts[2], pts[3], A24plus, C24, 8);
+  xDBLe(pts[3], pts[4], A24plus, C24, 4);
+  xDBLe(pts[4], pts[5], A24plus, C24, 2);
+  xDBLe(pts[5], pts[6], A24plus, C24, 2);
+  get_4_isog(pts[6], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 6, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[5], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 5, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[4], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 4, NULL, NULL, NULL, coeff);
+
+  xDBLe(pts[3], pts[4], A24plus, C24, 2);
+  get_4_isog(pts[4], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 4, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[3], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 3, NULL, NULL, NULL, coeff);
+
+  xDBLe(pts[2], pts[3], A24plus, C24, 4);
+  xDBLe(pts[3], pts[4], A24plus, C24, 2);
+  get_4_isog(pts[4], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 4, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[3], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 3, NULL, NULL, NULL, coeff);
+
+  xDBLe(pts[2], pts[3], A24plus, C24, 2);
+  get_4_isog(pts[3], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 3, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[2], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 2, NULL, NULL, NULL, coeff);
+
+  xDBLe(pts[1], pts[2], A24plus, C24, 6);
+  xDBLe(pts[2], pts[3], A24plus, C24, 4);
+  xDBLe(pts[3], pts[4], A24plus, C24, 2);
+  get_4_isog(pts[4], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 4, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[3], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 3, NULL, NULL, NULL, coeff);
+
+  xDBLe(pts[2], pts[3], A24plus, C24, 2);
+  get_4_isog(pts[3], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 3, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[2], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 2, NULL, NULL, NULL, coeff);
+
+  xDBLe(pts[1], pts[2], A24plus, C24, 2);
+  xDBLe(pts[2], pts[3], A24plus, C24, 2);
+  get_4_isog(pts[3], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 3, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[2], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 2, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[1], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 1, NULL, NULL, NULL, coeff);
+
+  xDBLe(pts[0], pts[1], A24plus, C24, 10);
+  xDBLe(pts[1], pts[2], A24plus, C24, 6);
+  xDBLe(pts[2], pts[3], A24plus, C24, 4);
+  xDBLe(pts[3], pts[4], A24plus, C24, 2);
+  get_4_isog(pts[4], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 4, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[3], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 3, NULL, NULL, NULL, coeff);
+
+  xDBLe(pts[2], pts[3], A24plus, C24, 2);
+  get_4_isog(pts[3], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 3, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[2], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 2, NULL, NULL, NULL, coeff);
+
+  xDBLe(pts[1], pts[2], A24plus, C24, 2);
+  xDBLe(pts[2], pts[3], A24plus, C24, 2);
+  get_4_isog(pts[3], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 3, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[2], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 2, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[1], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 1, NULL, NULL, NULL, coeff);
+
+  xDBLe(pts[0], pts[1], A24plus, C24, 4);
+  xDBLe(pts[1], pts[2], A24plus, C24, 2);
+  xDBLe(pts[2], pts[3], A24plus, C24, 2);
+  get_4_isog(pts[3], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 3, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[2], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 2, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[1], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 1, NULL, NULL, NULL, coeff);
+
+  xDBLe(pts[0], pts[1], A24plus, C24, 2);
+  get_4_isog(pts[1], A24plus, C24, coeff);
+  eval_4_isog_multi(pts, 1, NULL, NULL, NULL, coeff);
+
+  get_4_isog(pts[0], A24plus, C24, coeff);
+}
+
+static void traverse_Bob_kg(point_proj_t *pts, f2elm_t A24minus, f2elm_t A24plus, point_proj_t phiP, point_proj_t phiQ, point_proj_t phiR)
+{
+  f2elm_t coeff[3];
+
+  xTPLe(pts[0], pts[1], A24minus, A24plus, 63);
+  xTPLe(pts[1], pts[2], A24minus, A24plus, 42);
+  xTPLe(pts[2], pts[3], A24minus, A24plus, 33);
+  xTPLe(pts[3], pts[4], A24minus, A24plus, 21);
+  xTPLe(pts[4], pts[5], A24minus, A24plus, 13);
+  xTPLe(pts[5], pts[6], A24minus, A24plus, 8);
+  xTPLe(pts[6], pts[7], A24minus, A24plus, 5);
+  xTPLe(pts[7], pts[8], A24minus, A24plus, 3);
+  xTPLe(pts[8], pts[9], A24minus, A24plus, 2);
+  xTPLe(pts[9], pts[10], A24minus, A24plus, 1);
+  get_3_isog(pts[10], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 10, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[9], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 9, phiP, phiQ, phiR, coeff);
+
+  xTPLe(pts[8], pts[9], A24minus, A24plus, 1);
+  get_3_isog(pts[9], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 9, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[8], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 8, phiP, phiQ, phiR, coeff);
+
+  xTPLe(pts[7], pts[8], A24minus, A24plus, 1);
+  xTPLe(pts[8], pts[9], A24minus, A24plus, 1);
+  get_3_isog(pts[9], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 9, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[8], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 8, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[7], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 7, phiP, phiQ, phiR, coeff);
+
+  xTPLe(pts[6], pts[7], A24minus, A24plus, 2);
+  xTPLe(pts[7], pts[8], A24minus, A24plus, 1);
+  xTPLe(pts[8], pts[9], A24minus, A24plus, 1);
+  get_3_isog(pts[9], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 9, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[8], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 8, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[7], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 7, phiP, phiQ, phiR, coeff);
+
+  xTPLe(pts[6], pts[7], A24minus, A24plus, 1);
+  get_3_isog(pts[7], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 7, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[6], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 6, phiP, phiQ, phiR, coeff);
+
+  xTPLe(pts[5], pts[6], A24minus, A24plus, 3);
+  xTPLe(pts[6], pts[7], A24minus, A24plus, 2);
+  xTPLe(pts[7], pts[8], A24minus, A24plus, 1);
+  xTPLe(pts[8], pts[9], A24minus, A24plus, 1);
+  get_3_isog(pts[9], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 9, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[8], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 8, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[7], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 7, phiP, phiQ, phiR, coeff);
+
+  xTPLe(pts[6], pts[7], A24minus, A24plus, 1);
+  get_3_isog(pts[7], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 7, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[6], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 6, phiP, phiQ, phiR, coeff);
+
+  xTPLe(pts[5], pts[6], A24minus, A24plus, 1);
+  xTPLe(pts[6], pts[7], A24minus, A24plus, 1);
+  get_3_isog(pts[7], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 7, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[6], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 6, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[5], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 5, phiP, phiQ, phiR, coeff);
+
+  xTPLe(pts[4], pts[5], A24minus, A24plus, 5);
+  xTPLe(pts[5], pts[6], A24minus, A24plus, 3);
+  xTPLe(pts[6], pts[7], A24minus, A24plus, 2);
+  xTPLe(pts[7], pts[8], A24minus, A24plus, 1);
+  xTPLe(pts[8], pts[9], A24minus, A24plus, 1);
+  get_3_isog(pts[9], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 9, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[8], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 8, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[7], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 7, phiP, phiQ, phiR, coeff);
+
+  xTPLe(pts[6], pts[7], A24minus, A24plus, 1);
+  get_3_isog(pts[7], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 7, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[6], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 6, phiP, phiQ, phiR, coeff);
+
+  xTPLe(pts[5], pts[6], A24minus, A24plus, 1);
+  xTPLe(pts[6], pts[7], A24minus, A24plus, 1);
+  get_3_isog(pts[7], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 7, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[6], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 6, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[5], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 5, phiP, phiQ, phiR, coeff);
+
+  xTPLe(pts[4], pts[5], A24minus, A24plus, 2);
+  xTPLe(pts[5], pts[6], A24minus, A24plus, 1);
+  xTPLe(pts[6], pts[7], A24minus, A24plus, 1);
+  get_3_isog(pts[7], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 7, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[6], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 6, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[5], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 5, phiP, phiQ, phiR, coeff);
+
+  xTPLe(pts[4], pts[5], A24minus, A24plus, 1);
+  get_3_isog(pts[5], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 5, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[4], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 4, phiP, phiQ, phiR, coeff);
+
+  xTPLe(pts[3], pts[4], A24minus, A24plus, 8);
+  xTPLe(pts[4], pts[5], A24minus, A24plus, 5);
+  xTPLe(pts[5], pts[6], A24minus, A24plus, 3);
+  xTPLe(pts[6], pts[7], A24minus, A24plus, 2);
+  xTPLe(pts[7], pts[8], A24minus, A24plus, 1);
+  xTPLe(pts[8], pts[9], A24minus, A24plus, 1);
+  get_3_isog(pts[9], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 9, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[8], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 8, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[7], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 7, phiP, phiQ, phiR, coeff);
+
+  xTPLe(pts[6], pts[7], A24minus, A24plus, 1);
+  get_3_isog(pts[7], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 7, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[6], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 6, phiP, phiQ, phiR, coeff);
+
+  xTPLe(pts[5], pts[6], A24minus, A24plus, 1);
+  xTPLe(pts[6], pts[7], A24minus, A24plus, 1);
+  get_3_isog(pts[7], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 7, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[6], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 6, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[5], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 5, phiP, phiQ, phiR, coeff);
+
+  xTPLe(pts[4], pts[5], A24minus, A24plus, 2);
+  xTPLe(pts[5], pts[6], A24minus, A24plus, 1);
+  xTPLe(pts[6], pts[7], A24minus, A24plus, 1);
+  get_3_isog(pts[7], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 7, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[6], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 6, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[5], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 5, phiP, phiQ, phiR, coeff);
+
+  xTPLe(pts[4], pts[5], A24minus, A24plus, 1);
+  get_3_isog(pts[5], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 5, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[4], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 4, phiP, phiQ, phiR, coeff);
+
+  xTPLe(pts[3], pts[4], A24minus, A24plus, 3);
+  xTPLe(pts[4], pts[5], A24minus, A24plus, 2);
+  xTPLe(pts[5], pts[6], A24minus, A24plus, 1);
+  xTPLe(pts[6], pts[7], A24minus, A24plus, 1);
+  get_3_isog(pts[7], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 7, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[6], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 6, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[5], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 5, phiP, phiQ, phiR, coeff);
+
+  xTPLe(pts[4], pts[5], A24minus, A24plus, 1);
+  get_3_isog(pts[5], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 5, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[4], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 4, phiP, phiQ, phiR, coeff);
+
+  xTPLe(pts[3], pts[4], A24minus, A24plus, 1);
+  xTPLe(pts[4], pts[5], A24minus, A24plus, 1);
+  get_3_isog(pts[5], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 5, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[4], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 4, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[3], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 3, phiP, phiQ, phiR, coeff);
+
+  xTPLe(pts[2], pts[3], A24minus, A24plus, 12);
+  xTPLe(pts[3], pts[4], A24minus, A24plus, 8);
+  xTPLe(pts[4], pts[5], A24minus, A24plus, 5);
+  xTPLe(pts[5], pts[6], A24minus, A24plus, 3);
+  xTPLe(pts[6], pts[7], A24minus, A24plus, 2);
+  xTPLe(pts[7], pts[8], A24minus, A24plus, 1);
+  xTPLe(pts[8], pts[9], A24minus, A24plus, 1);
+  get_3_isog(pts[9], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 9, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[8], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 8, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[7], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 7, phiP, phiQ, phiR, coeff);
+
+  xTPLe(pts[6], pts[7], A24minus, A24plus, 1);
+  get_3_isog(pts[7], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 7, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[6], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 6, phiP, phiQ, phiR, coeff);
+
+  xTPLe(pts[5], pts[6], A24minus, A24plus, 1);
+  xTPLe(pts[6], pts[7], A24minus, A24plus, 1);
+  get_3_isog(pts[7], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 7, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[6], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 6, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[5], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 5, phiP, phiQ, phiR, coeff);
+
+  xTPLe(pts[4], pts[5], A24minus, A24plus, 2);
+  xTPLe(pts[5], pts[6], A24minus, A24plus, 1);
+  xTPLe(pts[6], pts[7], A24minus, A24plus, 1);
+  get_3_isog(pts[7], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 7, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[6], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 6, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[5], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 5, phiP, phiQ, phiR, coeff);
+
+  xTPLe(pts[4], pts[5], A24minus, A24plus, 1);
+  get_3_isog(pts[5], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 5, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[4], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 4, phiP, phiQ, phiR, coeff);
+
+  xTPLe(pts[3], pts[4], A24minus, A24plus, 3);
+  xTPLe(pts[4], pts[5], A24minus, A24plus, 2);
+  xTPLe(pts[5], pts[6], A24minus, A24plus, 1);
+  xTPLe(pts[6], pts[7], A24minus, A24plus, 1);
+  get_3_isog(pts[7], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 7, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[6], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 6, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[5], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 5, phiP, phiQ, phiR, coeff);
+
+  xTPLe(pts[4], pts[5], A24minus, A24plus, 1);
+  get_3_isog(pts[5], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 5, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[4], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 4, phiP, phiQ, phiR, coeff);
+
+  xTPLe(pts[3], pts[4], A24minus, A24plus, 1);
+  xTPLe(pts[4], pts[5], A24minus, A24plus, 1);
+  get_3_isog(pts[5], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 5, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[4], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 4, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[3], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 3, phiP, phiQ, phiR, coeff);
+
+  xTPLe(pts[2], pts[3], A24minus, A24plus, 4);
+  xTPLe(pts[3], pts[4], A24minus, A24plus, 3);
+  xTPLe(pts[4], pts[5], A24minus, A24plus, 2);
+  xTPLe(pts[5], pts[6], A24minus, A24plus, 1);
+  xTPLe(pts[6], pts[7], A24minus, A24plus, 1);
+  get_3_isog(pts[7], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 7, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[6], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 6, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[5], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 5, phiP, phiQ, phiR, coeff);
+
+  xTPLe(pts[4], pts[5], A24minus, A24plus, 1);
+  get_3_isog(pts[5], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 5, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[4], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 4, phiP, phiQ, phiR, coeff);
+
+  xTPLe(pts[3], pts[4], A24minus, A24plus, 1);
+  xTPLe(pts[4], pts[5], A24minus, A24plus, 1);
+  get_3_isog(pts[5], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 5, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[4], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 4, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[3], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 3, phiP, phiQ, phiR, coeff);
+
+  xTPLe(pts[2], pts[3], A24minus, A24plus, 1);
+  xTPLe(pts[3], pts[4], A24minus, A24plus, 1);
+  xTPLe(pts[4], pts[5], A24minus, A24plus, 1);
+  get_3_isog(pts[5], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 5, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[4], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 4, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[3], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 3, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[2], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 2, phiP, phiQ, phiR, coeff);
+
+  xTPLe(pts[1], pts[2], A24minus, A24plus, 14);
+  xTPLe(pts[2], pts[3], A24minus, A24plus, 9);
+  xTPLe(pts[3], pts[4], A24minus, A24plus, 6);
+  xTPLe(pts[4], pts[5], A24minus, A24plus, 5);
+  xTPLe(pts[5], pts[6], A24minus, A24plus, 3);
+  xTPLe(pts[6], pts[7], A24minus, A24plus, 2);
+  xTPLe(pts[7], pts[8], A24minus, A24plus, 1);
+  xTPLe(pts[8], pts[9], A24minus, A24plus, 1);
+  get_3_isog(pts[9], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 9, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[8], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 8, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[7], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 7, phiP, phiQ, phiR, coeff);
+
+  xTPLe(pts[6], pts[7], A24minus, A24plus, 1);
+  get_3_isog(pts[7], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 7, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[6], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 6, phiP, phiQ, phiR, coeff);
+
+  xTPLe(pts[5], pts[6], A24minus, A24plus, 1);
+  xTPLe(pts[6], pts[7], A24minus, A24plus, 1);
+  get_3_isog(pts[7], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 7, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[6], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 6, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[5], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 5, phiP, phiQ, phiR, coeff);
+
+  xTPLe(pts[4], pts[5], A24minus, A24plus, 2);
+  xTPLe(pts[5], pts[6], A24minus, A24plus, 1);
+  xTPLe(pts[6], pts[7], A24minus, A24plus, 1);
+  get_3_isog(pts[7], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 7, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[6], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 6, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[5], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 5, phiP, phiQ, phiR, coeff);
+
+  xTPLe(pts[4], pts[5], A24minus, A24plus, 1);
+  get_3_isog(pts[5], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 5, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[4], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 4, phiP, phiQ, phiR, coeff);
+
+  xTPLe(pts[3], pts[4], A24minus, A24plus, 2);
+  xTPLe(pts[4], pts[5], A24minus, A24plus, 1);
+  xTPLe(pts[5], pts[6], A24minus, A24plus, 1);
+  xTPLe(pts[6], pts[7], A24minus, A24plus, 1);
+  get_3_isog(pts[7], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 7, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[6], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 6, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[5], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 5, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[4], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 4, phiP, phiQ, phiR, coeff);
+
+  xTPLe(pts[3], pts[4], A24minus, A24plus, 1);
+  get_3_isog(pts[4], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 4, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[3], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 3, phiP, phiQ, phiR, coeff);
+
+  xTPLe(pts[2], pts[3], A24minus, A24plus, 3);
+  xTPLe(pts[3], pts[4], A24minus, A24plus, 2);
+  xTPLe(pts[4], pts[5], A24minus, A24plus, 1);
+  xTPLe(pts[5], pts[6], A24minus, A24plus, 1);
+  xTPLe(pts[6], pts[7], A24minus, A24plus, 1);
+  get_3_isog(pts[7], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 7, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[6], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 6, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[5], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 5, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[4], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 4, phiP, phiQ, phiR, coeff);
+
+  xTPLe(pts[3], pts[4], A24minus, A24plus, 1);
+  get_3_isog(pts[4], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 4, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[3], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 3, phiP, phiQ, phiR, coeff);
+
+  xTPLe(pts[2], pts[3], A24minus, A24plus, 1);
+  xTPLe(pts[3], pts[4], A24minus, A24plus, 1);
+  get_3_isog(pts[4], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 4, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[3], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 3, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[2], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 2, phiP, phiQ, phiR, coeff);
+
+  xTPLe(pts[1], pts[2], A24minus, A24plus, 5);
+  xTPLe(pts[2], pts[3], A24minus, A24plus, 3);
+  xTPLe(pts[3], pts[4], A24minus, A24plus, 2);
+  xTPLe(pts[4], pts[5], A24minus, A24plus, 1);
+  xTPLe(pts[5], pts[6], A24minus, A24plus, 1);
+  xTPLe(pts[6], pts[7], A24minus, A24plus, 1);
+  get_3_isog(pts[7], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 7, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[6], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 6, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[5], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 5, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[4], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 4, phiP, phiQ, phiR, coeff);
+
+  xTPLe(pts[3], pts[4], A24minus, A24plus, 1);
+  get_3_isog(pts[4], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 4, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[3], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 3, phiP, phiQ, phiR, coeff);
+
+  xTPLe(pts[2], pts[3], A24minus, A24plus, 1);
+  xTPLe(pts[3], pts[4], A24minus, A24plus, 1);
+  get_3_isog(pts[4], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 4, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[3], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 3, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[2], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 2, phiP, phiQ, phiR, coeff);
+
+  xTPLe(pts[1], pts[2], A24minus, A24plus, 2);
+  xTPLe(pts[2], pts[3], A24minus, A24plus, 1);
+  xTPLe(pts[3], pts[4], A24minus, A24plus, 1);
+  get_3_isog(pts[4], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 4, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[3], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 3, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[2], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 2, phiP, phiQ, phiR, coeff);
+
+  xTPLe(pts[1], pts[2], A24minus, A24plus, 1);
+  get_3_isog(pts[2], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 2, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[1], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 1, phiP, phiQ, phiR, coeff);
+
+  xTPLe(pts[0], pts[1], A24minus, A24plus, 22);
+  xTPLe(pts[1], pts[2], A24minus, A24plus, 14);
+  xTPLe(pts[2], pts[3], A24minus, A24plus, 9);
+  xTPLe(pts[3], pts[4], A24minus, A24plus, 6);
+  xTPLe(pts[4], pts[5], A24minus, A24plus, 4);
+  xTPLe(pts[5], pts[6], A24minus, A24plus, 3);
+  xTPLe(pts[6], pts[7], A24minus, A24plus, 2);
+  xTPLe(pts[7], pts[8], A24minus, A24plus, 1);
+  xTPLe(pts[8], pts[9], A24minus, A24plus, 1);
+  get_3_isog(pts[9], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 9, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[8], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 8, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[7], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 7, phiP, phiQ, phiR, coeff);
+
+  xTPLe(pts[6], pts[7], A24minus, A24plus, 1);
+  get_3_isog(pts[7], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 7, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[6], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 6, phiP, phiQ, phiR, coeff);
+
+  xTPLe(pts[5], pts[6], A24minus, A24plus, 1);
+  xTPLe(pts[6], pts[7], A24minus, A24plus, 1);
+  get_3_isog(pts[7], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 7, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[6], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 6, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[5], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 5, phiP, phiQ, phiR, coeff);
+
+  xTPLe(pts[4], pts[5], A24minus, A24plus, 1);
+  xTPLe(pts[5], pts[6], A24minus, A24plus, 1);
+  xTPLe(pts[6], pts[7], A24minus, A24plus, 1);
+  get_3_isog(pts[7], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 7, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[6], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 6, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[5], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 5, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[4], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 4, phiP, phiQ, phiR, coeff);
+
+  xTPLe(pts[3], pts[4], A24minus, A24plus, 2);
+  xTPLe(pts[4], pts[5], A24minus, A24plus, 1);
+  xTPLe(pts[5], pts[6], A24minus, A24plus, 1);
+  xTPLe(pts[6], pts[7], A24minus, A24plus, 1);
+  get_3_isog(pts[7], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 7, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[6], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 6, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[5], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 5, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[4], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 4, phiP, phiQ, phiR, coeff);
+
+  xTPLe(pts[3], pts[4], A24minus, A24plus, 1);
+  get_3_isog(pts[4], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 4, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[3], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 3, phiP, phiQ, phiR, coeff);
+
+  xTPLe(pts[2], pts[3], A24minus, A24plus, 3);
+  xTPLe(pts[3], pts[4], A24minus, A24plus, 2);
+  xTPLe(pts[4], pts[5], A24minus, A24plus, 1);
+  xTPLe(pts[5], pts[6], A24minus, A24plus, 1);
+  xTPLe(pts[6], pts[7], A24minus, A24plus, 1);
+  get_3_isog(pts[7], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 7, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[6], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 6, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[5], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 5, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[4], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 4, phiP, phiQ, phiR, coeff);
+
+  xTPLe(pts[3], pts[4], A24minus, A24plus, 1);
+  get_3_isog(pts[4], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 4, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[3], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 3, phiP, phiQ, phiR, coeff);
+
+  xTPLe(pts[2], pts[3], A24minus, A24plus, 1);
+  xTPLe(pts[3], pts[4], A24minus, A24plus, 1);
+  get_3_isog(pts[4], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 4, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[3], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 3, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[2], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 2, phiP, phiQ, phiR, coeff);
+
+  xTPLe(pts[1], pts[2], A24minus, A24plus, 5);
+  xTPLe(pts[2], pts[3], A24minus, A24plus, 3);
+  xTPLe(pts[3], pts[4], A24minus, A24plus, 2);
+  xTPLe(pts[4], pts[5], A24minus, A24plus, 1);
+  xTPLe(pts[5], pts[6], A24minus, A24plus, 1);
+  xTPLe(pts[6], pts[7], A24minus, A24plus, 1);
+  get_3_isog(pts[7], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 7, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[6], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 6, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[5], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 5, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[4], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 4, phiP, phiQ, phiR, coeff);
+
+  xTPLe(pts[3], pts[4], A24minus, A24plus, 1);
+  get_3_isog(pts[4], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 4, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[3], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 3, phiP, phiQ, phiR, coeff);
+
+  xTPLe(pts[2], pts[3], A24minus, A24plus, 1);
+  xTPLe(pts[3], pts[4], A24minus, A24plus, 1);
+  get_3_isog(pts[4], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 4, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[3], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 3, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[2], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 2, phiP, phiQ, phiR, coeff);
+
+  xTPLe(pts[1], pts[2], A24minus, A24plus, 2);
+  xTPLe(pts[2], pts[3], A24minus, A24plus, 1);
+  xTPLe(pts[3], pts[4], A24minus, A24plus, 1);
+  get_3_isog(pts[4], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 4, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[3], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 3, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[2], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 2, phiP, phiQ, phiR, coeff);
+
+  xTPLe(pts[1], pts[2], A24minus, A24plus, 1);
+  get_3_isog(pts[2], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 2, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[1], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 1, phiP, phiQ, phiR, coeff);
+
+  xTPLe(pts[0], pts[1], A24minus, A24plus, 8);
+  xTPLe(pts[1], pts[2], A24minus, A24plus, 5);
+  xTPLe(pts[2], pts[3], A24minus, A24plus, 3);
+  xTPLe(pts[3], pts[4], A24minus, A24plus, 2);
+  xTPLe(pts[4], pts[5], A24minus, A24plus, 1);
+  xTPLe(pts[5], pts[6], A24minus, A24plus, 1);
+  xTPLe(pts[6], pts[7], A24minus, A24plus, 1);
+  get_3_isog(pts[7], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 7, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[6], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 6, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[5], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 5, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[4], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 4, phiP, phiQ, phiR, coeff);
+
+  xTPLe(pts[3], pts[4], A24minus, A24plus, 1);
+  get_3_isog(pts[4], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 4, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[3], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 3, phiP, phiQ, phiR, coeff);
+
+  xTPLe(pts[2], pts[3], A24minus, A24plus, 1);
+  xTPLe(pts[3], pts[4], A24minus, A24plus, 1);
+  get_3_isog(pts[4], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 4, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[3], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 3, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[2], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 2, phiP, phiQ, phiR, coeff);
+
+  xTPLe(pts[1], pts[2], A24minus, A24plus, 2);
+  xTPLe(pts[2], pts[3], A24minus, A24plus, 1);
+  xTPLe(pts[3], pts[4], A24minus, A24plus, 1);
+  get_3_isog(pts[4], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 4, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[3], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 3, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[2], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 2, phiP, phiQ, phiR, coeff);
+
+  xTPLe(pts[1], pts[2], A24minus, A24plus, 1);
+  get_3_isog(pts[2], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 2, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[1], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 1, phiP, phiQ, phiR, coeff);
+
+  xTPLe(pts[0], pts[1], A24minus, A24plus, 3);
+  xTPLe(pts[1], pts[2], A24minus, A24plus, 2);
+  xTPLe(pts[2], pts[3], A24minus, A24plus, 1);
+  xTPLe(pts[3], pts[4], A24minus, A24plus, 1);
+  get_3_isog(pts[4], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 4, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[3], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 3, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[2], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 2, phiP, phiQ, phiR, coeff);
+
+  xTPLe(pts[1], pts[2], A24minus, A24plus, 1);
+  get_3_isog(pts[2], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 2, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[1], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 1, phiP, phiQ, phiR, coeff);
+
+  xTPLe(pts[0], pts[1], A24minus, A24plus, 1);
+  xTPLe(pts[1], pts[2], A24minus, A24plus, 1);
+  get_3_isog(pts[2], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 2, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[1], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 1, phiP, phiQ, phiR, coeff);
+
+  get_3_isog(pts[0], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 0, phiP, phiQ, phiR, coeff);
+}
+
+static void traverse_Bob_ss(point_proj_t *pts, f2elm_t A24minus, f2elm_t A24plus)
+{
+  f2elm_t coeff[3];
+
+  xTPLe(pts[0], pts[1], A24minus, A24plus, 63);
+  xTPLe(pts[1], pts[2], A24minus, A24plus, 42);
+  xTPLe(pts[2], pts[3], A24minus, A24plus, 33);
+  xTPLe(pts[3], pts[4], A24minus, A24plus, 21);
+  xTPLe(pts[4], pts[5], A24minus, A24plus, 13);
+  xTPLe(pts[5], pts[6], A24minus, A24plus, 8);
+  xTPLe(pts[6], pts[7], A24minus, A24plus, 5);
+  xTPLe(pts[7], pts[8], A24minus, A24plus, 3);
+  xTPLe(pts[8], pts[9], A24minus, A24plus, 2);
+  xTPLe(pts[9], pts[10], A24minus, A24plus, 1);
+  get_3_isog(pts[10], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 10, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[9], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 9, NULL, NULL, NULL, coeff);
+
+  xTPLe(pts[8], pts[9], A24minus, A24plus, 1);
+  get_3_isog(pts[9], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 9, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[8], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 8, NULL, NULL, NULL, coeff);
+
+  xTPLe(pts[7], pts[8], A24minus, A24plus, 1);
+  xTPLe(pts[8], pts[9], A24minus, A24plus, 1);
+  get_3_isog(pts[9], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 9, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[8], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 8, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[7], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 7, NULL, NULL, NULL, coeff);
+
+  xTPLe(pts[6], pts[7], A24minus, A24plus, 2);
+  xTPLe(pts[7], pts[8], A24minus, A24plus, 1);
+  xTPLe(pts[8], pts[9], A24minus, A24plus, 1);
+  get_3_isog(pts[9], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 9, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[8], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 8, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[7], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 7, NULL, NULL, NULL, coeff);
+
+  xTPLe(pts[6], pts[7], A24minus, A24plus, 1);
+  get_3_isog(pts[7], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 7, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[6], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 6, NULL, NULL, NULL, coeff);
+
+  xTPLe(pts[5], pts[6], A24minus, A24plus, 3);
+  xTPLe(pts[6], pts[7], A24minus, A24plus, 2);
+  xTPLe(pts[7], pts[8], A24minus, A24plus, 1);
+  xTPLe(pts[8], pts[9], A24minus, A24plus, 1);
+  get_3_isog(pts[9], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 9, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[8], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 8, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[7], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 7, NULL, NULL, NULL, coeff);
+
+  xTPLe(pts[6], pts[7], A24minus, A24plus, 1);
+  get_3_isog(pts[7], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 7, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[6], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 6, NULL, NULL, NULL, coeff);
+
+  xTPLe(pts[5], pts[6], A24minus, A24plus, 1);
+  xTPLe(pts[6], pts[7], A24minus, A24plus, 1);
+  get_3_isog(pts[7], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 7, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[6], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 6, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[5], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 5, NULL, NULL, NULL, coeff);
+
+  xTPLe(pts[4], pts[5], A24minus, A24plus, 5);
+  xTPLe(pts[5], pts[6], A24minus, A24plus, 3);
+  xTPLe(pts[6], pts[7], A24minus, A24plus, 2);
+  xTPLe(pts[7], pts[8], A24minus, A24plus, 1);
+  xTPLe(pts[8], pts[9], A24minus, A24plus, 1);
+  get_3_isog(pts[9], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 9, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[8], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 8, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[7], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 7, NULL, NULL, NULL, coeff);
+
+  xTPLe(pts[6], pts[7], A24minus, A24plus, 1);
+  get_3_isog(pts[7], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 7, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[6], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 6, NULL, NULL, NULL, coeff);
+
+  xTPLe(pts[5], pts[6], A24minus, A24plus, 1);
+  xTPLe(pts[6], pts[7], A24minus, A24plus, 1);
+  get_3_isog(pts[7], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 7, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[6], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 6, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[5], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 5, NULL, NULL, NULL, coeff);
+
+  xTPLe(pts[4], pts[5], A24minus, A24plus, 2);
+  xTPLe(pts[5], pts[6], A24minus, A24plus, 1);
+  xTPLe(pts[6], pts[7], A24minus, A24plus, 1);
+  get_3_isog(pts[7], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 7, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[6], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 6, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[5], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 5, NULL, NULL, NULL, coeff);
+
+  xTPLe(pts[4], pts[5], A24minus, A24plus, 1);
+  get_3_isog(pts[5], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 5, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[4], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 4, NULL, NULL, NULL, coeff);
+
+  xTPLe(pts[3], pts[4], A24minus, A24plus, 8);
+  xTPLe(pts[4], pts[5], A24minus, A24plus, 5);
+  xTPLe(pts[5], pts[6], A24minus, A24plus, 3);
+  xTPLe(pts[6], pts[7], A24minus, A24plus, 2);
+  xTPLe(pts[7], pts[8], A24minus, A24plus, 1);
+  xTPLe(pts[8], pts[9], A24minus, A24plus, 1);
+  get_3_isog(pts[9], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 9, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[8], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 8, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[7], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 7, NULL, NULL, NULL, coeff);
+
+  xTPLe(pts[6], pts[7], A24minus, A24plus, 1);
+  get_3_isog(pts[7], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 7, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[6], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 6, NULL, NULL, NULL, coeff);
+
+  xTPLe(pts[5], pts[6], A24minus, A24plus, 1);
+  xTPLe(pts[6], pts[7], A24minus, A24plus, 1);
+  get_3_isog(pts[7], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 7, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[6], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 6, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[5], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 5, NULL, NULL, NULL, coeff);
+
+  xTPLe(pts[4], pts[5], A24minus, A24plus, 2);
+  xTPLe(pts[5], pts[6], A24minus, A24plus, 1);
+  xTPLe(pts[6], pts[7], A24minus, A24plus, 1);
+  get_3_isog(pts[7], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 7, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[6], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 6, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[5], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 5, NULL, NULL, NULL, coeff);
+
+  xTPLe(pts[4], pts[5], A24minus, A24plus, 1);
+  get_3_isog(pts[5], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 5, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[4], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 4, NULL, NULL, NULL, coeff);
+
+  xTPLe(pts[3], pts[4], A24minus, A24plus, 3);
+  xTPLe(pts[4], pts[5], A24minus, A24plus, 2);
+  xTPLe(pts[5], pts[6], A24minus, A24plus, 1);
+  xTPLe(pts[6], pts[7], A24minus, A24plus, 1);
+  get_3_isog(pts[7], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 7, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[6], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 6, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[5], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 5, NULL, NULL, NULL, coeff);
+
+  xTPLe(pts[4], pts[5], A24minus, A24plus, 1);
+  get_3_isog(pts[5], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 5, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[4], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 4, NULL, NULL, NULL, coeff);
+
+  xTPLe(pts[3], pts[4], A24minus, A24plus, 1);
+  xTPLe(pts[4], pts[5], A24minus, A24plus, 1);
+  get_3_isog(pts[5], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 5, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[4], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 4, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[3], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 3, NULL, NULL, NULL, coeff);
+
+  xTPLe(pts[2], pts[3], A24minus, A24plus, 12);
+  xTPLe(pts[3], pts[4], A24minus, A24plus, 8);
+  xTPLe(pts[4], pts[5], A24minus, A24plus, 5);
+  xTPLe(pts[5], pts[6], A24minus, A24plus, 3);
+  xTPLe(pts[6], pts[7], A24minus, A24plus, 2);
+  xTPLe(pts[7], pts[8], A24minus, A24plus, 1);
+  xTPLe(pts[8], pts[9], A24minus, A24plus, 1);
+  get_3_isog(pts[9], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 9, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[8], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 8, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[7], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 7, NULL, NULL, NULL, coeff);
+
+  xTPLe(pts[6], pts[7], A24minus, A24plus, 1);
+  get_3_isog(pts[7], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 7, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[6], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 6, NULL, NULL, NULL, coeff);
+
+  xTPLe(pts[5], pts[6], A24minus, A24plus, 1);
+  xTPLe(pts[6], pts[7], A24minus, A24plus, 1);
+  get_3_isog(pts[7], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 7, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[6], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 6, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[5], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 5, NULL, NULL, NULL, coeff);
+
+  xTPLe(pts[4], pts[5], A24minus, A24plus, 2);
+  xTPLe(pts[5], pts[6], A24minus, A24plus, 1);
+  xTPLe(pts[6], pts[7], A24minus, A24plus, 1);
+  get_3_isog(pts[7], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 7, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[6], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 6, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[5], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 5, NULL, NULL, NULL, coeff);
+
+  xTPLe(pts[4], pts[5], A24minus, A24plus, 1);
+  get_3_isog(pts[5], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 5, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[4], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 4, NULL, NULL, NULL, coeff);
+
+  xTPLe(pts[3], pts[4], A24minus, A24plus, 3);
+  xTPLe(pts[4], pts[5], A24minus, A24plus, 2);
+  xTPLe(pts[5], pts[6], A24minus, A24plus, 1);
+  xTPLe(pts[6], pts[7], A24minus, A24plus, 1);
+  get_3_isog(pts[7], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 7, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[6], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 6, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[5], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 5, NULL, NULL, NULL, coeff);
+
+  xTPLe(pts[4], pts[5], A24minus, A24plus, 1);
+  get_3_isog(pts[5], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 5, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[4], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 4, NULL, NULL, NULL, coeff);
+
+  xTPLe(pts[3], pts[4], A24minus, A24plus, 1);
+  xTPLe(pts[4], pts[5], A24minus, A24plus, 1);
+  get_3_isog(pts[5], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 5, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[4], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 4, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[3], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 3, NULL, NULL, NULL, coeff);
+
+  xTPLe(pts[2], pts[3], A24minus, A24plus, 4);
+  xTPLe(pts[3], pts[4], A24minus, A24plus, 3);
+  xTPLe(pts[4], pts[5], A24minus, A24plus, 2);
+  xTPLe(pts[5], pts[6], A24minus, A24plus, 1);
+  xTPLe(pts[6], pts[7], A24minus, A24plus, 1);
+  get_3_isog(pts[7], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 7, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[6], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 6, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[5], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 5, NULL, NULL, NULL, coeff);
+
+  xTPLe(pts[4], pts[5], A24minus, A24plus, 1);
+  get_3_isog(pts[5], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 5, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[4], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 4, NULL, NULL, NULL, coeff);
+
+  xTPLe(pts[3], pts[4], A24minus, A24plus, 1);
+  xTPLe(pts[4], pts[5], A24minus, A24plus, 1);
+  get_3_isog(pts[5], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 5, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[4], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 4, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[3], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 3, NULL, NULL, NULL, coeff);
+
+  xTPLe(pts[2], pts[3], A24minus, A24plus, 1);
+  xTPLe(pts[3], pts[4], A24minus, A24plus, 1);
+  xTPLe(pts[4], pts[5], A24minus, A24plus, 1);
+  get_3_isog(pts[5], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 5, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[4], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 4, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[3], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 3, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[2], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 2, NULL, NULL, NULL, coeff);
+
+  xTPLe(pts[1], pts[2], A24minus, A24plus, 14);
+  xTPLe(pts[2], pts[3], A24minus, A24plus, 9);
+  xTPLe(pts[3], pts[4], A24minus, A24plus, 6);
+  xTPLe(pts[4], pts[5], A24minus, A24plus, 5);
+  xTPLe(pts[5], pts[6], A24minus, A24plus, 3);
+  xTPLe(pts[6], pts[7], A24minus, A24plus, 2);
+  xTPLe(pts[7], pts[8], A24minus, A24plus, 1);
+  xTPLe(pts[8], pts[9], A24minus, A24plus, 1);
+  get_3_isog(pts[9], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 9, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[8], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 8, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[7], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 7, NULL, NULL, NULL, coeff);
+
+  xTPLe(pts[6], pts[7], A24minus, A24plus, 1);
+  get_3_isog(pts[7], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 7, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[6], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 6, NULL, NULL, NULL, coeff);
+
+  xTPLe(pts[5], pts[6], A24minus, A24plus, 1);
+  xTPLe(pts[6], pts[7], A24minus, A24plus, 1);
+  get_3_isog(pts[7], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 7, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[6], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 6, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[5], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 5, NULL, NULL, NULL, coeff);
+
+  xTPLe(pts[4], pts[5], A24minus, A24plus, 2);
+  xTPLe(pts[5], pts[6], A24minus, A24plus, 1);
+  xTPLe(pts[6], pts[7], A24minus, A24plus, 1);
+  get_3_isog(pts[7], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 7, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[6], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 6, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[5], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 5, NULL, NULL, NULL, coeff);
+
+  xTPLe(pts[4], pts[5], A24minus, A24plus, 1);
+  get_3_isog(pts[5], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 5, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[4], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 4, NULL, NULL, NULL, coeff);
+
+  xTPLe(pts[3], pts[4], A24minus, A24plus, 2);
+  xTPLe(pts[4], pts[5], A24minus, A24plus, 1);
+  xTPLe(pts[5], pts[6], A24minus, A24plus, 1);
+  xTPLe(pts[6], pts[7], A24minus, A24plus, 1);
+  get_3_isog(pts[7], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 7, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[6], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 6, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[5], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 5, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[4], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 4, NULL, NULL, NULL, coeff);
+
+  xTPLe(pts[3], pts[4], A24minus, A24plus, 1);
+  get_3_isog(pts[4], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 4, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[3], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 3, NULL, NULL, NULL, coeff);
+
+  xTPLe(pts[2], pts[3], A24minus, A24plus, 3);
+  xTPLe(pts[3], pts[4], A24minus, A24plus, 2);
+  xTPLe(pts[4], pts[5], A24minus, A24plus, 1);
+  xTPLe(pts[5], pts[6], A24minus, A24plus, 1);
+  xTPLe(pts[6], pts[7], A24minus, A24plus, 1);
+  get_3_isog(pts[7], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 7, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[6], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 6, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[5], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 5, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[4], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 4, NULL, NULL, NULL, coeff);
+
+  xTPLe(pts[3], pts[4], A24minus, A24plus, 1);
+  get_3_isog(pts[4], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 4, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[3], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 3, NULL, NULL, NULL, coeff);
+
+  xTPLe(pts[2], pts[3], A24minus, A24plus, 1);
+  xTPLe(pts[3], pts[4], A24minus, A24plus, 1);
+  get_3_isog(pts[4], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 4, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[3], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 3, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[2], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 2, NULL, NULL, NULL, coeff);
+
+  xTPLe(pts[1], pts[2], A24minus, A24plus, 5);
+  xTPLe(pts[2], pts[3], A24minus, A24plus, 3);
+  xTPLe(pts[3], pts[4], A24minus, A24plus, 2);
+  xTPLe(pts[4], pts[5], A24minus, A24plus, 1);
+  xTPLe(pts[5], pts[6], A24minus, A24plus, 1);
+  xTPLe(pts[6], pts[7], A24minus, A24plus, 1);
+  get_3_isog(pts[7], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 7, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[6], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 6, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[5], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 5, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[4], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 4, NULL, NULL, NULL, coeff);
+
+  xTPLe(pts[3], pts[4], A24minus, A24plus, 1);
+  get_3_isog(pts[4], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 4, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[3], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 3, NULL, NULL, NULL, coeff);
+
+  xTPLe(pts[2], pts[3], A24minus, A24plus, 1);
+  xTPLe(pts[3], pts[4], A24minus, A24plus, 1);
+  get_3_isog(pts[4], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 4, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[3], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 3, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[2], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 2, NULL, NULL, NULL, coeff);
+
+  xTPLe(pts[1], pts[2], A24minus, A24plus, 2);
+  xTPLe(pts[2], pts[3], A24minus, A24plus, 1);
+  xTPLe(pts[3], pts[4], A24minus, A24plus, 1);
+  get_3_isog(pts[4], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 4, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[3], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 3, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[2], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 2, NULL, NULL, NULL, coeff);
+
+  xTPLe(pts[1], pts[2], A24minus, A24plus, 1);
+  get_3_isog(pts[2], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 2, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[1], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 1, NULL, NULL, NULL, coeff);
+
+  xTPLe(pts[0], pts[1], A24minus, A24plus, 22);
+  xTPLe(pts[1], pts[2], A24minus, A24plus, 14);
+  xTPLe(pts[2], pts[3], A24minus, A24plus, 9);
+  xTPLe(pts[3], pts[4], A24minus, A24plus, 6);
+  xTPLe(pts[4], pts[5], A24minus, A24plus, 4);
+  xTPLe(pts[5], pts[6], A24minus, A24plus, 3);
+  xTPLe(pts[6], pts[7], A24minus, A24plus, 2);
+  xTPLe(pts[7], pts[8], A24minus, A24plus, 1);
+  xTPLe(pts[8], pts[9], A24minus, A24plus, 1);
+  get_3_isog(pts[9], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 9, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[8], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 8, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[7], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 7, NULL, NULL, NULL, coeff);
+
+  xTPLe(pts[6], pts[7], A24minus, A24plus, 1);
+  get_3_isog(pts[7], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 7, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[6], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 6, NULL, NULL, NULL, coeff);
+
+  xTPLe(pts[5], pts[6], A24minus, A24plus, 1);
+  xTPLe(pts[6], pts[7], A24minus, A24plus, 1);
+  get_3_isog(pts[7], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 7, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[6], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 6, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[5], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 5, NULL, NULL, NULL, coeff);
+
+  xTPLe(pts[4], pts[5], A24minus, A24plus, 1);
+  xTPLe(pts[5], pts[6], A24minus, A24plus, 1);
+  xTPLe(pts[6], pts[7], A24minus, A24plus, 1);
+  get_3_isog(pts[7], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 7, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[6], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 6, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[5], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 5, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[4], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 4, NULL, NULL, NULL, coeff);
+
+  xTPLe(pts[3], pts[4], A24minus, A24plus, 2);
+  xTPLe(pts[4], pts[5], A24minus, A24plus, 1);
+  xTPLe(pts[5], pts[6], A24minus, A24plus, 1);
+  xTPLe(pts[6], pts[7], A24minus, A24plus, 1);
+  get_3_isog(pts[7], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 7, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[6], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 6, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[5], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 5, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[4], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 4, NULL, NULL, NULL, coeff);
+
+  xTPLe(pts[3], pts[4], A24minus, A24plus, 1);
+  get_3_isog(pts[4], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 4, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[3], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 3, NULL, NULL, NULL, coeff);
+
+  xTPLe(pts[2], pts[3], A24minus, A24plus, 3);
+  xTPLe(pts[3], pts[4], A24minus, A24plus, 2);
+  xTPLe(pts[4], pts[5], A24minus, A24plus, 1);
+  xTPLe(pts[5], pts[6], A24minus, A24plus, 1);
+  xTPLe(pts[6], pts[7], A24minus, A24plus, 1);
+  get_3_isog(pts[7], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 7, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[6], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 6, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[5], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 5, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[4], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 4, NULL, NULL, NULL, coeff);
+
+  xTPLe(pts[3], pts[4], A24minus, A24plus, 1);
+  get_3_isog(pts[4], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 4, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[3], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 3, NULL, NULL, NULL, coeff);
+
+  xTPLe(pts[2], pts[3], A24minus, A24plus, 1);
+  xTPLe(pts[3], pts[4], A24minus, A24plus, 1);
+  get_3_isog(pts[4], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 4, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[3], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 3, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[2], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 2, NULL, NULL, NULL, coeff);
+
+  xTPLe(pts[1], pts[2], A24minus, A24plus, 5);
+  xTPLe(pts[2], pts[3], A24minus, A24plus, 3);
+  xTPLe(pts[3], pts[4], A24minus, A24plus, 2);
+  xTPLe(pts[4], pts[5], A24minus, A24plus, 1);
+  xTPLe(pts[5], pts[6], A24minus, A24plus, 1);
+  xTPLe(pts[6], pts[7], A24minus, A24plus, 1);
+  get_3_isog(pts[7], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 7, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[6], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 6, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[5], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 5, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[4], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 4, NULL, NULL, NULL, coeff);
+
+  xTPLe(pts[3], pts[4], A24minus, A24plus, 1);
+  get_3_isog(pts[4], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 4, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[3], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 3, NULL, NULL, NULL, coeff);
+
+  xTPLe(pts[2], pts[3], A24minus, A24plus, 1);
+  xTPLe(pts[3], pts[4], A24minus, A24plus, 1);
+  get_3_isog(pts[4], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 4, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[3], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 3, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[2], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 2, NULL, NULL, NULL, coeff);
+
+  xTPLe(pts[1], pts[2], A24minus, A24plus, 2);
+  xTPLe(pts[2], pts[3], A24minus, A24plus, 1);
+  xTPLe(pts[3], pts[4], A24minus, A24plus, 1);
+  get_3_isog(pts[4], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 4, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[3], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 3, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[2], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 2, NULL, NULL, NULL, coeff);
+
+  xTPLe(pts[1], pts[2], A24minus, A24plus, 1);
+  get_3_isog(pts[2], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 2, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[1], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 1, NULL, NULL, NULL, coeff);
+
+  xTPLe(pts[0], pts[1], A24minus, A24plus, 8);
+  xTPLe(pts[1], pts[2], A24minus, A24plus, 5);
+  xTPLe(pts[2], pts[3], A24minus, A24plus, 3);
+  xTPLe(pts[3], pts[4], A24minus, A24plus, 2);
+  xTPLe(pts[4], pts[5], A24minus, A24plus, 1);
+  xTPLe(pts[5], pts[6], A24minus, A24plus, 1);
+  xTPLe(pts[6], pts[7], A24minus, A24plus, 1);
+  get_3_isog(pts[7], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 7, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[6], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 6, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[5], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 5, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[4], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 4, NULL, NULL, NULL, coeff);
+
+  xTPLe(pts[3], pts[4], A24minus, A24plus, 1);
+  get_3_isog(pts[4], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 4, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[3], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 3, NULL, NULL, NULL, coeff);
+
+  xTPLe(pts[2], pts[3], A24minus, A24plus, 1);
+  xTPLe(pts[3], pts[4], A24minus, A24plus, 1);
+  get_3_isog(pts[4], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 4, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[3], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 3, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[2], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 2, NULL, NULL, NULL, coeff);
+
+  xTPLe(pts[1], pts[2], A24minus, A24plus, 2);
+  xTPLe(pts[2], pts[3], A24minus, A24plus, 1);
+  xTPLe(pts[3], pts[4], A24minus, A24plus, 1);
+  get_3_isog(pts[4], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 4, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[3], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 3, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[2], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 2, NULL, NULL, NULL, coeff);
+
+  xTPLe(pts[1], pts[2], A24minus, A24plus, 1);
+  get_3_isog(pts[2], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 2, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[1], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 1, NULL, NULL, NULL, coeff);
+
+  xTPLe(pts[0], pts[1], A24minus, A24plus, 3);
+  xTPLe(pts[1], pts[2], A24minus, A24plus, 2);
+  xTPLe(pts[2], pts[3], A24minus, A24plus, 1);
+  xTPLe(pts[3], pts[4], A24minus, A24plus, 1);
+  get_3_isog(pts[4], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 4, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[3], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 3, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[2], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 2, NULL, NULL, NULL, coeff);
+
+  xTPLe(pts[1], pts[2], A24minus, A24plus, 1);
+  get_3_isog(pts[2], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 2, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[1], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 1, NULL, NULL, NULL, coeff);
+
+  xTPLe(pts[0], pts[1], A24minus, A24plus, 1);
+  xTPLe(pts[1], pts[2], A24minus, A24plus, 1);
+  get_3_isog(pts[2], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 2, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[1], A24minus, A24plus, coeff);
+  eval_3_isog_multi(pts, 1, NULL, NULL, NULL, coeff);
+
+  get_3_isog(pts[0], A24minus, A24plus, coeff);
+}
+
+#endif
@@ -0,0 +1,367 @@
+/**
+ *******************************************************************************
+ * @version 0.1
+ * @date 2021-12-16
+ * @copyright Copyright © 2021 by University of Luxembourg
+ * @author Hao Cheng
+ *******************************************************************************
+ */
+
+// Cost-calibrated optimal strategies for the isogeny tree traversal.
+// The tool measures the cost of a strategy step (xDBLe/xTPLe) and of 
+// evaluating an isogeny at n stacked points with eval_4_isog_multi/
+// eval_3_isog_multi, which evaluates the points two at a time, on this machine.
+// The evaluations of the key generation also take phiP, phiQ, phiR, which 
+// changes the pairing, so the key generation (kg) and the secret agreement (ss)
+// get their own costs and tables. The tool runs the dynamic program for optimal
+// strategies on these costs, bounded by the stack size MAX_INT_POINTS_*, and 
+// prints the strategy tables of sidh.h together with the modeled cost of the 
+// current and the new tables. 
+// With the argument "compile", it instead compiles the strategy tables of 
+// sidh.h into the straight-line traversals of src/traversal.h, and with 
+// "tables" it prints the fixed-basis ladder tables of src/ladder_table.h.
+//
+//   $ make strategy
+//   $ ./strategy
+//   $ ./strategy compile > src/traversal.h
+//   $ ./strategy tables > src/ladder_table.h
+
+#include "sidh.h"
+#include <stdio.h>
+#include <string.h>
+#include <x86intrin.h>
+
+// read_tsc serializes with cpuid, which traps under virtualization and 
+// distorts the short kernels measured here; lfence + rdtsc is used instead
+static uint64_t strat_tsc()
+{
+  uint64_t t;
+
+  _mm_lfence();
+  t = __rdtsc();
+  _mm_lfence();
+
+  return t;
+}
+
+#define STRAT_PASSES    32        // #passes over all kernels, interleaved 
+#define STRAT_RUNS      50        // #runs per kernel and pass, the minimum is taken
+#define STRAT_ITER      10        // #calls per run
+#define MAX_DEPTH       (MAX_INT_POINTS_ALICE > MAX_INT_POINTS_BOB ? MAX_INT_POINTS_ALICE : MAX_INT_POINTS_BOB)
+#define MAX_LEAVES      (MAX_Alice > MAX_Bob ? MAX_Alice : MAX_Bob)
+#define COST_INF        ((uint64_t)-1 >> 1)
+
+// T is the minimum over all runs so far
+#define MEASURE_MIN(X, T)                                 \
+  for (r = 0; r < STRAT_RUNS; r++) {                      \
+    start_cycles = strat_tsc();                           \
+    for (i = 0; i < STRAT_ITER; i++) (X);                 \
+    end_cycles = strat_tsc();                             \
+    if ((end_cycles-start_cycles)/STRAT_ITER < (T))       \
+      T = (end_cycles-start_cycles)/STRAT_ITER;           \
+  }
+
+// costs of the isogeny tree traversal
+// step:    cost of one strategy step 
+// eval[n]: cost of eval_*_isog_multi at n stacked points (and at phiP, phiQ,
+//          phiR for the key generation)
+typedef struct {
+  uint64_t step;
+  uint64_t eval[MAX_DEPTH+1];
+} strat_cost_t;
+
+static uint64_t C[MAX_LEAVES+1][MAX_DEPTH+2];
+static int K[MAX_LEAVES+1][MAX_DEPTH+2];
+
+// --------------------------------------------------------------------------
+// measurement 
+
+static void measure_costs(strat_cost_t *cAkg, strat_cost_t *cAss, strat_cost_t *cBkg, strat_cost_t *cBss)
+{
+  static point_proj_t pts[MAX_DEPTH+1];
+  point_proj_t Q, phiP, phiQ, phiR;
+  f2elm_t A24plus, C24, coeff[3];
+  uint64_t start_cycles, end_cycles;
+  int i, n, p, r;
+
+  // any reduced limbs will do, the kernels are constant-time
+  for (i = 0; i < (int)(sizeof(pts)/8); i++) ((uint64_t *)pts)[i] = (i*0x9E3779B97F4A7C15ULL) & BMASK;
+  for (i = 0; i < (int)(sizeof(point_proj_t)/8); i++) {
+    ((uint64_t *)phiP)[i] = (i*0x9E3779B97F4A7C15ULL+1) & BMASK;
+    ((uint64_t *)phiQ)[i] = (i*0x9E3779B97F4A7C15ULL+2) & BMASK;
+    ((uint64_t *)phiR)[i] = (i*0x9E3779B97F4A7C15ULL+3) & BMASK;
+  }
+  for (i = 0; i < NWORDS; i++) {
+    A24plus[0][i] = A24plus[1][i] = C24[0][i] = C24[1][i] = VSET1(i+1);
+    coeff[0][0][i] = coeff[0][1][i] = coeff[1][0][i] = VSET1(i+2);
+    coeff[1][1][i] = coeff[2][0][i] = coeff[2][1][i] = VSET1(i+3);
+  }
+
+  cAkg->step = cBkg->step = COST_INF;
+  for (n = 0; n <= MAX_DEPTH; n++) 
+    cAkg->eval[n] = cAss->eval[n] = cBkg->eval[n] = cBss->eval[n] = COST_INF;
+  for (p = 0; p < STRAT_PASSES; p++) {
+    MEASURE_MIN(xDBLe(pts[0], Q, A24plus, C24, 2), cAkg->step);
+    MEASURE_MIN(xTPLe(pts[0], Q, C24, A24plus, 1), cBkg->step);
+    for (n = 0; n <= MAX_DEPTH; n++) {
+      if (n <= MAX_INT_POINTS_ALICE) {
+        MEASURE_MIN(eval_4_isog_multi(pts, n, phiP, phiQ, phiR, coeff), cAkg->eval[n]);
+        MEASURE_MIN(eval_4_isog_multi(pts, n, NULL, NULL, NULL, coeff), cAss->eval[n]);
+      }
+      if (n <= MAX_INT_POINTS_BOB) {
+        MEASURE_MIN(eval_3_isog_multi(pts, n, phiP, phiQ, phiR, coeff), cBkg->eval[n]);
+        MEASURE_MIN(eval_3_isog_multi(pts, n, NULL, NULL, NULL, coeff), cBss->eval[n]);
+      }
+    }
+  }
+  cAss->step = cAkg->step;
+  cBss->step = cBkg->step;
+  cAss->eval[0] = cBss->eval[0] = 0;   // the secret agreement skips the last evaluation
+}
+
+// --------------------------------------------------------------------------
+// strategies 
+
+// modeled cost of a strategy, following the tree traversal in sidh.c
+static uint64_t strategy_cost(const unsigned int *strat, const int MAX, const strat_cost_t *c, int *maxpts)
+{
+  int row, m, index = 0, pts_index[MAX_LEAVES], npts = 0, ii = 0;
+  uint64_t cost = 0;
+
+  *maxpts = 0;
+  for (row = 1; row < MAX; row++) {
+    while (index < MAX-row) {
+      pts_index[npts++] = index;
+      if (npts > *maxpts) *maxpts = npts;
+      m = strat[ii++];
+      cost += m*c->step;
+      index += m;
+    }
+    cost += c->eval[npts];
+    index = pts_index[npts-1];
+    npts -= 1;
+  }
+  cost += c->eval[0];   // the last isogeny 
+
+  return cost;
+}
+
+static void emit_strategy(unsigned int *strat, int *ii, const int n, const int d)
+{
+  int k;
+
+  if (n == 1) return;
+  k = K[n][d];
+  strat[(*ii)++] = k;
+  emit_strategy(strat, ii, n-k, d+1);   // the points pushed on the way down
+  emit_strategy(strat, ii, k, d);       
+}
+
+// optimal strategy for a tree with MAX leaves and at most dmax stacked points
+// C(1, d) = eval[d]
+// C(n, d) = min_{0<k<n} k*step + C(n-k, d+1) + C(k, d)
+static uint64_t optimal_strategy(unsigned int *strat, const int MAX, const strat_cost_t *c, const int dmax)
+{
+  int n, d, k, ii = 0;
+  uint64_t t;
+
+  for (d = 0; d <= dmax+1; d++) C[1][d] = (d <= dmax) ? c->eval[d] : COST_INF;
+  for (n = 2; n <= MAX; n++) {
+    for (d = 0; d <= dmax+1; d++) {
+      C[n][d] = COST_INF; K[n][d] = 0;
+      if (d == dmax+1) continue;
+      for (k = 1; k < n; k++) {
+        if (C[n-k][d+1] == COST_INF || C[k][d] == COST_INF) continue;
+        t = k*c->step + C[n-k][d+1] + C[k][d];
+        if (t < C[n][d]) { C[n][d] = t; K[n][d] = k; }
+      }
+    }
+  }
+  emit_strategy(strat, &ii, MAX, 0);
+
+  return C[MAX][0];
+}
+
+static void print_strategy(const char *name, const char *size, const unsigned int *strat, const int len)
+{
+  int i;
+
+  printf("static const unsigned int %s[%s] = { \n", name, size);
+  for (i = 0; i < len; i++) 
+    printf("%s%u%s", (i%16 == 0) ? "  " : "", strat[i], (i == len-1) ? " };\n" : ((i%16 == 15) ? ",\n" : ", "));
+}
+
+static void generate(const char *name, const char *size, const unsigned int *cur, const int MAX, const strat_cost_t *c, const int dmax)
+{
+  unsigned int strat[MAX_LEAVES];
+  uint64_t cost_cur, cost_opt;
+  int maxpts_cur, maxpts_opt;
+
+  cost_cur = strategy_cost(cur, MAX, c, &maxpts_cur);
+  cost_opt = optimal_strategy(strat, MAX, c, dmax);
+  strategy_cost(strat, MAX, c, &maxpts_opt);
+  printf("// %s: modeled cost %llu -> %llu cycles (%.2f%%), max #points %d -> %d\n", name,
+         (unsigned long long)cost_cur, (unsigned long long)cost_opt, 
+         100.0*((double)cost_opt-(double)cost_cur)/(double)cost_cur, maxpts_cur, maxpts_opt);
+  print_strategy(name, size, strat, MAX-1);
+  printf("\n");
+}
+
+// --------------------------------------------------------------------------
+// strategy compiler 
+// The traversal is unrolled into straight-line code with static point slots: 
+// the point that is multiplied lives in pts[npts] right above the npts stacked
+// points, so a strategy step writes the next slot (out-of-place xDBLe/xTPLe) 
+// and the pop after an isogeny is free. No point is copied.
+
+#define TRAVERSE_KG     0         // also evaluates phiP, phiQ, phiR
+#define TRAVERSE_SS     1
+
+// For an odd e2 (p610) the 4-isogeny tree is preceded by a 2-isogeny with kernel 
+// [2^(e2-1)]R. Instead of a separate doubling chain from R, the first row of the 
+// tree is run on R itself: it ends at [2^(e2-3)]R, two more doublings give the 
+// 2-isogeny kernel, and the 2-isogeny is evaluated at the points of the row, which 
+// become the first row of the tree on phi(R). 
+static void compile_2_isog(const int npts, const int kind)
+{
+  int i;
+
+  printf("  xDBLe(pts[%d], S, A24plus, C24, 2);\n", npts);
+  printf("  get_2_isog(S, A24plus, C24);\n");
+  for (i = 0; i <= npts; i++) printf("  eval_2_isog(pts[%d], S);\n", i);
+  if (kind == TRAVERSE_KG) 
+    printf("  eval_2_isog(phiP, S);\n  eval_2_isog(phiQ, S);\n  eval_2_isog(phiR, S);\n");
+}
+
+static void compile_strategy(const char *name, const unsigned int *strat, const int MAX, const int iso, const int kind)
+{
+  const char *curve = (iso == 4) ? "A24plus, C24" : "A24minus, A24plus";
+  const char *phi = (kind == TRAVERSE_KG) ? "phiP, phiQ, phiR" : "NULL, NULL, NULL";
+  int row, m, index = 0, pts_index[MAX_LEAVES], npts = 0, ii = 0, i;
+
+  printf("static void traverse_%s(point_proj_t *pts, f2elm_t %s, f2elm_t %s", name, 
+         (iso == 4) ? "A24plus" : "A24minus", (iso == 4) ? "C24" : "A24plus");
+  if (kind == TRAVERSE_KG) printf(", point_proj_t phiP, point_proj_t phiQ, point_proj_t phiR");
+  printf(")\n{\n");
+  printf("  f2elm_t coeff[3];\n");
+  if (iso == 4 && (OALICE_BITS & 1)) printf("  point_proj_t S;\n");
+
+  for (row = 1; row < MAX; row++) {
+    printf("\n");
+    while (index < MAX-row) {
+      pts_index[npts++] = index;
+      m = strat[ii++];
+      if (iso == 4) printf("  xDBLe(pts[%d], pts[%d], %s, %d);\n", npts-1, npts, curve, 2*m);
+      else printf("  xTPLe(pts[%d], pts[%d], %s, %d);\n", npts-1, npts, curve, m);
+      index += m;
+    }
+    if (row == 1 && iso == 4 && (OALICE_BITS & 1)) compile_2_isog(npts, kind);
+    printf("  get_%d_isog(pts[%d], %s, coeff);\n", iso, npts, curve);
+    printf("  eval_%d_isog_multi(pts, %d, %s, coeff);\n", iso, npts, phi);
+    index = pts_index[npts-1];
+    npts -= 1;
+  }
+
+  printf("\n  get_%d_isog(pts[0], %s, coeff);\n", iso, curve);
+  if (kind == TRAVERSE_KG) printf("  eval_%d_isog_multi(pts, 0, %s, coeff);\n", iso, phi);
+  printf("}\n\n");
+}
+
+static void compile_all()
+{
+  printf("// Straight-line isogeny tree traversals compiled from the strategy tables of\n");
+  printf("// sidh.h by tools/strategy.c (./strategy compile > src/traversal.h), do not edit.\n");
+  printf("// On input pts[0] holds the kernel point, the point that is multiplied lives\n");
+  printf("// in pts[npts] right above the npts stacked points.\n");
+  if (OALICE_BITS & 1) 
+    printf("// The traversals of Alice include the initial 2-isogeny of the odd e2.\n");
+  printf("\n");
+  printf("#ifndef _TRAVERSAL_H\n#define _TRAVERSAL_H\n\n#include \"sidh.h\"\n\n");
+  compile_strategy("Alice_kg", strat_Alice_kg, MAX_Alice, 4, TRAVERSE_KG);
+  compile_strategy("Alice_ss", strat_Alice_ss, MAX_Alice, 4, TRAVERSE_SS);
+  compile_strategy("Bob_kg", strat_Bob_kg, MAX_Bob, 3, TRAVERSE_KG);
+  compile_strategy("Bob_ss", strat_Bob_ss, MAX_Bob, 3, TRAVERSE_SS);
+  printf("#endif\n");
+}
+
+// --------------------------------------------------------------------------
+// fixed-basis ladder tables 
+
+// lane 0 of { XR0+ZR0, XR0-ZR0 } for R0 = [2^i]Q, 0 <= i < nbits, where Q is 
+// the basis point of gen on E0 (A = 6, C = 1)
+static void print_table(const char *name, const char *size, const uint64_t *gen, const int nbits)
+{
+  static f2elm_t tab[OALICE_BITS > OBOB_BITS ? OALICE_BITS : OBOB_BITS][2];
+  f2elm_t xQ, A24plus, C24;
+  int i, j, k;
+
+  for (j = 0; j < NWORDS; j++) {
+    xQ[0][j] = VSET1(gen[j+2*NWORDS]);
+    xQ[1][j] = VSET1(gen[j+3*NWORDS]);
+    A24plus[0][j] = VSET1(mont_R[j]);
+    A24plus[1][j] = VZERO;
+  }
+  fp2add(A24plus, A24plus, A24plus);    // A24plus = 2
+  fp2add(C24, A24plus, A24plus);        // C24 = 4
+  fp2add(A24plus, C24, C24);            // A24plus = 8
+  ladder_table_vec(tab, xQ, A24plus, C24, nbits);
+
+  printf("static const uint64_t %s[%s][4][NWORDS] = {\n", name, size);
+  for (i = 0; i < nbits; i++) {
+    for (k = 0; k < 4; k++) {
+      printf(k == 0 ? "  { {" : "    {");
+      for (j = 0; j < NWORDS; j++)
+        printf(" 0x%013llX%s", (unsigned long long)((uint64_t *)&tab[i][k>>1][k&1][j])[0], j < NWORDS-1 ? "," : " ");
+      printf(k < 3 ? "},\n" : "} }%s\n", i < nbits-1 ? "," : "");
+    }
+  }
+  printf("};\n\n");
+}
+
+static void tables_all()
+{
+  printf("// Fixed-basis ladder tables of LADDER3PT_fixed computed by tools/strategy.c\n");
+  printf("// (./strategy tables > src/ladder_table.h), do not edit.\n");
+  printf("// ladder_table_X[i] = { XR0+ZR0, XR0-ZR0 } (real and imaginary parts) for \n");
+  printf("// R0 = [2^i]Q, where Q is the basis point of X_gen on E0.\n\n");
+  printf("#ifndef _LADDER_TABLE_H\n#define _LADDER_TABLE_H\n\n#include \"curve.h\"\n\n");
+  print_table("ladder_table_A", "OALICE_BITS", A_gen, OALICE_BITS);
+  print_table("ladder_table_B", "OBOB_BITS-1", B_gen, OBOB_BITS-1);
+  printf("#endif\n");
+}
+
+int main(int argc, char *argv[])
+{
+  strat_cost_t cAkg, cAss, cBkg, cBss;
+  int n;
+
+  if (argc > 1 && strcmp(argv[1], "compile") == 0) {
+    compile_all();
+    return 0;
+  }
+  if (argc > 1 && strcmp(argv[1], "tables") == 0) {
+    tables_all();
+    return 0;
+  }
+
+  measure_costs(&cAkg, &cAss, &cBkg, &cBss);
+
+  printf("// measured costs in cycles\n");
+  printf("// xDBLe(2): %llu, xTPLe(1): %llu\n", (unsigned long long)cAkg.step, (unsigned long long)cBkg.step);
+  printf("// eval_4_isog_multi(n) kg:");
+  for (n = 0; n <= MAX_INT_POINTS_ALICE; n++) printf(" %llu", (unsigned long long)cAkg.eval[n]);
+  printf("\n// eval_4_isog_multi(n) ss:");
+  for (n = 0; n <= MAX_INT_POINTS_ALICE; n++) printf(" %llu", (unsigned long long)cAss.eval[n]);
+  printf("\n// eval_3_isog_multi(n) kg:");
+  for (n = 0; n <= MAX_INT_POINTS_BOB; n++) printf(" %llu", (unsigned long long)cBkg.eval[n]);
+  printf("\n// eval_3_isog_multi(n) ss:");
+  for (n = 0; n <= MAX_INT_POINTS_BOB; n++) printf(" %llu", (unsigned long long)cBss.eval[n]);
+  printf("\n\n");
+
+  generate("strat_Alice_kg", "MAX_Alice-1", strat_Alice_kg, MAX_Alice, &cAkg, MAX_INT_POINTS_ALICE);
+  generate("strat_Alice_ss", "MAX_Alice-1", strat_Alice_ss, MAX_Alice, &cAss, MAX_INT_POINTS_ALICE);
+  generate("strat_Bob_kg", "MAX_Bob-1", strat_Bob_kg, MAX_Bob, &cBkg, MAX_INT_POINTS_BOB);
+  generate("strat_Bob_ss", "MAX_Bob-1", strat_Bob_ss, MAX_Bob, &cBss, MAX_INT_POINTS_BOB);
+
+  return 0;
+}
@@ -0,0 +1,228 @@
+/********************************************************************************************
+* Abstract: run tests against known answer test vectors, INSTANCES vectors per batch
+*
+* Modified from a file created by Bassham, Lawrence E (Fed) on 8/29/17.
+* Copyright © 2017 Bassham, Lawrence E (Fed). All rights reserved.
+*********************************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include "rng/rng.h"
+#include "../src/sike.h"
+
+
+#define MAX_MARKER_LEN      50
+#define KAT_SUCCESS          0
+#define KAT_FILE_OPEN_ERROR -1
+#define KAT_VERIFICATION_ERROR -2
+#define KAT_DATA_ERROR      -3
+#define KAT_CRYPTO_FAILURE  -4
+
+int     FindMarker(FILE *infile, const char *marker);
+int     ReadHex(FILE *infile, unsigned char *A, int Length, char *str);
+void    fprintBstr(FILE *fp, char *S, unsigned char *A, unsigned long long L);
+
+int
+main()
+{
+    char                fn_rsp[64];
+    FILE                *fp_rsp;
+    unsigned char       seed[INSTANCES][48];
+    int                 count[INSTANCES];
+    static uint8_t      pk[INSTANCES][CRYPTO_PUBLICKEYBYTES], sk[INSTANCES][CRYPTO_SECRETKEYBYTES];
+    static uint8_t      ct[INSTANCES][CRYPTO_CIPHERTEXTBYTES], ss[INSTANCES][CRYPTO_BYTES], ss1[INSTANCES][CRYPTO_BYTES];
+    static uint8_t      pk_rsp[INSTANCES][CRYPTO_PUBLICKEYBYTES], sk_rsp[INSTANCES][CRYPTO_SECRETKEYBYTES];
+    static uint8_t      ct_rsp[INSTANCES][CRYPTO_CIPHERTEXTBYTES], ss_rsp[INSTANCES][CRYPTO_BYTES];
+    uint8_t             kcoins[CRYPTO_KEYPAIR_COINBYTES], ecoins[CRYPTO_ENC_COINBYTES];
+    int                 n, k, vectors = 0, batches = 0;
+    int                 done;
+    
+    sprintf(fn_rsp, "./KAT/PQCkemKAT_%d.rsp", CRYPTO_SECRETKEYBYTES);
+    if ( (fp_rsp = fopen(fn_rsp, "r")) == NULL ) {
+        printf("Couldn't open <%s> for read\n", fn_rsp);
+        return KAT_FILE_OPEN_ERROR;
+    }
+    
+    done = 0;
+    do {
+        // read the next (up to) INSTANCES vectors
+        for (n = 0; n < INSTANCES; n++) {
+            if ( !FindMarker(fp_rsp, "count = ") || fscanf(fp_rsp, "%d", &count[n]) != 1 ) {
+                done = 1;
+                break;
+            }
+            if ( !ReadHex(fp_rsp, seed[n], 48, "seed = ") ||
+                 !ReadHex(fp_rsp, pk_rsp[n], CRYPTO_PUBLICKEYBYTES, "pk = ") ||
+                 !ReadHex(fp_rsp, sk_rsp[n], CRYPTO_SECRETKEYBYTES, "sk = ") ||
+                 !ReadHex(fp_rsp, ct_rsp[n], CRYPTO_CIPHERTEXTBYTES, "ct = ") ||
+                 !ReadHex(fp_rsp, ss_rsp[n], CRYPTO_BYTES, "ss = ") ) {
+                printf("ERROR: unable to read vector %d from <%s>\n", count[n], fn_rsp);
+                return KAT_DATA_ERROR;
+            }
+        }
+        if (n == 0) break;
+
+        // each vector seeds its own DRBG and draws s, SK and m in the order of the 
+        // reference crypto_kem_keypair and crypto_kem_enc, the lanes of a partial 
+        // batch repeat the first vector 
+        for (k = 0; k < INSTANCES; k++) {
+            randombytes_init(seed[(k < n) ? k : 0], NULL, 256);
+            randombytes(kcoins + k*MSG_BYTES, MSG_BYTES);
+            randombytes(kcoins + INSTANCES*MSG_BYTES + k*SECRETKEY_B_BYTES, SECRETKEY_B_BYTES);
+            randombytes(ecoins + k*MSG_BYTES, MSG_BYTES);
+        }
+
+        crypto_kem_keypair_derand((uint8_t *)pk, (uint8_t *)sk, kcoins);
+        crypto_kem_enc_derand((uint8_t *)ct, (uint8_t *)ss, (uint8_t *)pk, ecoins);
+        crypto_kem_dec((uint8_t *)ss1, (uint8_t *)ct, (uint8_t *)sk);
+
+        for (k = 0; k < n; k++) {
+            if ( memcmp(pk[k], pk_rsp[k], CRYPTO_PUBLICKEYBYTES) != 0 ) {
+                printf("ERROR: pk of count = %d is different from <%s>\n", count[k], fn_rsp);
+                fprintBstr(stdout, "expected: ", pk_rsp[k], CRYPTO_PUBLICKEYBYTES);
+                fprintBstr(stdout, "computed: ", pk[k], CRYPTO_PUBLICKEYBYTES);
+                return KAT_VERIFICATION_ERROR;
+            }
+            if ( memcmp(sk[k], sk_rsp[k], CRYPTO_SECRETKEYBYTES) != 0 ) {
+                printf("ERROR: sk of count = %d is different from <%s>\n", count[k], fn_rsp);
+                fprintBstr(stdout, "expected: ", sk_rsp[k], CRYPTO_SECRETKEYBYTES);
+                fprintBstr(stdout, "computed: ", sk[k], CRYPTO_SECRETKEYBYTES);
+                return KAT_VERIFICATION_ERROR;
+            }
+            if ( memcmp(ct[k], ct_rsp[k], CRYPTO_CIPHERTEXTBYTES) != 0 ) {
+                printf("ERROR: ct of count = %d is different from <%s>\n", count[k], fn_rsp);
+                fprintBstr(stdout, "expected: ", ct_rsp[k], CRYPTO_CIPHERTEXTBYTES);
+                fprintBstr(stdout, "computed: ", ct[k], CRYPTO_CIPHERTEXTBYTES);
+                return KAT_VERIFICATION_ERROR;
+            }
+            if ( memcmp(ss[k], ss_rsp[k], CRYPTO_BYTES) != 0 ) {
+                printf("ERROR: ss of count = %d is different from <%s>\n", count[k], fn_rsp);
+                fprintBstr(stdout, "expected: ", ss_rsp[k], CRYPTO_BYTES);
+                fprintBstr(stdout, "computed: ", ss[k], CRYPTO_BYTES);
+                return KAT_VERIFICATION_ERROR;
+            }
+            if ( memcmp(ss[k], ss1[k], CRYPTO_BYTES) != 0 ) {
+                printf("crypto_kem_dec returned bad 'ss' value for count = %d\n", count[k]);
+                fprintBstr(stdout, "encaps: ", ss[k], CRYPTO_BYTES);
+                fprintBstr(stdout, "decaps: ", ss1[k], CRYPTO_BYTES);
+                return KAT_CRYPTO_FAILURE;
+            }
+        }
+        vectors += n;
+        batches++;
+
+    } while ( !done );
+    
+    fclose(fp_rsp);
+    printf("Known Answer Tests PASSED (%d vectors in %d batches). \n", vectors, batches);
+    printf("\n\n");
+
+    return KAT_SUCCESS;
+}
+
+
+//
+// ALLOW TO READ HEXADECIMAL ENTRY (KEYS, DATA, TEXT, etc.)
+//
+
+int
+FindMarker(FILE *infile, const char *marker)
+{
+    char    line[MAX_MARKER_LEN];
+    int     i, len;
+    int     curr_line;
+
+    len = (int)strlen(marker);
+    if ( len > MAX_MARKER_LEN-1 )
+        len = MAX_MARKER_LEN-1;
+
+    for ( i=0; i<len; i++ )
+      {
+        curr_line = fgetc(infile);
+        line[i] = curr_line;
+        if (curr_line == EOF )
+          return 0;
+      }
+    line[len] = '\0';
+
+    while ( 1 ) {
+        if ( !strncmp(line, marker, len) )
+            return 1;
+
+        for ( i=0; i<len-1; i++ )
+            line[i] = line[i+1];
+        curr_line = fgetc(infile);
+        line[len-1] = curr_line;
+        if (curr_line == EOF )
+            return 0;
+        line[len] = '\0';
+    }
+
+    // shouldn't get here
+    return 0;
+}
+
+//
+// ALLOW TO READ HEXADECIMAL ENTRY (KEYS, DATA, TEXT, etc.)
+//
+int
+ReadHex(FILE *infile, unsigned char *A, int Length, char *str)
+{
+    int              i, ch, started;
+    unsigned char    ich;
+
+    if ( Length == 0 ) {
+        A[0] = 0x00;
+        return 1;
+    }
+    memset(A, 0x00, Length);
+    started = 0;
+    if ( FindMarker(infile, str) )
+        while ( (ch = fgetc(infile)) != EOF ) {
+            if ( !isxdigit(ch) ) {
+                if ( !started ) {
+                    if ( ch == '\n' )
+                        break;
+                    else
+                        continue;
+                }
+                else
+                    break;
+            }
+            started = 1;
+            if ( (ch >= '0') && (ch <= '9') )
+                ich = ch - '0';
+            else if ( (ch >= 'A') && (ch <= 'F') )
+                ich = ch - 'A' + 10;
+            else if ( (ch >= 'a') && (ch <= 'f') )
+                ich = ch - 'a' + 10;
+            else // shouldn't ever get here
+                ich = 0;
+            
+            for ( i=0; i<Length-1; i++ )
+                A[i] = (A[i] << 4) | (A[i+1] >> 4);
+            A[Length-1] = (A[Length-1] << 4) | ich;
+        }
+    else
+        return 0;
+
+    return 1;
+}
+
+void
+fprintBstr(FILE *fp, char *S, unsigned char *A, unsigned long long L)
+{
+    unsigned long long  i;
+
+    fprintf(fp, "%s", S);
+
+    for ( i=0; i<L; i++ )
+        fprintf(fp, "%02X", A[i]);
+
+    if ( L == 0 )
+        fprintf(fp, "00");
+
+    fprintf(fp, "\n");
+}
@@ -0,0 +1,3017 @@
+// Fixed-basis ladder tables of LADDER3PT_fixed computed by tools/strategy.c
+// (./strategy tables > src/ladder_table.h), do not edit.
+// ladder_table_X[i] = { XR0+ZR0, XR0-ZR0 } (real and imaginary parts) for 
+// R0 = [2^i]Q, where Q is the basis point of X_gen on E0.
+
+#ifndef _LADDER_TABLE_H
+#define _LADDER_TABLE_H
+
+#include "curve.h"
+
+static const uint64_t ladder_table_A[OALICE_BITS][4][NWORDS] = {
+  { { 0x279870D019ACA, 0x4E08B9FFB5C3E, 0x6056DB3BB1739, 0x24EDE549F005A, 0x3294E3FBA5887, 0x19170AC11C871, 0x7F26A6526E6A4, 0x5A9C1445E5DA1, 0x6F7AD2993CC73, 0x4EF003D79D06C, 0x41F172C682669, 0x06EDEC4673E90, 0x5FCD107CFF867, 0x3FDA629EAA669, 0x0001770AB6D71 },
+    { 0x7E6EB7E60F3E9, 0x2C10FA03BCFB3, 0x62E3D68FDFF3A, 0x5BF217376CBE3, 0x180C64F4FC539, 0x4592710E2FCF5, 0x4130DD174B908, 0x1B1B4667CB929, 0x3E7B5EA48DFB2, 0x1AFE81EE0644E, 0x399B9A1ECEF3D, 0x63BCAE910E35B, 0x4CF924FE81F7B, 0x2A35524BA0B16, 0x000110A1FAE00 },
+    { 0x279870D01085E, 0x4E08B9FFB5C3E, 0x6056DB3BB1739, 0x24EDE549F005A, 0x3294E3FBA5887, 0x19170AC11C871, 0x7F26A6526E6A4, 0x2C3BC6CF05DA1, 0x71CC2D118375D, 0x6214A09F1B52E, 0x2309C04CF919F, 0x2D760B7F7689A, 0x6740630DE0612, 0x3B6B2C9FA5F92, 0x0002996111E01 },
+    { 0x7E6EB7E60F3E7, 0x2C10FA03BCFB3, 0x62E3D68FDFF3A, 0x5BF217376CBE3, 0x180C64F4FC539, 0x4592710E2FCF5, 0x4130DD174B908, 0x1393EF567B929, 0x4D57DC375EA46, 0x0554EE5656241, 0x05CF8594C32F4, 0x2987D4058EBAA, 0x42B1F2094761C, 0x7138D6EFC8975, 0x00048FD0A4EFB } },
+  { { 0x2F41BABC30CCB, 0x1C6FD124B0F1D, 0x17DB20678527E, 0x6E6A77DB4ADAD, 0x00C36862BCED2, 0x7132058FACB12, 0x64F15F8AF7C2F, 0x44936DDA19873, 0x385FA4F2C5F1A, 0x2673B50A77AA7, 0x0057EE321788D, 0x136491437930D, 0x41D3FD50F21AD, 0x04F9E54377159, 0x00045D7E563B9 },
+    { 0x661E4817F39D6, 0x339BAA5D71FA1, 0x03C9EEA3B82F1, 0x1354A8C3EC328, 0x53A7771531AC9, 0x38F5C03010323, 0x79EF4A0ADD5E4, 0x0C9EBF843A7B6, 0x612BDB6F598A4, 0x0E15063DDAEF8, 0x3547D1CAC6313, 0x23DEFE01314B6, 0x3128895DE9529, 0x230D7948B1AE9, 0x000155D42D6E6 },
+    { 0x504EECA24FCF3, 0x6155FC469B272, 0x1B5830AC45620, 0x6E4ED12FD3455, 0x345C920A22E06, 0x6B6815F355008, 0x70ECE09D176C6, 0x4DD23D03D3A61, 0x2D7228CC2A879, 0x15D2B58DD6F15, 0x5E462031DC70F, 0x2F3B4A3F7A61F, 0x6F2E2139AB75D, 0x0D0FA759DB28C, 0x000140B776090 },
+    { 0x3596DBBDE6790, 0x755E51758ECDC, 0x6459B5CE8A491, 0x215049C0A7B4B, 0x1B568373F8D2A, 0x6DF9C6BDA5C08, 0x63ECA4EEC0070, 0x2C9B624CC4C24, 0x30C607FF0574D, 0x15ED62DE3A251, 0x04B356BC15546, 0x3968E6D91EEB6, 0x05D60AD46C584, 0x63E67DC6C44AC, 0x0003FEAE58783 } },
+  { { 0x6BF898D19062D, 0x60769D5F6D56A, 0x70613DD499F3B, 0x61F38757D5D4C, 0x278B3BE7265CE, 0x3A35081652159, 0x6EB59D0D974B4, 0x6DC570FAB3C3D, 0x09D41D03F5C68, 0x2AD7E9656424E, 0x7CFBF0E2FF6C4, 0x31139D2FD2CA3, 0x5C043B9C0BAAA, 0x2F8ACD5514361, 0x000135FEC5E31 },
+    { 0x546FFA5CCC002, 0x5AD5E836AF163, 0x6DDE2C3B93152, 0x2222E168551AD, 0x0B083C1780C67, 0x5138B2F4CC00A, 0x20C4D6941D9A1, 0x395AE178F7DD3, 0x0C44132ACEA53, 0x12843DA347177, 0x2D4F05D29C259, 0x2EA3F3835A76F, 0x197CEF2E5DC73, 0x58879DDE4E2EB, 0x0001ACBF3486C },
+    { 0x49E74836FE39B, 0x56CD6E6C46865, 0x6ABDF38E18C0F, 0x174A52A5A0FD2, 0x7905B077E12DC, 0x3D5A60D103B60, 0x644CDBD208306, 0x6EDEC2B5BBD32, 0x6B09BCB9ADD6B, 0x140DF3A211F17, 0x149D147576F2B, 0x1BF2319A6399E, 0x445A034E215A2, 0x2E6D76A52DD2C, 0x0004AC2D91046 },
+    { 0x5D9269AF67C16, 0x64F939C0C1937, 0x0F1CD2695AF60, 0x065C5D9EE2D54, 0x5CD3A1992026E, 0x3E4077D79C0E6, 0x39905715FA57A, 0x744E3025E59C6, 0x1795D8D3079C0, 0x47CCF1F46E2BD, 0x7B41E9AC267A5, 0x1C58483A9085C, 0x61ECAD404FA4E, 0x09EA14F26E9F5, 0x0003ECC87C7B4 } },
+  { { 0x4B0E8A7B64E03, 0x6DA9B56405BEE, 0x32CC66EFFDC08, 0x784CEBC1F29F2, 0x7E899644FF4A2, 0x055E0A84C330F, 0x024EC0006AE80, 0x58393233506ED, 0x49CB93707A801, 0x0661242DFBB54, 0x7FC346251158B, 0x57339F17EE4D4, 0x210C4D939AB9C, 0x3C9F1D75DC210, 0x0005ABB6C539D },
+    { 0x6BCCD58811288, 0x70DC9E9EF81B1, 0x0872FCB617AAF, 0x2526FD426CF65, 0x40A4F81520834, 0x2488863DC9A6F, 0x32B539A11E00E, 0x6FBC6AE9BC321, 0x527E7E2A5EE0A, 0x61BEEE831D78D, 0x771A625B525C1, 0x54A7BF8C97A80, 0x7AC85E9918DBE, 0x229B22149D939, 0x000148FC46557 },
+    { 0x43ADA5A83C25F, 0x5A7858CA84DEF, 0x4A21467925A76, 0x02BEAC96184CE, 0x11786319BB894, 0x5CAB714C7E315, 0x2B78D1D522B04, 0x551C8F69112C6, 0x0FE6DBE0110F6, 0x1E645ADE2CE3F, 0x32C80EF595405, 0x4FD7C90ED70A7, 0x3FF7259E348D2, 0x6730ED82F1031, 0x000250F5AEFDB },
+    { 0x7B4071D4FCAC2, 0x0D71257E2CCB6, 0x48BF09C897631, 0x7D4AF4B73466F, 0x396A008783B0A, 0x29D6F7AADC5BD, 0x7D3539642537B, 0x0CB6E5034E200, 0x2BE25D906E6F7, 0x71A5C6064ADA5, 0x76EEC3C7391DA, 0x281398CD45833, 0x31B72D7A3E264, 0x57A43A5B01A4C, 0x0003B3B61FA18 } },
+  { { 0x70A8D925F889E, 0x60A542F643F52, 0x7792F34DAA4F7, 0x6160E076F6A1A, 0x36C89A306518A, 0x2498A85ADB7BD, 0x2BB84B35F3F18, 0x68493948639E7, 0x7576A8F938BC9, 0x1F6DF7832CBAF, 0x7E747C222062B, 0x44E9277EC179B, 0x32E7B82294E8D, 0x0281FAE7141D2, 0x0002F79867AE3 },
+    { 0x3AD17A0845FE0, 0x72E65EBD35A06, 0x43EC2BC710AAA, 0x4750320691275, 0x49CE68E91BC1C, 0x03884D31BB080, 0x4026A006777D5, 0x39421463570ED, 0x3A59DA7C97A32, 0x1FC980ED1D899, 0x5B7FDF6BDA915, 0x18FB6AC113FED, 0x27575BC711ABD, 0x40AB65D48EEA6, 0x0001D2D9AFBAF },
+    { 0x790A8840DC8A8, 0x05979223A21ED, 0x7956CA0EBDFF6, 0x36C2CBD2F3B05, 0x3977C62947BB7, 0x73E5DEEE65BE8, 0x22C80E66604CE, 0x15E07257FEDC7, 0x2FA6B3E2E1F72, 0x7B388700C6B50, 0x24A6BD695DB99, 0x6A5CB6A8613B4, 0x73BCBDB2C3B66, 0x5B8B77887B355, 0x00015F3A619AC },
+    { 0x388EB05569DB6, 0x0B11E5B239F6E, 0x1701D496007AB, 0x23729E31E19BE, 0x2F135B5EAAFA2, 0x063AA85A56CF0, 0x6E65ABC951734, 0x5F046E58F7FF2, 0x1A9F4D93CD0B4, 0x5621FA2F64627, 0x44BB1B25CF27C, 0x1DFF8555EC763, 0x4E2AA6EEB0E99, 0x1523A1BCE080F, 0x00051F79099E7 } },
+  { { 0x238E651F70486, 0x15FB035CB215B, 0x6C0D1E16F1C78, 0x44841E1E654F3, 0x0EE921610D115, 0x28A60EE247421, 0x14157650BD75C, 0x3F26339F4AF0D, 0x2FD929F741132, 0x736F75F947A83, 0x37AC361F879FD, 0x33A63BD466FDE, 0x02C00FCE87B51, 0x5F73F2977216E, 0x00054FDE03BBE },
+    { 0x4A88DD42905E3, 0x4D03AEFB759D1, 0x6873207067B06, 0x3B4EA0722CAE2, 0x191D7BD447B6E, 0x500276507D98B, 0x2ED35665F812F, 0x58C0D6254CC34, 0x049322AC17F77, 0x4452B7CE88688, 0x351D7DF9A2A8A, 0x35071EE8DA295, 0x5B11A36879794, 0x18C2134908FF8, 0x0003172F0EE9D },
+    { 0x10FC6BD927A3E, 0x4425C785BBFB8, 0x3E15DDA55E33A, 0x13C54D7C002D2, 0x267EA0E2A172B, 0x48D62B2D3A366, 0x4BF20D0412A42, 0x45C90A13B0B5E, 0x3A06D622BDD74, 0x11E506030B433, 0x0B910C985DE6C, 0x61F933F6ACCDF, 0x3E77C5FC6A587, 0x132609933EB86, 0x0002B34DB476B },
+    { 0x7A516CCED9029, 0x69B411A8E9BD4, 0x02060B9A58151, 0x734ACC22E5DB5, 0x1533A177A1C98, 0x2F1D1A4FFB2F1, 0x1164EF03D1271, 0x691C49E599B5B, 0x69CF3A365CE6B, 0x2C90F04269761, 0x0944C5F826157, 0x1AC4214E092F1, 0x213A5B4428F51, 0x6986326E7E760, 0x000346C905695 } },
+  { { 0x421F266E7614D, 0x1B894D5847383, 0x442B19333937A, 0x74C2B96A8BADF, 0x75489E11696DA, 0x62FC1CDC2BF4F, 0x7254DB9002B8B, 0x3152482E202D3, 0x7772EB7DCE00E, 0x04378FBE18F88, 0x689BB6566F652, 0x0A67517DB3314, 0x265874B37156F, 0x3705D3BE64373, 0x0003DACC3F5F2 },
+    { 0x5899C41030A7D, 0x6982729B2510D, 0x6E1E08ABA32ED, 0x76236859D79E0, 0x28EEA229F6A44, 0x7AFD4F4EC298C, 0x3530BDA57BC2E, 0x588991256DCA8, 0x469B986886CDE, 0x304B43452CD9F, 0x1947D11CDB01C, 0x2E50E6D843CE0, 0x52B4F4CAE0742, 0x0716EC360C5F9, 0x000060F5E68B8 },
+    { 0x0675EDBF9C03F, 0x37C1B916454F3, 0x7D72F182204B2, 0x311DC6B92624D, 0x03B4EDBFDEDC8, 0x2F8B8DC46AB1A, 0x0FC4F4DCBC34C, 0x3639F67ECF3E3, 0x5128CBB160B55, 0x77E19516B808B, 0x3BE66E8FB8008, 0x384981DAB0FD7, 0x3F005F0C2CE96, 0x18C628A83C321, 0x0003B804237AB },
+    { 0x5049F1BE985A9, 0x52495E4B21F35, 0x6F2DC9F4EB034, 0x16F80249EF0C9, 0x494ADA005651A, 0x27CF004F0F686, 0x214BFB7FB0808, 0x00592E1D9A3AC, 0x16E003541DD16, 0x7E6CE053732BF, 0x498786ED1679E, 0x3FB65ACBC3030, 0x2304EAE7B5EDF, 0x3269EECE35D66, 0x00038B92E2FD5 } },
+  { { 0x187F38153C889, 0x20DA618474BA1, 0x67AFACC3571EA, 0x2ACA7A34F14BA, 0x357CBB9159AE2, 0x1C99BF7F527A5, 0x32F66A1620F0C, 0x3870C3436FF87, 0x011B813C7F51C, 0x406E82F3B2078, 0x245A16FD82F78, 0x148A3CD12BCFB, 0x43751F1686CEB, 0x5EEDAF0515AFB, 0x00042D7CA1434 },
+    { 0x2B827AC1FCEF4, 0x72E88528BBA65, 0x70EFD97BD0EB5, 0x0BDA1720ABF42, 0x6076069AEC822, 0x6614342C70562, 0x6F0A311D2944C, 0x05A65F2AA9BB8, 0x6BF10F17D8D06, 0x4C1FA33EF6ECA, 0x1ECF94706AD02, 0x10E3992D99A23, 0x209B1BE82FE92, 0x7FA4CF39040F0, 0x0001C3AD5E38B },
+    { 0x31E1FDE574EC1, 0x219308C640460, 0x2484F4471DD25, 0x14F18D2DCACFE, 0x1627A955BB3D8, 0x408E77FA4E67A, 0x450748D6E9074, 0x2888885192182, 0x6EBC7FA8F0C02, 0x6772E6AD4A431, 0x08A3628B2BC73, 0x03A633783DD35, 0x6EEBE4A30C299, 0x12BC871FA93BD, 0x0004379F20970 },
+    { 0x6D451D213E628, 0x7F79B57A4D01E, 0x39DBA44F36CD1, 0x65181761DECDF, 0x3EDF79A10B5BE, 0x5F15E06AEF81D, 0x304EFC877F1E1, 0x15DB881DE236B, 0x103692F96E21B, 0x7451E0613B25B, 0x4CF737BF37AFF, 0x42448FC16704F, 0x290EBD4405D5D, 0x35D60D820A213, 0x00026FBD256B9 } },
+  { { 0x6BA670E2EE2FC, 0x62820C0017658, 0x54FD28AB80C9D, 0x32B8CABD82FE6, 0x3D7E3F283C67E, 0x75A2A9EE090DC, 0x59477D135CC7D, 0x66E306B557FB9, 0x6F7AAF97CFB06, 0x3ED6E66DA5E75, 0x6D083BE542A64, 0x2C6E07988F15D, 0x05F7A840361E8, 0x01D651E7D79B1, 0x000309F02E8AD },
+    { 0x21E355BF9C9C5, 0x245B62D5E6D8E, 0x1EE1B3E5506F7, 0x695840917D66B, 0x6DE7077DEA1AB, 0x5AE5FEB0FECB2, 0x03BDD343AA0FE, 0x48C4519EF9441, 0x28A86658E09EE, 0x45FB18E4AF9FB, 0x58433231D5F06, 0x6B05D07C4AFCE, 0x15A5E626467F9, 0x591685A142B94, 0x0001022BBFC5E },
+    { 0x03AC0215751E8, 0x7D6523B4537A6, 0x7CDB430A2E09F, 0x18632AE900FA9, 0x08A00478C9C47, 0x1301EC3DCA4A7, 0x69686EBE8FC87, 0x55425EF5590CB, 0x6D766BE2527C9, 0x2BA0066DCC79A, 0x301D13267BDEF, 0x011B380E92DA2, 0x737AD2134CB60, 0x3009EEB80C673, 0x0004ED2F228E9 },
+    { 0x1F931B237A8E1, 0x58AAE394082C7, 0x26510B24F5453, 0x59EFBBDDEA5F2, 0x31D069CF4930C, 0x3E5D2B684C57B, 0x1B4FAD84E94FA, 0x17B0F4D4FA36B, 0x65FE5B7BE0A6C, 0x23457E95F493E, 0x4977FAE9F1A0E, 0x76166A6256913, 0x4FE94A1B265AB, 0x2C34F9F04EFD6, 0x00039E23EEC7D } },
+  { { 0x3BF4BC44C0401, 0x62938B54AB873, 0x5A42EDCC92EED, 0x06196EFA1FA57, 0x6D85C707C4BFC, 0x5F52C0125B1B8, 0x1250F1808F17A, 0x6D177049D5533, 0x312AE1C3A8D88, 0x44ABA67A2A3E0, 0x226CD4D7DB7DC, 0x4EAE17121E5EE, 0x35EF0CCF2F51D, 0x00B12F521C4DA, 0x00016581C1203 },
+    { 0x641172B35E624, 0x389211A7D6457, 0x3579A6DE30DD2, 0x13D136E689D35, 0x37B87C3C86932, 0x29CCE49A65A67, 0x7B15ECE5753EB, 0x49B10E7648BDB, 0x4970235501F83, 0x759E5B9428394, 0x0050A004426D9, 0x0E77AD364569D, 0x69E08AF959B84, 0x52063CA73B907, 0x000309B82A256 },
+    { 0x396284FD47ADF, 0x78137E0F59F96, 0x2A7C15F7F61FF, 0x73F6BF940CA9C, 0x01E4F4D238881, 0x6923E848160AC, 0x0880EB7B3805F, 0x334051725333D, 0x571150816FF87, 0x032311A60D0DE, 0x0256B1973A3D6, 0x45E073361DB2F, 0x7DEFCA90A63A5, 0x3F359730393B3, 0x00045C4187E7F },
+    { 0x59F8E28CB93EC, 0x59183C7495C89, 0x300CDC2BD1968, 0x6E3A0564568BD, 0x626E535CDA774, 0x3A59A585875C8, 0x2DB891736662D, 0x4CBE65DF9A557, 0x7D2DB8C64A794, 0x13ADD7F8B9F13, 0x05BDBD9A1EC77, 0x66C7E5CD93DF2, 0x580FC71B3609C, 0x516B090940F34, 0x0003A1E27CCA5 } },
+  { { 0x00867CE2397BA, 0x3CEA15900337D, 0x082D88E1EF099, 0x52F0D3B871C13, 0x7B2BC9BB79AF8, 0x624AD93DF412B, 0x7D1490BE23449, 0x5CDF8C48CB50A, 0x1701D02B09DB8, 0x34D77CFC8F0C5, 0x612A027D51CB2, 0x71BF77895D2C4, 0x2EA71CB62A9B0, 0x1DC285CB2F393, 0x0003093B9C5BC },
+    { 0x30FCA2C5C215D, 0x6BFD8E01316A9, 0x48D319BA66E2A, 0x35CD5A692D274, 0x15DE614C270E9, 0x72495AAFF0EB1, 0x57F009FFA6BC8, 0x4AD551F7CB1BA, 0x3A320B7A15D65, 0x746FD9DF389E0, 0x312F71E637DBD, 0x5626B9A99BEC5, 0x2EBE777791C98, 0x69CED314C3B24, 0x0002462646EA5 },
+    { 0x052CA9E201A12, 0x59D95636FDD98, 0x51F570BB5C21D, 0x3841B0E3CD642, 0x4BDF0BBA30C06, 0x5C1974868D8C0, 0x6CAAB09055395, 0x25BEE839E5C6C, 0x43014F0B11761, 0x07995BC6E43BD, 0x5BDBDBD39F88F, 0x5C1A0A5B006EC, 0x15013FA2C5B8A, 0x1E17A3FFE6788, 0x0005B1EF43BE9 },
+    { 0x3D85A1804B597, 0x339E1BB1B9033, 0x7EFBBF925B3F5, 0x5D9D7B2B186DE, 0x76A738C9DF06E, 0x3FA65ACEC084A, 0x2F224816DCD76, 0x132E56D1DD689, 0x78C0F289E3DC3, 0x75F0D059B27BD, 0x10199380BD909, 0x05C4840D92F8E, 0x7106F2E48009D, 0x6104FC039D7A4, 0x0002EB08613EF } },
+  { { 0x0CB3F474F44D2, 0x6A5303B1FE5C5, 0x3F13FCFAFE222, 0x49748C8509F2C, 0x384B9E80F14D1, 0x006CFABBA9E10, 0x3F92E05D91AA8, 0x7EC5DD520D695, 0x7C2F861D4A2A8, 0x70F04E842923C, 0x525917BE7A481, 0x58A2A909C4800, 0x5116A12A33D67, 0x52A1773C8B7AE, 0x0002332688ED8 },
+    { 0x10F3AA32BE65A, 0x67990D65CF0F6, 0x481B04BEB2CD6, 0x333B8BB0AE888, 0x129584BDA6CCC, 0x62390B8F38E2F, 0x1D56A852BD5F2, 0x77A4D710333DB, 0x622798025DBF0, 0x64C98A5901049, 0x36C3FFA99B768, 0x04165B828BBC1, 0x76A0890A160FD, 0x4DEC916BE7668, 0x0002364B1C574 },
+    { 0x759DFD06B0446, 0x5301C8DC694AB, 0x573E47E7AA061, 0x4D6D3429FFBFE, 0x70EA70EB8D7AC, 0x142D67671B4AA, 0x6E8EEE3D639ED, 0x29D6CEFE587AE, 0x09F47768FD1C1, 0x239108D8BDF76, 0x043791E666E0A, 0x4A80DCEA13374, 0x1E1C5CDB9DE50, 0x5C61B6E398ADB, 0x0002812A99953 },
+    { 0x2921567EC7BE0, 0x1F6D4B24D9AD7, 0x05B270081A16E, 0x3F5E7AAB5CA93, 0x14676E20D9193, 0x2B05ACF7C2343, 0x3E3EDA008AF92, 0x6E0A250E45333, 0x19247949A1C01, 0x0BE42607C0D43, 0x44696A9CEF6C4, 0x6E038AF6F1DDD, 0x69C11FC514049, 0x05F4038589C73, 0x0004A7D81BB5B } },
+  { { 0x7852D5DCA6169, 0x3EB9BA1D436E6, 0x7A7459A871BD7, 0x29965F8CAF3EC, 0x4C426675F67FB, 0x2B90D4CE22D46, 0x5F426C886084C, 0x16F40D9A92C59, 0x74D73864671AA, 0x7DDC9A0FA27A4, 0x5AC611D2C136D, 0x4203477DC8D38, 0x4554F5731B07F, 0x1C4E3173C1F40, 0x0005A7A7DAD2C },
+    { 0x79FCDD712750B, 0x0A040BD58F817, 0x75B033F63A85F, 0x48C7CB63CCF91, 0x3ECCF2D202CC3, 0x75AA4B7478E5D, 0x243B7F6BAFF52, 0x751D2F4C251E6, 0x778E430BD54CB, 0x13037CEA00A06, 0x51F218DC5B4AE, 0x131177B0113BB, 0x2931AE669F5A4, 0x252CA3A7DCE31, 0x000266B00E75B },
+    { 0x6B60C4E3FB7D1, 0x28F051A2D97D8, 0x19B119FFF862C, 0x7101FF241E758, 0x7780CB2276DC7, 0x33DA0F24662CA, 0x7E2B71CD3BCCD, 0x482CFE4C20074, 0x04C4D90848EB2, 0x7571D34AD98B6, 0x74BDBD0B335EC, 0x3CAD48F94375E, 0x27A110924C3C9, 0x5EEE3D78255D5, 0x00024ADF1319F },
+    { 0x2C41BC8963439, 0x74FBA22EE042C, 0x600D21123212F, 0x6DD4BBB0B85BA, 0x7595414EC00E3, 0x7E24DEA4AF266, 0x38B97869D5136, 0x2D6F894F57D5D, 0x2FB3DA833E3A5, 0x02882F38300F0, 0x0301048610F7F, 0x62713DF5F6A8D, 0x6452C7203C202, 0x196EA1D031914, 0x00048454F57E5 } },
+  { { 0x3774DFC0EE977, 0x1B08710FEAC75, 0x302AAFC9C260D, 0x1683D4A1DBBC2, 0x783A19DB8E6B6, 0x381EE415E1AF1, 0x05EF3E37071EC, 0x796066E86398B, 0x22D488DA4C91A, 0x7E20A13565A50, 0x39B95D7FFD9C6, 0x68698E5051F17, 0x23501CB3581E7, 0x30F7E05F764E6, 0x0003F0A8149D6 },
+    { 0x37D7A0850BF15, 0x7238176C90E03, 0x2E8AA74C8561F, 0x221A93D7E8D09, 0x5140F335561F6, 0x686FC407B51F9, 0x46449EB20A84F, 0x6989650F87331, 0x77B6062DF02A0, 0x5FCC0BF39DDD5, 0x5B2747D471FD7, 0x1CB4F745C9412, 0x37872387918E4, 0x6130E17A6543F, 0x0002126A6E672 },
+    { 0x38710064FDA57, 0x24D852F574FE3, 0x073F7E572E661, 0x3CCEDDCE566A2, 0x657226FCFFE8E, 0x41ECE6B35C376, 0x7B10227760512, 0x31B005F80B2E5, 0x16BED90BB8EEE, 0x57552F9F6541B, 0x2707BC387A83A, 0x601C4FA66737E, 0x7AB82036A3664, 0x5AC91DF770C51, 0x00035B75FC944 },
+    { 0x06215C74A0A75, 0x15CE96D5DC8DC, 0x1E689519D0176, 0x2FA6C70F92FA5, 0x79CB14D94C404, 0x65601E9118A60, 0x580E084DF67F9, 0x1CDD7AA028356, 0x6C5F7487272AF, 0x77FAE50A3E069, 0x5C074850F7E91, 0x53C26A64A502D, 0x2722B50B3072F, 0x668DB28C3BAE3, 0x000416FCC0212 } },
+  { { 0x2266A63189E3C, 0x1E87DDD4103A0, 0x64DDEB8553830, 0x17C600D8A6FEF, 0x3CDF40E3B86A4, 0x7F516E5F8B505, 0x4FA8CCFA5F2E1, 0x6F4975A90F385, 0x1A0F5BD1B187E, 0x03FBAD490C41B, 0x14CF6773AAB99, 0x11931AECAF8F6, 0x26DD24535B9F0, 0x406F5394C7889, 0x0001C046DDDC6 },
+    { 0x316DA5180D582, 0x3C5EDAC58FCB8, 0x073F4D970F918, 0x64B66642C6C98, 0x0575CE5FD8F9D, 0x2934911563251, 0x53D522B42C999, 0x10BF420C18236, 0x42C2C422F1BD0, 0x088503B4FC523, 0x42E4645F45B8A, 0x1BBDABEE83F9B, 0x732C94701887B, 0x066C1162613E8, 0x00013DF02115C },
+    { 0x1D586E223A84E, 0x678B26416FD9E, 0x6547C89F388BB, 0x42A481A7DE3DA, 0x7BD39EA05AB39, 0x074E481B89F00, 0x3E5328E276C79, 0x1B17FFCF7DC33, 0x5E199817F6BAA, 0x7E0744F3AD650, 0x6E2D29A696A11, 0x79A5F9CA9BCCB, 0x579EA274C3329, 0x7164821B0AD13, 0x0002770C9F2BC },
+    { 0x48D5B6F28DB52, 0x5D19D3811ECDD, 0x0A3E6DD24F264, 0x7E2CF637A78B7, 0x0AB4F0AA53279, 0x3D2E26680D280, 0x4D06217A81F46, 0x4C175E941CE0E, 0x1A84780BCC763, 0x2EE05A8CFFADF, 0x3689FE824552A, 0x18B706198EBB9, 0x4C5171DB7E2BD, 0x1E9FFC5AE5320, 0x000332BF8D097 } },
+  { { 0x5D71BBCD4CADA, 0x3013259CB4768, 0x0A67128C2346B, 0x204B92664C881, 0x376021D34DBB1, 0x2FE8F76429CD5, 0x36F5BB306F53B, 0x5A322630B7B86, 0x2E8424FA88572, 0x7235F9AA292FA, 0x656B6A1886E43, 0x63C91A97D5D04, 0x79D27488E34CB, 0x03BDAA003F555, 0x00023AD37D6AB },
+    { 0x21AA134D46B44, 0x2B7218E99931E, 0x0D43B88A2A801, 0x2B72ED5F96F13, 0x2A5D9EDEC2023, 0x13457A2A0521F, 0x6889B484EFB89, 0x2535B5F56B424, 0x3FDE1FF3E0B0B, 0x502F7FFE2267F, 0x3F217EB4C3431, 0x56258B2B1B089, 0x5AD25AEDD8430, 0x6AF552E2F0A9E, 0x0000CD471A2D5 },
+    { 0x0CAEA2A39DB48, 0x3947B413A6501, 0x2C9A71A6431FB, 0x1A65962DF1EED, 0x4E51026781B53, 0x1483F3AC83D60, 0x78C746717267A, 0x63601A5EC1E2A, 0x02D38DAFA894C, 0x053E216C485C7, 0x23885BC80D4D5, 0x1C4481DB56E10, 0x48E7478A630E7, 0x2F3F4F11C19C8, 0x0003B64F23C97 },
+    { 0x2C96D358ECC6A, 0x28A251709206D, 0x2E40E851514BF, 0x6950E56360ED6, 0x3699BB6228809, 0x43367766E33C6, 0x066881D1975D1, 0x4F69900F5854C, 0x32BA95880E0D9, 0x09B4FD34D2FC4, 0x449485D102267, 0x50CB2643CF847, 0x05A5A26923C4B, 0x2DAA6506659A8, 0x000357287DAA3 } },
+  { { 0x6A4F8D1E18BAD, 0x5744F2EA5C1E4, 0x4D7EE7146F2DC, 0x54003EC9D95E9, 0x28B9DEE181FC7, 0x45175BBB2B9B5, 0x39094441E39A3, 0x42A68D54DA516, 0x464CC77460DA7, 0x0CB64B790FA5F, 0x033B814F14696, 0x1D7E1BA058DC7, 0x153E905382EA2, 0x47686C93BAE36, 0x00010322E73B5 },
+    { 0x766CDDDCE0B71, 0x22AEE4C9B6EA2, 0x11670676E0B0E, 0x0BE8D57B9C2AB, 0x1184A22E130D5, 0x44BD0BE8FE747, 0x04747969B0F4F, 0x6BF1FD22AA2BE, 0x6EF637B04C00F, 0x62D27AFB83E07, 0x5EBA4ED80B48D, 0x1226EB95F5ACC, 0x4564BAE994313, 0x0C6B1A56944F8, 0x0000B2393FD2D },
+    { 0x238D3CE2CCA07, 0x736B023A36291, 0x1B39BEE17AD37, 0x23BA4DF66C639, 0x71FA944C6F2E8, 0x55E187004D2D9, 0x79D7427433D21, 0x567C2B03DBABC, 0x60DF02C52B100, 0x3E828C9E1509E, 0x648F168CAD2EA, 0x45E2CB55BC1D7, 0x3DA30B48515DB, 0x475226DCE4816, 0x000309B710A0D },
+    { 0x39CA02F07F599, 0x0144CA74629C8, 0x78BBE59EB5BF1, 0x0BF384FE73ABC, 0x7EA61DA20E155, 0x7D20C99276250, 0x33C72C3ED9BB2, 0x7FFB48AA42265, 0x4DC6AE807C786, 0x30AA1B53E6B4E, 0x5B2629634F860, 0x2DE5414A1A5D1, 0x6E0DBA538D446, 0x401B65AE9545F, 0x0003771670CF1 } },
+  { { 0x77287C0DFA824, 0x7786F601B5D22, 0x15F31751DEE18, 0x0F203DA924288, 0x0A618464E3A2A, 0x40E778D5C5209, 0x75F33C9D59271, 0x00B1584D8ADBF, 0x2D6E415C2AABD, 0x278806A6F5BA7, 0x2C9A5FDDE7F1F, 0x031A662BC04B3, 0x338F777343A0D, 0x4F3FDCEC9F610, 0x0005390F7C123 },
+    { 0x55469BBEB1E95, 0x2CFA2026C71F6, 0x2542555281CB4, 0x247203BC0AB53, 0x451941E169EF9, 0x6CA5D86E7B002, 0x39EB97DDB88D1, 0x48B50431C400A, 0x70FB709FE2248, 0x162AB53058BB6, 0x3210A47340247, 0x5AF21781FB309, 0x68C0B227D7B10, 0x7068E0D9F21D7, 0x00027AF939A46 },
+    { 0x033FBA2C02A68, 0x4783F724DCBE7, 0x4CF2BA6367B32, 0x23B9CFD16CA08, 0x4EF4DD0C0A15A, 0x7D15EABF9554B, 0x3EFB40FAF691C, 0x7C89AC907514D, 0x4ED7064CDF80B, 0x1D8309057C1B2, 0x2AA1218960B38, 0x25424B8E3ADB9, 0x3A19704BF9AB2, 0x5EA95E520875B, 0x0004B1B767745 },
+    { 0x055CF0943EE9B, 0x34BA3C77A743E, 0x163CFC1BDCB90, 0x39E202D6BA603, 0x7896D550FC029, 0x39F99CC411BB1, 0x16C10D774C705, 0x26786EEF08791, 0x7BE4DA31B8A72, 0x3D491C52D6FB4, 0x6B038B5EE699C, 0x5C01DD8E2A332, 0x230709AD57E18, 0x058AC22F88A03, 0x0003E47B6E615 } },
+  { { 0x5D3765373071D, 0x3C83AAF36FEAB, 0x1FEE082D6F53E, 0x49266FAA81CA9, 0x0AE57B667C620, 0x67A90F5CBFA85, 0x50794008BB5CB, 0x58A1F71A798D2, 0x3886C4084FF54, 0x509091B7EF26F, 0x0FA55CABD11B6, 0x47DB3B2ED5DCC, 0x38E7B004544C1, 0x4DD9DE5A29DC1, 0x0003DB5721AF3 },
+    { 0x11C1717EC457E, 0x5ADA9859BDF21, 0x2F7FD2BFEE03D, 0x1099B12C1B585, 0x5DE59B37D306A, 0x57C68A7197C75, 0x401242CE57B8F, 0x24CC13DB27CC0, 0x320E34F6FEFC9, 0x6FEA3CB56CAEB, 0x4AB35E2AA61E3, 0x7A250F3F92F8C, 0x18B1461315632, 0x0B6A78C082C0E, 0x0000F03D349D0 },
+    { 0x043A006FA13E3, 0x4372B05FC0B5A, 0x0E3586EA4BCBC, 0x5C5BA69036FB8, 0x5371B6E295B4F, 0x59D06BEBAADB5, 0x0E62F8D3A85CF, 0x122FEB28F939D, 0x214727E713857, 0x2AFA3F5501640, 0x4B93D8264FE7C, 0x45584C783DDAD, 0x0E166129A94EE, 0x13C95D39F0E19, 0x0000EEC91D4FD },
+    { 0x051B82A169B0E, 0x6FE7494C64F7F, 0x2285482C54BCA, 0x1167D5DCA3D0E, 0x0A4DAAF60F246, 0x1408D23B427D9, 0x21E1850EC9872, 0x32AAF9D5B107E, 0x68256DEB749D9, 0x2FE427B7D55FA, 0x3DB3872740718, 0x67ECD4AA6BE4B, 0x707CBDDE08BA6, 0x05BA2C485BEBA, 0x00045D11D3D5E } },
+  { { 0x01EE09B2A24A9, 0x62645C03D1D41, 0x5DBD71D5F648B, 0x5663EB6E15715, 0x4B6F516BDCBA0, 0x5D4E0E693ADFC, 0x44CF08086A745, 0x0AA6C1EE64CAB, 0x39947EA301F95, 0x3EE05C6224202, 0x6FE89E8806587, 0x641565C19F5BB, 0x0B308F8E9832E, 0x5126E2CB26CFE, 0x000449E811CD1 },
+    { 0x28E4E6C1809AF, 0x264347CD967B3, 0x5F5072D6730CF, 0x0119B7D0277EF, 0x0CC6DD004DFF3, 0x65FF2ADDED25F, 0x51FAC1FED3909, 0x757BCD5BA64BA, 0x26BB9EC6431D0, 0x2E8A73ACE9556, 0x0832859A4097D, 0x039529C308846, 0x1AB738E1AA7C0, 0x34825262386BC, 0x0001F1FEB7568 },
+    { 0x1787EA9EB827B, 0x27B7ACD7CB7D5, 0x128CEED8DDE54, 0x39E6A08F6EA33, 0x712C17B69ECCC, 0x3C94BF1B0ECA8, 0x16B6650E9A0AF, 0x41E983B92A275, 0x7409EC57113C9, 0x378C4E97EEF86, 0x47F88EC67F7B0, 0x685D976885F0E, 0x206AE84AC9AC8, 0x066C51DB462D8, 0x0003EA5470A99 },
+    { 0x0D0A94FDDBBCF, 0x19FA9A13C1800, 0x252ABA5C912C3, 0x5CE46996F298E, 0x317711E6A9191, 0x72034A28E08D7, 0x4FEC804901452, 0x451BE6682E361, 0x0A471E6D11B19, 0x3763C4D714843, 0x436A7F0500D9B, 0x0E89E1F4F582F, 0x17F3A14D94977, 0x60943C13C115C, 0x000261DC854B8 } },
+  { { 0x2C3C855965D8B, 0x08512226457D3, 0x71E958E1AF11A, 0x1AB83DFC97873, 0x1C9360E86B722, 0x67B669EAF2176, 0x0BDF5FFE26EE1, 0x7326D2B8D1CD8, 0x27E9EFD0F23F5, 0x6199730CCAC59, 0x369406BE31AB8, 0x0AE8BEC74734E, 0x335B81294BE0A, 0x6EA3321282F93, 0x0000DFFE0E456 },
+    { 0x4C5A562E58311, 0x4CAACB26F5DB6, 0x2E04B60E10147, 0x67A6409D0A1D5, 0x3FB0EF1FDC2D0, 0x3362C8C117727, 0x45DB82B95B103, 0x0E4B1A4ABFC79, 0x39272202E5C2E, 0x48534CA11E349, 0x5A5B575693AB5, 0x0516FF4AA785E, 0x29B677D8ED222, 0x0FE084B4E243C, 0x0001C51773378 },
+    { 0x57BE9C6301005, 0x5AE3BF1AAA43E, 0x1137754C66F92, 0x2325022877AD6, 0x2BED4FF2F6FA7, 0x2EFE4CF659F73, 0x5708CFDC6CAE8, 0x0E5BB52358B94, 0x17E5E690C4570, 0x4645885AE7FBC, 0x1C0F9CD92BDE3, 0x15EACB7FBA15A, 0x5FC7545E56EBC, 0x0D1682A425293, 0x00037D241EA43 },
+    { 0x3383CECB5093B, 0x3CDB44ED6E777, 0x629B39CF43FDB, 0x66486F904B7BB, 0x570B3D45F86A6, 0x502FEFB5F5BAA, 0x30FB370DFFCAE, 0x52BEB4EEE2687, 0x305354CC9FCDB, 0x72F0979760CFA, 0x5CFF2085A2D35, 0x47AEF68D7113C, 0x6490A9817750C, 0x64DCD8207EE0B, 0x0003E2D11468C } },
+  { { 0x5951E438A35CA, 0x46C5ED5FDA339, 0x18C2C380A6F04, 0x30F631F9AD5F9, 0x29A865A427646, 0x22E8AC3849E73, 0x1B2E62714F55F, 0x2F23ED5A5A6B9, 0x069620C9B55FE, 0x5DB24056A8078, 0x3ABE4B38596F8, 0x23897418A4B86, 0x12DA06E825ADB, 0x7FDA8A5605D0F, 0x000390CC9BB9D },
+    { 0x10FCC7995552C, 0x5E9F96D5E46A8, 0x583CEAF2C0C4E, 0x591E54297394B, 0x363C8A63F0719, 0x41D584C2066D7, 0x43C19EB03E7B1, 0x723F49BF93559, 0x196856F80BA66, 0x467B702715E71, 0x6E080E59B98B6, 0x48670731F39E9, 0x20FC05E8A9840, 0x64C25129F2415, 0x00029AFA7AA80 },
+    { 0x70869344C19D8, 0x50DC3351E7FBD, 0x44A7FC9DA9C10, 0x05149CD702A83, 0x443436B06C0E9, 0x3FF20BC2B6501, 0x7B1A1907137E4, 0x07559B47C8159, 0x47AB3D27A9C38, 0x4FFC4CC44697B, 0x6C378B06E2678, 0x163BF1110556F, 0x4566501EF58A2, 0x619C5383D28C3, 0x0005EC424A4AB },
+    { 0x090256277F50A, 0x0CF22181DBBE6, 0x535C6E45EA85C, 0x546A91BC60F19, 0x4628557C40348, 0x29EB333012F5D, 0x0EF45C0EC7B59, 0x262CFBCAD3927, 0x648615D96BFD0, 0x4D5D05FA02EA8, 0x22FF32B823A21, 0x2C20441BEE364, 0x01C0487E90817, 0x323573975E450, 0x0003E1CFF55A8 } },
+  { { 0x1D48A93B0B4D4, 0x607462B7E1E2D, 0x64049EAC9385B, 0x0FA98C814CE7B, 0x254003C7925EC, 0x50EB9A3333D21, 0x21199385DDED9, 0x389E8FE9C73A7, 0x3C55A85756F87, 0x791EA060EAC38, 0x7CF9F19C81EDC, 0x78827D8978D90, 0x65C72ADD3F10C, 0x2045A7B5596F0, 0x00031837AFB6A },
+    { 0x16F3B86ADB2A1, 0x29BE32022BC69, 0x5629F517C2738, 0x2FC3C49BE1E49, 0x2F01745B1CEBA, 0x37956C5903830, 0x0C4410B934D48, 0x0E2F2E962DB4D, 0x0E4E2C544714A, 0x7763F7EF5C2D5, 0x5373356ADAA87, 0x76045B111B6A1, 0x337F329EDD387, 0x09D9817A4B0E1, 0x0001428501A81 },
+    { 0x545A59A0532BE, 0x1E6A840556319, 0x5F50810FDEE23, 0x6523B5599A4AF, 0x61A1048466B19, 0x4891232353A80, 0x27CC4BE744050, 0x1387DD8F9F1BD, 0x1ECF3ABA2F794, 0x5FBFB777D3927, 0x0D2828070784D, 0x453FF51972CD6, 0x31017D3F62A0B, 0x510B5EF031434, 0x0003492F0EAB4 },
+    { 0x28D46C001BAF7, 0x3B4849DAFDD52, 0x4FC62782E8591, 0x50F3893C93679, 0x3AE0D7909DAAD, 0x7D989645E8990, 0x041728AFFA5FE, 0x4280C827B140F, 0x521425735A7C9, 0x6422AF61E16E9, 0x4847577427C76, 0x6EDDBFE739257, 0x6EF24A3F47DFB, 0x57C06B99B07CC, 0x00035A44782C8 } },
+  { { 0x00F6D2C2EE914, 0x5856E042AD7B8, 0x75E9A51E4AFEC, 0x41248191BFD96, 0x18C0D406C813F, 0x6093ED38348BD, 0x55204F0447C0C, 0x19B10E7DD0D14, 0x0A7F0365AE652, 0x75FBD07133491, 0x280261F0F681E, 0x5F1F1F8D7990E, 0x157817D32AEC5, 0x613987CBE712E, 0x00014CE6EAB96 },
+    { 0x5D521D2329C59, 0x5EF2E12281DFD, 0x1E3ACA2F53D45, 0x03BAA229F6306, 0x12B7105FF1FA9, 0x15950A4E31D8A, 0x273D6568D6CEE, 0x03DEA38FE0D35, 0x4BC4B1D51F0D4, 0x4B9585AA9C17E, 0x5B941D0EE11D9, 0x44B395B0BD8FC, 0x337A91C510233, 0x40752D234AC64, 0x0002DC3E57172 },
+    { 0x60DFF1A2BA1B2, 0x3B1551A36BE28, 0x46952A38FB812, 0x14E6A34892598, 0x257640801FE91, 0x376503144F176, 0x7F1663D3C4C22, 0x31082CD27F0D3, 0x7955C6E93C642, 0x0889A0562CB2A, 0x1564A38D9CA41, 0x56E466207A1C0, 0x4457302035733, 0x6F9340188322B, 0x0003AC41E304A },
+    { 0x73165E1A50BFB, 0x3B250D292C901, 0x25484D0A802B3, 0x7A8FBAD10EF9F, 0x3885F5FDDD7EF, 0x4AD74E50A9198, 0x35670B42B9111, 0x6B32992E2687F, 0x67EF81B3E5BD4, 0x20AC24623A5BF, 0x1FA4432130FB5, 0x76F4ECDF83F11, 0x139DA0DD161CA, 0x06294E7BD3256, 0x0002EEE6ED688 } },
+  { { 0x5AE91756BA457, 0x2BC006E2A2391, 0x01863EDF553C7, 0x418AD19DEBF67, 0x532B579A5EF13, 0x7F1E0F1144E7B, 0x1A149ED76BC38, 0x2B9226A135EC6, 0x500600374B463, 0x7BD5161CE1555, 0x6DEF32BE70517, 0x1C48D789992CD, 0x34680BA1878C1, 0x368AF8BAE766D, 0x00030B0A2B7AB },
+    { 0x2979E60D663AB, 0x5ADB5BDC784DB, 0x432DC174CB515, 0x3AA8687A64157, 0x463CDF67DA690, 0x1EF7E901EB2CB, 0x55280E46456FA, 0x41828BB2DFEA2, 0x39CA23B3D1B69, 0x0D42605C7188B, 0x647B7CEB6267D, 0x29A497E44F529, 0x2850740B4D0B5, 0x0B0005318C88C, 0x00020DAD73FD2 },
+    { 0x586A4FFD716CB, 0x4C8A5714E0D87, 0x384692A91DE66, 0x4990801C6E5F0, 0x69EC63F2957C8, 0x3AABBB01A0E1F, 0x7CFA5218E0424, 0x552F1CD9FC4CD, 0x0922B87BFB50B, 0x65957DA51FAAC, 0x11495BDC68E3F, 0x2E22D0EA46556, 0x21227291ABFDE, 0x4D09DDCEC93CA, 0x00053D1834F0F },
+    { 0x552BBE8E59D9F, 0x07FF4192E3A7B, 0x5EF2D449007F7, 0x5CFBB66215935, 0x312E1953F7A00, 0x2AC7D7B867343, 0x4C4B38FC1B310, 0x12E09DE1C2660, 0x28E97E7B1A022, 0x3AD2111746DE8, 0x5565A27641F91, 0x74D14DF20A712, 0x6F2F38CF2A620, 0x3DAF65FC49AB7, 0x00043F1CB4500 } },
+  { { 0x1B1A19487D52D, 0x2A51DFE265800, 0x4ED5ACCF0F6BB, 0x66B08F2A4DC31, 0x66191A0F31A55, 0x1F8CB724E165A, 0x08F17C741B939, 0x2E3E57A3B2218, 0x30FA848C6ECD3, 0x7C65510BC19EA, 0x091272001F207, 0x394A3F9CC3F76, 0x2D5E98D06E75D, 0x2D16922FB28C8, 0x0001971700DEB },
+    { 0x7ECD62641733C, 0x6BDA6CF807E5C, 0x316AC6ABA8968, 0x71327C0FFAA1B, 0x43BB1DC9C1416, 0x410DA3FDEA5CF, 0x63DFC4E88396E, 0x54EF683E14CE5, 0x5B6B1FD4451D1, 0x55BE09F2D9D5A, 0x6D9C9DC9C770C, 0x113420092C0A9, 0x435CAAF64B2D0, 0x14455F0D90D69, 0x000084321FD99 },
+    { 0x5D76E1228AF11, 0x5B4A22B2C6EBA, 0x0B966843423C0, 0x32208B9EDFE0A, 0x651B7D495BE51, 0x38812D04BA00F, 0x492C892F0B394, 0x13E0D4148CAF3, 0x54E9C54B32B4A, 0x4A7FABF649E3B, 0x7D1FF4760106D, 0x4D438E5925FF9, 0x43E5D7D77C656, 0x3548FA9F0EC12, 0x0002C4B8F418D },
+    { 0x4A5582921B794, 0x6D25ABDAA64AC, 0x17C053BC71C1C, 0x74325956ABBA7, 0x2B01617DDD49A, 0x2E0724414E2F2, 0x484C4D872FAD8, 0x18F83E5E9DDC0, 0x0C031D5CC1C2D, 0x4717EF5B719DF, 0x30C2C15AEFFA7, 0x5C3314E71015D, 0x3BA09B3B341E5, 0x171FED8B34D20, 0x000393166ECA4 } },
+  { { 0x163982E6AAA29, 0x7A7A8B0F2385E, 0x2AB50A2C6C5FC, 0x61D6CD5ECFFDD, 0x35A56C8B6D72B, 0x0250EE24E0809, 0x1659B07EC77ED, 0x1F5630C4449D0, 0x31D5895DBED8D, 0x4463AF46EBC02, 0x2BCAF85BA04A2, 0x7198E0081D7C8, 0x55A55BEBA003B, 0x365A1A283C9B9, 0x0006DD7616EDA },
+    { 0x4487C18E18B90, 0x2C9E59912F45F, 0x04711FD3D5B1F, 0x34C95EEA7EB26, 0x0E1AFBF7692EE, 0x7FF491EBE8669, 0x234D5E9031D4F, 0x7B076C8778555, 0x0C8CB795767FB, 0x168DF0C70AF6B, 0x05C81B28E4C49, 0x6994832A2C179, 0x507460561341B, 0x797A11CCD4F0A, 0x0001EAB2E8B16 },
+    { 0x3A118536E5CAB, 0x3FED2A03B35B4, 0x3F0AFDC971AB3, 0x63464BECA2E76, 0x56FDB990D300B, 0x66C275AD0E1DA, 0x42BC1B6CF23BB, 0x257047B4E856F, 0x3F336CDCDF6DD, 0x0E03168C4E535, 0x64DC37ED41FD1, 0x6DEEDA3529F0F, 0x59AA1AA1DAB86, 0x01BC6AC5F5717, 0x00039EF8AF272 },
+    { 0x62BE60850D91A, 0x5D30668125570, 0x128DD29E280E6, 0x275D6226ACF6F, 0x65AA5FB30A01D, 0x016065093B5E6, 0x5397505940F98, 0x3B4A404A8DFAB, 0x06CB6037F3247, 0x28CA2074D5461, 0x2242AC173E697, 0x57495E1A7240D, 0x57DAA85A4D2F2, 0x569757532C903, 0x0003E15CB825F } },
+  { { 0x560995359E2F4, 0x5F880A5FEAAD1, 0x07C366ACA8990, 0x6A924094B01CF, 0x08B490C0D7F1F, 0x0E20E2BCCBFBE, 0x4592A18CBCFFC, 0x636BB4DB6117F, 0x4C6C30F5AA613, 0x4E5F258356564, 0x3FBFC13193403, 0x316EC64FFF4CB, 0x1A06FFC313188, 0x454D79C05A2A7, 0x0003F8CE1A2E2 },
+    { 0x0E9A391E09201, 0x4CF9649637D5A, 0x62A7C475309A7, 0x568FF23408DEE, 0x29E97A608B6DA, 0x04EBA8DCC6A78, 0x7413795BC881F, 0x4F2C861D8FBD4, 0x24480360BB36A, 0x444D6D62D9B12, 0x005BCF7A98C72, 0x56DACD72E6007, 0x5B72C9D746BB2, 0x746024140BB6A, 0x00023CD323881 },
+    { 0x0F00C9B3EABBE, 0x3E7EAB8FB4F7A, 0x335B335D5778D, 0x21661A6D0A7F5, 0x491F8017DB17E, 0x10A1FEAEFAE49, 0x1CF253E8CFBD7, 0x6BB4004CCB794, 0x4EBE94742F0A4, 0x607829361CE2C, 0x0409497E3D450, 0x3A3A3F69DECA1, 0x6FE6892C79347, 0x41CEC685950BE, 0x000379E91B500 },
+    { 0x1D39F1178914F, 0x55C51645D79AB, 0x672561917ED6A, 0x67A249A176D47, 0x00332FB466A0E, 0x53A9647D4C564, 0x01FDF128211BC, 0x45D1C68693365, 0x2674E8699A302, 0x2E0A47A665624, 0x7E31AB55E3BEA, 0x71482D3CE5AEA, 0x4AA71CD62A354, 0x65813CE39AAED, 0x0003B27CC1F4D } },
+  { { 0x4C63E48CCC274, 0x3D92618EF6075, 0x04FD194559AD8, 0x3514D685E3821, 0x480B27191DF2E, 0x679C8F35D6639, 0x5A6FB51FDC3CE, 0x1C12660E2D16A, 0x4B5222C09EA7C, 0x6A85F9FCB2B0E, 0x600FF58FEE154, 0x343D9801A80AF, 0x459690C7CE657, 0x6D63F43807B5B, 0x0003742112688 },
+    { 0x57809E45AEE65, 0x265571A7AF281, 0x1C8D6B8754207, 0x21DAC3FDDE315, 0x0E02DCBE0A461, 0x221F3220570B0, 0x38B28355061AA, 0x27428F4B34924, 0x6B2AB0EF02EDA, 0x00EC168C89575, 0x170F8C89FB58F, 0x185A6F0D40911, 0x79C4794EE1412, 0x320933E5369BF, 0x00017D9545B87 },
+    { 0x055FD66FED534, 0x4344541B1E242, 0x6662DE64E7D31, 0x6A97FBDDBE8EE, 0x49A76E5834B08, 0x3ADF87D394F77, 0x5F350574229DF, 0x076DC42EE67EA, 0x2C65D622A819F, 0x2CB257F530D73, 0x5833E6C66230C, 0x3FAB9520EAD1E, 0x5A6D951942C5C, 0x592833A6EFB1A, 0x0004AD9012C78 },
+    { 0x3D271B61169B9, 0x6F2A6E0E4B515, 0x5453FA8E80050, 0x5F8BF94D2E8CC, 0x2CE0DA48368CB, 0x6633DDF4A3F71, 0x2D5D1B059A89F, 0x20CD81E8D3FEC, 0x532D67BC183D7, 0x0A4EC1181DA03, 0x5DD8F020A5333, 0x39FFE299C6BDF, 0x7E4FE1FC932E2, 0x76E1BF83A8B73, 0x000337ECC9E32 } },
+  { { 0x3D0284B0D772E, 0x1BE97D22378BD, 0x6B90E6A6338E6, 0x7BB02F5EBF885, 0x052DCE5728283, 0x02B026D4E2BD4, 0x0F6E8BC12FE36, 0x0620B55CCE4B9, 0x7B7E03B5004EB, 0x3CD7E8B1299CF, 0x4A56A3C93DF3C, 0x3CA866462699D, 0x6BF39E33EEF82, 0x3B8ECCF5F61DB, 0x0003BC185799A },
+    { 0x6FE83E03AD06E, 0x6477018745707, 0x3F9313FE1151C, 0x04AFF272CB451, 0x409735B480BA6, 0x60B3CE3890E69, 0x1AD4172B89312, 0x7ABAD3C59ED16, 0x1DC02E1244807, 0x6127A2B365E5E, 0x0B17A75FB85BA, 0x44051F5EA4825, 0x53B6FAF8F25AC, 0x75FEF31064A9D, 0x00017A7DA8086 },
+    { 0x438416CC110EE, 0x16C3AF1E1B80A, 0x1BF574AE49962, 0x5B45D5EED7ACE, 0x15320EBED4240, 0x3BE9A642815D4, 0x6FC2CF3EE5FAF, 0x04565C78EE695, 0x6220470264430, 0x3442580150C2C, 0x1B0DA884C557F, 0x0536AF75A0716, 0x5A01046C5BBAD, 0x15638EC3697D0, 0x00039B17D008F },
+    { 0x78ECFEE683C84, 0x27F62682E438B, 0x7DC46EFC60CA7, 0x66B8BA78E345A, 0x485E252BDE492, 0x5CE9972F36A1A, 0x033815C85B6AC, 0x0B6BF8B144722, 0x36572DAA8C88F, 0x5183BD35FB9CD, 0x66DEB9600ACF3, 0x109316CD3EA17, 0x2C4DE252F608A, 0x1AD3678D16AC3, 0x00041B8EF48A7 } },
+  { { 0x2E6A56CA721B9, 0x319412464B0F1, 0x047D9FE6375B2, 0x3B4C8649EF355, 0x6C6CDE02ECE8E, 0x7EA0C2F90EB4D, 0x6938ADE611BF8, 0x7EF8A44D685C3, 0x0D88089FE9E23, 0x0E8AC49D17966, 0x6DDDD70F5976F, 0x03B8917832B83, 0x4B6F15426538B, 0x40BDB1CF484A5, 0x0001BE18A1AC4 },
+    { 0x23DEC41212FAC, 0x4C786DB83E7C6, 0x7E5E675827370, 0x76C9E326C2AC8, 0x3CD711BE601A6, 0x704EAD148D374, 0x495F1FBC17D32, 0x49BAE8C2F3374, 0x14EB2B34C1544, 0x2C8226B490121, 0x18700890D485D, 0x689A006B2C174, 0x0F317B8D56D9F, 0x685C14B89AD13, 0x00018269FFEF8 },
+    { 0x06AF4310AC887, 0x10ABBCFA9872E, 0x33C56C5E87970, 0x6E9AEA68F4BD3, 0x1395673734A1D, 0x7EAC831C13172, 0x03265EECC280E, 0x23A6F1C1BE398, 0x0AF41980DDB34, 0x3C72AC6A2F6D8, 0x3DDCF59B86BDB, 0x064F81A753BEA, 0x275527C9B7B0D, 0x1EF61DAED32F2, 0x0005246AB4ADE },
+    { 0x3D73B0A8885C0, 0x3CF3402CB6297, 0x00052A542624B, 0x6BC43C14A305B, 0x4DBA62B45F703, 0x72824853AE90E, 0x475D982EF461B, 0x377AD905386CD, 0x37C840B5EC4CC, 0x1F8A72A0D214D, 0x6F5D8379161EA, 0x0A5C63B8AE40E, 0x661933984E869, 0x11E7A42EBD80D, 0x000493CBFFF84 } },
+  { { 0x26C94277D3E29, 0x05CA5DBB1A075, 0x10D23B7611290, 0x09397B8BF4FBC, 0x438BBF2BC24EC, 0x012A864553EE6, 0x63E9241E2822D, 0x48CE61D4E9196, 0x1DAA881FD24DA, 0x7634E78E03DDA, 0x10D5C42F4170D, 0x22E8B243ECADC, 0x13C03FC368E76, 0x6A4BD61B18502, 0x00029B5A132A4 },
+    { 0x7B7C8EED2BC1D, 0x411FD0A0D9567, 0x705C061E64170, 0x7E799EE1FAE61, 0x40A9B44655CCF, 0x08D9EE8B3FA21, 0x64DBBED8B2C97, 0x6B87D887BB592, 0x68583D7479733, 0x031B194FACE50, 0x23F186A2169FE, 0x6EAA6A75CA5C9, 0x611CE887009FB, 0x3464A49383AD0, 0x00016BEA1A33A },
+    { 0x58817C904D6DD, 0x23719484A3982, 0x29B803A11FFB2, 0x26660B2D0F1FE, 0x3A7F2EFE6D2E2, 0x61D697373F1B5, 0x1D4BF65D37074, 0x58110349F7543, 0x31EBFB9E49F6A, 0x0E64501DBF8D9, 0x2457EB8A73DBD, 0x164043BCB2B20, 0x0C09D66C960EC, 0x272602B6ED16B, 0x0002B1A73B92F },
+    { 0x7D21557EA9E47, 0x61E321A9354D9, 0x65E53C13C70E3, 0x6356E72BAFBA4, 0x244E650655175, 0x0494E37C66626, 0x549778F3DCE77, 0x6A1F0505692DD, 0x32CC5DD69E09E, 0x5F9554C883C2F, 0x240CCA16B1C9D, 0x5AB20F6FC3D89, 0x4BF0349C821D5, 0x75F4B5E420CA4, 0x000261EA8BEEF } },
+  { { 0x64EB2B2D47BB7, 0x0D0E0C6B5F038, 0x1E32AF3B42986, 0x2359AFD189191, 0x251C2EED366C2, 0x637CC688F0F71, 0x36C98D95284E6, 0x1932B25508091, 0x583D924FA5A74, 0x2F22C42A38110, 0x66368F84652EC, 0x7566DED2C9B4F, 0x30E1617BE2921, 0x700631E7B444B, 0x00055222BAE97 },
+    { 0x63C3294F17A79, 0x114F0974E0333, 0x15CEADA7CA243, 0x5A55416BCB602, 0x12327CDD95450, 0x374638D0E21C7, 0x61768B9A1468A, 0x7FFCC33F9EF5D, 0x2BA66E35FFD48, 0x08C1CF18F1773, 0x693B76F536819, 0x1315920D896D1, 0x06349FD599A43, 0x0FA6EC327F72F, 0x0002A03F12449 },
+    { 0x1102DC0D07BD7, 0x25B8960651EB7, 0x683EA1FCB64AC, 0x4511970FFE182, 0x5A885F692C1F1, 0x23A1A7AAA0881, 0x0833AFE252D52, 0x1D700C5AED7B8, 0x7824B26B9ACEF, 0x5FA8C4CE9943E, 0x7B3DE7BD06534, 0x45F3D92A8569B, 0x6BE2EBB2B861B, 0x66FDC758DA1E8, 0x0004AB6867D3A },
+    { 0x3A58E0E895AD5, 0x052F2F266AC04, 0x71ED4885510C3, 0x3330B05931FE6, 0x612D0C6DB9C69, 0x4EC15C0C2290D, 0x309AADF82B281, 0x49D5FCB9D7312, 0x1AD463EF95378, 0x04E69C66B337A, 0x023772DC2FCA9, 0x3172D0F4FAC84, 0x6EC1FD3C748FE, 0x3156872A10B68, 0x0003A5E25D0C1 } },
+  { { 0x52C3A337C5247, 0x725DAB82CBCF1, 0x2FE94B40C45B0, 0x7A81AB80078DB, 0x6A9D387158A03, 0x196AF0D2A0614, 0x3B0DD36287BE2, 0x22CAA6ED63A61, 0x63310240A3316, 0x4F5853EFCEE32, 0x17BEE2D860B48, 0x1A25C67937B64, 0x56F600CD88487, 0x06E4893418707, 0x00058A32ED5FA },
+    { 0x1126D79B27B0E, 0x2D27153242076, 0x44DB61FC2D344, 0x50A423C7C8A48, 0x3591E1F8AD7DA, 0x22880749E277E, 0x16ECFBA4B455C, 0x10F826C8BC9A5, 0x4F52B0FC84E11, 0x6ECC2ACECA725, 0x1F6715026C7C0, 0x1347063E7F680, 0x168C72F5A3D93, 0x71C87E1BD618A, 0x0000CABDDA5F8 },
+    { 0x79DDCE39B173D, 0x4BA7733E70CE0, 0x774DACABCE1B3, 0x496C86155D441, 0x5AEAB31745BCE, 0x5B823D9907F41, 0x7D198D72E9E44, 0x30428080D96F1, 0x3E673E1D88DD1, 0x3B19B48C87ABD, 0x6A364AB425DB8, 0x761F19BA13C73, 0x42100FF3E8AAF, 0x7EB4AE6F35A42, 0x0004C25B29C1C },
+    { 0x42E7636C7C39A, 0x3AB2C717AF4ED, 0x50FA86B08E992, 0x3FFBFE1B2B330, 0x1788E603921F4, 0x3F8790F0A100D, 0x4C313A0BD60D4, 0x7D2D1FCB4073E, 0x1A1A273257E52, 0x013E268E912A9, 0x4CCA42DF47952, 0x29D388C9BC6B9, 0x5D327BCE57543, 0x377E9443D6970, 0x00040CBFE1526 } },
+  { { 0x581CF3686C5F8, 0x2E823269C88BC, 0x76ED9EF22106C, 0x77A4779D9D4B5, 0x69ADB4321CA73, 0x2A741DC2144B7, 0x1A4DC4A01F2E8, 0x217C7D448BF69, 0x6A72DA9660BAF, 0x03DB250CD65B4, 0x3419219305EA0, 0x12157603A3AE8, 0x16D7F2C850482, 0x2791CAD6C24F9, 0x000262FA9DAD7 },
+    { 0x1C7BA067D9D7F, 0x1E7394613C616, 0x1316F50C9EBC5, 0x7089E60370306, 0x599F90C0A28FD, 0x0F719006742E3, 0x198D809EAA5D6, 0x65AF4A62972D7, 0x02BC54C8B499D, 0x5715D14B66BE5, 0x21ACF53CD7F3E, 0x49389DA9172A9, 0x44A1A406A0E76, 0x76FD5B88D0849, 0x0002A13A4220A },
+    { 0x2B1D59C5F959A, 0x63DC60C7131B5, 0x2CA388B597D4F, 0x11D24C7D2CB33, 0x4D4841EFE4B4E, 0x1E3196391F4EB, 0x03F5681892F1A, 0x7C5FE98E9F11E, 0x0859CD97F8914, 0x06A90B944D3FA, 0x670C49FA1CE1F, 0x6F9F14AAE6BE6, 0x6ABD5BF1C1637, 0x499FE53F237AC, 0x000463E668C81 },
+    { 0x393F962E97779, 0x4ACD259B5D007, 0x7498F0AAF400F, 0x39DDD9EE899B1, 0x68C1869CE5629, 0x4805C4B8BEA8E, 0x1EEF60A45B605, 0x735F62C942B6B, 0x561336A1266CD, 0x7E53255E6A912, 0x61461CDEDE1E1, 0x24F89F2353A22, 0x6EBE8A98A7C3D, 0x22A38A4ECD866, 0x0002FA4190386 } },
+  { { 0x74687B6ED88A2, 0x30E93FCFE5558, 0x497B1BF5006DA, 0x078F0B824E34D, 0x56565B07DFF90, 0x4BEC10146E50F, 0x0F139B59196AF, 0x25AB2B1FFF33E, 0x3B1C6729EFC99, 0x2C4183C467C53, 0x208433E74865E, 0x3DF4D9BF7BD6C, 0x26881154DAC12, 0x0050110E19BA8, 0x00039B2806434 },
+    { 0x07AFC80EB997C, 0x3831E70C68056, 0x2B832451E81C3, 0x6A0006583CD53, 0x4A1E8F0E87B47, 0x1D75DB43E5290, 0x22D55AB4552C3, 0x6B9FAAE578EB3, 0x06E6C3EAFEC43, 0x24CA47B8DB96A, 0x0B146F3AD52D4, 0x55FEEC1DBFBD6, 0x40AD2E6F7923B, 0x6BBBF6F650CC7, 0x0003285AC83E8 },
+    { 0x79505E08E9B98, 0x6BEC04B754961, 0x0DFD40B62F879, 0x3F13553D52159, 0x044F879D05B62, 0x5BFA82F482306, 0x78E5B9E01C45D, 0x5FFD079523785, 0x7DE5B0317FA21, 0x6238718AB396B, 0x4539FF9AF8F93, 0x4B3C0FB7C0147, 0x5E710773486AD, 0x584F7CC4AB845, 0x00064B1A9A91C },
+    { 0x312480E12A0BC, 0x092538320FDD7, 0x2038F84A38FD6, 0x4B6B7D0837396, 0x39E782EDC8720, 0x3026EC4A79BFD, 0x58F55E7877BA1, 0x27A6C583AD5F8, 0x055BBD10BA76D, 0x5EEB66D800B04, 0x2222A27D2E891, 0x53BA70E7E8630, 0x6BE63F8CCE89A, 0x52206D3CE3D33, 0x00037F725AA0E } },
+  { { 0x4C6D6A5D8500F, 0x3D414FC8835FD, 0x3AA02BC6F4AEE, 0x0B0EC0512A3DA, 0x795A37EE817CD, 0x23011D58261FD, 0x469ADE710C110, 0x71AEA85C79357, 0x76D15ED60037B, 0x2CC9B89D103C5, 0x37FAC621C89B0, 0x2BB707BCA5F67, 0x44990205701C4, 0x332A569D0745D, 0x000504CEF8739 },
+    { 0x30804C1FE0D93, 0x7D5D91C4283A1, 0x600D8609C2505, 0x7016984F96EA5, 0x2C8A354BE2A0D, 0x504D21FE76811, 0x6B9A2FAB42162, 0x1E0FE1640D07F, 0x14367AE48D3A8, 0x686D856063720, 0x6577719118AE8, 0x3651BA7C3186A, 0x6EB65A8F2E88D, 0x3060527FA026C, 0x00017F4E8D355 },
+    { 0x02A5A3CD742B7, 0x495FFFB9F45CF, 0x4E6EBF5358E94, 0x73268856E2CB7, 0x76C980C169BA1, 0x64B1CBCA0BC48, 0x064217919F4FF, 0x77D8987DE8073, 0x33B0E0973B61E, 0x5D3E924A517AB, 0x0D18CAA8CAD62, 0x2C1A6021B48F5, 0x6021EED9DE4B7, 0x0008780774ABA, 0x000501E30525D },
+    { 0x0B16EF4F2E385, 0x2E1C389CFDB57, 0x4131AB7CBE362, 0x3AC78FF4B9CBB, 0x3BEA62CAC6754, 0x51BA083773159, 0x02C4B34E42C01, 0x29768F0F0C85F, 0x35EF1FB278C31, 0x510F95181BC8D, 0x2314174433BB1, 0x3ED20BDE68EF0, 0x79875E0D90934, 0x30CF93E675D79, 0x000292B6CEC8F } },
+  { { 0x4DC9F200B57ED, 0x39CC7E929946A, 0x064F12EA58312, 0x4E279FAC38446, 0x4970A926914DF, 0x29D9B032B0223, 0x5D4507E5DEB72, 0x2A84B137FD240, 0x15B87C84F1288, 0x7B3955637929B, 0x354DF1F955282, 0x7F103AAC604D5, 0x2FBDA20C7FBC3, 0x409E79BB6CED8, 0x00044F7E2363C },
+    { 0x13FCDA34DE2AC, 0x1B1071442666B, 0x7912EA3C40DFF, 0x469878B19CD4B, 0x20D67EBFAED92, 0x1EBE669B68ABA, 0x5FFED91755D3E, 0x2A8627EAB36BD, 0x3B75C2AEA06A5, 0x72F1208393177, 0x679F578D84982, 0x3C1FE44511F9C, 0x4830BCB29AA11, 0x2A9C3BE2F99E6, 0x0002B9F390A02 },
+    { 0x16A4FC0E58DED, 0x1D0FC685BF01E, 0x05C41E460A42D, 0x5A1358528D618, 0x1628676220992, 0x148E262C0FB48, 0x17ED31CE91BF6, 0x0DF27B30B3BE3, 0x68F6E06B4CA9F, 0x6F4B79706C41B, 0x3D07B07392DEA, 0x46A683BCCDB46, 0x08FB75189B85F, 0x0FE86ACAE017B, 0x00053209CB40B },
+    { 0x6789C8119A37C, 0x206BD96F38D6A, 0x609A690A8D9E9, 0x6C93C330332F2, 0x6147ACA30B212, 0x11C7735A49EFB, 0x5F8A3607C989A, 0x70A3862243188, 0x582216AC9D629, 0x56342971FED21, 0x031DA282AD86A, 0x66FEE5D025C0A, 0x72B26F851F938, 0x72C4F92FEE67C, 0x000331AE02EA0 } },
+  { { 0x363FDA6B5867F, 0x54D131A5EA013, 0x00E46FAD701B0, 0x0792285147025, 0x12962FDEBB773, 0x0CACB93ED2A3D, 0x114EFDE1944C9, 0x4AE6FB22399BE, 0x097A2B6F02E18, 0x6AF0E1D4BCF78, 0x2ABF2FF5E0A5F, 0x30C3519416F04, 0x0864818F1C276, 0x61555D65D3BB2, 0x000321A3D0BEE },
+    { 0x3785FA1BA4E48, 0x4E203EE6A49C3, 0x3FAD838767AEE, 0x6A0242377BF13, 0x24A2067201649, 0x53A37338D8D46, 0x474FE0124519D, 0x4AFACABABD6DD, 0x7EDD923B790DE, 0x40D29D6BD51A0, 0x46AEF05C19C46, 0x3A2F67C5BE69A, 0x3D45920459F74, 0x2698E6F42C4CB, 0x0000E0B8B3625 },
+    { 0x0B3E48CB8ECB9, 0x79E7B0E7C56AF, 0x6E8529214EB42, 0x203E66E667F56, 0x36503845692BB, 0x16E738E4470A9, 0x648CF7BD2DE87, 0x1F37466359249, 0x483C9E450DAF7, 0x56C8F471664F5, 0x586D410233BF9, 0x192F35502E2E1, 0x6BEC95C6421E1, 0x259B51883C7B9, 0x0000F548683E3 },
+    { 0x2AB732F040A0E, 0x44EE071E27E37, 0x62717BF671675, 0x3704A73569175, 0x77F9159E1871F, 0x303CFF5998653, 0x01C87ADD7CC71, 0x147F1287E4549, 0x767DB6ECF3638, 0x39480E5BA797A, 0x017B83B5A68AE, 0x432018DD2C099, 0x4AB7140FB2099, 0x409E93AA9A7AD, 0x0003C95DCF6B1 } },
+  { { 0x6B573203B6503, 0x059B47059442D, 0x7B402AC0CD02A, 0x30EB8201840FC, 0x6CF9B1234A06F, 0x6D0EE3523079E, 0x1DAD8AF103742, 0x2F4F27AEAA719, 0x5925663C5799B, 0x332BB533C7B2B, 0x55CCFC6596F25, 0x5567E029DCAFD, 0x35209B2A2E3E7, 0x185B67EA15D60, 0x0004959DB6FD6 },
+    { 0x04D8A5697417D, 0x03BDD9BC1E1AC, 0x2FB314379881C, 0x3B5F6EB76A313, 0x1DCF25F093DDF, 0x7A4E3472CC6E5, 0x55386AE70ADBE, 0x38239C959A14D, 0x2D44A8061378F, 0x13EF9E9BAA223, 0x401AD22B9D6A3, 0x61ED10DFEA0AC, 0x195563916BF3A, 0x64EB367AC849C, 0x000059B981C10 },
+    { 0x0374BEAE4958F, 0x20AC394F46E36, 0x5361FDD625511, 0x02087E7952C57, 0x006047C42D6A3, 0x0ECD3B4F711DA, 0x55C2467736CC9, 0x4F745C05F3BF5, 0x7982AEB801E2B, 0x362C1D9DC4F86, 0x34F1FB9540E77, 0x52E6783DD721B, 0x1A976B34FEB7C, 0x784095F6B6FC8, 0x0003EBC4DFED8 },
+    { 0x7A7479DA2D45F, 0x6C882335CDE8E, 0x6243719B4F587, 0x6163640A039CC, 0x5C74F37DE2916, 0x7383E178511C6, 0x154DEF7BDEFC5, 0x2E351B8C01A83, 0x22585091D8D16, 0x59D359DFD59BA, 0x653AB4F0FC3C4, 0x11E5156912FD9, 0x74B3E1E41D86F, 0x08441426B4D0A, 0x00039429F0526 } },
+  { { 0x6A7488E596DEE, 0x001543F9487A0, 0x795F7B7586654, 0x1E998036E1056, 0x4A4DF6FF42D75, 0x48F83130D2CAD, 0x5072B6AE6D2A2, 0x2A7F94DE9E20F, 0x1F4DEC0949BCC, 0x42DEFC0AC5796, 0x3B600969C7D92, 0x1A92A01160FA8, 0x53C9745C58BB6, 0x7575B02A5A4CE, 0x00065BD15B2D7 },
+    { 0x71062F53D63C9, 0x5FB11EDD023D5, 0x71F24B18D5065, 0x3C5A7104A2629, 0x59FA10626561B, 0x44174F014917B, 0x48A85CC556228, 0x2C24FCA8A129A, 0x5AB8BC76559DE, 0x0A47AE0DB7706, 0x333C6030CE4DD, 0x485DBE39CD150, 0x03C4475B98355, 0x0B5F9AE268EC4, 0x0001DDD7D45AD },
+    { 0x11FB26ABC49D8, 0x2F1B98205EF9F, 0x236A663AF108C, 0x1808259129F31, 0x3014A0AF0504C, 0x73A2AD744B3CA, 0x258A14E9DE1B5, 0x3EE744ACD0B29, 0x149F56F23CB90, 0x2F5CB4265AFA3, 0x4829793EACD30, 0x57DDF17D3155C, 0x638641668FFAE, 0x290481ACA568C, 0x0003CEB638ABE },
+    { 0x7D8807C077BF9, 0x76D16C176565F, 0x2F97228FAEC89, 0x53747A15BB863, 0x72A5BC22765EB, 0x277B0C05916DA, 0x5757B74C5E051, 0x73741FAD547BE, 0x0D4AFCB2C03B7, 0x5C6C9E9301832, 0x75356B5B0E100, 0x6B866C9EB7CA5, 0x2429C9EADDD10, 0x760B9C0C93B29, 0x000388471530B } },
+  { { 0x596A79BB742A7, 0x2A587A2EEAD0F, 0x20FF806565408, 0x7216CD3AD199B, 0x207A49A2F82D6, 0x7C3EBECAABBEB, 0x4E9637D433CB0, 0x5CE8E31A438FA, 0x4F2BD926CEA50, 0x395552DE7A2F4, 0x1809AAB43CE6C, 0x03463FE83F46D, 0x5D3AF95EE46B3, 0x6DE5735E9E69E, 0x0002B77E1F26F },
+    { 0x3D85E744C6BD8, 0x3428FC18F2328, 0x164FD4AB5E3B8, 0x7EC6A414ED9ED, 0x59AA334FEFB81, 0x72DF0A6814B6E, 0x787910017DBDB, 0x4AAEA72726B0A, 0x6E676FD38198E, 0x2CDF4D8554FD5, 0x589A275FD2B41, 0x6EF274CAD4740, 0x334007E4DF9E8, 0x7A17E5D267000, 0x00016A9DC7280 },
+    { 0x6748AF00D7E7D, 0x35F8488279F1E, 0x632B91D1FA08C, 0x39EB7CC4930F7, 0x36940B6AB71EB, 0x5D2D3F4782174, 0x4380D91A353FB, 0x6ECF72B4E4A8F, 0x38FEA0DA5FB9D, 0x4A24E1825102A, 0x3880E34F08B7B, 0x6D04AE66E4E16, 0x06FD18F4ED97E, 0x7495CAC9B1662, 0x0002C33FFD83B },
+    { 0x4B21D06C5B052, 0x1EE07FC7FBFD3, 0x0DBD2CA270341, 0x25F734AD95E2F, 0x7C3AD186B22A7, 0x1672815CEC625, 0x3B1010BA934C3, 0x2A5AD12049652, 0x272E19DA75EA6, 0x62A9841421F7C, 0x69FF49FCAA3C6, 0x1600EED68A4C4, 0x20D4F568C5B09, 0x763643F15B7ED, 0x0004E1DB8C98D } },
+  { { 0x2EE473849D5DB, 0x7CB65C4FC26EE, 0x0266BFDBC23A3, 0x6C8A6B8F2169A, 0x60AD2B7DFDED7, 0x3B1F11EEF2772, 0x543711F0FFDA6, 0x2F84A115B420F, 0x61999851334F5, 0x336C3267E435E, 0x1C1F727486C6C, 0x30D08D265D8C8, 0x12C56F4D1DDBE, 0x6AB52622B96A5, 0x000374A3997F5 },
+    { 0x12434D0681CE0, 0x0065FD91652D3, 0x20EB18BD91F8E, 0x1C37679D03B2C, 0x27AC5701CF0DE, 0x56BD1FD7E108C, 0x5605A3134F0F7, 0x1D9DD82A4F9AA, 0x4FC42066E8DBF, 0x23131940F70BA, 0x5F7ED4E41EBD7, 0x4BA8D8C19ABDE, 0x28047FA6C9705, 0x4EA4E78EB22F9, 0x000298BD06734 },
+    { 0x1EC6086621969, 0x62A82B6E1971D, 0x3E571FFE1A932, 0x122B78A495161, 0x22637A0D1448E, 0x492447D0118D5, 0x41E343212386F, 0x23EAA1169E5DE, 0x39CE7CDBADF35, 0x318F3EA13E488, 0x25C2B49736A88, 0x56F605D30C522, 0x76DF52FB60937, 0x245B8A699A0C5, 0x0003841121029 },
+    { 0x763834AAC2A36, 0x01E2AAC13448B, 0x17E42880390CF, 0x57C3A41600D1F, 0x441844758E0E6, 0x5F058A79A34C7, 0x756468A610CCF, 0x757897736BF31, 0x63B151A2601E5, 0x6DF6E803DC44E, 0x1F07B8AE676E4, 0x1824D61E78CAD, 0x3189B895D5959, 0x7A901A0EB19C4, 0x00034EA309477 } },
+  { { 0x0BA0D969ED50A, 0x76AA64288449A, 0x79BB267EC8829, 0x7AAC142644EFB, 0x4B66ADDACC5AE, 0x12FB45E4B1C47, 0x230FD3A88F8AC, 0x19C1B46D9B0D3, 0x2483F7D768697, 0x4A3B25D0C5867, 0x0032610C39BE2, 0x4D374C3A7C6E2, 0x61F3417ED8F7C, 0x1925C1149909C, 0x00024286BBD6A },
+    { 0x49AD7D9FC0DA0, 0x758F13E7AEC52, 0x3679F2918DDEA, 0x4BCCC3F767089, 0x0C7A2ADC63E60, 0x55309424DE7B8, 0x6EE076ADFB2FA, 0x3E3B35634C83A, 0x55F7EBC7B9F8B, 0x3C53AFC373A42, 0x32F771677823F, 0x7148A2F76E5DC, 0x0247F89240E06, 0x34FECC7E42650, 0x0001069D4F73B },
+    { 0x78D2A73FB6C7A, 0x37EEC4B3699D2, 0x27929B1A438BC, 0x11A62A9882460, 0x7DDF5DA1457A3, 0x053589FB164ED, 0x352F8DB527F5C, 0x4E52F14944C22, 0x55CD21C51A804, 0x77DE3CC08FE1F, 0x30AAE9FD9DF33, 0x3C178649E0886, 0x327CA885834AE, 0x1426539DB2E33, 0x00036E9C06E70 },
+    { 0x1CCA7C17AF388, 0x7798AA79E8D82, 0x2B44917300D26, 0x3E62348B67B17, 0x4894F684DC14B, 0x4C938A074AC4F, 0x766648181CD1A, 0x72871A07E090E, 0x44A71F3DCCAF9, 0x08240AD799439, 0x629E711A0EB5F, 0x3959F904828AE, 0x145C3170133E0, 0x1E379740AC0A2, 0x000408B676323 } },
+  { { 0x53E5CD5291045, 0x171F485107E71, 0x67334747F768E, 0x6F6FD7BFF179A, 0x74F2378694D56, 0x7635F3AC34584, 0x194E97A8DE61C, 0x7DC47BE16D941, 0x5E11278B8865D, 0x5B67F3BEAA5AB, 0x3B97A8469543C, 0x405CC1DF782D5, 0x2A64C77825E4A, 0x3F7E82BB53E0F, 0x0002EDBD6E2B9 },
+    { 0x119C97C84F4C7, 0x793202A054F8E, 0x04863823EFC67, 0x2C8911A6BD597, 0x127AB2FF4F739, 0x37D133B8C2EFC, 0x54D23116E865B, 0x00B180EF153F2, 0x655E1D60C0659, 0x6494DD788CFD5, 0x6AA2EF12E55A5, 0x6ED6CD47B5320, 0x76D08663D31D9, 0x3DB3ADE945C5E, 0x000186241C643 },
+    { 0x514FE5DE980F1, 0x40325D445C97C, 0x5E439D9B7BC15, 0x1E18A19E07502, 0x1BD6671D3224B, 0x37C3A6ECA1696, 0x37CF0F027F806, 0x2C6A234BB592D, 0x11DFE64C17B25, 0x59B634FEF15E9, 0x35AB2952DA35E, 0x086672D61C243, 0x59D4DC47801D1, 0x397B9180A73D8, 0x000390D7D96BF },
+    { 0x2E04AB6C5E303, 0x199FFE6DB5872, 0x3C92EA4FFB3D5, 0x492A58FDEF76E, 0x2E5DA2D3514F2, 0x4CD195E20D5A2, 0x11007622BA12B, 0x2A1D593EAD558, 0x79D0C058CD9EB, 0x5B4BDB73F1F79, 0x6FF75778473BB, 0x4F1208159080D, 0x4C1BBB37EED2D, 0x661734EBD3462, 0x000217B7D669B } },
+  { { 0x171C8DA03871F, 0x63556A84BB9E6, 0x35662963AA2BF, 0x4505B6581D195, 0x1926CBD771B7E, 0x546B3EEB26456, 0x5457864EA0432, 0x77C9D61F435B1, 0x0E648CFA3F489, 0x63DB339B7C6CD, 0x517E22B6B2BB5, 0x60419FF769D94, 0x5A48307F1941C, 0x14C5EBD90EA51, 0x00046AF4618C3 },
+    { 0x7AD1398F8D3F7, 0x2FD6B8621CD94, 0x17DCB3991255A, 0x5ABADD407DF03, 0x6A8EF0EE5CB25, 0x5FF91F7A77036, 0x4D2487F8F2D9C, 0x3CBEEF09B36B1, 0x655F70BD57232, 0x4C47CF499CF30, 0x0ECFEB5D2043A, 0x1C1A88DF22245, 0x64E7AB48BDBFA, 0x3D3197055001E, 0x000202E226EC1 },
+    { 0x05E431D9AA887, 0x2569E75DA6C1C, 0x1687DE48E1540, 0x09E69EA9283E6, 0x6702AE1C838C1, 0x7F86A004F704E, 0x11C71FE2D6295, 0x5592EE9EFDF32, 0x21B85F8810156, 0x58624A7E99A4A, 0x3023DD71A6059, 0x6F69F15C8F102, 0x55182A05A1C69, 0x5A1422A92B00E, 0x0002CFAAFC3FB },
+    { 0x05EA03A1A4457, 0x69ED98DB8F20A, 0x6651CA9AF6199, 0x7DF537DD3936A, 0x2403B66D7F9C6, 0x56FAA8355BA2E, 0x337EDAE968078, 0x695A734759336, 0x005C07507928C, 0x2CB5EF6FC1734, 0x5BB4596B7C2BB, 0x343CAA2ED4F3B, 0x6F67CEBA8EC50, 0x0F98E57809AEF, 0x00033F5B154AA } },
+  { { 0x3261863EA4B59, 0x6A681F1DC812B, 0x26DC46FC782E5, 0x59DBCB49800D0, 0x4AE4880461E0E, 0x189BF0290ABE1, 0x2F3110418BEC2, 0x4E38BA327DB24, 0x426D1B896834B, 0x1AF1D97F29DAA, 0x30E81D7A78B1D, 0x26B7C9B07AAE2, 0x30FF4ECB70680, 0x18D9C72953248, 0x00067D7903F32 },
+    { 0x0EA4EFEFEF0BB, 0x2FAD2D97F23D8, 0x7E6034B5A2EEB, 0x5DEC9BBC6C471, 0x7527E36A36B87, 0x514B2DD0E566E, 0x0CFAEA6E0406A, 0x0075C05712943, 0x13982E614BBC1, 0x3361E332A685D, 0x4F564696A13F4, 0x7B0710A9DA1C9, 0x5CFF2080C74A8, 0x082B1E54EF5A7, 0x0001BE2A1E5E8 },
+    { 0x380B08DEDF467, 0x0763FD252CAC5, 0x6E37FB9B01444, 0x4CC569D144286, 0x545A9434AE046, 0x6A20F0D07A8D9, 0x767B8EDA45D8E, 0x3D89EB807B0DD, 0x55317C772CCD7, 0x043EC16ADAE0E, 0x466AFCA57DF22, 0x0C352E2FD21DD, 0x0E27943D233A8, 0x65C419C027AFD, 0x0003EE58B776A },
+    { 0x7828C6CF9E96F, 0x778FD2187C38C, 0x2EFA182EB2D46, 0x4D297368FD881, 0x4D053EFAD82C4, 0x759DA4D07B7C0, 0x5FD9A76F321ED, 0x034CD43F044CF, 0x4CF86295A0862, 0x272F9FC4EA1E6, 0x6BD30378FF080, 0x186023AE6A2F8, 0x575F69682FED2, 0x08D01653C75CE, 0x00053CE3F1342 } },
+  { { 0x0834EA01FD8EF, 0x793091668095A, 0x3E44D89C6F927, 0x7D196EEC5C53E, 0x227191500C2E5, 0x334CA1F81FDB8, 0x45A5D9D3FE181, 0x7CC6757759EDF, 0x5EBB641ABD850, 0x71B46B7AC2923, 0x1FC764C40F4AB, 0x3EB5865B38DED, 0x4CBDAAC72D530, 0x258748F1FF9E5, 0x00019FEE74545 },
+    { 0x14BCE24BC0556, 0x01C28271A4CD9, 0x401890489DC0F, 0x4F1D955318266, 0x7B18BACD971AF, 0x5A271E844DDD1, 0x3FA31BD6242B3, 0x2E6F9D6AF5E82, 0x430CF3E2AFE65, 0x5642D8A5206F5, 0x7F5866A531832, 0x1F2897B3995E6, 0x3CA5B6324A8A9, 0x06101EB55352E, 0x0001B0060C416 },
+    { 0x2C6AD921FE4E1, 0x155BD2A8E9C84, 0x797D98EF26F3D, 0x513003D854C20, 0x68A64AFCD4E43, 0x2602470D69620, 0x7E6F396966F68, 0x5558D02090F37, 0x26D1308C88DD3, 0x0745F7A6AADCD, 0x403482E3FE346, 0x07753DBF2221C, 0x719D88363F4F1, 0x4F164E4D1D664, 0x0002AB0DD7460 },
+    { 0x73445939528B4, 0x0530751B8DDD8, 0x54529AB8507D9, 0x767FDF0A45BB8, 0x5267CF36F1AAC, 0x31C342B6B7B26, 0x2EEB1409A7CD2, 0x60A8C59B6AB57, 0x5AC5CF9B771C2, 0x5739A6B6837F1, 0x268EE5337F6F9, 0x26233187FB51C, 0x1F229DE10C02C, 0x032E38872C216, 0x0002076C13AE2 } },
+  { { 0x20B9774870935, 0x5617655327ED3, 0x0CEC11590D3BA, 0x4AFFAF82D5063, 0x1CC5307E9F9C8, 0x32D7ADF06DD07, 0x51A8E82F6B96E, 0x097E6AEF6DAC5, 0x035F6D8AE98C4, 0x57188D4F87510, 0x6B77068DE1188, 0x3668E9FDF190F, 0x4AC09E8ACFF87, 0x6F48E7169895B, 0x000209A348E72 },
+    { 0x21CBCF0108D23, 0x08F0006C5C930, 0x0530B4BF65EE0, 0x4918BE9BB564B, 0x34B996651EC0A, 0x363BA6077649A, 0x2418DEE8628A0, 0x1921772E85B48, 0x042B43B943EDD, 0x48076483C999B, 0x5BD1F986CA5C1, 0x23F556135264A, 0x398BC949D81DA, 0x0DD716333B3F4, 0x0002606B39C17 },
+    { 0x23E4C0052581D, 0x419A09F801D18, 0x5F63075C679A3, 0x7E972BACBFA3C, 0x7B5EA060ABC03, 0x641716E460401, 0x1DDAD2B74B9B6, 0x5387CEFA2300F, 0x62CB0F3628A00, 0x16C43C7DE73D5, 0x2C5525D5CFFB3, 0x119B452D7EAAA, 0x45745287781F6, 0x5887BC182CFD1, 0x0002482AD96CF },
+    { 0x7A34AE958ED0B, 0x42CF7509C1F6E, 0x37F3F979F848D, 0x67D33553A01B2, 0x05F90E2B4CDCC, 0x3F09B8C59C0B7, 0x7D0729713F680, 0x3B2B0ADB850EE, 0x658DD8E4BC0FA, 0x2289E217EE982, 0x5B9B39ED4C9CE, 0x00D439E5CBB72, 0x549D9BF6F2B1F, 0x783DC4DCF8F78, 0x0002C9F7C586D } },
+  { { 0x04B8DDCC95A2A, 0x29D14685BC408, 0x507BA004C3CF7, 0x106A71BF24A54, 0x634E3B372FE81, 0x0CC158CE706B9, 0x11042BA34010D, 0x27BF5FF53A747, 0x18374035F00D5, 0x1A12E6F66C0DE, 0x33608C6310828, 0x7677A368B091C, 0x5D5971BC7BF45, 0x213A6EFCCD9F3, 0x000488F524E1F },
+    { 0x173E9F767EF00, 0x7E967E7B30EC5, 0x415C5E4C2E276, 0x159A47122FF6D, 0x0C3DC36AE3C23, 0x22DD4FF39B357, 0x0D0A13D69F6DD, 0x46117B476DB8D, 0x6DC3367ECB8D0, 0x51DD2B14F8F2F, 0x449EF2CEA67CD, 0x02015A5A5774B, 0x685858BF4207A, 0x1970637C964CF, 0x0002A8986803C },
+    { 0x3F31190C676BA, 0x05B125850450B, 0x2EC4B0C40E8D5, 0x3364F5B6181ED, 0x6709BEA3341D6, 0x6C9225AE73960, 0x54B0090EDBF84, 0x79BDE152FE9A5, 0x3C6787E94A4E9, 0x788449BBFE27F, 0x54D084B1E1CC1, 0x2247902701A57, 0x4180FBE51199C, 0x121A7FB97D300, 0x0002218654636 },
+    { 0x270414D027ECE, 0x58AB3CBAE250C, 0x13A7E0CA483F0, 0x30101E9F1877B, 0x70E6131691172, 0x48DF1C526ED39, 0x3FA73413B0477, 0x1B90CF099118C, 0x11D54254892F2, 0x0C20CB4B11BCE, 0x757D2DB747716, 0x50F5F8CC9EBFB, 0x30A130A95F5B9, 0x4E75F7A0F38C6, 0x000377BFDD4E3 } },
+  { { 0x7613FA73BF4E3, 0x6FCCF250E9B00, 0x4AA676BC6CB5D, 0x7C66CAF30ECEA, 0x4BC9BE8B36B9A, 0x086C946E98647, 0x0C00A33EE7754, 0x79B333DA6A99D, 0x33A997C1525FC, 0x42AFA66A3DE35, 0x2A5E986D9431C, 0x452D4854F21FB, 0x778263266C64B, 0x4207C967BE196, 0x000548D340127 },
+    { 0x04ABCB6710B1B, 0x370F06DE61C31, 0x01E15F6E52FED, 0x6CB97810665DB, 0x608324FEC25CF, 0x4A28C872072F7, 0x3F5B664B373CF, 0x50F739E2C2127, 0x49035346918A5, 0x7E93D9F147C3D, 0x7E891D862B4B2, 0x50E520C993E20, 0x384BDFEDFB0CF, 0x16F0D5E6BB930, 0x000256A1C440E },
+    { 0x13866E6368019, 0x66D25713D85E3, 0x1C64194DBA830, 0x69225DE900BB7, 0x4FD05A417D59D, 0x2F7E379EFA891, 0x5684CFC2B92F9, 0x3DE43914FC3B9, 0x00322804A6B8B, 0x24057475557F5, 0x059C2DAF89282, 0x5A8C8C846E043, 0x76A2897BC39D4, 0x0FD901F5294B5, 0x000304BF8CD1A },
+    { 0x119B7E89207B3, 0x10CFD18080693, 0x620DD0C9C4DCB, 0x2D5F9F627F2D3, 0x3F8615299B5FA, 0x49B4A787BD5AC, 0x68B6C7853BA3A, 0x7F97C4E17C734, 0x753068D3A1B69, 0x009324CAD1A7C, 0x4B70B8E7E7A36, 0x443E4E70A4B87, 0x12FF54E58C8E9, 0x6DD06CC2D1E53, 0x000372222FA28 } },
+  { { 0x3BD881D65BF97, 0x18DF3CF0A492D, 0x28FA17E82F6CB, 0x43B2E8C4131B8, 0x34857DD9807E0, 0x7D0FCA1178688, 0x1B328015CAD16, 0x72E7BBD1A29DC, 0x27FC2488877FD, 0x076FA964B5402, 0x7B5CFE059366C, 0x5F6142AF1309E, 0x222AAB2ADE35E, 0x41D447E636AF7, 0x0001D355915CC },
+    { 0x5EA63C4DC4F3D, 0x3BBD71DF203F4, 0x0B4EF2B5F3B0D, 0x3587E5E3C8087, 0x37715B79D54C9, 0x0839B85B75D29, 0x0DCD6174F2687, 0x229406CA23B0A, 0x2D2E8D2B92DC8, 0x2BA488DF274BB, 0x77840AB557672, 0x17484EBD2226F, 0x31D1C6DBA4B76, 0x3121FF23C336F, 0x000113A4D6936 },
+    { 0x2BF59DF97F355, 0x45710812C7808, 0x360FA7B553725, 0x4A40FEF3A441E, 0x46485547A8606, 0x1EE4F3EE0F975, 0x4C47E376C0589, 0x64C05F8533FC8, 0x1DE6057D324E0, 0x527C0D8006E66, 0x327867BD7964E, 0x1523500603DB9, 0x5D604027966DA, 0x62CCD8DA9A55C, 0x0002E89013D29 },
+    { 0x6F1411C4765CB, 0x0FB1846862363, 0x75FD3D983A259, 0x25BC57C1C0133, 0x5B1191EDC097D, 0x45A95153FCD0A, 0x75F05A18BF4BD, 0x096E970577FC9, 0x0A0AE79EC2D81, 0x7902612A008F9, 0x04F16DE655571, 0x1F5A798E0FA27, 0x2F93D14918C6F, 0x6DC14648954F7, 0x0003EB6020FAC } },
+  { { 0x035518DFD9B50, 0x7CE3FF69372A7, 0x1631D37836694, 0x3FA65E4B0E741, 0x2064AAE3930F9, 0x1AC9B39F4950D, 0x14608A47E5352, 0x6841A86955FF9, 0x0DF7EE11105E0, 0x4224CC307F1E6, 0x02B1CC8A62DD2, 0x290DDFF2BF9AE, 0x46E6E88E0C969, 0x0063E4A4CB633, 0x000557D38892C },
+    { 0x64BB7BB67B5CE, 0x7DC203258038F, 0x10D3F94C06A71, 0x0D896E9CFA85F, 0x651AB6EA56269, 0x4BFB07ABF51F0, 0x3DB4E53E85EB3, 0x70071911ED668, 0x1E3A06D904090, 0x30A0A5C89747A, 0x74F47D0C27733, 0x524DA69497BCB, 0x4A20C93276899, 0x5EE45A089B1B4, 0x0000F0F512589 },
+    { 0x2D7F513704BBA, 0x1B7D2852D9EB6, 0x19B568B079191, 0x01C963D8E7A61, 0x3FF4415A5367D, 0x37E038F501130, 0x574655F5109B8, 0x6ED5D376720D1, 0x1C742165F7F30, 0x58753BC907048, 0x3F5B2E09566D0, 0x13125A586B664, 0x41B97F50FAE87, 0x444DB4EEEB22F, 0x00052347F97D9 },
+    { 0x3BEA6C5FF3A28, 0x6A76F914C79B1, 0x1E23FAB27D703, 0x627DB9FC9097B, 0x3BF53D9CAC5E4, 0x076CDD9EAD968, 0x2AE0A3B9646F5, 0x75690410187AC, 0x0F59C17AF4B8C, 0x5E5FB01FEC07C, 0x2BBFB4606FE6C, 0x28E93A838CBF1, 0x4CC1321562A4A, 0x5CE89B8A5E9A3, 0x00033FEF35C50 } },
+  { { 0x02DC239581797, 0x7B4C70005F2E7, 0x6EC6D23FA9982, 0x237A61504FF3A, 0x6B50E8E9D110F, 0x3712F463997C6, 0x683A7DDE9D7C8, 0x07BFE58639B7A, 0x33061561DA90D, 0x7DF1EB116A8EE, 0x45796708835F0, 0x07B84EA81AE4E, 0x097EE46583194, 0x5CCD1485F1277, 0x0002A324DD391 },
+    { 0x4DB6F6C2A5E44, 0x44732EDF40DE2, 0x51B89F93D8554, 0x14221F5AE5F4E, 0x01BAA6D27163E, 0x45D6B14F91ED9, 0x60C967D928A84, 0x73B8272465F9F, 0x6F8D87F3AD10E, 0x7CD2965C491AE, 0x7F2E010B222DA, 0x243822BE99878, 0x022CB4E707851, 0x57CBE995E8949, 0x0001744C5B08F },
+    { 0x67BA21B6BC4ED, 0x475F7CEFE37B1, 0x50F1D61953F8C, 0x453D364AD8BF6, 0x53A8AF3206177, 0x2F2A074B74167, 0x211A6D3AE78D3, 0x2746EB3F806D5, 0x2E317C509189D, 0x72EDE5C6B7C1C, 0x4DB9949E860C5, 0x1E0E69F8F7A72, 0x649188E161E0F, 0x77F5EF3BC0905, 0x000421D41B324 },
+    { 0x797339F233E12, 0x6525FCEC8B18C, 0x6C435C61C23AB, 0x25DEE1480A629, 0x4C795BCEC116B, 0x1E13ACE17EF75, 0x78E164BF819A9, 0x1D14B5E002929, 0x0F5F9F3C5F9DD, 0x73BA6D849FDD7, 0x71BBB1841C5C6, 0x0F922A1DD6FF7, 0x4101A6D540449, 0x2B84407BB759C, 0x0002AF7CB1FEB } },
+  { { 0x3F2F43A8A2DAF, 0x54303D3B215CB, 0x46C8EC78CEEF2, 0x5FDB441E52BD0, 0x1B69295BB6E4C, 0x1DB70B743E242, 0x337516028615C, 0x4C835AB5799CF, 0x765F577BFC8FC, 0x7849CAF119031, 0x4A424CDC4E5B8, 0x4E075E08EC152, 0x2CC435511F015, 0x439B04D82C398, 0x000371AEA76BB },
+    { 0x13F108B2148CB, 0x21AD8F95A81AD, 0x235DD68D2F06B, 0x7772D3A43B87C, 0x57AE0BBB50BA7, 0x724773113124F, 0x6D4406D59EDBA, 0x6AF1E20CC2409, 0x605B731BF2205, 0x58E9CE7324E74, 0x2F1DB2BA47753, 0x6D9A0B3605637, 0x3BFAD44E31D84, 0x5C46BA800CD2B, 0x0001A9F3018CE },
+    { 0x31B10786BAEB1, 0x2ED88AD275B7D, 0x7000B267B31B0, 0x0A9A17361A1F5, 0x72594BFCDD2F9, 0x2EDA9DEBC79FF, 0x32696E7B82084, 0x42F210E894594, 0x2EF3BA3303589, 0x51C19C310B7A6, 0x3CE9437CCB9FA, 0x60BEF51F3553F, 0x3E6F3050F5373, 0x23E4CB1B406E1, 0x0000490882D44 },
+    { 0x07CE2110AE69F, 0x23C12EEF3D82C, 0x7B076CBE052A0, 0x76181E6C3862F, 0x011B59E45E440, 0x7D68E42A886F2, 0x425535BC12933, 0x24DF5967ADDB8, 0x12CF7C8C67B20, 0x03B9119032DBB, 0x521D33E908EF9, 0x03899038E99C2, 0x52D78679428B2, 0x4C17C42BF2E6D, 0x0004D20E8EFD1 } },
+  { { 0x060B67B113A72, 0x302A593CEFA94, 0x7B57D05A06DDE, 0x4058D025E4190, 0x7B1C883CC9E29, 0x09BAE3B444377, 0x2557F3B643E56, 0x76A85001DF813, 0x2CB72D813BA85, 0x7F7E25DFA52BB, 0x50D0726B3765A, 0x0D11C600F6918, 0x12C564809E8A1, 0x5289CA14B1618, 0x0004DB51D382E },
+    { 0x2D15F1401FD3E, 0x6EC7B13C78B94, 0x579ABB76F9B8D, 0x2400A6AFB9796, 0x06AA7D6190449, 0x679D6F4E1938A, 0x0BA76A06D9BC7, 0x25EF755871D82, 0x7F63BB8035C13, 0x54E8343CC1C26, 0x278BA3EEC63E2, 0x6159078B8EFDD, 0x5B8C12E7EBA0C, 0x03D9202417197, 0x0001DA75830C7 },
+    { 0x4A1650F210160, 0x0FF13AE5FA29A, 0x14BD077A2F68C, 0x4824C43036BA3, 0x38C6E355001D5, 0x336E812527052, 0x55D082DF34B1F, 0x7362DADCF836F, 0x389EB48D6B1B6, 0x3676B8DA30D0A, 0x2F313705C0519, 0x6C4CF5550BA52, 0x7371F7D6C1F28, 0x7775E3777D8C8, 0x0004866735F5E },
+    { 0x5F54EE02C68D6, 0x4F13330AA841D, 0x15ED9317BC0F4, 0x42476CDA05682, 0x14AD95362C32B, 0x5216DFE37DD1F, 0x47A1B0CF84DBA, 0x5B3D3E3FBE1A3, 0x7CCFDFFDB857A, 0x6ACC80564904E, 0x59B645E0D985D, 0x187F9F075ABDF, 0x00A93BCE57267, 0x111E2B4E8F57E, 0x00032619B08BB } },
+  { { 0x204F842D57D8D, 0x582C66A78CCE1, 0x138837AC9590A, 0x1962EE7369892, 0x33CEB0A22E434, 0x0666351C6484E, 0x5409EA80EA21E, 0x5C9F27D407FDA, 0x057F58C85E381, 0x5C32CF0BF9DD3, 0x7A51087C8E128, 0x7778CF9B1A989, 0x0C783C7D7BFAE, 0x41FDD23035646, 0x0004D383B1942 },
+    { 0x439BD1397CC08, 0x4D087A4EE609D, 0x65BFFB03FDE3C, 0x0E2D98C1A625D, 0x3D23DB363F10C, 0x79CC1F555CD97, 0x15FC1B869EA13, 0x480CDB1797831, 0x7E58822ABD687, 0x1ECF7DA76B176, 0x07F53402179B3, 0x46418851286AB, 0x5B4498F36CF5E, 0x4CAEBA917F7A5, 0x000185F677F67 },
+    { 0x7699C915DB0DD, 0x0ABC8142D40E3, 0x385A8EEF93894, 0x4B017B3B4222D, 0x3A4B29E7A6018, 0x3AEC1C685B7A1, 0x3BF11D7287F05, 0x30B735C4C395C, 0x5C3D19031C390, 0x78067F3334F7F, 0x1457ED3F62D55, 0x55AA6C091B41B, 0x68D3FF248C937, 0x1B40860CDEE1F, 0x000262F89413F },
+    { 0x62E0A72D99144, 0x71AE2BD40EA69, 0x2B09F3055DE53, 0x3E8EADE0E06CD, 0x415CBE2A30F62, 0x1AD7B5A18A80E, 0x43060E8B9069A, 0x377999B4601F4, 0x1D68AAD5924E4, 0x52F5BE0B830C8, 0x74F75BC4BB6B7, 0x38D0BC37A62E4, 0x27CB624106D50, 0x3A7FFD470BD8C, 0x00038FC7F7014 } },
+  { { 0x3143088591CE9, 0x1084BBF765BDF, 0x2FB8B432B5A9C, 0x6464B69B031A5, 0x44F4A64D7469A, 0x0751E837E311B, 0x6AE42EAFFA193, 0x5454FE60BD0B4, 0x136411281125C, 0x001F596908A9E, 0x45401D1965D6E, 0x766B9913FD070, 0x6FB11DEDE3152, 0x05812BEF16E02, 0x0006C9973B2BA },
+    { 0x2DE254C174623, 0x0711E1898252A, 0x23A4D6D1B75D7, 0x5C00B209E5710, 0x556F21C6F7144, 0x376510A6B61CF, 0x227C19D54FCEF, 0x473FB7470B2DA, 0x68B4172593012, 0x5D8DE06FC85B3, 0x2AA9EEF4A2F12, 0x11420031BF813, 0x07F2BAAE4D981, 0x3563A0F060FBC, 0x0001E596AF3A5 },
+    { 0x16FDCB2B47E43, 0x76F467D8771D7, 0x68383AFD8CB1F, 0x2C890DA3CE1A8, 0x288EE67D05C10, 0x5134839A04C24, 0x429372549C421, 0x487DE3E2EFDA6, 0x5C29C00FD903E, 0x3AE454EE6A3EE, 0x632B5AC7C8E38, 0x4A952409F8B20, 0x76F45DAC234D4, 0x612E92CC59524, 0x00034AF461280 },
+    { 0x544F48E038D05, 0x6B4B658614F2C, 0x755CCA17CB28F, 0x168B8C8FEF8F0, 0x29A5B7B739086, 0x488E2CD1781C0, 0x1DB707C5E2EDB, 0x16C758A313296, 0x07D459347F4A8, 0x5E15E88E1F4C6, 0x32E22DA01FE18, 0x50D64D7FB303F, 0x70BE33AAB2E2E, 0x3686252492539, 0x000430698C44F } },
+  { { 0x372DBB46C314C, 0x4772A175B2562, 0x6792EF4555693, 0x75A02DB131399, 0x611D1D3B2D0AD, 0x116572A1FAA57, 0x7E03C4AC0D0AA, 0x59E490AE7B42C, 0x7DA1B7D5B2451, 0x5ACBEC3E1DDAA, 0x6A9ACE6BCE310, 0x2220303B1E370, 0x1AC6B452E4928, 0x4C46B8902DC0D, 0x0001F943E80A9 },
+    { 0x2F1B4C1A4243F, 0x5180F2D4DFDFD, 0x2B2C53AE263AC, 0x18395D983BFB6, 0x62C0979745346, 0x63B2F145AEF73, 0x3CFD365D93226, 0x71968A9DB1A69, 0x015F587F2AE97, 0x2F49328B86E48, 0x66E42C41802BE, 0x274CF0B88F937, 0x322BB7587545D, 0x1238D32E8A0ED, 0x0001BB71F5B0F },
+    { 0x09178E30216EA, 0x26BBED289EBE9, 0x59F71AC5550CA, 0x51D5A3666EB1F, 0x2C34BA065C7B5, 0x632C14F050EF6, 0x6C27C3C018800, 0x4A5C9BECDABAF, 0x13EE08BD17EA3, 0x563A18EDCF4DA, 0x2EA18FEB9989E, 0x46B368E9BDFC2, 0x2A25C4ABA8C02, 0x14401348E3D57, 0x00046C46DA32F },
+    { 0x3E1E6DC5B380D, 0x20B4167C18EB7, 0x0850840F21B97, 0x119D5F6BF5F59, 0x79D74C89B2238, 0x60AF7F26C469F, 0x0AABA94532A12, 0x12A546AE3F370, 0x77D5DC4734283, 0x0AD6A8B5EE712, 0x116A69003C861, 0x5CB138AF19A7E, 0x45C80F1612FE8, 0x095612B14C600, 0x0002E35121CB7 } },
+  { { 0x040D06582BDA8, 0x728F0A47A97AF, 0x63374EC30D774, 0x7D4AF84FEC8E5, 0x03441DCB8E530, 0x7C9D88D8E84FC, 0x18B2178D51375, 0x403EE40179BDC, 0x24CCFBC653245, 0x60CE6BE0B4582, 0x22B1FB569E390, 0x03061AD49BC70, 0x3E85E7110164D, 0x67050AA5B879C, 0x0003072CF2269 },
+    { 0x20EC55DE6B372, 0x15E673EE105AE, 0x1E91AAD3B1428, 0x434260F4BAA20, 0x640F3D9731669, 0x39B1E3E3C85FA, 0x4E6D54D927257, 0x46EF1AD615A97, 0x5BAA933408DB1, 0x11C6CE41EED30, 0x350833C320892, 0x5D81405E6D1D8, 0x2C967E3F824CC, 0x1610E24E81D98, 0x000275C6850FF },
+    { 0x296A9AC4C389C, 0x59B1D76973318, 0x29A6D6A7CA864, 0x635546F2F402E, 0x0C4D03B164C61, 0x6EAEFC43A5994, 0x26F0D32C25BCD, 0x449A404628044, 0x4084BD4C908E7, 0x580CF2FAC6A64, 0x4E1722BEE176F, 0x2552A2713D568, 0x50F464335AD4C, 0x713C49B2AF138, 0x00053A186C2B2 },
+    { 0x195AFB3D891E0, 0x3B7C686AAE120, 0x27DFA2D19F0B2, 0x4546C388AD63B, 0x2EB9C2C1849D7, 0x1593945A83A0B, 0x3D958B3511E91, 0x765FD5B85C0F2, 0x0F8354BC7FF06, 0x656F0C7D91BA9, 0x5C941706FE058, 0x6ED16CF85FADE, 0x36630B7BA1E0A, 0x76B24C83203D6, 0x000292F9C31DD } },
+  { { 0x5B76AFEDBCC21, 0x6362DE315A534, 0x4E2B42D3C832D, 0x6792EB7484BA6, 0x6D30255337B7D, 0x36B65434CEEA6, 0x3E060B42E11EE, 0x4BBBBD19EFECD, 0x50BE2A11CF0C0, 0x052CA68B97B5B, 0x76A555FD9424A, 0x3A165075879E8, 0x1597C2DE63870, 0x7648BEAFEA991, 0x0003BA6194477 },
+    { 0x6A6928B5FE0E0, 0x59498627DE126, 0x457368A4B4AF2, 0x3E4B8E0686DE0, 0x5075DA1356A16, 0x0AF0FB15FE90E, 0x4804CF69B565B, 0x5660E5EEA474A, 0x72ADD08B3BFD7, 0x02FD768B51380, 0x53537A3365F24, 0x4303B4E87E4FE, 0x1FE04AC07ADD6, 0x6A493E84B394C, 0x000184C76F7BC },
+    { 0x12D685FCE23A9, 0x18F768E5442AF, 0x05A5196C805B4, 0x7A5E207EB4865, 0x0D53F6F3484DA, 0x7A2B600111B1F, 0x71B32F31D19DC, 0x05B1B067CB583, 0x1F6BB45B5469B, 0x53A7BF326A3C4, 0x72A6AB088FCA8, 0x1D47012E27864, 0x4CFDC2A47AD16, 0x5311B3BD78E62, 0x00039088C1091 },
+    { 0x270580603F878, 0x7932D20AC29BA, 0x121AEE6870A48, 0x58F0BE594A160, 0x2F72B072183BB, 0x200A6DDA529E1, 0x44595EABE1F5F, 0x1623E505194EC, 0x709BE3D9EE72E, 0x057DCC942492C, 0x3D642E4ABCD26, 0x6DB5C4BBCFA52, 0x6B5EBCCA2A46F, 0x4365081733101, 0x0002F3590E961 } },
+  { { 0x22F5DEDBF5512, 0x13887406EC57F, 0x1BC1297AC8CA2, 0x60D50F9FFF7D0, 0x6215BBB3E1D67, 0x782A9BB309BF4, 0x5343E3F43FAD6, 0x1D49DAB29DA69, 0x62DBAFE8220F7, 0x2B921C2547DCA, 0x3CE1F0573405C, 0x2C78745D819FB, 0x08105935A9846, 0x6F8F12D8376B7, 0x000156C6C44B0 },
+    { 0x102C4E405A528, 0x359639FB79665, 0x2939ADB00B571, 0x3A19A355003E2, 0x7D5FA1CB8005E, 0x5E0E0324977F9, 0x2A875682A122D, 0x3060916DD25A7, 0x56FB83A1243F7, 0x4D38A2526CA75, 0x64E9EC16EA7DD, 0x4A02325CEC124, 0x472EF59AD73FC, 0x431CD315EE31C, 0x00033C5F5C59F },
+    { 0x4EE8209809E52, 0x281594F1420F3, 0x1BCF6896BF962, 0x2B81B461F41FD, 0x5D582EA8174A4, 0x630FB812C562A, 0x5DEB114A116C2, 0x0312A2BF92838, 0x5F1996E2980D0, 0x0DFD381089E1D, 0x63B327D4261D2, 0x7C60646B82D6E, 0x3E01E5EC92D75, 0x336CBD32A162F, 0x000270CD910B3 },
+    { 0x587A97AC5745A, 0x5DCBB0C140D35, 0x247ADBAC5C342, 0x7956024A3B458, 0x3FBFEE4368F90, 0x6F2E84313E7AB, 0x4DE1363F35991, 0x6307EE45B865D, 0x0142A258AB707, 0x32C7528D1A2D1, 0x11F2E0F5F36AE, 0x67F45A8F493FD, 0x7F54DB52DAC59, 0x66FAAEF2B56E0, 0x0003807452C0E } },
+  { { 0x3FEE5E86ED637, 0x4D64EFCA78D33, 0x4F122B142CD6C, 0x17AF03CB99B00, 0x705515284DA67, 0x1AA7CFB36B186, 0x461A31CBF214A, 0x7B5C0D5BA6291, 0x3E5D59C0363E0, 0x1C41DE7FFC824, 0x1B67F8A78D8C6, 0x2A20CA9E616B7, 0x106991F56FAA7, 0x5E0AE18CA9024, 0x0005A18E206F6 },
+    { 0x0DD08F85B313B, 0x6CF6E485FCAD1, 0x4044DCF256BAC, 0x166FB3761D8F4, 0x24E38612AAEE5, 0x0E1135A23F73D, 0x32B8206295000, 0x397B84522CFB2, 0x48CD8FE8DBA67, 0x7EDA9C02AC9F0, 0x1613CC70E96F2, 0x649EDF63205C3, 0x5E0830B76D6BC, 0x2D59F229DA1C1, 0x00016DDB5C6BE },
+    { 0x3557256849AA7, 0x6640BB47035D6, 0x1361C9D536571, 0x40D84931A8FAD, 0x030940DD5307F, 0x6FEB032323E58, 0x30CCDA340F794, 0x0A6781D7E23BD, 0x4C0055DE5070C, 0x0C0C6E6581F41, 0x70FDEE8AF6B13, 0x755BF62AFC9AB, 0x2DDF129190CC8, 0x0734F753EB5F1, 0x0002E01CA052C },
+    { 0x79B95674C8717, 0x6A77B000E9881, 0x5C4F05D013EBB, 0x214CC1937FAD1, 0x7689CFC843EDE, 0x6C30731905E57, 0x50BB535F206ED, 0x06BF77C8DF681, 0x65D2BA999075F, 0x201B898A6434E, 0x616F3016AC889, 0x4972A7154DD7F, 0x5F5E3DD4AEA6F, 0x7430F5C1834A2, 0x00040454D5C3E } },
+  { { 0x2B2AF32EDA7F5, 0x2E30019F11DFA, 0x23223BF98A14D, 0x38AA7292BDB33, 0x7E618612CEEF8, 0x1D701D055B81F, 0x2C1476743CDC3, 0x54C2E62B4EFCF, 0x0F450DCA3BB52, 0x4BE727EA25BEF, 0x2A6AF4E3563FB, 0x59FFEB315B587, 0x13F3C03E30CC4, 0x4A99ABA24FE8F, 0x000168B84C15C },
+    { 0x52C9BC36FBAD0, 0x3C3A34E6AFF5E, 0x4B2E9B7540572, 0x12C6AA31EFC39, 0x4EB01691AF0DA, 0x02EBFADDF843B, 0x51B84B8EB1795, 0x49F524608BB78, 0x6E8DB079BF300, 0x60EE577C2AE66, 0x1C4A178C8E696, 0x135B99CA869CA, 0x79D203BED07DA, 0x7E54F41D5499C, 0x00011EA6FC01A },
+    { 0x44E4BF557E1D1, 0x336C885CDED4C, 0x263CCBABBE6CD, 0x43154B37C0955, 0x5B618B0E8BE83, 0x667FF208F99FE, 0x43DBEAAB53616, 0x39CF7C2FFB4DF, 0x0C492B13E01D6, 0x363B5F6035CCE, 0x689C18219B9DB, 0x34D5BF7496ADE, 0x335422DC868CA, 0x3F62C480C040D, 0x0003E2F51CAE2 },
+    { 0x543F685AF3A86, 0x3B80E4A5D8951, 0x01B48899D78CA, 0x6366A0D8A70FF, 0x5670DEDB54F80, 0x75CF73AA0B84E, 0x33EEEB85FA6D8, 0x3EF305D55FB8B, 0x05535FDF3A226, 0x1664EC86BBC3E, 0x4BFC26FB9963D, 0x7B484795CCE27, 0x5F1076104DD4E, 0x74437F9FB1BD3, 0x00036C48CBB1E } },
+  { { 0x1B2F34DFB8F3C, 0x567A0AA36F687, 0x59979A256D057, 0x0672F88142829, 0x608AE4B234001, 0x00AB39F42237F, 0x4863B2C9616A4, 0x480687A463D05, 0x4842ED831DCB4, 0x36DC10B82C454, 0x7A1C09982BDBD, 0x51D51471DA476, 0x03CF7D1C37FBE, 0x3BAC986EF139E, 0x0002659E15C2A },
+    { 0x68782E6F1807A, 0x0CB8A8179B64E, 0x1D52BB6775E7F, 0x4C8510041A4ED, 0x012271CAF84AE, 0x17E6066E48584, 0x7A2203CB449AD, 0x36B52AD6D72CF, 0x09943D6E266E2, 0x6CF5AEA2ABEBC, 0x59C86DB4ED5F5, 0x1CEBBB59FDB0F, 0x078F6BDD0D5C6, 0x37D48715C6762, 0x00022280AB310 },
+    { 0x2ED8ADED13686, 0x52A1B49C75812, 0x2AB1D1E4BD631, 0x358EC5BA296F0, 0x1C9212D9292A0, 0x3AABE4D644CDD, 0x379DCF474E171, 0x26B462FE31C70, 0x0CE5F2C7CF78D, 0x70215A5581315, 0x0DB676AB0D8BD, 0x42D1FFC875377, 0x0CD36DC8848F2, 0x0C092403696BE, 0x0004E7CF1C0FF },
+    { 0x393D954450838, 0x5F3EA18020FD4, 0x4F7BA19F89B3D, 0x4D56E11A4450A, 0x0F4C7979439F2, 0x0175ED09013C9, 0x419D544FA4B88, 0x3B2B2C0F30D10, 0x2396BF5B7B520, 0x186A6301DF8EA, 0x63CD1B3D08BC0, 0x544D05D7289B0, 0x65B7C29364FE1, 0x179F17A124654, 0x00024CB2668CF } },
+  { { 0x58604496329E9, 0x0117533C538EF, 0x277DFD6AF9C20, 0x38B09698232E6, 0x4FEFF6583AECD, 0x68331A2F5C6CF, 0x67B8A879CA5EF, 0x2D03E37B2D42D, 0x400BB0271E85C, 0x4FECA4F0409FA, 0x3969F3CA05251, 0x1EBC4FC569F9A, 0x01EC6D1E9FD66, 0x3284BD9FC31BB, 0x0004F3DD528FA },
+    { 0x3DC43CE273242, 0x63B1950831B7C, 0x300FAC70A6E5B, 0x691345319E156, 0x4BF7C8D9EF473, 0x31EDE7DDA655E, 0x11155158B5BE8, 0x571C8E02AB386, 0x0BF9815A8FEF1, 0x04BB17C081732, 0x0A255DE10DD1B, 0x1FF789A48D52A, 0x02C15D39D5D9D, 0x695D99AB1F80E, 0x00022A14D891C },
+    { 0x783F386FF7B95, 0x4637DA40A1C85, 0x5FB8D15DF01A0, 0x26E664390918C, 0x2ACCEAC144299, 0x39A2B82C74556, 0x55F7429B6356B, 0x06EC4D82319E1, 0x181E32A21DF50, 0x5A96E16E4DFBF, 0x136C777CB920C, 0x37A5CE2486324, 0x28FC5C70EE9CB, 0x712345A5DB11E, 0x0004ED7543A55 },
+    { 0x1B92846C32CC2, 0x6DC6A42CAC422, 0x23A31A8C3CDA3, 0x08FF372510624, 0x5E53BBE1A2AA9, 0x79803F8FB4B10, 0x373ADE6D7DC01, 0x66B4F1FC5EFE0, 0x60BE5E37B6334, 0x4852E0904A64B, 0x595CC3319A457, 0x593E9AFC53596, 0x2B4430AAB289D, 0x1344F68BB171F, 0x0004BEE1DF47E } },
+  { { 0x5C6D58FA484E6, 0x74F6AD7D2D38E, 0x770E5AB8E71A1, 0x5F44EAB8A977F, 0x369927EA78F0C, 0x2C6FE9ED8ED1A, 0x15261A86AECFD, 0x278FBB206C1F8, 0x43D1998F8FB2A, 0x36B9074C9DB28, 0x4B6F521A9F4E8, 0x186C1019AEB96, 0x68CACF4AA4328, 0x078CA5D694614, 0x00033BA705C92 },
+    { 0x47BDB313FF523, 0x38F1E22042049, 0x6EBD7CC208804, 0x6AEB0FED53653, 0x791F225A368C1, 0x45AB472B5C83E, 0x24BA659A28490, 0x38BA401DE9267, 0x24519BC99BF24, 0x25F09DA3C87EF, 0x2C599B6589EB4, 0x2C1CD49029770, 0x5089A605E5165, 0x795E52FA37AAB, 0x0002454F13F54 },
+    { 0x6D10286C8D4A8, 0x18CF1746357F7, 0x77FD2EDB83668, 0x6422ECCF3278F, 0x17988C9A7C405, 0x557D4134B3F35, 0x70A22FE9E8646, 0x6515075A4C74A, 0x7718A1F665534, 0x5AB7E5269CFFB, 0x62CD5EB4EEA6F, 0x406CDE1D936A7, 0x490A1D484702A, 0x05A06CAE74680, 0x000270D602469 },
+    { 0x7D1C16F889BE5, 0x12C17F0EF0AF3, 0x00478A609A7D0, 0x1DC4BF0EBD9BF, 0x713F7E382AD5C, 0x6111B13C27D9C, 0x77DEA828B5A4B, 0x4F82EE55CACFF, 0x5C1A5E29AE4F4, 0x1E7FDA72A3B0D, 0x139BF3CC14952, 0x56BE53C490C01, 0x5D08FEFBE22F1, 0x74DF49202D695, 0x000310BF3B88A } },
+  { { 0x193B6C150431A, 0x7EAA6EDB0E3EB, 0x6185A7E787695, 0x61920B17647C4, 0x1117B36D2EA5A, 0x1CA010C6D22C0, 0x1BDDFF5276BAD, 0x0D6060573BAC2, 0x41DBC709643A1, 0x2766AF62824B3, 0x733F845E0BEF5, 0x3BEF6568FD26F, 0x2591390171B77, 0x33D38A31FF001, 0x0005FD0BC9420 },
+    { 0x11E215FFFA305, 0x49655DB13D612, 0x5D5C772EFADD7, 0x700035B9E1D82, 0x4B080B2845A21, 0x37C6BF562FC99, 0x59E9222D04289, 0x7EDE0E9BBDD01, 0x3705A86B329F9, 0x26C832DC04336, 0x15C21656ECF54, 0x73B0E0AFDE2D1, 0x7034E75C97E7B, 0x332A71FF9266B, 0x000259ACD2CC0 },
+    { 0x27C6044608BE4, 0x03CA01EA1C217, 0x21A5F092A1CC0, 0x63BEE4815E73F, 0x409601E114D1C, 0x5F064B882EDEE, 0x694BA60B2C3E6, 0x2316C4BAE84CA, 0x6D23288D81F38, 0x730DD91FE889E, 0x4058BE1083640, 0x736C878735100, 0x281690195D23D, 0x7EB30D527791E, 0x0003195FBA0DA },
+    { 0x5166258ED2ECD, 0x028BE4E5BD69D, 0x343DBD50DC084, 0x1A3BBA5FA1B81, 0x0C2CBA07CDFF8, 0x2BE6D7A1DD7EE, 0x76D3757DEB3AA, 0x0A272D49B5782, 0x571CCF531F8DA, 0x4E4C3AC551892, 0x5B4812D855574, 0x440B0327BBD81, 0x2D9EC01D1D56B, 0x77408017BE1C8, 0x0002BF1C8C5C8 } },
+  { { 0x62CD60892AA1C, 0x2923962A1D8E5, 0x438607BD4F727, 0x1BD0A5597F17E, 0x72AE489104A16, 0x19AEBB1D1DA26, 0x1957B9D43EAFD, 0x0317BDDE0D3EC, 0x1D9A18BE967EA, 0x54070B9D636B1, 0x469F31EEA343F, 0x49FCA18CB9783, 0x6C6A1D6BDFE8A, 0x0ACF49C4389F0, 0x00052C095282C },
+    { 0x69A28D79032B0, 0x5D1D70A5D89F8, 0x0357EE0BC68C5, 0x0F01859AE1D5D, 0x64BAD77615999, 0x65FEEDCC86E24, 0x692204BC58415, 0x322B6A520737D, 0x17EC00AD16586, 0x690F1829DA9CB, 0x65EF0100BE7F9, 0x4B98A8059C3C9, 0x693226B4D5653, 0x3EA8748B38C09, 0x0001BDA00A3D7 },
+    { 0x76FC28D472AE4, 0x3230AB89CEE3F, 0x6474029E523A3, 0x555EE7C862BE5, 0x669B562918237, 0x72D4912E377F9, 0x397A37C8AAD35, 0x44EDD8F869F9F, 0x78FE8D99C6EC4, 0x799D266F290D7, 0x1506216A249A2, 0x517C8A3EC3564, 0x4483DD9C8BA97, 0x7AA6A232D85E6, 0x0004EABDF4ECB },
+    { 0x7E514935150A8, 0x248A8D868FCB3, 0x57B993097AFCC, 0x70AB426A46C18, 0x57009F9D75996, 0x319CE64528231, 0x72E0E2EABFB3C, 0x4384B42789BCE, 0x2FB62C6906165, 0x345310F2328D0, 0x1975A502967F5, 0x768CB0B0A639C, 0x31671CE7CC4FA, 0x01BEF30B1C880, 0x0005240B68101 } },
+  { { 0x67E5A1B6DC6E1, 0x06B152EAF1949, 0x1BB4FC7B1BB69, 0x04CF18C6B3943, 0x4AC821D71A9C2, 0x243707FEA3CFD, 0x65CD432C9ADC6, 0x6071DF57A2EC0, 0x3ECB687121CB6, 0x1F138470E47E8, 0x22AFF98230951, 0x4B8BD98A57097, 0x0D1FE12958CA0, 0x41F53C0315D91, 0x0001A0199AC13 },
+    { 0x66A9211F75A04, 0x03E289FBA689F, 0x567A4B91A9757, 0x11D35CF011D6E, 0x347EC0AA75C98, 0x40CD57C3DDE87, 0x3548F426F27CE, 0x6579190063186, 0x4D7537E7F8AE7, 0x2EA19180DC202, 0x600775B11884E, 0x5C1653AC4C0B6, 0x7C7A23D55DC9D, 0x5331FE22790A1, 0x00022B75CC11D },
+    { 0x7C87F374EFB7B, 0x6A431C5A38D1B, 0x72A341A7B4949, 0x03F876F81F007, 0x31D1E8C4FC1E6, 0x5C7CFC45C9F05, 0x348A61DF78DB5, 0x473CA20C3DBF1, 0x2C558E8420E44, 0x43A74B47073F8, 0x073B0742F52D6, 0x0419ADC78B619, 0x2F3480D219DA3, 0x5314492BF14D5, 0x0001FAB3887B4 },
+    { 0x4D30B5F71660E, 0x184B4B3C004E8, 0x7E60F3A52D046, 0x4A0F80DC6B5DB, 0x0AA4BECBF990E, 0x4E4E6055C7948, 0x7593E5ED0DF29, 0x26FC8C140925A, 0x5FEF3A23EB03E, 0x7E495105F9791, 0x4FBDEC40D1375, 0x45381A4CDC242, 0x37354B553F039, 0x31A0621B94006, 0x0002D7D588AE0 } },
+  { { 0x782C27EE29296, 0x23D2132CDBADE, 0x714C7188699EF, 0x75810BA7BDB2C, 0x11DC682FEA91F, 0x4047C79111E62, 0x2C2598DB94C95, 0x59734277C2278, 0x03364943D23FD, 0x2D67692B52D41, 0x7BD27505CE820, 0x5D6D792EC6994, 0x0609BE7101247, 0x7682CBB5182C9, 0x000309378BD8B },
+    { 0x1DC429CDB0B2D, 0x3D33361F5BB65, 0x11B315761F20B, 0x10D9E45DC5F43, 0x57AB8BEB54136, 0x1D971AA364AB2, 0x6D8EE8970D229, 0x6887A61801A6F, 0x7106765B353FB, 0x48B6EE5CF9DD4, 0x2501C802D1F10, 0x582DB5FEB5000, 0x46BF3A763A1AC, 0x4EB9533B62D45, 0x00017BF4EDCFA },
+    { 0x46FA4062BDE68, 0x5B3FF3D50A065, 0x03D66C5326A22, 0x328111C24CBDB, 0x3B128B8D618CE, 0x4BF6970FD3417, 0x279E8A6C7E96C, 0x71DB1541BAF66, 0x01B0D46012893, 0x4B6CCFEFB9A6C, 0x79997A4E8688F, 0x436219A35416C, 0x2D0861B183B03, 0x4B0F3821C0C86, 0x000683BAE0201 },
+    { 0x527B86E88E28D, 0x05E76F06DE90F, 0x7B90824B0DB45, 0x7B1BA16FF6582, 0x6199B3F44A1B9, 0x341FE39148E26, 0x12DA67687715D, 0x19BA892C77192, 0x6CADE0D64E14F, 0x58DF0BADB73F9, 0x6C06683A5C388, 0x54A646854EBB0, 0x204DC4C516B2D, 0x5ECA634DCE6FE, 0x0002177AF4858 } },
+  { { 0x1CE35F2E552CF, 0x7E1ED9EE16556, 0x692F8D79B3FFC, 0x48077844432D4, 0x58242973E59C8, 0x61A945BD1BE65, 0x15D7AD8440D8E, 0x4C0941CD8FC66, 0x344CD565ED2E6, 0x76A4E78DD0CBA, 0x4817B001105EF, 0x0042BA71B5960, 0x251814A45AB00, 0x2DE266BD7FA69, 0x0005C49DCB659 },
+    { 0x72FDC8AE8E742, 0x4B54543E1BBC6, 0x534B0E43979C1, 0x267DD3FBC3E52, 0x43A10D7FF47B0, 0x2C3CF70790B94, 0x752615940EA32, 0x2AE08A777F658, 0x1A4BCA15A151E, 0x5D7F0EA205654, 0x61713CE43C78B, 0x52BC15ED33507, 0x3137B2FC25BC6, 0x080C2A9BD0E25, 0x0002341DE470D },
+    { 0x2CFA4E3440C63, 0x6A05EA5849CE4, 0x43570570C08B6, 0x076D50C236863, 0x767674655ED1A, 0x3AF7CE7AB7C77, 0x3321FB239D27F, 0x02E73E972A697, 0x7BF8C49CEEA40, 0x5168F004EFC90, 0x727380957293E, 0x4A8E6F8F1C8BB, 0x76D9AB4AC1A32, 0x6D871CE4AB0B7, 0x00042EA67780A },
+    { 0x3A6F91C120B60, 0x2C55E34EEF3CC, 0x3E5388DC13124, 0x009F0F893F3A2, 0x593EB6101CC56, 0x540408A7FDF0F, 0x4CE09D795712E, 0x66A0FE7D4E715, 0x6BA23F7C92944, 0x2D107714CFEB6, 0x0CD4BC31A8F42, 0x38ADD0142A75E, 0x10D42DCC07F9C, 0x20B0D8B459435, 0x000335AD493E0 } },
+  { { 0x52A1D251D318D, 0x1F8FAAB8573BD, 0x5B80D1ACAD644, 0x21C4241C19D88, 0x6DF6BF295F09B, 0x13E458AFD760A, 0x34279D9A2A1B6, 0x1268C46CBB005, 0x78DA3ECD4431D, 0x4F9129DDF2C4C, 0x37C06551953F1, 0x5F3DBC52B701F, 0x309C1DBC55CFF, 0x1A2E608B97425, 0x0004484F25B26 },
+    { 0x17F64D7BEFD58, 0x092B820EB6B41, 0x766415AAADCC6, 0x654D346C68021, 0x56FF650945E17, 0x222396C40F0A3, 0x528026F05A7FD, 0x3DA4F6FCB1DD2, 0x5941D4C0C9E8B, 0x1E179728DC70B, 0x1328FEB3ECA54, 0x47402DE80C2ED, 0x749110911CDFB, 0x1B58370FA6E9C, 0x0002C72A2AB32 },
+    { 0x53EFD08DCFB8F, 0x49A4A499F953B, 0x33AD6F90D7472, 0x5C32352A496CD, 0x4CA9EBC17FB30, 0x1DF6F7AEF9B94, 0x53F73F381CBCD, 0x46196F2F3BDD0, 0x77D3222F81CA3, 0x3AD670731086B, 0x50C84130D5B1E, 0x37A37481AA3A0, 0x744D276FC6CD5, 0x7C1D2E3BE9A53, 0x000540F13A6CE },
+    { 0x1682A401CC32E, 0x11BD03A317786, 0x2DD6D14265D9C, 0x277389F283874, 0x46B2C763329DC, 0x60FD02C83644A, 0x3481D374259AB, 0x5ABE15FCFE771, 0x208188297910C, 0x7284E9372FAFA, 0x0722D320D0C8E, 0x53B891A6FD96A, 0x55788284A95B6, 0x53CECEF875646, 0x000393DF8F81C } },
+  { { 0x4467427A7B89E, 0x48FB58D088689, 0x35089AFC51447, 0x1A971251CFDBB, 0x6C131585242AD, 0x2F12DEA5B337D, 0x6DDA8A58A0CE4, 0x058D98DF76272, 0x23AB6E0FDF01C, 0x1413E41658085, 0x6926E36ECDC13, 0x5BC4EA9B02427, 0x35D5D9FC53419, 0x726035F4A1A07, 0x00039067FC5D0 },
+    { 0x170C4645A453C, 0x7C771F45826C9, 0x3A1A3F3BC2F38, 0x3EC5666C26FB3, 0x3C511CB777EB7, 0x2D024157911D6, 0x4C03C48210CAD, 0x3B06F9246D02A, 0x6C4C2055CABCB, 0x2E912AE03C334, 0x56162B70F9ED0, 0x4BD8F0770AC21, 0x7CEAA8377F7FE, 0x6B8BA46F2836B, 0x0000D6811B681 },
+    { 0x603CA2F4FBD52, 0x5DCD7F2EC2E99, 0x600B534D3B740, 0x2D6E98A92A246, 0x3E12A9BA60E18, 0x39E2B5F900519, 0x7A9BF19F71FB8, 0x37547CAE941C1, 0x151910C25A239, 0x1B79001B166EC, 0x54B65A2141374, 0x765C342B75F8E, 0x64F54AB2630B7, 0x663F9F5DAE5D4, 0x00008E3110037 },
+    { 0x2F211BEA76EB0, 0x34859872D7701, 0x661653080E764, 0x4B204BCE3072B, 0x4058A70934641, 0x3B8FD7CFD7556, 0x2F8301E411CFE, 0x647AA3277D4A6, 0x241E5D0A2A1E4, 0x1552B7B06B21A, 0x71BDF56DC1480, 0x2BE76B25FE1BF, 0x5A34E3498B7FC, 0x3A9C1EC1C5F3F, 0x00043617ACCBF } },
+  { { 0x32BFF367F3311, 0x13AC13BB4C5C0, 0x0C469B6134594, 0x052F1BEF0BCE4, 0x4D5F0BEFDCE33, 0x2BC421F761D90, 0x4CD9DE6941665, 0x4A7D399BC53A3, 0x38473C9A5B4F4, 0x2184137346A48, 0x76B4EDCB36D78, 0x26EB763BB22BF, 0x7DB1DA0FD701A, 0x4D9D7DFC3724C, 0x0001D44E218FB },
+    { 0x48AD8F006F235, 0x32C453A97320A, 0x4755DE629300A, 0x29D6139F09635, 0x00CAB58095311, 0x0318FDF46FAC8, 0x1EDCB9B068568, 0x078A949CC14CA, 0x1D5D585D51E11, 0x507FDB27A546C, 0x0655663F530EB, 0x40D5829CDFC7B, 0x570A08FD25495, 0x72C19BBA4D4C6, 0x0000EB0031146 },
+    { 0x3B4E800B6899F, 0x07EDC80DF6028, 0x15422A9598421, 0x3B1FE6EC14A22, 0x47C8DCF672129, 0x5DBDD49126DB7, 0x44EA053BEA6B8, 0x1B238331CC455, 0x28FA5D8763D29, 0x3EC14B3D0E556, 0x5FD8E8CF9DFBD, 0x1782292B5C040, 0x15A822349401E, 0x770801508B9B5, 0x000529B4081D5 },
+    { 0x71E6E1B010521, 0x64B31FD39FA45, 0x5BB4268AC7EA8, 0x46C4CA486E170, 0x0CF33A1FFE005, 0x3E149E8A53B7C, 0x25B7B2AC24457, 0x122890C9F453D, 0x79B6865973271, 0x75B65BC88C363, 0x49A939AEBB058, 0x50D08792D4C90, 0x4F70C79C9AECB, 0x3B156CBF0C2D0, 0x0002DA0E7CCCE } },
+  { { 0x0A4804D540556, 0x38F11782C4369, 0x094172FFD60F4, 0x6A97B0571EE1B, 0x02902493B847C, 0x125E09C2CB463, 0x521BC5341194E, 0x54161EAA0EAC4, 0x0D263E6BE6053, 0x23278E17AD34E, 0x11EED8FD09C17, 0x502ECF7357903, 0x32B1233A4F62B, 0x67782F65AEE7D, 0x00031CAFEFBD6 },
+    { 0x7BA3DA2F1591A, 0x44C4222042A31, 0x56B68B2183501, 0x286B79C0E674E, 0x7602DF1CBD6B6, 0x52C9AD0B9DFCE, 0x08F2A52CDF10A, 0x6120A55768E4A, 0x0C7A235E2EEFC, 0x6C85EE01D125E, 0x190D50AE1767D, 0x2497CC1EE2587, 0x56BA7D4CD3B96, 0x5162E917C8678, 0x00029B9E7B41C },
+    { 0x4D2FB8B7BED3E, 0x19D99FF9E79CA, 0x31DF23F6046F6, 0x36B334A8EB439, 0x45E1C6D6B1FEF, 0x36039E9C2F379, 0x55E51B2AB28EC, 0x7CD0968FC36AB, 0x65064DE2B0ED5, 0x77D92882AEC7F, 0x21EEDC7DB14DD, 0x3D209595BD150, 0x4D9ADD76E3641, 0x39D67EBB7B0BD, 0x0003BA0BAB6FC },
+    { 0x5A25F7EBE667C, 0x684CA727F6784, 0x7CA392F5E094A, 0x5444FFFDF98DD, 0x1C4AA176CAFE8, 0x6A53F8807F939, 0x08C8427F8B572, 0x2E07AF5971D23, 0x431A676B4B9C3, 0x3D35D09557F9D, 0x4AD3DF8B23BE0, 0x48FE21F74D676, 0x3C91C3387EE6F, 0x6AEA79BFF7E93, 0x0002E5FCD8F6F } },
+  { { 0x10516AE0B3B98, 0x4596AD78471F5, 0x0A21A3E6FC4DC, 0x4F0E03643782F, 0x4484D204AAF05, 0x72DFFEAD8F67B, 0x0FE49980130C5, 0x64692BC66337B, 0x6C05C46506558, 0x56BD8212B2A6F, 0x70FEE51BF35C7, 0x373AD92E67E5D, 0x4A47AA1E5F8EB, 0x4CF55026DAE18, 0x0001AA05622A8 },
+    { 0x6DD95D5B21CA2, 0x749FD550D6F39, 0x739DCB85925FF, 0x63111E26F8516, 0x032F8ACF8EF42, 0x1CAD40BC81B47, 0x7D22D5111ED48, 0x44D54E59F3674, 0x26A950D0A9264, 0x2417EFB21FD5A, 0x20D554C95C184, 0x3C7D1DEB3DA60, 0x6CC1711D52084, 0x1BA25D1267132, 0x00018F9C4794A },
+    { 0x5F1DF545C1D7E, 0x6C4DDC8D34160, 0x2F0A6B626F6E0, 0x7BCF51464E315, 0x2ADDA727BF23D, 0x4A9E317871533, 0x31DAD711FFF69, 0x3F64CA74A9F02, 0x6A8062D75EF9C, 0x5EB866577BE37, 0x23EA7DA57DBE4, 0x3151207E83569, 0x17EAD3C0E8A07, 0x40A816817EC8F, 0x00043AA4F528D },
+    { 0x3A205F2740BE2, 0x2C569B8481B84, 0x64711CBE7D383, 0x4BBDB00BCA036, 0x4A944FD33CE90, 0x258D43FAEDDFF, 0x75BD1414229B8, 0x7EB4935ECEBD3, 0x250B86AA81148, 0x50F693F2623BE, 0x2B09C212E1CCE, 0x28541AF59FC5D, 0x1479ABE2BC2BB, 0x30EB7013CA084, 0x00032A736373F } },
+  { { 0x06C10C87B719F, 0x2A1267FF054EA, 0x00ADA272E47FF, 0x5A40B63375AA6, 0x00A4C14F39157, 0x3CFF8A5BBDA18, 0x6B3A962D43A94, 0x49449424FA852, 0x733D605CE618B, 0x29A5DFAC44A7A, 0x18DB6A8CE6355, 0x4329778DA44FC, 0x109B33BE6A203, 0x7651215CA9AB7, 0x000171C483250 },
+    { 0x3ED89B4EDC31A, 0x4CD556E5C8CF9, 0x3889C70751632, 0x32B4734F1CBDD, 0x614EE262E8884, 0x198348FD36757, 0x26CEAF8D80CC2, 0x15A48B1FEBE34, 0x39064090E7A07, 0x0414AC7852D72, 0x23BA8555FF173, 0x1E8EE09512331, 0x27C868CC09C8F, 0x2B1684EDB5E9A, 0x00028BE4BD44D },
+    { 0x16B729453C809, 0x47F8B79664FCB, 0x1BCAE315AC278, 0x1BA3959FCE81E, 0x43F514195C57F, 0x3A61EAD7078AD, 0x0D9A10F4EA821, 0x3C57B52C051B0, 0x60AAFAF8653DD, 0x0CE17643A223F, 0x2CE1E906704F3, 0x6966EFB26C598, 0x650DB3D5828B7, 0x597221151ABCD, 0x000218E156617 },
+    { 0x250F031160C5A, 0x223318AA82CB8, 0x4FB5191702109, 0x3B65D680727C5, 0x7C50173447109, 0x1354E2CA84D1D, 0x2F7D2A516727C, 0x4104AE0556095, 0x3BDE0ADBD49EB, 0x4DBE67D0A9BBB, 0x665ECB9B2D0DF, 0x554E3F5944C9F, 0x6F1573339BFE2, 0x0D0DF9AE5EBEB, 0x000367C2A5810 } },
+  { { 0x5D0CB7481CB6B, 0x3E4161E870C37, 0x599B425A10A2F, 0x045971FBF40F9, 0x2F37C13FC3E74, 0x6E578D78A9BFE, 0x102221DA5F680, 0x735024BD5781A, 0x20A809D6FF967, 0x6E72519F89E91, 0x77288FF05D130, 0x0318F6AFFAFA2, 0x5E38E179F60E9, 0x0A1B4B2355DA2, 0x0001FD6F21B97 },
+    { 0x3521886A13361, 0x2D051CFE88876, 0x7281BE29DBFD3, 0x2B6022A69D81D, 0x720D215C73BD6, 0x4419825384056, 0x3DA49B2FE7D25, 0x5A076477854A7, 0x2BFCDB289ADD3, 0x0D6DC86DA203B, 0x391D1F0061196, 0x49E7EE0313F3C, 0x1968CC9BD2571, 0x46C6075F632A0, 0x00029BCB951C5 },
+    { 0x143DD2B6D6085, 0x323D4B2458B5E, 0x5B55676CAA71E, 0x2FBD88AAD0D3D, 0x21F302D6D296F, 0x04473CB30713C, 0x770982EBDA3AA, 0x3312F41CA6483, 0x680982CDA1449, 0x3798A66698F7C, 0x4EE88281CA819, 0x67E37783F7054, 0x29ED8CA6E08F6, 0x064150C06017B, 0x00038E983F3F8 },
+    { 0x355D6DE3E331D, 0x286DADC1F68BD, 0x4D5F3C1D44269, 0x76632FD0EA267, 0x6E8611FDE734E, 0x6BF961230D458, 0x1888027C53EA4, 0x53D969FD029AD, 0x7ABDE328144DB, 0x6A2ACA0756D70, 0x56AA4E00161E7, 0x0BA124B823E28, 0x1BF92E3AAFC47, 0x16CFF879378D9, 0x000312870FA58 } },
+  { { 0x0FE528767602A, 0x51670E3ED7442, 0x5AA747025C029, 0x5E365B8E43DE3, 0x66D9ECA294B2A, 0x2267D31B40CCF, 0x097A520F5BB9D, 0x6B1260A25FF34, 0x0293E69D54FFC, 0x77CDAD5B93948, 0x051722E37E885, 0x7C2B9091D7374, 0x1784EC7DD17FA, 0x1D08CC0E4149C, 0x0005E9BD198B4 },
+    { 0x2B4D5A8B91236, 0x66B35809B8C2E, 0x627C701BC186A, 0x2E9E97174F520, 0x348C275CEB75E, 0x19ED75A2BB063, 0x2033045CBB0BE, 0x016D6AA3FAF13, 0x60E64B28F9BBC, 0x7C1457FE9375C, 0x56206A7951211, 0x3947B502BDEBA, 0x583D5111C3AFC, 0x73BB1C211CA0A, 0x000117F849F0B },
+    { 0x239222CEE7F0E, 0x7551FB80D7DE6, 0x4DCEEF7BE09A7, 0x623A77BC0D5FC, 0x03C6F2DE104E2, 0x21058A8F2FCDB, 0x1C7BB5B8091FB, 0x567EBF2D4E176, 0x610C7528E278D, 0x73420D88AD2EE, 0x055DAFE0B277F, 0x48495C7AF7F13, 0x2B16250FF09E5, 0x154E99FDF74B4, 0x000449D348E48 },
+    { 0x578CE458031CE, 0x257F288F62939, 0x2EE22A9503EB4, 0x1CFC48D459951, 0x61946CF5C36FD, 0x6B413DD6E5F13, 0x1DFEE9B9395AB, 0x4DFC797B442E5, 0x282B50257B471, 0x58C670B5F16E3, 0x7C79014112E13, 0x133E81C559D32, 0x5158D4881FB68, 0x02DC50379C093, 0x0003B6149BCB5 } },
+  { { 0x2D8C3EC0E2867, 0x3443D8D42589A, 0x47C57C7D39DC2, 0x6CF10A04CC905, 0x4A83543D0D7DD, 0x13FFAB4B96969, 0x442F9639B89D2, 0x5D61CAF2C0D90, 0x246E23A7D1EBB, 0x5D95A293E4F25, 0x2809265BB846E, 0x4F5635B0764EB, 0x1D369DC1361D0, 0x1AAF2A8F7E2C5, 0x0002C7033AD4A },
+    { 0x2D8757FF89D5A, 0x4BBA8B7A48931, 0x6FBEB9FA5A3FF, 0x11845B508404D, 0x79C75A033AEEF, 0x59C33E3D4C1E5, 0x2342A2B8C0266, 0x38FF2777BCC88, 0x585C0DA4B26FF, 0x76C95CA30B6D4, 0x6A709B029B64A, 0x77635620B994A, 0x245F4067083F0, 0x3BA987FB3C452, 0x0002326A5491A },
+    { 0x57BE0DEBCE193, 0x535E5A390AD2F, 0x620FA731CE8DA, 0x7275F7253CBDB, 0x01F817DB237B4, 0x7E9144F4FCDDE, 0x7CECFC8217843, 0x06F181575B20E, 0x6A75C5E78096A, 0x08F91C5DB43A3, 0x64E7106E44F03, 0x59E32060D9EA3, 0x25E57C41B07BA, 0x047B6426644F9, 0x00016C73059B7 },
+    { 0x0DF107E576794, 0x678E0A1F19E3B, 0x11CF6CFDC8B79, 0x7159FDBA98508, 0x40B9CA301CC2B, 0x683762706F954, 0x51028AD18467A, 0x6BA757B93163A, 0x695EDD41CB0A0, 0x236EF8F8B5A27, 0x2103C4FE8167C, 0x3678B503B5605, 0x3A6DE488EEC79, 0x48E067EA395BB, 0x00048F8341B63 } },
+  { { 0x60BA99AF2E081, 0x58E0EBAA60871, 0x27CE87B0497BC, 0x0D5C168B426DC, 0x7FB972A725A73, 0x27942193DB21A, 0x66B95EE6AC8A4, 0x256B96647D696, 0x6A8C0DEDA95C2, 0x046429623B922, 0x4CBEA3C58B9E8, 0x1F1C451E2B7A9, 0x0A3BCCEAF92AD, 0x62E45284AAA2D, 0x000433D8F3BC2 },
+    { 0x31706F921C580, 0x40C6FB57AB6B0, 0x709F3FD0F29B6, 0x023FF4C7CC18A, 0x075FB0EB49593, 0x1848B8268BCF0, 0x5E477614E46BB, 0x66B57EA6848AA, 0x0C5AC89EF61CD, 0x4AF9C610C8B4D, 0x60381ABE6DFEF, 0x1FE69A4280CC2, 0x7FA7DF4A29DB8, 0x0C9721042DD1D, 0x00008E5EE0B59 },
+    { 0x48984987FBCED, 0x01F4B060B88A2, 0x3DD8F3AD92109, 0x46A8A8EC30BE4, 0x0DCF5FB4E002B, 0x02B3BAFCE4FE6, 0x6ED3B43AC824E, 0x57FD4A41F3AF7, 0x462D11AD1E426, 0x74667EF18B956, 0x5184EAC2323E1, 0x1FBFDA25B94F5, 0x523670C95B268, 0x2A95BB6A7158F, 0x0005C67C52F56 },
+    { 0x452B23301565C, 0x2C96CF69FE0EB, 0x6B5B3D440D890, 0x4186053716C06, 0x20A5BDA42432B, 0x61902E595D12D, 0x6AC01C99728B2, 0x43B13FC545115, 0x0D3B9940FA7C9, 0x6BC3A7DB9FDE6, 0x7AB2BC6A9A824, 0x0854FA4CA6685, 0x71AB3275C0613, 0x16DD1C2992063, 0x00033B827CC4A } },
+  { { 0x518D645F32A9B, 0x0F430CEDF0AC1, 0x2D658FB336142, 0x7F9BD7B008C44, 0x35D271349D441, 0x71DEA09391D4C, 0x714F0466AC3B2, 0x256050F4DC665, 0x105F601DDBCD3, 0x56D3559C636C4, 0x6444CBBCC4BA0, 0x335D6E6E2D2E2, 0x0BE865CE9140A, 0x747D08482359F, 0x000626919E7EF },
+    { 0x4D1B41EF1CF07, 0x4D134A8318F1F, 0x70704087FEC42, 0x4BBD7116E66EE, 0x4F8DF907D6B6E, 0x74AF815584FC3, 0x715BA5A407BB4, 0x1F9FBBFA513F6, 0x04A5698093672, 0x25C9F669BE704, 0x1465F76576552, 0x092AA4AF2E2F9, 0x054C8CF4DE788, 0x00237489F6103, 0x000232231E236 },
+    { 0x096D98BA50095, 0x55E1165A3E570, 0x7286C9F6DF859, 0x457F33F0471A9, 0x3B8DD883D8201, 0x245C417E9FB4E, 0x49AB2D47AEF92, 0x0C6D7F3FB03B2, 0x2FD01ED20B961, 0x37EDB891D4C4E, 0x4BF9316B0B496, 0x587894B2F3044, 0x6E1F54AF97A77, 0x18DF143D86250, 0x0004342455EA6 },
+    { 0x16628BC1DBAB7, 0x4F7663CDF40B8, 0x1BB55DA484DE0, 0x70B2637DBC00A, 0x7D4CD3DE3BF1B, 0x42EEDD9DD71E8, 0x07CD5AA1BFBAD, 0x6DEB247D2EDFD, 0x0AF07B5724E60, 0x443B80E8377BF, 0x21836CE400879, 0x2430EEB9017B4, 0x359EF79DC0FFB, 0x5613ABCBBE3F8, 0x00032B423F4DA } },
+  { { 0x1A4DA76ECA3E4, 0x2C5555F9D113E, 0x75E55666AF7EA, 0x4D5757FEB5751, 0x1A6942EC6A4C6, 0x0249C9F17F4E3, 0x1CE15D67124D6, 0x1826EF8BC2383, 0x75D7CC2506345, 0x69ACAD5184FB6, 0x06D6E68C9446A, 0x5E5C167F8F0DF, 0x07B0148310808, 0x7849513D08C84, 0x00010845D8AB6 },
+    { 0x3FC435E9A1527, 0x3D129EA3C0A66, 0x08A4E501B0309, 0x0DFDDA32497FE, 0x2F4A1859A3605, 0x4977B88024362, 0x359025F08D1F8, 0x5761EE6A6A630, 0x1F885B4B6E78C, 0x36B915CA4B720, 0x5B7105C825C32, 0x5EDC78D694411, 0x678D4393B8F8A, 0x7EC63592A3160, 0x000057200B273 },
+    { 0x11C12902BDDCA, 0x5916803EF9470, 0x4DFFFA257D863, 0x27EE236CE3A40, 0x6DA098A2E66A6, 0x0377CFCBF8A76, 0x5E4369FC7F2A2, 0x43A47716906A3, 0x2380A6758041A, 0x255CBCC0B19FB, 0x75693F5AE2A3E, 0x3EEDA7F22A942, 0x43E75DAF419CA, 0x1467EC562E9AA, 0x0003ED41C9389 },
+    { 0x2087C37CD589D, 0x345238078415D, 0x2B4EFC183656F, 0x2A6553BD28F14, 0x130562A5AF9DB, 0x2900780B6100F, 0x6F3E52655BDB8, 0x259C2390C3342, 0x7105FBFDC81A1, 0x504F9ACFDE8D9, 0x2F8446AC8D899, 0x11BE23D208800, 0x6B4C476ED81AA, 0x5A186B650AED6, 0x000378C4BB51B } },
+  { { 0x78B706FBB7587, 0x429C312F9997C, 0x089A484497326, 0x3D4818E577ED4, 0x754E39D50BBA2, 0x35D5FE0AF62AB, 0x7FE947CBBAE2D, 0x2660597CCD371, 0x70FE1DF49A1BC, 0x5AC69ED3FA106, 0x0AE4C0057E069, 0x29FB9BB6ECF8B, 0x49458715678C6, 0x405A3C99849EE, 0x00019C1E04E12 },
+    { 0x49B8B1D76FE94, 0x7FB129968A4B5, 0x04A93AF9E7110, 0x6472286CF8203, 0x47D0DA5ADC62E, 0x7AD2683336EE4, 0x76ED665B3CF1A, 0x5307484A9D480, 0x1956955405C0F, 0x7F5FEACB04933, 0x38ACB009A9F45, 0x07E7E3DFC755D, 0x7156D4A556679, 0x5EDD21EEC03A8, 0x00010E518F6D9 },
+    { 0x55C236FEF62C5, 0x6C34F82555491, 0x7E69E76F9620D, 0x5AEE95D65F66D, 0x0E30090E4FD14, 0x606FDE9549521, 0x088354312C0AA, 0x3CFDF67B35893, 0x71E8230E59D89, 0x266DE2772D255, 0x00A35D1F39071, 0x62C99F95B525D, 0x7C11A0E8A32F9, 0x00B4D8B6F9956, 0x000416EBE4934 },
+    { 0x3E0C706190D42, 0x7FDD97AEB5502, 0x67D7BAA0F5A1A, 0x4D71C9F4B85F8, 0x64451E3C5334D, 0x1CE60BC4A4811, 0x5B150A9011BE7, 0x596067FC5746E, 0x2B6138FE14699, 0x53D8111B1DE6E, 0x7674383DD2EBE, 0x57D4513522C33, 0x22F37204E0A8A, 0x52AAFEF67C5F0, 0x000286CB46921 } },
+  { { 0x22366F361E577, 0x39E617B0BD8D7, 0x35A38DCCA6B78, 0x1F0E45FE75848, 0x662DDA6390A60, 0x3FADC616FDC02, 0x7EC732CAA2D76, 0x320E7DF4D69D2, 0x658EA50E3447F, 0x4B564EF14843A, 0x2C3142E09A376, 0x37F786234836F, 0x4825B12BE688A, 0x3B60FB4736FFD, 0x00019B2C2F3BF },
+    { 0x6CF2C26F77139, 0x6599DFD27E95F, 0x7E20376A11118, 0x753144B4B5289, 0x566124FB03727, 0x709A5873B6EBF, 0x656C856C0F598, 0x041F30936A795, 0x5B1B7BD511623, 0x364B8CB4983BE, 0x1A1D4AE407DD7, 0x1FEA6860DC149, 0x6DC31F1F303DF, 0x4BCC4847E455A, 0x0001906C77ABA },
+    { 0x67B6322AE4C69, 0x6E10B99362CE7, 0x5F6E96059E752, 0x3057C99D1ABBD, 0x3067770FDE67A, 0x2496A77745DB7, 0x0E69F8F39DA7A, 0x09E594C3FD2CD, 0x128F36201554E, 0x1B880E36F82F1, 0x3FBA50D18D753, 0x48C137A150516, 0x25154F8D1C402, 0x427BAFC7A8443, 0x00047FC4B35E4 },
+    { 0x04AF1720D64F1, 0x5DC15AEB035B9, 0x0FCBFD043DDF9, 0x0AFB20494D347, 0x4BCCDF29277BE, 0x0E59BF4A1974D, 0x20F737C69D0FA, 0x215909781D089, 0x358374BD41C32, 0x4D6C4D6F325B7, 0x6FF9B315EF558, 0x5BEE5622EEFEB, 0x122390F3CB38B, 0x74E11C1FA8216, 0x0003E415390C3 } },
+  { { 0x2A7733CA4191D, 0x2F5985B9B1DD2, 0x1F679A2F4C601, 0x51F2A631A1CA2, 0x4AC221E51F747, 0x7BC25809B6388, 0x38139660CBE2E, 0x493526D24B60F, 0x61C5CE5D4D4A3, 0x0AA8177BFA07C, 0x00AB49E303F99, 0x2AA7806383CE3, 0x355ECE8551F4C, 0x045CC82E12893, 0x000168EE0D0ED },
+    { 0x5186335FAE649, 0x406E97ECCBBC3, 0x4340FA030BCEE, 0x3817DF664F240, 0x7B32F2839D316, 0x2049290ABCE69, 0x234EC45A198A1, 0x28B7E8314311B, 0x5A7744E5CA353, 0x1E50EA6CD1643, 0x785E3F47864BF, 0x5114A6EE3636C, 0x5A2F66A147D80, 0x01B9E2B51DE46, 0x00009E1596FEE },
+    { 0x3992DDFDF42F9, 0x201CE4BB038C5, 0x35ACBBD86EE90, 0x4F55459E14321, 0x0F91E8CBA1241, 0x240F48B851C64, 0x2E10D6FF3C63A, 0x32CCCD10D1981, 0x700B003FB822E, 0x695B7052FF43E, 0x20B92A55D6DAD, 0x4B684918D9CC4, 0x4BB5C55377C04, 0x183651BED27F8, 0x0004E19C85475 },
+    { 0x5729F91A28F45, 0x5A3606F1EA776, 0x00AD7DA9E85BE, 0x3FA10DEA2A831, 0x6BAFB5EE9BF12, 0x45A8425276091, 0x2AE9E7EA8BE7E, 0x69CC32D91E463, 0x66FC8AD64223C, 0x7B96436E0AF3C, 0x71BA5904152B8, 0x0B8C48D5CE999, 0x182109F717E6F, 0x1DF8992B5ADBB, 0x0003BE46552C1 } },
+  { { 0x68A6ED1FFF8D9, 0x34E6996455ACB, 0x168290F36D406, 0x584ACC3252B40, 0x4A918E9E5C3A3, 0x499E984B93ECB, 0x72E97BB76DD08, 0x24AC8FF59BAD7, 0x6941E0444FB20, 0x2FFAB569B8ED9, 0x654D7DDA8B6CD, 0x30DA3697A5FBF, 0x1D44FBB2E4BAE, 0x055FF5ED03BDC, 0x0000A87E1817B },
+    { 0x19E85BF514BD3, 0x55A59C0309BDF, 0x62FB386BE1DD4, 0x3F18DEE5E0B3E, 0x01732E2A31962, 0x2869F9FC20319, 0x4E77076B3CE5E, 0x55917D56F600C, 0x7CDCA93624F83, 0x514D78BF2AB03, 0x7E943CF22C03D, 0x7AE7ABEC8BE8F, 0x47BAF12EF3D93, 0x7539028B01A3E, 0x000224A33530E },
+    { 0x3F590C65AE39F, 0x100760058A6B8, 0x0FFA1B56F686C, 0x53DBE8DBEFD90, 0x3D8A2B161B0D7, 0x3C6850529155E, 0x61F3413C9E785, 0x3D5B59D162307, 0x403A66707E002, 0x1E10B40E66704, 0x4D1D44F872555, 0x4F7DCF3B60C5C, 0x37F74F2305F8B, 0x491BB8885BC60, 0x0003A2A798C8C },
+    { 0x512775BB68817, 0x28F29553C0D0E, 0x3CF44511987E8, 0x6185F56912EFE, 0x404BE6290837A, 0x7D4BFD7811B10, 0x68F6BAED80059, 0x2564975F04691, 0x1094D39FBA184, 0x0C110030895A0, 0x1893F43BE1436, 0x732F80FF2F205, 0x5DE10F5FF787E, 0x6C12978F455A7, 0x0003F953A613F } },
+  { { 0x4741EB8259BF4, 0x4871F7DCBB887, 0x79E8EF1DEE7BC, 0x3E2C42866FBAD, 0x78536536C059D, 0x3153EF8C155AD, 0x61258AACAFCC8, 0x46063898B5D84, 0x7C5F4A1885920, 0x2119AC35996E2, 0x5545EE442EA65, 0x1E2139A5D195F, 0x3D81E7083C656, 0x6223CE5259CE1, 0x0001D4D489DCC },
+    { 0x2B64B2424E23C, 0x07F1250D98EEF, 0x73685EBB04158, 0x7CAA031C0C48C, 0x06BB8DA1009E8, 0x0D6DC0F95AA90, 0x6313FFF88D844, 0x720060B586C88, 0x081CC3F8ED43F, 0x0FAB2DE00B8A5, 0x749A55DADC305, 0x31B5118E3D724, 0x367F47B211601, 0x57AF644366BB7, 0x000168926ED5F },
+    { 0x5CE791742E1F6, 0x343D13048837B, 0x2783864AA6B66, 0x0E6E01C5C262B, 0x7FCF48000A5B4, 0x23DA971A2A41D, 0x1509EEC2343AD, 0x675CF369EEE24, 0x6861ACACE774B, 0x0ED56F093BB4A, 0x0EBD36C0D4E3C, 0x7A5BDE09EFF5A, 0x04C8BDA67C495, 0x67D55CC0B08D1, 0x000300F70F93C },
+    { 0x017664975D9B8, 0x181C9EFAB7E94, 0x28AE4E95C2F91, 0x208714DD3AB6F, 0x778AA2B9475D0, 0x38BD2178AF972, 0x048B9F9238E21, 0x58E5BEE360E94, 0x7B1235426CE10, 0x3BDF777477FCD, 0x633523F14F068, 0x2F3810E0F5267, 0x213DC6244ED59, 0x2988B5E1D49CB, 0x000452FA51F32 } },
+  { { 0x53AEBC9D4BCF5, 0x3434CF8BC1494, 0x555FEB3FEFF78, 0x6346A146E3B91, 0x2DF2AE5A79D4A, 0x6FD45522FDD69, 0x7BC3FCBA63A1A, 0x15BB362DA59AE, 0x13FF885A8FA90, 0x017299A841107, 0x61C16C0382DDB, 0x6F3877C7C483C, 0x7F7C262ED0A6F, 0x2CE48D6008568, 0x0003F75472747 },
+    { 0x40B418A5930CE, 0x6E1DADB2571C4, 0x60A0A966FE114, 0x0C17CC3C8C502, 0x18C3CCAD2CA5B, 0x596FC678EEC61, 0x3B44039C660B6, 0x655F38694B61F, 0x791A5B48F0F1F, 0x5F20B477640F8, 0x4421628D8250A, 0x30CB3E48FB34E, 0x0C9950D00D76A, 0x4D56C5DB4C83A, 0x000189E19C897 },
+    { 0x2521CC671F957, 0x410786AC3D5DB, 0x137A7FE1542E6, 0x3FB20C17E6F95, 0x6D470F022EF4B, 0x0FC4F0BBD9690, 0x66ABAC6D8641D, 0x0BC19AD5DBEBA, 0x4C6D0E8105FD6, 0x13052A149871E, 0x76099FC19AA75, 0x62EEFAC31D101, 0x1FFC198791DE3, 0x3087FDD1143E1, 0x0003FC13F2BFF },
+    { 0x50935EFDCED2A, 0x01D5077A778B9, 0x70E3E3793366F, 0x6FA65B47C855A, 0x537CA8EB582CB, 0x15CA7969D6D52, 0x2149C1C964DBD, 0x7BEC493827909, 0x19619DF36D483, 0x24599814A271B, 0x40BD0D9FC392D, 0x39D9E16617BDA, 0x2B3AF789CEE17, 0x0EE0B28E9601F, 0x0003C4FD459F0 } },
+  { { 0x6778D171F854C, 0x2759F03BC2C13, 0x493A94722FB46, 0x3B14AC6074327, 0x6195DB79F9875, 0x6792C03BB7400, 0x5D0588546D4F5, 0x7062D18A4129C, 0x3805E0096AFAA, 0x067B384B124DA, 0x5D6B5A1B7369E, 0x23D4C7C2E54D6, 0x6E3139C96D299, 0x13DB61F7B4DA3, 0x0004575813078 },
+    { 0x2DC0C7CE4422A, 0x1BA9A238F628B, 0x5329E74FF46A5, 0x0F06418101963, 0x785AFF459657F, 0x5E1F008A85C2F, 0x0FD8B59E44E3D, 0x05FD5BA9610EF, 0x662E4EAB25480, 0x465F66EDC28DF, 0x07563A2EB4F4F, 0x7A36A249B264F, 0x4809B86D9C1EE, 0x6E554714867E9, 0x000240D7E6C4A },
+    { 0x1D79B9259A3B6, 0x09A8D55BED8B7, 0x17B239DD2F314, 0x4F2DC74DAD274, 0x354920E4DD06C, 0x65586D6D3F38B, 0x47EF619FF4C0F, 0x0E95AE2318988, 0x389A91F3FA705, 0x59387311BF3CC, 0x3D3A90AB97731, 0x1874FEB47480E, 0x1148D64806BD9, 0x1D91CE78DE101, 0x00026079F4CCB },
+    { 0x17F6476A37D7A, 0x3C3D126609A61, 0x7869D02119B49, 0x1ABBC4198411B, 0x6DF5CD89BD731, 0x41BB828725820, 0x7EA0CFD0C5548, 0x2C1542119B0C6, 0x2498502E2FD1F, 0x0843B95A208A9, 0x445B9B2116CA3, 0x26EB69B324403, 0x32B8471387DF8, 0x56C3E08CFB194, 0x00036CF8EC616 } },
+  { { 0x64A4C8B6902BD, 0x2FA27FDEF87F4, 0x7EEB562126304, 0x6ACBC9B47B561, 0x62210D552CD6F, 0x3716D24E4679E, 0x1558B2ADB619A, 0x31997C1109FE5, 0x227B94CA319E5, 0x3935DDD2252BA, 0x154EEC4A00017, 0x6022B54E78043, 0x34FD57359148E, 0x265935245EB2F, 0x0000E99311306 },
+    { 0x79A74EA7FC208, 0x6CEE27FF5D443, 0x60AA1BB8D1CD2, 0x29743E77033D9, 0x0CB59E3A6A0BB, 0x61593DB4AE052, 0x47C5D56F7C78D, 0x629402CAC5637, 0x5C3249BFF3FE4, 0x4F8219F19E54D, 0x5727037AB9781, 0x4CE9250A33F46, 0x76B01F5C057B2, 0x67CBEDE76A05D, 0x0001CB2FE8ED1 },
+    { 0x54813104F9323, 0x4587495534DD1, 0x065FF9E719100, 0x79D287C1750FC, 0x0C6FFFD51E319, 0x172380CB8015E, 0x4D988A1BC288E, 0x50056F3956E5F, 0x088228D94CE80, 0x1FF05B5E8B177, 0x5072371AB52E5, 0x7A7C6DC219017, 0x24492C267FB6E, 0x18BBAF2C239A1, 0x0003C47A9BCF8 },
+    { 0x7A7C44527FF36, 0x799705B756C68, 0x1CE1B3CBC2D7A, 0x5F3C8024334F1, 0x4F0C9E16A4116, 0x52F74D94A5AF2, 0x250A434E0B67C, 0x61EBCC4182564, 0x566608D454B69, 0x3BB0B1082C47D, 0x7331035F2B142, 0x1A51AF8CCC6FB, 0x73C2DFBAA307B, 0x7DB7D4D3A82EC, 0x0002B26E52C57 } },
+  { { 0x58598BCE24874, 0x3630FA7DDCE09, 0x4140830963E13, 0x7D810E95F7B0A, 0x445075338DC0E, 0x275580411A351, 0x6E33403E7FAA9, 0x26D7B21BCA5C3, 0x4C5F428CECC08, 0x0233141A93BE5, 0x66821128E343C, 0x13ABBD884A86C, 0x10C064AFC4253, 0x1665C0D2C0069, 0x0005B8B77CD6B },
+    { 0x43C951BDC52CA, 0x6D22BE0BFEB4F, 0x4E664692CFE8A, 0x5FBA878E45816, 0x7419E86004B8E, 0x0A272A54989F6, 0x42BE15A694B4C, 0x6A2E7EF35FAAA, 0x1026622725501, 0x66DC787720212, 0x7771E71F8F06B, 0x1044A4D795AE7, 0x75932F33DC097, 0x583312D0DCFE1, 0x0000BDE346AF0 },
+    { 0x25F58CDA30DC2, 0x3458D9A8C9779, 0x5E7C66515A55F, 0x4849200FF29C9, 0x36E55FA528422, 0x07A5F57C23E5B, 0x36AACE02908DA, 0x0AC7CE616FF1E, 0x1C8AF85E0BB9E, 0x088547E7E673F, 0x4BBD1C7D4DB2B, 0x2583EC58AD32C, 0x5D2CB879987E7, 0x2CD75C8E0079A, 0x00036B804B346 },
+    { 0x44F8F813A7E8A, 0x357012CA567E2, 0x2544CE30ABE9D, 0x5B2A422F4317B, 0x67BA2F881C80B, 0x3229918748D59, 0x5D2D3DA65BBC3, 0x1928F2FED20FA, 0x7B42CE544B6F1, 0x230BB4C01B6B6, 0x7D214F1CC13DC, 0x3A4E54F5CDF52, 0x2F8D79E49A490, 0x27F28940B0058, 0x0004026FDF751 } },
+  { { 0x46C33BB6F593E, 0x04D19ED51D9FE, 0x627B8D19777A8, 0x50605D4BD6009, 0x699C9A596CF3A, 0x50C34FF7D311D, 0x0DEE5F43DFD27, 0x61EB1E3243C3A, 0x4146AADD348C4, 0x48AFC37C243EA, 0x1F184B2290ACA, 0x734349F9D6FC3, 0x184D789050858, 0x3C1CA37B96DD4, 0x0003697B1B856 },
+    { 0x563ADBAFEC1E3, 0x1789A84941559, 0x6CA29B8B590C6, 0x2FEBB662F1C02, 0x0CA4F514217DE, 0x226CEC0E557B2, 0x7D1789DC3563E, 0x5668404156B0F, 0x1ACBC1C10E303, 0x1277590417997, 0x2AEA45FF7460B, 0x0D77812825E67, 0x152FE30AB5986, 0x462590ADFF739, 0x000327664FD34 },
+    { 0x4D7720658B46A, 0x13579C495BC7B, 0x2827AC61F5A7E, 0x762B3D46B4A41, 0x4D877E38DA7BC, 0x5D988205CED56, 0x2B2348502C855, 0x036438A180426, 0x6BC18BE2A3B93, 0x3ED8FBCE73782, 0x06C43A907DFBF, 0x1CBEB022FC6F1, 0x710C7B46DEFE7, 0x5D2B945E298DC, 0x0004EA4A823BD },
+    { 0x3B2F3209948E3, 0x7A36D466D4166, 0x29922A86FEF77, 0x5280B2565CDC7, 0x195294CABF76F, 0x52139F78D4170, 0x285E06B8A1581, 0x73B2693B902F5, 0x4BD9EEC40D274, 0x5BF8C3BC54C9E, 0x3827322C061CE, 0x052733FE341C8, 0x259D11FEE9BE8, 0x5330DACA2C544, 0x000362E912EFB } },
+  { { 0x4577E67402715, 0x7FB890CB0983E, 0x0B20A1219DA0A, 0x3ED9D6F5C4412, 0x2154013EB9869, 0x79714D26D9C98, 0x382EB4DD72BC1, 0x31A43CD180FE0, 0x4AD1759AE8BD7, 0x25EBFC6A08858, 0x7AAA0604C3178, 0x40BF5A5FE273A, 0x365F0905F81D8, 0x3844777FA1572, 0x00049BC0984BA },
+    { 0x6FE58507A4F2D, 0x3FE2D2666F716, 0x10E1557909526, 0x25959CE382FEE, 0x4295D4D6805F5, 0x26B52858505C6, 0x7DF1FEEE41736, 0x7D84990A928BC, 0x29A800105C3D1, 0x027A585527C20, 0x4127EF9F2906B, 0x08FB3F7B7ECDC, 0x7DAD5D0AA6040, 0x5A67ACDF09B1A, 0x0001B8CFDFA1D },
+    { 0x4DD3643DFB683, 0x7F89B481A9085, 0x6DEDD0850F2B8, 0x4381ABFEA634C, 0x1C8A109ECD28D, 0x1419B34D5D364, 0x3B99BA6ACC4D6, 0x2C21A6F2C8EAB, 0x2BDBD9A4FDE81, 0x73008318B8E3E, 0x56A0599771C0A, 0x049EE3B49C29D, 0x647DBBA61E864, 0x0F046F8AF6126, 0x0001D460CB952 },
+    { 0x71ABA78418675, 0x31319AC1D979D, 0x44076E70778A4, 0x0863981674FE2, 0x650A5B1592D12, 0x1FAA6FD94BA88, 0x52A0B9B39DFD5, 0x4457D6A1D6224, 0x52CA93C1466C9, 0x0B8782E133325, 0x479DED48B98E6, 0x0F76BC026E4C7, 0x557F3D1922115, 0x63D8323ACE6EA, 0x0004F1BFE1692 } },
+  { { 0x7157C22EA7A99, 0x5301F42733067, 0x3DDDA1147C54B, 0x662391DB36F49, 0x4BE6AF1D94CBF, 0x278C770758DAC, 0x0ADD5316BA4F7, 0x44C86A0FB39DD, 0x46C6DF69103AB, 0x6324DC1882F45, 0x2A63073E7DFFC, 0x2232109DF06E8, 0x284F1198B42C1, 0x334865C7DAF4F, 0x0003038138A40 },
+    { 0x1D76FDBC9E5F2, 0x3219EE1FA3DEF, 0x6CF4676B709FA, 0x07D0ED0F9F8D9, 0x11E79B56C0ABD, 0x512406D2EEA5B, 0x3EB372A6844C6, 0x5C11356F22209, 0x613393CAC894E, 0x11F8227A84280, 0x3165EDB2773E4, 0x20B38DF20D9B2, 0x35CBD621A3B45, 0x43A81E8FD0EAF, 0x000181D8DF247 },
+    { 0x3862780CAA8E7, 0x01D11E623E1FF, 0x07739999E1949, 0x19845C6E65518, 0x77F4E994FB775, 0x314788FBDF392, 0x5E910713E1121, 0x3A22449993A37, 0x4B942F35207FE, 0x3FADA325ED6BA, 0x42BA4A2F37962, 0x53B6EBE0813FB, 0x229EEAF44B38F, 0x6689C25B09026, 0x0003315F463EA },
+    { 0x15895A1EECAC8, 0x743709449D452, 0x39D9F78EA7210, 0x366AC2FA7839B, 0x13B8D1C449CDD, 0x53F6D7FFA49C1, 0x584C4E057E4AE, 0x0934F3AF3A2EF, 0x336A4EAC2F437, 0x5A268BC0E839F, 0x3274B98FC2258, 0x4E4A5432634CF, 0x3E8606683AABD, 0x513ECA9287425, 0x0003CCC94B54F } },
+  { { 0x0445E253723DA, 0x2A4C089C148C9, 0x3189519A13FB7, 0x16E6EBDB2BA52, 0x674238B20CE69, 0x0394D81641C94, 0x7AD716C1D30F5, 0x3F7CCCA5D4B31, 0x1162775053C77, 0x64B07CDA53257, 0x4312DF1E37846, 0x01ABE6713676F, 0x1DD966BAACCFE, 0x44C5FCCE31D48, 0x00058A94ADF13 },
+    { 0x512FC89D67187, 0x792DEDF11D4F4, 0x173CC5109D606, 0x17B2D7EAC6748, 0x65B08EE0A2744, 0x0ABC71FAA5CFC, 0x3AA91A8A5A349, 0x7930BF4E9EBB4, 0x6A5BB8D4A0EB1, 0x612CD108994DB, 0x4AE44E2D09454, 0x148164856DF21, 0x59CA883762553, 0x2B8C6E48689DB, 0x0000D73A5755C },
+    { 0x19218B6B92556, 0x1F3337514A73F, 0x7F82677E017AD, 0x1E8A9168AEDF9, 0x0F7ACCB3F572C, 0x54E5E925E1BB5, 0x0159ECABA715E, 0x68811C54B1F61, 0x4CE5A54720B1C, 0x3E2C4B31EDAF8, 0x39F5E88637DD9, 0x6082A5CF401AD, 0x125504869C497, 0x2943648A8A7EA, 0x000385F1983CE },
+    { 0x21A819552D0F9, 0x1404E58DB7454, 0x4394BB3D6E239, 0x663BFA444E2BC, 0x6BDF50349833C, 0x3DBDC56571F04, 0x7A8862044CAFF, 0x3C9B39F263EC0, 0x2D17AB92A0057, 0x0792E72B4659B, 0x39FB89504DDBD, 0x2477906927925, 0x7583765C900E8, 0x5E4CFDACC54B1, 0x00044F3E7D177 } },
+  { { 0x41B33D3647B6C, 0x113DE69A30668, 0x509EE3209BCC4, 0x1B6B78FE7436A, 0x0B016F3AE7204, 0x759316D26A437, 0x161E6C394C758, 0x6C7B8213B25E1, 0x00EFCFC3894C8, 0x0999D0A91DD2E, 0x370AD211A92C6, 0x5E43848DEC642, 0x0F9CD63D113BF, 0x74B831FFB506D, 0x00025721F0AE8 },
+    { 0x45308666B2A38, 0x65E9FC613B1D9, 0x6B72E13A9E1EE, 0x3409891CFA991, 0x4C7631D43ADD3, 0x2E4CAC5077AE8, 0x5E9F84E1CB044, 0x181F82D32EDE4, 0x5B3CE56467155, 0x1A99E9EE36904, 0x28352D5D4EF67, 0x154573847A7FE, 0x0EC93BF024664, 0x3518DFA8AA494, 0x0001298D38008 },
+    { 0x277E202D80F44, 0x485267A8AEE98, 0x725E8D325C41D, 0x24CFE221F26D4, 0x453A411FE24A6, 0x6FF65D770E7FA, 0x10E989B89D9A0, 0x3445DC26567E9, 0x0E4BE687F9BCB, 0x17877DBCAA498, 0x766E7D41668CF, 0x52B3087D2135D, 0x313B481C0833F, 0x6CBF8DCF84817, 0x00019A0120972 },
+    { 0x5625EB0121844, 0x0C127BE65AF8F, 0x6600FBD0CD946, 0x15BA9C3DC976A, 0x756BB287C837A, 0x776345D79E39E, 0x1F20C11C859A9, 0x5743A83DC5D3B, 0x2BD9DDEF54394, 0x0D30D490AC6B9, 0x7D253F79ECB79, 0x47F97E31460D8, 0x0695270DBCE5B, 0x3EFECC6CD4EB4, 0x0002698C13CDB } },
+  { { 0x1587E72D02E06, 0x4CBFF40704C13, 0x3CB8C318FD62D, 0x2ECCFF82B5410, 0x30C83AFC5DC5F, 0x4C046F1A5C84C, 0x3866EB27E165A, 0x14BC64EF42B0E, 0x476F12FEC0E21, 0x27BAFF042D7A3, 0x066E30B411C99, 0x6692F834E60FA, 0x16A6E075B3A43, 0x57EC2502E032A, 0x000623A753D1B },
+    { 0x3632E8D64EF09, 0x67B5BE62A1D8E, 0x7F15456916217, 0x12E200070AE2F, 0x24D2D14839465, 0x11D936650118E, 0x17ACD80C94A3A, 0x7FD5911F105CD, 0x303554C58B079, 0x531787A45292B, 0x4D2BF08F17B60, 0x6BB7D31634449, 0x4E8DE1D97D1A9, 0x74AB24EA43D99, 0x0002AB49E7582 },
+    { 0x69D0AB41453D0, 0x4A1B1D1FC943A, 0x0358786514729, 0x3A6CACE6CC5A1, 0x00AC6ACCFA372, 0x03FFD85052CA4, 0x64FF23636C814, 0x109FA8B6BC367, 0x17137F795852D, 0x48F6AF702B0C2, 0x3C71EB10A0E80, 0x4BAA2BC950A58, 0x06DD874002382, 0x20250B80DF86B, 0x00044271391D2 },
+    { 0x3893D6958FD4F, 0x7C59ED42112DE, 0x1B36C6529D0E8, 0x09F4C0D1A67EB, 0x53DBD8122AA10, 0x62AD40C369A34, 0x50CF22DB8CC00, 0x43A7BA97E5FC4, 0x50166ADFC830A, 0x59E99FEF154BA, 0x369F20A80725B, 0x16AB23D515D1D, 0x14EE915D9DF13, 0x1658C6085300A, 0x00035ABC21D77 } },
+  { { 0x54EE3B0C58F67, 0x53206F2539EFB, 0x0210E3233283A, 0x1BAB1A7A89A22, 0x33588F856BC88, 0x5A20591F7F728, 0x754D05EF0C469, 0x2CA47FD5F2691, 0x54A66D2D197A7, 0x02EE3393E7F24, 0x08E04B2AB57BB, 0x0EFAC38EF75B4, 0x78E02F9CD348E, 0x30C40CA491901, 0x000556E666EF5 },
+    { 0x0841B0E0B6C6B, 0x05EEDAC4BF066, 0x70975BE5EBBB5, 0x07C542E7B363F, 0x55147D32E8056, 0x0F68B23B7D448, 0x5BE83755DE4E8, 0x75B3A16ED94EB, 0x07421FF5CFE4A, 0x3DD5F327618E4, 0x7C0DF1A9D03A6, 0x5DD329133F55C, 0x0F43C0D16830D, 0x75A4B12F34ED8, 0x0001E53726137 },
+    { 0x3686EE07EDC19, 0x383C980047169, 0x5FFA683A45BFD, 0x55735C978197D, 0x3C9D20EBC2F54, 0x3EDA388AC146A, 0x356E2C991EC05, 0x17005BCF8266B, 0x0DEFEADAC3AB7, 0x3B5A462B9A7B0, 0x3A1EE7AD2585C, 0x630039CC0B78B, 0x23522E43FD0A3, 0x2EE4168254D37, 0x0002910175668 },
+    { 0x09F0F2A33455F, 0x7658DF7EFE157, 0x7FAF5FBC23E01, 0x17F0B207D5E48, 0x70AA688FDF92F, 0x35DB3B4F87387, 0x4F5BC2AAFD489, 0x1056C7694520C, 0x5E779306BD555, 0x097C56DB716DB, 0x77470BB40B55F, 0x56EAFB3058519, 0x0E057906CCCCD, 0x291363EEE58E2, 0x0004B63611C6C } },
+  { { 0x5FDE034113666, 0x419D419B36DAC, 0x5BFA612C1E23D, 0x05B3199A0494D, 0x4347B78B8FD89, 0x2FBE3126AE3A5, 0x7DD5E6FF3B0B7, 0x4ADCE20E06D92, 0x41458567AACF3, 0x2E88E1EAAC9E3, 0x649D01BDD281E, 0x6F6FECE891B05, 0x7AC90C885AFE0, 0x5F8499B5C5674, 0x00037EFEA6A06 },
+    { 0x097A708DE2AC1, 0x2A386AF6383F8, 0x203542BBB4F3A, 0x2B9A81082A0CA, 0x5E591CBE68370, 0x2645ADF646C61, 0x3E79D955E2280, 0x4FCF8D6328CD1, 0x03F87B5FC922E, 0x46143CFE386A5, 0x56FC698EF6860, 0x5E3651C325F27, 0x67802319500A1, 0x5ED0F7BDB7258, 0x0001D92C53DA2 },
+    { 0x4A8480B671C1C, 0x2336A71E86086, 0x0DFAC253F2337, 0x62119135F6CF3, 0x0DE6B4BB62A70, 0x3106104E31F5A, 0x5BB383CE1897A, 0x7C47321B9A406, 0x21FDBD3EBEC7B, 0x68C1E00CF18E4, 0x39FC6FA67F402, 0x3C32D6DEC74B1, 0x50BE1D1485B4B, 0x1D05BB4E0FD96, 0x00001D0D6FFED },
+    { 0x7BE21E27DF155, 0x02A54D00358FE, 0x24DC96C4B0E73, 0x2534F40D6932E, 0x38DAEEC7FBDD6, 0x774496FD7BE24, 0x2B1F23721D0E2, 0x7E78978940F9C, 0x0AB2F06819AD0, 0x291316B625589, 0x37707C5785538, 0x6F226C2973C32, 0x77D52BF9A46FD, 0x338107BB6E7D4, 0x000268741A941 } },
+  { { 0x734CE57029E53, 0x78B6B927A7C9B, 0x4E57548CDCDEB, 0x000F36EF2D565, 0x2A922C22F1D94, 0x6CD908E638CF5, 0x36460C39F1C5C, 0x0EA1775FA3722, 0x20421322AEE8A, 0x0DE2524AB0C92, 0x45877A54440DF, 0x0D3ECF5DFADDC, 0x3A66C2F4CD19B, 0x35FFC7AA7C83C, 0x00030D016D33B },
+    { 0x494222B499F96, 0x32A96550D7EF6, 0x615FB6FAA6E33, 0x1AE6AA2B6DAAA, 0x68FA4E2C7C872, 0x0ED430F355AA7, 0x1673D3D966729, 0x44AB787B0254A, 0x230D4AF60DDCE, 0x7C3080A32E3ED, 0x7C779C89EDAC4, 0x46E8DA344FA5C, 0x1C7EC99955CAF, 0x7EE4539647F1C, 0x00022C48C0CF0 },
+    { 0x4C274A2C9F8AB, 0x59E2A0D80E12F, 0x7BF1FD8658F5D, 0x4235662B037C7, 0x48A55990DD018, 0x50B8BFE0B0BB3, 0x0DF93F84526EA, 0x01B076F4CC967, 0x0888F8D135F6E, 0x76E5CF55CECB2, 0x1A95833D682AE, 0x34B2A8A7CAD02, 0x3072EEECA24FB, 0x00D0C1E1C7D10, 0x0004B5BFB4118 },
+    { 0x3BE87BF91A56E, 0x0F1A7A0EFF004, 0x75AA62C4A256D, 0x177EA5CD8724D, 0x089FF0D326A2D, 0x1BDBF1CCA7BE9, 0x1D9E9F4FABB6D, 0x5AB038AB33707, 0x6EA243AABF811, 0x2E234898EF68B, 0x6691EE856CC24, 0x5EFBCA83D8E00, 0x37666F0676A22, 0x1E1F632725597, 0x0002578B7DF0E } },
+  { { 0x419B16969B6D2, 0x01986054FF964, 0x72E3EFE3CF143, 0x58C6AAE1A48FC, 0x58CCAAF4937ED, 0x3033AA04DDC1F, 0x7589DF88C0EC9, 0x76568537EFAA8, 0x6F95C513D95DA, 0x55654C9D9272E, 0x658D18764B78A, 0x0D16089200694, 0x264C6A4A081A2, 0x20CC4D86691EC, 0x0003863662547 },
+    { 0x0E282A955DCEE, 0x7C8DF2E578CBC, 0x35B6F68B1060F, 0x0E259B38B877E, 0x7FE736F9110C2, 0x5FD1A055A3161, 0x0658C9F86C13A, 0x3E5C3AFF73979, 0x3A7B2D5BB86A9, 0x0E63B97BA7EA5, 0x2922FBFA656B2, 0x21B3D261AC488, 0x101DD19495426, 0x7BE1AF5A23E96, 0x0001D03856918 },
+    { 0x3B8FB9FF7DEEE, 0x5AC60F35C18E6, 0x0200F536CCE51, 0x13D9F1E6E0693, 0x2A565BE011FA3, 0x7BAE90C51FF71, 0x28F97899F76C6, 0x3F524D3967394, 0x5C2F04B18A46B, 0x5796A0C341AFA, 0x1A5DB57773C7A, 0x268895F1AB5CA, 0x01D3BDB4E7E35, 0x2D0360452AFD2, 0x00063C7B74001 },
+    { 0x6EBCB90C62414, 0x2E8D50AFE2DAD, 0x3A000739ABC49, 0x73BAE74C1E176, 0x7999D342E4D81, 0x032331771D32B, 0x199F673ED59BA, 0x0136B04DFCFEC, 0x328A18FD69E1E, 0x1059544818A7F, 0x651D47D725661, 0x5280E3D4E54E9, 0x5591E79AF5F42, 0x0F868BF5F2A41, 0x0002A96958B7B } },
+  { { 0x37A691D848B4D, 0x303C3E27D15CB, 0x2F833D36C9DEC, 0x694F029CBFF60, 0x240D633CC7192, 0x5ABCD39A17575, 0x5E4CE23905F05, 0x1AFFD7F263276, 0x69DE53C5BF7A6, 0x18D4CE9B5F425, 0x4CC207F234809, 0x7248AF5FBC363, 0x038BC5A278661, 0x19DAB404444DF, 0x000579705449D },
+    { 0x64E602FD7F857, 0x0A2C63D6F4627, 0x37711CB7E677E, 0x4764912AB15A8, 0x62E680ADDDDB9, 0x4D5EE9701EC14, 0x07BE0E5C3B9B1, 0x2ECE2C12B0D9F, 0x2E535D42B107C, 0x2CB1A1BDDBDCA, 0x2B10B9ACBA29C, 0x6CEE837055990, 0x1D23803F044A5, 0x2CECB05F48A64, 0x0001C32FCEC95 },
+    { 0x5266B4438E035, 0x025C486D41741, 0x201CD6F2AF6F6, 0x39BE52A007097, 0x1D0DFAF09A859, 0x249A3F98F16CD, 0x043ED5C92A0FA, 0x6879E0380CF2D, 0x69D445B25E277, 0x021CCDA7E964D, 0x624B5B41E651E, 0x516047BC002BF, 0x383DDB9D1ED4E, 0x30BC74E1AD929, 0x00043B20EB8FF },
+    { 0x308824AFE2411, 0x1F4C4AA27C8EC, 0x42B75F3491BDC, 0x7EA2BAC143A0F, 0x3B550A1092F16, 0x4813B1C900E4D, 0x3519C16C0270C, 0x43B7B3CA08A26, 0x6BEE56045E153, 0x1FBFE1014A01B, 0x627174D653658, 0x4D61A5A672AE5, 0x6F5E9D1B631E1, 0x6A2471CE0857E, 0x0004F840A1CC7 } },
+  { { 0x47419241F514A, 0x49F7297368EF4, 0x60E0223D114FF, 0x4E020B63D24BF, 0x3FEAD56030EE8, 0x0B6C1E9166F59, 0x3E566DABF6ED7, 0x79389C3D1C7F1, 0x68935EF714A7C, 0x3BC86E15A1E6C, 0x00B566B2B5683, 0x1A7F2CD782C5B, 0x0594EBBB6F762, 0x792BD215F8C1C, 0x000451F72302C },
+    { 0x414E342CB0544, 0x2FD6ADE2DE92E, 0x6FC7CD13CBFB6, 0x70678C4DCF260, 0x1613B7839DC6D, 0x5F41D723BC2AD, 0x60E0F524793E5, 0x62DB9C955850D, 0x46BEB3AB88871, 0x2660633A66C79, 0x46620D8DCEFA6, 0x670B38900E2F7, 0x0016807647ABB, 0x5C83545F2EADC, 0x0001E2BD9045B },
+    { 0x44387871C5D54, 0x67D21EA4B28E0, 0x5F2A595FAD65E, 0x25221ECDAB05E, 0x079B067C91696, 0x386E19DA6FA50, 0x04ECDD1B39CA4, 0x7AE86BA7E3666, 0x2075460D67321, 0x08C786E15D171, 0x2E552D57C1505, 0x6D1ED815F981A, 0x3C4AE05E65AF5, 0x45B2EC7C166AD, 0x0001168ED7DE9 },
+    { 0x7F7E4162DE864, 0x6F48EB7C74749, 0x151E0B71F6DAF, 0x789A281C9DA17, 0x4E6D93097A26D, 0x66BB5499BA8D0, 0x6761869EC053F, 0x7468AB419A336, 0x5262174F1CB83, 0x3B83FC6F02A1E, 0x130111E5D1D2C, 0x48AD508B1A427, 0x33D79CAA32C64, 0x3A1196C556C0F, 0x000416C3A5D23 } },
+  { { 0x55E356CB3BDF9, 0x542B68BDB7812, 0x02D246CA981D4, 0x0F80BA94AF870, 0x1C2DB1983BFB0, 0x7F1D735ECE19B, 0x7C00D0B5792CB, 0x72F00A522BF7C, 0x3DDEC9C42753E, 0x370D3C62BA80D, 0x685D9C08BC1D1, 0x08DA1A43F2B4A, 0x3D58009C20711, 0x420381E96BF65, 0x00028614AFC30 },
+    { 0x5C3D9B012EFA5, 0x06D70005B5EB7, 0x65A6EEAFC4370, 0x7FD4949B81D3B, 0x46BD304A6B36D, 0x51AB9FC13517D, 0x247B5EE394E1E, 0x649C091E2C868, 0x65C66E731FAB4, 0x0BB529CBA7B08, 0x1A4005470E8FD, 0x5333524A229C5, 0x76E1430E7C628, 0x671F79D15C1B6, 0x0000E9E25792F },
+    { 0x23F29E2678767, 0x5301B46579775, 0x1E1A1F1127607, 0x3EA9FCCF1A456, 0x0355991009CE2, 0x37BA27E9AE120, 0x676DC62C1DF64, 0x6AF8921118481, 0x49E7E91AEEE6D, 0x4070490DAA8A6, 0x7E062ABD9AE1C, 0x460D350B6516D, 0x1F173C34F26BD, 0x5B69FBB7DCDE1, 0x0002FDA43169D },
+    { 0x1FDE271DD8807, 0x42A3148CF5DFE, 0x754A96F4D1319, 0x44339C68DF385, 0x1E8FFC5E5F602, 0x7DACF24BB9234, 0x440F3FF39A1A9, 0x78F73D2824192, 0x7F5FB24278B36, 0x542098BC8239B, 0x03E4884302637, 0x0405BACBF5CB5, 0x077D5EA4B6C0E, 0x6900401F15A57, 0x00036A299215D } },
+  { { 0x23A3D4655B6A4, 0x6783C90796CB7, 0x1C5A4E199BA50, 0x2F2FC46EB74D0, 0x53E05E34639CB, 0x2B151243676D6, 0x183CF8A2282AD, 0x25351FB683717, 0x5AE30CE456D8B, 0x4B0ACE8342825, 0x43E4B349D42EB, 0x56502F1C047A7, 0x2A68C2D6510F8, 0x43E7D12D55EE2, 0x000451D0BD318 },
+    { 0x3B702CC58964B, 0x5FD2088FB3B74, 0x6A2831D3362BD, 0x5AF715900EB80, 0x5DD8085C0E9AA, 0x072F1264FA167, 0x702D3249AE9F6, 0x7214D24F7B815, 0x044390EBEC551, 0x71C1EE7F9E6D8, 0x2911C34BF642A, 0x3EA5C1782C0B4, 0x30CB40F7C6637, 0x56A72439077C8, 0x0001661828C77 },
+    { 0x5DB59B68114DA, 0x12C5151F70F07, 0x70CB9A89C3742, 0x674DF4C9E307D, 0x5A4A16F4F7A81, 0x1129CD8E3D3C0, 0x414C9B1F7DEB5, 0x76C451378C043, 0x56FE1E0BCBA55, 0x32AB0B9B8A655, 0x3DB63AFFEA388, 0x2AEC2678BB287, 0x39A127DAC560D, 0x374DE56B504F1, 0x00031CD4DDE7D },
+    { 0x40B151B986105, 0x62FE25873DB51, 0x085EC83ECDADB, 0x306FBD11218D5, 0x4D3510B5A43E7, 0x5CC7996859A0C, 0x132359037F95C, 0x2D1D5279021CE, 0x1CAF986524CF2, 0x36CF0A6B797FE, 0x0C554C3AF0091, 0x63F0C6B018581, 0x4414900C4E6CB, 0x7A8839FFD60CE, 0x00029BA65C493 } },
+  { { 0x73615821FDE0F, 0x51CBD232063D5, 0x5EAC1B9E935D1, 0x19F599636E827, 0x0EE475EA3BCC5, 0x0482F9261261E, 0x447EF740E1BE0, 0x2CB4D0ED483AC, 0x366773314BD5D, 0x2707FF45510E4, 0x3FBA6600549A2, 0x20D7A07940CA7, 0x65837FD949E1B, 0x0C0562D4D95AA, 0x0000B15A2A0B1 },
+    { 0x341BA7A17B926, 0x22E39EDDC5347, 0x413F93EF518D7, 0x4C706AE1F747B, 0x371A86BF858B6, 0x6AEC6A63F42F4, 0x3666AC9986042, 0x025E772BD546C, 0x6B9D8A2737D45, 0x0AF3186CFD476, 0x2802FF25F4E79, 0x295D1C55A532F, 0x46CE578F7187B, 0x09E29B6BE1592, 0x000209964C94E },
+    { 0x146FDB6DBB191, 0x7CC7D7BA0EEA1, 0x0F0F2331BC919, 0x294028EA2B019, 0x66220A87B510E, 0x765A8C044F832, 0x698A7577FE240, 0x439449431F09F, 0x4AB972CBDEED8, 0x2E9CBEC52CEDF, 0x42B3E67A30610, 0x5F39143450B49, 0x125C0199D329A, 0x3550CB3C52FFC, 0x0003B7EEDC3F8 },
+    { 0x1EA9CAAFFBBB2, 0x5D59EB1B0BEE0, 0x65C0BAEE220FC, 0x49837D26EB9C4, 0x07AEE4292B943, 0x63FC28036EB4A, 0x2B93FB0CBCAAF, 0x5A188DA51EEDF, 0x50BCAA66A747D, 0x1075BF3080690, 0x279086E32F772, 0x73FAE1E8A76CD, 0x36614C6554FA3, 0x55107034416E2, 0x000425357DFD8 } },
+  { { 0x6F49D8A6CCE4F, 0x09E5816094EE4, 0x6A4FEE6E54084, 0x09F9DF42A20A5, 0x4185ADDFF0806, 0x2863F563A5F08, 0x45E0DF4D5C130, 0x26FFD36216262, 0x73D16EB68D063, 0x246A82625C080, 0x06E22AE5454B1, 0x1082FB10F860C, 0x693FF15075673, 0x1D6F3EDEF6CD5, 0x0001CDD8187BB },
+    { 0x21D0EEBEC7679, 0x345806AFF20AB, 0x3E1D0B4972DA1, 0x2983A55B0C0E6, 0x1EA9329798983, 0x7C6373A58692F, 0x652196E0A9E27, 0x322D7721A9B98, 0x2999456F1167F, 0x6B9A29E75B1FE, 0x52916BCDABDD0, 0x2FFD0B0CA7A62, 0x11CF8692ED823, 0x059B325D4087A, 0x00010F009D05A },
+    { 0x1FCFC7932B9E3, 0x75896A854CE03, 0x6CCB17470FEDB, 0x632269272BC42, 0x63B6155BCD263, 0x2AA762C731609, 0x7128AD3D00FAD, 0x55716EAD411BC, 0x25F47B7A10633, 0x279DB8F3014A1, 0x54B3FAB41BDDE, 0x615F890253F16, 0x0EA33087ABC06, 0x56EF3F8D24546, 0x00044261340C9 },
+    { 0x52F1B85312323, 0x4E262BC45708B, 0x02C5EAE804FFE, 0x7408FAC7D48F2, 0x0FFBA6402A5E7, 0x45CB540E8F312, 0x49337B3C76F88, 0x5B8BF95E5E25F, 0x6A49BC55A8715, 0x673D32FF52482, 0x0CB8D1AC3043D, 0x209975334F919, 0x1794D52C40112, 0x566DC7078C035, 0x0004435C928D6 } },
+  { { 0x26D70739B8239, 0x4FFBB3B70A196, 0x6F3264D65C513, 0x1C9873DA72064, 0x1F1F0A3852207, 0x22F22732BA6B3, 0x09CC61A283B9B, 0x14F12FD5AB3A9, 0x210C0E8D770C4, 0x24BB40356E8BD, 0x1FED2B53327D8, 0x4279B5663B05F, 0x2695073E0E175, 0x06408AC459D21, 0x00035189E0674 },
+    { 0x47F0AD291D23D, 0x03B73D525F5F8, 0x4ACBFC2F237D4, 0x1A048428FAAF8, 0x3C172FE3E7D84, 0x03E52ADF4212D, 0x32B418E181F9C, 0x7D21A2122C546, 0x79E4BCF6F2E7B, 0x1AC9D6033348A, 0x76D773B3A97EB, 0x68063620A023C, 0x18B21D830D018, 0x2338C0F4C0B71, 0x0000931431337 },
+    { 0x30499FB541A7D, 0x7184E1A544380, 0x2AF47FBCFAD8C, 0x4B66C45E0D0D2, 0x793C825E2B4A2, 0x50A6D0DD2BF49, 0x63FB6D7CDABEF, 0x7778B3F2FC27A, 0x7E13B136E3F9B, 0x5894474579D82, 0x2652D97172E42, 0x6B8B3304DB1C2, 0x7A96B3A5A8061, 0x439CBD9E73F4B, 0x00064499C6D09 },
+    { 0x03C7B18CD9121, 0x07ABF4EE02FB3, 0x0F0C1EBD760C2, 0x15A9C673844CE, 0x29146C52C5C30, 0x05B9A9D2CE284, 0x252B6527528B5, 0x2660E40225A9D, 0x3313B81955772, 0x62CEC44715E72, 0x10DAAD2EC7F41, 0x761CC0158FA7F, 0x13C302C85DFCF, 0x3C555D3FF965C, 0x00035528D82AD } },
+  { { 0x326E8AFA67E70, 0x1F5534EBE2769, 0x3864C38ECE1C0, 0x533B5C05CB5B2, 0x53A44BE641AD9, 0x3F006659DC55E, 0x5AF0AF58B634E, 0x38DC485BFBAD3, 0x28894DBE879E7, 0x2D09BC86B5A23, 0x1BA096AB8BD72, 0x23FD090A07E97, 0x637795F28E285, 0x299384FC0BCF5, 0x00019326A2D83 },
+    { 0x3069E16D290BF, 0x702DEBA714263, 0x3C3CF529329E8, 0x23CC2C0E331E8, 0x12C3328E48013, 0x37D1710BD8CA8, 0x3850ADCDF873F, 0x5F6D41CA79166, 0x3B1376F5785E9, 0x60CAD88503954, 0x6D6052FECAD61, 0x2DF9885A20801, 0x491C0E5066EF8, 0x674DE3D8933A6, 0x0002E6FC55B1B },
+    { 0x1C0BE443A3BEE, 0x58A6E443D8802, 0x26DF470CA9C5E, 0x0B5984F826B1D, 0x6153228DB5606, 0x712FF0483BCB9, 0x4EABDCB0BB540, 0x1FD17642AD400, 0x634F7D76BE614, 0x6857AE29C5529, 0x50895DCD95D0D, 0x78B3FA83D5A62, 0x60704F0D8AFAA, 0x69B02752A5D88, 0x00037FE5A7F8B },
+    { 0x194BDA6CD4FD5, 0x1BEDF2F26AA42, 0x621F545CC814B, 0x16FE4A97354D9, 0x630082E6BEA78, 0x26826A7409BB1, 0x3C53B9B727A33, 0x56E7A09566E3F, 0x25355C14F9F82, 0x21B0035CE1A0C, 0x7D266A83E9D8A, 0x1B442BB58A01A, 0x0FDE733CB5DEF, 0x04FE7CA8453BA, 0x0002F385CCDF8 } },
+  { { 0x1C3FAD1E3A783, 0x17D4B29E5F60C, 0x64AD1B2135C55, 0x53A5960CFB031, 0x049DA592506B5, 0x54C0E46889E41, 0x78E6E186A773D, 0x45FAC88BAFFB9, 0x1B87FE75E778E, 0x34214E6738767, 0x2F330E4B49B31, 0x79864E0A19C62, 0x264C02B1E37A9, 0x36AAB73E4989E, 0x00039F24E92BC },
+    { 0x7FD7E1E09962F, 0x4DA8FB711DE1A, 0x4F64E53034C38, 0x5AC2C47DC0AE8, 0x52651117C3E01, 0x67B4CC7A9D087, 0x5D124E2C41307, 0x4393E94C6E469, 0x4CC71817EA5A9, 0x4BDE62F58D588, 0x5A9022CF21BCF, 0x3AC664543507C, 0x37DC1A434377A, 0x1A02205033418, 0x00028A83BBFF6 },
+    { 0x6ED9119C0DE0F, 0x6659C1AEA090D, 0x461AC644CD4AC, 0x585A40B1C044A, 0x70747198AB008, 0x4377CCE59FE1F, 0x70DC51905C3C2, 0x0B213C85C593F, 0x7781D2CADA131, 0x15955879C3D83, 0x19351DBD83329, 0x615AC1127D084, 0x1FD2B5C71288C, 0x47F774CA274EA, 0x0004858B55503 },
+    { 0x312AAA82F0E7F, 0x2777D56068C70, 0x2E9B032696A32, 0x5F8232269E9B6, 0x11BAF21D96BC7, 0x101FFCF11FCF3, 0x122287213D66E, 0x20776ED0F6A89, 0x789E8EBF31BA2, 0x668A0CED9ECA9, 0x672EB505B9B03, 0x514221EA8FCFB, 0x3C77F04B00E3D, 0x47ADA501A0060, 0x00035FA09B24D } },
+  { { 0x01A4A2AC6C86C, 0x02D3D419E416F, 0x2AA0E8FACB660, 0x6F5E258B48024, 0x135B3EA55E6A7, 0x4A249DD369310, 0x3A75B3584425B, 0x56ACE30A94325, 0x5B829FCE8C43B, 0x3B40B9D2FB212, 0x2C262106B4679, 0x0CC44F34EC52F, 0x3569B9FE0BFA6, 0x67FCC45FA7702, 0x0004402F99C74 },
+    { 0x187E95C07B18A, 0x6E4C24A886530, 0x0692157CF7C77, 0x384B70059F77F, 0x2C6B9E1FBB113, 0x4C97A7B7F61C0, 0x20436C52A7431, 0x3C389D1C0CACC, 0x7F8D0D2035FB6, 0x1F592167C0D0E, 0x3D538D8E112BA, 0x426A292507FE9, 0x6A8A1F535F77C, 0x69BE6944B666A, 0x000177BF46FEA },
+    { 0x207A4C2F33B90, 0x11563E7D96184, 0x00E37C6800EBF, 0x18653711D85B3, 0x6CFB59B974D37, 0x39F4ECBA4C738, 0x41CC4DD706E69, 0x101662D5E0663, 0x5DC646B3F9868, 0x393B00E463ED6, 0x28F68C1AFF2B4, 0x599B5EECA3E50, 0x7D20B5FCD2ADA, 0x686F1E0A1E51E, 0x0001A5E9DA178 },
+    { 0x16E1A3DD330B0, 0x56E01C357EDEB, 0x2075E11D6E665, 0x25AF511024F7B, 0x018B7823952C8, 0x553CBF26EAA8C, 0x323FE3B0DDBD2, 0x6E3406DF06A85, 0x1A90890E1A4C6, 0x1C6A79B3B2F65, 0x34910C3C3BF16, 0x01A7E23C64503, 0x6F9CAA2B29A66, 0x714E8149C5E82, 0x00024AC0B4C70 } },
+  { { 0x26C9EB55B3EA4, 0x4B02E4010FFD8, 0x1DC3C967C0E58, 0x38B452C01AB31, 0x7EBAA91C2ADC3, 0x0534842F08EA3, 0x590F8E8F87AB2, 0x4EDAC10240A9A, 0x2F9C231EDADD2, 0x6F48DA75F7E25, 0x222E88E2AE254, 0x72D9881DE81E4, 0x209269F022219, 0x16F1764651AB6, 0x0003964DB59B3 },
+    { 0x25BAC05730ED1, 0x5CDA73070DEDE, 0x45C75677381AC, 0x2FC5F8DE3805F, 0x6C8765F5464BF, 0x7D793241625D8, 0x7314A54D7AE2B, 0x59485AAA3CC21, 0x1972D22ED3B30, 0x74A490781CD3C, 0x5E0C8D212196C, 0x124AAC2D4AB2B, 0x3820D1EB095AC, 0x769DD2C8FE9F2, 0x000243A1AB4EF },
+    { 0x4274E62B670D0, 0x082B1B18DA80F, 0x254E7138DA2E2, 0x2922D86F5AB88, 0x2C5929DBBACC6, 0x07910AEEC1704, 0x7F05C5EB8E350, 0x0CEE8882C7FED, 0x0603D55755306, 0x7E9E3C36CDFE8, 0x2E65ED0B71023, 0x2C564DD0BE5C1, 0x109B665B6545B, 0x2798B0D5FD56B, 0x0001233721CEA },
+    { 0x586A1BF4BD05F, 0x09D854EE8659D, 0x1DE3612F33D0D, 0x57F1848F8D670, 0x7C38F761D3D58, 0x25EBAC48A524D, 0x4A85947DC6B42, 0x04FB4FF3D36D2, 0x47F3B25A2EA0F, 0x3D2FDC9D207F2, 0x1025F44CE7D42, 0x4CC783360DCFB, 0x0ECDA188B094C, 0x103E68F1BDF37, 0x00027AA8DA595 } },
+  { { 0x520B259AAF1B8, 0x5121FDF024192, 0x5B30D2AEEA968, 0x3D25C76369C3D, 0x5A9AA2B6C6F8B, 0x583ED563A6041, 0x6ECC58E1F6DE6, 0x568AC62DFA84E, 0x171224575088F, 0x35A2B62324892, 0x35902415F4629, 0x46C351308CBB9, 0x7894FEB11BCA2, 0x110D8F1C3F6C9, 0x000221A90FB8B },
+    { 0x32566775535DB, 0x01485504D9F86, 0x687E08884F719, 0x1BACD2C623A68, 0x2B1839AECECC3, 0x20B12A1595A88, 0x32D46C5929E05, 0x11B8B80E0EC2B, 0x2C3167C5CC289, 0x068356F9C2EA0, 0x7D19ABF9682F5, 0x06A33B5E23F9D, 0x286C69637A808, 0x35C56A873DAD6, 0x0001140D12945 },
+    { 0x3FF9EE67E2D4E, 0x720502A5DCC5E, 0x3A81A8CCC7361, 0x3365A74F8BC55, 0x080F69958BADB, 0x7B1CBCAC8BB1B, 0x0FB8FE3B6CD01, 0x42CAB612C28FE, 0x528E7E151B353, 0x4EE5E7D3748D0, 0x37A4A4D24A899, 0x6F7A4613793B9, 0x2B508DD9CF4B9, 0x26D5FDD5E407F, 0x0002A6AF115BB },
+    { 0x6DCA9B605FEF1, 0x4E725ED2E184C, 0x377601B240294, 0x6B1F2E5DE405E, 0x0D5CBC441EE04, 0x43729FB9D1A7B, 0x0A38ECDA6D9B7, 0x2D5318BDD9ED5, 0x5774804318ABD, 0x20638DBD1D1F6, 0x185E9CE340FF4, 0x4E6F122928478, 0x7BC7D82C7339F, 0x578569B5826D9, 0x0004525DDE828 } },
+  { { 0x6DD10BA61F976, 0x1102351292C56, 0x45D6A56777F5A, 0x1CA8E35F84A6A, 0x3FAD3A873179E, 0x23C6A6E034302, 0x18BB07A0A0CCB, 0x4E71AC72A3988, 0x6F2E350DB298C, 0x46B410B876676, 0x5A66296BD95B2, 0x6304DEEA7C784, 0x74013D5C95F89, 0x1F8E2D3576F80, 0x000565026B2AC },
+    { 0x0B4A600EF540D, 0x17EFC15014747, 0x14CCC29DDAF10, 0x08343C086C9E3, 0x14BDE04873CF9, 0x0585E7F268F44, 0x369C4061CAB49, 0x4125414A252C8, 0x61BF1E21F1B7B, 0x0D3AA05F348C4, 0x26893C3A07165, 0x0FB0CAB44B953, 0x202FC39265D05, 0x1478F12964FBB, 0x000174A235C40 },
+    { 0x32E8B0ACE97CE, 0x689C187B81B19, 0x3109D040B005F, 0x4C037CBE324C2, 0x6EA11E1EFEED2, 0x7F4154AA71F10, 0x2329A47C52E3A, 0x713394BD32273, 0x63CF08F15459D, 0x4AA2ED65A5A6B, 0x09421579D85E7, 0x7591A17D0F123, 0x2E36D06CB3C20, 0x77282AE70F353, 0x0002D90056513 },
+    { 0x55FFA07D244FD, 0x4D566DBC076C8, 0x31D90E8337C2F, 0x1C5BFE956E8B1, 0x5600601DF2220, 0x5E56D35A42B85, 0x72D0E3FC3FBEE, 0x0C871A9C52563, 0x6AB8114A630FB, 0x367E96A463863, 0x1AD8EFCE56013, 0x7C838B74742D4, 0x42349B661BB86, 0x2B69D333777F1, 0x0004AC7AAF441 } },
+  { { 0x7EF7649D6FF71, 0x5F623231CA293, 0x2792A61163601, 0x2EBBE5D6BDC3D, 0x05B86A430CFC2, 0x1DFC0B62169E1, 0x19BA12AD6C62E, 0x3C888EEBAF5E5, 0x0F051AA1E6701, 0x74AB89825F7F9, 0x144CE59EA2653, 0x24250771D10D1, 0x105AD4409598A, 0x3095F2C616358, 0x00045903B8A2E },
+    { 0x7C6DFE042AF50, 0x3BECE27AAD862, 0x1BFDAB2EE8FB4, 0x3E87CB4BFBA90, 0x2F25FDF1E25B1, 0x59D093DDE9260, 0x7CAE38A840752, 0x2F82C6BD580A2, 0x1D1B52A4E476D, 0x622702795ECB8, 0x46DDAAEA8536F, 0x5456100D1EE9E, 0x2D1EC2B6642CF, 0x550914F9BFA11, 0x0002C1C4B65BD },
+    { 0x49A926E0D3DC9, 0x160BAE7E4D5DE, 0x599BD15554905, 0x6F350CE4E30C7, 0x4F482DE102507, 0x2CD9EE0298162, 0x327D9D0796437, 0x143D930287E91, 0x478CC5DA9FF93, 0x0572B558A2524, 0x74CD84F0044EA, 0x01D91A0DE1CD3, 0x3C3EA54227329, 0x7C3A4D93A575E, 0x0000E13BDC0C6 },
+    { 0x46BF4C33098DC, 0x57ED3F1B29D84, 0x4662811303ADA, 0x6B65BBD088309, 0x01FFF819F9EB3, 0x74041C8EE47E4, 0x0D7F1FE4A4428, 0x2FA79FCB7ED52, 0x7096D6DD7B4E1, 0x173AFB9987EDC, 0x075ECA6D8668D, 0x733E57C7E91A3, 0x266F900A4CAF2, 0x26228DF85E6EB, 0x0003BB4D249BC } },
+  { { 0x5EA86431E532F, 0x1887874AE62D2, 0x44CF35E968692, 0x68947EE5E5191, 0x06D97787ADA63, 0x45B15D315CEE3, 0x5ECA29662301F, 0x5CAD77AA0B539, 0x28C9363C21046, 0x5F2373473A5D2, 0x30AF5E2118BF6, 0x7BBF5FA0E0786, 0x1421B06D86210, 0x1D65B7AC91BA3, 0x0001C8C7B1D3F },
+    { 0x79258AC34373B, 0x0DEB4BFE5F6E0, 0x6B48281AB9237, 0x2A795167BDE72, 0x2F1CB614CBF26, 0x784793A844360, 0x298C76767E699, 0x62880E15FB2B8, 0x675006D41DECB, 0x3E52907CC6548, 0x09A4ABE18015D, 0x7B383A97CA346, 0x2F7C97E4D6419, 0x258F7A3CB62C7, 0x0001E877DB73B },
+    { 0x75C5B114334B3, 0x75F55BC08AC24, 0x390A5BC545FE4, 0x10C9DF1CFA714, 0x75F1335672F3B, 0x717C53D75AE6D, 0x50E71BCAED9FA, 0x66804C609B01C, 0x685196FA73D71, 0x73508259EA7BF, 0x2899ADAE71F49, 0x01184621AAEF0, 0x7C85BB257CA2B, 0x369413EEC35F7, 0x0002A823EA4E7 },
+    { 0x771AF539BB993, 0x043B261B89D30, 0x17DF32FF63A16, 0x02ED26F478406, 0x766BD21766F39, 0x33D21F3EB5299, 0x6932827F87111, 0x5BCA439AA7644, 0x616834715A588, 0x6744A1667E585, 0x27F4381FB941D, 0x5D733702930B0, 0x370796D6B0F9C, 0x3130ADC570F67, 0x0003E903C5E8A } },
+  { { 0x6936710E2467D, 0x61CAEFC0CDF88, 0x1935877499235, 0x76FD5A85B25FE, 0x7B2C45D42D33C, 0x7EDCD1E3850C2, 0x2F67D0E0153D5, 0x559B810E1107F, 0x67D3DF5A26FB7, 0x59BB631A85B7B, 0x54CD51D3B2C6D, 0x695A6221C7AFD, 0x6EF63F58AC2EF, 0x600C18E847CAA, 0x00055FF29C7B1 },
+    { 0x7833F6E617B79, 0x3DE52D04B5F6F, 0x2D453356DE97A, 0x5811B61146683, 0x44181EB7B1382, 0x406F9DEC4DDB5, 0x54F08655C3067, 0x1C7434E4617A7, 0x7C69385F773B7, 0x00A72D55B3794, 0x07D419F6911C6, 0x63936442FE164, 0x31F99A55363B1, 0x240C00B78641F, 0x0001D124999B3 },
+    { 0x4F78D03A4CA19, 0x65F47BC28A6AE, 0x21BBA67AEA73B, 0x429BAC05AD66F, 0x1A459F79440E0, 0x67A96B9187D4A, 0x47DDF87FBFE21, 0x656D7CF03D9B7, 0x3F516D009E2E1, 0x1CB90CD5ADE14, 0x673EC8B186557, 0x133AC12BA1FD4, 0x411D5C033AFDE, 0x49C7F6C7F1487, 0x0004319609336 },
+    { 0x6608DA1523505, 0x3487FA50715EA, 0x6A3386FF8016B, 0x3938E7C7915A7, 0x24F187A6EB511, 0x198B6D27BB3CE, 0x4FD8160C39383, 0x10D8E841D941B, 0x31D865C41D0A9, 0x65996AD53A92E, 0x7FB7CB7E92C6A, 0x534C6418D616F, 0x41E8C33113A05, 0x7FC096BDBDFE9, 0x00044058472C5 } },
+  { { 0x0D426FDB8D159, 0x08D899896A304, 0x5379949A6CAC7, 0x72B626FABD63D, 0x401D5CE55FFFC, 0x62BC5D30EF710, 0x7EDA2627BA145, 0x610D9DE0414C1, 0x3CEE38E99F3CC, 0x6D52525E9C095, 0x43FF39CF1BB4B, 0x5094493ED2AD7, 0x67E6EB8D20BF5, 0x272977D6A07DA, 0x0005199470761 },
+    { 0x396F56FC88E48, 0x74944A94B6782, 0x6F322CB0CC79E, 0x6137703899915, 0x6B2BA59EE59AC, 0x37C1C6E5A35E1, 0x431725A21F1B7, 0x014299910B936, 0x4783804BA1DA3, 0x588B6CAF31A9F, 0x6EB5C568A56E5, 0x674E2A37F5B31, 0x1E9F01D88E7A7, 0x7446520086AD1, 0x0001E1384E226 },
+    { 0x178675E40DE65, 0x3E383A7CC40D6, 0x3C8B97115C8AA, 0x296305BDBD21E, 0x13FE00EA87344, 0x655CA9B1AB7F7, 0x1A7F512ACEE0D, 0x7C1F89C501772, 0x37895C1A00366, 0x33CEE26D45AAE, 0x5009DB3C6C0CB, 0x2E136365B70FF, 0x7928F2C9C31A4, 0x16D607AB5C5E9, 0x00052D681EB6C },
+    { 0x4BEF5C9B19232, 0x030AB3352D71C, 0x61E28B3D7A2A0, 0x62E28EC9CD520, 0x11D834177E927, 0x6859827B1A088, 0x27A964B5E7353, 0x49E8DCFB109C5, 0x3BFC431349FB4, 0x7C8AEDFC046EE, 0x6E1D932EB545D, 0x4A64D2E2904AF, 0x3ED41AA4D7E73, 0x29E0648C7EBAD, 0x0004B5F2984FD } },
+  { { 0x16ECC1B565998, 0x640394BA3B885, 0x1693E25E0FDA0, 0x1A6268DF9BC8F, 0x1FB65925F82D9, 0x137E2F1AEC8DE, 0x3FEDE1E130772, 0x0C54109FACA68, 0x4923BF022D3D6, 0x20D08D9E0D709, 0x1B1B3A0DDC90E, 0x2BAD50F72271D, 0x2E08C71C37AE8, 0x778A7F2EC388C, 0x00050ADF6F8B1 },
+    { 0x71514F6BAE38B, 0x2A55D79E41ED9, 0x76FBFA64448EB, 0x64B80BA5B7B9D, 0x254D8AD77D7CA, 0x484353F8AFCF6, 0x2D6C176EFCD1D, 0x6F5E7235B736B, 0x0CAEA94DA8151, 0x7B15F6E4C0B1E, 0x5C9C138DEA98A, 0x607078B62EB19, 0x04B646D6B72B9, 0x712802219144C, 0x0001C57D6C8AE },
+    { 0x08ADE29A0451A, 0x513DF860D8390, 0x64D70F19AFD32, 0x3B7A4282A9BFD, 0x634A6A9B0FB62, 0x43BD4E42CD0CD, 0x6690CEB21ADF9, 0x7AC48B127BCEE, 0x7139623F15864, 0x761C5EDA832AD, 0x7832262F23C96, 0x63C11EA4E1A76, 0x79632DFF17BB5, 0x38AFC0922C5F4, 0x00020E93245B3 },
+    { 0x65409932C74C9, 0x4EFBC549547C1, 0x06B8515229700, 0x213ABFF69610C, 0x345EBC493BC6D, 0x647B382F335CC, 0x5383F39CB91CC, 0x1F1A4C0B44D03, 0x7B5EEFB7C0C0B, 0x0928A5B85511F, 0x50B131E46E464, 0x586EE801A04AD, 0x74FCAFF15E20D, 0x635096CE0F7F6, 0x0004277B9F04E } },
+  { { 0x7BB934B0A2B63, 0x10910C8A6A550, 0x0055E2C3B3F7B, 0x2BCA0A92D5B50, 0x2CFBB4FC7EFAA, 0x2B9E26B5A4367, 0x6ACB0329F2437, 0x057DFED14129D, 0x3F05CD5936AE0, 0x3D85D48EA97D2, 0x6F3061DDDB11E, 0x274DDD43B03F9, 0x6950A3B145BE8, 0x2806DC0245619, 0x0004B606332AF },
+    { 0x166B49C40B7DC, 0x35FC4BAD125F4, 0x3BB80E0291B96, 0x6783FCD514CD7, 0x2DCC2701FC81F, 0x5AB3E4CE67AD2, 0x0323A7322098C, 0x77F45F2461E0E, 0x5B8C94450B861, 0x25DAAFBCE8CC1, 0x4AB5A15F6EEBC, 0x150C87E1EF5A7, 0x7C5FA5ABC83DC, 0x75A9800565695, 0x0002174026AD5 },
+    { 0x21D3054F6F45D, 0x07FC3E42CB37B, 0x34BF6B2AB0998, 0x3A36F2429F219, 0x7630B3AE4FFA2, 0x218ADB6CDF3C3, 0x5EB3D57D29384, 0x17F074DDB1F11, 0x2AD2CD635132E, 0x3C272A91D9012, 0x797F19A77269C, 0x435F5934A8FED, 0x53F1AA95C2656, 0x7DAC723DCDFD6, 0x0003C269BCB70 },
+    { 0x6B3FBEA1B0B38, 0x7DA9730622C46, 0x534C643E4FAA2, 0x56FB0D233E199, 0x69FA3F9C8B1E5, 0x4EEA0AFCE77CD, 0x04AED75FCC796, 0x5DD2DEFF8E6EE, 0x154CE67D47C9F, 0x09D81CD1DF3BE, 0x34C7888E53E8C, 0x58AC1449C10A0, 0x3FAF4C1DE6514, 0x70294446F01AB, 0x00028DD23C4C7 } },
+  { { 0x1A285DAF51FA4, 0x4727E3B9A0288, 0x52E0FF48EB98F, 0x70E8290826E5C, 0x3DD10B17970C5, 0x5992EAFDCCDC4, 0x56E9CBAAFEADE, 0x45DBCCF6B6E0C, 0x5C56ECCB42AF7, 0x3AA4C6415F16E, 0x4087C10162763, 0x5F24954C2DCA3, 0x47E3764F0B5D9, 0x5CD90D344BD6A, 0x0004968C26DBA },
+    { 0x389CF0CD02175, 0x527A27EFFA9E7, 0x550FB9E798537, 0x1FF64055B5ADE, 0x158FF476A262A, 0x0311BDB801B69, 0x54E2766BA8C99, 0x482E4F7C25700, 0x37F40C27CEC5F, 0x133303BB34CDF, 0x1FFBCB61EE510, 0x10BDA5C22A219, 0x154A393998E4A, 0x1FF9A6DB1F625, 0x0001FE5DF3B56 },
+    { 0x69C17FFFCB484, 0x5567849EB7567, 0x1B18675010A98, 0x740E553344C77, 0x4F42F8DD9C70E, 0x7534D696C8BAE, 0x7D0FDD57E54DF, 0x25BD67E3F2181, 0x2FD5FA67503F2, 0x32E013B002F7F, 0x397B0278AD1E5, 0x70A25F5A265EC, 0x2DC7D48C3FCDD, 0x74CA62A1D0181, 0x0002FEB186B79 },
+    { 0x4B6422446F077, 0x6AF05255907B3, 0x044A2A7E34867, 0x34CB0D2549004, 0x4DC7FEA7C03D2, 0x4AD12A2906EE1, 0x0F723F47C8811, 0x7BF009AC4E584, 0x056DB5918F9D2, 0x774D6BDA186CC, 0x3B90AB46010BF, 0x2FD8F0761C4EE, 0x3314D320F4350, 0x4946D3385F462, 0x00035AE89E7E3 } },
+  { { 0x3CAD232EB40D5, 0x7FA5EBE794464, 0x5E15EC8555FFC, 0x0D31879FDECA8, 0x11AB7502CD4B7, 0x08C875FEC9869, 0x1E20F194B90A6, 0x116C08651E3D7, 0x2771165856BE3, 0x0FC2587F8FB42, 0x309CB6FF383E3, 0x6F7299584A60A, 0x766EDCD4E9728, 0x37808D56D0695, 0x0006BB693F621 },
+    { 0x4B8AE3879FC20, 0x20CE9AC8BA462, 0x5F62FEB44C821, 0x141D64F9DF6D8, 0x73B08BD1D4ECC, 0x0C408872206BF, 0x5F44440E81F09, 0x1C6B6C02F0DAB, 0x5280C20C26E54, 0x0BD104E0AE458, 0x51CE15F0A4172, 0x17CC6BF2C2659, 0x1498648E2C88B, 0x5968806678C00, 0x00012F11FEE67 },
+    { 0x629ABF7E99535, 0x7540CBAE1F4D7, 0x24D571FEE1520, 0x088C3FCF54D7B, 0x0F7920E0EB0EB, 0x5F6CC0FF244EB, 0x733E039B157DA, 0x182D31FA20A6D, 0x74C487824B3E1, 0x3626305E827B9, 0x2C2BAF7AAAC7E, 0x10C88CDCABB40, 0x36D2C78B26035, 0x433C9E522428B, 0x00033DEAEAB81 },
+    { 0x2B8CE4CFD990C, 0x7D0198879BB3A, 0x753D927F8A4FA, 0x7C5E5A9A9317D, 0x6B4E8CA3B040E, 0x41D3CB2FE7B3A, 0x52A2945AFC3BB, 0x188D1F047607E, 0x27546553D7E22, 0x24C8FABF4EF00, 0x1EFCEDFC93EEC, 0x5B464BFFBF93D, 0x7F8F48665C8C2, 0x5D367DAF9F8DD, 0x00048D2CC59F8 } },
+  { { 0x42EF9341150A0, 0x404C2B0698BE2, 0x4D9975F765CFC, 0x6B098BE1C4E93, 0x6BC57A804B253, 0x26C44F539F374, 0x254DD898E977B, 0x3FE56925B61C7, 0x07B9D2038D329, 0x2BFBA148274DF, 0x4932B72261768, 0x60862BA1DB8F2, 0x3ED2E156EEFF3, 0x5F0A9D80041B6, 0x0002379B977A3 },
+    { 0x3846A3416D7AA, 0x326AADF9F4A2B, 0x7FAEA1544B75D, 0x2EC39C5F44CAD, 0x1BAAB76804464, 0x358A6EC120F4A, 0x5C261DC5AFABD, 0x34DA95A23B259, 0x2B4F1E0D54EB0, 0x1D52D083A73C3, 0x6D3A92F26896A, 0x2F39D5CFD3582, 0x4357C61ADF06B, 0x22CA052F7C9BA, 0x00025056D5251 },
+    { 0x61DBEEB93B996, 0x5CFAED0E2B5C8, 0x64602B21171A7, 0x19B7AA8C8C7FD, 0x5234DB2B38648, 0x7F0F14E7A68A5, 0x590A65D36BC7A, 0x22AFB9822B4D3, 0x7E31BEF78B2FC, 0x2CFCE06AE1B80, 0x23905F745E3E5, 0x5FDA7DF31E44B, 0x7CCC69F8FB56C, 0x7BF4CC64EDD2D, 0x0003689E851B7 },
+    { 0x6497A54BA22B4, 0x628098CB31FD0, 0x08870ACADB2DF, 0x2F3B14B2AE1CE, 0x7FCC54CDCF6C1, 0x17595F8276DD3, 0x5302BEC22BFEA, 0x0CE3B69A8AB4A, 0x320CFF414F9C5, 0x5EDDB66B265C4, 0x2CC14308DE4EF, 0x3927EF62EAE4C, 0x04B1241EF114A, 0x29A05033C2839, 0x000264606A48A } },
+  { { 0x6C238DE1FE7A6, 0x348992A7CDCFA, 0x49BDBDECD6162, 0x09E7C6D167B8E, 0x691CD41D45457, 0x421F5CBDE9C9D, 0x06B1A94B78453, 0x119520D24959C, 0x71602035E056C, 0x48475C49D5AEA, 0x4D638E7C87969, 0x32FFE1D842582, 0x5199742D3F05C, 0x0BC18AE440A21, 0x00032126C593B },
+    { 0x6D0ABFF394E0E, 0x69EF7F5D65B15, 0x44138B76B093A, 0x3A6FF1DC05A5A, 0x08B3029BA8A1E, 0x700F9837FE781, 0x3357134D252B0, 0x7DE7AAEA781E9, 0x771EA25F59EFF, 0x57351283C7D23, 0x03D8091B54EF0, 0x2A974DEE7CE33, 0x3E294C99F8273, 0x365426B2D5E83, 0x00023C7076D50 },
+    { 0x05ABCC9B16966, 0x192CD00A34EC0, 0x7C582D65621A8, 0x74298D7240E4C, 0x71D452CDAE559, 0x3174A51B8E3D8, 0x14FEAFEA5036D, 0x0F0365A09D927, 0x033D4394FB6D6, 0x3BCDE7E804A63, 0x2DC5782ED9628, 0x00DF1EB34393B, 0x1E409ABC1AF4C, 0x3F985B3CE9175, 0x0001245BB7C7D },
+    { 0x7B1ED4BD41324, 0x72F364D1CAB16, 0x2CD7084C2677B, 0x49BCFB5DE90E0, 0x380978397AF0B, 0x79D4D2CEB6676, 0x53A115333ED80, 0x17D7B01B3ABC3, 0x35E15B0675004, 0x68B8517DD97E7, 0x7525C7749D2C5, 0x19CB322A63E31, 0x7859AD95A8B09, 0x7711960139261, 0x0002762EF797D } },
+  { { 0x5167770A63CC7, 0x668AC49C0AE30, 0x0276F7E3645FB, 0x19732EB1741F8, 0x3AD48E1E6C77A, 0x1BA1980D9C8CC, 0x22A10E5A34D37, 0x3A4632112312E, 0x6B34CCDA21B4E, 0x0BFAFB5A58BFA, 0x38AFD57C8F58E, 0x154915A6C74B3, 0x70BF4B5AD157E, 0x37AA4EBEAE6E7, 0x0004151235CD7 },
+    { 0x01EB1C34AC64D, 0x2CA0E515F96A4, 0x19684BBC4AB28, 0x68D04C1C613D2, 0x09D668404016C, 0x176D177512EAE, 0x2A029E9304AEB, 0x40AA561EFBF9C, 0x5588EED4147D1, 0x05FCDC57AE4DE, 0x6FA1C51A74549, 0x4D19E12B88CA9, 0x2E56E6B47343C, 0x47AC6B7759131, 0x000278D7F6E42 },
+    { 0x1DF40C8F2253F, 0x00A8DE2B47CA5, 0x6CBD1543EE47A, 0x154A1121A1A3C, 0x6A4A808B21617, 0x442BE24F8690E, 0x6A5ACB4805476, 0x3723E9716B06B, 0x3AEDA76F85052, 0x1D1283DF6CF3A, 0x50EB4D0A19FFB, 0x62334C66E6FFF, 0x6FADA6B27238C, 0x103C77738286E, 0x00036C7924D9C },
+    { 0x6B0EC54809A6F, 0x55265CEF3980A, 0x786739E0296EB, 0x5714F8CA7C7F2, 0x7B1DC987F72A8, 0x23D3F5C64B76E, 0x7C69C6786C977, 0x43D934A952A60, 0x57DE66BD2D382, 0x79E94ACC1C559, 0x0FCA426368058, 0x45892F3782C17, 0x67AD9735FD58D, 0x4C1F04E292E9A, 0x00034677BC51A } },
+  { { 0x7478CD13DBDA5, 0x28CD6D50BB65C, 0x642E941346E7F, 0x30832EAF239D6, 0x2DBE0FA7EAA9B, 0x16E1A0B9D6BB3, 0x5C2A323A4FEAA, 0x46815CCF9DD18, 0x33530099E0147, 0x7EE8FB1BF628B, 0x353ACCFC458CB, 0x0A6E6EDD0BB42, 0x77B3DEA568990, 0x6217B4EF4A0CE, 0x000232BD4D181 },
+    { 0x6CED1880B8859, 0x217EA8949F503, 0x3EDEC4B95D202, 0x3ABCA70EF192E, 0x690C710FF3ED3, 0x6CB2D62CC4D7D, 0x5F6DB907B26CD, 0x71CE8A701A431, 0x289C9230AAE83, 0x2C0A942551671, 0x2806A4CD79AF8, 0x7AD336BEE06B3, 0x1A6294383D0AF, 0x6D6200E2A25D1, 0x00034A19EC654 },
+    { 0x5AC694CE8EFED, 0x2C11173DCFB50, 0x1AE4C23CC29DF, 0x396ECD0D4E68D, 0x77B91DD2ADCE2, 0x7D8E948E56CEC, 0x1E9F6FC9F9054, 0x4FDBFD5D0FBF8, 0x1208E8F03761C, 0x01EB57227C8F1, 0x4E7041CB2E736, 0x6E13F5F0BE2B9, 0x2E1787D30D900, 0x7539CEB01288E, 0x0003D313C4248 },
+    { 0x649133B36C1FF, 0x3044C9C1947F6, 0x31F280C64A7B2, 0x1DD2113DF3812, 0x1E9B3B264824E, 0x7953CBF8527DD, 0x12D1645F352E9, 0x00AB5B0BC3868, 0x474F409F5AF4B, 0x3FCF79D906634, 0x2D96A0DCF59CA, 0x26684AC397180, 0x7D941CF4D2047, 0x0B89908E62982, 0x00037815C34CD } },
+  { { 0x5312600134951, 0x7E81BD0A9D004, 0x003A03A501C10, 0x567078F6957F8, 0x7A89AA53610EF, 0x605632B27FDD3, 0x439CEB84E32CB, 0x0CFBB9456A38D, 0x66EE40062885B, 0x50530ACF9FA68, 0x67E9A01B41551, 0x71E3E4DDF97B7, 0x2FFA5B8E86572, 0x31BA43B50A011, 0x000437BC06F0C },
+    { 0x4D00FAD32B533, 0x41A3C73809172, 0x2F967301CF72C, 0x34027ED5E69AC, 0x7E428C7BCA390, 0x0708BFE15D092, 0x4BD2DAD1D66E8, 0x3C6CEB7F66B65, 0x5775FECF5C5ED, 0x6F01F093F6990, 0x2FE1F08F27EF0, 0x7BBC143AC040C, 0x728C271F437C5, 0x4073755C22C78, 0x0001EABA711FB },
+    { 0x1AE2A87567B81, 0x463B47184714F, 0x7800507204961, 0x1E24D2AF90830, 0x73B09C6FD233F, 0x6E07CBC93516C, 0x129CA62A23425, 0x100583D6DF516, 0x37EF4D6159A6C, 0x0276811AF9C77, 0x07E00DB2EFF5F, 0x477F872824DFB, 0x64C1CD0D9C9EB, 0x740BE076A6133, 0x0004283AD3A10 },
+    { 0x71B816AF6106D, 0x623ECA0797122, 0x47D11F0A0C0BB, 0x0AFF8498FE320, 0x2BD4EA54E443E, 0x67AC36D00EF97, 0x352F95955A605, 0x30DAD547E1404, 0x748A09A12881A, 0x00EB8104C0FE6, 0x122A7588FED34, 0x4D0EC89DEF90C, 0x54B3BF164A2A2, 0x35BAAEC852AAC, 0x0004D7990E7BD } },
+  { { 0x2F45F7BBA7998, 0x775576E82F94E, 0x6509795B9CC7E, 0x4A8056B544983, 0x20495CE382D1B, 0x2DC67BA7CA3A6, 0x6DF1D2914B788, 0x2BE44A53A9798, 0x57267B83F072A, 0x77A68E162846D, 0x7E7F581F0453F, 0x5E5B8231463A9, 0x05565E977F00C, 0x7648EC18D386D, 0x0005322B410C2 },
+    { 0x7F9EF02DC9B3F, 0x238B094BC03EB, 0x650BEB4693574, 0x71FCDDF13FE4A, 0x50F426E22C6F4, 0x33C29453645C4, 0x3DBBD83032821, 0x202A90D42A956, 0x5E89E71DDF469, 0x2AE98BD16BBB5, 0x3286645115109, 0x7F7FAA41BBB31, 0x40167FFEFAD04, 0x7A5E55823B622, 0x0003251365B04 },
+    { 0x17CE37ADB62E0, 0x54467A97BFD9E, 0x43EB799833062, 0x70A887EA3073A, 0x49F57DACEE264, 0x62FCEE259FE8D, 0x4F4D1AB89F817, 0x4673E62232DE2, 0x742A69848C562, 0x293B0525749B2, 0x326099CDE28BF, 0x080E0AD1C3EB1, 0x71D4502E6F3E1, 0x4AE92F467941F, 0x00037E32803AE },
+    { 0x386E9375FFB85, 0x6E00D188CE11E, 0x078F4410AC132, 0x5A89229C4B678, 0x40555FC8F4D77, 0x510FA655B7DD9, 0x258ABC1E164AD, 0x18C46CD893001, 0x362AC0B67319B, 0x697B8885B5A48, 0x572ACABC75FBA, 0x1181961F0ADC5, 0x108F1F7D36969, 0x4E53B8F45F84B, 0x0003BC38A0583 } },
+  { { 0x23E739FB243A7, 0x0607A7DC175AF, 0x1A64BA51B620A, 0x64C5580765B8A, 0x2CBBA96B7C164, 0x33DC013672A30, 0x077863B5E5D9D, 0x101825184954C, 0x3E73BE31E1F21, 0x20E2C801ED86F, 0x15E5108531C0B, 0x1FFD98ED58CB2, 0x5E9257198A295, 0x794159951B6EA, 0x0004126D92E54 },
+    { 0x4F7107F410B62, 0x10BBB10312F7C, 0x168799FFAEE3E, 0x42F6258205A2F, 0x4A5DD24771892, 0x2CAE2F13DC390, 0x70D665B863631, 0x5C93EA44616CD, 0x19FD0B5D505F3, 0x487F0B6A6E683, 0x4E126E5C84315, 0x212935D1D34CE, 0x626B1DB056991, 0x2F874138E4C39, 0x0000B7F16CC94 },
+    { 0x3DBFE9AE2C873, 0x76B3B1D284A56, 0x1D1D422F48144, 0x3C07589005585, 0x5181BCFD6D183, 0x362D22855E623, 0x0E2C4D8965716, 0x1948C2E9A1406, 0x1D470CE0055B1, 0x52573B5EA381B, 0x681E4896DD811, 0x2F4A280EE0876, 0x0F07F54344301, 0x3435042C452C6, 0x00034C24D1017 },
+    { 0x56941A3BB4ADE, 0x161DB7F62807E, 0x6E4826626B4F9, 0x78EA506FC1FE9, 0x23DF97E2BCF5D, 0x5F9B38F78F5FB, 0x1DCEAEBDC0AAB, 0x34FAA972C14B8, 0x4556493F6F82A, 0x14B6BE4A3228D, 0x13EA7450246A9, 0x08C71FF81DB9E, 0x702360BD68F47, 0x14D2C70DDEE5C, 0x000411547CA5E } },
+  { { 0x2E23778D93F7F, 0x596935B76FF15, 0x3514EA7B22B67, 0x4A1E6186E3311, 0x3C3D927F8072F, 0x31497917AB41D, 0x60F53E2AE7BB0, 0x6AC7E31AD51B8, 0x73DA5948092E8, 0x644619978B8C9, 0x09696F153ACBD, 0x14AADAD30D94D, 0x598D2931B5DD5, 0x1AB2BEEAA5B16, 0x000543E678C98 },
+    { 0x4260ADAB858AB, 0x7A844FE0B3BB6, 0x2B9A4DF60DC7B, 0x7D71FD750C116, 0x296925A43BCEB, 0x68DC8D6D80592, 0x242B01692D099, 0x2927B6E4543CC, 0x374AC56655F1B, 0x0E3A1E7187A40, 0x039F5A1D4F1D5, 0x32D8F55037FC1, 0x50397C268B516, 0x1E5E22E03B867, 0x00018C31009F2 },
+    { 0x20B7D296DBAF9, 0x64AA0809669A3, 0x2804E3BD9E2B3, 0x386EBF900CC59, 0x6960726EE1291, 0x623D843E36352, 0x5664B14FF2A0B, 0x3324A4EE07044, 0x1528932D97598, 0x769276C9454E7, 0x1C19E2DEEA7B7, 0x2BEE39C6673ED, 0x4DF5640A8964E, 0x5A2293C0FE4F0, 0x0003F1E8BA5EF },
+    { 0x4FE133429568D, 0x756F825CEFC42, 0x3FBDADBF0FCFB, 0x6902BBB3C5207, 0x5623031AD9738, 0x64C2A716C2898, 0x3AEC54ADE983F, 0x3C8D36E52B1EF, 0x74670C28FC3BF, 0x4176C4A732039, 0x64E056647F0AD, 0x5C0D27FE611C5, 0x42972EC15CA62, 0x008BB25F56CC8, 0x000225A53E4A8 } },
+  { { 0x7D5B7F28B95F1, 0x1D6836EF64942, 0x4CE6187A99110, 0x0D5C2837B81D8, 0x3080346C7528D, 0x0AD9FE3042667, 0x4D6DA86B5F1CB, 0x403466ED22205, 0x1F0E04E24D8DD, 0x23C721A3A2A46, 0x4A5248C806855, 0x28DFEA1FC8402, 0x6C2B8A6A2D238, 0x41252A5999ABD, 0x00063A85277C8 },
+    { 0x5D1989669154A, 0x785A294F081B0, 0x0D1C2E4E167F3, 0x0947664943A2D, 0x389A2EAE111C9, 0x2CED80D1EB40A, 0x2823F37EC878B, 0x73FB7FD5FE953, 0x4B657B5EB91A8, 0x4D741DB3E02E5, 0x7B2CF8FA83F8B, 0x3587DD3E872BD, 0x716AC0A8CE76C, 0x5F4D7EB1E1D21, 0x000139F40906C },
+    { 0x433CB0A373CC9, 0x61B764CB38EFA, 0x1E4EA5A3F6BDF, 0x576D3C8F7DF8D, 0x085FD48938A73, 0x02144B3E0203D, 0x4C30D866760C1, 0x52DE925838358, 0x0CABE03EDF62E, 0x153909B2F197E, 0x05E019BA209CF, 0x6D7BEFA8CFE82, 0x5168997FD02D2, 0x4E4A15DD2A88A, 0x0004335F28C7D },
+    { 0x586836495C00C, 0x7FAE35EA6A6B0, 0x6245D038FC289, 0x0A539604E92F7, 0x0DABCD8506353, 0x506B5456F8BE9, 0x37D2A1C7E816A, 0x27A4CF5460AE6, 0x44AFF9E722E4A, 0x7394FEE7CDD54, 0x12312B365CB34, 0x5290462E6799C, 0x198B31C126FA7, 0x12D71E938CE39, 0x0004A145B080E } },
+  { { 0x554DD88F68416, 0x688B355DAD0E3, 0x7FE05F73E58C0, 0x66E4A88536296, 0x7789F88641F19, 0x233AEA9003FA5, 0x405CD181F72AB, 0x4FAB1226E40AD, 0x6E2ACE78D28AA, 0x77E509AC70334, 0x0666F2CF9510F, 0x0435DF6107151, 0x2053FD5483C0D, 0x701E3CDB19A98, 0x0003FD43E4F8B },
+    { 0x3AB2CDC3198AC, 0x05D141C9FF46D, 0x38B75B7951E84, 0x3CE2486A3925A, 0x0D1A7D8A9980F, 0x79DABA62FDE5A, 0x4DD9A8B9164BB, 0x06D0397EE0A36, 0x1032454F2F67B, 0x5E5CE4D8AE9D8, 0x27CD940E0B378, 0x2CBE37E44843A, 0x0EA35CDE87ED9, 0x1857C42B29ACF, 0x0001ED4DC51F9 },
+    { 0x36F50EF5E7E62, 0x61CC9CF8528C4, 0x1F66BFF246467, 0x6F6247765E488, 0x3756248A4FA90, 0x05AFB276E5B54, 0x28CCB6B711E2A, 0x63E71B98E2F4B, 0x392828FC03A7F, 0x0BE5569D0DC2F, 0x19772CB6AA10E, 0x00AC2ABBA0573, 0x1CCD11BFBFE62, 0x3989162E21D14, 0x000654EC0DE5F },
+    { 0x42DA07DA19B3A, 0x3CEE458D77E97, 0x1DD96DE48B63D, 0x0DE056A20282E, 0x3D09AAC16886D, 0x784BE4B22026D, 0x468E93E10528C, 0x1AEEA969A5AB1, 0x56448430CB89C, 0x2CC8E556369E8, 0x26D28869742A1, 0x01F369446859B, 0x60889388EB0BC, 0x693FBD60EF4DB, 0x0002039E9DEFB } },
+  { { 0x063ADBBF2BBC1, 0x1512FBAB0292D, 0x0D4CFB4EED46F, 0x671B79D7C6453, 0x76052A18101C3, 0x607AE94045242, 0x257CB4EEA48F3, 0x705C41762C289, 0x762AC7841B418, 0x4ACA8DECAF386, 0x73556D09E066E, 0x2C5F11988C203, 0x395D05A904405, 0x01A10C1C9B301, 0x0006D5CA803F8 },
+    { 0x24446F59B032B, 0x7D94E51259FCD, 0x3FA186E801EC7, 0x2773E47DD7503, 0x2FE41498BF2F3, 0x13D266DFF9277, 0x7FAA62E7E718E, 0x44CC47202CD89, 0x5BCF31CA8B4E5, 0x3494A209A070A, 0x05C7E6D3CCC37, 0x2E9A45CB570EF, 0x1D829F57FB95C, 0x245C003401074, 0x0001A3788D342 },
+    { 0x0F79F54A4AE83, 0x53D237884714C, 0x1CF27F0B1F747, 0x03F5BFCB46262, 0x569F7585A995E, 0x7658D0C925D1B, 0x421033350998C, 0x5A93CD7B90A84, 0x0CD3270BA9D2F, 0x46E61C7F65566, 0x147A6B89BAA52, 0x592270308F5DB, 0x63322B6C3C4C3, 0x46412AD77209B, 0x0003799486D33 },
+    { 0x5CB7F1D496875, 0x06C03B697A811, 0x73F75D2D4F367, 0x0500E9E8198AA, 0x1C25C48203014, 0x17A4EBEA12C50, 0x5B102F2E3B113, 0x6584EE8CC485A, 0x6DA4DA27B1A88, 0x692F13BF4CB4B, 0x1051DBDC418BF, 0x4EE96FBD13207, 0x47D9EEF10A382, 0x20B4DF7E84CA0, 0x00023FFAB9D7A } },
+  { { 0x7E0CD893663C8, 0x52E7D0D7AB367, 0x2377CE1F8C507, 0x4AF88D2000397, 0x60312EF3639E9, 0x3C0A0F5EEF593, 0x5F148282FD8F8, 0x2DEC253EFF8EF, 0x2FB13A4698170, 0x6CC68F1501C77, 0x157F9C29C4704, 0x35F9B0C47B1F5, 0x00EBB86172472, 0x7BDA2D2C64EFE, 0x000268BC987A7 },
+    { 0x43B95E97166D0, 0x18F2338CA93EF, 0x0E8EB6A1DC337, 0x779F8B7C6E526, 0x681516881B758, 0x47667160B09BB, 0x15C090DA4C925, 0x6EB544B439594, 0x3EBC124784B6A, 0x355302BF7518E, 0x0A1F7DD549CAE, 0x5D4A72D2F04C5, 0x07C5D01597437, 0x1621463A92F8E, 0x0002229BFE8EE },
+    { 0x59148D23A703A, 0x5164C71C53812, 0x3DD36796698A5, 0x44D3C7E85EB0E, 0x264824CC3730A, 0x5701E97D0210D, 0x3D57184804F97, 0x3E7C279EDC259, 0x1174BDA02284D, 0x0523E5F6DC117, 0x6CE491791B7E4, 0x57B1245708C5F, 0x1E794DF9CAAB6, 0x2DC6E481CE280, 0x00018F69199BD },
+    { 0x6EBEB40228A4A, 0x7477FCC5F4A9A, 0x3DBF740CFEE5C, 0x08641C92D78CE, 0x5B03AF8F1B8EA, 0x338450172465C, 0x603CAFC4A34CF, 0x31AB90B334006, 0x738B5EE7FD127, 0x2B3E164A1E9E4, 0x21DCBFE0086CA, 0x7716BA91AD661, 0x30F7DDE911A66, 0x5E013828A7F74, 0x00047797A616E } },
+  { { 0x6DF2A807D5D60, 0x278A1CAFA6FE8, 0x1C5010D075A4C, 0x4F08488BB4796, 0x4B6916052A242, 0x1B24A2819BFEF, 0x652A8AB6D22A9, 0x68FB4001B7135, 0x551EAAD5ED09C, 0x592A597BF80E8, 0x4B5A89901B33E, 0x7C03E01FD9599, 0x54080453F467F, 0x291062BE32B66, 0x00032C16BA0A2 },
+    { 0x08693BE4B684C, 0x0DDCC16649844, 0x35CD6D7439417, 0x41CC6EA1BDCC8, 0x2BC7ED1D13CD8, 0x63B4EA0E61BA3, 0x720EE031967EE, 0x463FCC06428D8, 0x1AB877E7001F4, 0x1B1DFABD262A8, 0x2501C92D6F8B2, 0x737EA8B4945D2, 0x7C66B47280FEA, 0x42830A4446BC9, 0x00031437393E8 },
+    { 0x1099258835046, 0x5F6077D37E25E, 0x021951F651A48, 0x4E0BE5ADCDE9D, 0x49A04AA0E3B7A, 0x14A6449EAE4FB, 0x6A4B973E412BA, 0x6787B41768A4F, 0x114B4F280045E, 0x684693BA85717, 0x27B430B10F5BC, 0x3237061F4E426, 0x14687CDD29786, 0x61CA193EC91C7, 0x00013C79A2667 },
+    { 0x621F086789C66, 0x6AF3B07B145ED, 0x293AFE7C8D261, 0x62E12B2764D37, 0x343F20B9BB563, 0x095A0399D343F, 0x70B93C141A90A, 0x7D4931686F076, 0x3098ACD37F7D6, 0x64F03B0D5E95E, 0x78DA04D8F399B, 0x546D75015D933, 0x3CBB74DA2B10D, 0x19E75AD936C5F, 0x00032FFA2ABDC } },
+  { { 0x156831993D418, 0x7BC63487D7835, 0x3A0044D73D5F7, 0x1FCA67B0EFA17, 0x4557920C7E1F0, 0x5580DF861AFE9, 0x2F36D2C959290, 0x50BEBEC5BEB25, 0x3754D335F7CB1, 0x4AD05477D0BB7, 0x62229AF39833E, 0x4FD3D6DA96A80, 0x27FD8C5420737, 0x2826816B20904, 0x0002A40BB615B },
+    { 0x57657AAB34CC4, 0x710AE20AD1C91, 0x3EF715C2E3195, 0x61FCFBCF6B77D, 0x318CBC5C79401, 0x1699A0C24DF98, 0x1E720E4FCC552, 0x5BF59BCFF4797, 0x68EE6B115533B, 0x054D0CDC17FE4, 0x779BF2DEA933A, 0x12CEB8FAD379C, 0x1E45D0C7C90F8, 0x0981EEDCCC00F, 0x0001B5F1435EB },
+    { 0x79C2CAC4A734E, 0x1476794FA2BD2, 0x34EA99C084DBA, 0x68ED61F2C077B, 0x5066622439E2F, 0x2F082D533AD4D, 0x3D9F6B0E7242E, 0x131F855D83DA7, 0x74A80A6B6282E, 0x3503E70B42A5D, 0x22EB04F82B854, 0x19F24B83A46DC, 0x7C7C34E7BFFAF, 0x189AAA4B7FD0B, 0x00034A3B91B24 },
+    { 0x1BDFD37FB811C, 0x1CFB5267A5D71, 0x7C03B5E961F76, 0x5FF9B7D25F152, 0x2E13D5FDF6324, 0x1128352C03F05, 0x1E772E0163D38, 0x544F9D400A37B, 0x2672ED6F979ED, 0x75AB1031B12AC, 0x206BDAF78F774, 0x5E60A73E69AFE, 0x14A585A0C1B2D, 0x5324972E189B6, 0x000443159D85F } },
+  { { 0x41CBE4BDAF77B, 0x0D92B5B58C5CD, 0x15CC79CDE0E31, 0x4EF3BBEA4F587, 0x65E5A3F9295ED, 0x281E71DDE46BE, 0x7262C66BA6D51, 0x57B3AE42D5C71, 0x701EE36806412, 0x38ACAD38DC40E, 0x130110764836B, 0x38E4A60EB1802, 0x2B656D1A6640C, 0x669173D3C051F, 0x00034B0E25174 },
+    { 0x0E2DDEAA31F93, 0x54AD31EFD85D4, 0x691D901CFB640, 0x6848A18D61426, 0x2E5665964AECD, 0x160F4BAECF279, 0x7B4F68CBF4C81, 0x1B8E51431DDF1, 0x7EB0FFE25D90B, 0x12095FB299E85, 0x6A110FC9D28A3, 0x32A6D4F7078DD, 0x51E9B8B019164, 0x294A47DF1A00F, 0x0000589079B39 },
+    { 0x341813C69D22D, 0x70885B8277BFF, 0x6244FC3FC64E5, 0x7034C101AE2F5, 0x545391333BD9C, 0x4862D992C51BA, 0x4405FCC012813, 0x2B46AC1182301, 0x750281EB33F08, 0x5A04535E99703, 0x2295725DD8AB5, 0x033C66DC270AE, 0x316A9F2C4E2DD, 0x32263719E0C5D, 0x000522700B0CD },
+    { 0x6CEC54E4E301D, 0x601C3D051C57E, 0x048D9B9EB5ED3, 0x5327BCF7E9879, 0x6DDB9A540CB4B, 0x10464490FB7BE, 0x114826B39CB17, 0x36BF6B57EEFAB, 0x5025E5C0BB9EE, 0x412B5404CBF15, 0x52176AFB589DF, 0x01E865A16242D, 0x57128D653D5FE, 0x5D94C88A1EE9B, 0x0003CA5877341 } },
+  { { 0x00A7BDD927DC7, 0x67CC1804D74B4, 0x3BBCF664C62E5, 0x0E37525944ADA, 0x25BE08725CFB2, 0x327EC0E0BCFCD, 0x3C66F4130155F, 0x26B3ED4377390, 0x4617C8B434EF9, 0x59FD75591CD05, 0x053F55CF5A208, 0x60AABDC371328, 0x5F3CB5DC23281, 0x030391AE9BB87, 0x000584383F85B },
+    { 0x175DEE82795E5, 0x5554B61BD2CB7, 0x3B2CE70CD049A, 0x0B12AC94494C7, 0x6570318B73423, 0x617183123240F, 0x2018134FF9BF1, 0x52394FF40AA47, 0x392DF80085478, 0x4B8B2AD96C823, 0x0B7D00C15FA46, 0x3BBA861904611, 0x6A0D167A55FB8, 0x24C7AFD29CC6F, 0x00019B41474AB },
+    { 0x1AB151FD982FD, 0x0E785C9C80E5A, 0x2C19395934370, 0x6960A0EFC99E8, 0x4AC9F7B37D3AC, 0x434D7584BA51E, 0x4A82AE9409FFD, 0x18E76D1C49655, 0x4C16F5671AD9C, 0x3A5533FA35AEB, 0x1DF84530B620E, 0x30B037D2EA1C6, 0x00605812AFD54, 0x4A6069FCD7ACA, 0x00044F8857832 },
+    { 0x32A462CBDDB51, 0x68CD6EB19DB64, 0x03980834DF782, 0x100DB029A598D, 0x1BFBD78F9FEEB, 0x262D309ACEE42, 0x382875ABEBBD2, 0x44FFEBD8739C0, 0x030EE56D0E055, 0x4297A15363724, 0x1363902AE2BA0, 0x13B81934ED4E3, 0x0CF937F1B1299, 0x51434C10043CE, 0x0002411C40F14 } },
+  { { 0x327EFBF2B6912, 0x5F5C6553D274A, 0x3EFF854E9E99B, 0x681A2B9B99BEF, 0x19F5CB8BBB7D2, 0x14F4B233B3BD7, 0x7DBE5DCB54BC8, 0x388321583EA3F, 0x6586DB721C157, 0x635FFFE3F216B, 0x27C8F739034CF, 0x264DAED660CCC, 0x491922476CE8D, 0x4C9285B1B9F59, 0x0001566D949A7 },
+    { 0x03498181E4C01, 0x0C806591C2E5A, 0x6EFEE4E8B5377, 0x176AECC960741, 0x792A9FD829ACB, 0x46D667B7D9842, 0x2E22BB58CDF34, 0x4F94116BE71F9, 0x1546C1C718F2C, 0x13FAFD461DC78, 0x7BF4AA6F1EACE, 0x38F4A5BB4B564, 0x464DCA46D24E6, 0x38779C7696047, 0x00025669072BD },
+    { 0x304DF6E9DBFD2, 0x11005572119AB, 0x5E6441F723CCF, 0x7ABA525460BDD, 0x78E4DC4D336CB, 0x74981B4FF9582, 0x1E9EA0C5C1CBC, 0x5B53B5EDD8997, 0x032441C40A800, 0x1A550DDE8BB11, 0x20487BDE3D14A, 0x16DBDCC858320, 0x7FD43095289C7, 0x27ED1ABC8FD85, 0x0003123F9AA2B },
+    { 0x628B20188779F, 0x475A338104A7E, 0x667BE7162368A, 0x1AD42E3608448, 0x18A419ADF109F, 0x0A5731AE36A4A, 0x16B6F85631DDA, 0x31F115D51C309, 0x1DE0E3D7FE435, 0x1FB8EF2DBA2DF, 0x0330B52A76DEE, 0x44AF78E563EF4, 0x6F46B6BE3C274, 0x0A30FC27047C2, 0x0003D6D91C1AA } },
+  { { 0x336EBCAAD9D86, 0x3FE1B3DCE4C89, 0x33A60ADA2E5CD, 0x11A18587DD1F9, 0x35F6FE50C989E, 0x606E777B0C966, 0x4EAF73B1A612D, 0x179F9BEB41601, 0x05ACC9F3926A5, 0x09CE38C9C6E1F, 0x5BEBBB6431996, 0x726E2EB04F8F0, 0x26A0321C8B542, 0x48E7484C624CC, 0x000178F0313D2 },
+    { 0x62E6DE928D5CD, 0x1C9E134539AD5, 0x6C9795B923102, 0x3B42F0F64FAE9, 0x259478759602D, 0x4CB731BECF31D, 0x0DEFBE84F1DCD, 0x300C4E34A7397, 0x07296D6537A76, 0x7FE5945E8C5FF, 0x2D2D0052DAC84, 0x64B061B60888D, 0x4B861F3379E72, 0x17BC92F9B1546, 0x00024A0B8AB1B },
+    { 0x04F70FAB350BE, 0x4F30F09A81DAE, 0x009CBFD5CF288, 0x1273C6AF94D4C, 0x2C5F438170F2C, 0x3AC839BD465ED, 0x583997C2F5A85, 0x2233364570E63, 0x0A765E78721DD, 0x14F3B735875CA, 0x138CFCCD92B2B, 0x64293C6F8EE9C, 0x455C889205F47, 0x7627F4EC28185, 0x000481FFED8E3 },
+    { 0x416D61FBFC6EB, 0x2235967F64D55, 0x1B22DCCC00B69, 0x0E7383EFEEBB4, 0x72ECB71C833BB, 0x3142547923DA2, 0x5AAB9F3398E78, 0x1EAE2BEA2E6DF, 0x615F209D800D7, 0x294B384410807, 0x1D2711160E2D1, 0x491291366A313, 0x485514566BC91, 0x052D1776F5CFB, 0x0003E043F01B3 } },
+  { { 0x43098CF07D328, 0x1A4857EA98819, 0x41274EA310FE5, 0x2B02C58803BE3, 0x5B821359A1802, 0x3149B06ADBBA3, 0x28FF7FD6D085F, 0x4E477ED812D53, 0x4312BF31C8D88, 0x698AB5679C31F, 0x140B0FC144624, 0x1CD126F628A7B, 0x0248F2C8E0EA1, 0x186E8B47892C7, 0x0003F75867116 },
+    { 0x370670EBF8739, 0x57E9C6FB4359F, 0x7A60DABDE29BA, 0x3F7143C5913E0, 0x15A6ED0F2E1B1, 0x4BFED25DBD31F, 0x1B2C5C82F10C9, 0x39A4C4D2BA8A1, 0x2B6B87EC47A75, 0x0581C7500C9C4, 0x3F8DA49412A8E, 0x4485E2BAE0FCB, 0x5873502A908DA, 0x5E56AC1E472DC, 0x0001D7B199988 },
+    { 0x0EA1FD183DF50, 0x1F809F9E1A457, 0x73B85B4BFCC46, 0x7579D935777AB, 0x21E69DF7B1269, 0x426E9C3383DBB, 0x677C0531F1220, 0x53D957020C2E2, 0x5226C18F09335, 0x305B673F9FFCC, 0x75660D8C95F19, 0x2D924A5C32224, 0x4D2D71452D24B, 0x44F42BAF1759F, 0x000159B85418E },
+    { 0x531AF9903BB6F, 0x345AD041E9DB9, 0x3C5F2571425AE, 0x0141833003FDF, 0x5905682AD155E, 0x7D373708595A7, 0x6610DE9022E04, 0x31A90B9B77B65, 0x6ECD484F442E4, 0x016A6EA9464AA, 0x4510FA9A9027A, 0x4ED6859264A8B, 0x52C585A73C3C8, 0x1AB4F247098D6, 0x0004A7C9EF8AE } },
+  { { 0x02D659878D4B5, 0x002E5FE4E88D5, 0x0BCF28843D776, 0x39C774FEE5E31, 0x17BA90844585F, 0x0F1CF1F68FD1B, 0x25EA851A4C053, 0x4E14D1B3D1394, 0x2336D6BBC3AA6, 0x746991DD21987, 0x62BB24047DE80, 0x04B5407D19EAD, 0x1B9C01FB50C23, 0x3CC79DA3DEC44, 0x00063A264781E },
+    { 0x7D02FCA24BDE7, 0x5141B56932BCF, 0x6FD5A739C64F6, 0x4FCE65CBB9E26, 0x001CBB5AE8C37, 0x4BCA746FD6310, 0x5DE2F56E4D05A, 0x6DE29E2FA4D32, 0x3843B33D5B9EA, 0x41DBF3BD7E524, 0x7CF333FA69222, 0x6115B846A3755, 0x5E379D926C8DB, 0x282106E180EFE, 0x00015E0C7D76F },
+    { 0x2347849A242DF, 0x1C547A2E967CB, 0x4DEE50B20AB69, 0x30EBD8D100AF3, 0x645F4DD7137C3, 0x5A8D0643672A8, 0x46E4D5B4F926C, 0x5EA4D84464532, 0x0B58FCA03B70E, 0x662E6F0A0F921, 0x2CCEDD0428684, 0x09527B7C81FB2, 0x22CDDCF2661FC, 0x2C6736DBB13D7, 0x0003C5B17B671 },
+    { 0x6390ACA2FB9CB, 0x213A951334055, 0x06625D38F17A6, 0x0146F410DFEB0, 0x3759FFD7BB234, 0x1F7CA3CC7FC53, 0x599CC8A990C58, 0x5D97B8188FA21, 0x59509F64DE975, 0x60886DB027236, 0x25AF1B6D60D0A, 0x0EE25CA998637, 0x78BF47AF99182, 0x2CA781D099A96, 0x00043C1E39F1E } },
+  { { 0x7E9D633EE2CDA, 0x672FEDA99098E, 0x1D9A312A53334, 0x059FF5A44420D, 0x26E8EE0DA452F, 0x5CB3FF929E26F, 0x422560B6839B5, 0x67E4F97A3BD6B, 0x342C6A4F8FA20, 0x7DF77F86413F3, 0x42A8518FC280D, 0x06567839901AF, 0x591057CF1F07C, 0x2936D04067575, 0x0005644FA8191 },
+    { 0x3194912796941, 0x1515866EB81DD, 0x1150DAEFC4138, 0x3B855B6CFEAE6, 0x3EEEAE717795A, 0x328DF4AC30341, 0x52FB2FF8372EF, 0x16EEF7745CC15, 0x1B5AE0041962B, 0x43254316CC505, 0x2B088EE71F086, 0x6D09680BAF2DA, 0x24B4A8FC6A3A8, 0x2A7B25BB9C502, 0x0001E81431636 },
+    { 0x5A8BB4A506074, 0x3635EB4422ADA, 0x66805972C26D0, 0x6DF69ADB827E1, 0x0CCF7CD6F4850, 0x440E58FBD0E0D, 0x76C8C9DE4FA29, 0x7A916E21F35B6, 0x6D7B6CDB47653, 0x7CD84669B160B, 0x2DBABE6A74957, 0x29C14333DFB68, 0x7063EFCFDB255, 0x0ED2FBB72A70C, 0x0002805E724FD },
+    { 0x0331757DBBA57, 0x3B59D87ED3B29, 0x782DB4F780C5A, 0x56F7AFCC60D8F, 0x5BE4AA9C6320C, 0x3DEF5883660BE, 0x6D486DCDD1060, 0x6B509C17EB31C, 0x63BBA5F6A3A57, 0x7622FBC15F81C, 0x6B7275D552B87, 0x60E1E6579D464, 0x78AC096E43CC1, 0x5EC60592E1685, 0x00026592E818F } },
+  { { 0x276678E9D0AD8, 0x479E0073D337E, 0x05CBC47423BFE, 0x7D9EC3750571A, 0x237BE2FDFC046, 0x09847D11C6274, 0x53DF35B667E8F, 0x41E74C9023B1B, 0x310852140DA85, 0x6A6800E140CF4, 0x09C63EDF87D62, 0x11EFDB3A04DA2, 0x6B593E04578F9, 0x63B11911C3329, 0x0003C7E791A9A },
+    { 0x44A5B7A61295D, 0x1246F7532F66F, 0x0FD7D760D8EC7, 0x7D2788DCB0550, 0x4BCF63E53AA92, 0x53781026E70DE, 0x4B1A378CB757B, 0x6C42F127171A8, 0x2E2A389FA3F5D, 0x554D42BAB75AD, 0x7A8C6CBCDA183, 0x1AD4431DD22A3, 0x42FA2ECD37C94, 0x141E598257FA3, 0x00026E81FB637 },
+    { 0x1D4633481AD40, 0x014B8A804389B, 0x74C13AD110011, 0x08EDF0EB363BF, 0x7E3BE96F3FA05, 0x4009506C00C6F, 0x674A6C8B0125F, 0x07D6E2C542786, 0x5401C29274F6F, 0x3064255EBC1DE, 0x6263ACDD1C351, 0x60CF3BA05DFEB, 0x41A096455A1D4, 0x5C7623B5CC291, 0x00042497D7571 },
+    { 0x613999780E84F, 0x2BA44F8125EA4, 0x662DFC3A2553B, 0x64CC5D77C282D, 0x48230A7E4A510, 0x14DCF48A0D981, 0x645EBB6932F26, 0x7A6841DB9D4DE, 0x35CAA0C03A640, 0x2C27D728FFAC8, 0x699A5B081486E, 0x61BF70E4DD23B, 0x7DC8CE3582C32, 0x4A48C0A33F39E, 0x000392F818D04 } },
+  { { 0x012D5A3AD67C6, 0x7594FD166DDB6, 0x7F0E077900078, 0x103E498838745, 0x420A647DBB9CF, 0x18FBE5E26D003, 0x118E6C5272017, 0x47D16B4902AE0, 0x0B827D14546E7, 0x1FAA05A491A77, 0x14BD95FA49A63, 0x2BDF206C2FEC3, 0x378ADA000B804, 0x5A94167BFF888, 0x00056C3D1E960 },
+    { 0x391391D388C06, 0x7C376E39AD191, 0x66F267AF3B798, 0x163180812CF80, 0x7DE78B3F5C4DB, 0x564A27EA2214D, 0x780124FDE916C, 0x20ADC828150DF, 0x17D9A9A4F756A, 0x22E7260D0FD47, 0x35BE4850375F3, 0x669616B91FC12, 0x6525576347718, 0x237536F5B193D, 0x00010DC2798D9 },
+    { 0x75694A84C9CA6, 0x4BDDA7EA8301F, 0x72FEF19922A35, 0x0BEFE03F8242C, 0x60E2EC39533A9, 0x53185BA5ECBBA, 0x0090043A699A8, 0x6D9EA49AB190E, 0x1B91356501A12, 0x1582027237469, 0x61FC003A1D772, 0x21E54D39A30CF, 0x3F1660D3A1018, 0x2A549CC0102D9, 0x0002EA787A445 },
+    { 0x1AC03E365D71A, 0x37A1AF236873C, 0x41FC859159638, 0x76AE8BADF12CC, 0x79400427E6429, 0x614E82F81F343, 0x4BD6F40EBA513, 0x5CB1EDB3CF783, 0x25700B8106100, 0x5BCAC802C6BB1, 0x2D93301AA940E, 0x769D6C6A10674, 0x62387A83BF9CA, 0x697728DC68065, 0x0002C96ECC506 } },
+  { { 0x489273C6B55F7, 0x490B08BEE2A6E, 0x77B166AE9BD14, 0x0BFA96B2D8FBD, 0x5BBCBC970AB89, 0x54D1EC118198B, 0x3C6FF54AFBADB, 0x6A10CB6347047, 0x13EACCF9D0C20, 0x2E167068CCE46, 0x7FB2A3C934EB7, 0x7823715B71A76, 0x60404189D4A30, 0x4BC8A435E895A, 0x0001199DA4DEA },
+    { 0x45AC16CBF6C83, 0x281FAF1E31C59, 0x142609DB6B97E, 0x04C3EB6A1009B, 0x13A451387F872, 0x6B13E207BC878, 0x17B907B18866A, 0x04603EAF0EB08, 0x51DEA9FD77370, 0x12E7ACAF513E1, 0x782C1F883B4AD, 0x16485F76C3C7A, 0x638D5C4CE1313, 0x1C5225C9348A6, 0x00022963D9C71 },
+    { 0x622B7C6A1D907, 0x535E6BBB8FD27, 0x6A969DC17B694, 0x482A9DE0D5EE8, 0x789B5B40776FF, 0x6FE3479832230, 0x28A9D49745400, 0x081585E59A213, 0x13ED7881AC764, 0x7F97C270A3045, 0x090A79B139572, 0x470B85574528A, 0x681ABB6C21DA4, 0x6435475A4D6FD, 0x0004218D75ED2 },
+    { 0x3A4E94D881775, 0x65FEDF68D9AFA, 0x7B04009984589, 0x7A5A3126CEA08, 0x69EBE0354D3BC, 0x2DA981628C8EE, 0x30F6C99EC6BB1, 0x2F3969B139DA0, 0x52A751E4B7DAB, 0x608E84550D714, 0x316FBAB051A3B, 0x1A1558D6FE4DC, 0x1D4B49F5CFE5A, 0x076520DE78EC4, 0x000270B423C09 } },
+  { { 0x329A48D6C4E3D, 0x7A9F8E00143AD, 0x75D898E57A6E3, 0x23BE1C0BDE5B0, 0x78E833E39522D, 0x192742A9ECFAD, 0x08F1365FCBB3C, 0x36972AEC92329, 0x2F9DBC698EA77, 0x0B9A8BDEA5FB3, 0x10E285DF085FD, 0x720B0EEEA9209, 0x7A029A73E75E2, 0x3FE813164B9E1, 0x00020F89899AA },
+    { 0x34A69FF692D75, 0x228922BA34EF1, 0x379CF018339EE, 0x414A0CE1F2A94, 0x6A94B7DE4556C, 0x3203FF0EC1D6E, 0x168D05F2E67F6, 0x45EB76747DE29, 0x4CBF1C6D97D99, 0x6435EFEB482C8, 0x461EAE4832698, 0x5CC2A008010A7, 0x299926D9140E3, 0x330036D61FA8A, 0x00015C5FB442A },
+    { 0x76CDE1BD439C3, 0x20E72849E0418, 0x4431C1FD3D73E, 0x4E3B9AA4D8438, 0x11DA832342266, 0x5A1265790AB91, 0x38CAC7DA70E19, 0x2DD1D1896D497, 0x4182BCA3E6E66, 0x4DD1EC1719C70, 0x0C514441AE355, 0x0007F0DDDD773, 0x1B392C0FB665A, 0x39DAEE3BD4C95, 0x0003944FE0EC7 },
+    { 0x0F9B65F27C9D9, 0x16C7A595CDA9A, 0x30C4D3B776A7F, 0x201ED754E2268, 0x0FE07C665AC9F, 0x7EB319AB3468F, 0x456293CDD7D15, 0x6D158F37EAE0D, 0x5081F23315218, 0x42E7C714F8BA4, 0x648EF930A44EC, 0x7FDC267261FC4, 0x647E357E52FCC, 0x129F7676FBBB0, 0x0003D4ABDD659 } },
+  { { 0x6F76FFBD32B86, 0x2CB5507EA8C16, 0x37DDB5A270947, 0x4854931BB14A8, 0x014591A193732, 0x15639AA2EF9DD, 0x4465471BBB35D, 0x4085EBED92899, 0x6DEEDBED65E83, 0x551140DC097AE, 0x6F3B917605FF0, 0x2F2F2F2872013, 0x4BB5107DAE50B, 0x665BBF205FEC2, 0x0002C51332504 },
+    { 0x49E8243E00440, 0x2B76CBFA27F4E, 0x50A08F8BA01B9, 0x05FBF0E88876D, 0x7361B51B619DE, 0x718AD958F0AE4, 0x5F8A0B4E124EA, 0x331BA09FC7D47, 0x433769384178E, 0x2B822DF4D15A4, 0x30D01F283843C, 0x249EF2E9BD2F4, 0x3EB8067B1BED6, 0x44650DB055F4D, 0x00027D67C6BFF },
+    { 0x2C5A0683638E2, 0x66293163E4F4F, 0x13035281DBE89, 0x46536B91CE2C4, 0x58140FD811756, 0x6C467561F71E0, 0x6B003AE14C241, 0x031C3E0D96406, 0x1CE78CBFF72BA, 0x26BE1F1BADF96, 0x0C8E97F602A53, 0x57B242A108192, 0x7A024B29563E7, 0x74F3073A054BB, 0x00031D817DC5C },
+    { 0x6AD951A11B7E0, 0x0DEBAEC10FF66, 0x20E9B55840543, 0x0334BF36A56C2, 0x2236008C8AFDE, 0x7E637C356203D, 0x15CD18F5F257E, 0x3E29C2976522A, 0x4ECF17F3B0759, 0x16C53DEB20387, 0x6C0F587DA03A4, 0x15C7CA8A84603, 0x02FF93C4F6F42, 0x2D66B8A514A50, 0x0002BDA495015 } },
+  { { 0x27A386721746D, 0x60EDEAC5BB679, 0x78BFF263E9F8A, 0x56E5994C3038A, 0x4B7C7CC0E10D1, 0x38CF8152E3BD2, 0x3AE229BD553F8, 0x351A2017596E0, 0x7A32B704CBDD8, 0x13C45BB894D70, 0x30A8449C1A777, 0x678B0791506C7, 0x28D5144D1F099, 0x4B777A46075D2, 0x0002FB48D78FC },
+    { 0x326C058559521, 0x6A12024739D25, 0x144722A50EE9A, 0x15D86F64DEF04, 0x6BD7F89EF214D, 0x7E78C7D549111, 0x204BAF61AEB5B, 0x4AC645C4AEDEF, 0x0BA8FB82CC4EC, 0x04EB06F4D040F, 0x11A04CC2CA183, 0x31D89EB7E2A49, 0x69205665F51F0, 0x00D84600A94F2, 0x0001271E61D87 },
+    { 0x2535E0FFDEC77, 0x395FAC93A60E0, 0x34AC1D37B8047, 0x49761DA8D9501, 0x760F3E61CF83F, 0x21A0B291E176C, 0x68EFB7A2937A8, 0x0D3D5A4F67B55, 0x332DC3B7540BE, 0x763104CDAF91C, 0x35BAB0C63198E, 0x5EAFF7BF05D8D, 0x572C602B8A4D8, 0x73A03D24F8628, 0x0003EEE245279 },
+    { 0x5A3B537623031, 0x127DF4033432E, 0x557ACFEB71F1B, 0x1CAC81AE339D1, 0x67BA2919CC32D, 0x79309BD0ACFF2, 0x166A80D322B70, 0x7758213EAC6CA, 0x600979BE44E42, 0x06674C272D314, 0x40DE85560D0CC, 0x0996154DECD0C, 0x45F05B2E7BE2B, 0x20291EE466AAA, 0x00036D31E1006 } },
+  { { 0x3AE6371C55603, 0x28E67598B3B74, 0x12BC864AE0DEF, 0x570AD08453FFF, 0x414C11BDFAA1B, 0x3CA7F32E8C9C2, 0x10D705CCF22E1, 0x7C1F827BC5B62, 0x172992B19736D, 0x476415F5BC962, 0x65F4D8D880B94, 0x5AF40391C16BC, 0x053EAD705A4BC, 0x6BF10ABAA2E06, 0x00026B212B426 },
+    { 0x0CD208D19957D, 0x3AE31AFA4913A, 0x149BC0C88FBA1, 0x36798FC22E9DF, 0x35C14F06534B7, 0x4D0E9CB8562FA, 0x723C37BE45035, 0x52E1E697E97B5, 0x3084584B4412A, 0x36EBF673F42EE, 0x0D0B30F068B5F, 0x51E41A9BFF036, 0x3D58A23A4F590, 0x7C587A6AC7C87, 0x0000639ADB3F9 },
+    { 0x1995975415DA7, 0x6C82E428FFE12, 0x56FE3999F5146, 0x4046AB6410732, 0x3783307903DD2, 0x048DEEDE55468, 0x7B0B129BA17CB, 0x674FF9083E21D, 0x3A01CAD85C102, 0x3CB60CC679A59, 0x17CFB70FE0E17, 0x410BC97D0416A, 0x5B9DF7712E82B, 0x3FF269017858B, 0x0001751E05A5C },
+    { 0x390AAC9E55963, 0x67D759350F6E3, 0x0D04D2EE682DE, 0x3FEB84548690B, 0x3D3F5968F363B, 0x1D8B464D538D5, 0x2C17823BEFA3B, 0x5E58A08F2DF60, 0x62C9E278F7215, 0x0DA3281355098, 0x6136B8F6A04F7, 0x09F74A508DA5F, 0x25A436B5E78EB, 0x4216C59A45A4A, 0x000322921C904 } },
+  { { 0x77B07641B171D, 0x5D6C6957E6992, 0x0968F505DC86D, 0x323B278FDF992, 0x11CD4AA722C6E, 0x083FAD03E4E59, 0x72A979C16AF0A, 0x234D6917692A0, 0x340C0B80BD3F5, 0x11AA7AF99C3B3, 0x6B346BEFA2BCE, 0x225AFB1D9ED1D, 0x67DAC31800DD5, 0x1A8BE22CD118F, 0x0001DC7144B01 },
+    { 0x66B403F418B58, 0x25CE9F3889B29, 0x05272A9C6AFE5, 0x5DBA8338D0DB4, 0x7624157F7D7A9, 0x58B3FDE70312C, 0x3B0128335C4CD, 0x2EF87631A519A, 0x126E6E3313A68, 0x1E728BF34A95F, 0x776B6EBA9A08B, 0x64567AD301002, 0x0AFF3130D584B, 0x5C0D73F321EB2, 0x00013D9C4A2C6 },
+    { 0x0575E1E1F231B, 0x1E9C9A94F8C65, 0x1E7E61BCE2137, 0x0D19D6CC9F0EF, 0x7516FD393EE38, 0x18DA46952CBEE, 0x1DE320C3BB90B, 0x4FA4AEC6D0276, 0x07AD0DCC82004, 0x035D097A5F6DB, 0x3200B0F464C15, 0x4CF7991902712, 0x2DEC49C2FEE1F, 0x4585FF47084CD, 0x000280CE8C8FB },
+    { 0x57713A188D35C, 0x5050C10A36704, 0x0C7B89F97FB89, 0x48FCA29A3FED8, 0x6A2B43F506C07, 0x734A6034F52B3, 0x10D83A17330F9, 0x1F702D7F934E1, 0x489CA2AFDDDAE, 0x001A692591646, 0x2AD96664F85F0, 0x56D15868D8722, 0x2E4A61ED44A4F, 0x3D3F2CA0C8860, 0x0003590BFA2B4 } },
+  { { 0x0A38D157BD402, 0x62587768DE925, 0x2C5BA38D42C7C, 0x120BD2414B5F0, 0x7FB33F2354B6E, 0x6FB1FF87911BF, 0x161B97F5EF00D, 0x6E95C8FAE5036, 0x727249E4D69B4, 0x1E24711E1A2C1, 0x5C0A839B7D5FE, 0x1671A6C55A284, 0x71B4567EFD00B, 0x4064426DDBD57, 0x00048F3781661 },
+    { 0x52AFE8283CCD9, 0x662551FDEEC21, 0x2549CEFA7AFC1, 0x0C648EA058318, 0x68C2D4F1C4429, 0x014B25266B07D, 0x636945A89EA0A, 0x71BD15E6DFD06, 0x3781CA3582478, 0x0F1316B179425, 0x51098320B2273, 0x4BFFFA0D1A6FB, 0x4361EBEF766DA, 0x473337A734067, 0x0001456B57AF4 },
+    { 0x63EA98B923500, 0x075C31A88BDCA, 0x2AFA314AA18B3, 0x27CFDD2F7C253, 0x1DB7E8C9EBD06, 0x647643C95C55B, 0x1E5C8D9175E2E, 0x3001B66AF0E25, 0x3F9B2E371D935, 0x31B39CAB52197, 0x58C8C129D496D, 0x04230B5E0C416, 0x23AFCA24AA595, 0x100431A8CDA86, 0x000396026EBCA },
+    { 0x21880ED0A4057, 0x5E3E3869D8654, 0x7DBD8224D3D84, 0x283D8427B8705, 0x1481F11F65D36, 0x6FC1D335E6F69, 0x169366D53CA95, 0x68B0FEBB81D4E, 0x3A01F922297F9, 0x401CC439A15EA, 0x3DCCD4020E749, 0x6D791C4DB3843, 0x304C89B06A189, 0x51F042B7EB169, 0x0004225BE4150 } },
+  { { 0x41B3B028F19A2, 0x2DE12407EB403, 0x4E5CE328AADAC, 0x00BCCCCF4A030, 0x7F029B53DC059, 0x053A10A646C2D, 0x388936590D3FC, 0x67E5C30E855E0, 0x4DE3941845074, 0x101015C07DF29, 0x5C00F154A0E5F, 0x43156ED3ABEAE, 0x7D2F479FB6D8B, 0x2B909AA27A8EC, 0x0004BC2ADEBC6 },
+    { 0x69A5D8A98595B, 0x0E02CC8801AA6, 0x00440CB6875C2, 0x3D2F39CCD8071, 0x57053FC28223F, 0x3D0972756E215, 0x2F35D8AEC3D72, 0x24155647ED307, 0x7444D84DF936B, 0x33E62B7D9244B, 0x6345098591501, 0x6EE6DC028BDB3, 0x1E91F5ACCFFBB, 0x03D50DD9D16A8, 0x0000D085DAAC3 },
+    { 0x3E84EA488CF2E, 0x19D618B4437E3, 0x352A1438939FD, 0x00E6A2CE4E6CF, 0x651B194CC70F0, 0x19C6D33527794, 0x68F323C2E8FEE, 0x6FE82ABAF64B3, 0x4E673B662A16F, 0x445C014FA60D3, 0x2451AEB9432A1, 0x471766DF17BA2, 0x7290FD4E91488, 0x5D7CC68771885, 0x00034C0937A64 },
+    { 0x1B70230D704FF, 0x17BE8D60FF94A, 0x7B15296C1C413, 0x3C00AF689922E, 0x0F2C41A22B2A0, 0x5A0D69F94AD74, 0x7CC326CD27B20, 0x7B7DF131A55E4, 0x08738B0818FC1, 0x4492F34C89826, 0x2F02E87A86C6B, 0x5338922D420B7, 0x768503BB16163, 0x347CAE7BB2DAB, 0x0004482F799BD } },
+  { { 0x1EEC741FAA257, 0x01F2A7B480D86, 0x6C69E150D1C76, 0x6D593381494EB, 0x030DCDC6EFC84, 0x6220408A81EB3, 0x4DF7536966FD6, 0x4C0F90965DA65, 0x06305401E76B6, 0x4E39BB911013C, 0x33B827D8882AD, 0x46E19E5564AA8, 0x1372CBBE0D83C, 0x707C708934E98, 0x0001D0A50FE3E },
+    { 0x1C8C9B6833759, 0x2E02081594CD6, 0x656D00F2817D1, 0x7650591DFACC0, 0x4AB935D970090, 0x24CDD735A8CD6, 0x5AA060615852E, 0x4284BF2561493, 0x4130CDA996060, 0x76055EADA6E35, 0x5701531BAE204, 0x063BD06351C8B, 0x4C22CF39FBD7D, 0x5EA636A21BC7E, 0x0001D236C053F },
+    { 0x717526B9594F3, 0x2C381CA7F622C, 0x090DBD84436B5, 0x27BE41AD7F838, 0x5A180C9647B5B, 0x4BEF7E54D1009, 0x3160E6E13544E, 0x486E294039568, 0x2CF519426BE6B, 0x633A20F07C441, 0x1AB05B63E7F6E, 0x4EE06F482E63F, 0x621806F8981CB, 0x43832E081C9F0, 0x0004DF6B3680C },
+    { 0x3F31B4FED71F7, 0x5538A032E29B9, 0x2DE96A257117C, 0x7B279EBF5D616, 0x47A11273A61FF, 0x7BF2A71A75C54, 0x7908AEE24D840, 0x4ED03D31E2E68, 0x11D04788FE0CB, 0x055DE6084A7EB, 0x09421D0D49A72, 0x22416F606EA14, 0x53E763A44B77F, 0x7F0683D2F190F, 0x000356EBC95E9 } },
+  { { 0x16D62B338BF8A, 0x51960BD95D87B, 0x48DBFD8E1650A, 0x2341145459DD6, 0x2C5B6C503182C, 0x78822EF96267D, 0x41727DB85F93A, 0x4AE7C9FD6EC77, 0x6BA1E3B6A44DE, 0x39A1DB79BE80E, 0x1E8AC1360BDAC, 0x7057560588C6D, 0x5B0D097ADE537, 0x5F8B71C84ADEF, 0x0000138C493B1 },
+    { 0x18322F3A8056F, 0x57910B662273F, 0x0F2DFE32DA244, 0x67608AA0B2735, 0x141F804EEE096, 0x2C214597D299C, 0x51D7BB7C39A8E, 0x6F00E46C286EB, 0x6C2E3679D586A, 0x64FDE5DF44E21, 0x28718FA49F413, 0x7B9C702295A36, 0x0977F36110E5C, 0x33BC79EEAE747, 0x000123C190504 },
+    { 0x662A5E4C6F4B6, 0x71667BABC20C4, 0x334FDA954BA15, 0x062531EBC41BB, 0x3F60850E79845, 0x4BF174157DEF2, 0x4FB2CF169F00A, 0x1ECDC0F6A620C, 0x28355141DADC7, 0x3C377A735C135, 0x3051FF66D6158, 0x40F76CB86A89E, 0x08837BDA6C81B, 0x66FAEFAC2C79E, 0x0003877920F52 },
+    { 0x1C9BEB35DCF4B, 0x5818C5935EF73, 0x28D948B20D68B, 0x01DE0937CE3BE, 0x643CA7034BFC0, 0x24A42B0BEEF04, 0x5F2B81181DD02, 0x48BE404D73742, 0x6538D09B4F5C2, 0x773EFBA5B05A5, 0x45A39DFC4C09C, 0x77B6CA65096A0, 0x3BFB36FB24036, 0x23B9F8426BE5B, 0x00027B03BE1D5 } },
+  { { 0x79CDFB8F29E72, 0x23373A7EA14E3, 0x3C6F0B055B504, 0x6760DA7364846, 0x1282A9727DD3C, 0x7361E15500E37, 0x553F6E7D9EC9D, 0x399C1C0A76CE9, 0x076486201065E, 0x5F993A5845C0A, 0x5A9886680169D, 0x45736CEC13879, 0x2287D8CF04F96, 0x7B58FB1FBB9E3, 0x00019A37A960A },
+    { 0x6F0458C02C375, 0x367925912C9E5, 0x2F927FFE03864, 0x6C1A31190B27F, 0x1BD416CF457B0, 0x3C564704ED0CD, 0x2CCDBD07F1174, 0x61FBAE0A8FB0E, 0x081F8CA4E3A5D, 0x3897E593B8F11, 0x5A78620CD63B7, 0x03347905A0ECF, 0x56A8A88DD9B81, 0x3745A7D90A1A0, 0x0002BAEEB3F9E },
+    { 0x50C598E88AEC6, 0x09B1CA9C9A656, 0x433EBCA00CBF2, 0x73AB8EFA82D3D, 0x6956BFA0E9C8E, 0x10BF84E80E44A, 0x2A97B0D858A2D, 0x13ABD971A68A7, 0x546381B72A9E2, 0x30E5C2AC00FBB, 0x7A9DD946CA377, 0x4F08E98F7B841, 0x4701292BF6032, 0x2E29202BAEAF2, 0x0001E570586B2 },
+    { 0x783B623B3D5B5, 0x3EFCB61D35A00, 0x23D95E8EF3836, 0x49EC92EDF2E73, 0x55FE1B90C96ED, 0x76AB179B7E09E, 0x39A135D8A8640, 0x61BF4EA714DCA, 0x4B31B4442F1F5, 0x49EB902A4128F, 0x46D60D0B04EF9, 0x7E3AE40F7F834, 0x7552DE37A4667, 0x2B981BCE49599, 0x000309023F996 } },
+  { { 0x325404110219B, 0x64D7B472CB099, 0x774A6BE93E322, 0x3A321ADBE7C29, 0x61B2A6DCAA399, 0x2DD9C5020446C, 0x1AB9A6670D41B, 0x09BAB0A42211B, 0x59784453D186E, 0x1EBB1A13B42F5, 0x6EFBBDE419D6A, 0x0A538BE8D2CD5, 0x6DD04BB3B4CD8, 0x03E9DCE4D054B, 0x00067CF652B15 },
+    { 0x45E58C60533BB, 0x2BAB828106025, 0x20BCFD4578C0D, 0x44F79EAA4EB3C, 0x2928AE9AFAFEE, 0x1B04CACD08BD9, 0x64B1DFFA8F5C0, 0x7FD4F2E5EA0D0, 0x602B1F8B445B2, 0x377BE5EECCA98, 0x2F84A47BBCAEB, 0x3E67E40847047, 0x769418E1056F5, 0x29F0C423339AA, 0x000213D5AB7D8 },
+    { 0x555A918595CB7, 0x7237714AF0F92, 0x20610510180A7, 0x71DCC597EA279, 0x6EC36A2AE241D, 0x2FF0C22B8F53C, 0x71A3DFCC4551C, 0x49C22AFD854B9, 0x1ED1ADE365CF7, 0x319E73C4709A3, 0x10B7DED3830BE, 0x2107264574024, 0x3794942482D20, 0x4B9A2647D87B6, 0x0003E150581DF },
+    { 0x3D6D8E4512E47, 0x490EBEE850120, 0x25C81CE37C9C1, 0x64D6757B42FA7, 0x1CDAEBE7E8D87, 0x4E659AF9E8BA9, 0x0CFDC662FD949, 0x47BA3790C2F5F, 0x54D9EDC163435, 0x3D35569F7C4DF, 0x04E8B69AAB927, 0x48DB748521047, 0x3FFD1A052A51F, 0x60E9DC07E83D1, 0x00028D4C15CE5 } },
+  { { 0x5FA3152C5EF39, 0x396247F751534, 0x0F37790938B48, 0x790CF0C2ED5BD, 0x359AA7FC21509, 0x424FD010B7E7D, 0x38A4443B92832, 0x63A0BB4580BA9, 0x185745FC5E27D, 0x7B25E65848F5F, 0x304F46979151F, 0x6DE7B1073C867, 0x77FA7011497F4, 0x1B6B753477740, 0x00057B640540E },
+    { 0x0635802926F8F, 0x703BBC7441C7D, 0x77FD159E44D72, 0x222B9EF9A4301, 0x2385880B8650C, 0x7911C97827640, 0x607E0BA4DB254, 0x292A4B3ABDF31, 0x5CFF538A39C73, 0x4DD329BDE83EB, 0x43DCB250CB9C1, 0x314D4C3A3B849, 0x2D1456A6251E3, 0x43B165FE876C7, 0x00027709A71FC },
+    { 0x4570E790CF8CB, 0x7FBA301E5B9AF, 0x7BD24954B8EA8, 0x72D0B01C7206F, 0x765F88FCD2DE2, 0x2B22671B2F7ED, 0x74089D694ACA1, 0x2366FA2DF323D, 0x0EC8DD23E4EB6, 0x7690169E610E3, 0x47BA2691CDB10, 0x65AC98FD04074, 0x0E5CEB1D56EFE, 0x5C5A3CAADD409, 0x0003E54169380 },
+    { 0x1D6699F7BAD99, 0x7F8FBD091FFB1, 0x0FA447CA098BD, 0x778102B6B23DF, 0x0D33019D19768, 0x3A3D3E07B65C0, 0x7C071B1EB5367, 0x063EF36D5E2E4, 0x74FB3D2B4E3A6, 0x796202B8B0DAB, 0x5DC26C12253E5, 0x2A0CC106893CE, 0x0DB9C00E0F0D3, 0x1BE79194EDA47, 0x0002B582676A3 } },
+  { { 0x60C91DD9BF089, 0x036D9BC65BB3B, 0x17DD85F528D49, 0x5CC11FB56F3A5, 0x64B2592604B10, 0x50A69992DC5EB, 0x00CCB54BE2481, 0x6EF7AA773B90B, 0x1799796AFA333, 0x498C15067BD64, 0x45648386371DC, 0x4D8A4D3100B67, 0x3C2EA8DAFCFF2, 0x0CE4C9A1BDB80, 0x0002C10DEEFED },
+    { 0x52A7F3A3FC88F, 0x19C9B8DF13F98, 0x3C32B02825F67, 0x4EF699963D963, 0x112F1016E0DD8, 0x058BB501E3970, 0x6599FB1A2F516, 0x3D77FC9795088, 0x5CC482C5E054E, 0x135CE7C1E42CD, 0x7968ACEC7D383, 0x355E92218B59B, 0x2ED85525F4B43, 0x7CCFD4BBB25F6, 0x00019D52EBE8A },
+    { 0x682778B8D0A61, 0x2442C83D3174E, 0x7326D8EE05065, 0x77FCD0A055BC9, 0x4A4BCE06B7896, 0x707AF6047BA4C, 0x617DA73371E89, 0x65216D67BB0F3, 0x738743758759B, 0x79B32F072993B, 0x007425AB70987, 0x6205E07916D0D, 0x6B41B3B08F3D3, 0x75E8B0A0CF9D6, 0x00038D76ADDBA },
+    { 0x52560F3A00B63, 0x22EFF1DDB4D08, 0x3A1F5D231CC0E, 0x7455F0CF5D05D, 0x4F117630CF0E9, 0x44FDB505B5313, 0x66623565668BD, 0x00B01B7C8E8D9, 0x1566C97981F1E, 0x161D08962E155, 0x226E6BA2D399E, 0x56A80D288AE9E, 0x7E3CF2E8907DA, 0x6D5CCE4DEAB1F, 0x0001E7E34A303 } },
+  { { 0x6D3191FD32012, 0x591D255FA2C68, 0x50FE83092B874, 0x57ADD941EB015, 0x23E63FFDBF3A7, 0x12423BA359BE9, 0x1D46BDFFA90E2, 0x41B25DBF80B43, 0x015C3C6EBC27D, 0x03094C0950812, 0x77851B592E11B, 0x4F460D936CB2D, 0x4C238EA028A0F, 0x1F1ADFB8025DC, 0x00042B7AA3161 },
+    { 0x35CB5D712657F, 0x28E34C51B3FB5, 0x3112AA7E412D5, 0x4AAE789DAF3C4, 0x783AD047D656E, 0x70B30829F6D58, 0x69D4EF05E3F2A, 0x7E2D9B7F57FCD, 0x4C3DB727CB2C1, 0x30865846D0EAA, 0x512589A31CC7E, 0x267A97AB07121, 0x1C448A7916CAD, 0x242FD484584A6, 0x0001CF16402B2 },
+    { 0x68734B522801C, 0x388C7B67BF3C1, 0x1C4855A557CF6, 0x3F080725E7D6F, 0x40780A5AB4BE6, 0x7F805A0785136, 0x53F8F8028DB41, 0x4146BA9F8C43E, 0x27A843004CCB2, 0x6645519183C51, 0x6DEA9097884FF, 0x013B8A57CB03B, 0x6F715E47A67CB, 0x6712664620BAD, 0x00062D7F8B7B6 },
+    { 0x3BB5ED707AA1D, 0x4E56A498992C7, 0x76A82E5A30CD6, 0x474D7EDB3FA9A, 0x100AD6C7430C0, 0x5953E96FDA674, 0x7C7A97E8D19C0, 0x4DA299B4CD49E, 0x0AF48E9A0DC9E, 0x1D804EC0696C2, 0x728439A5D42AF, 0x793D87103449F, 0x6D1943C723E20, 0x337097B2F330E, 0x0002AAE95020D } },
+  { { 0x434B28AC03AA9, 0x2068725EC44EC, 0x57F63BE93C40D, 0x1C432CAD3A9CC, 0x64DE25D04C226, 0x385264C002FF8, 0x28F368CF0356B, 0x2A285F0D34E95, 0x62727A6C2DA7B, 0x36591F8E100D9, 0x1F0CABF0C09B9, 0x337BA34893C40, 0x0EC76C2E23220, 0x01367CC6366C2, 0x0005C6EC1B36F },
+    { 0x1DEB7C4301563, 0x16929D3598CC1, 0x2A174B1A7BB18, 0x0E7A32C7D7A4B, 0x552EE1D14A81B, 0x1501B032C4A37, 0x0E5E7A9A6A8F5, 0x20861E53A7823, 0x529A20EAF1B73, 0x06B6373E3CD9E, 0x34BAD6CD7612B, 0x4E94ADC39C23D, 0x04286C7FE5BAC, 0x77CE00080F8AD, 0x0001C35A46100 },
+    { 0x11D9E4E55FA27, 0x3042B3F944233, 0x77FE572647E4C, 0x155267A279155, 0x592247F18D7E0, 0x4BA8876457ED1, 0x00BD8267E84BB, 0x22F21F8440B09, 0x57FD4539EAF6B, 0x7FC926AC7A199, 0x0ED003C5EE841, 0x024420DF011DE, 0x640249B368451, 0x471E4B40269A1, 0x0002DACBD9318 },
+    { 0x6459AF699242F, 0x424987DE1B452, 0x12AD5DA6FB831, 0x5B48B4D810649, 0x1FF34F8D27306, 0x51A16867E03E4, 0x760599D928A02, 0x10CCD05A850FD, 0x358FCE5057ED9, 0x019345C3AAFE9, 0x1396344A770AD, 0x1E689A8C6F7E8, 0x5792FC89E1323, 0x1DE7970F09AB7, 0x00027141E1E10 } },
+  { { 0x30B185AF0460B, 0x097A849129834, 0x2E03252D24FBA, 0x11B7282F0923F, 0x2F457B4B6E439, 0x46818026AFB78, 0x705791949ED6B, 0x4F32204B987E3, 0x053F3822EFCDD, 0x28AB1775AAC0A, 0x13F564023044D, 0x1A01313BA2EA5, 0x1E58EB867A331, 0x724F9CC57CD23, 0x0005707102F3A },
+    { 0x33558ED3DF16E, 0x0B07D527B64E8, 0x07CB2514DD134, 0x3B752B465B9A6, 0x4EFC99C934B91, 0x37EC93AD90D07, 0x27A1E7FB85C4E, 0x1835FAA01D8F3, 0x33130A0E19BBA, 0x0932EBFCD1D66, 0x7ACB2BCF6C172, 0x40419BE606E66, 0x252558F9CF912, 0x05C2E9B6CA329, 0x0002F06F11E55 },
+    { 0x6018A74A7F9A7, 0x22A92BA2EDD75, 0x44763878D09B2, 0x44018FD11FC2F, 0x557E691EDCC52, 0x0843C6851CBF3, 0x55C7E78286E9E, 0x5BFAFCFE293B8, 0x4DEB3548FD501, 0x461BB247D3553, 0x26531ECE5E761, 0x62DF06D58982E, 0x26E5B0A1ECBE2, 0x4F050C3CDC8B9, 0x00039CC23B611 },
+    { 0x29197AF7283F0, 0x0D85E4F5044F9, 0x3B07E05C1E8A8, 0x4EEA94CC735F7, 0x4C145FF82BAB3, 0x77E789EDF9716, 0x4EE84AEF431B4, 0x4F7D1FC3D5CAB, 0x09BE17C078817, 0x1C4E4E652D6A5, 0x2C65673231DA3, 0x5F37B86AE6353, 0x421749E97FF51, 0x2B3C6D7B12146, 0x00030B1493192 } },
+  { { 0x199145D6D46C7, 0x28058BAFD1674, 0x601AD7E80DF0F, 0x4A0C660815038, 0x1C38C1B88DBC6, 0x6FC6A2DCB1DC1, 0x3780F9B89CFC2, 0x6DD97BD014DF2, 0x09B29DA249CE8, 0x59284CA6F9C45, 0x32D8A1DD37131, 0x171BA06952C49, 0x00B9CEEDDD44F, 0x04B306F248BC5, 0x000096AD90D64 },
+    { 0x5FED8C35D3DC9, 0x30408BA4B2614, 0x50E1E2B894ECA, 0x455E0D8F7A03A, 0x01701028C27D3, 0x25750D5FAB095, 0x0588FAE4295C1, 0x12CF7914B2F85, 0x3C110D679C04F, 0x1CB225EB17DF2, 0x5FD669F0813CC, 0x761E35455568F, 0x7E70EE504B83B, 0x79BDEABAD1762, 0x0002C6C3F70D9 },
+    { 0x4EFA1D1CE8A35, 0x2BB1DFA00D09C, 0x5465522B40198, 0x1E844B27B1412, 0x17467E836DBD5, 0x38FABC60DE596, 0x0280F7F9502B0, 0x3630CB1CCBC75, 0x27EA406E5B502, 0x24C17193C92F9, 0x35D7BB9C26353, 0x63180B385F76D, 0x44834FB698568, 0x3AD366A3C71E9, 0x00034D52CD3CB },
+    { 0x0D2BE396C348F, 0x5CC553851EA72, 0x2418DCE7FF3A4, 0x6C6CDE5BB025B, 0x2CCF3A9455AA5, 0x5B2062C278B75, 0x50420D4B9C995, 0x6334A8B60F72F, 0x4318911174EFF, 0x511A881579895, 0x513A32F086D10, 0x6C8245A0633E3, 0x032D1814F9B36, 0x0941F4CC693B0, 0x0003C6195FF1D } },
+  { { 0x3B641C5E56AE9, 0x179D68D203AE6, 0x21C0192F1E483, 0x27303C0A73FDC, 0x48E8D04740287, 0x02A2FB62C19EC, 0x540A4F30720EB, 0x53D3021D2B682, 0x12A5838556018, 0x0EA9D582B103E, 0x643FB5F5E616B, 0x4C685D67BDAEA, 0x0AA97CF32E570, 0x2FC0C74DA83C0, 0x0006175DF7DCD },
+    { 0x584E10377E8D2, 0x0AFA3ADDB27B9, 0x4F53AF287D49A, 0x1BE24C7C7C7D7, 0x140D6D92E8543, 0x0ECD4B654C133, 0x5B58EDCA1EF04, 0x1FC3410475B5A, 0x27121CFB19CC3, 0x3BCCE87F362ED, 0x1083A59E9BAC2, 0x29A84D0C48B46, 0x75E4D629190AC, 0x2D20FDCE63F50, 0x0000CA042348A },
+    { 0x086C695E46E6B, 0x796229CDBEC5C, 0x38C06FC9CD1A6, 0x30815B1ACA088, 0x7BF91539B5806, 0x03C13A751A4A9, 0x704E6BE3BC2DD, 0x2C1D077E9565D, 0x2AB0344DDB08F, 0x4676C28EA3C04, 0x750A26EA7C0CE, 0x30ED97D493F7A, 0x16EAFE8A0EB0A, 0x0D24CBEF367D3, 0x0003BC04D00DB },
+    { 0x082791CC29B36, 0x6E3F6477ECB48, 0x12A914E4D7314, 0x5312EC8867D31, 0x78C897C80ED59, 0x54752D279B0BD, 0x6EB3F06C6CFD6, 0x7CDFF05E8A81F, 0x79BE28C1B9B86, 0x4A78DD22B09C9, 0x7695AAA76C23C, 0x2651FACD64B06, 0x25A1017F5C9D7, 0x0D68D239AD318, 0x0003B11FDD7EF } },
+  { { 0x7BA8A86F7B753, 0x08523E9CD5930, 0x0637B48F02FCD, 0x39EBA7F197334, 0x661115970BF24, 0x1616E97867917, 0x49C19A66B0708, 0x3B100C2D2CAD7, 0x37138152FACFD, 0x53E8429A9D3FA, 0x49F543F903CFC, 0x14A5357ABF214, 0x137B705BD15CF, 0x5ADBE77D5334D, 0x000325EDC3F17 },
+    { 0x6708A16507E53, 0x0D139B0431B97, 0x3134C42F4D35C, 0x686B482DAC044, 0x4177419FFDDA7, 0x45317AACF3BC9, 0x21F5387B2A31E, 0x220BA2E4205BC, 0x7C5E37A94B7D6, 0x2C33707E8B7FB, 0x0C4F434802B96, 0x4FFC6A2288863, 0x31C6571828BC6, 0x3DE71EFC229E6, 0x0000444A7B223 },
+    { 0x7380F5800B313, 0x4D0D9A2EFD5D5, 0x538A3E4345377, 0x70E3D03427F99, 0x605304705A50D, 0x12265355C0B9B, 0x055A169F7DE29, 0x7F311D50EE84A, 0x514104E2BC937, 0x78F20CD17F44B, 0x07811439DD22F, 0x1AAD3763BBE76, 0x6A0DC4DF6D6FC, 0x3FB00C755B388, 0x000118FBC9B66 },
+    { 0x11886A22FBB13, 0x3F4789D8C8DC1, 0x6F7499967D290, 0x616BBCD785EE9, 0x722C89B4F1307, 0x6C0F1EB792718, 0x1DC069627F2B5, 0x7BC6B24D8164C, 0x3A3904CBD662D, 0x71DC82D1294EB, 0x1CC463428B641, 0x0E38839AFAA95, 0x1F933847B08E7, 0x442752ABB343E, 0x0003836EE8631 } },
+  { { 0x5F953CD0726F6, 0x502DFD2FF847E, 0x5559FBAFCA62D, 0x6C2C995541C9E, 0x213A493B6701E, 0x2BA79320A48E7, 0x7753E3C478C36, 0x061A8F5D03AC8, 0x10E4E24EAF5FB, 0x6B6B934D421C8, 0x47417830D3671, 0x67C8E1904A7B3, 0x63D3677FA7509, 0x6E597C84852C7, 0x0003665B98560 },
+    { 0x21A6F536E2F04, 0x62D35DB121C57, 0x3F689EEDF2F40, 0x2C2C74A1E33E3, 0x4B0CA44E5877E, 0x6A91EA7F4B6BF, 0x58F2D7992A5C5, 0x04069F8A12B7E, 0x7E128F9906844, 0x1C2B8813B209E, 0x6EDC95DEDAA76, 0x7B0DD7A9C74F4, 0x110AE456A1E47, 0x5E6F25222B3B8, 0x0002052D727CB },
+    { 0x110295FE33062, 0x1DE67227236E8, 0x3ED1F4159EF00, 0x53BCFF26E784F, 0x3C186DDD7265A, 0x065F5654BA324, 0x5E6E3C2D86DBF, 0x53C51A4A81137, 0x1DAB2E5E21296, 0x6D29E847E4FC0, 0x7C349B49312C6, 0x1F71D9C5387B3, 0x2A5D128494BAD, 0x2B76B723C3267, 0x0005CB62A582E },
+    { 0x5BF71FB919088, 0x598732B87DD57, 0x18E66721DFBB6, 0x4A02265F7C019, 0x292D7CE968619, 0x0A7B228BFC978, 0x252859BDAF2A8, 0x2DC264A3E8BF7, 0x5FC3B77D5A4BA, 0x6B8E603C2C849, 0x68B6BCF8A18BB, 0x1E81C0681DEE4, 0x3D858B8A865FD, 0x0EBC04511FB0D, 0x000320A0C2184 } },
+  { { 0x4A18FE0B99A47, 0x424B3FB61AC48, 0x27C24351014AF, 0x0E21B42785E07, 0x516FF407D95AD, 0x2DA87F3388086, 0x7DC81F50643E2, 0x568BCA274C84F, 0x505F1582079BB, 0x1CBA7412E4B86, 0x3A68838B6CB1A, 0x6CD504434C7BF, 0x6F0B96E79931D, 0x7FC88B10AFA0A, 0x00030E7BE1038 },
+    { 0x5185F202CD681, 0x6A9D0C87C14FF, 0x3C2B068EAAF25, 0x1CF21AF9E80B3, 0x4A32141C753CF, 0x6A7F680A964F8, 0x442E0D85D9BAC, 0x3573600FA8053, 0x6A717B8549967, 0x33FC3369454A6, 0x2050B30A00C0F, 0x5FAE54F12C22E, 0x5374B23A4E3C2, 0x64A0892247A59, 0x00019CDAAE746 },
+    { 0x7D8230C51D1DF, 0x6BB15B67F29F5, 0x577A705052F2E, 0x2992F26B688B8, 0x3B6639658AE7C, 0x71887C4457101, 0x0B9343967C655, 0x23CE01F7F024B, 0x336834FCA493F, 0x0F94D5A0B1D03, 0x023213E077187, 0x5C26D90AEABF9, 0x3C5B7D550A2AB, 0x3C52EBA48534C, 0x00039BE0704A7 },
+    { 0x56EC611224A5D, 0x43A97F6348D52, 0x6A8AF2992EA6A, 0x747E50AA85B3D, 0x54AE966E67B22, 0x28B2C239232CE, 0x62BFE3FF6E4A0, 0x1ABC3012FBF42, 0x6A3039A4A3328, 0x483F61FDF2C23, 0x33C3ADBCE1DA8, 0x44E9A378DF9D1, 0x0B975E829FB57, 0x70C07DB21D852, 0x00023A1F38AD5 } },
+  { { 0x2B62D2BF3AA13, 0x3916DB28AEB2A, 0x5B33A66DE4E74, 0x65875121B2513, 0x579A73AC58AB5, 0x14AA03ADCC69C, 0x0BFBE309DEE4B, 0x30BA95252C4DA, 0x751EC892AFDD5, 0x7F81A8FDCF045, 0x6464D99321345, 0x17CC57695DA7B, 0x74D09FB109CC4, 0x53086048593FF, 0x00020B35B601B },
+    { 0x64C61D11E8449, 0x22965867EAA04, 0x1A262E0C85EA2, 0x218B3F243EFB0, 0x6B007BC79DA01, 0x5EBF54A8FF8CB, 0x14D1F2C4E2DE7, 0x135BE0482D46F, 0x361C8FF7D3A3A, 0x0B03FF65CD724, 0x6B2E941100C2E, 0x1C4B2FFA1E800, 0x403E2432023BB, 0x7BCE3C65FBB0A, 0x00019E8B29E51 },
+    { 0x004163BABEB67, 0x70C0850012B4E, 0x30A84984095C3, 0x5DD1EA8C21D73, 0x2C8B46E5AC76D, 0x39F798CA3F1A9, 0x2CE4EC1B7096D, 0x68A6F076403F4, 0x58545D1FC3060, 0x31DFD3175A357, 0x0A560306DE7DF, 0x5D39CCA608983, 0x0C0BE0C20D9D7, 0x3BE028B4F9A59, 0x0004A6997042D },
+    { 0x5F24788CD5E31, 0x3A92F41FD4071, 0x414A3DF110BD0, 0x2C469B870F633, 0x48C9F91E8BAD2, 0x7E11AAE2BC93C, 0x18AA2F30F8D3B, 0x3B76A40E379B7, 0x6222E26B739AE, 0x18AAB76249F96, 0x29286EB67F0F9, 0x6254AC76D7CD8, 0x3D84FB3103DB8, 0x22F6AB627A8CB, 0x0002BF9C4451A } },
+  { { 0x66232FD3880C3, 0x210278C675BE0, 0x54F552557A25D, 0x2ACB6A79A0D30, 0x2128710F68B47, 0x33C7DAFC23C2D, 0x1E5482876DD2C, 0x25BF123A98A5B, 0x2C43AF76C8F2C, 0x7188BC8E5971A, 0x6562294D13B74, 0x67535897245CE, 0x5D0629B28BD2A, 0x079BD189D8978, 0x0002366386ABF },
+    { 0x24B187B1A9654, 0x463BEAD134059, 0x7C81AD39524C6, 0x7A3A1B2D387CE, 0x73312D5A1A5BB, 0x1D16490B5B5D9, 0x057423005B0C3, 0x698DEB56E4C15, 0x2456ED696FCF0, 0x157C52C6582E8, 0x775E8FBBD91A0, 0x3BE92F49E7352, 0x26457EA0448C1, 0x7D2512F0A42D0, 0x0002CF08C3020 },
+    { 0x596B5636D1A35, 0x2EC07CCEE3C7D, 0x4D38E9209A9D2, 0x21D9B768A4A18, 0x3FB987D12C98D, 0x14F58556C12FF, 0x47D7BA93578C0, 0x35FDD7A31AFC4, 0x3D62F8E36709C, 0x2948BA819419C, 0x3257C124A5777, 0x50720C268B0D6, 0x209877F46C0A1, 0x2C393D4DA1BBF, 0x0003A35F2E548 },
+    { 0x5746E620238E0, 0x4B2E244E9BE1C, 0x3B955081CDF58, 0x2A3A9AF8CC99A, 0x0A0560936871B, 0x410F7867DF8F8, 0x21AEF1F056931, 0x3BEED3ACA3C5E, 0x539C31C5D9483, 0x7B9043593F1BF, 0x2B07AB17804EE, 0x5CDCAC2404E08, 0x0059990F14A67, 0x1660DF569B02A, 0x000340F282E03 } },
+  { { 0x128BC5602FB45, 0x51532859A68F3, 0x788A5C8BF2617, 0x15B9E70ED93D6, 0x0F2B3AE751C32, 0x4C9A6A2999702, 0x62E5AA4D40858, 0x30D80F31D6BB5, 0x5C1A136E99E60, 0x1DC3612310F9E, 0x717702C30C25F, 0x7AA5F0F5D9AA5, 0x18626C2343A65, 0x1DC97D6CB8711, 0x00019471BD341 },
+    { 0x3154992E47DAF, 0x01568ABC5EB31, 0x70134236CF763, 0x29634922E3BEF, 0x01BACAE927236, 0x6DDA14D4B4C3B, 0x6701ACDB7DB33, 0x31C9622CE1666, 0x4DB09D30F64F2, 0x18C8C3A4824A0, 0x53420ED58B428, 0x0B291C84CBA75, 0x0BC46C7BBAA0A, 0x5F21CDA794F90, 0x0002DAFCB08B7 },
+    { 0x0141A8A621933, 0x7528552D511B1, 0x2F5DFF1F3AB36, 0x2753CDFF5AC60, 0x6BFA9F712C9CB, 0x10BB89D520946, 0x3EE9F0C989C35, 0x2452CBCB37176, 0x557A36F5C12B6, 0x1FF698AE4D66C, 0x769654275375A, 0x1ECF8E431F49B, 0x017F0C85FD5D3, 0x37F6E2EB41BBE, 0x000208BFB2B17 },
+    { 0x0591610C70BE3, 0x16378B2F35D01, 0x2D77AEDBB0092, 0x0430B33FF3D21, 0x380BF69B28201, 0x5ACAB8940A590, 0x59EAD0F13EDAC, 0x6841EEC117B33, 0x6C276B06F14B2, 0x3D2FFB13AFE04, 0x4BCF6E4F0BCB9, 0x45CAB7958DE82, 0x2C7253D8D5D36, 0x76DA299A6FF94, 0x0003369BA2D9F } },
+  { { 0x7C92CEBB8C6F0, 0x08941EA013A88, 0x1B679B6AA1A72, 0x24021F881921A, 0x14E0A08D6E8E3, 0x130FEB63360A9, 0x5A637A0FE4C20, 0x4E2579688552F, 0x645FE29138279, 0x250B6BFD5E7A7, 0x72023B67499F6, 0x7BF5C0DD1C8D3, 0x642C319279C3F, 0x6542CBFB2A008, 0x0005164193296 },
+    { 0x62524F3BE0883, 0x18569E0EC002A, 0x7869667DAFFE2, 0x124A5CD33ED3E, 0x2C67040921D6E, 0x5C1EEC4A5D227, 0x5CF83B731502B, 0x6E9252CF2278C, 0x76D921259B898, 0x3E807CAE9A50B, 0x5FA18C3CD0CE9, 0x3F3C498BF9D48, 0x64F31814959EB, 0x26E619FD88B3D, 0x0000D312BEBCB },
+    { 0x74AA3A52D0C2A, 0x4A67623A4D5DD, 0x6664EA849D8F4, 0x06975791BD374, 0x613F66F4B7B2C, 0x7248F7A531CBA, 0x6248B0BDB8D54, 0x7323677158795, 0x26CEB4A499C42, 0x52071825F7C9F, 0x26E12A4BE5EAE, 0x1712CF28CED50, 0x1E32000B14699, 0x02B86479F0425, 0x0003C3AD84237 },
+    { 0x2268B0A98246B, 0x6EA178D9A81D9, 0x44140CAA269D4, 0x05B684689E91A, 0x5C269DC4F935C, 0x1630EF760784B, 0x3544FC534AA11, 0x7029C1496B54F, 0x0889F9750078C, 0x242D5C632451F, 0x142D9C241155F, 0x2BE0C643A4557, 0x5C9CEA9088E1A, 0x333C4929CCA20, 0x000382E1D52BA } },
+  { { 0x7903E13846722, 0x15DAAB9E412C6, 0x5E54B84FBAEC5, 0x3943B7C1A4383, 0x2C38FD33DF3EE, 0x7411B4B2425DA, 0x3D36148EF771F, 0x4A687CC0F3D2C, 0x3B7D90C095065, 0x2A076A01887B4, 0x5826D29D3046C, 0x562FD7D1AC476, 0x6B7F2A65E5305, 0x65726208851A5, 0x000496B4D177A },
+    { 0x472EBEA8BEEB1, 0x2649F2A7D970F, 0x517045F7D3703, 0x56DEF262A293B, 0x38AEA6E419712, 0x16913E26F0AF1, 0x252A6B4FDD3F6, 0x7A65CC7AAAB9A, 0x09E2769284946, 0x49F9089368A1C, 0x2EA01183FA065, 0x1F9B2A3505457, 0x4480DC53BB0DC, 0x7AE4E9778CC09, 0x0001325C0FB03 },
+    { 0x6A5B98C86BEF2, 0x05C7A22956E07, 0x31BC339D2E724, 0x39EA54BC57CB1, 0x7792AC3EC4B11, 0x3125D3BE19FFF, 0x492017204E9C2, 0x7B46125FC0A2A, 0x22FDB44EFCB5E, 0x45B442CF09430, 0x08990608A6E8B, 0x4BA1AF2E37A71, 0x52D25AE5685A2, 0x78A72D4B9E176, 0x0001B7A70E84B },
+    { 0x5CCF2C8F420F9, 0x37D96B7DE04B2, 0x71307D46BC4BC, 0x035E16C890318, 0x5FA55DE276719, 0x2DC029A3B7702, 0x692F7E2A54EDE, 0x45418D539D027, 0x7C5F58BE7E51C, 0x0C1DBBF6C184A, 0x430F967E2202E, 0x74305F3C81140, 0x139F10C6C0D9F, 0x68DBD3741C749, 0x00038028E440C } },
+  { { 0x37F6F6A1828E3, 0x14FBC93C4287B, 0x664D527CFDBB8, 0x6011A6025B60C, 0x5C409FE65BD39, 0x64E8E7CCD750D, 0x73BBE70636B8D, 0x0382456F0F5CF, 0x652208638501F, 0x5BC096338EAC1, 0x53F2109A6922B, 0x7134EE3354085, 0x3EAB239BBA8E0, 0x3B9212EA2F49F, 0x0000830848D0B },
+    { 0x3AA51958B2CA4, 0x045077C49C7A5, 0x7188432495C3F, 0x149B24C6B050B, 0x5F4FE83B60C81, 0x72536BE93BE29, 0x1D7E72549334D, 0x01284DD98B8DF, 0x5EAB3C29DFF5E, 0x3E65C237AD240, 0x4E38B09E89A18, 0x2092D2BD0EE48, 0x68EE82D54FD20, 0x206EE8D6386A8, 0x000166E675223 },
+    { 0x71C83ADEC3AD7, 0x1FB20A1DB8EE0, 0x7B8B40818CA26, 0x6730798AD30E8, 0x0436675B73327, 0x2DEB4EE8EFB81, 0x58BC9DBF0BA72, 0x46F5067249077, 0x299611E1188A0, 0x31A0B482BC48D, 0x0759B18CAEA23, 0x2D463B8C68AD9, 0x57875EDB988BA, 0x6F820A613029F, 0x00039D89166E7 },
+    { 0x4B548B159801A, 0x3C9C9303AD771, 0x4FC28CEAC0785, 0x14D52A22836A8, 0x0D660BD1F8385, 0x76FD2D37AAFBF, 0x4869991FC7C96, 0x2030B0D5C8B1E, 0x24FC75C7FA67C, 0x5FA3725178ECB, 0x482CCAB45D114, 0x5E8685FF071B9, 0x666C42CB6B133, 0x3C08337BC994F, 0x000403E129056 } },
+  { { 0x1EA97E722A503, 0x448EE22C4B3B3, 0x62AB3635AFDC7, 0x48375AB8394B8, 0x440BC33255308, 0x2A255D407489C, 0x12505A8F43D70, 0x69CD8D692407F, 0x2BD2D6512FCA0, 0x7E0278BE819B7, 0x15F177E3C91A5, 0x4C4D404E03781, 0x355B83C5DCE87, 0x3D3BF6767DF00, 0x00062A2053C45 },
+    { 0x543FCC5AC547A, 0x085AC61B808A1, 0x6B3565C23AAE7, 0x2F8B6F08B03DA, 0x57D737E82950F, 0x427AF09967232, 0x52D53F45B620D, 0x569A9AC4668AC, 0x63FC42C0243C9, 0x110F3E38D4C17, 0x221DB49CBE393, 0x184FEEE472B14, 0x1339D8748D9D3, 0x4BDBD024F312A, 0x0000FA8EE73D4 },
+    { 0x37591654475A1, 0x6F36A7145301A, 0x604EEF73C035E, 0x69C3301597AB4, 0x2C3B7E166D983, 0x6BEEF17652E43, 0x75E107B8FDD3C, 0x4B5845550C025, 0x479C2EA396283, 0x4358D87244D7D, 0x17396526943D7, 0x007B8E7F5CFF9, 0x667EF1DCF14B3, 0x65298721654F9, 0x000341E3E9957 },
+    { 0x41FF2EA7B0CE0, 0x1A086005E93B3, 0x6CAC853771263, 0x7D2EED9C3D8D9, 0x0908758951617, 0x70E733AD7C355, 0x6EE1CAFAB5B92, 0x2E0424DE6E2E8, 0x48E5367690FB1, 0x4F66E42AF9777, 0x7DBB0B93298B8, 0x0CD22BBD9F1D9, 0x47CCA08D150F0, 0x0DBBDF7BE6EE0, 0x0002E26E5B467 } },
+  { { 0x304140ED2A123, 0x5D4E108C1080A, 0x029380F85CC1D, 0x23872A7141BBA, 0x5ED03DBE84500, 0x431AA9DDAEF7A, 0x457FA61DF126C, 0x42E765C45BFB5, 0x58109CFBA5CC9, 0x1E2041F86FE07, 0x156A75AF1377B, 0x1CD906CFFBAE9, 0x39CB69B74DF36, 0x77D7695128082, 0x0003C3EDD8E29 },
+    { 0x712AAEFBC2806, 0x12EB7D526B262, 0x7CD9EE7B15144, 0x57320FC56316F, 0x70A7ED8F0310F, 0x6829BBCA4191C, 0x7AD4E9DB3E617, 0x547FB1A56A318, 0x0E5DA02AF9678, 0x131CB15899086, 0x6E78A991CB3D6, 0x056727F2DBD0E, 0x4DC37F9AA8351, 0x346D971576608, 0x0001274CF8BD3 },
+    { 0x4CAA56FF7017D, 0x28FE3CF9F9F4D, 0x2937278532335, 0x7C70DA297A705, 0x3CF3089737F8B, 0x1D94FC7B74EFB, 0x617BAA790CCE6, 0x4D44F339B2958, 0x1D9FFB9FEAFC7, 0x33839170D0F55, 0x68424FFBDC8D8, 0x5B530578AF8BB, 0x0A0EC78147479, 0x4CDE5CF8A4F73, 0x0001A3907D622 },
+    { 0x7E093DAD49B2A, 0x0366C33E6BD7A, 0x69AA43DEA6307, 0x3F149DEE47ADA, 0x26273DAEAA8CC, 0x1207A7BDF1203, 0x0F554F7C99E8E, 0x3D9C8632F8239, 0x77ABCCEFAB496, 0x54CC227E08D3F, 0x6C43A534543FA, 0x1D112DD1EE89F, 0x3E374F47FDCA0, 0x464E23C83D893, 0x00029B4CA9EBD } },
+  { { 0x4E90FCC15C54A, 0x1E6FFDC4416D7, 0x2D95F533EF880, 0x5ADA51879DA2F, 0x10F7A0EE738AD, 0x552B98C80B2D6, 0x0D227BB7BA63A, 0x4A0386C07C7AA, 0x47BDA13AD80A5, 0x5A3FF64F975EE, 0x1775D013D98E0, 0x5533B4A2ECDA5, 0x294F9822FD830, 0x785D39965A8FB, 0x000639A9C0725 },
+    { 0x44EAC47137FE3, 0x00D7E02C396F2, 0x474E8CD0D733A, 0x2BFA767F2C4DE, 0x1EDDEF3CABDCF, 0x502497380CED2, 0x3611E1B115D88, 0x42ABE6FFC638C, 0x06C28737B9FC3, 0x4D3AEBB079F2F, 0x27B50E26164EA, 0x00A06D9856E48, 0x02FD1AA4DE74E, 0x1586E1C1D2240, 0x0001AB7A91627 },
+    { 0x38DF14EEF9A5E, 0x6BAEF3E43827B, 0x7A2C1385BD66D, 0x3C6BD33BF5A1D, 0x19CEDF0B60BDB, 0x3A05115740B0D, 0x654D234002F49, 0x41D3B0B3EFCE8, 0x796D6F224F8C9, 0x21A40BF029283, 0x4CBD3A7489FBC, 0x676B61B2C4ABE, 0x398F78305599C, 0x53AACF96EFC47, 0x00034F0B2E54B },
+    { 0x24900A535458F, 0x3050BCCD3B797, 0x335CFA1F66ACD, 0x69A6D8A9B3842, 0x31624E6DDF109, 0x46188428FBEA8, 0x0A60CE97C4B41, 0x6B2E9608EC8C4, 0x31015977DEE8B, 0x36690B3D27A98, 0x40452B3D4C755, 0x35654B520E1DA, 0x56FABE257DB2A, 0x4F4A30C9366B0, 0x0001F682016EF } },
+  { { 0x01C83BAFB7B40, 0x01C3E388C2243, 0x3E608ABC0793F, 0x5358D7F327457, 0x7D24070BB8C5D, 0x01EC7F92179C5, 0x0F0F09086D07E, 0x0F9E95FAB93E8, 0x6019079FFFEBF, 0x30020E6F030CD, 0x41F2C44109A2E, 0x7CCB32E939771, 0x7EFDFFCF85F9E, 0x06B958A14B3D3, 0x00058E9C737E0 },
+    { 0x2267CD0039F10, 0x4287A71D2E7F6, 0x1193560FBF5BB, 0x212D9046F966A, 0x0092C4F134697, 0x3FDB5C3F3E042, 0x6DAF4B00F3027, 0x5FAAED3EDD2BB, 0x047709F135D5E, 0x295AB58E0A249, 0x3BAF0DCB67986, 0x30E4365B9BB68, 0x2EE488C638AE1, 0x51B9BDBAE1827, 0x000051C75BC3F },
+    { 0x6359E6A091C9C, 0x391E9622A1ED6, 0x0421B49D07F90, 0x1043105A0E324, 0x4FDD0665D5A78, 0x5D7DF428B15F0, 0x24018DB9AC9D5, 0x1BC1769E9C891, 0x70F58BEDEDE18, 0x4E844BCEDEFE8, 0x1C699E8F9AD0C, 0x4E60D84013BF6, 0x35848C3BE85D6, 0x1A28FEC5EEC71, 0x0002DBFDAFB9E },
+    { 0x0ADD66706A5B8, 0x0E8B2BC5FE30E, 0x6079BF82A475D, 0x4B8482373143A, 0x6BCEBC86DAAD1, 0x042DC82CF2F9B, 0x4A5DF4470AC75, 0x5413574B7947B, 0x67FD0259A3A11, 0x7983261932D41, 0x60A29B4B3B36E, 0x3E589C4B0ADFC, 0x2AAC9A64AF286, 0x19FA6FC152E1D, 0x0003397B1112D } },
+  { { 0x7323ADE9E6E6B, 0x11D80861D4070, 0x46D6A1D20C945, 0x5A9F6C92FFA43, 0x1F7A86B647066, 0x1E8DF108789AF, 0x240ABC2BB27AA, 0x14A28F583D441, 0x48D2E21333DD7, 0x1376A5C83462C, 0x7C03B69183415, 0x25D936A95419A, 0x5D39B7237957D, 0x77008298088BB, 0x00046282B0DEF },
+    { 0x7E08E6F503168, 0x66AC35CA176C7, 0x2ECC5A8835DAD, 0x13354D96CD215, 0x7A104B71105AA, 0x21DF36AC95DBA, 0x36C70DA213B93, 0x72002D985299F, 0x4314FD5C90668, 0x0DA570434F3D6, 0x65B1A159EE713, 0x66EAEE949BC00, 0x06B6AAD513579, 0x4ACC10091052D, 0x00027957CD7CC },
+    { 0x3969749E4B77F, 0x606AA72BE1515, 0x12D4F05FA9A8C, 0x650D73D41CFCB, 0x63E474A78EE05, 0x0D0CBE0EBE88B, 0x4C588F2C3CBA5, 0x3BB4147C10E45, 0x3378622AD72C6, 0x4D14C9DEDED0D, 0x2BE36380E513A, 0x6A720F839939B, 0x5C4443D2838C1, 0x1DC938804068D, 0x000353A591CF7 },
+    { 0x2A85A2157DF22, 0x7906D5AF87DD0, 0x5147417DAF6EE, 0x5787EFEDEF995, 0x48DFF6F1FC6B1, 0x4CCE32397E1BC, 0x2E217E5CB34AE, 0x50C8450C991BB, 0x39D46B63B154D, 0x078B9A66954E1, 0x5C8D4366ED53B, 0x7A4D34E1630B8, 0x414D9DCD5C75F, 0x440D8E024C56E, 0x000410C25F9CC } },
+  { { 0x300C255F105AF, 0x59C0DF63D0BCE, 0x5999E92572966, 0x34423092A2D2D, 0x4756A0F719582, 0x065E89905F6C9, 0x72AE3E20B0DB4, 0x5404567211D5A, 0x732A977594E2E, 0x2387092FD3B4E, 0x19C95ADE31E4C, 0x2D1EB69D980CD, 0x748F6B86D9E6B, 0x1059F5EC34A98, 0x0003A4710999C },
+    { 0x0FDD3DA0B5E15, 0x384C9BBE490D4, 0x550ABB1A47A39, 0x116BB12E6CA76, 0x24A5E2F81E1CE, 0x42C406C2964C6, 0x63FE4F334F409, 0x60C65F5801C0A, 0x0FF7B360C638A, 0x12AF5AA916A21, 0x54D660654A432, 0x49C1B941EC3AA, 0x45056F2EECD95, 0x6A45B0BB53E19, 0x0001FFEB1F9D5 },
+    { 0x0D7C07282B619, 0x20CF790F2E852, 0x1278139C7CEFF, 0x4CEA06BE9FB6A, 0x3193F5794B502, 0x60269F3E8A50A, 0x153A7DC55CDF7, 0x362BE829F573B, 0x23E10C34359CC, 0x2990379F39335, 0x243FDFA56C924, 0x4764D43FD51CD, 0x1DF36D124641B, 0x39AE2F54614F0, 0x00035E5835959 },
+    { 0x4B1034F9C98F5, 0x5115CEDE5E7BD, 0x56633B699740A, 0x754A3CDFE1B98, 0x5572565821303, 0x392F88E53FA9B, 0x760A5DD31559A, 0x0192984C7E39F, 0x7DCADF8531E57, 0x19FED9CB64E79, 0x6EA7CA883C0D6, 0x233825C2BCAC1, 0x109A0B0693C12, 0x69BC99F9840F7, 0x00029EA445456 } },
+  { { 0x50579C3521963, 0x5C821B72AAFEC, 0x347C53EBF6E11, 0x052A0D40C158F, 0x7ABBD5C7E4414, 0x333F722EA276C, 0x3DAB38111FAC2, 0x0FBFC8A6C3365, 0x5A7774A59FEA2, 0x39021B0F419F0, 0x56B5F072BA069, 0x16395403CB0B6, 0x2AA2BEB08BD73, 0x4C448A4CBC26D, 0x0002893834DE8 },
+    { 0x6BB51AE7140E9, 0x329999DD1E591, 0x0302BDC026A07, 0x591E2C8040F0B, 0x53EDA2181A72A, 0x25106E77C67D3, 0x4C10EEECA85F1, 0x503870B729350, 0x4F8C410CF3625, 0x1EE15FF7F6E91, 0x6D91790E49ECC, 0x7633230DB29C2, 0x00180FDC1AD90, 0x1BD59D1A5F950, 0x0002AAA46D03A },
+    { 0x681B6F4C69CAB, 0x745574D2303FB, 0x574F98F2C4E25, 0x206E3878A6240, 0x3D5C794CF30B9, 0x45E643ECF9E0D, 0x5D9E35EE5605D, 0x3E14415E9E851, 0x1FBCA87361BAC, 0x568B08C56D65D, 0x56CB721B7BEB2, 0x5C59A86422583, 0x336FE33DE8250, 0x473ED9C15EDB3, 0x0003F98CAD766 },
+    { 0x7892C09C4DC8B, 0x501278386E753, 0x1EFDBFE760158, 0x3AE06F504BACE, 0x7428B4A68ED7F, 0x0B82F97731FE9, 0x5AFE1EEDA6E93, 0x3333AC5886D40, 0x7CDE0C3952FA4, 0x396A85026AECB, 0x14864606E380D, 0x256F728AC97E3, 0x2199EB960ABD3, 0x277861EC8E210, 0x00040B3C5A968 } },
+  { { 0x43B3E8D34A6B8, 0x37B75AF161667, 0x424FDBEE047DD, 0x789D8A89D8552, 0x260F2DB517DF7, 0x316F747EEA73C, 0x567DA8B2F662E, 0x78975E33A8589, 0x3717EE8295968, 0x45E62EA7B83EC, 0x1F8B2BD3D074E, 0x3B445F624571F, 0x749E3C7C19DB2, 0x08154873D29EC, 0x000501F2A87AD },
+    { 0x138E18CDAF6D8, 0x2297C24B8BDF9, 0x774F4771DF992, 0x0C7F30DB54FAF, 0x236AB50D5C1B6, 0x7ACDB7B901491, 0x0180175B30666, 0x3B3643481119F, 0x2512172DF362B, 0x408B505AA627C, 0x3034EE4DB3815, 0x73A4BF29AA838, 0x74DE3AA9B0642, 0x5ACD36F0E4BAF, 0x0001690A66614 },
+    { 0x7B48756647006, 0x708A40F1A726C, 0x53E3A21370008, 0x2BEE37527715F, 0x1790A4D0B8F02, 0x2EE4B00664B11, 0x594993BF2BFCB, 0x49CB7A71BE84F, 0x3D712026C0F21, 0x2FFEC97ED6BAE, 0x19198CAFB2356, 0x222E5C75DE2F9, 0x74BFA9CBD7D07, 0x6EE8D0A7046B8, 0x0002BA25461F2 },
+    { 0x2AB8F5E73BDAA, 0x4451404B3C7FB, 0x2337DD405E797, 0x1F3274EA68F6F, 0x79F7DFC08FCBF, 0x315158C5AC085, 0x613116C707FA9, 0x778C89F9EA23E, 0x26B0099F3C625, 0x4FC6EBE59084A, 0x7DEE7D59B1429, 0x5B29923C7F319, 0x24197C7DEC96B, 0x4337785500818, 0x000408C442160 } },
+  { { 0x4702870A9D04B, 0x3DD8CB1D24CDE, 0x19A3D03F0D9B0, 0x78FFEE91219D6, 0x61B3CCEEF17D9, 0x5014C67560C8C, 0x1B3DBA5762372, 0x4642DF8021DE6, 0x7144DEFA06945, 0x7747EDADDDDAA, 0x29E92188A7C83, 0x03F52B0175B4B, 0x61E7EB6DF1AA6, 0x3249E8AF64170, 0x0005BB7A22B29 },
+    { 0x47850F7EE3643, 0x2AFD308DB1458, 0x376D4AE59EBC9, 0x2309A5A31439F, 0x623B641197E3D, 0x7410C78BDD111, 0x356E2CAD36B51, 0x2954DBC8531EF, 0x1795D30FC5A52, 0x2DCBD2946B295, 0x2E35D4CAA7673, 0x699F3D6E931BB, 0x05EC798B05A12, 0x5EF5EEA3B795F, 0x00012A74E8C22 },
+    { 0x7C78CD7CB15A7, 0x0DE76B0A91EDE, 0x19E25BF7A488B, 0x567497CA844F8, 0x6DBF4B3BFFD16, 0x5F73F1951CD37, 0x433FD34387013, 0x569EFDC53840B, 0x4C3532E3254F2, 0x613055B56264B, 0x2B27DF9164D2C, 0x762D88713B684, 0x72611F03D1E52, 0x79E3F471A88D2, 0x00028FCDCF36C },
+    { 0x41979D34CDACB, 0x28C4290D93787, 0x074B1D00E26AE, 0x7676954AE061D, 0x305EBCDCA7967, 0x2CD9FC27F594B, 0x41A202BFC1822, 0x4553A3E22D71C, 0x069A2D0E9CE26, 0x73A7033439449, 0x70D096047DFE2, 0x4F805469F9200, 0x279EA1D934768, 0x5FF1BD0C19398, 0x00027ADE53297 } },
+  { { 0x3FBC1569A79F8, 0x1158D4A8A1CA0, 0x5522E74A19B7D, 0x7003F225109E8, 0x10C3D948924FC, 0x62E7D175618AD, 0x1EB39C95737D1, 0x79EAB9BC620EF, 0x6CC3D800A7311, 0x353FC4134ED3D, 0x5853C022F0398, 0x48CED3E832243, 0x1A61F7E4BBC5C, 0x06473D61478F6, 0x000349EBF0057 },
+    { 0x0934F91E34E50, 0x5275BDE166556, 0x35FDF237F1E59, 0x742FAB3B12482, 0x466D0CF48B958, 0x06457C3D65230, 0x1765AADAE648D, 0x0C781D9797247, 0x25D524240917A, 0x51BC4912DF3CF, 0x26FBFFF3E3412, 0x3F20BB8BEB006, 0x31AF11F9EE3C8, 0x1E4B57C9509D5, 0x000199BA94F6F },
+    { 0x1F5F0BDA5B57C, 0x40A32E23A1A30, 0x4F9ED8BA4F31D, 0x1E844757649E8, 0x542196D1E90F1, 0x772D5A271E638, 0x442C2AC3A6FED, 0x1F17D5C6508EF, 0x3A044EF4106D6, 0x1CBD58B56A162, 0x31357B0CC36C5, 0x78B74665A6880, 0x693C9F0C14516, 0x5A735A25B9F42, 0x0003CD176A3CC },
+    { 0x2B1DB6FB3C264, 0x22607C514A617, 0x154CA21645863, 0x5DF1003973A01, 0x1FC105E776A73, 0x65D2B87F760CB, 0x2F3ADFA01F906, 0x45CB22FEDF99F, 0x22C0BC1166DC9, 0x4741058397D04, 0x0979E23F0F9D2, 0x74C2D89E75421, 0x18A5F0798EB86, 0x1F8BD25397F24, 0x000414D0FE53D } },
+  { { 0x08777DE4BA4F1, 0x1FBE60EA8E674, 0x4D7458C83FE20, 0x23CAE8A5810EE, 0x76B9A4E00B4D7, 0x0A283021D82DC, 0x5CADF2A2C322E, 0x4B520B41DBA87, 0x72BD13E1BBF6E, 0x4616DB6132C36, 0x67044949623DB, 0x27DEA9F04EAB1, 0x3314A001E6629, 0x47367B7EB50EB, 0x0000AE93FC503 },
+    { 0x5CA387C579F97, 0x7CCB384D2BEDE, 0x1285180978DD1, 0x62E55F22329FB, 0x661B1A54BA88E, 0x4D41A73C7DE9B, 0x2031EF88FEAE3, 0x65BD21C431944, 0x5BAA04ECC9D1F, 0x76C2E2A55BC5E, 0x67FDACC56EECA, 0x15CD7662E2E5D, 0x2DFDA62B64EC2, 0x408043D5E1043, 0x0002E865F9A82 },
+    { 0x1FB52FB30D165, 0x5570F2BF0B16B, 0x7C1C0799010F3, 0x6B09D808AC2B2, 0x64E82809A1375, 0x3B43ADD20104C, 0x619A60A1A35ED, 0x5F1F67B54D828, 0x7FEF44070D185, 0x18808897BFC1E, 0x75C63BE997AFD, 0x62395BFFB5910, 0x2C0011D9A0A9F, 0x45F689D8781C0, 0x0003720BA8DE4 },
+    { 0x236F4499A999F, 0x522E65687D365, 0x40056E14355B9, 0x2DA527A07DDB0, 0x1714812339FDD, 0x093CDAC080066, 0x758DED1C38549, 0x079EC0889F0FD, 0x6F42E96EA1281, 0x36D4A28CC04F9, 0x7861A88E5CFB5, 0x00706F3B859DD, 0x16853F3ECA2D1, 0x23F1903967498, 0x00039C846F156 } },
+  { { 0x55202329FAAD0, 0x45517AED3CA72, 0x168E7FE754FFD, 0x157BA09FC5843, 0x74D1DDD921C3A, 0x4D9822301AB76, 0x3FA3476224A03, 0x79D1CD36ED955, 0x6FD94D07C343C, 0x699CA2E684E19, 0x2CE023A8BAF01, 0x1835C034DA6EE, 0x2608B15E97F44, 0x46EA35748BEEA, 0x0002F41BEFC77 },
+    { 0x28C5E84440D77, 0x455E3BBFADF0B, 0x08182CD652A43, 0x102364CBB0C3E, 0x3C064560CB2E8, 0x2B5D373A1FCF4, 0x574E5789F2313, 0x6A05096711150, 0x4503B08780062, 0x3EEB6B6E4DB22, 0x793D4A865F707, 0x349FFC9A62FD7, 0x7F3251D848D6C, 0x01CDB948EEC15, 0x00012430C832B },
+    { 0x3A4EC07B20D66, 0x359BB6F661C4B, 0x5225E0F8237E0, 0x11C3A82946CEE, 0x03FBDF5B646C0, 0x7275E63D63B03, 0x110445270F4EA, 0x77D8EB807D349, 0x70143A13D83CB, 0x483D515EC2359, 0x4587CC7E2EA86, 0x0FEE3758898C5, 0x6F0BBDDFA6E87, 0x42F624BBDA580, 0x00040B1A85CE6 },
+    { 0x55EB41C4F62E1, 0x5FF00839518F9, 0x709438B4BE612, 0x60D1A9F62DCEA, 0x13101979641D0, 0x16969FDC5F9A4, 0x7CE67A9F220D2, 0x11B236AC25A0F, 0x2B460DEE015DA, 0x10EF3EEEBE7C3, 0x181645486003C, 0x612DB1E8CCEBD, 0x03F063FDCCD39, 0x49E7C3D5B934B, 0x000414936A93C } },
+  { { 0x306FC64C990E1, 0x1C6829615F5D3, 0x6F41AC2A0031D, 0x7B1668BAF2E85, 0x4A2BD80202183, 0x4C1C4D9456B14, 0x50B610E77E6C4, 0x4C40B7D7ECEDA, 0x118BF937E60DF, 0x473669AB5128C, 0x73B4868AB968D, 0x247B2B0D5CBC3, 0x38D9A2C70193D, 0x10B313A548EAB, 0x00043D5C669DC },
+    { 0x15BDEBE907E65, 0x5679C5D744FCA, 0x3AE99A787188C, 0x66DDD1D43ED38, 0x4C7EFA72706BF, 0x1B0B834FA0555, 0x48AF8844304E7, 0x4B635E1EDBE25, 0x4DEE625464F38, 0x0AF49AC08590C, 0x13E95372ACF9E, 0x4BDBB09E61F63, 0x18BB687B571E9, 0x5CC040E7A13B0, 0x0001ADF16E6FC },
+    { 0x11A58AD8F6B0F, 0x502CB66B37E56, 0x5F014D4B16130, 0x4C3A8E8196C49, 0x0B6249FEB241C, 0x2CA7E54B76DF7, 0x5C48F8423CD5E, 0x2FB3DFE37FA50, 0x1985F4FC63172, 0x08855C27F19C0, 0x268BA0479EBC7, 0x6160DB28AE2C8, 0x338A58AA4FACB, 0x34D68C0F96326, 0x00026E765D920 },
+    { 0x4AE4A0952D55B, 0x001663D3352B2, 0x22CCB1110B8E3, 0x74D8F2114002E, 0x539536E78158F, 0x71693E24CF053, 0x1FCBBC3E6A39C, 0x10792A1612D98, 0x60ACEC4C3AE9E, 0x54450DAAEC713, 0x77AAB835E8545, 0x227AD72D18A02, 0x247D2A9A204A2, 0x120EFB4C95FB1, 0x00048D788E023 } },
+  { { 0x2AFCE2552B136, 0x17BA6829B6B0C, 0x78D82D7B160B0, 0x76936228927AD, 0x2E58DA8184B4B, 0x2F3CC3C94C600, 0x1FBD0E873A888, 0x50EE639B37F4A, 0x20C979AAC42C6, 0x76C0A437CBEAA, 0x4B3BBDF90A2CF, 0x0E0D9BFF83A5C, 0x2E05AC613721C, 0x2D1562BCBF378, 0x0005DEF31E6A4 },
+    { 0x0B28F74BF9841, 0x2C2CBFB453A7E, 0x6AB03CE43D4AB, 0x504402BBCE0BC, 0x6B4E1C4254E9E, 0x0B59887DDAB8F, 0x5CEB0875A3ACD, 0x050B15CEC1D51, 0x5D2F663271280, 0x57D46539E76BF, 0x1804A334B8F69, 0x29A4674A0A016, 0x3931DCB2F4A40, 0x3307B2ADE6267, 0x0001A910885A1 },
+    { 0x6609F439875B8, 0x4C542EE6317AF, 0x11C4A56E0E700, 0x39B630FD918F2, 0x1284D8203793B, 0x7E0374319B0A1, 0x2729635713722, 0x616DDEAD5DF4F, 0x189B58962B1EE, 0x6580973D2B9F3, 0x51538D0DD9134, 0x33B6AC9C7AB2B, 0x1EAFD91635A5A, 0x2F21A0088E6DC, 0x0003DE1BBE748 },
+    { 0x30D4143DFEDF1, 0x17313BBB39E41, 0x519AAD20EED5B, 0x7C7027FDB2F7C, 0x2188F3C90ADD1, 0x0553D88119025, 0x7471D5994EEEA, 0x78EA4B8E1BBBA, 0x2135B134E71C1, 0x2B8049B2DC359, 0x1A4CB94E77FF3, 0x015A5BDCC6985, 0x75C7A8824E41E, 0x11565FDF6F3AE, 0x0003A86BCCDC4 } },
+  { { 0x0EAF4BB66903B, 0x15DBC004557DF, 0x50E54453D5E2A, 0x45FBB54B42C67, 0x49BA14EA43B23, 0x2C09BEBE2EEE3, 0x22809CFEC8530, 0x1781389DDBDAE, 0x07E3E239DDE97, 0x603AF473D858C, 0x78D10BC8575FE, 0x1319EFA155382, 0x02BF0C2BB6931, 0x7DAF4C151ACC2, 0x000525B4A7581 },
+    { 0x79AEEE70B7968, 0x668251CE6B670, 0x76868029CF788, 0x41F89F5D369E5, 0x073CE9973C599, 0x56200E7AF32C9, 0x668F51AF25628, 0x075BC90A7C950, 0x7823F9B424793, 0x16E96A1C0F961, 0x2A5B96523E679, 0x47B767A519885, 0x3CB9095E94624, 0x7A42547ACE57D, 0x0001EB6CBA1EC },
+    { 0x54A44E8C1416F, 0x455DF587831EE, 0x146BDD52D7C0B, 0x6BFF3ECA73BA1, 0x6AA81748E6075, 0x2EA9BBEEA8656, 0x5AC8D707CC486, 0x1001222D69069, 0x7FE161B2D5357, 0x77915B7A5F7E1, 0x3BD7308596DB1, 0x4B66093172A94, 0x262E99F6A9A9C, 0x5DCDD4BA32980, 0x00037AC722FA7 },
+    { 0x5415458D2F794, 0x1D61A7F9AB024, 0x1D1EA9874A411, 0x6D68287B0C638, 0x2DBE44B5D8F9A, 0x46A67EE085AC6, 0x66782905CD038, 0x3848548E5B753, 0x2A204E1D07D5B, 0x5D836F014083D, 0x0FD1CE7E1A36A, 0x7AF3D2EEB1FC6, 0x16D7D94899B46, 0x13C6676B1AAAD, 0x0003EBA50ED73 } },
+  { { 0x73FD839DB433C, 0x1A1A1518E288D, 0x1581A58FECA45, 0x027F9CC9DB290, 0x251064B61B140, 0x166DCA9AE3DB4, 0x3BD5871189C04, 0x28CA30C39C4F0, 0x7C73ACF33BF3E, 0x1F86AD3CD5655, 0x1E85808E423A0, 0x5E097F5298CBF, 0x78E6CC370BC4F, 0x5D6E8B5B546CD, 0x0001609681A4C },
+    { 0x7A5B0A9790872, 0x2300267405A90, 0x10BA920BBEDF1, 0x3F8F993DB5353, 0x7FD1DD40EDCF1, 0x78AD2EC09C8C3, 0x73E27C986F41A, 0x50874CFA5D936, 0x1A5E0A6E95F96, 0x076D2EE7D6368, 0x0585888372CE6, 0x22A4243A30CE3, 0x544FD0BEEAAF5, 0x6EA8E7C11435B, 0x0002872483F4D },
+    { 0x3B26A6E3B8B98, 0x6371EF70559FB, 0x092328CFFBFBD, 0x4D7A1BDFA2F38, 0x0C263370613ED, 0x1EB66C31AF667, 0x49228DB53A576, 0x5D4AC139F9019, 0x08D7AF08B0FA8, 0x5372641BE9552, 0x06B2BD7EA3667, 0x7952D5721E195, 0x78ADDD9C13D38, 0x714EE22C567C8, 0x0002B54FB9C1D },
+    { 0x54BC1B819B3BE, 0x62A5633C3CCB5, 0x4CD04F1B58EE6, 0x47497EE8C0CFA, 0x242C499F645B1, 0x3417CBA3FB260, 0x1A83D54131FA1, 0x547B65B85CBAD, 0x1E7BD7B55FEB7, 0x27CC8C9822C12, 0x62F01D9E2F220, 0x27D1A5729067E, 0x19CDE2C2F3D68, 0x44FFA24C115C4, 0x00029F0AEF7B6 } },
+  { { 0x02C7110CA51CE, 0x30EE30D97BE9A, 0x722CA58EE2CED, 0x7A628560D86AC, 0x183C28F7FFACC, 0x7C08822EA8AB7, 0x2C561D918BE3C, 0x680AB986CB161, 0x73A5273988E65, 0x4FBB34050CA66, 0x31E0ED0B871D7, 0x24A680AE4E3A7, 0x6C611D99FBE89, 0x0AE2DB5F9DC16, 0x0005066CC5AFC },
+    { 0x497057C106FF7, 0x4AAEDD70EEBFA, 0x0D48044764457, 0x077AFEA0B6DD3, 0x77A7B8E26AFA9, 0x29EB68598A7A5, 0x4C58DC9C9861C, 0x339DE73A0EF96, 0x0D737EF7F19CA, 0x37AA5B1CEA1A7, 0x365B9D5A127D8, 0x3038DB536AE67, 0x05DA579D82060, 0x6557C81FB9017, 0x0001357002734 },
+    { 0x423E4708FB224, 0x01DAF4AFEAC52, 0x0C96B9815A7C4, 0x7A6753901D8E3, 0x573F2D5A7FB9A, 0x5022696C261B4, 0x7E1DD7B7AE967, 0x07221136F9D33, 0x3B54B8C1915D4, 0x6979699E50CFE, 0x2EBA3F80A577E, 0x1C66F64F391DA, 0x79C9709838BC2, 0x0BC4990121806, 0x0001E1589B681 },
+    { 0x176751D9F3759, 0x5FE48B8354FB3, 0x7097BC3D5BAAD, 0x1E945C666DE3C, 0x1712404F45B91, 0x18B12075CBB80, 0x04453EB805353, 0x3F65D2994A7BF, 0x26D353FF906E1, 0x65FA35EAA0867, 0x605493F62DB4B, 0x4584D2C331860, 0x6B67F7D397307, 0x1B0079C2AF8F1, 0x00024A70105F4 } },
+  { { 0x474F79F01234C, 0x2B6026C9E989F, 0x2F4E6ED65091E, 0x10A8C8263BFF5, 0x46548AB40C13A, 0x3941A8D9634A4, 0x31165057B9B99, 0x60E9308AD2474, 0x2F4E32B859801, 0x4DAF04071B121, 0x1DF6B0B5EFA56, 0x4E3A708870DC3, 0x45FDBC6F77C34, 0x6E0F33CB712B5, 0x0005217E6988E },
+    { 0x64762854E921E, 0x01E9A7698FB92, 0x3D24D46F91CD7, 0x061503B761A0E, 0x27D6F985D2769, 0x10AE8E6BCB15A, 0x3CB1EFD6728E3, 0x7168E33066BB5, 0x471143E2A048C, 0x681DBEF93E652, 0x31E33E583FDF2, 0x7BEC3B971957A, 0x458240BD197C5, 0x1F4595B9CD2A0, 0x000222C5F4A4C },
+    { 0x5CAB0632B2634, 0x36BE79CCE152C, 0x61D3E4A7546E0, 0x727E714F4E12B, 0x31997D21842F4, 0x3229672847F74, 0x1F8E9B7175EB0, 0x3428F8925A8DA, 0x3CBD5AB9C6C11, 0x2736F8F21057C, 0x70E92011B39EC, 0x78FF662024A98, 0x517751FBC2A4B, 0x606429C7A6C79, 0x0001D208FA455 },
+    { 0x61B11A895B040, 0x5EE5EA5922BB2, 0x3A7A610A5FAFA, 0x475933C21A1F8, 0x33899E9E372E1, 0x100F86396F9B2, 0x401DAB5CC78EE, 0x22892E6B933EF, 0x68CAAAFE4BAAF, 0x6BB73AA7EEB06, 0x48AFE0E905016, 0x12E363ECB1CAA, 0x63472BA7715A8, 0x28D1179514E7D, 0x00029039A7DE0 } },
+  { { 0x5677DACB1D341, 0x5C436DAB16B06, 0x1D7A0853F81E8, 0x087B3073A7B9D, 0x5A6E12CB7F180, 0x081118CE44520, 0x4A11A837C1B9E, 0x04234E63EC700, 0x27C5BEDDBBC06, 0x2CB292DE27D3D, 0x718A6EFC2733C, 0x530D0C9B84B45, 0x7AF15301E6C2A, 0x2EAD90C9DE004, 0x0003F9EC5E5F9 },
+    { 0x6159F599EF891, 0x5E4753A3F1CB6, 0x760E23ABD87E7, 0x0F0519B6D9862, 0x7FA8290850106, 0x24F02FD60D69E, 0x15E6B6E639091, 0x4883D1D4A54A4, 0x136C9D45AF6A6, 0x11E9D10AF77D6, 0x0C57D547CE933, 0x0DB89F4A0E840, 0x0F019AA10E263, 0x36518948AD61C, 0x0001E87CD3E77 },
+    { 0x19F85A7D49421, 0x4866F690ADE93, 0x7C31666613DE3, 0x0E05CA6FFF0A1, 0x512DB8A78A148, 0x1B82DC840785F, 0x5CB98F9457A5C, 0x3520E7C703466, 0x5C41F573A4E72, 0x1A1146A6CC98D, 0x126113013D4BD, 0x7D65223E31FE1, 0x0C67F97C29E4C, 0x25BCEB5736BAB, 0x0003C9DB709A3 },
+    { 0x1F47CE2E608DB, 0x7404A51FA4FAA, 0x724AEEAC0FA65, 0x03999045F061E, 0x2EC531AF18BA3, 0x3E27E8D118163, 0x2FC5F80035116, 0x6EAF58F473DD7, 0x1960791AAAE05, 0x46C91D90BE920, 0x75489E09239BD, 0x7BA865FC70E04, 0x60518ED381820, 0x6E4F775CA1EB1, 0x00033EFDE1C05 } },
+  { { 0x77DD9755DA305, 0x6188FF94480F1, 0x142498F7E7277, 0x2C3BFAE8DA9CE, 0x0567264776BD9, 0x5B489D122882B, 0x2AC67CD135D6A, 0x4278671914100, 0x394B01F5048CE, 0x101313FC033E1, 0x30D3F8F38E0B4, 0x0F66BCAB4A493, 0x3B286409F7859, 0x660CAF7A7C429, 0x000407D93D878 },
+    { 0x23D46CC24FB62, 0x5F6CFE8FD039D, 0x7F70307EA528E, 0x7C7E8E372253A, 0x03CCA6D0394B4, 0x15E3291409597, 0x42D4A4A5F5E36, 0x65926BC602D60, 0x379248AD95AE9, 0x5D0D981E96CFA, 0x276F8B8D7D135, 0x516652E6610AE, 0x723C86F53037B, 0x40D8BD5CAB47C, 0x00021A1E242A5 },
+    { 0x142B26E5F4FC7, 0x0902BA8312B97, 0x22C98BEF362B8, 0x6B26F0A28F2B4, 0x1EF05D3829224, 0x4A671BF676EFC, 0x4E01E48B25844, 0x2A2B8B4713DCE, 0x4E8569141A550, 0x17E57CA979F62, 0x64A4133ADBAFC, 0x4B7A39C5A93AC, 0x4FC1C5C00F19C, 0x00D376F092363, 0x0003AD41C95B1 },
+    { 0x0F97E5D87CD42, 0x7DBE939F1DF65, 0x09370F5C4E69A, 0x0544F387C0429, 0x25F90DD27630C, 0x000B8AE54CAA2, 0x61ECD45234273, 0x62501A22DA7F5, 0x01E27F881D5BB, 0x0986EE9C03A0B, 0x5B00A6A20F69D, 0x630550291C848, 0x6BABA987229C3, 0x307F58AFCE1F9, 0x0003BAFFB6FBB } },
+  { { 0x09AF095FC7E1F, 0x72DFB79C3A9DC, 0x4188B8D69628A, 0x07076C9472DE0, 0x1103FC9FF0068, 0x5D72F4B37BF82, 0x66EA77E2A09D7, 0x3FF3FB5557EED, 0x7A9FA1A3ED179, 0x27FB63BBABA4E, 0x542A0A2C608CA, 0x56BF9C132D706, 0x48D3789D10E00, 0x1A93EE6EF393A, 0x0005BE5A211D6 },
+    { 0x10ED78CF1B708, 0x78AF42796CBF0, 0x6CCDCB062FEFA, 0x5AD622610C550, 0x0C5FCDB01432A, 0x1CB4BFCA3EF26, 0x6D1B7B8E8723C, 0x06D9843BC755B, 0x5A61C0BD5E91B, 0x3173BD3B17DA0, 0x20B1A6428DA09, 0x530B484AF2178, 0x1C0653F2470C4, 0x257E6D8D9A218, 0x0002C908D79AF },
+    { 0x28F6D50316215, 0x236628700EF86, 0x73A5834F12728, 0x17DA85F270003, 0x08FC510FB569C, 0x7A7FC81A2497A, 0x51975BAE4DABF, 0x7B5E7ED82937D, 0x466E53ACD3352, 0x7F30F2EE063D6, 0x4B94FCD3A3374, 0x58A9047AC0818, 0x67A9B7A82BAA2, 0x17CEBB50A5B2B, 0x000467A08AB4A },
+    { 0x27E3000468B0C, 0x04D55CDCB3F6F, 0x68249AD60CA3D, 0x1DBF776F9294B, 0x530978872F5DD, 0x628EAC85DF86A, 0x782023B8AF50F, 0x29C2D8191658B, 0x7FF5953AAD009, 0x36A9B6F8C021B, 0x5168170260194, 0x653F73211BCB2, 0x50A0DE7EF1C4C, 0x73426D21A4D68, 0x0003D2594EF28 } },
+  { { 0x0EFC9A5C2986B, 0x6273D7A1DE59D, 0x15C30EB9EC60B, 0x765B917FB61C7, 0x6EED32056ED03, 0x2B5FC8C65402F, 0x6B604002C7E76, 0x5DF7D29C393D9, 0x52B23D3414071, 0x42AB75EF10387, 0x0CA2B83F7D84D, 0x28450EC40A349, 0x21005D1735E21, 0x59DA8CBB59325, 0x0001D6FEED6B7 },
+    { 0x3C0DCD824A664, 0x0D398DC3CA16B, 0x58FF002427519, 0x3712EC64839B2, 0x5CBD53BD773C4, 0x4697FDDDD3719, 0x41A253D0230D4, 0x613101776A8A6, 0x7F4B00D655537, 0x3915E0CC79710, 0x6131C7308AC21, 0x3E47552A0F1B8, 0x6F9466B6F447D, 0x4548766542A30, 0x000283605C6D1 },
+    { 0x2ADF8487E68AD, 0x0067766FD636B, 0x2147B453CC235, 0x4EF2BA6BBC3AE, 0x56A6562FA8EBE, 0x444BDD2F97839, 0x7B16640548B60, 0x36A68D6DAFEEC, 0x66100AF6A21B9, 0x0C7A2F39EA6C9, 0x74696F25EA4A3, 0x669E4A138DD6D, 0x476A3F54489EF, 0x5C1004B714D87, 0x000468CCD94B1 },
+    { 0x65156AF78FE8A, 0x3E1111B4404EB, 0x2564C2C6F2591, 0x3E1D258E35DE5, 0x7A375FB56659A, 0x6CCA62C61CE52, 0x75D55B49601CF, 0x58A9E2EE87EC9, 0x1B3DAA605DE3F, 0x38379589D0D31, 0x0E8758CE3D576, 0x11DC77DDF0754, 0x3EEBF3AB67F12, 0x3253823080ECD, 0x00034E4692268 } },
+  { { 0x2FF50C9A4931E, 0x1430375C8D0D3, 0x4B4FA1E9F00C7, 0x321D895A76590, 0x680E4C32E7801, 0x0E591BBF5266D, 0x7422B3E53D3D6, 0x4B72BAB307E8C, 0x3EE104027719D, 0x494C40A5BA792, 0x0F1E74186F17C, 0x7B74A1210928B, 0x6C1498EC3202A, 0x65C95CC604116, 0x000377EA159AF },
+    { 0x469580355D1D7, 0x130111873BDDB, 0x5C1B1F968BBC3, 0x6F538DAA82520, 0x267AF5E3EB728, 0x3A83CE10F3221, 0x5C560859267BA, 0x4D8829B81A716, 0x5D416B71160B3, 0x75BEEAF384510, 0x143C92E145F4B, 0x2BF662C2F8920, 0x52D03C22E15CF, 0x1EA43EF6B3DF9, 0x000025B46DE05 },
+    { 0x42C769AFA281E, 0x7B6BAB2805494, 0x2E7D09E3687E2, 0x340F286705DCD, 0x70FE7556B0719, 0x6501B8AF06F4B, 0x74682502F126C, 0x79CE8E6608AB4, 0x2D4E3CDB51681, 0x1C5CDB1ADBA5A, 0x23B1818C6CADF, 0x4360924EEC3B1, 0x46571419FE303, 0x11D0B30469119, 0x000308A063699 },
+    { 0x39EE65569DC5B, 0x53C9FD32A9B64, 0x637FBCF8C2630, 0x0A1316F430450, 0x27812E8573B05, 0x73B7CC4CA97FA, 0x7279871F83303, 0x4E5C9C1168441, 0x233F0D2838D57, 0x2BCA5593D856E, 0x2CE900D9A9EBF, 0x62C35200E0CFC, 0x7D7F595D82E54, 0x08B6CAFD52004, 0x000390D97E72D } },
+  { { 0x75519AC8EB92B, 0x7D7873C812076, 0x68F801236D216, 0x360D35323914A, 0x3330A34998D26, 0x563821FC68C37, 0x19B513DD79C06, 0x1DBE736EFA119, 0x530D3F9A48EBE, 0x0A8EE424BB541, 0x608A120A1D813, 0x1ACE6EC3A860B, 0x79304F97DC738, 0x66FC6D7A959F7, 0x0002B1859587E },
+    { 0x5150255336A0E, 0x677A342ED754D, 0x3C239A43FB997, 0x0FF7E81958221, 0x67E4523DA931B, 0x6AF090A3337E6, 0x6F8EFF6ABD9EA, 0x378ACCCC4A56E, 0x53D63D479B9B2, 0x47C464A237FA9, 0x1A7262325A85B, 0x4B2091C77875B, 0x3B2A5AA074DF3, 0x0129B090A6C5C, 0x000286D6F1F0F },
+    { 0x3F89E6F0CE77D, 0x5ADB7EAE63164, 0x190042236B9B8, 0x5713C753FE747, 0x33FEC4F56E945, 0x1B9DCF5088045, 0x3196C7896B655, 0x6224017DEF977, 0x1CDFCC4DB0D9D, 0x77BC0815556F9, 0x25C86C645F25C, 0x290C4DE7E3E5B, 0x18D0940D4D269, 0x39DA8147063A3, 0x000353961D545 },
+    { 0x356DE9A2F23D8, 0x0C89D97AB2D51, 0x27D7DAEEB2866, 0x14BEB49D4EFBB, 0x13549BFC8070E, 0x075D4464C1915, 0x1CDC0D79807E2, 0x4C98797F42FFB, 0x0AE540FEE160A, 0x53707FEE1E1DB, 0x044670E7C777B, 0x1DC91D86C7E4D, 0x261608181B2D2, 0x5F5652442B8D2, 0x00032EA9DF69E } },
+  { { 0x62DF790F08CDC, 0x504B9DA8A8382, 0x1EBAC1944F899, 0x1D06D48D1631F, 0x175C34BE8B1BB, 0x1E3CB3E677F58, 0x4C93D97B67F36, 0x4DE974F47717A, 0x3A0FE9DA9427D, 0x75D67DD56A6F1, 0x0F598DDD72A30, 0x463002DE63656, 0x62C3C9C28D4AE, 0x36C997D7EFD07, 0x00029041E4133 },
+    { 0x29EE4FBCC9600, 0x04878C76FD3C6, 0x4F66F52A0FABC, 0x5F70185F1D561, 0x11CFB321AB95D, 0x548AB64646B86, 0x2DE5C55C6490C, 0x7D491A8073920, 0x25EF49655DDE4, 0x1B30D61C4604E, 0x7B5C7C716BB77, 0x24D4CB81398FD, 0x74C7B123B86AA, 0x3561709533A7C, 0x0000FE0C33C77 },
+    { 0x1946250874102, 0x0FE9F19410C89, 0x1C1C1EEC9BA2B, 0x1C55A6F09F2E7, 0x04AF89D23EFE1, 0x18FF666964DDB, 0x11481C033CEFB, 0x3BC8D58D1C7A1, 0x504175DF63102, 0x63A019B8A872D, 0x2260C5529BF18, 0x60A3692525C23, 0x04E4983FF74F1, 0x7877D4976F16A, 0x000195A088E00 },
+    { 0x5224D4DBC6B9C, 0x6B70F17D7BFE3, 0x18164E1283BA5, 0x533F7A199A6E0, 0x307BA1D3E083E, 0x6A0BDC204A988, 0x1A9407D909DDD, 0x7EA9285253BE0, 0x49B263FE11475, 0x481DAD9C3F1A1, 0x4A036BB5399A8, 0x08BC7D0566335, 0x19CC6F4C76C5E, 0x7CA2388BFDE90, 0x00030FDEF8CAA } },
+  { { 0x2B174F167DAD8, 0x1A22E6B85A9E7, 0x38C468956D592, 0x71E2A70AB52C4, 0x32A5A407D2100, 0x7A5133ED143E0, 0x34076245EA6B3, 0x353180A9C1F85, 0x5ACE18735063A, 0x680781F06E9C1, 0x60288F5ED5572, 0x281081E9F87DD, 0x25823460226FC, 0x6B78A136FD15B, 0x0004D41442A06 },
+    { 0x36033539934EE, 0x4145B273862BC, 0x1FD3A31562225, 0x3BDEC6FC7E46B, 0x4C3C218BEA07B, 0x2B888E491C6FF, 0x06A9D205275F1, 0x3A3F6BB9A6BDE, 0x10BD1DE416805, 0x7DF18D516F643, 0x650F536FF338E, 0x16378C9A815F0, 0x083A3BF7D9912, 0x3DD7E32A11E3F, 0x00020F9533850 },
+    { 0x04EA89B56D994, 0x048AF7809613F, 0x2BE40023E5622, 0x59C70FB186C42, 0x2996F6B2CC333, 0x1B01532B49FF2, 0x7EB8BACED0AA0, 0x47FB4988B9834, 0x710EFC70EC7B9, 0x43EBE13E6F815, 0x7698068EE3A6F, 0x3ABA4CAC5D775, 0x5C56AE40D94B2, 0x469408D1E9667, 0x00058479169A7 },
+    { 0x6B70806C54A62, 0x25DCB9C7FF06D, 0x32CAC604643B0, 0x5ECE5791B13EF, 0x473F52783AA84, 0x4CC4C5379451A, 0x14B5C98D772D3, 0x09E5F1A0A457D, 0x10BAACBB94C30, 0x5988E0632985C, 0x54433AAAE45F0, 0x6843FD5CC8E46, 0x108FEC5EA4ADA, 0x068BD7D4E0CC5, 0x000298841980B } },
+  { { 0x389ACAB34232B, 0x3E4601929AE1C, 0x4CEDF6690247E, 0x37D0935F24409, 0x24027E1B91A9F, 0x66F2F476F7AB2, 0x094A1779B4EB1, 0x46D6E032AD8CE, 0x6879AF1BD49C5, 0x7026E64BE5BF8, 0x700052EF7BF04, 0x6196B279D478F, 0x2D245EA4864BD, 0x4422CFDCF74A4, 0x00031A6D7E283 },
+    { 0x2E6ACB689AC08, 0x6922BB75625F7, 0x6F2B44EBC36B6, 0x36D4E91498C14, 0x0E271EB08EDAF, 0x6AB28F4177371, 0x582868DB47828, 0x418F8D1F4236D, 0x4EEDF7C511926, 0x689391308669B, 0x045D28BAA9C10, 0x22904D6ED80E3, 0x0960F4DFC2F2E, 0x18A22B7DEE3D2, 0x00015746855AE },
+    { 0x17EC1E2E5DB3F, 0x024927A550F55, 0x50B7D2D4DE3F8, 0x3B1BA7511950F, 0x0DA0ECF5E5B8B, 0x426A9E5A9877E, 0x5D9E5F682BC4E, 0x08A1AC38913E9, 0x0A05B05776F29, 0x1EECCB67FC1B2, 0x203304EE423BC, 0x554FE9F7069CA, 0x4BCE2039EF4CE, 0x7C6F65650E090, 0x0003FBFBC768F },
+    { 0x54F574EADBD92, 0x10BC554910B5A, 0x525161739D236, 0x040F4472FDD93, 0x212197C041D44, 0x139CFC9EB04EF, 0x12B1FA0539B09, 0x68D5789AA620D, 0x4D24D90A25BDE, 0x3516D1AEC4C7B, 0x7388A25FD8B1B, 0x1C4AF790EA19C, 0x22AE26B47050C, 0x6EB0B10D2D956, 0x000321040EAC4 } },
+  { { 0x242B2713DE423, 0x4E8FAAE04325B, 0x465692833F4A1, 0x261FD6787FCE7, 0x1067CDE84111E, 0x2DDC23DE28D4F, 0x7F849CE245817, 0x3B3293579F8A0, 0x1023D57DED00B, 0x46834452EA917, 0x6912EC096D6FD, 0x1C9C70264652E, 0x2755A0681D46E, 0x2736383FFDC67, 0x0001D43E7F0C1 },
+    { 0x7387BE6FD1928, 0x34F7E7B0CDED3, 0x189A20F90ACC6, 0x3ED1F14916C99, 0x13F96F2360E53, 0x5447D06483FB3, 0x36514A57C7C6B, 0x69F29BD07DB2D, 0x24D8F22B3A802, 0x6B2F6B463698B, 0x37DB729BDB60F, 0x61D39D780796E, 0x3EC28C481CF2B, 0x70BA9B8537A89, 0x0002A390C8B67 },
+    { 0x70BE17A220649, 0x1463B3A25FE6C, 0x6D31F131C4A43, 0x320C68AF596E8, 0x68D33690A3302, 0x540AFD9457D58, 0x09395DF147ADE, 0x4C1ADDAD5568A, 0x41777B390C09B, 0x7417D97CB9E27, 0x2E7FED54579E0, 0x52139C5362120, 0x5CE2B33DB85EF, 0x32A7F749F9849, 0x000518C8EACE2 },
+    { 0x2C4D426A8C9F0, 0x1C71475FFF25F, 0x7C959EFA6CE94, 0x6EB7EB8E38D26, 0x14336C43A48AB, 0x672D058588138, 0x1BF6AA926CECB, 0x69CB1A0592E10, 0x1C9E019939929, 0x454393170C338, 0x5E9E4C8A8D214, 0x1716D98FC78A6, 0x5416345202992, 0x1464A99116274, 0x0003D13D9F53A } },
+  { { 0x120CB5D11D10C, 0x4FCE6318E7EC6, 0x03C4AA4952294, 0x66E9896A9632D, 0x38C3C047FBA80, 0x6FF5A89594C8B, 0x31660F8A0D636, 0x18339228B72B6, 0x7231AA37E59A1, 0x135B8EDF6321E, 0x0FFC11BD292FF, 0x2499C7867DB7B, 0x015F53D945F8C, 0x79BDE156E98B9, 0x00059AB7B19DB },
+    { 0x2F1717EDD2AF1, 0x027E927A31348, 0x77534959B377A, 0x270B24AF2A368, 0x2F5C78D28EF40, 0x112F4407C13FF, 0x431613635CC29, 0x4EB197A8B6E54, 0x0981B8A180CD3, 0x47B3B39700B40, 0x27BE34E6B627F, 0x4AEDEC09D9F5D, 0x179AFB97AC43D, 0x6FD7212146574, 0x0001BB21DCD47 },
+    { 0x727E49AE99CF0, 0x0D0B3DF78F52A, 0x03EEFF32F822F, 0x77F78775B52F0, 0x3539D0CAEF4EF, 0x4B538F689746E, 0x2D8FC5836C646, 0x14777753160CF, 0x4E557CE48EF62, 0x675F7EA36157F, 0x600BA5F670BE8, 0x1D0E9BB383740, 0x3E3516EAAF034, 0x4F7578F81F519, 0x0002A3D9CFE5D },
+    { 0x5B92572A0442B, 0x6F496907E3F80, 0x03611BAE21D4C, 0x77A9E977F175B, 0x295C995751A6D, 0x7A5395E6E408B, 0x74D3ABAD69DC1, 0x47E1F50DE0C10, 0x5BA82BD5C338D, 0x2BBA272C8D6F3, 0x5D234FF868CAD, 0x22DF0D1D95F0B, 0x12C2CD8868721, 0x505C489017DEA, 0x000416772F37C } },
+  { { 0x3A6E65D772854, 0x725EFE9B11A2C, 0x16D6831FDFB01, 0x62A164AE9F0B6, 0x1F7661F9529E4, 0x10AB2B799D697, 0x7C9246BD82FFF, 0x7447212F40F50, 0x631F5D7165680, 0x4C9DA1D0C8F87, 0x024B3D8350065, 0x0C03FCFA3A39E, 0x1B236393A103C, 0x3894001517954, 0x000377415DDB8 },
+    { 0x4D918A5D980E9, 0x13EB294C92FFA, 0x604553CE40203, 0x1CCF68F20D12E, 0x14E9F56E62569, 0x44C03BBC7E578, 0x185AEEAFB8724, 0x552B17B250451, 0x4256846C4DE74, 0x5FF71011A04CC, 0x1940A5433C0A5, 0x2028774AA48B7, 0x131C431697389, 0x4B3A028D11DAA, 0x0000C8F65EF14 },
+    { 0x7D6CF113D1068, 0x79A718E3B6ED8, 0x6692E430C7DFF, 0x0733AF444D0B4, 0x5A4295171D732, 0x5E93AAE5B2FF3, 0x484B7EF55589F, 0x121D271BD1C91, 0x7AE0D59D5DBC8, 0x7F5A039205B5D, 0x4B3A26CE200AE, 0x28D6A5A2B5F17, 0x1DB2C1A3D5455, 0x46F2418F28D78, 0x00067510BBB6E },
+    { 0x2E31200B17EF5, 0x37F696B85EB3A, 0x23A067AD76F23, 0x5C5B0EF797183, 0x0035C255842B8, 0x7AB5A546CEDBA, 0x20D33E75D32B2, 0x7C1641B1D8D88, 0x314E49EABEF70, 0x4037B55571653, 0x23BFF9CD2919C, 0x6E2363ACDF132, 0x2F3710792EAB3, 0x2A016BA7E7F1C, 0x0003387593F8D } },
+  { { 0x3A9588AE215B2, 0x012D6A2DA4760, 0x4FD10509A0922, 0x67FEC0B3E11CD, 0x0131E598B4938, 0x16CD838D5D1EE, 0x01DDFF0976BC9, 0x52DF98B5366E5, 0x73A8D37438DB9, 0x0B839E8744E88, 0x3002C4AF4A34C, 0x0D6BA2A427C14, 0x520814FD62F81, 0x7D77CAD409E58, 0x0004DF2D92216 },
+    { 0x268848BA44236, 0x1A83E19B5EC6A, 0x5F7378B97A7B3, 0x5399013D99A42, 0x0F7CDD3C3C4B9, 0x1D2A91FF3865D, 0x39B67F3C05716, 0x2EFD38F0797C0, 0x5E9E338ACE1FA, 0x00C33DDE56DE8, 0x0BC99F4B3ED7C, 0x682C5893E55FE, 0x4DA398C24DE91, 0x1D75E8519B7EB, 0x0001C4C5C175A },
+    { 0x2561AC1237246, 0x78064192398B1, 0x24733D3601044, 0x04DFD56CF1726, 0x1C6C537C2B211, 0x7CC90CE3583F0, 0x10124645D74F6, 0x37AFD0426C72F, 0x1A8AEC7938F9B, 0x2B5F386205D99, 0x52F7866E6E122, 0x48452486D310D, 0x27CBAE358199C, 0x7B3BD00F6B582, 0x0003A89157358 },
+    { 0x7B168D25E3958, 0x68C5DA7DF82C2, 0x27AE4B7205794, 0x2953E498E9AF4, 0x51C2A9B96F57F, 0x54B203EC8386C, 0x6B99AF66832E7, 0x19FE5DA949272, 0x6658E8992F8DB, 0x7F51ECBD528B9, 0x523368A331300, 0x060A27765B6A8, 0x0559030C4F85D, 0x78F4A01C1523D, 0x000469C0241A2 } },
+  { { 0x50D6452F29A5D, 0x017492A267114, 0x59FE3F6EFE4D1, 0x5FA4D3BA8F1B2, 0x3E601B62EE747, 0x79129FCEC24F0, 0x3AA1E94545D7A, 0x21FF35FBB3507, 0x146F701B98606, 0x71A1181D13C1A, 0x773D1AAA26351, 0x1C3055682A18F, 0x2B1FD2A755A5F, 0x3A659A543B057, 0x00066003A6D38 },
+    { 0x73FF65D1E3BDD, 0x7C14FAD194CD3, 0x7EBB55BE374A9, 0x0C9CA13B5D426, 0x461854A913BDD, 0x079143DE98C3B, 0x21B47FC9BA44E, 0x6F99429DE299D, 0x0CD6AA8A886E8, 0x12C925F77ABA3, 0x05D76EEA245F0, 0x573E76AC0AC6F, 0x6FDC74F2F98B0, 0x61FD8DC344603, 0x000075F7838AB },
+    { 0x63C7C9A409967, 0x5C70E31C5D341, 0x56E649482B28E, 0x69239B5334C31, 0x567A2210C89B2, 0x07223DFC541DD, 0x00AD3F122F7A3, 0x18215136C40F1, 0x401D7E2D8C93B, 0x0F2555B2E50CB, 0x5EB1CF0296C5E, 0x7AC746C7367A9, 0x5C60A5BD8B2A9, 0x52B7724CA1423, 0x0003C1D6AD296 },
+    { 0x11800D3DBE059, 0x477750D4A2DE0, 0x6FED4BDE08647, 0x63E42069DB4E3, 0x7264DFAFE3E6B, 0x41B478A5C361B, 0x55E24FA162532, 0x4037CC8969E63, 0x74C1EDAE3343F, 0x3522859D561B8, 0x05225521A7F26, 0x5CFD947F0C388, 0x1624BA5DD93EE, 0x217D2F9CBCC4C, 0x000326C1593B4 } },
+  { { 0x1941DC95BAA5E, 0x6CB4722122C09, 0x662C716E6A8DD, 0x58F5565689A07, 0x1E2CA93E6ABE8, 0x2A1C985FEDD57, 0x0D8FB87107FE8, 0x1FB854F52538E, 0x4FA2A17C6E2A9, 0x6AE8E738ECDB8, 0x105A9664CA802, 0x62C6BB775A4C9, 0x3047DC01FD82A, 0x7D210EE097F6C, 0x00033E504E898 },
+    { 0x29640853025F4, 0x52FFACE1A5723, 0x14DBCB016C099, 0x7C37F6920C222, 0x295075359D649, 0x323343E91BDFF, 0x442337BBDF5FA, 0x6D2F4450D967C, 0x042A907CEE176, 0x552DE900EB67E, 0x35C236D6798C7, 0x03D4EDCB89A19, 0x7732CDC9152DC, 0x375665F6F7BFF, 0x0000B7D5A9D2B },
+    { 0x5284F940DD7CA, 0x3A4DBC47A166E, 0x72FB8C3EFE64E, 0x634684347A8BF, 0x79001F1C119EB, 0x7C8D9180AFFE2, 0x5C1DBBCF3240E, 0x4CAA03E513E6A, 0x447F0F36D70AD, 0x7879E5E39865A, 0x6D95A3FFF7992, 0x6AAB2DDE57E94, 0x4D112470AD6A9, 0x076715D6E003C, 0x000267CB06D71 },
+    { 0x6E7F12AB272A2, 0x09DA36837C0E4, 0x6DFB4D83138C3, 0x50D116829F8F2, 0x1583B80951F67, 0x4425ED284407E, 0x3C6083A97AFB7, 0x54B39804FE4D0, 0x397B57E0496A3, 0x003A8B38BAA4E, 0x79B4EA1F2DEC6, 0x594E989120DE2, 0x219E668E53789, 0x34BAAEB0DEE8B, 0x000421F16AD0D } },
+  { { 0x4ECC0830C45C2, 0x37900A0F4C895, 0x21B574E47FD5D, 0x242E0579DDDF6, 0x51043CF22EE08, 0x7755C795676A0, 0x2D09D3D2B80BB, 0x745AA905352DE, 0x75B06B61C10C4, 0x763DB72C50963, 0x4A0635EF88806, 0x3BAAA4F6BFC00, 0x05C081131824B, 0x7F0D2FF4803BA, 0x0001CB9C0F83E },
+    { 0x68A22139E9D6B, 0x31E4CA257FAA7, 0x15B259D73567E, 0x6449606E2525E, 0x018078B4417F9, 0x694B9D2CA2A56, 0x65898931B3BA2, 0x35648A0073896, 0x19EB24896B122, 0x38DEB65FAF31E, 0x1DB0B141D6068, 0x04466AA9BAD56, 0x08F75470A9CB8, 0x776F4847BF362, 0x0001E2EAEBE8E },
+    { 0x2D8ECD31F6C3C, 0x7834D7D4803A5, 0x492A02311B867, 0x25818A7D7D126, 0x3101AF37CA07E, 0x4C8C28B9D9121, 0x4BE545F59116C, 0x34D81E94DDDDE, 0x5A773714DD91A, 0x7725B38F20F46, 0x000629A432C91, 0x3B0F18420A7CC, 0x55A6BFBEE0A0A, 0x37BC171EB7B6B, 0x0002FCBF543A5 },
+    { 0x405DA0528EA57, 0x1DDFE554624FA, 0x4203F8D918475, 0x6F9C622CF529E, 0x4CA5870D4F152, 0x407CE6E4DAD2F, 0x6679F1235D30D, 0x7C831D970469D, 0x1CC072536D6B8, 0x6E50C42A3FF73, 0x62335E6477CD5, 0x6D066CC40D4F3, 0x0466FDE31F6FE, 0x3C262E2939B9C, 0x00048D0D4C25A } },
+  { { 0x10913CE8F5001, 0x44759D741C2F5, 0x2A83A5330FA0D, 0x2D8A1E4D1C34A, 0x4329B213CDFA6, 0x375EC2BC19304, 0x64159BCE98CE7, 0x2E41C7E076561, 0x1B609E7FBCE3C, 0x4352881F02EF7, 0x05B3DD9FC0DC2, 0x720FC7785B543, 0x2ED725BFC5001, 0x759BE29712B93, 0x0000DB1120971 },
+    { 0x30B973F7491EA, 0x412EBDC95E83B, 0x67A624563715D, 0x13B76A78CC455, 0x05E5071B0D99D, 0x65CD08033BE00, 0x6F858A7DC7D28, 0x792E791522C30, 0x552EFA4DBE039, 0x1DF703B93F0EB, 0x48BC1A0436D5C, 0x7E1A0BB9B0AF8, 0x718A1E9C4BE14, 0x21E350436897E, 0x00018CDB66DB5 },
+    { 0x46877E82A3B21, 0x5F6A0CF1C8276, 0x4836C2B4E5CC1, 0x1F5D2BCA67D67, 0x0CE0BB1B42CF5, 0x029A33E512EA4, 0x6D786F99928DA, 0x0CD14203173D2, 0x59F37E35A0C08, 0x48814EFB9DDB7, 0x425B1E5B7C933, 0x5D5303B15F448, 0x601E4B9EFCA4E, 0x04372570D7DBF, 0x0003B0026D787 },
+    { 0x7034F41115C44, 0x19ABE58A6432B, 0x7E916C8649079, 0x6837A71C09D3E, 0x4C73329DDBB48, 0x323B376A5E9F3, 0x487721F66347E, 0x2B07664615B66, 0x5A9E488DB0F42, 0x2AE53AFC20730, 0x6544A8342700F, 0x5E8C0A6082F33, 0x1783DA8AC7911, 0x333D7CC601D69, 0x00027CDB1DF20 } },
+  { { 0x072998F1BB4A6, 0x15A76B87786EA, 0x7ADA0E03C4E62, 0x6C4FA0BDD5095, 0x04CD8583BA946, 0x2D1116D066454, 0x2B0A46CD0E0B0, 0x2F84E5C00A245, 0x51FC27D82AA65, 0x60861EC685F75, 0x503D69513CA92, 0x0F4131CCFE887, 0x285EA8C924F5D, 0x7D9020A43F1F3, 0x0000EAD63209A },
+    { 0x0E003BBB138FD, 0x7A4BDC55A4A69, 0x28280F5ED052F, 0x4939FCCD3C60F, 0x283F9296348C3, 0x07560419D4F35, 0x1B40BDEF0E81C, 0x0F1A830060FC9, 0x5FD46491458B6, 0x089958E282CD6, 0x54EE252B7C86E, 0x558B34B5DFAFC, 0x39EDED7C08B4C, 0x2389BA6ED1A33, 0x0000F216F2F9A },
+    { 0x1F87CEFB5BEFA, 0x336355B0688FA, 0x21504979795BB, 0x50674EAB1A412, 0x3205898EFF69B, 0x0D1101D82291B, 0x33BCE7C63AD33, 0x37DEFA294C94F, 0x12D48B1977C50, 0x294FCEEBE379D, 0x2623754E8E2B0, 0x2EF4E660C3E64, 0x62B085A674F7A, 0x416D3690A5B4B, 0x0002BF770FC66 },
+    { 0x4713671784D07, 0x60998E950ED0D, 0x1C385E476DD51, 0x3EB9A07475428, 0x51D8B8FAC558E, 0x640C81C21EFBF, 0x27332A8FD1752, 0x5DF7DE17CADC3, 0x3D7B7756C8382, 0x789DFC659661A, 0x21C1C68D3503D, 0x32C27AB8F6988, 0x710550CEE5CB5, 0x5FF86F3C9494E, 0x0002B0C397FB9 } },
+  { { 0x22DFE5BBB4B74, 0x3F9DAFA028412, 0x5A5D799DDC3C2, 0x4BCCAC171DD9A, 0x1CC8B171CAAF6, 0x12059826D6771, 0x5944759052FE4, 0x2F612BB32A5EF, 0x44C9F82372416, 0x6297A9825E5EA, 0x46D946C4EE624, 0x135CDA36FE638, 0x209760151B2DF, 0x21ABCD1422FE2, 0x000191BC3EFB6 },
+    { 0x005EE2FB9AEF2, 0x2F176529E6743, 0x3A6A3E0D6346A, 0x67194FFB859A6, 0x02FC557B59003, 0x10FB1A92F2771, 0x2064CA94BFD79, 0x42030D21E7C50, 0x7D71A2118CFE1, 0x7E8EFB0E354D1, 0x321A64D1B4DAF, 0x7F60D1BBAE798, 0x16C43BED35966, 0x615ABFFC2B902, 0x000258A098ECC },
+    { 0x69986D4ABB8F6, 0x39B9DE4B99386, 0x38E8A321787AC, 0x6C90AA3883D7F, 0x766AE0AB11843, 0x2072C98D3C330, 0x3A9B2A96F0C38, 0x3A15305B83244, 0x696C281D1870A, 0x1B1C269A57958, 0x6D1B0F34FB13A, 0x270A7946308FF, 0x43940FF0AAB75, 0x04F0F024835C4, 0x000472AC52441 },
+    { 0x4E035AB907F60, 0x7CA7AC5A6A51B, 0x41FDA097D83ED, 0x371E33DCAC56B, 0x18F4A1BF3CA8A, 0x66D056CB076D6, 0x535A1AEDD603C, 0x214299BE03A2F, 0x5EE786047758D, 0x1BF24D6E875A2, 0x35CC2ECF89B42, 0x02CEA05E53024, 0x26AF7374436D7, 0x15B0864B62CD0, 0x00042DC951B04 } },
+  { { 0x063FED4BD37D9, 0x332E8B061FC86, 0x04449F89D9EDE, 0x19D694FA865F7, 0x1249F455420EF, 0x0DD7511753058, 0x6331F121FC870, 0x6A1521B420C15, 0x596CD9A5BEEDD, 0x577680B7861B0, 0x7177F3A2B31B6, 0x2CEF272B7EFB4, 0x7B867EBA5F3E0, 0x4995569CD01AD, 0x0000D03DDC452 },
+    { 0x2430501AC593E, 0x1B7316388F192, 0x63DCCDDFDD44E, 0x2FE7D145CB15A, 0x2553E516730D8, 0x2A571ED28682F, 0x479DB656A5357, 0x470122814B143, 0x27DB4B7F3593D, 0x7DD2E190ABB9A, 0x6E31E736CEA50, 0x0FB26A6A435C6, 0x10C7751BD9338, 0x467FB354BC8C5, 0x0002803B96D8E },
+    { 0x052F6413C8573, 0x4C93C5543AAE4, 0x7778DB80070D3, 0x57782395337AD, 0x2DE44CB157DFD, 0x19032EBCD3ABC, 0x0D6F9D42CB66B, 0x3278D0D7304F8, 0x71651197CB098, 0x07283AE3868D5, 0x0D29E28B5482E, 0x08363D878E158, 0x6332342EC510C, 0x799AE953E8CC6, 0x00037F467F323 },
+    { 0x3E8B0667ECE02, 0x3E3432D458146, 0x308FA2AEA08B6, 0x45F32D5A4B830, 0x1AC301427E7B5, 0x7B1FF0CD8F853, 0x739251B4E2714, 0x66978248430F0, 0x2A6391CBE54B1, 0x0B430FCCA6DA6, 0x792E3174C9DBA, 0x0E87D3E5CD385, 0x6020A5E170935, 0x21C952A0C1A06, 0x0002AEE71854D } },
+  { { 0x69D88B9AB580D, 0x047617CDDCF2F, 0x5C48D2BF724F6, 0x721BDB19EF4DE, 0x3BDDC13687960, 0x06535CEFBC301, 0x04DFEB6321D90, 0x796CA95902CC9, 0x478E8E185A0B3, 0x5C45C15996E84, 0x3BBD80284D096, 0x703FA64C9F02D, 0x5348EBB695CAA, 0x38F50090CE9AC, 0x0005B1CB57DBB },
+    { 0x7A8651FB32D17, 0x57A6A604E65E7, 0x0F1863D2F78E6, 0x4C3928070BCC9, 0x43E3B95A7193F, 0x1A1E9068FCE7B, 0x0BD6764088380, 0x4AD99F6F83BFA, 0x0B3DCFEB81294, 0x3E7F578A30A7F, 0x17A80E09A31BF, 0x05FA5657B2099, 0x056AA7D6BAC7F, 0x7BA18EA93D0C9, 0x00011B8362B2D },
+    { 0x0B9D29171866B, 0x0E46E1AAE36C0, 0x79EB68EAA4D4C, 0x374CAF154BA41, 0x786D551E58C97, 0x7940F2EC73843, 0x0AD323F8E61AA, 0x38B7B856ABF36, 0x081AFDB3ED5E4, 0x2D69518F4A955, 0x319B17E773A07, 0x2EBA40238FE40, 0x07BBE15D0D87C, 0x46EDEFAEF3D65, 0x0004B3FC09480 },
+    { 0x0ADA60272660B, 0x7B29E1F1FF04E, 0x547647137679E, 0x6BE0688AAFAFE, 0x1A3C5605D34E6, 0x2DEAFC3B85252, 0x06832587B3DDD, 0x1A42F842DDCA6, 0x22EBC19FD95FB, 0x0A3B8E2251DC8, 0x4882A54D57143, 0x2D680F3BCC6B4, 0x6FBC17455F772, 0x4FC8E4ED30ECE, 0x0003328D9751A } },
+  { { 0x15AB9656D06E8, 0x41ED3CAF375FB, 0x167C2F09634B3, 0x6EB8A0A92EF17, 0x6F41197522D10, 0x26882EAC0C944, 0x7636B4B40FB42, 0x353DB6878E510, 0x314F268765A84, 0x1AF8D33A080FD, 0x247091F25C3C6, 0x268ED3F72142E, 0x5238D1C111DF9, 0x089C52C0DA87C, 0x00022B2ECD06E },
+    { 0x3A1102CF4C502, 0x6A426F83A32F7, 0x18276A56CFC0A, 0x31FE023E58A9D, 0x1B60995DF3538, 0x6CFFADE66AAB1, 0x46453191B290B, 0x5827A9FD4593F, 0x6E8967FBDC744, 0x202862BA994DE, 0x306C6D86F33AE, 0x1B7EDC16D96FA, 0x320AAFB06FC72, 0x2212F4DDB5969, 0x00016D7E0EBEE },
+    { 0x296F1029464E8, 0x3AE9AD940496A, 0x2EF35CE5F00C2, 0x784721A9691AF, 0x76EA905BC793C, 0x0447A23DF6420, 0x448865C795590, 0x27C38140BE630, 0x3B2C2B1EF766E, 0x263DE0B038DE2, 0x6BDCDF94DA38D, 0x3B38885246E2A, 0x522628E96FA4E, 0x650EDA8A35C93, 0x00047E3E39DAD },
+    { 0x1E1A6F3A6AE4C, 0x54915D8536D60, 0x0BE9E7E439489, 0x5670C4441919A, 0x310724A292442, 0x592619D607676, 0x6DF750265CFBD, 0x4556A2AB911EC, 0x11EADA24E3391, 0x23DF3E62A8278, 0x4C3570FDC715A, 0x3159A25AD1FE2, 0x1AF15BCF0EAFE, 0x607225D9EAC7D, 0x00033DF847C2A } },
+  { { 0x4D32E69ECC95E, 0x3DB8D6321BCB1, 0x556E90298C9DC, 0x56556A9665724, 0x5E04DD2536F88, 0x78975C14D422A, 0x08A1189B87F38, 0x0F232555EED0F, 0x3F5C96C54D993, 0x5403B6FC95724, 0x2240E13E13805, 0x3B060C62F72E0, 0x1753B6340D93B, 0x13AE8DAE5BD9F, 0x0000F1C1DFC59 },
+    { 0x3BC62D9AC5400, 0x64D404A6D4C2E, 0x535213A45B79A, 0x61EC9919DCF08, 0x1977838A1C86D, 0x60873E98DB4C4, 0x1418B9B2841CD, 0x655431C97A621, 0x3F2AB26149012, 0x4D46693867A01, 0x0B19C1C12DDC2, 0x43EDF7C15A717, 0x2535814B70998, 0x369265E448CB7, 0x00015F36C56A6 },
+    { 0x2086FD74FB272, 0x7217D33006B8E, 0x084A2EF093ECF, 0x6ED7292346FB6, 0x7CC94A766E62E, 0x61C9FD4BE997A, 0x2E04A6FD03F1D, 0x73652B90FE2C8, 0x65B0586F826B1, 0x744953CBC33E2, 0x0B044E91F42B7, 0x1ACFC2C67E6DE, 0x10EFB60F36AD6, 0x27CB88AB28518, 0x00030B4A35403 },
+    { 0x01DF90A3A85C2, 0x1FD977C787093, 0x79D49ED68FFA3, 0x0E1CDE96805A4, 0x0E4A06B053791, 0x0E2DA7DA305AF, 0x29EF7FA59EE40, 0x7C9C61B619E2B, 0x7E3E4953DB840, 0x0CCFC9973FD74, 0x36181E5EC862B, 0x270FF67D02969, 0x0194AE4142D82, 0x63E1E5586BDE1, 0x00040605BE9EF } },
+  { { 0x127ADC18D0567, 0x011AD1A1A768F, 0x1E2EC37BE3210, 0x34F96C9F32C66, 0x453011BBA4C03, 0x0D0EC55A4C647, 0x0D8F1B4048E4A, 0x7736EA604BB6A, 0x52AED85172370, 0x507D4DF66F725, 0x1E1881E5FF09B, 0x0A0E906AF0CAA, 0x21BAAA9AD6D5C, 0x33AB13973FEFA, 0x00020DD91B112 },
+    { 0x614B6AA1BDBBF, 0x47A508DE55548, 0x45C5994FD9FF2, 0x2DBCF299D9B6B, 0x75CE528763EC7, 0x79B620DE7B629, 0x53771464202C3, 0x50676EBCA9994, 0x05AC46A48D0EF, 0x5FF797CA39020, 0x37B11203D3E27, 0x0537E41C6DA76, 0x666398802A619, 0x0AEC10A54CBEF, 0x0000B70D176BE },
+    { 0x19797EDE4B047, 0x454B754D84528, 0x3CEFC818557A6, 0x7C59015E2EA19, 0x385DE0A3AB287, 0x2F43335B9F0FE, 0x19480E0229D12, 0x1A88C34E300C3, 0x182ED7D264179, 0x63E6872E32EDA, 0x124FE0E33F78C, 0x41DCED8AC4403, 0x2FD12BA47350B, 0x5FA0C28CD73E6, 0x0001CDCA6553B },
+    { 0x076E01571AB6B, 0x091427534F3E6, 0x327F58745ADE6, 0x5CB02553032C4, 0x07D68342C72C8, 0x47113AB4E8259, 0x400FC93395CE1, 0x2B64628E08D78, 0x771DB784DC348, 0x465B299D7CA51, 0x755F45B23E8C5, 0x3DA7A1BC4D1CB, 0x37382177F48E3, 0x248BC38409A06, 0x0002FBC6154BA } },
+  { { 0x0DDB482921501, 0x4AFEDF4C7C3DC, 0x1ECC34952C42C, 0x6A3E7EECAC436, 0x07CD77E28D7BE, 0x314EC6F2D1510, 0x415957D06E0A0, 0x4083CAEA0295F, 0x7C47ED3A4306C, 0x345244512985C, 0x5C6BC95A891FA, 0x1CFA4BF25EBC9, 0x410C5CA216F38, 0x6F56E3076166E, 0x0002A6BF6C15F },
+    { 0x047CEFAFE2D1B, 0x71902786F0409, 0x1EEA17032E8A4, 0x2F0D488D3CBC4, 0x33B1D243D1D86, 0x2F40E4971395E, 0x07AB96CA8503D, 0x1C69569142E88, 0x7535F97351889, 0x3E5111EDAE59C, 0x798B60B62CA97, 0x1E049291B95CD, 0x317BAB33394BE, 0x1405ADABC701D, 0x000128D38179E },
+    { 0x05384F6745AF1, 0x2B79DCA1F423C, 0x31B4B0F06B200, 0x1374A24CADD64, 0x67B98567F52A8, 0x6596AB072CE24, 0x0AA7227DA4D22, 0x3824B23D12F03, 0x0F324DAB8D98D, 0x791267AFA7962, 0x72380921A5606, 0x1E8EE19C81B3E, 0x39E2D6E763CB8, 0x695917BA8ABAE, 0x000538B7E0DBA },
+    { 0x3B06D9EC401F9, 0x328D25D480AB8, 0x507B049E65FBD, 0x0ACB162DD3A78, 0x7C0BE80CAC3C0, 0x4BF3462E2E448, 0x2BBC0BD106D1A, 0x64D56343963D4, 0x2D58FAF455D34, 0x42FA53C994942, 0x1BCC42641463E, 0x3043323AFADD5, 0x7DA30CCCB411E, 0x36ECC9AE7BBB2, 0x00034E9FF982D } },
+  { { 0x73189DFCDF00F, 0x20A4FAC2D3195, 0x0178CA41298E7, 0x2ED1F3A8CADD5, 0x0F8162A9FAA53, 0x5C2CCE2656B03, 0x7B9633DA22923, 0x4126EECF37442, 0x39E02DC62D497, 0x78178B5B576F5, 0x5DCB692CF7A5A, 0x63656AF76AEA6, 0x4B42DD1DC3337, 0x7140266A8B310, 0x0003B24169C10 },
+    { 0x3D24A8D50F807, 0x7F33EB7F5B18F, 0x6FA7BE043BC9D, 0x637FB8022A5F0, 0x269657D060A57, 0x1F7F70151E3A8, 0x314EDFB594512, 0x6FFA17868EC7D, 0x39E2DF64B2B9F, 0x714F54CA07B22, 0x0440D37B8FBD6, 0x03158BBDA9D5D, 0x4C365D4A68F45, 0x444C7DCB9E673, 0x0000C5AF3D7C7 },
+    { 0x07CFB4906A8FF, 0x4C847B52DC36F, 0x1CC84716AB8BB, 0x0D6B964BE97B2, 0x26A0C3DB572C6, 0x5B8A58950FBD6, 0x0271BA3BB33EC, 0x3C04C59AF7D78, 0x0A7371F971CEF, 0x67B6552A6748F, 0x02845E0C481B1, 0x05B8665C5D0AF, 0x7FE6FE5BFD327, 0x142CD35A9C485, 0x0000B4336A1D0 },
+    { 0x1B538440182C1, 0x1D915D2D0878A, 0x6D83EB5FEF2CE, 0x300E672E217EE, 0x6B61A00054819, 0x620D492E8468E, 0x4D8A23D89A4EE, 0x564A2E4D246EE, 0x672AD86059A10, 0x2FF2B9BA12FD9, 0x38524F23C45C0, 0x32772458DAFFC, 0x1C9B51D7B3314, 0x1870A724732B5, 0x0002D130C8F02 } },
+  { { 0x2FBD511C0DEFE, 0x6AC42A90D93BC, 0x582EDE185650C, 0x4FFBF4D490954, 0x6F379365BF069, 0x1EAC99EBEE177, 0x3A208761022CE, 0x1DF2A0EB01511, 0x51894A0ED0181, 0x2F48782FABCAE, 0x4BAE15AD3FE03, 0x42822CD511E9B, 0x6C6D57275F4B4, 0x19000A08FB7D5, 0x000463453F92E },
+    { 0x351F666B181EB, 0x3A3607E7140F5, 0x56B2D4849C1B4, 0x0F0D205D10E1F, 0x4E3A44C642B2E, 0x63EEA85166047, 0x7FD3D86B8D2F8, 0x45306A169B63A, 0x1EEFE7B3F7FD0, 0x3651FD23BFD3B, 0x3AFBAB6C1CF9D, 0x169688C5EBCE1, 0x612BA8D007D0C, 0x2BF491E5A53FD, 0x0002053E85FBC },
+    { 0x45A001E4F865C, 0x5AD641B0053B2, 0x382FA55D6EE38, 0x04B77163C9ACA, 0x64300E7E2A974, 0x6C2A0953B0C8E, 0x325EA96680EEF, 0x28BD5C5595CDC, 0x38710E7B4871C, 0x0F7D3A009EC7D, 0x0AE9E2CD24B24, 0x3F1648F212EBF, 0x3A8CCEB3CE0F7, 0x16628ED1F6170, 0x00034404B6A16 },
+    { 0x2C24F48B1D0A3, 0x235E7FF6AA940, 0x3F6DDD16E5202, 0x4033841591D2E, 0x70A89C635EC0D, 0x01EBA331BF068, 0x3C3BB9ABA1A29, 0x3066AB358ECC4, 0x1ABE5AAAB18E0, 0x6015B8D1B39D5, 0x7278E2BFE2721, 0x5B9D0DB32569D, 0x41CBB3DC2107B, 0x43831BCD92EEE, 0x0003C38E2017D } },
+  { { 0x1CB365B0D9DEB, 0x7202176895A38, 0x710A645E57462, 0x7623B2E7C5D28, 0x4B79A7B24F5AA, 0x69E879B3D2ADC, 0x264A378123B9B, 0x1DB910B0BCF42, 0x6DEDE506E50F8, 0x11FC382A32A92, 0x16D7DBE6911B6, 0x21CB09BC911F0, 0x6F9A590AD2EE3, 0x564E5B0AD5049, 0x0001C10628F14 },
+    { 0x7ABB9C8BF5DD7, 0x7D3F0AB9F973F, 0x29857186A08DF, 0x1EBA4C6544A71, 0x3BE785B08AF71, 0x3D09BC7982D4B, 0x722F3C7E4D619, 0x68578A1E54987, 0x32FB9A2434214, 0x7A74067E17E3A, 0x6F5FFD0DE5CC3, 0x4DD15FC7C22BA, 0x2A0CEF18B0BCD, 0x3AA331D7CB46E, 0x000117C57EA9A },
+    { 0x29A4EE3AF93BF, 0x7DAFB99CF7F68, 0x5A320930D0D8E, 0x17F6D69D550F0, 0x1C47D5C6E0C48, 0x6A8269625650E, 0x4438706E02CEE, 0x2AA6F351A7F65, 0x3974E5A2000DC, 0x4C3174FB3B895, 0x3B84DFA950157, 0x64B1C70BDB62B, 0x55F81466466EA, 0x0375AAA1FF2C5, 0x0004B3C69D7EE },
+    { 0x3A4A4DD3E6573, 0x782B5D45F7514, 0x48ABFF3EC6F12, 0x6C6FA1F4528BE, 0x099F519EDDC5E, 0x55368A3A96EAA, 0x39B5434363AA5, 0x20C00E83F1A3C, 0x383D087D16BF1, 0x0692D15A3252D, 0x0A83BB9568C77, 0x13A5DEEC08E14, 0x5849E1C8D2F88, 0x3D4E093E2821E, 0x0002A13150F52 } },
+  { { 0x644DE455599C6, 0x6B6FBED3D26E0, 0x59C2D4C35D6E9, 0x056FD63F3857E, 0x6BE7B37A3CB8D, 0x462D71EBA90F0, 0x32457693AE6E4, 0x7171FAACE2650, 0x1126EF0936CC5, 0x35FDF16A683FE, 0x37B5D7EE41941, 0x09C8BAABA49BA, 0x76DDA53975BA3, 0x6C65E30A492B7, 0x0002E5A13D5CD },
+    { 0x7766C701CC716, 0x44DC2906E85A8, 0x77C0224D7BB71, 0x3C4DDF426FCC1, 0x5B8AE881E2905, 0x4CADD49A98D07, 0x654576C5E9B42, 0x3ABD4A408791E, 0x2BD132D780D38, 0x30A30DDDC9315, 0x634181ED4BE4A, 0x392D682FA695E, 0x74F7289527A8A, 0x1CCBB7441A6F8, 0x0000544C9F88D },
+    { 0x6AFF1437BDFD4, 0x58F77A386DE0D, 0x3AB4C117782C2, 0x7DBF12B232CCF, 0x3EED328BF42DE, 0x762E10F9BCD02, 0x35EBBD9B1D52D, 0x476E123DED9E3, 0x762825406E026, 0x77A06F399339D, 0x3A0E3B268A858, 0x1A18678F21E5A, 0x0BBE9D9989833, 0x79D8C5E67C77B, 0x000386B0A18D2 },
+    { 0x72422760AF4C2, 0x3FC6BF3AE3693, 0x5FB89DB593075, 0x0547AC0AF9BA8, 0x0165B4DB0BDD2, 0x33F0D65BD5A6D, 0x44409EBEE71C6, 0x06CF1C60FFF4A, 0x1EE56CEA2B4D2, 0x724B1FCD1BF71, 0x3BA9171D001AC, 0x02BF2F3EE9CB0, 0x2B207639462CE, 0x2697D4CA9809C, 0x0003979AC6056 } },
+  { { 0x62D21B453A276, 0x7A92A6A9AC254, 0x7DB530443F6F1, 0x5A26636B92F2A, 0x2B6A0A27E79BA, 0x776F680CB1CA6, 0x7A320B80C448C, 0x58C54FFEB517F, 0x651256CBAE166, 0x0BB994E896B66, 0x23D0FCDD04121, 0x16EC2C2563D4F, 0x6885D2B0C5316, 0x4306F3858234B, 0x0005F87FB74D3 },
+    { 0x0B8C1DED31384, 0x05FEFFF1A7C29, 0x61E8F9E3E9F6E, 0x1F527A3DA3126, 0x320992EF769B6, 0x0F30CDA7D0F0F, 0x11A4EF76DCED6, 0x3884527C74A89, 0x3936120F769CB, 0x0398882FF9784, 0x3D53F8A20C0EF, 0x17AD3E248A844, 0x6FF24C6B61F85, 0x1AADDC9497AFB, 0x0002E58D5EE0C },
+    { 0x6877E5C90E2BC, 0x0FD36D4F012F9, 0x18F56EDAD351B, 0x3F7DA1A2CF7BF, 0x1A3A6E61B8019, 0x1DA857D7DDFB7, 0x6A8FA817F7630, 0x31384C6B08FFA, 0x4B8C4245988F7, 0x65B52D8CB675E, 0x4587980255E50, 0x7DBBDD29CE440, 0x3BAA889CBC33F, 0x591D42C896270, 0x00038FE00372E },
+    { 0x23EE4F2BE5FD4, 0x7F2A5CA8A0CD4, 0x0D01EF60D27AE, 0x47E7BFF8E1E76, 0x1B06C7B7482D9, 0x653C9421CECE0, 0x5E28A7A5B063C, 0x42E6CAAEFD3B3, 0x282B5AD27C697, 0x1BF3548A8A28C, 0x2D8C980608D24, 0x58D999ABD1153, 0x103789804E13E, 0x52ECF79E0E91D, 0x000406EFB94B7 } },
+  { { 0x7EEAD63AC1F02, 0x33BBB804E9C15, 0x28FB878304B69, 0x418BDE5C52A32, 0x0B5DE9373081F, 0x1884AA0BC7F61, 0x12A7FBD8F73ED, 0x75D5C863163E0, 0x0EFC3010ACB46, 0x56D6FDC6B4ECB, 0x39696EBD50F25, 0x32D698D616074, 0x778A7AAF22D30, 0x28396D1E4AD5F, 0x00030F2AD877C },
+    { 0x48B5ECE61E9FB, 0x585D9FC902092, 0x5B4391B0991D5, 0x7D49B14450AF0, 0x08C9B61A7F460, 0x45848A4C0AD50, 0x4B38A7BE8ED8C, 0x37881F774A069, 0x108B4F78EFF38, 0x72E4846183784, 0x7540BBBCF611C, 0x2659B01166A9F, 0x6A6B0F530C480, 0x0DEA3AAA14A79, 0x000182E904C4F },
+    { 0x13A27BAAD07AC, 0x210CAFCB2FE6A, 0x58CA9353AD1B2, 0x2F36901A8DCD6, 0x12C57B6F4F98D, 0x37C8E0DE01770, 0x76542F0CB0A7F, 0x678D4061C2ECB, 0x4E6CA5C0927D4, 0x3BC05CB27E621, 0x29B8AE0C88A36, 0x0D3DE92DBDEEA, 0x48CE81E40312D, 0x2DB580606768F, 0x00052639BD4BE },
+    { 0x5F122FE3BF3C9, 0x6A4E252B948CD, 0x47F7F391CA304, 0x48F7146C9176E, 0x35AEABB3E5214, 0x2E9F409890960, 0x3C27B42A04238, 0x5EFBBC1EFC022, 0x005AC29B72010, 0x436E13DD1176B, 0x18820EAE86C03, 0x5A0C97327CFFC, 0x35C29400404C3, 0x2CBB62A5BF25B, 0x00042C19C77DD } },
+  { { 0x69EFD7E90F200, 0x211537EC75947, 0x42B5965FA2C67, 0x1F43201395479, 0x1BE33963B9A21, 0x7451B8F9921D6, 0x75C7D4498D0A6, 0x07F489732BEE5, 0x6F54D85D9595F, 0x5232ECCE9E1AA, 0x462C2D19424E3, 0x347CB98793E5D, 0x0A0FBABBBF30F, 0x02973F4B1281A, 0x000481B69B3AD },
+    { 0x25ADFDEE81217, 0x7CA50692E2E6C, 0x1EAA66A65100C, 0x729911B2C8619, 0x0EFB7B601674A, 0x152551E76F8F8, 0x787A3F63B46E0, 0x44490AB165056, 0x406297321F6B5, 0x39EF48C356A44, 0x1287E9D8DB538, 0x21866937883FE, 0x331370CA12F7F, 0x5E64C32B78418, 0x000105BB4E700 },
+    { 0x154AE6DB5E1BA, 0x156257750472D, 0x4CEB17FB621BF, 0x53AAE175496DA, 0x1BB8627789081, 0x13F7953A93CF4, 0x73ABA2A9708F5, 0x7B7ADA9BBD0EE, 0x62D9830917116, 0x46A2B72AF99E1, 0x566300AFFA3E1, 0x1115FDBF134D3, 0x6732BF65A5592, 0x106F1A90DD287, 0x0004024F62B3E },
+    { 0x3E8543EAF53F3, 0x23339765775F4, 0x1796D0E074AD9, 0x6F69DBFD4E996, 0x0A89C1684F848, 0x3E2AD7F9EA770, 0x1AE133FC95C5A, 0x3CD3EB33BA3D6, 0x3945DD2FF906F, 0x2FF64E8EECE94, 0x11E9BCB6267E5, 0x5B8BA04DBFDC7, 0x15E64DF554C52, 0x4F345986F9246, 0x00043D8B67280 } },
+  { { 0x67467BD4A1315, 0x28F66750C1926, 0x3D64C3DA01B48, 0x22BFD886A4D02, 0x7C91E9FAC72D7, 0x08455D5EBBFCE, 0x426FE6E1556A9, 0x318BFF0343B86, 0x3B0AF8360841F, 0x4C060F65ECF60, 0x3ACFCED3F0277, 0x5D229AAD1FBD3, 0x6620637D3CFD9, 0x395A00FF0166F, 0x0004C5D7109B4 },
+    { 0x58378355DF487, 0x37EBC6499F6F7, 0x2E8C27B170AE3, 0x69F9D17CC889D, 0x6D4B859CB9A79, 0x0256352819956, 0x5AF56F5BC7A6C, 0x0DA2BE20B8A53, 0x6614973063D48, 0x54A150173F182, 0x1AEA239906BEB, 0x7A889392D6D64, 0x05D5BD03B5CEB, 0x0850EBD7B6F9D, 0x00019D8F8E6A3 },
+    { 0x777D467EBCDC9, 0x72878C0793853, 0x1757FD84D1DFB, 0x585E6C960CC70, 0x18917359B8233, 0x4122D4A249E3E, 0x6586B46CBEB10, 0x347DF4ED8D6D9, 0x5EA7ABAA7D839, 0x3366197FB4D6C, 0x60C9A759835BA, 0x5DCA2369BF510, 0x349ABADF11043, 0x7D16642325CCB, 0x0002EA5A764B9 },
+    { 0x6024021D9286B, 0x643D24A5B6785, 0x6F9DA1ACC1825, 0x43331E34DE2C7, 0x45778252D4B32, 0x25F50CDC80CE3, 0x5FED17BE5AB82, 0x3FF03822E619E, 0x751875D10DB9F, 0x08ABC89ED2475, 0x028F85DE4D8F1, 0x2E462F9541E00, 0x5BE83737AA90A, 0x35557507D66E6, 0x0002467EAA902 } },
+  { { 0x7E9AF840A45CF, 0x5090354927C37, 0x50EE59691A419, 0x4E24BB122D661, 0x70D1D5F276B73, 0x3474724FD174E, 0x10E5AC830056E, 0x49F923BD9DD2B, 0x7BE1925393046, 0x5F9DC1C0380B6, 0x101BC11FE1439, 0x0B9EDC35E9EC8, 0x386EE8C3437D7, 0x6718059617425, 0x00034981D193A },
+    { 0x072692D7BE545, 0x668C18EF77834, 0x08FEE7A5716E6, 0x60E363171BF7B, 0x2A635A3562D5B, 0x4704F72085545, 0x2FB8DC51C6793, 0x04E7F135495D7, 0x6B7A739FDFCD8, 0x142E44048A29E, 0x78310C0485E12, 0x7D26D21E5E3C5, 0x05F90862C1769, 0x0A9381719A1AE, 0x0000D4CA8E116 },
+    { 0x196223A7AA18B, 0x595C388D986C4, 0x70AC5D119D3D2, 0x20F77B884A131, 0x0E0B56C8A195F, 0x33C8098DEA21F, 0x694944A61A3A0, 0x00B6A6E0B83D7, 0x5F6AA162ABD3A, 0x1B6D4DD998663, 0x12FAC7723E527, 0x7767AC32CED18, 0x7B409EF9B0CFB, 0x7C84119CA0A7E, 0x0000FA878D35B },
+    { 0x4B2AF1B08A783, 0x744781FBE8B02, 0x1A0A0FABD5746, 0x6A8CD8FC8439A, 0x631B0F344C3AD, 0x645C0F9F0DD9F, 0x66DE074789BB0, 0x3CEB5C59416F2, 0x5659D0A9E1D35, 0x358B0D8A41AF1, 0x6C9D0D54FC030, 0x3600DA38A2F39, 0x7079181ED43BF, 0x18C0883FF3393, 0x00042F57DDA01 } },
+  { { 0x690EFB18E0033, 0x79F99E6430F56, 0x631A5C2D19778, 0x736AF4254A98F, 0x7D78387E0626B, 0x3840941F192A7, 0x2CF12F9053FA9, 0x5CD15FD953F3F, 0x43DD636C62A67, 0x712737F2C0DFF, 0x3786991E6B5C6, 0x66CA83C037867, 0x0823EB75421F6, 0x6B5EC881A783B, 0x0002C1277D57A },
+    { 0x06427F4ECBF0C, 0x67B16A229DD6E, 0x22A00AC6DA965, 0x6EEDBAFE94C8E, 0x70511800AFDFD, 0x29B2E9DE6166F, 0x1FD839989B183, 0x28197C53F48F4, 0x7F82E55391A7D, 0x1EF8E57D8FC0E, 0x428BFB10366E8, 0x7D2A9F9CEEE5F, 0x3BB1EE673B20E, 0x47CEA5A35EABA, 0x0000FE066CB9B },
+    { 0x5EF3A894C0629, 0x450EDE4D8AE65, 0x198EE53FE6012, 0x5C242696EEAB0, 0x403942160667D, 0x3C0CF9108CDD0, 0x6A09C34B47896, 0x2FEC2A583EA53, 0x61E639779F4D5, 0x07AA8BA7A8CFC, 0x2F831C58B317E, 0x2CAEE15BBF147, 0x59E397A834405, 0x2AC5EB3E1B84C, 0x000227B439566 },
+    { 0x6538840B3834A, 0x55472F0D3B862, 0x4100816CB1F9D, 0x387F923BA440B, 0x3308ECF1644A2, 0x4700EC3ED1891, 0x43EEF05D2636E, 0x2858EC54D7B43, 0x6B6E7A475B906, 0x7564ABA7E9E4B, 0x50BD9B308C379, 0x106D1EE263A91, 0x25CAAF97F36E2, 0x5532B70DE9B6A, 0x0003A8F5695A2 } },
+  { { 0x2E6469087AEC5, 0x7D5FF8B77DD92, 0x5D39411A82301, 0x7772AAD3A3AF3, 0x4746D89295536, 0x590A6975C86A3, 0x3C78F1FBA944F, 0x596FA38048391, 0x7252899797A48, 0x3D7877787C00D, 0x2259ED60C1668, 0x4C3B2C4D7127D, 0x5DA0E052B3258, 0x71F224919091C, 0x0005089348F88 },
+    { 0x3EE1D598DD44D, 0x32F83A6F64E7A, 0x6B953A3E89884, 0x5D244F4CC702B, 0x7B3E311A3233A, 0x39F8B637CBAEA, 0x39B9AA7DE2454, 0x11CE109375CE1, 0x24D857B3D5F9A, 0x6E5FB5556172D, 0x179461B65A761, 0x7B9BAA2A21C7D, 0x317D224202710, 0x0D3CA0BDD92CD, 0x0002CE1CED29F },
+    { 0x48EC0D25087ED, 0x3DAA1E015F373, 0x5AC2A59CBEBAE, 0x57E17FAC29DA3, 0x5B653195E0C30, 0x76C17314B8C9F, 0x3F8356F271763, 0x4F8576112EDC9, 0x49DE54DFECBCA, 0x0D5DFBC75B3A5, 0x392932AD1D2B7, 0x3C62DE7DC1246, 0x46FED67B70F0A, 0x6423729C5521B, 0x00018FD014638 },
+    { 0x495A51B631779, 0x063FAF0FFF445, 0x7040469934BA4, 0x379F671162266, 0x008DDD361DD44, 0x3C9A287D1094B, 0x3142B1E873603, 0x2C100FED9E2C2, 0x7368E9E4D194A, 0x62539EE209054, 0x62E341F4E952B, 0x0386F86092B41, 0x6C190D44BCB32, 0x78CBCF5426385, 0x00032071E43BA } },
+  { { 0x70F4E2D2E8D2D, 0x7CBC56562CF21, 0x520A6441E7A9D, 0x5ABC72FE76BC4, 0x581BD0FF406FC, 0x11172B51E78C9, 0x1F0B2626AD9DA, 0x1837680587755, 0x0A4995FEC0BA9, 0x3A4F1676A0A32, 0x0927547782298, 0x3840F9D17BD37, 0x7213391377FC6, 0x2F3BF558CA3A6, 0x00054A7796FF4 },
+    { 0x637AABAE85F4D, 0x004C49B72D7A8, 0x1EABE2170C244, 0x29325322C41A0, 0x3E64FC285E8A4, 0x4C3777A523D4D, 0x7EE21142747C2, 0x2C690DE48A2F1, 0x79189D05DBA8F, 0x0C1D1520B6AB9, 0x44AB47EA58BE9, 0x24F815491119F, 0x48DDE5E6B97D9, 0x3535C74F8FA69, 0x00030B7499B2D },
+    { 0x6A3F416E96179, 0x0031F271A7CE7, 0x374F0DB5503EF, 0x31F17159FFCA5, 0x0AF307B566E64, 0x503A870F44B75, 0x2419741E36E47, 0x4AB379652DD45, 0x49559B1C780D1, 0x2046A172F8462, 0x23A7611672308, 0x1F0E80265126C, 0x465B3B28D2659, 0x079BA886FE1EA, 0x00021E9A51447 },
+    { 0x5C8C600934DAF, 0x2EC9D52BFA20F, 0x40EB1D06A6D8F, 0x6D41AB0428AE1, 0x393E77227DB40, 0x3C6EBD83E7C55, 0x55DB07B91223F, 0x54AE48DF81BC0, 0x4F008D170416A, 0x5DBCB8F18D78F, 0x6457C07B4B2D3, 0x7A529312C9D8F, 0x2CE7DD141A13B, 0x3BC1979CA7783, 0x0003C04FCEB50 } },
+  { { 0x23BB83866C8F2, 0x2C0C700055916, 0x4E5A05822C643, 0x479EDD4620654, 0x25C367A21D87E, 0x7EFD5C7B3A9D4, 0x343C245BFE5BF, 0x42453E98CE9C5, 0x106B6E56422E1, 0x2CE1075F6E8AC, 0x7DF482D0D69E2, 0x5487A5C24A0E2, 0x4323FE58F2372, 0x5BFB485EA1EC8, 0x000581D322C4E },
+    { 0x5CB80A4D27111, 0x5AA687D9DA791, 0x52946B9EF5D33, 0x099AA6DAA27CF, 0x62F70D900395F, 0x292294779AA53, 0x531B9A3498025, 0x4864D45DE02ED, 0x435A02E89EB00, 0x40649B966A365, 0x4C188EA426B89, 0x37D521F1488A6, 0x4ADF00017C6B0, 0x20216D1EFC9D9, 0x0002111A773E2 },
+    { 0x4FDB863C47E42, 0x10EBC1FD17583, 0x000F77A4DD3A6, 0x785A7CB78D81F, 0x0CD81D92C8C42, 0x5A5F7D29C9A7B, 0x0703D5B5D4C6C, 0x372E9FFC6C365, 0x10BE128C65D26, 0x7EA476FF665D2, 0x528DBA17D7E74, 0x68ADE14919035, 0x25D86D36F9BB4, 0x71B93774551FE, 0x0002A72A8E37F },
+    { 0x618E05B94BD53, 0x62C7256F0BDFB, 0x33AB3BD4F9F5D, 0x0020457E54F04, 0x329B4C9F6D6B4, 0x74495D33FE221, 0x581C69D10F855, 0x7CB5B58A96159, 0x7EB360F96408E, 0x5FDDAAB4BCCE2, 0x0D39CD57E3F5D, 0x27C95034E4753, 0x564B72A52526D, 0x763907ACA3ED2, 0x0002A5E1E4A29 } },
+  { { 0x246B479F945CB, 0x26E4CB9F9E4B6, 0x5D8AF476CC606, 0x53CE9EC3D4743, 0x6123400507FFF, 0x46F8821C3C11C, 0x1CA7915E925B2, 0x6134074146246, 0x7A3B013A53C41, 0x0B7D593EB678C, 0x633979DE63C44, 0x117E178F1DC2A, 0x090F8C0696819, 0x6C7143F24558F, 0x00046DE7010F6 },
+    { 0x082691841D4A3, 0x42292AD66AE55, 0x6EFF85F30499A, 0x0B45189AA692C, 0x591D9883CC902, 0x114137F559268, 0x2CF55B3377EA8, 0x301801A7FBBF1, 0x029D5263F569B, 0x4AE483D2A6C82, 0x2A7C75A8369D5, 0x2B579280D76CA, 0x5C9170DA04477, 0x2F79D12FBE917, 0x000212B66C641 },
+    { 0x108D1034D753F, 0x74292D4797F4A, 0x6905C22E3CD12, 0x5DF78D0B6BACB, 0x33DBCFC57D9E9, 0x2BDDF7F54DD96, 0x37CD411D4DDD2, 0x63B7E5BD6BB87, 0x5BA2FFF2D09C5, 0x5349DDF461E31, 0x11681A22A7A51, 0x0A8FD0C0FFD43, 0x54DC68C2ADD80, 0x333F77CADBBA3, 0x000440F5726F0 },
+    { 0x43A8BF2DC61C7, 0x7EA49CD18D9BC, 0x6811F51047046, 0x660DFD58B9B3F, 0x2D818D6912F46, 0x083237FFF6436, 0x098D806F35CE7, 0x21C619F4C9748, 0x47CFA9DAD1783, 0x43642A7965A35, 0x42D348F4BF38A, 0x5836850894236, 0x13BDF4C2E7CCC, 0x29B915EF66D7D, 0x000391FE4D6B8 } },
+  { { 0x18586DEE38433, 0x14715F6CB98D1, 0x071112B36C451, 0x7E68CD53DC99E, 0x26551D89D1DA3, 0x2B9F75B5ACBB6, 0x7A4A0C465D1AA, 0x7528E272AE2C5, 0x48F611B58DB17, 0x2AACA6835E31C, 0x717832F6DC99C, 0x7AEC14EF1846E, 0x30222DFB1EBD4, 0x271EB6A519CF4, 0x00021F433C498 },
+    { 0x44F139F6C969F, 0x3EEFA28452E01, 0x67E24F3C4B82C, 0x3263CC1BCC0A7, 0x2903ADB2C4B35, 0x0759BB026F503, 0x4179460242A79, 0x735C1CF29BE58, 0x08A6A9A39B917, 0x39EB8BF2F19EC, 0x73FA01C7CEDB5, 0x25CFE5FC393B2, 0x75CA0B5CB1975, 0x1947191316C31, 0x00021123980F2 },
+    { 0x7CDA69B4FFF67, 0x218C28477DCC9, 0x4D0E7558C5477, 0x15DB86078CD21, 0x535FB55A1A965, 0x143852267C436, 0x48CA86E78810E, 0x2C2E9E391539D, 0x247026B87AE48, 0x256151EB2EF42, 0x71D316CA3F80C, 0x10C5597407E53, 0x697423C05C312, 0x6775C7F1FB0DD, 0x0002F837642F8 },
+    { 0x1A49374C6FE8B, 0x0016F23BD6E78, 0x74DE45F7C83B2, 0x1266E485B3F3F, 0x4F7F6CC64E839, 0x71A24F64E7566, 0x2B26C6911A7D3, 0x36434F7B090EC, 0x6059D97269A5B, 0x5D2BDABECE0ED, 0x3AEBF561D4F49, 0x04FE5C413D678, 0x2F9D099BE7E86, 0x65722E67C2AC1, 0x00028959E3400 } },
+  { { 0x7A825E6A6815F, 0x2AA9AFB99F9FC, 0x13D92438DDAA0, 0x3865FC63BE209, 0x2C41C0D0E4806, 0x06DEA4BFD57F7, 0x26BF8B5491E3E, 0x0065CD517B2EE, 0x0977C9F03BC1E, 0x4A2E780D30004, 0x2B9D4E1D053BC, 0x2E18913A74F0A, 0x50637DF93D478, 0x66B031F3FA398, 0x0005BC9B01DC6 },
+    { 0x1EDCC6B83F7B5, 0x753F3C7B7402E, 0x02D90A87CA59F, 0x495DECEA2B96C, 0x11C273C0FE554, 0x655F52CC5353D, 0x17105797461B4, 0x78E011C24E3F2, 0x7ECA7F0EA88BA, 0x1CFE2BF80D30B, 0x1A2108C3C752F, 0x7617E09C80CBA, 0x70157961F0D49, 0x53E672E91010B, 0x0002B5AA78BFA },
+    { 0x43EF80781F6D9, 0x208B03BA8409F, 0x246DE26E9E980, 0x7C13D51978E55, 0x5CE08B8823CCA, 0x5D3932045C8CC, 0x33E98585E7C8F, 0x233558B55FA26, 0x3D79AFED9745D, 0x63C4706040B79, 0x0F469810CD2F2, 0x078B994A0ED54, 0x3F48B1241385E, 0x287F3B3E4840F, 0x000415DE0C6B7 },
+    { 0x09E5FA8FC5191, 0x1641B572F3E59, 0x064F68A0BBEF1, 0x19BE5EC0C49D1, 0x10F5C25D6E274, 0x4A14AD44E4BFA, 0x6066319E97B65, 0x0B44525587ECB, 0x5817B9F6F80F6, 0x45C75F9B56F4D, 0x0D488A9DB7915, 0x1D3B165CB5369, 0x5D2E4782048FE, 0x158A64E91D5EB, 0x00032DFE8BB0D } },
+  { { 0x4E9AF5A121E1A, 0x616DC93849F77, 0x289FC0C884F93, 0x45512B729408E, 0x79DCBD102423B, 0x4CF1698FCBF67, 0x6F09525FD0FC2, 0x345497C63AD96, 0x238E3E8E6D888, 0x742D2A1518FD6, 0x185EFD8E48004, 0x7FF9027D8E911, 0x7738030BD794D, 0x745FFE4718BD1, 0x0000D8ECA19F8 },
+    { 0x2ABE5DD5713DB, 0x705454FF809C9, 0x395D6C0C944D7, 0x01024C70571DB, 0x6FD0D94CD7DE4, 0x2886F0E46FAAD, 0x4938444A88FFB, 0x0FC10BEEE184E, 0x61CCF33BA2C9B, 0x07506E1558A6A, 0x4555F19AF6DF8, 0x1FCD9FF373E57, 0x2A19BFCD2D854, 0x42E1DC5575480, 0x000059023A43C },
+    { 0x20C4F1551BBB0, 0x69CA48160E5B4, 0x2C6050C4393BE, 0x1F560EDF5DFC3, 0x5F3BC2E416101, 0x4CD1443ADADFA, 0x724DC9F8F18D4, 0x709C950AE7496, 0x49E251BBBD4FF, 0x237B80094D7D7, 0x627B906041CEF, 0x4037E78920F1B, 0x0C1292648AE03, 0x4F7BE1F73685B, 0x000343D52E8C9 },
+    { 0x510BFC4E4C807, 0x3109E926C26E1, 0x74E6743BFE461, 0x48CA9D0AE3171, 0x7BBF34C083331, 0x5A7623E45066C, 0x54D8165B78410, 0x6552D503D0E80, 0x4A07368FCCF99, 0x1F341B0760302, 0x170DA1E75C020, 0x093350CCFBD95, 0x429252649E827, 0x328812BBF603A, 0x00038C0591F5B } },
+  { { 0x59C2D39ADDB82, 0x3CD61F30744F1, 0x6A990ADEE0C43, 0x592A973BF10C1, 0x69289543EA872, 0x53BDEEE6A2037, 0x423A4D3203897, 0x65881DBE74F4F, 0x0808266DB1B89, 0x2E5CD3B201744, 0x04ACDD7CB6282, 0x08C1C7BF91A4E, 0x02E7D8B52E63E, 0x0E9827CA5EFE9, 0x00027ED3F1A5F },
+    { 0x3987EB21AE99A, 0x25B035BA5EF42, 0x61DB908503376, 0x1D9343DC194A5, 0x0541DCDAE5CF8, 0x2CBAF7CEE5124, 0x535FE9764E824, 0x30F4E53C6C54E, 0x041926DF12080, 0x711149580BD59, 0x28713524E1E19, 0x12ADC65AEFDFA, 0x7FEE63E5B1A57, 0x651FCD0AAA997, 0x000214F7F6C4B },
+    { 0x0AD177AC94A88, 0x7F0F99B76CC56, 0x0EB830E51092E, 0x2BBC7860DA5A5, 0x2283BCFC70AF5, 0x0948A2DDBD9E0, 0x7A7321C0EC80B, 0x1F77DFEA1BD58, 0x7D464CEB2C78D, 0x734ACCDD6C2C8, 0x5016060EB09E1, 0x673A2883E2350, 0x561780B78ACC7, 0x3549354FA6441, 0x0005357D61453 },
+    { 0x13ADF4D1E9E74, 0x02F8826C8A835, 0x27C1F817F029F, 0x07581A66663EE, 0x41957984C249F, 0x2FB2F2DF3864D, 0x41B0686F0CABF, 0x44EA738F771A9, 0x5C4157F8C4511, 0x35AFE24F82380, 0x3BFF2753F9A2D, 0x1057B89F5BD9A, 0x002F6E7140121, 0x67774AC9825F0, 0x000407BA59212 } },
+  { { 0x38976BD4E5716, 0x7DB5E4CF1734A, 0x7950B21F318FB, 0x4D970D1937081, 0x16069638BD00A, 0x7433988C34BFD, 0x34D8ED4A33175, 0x3B5F671CBD5A2, 0x403DAE32203B9, 0x33B558F147D76, 0x58B918F1C9D7B, 0x20206807C714C, 0x26BA242EFE714, 0x236AF032478D8, 0x0004A1634745A },
+    { 0x47F85FEC6419B, 0x56FDA952DF045, 0x55B435564F413, 0x3374F31DA91F7, 0x5FEE1FD7130B0, 0x72525EAAD9F44, 0x6F3B96C5C8557, 0x10E5D95F03186, 0x76EC241C1A355, 0x79F6D0CB08A9A, 0x2EF80E04242D6, 0x6FFB9AB6976B5, 0x621472B71A49A, 0x22846E2D85634, 0x0001F50F570E2 },
+    { 0x21E695862806C, 0x654ACE4C31437, 0x7F6D371632972, 0x15292CF0075BC, 0x30CAFA53E7DE6, 0x1BDF2E41669BA, 0x295B7705CFFCC, 0x50AA604FF70E2, 0x279D839F843F0, 0x4E0A1D752AF59, 0x32E72DA3E34D7, 0x08E43907714AB, 0x46EB84BBB74B2, 0x1B4C28720B505, 0x0003BA398415C },
+    { 0x2EB2D6A601D51, 0x78977B1A15696, 0x5950AF02B8E26, 0x5573805DCF51D, 0x6B3916223C449, 0x66C60FA3545F5, 0x203472A4344FB, 0x2C8E7C90F5999, 0x43ABB1AB808A4, 0x3A59A41488486, 0x7141E2E151207, 0x58285136DD9D3, 0x24153A7727B99, 0x189E7364F67DA, 0x000233D91B24C } },
+  { { 0x6F434C1E5F35C, 0x1334FFFD0A863, 0x64055AAED037E, 0x2DFD978490E67, 0x4AFA4782423F1, 0x37630FE146A76, 0x5C564E570512C, 0x2608E19CF63EC, 0x509457E3AA3DC, 0x2219122238DCC, 0x785992E7AD1A1, 0x65C0D26E713EC, 0x092C1B02AA3AB, 0x22C9A51E73A87, 0x00016A4C672BB },
+    { 0x6CB358C3757EB, 0x050880D159DFE, 0x2E8D983421036, 0x0D42D20CD13C6, 0x0875B7F8F4730, 0x55E1D71318606, 0x3D0D29F55161C, 0x18F3C4B7AA972, 0x24967C9A86EBF, 0x150BB3F339177, 0x363D5C9BA4D4A, 0x7D986E1C2B140, 0x1E62E3454725C, 0x05E111EA76FFC, 0x0001A1556510C },
+    { 0x673F2CA6896B8, 0x0183A5E6078E2, 0x0BF3DDFF9F15E, 0x5AE115D0D1E4A, 0x0D85C65753C72, 0x6F9F4DBB057DB, 0x532D04B79DD7B, 0x51B9C353405CA, 0x42A44B1F13FBB, 0x11F77D90468E8, 0x74199375F7DE3, 0x548FC478BE3EF, 0x53779CECDBB91, 0x21C5EFF1C99CA, 0x00044B7124298 },
+    { 0x5DF21217E39C9, 0x1A608A8241FB2, 0x2CBF0231B0C82, 0x6F140BE5009AB, 0x3EB0C6D8C406E, 0x18C938498B2B9, 0x1076CD1D47DAB, 0x733E163E98A38, 0x604A236A3452D, 0x251564FB56C0F, 0x7F80C01B2BB85, 0x127C21DE1275D, 0x4DE48D32281B1, 0x1A45F4390CA8A, 0x000401CD762D2 } },
+  { { 0x2CCF57452E2FE, 0x553524C4292BE, 0x6272E8E7ABB3A, 0x0F0999DA52C96, 0x426A2A4942EA8, 0x14BDFBB68E0AC, 0x3850FB88AEF5E, 0x7F51BCE2D4E09, 0x4D3398ABA47D9, 0x6B9B2EBD255AA, 0x43AF3D176CC78, 0x625AA25BD426C, 0x20C5A906D2F48, 0x06F13ABC03BF2, 0x0002C872D8BF7 },
+    { 0x0B7163AA0BA5D, 0x0835F926EAFE4, 0x53DF5F594D7ED, 0x367F6D91165A3, 0x72D351595A1F4, 0x58EA402D929A8, 0x73C79044EAB80, 0x04955B5F63C6B, 0x151994350E25D, 0x52CA252E4C6EA, 0x495E9139DDB13, 0x45DD80CFA7292, 0x2814C22AC3980, 0x1084EBB3C95B3, 0x0001EBE7A8E8E },
+    { 0x158B8C67EC976, 0x71B7B887CE3BB, 0x0A0BC4B7C2C4B, 0x16E53C98425A3, 0x5011330476FCA, 0x370DD4F684383, 0x48C053F1C88A4, 0x383229F6333C4, 0x1DEC8A3001CD9, 0x6E091C7D910F6, 0x769C783132144, 0x6C10E676FBD1D, 0x06988C09AF898, 0x7BC18299B2A17, 0x0003743A220E0 },
+    { 0x710D407E449EF, 0x720853112BFD4, 0x1B14A37261776, 0x577031F307F0E, 0x6AFADB10CCC59, 0x5AD98648BE7BE, 0x5FBB41592A0FF, 0x072494A656DE0, 0x325519BC2CE9D, 0x13661C9371E52, 0x1171AFF1D9384, 0x153572CD36657, 0x2909D75A5DF59, 0x777F221BE91E7, 0x000508FA9FD6D } },
+  { { 0x6524A0C9E1589, 0x1BDFC401195A0, 0x3B4D6C60409D2, 0x7124D72363128, 0x1B4DF626D33A5, 0x3833B83A78110, 0x6888D6683D692, 0x6097D74AB0804, 0x04986867B4AA9, 0x051B37E6614BF, 0x46F6DFC6BDAD3, 0x27CC67B02361D, 0x54FD4977795FA, 0x432E0778DBDA2, 0x0004A4F3CA38E },
+    { 0x7188B82CA2509, 0x789A286604C84, 0x67592A1B0042D, 0x1323BF6BB9BFE, 0x0C5B648111AA9, 0x6CB3818111E9D, 0x598847194E402, 0x1EE97C0BA9EC4, 0x21F03D898DEF2, 0x3081677516F39, 0x1130A953E74F1, 0x4991FAC87C2BC, 0x1406B6AC84DF0, 0x388AC7701C574, 0x0001CA7A40EC9 },
+    { 0x566EA84BE794D, 0x298D7E644BE49, 0x6210108EE1067, 0x3283DB80DA971, 0x65CB5E335B4E8, 0x0469463EFBC6A, 0x749EB5A822F1F, 0x6F56D8094A8BD, 0x0F66B195BB02C, 0x252E1DF8E1430, 0x07E002F1726D8, 0x7AC0DB6220232, 0x03DFE4222EFCD, 0x7CD9B4E6F3058, 0x0003688003257 },
+    { 0x7A427C1048C6D, 0x061B10D2A3C01, 0x0E45CE2564252, 0x65A904F651EBA, 0x0E13F46331A87, 0x35450D1E4C9BF, 0x598DBB0FB39D9, 0x1F1FE00D129F4, 0x03DE818ECE9DB, 0x1E30BB9E8B62F, 0x2524D3A062095, 0x21CED773C2FF4, 0x6D1C1BBC9BEA6, 0x77F5C74B50B2A, 0x000516CFF9169 } },
+  { { 0x4FFC3A2A406A7, 0x6D34C7DE93729, 0x725632FFF053C, 0x4C5B2281C6265, 0x1FA6246130447, 0x64AAFD0740145, 0x67C637149C120, 0x06887BC3C713B, 0x3D939E964421E, 0x424531B2C1FC0, 0x29BFEC5ABBE38, 0x3C05F39C8E866, 0x30184C8A3697E, 0x14B01A168894D, 0x000486E578E3F },
+    { 0x5044BE63CD33F, 0x7E3BC42D0FCEE, 0x090F3D0CB043C, 0x6ED4750E58AA2, 0x28CB9E510EE6F, 0x020F5B21DBA4F, 0x78B63A8DC02F1, 0x33D79C0649651, 0x3479E71FC5E74, 0x31B29DECB39BB, 0x065189227DF7B, 0x493AFFBB8D1DC, 0x40DF669FF08BE, 0x3D32600C2D831, 0x0002A09D64E79 },
+    { 0x20C20CECEEC89, 0x4D6C8F4B0F328, 0x5CD979F5F1397, 0x088F63F9D5737, 0x4365AF81E4D2A, 0x67BF4D4994E5F, 0x73F014324989A, 0x6EE3F2913C51A, 0x2D2981F511058, 0x743E905417859, 0x05AEE80EC3EC1, 0x45A8899359A75, 0x72345A5DA0FF8, 0x37FE312114E45, 0x000455536DEB9 },
+    { 0x7CC3713FF3E93, 0x1354AC894CED6, 0x6076A790BF35A, 0x4FEF448FDB9C9, 0x181FD6F594734, 0x480C258C9DFD4, 0x27BAE5B132DFF, 0x351B02F4BC340, 0x2BF38630904B8, 0x2927272E41D6F, 0x7CF06AD75BAB8, 0x37820339063C8, 0x40D4A47C872FE, 0x24886C21A3D36, 0x0002A2B33ADB8 } },
+  { { 0x7AD76C8F72583, 0x4D968021D2F58, 0x2EE9249B3F68B, 0x2BDDEFE5976AB, 0x5856A31D453FB, 0x2630857EBEE40, 0x5642643DCCDFA, 0x404E9B841F9B0, 0x6887ABAEF2890, 0x760CC8FD2F850, 0x244FD27379089, 0x48C422F9C8D15, 0x07CB22071C6D1, 0x7777B32BA4C8E, 0x0000B981CC850 },
+    { 0x31553090AB814, 0x09929BB914A59, 0x370A9DBC36692, 0x7934452A21A89, 0x5D61DD6AAA242, 0x59F658A886E80, 0x2F34D2F41B199, 0x6B1493F2B3307, 0x12739FCCA53C2, 0x137747EA238CD, 0x63C19C888151C, 0x6939FE5A83CF6, 0x0FB9A07D14623, 0x2B48341D06A52, 0x000107B6E5C73 },
+    { 0x0A4A11005B01D, 0x650C4FD961501, 0x1D3F46741E075, 0x5F4A6872AFA4B, 0x6F9DEC57190BF, 0x06D7280B4A3D3, 0x0DEED40AE8E37, 0x16E6EC6443AAE, 0x3653AD45E9F0F, 0x56227A45BD17B, 0x11CF86107FD73, 0x4918C3C284C10, 0x4156A3143E693, 0x6E8F5B7F743B7, 0x0002D873D2670 },
+    { 0x2D2DA3E6D316C, 0x2C76AAEB58705, 0x523FB73691AD9, 0x1242BF7B619F6, 0x36FC93D26FF99, 0x1BD63CD32430A, 0x685901B06F0EF, 0x5004FB3654E0D, 0x2D948D5918963, 0x2E66D04CDA7F2, 0x14505566D99B7, 0x22136E27786AB, 0x110DA90117AD2, 0x6021564229398, 0x0004807C4AE04 } },
+  { { 0x28EF50B3DB982, 0x22A5191B1E693, 0x37EEBD72FE908, 0x3C7B7516F8216, 0x0CCF532C37797, 0x562BC8B0576F9, 0x4CD52EEB8B8C5, 0x2D3D5A4884FD6, 0x0B65DCCE35D64, 0x6AB839EE75242, 0x17A8EC4DE1406, 0x41DBE01C96C8A, 0x0CDCEC82543B4, 0x0981098B278D3, 0x00024266971B7 },
+    { 0x6695AD638E40F, 0x3862D942B4FC7, 0x4B11467282319, 0x7E67F10DEC83A, 0x039C610102397, 0x11283E8DB0B20, 0x05BCBC382D69E, 0x67E69430BED50, 0x67EA252FF510A, 0x2A97A7DA49C91, 0x5E83A8C637842, 0x2C899EE014FFF, 0x679317B88778C, 0x4AC389AA06031, 0x00023B8DC6EFF },
+    { 0x499BCC10B8A9E, 0x513619F266C2C, 0x60895B642D983, 0x1B98A6561ACB3, 0x2F2D5531CCE04, 0x4582D205F53CA, 0x655ABC8752714, 0x0801AA3ECB50A, 0x06A575588940F, 0x04DEC07E20C60, 0x1E1DCDCD7FEF7, 0x1572D8D06CD00, 0x7D03EF3203B80, 0x794AFE86DF9B3, 0x0003E7A6CC55C },
+    { 0x2D86945FF0651, 0x27C569F581011, 0x5CF6CC1263082, 0x58CEAE252E044, 0x23BE10694C73F, 0x2B54F26B9C48F, 0x4E7E48F34FD75, 0x3CA7D901FC942, 0x2C4C2DEAC99D7, 0x0267DB987D484, 0x42C86EC3EBB0A, 0x2160BCBE68D9E, 0x42584E94960B6, 0x333A8BFCD99BB, 0x0002D18097332 } },
+  { { 0x66D80B84F38DE, 0x5A191963269BC, 0x55F95C81A6A97, 0x7E983E7550B1F, 0x4D8E8F302A56D, 0x5C33F58F71964, 0x3FB4788AE8692, 0x07BE123A73145, 0x0EABB72612522, 0x72805CAAD94C9, 0x65BFBB5B7C9D5, 0x1443FCCE5BACC, 0x1CDC389C7CEBB, 0x49C1AD9546761, 0x0004A8950DDB8 },
+    { 0x47F578AF1BC44, 0x7AE03CB7D2003, 0x36D324B3985C9, 0x61A2FC760B321, 0x2233E4826E89D, 0x0927151904CBD, 0x5FE3FD444354B, 0x20F6D1C6176D7, 0x114D3C2FE9BE4, 0x2D508331C0ED5, 0x3D80973000C92, 0x323FEE4A2C526, 0x724842CD79A02, 0x2BCC35348B3A2, 0x00009F2C6C956 },
+    { 0x72A5ACDF08DDA, 0x37F0D0EA52D44, 0x49C3FEA58C1CE, 0x4D82724D59F0A, 0x3A00BC2AE30DB, 0x4DAD3E2625BFD, 0x0A15E2020A6FF, 0x1EAD0F9AB2763, 0x7632DBAA66ABF, 0x28FB3B5309742, 0x49D28BBE948CC, 0x1299D450F734F, 0x286F5CE712A5B, 0x4932C181B6E3C, 0x00056BDFE5F1C },
+    { 0x6FE758B7B1DD4, 0x466D62478722C, 0x4AA514C7D68B1, 0x5CEFE50A9282D, 0x1D3463A1FC4C4, 0x16473D6F41CC0, 0x75ABD5685EA46, 0x00C7EC78B9B38, 0x1574D628B8783, 0x1BBDE48E9E46A, 0x101596F69DABC, 0x450211BAED4CA, 0x6A5DDAFE014F7, 0x342EF94E6665F, 0x0003317C11086 } },
+  { { 0x02FF4655B2266, 0x61995B669A978, 0x758AF03024A6A, 0x488D6E8CE21C1, 0x12760626DE6C4, 0x2ECEF2BE773C9, 0x3E62E83622B4A, 0x1C390CEAB63C9, 0x0488A99152161, 0x4C715838F7367, 0x453D26F67BD30, 0x37D6916A62EAC, 0x2B97D81006DE8, 0x62AE3042807BA, 0x0002ACD7999B8 },
+    { 0x34A0A45180FF7, 0x06B87A72D63A5, 0x58EF27B9C4D28, 0x118C5E8C64693, 0x7266361CFEC32, 0x387D017EE1E8C, 0x04009AD9B4AB3, 0x6490B3D6FA1C3, 0x08A2BACEE6A51, 0x0D6939B224994, 0x5A6897F3FEB46, 0x4B6B10EC26CC9, 0x7A3596748F449, 0x6FB3B5256F7C7, 0x000219DBCF1C7 },
+    { 0x3B72874C0D5D4, 0x21B64DCE5A417, 0x1B8FFF43E6359, 0x20275DFAA383F, 0x6CE35658D4CA9, 0x01661E5ABE342, 0x3BECBA9AA036B, 0x486D9A0E23251, 0x5A380191B838B, 0x14137E71244D8, 0x70BB106E55581, 0x6C0259FADCE3F, 0x038C57A7CF556, 0x1491E8027A457, 0x0001973AA25C0 },
+    { 0x67E99088407F3, 0x5A1A29787C7FB, 0x17B2030D85878, 0x4DB3502D584BB, 0x464EC2551F88E, 0x1DA134A8DB8E5, 0x7B086D562FA52, 0x4EB6BBD3EC97E, 0x1F8E6E247F5CE, 0x39EBC13692E73, 0x35670BDA14627, 0x6A4583721515C, 0x5C712906BC78E, 0x64D9E952CEF56, 0x0003399825BD2 } },
+  { { 0x2506142E92E23, 0x6C6B689E2A367, 0x619FAD06FAF20, 0x3B8F2387C766A, 0x1CDBA2EFE5F06, 0x6A23902022DE4, 0x7BEAE473453D9, 0x7D1CE66F4B725, 0x5F11E14BDC762, 0x65067C6C95CBB, 0x673C3814C6348, 0x70D7549576F3D, 0x650A96AC83895, 0x795B2E4BA2B17, 0x000380CEAEBFD },
+    { 0x00CC9F0CBFCEF, 0x460CE86CEE2B5, 0x063CB9C9069A7, 0x7E21C54B899CD, 0x32ED7A9ACA9D7, 0x733D3D1C03F30, 0x245F40AF77E65, 0x7C11C55D0BADF, 0x4AB01B8FB6E19, 0x3707AB52BBBD7, 0x20B1D48A3E90C, 0x41CF4F7BE4A64, 0x65FC8288633B5, 0x361117C47837C, 0x0001B27685E1D },
+    { 0x28C81DEAE8E51, 0x485B01969D8AB, 0x1589D14AA27B6, 0x67E62E4026EBC, 0x7C35CB2609E45, 0x77EEF34EEE9C0, 0x605159E590AE1, 0x5C37C626BD22F, 0x469BF64034152, 0x4EBC82DABB570, 0x77CF49D8DAF34, 0x17AF4F3711839, 0x43C062B58468B, 0x500ADEF9B962A, 0x00024C9CE91E8 },
+    { 0x5F321EBA08DCF, 0x1BD7546AABB70, 0x682BDF78E6E98, 0x67EF6219B1C40, 0x36B86C33454EB, 0x38862260447C2, 0x0ADD2741050F9, 0x29701351C9FD8, 0x2C2472276054C, 0x2BD12C1B45B3C, 0x545B8D8197430, 0x5E8B762769157, 0x78B508E82611B, 0x77219311A9E25, 0x0002CF45E3B1E } },
+  { { 0x061A4029F0C70, 0x2042741B47A87, 0x73DD69F1D07BC, 0x065C5F0871038, 0x2C432CB9CE59E, 0x0004C333BE6AB, 0x3BEEB0CBA44CC, 0x6E8323D570E4C, 0x0D98442C0A8F3, 0x21E2F7ABC7E3F, 0x19FBBA8AE1C46, 0x360957FAE0C0C, 0x3CA412D310111, 0x741F41489DD05, 0x00037104CF9CD },
+    { 0x790E20072CA62, 0x1C8981DEF6946, 0x75645DB5D8908, 0x2F456CCB758C6, 0x32A27E756DECF, 0x57AA447EC8437, 0x17CFD51B2246F, 0x79598F20422BA, 0x041C8EEE561A5, 0x7C30E864E2300, 0x08F2455FC0789, 0x1A8650250348B, 0x2881C6EF64E52, 0x368C846AC4F75, 0x000250015193E },
+    { 0x2B3A510938972, 0x3E40FAD2A05C5, 0x736296ACFF4D0, 0x340504F4DCE7D, 0x7931CD56FD0CD, 0x66B36F6E04EA4, 0x5791586FF61AD, 0x147B8CA675368, 0x5FA3179436DD2, 0x4F314DC856D46, 0x2F2F3CD4539F8, 0x455A461DCFB2D, 0x5A6EEC5A3E759, 0x5F549CD29CA82, 0x0000684A7E4B0 },
+    { 0x7A282995217D6, 0x69F37B0037CDA, 0x7CF36D19BED18, 0x6A457823A9D64, 0x58279F2B509D7, 0x748D3E874F199, 0x30266BC48B0C6, 0x5EA3AFB740665, 0x58F607A5DF233, 0x622B281DE00C4, 0x18C40A885E712, 0x18FA10BE32F2F, 0x068D334649958, 0x14EE5F4A67013, 0x0002D32F0561E } },
+  { { 0x17543F773E450, 0x45CA74EEF4CD3, 0x73F3216075028, 0x273FE206CC7F8, 0x3BE951168615F, 0x1ADB5ACF23150, 0x79F281FA713FF, 0x52BBEB3EF9287, 0x5D43DAAD149FF, 0x56D55E2E7E455, 0x71C3C16095147, 0x14995A4F32EA2, 0x4B565CB0CCC76, 0x19388DFA22A77, 0x00042A74B377D },
+    { 0x7F567CCBCA79E, 0x30B38A67A3FE9, 0x3C995BAFDA83A, 0x56439F7D32E1D, 0x16DC8D4DD0A3C, 0x5F41F2B68155A, 0x67C66C69CA3CE, 0x1F574674A6D3B, 0x5066CCEFF9F19, 0x18BE1CA9609F0, 0x5D15632779056, 0x7EA69697E3E1D, 0x760315E4A6CB6, 0x591778C364360, 0x0001D3A8C3D77 },
+    { 0x05E1DA7DFB356, 0x334EC95DC52E4, 0x7D18AFD169588, 0x200EEC6891E8D, 0x64571958B2A00, 0x207588FB0C278, 0x0F4AF70132C5A, 0x2438DB11A9AA3, 0x79C46F6F4DD92, 0x56D0E766CEA05, 0x73EB0B2F5DBE8, 0x77B28BB82A4BE, 0x29B9E20D74936, 0x442B54233592B, 0x0004DDDC2F810 },
+    { 0x0FEC5A574CC32, 0x7E9FF809DBFA1, 0x18C42ACD69DC9, 0x063123C909C7C, 0x480B900F7C55B, 0x4503B3B75914C, 0x4D75B4045F403, 0x34BBD5525E92F, 0x5A3FFA37B5FE3, 0x1B2BDACF2B751, 0x6446174670676, 0x3F718579C3026, 0x0F2ADF928B552, 0x61393E3DA61FA, 0x0003400121999 } },
+  { { 0x19E9A91C5F23F, 0x4598E7823D663, 0x1C46BB8AFC044, 0x4D3452BA6ECA4, 0x26323FA4FC0B9, 0x23FC23B8EA783, 0x548CD2353364F, 0x44F74876A1414, 0x14B490C7BEB1E, 0x74439599A6E02, 0x13F1E99E5143A, 0x76553CA52DA3B, 0x182A40D29B28A, 0x1AC7B04F86E42, 0x0004C0576F8EC },
+    { 0x462B009A89AC6, 0x6DCB5A2372D3A, 0x13A47921813FB, 0x3524BB059353D, 0x58C0F71F65C2C, 0x0984A294E3045, 0x53242603F7932, 0x08563130B54F4, 0x042283AAA9251, 0x4C47B08E0E6BE, 0x505E832A74FD9, 0x4B98B035D3B24, 0x38AE6AE586A02, 0x6A329C0215EDC, 0x00013F36002CB },
+    { 0x4C0F0D110974D, 0x530414FF46305, 0x25E08C27D6B3D, 0x24F2201239C3E, 0x5B4F1B90D15DF, 0x2A2EE48915B27, 0x79FFCE5288D71, 0x3C36A5F0FB3DD, 0x35430D8AC5D88, 0x782B5C9B68736, 0x5B63CE7872F26, 0x54B7696434382, 0x63BB66F7E51C1, 0x781715D2D1327, 0x0002BA706B817 },
+    { 0x1FD3B22089812, 0x1091F3CC28090, 0x376B9157EDDD8, 0x60C6DD766308D, 0x40912EB7B7F93, 0x03F2E2C989C95, 0x13167415403D7, 0x673C7F5686EA9, 0x619167A8FFBEE, 0x6536FAE759214, 0x09AD69D0D6CCA, 0x3257B415048B4, 0x65F9F0953C5E0, 0x28603FC9BEC75, 0x0003F43A8484F } },
+  { { 0x5A743FA93367D, 0x1C2EE6F0CCC9C, 0x41A293EFADC5B, 0x5411FBE0D35A1, 0x393BFFE050F11, 0x2CCBD1F5D0E0C, 0x3323B9EB4247A, 0x65E913076278A, 0x31D012DD10951, 0x0E73B70ADADA2, 0x04B9162C04814, 0x0BFDEBBD5049E, 0x60A08927F5E59, 0x75F4D02784BA8, 0x0001E157EDDB4 },
+    { 0x01ED01A7E72CD, 0x629220F36BD1B, 0x3D8A264D020F3, 0x2573B015DFFB0, 0x06863DB712ECF, 0x55187558F1EBD, 0x02A5B36B6A431, 0x768070437E0BF, 0x541DA730B8CA1, 0x24A0E67938EF7, 0x5706DA8A61790, 0x08FDD3B0F36D3, 0x54A01121AE382, 0x2044FD28AA24D, 0x0002A6C285210 },
+    { 0x15076A73591B3, 0x78B8DF9762B8D, 0x6DFB76C3F0194, 0x253B307E7D596, 0x7E823BFC399DB, 0x40B7E7BDB2D56, 0x7EA2BF55BDC62, 0x5CA832841BF34, 0x5C2DCA74C8683, 0x58E2255A64603, 0x1A3139296AE0C, 0x5423D32E55F82, 0x21DFF7D385090, 0x3C348ACB9B598, 0x00033E683063C },
+    { 0x2F19AFD166D5F, 0x6A71B6E47612A, 0x0674F81CFDD63, 0x7846AC2281F41, 0x5AB6D2DF4778D, 0x685E171F40424, 0x3AB237B796874, 0x0BA460BB82EBA, 0x504F6FCEE1626, 0x52ABCE2B80FC9, 0x0FCCE1172ACFD, 0x65A69E1658F95, 0x03846C9FCA509, 0x43AC83C0D3A1F, 0x0003311CDA193 } },
+  { { 0x2540DC7441280, 0x2979737826A99, 0x5F4164C9AD44C, 0x429E60C3A07DD, 0x2026145FE3E8C, 0x51EC6B178F648, 0x46E3E318C5EBC, 0x74149BA24C1DC, 0x303E76072CD99, 0x5C79245A1A882, 0x4906D90980E30, 0x6709F977D10F1, 0x2261F8B37DCF0, 0x4DC018DDB109E, 0x0004BD73404B2 },
+    { 0x7F8242D5221F5, 0x558454F6CF4A9, 0x63A3E44804057, 0x617A7C81507BC, 0x7D967AA6EA5E6, 0x01859ABB900CB, 0x15745A2E00DA0, 0x51DF3FF406A26, 0x74A9F581185F9, 0x77E3E9650195A, 0x0ED436EEBFC99, 0x0859A73C5F8B0, 0x1F2301E35ADDD, 0x1E106C2FB0BC2, 0x0001ED44A6999 },
+    { 0x132751F950F02, 0x1703B3E834725, 0x4ABC90887728A, 0x3F577DA6CDE98, 0x6EA7ADDEC0919, 0x2B45090775E95, 0x2D22AFB49F720, 0x197E68A2885CD, 0x5EBE82FCAC805, 0x2AA160E82E20F, 0x5150CD55A3BE7, 0x0FD317A4BCDF6, 0x4AA04E3E863FB, 0x2DC06CA3365B4, 0x00015D912D3CB },
+    { 0x040118A92DD07, 0x5FF88F76D3DDC, 0x7455D1458E707, 0x5D526FCE429B3, 0x2FC9E32D61614, 0x1E1C4011EFEDA, 0x570D9349CE014, 0x5A73AB87C7755, 0x545CB3210737E, 0x577614A9CC69E, 0x348B6217CE25C, 0x43F6A86B8A652, 0x548081F26EE51, 0x3ABCAC8AFC3CB, 0x000472A57D262 } },
+  { { 0x2BA1423F3DD89, 0x5859193842075, 0x6527E3BA774B9, 0x1FC214C554C77, 0x6608194BA52EF, 0x7D9CB60AE7C13, 0x09C438F9E9A2F, 0x45D8626A4D16C, 0x5C0D610A92237, 0x6237B0B414734, 0x46D976FEDECDE, 0x79039CD4393E4, 0x5F216573B86FA, 0x07E4F694EBBD4, 0x0005141A86AE6 },
+    { 0x0BB0AE2E4A6C7, 0x3E32AA0E320A3, 0x0CF2794F607D9, 0x159AD0B4490D7, 0x0C6E16EA6D4EE, 0x0A13B09CAFAD3, 0x2AB6090818BB8, 0x04BA292CCBAD4, 0x3D1B3211156A6, 0x6502C3DB3B226, 0x0BB28FE558DC3, 0x1EFEEAA6198DC, 0x369A8C31DDDD5, 0x22590A7EBA769, 0x00007D222364A },
+    { 0x65B608D0424DF, 0x6DF6ED3A30BA1, 0x7D78FC89BFC14, 0x3449B26C6E4D6, 0x46E4E1F4E0ACA, 0x5B8C4E1746F91, 0x4EE6488A2B3F4, 0x41F9D01EA3DD5, 0x6F926C47F4493, 0x4828540891F7F, 0x03F5C05524ABB, 0x565B3308200F1, 0x582D76874D3AE, 0x51BE02C6B1A3B, 0x0003053840DF1 },
+    { 0x07AE10ECA9DFB, 0x781A7EA027D37, 0x51AD04AFE24B8, 0x1CE2604FEB6BD, 0x6F02B0F210917, 0x6B7E07B565210, 0x79D0E96951B10, 0x7D013BE618B9B, 0x16F4ADB9D54B5, 0x119997E6607D5, 0x6B6F769479CA1, 0x72E6CF10F1C40, 0x4869C737B4A16, 0x39FFEAFFE53ED, 0x0003CECDF7897 } },
+  { { 0x2C588B5BBB2EB, 0x161E4B92733EC, 0x5E26B5AF6CF96, 0x22EE2EB535016, 0x072C5AC0592C1, 0x6C18B6AB175EF, 0x08F7DC3A6FF35, 0x685C9B1BDA552, 0x466E5A11A9B50, 0x25E54BEF60933, 0x20A014E455D6E, 0x22CE91FBEA17A, 0x0965D2EAC69F7, 0x47949DD6AE390, 0x0004F4849CE44 },
+    { 0x76A84D9F9E72A, 0x506EC688D17A9, 0x13CEDC9FA37E5, 0x3F14EB45E7208, 0x5F48A93F8ABBE, 0x38B0AF97EEFFD, 0x63FFF5574C979, 0x0F76029D7F002, 0x2F726EBC7F0FF, 0x4209099A936EF, 0x49E19E2E4FB67, 0x09E1D2D7E39A4, 0x5C6B254800E53, 0x4C39945F98E31, 0x0001263B0E9C8 },
+    { 0x5B1C58146DD71, 0x0AF0530EC848A, 0x64EE679565EA8, 0x2CD7AB5472BA5, 0x01B7041787013, 0x10D2CDE7C1F14, 0x58CCD91C00047, 0x71E906AAC3653, 0x441C1A2BF3F23, 0x586E5E85139D1, 0x7C9439EF218F4, 0x32DDE3C6527CF, 0x4D7182015AC1E, 0x7420D16E0203B, 0x00031D8302362 },
+    { 0x505742DA550F2, 0x115EA20346FA0, 0x2707E4BFE9925, 0x24A39E652430A, 0x23B48B75BBF09, 0x25F0C20619617, 0x1F08A9B1CCC8D, 0x7727015479FB9, 0x4D05586230DB7, 0x1C8AC7CC78B55, 0x552E2018A4A12, 0x1C384AC9728DB, 0x05661CA85E79B, 0x1D4E8AB5B11F5, 0x000281CA78BA8 } },
+  { { 0x2F584306CA659, 0x42AF9AF584689, 0x00288324AC2DD, 0x7B8E829E6C86C, 0x62673C343E351, 0x70510ACB46BF5, 0x189B0A88483BA, 0x52EC1E4D90961, 0x2449C4C268C0F, 0x5F17406A3391A, 0x2951B423B45B4, 0x35B76F723D33A, 0x6601458BA7E74, 0x0C8D5B2A5ED2B, 0x0005378B1C17D },
+    { 0x1431F946FE2BF, 0x5305F125BCCB8, 0x5CEA976780C33, 0x692B9C5EF4F1B, 0x74AED07057B6B, 0x37BB3B38FF9DD, 0x39CDED4AF0DC1, 0x2E9F746D63C84, 0x73627C8FC1CCA, 0x0F05F3534E578, 0x60C5862551F0C, 0x416531B587BA2, 0x70543C1C0197C, 0x22BB9D7164ABD, 0x0001D8F909D2A },
+    { 0x4F1356FA499DF, 0x4B00505E56C06, 0x498347EAF96E4, 0x0B64AB83C595C, 0x5E1F053991CBE, 0x52F17805ECF97, 0x69FCF9738A15B, 0x2C2E2549DADCF, 0x749AB0EC73031, 0x31F91BC8C444B, 0x24BA3DBA65747, 0x6C2E758162738, 0x09B1E7BA5E9EB, 0x7A03CE956CE5A, 0x000235087A354 },
+    { 0x535647C50796D, 0x02DE81E517B18, 0x7E2BB37FD5076, 0x6B31CDB15B6B5, 0x375A874454119, 0x1F2C28E041845, 0x57DD21AF6730F, 0x29B4F17668226, 0x3C5BAB7B635D9, 0x4C3F9B546FA06, 0x5D2A4A078294D, 0x7AD97CA580E41, 0x467B112E3D97D, 0x0591C0A75277E, 0x0003D58E870EA } },
+  { { 0x0F3919269EDC6, 0x2145466A51F01, 0x704DD08DD169A, 0x112E7E6C8D7F9, 0x7BF1B35C91EAE, 0x0EC67220FA98E, 0x65C3992C085AD, 0x5210502F82590, 0x7EF9C04D6BF7B, 0x20C0503119A60, 0x22C819C6FB66C, 0x06706457022D3, 0x6B48E06DAF7CB, 0x170246EE80CE8, 0x000154286A9ED },
+    { 0x5DC8D3A984D61, 0x2EEA4979095E3, 0x7FE86D2CAA364, 0x5495D153B0DEB, 0x2BF1C49D5F026, 0x73F9489DA1849, 0x1FEE374996CDC, 0x0818C5F50D6AA, 0x6D690F9637986, 0x6391CF0F80121, 0x79C4106064690, 0x774DF0EC1F88D, 0x7875EA9F932B7, 0x3E51C709B5CA9, 0x0001D2C1FE8D2 },
+    { 0x26BE6D6BDC670, 0x6FBCE9DE7A9F9, 0x65BA2AA87EF85, 0x5ADB772BF1632, 0x0B376DC3F9A4E, 0x60727436A4521, 0x6101E848AE775, 0x351B83AD630CD, 0x75BE129FF3653, 0x3A9313F776A4F, 0x08657BCC6E8EC, 0x275F1257D4B24, 0x0DEFF32C367E1, 0x69547457FDE4F, 0x0004BFE6AE7DE },
+    { 0x35ADC9FDA9699, 0x0ED58ABEC843B, 0x59B9397990AC9, 0x1770AC8C192CB, 0x5AD660F6FB5A1, 0x731670B2F8C9E, 0x36D93064C29F1, 0x5F7AF5B1C338E, 0x2DF0F20072AEB, 0x4EA51958E72CC, 0x2100DF02C293F, 0x669097958FC1A, 0x6AFDFFE85CE6C, 0x222A50A960113, 0x0001D5E923D97 } },
+  { { 0x377ADE78A0862, 0x20C2E1E61BE81, 0x527BEFA7F4B4E, 0x5D03A4ECB9F6C, 0x2033F2DE57DDF, 0x7D32F40004CE3, 0x26FBEC92889CF, 0x419F5F4CB84EC, 0x576EE69EF28BA, 0x31D8D96380988, 0x77600A6B6A605, 0x14A1AC3AF9694, 0x39CAB137BF1E7, 0x17D05EFF65655, 0x0004DDC510309 },
+    { 0x308D571267DCA, 0x1D977549B8961, 0x7AAB4CC72A244, 0x6AF732E81C7D9, 0x74C0B4638BD66, 0x7AF4DBBDFAC12, 0x16CED5E136147, 0x1561703DC1305, 0x1898A36FD8917, 0x6D841A043ED47, 0x42A3BE670D6F5, 0x5B2233A694A96, 0x1FC6E16692E36, 0x453B571C79276, 0x0001D76AD2D3A },
+    { 0x3CD13283D5DFA, 0x733BB49783E6D, 0x341A770BDAD69, 0x356381BA1C65E, 0x3DD2E6CC7C550, 0x7154C60829EB9, 0x1791865CF694D, 0x46D6130077F03, 0x01CCA8E810FAB, 0x22096C95B3ECE, 0x458403A3EE7A0, 0x1480B93D7E931, 0x6CA333D308A54, 0x46B4EA5AC92C8, 0x00036CDFD2327 },
+    { 0x4B47D2F054EE8, 0x654880A7C39D1, 0x10E64ADEBE0D0, 0x170BCAB354A03, 0x4FA754E0BB7D8, 0x792A98F52B8E0, 0x5DB906849227F, 0x28DAFE797FEA2, 0x3DDC8ECF172C2, 0x43D0D308E1D95, 0x613F566338AE3, 0x1C6302152DAC6, 0x7BAD0B20F8615, 0x1C205FB9ED1AF, 0x000223AE3BF1D } },
+  { { 0x33F7C8C45E297, 0x2D328D6FFEE93, 0x405D95442B749, 0x7AF02267895D8, 0x27D3824EBEEAE, 0x1A7655B252386, 0x563FD635703B1, 0x273B00612A44C, 0x7E5A254AD8F88, 0x4EFB2B8ACC893, 0x08CA1B14D2EC6, 0x6FCA045C900E1, 0x6713172F0F0E0, 0x4D49332D2BFE1, 0x0005F362ABA85 },
+    { 0x6DE183601851C, 0x003417475E8A9, 0x5A1D66713A981, 0x0C070A6868E29, 0x680608FB9DC27, 0x25F054F42BF1E, 0x095C4287E15D8, 0x144A9E34A7520, 0x7F711EEF9B3AA, 0x5784A2C4A46E7, 0x2DD6F2BD4428E, 0x1D0C95A78DFD2, 0x4FC555F7DC4F8, 0x68FA0BF47A9E5, 0x0000836522724 },
+    { 0x4DA7133A23C99, 0x781427BCFF0C4, 0x6788DE8D09D74, 0x309DF28C55351, 0x2D93E2AC5CA0F, 0x5ADC96D5D4562, 0x3ECEDCCFB436B, 0x76BE5E028DCB9, 0x6135B2563AE4D, 0x02D2ACFED1267, 0x0C7A73BDB1308, 0x298AFC3D81ACE, 0x583170DBE85C8, 0x7E03891EFC2F6, 0x000368EEA47EC },
+    { 0x6C25436617220, 0x1432FA4806F0F, 0x023A38EA1F8E2, 0x588C2CE084B24, 0x6E76300D16149, 0x22833CB5F9DAE, 0x4298E57FDD9CB, 0x763B3B458CC27, 0x075E7F26E8DE4, 0x640882E6E140C, 0x0C47F5B2DB116, 0x4262E97AECE99, 0x5A0F61B0EC9D9, 0x5A6F95BD95D5A, 0x000311F8F053B } },
+  { { 0x07F58CAA39BC8, 0x3841F289C7115, 0x7E206CEA09100, 0x1023FF89551B0, 0x7697BC3C87B97, 0x2A9B53A63BDD3, 0x67F2F6D09E77A, 0x42DB80B2B73CB, 0x33C80BA9A0C04, 0x28D67C7CA7D91, 0x07071A781BE60, 0x716471134F3D1, 0x04FF2A1787479, 0x17B3E344565DA, 0x00039379A079F },
+    { 0x17B555727BE1A, 0x51AF497897922, 0x20C20977DA81F, 0x498F23015C627, 0x79E114D3371FA, 0x239BDD2E7E62E, 0x3ADABD97050EB, 0x0961565058561, 0x656A554871F74, 0x37F62ED0CD186, 0x3313C600BA0F2, 0x7B1DD74ECEF15, 0x0380BF37AA2CB, 0x5D018EDB8F984, 0x0002721DF8235 },
+    { 0x43AB6B1C64FDE, 0x208712EFAD37C, 0x0F74E574ACBCE, 0x68CB605123FA8, 0x5F35DD856E279, 0x6598AB46870B7, 0x778E4167DBD30, 0x363B81AFD4085, 0x63AA553690BF2, 0x5862EA7618BD4, 0x383EA2E9B1FEF, 0x68984F8A8AC25, 0x0B396C4C86455, 0x252346D4673E6, 0x0003AB79D42A5 },
+    { 0x24C655771995A, 0x6FD895149DB9F, 0x2E8D5BD246C1E, 0x73DEAACCAC775, 0x4881D08C1A1AE, 0x16599723CB5BD, 0x3F456B13BE195, 0x36C60F0819048, 0x1F5B687AB7107, 0x53A74088CFB91, 0x1B336F8FAF3D8, 0x5DA6FBCCC6ECC, 0x05FC581A47B9A, 0x05AE7AB42B715, 0x00048A6986A69 } },
+  { { 0x7F10337DD92E5, 0x537D9DF6859AF, 0x06946DC1ABE64, 0x3FF84670333DD, 0x3F6A12E20FB94, 0x598EA87390C97, 0x548235FE29318, 0x2C4783A595659, 0x4D810175FDBFB, 0x2844C5A9C96C1, 0x5DE76EF26CB06, 0x6044EC82409FC, 0x0D0944B3E1AC8, 0x31551F22F6DD5, 0x0001EC5561497 },
+    { 0x231FD1C4BCAF2, 0x056E58F9C9FF9, 0x50E46811AE5B7, 0x5FE592F1D51D5, 0x40715AD405812, 0x0D32888581DC4, 0x641E3B11D7A4C, 0x7DCDE97A5597E, 0x00EBBABC0160A, 0x7F3728D7FC1FC, 0x60550E5762A12, 0x0CFBB2D7427E8, 0x127D318E1B902, 0x40CDCCEF93FB4, 0x00017D99C0D14 },
+    { 0x5007648812BA3, 0x076B3E515CC93, 0x308D93C846450, 0x46A2F0D07816D, 0x4A48CA1D65149, 0x674E0A2AF637F, 0x6BD82B316B661, 0x6A7D923DCA1C4, 0x22B668ADA568B, 0x3C096A14552DB, 0x45875DC1D96CC, 0x133D5388A5DC6, 0x40634A34CB554, 0x1B401265DD99A, 0x000293F09A0C4 },
+    { 0x2903239AC1C26, 0x39F412E161C03, 0x4658DC5CC8736, 0x0D6F7EDD746D7, 0x6A10B9C79B3D3, 0x37D0F811A24E7, 0x1A100149FED10, 0x3FEA8C88972B0, 0x2C21ED8D1EC87, 0x62FF24FA00E51, 0x64CC8EF01425D, 0x5E398AECBAC06, 0x2742330EC4F2B, 0x1F5F26F628A3E, 0x0003BD3AB5B10 } },
+  { { 0x7C7D01B93E9EC, 0x1E2F092F21633, 0x2AED4514530E0, 0x78CD7C9A1C426, 0x7E594A6308E7A, 0x4BA06A7D40CC2, 0x429479F1E7265, 0x1A3DEC5639E2F, 0x1C8E46442AD9E, 0x1522E7FFF41DD, 0x7C0157B671182, 0x274BA0B1A3642, 0x73FA6DAC299B3, 0x755F2B8866F0B, 0x0003D87E28094 },
+    { 0x4CDB541124941, 0x22A158B1043AC, 0x7439B98DA5420, 0x4CBE75202CAB2, 0x7370D6E3050D7, 0x3FDEA0DC27AD2, 0x10AC70414F0DA, 0x4D986B61450B8, 0x42F511E8468BD, 0x2BB20B233F9E3, 0x16FA5E9F2D965, 0x69B69A00962F9, 0x52C9EA601A0DC, 0x0D378237219BC, 0x00010A46B28E4 },
+    { 0x644CF1FF1D20E, 0x19A45B52A1831, 0x188E3A4FDBEB1, 0x039B4780F7365, 0x6F7745043938A, 0x14B1DD5DE5130, 0x7EDCE51A3467B, 0x7288BB800C9E6, 0x14A2FE4F104BD, 0x672365D4BC02D, 0x7CA91CA0935FF, 0x6D03E220ABEB6, 0x19B19651E73BE, 0x354A8AEAF092F, 0x0001C7AD7264B },
+    { 0x0DAE25E92793F, 0x1D7C5B2AF4A0F, 0x369977C012D13, 0x07B5DDC0CC25C, 0x134DB16A57727, 0x44616C1411D9E, 0x0376839458D47, 0x6BEB522B97C83, 0x4CD51DFA503C1, 0x3B570702DB36C, 0x221A5564C1711, 0x695FF5A13A768, 0x00BFF31E91E01, 0x3A05E4563878D, 0x0002AAB32462E } },
+  { { 0x25CD371ED47F8, 0x39DB8B95D8592, 0x13969B266BD75, 0x05CB9B40AB64A, 0x609B15A16CA35, 0x44CDA36DB7086, 0x2FD7B5A712917, 0x44CC54E549F31, 0x3F6A7EB99F43C, 0x61B5AB9C1E306, 0x07A8E55E1C109, 0x321C8505EC6B8, 0x0DF795D3F7AE7, 0x7973FFE93CDC3, 0x000273245F301 },
+    { 0x7A5FC1A929C9C, 0x42C1AECB9B168, 0x6DF411E1BC021, 0x56321F7F6FEDB, 0x35A78536710D7, 0x1A54035EC4026, 0x569FB947C5382, 0x3EB2A01A21163, 0x5615DAFC7D561, 0x59C932F55ECDC, 0x75FC025509582, 0x51A4A2D2E2383, 0x7EBFB3FD5C428, 0x795990F93B95E, 0x0001BD7A9308B },
+    { 0x0E70EAE5BB2C2, 0x46D5515E4C982, 0x2F6AB352F02F1, 0x4C6DC5863A87B, 0x25D1E923CD173, 0x6442DA804BA8F, 0x059A0EC530BCE, 0x399123C5AB44C, 0x32A53393AD5EC, 0x7CCE035AD5D67, 0x3543BB79C3DF1, 0x3F8998AC042D1, 0x386C689F3D2F6, 0x24C535FA441FF, 0x000154FC60B50 },
+    { 0x75173293E1E4A, 0x5571826D9E157, 0x1E6CDD5DB96F9, 0x4BE4B7A610FA9, 0x1730C7F6A036F, 0x6B3829BA4C958, 0x2B39897CC784D, 0x10A95D4349EDF, 0x15FEEA71D7768, 0x7B4924B9AF88E, 0x066569A298D60, 0x26610E502576C, 0x6464D76015230, 0x3224F86E1B9D1, 0x0002C9D1EEAD0 } },
+  { { 0x44C66A7C052BD, 0x2DE1238CDDEEC, 0x5ED163A10F944, 0x74981A40209C5, 0x2FBE1C31E9053, 0x0EE955574BD25, 0x0AB0E28AD9B4E, 0x4334CC6A54967, 0x383B966DE2D2E, 0x46744400F09AE, 0x71388DBEEE85C, 0x55743A54A74F7, 0x202CA5F8D03B1, 0x1FF9A77E6737A, 0x000282DE54733 },
+    { 0x73807B11869F9, 0x482B4237B2E58, 0x14DF15D6F441A, 0x423B04A89500F, 0x1F1F0454C7A62, 0x422257ED1CA88, 0x2D50A20DFD4B1, 0x133C726D97731, 0x6259911451895, 0x1A7611A8F9465, 0x6ADC0913C2949, 0x40F5528822614, 0x2400A6318679E, 0x30CEFD576B3B2, 0x0000699D0B683 },
+    { 0x73E01A6F9071D, 0x606F1E58C787A, 0x0EE434BF742AF, 0x5145486365F7C, 0x70B4157EE1845, 0x57D27B7BFA795, 0x2BCB99A480347, 0x339760D80924F, 0x132F9EC8B88D7, 0x53E2337DD782C, 0x59A0B6DB8E553, 0x38F92F9781F89, 0x4F76B4DF25D1C, 0x60686403894DA, 0x0003F1F9D8090 },
+    { 0x7BEF8AFEB6069, 0x70400C985B3F2, 0x1DAB6E2D2F56C, 0x67F40FDBFE8CB, 0x0CA621AD557DB, 0x035A81DAF829C, 0x2D7BB2C867DBB, 0x75D7E14EEC4B8, 0x0CD22AD2E3BC8, 0x75B21BEA8C12E, 0x079A3CEF8C63A, 0x237FE78A2E416, 0x101D9986B637C, 0x028553C815563, 0x0003A36C99168 } },
+  { { 0x67792942C20A1, 0x56D5FE63B9C37, 0x3A362A1E436D3, 0x291990D3CD54E, 0x5987C029BF7BC, 0x39680079799A7, 0x68CFC832116B0, 0x2902506869E25, 0x3104C37BFF601, 0x7D91D91127BE1, 0x42619C33D0938, 0x510845F3F896B, 0x6E565C63A7950, 0x3300CC73D234E, 0x0002CBD60F87C },
+    { 0x2E7A43A5DFB13, 0x7BA4CA0856D37, 0x5839E09CC5AB9, 0x27663E62D7CE9, 0x526130937BF3A, 0x2D488838D2629, 0x17652ABE6034E, 0x442432EC9DF0D, 0x38CF0FDDD10DE, 0x465B96A04E355, 0x22527FF3E650C, 0x586754EAFCB32, 0x039A4495101EE, 0x3305071AC350C, 0x0000C002FE857 },
+    { 0x06BC97DA6836F, 0x67CAB68EC0E37, 0x1E7FDC10E5916, 0x43B2CC4E389F6, 0x5E8BB785DA479, 0x5C098D8B1B800, 0x427807F7B28BE, 0x4304747266C31, 0x60E2A0811F642, 0x2387E7BF72C0F, 0x3031D5D28D353, 0x715358B833DE4, 0x32032E162BD60, 0x39D81B40AA137, 0x00037F89E9416 },
+    { 0x7F1F78265E04D, 0x4CF3F4C4E87F5, 0x5688D9EA3790C, 0x659825CB69B27, 0x0A6CA408A9ABC, 0x12169FB2953C6, 0x4FBC4AE7ACCF7, 0x1FCEBEC978452, 0x6160285B0CB5A, 0x3F119B4180930, 0x0E85B352A5B25, 0x232A39C4DF6BF, 0x1DED9B72E9E54, 0x02E5DC1A7F0A4, 0x0003EE55A317F } },
+  { { 0x429D670628014, 0x7F7B5F0F241AE, 0x74A0A1491E3CE, 0x356F5D0D645A5, 0x19581D449C64A, 0x42FB372D90679, 0x32E3A827A2D4A, 0x7EEE74E529653, 0x2CF13A3E3F36C, 0x48FF27F4E01A5, 0x5058141315C0F, 0x04691D34FD05C, 0x5CAAE76DBE2E4, 0x4919BB5EA691C, 0x0005B02BBB808 },
+    { 0x74976DD0D2A2E, 0x0B1B659BEB958, 0x202D383E611CE, 0x5CE51D2D076B8, 0x6E67F6A5111EF, 0x4932E52999D21, 0x56878ABB6E852, 0x085050C531795, 0x31D2A300D1B86, 0x124A3DD2F674D, 0x3AF0A2A2A8E82, 0x2596E26C4E8D6, 0x5C123C94D2263, 0x1632F9486CFF6, 0x00015133192C3 },
+    { 0x29961B4F37EA0, 0x53E371FDF3CCC, 0x0DEC4AC0CB8A8, 0x0350D1F45EAB8, 0x3602A718E315E, 0x2F5F3E0B2E77D, 0x3F0266D65A3D0, 0x147532CFC8BA7, 0x20BAC5B98D481, 0x2B33D95665600, 0x5CBC841710FBA, 0x0B2163316049A, 0x64508669EF363, 0x0676F7F2C1986, 0x000479B99A72F },
+    { 0x00A9F3C095C68, 0x53376B3342FAC, 0x6C7B6C8AB3D3B, 0x0A3FA776F7F84, 0x70C61CE3ECFAD, 0x56C651061C79A, 0x4F7003ED88573, 0x3A8A9C781EA28, 0x0B8B829ACABBA, 0x02E9564055FAE, 0x0F9949140DB1B, 0x40525EB3374F4, 0x2EAB0B52B83B3, 0x54F246A2191E8, 0x0003C18232932 } },
+  { { 0x76E134379056D, 0x43922F2A7DF11, 0x0E82DBC4AE0A5, 0x587786C3BB6E8, 0x3453A4EE12CA3, 0x14B6CC3B8961D, 0x164609DBAC158, 0x29D014A934DF5, 0x34D91635737AD, 0x7D560D874AC7C, 0x06165D60EA413, 0x0CD3BAC1FFD74, 0x378DA108CBFC2, 0x44CF90A982F52, 0x0003CF6B590CC },
+    { 0x00A6846C3C73C, 0x5A3D242069371, 0x7C81DA7CC95CD, 0x57989DE0EB781, 0x1486B151C08DE, 0x0167EF68F8FAD, 0x671E2431C51EF, 0x6B4E2CCB18FA2, 0x014109309EB8B, 0x5605BD95127AE, 0x20AEC2061C9ED, 0x2F51ACE42E15F, 0x19AE861C4318E, 0x1F6E84CD658E9, 0x00029EA62BE8D },
+    { 0x69B46654BBCF1, 0x249C30E8F028D, 0x0EF7D66F0E01C, 0x340BF6F13EA79, 0x1296BC77B5B0C, 0x1843BDE6DB72A, 0x5F32027215F2F, 0x373BB57B4B37D, 0x4590690B6091D, 0x45CC8E097BFC5, 0x1339FCC3D2E84, 0x78918AFA6DB6E, 0x06C2498848E51, 0x7B0EE56234579, 0x000085926A92C },
+    { 0x7D993367F287E, 0x4C547F076C404, 0x7D69DEE8A872D, 0x3892C57546086, 0x4D580686194B6, 0x1D1EF2D546C13, 0x60E62F7A33258, 0x310C7F4C9C6EC, 0x2777B70AE02F1, 0x3EBFB9486BBA3, 0x38573CFEFDD10, 0x0F5CBB95F662E, 0x38E84A74D167D, 0x75D2A25F81E06, 0x000358B7B7A94 } },
+  { { 0x014445EB352F8, 0x7ED0EBB8084A5, 0x211BF02AD5F13, 0x5FA7C7163F89F, 0x433BB30BC678F, 0x5F33CB3EC6A57, 0x2678FFDD875F7, 0x536C26FF181F4, 0x55ADA316AB816, 0x370B75C937CD0, 0x7D8ABAF2044FB, 0x7A669BCD8FBC8, 0x46F7FECC5AB8C, 0x1AA9D147450AC, 0x00026F749141F },
+    { 0x364043942D6AB, 0x062C4218B7165, 0x46D810B1A7B3E, 0x0B95EA641C9C7, 0x1E396E2BF92A2, 0x6A57029214009, 0x3A514AA75B611, 0x4605D49566C17, 0x493AD3E7AC945, 0x5B426037E4619, 0x1323EEA50A7B2, 0x09010AC27CF14, 0x6F98304401509, 0x387EC1C14D43F, 0x00027A8557F4E },
+    { 0x1AAA520857B7A, 0x4AD1BF088403F, 0x66B379EE688F3, 0x42605AF5BF94F, 0x3A0BE0D0F68C8, 0x3E20E6FFB34EF, 0x29D36FA496700, 0x0E4C40C605E9E, 0x64C9E29D06912, 0x2F6DB9B37FB99, 0x54103D507B10F, 0x1EAF621DBCF3C, 0x1701F50850416, 0x634F73BCA9AE4, 0x000277944B8A3 },
+    { 0x7ABA95F75D173, 0x5C852935ED006, 0x5FFFCC677635E, 0x50B846AD73FD3, 0x735A92FC6D30F, 0x30CBC070DF5EA, 0x1DEA41AC53DDB, 0x05F7C7551B15B, 0x1B883836E2C8D, 0x1546411A43E7C, 0x747027E81A289, 0x2F7A842E28865, 0x7F09CB65026BB, 0x3DD0FEA683AF1, 0x0002A53AB6081 } },
+  { { 0x06BC81BA66042, 0x1B1D452EEE781, 0x79BB16F71D44F, 0x340F6EB9AD005, 0x5074C31681C01, 0x6DD016A34AA4E, 0x4FC34C7CAF95E, 0x44F98C1162C69, 0x7A144473A0559, 0x6D3925CA0DEED, 0x199E33C832B2A, 0x742518514B5F6, 0x62C91658DB937, 0x1556CE9527F49, 0x00045FEF3FA1A },
+    { 0x14BF1BF1DFE5B, 0x718B08FA58F07, 0x0C88AC36CEEAD, 0x0EE65E462404B, 0x6216DF7A70FFD, 0x535FE044706FF, 0x34EDBD37D685B, 0x085EA3B205824, 0x6FFF059893BE4, 0x6CCE972ED71F1, 0x1A5126A247070, 0x6F45A4FE4F3E2, 0x01E1327B5A87E, 0x56CBB32D607E1, 0x0001D5BFB0CBD },
+    { 0x11166A07E12AA, 0x1114CA9652972, 0x20AE262992777, 0x3B116572B16B7, 0x125A6155845C1, 0x677238DEE8117, 0x55EB56FF2CFFD, 0x75843D6262B51, 0x0BF10B4721288, 0x61D26651EBBD7, 0x6FC3C56D3C53F, 0x7FFCC4DEB3175, 0x34601327AEAC4, 0x655B12002CE99, 0x0002F864E54F5 },
+    { 0x3B1896AAABB57, 0x6B0E705D48745, 0x146109C18F89A, 0x0720630561424, 0x0E91D1D403C90, 0x5DC53127CD71C, 0x52DD8E65592BD, 0x0E4A8905FB62B, 0x0484CE152224F, 0x2D573C4CD30BA, 0x41125D2D0DEC6, 0x0FBF27FA4D994, 0x468EFDB8DBCA4, 0x5972904C994BE, 0x00045A1DF21E9 } },
+  { { 0x46A762D85E097, 0x7F74FB013BC82, 0x022317EFE3519, 0x4DA7441BD17D1, 0x1FE4851E167B4, 0x4CCFC999ABD7B, 0x345AD2FAE0CE6, 0x50BD9E2A861E4, 0x4A487B4C4B23A, 0x0690745A6D4C0, 0x64ADAB0000CA3, 0x7D0F3464EBE34, 0x2682D3630CF27, 0x09C425D2840AD, 0x00050D4744D20 },
+    { 0x7CA31AA837A0D, 0x48839DDE396EC, 0x3CB0544298F3E, 0x23381FFD6DD17, 0x381E50879057B, 0x7FD5E08C5510C, 0x2614E01082840, 0x59B90461873DA, 0x37E4F778507B7, 0x41297620FA436, 0x5EA42161C8E78, 0x6089FA24CDBB8, 0x516E65A19E5FB, 0x06AC3B26F16E9, 0x0001714282213 },
+    { 0x0AF966E94C115, 0x7FDCB95EF4D9E, 0x72832C546A0DC, 0x53BC5085B75C2, 0x77512E4BAB94E, 0x0FB48BE3FCE68, 0x67B74E0CC89F2, 0x360CB9FBE7CF8, 0x0F587B49E97E9, 0x65EEA2A3A731F, 0x3E32861A93C09, 0x69A9EB8A6E3F3, 0x76E8775AD147C, 0x628D1BEF7C6B6, 0x0003B463B9CBE },
+    { 0x2EC191C037D31, 0x32151CF8E0815, 0x4AD7903D67F90, 0x488F59B7339CE, 0x151976F30821A, 0x71DD613128FA5, 0x2314AC57BBFE5, 0x20D45995966F9, 0x2452AD44DC8BB, 0x7B53CEDA53413, 0x77D2FC1E0B3B7, 0x70204CD15BA85, 0x39D6DBC90192F, 0x15BE4E15D82B9, 0x0002AFE5B6B32 } },
+  { { 0x1D14E123BDF40, 0x1C408D3AAF453, 0x31CAE60DF24DE, 0x2FE42927637FD, 0x13663879FD576, 0x57DBBAE2E87EF, 0x115807B20989A, 0x6D6EA703FEE05, 0x4FD4B182EE8D7, 0x2294F19D497A6, 0x682BE09C5B96C, 0x5AEC9A83948DC, 0x1C969B5A5AB52, 0x7A8C4A660A6D4, 0x000566EED25F2 },
+    { 0x293EAED0E4963, 0x17D079AD4DC7C, 0x4AB17DF8E15A3, 0x0358264B7D44C, 0x602A4EDAEEA6D, 0x57E7B6AF36559, 0x5C2E049C9FB66, 0x130012A085F47, 0x072B931412250, 0x3EDCC2DC6C445, 0x7A1491E72540F, 0x20B1EFBEAA4C7, 0x3E06950E19723, 0x3EE347FC77004, 0x000216CFD1FC0 },
+    { 0x7699697F0F2A2, 0x097FE4268B1F6, 0x12C1F1A851BB2, 0x47CF120345C63, 0x7B037D448EA07, 0x668DDC16A9F26, 0x475AD8A5225E9, 0x7521CE32424F7, 0x1E17963E86F42, 0x197BA801C48BA, 0x5B881403738AF, 0x6D0B40A39F57F, 0x4B532B3505E2C, 0x69DC7BA01AD85, 0x0003B75C87703 },
+    { 0x4566127E10A4D, 0x6F44382AF3D8C, 0x12B15772450FC, 0x219213E9AF1FC, 0x729B66272D704, 0x3219367397069, 0x37A4D51DF25EA, 0x4BF6C7B15BA84, 0x0A89255B27202, 0x0ADD2EFEA0170, 0x2BC03BE2FB945, 0x2B8FDD675CD32, 0x1ED2A56251252, 0x368DA02FB5259, 0x00027875243BE } },
+  { { 0x127821DF16D9C, 0x397A7AF01BA0D, 0x7BAC0EEDC6514, 0x39C45C3F27898, 0x06E950609C064, 0x4781D9E97DA16, 0x5D3749C0D39FA, 0x2F54F671CD89E, 0x77994376F04DD, 0x0A08FB4581AC7, 0x09606AA6B743B, 0x6374705FF81FC, 0x386A3CF4C80CE, 0x0FFA8B029236F, 0x000638A4D74BD },
+    { 0x3244B992286D2, 0x557F8D7E7D152, 0x7679672590C40, 0x4F363F4A08A50, 0x2DE618CE76C9F, 0x191BEFD05D387, 0x6F277E240BBE7, 0x1FD713AD1E871, 0x28C34576DDEE4, 0x3A8C9E5B575FB, 0x65022090B849B, 0x347672A2AD155, 0x6557254C531AF, 0x346A7EEFE8900, 0x0002441743CFE },
+    { 0x57996AEEE28DC, 0x4E2AD9D6CD5CA, 0x617FCBC9A354D, 0x67278575CA30A, 0x36820DD5132BA, 0x7EFEC7E5AEA89, 0x08C3B8B25E747, 0x5315E6D58AAA9, 0x1B10D33E3E7CE, 0x42B302A0954FC, 0x20776693B3046, 0x59ACCAD1F9B5A, 0x25BE43178EB1B, 0x1E3E71E397E7E, 0x00038B9F933C1 },
+    { 0x52B1CB26AF658, 0x5A20BF6DA3F81, 0x0F9D0F433DD2E, 0x6C576CDF00044, 0x7B685119AE18D, 0x6687CB677ED3A, 0x2D03ED7B0268A, 0x119DDF62487B1, 0x19D247427F60B, 0x43FAACDBCAA9A, 0x23566EABEE7B1, 0x3D736C956B670, 0x3C90A53E3F62E, 0x17B5DAF30FFDE, 0x000443F3A685A } },
+  { { 0x039F4011D9DA9, 0x43B2ECB9EA961, 0x1FF9323032B0A, 0x3ED4C5EF8A793, 0x199FC64FE5ACF, 0x3FF075DE5A198, 0x58CECB8C20A59, 0x76E8F0288FC94, 0x5372A70AA5E95, 0x05A06DC80EF5B, 0x02116483411C6, 0x56EC1160C76C6, 0x02A916026FA23, 0x6692A672488F9, 0x0002C39F6D592 },
+    { 0x343781D348D8E, 0x62390E1444697, 0x7CD3A4886CFF6, 0x1E9B530B149C0, 0x2B0543B61A291, 0x672D43400CCD5, 0x60145463BB1A0, 0x7F34867538679, 0x1E6EFF21D7771, 0x36815489101F8, 0x6E7364ECDB1E0, 0x7B9F3B8C5ABA1, 0x7F5EDC6607B77, 0x6D9FD6BA6910E, 0x0001B600B0535 },
+    { 0x10364328A47B1, 0x68BA20A8BCCB9, 0x45F6492BC2CCD, 0x4C999858EC2AB, 0x216B92BDB4127, 0x7ACD06E4986BE, 0x52E112A07BC10, 0x64030E3AF47D4, 0x031AFBE94E95E, 0x18874E695F631, 0x3EFD6ACAAA0A9, 0x788B8D2AFC234, 0x0A7EE58EC88DF, 0x73E8614BADCB8, 0x00033B1E50DA0 },
+    { 0x28C993E13122A, 0x290AF996CBFB9, 0x292D77ED88FFD, 0x6477B4D1CB5ED, 0x174C9F68F84AC, 0x571157EB9E599, 0x7C2EFAA83D7F9, 0x1A4C608CE91EF, 0x305CF2F549951, 0x503BAB82E8593, 0x3D151F8FC90F7, 0x0D2468D1B0796, 0x23FCF2CD01851, 0x7053FE64C3B5E, 0x0004A2D84BFB0 } },
+  { { 0x7195B43D73DF9, 0x4D9E8327847DE, 0x08F0BD983FF6F, 0x3B346E2B333F2, 0x165FA10E789EA, 0x12FD6E96F06D3, 0x380F9BC78FA8F, 0x044176AB5394E, 0x2CAE4FA06D10D, 0x40C8662E907D5, 0x392F739897D2F, 0x5EAA34ECFAB56, 0x48BACBE167F34, 0x0539C30A6BED0, 0x00063571C8A27 },
+    { 0x34528F2DE7EEB, 0x57C11581FF3CE, 0x45678230F95DA, 0x73A137AD0D203, 0x0ECE24384B139, 0x01EAA93286C0A, 0x53E277CF0276A, 0x059F5797E283D, 0x2E9EA20356433, 0x00C091A71E17D, 0x21CBD9735AFDA, 0x5DAF58CC05DA3, 0x1E99870A87241, 0x461BE4733F9D7, 0x000242AD63FFE },
+    { 0x39D9AAD73E5B3, 0x74E4ADCF23596, 0x78F693B0CF9F3, 0x702AED0ED6B33, 0x30E600A6358AD, 0x451F8F9685669, 0x126375892D502, 0x250312E766F2C, 0x60CDA09549686, 0x214A3C5565456, 0x037209D6230DD, 0x7E585CFAE3620, 0x3EA64DC6C8B32, 0x3277928D1A841, 0x0003DF757FABB },
+    { 0x58E084920385D, 0x398B9FAEB1D45, 0x5A563CC164A86, 0x1E76FE88615C9, 0x4D7E48CBD1AF7, 0x29DBBE7D517DD, 0x3E8D75741D77F, 0x7BE14AE43A987, 0x720E1BB1EF109, 0x18AF90E59EEF1, 0x1486295FAFB82, 0x2C938C1A8C165, 0x608290007BD4A, 0x7B6E0D1F33EE9, 0x00024565372A7 } },
+  { { 0x4F0DDE9156693, 0x6AD5EA5D3216D, 0x3B6F5DDE2DF9A, 0x44FAEF27EE77D, 0x0A206E017553D, 0x14D4061981BE2, 0x347121CE2FDCD, 0x02ED1291927BE, 0x316F70FA6EBCD, 0x7C5DBEB881A12, 0x047D44F88C418, 0x19EE279B10296, 0x558F335AA2C5E, 0x4FF8A718A805F, 0x0005B28868804 },
+    { 0x637CE20DB3BD3, 0x27842FD52163B, 0x1F540FE35AA93, 0x5D60026867FB9, 0x4F730842EC10B, 0x16D803AF0153C, 0x4B47DC31C984E, 0x19058581622B9, 0x373C436B0A031, 0x6CA3E6FB92530, 0x0DFCD9519D51F, 0x3127DEB5FD2BE, 0x61C61FAEB5B13, 0x22BDDD647B624, 0x00012DA28D03E },
+    { 0x0C9785997154B, 0x4A973388293E6, 0x1E746FEA776F4, 0x40E863D5E4C6A, 0x4B5A153E7E951, 0x18497AD6B9447, 0x47FF78C28EE87, 0x5B5AB8FDBECFD, 0x417025D5C0A2E, 0x276802C6D802F, 0x642782D5196C0, 0x39CE0F5983397, 0x3E20BEBA38371, 0x332918D0C888D, 0x0002CCF485A13 },
+    { 0x535B70A506F53, 0x07C2AD19BCB38, 0x6150DEB01AA32, 0x47FD7B6679583, 0x2B22BEC73753E, 0x417053621177B, 0x5E9052BE5D742, 0x154457DDFE239, 0x671830491C892, 0x0388204495B13, 0x7E68704A02845, 0x52D71AE243DE8, 0x063D7D7794BEB, 0x359F0DCC66D0F, 0x000470B99B8BD } },
+  { { 0x2898FD4199533, 0x0C12FFD84780A, 0x14332DFFCE290, 0x4E99E0B1FF2D2, 0x4B3A2D3C9320E, 0x089098C5028C9, 0x2B5EE443A3FE8, 0x368759A9B0D33, 0x5D19AA052F9A8, 0x16E4A86CB88AF, 0x0FFD00E634549, 0x0C617CDC0A432, 0x2890C9624AECB, 0x0A7F3DC552D34, 0x0001E3E793EEC },
+    { 0x6D4856B3B24D2, 0x311386503C7BB, 0x5337D8D096023, 0x7A1A520C339FE, 0x4C2CEB6EA3A83, 0x48A7A3C3B5A2A, 0x279BF69E9A596, 0x77EE3878FA9ED, 0x2169F7CC3565E, 0x2DC3D8EF977C3, 0x10E52C93D3E18, 0x44F58CB420A32, 0x1FE6070CA077E, 0x09828971C64CB, 0x0002BC0030C04 },
+    { 0x6A6B83A91891D, 0x312F6637E0985, 0x234D6964C4610, 0x4C79DB2384894, 0x3B92D9BF08091, 0x0A0E0362B1858, 0x58C3178570635, 0x17EB2523F7C12, 0x5B07D162C3E07, 0x4075174BF159D, 0x21D98384DBB23, 0x3D2677ABBEE6B, 0x141F943D536E8, 0x5072EB4A454C3, 0x00051809E53F8 },
+    { 0x31C62B37986B4, 0x574374086DAC5, 0x3FA7305FDF3EA, 0x6C24C427DB4A1, 0x3F776FF0C50B3, 0x006223EBCD2A7, 0x1B50BA3708464, 0x23FE4ADD087B5, 0x49F471E2CA4E1, 0x203D6B2DC3958, 0x6BE5D67148910, 0x6F7803FCF2F69, 0x0695DB9DEC310, 0x3E493D7FF0ACB, 0x0004247ED112A } },
+  { { 0x13CBDAFAC9D67, 0x530594BB089F5, 0x129EABFE1B3CF, 0x5ED0FC351E56B, 0x39207A663FB94, 0x216C6A49FEE7B, 0x5EE4BF5306FF6, 0x09F1762B5EFD0, 0x1AB2D3E4EEC20, 0x02AA23D557A58, 0x52F6323BCEC16, 0x5E2768CCB3833, 0x0D2DBCF50EC80, 0x41BB590F12760, 0x0005FCD67501D },
+    { 0x59B5A851F9CA2, 0x697F261EA2FB8, 0x4C5AD9C27F091, 0x55DF97D126B2B, 0x651CF9671F82F, 0x1414A9AE3484C, 0x17E2395149715, 0x4F0282B1B6E8A, 0x0C95ACF5EBFF4, 0x04E9FB4475B80, 0x63D2018BC0E95, 0x6435298BF82DE, 0x4AF5C09DC8392, 0x06ADF609C083A, 0x00034EBCDCCD8 },
+    { 0x6068C7307ABC5, 0x53F2443EB3D8F, 0x2BE0B6E2F276D, 0x2D5901EA8A626, 0x5931787C81A85, 0x70A585001CF38, 0x7C3E00C42FCD8, 0x4210C0E742CA1, 0x0BDD0C32C71DE, 0x07A1C18AE286D, 0x5CBC6773284EB, 0x10F88590C7DF7, 0x061F692134E10, 0x43965F8D1DAA7, 0x000321849034D },
+    { 0x56899EAB60B50, 0x615F30D0F9A30, 0x6EE316A958C82, 0x357F8D2146EDC, 0x5ECBC490D0B40, 0x7636931A4678E, 0x1B6E95AFF13F7, 0x0CB60B488995E, 0x0F5826C644B2F, 0x483E18755D014, 0x7149928501D18, 0x7B667390B2DEA, 0x4B498220270C5, 0x7CFC881D14DD2, 0x000376CF10275 } },
+  { { 0x448846B54FE46, 0x6B99D38E66BE6, 0x28D04B5C0C280, 0x24658A9521AEA, 0x7E8E69835F5C2, 0x5D30DC377AA6E, 0x770AE4428D680, 0x12D5B1F249B64, 0x7939D8F8FC51B, 0x30393F23BEE69, 0x182B5D0C8605F, 0x4D85A2AF3E718, 0x1B1074791CEFE, 0x13584BB99A6EF, 0x00023A77CF722 },
+    { 0x08ACE99D4BF66, 0x0859365D5522F, 0x0E1A06EDB2606, 0x4C95F6CEC6961, 0x3FDD91D123F9E, 0x400820C44F845, 0x2635DB072C297, 0x2166EE573273C, 0x4687ABE90F59A, 0x08A0CD196C684, 0x3497294BDA817, 0x4AE41BC8DBF7F, 0x6B18F30635722, 0x0BF8F4BE87949, 0x00023AEB68813 },
+    { 0x60E4B54AEDD92, 0x3A0CB35131185, 0x7292F6EBC1DFB, 0x32E363200DC8A, 0x02F085AB40691, 0x5D4C4575868B3, 0x75A24F503D208, 0x7E539EC77E9EC, 0x26EE3524265A2, 0x7AD0294726447, 0x1B9994AF1923B, 0x54910AA7B8079, 0x4EA4EA6F5F1F3, 0x2F5C4774D0806, 0x000335B188BEC },
+    { 0x17C824CE7BB7E, 0x0C73C617FDFC4, 0x1729BE6F28AF4, 0x0EB933AFF929A, 0x5A2C68EBD3735, 0x1AFB0438C1690, 0x7909A41CFD974, 0x64DEFBB301F07, 0x5EBA4A2B4AFC0, 0x47FD8DFFA5466, 0x788666EF75278, 0x2064706314DBD, 0x762C68B15476C, 0x7F88081123EE2, 0x0004B7826A473 } },
+  { { 0x0DCBA1E25BA59, 0x28C0CA8F6F278, 0x60347F9E8A6EB, 0x5CC88BDBC6316, 0x79ED44885AE7C, 0x7CF9A7D346D77, 0x19FAAB3D91ABE, 0x6768C4EF12B64, 0x5EDDA44D5F6F8, 0x2CB8C7C8F2F75, 0x77679C344DA7E, 0x21F5851119E13, 0x145B2E59A284A, 0x11C04A1A78B6B, 0x000331475F28F },
+    { 0x4629882F18658, 0x1C0EF6353A393, 0x3BF432BFD38E6, 0x66CC208646281, 0x757E65695BFDF, 0x068C17E5F02A6, 0x01E3762EA9FE6, 0x7E0DD18618046, 0x2D1AB0E5A0B36, 0x38969838EF01E, 0x27B06678D2319, 0x4C97475AA9005, 0x6A0C7BCC79452, 0x461C7EA2AF48F, 0x0002733BC2F37 },
+    { 0x2BC3D6A634FA9, 0x3B85DFBDA6C30, 0x580F70EC89C83, 0x6CD062A7F0DCA, 0x7D07B57BB96F1, 0x1B8B6765E19A3, 0x7422000BB7509, 0x5E0C4622C30A8, 0x3936E2199DD69, 0x630ECA22078C7, 0x3BF8497AE017A, 0x767F3F9BEDBD1, 0x5701E65796D34, 0x2EB98B2ACE6A1, 0x00031E7876BFF },
+    { 0x34A2E3B6B1EDC, 0x79DD3486E1DC2, 0x007BD221DF1F5, 0x05A225EE288DA, 0x5CF96FB4D8C71, 0x7C548440AF314, 0x3EA0A872B4936, 0x29533ECF88E33, 0x1963AAF09EA5B, 0x794805E323DFE, 0x4C28E8F10C1DE, 0x7A0AE2D6919ED, 0x193B3F9BBD93B, 0x77C8567480BCE, 0x000431F9E138C } },
+  { { 0x00B8D2605593C, 0x7781BE52600CB, 0x5849076650EC0, 0x5311E6D805BB4, 0x270379809D1E5, 0x5884DB971F040, 0x59CF69BB816AB, 0x361E2307F6A64, 0x7C7F398FB8B96, 0x336AD8674D6D1, 0x0DC6DFD0EAB4E, 0x54B15ABD2C874, 0x6ECD006921197, 0x2886B484B601B, 0x0001BB770CF43 },
+    { 0x56FB43116BD50, 0x6F828B6D9D759, 0x34A95D69BB6AF, 0x0CBC008A2599C, 0x476568F2B67DE, 0x2C3143504D27A, 0x237C1FE229EDD, 0x62DB904D6A626, 0x03BD00DC3A5ED, 0x4BA644768E71C, 0x0F034E564A92F, 0x0FD79BAE77140, 0x729A633725C68, 0x6838FA66A3238, 0x000173624A940 },
+    { 0x6575E7F021D4A, 0x2F8A750B7D1E7, 0x56E72E4756132, 0x795898900810B, 0x28C901E26C2C0, 0x0AC023C90245D, 0x39F54E89BF160, 0x2A2562A84AA2D, 0x618E732A228D6, 0x4B7627D0F6F5B, 0x27A12B8009DA9, 0x3DA74E2B311BC, 0x4C933650199F3, 0x2C8ABED527807, 0x0004D11E4D1A6 },
+    { 0x290A0DF7CCC78, 0x6118DA4A6B1AF, 0x1E2E1CC329A07, 0x28C6EBFFEEA97, 0x1C037CA15C053, 0x4B5F94669B883, 0x465D84E7E9165, 0x02BD91D83A1C7, 0x6B8226A5DBAC2, 0x1FB97F3BD949F, 0x315D95B86CCE7, 0x61474BA6C1331, 0x085C5A347CE6D, 0x1BB034DA77068, 0x0002A53043F0F } },
+  { { 0x0C7E62C424F3B, 0x2AD7BF239BAC4, 0x5FFF7E298F107, 0x60FAB800B8B62, 0x2EA4C3503C64F, 0x3B4FEFB11826D, 0x3D0F4705EE6E8, 0x6A7A1B8E159BA, 0x2D9A48BB6310B, 0x0785D2D933A36, 0x16878FF3F0396, 0x068827973C078, 0x06D88B871BFC3, 0x5964988964C98, 0x000269F078BC3 },
+    { 0x13D2AE0E0544B, 0x10FEA0E2B0212, 0x69D615DA30438, 0x5C330D46A3816, 0x22AD2DE944200, 0x73C82180E8A38, 0x4CE3E86DA1F31, 0x7332F398047C7, 0x583909E4D284A, 0x66FE127BB2266, 0x0253561220CC5, 0x752DD2C92DB65, 0x2C826BEC04A63, 0x5610F399DF000, 0x00029C82BE78B },
+    { 0x1D0307EB7EFAB, 0x53744122020E1, 0x781820FE96D54, 0x2E3DB9FD98EF6, 0x0E7DA699B2254, 0x18BC6B2E9B5D0, 0x355A5F36B52CF, 0x777F6A701F751, 0x59F44647AB83F, 0x16F1FC83CD168, 0x6C1F19FF2B7CC, 0x63B1A79E70D35, 0x3C80C65A8943C, 0x4AA101709CC64, 0x0002BE339512E },
+    { 0x60259F186B77D, 0x1957628D0059B, 0x4EA17AB7C6F85, 0x2448F2E82606B, 0x6EAE2331C31F2, 0x4F47B3DF69161, 0x2C2BDBFC45238, 0x2307696AB6ADF, 0x174DF45BE2441, 0x3155B75E0BF48, 0x73E489EEB3481, 0x26AD2A63133B2, 0x2E124D794E2ED, 0x585761333997A, 0x00036F34B3995 } },
+  { { 0x6ED696026D855, 0x53152DED8BA14, 0x7F2015EBB03ED, 0x7EF55837D40FD, 0x2EFC8F60A9EFB, 0x119EC3ABBD4A9, 0x73854ECA07012, 0x07AB96B34B115, 0x1533591B321B4, 0x4DCC44AF01A08, 0x728B2D2F7BE25, 0x17E61EEB9E19F, 0x183A8A187998C, 0x77F8FA840AF92, 0x0000C597A8949 },
+    { 0x0969645E16343, 0x533A5B5D89589, 0x10C5189338D55, 0x55551E9CFC3FC, 0x6AB4BB8A405B4, 0x3500E3AA154A1, 0x4669D8C88DC87, 0x6313F05A3781D, 0x76075B2F78838, 0x7810BB2BFF089, 0x34724942C2420, 0x21E7F1EC7BCD0, 0x4EFC6BFDD2A7D, 0x75BFEDF942CA9, 0x000270F8B00D2 },
+    { 0x6BE9FE6818A91, 0x5B8AC9799C88A, 0x33EAD285770D6, 0x71E42E17E764E, 0x336716D49B2F3, 0x121CE1E4495E4, 0x0ABA3272AB10A, 0x2DA9ED619C91E, 0x16AEC05BC643E, 0x098FE8F7BB149, 0x68C0196798DF5, 0x6E5F2951657A6, 0x05EC3EFA7F6BC, 0x705A99E862E64, 0x0003328D03BA9 },
+    { 0x39ABF25737A23, 0x6F098A36E28B7, 0x2D6D28EB75601, 0x3E1774C9AD467, 0x24CCCB83EE32C, 0x336D0E3962084, 0x408B79528AC47, 0x0FE9E7EAE0592, 0x71B95D48F95B5, 0x7E6B95C367A21, 0x36586567882CA, 0x6D99A400BEAE6, 0x11D51163DF0A9, 0x0B03C637414DF, 0x0003D8966F0E0 } },
+  { { 0x0F285E19A9130, 0x7096DED18E2EC, 0x7B98C9A1A60FF, 0x581F252B50F3A, 0x0E87D7521F6CB, 0x5464FE9998E5C, 0x26A81C4CCBE62, 0x7BDE7E9A4C80A, 0x4EC3E0064F453, 0x49754C5E98FC9, 0x25C34AE61D4F8, 0x66B9079060590, 0x386457FD4D8D2, 0x2A868F6E6FBAB, 0x00013591EADEB },
+    { 0x6BD96D84AEEF5, 0x72D46430F596A, 0x518ED83C07607, 0x3F46668EFDC22, 0x6AF101AB41D8C, 0x0F993F48B1FC1, 0x3DD30FB5DD0E8, 0x664FD421E75C8, 0x1DD1FDE08AA08, 0x71AFE2BF249E1, 0x7704DDAE55D97, 0x506A26864D23C, 0x17D7D8CF0AA60, 0x189A483588B3C, 0x00010DC61ECCE },
+    { 0x29FA11E47ABC0, 0x0AC6EED22C330, 0x47BFE1FED8EB7, 0x204858B405C1D, 0x6D268E71393E0, 0x57C7BDCAA2576, 0x0BFD530D70E21, 0x3EC1D8BCDF991, 0x591F2D1FE70B3, 0x7971AD09B06C6, 0x65CF6574FC1AF, 0x3C0CF9094BC35, 0x228475514C4EF, 0x422BA2628C0E4, 0x0002F493EA1E4 },
+    { 0x73CA3F7459CD7, 0x6226B005025E1, 0x3007A5ACF8440, 0x7B9FB1DEF7D11, 0x78ABCB58225A4, 0x4A44FC1689680, 0x576ACE23606CE, 0x41218A844C53A, 0x56811170B84F8, 0x0F0E0E17E332F, 0x1986D00BBC8B6, 0x3716F2FFC09F5, 0x2E363DE0BE5D8, 0x350DE05F51746, 0x0003DEC2BBBBD } },
+  { { 0x137F0EE61F936, 0x44F6A041D1B4B, 0x46D2E0DAF27A3, 0x7B322AEF1E094, 0x5981ECDEE6EC8, 0x3AE2AF970F67E, 0x1AB6CA95241D9, 0x099247A18C513, 0x3647E493022B4, 0x29F38F811343D, 0x5050FB71D8BE8, 0x11C07862AA454, 0x25E748A140539, 0x5986CD63CC26C, 0x000517C99483F },
+    { 0x14470A9D90E93, 0x439E897ADA31A, 0x3FD4956FABD88, 0x20BE0D5C97FC9, 0x55969F5289A80, 0x2AFA6350E1315, 0x19D3F3635CB0F, 0x4B6EF29310A74, 0x6E563862518D8, 0x75C2DBAC9B05D, 0x33D020AE92867, 0x30E1F5C6418D9, 0x5DB5423BC8E1D, 0x00494D8CAD771, 0x0001C3970BFC5 },
+    { 0x73A46218D1006, 0x6E58BD4114961, 0x7602FB13EBE35, 0x26079226D6A4A, 0x2B2F60255906F, 0x38729EE8C67A1, 0x71082530D47F3, 0x448DF2D3E11CF, 0x172FD2AFEFB4B, 0x73BA8328C7B8E, 0x1538ED374DE29, 0x4EFF7DA9E4B68, 0x24B6AC9F23268, 0x771C7FF31D9D9, 0x0002806CAF4D4 },
+    { 0x53E008146A3AD, 0x6FB5EA60E2EC5, 0x574C91393AECD, 0x6F9D349ACD119, 0x1655B74121E64, 0x41A5A44D53EBC, 0x0CBD46811C17E, 0x77D3890F71D7B, 0x147902123B784, 0x76114E0F7387F, 0x000C97C9DAB9D, 0x533967E1E9D72, 0x24FAB1B9F6FD5, 0x2565DD93AEFA0, 0x000525CCBE1C2 } },
+  { { 0x6FB84A1F730EE, 0x28B6AD2088C4D, 0x5B06E32ADAE2C, 0x04B833E1E7A9C, 0x251726F2C210B, 0x2D7D619B812CE, 0x3316788152AF8, 0x35BA9213C815C, 0x171B86EB3F1CE, 0x6FA170F45D500, 0x5345945257A8C, 0x7C3FB660A80FC, 0x09C66FD9D634F, 0x1749CDE85CC71, 0x0003DC6071E4C },
+    { 0x08CEAE8FFE8ED, 0x3227A2B49DEF4, 0x25253272CDD49, 0x57EED91BE55A3, 0x2522C296643F1, 0x734EFB330A639, 0x1794F28B1EC6F, 0x5E0B6499ED0ED, 0x64D64B306D42D, 0x52CAF57F8BA3F, 0x5037BCF1340E5, 0x186B4395DD6E0, 0x5243317D85B59, 0x54DE820E8C0A1, 0x000253DE89D1F },
+    { 0x601DB2F035B5C, 0x2519A0F20668C, 0x6AB90CBF69701, 0x17BF178FDDA67, 0x35E30B82B5B14, 0x328D7477305DC, 0x697D25E7C4D7E, 0x2F0DF45FFA9B7, 0x50B1361888063, 0x75DA7D4E20D4E, 0x2587F6D458EA1, 0x43089163C61A9, 0x7A1DB009C0544, 0x05676BBD3CCE4, 0x0003B651D8E88 },
+    { 0x71855F1CFD7C1, 0x20793FA1E68B8, 0x78C3AFE43D63E, 0x444B1BDDF2337, 0x0F89D864F75E3, 0x6AA21E42573FE, 0x20D54F59974D8, 0x4B8B42FBDD7EE, 0x625F294277B41, 0x35B7C250D149D, 0x61BAA527AC6EE, 0x7C073616767E6, 0x37F91184F3194, 0x11E839A673632, 0x00037AC758FAC } },
+  { { 0x14F3B7CBFE6F6, 0x59BCE1861A0F2, 0x206F464366A66, 0x111DDE62C65C8, 0x67D031A45D13A, 0x02BA2B48B954B, 0x2226730B8B95B, 0x118D3BCE5BE7D, 0x092F8AEB23331, 0x66F0B8D3BB060, 0x70178ADDF1E3D, 0x530781CF1C75B, 0x3B6F210957FC2, 0x1727A8C8A7D69, 0x0004248F63BD7 },
+    { 0x20F23F5A9C814, 0x734B99F1E5221, 0x56ACFC38B8DAD, 0x12F8D3FB6938B, 0x47E79574C3CBC, 0x01A67BCB7E77E, 0x59736453AFAA2, 0x0A34E71BEDD94, 0x1B18FFF61630C, 0x676F31840985B, 0x7832F2FEC7587, 0x7B28A79B1AF70, 0x26088A4D90076, 0x2F8D488399B57, 0x0001D8A8D145F },
+    { 0x2BCEEC6AB3F88, 0x4776C0477B2BB, 0x7F0043DA2274F, 0x4930F580F0EC5, 0x354DC080E3845, 0x34B67B0930224, 0x07EC5C12D2232, 0x0019C87CD4476, 0x587D7B0E1C4C6, 0x6282C39C5D2E6, 0x70EB15850CAC2, 0x6C55287B4AE2F, 0x3528CA67B336E, 0x4A990B06327CB, 0x000655C32AA06 },
+    { 0x6D8B34D9E5010, 0x207AE814B9030, 0x684E1E727945C, 0x643818D5E81CC, 0x369A38639E92F, 0x53E37CA5EFA48, 0x0C6F05808F9AB, 0x42F9D50476B42, 0x6E7EEE69E6E4E, 0x059F31C6B8D49, 0x2C77670D5C798, 0x49531B66C323D, 0x1F79305C2E9D5, 0x4C218D09B81B2, 0x0004AD496DC6B } },
+  { { 0x1DB38D8DF729D, 0x0A205A7459FC0, 0x1D0FC413AE321, 0x07193BC3A6557, 0x127DE203A68E4, 0x0C1ACBB3619A9, 0x1CC071FC613A7, 0x1321A1E0CA8B4, 0x2E234DB56CBD1, 0x708FDA0FBF790, 0x69B4E4C2554E3, 0x655678A6DFCD9, 0x081FE9D4D55C0, 0x5A4FF6C3C28C7, 0x0003A2E2FD98B },
+    { 0x4727BA70779D2, 0x30ABA6E5C0F10, 0x36DA69B5CC963, 0x4FC33723131EA, 0x42CD1A304AD5D, 0x10677EA75997C, 0x4CD1A814741CF, 0x534159D1FD097, 0x03F09EF7D9CE2, 0x0206C2F4FF3CD, 0x241D6BDFDE8FE, 0x277F2FD8D4964, 0x5051DDF2C8864, 0x1DA61D38710E7, 0x0000CDC9B8E8C },
+    { 0x1C9065ACD6833, 0x0B99B9AC203C6, 0x612FFAA232FE7, 0x11B240143C467, 0x542A704367009, 0x120FDCA95F91D, 0x6822B95BFD7C3, 0x3919DC56BFA08, 0x152E7DD6A9838, 0x6C03F4A0F19BC, 0x6975CF6C7EE4C, 0x4B3120F46811F, 0x18C742BC961CA, 0x3FCA1F70FC5B6, 0x000642F74FAE3 },
+    { 0x52CB3A6F76518, 0x783B855D98A51, 0x1020CF2DD8105, 0x6C8F7A5DAE44C, 0x194802A15F643, 0x3AA7BA92096D3, 0x13C9E6E845211, 0x18E663E7B2F1E, 0x0116EB2A01C1E, 0x4FD0C8EF76DE3, 0x5052661BC2B6F, 0x08807D77C5355, 0x72EAE9E7E4DC4, 0x70EF2CE085267, 0x00037AB9A6BE5 } },
+  { { 0x3E2EC6EDF73CA, 0x043C93FE2B30A, 0x16AFA0B30D8DA, 0x79EF36A23921E, 0x3E2FC699E3027, 0x0BDF678B15455, 0x5702C1A3DBEDB, 0x60200FA0D996B, 0x62378DFD409B6, 0x7057A77E75C11, 0x12E1FCE94159D, 0x7FFB6E2C43F4D, 0x43048C03A6767, 0x3F20E74285ED4, 0x0004BFAC28267 },
+    { 0x2FA05ACDD3BF6, 0x669B13D46463A, 0x487572AF7A60B, 0x34C3FC4AE85A3, 0x2D496620DECF7, 0x3648E807B2D62, 0x36CAC5E2C4CD8, 0x641A7F8E9B4FC, 0x09E0AE6FE89F5, 0x2757A2C6C8DB6, 0x715ED57486ED2, 0x7EB8CD4CACA8D, 0x2CB2BD47EF071, 0x4DBAD27F6FCFF, 0x00010F253EB08 },
+    { 0x1A91BE8BFBA6C, 0x7877E1B81F37B, 0x36D5B0712AD54, 0x5753DCFE1B6DD, 0x4B3E32D26D1D8, 0x59AC35F703BA0, 0x49964C73F8E87, 0x3EEC93DA583E8, 0x4B29FC6163B48, 0x1F13686CD01E1, 0x489E960BA21CB, 0x47A4ED28D8A60, 0x1EC1BF06DD85C, 0x0440D3248CD16, 0x000284E746FE8 },
+    { 0x45B1147A6768E, 0x3BF90D52D0035, 0x6477F01B08A56, 0x36D80FFD46EC5, 0x39C9B3AC227F3, 0x50D4CBD7582E4, 0x4B420658088D8, 0x7B133E117979C, 0x2470EEB97E416, 0x6B6F09E842D63, 0x48A332B9FF7A5, 0x68ABF8D1DF6DA, 0x71E37E4B1D184, 0x46498A8E613EA, 0x0003A451BF592 } },
+  { { 0x637C9E958B9AC, 0x2150781C30260, 0x4187B9FBF7FCC, 0x0A963BBCBD9BF, 0x5C0A3FBC438D5, 0x55911DF89AE5B, 0x58110EC2436F6, 0x4BFD1631138FE, 0x4A1DF1B56C3F1, 0x7EBA9E309C3D9, 0x482C48FC3F614, 0x5C587A506CF51, 0x5A3F722BF5865, 0x62EF4BFB13F60, 0x00009CA004964 },
+    { 0x4253DE6795E62, 0x6BFC18D02EB57, 0x3ADCEAD4D1FE2, 0x6771E0FA4B019, 0x15A9C762C75C5, 0x3767D16A897B8, 0x3014D7428288D, 0x03B98F15CF15D, 0x18447EDD9C5BE, 0x04B3470B93FCB, 0x56FD3737D75B7, 0x53D9990F4E9DD, 0x5ABAE3E3BF63C, 0x4D2C74B00F20A, 0x000346D1098EB },
+    { 0x05895FA02EF9A, 0x6A846ED46574F, 0x7F93C0AD5EFAF, 0x43BA97F219E6B, 0x4E17AB4FE6367, 0x11380B500DCB0, 0x0A8AFCCC94642, 0x2013A197A1653, 0x4679F2CF13069, 0x37530320A9025, 0x7FB95233AD863, 0x783CECA8C8B0E, 0x56A9C99851149, 0x12CF3ACDC64C4, 0x0003F4EE83B27 },
+    { 0x7D58FDA9B53A8, 0x1F43012E89D25, 0x031AB94E9D19E, 0x65EC83B70C0BC, 0x749776D57E369, 0x5C3CC1A0477DF, 0x7FDEE80D4419B, 0x6393E344AE1F6, 0x1419AA256FA41, 0x11E375403DE6D, 0x67CE5229959A5, 0x3997AE03EDCD1, 0x796B109364D71, 0x2E8C0A35886A1, 0x000367C5756E4 } },
+  { { 0x5F43525EA8CD8, 0x6047E1000B0D0, 0x4AFBF6F0B829F, 0x117CE96C742A0, 0x6CF532D54DF34, 0x10A7256011FF7, 0x497681573E6A3, 0x685BE586D11D4, 0x7F448E9746BAF, 0x201EBF134A9E6, 0x5041960628AEE, 0x0BA93613A1794, 0x4D3CCDF3F6C87, 0x04DA3DA30143A, 0x0003D79AEB8B7 },
+    { 0x2149632356D46, 0x66C68F4101DF6, 0x2FA481AA740B3, 0x4AC2907C30EFC, 0x1D6212765D341, 0x0D30A278E2592, 0x036812C1CDF18, 0x70352D29422B5, 0x7B7C09E93851F, 0x27C00F9652822, 0x18951527A0577, 0x3A34FDC5AB2F3, 0x7EF8344BFFDE0, 0x4E9B7B3083818, 0x0002EB9697587 },
+    { 0x62566253BFE26, 0x718883E5B8224, 0x2A5CD9805A753, 0x095721FCD0404, 0x176E6810F1D8C, 0x161723DCBAAE4, 0x02ADF3ADDAF82, 0x5C2CFDAE6CB87, 0x1C02815389F1A, 0x1CDD76E92605B, 0x3DEBE6AEA36A7, 0x75A68C921DC90, 0x5F8DCD46FD29E, 0x19DE32CD56C29, 0x0003D821802E7 },
+    { 0x515D22A0C803C, 0x1B64C11BDCE42, 0x66BB844F1B627, 0x464ED085182B4, 0x0B8FFB0CBEA48, 0x376A9FD1C50BC, 0x09295A95E6254, 0x3FDB1D299DC80, 0x2911BD30B538F, 0x6325D8E907CBE, 0x4A5051036C5B8, 0x7E6C36466003A, 0x02BC1DBA35194, 0x42E9063E2C407, 0x0002FDDB472CD } },
+  { { 0x4D0447DFAC80D, 0x26752B842BF4C, 0x10BC437294E3A, 0x1DBAB0727FA43, 0x009D8440C143F, 0x164EAC478A0FC, 0x0EF8CF597D103, 0x62EE74A219914, 0x18522044167DB, 0x3B54B21FD70AF, 0x571E164EE40DF, 0x42F22A0C5B243, 0x2DB30A5B9EAC1, 0x512BB7BF8284E, 0x0005F96471E0D },
+    { 0x74FD95118B3E8, 0x112176C013FD8, 0x02FD54FF0F81C, 0x7BB36639CB85E, 0x73208C6D2B8F6, 0x7ED8083456BB7, 0x0695781441371, 0x7D5B7BB4BACA7, 0x0EA43ABA47C4B, 0x1EEEEF3CD5527, 0x358C0438724DE, 0x51C0EB8AEA33D, 0x18EF4B166E355, 0x2A334588838D2, 0x0002CC4B85FBD },
+    { 0x2BD7227C1ACDB, 0x0155025F89656, 0x342969C425D56, 0x2D1011E06673F, 0x103E865F074B2, 0x608FFBDD9E295, 0x03266367C1BAC, 0x75A5642DC983D, 0x783F466522F85, 0x433458CCC2222, 0x5A1A81135B699, 0x0B19F17096313, 0x0B5A229E27E7B, 0x687164DFEB615, 0x00048242E99B5 },
+    { 0x0B40CEF93FEAA, 0x4AB64FD830D15, 0x5CAE545404A8C, 0x7D51E7AA36EEE, 0x03E94D10F289F, 0x69B4DB00A9134, 0x54D843551D8BC, 0x3FF4694FB6531, 0x462DBA87DE691, 0x48D9D8652E34A, 0x53A5931EBDCA6, 0x10D7570748E25, 0x0BD69B1F91D5D, 0x1349F3F1DCACD, 0x0003938EC7DF5 } },
+  { { 0x3739B0A4231E3, 0x18B859F8C83AB, 0x57A20FD580340, 0x2E61389DBA9A5, 0x68F05FF49F747, 0x23C7373B51581, 0x0C83CB7FEB0EE, 0x74F5064B1844A, 0x62FEE18FC7E24, 0x533CE46C752AC, 0x64F75011C43AA, 0x1787271DC2117, 0x4AF3C35397340, 0x0B7A7BAC36B23, 0x00042B14CA97F },
+    { 0x40D9F7FF9E9A2, 0x2D1AF0388F918, 0x012D5C34A1C3C, 0x281E08FDF90E7, 0x5772A7810A0CD, 0x771C173CF043D, 0x75DA0A5645282, 0x305468872244A, 0x22E2FE698C506, 0x1BC89943C9ABA, 0x68D2CBFB1F5D8, 0x3178ADA302E94, 0x30D5688610185, 0x44305B3AA7641, 0x0002434318115 },
+    { 0x049B4F6A26027, 0x1C3FE4D2A9BAD, 0x31BBDA63776A2, 0x75A19EBBB78AB, 0x5A900F8F28787, 0x122C82E00717B, 0x31EA719E4FDB5, 0x3B52145F86DA4, 0x408C2924F6B80, 0x7308A457507CC, 0x583A81BDC312C, 0x08AEDF7B2EB1C, 0x0801D4EBA3795, 0x494B70B091158, 0x000430FC52D05 },
+    { 0x1E5EB1FCCB66C, 0x1C442878A4B57, 0x61FD063A4747B, 0x3D826AC6D8E17, 0x3A05E29AF1499, 0x158D1852C15C5, 0x07050CD6715CD, 0x0C9487C728E2B, 0x727FDCE96218A, 0x66639BE05897C, 0x46AD24EC562CE, 0x2813CBFE317B9, 0x73CF1C082B12F, 0x46C26F5FEA362, 0x0003E5C4BF92F } },
+  { { 0x62D4E4B5563F7, 0x18A4D980D2F5C, 0x158807F2DC4DD, 0x40E9A31FC51E0, 0x4D251F208B2CE, 0x73985D07BCF15, 0x4BF46FDD37BC5, 0x6E18A4F73D9BC, 0x6599DD82A9E8A, 0x7F31D91D77641, 0x3C9B73BE45820, 0x5FE2F5A6CE5AB, 0x127F4D877698B, 0x2A5AB7619633E, 0x0004226D602D0 },
+    { 0x6A60B450BEC0B, 0x2D2E70C44F4B4, 0x7DF828BB4B685, 0x1C8A06EAF46EB, 0x3580F1449F9B5, 0x0A3F6538402EA, 0x7549E077DCBCD, 0x760C4E0E6573D, 0x5B5EF94870475, 0x470408AA0F538, 0x170FED84B069A, 0x6AA276B8CB56C, 0x22E17C0A68BC1, 0x06940F7D4D235, 0x0002C45FDAB8A },
+    { 0x455DE645089D5, 0x6C17950EC7474, 0x5454CAE4D5091, 0x6A520A491FDD8, 0x19223DA2A0DBB, 0x3149AA71FFCC6, 0x3A21A21D12126, 0x4EF02852E3F60, 0x66B3A75064CD9, 0x66F960B064B3F, 0x1AFE71F2CB761, 0x314DD7B09EE87, 0x54B63C8D5435F, 0x5924F5C39A1F8, 0x0002ED6949B05 },
+    { 0x3DE27A6A1ED57, 0x7ADD2BACB8468, 0x470B9EAFF3C88, 0x6E5458D38FCB5, 0x67CE527DAF556, 0x7791C6CB095B4, 0x3057A2EEC65FF, 0x1FABE8A89EA8F, 0x57A3040D5E68B, 0x211AA9579CDF8, 0x49A613C908454, 0x11EC6EC598BAC, 0x712C36969506E, 0x4B386C3E8A3F4, 0x0003DDF989C97 } },
+  { { 0x3C9C4F12B0ACB, 0x641B514B5A830, 0x7B8279F4F5868, 0x577DF7AAA2EFF, 0x05D0EF26914B9, 0x45195C5BFFAE7, 0x7D574B9218014, 0x7D8B24A5C74E0, 0x4CE7AEC1528DE, 0x58D2C4647C3F1, 0x364DF4B351DEF, 0x4C201F739F5A3, 0x533C682A485E1, 0x69843528D71D9, 0x00049F4B81B26 },
+    { 0x22EE892DE38D9, 0x32F0F3F7CA8C8, 0x6A4B1FB00AC29, 0x41F152C275895, 0x4E0452BCE56E4, 0x69C07496B50D9, 0x5A282EDB5CFD9, 0x4C1F6070C10E7, 0x165F064A97F35, 0x3B3A4B4B327C3, 0x6757A89AE4C8C, 0x306B0CB4EBBC6, 0x1915539A8126B, 0x78AEE656833F8, 0x000176AEBCC34 },
+    { 0x0C7779F51B13F, 0x0F2F70FF01BF2, 0x1AD78A9E1FAF1, 0x1307EB743FCD7, 0x6A2DC0057504D, 0x4DB4D9815FB60, 0x62FD632F97950, 0x7752EF983EE9F, 0x7F16E134BACC2, 0x01849A4AE609B, 0x61296E99740BE, 0x2CBBD090941E2, 0x1014FF50FBF2F, 0x33B27DE444D2B, 0x0003270630A0D },
+    { 0x6BBF0EE5290BB, 0x1CA67851616C4, 0x749995C629981, 0x6655621DC9384, 0x1890C2C238511, 0x27A4C2D2F3F43, 0x460888371477D, 0x30C2EF1C41E14, 0x3549D51ADE1B0, 0x6D6250CA6ACA3, 0x184DE296B59EA, 0x31EEB5D0154A5, 0x3F556680046BB, 0x341B63AD1B3E9, 0x00043DF49D372 } },
+  { { 0x3FF686BADEFBB, 0x65C7C4D7D537D, 0x113F60EC38A0F, 0x5E6826E0D3823, 0x427638E594938, 0x26B1921FFB13F, 0x04A3B935DA8B9, 0x39F6A4C0DBDBC, 0x2978A050D2388, 0x721B9F12806B4, 0x4562A734A4B49, 0x07AF9C564ADE7, 0x5E45B5E5EE386, 0x6C54970231A54, 0x0003741FE6027 },
+    { 0x5E8BE59411649, 0x1274019A7DB11, 0x0227027C87E05, 0x5A8309C414BAD, 0x4B961E933849E, 0x3331F7179B5A6, 0x2636EA974D048, 0x7B23076C7418C, 0x03613D93C1E86, 0x601C07953663A, 0x4ECB2DFBCDB66, 0x4B1EFE08F8A91, 0x72643F9CCB1E0, 0x7A9DA796D7A35, 0x0002FB08FD185 },
+    { 0x59F3703BEFF81, 0x0022B0044CC70, 0x0CEA0825DB282, 0x580510D0237FD, 0x66A4AA140BE31, 0x687A23D25743C, 0x4CB4DC2D432BB, 0x0ADB3E4E06293, 0x492D85C30B37B, 0x2F74A82206B22, 0x1A283AD08F42B, 0x35818BEB1712C, 0x129843C9A1204, 0x54018495C73D6, 0x00055F2FF2A05 },
+    { 0x589BE39B623C5, 0x317604E5791BF, 0x597DF1D3225EF, 0x5CE927B2AC2C2, 0x572A62FC5DCB1, 0x0B9E7C23A78B5, 0x33ADCB904E69B, 0x00E9E7F55CC8F, 0x41F4AADF01C7C, 0x34FA49867BF3A, 0x2DF56908DB641, 0x2E3E9DE2E7DD4, 0x0B84D5558E204, 0x7C1BD0BDB2357, 0x0003A7D9B7013 } },
+  { { 0x1B1B1115C8BBD, 0x19AE0C2B8D670, 0x3828DBBC30D00, 0x3F9D6924C208F, 0x5706EB575D544, 0x2463B53177AF7, 0x4CCFEDD68DADA, 0x23EB593AF6344, 0x39BDFB1D0FECB, 0x7AEBC05E58FDA, 0x2348F078A4159, 0x1F13921D2A7E7, 0x17A2451AA4EAB, 0x6A93AC39C123C, 0x0000FC684E0A6 },
+    { 0x56BD3F18B0006, 0x05ED6DD87F466, 0x48BEECC7BFD04, 0x33C3A9A8102BD, 0x1F2AD863844FC, 0x26D76659897A4, 0x0A44BE8F9F890, 0x18DF2349B8316, 0x4A1B13465E0E5, 0x167F6C137CE65, 0x4641937602FD9, 0x6D5F6867490DB, 0x270B302674FD2, 0x6B1E25AA8B6D9, 0x0002E53798DAE },
+    { 0x0041D9E6C4883, 0x2A347E8E289DB, 0x5D4CB77DE4780, 0x52EB2A2D9316E, 0x4A16DF562D438, 0x4495AE7D32659, 0x3D62599C1DF6D, 0x2B2F043299D93, 0x5AF791972CFD3, 0x3FB6A8944C583, 0x5B318172365E7, 0x1C0C829DDBD1E, 0x470B3C983565D, 0x2B70FAF469A4A, 0x00039FD616828 },
+    { 0x0CFF1650D06F0, 0x595533C4620A5, 0x00A52D2F09DFF, 0x441ACB5826E51, 0x65D93D0BDB465, 0x72497A47E3BC3, 0x54FDADF17DE77, 0x0B2D3DA88CF6B, 0x312A8F7C13158, 0x53DEDDCE54AB9, 0x577225CEC73F5, 0x4B2AC2C1E1E50, 0x639D96873E7BB, 0x461E1D660215C, 0x0003B6B2BF12A } },
+  { { 0x096E5D9524737, 0x1A2F4261CA869, 0x28C4B24C2A61F, 0x2A5F88F236EAC, 0x46CDC0B015078, 0x15EDB276CE21A, 0x2292815268705, 0x75CD065019FA3, 0x1D2A40BD02FF5, 0x024E8A41CDAF4, 0x2A214BBEE13A8, 0x179D0796EE84B, 0x50F2A32D1FB83, 0x7B098D18A36EB, 0x000419DD3FAAA },
+    { 0x29BEC575700DC, 0x650DC9D4ED574, 0x709205F6E3A97, 0x45C8249227B4B, 0x56DF6D5727B15, 0x37C0EC9FCF9AE, 0x30F5E53922DAF, 0x0DD0972684AA1, 0x12B607461B9E9, 0x6DC1F2059DAC2, 0x334591346E14D, 0x0BB9A39C6B317, 0x51992907DB01C, 0x4084ED53CD3F1, 0x00010A8DEB149 },
+    { 0x10860B95649F1, 0x71246C7ADEB3C, 0x3F75BE705D318, 0x4286942F2C140, 0x267E27A5112D4, 0x1022390921315, 0x0E1542B4A21AA, 0x0158E0661D8D4, 0x0D4E48377CB0E, 0x5339F28EE0641, 0x1346E0BF1487F, 0x4062815B913CC, 0x46D2BE3B54B1E, 0x248F768E1962A, 0x000459CB98E52 },
+    { 0x496C46DFE0C6A, 0x05D60015230F6, 0x7592AED1B5011, 0x78B2037A7284E, 0x5EF29EAAE1210, 0x1A9F267F14028, 0x559DC86F0CE89, 0x3C0699549E1FE, 0x60B99815797C2, 0x2213BAF42AD3B, 0x76918AE02EA33, 0x1541AF9833B0C, 0x32C502298FDCE, 0x6C1BB3002FEFA, 0x0003E287CB001 } },
+  { { 0x160277B7253BC, 0x42BAA7F63A06E, 0x6295A61AFA0BA, 0x5B81410509A83, 0x76FA28E4EF7E6, 0x697330ADFA627, 0x0CC18102CABC2, 0x063A159A38F01, 0x0341B899A3D1D, 0x73E7F79963B67, 0x28F39F0646A4A, 0x5D78B9CB4DBFB, 0x56C306A9189A4, 0x0F1974E817308, 0x00044806A15CC },
+    { 0x17162384A5F9D, 0x3F3D9F5D8A918, 0x5DFEF59E49711, 0x6F1EC411768A8, 0x7C0D2BFA0B099, 0x7D3D2C1773253, 0x167B848CABA27, 0x1D71B875B2B35, 0x7C57A2906A208, 0x3E9C030F44745, 0x2DDA4279974B6, 0x7F7073A93FDC8, 0x43D48145BA253, 0x02ACCB15A4A38, 0x00016E386FFBC },
+    { 0x6805990AA3A50, 0x0159DCC1D0448, 0x400BA8106A354, 0x0749E8DD5B81D, 0x620663E28B437, 0x053568A638D56, 0x0C3D613BE2E15, 0x49845ED89B34D, 0x2460FEBDFFDBE, 0x7F35D24F74401, 0x1F326F1CB6176, 0x361DE3BD17FD7, 0x3474C25A4C421, 0x4F8166D993BAD, 0x0003503C8C18C },
+    { 0x53F760FC47049, 0x4922B7E426155, 0x0FD52BBF7F4F8, 0x63180A48AEC8E, 0x138A28563989B, 0x142A6035B5F00, 0x1E3634C27542B, 0x12A2BE2265671, 0x1D7351AA6E99F, 0x7934A83B770E4, 0x59DB1EFBDA73D, 0x5F66DB73441DE, 0x19BC667CA2353, 0x11020ABE2E760, 0x000343E133E93 } },
+  { { 0x3775B7EB0A43E, 0x41C174DA64B48, 0x60F112C6127A0, 0x32356ED14592C, 0x18B475DDD9397, 0x475D17F3A917B, 0x0C975F1B01732, 0x1831D0AE6B32C, 0x196092F7C7C97, 0x1F8006B658937, 0x00837D601F775, 0x488FF8C96F0ED, 0x3EC2FD85AF262, 0x78DF54A34814B, 0x00023A5983A89 },
+    { 0x193FD14E15884, 0x6330513D90EFE, 0x3AF89B4C298A1, 0x5CBDF023B0148, 0x1BE590A14FEA9, 0x42C0E015940B5, 0x1249F855BBC4E, 0x405F1BCDF7E96, 0x6D25CC62E4401, 0x1123A4B342356, 0x70C7FC239A41E, 0x6B49F6D211B50, 0x59968C175F1A5, 0x473EF7AFAE5CC, 0x0001D600C72FE },
+    { 0x474C92CDC17A4, 0x21CCCD11A7460, 0x70A1C81CFD8B4, 0x63314969979A2, 0x7DBD00CE9A6A5, 0x1C1F41DDED5AB, 0x6006323F10137, 0x4CCA5A4C1E3AA, 0x3EB61D43141E4, 0x54DF7867AE942, 0x3EC8569D654CB, 0x25F1B586005F4, 0x4AC58779D0726, 0x5F904581CE6AC, 0x000487D67B349 },
+    { 0x648CF4AA0FDE4, 0x318F2B2B54D01, 0x765123A438292, 0x3356EB7E67FC6, 0x0F242D6C6D7FB, 0x0CFF66FCC4FDF, 0x02D2DB60B5E6B, 0x3C89F2636D4F3, 0x3EE057E4D80B0, 0x30DC748B00668, 0x3734CA6EA0D77, 0x7B74F494249DE, 0x1D7E8C9F9FC0F, 0x60ED702FFFAC6, 0x00045A76DFA20 } },
+  { { 0x2F19EFF35B8D8, 0x5FC84DF15BC84, 0x2CD2A9CEA65AF, 0x7BABF51C8357F, 0x1AF52472C96D2, 0x1D66851902B44, 0x0B024BA87679D, 0x278173AE70144, 0x7C7F776CD7A12, 0x3A96618C36034, 0x231F3A381C49E, 0x4F9A14EACBCE7, 0x12314541E4BD2, 0x55507B78D321D, 0x000332FCF9039 },
+    { 0x4C2EF79D75181, 0x11B278D49F8BE, 0x0069DEBEA24B0, 0x3DE7A176EE4C3, 0x7581449352E30, 0x0E4BC81EA97E6, 0x6C9F0DAAE1EC9, 0x1C4DB49733ECE, 0x307328D6B2CF3, 0x6263A8AA4A54B, 0x104288A384408, 0x56618D9B0A5C7, 0x076B9DB3E56DC, 0x690B40069032E, 0x0001247B1263E },
+    { 0x4BCD301C1134C, 0x4B260E332AE96, 0x5E59EA229BD67, 0x3763049CBD91D, 0x3D2C3BF45D8C6, 0x4AF44EB7A87CB, 0x196809E0BE6C6, 0x706B8EB63EA80, 0x73D0DE0929251, 0x513B0F11AEDA3, 0x1F29B7E096AD8, 0x05600397A2A10, 0x608FA778E9CB9, 0x4DC5EE975D528, 0x00068FD18D39E },
+    { 0x07B18F1882DEB, 0x01C95D9EE632C, 0x77424AA2B017E, 0x417D3E15A02F8, 0x6BA4E32C8DD9C, 0x64294CD131EA8, 0x6B54777FA1384, 0x0E370B08585A0, 0x1372A02C74FE7, 0x335ADFBC76666, 0x50925FBA4123C, 0x30AC399601A80, 0x50323D1936285, 0x36009A4E4BAA8, 0x000322936A07B } },
+  { { 0x48BE49C3EDFE7, 0x06820384F3F16, 0x5ADE495F7BD41, 0x2BD0E47680D35, 0x4EC16853B6A11, 0x64EE1E57C199E, 0x577085286A01A, 0x0F06606392703, 0x042FEC17730F7, 0x2E502A3015DF7, 0x3C6177B1A5F93, 0x0CE5F70D765E1, 0x4FD62957CF485, 0x7B380A65C653C, 0x0006167D6026E },
+    { 0x202D724915A6B, 0x10AD67C276F5D, 0x4D209E256E2DA, 0x478ADA6CC6783, 0x0D50896290D29, 0x7CA4DAD6E9CBE, 0x104A7C9EFADBE, 0x1A18450A740A9, 0x54F8C001732B8, 0x3984E8EAD870B, 0x548500FB6CE9E, 0x5CEB3C53DB662, 0x70955C49C9199, 0x43099349B07BA, 0x0000513F06A40 },
+    { 0x048B0D5FB5EDD, 0x3F2B76B51887F, 0x284D2ABDB92BD, 0x267DF0A5237DB, 0x1FC05B8B500A1, 0x6CE127F1D8FBE, 0x7F3DD6264ABF6, 0x6879E6948A20F, 0x2B6BB6B96C2AB, 0x243ADD6E68C4B, 0x3C37912F483BB, 0x57633D52A3204, 0x3D4526C42CAE7, 0x2386A3845A44C, 0x00033BC223DDE },
+    { 0x23265909FFE61, 0x57A20A5C910E1, 0x227A675B4E91F, 0x7831D9D539486, 0x4898340C01EA8, 0x692FF2208A6E5, 0x4875FAB31D921, 0x484365E56720D, 0x421E40D26C5A9, 0x6BEA963D4CD4D, 0x59E1E18067C0D, 0x138CAB395B423, 0x7508D5E2EDD69, 0x7A7A7A05FBC52, 0x0003AF53CC3D3 } },
+  { { 0x07ADD62364122, 0x2EB8060EDE394, 0x13122AF5BA9E3, 0x261AC1E41E466, 0x6660A2EE1089F, 0x38C56F7E7137E, 0x0A166013BA11D, 0x59D90795E16A7, 0x1A5A1021C298F, 0x3FCEEE5182E44, 0x537B8F0BF0303, 0x4AEA544197A43, 0x283171335FF07, 0x5C10A2C66F93A, 0x00065856EAF19 },
+    { 0x6DCE34D1FA708, 0x46806F1F14AB5, 0x12CF5BA74D948, 0x3FA00039EBCA8, 0x090055AC00640, 0x18C74490642AB, 0x15C76E0F9D91A, 0x7C3828C13988D, 0x2EC27827DA194, 0x331FEBB7EDDDF, 0x63BE2777A6639, 0x4EAB93552D2CB, 0x2FF32DEC338AA, 0x03F42B514467A, 0x000224075688F },
+    { 0x70094807351D0, 0x399115C6D403F, 0x607F7052D1514, 0x23AECC211D7AB, 0x4BDDF8AF81C7F, 0x19B50D8343F0B, 0x075B7A1F82E66, 0x6394437EB265F, 0x4C2E048F26A91, 0x333A246140CBE, 0x097A43A01C169, 0x4972F49AE3185, 0x3C3B780D135DC, 0x1C8E73305E690, 0x00034107AE32E },
+    { 0x1B3C5C4E4BF5E, 0x26BA39FF3CBAF, 0x7641C9B46E5AC, 0x088C913A69339, 0x704C9F917A5D3, 0x0ECA59E686F5E, 0x63510D878CA1A, 0x7D371897F8B50, 0x2A496D025EC01, 0x0B33BDA5DC8F7, 0x50A374240AD83, 0x68D1D1D671F2A, 0x251D7DA4B2623, 0x62323B12124AF, 0x0003FFC2AFD18 } },
+  { { 0x13D8F0517A918, 0x209292C3D396B, 0x434C0368D2F77, 0x28C4625433AC4, 0x010ACBFD983E6, 0x16B528E3EE37C, 0x0E853F0B5845C, 0x10C2354399EDB, 0x4D901013FBE05, 0x162FCDFA2B6EE, 0x4F99A7215BB7B, 0x57BCCC780154A, 0x6AB3F102A5966, 0x3CD32B1ECFBD2, 0x0004D3C9CE8B1 },
+    { 0x5B02DF2F016DD, 0x7F2C4A98B3DC8, 0x6A8D98CBBB0AF, 0x43DAA1B63B92C, 0x63014209752CB, 0x27444C412C6B3, 0x0AE7A4AE1FF78, 0x4CE876DDC511C, 0x5E7AEC7E100F8, 0x5142F1DA1D89E, 0x25A2BCD46F62F, 0x2FE8A6DD9633C, 0x328C5B712730F, 0x6094A02D40D1A, 0x0001305F3A549 },
+    { 0x675A9DFC83E56, 0x6391F1E6EA2F1, 0x2CEF0B0D34C58, 0x3C900FF260FBE, 0x64E8C3069E574, 0x5EE774A383AC4, 0x63647F3CCCC81, 0x651C9D61D5113, 0x71637C273F52F, 0x59ECBD8F89F4A, 0x154187258CDB8, 0x09467CDE737D2, 0x2FC2BA48599F8, 0x51611F551DEB1, 0x00048F86E1318 },
+    { 0x5903E7E914979, 0x7908DB1D68403, 0x3339B0CFC85C0, 0x1AC81B8409025, 0x22C5866BCDAC4, 0x1F3EAA6E4A73A, 0x5405978708D2A, 0x6553F36F458A9, 0x1DEC70B796F71, 0x36BF0C4BF0331, 0x258BE8E5AF795, 0x2D45BD1FB7271, 0x7BFC1340A5848, 0x672E8382B878F, 0x0003D040744F3 } },
+  { { 0x3D1F155BEA5E5, 0x7452FDA614187, 0x215EF7B2CE617, 0x3ACB168706FBD, 0x66000B84EE232, 0x0CD9192183C47, 0x4CBEDFC57ACE2, 0x3E2EB0D3AF55D, 0x64C5BF6B9842D, 0x70190503D903E, 0x5F3677E719313, 0x6A75575EF678D, 0x35C2F4089F537, 0x4719A78F9C47E, 0x0003A5CF9D56B },
+    { 0x02514E915E7A8, 0x2A3AD1BE34D14, 0x66BB204EF44C2, 0x21073101E618D, 0x3F426B3B85606, 0x65F4428B17E2B, 0x6FB7673274DB7, 0x4E0B198BF4870, 0x45C6A92ECA844, 0x4F365EC24178A, 0x0F799DD4C5EBE, 0x35200B4FB9B61, 0x4788A7F6442D0, 0x3E0E89BB93C5C, 0x0002EB85DF91A },
+    { 0x71625C8BA30E5, 0x6520CC227C6C4, 0x0A970AEEBCBBA, 0x36DBE3BCB0083, 0x79AA848DBDEA6, 0x66F01DDE067DB, 0x56D6EA42DE61F, 0x15783DB90858B, 0x688DC47F60D1C, 0x43C6017A52450, 0x79A77CA015D64, 0x067502A410E6D, 0x6F612B0B1098F, 0x3113E66DB3D20, 0x00018CA0FF9D6 },
+    { 0x165223338E524, 0x49166202FB6B6, 0x21593F8B8487E, 0x00112BA18F10B, 0x769F0417FB22E, 0x1422503B58CE2, 0x1DC0CABEF5093, 0x1311F96E47028, 0x5F085772F6C37, 0x3E2C3955C46D5, 0x72206F3FC3CA3, 0x1CAF8993B92CF, 0x5A0782298D08C, 0x0F9967E963527, 0x0003784CF822A } },
+  { { 0x34324B4955E57, 0x745250C0DF201, 0x1856F364C6662, 0x41C812A73725F, 0x0C81B356D0B9A, 0x5558961839D31, 0x5DF38D69E9DA2, 0x247F244674D1F, 0x0BC860DD53598, 0x0580F785B9CF4, 0x7918EBF3551F3, 0x0C6E2D7280688, 0x58B1FE33BC6AF, 0x246E30513B29F, 0x00062500C5C2E },
+    { 0x02D4F30849F8E, 0x65738B97FDF34, 0x0C19EFBBA5CC4, 0x6A1EAFA05BA89, 0x05B3B6EE7C38E, 0x32FE72750F004, 0x49FC72BCAAF2B, 0x325650184843C, 0x27DE9523F35F1, 0x62DD1C7EECE19, 0x07960E71A8DAD, 0x43845FBE79378, 0x04A02C2E0EBF9, 0x1B8A6F0265A7A, 0x00021F645CE2B },
+    { 0x23D4FD1A8A435, 0x261CF6C2B1E44, 0x0C9CA04E2371C, 0x78E5D82FF448F, 0x5894D6BD0DA4E, 0x03AFED1550CCA, 0x289BD54C9E077, 0x63113DCAF3399, 0x50437C4D436CA, 0x50C11098A068A, 0x0C7EEF33638D7, 0x6600E74C226A5, 0x332ADE6718AAC, 0x253B20D7C602B, 0x00043C927BAB7 },
+    { 0x0409A7663A8A0, 0x028C6D7EFB515, 0x44027FC1737BE, 0x65713084A6537, 0x033BE5E819F59, 0x75EC143D55D6C, 0x6DD1119990D86, 0x6B1E04954831F, 0x3FA9D6E7BA760, 0x2E40A6955139A, 0x37E599F560C38, 0x63184911B5176, 0x11EA4486A8A6A, 0x56812A7F3D939, 0x00024DC7834D6 } },
+  { { 0x2836B957040CB, 0x6FE26C0191773, 0x0A2A60143C00C, 0x730870CCC64C0, 0x4B6F9C29693A8, 0x23BDA97A93F16, 0x7E0C4F77AC8EB, 0x60151DFD9A216, 0x40AAC806F8BFB, 0x4A88CDFE1950E, 0x75AD82254D5A4, 0x4016D16585D3F, 0x19CFEB3797372, 0x1CCA6914F792C, 0x00044251C7542 },
+    { 0x4C21D0CC8D5F6, 0x41F27996C6F75, 0x1E3E08CF0F587, 0x60250EDDB6E88, 0x0B65D63B38BF3, 0x3AB722D3B4198, 0x5F0D953B65926, 0x2AF59067D2EE1, 0x6C4763C7A1F75, 0x61BE33DAF8A46, 0x61D5489E0F952, 0x5625063380D0F, 0x2BA64ECB511ED, 0x028DA1B3A3BC2, 0x000124A73DE3D },
+    { 0x1694A72EC27E1, 0x6A22090B1CE98, 0x1E9C114AE49ED, 0x35F6FBB5D8FFD, 0x38BA5C9BC967A, 0x5CAD04E4E108E, 0x1F7BC6FA889DF, 0x7E2659B8B8F2E, 0x23E15D46789B0, 0x5BF9D7F812159, 0x7601E3621CD28, 0x1A4A2C1BD97BC, 0x7C221B6928319, 0x1F6B48B9E23ED, 0x00031B01FBF42 },
+    { 0x6A12CE4F14AEE, 0x7ADF770C78049, 0x3A10D01D0F884, 0x270C947B4D6BE, 0x485DCC5481244, 0x65895768235AF, 0x00F2DFC7F603F, 0x1082386263822, 0x77CCCDE6FEE5D, 0x59C41B25E7B64, 0x605A7EA3B9BC5, 0x7EF4BE4994F1F, 0x4680E0E4C218F, 0x6BC9DBEEA8698, 0x0002764A90671 } },
+  { { 0x2607195F96219, 0x59310DA9B7385, 0x188355F22D0B7, 0x18FFE6986C632, 0x1483BE80EBFBB, 0x21E81F62BEF44, 0x761FC0D374CBF, 0x4C1970B96E878, 0x7185E97CF9D71, 0x7132736099831, 0x54D0D34265811, 0x72BB230E64619, 0x46679820F2C0C, 0x4E22F1423A8DF, 0x0004B154ACCBF },
+    { 0x271C873DA2E94, 0x3D8497BF81421, 0x36AF4840365C1, 0x5F14667F54658, 0x4383ED4B64EC1, 0x6AA26BE5DC63A, 0x2AD8CEF1E4C8A, 0x7498608F39F02, 0x7E0353DD1620E, 0x6DFBD25312942, 0x0A240FB7D2169, 0x050D8377DF67D, 0x2E410B9EF7686, 0x2FB0B2DC45106, 0x0001465EC02D7 },
+    { 0x1040DF424781F, 0x2024A18423A8E, 0x7CA86281BFE12, 0x72B58962AFF6C, 0x79DFFA0886D4F, 0x3B2BE7345F63A, 0x1C1C40B3F9BEE, 0x0826754BB558A, 0x4F31B35AA07A5, 0x0F0ECB88E0CEC, 0x4DDE243FFCB04, 0x46AB6FD5EA0D9, 0x7DECA885FD672, 0x175852D19D070, 0x00021F2549E10 },
+    { 0x1D69A9B74BCD2, 0x652C453F8F579, 0x05FA0F20AAF65, 0x7E372598BACCC, 0x7F1CDFD150438, 0x410EE81C796F2, 0x2D534E1FE3319, 0x03FBDD2CDA392, 0x422DF3A7EF6D2, 0x7BEFEED807377, 0x568F49A4A66F0, 0x5EF394FBB74CF, 0x056BDBEAF2F59, 0x36A9940419863, 0x000259E8666B6 } },
+  { { 0x48E6A70A3C6A6, 0x5736CAC3F62D1, 0x584B25AA02ADC, 0x144377C248222, 0x0E44D5FB7BD0F, 0x01AE766531BE4, 0x1BAC715DF0F18, 0x507A0694E51A1, 0x060E19BAE19BB, 0x030D533E5A83F, 0x45CB5F5739B4F, 0x2A2C2233BAA9E, 0x18996A23787AE, 0x6A24424F060A4, 0x0003517155CB6 },
+    { 0x65E23EF598441, 0x0246D488FA5F5, 0x0ACAAF0DD4B68, 0x206164E6EDD65, 0x4B37DF47405FD, 0x3F0B1B42897F1, 0x76D6D29CBEEB9, 0x4DF4D33C1BE53, 0x2C6F0618B2226, 0x2A4FAA1C4A621, 0x0343C7154C927, 0x6B63C19D99B8F, 0x0C7FAAF82F7F9, 0x036B16B13625C, 0x000321120E559 },
+    { 0x2E5F43BC823BA, 0x546FB9249A796, 0x26EA97A43D634, 0x1E7E11FCB02D4, 0x3E004773A1718, 0x7BEB9E2C94D11, 0x0638C42A2CDE0, 0x4538FCF6E4FA6, 0x3620F4EDAF089, 0x7641580533368, 0x49EF64C4E3650, 0x09CB71427BF20, 0x4AC734342A969, 0x6D108DBB257E7, 0x0002FCD823A34 },
+    { 0x4FE5574A7AF81, 0x29501FBF3C8C6, 0x42A0D22CDD626, 0x285D63DF19AE0, 0x58A240D2CD0DC, 0x5AE9D4EA2F9D8, 0x36EA5E6225A91, 0x362EFEEC7938B, 0x1EE5D4C6D9521, 0x5049009AC6986, 0x4D427F4E74BE9, 0x37D49A36AB4DC, 0x31B3688B0431A, 0x3EC3271233F0E, 0x0003C858EC304 } },
+  { { 0x02DCFA9932A41, 0x2DC4DC537CDD1, 0x74C27A0C04E24, 0x7F907F48EB0E7, 0x1A6AD154FF38D, 0x200D1A6482FA3, 0x19014A8E864E0, 0x7EB808B42F202, 0x4BD4F786D97C6, 0x65A08B7605E83, 0x72BAC37240DEA, 0x3403A8A3FB4AC, 0x21699F7D78CAF, 0x2A9E3BEF54548, 0x00068D17D9C3A },
+    { 0x365B171865385, 0x678366ADCCDEF, 0x455BA3CBCE115, 0x0E801A63CDE98, 0x3C5FE8E1CBE93, 0x0F506FF0FCC1F, 0x0852497395F87, 0x110C5405BE8B8, 0x15488902D7C18, 0x596C02F419468, 0x10E950FEBBD08, 0x051244BD904A3, 0x1118A38FD1373, 0x122B288B8ACDF, 0x0001998E53114 },
+    { 0x14836E8529679, 0x09186D9E2A6C2, 0x0778625205E18, 0x4450C9E4D2D37, 0x57DC4EBD3A2C6, 0x29E8F17A6ADBF, 0x38F5675528A1F, 0x7D2171D12C025, 0x22A113BD531F5, 0x2BCB343872F33, 0x233CD6032AC6C, 0x518E1F513A8E4, 0x39EE43CC40A1D, 0x4762B2CEE9C43, 0x000368EBDC14E },
+    { 0x3B6D5B892C59F, 0x38F6F40F7507C, 0x243E26EA00982, 0x020558F3036E7, 0x494884F9C049C, 0x5FEB5E7CEA245, 0x318B125CEEC9E, 0x4AE832B5B74C9, 0x3FCD6655F2949, 0x5E7E871D03FFE, 0x140347C31BD13, 0x6E9E4624B18C9, 0x379FFAF025D84, 0x3DFA8F2E6AE7A, 0x0004E360BE2EF } },
+  { { 0x314330644D661, 0x36700BED2605D, 0x4EF35FC88058B, 0x34B68D0832C82, 0x2A90656CAE445, 0x6D3F92C23BC39, 0x131A025D6876B, 0x07A984A098509, 0x4A4FBAF65DB00, 0x5BA235A4E1916, 0x2D8C7E1B5357B, 0x403C77E3DA4A8, 0x161E62FB9499D, 0x0721BD350EF96, 0x0002A17C9B0B6 },
+    { 0x49542D25A0586, 0x60939BC1BCB9C, 0x506944C96DE1E, 0x503F152D7584E, 0x3235F6BDB0528, 0x1A21D0CA1EE57, 0x3D208574B7BB6, 0x25C42393DCF33, 0x50A0E0F3E5EBF, 0x4B9FEDBDCD07A, 0x374EAB1E1162C, 0x49CF8F2EC00C5, 0x4D49862EB6604, 0x512427F2462B4, 0x00033FCFBCEB5 },
+    { 0x571C664F70819, 0x3A2D30AE2B1A9, 0x34BD1027F9E9B, 0x7A9AEAADF9632, 0x46F7D837755C0, 0x4B4AC554B6783, 0x609E403A521CC, 0x5B954DA652070, 0x1D84EE67CDDDE, 0x795C9187DAC09, 0x2DE82F90F15BE, 0x7B07834F7ABD5, 0x5A2F24FA62C79, 0x4191D4995EF08, 0x0003F85DC4F88 },
+    { 0x28E8C6D41F868, 0x0180694245FF6, 0x7B4D5FBC38A2A, 0x34AE691C5FF14, 0x60F51BD5A53A3, 0x1EC48D666A4C0, 0x559298C9980A1, 0x2C8704DF1B2E1, 0x1E2EEC5ADA457, 0x22594CDF9140F, 0x47B65FB4873B7, 0x769845CF24D84, 0x456C61790EA5C, 0x2F26C06599894, 0x000345F9B7AAA } },
+  { { 0x014CE45872E7D, 0x0FE9B543B83D4, 0x5D0BF3484FEE9, 0x31B38E8078A13, 0x30210D5668E5F, 0x586C6A4F2D1E6, 0x370E0A86A42FD, 0x3DB66906CCF3E, 0x7AA89BDD032D8, 0x6141A8F5C9F9B, 0x35C4803A67645, 0x51E15106B75EF, 0x567D9E5848443, 0x285329AC395B8, 0x000201E3DDA1A },
+    { 0x3B21A596FCFC6, 0x3A7FEDE834399, 0x60834DC0EBDF9, 0x367CB6C586255, 0x3009EEEE4E80F, 0x53F58A38A0817, 0x6B28FA7C1CC1B, 0x430645541B273, 0x6B68902EB66BC, 0x3FCCF4B3D5D74, 0x7DC4D2C19572B, 0x48B8A7359FC7B, 0x133ECC091F784, 0x3818B1100E5A8, 0x0000586E1B2C5 },
+    { 0x729C006DC2F6B, 0x477C6FE2372E6, 0x1B242C8942DEB, 0x07F75DF85C5D3, 0x05C0D52CE7A1F, 0x4835CE54C8A45, 0x370200343055A, 0x139A78212E2A8, 0x1749828E72F68, 0x5CEC62395191C, 0x0C234AE03DCB6, 0x3624B674FBBB8, 0x66CA992C1AECC, 0x47692E7D54825, 0x00028318ECC18 },
+    { 0x717C327FA5BB0, 0x6025E155210A9, 0x322CB3E546BC8, 0x50BC38F758F6C, 0x4C29F21F6EF88, 0x24D3C1EA235A1, 0x3A51196052ADE, 0x3EAC212846B9E, 0x516293DC199B0, 0x002E1F45F7824, 0x14B05EBB43895, 0x2040DE3FAAEEB, 0x5CDF7D33CE22C, 0x76AD8C3DAA8FF, 0x00034E286C2BC } },
+  { { 0x5FFC450C8CEFC, 0x4563A82047321, 0x2ECBA18414095, 0x76220AF77D317, 0x46F2D68142D55, 0x1AC0983B02C6B, 0x7DFC5FB7712D0, 0x1D95EC9744C57, 0x1A10CB25C9ABD, 0x23002C016858C, 0x7A7A341F93D13, 0x4104C867BDAC9, 0x12E46B2BC10C4, 0x6F8191A438AB2, 0x0002DEF4554EC },
+    { 0x68BB72BA6BF47, 0x562A4D811DE60, 0x6ED297CD95368, 0x4068493ACF112, 0x275BFF1E27954, 0x3CEDED5F7E61D, 0x21E506218EA58, 0x48224335F582B, 0x2CF386A12A1C3, 0x7F91F0102FD31, 0x502854600590E, 0x3950FC3B5CBC4, 0x2CDBB921D00E9, 0x2889860CF897B, 0x0001332F1C40C },
+    { 0x13094046DE536, 0x5198952A29F7A, 0x3DC85CC4A5553, 0x4C7D1273EBAA0, 0x541CC7E111096, 0x6436DEC122BB0, 0x5FF8802870C9D, 0x0100A420ADDBF, 0x6A532CF3944A6, 0x246E0A4304E58, 0x1671A5683E568, 0x07B81EB17FEE5, 0x466BE5281EDE0, 0x1F8E6B715B929, 0x000323F170C76 },
+    { 0x6BF124A81EBE1, 0x03FD987AB1CAB, 0x7E0B7033BED38, 0x7FACA694386C1, 0x361B562217F4A, 0x5F3DDA3F4A7C3, 0x52D09480D6E51, 0x684956F4E4C69, 0x04156BF3671A4, 0x17D19E3E6EABC, 0x1D0632636C5B9, 0x349AAC6E3586A, 0x292DB9268714C, 0x412FAEDBD884D, 0x0004868C87F2C } },
+  { { 0x5C12A6CC38AB4, 0x2DC9729E1F176, 0x699F735F947FD, 0x6A98BDB97A1BE, 0x158506537842F, 0x2895F604FF2CF, 0x2364CF2CBF389, 0x720B00ADE2905, 0x09400188771DE, 0x5EF0BD3CF05CD, 0x5574BBF390778, 0x2904548DC43AA, 0x6552C7B07FD92, 0x77A99455C9379, 0x00040636044DB },
+    { 0x562CAA864F7EA, 0x2820E744B91E4, 0x77273EA726FB3, 0x7E2CA7B027A52, 0x0DB4DA5F9E5C0, 0x7BF4ED47D658B, 0x54584DD522223, 0x3D1EE6274C7B0, 0x2D694731C63B4, 0x37F703254C63D, 0x35449CB7B95D2, 0x0380FACEE050C, 0x0A75BE69D1B73, 0x73F844A9DD1EB, 0x000123CA16FE0 },
+    { 0x11047083C5F50, 0x39D41A3436B87, 0x632C459027E99, 0x2182B0D001A32, 0x06AC6F95D7186, 0x6307FE7ECF748, 0x04C9795B9B243, 0x30C9D6AAF6E6C, 0x1FB9E4C2C12F3, 0x2F12DFB53A54A, 0x4409B93E6614E, 0x05B3FCABBC0A1, 0x6D3F5D0DCA72C, 0x73B188427562D, 0x00037C2A9DC04 },
+    { 0x41C5F595CFDF6, 0x4D946571569F2, 0x3236E205FB868, 0x2A7161050BD5B, 0x006FD68D6672F, 0x607EA3F918797, 0x419B1DCA36BC0, 0x0CFB611DE9946, 0x176B390E2989F, 0x7CED3A6BC5FD4, 0x2AA8496A44E5E, 0x0D9011C3A8FCA, 0x2A64170F3E064, 0x4B0497AB72551, 0x0003971C7FBDC } },
+  { { 0x178C1C11D7493, 0x06229999354EE, 0x189CDCE92B99F, 0x04099C3CFD53E, 0x53C067972E777, 0x36955EE04D8A0, 0x585E060E461A1, 0x29F7E3F48E9BD, 0x04A7E8C70EE72, 0x0BEA90BD4421E, 0x6C330B89686A7, 0x6A3549BD59E41, 0x0EC2B3D3DF3E0, 0x2B7110175ADA0, 0x0003FF9C6BFA9 },
+    { 0x68164A1625D9B, 0x2C265944C5575, 0x1A6AD0143AA6D, 0x791F5E9776572, 0x6B380060130D3, 0x357D754DAC6A7, 0x398A2CA68A49E, 0x50C9C3CD0684F, 0x2E41127C14D29, 0x449AE695C4A4A, 0x539969CDB8233, 0x2B6D6211964F9, 0x59F1E0B96F303, 0x12FDC6EDCBE38, 0x0001FEE4310DF },
+    { 0x618A131E31C41, 0x2EEC0B3CFE50F, 0x3711D635AA449, 0x49D87AF829805, 0x1208420BF73E5, 0x47807D2E47022, 0x0F0875F9DDAD9, 0x0F8CCE3D1B815, 0x07FA032BE4F86, 0x168D4AB01168E, 0x0F56BA453B6E1, 0x0A178A0E43612, 0x42AC2113A32C2, 0x4F41FBB053E95, 0x0001A3AA8A6F0 },
+    { 0x46AFC5AFA566F, 0x617B41A3B1058, 0x7896006840809, 0x56A5958A5D192, 0x009CD1E6520F3, 0x5A152665CEB7F, 0x7507F0805D41C, 0x2605833100D13, 0x2E5A3D5437E4A, 0x7853FFC30C6EF, 0x2ECA12482FEE1, 0x4CFC6DD5CBCE2, 0x3D9EAFD47A28B, 0x3739A247C07B5, 0x0004C16FE07BE } },
+  { { 0x31CD76B9BC4AB, 0x43CA299224FEA, 0x3ECEDC902B5B0, 0x049923DFA37A1, 0x54FA4B9E46EB8, 0x6CE8A9FB40433, 0x4779320238F82, 0x2607F7355C90B, 0x496FA42A11BCB, 0x248870F791A92, 0x763CDFE2EF9C9, 0x5420AAE27FB94, 0x1BC6002C0406D, 0x41FFF1B52A789, 0x00033D19CD1FE },
+    { 0x367E72404DBF7, 0x7164D56BD3108, 0x3A22322DBD787, 0x09D08146DEE25, 0x40D42C4176D28, 0x634FEBE9E1C9B, 0x66E5ADA7E9B3A, 0x5749964DEA99E, 0x44747404E2F9F, 0x3D98E8A911D8F, 0x019FED7E48BB1, 0x286FA3E4A2051, 0x114F2F5A8C206, 0x60D0A6AB3BF25, 0x00027275D3199 },
+    { 0x69F930DE7DEA3, 0x41DED7E802E6D, 0x36D5E47C16427, 0x77B167151967D, 0x3AE6FC7CC502E, 0x7A0980F18A4B4, 0x139CEB975A511, 0x17FB09420FC91, 0x7891A6B40703B, 0x6BA9AA403BA47, 0x1EA822CADED78, 0x2D8792C9F5B7E, 0x1DC544ADF6926, 0x3BEC8EFC1FFFF, 0x000475D0741FB },
+    { 0x7FFF26E40955B, 0x5ACFDACBDAD84, 0x5098EFBE73E51, 0x5617CD56F75C6, 0x754486FB75620, 0x7878B1AABC2C0, 0x7355099307016, 0x6F4A242FB5ACF, 0x2C24FCAC37C52, 0x4FACF84746A25, 0x65BE5788AFC3A, 0x3B95A998CCB07, 0x7EAC280EA457B, 0x783548EABFC67, 0x00046E00550C4 } },
+  { { 0x2387AFE384572, 0x701B9E5427721, 0x49AA13ED8DAAB, 0x444FD9100DBFB, 0x37C92E981BC49, 0x5EABF9D8862C6, 0x362FFB6D9569E, 0x4EC0B4990AB2B, 0x58394E961F9C5, 0x787F4D147BC1A, 0x3F50BA6C4B390, 0x60F5FBCA5015E, 0x27D6CBA532D7A, 0x3CDD19478BDC2, 0x0002C76ED672D },
+    { 0x61C207BEDD75E, 0x21C03927EA331, 0x04535ACB554E3, 0x4C5D0773AF5A7, 0x568415FC99827, 0x3E36476BFE9C1, 0x6CBEEFD9E3EC8, 0x5C0C8BA59E15D, 0x7DA66F84D7DBC, 0x5320B70571B82, 0x6CB26A848E7E8, 0x38614389A725C, 0x2FD60049F5956, 0x04FD4355621C8, 0x00009D635D222 },
+    { 0x10961F3F60494, 0x73797AC337D28, 0x6F282ACFB6FFF, 0x4FC357D4D09C3, 0x5FC5E177D1430, 0x638B25B57381B, 0x3A4A0F822501B, 0x6DA6FCCA5C013, 0x1B318ADCFFFEF, 0x28E0D1E78BE44, 0x66E8FBCFE0AD3, 0x759CED3231FCC, 0x57B178F18D21A, 0x7F6815FD20622, 0x0002E50081B64 },
+    { 0x440069835E6B6, 0x3E97FBAC3B654, 0x40890EB3393A8, 0x22B2AAB4297AE, 0x391770D7D695C, 0x5D365D2CB23EB, 0x352B4CB9B4AB9, 0x110808FA0DEE5, 0x53393F44FCFF2, 0x51CB1C1DC0395, 0x44F70344996A0, 0x28AF0DE7A11D7, 0x2C817988C860A, 0x1090249F4D11D, 0x0002F7CEC1AFF } },
+  { { 0x75FA8C4A0E43D, 0x61992B40A631C, 0x31EAF312916DA, 0x79A3E8D96771F, 0x6B81127D6E2CD, 0x53C0134F18B31, 0x31A8EAF8E65C8, 0x14C4DB2198D71, 0x3B8A1E14CA991, 0x7A1EC4D62B661, 0x0CAE7EFFA47FB, 0x25D829CFDA49A, 0x0F778C69BA450, 0x56DFD23068783, 0x000286D272C45 },
+    { 0x04403CF92458F, 0x6A7A5DCCCC982, 0x291CBF5C72099, 0x6BC3188365AEB, 0x4011480F54C6B, 0x0A19DF1E64830, 0x37DC05F890F3A, 0x7A6BCC305A900, 0x0E22EA29C6D9C, 0x25921EDB814BF, 0x164DADC23DFC2, 0x0143CB934D2FC, 0x5F28A710FED8D, 0x195E6D84F98C5, 0x0001EF0B31E66 },
+    { 0x438E62696A96D, 0x140FF88AA7CDB, 0x39413FE77C0DB, 0x6C9595ED7FD2C, 0x5EA8B3AEC2DFC, 0x2A42FCBD5C866, 0x5EF28DBB0973E, 0x01BFF6E8F9F2A, 0x5E274C70AA199, 0x0D6CF75715E8C, 0x723ACB6302196, 0x3908820EE46CC, 0x791EA0712FFA1, 0x5C9592223CCD2, 0x00056C14D50C3 },
+    { 0x4B73067125CCB, 0x10BC87CAAD93B, 0x354F28AE4D8D2, 0x0E894DBC83D32, 0x7156416ADCEF3, 0x3315D96CCE797, 0x16CE7273CF547, 0x2803309506355, 0x7E66622A9A93F, 0x17E3A68BA0805, 0x4CD5FE07994CB, 0x4A4013BAD98C9, 0x27BF4CF67B7C8, 0x358EA1C854DFA, 0x00038775E21CF } },
+  { { 0x22750EF71CD5B, 0x53C46690B4CD5, 0x10990B240E394, 0x141BAF07870B9, 0x01A6EDFAE0283, 0x5781B8AE0C00B, 0x6AE194B52CF2D, 0x23221880944F9, 0x7B427A667BB88, 0x67B488CD3DF09, 0x07BC6D5418277, 0x1B2C1A355A56B, 0x6FF335BB9B47A, 0x3E189F6AAE27F, 0x0001CF14E4EC5 },
+    { 0x2C2B4475642F3, 0x76167745FCB90, 0x0D0CD64916792, 0x69B4BDBAD11BB, 0x0C637EB0EAE1A, 0x20005E0A145D7, 0x4BE1E23D2E943, 0x1CEE83DD68244, 0x44D88174BA38E, 0x626AD2E6CB066, 0x3A4EA393590E9, 0x38584069D51B0, 0x3E08CA8300468, 0x76185858DF2BD, 0x0000C351517AE },
+    { 0x28C146077D6BF, 0x37F20408E6F6C, 0x1C9E939ECFD02, 0x7D6962645CD3B, 0x5A8E74B7F7CB3, 0x64AE387A64D45, 0x02906A98AC574, 0x625A6EF09023C, 0x280DC0CE97041, 0x69DD92B64EDCA, 0x796D830E67BEB, 0x58E93EEF5D51F, 0x58C134FA96743, 0x7897E23BD4219, 0x00031588DCE32 },
+    { 0x1E0C9366C489F, 0x1E86B3DF005A2, 0x1461C36357653, 0x6D4358EBD4615, 0x68F446670D4E2, 0x02FEDD2C6838E, 0x3365B40DC1E79, 0x38C05229B840A, 0x5897FE4A158F0, 0x618C7A6BF0C77, 0x35CC013002AC8, 0x52FB97776A72C, 0x363A8B2BE1A14, 0x77E7847A2FDD3, 0x0002DF6197866 } },
+  { { 0x386AFBE10BCA5, 0x2A7F0459A7C88, 0x391003A71176A, 0x066075E3A18F3, 0x0570412548590, 0x28232D4C7D9CF, 0x65A8A18B99710, 0x5C5D214F441C8, 0x2C26AE6689442, 0x22EB4E927CBE7, 0x12CF8797CE84B, 0x51F3977D8C709, 0x2FFD3AD2CAE26, 0x06E2D374F87D7, 0x0005A49C0BCB0 },
+    { 0x1962150A66EBC, 0x526F9134B13DE, 0x188231DAA6F3B, 0x7A84944D6B182, 0x2A1FCF9DD34E9, 0x11F123EE98048, 0x5552732AADA93, 0x13C0FD4A195A1, 0x0B0A25A4CA7AE, 0x0DB23FFFA94BC, 0x6B2EACF0FFAED, 0x126F9F4C24E45, 0x1FCE34A4A0EBE, 0x55AD942420E5F, 0x00025803B7ECE },
+    { 0x526C988FC869F, 0x17B3F564E5B91, 0x38F8F5A188657, 0x343AF310FFE50, 0x1877453206D37, 0x7B7D191E4E522, 0x6585BE88866D2, 0x7FAAAFA1A12D3, 0x5A1B46388FB10, 0x5375E7F751379, 0x30FEA2CCCCCFC, 0x732B799267909, 0x7338B0B8F3567, 0x63D1537B430E8, 0x0003A8B09DC61 },
+    { 0x3BD5C58A37E34, 0x09F62B7822BBD, 0x0153297C6ADF2, 0x48C16C587921B, 0x40996AF7D8D81, 0x42B0603650558, 0x00C8A0047A144, 0x23013FE73F480, 0x5D6A5EC80F989, 0x7999428364FF5, 0x67E0D0384891C, 0x7A998F9BA9227, 0x0EEBEDE89F707, 0x37AAFF3341625, 0x00035C8E29EF2 } },
+  { { 0x3755EBC9BDFB5, 0x6417AFF1F6A9C, 0x0F77EC3035F5B, 0x53FC55F55E469, 0x2E4066AAFADCF, 0x03DB840384E3E, 0x41BFE02B29EED, 0x358B16004CACE, 0x1DD22463C301F, 0x3AAE45F2BCC44, 0x19B1DE1D41A83, 0x4F313B2058A2D, 0x33214B1F1D5C3, 0x6668848E9A52B, 0x0001B740A7953 },
+    { 0x22A16414DADF8, 0x0E23F85B2B162, 0x0EB66D40BD430, 0x417D028C80552, 0x1FD081B96DEB9, 0x09A68A6F4CBAE, 0x62C2C91891F9E, 0x0E25D7DA55DE0, 0x470B0AB6205BC, 0x6BD2D3C49C3CD, 0x04F17B4507E00, 0x757AE976583CB, 0x7976F654F85B2, 0x084110F50C922, 0x0002303F8D5D6 },
+    { 0x592C3AE6363C7, 0x34406D52BCFB0, 0x6A96314B68562, 0x56177101B5125, 0x78805C1868C82, 0x069ECBB5D93C2, 0x04ED2EF3F05AF, 0x2BB7BEF3F2E15, 0x060FE5D9353AA, 0x70AC7EE692C09, 0x092C0ABD631C0, 0x2B709D3A97E6A, 0x40C61B4008093, 0x63C87A0FF062A, 0x000372D062E9C },
+    { 0x2BE15423E9ADE, 0x7721C4B02E406, 0x1E1EE932A7E79, 0x3E633DE6295D4, 0x65BAD744B0E58, 0x31DCFD830A84C, 0x4563572BC2B4D, 0x1BCBB900E538F, 0x224CC11A3ABD8, 0x34A51DC394D60, 0x270E44E3599DC, 0x553CC87883CE0, 0x59D0F3672454C, 0x3CC18A912DA23, 0x00038AE505E86 } },
+  { { 0x2C8DEA264A6DB, 0x609235C4C6F72, 0x65A976A4AA623, 0x766008657A0C1, 0x3EF015724E340, 0x4CB0A6DBBCFB0, 0x7B53B347C396B, 0x4C47204C81E1B, 0x5CBCC3507F9F0, 0x174B4EC9FBEFE, 0x5148BAE2D6C78, 0x5E2EDE2928435, 0x70C468370FEB3, 0x5A7A778F15904, 0x00015322B94F7 },
+    { 0x0FA7FF3425EE1, 0x09CF3E03D378E, 0x15C94AFC25F5D, 0x776A6B7481872, 0x6E2CF0EAB7B27, 0x64071F2AFE9B9, 0x1E1B05135DEA8, 0x257B56155D046, 0x638D84BC0F17D, 0x310533F649E0F, 0x189BDF5481613, 0x690A343808C32, 0x1C658A75B7A4F, 0x2D3ADBA2481B8, 0x0001E30EA368F },
+    { 0x5CED60E00AFF9, 0x1FDF1325701FD, 0x4E48A41586B1D, 0x70BB67169D5E3, 0x74A947BE35ACE, 0x315E162F5AF16, 0x624240F7046C3, 0x23EB15D082C08, 0x23D9C6ED944D3, 0x7FE5D791E2E4B, 0x3DA247BC4799C, 0x2A53AC96AA634, 0x36D618CBEFCAD, 0x0EB768C2C9CEA, 0x00029F5078FD9 },
+    { 0x3FDAE9C250053, 0x4EE93E741C3A6, 0x13B0FC5B83557, 0x59B7099741B3E, 0x24D191C647814, 0x48ED483BB9C68, 0x41E4C1CC2C9AC, 0x6EDB30B7DB285, 0x53AA7A064C3B0, 0x021AA78B1DDA1, 0x5F239AEACCC5B, 0x4BB5B8EAE9737, 0x437E14ACBBB4C, 0x1B1211A4A535C, 0x00041F5F545B7 } },
+  { { 0x6046711A8BC7B, 0x2048B237963CF, 0x7BD5B3D9D9273, 0x75D3290D454BD, 0x7B79F5B1A173A, 0x7FDCC256C1C94, 0x147F05A198B95, 0x4F0C30268289A, 0x1330A9F45531B, 0x733D064CCE9F3, 0x447F4E343ED2D, 0x6D027A8CF0CA4, 0x2A64CFA773698, 0x7E161525981EE, 0x000254388599F },
+    { 0x5B79906B4D852, 0x738F4763799DE, 0x01B5D2CE2A222, 0x3EC6DA3C28080, 0x5C32A879C990F, 0x72E743D6B3032, 0x27714E174444A, 0x643AF3AC275CA, 0x7A633006B44A5, 0x7F0A6522941DD, 0x160A12A5B806A, 0x66ED7466EBE35, 0x5D523D4980AED, 0x3644DD074213A, 0x00023341FE6D8 },
+    { 0x0B24D2440ED73, 0x18269A2F410C2, 0x1303260DB6BE0, 0x76535344F5BCB, 0x0C9042CE3E3C6, 0x12F1A0912C846, 0x2B001A4379BC6, 0x5FA39320268A3, 0x5E523F61819DD, 0x196A3CD9DEBBB, 0x1AD16BD6F5DD4, 0x448784071BEF6, 0x1E2623725063A, 0x474CDE79E9B99, 0x00034CFDC6E89 },
+    { 0x1C3C4C7B76CA6, 0x72539CC6DCE77, 0x1C6560E2AE076, 0x1CEF236AAE616, 0x3965D9DC6E765, 0x1063C4D306CB7, 0x3AB32C3CCE35B, 0x3A030066D6084, 0x106324E786057, 0x154D9D67E55CB, 0x610D16DE2335E, 0x3A76A4A694CFF, 0x4C093EE18A207, 0x2215B88AD6497, 0x0002F930BC481 } },
+  { { 0x558FF38C15ACD, 0x42EE0D86C8708, 0x3A6FB7667FE8E, 0x099CE1BD2A756, 0x3AE65C5650214, 0x386D229331667, 0x0EA6C6053F53F, 0x08E9D438AA82C, 0x3D5BA3CA25963, 0x1C0044FF9EC5B, 0x11DFA6069A1DA, 0x6298CE31A11F1, 0x1440367620032, 0x7349A390F69EE, 0x0005BEF08D0B2 },
+    { 0x47D329C683CC3, 0x661B772C03CAD, 0x659799F2BAC44, 0x26550FEB1A16C, 0x31D0EC9D909EA, 0x72FDB4EC4B2F9, 0x646ECEDB04C71, 0x313C6F5E0BB59, 0x48D252755B14C, 0x5D36F0BBD8593, 0x5FC0DB6ED7F02, 0x749A416C8A80C, 0x0D73E66E8D4FB, 0x0C943C6034C4E, 0x00032CCF31D74 },
+    { 0x66A55D988EA37, 0x46267216C3184, 0x5531251BDC6A2, 0x3D807879A4C93, 0x2A4F0BD67E79F, 0x6ABE354CF7ACB, 0x538D16645A3E2, 0x770C729C66F2F, 0x2E6E1FE7118F1, 0x0A3FBADC8B939, 0x5E3AF381A5EF5, 0x12B6CA65AB2E0, 0x0E4936440D30F, 0x479CA3AA1C5EC, 0x0003841407AFD },
+    { 0x210C768BDE68D, 0x234A07D4CDE57, 0x6E601B96DC9F3, 0x66B5EF4357146, 0x06ABB08445840, 0x13A7C12337B7A, 0x4857E03AE1FF3, 0x779ABA97EA47A, 0x158B6B9882A90, 0x0B17A2EA6E92C, 0x3D1C163345A83, 0x5242F10D0F173, 0x376EC7E9AA80B, 0x153DA135C6956, 0x00038258142DC } },
+  { { 0x5B28B7B880357, 0x074CB1F308C42, 0x7B9195D126D5B, 0x674FE5CCC640F, 0x4C1C82D9C070B, 0x20B938A516EDC, 0x1A5A45CF20C3C, 0x01094C89BA745, 0x267CE3B7BD2F8, 0x42B1947BC0647, 0x0528723C232E5, 0x208627138D2FC, 0x4450A3CE79EB4, 0x6265C21EDADC5, 0x0004B127B37E5 },
+    { 0x5A9E481E67B0D, 0x53B082CC9F6D5, 0x49E949D25058B, 0x43004B582488F, 0x750592CF85CA1, 0x7C8658B4BB8C0, 0x790C5920A705F, 0x4F998375F0966, 0x0EF6532B474E9, 0x481084BC52B65, 0x194B39EDE904D, 0x50C1F986F70E6, 0x4408EE5BBF38C, 0x453E91133FD37, 0x0002EBD3950AB },
+    { 0x6CF8552AF0ADF, 0x569849F5B2F98, 0x34B2A9042C25A, 0x4A1AF1FD10CEA, 0x1B41FB57B5E1F, 0x4148FDC090379, 0x4E698271CF47C, 0x61663A673606C, 0x1E93DFABF815F, 0x06ABB39379186, 0x081B33E5FC7A9, 0x63D5AC87A6D5D, 0x694AEEAB4C40C, 0x5A2886277D61A, 0x0002BD0F703EE },
+    { 0x7A3B287FE4FC1, 0x228DC834C51EB, 0x46A7743BF5CC9, 0x50362EB4413F3, 0x5463B82AEB6F0, 0x265C3924B166C, 0x1BF8254282A35, 0x69AFEDD4619F0, 0x09D8B0B4C5F7F, 0x6C8B858F0A3AC, 0x5A8D0703FB15E, 0x5ACA79A37C6A7, 0x510FC905FD96F, 0x1CE1F281C09F4, 0x0003864D68813 } },
+  { { 0x092DB450CB6B0, 0x00C6F302007F9, 0x12D24EDD2D730, 0x136CA0CD435B7, 0x5AFC2C060A104, 0x60811AA717831, 0x6CACBAA955628, 0x48A2582293549, 0x2A99B470347AD, 0x4BCBF26C6F358, 0x27967F3904409, 0x75D8B16385B2F, 0x15C61B6E67D06, 0x157AE33FE81E8, 0x0001D706C5BAD },
+    { 0x5318AB0397477, 0x51F14336CEA55, 0x47CC020FAED61, 0x3FC6863837C92, 0x710281D32D001, 0x2C7D9395A6593, 0x32171051767FD, 0x265B4B4316AD2, 0x781C765D252BA, 0x1FFCFA354D3EF, 0x2648D896A8474, 0x13EFE0A87E1B6, 0x7DBC52FAB0E54, 0x6E89F062947F5, 0x0002D9A6AFB6A },
+    { 0x50F5AD7B0B7C0, 0x163BF6D264488, 0x4CD593FDE5CF3, 0x7E64D63182725, 0x366509BB6A1EF, 0x14D11EEB1DD3A, 0x14894CE319DBD, 0x511ED667246D2, 0x7342B171D2729, 0x2E92E13B3C55C, 0x210111C957978, 0x0E507D75FF37D, 0x52A8BE7BB5FC7, 0x3EB29AC7023BC, 0x0004F048D697D },
+    { 0x5338AEE125723, 0x7F1CF3228AC88, 0x3BE1EF166C49C, 0x45A9D8E6B6242, 0x63DA0B085815A, 0x4369CF3957CDC, 0x781CF08C3E163, 0x53BE97ED8EA89, 0x6FA641C921040, 0x267497AE1F0D3, 0x2F90FB2E53A40, 0x77179C729941A, 0x780AD89744B1B, 0x3B4F5241F2FF2, 0x0004145921AC8 } },
+  { { 0x06A4500F50BDB, 0x2062F6256FF54, 0x38BDD9CB13228, 0x583C80E863805, 0x17F66D22FBF02, 0x1CA7295A580D8, 0x28C54E4926F92, 0x7666E5DA9F60B, 0x7987B9E3FDC43, 0x5C0B59DEA2A67, 0x41757F316EA9B, 0x18915514AA245, 0x49595FD2FF6E2, 0x2767995AE2783, 0x0004D300A7CDE },
+    { 0x4D2A581693053, 0x487D74CBB89D2, 0x1516DB3D7CD22, 0x41CC0FF4389BE, 0x4E686BCF26D5D, 0x7E6626F712D1D, 0x17E1F007B92BE, 0x0646E13C508F1, 0x71709993B6C9E, 0x506C57E1DED88, 0x3428C3BAE3E87, 0x179D0BD565A32, 0x311D7DB78F2DB, 0x50714FEB74B0A, 0x00014CD4C0589 },
+    { 0x69ACA98CBAF1D, 0x6DAFDCFDAB595, 0x5694C698C8BEE, 0x6DE181A789647, 0x703009E859553, 0x15D49E6051225, 0x643F576C53FCE, 0x58A0946B3E0DD, 0x144BE4D931810, 0x6D8ECA1B602EB, 0x61EB1E2AD519D, 0x3CF9766A9A715, 0x00BFBA025431F, 0x018BB8DDFA79C, 0x0003DBAAA19EE },
+    { 0x2B9C0F05E15EB, 0x0EE5D39A39D61, 0x130CE59426E65, 0x4FC27E48A5771, 0x5CBBECC2ACF0A, 0x2C42D431ED432, 0x4EA23781F914B, 0x0F9608B3039D8, 0x3C71D6802E733, 0x22E4F9D3BDAA1, 0x65AA284F4C4EA, 0x4096C935ABFFE, 0x7BE661E23751B, 0x47E7F9051FA73, 0x0002513B5BB10 } },
+  { { 0x4610C26592966, 0x567585DA2A508, 0x0A1CBCC2AA260, 0x4684B85211FB4, 0x0205143331D08, 0x7F37EB043D302, 0x4EDB1EAD72FBE, 0x47EDAE28723FF, 0x306A0FDCD4658, 0x266DA077031A0, 0x2E021FD55E14A, 0x0E6683CDD9ABA, 0x544CCE55975E1, 0x1357AE7D87B3F, 0x00034E5C30D15 },
+    { 0x3DA6E806CB4AC, 0x665EECADC07F1, 0x02FC1ABF2FEB2, 0x77CC7895C4C94, 0x58A96A5B4DA84, 0x17888C4805CC8, 0x5AB575B9F9B47, 0x5E3DE4BCF67DF, 0x4DA65C92AE248, 0x3ADEE248D2EF0, 0x2BDBEB8E5C6EB, 0x23E3B863729A7, 0x3EEB924EC6AD9, 0x63862AA06735B, 0x0001438786643 },
+    { 0x108B19A3929AE, 0x030E32B743503, 0x65E03D0AB6A55, 0x6ABE8CB82AB27, 0x6235A32617923, 0x79C298A24663C, 0x3F424C00AAA67, 0x48F7991FAF7F3, 0x70AB3DF70825B, 0x17B3697A39DAB, 0x5FCB0BFB945DE, 0x4704BBC9572C9, 0x7EFAE93177C78, 0x666BE9AA06D33, 0x000249231EDB6 },
+    { 0x109F1AF348CCE, 0x698ED0F4C3348, 0x09CE182C6CAFD, 0x2DF78AE1BB08A, 0x5BB21A5034FE4, 0x2E7C9BD89F34F, 0x3D87E41CCEA53, 0x02C5881E4E1C1, 0x430BFEC0EF6B9, 0x7C432B0FF59AD, 0x4228BAC853F2A, 0x773C04F3FD5A4, 0x3BF40C6B9AB8D, 0x27DBDFA206C54, 0x0002A5603E934 } },
+  { { 0x213C436698CDA, 0x76C5E290B1121, 0x6B7CC1F0FE845, 0x33008E56F1587, 0x56E90917992B3, 0x7B41EDCCF6BA9, 0x7454C62254A55, 0x49F1ACBE59738, 0x0BF516785B196, 0x091796D75715C, 0x6C808CB170466, 0x3D06757C05F3C, 0x61614CC36684F, 0x3B8D0CA3846B6, 0x00036AB1F222E },
+    { 0x051F16340EEB1, 0x674D3E9656274, 0x28E70ECEE2850, 0x469A02A40CF09, 0x09C39C42D5F7C, 0x7E7AC477D4A05, 0x70C163E6903E4, 0x3245D3CBAEBB0, 0x1BAD8E1A0DBBF, 0x33D1A6D70A5AC, 0x7C58A28C8F0EB, 0x3E58C0D7540BB, 0x55BB8B9EEE0F4, 0x7E93D78423E3A, 0x0002FD29016E2 },
+    { 0x1025A8735F80E, 0x777CEB68AC410, 0x0371E0231F3AE, 0x676F2E0284619, 0x2B79AC9AC49D8, 0x18F212C3EAD58, 0x2C46D4C835577, 0x5A811DFCD4F68, 0x7824C63771891, 0x013E5FF9B03FC, 0x1184125BD6C34, 0x52A829359ADB6, 0x2E2E279B98D06, 0x1A08ED2FC7DCD, 0x00028B0355494 },
+    { 0x3C7CA00363F9B, 0x40B8DB02B9C08, 0x4E6D438A8883A, 0x0AE4FA7D6DB57, 0x21C417FB24FAF, 0x6BEE79C1C848A, 0x71F9AEA279CE1, 0x330F762257760, 0x0562A4312BAA5, 0x3EFB3E97AF69E, 0x31F89DE672F78, 0x44EAA717E0AE6, 0x1CCAC1A224F70, 0x2A8C363F4D607, 0x00035322C8FF2 } },
+  { { 0x01CA7BFA957EA, 0x19E4320434E1C, 0x60B1E78706457, 0x1283ED0DA80D4, 0x1D3FF71034352, 0x768383AED51A3, 0x1EF41DBB90610, 0x08DB8B48B2917, 0x067205A942B7F, 0x4B8FB86C3FC78, 0x4E456E37D43DF, 0x064F615492E57, 0x5C6561C5DB451, 0x7CED229CABEDB, 0x000598BC5C743 },
+    { 0x5ECFAEC3B4F42, 0x6F7A4EE4D3500, 0x167C5058F0098, 0x0903C229DF96F, 0x70DBA63495C31, 0x67A4544DED6B8, 0x3DF97884FC77F, 0x1AF0EC9533F0D, 0x7319FEA5EC0FD, 0x49DABB1B0F7EF, 0x4BDB0238C4903, 0x61D31B58EAFD2, 0x1D131474EF217, 0x5E541E41B0069, 0x000316A679630 },
+    { 0x244ABBA83155A, 0x474DCF2577A66, 0x2A321AC0D67A5, 0x6DEC55DFA4CA4, 0x72B38EE078341, 0x311D00EDBB0D5, 0x14B58B7FA7015, 0x69878D3521F23, 0x44271C726FBFA, 0x26422AC45D294, 0x5ADE129BAA907, 0x3F6A61AC97E7B, 0x4289FC27D7DF6, 0x64B01F364AF27, 0x0004663DE10E0 },
+    { 0x301081BE44C78, 0x6F874A5B71A2C, 0x57DAD28606E3A, 0x6DBEAF095B97E, 0x1E6C67B559B95, 0x3F3AB0B0AC164, 0x5E76A1FD70752, 0x0F6BC9726C218, 0x0293A419D40D7, 0x76F568E7FCFEE, 0x6DEEFAE4338DE, 0x2474A0D3F0E54, 0x573AE50B0D29F, 0x05A7A0853F507, 0x00033E82585CA } },
+  { { 0x2E11C3C399CC3, 0x757377756C76F, 0x54A4547A523CD, 0x772E0EBE66620, 0x38D8E46AB74DE, 0x172C3058BA0D8, 0x0A178DE0CDC49, 0x503B971EE048D, 0x22A31EF09A870, 0x31D1A9D7E7396, 0x1A821EE154EF4, 0x727457671BE07, 0x69113DAE6BF9B, 0x4EA85D835B89A, 0x0005F2A938A99 },
+    { 0x43907329B59B4, 0x27A063F5CD1DE, 0x6F7AB0694910B, 0x772C7F313EF04, 0x6BBC9AD9711C8, 0x3C7323A021FE7, 0x63538DDE6B0B3, 0x7EF9F6FCEF01B, 0x422E1CCA05180, 0x0F9F56A484F21, 0x1FE656545EA28, 0x027245F8B957B, 0x5B399D5BEF57B, 0x1447AC440ECD2, 0x000282C8199BB },
+    { 0x7FAFD618DE2B5, 0x25D62AEBC53F8, 0x16929629C2C28, 0x4BC873476AE78, 0x23939DCADC59A, 0x28A2758F95B50, 0x51D650D5DB6F5, 0x32FD27CC6BB87, 0x3F76C932B5C7F, 0x6D20FC4FFADF6, 0x1C9E9BB6009AA, 0x0261796BBC9FA, 0x37E9AC86BE721, 0x768F44CE29712, 0x0004437A202C6 },
+    { 0x5530AE482CCEE, 0x4E0C709559B8E, 0x464BC0BBEBE6B, 0x4B69F1291E69F, 0x7D869B22EA48B, 0x6CCE91E9687C3, 0x4C75CE52F2780, 0x629B53F7FE6F4, 0x5C5678FA1F134, 0x7A8CF13A021BF, 0x1B84E2627C814, 0x29633BBB13AD9, 0x1DF20A70F5537, 0x69CE923F4D637, 0x000285BC53F6A } },
+  { { 0x3844530EE2794, 0x19839756BA129, 0x5B4270390A24C, 0x364364DD0C565, 0x00DE1559592D5, 0x30558C41266A7, 0x27A56287DB11B, 0x7DF6DA2AA2E3E, 0x2F18771FA2FF8, 0x7FDBC92663291, 0x29296DCE96B8D, 0x52806733E51FF, 0x4E461D2EE7150, 0x086E34C7BFEFE, 0x00020A888E7EF },
+    { 0x4F83A0BF6C306, 0x1BDA1BE4D684A, 0x029485A2D0306, 0x51959E7CE712E, 0x2B17F880EDF07, 0x1F4C297FA0CAB, 0x11205CE3E7817, 0x63DB0C1329BBE, 0x199601CBF59C5, 0x09AEBCA3ED1A4, 0x18B4DFDCD92A2, 0x27E46FAA1F400, 0x637466F7ABFEC, 0x249FFBB57911E, 0x0000ACF2B97AC },
+    { 0x056210A85CA56, 0x2DFA8F698C8E4, 0x07C113E7A3C66, 0x04A3AED06C697, 0x0662AF37A6AB4, 0x1185737FDD473, 0x618D4167F083D, 0x20ABAB6755B8E, 0x614B6027F67F0, 0x4A25FA3D2CD1A, 0x5D06C19131B52, 0x7EF403096BDCB, 0x660D34C3BEB4F, 0x17144EB2AF474, 0x0003F6406EE67 },
+    { 0x1F39D6D305D88, 0x27A5577633C7D, 0x5EEDC8785774C, 0x2DE2542B1D104, 0x22159473F8D65, 0x653B1B936D085, 0x1DF3927D2D294, 0x6807F9EE056DC, 0x60E41D08A1ED0, 0x06FC8FD60BEF0, 0x70C1F91D561A2, 0x3F0ECEB6C244D, 0x29AD271EED838, 0x7D7FB0B326CC7, 0x000368A60C506 } },
+  { { 0x3D5006E077A41, 0x5A95CAE3280EF, 0x531F7C820B18C, 0x3486D87E478D2, 0x30E9BD4348084, 0x0665C15EA6CD2, 0x4C8F14B05B9CA, 0x05DB547E1366C, 0x6DDD1EE1F8365, 0x48595B8816AD9, 0x5E178A4C9570B, 0x377A014B3E40A, 0x1F16AC6C4B81E, 0x33F6C4D4DB55A, 0x00017F4AA8E58 },
+    { 0x77CECFCF20036, 0x3C7FD441E6EEE, 0x0E3253BA568D9, 0x3D219AB0EE5D6, 0x73FE281E5C101, 0x4526933C47349, 0x323C18D8CC1A8, 0x5CBCB484F1EAE, 0x2EAFBC6CDAAB2, 0x0410B44D7B653, 0x0E13743B9F506, 0x0C2F6FD8911FD, 0x258A835A23724, 0x32516CD784975, 0x00009FD6C9857 },
+    { 0x3B9399B7CAE61, 0x69E219C210711, 0x65B662FD34019, 0x5D35859B3383D, 0x5125440E810E8, 0x712371F49713E, 0x596008ACE6000, 0x6C65755F33966, 0x6261441FE6385, 0x76DA635C8D157, 0x197EF14F17D95, 0x36C54BDC9DDBC, 0x5A167D06409F2, 0x785D1D185898C, 0x0003643466DEB },
+    { 0x080C25CC3217A, 0x3A1F710BB1917, 0x3DAA95839D108, 0x7ABFD56ECAFB5, 0x5A754604A93AD, 0x5B58D283982CF, 0x38E187E7E1C87, 0x70A0A3D0E0A30, 0x70EDD58304B23, 0x777650ABBFE60, 0x7ACECD448E1A1, 0x1B90E3A243BD3, 0x4CB6C4A1BA84E, 0x0E5F7C1B2F7BE, 0x0003ABE8BD35B } },
+  { { 0x7CDCD59736B97, 0x6142C7052526A, 0x7A0E020EF3453, 0x666B4861B9496, 0x1B8AB5BD87E90, 0x6A082F6289893, 0x3711312774EE7, 0x2BADAFF86081D, 0x6DFE0E36E3B29, 0x4206E8F61699A, 0x44AEEBA29EFA3, 0x11E40F91F7D16, 0x111111410EB85, 0x1822B305ADAE5, 0x000403615AC69 },
+    { 0x36D842D4A8439, 0x779A77A4FF67A, 0x66D455273D133, 0x22BCDF2D606CD, 0x2FC6C3BE2B047, 0x3F5D27607B91F, 0x271011D6C88C5, 0x7CC0DFC9456AA, 0x4F6A216355C91, 0x1D2563E86A743, 0x71F1C31921BFB, 0x45DFFEEF9793C, 0x068F239561096, 0x7BE58B98D5F8E, 0x000217CF2D442 },
+    { 0x1DDB258209B5B, 0x0CFBCA1CF063A, 0x339D1E96E68E8, 0x28F9B652C9635, 0x5044266606E3B, 0x0C3DB220D85BE, 0x3120A66348653, 0x357E0E20E22DC, 0x666861E8878FB, 0x0EC4E8923C066, 0x6D0343A7E6A52, 0x76B50B37E3CFB, 0x78D8EA1A5DBCF, 0x3675319F854A4, 0x000502E9EFE29 },
+    { 0x544C806F093EB, 0x4B5C1DB23D710, 0x1C8D150F125A4, 0x7A0C7A9A170AE, 0x4F431124FBBDF, 0x12E5148CD7668, 0x535D8CCF01183, 0x43C68DA07380D, 0x53E7EB465C80E, 0x7405A020E6831, 0x5CC751481953D, 0x39CFF7F65AF96, 0x2421995AD79DD, 0x1ADAC22B7DEEB, 0x00039E7CEE69C } },
+  { { 0x7EF999B7EBD12, 0x3FFF411E93F49, 0x10E6918445F42, 0x17FCD0AAD15B6, 0x5C65AC92D459B, 0x5521E75EACF11, 0x07E873A133E37, 0x3AAB90A6C2729, 0x5CB4C6B3ED04B, 0x326B795B0401C, 0x7B0BB26959141, 0x0BB464A0ECB49, 0x2BDDE0A4E6AB0, 0x1565A2B9E821E, 0x0001C4C7F35D1 },
+    { 0x66D1D832AD767, 0x6AD7C69F49EFD, 0x63CD0A18B452E, 0x118E77DDA64C5, 0x612844F12FD02, 0x62DABDC33BBC9, 0x5935C6F035A1D, 0x60F2554B7DD33, 0x7AF8E8D93F7C3, 0x3558A1196DF83, 0x6C5C0D70AC644, 0x10D1C98D919C3, 0x5EAE3065ECFA3, 0x39B0C856441B8, 0x00010AB868E82 },
+    { 0x580648297D516, 0x35DB35E16F42B, 0x09F5522D1F7EF, 0x063EA8D79B581, 0x4199318365653, 0x6E6BAF8DAA98C, 0x34106E5ABCA77, 0x5DE231FE5352B, 0x0A2A18C36AEDA, 0x2ABA1662B90DE, 0x0DF8179D3C314, 0x38921A735C710, 0x48E6687FB3007, 0x7CAA9FB421C3F, 0x00044CD1BF708 },
+    { 0x4D1473D50405B, 0x7DE2D79060B05, 0x3948B4BD6A5DD, 0x6D93626DFB083, 0x1505A63CA78C7, 0x10396FDCD5E7E, 0x02AFEA61553B6, 0x58D9CB76FED79, 0x7C93B42D73D93, 0x641DAA9490FB3, 0x5AEE416FC1C2D, 0x4DA0F03E9F668, 0x4B5080B643FBA, 0x0AD03797924FC, 0x000485690AE04 } },
+  { { 0x5854B6CAA6201, 0x0845DDC680F20, 0x1E7CA8392BB0D, 0x75DA0FE61A23D, 0x29B55E5FD2698, 0x0EA59BF02F4BD, 0x44444EF22FE4C, 0x1BAA7278C93B3, 0x63056119044A1, 0x0997FDFD97F6E, 0x7CAD30ADB9D62, 0x7CBB3978DC13E, 0x1F1C376C12C10, 0x680698BBD18AE, 0x000286144AA7C },
+    { 0x6C39A185309E4, 0x4F7161985951C, 0x2C9AA1B881F71, 0x68D6339D5FDD5, 0x0D7EA442664A6, 0x7AB07E7ACBDA2, 0x6FAF31A75BC73, 0x7CBBDA5592BED, 0x1BBB4A396AC87, 0x5E3B3B91D9C0E, 0x433563D942F35, 0x041E2F0EE2BE2, 0x6AF93AF17C985, 0x1EFEECF4892FF, 0x0001FF273C264 },
+    { 0x21588275F8915, 0x523A4372CA148, 0x2BE995EC6DF0C, 0x5AE5824367C8C, 0x3C6457AD02C3D, 0x35F65C82C59BF, 0x68F1E73DEF312, 0x4B5E4F51B5653, 0x75683826D3A89, 0x01D6B9D21177F, 0x1E313FCAD11BA, 0x23E3B7EAF2512, 0x45F8F25AFDAD3, 0x2AC6C72611483, 0x0004836D3C493 },
+    { 0x70772C5348A58, 0x5247EB6886A72, 0x00316964231BC, 0x7B9CC3456C736, 0x486894F4F47D9, 0x1546CAB233508, 0x3CCE8886D1C66, 0x5732D47E5F6DE, 0x4102B517CC704, 0x2D80C8CE965FE, 0x2D3CFA56F0109, 0x4F32BD8C3FBAE, 0x29DDE727DBE7D, 0x2AC6F15C35727, 0x0002F09F41818 } },
+  { { 0x2D8F7344292EE, 0x3DD0DB9D7F3C1, 0x40512EF607AD3, 0x465B56596E705, 0x03BE844EF05B0, 0x28EF75F164DE1, 0x74D77559F6FF0, 0x4183C603E39CC, 0x252B74E6ED4E1, 0x15E9E6CE9455B, 0x3921239B0E531, 0x7C3CE0F1B93E9, 0x2DA62B2A9B763, 0x261796F1F1571, 0x000352EFCCF04 },
+    { 0x3589A3EF25D81, 0x2376034503A0C, 0x6518F75436493, 0x54C42F9509481, 0x1AA69F507AA45, 0x5F5824BAB27DF, 0x71037868AAB66, 0x5EC64C4190D7A, 0x419DADE9930D4, 0x4800A8DAB0F07, 0x623CEBD559BC0, 0x0DBDF03AA3F00, 0x6890EF342560B, 0x181530838B6CA, 0x0001261E2AE2B },
+    { 0x074AF734E6F7C, 0x7D48ED9D689B7, 0x09AB33E63B04F, 0x529109670F32A, 0x2C63BEE5C2D56, 0x2452F0A848D43, 0x36CE065072BF1, 0x55C420B17C694, 0x5BC33936E04FB, 0x27A21BD3B08D2, 0x26419F765F4C0, 0x657585314E102, 0x20DE516287331, 0x0CA1ABA669DCC, 0x000435E29486B },
+    { 0x7FAE6E62DE9DD, 0x22A1611CDFAFE, 0x33A72D1F862C4, 0x429316F1B57AD, 0x712CCF955AA56, 0x69649EBFA8F23, 0x6088500801AD6, 0x011EAAA331AEB, 0x6B16A76F3D7EB, 0x721EFEDEA2A8F, 0x7EDF8B96ECE17, 0x739D233710517, 0x164B43AE33E25, 0x63C25107AF467, 0x0003891135FC3 } },
+  { { 0x025F7D761DED2, 0x4AEE1664FB5AE, 0x25EE2E8B8F9DA, 0x0B5C5288ED74C, 0x63AC7729429BC, 0x4CA98669547E3, 0x242FD7F2BDD55, 0x70AF250ADC07B, 0x5DEDC327394BE, 0x1E7372636B630, 0x35752B4C335A3, 0x525F211CC1E0E, 0x77DC7F70CA83F, 0x0C887799DE5C7, 0x0003C74972B8B },
+    { 0x1CEFFF9E9410C, 0x3DCB709024775, 0x65C2A10DCEADD, 0x1DC6EE48DACDC, 0x72494ECC29DB5, 0x6DB114F85D0DF, 0x2BC0180768B3B, 0x16A6503891460, 0x19EE208ACE3D8, 0x3EEC398301AAD, 0x3B52B03EC38BB, 0x3C27C67345A1E, 0x09B84F06F696E, 0x759B97C512F8E, 0x0001226891DF7 },
+    { 0x7247C041D07C2, 0x6B52690EE9DA0, 0x6BB3B6E45D1DA, 0x7BD37D20D5386, 0x1B4B287171E4A, 0x08C0FBFE473D7, 0x47327A32303DF, 0x17BAA2F3AE199, 0x50D243860D47C, 0x03A68F6E37FB7, 0x0D8BE76ECA06E, 0x354109B64ADD3, 0x28CB55CCF0238, 0x4422311257DAE, 0x0004B95E6277C },
+    { 0x3089C656645F0, 0x37FBC57BF6830, 0x37A80E32282DE, 0x2B409A20886C8, 0x6E23314877CDF, 0x5B85B3AF61C56, 0x00813380F100C, 0x64C8A6EA6315D, 0x563F1C3F9938B, 0x45F4B0DEF925A, 0x029318C29DBD9, 0x56D77FDB9038A, 0x78C97526A2CC1, 0x06A80B9A47BE6, 0x0003327A1A0E3 } },
+  { { 0x67606D297E48E, 0x5A54630C7A6E8, 0x1C5202FD4B104, 0x72CB54D3B1476, 0x422C6C0109422, 0x28A7BD9BC5DCC, 0x792C15CB2294E, 0x78B08475951A4, 0x11310D57802A5, 0x45A0DD809A454, 0x02B1461B42BE4, 0x18A45250D1ECD, 0x72ABFFA143AFF, 0x26182343D1431, 0x00053956A5814 },
+    { 0x68312B7927436, 0x75B8659697079, 0x3E3FDD8D974F4, 0x340AF3E35AA6D, 0x6B8D50F1A2338, 0x52F4B60D2D98A, 0x45D57BCE69CDD, 0x10616CE63E224, 0x36D1A730A0081, 0x05751D36FAA4C, 0x6461A2483DF41, 0x25D31503FC127, 0x790F5E7AE90C4, 0x370B3B8306C8C, 0x0001FFCACC740 },
+    { 0x4FA0F01672284, 0x0D24A6E606B37, 0x3366D01D355A3, 0x2110DFB0E988C, 0x5B30F129661A5, 0x356533404A537, 0x062AC14036D77, 0x3BCEE8E7DBFF1, 0x33DF8CBCE5446, 0x6A36A86613D5F, 0x3BBD09B8B547D, 0x2B1DA31AA8A8A, 0x22EE7C58F6DE7, 0x324E596B3ACAD, 0x00024C781F1F0 },
+    { 0x2BA65739D07AC, 0x3CCBE3F67EE40, 0x0FAD7E832E072, 0x5F17A0D7842B1, 0x4E6E8A57D99D2, 0x7A49468BC31D0, 0x1CA1DFE22C1BC, 0x0CF48914C4DE9, 0x1A2113414EBF7, 0x7B8A3D50C0FA3, 0x79E4AD2630EAB, 0x704682441EE13, 0x21C931D73210C, 0x0E88D5CDCBB08, 0x0003C718D24F3 } },
+  { { 0x2E5A3CBBA6A39, 0x4FE8D6E742246, 0x2C9D8DB32BCC9, 0x20F5F24880972, 0x41B522E4CE3B1, 0x6C6C147030AB7, 0x443F417EF1FAB, 0x753A80D354CCB, 0x3D22B45E90AF1, 0x600B7714CADE5, 0x47959BAF75C8C, 0x0D7A4B85F8084, 0x6C3AE6800E965, 0x3793CFB61E8EB, 0x000357365CA07 },
+    { 0x7D40D814B47A0, 0x49FB6EDA31374, 0x049A8A39A5495, 0x3197090D17D85, 0x3B563B40C07C4, 0x6E0E7BF4E8FA7, 0x5E39BEEC7B874, 0x1C1943D5A3F9F, 0x0F7F4FC3FAB12, 0x756A00A293712, 0x6AF07453D2B37, 0x035FCB6917D01, 0x16E27678980FA, 0x504E4664EF073, 0x00017A74B9123 },
+    { 0x3E19C25932FE1, 0x64FEF5B5B358B, 0x114BD4554E8B4, 0x6CBCDDFFE85B8, 0x69ABE978D5CD9, 0x126929B39F952, 0x0C5D41231F70B, 0x00DB67512C283, 0x1271592FCA746, 0x73D2414F1E4AD, 0x6CDFC7391A180, 0x493F878F6F09B, 0x792E22B54FDC2, 0x4A26386B1C23B, 0x00060FF899991 },
+    { 0x0FE62000E3D0A, 0x19D1D56A6D190, 0x165FF30103900, 0x7D19A0D13E87E, 0x30A0D4DF819B4, 0x69E9956C89B6D, 0x1545AE0048357, 0x1D212A6D93C1E, 0x7FE7A16B9A8BF, 0x59A57FFB35244, 0x509EFB6E57908, 0x6395788D01C7C, 0x34BDBA6ED481D, 0x0EDDFD5EC2FB8, 0x0003861DE13A5 } },
+  { { 0x13ACEFB106B79, 0x4F15846D1ABB8, 0x4618511A1BD71, 0x6A8B87F501DF5, 0x60D0CA811F4F1, 0x0FD7650368E5D, 0x285D09B3B216B, 0x2C193A75EA183, 0x00AB4289DE772, 0x5960F2FB2BE71, 0x774B011891216, 0x591C4DA827F48, 0x642A3FD538EBD, 0x4992E6BE03790, 0x0005E951BB61D },
+    { 0x4366A300733B8, 0x7C6E2C1EB8D6D, 0x7DDE653BDE075, 0x67E7600B97553, 0x46BBC64CAFDE9, 0x5BAC47A68F47C, 0x5EB0D95BEA833, 0x4CCFD2519986F, 0x2EA69024D8226, 0x2FCF52AEBD537, 0x21CD29AB7D2E0, 0x7ACAA164E8A61, 0x44F11F2C9AF43, 0x7151135292309, 0x000173519B464 },
+    { 0x1880042254CB9, 0x0F066BCE4F500, 0x77406D46EB63F, 0x2E181F299BEFD, 0x70ECAA62AD11E, 0x7F6EEAA55A9EA, 0x5A5D2758499E1, 0x376B2D779E167, 0x7AC1911F28470, 0x08A2A4154B8CC, 0x466008B72FD7A, 0x32CF620373CEA, 0x21110DCE6B248, 0x08C6AB47F4279, 0x0002FE75814BF },
+    { 0x7B2ED40129056, 0x0F52C24718E27, 0x5290828CC87CF, 0x6C5E6531C281C, 0x2EDB52EE40763, 0x18B45F3AFF74C, 0x670DEED708190, 0x50969B20217C5, 0x711603106BC10, 0x45BBDBE5C301C, 0x79F0D4FC15BBD, 0x74B97F1CC8C46, 0x41E09FEA45041, 0x4533AE052B8C1, 0x00029BC3A7E49 } },
+  { { 0x4A1BD6FC6E94B, 0x3857C856FDC2C, 0x01A2AE4EEA2B4, 0x4508F06029CCC, 0x5158631D1A969, 0x0EE85CD55B87A, 0x6FD4AAE4747C5, 0x1BC0440A12DFB, 0x224421644FD69, 0x2924095553148, 0x75F465F0070E2, 0x38A250E01AD6D, 0x5D1549E6612FC, 0x6033F0B3D85B9, 0x00054B7C50B67 },
+    { 0x055C28DF74672, 0x0BD23AD56619A, 0x7455B396F5064, 0x6FC308DB96B6F, 0x27FFE485AD340, 0x49101A12EDE33, 0x7545BBFB114AE, 0x74DE072F27E81, 0x627CF823BE751, 0x5E7B1BCAAF69D, 0x6A212AAAD40D7, 0x033FD90E9526E, 0x709D6112081F4, 0x2A7E650A8248E, 0x00021CF9DD4D0 },
+    { 0x72EEE7D765D99, 0x7CCA9A34A6F21, 0x1BB11B50547FB, 0x7D6E3E79DD8E9, 0x08121BABBEEB0, 0x56A682C1B65DB, 0x71AD3DB65A3B5, 0x1F026ED835A31, 0x46561F87E466E, 0x6694FB468BC2B, 0x33586ED9FEE68, 0x123FE00D3AC27, 0x4D43732386D11, 0x638B8C051B179, 0x000377AFC87B8 },
+    { 0x70CF3E445D62A, 0x0E5B078A8740F, 0x236E20560D2C9, 0x0F67246CA7749, 0x62244E65E6D4C, 0x4C6F75C1D9E59, 0x147656FE7C997, 0x3AA21BCE63517, 0x52FA54EA986E6, 0x6014AD6266E90, 0x0638B591BBA92, 0x11217A1760FAA, 0x01CE06337D264, 0x5693DD39B795A, 0x000261789A8BC } },
+  { { 0x27BB2A598B7FC, 0x192F8A224E6B9, 0x5A1DFE2E7C681, 0x28384ABFDD93B, 0x72A1CCD5A6296, 0x2F9F6EF2CBA79, 0x0ED18CAE155C7, 0x536EFD3A081BE, 0x2F1AF73C9025A, 0x66E2705585EA6, 0x3AD008A34ED29, 0x390DCAC2B4920, 0x65D64F8836F24, 0x5DA5441EAB36C, 0x00060468E8989 },
+    { 0x742159C56663E, 0x329F4C7F8E16F, 0x4E7D6535B41A1, 0x70380F1F08D45, 0x0EA000345926D, 0x307C2D64BDD08, 0x4C82DE2DAFA1B, 0x18427D1D4B84C, 0x3ECE6BA48B0DE, 0x7004B78EF129E, 0x43E382FA6A1FA, 0x72CA872D26BFE, 0x5EAAEDCBC2A75, 0x71C77203A814C, 0x0000C822A7C1F },
+    { 0x452580516D160, 0x1BA960C42DE56, 0x2AA18C3F4A8AA, 0x7472B057CA112, 0x601337872B797, 0x017209A8CD14F, 0x35D6CCCB4CEA3, 0x4A0F7824EE39A, 0x4D76CE404732C, 0x74FEE1BC7FCFB, 0x61AA29D5F6488, 0x351A3A62FBC12, 0x52E2D23F7BBBA, 0x313C891244320, 0x00035077A761B },
+    { 0x12BF5089352F4, 0x197018D6E5209, 0x4B8585692B312, 0x3F7BD416E0D27, 0x4725422A78B28, 0x2FE78E4E5A4BD, 0x3D3B678D4B053, 0x0E0CC6E7DE595, 0x3E2CEE4C2355E, 0x0BAFFEE62E32F, 0x3247BE2A11701, 0x2684797F05928, 0x1F63424585299, 0x685F7190872FE, 0x00036BE4645B2 } },
+  { { 0x42B27EF349381, 0x16E11BD7D6105, 0x43E238EA6F9A0, 0x2F6763BDB7B7D, 0x43537B030AA09, 0x57379332BD875, 0x7903518CC0462, 0x42294EB0BFEE9, 0x26DD15F0CAF21, 0x52712B31B3EBF, 0x1EBA5D176290A, 0x4488AF8588DFA, 0x5A3D6C64DCF48, 0x121AED80B3133, 0x00022DADFA19F },
+    { 0x7DC457A826042, 0x51FCC7D2BBF12, 0x32EE9E25BDEDB, 0x1D1461CAB53B7, 0x6C2488D60A029, 0x274B8FAB13E68, 0x6E50D18295402, 0x1118FCFAFA535, 0x22BBD320597C7, 0x0D7274B1403B2, 0x1BC49FF4A1545, 0x59F2D64DCB1AD, 0x29B10BF2F4A2D, 0x0BFF8C7F745CC, 0x000200EF96AD3 },
+    { 0x55F1CB645F417, 0x2A1B0BEB74617, 0x1F4D7731025EC, 0x148EA9A7E6087, 0x3EF6F0EECF686, 0x24C2D32D6CB53, 0x1CE5C1B865E95, 0x59FE9FC98425F, 0x3999417423A1A, 0x469EEF3D9F9B5, 0x3B047FA61C1E8, 0x549DBAE6582D2, 0x599633A9FEE5C, 0x36C91D25372A5, 0x0001AD2D50EE3 },
+    { 0x2C54066913D32, 0x6120062462076, 0x4A8BD4C48D956, 0x741C6EC01AA1D, 0x622EF3D8DC64B, 0x16319E71C5E2E, 0x3396FB389A9D2, 0x2CA5E88B3EB0E, 0x0DC305CC6CBD6, 0x4F8ED18A0EEB7, 0x76716B28337D9, 0x3F23AB67D6B94, 0x3DA00F1B131B9, 0x2F3FEBCE8D6F6, 0x0003E6CA83A7D } },
+  { { 0x3B2D0470942AF, 0x36FC30D075B2E, 0x11925B8E94A7E, 0x27D0560393985, 0x3873F6B063F8B, 0x3B15E3A8354D1, 0x6ECB2F405D402, 0x338349D47B243, 0x145E258DD5E27, 0x2A1FF2E0FDC29, 0x12D8A64A12B51, 0x57503D64B7B13, 0x6FF160C0AF8FB, 0x02C7CCB340385, 0x0006F36DEC8B6 },
+    { 0x0CAAAE4D884F1, 0x14D47B4E1AEAF, 0x38F15657201A3, 0x7BF723E71963E, 0x52D3966D98D1B, 0x6E9238093BCF6, 0x3513F456F85E6, 0x2430C8581A2BF, 0x1A1394F6B4C71, 0x060A79A1C2EDD, 0x2BF0EF543E88D, 0x2C6E204C3AA1F, 0x05C994EE4A3F0, 0x12CBDDCF79007, 0x0001FC155C154 },
+    { 0x6E8C7987CFC4F, 0x293CBC9DF2990, 0x4BD9E35EA4E8A, 0x0F5CA248CB988, 0x63E5B18D5125C, 0x4E82A75DA05D7, 0x25A98382D8062, 0x5430FDE19AA4A, 0x3FA38DF5BCC62, 0x0CDB9B4CBF4A6, 0x788308B7EF309, 0x6839C2DFE4A39, 0x2E040A2C3DD4D, 0x0DD752FD80D61, 0x00038644F7D05 },
+    { 0x7DEBFE316CBC9, 0x435C0845307F1, 0x477DC6B4F9CB5, 0x1BE99350F9F6C, 0x5E60E537FF8B2, 0x618D3B5F90419, 0x049494F0EA47C, 0x10E20BBBA319E, 0x01C0731A1B575, 0x170C4F9890B6E, 0x6C0D77BC0C0F4, 0x5C12118AAF731, 0x3D774A4E8DBFB, 0x6A2EA24977FBE, 0x0002E169A3AA4 } },
+  { { 0x76356DD945A71, 0x50AE8DAF10391, 0x1A99E967A2793, 0x795A8CFDC2277, 0x052D217ECBCD1, 0x1D55EA2B8F800, 0x139FD2DBDE244, 0x7F04082748A3F, 0x7BF48245A1CEC, 0x7A5B34CF25546, 0x1C9D3BE22D4F6, 0x77FE3C62586F1, 0x5A326ED67B925, 0x62FE4C6DA5FD2, 0x00058E9BBA5D6 },
+    { 0x2E4653B8B274F, 0x08BECBD56C97B, 0x788FFC78017E8, 0x769B8A1D4164B, 0x20FE35946C276, 0x78EF3365EA4C1, 0x4640C41C1D326, 0x3A4E860A0EB71, 0x6370320AE550B, 0x65050B572D242, 0x0115CBBD25762, 0x07885D8A701B9, 0x1E399F9B1D19B, 0x1CD2CF4429C2C, 0x00012D2957C1B },
+    { 0x1A8AD3C7D538D, 0x789AF0697314C, 0x396721F0857FD, 0x1A90033B75AC7, 0x5254524CDFEB0, 0x18975041A13C8, 0x63C7D889E0140, 0x5C29D77092A1D, 0x58CBAEA64955F, 0x4D61AD660F3EA, 0x67756797F43B4, 0x5263EBB15BA9C, 0x4A09326B831F3, 0x3E2E76A6CB5F9, 0x00045294229E1 },
+    { 0x41F0DD3ABDBA9, 0x0AB08958106D1, 0x389216E767E12, 0x6784580815D35, 0x4E1C5CB388D95, 0x29198350E0299, 0x7322E9DA85290, 0x4F25DCCA0A7BE, 0x5B2F21498983B, 0x3DE2006D27B72, 0x2C7987C8BB16B, 0x55A60AE861EE0, 0x4136ED73AE6FC, 0x3CC1FEFBECB89, 0x0003325189A95 } },
+  { { 0x7B2B9D22A24E6, 0x66B9A1DFC2012, 0x7EFF2DE7D6147, 0x0734FC73FB9F8, 0x370C599D9EA05, 0x1A923190B964E, 0x12E74873CD40B, 0x34736E930AAD1, 0x5855FCC13950D, 0x597B2B20B8E6A, 0x092C6E08ACCF0, 0x2FDB2BDB62CFC, 0x1E3B1AB6A2BB4, 0x13FBCD6E67268, 0x0002DFD2F36B0 },
+    { 0x6C0485F5A867C, 0x7ED01AFE60712, 0x162EB3DA906AD, 0x16ED4D128E3D5, 0x3443D3EE3992F, 0x2744E5C4508A6, 0x3D2A54FDFB551, 0x399B5A4800960, 0x60ECB98D2090D, 0x0682E0D3193E8, 0x71DC4658F0539, 0x174885A298808, 0x5A7DD328A9E33, 0x6662FECB6A54C, 0x0000966FE1017 },
+    { 0x4205E33BA1DFE, 0x50ADD553F9EA0, 0x7E0F5298082B4, 0x31F2D4CB14CB6, 0x7F71D4E98964C, 0x01B775F5F17FC, 0x383326E06548F, 0x3053A4D7CB678, 0x1F5F223BA8147, 0x1873B82D757C7, 0x65DB63B4DC7A6, 0x05195F9B36863, 0x60C92A6F9ACA8, 0x29DF02A14E9FA, 0x000156CDA0339 },
+    { 0x14728251C4F22, 0x6DBCEAA3B6B28, 0x30CDEC9CB101D, 0x78173ADA7816B, 0x4580773CA944F, 0x470A4354CBFD9, 0x566134A164DCD, 0x1D34C4480D611, 0x3BFCCC433925D, 0x0C1007692AFEE, 0x215955B8B37B1, 0x6D1A28493CDEB, 0x6717194158117, 0x435D30D5666B4, 0x0003195178A49 } },
+  { { 0x684248B0272CE, 0x7C30CC215E059, 0x382E1E42174EB, 0x48997644BB6B2, 0x3DB84EB118F44, 0x0DA8B486A2CD1, 0x7C99F374797E1, 0x5A0B12CB5658C, 0x301DCF80683DD, 0x1F0900F4DAD0C, 0x7032FDA2534BF, 0x33F107FBD48B9, 0x7AED5C8935249, 0x4F5A8C438A64E, 0x0004741A19B4B },
+    { 0x799379C61FFCE, 0x531C8C3EDAED6, 0x7198275AD85EC, 0x6176C2561D98F, 0x3FD3B03784C89, 0x5BA48EC87F1F8, 0x4A222245CFC7F, 0x2245BEE467017, 0x4C885A065D95B, 0x516782FF66BED, 0x658C9971C99BF, 0x1E5551CEE2620, 0x3C00EC8EF7BFA, 0x59ED66D6FB33D, 0x00023B57115F1 },
+    { 0x4980CB4F7465E, 0x64D847DE76597, 0x1A262642A985F, 0x11F66D4A2D510, 0x1A2580E4997D2, 0x5D1EB025685D8, 0x117FA64301A0B, 0x754F91E7BAFF6, 0x1C11E69825C2A, 0x2EC1794C68186, 0x06B02AEC0CB3E, 0x7C7990D8F4531, 0x38B8B02015C15, 0x63688ADC5D50C, 0x0003BE343D899 },
+    { 0x7B93E0623CA62, 0x321A3F4CAD9FA, 0x6E86ED84F7A84, 0x59D3B1EC03F3D, 0x78BA015069FF8, 0x11A88E4AFE236, 0x3DD3F67CB8888, 0x742F152FDC53E, 0x7826B03E306F6, 0x093E3C84B84F7, 0x2E8ADFC057B79, 0x4AD59D9271B93, 0x6A251DFD98835, 0x421F176272D70, 0x0002D87326EC1 } },
+  { { 0x5B115937B46CF, 0x68950AB54F44A, 0x42A4397C2AA8D, 0x3E2FB65D4D78B, 0x3BA977B5EEFD8, 0x6D903025087DE, 0x6ABFDA70A3022, 0x6C320A5BF7170, 0x2462EBA2F78F2, 0x4160C897B200E, 0x0C0FB05F56C5F, 0x457310A7436BB, 0x60BC560719A69, 0x53BEEABE859E6, 0x000196BBBB9F3 },
+    { 0x70F2E35B56046, 0x15293A470F625, 0x22A3BDBFC7EEB, 0x29804FCA8A366, 0x7693278CD48AB, 0x3349B907274D3, 0x0E05356A58DD1, 0x56C420C5B7340, 0x586C2970274FE, 0x7BE4E4E76C9F7, 0x531F702D237A6, 0x7899D99764E3F, 0x6590B13912BA8, 0x37CA0B2A17E36, 0x000084DC0A0A1 },
+    { 0x6B8D39A4C13B9, 0x710536AF94313, 0x254B1304FDC47, 0x31BE75E18D9C7, 0x0F05F6A87C2E0, 0x31C9B0193ACC5, 0x3B532C3B014E1, 0x104D38BFE17F3, 0x553274BFA862D, 0x4297E251B134D, 0x5F7D6B77BA01A, 0x74DB666D9B511, 0x034403CF148A4, 0x64D07147E0089, 0x00036FEEA3BEA },
+    { 0x7E3712CAC17E2, 0x07FEBC356C030, 0x7F51ACB731190, 0x78904A8763C8C, 0x6B41B51CA54F0, 0x5AFCFD49CF79D, 0x1D1E07FCCBB7E, 0x38B75E6F62189, 0x461F1A83FC075, 0x1202756721836, 0x1BAC06783F100, 0x6176FF8071A09, 0x33B0283B47A00, 0x61FFB53EF5FF2, 0x0003BB454FA41 } },
+  { { 0x122E8D78FD5A9, 0x1D5B66E4EC991, 0x2D2FC30105189, 0x39D32E70B512E, 0x158E270E51BD7, 0x4605492B7965E, 0x52204D3844625, 0x7821F8537A22B, 0x697399F844146, 0x14CA9A549DAC3, 0x05B57AB8E07F8, 0x1F7C0F9DDBB6B, 0x634CA778EDBB6, 0x7F6D38FFFB661, 0x00053F0F69B46 },
+    { 0x1169D9679DE15, 0x420036D8849E6, 0x111CAEE7EB08A, 0x5E4481C258337, 0x773B1718CAFFD, 0x74A62C651EB93, 0x2ACC445902DE8, 0x23B311B4510C9, 0x2549796D1B0A7, 0x389C6E1858BB2, 0x490ACF61BDBE8, 0x26BCC69408CBB, 0x4CAD304A5334F, 0x4D72B95D6BEAB, 0x00016C384E950 },
+    { 0x4DBF097251E17, 0x5D6E5C951D94E, 0x1AFB1C600FCE4, 0x786D6D33F574E, 0x2E3CC567F25CF, 0x7270B65AC68A2, 0x5EFC132CF85C0, 0x1A57DA30D92C0, 0x3AA88FBA01CB7, 0x2179B5A87C387, 0x18122F4EB16FE, 0x5E3D77BA1308F, 0x6A684C3D7D639, 0x163184DE64F46, 0x00044B4BEFAC1 },
+    { 0x4A69FA2185687, 0x22816122C76C3, 0x2E65C457B1067, 0x1834B566D0B76, 0x47CB0A3126B69, 0x76D3D261AE943, 0x273DFCE1C45B3, 0x01A60DA3D5991, 0x60170FDDD16CD, 0x44FADC426038A, 0x7274772C0815B, 0x4A1DC73E217FE, 0x4AFFC16379D9A, 0x74E0D2FC1C91A, 0x000498FC4321D } },
+  { { 0x74B16EC5EC6B6, 0x18665939EF5DB, 0x17736F7C186BF, 0x282EDE9721E42, 0x35EEE05DC9FC8, 0x22D28598B4E32, 0x7C11503B77F4E, 0x4111BA1C5C8F2, 0x2F32A0391E1CA, 0x0AC4649473759, 0x21126B477C0D7, 0x0CB029BF98011, 0x33E4EB1AAFEF3, 0x650FEEC030204, 0x00035AA983616 },
+    { 0x5252F877E57BC, 0x0245D73F9B8D2, 0x5F041C81D3E92, 0x27FA464237C09, 0x46CB2AB35C8A6, 0x70E3438CB385C, 0x03050E2FE1DCE, 0x7A0CCB89737D9, 0x116D3D3F3FF7C, 0x5CF44266FF758, 0x5635A65048986, 0x0C4496C375119, 0x79447D868AA33, 0x307098ACFF3F6, 0x00025819DFB5F },
+    { 0x6A1530DF35118, 0x4E8683376827D, 0x000360EBE94A5, 0x5DDA54E0ABA1E, 0x1DD71E10E4BD2, 0x440AFA5D39BBA, 0x769291601D48D, 0x1F5C6F3FB92FA, 0x26C4E054279F7, 0x4D2709FF49911, 0x2341F2D4726E3, 0x5CAC1483DD7D5, 0x655668987D691, 0x2ABBFD6E8550D, 0x00029D42BDAC2 },
+    { 0x65CB646098A58, 0x2D331E0F5D901, 0x534830C6D385B, 0x5984AE6A476C7, 0x2D42A214FBFC9, 0x0D7807BD864F5, 0x2440C6B8130C2, 0x0B34CC6E9A061, 0x077913B5D9C7C, 0x2CE6843F08F1E, 0x6B7CEB015B90C, 0x38EC72A97E857, 0x585ABDD603F97, 0x100C410B5E1C9, 0x000414C81EB7A } },
+  { { 0x184C26FE18466, 0x448B2A2244DC9, 0x013CE42AA5E3D, 0x197DFCE777669, 0x2D4B025017249, 0x4EEB0BA2A085F, 0x7CD1342025F46, 0x38BEC0B32E642, 0x6A8F42F67B58E, 0x351A7F8961CB0, 0x00151F5AAA5D3, 0x49A35ECB9B220, 0x1DFE89396807C, 0x1BEB54928F95C, 0x0002FEE792566 },
+    { 0x08F58C25C5950, 0x20EB7BB670D14, 0x37E81583ED6CB, 0x449CCF028FD4B, 0x60F2E72643531, 0x28B00B8622F3A, 0x132E892BC9990, 0x39F5A2B54B3AE, 0x254089AA12ECC, 0x75B3369F2FC71, 0x25E62150CAAD4, 0x42EF9D99ACBDA, 0x19A6C85DEB272, 0x613E9B662798B, 0x00011186AF4E6 },
+    { 0x182D757584AD2, 0x01068C27F0C18, 0x406616C1E1005, 0x2433A1D7182C1, 0x28B76AF374F04, 0x017A834F648A9, 0x79EE114115688, 0x6316A113B2E09, 0x757510CE24705, 0x4DE4C88162F80, 0x3F853517A2933, 0x50D59BFCC01C6, 0x63D3FD79D29B0, 0x1C04D5DF534F1, 0x0003C080B4A5D },
+    { 0x7AB3D55D39FF6, 0x0AEB2481D2258, 0x707F0AEB71851, 0x7A633702095B6, 0x482F2ED01621D, 0x7FF239BFC305A, 0x4D7FBD04113C6, 0x00F08CC380454, 0x4BE71DCCE0946, 0x3B6FB83599E8C, 0x7E016ACF8421D, 0x1F98E9E4A3B7D, 0x102A025613CBE, 0x62E4A1E32F9C3, 0x0002748D5DBDA } },
+  { { 0x6EC3A52E96747, 0x4EE9B2A37417B, 0x3EBA805A2B4B8, 0x0F7FFC065EB2E, 0x192F23B786668, 0x7D1C84F373778, 0x1AA5E69B86B5A, 0x495121645E891, 0x76C16D7A83F84, 0x3DF0C94FD8215, 0x251274B02B0EC, 0x0BC289B39B12F, 0x04F9EF40085E0, 0x0C71980864E3A, 0x00020C58B96A5 },
+    { 0x2BE354F3EB99D, 0x7BB9A22DCE622, 0x0513EED21E1A3, 0x5069ACA83832A, 0x447BE74BC3E37, 0x0CF404CDDA785, 0x6A79BAF6E8763, 0x4EAB922913486, 0x394A72C435D82, 0x4BB8442385025, 0x58E8499FE8595, 0x09F85FC9FAA59, 0x73C3E69181D64, 0x259D8DE4EB16D, 0x000228D777D77 },
+    { 0x6036436C764CB, 0x5510729EE8330, 0x790739CDDFE40, 0x538E81D795593, 0x038EA4F6967FE, 0x6E7ACCF2EDA92, 0x1AE3C6FAA02FC, 0x2B8E78634CDB0, 0x2B79D0E33230B, 0x27823418BEF58, 0x547B41A8B26D0, 0x36D234B163B13, 0x08324C9A9BB52, 0x2A491D90E9AA4, 0x000374C214E92 },
+    { 0x6276F6A3C5BF5, 0x23C16C7B49175, 0x71FA88D2A450A, 0x759F5D449E1F6, 0x36FDDF2293D30, 0x62A671D01E201, 0x07517B4999DBC, 0x1229A24DA732A, 0x03898F8E0F807, 0x31820807B8ADE, 0x5261D0FF76EA2, 0x566194EB7771A, 0x237F46C6D7D01, 0x221BC689EE1B3, 0x00047AC899263 } },
+  { { 0x57F7849BDB5BC, 0x51CCEB8480CBA, 0x32A1A197E4EC2, 0x223D258FB939B, 0x6E8ADF5416B82, 0x5E8047174BF12, 0x41054F4200EC0, 0x2E5E2E357EC78, 0x2034744C5717C, 0x2D6917A1E024E, 0x684E369162935, 0x0ED20BAF8771F, 0x6E16291162CAC, 0x432B8315C9B3E, 0x000201D7E490B },
+    { 0x4D6C9ADAE2794, 0x617280DCB3710, 0x3947A15E77FF5, 0x27765F6D23BD7, 0x7C16B7D719174, 0x243D8E59B4C4C, 0x61E7E931BBE9A, 0x48E32D84663C4, 0x5AA3C4E44E799, 0x15B0F92AF68E7, 0x061B1623AF3AB, 0x47D749A1AB9EE, 0x619D449302E9A, 0x4FF43DB597624, 0x000116B7E1971 },
+    { 0x4E9E5157133CC, 0x418A7558A3FF0, 0x65031506223BE, 0x7481A5DC54FA1, 0x12CE01319A8CF, 0x2F80C723D1A6E, 0x1564D2BE59DF8, 0x2E3FD4C77E20E, 0x7990A3328CED2, 0x0D0D394FB563C, 0x2471D80670DE9, 0x732CA81DB2193, 0x2CED0DE37046F, 0x39F8F50CA8CCF, 0x0004168B29525 },
+    { 0x299766E5276E6, 0x24CE39F2C46FC, 0x0A435CD750BCF, 0x50F7AECE99CB6, 0x1908F31D84422, 0x545CFD62BB0D7, 0x4CF873904BEB1, 0x5615BF6D139C1, 0x16ACC1468D04D, 0x63A6928F9A784, 0x7307C32497E34, 0x3F2AA7FB9B5E6, 0x4894E68E1D7FF, 0x7E048910DA513, 0x0003824D9B384 } },
+  { { 0x5C2E5A389B0D5, 0x7009600E21743, 0x0B8D99CE1DBC9, 0x28C0FFE175528, 0x4F26758433085, 0x1D91AEA87714A, 0x06445E005DAF5, 0x6476387696642, 0x39F6F003F42D5, 0x0C1957F32FE01, 0x4106FD0E492C7, 0x1BC0F5ED5B33E, 0x1996E989179AD, 0x2366045A2B6DC, 0x0000948FFC4E0 },
+    { 0x25DCFAFCB6D78, 0x2F6C78F1C8936, 0x5FCC959C9A466, 0x61B27983EA08C, 0x08C9209518411, 0x71249536698F4, 0x4355F723DAE8D, 0x10756AB9CEB84, 0x3DD06993DB856, 0x538427BB273FF, 0x713D55E7E44C2, 0x7F5771D05B126, 0x3186AB23CB451, 0x41FB31DF0458B, 0x000170AA18E79 },
+    { 0x62E8D9DD41659, 0x2F9A004E1B5C2, 0x0896829DE1C39, 0x32F365597FE4F, 0x47AF6D3A333AF, 0x774A6C15813C7, 0x4AA172E8C42A0, 0x5DFD385A458CD, 0x621BDD2859E95, 0x4924663118B6A, 0x03DD1F728D9EC, 0x34BFE560813A4, 0x2C65D7A28C77E, 0x5BDD547896C1C, 0x000402ABA8C25 },
+    { 0x5FFFD4EE57726, 0x2ED874DF1A66F, 0x0365F278390A2, 0x4C0389232D7B6, 0x6EAD0BD6EB291, 0x7D27BEFA24DAE, 0x69C427E9B424B, 0x11AFC4FAA196F, 0x5B1AB154F2A7A, 0x2E8373B4817F9, 0x479048DFAAA19, 0x0F3CD5BBF722B, 0x36F37AC9D23F6, 0x5FFCB70DFE709, 0x00021691EEC57 } },
+  { { 0x74EA196D4817D, 0x2447C01388D2C, 0x6CDD31F01C119, 0x5D3F0CF0A76F5, 0x7CAEC2DE22C7D, 0x5396D36C14483, 0x14E07F0945C1C, 0x7F7B759E41AEA, 0x5D1A51AB74D3E, 0x5F0D91A71CCF5, 0x67E0DC2A50F71, 0x264394E614F70, 0x662600B79B40D, 0x79C0ECD70F9F5, 0x00009F6B5776C },
+    { 0x30F38C4D4A3DD, 0x5CA7F112800D4, 0x452C99476B283, 0x735086025D213, 0x57ADAA954DA87, 0x5F13A5648EEE5, 0x4F891408D20CA, 0x02B70FB410D49, 0x5047DC89B09A8, 0x240CE74FB3608, 0x22255D9F671CC, 0x6C274B02F410C, 0x510C9C66A805C, 0x26EF920B690E3, 0x0000498B7AB59 },
+    { 0x3115DF9022D7F, 0x4B971A9341F31, 0x4373CD863D09F, 0x01160F311A9A6, 0x018B9198BDAD4, 0x6577E7B4719A6, 0x0DAE781C63B5D, 0x37E833FC80E6B, 0x32ED517DE68D4, 0x37241A1445B36, 0x645DC852BF1ED, 0x3D8B16916F005, 0x2F4061277235D, 0x1265CBDC2A6FE, 0x0002F9B82DD69 },
+    { 0x0E19F6D3D4111, 0x09B8AB8EDAB0C, 0x23E4AB7926C6E, 0x171DDA338D797, 0x2991ECAE23224, 0x0B29C16FFA9AE, 0x67B10A32A527E, 0x2D978D17E412E, 0x1F634635B14A2, 0x56F97053BB660, 0x448BB0FB905EA, 0x520227B6FEC81, 0x01666C862732B, 0x71FC4FEAD4A40, 0x00033C31EF01A } },
+  { { 0x08A27A46CC293, 0x4DB028F906ECA, 0x2733147F4B8BB, 0x46AA67BF7EC06, 0x790C6671BA0A4, 0x2E3A8711BFB50, 0x5E5229599E262, 0x5962D8F0851EC, 0x2FDB7C1949719, 0x49730338833F8, 0x1653415FCC60F, 0x537E47124581C, 0x7626574060595, 0x2438FE01E2622, 0x0001DBFF9548A },
+    { 0x4F2EB15801215, 0x536D0D9DF432B, 0x36A36C426DABB, 0x372334E8DFFFB, 0x51BF46479EFB1, 0x0B28920195501, 0x2FB9411FFFA45, 0x46A0C222D2C17, 0x4A6738BDF8B0E, 0x687CFC88A8BA8, 0x5C482AF262E57, 0x637F9E3DC4DC1, 0x3DE5D660E285C, 0x58CBE224E8455, 0x0000DF47F4871 },
+    { 0x28005CCE551B5, 0x5BC350E0707EA, 0x36347C7D38E2A, 0x614EC77758965, 0x588E37CFC9259, 0x753DED5A41613, 0x44CE2583E947B, 0x473FF94CD8891, 0x6EE023554D666, 0x335A26B215B6B, 0x7FC5749674BD0, 0x46D50CE85E90B, 0x648619EE0B5CD, 0x0446D19D046B0, 0x0001F4DF1AC2C },
+    { 0x2842F88488467, 0x51D5AF1D5EC8A, 0x6ACCCA22BF499, 0x1588EA039F97A, 0x219C8D7DD33FE, 0x1AE9CD4E4B6C1, 0x116A04F30ECB8, 0x58E6A15FBCF80, 0x467A82376D319, 0x3AC8337BC2D6A, 0x3E3EA3DAF06F7, 0x514CA622E18C7, 0x5424128C7B19C, 0x50FCB6A3F518C, 0x000346A87EFF6 } },
+  { { 0x09277869619C5, 0x7274C6D70565B, 0x06C92D0B2F4A4, 0x385515C5DA90A, 0x4D9E4A6F2E0A1, 0x0440E42533436, 0x1C29F10EE90CA, 0x59CC4B4CABA9B, 0x5A8CDC68B4DE2, 0x73C2E9C080BEA, 0x60D7EB0608FDC, 0x4262E22EE742F, 0x6DBECE6C7FFEA, 0x1A7C647EBD49D, 0x0003E1E9AF866 },
+    { 0x0DE4CCD113AA9, 0x239E2C0EBE5AB, 0x4DC8346F9CE8B, 0x73A0866802F19, 0x1A855AE99E426, 0x61EBD6D8A369F, 0x0200035016D76, 0x70D88B2DDD28E, 0x53F8C524C956F, 0x504C740B42890, 0x09869E28B7CED, 0x06B8B839AB27E, 0x4478FAD3D036C, 0x12F8A69D9C492, 0x00010E85AE18E },
+    { 0x6DFF89A6EA44F, 0x6C218D048E13F, 0x387676AB6674A, 0x54004CF1D7745, 0x78BF5DC86DF50, 0x7348539A96E91, 0x66A960D81B7DF, 0x34440A4941C4F, 0x5D60CB72DBF7F, 0x5C90B9DD50EDD, 0x3DD5BFD27244A, 0x472401DD8C859, 0x5DFD562969EA3, 0x31402D3EECCD1, 0x00039F2831A2E },
+    { 0x0162EE13C40AD, 0x4E10315C5E85D, 0x252DE705680BF, 0x5BBB82CF527F4, 0x575DFD8040A33, 0x743A1CE5E70E3, 0x5AAB9D20BD97E, 0x1F527FC74D368, 0x708AC0117D9DC, 0x1BF97123240D0, 0x1D01566990B08, 0x1A3074CAFF0C2, 0x7B42741ABCBBD, 0x3C9610AAA4E07, 0x00035B33D059B } },
+  { { 0x7F163AE311558, 0x35D4ACDFF219B, 0x387FB7BDC94A6, 0x103ABD9D93917, 0x797BEDC54219A, 0x1CE27811F03EC, 0x538EB3BFA3CBB, 0x34E2BDE0D5239, 0x74A3A51684D88, 0x4245F201F3E5A, 0x6EFE8E89E2ECD, 0x68BC57901E03B, 0x1E6485C499017, 0x218E26A09C3F0, 0x0004CEAAC0F5D },
+    { 0x327E43E5D7F43, 0x5C0A8375C75F6, 0x49E1268B6F8F7, 0x56EECB24984FD, 0x718181A71FADA, 0x752482DF4E6F7, 0x2FE93B0737C3F, 0x4FCF8CAC3A5F7, 0x37512BE8E5055, 0x5BBD17B067045, 0x65791A410B399, 0x4709DCDB8E5FE, 0x6FC7A4BA21E3E, 0x0EE65B1DDDF95, 0x000167957BB8A },
+    { 0x6FA0A7DD80328, 0x23CC324DFBDE2, 0x2DB3A93597F29, 0x4E40B02E55D8F, 0x32928F804C46A, 0x2490021332036, 0x1F2D6B55809FF, 0x61DED30C74F68, 0x3143BAE7BFBA0, 0x3EB205B140101, 0x76F17B854B4AD, 0x3EB0E9374A06D, 0x71CBF083CD9AB, 0x7F5BBBD20593A, 0x000457DC66AB1 },
+    { 0x2006E4B3348C7, 0x005D9F31E5666, 0x203A2AC077F81, 0x6BCEF3FA5C72E, 0x454C28AF7220E, 0x67BC12CAC4B22, 0x10D8D6978E4AE, 0x3AA4802FD673E, 0x34131951377C5, 0x32641C423E0CB, 0x25A224631139E, 0x1FB1B5DBED4DD, 0x643849425B167, 0x17F625432BE2A, 0x0002603B56FA6 } },
+  { { 0x01DAEDE56C0A3, 0x7892D2B75421F, 0x4BF46D113CBAF, 0x7EE69750F2A71, 0x07B0503C2D8C3, 0x78D4DC48D060D, 0x4CD036E58CF43, 0x3D8D991B17519, 0x1C760B8626AB7, 0x25CB2FC3C3227, 0x3DC3F3A3892D6, 0x1CF6B9BE89E7E, 0x30C4D68CE03D6, 0x2F11CA97099A9, 0x00060E97B4E14 },
+    { 0x70004DC9A23CF, 0x64FBE2B7CB729, 0x5CF93FABBE064, 0x5E75453F74F63, 0x4A18F5844396A, 0x4C62E906132A0, 0x7D97F59EC757D, 0x2E3DE5872A85C, 0x5290790DE0A72, 0x4C4E8D391809A, 0x21ECCEB32CE05, 0x400E15E4156AC, 0x15792FE9BD6CE, 0x5468D20789E5F, 0x0000BB4E9C60A },
+    { 0x16595F6130E57, 0x3953DBEEAAC42, 0x1BA68BFAC914B, 0x5AB45AA0310DC, 0x51E16045ACFE5, 0x068A60FB7F4FF, 0x44A0BF6207695, 0x6FA5EDD61EEFD, 0x5AF0350A78D9A, 0x635075D3FC765, 0x1F82F5ECA9131, 0x433B2BEEA0664, 0x481286F2AFF60, 0x1C38E908C1E2B, 0x0002F0001189C },
+    { 0x719FBBB097109, 0x5726FA8A73ABE, 0x08720D36CC21E, 0x6491D91FBB01F, 0x5FF8933A352A3, 0x0959FE3E9CA7C, 0x1F22490A94360, 0x269EB22AACC88, 0x418587FB90452, 0x5F6D37D7A5DFB, 0x73CDB4C654094, 0x6035C0F5A9287, 0x3E251320A60A4, 0x07F82B88BE774, 0x0004097CCA23B } },
+  { { 0x6FD586942A8E1, 0x6881516B063A6, 0x387CD1C603234, 0x0C30D19CEBEF1, 0x611CEF2B2BF89, 0x3674C784F0B6B, 0x378EF48EE9A78, 0x180F80192EBAA, 0x45ED050556C14, 0x2054B85341754, 0x7980D77F5401B, 0x197F96B4933F5, 0x535D0C7853FAD, 0x37081146D8F83, 0x00013DB924F75 },
+    { 0x3C33ECA38F8D3, 0x6A3FB26E61616, 0x2AD73B1824EFB, 0x6334F9605F517, 0x214C0DA0E8C4E, 0x357E638816C6D, 0x6E2542626F28F, 0x43AE2E32736A0, 0x24ABB2AE6308C, 0x2FA011D3E9C9A, 0x2C455091B8740, 0x30FAF6A73D7FA, 0x463D0ABA6503D, 0x25CBF12481BBD, 0x0001972D9CB31 },
+    { 0x02BA5C09DC283, 0x4084BBB5AC2DA, 0x2650538016E13, 0x036090603A236, 0x40EB326144778, 0x3F7C93AAECABE, 0x5AFCBFB1D87BD, 0x6F8DB2EB9E73A, 0x40B04F3DB4BF4, 0x513CA2D5FE11D, 0x207C721674BAF, 0x3993A6F098485, 0x1407826A536E5, 0x391AB2A64A609, 0x00047B6A94D5A },
+    { 0x4CA355FDD30EF, 0x36386D9D0EA47, 0x11299107660E0, 0x06DE0DC58407D, 0x4A1EF9534FD94, 0x06D7C5D36B2F2, 0x578FCA697D650, 0x4BE98E65865A3, 0x5D98D111C5951, 0x714942F27428B, 0x1D4C83565649B, 0x3830FB816BF19, 0x650CD95B2E8AE, 0x3AA5E78DE952C, 0x000445EF273A8 } },
+  { { 0x5A5CB2CF1C69A, 0x0A9137973F928, 0x11FADBFAB0FE2, 0x4368851C997B9, 0x443A70BCCDFB3, 0x1C30580D7E1E0, 0x215C829465E60, 0x608EC73BE3C62, 0x061CFBAC94DB5, 0x1EC2204DD2C68, 0x3DBAF20B32604, 0x14DA940269D7D, 0x3969188264A39, 0x11A8C00C22328, 0x0002D18A1792C },
+    { 0x7EB315A9AC644, 0x605C44A7E6D0F, 0x56CEA600C4D98, 0x04AC994C4061E, 0x34885DE4166D3, 0x0C129F2B73C16, 0x530D2B1C4945C, 0x443C5A68BBAA5, 0x228CF1116F899, 0x6D033015200F3, 0x7360CB1857A42, 0x2484F37D04344, 0x08590BE532C5F, 0x21AF2EEC13A44, 0x0001EF7D05BA7 },
+    { 0x56D06F9B9C908, 0x47B525B10F651, 0x56B4CA22681B9, 0x59B1FE2FEE0F6, 0x01CDAF496A7F5, 0x17F5F21C7174D, 0x65FE75E36FD51, 0x30B26021FFB93, 0x1FDACB389C7A3, 0x0BD887345FE26, 0x7CF0EECBC5386, 0x198748093A9D2, 0x667D999F6478D, 0x380E77C7C2797, 0x0004B772BAC4F },
+    { 0x1A477F82DE6B6, 0x4A3E8312AEF97, 0x03D986349FEC5, 0x28427919502AF, 0x27902BECD462C, 0x70AA7FB4DAECE, 0x0E274D795B64E, 0x09A0E85083A07, 0x4801C764C9593, 0x25F6568AF9530, 0x10A4CEFD43A1F, 0x1C4E4B2D94B0F, 0x257C77439B3F3, 0x0515B22F11C5D, 0x0004F2D7BE17D } },
+  { { 0x578889583E3B4, 0x4E93AD0F3AFA2, 0x719077565CDDE, 0x00C074A9900F7, 0x45E114B50768B, 0x5E26AB15ED14B, 0x7B3FE859B1B10, 0x5FE06126FA53B, 0x0A15A0A2267EA, 0x3B4040900255C, 0x6CFCD909C39EA, 0x6A48E1F44A4FB, 0x7DB517AB3BE43, 0x5027369E19DF0, 0x0000E6E3F69EC },
+    { 0x4839D34C24ECF, 0x34D233FE3B17D, 0x75436DA4075D8, 0x4A3726725EB6C, 0x696BB530DB96B, 0x05B6D685B2F4F, 0x36B0C8C153FC4, 0x18C2E8B7D0E2F, 0x5860D4B524BAA, 0x54E6114FA334A, 0x38B420FD3E836, 0x5BDDECEA1B611, 0x18B72824E6463, 0x45776F09EF056, 0x0002321AF6838 },
+    { 0x21774E0A59A6E, 0x20D5A32469989, 0x50A34C450F044, 0x436BBF8879A4B, 0x676F86A2CAF9F, 0x2E8E98043D387, 0x7FC087A6077E5, 0x1B4D7D1A7DB51, 0x026C8AB1C2CFD, 0x2287C84107776, 0x0B59BFC11C377, 0x3979E8B709839, 0x468E355CB601D, 0x11835995939A4, 0x00033046FE05C },
+    { 0x15D3070BE6BD3, 0x65EDDCB3B14BF, 0x5FAD024587006, 0x67EC320025A18, 0x09083E27B5AB5, 0x6C47D50B63B15, 0x0CCE75C7BD9AE, 0x2AC34AF0231B8, 0x339854762AC12, 0x42AE39D8C4EFC, 0x51149CBD27A3C, 0x6BBD23CF9E194, 0x0FFC6242C3181, 0x06031E6D6B161, 0x000440FCC1741 } },
+  { { 0x7CCCA837BFDC4, 0x18F5017F3C76D, 0x2A797FCE70BAE, 0x3FD3462B6D555, 0x7C26F258283A0, 0x46C0096109CA3, 0x462812707DE5C, 0x670BE25A84166, 0x1697CCC8639CD, 0x05A02DEE74C54, 0x7F86256D54634, 0x6773F4F1C9BAF, 0x2D127F20D01E9, 0x6013685480F8E, 0x0004BEA59002D },
+    { 0x1BDE199743F9B, 0x6A260FB4FF06C, 0x31410E541EC8E, 0x7AAABD90AAC2F, 0x5B94441981223, 0x2D524402AE2F3, 0x696DA99EA2E6C, 0x3107D7FA9E69F, 0x223548C7B9FA6, 0x42B05EC1C817D, 0x5D2D1EDBFFB6D, 0x56616C6F6E156, 0x105CF8F88359B, 0x0BF888B7F3500, 0x0001FA3CA21F6 },
+    { 0x07C7DBD7D4B80, 0x47C63B6B46BCB, 0x7CBFF48E3F82B, 0x21F772DBE8ECC, 0x1E2D6EC38EDD6, 0x612692576B782, 0x5D65F14CABD4C, 0x0B8F15A488DAF, 0x0E360DB393840, 0x4FCC1DE706662, 0x389116E5BDAE1, 0x1C70A2F28D106, 0x2751D0B60C98D, 0x1E8D7EB515102, 0x0002747CD7C3A },
+    { 0x7FE74C2D38D5B, 0x4C06570FECC14, 0x5E0383ACA866C, 0x2C685376AE09E, 0x455F97EE342AD, 0x0D5DEFF2E96B4, 0x04444974AD0DA, 0x522BC8A95FF96, 0x0006A6077BE98, 0x7E0FB4EC80804, 0x229D1C4239D4A, 0x0A400F6D2652C, 0x2D4D71799B027, 0x1B78BD8E839AF, 0x000313F605FC5 } },
+  { { 0x5883A403C1548, 0x66740690E4358, 0x07A052E61BB73, 0x498964C4D520E, 0x1CF78158A0C54, 0x07AF05B1840BF, 0x750F7BCCE9670, 0x26E20D2632E92, 0x04B54A636D39E, 0x49E9C7D21548B, 0x5CFD5FBA21079, 0x588BDE43327C6, 0x2FCEF992FBF13, 0x4999DFE6EE977, 0x0002053B94C6A },
+    { 0x3E4E446EE4CB1, 0x5085166CED8AF, 0x020D60BA65A0D, 0x0B895E5CD3133, 0x3E476D4068C02, 0x5C33FF3A6B6EE, 0x505DEA5EBE48C, 0x210B39910D000, 0x27532CD6CCF88, 0x2AD109BF9EDA9, 0x47CC17F5A68CF, 0x7EC4DE33A98B2, 0x249EB3DEBB934, 0x6A0930178C8AD, 0x0001747633A97 },
+    { 0x6F4637499CFAC, 0x38ECEDBF9FB39, 0x4C7CCEEFE00D9, 0x07E7CE5A4F2B4, 0x7080D2B7064C4, 0x7B64E3F5ACF02, 0x679A9DB44D82D, 0x2172F295C13FB, 0x7C1ED29DA2A99, 0x4EECBE6DC6559, 0x3C3D9C0F63D3D, 0x787F7882D0C7F, 0x728FB209181B1, 0x264E2EF1D867C, 0x000492C029C27 },
+    { 0x69A93FD9310B7, 0x3D2005EC98636, 0x2E869D61DAC84, 0x1D87695544FB7, 0x527ED362BBF3E, 0x017AD9D2C3E80, 0x118E12107F639, 0x372E4877949A3, 0x55BE09FCC5231, 0x116A7041207E6, 0x7658A4558F8BD, 0x15AF209F883EE, 0x4659B70361C9E, 0x7F2454777321C, 0x0003AEBEEDE5F } },
+  { { 0x3881CDA3E136F, 0x381D9A82B837A, 0x1B18731D803FE, 0x24695304160C4, 0x29917F3363C40, 0x4EBAE3E043CE5, 0x25B6957D6E5F5, 0x14A0C2678E1F5, 0x2A56A890D5B45, 0x4E55ACC0B83EB, 0x3480A1A4C4DB9, 0x07D1D91CF0712, 0x077F42C450769, 0x5460ADA68B80F, 0x0002E2D54CDA7 },
+    { 0x180D455C79185, 0x3D23078B590CC, 0x55A40ABA44B84, 0x55E7AA270E498, 0x79FBE5DC567C9, 0x12C0DF026D665, 0x2DF3D26EF5B5A, 0x3595703343B91, 0x1637189DA56BF, 0x14D5E89E2BE04, 0x611D2EF0DA33A, 0x2C001245EFAF6, 0x3E7F603E6486B, 0x5F822C928CA7E, 0x00020F58BC258 },
+    { 0x6CC83E8A252A9, 0x226DC16A36A1F, 0x454507E8E54C0, 0x58708539838CA, 0x28B8768D72D0F, 0x1F1B4FC77A044, 0x3647933D777F5, 0x115CCF034FDD1, 0x753D8B3DB309C, 0x15FF504DC197A, 0x4F39FF49350A7, 0x1E80A0736C4D1, 0x41B5F1D1A3796, 0x3498150757A90, 0x000333D6F662E },
+    { 0x3D10FFF5F0A61, 0x2D0D89221DBC7, 0x60CC2CF82D495, 0x09EA95E51B59A, 0x16DFD5B4696C8, 0x2A17CF3C7B2AD, 0x74C92B67E82B2, 0x308210EEDA4E5, 0x2E66C76CE475A, 0x3C50C0000EAEB, 0x7C1D330C44243, 0x07BF3751C7C96, 0x7FFADE5D2BA5C, 0x7F40166BCF1D0, 0x000444D000A3A } },
+  { { 0x2055BFBAA2CDF, 0x57A7304F6A466, 0x72FF68193CD26, 0x473AD686D4FC3, 0x107EC23D7AF7A, 0x465C0A2D494A7, 0x7BA325680356A, 0x3A622ABA2EC11, 0x732B744787CE2, 0x4ECE1063C7BF6, 0x010F44E642D6A, 0x2B1ED6D87EA86, 0x6C60FABF60CC6, 0x6141B622029CC, 0x0004B33650536 },
+    { 0x0534FB5CF407C, 0x1B026CEEC5B45, 0x352F296359D76, 0x139CDE8F35CAF, 0x3AEFF6E9C2D16, 0x2F3154796E916, 0x1A08C2F67B3A2, 0x14E40CDE2CA64, 0x2CC1679BD1D73, 0x240C98F519422, 0x3E460FD357E75, 0x386625F918A60, 0x72E6BFB524B88, 0x30213398508BE, 0x000217B1F78C5 },
+    { 0x5FD68CFF749A9, 0x7CA814277AC38, 0x4C0CF0D40D72E, 0x6EDAD0C2AC7A7, 0x03B28F49A0E48, 0x632DABC3097D4, 0x2A0D8FE299A22, 0x1772751415CAA, 0x5D6399EFA070C, 0x613551D53B5D1, 0x27BA9180D6938, 0x2E0BEED69C74D, 0x5183071F83D8A, 0x0C7C6AB237DF8, 0x00015E3886A8C },
+    { 0x247117E60986A, 0x0A0CB7C1CF137, 0x59FEDC10ACC18, 0x386A262CD8FD4, 0x5BB9065AC7DC3, 0x3A074F5301BCD, 0x59199754CBD31, 0x7891B50B00DE0, 0x1B495FFD5ABC9, 0x693AAA83E2D40, 0x401625389EA05, 0x6B458C4133057, 0x5D5EE77F19862, 0x7A73B85D434AD, 0x0003E17A547EF } },
+  { { 0x5CF9B37F8B0AD, 0x31EAFE9F61B99, 0x4704A6BEC750A, 0x0D531933DD0FC, 0x2A16F2892B3D9, 0x7584F4F07852A, 0x7A605116482F8, 0x1161A3969BD37, 0x2CADCBC92BB00, 0x1D315E95AF5D5, 0x61E40B233512F, 0x7210975A3241A, 0x6406C5DF0DFB2, 0x75B0DA91D618D, 0x00024B07CC742 },
+    { 0x6033A2118B310, 0x1F64295046700, 0x4A6BE7CF66FC5, 0x3372339414E43, 0x38D8AD86B0849, 0x18E2A13F0B563, 0x42712BF032A35, 0x69E06595D5CB4, 0x025143A517D10, 0x14D99A660515F, 0x405A816F3C453, 0x6258123B3D027, 0x3A06FFB6CDDCC, 0x42D6C0192E792, 0x0001DAADE9256 },
+    { 0x6405F65F5231B, 0x3F0748E08CB94, 0x3812129E77498, 0x55077C98F448F, 0x747A72A945772, 0x519FB84373E21, 0x1E8D171C30D6B, 0x0BE477070B317, 0x4C0B485F20290, 0x4BFCEA991BC16, 0x2B7064CAF422D, 0x24AAEE8B7F624, 0x18B603E6D277A, 0x4008DB6F19A6F, 0x0001CFBA4E5B0 },
+    { 0x7FBDF7FC48746, 0x2D41206ADB7D9, 0x6B90CCDD09395, 0x4C6E2F2B203AD, 0x604D077A19ABF, 0x20E0A9CCD6D0B, 0x1C17A0B118C08, 0x2DC5AF7A9DC7B, 0x3117D082A43D4, 0x41B0C76C709EF, 0x7B1AB4133E287, 0x6FF52D7FA6427, 0x7B282C934C560, 0x5A63A9175787D, 0x000211DFF1CC6 } },
+  { { 0x7779DD40C96E5, 0x276D4DEFD8B9A, 0x76464387CC6B9, 0x202FE141D5E9E, 0x44F61F28A499C, 0x772263BAFFDB6, 0x4F823CF0B252B, 0x5243090D9B150, 0x071D0DF368D8F, 0x028A8A453DDF6, 0x414491043CF2A, 0x731F649015726, 0x652431E367C49, 0x2DEA0E902AF97, 0x0001E3B0B217C },
+    { 0x1C399755C38BE, 0x5F254E2008119, 0x72080CCDF6312, 0x5E64B5BF69A73, 0x6F056C9EA62D8, 0x4F4E7968CAC8E, 0x2B6CBA3A68D1E, 0x0A7ED6B599F25, 0x458FF30CD2A50, 0x0A65D078392BC, 0x36A112F6D424C, 0x03768D3937CE9, 0x6E538963B95D3, 0x766D36D683905, 0x000162DF82F49 },
+    { 0x6606DA884A361, 0x62588773B2A47, 0x215B3E4C0B1A0, 0x2895759A23F2E, 0x3A13B77CCBA03, 0x7C3F9E06E18E4, 0x622BABC268FB6, 0x6BBD9B2BAE6D9, 0x0462ED3EB156F, 0x5C04D80C18C69, 0x1AD08B068B5A1, 0x0D531426AD184, 0x650530617E812, 0x2460182D98634, 0x0002018C40F61 },
+    { 0x65F3A20561D3C, 0x04F9D949E5CF6, 0x3729DFF68DEFF, 0x3335F38F92BEC, 0x6F1AE8170544B, 0x6B995F5AA8B39, 0x0B4655F2BA5F3, 0x155B7B30E8460, 0x43C8EEC6FF567, 0x586E84285247D, 0x41EC44CF80D33, 0x50383B6894DB2, 0x4FEC80038C556, 0x54F27FAF9ED53, 0x00030AEC26372 } },
+  { { 0x7E503CEB1BCF8, 0x03542212D4221, 0x293E4F5B2043F, 0x1B4302012D695, 0x6B40E71CCB2FA, 0x207512417CD83, 0x6BF30C03B1F55, 0x2FFC5EEDE2ABA, 0x0E1E41802A7A5, 0x43524D55F51D5, 0x6FFB619A03877, 0x068411B291208, 0x547D177ADB326, 0x4D49F686304F8, 0x00037FE6000F5 },
+    { 0x276C5F6E9C688, 0x41D01E6B924A6, 0x3AC312760C57B, 0x042E8BB351958, 0x5F2CD1BADA40A, 0x5F6A8028D572D, 0x7AB267F1B881D, 0x46CC3E0FAAF86, 0x693DE0FCD738A, 0x56A467F2B68A0, 0x052F58F687796, 0x2F64FF9AD7BB9, 0x47E2533F39DFA, 0x77FE57288AE66, 0x00028080C702F },
+    { 0x252FA82DCC752, 0x670A7CA18EE53, 0x20B56A6E34B49, 0x586C62B10C2D1, 0x0A92A5A43CC32, 0x3697989430290, 0x7435F440B1E70, 0x12615A3205E99, 0x62B199F68FA1B, 0x6E52C594D1C4B, 0x16F85B6D2A71C, 0x096ADD89F7538, 0x564D7DB00D5CE, 0x227BDB326E297, 0x00011FA042BB9 },
+    { 0x33AF708BC147C, 0x23378378402E6, 0x7AB2CFF572538, 0x52CD329C009D8, 0x1E4488A703BAE, 0x09E285386F752, 0x62A8873A5FBCB, 0x0A2C2B27E7EBE, 0x35F627A7E4DED, 0x6A3EF148FFE52, 0x716B657326C40, 0x674F8A5C35A96, 0x5AA06AB9E7AB0, 0x0BD80EA65A9A1, 0x0002FD8ECB2F5 } },
+  { { 0x6AEAF5C21DB02, 0x3C948364938AB, 0x479D187D9392B, 0x3EE4BDBFA6BE0, 0x48C681D2BC100, 0x124B042A36884, 0x624294C6AAE6E, 0x579F99E1D55EB, 0x3E3BC169F2774, 0x1452AEDDDC2B4, 0x093D59203029D, 0x2D85C8A7860F7, 0x034D20BB1EF28, 0x26CD47F6AD80D, 0x00064A53ED607 },
+    { 0x7A2F915FAF174, 0x302086C0188A8, 0x010415C032F94, 0x1094487FC9B9D, 0x1EEF1748721A8, 0x78E6BA3B1EAF9, 0x7FFB161C1641E, 0x3335B055DF7CD, 0x575AD371FA220, 0x71B80B397AD12, 0x7A1C40D5162F8, 0x51173FB563076, 0x62F88482C29CD, 0x2D11164885C87, 0x0001AC0FF799E },
+    { 0x7CBED47E85324, 0x4B34B2CDB6F75, 0x5E0042978B8C1, 0x3FAB784372161, 0x2003C68BEAEF4, 0x323B7B1484511, 0x275D16A422E5D, 0x17A9DD636053D, 0x44154F4B8D599, 0x7580CC7EB6DA2, 0x1E8E28A8834C7, 0x0893E0A026832, 0x5F3B7FC50E3E0, 0x0DA90FD177D99, 0x00038D5B88FB4 },
+    { 0x726A56ECCAF2A, 0x4EF63F20C97D3, 0x3DB2C5F8EAEF8, 0x12C005DD9ADE0, 0x5B2DC0F0E9311, 0x22F2256063EBB, 0x71915633EC8AA, 0x616FDD8292F2C, 0x110051D848B34, 0x6DC510C561499, 0x55AE1AFCAE73A, 0x765E5A6F163FA, 0x614EADC93CCDD, 0x350463E44D06F, 0x00048D9730329 } },
+  { { 0x155778BBBBAE1, 0x7F6FEC05E7D5B, 0x3A44263DD7973, 0x745E435D1F065, 0x60124AA61F6F9, 0x2B58A33712276, 0x3C5D888C9B0E9, 0x64F3683D8AFB4, 0x7D4F55E5AEFD6, 0x69556EBDBE18C, 0x65491C8FB0FD1, 0x3F4F37AB3D912, 0x49A987FEBAE39, 0x31A431C425A6C, 0x0002DDF23D510 },
+    { 0x0E3DB5D58EBA7, 0x3343961EEE401, 0x332F6A95D93D5, 0x5FF410594DDB7, 0x7432E99892CB5, 0x6EB03235DB59D, 0x4206606AE943C, 0x5EEBCC47313A3, 0x3B0A0092303B8, 0x214A5CCE2F71F, 0x49300E75D8CA0, 0x657EFF961A491, 0x2B7BBA3143745, 0x6D53FBDC657DD, 0x0001BDAA41AD8 },
+    { 0x35A4977797E3D, 0x5791989FBCA71, 0x06EC66592A3F1, 0x1206D69C80584, 0x31F15C42165C9, 0x7B17B5B46C02A, 0x466D0441E224E, 0x00D347C97FD42, 0x1A7D7FE102DD9, 0x1705D4FD11B88, 0x4D605E6F79F96, 0x7041FA6ED7323, 0x53577988B8563, 0x2DCBB49BCC134, 0x00059A8C65375 },
+    { 0x2F3AB6D81C2A7, 0x510B4383D46E7, 0x47C620CDFC626, 0x767F073FC584E, 0x1B8F769AAA9C6, 0x5B014DE77BE36, 0x3E6928E8527E9, 0x1B33D441F6335, 0x43B896493F7DF, 0x56835CBB74845, 0x5E0C825D6F685, 0x73ADF537D28B6, 0x75F4E5C3C8754, 0x59F9CA7F62040, 0x00050C78ADA64 } },
+  { { 0x14453C79B067B, 0x2AD79AD29964B, 0x6D4BF339B1CFA, 0x348E346686283, 0x769061A167D49, 0x1976BB4297FD3, 0x3A3CDB287B811, 0x6CF3B84BD8D6E, 0x7A99C1CEA1E1F, 0x16A8D0CDAA90A, 0x0B1CAF51FF9AD, 0x4E947F89B23EC, 0x1931DABEC2618, 0x55323BC46A301, 0x00050C12CFAD7 },
+    { 0x54010D342726B, 0x76155EFCD99AC, 0x07CEC964A02DB, 0x23EBC60C8CAF1, 0x3488823653B53, 0x6B58F0D532CA4, 0x3D71F902431D2, 0x37D9FF07B46BB, 0x2EE434F58A27A, 0x063445245D7EE, 0x2EFEE74601EC8, 0x4FAE498F92AAE, 0x1BA676904B4C5, 0x2D6E18276470B, 0x0002418E4085F },
+    { 0x51AD5F47CF0DB, 0x73E364706CCE2, 0x1FEA0A23A168A, 0x7C7FC3FC87907, 0x238A38DA868F8, 0x7336E5DC068D8, 0x0895EBDF8372C, 0x69D69E9844D36, 0x2FC70E817B364, 0x50D9599D32EC3, 0x14CA86B8FD14C, 0x7EE1E74F5A4B6, 0x529303EFFAE6F, 0x6E653E1B29D31, 0x00041580BEE8D },
+    { 0x2BDB9983078C9, 0x0E41703D188BA, 0x3DA1968460209, 0x55472F88BE598, 0x40C26FA31B0B4, 0x66A94FE424267, 0x1C58EF527ED3F, 0x293EEEB25521A, 0x09C3FB3188DB7, 0x2F0FC5BA14625, 0x364A214C49B22, 0x26B8A7AF8EC88, 0x350D4EA73506D, 0x1C033AAB8D335, 0x00031D0D4479B } },
+  { { 0x56B1203368C3A, 0x299199879B885, 0x4F612B878CA26, 0x703C591A11659, 0x31E5F38AB167E, 0x62F3AF2B6A522, 0x6C80EBF04E866, 0x27E1290C5D1F1, 0x6CAA24A3CD945, 0x7FB64A83D4656, 0x087828ECC8346, 0x21B11EF7D3EE0, 0x73148AA6EF263, 0x6BA9EE20705D8, 0x000660EE241C4 },
+    { 0x0FDF963F6D82C, 0x549507A3D1E2C, 0x4543271BDE7F9, 0x178EDA5801FF5, 0x4DABD1DA4581D, 0x5363772A7BC7B, 0x60889A8E1103B, 0x07A5EDD16CB5E, 0x2D54DA96F5C56, 0x48479946509A5, 0x40A7AA3BDBAC3, 0x292D808A509DC, 0x719CA9A5566C2, 0x7238152413B77, 0x00008987A074B },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x7BDD52178CDDE, 0x7A2AB544E1EC7, 0x58D424CEC05C5, 0x0D642F2256CED, 0x65C9D47B43E49, 0x744B272567AD7, 0x309C66C3F2FCE, 0x05D9697FA0BE5, 0x57B51D9906045, 0x548B6729D26C8, 0x74BC919AF9C0E, 0x275BD136CD709, 0x2AD2811EF0682, 0x34058AF42B3FE, 0x00021415956FA },
+    { 0x1A4C087D217CA, 0x5366951463DEF, 0x7E29596B6DF5D, 0x443680B8F34F7, 0x12D962EA6113F, 0x5ECBA1095856B, 0x65C2D4F87A090, 0x2381E5D6F7133, 0x673EDE37FBF09, 0x25899AAC98784, 0x2F8A295E401CB, 0x25D8EEF91840F, 0x4EBDD7C1E936A, 0x09E9818FB2070, 0x0001FF58FBB9A },
+    { 0x0422ADE87321E, 0x05D54ABB1E138, 0x272BDB313FA3A, 0x729BD0DDA9312, 0x1A362B84BC1B6, 0x0BB4D8DA98528, 0x4F63993C0D031, 0x6B17E85DBF41A, 0x4603DD8C9B4E2, 0x002171A6CD51D, 0x23AB4550EEB5F, 0x643A79B233993, 0x409F18F69A6BE, 0x5A017E54248BF, 0x0004EA47BEAFC },
+    { 0x65B3F782DE832, 0x2C996AEB9C210, 0x01D6A694920A2, 0x3BC97F470CB08, 0x6D269D159EEC0, 0x21345EF6A7A94, 0x1A3D2B0785F6F, 0x4D6F6C0668ECC, 0x367A1CEDA561E, 0x2F233E2407461, 0x68DDAD8DA85A2, 0x65BD5BEFE8C8D, 0x1CB3C253A19D6, 0x041D87B89DC4D, 0x0004FF045865D } }
+};
+
+static const uint64_t ladder_table_B[OBOB_BITS-1][4][NWORDS] = {
+  { { 0x7967F4A646B9D, 0x53DE817BB8239, 0x7237E1C6B3E72, 0x5F1EFDDC2C8BC, 0x610B0FF5C6221, 0x6091BE88AC162, 0x66482D2EDEEB5, 0x7059B9B7A2C3A, 0x4E90352EC35CA, 0x650177EBE65B9, 0x2E497B1F7251C, 0x4F6E7022DB82A, 0x66EBC7A5D95C0, 0x1AAE095334FA0, 0x0001426F7DCDA },
+    { 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000 },
+    { 0x7967F4A63D931, 0x53DE817BB8239, 0x7237E1C6B3E72, 0x5F1EFDDC2C8BC, 0x610B0FF5C6221, 0x6091BE88AC162, 0x66482D2EDEEB5, 0x41F96C40C2C3A, 0x50E18FA70A0B4, 0x782614B364A7B, 0x0F61C8A5E9052, 0x75F68F5BDE234, 0x6E5F1A36BA36B, 0x163ED354308C9, 0x000264C5D8D6A },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x3D48E165D4C5B, 0x058F0A494BF30, 0x0AA319A8291FC, 0x61E33839534E0, 0x3530405E2304C, 0x1ED7636210604, 0x6D12F1AA8433D, 0x22190A499F5B7, 0x285CA94420080, 0x49B89338ACD64, 0x72A7EE356F464, 0x0AA95BE47A005, 0x400181048FB16, 0x5214823E6F9B4, 0x00023A18C4F79 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x43FAE2CF76BCF, 0x584A2E79CDC85, 0x66A5523C61168, 0x66E8194C5439A, 0x129E0218C2A9E, 0x380D9A6A9DD4B, 0x688B51E70D464, 0x18B44C23132B2, 0x5A3DD8FBBA756, 0x36B1B978A499E, 0x3E954D8924905, 0x1E4BD74D65069, 0x4481EA87FED9B, 0x5880AE78098E9, 0x00037759AA9EB },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x17B40E19EFC74, 0x20AB28D33BFB0, 0x171BE79B86555, 0x47FE542CAA38B, 0x55897BA0B55FD, 0x0A8C9B4268262, 0x29CB7C02DC151, 0x41A44DD1414E7, 0x124E06BA72743, 0x0065E75C871DC, 0x5BADF01B0B710, 0x644FA24B71490, 0x071FD8419C6A0, 0x7CD6F6FA120B8, 0x000555D454571 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x6ADFE2BB9A9F2, 0x7194BFAEA6EC3, 0x018633B2A423B, 0x26F372DFA4471, 0x0F5954C7A1812, 0x143191AD2C9E2, 0x494C250057B2E, 0x7E65E0BCB2F7E, 0x05656B1300008, 0x2C4AA13931041, 0x53A1A7C498E44, 0x7484C529EDC66, 0x222D03EE8C1E6, 0x671B340BBF265, 0x0001FD6432B31 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x551AD9A964C0A, 0x21D779FB0CAB2, 0x370D0BBCEDDE7, 0x39583DC80942A, 0x77DEEC4BF19D8, 0x75B7EAC01B418, 0x7DA63898E1192, 0x31B975F8A777D, 0x4C1106C259555, 0x2D29B90B8559A, 0x26682C0E71B5F, 0x643A843295F58, 0x516546895E58C, 0x0C675F635E89A, 0x0004C0B964C97 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x2BC586B608B44, 0x7189B0CF7C01D, 0x72C81872CE264, 0x51E96B1E6B093, 0x260E69F7468CA, 0x230E08F5D9F22, 0x6113229098C15, 0x47F229FAA7654, 0x2EDF1B5E2B3E1, 0x38DDD14F24B06, 0x6C870B1F88966, 0x47E34B590CBFE, 0x72186B0613A21, 0x4E590C01302F0, 0x00026247BE357 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x6DFACD9277F11, 0x539F800BA094E, 0x364DF14B7A502, 0x234614C51F329, 0x1C32336BDAC86, 0x33333403D715D, 0x059B8A9308431, 0x00D46199C0A24, 0x0F62B3CAB2C64, 0x7686879DF6319, 0x3FF3F375F1330, 0x78B0E558C6A03, 0x3C7433ABAFBAF, 0x004F9BF2106D9, 0x0004FB12F3388 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x7F4F172824A7B, 0x49DECC95CB776, 0x0969D4EFFBBBF, 0x5B947D149999F, 0x5626F3666AF96, 0x49A4C12F34AEF, 0x683368402FE2E, 0x2C3FFD73867DA, 0x0ED821EBE0DF5, 0x1D599D44E1C50, 0x7FE3EB1DBDC83, 0x25FEF48286B1B, 0x689AC32D3EE4A, 0x613FB36FDDBDE, 0x00031773DC7D4 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x63A300095FEC3, 0x4699C0D8478B9, 0x2B3D847E6C3DF, 0x3427748FAFC87, 0x0E2848B0259BB, 0x640514C386F2F, 0x7748A32AD7EEB, 0x7C114E948BF1B, 0x5224644FF7158, 0x36FD9D98CE7D3, 0x6152C81467796, 0x6A5A38A1D7468, 0x4A6B5C8BAC307, 0x2A18BAF9E5AD7, 0x00064340BF8E3 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x7C0BA72F733A7, 0x511ECEE4844DE, 0x0650849473EF3, 0x17B484D5C9B3E, 0x15BD4F4EAB874, 0x1806C02AF76FF, 0x1A3FE73F350A1, 0x6F9EBC7C6E6A5, 0x6256B01E434F7, 0x66F480C108C59, 0x248BBB56B42A2, 0x5FF177581B4BF, 0x6A119E25B6345, 0x55956A7C5E9C6, 0x000391886E5DD },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x44A5CA8D0368B, 0x2B3BDD4379653, 0x0BBAB033BAA56, 0x234BC96ACBC59, 0x2C45D1A245A2B, 0x560508F4C3A81, 0x0FBCB000F4217, 0x454792990E17F, 0x04D93A245D73C, 0x40E48237E821D, 0x1612A5F0639B1, 0x45E8393D4D367, 0x4D556FA909DD1, 0x303341D9F4D41, 0x0004CA1F61DCE },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x54A3C1BFFFE11, 0x56762C967E137, 0x59D10B62E265C, 0x3C3EAD12B0905, 0x59C6B39DB3CAD, 0x483B95685BFB6, 0x0791089E00EA9, 0x179C6EA6D995A, 0x0C98DDD8CEB41, 0x20572101E1448, 0x50A8A94EA047D, 0x27FE8E63AEAAD, 0x5FBA392DE7F6F, 0x73D9395217C36, 0x0003EF817B1B2 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x637B5A65695A3, 0x0D8FB56F29067, 0x3AC95A3347179, 0x7674264A87437, 0x60A7533A36B64, 0x6B7B602A84163, 0x6C40C1D3667F8, 0x66D5143C4F213, 0x5516D27F4899D, 0x07677467AF629, 0x50D332BE8DF4F, 0x77726CEB6D242, 0x0002F630FCE43, 0x42D821F8BA5B2, 0x00052BAA1EB53 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x541736060240B, 0x325F21C1A00CF, 0x531A01DF8AB1B, 0x1F81ACDB49779, 0x777D5EE2FD112, 0x7FE221E3BD968, 0x6CBFAEB05298B, 0x394F0DBCB56D1, 0x6449D8E3AD585, 0x65CC8AC572476, 0x3E4824114581A, 0x23ACD2F8FDFD0, 0x24286E7A4BD3C, 0x23F33EBA28FC8, 0x0004BF3936BDC },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x66A7739BC6B43, 0x64B8893C3ECE2, 0x30410FBE159E8, 0x332DEB1AC5BA6, 0x3EAB82FF4A10C, 0x562785D0AE3B3, 0x3385296FF6084, 0x4BE554CD99FBF, 0x4B4BC1E20E8EE, 0x536C78EAB4A07, 0x55B351D8D2D55, 0x4075681459D52, 0x1D48821E6C387, 0x5DFFC18085519, 0x0004F77B58C21 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x1B6D7E435012F, 0x7BE8E9547B41B, 0x46DB032B80149, 0x5CBDB71C3A37C, 0x61DA8EE4089CA, 0x256AE8769EA8C, 0x307062F69AEA3, 0x69B463707154A, 0x7B2484705D7FE, 0x00A29CABB0346, 0x778942FFE2279, 0x0936EF5F20287, 0x671C7F38C4C9B, 0x22A9C7D0590A1, 0x0003B1D61CA49 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x19A9CE90F95DE, 0x5926DE67BA861, 0x5CFA1A040B506, 0x29BFDCFF67B43, 0x3B4369E375C0F, 0x2CD924FF8E93E, 0x3C48EA6A8DA1F, 0x47E730A6109DD, 0x374DB9EA24290, 0x67CA32F3FCCEA, 0x119543946F86E, 0x2D5A234EB9E8C, 0x0E2423C755B49, 0x66428D68E1353, 0x0004BA1DA7515 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x51D3B42B481B2, 0x1D2A44A9427BA, 0x2B0E5787F48B9, 0x3A95F99D9FB01, 0x581CD9EA94A08, 0x2E38A450730AC, 0x54EA05EDD2617, 0x77F32BF5F32BC, 0x5743A16B51182, 0x3A92C6B179039, 0x6804563E46523, 0x206C7A4C6E7AF, 0x16D78C261DF4F, 0x0252FE7122B32, 0x000281A18AAE1 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x7EA6934E8D0F5, 0x742A1BDBA344D, 0x60AD18E437D65, 0x5298CB8CA3FB1, 0x2B9CCD7708C4E, 0x5296F098D0E0B, 0x461BEAF02C71F, 0x24B3B24ADE172, 0x3D1165B1BEFB1, 0x103A35196616B, 0x6289475657E91, 0x78ADC1B65EA55, 0x4671C4E5D3475, 0x53EBDD63A7B5B, 0x0004FD139D066 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x07325F625597B, 0x0C0118B583672, 0x4CFADB2474EF1, 0x46700E37494C6, 0x35ED8EAA2D555, 0x68C623243B6D9, 0x375ADD8436EE2, 0x04C4AB1F51F5A, 0x227DA943B6DDA, 0x63199E591699A, 0x02A1FD62FF947, 0x64FD066AB2420, 0x205EF55B823B4, 0x415682943A515, 0x0002099E857C4 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x74E1F7B1B0D52, 0x3BC2B958613B0, 0x7D548DF2FE77E, 0x74B8F42FD9301, 0x0CA23E4F8F62C, 0x6B4A645882B5B, 0x206C820D32102, 0x34568999DCA6D, 0x71A9208BA0998, 0x3CF88B7C9660E, 0x1F18E5D7CE0CD, 0x53BEF6FDCEEAF, 0x245888E1AF4D8, 0x1E6FB7F2719EA, 0x0004293627519 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x60BFE1FF0D5D4, 0x0F37AE38F25EF, 0x6C4DE3B37F213, 0x4873B63DA9AC8, 0x1B097A0783C14, 0x6DDAD7BD9D4F7, 0x4EE7EC7167ECA, 0x693E16E9E8420, 0x25E45D240556A, 0x78D6346069FE5, 0x7A2794B65797A, 0x7A140CD58CFD4, 0x3C5DB1876FA66, 0x77C28067497A3, 0x00032F97452DF },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x333795C3FA2F2, 0x1923419D78FDD, 0x40F7D5D528273, 0x557E85AC901A4, 0x2BD4951927490, 0x091628FD89A46, 0x5236562FA1535, 0x02451CC55C960, 0x7E3FFD0BD64B8, 0x0A48BD7771DA3, 0x11CD0893A13F5, 0x6646C53D4B30A, 0x4C7A865F4C797, 0x7121AD2A2CE62, 0x0004D1CBDAC5C },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x6DC130929FB28, 0x3AA3BEA9E15CA, 0x502C6B1F16D32, 0x2BFA1819FA7CB, 0x62890EB22792A, 0x57B4E55068FC2, 0x4ECB8E1AAC5ED, 0x47DE69433B71A, 0x71C700912428D, 0x3B6C2C72769FF, 0x423FED1E57598, 0x0F701F795A510, 0x0A86DDBDA9EDF, 0x78423353333BB, 0x000363F20C570 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x2B62CC7E0DFBC, 0x28B0010B15B39, 0x3950F5AC247DA, 0x1C95766312957, 0x11DEB454F71AB, 0x4B5EFCF9E8235, 0x7638D935CDF19, 0x54CD95D2C96D0, 0x4F2943F2F126B, 0x161AE28CD8BF3, 0x49E3E68E0BC9C, 0x016F18A810DE1, 0x5CECF84DACC67, 0x28BEF69481CBF, 0x0005D5FF22D1A },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x639040A384864, 0x387E07DF37011, 0x6C418E8128577, 0x00CD2B11EF30E, 0x73BEEC788C71C, 0x2CD3DA1E3AC34, 0x2B96EA5E1BD08, 0x18753C9A098A9, 0x7F3B2F384498D, 0x77851CC0FB160, 0x4056A054E87EC, 0x60630877AD87D, 0x4BE00CD7A4A24, 0x192622DCE98DE, 0x0003117B319AE },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x6E2E578F1A422, 0x7DEE68D99EB83, 0x45FA064F86812, 0x296FE6D019652, 0x42E5A0E5EA826, 0x10455A0A018BE, 0x2DBB5AB991075, 0x1E0128F5A3F21, 0x05DA8596C8DA8, 0x4F8D7CC04CD88, 0x15E222FF0BC12, 0x0CB6BEC20C6E7, 0x45ED22B947D98, 0x45D591E41E6F7, 0x00049E0204B64 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x1811531F702FA, 0x3C7BC61874EA0, 0x765AC175B03DE, 0x3E2A02DF4021E, 0x29EB0BC8A2597, 0x74F1EC45926D0, 0x1946752E0C004, 0x563F3C2FCB7CB, 0x2AD7F16C396C9, 0x03D8C7FA880C7, 0x42D7E69549480, 0x70411F07B08C4, 0x5AE34A144C7B9, 0x64017C68DCA36, 0x000300E7F23FE },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x2A18762D70496, 0x5DE28FB1FFD44, 0x328960AF274A4, 0x18540CDCD1F77, 0x623602138E799, 0x6E2FB6B13548E, 0x40E35AACFFC7B, 0x7EEC52F09ABD6, 0x2AA23372707CE, 0x147BAAE5F1BD2, 0x07061B1F6DC6F, 0x005E215454295, 0x3DEE8AB3E4CA2, 0x1E9F0BC2D25F0, 0x00063860A9538 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x3BA87F4737AFC, 0x2E8E89C5B622F, 0x19C8CB161184F, 0x0CBC1ECE86EA9, 0x7939C24158167, 0x0A4B254FE58D2, 0x68ED09FAEE304, 0x5D0E771314BA8, 0x63D24A9B72663, 0x0BD6D5460B573, 0x42DDE1E6AF7F1, 0x3B8D773BE5B36, 0x23F77A16D8C21, 0x67889DA4812FD, 0x0003F3DE6BFA7 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x3E0E06745BBD3, 0x25A422BDD2EB5, 0x7DF6AFB27224C, 0x38E8DB5E1896D, 0x3CE0A57C3665D, 0x0D69D24FF267E, 0x0F31FE8F19D44, 0x1B10A1DB428F6, 0x1BC844F3FD493, 0x44A02ACF9356D, 0x5D9F8E9823FFC, 0x0F13D822BA940, 0x7DD6D817E0279, 0x673A7C1A93106, 0x0004B537A6CFA },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x5027A60664A8D, 0x6AF0645FB5A10, 0x7A14AFCA03E58, 0x4C30E07D94859, 0x5CDE2C8E9973C, 0x3A819DB4E6A26, 0x431CEA8078331, 0x0CB73C181F5FE, 0x0ABA5AC752043, 0x3E487154D0C45, 0x442977467FEC3, 0x6536C86E201A8, 0x33E7C10C78822, 0x636442F350B82, 0x00044A997BD82 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x4EB1363869FD6, 0x569230F3C81B2, 0x64063D3DFC0B9, 0x36168961102DA, 0x4D913A677FEE0, 0x47A6C79726043, 0x6B183D20C029A, 0x3BAA8075AD765, 0x0AFC047831669, 0x2C2F16362D06C, 0x3E1644D59B71F, 0x09E0B3ABD8CA0, 0x2AD51F3046EDF, 0x524B592759F48, 0x0006122DE6EC4 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x17F039713DB9E, 0x4C9D0020D95AF, 0x41A9843B4E19A, 0x16A79357ACC1B, 0x2B42975291C96, 0x22BC9D21D8FDB, 0x4806BC8E26AAE, 0x4737165F4EE8B, 0x4825E5E1E3CD7, 0x3C5AAE41AC1F1, 0x77980BA6143CC, 0x4173CCD5E25B4, 0x2FDD2DAFB829C, 0x5D68FC64EBEFC, 0x0003A68324221 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x7357434ACE599, 0x76C733FA32D9A, 0x5065D37A2D6D8, 0x5D6BC2BA83912, 0x3D74694FCAF41, 0x149C003C3CBBE, 0x16A18782959D0, 0x070ED38DFCA0B, 0x5E3A35976629A, 0x217462FFBB72F, 0x4A886CB5C0313, 0x02115285EB35B, 0x7E31EBB3F5740, 0x02D9EA34CB802, 0x0005718808095 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x684D30D054A1D, 0x6B6B9565E6FD8, 0x5F6D62D3AA7B8, 0x365844205AB3A, 0x0FFA0DAF8CCAB, 0x652A3A9A69D2F, 0x09E06F76882E7, 0x15A2F9522B709, 0x577FECF4B9ED9, 0x5FBDA2FF1591D, 0x3CEEB6C47D415, 0x4AFE42040ED42, 0x120CCCE074E19, 0x7673896C5365C, 0x0003A3C97D925 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x1D6EE9A160D5A, 0x1B103E8B55136, 0x5A1486D5E63AF, 0x0CE07DC9DBE4E, 0x6C63C5D652411, 0x07863BB3A9267, 0x78B7A40F5B2A5, 0x65400896A2FC1, 0x7DFCC926421FE, 0x033CACAFB7647, 0x550FA5FFB1914, 0x23588F34B025A, 0x4FF471A538402, 0x3467AC47D0F26, 0x00064A19EBE2F },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x3172BEE2D37DA, 0x24AED3E80D67F, 0x353F1C2E1D4D1, 0x291D5FE4D18DF, 0x5400A10E7F9EA, 0x138287DBB74F1, 0x38BE9A274C058, 0x2C644C84D8AF7, 0x59CBF2033FD04, 0x03B79813EAB7F, 0x53E59D221C849, 0x2D1E33F34F81A, 0x1B32B7256187D, 0x4BAEFD8B729F4, 0x0003DF3B2D24F },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x69972DB15B3BC, 0x2EA9CC818F894, 0x75CF05FCDF903, 0x7F2D5F99EEFA7, 0x2FD61638F5F41, 0x005AECCC5A503, 0x064E3E24D8BD6, 0x1BF37E51A7D02, 0x0EFBEC89EF7F3, 0x2C8E724049C57, 0x3EFD6DBAD74A1, 0x211DEC10682D5, 0x287FF6FF31DFE, 0x35831AAF616C9, 0x0005684572E43 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x786739EFEEE8C, 0x43FA96142E667, 0x6B78F7611677D, 0x20B130755C933, 0x4137C75068454, 0x3FD7E0DC5B96C, 0x52A0C26F2DFCB, 0x45927AFAB8859, 0x42C0547498B20, 0x64862FB9E6A00, 0x6F4E372146235, 0x434021BEE4C7B, 0x67307A6531320, 0x44F66DAE372C6, 0x0002930A54A6D },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x09533BDC4D1E1, 0x039792D5E61DD, 0x168E0FB212A7D, 0x3A786D6C6A2B1, 0x7075F6F31F77D, 0x4A6B4C8C0E968, 0x19469AC364008, 0x2215B41B08907, 0x57849ED5631CA, 0x6D0FFA97A2180, 0x0B2D13BCC27EC, 0x270DFE20DC4DB, 0x7F89FFA813230, 0x43379ABC5FBB9, 0x00057CD3C6BA8 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x2263EAC4FEF11, 0x6D34DD88CBD28, 0x34A021556463B, 0x2BE36758F34AE, 0x4A0FC0181E0A8, 0x5D2894BF46130, 0x487B0E44A3A9B, 0x5C7341E726E13, 0x19BC8EC0AEEAD, 0x25332FEC1F5AA, 0x5B3239ABDE294, 0x1D4FB68191E63, 0x535BDEFE0C15A, 0x73F690BCAE983, 0x0004D79D706B4 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x51CBCB274BF5A, 0x3F5BC19BD053D, 0x76E92DEAC73D7, 0x1FC485E5E627C, 0x341A4782A59D9, 0x08224EBE52B3C, 0x158902FCCD04D, 0x386C578CE066D, 0x1ACD8470D7EFA, 0x14D2A69877B29, 0x2F91AFFAA74D3, 0x5CC9169FC7952, 0x414DDF7634098, 0x503D04F348722, 0x0004BE6B7F569 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x6DDF5064A9DF6, 0x5FFF7BD0B371D, 0x0320A757DC04E, 0x7D8AC60D7BE7A, 0x23B37919A25F0, 0x6E7222F5CEDD0, 0x4AD50D9A815DB, 0x022EA67E7C675, 0x05E5FB95BDEDC, 0x6314B5CF34C9C, 0x3D4C2264E9239, 0x00AE4E674BCDC, 0x10B36F086BBAB, 0x2DDDE072A3ECA, 0x00029331D8637 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x12B5EEE001FE7, 0x07AFFDCE627D0, 0x75F91D3F5F010, 0x101846C3948BA, 0x2F79299EC4C85, 0x04FB85F8D9D5D, 0x5B395C2E48948, 0x70DF4679B02DE, 0x3F28A86070FB2, 0x1272BF4617245, 0x0051D5EC20661, 0x63434A9849D09, 0x0AA94FEAD5264, 0x77991C602FA04, 0x000603CA5499C },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x167AFC0D9F475, 0x62075F8A43D32, 0x06C16598139B9, 0x43D187B2E40B4, 0x7988535F3A730, 0x53C0910B84876, 0x688C8EEEF9ACC, 0x5DE43A5D63833, 0x0C2DACBEB62FB, 0x6C0CACD28A3F3, 0x24ABA3FD172FD, 0x12D494F1D9223, 0x13EA3BFB0FB12, 0x636AE3DE68649, 0x0002DDA03D262 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x34871822F05F3, 0x7EADEE16C4CFA, 0x13386F0306F01, 0x1A1A2BDD445A2, 0x524EC89E44FA4, 0x22732D9CAC3A5, 0x44B34095F598D, 0x36D457E5676E5, 0x6649E09036F92, 0x1FE236C4F83A5, 0x5BF7BDB2C9EC8, 0x745AA04AE7318, 0x7F53E3F1B2BD7, 0x2A3272E139913, 0x000538673D8D0 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x559DE76003E7B, 0x57A3057A20BF0, 0x5DC38F24D8FE7, 0x2A50F464EF22E, 0x2D219E9BFCDD4, 0x20210D2B70D72, 0x0AF6CB0FA46C8, 0x0425C2F4E150B, 0x70D451CABFD24, 0x7D2617000BB1E, 0x2CE89FA3377F2, 0x194E658047DF8, 0x5E6FD7D8034FD, 0x43634AA4C1F76, 0x0003BA0C17CF0 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x1FD0547042049, 0x27B98B01D267C, 0x76F91D5D77BD8, 0x7AC0965464BCA, 0x1BBD5F3AC1642, 0x2B8400217F897, 0x02A79AC152C00, 0x365CA64B8BAF9, 0x61F21DB7DF124, 0x7F6F0E5E38BB2, 0x1A8E0D9C7C14D, 0x114DFA7D79207, 0x6337F2B36E612, 0x1177A5AF993BC, 0x000592F2E8C6B },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x1C40EE82CC7F9, 0x5FE525AED2701, 0x1807DDA3ECCCE, 0x262A9A0046446, 0x70EFF785471D6, 0x7E85F621F05F0, 0x420F1F524A655, 0x602BC63200AA9, 0x4C107340D3B6A, 0x4D7050AE6FF0A, 0x3FF86ADA7DEAF, 0x5B21399A0F002, 0x178E2150A32F2, 0x260E07B1FEFC7, 0x0004C86F60B4F },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x2B1421A3B6F23, 0x3997B26D23CA9, 0x47107269D520A, 0x17B6A4B630FEF, 0x08384CFAB2171, 0x1DB7D5D214B8D, 0x5A8B609F01ECD, 0x402CDA2D71514, 0x19EB6E91DC53D, 0x6D20540C55F47, 0x69475CBB0F4F8, 0x33755B0C0934C, 0x75377C4650460, 0x5AEDB1DE21108, 0x000528F0FF0B6 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x00A02E12051EF, 0x660A852A7B4EF, 0x4AC0B2272DF60, 0x7BD4AA9626B6B, 0x3405FD3E70934, 0x23B9FACC56ECB, 0x597413043AA57, 0x5B2FC2DF42786, 0x456B4F0E1E5BC, 0x2CA3C9E1AB252, 0x121EC98741947, 0x6E3E33891A66B, 0x533588791C2C6, 0x2C6F23D987667, 0x0004FC82AE10C },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x68A4A0A0C9788, 0x76FEE488B8055, 0x100B7BDD5E352, 0x556604E4962CB, 0x540A4357551C3, 0x0AC25946547A1, 0x09F8E46D13A3A, 0x5BBB83318B8AC, 0x1C7E54F570A47, 0x6CF69BD894F4D, 0x3AEBB1C69206F, 0x4EC4B9B5B44D3, 0x2DD42D66056BA, 0x734138656BF36, 0x000475993B0AD },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x2612AE955EDAC, 0x76559B660E180, 0x080425596F515, 0x55D2A21DCA8FC, 0x7A59E2138E02C, 0x688111A8AD4E2, 0x7BBD4EAD4B0F4, 0x0DA6050806313, 0x062FAAD6F513F, 0x0308849B7B348, 0x71BFA0E31B3C2, 0x5C688CF2994CF, 0x5B835CEEC0E16, 0x23F4CEA7B4CCF, 0x000388B900816 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x3A18BE7148F32, 0x7E43F5B22EDA5, 0x2F39DB1737ACD, 0x07CC4851D3092, 0x69C5C890CE5E7, 0x7CFCEE7927846, 0x7419D329A6C92, 0x628E603DDEC5A, 0x708322959E859, 0x51D5B3466CBD1, 0x34AF26B27F904, 0x3F41D239EFD77, 0x231177AA7D25A, 0x3CCA0450E3CF0, 0x000419AEFCF0F },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x16A5F8C38EA7A, 0x01B2D00F3E79D, 0x0B8753D7E8625, 0x21D0E44ED8BDE, 0x2662B865A11E0, 0x00F09FAA14997, 0x4BB8F191096A9, 0x61897863F2C30, 0x036EEA7F05D79, 0x739A8FC3760D3, 0x0DCD0B6BA068C, 0x443ACBCDE84B7, 0x08975C6DE1A6D, 0x440F7CC4B74E9, 0x0003EEC843B43 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x7F780BAB32A7F, 0x750E6041B06F3, 0x32D60DF990B1C, 0x6CEC4B5398C07, 0x439E380B2FA31, 0x017FE6DFC2E82, 0x1ABFB542F0C2E, 0x04631ED5A3B70, 0x432A5E671D8CB, 0x1455E2F7BF47D, 0x41CEBFE6F39EB, 0x013D29F9F03ED, 0x7FD0AEB094C9D, 0x61C54A04E6249, 0x00061FD56FCF6 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x23DDE2EF6A0FD, 0x40073A5B2FD08, 0x405A4C6109DD6, 0x380E84DE66F5E, 0x1780923C35691, 0x6B91FA968F0D2, 0x20E8A829284E0, 0x4F5150433E7FB, 0x2B8F6365C7044, 0x472FB04D3D06C, 0x6390F22DC1A84, 0x22CF40C892922, 0x5A0E245419744, 0x389520F9390AC, 0x0003995279496 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x607F12AC51361, 0x334E3FE9CFBC6, 0x090CFB1FB47A8, 0x54379EA2F30B1, 0x218153BF3B669, 0x0B8C6689E96BB, 0x09EF4EAA33AEB, 0x657ADB9C5200D, 0x26AD417CDA4B9, 0x3FB20F25E853C, 0x72311E5231D4F, 0x6023BD48654E5, 0x4763A624F319B, 0x551D12A663E8A, 0x000518385DAB4 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x06F066266E921, 0x47D7D37F1531E, 0x48C1ABA87C441, 0x44766B28C40DF, 0x6F9D853435397, 0x20BB0EEFD010B, 0x54959C6DD2FE5, 0x536F8EA98B5CB, 0x66E466AD9099C, 0x38178BA9130DE, 0x2AB34AC62CF15, 0x15389604A1390, 0x2009DE76DCD34, 0x557DD65D4732B, 0x0003C08607AA4 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x43E358D6EA2BE, 0x66C0CEAB9A368, 0x6CA16AB47348C, 0x71937FE7EA1DA, 0x1F3CA46E5FD79, 0x173A74E2A3546, 0x0C4E9112312D3, 0x43035D941A2AF, 0x063D39AFD3662, 0x6C4C72F6EF4FA, 0x5ADD1BC686A6F, 0x0156962F45075, 0x022E9387F2648, 0x55627324204EF, 0x000575ED741E7 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x6A7516BF28A3C, 0x523DBC275D165, 0x5131252FAE436, 0x6BEF7323AAB30, 0x0C19D3556EEA3, 0x5EC487CF5B5C7, 0x67680C1EF0A90, 0x7414B341D7ADA, 0x172EDEEC4E99E, 0x3E903A280ED71, 0x57A868D835F7A, 0x24A35B488C1F4, 0x65D6893FFDD0C, 0x785CFE941BBB2, 0x0003D7C51C6C1 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x66DEACFC004E6, 0x38874EBC528A9, 0x7B201872C5E7C, 0x2D268BBC55870, 0x46075D4CB6638, 0x072D50AE5D90A, 0x5837BAAC8D7CC, 0x5F6F65876A6B6, 0x793749B036A7E, 0x770BF3E33FD87, 0x1733E92F6260D, 0x2701840035E16, 0x21934D415E1DE, 0x64F14BCE66265, 0x0004C80444183 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x732AD86ACB0BC, 0x1CE759451DCFB, 0x6D88BAD32CDFE, 0x7FE0502FC205C, 0x226B4A17C0B78, 0x03A085792711A, 0x1266EA4800624, 0x2DF6BC6475875, 0x68F0BF81518FE, 0x170A675168785, 0x210CD5261F32E, 0x58AA268B67146, 0x6FE299F7F6FD4, 0x5F8CC12A260C2, 0x000425D5C55C0 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x22CBE3929EC7E, 0x2572F73F0DB53, 0x49B6318DA846C, 0x2110AB65D7A14, 0x4FB32ABBB1F1E, 0x167DC3BE96C9A, 0x37C0FDE2B4324, 0x74BF137A49475, 0x63BF4A5E5F378, 0x2F6507BD12AA2, 0x0A58F1DF6AA69, 0x66B822AFB767F, 0x21C6805C44561, 0x5C7B3E1C1A0E5, 0x000587B57B148 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x0064CDB071ABA, 0x0866F43E49CF3, 0x220EECE205042, 0x0E7D985308790, 0x21AB8B4F9A135, 0x3702C3B076202, 0x09334D9C9AEEC, 0x3F6497D28C4BC, 0x72D561C63AE36, 0x5176C0469B9E1, 0x189E7F37E4D6C, 0x3529E794C5198, 0x4B4536D0EB4B5, 0x63E4ABB91A2A3, 0x00047B57C7BA4 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x53FA783067AAF, 0x385557F253505, 0x6141372ED84D7, 0x452D46178D20F, 0x591AC1B37FFD6, 0x136EDA24D1265, 0x5BAEB8F4F7E53, 0x3B4F882680109, 0x1B38807F800CA, 0x66A94292713A6, 0x28FAB2941792D, 0x7F2C3969B5148, 0x509D3385DDF13, 0x37544EF456F2A, 0x0004EC178FE07 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x5ABE51D4598A7, 0x3A31924B2D6E4, 0x15ADC4D218F3B, 0x1EB22C976F410, 0x6EA5B16E64C20, 0x7E0F2FEA5E6FA, 0x28ACC636C55AA, 0x3DC732A9D85DD, 0x22E0A0FC26976, 0x282BC8C4F8E70, 0x045672289CF0C, 0x15C48C1E5B66D, 0x47606EAB5D6A6, 0x5F12E48200A06, 0x0003475E5D13F },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x76CE157FECD61, 0x72B12B444E673, 0x20E0DCD9A25C6, 0x56B356E7F7A53, 0x1FA8095B127E3, 0x08BFB1B8B0D88, 0x57DAF8F53E06D, 0x4F689E1D917AE, 0x76C36EE8FDEA9, 0x4BFF851AFB6B5, 0x3732601B6DF05, 0x10B63B59FEF78, 0x2E97E5EBDB679, 0x4DBD59FE0D155, 0x0005658C53590 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x497106B9700E9, 0x2A6C318A25675, 0x684F8D3AEA839, 0x25DD8EFBFF5DC, 0x28EE30BFB7D77, 0x5440A4D0C85B7, 0x0BCFE0B9829B8, 0x5045469301694, 0x63F502204CBF3, 0x73954E6D96CE9, 0x08C879B6BA1F1, 0x18E3CC06852F7, 0x3B5C7A2912D2B, 0x136214412CD09, 0x00047BD5DA3FE },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x2D11A2E276214, 0x78B6E0D25B9CE, 0x642988502163F, 0x38C3D81CC6D62, 0x5C827B0FDACEC, 0x2F97C6F6A874F, 0x250B65E05DB73, 0x72475C3A9F37C, 0x6FEDF5CBA5734, 0x6C65D1FA79836, 0x2BF7D3D4E9FD3, 0x050236C6D82E8, 0x3ED805312BF40, 0x4359925040D35, 0x0005C1098FB61 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x2D0E78C75C2A4, 0x7FEBA928BC246, 0x3035D46327582, 0x4D49B1F2DBE87, 0x5B1BD6474BED4, 0x31EC6B874AFD0, 0x1E0C10399E802, 0x1D72E2116BDB7, 0x6A16B2F5909F4, 0x7B62D3191054E, 0x6699416F7940D, 0x422D3B9DFA119, 0x27E58A0BEBB30, 0x62FEE7862F6C3, 0x0004A415BD409 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x6A5DA7A7E93F4, 0x222D46B31509B, 0x6FB0FC96E0B13, 0x3DE571AA8189E, 0x055190F28DEEF, 0x476D5DA0EEE3D, 0x53669BC016EAA, 0x6534673F5935F, 0x74CD77818986E, 0x06ACB80096692, 0x17353E19C984E, 0x4D19DEB9BD034, 0x42E4CE03996FC, 0x40F61764F7FD9, 0x0004FEDC3C70B },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x7571CED7EC304, 0x29E610DE0DC90, 0x5BEA303A14D6C, 0x0F2F8ADE0F271, 0x7FB36EB7260AE, 0x7A032DFCA851B, 0x230544BE20856, 0x63D729E7615DE, 0x10B520122E227, 0x5F7337872D9BF, 0x1B41D764115C4, 0x0BD9E6D8D2C01, 0x2AE06705CC10C, 0x7FA95F0E4990A, 0x0002287A7FEEE },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x7D54BA56EA855, 0x1F5EDC7586841, 0x280A570A1A9F7, 0x63700A075E589, 0x0C676F9F379B5, 0x4379FD470A115, 0x288DB11986CE7, 0x5CDD656EC6CAC, 0x6678CF071ADC1, 0x1F11FABF0EBBC, 0x2332510F068E2, 0x61F285ABBB782, 0x5D31CE3CA0C9A, 0x3A8DA864AF568, 0x00048D8963120 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x25D1E3CC2598F, 0x1345DA07F97D9, 0x19A02E0AD0DBB, 0x2A0442B61AA7A, 0x4732B2BE76B41, 0x65344D8D37514, 0x106307512F493, 0x3D26B359216F7, 0x1304A5B765102, 0x5798137DDB0E1, 0x6ED9116A0B943, 0x7A8592980DE8B, 0x61CF882AD9980, 0x705B6C9010BA1, 0x00047358C502B },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x468476A4FB25D, 0x61C267427BF15, 0x3646B63AEBE9B, 0x2094AC03824FC, 0x0BFC9393297EB, 0x4DC6546528B76, 0x3E25E6731302D, 0x5FB32E152C053, 0x56CBF7645424C, 0x1320ADCE0C3E7, 0x27BFC28E3A3E0, 0x4C625D8AEEB16, 0x7E13CE9653885, 0x09B1AF3A7D2F0, 0x0004D45E34538 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x5A496F343B823, 0x6F5C0BA2A6EC6, 0x03B2875CBBC2E, 0x368B00E86189E, 0x42A7B55755198, 0x6F72312AD5DB8, 0x6143DAC0F578A, 0x51407B51E6D91, 0x2F44F069754E5, 0x192AB8D2B1A61, 0x5DADAEC8F28D3, 0x79D1D6E3A0666, 0x6ED700180AEB8, 0x20ED7F59BC56E, 0x000383603EB30 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x78B1B904B0F1E, 0x771BA0B048DC5, 0x4B271FB357A50, 0x2359C5F296A06, 0x08B3A185DF512, 0x5222CB6477C11, 0x4AFD22BED305B, 0x351A5D7C37F78, 0x0BE0FBADC6998, 0x3FDC47EB6F5D9, 0x00F1AF77291DF, 0x22439A49BBE5C, 0x5BDD6E4BF8012, 0x30075A5BF5167, 0x0006312FCA83B },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x507B0ED8C6628, 0x1804677BB6747, 0x38720DBCD04D5, 0x0FFA8D29BA349, 0x604F48E75A65B, 0x7F04675A5D1A8, 0x02316182E94B4, 0x711EC07E039D5, 0x6CBAE3BE9AFDB, 0x3579965CAB60D, 0x545FB933FAE8B, 0x48BD100342A08, 0x453A7E01A02F2, 0x14CEFB3B16DA1, 0x0003BEDDA1E55 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x761FD15A7BD55, 0x20544AA1567F7, 0x74EB9F4471F43, 0x02C849D5FD5D4, 0x50C03D16F18AD, 0x2A51C3DD78DA4, 0x3BED6DEBA364D, 0x7D4622CB8E36E, 0x5D0123DD74923, 0x34B9B27B956CE, 0x3339C2EAE7E6A, 0x045330CFDD379, 0x725D04A185F7A, 0x2948DAB10BCB3, 0x00049BDB3D030 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x231D5EB3C96F1, 0x6B5A68BFAFF7D, 0x2D76C136232EE, 0x37ACDAFC98808, 0x472EB6000F4AE, 0x4BBFE8F41F27D, 0x5323BDE511AE9, 0x38A7569547EEA, 0x669F76CD59902, 0x2D436C93B34E3, 0x7E45A5166CE11, 0x6F97F565F1372, 0x7317B37D307D7, 0x36920F0716C79, 0x0003F7434A12A },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x2F3077E0A1494, 0x2322777DC8D8D, 0x39B3F988C4E2A, 0x7A983A18F9F49, 0x4F28614725E16, 0x180A327152A11, 0x6079E0FFC1601, 0x015F3D94A9707, 0x7C903C82A1EF1, 0x16F1B2624E1D0, 0x75626E3A92174, 0x751D80521309A, 0x79D3BCBDF3EA0, 0x7133DE4B784B4, 0x00063F10D94F1 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x20D0A15C9057E, 0x5CDCEE57C8E64, 0x25A68278E850A, 0x564B30FF10A72, 0x3DEB0F4610B9B, 0x527F5D44F39FE, 0x0C8F94D4468CA, 0x0AED61CAF0A3D, 0x768CB141C057B, 0x1F6B01B316DB7, 0x5526616C2D4E7, 0x078000F826259, 0x0508BA24D7529, 0x6E0C8EE359183, 0x0002EE33660C3 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x4BDD08D310086, 0x4AD99E4594BF1, 0x75FADE0BF348D, 0x4494888765C43, 0x21499C44B95F7, 0x600ED3677D5D4, 0x03ED6F8F94F83, 0x3C59A518907A5, 0x5CFC60F68577E, 0x4A0E1295F34B7, 0x0C8EB8E15FC9D, 0x2DD79ABD59A22, 0x57F9A685FACE9, 0x0237E76E3BA3C, 0x000439F4FBEE2 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x3E7DACADFA216, 0x409891468F902, 0x3D83ACFA022EB, 0x41DC0F9629661, 0x060A6A8E99A64, 0x7047CEFDFDE0E, 0x0137807850E58, 0x78E20AEB35115, 0x360C4068092E5, 0x7772F79133A3A, 0x0F12633D3766A, 0x08E8A2B9EAD14, 0x3D9F515B40084, 0x559461558F296, 0x0002D57489A35 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x0109B4E7B9BC9, 0x58F0A78C49D5E, 0x76ED833C6C38A, 0x2B328BB4B32CA, 0x0621914BE908D, 0x6496D234C50DA, 0x2438D055A3795, 0x61D7FD8D3A4F5, 0x1506BC431C191, 0x39CCEC879ED83, 0x165C7F3585DBD, 0x61BFADDE6EBFB, 0x422F964C37C42, 0x2A111FC01D246, 0x000446574AD7C },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x7B2AC52FFCB8D, 0x2A89F5EE2E19D, 0x5649B3D5554B1, 0x7EAC4F87E61C1, 0x58B1B8264942F, 0x13A7366E0C860, 0x3A4639C4FF87A, 0x45738E7B59E5D, 0x735FBEEE7907A, 0x6EEE483B0B32E, 0x50405EB005AD3, 0x12F054FFA035C, 0x13A0D7BD3FB3C, 0x4E94B9289DA28, 0x0003C31A4215E },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x3B39A72ABBBDC, 0x3C757968B7987, 0x62311F46D246B, 0x5104E03ABDEA9, 0x7DBD4DA9258EF, 0x2392A90D1A750, 0x5C18F0A8B6E71, 0x43217E2C3847D, 0x02D8394AEF41E, 0x53B046E750F95, 0x5BFAB4447F41A, 0x3F0AE51DD62DE, 0x18C3050694C94, 0x56CA09B84720C, 0x0005C4E84CF67 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x3A7B313C22F8A, 0x591026E5B356C, 0x28F48342E1157, 0x033214F4150B1, 0x3494350EAC4D3, 0x0A3E020DE1299, 0x61D6611BB2201, 0x60040241B5BF5, 0x10071E7619C8E, 0x701736C966001, 0x00F3AC36482BB, 0x52254C19D910C, 0x472EC10CD7F30, 0x5389C92A109F5, 0x00031EB62F433 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x22DB43B2C1306, 0x72B6E4D049C6E, 0x2BF19337C1942, 0x1619A96EB433E, 0x7EF20E1E35A83, 0x382B29D545E4D, 0x0ABB9EC007A7F, 0x29756BC0F6085, 0x314887C56F24A, 0x380CA2EAF7F03, 0x17F2275131A1D, 0x443BA655EC0FE, 0x5E98A2404B71F, 0x5BB2E14815AB2, 0x000554AD9DE73 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x484B277ED0EFE, 0x1A4D04FEAC3B1, 0x767C9B17B7649, 0x6A21D79163FAE, 0x2181D9551DE34, 0x5F126DC2687A3, 0x529EF410D8422, 0x498BF33ABA64B, 0x08C729A467295, 0x2E5EE72308945, 0x6D0B95259F999, 0x6523A78C69D02, 0x1F7645056B128, 0x3D0B955092E31, 0x000233FD318E8 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x1F7DAA4CCAC12, 0x5112BCD8D8DDA, 0x240B62AB0D8D8, 0x3CBC59AA73C41, 0x610150EA9C632, 0x66CA3FE36C6A2, 0x01A4AAE9F70D5, 0x243D92E72EB85, 0x2C555E6D83F2A, 0x0EA0A6C0E876F, 0x406442C77181A, 0x11E23D19B7B3E, 0x65F3C90BA4414, 0x664DD8AD3ACA8, 0x0004D561D4B78 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x6DC1691DA1DB6, 0x1570F6F0E8566, 0x12F8F5988159D, 0x5C04A329A08F2, 0x384925F94433B, 0x74E46B0E776BC, 0x0BB251BD8B526, 0x68112971A4CF2, 0x559E5901565FF, 0x0B3DB376FC226, 0x1BCD71A56F8CF, 0x12E4EA39ED1ED, 0x2FE7CC7564642, 0x415F730E9EC6B, 0x0002583423685 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x2C74454CD3C60, 0x673D7CE4F887F, 0x6008BFA9F84F6, 0x7B019A277FAED, 0x4BA85B993A878, 0x4B1EF5DC9FA2C, 0x11643EE436AC2, 0x6CBE8299F6E10, 0x19074AA1DDAEF, 0x422A8EEFD48D8, 0x44620D4E38F5E, 0x15057716090C2, 0x04404DAF6F019, 0x7EC26C9FA51B7, 0x0005243DDBF9E },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x50BED891EFCCE, 0x6D5B9385A7B7B, 0x0970DCFC205B0, 0x48A473EF4795E, 0x7B1172E1001AA, 0x04928698865EE, 0x2030CC13C0C9B, 0x5D3679CEC91D3, 0x59B61A369ECAD, 0x2005144ABB8F5, 0x5107164699C9D, 0x0773961E5190C, 0x3D635217A7201, 0x6F252FAE2CDC2, 0x00039657CE072 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x676B4024B5E5A, 0x001288EAE16CB, 0x39ACC497E1264, 0x30A811154A972, 0x4A20A21CB3D16, 0x11773401010AB, 0x14D4E40370951, 0x6583738A8D61A, 0x78706E5E04661, 0x64B1676DE1DAB, 0x79C6E1DC18011, 0x7D4C86A8CEF3A, 0x2255C1E368DD4, 0x2F40416231391, 0x0005AE6534772 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x084BE85DC1598, 0x2AB7B827C79FB, 0x5D79E92A24529, 0x65B3170862A18, 0x156DA0171874B, 0x468FCF5A90C4E, 0x302BDAA8895A8, 0x63B348A149BF1, 0x70E89FD6CB29C, 0x478630A00F945, 0x18091D5FD0C2A, 0x1F1EDD8C968AA, 0x64B36BF0C4B46, 0x586841AD3F1A6, 0x0003E46CCE96B },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x4537F7AD9F19D, 0x7A8CD1EFDCC85, 0x5CABB79903434, 0x1D234C040E22E, 0x60B9054C64FE5, 0x0F564CC0DAF37, 0x72462EBBA93F7, 0x74CE6D22F0500, 0x10B483270F22D, 0x6F3E216D2AE5F, 0x6EDF81CF30CB6, 0x3EF10E5C62A2A, 0x63C3FB1E8E82C, 0x3FB047CD02491, 0x0005D12F91E2C },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x08951D1A87CB7, 0x6B84F933EB939, 0x5064893DAFBB3, 0x40A6444119FFB, 0x52AE5EFEB507D, 0x333DD607F5C28, 0x44048F295A879, 0x2BF87A10778F1, 0x54E113FBB4080, 0x6EE162084C742, 0x6DCDE8262E3E5, 0x125CF0B435877, 0x197C7F83F4E48, 0x51E14D6176FA1, 0x000439C5E0DC0 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x0D300AFB16FFF, 0x75329F0F341A4, 0x4B9646E8301F8, 0x2C34455491505, 0x2C07CB40D2B13, 0x313AC99B11DDC, 0x44D7C7F34DAAF, 0x6982B9B943E79, 0x431DA9C4BF040, 0x60F5683EF9CD7, 0x02955BCA38828, 0x34E3D8B3E1E4C, 0x1443B88CDAE31, 0x08B61C5C5AFBD, 0x00053E92D23A0 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x49330CB64646B, 0x4E78340C0C984, 0x61E93CCB18ED1, 0x39513671B0FA8, 0x20A77585EC113, 0x42C217F373D2C, 0x0B3452D52A179, 0x38A9F9ACAF78D, 0x09A1384BBAD0D, 0x5D44F440944AB, 0x35BE9D2332DE0, 0x14A54594F5C1E, 0x6081F96DC216B, 0x10FCFDFB9B75E, 0x00040ECA9608B },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x044F3EAE78041, 0x1F640455D1553, 0x58DBE20A5AF67, 0x4B68C82C98AD7, 0x0C1CEF04E838E, 0x6A584A41FA625, 0x1A3943CEF948D, 0x3EAA93AA9CA2C, 0x6E7C6F912B790, 0x0B37EE748DF9D, 0x1EBDA7BE5AD90, 0x1B90D7C9E2728, 0x2A2BA19B9A02C, 0x431A73498BDA2, 0x00061F7BC44F9 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x333FA9C61B2AF, 0x7FE0964E00932, 0x6DDDB0C043D2B, 0x01B2A2CBC8AAA, 0x70E8D6B9F6458, 0x18CADA9004552, 0x0A5D2A1CB8C90, 0x3AC2A0E4D9358, 0x1C8D6EE08D8DF, 0x38BA8DE59663E, 0x5DD96BC393A11, 0x1174C640A9F19, 0x0B4607EDBA9E1, 0x5D74CE07808BD, 0x00043E3322700 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x6AE8C26A6C2CE, 0x2FB4747220C98, 0x683B291E1D767, 0x7962A5C567927, 0x29034E94E1809, 0x58E8FD4077D96, 0x15708DA84D1AB, 0x64BCC1E61367F, 0x1A7C96EB6B176, 0x72505FDFF57D3, 0x27CA727B5FC37, 0x0DC41774958DF, 0x40A7FC946E03C, 0x19E2EF2E55922, 0x00049AC4EBA62 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x21D0C0F163484, 0x729E1774CEA84, 0x704DC6A69DF46, 0x49C9B140CC26B, 0x4E4B359195EAD, 0x32900874B56F2, 0x0143F98625524, 0x62567ABDABC3C, 0x4AC2AE822958C, 0x1FC2E7036B42E, 0x7926F15AC794D, 0x6579C9BD7F692, 0x1A4F52B6887B9, 0x58B7151B5DD88, 0x00036373B83AC },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x256965721EDE5, 0x3C56CA64BEFF1, 0x12FF8EE76818E, 0x02E7FCF34FD82, 0x603845BAB9E11, 0x0B4863064CA8B, 0x588B5C609A89F, 0x6E712BAF0905B, 0x576CEF665A03F, 0x0389BDA8FAE51, 0x3B4BF173737FA, 0x08E7D4AE413E2, 0x26657D3AA7E20, 0x77E257D6A188E, 0x00054EFB577CC },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x64A5ABCF87539, 0x7357500E12646, 0x5104377469232, 0x55FF92231F40B, 0x7F96F60418015, 0x5E0B10909A191, 0x7BECB6428F5E5, 0x7F64377116140, 0x2FF672211190F, 0x58A0431DF9839, 0x3CEE36FBEB2DA, 0x5EC15D5C43357, 0x512DCE5B47575, 0x722D5BB7975D6, 0x0002A07826D16 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x4E475CC824A43, 0x16D6EC3FAE1E1, 0x2B5B603C7BAEB, 0x5CC9B5AD3EF86, 0x33A73D754AAC1, 0x14E1B69A9913B, 0x1D6088BBEF853, 0x109F70FABF085, 0x56B98C546FA34, 0x2CE77FFA2628B, 0x239E47051B1F1, 0x327AC383BB562, 0x0890265B34DC2, 0x62A16CC1A7E7A, 0x0005432EA5911 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x0AD1EA862C2EF, 0x57035E17E8D32, 0x01902CD1F56B6, 0x3B0C1EE82749C, 0x2FDF006A6C62E, 0x2F98A834B54DC, 0x1D312F7B3B0DC, 0x03902C3B2ADE7, 0x038114C77750D, 0x114DC9359D49C, 0x4200E0CB9E26C, 0x11E0D5C9B55AB, 0x5A4318B1D8A71, 0x5C587A80DFF57, 0x0004EFDFD3CF7 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x4A86D47E699E5, 0x25CF253B778D7, 0x62A7B4BCF7712, 0x1BF14ADA2330E, 0x7CA6F0D5707C3, 0x578A2F6EE5AA9, 0x30C94FBE50BAE, 0x2C183FBFE1862, 0x343E4B17EDD5C, 0x419653DE157B0, 0x2E57AE536C016, 0x585AF31EB2E40, 0x78E404B1043C2, 0x697EA298D778F, 0x0003E3DE7BA53 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x032549A01B1A3, 0x60AE2E6BC4CCD, 0x28A36D3549D20, 0x6B027A32B3AE4, 0x5C7CFD3D9F3EC, 0x7E38DAB732EE4, 0x45AA79F2C05B8, 0x5E4E592F729D0, 0x1170B00611A7C, 0x5D1658E9EF3FE, 0x2311D33019251, 0x072674ECAAF9F, 0x1CCC25408DE14, 0x7B65B4CC7B433, 0x0003B8B6CA2DE },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x4E05E04F0DD54, 0x2351E564D2191, 0x59DF57D4E3A75, 0x0A83E0CA9D41A, 0x08BEAA1E1C592, 0x28A7EE1F173FB, 0x75F060F25D182, 0x2F0F76EA867F4, 0x4434A252639EC, 0x2A4823AA6D694, 0x20DD8D670D814, 0x131FA1A81FACD, 0x568C4ACDD41E3, 0x0C46A9F43EBFD, 0x00049B299299B },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x46B5E5A02AB82, 0x061261508A3DE, 0x51071581094FB, 0x5127F7E70066B, 0x4F2288569553C, 0x6CEB8039A6B7A, 0x7F8EC0D3A034C, 0x005F3560E3B74, 0x17D81863C6BC5, 0x52F7714410C3E, 0x63A7BC0EEEBFE, 0x590C648F6EE7C, 0x2DC622607FC1B, 0x57B4EB1B92771, 0x00047C17334ED },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x33FF89A98951D, 0x29A5680E276C7, 0x6DD8BFC7B3E45, 0x79C342C1741C4, 0x671282E399689, 0x06F9BF5813465, 0x762F9C3A2E97F, 0x165E7E1D88B1D, 0x668C19646A751, 0x3C6559D16C5D8, 0x06511562912FE, 0x75A91C64393BD, 0x5D5CB978C6526, 0x70E0E89086421, 0x000524E67262F },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x33CF7652EA1C9, 0x0993CA62E33C9, 0x3EC947C0568F1, 0x404769758CEFA, 0x5E48D6C183CF5, 0x6A8D8EE3563EC, 0x5C5A76C7581FA, 0x0715A9C30557A, 0x48D37958369E6, 0x045AE68F2B27E, 0x0CECA215DBA7F, 0x0FA19FFA7CEE4, 0x2347B4357FAE9, 0x0F6034D0B4435, 0x000265ABC356C },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x1D4643F61CE73, 0x710CCD340794C, 0x3CD6289627F52, 0x6E6A545C35487, 0x6400D5E25B6C8, 0x5386BE9F36125, 0x418CC1A8A881C, 0x05312186D47F1, 0x53959D09E019D, 0x6B8C61FD97A07, 0x6260874021C29, 0x503F47712C664, 0x2C357B6BC4EC9, 0x19F047A63F51E, 0x0005446A5E763 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x02636E9A4B769, 0x364E626E8BEA6, 0x662C2C4B839B5, 0x76B8C057A8106, 0x0B6C0BFCD08CD, 0x73224C01BC299, 0x6D6CA2D4F427F, 0x396364656B575, 0x773C78178BDD4, 0x15C5357ADA5F7, 0x3C2E117F22D40, 0x07088EFAB0D73, 0x6577D5DFCDCA8, 0x1971291AB06DD, 0x0002087D9F5EB },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x5F5CE062C8234, 0x67CED8B8A96DF, 0x45239D1F1FFF2, 0x14C49B6AFF832, 0x6AAE50102A3F7, 0x159153BECCFF4, 0x7531686EBE79D, 0x5EA79F2E29C98, 0x6B0BA8ACC9156, 0x3103C95014A98, 0x50E7C4802D91E, 0x0ADBD6D384B71, 0x74CC7870DB0D2, 0x0234ED98CB114, 0x000595E65A3E0 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x250801A1C589C, 0x6AA84ADF07EFD, 0x41FD6CD4EF899, 0x322A7230CD4D7, 0x680A1679926E2, 0x7B46A7B03BEA8, 0x1D466840B871D, 0x7C6377720312D, 0x30E052FFA1D03, 0x7F6EFFD5793C0, 0x0411D165BCD63, 0x545FC52183BFE, 0x413FDA1E1351B, 0x7AF66D6761DD6, 0x000232E6FF78A },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x1BF86532811DB, 0x213D3B567554B, 0x1B3A57A66C4E8, 0x09BCEFEEC2881, 0x391C0B75EA4B3, 0x0C5911B07122A, 0x3BF1C7E392385, 0x426178ADCB78A, 0x5260F64CC244F, 0x6EEBC219663A7, 0x40CA6F2CE335F, 0x30171B1AD82FF, 0x2B330B851564B, 0x1AD2C2F75EA84, 0x0004F56881DF3 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x3787155B9A31F, 0x35268DACE029B, 0x1886F8416FA1C, 0x5D79B5951C8D7, 0x261F87692FCC9, 0x1E422D9DD35DF, 0x06A95991E1A3E, 0x352B8BF8FC008, 0x07D3021288F10, 0x58693A2892953, 0x7C857B0FAEF92, 0x6C3F6991CE11C, 0x72D1FC76588AB, 0x5F1BC121DF2BC, 0x00033CFC82389 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x57B13C72964E5, 0x44E68B54DE568, 0x5F3B4244A8555, 0x69BBDB4A6E480, 0x12DA0ADA7C2BB, 0x38A2235235C51, 0x2FB88DE46C689, 0x43464A5F170FE, 0x315BD250367E6, 0x6F0DA730E0972, 0x128215C285A0A, 0x30448B5456194, 0x68B51B453538D, 0x2630B0C7FDE9C, 0x0004A0BCCEAA5 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x04F775430E4D3, 0x6BF21EA1B2832, 0x3F32133DFD52F, 0x1255A96A2E773, 0x1EB171E666577, 0x561B7D6C64F95, 0x4A3AE2F86B297, 0x12D3CA10FB924, 0x16B8797765873, 0x04B459C841BD0, 0x4EBC17DBD6B76, 0x682DA9E167FA3, 0x63AA9FBAFF4DF, 0x5A4CB5E4D4856, 0x00030C4A75A42 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x29DD02FFD22BF, 0x406ABFF7E1E39, 0x6E937C4C1B8B7, 0x17F5C43827DCD, 0x74631FBFDEA01, 0x262F1A4BD35CD, 0x4724105E3E12E, 0x5CC71C8E06F53, 0x4A42B243F0043, 0x6496A0A59DEF5, 0x495A2406BD9C0, 0x151B9D0E28ADF, 0x152AD659CAAFB, 0x6A67E2F1B5459, 0x0006415B6E02B },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x50ADA8C446269, 0x64A910E2AF33B, 0x765F4A8D11FDA, 0x35F9658086FDC, 0x4B01AE1FE32EA, 0x4600E7A268F36, 0x44C49EB4AC9D2, 0x2B04318BE6C04, 0x163853A57AC07, 0x4E44DC3637980, 0x6B69B2FC339A3, 0x66BE444A17ABA, 0x6F0AE5FA03CF3, 0x414A1248D1CDE, 0x00030903EB4F2 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x40A6EA2107577, 0x2D9F4711D281D, 0x0BEA9C6CF3362, 0x224399B960904, 0x0E9B48F7D0279, 0x704809D301A93, 0x1954627D35E34, 0x6BC038FD3787F, 0x1DFC969C2C764, 0x2E7267785E8AE, 0x564A3829E5A39, 0x2749212DA0EAB, 0x15EF977E2CDE5, 0x75E34B05F6289, 0x00057BDBE67A5 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x108E258983275, 0x75444F1DED134, 0x734D74AA308ED, 0x1199E8D512871, 0x36CEA0A75AFDE, 0x6C00E251A9A0E, 0x56B1FFC349DC3, 0x7363214903863, 0x4C67A944E3594, 0x0E83ED3913795, 0x53000D7664E5F, 0x3C2C9344E79A2, 0x494BE7DD4FB47, 0x2E6ECCD45272F, 0x00032AD3F280F },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x55AAF7E5F16D7, 0x241117408A098, 0x3B42A1CB3BE88, 0x216FFED214201, 0x0B0C3A96FBBE8, 0x08E119EFB5991, 0x2AF73B694D512, 0x49397E5FF5B57, 0x7CA21882484EE, 0x58876559BECC8, 0x3434E53E0F075, 0x6761B14419877, 0x73ADFC9CAD975, 0x75F68F0B083C3, 0x0004970239DD6 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x2395124BE2657, 0x520BCA101F970, 0x634EB5DC33FEF, 0x4807E46E33CD0, 0x6C8F4F1460046, 0x419096F34EBA5, 0x35D41243D5048, 0x7C43928812878, 0x62D49F19FBB8D, 0x64CEA0BEC7569, 0x4D66223D4AB74, 0x01924E7255ADD, 0x62EA35AF561BC, 0x5CF07BBCF0215, 0x0003441DD8AC7 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x6B5277FC910B3, 0x28C4FC4B65BAF, 0x0BD8E34B6634E, 0x6495BB27A919A, 0x455935CCC72EF, 0x286BFF62CC6DD, 0x362CE6D0613D2, 0x2ADC5000FF3DC, 0x20061FAF4EB22, 0x451DCAF95F2A9, 0x4BDB456D5BA18, 0x0A99E5EEDD9EB, 0x2794E9E6BE861, 0x4FC7CC8D3E32C, 0x0004ED39D4159 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x44D896EFBFBAF, 0x69EFD447A02DA, 0x3F0DD410961E1, 0x17DA5DF35A0F1, 0x0949BF4940057, 0x1D44E4CF2C4D4, 0x1C3E68AEFA443, 0x6042CEE7BA304, 0x3EA54542E3209, 0x4D4149BC0EDDD, 0x4FA4AFD7AC100, 0x1A13B197EE62C, 0x3F27F13D74BC2, 0x5C2E8F957967F, 0x0002FC217AE2C },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x31D649A58660A, 0x54735CD9DCB82, 0x6B7A3EED4F019, 0x21C8178F1F2C9, 0x1D13FCD86DAEA, 0x70D8BAFCB460F, 0x734F0FB605239, 0x0E3DED0432BA9, 0x13F3A5793C456, 0x58941D2874993, 0x38375119429C7, 0x74E1CD478B0DD, 0x32B4F53F41825, 0x10FC53C701A3D, 0x00052D5005F85 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x55D61C97BA9DA, 0x2B08356F7B28B, 0x7CCFD123872E9, 0x0C182DEFB259C, 0x65F57C9A5046A, 0x525668901BC19, 0x5C200988B020A, 0x3D7A6D1CE615D, 0x7F8713BEC278A, 0x16DC900AEA72F, 0x16276B13313F2, 0x5D05BF8ABF5E0, 0x0A32953536141, 0x0520736D9F684, 0x0004459AC19C6 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x2D1CDECA7E5D6, 0x73A645117304A, 0x4B07F0FC280AF, 0x67EE9F546606A, 0x0DFB5A2B32A49, 0x6CBEF2BA9866D, 0x277B85F1D13B8, 0x2E438DF7FF09E, 0x6F457FF51F049, 0x172346FB29EAB, 0x7F4D7A2F7B0F8, 0x4E693BA2A9892, 0x4E5A46CC41DED, 0x7CD0E98D19E17, 0x0005F9C9612E1 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x46AF9A1435222, 0x1791E8E932BD9, 0x25467D49C79D2, 0x4298187E283FD, 0x08367885F45CA, 0x29410CFB5C02F, 0x01BC3256A2371, 0x79303F18CE954, 0x6A0A2B2865970, 0x71DF9FEABE787, 0x3E8385C689FCF, 0x5E9BDD8DD9314, 0x2AD70DD8B76F9, 0x2BAAEE922A90E, 0x000284FFFEC12 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x1EAADF1BBC1E4, 0x3A982A5908416, 0x240C3E4E44424, 0x2B181D3875776, 0x11F10CDE43F09, 0x3FFA35E558533, 0x61A04C6809110, 0x5B1DF2B652C63, 0x13F81C6C413FE, 0x6F80D9FF3E61A, 0x1D4F71B064BDB, 0x01A2063E84C89, 0x770A79AFB6226, 0x6180B3BD0C66C, 0x0003B7F87767D },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x1A5293511289A, 0x526DCBC279B8D, 0x3194670E8F823, 0x391ECB2027132, 0x0985977566B5F, 0x197B60BFE4089, 0x4BDC63A2343E5, 0x74522B32EBFC7, 0x0E5EFAF7A1565, 0x3D6923499CACA, 0x7C53968DE9EAE, 0x2E0C6CE797D87, 0x4BE2CD52D4551, 0x6E0043503A95A, 0x000396DB67CE4 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x6D476598CADE3, 0x6928106C86443, 0x784B2641AB3AC, 0x09D8ADA7D5038, 0x5479E83273241, 0x199BC502BE2E9, 0x6EA5A87B9BCCD, 0x22C997A8498AA, 0x7073C862A0F81, 0x0803F63BDB166, 0x2B8FD44419C7E, 0x11740FE3EB64E, 0x206FBDFBA389B, 0x51053342CE462, 0x00046F01EF7E6 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x63AFA974EE6D3, 0x3FADDA213E63D, 0x3B46281D4D518, 0x0E60F272216A2, 0x45629895EAC09, 0x1D4B1ECD79941, 0x2E38DF6546E56, 0x7E1569AC879AF, 0x44DFF2732AEEE, 0x1270DCCE8CEAE, 0x53F20C4B1DFE5, 0x273055FF1A73B, 0x4A17028719313, 0x7E0A971D469F8, 0x000360DFEB31C },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x0DCFD6A94A8B7, 0x310F2953C5DED, 0x22DF9E3BA83E2, 0x490CF46B07074, 0x2E833DA664249, 0x58DBCA7D8C377, 0x3C56CD88B5F85, 0x5904365B3C731, 0x1D31DAD993A56, 0x7BB920C9346A5, 0x36349E37AB715, 0x5042CC50171D0, 0x5C4D9E70B36AA, 0x1AD98701407FA, 0x0005A429BE009 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x61A6F23EA03A1, 0x77FCF7F596D47, 0x7AEB6ECCE67B2, 0x152663C63FF93, 0x3B3281B4FEA86, 0x587C13F151BF1, 0x4E21195E5707E, 0x15C40E074687D, 0x74E65A94D4EB6, 0x58D1F99521A41, 0x7B7FF9FB926AC, 0x38A9186D11792, 0x744E8E08D7F6E, 0x123D55A976805, 0x0002D0290C3DA },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x2E47243F22F8A, 0x361413F5C2DFF, 0x17FC6224F00BB, 0x4579D5899B055, 0x077E9BB2E9234, 0x3B685FAE6F705, 0x7949A6C91D0F9, 0x5904B44A88CF2, 0x1EF38B614CE44, 0x2A0D60BC4FE35, 0x73F4284A94340, 0x29DC42BEBE988, 0x3EE6506E57292, 0x0FD76096C2695, 0x00064D443A458 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x7A2F00763CBAC, 0x07098C1657FE4, 0x3647DC28802FB, 0x549DB6C21B213, 0x7206B3FD6D0CE, 0x033A5A28D0362, 0x6474077B5B573, 0x43844544C5668, 0x09E4BF5F3A336, 0x2CA404C44BFB1, 0x304B842794BA9, 0x2D72B7329E26B, 0x0C41DEC64D243, 0x549EA6385A2D6, 0x0003C3EC6A5AD },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x393A790BCAE1B, 0x51B3344CD53AA, 0x488652FDF9774, 0x4F6C7D0712C8B, 0x7F51535CB2B97, 0x66894E25B3194, 0x24C4C92AC3214, 0x1E8E56C39109B, 0x6A70D39641057, 0x691C2865396DD, 0x0955C4F15A923, 0x2A97B22FF78E0, 0x7C8B40A4B5648, 0x71A24C3E795A8, 0x000233E8FA015 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x4BC69D2FE5229, 0x457E52432F41E, 0x620A82DAEAEC1, 0x61ABA858E841E, 0x7231E3D2483F2, 0x732EFD2958CEA, 0x5B1B89097424F, 0x28BB356026062, 0x176B692D7E9B7, 0x2F6B0D3550298, 0x46D95991837CC, 0x2473B0898D82F, 0x2B74ADD902C5A, 0x76A5547F9EE9E, 0x0004DB6F8557E },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x7210C3613DAF2, 0x6AF524EACF3DB, 0x26BF7212826D3, 0x326E886E0064C, 0x3AF27D849CE4B, 0x03AA1C0DDF114, 0x3101C2E6339C6, 0x5C3EEF3A6C3BA, 0x69DBE70D32CAA, 0x5B984A1701353, 0x5B9C4A3CD85D5, 0x19DBDB2D1BFA9, 0x2ADB8044A3D85, 0x278B8843B8610, 0x0003C9F5AFA41 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x326107E8C29D0, 0x38741249CA18B, 0x04C150D393569, 0x7B2175E63F3B9, 0x38B4A875046DA, 0x7F741BFCAE87F, 0x580D31BAFFCA3, 0x088F89881BD2C, 0x0E871204A26F5, 0x5152AE1631EC2, 0x2C9FFD9856EC4, 0x53356F1B947D2, 0x55E13F3D52CD6, 0x5DA5079DE2007, 0x0003A5E02D19E },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x151E93A75639D, 0x1EEDB4774C53A, 0x3D30F2D579438, 0x2028636380983, 0x1A814B3DCDBBC, 0x3FC0C9B5658E0, 0x30828A62CE641, 0x2FF2E50B489FD, 0x2821B678020F6, 0x10258CEDDF37D, 0x421825209EEDD, 0x4105991D496FA, 0x4A47688E2FBD1, 0x63436F6D5FC8A, 0x0005A57D089AD },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x2480C83DFC3F5, 0x29FB1426B11AA, 0x4DC27B54D734B, 0x281F705F4CCDC, 0x1CF836231B760, 0x31D862429F118, 0x5593C85EED6B8, 0x727A2EA1793D1, 0x758476C85B2A8, 0x7162DD8F05679, 0x71E1929F035F3, 0x71EB5CB712F8D, 0x236CB00BDC750, 0x4814598B32168, 0x0003EA83A2345 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x69C4E3CD82FE0, 0x4763616F1BB50, 0x73B1981414769, 0x0B6F0C342691F, 0x301A2E76E3590, 0x00E7B3D8B56E6, 0x1A4C390767DCE, 0x4B47133AE6980, 0x3E8C9DAFF7003, 0x146AD36ED8C16, 0x05705FDD7DB81, 0x7C52971557CBF, 0x0D4D071E8B20A, 0x6AC083B38D74D, 0x0004BBBECEA54 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x190A3F8CFEDD2, 0x3858E86B3632F, 0x1B084E3F07FB1, 0x22969C8317AC0, 0x5D61B7927A304, 0x11E4EEA3ACE61, 0x57921763E1949, 0x5859930897F85, 0x2E1D16430B0D0, 0x602B62AD39DDA, 0x75894089A6B33, 0x2617ADBA0E0A6, 0x5CD608CA74D38, 0x4D31911E2216B, 0x00042BFE05361 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x14F54B8591CAE, 0x4BCA5495B07F6, 0x62CA057C07DD2, 0x20C57E5081205, 0x2035E8D4A3E5E, 0x016ABB520222F, 0x533C379D62C75, 0x4A86FB3ECA3A5, 0x43BAA6FD77B95, 0x4680F112826F0, 0x648F9E9526FBF, 0x0DE1FC1043CFB, 0x44D24E68735FF, 0x2B29CE8A67288, 0x00057ECF0F65D },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x1B681905ED7B4, 0x3FD758A3FD1CB, 0x1F5C04F51992D, 0x518D28DB7A6B1, 0x21000FFE4A425, 0x339C5061AAC7F, 0x06DD04A28668D, 0x66CA6B190007B, 0x1287E6B6F57BF, 0x5AF2D8D670C3E, 0x76963C6E78130, 0x66571AA7290AF, 0x7B94087BB3B7C, 0x2D31F4CE7B550, 0x000225B7489DA },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x039E9B3D1990D, 0x1AD9A3E6A001D, 0x5BC2F3EC44698, 0x70F3B93ED0969, 0x389B24AE77847, 0x41C01F5585310, 0x06F5E80F6E8CB, 0x6D85FB07811CD, 0x7F2AF1564676D, 0x5E278AD49FD90, 0x30F704F9DDB00, 0x0A95F6E361B47, 0x4E604B6EC9141, 0x532E2F2463F6C, 0x00052A16F41C8 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x2E2204D88F23B, 0x4D96B65885947, 0x2AC219CA437C8, 0x5680B6279C5A2, 0x18E7EC7AE0EB5, 0x63B23F02F5DAC, 0x384FE5B036E51, 0x6307CA8174E41, 0x30B9ECFFAB5D3, 0x575B1E56222E6, 0x7F344B9F9045E, 0x311A076F9E0EB, 0x7175C8D64F0B2, 0x479B9E251DEB7, 0x0002FCA0EB9F8 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x20A392EDF633D, 0x591EB4DE1246D, 0x07F3D984A6213, 0x28772E4CD8F7F, 0x7F49AB832C108, 0x3F47F57AAF9D6, 0x520AB9BF1BD70, 0x3962BE28E8DE1, 0x493E03A300AE3, 0x05AADFCEC3500, 0x54DC9262F9D89, 0x3487D48E3C1C1, 0x0508B0CE15EEB, 0x57BE3EF38549A, 0x000534135CDEC },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x7125561C99FBB, 0x72D6BDAD84545, 0x7D2225BCB2BE4, 0x3AF548AE4C401, 0x5A6158A0E598C, 0x68E7BBB0FDC07, 0x38A5F0A0680C9, 0x40979687B1685, 0x2929833D53F29, 0x0FCE9806375CE, 0x6D18B970BD201, 0x366FF268938D8, 0x5951BE7DE13A6, 0x0F86EDDADA0FF, 0x00045F700D0DF },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x5FDFECC9139E8, 0x0B2BDD73602E9, 0x065B1D1CA3D3C, 0x1FE3FAB84CD5F, 0x39E29CD1B6231, 0x5B854BD0FE995, 0x3117C5819D011, 0x3F67600A15A41, 0x2EB4CB0A5F1C7, 0x1E46D8A10E127, 0x3965E4535FB66, 0x329702C31C4F3, 0x3705B41101BCA, 0x0CF8178BDE728, 0x00050FE58BBD9 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x6347E3537DE92, 0x2E3D0F850AF36, 0x79F631DBE88F2, 0x1237AE6810323, 0x1A56FE3D662D3, 0x78ABACACB46EA, 0x66810886092A7, 0x04930A2ED1885, 0x4BA905014F18E, 0x3A9CADED9BE8C, 0x3783DBBC1B1C6, 0x0B916EB7695D7, 0x52FC40BE2D32F, 0x4407212A6C326, 0x000454E0B2753 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x3F0958E1D8ED3, 0x5FD7129CC9B18, 0x79AAF24511642, 0x78063C2D4B356, 0x7A2C244FBC095, 0x7D56E1752867A, 0x661C271D795E0, 0x2622ACFB4EC2F, 0x5B77D0E125899, 0x6D3E0D6409F51, 0x677095F575B77, 0x1A4A4370EEC19, 0x4931DC2244E0B, 0x43D6FCA8E9D20, 0x0004590F8478C },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x44F451D98930F, 0x1293ECBC985E6, 0x1CE4E1853084B, 0x2D794787932AD, 0x3CA63BE801739, 0x1854F77BE9629, 0x6256C3028C921, 0x3CFB4A248700E, 0x54C589AC14054, 0x6954FE270A616, 0x23D0C053F236A, 0x4A71111394495, 0x4E576AD130355, 0x54331902B0E15, 0x0003C988B2713 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x587524E248959, 0x4AA95618FD36A, 0x36270B8A5293C, 0x04229F58DC534, 0x20BFD49E24213, 0x09C1C07C1B5DD, 0x0A7DE8FEE9F4C, 0x5C4DBC8367746, 0x49DCF1124537F, 0x4777B000A3600, 0x6728146AADB3A, 0x2D144611BAF28, 0x70AD612F3CE4F, 0x3D9E12F212B6F, 0x00049AB2389E7 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x7FF3A046BE5AF, 0x52334CF1FF332, 0x6AEB1FD2ED4F9, 0x7E418EE8D6767, 0x560541D279D3D, 0x71064FC1335EC, 0x717CE0CCC14E2, 0x6C6DC4BCBAA0B, 0x120947092258F, 0x05697E4B620F1, 0x018CF2414DFD8, 0x40A216AA8F2C7, 0x0FED53168A3EA, 0x3D40270C9AC17, 0x000405F136466 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x086951E3688BF, 0x154C38ADFB5B3, 0x173EBCA8EDD8E, 0x1FC0AB98B76FC, 0x18EEC10481711, 0x675E6F73CEBF9, 0x7F338A3193084, 0x057FEACEB1E1B, 0x3ADEE2DFACB72, 0x51D021A460C3F, 0x3CB7FDC15A4A6, 0x16137A8FE0DD7, 0x6FA5E55B97CE3, 0x4AA34BBAF3400, 0x00058A3331764 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x379A7C6F9EB47, 0x5FFA5926038EE, 0x0C53077017638, 0x4626D1C527DBB, 0x41B3CC559C7E0, 0x4BFD9436AF0B2, 0x2056AF3C7D1BC, 0x1244968644C07, 0x7416504E2F219, 0x290A639D7D4CA, 0x42A491BB5773C, 0x41E71BB8957D7, 0x11D4128FF4FF2, 0x10A27A596E9D7, 0x00033E54E3448 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x5D4FD6E3B5F2F, 0x5120EC8854575, 0x47B2C41CE5A5F, 0x0A852B91CB9E3, 0x2D5724ED442D8, 0x32AFCCDA45378, 0x1417BFB878C10, 0x7EA8D14E891B3, 0x1DFA1BA50F14D, 0x7F545440D8156, 0x23700309FAFE3, 0x7B8EE21346B73, 0x452379D821406, 0x6DF7A36D1C7BB, 0x0005FCB1F1EF4 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x5F01BC0949149, 0x75D6E1A56AF14, 0x12261AE537A25, 0x0240BF4D29AEF, 0x21BACEE643B2A, 0x0467D740E5C20, 0x1BC9D28DA95F6, 0x2382E3D5EDC65, 0x2A338E546966E, 0x493F15736CA8A, 0x1AB061DA49486, 0x3D1305CE9314B, 0x5D709C90A0E66, 0x69FE44D29C5C1, 0x000404E593539 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x40C8B1AA97D3C, 0x04E0181BE66EB, 0x07D95576B7818, 0x60BEDCBEC427C, 0x71DA11C53CE78, 0x0C692C804F0EB, 0x78F0265D16DC0, 0x47707FE90183B, 0x2AD3CB169145D, 0x37E7B024F11B3, 0x678273C7E3153, 0x38FFE82FCAC9F, 0x4238381379718, 0x62CFD9AF6A65E, 0x0004004513773 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x75D127667E7B8, 0x76FE47DE71A2E, 0x698C2F3B6A7D3, 0x7A89B2EFC9106, 0x7F9F06EBECB8B, 0x6D624D51BE8D3, 0x4AC8D3006B181, 0x5A7E4461FC347, 0x1DD7C25AEF4C2, 0x6B41357C71B6D, 0x671A280E75172, 0x4E83D86AD35D9, 0x4DB1BB4CB687E, 0x3189638240ADE, 0x0003540863B5F },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x73F60AD64A683, 0x6514BC8118988, 0x7A22CFE3697B5, 0x564C30BF8B97C, 0x63BD9E76F52E2, 0x0ADF32CAD9B84, 0x3AB7282C8A1C1, 0x6399300D5F7F9, 0x1F36FFB886575, 0x70BE0A310E814, 0x7CF524279E027, 0x77A3A61F058A7, 0x2CE5B044109D9, 0x760D8E7361718, 0x0003E84F04AEB },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x42C3FC71E3805, 0x5A5CCB90E9A9E, 0x6A7C32449D481, 0x4ED488D229B8D, 0x05BD7E056AD28, 0x3999F2C670D86, 0x7197727C3B745, 0x4366E95A4CCF0, 0x20839C2B8328D, 0x05B6FEF99236C, 0x5F42F68D838BF, 0x30DD70DCAB553, 0x05A434FA99491, 0x35840E498CA40, 0x00039D12A5112 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x375F0A5BB5FBE, 0x5B42D64FC799B, 0x4C0F425AFA1CE, 0x17FFB44E45C0F, 0x0DC8A85ABE34E, 0x0D97E74D73B61, 0x179554C519B6D, 0x73845C6855D73, 0x11E74AA157294, 0x7D0BB456DBFD1, 0x6DA657EE4D279, 0x0E6976CF0DCB7, 0x1E5663C95E891, 0x00A313043387B, 0x00054AC06C297 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x67325CB038C8C, 0x526CEB6AD4ED2, 0x3FC4299B2EA9F, 0x15127DC840347, 0x4F5DA934A75B5, 0x60DF6621DE510, 0x21A2AF08935DC, 0x15CE6F7B71316, 0x7C51BDD3E85A1, 0x6A22BA8DBB87D, 0x32D5AF5780734, 0x332E0DF18B527, 0x0E55400D1FDF5, 0x78B08A08E7B5A, 0x00024CCAA07B7 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x6735F93CA6327, 0x6F75AA07C8EB4, 0x6505032F564C3, 0x397F9EE994FD0, 0x35A34B97AA1E5, 0x40A39CE0C0C4D, 0x530FFDDA2BC7A, 0x4A7D00D978C4A, 0x79F50770EDCB4, 0x53D81C752074C, 0x7F4BCB5F4600C, 0x162EB5CD7153A, 0x20A371B1F222E, 0x22D4A7A4E60DE, 0x0006A45E3C177 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x1CF800F3819AD, 0x5A760CC5C53AE, 0x212A3458CB288, 0x6B490F04BE071, 0x260DAF6F3599A, 0x7CAA929CE8707, 0x6862ED8FFA34E, 0x6E50F893BEAD0, 0x2346E3AD8F488, 0x74117C79C2732, 0x608AC92BB2EC2, 0x49231AB263152, 0x4A3EA72C40007, 0x2A4A24F7B562F, 0x0003D1F8063E4 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x0A9CF8EA7A4A2, 0x01DEC4F0F71A6, 0x0602B0411DB52, 0x301BA18C09326, 0x0C86A99CEAC0C, 0x31623E3A8E4A2, 0x6F0323EDAA3F7, 0x224488A649F59, 0x0A91D540DC164, 0x56CCEF58D0EC7, 0x1594559DF70F9, 0x1C312B109BB17, 0x71580FB9DCBD9, 0x5D7203B7FDCBB, 0x0004D57D54040 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x0E59FB7F402C4, 0x3E302D5EE1BE8, 0x7FD938AD32B3A, 0x69D2F23EDA122, 0x5BCB529BAD208, 0x277D2BB582FD4, 0x259218D34A18F, 0x405FCBE570168, 0x52E401A5A6348, 0x0DD0F014C887A, 0x788697A6C9135, 0x5B420EBE037CC, 0x2A9767D0D5B10, 0x20AE04472A198, 0x00041B5F2E90C },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x1A1859B12B2EA, 0x5A1EF1F2A2A0C, 0x2B5B3E9DD7915, 0x25947B53481D7, 0x0EFD6F23631F2, 0x2ADF7CAEDD661, 0x331A6F34E1AE4, 0x2D4999E24EB70, 0x3C7A1B3D41217, 0x691293FC1390E, 0x65589F830EB38, 0x2AED645337BAD, 0x233E072199DDF, 0x0CB641D530565, 0x0005A94FB6BBB },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x4B335D5CB6112, 0x316C45A3BBB34, 0x4E7B8A0E56D8B, 0x456AB06B71065, 0x74A3689ADFBE8, 0x5329AE28A9F2C, 0x1930DFB617BCC, 0x010274AA5DAD0, 0x57C393AB7163B, 0x5846545E2BFA6, 0x6B585421522E1, 0x55A346DFE0D60, 0x4CD66B0C08F9E, 0x3B909EA252EA8, 0x00025C6F012E4 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x2E31DDCC768F0, 0x2F95719C58B17, 0x057DE8E140774, 0x7361F94C620AD, 0x129035AC7767E, 0x0D672184F819A, 0x7401D66800409, 0x2E5A0B0BB917C, 0x087FC2DA26F6B, 0x24A9E80FFDC15, 0x54A6B0FDFA30A, 0x56C31EEC276BC, 0x164617986716E, 0x3D558961A0D08, 0x000519B509A8B },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x2BC33B11ADEBA, 0x34602F1E68B8A, 0x69AE5F199ACD1, 0x423F52A2FBE07, 0x4499F317243A7, 0x427BD6A7C5BD1, 0x28C9E29E5488F, 0x09F7650A02961, 0x0BD5C23D2A855, 0x09CE083D2D991, 0x6E28C3D01EE2F, 0x32115306377FD, 0x3FDA1DC7B7B12, 0x514504C2A2371, 0x0002C014E2516 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x053ABE3A0AC64, 0x14363BF067A6F, 0x68022EB534C55, 0x150C72365AD10, 0x18464E4D7458D, 0x2CDB7F57A0B81, 0x2F3290B78663A, 0x66F36F5927F9D, 0x4ABB9DA644EB4, 0x6FCB3A9E35BC4, 0x5E82AB61C6928, 0x0851FF801AA2A, 0x58536DBFE4524, 0x17A8B77F909D1, 0x00045C331007D },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x639083EBFDA48, 0x4F9F8105F83BD, 0x130DA842BD3F8, 0x4EED92766A47A, 0x5010EFBBC8D61, 0x2B37F45A3DE68, 0x2508ADA6A5FDE, 0x1BF067D4E1EE4, 0x4ACD5224C3881, 0x6C13E4945C181, 0x2753E9082D660, 0x0E2CFAA2EE436, 0x0AD2FF7526E65, 0x32006D3C99064, 0x00044B742CB05 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x0ED1EC8C107C1, 0x0B6B8D423EE8E, 0x1BDFDF2C90011, 0x005CEF385AAB3, 0x20896EFA04CB4, 0x4D5082B5F487C, 0x12632C5E837B5, 0x5B781CD60F9B8, 0x3F119A36D0241, 0x5BD4B26CD05B5, 0x57EBCB736369D, 0x6826171A3FA4C, 0x15D57682E4FE4, 0x0381DC186DF45, 0x0003AC3A8757D },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x7864AFB53FAAF, 0x76D34BD9450F8, 0x32502C01D4C28, 0x72C5CA3C014C1, 0x046AE4BD7AAD9, 0x286E119B7900E, 0x65C2207CB7819, 0x07537CEF42F5B, 0x24CDA8941808A, 0x31CC919C9E05B, 0x242A2B4D42D18, 0x7BE16AD41CD24, 0x4703828A31450, 0x70509F4D0CE46, 0x00035F2A6AACD },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x35F1C0FE66A17, 0x778B760DC795A, 0x1594E52E3FA63, 0x20E751AADD53A, 0x2D8EE50AF3941, 0x104572FE7FE75, 0x4CDA00670BC5E, 0x5AD59A8B38D68, 0x712708B4E09BF, 0x5AE39359367BE, 0x61B5DE83E0E4B, 0x6006ED7218C99, 0x2C3C50A98F43F, 0x6A89A6E2C9665, 0x0004FDE2781C6 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x2FA7F7715CBA3, 0x45568ABCA9812, 0x1F9C06BDE6CB4, 0x7BA64B9DC7D38, 0x6FD9C4EC5EE4A, 0x497EBDCFBC8E9, 0x127BEAE84E7A1, 0x3B3DBC02765D8, 0x57979BFD53D49, 0x55D32A22DBF7C, 0x66B7FE3FA8D96, 0x3923011DF8022, 0x531F1A4FB8E07, 0x54E3A8F698CC0, 0x000315B18A7D4 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x5668506CE8B0A, 0x24C30CA0F7256, 0x385FF10556306, 0x3D9E6E7B456A7, 0x0C49AE65BF886, 0x5CF6A2371D2D5, 0x4ED224DA02149, 0x761754D1D150B, 0x5EE45604E45D6, 0x73BC57E9642AC, 0x532187206DEDD, 0x7BC9025420753, 0x30350B5A2D5AC, 0x1B9E32D8DA96E, 0x0005368ABCEF7 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x57CA0852828BE, 0x5DD15DC38FAE1, 0x5C9A121924676, 0x50A5528CF6878, 0x76CCB658C85B7, 0x5A8CF8C0F1ED7, 0x568CC2326B405, 0x5434ECB1D1291, 0x76350C1C327DC, 0x41BF381C6CB98, 0x2C8ABD72B1041, 0x2794C179F5D9E, 0x2412179CBA53A, 0x155145E163446, 0x0003570B5B26C },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x6ECA3F81B90D3, 0x3BDA8EACC0DED, 0x46203F7C0CDA5, 0x2CD4891D2E68A, 0x497138CD8DED4, 0x19AD5B44D5FC1, 0x35357E11C08D7, 0x38CD7623C2B67, 0x1ECB5DD796016, 0x377701DA079F2, 0x28E7374DE8185, 0x291CDD971B4D6, 0x62F7FE6C2DF36, 0x6EDB31BF2E361, 0x00058A9A59A94 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x355D449E3CA87, 0x2B09E74EE4108, 0x10F373E1DE1FF, 0x612B7C500ECFF, 0x415BCE7531113, 0x131AC01280467, 0x08B5767ACB770, 0x43CC66B27993D, 0x3B75323B82F87, 0x353E342B61CCF, 0x2303CB4755DC7, 0x2A9E40745E96D, 0x49E600BC1CEB3, 0x0E103A64E844B, 0x000305C2B3A7D },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x55853FF5081E2, 0x66C39691109DA, 0x5B2CD906D643D, 0x4B00F746EFDB3, 0x51E9CD32762DE, 0x29D5A71A1A58E, 0x5DE26636A3971, 0x28ACE5A782AD6, 0x7B163D37EED57, 0x76B922E60EBDE, 0x0924FFEEA9AAD, 0x176DFC59A206E, 0x6CC2631AA165B, 0x71D9A7AFEE5BA, 0x00067A1F965A5 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x21E2397D55A1A, 0x71D865ACB0D89, 0x14111CADABEF1, 0x2B2858B30BB00, 0x7752382EFBFD7, 0x78EA680818C2E, 0x78CD46171ADC3, 0x4D19F9EEEF043, 0x29355EE79E049, 0x0BB9E026588CE, 0x5E8A0FC3CD0F2, 0x239A01192D91B, 0x666578C6BB652, 0x40236D73ECF38, 0x0003ECCC4EB95 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x008A2972F963D, 0x7DAE85FD69B4D, 0x55388BB18E2A8, 0x64576A61895D3, 0x7243279517106, 0x39A409FA37C96, 0x455D98D2642EE, 0x4256833549BC6, 0x07CAFE4A157EE, 0x23794E5C7E5D4, 0x22AAF0E7FC551, 0x67F202FE7A240, 0x5ACFC4BAAB1D0, 0x3D62271D4E060, 0x00054D828B328 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x7EC7E164DD373, 0x7C5D609149C7B, 0x13E413E776A4F, 0x6FE5BCADF88CF, 0x2EC2147932DCA, 0x0D23C84819F37, 0x3397CB1A8F9A2, 0x2A585C7DC6AAC, 0x22D9A0BB5161E, 0x329FB336FAEAE, 0x251451465A3C7, 0x1A2E1E293EE7B, 0x78AE1151FBEDE, 0x2511CB374BE09, 0x0002D77378DE6 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x569445ADCF4B6, 0x7B66621B0E894, 0x4C92A303D732A, 0x296225C722729, 0x23DC2E7DE908D, 0x5BEC25176C72D, 0x745DC8017BBAE, 0x687FB88B34C43, 0x5E3F6AB36EC05, 0x7142B4860C052, 0x479F6782865BD, 0x5F8B600536ECD, 0x0557A243A5BB5, 0x5EDCC72534840, 0x00065BCCF30EB },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x11E5F5DC8F7DA, 0x03CC87EF045A3, 0x48B8957871E9C, 0x31CA7E31BA3F4, 0x0DF9BE1E052C5, 0x4669532A64093, 0x5A0317B3DCFE9, 0x7FBF485F4DBDD, 0x4086B8CB6B55B, 0x75F6646802F0E, 0x570F4E6A60156, 0x084AAC154877B, 0x05B2C49284F07, 0x73D005AF51EBA, 0x00039C0A32563 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x1AED26B38C8C2, 0x7D30A2881EFF1, 0x471835C89399E, 0x7D31EB2C9882C, 0x48CE859A86F12, 0x0D5AD50FE7666, 0x04F2D5A35D462, 0x7676437FD2838, 0x52C27D677211F, 0x19A365D185D45, 0x00D082BE86666, 0x38F994442DBD6, 0x5502C8A76E331, 0x44D1553FCDE0E, 0x000517938C6E3 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x0DD5FB714D102, 0x7B6A0BDBD8CD9, 0x3BFF74878C33A, 0x7DD4B3F33AD96, 0x6E902B2BF0FC0, 0x1166C28288524, 0x420950C4AABD7, 0x44A8986BB5963, 0x091888C31A1B0, 0x2D48C8337B295, 0x5BE5B4BE9E91F, 0x0F3E2135048BB, 0x7D3751D587B0C, 0x1F22C74A22D2F, 0x0002CF0955297 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x7604E846A8FC2, 0x153377FE8E8D7, 0x75D867FE5809B, 0x06429305F6068, 0x646B47A8A9DA7, 0x1492BA43D2A7A, 0x015735E122971, 0x2150C79FF14CC, 0x5C15E61675928, 0x5149AD373E61C, 0x589A1E41E8A0E, 0x1674BDB5364E5, 0x2D2F5B4062C84, 0x7E318A37C85BB, 0x00056273CB683 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x320DA500E00FA, 0x06A856C2DD037, 0x3605154987D08, 0x78E1A69F5763E, 0x6DAE3453D1B96, 0x6191EA1C4B02C, 0x2842CD8F88B65, 0x0076C4DFE724E, 0x2EDDA8FE21A2E, 0x44D67107D35EF, 0x73244C2F29800, 0x0B20F5E846C1C, 0x0E816F4B7C238, 0x09B2240C4491F, 0x00028C2A1C79A },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x5F6631966E15F, 0x71D21290FDEB9, 0x29F052D9037DA, 0x29731D53BFEE2, 0x0DAF40D41AE1F, 0x4F041D5D45E91, 0x3865240CF33FD, 0x1B8711B9A44E3, 0x515303C158526, 0x53BFD33B6685B, 0x346A01DC7FB27, 0x31D74F6416D94, 0x1A3ECD3D73BFE, 0x3B1160E538D1F, 0x000580ABFB165 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x0B49764E28359, 0x519D2C50C1BDF, 0x19EA27990CB45, 0x6BD1D6D0254A5, 0x349E749A07866, 0x6770C30C7C7C8, 0x4997F29A621D1, 0x1A30092DCAD38, 0x7BE61BD718150, 0x007721421B8F2, 0x285C905B9B3D4, 0x722CF16D59E48, 0x3F7554B486737, 0x41C6EE14C0A91, 0x00023EAC930E8 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x4A8E8197E37CF, 0x6878F441F5920, 0x25A9D5450C5AD, 0x55B11842E6C5A, 0x393B66C9CCF57, 0x24EF4E63C4854, 0x00B4BF081EFDF, 0x1F0D4E1C6717B, 0x2FE017D6219B5, 0x43292EBAD7238, 0x306B031BE60ED, 0x2482D0C5222A3, 0x1F73E2EB1B36F, 0x6691E7E3C010E, 0x00064F1505156 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x3F77438E4E435, 0x2E8763E2C8691, 0x796F2F338C271, 0x5DBC98757E9A1, 0x64751AA047CB0, 0x4E982854F517F, 0x51A8C304A8980, 0x794F04BF58DCA, 0x6D41BB60A6FBE, 0x347857E2CA676, 0x190DC157B9BF1, 0x77FF648A49E69, 0x5B6CE48DC92FB, 0x553DF21881D9F, 0x00039DFE10DA1 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x3F6BD2DA3AE2B, 0x744979132AF7E, 0x5391B14A7381E, 0x6CB008BF54CC0, 0x742A6E6843F6C, 0x1F55F6AE138C2, 0x6989EA8020E8E, 0x42BFB0A0535D7, 0x5BD6638FBA14B, 0x324019FF69180, 0x5E14A3F4CE4D7, 0x64EC7FD654C0F, 0x11878889C8450, 0x2D053DFB41913, 0x0005D6B43BA5A },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x75DC50C9EB951, 0x32441923D2E17, 0x47CA0E4E157CD, 0x12DBB9F967BA9, 0x4FDE807D74E9F, 0x6B5A59ABC9D0A, 0x3EF8B44B07532, 0x2B0A247564029, 0x4EF0EAF1A3638, 0x05ED38C3A9C6E, 0x4F538B4016146, 0x5AF071143392D, 0x26D073FDF4CC8, 0x4A79D3DB9C0A1, 0x0004270357A19 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x60B780D52332D, 0x7A7320D7E4504, 0x427BF85259591, 0x4F404618FF4B7, 0x550FEC17086B5, 0x5F756EE14E260, 0x60ECD2573C725, 0x3ED322F65EB83, 0x76C0AF95CA351, 0x458ADAF4C5B3A, 0x6B5EEE791E634, 0x0579B99FF6508, 0x621FC541496E5, 0x0DC3617007B65, 0x0006D10D90C94 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x7D76B006E00FF, 0x6B30CF9CAA5FD, 0x69107CE4C1EFE, 0x53718297145EB, 0x6F5A14F457649, 0x522CBB8A30BC6, 0x12661F0D5D794, 0x605CB6AC47122, 0x19CDE51D826C0, 0x3B7BC03306DBF, 0x34A12C4466ED9, 0x564B837E450D4, 0x29FE8BB2C2EF1, 0x4C9725A1BD4AE, 0x0003A7A4DD23A },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x6618273846293, 0x156E3D6AD227C, 0x296D703AF03E7, 0x4DBCEECFA5569, 0x12458509D7EF6, 0x63C4AE8C81DA9, 0x2112277AD8AC2, 0x7C831A67A03C0, 0x6681B99FA35A7, 0x4BCAE75C22E5F, 0x021C59410EBC4, 0x25D5833CEA462, 0x10F67D272BC18, 0x79F25A94DFC2D, 0x00047410E5992 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x072DFDDBB7CC5, 0x13A39CD643107, 0x1505BFCED15C8, 0x25F46419AAF25, 0x341515E8616FC, 0x08FF2F7590EEC, 0x2BFDA497F312E, 0x366814DB6E523, 0x35243DD2109FF, 0x3E5DD162A67AA, 0x21AA4A47D3D2C, 0x2A881A5370383, 0x331E5C556C79C, 0x1F027EA4AE3CD, 0x0003AF0FB2D4E },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x5791AB54B9F36, 0x35EC6A6FE3236, 0x3BB23D6E5A703, 0x2B5B3875EB238, 0x42A34D29AF4C1, 0x2CBBCB0FB8F66, 0x4379C40F08BB3, 0x6825539BC665F, 0x6EC4AA03E8931, 0x03D01AA138D0C, 0x39BD25F5B14EE, 0x5D6BD9794EB6F, 0x731EFEFF70B61, 0x04E65711275D3, 0x00051CBDCBEF7 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x381C25E46D9D4, 0x69809766AFDC7, 0x56A38F0A10981, 0x482E1B220DABB, 0x3E479E63542E7, 0x0E2CB0321F507, 0x28A8314383D78, 0x6F970E0909D88, 0x0B1BA695C9449, 0x6BAD64CA20C39, 0x4C030B178DA69, 0x449AA64DC7C01, 0x5B3D2BC6B72AF, 0x18BBF2AFB13F2, 0x0003E5B1F85D5 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x0A74A593CCA8C, 0x1C2356520D081, 0x190C5E7ED2E70, 0x53B69E5991151, 0x14BEA3D1A4D6D, 0x3AAFF53284ACB, 0x1CAA105AA495F, 0x75DE443EDCEC9, 0x33DF7D36DD179, 0x3F47D09D124E6, 0x4CD9D9111FF25, 0x509C2B9E2A71F, 0x114E764FAA3A7, 0x6094EB22B5FC4, 0x00058C9352351 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x24E6B2F3E56E8, 0x4B6D09AEA9413, 0x593A60D76B060, 0x3EE556F95A012, 0x7907438864FEC, 0x3584FB78BCBCA, 0x03E920ABCA798, 0x0870C5BCE5955, 0x451701F91CBE6, 0x4E7E8AB5FA32C, 0x5131CDD64EC8F, 0x011954A9510ED, 0x4D1BA0561872A, 0x3E756A48C592C, 0x00037D0574866 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x0A7B56FC1CAC6, 0x042558CB2FA3D, 0x4BE5964CC39E6, 0x734CDBB371C08, 0x069AA065CD2D0, 0x199C568BBF203, 0x207C57B77C5BB, 0x7CB446457D22E, 0x7F7C1F5094FCB, 0x59F404CD0313D, 0x05F07F5A186F6, 0x657499FA972A6, 0x3D97F02067B65, 0x0FE323928ADF2, 0x0005003E65507 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x02E4687640502, 0x210C4FFAB1C56, 0x117E54923EFCC, 0x22AF656144DAB, 0x30822DF25727B, 0x6EAB5E22BD8A0, 0x5CF701569D267, 0x357788EB80BEC, 0x184CBF66FB201, 0x7F28CB4182CF7, 0x195A99FA333C8, 0x17032905ABFA4, 0x795FCDCE97C46, 0x3CDC606CE9268, 0x0002532E2E630 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x7FECE26C2BFE3, 0x034C17BD0C7B3, 0x3672B694BE6F8, 0x4DBA7748A82A9, 0x4D5A92BD4D7EE, 0x16F339861D2CD, 0x66FE64E92500C, 0x6A1487E5417D7, 0x619563596341A, 0x64E1BA080A828, 0x25C321A911464, 0x1D396AA83CC2C, 0x5D8570782F772, 0x3C6775B59BA89, 0x00050834F95E6 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x6EB16E8431CBB, 0x34393EBC4B30F, 0x58CD783AF45CD, 0x52961DA2D5401, 0x5C46761A55A5A, 0x4B64A09F4D2A9, 0x61945C7309E40, 0x2520874A084E2, 0x1F7B00EF30C74, 0x2F7E31E161FB8, 0x75FCB0B2F6CB0, 0x1EF1A0044B17B, 0x5F777A2FC0887, 0x366555E37339E, 0x0002956DF3694 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x6BC99D730B858, 0x30A0FDF03CCBC, 0x2CC2209452825, 0x26E2C1EDFC2F4, 0x3A5BCA399D71A, 0x692E8A7EF5DB1, 0x27AB90565DF43, 0x0D4178B7D7B3E, 0x3CD73B3622784, 0x2A08C8BCAA6EB, 0x6CAE549D29E95, 0x451991B5F9CF5, 0x1AD508B74005E, 0x299792885FCD2, 0x000667951A469 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x295301C794494, 0x4CDDDEC0D0213, 0x7A1B38707BAF0, 0x6CF46B1C38B43, 0x0009DD2A845E3, 0x34DA3C64AD902, 0x029B8BE489769, 0x243C1C183D142, 0x541D501154E6C, 0x402063F11851B, 0x70DAD0D585DCF, 0x2BAB86F95B120, 0x07902ABBE23B3, 0x06606B178793C, 0x00032B4B4F2C1 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x60DACEB18D209, 0x649E4A5C2D6C9, 0x7E530213C34EA, 0x6E496C8A57061, 0x0E24F61CC1E19, 0x75052F384D57D, 0x2EABAC4106381, 0x58AC93C55B2B2, 0x1E14761E668D3, 0x452320C3A6661, 0x5D02CBD840777, 0x381E60C77F0A4, 0x27A3706BD7AC8, 0x1A83329D71967, 0x0004D4E7551AE },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x00C27230AA519, 0x4D4D75B56D201, 0x4424BBACFF360, 0x0D582A7F15EE7, 0x330E4C47C1B1B, 0x61B603B7F1A5A, 0x55EE3EED8783A, 0x3723BA19A2ECE, 0x64910BC046D39, 0x6E6A34DEF15BF, 0x426E5AC36B627, 0x593DB18DDFF49, 0x4C3661E1307CA, 0x38B565FA8B731, 0x0004D38F7699C },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x0072509A8BD27, 0x648B7E1AB4D76, 0x2D142CB0CEFEF, 0x73B315F6BF76E, 0x3D29970C2C371, 0x6646CC97F95D0, 0x7D97DF78CEE59, 0x3AB0F1F26363A, 0x6852D3F5C3EB5, 0x5BFA67752B6BF, 0x7AB607D11C0A9, 0x367361ED2E3ED, 0x15E64235D2F9B, 0x4200DEAAF4D8A, 0x00058F499AEF8 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x2CCCA8A7F4CA1, 0x46545268F7728, 0x527DF14BDFEA6, 0x5B8B57A1A5730, 0x69EB50AF63438, 0x61B169183001A, 0x46F216721A882, 0x4769A0F7E92E5, 0x771B3312226A9, 0x7445F5E430784, 0x717D9E9A1A0E9, 0x72CD0FD20DB4F, 0x1D5EBC5FF130D, 0x5DAC44C6E58EA, 0x000374E0B1BBA },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x52BB2B410A7CC, 0x50C0630C4893C, 0x791A86B7C5BC6, 0x595402F8A97D1, 0x152BB973BEBF2, 0x2122E3A69563A, 0x0F0B4F4F26CCA, 0x34BCF2020718C, 0x6B639F4F6D91D, 0x3BD00E19B8A6F, 0x331AD514553C6, 0x19A9FB2A54ADE, 0x67082EEF89A2E, 0x77A545B08CF6C, 0x0004360D5743F },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x0D9997F08E618, 0x546662B54BA06, 0x030B52B30CC29, 0x1D5BBF1CFE8F8, 0x7E63FF4945AA4, 0x26FD511F029BA, 0x5DB9889703D15, 0x122029C36927B, 0x0F782409F3E3A, 0x475139F2FD4D4, 0x04174CD15DF45, 0x5696B14537AEF, 0x4FC72D5581312, 0x7C428C81B465C, 0x0003955508A1B },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x022EFE181E3C9, 0x4D21B909B9132, 0x44AB45BAC5AE3, 0x65A8B4D6986D6, 0x198BB52445671, 0x59D216D7ABE0E, 0x4C32185313831, 0x6584D2520A4FF, 0x525322B8F7B4C, 0x5455E7634763B, 0x20A7301644EBB, 0x5018B45506D74, 0x20BDA3C7491E5, 0x47CE2506DF58C, 0x00063219716DF },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x36050FC64ACC5, 0x4251797333C59, 0x694DB15C25B40, 0x09E0E11BB9822, 0x3787A539193EA, 0x293FD3B229231, 0x2048CC5ACAEBC, 0x108E44C189385, 0x422C31B74E1F4, 0x0431893B48A87, 0x0407C380D34B7, 0x4F1D0602BFF3F, 0x7EBFF99570440, 0x6C111E65DAC68, 0x0002C1C928FC0 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x76A4B2DE62CE0, 0x0BC00CE9192C9, 0x076A1AA6DC1B6, 0x446EA1B2FE6B4, 0x0B4974AD9B932, 0x2943731BEDDF8, 0x1DCE9D4136664, 0x2A641AD2EC166, 0x5CCBD2A136BB6, 0x1D9BE630A5DD6, 0x0FC62473D73D9, 0x0A0397A5C227F, 0x4913DDE4BD7F9, 0x0EA7C60C023E3, 0x0005B2C597787 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x7082735C34932, 0x1C836589629E1, 0x76AFC44493793, 0x7BBF175D19CFD, 0x26767D27F8575, 0x7D3972F51EC0E, 0x3EEDB9DBB8E8F, 0x7EF519FB7B4FF, 0x2F16BC3B34A8C, 0x7A7F57E10715C, 0x5CDC6123DC149, 0x1B6052B9B6277, 0x4839CAA0A7986, 0x46EAE6271D40A, 0x0004AF0731A07 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x1242731DE2BE4, 0x052917B5049DE, 0x3A713495AF857, 0x0D4CC6E5C9780, 0x6C54C352F0EEE, 0x1EA2EC427C607, 0x7B144125BB4C8, 0x0E97A6D2AA689, 0x0288ED4AA4D49, 0x71A75703294DF, 0x2720361E54E4A, 0x64F876D7EF0D9, 0x4DF31F01A336F, 0x3742C98377156, 0x00052FB411136 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x3649A2047A540, 0x46D2E5DFAB3A9, 0x25327A4C461F7, 0x38A749B523E7F, 0x5CB6A1204DBBB, 0x5F1DF43DC3114, 0x7134E87A60A23, 0x609B62DB73113, 0x71E843F243575, 0x1441B8FF3B102, 0x632A4C2CC429E, 0x6881641B43A0B, 0x4DB2E35D82C14, 0x4C8890DFBFA4E, 0x0003850CB1C9B },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x41B33CCD99378, 0x01CDA1B7AB897, 0x746CF1C24398F, 0x6B9CE8DB6D032, 0x45EE009D99F66, 0x18065B40286AB, 0x518BFF95F1D9F, 0x39BAF3B6DA146, 0x46E88C25A26BC, 0x1B35CB453DAC9, 0x5D2FA11866F78, 0x21AAB10CA5D02, 0x5C3B48DA523BB, 0x38445998FAF60, 0x0005B1542938E },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x0592A8CDE4B48, 0x307F42CFCD932, 0x4BE88742DA2BF, 0x7A92106435D21, 0x218C38D367F80, 0x6EB60115B97A9, 0x5E88EF22FB75E, 0x22CD13428B97E, 0x3B1201AA49A7A, 0x42FB6A8A68A24, 0x60663E9C1C391, 0x360524AA3A002, 0x617BC7EA86985, 0x0ED3014F889CB, 0x0003A31A08439 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x08E7C5AEB4C4D, 0x4BA5954D69C15, 0x5E66F49B6F56A, 0x3EDE47C3524F9, 0x26FCA33EDCA0A, 0x32884E09087FE, 0x2C4E6B34480D1, 0x277FCCA7C7FB7, 0x044DAFBBFD473, 0x0BEA44E064576, 0x177D96FD9D0DF, 0x70988DE29CA65, 0x106B2CDD17E40, 0x5FD73CB03ED5A, 0x0005AB6A27A6D },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x3778AD53B3E71, 0x52FBE7F7B8A6B, 0x51A971411BAAB, 0x3850729CF4E83, 0x6F7271F5A299A, 0x1575EE87B0841, 0x0450A93535E6A, 0x118DF4F7B3360, 0x16A5289143564, 0x282887F07B688, 0x639C19EB3ADD1, 0x06F831BB76777, 0x646D87C76D3BE, 0x1EBFC0F83C8E9, 0x00049C8108432 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x5890869ECAF3A, 0x37744AF841952, 0x69EE8AB7688E1, 0x06A6C78C4D649, 0x1EA06A4A318A8, 0x307CE6CE481BC, 0x5C3A628A3B104, 0x195F3AC1679DF, 0x7C3AB7A377FE6, 0x23C46E2FAF97E, 0x119EEBD7F9ABA, 0x1227077745B08, 0x6E28E951556EA, 0x6DFF552FD68EF, 0x000485B20BCC9 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x52B5B4F8C872C, 0x3880D7FEA2156, 0x0FFA42947DF3A, 0x1BF6D68D994B2, 0x2FA08C2F037C3, 0x4742ECA0D6278, 0x1494267D556A6, 0x3547EBC9EBB41, 0x2AFEA4D3EFB5B, 0x238E590FF8D43, 0x315B2D45108B1, 0x7974B14EF6AB7, 0x79219581713E8, 0x6AA3CFF85D243, 0x0003ED9A5EBA0 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x1F5282B81D4E0, 0x00B51E2611EF7, 0x7F1F081C260D0, 0x4B5B3FCF4A772, 0x4C1ACA8F1B978, 0x103098FAA0612, 0x73CA10D5A77A1, 0x7F94E5EF4435F, 0x201DC76F2AD85, 0x592627342FBD3, 0x787E0D080FAE5, 0x0C6E96A2B582D, 0x3EEAADCAA9942, 0x02D48C781B73B, 0x0005A2048C8A1 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x66FB24211E264, 0x188A2DEC4D02D, 0x31E5E64231571, 0x12B318B56239F, 0x13B0F9C34E8A2, 0x49A705765AE4E, 0x5752F6CC80253, 0x073F4F054FE59, 0x4EF1C34448EAA, 0x762554DFDB380, 0x0D4E62D418D09, 0x68E7F146D6C68, 0x5FC11EB444DA6, 0x57E9D04DECF68, 0x000397B21B73E },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x0A83225EC9249, 0x6E5B8F14C8CAC, 0x0DC3453AD5349, 0x6C229D6C8A6F4, 0x68D507B300707, 0x58E6E06AEF47E, 0x7C6C0D9C76CFB, 0x58435689C9F33, 0x3D93BC32E22D2, 0x6C9EC8DC497CC, 0x373149D5DF167, 0x269480AFC6603, 0x165EF5258B016, 0x66FC273A9A7B8, 0x000520581C197 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x681DA1FFA1D27, 0x27B4FC0866264, 0x73F6AB2484CE9, 0x70DE690166AFA, 0x5228A04325DDE, 0x50E172CDE7E35, 0x0E705FF0E7842, 0x4F4F1394C98A9, 0x72249D34252B7, 0x4C6169AA8CBAE, 0x48EE7772B4114, 0x10F54AC9C489B, 0x735FF825C1570, 0x127AD54498D95, 0x00039991B616C },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x00CD8C070E04F, 0x2476487AC3B30, 0x45CEF81EF3707, 0x0DF4326831459, 0x2612BA4968E2E, 0x159B3A5E32A33, 0x74196C72CD293, 0x1580E9811BEB9, 0x4D2BE8E311017, 0x18CF5C03E3C93, 0x14C7DF34D4F4F, 0x723CAEE157316, 0x709520F101926, 0x0D14B942B8ED2, 0x00062010E4BE5 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x3BA247E93207F, 0x23EFD592C13BE, 0x2B69EC00BAC5D, 0x07B323A23FE76, 0x3F6E6158FAFE7, 0x09B11FE7DC33F, 0x7150DECE7A51E, 0x4D3DBDC683AA2, 0x2E0B0DE9F0D7F, 0x28794B85D86CB, 0x7E387F50ED662, 0x24D4C121A03B2, 0x4A278884DC052, 0x01C6A642B9E18, 0x000317A462DAD },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x547711B248A9B, 0x56E28971D51CE, 0x07E9C6DC0B436, 0x11EDD86F0CF67, 0x41BF8DD3A614B, 0x17F8ABDCAFA62, 0x18FC4F5B7E41E, 0x1B6C0FC5BDC99, 0x2F579D046A46D, 0x70497930F891B, 0x31ADBC8EFA97C, 0x4819530228BB4, 0x56767E40171DF, 0x57A4AA534C6BC, 0x00045D9408942 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x545594D4DC90B, 0x14339D24D346E, 0x61AB80E742DE6, 0x5105925682366, 0x53A2DF2B17D49, 0x681F8ABBD8562, 0x40147B7EE12CF, 0x7E227ADA5E21E, 0x75595102A26D7, 0x627FB316696C8, 0x62B3842E6A913, 0x07CD166369704, 0x00FDC8BF815C2, 0x3C7AD82F586C2, 0x0002E9FAA49E9 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x726BD3BAFEE71, 0x590FAE868318B, 0x5B7A73135FCBE, 0x4B47CABE909AA, 0x47EDA5E266D6C, 0x2D4CA0F452339, 0x7FCDECBAFBD7D, 0x71DDD5D512E84, 0x785AE82AF719D, 0x54207407633C3, 0x3F6F161406B6D, 0x3B77F9569154A, 0x5791F5F46A5AE, 0x43BD657660B09, 0x0004E2000965E },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x3B56E9D51C627, 0x7D2BDA3072A2F, 0x1A3DC7FAFC86E, 0x495FEAA4617EA, 0x4F97052D421B1, 0x3019F4C966C76, 0x5699998A58560, 0x18A38520561F6, 0x3CED2590B6A08, 0x6E039453D1DC8, 0x385C9F6D4D8D3, 0x0B0D68B483835, 0x2407BF6C14D8C, 0x214789F56FB92, 0x000424AE29300 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x2BACF2B7A64E7, 0x7878ED85F1ABD, 0x1BBED553C7687, 0x2C2E2C01DEA9C, 0x42D31172C2E32, 0x705D74FB283B0, 0x63262852AAE3D, 0x2E397E39F3088, 0x74FFFFFA9D99C, 0x38C260DA5258F, 0x043DA1145790D, 0x15AA8FC57524C, 0x541EBFCB19C9A, 0x36FA1A8BD5F38, 0x000596738866B },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x08E4773C1617B, 0x09C2EE939F9D8, 0x7AC9ADEA88A11, 0x587D681E066DA, 0x7EA1B880C4716, 0x05EEDD6D471DC, 0x57E403B77BB80, 0x365FFD55E3120, 0x44048CE2A43A8, 0x79379EFC07DC0, 0x672C63EAF058C, 0x6935797E0D38A, 0x1423DE55ECEB0, 0x3EF99E0B1BB06, 0x00029D4E91A17 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x6760264933D69, 0x5E420A18265F0, 0x2EBDC89765F7E, 0x0CFDB8A735DE4, 0x3BCA8A50B215F, 0x660730306FCB6, 0x40BB247FD0904, 0x61441E01B693D, 0x1122A78D996F1, 0x21B6842EA803F, 0x4F06412AD30CC, 0x5C5C371B4C55A, 0x490457F347CDD, 0x11B3ECEBE2B4C, 0x00061139CD517 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x0555A639B7CD5, 0x1016583A02214, 0x720CCC4372C84, 0x75BC0AC5C5E77, 0x1CD5EF57988E1, 0x41FE182D952F6, 0x75CE241641806, 0x276A7C3A8B272, 0x53B9C1FF03ECA, 0x269E5940D2181, 0x3989F9894D3F5, 0x37A69EABE54B8, 0x5963014D14D89, 0x7CE679CB47413, 0x0003F699898E1 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x28E9321BED364, 0x4F990CE97C0D4, 0x43D440768D172, 0x54812A850A162, 0x5BD7EED21A219, 0x686F854C271E6, 0x5A33AA57299D4, 0x4CC6E6E3A7F78, 0x3959B32693755, 0x2F4B4B609B112, 0x086ED24BEB228, 0x0158BCC26D0A5, 0x55F6251536C2E, 0x788A3F0C74E38, 0x000650E9E3D6C },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x3339619415C32, 0x2A4A114CD9274, 0x448ABE1434D24, 0x59E6A8F50019D, 0x4A67B52349DA9, 0x1362F46E8E020, 0x486987E948E96, 0x2334105BAFDD5, 0x59C918B6AFFBE, 0x720479C4AE408, 0x4C5325D29C124, 0x798F5C90AEB0D, 0x46D5568029D4E, 0x357CE3F87D664, 0x0003C1270766E },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x47D2F08FDD50D, 0x4107D2C16F330, 0x6AB7044835DC6, 0x16F0D18BEAA2E, 0x1A4C449C69B9B, 0x519E11CD2DD38, 0x77940D65988F0, 0x77EF52C86A4FB, 0x5581190CCEF2F, 0x62892C3CC7ED2, 0x38967DED28EB2, 0x68CD20BD060FC, 0x13C147D64E9C1, 0x314B84846FBF0, 0x0005786EADCD8 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x68C9840CF6B5B, 0x66B763A0B4671, 0x466857F4BCFEC, 0x325D2622AC0CF, 0x53C6C501100E2, 0x6EC3F6F556B3B, 0x221F950135568, 0x066C0FDE8FA3A, 0x0E5ED78BDE5E2, 0x60CA79E9DC8EC, 0x10919D6B44110, 0x1F8508B0446F8, 0x1A70BBAB249F7, 0x1CB69D3FC5646, 0x0003F6FFCF434 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x190AECE22E2E8, 0x2F02F6E12C1E8, 0x45EB24A009A9F, 0x2D7F0D5275574, 0x7EAD7E581FB4A, 0x3B9C67648A56A, 0x67585EB290FDD, 0x2D43F81C71E98, 0x3C14055068D66, 0x555BFB4D851C6, 0x5A90531BEB8B7, 0x0B7AB32F78CCD, 0x59BD24E47BB78, 0x1B44828DDD553, 0x0005CDD001D75 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x75A0A2039D664, 0x48052623BA65D, 0x68F886E56BE44, 0x281D33585E432, 0x03C4C5879B3F3, 0x7047099A82AD8, 0x5E8CFBD685F59, 0x731E1ED41C4B9, 0x6B42504B18F54, 0x1B69C69C572FB, 0x7A6466AF73F05, 0x4B1753E799E6C, 0x217E6BE5E2A0F, 0x41DB47CFCACA1, 0x0003962F439E7 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x5E44C5C1E12A2, 0x48D5EF89FBEEB, 0x32F12E310A45E, 0x72241281D2704, 0x455F21C8B1A73, 0x72458EA1EC8C0, 0x799C45D4BC368, 0x65254D4266C08, 0x6090A0F39F686, 0x15172C7AD653E, 0x73DB397B8468E, 0x4E7A6D0B9443B, 0x459EE12895058, 0x729DE29A87256, 0x00054FF32CB92 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x303200375D5BC, 0x63989F0849700, 0x18F3682730B80, 0x14BF0CB38DB8B, 0x2076785F329CB, 0x5BEE38FD36E81, 0x1459E66CF2EA8, 0x75C89CB96B3C1, 0x19E81B723CAAB, 0x59461CEE2E7AF, 0x1B038A5C19519, 0x20B988FFD4C35, 0x4F950C6796C01, 0x58BE15BC417C0, 0x00027CBC705AB },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x0BA0D19EC65C2, 0x41C5EFC8AF06B, 0x0626997BDA525, 0x47DBF7B88E77A, 0x7E21A6CC4EDE4, 0x507F4F0874669, 0x018F72EAA4991, 0x3794C76DC9441, 0x7F67E47BDEDA4, 0x4070A1669D396, 0x766644D0C3FE0, 0x2981D208DD706, 0x72AADF46562EE, 0x7B2AB46F0E7A5, 0x00045B024C15A },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x3089891FEF524, 0x41C8CA9D89218, 0x4771C1E3EB2B2, 0x112851F83ECB5, 0x6082FEC860D6C, 0x38A1B8B468DA7, 0x0DD309E1DE9AB, 0x6EC841EDF755F, 0x3BF678C24CFA0, 0x16972006E16DB, 0x595FA42FC379C, 0x35D5F8670B041, 0x60923C465399D, 0x180BC8360AEDE, 0x00043F7D38D81 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x3FF397F2EB44D, 0x1C6EDD3806025, 0x12E9581D9B0E5, 0x4970A873E4872, 0x0675F6A02D24F, 0x17A82DE11ADDE, 0x462D687CD0363, 0x2004CACF260B6, 0x1784822ADBCDF, 0x3F4AF5BD5D7FD, 0x7B93E08178F89, 0x2CA8020E6D4A7, 0x51BF873D9B32D, 0x35E316375D219, 0x0003EED6822F7 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x37495F92D4C89, 0x15E8E2745A4DA, 0x0887605F00630, 0x4291E6050B10D, 0x1C4C59BFE06D6, 0x6D2CC39F97065, 0x7D4A57EBF2E95, 0x73F79DA739A7D, 0x1B1D39220905F, 0x217BFAEAAF30E, 0x2434A27762273, 0x295BE4A73CBB0, 0x68CB651F7C5D0, 0x49100ADAB70C3, 0x000352DE811FA },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x766F532F0272C, 0x528822F879788, 0x4939ECA982C9D, 0x61D235DABF59B, 0x06962E45FA0C8, 0x0CAC85FB5E938, 0x55FDC5371516E, 0x7EBBC1AA88542, 0x1F33D584C5D89, 0x300B49EC57F0D, 0x24551C12AE4A5, 0x7A4A6725E784D, 0x61AC485D61C88, 0x48C1317D3A7BB, 0x000502FCFC05C },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x01F4E2D9248CC, 0x157EDEFB42EC6, 0x4A6901847053F, 0x7ADD27B3B64A6, 0x76724C012A4ED, 0x1FB037EBE6629, 0x6BD36DD3F65AC, 0x7BCCE7F1D6C47, 0x65A8B1075856A, 0x1E2B242274B1B, 0x696BFCE87DA39, 0x1E1E5ADB966F1, 0x3DBF21C778165, 0x6F56A1BB9442F, 0x00021BDFA6379 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x2E98BE10F8BAB, 0x397D4733C5AA9, 0x2E9DA19B1E307, 0x57A270BE186E8, 0x75EDE0EEDA178, 0x6A34380B2CFB2, 0x28DA4A02CF9B9, 0x3D12F60FA749C, 0x0B883C8969A86, 0x354184FDEC247, 0x1CF522656FE41, 0x151D764E22EAD, 0x4C2F5B52F7162, 0x680A6386498C7, 0x0005334C0351A },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x27F1365E7964D, 0x5A70F51E2AF81, 0x6F6BF20777701, 0x308C725309D3D, 0x20C4AF8922DD9, 0x7E82AE04034C7, 0x731B3D3195310, 0x5B95E4735551F, 0x4C69FDA35C235, 0x4019589F9DC3C, 0x1FCB9D0B00DC8, 0x1656FEEF92380, 0x70373253C6B6F, 0x1D2D3401DCE63, 0x0003A7D561E2F },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x217B3295EB1FF, 0x3FACC91EFC80A, 0x44E846C1F6908, 0x2A0D7FE6AE405, 0x57C30F483D8AB, 0x70D6539474B44, 0x1A3B7ADE7FC4B, 0x54D984472E04E, 0x5546EC6DC7902, 0x0AE184AEF54F0, 0x35199F4851EC7, 0x58E450821259C, 0x11CC2A26D0404, 0x201769FA3D810, 0x00049C35568C9 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x507E07F626791, 0x42B3DAAFCD59C, 0x647D089AD8666, 0x7F5A28CF3131B, 0x6CE9EE92DC344, 0x3CF5275468207, 0x0A78DACDE39F1, 0x306387C371503, 0x23731912A59FF, 0x33E063B6F96A1, 0x409EB88B71321, 0x106876F644D16, 0x207FE070A3A6E, 0x5CCE763A28EE0, 0x0003C8BA6C6A6 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x00F5735544954, 0x4A8234072DA01, 0x68F4CDD89093F, 0x610CF1E83BBDC, 0x3C1CF2B511214, 0x49CDBB4810A90, 0x73D6C737877E2, 0x24A4C79FC83D1, 0x6AF30361DB64B, 0x11FDD736F859C, 0x48A39AFCBCC07, 0x4B872A5243132, 0x1E046A7D38012, 0x7F64002BE5C36, 0x0004EC13D0FB0 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x3CC2150D4672A, 0x6CDDC882758C0, 0x169497FC53D4B, 0x5004EC974B39A, 0x073E3280664F0, 0x1031A7F2E0B7C, 0x4B172C637AE07, 0x5B90C2C0F4FAE, 0x6BB742A4B5CE8, 0x686905AAE17C7, 0x085CD55B8F20C, 0x680F9B98BE203, 0x178FB7F0781F5, 0x4DF7008EB19A9, 0x0004A5BF653D0 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x55A5E9ADF79E3, 0x44B1223395903, 0x7A8208C544424, 0x4E2E61ECADA5F, 0x6C4BF01DF1EAE, 0x20631C73ABCEB, 0x5E0F88B1EB553, 0x17236E544038E, 0x7588F85C6A6A9, 0x28EC848A11F23, 0x6F2EF50058093, 0x0B42DBF9072FA, 0x51ACF923E1201, 0x6C0E79CF7A3EC, 0x0004C320E7481 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x02B88B6A4CDE5, 0x51159E3F336BF, 0x50794A06D29C3, 0x02970A92D7B5E, 0x465FDFEAD7F40, 0x73ACBF49F1543, 0x1F83E27FADAE7, 0x2EB93361912E7, 0x1248B9A666ED9, 0x7B58F630D9F33, 0x25EC5169516B3, 0x0A0C025DE9842, 0x54C64A0B31D05, 0x1B6DA3DA1F19D, 0x000335CFBC69B },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x58B1F4CB11DA7, 0x578A7207E050B, 0x1AC852360CDEF, 0x18E0B0ECF04F0, 0x6324A92755EA1, 0x4DCF357FA6A3F, 0x08FCEA480E834, 0x45E5884D750A5, 0x721418F4560C8, 0x551E835D50EF0, 0x5A5A17FE78E9E, 0x554D981C465D5, 0x6DDFB4E2D8C66, 0x0B8A52C37EE3E, 0x00058414E2A73 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x3B57F2FB71409, 0x2C3B86BA33B23, 0x6627536F4C5F7, 0x5D1DBBF0725C5, 0x18AF5E3723995, 0x4DFC7A4D09F1C, 0x0CBE7AC522616, 0x6FF1D81805CF0, 0x00880BDFB331D, 0x1597429403F12, 0x0B0794CC7A113, 0x5A85DCC06DB83, 0x6E1C318835107, 0x77CBCB8CAF05E, 0x0002C4DF91788 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x6F7F38E147ED7, 0x7456DD706E161, 0x29DF79183198C, 0x4A6350D4A2369, 0x107203C44DD37, 0x5B78B982505FC, 0x6932111F1C95C, 0x0712416557269, 0x3FBA0B7C458B1, 0x2C29E0DC3A0FC, 0x4385FD5FD597B, 0x0A78C029E82DD, 0x47F7BD56C2D60, 0x28C509B00A32F, 0x0005BC77FC2B1 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x5F1AF5E2450E3, 0x325D635215F62, 0x504A051AE3376, 0x4456AAA6050D3, 0x0E55040914CB5, 0x6BD8416E687E3, 0x013171B69D19B, 0x581100C40A98D, 0x18BFE1DC3A0C5, 0x7B1A20926A9F4, 0x12D904EB9B954, 0x02279F074DE1C, 0x47FDE6F6C4760, 0x7557A678E6BC1, 0x0004B39490DEA },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x0E6263FD54189, 0x69ECE7EB81E62, 0x1A627D7EF018A, 0x59EA8C07F7591, 0x6EA428903CEE0, 0x4509984C98AAE, 0x248939854CFC6, 0x42E27998AB830, 0x1CAC5DEF8E9F9, 0x197C2A0CA86D1, 0x29A38454FF35C, 0x78CC9B20E4FC2, 0x5E3CF8A20CC76, 0x3567E09F51572, 0x0005570083480 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x5B2BA0CA6E9D3, 0x5CFB09EB5B9B4, 0x04B88C4C9F3FE, 0x14C537C3645F6, 0x4E8DF8A43D0DC, 0x0D5D8312DC614, 0x2CB1BE04B6780, 0x2E3C9F54D6A04, 0x2C446111B42E8, 0x5E00FD69BDF7F, 0x681175F6571FE, 0x031A6AC855945, 0x09FCD5E953138, 0x0934FDCC911AE, 0x00049B9110589 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x7876A17C207E9, 0x22529FF60EFCE, 0x21F53DE3452F1, 0x57399EF0C48B3, 0x764D5569C0333, 0x5BAE8409E15FB, 0x068806F0692E8, 0x7E9606C7ECE27, 0x58E832E1703AD, 0x6F568A60B264B, 0x6E07E6194279E, 0x1A38DB98C0956, 0x6A531AFFA5C5D, 0x6B121D0FFF0B0, 0x0006AABB3F5F6 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x70BE6FC2537DB, 0x1FC8D8A551FB8, 0x30BC740100801, 0x307C9F4DEDAE1, 0x3800C1A131062, 0x38D6ACF9BD6E1, 0x27AD63C0321E1, 0x2058D60FA2887, 0x22529C491C375, 0x75014983479D2, 0x1277081846F03, 0x423D58D7A0823, 0x2710E28D61705, 0x20F8B183E6DF3, 0x0003C53D970DB },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x3CB0C84F4E96F, 0x6A63BA275818F, 0x497884E3715D3, 0x15B48FA160BD0, 0x3FC098636021F, 0x47B7663C3FA25, 0x1E5A4CF92071C, 0x4F0796F82B39C, 0x11503AD09D629, 0x414B8B8FB1208, 0x5F85F0F1A6934, 0x15FE18645BF92, 0x47E9CE7F32F99, 0x70034A06ABB0C, 0x00058F74D48D1 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x492076AFDD091, 0x02A43DF3F33ED, 0x0EB78EBDE2C5A, 0x5F6A39D38BCB7, 0x1B5C85616A8FC, 0x6DB43E0875BAC, 0x6BF1D5D440863, 0x3256693FAF617, 0x4C499F117AAB2, 0x447E1F0F1B08A, 0x1F4C3889E6A01, 0x751D9AB3D4B32, 0x293332E3A9437, 0x197E463E3138C, 0x0002CEA67B3BA },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x1019C70350EFC, 0x0D8F423DBB93E, 0x086F4E1CBC1AD, 0x4C1BABE4F6848, 0x4FF6DD5666340, 0x1AED2FC99CA8D, 0x3A16D50B673A6, 0x014AECDF870DF, 0x018E9EB90A365, 0x3096CACB5F8FA, 0x48D65EE853C4C, 0x6ED2632E3DD7E, 0x2149F496A32AF, 0x6F3BD4B4DBBC6, 0x0004FD8A644FB },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x72C96AF9E13AC, 0x6A467C65BC9A3, 0x015B17999D315, 0x72075EA6B8578, 0x34112144EA639, 0x2F956E6DA9738, 0x0D825B0B43C86, 0x2650F8192B0F4, 0x4F324110FBBC3, 0x46202E6659E94, 0x366D7C61159B6, 0x5F8B813C0789D, 0x6CD894636A402, 0x2D74681C4CFC6, 0x00041856FE990 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x4DE1C84E4F17F, 0x64D03252A8B23, 0x638018FC5C02E, 0x38D1EACDD6302, 0x7B5A00C846249, 0x2BDF672161376, 0x2045A9CD9CC2E, 0x7D71F8A7F5954, 0x31AA51AE8DAEA, 0x5D28E140F1103, 0x2C35C5D51FFA2, 0x071ACE2FED6FC, 0x6C578548EB6AA, 0x3140A06E4838B, 0x000643906DE3B },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x1B2F46D42359D, 0x48F92FAFCA0FA, 0x194929261C267, 0x557C714E94E72, 0x0D0E7DAD61433, 0x7A4C9049270D3, 0x34F94C0955165, 0x649E77F07873E, 0x254E59405E761, 0x7A6B6220EF823, 0x365B7BDDDC2C4, 0x4777DC87B5084, 0x2CC5396D41AF2, 0x18D8872794795, 0x000302AEEA661 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x3802984401F36, 0x13B14D7CD52A8, 0x77387A23E26B5, 0x3E9E01A78F10B, 0x24B1313688770, 0x53380BC73A6BD, 0x5DC77052263A2, 0x34F5D446A7630, 0x0C65DAD15FFC7, 0x7FB62A8A4164C, 0x35A0D09FC4FD7, 0x469C4688B19B9, 0x6983A67B487EE, 0x4BEF27C263AA9, 0x0004289478ACD },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x2686B9102A51A, 0x79A1CCBFD985B, 0x11FA742E36483, 0x624F39AC8A45B, 0x213C5463AC839, 0x553A922EF5E55, 0x0802B68E4BF36, 0x284D6C5235E26, 0x059A5D7A51628, 0x7478C96F60F74, 0x39FC390F94607, 0x21877AC008F31, 0x5FF753E15978E, 0x018FC0AF84417, 0x0003085223FCC },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x7A6A12894BF89, 0x712E94A6F37C8, 0x646BBAAF6E670, 0x7210CA42E4C55, 0x60F39871BFB9F, 0x32040C7C83769, 0x4A607B401C890, 0x515304A31E2BA, 0x6AAB26FBEA0FE, 0x7BB1149F8A0AE, 0x1E052662DC102, 0x74B6708F26FAE, 0x499725B9FE403, 0x43654C2080864, 0x000636015AF70 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x38E304913AE19, 0x695B5A37B755F, 0x084827C7F763E, 0x5B15D04D512ED, 0x467B5BDB26138, 0x4AA28CEA9DBE7, 0x4514C93A4EA00, 0x7B29BD5D9BF42, 0x0713097240A01, 0x7F4AD5A95ABEF, 0x5485129190AD9, 0x2817A330738E4, 0x71451ED3F86ED, 0x03E71F78DD426, 0x0002F7E0B7F99 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x13FDBB55ED637, 0x68A6495410C7E, 0x6C7E1179665F1, 0x0511DB2D00C2B, 0x21CEF6AA13E6D, 0x2524AB0221817, 0x22F0BF63EA432, 0x59D520CCE7907, 0x630DA955FF2FA, 0x64DE1F873940C, 0x19A9191A770E1, 0x50E6265BEDEB0, 0x4334DF0AA679A, 0x346CC21414ADF, 0x00051B7FCBC46 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x7B192DD5A53E1, 0x08CAE53451B83, 0x4EBDF2C1E90F2, 0x07228F4FC52AE, 0x00DB52818DE30, 0x571AB6364D268, 0x53E8DF255B526, 0x1197E39796843, 0x7E7084646CA2F, 0x763F5D8319362, 0x68A0806BC27F6, 0x10D8E9C71B469, 0x6EFC549B74963, 0x59294DFF19DAE, 0x00021D4898225 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x275861BB91F49, 0x13694B5F28FBF, 0x04D8DE9CF2BF1, 0x7685B59396BD0, 0x2D82AE7D4E860, 0x3250382F10356, 0x3AD7BBC1BFA49, 0x440138F9D45CD, 0x34B3F7BBC1260, 0x41BC7BDCAC0FC, 0x2CD372413D10C, 0x5DDE420DF33CA, 0x50900A6CA86DA, 0x4FD9410FCD986, 0x00058E82DA08E },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x515DBD23211B1, 0x3E28AB9AF288F, 0x1155D0BE3122E, 0x3AF37B801874D, 0x047596B16780A, 0x2AD6E2D6656AF, 0x6FB6249CEC4AD, 0x5ABCE2694DF4A, 0x2C437C460E401, 0x2FFF3E15981EB, 0x5A7CF9A806E3A, 0x2F86326FCA21D, 0x6CD006D03E88C, 0x67DBFC9BD529B, 0x0003C1E01BC58 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x0B6E1586BC99E, 0x382A51E3AF88C, 0x3BED8D56BBFB3, 0x239407C189210, 0x19D38295E226A, 0x52908CE3ECF86, 0x2DA0279EAEB74, 0x5CAFAF1F0D623, 0x08C02B0D8FF27, 0x1B5977C659C23, 0x523969A53A218, 0x6B2336C816C5B, 0x3CB267C4E2D2F, 0x361A04AA2183C, 0x00051014F124E },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x555A723626428, 0x2E01388E6B7CB, 0x742FEFB0C7B0D, 0x0D8D15D201E65, 0x68B8729D6DE39, 0x574C3ED475810, 0x2A1671CE4578F, 0x4C48394FE5932, 0x10D89C8B1DB2F, 0x3CFD9EBCCA293, 0x6032289F655CC, 0x078C778D54C58, 0x5F79116D2FCC9, 0x3C4C70CA677B0, 0x00021C6992319 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x62506BA6731F2, 0x25B30E5A0961A, 0x0B39C67764BD1, 0x126242FFD860A, 0x1769EBCAB4523, 0x3AA943120CC09, 0x5E5996D9CF383, 0x3F809180CD048, 0x2180BBF5B4175, 0x112CC459DF21D, 0x4EC61BA0F2DE2, 0x5329DC70D49B3, 0x6565104BB7D6D, 0x1C7CA06D054A6, 0x00059BBA6AB01 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x08415A9C90A06, 0x6439B0C751391, 0x652A4FC748AC8, 0x05BE6475B67C5, 0x2B2827E7DCF23, 0x7370DE365BEB6, 0x6059F690A675A, 0x68296D24C3687, 0x5ED0A1E9301A3, 0x282C39234F4F7, 0x2C0272CC4F966, 0x511ED91923E47, 0x11D239A6BE71D, 0x338BF40BCA2C5, 0x0002FB0FBE9DB },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x113EFCCD1A1AE, 0x71B764546769D, 0x59834ADAA127F, 0x3FCE190366F19, 0x67A31CBB58432, 0x5ADCE0DCEC262, 0x650EACFAC45DC, 0x1C581EC5EFD03, 0x3C72A9A751F6A, 0x31C18A897D312, 0x1EB033CF8E5B5, 0x2B81F45364275, 0x26F1ADF45367F, 0x031A31D1FD1D6, 0x0004A84E8C30C },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x7F37EFB244AD4, 0x289E7EC0AFA18, 0x4957F61D3604B, 0x5ABF297CE8EEE, 0x78670FE645C2A, 0x231336CE39158, 0x4E44976C5172E, 0x31A4819A5D3FC, 0x355A2FB67BFBA, 0x1E743F3BFB0B9, 0x375A7E916D1BB, 0x5CD6B1E83B55C, 0x5B24A0E352AAE, 0x4D11D1954E121, 0x00036CD7AFE03 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x7C9AE4432479D, 0x6D71AF621B951, 0x2C8BE277F7080, 0x6E5AA9D414A90, 0x5E114F44516E7, 0x6D8B091FA96F8, 0x0733C8CD61930, 0x5972CC9E7DED6, 0x19D0491A352F9, 0x486B83575B4EF, 0x630330E7992E9, 0x31AF4267884A6, 0x6028EA5A3DC2A, 0x2E7E83B2E0684, 0x000410DF9DC3F },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x4C369BF2D35B7, 0x3DA3758E0EE1E, 0x6D0C258F18745, 0x23601282C0FC7, 0x5390A5249A1AA, 0x420028A908652, 0x296387E771E69, 0x784C020255222, 0x3413EF52D9532, 0x54B7BC1CD6CE9, 0x3CC1F12FF1BB0, 0x6C3A1AD153FBE, 0x1F36F45096CDD, 0x18E1A08CB8DB7, 0x00033400918AE },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x498E133619FB3, 0x4B78BF355E576, 0x68C30E7A8656F, 0x2F6BFF8C98A77, 0x2CCC5D3A088C9, 0x7BB40CEBE6A20, 0x3529BCF8416B8, 0x3AFFAD1F961A3, 0x6B8C0063EDAB0, 0x290669BB64F82, 0x7998A64033EF8, 0x6D2DC7BBB4EF4, 0x7E956115FEE44, 0x7E06A8CFDD542, 0x000429A9E0306 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x0047930411D97, 0x5FABAF3FDC435, 0x04418CD38C1A8, 0x10CD134FE057E, 0x47268BAE6336A, 0x6FE87BD0B90D9, 0x3274557A6A6C1, 0x5B2EE38140F4E, 0x17D3468058517, 0x7B4476E417634, 0x26CA4E2BF450D, 0x5348C95CF8DE5, 0x2080C7E06EE6C, 0x5E17031628319, 0x00036E7860740 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x3E69A8C7DDCD8, 0x3F25FD4FECE92, 0x04686993622C4, 0x42EA89ECA412E, 0x462B86C891E35, 0x548CC8961CF7D, 0x4F34B6EB1E6DF, 0x7ECEA4463FB10, 0x372AAEEA0EB05, 0x54E8B0D786198, 0x322F90291D55D, 0x04E2995F8B5D6, 0x77E71999B43A9, 0x629D81A121B55, 0x0004C766A4A9A },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x2526C8D5B3282, 0x22DB711CCE813, 0x2300D0FC55981, 0x157BBBFE2C79C, 0x6513212ACA078, 0x6B1CAE81A076F, 0x7484B406F0D6C, 0x3ADC7A39D1506, 0x41CD9F88D2843, 0x690EFC167046E, 0x7F7796FDBD4F1, 0x1CFE62EBC36BC, 0x0CE364FA0F149, 0x50DF24F258FF5, 0x0004B889F7EE3 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x2369A8D0CDC6F, 0x357F66D3ED8DC, 0x57A1DF80597B5, 0x19476BECE433D, 0x7115C0947AC11, 0x6C7A830FEF12D, 0x4745E9DB3E0C9, 0x28C4847E7E415, 0x7872B67CC1CCE, 0x052EB17D77667, 0x3738EB24B7552, 0x2F8C70A7212AD, 0x0446552284405, 0x22320C330E1F2, 0x000637E2AD33D },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x72E226564975F, 0x3918621531E85, 0x0D561DCC85274, 0x24EEE1B25A8A0, 0x2B09399953156, 0x1054651DBE861, 0x3E810CF3C38B0, 0x4813B8DE22439, 0x1D5F66699A82D, 0x3A31CAED99BC3, 0x277E821B0AA8D, 0x53CA7B43964C4, 0x7EA8E87DDA071, 0x007E8A5E02096, 0x00040736C3BD1 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x70A047AEEEF93, 0x7EB4D98D0FE08, 0x2DAE07C709B0F, 0x718732A0E5806, 0x5FDDFD15392A9, 0x65ED488A85B63, 0x70B03DAFCB5D9, 0x2B73F2F27A3BB, 0x183AA5EDDAA80, 0x3C0D125527A4C, 0x28CDB8042C130, 0x6EA58960533DF, 0x022C8A68CE187, 0x0386F89405E9D, 0x0004F0A8D8658 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x7EFD26246F9A7, 0x777D99690BBA3, 0x2BA648AEDD019, 0x44CA9A59356E1, 0x62CDA30D822CC, 0x40D2FB11730B1, 0x50C3C0DF0DE7E, 0x0BEA89E4FB8BF, 0x54C506408E18B, 0x0026D6FBD9688, 0x7AD294B134298, 0x75C0B0F695226, 0x342CCD35ACD2F, 0x3333C914FD23E, 0x00022B7B7F9EB },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x4DCB55FEEACAD, 0x5237B145636DE, 0x03293E5F5909A, 0x7996203A5C84D, 0x6A3BD136E17B0, 0x698654F70E01A, 0x6693D3AE632E4, 0x20DA41E345163, 0x39D02F3F34E70, 0x6F16D0913F1D6, 0x230256196BD5A, 0x79340A05C7CB9, 0x7FAD224ED5CB1, 0x62EEEDA88D8FD, 0x0004A165750CB },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x175FC4518D7E1, 0x6D93E7485DA53, 0x1FE8ADD2D9B3E, 0x46A3FC4CEAE74, 0x17A2B166EFCE3, 0x4875BBABBF92C, 0x3D9C0B48ADCB6, 0x453132976AFD5, 0x323D804B695DE, 0x29A5C844CABCE, 0x2CE0AD5FDC230, 0x63EB87FA78E08, 0x1B5FBACF8DE52, 0x372493EBC74B2, 0x000497B19BB1F },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x225255F32F18F, 0x428AF277508F0, 0x78451BA95D286, 0x4CB43FDE29A94, 0x70BE70CA4D185, 0x4C772ECB574D1, 0x26921EADF36AD, 0x320CB5B539E05, 0x5A097554FD9B0, 0x50BAFFCBBD39F, 0x14D16CACD9E39, 0x03369D8D8254E, 0x6BB2F8CD3EACC, 0x77B61EAE4F614, 0x000428C928F58 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x2C4AC2673A1E5, 0x343F030E753E3, 0x056E220632A5D, 0x55FB66A17E8BE, 0x1AD7532BA01AA, 0x64DC38C7F6E58, 0x737357329CA6E, 0x1590927C3C76D, 0x5E0C3474F2E7A, 0x2B964882FE57E, 0x41519D928BC8F, 0x246B10C0E3667, 0x7A19EF3F45B5F, 0x2DA33739F20F2, 0x0004061C217E7 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x4D0A75E49E459, 0x0D259F29A1BC9, 0x249E7CBB3A486, 0x01F3AA3D5F40B, 0x5502691DC9013, 0x592E58ED62055, 0x3813D89EA3CC9, 0x00F85AEA691C5, 0x74CDD662DD79C, 0x76E4E11F95B05, 0x1B34C9AD21F47, 0x6468506AA2D30, 0x2C468C0EFB13C, 0x62BDB52804203, 0x0005DA4CA4043 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x5C28E8EBA506F, 0x70148ACEB4BDD, 0x5CBB50AE51EC2, 0x2217980FAEE24, 0x3DFFCB2FC63B4, 0x230E87554E09E, 0x0C995AFA80076, 0x302FDEDF2C4FF, 0x065A77D4AF173, 0x6E2BABE233582, 0x1FD642A0B7112, 0x7164F8BE11928, 0x3123CB93ADD51, 0x704120441C91A, 0x00032BEB3764B },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x46C814819E6D0, 0x0524169639D4E, 0x7BE3577B4F842, 0x1598D2E4C7B26, 0x3E901179F46B4, 0x1A1D63CFDAA86, 0x1D610D96DE64F, 0x09EAAAAFE7706, 0x378357345FB18, 0x6C4DB5ECC1554, 0x4FE962AD1E572, 0x507B6147CA2D4, 0x784547E780A93, 0x1FBED0FC3C608, 0x000489E79D050 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x30FFA858269EE, 0x20C5739102073, 0x070F2A15D82C5, 0x387256FDABEE6, 0x33F637ED964B8, 0x3D5DBD2A18FC3, 0x2DC821BB363E9, 0x31D629CEF35F8, 0x1058EEAFD8891, 0x395D3E3874B38, 0x693C1F48F1663, 0x4AEC0F09CB8D4, 0x1B8B8B6B17F6C, 0x0918E261C5D89, 0x0004516D47D46 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x0C4098C88F02E, 0x17AB19C2BE96E, 0x251309EB7F8EC, 0x2789592A78C83, 0x76CF7CE19D905, 0x12B4C87363552, 0x4005A7A91BAA3, 0x64DF0AE7B806F, 0x18BDE5A1EA745, 0x14DC3E3EDC5D5, 0x77A83D6921609, 0x401BBB9CC3EBB, 0x272CE910E5BE3, 0x2B2EEBA831BD5, 0x00064E1D273B9 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x2F3E2D81557F2, 0x226CD6E90BB73, 0x236912BE81A43, 0x364AA8945767D, 0x3DA01059B3608, 0x2A81B05D70894, 0x39C552BCA3507, 0x7FD05353890BC, 0x3B95E898AE8D2, 0x01C06C6BD9821, 0x711CB3BCB534C, 0x79B28E9B106F3, 0x4BBF427597CA0, 0x4721CCAE44B5B, 0x0002E7E568904 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x6FDF535A1C4D5, 0x355AE499B6D49, 0x0913BD92CD530, 0x29001B7E6FA3A, 0x55C8BBCB0C73C, 0x22424A8EF184C, 0x68461D93AA176, 0x6D703C6A831AC, 0x239580787DFEF, 0x4D4BF878B1153, 0x2E1B9343E8E6F, 0x523474F1C6693, 0x7E8208F09FBB2, 0x2879795A52AEF, 0x000598507F544 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x35E72CF8ACE63, 0x5265428D23C52, 0x40760E0E9550E, 0x162DDDB09A757, 0x31DBCEDB31796, 0x6E342A8BF9551, 0x6C68FE99C7878, 0x475E38BE08A0B, 0x3B2386440A1E6, 0x53DB64A4CDA82, 0x406792F919ED1, 0x1E47FA733367B, 0x12452E0101838, 0x601BFE8FC2920, 0x000231B4B01B0 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x0C443255ADCFC, 0x2A2F4C56C380E, 0x482DC66CD5129, 0x54226A2FFBAC5, 0x6606C3ECF7FA6, 0x19BA214688049, 0x56ADC54578CA5, 0x7C77826FF9201, 0x5ED4BF414B599, 0x7AA868367C7BE, 0x47D6A0F5AA1D7, 0x4FEC67B7D5C47, 0x48418D0B33151, 0x081F15D480F06, 0x0004286F06DB3 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x612893682913C, 0x71924F0ACB23A, 0x34171E3B40616, 0x795BFDC54391C, 0x16CC19372DFF3, 0x7A7F6CD23DA31, 0x365EE85A872E4, 0x0C1D4C0585555, 0x240E261A50538, 0x7C281BE4AD6C2, 0x2DA2504291D19, 0x3AF5B1741E3CD, 0x1907584C19156, 0x3EE0B03343553, 0x0002FABC78F8F },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x559938330CDB3, 0x6B6840801FF47, 0x193D7D4C68E6A, 0x1C39F1F8AA1BB, 0x105921E54F208, 0x26792DBDF93BE, 0x4AAB07480A485, 0x2DE91D137D0E3, 0x27588EB587A59, 0x041311BFEF540, 0x7CB6A89134375, 0x59CB8B27EE35B, 0x042650E8DFE16, 0x1BAC1D87F5647, 0x0005433FEBCEE },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x5A8F6C0EDC849, 0x648C889914BBF, 0x27D1E1E35D118, 0x44CC10DEB13D7, 0x2423A39F6C274, 0x5930498CB7DB7, 0x0226E6F3D27A4, 0x4A5E3A257CD61, 0x537CFD25EBC3B, 0x6CADBC4DF960E, 0x697D6FF493679, 0x7BA98F4AB4E46, 0x38A74D5E058D0, 0x762BE933E3403, 0x0003C50089796 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x3E72AB96A2731, 0x143CA890F1448, 0x49B9544064E5A, 0x4CE7B3804AD83, 0x7E2BBECB915CF, 0x185F11BFA491D, 0x1C4F0DBE85C78, 0x4D3A0013DC42B, 0x1FD80D9C999EA, 0x059E32F78F153, 0x23088B832AA7E, 0x3C7F93D9B42A7, 0x67F5F2A3EEC42, 0x17F4DEEA53C94, 0x00060AE2990C4 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x57E82BBD7033D, 0x07D96C34949CC, 0x1E2C6CE9D9DB0, 0x3FE8C0D8CA308, 0x2488DA9604AAE, 0x49EA55F8FB015, 0x1F606519D0B1A, 0x040379518DD34, 0x7FE69E7C441A1, 0x1FBEE4356AB05, 0x68212AEB443D8, 0x4A8A20A7B9BF3, 0x12E401E566F69, 0x7BFF527B6C457, 0x000444ECB64C3 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x31B186CC9D63D, 0x105C63D8688AA, 0x4EEC14A50F999, 0x5C582966E637F, 0x6F5ACE3FF6CCA, 0x32FD55ABABB2A, 0x5AB405F2CB2A8, 0x6C8CCDD13B90A, 0x711097D65F32D, 0x5EBD663767DB0, 0x5BFE19842C83C, 0x785FFC3120365, 0x642ABE454133D, 0x183EEA0157297, 0x000541759FD81 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x2AEE8636C0615, 0x1101D1134273C, 0x1262031C143F3, 0x4E4D5D4359D51, 0x1DC0304252FA2, 0x4DC799BCC4C8C, 0x5DC0B012772A2, 0x2AADAA7C5154C, 0x3C00FD38182F4, 0x7567DF80A77F7, 0x1802E196D37ED, 0x3408A8A691B75, 0x1D60FBD79D8D1, 0x7DC8F84A66208, 0x0001ECBB2F6F3 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x364A6E7410EE5, 0x63683A9BD0E8A, 0x049682095D628, 0x495D07E5BDDEA, 0x5A8669C14EFB3, 0x605D1B338FFC3, 0x27D06BECF98DC, 0x7596D1FF525C9, 0x6A69BE6B95964, 0x0135EF27A651B, 0x1AD7632A947ED, 0x6B774BDFBE69C, 0x4014E6602452B, 0x48E661597ECC7, 0x00063151811EE },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x11769B1D11CC9, 0x0F3B59848F1AB, 0x12612A74A9128, 0x1B7D2269F3C4D, 0x5F05EE1B98257, 0x579D994AE1B1C, 0x6F42FE8B82BF6, 0x1222D8B47F8DB, 0x23FC4B62F66B1, 0x2730F751615A7, 0x1AD889475A641, 0x5169CCFF61F99, 0x187D0EE6FB766, 0x7AE9848AAD408, 0x000407CBD1B64 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x0EAE9A5313DA5, 0x6420E14B7D40D, 0x78BD4E5D8DDE4, 0x6A4F3D6EFF07B, 0x656D9D7AAF4F1, 0x271F2DE68AB64, 0x28553F10767A5, 0x4468F195842E0, 0x16AE2FD34F42D, 0x678F0722DD99F, 0x4FB8BB17DEC3F, 0x2699D9A9123CB, 0x14A8D4A59AE2B, 0x516B95702902F, 0x0005593256C64 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x3105908EED563, 0x77FEE56F8CC6A, 0x2A264BB55FD99, 0x3A3F744D395ED, 0x0DB3BA1AD79E8, 0x25AD75B3FDD9D, 0x7839303BBBD25, 0x24B52112AFA03, 0x2BA5A61526696, 0x22297B086146B, 0x1551D6ADB2695, 0x4D7ED5E63B2AF, 0x2A4FB143F87F3, 0x179E39713D4A2, 0x000414C928C51 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x077E3F10AD327, 0x44592CDC157F3, 0x67CAEE1E5A22F, 0x1924B5BD4384A, 0x375589B7CFF34, 0x15E18CE07E004, 0x5000BC3E0BA1C, 0x5D5E568D2FE89, 0x3D90A4D2CB851, 0x745DE71C8D483, 0x7E5BE40624577, 0x29F09EC47C73F, 0x0852299EDC3CD, 0x54BB181D8D3B6, 0x0004A8EDC2255 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x392F15492B41F, 0x105BF96A66D9F, 0x6C83BDD764FC2, 0x001DEF09A54F8, 0x7C52F0B91ABEE, 0x3B9E95441C8FD, 0x308AA7D80E683, 0x10B7F623885A8, 0x6F0DA92989225, 0x4643F85B849C7, 0x3AF07BC9CA153, 0x3BFDFB93506ED, 0x28A17BFCE9D60, 0x0A7D6AC86655B, 0x0004858E9643E },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x753C6E64CEE35, 0x362902A0C524E, 0x686CEF2AC96F0, 0x0FD77B16D0341, 0x095AA6813D106, 0x74C6F0B8C8E3B, 0x47138984860CB, 0x513CADF654AAA, 0x6CE91AA0CCED5, 0x6A4D16967C4B8, 0x3FEC70DD930DD, 0x192D7646074DE, 0x12BFD6B2889E0, 0x405D8B49D68A0, 0x0006240CBDA0B },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x35F5BEECA2F95, 0x31D76C659957D, 0x2ED15ED3D8DC7, 0x3B538F8841CE3, 0x0BF9ED9BE9BD9, 0x24007C5CF32E3, 0x3F7AB3BE78FD4, 0x2E16E523C75F5, 0x1A84F3FD70E40, 0x053D94FB8C220, 0x1145A1FE45159, 0x5FCB528624E9C, 0x2540F07E65502, 0x16D6F9D4256D2, 0x00044920E7025 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x5A9FEAFC0EA53, 0x7A570CBDC9CAD, 0x41A6A9AE3E24C, 0x37F412EF3EAA8, 0x71B8C4F9883EC, 0x7F02DE5F51A81, 0x1730C3561318A, 0x7114900B5B7BD, 0x77830212FAFF4, 0x1B806BF5B553A, 0x5A91A9B7A9A25, 0x0B0C3E6919203, 0x0C69548A2958A, 0x6C5A9D2B9C047, 0x00061A05C3334 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x120484967E63B, 0x3B7189486BF1D, 0x71DDB69D5E668, 0x0B915539C2CEF, 0x63678DEC36029, 0x42C3023EEB8D0, 0x3AE7844042501, 0x71D0AF20EA4DC, 0x02AFFA0DEFCED, 0x2C7FD506DDE65, 0x149F04A888866, 0x4375EB9E073E2, 0x6C4838A6F4405, 0x08C4A87F7CFE1, 0x0003782942DD4 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x681153595809A, 0x3301D842E7786, 0x70D90333DFD33, 0x36BB4F3802044, 0x5E58034CDE74E, 0x354C31DB68B05, 0x6C0767A4C0CDA, 0x0C6EB7E220903, 0x0494C1F628265, 0x71FD89B599B99, 0x0F68DD25D3B52, 0x73E873A49F9DC, 0x126EBAA6C85C5, 0x39498F40318CA, 0x00057DDDD01E0 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x6E3DF73938460, 0x6FEF2F85473F8, 0x4795F68046281, 0x5BEBA96625038, 0x22EEB5B2C3FE2, 0x67CBC77F8ADEE, 0x7EF339106013A, 0x28F3CCCA2BA9D, 0x7DEBB7B3619A1, 0x008CB6373E5EC, 0x2843F4F42EB92, 0x58327512BF182, 0x3C6CC376AFA05, 0x4530071DDFA7A, 0x000277D9B3EBB },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x7A598A3E62E7C, 0x35B9047D202AC, 0x590072B0E859A, 0x2353EE979AA8E, 0x5EB379221AFC7, 0x2E678BCDEAFF7, 0x6172D38EA30EA, 0x39A161DB83592, 0x2B21931B7AF5C, 0x2559C43756717, 0x3CE05D1EBD397, 0x06D991EDC9D9D, 0x5A9D185161049, 0x37C55E4A01304, 0x0005568A46BFC },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x049ECF63E4402, 0x77CE61B6E85C3, 0x71CE387FBDF9F, 0x314F440135F0F, 0x10CDE2B165565, 0x21AF59991D6D0, 0x30A5F146450AF, 0x288F306E24AB0, 0x5D9C19E998BD3, 0x545B4EF7ACD86, 0x65ECDEBEE160B, 0x56241E47D85D5, 0x4668A5C386610, 0x3F8D9DBC0ED51, 0x000386CFA9014 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x1BF42D2DC4724, 0x026BB5C8A2502, 0x39DA9516F74B7, 0x10D78E7A54D42, 0x3C572FAB2B2C5, 0x4834CCEBA903E, 0x0443C731D626E, 0x767EB60C9897E, 0x1CFC119B9A28E, 0x6A66278FCE071, 0x7D8CBF2A0C93C, 0x2163971615208, 0x774FDF003FA8C, 0x61140F7D30CE1, 0x000640CFC5A74 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x2896477F2B372, 0x254AD7905382A, 0x09AEB0A447616, 0x207D30B31BA86, 0x677AB6E934837, 0x2F1476EAC830A, 0x24D64CE720DEF, 0x73F119B3576D0, 0x59A41D9255983, 0x1510D57EB8575, 0x2ED23223BC789, 0x34EDE88D03A74, 0x345C746E1B326, 0x5C1236662EE2E, 0x0003B5DF01FBB },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x7AC7B72892AEF, 0x00D711DC16063, 0x668F8BF781E93, 0x302F85443E0E6, 0x15918B486FE83, 0x6E562170CCBE3, 0x5D7ED19B130A1, 0x0148F6096C2D0, 0x39ED600365628, 0x7EC33C322B16C, 0x51F05AAF88A6A, 0x36C1270870E28, 0x2651FA8D01CD9, 0x3B92C7A8D4F50, 0x000577C92BBAD },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x6EE746E30DB75, 0x42C12C450FCFC, 0x5B116B95F7E2C, 0x3F496A64F46C9, 0x365D4F0D72CCC, 0x6D8572E45FF0D, 0x43CC98B1AE268, 0x0C03193C3DDB1, 0x1957C5AEC0CA3, 0x1D6D80A2986D2, 0x768D12F7403D2, 0x481F874127359, 0x594AD5CCD0988, 0x2C43E6132DC66, 0x0003852E362E4 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x5DE753E97140A, 0x43E58E48066E9, 0x0A870A361810E, 0x5D24A0E78693A, 0x69654B3D7D19A, 0x4847C1030DB08, 0x5179741CA6642, 0x7DE2DF833C3AA, 0x62CA59A21712A, 0x50572BE4FC0AE, 0x511DB06780024, 0x76F8C695BC8BA, 0x1073BE15F4E0D, 0x020939817BA20, 0x0004F164DE5E9 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x3A39D1FA2F3CC, 0x06C8ED7FE0259, 0x62B7631C779F5, 0x418D37107629F, 0x02B070EC5E876, 0x29B2527C346AC, 0x38596EA30B26C, 0x22601F1170027, 0x28346F2783A0B, 0x1FDF5B66D22C9, 0x1B7CE61340002, 0x1A21CC163C357, 0x4EC357B6FEF58, 0x7E9DD06D4DCE6, 0x0002865978C00 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x0FDC3645B7FA8, 0x170A27B5BB6C9, 0x349F34F56A236, 0x2006F0E287C92, 0x159128C9E9BDD, 0x1ABDD32F9793B, 0x5608AA924DE0A, 0x09C9EC2C8C22B, 0x5F354F4DDB069, 0x7BEDCEBC382FE, 0x38F9832B76CA1, 0x6288F8113DF8E, 0x6A308B4B37318, 0x6E02BC6D1BCA8, 0x0005444FC4A6C },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x7D98F75C7B33A, 0x0A3EEA3CFA6E9, 0x5F42CAB510218, 0x0E6908E172334, 0x7B3F53E712200, 0x7288016A98A60, 0x0C3CD64181608, 0x5AA06FD4E39E2, 0x764EA04D0E93E, 0x17F7AE212AB2C, 0x265C1BDF03710, 0x311AF3F8454A7, 0x474B3F350FE95, 0x6748098EDC9B4, 0x0003E282DE81A },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x568609AC9E6D7, 0x023AEF2A70D22, 0x0902D3B813F4C, 0x6D7CBAF942461, 0x216EEE86A58A5, 0x0D0C4096C459F, 0x69B659AC8D1D5, 0x432DD87FBFA7E, 0x00807E02F9511, 0x553CFD8E7317D, 0x2117E1A86BFD8, 0x274422FA468E7, 0x73F490341BF23, 0x5964ADA291698, 0x000499E11DD05 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x6A57969AE18DF, 0x64DED77C9D82D, 0x35956E66A4082, 0x36C707A29E50B, 0x1FE8F18AD564A, 0x323A84911F466, 0x33D0ABB4E666B, 0x13D0B6577E63B, 0x70CF81896A331, 0x28114167C08D3, 0x4045FAD326B55, 0x49085191DF876, 0x62B3A75A14B55, 0x76AEAC8A00E20, 0x0004233C7DB05 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x6B3B57E3B6EDE, 0x2A0A1502F0EBC, 0x11A5DFF2EA766, 0x4DB5E553B015F, 0x5C33DDA9EC8F2, 0x1EF5D9B7B8E7E, 0x6AB5BA53C7BEC, 0x00FA1A33412B7, 0x18F8D966F23AD, 0x2D4241F9B69A8, 0x4C4D247D5B3EB, 0x567F76037D1F1, 0x6399F85A01C06, 0x1C05E31747D54, 0x0005424446EDA },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x1C48A5136EC26, 0x31F8A349E0722, 0x1C7F084596AC0, 0x52AF21BC46403, 0x34B91853DA622, 0x24B0DC397B672, 0x5A3661679D8CF, 0x063B72C37D17F, 0x00559F5BB0546, 0x5027FCF3D24D6, 0x615E71219F6FB, 0x63FE2101E540C, 0x57D5510FC838A, 0x0E335C8AFB1A7, 0x00041B3A71383 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x4357E8A4B7163, 0x071AAF2EA9E2B, 0x37E37A4BA409F, 0x41E4B796D9AD6, 0x449ABE39A48E8, 0x646BA80BBF90D, 0x59DF904D6BF98, 0x04EC3ECD36885, 0x50D74F39C20C4, 0x0B08F67B62B1F, 0x34901A7B4C0EB, 0x39D3A8DD77977, 0x45E3642B131BF, 0x45AE6BE9190B2, 0x00057A7F0D6E0 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x4EE8832324933, 0x5ED1ED63549C5, 0x58F1947DDB987, 0x37176B67E4B03, 0x6FAE2DFF4BB5A, 0x6A4C6AB5282E6, 0x61E86D80FA74B, 0x3C69681EFC7CD, 0x66757B4126746, 0x6AD7C64F648CB, 0x522F8378B340B, 0x75A87CE66D5FA, 0x5BBFBD9F21FAB, 0x6DA19F69E6824, 0x0003491DDA36E },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x38B843A42BB8B, 0x09FA7D055C0A0, 0x0A044F3128964, 0x62F9BC2D60825, 0x1713522A6C560, 0x775723007F134, 0x3B71CD2883F2E, 0x7D0CD33CC16D1, 0x6B9733E53BB15, 0x03876ED8973D5, 0x50E2A4DBF84FD, 0x1BE7E55250650, 0x4885B4E3BA6FF, 0x2B00D7904693A, 0x0004843BD3784 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x2657444ADC1F3, 0x16D6E8F7E6D58, 0x3998532CB45F9, 0x7C07D69EA2403, 0x44DE22337AEB4, 0x774ECEA93CDB3, 0x5A351C8F5DB26, 0x054426DD4217D, 0x4FF542928187E, 0x6D0A1592675BD, 0x58483465E225F, 0x17A4EA9C887B4, 0x2969345266165, 0x310464C9D050D, 0x00046FB3CD80F },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x60FDCDB78A9EA, 0x461D8F1021445, 0x1435B769036F5, 0x3B5D047FF04CC, 0x6DC5E9714070D, 0x36B6978116D10, 0x157790716B03B, 0x196625A274E88, 0x56A3BD2CADC85, 0x645DB74D7E4EA, 0x28E9CF78881BB, 0x4AD405BAC9569, 0x62D76E2E930DD, 0x0F7256EC7CEA1, 0x0005CDF6B2236 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x4C1730C4C2AD8, 0x31526D990AD50, 0x275062E412AF6, 0x37109A91214DA, 0x6FBBC131506EE, 0x6A671D87939FA, 0x75898F2969042, 0x136A685C815C4, 0x037CAB7AE7EB7, 0x1D3DEA1D8DA46, 0x64510284A3748, 0x4C6E9A0146D56, 0x4EF180385D271, 0x5805AAE97742D, 0x0003962135E97 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x172E3B240F77D, 0x456B564D3B522, 0x3C19C7BFB0D63, 0x3A305A8861893, 0x45157CA809BAD, 0x4B426689685E8, 0x20A4203C66DE9, 0x64BAA18393EB6, 0x1D4C477BA778D, 0x436F580714E19, 0x64149D3379C6F, 0x7E72F9A6D4FA5, 0x2D5311BCD2BEE, 0x6AA492EED3C44, 0x00055DFE87307 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x4AB9D96958EF7, 0x020B08D1AD8A2, 0x237A885F8D591, 0x72DADF013DB8B, 0x702EC34E380FC, 0x170EEC2B34FE0, 0x4115B41CF14E0, 0x54F224197115D, 0x58427B0DC49E5, 0x028664B8C304D, 0x4B73F82095F16, 0x4FEA30A9A7165, 0x11607DF562CD2, 0x1FBF4C14A72E6, 0x0002702C0F1B9 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x54056A1B952C7, 0x6A4FC1ADB8570, 0x4EE294D075A7C, 0x4A28AAA7941AF, 0x3DD31090116B9, 0x6C02D0C006392, 0x38878E9E961D5, 0x6A81789871CC1, 0x5C8AA189D8878, 0x0621C1442D741, 0x1DBC52F8AB972, 0x21A67E4E6A6A2, 0x30BBB121EDDC0, 0x3EBEF752B2B05, 0x0005FD6053DC1 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x68D87A307B053, 0x7F5D66D186ED6, 0x010D0E00329AB, 0x5093B32F79FD6, 0x623D4BBF8CC88, 0x7A672B59ED620, 0x75B97BB9194B2, 0x0E3F317A274EF, 0x240BA41259ED4, 0x30533EAFE1600, 0x42398C5B182E6, 0x2543EF4B945C6, 0x69725C2B6C118, 0x2B07833790779, 0x0002DE45456FE },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x00AA13E9D1672, 0x2FA66119FB946, 0x77D774F932547, 0x158E46D42D24A, 0x46E88D8DE566F, 0x17866F50CC8F2, 0x50827DE50AB15, 0x7BFD6C6D3398F, 0x002CA7D134DA4, 0x4D478AD4566B5, 0x59FD12832B9E2, 0x1886075916677, 0x31167BDE540B7, 0x60264B4CE1314, 0x000663C08BAE1 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x7F3FD3657C258, 0x346CB5AC06BDC, 0x11A8D04517EC6, 0x5E9E3407D6AD9, 0x49AFD68E7E07B, 0x169379FD0DF02, 0x6A403004015F6, 0x1F55E3771DC32, 0x6E1D06A777E44, 0x75AFD98E7D559, 0x05050F420E590, 0x56B4E1946C322, 0x4A686B39E20BB, 0x4389430734EC0, 0x00035D3F95CEF },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x4738F40C10EC5, 0x6F4129E1D9EF0, 0x33DE04DD491AA, 0x63D0C640CE5A2, 0x33FC72EA37D02, 0x06A2FF9C1307C, 0x5F79072AD5DA3, 0x0ECF6D3DAC6EF, 0x528163F881BF5, 0x04FB70023133B, 0x351000A837EDF, 0x32709A6F915EA, 0x5D78BAC8441B5, 0x69B216D2E452B, 0x0005B6F3DBD9C },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x03E9E7CE66ADF, 0x11D79B7C1E318, 0x1C2A311B575B6, 0x6E62E2F31370B, 0x418F1761DB90D, 0x12BCA9D23F917, 0x22FD7F5438BD0, 0x7E61321B306F1, 0x49A7FA82C2EE1, 0x39E2FD605DE2B, 0x019A60AE390FA, 0x20FF8B155DE27, 0x7584176E80F93, 0x00E6ED8AC192D, 0x00027A29B15DA },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x7EA68352F8948, 0x43269698E5AB0, 0x1524D072CBC7A, 0x052BF7C8DA9FA, 0x0EAFFEA1DB9FD, 0x5B92C9CC71605, 0x26F586A3B84AD, 0x4DA9CA922458C, 0x44687EA6B98D8, 0x537D5E808262D, 0x1136170404E13, 0x5D4C62A52CAF5, 0x1962012A9CFC0, 0x14970C80B7E21, 0x000508F65D1AA },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x7C60E2DE45130, 0x43EE3716403FF, 0x65B4BB2DEB075, 0x52441FAFB052B, 0x0BE449CA18F76, 0x6A32E53B0E550, 0x66C934F21638F, 0x0736E885C5AA4, 0x422AF0F01744D, 0x037081ED11B82, 0x462CE86F37AF2, 0x4886B2F241141, 0x2BFFC21BCA18D, 0x2669C3C67ED7D, 0x00029E7037F4B },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x6B12F41E27390, 0x7A28D5CB5DB42, 0x7F92AAF54CADD, 0x05CD9185002B9, 0x7BD71CDD599EE, 0x0190E67BD1EAC, 0x66D8C8228D762, 0x4265F9BB8290F, 0x766F788D0A4D7, 0x58A337480B352, 0x6BF43EC71C89C, 0x38691008BBC52, 0x398CE56B03178, 0x3F3C854920F5D, 0x00057787D8219 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x2DB67BABD3A70, 0x2BFA7F7796849, 0x5A4E084EBA756, 0x021D7F3901103, 0x7FBD89C7EB476, 0x1B6460A416716, 0x3FCB735C6C0BC, 0x6D0CD09825B90, 0x3C80767849A7A, 0x3FD527606E567, 0x07C8F29C52959, 0x1B74DFD4511AD, 0x6CA49DF03941F, 0x5702111B64A50, 0x0002A27DE9172 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x72A28A4F4A006, 0x3F6A1F2D41B55, 0x798DCBA3B4783, 0x55E02D93A8E58, 0x3E4AA4A9222FA, 0x5CF281E4487CE, 0x2650B55785717, 0x10A838DB1030E, 0x4F446102A1A66, 0x7370DFC8A3043, 0x002FC37742B3E, 0x1BF8657AB4360, 0x07EA09B9E7541, 0x6494B4213084C, 0x000575E2C0CB6 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x2FF1E516541B0, 0x282D2FF977B81, 0x46373204AB284, 0x4568C3211A46E, 0x07FED8CA26F51, 0x5FAB9C03B89EE, 0x1D0662C5EE9A9, 0x22DAA92FFAC3E, 0x54F1089C9F62B, 0x4136FBAEACDEF, 0x09D24AB40764C, 0x543DD34036DFD, 0x5906C15B9ADD0, 0x79AFDA44C9427, 0x0002203121F3D },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x42E069D4B24FA, 0x3DF17BE318A9B, 0x787760A099C43, 0x56D8587DA28E7, 0x6052C043525EA, 0x27428ACB1BB48, 0x0ABB7103FD43F, 0x7FDF58F283478, 0x0E67999615B37, 0x7C082B182AA4E, 0x14C4B1379FCDC, 0x297D7554DE800, 0x3B94A7C30EBE0, 0x70CB18D54B561, 0x0004A957CEDA5 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x18E656879F82C, 0x624F0850C6FD5, 0x5036A3B9BA161, 0x0F6BD815863BD, 0x2CF1CF59E27D3, 0x35BCEB8A7A190, 0x1FBC8C95D2702, 0x3EB361DBB1C16, 0x7C810F04776BC, 0x1FEFBB324DD00, 0x4334219505145, 0x718AF8DA6C84C, 0x3F112B09D55D3, 0x0F2DAA3AEF706, 0x000471E2335AF },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x032C63B77AC4A, 0x367B7812F02E2, 0x190B546CCE1B8, 0x2CE72ED4D6B84, 0x68AE3A282791D, 0x5DA72DBDA769B, 0x09987BB0B9A2B, 0x7E9127472F67C, 0x56B22734F0447, 0x138D33E5E69E4, 0x7E2500B53D20D, 0x10F5AEBED6C01, 0x35379FBD91B6C, 0x10CEEB3A61331, 0x0004155041014 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x0B481F3BB915A, 0x59EDAC1F30170, 0x677464EA3D67E, 0x2448156212E4A, 0x1B2688200E889, 0x113D4B4FA9471, 0x7E8A853134838, 0x0E0121DF64B04, 0x2FCFD0CF82092, 0x4178EA4BE6171, 0x20D7D10FFFB8F, 0x687071534DC37, 0x68C212535133D, 0x692A21A9C43DE, 0x000356BA66817 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x1FBAA5E820575, 0x0E0DF7A54C563, 0x5212DF59C17E1, 0x7AE58BC20FB26, 0x5D23BACE9D24F, 0x19D9CCC54BD10, 0x22DA81D8D2FF5, 0x31CDD9A2C87F2, 0x749C575ED572E, 0x5A4F28543FE54, 0x58AC75955D969, 0x6277F0838A7A8, 0x6E2633F5F525A, 0x78E41FBB3E365, 0x000500A88EB1C },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x492FD1D91426B, 0x5986BE59D2039, 0x46FFB16EDBC3A, 0x615C942D7DC73, 0x3D6EE40794795, 0x1C8714DC64A32, 0x51245E5EC151E, 0x5DEB010FFE1D1, 0x4F7AADC6C3B17, 0x0F81E394C48BE, 0x347BE0AEFCC71, 0x2EE7AE0E7EE6F, 0x7463BFA6F5BB7, 0x227DD4340CA5F, 0x0004D824EC70B },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x1581BCA9B5F15, 0x1AB94CE7492E2, 0x0E68E03AFBBCE, 0x60648D710F35A, 0x33A28EA05EA3D, 0x2F9DCB1549BE5, 0x4138513CF442D, 0x1AE56B38E129D, 0x55C61EDE3F703, 0x474EA6910A109, 0x7B8DD93C2A4C1, 0x6B7EB05310D95, 0x2C14AF00FF193, 0x4CFD239A55935, 0x0004C5F3ACFBB },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x00C2063C7F6CD, 0x7CFD0D6DDD002, 0x3FE295E6CB858, 0x03FD55201B91A, 0x5D6BEE40DCD86, 0x46B309E0B2AA4, 0x3D8DCE508F651, 0x66843CA24661B, 0x13B65C6CE351B, 0x07093FD95B852, 0x3A63AB7DBC890, 0x1D8CFBC8EC5FD, 0x39D6DA99AA7A9, 0x00700F4206DFC, 0x000485661C78E },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x59121C8AF2309, 0x707485855025A, 0x6F58CA2E0DC26, 0x18DB4D347EFAB, 0x13FAC2524FC85, 0x36E8844556F5C, 0x5DCD931F60BBA, 0x382E3BA42D06A, 0x43FC2850A82CF, 0x7FAE81D9CBD3D, 0x013C2112CF38F, 0x2ED43B08DAE15, 0x45E6BE07872DF, 0x66E849657CA97, 0x0005F22618F22 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x03F1C4637AF13, 0x7B6DE4F990FCE, 0x697D85662558C, 0x60B120962B763, 0x6FF41F35E0D74, 0x4BEBBCE455411, 0x2109ED6629086, 0x69BA676B9801C, 0x2FBCA21E42207, 0x4F334FB6B4FE6, 0x1A3658796F8CA, 0x612022DC915AE, 0x1188C2C051B02, 0x41CA92E3AA24B, 0x0003BBB7CEBC7 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x340DC6DC49817, 0x5EC343EA0FA47, 0x473808762017D, 0x44A8BA80C507E, 0x5E76A885C2E90, 0x3D4507EC94E6B, 0x03A584BB8962E, 0x17D631F780292, 0x250112511F6B3, 0x15DF8DA10AA1F, 0x2482F034927E5, 0x0988B46EBF490, 0x6D463C7CA5A9E, 0x7DC1826198AC9, 0x0005687A309F2 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x67D3B86F31385, 0x0EDAB4D2009FF, 0x094291D2D758B, 0x6F25FEFE3495F, 0x752873A405071, 0x382FCBBFAEB2E, 0x08FF5DBE180F0, 0x61D813144C397, 0x1FBA5A6BC7997, 0x32312237EF59A, 0x5F1E1934212F8, 0x7CF2F94A5208E, 0x37B1B1DB5791F, 0x7858C09AB455B, 0x00029B1C77651 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x3CCC98EC97364, 0x7A144C839A463, 0x0783994A66837, 0x50BE7A72485F6, 0x58E149CAD500F, 0x070E9D45C3F15, 0x434E4CC52B3EE, 0x7DD3005B868F3, 0x0F607D35D9429, 0x35529F470B289, 0x3294A8AB42E27, 0x4D91451C668A4, 0x5C925914F2DC2, 0x387E49DF85B9F, 0x000587006C1F9 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x4A07079F8C650, 0x7BAE7C2A28087, 0x6527C52B2C604, 0x0D0C22D010B38, 0x7E8CA6F244EEE, 0x3A0F6C0B5A63A, 0x311099C04A488, 0x716266C94B4E8, 0x18E09541DDF8A, 0x27941430F5911, 0x5AFF1F4F636DF, 0x4D60A2FAC3C24, 0x7013D40B8E6E4, 0x720B89BEA57DB, 0x0004597FB09D2 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x7B9CB32A36E1D, 0x65634C2A9C166, 0x5FEB28E1FDD1E, 0x32B4378AAA882, 0x4F1D2CF86504D, 0x644D63875B290, 0x2A7046F070D60, 0x465F8F7EBDDAA, 0x6D465B7443963, 0x66E536824C935, 0x0235F210DA70A, 0x127DBE7FE6538, 0x204D79830B22E, 0x3D5AB2801590D, 0x0005D1E65D8C2 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x3219226DB065D, 0x1E8EE7EEAB4AE, 0x2ADC6A9A5FB9B, 0x3274B723DAD40, 0x7E73234F46C48, 0x44C3E00D51E0A, 0x2E9BEC9B14975, 0x25343D8D22033, 0x458ABF2617CA8, 0x06D82F61AA867, 0x386CFC2AE78DB, 0x7156BD7B409D5, 0x3D3A090E5F50F, 0x54A7769BEEE1C, 0x000459DE7EA50 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x341481AE175DF, 0x2CC22CD923D58, 0x6A593AAB2DE11, 0x43378F0045A5E, 0x0C3BF2314B240, 0x3DEFB146FB975, 0x055078BD1839C, 0x5517DF1342684, 0x4769E77C5EF3B, 0x61B15FF2448DD, 0x6E7391CFB5F97, 0x3F71AE0FA7CDF, 0x13A59D379B393, 0x6BE5830D3AB23, 0x000472D741641 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x240FB482CB781, 0x2FC41D55CC2B4, 0x626624548CEED, 0x5F23EB0BE0DBA, 0x2253D69EF636E, 0x36A8AE7A70744, 0x7A0B0FB855517, 0x3A8DAFF28AA05, 0x607F68F684E48, 0x5943CC74FB1D7, 0x762E8B5F0F1CC, 0x16D05DE04BFFD, 0x1AF98892098C8, 0x077B398BC7ACD, 0x0003F775B4E70 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x4896755722FCA, 0x31B348EAB344C, 0x36279DC3268E3, 0x4BCE816866A60, 0x4250184D856A1, 0x1B69EBB2F7A40, 0x4B9EFC01178C6, 0x49242D9EBB5F2, 0x40CD8D91E5FC7, 0x7BB7EAC10CF7E, 0x3ED2A8E9ADEBE, 0x3E9B6F3DD04F2, 0x24653C2836AD4, 0x07DB6761A51E5, 0x0005707B49833 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x2D90EA715F5C2, 0x590E8A5ABD77F, 0x03A00A88D4462, 0x5636112623CE2, 0x3BA9C1DE34B7E, 0x5CA8392F7DBAB, 0x59922BD260CE4, 0x14F581A27D5CD, 0x3F67C038B0CC6, 0x64CBD70248832, 0x00E16A55EDE9C, 0x3D76F4C1E3CC0, 0x01BF4FC682ED5, 0x5CC5A74FA4142, 0x0003BEC092E9F },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x25E4CC8DD4D39, 0x2EBBE838BC340, 0x3CF6C8381C6F9, 0x735A80E86C791, 0x0D89900E33274, 0x7AAC73481BAE3, 0x3CA6953B2DA5A, 0x0B7CE89960803, 0x69E97CF43EEE3, 0x6D68FD7091BCC, 0x192D9666873FD, 0x60D2B3BB2A406, 0x5E055261C27E6, 0x34808757E8DC3, 0x00043DF82672B },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x35950811BE671, 0x406ED25929414, 0x6F907A272B852, 0x3CE2AF33B0D70, 0x450BDFA499CBA, 0x0073D81996588, 0x6046E44591FF7, 0x2D07935BEAF62, 0x71F2BF29FA1C5, 0x00FCFFDF7972D, 0x6D3C51540A287, 0x572A02E186351, 0x087A54943EFF7, 0x1EBF852BE35C0, 0x00036B60B765D },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x034CEFB69880F, 0x24E1758B28451, 0x61F3B2658F570, 0x4A13EEA71010D, 0x288262D3DCCA3, 0x1D6C85C8C6C3E, 0x4ECDE815FC616, 0x4D4F6F6A803E8, 0x32E75F8BDE965, 0x098F22A7CBB2D, 0x79DD6A18662A7, 0x56FAC55EF5546, 0x5CCA9ECE2F2C2, 0x6F1FCECE53167, 0x00039D4BC0A14 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x0ED4428736F15, 0x3B238C3767630, 0x52CC41AE54331, 0x4770E890E2904, 0x444B104D424FD, 0x7D4A9EA968DFF, 0x075DD7400D88C, 0x2F5C029E5EFB6, 0x6B4967068379E, 0x71CF38BF0AC67, 0x68EB74B6DE524, 0x0740A6D923CF1, 0x0537E7AA1E246, 0x238F4DC6C875C, 0x00039584B7930 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x45DFDD27AA79B, 0x4AC01EEE36BA9, 0x19166164E3231, 0x5FBCDE70FFCE8, 0x3E1F5BB222DF3, 0x787898569CCBB, 0x3C1FF4AB73E03, 0x5A76C0970C413, 0x5B12894FB74EE, 0x23DA2BCED526A, 0x339EE9C64C7DA, 0x2A36DB639DA16, 0x04177FDEE4AF0, 0x6A59919447375, 0x0004319259761 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x55F9E7B402C47, 0x3235BE71D8374, 0x26C3CB076E669, 0x1A8345AB13806, 0x339570FA11EF0, 0x1ACBDA16752A8, 0x5FF5FDAF8A254, 0x37B0FFE344D08, 0x4FE67997AC016, 0x55D770C7C4AF7, 0x071A6EE44BF85, 0x0285A47FB480E, 0x5CBFCBEE968C2, 0x73192039C9DD7, 0x000345F13E45F },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x1E26F76408AB7, 0x248D361EA1D5E, 0x3AF708BB6141E, 0x473ABA1AA90BF, 0x037126118BB07, 0x50CE88AF914BE, 0x4FA16536D6C5F, 0x05BD56A3C952B, 0x050F778E90872, 0x1B6D88F6C5912, 0x37A10D2235445, 0x6965C662C9AD6, 0x0852BCE444EA7, 0x3B6A11D8537EE, 0x000517AC4C64B },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x51954D5187D83, 0x429D24B846BDB, 0x64AB567EED0FA, 0x378AF52DDA425, 0x6D1D9DD251431, 0x62CE8BFF595FB, 0x013FDFF5F9A77, 0x76595C09FA835, 0x162C15E019CFA, 0x77CFF86605903, 0x42F22A2140F1E, 0x10E7B0EE8D20C, 0x09C28C6FAED4A, 0x4C0C4161B6FE3, 0x00039F1C54365 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x5DD5636D7E104, 0x605E339189C26, 0x311934C0C741A, 0x7BB7DFCB9C3B6, 0x43BCF0C9628EF, 0x75E0EF1D667BE, 0x32870B69092CE, 0x53A5E7AECF032, 0x0A1E3562B3FD2, 0x3B3753A702663, 0x7508645256686, 0x24043C24209CB, 0x66FF9434AAC39, 0x2EF18551D40FC, 0x0005F12EE7B28 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x5CFA65D456DD2, 0x0D73FF5F1BD2F, 0x16521E621BE6D, 0x79B4FBE35755A, 0x189D22D2528BA, 0x25CB4B34A0C3C, 0x2193B46AFC86D, 0x54DA8DD6A8EC9, 0x34D8DD64B87E5, 0x57EECF027D933, 0x68F81BB7A9B61, 0x3769A128CD53A, 0x7650B05DEED1B, 0x539EA25DC95E7, 0x00031C0D82343 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x39EEF5226D5CC, 0x58A9BB7A4B367, 0x12B5BEA9ED95D, 0x77260F4C41D0D, 0x25F4CA9AEF62B, 0x00680F0BC1F8E, 0x62472936FA072, 0x558046AE15E74, 0x63E5EB0D13160, 0x6EFA38EEAB26B, 0x7AC30B5A75380, 0x11FF92B3B699E, 0x30E0101825154, 0x46B2FDC2C30AC, 0x00058D387E6F0 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x7A1C2EAED559E, 0x312C4D8F7257B, 0x30B12D0DF6D5B, 0x508EDC553601D, 0x03D9FAC2D89EA, 0x4E9E5DACF061F, 0x6D9B83E43E4B0, 0x348E99CB0CBFF, 0x66DEF98DA8A69, 0x462A3D33832EE, 0x00F515EB45BAA, 0x5D91265257C51, 0x7C4F1FC7243DB, 0x40E833D8D21EF, 0x0003F07D2C8AF },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x6368F5048199B, 0x40DF934BEEEF3, 0x5F2D8A7A6D563, 0x1FFAD4F0FA5EB, 0x3475860F95815, 0x4996FC58AB09C, 0x6516A05C4FC93, 0x2EA06A36323D7, 0x4A53E4CC9168C, 0x502A536A21E25, 0x61644E1B5BCD8, 0x129D5C4F53E44, 0x65DA233AD744E, 0x118E43BBA0626, 0x00063A2C01E11 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x371C4A2F8DA19, 0x2EF0E987AEE45, 0x06DC69E2D1F50, 0x5B970DCA42FEA, 0x1C6B1F2F0FC21, 0x2E018D0E1F7C4, 0x7B3482E37127A, 0x709067662B429, 0x2B6CC68B9F2D7, 0x16330D6E5A03C, 0x7D4C66DD481DD, 0x60DA03B13C354, 0x09886E551F9C6, 0x4C3F86C635762, 0x0003308B9E559 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x323DF3F941670, 0x67842E472526C, 0x5B31516C3FAB1, 0x74D6DBBA161FB, 0x13B13DC7C81A0, 0x46C3B4305156C, 0x0BA8351B984EA, 0x699842608999D, 0x504718C7E83A2, 0x7F02FDE271C4A, 0x5B781D8051E92, 0x6A51FDE17397B, 0x2A599D19593B5, 0x2311015841A35, 0x0004E4E75EF59 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x431CDF062DA74, 0x13EABBC7ED93D, 0x7700AB4640541, 0x5D8EB4E9A9971, 0x7CF3CDC7D0279, 0x14DF0BF5D8DEF, 0x6CF304E296168, 0x25C6FD7B88BF6, 0x4228EC45B4DD2, 0x5F278062DD607, 0x1010812F5EDB9, 0x3AC0E9F4E855B, 0x7143D07C4EA9F, 0x65C557C8FA0E2, 0x0003CD611CEEF },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x123BEC0B3794F, 0x7C4835F4B9347, 0x105BD26724504, 0x5A4318298D347, 0x1D8B73BF76F93, 0x02F8AF370D8B5, 0x7B293D7698221, 0x612C8DF2B43D8, 0x31B6A6FFB0D9A, 0x4C81E3A154E21, 0x0749FFACDFCA4, 0x1967957DCD005, 0x749E3BF5573A4, 0x019ED015DAB35, 0x0006F9C10E5CA },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x1931D7C587B8D, 0x69318DDBB1FEF, 0x4B20BB1D4139B, 0x1C189F97B86AF, 0x10B96091BB21D, 0x4BA0DC2855641, 0x0BBCA87BB2E54, 0x769106E482F27, 0x6C52F798D672A, 0x2C3CCC9AA6FCC, 0x795FDEE6AFF7B, 0x7A1FEAD98D348, 0x4BD0D60BA324D, 0x461D66DF79EE8, 0x000381F957BAC },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x2EA3B00A0C5ED, 0x5B45F2CF6D977, 0x003E4BB59C858, 0x3FAD9C4B80D30, 0x1AC25ECDFEACE, 0x1962F4DCFFA6E, 0x13D9382379974, 0x3243F6AF0426D, 0x77E6125FAEA20, 0x1F3A2A3AC4ECC, 0x7251C63024861, 0x3743EF6502B35, 0x6F90F4E9CC376, 0x337D6E7EFA920, 0x00059DE3C0FB5 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x6932CC232FC33, 0x146D04678A6CE, 0x7E8C3E14D8E84, 0x2494D7C7FACC0, 0x6860D590D2541, 0x2E82180E144BF, 0x3E4AE3D5A31D0, 0x06280009A5C14, 0x35FD7208594C5, 0x60000A58F25D4, 0x4ADC1D85CEC0F, 0x0D915E9CBD81B, 0x79CFE95D0EC0A, 0x14CEBEBE9E435, 0x0004543423B0A },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x7B7D8A3B38C62, 0x329F461EFCCAD, 0x3CD998642570E, 0x434FA9273D24D, 0x4170C852CCE29, 0x18E75A05B25B3, 0x57BDC3E6A749A, 0x1B65A88B19989, 0x6F93381B00BBB, 0x735108062A780, 0x238EC1B5DACF1, 0x3E0635062A97C, 0x27A4AEF058FED, 0x52EFB81A53874, 0x00065DAB1AF1B },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x64E7662FE9156, 0x532E10DD03212, 0x34BB2D6C762B3, 0x3CC005A2907B5, 0x02CF492DE034A, 0x3BBFC7011ED58, 0x7AE7F5DB059F2, 0x7033FB69F916A, 0x1D372E803538B, 0x64B7BB891CC90, 0x1437B507B7D41, 0x4A6CDCE602037, 0x4CE08E5D437E7, 0x6432C4FC6F444, 0x0002E638C8D32 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x5D4F35134AC73, 0x580A1F9CB64BE, 0x6CFA39EF4A5CD, 0x2E58CE812D630, 0x65D1367C7F435, 0x7627704882342, 0x10A76522E811F, 0x2797EBEC51026, 0x31954DA6D59BC, 0x40C7F19F43C12, 0x60B18E547AD56, 0x532AB4BD126D8, 0x54796874FBC98, 0x17F6E7C330B0A, 0x00056E214ABB2 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x0A01C334432BF, 0x3F109B1880043, 0x1E031CF7476B5, 0x5EC650D131FE1, 0x58894BB87BD2B, 0x045E89D8D9ABC, 0x04F24091A068C, 0x0489FFCA2ED9F, 0x3D701FCB5B1CB, 0x0FC8E7F825065, 0x35163BEBA68B9, 0x1E6B79D59D11D, 0x15F98BA0AAE46, 0x3C26D020257E6, 0x0003478BE91C8 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x02F63E6FE7BA5, 0x7CB223751B132, 0x7DCF1AA5E6E31, 0x169B16144C282, 0x4AE3B885FD03B, 0x194D3F74F1ED7, 0x783A6BF63B8A8, 0x5DE51EA23D1B6, 0x4EA39674E081B, 0x1E2EC3B173238, 0x40FDF535187FF, 0x07609CC88A5AF, 0x25398E9BF9A16, 0x260F5591AD1ED, 0x000569F171C4B },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x7812C192855D3, 0x7F209A934ACC2, 0x34E8501EBEFF6, 0x1038D9724EF1C, 0x14992E67E50C0, 0x346C6EA2792AB, 0x54791B235DDFB, 0x7F063A46E6849, 0x3220DF7B70203, 0x2D213E7589A81, 0x5987B79B0475B, 0x2CBDCA7AA059F, 0x2E2487C00E7ED, 0x217E196F63E0A, 0x00039E419897A },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x2C220C2B9E506, 0x16D37C7EB8F52, 0x5657712C5DDFF, 0x3AAF6515454C8, 0x6C5E54DB67EDB, 0x5B7497C45129B, 0x33F950DE233EF, 0x5ADA3B436647E, 0x3BC24F0A276E2, 0x1EDEBC3966D5B, 0x66DBFE0314450, 0x3E8C70B46FEE1, 0x187FC8615288B, 0x2390F8B2A6BEF, 0x00052B7D0DEF9 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x2BECCE303B928, 0x2A363ACE9809F, 0x28864970AD5FF, 0x299D0ABB6D17F, 0x778A63BCEE6A9, 0x55CC466AD2DE0, 0x450D743235230, 0x61E4530CC388C, 0x0B3E4A13B19BB, 0x378C9B203F3D3, 0x43BA2E78A4B18, 0x7D1CB81C8D5D2, 0x7277B5329DEB3, 0x42B5DEA330616, 0x0001E1FAEB3C5 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x73B64B0D99435, 0x5D120E3870C43, 0x61BA741B73923, 0x70F300517EFB3, 0x53A5990E00F5B, 0x51453287582A8, 0x6EEB512872CDA, 0x1F563B02EF8E2, 0x5232E28927501, 0x7E4BE5F701C0D, 0x21662F90A796A, 0x67B44D5198FD7, 0x527BAA66C090C, 0x55A330268935A, 0x0005546B18BC4 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x12DD5D2BCDD93, 0x042F09A96D13A, 0x2DC0536DFD31F, 0x4907201E355EA, 0x3406D3FC496EF, 0x70BB1A2139CD3, 0x0F7C3D6E0DC59, 0x175DEE59F545A, 0x25B673248C78D, 0x54C01249F51CA, 0x742FDF80BA788, 0x6EF30FFD1CF4C, 0x544985E3E4544, 0x12FEC1DE5594B, 0x0003A7E91D9B4 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x145E86180EA2F, 0x7A8A5014C004A, 0x6F64830F3DDCC, 0x3F7FA49618F21, 0x1759BB1E8B87A, 0x23607DFA6D032, 0x3C98788AC0077, 0x588F59FA9D655, 0x589410EA1FC2C, 0x3C5F7B526CC98, 0x634CCF688EFDC, 0x2D1685EBC5E45, 0x0F9879CDCF189, 0x7CD559B13238A, 0x0005B5E812451 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x7C728C02EE251, 0x553AB4B2B57BE, 0x5719D9CD4C8F8, 0x29459E18ACC36, 0x7293567277F5D, 0x35BD9F6BFA8BF, 0x2D17F608C40AB, 0x5C4712668C230, 0x17D31AA03531E, 0x328498DE0192A, 0x76CBDD8687D10, 0x0DEAC988A818F, 0x230C0A1FB19F6, 0x48AEC8E7C5F15, 0x0002B9A2ED064 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x0C8BB8A8BE58F, 0x05B57AA0BF220, 0x7E461B34F6112, 0x37D86941438CB, 0x59B1B0DBFE9FA, 0x41A66B5F00DC8, 0x33D3C5124596F, 0x191EABFB333E4, 0x44EC742ED7CA1, 0x3415663A38430, 0x5F011F3DE129F, 0x204874FB4A196, 0x52C45322CC529, 0x0B53D9694824B, 0x0004D85D49945 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x0D7F582F7740D, 0x608FB4B43855F, 0x68BCB3F8F7863, 0x729D4142DF1BB, 0x199608E05AC93, 0x420FD816FDA0E, 0x7441A0AA5DDA6, 0x60166DA81466B, 0x5835A51BA97B4, 0x3FBB2A1A6D810, 0x714F77D791EDA, 0x4011A52A9AFDF, 0x4C85F26B59C25, 0x2C3855F8571AE, 0x0002E30E769A7 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x5346F05C0170F, 0x5B82D51549F74, 0x62DDE37F44BB3, 0x54A1042E1C6F2, 0x3FFF78CC0FD59, 0x6C4AA1B984ACB, 0x457E43C9E818F, 0x2202FA10A049D, 0x4EE2ED8D4FED5, 0x5D0C47A40BA23, 0x192A4256659EE, 0x138B55BF863CE, 0x2F695E36F55F6, 0x3119D36CA5C6B, 0x0005075E2B74C },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x4ED928DD1AD27, 0x00D814191DF20, 0x349EA7F3EA567, 0x0F75A8A35B76D, 0x70057C0F10801, 0x460DF0BDC210F, 0x6D97414A32CDF, 0x652D1974BD5EC, 0x2193C18349479, 0x0F51E7577F8A8, 0x69E154C34686C, 0x19DBCB341A059, 0x4C4F1C0D8ECEC, 0x4DEA7B51CFF61, 0x0003035C2C08D },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x07EB0E53520B6, 0x3A94EF12A828D, 0x31C1FCFB3848C, 0x4D8DBF6A7DB4C, 0x2333A69A97B85, 0x3C655B26C1D42, 0x42BA8233A2B25, 0x5C4AECCD6A1A7, 0x1EAF7E845DDF0, 0x0403FDE39461C, 0x3B45FFB62F289, 0x7294475656CE1, 0x0DCE56EE1427F, 0x1A0C1B54BA19C, 0x0005060F991B4 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x089DDD67BE168, 0x23234F0157FD4, 0x64F7D42E30E5C, 0x2B5DC5D8F3233, 0x240C68C2BED13, 0x05FEB74236B02, 0x4E7AE570186E8, 0x2A7618D7D895E, 0x1A77CB180787C, 0x12739F5FE3605, 0x56032C22A2502, 0x79BD648BB1171, 0x1BB566233B7BB, 0x68C2858D0F730, 0x00022D2034172 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x2F3D75FB182B2, 0x54413E78B6E01, 0x2AA7CE1B58347, 0x58AA2E96B4010, 0x301CC78E5E9D6, 0x3030583958256, 0x1AD2733F1CB77, 0x05FB472656DEE, 0x46A75B8A384DB, 0x082128B43E7BB, 0x5F1917C1F7362, 0x33F34E4BDDC78, 0x06EE54350F99D, 0x1396FD9B16C7F, 0x00058591DB969 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x0A4D7B91238CA, 0x26E561B155631, 0x1D2D4EB8FA61C, 0x4D7905926C28C, 0x317352616E404, 0x55A9996D06910, 0x5548585D6B850, 0x7D33A1CCCC44C, 0x0C14AFA537D2F, 0x011BA02C6057E, 0x76C69E6E5F16F, 0x0E712C0D0D51E, 0x0C04FD85FDB21, 0x23656D02D0417, 0x0003B9AB9649F },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x4F05C76704F9C, 0x198F1C9B1C281, 0x6DF8F5BB5EF16, 0x5ACE109CC6161, 0x587F83711F386, 0x248B5E40AEAEB, 0x7F25769422FFE, 0x3FE83DC4E564F, 0x207A7FEC2C4B5, 0x4D2DB00E73865, 0x732E46B0CAEF3, 0x01D8D4E6EEEC5, 0x50D96B70056E7, 0x4995502BA4078, 0x0005561FE690B },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x6037C841855BC, 0x11DADA4AA201A, 0x28098E3678695, 0x54C1F3C93F330, 0x2FFDEE7C07C19, 0x06A7A8FB48521, 0x472C2FA3D150A, 0x66AC6F9C8FCBF, 0x2C00F20AC36EB, 0x09818169F5BE6, 0x4719E335F6242, 0x610E810BDB1C1, 0x143B41FF5113E, 0x0646DCB5BC016, 0x00039EB0F73CF },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x67F64F3005498, 0x60814E86D934A, 0x36177AA041C85, 0x49CEF70B6F5E9, 0x2828735FF498D, 0x534ECB12B44ED, 0x6B9800C03B3D6, 0x00C432B39905A, 0x6E4A0917652DD, 0x7E6D3D6CE16B3, 0x70B837E6B9AB1, 0x1CD291780059C, 0x360A8A8244C4F, 0x07452016D94CE, 0x0006366F964DA },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x5BE19A16339BC, 0x2FA5BDE42C2CD, 0x04C379D58141E, 0x4D8EC42208F8B, 0x53769CF7C6DF7, 0x08C988A6DEE0F, 0x5E53D27AF8277, 0x4776216D1EA7D, 0x76BDBF0E00AFF, 0x18ED6785B0329, 0x4250E59CABE98, 0x2C76D762E1AD4, 0x2539B3CC0FE7C, 0x0EAA176AEDBE7, 0x0003D1523EDE2 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x68D11775B474E, 0x670F0081059B5, 0x6EEB0EAB98C81, 0x0728B22190692, 0x6DAF9064B0AC9, 0x7CBB318016260, 0x5905FB3661B3C, 0x080507887F0FA, 0x704B8CC330DA6, 0x6F5BB2421021C, 0x5D9F296D5EC4C, 0x7EFC6451AF787, 0x566ADA917E8A1, 0x0522FEF72E887, 0x0004DDE21CCB7 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x1328656E00E28, 0x4ED8CFF2C3DBE, 0x7690B6D83C4D3, 0x4D8E9F53685E1, 0x093AEE5D7622A, 0x732B11A41B103, 0x0833ADC5EC05E, 0x7F356C232BC03, 0x6839A740522F5, 0x4A74C684EE902, 0x1541CE0D715A1, 0x29E4119AF863F, 0x42F76203F0C17, 0x7CA4AE015BB90, 0x0003B45C39C5A },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x2552D0119A124, 0x595D0C3495FBE, 0x4E656FBFEF2E4, 0x0EB21570EE7FC, 0x06CC9FA0C79C7, 0x400915C7FB0B6, 0x09931B209363B, 0x37C70638706A0, 0x31496C959ABD1, 0x49F3BD910F359, 0x159C19432F337, 0x4F9BFD625BEFE, 0x17A831EB953CB, 0x0EEF07916BB1A, 0x0005C7379A1AD },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x4E983AA98F066, 0x125A3C1FA76F1, 0x6DFEB51F6FDBC, 0x33EBEC62DC0D3, 0x69A138606C96A, 0x19053CD1A7B64, 0x7C17030DAB953, 0x7FB2884872C76, 0x2A5EFAA8831FF, 0x53FF20F264BFD, 0x5F499E9B188AD, 0x04E3CDE283510, 0x6F2692763214D, 0x119F6B3F0E642, 0x0003B8A17DD6B },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x4EC49A4E927F6, 0x3D8D34B7FCC82, 0x547E4CE68740B, 0x2C1C68DAC5695, 0x3D18F0A25F97A, 0x0AED7BFB032E5, 0x03EBD5EB238FE, 0x177DC76B997DD, 0x1204C480E0780, 0x75875E72DA42A, 0x6050EF3F3C7CE, 0x43D26FF0FCE6A, 0x4A4C29876461D, 0x6BA1B39F3A8B9, 0x0006955A93FDC },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x60EA9C537BFEC, 0x42924BF0D4B59, 0x79E2E16A08951, 0x5410816271399, 0x26B0B4730B718, 0x0E1ED5B335B24, 0x3580120D97B64, 0x4EE553A509DAF, 0x1AFF324FC848C, 0x2F116C4B0F16D, 0x4C1C5127DC804, 0x2A8C4515C6BAF, 0x4FAE72C79CEAE, 0x065AA024E95F3, 0x000327A5C6078 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x5702879F0FC5B, 0x1DB16E3C9EB54, 0x646E624C01E41, 0x2EACFE57156F0, 0x21B61BDC75EA8, 0x6CED55A55D0E5, 0x41C2EC90855B2, 0x6964F494FF94A, 0x0180D803C604F, 0x27A83FBA0E954, 0x0CA66B1370D99, 0x2390D1C2FCB51, 0x14B5570AF5A8C, 0x40572615D3803, 0x00055BEA0FA94 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x26DB8E4FA88EF, 0x28DDA28395224, 0x58CC4AE295318, 0x0BB7080E0D872, 0x0DAEFF604FFA2, 0x1A4203562872F, 0x3ED577D00D81A, 0x37D744D51C478, 0x08790BAC1959E, 0x42F6A7BFC1B50, 0x1FD09CC0FDC22, 0x242B73CF6F1E3, 0x5F0407A288B4D, 0x78F7E38E3677A, 0x00050F007FA4C },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x59D71B55FB6DF, 0x384B2D90931C9, 0x6617983469263, 0x76E04BBBEA921, 0x7074CA6AA74B7, 0x45F8F6B8F1998, 0x2B7F76D9D56F4, 0x6CAD9981BF842, 0x768AF802A6350, 0x3597176D07AA0, 0x762BB984B9A87, 0x304838E8E9004, 0x7BB8F6AEE98EA, 0x244F90FDDB693, 0x000629F2C1D36 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x48D0EBDF1501F, 0x45D1D814166B4, 0x5F4ABE35899A4, 0x772E51F5342CF, 0x7B3A146FF088C, 0x6069528F72CA4, 0x793341BB0DCE6, 0x6A7A089EE3379, 0x78A20EC798DB7, 0x55D1D8F3A6AFA, 0x17D3C411B219A, 0x45BBC484AA8F2, 0x5F1FD7AF6C0B0, 0x499E39FB1F8C3, 0x000371C076EE9 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x3CC2BA742D1A2, 0x0A7E825825DC2, 0x7B396FD0E82AF, 0x1861038B97B0D, 0x101164E84695C, 0x792BEFAB8DC3A, 0x3824B76A7F883, 0x1FE245997E466, 0x0B95E33C5A956, 0x7AA231AA03DEB, 0x033494DC3BF1E, 0x6780A652AC083, 0x5A2C7FFAA8702, 0x504B7385E9E64, 0x0005A15FB1B0C },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x7C1715939AFB0, 0x6B0B9A5E21035, 0x0431ADC2A1F63, 0x23DCDA651609D, 0x5D284B1C27983, 0x6D919AC38F132, 0x52432B69EFA0E, 0x018B7A9BD727A, 0x17BEF8100E75C, 0x481112E167BCA, 0x4C10A52D7F1D7, 0x260E69368B988, 0x2DB7E81EBFA19, 0x1B5327F1B6D42, 0x000413E989362 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x6367F1B90D2DA, 0x780F776656E2B, 0x4D3F69AAE46A0, 0x0E411D90D326E, 0x3B817F27EA6E8, 0x142D303341A1F, 0x4E3986061A568, 0x1FE57B87C88FD, 0x59328BAC0B959, 0x4F917509D8265, 0x0127DE89DA542, 0x628C75B747191, 0x59F40A232145C, 0x5F134309A2650, 0x00048D6B16D2A },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x6C5DE4C2099EC, 0x47063F2F93E2C, 0x4C968731AB55B, 0x34E2D3071EC29, 0x0E737467DCA81, 0x1AB515287CFED, 0x5B386AA1D235C, 0x26873F9D3ACA4, 0x130F02E19EA79, 0x21CCA45E0022F, 0x7E587EFC42359, 0x6AB03B5609F7E, 0x1318856174EDB, 0x465A35A726073, 0x0004039735195 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x317DEBD7924DD, 0x4265AB39D6000, 0x4AB17CAF661AC, 0x64E32BB5468F4, 0x7AC0D441B6AF8, 0x746FF3CBF47FA, 0x0AA8E20E3CA5B, 0x3129EC20CAFEA, 0x294A6E86A6968, 0x438769161EBC5, 0x33CD08761546D, 0x0FCB196FF1629, 0x66B442E0425F8, 0x0012957E71CA1, 0x000582889BAB1 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x76766D11E9B7F, 0x1673C26C922E6, 0x5997988B294C7, 0x4EEB62D3A53B8, 0x5A7BB30B3B204, 0x4B64C5CC5B1B6, 0x5CCD57E0C5521, 0x0FD27B986AF04, 0x53F6DB9DF48C8, 0x6B85397D9C680, 0x0B72902DC133E, 0x3DD10D9A5653C, 0x7128D73AEC9AA, 0x33E8EAB835B2C, 0x00047DFC51DA8 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x4F4DE322C7234, 0x0ACAA7E59513E, 0x4FF9AD9C6F854, 0x088B2FDEC731F, 0x348D0CB2C3A1C, 0x386E50312DF80, 0x0FCECB2E21B1D, 0x2520E0D0DB5FC, 0x1E50AC9AC429D, 0x654C13B125502, 0x325400EF60B4B, 0x2FB019B5F7E80, 0x25D3ABB93572C, 0x62D6891279F78, 0x0004BABD54AB4 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x0CABE6F92F56A, 0x06AF30B5A2F19, 0x409397DDBE91F, 0x533FFB659D5C1, 0x64BCF69268553, 0x2C808BEEFAAC8, 0x73909B6D5EB82, 0x12F8BD3A82AA6, 0x2BE9DD77B10CD, 0x7BA5612103515, 0x6BF7040B802AB, 0x15247F66740D8, 0x4BA6D478BA0E2, 0x0511E8C981476, 0x0003B0F6C2C09 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x162F4C828C4FC, 0x7C27A06E9D091, 0x7812314E52F03, 0x16C6E75F315A1, 0x2F1B8B979AECF, 0x77EC5C02D0601, 0x5C6DAC7871141, 0x534B13E16EE8D, 0x22CF4F4EF6070, 0x02970F23B444A, 0x537A201554D35, 0x352380ED39CF7, 0x67BCB2AC01DCD, 0x53AF5BB94EDD7, 0x0005879995B91 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x18DA76641868C, 0x5CE4E86FEFE78, 0x3EFBEBE292B7E, 0x24579AE4FCB9F, 0x333A807BD7412, 0x7B0054F576DA6, 0x5E243E15F51A1, 0x79809B162DE2D, 0x5D41A395923E7, 0x760B0A60A83F8, 0x1D92C104A6AF6, 0x5242C955A8D3C, 0x614A4DD9E8752, 0x0CB7F6CDFB1A1, 0x000312491E076 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x3FC686C7E5E5B, 0x2614851D4E64C, 0x1C999C8A1D62A, 0x2B8A822EE92A0, 0x16ADEA06847E5, 0x63B7137D673B2, 0x21370AB6B2BC0, 0x30F1280DD2DF2, 0x748AFF47311A8, 0x6772166EC1FC5, 0x414C74FBFD6A3, 0x15EA5CE7B537B, 0x4820184C000BB, 0x32DF1AC64A854, 0x00057EC7F526E },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x6EE293A211B7D, 0x1CE878EFCA227, 0x01B351E130764, 0x428D11316D4E4, 0x2CAF8727F7A5A, 0x1B4C973FA8DD5, 0x14D66C368B0ED, 0x26AC78098CA9B, 0x26A34CC47D5B9, 0x132763C0EE6BE, 0x69890603467B3, 0x21BFFCD7839DA, 0x6020ECB5C5372, 0x74BB9D9D8459B, 0x0002D465BEBE2 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x0D98F1246974C, 0x449281C78DADB, 0x6C62D64A43EB7, 0x2967F071EE8C6, 0x4AAFA8CC33471, 0x18E9EE28B3AAF, 0x40A4FD7A6E119, 0x62A93D2E39A02, 0x36A14F1461EE9, 0x36E9C8D67A306, 0x5EBDD3CE88A48, 0x338776FCE7D7F, 0x5070C40AF680F, 0x1B016BA318E6D, 0x0004D36249517 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x05283DF9C0C4A, 0x122BB92C5B51B, 0x47C32DD3DD7D8, 0x5961D18AE7C14, 0x778C308122A94, 0x65C1E3F45EE02, 0x612C54504B0D7, 0x49C7FB966A31D, 0x0D24FFDAB44C7, 0x138AB9EACDBB3, 0x73BE55094FE70, 0x4C17FC7195C78, 0x551C198C9A9D0, 0x3E3EE8AC8DE90, 0x00036ABC104CA },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x2428675A3EAAE, 0x21BD22D772D55, 0x4A6DC50CDB94E, 0x3F52847A42911, 0x52B9E6DC71980, 0x4D74F2774C249, 0x5E9FD2BCD8488, 0x53CF8005B2552, 0x54F2B864DEACC, 0x43FC8CA2E031D, 0x37496FBC51A60, 0x2ABCB42050D6C, 0x622CC0210D333, 0x0262FB2AF0F5E, 0x000537A7AE5EE },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x021E00269462E, 0x42DBE9D89858A, 0x21A97F348F09D, 0x71A4D3F97BDB6, 0x7E7866B71C139, 0x2D174B1808CDB, 0x6384C507B8221, 0x155F51F8548ED, 0x13479AC906B80, 0x7D7A0F633E03A, 0x1A2EF1EACEF52, 0x5986419414E28, 0x4E8F6FCE6EB93, 0x2E610F3811447, 0x0005267E9A005 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x32EDFCF23E356, 0x692038A50B86D, 0x759423242E2AB, 0x155603119F3B7, 0x6763D248AFB8C, 0x68218F3E0F47F, 0x5E1DBCC87F849, 0x0540F6FB30F3F, 0x691D77FBDF38D, 0x11DE724EAEB4E, 0x0086DA5D2AC6A, 0x743F24BC4F7E7, 0x5E1AC9EBF18A0, 0x4A90EE45C341D, 0x000484C5133AA },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x5CB322E597DE8, 0x284BF0056793F, 0x6227E391D9E14, 0x76CDDEEB30CB8, 0x0139E6B16CC54, 0x59905A6E03E6E, 0x7A659B97BB0CD, 0x5F4F679C5572F, 0x6E3361D770E2A, 0x0CC4BA7378916, 0x17A8737563DE5, 0x286C8663970E5, 0x6BB97BA2E2069, 0x1B76947E51BAA, 0x0003C3B7B7A62 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x74E3EE88CB59A, 0x280FE0323FC9F, 0x2297947BB24B1, 0x125BFE742C376, 0x68F5E7D05A505, 0x75B6F533D8DE4, 0x4C8FCBE2E0F61, 0x4D3E305AF5FFC, 0x4C73407417332, 0x002F4733802DC, 0x65AC7F615A781, 0x26FD33BBD152D, 0x2C09D7C40D174, 0x16A088CE84A00, 0x00057F5537B06 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x6C5F2A8C2445A, 0x16A8A5989957B, 0x2D991951B0B8D, 0x39D7751F75125, 0x3706A900DF725, 0x4F56F1B50DC9D, 0x601E7BD2BCBA8, 0x7EAD86BF8E8A1, 0x7BD20BE356531, 0x4E0641AFD2441, 0x39E0D72B73DFB, 0x6225281F86149, 0x4F27058C09A75, 0x27B808E30DA5D, 0x0004F916693E1 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x5730A54BFC174, 0x43383A9F1995B, 0x52DE1E10CB468, 0x15B042E5EEDFA, 0x2EC14400250D2, 0x410D31A145261, 0x555C9C6C758B9, 0x4D4917128C1B0, 0x23AA8C2B6073B, 0x188B16D855B33, 0x333F3B57B0B36, 0x7E4AF1A0ADAA9, 0x67849DD60F153, 0x5EB48DC71478B, 0x00062E7035B21 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x1D93897D8E6AC, 0x159D76D42192F, 0x6E2B88D988323, 0x7F5C8B70D6E4C, 0x226C02012FCBF, 0x371D6D96255F4, 0x21A9D89DEEC1C, 0x230AF7748779A, 0x185EC9E0241EC, 0x5BCE31DD208AB, 0x0AD101AFAC38F, 0x62155938ADC5F, 0x6E8C1489CDE46, 0x3446DCF04789F, 0x00042E99B7D9E },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x70FCB9D02C1BF, 0x1D6EC9F13D751, 0x710F02FA952E2, 0x3E031E055A2B5, 0x36984CE790C71, 0x5F22D8E55F294, 0x01C7D82A9D0D1, 0x281F0A1E34509, 0x02019AB760524, 0x25B1B262F69E2, 0x76975FB54891C, 0x244EC499BB5CC, 0x2E5938BAAD4A6, 0x67C426BAF1897, 0x0004B5B3DDD7B },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x36269B5A59FB1, 0x3475F1777D006, 0x007E7BA61825F, 0x275910235A0D8, 0x5C3E304034338, 0x25585850567CF, 0x406E9E274DB64, 0x4342E73656D04, 0x14CDF7F5A57D6, 0x1B2D1455E1749, 0x1D8D63FE6909C, 0x31C30C1CA1912, 0x54BC43E042781, 0x1909DCD95525D, 0x000299947E67A },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x64D0EA3B15E95, 0x6B0E7677D4EE4, 0x0457EA5832E2E, 0x657B40ED0C5C2, 0x20F27179A03C4, 0x6950EF8D4D9AB, 0x65A54C78537F3, 0x2D31C119D9E3C, 0x0D3726FCA4FD8, 0x41CF9D07D1A09, 0x3669A01DB3494, 0x77C14C14459D6, 0x74E69A083587D, 0x09D94D5069CB2, 0x000561946537E },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x3A4F2FE16E2E5, 0x38AE33368C620, 0x74A7F60AA1FA7, 0x355558A94BFB8, 0x077FF4E3DDB71, 0x27D376E1CE144, 0x64FAE1C026C79, 0x2617F605D7F46, 0x770DFB0A2B021, 0x43B9632A450BC, 0x6CB20ABEA1651, 0x41E9501AEB279, 0x291A710282753, 0x3F036C3115F19, 0x0003CE4B49782 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x2C7712C5BCE98, 0x4888A9CE3709C, 0x0B7451F4504EF, 0x39CC75927916C, 0x665ABFE14E1C3, 0x47B5FAA59B4CB, 0x2277C8CAF9C59, 0x14F7CFB157028, 0x54FBDC8D0DB8C, 0x74940E7BACBAC, 0x715DF69839463, 0x7DD0052ACE608, 0x05440F8D2910D, 0x3EC0F3161CCC1, 0x000570A0119BF },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x666DCF55312AC, 0x14A0B5C2C79E3, 0x0931A1FD69CC3, 0x06B7887D51ABF, 0x04927E7244453, 0x7864775094500, 0x0E63D5068A3C9, 0x3744B00DC679A, 0x7293816B1CD49, 0x4D0A206DC8511, 0x616C649CB12A6, 0x7013D2BFED969, 0x6E8A1A0740AF6, 0x09AC1F1709D77, 0x0001FE3A99E0B },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x7B06DBB176B95, 0x3FF134D4250C7, 0x5C0BF2BD15579, 0x69B67B3A5DD67, 0x7A17DA7C31EDC, 0x44215B21BD8B7, 0x28C99E4DB176C, 0x76C6B497018B7, 0x2D1A6883CB8CD, 0x2B52B1D446664, 0x651F0D7683798, 0x03DEF41EB7BFD, 0x6949DF9CA6AAF, 0x68C48D75D25E9, 0x0006265FA479A },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x14C6E5EF14FA7, 0x46C0921F8F0EE, 0x5874492A0C2FE, 0x064D7376AE333, 0x3E67AD1AD81F0, 0x1EF0DF963267C, 0x1A5BAACEEA5FC, 0x35FF18FC3F0C3, 0x4039490F75825, 0x1828B574393C1, 0x5EA69DC4B706E, 0x5FABBA9CABDE6, 0x24E5078B921E1, 0x3438E7470F6F5, 0x00044364739F4 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x06CEFF7663E7B, 0x463509B8D431A, 0x53C82A9781B38, 0x24F443C5E555A, 0x7FCA0761EF6F8, 0x683649E60B595, 0x546AB50CBE1BA, 0x7FAAE8C753E9E, 0x67377006047E6, 0x778B27D30E2F0, 0x621DF8D4DFCDE, 0x6A7D06B9FC36E, 0x726ECF090E063, 0x431147086201A, 0x0004D0D6EEEF5 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x4D56CAD34871D, 0x7D8C7D8F8F147, 0x153AD2F082D0A, 0x37C231FE8EFC4, 0x1ACE093B062B9, 0x73C4DAE339742, 0x2BC45D44CF8C5, 0x322C06D7C499E, 0x36A82FBBDBCB1, 0x22A7C992A217F, 0x1651C076F8253, 0x169F696D8CBFB, 0x24F79FFECACE8, 0x20A74C7B3CCF4, 0x0004469CFBB03 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x75649BB4133D2, 0x08CFC42AD24EE, 0x4BB855D045479, 0x56FA15555C462, 0x1B9875A643423, 0x0C25985CFBC47, 0x445D564E24F46, 0x2BC0ED0663E2E, 0x0387869FB938B, 0x4B3F53B67AE04, 0x604D665737BBB, 0x3F677598BFC95, 0x534280DF3AF48, 0x6D36E104FF4C6, 0x0005C1782400E },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x42BD45AA35866, 0x51E50C64BD461, 0x5A2CC23176F02, 0x2282EB75D8EAA, 0x5DAB3F8D01A16, 0x66FF1F7DD2B21, 0x1C1E019F34D36, 0x480F28F99B6CB, 0x1554145CDF1CB, 0x7844164EB0C84, 0x0E8656BCBF47F, 0x2E401A0C9D077, 0x32526E6D14A62, 0x44AD8D91EF375, 0x0003C58A19B51 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x27AA90A2DBF60, 0x10698D9AB7572, 0x3393E8DF10AF0, 0x67FB0ED7AA17A, 0x7F587948686A8, 0x01058A7608233, 0x7AFF8DD97AF93, 0x7BADE64A2FEAE, 0x6B49354E84D46, 0x1854616DA0668, 0x6F7EAF6F0BEBE, 0x13CDF20B01325, 0x0EF66E9F20791, 0x1CE6E0465A587, 0x000590CA963A8 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x240DAC55A21B4, 0x7132880AE28A8, 0x165850C28FD50, 0x31BE164086828, 0x32D384AC0FD27, 0x2F997F905E178, 0x17B74030D5303, 0x7C118A208BB57, 0x358178AFB9FA9, 0x4C1D647549657, 0x6BA6C8B0AEACA, 0x01DEEAD0C21D5, 0x5F6824803862D, 0x63142A93948F3, 0x000497655606C },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x0C7A2B0556D4B, 0x23AA63B91BF76, 0x0301516B46F91, 0x634ADD6309520, 0x2E688FCB1A132, 0x47E4F0B2491FE, 0x51F3A5C4B61D9, 0x507B1D1088B31, 0x4205A1DB445E2, 0x2928BC7E37ACA, 0x095F7F48F04C2, 0x7E7ABC040BA05, 0x3268E590A2FF9, 0x2731D38E6CF19, 0x000677A25E3BB },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x46D8F94BB6F2D, 0x10E9A193B03AF, 0x0B23AC27D56BF, 0x01DCC688774F6, 0x52D1CC38F6041, 0x750B57FFBFCD6, 0x433E11D1C8665, 0x6EE638F77DB4D, 0x61372285489E6, 0x7D5BBD5862EB1, 0x52496325687B9, 0x04AB4DAC817CE, 0x0A74AE4ADCECA, 0x4580CAEB5F39F, 0x000354509B0A9 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x0B7633F2E34CD, 0x2B5EC085DBC5D, 0x4140AD62C8A31, 0x4119ECB06F83D, 0x53E0589EB091F, 0x64F3696633901, 0x0570CC29C84C1, 0x62287710E5B0C, 0x5278597B583F2, 0x5FAB1008B98D1, 0x0C5903AD1C183, 0x674FF8F0B16A3, 0x54986269FB985, 0x5A33901EFADA2, 0x00056120455CB },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x22D446BF2B719, 0x04ACFD07862D2, 0x36592DE273E24, 0x1E7756BFA66B7, 0x294AB73429F94, 0x7DE00C439AAF9, 0x579D8925D526A, 0x5AD2C09B9A847, 0x4667255E73757, 0x35B9280AC98E1, 0x0D40DEA6DA705, 0x6537BF496B892, 0x6444291A156D4, 0x4F88E2F895687, 0x0002A3100367D },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x6574020E080EB, 0x5A18EE4EE3894, 0x191248BADDCBD, 0x577F7F292014E, 0x7D808A9D77CE1, 0x7C93356778AF8, 0x353932A16C525, 0x063922A6B2E95, 0x03DE294034A89, 0x3576515F83E8D, 0x6BF69C6107BFF, 0x20577377D4F23, 0x3566CFA3741A1, 0x5F3810F361631, 0x000548D329FC0 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x48B8128CA4FF5, 0x375791C8402BD, 0x2D00D5FBE4FBE, 0x5776633D0670A, 0x63D8F3423D6A4, 0x1EF7B59EE558A, 0x761242049B464, 0x05BEB701CE624, 0x12A49F9B0AB1C, 0x68B5D97B1069C, 0x2912B093CD863, 0x359EE498D47FC, 0x7D6E540A05B08, 0x76D6039077319, 0x00025464C6E15 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x2E15DF93D1F4C, 0x225E1FA840B29, 0x6C21FBC333377, 0x038FF84671A61, 0x1D4886E6D0FD2, 0x469F2215DEB29, 0x2A138618ADC5B, 0x44A737E292690, 0x2BAB29E68F597, 0x522B4380463AC, 0x236FE5E913199, 0x2FC0F79960D7B, 0x6A770F03DEE59, 0x688DC7D82063C, 0x0004DA4DAC72C },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x19776FCF9D64A, 0x7BC34CF113B5C, 0x08EFDC1051F5E, 0x3EAAEAA3C6719, 0x7F81C7EE48CC9, 0x70423778B481C, 0x48CA284E4A2E9, 0x6B78AD16C3BF6, 0x458B2B3351884, 0x0866072255005, 0x52038BFC86C7E, 0x224AF958F9DDE, 0x20251C345612D, 0x35F51C164011C, 0x00031337F790D },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x7D1A993373C7C, 0x4D92192E71E00, 0x7579859292A3A, 0x668F4F549443B, 0x67D9BE0FFBB4E, 0x7DB29CD658FEC, 0x4A3EA925EE43A, 0x5DECB9EB764B3, 0x698EA2B62AA7D, 0x6B4D61F9C823F, 0x5A3114AED6FAE, 0x3EA8FBE536E90, 0x7ECBAE02D83AB, 0x3E320C7EA3966, 0x00067660D7353 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x4FC27088AEFAE, 0x0210245AA1620, 0x300258A7411D3, 0x4BFF37885BBB2, 0x72AAF0D7CB2A2, 0x30D15B3F679E5, 0x1F87CB9BBE1ED, 0x3F6DEA0F9B56E, 0x626BB30CDB30A, 0x19242A0060715, 0x4E2175939F5DD, 0x50739F6EDE750, 0x1460E5BFD7E8A, 0x7021CC6359EA5, 0x00032E5AD76C6 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x1B97E716996DD, 0x203E1E06DB4B6, 0x5E537B7EA48BF, 0x79F4BD9355610, 0x47890F828B959, 0x0BEF9169D4682, 0x7B16B3BF080E8, 0x108D6064A8683, 0x38AF8D4BE614A, 0x5D37A4D9D4697, 0x7ED7C53013502, 0x51463ED669385, 0x4DAD07F21B3F0, 0x0E37A569FDD5E, 0x0005A713C3372 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x7C567BFC04AFF, 0x4CE30650D2F90, 0x30ADCC376510C, 0x1F8C12C28131F, 0x16BCFC8B9F3B5, 0x65F8837AD5B27, 0x371D1E200E45D, 0x509D265B9CDFD, 0x278104D0FF0D6, 0x444FE9828F5DF, 0x5E724C95CCB9A, 0x4DAC4091084BE, 0x6E4EB4BC30B9D, 0x62CD63A8C2E77, 0x0003EB2C0D61E },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x1283D702336F6, 0x5E185B67C87F5, 0x09588658A42CB, 0x064EB50E5FB13, 0x4BC9680B4C3BF, 0x465A060DA1707, 0x52613B0090699, 0x5D9C4037A75B8, 0x6E11C8AF00385, 0x6632DF3D36CA7, 0x61C628D5A59CA, 0x0C28D04F06800, 0x6E6FF05EEBB50, 0x3419F51A7CBA1, 0x00061D00FDCCD },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x20A114873656E, 0x0E268EEB819A9, 0x5A388BD52B63F, 0x1D82AD0CBAA2D, 0x4CE40C82B7235, 0x261199124BC85, 0x1CD8FCBC11A38, 0x37209ADE3C282, 0x75420C560A6E3, 0x73E18A2DB6EDF, 0x6F7D2E5387FEC, 0x1F8F9D690E0BF, 0x067326407F109, 0x3A8D42AD37BB7, 0x0002FB2636225 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x6640C299F6AAE, 0x70DE0A5093DF6, 0x470C7CFE1EBB5, 0x65FCC6C274D45, 0x21977CBB66762, 0x68E4B1532F35C, 0x1E027C5B5333A, 0x147D7ECEE4F6E, 0x31938B3716DB9, 0x7E6897430C068, 0x37F68C4611E18, 0x1C317832777DA, 0x739DF8F60E372, 0x291F369F5BAFD, 0x0005CEB9B81D8 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x171408EF3D8BE, 0x0BAD7C11F684D, 0x5FCD8A0632056, 0x7A6F584327378, 0x2EAB05E0283B7, 0x2545812FACE3D, 0x49C515E57AC64, 0x27B577063EB7C, 0x2A4652B2DEA45, 0x136AB0D2B6115, 0x39FA6B185CEBA, 0x556ED1FD4208A, 0x3F12B32902D3A, 0x5A4163D8ACB39, 0x000326704CEB8 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x55978F0CFD124, 0x3AEC5C6B71927, 0x50905ED26D14F, 0x3B2412C1CF97D, 0x709A9016AE308, 0x0D2A666BC93BB, 0x6A80E8546ECD9, 0x3F10C40D2C0A7, 0x7DDA52CFF980F, 0x65F3AD9BEEB5F, 0x6B43E743A8E4D, 0x41DBFF0C524E4, 0x1FF643D9DBACC, 0x07ECD6A13E922, 0x0005B34486C53 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x1C34D73114FEC, 0x3C396244960D5, 0x5D3CF281ED938, 0x7BA3DD791B5CE, 0x25F0794BA5F73, 0x1AC306F6D113F, 0x7683B26859E31, 0x0CA6A467A1B70, 0x3296B6FBC5895, 0x1CA9296D11796, 0x7D90250925A9A, 0x13F613F8873B4, 0x27E2415D15AE2, 0x70BF56D5D6E04, 0x000498901AA45 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x33CED06AA8DE3, 0x1E91ADA6A5420, 0x4E43F8D0B4ABA, 0x7A54A345569EE, 0x2F1AFCC5E13CD, 0x63FC8DF5EDBBE, 0x523352F0A1CDB, 0x1889AF62207DD, 0x65D719766DD5F, 0x70A0DD372C0B0, 0x5468616058054, 0x54BD11ACF5C6C, 0x3634DD74A4D1B, 0x020EC20387F0F, 0x0005AA7DCA978 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x16E874EE68961, 0x042DDDD8F11D6, 0x055D0D20FBDED, 0x0F46BF48C1CFB, 0x08110CB8CB6AE, 0x0F7C91516A78A, 0x2721F5FD9E252, 0x1F19B81694B80, 0x1EC5EF2C2690A, 0x588237D71FFEE, 0x75ECE8CCEE5B5, 0x44EAA9132AACB, 0x289B6EAE8E6D7, 0x6A81B2DA3685A, 0x000230FBCC6A1 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x1CD8B3FFF1BDC, 0x381FBEE2C6EE2, 0x678769DD7A0BF, 0x04DC34E5EF3A9, 0x411EAD830DA4D, 0x42C2BC4019A2C, 0x51CB3958F1FA6, 0x61F768DBEA91F, 0x58FC17A8DD135, 0x1F31F08DD0592, 0x2D5E009B40B56, 0x39A8D0E07B3C2, 0x4A7EA280306EA, 0x1ADBE4BD61A93, 0x000657C828D80 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x32169FC0EAFE2, 0x70977C727EAF0, 0x5D63AFB492F64, 0x43DB21271643A, 0x3D6E3C7F0E278, 0x6062ADCA52E38, 0x420F5C7C22CE7, 0x2A90813BD71DF, 0x6E6755F8432D9, 0x332A661FFC55D, 0x56786533C26C9, 0x6B004F096D555, 0x11483ED50C208, 0x48F334714D0EE, 0x0003FD3778E17 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x5F69AF1390303, 0x76430498828D5, 0x7EE2DF0E84A72, 0x6632A00B62C97, 0x130C9C34BE10D, 0x3043A7E437435, 0x00FD15AF822E4, 0x4509A47C74B52, 0x11390E8C52CDA, 0x376267F15045E, 0x16F3839C6067E, 0x487BC1A954343, 0x6833EFA26F56E, 0x143E77A3E9E1A, 0x000445AD9FC4E },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x69DB0BAE3BBA3, 0x75326C08FEF08, 0x09AD461E81BCD, 0x68795D573FD93, 0x13F32843795EB, 0x59E31FCC90612, 0x2F39A9CF7E6BC, 0x14E45E28CD305, 0x5B20946259329, 0x72395D1E5C3F9, 0x4ACD6D18733F7, 0x2CCD5E2483B59, 0x0C01B4A35B3CB, 0x7BC13F5F210A9, 0x0002E0F9358C0 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x0C6EBB0F8397B, 0x0E8E0809A8277, 0x4EECAA075D1F5, 0x21400708141E1, 0x26147701711BD, 0x51B6D31339556, 0x1728BA40F7BEC, 0x1248362035AF7, 0x5A4322F84BD27, 0x1D4F3648FE468, 0x6FDF2A2F932C0, 0x0352611A4D8A4, 0x4FA3C6032D53C, 0x6BED681F4DE4E, 0x0003BE33043F4 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x264D0AAC14D3B, 0x3DA25454C9AD7, 0x21445D292BD3C, 0x0C288DD2BF60C, 0x7080D954DD851, 0x0A22E122C79E9, 0x0D11349AC86F8, 0x460ECCBF2B5E6, 0x777A0C1942259, 0x4FA1D66B35C5E, 0x37F013C9907A4, 0x5ED1F76F18123, 0x25A3D83329A00, 0x0409DF65D8320, 0x0003A6C8F42AC },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x54E3A3E4189CF, 0x11176AC6EDF2C, 0x6306832B1945D, 0x3180DF64F67F7, 0x41B40F7F94A18, 0x2320D2C6D168F, 0x23AC7EC02434E, 0x077F4A65EF5EE, 0x40D8A9AE16EBA, 0x6B5C019F84F05, 0x1539010D96E1F, 0x07DD7BCBF5A48, 0x302ED24A46A90, 0x759D16EAAFF93, 0x00049FE355093 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x1E92F569A7F71, 0x732DD9FB1B070, 0x129CB91391091, 0x7A07AC82872C0, 0x12E4584238041, 0x2AC55B8B246E7, 0x48DD2AE708741, 0x28C1D38643A2A, 0x20E18B819269D, 0x76C1947F7D055, 0x4497CF20C8408, 0x5B18E83E5469A, 0x0D8A5686A0B43, 0x32C7AA699EFF2, 0x0004183F4B900 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x7BAB425A08474, 0x049221C3CD828, 0x1BECE5E5FA292, 0x5F83A2D2B8756, 0x25D1013623067, 0x7BA99F1E2896C, 0x53A85DF3724A8, 0x0245EFDD21316, 0x75AF1D797D653, 0x02F3E900363C9, 0x1D1DCAAF1C5CB, 0x6F914F2F2AA20, 0x29D2DFA0A0608, 0x4F046EDF70924, 0x000534E1B90B0 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x68A04CFAD4A1C, 0x20A7AFFF03A12, 0x701A3D7C0E26E, 0x1CD4C9323DD4F, 0x051BF43298A22, 0x7E58DE07C6A43, 0x7D177AD86A001, 0x5F3C280A67624, 0x574B8D68FBDC0, 0x219E08859637F, 0x6410E56254FD7, 0x49D147E825B55, 0x6C4EB844B3DDC, 0x6CB3888FB8CD3, 0x000362A99D15A },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x5395F245D7AD6, 0x596E1F805729B, 0x65DC4C9B3D4EE, 0x0D5530A2593C7, 0x531ADBC36B78E, 0x25CDBB3A35637, 0x0938919387D51, 0x5F5BEA197C770, 0x4B3002E23B9CC, 0x435F0B88DBFFD, 0x53B076D9BBC57, 0x56991D03670CF, 0x5428DEB22705D, 0x554418C1098D9, 0x000510BBC9887 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x1F53E16549DDC, 0x076B82D462D4F, 0x0331A918BB9AF, 0x56F9D127E638C, 0x799E720C8FBBA, 0x31B7A4DA13EC0, 0x0BA24A7C61B24, 0x141EEE1F5A9CE, 0x76512C164D2F1, 0x6C10864A7E676, 0x30F618A9FA16C, 0x69684B26B3439, 0x07BE4E1412F77, 0x324FED1C41071, 0x00048B77C3F22 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x399EDD69DCEF4, 0x5ADE93DDB7FB2, 0x534F2C7C851CF, 0x37C6FAD96A11E, 0x1BFC1D978827F, 0x4DBB3EE5DA236, 0x208A0CE9DC8E6, 0x4F60181BE8D47, 0x25873E9F2E7F6, 0x6A7D9039AA419, 0x02DBCDB342F33, 0x73BF39DEC369C, 0x7B3B834E3F8ED, 0x002C881BDA3D8, 0x00050DA3DF98E },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x6742A04243BF4, 0x55B13E0123F0E, 0x4BBC91B3F0656, 0x557C491AFCC35, 0x2C50AFB2DC24A, 0x3E05E65AB7867, 0x73514BEA9F870, 0x3A0B515C3DF03, 0x0CA1D7FF83119, 0x3188EBE776FD0, 0x2797897E60CCC, 0x49483181AE4A0, 0x53E6235F65BDC, 0x7B02657E3B90E, 0x000208B79536F },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x7932FFEFE09F4, 0x08AF3860F574C, 0x198E613943F79, 0x3B85560041C55, 0x72670686120A6, 0x40953827569D7, 0x52F24446B8937, 0x626ABB87A615A, 0x03C29FC9CE8D1, 0x5777C101F9933, 0x7E3C8D9868257, 0x714E2ADD0A37F, 0x29D2B42A10818, 0x203E170690C1C, 0x0005671BC5831 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x1066A26011D30, 0x1B05F02C0E2EB, 0x1319106B9EEE3, 0x1FD9AFA158E72, 0x07980A8831C86, 0x5075089C81F1B, 0x4FD7725417E1F, 0x5E0833D3BE31B, 0x6BA4DF4518749, 0x4374D68E71F3E, 0x2931BED787AF6, 0x4466FCB16CDF7, 0x4520CF0FE82C1, 0x5EAA2607C0B6C, 0x0004F22376F6E },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x157E0117E8A0F, 0x69E01C11919BF, 0x4340AF9ED7044, 0x33D0FC5502EE9, 0x627D5DC2BD13C, 0x72B23D120139F, 0x28E1EE8B79B8A, 0x5DC872572395F, 0x3D50748817A8C, 0x696FDB6D029A2, 0x3E3C617A4C85C, 0x75764A9750BD1, 0x0153D7446B12F, 0x463EB6C7FFAEC, 0x0005C9AFB72B9 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x1F5F34C8601FF, 0x395ADE7C0A73E, 0x399A2C2C30CC9, 0x35C1145F85CF9, 0x60278F117AB13, 0x3A2C24C42F382, 0x2C2B6DDD86E30, 0x22F1CB3413188, 0x405726CD88DD8, 0x5151267F71DC4, 0x408F4870F4B9A, 0x571A5CD1DD455, 0x2C13455B06D6A, 0x6245B349CCEAC, 0x000496EAAA96F },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x1A7418E60146D, 0x3CDD6137124AF, 0x76B6C8C86DF5F, 0x41F6086CA3404, 0x3B7685BF67A97, 0x3E568866FD96F, 0x6E5861C6D4850, 0x538D1D1DEA1C0, 0x12FA6A8E1E315, 0x1250548B5444D, 0x590619F58FEA8, 0x01E2B64E41381, 0x0577E667C9BD7, 0x5189A4FCA57E6, 0x00044B4766576 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x5E28EA7852AA1, 0x61BA020B83F93, 0x09210CD2D4EB2, 0x3E5F74CF495D5, 0x3D51B63CD557B, 0x016681DD5B5B2, 0x5DEEABF4EC10B, 0x6754446EF2E8D, 0x09FA8CC1A4E0B, 0x271A3FB8648C3, 0x74145B3AAF9CC, 0x32DA2A0AFFE2C, 0x1AF584CABBCF9, 0x33D1731B4C583, 0x0004263AB1CF8 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x6FCCB3DE17453, 0x7C4719E813B65, 0x639E767DF9571, 0x77CAF0E86EBE8, 0x733E3386E22C9, 0x527B343B5014C, 0x233535BC72CF8, 0x15EA68DEB5454, 0x191E405C27E10, 0x2D7EFA138D0CF, 0x71038EF5DD3C2, 0x7C3447F00D558, 0x4D3E62FEC44E1, 0x5348A71A1F89F, 0x0005CBAC55F61 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x19120B124F10D, 0x4E13AE546CD9A, 0x070CB5C1A5AE2, 0x4CCF5B2A6DCB6, 0x2F0A0D8A28540, 0x549FDBCDBFC16, 0x453A13EC48606, 0x18496625D6796, 0x69FB5297ADBDF, 0x5EA1C33AE0711, 0x4572C32C0C8E4, 0x23AD6061759AE, 0x070AF8815CF3F, 0x1F8F72A427234, 0x0002D5E22C042 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x7BE26C584A906, 0x329C24854EC7D, 0x25FE22501F173, 0x7D1A15445D5B2, 0x603E5FDE178DF, 0x2D32FE68486E8, 0x5C166830B8858, 0x7F452C28F87D9, 0x3EE68181575D8, 0x09A399A5F9F3A, 0x7892D2C98D2E8, 0x7E3A38DF0DE80, 0x1757950A9EE2B, 0x7C2FD7ED71522, 0x0003E6618E3B0 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x7FE7070D8C964, 0x26E9691D94CF9, 0x47B6921AD310E, 0x24EEEE106E595, 0x4219FF1DFFD07, 0x15931F8010E07, 0x0C293C0156557, 0x5453700904035, 0x40C4DED961CAD, 0x7731801657835, 0x72B1B76D71587, 0x56E064B959AF0, 0x317089FE1EF4F, 0x59CD67D5504B4, 0x0003BA713DBBA },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x6F055CD5FC916, 0x1421B136D7128, 0x340B479BD43B9, 0x158CCE4282571, 0x4E2AD39C8B85D, 0x0CB77F6215B7C, 0x1384875A6931B, 0x7551089B51312, 0x081EC364DD476, 0x201C2B42B3991, 0x1998D3A4B3A4C, 0x0B1E5339B20F1, 0x4C85FB8307348, 0x155775C0EFB41, 0x0003FB1D69A8C },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x5998C6DF0432E, 0x1C44DE2AF6345, 0x7D90DF4F50C34, 0x408FF2F8B9521, 0x6B5258CCD3FA2, 0x413008F94E4AB, 0x1021D895B55A4, 0x31E48D1E47ABE, 0x6522BEA6F44BD, 0x42646FEF60499, 0x4F9AE4792ABA0, 0x37E649D5D9126, 0x6AE16C706DE12, 0x0B3F6311C6BC6, 0x000342FF99099 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x10159AC74C041, 0x4FCD00497C2CA, 0x6F8F0628DCB2C, 0x72540882BD81A, 0x28C85E80A1FD7, 0x5FE2C45A661C0, 0x36A11CBC61CE7, 0x6EE2079083323, 0x5AF5F4AF7B404, 0x28B02720D642A, 0x58653F575C2B5, 0x1F91B7066621F, 0x2175BA3D7DE18, 0x1AD15964FB81E, 0x0004D7B109B7E },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x6BC185A3A9179, 0x17183A7A8615E, 0x4DD9FD7C574EC, 0x71F5CB8E93064, 0x7D6FDA2D3DD13, 0x61E4B8D33CF70, 0x2E307DF1CB90F, 0x48E8E7AC687CA, 0x27B310B7A92F7, 0x2C634211D394B, 0x40B8A9C62B988, 0x309D73378DDE3, 0x1E9BFD9A743F3, 0x4BE91A0677B8C, 0x000362977BDB9 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x031ED27EBFF68, 0x2CA9C301AD99D, 0x20374E660FC57, 0x2927B1B3E7C02, 0x51DB94AB428ED, 0x03B600BEBDA24, 0x67874654B7F60, 0x1F5638C4D3587, 0x76CB578970DC6, 0x244508AAA2854, 0x5C11CB4780A47, 0x2BF6D024B3B8C, 0x089E6640A8D0B, 0x53F916FF82E51, 0x00040D702CF2D },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x5DA42982A295A, 0x443176C3CD95D, 0x2ACF4BD3C95AE, 0x10266AB538C02, 0x5E8355D88D919, 0x0F871E69D69DB, 0x5BB2A524348AA, 0x2FC4D9F230B61, 0x7EFCDCAEB84C1, 0x05576FC55FF6D, 0x510657A89F1AC, 0x0E0260BA10146, 0x5B7F9E1A9EE69, 0x2F1D6AF292D53, 0x000392FD639DD },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x4F1BC28F5646D, 0x3E374C12780F4, 0x6E0A294A9A553, 0x57388DF267242, 0x210E47BB2B3E4, 0x3F6834F865C78, 0x61C049CA918AE, 0x0E63FFCA32191, 0x386B376F60A16, 0x54A9A3E1654CB, 0x5ED832971F5FF, 0x5F3B4B74DF2F9, 0x56ADD75DB8F9D, 0x39ADF64BF55A5, 0x0005A5B1605B4 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x11633E444E6F9, 0x1112C7CB21851, 0x039C5292263D0, 0x10C535D56D884, 0x6DB435A7A9029, 0x59CE0B1F4F1D0, 0x4F22844C05D06, 0x5429C600A93B6, 0x23A1823974FBF, 0x7C11FE8A81F93, 0x69948E9C53769, 0x545D80A05D9E3, 0x3B22E068A8908, 0x0D913345797D6, 0x000474B2C13D5 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x60C1CD29EEC67, 0x11DA2E881EF2F, 0x6E66956DA4C29, 0x77812C1E8C962, 0x616F685D62BAA, 0x01292C3876D6B, 0x44F5EE2926B9B, 0x18D1F57743DDF, 0x6380B84B5307D, 0x27754912291D8, 0x388C17BA72B47, 0x332D4ABE8A77B, 0x795ED65F7A49C, 0x3CE9434F0DB79, 0x0005BF2BFBC43 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x0395BF4F24DE5, 0x44E221CF8D0F5, 0x2C5089344A2F9, 0x007EF38F8E9ED, 0x777DDBC49AE1C, 0x6F057CEC0A39D, 0x466A03FA57678, 0x1CA48EBB70B60, 0x0D36F7C59EED5, 0x38D2E6BAAFB7C, 0x5700970A2AD51, 0x7B35A5F7BBED1, 0x0848314BCB762, 0x6118BEB8F1113, 0x00038C945FC9F },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x4B74039FA0C9E, 0x0E2FF611F8120, 0x3166CE42BD214, 0x6BA718F654443, 0x46F449E7C0443, 0x5C16ED369E44E, 0x09BED726E4897, 0x24B242F2D2E70, 0x4C26C62A5C2DD, 0x1D9125021F907, 0x15452D4DEC307, 0x5A410298F2C78, 0x106B0D3667892, 0x248B38735A0B8, 0x0003E67AA8AE0 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x2DC07A6CA2E00, 0x3A2A8D84DFC2D, 0x460BB84A2E530, 0x74AF61ABC3A11, 0x053F873085C94, 0x542A2DBCCE0F5, 0x4608745D46AB1, 0x09AB807CA3EBE, 0x37BFA0099AEF7, 0x01F4472D55744, 0x60982BAAE6B57, 0x16514D5705A97, 0x41E318B7A8F64, 0x6F9565A3721F3, 0x00035B4B1D954 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x2A07F7ABB7563, 0x4BECB7A6E3760, 0x2371F29DE5949, 0x6603D21AA83B6, 0x4DFC6CD669AB5, 0x49D23A04DD210, 0x14B2CE4D7BD33, 0x56DB2192419A0, 0x2A0A9FBABD650, 0x1A544CC068678, 0x7EC396FB90FBF, 0x57C50568B1248, 0x529A9446A4BA0, 0x14E860BCAAA74, 0x00056DE48ADF3 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x312D11387A3C5, 0x0B6D601F66356, 0x57F282E1F58A2, 0x7BC0FA3F48B95, 0x5756FC3F3AE62, 0x3ED807C621C07, 0x325211AD1F80E, 0x6213BB05E75FE, 0x5D82CB4712655, 0x169BE954EDDBA, 0x439F1658C0094, 0x5BF872FC1088F, 0x21BEC3EFBE515, 0x5EF142F7850FD, 0x00046CD74201F },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x041D467EE8FB3, 0x229695386105D, 0x7B9C791408A23, 0x0CF776D3E71F5, 0x6A310087F53F8, 0x73975052649A5, 0x2D9A1D11B9157, 0x3E301E8105996, 0x5811D88F7CA12, 0x1F617148BB216, 0x29965D363C2EE, 0x5F0F67BBF8FA5, 0x4CD74675E9CB3, 0x5DEFE6616441D, 0x0004F6DE5DC4C },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x741753DFF4C31, 0x77697680F89B5, 0x00E6DCC572604, 0x16E645DA93F83, 0x1D6B950C9DDB3, 0x19A30FA7377C6, 0x407F10C6E1990, 0x4BB869DFD821F, 0x03E5C9AC4EE5D, 0x65FE14A93FC21, 0x1397982669009, 0x3188727D17F91, 0x5EC36B61288A4, 0x3897E1DAF24FA, 0x0004B45A3E9BC },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x65C35E8678980, 0x7E87837121268, 0x07F0142248EE6, 0x7BE94BC20DE1A, 0x18ACB15ECAC52, 0x0372AB32AFEA5, 0x093335DC67FCB, 0x160E40A23BB62, 0x38CD390CFC7A6, 0x0A74C50AAE8DA, 0x0849BD5D7967E, 0x0B261612D4898, 0x170773ECCB66D, 0x52F874BDD7630, 0x000481B8EC8FA },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x0C3CA2B9947A8, 0x4866F412A6C1C, 0x4B82D56E54B92, 0x65861B6066214, 0x1F5696B90A87D, 0x4C390E529BA6B, 0x607236423A377, 0x2F7EF3A59FA49, 0x49C2F420A1413, 0x5F77B86B7EA93, 0x5C0E54847A72B, 0x30A85C2D50273, 0x2621035BC839F, 0x5316014488EBC, 0x00034137CDA90 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x290A558452C29, 0x3FEFF245BABED, 0x0F4D647959E62, 0x64D22A64E32B6, 0x01933B19874CC, 0x7268A4EEDEA66, 0x096BA754BDF2F, 0x36FD5218FC559, 0x7911C69154C8B, 0x20A89E5AF5631, 0x6458AE8EB504F, 0x420B986B526AC, 0x34E76212235D4, 0x01D1B13883983, 0x0003DA5861BBB },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x3BB3884FA47E9, 0x01E6A1E9BFF94, 0x191E568A36867, 0x4E94353AC9DB1, 0x0041A4CFDFC67, 0x438B805C48078, 0x54A4AD836E768, 0x445722436A7B5, 0x43A11ED3DDCF4, 0x05BB178DBB5F7, 0x452FABC32A769, 0x01A7E35ACADCD, 0x0D9A77BF428ED, 0x43B34D747055E, 0x000380BDC041C },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x6F59ACB5B7767, 0x4A89EF2373840, 0x550A381C82DE5, 0x18D6BD2620D3E, 0x1129590AB7EA1, 0x5E4CE20786B27, 0x0B8E35278CD0C, 0x7F3D331EF13A5, 0x1D7BA88A7A4A9, 0x511D92140F33D, 0x35A61621CA7C3, 0x7D3E1F6052983, 0x50751DF922993, 0x0D9EFE6E78901, 0x0004FE1E98BC0 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x397659E243AC1, 0x6EBBF383A3EC2, 0x5797B0BB6C6BD, 0x2A874497F62C3, 0x3FBA83AF5312E, 0x1DBD385FCEE44, 0x3B20A1035BAD5, 0x27592DB83CF74, 0x7AB2499A48EDA, 0x1CA0E72E14DDE, 0x2565C84A8C684, 0x6CCF04367C1D1, 0x0FF502AFCD6B3, 0x5C28F1D7D3D0A, 0x000269FE80B84 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x56F24A00AFE61, 0x3E4D613D0507E, 0x5A7D356405678, 0x55467277AA802, 0x5DC7001D4CF88, 0x2C87E7558A07E, 0x20B4018CA34F4, 0x3ACF0F00F2DBB, 0x7043A1329ABC3, 0x6A870BB5BC273, 0x0AB5F4DAEB284, 0x3394C8FF317E1, 0x626C7A9E23C59, 0x045F5E7365B68, 0x00056053F6B21 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x01572BCFA0387, 0x1D43A8D78F1E2, 0x0427A00DE09CA, 0x3391F9B6CE8AA, 0x151FC84EAD394, 0x0605271648402, 0x1BCB4823AB6BA, 0x0B8F51F764F89, 0x43F66DC628A9B, 0x3D663AF0C9495, 0x533C206360C91, 0x76A31A8ECB3DA, 0x3D19BDCEFF68E, 0x3E578015377C9, 0x0002E6F745022 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x31856E8DCB982, 0x397CB89DC969B, 0x41B17C3CB1965, 0x12F54A46ECE54, 0x15D76CC942924, 0x7D0B4434ACC4A, 0x49CDCB4CDA1AE, 0x785F28ACCAAED, 0x4BBE0C488F716, 0x1E6266C8B034E, 0x16032FE68145E, 0x7028DBE9EA0A6, 0x2693952EA6EA1, 0x58F2AAA095EE1, 0x0005238C37024 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x378E832C3AF84, 0x11A116B3E0852, 0x1192250846CEC, 0x4A52962E182C5, 0x73300D8BEBE66, 0x723D29E03325F, 0x611480E9F75AA, 0x14435458CE5D5, 0x755417CE9A85D, 0x29B49AD793FCC, 0x42DA6429463A0, 0x4A0AF24BCD6E6, 0x0D0BDFF2945BB, 0x1D78B848A5235, 0x000227917A000 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x557700266CC04, 0x43296D5D17DF8, 0x40806B173D83C, 0x0421D25788E53, 0x16C223310CE50, 0x09033E458333E, 0x0E7F04A264CA1, 0x22CC3C53E9139, 0x45513E0B2F4F7, 0x56C17491D3CC0, 0x20D09E4566A06, 0x4CAB84C2329A6, 0x1BF83DA7B4E2E, 0x2DD956961AD08, 0x0004C3232BC44 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x277D504E9D314, 0x79EC7DD7DDB8D, 0x36A21E4E0C090, 0x57A022F813A60, 0x34839410EE622, 0x7D3B7B37EC86A, 0x49EDE514DDA36, 0x452F231DACE4E, 0x61C7EA40B7982, 0x4B9DE96086F0A, 0x6EE48FFA00B0E, 0x6A331185AE0CB, 0x5778FA4653BC7, 0x715538E126368, 0x00026604F399E },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x4102A266C48D7, 0x25D973A9C53D2, 0x4D0EA20EF59B6, 0x29C7AE0DFF9CC, 0x1A6DC9703E7DD, 0x5FB3ECACFFA40, 0x0F5F095D64064, 0x1E603880A2C12, 0x431DF4F5367E2, 0x681E034F549FF, 0x160157D25F71A, 0x7A7DB823EE6D0, 0x26208F98F7ACF, 0x4A76D2EAB4683, 0x0004D60A8747E },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x69909E8AB722F, 0x3FD1BC2C2E712, 0x4F5C7CF4FC9CB, 0x0A7FA8D4E1026, 0x4FA5A8EFA5FF9, 0x790FBF6DC9F6E, 0x7A7AAAF627FFF, 0x2AA2D03017095, 0x41ADEE7E3B916, 0x127EFD0EC6F83, 0x780D87A5F4F72, 0x71BB9A5E250DB, 0x45CEB9427DA40, 0x787B7CE1D5808, 0x000329D8624D8 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x33FDF938CAAE0, 0x675A47E16AA95, 0x5F5118DC7B640, 0x50BC088E960C8, 0x2B8FB941A27A4, 0x0626DA1C721E7, 0x3930EA2D07391, 0x3D60BC30CA5CD, 0x23B1425AAB6A9, 0x3132B5A40340E, 0x241C443FB8492, 0x6235932C811BD, 0x64A74D8A1B97A, 0x662CB8AE51552, 0x0004C54ED876B },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x6B49F6B8A69E4, 0x0B930C95E2777, 0x6EE0250760C0B, 0x54BC382F91737, 0x1AAE3184DAAD5, 0x56D42E28FC35C, 0x435DBCFEB4FB0, 0x55A3DB8593BBB, 0x5EACB3F582059, 0x0D656C785F52B, 0x2CD69CDE8875A, 0x73ED2C4E68DB6, 0x2AFD80B5DBAFF, 0x6D43E4BA8824E, 0x0004717C7A92E },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x3F181837EF791, 0x3B8EB3FA6AFCE, 0x6C9B0AE86DF98, 0x1B2B4DAA035AC, 0x3AF96F27E3C5A, 0x057D73D9FED06, 0x37FECB8184944, 0x740F587D28DA2, 0x70040901CD8BF, 0x14E027001BA19, 0x29101A13A81AF, 0x619759237231B, 0x68F1294AE7E3B, 0x04AC87B6138DE, 0x00041DA685310 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x18CE1517A31E3, 0x7E4F1D149D0A7, 0x50D8B56D190AA, 0x59AA0AE16A4D6, 0x374CD540EED99, 0x30C04656CC1DC, 0x00256210581E1, 0x2C338EBDB8CA7, 0x6EF042AC922CB, 0x5031407031C34, 0x4A1D13E56D76C, 0x7E1086F2139EE, 0x785216BEF82FE, 0x5A93C41600627, 0x000362379978A },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x3CE1BF5ED08E6, 0x7840AB89D3468, 0x2E7F6C2EF90DF, 0x1494F77C8F10E, 0x3452C960ACF78, 0x470FCE55D52E8, 0x6842255736FF6, 0x740D0B92BB924, 0x63B9D1B5B14E4, 0x11949529A48A0, 0x0EE84D54334DD, 0x7A565E96A021B, 0x28EFA4940D26B, 0x5B3CAD9DC78B7, 0x00043CD09681A },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x76AD6CD83EE6E, 0x2C26948DD47CB, 0x4251BFAE5A7BD, 0x1EDEB15B7C9C4, 0x107B96FAC31A5, 0x7C4FB5E49DED2, 0x5F814F3EF46C0, 0x61CF385CD0840, 0x66770970F75F5, 0x04E19EF2D3D4E, 0x1DE100F45C11B, 0x52B4548928D1B, 0x207DA02548EFF, 0x73105265BA683, 0x000421C61C7E3 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x4F5A2263BD3BC, 0x6DD23E3EC7BDC, 0x2B47C727053BC, 0x6079DB4153575, 0x4AB4F2A1E4227, 0x01579FDD8EC8E, 0x4F39E689D176E, 0x7B0A23EA9001F, 0x3C17B54BEA26B, 0x148245666FE94, 0x7F3339DDF90AA, 0x28CA3E9284F45, 0x73D6B5BDBA9CB, 0x2B527BD10DA47, 0x0005F67838A36 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x19FA967BA78FE, 0x04B1C68DDF158, 0x14C92E0CE9BB5, 0x5278D4F4A0226, 0x3EBC488CEC0A7, 0x065E1BED4D66F, 0x1540A1E0F5F6C, 0x35D9F648991BF, 0x2D24241D30F70, 0x3240A12531519, 0x5C944BE2B9AB6, 0x4BB6156B58D96, 0x643AACDC5C237, 0x37E922076CA70, 0x00032233A5F35 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x64BF0934A048A, 0x2ADBD18342716, 0x58041AC4AC0F9, 0x603A100A83235, 0x19E03075ABFA0, 0x568F503534C4A, 0x42C417BCB4719, 0x20F27F81B5321, 0x3E0FC9AAF5685, 0x0A1437BE7C607, 0x522838C199C2A, 0x62DB1DF01AC46, 0x2E219AFFA3EE4, 0x1D3BC4819710B, 0x00054BE3E1256 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x616D360448B22, 0x5838443EB0583, 0x27017E7B17041, 0x2A1150B1ADD3D, 0x051092D7CE0F9, 0x22226F253A08A, 0x0AD73D6FA27FB, 0x1CA7A67F5C474, 0x7395CA796C97A, 0x3969362DEF37E, 0x483E3DE93556F, 0x36BEEAB5068A8, 0x60348911B17A1, 0x09609236BD552, 0x0002A48C761BD },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x01471C727C33D, 0x55549F0E1089A, 0x0F05F3F7A628E, 0x17135AD4B68AC, 0x2FC63D2C11BA7, 0x1EEB2B2D5C77B, 0x3EEE07D907713, 0x2806FAE11CACF, 0x4D7DE6114C219, 0x02B898DD527E2, 0x1F5F55FA26B3D, 0x5CBAD89A2550F, 0x2FD66E49D5317, 0x230FFB29A9F71, 0x0004CAB5FFDE0 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x0450BB435DB1D, 0x10D3EA7529528, 0x1C74863BC986A, 0x6A600639238D0, 0x502E78278284B, 0x6447E64160065, 0x05192299B4382, 0x569539373B1A1, 0x0D1FE5F6DB527, 0x5BAC1E564CD52, 0x670E3A1DC4887, 0x2620A73586EEC, 0x4DABC19D13EA1, 0x21B68007F8696, 0x0004B3759A08C },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x0ACE25E11FE24, 0x2F31BA5DC6793, 0x29A76CF0613CE, 0x55EF5BD01FE59, 0x79EC47E95D67F, 0x1F94E6BB0F240, 0x0FBA418D5E59F, 0x569B43E32F1E1, 0x29DA1D5320710, 0x5A0C7EACC5604, 0x35C4785645BE9, 0x070DE1B7CACC8, 0x5715E3CBF8239, 0x3E57F8779E337, 0x000489C19DD2A },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x6889CA56F5288, 0x150FE3B32C385, 0x5949674FF45E1, 0x3084FBDD76631, 0x00494CEF57E2C, 0x5A58660A3D33D, 0x364DDE58C04F7, 0x62DE0F0F9AD9C, 0x5293A987F970E, 0x6505C4E4CA9E8, 0x58420867BEC6E, 0x4FED8B211A87C, 0x6235A2F439229, 0x6E68B260929AE, 0x0003AE75B1647 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x65F7F5D92E0D5, 0x15362D5AD6537, 0x5B6EF2F8013F4, 0x1DA7337D1B3E7, 0x2C0AEB918A896, 0x23BEAB6469F87, 0x6ACEF30B87851, 0x390A7F874403F, 0x585E847B3BA14, 0x1692F2E406B12, 0x5151E81EA99D7, 0x726172D8E80CA, 0x0DDEE800EBE29, 0x666C30CB4CA81, 0x00051DA21533F },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x1F5E08F5421A5, 0x42D3746084224, 0x42E3E1AE19608, 0x370FCADC3B9F3, 0x1DC9B07C5B9F6, 0x45A5C175D49C9, 0x47C84D89D3DAE, 0x4F413E20C8A9E, 0x4855748099B4E, 0x342E9587DB4FE, 0x119D99DD08342, 0x6D10D888256EF, 0x3AD5C7C462EE0, 0x3D5755F60DDBE, 0x0004D5391036F },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x1DD79A89E2A2B, 0x4797027A41787, 0x675B71BA6F080, 0x75E4CE719D7BF, 0x51DAAEC964646, 0x0258D60B0FEB0, 0x4B5525FE705E2, 0x2B4FED241749F, 0x22441159221EE, 0x7F85D9698D125, 0x45D5C98D976AD, 0x70E6B10C6DF5C, 0x082E3D765A2CA, 0x5A3A00CCE4B31, 0x0005B4E348D20 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x0EB05C05382F5, 0x54BB99496CC1A, 0x75EAE7964E3D5, 0x3C87223B31151, 0x7F0D3E62D75C1, 0x38F357D15D467, 0x2C212254F43AF, 0x107A030BE8147, 0x23EE50A3F3C6B, 0x6CB17332A2D59, 0x0053249C73E5A, 0x68EE7A454134E, 0x444D8B63E1379, 0x500D38987074A, 0x0002D2A0FE21B },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x772D13C7D2FE3, 0x2E44F640824FF, 0x7175204203CD0, 0x658EBAA6467D0, 0x06D7EB7BDC4E6, 0x477644ABDF6EB, 0x77A1D02AFFC04, 0x0C33D0C6582DA, 0x3481F0D6C3DD3, 0x6534B8AE4B9AF, 0x495DE425BC39C, 0x2552DC55AD4D3, 0x43003C890340D, 0x3ED892533A53A, 0x000567E718FC6 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x67132F49191C7, 0x331322D2359CE, 0x1704491140A0D, 0x14673CA65A2FD, 0x52F4568A2C98F, 0x3E786810BF063, 0x3CD06CA50B180, 0x440F99457CC39, 0x378295C830DC4, 0x0B8CC6FE89D87, 0x45A2629984D52, 0x31EF551DE6988, 0x6852E88FE08C3, 0x2D863A0646237, 0x00022F1C30D49 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x74C5BA84C3B8A, 0x1033C2AC2AB4E, 0x3C5F6D43660AB, 0x4F7678545A333, 0x7495AE082BEBE, 0x2D38150FE21F7, 0x6D1F640FC31D3, 0x0A5D4C0CED90C, 0x1CF3D204EAEB1, 0x7DADFFDD25A34, 0x4F4E25B0DA6CB, 0x679DB18E56B23, 0x2C2F320DEA760, 0x2899522B5EC05, 0x0006664C89D20 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x30BC277FA031E, 0x1C162E9E3DAAB, 0x7713D67378A46, 0x0CC12F23A5C00, 0x2E58D2BF0F2DE, 0x5F0A862E0CD8F, 0x406A7477C2E8C, 0x103BECEBC2A88, 0x696E21B1DE4E0, 0x7313416CE0190, 0x1E05132E6D7F7, 0x68D043AD4BB10, 0x2CA1D564BACEF, 0x0BCE304FB3A0F, 0x0003881CDD9B8 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x16CBCF1FD563A, 0x516919AB4C810, 0x7EC3C37F31094, 0x24E1F71C160D9, 0x3CA8739892204, 0x14702DEC0B2C9, 0x4272833232271, 0x2A8609CA96CC5, 0x15F5F8FBDBF55, 0x4EFC4A01BD02B, 0x33DD9E5F8EC62, 0x280E6C8705D45, 0x39391B8A3E26B, 0x225F22DB64B7B, 0x000663E90989D },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x75BC496BD7D7C, 0x62F0EC47E72D3, 0x0995A3494F550, 0x432AF932CD287, 0x7A948B745C007, 0x002ED789EBEAD, 0x57971A7A97CAE, 0x32C89283082F0, 0x4E68AA534BE2D, 0x51E140E047327, 0x0C8B4D7C92226, 0x6DDEF2A7C4A90, 0x6E0139F8D98D3, 0x4DEEE799A531B, 0x000407662DABE },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x20FEC4F3D9F4E, 0x43822B04E375A, 0x5202C992523A4, 0x31CEBED55293C, 0x4E96E3AD295A2, 0x3D306276C6071, 0x217AEF096609E, 0x2CD14C692621A, 0x02AA8E63FB0DA, 0x14B18EE68B84F, 0x256B669882CA3, 0x5955ECEA6E8E1, 0x02954B5529F92, 0x1819ED484F7D6, 0x0003DCA720C94 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x34E1634B72478, 0x7D61E14CA9BCD, 0x6A534D26D3AC2, 0x571B06A6D216E, 0x6062A2D65254E, 0x7513E62B650DE, 0x5CF3BBF5CB553, 0x3EF05BA9B0D09, 0x5603B08912600, 0x0550968B1E840, 0x0E77C82D4656E, 0x040536BDFD3E0, 0x24B5CA3A1F0E7, 0x285202940B93E, 0x00034F7D04411 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x484A95947B98C, 0x5110960B35EF0, 0x7C50842645F74, 0x6C8AFF3A7B709, 0x291B6E53F343C, 0x1E99306B78E77, 0x4E0810E119D5C, 0x673414FA4148E, 0x56280AE7B0AF3, 0x3B7D6ED170765, 0x4DE45CF28CC28, 0x4495AB5FCF208, 0x5F69671434B3E, 0x3B9FA07D5B883, 0x0005CCD87EBAD },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x01889007CE264, 0x740DC9799039D, 0x7CE540763D820, 0x402D88555099A, 0x64C30EF065900, 0x0BA23572E8DD9, 0x36F8937052921, 0x6B5ED8032EBAE, 0x67D81CE1D8974, 0x36FE27C6D7D0D, 0x7B81A4798D35E, 0x319BF02F27308, 0x2EC229B583C13, 0x2DCB1D265D42B, 0x0003D4E979B74 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x2747F5BDD497D, 0x5220034A0A6DB, 0x7B8CD1DCB8EFD, 0x549873A424DF1, 0x406851F1D1FAD, 0x43D7F22F9AE92, 0x12954F202EAA6, 0x7D792B76F0F33, 0x0BDBCDFCB2FEA, 0x62E78D0971112, 0x3D74E665E5595, 0x1FAC5D9451893, 0x3B6DAD68B34D9, 0x22676CC373660, 0x0004FF8EEB975 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x11B48C03DD199, 0x404F89965D009, 0x2DA6C623E3196, 0x69113610BC409, 0x098B7635D503C, 0x29794D489B01F, 0x788F4D03DDD32, 0x04C30AF9D996A, 0x2B33BAF9CEC05, 0x06ECA75F911A9, 0x6EFDAB1FA4DF0, 0x355D78F4FA49F, 0x21514F66CF1D5, 0x592BBC8B21203, 0x00041781A724D },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x7C942A0ADD9E1, 0x22737EC56AC0F, 0x1B2E1C62DCF21, 0x2EDA07ED958EF, 0x72F8DC5B9D12C, 0x7C677D87D2776, 0x39AC55CAFD08C, 0x0E15C3EC82AC8, 0x792EBC92B6C57, 0x7972FD85756C2, 0x11A69F571E721, 0x6DADBF83EB351, 0x6C4D3834F0B58, 0x3F351963372EB, 0x00055E4A29998 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x29949D7298A23, 0x6F0BF27D10568, 0x4F9CB59493004, 0x048DC0E947151, 0x42D12095BF3F6, 0x7069A28B6B57F, 0x6F352B83F1967, 0x4C7E00AD878A6, 0x4015BC637E3A4, 0x3D8F963A605A7, 0x7A7B17707975B, 0x5A9D75A51CA5C, 0x7C653BC3EDA66, 0x45BC0406A1443, 0x00038258E28C3 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x6595E65A523D5, 0x2DD711CC54F09, 0x45C728CFAD527, 0x21B50AA8B75F6, 0x6D731DDAC4D49, 0x569EEC28B5B0E, 0x1716733150AC0, 0x4734E5D8973CC, 0x6C36E12304CD7, 0x2931CC11D962E, 0x4CDB88D8A1FBE, 0x21A588BF0696A, 0x52F844FE976A8, 0x36076FC6DB33F, 0x00049F6ADB138 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x2DF152DC9663B, 0x7D8544DCC46A4, 0x200C9153D76E4, 0x36454A1CC1D21, 0x1E505D6FEACEE, 0x016451BC48787, 0x31910CEA74BE6, 0x52BA7CE203E1E, 0x1D83CEE0CE207, 0x3DC1588487022, 0x19570BBBF2510, 0x2A9848634AB83, 0x117C592FC35C2, 0x03DD3A376DB4B, 0x0003D9DC0FF53 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x2C57A7D0D0FD8, 0x6AD741184B3DB, 0x7EDC306F7BB25, 0x3D3F81C7AA4C2, 0x5428B07AFDB9F, 0x7A2BD05C0D5F9, 0x7DAA28B4F547E, 0x5209D24E8703B, 0x3B394C3AE5D1B, 0x572874DE1E2D4, 0x11B383DDFD42B, 0x787A9DC8DA07E, 0x6F38E9687B3A6, 0x05A252414EFD0, 0x0003F9131E612 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x4468AE74407DA, 0x0478F407F0AEF, 0x4F3B82B1F6E11, 0x45E12744C8FF4, 0x0CECD63D83C17, 0x072527F05C594, 0x13941E1EAEE83, 0x49F6A7D4EB161, 0x44945855312C2, 0x4A70E36037563, 0x77D9A67716326, 0x2BB7CC84FF9BD, 0x150250F7B74D5, 0x06CC73AED8A56, 0x0003ED0B3B177 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x6302434981567, 0x54EA8BFC64196, 0x5E6D19BEE1EF7, 0x1992510EA8DDB, 0x05C49D8266745, 0x27356FEA6831F, 0x73D88030DDAC7, 0x0ECC3B8838977, 0x5EA0F4B69822E, 0x51BCDD848FBE9, 0x1208C22BBC1BC, 0x75496AD08632B, 0x59EC81D924A51, 0x1E67EF2E42DB3, 0x0003B21E48AB2 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x2633A6EE06EC1, 0x5DC1EC53802AB, 0x420FA1EB0817B, 0x2FC94FAB88A7D, 0x1BABBA9B57877, 0x2A6B7583C7527, 0x1993A47999A08, 0x0E34C1F3CF146, 0x66A1009E73D51, 0x69DDF0D3A705A, 0x0AFBFFAA24EB3, 0x0FDC51AF473D8, 0x6FA9CC73A9354, 0x2B861DE13F945, 0x0003B1F1FDC67 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x345017919085D, 0x78119CBBA0BDD, 0x2974D921AD045, 0x06185ECAD5A82, 0x723D2801796B2, 0x3C10D6DED93C5, 0x2C3235A7CD9DA, 0x43A746443A217, 0x5BF2E923115DA, 0x65137749F8CF6, 0x20C0EF3FCD80E, 0x1FB9CB8B29D2B, 0x5D0A1002B2953, 0x098B16332578C, 0x0005BF841EC18 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x24D5C80DBE1BB, 0x2DFB82976A410, 0x11635CCBEE2F7, 0x5C3397488A998, 0x51FD8A5AF33BD, 0x7F322B3FD503F, 0x5CFA51174BBDF, 0x7DA72247608C6, 0x0E022846015EA, 0x59F2D513F3C0C, 0x4690069375883, 0x0F199E4A83089, 0x792C832C625F7, 0x1EEB3315D116B, 0x000472C67BD81 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x67E258DA4B4AD, 0x1497A32C91F35, 0x21E72DDC67455, 0x66464CBADDD49, 0x16DB65CFD7A44, 0x73CDCBD85A1F7, 0x17F3060F099AD, 0x10C7090E5C0D5, 0x554D3EC0C8343, 0x3393200FA1F8B, 0x549CCFAAE31AA, 0x036A4916A5A29, 0x26FEB67E28B30, 0x1D710D93BFE7D, 0x000561AEB80D7 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x2DBAE53D8FEAD, 0x72B132C541333, 0x66CFA4805AEAA, 0x48F19D1DBA84D, 0x77F39C724F2D9, 0x6A1BC7FE14A34, 0x75BAD4AA18005, 0x6F59E218F4A68, 0x505F5A4D358A5, 0x1EAAD43574EE0, 0x3F454D53592A0, 0x7D52B7A474E39, 0x2B0E7D50FAEDE, 0x5AB5D17F3E61B, 0x0004E58F252A3 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x39392756FE5BF, 0x5C9FC0D27B90E, 0x5BD4B84E02F65, 0x6231E27479124, 0x7670D41E70FA1, 0x6CEC0E6BDC3A2, 0x0CCC297C2956D, 0x49CC807845C0D, 0x290FC790BED81, 0x53E2AD63B2056, 0x64E0603BA7D97, 0x50B67226F4B96, 0x10350F20316AB, 0x74D1750AB3EEA, 0x00045E90E02CE },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x44AD7169FBD55, 0x7F34C254AA15C, 0x7FEE9295BA785, 0x230AB53E23E32, 0x165310C910CDE, 0x38AF99BBA1DE7, 0x44FA1A5DF3B0A, 0x3CB8644D1E74A, 0x62C34F69F8E0C, 0x3474878965FF5, 0x4BCCA685ED3F9, 0x320CCACBDEBE1, 0x0741842EE413C, 0x05982E1C30FC0, 0x0003F03F68827 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x09774E1BE1DA1, 0x0D01A16CA098F, 0x4B1F3FC7A71A8, 0x4D2544FFC53D1, 0x090F579594969, 0x0051DCAD499F3, 0x42257785F75B3, 0x5F617A4107969, 0x158FFD2D3012F, 0x6EA21FFEE0D87, 0x5ED797463F616, 0x6071FC835C96B, 0x7AEA4F8C4B7E0, 0x40E10833DBC28, 0x0005A7DA3092F },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x7962A2B6AB53B, 0x3634EA3794CFD, 0x389E49899F859, 0x79FFC16D6CB61, 0x507FCF9EB7D13, 0x7D3B562B1AA60, 0x712A80CE5546D, 0x71F89A2889401, 0x41DD3E434492E, 0x70B0E34B627B4, 0x7BEF2EA5F78FE, 0x3D5E81DDE97B2, 0x3637019A5C117, 0x725EAD72D4BAB, 0x000419C712A3F },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x53229898D514B, 0x78244B1B577F6, 0x62CC5B8BB7AA2, 0x793BF002DBC96, 0x3977CD7E473BC, 0x203F9FCA67497, 0x614993A1D8C78, 0x443621CD389BB, 0x46FD6894226D5, 0x198F7B5D706AD, 0x0588E67221F85, 0x5A752D6B66E35, 0x064AD80BCC023, 0x110C44041B855, 0x00067555F636E },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x60B19B3652E39, 0x5EDECEE4DA353, 0x442F81940DFAD, 0x4F7292D8C343A, 0x65489BC52F4C1, 0x4F0F58F700B5D, 0x3D22B99125166, 0x7D0C5E3B87561, 0x497C810C4674F, 0x7405664059643, 0x00953617E2F34, 0x5953275018D23, 0x7225074965D43, 0x7A02704461153, 0x000303FDFFE34 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x277E2E56337D2, 0x48CF0F4F82820, 0x5282BEE7FE196, 0x2DA61D5E16588, 0x10681B4FA4104, 0x6527ACB8236EF, 0x46A75926ADC60, 0x0DD12F9EDA637, 0x1ABCCEDE3D7A9, 0x1A7EA74E15CBA, 0x3302EAB4344FA, 0x3CEDADAC92E5B, 0x582E2C83AFBDB, 0x626B7EFB87C44, 0x000697F04ECA8 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x262437F5951B6, 0x06F0DF6349D43, 0x761D488FC74F4, 0x6BB330D719C22, 0x132FEF4B34BBE, 0x20E12FA20BB87, 0x2C205FE24ECB3, 0x3CB76DDBCB054, 0x7D8210CF69175, 0x40A04AE356B7C, 0x7D77DCCA476A4, 0x4026FA932ABB4, 0x750407F103F89, 0x64C81DFC7B289, 0x00039C8A46D9E },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x44165E2C6E1FD, 0x617C64BE23F66, 0x3DBE6326244BC, 0x1DD37347BAE73, 0x2D94C057A297F, 0x34A1BE0079258, 0x0A7D24087FB70, 0x140F25106F3A2, 0x3EA678ED745C3, 0x737892A516311, 0x26D8B1C1F2714, 0x2314373A2DE34, 0x3314D2A0BB980, 0x718762C714719, 0x0005B1DCD0FC5 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x1D20D5BC0B9CF, 0x593F39E5C8689, 0x77E27309D38BC, 0x47790FC5A00D7, 0x071DF473373DA, 0x6A954BEF26415, 0x5BF13A06435AF, 0x7EE1867E22CF5, 0x61C076B592093, 0x092F9AD197355, 0x1DE745C228CCC, 0x464963B44FAC8, 0x4DEDDAB01BE23, 0x6D51EFE72DC00, 0x0004A6DD531DF },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x0B4E386820F4F, 0x25A13670AFC38, 0x383594B0964B2, 0x5A84DED93D134, 0x605756A07A3FF, 0x61D8968C3F731, 0x46AFE3CA35204, 0x3F2C25BABC404, 0x004BBA77A62B5, 0x5DF29548B0419, 0x2AE3F3A77BC5D, 0x1D2AFDD5EA89B, 0x4708B9746F998, 0x7F7E00A1EE1F0, 0x0005FE5DB4ED3 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x1FA7F660BDED7, 0x07E1582F7ECC8, 0x00628D43A5243, 0x4C445C29BE563, 0x793D69314BD71, 0x28858E59AE484, 0x5C3EC50513FDA, 0x4D46A55C5AA6E, 0x01AEDCD53758F, 0x17B5FB0F47939, 0x3FB425A46BE75, 0x6E4A7A80D51F6, 0x51AFF8733EBA0, 0x7C8B984CA5224, 0x00045713910A6 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x5F8A6297CE019, 0x616D71E5DE0E6, 0x29195503BA637, 0x0296100114064, 0x6CAE2A8347F57, 0x0A495E82C5A6A, 0x56C59FCB177CF, 0x316292EBE20C3, 0x0C1AAC68406D3, 0x0D92270E70266, 0x2C323121C68A9, 0x6D6B7E24E84E5, 0x15830F9D4C767, 0x2A6696852E34F, 0x0004898927606 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x424A648156BEF, 0x1948489369F24, 0x71392B109FDB7, 0x5A5BCC8599D43, 0x25C2F6E904CC9, 0x3C588F8D92603, 0x675765068D166, 0x1E1EFBC412327, 0x36840800682AF, 0x62E5830BC0A2C, 0x2DA1106631231, 0x06346254C0C01, 0x785F29FD24C4D, 0x219F61F8F378F, 0x00045CDA65E5B },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x2DA428C47663D, 0x038DC7DCB041A, 0x50D70A12B0859, 0x27621C786A2DE, 0x6EFF999EB785E, 0x6567A2FA731EC, 0x39934C282A390, 0x11ADB7C1CFD78, 0x2D714108300E4, 0x78E5CF8B93804, 0x248DB3C35E6D6, 0x66A546BD3F5EC, 0x6AA942C9C8B8B, 0x5E4971446B7DE, 0x0005E418AC849 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x7A559444AC0F3, 0x651DFFEEF4D0B, 0x173ABDA1BECE7, 0x00F92CD53D02C, 0x6A943C442AD4B, 0x7F75B2145EA2C, 0x4EA97EDB53BF8, 0x2B3ECF0DD0BB2, 0x21A186A2224B8, 0x60BB540E54E5B, 0x79AC1FC948AE0, 0x71D62DB0270B1, 0x56B9FBA7ACCF6, 0x1118219F2E94C, 0x00046C472AC06 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x45FD8A61ABDE9, 0x090698DE7FAD1, 0x0FB40DB442268, 0x7B12DB0D896DC, 0x47714F3AC9133, 0x429CF3BD04DB1, 0x27A73DE84A9C3, 0x1800C4E690722, 0x3316C79E2358F, 0x209829B9EBD2B, 0x5E98F216164CA, 0x0E87AA6F098CE, 0x3DA235BD71AE6, 0x63F740450C848, 0x0004D25F8B693 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x685C98A672D79, 0x356629F46B253, 0x4C57FE4BF5E94, 0x0C39448CA4E8B, 0x1BF6828114A7D, 0x0CF795A8095B4, 0x6D071967D7818, 0x6D4AA7E2F55B4, 0x5EE0FEC5105E2, 0x73726AD409AC0, 0x72C78AFEC6406, 0x2DB7785B9DFB3, 0x4E6CF52D813B9, 0x43F2096E762E0, 0x0002BFF1F93E2 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x69FF248CD3AD0, 0x642C6C407062F, 0x51D8040B390CD, 0x57C87234D9AFD, 0x7D1934F4D6ED4, 0x741FCFE3B6190, 0x511B1F1E20FDE, 0x31D150B87A5C1, 0x71E7498F7793B, 0x2F8D6CFAEA63C, 0x618429DA4FB8D, 0x10E39B4825864, 0x22B72D04A31C8, 0x6189B6E56ADD8, 0x00054FE33F5EA },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x7F5F7EABBB5EC, 0x72FB23F2414C6, 0x3EDE05CAADB40, 0x6473DE88B389A, 0x18E8941A28722, 0x4D90C1BEC3C3D, 0x3489F3A741B6A, 0x4490161D779DF, 0x19BED1BCE08C3, 0x62CB62BDB21BF, 0x052D98A56617B, 0x2F9D142018316, 0x0DDC2C753C112, 0x1F033B2C9B387, 0x0001F4D47BF84 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x5AB739059A71F, 0x561B349020479, 0x5954CF651D1F2, 0x3A66B3EA92C0E, 0x5B85D9E4AE153, 0x3E77091A64A71, 0x39020FBA2A621, 0x267DC10170461, 0x6577D4ABD3377, 0x352B7CE428912, 0x2954FA9DB8604, 0x3F5023465E15C, 0x13182D1C4D9DC, 0x0D627FCCBDD4A, 0x0005E39FEAD0A },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x5A71C41D81F8D, 0x505E6FE8C711B, 0x668665224E67B, 0x0785FD979208C, 0x265BCAA47A9D8, 0x0CF0C3B8971DD, 0x6413D6CDBE491, 0x00F64C7B3A8FE, 0x586EF17D75342, 0x4AB3A17D80016, 0x1B364563B66FE, 0x4D4E8DABC455A, 0x2B1F3E3F1E5DA, 0x1896657DB0DD7, 0x00033132A1B36 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x24A0BFE26501E, 0x6EA8925D25B12, 0x3143F1AFDBD54, 0x71744CC3A2D88, 0x3043B63277D4A, 0x2DFCDDC8340A0, 0x4E415E65E7139, 0x335B35A1C57DA, 0x366D970CD35D3, 0x1E8D8FCCB360D, 0x6DC734CF07F6D, 0x2187B1A218A61, 0x701A44D14DFEB, 0x78A372E088DEF, 0x0005DC4BC0339 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x5DDBA420D2334, 0x653CEF6887F02, 0x61689CDF5DE08, 0x4121921402E0C, 0x44C6A3E2EBB80, 0x5178042B7DD18, 0x4CFDE67AA539B, 0x673A6D918A976, 0x6B1B374EE0B4C, 0x2BECE2DE1DDED, 0x1A3EB0FC594B2, 0x06F0C18299183, 0x36E3CB5422A0B, 0x0EB8834E167C6, 0x0003668D7A855 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x0D4139159FCFB, 0x55A4749B5F88D, 0x6EBE9EE5C8EBE, 0x626AE909A5526, 0x0D2A380C426B1, 0x319AE3F1CB22D, 0x22FF873487FAA, 0x48F45820C62A5, 0x39B6E239A5979, 0x28963570C4C68, 0x0650CA4AA538D, 0x63C1F991A2F64, 0x7B3131C697920, 0x03B17D249C10F, 0x0005C598583D8 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x050DCEFDECE9F, 0x208B08EB7DFE3, 0x58FBF197C2986, 0x7F3CE9E919C0C, 0x0A1720625D9D8, 0x10CFB27BF0775, 0x1A5C6E6437449, 0x64EE211786F86, 0x45D303F8F02AE, 0x0CA540D64CA28, 0x446D9B1F1439B, 0x2A77169C72DB1, 0x55AAE11A8A5ED, 0x0CF54910D3B80, 0x00046E3F28D3F },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x0296D300094D0, 0x37C395E15A6B9, 0x495D4D2E100E8, 0x221A9441B48C9, 0x2C4D371375B41, 0x61966D9C31EB0, 0x7410E0A0191C0, 0x326CE3CB2C68D, 0x78FA7E0C1CECE, 0x47748A20C7F21, 0x5F2E08BF592CC, 0x3D94CDA301E8C, 0x62A0EC4D8B7DE, 0x022052BF62AB3, 0x0005133DEF7AD },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x547F0B89E498C, 0x141BD24B847B1, 0x33F9B48C5ED6D, 0x3C14EF434ABE1, 0x098C87BCFADBB, 0x0DAD8342F841B, 0x7A0EAF0ACC784, 0x37D16BF75C844, 0x7384A91889392, 0x5E16AF4E81E9E, 0x4AC3663CDCC92, 0x63EE7830B972F, 0x219D121603530, 0x6801684291C19, 0x00039344BD1B0 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x3EEF9D38464DD, 0x191B484A0E612, 0x0A1F466E982B0, 0x6251561BDCEB5, 0x70DD524577A12, 0x1DFAAF3480BDE, 0x12470EB0F2BDF, 0x16814D794A487, 0x34954C067F5D6, 0x1A2FDEE70AE7B, 0x600F2BB4337A5, 0x2BAE24CAAF9F1, 0x777C1F07AF883, 0x6A9CDD9AC1CD5, 0x00060B586D4AF },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x76F9447E2AE65, 0x707BCD65387E1, 0x77E353041AE17, 0x29BAF7C864012, 0x31E8DAC7625BC, 0x43F0862C8F07C, 0x5FC0697093C4C, 0x1CC27B9526857, 0x135FBC7D653C3, 0x39C6AD19030EC, 0x1FF499B2DC05A, 0x22E0C44B824FE, 0x6E9600977F8EA, 0x1E4D17A108EBC, 0x0002991115829 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x2EDE666BD79E0, 0x72778BC9E9CF6, 0x74956680616A8, 0x45B069DE9A2A4, 0x25D7C4E392E93, 0x37D76D3314689, 0x2A31FB173D478, 0x3CD355ED711B7, 0x040CA82739164, 0x5127168C28F87, 0x4A52164D3CCF6, 0x5AC4A80B8FBAE, 0x23E39FA07EBDF, 0x1E57B54C4B5E4, 0x0005B5E52AFAD },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x02F8756F5A220, 0x2BC984D7CF9FD, 0x4EF8D1F2B9525, 0x5BCBA3A488AA5, 0x4311555050FCD, 0x2F1D634F94434, 0x08E0AC1E025FC, 0x70960429985B0, 0x37475CDB61580, 0x6FF991A9DD62C, 0x25F30C4C4F933, 0x60DEB6BA2CF36, 0x1FC5C5F1E6286, 0x1E2E6FBF7680A, 0x000351C3F88E3 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x6842EA585ABBC, 0x50C4C5E5E148A, 0x1F0A688BCEC1C, 0x4FF5FCC07EC2A, 0x78E95F9361282, 0x369DCFDDF9A4C, 0x793B0801667FF, 0x2018C60C24A03, 0x345ADAF5F3AA5, 0x62E4AFBB60BCD, 0x2BC852AC31E81, 0x719B07A16F0C6, 0x09BDCC55BB69C, 0x18DB72D648576, 0x0004EC823A280 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x2D0C4D5455E74, 0x45CB463FEF333, 0x4ED13A97C9B78, 0x4525621BB8DE6, 0x2388F8EAE85BE, 0x5EF57094149FC, 0x4B0A87B620AF6, 0x637EA393F111C, 0x462C1D2DD7119, 0x46F307E359593, 0x5D98A0EE1D677, 0x41DDC200EADF8, 0x4B78C76CD6708, 0x24605DB7E49F6, 0x0003501F0D9E4 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x08E8C46151573, 0x20EC9AC62BC88, 0x59DC22E2006E8, 0x3D9DDB4B104F9, 0x28F604147917B, 0x5A265E67331AE, 0x1633CD015183B, 0x697138FBD5EB7, 0x3772E85AFEDDD, 0x06213327B2903, 0x4B664EA79824A, 0x4727AA42EB6BD, 0x2EF1480154CBA, 0x304C96B8AAFBA, 0x00060E7AF3669 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x491B0BAAF9619, 0x55AD24FDA1335, 0x6F48827A6FE24, 0x3122EB7E3D7B3, 0x31EF24059700D, 0x157766163BF9F, 0x3C05D5C5D30A3, 0x6F38B8D21FEB5, 0x2089AECA0FF81, 0x4A8D42C4BB754, 0x2A475C3C86FCD, 0x0DB4E4B7D79F5, 0x4EF87CBAA95A9, 0x26DD7A1675C64, 0x00040DFC6C8C7 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x7D666B1F8A87B, 0x316CA44888295, 0x78B2AB5E74C3E, 0x524FDCE65E120, 0x6237B1C652254, 0x4001BC305912D, 0x21B4E7DE12A7A, 0x54CA1C8A031C6, 0x6156E15B52FF5, 0x3D959C2137E00, 0x3DC4B65BA712C, 0x295432CC5E9CD, 0x1C7994855377C, 0x4C0A034E2ECA1, 0x0005011B0D6C5 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x50504C32263E1, 0x2A879127B3473, 0x221BE97D0D625, 0x48CB146730090, 0x4E17B1ABFBC21, 0x2535D95FF1914, 0x3EF6116D5B4E9, 0x16BF595CB63B7, 0x62880ABB28F75, 0x5AEFBFEF9DFAC, 0x21726AC6C056F, 0x063894CD2F6B4, 0x16AD33DE3926A, 0x442238647719E, 0x0004C9776A1B0 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x67B34F99BE2E8, 0x2CC3C1913A276, 0x715421937818C, 0x017415070EAE8, 0x08BC077E7E3B2, 0x4138C5DBADF09, 0x701478502CFAF, 0x3C016C4E88CF5, 0x11D362B3A9229, 0x2E7DF797FA592, 0x278D8AECEFFC8, 0x71E37F1C04B98, 0x57B1C944CBA88, 0x355BB6C8E024F, 0x000479371E3B3 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x6B1FBD3C84FB8, 0x54EC0B0E0ACDC, 0x16FB04B0474A9, 0x31258C7C1EE50, 0x19DB57C8F363B, 0x5A75DDCB48752, 0x06368B9905661, 0x6BA4DC7A3F929, 0x248CEE90EFD06, 0x2EA06B3A25F23, 0x3D5ECE226A569, 0x10DA90087B8CD, 0x04C71CEE6A624, 0x5F3622F5F7B62, 0x00044151A3B3F },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x1EAAC085B22F3, 0x38F4CA0554D18, 0x6681A1B626377, 0x59199DC7A4266, 0x7930C76FB21C4, 0x4E6AE25CE76D1, 0x162F88410CFD7, 0x3BA52B41830C5, 0x6F5A0C98A5A65, 0x78B931E18A509, 0x2AA8E65397B7F, 0x1D13674F23B35, 0x09340F3887609, 0x0DF40AED3AFA4, 0x00053851A63A7 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x3040124797AF5, 0x0FD71C425CEC2, 0x4E383ECC01315, 0x0481312A64C6F, 0x173D8703C232A, 0x1E1B1A57E8C8A, 0x3F22605A651FE, 0x2EE4FB010F343, 0x419ECF48C1907, 0x0788EA269A286, 0x4F6C2D268F5DA, 0x7D06AAAED31BB, 0x0B56E779A17C4, 0x5C52F61A15C25, 0x0002966E91E0D },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x5F20B4E96DE40, 0x53103090C810F, 0x2D416D7F8062F, 0x5FA3BB5C3F4AC, 0x0EEAD58FFD81B, 0x5B5E1A996938E, 0x760C5277BCB0F, 0x34E521458B0BD, 0x465A5B88AD1A0, 0x38A3C20EFEEA9, 0x7FEE8740CA7E0, 0x6B0327E4606BD, 0x24E913F8BF64E, 0x689159B1E1EF3, 0x0005377CB724A },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x2C5969D7EA2BE, 0x788CE69617720, 0x4D5F5DFC74BE3, 0x2C09559C1F60B, 0x107CC9674BF57, 0x4076581DBD432, 0x58E8CC4408761, 0x1EEDB854DC55B, 0x2EA80F1BF2EA9, 0x09C81479E0936, 0x3F63D654D13D4, 0x3F6CED3E5DCB3, 0x78ED0FC4D078B, 0x1C0B21A80C2F0, 0x000315E974D18 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x43C99632D4496, 0x19068CD7995D2, 0x62D389DED4113, 0x393B2E4FEECD4, 0x0C6349B8CAACA, 0x0046B2AD9BACF, 0x691E54F0634C8, 0x2A60ADDDEA2DD, 0x54A8EF06FFB27, 0x38D23793C4A46, 0x01D5CC1D9C934, 0x122404213ACC4, 0x327B14BC66B07, 0x2BE22DE186519, 0x000589CCF768A },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x79EE009038F5E, 0x3EB7C8A9D3179, 0x2A7BB24AE8412, 0x3CFD67CC418AE, 0x3655C6DEB2280, 0x18DA634FC3689, 0x72ED280601E2A, 0x7387B0201D9BF, 0x6D6FE9A516FA5, 0x4C36A2CAF09A6, 0x0EE439A747816, 0x42434BDF31400, 0x7C395398AD0D8, 0x30C9C4F452C48, 0x00039C9C3A75D },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x273B4FE36C9BA, 0x51B31B281AB92, 0x788DC7C5534BC, 0x334D4C814B3A2, 0x6CCD46F0E215A, 0x3749EE79302DE, 0x17C51225EE113, 0x3A365C19AB6B1, 0x4BC69469C0570, 0x29301E4D794A3, 0x2E2AE7FDDBD42, 0x7674358DA0B0E, 0x42B373348E8C8, 0x676413A1D014B, 0x00056F98F0694 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x086B4E9272D90, 0x1186137C8DBF4, 0x4C87DC087CD1E, 0x31DE63747FFEF, 0x43F546BD8B1E2, 0x3AAEE42AA4980, 0x7112388E7DA13, 0x7516B6366D978, 0x50D839EA3EEEE, 0x2B26EEB55D332, 0x4EBDF47764DA3, 0x2C469E7ECCAF2, 0x737C4ABB8F292, 0x53A1B38936A3A, 0x0002932B21456 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x3608E6F711901, 0x5E68564EF7B64, 0x3C58BFDE260C0, 0x30E1CA6CDCF01, 0x4E5193FCD4D08, 0x547412C58F8BF, 0x161B9EBC8DF12, 0x63A2B31A75503, 0x7EC4805DB9F1A, 0x54B2820538A6E, 0x445007FAF00FF, 0x7063423B244D5, 0x03C75092D2D01, 0x4A52E1940082F, 0x00052E16200EE },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x560E286EE336B, 0x2222A38702FE1, 0x11FE2DA046E0C, 0x463E933F77FA2, 0x0C1A1324800E3, 0x3F1BA7AC52E27, 0x1853EE54C1C82, 0x012E865A8BC11, 0x5F1F20E66E284, 0x272FCE96A3F1E, 0x515C98AD465A4, 0x6E4ADC1C85B52, 0x25B3C35A6C50A, 0x62682BA182B1A, 0x0003CC1757249 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x7D9ACC21D4D50, 0x4AF2C68374B61, 0x4D33A955AF017, 0x596235BA14594, 0x796A40960A2D7, 0x6BA5A5D09E64C, 0x0887680766B67, 0x2707F7E0FF953, 0x5FDC5FC2398E2, 0x25E6CEDA37AA8, 0x355A8ABD96026, 0x7BD1993C1FABF, 0x3230CF596C9CD, 0x43848FEC795FB, 0x000478D247FE2 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x7986ACBD5CB00, 0x7D140988D704B, 0x5F60BFED2ED6B, 0x54566AFFAFB5B, 0x72D999472B5C8, 0x417208D9E862B, 0x60C7EFBAA1C4F, 0x3A493ECE212F3, 0x2C3EA4CBE3205, 0x068E95746D119, 0x1A57CA87AC105, 0x076268B9518C7, 0x285476F0F7F1A, 0x03F34FE88BE62, 0x0002FCDCC2F95 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x71B23D8098218, 0x2D3968AD6EE47, 0x6405B4A558329, 0x1AF9DB95EAD96, 0x7234101BE4CB0, 0x2EB489044C3EC, 0x08F92483CE320, 0x3F37FF1CF4115, 0x71FED689AD3E4, 0x2E7B9ED18D069, 0x48AD21784646A, 0x641ED0CA4E7DD, 0x165EA78FF0B72, 0x414BB3A4225C4, 0x000518CF0841B },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x096727D2E7B2E, 0x3AE472DA01864, 0x740C591559D44, 0x517334E96BF75, 0x2F7CFE4C35545, 0x3103554DFC420, 0x00B064EF56D1B, 0x6F39605B9B6F0, 0x288A83BBF733E, 0x56701D84D250B, 0x01FDF330076B6, 0x1918BF51AC54E, 0x3EEC9CE467127, 0x15DE9BDCEAB31, 0x0003723E78BDA },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x44187918B7830, 0x2F11897C33F46, 0x4688A1D861A71, 0x5B59552E415FE, 0x314BA9EC4C7EE, 0x1D68231D02914, 0x5AA38FB04A9AD, 0x583FF370EC04B, 0x1F7BB50594EA7, 0x1721D1CBB24C8, 0x24ED0A5BD2B6A, 0x52E24EE97679A, 0x68BAF3F787028, 0x0E60D561D4BE8, 0x0004FC461DFAE },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x38E2F552523CE, 0x535332C2A2BDC, 0x03D1FCA788336, 0x4C20C6105BF81, 0x5011FC271ABDB, 0x66D7A6304DA08, 0x7EC513E258DBD, 0x669AC3D5AA96A, 0x144EE4AD2B824, 0x6B9895F483A74, 0x6171445048FA8, 0x1AA4FF2C51A14, 0x4B946BA919763, 0x319271B6FFEAA, 0x0002E9A412B1B },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x6D68EE26BFA45, 0x6BC2BABEFF054, 0x55763A8D05909, 0x535385D9658C3, 0x21512F00BCA5E, 0x31D8858C060BF, 0x24111E327086F, 0x61EB649CECA22, 0x480E40532C26E, 0x14E9353A5730C, 0x18CCDDC5E2C06, 0x24BD25AB1C648, 0x2862723ABF965, 0x373A7089EEBFF, 0x0006098D7D112 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x48FBA81492C81, 0x229ADB78265E3, 0x0BCA5BC58B7E9, 0x0647BB4280BBA, 0x31E91F75A9E7F, 0x04A2B50DBF06D, 0x3AE8ADAF1E483, 0x509806970EF60, 0x05DC3D39C7066, 0x744F9253A9340, 0x78F2856505E90, 0x3549F398E5E22, 0x0B14CC75997EC, 0x7F50AE7F6A6D6, 0x00035EF0C4C41 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x7026063CC717B, 0x6D9B293424383, 0x2D0E6F35D266A, 0x3523D423406B5, 0x71186F1158A6D, 0x7272EA90093A1, 0x63F4532D2C965, 0x798E35FE0AD85, 0x48100E0756780, 0x74F7E58BBA041, 0x5C1901DE78564, 0x7F9F6AA7C3E67, 0x0403EEFB6CA5E, 0x1646A8DB62F3E, 0x00040C4A6BB42 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x2F5B6968DFB3B, 0x00C5BA7BFADDF, 0x0CA723D769B9D, 0x7B57BCFEBA46C, 0x03AAC0BFB6BCA, 0x533D942274446, 0x1E4E88BA8FAC7, 0x2DAB091B2A2CC, 0x58F63DAF5C2EC, 0x1D541F8BA1B46, 0x0A19A8727F09A, 0x28BB0B1236E97, 0x4D0FA5E039E79, 0x0A3337C637A60, 0x0003E8CC05239 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x36312FE4219A1, 0x5D8C7F5063D7F, 0x26F27E7735127, 0x092A2CB1A3883, 0x2E95A9BE4FB50, 0x07F3B29FC2DFC, 0x078CB56A71EF3, 0x4C6A4BA3173BD, 0x4FD5D5B98F592, 0x4CD062A03C93C, 0x097E0362E2F53, 0x7B53A07261098, 0x730CB63F76BB3, 0x237FC0AA62567, 0x0005922011B88 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x7F35BC936DCA5, 0x7AC934BA5343F, 0x4B20297C2BD60, 0x1FF990B256D31, 0x724537444C4FE, 0x3075C80774222, 0x2208FC13505E3, 0x2CE21944C356A, 0x52928995CD9F4, 0x008305B023D32, 0x29566451441B9, 0x4A1230983878E, 0x3738136C99F33, 0x1CEDD8D601538, 0x00044D47AACC8 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x10773A26915D3, 0x40653EE9F5BA3, 0x075433D025940, 0x7CD9BA2508523, 0x253C2F499FC9C, 0x7BF620E7F59CB, 0x363684B6FE3BA, 0x231771A2B8962, 0x336E7E7E20331, 0x068656B0FB160, 0x1A012D83B8661, 0x34D21E47651F3, 0x337F984A60663, 0x191CC91D746E3, 0x00057845B7F3B },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x324998408A7B5, 0x5231E2293F1FF, 0x494248B7AEE60, 0x10EADBE39F408, 0x2F3093E4E08C4, 0x5190BB80F81CD, 0x25E747D217610, 0x02B201D66B9EE, 0x53DD6DCAC0C9D, 0x70C1591CE8263, 0x28DC904D98BEA, 0x7C153BD621C70, 0x78D6BB5B95E10, 0x14153C92B73F0, 0x00031BFDEEE28 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x79BBC900FA42C, 0x60CEB8978A6DC, 0x0D226872EC319, 0x6FEF0F3811D26, 0x4FFAFA0EC91F9, 0x7DE252EC70217, 0x13CB04B469943, 0x2BF98AB0B8D82, 0x70AB18483EB28, 0x5EAF3C0239417, 0x43C2C7674393D, 0x262111DE44BC2, 0x10217F6F52DDB, 0x3937C07E26E0D, 0x00050F5F2B38A },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x21EFD0AD451DC, 0x09E3CEF07C3E4, 0x4303CDDD34907, 0x2A3DCC71DAD8E, 0x053B3BE6ADF9A, 0x3D65C1C28F721, 0x3ACCBEF83E2E8, 0x7E68B2D0D6709, 0x3320CC3202C25, 0x41D9990AB893E, 0x246BCF93C31F2, 0x4078B200F2E55, 0x7B41FBA716403, 0x0B28963350545, 0x0002BA37D7528 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x2A177768725FF, 0x21C9DF1F08250, 0x32F4B9FC588B5, 0x0238C9F685A37, 0x3BD21B4A06819, 0x3A507BAB32944, 0x32FD8ED96337B, 0x79D7942337A95, 0x353A20484F4D8, 0x05F994BD8AA29, 0x4BC1A42209DEC, 0x3E27FE164F9C2, 0x7A08704E029C8, 0x57233E1D042B0, 0x0004ABC503EF9 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x49401A3EBE6E5, 0x0461EDF0BE5B0, 0x55BD0DC7BCD32, 0x0098E31FA6109, 0x6F02BDCA6E091, 0x6104365CCF113, 0x597236B650600, 0x35BF0EBBA61DD, 0x2E7BFC47904F2, 0x3382F200BE41C, 0x660F46428A1E5, 0x17A4DB50C27A5, 0x402265C4B8208, 0x3C6D3F6FB9546, 0x0004988A3A41B },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x29AD31E05AE20, 0x0067471732C42, 0x7C73ECAD3A685, 0x20BD4132F032B, 0x0A39945661060, 0x18FB46402EA3D, 0x7C5BB0E3058CF, 0x68BC80E2256B8, 0x082FB9A033522, 0x5D9D4A84EDCF6, 0x50869247B2564, 0x4CE54EC90B7D3, 0x505E2D904AB7A, 0x6359F4BB47E82, 0x00050A34AE67E },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x7B511C6E679D2, 0x1800170331260, 0x53C12C8233957, 0x0B1B408C560AD, 0x144C4E6BF7A46, 0x7F086E381EF2A, 0x1B83A55032446, 0x2C678A2294947, 0x2C34A4070D770, 0x18AEC0AAB74EF, 0x198AD389DDB23, 0x55155BC394C41, 0x5191662279A57, 0x311200D91031A, 0x00038B5D53B84 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x7917119AA64A0, 0x681E724357CA1, 0x3C3E9C2203F04, 0x3627AAEC53B1C, 0x180B885785CFC, 0x4A8226D5F12BB, 0x7CB34F79CB2A0, 0x0CE3327D8F296, 0x0EBD631F9A276, 0x07B3F9BD392DE, 0x06237EFD5E83D, 0x543BC10D8E908, 0x07FEF03900235, 0x2296574F44892, 0x0004AED73DFFA },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x7A7836FC2178C, 0x2A3EBA9C91D2F, 0x42DFE8B793857, 0x505169C810198, 0x2B20AE63B1CF1, 0x395719B8CD2F7, 0x352C84310B46E, 0x61427CF4EED9E, 0x2D4B0DFA29BD7, 0x03D22319246E0, 0x75C24071B6988, 0x7FB35B1256BD4, 0x2EFD700B17EC5, 0x65164FC00DD89, 0x0002C8C5B25D6 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x70B04D87F66DD, 0x29B3C8E7A7543, 0x5816D3BDA5988, 0x4FC30B2FAFB4C, 0x177F8B23CC357, 0x2948568B34247, 0x15D4C27A4AAAE, 0x70E4159B769C0, 0x5FB9B9A8E55C1, 0x7FC7D915E2F7B, 0x6B46D1B20ABD7, 0x2EF0B5356B80A, 0x149A511420969, 0x698FAAFA26BD1, 0x0004E0A7DEE97 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x1EA6C08745F67, 0x5AEC2E59C5C37, 0x29789AD2CEA54, 0x12F0622AE6E94, 0x1388DB91178D9, 0x25AD7FCF0BE23, 0x5B5C1025B4471, 0x0A25CB32B5973, 0x3690BFEB5D8F5, 0x29602BB7D7C6E, 0x416B6D2B62D7B, 0x3CA33EA3A2D8C, 0x16BBD25AC5D69, 0x03CB444E98DF7, 0x000256194096F },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x2D4D47386FB4F, 0x0E8A5E4D9C52A, 0x0519F1E47AB54, 0x6AA1EAB4AE7A9, 0x7D88932DB78A9, 0x416690ED96BB3, 0x09B1CDEF50E3A, 0x76571B90EF845, 0x668B682546A5F, 0x13030D6FCB03C, 0x30FA940B12F0C, 0x2F221449A22CC, 0x2730CE1AAC09F, 0x580EADC69F26C, 0x000460EFB16D0 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x397E033E00FBF, 0x5F4343721A141, 0x5AF3BA0DBE1F0, 0x2F58026C81837, 0x6C7585D6A7E71, 0x0D683E84697DB, 0x399C82D48D5AB, 0x37326BD8C6F06, 0x0C07B52FEB4EF, 0x47B1A6283C65B, 0x55E10B61333DF, 0x36314653CE3B0, 0x7A27966DA0865, 0x18F85D62307CA, 0x000425577E07A },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x0D93568B09EAC, 0x287DF26CCB04C, 0x242BC3AE5A7BB, 0x2DC58668B2E23, 0x440E1817D7116, 0x5E74531B94EEC, 0x160FFDAD6A511, 0x1683013D30BED, 0x423FF36C06EE9, 0x0CBBBA0FCABCB, 0x12162D9E65238, 0x097C3243F8DE1, 0x39EC096C99D90, 0x52891FA6F2B7C, 0x00053D8A1638F },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x1CC0AB2FF866A, 0x69B579BC9B30E, 0x00CD39C91BDA7, 0x18B73B85811AA, 0x563282E34A842, 0x4A72554F589CC, 0x736A398388A7F, 0x364067C46E634, 0x5D8DB0B796AC8, 0x4DC7E13962858, 0x48404BA0E673C, 0x387E7C04B6579, 0x2F94096F4005C, 0x3B851F2231DF2, 0x0003BFA540C69 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x0E16C83B4C927, 0x577895359CF82, 0x59C130C22FC26, 0x151840423CE65, 0x5B8F9673A5267, 0x077CDA5022FD8, 0x2038F1E4AE0F7, 0x6AC1E77103801, 0x628A00CFAE4CC, 0x4977690AD0FB8, 0x09482263792AB, 0x76BED4A5F351B, 0x0191F8561440D, 0x537D894B8341C, 0x0004B8173CC35 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x5EA7C7A171CF1, 0x4ED5789C948B3, 0x0C9E5B373A020, 0x73257E6FB611F, 0x087910ABF4E8D, 0x26DB29BDDA7BD, 0x4F056C6F67768, 0x33FC9AD022FA5, 0x2D00339A1CE5F, 0x2C27FBAFBF26F, 0x7FC3C2FEC9D73, 0x4E79FFEA18795, 0x38D897BDF2518, 0x5D7CB46EEFDD9, 0x00031E810E40B },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x56AC92D44708B, 0x44D271630A3D6, 0x2DD50EB99B5CB, 0x196F02E4CD451, 0x4F56BB6D0AD4A, 0x7AF60F25C77D5, 0x11D3B1E5123BA, 0x576BB9090F496, 0x2CE355358CFDF, 0x165575CC2B193, 0x791935B6E89E0, 0x029ABB9888AD9, 0x61BA7BCC659B8, 0x19ACE2DF297E6, 0x0004A66FF5ADB },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x7FD31A7EBC367, 0x2298D373A4924, 0x6A8A4E75CD179, 0x752385C42FB1E, 0x7DE733F69A28A, 0x20A753DDCFDF1, 0x21AB3627FA489, 0x7AB98E5D71496, 0x49D83F0744C44, 0x3E6362F410011, 0x7E8BD05775493, 0x10984ACD7EA83, 0x4173A40A0B387, 0x0F3356B418668, 0x00041D9F85B97 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x7A0015985F1E7, 0x14E624F3229BE, 0x7230400737D85, 0x66F359EEC8C47, 0x6F5A39E1B53B7, 0x008FED5E6B8D5, 0x009E9BDDABC50, 0x2A1377D1D1BF5, 0x5CF6D712F715D, 0x2943CACA5425B, 0x711810BA559EC, 0x5C7ADD490CA1E, 0x2F74867CF58A0, 0x792667238FFB1, 0x00046DA814FEA },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x4CB885409DFF7, 0x6DAA73ACEB3DA, 0x5FF1258912EAF, 0x30950E9B69C2D, 0x28E144016FCEA, 0x60D2B714119B0, 0x3F81E4CE4B32A, 0x7A3465549D97D, 0x7D7617BDABA92, 0x249A2A7AEF0A2, 0x58DD6DAAB4127, 0x01190AACD8805, 0x6DB8D66C82256, 0x0BBE559D3FB0C, 0x0003615844BA2 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x6B8E79FCA097B, 0x2AE7A2456376D, 0x267A19C221BFB, 0x571438F429FAE, 0x0BD34F09E36D7, 0x67E880414B0E5, 0x553E1D047E39F, 0x074DAA7791168, 0x030AF0413F627, 0x23286A66083EB, 0x1EB6F90F3EF53, 0x08258001ECB06, 0x316157F3208AB, 0x66FDC5809B18D, 0x00050D2E9E9A0 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x357212BB5A245, 0x76EA7C7429A1E, 0x0F5DFF55E8199, 0x1B52963619948, 0x73F2F08F335F2, 0x76ED9FE950D7E, 0x7026FAC39692F, 0x2938716D48853, 0x5C47DC7BD9BA5, 0x3788B7B797F20, 0x44FBF3FA6A40D, 0x3AACAA7A025B4, 0x58C7DCB0BA747, 0x37F9479EF3761, 0x000321116984B },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x5120F0DB0979D, 0x179A95342E6FA, 0x39FD6B085802C, 0x57A49475660A5, 0x194A4DA56080C, 0x452D06D8FBB90, 0x0E444A45B6D9F, 0x21C5EA52C0310, 0x65C7000F3C213, 0x3BA02270FFD0B, 0x05BB776C78018, 0x110B43A7F08B2, 0x27BE0D9F16C72, 0x0D1191FD79736, 0x000545AAA52E8 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x33C6193D012EB, 0x12ECCB5FCAD6D, 0x289C5A9ABA758, 0x65A960A303442, 0x6B36DCB8A0743, 0x600424440DE25, 0x27781EB5CD35D, 0x160BA32E452BC, 0x2FBC594578609, 0x37B0E56F7B174, 0x6A6CC40CFFCB8, 0x73382A67316C7, 0x5DCD2CBF26B75, 0x37C26F4235F23, 0x0001EF1A31B1C },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x32AC86D47E448, 0x4432C302685C5, 0x0C46C0A6B2B1F, 0x4B3EF04A16A26, 0x70B0303913965, 0x092742099F545, 0x3A4E4FF867515, 0x16CC68925EA32, 0x3C05D2E59A7D4, 0x6DD80A16DD95E, 0x09AD25B589C43, 0x74729B8065438, 0x36E4019A62DFA, 0x4CDCE43E4D511, 0x00052850E522C },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x64975B0A96EAC, 0x43A374EFCBE9D, 0x3B5B0C4763E79, 0x064546E3800D4, 0x723E423848DC4, 0x0F4697BCF930B, 0x52F49D718F459, 0x7633022263C66, 0x3E422E8C2FCCA, 0x0349D671765FB, 0x543A40F6D0D00, 0x2EF84A2B8B26F, 0x46E1DF4443F5B, 0x14A586BD9A31E, 0x00042591F0107 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x76CFBF61173C4, 0x64622D0178719, 0x4F8502E7836E0, 0x01562C778F1B2, 0x1944E04E3109D, 0x5323EF721FA7D, 0x7C0582C806877, 0x3326C91534240, 0x134013FDD21F4, 0x56E17FA881142, 0x1D32F52AF394C, 0x3ED76F23FD125, 0x4233581E60D24, 0x7B7657E806D49, 0x0004B4FB9F31A },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x0FA44784CD832, 0x3981EB27FD209, 0x76699EC15C454, 0x1C7D7D7E32339, 0x4C9D149170D79, 0x02F20B952A25E, 0x34541DA3BF267, 0x2AC769AA9F42A, 0x76160C5AD222B, 0x7548E83DD6354, 0x280E627DEFF5C, 0x20A9917181EC3, 0x6E4270C35D5FA, 0x3A67C63A193E9, 0x00032D861B21A },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x14ABD0108670A, 0x396A9AD2DB552, 0x05D8C28994E70, 0x69D38BAD66D3B, 0x5BF1144391A1F, 0x2619065E72A21, 0x11BF3618D4B52, 0x243BA5FB92B92, 0x4D1164B09172D, 0x33EB2D84E7CAA, 0x4FA655599E2D4, 0x733F2BFE94102, 0x3B5337A41711E, 0x2554B0D7CC597, 0x0004E2DC3C57D },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x28F67F66BA526, 0x650F8730EFE5F, 0x5E93B225649FD, 0x488E18CF47056, 0x26CDE532899A4, 0x673CE4A078286, 0x753E6EA5EEB78, 0x64151D66F33A9, 0x1DBCC58765C77, 0x4B45B0799B14B, 0x63E5DCA441946, 0x5B1555BC7FAB2, 0x7A5B48BC1F5D4, 0x5A726B7E65DDE, 0x0002CF599FD8C },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x2F3075A9BFDFF, 0x4343DF2C3B476, 0x746E9F19BC030, 0x03C9810BC9B67, 0x03C35D3BADECF, 0x0A8A4310C9974, 0x08085B9734AD4, 0x43806D8CA7F61, 0x02DBDC3E97AEE, 0x75800EA382707, 0x1A0B67EDFBDE6, 0x62831DC8F0661, 0x67D749A0CC781, 0x2F27579EE92ED, 0x0005DA60B0A25 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x438532F1AED05, 0x7DB735C7792DD, 0x045F866892D86, 0x6606DB11346EE, 0x74F34522B5098, 0x5B32957633C45, 0x31789F01C20A9, 0x28A1A865CB52E, 0x5466EA8881DBC, 0x4C24FA11C2FA2, 0x096C2F0F307D1, 0x65E84F773B091, 0x0CABBA4005CBE, 0x2D236D6BDBC8D, 0x00036288E7709 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x6AF11500CA5F9, 0x715BA008CBFD2, 0x46B26C9BA1CE6, 0x33FC0A7AE18A1, 0x2937C94C2FE5A, 0x68AE952F02C74, 0x3E5CE94E60885, 0x097E8BAB1361D, 0x0D69A33DC1664, 0x032111539409B, 0x7DCA07B1A3118, 0x1E74BF7174DE0, 0x341BD592F3EFB, 0x7861C4093B445, 0x000552AA45C17 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x66902A7177FAB, 0x4F9F2E8C62A46, 0x4490270662986, 0x2F4AA94E4E8D8, 0x5342D90D78C16, 0x723F06DB8BB15, 0x66DA39138796E, 0x77DD06A223FA2, 0x55AD21356E1C9, 0x324576FF0A332, 0x3744FC8D72746, 0x1B6CA361F4E5A, 0x3B978E87208D8, 0x45FDB1E8F28DD, 0x000275D1E4E42 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x6B37A7B7DA89E, 0x056BE0B82EBEB, 0x0B234F90729B4, 0x38EADC62A2C7C, 0x6210976FA45BE, 0x2A7DB2956413E, 0x6882D844C1367, 0x77C4D38C67439, 0x4F224AD85C51F, 0x4C69A6F9A511B, 0x760E00ED7AEFA, 0x48B204A09D686, 0x05C16A5B36C08, 0x1FA9A76624898, 0x00069CBF7CA06 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x16A72E0E20030, 0x69557D3929F9B, 0x24BBCF6D41974, 0x09D1E8E65B63F, 0x57FECBB5A4483, 0x3F4A9D60343A1, 0x6C623BF8BB77F, 0x4780BC4F43584, 0x79DECE7851663, 0x35701F23B74F1, 0x02925BAC6DEB7, 0x5FDFE5EDCA669, 0x69064E2D700A9, 0x2F048F6F676F3, 0x0003A897A2A42 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x55C946732D482, 0x121A69963DFB1, 0x7533945339068, 0x58DBEC109CD8F, 0x237523E950420, 0x3D08223289168, 0x7B1AA19D52470, 0x4C781CB79C3D6, 0x2BC4B4D48E3A5, 0x5609AF97427FB, 0x1DC9CC4777102, 0x7E7BD686FB5A5, 0x2BE39AFB5A339, 0x5A9C4F4A97AA4, 0x00044A86553D0 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x4C608141BA87C, 0x62C6280F41C75, 0x4C44812CDF36D, 0x663E5B0CFBC6F, 0x4AA6E67ADAD9F, 0x1EBE9F27CA476, 0x47AC0776B6930, 0x1687B5D05888A, 0x604F019AE8099, 0x7E6B64F30880F, 0x1A0BE9477E95A, 0x59D40B108B2C7, 0x34F8899D8F5D6, 0x704B79A9F43D9, 0x000446C661356 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x1A803FA8E0659, 0x1277434B4BEE5, 0x4D63CF03E1596, 0x63A597FF51266, 0x4979B0EFB8B79, 0x750CF669F93D3, 0x05157A1C2A1B5, 0x5640F3A760F2A, 0x514D820C5E3C3, 0x3709FB8975313, 0x197DDB843CA61, 0x7CA253D2B0446, 0x29FA4F2144253, 0x3C41546BB1914, 0x0004F74B41EA2 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x1C79BA5D14DA7, 0x1E125339E52C6, 0x5E51983E91EB8, 0x7978D5C02E239, 0x30FEB68C58FFE, 0x315453A1471E8, 0x7B55D00EA82EA, 0x7139408696A9B, 0x62D5E465194AF, 0x1465BA3B051DF, 0x7DC91242C4BB6, 0x1E46942861ABA, 0x6D49D15436B30, 0x20FB1D5FF8E0C, 0x00043391FDCB8 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x3C39E7662F471, 0x5041B717A1001, 0x1420CE262E57F, 0x7E366C7CC2689, 0x0419785904187, 0x4DEAACF99A978, 0x6C55574DDB355, 0x2D27AD9AD194F, 0x3B73AD93ADF11, 0x49F636B0116DB, 0x4B6048C15B754, 0x37DC4FA9FD17D, 0x04CF7032C58BA, 0x541EBFE966291, 0x0005AD918393D },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x5493AE32E13B3, 0x15BA35CEFBDB2, 0x6EB28BC08F037, 0x16D151472D0F0, 0x327F8FF4D64E0, 0x27F3AC8552602, 0x53B273BDD93FF, 0x1FF092E4794C6, 0x5ADEC6B26D4E0, 0x3855068FDC0CC, 0x1FB31EEEC9C16, 0x090FC9D2489E3, 0x2B429ADC18B50, 0x0779F0BD019FB, 0x000355C5A833B },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x44431FF79CCAE, 0x20515B153AF18, 0x504841661D307, 0x0380FB11B0D6A, 0x4E87F2CCFF908, 0x201CA37020466, 0x7A5E7524C7013, 0x333FA949F1044, 0x345C548B2AC15, 0x3134079B44835, 0x143012834566C, 0x694A8B3326D09, 0x32D865E7FA193, 0x734153619680E, 0x000695F27726A },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x7B2A7507949BA, 0x6789CA5CD0B7A, 0x2968996431D90, 0x654C29D8C12E8, 0x0D5843C2AA442, 0x07F3FC872399A, 0x23A90883E07FF, 0x179F58761D77C, 0x31C31ADA8FB4B, 0x5E9CC86044DDD, 0x43EC97E7CC700, 0x3302C56DC3E60, 0x2BA2EEB467114, 0x4AC2A8DF48E44, 0x000323154E0A5 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x2421295D318C2, 0x08DC4E89FCCC8, 0x245AE5D0042AA, 0x75A4DFEFE015D, 0x02E79E2B75DCB, 0x0EBD8AC88E1DA, 0x5107775371ECC, 0x22A102E32B484, 0x0E0D01840C89D, 0x124A7598D4E9A, 0x55943E1ED4C4A, 0x703A833A76583, 0x3E1A210B2598F, 0x21CB7A1D96487, 0x0005323E27D57 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x083C7DDF6EB08, 0x4E635D04F43E2, 0x025B3DCA4C10F, 0x0625C9911CF05, 0x2606BB45E90B8, 0x28237BBA420AF, 0x6782A12AF4CD0, 0x3AAE446D467E8, 0x7BF18E9A7C78A, 0x668326419B918, 0x29286CEB7E698, 0x7FC0EAABD155C, 0x1F0F8CBAFF729, 0x45112E5D79E0B, 0x00046519D386D },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x4527EAC0A26F2, 0x31398DBFDD1AE, 0x4D576B9B76A02, 0x07CEE370E0ECF, 0x0A4B7BE4BDF2C, 0x6F9F3C531051A, 0x756C5D173A754, 0x3FF8199F21733, 0x0ADF8F1D1DFF4, 0x394057BC417B0, 0x3220E5B9460EB, 0x4E26C62797B15, 0x65F7DDB9ED678, 0x696FBE883F7D5, 0x00041EE6C35BE },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x289F6AAD6503E, 0x38F6AF8B1AD2F, 0x4E5B45EAD1657, 0x4324D11753260, 0x50AD944C63D03, 0x6CBEDF952DE5D, 0x14BF8D7D9E468, 0x7369ACD605DBF, 0x1024E41B5F9C0, 0x444225C0BC30D, 0x592F06B12B6EC, 0x63A3C989D0339, 0x1F72C88718D54, 0x5640E7E91A477, 0x000320F0D6194 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x577693D889222, 0x717110A49163D, 0x40610AE09149F, 0x3950F16691576, 0x06F512B7648FF, 0x343C138319498, 0x76D95D6D4BD37, 0x6B66300D062F1, 0x24032C9080F89, 0x165C165E6131D, 0x4E56B29996CD7, 0x02A551D9FA8D5, 0x34664BEB1FFD9, 0x33F9D71193366, 0x000513B2CF866 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x2B3D414E355D2, 0x1E362E9E9A33C, 0x481C3F164E6EE, 0x642A836F88AC1, 0x2231D1D177084, 0x12FA50543CD50, 0x7F4DAC134D5D0, 0x19D1912A24ACC, 0x46803C84B6A7B, 0x483F91C5F1829, 0x37D4B448A0191, 0x6E5F281C8DEA3, 0x0A4DBF32A5FE0, 0x70C5AFF27EE6C, 0x000477B5E312B },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x625DBE15760E6, 0x03BD1F1D81271, 0x409BD0DA1BDF1, 0x4E9AEB9DCFBFA, 0x169CA79D52AB0, 0x732764A266E74, 0x3B4F540E03314, 0x3CAEA761A04E6, 0x3759BF96095C8, 0x6C9AFF93327BE, 0x54491766F54A9, 0x35907C655183D, 0x283C8A8C6F67D, 0x06E2BBA1F7EF3, 0x0004579800D56 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x4F5FE92DC82B8, 0x73B35F6EB696F, 0x5B4E22CFD75BC, 0x559C73FBAB4AB, 0x67FD7989C0D9A, 0x02235C69DE12E, 0x0689A6AFB7464, 0x0383CD0063FBD, 0x48033D1907473, 0x752DD0588E957, 0x4F248C18B4FEB, 0x5217EBEF9D180, 0x08AA6119BDBB8, 0x273BEE89C9110, 0x00040975F6460 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x69A4C808BCD88, 0x7C4B589297734, 0x6739850F8CEE8, 0x406EB992685CB, 0x707E2ADB557AD, 0x299BCC8255FC1, 0x1B154E6B1E69F, 0x0B9BADB322A9F, 0x423C485AA644E, 0x3041ABA9EB706, 0x7543AC357F145, 0x11D2C3351EE3A, 0x265DA8BF1D634, 0x3DA949A9A789E, 0x0004B90DAF16A },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x044559AD4D23C, 0x3F132A2C80BD1, 0x266A35DB93AD8, 0x4B25FE5CFBCB6, 0x2EFDFFAEE838F, 0x538A5F01D2FFE, 0x7605C39D3C8D5, 0x4C30C58C9B629, 0x5F344648C40FB, 0x5291D5EDAB35E, 0x05372A0B54CD0, 0x7A915E41414AD, 0x5D0ACC9DFC798, 0x0323F1C4A2AE3, 0x0002E56540016 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x051D16C3234ED, 0x67CEE5EBF31B4, 0x7D2ABD8694C11, 0x4F3566376E0DD, 0x1CAD805106AAA, 0x16EBCFF319C7C, 0x04A6529F2EA38, 0x69FA6F4E5CD4A, 0x3F6DAF40222C8, 0x2890B1C16E35F, 0x0F8FDFD97BFE3, 0x14F72DFDE9C3F, 0x32C3C47B39CAD, 0x3A77AEF65458D, 0x0003929D8E5F7 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x2FBA256553029, 0x1C402305E5935, 0x5A2872A349365, 0x0823385C2E61F, 0x0B2A260718C50, 0x0DBBA804B651D, 0x750849DB498FF, 0x2166262D9E71C, 0x61246A6EB7E35, 0x100A6A47D7CCF, 0x22BC058329A1A, 0x2AFB0E2452904, 0x44ACC38623312, 0x04073BB3FBA82, 0x0003823947CDD },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x0544E5B8C55C6, 0x4FDC2D90F47B9, 0x0FB4D733E517D, 0x3F9271AFA7744, 0x70E2B2515080C, 0x4B9ABE47C0FE8, 0x3A1F4E1E2B7D6, 0x5E9A82D9D76E1, 0x1618CB64D2DED, 0x6B6FD41FDC47B, 0x412CB3DC760B2, 0x7A2B2B878EBEB, 0x1D8DA93467DAF, 0x5A9DA95EA5A7C, 0x000536FF18CA5 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x78DE7F7650400, 0x26548A72D3CF9, 0x00BDB45E8965F, 0x7F698D0BEF75A, 0x162D7FA3FB782, 0x2AC2095960493, 0x2880AB2ABD7E3, 0x166724316217D, 0x6C91C2078A765, 0x5106DE98068E1, 0x5B90E636BDC24, 0x4EBB9E14805A2, 0x7DFD65AAB51E2, 0x29B0DA62BF59D, 0x0003FFC906F56 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x1A2D93052D21D, 0x772161D9580B7, 0x3D26A3374AAB1, 0x4BF8C77806151, 0x3138800A0387E, 0x6A5EC456E4CC0, 0x5D6EF0085F94A, 0x5625ED1552EF2, 0x00CC50071BB6C, 0x5CB4B35B8B98F, 0x259024D1B5970, 0x63551982E51DA, 0x52E003CED86E9, 0x661D17545E5A6, 0x0005D719781E9 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x283EF99F866EF, 0x370A3D1AB972B, 0x12C221122527A, 0x5D05908DE93CA, 0x543BAC4F69685, 0x2D64F6682C933, 0x3C92C4C5D4D6A, 0x4D21256D5FD99, 0x2FBBA6B2FA3CB, 0x47A46E39DAADD, 0x5A4DF5A53F10A, 0x27D8DD450E684, 0x085AAA45A4568, 0x1EF0530FC35BC, 0x0003E3AB585A8 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x7C7BC4984414F, 0x38C5FDB9F10FE, 0x5F3304B86C68B, 0x49DAAF4BBA192, 0x5EC1329C9FA3E, 0x38FD18C8517FC, 0x3B19776E1C12D, 0x0BE02502BA9D7, 0x4C39C99379E74, 0x100C079691B80, 0x026C8CD22990B, 0x6C526C60E1D35, 0x7AF5EA3F0F97A, 0x59E3ADAFF9749, 0x0005E80C52FB9 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x0D638CA3AADCF, 0x7D55215D8F9D5, 0x4C70F47767BE2, 0x31C23E4D41A5B, 0x364418A9A567B, 0x5F7CDCB359D5A, 0x192DC35078BBD, 0x308E6B9C831FF, 0x4481859C36FF7, 0x79E737987D313, 0x14C1F1F2A3F6A, 0x03A8A5865E41A, 0x4C43E941DBC0D, 0x793AC85CDC033, 0x000372226F7F3 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x486DDE874F927, 0x374B658C9F50A, 0x05C312F83C8A4, 0x00596200FD03B, 0x69B76E5BAD99A, 0x1FB812D0652F7, 0x7A3886792DC81, 0x3CA1387EB87C8, 0x142107E52156B, 0x00E80C8797667, 0x1A848D6DBEFF2, 0x78FE28D2FFB5E, 0x2ED60B1F20EF9, 0x21478B0C6B83C, 0x0005B61AB72BC },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x42034980DE2A7, 0x33B9D8B473D43, 0x5C6B737C84D8D, 0x3AB3F11D0029C, 0x3DC4C4A86C7F7, 0x4A6095BB6B775, 0x502379397FD41, 0x206020CBC9624, 0x1D865F283FBF9, 0x710E709A2D576, 0x5254B56B2900E, 0x350EEB469BF0D, 0x527C4B4E071E5, 0x7929665EC41DD, 0x00031C1D5C4DE },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x7EE709698A748, 0x60BDA623C7499, 0x701E254CE43AC, 0x45889EDEB116C, 0x0DBA3ACBAAB99, 0x63790E5859803, 0x375026153E71E, 0x01949D02D9D1F, 0x0084DA4C3A25C, 0x1C46663BC8370, 0x76F535C901B5D, 0x70B37CD791F85, 0x206E13609EE42, 0x7D4C7C324A4FA, 0x0004EDE042F59 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x7CAEC2D5FDE5E, 0x0A3A5635666AA, 0x6295A31A1C11C, 0x31916369ED8C8, 0x127AA7C811EB5, 0x0080EF111E13E, 0x5AF5958A9CE40, 0x1CEE7229D6879, 0x5835B91D1239C, 0x434377A58ADD4, 0x19D771782F447, 0x1F18787AEE773, 0x4041D41E9BFF2, 0x5E5474BB5F26B, 0x000354BEC3963 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x6BE9D766A8EE9, 0x755D642CEEBDD, 0x2265018DC8D30, 0x0BFDC44923384, 0x1337DCEEDE7CB, 0x511949451494B, 0x4ADBFB0CBC4E7, 0x371AAEAECF72C, 0x582C3D5A7344D, 0x6F51182812D90, 0x785DC7832A9F3, 0x3840F89283E8D, 0x40290B7CA2D64, 0x52BCFEE92338B, 0x0005529946010 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x0788040E7AB0D, 0x5DF1BDBF84899, 0x56797775BB230, 0x753757C7BFDD0, 0x1BC30C763601E, 0x04A359382F702, 0x347AB792EEE09, 0x62390E38211C4, 0x58339C4BA7725, 0x3CF4966E1A425, 0x4213AEF2EE1F8, 0x6236DE102F737, 0x03E57E91945DE, 0x073D7FFB7BE5C, 0x0004034407A19 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x636A9C1C9E984, 0x4CE66CC9854AC, 0x3C3BA82B2B60F, 0x3961BCE1012AC, 0x1BDE46C690FB7, 0x0669DA879C959, 0x17F09A78284A6, 0x41CBCAB85099A, 0x12AB5C6151978, 0x26191F63CB48A, 0x77C497B9B53F6, 0x78FEF9E4578C7, 0x7CAD6718DEC8C, 0x6889BDCD4FCEC, 0x0006133F8DD5E },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x65FBFEB71F4B4, 0x083CC8C6AB55E, 0x1BB9A3D185DF1, 0x37B4F19C4067E, 0x55C91353165DA, 0x0D189CD480C35, 0x40C35CED5D4E4, 0x66330F375EC2F, 0x151603E485467, 0x125AFF1212B48, 0x464696A1383B2, 0x08E50BB81773F, 0x5186A327F7C77, 0x7ABD5E75D0C43, 0x000426B3F5D20 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x2588BA66AFD20, 0x4CC77CAC8D4CD, 0x0C53987E873E5, 0x0222B8F55D6B1, 0x3E3F3EF4C59EF, 0x759A39A896279, 0x4BBA917EB2B79, 0x4BEFA1CF5FB85, 0x27C961B063576, 0x624943B8D8544, 0x21AB096BBFA1A, 0x5291FA6034041, 0x02266E95B7570, 0x4F2C4952B05F1, 0x00069598B35BA },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x5FEC7404AEC64, 0x6C9D47AD1D6A4, 0x70E21A39792EF, 0x12AEB140FA43B, 0x456F4AFA42272, 0x1EB79138E5598, 0x598412B920BC3, 0x75028CC77EDE4, 0x2740B9C82BE8A, 0x4E034B25F4064, 0x1141564B99B6A, 0x47C440678CDD3, 0x1DF97206D62AE, 0x1C4BBA7B87849, 0x0003D88AB3E04 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x30948DB9A2F02, 0x471960CBD2B56, 0x47CCCE0F17681, 0x37AEEF9C4EDDE, 0x02EB8EC494290, 0x1D7EB3F9D23FD, 0x75CF21567615B, 0x6950C7A5A6E30, 0x694E3F30E9BDD, 0x179C22E2F1634, 0x3E7B9B87346FD, 0x799A0985247DB, 0x73CEAB0246542, 0x6ACA4101A0547, 0x0004DF0164163 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x10E760E1A0762, 0x792B8A4596828, 0x49A8143114151, 0x47CB07846937D, 0x261064CC6F987, 0x7A4AD1A003EBC, 0x5BA6A9D0D56A3, 0x2041CE29E645C, 0x5CA9D6BB674B2, 0x3D56BB545871C, 0x7823B7FEC17DE, 0x1976A4790293D, 0x74E28E647F35B, 0x25D19D4FF42C0, 0x00026A112AA02 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x6D57932B513DC, 0x4ED20C7869B9A, 0x1A3399A73AC0A, 0x2AC3056B7AD57, 0x78AFEBC5C35B0, 0x7FE58DC9651B5, 0x411E76AB6BD81, 0x32F3B17B077C7, 0x4ABE1FB140829, 0x247EC0AAFFBA2, 0x35241981A70B1, 0x2A354936B20A6, 0x4BF7EDB8167DD, 0x1AF9B7A70BDAF, 0x00054559DA7FF },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x0D3722C2DA858, 0x36F64A6B143DB, 0x66C6014354BA6, 0x13FE3B96067D4, 0x567301A02E9A5, 0x62339D8E90326, 0x7C5825A8D9003, 0x11BB48A745D4E, 0x46664F529A9D8, 0x38E47F8DC3A5E, 0x0238AFFC12579, 0x1BAD60CA0018A, 0x210A93EB444C1, 0x042D461F137CE, 0x0002AB8ED9D39 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x7232C7F4D9A5D, 0x42FC269FE8EF2, 0x3AF0B42FC112F, 0x26B44E7BFF9DE, 0x37DCE916662D1, 0x35BF15FCC63CF, 0x1F15ED74539D6, 0x77E3042C9B37C, 0x10FDFF1EC2B5F, 0x388B6613E0E72, 0x143F2FD722E4F, 0x1246C6347A6BF, 0x766FF0DABD0E9, 0x26C029FBDFD46, 0x000489441371D },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x6BEC21EFC5247, 0x06FFCA0D8FFE4, 0x790337343F944, 0x0677B77FFFCC9, 0x6C92EBE764F3E, 0x77B44DD8F73ED, 0x2F75DB24B2FBB, 0x3A4DB77254A43, 0x3D84ECC76153E, 0x6A6CF125EE89D, 0x06BC58A43F9AE, 0x52E61B60C89C3, 0x7E1E4241DC72F, 0x2048557D15F57, 0x0003027FD91BB },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x1EA829F20E2A3, 0x0923D47A0B428, 0x37D57367B78A2, 0x23049B4B959AA, 0x330161CB429DD, 0x7357FE17FCFF7, 0x20D7F7F77D4CB, 0x6A9749D8E66C3, 0x1EB404272670C, 0x30CAEA8830866, 0x6FFA06336FC00, 0x294940496D626, 0x0B0007C7F96E5, 0x43D61D1C58150, 0x0004AE5C1CA8B },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x3343F7BD908C9, 0x6B9459077761C, 0x76DD820DC54D3, 0x24346BA6F5EB4, 0x6B2F432F3EA90, 0x3B1B722756F60, 0x41C4F15332816, 0x3C7447A55D6C8, 0x1EBA67B146676, 0x7D337D3022447, 0x7E435E0A375CC, 0x5F55B80EE0D19, 0x0DB3F0DF696F3, 0x40FD600B42D60, 0x0003BF6AF280A },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x5DA1C55C49F5E, 0x1B59BDCDE2F92, 0x536B07FFEFC3D, 0x144DCEDD15180, 0x1104A708151E1, 0x4ADAC668686FB, 0x19D1A98CD7778, 0x54360B1B53653, 0x2BE7AD4E23372, 0x79094CADFC7C7, 0x292B0D915C872, 0x54A8CC07DF504, 0x7865BA260CAB0, 0x32343377B0027, 0x00063A711EC77 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x68B54E88D4242, 0x6187D99DDDE45, 0x4E0A2120DA586, 0x3E9CCE8253D30, 0x383FDF8D100C8, 0x17B85F7D27FCA, 0x49BFF9D22AABB, 0x73E1D0488AAA6, 0x15F6045700C0A, 0x016211AE918E1, 0x10B553C2CB897, 0x1FB549FDA85C3, 0x6AF825D1F38C6, 0x23F2EA491EEFD, 0x000355EE2B8F1 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } },
+  { { 0x25DEECE51FB4F, 0x3016EB0838921, 0x2C388EA0E93D4, 0x2DF5DDE817753, 0x2188FB90BFA4B, 0x45CA1E439E04E, 0x3B4D33670E893, 0x4CFCE702004EF, 0x4DF090FB0465E, 0x4309687B34494, 0x22128D395FE74, 0x2B01BC042A30D, 0x37B9389C18AC5, 0x0EA99AB665401, 0x00060C014AC5C },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB },
+    { 0x6967BDD58FA4F, 0x3D56CF253455B, 0x435F84CAF03C6, 0x276668DF3FFF0, 0x22DCE1D962CF8, 0x5A4E2D6C207B7, 0x06A8F2BA2DE85, 0x44EDF653C94D4, 0x64171AEED733B, 0x13313516DA521, 0x6E84CF198DDA4, 0x24F0C68BDAEBD, 0x4B7A4AAC95D77, 0x47C2DB9148C7B, 0x000389D3ADAE7 },
+    { 0x7FFFFFFFFFFFE, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7FFFFFFFFFFFF, 0x7878A8EEAFFFF, 0x0EDC7D92D0A93, 0x6A566C684FDF3, 0x4C33EB75F43B6, 0x45CB25748084E, 0x75B8CD0AC56A0, 0x470384A427E5E, 0x00037F2EAA0FB } }
+};
+
+#endif
@@ -15,6 +15,7 @@
 #define BOB                     1 
 #define OALICE_BITS             372  
 #define OBOB_BITS               379
+#define OBOB_EXPON              239
 #define MASK_ALICE              0x0F 
 #define MASK_BOB                0x03 
 #define GFP_BYTES               94
@@ -8,6 +8,7 @@
  */
 
 #include "sidh.h"
+#include "traversal.h"
 
 static void init_basis(const uint64_t *gen, f2elm_t XP, f2elm_t XQ, f2elm_t XR)
 {
@@ -23,8 +24,9 @@ static void init_basis(const uint64_t *gen, f2elm_t XP, f2elm_t XQ, f2elm_t XR)
   }
 }
 
-// generation of Bob's secret key
-void random_mod_order_B(__m512i *random_digits, uint8_t *sk)
+// Bob's secret keys of 8 instances from the strings r (INSTANCES*SECRETKEY_B_BYTES bytes),
+// masked to [0, 2^Floor(Log(2, oB)) - 1] and written to sk and to the vectors digits
+void mod_order_B(__m512i *digits, uint8_t *sk, const uint8_t *r)
 {
   uint8_t s0[SK_B_VECTS*8] = { 0 }, s1[SK_B_VECTS*8] = { 0 };
   uint8_t s2[SK_B_VECTS*8] = { 0 }, s3[SK_B_VECTS*8] = { 0 };
@@ -34,20 +36,17 @@ void random_mod_order_B(__m512i *random_digits, uint8_t *sk)
   uint64_t *s64_2 = (uint64_t *)s2, *s64_3 = (uint64_t *)s3; 
   uint64_t *s64_4 = (uint64_t *)s4, *s64_5 = (uint64_t *)s5; 
   uint64_t *s64_6 = (uint64_t *)s6, *s64_7 = (uint64_t *)s7; 
-  int i;
+  uint8_t *s[INSTANCES] = { s0, s1, s2, s3, s4, s5, s6, s7 };
+  int i, k;
 
-  randombytes(s0, SECRETKEY_B_BYTES); s0[SECRETKEY_B_BYTES-1] &= MASK_BOB;
-  randombytes(s1, SECRETKEY_B_BYTES); s1[SECRETKEY_B_BYTES-1] &= MASK_BOB;
-  randombytes(s2, SECRETKEY_B_BYTES); s2[SECRETKEY_B_BYTES-1] &= MASK_BOB;
-  randombytes(s3, SECRETKEY_B_BYTES); s3[SECRETKEY_B_BYTES-1] &= MASK_BOB;
-  randombytes(s4, SECRETKEY_B_BYTES); s4[SECRETKEY_B_BYTES-1] &= MASK_BOB;
-  randombytes(s5, SECRETKEY_B_BYTES); s5[SECRETKEY_B_BYTES-1] &= MASK_BOB;
-  randombytes(s6, SECRETKEY_B_BYTES); s6[SECRETKEY_B_BYTES-1] &= MASK_BOB;
-  randombytes(s7, SECRETKEY_B_BYTES); s7[SECRETKEY_B_BYTES-1] &= MASK_BOB;
+  for (k = 0; k < INSTANCES; k++) {
+    for (i = 0; i < SECRETKEY_B_BYTES; i++) s[k][i] = r[k*SECRETKEY_B_BYTES+i];
+    s[k][SECRETKEY_B_BYTES-1] &= MASK_BOB;
+  }
 
   // form strings in vectors
   for (i = 0; i < SK_B_VECTS; i++) 
-    random_digits[i] = set_vector(s64_7[i], s64_6[i], s64_5[i], s64_4[i], s64_3[i], s64_2[i], s64_1[i], s64_0[i]);
+    digits[i] = set_vector(s64_7[i], s64_6[i], s64_5[i], s64_4[i], s64_3[i], s64_2[i], s64_1[i], s64_0[i]);
 
   for (i = 0; i < SECRETKEY_B_BYTES; i++) {
     sk[                        MSG_BYTES+i] = s0[i];
@@ -63,10 +62,10 @@ void random_mod_order_B(__m512i *random_digits, uint8_t *sk)
 
 void EphemeralKeyGeneration_A(const __m512i *PrivateKeyA, __m512i *PublicKeyA)
 {
-  point_proj_t R, phiP, phiQ, phiR, pts[MAX_INT_POINTS_ALICE];
-  f2elm_t XPA, XQA, XRA, coeff[3], A24plus, C24, A;
+  point_proj_t phiP, phiQ, phiR, pts[MAX_INT_POINTS_ALICE+1];
+  f2elm_t XPA, XQA, XRA, A24plus, C24;
   __m512i SecretKeyA[SK_A_VECTS];
-  int i, row, m, index = 0, pts_index[MAX_INT_POINTS_ALICE], npts = 0, ii = 0;
+  int i;
 
   // initialize basis points 
   init_basis(A_gen, XPA, XQA, XRA);
@@ -84,39 +83,14 @@ void EphemeralKeyGeneration_A(const __m512i *PrivateKeyA, __m512i *PublicKeyA)
 
   mp2_add(A24plus, A24plus, A24plus);   // A24plus = 2
   mp2_add(C24, A24plus, A24plus);       // C24 = 4
-  mp2_add(A, A24plus, C24);             // A = 6
   mp2_add(A24plus, C24, C24);           // A24plus = 8
 
-  // retrieve kernel point
+  // retrieve kernel point into pts[0]
   for (i = 0; i < SK_A_VECTS; i++) SecretKeyA[i] = PrivateKeyA[i];
-  LADDER3PT(XPA, XQA, XRA, SecretKeyA, ALICE, R, A);
+  LADDER3PT_fixed(XPA, XRA, SecretKeyA, ALICE, pts[0]);
   
   // traverse tree
-  index = 0;
-  for (row = 1; row < MAX_Alice; row++) {
-    while (index < MAX_Alice-row) {
-      pointcopy(pts[npts], R);
-      pts_index[npts++] = index;
-      m = strat_Alice[ii++];
-      xDBLe(R, R, A24plus, C24, 2*m);
-      index += m;
-    }
-    get_4_isog(R, A24plus, C24, coeff);
-
-    for (i = 0; i < npts; i++) eval_4_isog(pts[i], coeff);
-    eval_4_isog(phiP, coeff);
-    eval_4_isog(phiQ, coeff);
-    eval_4_isog(phiR, coeff);
-
-    pointcopy(R, pts[npts-1]);
-    index = pts_index[npts-1];
-    npts -= 1;
-  }
-
-  get_4_isog(R, A24plus, C24, coeff);
-  eval_4_isog(phiP, coeff);
-  eval_4_isog(phiQ, coeff);
-  eval_4_isog(phiR, coeff);
+  traverse_Alice_kg(pts, A24plus, C24, phiP, phiQ, phiR);
 
   inv_3_way(phiP->Z, phiQ->Z, phiR->Z);
   fp2mul_mont(phiP->X, phiP->X, phiP->Z);
@@ -139,10 +113,10 @@ void EphemeralKeyGeneration_A(const __m512i *PrivateKeyA, __m512i *PublicKeyA)
 
 void EphemeralKeyGeneration_B(const __m512i *PrivateKeyB, __m512i *PublicKeyB)
 {
-  point_proj_t R, phiP, phiQ, phiR, pts[MAX_INT_POINTS_BOB];
-  f2elm_t XPB, XQB, XRB, coeff[3], A24plus, A24minus, A;
+  point_proj_t phiP, phiQ, phiR, pts[MAX_INT_POINTS_BOB+1];
+  f2elm_t XPB, XQB, XRB, A24plus, A24minus;
   __m512i SecretKeyB[SK_B_VECTS];
-  int i, row, m, index = 0, pts_index[MAX_INT_POINTS_BOB], npts = 0, ii = 0;
+  int i;
 
   // initialize basis points 
   init_basis(B_gen, XPB, XQB, XRB);
@@ -160,39 +134,14 @@ void EphemeralKeyGeneration_B(const __m512i *PrivateKeyB, __m512i *PublicKeyB)
 
   mp2_add(A24plus, A24plus, A24plus);   // A24plus = 2
   mp2_add(A24minus, A24plus, A24plus);  // A24minus = 4
-  mp2_add(A, A24plus, A24minus);        // A = 6
   mp2_add(A24plus, A24minus, A24minus); // A24plus = 8
 
-  // retrieve kernel point
+  // retrieve kernel point into pts[0]
   for (i = 0; i < SK_B_VECTS; i++) SecretKeyB[i] = PrivateKeyB[i];
-  LADDER3PT(XPB, XQB, XRB, SecretKeyB, BOB, R, A);
+  LADDER3PT_fixed(XPB, XRB, SecretKeyB, BOB, pts[0]);
 
   // traverse tree
-  index = 0;
-  for (row = 1; row < MAX_Bob; row++) {
-    while (index < MAX_Bob-row) {
-      pointcopy(pts[npts], R);
-      pts_index[npts++] = index;
-      m = strat_Bob[ii++];
-      xTPLe(R, R, A24minus, A24plus, m);
-      index += m;
-    }
-    get_3_isog(R, A24minus, A24plus, coeff);
-
-    for (i = 0; i < npts; i++) eval_3_isog(pts[i], coeff);
-    eval_3_isog(phiP, coeff);
-    eval_3_isog(phiQ, coeff);
-    eval_3_isog(phiR, coeff);
-
-    pointcopy(R, pts[npts-1]);
-    index = pts_index[npts-1];
-    npts -= 1;
-  }
-
-  get_3_isog(R, A24minus, A24plus, coeff);
-  eval_3_isog(phiP, coeff);
-  eval_3_isog(phiQ, coeff);
-  eval_3_isog(phiR, coeff);
+  traverse_Bob_kg(pts, A24minus, A24plus, phiP, phiQ, phiR);
 
   inv_3_way(phiP->Z, phiQ->Z, phiR->Z);
   fp2mul_mont(phiP->X, phiP->X, phiP->Z);
@@ -213,61 +162,70 @@ void EphemeralKeyGeneration_B(const __m512i *PrivateKeyB, __m512i *PublicKeyB)
   }
 }
 
-void EphemeralSecretAgreement_A(const __m512i *PrivateKeyA, const __m512i *PublicKeyB, __m512i *SharedSecretA)
+// Bob's public key prepared for repeated secret agreements of Alice. 
+// table (may be NULL) provides storage for OALICE_BITS ladder steps.
+void PreparePublicKey_B(const __m512i *PublicKeyB, prepared_pkB_t ppk, f2elm_t (*table)[2])
 {
-  point_proj_t R, pts[MAX_INT_POINTS_ALICE];
-  f2elm_t coeff[3], PKB[3], jinv;
-  f2elm_t A24plus, C24, A;
-  __m512i SecretKeyA[SK_A_VECTS];
-  int i, row, m, index = 0, pts_index[MAX_INT_POINTS_ALICE], npts = 0, ii = 0;
+  int i;
 
   // initialize images of Bob's basis
   for (i = 0; i < NWORDS; i++) {
-    PKB[0][0][i] = PublicKeyB[i           ];
-    PKB[0][1][i] = PublicKeyB[i +   NWORDS];
-    PKB[1][0][i] = PublicKeyB[i + 2*NWORDS];
-    PKB[1][1][i] = PublicKeyB[i + 3*NWORDS];
-    PKB[2][0][i] = PublicKeyB[i + 4*NWORDS];
-    PKB[2][1][i] = PublicKeyB[i + 5*NWORDS];
+    ppk->PKB[0][0][i] = PublicKeyB[i           ];
+    ppk->PKB[0][1][i] = PublicKeyB[i +   NWORDS];
+    ppk->PKB[1][0][i] = PublicKeyB[i + 2*NWORDS];
+    ppk->PKB[1][1][i] = PublicKeyB[i + 3*NWORDS];
+    ppk->PKB[2][0][i] = PublicKeyB[i + 4*NWORDS];
+    ppk->PKB[2][1][i] = PublicKeyB[i + 5*NWORDS];
   }
-  to_fp2mont(PKB[0], PKB[0]);
-  to_fp2mont(PKB[1], PKB[1]);
-  to_fp2mont(PKB[2], PKB[2]);
-
+  to_fp2mont(ppk->PKB[0], ppk->PKB[0]);
+  to_fp2mont(ppk->PKB[1], ppk->PKB[1]);
+  to_fp2mont(ppk->PKB[2], ppk->PKB[2]);
+
+#if defined(PROJECTIVE_A)
+  // initialize constants: A24plus = A+2C, C24 = 4C, with (A:C) projective
+  get_A_proj(ppk->PKB[0], ppk->PKB[1], ppk->PKB[2], ppk->A, ppk->C24);
+  fp2add(ppk->C24, ppk->C24, ppk->C24);     // C24 = 2C
+  fp2add(ppk->A24plus, ppk->A, ppk->C24);   // A24plus = A+2C
+  fp2add(ppk->C24, ppk->C24, ppk->C24);     // C24 = 4C
+#else
   // initialize constants: A24plus = A+2C, C24 = 4C, where C=1
-  get_A(PKB[0], PKB[1], PKB[2], A);
+  get_A(ppk->PKB[0], ppk->PKB[1], ppk->PKB[2], ppk->A);
   for (i = 0; i < NWORDS; i++) {
-    A24plus[0][i] = A24plus[1][i] = C24[1][i] = VZERO;
-    C24[0][i] = VSET1(mont_R[i]);
+    ppk->A24plus[0][i] = ppk->A24plus[1][i] = ppk->C24[1][i] = VZERO;
+    ppk->C24[0][i] = VSET1(mont_R[i]);
   }
-  mp2_add(C24, C24, C24);               // C24 = 2 
-  mp2_add(A24plus, A, C24);             // A24plus = A + 2
-  mp2_add(C24, C24, C24);               // C24 = 4 
-  
-  // retrieve kernel point
+  mp2_add(ppk->C24, ppk->C24, ppk->C24);    // C24 = 2
+  mp2_add(ppk->A24plus, ppk->A, ppk->C24);  // A24plus = A + 2
+  mp2_add(ppk->C24, ppk->C24, ppk->C24);    // C24 = 4
+#endif
+
+  // ladder table of [2^i]Q on Bob's curve 
+  ppk->table = table;
+  if (table != NULL) ladder_table_vec(table, ppk->PKB[1], ppk->A24plus, ppk->C24, OALICE_BITS);
+}
+
+void EphemeralSecretAgreement_A_prepared(const __m512i *PrivateKeyA, const prepared_pkB_t ppk, __m512i *SharedSecretA)
+{
+  point_proj_t pts[MAX_INT_POINTS_ALICE+1];
+  f2elm_t jinv;
+  f2elm_t A24plus, C24;
+  __m512i SecretKeyA[SK_A_VECTS];
+  int i;
+
+  fp2copy(A24plus, ppk->A24plus);
+  fp2copy(C24, ppk->C24);
+
+  // retrieve kernel point into pts[0]
   for (i = 0; i < SK_A_VECTS; i++) SecretKeyA[i] = PrivateKeyA[i];
-  LADDER3PT(PKB[0], PKB[1], PKB[2], SecretKeyA, ALICE, R, A);  
+  if (ppk->table != NULL) LADDER3PT_table(ppk->PKB[0], ppk->PKB[2], SecretKeyA, ALICE, ppk->table, pts[0]);
+#if defined(PROJECTIVE_A)
+  else LADDER3PT_proj(ppk->PKB[0], ppk->PKB[1], ppk->PKB[2], SecretKeyA, ALICE, pts[0], A24plus, C24);
+#else
+  else LADDER3PT(ppk->PKB[0], ppk->PKB[1], ppk->PKB[2], SecretKeyA, ALICE, pts[0], ppk->A);
+#endif
 
   // traverse tree
-  index = 0;
-  for (row = 1; row < MAX_Alice; row++) {
-    while (index < MAX_Alice-row) {
-      pointcopy(pts[npts], R);
-      pts_index[npts++] = index;
-      m = strat_Alice[ii++];
-      xDBLe(R, R, A24plus, C24, 2*m);
-      index += m;
-    }
-    get_4_isog(R, A24plus, C24, coeff);
-
-    for (i = 0; i < npts; i++) eval_4_isog(pts[i], coeff);
-
-    pointcopy(R, pts[npts-1]);
-    index = pts_index[npts-1];
-    npts -= 1;
-  }
-
-  get_4_isog(R, A24plus, C24, coeff); 
+  traverse_Alice_ss(pts, A24plus, C24);
   mp2_add(A24plus, A24plus, A24plus);
   fp2sub(A24plus, A24plus, C24);
   fp2add(A24plus, A24plus, A24plus);
@@ -281,13 +239,21 @@ void EphemeralSecretAgreement_A(const __m512i *PrivateKeyA, const __m512i *Publi
   }
 }
 
+void EphemeralSecretAgreement_A(const __m512i *PrivateKeyA, const __m512i *PublicKeyB, __m512i *SharedSecretA)
+{
+  prepared_pkB_t ppk;
+
+  PreparePublicKey_B(PublicKeyB, ppk, NULL);
+  EphemeralSecretAgreement_A_prepared(PrivateKeyA, ppk, SharedSecretA);
+}
+
 void EphemeralSecretAgreement_B(const __m512i *PrivateKeyB, const __m512i *PublicKeyA, __m512i *SharedSecretB)
 {
-  point_proj_t R, pts[MAX_INT_POINTS_BOB];
-  f2elm_t coeff[3], PKB[3], jinv;
-  f2elm_t A24plus, A24minus, A;
+  point_proj_t pts[MAX_INT_POINTS_BOB+1];
+  f2elm_t PKB[3], jinv;
+  f2elm_t A24plus, A24minus, A, C24;
   __m512i SecretKeyB[SK_B_VECTS];
-  int i, row, m, index = 0, pts_index[MAX_INT_POINTS_ALICE], npts = 0, ii = 0;
+  int i;
 
   // initialize images of Alice's basis
   for (i = 0; i < NWORDS; i++) {
@@ -302,6 +268,14 @@ void EphemeralSecretAgreement_B(const __m512i *PrivateKeyB, const __m512i *Publi
   to_fp2mont(PKB[1], PKB[1]);
   to_fp2mont(PKB[2], PKB[2]);
 
+#if defined(PROJECTIVE_A)
+  // initialize constants: A24plus = A+2C, A24minus = A-2C, C24 = 4C, with (A:C) projective
+  get_A_proj(PKB[0], PKB[1], PKB[2], A, C24);
+  fp2add(C24, C24, C24);                // C24 = 2C
+  fp2add(A24plus, A, C24);              // A24plus = A+2C
+  fp2sub(A24minus, A, C24);             // A24minus = A-2C
+  fp2add(C24, C24, C24);                // C24 = 4C
+#else
   // initialize constants: A24plus = A+2C, A24minus = A-2C, where C=1
   get_A(PKB[0], PKB[1], PKB[2], A);
   for (i = 0; i < NWORDS; i++) {
@@ -311,31 +285,18 @@ void EphemeralSecretAgreement_B(const __m512i *PrivateKeyB, const __m512i *Publi
   mp2_add(A24minus, A24minus, A24minus);// A24minus = 2 
   mp2_add(A24plus, A, A24minus);        // A24plus = A + 2
   mp2_sub_p2(A24minus, A, A24minus);       // A24minus = A - 2 
+#endif
   
-  // retrieve kernel point
+  // retrieve kernel point into pts[0]
   for (i = 0; i < SK_B_VECTS; i++) SecretKeyB[i] = PrivateKeyB[i];
-  LADDER3PT(PKB[0], PKB[1], PKB[2], SecretKeyB, BOB, R, A);  
+#if defined(PROJECTIVE_A)
+  LADDER3PT_proj(PKB[0], PKB[1], PKB[2], SecretKeyB, BOB, pts[0], A24plus, C24);
+#else
+  LADDER3PT(PKB[0], PKB[1], PKB[2], SecretKeyB, BOB, pts[0], A);  
+#endif
 
   // traverse tree
-  index = 0;
-  for (row = 1; row < MAX_Bob; row++) {
-    while (index < MAX_Bob-row) {
-      pointcopy(pts[npts], R);
-      pts_index[npts++] = index;
-      m = strat_Bob[ii++];
-      xTPLe(R, R, A24minus, A24plus, m);
-      index += m;
-    }
-    get_3_isog(R, A24minus, A24plus, coeff);
-
-    for (i = 0; i < npts; i++) eval_3_isog(pts[i], coeff);
-
-    pointcopy(R, pts[npts-1]);
-    index = pts_index[npts-1];
-    npts -= 1;
-  }
-
-  get_3_isog(R, A24minus, A24plus, coeff);
+  traverse_Bob_ss(pts, A24minus, A24plus);
   fp2add(A, A24plus, A24minus); 
   fp2add(A, A, A); 
   fp2sub(A24plus, A24plus, A24minus);      
@@ -21,73 +21,114 @@ static void append_pk_to_sk(uint8_t *sk, const uint8_t *pk)
     memcpy(&sk[k*CRYPTO_SECRETKEYBYTES+MSG_BYTES+SECRETKEY_B_BYTES], &pk[k*CRYPTO_PUBLICKEYBYTES], CRYPTO_PUBLICKEYBYTES);
 }
 
-// convert radix-51 vector to eight radix-64 strings 
+// 64-bit words of a radix-64 string of GFP_BYTES bytes, padded to whole 8x8 blocks
+#define GFP_WORDS   ((GFP_BYTES+7)/8)
+#define GFP_BLOCKS  ((GFP_WORDS+7)/8)
+
+// transpose the 8x8 matrix of 64-bit words r[0..7] in place
+static void transpose_8x8(__m512i *r)
+{
+  const __m512i lo = VSET(13, 12, 5, 4, 9, 8, 1, 0), hi = VSET(15, 14, 7, 6, 11, 10, 3, 2);
+  __m512i t0, t1, t2, t3, t4, t5, t6, t7, u0, u1, u2, u3, u4, u5, u6, u7;
+
+  t0 = VUNPACKLO(r[0], r[1]); t1 = VUNPACKHI(r[0], r[1]);
+  t2 = VUNPACKLO(r[2], r[3]); t3 = VUNPACKHI(r[2], r[3]);
+  t4 = VUNPACKLO(r[4], r[5]); t5 = VUNPACKHI(r[4], r[5]);
+  t6 = VUNPACKLO(r[6], r[7]); t7 = VUNPACKHI(r[6], r[7]);
+
+  u0 = VPERMV2(t0, lo, t2); u1 = VPERMV2(t1, lo, t3);
+  u2 = VPERMV2(t0, hi, t2); u3 = VPERMV2(t1, hi, t3);
+  u4 = VPERMV2(t4, lo, t6); u5 = VPERMV2(t5, lo, t7);
+  u6 = VPERMV2(t4, hi, t6); u7 = VPERMV2(t5, hi, t7);
+
+  r[0] = VSHUF128(u0, u4, 0x44); r[4] = VSHUF128(u0, u4, 0xEE);
+  r[1] = VSHUF128(u1, u5, 0x44); r[5] = VSHUF128(u1, u5, 0xEE);
+  r[2] = VSHUF128(u2, u6, 0x44); r[6] = VSHUF128(u2, u6, 0xEE);
+  r[3] = VSHUF128(u3, u7, 0x44); r[7] = VSHUF128(u3, u7, 0xEE);
+}
+
+// convert radix-51 vector to eight radix-64 strings: the radix conversion runs on 
+// all lanes at once, then 8x8 transposes turn word vectors into per-lane strings 
 static void vec_to_str(uint8_t *str, const int slen, const __m512i *vec, const int vnum)
 {
-  uint64_t t51[INSTANCES][vnum][NWORDS];
-  uint64_t t64[vnum][NWORDS];
-  int i, j, k;
+  __m512i w[8*GFP_BLOCKS];
+  int b, i, j, k, q, s, n;
 
   for (j = 0; j < vnum; j++) {
-    get_channel(t51[0][j], &vec[j*NWORDS], 0);
-    get_channel(t51[1][j], &vec[j*NWORDS], 1);
-    get_channel(t51[2][j], &vec[j*NWORDS], 2);
-    get_channel(t51[3][j], &vec[j*NWORDS], 3);
-    get_channel(t51[4][j], &vec[j*NWORDS], 4);
-    get_channel(t51[5][j], &vec[j*NWORDS], 5);
-    get_channel(t51[6][j], &vec[j*NWORDS], 6);
-    get_channel(t51[7][j], &vec[j*NWORDS], 7);
-  }
+    // word i holds bits [64i, 64i+64) of limbs q, q+1, q+2 with q = 64i/51
+    for (i = 0; i < 8*GFP_BLOCKS; i++) w[i] = VZERO;
+    for (i = 0; i < GFP_WORDS; i++) {
+      q = 64*i/BRADIX; s = 64*i%BRADIX;
+      w[i] = VSHR(vec[j*NWORDS+q], s);
+      if (q+1 < NWORDS) w[i] = VOR(w[i], VSHL(vec[j*NWORDS+q+1], BRADIX-s));
+      if ((q+2 < NWORDS) && (2*BRADIX-s < 64)) w[i] = VOR(w[i], VSHL(vec[j*NWORDS+q+2], 2*BRADIX-s));
+    }
 
-  for (k = 0; k < INSTANCES; k++) {
-    for (j = 0; j < vnum; j++) {
-      mpi_conv_51to64(t64[j], t51[k][j], NWORDS, NWORDS); 
-      memcpy(&str[k*slen+j*GFP_BYTES], t64[j], GFP_BYTES);
+    for (b = 0; b < GFP_BLOCKS; b++) {
+      transpose_8x8(&w[8*b]);
+      n = (GFP_BYTES-64*b < 64) ? GFP_BYTES-64*b : 64;
+      for (k = 0; k < INSTANCES; k++)
+        VMSTORE8(&str[k*slen+j*GFP_BYTES+64*b], (n == 64) ? ~0ULL : (1ULL << n)-1, w[8*b+k]);
     }
   }
 }
 
+// convert eight radix-64 strings to radix-51 vector
 static void str_to_vec(__m512i *vec, const int vnum, const uint8_t *str, const int slen)
 {
-  uint64_t t51[INSTANCES][vnum][NWORDS];
-  uint64_t t64[vnum][NWORDS];
-  int i, j, k;
+  __m512i w[8*GFP_BLOCKS+1];
+  int b, i, j, k, a, s, n;
 
-  memset(t64, 0, vnum*NWORDS*8);
+  w[8*GFP_BLOCKS] = VZERO;
+  for (j = 0; j < vnum; j++) {
+    for (b = 0; b < GFP_BLOCKS; b++) {
+      n = (GFP_BYTES-64*b < 64) ? GFP_BYTES-64*b : 64;
+      for (k = 0; k < INSTANCES; k++)
+        w[8*b+k] = VZLOAD8((n == 64) ? ~0ULL : (1ULL << n)-1, &str[k*slen+j*GFP_BYTES+64*b]);
+      transpose_8x8(&w[8*b]);
+    }
 
-  for (k = 0; k < INSTANCES; k++) {
-    for (j = 0; j < vnum; j++)  {
-      memcpy(t64[j], &str[k*slen+j*GFP_BYTES], GFP_BYTES);
-      mpi_conv_64to51(t51[k][j], t64[j], NWORDS, NWORDS);
+    // limb i holds bits [51i, 51i+51) of words a, a+1 with a = 51i/64
+    for (i = 0; i < NWORDS; i++) {
+      a = BRADIX*i/64; s = BRADIX*i%64;
+      vec[j*NWORDS+i] = VAND(VSHRDV(w[a], w[a+1], VSET1(s)), VSET1(BMASK));
     }
   }
+}
 
-  for (j = 0; j < vnum; j++) {
-    for (i = 0; i < NWORDS; i++) 
-      vec[j*NWORDS+i] = set_vector(t51[7][j][i], t51[6][j][i], t51[5][j][i], t51[4][j][i], \
-                                   t51[3][j][i], t51[2][j][i], t51[1][j][i], t51[0][j][i]);
-  }
+// vectorized ephemeral key <- G(in), the 8 inputs are in + k*instride: the SHAKE256 output 
+// words are squeezed directly into the key vectors and masked as sk[SECRETKEY_A_BYTES-1] &= MASK_ALICE
+static void gen_vsk_A(__m512i *vsk, const uint8_t *in, const unsigned long long instride, const unsigned long long inlen)
+{
+  const uint64_t mask = ~((uint64_t)(0xFF ^ MASK_ALICE) << 8*((SECRETKEY_A_BYTES-1)%8));
+
+  shake256_8x1w_vec(vsk, SECRETKEY_A_BYTES, in, instride, inlen);
+  vsk[SK_A_VECTS-1] = VAND(vsk[SK_A_VECTS-1], VSET1(mask));
 }
 
 // SIKE key generation 
 // single sk = s || SK || PK 
 // single pk = PK            
 void crypto_kem_keypair(uint8_t *pk, uint8_t *sk)
+{
+  uint8_t coins[CRYPTO_KEYPAIR_COINBYTES];
+
+  // generate random strings for 8 instances in one call
+  randombytes(coins, sizeof(coins));
+  crypto_kem_keypair_derand(pk, sk, coins);
+}
+
+// SIKE key generation from caller-supplied coins: the 8 strings s 
+// (INSTANCES*MSG_BYTES bytes) followed by the 8 strings SK (INSTANCES*SECRETKEY_B_BYTES bytes)
+void crypto_kem_keypair_derand(uint8_t *pk, uint8_t *sk, const uint8_t *coins)
 {
   __m512i vsk[SK_B_VECTS], vpk[6*NWORDS];
+  int k;
 
-  // generate random strings for 8 instances  
-  randombytes(sk                        , MSG_BYTES);
-  randombytes(sk+  CRYPTO_SECRETKEYBYTES, MSG_BYTES);
-  randombytes(sk+2*CRYPTO_SECRETKEYBYTES, MSG_BYTES);
-  randombytes(sk+3*CRYPTO_SECRETKEYBYTES, MSG_BYTES);
-  randombytes(sk+4*CRYPTO_SECRETKEYBYTES, MSG_BYTES);
-  randombytes(sk+5*CRYPTO_SECRETKEYBYTES, MSG_BYTES);
-  randombytes(sk+6*CRYPTO_SECRETKEYBYTES, MSG_BYTES);
-  randombytes(sk+7*CRYPTO_SECRETKEYBYTES, MSG_BYTES);
+  for (k = 0; k < INSTANCES; k++) memcpy(sk+k*CRYPTO_SECRETKEYBYTES, coins+k*MSG_BYTES, MSG_BYTES);
 
-  // generate random private keys for 8 instances 
-  random_mod_order_B(vsk, sk);
+  // private keys for 8 instances 
+  mod_order_B(vsk, sk, coins+INSTANCES*MSG_BYTES);
 
   // generate vectorized public key (radix-51)
   EphemeralKeyGeneration_B(vsk, vpk);
@@ -99,67 +140,156 @@ void crypto_kem_keypair(uint8_t *pk, uint8_t *sk)
   append_pk_to_sk(sk, pk);
 }
 
+// prepare 8 public keys for repeated encapsulations: decode them once and keep 
+// Bob's basis and curve constants in Montgomery form, and (if table != NULL) 
+// the ladder tables, table must hold OALICE_BITS entries. The table saves about 
+// 4% of every encapsulation and costs about one and a half to build (timing_sike) 
+void crypto_kem_enc_prepare(prepared_pk_t ppk, const uint8_t *pk, f2elm_t (*table)[2])
+{
+  __m512i vpk[6*NWORDS];
+
+  memcpy(ppk->pk, pk, INSTANCES*CRYPTO_PUBLICKEYBYTES);
+
+  // pk strings -> vectorized pk (radix-64 -> radix-51)
+  str_to_vec(vpk, 6, pk, CRYPTO_PUBLICKEYBYTES);
+  PreparePublicKey_B(vpk, ppk->pkB, table);
+}
+
 // SIKE encapsulation
 void crypto_kem_enc(uint8_t *ct, uint8_t *ss, const uint8_t *pk)
 {
-  __m512i vsk[SK_A_VECTS], vpk[6*NWORDS], vct[6*NWORDS], vjinv[2*NWORDS];
-  uint8_t sk[INSTANCES][8*SK_A_VECTS] = { 0 };
-  uint64_t *sk64 = (uint64_t *)sk;
-  uint8_t temp[INSTANCES][CRYPTO_CIPHERTEXTBYTES+MSG_BYTES] = { 0 };
-  uint8_t jinv[INSTANCES][2*GFP_BYTES];
+  prepared_pk_t ppk;
+
+  crypto_kem_enc_prepare(ppk, pk, NULL);
+  crypto_kem_enc_prepared(ct, ss, ppk);
+}
+
+// SIKE encapsulation with the caller-supplied messages m (CRYPTO_ENC_COINBYTES bytes)
+void crypto_kem_enc_derand(uint8_t *ct, uint8_t *ss, const uint8_t *pk, const uint8_t *m)
+{
+  prepared_pk_t ppk;
+
+  crypto_kem_enc_prepare(ppk, pk, NULL);
+  crypto_kem_enc_prepared_derand(ct, ss, ppk, m);
+}
+
+// SIKE encapsulation to prepared public keys
+void crypto_kem_enc_prepared(uint8_t *ct, uint8_t *ss, const prepared_pk_t ppk)
+{
+  uint8_t m[CRYPTO_ENC_COINBYTES];
+
+  randombytes(m, sizeof(m));
+  crypto_kem_enc_prepared_derand(ct, ss, ppk, m);
+}
+
+// SIKE encapsulation to prepared public keys with the caller-supplied messages m 
+// (CRYPTO_ENC_COINBYTES bytes)
+void crypto_kem_enc_prepared_derand(uint8_t *ct, uint8_t *ss, const prepared_pk_t ppk, const uint8_t *m)
+{
+  __m512i vsk[SK_A_VECTS], vct[6*NWORDS], vjinv[2*NWORDS];
+  uint8_t temp[INSTANCES][SHAKE_STRIDE(CRYPTO_CIPHERTEXTBYTES+MSG_BYTES)] = { 0 };
+  uint8_t jinv[INSTANCES][SHAKE_STRIDE(2*GFP_BYTES)];
   uint8_t h[INSTANCES][MSG_BYTES];
   int i, k;
 
   for (k = 0; k < INSTANCES; k++) {
-    randombytes(temp[k], MSG_BYTES);
-    memcpy(&temp[k][MSG_BYTES], &pk[k*CRYPTO_PUBLICKEYBYTES], CRYPTO_PUBLICKEYBYTES);
+    memcpy(temp[k], m+k*MSG_BYTES, MSG_BYTES);
+    memcpy(&temp[k][MSG_BYTES], &ppk->pk[k*CRYPTO_PUBLICKEYBYTES], CRYPTO_PUBLICKEYBYTES);
   }  
-  shake256_8x1w(sk[0], sk[1], sk[2], sk[3], sk[4], sk[5], sk[6], sk[7], SECRETKEY_A_BYTES,
-                temp[0], temp[1], temp[2], temp[3], temp[4], temp[5], temp[6], temp[7], CRYPTO_PUBLICKEYBYTES+MSG_BYTES);
-  for (k = 0; k < INSTANCES; k++) sk[k][SECRETKEY_A_BYTES-1] &= MASK_ALICE;
-
-  // form vectorized private key
-  for (i = 0; i < SK_A_VECTS; i++) 
-    vsk[i] = set_vector(sk64[7*SK_A_VECTS+i], sk64[6*SK_A_VECTS+i], \
-                        sk64[5*SK_A_VECTS+i], sk64[4*SK_A_VECTS+i], \
-                        sk64[3*SK_A_VECTS+i], sk64[2*SK_A_VECTS+i], \
-                        sk64[  SK_A_VECTS+i], sk64[i]);
-
-  // pk strings -> vectorized pk (radix-64 -> radix-51)
-  str_to_vec(vpk, 6, pk, CRYPTO_PUBLICKEYBYTES);
+  // vectorized private key <- G(m||pk)
+  gen_vsk_A(vsk, temp[0], sizeof(temp[0]), CRYPTO_PUBLICKEYBYTES+MSG_BYTES);
 
   // Encrypt
   EphemeralKeyGeneration_A(vsk, vct);             
-  EphemeralSecretAgreement_A(vsk, vpk, vjinv);    
+  EphemeralSecretAgreement_A_prepared(vsk, ppk->pkB, vjinv);    
 
   // vectorized ct and jinv -> ct and jinv strings (radix-51 -> radix-64)
   vec_to_str(ct, CRYPTO_CIPHERTEXTBYTES, vct, 6);                          
-  vec_to_str((uint8_t *)jinv, 2*GFP_BYTES, vjinv, 2);
+  vec_to_str((uint8_t *)jinv, sizeof(jinv[0]), vjinv, 2);
 
-  shake256_8x1w(h[0], h[1], h[2], h[3], h[4], h[5], h[6], h[7], MSG_BYTES, \
-                jinv[0], jinv[1], jinv[2], jinv[3], jinv[4], jinv[5], jinv[6], jinv[7], 2*GFP_BYTES);
+  shake256_8x1w_strided(h[0], MSG_BYTES, MSG_BYTES, jinv[0], sizeof(jinv[0]), 2*GFP_BYTES);
   for (k = 0; k < INSTANCES; k++) {
     for (i = 0; i < MSG_BYTES; i++) 
       ct[i+CRYPTO_PUBLICKEYBYTES+k*CRYPTO_CIPHERTEXTBYTES] = temp[k][i] ^ h[k][i];
     memcpy(&temp[k][MSG_BYTES], &ct[k*CRYPTO_CIPHERTEXTBYTES], CRYPTO_CIPHERTEXTBYTES);
   }
-  shake256_8x1w(ss, &ss[CRYPTO_BYTES], &ss[2*CRYPTO_BYTES], &ss[3*CRYPTO_BYTES], \
-                &ss[4*CRYPTO_BYTES], &ss[5*CRYPTO_BYTES], &ss[6*CRYPTO_BYTES], &ss[7*CRYPTO_BYTES], CRYPTO_BYTES,\
-                temp[0], temp[1], temp[2], temp[3], temp[4], temp[5], temp[6], temp[7], CRYPTO_CIPHERTEXTBYTES+MSG_BYTES);
+  shake256_8x1w_strided(ss, CRYPTO_BYTES, CRYPTO_BYTES, temp[0], sizeof(temp[0]), CRYPTO_CIPHERTEXTBYTES+MSG_BYTES);
 }
 
-// SIKE decapsulation
-void crypto_kem_dec(uint8_t *ss, const uint8_t *ct, const uint8_t *sk)
+// SIKE mKEM encapsulation of one shared secret ss to n recipients (mKEM construction) 
+// ct0 : the ephemeral public key c0 shared by all recipients (CRYPTO_PUBLICKEYBYTES bytes)
+// ct  : n messages c1 of MSG_BYTES bytes, the ciphertext of recipient k is c0 || ct[k*MSG_BYTES]
+// Alice's key generation runs once with the ephemeral key G(m), only the secret agreement 
+// runs per recipient, INSTANCES recipients at a time 
+void crypto_mkem_enc(uint8_t *ct0, uint8_t *ct, uint8_t *ss, const uint8_t *pk, const int n)
+{
+  __m512i vsk[SK_A_VECTS], vct[6*NWORDS], vpk[6*NWORDS], vjinv[2*NWORDS];
+  uint8_t temp[CRYPTO_PUBLICKEYBYTES+MSG_BYTES];
+  uint8_t c0[INSTANCES][CRYPTO_PUBLICKEYBYTES];
+  uint8_t tpk[INSTANCES][CRYPTO_PUBLICKEYBYTES];
+  uint8_t jinv[INSTANCES][SHAKE_STRIDE(2*GFP_BYTES)];
+  uint8_t h[INSTANCES][MSG_BYTES];
+  int i, j, k;
+
+  // the same ephemeral key G(m) in all lanes (input stride 0)
+  randombytes(temp, MSG_BYTES);
+  gen_vsk_A(vsk, temp, 0, MSG_BYTES);
+
+  EphemeralKeyGeneration_A(vsk, vct);
+  vec_to_str((uint8_t *)c0, CRYPTO_PUBLICKEYBYTES, vct, 6);
+  memcpy(ct0, c0[0], CRYPTO_PUBLICKEYBYTES);
+
+  for (j = 0; j < n; j += INSTANCES) {
+    // a partial batch repeats the first public key of the batch in the unused lanes
+    for (k = 0; k < INSTANCES; k++) 
+      memcpy(tpk[k], &pk[(j+k < n ? j+k : j)*CRYPTO_PUBLICKEYBYTES], CRYPTO_PUBLICKEYBYTES);
+
+    // pk strings -> vectorized pk (radix-64 -> radix-51)
+    str_to_vec(vpk, 6, (uint8_t *)tpk, CRYPTO_PUBLICKEYBYTES);
+    EphemeralSecretAgreement_A(vsk, vpk, vjinv);
+    vec_to_str((uint8_t *)jinv, sizeof(jinv[0]), vjinv, 2);
+
+    shake256_8x1w_strided(h[0], MSG_BYTES, MSG_BYTES, jinv[0], sizeof(jinv[0]), 2*GFP_BYTES);
+    for (k = 0; k < INSTANCES && j+k < n; k++) {
+      for (i = 0; i < MSG_BYTES; i++) 
+        ct[(j+k)*MSG_BYTES+i] = temp[i] ^ h[k][i];
+    }
+  }
+
+  // shared secret ss <- H(m||c0)
+  memcpy(&temp[MSG_BYTES], ct0, CRYPTO_PUBLICKEYBYTES);
+  shake256_8x1w_strided(h[0], MSG_BYTES, CRYPTO_BYTES, temp, 0, CRYPTO_PUBLICKEYBYTES+MSG_BYTES);
+  memcpy(ss, h[0], CRYPTO_BYTES);
+}
+
+// lanes where the vectors a and b (len radix-51 words) are equal: ct strings map 
+// bit for bit to the vectors str_to_vec produces, so this is a byte compare of 
+// the 8 strings without converting back to radix-64
+static __mmask8 vec_equal(const __m512i *a, const __m512i *b, const int len)
+{
+  __m512i t = VZERO;
+  int i;
+
+  for (i = 0; i < len; i++) t = VOR(t, VXOR(a[i], b[i]));
+
+  return VCMPEQ(t, VZERO);
+}
+
+// SIKE decapsulation, or mKEM decapsulation if mkem != 0: the ephemeral key is 
+// then G(m) and the shared secret is H(m||c0), which do not depend on the recipient, 
+// while a rejected ct still gives H(s||c0||c1) as in SIKE 
+static void kem_dec(uint8_t *ss, const uint8_t *ct, const uint8_t *sk, const int mkem)
 {
   __m512i vct[6*NWORDS], vjinv[2*NWORDS], vsk[SK_A_VECTS], vc0[6*NWORDS];
-  uint8_t tsk[INSTANCES][8*SK_A_VECTS] = { 0 };
+  uint8_t tsk[INSTANCES][8*SK_B_VECTS] = { 0 };
   uint64_t *sk64 = (uint64_t *)tsk;
-  uint8_t jinv[INSTANCES][2*GFP_BYTES];
-  uint8_t h[INSTANCES][MSG_BYTES];
-  uint8_t temp[INSTANCES][CRYPTO_CIPHERTEXTBYTES+MSG_BYTES];
-  uint8_t c0[INSTANCES][CRYPTO_PUBLICKEYBYTES];
+  uint8_t jinv[INSTANCES][SHAKE_STRIDE(2*GFP_BYTES)];
+  uint8_t h[INSTANCES][MSG_BYTES], ssm[INSTANCES][CRYPTO_BYTES];
+  uint8_t temp[INSTANCES][SHAKE_STRIDE(CRYPTO_CIPHERTEXTBYTES+MSG_BYTES)];
   int i, k;
   int8_t selector;
+  __mmask8 eq;
+  const int glen = mkem ? MSG_BYTES : CRYPTO_PUBLICKEYBYTES+MSG_BYTES;
 
   // ct strings -> vectorized ct (radix-64 -> radix-51)
   str_to_vec(vct, 6, ct, CRYPTO_CIPHERTEXTBYTES);
@@ -176,41 +306,57 @@ void crypto_kem_dec(uint8_t *ss, const uint8_t *ct, const uint8_t *sk)
   EphemeralSecretAgreement_B(vsk, vct, vjinv);
 
   // vectorized jinv -> jinv strings (radix-51 -> radix-64)
-  vec_to_str((uint8_t *)jinv, 2*GFP_BYTES, vjinv, 2);
-
-  // clear tsk array and use it as esk
-  memset(tsk, 0, INSTANCES*8*SK_A_VECTS);
+  vec_to_str((uint8_t *)jinv, sizeof(jinv[0]), vjinv, 2);
 
-  shake256_8x1w(h[0], h[1], h[2], h[3], h[4], h[5], h[6], h[7], MSG_BYTES, \
-                jinv[0], jinv[1], jinv[2], jinv[3], jinv[4], jinv[5], jinv[6], jinv[7], 2*GFP_BYTES);
+  shake256_8x1w_strided(h[0], MSG_BYTES, MSG_BYTES, jinv[0], sizeof(jinv[0]), 2*GFP_BYTES);
   for (k = 0; k < INSTANCES; k++) {
     for (i = 0; i < MSG_BYTES; i++) 
       temp[k][i] = ct[i+CRYPTO_PUBLICKEYBYTES+k*CRYPTO_CIPHERTEXTBYTES] ^ h[k][i];
     memcpy(&temp[k][MSG_BYTES], &sk[MSG_BYTES+SECRETKEY_B_BYTES+k*CRYPTO_SECRETKEYBYTES], CRYPTO_PUBLICKEYBYTES);
   }
-  shake256_8x1w(tsk[0], tsk[1], tsk[2], tsk[3], tsk[4], tsk[5], tsk[6], tsk[7], SECRETKEY_A_BYTES, \
-                temp[0], temp[1], temp[2], temp[3], temp[4], temp[5], temp[6], temp[7], CRYPTO_PUBLICKEYBYTES+MSG_BYTES);
-  for (k = 0; k < INSTANCES; k++) tsk[k][SECRETKEY_A_BYTES-1] &= MASK_ALICE;
 
-  // form vectorized esk
-  for (i = 0; i < SK_A_VECTS; i++)
-    vsk[i] = set_vector(sk64[7*SK_A_VECTS+i], sk64[6*SK_A_VECTS+i], \
-                        sk64[5*SK_A_VECTS+i], sk64[4*SK_A_VECTS+i], \
-                        sk64[3*SK_A_VECTS+i], sk64[2*SK_A_VECTS+i], \
-                        sk64[  SK_A_VECTS+i], sk64[i]);
+  // vectorized esk <- G(m'||pk), or G(m') for mKEM
+  gen_vsk_A(vsk, temp[0], sizeof(temp[0]), glen);
 
   // generate shared secret ss <- H(m||ct), or output ss <- H(s||ct) in case of ct verification failure
   EphemeralKeyGeneration_A(vsk, vc0);
 
-  // vectorized c0 -> c0 strings (radix-51 -> radix-64)
-  vec_to_str((uint8_t *)c0, CRYPTO_PUBLICKEYBYTES, vc0, 6);
+  // c0 is canonical (from_fp2mont ends in fpcorrection), compare it with the c0 part of 
+  // vct as is: canonicalizing vct would also accept non-canonical encodings of c0
+  eq = vec_equal(vc0, vct, 6*NWORDS);
 
-  for (k = 0; k < INSTANCES; k++) {
-    selector = ct_compare(c0[k], &ct[k*CRYPTO_CIPHERTEXTBYTES], CRYPTO_PUBLICKEYBYTES);
-    ct_cmov(&temp[k][0], &sk[k*CRYPTO_SECRETKEYBYTES], MSG_BYTES, selector);
+  for (k = 0; k < INSTANCES; k++) 
     memcpy(&temp[k][MSG_BYTES], &ct[k*CRYPTO_CIPHERTEXTBYTES], CRYPTO_CIPHERTEXTBYTES);
+
+  // mKEM: both H(m||c0) and H(s||c0||c1) are computed, the lanes pick one in constant time
+  if (mkem) {
+    shake256_8x1w_strided(ssm[0], CRYPTO_BYTES, CRYPTO_BYTES, temp[0], sizeof(temp[0]), CRYPTO_PUBLICKEYBYTES+MSG_BYTES);
+    for (k = 0; k < INSTANCES; k++) memcpy(&temp[k][0], &sk[k*CRYPTO_SECRETKEYBYTES], MSG_BYTES);
+  } else {
+    for (k = 0; k < INSTANCES; k++) {
+      selector = (int8_t)(((eq >> k) & 1) - 1);
+      ct_cmov(&temp[k][0], &sk[k*CRYPTO_SECRETKEYBYTES], MSG_BYTES, selector);
+    }
   }
-  shake256_8x1w(ss, &ss[CRYPTO_BYTES], &ss[2*CRYPTO_BYTES], &ss[3*CRYPTO_BYTES], \
-                &ss[4*CRYPTO_BYTES], &ss[5*CRYPTO_BYTES], &ss[6*CRYPTO_BYTES], &ss[7*CRYPTO_BYTES], CRYPTO_BYTES,\
-                temp[0], temp[1], temp[2], temp[3], temp[4], temp[5], temp[6], temp[7], CRYPTO_CIPHERTEXTBYTES+MSG_BYTES);
+  shake256_8x1w_strided(ss, CRYPTO_BYTES, CRYPTO_BYTES, temp[0], sizeof(temp[0]), CRYPTO_CIPHERTEXTBYTES+MSG_BYTES);
+
+  if (mkem) {
+    for (k = 0; k < INSTANCES; k++) {
+      selector = (int8_t)(((eq >> k) & 1) - 1);
+      ct_cmov(&ss[k*CRYPTO_BYTES], ssm[k], CRYPTO_BYTES, ~selector);
+    }
+  }
+}
+
+// SIKE decapsulation
+void crypto_kem_dec(uint8_t *ss, const uint8_t *ct, const uint8_t *sk)
+{
+  kem_dec(ss, ct, sk, 0);
+}
+
+// SIKE mKEM decapsulation, ct holds INSTANCES ciphertexts c0 || c1 formed 
+// from the outputs of crypto_mkem_enc 
+void crypto_mkem_dec(uint8_t *ss, const uint8_t *ct, const uint8_t *sk)
+{
+  kem_dec(ss, ct, sk, 1);
 }
@@ -13,8 +13,23 @@
 #include "sidh.h"
 #include "fips202.h"
 
+// INSTANCES public keys prepared for repeated encapsulations
+typedef struct { uint8_t pk[INSTANCES*CRYPTO_PUBLICKEYBYTES]; prepared_pkB_t pkB; } prepared_pk;
+typedef prepared_pk prepared_pk_t[1];
+
+// coins of the deterministic (_derand) key generation and encapsulation
+#define CRYPTO_KEYPAIR_COINBYTES (INSTANCES*(MSG_BYTES+SECRETKEY_B_BYTES))
+#define CRYPTO_ENC_COINBYTES     (INSTANCES*MSG_BYTES)
+
 void crypto_kem_keypair(uint8_t *pk, uint8_t *sk);
+void crypto_kem_keypair_derand(uint8_t *pk, uint8_t *sk, const uint8_t *coins);
 void crypto_kem_enc(uint8_t *ct, uint8_t *ss, const uint8_t *pk);
+void crypto_kem_enc_derand(uint8_t *ct, uint8_t *ss, const uint8_t *pk, const uint8_t *m);
+void crypto_kem_enc_prepare(prepared_pk_t ppk, const uint8_t *pk, f2elm_t (*table)[2]);
+void crypto_kem_enc_prepared(uint8_t *ct, uint8_t *ss, const prepared_pk_t ppk);
+void crypto_kem_enc_prepared_derand(uint8_t *ct, uint8_t *ss, const prepared_pk_t ppk, const uint8_t *m);
 void crypto_kem_dec(uint8_t *ss, const uint8_t *ct, const uint8_t *sk);
+void crypto_mkem_enc(uint8_t *ct0, uint8_t *ct, uint8_t *ss, const uint8_t *pk, const int n);
+void crypto_mkem_dec(uint8_t *ss, const uint8_t *ct, const uint8_t *sk);
 
 #endif
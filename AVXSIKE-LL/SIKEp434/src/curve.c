@@ -2287,42 +2287,42 @@ void eval_3_isog_2x2x2x1w(vfelm_t Q, vfelm_t coeff0_1)
 static void fp2mix3_4x2x1w(vfelm_t r, vfelm_t s, const vfelm_t a, const vfelm_t b, const vfelm_t c, const vfelm_t d)
 {
   __m512i a0 = a[0], a1 = a[1], a2 = a[2], a3 = a[3], a4 = a[4];
-  __m512i a5 = a[5], a6 = a[6], a7 = a[7], a8 = a[8], a9 = a[9];
+  __m512i a5 = a[5], a6 = a[6], a7 = a[7], a8 = a[8];
   __m512i b0 = b[0], b1 = b[1], b2 = b[2], b3 = b[3], b4 = b[4];
-  __m512i b5 = b[5], b6 = b[6], b7 = b[7], b8 = b[8], b9 = b[9];
+  __m512i b5 = b[5], b6 = b[6], b7 = b[7], b8 = b[8];
   __m512i c0 = c[0], c1 = c[1], c2 = c[2], c3 = c[3], c4 = c[4];
-  __m512i c5 = c[5], c6 = c[6], c7 = c[7], c8 = c[8], c9 = c[9];
+  __m512i c5 = c[5], c6 = c[6], c7 = c[7], c8 = c[8];
   __m512i d0 = d[0], d1 = d[1], d2 = d[2], d3 = d[3], d4 = d[4];
-  __m512i d5 = d[5], d6 = d[6], d7 = d[7], d8 = d[8], d9 = d[9];
-  __m512i r0, r1, r2, r3, r4, r5, r6, r7, r8, r9;
-  __m512i s0, s1, s2, s3, s4, s5, s6, s7, s8, s9;
+  __m512i d5 = d[5], d6 = d[6], d7 = d[7], d8 = d[8];
+  __m512i r0, r1, r2, r3, r4, r5, r6, r7, r8;
+  __m512i s0, s1, s2, s3, s4, s5, s6, s7, s8;
 
   // r = < E1 | E0 | B1 | B0 | E1 |  E0 | B1 | B0 >
   r0 = VMBLEND(0x33, a0, b0); r1 = VMBLEND(0x33, a1, b1);
   r2 = VMBLEND(0x33, a2, b2); r3 = VMBLEND(0x33, a3, b3);
   r4 = VMBLEND(0x33, a4, b4); r5 = VMBLEND(0x33, a5, b5); 
   r6 = VMBLEND(0x33, a6, b6); r7 = VMBLEND(0x33, a7, b7); 
-  r8 = VMBLEND(0x33, a8, b8); r9 = VMBLEND(0x33, a9, b9);
+  r8 = VMBLEND(0x33, a8, b8);
 
   // s = < D1 | D0 | H1 | H0 | D1 | D0 | H1 | H0 >
   s0 = VPERM(d0, 0x4E); s1 = VPERM(d1, 0x4E);
   s2 = VPERM(d2, 0x4E); s3 = VPERM(d3, 0x4E);
   s4 = VPERM(d4, 0x4E); s5 = VPERM(d5, 0x4E);
   s6 = VPERM(d6, 0x4E); s7 = VPERM(d7, 0x4E);
-  s8 = VPERM(d8, 0x4E); s9 = VPERM(d9, 0x4E);
+  s8 = VPERM(d8, 0x4E);
 
   // s = < G1 | G0 | H1 | H0 | G1 | G0 | H1 | H0 >
   s0 = VMBLEND(0x33, c0, s0); s1 = VMBLEND(0x33, c1, s1); 
   s2 = VMBLEND(0x33, c2, s2); s3 = VMBLEND(0x33, c3, s3); 
   s4 = VMBLEND(0x33, c4, s4); s5 = VMBLEND(0x33, c5, s5); 
   s6 = VMBLEND(0x33, c6, s6); s7 = VMBLEND(0x33, c7, s7); 
-  s8 = VMBLEND(0x33, c8, s8); s9 = VMBLEND(0x33, c9, s9);
+  s8 = VMBLEND(0x33, c8, s8);
 
   r[0] = r0; r[1] = r1; r[2] = r2; r[3] = r3; r[4] = r4; 
-  r[5] = r5; r[6] = r6; r[7] = r7; r[8] = r8; r[9] = r9;
+  r[5] = r5; r[6] = r6; r[7] = r7; r[8] = r8;
 
   s[0] = s0; s[1] = s1; s[2] = s2; s[3] = s3; s[4] = s4;
-  s[5] = s5; s[6] = s6; s[7] = s7; s[8] = s8; s[9] = s9;
+  s[5] = s5; s[6] = s6; s[7] = s7; s[8] = s8;
 }
 
 // INPUT        
@@ -2350,18 +2350,18 @@ void xDBL_2x2x2x1w(const vfelm_t P, vfelm_t Q, const vfelm_t C24_A24plus)
 static void fp2align3_4x2x1w(vfelm_t r, const vfelm_t a)
 {
   __m512i a0 = a[0], a1 = a[1], a2 = a[2], a3 = a[3], a4 = a[4];
-  __m512i a5 = a[5], a6 = a[6], a7 = a[7], a8 = a[8], a9 = a[9];
-  __m512i r0, r1, r2, r3, r4, r5, r6, r7, r8, r9;
+  __m512i a5 = a[5], a6 = a[6], a7 = a[7], a8 = a[8];
+  __m512i r0, r1, r2, r3, r4, r5, r6, r7, r8;
 
   // r = C1 | C0 | D1 | D0 | A1 | A0 | B1 | B0
   r0 = VPERM(a0, 0x4E); r1 = VPERM(a1, 0x4E);
   r2 = VPERM(a2, 0x4E); r3 = VPERM(a3, 0x4E);
   r4 = VPERM(a4, 0x4E); r5 = VPERM(a5, 0x4E);
   r6 = VPERM(a6, 0x4E); r7 = VPERM(a7, 0x4E);
-  r8 = VPERM(a8, 0x4E); r9 = VPERM(a9, 0x4E);
+  r8 = VPERM(a8, 0x4E);
 
   r[0] = r0; r[1] = r1; r[2] = r2; r[3] = r3; r[4] = r4; 
-  r[5] = r5; r[6] = r6; r[7] = r7; r[8] = r8; r[9] = r9;
+  r[5] = r5; r[6] = r6; r[7] = r7; r[8] = r8;
 }
 
 // INPUT
@@ -2516,1314 +2516,579 @@ void LADDER3PT_2x4x1x1w(const f2elm_r51_t xP, const f2elm_r51_t xQ, const f2elm_
   get_channel_8x1w(_R->Z[1], z1x1_A[1], 3);
 }
 
-void carryp_1w(uint64_t *a)
+// Fixed-basis Montgomery ladder for the key generation of Alice and Bob. 
+// The kernel point is computed as P + [m]Q where the addend of the i-th step 
+// is always R0 = [2^i]Q of the public basis, so the doublings of R0 are done 
+// once and each step reduces to a differential addition. 
+// The tables ladder_table_A/B of ladder_table.h (generated by tools/strategy.c) 
+// hold < XR0-ZR0 | XR0+ZR0 > of [2^i]Q; they are projective, so no inversion 
+// is needed. 
+
+#include "ladder_table.h"
+
+// INPUT  xQ  : x-coordinate of the basis point Q 
+//        C24_A24plus : < C24 | A24plus > of the curve of Q 
+// OUTPUT tab : tab[i] = < XR0-ZR0 | XR0+ZR0 > for R0 = [2^i]Q, 0 <= i < nbits
+void ladder_table_1x2x2x2w(vgelm_t *tab, const f2elm_r51_t xQ, const vgelm_t C24_A24plus, const int nbits)
 {
+  point_proj_r51_t Q = { 0 };
+  vgelm_t R0;
   int i;
 
-  for (i = 0; i < VNWORDS-1; i++) {
-    a[i+1] += a[i]>>VBRADIX;
-    a[i] &= VBMASK;
+  fp2copy_1w(Q->X, xQ);
+  fpcopy_1w(Q->Z[0], vmont_R);
+  pack_point_1x2x2x2w(R0, Q);
+
+  for (i = 0; i < nbits; i++) {
+    mp2_hadamard_2x2x2w(tab[i], R0);    // tab[i] = X+Z | X-Z
+    vec_alignr4_4x2w(tab[i], tab[i]);   // tab[i] = X-Z | X+Z
+    xDBL_1x2x2x2w(R0, R0, C24_A24plus);
   }
 }
 
-void xDBLe_1x2x2x2w(vgelm_t vP, point_proj_r51_t Q, const vgelm_t C24_A24plus, const int e)
+// if swap == 0, then x3z3, z1x1 -> x3z3, z1x1
+// if swap == 1, then x3z3, z1x1 -> x1z1, z3x3
+static void swap_points_1x2x2x2w(vgelm_t x3z3, vgelm_t z1x1, int swap)
 {
+  vgelm_t x1z1, z3x3;
+  uint8_t mask = (uint8_t)(-swap);      // mask = 0x00 or 0xFF
   int i;
 
-  for (i = 0; i < e; i++) xDBL_1x2x2x2w(vP, vP, C24_A24plus);
-
-  // extract the point Q from vP
-  get_channel_4x2w(Q->X[0], vP, 4); get_channel_4x2w(Q->X[1], vP, 6);
-  get_channel_4x2w(Q->Z[0], vP, 0); get_channel_4x2w(Q->Z[1], vP, 2);
+  vec_alignr4_4x2w(z3x3, x3z3);
+  vec_alignr4_4x2w(x1z1, z1x1);
 
-  // final carry propagation making Q strictly in radix-2^51
-  carryp_1w(Q->X[0]); carryp_1w(Q->X[1]);
-  carryp_1w(Q->Z[0]); carryp_1w(Q->Z[1]);
+  for (i = 0; i < VGWORDS; i++) {
+    x3z3[i] = VMBLEND(mask, x3z3[i], x1z1[i]);
+    z1x1[i] = VMBLEND(mask, z1x1[i], z3x3[i]);
+  }
 }
 
-void xDBLe_2x2x2x1w(vfelm_t vP, point_proj_r51_t Q, point_proj_r51_t _Q, const vfelm_t C24_A24plus, const int e)
+// INPUT 
+// x3z3 : <  X31' |  X31 |  X30' |  X30 |  Z31' |  Z31 |  Z30' |  Z30 >
+// z1x1 : <  Z11' |  Z11 |  Z10' |  Z10 |  X11' |  X11 |  X10' |  X10 >
+// tab  : < X2-Z2 | X2+Z2 >
+// OUTPUT 
+// x3z3 : x(P3+P2) with x(P3-P2) = x(P1)
+static void xADD_fixed_1x2x2x2w(vgelm_t x3z3, const vgelm_t z1x1, const vgelm_t tab)
 {
-  int i;
-
-  for (i = 0; i < e; i++) xDBL_2x2x2x1w(vP, vP, C24_A24plus);
+  vgelm_t t1;
 
-  // extract the points Q and _Q from vP
-  get_channel_8x1w(Q->X[0], vP, 6); get_channel_8x1w(Q->X[1], vP, 7);
-  get_channel_8x1w(Q->Z[0], vP, 4); get_channel_8x1w(Q->Z[1], vP, 5);
-  get_channel_8x1w(_Q->X[0], vP, 2); get_channel_8x1w(_Q->X[1], vP, 3);
-  get_channel_8x1w(_Q->Z[0], vP, 0); get_channel_8x1w(_Q->Z[1], vP, 1);
+  mp2_hadamard_2x2x2w(t1, x3z3);        // t1 = X3+Z3                   | X3-Z3                   [4p]
+  fp2mul_mont_2x2x2w(t1, tab, t1);      // t1 = (X2-Z2)(X3+Z3)          | (X2+Z2)(X3-Z3)          [2p]
+  mp2_hadamard_2x2x2w(t1, t1);          // t1 = 2(X2X3-Z2Z3)            | 2(X2Z3-Z2X3)            [4p]
+  fp2sqr_mont_2x2x2w(t1, t1);           // t1 = 4(X2X3-Z2Z3)^2          | 4(X2Z3-Z2X3)^2          [2p]
+  fp2mul_mont_2x2x2w(x3z3, t1, z1x1);   // x3z3 = 4Z1(X2X3-Z2Z3)^2      | 4X1(X2Z3-Z2X3)^2        [2p]
 }
 
-void eval_4_isog_parallel_kg(point_proj_r51_t *pts, point_proj_r51_t phiP, point_proj_r51_t phiQ, point_proj_r51_t phiR, const vgelm_t coeff__0, const vgelm_t coeff2_1, const int num)
+// the ouput R : < XR1' | XR1 | XR0' | XR0 | ZR1' | ZR1 | ZR0' | ZR0 >
+// tab is the table of the basis point Q, see ladder_table_1x2x2x2w
+static void LADDER3PT_table_1x2x2x2w(const f2elm_r51_t xP, const f2elm_r51_t xPQ, const digit_t* m, const unsigned int AliceOrBob, const vgelm_t *tab, vgelm_t R)
 {
-  felm_r51_t cf00, cf01, cf10, cf11, cf20, cf21;
-  int i;
+  point_proj_r51_t RPQ = { 0 }, RP = { 0 };
+  vgelm_t x3z3, z1x1;
+  int i, nbits, bit, swap, prevbit = 0;
 
-  // extract constants
-  get_channel_4x2w(cf00, coeff__0, 0); get_channel_4x2w(cf01, coeff__0, 2);
-  get_channel_4x2w(cf10, coeff2_1, 0); get_channel_4x2w(cf11, coeff2_1, 2);
-  get_channel_4x2w(cf20, coeff2_1, 4); get_channel_4x2w(cf21, coeff2_1, 6);
+  if (AliceOrBob == ALICE) nbits = OALICE_BITS;
+  else                     nbits = OBOB_BITS - 1;
 
-  // carry propagation
-  carryp_1w(cf00); carryp_1w(cf01);
-  carryp_1w(cf10); carryp_1w(cf11);
-  carryp_1w(cf20); carryp_1w(cf21);
+  // x3z3 : < xPQ | 1  >
+  // z1x1 : <  1  | xP >
+  fp2copy_1w(RPQ->X, xPQ);
+  fpcopy_1w(RPQ->Z[0], vmont_R);
+  fpcopy_1w(RP->X[0], vmont_R);
+  fp2copy_1w(RP->Z, xP);
+  pack_point_1x2x2x2w(x3z3, RPQ);
+  pack_point_1x2x2x2w(z1x1, RP);
 
-  // depends on public info
-  if (num == 3 | num == 4 | num == 5 | num == 6) {
-    // 4x2x1x1w < pts[0] | phiP | phiQ | phiR >
-    vf2elm_t P, coeff[3];
-
-    // initialize vectors 
-    for (i = 0; i < VNWORDS; i++) {
-      P[0][i] = _SET(pts[0]->X[0][i], pts[0]->Z[0][i], phiP->X[0][i], phiP->Z[0][i], \
-                       phiQ->X[0][i],   phiQ->Z[0][i], phiR->X[0][i], phiR->Z[0][i]);
-      P[1][i] = _SET(pts[0]->X[1][i], pts[0]->Z[1][i], phiP->X[1][i], phiP->Z[1][i], \
-                       phiQ->X[1][i],   phiQ->Z[1][i], phiR->X[1][i], phiR->Z[1][i]);
-      coeff[0][0][i] = _SET(0, cf00[i], 0, cf00[i], 0, cf00[i], 0, cf00[i]);
-      coeff[0][1][i] = _SET(0, cf01[i], 0, cf01[i], 0, cf01[i], 0, cf01[i]);
-      coeff[1][0][i] = _SET(cf10[i], 0, cf10[i], 0, cf10[i], 0, cf10[i], 0);
-      coeff[1][1][i] = _SET(cf11[i], 0, cf11[i], 0, cf11[i], 0, cf11[i], 0);
-      coeff[2][0][i] = _SET(cf20[i], 0, cf20[i], 0, cf20[i], 0, cf20[i], 0);
-      coeff[2][1][i] = _SET(cf21[i], 0, cf21[i], 0, cf21[i], 0, cf21[i], 0);
-    }
+  // Main loop
+  for (i = 0; i < nbits; i++) {
+    bit = (m[i >> LOG2RADIX] >> (i & (RADIX-1))) & 1;
+    swap = bit ^ prevbit;
+    prevbit = bit;
+
+    swap_points_1x2x2x2w(x3z3, z1x1, swap);
+    xADD_fixed_1x2x2x2w(x3z3, z1x1, tab[i]);
+  }
+  swap_points_1x2x2x2w(x3z3, z1x1, prevbit);
 
-    eval_4_isog_4x2x1x1w(P, coeff);
+  // R = < X1 | Z1 >
+  vec_alignr4_4x2w(R, z1x1);
+}
 
-    // extract results
-    get_channel_8x1w(phiP->X[0], P[0], 5);   get_channel_8x1w(phiP->X[1], P[1], 5);
-    get_channel_8x1w(phiP->Z[0], P[0], 4);   get_channel_8x1w(phiP->Z[1], P[1], 4);
-    get_channel_8x1w(phiQ->X[0], P[0], 3);   get_channel_8x1w(phiQ->X[1], P[1], 3);
-    get_channel_8x1w(phiQ->Z[0], P[0], 2);   get_channel_8x1w(phiQ->Z[1], P[1], 2);
-    get_channel_8x1w(phiR->X[0], P[0], 1);   get_channel_8x1w(phiR->X[1], P[1], 1);
-    get_channel_8x1w(phiR->Z[0], P[0], 0);   get_channel_8x1w(phiR->Z[1], P[1], 0);
-  
-    // depends on public info
-    if (num >= 4) {
-      get_channel_8x1w(pts[0]->X[0], P[0], 7); get_channel_8x1w(pts[0]->X[1], P[1], 7);
-      get_channel_8x1w(pts[0]->Z[0], P[0], 6); get_channel_8x1w(pts[0]->Z[1], P[1], 6);
-    }
+// the ouput R : < XR1' | XR1 | XR0' | XR0 | ZR1' | ZR1 | ZR0' | ZR0 >
+void LADDER3PT_fixed_1x2x2x2w(const f2elm_r51_t xP, const f2elm_r51_t xPQ, const digit_t* m, const unsigned int AliceOrBob, vgelm_t R)
+{
+  LADDER3PT_table_1x2x2x2w(xP, xPQ, m, AliceOrBob, (AliceOrBob == ALICE) ? ladder_table_A : ladder_table_B, R);
+}
 
-    // depends on public info
-    if (num == 5) {
-      // 1x2x2x2w < pts[1] >
-      vgelm_t _P, _coeff[3];
-
-      // initialize vectors 
-      for (i = 0; i < VGWORDS-1; i++) {
-        _P[i] = _SET(pts[1]->X[1][i+VGWORDS], pts[1]->X[1][i], pts[1]->X[0][i+VGWORDS], pts[1]->X[0][i],\
-                     pts[1]->Z[1][i+VGWORDS], pts[1]->Z[1][i], pts[1]->Z[0][i+VGWORDS], pts[1]->Z[0][i]);
-        _coeff[0][i] = _SET(0, 0, 0, 0, cf01[i+VGWORDS], cf01[i], cf00[i+VGWORDS], cf00[i]); 
-        _coeff[1][i] = _SET(cf11[i+VGWORDS], cf11[i], cf10[i+VGWORDS], cf10[i], 0, 0, 0, 0); 
-        _coeff[2][i] = _SET(cf21[i+VGWORDS], cf21[i], cf20[i+VGWORDS], cf20[i], 0, 0, 0, 0); 
-      }
-      _P[i] = _SET(0, pts[1]->X[1][i], 0, pts[1]->X[0][i],\
-                   0, pts[1]->Z[1][i], 0, pts[1]->Z[0][i]);
-      _coeff[0][i] = _SET(0, 0, 0, 0, 0, cf01[i], 0, cf00[i]); 
-      _coeff[1][i] = _SET(0, cf11[i], 0, cf10[i], 0, 0, 0, 0); 
-      _coeff[2][i] = _SET(0, cf21[i], 0, cf20[i], 0, 0, 0, 0);
-
-      eval_4_isog_1x2x2x2w(_P, _coeff);
-
-      // extract results
-      get_channel_4x2w(pts[1]->X[0], _P, 4); get_channel_4x2w(pts[1]->X[1], _P, 6);
-      get_channel_4x2w(pts[1]->Z[0], _P, 0); get_channel_4x2w(pts[1]->Z[1], _P, 2);
-
-      // carry propagation 
-      carryp_1w(pts[1]->X[0]); carryp_1w(pts[1]->X[1]); 
-      carryp_1w(pts[1]->Z[0]); carryp_1w(pts[1]->Z[1]);  
-    }
+void carryp_1w(uint64_t *a)
+{
+  int i;
 
-    // depends on public info
-    if (num == 6) {
-      // 2x2x2x1w < pts[1] | pts[2] >
-      vfelm_t _P, _coeff[3];
-
-      for (i = 0; i < VNWORDS; i++) {
-        _P[i] = _SET(pts[1]->X[1][i], pts[1]->X[0][i], pts[1]->Z[1][i], pts[1]->Z[0][i], \
-                     pts[2]->X[1][i], pts[2]->X[0][i], pts[2]->Z[1][i], pts[2]->Z[0][i]);
-        _coeff[0][i] = _SET(0, 0, cf01[i], cf00[i], 0, 0, cf01[i], cf00[i]);
-        _coeff[1][i] = _SET(cf11[i], cf10[i], 0, 0, cf11[i], cf10[i], 0, 0);
-        _coeff[2][i] = _SET(cf21[i], cf20[i], 0, 0, cf21[i], cf20[i], 0, 0);
-      }
-
-      eval_4_isog_2x2x2x1w(_P, _coeff);
-
-      // extract results
-      get_channel_8x1w(pts[1]->X[0], _P, 6); get_channel_8x1w(pts[1]->X[1], _P, 7);
-      get_channel_8x1w(pts[1]->Z[0], _P, 4); get_channel_8x1w(pts[1]->Z[1], _P, 5);
-      get_channel_8x1w(pts[2]->X[0], _P, 2); get_channel_8x1w(pts[2]->X[1], _P, 3);
-      get_channel_8x1w(pts[2]->Z[0], _P, 0); get_channel_8x1w(pts[2]->Z[1], _P, 1);
-    }
+  for (i = 0; i < VNWORDS-1; i++) {
+    a[i+1] += a[i]>>VBRADIX;
+    a[i] &= VBMASK;
   }
-  // depends on public info
-  else if (num == 7 | num == 8 | num == 9 | num == 10 | num == 11) {
-    // 8x1x1x1w < pts[0] | pts[1] | pts[2] | pts[3] | pts[4] | phiP | phiQ | phiR >
-    vpoint_proj_t P;
-    vf2elm_t coeff[3];
-
-    // initialize vectors 
-    for (i = 0; i < VNWORDS; i++) {
-      P->X[0][i] = _SET(pts[0]->X[0][i], pts[1]->X[0][i], pts[2]->X[0][i], pts[3]->X[0][i], \
-                        pts[4]->X[0][i],   phiP->X[0][i],   phiQ->X[0][i],   phiR->X[0][i]);
-      P->X[1][i] = _SET(pts[0]->X[1][i], pts[1]->X[1][i], pts[2]->X[1][i], pts[3]->X[1][i], \
-                        pts[4]->X[1][i],   phiP->X[1][i],   phiQ->X[1][i],   phiR->X[1][i]);
-      P->Z[0][i] = _SET(pts[0]->Z[0][i], pts[1]->Z[0][i], pts[2]->Z[0][i], pts[3]->Z[0][i], \
-                        pts[4]->Z[0][i],   phiP->Z[0][i],   phiQ->Z[0][i],   phiR->Z[0][i]);
-      P->Z[1][i] = _SET(pts[0]->Z[1][i], pts[1]->Z[1][i], pts[2]->Z[1][i], pts[3]->Z[1][i], \
-                        pts[4]->Z[1][i],   phiP->Z[1][i],   phiQ->Z[1][i],   phiR->Z[1][i]);
-      coeff[0][0][i] = VSET1(cf00[i]); coeff[0][1][i] = VSET1(cf01[i]);
-      coeff[1][0][i] = VSET1(cf10[i]); coeff[1][1][i] = VSET1(cf11[i]);
-      coeff[2][0][i] = VSET1(cf20[i]); coeff[2][1][i] = VSET1(cf21[i]);
-    }
+}
 
-    eval_4_isog_8x1x1x1w(P, coeff);
-
-    // extract results
-    get_channel_8x1w(pts[0]->X[0], P->X[0], 7); get_channel_8x1w(pts[0]->X[1], P->X[1], 7);
-    get_channel_8x1w(pts[0]->Z[0], P->Z[0], 7); get_channel_8x1w(pts[0]->Z[1], P->Z[1], 7);
-    get_channel_8x1w(pts[1]->X[0], P->X[0], 6); get_channel_8x1w(pts[1]->X[1], P->X[1], 6);
-    get_channel_8x1w(pts[1]->Z[0], P->Z[0], 6); get_channel_8x1w(pts[1]->Z[1], P->Z[1], 6);
-    get_channel_8x1w(pts[2]->X[0], P->X[0], 5); get_channel_8x1w(pts[2]->X[1], P->X[1], 5);
-    get_channel_8x1w(pts[2]->Z[0], P->Z[0], 5); get_channel_8x1w(pts[2]->Z[1], P->Z[1], 5);
-    get_channel_8x1w(pts[3]->X[0], P->X[0], 4); get_channel_8x1w(pts[3]->X[1], P->X[1], 4);
-    get_channel_8x1w(pts[3]->Z[0], P->Z[0], 4); get_channel_8x1w(pts[3]->Z[1], P->Z[1], 4);
-    get_channel_8x1w(phiP->X[0], P->X[0], 2);   get_channel_8x1w(phiP->X[1], P->X[1], 2);
-    get_channel_8x1w(phiP->Z[0], P->Z[0], 2);   get_channel_8x1w(phiP->Z[1], P->Z[1], 2);
-    get_channel_8x1w(phiQ->X[0], P->X[0], 1);   get_channel_8x1w(phiQ->X[1], P->X[1], 1);
-    get_channel_8x1w(phiQ->Z[0], P->Z[0], 1);   get_channel_8x1w(phiQ->Z[1], P->Z[1], 1);
-    get_channel_8x1w(phiR->X[0], P->X[0], 0);   get_channel_8x1w(phiR->X[1], P->X[1], 0);
-    get_channel_8x1w(phiR->Z[0], P->Z[0], 0);   get_channel_8x1w(phiR->Z[1], P->Z[1], 0);
-
-    // depends on public info
-    if (num >= 8) {
-      get_channel_8x1w(pts[4]->X[0], P->X[0], 3); get_channel_8x1w(pts[4]->X[1], P->X[1], 3);
-      get_channel_8x1w(pts[4]->Z[0], P->Z[0], 3); get_channel_8x1w(pts[4]->Z[1], P->Z[1], 3);
-    }
+// carry propagation on a point in the 1x2x2x2w layout, giving each of X0, X1, 
+// Z0, Z1 the same representation as carryp_1w
+void carryp_1x2x2x2w(vgelm_t a)
+{
+  const __m512i mask = VSET1(VBMASK);
+  __m512i c;
+  __mmask8 m;
+  int i;
 
-    // depends on public info
-    if (num == 9) {
-      // 1x2x2x2w < pts[5] >
-      vgelm_t _P, _coeff[3];
-
-      // initialize vectors 
-      for (i = 0; i < VGWORDS-1; i++) {
-        _P[i] = _SET(pts[5]->X[1][i+VGWORDS], pts[5]->X[1][i], pts[5]->X[0][i+VGWORDS], pts[5]->X[0][i],\
-                     pts[5]->Z[1][i+VGWORDS], pts[5]->Z[1][i], pts[5]->Z[0][i+VGWORDS], pts[5]->Z[0][i]);
-        _coeff[0][i] = _SET(0, 0, 0, 0, cf01[i+VGWORDS], cf01[i], cf00[i+VGWORDS], cf00[i]); 
-        _coeff[1][i] = _SET(cf11[i+VGWORDS], cf11[i], cf10[i+VGWORDS], cf10[i], 0, 0, 0, 0); 
-        _coeff[2][i] = _SET(cf21[i+VGWORDS], cf21[i], cf20[i+VGWORDS], cf20[i], 0, 0, 0, 0); 
-      }
-      _P[i] = _SET(0, pts[5]->X[1][i], 0, pts[5]->X[0][i],\
-                   0, pts[5]->Z[1][i], 0, pts[5]->Z[0][i]);
-      _coeff[0][i] = _SET(0, 0, 0, 0, 0, cf01[i], 0, cf00[i]); 
-      _coeff[1][i] = _SET(0, cf11[i], 0, cf10[i], 0, 0, 0, 0); 
-      _coeff[2][i] = _SET(0, cf21[i], 0, cf20[i], 0, 0, 0, 0); 
-
-      eval_4_isog_1x2x2x2w(_P, _coeff);
-
-      // extract results
-      get_channel_4x2w(pts[5]->X[0], _P, 4); get_channel_4x2w(pts[5]->X[1], _P, 6);
-      get_channel_4x2w(pts[5]->Z[0], _P, 0); get_channel_4x2w(pts[5]->Z[1], _P, 2);
-
-      // carry propagation 
-      carryp_1w(pts[5]->X[0]); carryp_1w(pts[5]->X[1]); 
-      carryp_1w(pts[5]->Z[0]); carryp_1w(pts[5]->Z[1]); 
-    }
+  // limbs 0 -> ... -> VGWORDS-1 (even lanes) and VGWORDS -> ... -> VNWORDS-1 (odd lanes)
+  for (i = 0; i < VGWORDS-1; i++) {
+    m = (i < VNWORDS-VGWORDS-1) ? 0xFF : 0x55;
+    c = VSHR(a[i], VBRADIX);
+    a[i] = VMAND(a[i], m, a[i], mask);
+    a[i+1] = VMADD(a[i+1], m, a[i+1], c);
+  }
 
-    // depends on public info
-    if (num == 10) {
-      // 2x2x2x1w < pts[5] | pts[6] >
-      vfelm_t _P, _coeff[3];
-
-      for (i = 0; i < VNWORDS; i++) {
-        _P[i] = _SET(pts[5]->X[1][i], pts[5]->X[0][i], pts[5]->Z[1][i], pts[5]->Z[0][i], \
-                     pts[6]->X[1][i], pts[6]->X[0][i], pts[6]->Z[1][i], pts[6]->Z[0][i]);
-        _coeff[0][i] = _SET(0, 0, cf01[i], cf00[i], 0, 0, cf01[i], cf00[i]);
-        _coeff[1][i] = _SET(cf11[i], cf10[i], 0, 0, cf11[i], cf10[i], 0, 0);
-        _coeff[2][i] = _SET(cf21[i], cf20[i], 0, 0, cf21[i], cf20[i], 0, 0);
-      }
-
-      eval_4_isog_2x2x2x1w(_P, _coeff);
-
-      // extract results
-      get_channel_8x1w(pts[5]->X[0], _P, 6); get_channel_8x1w(pts[5]->X[1], _P, 7);
-      get_channel_8x1w(pts[5]->Z[0], _P, 4); get_channel_8x1w(pts[5]->Z[1], _P, 5);
-      get_channel_8x1w(pts[6]->X[0], _P, 2); get_channel_8x1w(pts[6]->X[1], _P, 3);
-      get_channel_8x1w(pts[6]->Z[0], _P, 0); get_channel_8x1w(pts[6]->Z[1], _P, 1);
-    }
+  // limb VGWORDS-1 (even lanes of a[VGWORDS-1]) -> limb VGWORDS (odd lanes of a[0])
+  c = VSHR(a[VGWORDS-1], VBRADIX);
+  a[VGWORDS-1] = VMAND(a[VGWORDS-1], 0x55, a[VGWORDS-1], mask);
+  a[0] = VMADD(a[0], 0xAA, a[0], VALIGNR(c, c, 7));
 
-    // depends on public info
-    if (num == 11) {
-      // 4x2x1x1w < pts[5] | pts[6] | pts[7] | % >
-      vf2elm_t _P, _coeff[3];
-
-      // initialize vectors 
-      for (i = 0; i < VNWORDS; i++) {
-        _P[0][i] = _SET(pts[5]->X[0][i], pts[5]->Z[0][i], pts[6]->X[0][i], pts[6]->Z[0][i], \
-                        pts[7]->X[0][i], pts[7]->Z[0][i],               0,               0);
-        _P[1][i] = _SET(pts[5]->X[1][i], pts[5]->Z[1][i], pts[6]->X[1][i], pts[6]->Z[1][i], \
-                        pts[7]->X[1][i], pts[7]->Z[1][i],               0,               0);
-        _coeff[0][0][i] = _SET(0, cf00[i], 0, cf00[i], 0, cf00[i], 0, cf00[i]);
-        _coeff[0][1][i] = _SET(0, cf01[i], 0, cf01[i], 0, cf01[i], 0, cf01[i]);
-        _coeff[1][0][i] = _SET(cf10[i], 0, cf10[i], 0, cf10[i], 0, cf10[i], 0);
-        _coeff[1][1][i] = _SET(cf11[i], 0, cf11[i], 0, cf11[i], 0, cf11[i], 0);
-        _coeff[2][0][i] = _SET(cf20[i], 0, cf20[i], 0, cf20[i], 0, cf20[i], 0);
-        _coeff[2][1][i] = _SET(cf21[i], 0, cf21[i], 0, cf21[i], 0, cf21[i], 0);
-      }
-
-      eval_4_isog_4x2x1x1w(_P, _coeff);
-
-      // extract results
-      get_channel_8x1w(pts[5]->X[0], _P[0], 7); get_channel_8x1w(pts[5]->X[1], _P[1], 7);
-      get_channel_8x1w(pts[5]->Z[0], _P[0], 6); get_channel_8x1w(pts[5]->Z[1], _P[1], 6);
-      get_channel_8x1w(pts[6]->X[0], _P[0], 5); get_channel_8x1w(pts[6]->X[1], _P[1], 5);
-      get_channel_8x1w(pts[6]->Z[0], _P[0], 4); get_channel_8x1w(pts[6]->Z[1], _P[1], 4);
-      get_channel_8x1w(pts[7]->X[0], _P[0], 3); get_channel_8x1w(pts[7]->X[1], _P[1], 3);
-      get_channel_8x1w(pts[7]->Z[0], _P[0], 2); get_channel_8x1w(pts[7]->Z[1], _P[1], 2);
-    }
-  }
-  // depends on public info
-  else {
-    puts("Error!");
+  // limbs VGWORDS -> ... -> VNWORDS-1 (odd lanes)
+  for (i = 0; i < VNWORDS-VGWORDS-1; i++) {
+    c = VSHR(a[i], VBRADIX);
+    a[i] = VMAND(a[i], 0xAA, a[i], mask);
+    a[i+1] = VMADD(a[i+1], 0xAA, a[i+1], c);
   }
+
+  // the limbs i+VGWORDS >= VNWORDS do not exist
+  for (i = VNWORDS-VGWORDS; i < VGWORDS; i++) a[i] = VZAND(0x55, a[i], a[i]);
 }
 
-void eval_4_isog_parallel_ss(point_proj_r51_t *pts, const vgelm_t coeff__0, const vgelm_t coeff2_1, const int num)
+void pointcopy_1x2x2x2w(vgelm_t r, const vgelm_t a)
 {
-  felm_r51_t cf00, cf01, cf10, cf11, cf20, cf21;
   int i;
 
-  // extract constants
-  get_channel_4x2w(cf00, coeff__0, 0); get_channel_4x2w(cf01, coeff__0, 2);
-  get_channel_4x2w(cf10, coeff2_1, 0); get_channel_4x2w(cf11, coeff2_1, 2);
-  get_channel_4x2w(cf20, coeff2_1, 4); get_channel_4x2w(cf21, coeff2_1, 6);
-
-  // carry propagation
-  carryp_1w(cf00); carryp_1w(cf01);
-  carryp_1w(cf10); carryp_1w(cf11);
-  carryp_1w(cf20); carryp_1w(cf21);
-
-  // depends on public info
-  if (num == 1) {
-    // 1x2x2x2w < pts[0] >
-    vgelm_t _P, _coeff[3];
-
-    // initialize vectors 
-    for (i = 0; i < VGWORDS-1; i++) {
-      _P[i] = _SET(pts[0]->X[1][i+VGWORDS], pts[0]->X[1][i], pts[0]->X[0][i+VGWORDS], pts[0]->X[0][i],\
-                   pts[0]->Z[1][i+VGWORDS], pts[0]->Z[1][i], pts[0]->Z[0][i+VGWORDS], pts[0]->Z[0][i]);
-      _coeff[0][i] = _SET(0, 0, 0, 0, cf01[i+VGWORDS], cf01[i], cf00[i+VGWORDS], cf00[i]); 
-      _coeff[1][i] = _SET(cf11[i+VGWORDS], cf11[i], cf10[i+VGWORDS], cf10[i], 0, 0, 0, 0); 
-      _coeff[2][i] = _SET(cf21[i+VGWORDS], cf21[i], cf20[i+VGWORDS], cf20[i], 0, 0, 0, 0); 
-    }
-    _P[i] = _SET(0, pts[0]->X[1][i], 0, pts[0]->X[0][i],\
-                 0, pts[0]->Z[1][i], 0, pts[0]->Z[0][i]);
-    _coeff[0][i] = _SET(0, 0, 0, 0, 0, cf01[i], 0, cf00[i]); 
-    _coeff[1][i] = _SET(0, cf11[i], 0, cf10[i], 0, 0, 0, 0); 
-    _coeff[2][i] = _SET(0, cf21[i], 0, cf20[i], 0, 0, 0, 0);
+  for (i = 0; i < VGWORDS; i++) r[i] = a[i];
+}
 
-    eval_4_isog_1x2x2x2w(_P, _coeff);
+void pointcopy_2x2x2x1w(vfelm_t r, const vfelm_t a)
+{
+  int i;
 
-    // extract results
-    get_channel_4x2w(pts[0]->X[0], _P, 4); get_channel_4x2w(pts[0]->X[1], _P, 6);
-    get_channel_4x2w(pts[0]->Z[0], _P, 0); get_channel_4x2w(pts[0]->Z[1], _P, 2);
+  for (i = 0; i < VNWORDS; i++) r[i] = a[i];
+}
 
-    // carry propagation 
-    carryp_1w(pts[0]->X[0]); carryp_1w(pts[0]->X[1]); 
-    carryp_1w(pts[0]->Z[0]); carryp_1w(pts[0]->Z[1]);  
-  }
-  // depends on public info
-  else if (num == 2) {
-    // 2x2x2x1w < pts[0] | pts[1] >
-    vfelm_t _P, _coeff[3];
-
-    for (i = 0; i < VNWORDS; i++) {
-      _P[i] = _SET(pts[0]->X[1][i], pts[0]->X[0][i], pts[0]->Z[1][i], pts[0]->Z[0][i], \
-                   pts[1]->X[1][i], pts[1]->X[0][i], pts[1]->Z[1][i], pts[1]->Z[0][i]);
-      _coeff[0][i] = _SET(0, 0, cf01[i], cf00[i], 0, 0, cf01[i], cf00[i]);
-      _coeff[1][i] = _SET(cf11[i], cf10[i], 0, 0, cf11[i], cf10[i], 0, 0);
-      _coeff[2][i] = _SET(cf21[i], cf20[i], 0, 0, cf21[i], cf20[i], 0, 0);
-    }
+// r = < X1' | X1 | X0' | X0 | Z1' | Z1 | Z0' | Z0 > 
+void pack_point_1x2x2x2w(vgelm_t r, const point_proj_r51_t P)
+{
+  int i;
 
-    eval_4_isog_2x2x2x1w(_P, _coeff);
+  for (i = 0; i < VNWORDS-VGWORDS; i++) 
+    r[i] = _SET(P->X[1][i+VGWORDS], P->X[1][i], P->X[0][i+VGWORDS], P->X[0][i], \
+                P->Z[1][i+VGWORDS], P->Z[1][i], P->Z[0][i+VGWORDS], P->Z[0][i]);
+  for (; i < VGWORDS; i++) 
+    r[i] = _SET(0, P->X[1][i], 0, P->X[0][i], \
+                0, P->Z[1][i], 0, P->Z[0][i]);
+}
 
-    // extract results
-    get_channel_8x1w(pts[0]->X[0], _P, 6); get_channel_8x1w(pts[0]->X[1], _P, 7);
-    get_channel_8x1w(pts[0]->Z[0], _P, 4); get_channel_8x1w(pts[0]->Z[1], _P, 5);
-    get_channel_8x1w(pts[1]->X[0], _P, 2); get_channel_8x1w(pts[1]->X[1], _P, 3);
-    get_channel_8x1w(pts[1]->Z[0], _P, 0); get_channel_8x1w(pts[1]->Z[1], _P, 1);
-  }
-  // depends on public info
-  else if (num == 3 | num == 4 | num == 5 | num == 6) {
-    // 4x2x1x1w < pts[0] | pts[1] | pts[2] | pts[3] >
-    vf2elm_t P, coeff[3];
-
-    // initialize vectors 
-    for (i = 0; i < VNWORDS; i++) {
-      P[0][i] = _SET(pts[0]->X[0][i], pts[0]->Z[0][i], pts[1]->X[0][i], pts[1]->Z[0][i], \
-                     pts[2]->X[0][i], pts[2]->Z[0][i], pts[3]->X[0][i], pts[3]->Z[0][i]);
-      P[1][i] = _SET(pts[0]->X[1][i], pts[0]->Z[1][i], pts[1]->X[1][i], pts[1]->Z[1][i], \
-                     pts[2]->X[1][i], pts[2]->Z[1][i], pts[3]->X[1][i], pts[3]->Z[1][i]);
-      coeff[0][0][i] = _SET(0, cf00[i], 0, cf00[i], 0, cf00[i], 0, cf00[i]);
-      coeff[0][1][i] = _SET(0, cf01[i], 0, cf01[i], 0, cf01[i], 0, cf01[i]);
-      coeff[1][0][i] = _SET(cf10[i], 0, cf10[i], 0, cf10[i], 0, cf10[i], 0);
-      coeff[1][1][i] = _SET(cf11[i], 0, cf11[i], 0, cf11[i], 0, cf11[i], 0);
-      coeff[2][0][i] = _SET(cf20[i], 0, cf20[i], 0, cf20[i], 0, cf20[i], 0);
-      coeff[2][1][i] = _SET(cf21[i], 0, cf21[i], 0, cf21[i], 0, cf21[i], 0);
-    }
+void unpack_point_1x2x2x2w(point_proj_r51_t P, const vgelm_t a)
+{
+  get_channel_4x2w(P->X[0], a, 4); get_channel_4x2w(P->X[1], a, 6);
+  get_channel_4x2w(P->Z[0], a, 0); get_channel_4x2w(P->Z[1], a, 2);
+}
 
-    eval_4_isog_4x2x1x1w(P, coeff);
+// r = < X1 | X0 | Z1 | Z0 | _X1 | _X0 | _Z1 | _Z0 > 
+void pack_points_2x2x2x1w(vfelm_t r, const point_proj_r51_t P, const point_proj_r51_t _P)
+{
+  int i;
 
-    // extract results
-    get_channel_8x1w(pts[0]->X[0], P[0], 7); get_channel_8x1w(pts[0]->X[1], P[1], 7);
-    get_channel_8x1w(pts[0]->Z[0], P[0], 6); get_channel_8x1w(pts[0]->Z[1], P[1], 6);
-    get_channel_8x1w(pts[1]->X[0], P[0], 5); get_channel_8x1w(pts[1]->X[1], P[1], 5);
-    get_channel_8x1w(pts[1]->Z[0], P[0], 4); get_channel_8x1w(pts[1]->Z[1], P[1], 4);
-    get_channel_8x1w(pts[2]->X[0], P[0], 3); get_channel_8x1w(pts[2]->X[1], P[1], 3);
-    get_channel_8x1w(pts[2]->Z[0], P[0], 2); get_channel_8x1w(pts[2]->Z[1], P[1], 2);
+  for (i = 0; i < VNWORDS; i++) 
+    r[i] = _SET( P->X[1][i],  P->X[0][i],  P->Z[1][i],  P->Z[0][i], \
+                _P->X[1][i], _P->X[0][i], _P->Z[1][i], _P->Z[0][i]);
+}
 
-    // depends on public info
-    if (num >= 4) {
-      get_channel_8x1w(pts[3]->X[0], P[0], 1); get_channel_8x1w(pts[3]->X[1], P[1], 1);
-      get_channel_8x1w(pts[3]->Z[0], P[0], 0); get_channel_8x1w(pts[3]->Z[1], P[1], 0);
-    }
+// extract the upper (ch = 4) or the lower (ch = 0) point of a 
+void unpack_point_2x2x2x1w(point_proj_r51_t P, const vfelm_t a, const int ch)
+{
+  get_channel_8x1w(P->X[0], a, ch+2); get_channel_8x1w(P->X[1], a, ch+3);
+  get_channel_8x1w(P->Z[0], a, ch+0); get_channel_8x1w(P->Z[1], a, ch+1);
+}
 
-    // depends on public info
-    if (num == 5) {
-      // 1x2x2x2w < pts[4] >
-      vgelm_t _P, _coeff[3];
-
-      // initialize vectors 
-      for (i = 0; i < VGWORDS-1; i++) {
-        _P[i] = _SET(pts[4]->X[1][i+VGWORDS], pts[4]->X[1][i], pts[4]->X[0][i+VGWORDS], pts[4]->X[0][i],\
-                     pts[4]->Z[1][i+VGWORDS], pts[4]->Z[1][i], pts[4]->Z[0][i+VGWORDS], pts[4]->Z[0][i]);
-        _coeff[0][i] = _SET(0, 0, 0, 0, cf01[i+VGWORDS], cf01[i], cf00[i+VGWORDS], cf00[i]); 
-        _coeff[1][i] = _SET(cf11[i+VGWORDS], cf11[i], cf10[i+VGWORDS], cf10[i], 0, 0, 0, 0); 
-        _coeff[2][i] = _SET(cf21[i+VGWORDS], cf21[i], cf20[i+VGWORDS], cf20[i], 0, 0, 0, 0); 
-      }
-      _P[i] = _SET(0, pts[4]->X[1][i], 0, pts[4]->X[0][i],\
-                   0, pts[4]->Z[1][i], 0, pts[4]->Z[0][i]);
-      _coeff[0][i] = _SET(0, 0, 0, 0, 0, cf01[i], 0, cf00[i]); 
-      _coeff[1][i] = _SET(0, cf11[i], 0, cf10[i], 0, 0, 0, 0); 
-      _coeff[2][i] = _SET(0, cf21[i], 0, cf20[i], 0, 0, 0, 0);
-
-      eval_4_isog_1x2x2x2w(_P, _coeff);
-
-      // extract results
-      get_channel_4x2w(pts[4]->X[0], _P, 4); get_channel_4x2w(pts[4]->X[1], _P, 6);
-      get_channel_4x2w(pts[4]->Z[0], _P, 0); get_channel_4x2w(pts[4]->Z[1], _P, 2);
-
-      // carry propagation 
-      carryp_1w(pts[4]->X[0]); carryp_1w(pts[4]->X[1]); 
-      carryp_1w(pts[4]->Z[0]); carryp_1w(pts[4]->Z[1]);  
-    }
+// the output vP is strictly in radix-2^51
+void xDBLe_1x2x2x2w(const vgelm_t vP, vgelm_t vQ, const vgelm_t C24_A24plus, const int e)
+{
+  int i;
 
-    // depends on public info
-    if (num == 6) {
-      // 2x2x2x1w < pts[4] | pts[5] >
-      vfelm_t _P, _coeff[3];
-
-      for (i = 0; i < VNWORDS; i++) {
-        _P[i] = _SET(pts[4]->X[1][i], pts[4]->X[0][i], pts[4]->Z[1][i], pts[4]->Z[0][i], \
-                     pts[5]->X[1][i], pts[5]->X[0][i], pts[5]->Z[1][i], pts[5]->Z[0][i]);
-        _coeff[0][i] = _SET(0, 0, cf01[i], cf00[i], 0, 0, cf01[i], cf00[i]);
-        _coeff[1][i] = _SET(cf11[i], cf10[i], 0, 0, cf11[i], cf10[i], 0, 0);
-        _coeff[2][i] = _SET(cf21[i], cf20[i], 0, 0, cf21[i], cf20[i], 0, 0);
-      }
-
-      eval_4_isog_2x2x2x1w(_P, _coeff);
-
-      // extract results
-      get_channel_8x1w(pts[4]->X[0], _P, 6); get_channel_8x1w(pts[4]->X[1], _P, 7);
-      get_channel_8x1w(pts[4]->Z[0], _P, 4); get_channel_8x1w(pts[4]->Z[1], _P, 5);
-      get_channel_8x1w(pts[5]->X[0], _P, 2); get_channel_8x1w(pts[5]->X[1], _P, 3);
-      get_channel_8x1w(pts[5]->Z[0], _P, 0); get_channel_8x1w(pts[5]->Z[1], _P, 1);
-    }
-  }
-  // depends on public info
-  else if (num == 7 | num == 8) {
-    // 8x1x1x1w < pts[0] | pts[1] | pts[2] | pts[3] | pts[4] | pts[5] | pts[6] | pts[7] >
-    vpoint_proj_t P;
-    vf2elm_t coeff[3];
-
-    // initialize vectors 
-    for (i = 0; i < VNWORDS; i++) {
-      P->X[0][i] = _SET(pts[0]->X[0][i], pts[1]->X[0][i], pts[2]->X[0][i], pts[3]->X[0][i], \
-                        pts[4]->X[0][i], pts[5]->X[0][i], pts[6]->X[0][i], pts[7]->X[0][i]);
-      P->X[1][i] = _SET(pts[0]->X[1][i], pts[1]->X[1][i], pts[2]->X[1][i], pts[3]->X[1][i], \
-                        pts[4]->X[1][i], pts[5]->X[1][i], pts[6]->X[1][i], pts[7]->X[1][i]);
-      P->Z[0][i] = _SET(pts[0]->Z[0][i], pts[1]->Z[0][i], pts[2]->Z[0][i], pts[3]->Z[0][i], \
-                        pts[4]->Z[0][i], pts[5]->Z[0][i], pts[6]->Z[0][i], pts[7]->Z[0][i]);
-      P->Z[1][i] = _SET(pts[0]->Z[1][i], pts[1]->Z[1][i], pts[2]->Z[1][i], pts[3]->Z[1][i], \
-                        pts[4]->Z[1][i], pts[5]->Z[1][i], pts[6]->Z[1][i], pts[7]->Z[1][i]);
-      coeff[0][0][i] = VSET1(cf00[i]); coeff[0][1][i] = VSET1(cf01[i]);
-      coeff[1][0][i] = VSET1(cf10[i]); coeff[1][1][i] = VSET1(cf11[i]);
-      coeff[2][0][i] = VSET1(cf20[i]); coeff[2][1][i] = VSET1(cf21[i]);
-    }
+  if (e == 0) pointcopy_1x2x2x2w(vQ, vP);
+  else xDBL_1x2x2x2w(vP, vQ, C24_A24plus);
+  for (i = 1; i < e; i++) xDBL_1x2x2x2w(vQ, vQ, C24_A24plus);
 
-    eval_4_isog_8x1x1x1w(P, coeff);
-
-    // extract results
-    get_channel_8x1w(pts[0]->X[0], P->X[0], 7); get_channel_8x1w(pts[0]->X[1], P->X[1], 7);
-    get_channel_8x1w(pts[0]->Z[0], P->Z[0], 7); get_channel_8x1w(pts[0]->Z[1], P->Z[1], 7);
-    get_channel_8x1w(pts[1]->X[0], P->X[0], 6); get_channel_8x1w(pts[1]->X[1], P->X[1], 6);
-    get_channel_8x1w(pts[1]->Z[0], P->Z[0], 6); get_channel_8x1w(pts[1]->Z[1], P->Z[1], 6);
-    get_channel_8x1w(pts[2]->X[0], P->X[0], 5); get_channel_8x1w(pts[2]->X[1], P->X[1], 5);
-    get_channel_8x1w(pts[2]->Z[0], P->Z[0], 5); get_channel_8x1w(pts[2]->Z[1], P->Z[1], 5);
-    get_channel_8x1w(pts[3]->X[0], P->X[0], 4); get_channel_8x1w(pts[3]->X[1], P->X[1], 4);
-    get_channel_8x1w(pts[3]->Z[0], P->Z[0], 4); get_channel_8x1w(pts[3]->Z[1], P->Z[1], 4);
-    get_channel_8x1w(pts[4]->X[0], P->X[0], 3); get_channel_8x1w(pts[4]->X[1], P->X[1], 3);
-    get_channel_8x1w(pts[4]->Z[0], P->Z[0], 3); get_channel_8x1w(pts[4]->Z[1], P->Z[1], 3);
-    get_channel_8x1w(pts[5]->X[0], P->X[0], 2); get_channel_8x1w(pts[5]->X[1], P->X[1], 2);
-    get_channel_8x1w(pts[5]->Z[0], P->Z[0], 2); get_channel_8x1w(pts[5]->Z[1], P->Z[1], 2);
-    get_channel_8x1w(pts[6]->X[0], P->X[0], 1); get_channel_8x1w(pts[6]->X[1], P->X[1], 1);
-    get_channel_8x1w(pts[6]->Z[0], P->Z[0], 1); get_channel_8x1w(pts[6]->Z[1], P->Z[1], 1);
-
-    // depends on public info
-    if (num == 8) {
-      get_channel_8x1w(pts[7]->X[0], P->X[0], 0); get_channel_8x1w(pts[7]->X[1], P->X[1], 0);
-      get_channel_8x1w(pts[7]->Z[0], P->Z[0], 0); get_channel_8x1w(pts[7]->Z[1], P->Z[1], 0);
-    }
-  }
-  // depends on public info
-  else {
-    puts("Error!");    
-  }
+  carryp_1x2x2x2w(vQ);
 }
 
-void eval_4_isog_parallel_kgss(point_proj_r51_t *pts, point_proj_r51_t *_pts, point_proj_r51_t phiP, point_proj_r51_t phiQ, point_proj_r51_t phiR, const vfelm_t coeff__0, const vfelm_t coeff2_1, const int num)
+void xDBLe_2x2x2x1w(const vfelm_t vP, vfelm_t vQ, const vfelm_t C24_A24plus, const int e)
 {
-  felm_r51_t cf00, cf01, cf10, cf11, cf20, cf21;
-  felm_r51_t _cf00, _cf01, _cf10, _cf11, _cf20, _cf21;
   int i;
 
-  // extract constants
-  get_channel_8x1w(cf00, coeff__0, 4); get_channel_8x1w(cf01, coeff__0, 5);
-  get_channel_8x1w(cf10, coeff2_1, 4); get_channel_8x1w(cf11, coeff2_1, 5);
-  get_channel_8x1w(cf20, coeff2_1, 6); get_channel_8x1w(cf21, coeff2_1, 7);
-  get_channel_8x1w(_cf00, coeff__0, 0); get_channel_8x1w(_cf01, coeff__0, 1);
-  get_channel_8x1w(_cf10, coeff2_1, 0); get_channel_8x1w(_cf11, coeff2_1, 1);
-  get_channel_8x1w(_cf20, coeff2_1, 2); get_channel_8x1w(_cf21, coeff2_1, 3);
-
-  // num = 2*npts+3 could be 3, 5, 7, 9, 11, 13, 15, 17, 19
-  // depends on public info
-  if (num == 3 | num == 5) {
-    // 4x2x1x1w < pts[0] | phiP | phiQ | phiR >
-    vf2elm_t P, coeff[3];
-
-    // initialize vectors 
-    for (i = 0; i < VNWORDS; i++) {
-      P[0][i] = _SET(pts[0]->X[0][i], pts[0]->Z[0][i], phiP->X[0][i], phiP->Z[0][i], \
-                       phiQ->X[0][i],   phiQ->Z[0][i], phiR->X[0][i], phiR->Z[0][i]);
-      P[1][i] = _SET(pts[0]->X[1][i], pts[0]->Z[1][i], phiP->X[1][i], phiP->Z[1][i], \
-                       phiQ->X[1][i],   phiQ->Z[1][i], phiR->X[1][i], phiR->Z[1][i]);
-      coeff[0][0][i] = _SET(0, cf00[i], 0, cf00[i], 0, cf00[i], 0, cf00[i]);
-      coeff[0][1][i] = _SET(0, cf01[i], 0, cf01[i], 0, cf01[i], 0, cf01[i]);
-      coeff[1][0][i] = _SET(cf10[i], 0, cf10[i], 0, cf10[i], 0, cf10[i], 0);
-      coeff[1][1][i] = _SET(cf11[i], 0, cf11[i], 0, cf11[i], 0, cf11[i], 0);
-      coeff[2][0][i] = _SET(cf20[i], 0, cf20[i], 0, cf20[i], 0, cf20[i], 0);
-      coeff[2][1][i] = _SET(cf21[i], 0, cf21[i], 0, cf21[i], 0, cf21[i], 0);
-    }
+  if (e == 0) pointcopy_2x2x2x1w(vQ, vP);
+  else xDBL_2x2x2x1w(vP, vQ, C24_A24plus);
+  for (i = 1; i < e; i++) xDBL_2x2x2x1w(vQ, vQ, C24_A24plus);
+}
 
-    eval_4_isog_4x2x1x1w(P, coeff);
-
-    // extract results
-    get_channel_8x1w(phiP->X[0], P[0], 5);   get_channel_8x1w(phiP->X[1], P[1], 5);
-    get_channel_8x1w(phiP->Z[0], P[0], 4);   get_channel_8x1w(phiP->Z[1], P[1], 4);
-    get_channel_8x1w(phiQ->X[0], P[0], 3);   get_channel_8x1w(phiQ->X[1], P[1], 3);
-    get_channel_8x1w(phiQ->Z[0], P[0], 2);   get_channel_8x1w(phiQ->Z[1], P[1], 2);
-    get_channel_8x1w(phiR->X[0], P[0], 1);   get_channel_8x1w(phiR->X[1], P[1], 1);
-    get_channel_8x1w(phiR->Z[0], P[0], 0);   get_channel_8x1w(phiR->Z[1], P[1], 0);
-
-    // depends on public info
-    if (num == 5) {
-      get_channel_8x1w(pts[0]->X[0], P[0], 7); get_channel_8x1w(pts[0]->X[1], P[1], 7);
-      get_channel_8x1w(pts[0]->Z[0], P[0], 6); get_channel_8x1w(pts[0]->Z[1], P[1], 6);
-
-      // 1x2x2x2w < _pts[0] >
-      vgelm_t _P, _coeff[3];
-
-      // initialize vectors 
-      for (i = 0; i < VGWORDS-1; i++) {
-        _P[i] = _SET(_pts[0]->X[1][i+VGWORDS], _pts[0]->X[1][i], _pts[0]->X[0][i+VGWORDS], _pts[0]->X[0][i],\
-                     _pts[0]->Z[1][i+VGWORDS], _pts[0]->Z[1][i], _pts[0]->Z[0][i+VGWORDS], _pts[0]->Z[0][i]);
-        _coeff[0][i] = _SET(0, 0, 0, 0, _cf01[i+VGWORDS], _cf01[i], _cf00[i+VGWORDS], _cf00[i]); 
-        _coeff[1][i] = _SET(_cf11[i+VGWORDS], _cf11[i], _cf10[i+VGWORDS], _cf10[i], 0, 0, 0, 0); 
-        _coeff[2][i] = _SET(_cf21[i+VGWORDS], _cf21[i], _cf20[i+VGWORDS], _cf20[i], 0, 0, 0, 0); 
-      }
-      _P[i] = _SET(0, _pts[0]->X[1][i], 0, _pts[0]->X[0][i],\
-                   0, _pts[0]->Z[1][i], 0, _pts[0]->Z[0][i]);
-      _coeff[0][i] = _SET(0, 0, 0, 0, 0, _cf01[i], 0, _cf00[i]); 
-      _coeff[1][i] = _SET(0, _cf11[i], 0, _cf10[i], 0, 0, 0, 0); 
-      _coeff[2][i] = _SET(0, _cf21[i], 0, _cf20[i], 0, 0, 0, 0); 
-
-      eval_4_isog_1x2x2x2w(_P, _coeff);
-
-      // extract results
-      get_channel_4x2w(_pts[0]->X[0], _P, 4); get_channel_4x2w(_pts[0]->X[1], _P, 6);
-      get_channel_4x2w(_pts[0]->Z[0], _P, 0); get_channel_4x2w(_pts[0]->Z[1], _P, 2);
-
-      // carry propagation 
-      carryp_1w(_pts[0]->X[0]); carryp_1w(_pts[0]->X[1]); 
-      carryp_1w(_pts[0]->Z[0]); carryp_1w(_pts[0]->Z[1]);  
-    }
-  }
-  // depends on public info
-  else if (num == 7 | num == 9 | num == 11 | num == 13 | num == 15 | num == 17 | num == 19) {
-    // 8x1x1x1w < _pts[0] | _pts[1] | pts[0] | pts[1] | pts[2] | phiP | phiQ | phiR >
-    vpoint_proj_t P;
-    vf2elm_t coeff[3];
-
-    // initialize vectors 
-    for (i = 0; i < VNWORDS; i++) {
-      P->X[0][i] = _SET(_pts[0]->X[0][i], _pts[1]->X[0][i], pts[0]->X[0][i], pts[1]->X[0][i], \
-                         pts[2]->X[0][i],    phiP->X[0][i],   phiQ->X[0][i],   phiR->X[0][i]);
-      P->X[1][i] = _SET(_pts[0]->X[1][i], _pts[1]->X[1][i], pts[0]->X[1][i], pts[1]->X[1][i], \
-                         pts[2]->X[1][i],    phiP->X[1][i],   phiQ->X[1][i],   phiR->X[1][i]);
-      P->Z[0][i] = _SET(_pts[0]->Z[0][i], _pts[1]->Z[0][i], pts[0]->Z[0][i], pts[1]->Z[0][i], \
-                         pts[2]->Z[0][i],    phiP->Z[0][i],   phiQ->Z[0][i],   phiR->Z[0][i]);
-      P->Z[1][i] = _SET(_pts[0]->Z[1][i], _pts[1]->Z[1][i], pts[0]->Z[1][i], pts[1]->Z[1][i], \
-                         pts[2]->Z[1][i],    phiP->Z[1][i],   phiQ->Z[1][i],   phiR->Z[1][i]);
-      coeff[0][0][i] = _SET(_cf00[i], _cf00[i], cf00[i], cf00[i], cf00[i], cf00[i], cf00[i], cf00[i]); 
-      coeff[0][1][i] = _SET(_cf01[i], _cf01[i], cf01[i], cf01[i], cf01[i], cf01[i], cf01[i], cf01[i]);
-      coeff[1][0][i] = _SET(_cf10[i], _cf10[i], cf10[i], cf10[i], cf10[i], cf10[i], cf10[i], cf10[i]); 
-      coeff[1][1][i] = _SET(_cf11[i], _cf11[i], cf11[i], cf11[i], cf11[i], cf11[i], cf11[i], cf11[i]);
-      coeff[2][0][i] = _SET(_cf20[i], _cf20[i], cf20[i], cf20[i], cf20[i], cf20[i], cf20[i], cf20[i]); 
-      coeff[2][1][i] = _SET(_cf21[i], _cf21[i], cf21[i], cf21[i], cf21[i], cf21[i], cf21[i], cf21[i]);
-    }
+// ----------------------------------------------------------------------------
+// lane packer for the parallel isogeny evaluations 
+// 
+// The points to be evaluated are split into batches according to lane_sched 
+// and each batch is loaded into the lanes of one 8x1x1x1w, 4x2x1x1w, 2x2x2x1w 
+// or 1x2x2x2w vector set with masked gathers (and stored back with masked 
+// scatters). The points stay in the vector form used by the tree traversal: 
+// either one point per vgelm_t (1x2x2x2w) or one point per half of a vfelm_t 
+// (2x2x2x1w). Lane j of the v-th vector of a layout holds the limb 
+// (vec_limb + lane_limb[layout][j]) of the field (vec_field + 
+// lane_field[layout][j]) of the point lane_slot[layout][j] of the batch, where 
+// Z0, Z1, X0, X1 are the fields 0, 1, 2, 3. The coefficients are gathered from 
+// a table of f2elm_r51_t, so two isogenies (kgss) can share one vector set. 
 
-    eval_4_isog_8x1x1x1w(P, coeff);
-
-    // extract results
-    get_channel_8x1w(_pts[0]->X[0], P->X[0], 7); get_channel_8x1w(_pts[0]->X[1], P->X[1], 7);
-    get_channel_8x1w(_pts[0]->Z[0], P->Z[0], 7); get_channel_8x1w(_pts[0]->Z[1], P->Z[1], 7);
-    get_channel_8x1w(_pts[1]->X[0], P->X[0], 6); get_channel_8x1w(_pts[1]->X[1], P->X[1], 6);
-    get_channel_8x1w(_pts[1]->Z[0], P->Z[0], 6); get_channel_8x1w(_pts[1]->Z[1], P->Z[1], 6);
-    get_channel_8x1w(pts[0]->X[0], P->X[0], 5); get_channel_8x1w(pts[0]->X[1], P->X[1], 5);
-    get_channel_8x1w(pts[0]->Z[0], P->Z[0], 5); get_channel_8x1w(pts[0]->Z[1], P->Z[1], 5);
-    get_channel_8x1w(pts[1]->X[0], P->X[0], 4); get_channel_8x1w(pts[1]->X[1], P->X[1], 4);
-    get_channel_8x1w(pts[1]->Z[0], P->Z[0], 4); get_channel_8x1w(pts[1]->Z[1], P->Z[1], 4);
-    get_channel_8x1w(phiP->X[0], P->X[0], 2);   get_channel_8x1w(phiP->X[1], P->X[1], 2);
-    get_channel_8x1w(phiP->Z[0], P->Z[0], 2);   get_channel_8x1w(phiP->Z[1], P->Z[1], 2);
-    get_channel_8x1w(phiQ->X[0], P->X[0], 1);   get_channel_8x1w(phiQ->X[1], P->X[1], 1);
-    get_channel_8x1w(phiQ->Z[0], P->Z[0], 1);   get_channel_8x1w(phiQ->Z[1], P->Z[1], 1);
-    get_channel_8x1w(phiR->X[0], P->X[0], 0);   get_channel_8x1w(phiR->X[1], P->X[1], 0);
-    get_channel_8x1w(phiR->Z[0], P->Z[0], 0);   get_channel_8x1w(phiR->Z[1], P->Z[1], 0);
-
-    // depends on public info
-    if (num >= 9) {
-      get_channel_8x1w(pts[2]->X[0], P->X[0], 3); get_channel_8x1w(pts[2]->X[1], P->X[1], 3);
-      get_channel_8x1w(pts[2]->Z[0], P->Z[0], 3); get_channel_8x1w(pts[2]->Z[1], P->Z[1], 3);
-    }
+#define LAYOUT_8x1x1x1w   0
+#define LAYOUT_4x2x1x1w   1
+#define LAYOUT_2x2x2x1w   2
+#define LAYOUT_1x2x2x2w   3
 
-    // depends on public info
-    if (num == 9) {
-      // 1x2x2x2w < _pts[2] >       
-      vgelm_t _P, _coeff[3];
-
-      // initialize vectors 
-      for (i = 0; i < VGWORDS-1; i++) {
-        _P[i] = _SET(_pts[2]->X[1][i+VGWORDS], _pts[2]->X[1][i], _pts[2]->X[0][i+VGWORDS], _pts[2]->X[0][i],\
-                     _pts[2]->Z[1][i+VGWORDS], _pts[2]->Z[1][i], _pts[2]->Z[0][i+VGWORDS], _pts[2]->Z[0][i]);
-        _coeff[0][i] = _SET(0, 0, 0, 0, _cf01[i+VGWORDS], _cf01[i], _cf00[i+VGWORDS], _cf00[i]); 
-        _coeff[1][i] = _SET(_cf11[i+VGWORDS], _cf11[i], _cf10[i+VGWORDS], _cf10[i], 0, 0, 0, 0); 
-        _coeff[2][i] = _SET(_cf21[i+VGWORDS], _cf21[i], _cf20[i+VGWORDS], _cf20[i], 0, 0, 0, 0); 
-      }
-      _P[i] = _SET(0, _pts[2]->X[1][i], 0, _pts[2]->X[0][i],\
-                    0, _pts[2]->Z[1][i], 0, _pts[2]->Z[0][i]);
-      _coeff[0][i] = _SET(0, 0, 0, 0, 0, _cf01[i], 0, _cf00[i]); 
-      _coeff[1][i] = _SET(0, _cf11[i], 0, _cf10[i], 0, 0, 0, 0); 
-      _coeff[2][i] = _SET(0, _cf21[i], 0, _cf20[i], 0, 0, 0, 0); 
-
-      eval_4_isog_1x2x2x2w(_P, _coeff);    
-
-      // extract results
-      get_channel_4x2w(_pts[2]->X[0], _P, 4); get_channel_4x2w(_pts[2]->X[1], _P, 6);
-      get_channel_4x2w(_pts[2]->Z[0], _P, 0); get_channel_4x2w(_pts[2]->Z[1], _P, 2);
-
-      // carry propagation 
-      carryp_1w(_pts[2]->X[0]); carryp_1w(_pts[2]->X[1]); 
-      carryp_1w(_pts[2]->Z[0]); carryp_1w(_pts[2]->Z[1]); 
-    }
+#define PTFMT_1x2x2x2w    0
+#define PTFMT_2x2x2x1w    1
 
-    // depends on public info
-    if (num == 11 | num == 13) {
-      // 4x2x1x1w < _pts[2] | _pts[3] | pts[3] | pts[4] >
-      vf2elm_t _P, _coeff[3];
-
-      // initialize vectors 
-      for (i = 0; i < VNWORDS; i++) {
-        _P[0][i] = _SET(_pts[2]->X[0][i], _pts[2]->Z[0][i], _pts[3]->X[0][i], _pts[3]->Z[0][i], \
-                         pts[3]->X[0][i],  pts[3]->Z[0][i],  pts[4]->X[0][i],  pts[4]->Z[0][i]);
-        _P[1][i] = _SET(_pts[2]->X[1][i], _pts[2]->Z[1][i], _pts[3]->X[1][i], _pts[3]->Z[1][i], \
-                         pts[3]->X[1][i],  pts[3]->Z[1][i],  pts[4]->X[1][i],  pts[4]->Z[1][i]);
-        _coeff[0][0][i] = _SET(0, _cf00[i], 0, _cf00[i], 0, cf00[i], 0, cf00[i]);
-        _coeff[0][1][i] = _SET(0, _cf01[i], 0, _cf01[i], 0, cf01[i], 0, cf01[i]);
-        _coeff[1][0][i] = _SET(_cf10[i], 0, _cf10[i], 0, cf10[i], 0, cf10[i], 0);
-        _coeff[1][1][i] = _SET(_cf11[i], 0, _cf11[i], 0, cf11[i], 0, cf11[i], 0);
-        _coeff[2][0][i] = _SET(_cf20[i], 0, _cf20[i], 0, cf20[i], 0, cf20[i], 0);
-        _coeff[2][1][i] = _SET(_cf21[i], 0, _cf21[i], 0, cf21[i], 0, cf21[i], 0);
-      }
-
-      eval_4_isog_4x2x1x1w(_P, _coeff);
-
-      // extract results
-      get_channel_8x1w(_pts[2]->X[0], _P[0], 7); get_channel_8x1w(_pts[2]->X[1], _P[1], 7);
-      get_channel_8x1w(_pts[2]->Z[0], _P[0], 6); get_channel_8x1w(_pts[2]->Z[1], _P[1], 6);
-      get_channel_8x1w(_pts[3]->X[0], _P[0], 5); get_channel_8x1w(_pts[3]->X[1], _P[1], 5);
-      get_channel_8x1w(_pts[3]->Z[0], _P[0], 4); get_channel_8x1w(_pts[3]->Z[1], _P[1], 4);
-      get_channel_8x1w(pts[3]->X[0], _P[0], 3); get_channel_8x1w(pts[3]->X[1], _P[1], 3);
-      get_channel_8x1w(pts[3]->Z[0], _P[0], 2); get_channel_8x1w(pts[3]->Z[1], _P[1], 2);
-
-      // depends on public info
-      if (num == 13) {
-        get_channel_8x1w(pts[4]->X[0], _P[0], 1); get_channel_8x1w(pts[4]->X[1], _P[1], 1);
-        get_channel_8x1w(pts[4]->Z[0], _P[0], 0); get_channel_8x1w(pts[4]->Z[1], _P[1], 0);
-
-        // 1x2x2x2w < _pts[4] >
-        vgelm_t __P, __coeff[3];
-
-        // initialize vectors 
-        for (i = 0; i < VGWORDS-1; i++) {
-          __P[i] = _SET(_pts[4]->X[1][i+VGWORDS], _pts[4]->X[1][i], _pts[4]->X[0][i+VGWORDS], _pts[4]->X[0][i],\
-                        _pts[4]->Z[1][i+VGWORDS], _pts[4]->Z[1][i], _pts[4]->Z[0][i+VGWORDS], _pts[4]->Z[0][i]);
-          __coeff[0][i] = _SET(0, 0, 0, 0, _cf01[i+VGWORDS], _cf01[i], _cf00[i+VGWORDS], _cf00[i]); 
-          __coeff[1][i] = _SET(_cf11[i+VGWORDS], _cf11[i], _cf10[i+VGWORDS], _cf10[i], 0, 0, 0, 0); 
-          __coeff[2][i] = _SET(_cf21[i+VGWORDS], _cf21[i], _cf20[i+VGWORDS], _cf20[i], 0, 0, 0, 0); 
-        }
-        __P[i] = _SET(0, _pts[4]->X[1][i], 0, _pts[4]->X[0][i],\
-                      0, _pts[4]->Z[1][i], 0, _pts[4]->Z[0][i]);
-        __coeff[0][i] = _SET(0, 0, 0, 0, 0, _cf01[i], 0, _cf00[i]); 
-        __coeff[1][i] = _SET(0, _cf11[i], 0, _cf10[i], 0, 0, 0, 0); 
-        __coeff[2][i] = _SET(0, _cf21[i], 0, _cf20[i], 0, 0, 0, 0); 
-
-        eval_4_isog_1x2x2x2w(__P, __coeff);
-
-        // extract results
-        get_channel_4x2w(_pts[4]->X[0], __P, 4); get_channel_4x2w(_pts[4]->X[1], __P, 6);
-        get_channel_4x2w(_pts[4]->Z[0], __P, 0); get_channel_4x2w(_pts[4]->Z[1], __P, 2);
-
-        // carry propagation 
-        carryp_1w(_pts[4]->X[0]); carryp_1w(_pts[4]->X[1]); 
-        carryp_1w(_pts[4]->Z[0]); carryp_1w(_pts[4]->Z[1]); 
-      }
-    }
+// max number of points of one parallel isogeny evaluation
+#define MAX_PACKED_POINTS (2*MAX_INT_POINTS_BOB+3)
 
-    // depends on public info
-    if (num == 15 | num == 17 | num == 19) {
-      // 8x1x1x1w < _pts[2] | _pts[3] | _pts[4] | _pts[5] | pts[6] | pts[3] | pts[4] | pts[5] >
-      vpoint_proj_t _P;
-      vf2elm_t _coeff[3];
-
-      // initialize vectors 
-      for (i = 0; i < VNWORDS; i++) {
-        _P->X[0][i] = _SET(_pts[2]->X[0][i], _pts[3]->X[0][i], _pts[4]->X[0][i], _pts[5]->X[0][i], \
-                            pts[6]->X[0][i],  pts[3]->X[0][i],  pts[4]->X[0][i],  pts[5]->X[0][i]);
-        _P->X[1][i] = _SET(_pts[2]->X[1][i], _pts[3]->X[1][i], _pts[4]->X[1][i], _pts[5]->X[1][i], \
-                            pts[6]->X[1][i],  pts[3]->X[1][i],  pts[4]->X[1][i],  pts[5]->X[1][i]);
-        _P->Z[0][i] = _SET(_pts[2]->Z[0][i], _pts[3]->Z[0][i], _pts[4]->Z[0][i], _pts[5]->Z[0][i], \
-                            pts[6]->Z[0][i],  pts[3]->Z[0][i],  pts[4]->Z[0][i],  pts[5]->Z[0][i]);
-        _P->Z[1][i] = _SET(_pts[2]->Z[1][i], _pts[3]->Z[1][i], _pts[4]->Z[1][i], _pts[5]->Z[1][i], \
-                            pts[6]->Z[1][i],  pts[3]->Z[1][i],  pts[4]->Z[1][i],  pts[5]->Z[1][i]);
-        _coeff[0][0][i] = _SET(_cf00[i], _cf00[i], _cf00[i], _cf00[i], cf00[i], cf00[i], cf00[i], cf00[i]); 
-        _coeff[0][1][i] = _SET(_cf01[i], _cf01[i], _cf01[i], _cf01[i], cf01[i], cf01[i], cf01[i], cf01[i]);
-        _coeff[1][0][i] = _SET(_cf10[i], _cf10[i], _cf10[i], _cf10[i], cf10[i], cf10[i], cf10[i], cf10[i]); 
-        _coeff[1][1][i] = _SET(_cf11[i], _cf11[i], _cf11[i], _cf11[i], cf11[i], cf11[i], cf11[i], cf11[i]);
-        _coeff[2][0][i] = _SET(_cf20[i], _cf20[i], _cf20[i], _cf20[i], cf20[i], cf20[i], cf20[i], cf20[i]); 
-        _coeff[2][1][i] = _SET(_cf21[i], _cf21[i], _cf21[i], _cf21[i], cf21[i], cf21[i], cf21[i], cf21[i]);
-      }
-
-      eval_4_isog_8x1x1x1w(_P, _coeff);
-
-      // extract results
-      get_channel_8x1w(_pts[2]->X[0], _P->X[0], 7); get_channel_8x1w(_pts[2]->X[1], _P->X[1], 7);
-      get_channel_8x1w(_pts[2]->Z[0], _P->Z[0], 7); get_channel_8x1w(_pts[2]->Z[1], _P->Z[1], 7);
-      get_channel_8x1w(_pts[3]->X[0], _P->X[0], 6); get_channel_8x1w(_pts[3]->X[1], _P->X[1], 6);
-      get_channel_8x1w(_pts[3]->Z[0], _P->Z[0], 6); get_channel_8x1w(_pts[3]->Z[1], _P->Z[1], 6);
-      get_channel_8x1w(_pts[4]->X[0], _P->X[0], 5); get_channel_8x1w(_pts[4]->X[1], _P->X[1], 5);
-      get_channel_8x1w(_pts[4]->Z[0], _P->Z[0], 5); get_channel_8x1w(_pts[4]->Z[1], _P->Z[1], 5);
-      get_channel_8x1w(_pts[5]->X[0], _P->X[0], 4); get_channel_8x1w(_pts[5]->X[1], _P->X[1], 4);
-      get_channel_8x1w(_pts[5]->Z[0], _P->Z[0], 4); get_channel_8x1w(_pts[5]->Z[1], _P->Z[1], 4);
-      get_channel_8x1w(pts[3]->X[0], _P->X[0], 2); get_channel_8x1w(pts[3]->X[1], _P->X[1], 2);
-      get_channel_8x1w(pts[3]->Z[0], _P->Z[0], 2); get_channel_8x1w(pts[3]->Z[1], _P->Z[1], 2);
-      get_channel_8x1w(pts[4]->X[0], _P->X[0], 1); get_channel_8x1w(pts[4]->X[1], _P->X[1], 1);
-      get_channel_8x1w(pts[4]->Z[0], _P->Z[0], 1); get_channel_8x1w(pts[4]->Z[1], _P->Z[1], 1);
-      get_channel_8x1w(pts[5]->X[0], _P->X[0], 0); get_channel_8x1w(pts[5]->X[1], _P->X[1], 0);
-      get_channel_8x1w(pts[5]->Z[0], _P->Z[0], 0); get_channel_8x1w(pts[5]->Z[1], _P->Z[1], 0);
-
-      // depends on public info
-      if (num >= 17) {
-        get_channel_8x1w(pts[6]->X[0], _P->X[0], 3); get_channel_8x1w(pts[6]->X[1], _P->X[1], 3);
-        get_channel_8x1w(pts[6]->Z[0], _P->Z[0], 3); get_channel_8x1w(pts[6]->Z[1], _P->Z[1], 3);
-      }
-
-      // depends on public info
-      if (num == 17) {
-        // 1x2x2x2w < _pts[6] >
-        vgelm_t __P, __coeff[3];
-
-        // initialize vectors 
-        for (i = 0; i < VGWORDS-1; i++) {
-          __P[i] = _SET(_pts[6]->X[1][i+VGWORDS], _pts[6]->X[1][i], _pts[6]->X[0][i+VGWORDS], _pts[6]->X[0][i],\
-                        _pts[6]->Z[1][i+VGWORDS], _pts[6]->Z[1][i], _pts[6]->Z[0][i+VGWORDS], _pts[6]->Z[0][i]);
-          __coeff[0][i] = _SET(0, 0, 0, 0, _cf01[i+VGWORDS], _cf01[i], _cf00[i+VGWORDS], _cf00[i]); 
-          __coeff[1][i] = _SET(_cf11[i+VGWORDS], _cf11[i], _cf10[i+VGWORDS], _cf10[i], 0, 0, 0, 0); 
-          __coeff[2][i] = _SET(_cf21[i+VGWORDS], _cf21[i], _cf20[i+VGWORDS], _cf20[i], 0, 0, 0, 0); 
-        }
-        __P[i] = _SET(0, _pts[6]->X[1][i], 0, _pts[6]->X[0][i],\
-                      0, _pts[6]->Z[1][i], 0, _pts[6]->Z[0][i]);
-        __coeff[0][i] = _SET(0, 0, 0, 0, 0, _cf01[i], 0, _cf00[i]); 
-        __coeff[1][i] = _SET(0, _cf11[i], 0, _cf10[i], 0, 0, 0, 0); 
-        __coeff[2][i] = _SET(0, _cf21[i], 0, _cf20[i], 0, 0, 0, 0); 
-
-        eval_4_isog_1x2x2x2w(__P, __coeff);
-
-        // extract results
-        get_channel_4x2w(_pts[6]->X[0], __P, 4); get_channel_4x2w(_pts[6]->X[1], __P, 6);
-        get_channel_4x2w(_pts[6]->Z[0], __P, 0); get_channel_4x2w(_pts[6]->Z[1], __P, 2);
-
-        // carry propagation 
-        carryp_1w(_pts[6]->X[0]); carryp_1w(_pts[6]->X[1]); 
-        carryp_1w(_pts[6]->Z[0]); carryp_1w(_pts[6]->Z[1]); 
-      }
-
-      // depends on public info
-      if (num == 19) {
-        // 4x2x1x1w < _pts[6] | _pts[7] | pts[7] | pts[7] >
-        vf2elm_t __P, __coeff[3];
-
-        // initialize vectors 
-        for (i = 0; i < VNWORDS; i++) {
-          __P[0][i] = _SET(_pts[6]->X[0][i], _pts[6]->Z[0][i], _pts[7]->X[0][i], _pts[7]->Z[0][i], \
-                            pts[7]->X[0][i],  pts[7]->Z[0][i],  pts[7]->X[0][i],  pts[7]->Z[0][i]);
-          __P[1][i] = _SET(_pts[6]->X[1][i], _pts[6]->Z[1][i], _pts[7]->X[1][i], _pts[7]->Z[1][i], \
-                            pts[7]->X[1][i],  pts[7]->Z[1][i],  pts[7]->X[1][i],  pts[7]->Z[1][i]);
-          __coeff[0][0][i] = _SET(0, _cf00[i], 0, _cf00[i], 0, cf00[i], 0, cf00[i]);
-          __coeff[0][1][i] = _SET(0, _cf01[i], 0, _cf01[i], 0, cf01[i], 0, cf01[i]);
-          __coeff[1][0][i] = _SET(_cf10[i], 0, _cf10[i], 0, cf10[i], 0, cf10[i], 0);
-          __coeff[1][1][i] = _SET(_cf11[i], 0, _cf11[i], 0, cf11[i], 0, cf11[i], 0);
-          __coeff[2][0][i] = _SET(_cf20[i], 0, _cf20[i], 0, cf20[i], 0, cf20[i], 0);
-          __coeff[2][1][i] = _SET(_cf21[i], 0, _cf21[i], 0, cf21[i], 0, cf21[i], 0);
-        }
-
-        eval_4_isog_4x2x1x1w(__P, __coeff);
-
-        // extract results
-        get_channel_8x1w(_pts[6]->X[0], __P[0], 7); get_channel_8x1w(_pts[6]->X[1], __P[1], 7);
-        get_channel_8x1w(_pts[6]->Z[0], __P[0], 6); get_channel_8x1w(_pts[6]->Z[1], __P[1], 6);
-        get_channel_8x1w(_pts[7]->X[0], __P[0], 5); get_channel_8x1w(_pts[7]->X[1], __P[1], 5);
-        get_channel_8x1w(_pts[7]->Z[0], __P[0], 4); get_channel_8x1w(_pts[7]->Z[1], __P[1], 4);
-        get_channel_8x1w(pts[7]->X[0], __P[0], 3); get_channel_8x1w(pts[7]->X[1], __P[1], 3);
-        get_channel_8x1w(pts[7]->Z[0], __P[0], 2); get_channel_8x1w(pts[7]->Z[1], __P[1], 2);        
-      }
-    }
-  }
-  // depends on public info
-  else {
-    puts("Error!");
-  }
-}
+// number of points per layout
+static const int lane_npts[4] = { 8, 4, 2, 1 };
 
-void xTPLe_1x2x2x2w(vgelm_t vP, point_proj_r51_t Q, const vgelm_t C24_A24plus, const int e)
-{
-  int i;
+// number of point vectors and coefficient vectors per layout
+static const int lane_nvec[4] = { 4*VNWORDS, 2*VNWORDS, VNWORDS, VGWORDS };
+static const int lane_ncf[4]  = { 2*VNWORDS, 2*VNWORDS, VNWORDS, VGWORDS };
+
+// X lanes and Z lanes of each layout (8x1x1x1w keeps X and Z in different vectors)
+static const __mmask8 lane_xmask[4] = { 0xFF, 0xAA, 0xCC, 0xF0 };
+static const __mmask8 lane_zmask[4] = { 0xFF, 0x55, 0x33, 0x0F };
 
-  for (i = 0; i < e; i++) xTPL_1x2x2x2w(vP, vP, C24_A24plus);
+// lane j -> point of the batch 
+static const int lane_slot[4][8] = { 
+  { 0, 1, 2, 3, 4, 5, 6, 7 },     // 8x1x1x1w < P7 | P6 | P5 | P4 | P3 | P2 | P1 | P0 >
+  { 0, 0, 1, 1, 2, 2, 3, 3 },     // 4x2x1x1w < P3 | P3 | P2 | P2 | P1 | P1 | P0 | P0 >
+  { 0, 0, 0, 0, 1, 1, 1, 1 },     // 2x2x2x1w < P1 | P1 | P1 | P1 | P0 | P0 | P0 | P0 >
+  { 0, 0, 0, 0, 0, 0, 0, 0 } };   // 1x2x2x2w < P0 | P0 | P0 | P0 | P0 | P0 | P0 | P0 >
 
-  // extract the point Q from vP
-  get_channel_4x2w(Q->X[0], vP, 4); get_channel_4x2w(Q->X[1], vP, 6);
-  get_channel_4x2w(Q->Z[0], vP, 0); get_channel_4x2w(Q->Z[1], vP, 2);
+// lane j -> field and limb offset relative to lane 0
+static const int lane_field[4][8] = { 
+  { 0, 0, 0, 0, 0, 0, 0, 0 },     // 8x1x1x1w < X0 | X0 | ... | X0 >, ..., < Z1 | Z1 | ... | Z1 >
+  { 0, 2, 0, 2, 0, 2, 0, 2 },     // 4x2x1x1w < X0 | Z0 | X0 | Z0 | ... >, < X1 | Z1 | ... >
+  { 0, 1, 2, 3, 0, 1, 2, 3 },     // 2x2x2x1w < X1 | X0 | Z1 | Z0 | X1 | X0 | Z1 | Z0 >
+  { 0, 0, 1, 1, 2, 2, 3, 3 } };   // 1x2x2x2w < X1' | X1 | X0' | X0 | Z1' | Z1 | Z0' | Z0 >
+static const int lane_limb[4][8] = { 
+  { 0, 0, 0, 0, 0, 0, 0, 0 },
+  { 0, 0, 0, 0, 0, 0, 0, 0 },
+  { 0, 0, 0, 0, 0, 0, 0, 0 },
+  { 0, VGWORDS, 0, VGWORDS, 0, VGWORDS, 0, VGWORDS } };
 
-  // final carry propagation making Q strictly in radix-2^51
-  carryp_1w(Q->X[0]); carryp_1w(Q->X[1]);
-  carryp_1w(Q->Z[0]); carryp_1w(Q->Z[1]);
+// layouts used for the 0-7 points left over after the 8x1x1x1w batches
+static const int lane_sched[8][2] = {
+  { -1, -1 },
+  { LAYOUT_1x2x2x2w, -1 },
+  { LAYOUT_2x2x2x1w, -1 },
+  { LAYOUT_4x2x1x1w, -1 },
+  { LAYOUT_4x2x1x1w, -1 },
+  { LAYOUT_4x2x1x1w, LAYOUT_1x2x2x2w },
+  { LAYOUT_4x2x1x1w, LAYOUT_2x2x2x1w },
+  { LAYOUT_8x1x1x1w, -1 } };
+
+// the limbs i+VGWORDS >= VNWORDS of the last 1x2x2x2w vector do not exist
+static __mmask8 lane_mask(const __mmask8 m, const int layout, const int v)
+{
+  if ((layout == LAYOUT_1x2x2x2w) && (v+VGWORDS >= VNWORDS)) return m & 0x55;
+  return m;
 }
 
-void eval_3_isog_parallel_kg(point_proj_r51_t *pts, point_proj_r51_t phiP, point_proj_r51_t phiQ, point_proj_r51_t phiR, const vgelm_t coeff1_0, const int num)
+// byte offset of the limb t of the field f in a point of the given format 
+static int64_t point_offset(const int fmt, const int f, const int t)
 {
-  felm_r51_t cf00, cf01, cf10, cf11;
-  int i;
+  if (fmt == PTFMT_2x2x2x1w) return 64*t + 8*f;
+  return 64*(t%VGWORDS) + 8*(2*f + t/VGWORDS);
+}
 
-  // extract constants
-  get_channel_4x2w(cf00, coeff1_0, 0); get_channel_4x2w(cf01, coeff1_0, 2);
-  get_channel_4x2w(cf10, coeff1_0, 4); get_channel_4x2w(cf11, coeff1_0, 6);
+// byte offset of the lane 0 of the v-th vector of a layout 
+static int64_t vec_offset(const int fmt, const int layout, const int v)
+{
+  static const int field8x1[4] = { 2, 3, 0, 1 };
 
-  // carry propagation
-  carryp_1w(cf00); carryp_1w(cf01);
-  carryp_1w(cf10); carryp_1w(cf11);
+  if (layout == LAYOUT_8x1x1x1w) return point_offset(fmt, field8x1[v/VNWORDS], v%VNWORDS);
+  if (layout == LAYOUT_4x2x1x1w) return point_offset(fmt, v/VNWORDS, v%VNWORDS);
+  return point_offset(fmt, 0, v);
+}
 
-  // depends on public info
-  if (num == 3 | num == 4 | num == 5 | num == 6) {
-    // 4x2x1x1w < pts[0] | phiP | phiQ | phiR >
-    vf2elm_t P, coeff0_1;
-
-    // initialize vectors 
-    for (i = 0; i < VNWORDS; i++) {
-      P[0][i] = _SET(pts[0]->X[0][i], pts[0]->Z[0][i], phiP->X[0][i], phiP->Z[0][i], \
-                       phiQ->X[0][i],   phiQ->Z[0][i], phiR->X[0][i], phiR->Z[0][i]);
-      P[1][i] = _SET(pts[0]->X[1][i], pts[0]->Z[1][i], phiP->X[1][i], phiP->Z[1][i], \
-                       phiQ->X[1][i],   phiQ->Z[1][i], phiR->X[1][i], phiR->Z[1][i]);
-      coeff0_1[0][i] = _SET(cf00[i], cf10[i], cf00[i], cf10[i], cf00[i], cf10[i], cf00[i], cf10[i]);
-      coeff0_1[1][i] = _SET(cf01[i], cf11[i], cf01[i], cf11[i], cf01[i], cf11[i], cf01[i], cf11[i]);
-    }
+static void vgather_points(__m512i *r, const uint8_t *base, const __m512i vidx, const __mmask8 m, const int fmt, const int layout)
+{
+  int v;
 
-    eval_3_isog_4x2x1x1w(P, coeff0_1);
+  for (v = 0; v < lane_nvec[layout]; v++) 
+    r[v] = _mm512_mask_i64gather_epi64(VZERO, lane_mask(m, layout, v), vidx, base+vec_offset(fmt, layout, v), 1);
+}
 
-    // extract results
-    get_channel_8x1w(phiP->X[0], P[0], 5);   get_channel_8x1w(phiP->X[1], P[1], 5);
-    get_channel_8x1w(phiP->Z[0], P[0], 4);   get_channel_8x1w(phiP->Z[1], P[1], 4);
-    get_channel_8x1w(phiQ->X[0], P[0], 3);   get_channel_8x1w(phiQ->X[1], P[1], 3);
-    get_channel_8x1w(phiQ->Z[0], P[0], 2);   get_channel_8x1w(phiQ->Z[1], P[1], 2);
-    get_channel_8x1w(phiR->X[0], P[0], 1);   get_channel_8x1w(phiR->X[1], P[1], 1);
-    get_channel_8x1w(phiR->Z[0], P[0], 0);   get_channel_8x1w(phiR->Z[1], P[1], 0);
-  
-    // depends on public info
-    if (num >= 4) {
-      get_channel_8x1w(pts[0]->X[0], P[0], 7); get_channel_8x1w(pts[0]->X[1], P[1], 7);
-      get_channel_8x1w(pts[0]->Z[0], P[0], 6); get_channel_8x1w(pts[0]->Z[1], P[1], 6);
-    }
+static void vscatter_points(uint8_t *base, const __m512i *a, const __m512i vidx, const __mmask8 m, const int fmt, const int layout)
+{
+  int v;
 
-    // depends on public info
-    if (num == 5) {
-      // 1x2x2x2w < pts[1] >
-      vgelm_t _P, _coeff0_1;
-
-      // initialize vectors 
-      for (i = 0; i < VGWORDS-1; i++) {
-        _P[i] = _SET(pts[1]->X[1][i+VGWORDS], pts[1]->X[1][i], pts[1]->X[0][i+VGWORDS], pts[1]->X[0][i],\
-                     pts[1]->Z[1][i+VGWORDS], pts[1]->Z[1][i], pts[1]->Z[0][i+VGWORDS], pts[1]->Z[0][i]);
-        _coeff0_1[i] = _SET(cf01[i+VGWORDS], cf01[i], cf00[i+VGWORDS], cf00[i], 
-                            cf11[i+VGWORDS], cf11[i], cf10[i+VGWORDS], cf10[i] ); 
-      }
-      _P[i] = _SET(0, pts[1]->X[1][i], 0, pts[1]->X[0][i],\
-                   0, pts[1]->Z[1][i], 0, pts[1]->Z[0][i]);
-      _coeff0_1[i] = _SET(0, cf01[i], 0, cf00[i], 
-                          0, cf11[i], 0, cf10[i] ); 
-
-      eval_3_isog_1x2x2x2w(_P, _coeff0_1);
-
-      // extract results
-      get_channel_4x2w(pts[1]->X[0], _P, 4); get_channel_4x2w(pts[1]->X[1], _P, 6);
-      get_channel_4x2w(pts[1]->Z[0], _P, 0); get_channel_4x2w(pts[1]->Z[1], _P, 2);
-
-      // carry propagation 
-      carryp_1w(pts[1]->X[0]); carryp_1w(pts[1]->X[1]); 
-      carryp_1w(pts[1]->Z[0]); carryp_1w(pts[1]->Z[1]);  
-    }
+  for (v = 0; v < lane_nvec[layout]; v++) 
+    _mm512_mask_i64scatter_epi64(base+vec_offset(fmt, layout, v), lane_mask(m, layout, v), vidx, a[v], 1);
+}
+
+static void vgather_lanes(__m512i *r, const uint64_t *base, const __m512i vidx, const __mmask8 m, const int layout, const int n)
+{
+  int v;
 
-    // depends on public info
-    if (num == 6) {
-      // 2x2x2x1w < pts[1] | pts[2] >
-      vfelm_t _P, _coeff0_1;
+  for (v = 0; v < n; v++) 
+    r[v] = _mm512_mask_i64gather_epi64(VZERO, lane_mask(m, layout, v), vidx, base+v, 1);
+}
 
-      for (i = 0; i < VNWORDS; i++) {
-        _P[i] = _SET(pts[1]->X[1][i], pts[1]->X[0][i], pts[1]->Z[1][i], pts[1]->Z[0][i], \
-                     pts[2]->X[1][i], pts[2]->X[0][i], pts[2]->Z[1][i], pts[2]->Z[0][i]);
-        _coeff0_1[i] = _SET(cf01[i], cf00[i], cf11[i], cf10[i], cf01[i], cf00[i], cf11[i], cf10[i]);
-      }
+// r[v] = < b[v] in the lanes of mb, a[v] in the others >, zero outside m 
+static void vbcast_lanes(__m512i *r, const uint64_t *a, const uint64_t *b, const __mmask8 mb, const __mmask8 m, const int n)
+{
+  int v;
 
-      eval_3_isog_2x2x2x1w(_P, _coeff0_1);
+  for (v = 0; v < n; v++) 
+    r[v] = _mm512_maskz_mov_epi64(m, VMBLEND(mb, VSET1(a[v]), VSET1(b[v])));
+}
 
-      // extract results
-      get_channel_8x1w(pts[1]->X[0], _P, 6); get_channel_8x1w(pts[1]->X[1], _P, 7);
-      get_channel_8x1w(pts[1]->Z[0], _P, 4); get_channel_8x1w(pts[1]->Z[1], _P, 5);
-      get_channel_8x1w(pts[2]->X[0], _P, 2); get_channel_8x1w(pts[2]->X[1], _P, 3);
-      get_channel_8x1w(pts[2]->Z[0], _P, 0); get_channel_8x1w(pts[2]->Z[1], _P, 1);
+// evaluate the 4-isogeny (iso = 4) or the 3-isogeny (iso = 3) at the npts 
+// points p[0..npts-1] (stored in the format fmt) packed in one vector set of 
+// the given layout; p[k] uses the coefficient set sel[k] of the table ctab
+static void eval_isog_lanes(uint64_t **p, const int *sel, const int npts, const int fmt, const int layout, const uint64_t *ctab, const int iso)
+{
+  __m512i P[4*VNWORDS], coeff[3*2*VNWORDS], pidx, cidx;
+  int64_t pw[8], cw[8];
+  uint8_t *base = (uint8_t *)p[0];
+  const int ncf = lane_ncf[layout], nset = (iso == 4) ? 6*VNWORDS : 4*VNWORDS;
+  const __mmask8 xm = lane_xmask[layout], zm = lane_zmask[layout];
+  __mmask8 m = 0, m1 = 0;
+  int j, k;
+
+  // per-lane byte offsets of the points (relative to p[0] and the vector offset) 
+  // and the coefficients
+  for (j = 0; j < 8; j++) {
+    k = lane_slot[layout][j];
+    pw[j] = cw[j] = 0;
+    if (k < npts) {
+      m |= 1 << j;
+      if (sel[k]) m1 |= 1 << j;
+      pw[j] = (int64_t)((uintptr_t)p[k] - (uintptr_t)base) + 
+              point_offset(fmt, lane_field[layout][j], lane_limb[layout][j]);
+      cw[j] = 8*(sel[k]*nset + (lane_field[layout][j]&1)*VNWORDS + lane_limb[layout][j]);
     }
   }
-  // depends on public info
-  else if (num == 7 | num == 8 | num == 9 | num == 10 | num == 11 | num == 12 | num == 13) {
-    // 8x1x1x1w < pts[0] | pts[1] | pts[2] | pts[3] | pts[4] | phiP | phiQ | phiR >
-    vpoint_proj_t P;
-    vf2elm_t coeff[2];
-
-    // initialize vectors 
-    for (i = 0; i < VNWORDS; i++) {
-      P->X[0][i] = _SET(pts[0]->X[0][i], pts[1]->X[0][i], pts[2]->X[0][i], pts[3]->X[0][i], \
-                        pts[4]->X[0][i],   phiP->X[0][i],   phiQ->X[0][i],   phiR->X[0][i]);
-      P->X[1][i] = _SET(pts[0]->X[1][i], pts[1]->X[1][i], pts[2]->X[1][i], pts[3]->X[1][i], \
-                        pts[4]->X[1][i],   phiP->X[1][i],   phiQ->X[1][i],   phiR->X[1][i]);
-      P->Z[0][i] = _SET(pts[0]->Z[0][i], pts[1]->Z[0][i], pts[2]->Z[0][i], pts[3]->Z[0][i], \
-                        pts[4]->Z[0][i],   phiP->Z[0][i],   phiQ->Z[0][i],   phiR->Z[0][i]);
-      P->Z[1][i] = _SET(pts[0]->Z[1][i], pts[1]->Z[1][i], pts[2]->Z[1][i], pts[3]->Z[1][i], \
-                        pts[4]->Z[1][i],   phiP->Z[1][i],   phiQ->Z[1][i],   phiR->Z[1][i]);
-      coeff[0][0][i] = VSET1(cf00[i]); coeff[0][1][i] = VSET1(cf01[i]);
-      coeff[1][0][i] = VSET1(cf10[i]); coeff[1][1][i] = VSET1(cf11[i]);
+  pidx = _mm512_loadu_si512(pw);
+  cidx = _mm512_loadu_si512(cw);
+
+  // pack points
+  vgather_points(P, base, pidx, m, fmt, layout);
+
+  // pack coefficients: 4-isogeny coeff[0] in Z lanes, coeff[1], coeff[2] in X lanes; 
+  // 3-isogeny coeff[0] in X lanes, coeff[1] in Z lanes (separate vectors in 8x1x1x1w). 
+  // all lanes of 8x1x1x1w and 4x2x1x1w read the same word, so a single coefficient
+  // set is broadcast instead of gathered
+  if ((m1 == 0) && (ncf == 2*VNWORDS)) {
+    if (iso == 4) {
+      vbcast_lanes(coeff, ctab, ctab, 0, m & zm, ncf);
+      vbcast_lanes(coeff+ncf, ctab+2*VNWORDS, ctab+2*VNWORDS, 0, m & xm, ncf);
+      vbcast_lanes(coeff+2*ncf, ctab+4*VNWORDS, ctab+4*VNWORDS, 0, m & xm, ncf);
     }
-
-    eval_3_isog_8x1x1x1w(P, coeff);
-
-    // extract results
-    get_channel_8x1w(pts[0]->X[0], P->X[0], 7); get_channel_8x1w(pts[0]->X[1], P->X[1], 7);
-    get_channel_8x1w(pts[0]->Z[0], P->Z[0], 7); get_channel_8x1w(pts[0]->Z[1], P->Z[1], 7);
-    get_channel_8x1w(pts[1]->X[0], P->X[0], 6); get_channel_8x1w(pts[1]->X[1], P->X[1], 6);
-    get_channel_8x1w(pts[1]->Z[0], P->Z[0], 6); get_channel_8x1w(pts[1]->Z[1], P->Z[1], 6);
-    get_channel_8x1w(pts[2]->X[0], P->X[0], 5); get_channel_8x1w(pts[2]->X[1], P->X[1], 5);
-    get_channel_8x1w(pts[2]->Z[0], P->Z[0], 5); get_channel_8x1w(pts[2]->Z[1], P->Z[1], 5);
-    get_channel_8x1w(pts[3]->X[0], P->X[0], 4); get_channel_8x1w(pts[3]->X[1], P->X[1], 4);
-    get_channel_8x1w(pts[3]->Z[0], P->Z[0], 4); get_channel_8x1w(pts[3]->Z[1], P->Z[1], 4);
-    get_channel_8x1w(phiP->X[0], P->X[0], 2);   get_channel_8x1w(phiP->X[1], P->X[1], 2);
-    get_channel_8x1w(phiP->Z[0], P->Z[0], 2);   get_channel_8x1w(phiP->Z[1], P->Z[1], 2);
-    get_channel_8x1w(phiQ->X[0], P->X[0], 1);   get_channel_8x1w(phiQ->X[1], P->X[1], 1);
-    get_channel_8x1w(phiQ->Z[0], P->Z[0], 1);   get_channel_8x1w(phiQ->Z[1], P->Z[1], 1);
-    get_channel_8x1w(phiR->X[0], P->X[0], 0);   get_channel_8x1w(phiR->X[1], P->X[1], 0);
-    get_channel_8x1w(phiR->Z[0], P->Z[0], 0);   get_channel_8x1w(phiR->Z[1], P->Z[1], 0);
-
-    // depends on public info
-    if (num >= 8) {
-      get_channel_8x1w(pts[4]->X[0], P->X[0], 3); get_channel_8x1w(pts[4]->X[1], P->X[1], 3);
-      get_channel_8x1w(pts[4]->Z[0], P->Z[0], 3); get_channel_8x1w(pts[4]->Z[1], P->Z[1], 3);
-    }
-
-    // depends on public info
-    if (num == 9) {
-      // 1x2x2x2w < pts[5] >
-      vgelm_t _P, _coeff0_1;
-
-      // initialize vectors 
-      for (i = 0; i < VGWORDS-1; i++) {
-        _P[i] = _SET(pts[5]->X[1][i+VGWORDS], pts[5]->X[1][i], pts[5]->X[0][i+VGWORDS], pts[5]->X[0][i],\
-                     pts[5]->Z[1][i+VGWORDS], pts[5]->Z[1][i], pts[5]->Z[0][i+VGWORDS], pts[5]->Z[0][i]);
-        _coeff0_1[i] = _SET(cf01[i+VGWORDS], cf01[i], cf00[i+VGWORDS], cf00[i], 
-                            cf11[i+VGWORDS], cf11[i], cf10[i+VGWORDS], cf10[i] ); 
-      }
-      _P[i] = _SET(0, pts[5]->X[1][i], 0, pts[5]->X[0][i],\
-                   0, pts[5]->Z[1][i], 0, pts[5]->Z[0][i]);
-      _coeff0_1[i] = _SET(0, cf01[i], 0, cf00[i], 
-                          0, cf11[i], 0, cf10[i] );
-
-      eval_3_isog_1x2x2x2w(_P, _coeff0_1);
-
-      // extract results
-      get_channel_4x2w(pts[5]->X[0], _P, 4); get_channel_4x2w(pts[5]->X[1], _P, 6);
-      get_channel_4x2w(pts[5]->Z[0], _P, 0); get_channel_4x2w(pts[5]->Z[1], _P, 2);
-
-      // carry propagation 
-      carryp_1w(pts[5]->X[0]); carryp_1w(pts[5]->X[1]); 
-      carryp_1w(pts[5]->Z[0]); carryp_1w(pts[5]->Z[1]); 
+    else if (layout == LAYOUT_8x1x1x1w) {
+      vbcast_lanes(coeff, ctab, ctab, 0, m, ncf);
+      vbcast_lanes(coeff+ncf, ctab+2*VNWORDS, ctab+2*VNWORDS, 0, m, ncf);
     }
+    else vbcast_lanes(coeff, ctab, ctab+2*VNWORDS, zm, m, ncf);
+  }
+  else if (iso == 4) {
+    vgather_lanes(coeff, ctab, cidx, m & zm, layout, ncf);
+    vgather_lanes(coeff+ncf, ctab+2*VNWORDS, cidx, m & xm, layout, ncf);
+    vgather_lanes(coeff+2*ncf, ctab+4*VNWORDS, cidx, m & xm, layout, ncf);
+  }
+  else if (layout == LAYOUT_8x1x1x1w) {
+    vgather_lanes(coeff, ctab, cidx, m, layout, ncf);
+    vgather_lanes(coeff+ncf, ctab+2*VNWORDS, cidx, m, layout, ncf);
+  }
+  else {
+    cidx = VMADD(cidx, zm, cidx, VSET1(16*VNWORDS));
+    vgather_lanes(coeff, ctab, cidx, m, layout, ncf);
+  }
 
-    // depends on public info
-    if (num == 10) {
-      // 2x2x2x1w < pts[5] | pts[6] >
-      vfelm_t _P, _coeff0_1;
+  switch (layout) {
+    case LAYOUT_8x1x1x1w:
+      if (iso == 4) eval_4_isog_8x1x1x1w((vpoint_proj *)P, (vf2elm_t *)coeff);
+      else          eval_3_isog_8x1x1x1w((vpoint_proj *)P, (vf2elm_t *)coeff);
+      break;
+    case LAYOUT_4x2x1x1w:
+      if (iso == 4) eval_4_isog_4x2x1x1w((vfelm_t *)P, (vf2elm_t *)coeff);
+      else          eval_3_isog_4x2x1x1w((vfelm_t *)P, (vfelm_t *)coeff);
+      break;
+    case LAYOUT_2x2x2x1w:
+      if (iso == 4) eval_4_isog_2x2x2x1w(P, (vfelm_t *)coeff);
+      else          eval_3_isog_2x2x2x1w(P, coeff);
+      break;
+    default: 
+      if (iso == 4) eval_4_isog_1x2x2x2w(P, (vgelm_t *)coeff);
+      else          eval_3_isog_1x2x2x2w(P, coeff);
+      break;
+  }
 
-      for (i = 0; i < VNWORDS; i++) {
-        _P[i] = _SET(pts[5]->X[1][i], pts[5]->X[0][i], pts[5]->Z[1][i], pts[5]->Z[0][i], \
-                     pts[6]->X[1][i], pts[6]->X[0][i], pts[6]->Z[1][i], pts[6]->Z[0][i]);
-        _coeff0_1[i] = _SET(cf01[i], cf00[i], cf11[i], cf10[i], cf01[i], cf00[i], cf11[i], cf10[i]);
-      }
+  // final carry propagation making the 1x2x2x2w result strictly in radix-2^51
+  if (layout == LAYOUT_1x2x2x2w) carryp_1x2x2x2w(P);
 
-      eval_3_isog_2x2x2x1w(_P, _coeff0_1);
+  // unpack points 
+  vscatter_points(base, P, pidx, m, fmt, layout);
+}
 
-      // extract results
-      get_channel_8x1w(pts[5]->X[0], _P, 6); get_channel_8x1w(pts[5]->X[1], _P, 7);
-      get_channel_8x1w(pts[5]->Z[0], _P, 4); get_channel_8x1w(pts[5]->Z[1], _P, 5);
-      get_channel_8x1w(pts[6]->X[0], _P, 2); get_channel_8x1w(pts[6]->X[1], _P, 3);
-      get_channel_8x1w(pts[6]->Z[0], _P, 0); get_channel_8x1w(pts[6]->Z[1], _P, 1);
-    }
+// evaluate the 4-isogeny (iso = 4) or the 3-isogeny (iso = 3) at the num 
+// points p[0..num-1] (stored in the format fmt); p[k] uses the coefficient set 
+// sel[k] of the table ctab
+static void eval_isog_packed(uint64_t **p, const int *sel, const int num, const int fmt, const uint64_t *ctab, const int iso)
+{
+  int pos = 0, left, layout, n, b;
 
-    // depends on public info
-    if (num == 11 | num == 12 | num == 13) {
-      // 4x2x1x1w < pts[5] | pts[6] | pts[7] | pts[8] >
-      vf2elm_t _P, _coeff0_1;
-
-      // initialize vectors 
-      for (i = 0; i < VNWORDS; i++) {
-        _P[0][i] = _SET(pts[5]->X[0][i], pts[5]->Z[0][i], pts[6]->X[0][i], pts[6]->Z[0][i], \
-                        pts[7]->X[0][i], pts[7]->Z[0][i], pts[8]->X[0][i], pts[8]->Z[0][i]);
-        _P[1][i] = _SET(pts[5]->X[1][i], pts[5]->Z[1][i], pts[6]->X[1][i], pts[6]->Z[1][i], \
-                        pts[7]->X[1][i], pts[7]->Z[1][i], pts[8]->X[1][i], pts[8]->Z[1][i]);
-        _coeff0_1[0][i] = _SET(cf00[i], cf10[i], cf00[i], cf10[i], cf00[i], cf10[i], cf00[i], cf10[i]);
-        _coeff0_1[1][i] = _SET(cf01[i], cf11[i], cf01[i], cf11[i], cf01[i], cf11[i], cf01[i], cf11[i]);
-      }
-
-      eval_3_isog_4x2x1x1w(_P, _coeff0_1);
-
-      // extract results
-      get_channel_8x1w(pts[5]->X[0], _P[0], 7); get_channel_8x1w(pts[5]->X[1], _P[1], 7);
-      get_channel_8x1w(pts[5]->Z[0], _P[0], 6); get_channel_8x1w(pts[5]->Z[1], _P[1], 6);
-      get_channel_8x1w(pts[6]->X[0], _P[0], 5); get_channel_8x1w(pts[6]->X[1], _P[1], 5);
-      get_channel_8x1w(pts[6]->Z[0], _P[0], 4); get_channel_8x1w(pts[6]->Z[1], _P[1], 4);
-      get_channel_8x1w(pts[7]->X[0], _P[0], 3); get_channel_8x1w(pts[7]->X[1], _P[1], 3);
-      get_channel_8x1w(pts[7]->Z[0], _P[0], 2); get_channel_8x1w(pts[7]->Z[1], _P[1], 2);
-
-      // depends on public info
-      if (num >= 12) {
-        get_channel_8x1w(pts[8]->X[0], _P[0], 1); get_channel_8x1w(pts[8]->X[1], _P[1], 1);
-        get_channel_8x1w(pts[8]->Z[0], _P[0], 0); get_channel_8x1w(pts[8]->Z[1], _P[1], 0);
-      }
-
-      // depends on public info
-      if (num == 13) {
-        // 1x2x2x2w < pts[9] >
-        vgelm_t __P, __coeff0_1;
-
-        // initialize vectors 
-        for (i = 0; i < VGWORDS-1; i++) {
-          __P[i] = _SET(pts[9]->X[1][i+VGWORDS], pts[9]->X[1][i], pts[9]->X[0][i+VGWORDS], pts[9]->X[0][i],\
-                        pts[9]->Z[1][i+VGWORDS], pts[9]->Z[1][i], pts[9]->Z[0][i+VGWORDS], pts[9]->Z[0][i]);
-          __coeff0_1[i] = _SET(cf01[i+VGWORDS], cf01[i], cf00[i+VGWORDS], cf00[i], 
-                               cf11[i+VGWORDS], cf11[i], cf10[i+VGWORDS], cf10[i] ); 
-        }
-        __P[i] = _SET(0, pts[9]->X[1][i], 0, pts[9]->X[0][i],\
-                      0, pts[9]->Z[1][i], 0, pts[9]->Z[0][i]);
-        __coeff0_1[i] = _SET(0, cf01[i], 0, cf00[i], 
-                             0, cf11[i], 0, cf10[i] );
-
-        eval_3_isog_1x2x2x2w(__P, __coeff0_1);
-
-        // extract results
-        get_channel_4x2w(pts[9]->X[0], __P, 4); get_channel_4x2w(pts[9]->X[1], __P, 6);
-        get_channel_4x2w(pts[9]->Z[0], __P, 0); get_channel_4x2w(pts[9]->Z[1], __P, 2);
-
-        // carry propagation 
-        carryp_1w(pts[9]->X[0]); carryp_1w(pts[9]->X[1]); 
-        carryp_1w(pts[9]->Z[0]); carryp_1w(pts[9]->Z[1]); 
-      }
-    }
-  }
   // depends on public info
-  else {
-    puts("Error!");
+  while (num-pos >= 8) {
+    eval_isog_lanes(p+pos, sel+pos, 8, fmt, LAYOUT_8x1x1x1w, ctab, iso);
+    pos += 8;
+  }
+
+  left = num-pos;
+  for (b = 0; b < 2 && lane_sched[left][b] >= 0; b++) {
+    layout = lane_sched[left][b];
+    n = (lane_npts[layout] < num-pos) ? lane_npts[layout] : num-pos;
+    eval_isog_lanes(p+pos, sel+pos, n, fmt, layout, ctab, iso);
+    pos += n;
   }
 }
 
-void eval_3_isog_parallel_ss(point_proj_r51_t *pts, const vgelm_t coeff1_0, const int num)
+void eval_4_isog_parallel_kg(vgelm_t *pts, vgelm_t phiP, vgelm_t phiQ, vgelm_t phiR, const vgelm_t coeff__0, const vgelm_t coeff2_1, const int num)
 {
-  felm_r51_t cf00, cf01, cf10, cf11;
-  int i;
+  f2elm_r51_t cf[3];
+  uint64_t *p[MAX_PACKED_POINTS];
+  int sel[MAX_PACKED_POINTS] = { 0 }, i;
 
   // extract constants
-  get_channel_4x2w(cf00, coeff1_0, 0); get_channel_4x2w(cf01, coeff1_0, 2);
-  get_channel_4x2w(cf10, coeff1_0, 4); get_channel_4x2w(cf11, coeff1_0, 6);
+  get_channel_4x2w(cf[0][0], coeff__0, 0); get_channel_4x2w(cf[0][1], coeff__0, 2);
+  get_channel_4x2w(cf[1][0], coeff2_1, 0); get_channel_4x2w(cf[1][1], coeff2_1, 2);
+  get_channel_4x2w(cf[2][0], coeff2_1, 4); get_channel_4x2w(cf[2][1], coeff2_1, 6);
 
   // carry propagation
-  carryp_1w(cf00); carryp_1w(cf01);
-  carryp_1w(cf10); carryp_1w(cf11);
+  carryp_1w(cf[0][0]); carryp_1w(cf[0][1]);
+  carryp_1w(cf[1][0]); carryp_1w(cf[1][1]);
+  carryp_1w(cf[2][0]); carryp_1w(cf[2][1]);
 
-  // depends on public info
-  if (num == 1) {
-    // 1x2x2x2w < pts[0] >
-    vgelm_t _P, _coeff0_1;
-
-    // initialize vectors 
-    for (i = 0; i < VGWORDS-1; i++) {
-      _P[i] = _SET(pts[0]->X[1][i+VGWORDS], pts[0]->X[1][i], pts[0]->X[0][i+VGWORDS], pts[0]->X[0][i],\
-                   pts[0]->Z[1][i+VGWORDS], pts[0]->Z[1][i], pts[0]->Z[0][i+VGWORDS], pts[0]->Z[0][i]);
-      _coeff0_1[i] = _SET(cf01[i+VGWORDS], cf01[i], cf00[i+VGWORDS], cf00[i], 
-                          cf11[i+VGWORDS], cf11[i], cf10[i+VGWORDS], cf10[i] ); 
-    }
-    _P[i] = _SET(0, pts[0]->X[1][i], 0, pts[0]->X[0][i],\
-                 0, pts[0]->Z[1][i], 0, pts[0]->Z[0][i]);
-    _coeff0_1[i] = _SET(0, cf01[i], 0, cf00[i], 
-                        0, cf11[i], 0, cf10[i] ); 
+  // < pts[0] | ... | pts[num-4] | phiP | phiQ | phiR >
+  for (i = 0; i < num-3; i++) p[i] = (uint64_t *)pts[i];
+  p[i++] = (uint64_t *)phiP; p[i++] = (uint64_t *)phiQ; p[i] = (uint64_t *)phiR;
 
-    eval_3_isog_1x2x2x2w(_P, _coeff0_1);
+  eval_isog_packed(p, sel, num, PTFMT_1x2x2x2w, (uint64_t *)cf, 4);
+}
 
-    // extract results
-    get_channel_4x2w(pts[0]->X[0], _P, 4); get_channel_4x2w(pts[0]->X[1], _P, 6);
-    get_channel_4x2w(pts[0]->Z[0], _P, 0); get_channel_4x2w(pts[0]->Z[1], _P, 2);
+void eval_4_isog_parallel_ss(vgelm_t *pts, const vgelm_t coeff__0, const vgelm_t coeff2_1, const int num)
+{
+  f2elm_r51_t cf[3];
+  uint64_t *p[MAX_PACKED_POINTS];
+  int sel[MAX_PACKED_POINTS] = { 0 }, i;
 
-    // carry propagation 
-    carryp_1w(pts[0]->X[0]); carryp_1w(pts[0]->X[1]); 
-    carryp_1w(pts[0]->Z[0]); carryp_1w(pts[0]->Z[1]); 
-  }
-  // depends on public info
-  else if (num == 2) {
-    // 2x2x2x1w < pts[0] | pts[1] >
-    vfelm_t _P, _coeff0_1;
-
-    for (i = 0; i < VNWORDS; i++) {
-      _P[i] = _SET(pts[0]->X[1][i], pts[0]->X[0][i], pts[0]->Z[1][i], pts[0]->Z[0][i], \
-                   pts[1]->X[1][i], pts[1]->X[0][i], pts[1]->Z[1][i], pts[1]->Z[0][i]);
-      _coeff0_1[i] = _SET(cf01[i], cf00[i], cf11[i], cf10[i], cf01[i], cf00[i], cf11[i], cf10[i]);
-    }
+  // extract constants
+  get_channel_4x2w(cf[0][0], coeff__0, 0); get_channel_4x2w(cf[0][1], coeff__0, 2);
+  get_channel_4x2w(cf[1][0], coeff2_1, 0); get_channel_4x2w(cf[1][1], coeff2_1, 2);
+  get_channel_4x2w(cf[2][0], coeff2_1, 4); get_channel_4x2w(cf[2][1], coeff2_1, 6);
+
+  // carry propagation
+  carryp_1w(cf[0][0]); carryp_1w(cf[0][1]);
+  carryp_1w(cf[1][0]); carryp_1w(cf[1][1]);
+  carryp_1w(cf[2][0]); carryp_1w(cf[2][1]);
+
+  // < pts[0] | ... | pts[num-1] >
+  for (i = 0; i < num; i++) p[i] = (uint64_t *)pts[i];
+
+  eval_isog_packed(p, sel, num, PTFMT_1x2x2x2w, (uint64_t *)cf, 4);
+}
+
+void eval_4_isog_parallel_kgss(vfelm_t *pts, vfelm_t phiP, vfelm_t phiQ, vfelm_t phiR, const vfelm_t coeff__0, const vfelm_t coeff2_1, const int num)
+{
+  f2elm_r51_t cf[2][3];
+  uint64_t *p[MAX_PACKED_POINTS];
+  int sel[MAX_PACKED_POINTS] = { 0 }, i, npts = (num-3)/2;
 
-    eval_3_isog_2x2x2x1w(_P, _coeff0_1);
+  // extract constants: set 0 for pts and phiP, phiQ, phiR, set 1 for _pts 
+  get_channel_8x1w(cf[0][0][0], coeff__0, 4); get_channel_8x1w(cf[0][0][1], coeff__0, 5);
+  get_channel_8x1w(cf[0][1][0], coeff2_1, 4); get_channel_8x1w(cf[0][1][1], coeff2_1, 5);
+  get_channel_8x1w(cf[0][2][0], coeff2_1, 6); get_channel_8x1w(cf[0][2][1], coeff2_1, 7);
+  get_channel_8x1w(cf[1][0][0], coeff__0, 0); get_channel_8x1w(cf[1][0][1], coeff__0, 1);
+  get_channel_8x1w(cf[1][1][0], coeff2_1, 0); get_channel_8x1w(cf[1][1][1], coeff2_1, 1);
+  get_channel_8x1w(cf[1][2][0], coeff2_1, 2); get_channel_8x1w(cf[1][2][1], coeff2_1, 3);
 
-    // extract results
-    get_channel_8x1w(pts[0]->X[0], _P, 6); get_channel_8x1w(pts[0]->X[1], _P, 7);
-    get_channel_8x1w(pts[0]->Z[0], _P, 4); get_channel_8x1w(pts[0]->Z[1], _P, 5);
-    get_channel_8x1w(pts[1]->X[0], _P, 2); get_channel_8x1w(pts[1]->X[1], _P, 3);
-    get_channel_8x1w(pts[1]->Z[0], _P, 0); get_channel_8x1w(pts[1]->Z[1], _P, 1);
+  // num = 2*npts+3, pts[i] = < pts[i] | _pts[i] >, phiP = < phiP | % > etc.
+  // < pts[0] | ... | pts[npts-1] | _pts[0] | ... | _pts[npts-1] | phiP | phiQ | phiR >
+  for (i = 0; i < npts; i++) {
+    p[i] = (uint64_t *)pts[i] + 4;
+    p[npts+i] = (uint64_t *)pts[i]; sel[npts+i] = 1;
   }
-  // depends on public info
-  else if (num == 3 | num == 4 | num == 5 | num == 6) {
-    // 4x2x1x1w < pts[0] | pts[1] | pts[2] | pts[3] >
-    vf2elm_t P, coeff0_1;
-
-    // initialize vectors 
-    for (i = 0; i < VNWORDS; i++) {
-      P[0][i] = _SET(pts[0]->X[0][i], pts[0]->Z[0][i], pts[1]->X[0][i], pts[1]->Z[0][i], \
-                     pts[2]->X[0][i], pts[2]->Z[0][i], pts[3]->X[0][i], pts[3]->Z[0][i]);
-      P[1][i] = _SET(pts[0]->X[1][i], pts[0]->Z[1][i], pts[1]->X[1][i], pts[1]->Z[1][i], \
-                     pts[2]->X[1][i], pts[2]->Z[1][i], pts[3]->X[1][i], pts[3]->Z[1][i]);
-      coeff0_1[0][i] = _SET(cf00[i], cf10[i], cf00[i], cf10[i], cf00[i], cf10[i], cf00[i], cf10[i]);
-      coeff0_1[1][i] = _SET(cf01[i], cf11[i], cf01[i], cf11[i], cf01[i], cf11[i], cf01[i], cf11[i]);
-    }
+  p[2*npts] = (uint64_t *)phiP + 4; p[2*npts+1] = (uint64_t *)phiQ + 4; p[2*npts+2] = (uint64_t *)phiR + 4;
 
-    eval_3_isog_4x2x1x1w(P, coeff0_1);
+  eval_isog_packed(p, sel, num, PTFMT_2x2x2x1w, (uint64_t *)cf, 4);
+}
 
-    // extract results
-    get_channel_8x1w(pts[0]->X[0], P[0], 7); get_channel_8x1w(pts[0]->X[1], P[1], 7);
-    get_channel_8x1w(pts[0]->Z[0], P[0], 6); get_channel_8x1w(pts[0]->Z[1], P[1], 6);
-    get_channel_8x1w(pts[1]->X[0], P[0], 5); get_channel_8x1w(pts[1]->X[1], P[1], 5);
-    get_channel_8x1w(pts[1]->Z[0], P[0], 4); get_channel_8x1w(pts[1]->Z[1], P[1], 4);
-    get_channel_8x1w(pts[2]->X[0], P[0], 3); get_channel_8x1w(pts[2]->X[1], P[1], 3);
-    get_channel_8x1w(pts[2]->Z[0], P[0], 2); get_channel_8x1w(pts[2]->Z[1], P[1], 2);
+// the output vP is strictly in radix-2^51
+void xTPLe_1x2x2x2w(const vgelm_t vP, vgelm_t vQ, const vgelm_t C24_A24plus, const int e)
+{
+  int i;
 
-    // depends on public info
-    if (num >= 4) {
-      get_channel_8x1w(pts[3]->X[0], P[0], 1); get_channel_8x1w(pts[3]->X[1], P[1], 1);
-      get_channel_8x1w(pts[3]->Z[0], P[0], 0); get_channel_8x1w(pts[3]->Z[1], P[1], 0);
-    }
+  if (e == 0) pointcopy_1x2x2x2w(vQ, vP);
+  else xTPL_1x2x2x2w(vP, vQ, C24_A24plus);
+  for (i = 1; i < e; i++) xTPL_1x2x2x2w(vQ, vQ, C24_A24plus);
 
-    // depends on public info
-    if (num == 5) {
-      // 1x2x2x2w < pts[4] >
-      vgelm_t _P, _coeff0_1;
-
-      // initialize vectors 
-      for (i = 0; i < VGWORDS-1; i++) {
-        _P[i] = _SET(pts[4]->X[1][i+VGWORDS], pts[4]->X[1][i], pts[4]->X[0][i+VGWORDS], pts[4]->X[0][i],\
-                     pts[4]->Z[1][i+VGWORDS], pts[4]->Z[1][i], pts[4]->Z[0][i+VGWORDS], pts[4]->Z[0][i]);
-        _coeff0_1[i] = _SET(cf01[i+VGWORDS], cf01[i], cf00[i+VGWORDS], cf00[i], 
-                            cf11[i+VGWORDS], cf11[i], cf10[i+VGWORDS], cf10[i] ); 
-      }
-      _P[i] = _SET(0, pts[4]->X[1][i], 0, pts[4]->X[0][i],\
-                   0, pts[4]->Z[1][i], 0, pts[4]->Z[0][i]);
-      _coeff0_1[i] = _SET(0, cf01[i], 0, cf00[i], 
-                          0, cf11[i], 0, cf10[i] ); 
-
-      eval_3_isog_1x2x2x2w(_P, _coeff0_1);
-
-      // extract results
-      get_channel_4x2w(pts[4]->X[0], _P, 4); get_channel_4x2w(pts[4]->X[1], _P, 6);
-      get_channel_4x2w(pts[4]->Z[0], _P, 0); get_channel_4x2w(pts[4]->Z[1], _P, 2);
-
-      // carry propagation 
-      carryp_1w(pts[4]->X[0]); carryp_1w(pts[4]->X[1]); 
-      carryp_1w(pts[4]->Z[0]); carryp_1w(pts[4]->Z[1]);  
-    }
+  carryp_1x2x2x2w(vQ);
+}
 
-    // depends on public info
-    if (num == 6) {
-      // 2x2x2x1w < pts[4] | pts[5] >
-      vfelm_t _P, _coeff0_1;
+void eval_3_isog_parallel_kg(vgelm_t *pts, vgelm_t phiP, vgelm_t phiQ, vgelm_t phiR, const vgelm_t coeff1_0, const int num)
+{
+  f2elm_r51_t cf[2];
+  uint64_t *p[MAX_PACKED_POINTS];
+  int sel[MAX_PACKED_POINTS] = { 0 }, i;
 
-      for (i = 0; i < VNWORDS; i++) {
-        _P[i] = _SET(pts[4]->X[1][i], pts[4]->X[0][i], pts[4]->Z[1][i], pts[4]->Z[0][i], \
-                     pts[5]->X[1][i], pts[5]->X[0][i], pts[5]->Z[1][i], pts[5]->Z[0][i]);
-        _coeff0_1[i] = _SET(cf01[i], cf00[i], cf11[i], cf10[i], cf01[i], cf00[i], cf11[i], cf10[i]);
-      }
+  // extract constants
+  get_channel_4x2w(cf[0][0], coeff1_0, 0); get_channel_4x2w(cf[0][1], coeff1_0, 2);
+  get_channel_4x2w(cf[1][0], coeff1_0, 4); get_channel_4x2w(cf[1][1], coeff1_0, 6);
 
-      eval_3_isog_2x2x2x1w(_P, _coeff0_1);
+  // carry propagation
+  carryp_1w(cf[0][0]); carryp_1w(cf[0][1]);
+  carryp_1w(cf[1][0]); carryp_1w(cf[1][1]);
 
-      // extract results
-      get_channel_8x1w(pts[4]->X[0], _P, 6); get_channel_8x1w(pts[4]->X[1], _P, 7);
-      get_channel_8x1w(pts[4]->Z[0], _P, 4); get_channel_8x1w(pts[4]->Z[1], _P, 5);
-      get_channel_8x1w(pts[5]->X[0], _P, 2); get_channel_8x1w(pts[5]->X[1], _P, 3);
-      get_channel_8x1w(pts[5]->Z[0], _P, 0); get_channel_8x1w(pts[5]->Z[1], _P, 1);
-    }
-  }
-  // depends on public info
-  else if (num == 7 | num == 8 | num == 9 | num == 10) {
-    // 8x1x1x1w < pts[0] | pts[1] | pts[2] | pts[3] | pts[4] | pts[5] | pts[6] | pts[7] >
-    vpoint_proj_t P;
-    vf2elm_t coeff[2];
-
-    // initialize vectors 
-    for (i = 0; i < VNWORDS; i++) {
-      P->X[0][i] = _SET(pts[0]->X[0][i], pts[1]->X[0][i], pts[2]->X[0][i], pts[3]->X[0][i], \
-                        pts[4]->X[0][i], pts[5]->X[0][i], pts[6]->X[0][i], pts[7]->X[0][i]);
-      P->X[1][i] = _SET(pts[0]->X[1][i], pts[1]->X[1][i], pts[2]->X[1][i], pts[3]->X[1][i], \
-                        pts[4]->X[1][i], pts[5]->X[1][i], pts[6]->X[1][i], pts[7]->X[1][i]);
-      P->Z[0][i] = _SET(pts[0]->Z[0][i], pts[1]->Z[0][i], pts[2]->Z[0][i], pts[3]->Z[0][i], \
-                        pts[4]->Z[0][i], pts[5]->Z[0][i], pts[6]->Z[0][i], pts[7]->Z[0][i]);
-      P->Z[1][i] = _SET(pts[0]->Z[1][i], pts[1]->Z[1][i], pts[2]->Z[1][i], pts[3]->Z[1][i], \
-                        pts[4]->Z[1][i], pts[5]->Z[1][i], pts[6]->Z[1][i], pts[7]->Z[1][i]);
-      coeff[0][0][i] = VSET1(cf00[i]); coeff[0][1][i] = VSET1(cf01[i]);
-      coeff[1][0][i] = VSET1(cf10[i]); coeff[1][1][i] = VSET1(cf11[i]);
-    }
+  // < pts[0] | ... | pts[num-4] | phiP | phiQ | phiR >
+  for (i = 0; i < num-3; i++) p[i] = (uint64_t *)pts[i];
+  p[i++] = (uint64_t *)phiP; p[i++] = (uint64_t *)phiQ; p[i] = (uint64_t *)phiR;
 
-    eval_3_isog_8x1x1x1w(P, coeff);
-
-    // extract results
-    get_channel_8x1w(pts[0]->X[0], P->X[0], 7); get_channel_8x1w(pts[0]->X[1], P->X[1], 7);
-    get_channel_8x1w(pts[0]->Z[0], P->Z[0], 7); get_channel_8x1w(pts[0]->Z[1], P->Z[1], 7);
-    get_channel_8x1w(pts[1]->X[0], P->X[0], 6); get_channel_8x1w(pts[1]->X[1], P->X[1], 6);
-    get_channel_8x1w(pts[1]->Z[0], P->Z[0], 6); get_channel_8x1w(pts[1]->Z[1], P->Z[1], 6);
-    get_channel_8x1w(pts[2]->X[0], P->X[0], 5); get_channel_8x1w(pts[2]->X[1], P->X[1], 5);
-    get_channel_8x1w(pts[2]->Z[0], P->Z[0], 5); get_channel_8x1w(pts[2]->Z[1], P->Z[1], 5);
-    get_channel_8x1w(pts[3]->X[0], P->X[0], 4); get_channel_8x1w(pts[3]->X[1], P->X[1], 4);
-    get_channel_8x1w(pts[3]->Z[0], P->Z[0], 4); get_channel_8x1w(pts[3]->Z[1], P->Z[1], 4);
-    get_channel_8x1w(pts[4]->X[0], P->X[0], 3); get_channel_8x1w(pts[4]->X[1], P->X[1], 3);
-    get_channel_8x1w(pts[4]->Z[0], P->Z[0], 3); get_channel_8x1w(pts[4]->Z[1], P->Z[1], 3);
-    get_channel_8x1w(pts[5]->X[0], P->X[0], 2); get_channel_8x1w(pts[5]->X[1], P->X[1], 2);
-    get_channel_8x1w(pts[5]->Z[0], P->Z[0], 2); get_channel_8x1w(pts[5]->Z[1], P->Z[1], 2);
-    get_channel_8x1w(pts[6]->X[0], P->X[0], 1); get_channel_8x1w(pts[6]->X[1], P->X[1], 1);
-    get_channel_8x1w(pts[6]->Z[0], P->Z[0], 1); get_channel_8x1w(pts[6]->Z[1], P->Z[1], 1);
-
-    // depends on public info
-    if (num >= 8) {
-      get_channel_8x1w(pts[7]->X[0], P->X[0], 0); get_channel_8x1w(pts[7]->X[1], P->X[1], 0);
-      get_channel_8x1w(pts[7]->Z[0], P->Z[0], 0); get_channel_8x1w(pts[7]->Z[1], P->Z[1], 0);
-    }
+  eval_isog_packed(p, sel, num, PTFMT_1x2x2x2w, (uint64_t *)cf, 3);
+}
 
-    // depends on public info
-    if (num == 9) {
-      // 1x2x2x2w < pts[8] >
-      vgelm_t _P, _coeff0_1;
-
-      // initialize vectors 
-      for (i = 0; i < VGWORDS-1; i++) {
-        _P[i] = _SET(pts[8]->X[1][i+VGWORDS], pts[8]->X[1][i], pts[8]->X[0][i+VGWORDS], pts[8]->X[0][i],\
-                     pts[8]->Z[1][i+VGWORDS], pts[8]->Z[1][i], pts[8]->Z[0][i+VGWORDS], pts[8]->Z[0][i]);
-        _coeff0_1[i] = _SET(cf01[i+VGWORDS], cf01[i], cf00[i+VGWORDS], cf00[i], 
-                            cf11[i+VGWORDS], cf11[i], cf10[i+VGWORDS], cf10[i] ); 
-      }
-      _P[i] = _SET(0, pts[8]->X[1][i], 0, pts[8]->X[0][i],\
-                   0, pts[8]->Z[1][i], 0, pts[8]->Z[0][i]);
-      _coeff0_1[i] = _SET(0, cf01[i], 0, cf00[i], 
-                          0, cf11[i], 0, cf10[i] ); 
-
-      eval_3_isog_1x2x2x2w(_P, _coeff0_1);
-
-      // extract results
-      get_channel_4x2w(pts[8]->X[0], _P, 4); get_channel_4x2w(pts[8]->X[1], _P, 6);
-      get_channel_4x2w(pts[8]->Z[0], _P, 0); get_channel_4x2w(pts[8]->Z[1], _P, 2);
-
-      // carry propagation 
-      carryp_1w(pts[8]->X[0]); carryp_1w(pts[8]->X[1]); 
-      carryp_1w(pts[8]->Z[0]); carryp_1w(pts[8]->Z[1]);
-    }
+void eval_3_isog_parallel_ss(vgelm_t *pts, const vgelm_t coeff1_0, const int num)
+{
+  f2elm_r51_t cf[2];
+  uint64_t *p[MAX_PACKED_POINTS];
+  int sel[MAX_PACKED_POINTS] = { 0 }, i;
 
-    // depends on public info
-    if (num == 10) {
-      // 2x2x2x1w < pts[8] | pts[9] >
-      vfelm_t _P, _coeff0_1;
+  // extract constants
+  get_channel_4x2w(cf[0][0], coeff1_0, 0); get_channel_4x2w(cf[0][1], coeff1_0, 2);
+  get_channel_4x2w(cf[1][0], coeff1_0, 4); get_channel_4x2w(cf[1][1], coeff1_0, 6);
 
-      for (i = 0; i < VNWORDS; i++) {
-        _P[i] = _SET(pts[8]->X[1][i], pts[8]->X[0][i], pts[8]->Z[1][i], pts[8]->Z[0][i], \
-                     pts[9]->X[1][i], pts[9]->X[0][i], pts[9]->Z[1][i], pts[9]->Z[0][i]);
-        _coeff0_1[i] = _SET(cf01[i], cf00[i], cf11[i], cf10[i], cf01[i], cf00[i], cf11[i], cf10[i]);
-      }
+  // carry propagation
+  carryp_1w(cf[0][0]); carryp_1w(cf[0][1]);
+  carryp_1w(cf[1][0]); carryp_1w(cf[1][1]);
 
-      eval_3_isog_2x2x2x1w(_P, _coeff0_1);
+  // < pts[0] | ... | pts[num-1] >
+  for (i = 0; i < num; i++) p[i] = (uint64_t *)pts[i];
 
-      // extract results
-      get_channel_8x1w(pts[8]->X[0], _P, 6); get_channel_8x1w(pts[8]->X[1], _P, 7);
-      get_channel_8x1w(pts[8]->Z[0], _P, 4); get_channel_8x1w(pts[8]->Z[1], _P, 5);
-      get_channel_8x1w(pts[9]->X[0], _P, 2); get_channel_8x1w(pts[9]->X[1], _P, 3);
-      get_channel_8x1w(pts[9]->Z[0], _P, 0); get_channel_8x1w(pts[9]->Z[1], _P, 1);
-    }
-  }
-  // depends on public info
-  else {
-    puts("Error!");    
-  }
+  eval_isog_packed(p, sel, num, PTFMT_1x2x2x2w, (uint64_t *)cf, 3);
 }
 
 void inv_3_way(f2elm_t z1, f2elm_t z2, f2elm_t z3)
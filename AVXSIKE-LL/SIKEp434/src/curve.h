@@ -80,22 +80,31 @@ typedef point_proj_r51 point_proj_r51_t[1];
 void pointcopy_1w(point_proj_r51_t Q, const point_proj_r51_t P);
 void LADDER3PT_1x4x2x1w(const f2elm_r51_t xP, const f2elm_r51_t xQ, const f2elm_r51_t xPQ, const digit_t* m, const unsigned int AliceOrBob, point_proj_r51_t R, const f2elm_r51_t A);
 void carryp_1w(uint64_t *a);
+void carryp_1x2x2x2w(vgelm_t a);
+void pointcopy_1x2x2x2w(vgelm_t r, const vgelm_t a);
+void pointcopy_2x2x2x1w(vfelm_t r, const vfelm_t a);
+void pack_point_1x2x2x2w(vgelm_t r, const point_proj_r51_t P);
+void unpack_point_1x2x2x2w(point_proj_r51_t P, const vgelm_t a);
+void pack_points_2x2x2x1w(vfelm_t r, const point_proj_r51_t P, const point_proj_r51_t _P);
+void unpack_point_2x2x2x1w(point_proj_r51_t P, const vfelm_t a, const int ch);
 
 void LADDER3PT_2x4x1x1w(const f2elm_r51_t xP, const f2elm_r51_t xQ, const f2elm_r51_t xPQ, \
                         const f2elm_r51_t _xP, const f2elm_r51_t _xQ, const f2elm_r51_t _xPQ, \
                         const digit_t* m, const unsigned int AliceOrBob, \
                         point_proj_r51_t R, const f2elm_r51_t A, \
                         point_proj_r51_t _R, const f2elm_r51_t _A);
-
-void xDBLe_1x2x2x2w(vgelm_t vP, point_proj_r51_t Q, const vgelm_t C24_A24plus, const int e);
-void xDBLe_2x2x2x1w(vfelm_t vP, point_proj_r51_t Q, point_proj_r51_t _Q, const vfelm_t C24_A24plus, const int e);
-void eval_4_isog_parallel_kg(point_proj_r51_t *pts, point_proj_r51_t phiP, point_proj_r51_t phiQ, point_proj_r51_t phiR, const vgelm_t coeff__0, const vgelm_t coeff2_1, const int num);
-void eval_4_isog_parallel_ss(point_proj_r51_t *pts, const vgelm_t coeff__0, const vgelm_t coeff2_1, const int num);
-void eval_4_isog_parallel_kgss(point_proj_r51_t *pts, point_proj_r51_t *_pts, point_proj_r51_t phiP, point_proj_r51_t phiQ, point_proj_r51_t phiR, const vfelm_t coeff__0, const vfelm_t coeff2_1, const int num);
-
-void xTPLe_1x2x2x2w(vgelm_t vP, point_proj_r51_t Q, const vgelm_t C24_A24plus, const int e);
-void eval_3_isog_parallel_kg(point_proj_r51_t *pts, point_proj_r51_t phiP, point_proj_r51_t phiQ, point_proj_r51_t phiR, const vgelm_t coeff1_0, const int num);
-void eval_3_isog_parallel_ss(point_proj_r51_t *pts, const vgelm_t coeff1_0, const int num);
+void LADDER3PT_fixed_1x2x2x2w(const f2elm_r51_t xP, const f2elm_r51_t xPQ, const digit_t* m, const unsigned int AliceOrBob, vgelm_t R);
+void ladder_table_1x2x2x2w(vgelm_t *tab, const f2elm_r51_t xQ, const vgelm_t C24_A24plus, const int nbits);
+
+void xDBLe_1x2x2x2w(const vgelm_t vP, vgelm_t vQ, const vgelm_t C24_A24plus, const int e);
+void xDBLe_2x2x2x1w(const vfelm_t vP, vfelm_t vQ, const vfelm_t C24_A24plus, const int e);
+void eval_4_isog_parallel_kg(vgelm_t *pts, vgelm_t phiP, vgelm_t phiQ, vgelm_t phiR, const vgelm_t coeff__0, const vgelm_t coeff2_1, const int num);
+void eval_4_isog_parallel_ss(vgelm_t *pts, const vgelm_t coeff__0, const vgelm_t coeff2_1, const int num);
+void eval_4_isog_parallel_kgss(vfelm_t *pts, vfelm_t phiP, vfelm_t phiQ, vfelm_t phiR, const vfelm_t coeff__0, const vfelm_t coeff2_1, const int num);
+
+void xTPLe_1x2x2x2w(const vgelm_t vP, vgelm_t vQ, const vgelm_t C24_A24plus, const int e);
+void eval_3_isog_parallel_kg(vgelm_t *pts, vgelm_t phiP, vgelm_t phiQ, vgelm_t phiR, const vgelm_t coeff1_0, const int num);
+void eval_3_isog_parallel_ss(vgelm_t *pts, const vgelm_t coeff1_0, const int num);
 
 void inv_3_way(f2elm_t z1, f2elm_t z2, f2elm_t z3);
 void get_A(const f2elm_t xP, const f2elm_t xQ, const f2elm_t xR, f2elm_t A);
@@ -18,7 +18,7 @@ int8_t ct_compare(const uint8_t *a, const uint8_t *b, unsigned int len)
     for (unsigned int i = 0; i < len; i++)
         r |= a[i] ^ b[i];
 
-    return (-(int8_t)r) >> (8*sizeof(uint8_t)-1);
+    return (int8_t)((-(int32_t)r) >> (8*sizeof(int32_t)-1));
 }
 
 void ct_cmov(uint8_t *r, const uint8_t *a, unsigned int len, int8_t selector) 
@@ -1082,6 +1082,70 @@ void mp2_add_1w(f2elm_r51_t r, const f2elm_r51_t a, const f2elm_r51_t b)
   mp_add_1w(r[1], a[1], b[1]);
 }
 
+// -----------------------------------------------------------------------------
+// 1-way radix conversion between radix-2^51 and radix-2^64. 
+// Both elements fit in two zmm words; every output word is assembled from the 
+// (at most three) input words it overlaps, picked by a 2-source permute and 
+// aligned by variable shifts, so one call is a handful of vector instructions.
+
+// r = a in radix-2^64 (a in radix-2^51)
+void fpconv_51to64_1w(felm_t r, const felm_r51_t a)
+{
+  // word i of r holds bits [64i, 64i+64), i.e. a[q] >> s | a[q+1] << (51-s) | 
+  // a[q+2] << (102-s) with q = 64i/51 and s = 64i%51 (shifts by >= 64 give 0)
+  const __m512i q[2] = { VSET( 8,  7,  6,  5,  3,  2,  1,  0), VSET(18, 17, 16, 15, 13, 12, 11, 10) };
+  const __m512i s[2] = { VSET(40, 27, 14,  1, 39, 26, 13,  0), VSET(42, 29, 16,  3, 41, 28, 15,  2) };
+  const __m512i one = VSET1(1), radix = VSET1(VBRADIX);
+  __m512i a0, a1, t, u;
+  int i;
+
+  // limbs beyond VNWORDS are loaded as 0
+  a0 = VZLOAD(0xFF, &a[0]); 
+  a1 = VZLOAD((1 << (VNWORDS-8)) - 1, &a[8]);
+
+  for (i = 0; i*8 < NWORDS_FIELD; i++) {
+    t = VSHRV(VPERMV2(a0, q[i], a1), s[i]);
+    u = VSUB(radix, s[i]);
+    t = VOR(t, VSHLV(VPERMV2(a0, VADD(q[i], one), a1), u));
+    u = VADD(u, radix);
+    t = VOR(t, VSHLV(VPERMV2(a0, VADD(q[i], VADD(one, one)), a1), u));
+    VMSTORE(&r[8*i], (NWORDS_FIELD-8*i >= 8) ? 0xFF : (1 << (NWORDS_FIELD-8*i)) - 1, t);
+  }
+}
+
+// r = a in radix-2^51 (a in radix-2^64)
+void fpconv_64to51_1w(felm_r51_t r, const felm_t a)
+{
+  // limb i of r holds bits [51i, 51i+51), i.e. the low 51 bits of a[j+1]:a[j] >> s
+  // with j = 51i/64 and s = 51i%64
+  const __m512i j[2] = { VSET( 5,  4,  3,  3,  2,  1,  0,  0), VSET(11, 11, 10,  9,  8,  7,  7,  6) };
+  const __m512i s[2] = { VSET(37, 50, 63, 12, 25, 38, 51,  0), VSET(61, 10, 23, 36, 49, 62, 11, 24) };
+  const __m512i one = VSET1(1), mask = VSET1(VBMASK);
+  __m512i a0, a1, t;
+  int i;
+
+  // words beyond NWORDS_FIELD are loaded as 0
+  a0 = VZLOAD((NWORDS_FIELD >= 8) ? 0xFF : (1 << NWORDS_FIELD) - 1, &a[0]); 
+  a1 = VZLOAD((NWORDS_FIELD > 8) ? (1 << (NWORDS_FIELD-8)) - 1 : 0, &a[8]);
+
+  for (i = 0; i*8 < VNWORDS; i++) {
+    t = VSHRDV(VPERMV2(a0, j[i], a1), VPERMV2(a0, VADD(j[i], one), a1), s[i]);
+    VMSTORE(&r[8*i], (VNWORDS-8*i >= 8) ? 0xFF : (1 << (VNWORDS-8*i)) - 1, VAND(t, mask));
+  }
+}
+
+void fp2conv_51to64_1w(f2elm_t r, const f2elm_r51_t a)
+{
+  fpconv_51to64_1w(r[0], a[0]);
+  fpconv_51to64_1w(r[1], a[1]);
+}
+
+void fp2conv_64to51_1w(f2elm_r51_t r, const f2elm_t a)
+{
+  fpconv_64to51_1w(r[0], a[0]);
+  fpconv_64to51_1w(r[1], a[1]);
+}
+
 // -----------------------------------------------------------------------------
 // 1-way x64 implementation from PQCrypto-SIDH-3.4
 
@@ -0,0 +1,2182 @@
+// Fixed-basis ladder tables of LADDER3PT_fixed_1x2x2x2w computed by
+// tools/strategy.c (./strategy tables > src/ladder_table.h), do not edit.
+// ladder_table_X[i] = < XR0-ZR0 | XR0+ZR0 > for R0 = [2^i]Q, where Q is the
+// basis point of vX_gen on E0.
+
+#ifndef _LADDER_TABLE_H
+#define _LADDER_TABLE_H
+
+#include "curve.h"
+
+static const vgelm_t ladder_table_A[OALICE_BITS] = {
+  { { 0x22C45BCDB41C7, 0x59F4A5A341EE8, 0x19E0BFFEEB5A7, 0x7FBA30A131004, 0x22C45B5987B0D, 0x2358E41A6FDF8, 0x19E0BFFEEB5A5, 0x16D83CF75CA94 },
+    { 0x4BBF1C6FEC6E6, 0x2E40E7881BF08, 0x5A0A050ADB0F7, 0x7FB7B9F9053B4, 0x4BBF1C6FEC6E6, 0x641092690DD87, 0x5A0A050ADB0F7, 0x33C5E2FBB9198 },
+    { 0x318FA54C4DAE9, 0x39446F7185905, 0x405ED5FF7A06F, 0x0EB6B98F9470C, 0x318FA54C4DAE9, 0x211A486BB141C, 0x405ED5FF7A06F, 0x2629FDFC90D0A },
+    { 0x7E3D63C1E9E02, 0x0000002346154, 0x1A03B10F6C513, 0x0000001CAD9B0, 0x7E3D63C1E9E02, 0x0000005E37275, 0x1A03B10F6C513, 0x00000063317FE },
+    { 0x3B225FE2ABD81, 0x0000000000000, 0x22664F10121BA, 0x0000000000000, 0x233906BD99D81, 0x0000000000000, 0x1DE93C05D81BA, 0x0000000000000 } },
+  { { 0x017AF3EA1A8CC, 0x3E766768937BD, 0x631B65C86442A, 0x2AA743CC9851B, 0x06037DCE5BC06, 0x7CB166905A881, 0x4713EF6D16976, 0x763820ACA1870 },
+    { 0x115F6A31628A5, 0x498C6049DF7A7, 0x2C2749C85DB91, 0x1A4F5C7689B1F, 0x04C448F0FEBB9, 0x781FBDBF36AC6, 0x0BC53A138BBB1, 0x4FC3F308D180F },
+    { 0x3790AAB401422, 0x5B22030824B68, 0x288851944DF16, 0x598006AA2B57C, 0x2F19E48801281, 0x23BEB60E556D6, 0x42044435342AF, 0x59E01DD1CFB49 },
+    { 0x5E4EF10CD414A, 0x00000042A6AB7, 0x53D3CB4357966, 0x0000003142402, 0x7CEB71EE85D61, 0x00000052A3C63, 0x7749DA5122CA8, 0x00000033B6594 },
+    { 0x438656D2E5E3A, 0x0000000000000, 0x6B67F7061AB7D, 0x0000000000000, 0x1E2CDCF097398, 0x0000000000000, 0x0922D3EFE16CB, 0x0000000000000 } },
+  { { 0x479C306367906, 0x5CE136FC36C2F, 0x3554AD75D35A7, 0x4E7059F5AB34E, 0x3296E42A19702, 0x781F8C32C2DF4, 0x4B2FD8329A8BD, 0x75344C8274A50 },
+    { 0x72D0923991872, 0x014E0E8CB7844, 0x19F17EF570124, 0x672C36481D678, 0x52C70AB7439BF, 0x4A3A12BCE57E7, 0x6224464729B9E, 0x559C779B2FBEF },
+    { 0x5F76763250CEC, 0x5514CE1CD4553, 0x560E36AECAD8E, 0x14F68BA6D8E7D, 0x5D30543F44D30, 0x0D19E56B10B2D, 0x1AD34928C72AC, 0x22551A98A47C1 },
+    { 0x7E5DEC4B54003, 0x0000007C57D25, 0x0189D9BBC5EDF, 0x000000246161F, 0x0E923DD169C88, 0x000000420CFAD, 0x1F3033986E10C, 0x0000005D6C994 },
+    { 0x15B25EE3A0B27, 0x0000000000000, 0x30098E0BBD1BD, 0x0000000000000, 0x03051DEDB2245, 0x0000000000000, 0x36A7EA2C3661A, 0x0000000000000 } },
+  { { 0x10F168FD43790, 0x5AC4CDC650E79, 0x0F329DCDB859B, 0x6035AEC91ECE4, 0x6FAE2D3B612E6, 0x4D6FACDBA0B5B, 0x2688355D8A567, 0x251D849D1B4E7 },
+    { 0x7B03AFD609BE0, 0x369A202D7BF14, 0x7408221F3D983, 0x7EB2B1E210EFA, 0x12B4BEF3E877F, 0x1E9FF91E8E802, 0x4CA4D565C8452, 0x48BFC7A4C2B26 },
+    { 0x4EAFFC9E102E6, 0x0A6B05DBC2DF6, 0x667D8DDA0639F, 0x45949AF9EB9E8, 0x2634ED89FF5B7, 0x71B74117C603F, 0x17B35C545E24B, 0x0734C61A9B24A },
+    { 0x0E59E0E37B7BE, 0x000000719BBD7, 0x00221EF3AF3E4, 0x000000008B781, 0x60D307B92ECFD, 0x0000005561AC7, 0x16EBF58B3248F, 0x0000004678D3A },
+    { 0x04D4DC717EA7D, 0x0000000000000, 0x573032A77B308, 0x0000000000000, 0x4106530C69213, 0x0000000000000, 0x2802205B9A799, 0x0000000000000 } },
+  { { 0x5C8BDBA0EE43C, 0x03F0B8DEC82AC, 0x0FFB3C95A0E5C, 0x10E496AE9A60C, 0x102BF2E7A66AA, 0x54F992D461BBF, 0x305D028EB4200, 0x10FFA61832E08 },
+    { 0x34E4F08CCB4FF, 0x5796D66130013, 0x5CD00A9DE673C, 0x4BE14F24E1486, 0x7207606C65D63, 0x6907D2254E0EF, 0x51E8D3091CA95, 0x4C960C048670D },
+    { 0x5FA44B14FA214, 0x22E621BFFEE4D, 0x297A067352812, 0x5189848A1358F, 0x0F38776C2CB74, 0x3B50C468A4B5F, 0x772AAA22CDEE2, 0x07B6EAFEE023D },
+    { 0x34DF6C7395215, 0x00000034052D5, 0x1947358BD5696, 0x0000003B472FD, 0x58F4029D7625C, 0x000000411612B, 0x460326C96CB77, 0x0000004C1ADF4 },
+    { 0x4E11C414B4E01, 0x0000000000000, 0x6895AD11B8618, 0x0000000000000, 0x27B8387D429AF, 0x0000000000000, 0x3F385D8818561, 0x0000000000000 } },
+  { { 0x330F7ABAFCF06, 0x3A75A4A680B80, 0x68963C5234379, 0x204B7DA7BDD01, 0x274AF68AA8774, 0x105F55B9673E1, 0x0A4184F5A7771, 0x665E04DE3156E },
+    { 0x673E5367AF1E2, 0x06558B442086A, 0x1A0D1320781D6, 0x2E92838769055, 0x3C6531970606A, 0x5EB19BC5A35A9, 0x61E072FAA3026, 0x2BBB46AAC5D47 },
+    { 0x3916A04C61CD7, 0x6BB1E3AC9DC49, 0x496674073F1CE, 0x29A86FA9C14F0, 0x05E4D4960F707, 0x19565D6D36081, 0x3AB97E94F5300, 0x05A22EB97235F },
+    { 0x6762EF5EFA0A8, 0x0000005260C57, 0x08EF89FD9185B, 0x0000002A316F1, 0x34FFDFCAFD915, 0x0000004D34EC6, 0x616C66BDFC06E, 0x0000005A6F042 },
+    { 0x13B2C7885F080, 0x0000000000000, 0x302D89591B642, 0x0000000000000, 0x52B136577BF2D, 0x0000000000000, 0x091CCBB222612, 0x0000000000000 } },
+  { { 0x3226914FC5F75, 0x4F8FC8B25FE6E, 0x195508C960951, 0x2EE81186F5D64, 0x20373867A91EF, 0x70981DFE6E4B4, 0x404F96E49614B, 0x661F7AE3DDCD1 },
+    { 0x0CDCDE96FBFEB, 0x7D01260003121, 0x4CBA5F7FFCC4B, 0x1C28802E526BB, 0x52A9782CE3343, 0x025E508FE908A, 0x469635CA8C9DC, 0x0C4B8BF647826 },
+    { 0x10E186D5224BF, 0x31AF4F8352525, 0x761E2071E9D13, 0x4BAD0B2A072ED, 0x5F3C03EAFF8D3, 0x192F2749F3A23, 0x1C17D1F6B0BD6, 0x34AB3DA381823 },
+    { 0x033DFF8E6E50B, 0x0000002235D0F, 0x7834FB937E6E5, 0x0000001E9D0FB, 0x57081148C1895, 0x0000005FF877E, 0x18925BB5CCC27, 0x000000324FC26 },
+    { 0x1E3D2D8BA0D38, 0x0000000000000, 0x632757E39D1D7, 0x0000000000000, 0x6985FD2B8E9AA, 0x0000000000000, 0x7325C60B367FE, 0x0000000000000 } },
+  { { 0x6BA69CE8E3271, 0x348E5B6D76965, 0x7F1456D48C1E9, 0x5669A0D44399A, 0x22FDCBD51BA93, 0x7522C13E82611, 0x618D0FA0D2BC5, 0x3A4DD23478712 },
+    { 0x67FBC779F694E, 0x51B3319CA6861, 0x097BB0CB819B5, 0x52046B8640704, 0x6AC5511C00BD6, 0x7A3503AB85A82, 0x76ECB442EDABF, 0x3EF3D4377B075 },
+    { 0x25D8B17FE2491, 0x576B0549C13BE, 0x54ECDBB159802, 0x094A7A32F0A46, 0x3653ECC847323, 0x3B977B7C0FD8F, 0x3A765CF843FBA, 0x4835D86156AE4 },
+    { 0x4496E2613C246, 0x0000003269A6B, 0x31EC8C29023C6, 0x0000002EA92FC, 0x36179DA05A2EF, 0x0000004C40FC7, 0x21482CF97E89E, 0x000000456B113 },
+    { 0x0AD17853A5BE5, 0x0000000000000, 0x18BF43C727CAC, 0x0000000000000, 0x7C26A4A707C7F, 0x0000000000000, 0x715A604BCC512, 0x0000000000000 } },
+  { { 0x3E8A685AB80D8, 0x42315DE857EA4, 0x611056712621D, 0x4E76EAC3BB303, 0x7DA2435ECA8E0, 0x12926BC3F9DDD, 0x2855A1A487CA9, 0x21FC46C44CE0E },
+    { 0x12C2B5430F8BD, 0x6CEA8D4D79A54, 0x1DA54D55B2288, 0x0EDAA43B9892D, 0x1CBA70CC9806C, 0x5EE229A73EB38, 0x2BA539D675E82, 0x484D9C77A8579 },
+    { 0x710218D2996FC, 0x516D738438EDE, 0x40CF81A9E7F34, 0x4DD323C14FD42, 0x5E18F4CA25C9D, 0x4545598D6481F, 0x24A58BCB10B71, 0x72EF0450EDF6C },
+    { 0x55A70937EF96A, 0x00000014C55A1, 0x381D2FE77C8E5, 0x0000001B51E96, 0x5968828FEA5C1, 0x00000058A5E9C, 0x4ED7820C3D14E, 0x0000003555A43 },
+    { 0x70286C18EE94F, 0x0000000000000, 0x07615EEBFC7BD, 0x0000000000000, 0x6A4D79A9E3C5D, 0x0000000000000, 0x735DAC04A8436, 0x0000000000000 } },
+  { { 0x19AAC8330328F, 0x4845634D93170, 0x2FC0B134DF0E6, 0x0DFA43525B88C, 0x1AF803A6C2B09, 0x5C4A5D85B6033, 0x603F8F1DA8AC8, 0x71F5B28B4CA3F },
+    { 0x558C3C5C486BF, 0x3EE673CD5EF3F, 0x692606EBC6343, 0x6E99CA87938E1, 0x1024A0CF04473, 0x2C22E3F6AE910, 0x330F75BEEAE3D, 0x2878E13086A81 },
+    { 0x3F40E7F0C36A7, 0x0FFDD64714083, 0x2DC2DC7468113, 0x3BCF1C80F8667, 0x4B62B0395D87C, 0x41CBD4EBC4D40, 0x6F344EAF7D130, 0x231C86642D3D4 },
+    { 0x2027FB00708A3, 0x000000777626E, 0x70E88E24F6A04, 0x0000000755F0A, 0x4351BF16EA01E, 0x0000003103CB8, 0x59168EA1B5DE6, 0x00000041DABB5 },
+    { 0x188D70EC6FB64, 0x0000000000000, 0x2D51868F3AEBE, 0x0000000000000, 0x168F5CF61700A, 0x0000000000000, 0x352931DD398AE, 0x0000000000000 } },
+  { { 0x702A190236118, 0x1759DEDA83E41, 0x533187B642AB4, 0x34097417FCAA3, 0x5B9D436DED448, 0x0F0DBC3D1080F, 0x49EEF0A7658E2, 0x70E2AC5906BB0 },
+    { 0x1719DBF03CA97, 0x146F65C0A71DF, 0x4A39F56E82A86, 0x1A998EF0C8FA7, 0x3C45138306118, 0x351C1D79AB32B, 0x6FF1A55657C87, 0x452499B3E1D1E },
+    { 0x0F11E78853A64, 0x455DF67D25F10, 0x3FEEEE4E8580B, 0x533848BD2E83A, 0x747C88CC4C541, 0x2708457024591, 0x6B25299B95B5C, 0x619C6129E14F1 },
+    { 0x6D6911A9DFF34, 0x0000006D6934B, 0x69C70A5793107, 0x00000028727FA, 0x28A61251D669C, 0x0000003E9FBB3, 0x34CB04F455E28, 0x0000004F3760F },
+    { 0x326715768243B, 0x0000000000000, 0x75654FA0479E2, 0x0000000000000, 0x6B7ED0EF7C147, 0x0000000000000, 0x3952346855909, 0x0000000000000 } },
+  { { 0x34D8549B9BD6B, 0x65EB456A8FEA4, 0x40AF7BF1E7DE1, 0x5E0995BA951D0, 0x5662D1B12389D, 0x6D89A8F69D462, 0x512605945B6F1, 0x635264C2B6F9D },
+    { 0x6CB76AD80EFC8, 0x25F25E58A1F47, 0x5C547B7B7E8CE, 0x491857C992D03, 0x0F43BF90EEEED, 0x169040A4764D6, 0x155B95A046BC2, 0x290D0B5D9D180 },
+    { 0x3B62D9977D0E1, 0x1E9911663A990, 0x1A3168CC42B86, 0x34FAF6B8B335F, 0x7AA42AD2D4E98, 0x1235BE6001EC4, 0x6F54EA41A977D, 0x749623013F06C },
+    { 0x1BC3DA9E229EA, 0x0000006EEC9FE, 0x4B1167651EB0E, 0x00000033A213B, 0x5AC85E6C2011F, 0x0000004AC4689, 0x240E3F21CF38C, 0x0000003C8AE27 },
+    { 0x108EA4CEB9B48, 0x0000000000000, 0x79A0F99B890DF, 0x0000000000000, 0x20A376A8950F5, 0x0000000000000, 0x218C0AADDBE09, 0x0000000000000 } },
+  { { 0x58B82A9B263F8, 0x354D9C97A3A08, 0x45ABF182177F9, 0x673928688C378, 0x0E88A6E576A42, 0x772FFC6E948A3, 0x3C44F480120A9, 0x5B421773D6A00 },
+    { 0x3139A863132E2, 0x6FC42ADD9AE25, 0x2EF0C491A88B9, 0x040D0A9777AA6, 0x21CB2212DCE16, 0x564CEF0D012C9, 0x3933393266DBB, 0x2BCD0649B6085 },
+    { 0x40FFA39993C44, 0x7BD01465EA455, 0x3C95CAD25F335, 0x43C0FFEF3A8FA, 0x6D0201B54783A, 0x24952DA5D7EB6, 0x6D7E4702BC9CD, 0x053A9A7C736B0 },
+    { 0x0A312B6EB8383, 0x0000007D1C939, 0x4FD285E44FAED, 0x0000001090330, 0x41104F2979C89, 0x0000005538F17, 0x5978200D96B2D, 0x000000544A274 },
+    { 0x748DA6266E1EF, 0x0000000000000, 0x1BF6FDAC8F826, 0x0000000000000, 0x290EF11E4A91E, 0x0000000000000, 0x4B26D47B62D23, 0x0000000000000 } },
+  { { 0x485545B1B7E49, 0x0A3FB6FBD14ED, 0x727B598E0303E, 0x059D0EE2FA3B8, 0x466AE56B44285, 0x6121FFCBB9C5B, 0x5CF779644071A, 0x2AE2AE6C133BA },
+    { 0x39F4007ECEA69, 0x059FC780D63E4, 0x17B7FB9028543, 0x4372F8D118982, 0x1AE4ED2117EC4, 0x16253510D1624, 0x208EA37D264F7, 0x28B8A1BA5575F },
+    { 0x666ED256EF605, 0x4F1C8075DADD5, 0x5AA2AD7353E7D, 0x58E05A9C3E577, 0x126901A18E0D6, 0x63090D95D1B2E, 0x0C340AAC48D51, 0x4A24444153149 },
+    { 0x5E006C7D256BB, 0x0000006122DB8, 0x5A0E22A32BF08, 0x0000001F88B59, 0x611D73A327362, 0x00000048E246B, 0x4A1F33FC50F2B, 0x00000040AD8E2 },
+    { 0x76BDD2746E261, 0x0000000000000, 0x06DB9AA5371EF, 0x0000000000000, 0x2AEE7B2695997, 0x0000000000000, 0x3D02FE09DB7B0, 0x0000000000000 } },
+  { { 0x345B89D64350B, 0x4E964197B5E2C, 0x5645ED12EB189, 0x6AE0DD6664AE1, 0x4EF880042C62B, 0x4D83BF5A61959, 0x77A00E65870D9, 0x2259903D32507 },
+    { 0x178F2CD43E4E1, 0x0369BF8547BF7, 0x65B6EC4BC7288, 0x08FD5DBA1FFC7, 0x5445A5D6C28E5, 0x5FD882E57317F, 0x65A7809548180, 0x1560870D92C5A },
+    { 0x1C3620FA9AD98, 0x08D1C092E975C, 0x5C2A9C756B8B4, 0x1E3861D47E81C, 0x5E64C3864A8EC, 0x625FB6BEB5FC9, 0x063856FDE843F, 0x10419E5F5EC47 },
+    { 0x3565DF02A7E01, 0x00000053BF8F9, 0x71C5E2D3A0DDD, 0x00000011E0209, 0x4AD65BB2333CA, 0x0000000E11365, 0x0D07356D12A13, 0x000000357A521 },
+    { 0x6EE40851B0F35, 0x0000000000000, 0x6B37AF86DE4DD, 0x0000000000000, 0x5764C17BEDC02, 0x0000000000000, 0x3C4A99F3F1CA4, 0x0000000000000 } },
+  { { 0x3C527933C8B4F, 0x13A8BDAAFC60B, 0x674003672F2B9, 0x773519061A481, 0x185028BC21817, 0x02FBA74DCEBB0, 0x7E1D0049BE353, 0x27B7C34C63603 },
+    { 0x14967CEF76CB0, 0x0A586F196C5B3, 0x61661DD010E93, 0x0D0638D9978EF, 0x4FFD7CA24F35D, 0x1FB1F217BDCFC, 0x319111C1BB29C, 0x6DE8653A55E07 },
+    { 0x1BD0F18361536, 0x0149F7268C3AF, 0x07208368E2C86, 0x7ADF12AC1493E, 0x7EFEDBE50B3C5, 0x20CD48E163F40, 0x39865F3D0761C, 0x20D978DF7ACCF },
+    { 0x0AA4D772222A7, 0x0000002690431, 0x79746CA9D42D2, 0x000000305BD2F, 0x0AF5F8AC2BAAB, 0x0000002FB90BC, 0x06B3DAF8818BC, 0x0000005346690 },
+    { 0x29A3032B7254A, 0x0000000000000, 0x2D9C45A2A2885, 0x0000000000000, 0x1DA05B170469A, 0x0000000000000, 0x20AC277BC6404, 0x0000000000000 } },
+  { { 0x06C6044AB100C, 0x7466D0F2FACD9, 0x5B5E47707BD94, 0x6E29EC9713BFA, 0x2CA5BB6FE904E, 0x2B1755C0963E3, 0x21EB6B29EC828, 0x237D798864752 },
+    { 0x26401D2C14732, 0x4714A4D749448, 0x2CA14663E0955, 0x46EBDBE808892, 0x566FE39EAAB20, 0x29E207A553084, 0x2DCF13D4A75E3, 0x76CBD1DEF6590 },
+    { 0x138F57508BBB8, 0x73BA4581690E6, 0x1DE64643AC377, 0x52EC69BF1D929, 0x17F2E66E5C8BA, 0x2442F2D05E097, 0x6BA452FBE9EC0, 0x12FD4A4482F1A },
+    { 0x4DC6FFF2A0A89, 0x00000035D75F4, 0x71A5D25EF9EDC, 0x0000002927C6B, 0x6DB715E9E1765, 0x00000026E847C, 0x01F667B0C47E9, 0x000000409AAFA },
+    { 0x0C2E11C1FF18A, 0x0000000000000, 0x28C470E2ADC6D, 0x0000000000000, 0x3F2EBD48FB53A, 0x0000000000000, 0x3A2FF57464951, 0x0000000000000 } },
+  { { 0x3574C1B14B4BF, 0x64F97C6DADBCA, 0x3A687541BBF93, 0x445FE1AD60B9D, 0x16E9F87390511, 0x4D0134FFF0E48, 0x41CB1F51F0869, 0x394A8D2488EDB },
+    { 0x1E9FEBE3BF18B, 0x219A7BF1B65B8, 0x30539183EFC4C, 0x1B0337FC6BE38, 0x3F1AD24644F20, 0x18806F41EE698, 0x068E3D4B8F4F8, 0x01A7E0F5140C3 },
+    { 0x152F12C0B8666, 0x73BC0518A18FB, 0x1931BAB8BB36C, 0x555ABA0A75603, 0x38DB4C07AD063, 0x3243F8C43006F, 0x4F713FEC249F1, 0x226FEE521495C },
+    { 0x092A34EA799CF, 0x000000188526D, 0x558974FE7F4E9, 0x0000000AE666A, 0x57140C1CA8B9E, 0x0000003F647B3, 0x59BB8317FDF98, 0x000000473AE6C },
+    { 0x57B694BF3EB5B, 0x0000000000000, 0x61277EA110BE2, 0x0000000000000, 0x1219263E0A2C2, 0x0000000000000, 0x1DA7978F17112, 0x0000000000000 } },
+  { { 0x66BEDB24FFDF2, 0x419D5948FF69B, 0x462FD494406DF, 0x5A0F6096A74BC, 0x4BCB48C88A2EE, 0x5925E418AEE3B, 0x4CDA7FA2DBB23, 0x5ABF26B030476 },
+    { 0x79B98238C7228, 0x00DBB48FC57D6, 0x4B380C8C0B096, 0x332125FD962A4, 0x20D5169478B53, 0x6371F87926C2B, 0x230C1A4DB9E80, 0x65D790A4439C3 },
+    { 0x568449C47D2A1, 0x73A7E6888E665, 0x1C3D5242AE6D4, 0x7291397A46425, 0x34EC04DC234A0, 0x3DAC04067EF72, 0x2A1FCC15E2CE4, 0x1AA4F2EC2CF28 },
+    { 0x159B9B64EE5F6, 0x000000500F2CB, 0x076D91AC467D7, 0x0000002074D45, 0x4CA3ACE1C17CB, 0x000000442A639, 0x433284D2E48A6, 0x0000005D1155C },
+    { 0x3521216EFC0F7, 0x0000000000000, 0x4F058BA474ED7, 0x0000000000000, 0x52AC12096270C, 0x0000000000000, 0x4080A9D8BCB1D, 0x0000000000000 } },
+  { { 0x7E0600E7CC04C, 0x01C9E92FBDA79, 0x264C6AE9763DA, 0x0E8F71983239D, 0x6AA3F7A1A67A6, 0x52151E592B601, 0x2636B637A33DA, 0x0F079E7C159FF },
+    { 0x2DB7AFD7482B1, 0x79F4D5B73B6E2, 0x76CEAF62660BB, 0x173AA737CDC4D, 0x3DCB616EA7645, 0x20D0561D137B9, 0x3C0FA2359FF51, 0x0F371174E47CD },
+    { 0x719D26B1709D0, 0x49E3BE626E196, 0x342074A1633CA, 0x7DE7A4401BA03, 0x26335230E7BD2, 0x6B1A7CF39D242, 0x63BA0BF96F310, 0x030FA1C22F598 },
+    { 0x143B8E4E27CF1, 0x0000003D5AA0F, 0x4494186058586, 0x000000216D2A5, 0x2B379C7551D5E, 0x00000045F5340, 0x50D7230BE5DC7, 0x0000005E35D74 },
+    { 0x6490DDEEDBFF1, 0x0000000000000, 0x7B369216FC4BA, 0x0000000000000, 0x0E65AF5FCBDF8, 0x0000000000000, 0x57E4DD4511706, 0x0000000000000 } },
+  { { 0x242EEA426AF85, 0x46CF8D1B510B5, 0x618CFA94221F3, 0x02C570F91A623, 0x5E26D28FCA203, 0x7224F2B74C9D1, 0x0CE2322594A51, 0x6A4AA937D995C },
+    { 0x20357AEA52F36, 0x5E95438125EDB, 0x5901DE590F3F2, 0x50596A2BEB9CF, 0x523965CA1EA38, 0x332BCD5251EF0, 0x50E76F79DBB9B, 0x47A5AE3902C19 },
+    { 0x55B159BEAF767, 0x50DCB927C64EF, 0x2F5DC161A281F, 0x0D177D96D3590, 0x695BF0BCBA076, 0x0954669717806, 0x1DC8408365AC6, 0x09127464EC5C1 },
+    { 0x675EAC35BCE2E, 0x000000367ACC5, 0x274BBA7377A0F, 0x0000002A89DF7, 0x06938024B843D, 0x00000033F4DD9, 0x42ABACAD358FA, 0x0000002F96ECC },
+    { 0x39687BE6D630C, 0x0000000000000, 0x7604B9889E6D4, 0x0000000000000, 0x379E769E61A2D, 0x0000000000000, 0x526C0FF367483, 0x0000000000000 } },
+  { { 0x6CD178AF2DDC3, 0x3DFDDB072D5E3, 0x7AB004DB7A84A, 0x5EFC42B70CCEC, 0x2D4EF0BCDD6D5, 0x3CD99A0510F83, 0x50C0C326B20E2, 0x77330F970DAC1 },
+    { 0x52ED72C06BCB8, 0x695C033D85078, 0x54F72074F4AE3, 0x2DF69E0DBEB30, 0x4FD2BD276E1B8, 0x01541AA42F5C0, 0x0483DC3C287DA, 0x435751789A538 },
+    { 0x23E09AD27F374, 0x670FB03C135D6, 0x5755C3320C75F, 0x687C862A9E0D3, 0x5A9F709E13614, 0x269BD6B61EF8D, 0x26D51A9975629, 0x37FB17C6739B9 },
+    { 0x444E6DFCB7D40, 0x000000249AEF5, 0x71FE4D9403B1C, 0x0000000A03028, 0x0F5E4F36D3C59, 0x0000004032CB3, 0x344CA525185C2, 0x00000049F2F33 },
+    { 0x14A471BB2AAAA, 0x0000000000000, 0x4CAA9FDEA814E, 0x0000000000000, 0x05F8D5667DD5F, 0x0000000000000, 0x7853C1A271CAE, 0x0000000000000 } },
+  { { 0x36D17BD3E3C24, 0x533C573BFC6DB, 0x0A1EABAD1339D, 0x626442DAD16B0, 0x76F52E12E121C, 0x7222A42B1D83B, 0x77592E74468DD, 0x6E9FBAECC979D },
+    { 0x433C352DC6E9C, 0x01ECC057BFEE5, 0x018E6F298FC01, 0x6F0FBD73083FB, 0x454675E0F723F, 0x72CCF0AAE04BA, 0x0EFB9E5315C83, 0x295517820A565 },
+    { 0x5730941E9E59A, 0x652256E231A5B, 0x49127CBDBCC3F, 0x2471416BB5899, 0x629F9B667D2E9, 0x4FE85C06236D8, 0x18C06DD15455B, 0x57E546023B3D1 },
+    { 0x67F2BEFDA4CDE, 0x0000003C482ED, 0x2BAAE609B22CC, 0x00000032483B0, 0x74E01169DF252, 0x00000044A9928, 0x4F7F8A61FA9A7, 0x000000331BDC7 },
+    { 0x571867755FDBF, 0x0000000000000, 0x229DB839DDC3E, 0x0000000000000, 0x794D202B7E6CB, 0x0000000000000, 0x0D028E2331D16, 0x0000000000000 } },
+  { { 0x59DDE45BDAA32, 0x111FE407CAE2F, 0x7FEC38101C106, 0x0440A82D65092, 0x3607E28B5864E, 0x45F1E0C0FCB85, 0x0F193F930AD02, 0x7FFC240EDBE05 },
+    { 0x3FF48029ADDB4, 0x7EF4DADA5ACC7, 0x4B87E19B7AA08, 0x0C952CD87F332, 0x737F9195FD0A5, 0x2ACCE168C72C9, 0x65848433DA4EE, 0x2D04987B9B4F2 },
+    { 0x36BA96B335B85, 0x1591669D41E61, 0x03BCF9B76B8ED, 0x67C581E207989, 0x59001E3D75729, 0x61C3D00D39A16, 0x43B13A6F8B2E4, 0x3411C1B3101A9 },
+    { 0x4A53034C6BE4D, 0x0000002F03D34, 0x45D345CFC8C94, 0x00000020A60C3, 0x210E692BAD85D, 0x000000370603A, 0x6534D1244D2E4, 0x0000004EF76E0 },
+    { 0x0A8D07F71CE75, 0x0000000000000, 0x305EE0F31B77B, 0x0000000000000, 0x6B452431EC921, 0x0000000000000, 0x5B0676813B9C2, 0x0000000000000 } },
+  { { 0x0968256C3ED5F, 0x71833B786D5A8, 0x1F49A7313F9A4, 0x40C5E071739C4, 0x4B76CDB9CF983, 0x7A178855F6A3F, 0x0E187C8303A2A, 0x4D4303C77EBDF },
+    { 0x21673FC406F6E, 0x4FD2B0BA8E34A, 0x697D13684A3EF, 0x7CF0420E2B686, 0x215C2651D771C, 0x491C8205ED6DC, 0x34C197419E1F3, 0x0052B14100596 },
+    { 0x7A9C17E65EB2C, 0x3513702324169, 0x754601A99BF9B, 0x20933BA206660, 0x49F5C1DD1DD3A, 0x51ACCF8A189A4, 0x2F30AA6BC0C86, 0x54C5599C9C0CD },
+    { 0x1A1175B9C33BE, 0x00000077A1439, 0x0C8A0C32D97A6, 0x000000421E0E5, 0x55B4797FB4371, 0x00000044F6B6D, 0x26B74581F1BCA, 0x000000433E99F },
+    { 0x5F8359F4ECF4A, 0x0000000000000, 0x18E1B8FE60035, 0x0000000000000, 0x5E8E10BDC7300, 0x0000000000000, 0x1171E486F6E68, 0x0000000000000 } },
+  { { 0x654BF21FAEA46, 0x4E44D847732C9, 0x27B515C6D61DE, 0x1CDFE44E0B474, 0x61CC5EDD52D84, 0x7B80EA09D8DE6, 0x1793D7891DF92, 0x0E53D51490645 },
+    { 0x3CA21EA5A9728, 0x7D1EC3F97A90E, 0x785F040ADD0B8, 0x007A0AB6AF3C8, 0x355A72F05631C, 0x4A99E19903416, 0x773B72D5939C6, 0x3339C904C5B4B },
+    { 0x18D606AAF838D, 0x5EB9205555D1F, 0x0022EDCE3FF29, 0x122DE6F004975, 0x0CF137459C80F, 0x40DBB3BD57120, 0x682CB604403E5, 0x545AC22A3A380 },
+    { 0x0B781DA1CAEE6, 0x00000055531AC, 0x47A41942B4041, 0x000000160F034, 0x4143E96176A86, 0x000000520D9F4, 0x47F6E7130C424, 0x00000050C2B8C },
+    { 0x56575CD5E334D, 0x0000000000000, 0x694BB42A0B985, 0x0000000000000, 0x4002772FB9681, 0x0000000000000, 0x08BA5192D55CD, 0x0000000000000 } },
+  { { 0x52292AEE2F604, 0x617F9CA5D1138, 0x39A6BEA55659F, 0x676B75BDC2D10, 0x6C80BFC35F0FE, 0x172C4EE8530AA, 0x6048DE3995693, 0x172874FD679E1 },
+    { 0x4586DA698C05E, 0x5E011967A71CB, 0x4F103635CDAAB, 0x1E13B6FDB2353, 0x54B9EC213BFCD, 0x1DD744825E1D7, 0x6EA208DCFBEDD, 0x2296ED90962C3 },
+    { 0x408D64503681B, 0x17F5CF07DBBFD, 0x57DFE52DA9A59, 0x1F07854D46367, 0x63613D7D8224D, 0x7E8921E4434F6, 0x524DEA4AC2871, 0x3C7D5EDDD678A },
+    { 0x554E080449BA6, 0x000000510BDEF, 0x5F9E19CF47C83, 0x00000043530EA, 0x17D55056F208F, 0x0000001E5FD7D, 0x18A5DA69DA3D7, 0x0000004863C36 },
+    { 0x0BFF67927EE10, 0x0000000000000, 0x569C396FB1CDC, 0x0000000000000, 0x7098D87A43F00, 0x0000000000000, 0x220583BF9AD29, 0x0000000000000 } },
+  { { 0x0FBA85932E4BF, 0x459838F1A7675, 0x519FA58DCFD54, 0x20DAE4DEAABBD, 0x04825BD7B7B8F, 0x000002193CDA6, 0x66A7176438D06, 0x7B94E2CA8D43D },
+    { 0x71115D13229AF, 0x6058927CC385D, 0x3C23DC24CB9A0, 0x395FC365D0C1D, 0x5CD690A3508CD, 0x54B3E748DF0D5, 0x5682BD642FB99, 0x4E29CB4B2C9F2 },
+    { 0x2560263AC76F5, 0x36E781B3D2561, 0x0903A7A0ABDEF, 0x7EB9FDD0C76FF, 0x6F09D7A15DB6F, 0x0A48D09509944, 0x701506E77CAA2, 0x558D1CCB43AE5 },
+    { 0x113BC76B2C075, 0x00000027B6C5A, 0x6DD43B56CDA57, 0x0000001EA9700, 0x4833C169A4F41, 0x00000034D2922, 0x6F3AEBE4FD8D6, 0x0000003E1B625 },
+    { 0x02FDAC973CDD3, 0x0000000000000, 0x011700757301F, 0x0000000000000, 0x0265796D5502F, 0x0000000000000, 0x45FBC4AC9EFCF, 0x0000000000000 } },
+  { { 0x14947669654F9, 0x17D54E8517D72, 0x511265D0A4B23, 0x59B766774D1FD, 0x3BF13A72614D1, 0x5CE88B727F87A, 0x4F8A647A50E7B, 0x68D1DB352FEE5 },
+    { 0x00CD698865CEF, 0x4C076895E5315, 0x0E97D89699DA7, 0x36096DC1B31FC, 0x1438FADF05244, 0x620F91128F6E1, 0x231E5DC14E063, 0x473F61EA35D31 },
+    { 0x0B26A882009E6, 0x65CC9F8AAE6BF, 0x209217913E897, 0x03A300EB3768E, 0x24CCD69149DCB, 0x466141AFA0568, 0x380E9695E428C, 0x191462EEC9C4A },
+    { 0x0FF58CF9F9776, 0x0000003D066C9, 0x150DABF698302, 0x000000332F0B9, 0x625E70DE1A2B3, 0x0000000E64EBE, 0x44C31F84C328B, 0x0000004195BCA },
+    { 0x4131AAF5DC7CE, 0x0000000000000, 0x0F0F9439CA88C, 0x0000000000000, 0x0B4733F25C9E8, 0x0000000000000, 0x11CE10982F9A0, 0x0000000000000 } },
+  { { 0x06844F3671A81, 0x0812C949A6CDE, 0x65C878FEB0EE3, 0x084F26F7154DB, 0x538E879851F33, 0x639AB50632E2C, 0x06F9E41E2513F, 0x40EAE1A8CDFCE },
+    { 0x53C797FFC2A4D, 0x00DBC6D52C537, 0x0843BB1FEDC5F, 0x04E11E5A6AD61, 0x72D5768699937, 0x3AF065C89E75C, 0x4976E241AD2D1, 0x7C691592C0A55 },
+    { 0x1273C5692EA17, 0x60DCB2B1678AD, 0x76A8D656B7025, 0x33BF01564AC44, 0x1AEEA5BD4051E, 0x02A80A3B34606, 0x6E546E8E61FD9, 0x50B86BB9587E7 },
+    { 0x2D4F2D5AA6114, 0x000000242F1D8, 0x3BDC05D7FD5C1, 0x0000002464CC3, 0x1C2574E7AA0B6, 0x0000002BFBE85, 0x382A07D7C35E9, 0x00000063FD979 },
+    { 0x51037DA79F663, 0x0000000000000, 0x4ADF99E7EF750, 0x0000000000000, 0x10C852CED8269, 0x0000000000000, 0x2476D7E9350B2, 0x0000000000000 } },
+  { { 0x28866C30E5B8D, 0x263BA57C92475, 0x0BD227815294A, 0x5FAF4E999814C, 0x48A1F4CD10835, 0x7ADBDB8912669, 0x3E51CA226D680, 0x66E95827ABBC3 },
+    { 0x093E651658F87, 0x466EBD9398AEC, 0x4763FB79263FA, 0x09D96F8BA93D7, 0x66B9366F40E58, 0x2E90996F3F8D6, 0x1522A914803E4, 0x7DD0A7CF6E48C },
+    { 0x4E2BD019473E5, 0x1952B940CD9D1, 0x7ACABB1E2FCFF, 0x3BBD2DA8984E0, 0x12F87BDDDE784, 0x293CCE10D0EBB, 0x30E8E2D88212C, 0x6B582F9F58630 },
+    { 0x5A63D0C6AC1EB, 0x0000004D6ED7E, 0x2E45189F738A0, 0x00000027CD1C1, 0x1AEF3C7168D5E, 0x0000002B71B8A, 0x14D25A6BDC37E, 0x00000030A5394 },
+    { 0x2651C94E13324, 0x0000000000000, 0x1229C05AC84D7, 0x0000000000000, 0x39256A981F434, 0x0000000000000, 0x4397F32CD898F, 0x0000000000000 } },
+  { { 0x2670F711DF58B, 0x6B10BE3A0DA56, 0x7FB77501FA82F, 0x0AE19DD67734F, 0x26885DC0E882F, 0x3BECC0B416F70, 0x02A2F4C90DACB, 0x65BB136784E8B },
+    { 0x4E00EF9C23F79, 0x3A9DB68C9478B, 0x096FC1678EB5C, 0x15B522D71B0D7, 0x342513980EBD6, 0x1FFA87D37E19E, 0x5A552DB4651BB, 0x516FA761B643B },
+    { 0x6C022EF36289E, 0x02FADA3E5F538, 0x56D1BBDB76BE9, 0x34F6259E40EFC, 0x71C38CF7F3809, 0x6AA5D63F4651C, 0x6AD7A436EE00E, 0x720A7897B06E8 },
+    { 0x79438394C032F, 0x000000603A719, 0x08EE6941F29CE, 0x00000013D7DC1, 0x4E8CC6AB831F9, 0x0000004274A64, 0x390DC838757AA, 0x000000541DBAE },
+    { 0x0DB2A201B4CD7, 0x0000000000000, 0x3C164E1169C08, 0x0000000000000, 0x04B188C0C11A0, 0x0000000000000, 0x027697712C7F5, 0x0000000000000 } },
+  { { 0x3F4A867EF1F9F, 0x28116A68E9296, 0x62AA999686153, 0x13F23A4B77159, 0x7EB27028342B1, 0x7C4256BF2F32B, 0x147A7068A6F4F, 0x61B267FD299A5 },
+    { 0x300AF7BF48142, 0x3E7C2D0017E8A, 0x42F25E545A234, 0x6900ED2E67DA9, 0x2D99314E737FE, 0x70D0D093217AA, 0x3FF954378A317, 0x7EDAB04F288B7 },
+    { 0x06979D6B87DFF, 0x69CC0E00BD53E, 0x3D1BA29DC498B, 0x16CC363EFB715, 0x3B8D4C9B06D13, 0x2B221DB01B333, 0x6DC50B440514E, 0x08677BD5C4AFE },
+    { 0x03C6562E4008B, 0x0000001B3F116, 0x28CDCE60E11FF, 0x000000122B5C9, 0x2D49B9FCA346F, 0x0000003BDB99A, 0x5D81A878D857E, 0x0000003ED90D4 },
+    { 0x3B59D04A4AC22, 0x0000000000000, 0x39A9C9FFB2744, 0x0000000000000, 0x29FB1BD6FF23E, 0x0000000000000, 0x450CF843BF3FB, 0x0000000000000 } },
+  { { 0x0466CD6B60D73, 0x3205A0AFB5274, 0x2C21ED10A2F9C, 0x68EC22A2B9DFE, 0x704C4B052A283, 0x39E6702950DBF, 0x2002B58FC0220, 0x09990712E7832 },
+    { 0x0FDEA9C1AE74D, 0x6B8AF1C46D0A7, 0x55031A38B8F3B, 0x61DCAE277B7C7, 0x14F83C28FAC2A, 0x11893A5A56867, 0x3A59CAA4298CD, 0x163BE316F33B2 },
+    { 0x527E45291F5F3, 0x27A4B0B9D860E, 0x1CAD330A11EF6, 0x46CB07AA84849, 0x6F607A6D6DA43, 0x7D06FF8F899EF, 0x62819B6850CA4, 0x03EC1AA852532 },
+    { 0x156B711771F36, 0x000000462B624, 0x0C5185A2D3958, 0x0000001631935, 0x2A12DCD912498, 0x0000007FEEC22, 0x5CC3C60E6F8FD, 0x0000004AB4713 },
+    { 0x208AE8E59CC29, 0x0000000000000, 0x59D21A6006D3F, 0x0000000000000, 0x03D7153520C5A, 0x0000000000000, 0x4DBECA8786A70, 0x0000000000000 } },
+  { { 0x11065CEA70F32, 0x4FB46E0CE662A, 0x78749FF93ABF8, 0x5B24BC0A3F9D6, 0x6283C6E884130, 0x3228883EDD41C, 0x62AA177D98322, 0x7F1A1D3C9688E },
+    { 0x0B40FEAC9DDD2, 0x0E39AD31C2ABC, 0x4CB4D47595920, 0x73E8EDD68C071, 0x621849EA9395E, 0x39A32A99F07A0, 0x0FC0ABED97A68, 0x1DEC8AA5C3B70 },
+    { 0x37B634BE0698D, 0x6E2E017B955F0, 0x4321B2F16C9E0, 0x53D1D98C92BB0, 0x4C1D61536A84B, 0x633D643DDA2D1, 0x7ADF434C6D6EB, 0x6602D230C00B1 },
+    { 0x704ED1E7D5469, 0x00000056A9C33, 0x09B6292D82884, 0x0000000AFCFD3, 0x6C1363C8CCD47, 0x000000461E452, 0x652202D4FE5A7, 0x0000004160037 },
+    { 0x43715A12DC662, 0x0000000000000, 0x0A692CA58829A, 0x0000000000000, 0x0812AE11DBF62, 0x0000000000000, 0x764FA0B75DC35, 0x0000000000000 } },
+  { { 0x2F340A8602859, 0x654F897E1CAA2, 0x6BD836FC465F1, 0x242EF0CEDBD3F, 0x49A56D4D31E19, 0x6E2AF2829E372, 0x218212BE87805, 0x151475836BA1B },
+    { 0x0BAD7721A6E30, 0x49BDE2DB98CE9, 0x02BDB704874E3, 0x0F36BCAD8EC8F, 0x383F84A88EAF3, 0x5E2ADECCC9305, 0x5F1885BD38B36, 0x551B93FA40EAF },
+    { 0x66883A0323301, 0x46EBB009C1DB8, 0x184897FE2755D, 0x73AC29A344E0B, 0x129B481CF7D26, 0x11F02A5388303, 0x45943711938E5, 0x2C239F76ED7BE },
+    { 0x284DE65F4BFA0, 0x0000004E40326, 0x08D4D36441F50, 0x0000003C028BD, 0x43860E1B7F451, 0x00000021324B4, 0x458EF6D23F522, 0x000000481EFCA },
+    { 0x6DF6FDA49E55D, 0x0000000000000, 0x1CD6F277BB162, 0x0000000000000, 0x548989E8DC3AC, 0x0000000000000, 0x51FBC4160BA9D, 0x0000000000000 } },
+  { { 0x10121F29ED1D7, 0x3C39484D5F5E1, 0x4448141E82529, 0x554E2935FF1FD, 0x6AA1E821765A3, 0x3DB7FBCD38B87, 0x4F20052B023C7, 0x7243C4C9DB38B },
+    { 0x225FDFD5B5FC1, 0x1E8510B3E5446, 0x24AABBAA0A6B9, 0x52F6A14CADE9A, 0x5572ECEEA19B9, 0x3B3084FA03DF8, 0x55502DA5A0B88, 0x5A0331C308F5F },
+    { 0x30A1F45C9B942, 0x2727777F39A18, 0x1BD1D6AF20E57, 0x1005C4E5AA6CD, 0x6335E9BB696B9, 0x15123B681CCF6, 0x1C03849543A39, 0x0410D5D1067D2 },
+    { 0x1517E182BEDFB, 0x0000002A3CEE1, 0x1F67B187386BD, 0x0000001DC945C, 0x357CCE9B86CC4, 0x0000005E1D602, 0x553DB9B8A45BD, 0x00000054F72B5 },
+    { 0x1B770277F47E8, 0x0000000000000, 0x70D43D4472713, 0x0000000000000, 0x729AF3FDFB924, 0x0000000000000, 0x25A41AD1CECE4, 0x0000000000000 } },
+  { { 0x19DE485D4166C, 0x54960FAE12E16, 0x6BE60947AC5E1, 0x349B993093A39, 0x6962928B02916, 0x0060CE40F63D7, 0x52C8B9F4665FF, 0x55AD5A102A1F4 },
+    { 0x1AF5B44C496FC, 0x0B6722ED528E8, 0x677CA16D8DF0F, 0x5193AE070AE44, 0x2240C4CCFD02E, 0x0615FD583DA2E, 0x2FC928AB72FE8, 0x49074B0004E0E },
+    { 0x5F383DC930600, 0x6C45760AFA6A5, 0x5741FB155DB78, 0x6A5CAB14982E7, 0x23E50776D8D36, 0x6342B1961FEFF, 0x643E94B04502F, 0x42C2A621D1AA2 },
+    { 0x5DE97E47ACEE4, 0x0000005634F1E, 0x42F6D17E8449C, 0x00000021B547F, 0x756025449B02C, 0x00000024737BC, 0x121ADB391BDB2, 0x000000254B498 },
+    { 0x0A8CCECDC35E6, 0x0000000000000, 0x544AD6E687155, 0x0000000000000, 0x7B89A24DD3C4D, 0x0000000000000, 0x4B1BFE3643923, 0x0000000000000 } },
+  { { 0x092800826B408, 0x260D4C6BC91DA, 0x6647F06698ED9, 0x3B6CFB599E30D, 0x1F8070B7FF6E8, 0x2FFEDA28C7DA0, 0x3E07DBBD60B5B, 0x48172CD5723B9 },
+    { 0x4B96848A457EB, 0x13B54F8D51432, 0x55C19D195E39F, 0x3C72B6FF00CDA, 0x586A84937585D, 0x3692DCC9C5E6B, 0x5E412A868391C, 0x35FBBA3F861C3 },
+    { 0x40D23745896A8, 0x19C9A5C08CBE9, 0x43A31910B808B, 0x5489B5C7265AC, 0x1BED5683EC0D9, 0x56D3853FD8EED, 0x242D8273A7C5E, 0x30F3C1C9DA32A },
+    { 0x77C9667A6B5C4, 0x00000032991EA, 0x761D77351FEFF, 0x00000026F7985, 0x6531DF8D9EDBF, 0x0000003CE9E4C, 0x12C7BDDEB0DA1, 0x00000057CD902 },
+    { 0x7DB619E69A67B, 0x0000000000000, 0x32EF621D59FE2, 0x0000000000000, 0x678FDB4350CA5, 0x0000000000000, 0x3903FFD40216C, 0x0000000000000 } },
+  { { 0x223DE3306B904, 0x003B335E8B4B9, 0x48BCB434DFEAC, 0x77374280EEDD4, 0x0BD2342B4D0C6, 0x58B03A8261110, 0x0E29488446310, 0x070D96C14F82C },
+    { 0x4BC3A501D07DB, 0x62801F502A7E2, 0x05D94C6EDDBA9, 0x0C69993ADB29C, 0x6841AC73474F6, 0x191578567C96F, 0x0D0AEE45C2AF4, 0x52E7CF3506122 },
+    { 0x6A910E43135E5, 0x14C88D2208328, 0x41C390886BC9B, 0x258C1626B9BB6, 0x19B53AC7B7D46, 0x08D6C63CA2278, 0x5EB837F5F20B5, 0x5CB8A173E2483 },
+    { 0x45B718C793E96, 0x00000014BF927, 0x2A0A3331E1C48, 0x00000037BD4A7, 0x3C75D3DF99843, 0x00000037ADF22, 0x1508B8737B248, 0x000000553907B },
+    { 0x5891201CC248B, 0x0000000000000, 0x2C6F44AAE3E38, 0x0000000000000, 0x1951CF1A2576F, 0x0000000000000, 0x150159080B81E, 0x0000000000000 } },
+  { { 0x3D57D5D391BE5, 0x18A070E2388BA, 0x42CF193B35272, 0x2592877C407E4, 0x1E4D32F13B111, 0x495383E2F80F3, 0x11FF6DF9F3ADE, 0x0270F5C8B6A1D },
+    { 0x0D862C1186F33, 0x64D63E8B50A73, 0x61A3FD7487C7C, 0x1B8A2EFFAFD9A, 0x4D2CA1F3421A7, 0x08A997491955A, 0x0E866F4E0CA01, 0x6F81C86E65D9E },
+    { 0x4D05BBC8B062E, 0x3CA6482399435, 0x4FF3B954132C8, 0x21CCED5B26573, 0x1B25388538467, 0x5D8F26CA6832B, 0x7CD8D755F442B, 0x32657B721F73B },
+    { 0x73486919AA15B, 0x00000038753A9, 0x36411588EA9E3, 0x00000032DDE6E, 0x371B13BD3B016, 0x0000007E8D6E9, 0x24AA8D572D341, 0x00000051142E2 },
+    { 0x4C573215607C6, 0x0000000000000, 0x6EB51F2DA8F57, 0x0000000000000, 0x1934C0091E7B1, 0x0000000000000, 0x28C38082991E5, 0x0000000000000 } },
+  { { 0x08AEDF70B65A6, 0x6E97DF171F7C3, 0x6CDD20E5349F4, 0x7E3A6571ABB7D, 0x5F2198D088360, 0x6466E4569F740, 0x1523CDD654364, 0x588AA8737A6EE },
+    { 0x232795DF8D303, 0x44E03273EE1E1, 0x21C6E2EEFECC7, 0x37363C0B2E722, 0x7FF6C88582BD2, 0x35CC78DC6587F, 0x78F9D7E61D159, 0x635FE7A0E540D },
+    { 0x38A74BA91C790, 0x563D19504EBCA, 0x090CD8991F863, 0x72F440C075449, 0x0C83B549649C5, 0x2A81631F88CFB, 0x7CF1B31D9675E, 0x6EF7B527EB92E },
+    { 0x1E89FDE982FF4, 0x0000006DFF877, 0x1F8F5BE280516, 0x0000001FB3391, 0x733C418CB0036, 0x00000028CD1AE, 0x0E65722526333, 0x0000005723E08 },
+    { 0x62C3079F38034, 0x0000000000000, 0x5D44909AA5A0E, 0x0000000000000, 0x25A94FFBAE7C3, 0x0000000000000, 0x407785354F3BC, 0x0000000000000 } },
+  { { 0x497DCBB430357, 0x092C8F01AB8DD, 0x58F7CF684D872, 0x363F7436D79AF, 0x1CB13F9D78B9F, 0x489BA1B252EDF, 0x4C2CB6267A0BA, 0x4F0BA4C656B75 },
+    { 0x323D496CF6C32, 0x231C24F4868F1, 0x3C94FD11D1F1A, 0x1755377E823DF, 0x369BCEBD7537F, 0x3F45253A09856, 0x1E423FDB421DC, 0x227062043F250 },
+    { 0x7CCC6859E8D8E, 0x7F3D26A4A2DA8, 0x08025FF01B72C, 0x78B2F1C20138C, 0x69EBD7EA60DC1, 0x4FF4933E13220, 0x524609777E231, 0x64ADC8F4CA922 },
+    { 0x35A36DF1296FF, 0x00000034E975A, 0x5822B3B9822BC, 0x0000003F01CA1, 0x2AF60314745FC, 0x00000046E3453, 0x03CBB8ACC071A, 0x00000042F83A5 },
+    { 0x7AF75D532F0A0, 0x0000000000000, 0x16D84124EF89F, 0x0000000000000, 0x34F1955F29303, 0x0000000000000, 0x799F583F37CF5, 0x0000000000000 } },
+  { { 0x046D4CD4185E1, 0x43F84F98EDE84, 0x00013DC6018ED, 0x0B66DD449666A, 0x40E96BBC7A8B9, 0x73640A891155B, 0x39AE5E1A88779, 0x7BFADFBB2214A },
+    { 0x09CC85F238F42, 0x64DCCD8492C1A, 0x3B2E55653457C, 0x4088E67E3CAC4, 0x7FE8F2F9710E5, 0x2DC65AD5B0B73, 0x04F33D1FE1C97, 0x675DF3ED1AC4D },
+    { 0x38C66220ABF34, 0x2B5A7CD2244B0, 0x1625A1F6C3294, 0x765735D2F35B1, 0x507B380805026, 0x3DCBB2423591E, 0x0360B4EFB469D, 0x24FDAFAD93203 },
+    { 0x6EDB3AAEFA203, 0x0000001D007DD, 0x56AC6A45FD551, 0x0000001E9EE2E, 0x14D609BF152B0, 0x0000002B8B131, 0x6E77E6026188B, 0x00000032DA98C },
+    { 0x3F8048A41C356, 0x0000000000000, 0x317F406352A6F, 0x0000000000000, 0x0F3C8D2B2B941, 0x0000000000000, 0x4A7D60F55B4D8, 0x0000000000000 } },
+  { { 0x0156E9BBB2565, 0x015BAFBE32804, 0x7A71C78268530, 0x7ACA08E683715, 0x60F9A819FFFD1, 0x5820897AD340E, 0x553ACFD1CFAA6, 0x4F4FB58140394 },
+    { 0x5A25B152596F1, 0x6025A148A9D88, 0x2F48B916C79D9, 0x1AB2FD146CA4B, 0x701A21BB44305, 0x1B15580F03D42, 0x6381C24328F10, 0x496D1EE7D20C6 },
+    { 0x472E43A5521F3, 0x6CA94447C654D, 0x6024A63FC357F, 0x1A393781A9F48, 0x1F176C5C93979, 0x5CB54C21BB278, 0x39460BBC58FB0, 0x65F98588F3CF7 },
+    { 0x20D034219B6AD, 0x00000066FCD5A, 0x5E32C0AB6BCED, 0x00000029E71A7, 0x69D18E1620AE3, 0x00000032C9AA5, 0x109E425FFD018, 0x000000304DA73 },
+    { 0x03F44D456C98F, 0x0000000000000, 0x2625D82A4F44C, 0x0000000000000, 0x59CD2B109D412, 0x0000000000000, 0x12DBA6488CC2C, 0x0000000000000 } },
+  { { 0x0C8BE65F38587, 0x4D9526CDDAE3E, 0x0C5A04C34C67D, 0x282B266744AC2, 0x16BE731C96A39, 0x2AA43CAF9D312, 0x502879DF0D7D3, 0x7AFA60D733B45 },
+    { 0x633EE3266B008, 0x1DFF16166FB2D, 0x63B7AF5CBAD3A, 0x4A97F365B611B, 0x26A9009080D42, 0x48811C498B58A, 0x696064EB23D21, 0x1D1E8C7222205 },
+    { 0x0D2F5A4704D32, 0x042BEAB865B07, 0x0BF82B47FDC83, 0x753B4C2057C7D, 0x495600A8E2DFA, 0x1C39449AB485A, 0x3A6E42A68F366, 0x08EE5BC7B1BCC },
+    { 0x3277693CBD162, 0x0000006979347, 0x6C9F8F715989F, 0x0000000C184B7, 0x65AE9F6F066BB, 0x0000002FE2483, 0x7BA24E8895CED, 0x0000003E1C423 },
+    { 0x52A4324A9632E, 0x0000000000000, 0x55EA1EFFFD915, 0x0000000000000, 0x2490D51A29A26, 0x0000000000000, 0x481EDA7960A5B, 0x0000000000000 } },
+  { { 0x4C9F9120D7775, 0x06488C762AC7A, 0x2626B4BC39E97, 0x64EB0D8D99551, 0x173DE95EB551D, 0x6ACF141E604FD, 0x0123A7E66029B, 0x41E7E6D3CAC91 },
+    { 0x29BBC4A70EC83, 0x68EBC65A42E71, 0x049DEF9232BC7, 0x05617A413B812, 0x2A74A3BC7554E, 0x6D3173B6855E8, 0x61C0FB4F2CA9A, 0x153140ABB3161 },
+    { 0x5AC34E19D1FF9, 0x37F412B61FEE2, 0x34EC806A91760, 0x45CE2C37E07E9, 0x10E5039CB9179, 0x0447E304499DF, 0x23D1C13AAE58B, 0x0780DC89C17D8 },
+    { 0x00835D496E9A0, 0x00000067C3C50, 0x3BBE0FD916489, 0x00000022D6CD9, 0x38659871AB844, 0x0000004C36B0F, 0x3FA3C54CF185C, 0x0000002B90E8C },
+    { 0x1DF275F0BF672, 0x0000000000000, 0x0F582D5D744BD, 0x0000000000000, 0x76736E542276F, 0x0000000000000, 0x61EBE00BF524E, 0x0000000000000 } },
+  { { 0x7C45700551F3B, 0x7D16757C2B52B, 0x7B1678AE19440, 0x177DF54A885DB, 0x12BD11EC5A3F5, 0x14BD32341598B, 0x798B4F3D9FCCC, 0x10600EF92E787 },
+    { 0x4201B92EDEE34, 0x0BF2731122246, 0x58540E2AD3B67, 0x72658653534C1, 0x1159B25A16509, 0x661500BB9D1A8, 0x3C6635A7AA5A5, 0x6249EFD7C142A },
+    { 0x5A2192757CD4C, 0x681F97B9EEF9D, 0x6DEF95C3D599A, 0x070FE9500A55B, 0x08D5F70EFD71F, 0x09B712B84EE06, 0x67BF219941757, 0x1BD583D164ADD },
+    { 0x6DBB1A1411F0C, 0x00000066BDF15, 0x458F6E6693BFF, 0x000000331B339, 0x6C947535738E2, 0x0000002D96C68, 0x0900FEC0D34B3, 0x00000034B12B5 },
+    { 0x56E7107EEA77D, 0x0000000000000, 0x14B196B19E114, 0x0000000000000, 0x29CAC449142EA, 0x0000000000000, 0x45407C2C62B61, 0x0000000000000 } },
+  { { 0x79CA16A3B33BE, 0x22161E3A3B173, 0x6731051F88F21, 0x7A6A3F8B162B7, 0x52B80444D823A, 0x5895DD9C157DE, 0x3CBACB4A16BFD, 0x354ADD4E7C566 },
+    { 0x7EF0C77DC62B3, 0x6A4CB2F06A144, 0x546A6D6EBA2E8, 0x111E07AA62951, 0x16DC49958AEA8, 0x35CF9BB448116, 0x7011DF573098C, 0x2223B243223E8 },
+    { 0x61E162236EEDA, 0x68A32D5A82424, 0x63BCEB5A17969, 0x43F298DB0EFCE, 0x4D6B6BCFA0815, 0x7B9F0EBABB4C7, 0x4FE7657B90636, 0x3A4A0F8C027C2 },
+    { 0x379FB79515253, 0x00000043F30BC, 0x14AEF25B0E962, 0x0000002231844, 0x4250E41934483, 0x00000017B9EEB, 0x677A49E34917F, 0x0000002BF06F9 },
+    { 0x07F7D374D867F, 0x0000000000000, 0x240AD1A3DAAA5, 0x0000000000000, 0x4135CCB65FFA4, 0x0000000000000, 0x5419BE691C391, 0x0000000000000 } },
+  { { 0x11AE46C21BAB5, 0x19BEC7BB11988, 0x575B3432DC4B3, 0x03DA38C68EB8A, 0x5D492B5373E03, 0x7BA5437560849, 0x6E8FA720C8F27, 0x23007BBDD6674 },
+    { 0x72A9D2841DF08, 0x74378FCBE51E8, 0x46FA18521830E, 0x0CC9B87C183C5, 0x3B8EE83330F87, 0x07017A0F4A53A, 0x3B3BC0A47EEA1, 0x10E4865AA1BAE },
+    { 0x0050FDBDC4A62, 0x0DE0252EE6FE1, 0x0BA6BE9547B0E, 0x0204EE408DE11, 0x728824896C08E, 0x758D1974DA6D6, 0x17879F662A2A8, 0x004046EE15398 },
+    { 0x42F10176910BD, 0x0000005EE6040, 0x568395FBCA34B, 0x0000003315984, 0x398E5016EE4A8, 0x0000004686D38, 0x3B6BA7248F475, 0x00000045D8901 },
+    { 0x19CC65BB26428, 0x0000000000000, 0x06583E65C5BD1, 0x0000000000000, 0x2163A5F3D90E7, 0x0000000000000, 0x6E99305A4087F, 0x0000000000000 } },
+  { { 0x5B2E25D5FA1AC, 0x6CD86099CB0F9, 0x0B7214D183016, 0x5DDA92EB14821, 0x246EAB0302F76, 0x71FE6BBE93833, 0x30AE27DD74ACC, 0x39D9512E9D11A },
+    { 0x53BC3FCC49A59, 0x6CFC4394A952C, 0x167D6EBA90C00, 0x7DC73BD4AE30B, 0x6A9266CBFB1FD, 0x1D27306D5EF24, 0x1879F4F86C3DA, 0x6B1C0E06998EE },
+    { 0x795B69D9CFBEF, 0x0E39B3778C9AB, 0x376B21FF47703, 0x71DF8DDC80E50, 0x209079546CD62, 0x381DAB2E6BFAA, 0x3C9531644EEE1, 0x64619E700824B },
+    { 0x5822BDA96F4B5, 0x000000448085D, 0x0FFFACEBB9BD6, 0x00000029EDA23, 0x7DE071B5DF578, 0x0000003CF6ADB, 0x109C5351D9DF0, 0x0000005E9EF51 },
+    { 0x3518933407FA2, 0x0000000000000, 0x32BF1DBD658B0, 0x0000000000000, 0x1F553BBE87A25, 0x0000000000000, 0x286ABD73E0B53, 0x0000000000000 } },
+  { { 0x34F891AEB2ED6, 0x3087425A08704, 0x24E1B8B056A45, 0x58F61E0F3E87E, 0x044ECEDEB435A, 0x19457C0924F92, 0x68CC524025E2F, 0x1EEDAF0B5FF7E },
+    { 0x5A06819026CE7, 0x18F559CE3BD3C, 0x06D700CAA4084, 0x536A1302F4BE8, 0x59C9623CFE5DA, 0x55F2092A43B8A, 0x1848EDF39F2C0, 0x4CA4EF725DDAE },
+    { 0x4724B8D3DC8FD, 0x6ADD372214A01, 0x775A6C72C93EC, 0x663452A9A1577, 0x140F36E1F040C, 0x23FEA918E40D7, 0x1C42E554EB121, 0x6495275B765B5 },
+    { 0x7207494E9ED60, 0x000000224198B, 0x49CDF2D0CC607, 0x00000025EFE45, 0x287529AF34570, 0x000000576C0C7, 0x646E8B42E71B1, 0x00000066446EA },
+    { 0x4F7538F73FC3A, 0x0000000000000, 0x400826ED7540D, 0x0000000000000, 0x5BF24CB650469, 0x0000000000000, 0x1C11C865C0A53, 0x0000000000000 } },
+  { { 0x1EAC0625AE15C, 0x6FDE1BD2B5184, 0x544BD92142674, 0x48061D0E56D9A, 0x65EAD7CEFEB4C, 0x3390973704F1A, 0x6B0E5A294238C, 0x2A0D5C381C5FE },
+    { 0x57BD4A804449C, 0x2EE336C8A0327, 0x7F1AF643A147F, 0x07AE59797ED04, 0x062B9146B553A, 0x5791B30E18DF1, 0x0E0976D852918, 0x41338F1B24FA5 },
+    { 0x55F36BBAA38E4, 0x51EFBE861B7A1, 0x2FE55F3052776, 0x2FFB8CD48EF6D, 0x73F0D571E0A9A, 0x792182A7C19AD, 0x39127B3FBC94A, 0x128857DED4FD7 },
+    { 0x1153CB0EAEC18, 0x0000006B11C05, 0x793AFBE26A74B, 0x0000001084159, 0x1437C096D3938, 0x00000057EA5E1, 0x5F1B213752D45, 0x0000004AC6E04 },
+    { 0x56F4A0FF952AC, 0x0000000000000, 0x3934FC1D05498, 0x0000000000000, 0x61CAAE6DAD632, 0x0000000000000, 0x1E48253BE14E9, 0x0000000000000 } },
+  { { 0x7413C636EC127, 0x4C00CDC0BB3B4, 0x50AD85371829D, 0x59B49F80BD38B, 0x5C2C187759319, 0x18921899A5502, 0x24DF10AF77B35, 0x49AC875371B11 },
+    { 0x0E884C407093A, 0x2A6DDDF28B0D6, 0x04E3E9AC3F6AD, 0x3FEFA17FE6436, 0x7DEF873C16E4D, 0x647695B2E3B8C, 0x25FC3020D1A5C, 0x351AE985AF62C },
+    { 0x3807472053E9D, 0x7C89D49D4932E, 0x7DD79697AE483, 0x2398058737DFF, 0x41BA314EE28F7, 0x7E033D1FD53A9, 0x75A0E4E0C4A1D, 0x2BFEE4443667D },
+    { 0x169B1196336EF, 0x0000008BB0265, 0x25C52A9986958, 0x00000023E31AA, 0x322DFA7E1E6C2, 0x0000004758911, 0x777DDEE24AC74, 0x000000293BA15 },
+    { 0x25269E80D40E0, 0x0000000000000, 0x5CE92AE6DCB9C, 0x0000000000000, 0x68A754FE928BF, 0x0000000000000, 0x7C4A42C0A340F, 0x0000000000000 } },
+  { { 0x46D3BC7061758, 0x531A1E3A3578A, 0x32C358E1B6B1A, 0x0C9AC98944ACF, 0x45F404C9EB5DC, 0x0E2CAB0093B1B, 0x129D306B09118, 0x08748EEA84DCF },
+    { 0x4278772F71015, 0x114067D419E48, 0x585738AF2521C, 0x4C42716349E04, 0x1551AE16B1B13, 0x7BCB552AD5CA5, 0x7605AB0FFCD34, 0x11DF30353E58F },
+    { 0x7C3039C9C7C35, 0x3B69FD6F22A14, 0x4A13B351D6266, 0x486789DEEF25E, 0x2CEC279EC250B, 0x756DD22FEA70F, 0x746E449457E89, 0x4FF87164FA480 },
+    { 0x7C523B67E63B6, 0x0000004F25387, 0x4D8CBB510ADF6, 0x00000008985AC, 0x070BD66777B94, 0x0000004408112, 0x6329166C03561, 0x0000004A91AEF },
+    { 0x6E0BEFA28903E, 0x0000000000000, 0x2B17B9A30DB1A, 0x0000000000000, 0x50D9A03992F11, 0x0000000000000, 0x273C18B4070DE, 0x0000000000000 } },
+  { { 0x0DDD78F02ADBF, 0x7A32CD85851D9, 0x115EEE0C5A0F7, 0x03F9E05B2EA1D, 0x730BB22C8738B, 0x046D5F7953BD9, 0x7F052FD997421, 0x674D7A99DBF06 },
+    { 0x5AF2FA8D551E4, 0x4F4E90CD8936C, 0x1C8A084C12015, 0x6BFC898C7C15E, 0x4F5476BFFBA54, 0x3CD8263A267CA, 0x7376346A6F624, 0x0EA0CDA5300F3 },
+    { 0x48C6FD51C5F20, 0x1653AA65613C7, 0x2E316253FC0FC, 0x12158A7D78387, 0x48058679E86F6, 0x153A37E95E0EC, 0x091A340922C86, 0x31FDDB1C490D4 },
+    { 0x0821E9EA4DEF9, 0x0000001778E66, 0x07A9A2DA24476, 0x000000140B8EE, 0x3C350A1B9B283, 0x0000005A7930A, 0x4C2A1524038E0, 0x000000340EC4D },
+    { 0x15385DD9DDB32, 0x0000000000000, 0x1AE2FB643E49C, 0x0000000000000, 0x6D60FB7193E28, 0x0000000000000, 0x78E0A42F90BB5, 0x0000000000000 } },
+  { { 0x4C8E8ED6FFE3B, 0x0533AECC24BA6, 0x31BF11B99BE50, 0x2C045AD6ED674, 0x1E5043EE4AED5, 0x54604D92B9A05, 0x413B8B8E10A0A, 0x4A85DB8D90513 },
+    { 0x3622E260BF38E, 0x385B6BE7131C4, 0x627B96AA868DE, 0x24AE75957D0A9, 0x33AA378493456, 0x4C0FE46A6B850, 0x38438592D40DF, 0x2C40A9D5CBB25 },
+    { 0x150F86B91C246, 0x33E767E876C4C, 0x58673F293FB31, 0x1068072493799, 0x4D8BAE7E9D302, 0x339F892EE39EC, 0x1CC9B6F0224AC, 0x4740927C0322D },
+    { 0x18A17D4770755, 0x0000007E14C9A, 0x6684593D07059, 0x0000004448636, 0x00DE85BFDCEA6, 0x000000417ACF7, 0x1F1824D51F9B2, 0x00000045B450E },
+    { 0x38509BD0460A5, 0x0000000000000, 0x4388FF824443C, 0x0000000000000, 0x6FE03EE9DD2FE, 0x0000000000000, 0x172F64101CC85, 0x0000000000000 } },
+  { { 0x0884507AEC0D8, 0x4555A89C416DC, 0x76F17B31910DF, 0x0B979C3132B99, 0x7F269CD00B86C, 0x742B4326C2FAA, 0x701C0C6438143, 0x34C8216394504 },
+    { 0x6C029609DB487, 0x29A3D87C127BE, 0x268C87F21C1EF, 0x7FEF8C589DEC2, 0x75FC6801392F6, 0x62741D1CD419E, 0x73F2629618417, 0x211ABFE0AE27A },
+    { 0x05F7803CACED3, 0x24495CCD1359E, 0x1CFD83119A8FD, 0x5F5E52922DB2B, 0x0E8CF6C5B18A5, 0x2222E4C0DBADB, 0x311E49AD3BB2A, 0x68FF5B0048DD9 },
+    { 0x5786E02EF44E1, 0x0000004C91ED7, 0x4BDBB3D130ACB, 0x00000024F5D73, 0x66BB557314134, 0x0000006DE33A0, 0x7DF7AE212E2CB, 0x00000034A99A9 },
+    { 0x6720EB2ABF853, 0x0000000000000, 0x4ADAB482D1BD8, 0x0000000000000, 0x2B9DB41E98CD7, 0x0000000000000, 0x468CF144E4F50, 0x0000000000000 } },
+  { { 0x2C924A5008499, 0x66100EA7FD257, 0x3E5E8407118CA, 0x5AFF101F2329D, 0x2FCFD68C00F37, 0x2875C9CF9E99F, 0x46A42BF11F508, 0x134D72A0A661D },
+    { 0x08BF54A3EA5E2, 0x728C485A412E4, 0x28B42BFB705E7, 0x7768A76A3BC02, 0x201281F439B7C, 0x6AC9DD868E234, 0x33EB11430FD1F, 0x6D244C04C2520 },
+    { 0x0254DDE164120, 0x0CA673C943BBA, 0x4BC4C0A43967F, 0x62E76797A4CC1, 0x7FFCBEAD61DC5, 0x0BC1653CE4132, 0x2877CF0B64138, 0x06A7D323D7196 },
+    { 0x3E06A92BD57BB, 0x00000072C23CC, 0x45B7A03A8D9CC, 0x0000001830403, 0x2EEDE6B7A6523, 0x0000004F6E4A5, 0x16D1DEC5E05BD, 0x00000038A43E6 },
+    { 0x5EAC010D06299, 0x0000000000000, 0x28CF9B70149F3, 0x0000000000000, 0x26F0521C33632, 0x0000000000000, 0x67BDF23137FE5, 0x0000000000000 } },
+  { { 0x360BC320B1C05, 0x02CFBE450031E, 0x60EB517CBF722, 0x4ECE3038C6947, 0x6B7DC88BAB733, 0x360F83ABEB0B8, 0x5EFD701FF8932, 0x2D46DA545DB58 },
+    { 0x797CA44E5EDC6, 0x700BCBC32BCD8, 0x73525D532824B, 0x3A0AB3A09223B, 0x438DAA2087794, 0x4D5BB83B64188, 0x3C3A4D9DEB357, 0x73AA273EDF4E0 },
+    { 0x749E4421929C3, 0x1C9BA5FF04BD1, 0x1C43B9830FE55, 0x28FECA71B22A4, 0x664507571644A, 0x4D924FDDF9BAF, 0x12714C788EF41, 0x45243208546FC },
+    { 0x3DBA9498CFFF4, 0x0000002B8D774, 0x46507FC9DEE05, 0x000000251F028, 0x3FA60A47587D4, 0x00000057B6E16, 0x38E8B8EBBFDBB, 0x0000004E0F35F },
+    { 0x6C13096D46526, 0x0000000000000, 0x0CF94402A10D2, 0x0000000000000, 0x4DFAB87D5C797, 0x0000000000000, 0x7B59174A210A3, 0x0000000000000 } },
+  { { 0x5B7718BBA4A11, 0x720E7F1EBFB40, 0x68258C237986F, 0x239D318EEC976, 0x456A428262CAD, 0x121BDD1F20E82, 0x57890CA2210DD, 0x717FA9DCE2224 },
+    { 0x725EEDF2D2998, 0x0F97C6BE87ED3, 0x2FF260A6FBF62, 0x27351EB892298, 0x45AD62A8A6A04, 0x6514655CF62C2, 0x4A219F7B11D08, 0x7D5AC1F1B118A },
+    { 0x250A7B8F02D53, 0x19340E22F7387, 0x5F5C4B8B252B4, 0x2C424B09C8BF8, 0x1B135DFE4D251, 0x4C2160C1A942E, 0x5CC586E306C34, 0x7C24DB053DF1E },
+    { 0x181E27E75EEF6, 0x0000005A414E8, 0x4029D32E68F8E, 0x0000001892454, 0x029F6F785ED28, 0x000000346995B, 0x085C6037E66E0, 0x0000004EF262D },
+    { 0x5526EB8F87077, 0x0000000000000, 0x0F3115FD24137, 0x0000000000000, 0x1E451895592D7, 0x0000000000000, 0x71F0318570EDA, 0x0000000000000 } },
+  { { 0x49CAC3FF9E652, 0x4B173D8D16EDE, 0x29D64316B1475, 0x74F1FFE18201A, 0x6B8CDF9470A8A, 0x7ABB469869150, 0x4B8899AD62C69, 0x308C24D73FD58 },
+    { 0x614D29549DEEA, 0x3406996E1FA71, 0x25330F5FD676F, 0x21A27087F7728, 0x10F841170FCDC, 0x473162B5991B6, 0x56A34D8A6A9B3, 0x7988D90362F80 },
+    { 0x5331D707FF44D, 0x5C169D2F2EB5B, 0x2064827A6DA96, 0x386F581DEA582, 0x11AF52AFC2221, 0x225E9C11C282B, 0x2F413ED4B696C, 0x3A5133F11FCEA },
+    { 0x46C3FDD436CB0, 0x0000006B2A997, 0x4F2883F5C17CD, 0x0000002B23568, 0x6D566C1894CCE, 0x00000038465EF, 0x59587F96D15F7, 0x00000052C3A0D },
+    { 0x642F74D1BCB1D, 0x0000000000000, 0x5A3D6093D6EC0, 0x0000000000000, 0x2D4C8CB6DF424, 0x0000000000000, 0x6FC5A6D1CDC38, 0x0000000000000 } },
+  { { 0x0E0DD5391126F, 0x4012466330936, 0x3F5473EC2AC9D, 0x193B90A2779BD, 0x1F69FC4F602A7, 0x54C067C50B2F4, 0x7EA8BB5C181EF, 0x47467723FC0B8 },
+    { 0x7691A47DA63BA, 0x73483EA375FF7, 0x6DD67DAD2E0D3, 0x72A5A5D456ACB, 0x4E0F8CF7D5332, 0x4484A21DA033C, 0x1F5B975759388, 0x300DD59950AF3 },
+    { 0x4F01B8962FC36, 0x269A78FDE7A48, 0x2CA963461A0BB, 0x3CB2B6B54C86F, 0x2187BCB32EB4D, 0x1F45772EB2E56, 0x1D23BB58EB376, 0x4F26040C94304 },
+    { 0x48F6CA79A0405, 0x0000004CD9E01, 0x75D4D2412B90D, 0x0000003986D23, 0x178508041112B, 0x000000495DC2F, 0x3A4B78E2AAE72, 0x0000004341F30 },
+    { 0x3977C2E16EED0, 0x0000000000000, 0x3065DF1893DAD, 0x0000000000000, 0x2472A54AF7C57, 0x0000000000000, 0x08AB9C33ACBCD, 0x0000000000000 } },
+  { { 0x258AA2551C5B8, 0x7882179C0BFC2, 0x331EECB6EFC89, 0x430FF3B317F00, 0x4B4378BE7670C, 0x18561320C9077, 0x569F5B771597D, 0x289FB2A5F0A58 },
+    { 0x038B4746E7FE3, 0x31FEC5F4AB812, 0x5571B528155F5, 0x1AFD5962B8AF5, 0x622B3AF6F33AA, 0x249FE02ED6630, 0x5BB1E2D3CF069, 0x4B2357FB55037 },
+    { 0x179A18DD0EA1C, 0x6ECBA643E6B3F, 0x0CE0A06D077AA, 0x00B19295D57D9, 0x295F8C9011A89, 0x4E752E5807AB2, 0x22EA142F92682, 0x25FFD74DAC6D2 },
+    { 0x258DD2CD32A47, 0x00000014E5162, 0x5B50377F3F13E, 0x0000001479A3D, 0x16EC1B388555B, 0x00000046EAF47, 0x0506B130E16E9, 0x0000005305F07 },
+    { 0x2B8AA536FA63A, 0x0000000000000, 0x3DEE73DB02D6B, 0x0000000000000, 0x150ED111DD178, 0x0000000000000, 0x64B0D15F1204F, 0x0000000000000 } },
+  { { 0x7B0321433DC91, 0x7AD557B3A4FF4, 0x08D39274379A1, 0x1A3BE9E557C80, 0x47A97B47E6175, 0x1D34046DAEE03, 0x4984E9872CE3D, 0x17C8F8F1FCDEA },
+    { 0x0D8CDDAEFC956, 0x35118CC28CA11, 0x0B2B12B729C16, 0x32C91110FB9DC, 0x5235DF9ADA65C, 0x60FF5BC7DB5CA, 0x2E97A680B0AB4, 0x39B1CE5446FBA },
+    { 0x2FAC1FD5FE2A5, 0x0A607635AFD54, 0x32660DAA93A06, 0x56C14B0BCC586, 0x28BF8F4E8D161, 0x096735FB29588, 0x7581A82488E47, 0x5873608DA4212 },
+    { 0x114F2F9E2582D, 0x000000292D3EA, 0x47D63F98D6966, 0x000000234E3F5, 0x3BD476ABEE104, 0x0000005E3F6EA, 0x3E2C315E8A044, 0x000000344C333 },
+    { 0x3B254B27AD608, 0x0000000000000, 0x2C880C74589E4, 0x0000000000000, 0x12263B46B110A, 0x0000000000000, 0x6630825552118, 0x0000000000000 } },
+  { { 0x0AB98580F8323, 0x078E95615144C, 0x795F7F15301F5, 0x1621291B2D544, 0x4DAD704F1BBEF, 0x088C271F53C6A, 0x03C50E133385D, 0x488C90501B10E },
+    { 0x105C2C29EC39F, 0x31622B8DD9826, 0x1EC9CC2246C5A, 0x5DF536C6C321E, 0x07CC22D571CA9, 0x322E8E3D71BBE, 0x044A131B7A8BB, 0x34955AC4D47CB },
+    { 0x045A2279FEE4F, 0x716879BD41CD8, 0x5C82D0C5723B5, 0x1B412765DEF0D, 0x1A63F35DB7E76, 0x52B29FC5A2C82, 0x5EA5EEE6902F8, 0x40544DC323AE6 },
+    { 0x4EB918D61DFFC, 0x00000074657B5, 0x2276BAC932307, 0x0000001DFC82F, 0x0EE6396FD41D5, 0x00000053D847C, 0x71715FAA364D1, 0x0000004E8BB24 },
+    { 0x3D504C7AF1A96, 0x0000000000000, 0x4876D6F5DB15A, 0x0000000000000, 0x7BE482692EC9A, 0x0000000000000, 0x2361E0C03E975, 0x0000000000000 } },
+  { { 0x4BF3CEA45BA7D, 0x769F564A02FA7, 0x1A1ED9F920E98, 0x17B46D061E76D, 0x0BBB7FF4A3539, 0x7CF1CE7100430, 0x22CAA7F6F9A66, 0x6D80CB7D98155 },
+    { 0x2EE8397963D99, 0x479E8B63BE662, 0x6A110661A2A9B, 0x2DD2A089D13F9, 0x648A4F2CA8621, 0x2CBF9FF39EA10, 0x0C943A7FF971D, 0x35F480B9CEF68 },
+    { 0x5588F926B8CBF, 0x7FA96AA513515, 0x74554FCBFB2C2, 0x584FE9A7AEC85, 0x5D713152BA9C0, 0x492BA92AF3BA3, 0x7BCDF8511F7E2, 0x162FA5254065B },
+    { 0x63B118609C1BC, 0x00000047C2C68, 0x676FB3C7698A5, 0x00000032EAF68, 0x2D9D007BC1C8E, 0x0000004E7147D, 0x681C0C68D1574, 0x0000004487428 },
+    { 0x61B2A9957553B, 0x0000000000000, 0x0DDB3EB3763E3, 0x0000000000000, 0x4618B949C8F12, 0x0000000000000, 0x13E524F52387A, 0x0000000000000 } },
+  { { 0x7C304EE92B76D, 0x30C10AB870BC2, 0x491C0590CB177, 0x62FD140662334, 0x7992F2344FFDB, 0x1B9692436A0BF, 0x39028FBC17323, 0x50A25631940BC },
+    { 0x4BC28FD699B3C, 0x46DD566A6A30B, 0x3A28E36DDBB6B, 0x183A10FA76AE3, 0x17A4E0D7F3FD2, 0x065E1B8AF857E, 0x21DB954102850, 0x297144388DF1E },
+    { 0x6E557F6D31B5B, 0x5E8BBB772F066, 0x2A67B51E4069C, 0x47B83C342CF53, 0x4D24D39115EF7, 0x067F329866CFB, 0x39ED72ACD0889, 0x5CAAD34EB5460 },
+    { 0x2B4247C30C34F, 0x0000001433337, 0x6DE38EA3ACD7C, 0x0000001727791, 0x6AB693B57E155, 0x0000004C2F919, 0x0670EDBD3708A, 0x0000003077083 },
+    { 0x20AA98960897D, 0x0000000000000, 0x1FB3453DBBC84, 0x0000000000000, 0x44044A653D43D, 0x0000000000000, 0x09D95ACFADF2F, 0x0000000000000 } },
+  { { 0x124DBA8AF8111, 0x0FFD8837A8888, 0x4806BA5CAA856, 0x3AFECBE582DDB, 0x3D7A255EC2F79, 0x305937E264464, 0x6CA9228B81C42, 0x2E397CC630FA0 },
+    { 0x73849D790D681, 0x256D5A73381E3, 0x415E26805AACE, 0x5AF2402FB329D, 0x42450C814AA4C, 0x6D551E538CE5B, 0x04F3F4EC4A0CC, 0x6BFE790CEF520 },
+    { 0x7085B0347F32F, 0x182EB4F20A1F6, 0x07FE307E50B3C, 0x5DF4DD67F5687, 0x0DFA600009C46, 0x27E276C497665, 0x242CC0F84DA30, 0x06A2B4C9D2C4A },
+    { 0x4706F08B2D013, 0x0000002CF6408, 0x1F4CB5CB20E7B, 0x0000000E297AC, 0x1F889FEB522DF, 0x0000004D1B1AF, 0x6433E71CA4533, 0x0000004124E89 },
+    { 0x374721EA24337, 0x0000000000000, 0x6E2C652870572, 0x0000000000000, 0x270B755A28847, 0x0000000000000, 0x6E768D68648F0, 0x0000000000000 } },
+  { { 0x13E0AA9DDD5B7, 0x05A4D36823ACE, 0x2CA738CD0F868, 0x402C09DFAD4E9, 0x1BB6C1DBFBC49, 0x4F2ED36E21E93, 0x034005F3BBA7A, 0x04E45638CB0EA },
+    { 0x0C226815487BC, 0x7724C7C25B38C, 0x5E1E9E9F20419, 0x49587AA3FCF4A, 0x14041CBD5586B, 0x18224AB4161EB, 0x40D398FA49E38, 0x6CAC92BA829B1 },
+    { 0x13EFE8C8EED97, 0x2F591A41A663D, 0x614E55EDF7B23, 0x5CBAF126EE300, 0x271ACFAF54768, 0x253AA6B039401, 0x4ADD40B7F6A56, 0x0072E757E7430 },
+    { 0x04B100016086F, 0x0000001CB6421, 0x2134F32BED1F8, 0x0000002311CF3, 0x0E7DCC9A905E3, 0x000000439A14D, 0x601D7DD73FBC7, 0x0000004F0EB72 },
+    { 0x75BE1CA9C315A, 0x0000000000000, 0x2B558BF93ED11, 0x0000000000000, 0x3BE5A05C8CA4F, 0x0000000000000, 0x01F2FC8DD4C84, 0x0000000000000 } },
+  { { 0x66F122CC9C413, 0x54D17EAE5F350, 0x49B04D58DD8A8, 0x2B806AC929826, 0x33B4753EB6C71, 0x60AD6F4D6212C, 0x47B6F15DCD248, 0x2ADA12DC70EC3 },
+    { 0x3D82F03F63CF8, 0x6D54E76ECBB2F, 0x49BAE69908546, 0x4E7D141C5BEE9, 0x6D08CE2BCDC94, 0x79A775F9C93E5, 0x4470CE52EE3FB, 0x56097EF45A128 },
+    { 0x0FC00FD4697B0, 0x726BA1D0CAFD6, 0x3AD23B2B59C40, 0x59452BC822FF3, 0x0108416CA2D06, 0x7BA8A1D4FD3C5, 0x7CF39555CC254, 0x52239A7214A1A },
+    { 0x39B183CC521D8, 0x0000004A1F0D6, 0x1D6D706FF57C9, 0x0000001FD6B8C, 0x48C28975DF940, 0x00000053C9262, 0x5232ABEAAFB55, 0x0000004A5E96F },
+    { 0x34046C6ACE8F3, 0x0000000000000, 0x519B544F9C6BA, 0x0000000000000, 0x68A63260E4BC4, 0x0000000000000, 0x2FC38C9CC5ABE, 0x0000000000000 } },
+  { { 0x2B2CE6F4F5E32, 0x039A302477E45, 0x2159B52A0AA2A, 0x7BCE8FB160942, 0x5CDBB5F9417EC, 0x518F0E2C54B6A, 0x6DA0F3096CB8C, 0x1837E8E48B1E1 },
+    { 0x420CCD11E5387, 0x0B39B1F59F78A, 0x44FEA283E0833, 0x6913CE73BF402, 0x2AD05044BEDB3, 0x4A665C802636C, 0x3EBEE145F73E7, 0x43DDBFA95DBF3 },
+    { 0x57AE22AC5FD77, 0x4C841EF5957FE, 0x52F97634BD191, 0x0C8F4F61DB3ED, 0x33C13E602E6E4, 0x349FFB7F0A67C, 0x741AB10B33B82, 0x6B94E86C39550 },
+    { 0x206815AB283F7, 0x0000000B535A2, 0x6DBAA17DCFCE1, 0x0000003E1185B, 0x17DE9FFAB6B02, 0x0000004051357, 0x50EEB66EBD9F2, 0x000000478324A },
+    { 0x5D1BB7932E66A, 0x0000000000000, 0x09BAE6A212741, 0x0000000000000, 0x44EC5A6B4AF18, 0x0000000000000, 0x0FBEC5FDE8E9A, 0x0000000000000 } },
+  { { 0x374E2C980381D, 0x776900228AEEF, 0x1BEC6B4A60E0A, 0x3E8FA3449F4E5, 0x5996E3D788453, 0x0BFBD9960ABEE, 0x6681554C696B8, 0x7FE83C45C7483 },
+    { 0x7E37C7CA6D155, 0x4534C9D1055EF, 0x07287321A3B73, 0x7F0642E08A84B, 0x1DB3036CAEF07, 0x782FBF98A8680, 0x21204FAE66905, 0x1CED4C55A24EB },
+    { 0x61110C5F72FD7, 0x4540FB09298E1, 0x15AD4A4775E93, 0x7023F7B483417, 0x1B1DE458BFA67, 0x2869230559F7F, 0x1894F647E0DEC, 0x27D3B51955910 },
+    { 0x55BB614060763, 0x0000002D15E6F, 0x1070B09270D6C, 0x0000001B40421, 0x426828F897209, 0x000000578C947, 0x547889E54113D, 0x0000004DBE6B6 },
+    { 0x6AF15FF2714DC, 0x0000000000000, 0x6975679339E14, 0x0000000000000, 0x077FA0D7A34A0, 0x0000000000000, 0x0621D389BF1E3, 0x0000000000000 } },
+  { { 0x442C3B31EB06F, 0x220D812295541, 0x1DC258BB06CA1, 0x061F9886C14B8, 0x40FE1847C3675, 0x19C6EC7FDEC74, 0x72629D3B3E481, 0x3E489B6B46B26 },
+    { 0x6E86950B81084, 0x54B9A691C0844, 0x660BB234666A6, 0x4E49518615971, 0x1919CAD5592F4, 0x31A9D19DFB8A0, 0x73E8045EE7F6A, 0x05B0301BBB4B8 },
+    { 0x483BFBBB904FA, 0x051997B451CB4, 0x460C4800F80FA, 0x5EC2CD808D9BC, 0x52ED57A6EE23A, 0x357AE3DA3E052, 0x5C17CBC6EBEA9, 0x44F73A07A7E64 },
+    { 0x6BB66534EA74E, 0x0000004F7AAB0, 0x4D691B093C000, 0x0000001CD0F6C, 0x37A46A3EC24B5, 0x000000591C780, 0x4A3FE2BE20B19, 0x0000002FB3034 },
+    { 0x13E6B59C1A8CF, 0x0000000000000, 0x6192C8F56B4F3, 0x0000000000000, 0x3FE526A6C2341, 0x0000000000000, 0x70DBB0E4EF5C6, 0x0000000000000 } },
+  { { 0x1A50D3BF09041, 0x1C49FDAED15BB, 0x2D33A35325E20, 0x26D9D6B08F3B4, 0x4E091AB6BD573, 0x790BAFD45A0E1, 0x06BCC561C4078, 0x5A698752A5972 },
+    { 0x4D3123A1927F1, 0x408DC37ABB70B, 0x6A83606EABC03, 0x03724659297BD, 0x1472DA99602D4, 0x0BFE2F025572C, 0x31B966C538386, 0x114E2AFB6B2A1 },
+    { 0x5FF8925308B6F, 0x6A55AE1D905E4, 0x15AC7C0EFCAE7, 0x3647976ECA613, 0x0DB25B112AF2F, 0x0F595F3617AAB, 0x4384487E2345F, 0x29DA80678255B },
+    { 0x416684D21D9E4, 0x00000081742A7, 0x6F8BC01568AE5, 0x0000001DD82E1, 0x3D68021DE39B2, 0x0000003F0CE12, 0x302186F86F02F, 0x0000004FA7E1C },
+    { 0x792C8F2561413, 0x0000000000000, 0x42003C5526AE2, 0x0000000000000, 0x0285211446578, 0x0000000000000, 0x2F820900803B0, 0x0000000000000 } },
+  { { 0x33DEEE237BD11, 0x203C3371CADBC, 0x55E3667FF704E, 0x3614E4A422FEF, 0x74CF0DC4E2BDD, 0x0606AD49C3C03, 0x25539E48B43BE, 0x719A4F68E0ABA },
+    { 0x0F91069E8E97A, 0x468A8336AE849, 0x74938B3AAD260, 0x2986194AD845C, 0x4198436809C8A, 0x7625E0B87CDD2, 0x144A7BE98FD45, 0x156E4B663B60B },
+    { 0x576E96F26781F, 0x24E4D5658B7C3, 0x1C3306B17229E, 0x15662660A9379, 0x768E6E588E894, 0x27B5F5C828EB0, 0x1B37F19599FDB, 0x500FA63D5723F },
+    { 0x45E01137E7FB5, 0x00000036A5A49, 0x5AA80C0AF4FB3, 0x00000028B7901, 0x34ABB5342279E, 0x0000004D4929F, 0x641DAAFAAA8F8, 0x0000004F0DD9B },
+    { 0x2E881E6715D78, 0x0000000000000, 0x1C12AFC38AF78, 0x0000000000000, 0x3EA6F627CDCAB, 0x0000000000000, 0x7470020921A1D, 0x0000000000000 } },
+  { { 0x4E78E376873C8, 0x3538C74A3A6CE, 0x7DE030C4A7792, 0x687D2B3926AE3, 0x43F9F203F9930, 0x09FEAEF1301D1, 0x684F9B292B634, 0x59096D622C0FF },
+    { 0x15E7792F1A814, 0x28D7C74726EE8, 0x7E100FCF8CB5F, 0x78027185053F0, 0x444CA015D2004, 0x794551D3971E5, 0x5A2643B006B5C, 0x31B976BBD8BFA },
+    { 0x712387C4EF26D, 0x2D781F84A2855, 0x5089E34F44918, 0x16BBB91D34D44, 0x459E83A320A9D, 0x006F8AC341573, 0x1910861697090, 0x07B42A18F9B63 },
+    { 0x4466F3560C959, 0x0000001B096B3, 0x16BB0D5184E90, 0x0000002CFAB87, 0x422EDBF1F6DB1, 0x00000043CED22, 0x1035E0B4DEAF8, 0x00000032F9403 },
+    { 0x16B7909479729, 0x0000000000000, 0x2681D1BFE5AD7, 0x0000000000000, 0x757C97B031CE0, 0x0000000000000, 0x6E673BB0B8983, 0x0000000000000 } },
+  { { 0x228717D9FC842, 0x739EBA4FEFAA3, 0x74F1B524D414C, 0x0A3B8DAABCF49, 0x6FC4CDF727A02, 0x74BA7315BC9D1, 0x6755DEC950686, 0x0FAFA566404A3 },
+    { 0x51A7C7A5BFC0B, 0x5614B6A6934D9, 0x65FB8E9E083CB, 0x47032470F8B87, 0x4D407BF08A495, 0x4308B07BA2943, 0x4EF245BFDE3BE, 0x4E09CDE3462FB },
+    { 0x58CFF8A3D5B26, 0x3D4AABAB2A358, 0x4F9712FFE9092, 0x13E1D2CA64417, 0x2C88C2EA85C3E, 0x40886958B33B5, 0x070675414EDD0, 0x3094B74F6B053 },
+    { 0x7D0CC09F0807B, 0x000000174EA05, 0x5372A09D770D0, 0x0000001FDE80B, 0x24844EC867EFD, 0x0000005CA820C, 0x78E700A583422, 0x0000005A4B019 },
+    { 0x525BD36509845, 0x0000000000000, 0x14F3846DD7ABD, 0x0000000000000, 0x149E91D592993, 0x0000000000000, 0x65304A8D45D8B, 0x0000000000000 } },
+  { { 0x14DAE7D2509FB, 0x40F201C09B2CF, 0x48ED3E5307ECB, 0x055D017654817, 0x41E863F445927, 0x558E55BA775E6, 0x74C7D05C26703, 0x12CB5DD4159F7 },
+    { 0x0BFE39589FABB, 0x6065975657A10, 0x01C8F02D2F8F9, 0x2F185F694880F, 0x53F77A1F3A3AD, 0x2EA9ADB343DE5, 0x7BE43DBF19B4D, 0x3AF82C863474C },
+    { 0x249E95B30E5DA, 0x04D2322359DD6, 0x1829F53B0229E, 0x5C991AA75A97F, 0x0959A1FFEF4D9, 0x4F3E1DC9FE171, 0x7E51B03F85E6C, 0x0CC751631235B },
+    { 0x64F7ACEF83A1D, 0x0000005A5BCE0, 0x78C3AE7CE039C, 0x0000001A7F075, 0x1B419CBC83B3E, 0x0000005730A52, 0x611F298D0E284, 0x0000004B27B5B },
+    { 0x7FEFBB46FCC5E, 0x0000000000000, 0x3C6EAB2131C17, 0x0000000000000, 0x6BAE059E85FB7, 0x0000000000000, 0x0B74F09D3A456, 0x0000000000000 } },
+  { { 0x4EAA972AF02E4, 0x6E1800CE9895E, 0x0D12188865E5C, 0x14F796533BE0C, 0x47081436D56C2, 0x41BCF9534151F, 0x51310800A3F6E, 0x6680FB3441BD7 },
+    { 0x31384C03BA012, 0x5D553B1F9448D, 0x4B2EA84AF2AFB, 0x467D7B5F2AD2E, 0x6CD7A0555B9DE, 0x0DC34FEC00294, 0x76693B144F87E, 0x48C00A2AF2037 },
+    { 0x69568F0F688CA, 0x3211CCDC5C2F5, 0x3839AEBA09B83, 0x48AF6F2F505B7, 0x3A26CC2CCA446, 0x3832B036464AC, 0x2C29B3827F5B1, 0x674104BD727B7 },
+    { 0x3DE3130E75D62, 0x00000069A941A, 0x11DD4E7241AA8, 0x0000002C528B7, 0x4321E7B186A1C, 0x0000002FF4872, 0x5E6CC9B15D258, 0x0000005094FCA },
+    { 0x5A62C32FDD2E0, 0x0000000000000, 0x13C9A5630D0A3, 0x0000000000000, 0x2CF7DDA4FB59B, 0x0000000000000, 0x1C85CA9A3A47B, 0x0000000000000 } },
+  { { 0x1BEF1B100426D, 0x5C96A31624F13, 0x31DDB71599AB8, 0x1BAEC4777D93A, 0x6A38F8326DE67, 0x714FB489C3211, 0x337884D48A436, 0x0B1FD80BAE718 },
+    { 0x5C6191CB91385, 0x54EB69C68C8A9, 0x1958CA78C4529, 0x561B309AE104A, 0x0FCBAED8FEB75, 0x34CC748972B2B, 0x1DB7AB909130B, 0x30672190DB406 },
+    { 0x49328444B910A, 0x4FB45EA0F8BDD, 0x679CB42B63327, 0x77E238C650F68, 0x62737CD347067, 0x4ED14D4F6C765, 0x215BDB4CB33C0, 0x2DB2480F13AEC },
+    { 0x60976BFA8E022, 0x00000050E18DC, 0x6695BF818662C, 0x0000002911AAA, 0x504BC11A6F3B5, 0x0000002475E34, 0x6AB98BE139032, 0x0000002C9D357 },
+    { 0x1656F59CD8691, 0x0000000000000, 0x4157D598B35FF, 0x0000000000000, 0x71D626651147D, 0x0000000000000, 0x372FCD48FCF0A, 0x0000000000000 } },
+  { { 0x7A5A5C6606306, 0x0B90F72521381, 0x24AFE6A141C45, 0x041CE8310E987, 0x6750912388A0A, 0x45FDFD5D3C6C7, 0x2EEFA050E6E41, 0x1F6A40E034313 },
+    { 0x2A1A798D5324A, 0x144FC342C3BA7, 0x7769827337EFE, 0x37A7B71EE6CD5, 0x58A777935C4CD, 0x396EEE77CAA3E, 0x012CA9F6E0CDE, 0x77E8940582723 },
+    { 0x6218CB2B7CDC5, 0x3179039B33C7C, 0x35493CA60634D, 0x4F135903BE23E, 0x46EAE193DAE2B, 0x752C1AC748E0F, 0x58F22FF6A50A1, 0x0C3071BEF0F3F },
+    { 0x4D568DF7F9024, 0x00000056F2E0B, 0x09B2C1348F1FA, 0x00000026C4936, 0x1CB2844B2C23A, 0x0000001491DCD, 0x5C8A0BB50F3DD, 0x00000054C7518 },
+    { 0x37916FBA0B14C, 0x0000000000000, 0x35C15E6EF38DD, 0x0000000000000, 0x55900198EBE1F, 0x0000000000000, 0x591D0746F12BD, 0x0000000000000 } },
+  { { 0x0F181C36AE43A, 0x7C06189D9C44C, 0x68E2CD5FB71BE, 0x5438C94E5E222, 0x37B78519D8D62, 0x7D2F2EB75A1FF, 0x518DFFA7CFAF4, 0x25D53435D377B },
+    { 0x2826C4DCDFB05, 0x43C91B88F7912, 0x0224DEC5384C1, 0x73B3B840112E2, 0x18445D57334BD, 0x2C15BAC38B8E3, 0x614A0A2FD2ABB, 0x104CABAA986C6 },
+    { 0x60B66BF81EE93, 0x7A017E1E82CC0, 0x7C55CC8C95425, 0x27AABBD220913, 0x32C9041A0BBA4, 0x5B0E726743A81, 0x34F88EC961896, 0x15D12CB46E8EB },
+    { 0x41A86E0C904DA, 0x000000189A8EA, 0x595B7C2F8E5B0, 0x00000029E6CE4, 0x017092F61AAFF, 0x00000048D26A4, 0x2E55E1AD83099, 0x0000004BBFB4C },
+    { 0x7A97FDD58821E, 0x0000000000000, 0x1ABD68B51A726, 0x0000000000000, 0x371EC298F9238, 0x0000000000000, 0x19461C94A8258, 0x0000000000000 } },
+  { { 0x778D63F29ECD7, 0x4C94F08726222, 0x427B56EF290A2, 0x316D2369F3FB0, 0x27B1E42C24D83, 0x292D92C5451D3, 0x409A9335DE11A, 0x7ACB16E1F6EBD },
+    { 0x357DF094F7320, 0x5978F1B1FA95A, 0x0A92DA8FE15CB, 0x1EC07CA92D3D8, 0x645DFE0C2C7B7, 0x7B73E0A9C674B, 0x24B51D29075CF, 0x507830FA2DD67 },
+    { 0x0882CAF2C8F18, 0x5F0FC4377BB93, 0x774D67FB63C19, 0x124E739CA3E15, 0x02009B38F26F9, 0x426B2D9C9F604, 0x3B2D5A31EE9BC, 0x7D3E1AD86B625 },
+    { 0x671AA5899AC08, 0x0000005DECEB7, 0x67F62B4F1A415, 0x0000001EAD0C0, 0x48B301D84C489, 0x000000390BE47, 0x20CEE5C5F4DC7, 0x000000623AFAB },
+    { 0x4C4705773CE9E, 0x0000000000000, 0x4ED289A0ECC8D, 0x0000000000000, 0x30E84AC63C6D3, 0x0000000000000, 0x04C9303C87B9C, 0x0000000000000 } },
+  { { 0x77194C49B5B1B, 0x7E9A131CE05F2, 0x69CDA8035985E, 0x26831B93FA6F4, 0x3B3BE658F80C3, 0x084244D051E24, 0x571D131DE1E98, 0x14C02A2701E91 },
+    { 0x556052BE4B16C, 0x14B8A23B86C52, 0x70410FCE915E0, 0x3A308BD5980E4, 0x1C6888197CE18, 0x463DF3A49D7D8, 0x390F057EF1D25, 0x596B14686F69B },
+    { 0x499061790CD09, 0x3955BB96122AD, 0x6469DC2DED46F, 0x63C75C900CEC1, 0x6928B3791EF65, 0x16D474BB54F25, 0x479369D1D16D9, 0x18BB12A052652 },
+    { 0x0B5E6414ADA10, 0x00000054E1941, 0x0DF9A673C02D9, 0x00000022564F3, 0x4B0E191C002D5, 0x00000025B82F0, 0x73248A4BA4DE3, 0x00000036F63BF },
+    { 0x6546E057371F8, 0x0000000000000, 0x0E932B6F2E21C, 0x0000000000000, 0x08BED87DE847C, 0x0000000000000, 0x7B8F1B2E2D0A6, 0x0000000000000 } },
+  { { 0x057519081781D, 0x6D032F24E093E, 0x3C617FA1CB401, 0x34EA4B6872002, 0x153091F68903F, 0x3B5BD2E0A9AE1, 0x68300E9F7A889, 0x586BD19EDC7BC },
+    { 0x62C1E5ECDF812, 0x532C3923D0654, 0x09EF03343585A, 0x6873382D59A87, 0x1BC57336A9758, 0x6A5452E72610C, 0x6DCB526523211, 0x6A7B24C8EB55C },
+    { 0x5F30F3360AA92, 0x7E20B54009682, 0x783704C54069F, 0x00AACCB297500, 0x234A0EADECD7A, 0x4D9ABE540DE6F, 0x217D09EFFA789, 0x2D8104D4B5687 },
+    { 0x0A9D0B03E2DF3, 0x0000005FA1A4E, 0x057E30610173C, 0x0000004002CA2, 0x3F3DB9729CA5F, 0x00000047FE14C, 0x43097F3C65690, 0x000000410DBBF },
+    { 0x7A763B4408A14, 0x0000000000000, 0x63CB92367B7DC, 0x0000000000000, 0x3D7D27D6A3476, 0x0000000000000, 0x2C31230236540, 0x0000000000000 } },
+  { { 0x5889EE3CCA00F, 0x71481C650B198, 0x144FEDA1FDA24, 0x5A9E810F5604F, 0x6E35A58681679, 0x1E749AAB97CFC, 0x0CD4746CB090C, 0x24FCC34D4D036 },
+    { 0x50EF6CF341F76, 0x7B542416BC48B, 0x41BEC657AFC85, 0x505240705A367, 0x6A5C290315B43, 0x6DDFA365D90FF, 0x576C3C59C26F6, 0x6085BBD6B7F2D },
+    { 0x60A0D1AF48780, 0x6B07A7AB93D14, 0x598228D2B8D54, 0x5A9703A29CBF0, 0x2121789A8E074, 0x0E615D4CE551C, 0x6683C11DDBF51, 0x0C0FE7E20F016 },
+    { 0x7BB310481F88B, 0x0000004C87FA6, 0x41F6A47DF5E58, 0x0000000A70A1F, 0x15025EDE92FF9, 0x000000451072B, 0x3F983A7F60367, 0x0000004A72304 },
+    { 0x7D7255FE2F9DC, 0x0000000000000, 0x6E40DB6B9F1C2, 0x0000000000000, 0x2689372C20BF5, 0x0000000000000, 0x0BF72B3AF03B2, 0x0000000000000 } },
+  { { 0x4298B1BFFEA73, 0x6B561F828DDA8, 0x7E6110E4C6F0E, 0x7279A1C51EFCD, 0x3851532D25A93, 0x4B934775CF89F, 0x2650D5F6AF37C, 0x477AE0A4F0DC8 },
+    { 0x706F47676B589, 0x2421CA96D8A37, 0x2CDF59464EC00, 0x528DF612E62AE, 0x340320D9A84BB, 0x695B489A39D6F, 0x6E04DF2496460, 0x68D0FCDBEFB63 },
+    { 0x6CEB39C2F96AA, 0x4C33EFFBAD8CE, 0x2B50D8BA4D7D7, 0x78640D03AB041, 0x1ACB6BA253A77, 0x41EACF2C54B12, 0x5A91D3F43B78B, 0x4A630B3C05BFF },
+    { 0x1D485C5E2E108, 0x0000004E11FEB, 0x40F9FD491F1EA, 0x0000003F1C1F6, 0x772ED823B84C9, 0x00000040F374F, 0x502BE4905CFA0, 0x0000004DC1978 },
+    { 0x08E11A4178708, 0x0000000000000, 0x177ED4276591A, 0x0000000000000, 0x2D2F2963B2B8B, 0x0000000000000, 0x2D5EDB159B558, 0x0000000000000 } },
+  { { 0x65D8791589C20, 0x34492936D8A7B, 0x7D7076AF39D50, 0x27BF346B1A9BB, 0x1F3F69E97A7AE, 0x6E474E32A33F2, 0x3B0366AED46A2, 0x71874EF61C953 },
+    { 0x22E15E3F07DA9, 0x5083F1996D706, 0x181A096D7E639, 0x37FA0BC991B95, 0x0E6201394E7F4, 0x3A102C8B99B23, 0x50F3A4779C292, 0x318DD8C659B7A },
+    { 0x1C43757077712, 0x5C0BB999715C3, 0x7ABDA41A81FC1, 0x7EE01FD0C5C77, 0x186DE9EBC89D8, 0x05159D5D24730, 0x67157CCC9A428, 0x633D721CA998C },
+    { 0x26BF7B4EABA21, 0x000000413F67B, 0x17AE575E1A60B, 0x00000037DDA42, 0x1CC7DD67C1A09, 0x00000041E076C, 0x37B3419E98BD2, 0x000000404E5BF },
+    { 0x5A31EAF077D30, 0x0000000000000, 0x032E317ABFE4B, 0x0000000000000, 0x237CB6251728D, 0x0000000000000, 0x5329EF9E6E290, 0x0000000000000 } },
+  { { 0x60122906ABC3B, 0x14B1C41FD65DD, 0x753FEED3D6AD7, 0x6508F3AEC6644, 0x48156AFB8970D, 0x5CAAD2EBBFAE7, 0x2D8EC36DCDE57, 0x6CF3772B61957 },
+    { 0x482D73BB15D3F, 0x1E47461E8C9D6, 0x6C4B44B3F382B, 0x5329596968F10, 0x764848B317B88, 0x197CDE0EE6197, 0x6103E0017D230, 0x4B1EFE07839BB },
+    { 0x768390F30D89A, 0x655C464274853, 0x4ED9FC8510967, 0x09524668AC414, 0x2AB883559A49C, 0x2B0C45D5E49B1, 0x6A4B5613134E5, 0x71894ECC75A66 },
+    { 0x7AE8F309A3CD6, 0x0000004295320, 0x3A48DA032F56B, 0x0000002648FD6, 0x0C270F61BAAE1, 0x00000022544B6, 0x41F87AB31F8EE, 0x0000002F4AEF7 },
+    { 0x6E11EB0FC512B, 0x0000000000000, 0x5406CDE5FDA8B, 0x0000000000000, 0x622117320E129, 0x0000000000000, 0x4EC6858E1ACB5, 0x0000000000000 } },
+  { { 0x3C69DB58999C0, 0x5C1E7541072B5, 0x47C3B40BD5912, 0x3B9B4D8137DE7, 0x1F3688B3263F2, 0x2FE68649E203B, 0x5C5A21B528B60, 0x018AE5C366C9E },
+    { 0x7BCC326AA5D81, 0x763C6E63B87D9, 0x10878BC0D15EF, 0x27198F4FB94AB, 0x5F4E81E91D71F, 0x0B96CD3D8EE08, 0x513C5F21A5DED, 0x683E577CA0507 },
+    { 0x5F8A5A7EC0053, 0x58DD055C2D965, 0x251B0889105AF, 0x78EEB12F5A9ED, 0x08A22F651F0CE, 0x15F23EE356E05, 0x66DD425C1F039, 0x2CFB4162B03BB },
+    { 0x55AB94C733002, 0x0000001D7D53B, 0x3D6D656111B95, 0x0000000FC36A9, 0x00103324A6416, 0x00000046BB37A, 0x01B3BE0BDAE0C, 0x00000055F1EF4 },
+    { 0x7939FB5903510, 0x0000000000000, 0x472EA1911C92A, 0x0000000000000, 0x04D05F2FC77FF, 0x0000000000000, 0x395C67D6263D6, 0x0000000000000 } },
+  { { 0x0121D0A560A6A, 0x51851F6D15581, 0x16F9507EEF364, 0x585BE0170CBAB, 0x3F1D3335077E0, 0x5D15F49F7E6EB, 0x5731730FA53F8, 0x5E0CB9BDF3250 },
+    { 0x0C787B5902C33, 0x4F123E19B04B4, 0x0831618C0795A, 0x4FE89F78E3BEE, 0x27407A2D467EB, 0x28863719C2295, 0x5535ED7D9D9C9, 0x7C61955CCC1C0 },
+    { 0x12668275FADE4, 0x09658F01140FE, 0x051231ECFCE27, 0x79958E9CEF6AE, 0x75965135569E4, 0x7E7F5C854364E, 0x0FA1AB1D599C0, 0x0567A02545E83 },
+    { 0x64C2DB509CD9E, 0x0000006EC219C, 0x07609FA111669, 0x00000031F3A94, 0x59BBE1C32840F, 0x0000005884496, 0x0B7BC82B0E943, 0x0000004D9EB3A },
+    { 0x5586DB18C15A1, 0x0000000000000, 0x4BB30FD4E1E1B, 0x0000000000000, 0x3A49B2EE72B44, 0x0000000000000, 0x16A11E9237605, 0x0000000000000 } },
+  { { 0x0BB0877871B9C, 0x2827E2162E63F, 0x164802A2B32AB, 0x14AF42FD5BA80, 0x2909BB8C2A4CA, 0x6B177C39BF71C, 0x6D8518C07BAF3, 0x6D5006D4454D0 },
+    { 0x6E68D3C28AE23, 0x3A3870E76591C, 0x1FFE030853726, 0x4055BED34F2F1, 0x44F35FC8B7F40, 0x6AFF29098B85C, 0x68BC920330143, 0x6544FD1F8C1D7 },
+    { 0x4BE745F0E599E, 0x6A70E83DE34E8, 0x7C37D56F01693, 0x02B8E2FDCA004, 0x1BC125AF8BEAF, 0x65916BB305E80, 0x19D78ABAEC85C, 0x56754E2B586B0 },
+    { 0x31209C25A39D0, 0x0000003638189, 0x69DBF578427C0, 0x00000033C7FCE, 0x5BC1EF7317F42, 0x0000003C77A77, 0x32C3EDE8920E4, 0x000000550E594 },
+    { 0x03728C41E8666, 0x0000000000000, 0x2E21A9752AAC4, 0x0000000000000, 0x539F724B9860D, 0x0000000000000, 0x2DAC5A980F3BA, 0x0000000000000 } },
+  { { 0x7D92249C40E5A, 0x2D5D991136C75, 0x046807F4D9F13, 0x742BDB5F37C37, 0x01C128AB0D516, 0x73FBE0697EECD, 0x47A1402E2A649, 0x6ED70643704EE },
+    { 0x271475BA799E5, 0x1EA36644E8CCD, 0x1DC1705EF607C, 0x58DCD29458014, 0x53AF5DEE2610F, 0x17DD38E5507C5, 0x369F8876983F1, 0x3C71FACAF08E3 },
+    { 0x2D0D4A5960545, 0x56131008AE055, 0x42D7B461FCE08, 0x5DB3C31AFAF22, 0x25C4C573784D6, 0x016D895F508A2, 0x7260F177D50C9, 0x13FFB2AAD3B92 },
+    { 0x2550924A766CD, 0x00000011FD13E, 0x7F0EA2B5A4AF4, 0x0000000393CDC, 0x6EE20F41D9089, 0x0000003A628DA, 0x1985CFBCB24B7, 0x0000004783F7F },
+    { 0x2F5931C822286, 0x0000000000000, 0x4F1673DC25A2A, 0x0000000000000, 0x13CC71A232E2E, 0x0000000000000, 0x3786D22E28B0E, 0x0000000000000 } },
+  { { 0x7288F0A3F5F4A, 0x0F220049ADAA4, 0x6974CB4E7C8D7, 0x6B5C3482527F3, 0x1F891FCFBCCA6, 0x1EC6112EAA4CE, 0x68DE6149194E9, 0x6A02CCA1B7CC6 },
+    { 0x2C13B8B448E72, 0x455C75969FCC1, 0x214F9366B3176, 0x0D8507F055619, 0x01987B0E7D120, 0x61AF7A483E8BD, 0x13964BBEDBDD9, 0x15D4DC86DC187 },
+    { 0x1C27986333337, 0x5D010D6972531, 0x7A5F049FAC6D9, 0x455C983B5EEA7, 0x424CFA6BBA4D3, 0x70266FD051603, 0x3FE0BBFEC133E, 0x422E3A00F1CA2 },
+    { 0x4723595ED8956, 0x0000002A42206, 0x05BD74F0FD1CB, 0x0000001AD2F48, 0x555ED4AD1B7E0, 0x000000612A722, 0x15DA0DC62615A, 0x000000470770D },
+    { 0x4E9D63E45B68C, 0x0000000000000, 0x19F7CF7AF584E, 0x0000000000000, 0x5D4DFAA8D6280, 0x0000000000000, 0x056BE79816C80, 0x0000000000000 } },
+  { { 0x0116D51A756BE, 0x1A2EA3B82B9BD, 0x7F2A15C12570C, 0x3D59EFDC184A2, 0x7BD66E5DCAA42, 0x4D0D285D4406A, 0x36982E76C577E, 0x7DF149E95D654 },
+    { 0x31545E184AFF6, 0x1E9BE65C07DF1, 0x66250ADCEBE1C, 0x6BE61929CA048, 0x4147F75EE8F65, 0x0C0571F7398AF, 0x540114C4F8AB7, 0x3AC7A97097B3A },
+    { 0x61EA00BC678BF, 0x2DA5EEC83943F, 0x543F475E09D97, 0x2A97661067874, 0x1608DD6700B4C, 0x4E03A04ED8D53, 0x39A60E5F99304, 0x50A571C220F02 },
+    { 0x54AFF3D86224D, 0x0000005CB0E1F, 0x573E88214E84C, 0x0000000CD95EA, 0x58B4E0AD2F5AD, 0x0000005439E65, 0x69273BE65F472, 0x0000004071D2B },
+    { 0x2D804D0D96EB4, 0x0000000000000, 0x6B0CA7B103FEB, 0x0000000000000, 0x5E15606FC6A45, 0x0000000000000, 0x577E50B452963, 0x0000000000000 } },
+  { { 0x098618D25AE12, 0x333ADCB708D0C, 0x0018CC79A6F54, 0x6006CA95CD88E, 0x56CF271E967FE, 0x7E7930702FC9B, 0x0DBA55F729F04, 0x6625E1F8BD12D },
+    { 0x6F2E44741CBD3, 0x5601FD7B4AE71, 0x7E4651C5EB05B, 0x0009140CF7EC2, 0x3D9B07674C4EF, 0x10AF70FB852B1, 0x4B01901F73D2B, 0x2A07C9B187AA7 },
+    { 0x6BD61E20CA2B6, 0x7B0CC2430E3D9, 0x7D787F093FE96, 0x070D5EC94D8A1, 0x75F9686DCB29C, 0x0D9767DA3FB64, 0x749C8168DF198, 0x5C88E8BC399E2 },
+    { 0x79BD52AC78EFC, 0x0000005852776, 0x17D78E451C745, 0x0000001A8C06F, 0x0D83ACD33DEED, 0x0000003DF153C, 0x59796F21955DB, 0x0000004AB3D5A },
+    { 0x1355B5A0D0EB3, 0x0000000000000, 0x00655AF5C8AD5, 0x0000000000000, 0x746A3AB9BA2FB, 0x0000000000000, 0x03348DA5C18D4, 0x0000000000000 } },
+  { { 0x18F550042A034, 0x5508EB91AF738, 0x64121503341A5, 0x285C75271CF6C, 0x41ED2CE486B3A, 0x1D52E6C06BD07, 0x4B6EB17210205, 0x69B09E3E07778 },
+    { 0x71E91D8C6C8E7, 0x5A7EE5D7D6B1E, 0x0A4A4BE24D980, 0x1C708B421AA26, 0x180B2925045D1, 0x5E13747CF19D4, 0x559FEC9713EDB, 0x1B7F12A154C31 },
+    { 0x729D8B0FBA21D, 0x5AAD60295CD6C, 0x1AFEB4AB8D7B9, 0x38F2AD07436EF, 0x4E3AFC1CEEB54, 0x5EE5288570CFC, 0x3B5612B4C8BEB, 0x35DD262A2BD1D },
+    { 0x1E120F99AAEF2, 0x0000001A331A2, 0x3D3796C2BEA62, 0x0000001964F7A, 0x32514E20855B7, 0x00000050EF931, 0x0BD78D4EB1D15, 0x0000002FFA64B },
+    { 0x0948C70C7C027, 0x0000000000000, 0x3517D934F0945, 0x0000000000000, 0x06087E71934ED, 0x0000000000000, 0x7F93AA47AB4ED, 0x0000000000000 } },
+  { { 0x4FA371FB9E7EE, 0x21E4C7306EB1D, 0x6824AC72F4147, 0x6EC2C743FAB13, 0x04A105E534EB2, 0x76A5E78EC3F34, 0x27865734D8427, 0x2B7F1CE18E57E },
+    { 0x3C486E1BAFB13, 0x397ADFC87ECD2, 0x4D1497492E48D, 0x37B917B11C2AB, 0x40B7CA66F0B7C, 0x4CA2892198012, 0x540105D1F6CB1, 0x3CB62755EE708 },
+    { 0x65B28E10A61CE, 0x5FAD442EE62CB, 0x067CCFDF7A8B0, 0x599EA75179F4E, 0x1B166A0C3EB71, 0x5D05F2F5F81F5, 0x50A016E3FB8A7, 0x0A3268512F69F },
+    { 0x57F73223054DC, 0x00000062F0741, 0x463AEE121CD04, 0x0000002D03A47, 0x242E9988A3A89, 0x0000005297C59, 0x5ED3A609E334A, 0x00000031A4F7B },
+    { 0x23D04D3BC31F6, 0x0000000000000, 0x5A735F7F44BE7, 0x0000000000000, 0x558ED4E052FF7, 0x0000000000000, 0x1B51F983952EF, 0x0000000000000 } },
+  { { 0x1160F78ACFC8A, 0x04B0C1CF3E1F2, 0x00342C1288379, 0x40DC501D9EFA7, 0x14026E50A648E, 0x3EE92D20963C5, 0x780B26BC5238B, 0x57F79E135DE17 },
+    { 0x72EED859D8B61, 0x1761264016A7D, 0x45605412144E9, 0x18AA684F54743, 0x4F59698BBCAEF, 0x6267E5E05576F, 0x0FDAF93886798, 0x566A2485E3C53 },
+    { 0x515F6EA0F10EF, 0x271FBC8B5D332, 0x2819DFA5F5E63, 0x5ADDDEEF6DA5A, 0x1010B68BB9745, 0x481F28E66B30F, 0x41398DC288230, 0x5C64A7DDC7DDC },
+    { 0x4797EFA9DBA69, 0x000000737B49E, 0x6D9DB73DA817E, 0x00000028693D7, 0x13F133CEA17D0, 0x0000003F02FA3, 0x200626E171481, 0x0000002B92C12 },
+    { 0x5D2048DAE2841, 0x0000000000000, 0x6E19DDEE64EFE, 0x0000000000000, 0x16C7A82C73B90, 0x0000000000000, 0x0444B89F1D2FE, 0x0000000000000 } },
+  { { 0x52CFFD3251059, 0x044C7200AA4F8, 0x3F81C062CC13D, 0x31BDC71B439CE, 0x6F1A968AAEB93, 0x1D2E3664C66C2, 0x4172A3D88D19F, 0x19E79A8DDC2F4 },
+    { 0x711FB97611A47, 0x6B17BA707FC49, 0x6E822A6FAD03B, 0x67408F46D075F, 0x55C2C0095D818, 0x19EE89E66AAC5, 0x747B4B8F0E73B, 0x75B003637E6D2 },
+    { 0x0B0DFE42BD8C9, 0x3FC58370B0CD5, 0x4F9251E0808C0, 0x0C4E46E489B5E, 0x251BA0B7AC17A, 0x4FD4C9210F4CD, 0x218E714912B56, 0x73DA70D355D30 },
+    { 0x1B725543716E2, 0x0000006EA336E, 0x4FFC50391B231, 0x00000026FBE91, 0x6E44729CE5C24, 0x00000040C0180, 0x6DB51CD510CF0, 0x000000552FB45 },
+    { 0x44154B821C4B8, 0x0000000000000, 0x08EE5D06637A0, 0x0000000000000, 0x753DE6E88F3AB, 0x0000000000000, 0x151A42C7219D2, 0x0000000000000 } },
+  { { 0x454437BD4FCE8, 0x0A339D2D49EDC, 0x51298BAADBF12, 0x2CF31294EC249, 0x08107DB469C9E, 0x323C64603A186, 0x3E53E2BE285A0, 0x3735AC5F9229D },
+    { 0x557623013BCBB, 0x216BE268D52C8, 0x542031846D00B, 0x6FF13E1A7F26F, 0x483ED020F5617, 0x6661D5709031D, 0x3D00738C37CB3, 0x27F82D61C57B6 },
+    { 0x64DDE200DD604, 0x7E4B49DDFF327, 0x5120671FDC15F, 0x754C26BA2631A, 0x4FE89AA8ADF32, 0x695367F301940, 0x0D3E914B91B01, 0x75EFB7D366962 },
+    { 0x54A06243111FA, 0x0000002609DC6, 0x2C9DE925EBA27, 0x00000038E5272, 0x195C50E3149CC, 0x00000051E8C37, 0x6CFAC66B7D687, 0x0000004D30B51 },
+    { 0x7EE21127F4877, 0x0000000000000, 0x2D1811B9F81F2, 0x0000000000000, 0x56C5056C2A1CB, 0x0000000000000, 0x314800E71E1FC, 0x0000000000000 } },
+  { { 0x53F240E9ECC9B, 0x654E7C1BD3975, 0x721E537FA74AF, 0x118982A99E4BA, 0x3BD31EAA549A3, 0x5D13F039C065F, 0x18728EA18416B, 0x11433FDB0D3FB },
+    { 0x082E5C93D6EBA, 0x2C5E7BD775F12, 0x210466EEEE415, 0x5C8B7ABA5B16B, 0x02039F2C9B2C2, 0x6C3F8F18CD3B1, 0x655FE22F6A4E9, 0x2C025CBC1622E },
+    { 0x7E0F261A0BF1E, 0x5BBC1AB96CAB9, 0x1E3807215A5FE, 0x62EC69F1E0FC3, 0x768392A5AD489, 0x6D0BC188FB483, 0x13B4F8A4520B2, 0x78A6E36FB2CA9 },
+    { 0x75833FDBDAE71, 0x0000000A09ACD, 0x3BA9EF6595F21, 0x0000002221749, 0x2357F0B4834C3, 0x0000004949AC2, 0x3E619C7805222, 0x00000046682E2 },
+    { 0x615615B66FA4B, 0x0000000000000, 0x64B6C4C0418EE, 0x0000000000000, 0x71CE739166022, 0x0000000000000, 0x38EF047ABBF21, 0x0000000000000 } },
+  { { 0x51465BDAEBAFA, 0x7E0FDC2EBB188, 0x142EDE06B3FA8, 0x5CAE9DCA6C838, 0x280B9D98F685A, 0x7DD91EC6574FA, 0x2F1E4715B2024, 0x6231554F88D77 },
+    { 0x320E5BA04C529, 0x1C3E34A1ED558, 0x41F74CCE6B1EC, 0x4E56AD87A4579, 0x3ECE41FEE22E7, 0x2FB6E9000AFD6, 0x2DF7494B538B7, 0x740DCFEB9E1A8 },
+    { 0x6844C3A91E7C5, 0x0BAEE71A841C5, 0x766A7AE6ACE01, 0x209E11CD434B9, 0x472F01F5F478C, 0x3BA7584559D49, 0x69BA61B00CE38, 0x12C2EAD92BEDA },
+    { 0x2BB2C0F571C91, 0x0000005F3ED37, 0x3E74971F06C5A, 0x0000002DA92AA, 0x316F1857F2E08, 0x0000003FCCA79, 0x4F873245564C3, 0x00000054322E1 },
+    { 0x50683C9EA1993, 0x0000000000000, 0x30CC7D3C5B137, 0x0000000000000, 0x260BB69EB9675, 0x0000000000000, 0x3BC486C6B6EDF, 0x0000000000000 } },
+  { { 0x21C81BF3E0A3A, 0x6675433D4E94E, 0x6A7DF8B2CC105, 0x267C533D4E0B5, 0x3CA998BDCD4AA, 0x3462D9F9F586F, 0x2B60B49D3ECD9, 0x4574BABC74BE4 },
+    { 0x0CF08EB135916, 0x6FB64B1331B06, 0x1905748735CEA, 0x287828533BF91, 0x44640DCF334B6, 0x7B4ABC49F15D0, 0x1C5D4E008D17E, 0x2146F201C9696 },
+    { 0x08090751908DD, 0x1697BB1BBEC92, 0x7E50C632AF8BC, 0x24588B82AB7CF, 0x61B6E16AF7906, 0x5D1514B6A61DB, 0x704A2A5393103, 0x1EC12E83C93F8 },
+    { 0x09AC0F6ABE787, 0x00000067D38F8, 0x5F09C824E823C, 0x0000001E574C3, 0x3A63BBA89EB6A, 0x00000059B73F0, 0x7D0E0E8276834, 0x000000587E66B },
+    { 0x22BBFC31E80F4, 0x0000000000000, 0x5AADFB4FD94A5, 0x0000000000000, 0x04853F340FA0F, 0x0000000000000, 0x12766251781A3, 0x0000000000000 } },
+  { { 0x29BDE6F0EBE93, 0x6AEAED88034DE, 0x261255A4FFB17, 0x5A2010FAB2B18, 0x088F4636FD581, 0x23B9274680601, 0x56B74B96E2F6B, 0x2EB20F6E019E4 },
+    { 0x75409BE5751AA, 0x5EDA842422AA5, 0x73CF433F20262, 0x4AD88E6343889, 0x3C0870ADAA06D, 0x358E4154D70AB, 0x4B27C14CD243A, 0x230AE5D6B521F },
+    { 0x71AE997AD8C61, 0x2B1B7AB1FB98F, 0x271C93F5FC613, 0x7B42FDA1A5224, 0x61DACE39F9D6E, 0x4FB40824CF468, 0x543566B9860BE, 0x5376E684E4343 },
+    { 0x6DF70EBEC1509, 0x0000005DDA3D7, 0x2BA09880AAD7D, 0x0000002BEE7A7, 0x02DBFBBEB9CD6, 0x0000003BC8F49, 0x047639EA744B4, 0x0000005940660 },
+    { 0x24FF2831BA9D2, 0x0000000000000, 0x35C6D9B69248F, 0x0000000000000, 0x025FEA1B99123, 0x0000000000000, 0x4B70C2D5060A4, 0x0000000000000 } },
+  { { 0x1DAC2846BB8CC, 0x45226A68F857F, 0x004A471E0F97B, 0x6ABACBC667F9F, 0x5DEE85C248010, 0x455154B311F2E, 0x017CDD3E01E41, 0x0598938FAF99A },
+    { 0x250E4FEACCED8, 0x378B4398A776C, 0x6B4786A2927A7, 0x6019C4E68F6AB, 0x7161C51095450, 0x457C4E3356684, 0x026844961F399, 0x12B8FF2C1E26E },
+    { 0x2B1400C178C4E, 0x5C656A161C970, 0x04EA179588D28, 0x2B43EB80A2A28, 0x6762BDCABC2CA, 0x2FD48C8F96D38, 0x43B521D00BC21, 0x7F08238AAEA25 },
+    { 0x77D2AE2C0DF69, 0x0000002025FDF, 0x5F89623059941, 0x00000033B3E94, 0x0D07C8B9336CF, 0x0000004EE4990, 0x1011245EFC312, 0x000000448E064 },
+    { 0x3A1BFB5EBDBE0, 0x0000000000000, 0x186200DCC15FA, 0x0000000000000, 0x6E8C7BEF75DBF, 0x0000000000000, 0x789B694DD0F21, 0x0000000000000 } },
+  { { 0x3B725FB568A17, 0x091C6AB0C7437, 0x4CA7066B7D2FA, 0x1256BE003A56F, 0x6C7ACE1E54685, 0x022D1E7CC3F2B, 0x403C36557B92A, 0x605D05CF764E9 },
+    { 0x59E7E94FFF2EE, 0x0319E4BD5D1BC, 0x6ED252F680709, 0x778CA633E5037, 0x5A72674582164, 0x12139536EF6A2, 0x6A121765288D0, 0x4F36ABFA58D91 },
+    { 0x2F41346E94110, 0x3931E0235390C, 0x54247C1C49E2A, 0x31BD07A54C5D9, 0x5FC74FDFD4E49, 0x5447B4608A749, 0x1A2E63E358485, 0x0C6854DB722F0 },
+    { 0x5CAAE150AA71A, 0x0000006527920, 0x2A69F1AAD4BD1, 0x0000001AD2A22, 0x7755554DD71A8, 0x000000431B0BB, 0x02419C1CEBFB8, 0x0000003109BBE },
+    { 0x3A4B70F4269FE, 0x0000000000000, 0x293408DC7765D, 0x0000000000000, 0x6B3F1B7C8531A, 0x0000000000000, 0x1D44419E09E26, 0x0000000000000 } },
+  { { 0x41341A034E411, 0x05B08F4FFBA94, 0x49C97131CAA87, 0x6EB5E5A0F8F85, 0x20A8097C16C2D, 0x3B2BD6D24DA78, 0x47776FD82BCBF, 0x767EC6E4975A6 },
+    { 0x66C2B628D7234, 0x11B51F370178E, 0x1CEC33DA30A4D, 0x027C907A3E9A9, 0x054CA0C79EA0B, 0x3B0E24F05E9B6, 0x2A6071DC3BB8F, 0x789504A96E380 },
+    { 0x326D8C3A504F6, 0x6CF8055F35FE7, 0x7884CBAAE8BF2, 0x55418200354FE, 0x593AA83C35BE0, 0x197642061E14B, 0x111CE07D5BA10, 0x51EBEB9BA07C2 },
+    { 0x1600E79CBC1E1, 0x00000084A75FA, 0x5931A8A8D2EEA, 0x000000217B4DC, 0x6B72C2771B4F1, 0x0000004546D37, 0x47D010193963B, 0x000000444F7E8 },
+    { 0x23FF249FF8030, 0x0000000000000, 0x2730E118B2B38, 0x0000000000000, 0x6C31034F815C3, 0x0000000000000, 0x2B0FBCB45B657, 0x0000000000000 } },
+  { { 0x1056B8A2F3D9D, 0x28C8D2009ED65, 0x6179957ADFA27, 0x25F0E0106A846, 0x365C24D7BEFB3, 0x7497DAEFEDAA0, 0x14E47D1D0B437, 0x4A3F797F448A9 },
+    { 0x03266813C0E60, 0x32E238C9B4BBC, 0x04CC45966ABD2, 0x5C76D05A8B3E6, 0x56CD6A73D3A80, 0x4D03EBE320467, 0x43EDA4A0BF117, 0x05967E0C29AD1 },
+    { 0x02579DE8A1615, 0x73ECFB065D9AB, 0x66AE7E1229B64, 0x1FEDAAE8C10DC, 0x7EE87ACB7ABD1, 0x1FB37FEDF9429, 0x6585118B5B647, 0x2673847EEA956 },
+    { 0x09AE545126442, 0x0000006C789EE, 0x7914992F1F1C3, 0x0000001867111, 0x4500A0CAE0AF7, 0x0000004674B5F, 0x472B767D32F08, 0x0000003E42CC5 },
+    { 0x0563B8E719E00, 0x0000000000000, 0x6148E5A94AFBD, 0x0000000000000, 0x097E56E916758, 0x0000000000000, 0x2CDE21CEC5D4E, 0x0000000000000 } },
+  { { 0x7CEC432D9AAE8, 0x4D926102C2D66, 0x371C40207086E, 0x2C9F614D8F410, 0x2B37A7E443C72, 0x2D126814B5B1E, 0x2C8E787A0F208, 0x3F2C638B48D19 },
+    { 0x7CDBBEF0951C2, 0x3578F0B8E6A0D, 0x46018C181EFA7, 0x4BB8F3E19B014, 0x7CD4DE87C78A0, 0x310DA50A800EF, 0x74BCB1F010411, 0x489D7796DB00D },
+    { 0x22F12ED69878F, 0x55A1D04308C00, 0x3E95B9E3C7AF0, 0x33F37B4F7E71C, 0x4FD224A99FCCE, 0x7382B26274EB9, 0x03C24D2C17C65, 0x768A511769369 },
+    { 0x2285CC43DF52B, 0x00000026E390A, 0x7FDCBCC40334C, 0x0000002A086CE, 0x6355924FBE54A, 0x0000004988140, 0x50674204A69CE, 0x0000005B353F1 },
+    { 0x3A7A7C519CF70, 0x0000000000000, 0x1ED6BA0A9FDD2, 0x0000000000000, 0x7B2C6FA1B266C, 0x0000000000000, 0x44A7DA28C173E, 0x0000000000000 } },
+  { { 0x04F3DEF21581B, 0x775A992E2A5E1, 0x4EBDA12BDA92F, 0x66A064DE5F471, 0x292BF4459BC13, 0x6C8A0D030094F, 0x184BB48C6ECB9, 0x34A981CEDAFF1 },
+    { 0x4326D9B13219F, 0x6E3860D64E51E, 0x7A6F8D3A16B46, 0x0D4069177DF4C, 0x31344D25DAAF1, 0x55FA12BA5A4F2, 0x7CD73C596D248, 0x3AFEF6C61AB82 },
+    { 0x37ECE6B66FAB9, 0x13374F6AACD42, 0x0E9BFA76D4897, 0x410B4AF0F161D, 0x372F48C6AE931, 0x5EE958605A01A, 0x13514F964930B, 0x5D09827839FEE },
+    { 0x106DBEF04CFED, 0x0000008324E37, 0x376BF346E4EA8, 0x0000002D3774E, 0x21F30C8F65FA9, 0x0000004F8CF47, 0x3395DE50530A5, 0x00000033C548D },
+    { 0x5EFF9226F1DE2, 0x0000000000000, 0x626AA34C5B1A9, 0x0000000000000, 0x609B0EEF5B055, 0x0000000000000, 0x5ACE4FA8E8B3C, 0x0000000000000 } },
+  { { 0x525471698571A, 0x4AB2644674236, 0x5DDAB30EF9048, 0x6281292943E61, 0x0F873C03D2542, 0x2199201C10BE8, 0x3F7D6F8E62F3C, 0x6700A0EE8DA7A },
+    { 0x7F554AF9B5474, 0x1521F62C6FE4E, 0x703C3FAD22620, 0x29F74DD7FCF83, 0x4A5E483EB16AD, 0x4E7D6BE1A81C8, 0x5F75434A1E925, 0x42BE8C2030C93 },
+    { 0x7E9BA15D44EFF, 0x12FF236E55B57, 0x25733AC745204, 0x074613497C649, 0x146DFA2B54AA3, 0x287EEBF7A866A, 0x483BBCFBC7F32, 0x6286B111E4F44 },
+    { 0x5578B7891846F, 0x00000013B7358, 0x21DD7DFBBB62C, 0x000000247C721, 0x51C847E3A0DDA, 0x00000048B61E5, 0x259C1547CAA35, 0x000000464190D },
+    { 0x3B986FADF7CD9, 0x0000000000000, 0x596F9F3599C7A, 0x0000000000000, 0x046FA17638A81, 0x0000000000000, 0x68F15838117C0, 0x0000000000000 } },
+  { { 0x0FED4A0AA4256, 0x1838A277FDE13, 0x3381CC0E79CC4, 0x7F5CCD2C3080E, 0x484964A1943F2, 0x40F3663E41776, 0x224667A99772C, 0x3355C4B3A24A8 },
+    { 0x2A83F5B7CFB75, 0x523F39D768571, 0x661E226F616AC, 0x529C0C0BE7D87, 0x36E731381DD47, 0x247CBA3EA0051, 0x3B72489F3D107, 0x7A50A98F3CD71 },
+    { 0x633BDE53BD5CB, 0x4E141E1A95E2D, 0x583B1DD5A84A2, 0x5AF9A9FDFCFA3, 0x4784CF5A6A518, 0x66AE59A8DC8EA, 0x3DD8BE1537452, 0x56DB5DA25D455 },
+    { 0x57923A4B74CDC, 0x0000001B14899, 0x2E05D03DF6F38, 0x0000003D9DB74, 0x2DC8F728EB4C0, 0x0000003B2329D, 0x08EC66FFDD4F7, 0x0000004099C25 },
+    { 0x5E05BDBB4C405, 0x0000000000000, 0x104BB53BD950A, 0x0000000000000, 0x38C02A4B77B9A, 0x0000000000000, 0x46D8601305910, 0x0000000000000 } },
+  { { 0x456994199ED44, 0x59E153D61E53B, 0x7027B1425616E, 0x19B9994E67A39, 0x6F052A7B82C28, 0x085C74A96BB5F, 0x762B1383A6EDE, 0x0D087CC7F7B83 },
+    { 0x77D3836782F6F, 0x115535D7C7104, 0x065CA5F7D416E, 0x577666EA68521, 0x2FB1E3F52E45C, 0x6DC61B5676A14, 0x3D31D6093F143, 0x2C7AAE96CA00D },
+    { 0x1B5BCA36C7FB7, 0x7509C94531EB3, 0x033847869E035, 0x20395CF535F7E, 0x4F106C40FC0CC, 0x42FCCBBDB3F0A, 0x42C76D8D0F54D, 0x1EA3BA31A0156 },
+    { 0x6F66FBB169E96, 0x0000005BD280A, 0x12F270EE933AF, 0x0000002CECC14, 0x5922D4BBF945F, 0x0000002DE9ED5, 0x17D4DCF7CFF92, 0x0000005B31AEF },
+    { 0x7782D030B7222, 0x0000000000000, 0x197DDC0FD0167, 0x0000000000000, 0x7D8A738CACD00, 0x0000000000000, 0x3A472406D9474, 0x0000000000000 } },
+  { { 0x66685A3AD00C7, 0x2808C4FD260C2, 0x2FFF023C3C43F, 0x4B83C27AEF46B, 0x32861D3623655, 0x00D2DFBB90636, 0x4578822B7647F, 0x0C31A23B8A7BA },
+    { 0x3582799ABC011, 0x4912F67903D69, 0x2F2F265E04684, 0x2C04FA0D783CF, 0x281CD67CCBB71, 0x522B4700152B5, 0x5FD78E770BC81, 0x3CC4F56E2BFF3 },
+    { 0x6E106BDA2F78E, 0x796D0E93D9AF8, 0x0B4AFCACD1869, 0x2D96DB24F98EC, 0x321A5A8191F3A, 0x75EDBDFB7DBCA, 0x64B8FA1A1B064, 0x030C067720473 },
+    { 0x072F688605F7C, 0x0000001C5D61D, 0x6514C3105549F, 0x0000001F907B0, 0x31D9C53B06DEC, 0x0000005867A4F, 0x315230621C816, 0x0000004E184EA },
+    { 0x7462473199BB1, 0x0000000000000, 0x0B303358B74DD, 0x0000000000000, 0x657E151EC0259, 0x0000000000000, 0x7555761822C05, 0x0000000000000 } },
+  { { 0x2CA714EE08BA3, 0x7ED71598F533A, 0x3E3919065CDC6, 0x500C25732516D, 0x17464C69C7901, 0x297FD06C58886, 0x724EB988FA246, 0x30E22C9843C74 },
+    { 0x52DB4D9ECB3D5, 0x7A50EF44FA2FB, 0x1B02288FEF795, 0x22BB35FD9C059, 0x7CD9A1EB510D9, 0x7DA55F0232721, 0x508D454F03346, 0x6F1C51E58F9D8 },
+    { 0x6E01199D9C151, 0x4C963E440FEB3, 0x7ABE5DF1D68AA, 0x2B7FDA75BBA91, 0x5FFD80DA66550, 0x249CB26B2F8A1, 0x5F630D037A0DB, 0x3B13CF1E5756B },
+    { 0x6A4E436B04839, 0x0000006F41A04, 0x4F001C65F278E, 0x0000002443E63, 0x14C90FE916AD4, 0x000000590419E, 0x08AB629AE5453, 0x00000048D9113 },
+    { 0x40B8A1E85DEEB, 0x0000000000000, 0x65A23C3B1ADD9, 0x0000000000000, 0x1FCCFE8A1CB50, 0x0000000000000, 0x6ED11FFE94749, 0x0000000000000 } },
+  { { 0x30B302BB82477, 0x13D8673045D6B, 0x5FA4193EEC7EF, 0x2F7A27457B6A5, 0x23AF1CF781A01, 0x5F649D1705F95, 0x41F4B46820917, 0x029FA9DF82292 },
+    { 0x1AD1666C5D7AE, 0x403CCD8DE0E23, 0x0A1E95EABCBB1, 0x09546BC31AA2C, 0x07BB61570A987, 0x67AE9EA1735D3, 0x4488806A4A094, 0x4FC21E1690DF2 },
+    { 0x4934805C0E201, 0x2F4EB5E03A8A8, 0x56B439A5AB9B1, 0x7B041A66C84D3, 0x10EEDA9B239AB, 0x5F895DF48F435, 0x6376229B0C92B, 0x5FBC17019C329 },
+    { 0x03FA30D471208, 0x0000006058FD8, 0x35CE1588A3454, 0x00000031D6EB8, 0x71E2697C8C239, 0x000000238C40D, 0x5B025866F9885, 0x0000004B34C51 },
+    { 0x60018A7E17307, 0x0000000000000, 0x3CC9BA170C073, 0x0000000000000, 0x428F0EF0EEDEB, 0x0000000000000, 0x59A44BA62A93E, 0x0000000000000 } },
+  { { 0x57F769423F4CD, 0x78EA25EC783D6, 0x59A0F84D1BB4C, 0x7B05BF8C645B4, 0x2EBDE6D69FC6D, 0x728D35710F2E0, 0x65756487BCEC8, 0x111711957B313 },
+    { 0x214D073376A8A, 0x4248C3DDD2F03, 0x04E1A10B4FB2D, 0x0843953FA7C59, 0x4E8E0BD52FFF0, 0x3AAEE306AF5CF, 0x4481525A1DC6C, 0x646BF4A1CF52D },
+    { 0x33916D99DBEC9, 0x2720AED9E9726, 0x5F7016BACAD19, 0x1DC09A4FC11F6, 0x6AA88651174B3, 0x055579AAAB923, 0x05983D16BB4D5, 0x1A70EC7B0743E },
+    { 0x0297951BD95E3, 0x0000002956756, 0x76EF10A6CECAD, 0x0000002549659, 0x68CF4C61BB818, 0x000000298D5AC, 0x5409FBE20CF4F, 0x000000333A503 },
+    { 0x7A2EBD4DA9D66, 0x0000000000000, 0x63DA57FAE38B6, 0x0000000000000, 0x18D1836FBA3CB, 0x0000000000000, 0x3A482FA396EDC, 0x0000000000000 } },
+  { { 0x4E551587716D1, 0x78BD363F1C13F, 0x0A60B9538FD44, 0x7ABB2D3FD3EA2, 0x7CB991BEFF913, 0x1BB16073BAD3D, 0x456BA1135CCCE, 0x56F3C3EAE36E3 },
+    { 0x423B451C9A695, 0x4D9F26BBF29E3, 0x566056DFB698A, 0x69489DC4DB4CC, 0x5F432280558C3, 0x7BFD8B89588C4, 0x7B3596E6F7B66, 0x4F2F88FD6C776 },
+    { 0x03EDAAB5373DC, 0x0C501F27A78C9, 0x6D0B91426B7D3, 0x4B83FC133310B, 0x425633D8C2DF1, 0x3B3FA223D5A40, 0x643716BE7316A, 0x338ACF62D8318 },
+    { 0x3CFD4CAB672B8, 0x0000001B294FA, 0x11FC570281203, 0x00000027FD516, 0x6B0F3AF7F6D94, 0x0000002D92192, 0x199AA2F4CEF63, 0x0000006482369 },
+    { 0x3CF8FD2843E42, 0x0000000000000, 0x4B4D8DC92E08B, 0x0000000000000, 0x6956A1CF48879, 0x0000000000000, 0x163B9D324F707, 0x0000000000000 } },
+  { { 0x24D16C59EF7B1, 0x77B93D156E0FB, 0x5BA8B2BED4307, 0x2D5D8291D3798, 0x6AA6058796FF9, 0x4DC48F37DF00D, 0x56053CA676395, 0x4E783F6264BFE },
+    { 0x3F0B04DBE1CAF, 0x797D869F91203, 0x0E5EA3A171367, 0x5F7EEE86A82AA, 0x788BA0234A7C3, 0x79E132357F068, 0x7A5D1263CD54A, 0x21C428C0C5389 },
+    { 0x0725F46648D89, 0x59A815A15CD22, 0x6D9D111A228C4, 0x0AEA1988396D2, 0x33F9AC006528D, 0x1116B8681026E, 0x48C9292009DAE, 0x66C29C469960E },
+    { 0x4E76B872E5BC3, 0x00000071B3D45, 0x5EE61CE67D696, 0x0000002D4B009, 0x4DFF6F0CE6BFA, 0x0000005334370, 0x20ED31D097957, 0x00000055C7939 },
+    { 0x0ED3628CD6C04, 0x0000000000000, 0x0AD0B49BFAE69, 0x0000000000000, 0x2FFCC4D9AD001, 0x0000000000000, 0x18584B2EE980C, 0x0000000000000 } },
+  { { 0x4793663070E22, 0x3D9283CBA5B9D, 0x5B6B90509DC56, 0x0651A8918B789, 0x580425F7854E4, 0x143FF9CF7EFA2, 0x5CB6368E61C60, 0x0C5CFF78F629E },
+    { 0x5A68239CC0FBF, 0x5AFA7AB1B06E1, 0x45383D20772B6, 0x5D0A620A6E4FF, 0x512B7E7596C18, 0x11F97FBA5E77A, 0x37DFEF9F062D1, 0x3E5B836E6AE9A },
+    { 0x16AC1F9894A7D, 0x20F7065EB6CCE, 0x265BBAE0EA87D, 0x550DD03E8CC44, 0x3684D17BB6F50, 0x3CB177529E0C8, 0x189117A1A7D6D, 0x38FE906489167 },
+    { 0x5FC480D36F2A9, 0x00000058C7D4A, 0x13607D9935C67, 0x0000002E32324, 0x46C1298B068F3, 0x000000681DE83, 0x0DA7F6C9C15ED, 0x00000042352CF },
+    { 0x7FCCA4149CA23, 0x0000000000000, 0x7C063241B3946, 0x0000000000000, 0x0F7D559857B7F, 0x0000000000000, 0x0186C7C8BDDB5, 0x0000000000000 } },
+  { { 0x5DC32AC591912, 0x2A098122A50FD, 0x4B02CE9DBC13B, 0x29F812CF21D7A, 0x1F2765DCE2006, 0x6B2B2B5060677, 0x66F4B65D028D1, 0x65488E040F08C },
+    { 0x20CA9CA00EC2D, 0x4EE085C8FE82E, 0x0DB74C11C2FCC, 0x769394E5C01A8, 0x06C9A6996C440, 0x54374177A46E2, 0x36034AA7A0D15, 0x22C2230A4EAC1 },
+    { 0x6FB506F5BAF2A, 0x52A575E115E32, 0x1022E47DF6E02, 0x2D3F67728D766, 0x3BE8E90A27C06, 0x3426A9A61F2B9, 0x365BEC2442D8E, 0x10681757A1E7F },
+    { 0x62357D1523CC4, 0x0000002AA146B, 0x4A90D4D1B362A, 0x0000001BEC8E1, 0x02E3B28A6EC97, 0x0000003F7B9EA, 0x0E5EE41885A4A, 0x0000004688740 },
+    { 0x0B06925D92381, 0x0000000000000, 0x6C9A16C8672E2, 0x0000000000000, 0x1879E8AA728F6, 0x0000000000000, 0x192230436125F, 0x0000000000000 } },
+  { { 0x125069F6B45FD, 0x3357F7BE465C4, 0x1707CD26DCF97, 0x1679D58A184FE, 0x5517FBA665319, 0x010AD74063F7C, 0x2A4D56B4575B1, 0x1CDF6D1C894CC },
+    { 0x2DC30FFDF9FFB, 0x2851E77EBCF41, 0x4FA226E4A6093, 0x3F25FF1A55D36, 0x55C0AA43D29AE, 0x4C282E0962C3C, 0x1667B60EE67AF, 0x63F6866178FF6 },
+    { 0x3953590049D60, 0x05A657C935858, 0x79F85E477B905, 0x516C78AD85308, 0x7DDE976474711, 0x771F269F66E26, 0x385903CC42FB1, 0x691912E193777 },
+    { 0x4B45698EFB9C8, 0x0000001C5898C, 0x58DB8B3BDC137, 0x0000001E23373, 0x62F29E7DF2A2F, 0x0000004D7FD4C, 0x5AA0B1FD838D3, 0x0000003C76035 },
+    { 0x4C69A94723DC8, 0x0000000000000, 0x31C220105C517, 0x0000000000000, 0x680AAE7069B72, 0x0000000000000, 0x13042EFF63C70, 0x0000000000000 } },
+  { { 0x2A30AF632A0F5, 0x7438D7CB820DA, 0x69E7ABAEA247D, 0x4CB7AF261FA81, 0x6883F98504B71, 0x75C293207AF5D, 0x41D2614F064D7, 0x013DA0B700043 },
+    { 0x3F8D18C820F23, 0x51ED6BF566087, 0x10528E48C3BFC, 0x63CCE60AE4AE6, 0x72E1C12D39355, 0x16069C27B1ABE, 0x53F2181447D62, 0x5A34ABBEB4B5F },
+    { 0x77DAE8037A771, 0x5E833C3C27C96, 0x1F82FDB130963, 0x011601E0FF9CF, 0x577CB93A7BFEF, 0x50A44E7CC9485, 0x56B449E844890, 0x57334F904FEDC },
+    { 0x1E0D0D6133655, 0x0000000BE8BD7, 0x592A0C6A4AB0E, 0x000000170ECE6, 0x6794C58B36078, 0x0000004969077, 0x5B22C7172875C, 0x0000003761D6F },
+    { 0x319AB7E199FE1, 0x0000000000000, 0x2262A7C7B4B5F, 0x0000000000000, 0x608B4ACC36C76, 0x0000000000000, 0x4ECCD808E782F, 0x0000000000000 } },
+  { { 0x1493243F3BE74, 0x5C9267B55F96F, 0x3EF83E20F01D3, 0x778BC6F8542AC, 0x428D711630588, 0x3ED504EE048D0, 0x4ACEF2F7DD6D9, 0x4D668F5698BA5 },
+    { 0x433F994BA5791, 0x79941BA4EA6CD, 0x44EF64E814EC9, 0x3D85665E5884C, 0x759971450ABC7, 0x0DDF9C58343DA, 0x4023B09CFDA30, 0x609A32F6932AC },
+    { 0x4529051AFB985, 0x7B7A1915F2CFE, 0x395E3677DD7F0, 0x013820531F3CE, 0x7D454768201CF, 0x396767519F944, 0x41D117A78EB8B, 0x76DCD2BAC1B8E },
+    { 0x5156DDAADBC6E, 0x000000233F2A8, 0x02771FD167D16, 0x0000002916903, 0x0209A221CF648, 0x00000026FE3B0, 0x22A45F8CC1377, 0x0000004BA7C2F },
+    { 0x1A38B8AE18EA4, 0x0000000000000, 0x5EC0D59E3A438, 0x0000000000000, 0x0E0A39564E80E, 0x0000000000000, 0x13C47D4B69EEB, 0x0000000000000 } },
+  { { 0x3CE27CCF1489E, 0x65D8353D22D77, 0x22C4B3CCDA9A2, 0x7F44F2B48499E, 0x206682417051A, 0x4F7A498AABE59, 0x5CF4ED6ABF526, 0x45DEEFA7FE49B },
+    { 0x70869F59C1DA2, 0x62D64504FEBEF, 0x50D34C228C295, 0x61C6E73D9F824, 0x58FD57BEB0099, 0x62FFD3E9BD5BA, 0x0BB3377D36E0B, 0x366FA9C3F5DAB },
+    { 0x10C2038064B7F, 0x6E1D85C7A68FB, 0x786E10088F191, 0x2C738CF282DCF, 0x4F8897E899163, 0x014AE6A90D877, 0x5A20E028EBC24, 0x08C24CD0A4447 },
+    { 0x16305F16268B8, 0x0000005315EE3, 0x044016BA274C1, 0x0000001F0EAB0, 0x7AFAFBC6A552B, 0x0000003D58C7F, 0x7C076BE2B5157, 0x0000002CE899C },
+    { 0x3D73AEEECEFDE, 0x0000000000000, 0x27D3FFC6389A3, 0x0000000000000, 0x73DCAB7F5970D, 0x0000000000000, 0x12AD6CBFBC35A, 0x0000000000000 } },
+  { { 0x437191C0EF33E, 0x7A2485355C75D, 0x41A8AB050193E, 0x5B9DE781AE837, 0x11595869AB9A0, 0x6FFCD15287353, 0x38E72F20A7ECC, 0x570C0FB98D99E },
+    { 0x41C863A4F6C31, 0x5F2E0F5D7B06B, 0x3E98CDC142269, 0x36528B4D5F815, 0x03B23B631095C, 0x257A893FFDA22, 0x703099C198F6A, 0x60C905805EA84 },
+    { 0x6F2E0ECCC6EFA, 0x19C837031B980, 0x3BEB5CF539A9E, 0x6C91FD45D8A19, 0x5A93EFA543232, 0x77CEAEC4FA82A, 0x663EAFFADBA20, 0x2069E2493AC20 },
+    { 0x6D89092E9CB67, 0x0000004E7E1F3, 0x36A670FCCA5E1, 0x000000159AD8F, 0x54B714A344CD0, 0x00000068039A4, 0x563D5617DD127, 0x000000536D48D },
+    { 0x0AC95F31E682E, 0x0000000000000, 0x36507A2DA135E, 0x0000000000000, 0x222AE4A215C53, 0x0000000000000, 0x257379F321754, 0x0000000000000 } },
+  { { 0x2474D18B47971, 0x45E9F6AA0970F, 0x1F759CF9299E9, 0x73DD8A113CD80, 0x405FD932CE2FB, 0x5F92B1E376210, 0x62BFC8A700B79, 0x690A06148843A },
+    { 0x4401A3F21BC6E, 0x128221B389ED0, 0x4484FB54653A3, 0x172761834DE36, 0x4CCD663DD3323, 0x152FA837C6EC4, 0x5C42F933203C7, 0x29964381ECA7A },
+    { 0x24003078DFCEB, 0x4135DA698DB8C, 0x5C3EF80C4003B, 0x39A1EC4898506, 0x024F88E3E20FB, 0x5F0CBB36D40F3, 0x43083FF32997E, 0x021AFB72C539C },
+    { 0x4292FA0CF605F, 0x0000004661DD8, 0x567DD778A5504, 0x000000359AF67, 0x781DE4DB13AC6, 0x00000064B239C, 0x3FFAF017DC27A, 0x000000432C6CB },
+    { 0x3B28B1E1022E0, 0x0000000000000, 0x1465E7286BAFD, 0x0000000000000, 0x2A6BA72868558, 0x0000000000000, 0x4625C226B158A, 0x0000000000000 } },
+  { { 0x1F82FD675F3FE, 0x659A5BAC57F5D, 0x2E26BFEF0970B, 0x719ACEC82B7C1, 0x5443937DEE428, 0x0A2866AA02925, 0x22A7CE2F6C5F7, 0x0ED0F2BCA93EF },
+    { 0x1875143EB4C99, 0x530C7F6E76F43, 0x611C192B5CBF8, 0x1F8420C33FCB4, 0x55F717E939B0C, 0x51C50EF8BCB1B, 0x76C247B83BAF5, 0x56107D5D24A27 },
+    { 0x1589915973FEF, 0x01F65DD04354D, 0x1D419941E200B, 0x047724236CA1D, 0x65ED12994E819, 0x6B4FABBADB3E5, 0x594EB471F9AE6, 0x43D4E84392BED },
+    { 0x359BDAD79ADAC, 0x0000005BD3040, 0x2B535290233A0, 0x0000001D8B612, 0x3EDB2CA8C1C40, 0x000000600B6D0, 0x7557CFFE60670, 0x0000004D3F55F },
+    { 0x490F14B7F5301, 0x0000000000000, 0x22F239259FDA5, 0x0000000000000, 0x47B95310B3C4D, 0x0000000000000, 0x0CD5592C7A8E5, 0x0000000000000 } },
+  { { 0x422BF67EAB51A, 0x0AABAD7846762, 0x15EE1859477AC, 0x0A80E4F58BC11, 0x627CEE8FF95A6, 0x7F76E876063D4, 0x2A1AD8EEA88B8, 0x245F96D6E6F97 },
+    { 0x08FBC62AEDED5, 0x25C09E2B36395, 0x2D9218808829B, 0x1B7CA3751917D, 0x20006AF846B8F, 0x414109A718551, 0x6E3F089073927, 0x5B616454ECDE3 },
+    { 0x786C1493B952F, 0x77A4FA62ACC44, 0x65C71CAD5B896, 0x2C4B5DE26647E, 0x0F9015AE177BA, 0x343E6D450F9D6, 0x3381AB5847598, 0x47B31DF1FA421 },
+    { 0x3618B5707A749, 0x000000179FF96, 0x26DEFA76B0541, 0x00000029FB66F, 0x1E24336BB050B, 0x0000002F2FEA1, 0x789BE795D5C9D, 0x000000577B95C },
+    { 0x19DAA37986BBE, 0x0000000000000, 0x302CB3B02D238, 0x0000000000000, 0x3E06B6563CFDD, 0x0000000000000, 0x78564240CFBEB, 0x0000000000000 } },
+  { { 0x6FF0F6F70943B, 0x281847F4AAB74, 0x64E9E6DE76855, 0x399B02CBF58D1, 0x6575C68D119DB, 0x5A718DE394ABE, 0x734F792FCCD47, 0x13E486172F3AA },
+    { 0x304D43392CA2E, 0x68C9720F0852C, 0x7D7B38DAFE9A3, 0x62A2E16CE96B2, 0x67A5848940BDE, 0x589866E1B88E7, 0x7C5386A7E3B64, 0x7B62CD8F43EEB },
+    { 0x040217B08F8B0, 0x325FD16758B3D, 0x46BBD07254155, 0x30D4DC7C35576, 0x36D8D96992A68, 0x0379B376E6A1E, 0x140FD71269F08, 0x5ED3E40F8B972 },
+    { 0x51998D6D5FA39, 0x0000003EA28E1, 0x5334A29DB9394, 0x0000001FEF073, 0x6403C078F446B, 0x00000011337C6, 0x4CB7FD1321BC2, 0x0000002A46BFA },
+    { 0x6543167C5BBDC, 0x0000000000000, 0x19CC9755C7FB3, 0x0000000000000, 0x76B8DF79D04F6, 0x0000000000000, 0x500E9A5AE5738, 0x0000000000000 } },
+  { { 0x771586F66CF9A, 0x785C83144BB10, 0x5E475ECB406ED, 0x549D905C2405B, 0x4E1E54DFB0EAC, 0x1674B0F6475AD, 0x10A3D9676ECC9, 0x67FB3517B8B99 },
+    { 0x406E2ACC3C0B5, 0x0ACD37221F8A1, 0x64FB049EE96F4, 0x148A86ECBB718, 0x5D2AD73B93428, 0x47374020163D4, 0x4A80CE4753151, 0x3FA3238B47BC3 },
+    { 0x2FD90FC7AD86F, 0x31401EED0ADAD, 0x5899CBFA89814, 0x76427E1536524, 0x7D2F7B3C362FB, 0x67F31360C7843, 0x3D94BE089C6AD, 0x1929E2A1CF010 },
+    { 0x368A24C51B8EC, 0x00000020DB60C, 0x1822883A03BED, 0x0000002D58BA5, 0x78F194634899E, 0x0000003849690, 0x3F826A29BABF4, 0x000000456A9CA },
+    { 0x2F84FA2931FEB, 0x0000000000000, 0x26667A359CE41, 0x0000000000000, 0x30680687A82D5, 0x0000000000000, 0x075FB3E90E4F4, 0x0000000000000 } },
+  { { 0x57BB88669F729, 0x4ADF624D96463, 0x3F4C9C157AEF9, 0x02DE9FAB16C51, 0x6FFA426B03C4F, 0x6CC3039AF6349, 0x2AAF8053C8761, 0x29356DC0A65EB },
+    { 0x03E384051FB4D, 0x59113F3320841, 0x52B70AB608738, 0x6F57A4E01F2DE, 0x701F513E8A35E, 0x2133B11CD68FC, 0x3C69D724FD678, 0x18E386DA0256B },
+    { 0x76B3BB9725164, 0x7C45018F6A245, 0x442E08267D5F0, 0x25A6810C8220D, 0x4EA5C5D54A46E, 0x6AB2F8A9AC0D9, 0x3EC145C042593, 0x53D2CC50AE19B },
+    { 0x1BF356AE38D30, 0x00000042F77CA, 0x0F26A7AF315CC, 0x0000001B500FA, 0x391A14321917B, 0x000000674D813, 0x2AC575B8C7886, 0x0000004643224 },
+    { 0x48BB930B10552, 0x0000000000000, 0x4ECEA8A92D1E3, 0x0000000000000, 0x6AAB779E013E6, 0x0000000000000, 0x41219475EA3FB, 0x0000000000000 } },
+  { { 0x74635C63D3B6B, 0x291DEAA298BAC, 0x4270EC2A2939E, 0x7FC516FC92423, 0x48F3201F9C765, 0x69CCBF9B5DA61, 0x0E64C4AFE82B0, 0x1388673928B58 },
+    { 0x79AE8281D1B10, 0x0A4E9309562F1, 0x489C7F4F9B2A3, 0x2896F0C49459C, 0x295F401111A14, 0x32F3B966A966D, 0x23FDC12188BE4, 0x3AE2B005C17E9 },
+    { 0x79D41772AA304, 0x66DA3936927B8, 0x0FC257AE2A917, 0x44F5822BD587B, 0x33566B0DC5E34, 0x5A21A6FDAE4F2, 0x0720E66887556, 0x53A33B988857D },
+    { 0x36B16AB906654, 0x0000004F4C48B, 0x7D4D61B26AFF0, 0x0000002A01469, 0x56CD12B57B336, 0x0000001B71A92, 0x5773767E041CB, 0x00000039A7D91 },
+    { 0x36196F42DA25B, 0x0000000000000, 0x3123763E8BB3C, 0x0000000000000, 0x4A79C7690794B, 0x0000000000000, 0x7A27914CFB9AB, 0x0000000000000 } },
+  { { 0x3C91CDBCC7ABA, 0x6F6D8ABCE508E, 0x790C0C6A8C421, 0x63C774E3D0E53, 0x709FA6A647BDC, 0x5788EA500205E, 0x61E6884AE199D, 0x6E446D8B542CF },
+    { 0x1A2E906D8DB38, 0x40AB2DA029F45, 0x66C0D16A046EE, 0x7CE01E8D8C34C, 0x50FAFDEB4226F, 0x79E9C98905A16, 0x16319C4D3D506, 0x609906FE5341D },
+    { 0x592E27B1020F5, 0x03B11F874714C, 0x561C2DE6A0A0F, 0x3648362D60246, 0x1FD932093DEB9, 0x514489532EC8F, 0x01AF7018A812B, 0x5A1A6C8CB80CA },
+    { 0x7B63B860DDD15, 0x0000003D6B7D4, 0x39A2DB1C754A3, 0x0000000D191F4, 0x160079115B9C0, 0x0000004A86ED4, 0x4E981E7D72DA5, 0x00000049C001F },
+    { 0x4AA38723223E1, 0x0000000000000, 0x16A76396CAEEF, 0x0000000000000, 0x657ADF6B4E72F, 0x0000000000000, 0x2EA195969E5D6, 0x0000000000000 } },
+  { { 0x7FB3A7BA74078, 0x79C326B632B57, 0x3E3D89E4000F0, 0x76EDD6F41D9FB, 0x687E2E7F951C0, 0x7F0944D069280, 0x22C18C51F41EC, 0x26395852A7A41 },
+    { 0x3C00D51DA5E4A, 0x4CFF9A0A015C9, 0x759EDC886451B, 0x5E77C4D54B4AD, 0x040ED9B671F95, 0x6FED0AAE944AC, 0x1C2F7F05DAA66, 0x0DB2DDEB7A8C4 },
+    { 0x7393586A31084, 0x5E5019408E58A, 0x00233189A7FF6, 0x5C9C51A56A9C4, 0x596FBE9AA206F, 0x4263A4E601785, 0x5998732AD8FCF, 0x6976A082BDA25 },
+    { 0x628A2BA6E8D44, 0x00000047726B8, 0x0CB2EE902544D, 0x0000002C30D11, 0x527DF6F64F898, 0x0000004A7835F, 0x59842C56095F8, 0x0000004CE9DBF },
+    { 0x7486AAA0CEFC7, 0x0000000000000, 0x13FAC47E31491, 0x0000000000000, 0x382A20D501E56, 0x0000000000000, 0x6DAC102776970, 0x0000000000000 } },
+  { { 0x2E8D9C348B758, 0x26833DC80E768, 0x79B8B6AF7D2D5, 0x1F37F548274FE, 0x7BE3A32C66A64, 0x1DB24DF3770EE, 0x326B1B7BBD6DB, 0x0D7E9502F7EF6 },
+    { 0x49CA9AA7B21AA, 0x047BF1159CCAC, 0x2E6CBC6F38131, 0x1A64CAC43EEA0, 0x2C3C3D3504E74, 0x68A28D8206B80, 0x20C602FA9F383, 0x62CF4F4DB7C73 },
+    { 0x51D6367AD9494, 0x28AD9C9C84197, 0x5D5E022E117FD, 0x5314D86CAD8A8, 0x15571BA94F247, 0x1E3B428EF15EB, 0x2D65F5C279D29, 0x051A485FBF0C4 },
+    { 0x66CC4DC679443, 0x0000005607EE0, 0x3BA14F010869C, 0x00000019882BD, 0x1AC3D2081D2CF, 0x00000045F0BCF, 0x4468698A5A40F, 0x0000005F98535 },
+    { 0x2E108AE3F9FD0, 0x0000000000000, 0x0772B0709E717, 0x0000000000000, 0x269D85F6DD857, 0x0000000000000, 0x3BED3E3E28AA9, 0x0000000000000 } },
+  { { 0x2BDFF7438C181, 0x10F52B768A61E, 0x68587DC2837E4, 0x4FB271EBDB8F3, 0x68AC9046C09B3, 0x1FF213ED5636C, 0x75EAE68290B10, 0x406362DB7743A },
+    { 0x4DA8E1E03E31C, 0x343188FB8594F, 0x4C9600354334C, 0x69066AB8D893C, 0x545EF9263FE01, 0x791151D4DF925, 0x02AC7897C0E6E, 0x0F67E9230A308 },
+    { 0x5B1F126D015DE, 0x552D80EE0227C, 0x445019CE8D9B5, 0x0903EC386E9F2, 0x2070FFFDBCF5A, 0x020D97DFA0D3D, 0x1D6B6B3519E94, 0x3FD4CEFB82D66 },
+    { 0x0EFF47E29BB38, 0x0000004721A06, 0x393E7F4A4E677, 0x00000021046CB, 0x00AEEB44085DD, 0x0000001108889, 0x688DB4C0B8215, 0x0000002BD1619 },
+    { 0x7E48CE6FD2963, 0x0000000000000, 0x6BF1A601E79C3, 0x0000000000000, 0x2443EA86483AC, 0x0000000000000, 0x60A7C762A65AF, 0x0000000000000 } },
+  { { 0x22C91B7E55A87, 0x1C44630172154, 0x181EACDC9B077, 0x719554F150936, 0x3C75356705371, 0x6C79DA219C265, 0x5CE09BD5DE5A7, 0x58DF8EC6A0C5B },
+    { 0x25F80DE9459C7, 0x1201DB0CE0502, 0x51CF72ECACB3A, 0x67233D452CC53, 0x37CBA9E482604, 0x6520184A9B84C, 0x4F760BE00E705, 0x1481F06F30BA0 },
+    { 0x0544C5B043EB8, 0x0E2A357462D3D, 0x522B2608112D0, 0x2DAA73AEEB507, 0x4AF6923EF5C3C, 0x2AE1A7A8B9565, 0x3EA88E665B403, 0x5D61964887ACA },
+    { 0x63671E55CE103, 0x0000000668BF7, 0x67803830F1E43, 0x0000001BD8B89, 0x62B97FAA0D3C2, 0x00000041E6FCB, 0x64C4BD2342D46, 0x0000004EA5597 },
+    { 0x78D2417F828D7, 0x0000000000000, 0x2400978903795, 0x0000000000000, 0x119AD31FC014F, 0x0000000000000, 0x4FD8DCD28B1D6, 0x0000000000000 } },
+  { { 0x77BB70863D873, 0x18E1288B00B12, 0x33D9E344C44F0, 0x0CF587E882E6C, 0x0BB6293E5C96B, 0x187C8588B9E89, 0x3C3F0B6420560, 0x5379073DC2457 },
+    { 0x10E80020AAB47, 0x79F4161BA9590, 0x67A0C57938C53, 0x00DA647CB1A1F, 0x1009DD51741CA, 0x57F2A9252500F, 0x5625B54769D78, 0x30268162CEC73 },
+    { 0x74C156B4D3491, 0x28B47165E7D19, 0x29CD94C85FADE, 0x6B423DAEB4396, 0x5F8019FE0EFFC, 0x2B5D4D60CDA49, 0x3F2E7F14805C8, 0x7EF7E80A9CA7E },
+    { 0x56DB50B5BFB25, 0x0000001F76632, 0x3A8250D0271B2, 0x0000000214C4C, 0x3A65E3F584E95, 0x00000046D443F, 0x721B8A3884399, 0x0000004789973 },
+    { 0x18F23DECB3E60, 0x0000000000000, 0x39584BB50B902, 0x0000000000000, 0x6D288F8DFDA85, 0x0000000000000, 0x21D5817E3DDC1, 0x0000000000000 } },
+  { { 0x105B3BF3C3BC3, 0x75FFEA00CA494, 0x72C28C37F105A, 0x065B56C970FBA, 0x4CD87799D0FC5, 0x6CEE01FE2300A, 0x40E0EFB3C0EC4, 0x37A0916825937 },
+    { 0x68B8460579EDE, 0x51A3082383833, 0x04944C29770E5, 0x2066C05B38904, 0x3BC80E94F91BA, 0x3E178BF31C546, 0x7758B0150EA16, 0x56C982FE1F4F0 },
+    { 0x35CAEC76A9475, 0x050EC160A034F, 0x0CD1F93FB157F, 0x2557EFB0A7A72, 0x53400CA8054A5, 0x22E0C93ACED89, 0x6DBC3FF072518, 0x5C16F62DD2BFB },
+    { 0x12E55445C0EA2, 0x000000324E96F, 0x4A2E650EABF95, 0x000000349DD5E, 0x6AF9E8C0FD53F, 0x00000036504FE, 0x4FE030659EC61, 0x0000004CD7431 },
+    { 0x2FACF1C9AA4EA, 0x0000000000000, 0x038CDB4355EDB, 0x0000000000000, 0x7BE397292F34E, 0x0000000000000, 0x4C81E4C5168AF, 0x0000000000000 } },
+  { { 0x4B2080486F630, 0x003D39490F0D4, 0x2A332D52B84F9, 0x6999F8D91BE91, 0x6EF7C94C19670, 0x2B6A1B667E1B6, 0x1491312F42275, 0x7D325ADC23D1F },
+    { 0x1A4F1B7C9EECF, 0x61672B3FBA5AF, 0x021FA3D8CC064, 0x1E80D257079D9, 0x5A0DD7C270219, 0x1E834804830EF, 0x60AB70492FDEB, 0x025C604785982 },
+    { 0x261444BFD86F6, 0x3F1EC96B7B515, 0x4098BCCEB1BFD, 0x416B61898947D, 0x433937F860016, 0x70A83AA5DF286, 0x5893F3A17E474, 0x6142DA91688BF },
+    { 0x0D94EF41226D6, 0x00000052FD4C3, 0x39B4EA1F90809, 0x0000000BC4001, 0x4E9429F82DF73, 0x0000001E84E5C, 0x4D24AE0CFDDA9, 0x0000003B64423 },
+    { 0x6FFF2B498E597, 0x0000000000000, 0x3284EFBF56A12, 0x0000000000000, 0x356669999893F, 0x0000000000000, 0x5203038C9A283, 0x0000000000000 } },
+  { { 0x2AC089B7AA3E5, 0x5DC758243804E, 0x1319DDB2936F4, 0x30ED55017CB8B, 0x24416F166BAAF, 0x083C75F3579FE, 0x3051D7B813F9A, 0x4788815CF9BA9 },
+    { 0x41F26B27DB82E, 0x080A544A4DA27, 0x6C65C0DC9B29D, 0x6D3D291B55CA6, 0x5773109804820, 0x5165F46E3A6BD, 0x1CA79A8BF03FC, 0x4EFA837E90F96 },
+    { 0x6A9D54BCEDF4B, 0x2DFC2723F71A5, 0x6D92DEB4BF465, 0x189027A347EC5, 0x12343132FBD36, 0x524E794433BF5, 0x4323211DC39C2, 0x324AC146B2576 },
+    { 0x0D6500A6C2CCC, 0x0000001464070, 0x005DEE549965C, 0x0000003C01591, 0x645237F4F335B, 0x0000004978100, 0x06B3986D167D8, 0x0000004741176 },
+    { 0x531FE0D65D8BA, 0x0000000000000, 0x138D7358FC3D0, 0x0000000000000, 0x54F996052D075, 0x0000000000000, 0x38B8DC42BD359, 0x0000000000000 } },
+  { { 0x4FE6407FDFC42, 0x0AD7D94080BA1, 0x5E90D3104C9DE, 0x0BB93725C2AF0, 0x267DB6D060CF4, 0x68674D6E29CD2, 0x2D35B307E316E, 0x0A21F70C0B990 },
+    { 0x034B246E9885C, 0x39F4B9D8731F5, 0x45C3480D6BBA5, 0x1C0EDA6EC5D36, 0x4CDBD5CF4F39D, 0x05DC6BBCA6060, 0x5396DAA42EE81, 0x2C08D973E9600 },
+    { 0x71DD7E35ED999, 0x3FE362F205DC8, 0x511E2BE72B458, 0x2763C7F4566B1, 0x26685BCE9B0FF, 0x53363FEBF1E19, 0x68640CB97811F, 0x7FCDFF0980B7A },
+    { 0x70E00FE45EE52, 0x00000028902F0, 0x6C90023D8B484, 0x0000002B6B099, 0x084887C91D05D, 0x00000048789B5, 0x4825304137A67, 0x000000394E806 },
+    { 0x54D953822735C, 0x0000000000000, 0x0DDD6ADF69560, 0x0000000000000, 0x0270862E7A91C, 0x0000000000000, 0x4129793401B27, 0x0000000000000 } },
+  { { 0x7BD0FEE1BB05B, 0x2CEFA1656B387, 0x7BBDA7915C885, 0x1900B0AA5E807, 0x0FF8BBFA10873, 0x6B1654FAA71A7, 0x33C2ED3EFD6DD, 0x11E9939F74AD3 },
+    { 0x78DFE8438857B, 0x5C639EB9B070C, 0x62EA409B32C76, 0x6F3D2EBF36A7B, 0x2B12736241C5A, 0x790F912ACE597, 0x4BFD3F9818DC7, 0x4DFB644B4659B },
+    { 0x696661037150C, 0x2BEE43A53AD1A, 0x36548720D8518, 0x41CE09263DAF8, 0x08DBDD61DA062, 0x3D41A5DBFD654, 0x4AF74B82A16EA, 0x36939237AE851 },
+    { 0x76A52A6692543, 0x0000003501E70, 0x270FACA1DAA61, 0x00000011EECD0, 0x18B54177ED979, 0x0000006346358, 0x626648E6FA323, 0x000000381D144 },
+    { 0x6ABDDCA83E1C6, 0x0000000000000, 0x0D28780D339A1, 0x0000000000000, 0x6891B923C65C7, 0x0000000000000, 0x243A707880201, 0x0000000000000 } },
+  { { 0x66474D2A7DC78, 0x4C7A8078EE395, 0x59085EE7FF975, 0x4D0881F5DCCD4, 0x5A7770E53EA86, 0x64D64F05F9BB6, 0x5A0F3C663D8A9, 0x315F30D1EDC1A },
+    { 0x0C3CDBC26D2DC, 0x13E6713DE4A48, 0x6AB07DB7AD0B3, 0x3DAE76D312E0D, 0x5154B7F558A44, 0x329486312D30D, 0x267C69B6B8E64, 0x017291449C025 },
+    { 0x1FA923E4DC13A, 0x232F302F78F9D, 0x1081B37D78496, 0x57D97C9EC945C, 0x7775076CE6947, 0x4D72D200A1352, 0x4F14B72B25AD2, 0x734D779FEAF1C },
+    { 0x4839A4A4C3B86, 0x0000001FCBB75, 0x0F4C736DF892F, 0x0000002BDE5B8, 0x4E2D01A8A792A, 0x000000607F3A5, 0x0404F39B6D9C7, 0x000000482F351 },
+    { 0x090A5FDA82F98, 0x0000000000000, 0x1DE2063460743, 0x0000000000000, 0x3DCAAC9FEF6B0, 0x0000000000000, 0x5C34E002D499C, 0x0000000000000 } },
+  { { 0x05928D2CE1AD9, 0x45B70A64976B1, 0x52BBB71935551, 0x1BBB048CDF63C, 0x07CBE609BF491, 0x3D2E4425F320C, 0x6567074458B37, 0x7A9038748C8DE },
+    { 0x206204B4303E2, 0x3C7E458C54A83, 0x46BDF1B77EE9F, 0x55073DA4FB3AD, 0x2069457F3184F, 0x051C4F5AF9AD9, 0x41D507FAC9732, 0x1F1F7F8041E4B },
+    { 0x2BD42A6F40A41, 0x490F9FABA52F4, 0x0781A07833423, 0x7398309EAB69B, 0x5C5D9C3FC1A7C, 0x1290FFAB7FE21, 0x57839A2D6778F, 0x20194ED4F8E4F },
+    { 0x008C225FCF580, 0x0000005CD7211, 0x02EB3F45A42A4, 0x00000041ACB5F, 0x19E68A4766953, 0x0000006767480, 0x2ED675B2FF559, 0x00000046FD1C4 },
+    { 0x1ED730AC3FBB1, 0x0000000000000, 0x424B496315C98, 0x0000000000000, 0x1E65C0EB6F862, 0x0000000000000, 0x448D1FC649EC1, 0x0000000000000 } },
+  { { 0x448A43CF44152, 0x450F0EE5EFE72, 0x2B9221E857BB9, 0x7D95996B8ED67, 0x033699F6219B8, 0x0C3FA0F8354AF, 0x6F776C8563D4D, 0x30159C685DB8C },
+    { 0x565051F201578, 0x2115AFA99E82E, 0x3D1C4482BCAC8, 0x6198E4B6A55C3, 0x05B7BA09A9253, 0x5A77C7455EA24, 0x26CCAAADA4304, 0x78AB1A7FD802C },
+    { 0x40A88B6D860AF, 0x62EF2771FF8E1, 0x35260830E8207, 0x38156D6180331, 0x0513EE49D926F, 0x54514E5B96D81, 0x3DA6A76F938C7, 0x2B2F8ED387C9D },
+    { 0x77095DB7ECC61, 0x000000550B235, 0x5A9649DB08221, 0x0000000EBCF3F, 0x13C2EEF7F42A9, 0x0000001D004E8, 0x15ABC9AF173D0, 0x0000004DA0DCA },
+    { 0x30327FC69825C, 0x0000000000000, 0x186565FEEC033, 0x0000000000000, 0x3511BE6DC1305, 0x0000000000000, 0x26532B0326540, 0x0000000000000 } },
+  { { 0x2AFEFB07444F6, 0x035804AEA625B, 0x52F28570A2A70, 0x17B6EAB1B44A4, 0x54D4025E81584, 0x35CFB00C5DF69, 0x2B8B6E22EB02C, 0x52B11B6B78B14 },
+    { 0x5BA50948B9A35, 0x47E64B775A999, 0x7E934FC49924D, 0x65A4312A5F482, 0x7EEF5ABB9AA16, 0x5BD4DE74677EE, 0x5DF4B3FC4A558, 0x32212E08EE945 },
+    { 0x2AA79D0B8CA9B, 0x0115890677533, 0x1B548BB056FF1, 0x62851D7EC01AD, 0x40EF7C5610976, 0x40A128A02C231, 0x50B7477BD5DE3, 0x42E03E33E68D9 },
+    { 0x7BEBFB9CC1433, 0x000000778DC5C, 0x215DFF3C8F6D6, 0x000000196B58B, 0x71CD948683E3C, 0x0000004D999F9, 0x062BAF08E76C4, 0x0000004987E6F },
+    { 0x7D643F0BD0621, 0x0000000000000, 0x2583BD6F26AA0, 0x0000000000000, 0x4BAE75A6F8DF4, 0x0000000000000, 0x3141EDEC08CB5, 0x0000000000000 } },
+  { { 0x00E1BDFBAA057, 0x6C9C6F3F92762, 0x37D98A246DD14, 0x1817EBEDA0F26, 0x64873E8AB30EF, 0x00D5E0C1E78F4, 0x0D22A21145A16, 0x1DDA48F88E2BD },
+    { 0x7AD19FD2DBF50, 0x00B9D732A96D9, 0x7665F4A42EE70, 0x4075566C11047, 0x6CA78BFB16FD1, 0x36AD29CF0B209, 0x408F45BAFDF86, 0x7FBEC4BD6B947 },
+    { 0x468F64CF5AD00, 0x5CFB329D0ACD7, 0x19080FCC28AB7, 0x3AD64BF0B2F23, 0x50F3CF343E8C7, 0x27A51C732470B, 0x32B94A3549705, 0x261C1D7C6BB2F },
+    { 0x2284CE131B702, 0x00000037E15DB, 0x1742C96146DDF, 0x000000215799F, 0x784BF94099E76, 0x00000074B2B88, 0x42491D87078BC, 0x000000640C743 },
+    { 0x77A16E91A7580, 0x0000000000000, 0x05FB28DFDBC2D, 0x0000000000000, 0x3220C625F43E1, 0x0000000000000, 0x289382DB93E63, 0x0000000000000 } },
+  { { 0x1796C621337EF, 0x57981E7DE90ED, 0x084504917353A, 0x2DAAA0C668A69, 0x70DFA0267E407, 0x1CA2B853FE3F9, 0x62ED3732D2F38, 0x20ECC99B90CB6 },
+    { 0x061CD9AAA6EB8, 0x3E105C70E8DAA, 0x359067DF2A8EE, 0x178FA45147C82, 0x2BB1A41B9D36C, 0x26F4067B24331, 0x6680D5C65434E, 0x0A6259C9912BF },
+    { 0x3EA2149A884DC, 0x20F61D43D7E0E, 0x28DA237CAFC75, 0x5AF46262C7547, 0x0EA6FB3B3687C, 0x5356A388B71F1, 0x17EA6E556A68A, 0x1A2354940304A },
+    { 0x5C29D90153B44, 0x00000072A92D8, 0x1AA88BF92A7BD, 0x00000027AE0C9, 0x43F649D42A4B2, 0x0000005CE02C7, 0x51DCF13C6E24E, 0x0000002B1926E },
+    { 0x3E02DB83466D7, 0x0000000000000, 0x541A5CF22B3CC, 0x0000000000000, 0x5EDFF75BFD493, 0x0000000000000, 0x080881331CC58, 0x0000000000000 } },
+  { { 0x565C741770BC2, 0x4B6E4553C6CC1, 0x7B8B409BFB738, 0x187B21123AAC4, 0x1B03FB56F211C, 0x438D57FE01656, 0x14E6E818235B6, 0x7BD7DC332043E },
+    { 0x2D7F18772C5BA, 0x29D107A5B01F5, 0x56DFB93CDAF9A, 0x2C8E25789EDA5, 0x0552720B31F0F, 0x0C85AB0B8C50E, 0x6F2B4E9C9EF4F, 0x27A9B26141A98 },
+    { 0x5E55036B54D70, 0x7870D9F5DF237, 0x4DA84C1B6664F, 0x4641D09B25CC2, 0x0280F2F425749, 0x5632272D6D344, 0x7BC4880C860AD, 0x06AA48342DD1A },
+    { 0x01447427C97BD, 0x00000041BC223, 0x358218D050A5D, 0x0000001C54590, 0x7B42A615BA9E5, 0x0000001017B3E, 0x3954A8DA104B8, 0x0000004A74A10 },
+    { 0x4F155800D1BAF, 0x0000000000000, 0x13520B18DDB16, 0x0000000000000, 0x67B2432D570E5, 0x0000000000000, 0x0983B6A3CBE3B, 0x0000000000000 } },
+  { { 0x679DBBC61E215, 0x0D28D88ACF566, 0x707C5B6786058, 0x52FD4537D47DC, 0x2A6198A2A3F95, 0x1B47ADDA46EDB, 0x5AD60781AB40C, 0x537E9803112C7 },
+    { 0x01D1FCEC88370, 0x75ADF7619928E, 0x20A8E956B11F0, 0x5E9F061FCB76B, 0x67DBE91F72399, 0x4117A2C2A635C, 0x691D669EA5E9F, 0x156D694EF5B19 },
+    { 0x5BFD637DDE5F8, 0x145402FD59F23, 0x3AF70EBCB16A7, 0x145B797980260, 0x6C8C3B83A6477, 0x030CDB3504E34, 0x4C9FB2D953DFD, 0x4958311D59ED1 },
+    { 0x5A0E5FEE9521E, 0x0000006380583, 0x26F55CF534B47, 0x0000002804140, 0x042B47199D3C3, 0x0000006A935B6, 0x17BEB459C46CC, 0x000000349F87A },
+    { 0x4939CD0F3281E, 0x0000000000000, 0x5FA2EC4B0D0A4, 0x0000000000000, 0x6B80B2790AF5A, 0x0000000000000, 0x7C60BAC2678A9, 0x0000000000000 } },
+  { { 0x0C7796AF9682A, 0x50660BE7D57D9, 0x44057DD56F9DF, 0x4189FC1436EBB, 0x1B48A314ABD2C, 0x0F4412A90237A, 0x0265431D7FAA5, 0x21D065E435786 },
+    { 0x2CD3D01E0B653, 0x5CDFB2A9805E7, 0x65CC26561BB07, 0x1055229CF4136, 0x7957BF7F660D6, 0x0956950532AF1, 0x5558A1ACB4568, 0x56CA5DD6C62AF },
+    { 0x678336FC4E3E2, 0x54FB52411C66A, 0x55D7F34FECB63, 0x767866EFE2855, 0x05E7D27D8E771, 0x663B46F6901D2, 0x5900BF7C41F2A, 0x01201E20A3C26 },
+    { 0x627FF68F9075F, 0x00000033A1311, 0x49199A43CA200, 0x00000031BFEFA, 0x2E48409843B67, 0x0000005830AD6, 0x4977090F03334, 0x000000579AEBD },
+    { 0x77B6768BEE368, 0x0000000000000, 0x0B3603DED0DD5, 0x0000000000000, 0x5F3B9BD33A7B2, 0x0000000000000, 0x2A9906DA2816C, 0x0000000000000 } },
+  { { 0x1FAB327C6C83D, 0x4535B6F693041, 0x4D40B93D8669D, 0x5D2E186457FE4, 0x3977043786D19, 0x05596F4B2DB99, 0x34B126ACFEA1F, 0x1AE812966890B },
+    { 0x078456AC3EC33, 0x04567BD491770, 0x7875A9F7EACD2, 0x62FC7412C4514, 0x5DD149BF79C18, 0x520880D1A204E, 0x67E8E8763CE49, 0x454648B418A5F },
+    { 0x5FB7F90568D0D, 0x63276FF208CC1, 0x6840BB56B355A, 0x35B122CB79A48, 0x7C7C1F98665EC, 0x42CB72A0C48F8, 0x44FE9E9987530, 0x2B73B61538F2A },
+    { 0x4AE1959A07774, 0x00000029A51D4, 0x47AB5E20F5143, 0x000000255BBE7, 0x7626CCEA28A6D, 0x00000067BA8B1, 0x1310033FD3B80, 0x0000005897643 },
+    { 0x4DF6595448D28, 0x0000000000000, 0x788A207944E14, 0x0000000000000, 0x1B22130384145, 0x0000000000000, 0x0657153104AC2, 0x0000000000000 } },
+  { { 0x6B59EA0C9492A, 0x640CD9F1E22C1, 0x2C475A4B945C3, 0x27FADE7A7A854, 0x0DCAAC7351CC8, 0x01F777DCD354D, 0x5E3DC162C21CD, 0x721A637731866 },
+    { 0x0E4D28CA9C54C, 0x57947F8ED4D0F, 0x721E32951F05A, 0x103D851D3D9E3, 0x67E46040D04AC, 0x4AB8AD19C3EE8, 0x01559827EE900, 0x18EA512674B5A },
+    { 0x08216755480AD, 0x09BD02F460968, 0x111CBC7DC87C4, 0x21B66AEE88498, 0x3AC85FE4DA8FF, 0x71D2F709BF74E, 0x11D981E79F4B2, 0x3862FB0B6E60E },
+    { 0x721102EBD0285, 0x0000003277919, 0x09C90B896DE07, 0x00000013DECB3, 0x029EA16120B9D, 0x0000005088426, 0x235FDBF81A4B5, 0x0000003981550 },
+    { 0x7D5285F7295E7, 0x0000000000000, 0x34C30CB77549B, 0x0000000000000, 0x4887E8A8D9721, 0x0000000000000, 0x305E74C11B567, 0x0000000000000 } },
+  { { 0x003CBB7B65526, 0x1D3A1BB0BC403, 0x3CB9CAD0E4328, 0x0253E277DA419, 0x2239D579464D6, 0x4DE76641D43FA, 0x5C6D96BFCB380, 0x2AB927A3CFAD9 },
+    { 0x5D2407F2DDB89, 0x5139C4664D832, 0x5ADF8A6A14819, 0x7E786C1344CE9, 0x34755BCC648E1, 0x10146BD9B9124, 0x6241B7FD849EA, 0x07E6C22DA0E22 },
+    { 0x3D48CFBE03ED0, 0x61A875CC47C18, 0x5A9BC5BB88158, 0x4FC2DE793DA51, 0x5DEBF25303A0A, 0x383DD4BB1D8F6, 0x588DEE2801D13, 0x07A498B946069 },
+    { 0x3B5C4A97B442D, 0x0000000DAAFDE, 0x30594CDEDC85A, 0x0000002AC3BB8, 0x4435D1F880EDF, 0x0000004834571, 0x2745308742E3F, 0x0000003B325E1 },
+    { 0x460687F4B3326, 0x0000000000000, 0x0771910A6E2F4, 0x0000000000000, 0x53D4C88645784, 0x0000000000000, 0x2396006D26441, 0x0000000000000 } },
+  { { 0x293C17EB0807D, 0x7400A78E866A2, 0x792C71453A335, 0x7BFD9E30FBEF4, 0x363C229044711, 0x7CBFB9FD6DA14, 0x4B73A56DC59A7, 0x09AEE0493524F },
+    { 0x00CC05AB5B1D2, 0x24E9F24370F91, 0x79C4EA809F83E, 0x449FCA2997D10, 0x0B4921956E510, 0x4A2104AB76524, 0x56BB7F161F9A1, 0x29AE15E52C8D7 },
+    { 0x5916AE8BC6F75, 0x0839D5711264D, 0x504AE9F3F7052, 0x4219138D11B95, 0x0EEEA434D03FA, 0x0ACE747A46EEC, 0x04E43061364E2, 0x785EFAED9B94C },
+    { 0x7421A6ACC79A8, 0x0000004808146, 0x78F72FFDAFF69, 0x0000001EDA500, 0x4C89DE068A108, 0x00000076EE6CA, 0x3E49A460CDFCE, 0x00000043AD012 },
+    { 0x6D1C06776501C, 0x0000000000000, 0x06A5D2BE3DCB9, 0x0000000000000, 0x20358AAAA774C, 0x0000000000000, 0x67377FE247AF5, 0x0000000000000 } },
+  { { 0x34D6D75934573, 0x3FDF6BA15464E, 0x078A09AA6B586, 0x5047624FFDEC7, 0x5C95673D36C4D, 0x285372636BA94, 0x215086DC829B4, 0x6BCDDBA1D986A },
+    { 0x12BBBA5E4BF29, 0x5AF8B7B5B465C, 0x1EE7E90485D0C, 0x4C170DAC8D284, 0x54F3ADCC971C4, 0x1E7F0D25ECFE8, 0x4631E0358DE98, 0x0A0378500105B },
+    { 0x2A5008EF4BED3, 0x2417A168ECF68, 0x75F1A5A1CACA1, 0x4875C576068E6, 0x3146F8C2BB852, 0x3C2BCF0327E6D, 0x49DD7DDE59E52, 0x3B8A76E98BBC7 },
+    { 0x7CC9B0B1C8BD4, 0x000000337B14C, 0x5553EF799C72E, 0x00000026D8AC2, 0x3758D48880DE3, 0x0000004AB3170, 0x2CB407B7FC784, 0x00000038D60D2 },
+    { 0x32C382377B2D1, 0x0000000000000, 0x14E4674BF1173, 0x0000000000000, 0x6B4B9B26E4D3E, 0x0000000000000, 0x75FB0848EBCB7, 0x0000000000000 } },
+  { { 0x6E27E308BF9D8, 0x47B22BD713174, 0x691AB79E297DB, 0x67F86DDC48A2E, 0x6A907DC38EC60, 0x09DEBAF4595D3, 0x64E939A2AA647, 0x26A9B91726708 },
+    { 0x4E86756BB71B0, 0x2D5D50CFA0F31, 0x1310038FD5CA0, 0x1548797749642, 0x4A71BFFAAFDFC, 0x26B4630CB89A5, 0x2AE3889E4803E, 0x0FEAE91091AC8 },
+    { 0x7F7B75E99A755, 0x75E548FF56FE0, 0x55AAEB3AFCA15, 0x5C76AE1789680, 0x25860FAEA68F4, 0x7D8F4E3B93CEC, 0x5CCB06A086E8E, 0x6E8DA16AE63ED },
+    { 0x0E42B77FC074F, 0x0000006304F2A, 0x1467A16B792BF, 0x000000308D0F7, 0x31686E9DB93F1, 0x00000051AAA8E, 0x3BEA4CBB582BD, 0x0000003BD30AF },
+    { 0x51736697145D7, 0x0000000000000, 0x34AEC957F7E84, 0x0000000000000, 0x61D64BDC1E88E, 0x0000000000000, 0x1D40E2748732B, 0x0000000000000 } },
+  { { 0x0CBA08FAD9102, 0x3776F001D3052, 0x5ECA6743522AE, 0x7FB4FE868670E, 0x37861159C4124, 0x4C5DE80E5A5FC, 0x5A14211BE7AA6, 0x7413FEAAF4696 },
+    { 0x11EC74DDCA6B5, 0x2D5813076D0C0, 0x4B06D6EC6F812, 0x62463472CAF02, 0x7BEF8A287D0A6, 0x1344993865611, 0x0B64A25608945, 0x23437425093A5 },
+    { 0x69E62224CA9EA, 0x72E435C48304E, 0x4EADAA24EA68E, 0x517566A2CF10B, 0x5F3F61BD79931, 0x018E8411951A2, 0x5D147E50E3353, 0x5C6D1D26B2745 },
+    { 0x7D2A4AC9A5592, 0x00000041E8600, 0x2CE15A476C9BD, 0x0000002366EE1, 0x10E76E2E1F23C, 0x0000008608FD2, 0x686B5BE248417, 0x000000281B757 },
+    { 0x1A2C632E0EC6C, 0x0000000000000, 0x1AC241A36C6A0, 0x0000000000000, 0x6C1FFE53AC663, 0x0000000000000, 0x70287A87E3356, 0x0000000000000 } },
+  { { 0x31E369D0F16AA, 0x5D4F12227DC41, 0x6AEC90153487C, 0x44BB87CF818BC, 0x08B85F20EC3D2, 0x6593FF41E94AC, 0x1D82E397C9FE8, 0x33E9E78D671B4 },
+    { 0x666A012A97173, 0x70321683D7FF3, 0x08DEAE4D36D08, 0x61B4041B39EEF, 0x49665DBA084B7, 0x086AEC213586B, 0x5939B2DE7385E, 0x2342F68334308 },
+    { 0x4D1F1FC0F848D, 0x08DDF598B403B, 0x1239A77ED62CA, 0x76A06B941FEE2, 0x485B76561AAAA, 0x5F5BB0E54E817, 0x392666195A22E, 0x1F8AF4EB333B5 },
+    { 0x373C165D6EEF9, 0x000000592CEDB, 0x7419161166490, 0x00000008962D4, 0x597414B8EAB98, 0x0000001AB3BCC, 0x5E143C9D95CAB, 0x000000457FE4F },
+    { 0x00B0008F67ABB, 0x0000000000000, 0x797AF5A55338B, 0x0000000000000, 0x579D42CD5AE05, 0x0000000000000, 0x08A2128619E82, 0x0000000000000 } },
+  { { 0x03DFF9179E6C3, 0x209F6572EE5BA, 0x3115CEC9545C6, 0x106E2345EE00D, 0x061EB995E179F, 0x519C91D9445EF, 0x0E1A04696927C, 0x33C09BB341185 },
+    { 0x5DC8BFF272A37, 0x356E4732CB269, 0x19AFF47127112, 0x2FAED0BE876DE, 0x781B3840E96D4, 0x71C0B816745CA, 0x140C82E25FFBB, 0x2B40E95B37C55 },
+    { 0x5B25CF7D8EB3B, 0x0FE35904B006B, 0x2B83F6F597517, 0x4B004D74E64CF, 0x7EB6069BCEA20, 0x4C752D3A16BC6, 0x0A92D0AA495A7, 0x495B74A0103C3 },
+    { 0x71F818944607B, 0x0000007AC70DB, 0x3596D3B78153F, 0x0000002E80B8E, 0x4C9D6BD3F1123, 0x00000055604B1, 0x163A1B7C6D022, 0x00000047819E1 },
+    { 0x50154CD88F69D, 0x0000000000000, 0x6F736224CB4BE, 0x0000000000000, 0x603F569910D6C, 0x0000000000000, 0x1CCDE04F95200, 0x0000000000000 } },
+  { { 0x14AE620C3E5A5, 0x72B8E642C5C1B, 0x7291779C20EC3, 0x37F584F283478, 0x603BA41162B65, 0x7662FD2C8F42C, 0x4B9610ACD3335, 0x4DA0589CD5E5D },
+    { 0x67FBD2D5E3D8A, 0x30F02996A4388, 0x1D6F54AA55143, 0x0C51366FCBE76, 0x2FCB6905278C3, 0x1861BEAE0F916, 0x1D74316D15A6E, 0x43A57F53B45BC },
+    { 0x6129C18E0621E, 0x0B60429DEC62A, 0x39FFD2D12E546, 0x1D8403B78A24A, 0x72B10ED84DEA4, 0x5B30099ACCE12, 0x3C6C1889254C9, 0x62E12534577AE },
+    { 0x271C4376614FA, 0x000000399E55E, 0x7935A7CAB7268, 0x0000001CE74B8, 0x0F4AE4368ED87, 0x0000007C31B5A, 0x35EB7A2D2CB34, 0x0000003D8CEC6 },
+    { 0x1C31438144348, 0x0000000000000, 0x5AC24FFAC65A2, 0x0000000000000, 0x26B7CF2177122, 0x0000000000000, 0x1E6B81389AEFD, 0x0000000000000 } },
+  { { 0x6087AB44EC796, 0x07973DF720B13, 0x70E0CD2BD7FED, 0x10CED574B9A29, 0x2BBCDB1479184, 0x0222E0A6339C2, 0x4906F72FABFFD, 0x777C23A45324D },
+    { 0x0CE6A47F3667E, 0x022223A11C4B5, 0x6EB164890010D, 0x128A7EEBA107F, 0x1162FB62928C1, 0x2E2E757463D47, 0x556D3B7771532, 0x28F3D0AAA203E },
+    { 0x4EA02F3DFBD63, 0x5B9E3A0D2FC1C, 0x10C5DFC13FE1B, 0x2AE61530E61B4, 0x4F532288FD6AD, 0x5ABF39A0D588C, 0x416F9CC9502FA, 0x313E6F7F61108 },
+    { 0x095756A114AED, 0x0000007BDFAC8, 0x5807F72C22CB1, 0x00000031B191B, 0x42ADD2D6274BA, 0x0000004AB8D83, 0x43E5435CD538F, 0x000000329E647 },
+    { 0x53F5B2B69063E, 0x0000000000000, 0x35CA71BD40C61, 0x0000000000000, 0x06B9BFE79C6A0, 0x0000000000000, 0x429F3CCFB75F3, 0x0000000000000 } },
+  { { 0x2DE829D2CFA4D, 0x5AE27FB08EE18, 0x0BA3E896458D2, 0x7DF656189FECF, 0x6A2939CC789A1, 0x6DCBE83CD6E4A, 0x718972DE1B084, 0x04EECFD1C1194 },
+    { 0x4B5507BD5777B, 0x06DBE145EF259, 0x5EDB28DABFC43, 0x1C7E592A1B655, 0x3ACBE756D1194, 0x62DFA3339E449, 0x492E0A1472290, 0x14D218ADEB234 },
+    { 0x2B52E2E2E7431, 0x7EB7166077F88, 0x4FB1BECA289A0, 0x0B2E0D22B127B, 0x2C8AFA4D1FF11, 0x774A49A500EBA, 0x430F936DBC2C5, 0x57F15DBA7C37C },
+    { 0x64EBE8C6F14F7, 0x00000014466BE, 0x19C8CD57F5F83, 0x00000038D1CD2, 0x796F28F011C94, 0x0000004A47FE8, 0x3615EACBD90DE, 0x00000045F8DCD },
+    { 0x4CE2791104B76, 0x0000000000000, 0x594AA9B6CC41D, 0x0000000000000, 0x2C47C746335AD, 0x0000000000000, 0x0510A0E82E105, 0x0000000000000 } },
+  { { 0x560D50B6B5152, 0x21D05756D542A, 0x7E30316010BD7, 0x67BAFE15AD0D2, 0x09524AE0EA2E2, 0x14280CDCFDF1F, 0x032AA563C4315, 0x6EE4E9861422C },
+    { 0x3B8881B624BE9, 0x0797A872920AB, 0x756940D0BE9B4, 0x5FEB826F77BF0, 0x25C935EAF7FB1, 0x516ABBD218002, 0x50668F6DAACE2, 0x5012C0214DA6C },
+    { 0x75C769A24D6B5, 0x7E22C1EB82FAA, 0x672B80517AE2B, 0x03647213C0F3D, 0x27B248433685A, 0x548888380FE69, 0x51398720255C5, 0x7AD67900FF000 },
+    { 0x27E75898803CF, 0x00000011FC411, 0x3B058E54BF7FF, 0x000000226BEC7, 0x24E214F29E36E, 0x0000003D11C10, 0x1DA3EFDAC90A0, 0x000000576DC47 },
+    { 0x08C32C2B4812C, 0x0000000000000, 0x7148D19CB2840, 0x0000000000000, 0x5CD447615D556, 0x0000000000000, 0x7D53C4187F4CE, 0x0000000000000 } },
+  { { 0x3A2945F7FF8FD, 0x4F5474AC1A59A, 0x5A910D212E5A1, 0x55D1805D35326, 0x422162CD7E65F, 0x612E659BACF0D, 0x056924DADDD05, 0x6FA41D66D4045 },
+    { 0x76D47C5EC0D2D, 0x1E96A6E63C4BA, 0x7780BD902B3AB, 0x0CA5F741E94E8, 0x1B5D1583F3FCA, 0x27CA5EB484A36, 0x0C3338A9725D9, 0x3B18165A8CBF1 },
+    { 0x3E36890345091, 0x61FEDFE64B658, 0x04406E1AA27DF, 0x0D83528F3CDEE, 0x5A1034CF60F0F, 0x0F81B47D832F0, 0x1312E649AD148, 0x528118655A1C3 },
+    { 0x0707B005EBF98, 0x00000054F5047, 0x562F0451956FC, 0x000000294E505, 0x18E61E132D59B, 0x0000003902C0E, 0x4C9455E697F25, 0x0000003CBEF5B },
+    { 0x0CE56BA0ADF10, 0x0000000000000, 0x762FBFCFF98DB, 0x0000000000000, 0x280FA6AF31CE6, 0x0000000000000, 0x3F8F0CD390956, 0x0000000000000 } },
+  { { 0x3CB1D13BE7BBD, 0x6C8CDD9033EB5, 0x07F92ECCAC850, 0x359C1B11045DC, 0x3CF08C5402C93, 0x518C298BA6B19, 0x7FEA73CAE3DBA, 0x150AD824ABDB8 },
+    { 0x54E4DF618E091, 0x2C94B130A4F15, 0x001246A2C3F7A, 0x765528CA8740F, 0x5AAC3072A8113, 0x7AF4948D2170D, 0x1CF93A2C6DEC1, 0x375DE3F941B27 },
+    { 0x4192E83F90289, 0x61F110F7592DA, 0x204D6BC9C652E, 0x3D892FA89CAC1, 0x546511802E601, 0x769044BECF721, 0x3A720CC1DC64C, 0x29D678DC67823 },
+    { 0x0579B6096223C, 0x000000418A1B0, 0x4EB8A7CE469EC, 0x0000002DD1CF1, 0x6CCEC91E484B2, 0x0000007528B52, 0x4BFD872AAA2A3, 0x000000382591C },
+    { 0x0CCCA45F86BF2, 0x0000000000000, 0x301A2293DA13A, 0x0000000000000, 0x4E186231FFC0F, 0x0000000000000, 0x6AC25342525B2, 0x0000000000000 } },
+  { { 0x6FD46570095F3, 0x314A7ACBB18DB, 0x3D9FC9051CB77, 0x3172C82561565, 0x4B4554388F8A7, 0x3487CF5BBA905, 0x5334298DB5E5B, 0x50BB30DBE98E3 },
+    { 0x3E92168006FB5, 0x2B800A66FF4A2, 0x799E245ECD670, 0x2663BD3A63054, 0x386726BA35FBB, 0x0336695E7FD4F, 0x1235C120716AE, 0x003D8E641A9A6 },
+    { 0x3E9AE73F8431C, 0x7E30A9AC1717D, 0x61FDB1B401CF4, 0x2BF1F873FCD84, 0x14E8BAD751E0F, 0x08F189EE6ED4B, 0x3212436FDB1A6, 0x5352C9A186A55 },
+    { 0x6ABE886853270, 0x00000067E0341, 0x705F5CCCABC77, 0x0000001AC330B, 0x292FB099D637E, 0x00000048E1BC2, 0x0C44D60CE752E, 0x0000005BC3C7A },
+    { 0x297AE99561F22, 0x0000000000000, 0x7F7051D11538D, 0x0000000000000, 0x1ABF0F48873F0, 0x0000000000000, 0x1543E7AB36687, 0x0000000000000 } },
+  { { 0x6CDB68DDFD8E4, 0x3F8FBEE114E09, 0x4C998303178FF, 0x6AECBC22AE051, 0x2B0B4EB7D1134, 0x0532E67377E14, 0x0B991730C6B4F, 0x72D77F9FCD17F },
+    { 0x117C114B15606, 0x4F01920914792, 0x7AC05D9937F50, 0x5C510F69F926E, 0x36E08154B23DB, 0x22FC9B4867B25, 0x265C49A76E708, 0x3C45F0B9F93AE },
+    { 0x1E6B8CDF80D7A, 0x00DA36AF3AE28, 0x1A81894EAAFB1, 0x28160A909A04F, 0x735C202947A09, 0x5F944086E6627, 0x347A97940A677, 0x71DBD9CB98900 },
+    { 0x2C8FB03BF3FE2, 0x0000008CB484C, 0x2FB1158F18FC9, 0x0000001F97A34, 0x523AE31665C4C, 0x00000046704A3, 0x1B8DF06A38CF9, 0x0000004E732C2 },
+    { 0x5CEAAB78B313B, 0x0000000000000, 0x0F70C11954102, 0x0000000000000, 0x699E7F2D22351, 0x0000000000000, 0x5CA25589AAFE3, 0x0000000000000 } },
+  { { 0x79302B4862288, 0x76B9F352095CD, 0x09F9A6F95D1DB, 0x7669E0E991CEB, 0x2159EAF9573A8, 0x3599CF63D34B4, 0x7E0CBB7C52867, 0x2D535541ABFBB },
+    { 0x1DDACCCFE262F, 0x2D0D840B1537C, 0x11218BC15DC49, 0x63041D6008855, 0x769CB055F7A7F, 0x222676860AB1D, 0x190C8EFD4B672, 0x4CB438C6F1505 },
+    { 0x5314AC2C65BA6, 0x743ED46222F76, 0x39756D7E8E6FE, 0x2AC7DB8EBB77B, 0x7BF495EC555CB, 0x5CF191AFA6D33, 0x72B65ADA08660, 0x649D5D0BF9FCE },
+    { 0x53D57EDDFE12D, 0x00000038A28FB, 0x05DF54D1874A1, 0x00000025732F1, 0x409F04D99CC63, 0x0000006127F5A, 0x761EF03F28A2F, 0x0000004495776 },
+    { 0x15B3546CF935A, 0x0000000000000, 0x31B9FCAAC4DFE, 0x0000000000000, 0x1E29A8B82BDB2, 0x0000000000000, 0x65FF617E9A72C, 0x0000000000000 } },
+  { { 0x7B7BD8AC27E58, 0x39075B80FBB49, 0x1F47923151685, 0x79A4989277AFB, 0x755E41517A0BE, 0x148CDD3ECF75E, 0x4399F5F70FC83, 0x5EB5568B2B9ED },
+    { 0x1A29A984702E4, 0x74AC395D30AD4, 0x00064754E9909, 0x40730D6A6D679, 0x3757CF5DA31F5, 0x13B8253F8DA86, 0x54E3C93D296FE, 0x7165B6B3E124B },
+    { 0x60B5C449FA5B1, 0x7E2B07E2A8FAC, 0x1AA78CD529F24, 0x0F67DC240C7A7, 0x0A4056BEEDB2B, 0x3B879CDD7FF30, 0x18EC8A1F45BB7, 0x72F390B5CB4F5 },
+    { 0x781BDF7F0B702, 0x0000005AB2475, 0x4A0B6C6AC0341, 0x000000396B711, 0x485A24DD138DE, 0x0000006E557A9, 0x7403CED9D0C99, 0x000000437A9A0 },
+    { 0x43CCA7B13A61C, 0x0000000000000, 0x387D7B5F18586, 0x0000000000000, 0x0DC9613E045E7, 0x0000000000000, 0x1952FB7DBA30C, 0x0000000000000 } },
+  { { 0x2DD75D0C1CBB5, 0x7FAD98151A070, 0x51DF3D935C040, 0x7637823B503F4, 0x44333F9DBEA07, 0x02B1C87E35188, 0x3F2EF7CAA5794, 0x1F38C43DD96F7 },
+    { 0x2B25B6329FC49, 0x76135EACCF14D, 0x54BDD82CBABC4, 0x23F95240EF119, 0x7B5CA6E806784, 0x2577DAADB384C, 0x6C735E802534B, 0x723601B979011 },
+    { 0x03AE5AFF7C851, 0x5D731E16CBC24, 0x3CD336D93C2D6, 0x7CA58A5C8C3C2, 0x571219A261518, 0x103875661EB6D, 0x2511FDE402E5D, 0x50EC654D4C860 },
+    { 0x690C20B05C7A4, 0x0000007B33176, 0x777AEDB723A2B, 0x00000033CA190, 0x5B8A55DC6CE32, 0x00000041F23B8, 0x4B2ACBF5DC52D, 0x00000053E77AE },
+    { 0x6DFBA0B8AA697, 0x0000000000000, 0x70539B9521720, 0x0000000000000, 0x3F5CBDE1A41D8, 0x0000000000000, 0x413985C7A5C24, 0x0000000000000 } },
+  { { 0x353B0417CB72F, 0x57F046729B5FD, 0x71859AC548A9E, 0x1E35EA25E276B, 0x7EBF9AE314CEF, 0x4B43BCF445040, 0x2B14F9FD9F38E, 0x3E851A86ACDA7 },
+    { 0x5819363A02968, 0x4826BEFFFFE43, 0x50B34415DB235, 0x150E93170FE83, 0x48A79A9738D69, 0x1394113A4EE61, 0x061D0004398D0, 0x5865499A2559C },
+    { 0x149A8C8D460F2, 0x639D3790B573B, 0x3B3F5B68F3370, 0x1EA9BCFA0D04B, 0x79BA06FEBEDCA, 0x5AA413069E1FD, 0x23619413D9785, 0x662B046FC5279 },
+    { 0x631E4EF9B9650, 0x000000105508C, 0x7233BB0DE057C, 0x0000002E1424E, 0x442C05C04DA7D, 0x00000037A6662, 0x79890C77937BA, 0x00000052DFEC9 },
+    { 0x4CA7F2076EEC0, 0x0000000000000, 0x4EA0BCF604F5D, 0x0000000000000, 0x4F390E7F71A1A, 0x0000000000000, 0x0708658D94980, 0x0000000000000 } },
+  { { 0x184C695B884E2, 0x3F7C3CFA7E3BB, 0x056409DD63DEA, 0x469A1F884E9FB, 0x6CC51E3D3CE0A, 0x795C2266B3BF2, 0x51B31568AB952, 0x1EA9E39415E6B },
+    { 0x68B79167B33AB, 0x3CA7BE9809864, 0x34E48BD2A306C, 0x33C2222960501, 0x6F9A21474B520, 0x142F8CDAF74F0, 0x26BD92DD0805E, 0x446E709A2B8F0 },
+    { 0x16E5FB300B8D1, 0x0830E626FA796, 0x6F5D378232277, 0x42E5C38E87338, 0x46038464FE884, 0x3F027DF6DD921, 0x6CED89BF9B9A5, 0x37129B2E3DBC5 },
+    { 0x40D5481A5D1A2, 0x00000019330B1, 0x31367794C8092, 0x0000002937378, 0x0A5F4B9EA26EC, 0x0000003E29CBF, 0x42E22FAD763F5, 0x00000046BDE2E },
+    { 0x7A2D0881982AD, 0x0000000000000, 0x482A1C59FE120, 0x0000000000000, 0x58A9C7EBD81D1, 0x0000000000000, 0x4A5E193B17E35, 0x0000000000000 } },
+  { { 0x7D11448525CE5, 0x4D277664ECBB5, 0x0F58C149C38C9, 0x6839DAD3EEF9E, 0x7A60062250887, 0x5D99F5EEC6525, 0x7C659A3EAA8A5, 0x47B2C430F73C4 },
+    { 0x2B3389FABDB43, 0x28D8721EF2987, 0x5ACBE06BCC4AD, 0x05F4CCBE2248D, 0x2C9122790EBF5, 0x0D27A09AC3874, 0x58471AE87D4F8, 0x777AEFD40C72D },
+    { 0x5CFB69BDC5F8D, 0x730842718A8FB, 0x622DEA2CB9589, 0x2D383BEC2BD71, 0x2F8439EE984C7, 0x5A599A99EC03F, 0x4D92D098A9818, 0x4A6AABFE2A0E2 },
+    { 0x311D96EB29D5A, 0x0000002D95D0D, 0x427DB07B913A7, 0x0000002746954, 0x639032E1E6C28, 0x0000003DA21CD, 0x6E24ED6FBC1B8, 0x00000064A3E1F },
+    { 0x69CA080DEE545, 0x0000000000000, 0x57E6D3855F6A6, 0x0000000000000, 0x2E857F90DB42F, 0x0000000000000, 0x059284119E8FA, 0x0000000000000 } },
+  { { 0x31CD63DA49D86, 0x54AAED2C9CE5F, 0x158C38A7CC2D2, 0x069BDED27FF8C, 0x5B0229AF78B84, 0x5E802CEFCA7FE, 0x78B2F696157CA, 0x489B999DE35C7 },
+    { 0x37F18784CE08A, 0x4C503D5303CBD, 0x0141F77A35288, 0x6A8799B59EA56, 0x52CD79FDB24B1, 0x76458578F4DEE, 0x7749A185F3D81, 0x032DA5C2C8D9A },
+    { 0x014B9520ACBA2, 0x15381D91A5C69, 0x5DB66090913DE, 0x212E94453450C, 0x1243AAB3F44A2, 0x1B7DDADABC7E2, 0x2BA47B312A8CF, 0x1677C4667ACAF },
+    { 0x4E5D96CD61435, 0x00000064CD1D9, 0x6C4A6E738BBFF, 0x0000000D154BF, 0x4C78ECBBFADBC, 0x000000295CCF1, 0x42665A42C0777, 0x0000004C5C3D9 },
+    { 0x48639A8775CDE, 0x0000000000000, 0x0D7CC8394FF15, 0x0000000000000, 0x11D417CE8824D, 0x0000000000000, 0x564225A898EFD, 0x0000000000000 } },
+  { { 0x42AABD44EC529, 0x0FBA499A4BBD6, 0x2AAD9E2471091, 0x2BA6C9C389578, 0x73DBB51671C51, 0x0DE5FDED4A947, 0x3C40A9C9B3471, 0x2196B7EE7F83D },
+    { 0x1BBF1C90EB926, 0x298E806563D7E, 0x17D3CC04C2500, 0x2629BE4D97349, 0x61B0D59B235D3, 0x3811F3762588A, 0x47312A186FC38, 0x5C28D10A38074 },
+    { 0x3EF3AD3D2C463, 0x15ACAB2988DEC, 0x15FD1770644B1, 0x4F897AFEBD584, 0x68D4D7982EA69, 0x0F96AF44A64E8, 0x4C3F1CFEFF33D, 0x665518308F35E },
+    { 0x4630C0CBBBAC2, 0x000000673311E, 0x451B39C1B96DA, 0x0000003B00C8B, 0x48E1F944A78AD, 0x0000002DD7C0D, 0x63C4495787A43, 0x00000046AF642 },
+    { 0x1BCCDCCCEDC4B, 0x0000000000000, 0x6C6ABF18E3C43, 0x0000000000000, 0x1AD3D90049D5A, 0x0000000000000, 0x3586A8BD9C664, 0x0000000000000 } },
+  { { 0x0ABB3ED6C95A2, 0x51C2D368BF20C, 0x22997B66B0062, 0x17EA4A49FBB6D, 0x1BC775672DBDE, 0x12FBF78E2DC7F, 0x7BAF5C26DD9FE, 0x3AC54A7DE0F55 },
+    { 0x770651B5C4D4F, 0x726CBC38545C4, 0x0F7A87A00F328, 0x4ECA456EBBCF6, 0x4068E63D6BAF7, 0x7B4F3829EDEEA, 0x79B6C9C47D98E, 0x178E4A769AE26 },
+    { 0x56B35F33A935C, 0x45CCEE68F036F, 0x770DBBEF7D09E, 0x1748675F12738, 0x7D067D54545EA, 0x0C99172156A2C, 0x17B5E8EED9420, 0x17BE179B9BD4C },
+    { 0x1B428052A34AE, 0x00000057CF157, 0x3B29095FE36D3, 0x0000002546D02, 0x1B52EC7BDD682, 0x0000004684E7C, 0x6C54465F52DD5, 0x0000004D7E27D },
+    { 0x30F20958E3586, 0x0000000000000, 0x1FDA3C405BD41, 0x0000000000000, 0x6369B34D840FB, 0x0000000000000, 0x12AE5360701F4, 0x0000000000000 } },
+  { { 0x2E7EA881710AF, 0x0B0F338DAA2AD, 0x1F720FC7F349E, 0x1C28693CC54B9, 0x409FC2FE80AD7, 0x561BC122C4289, 0x12BF7DBCDC5C0, 0x0DF125F0FCDA4 },
+    { 0x78514A15B731D, 0x287208D1063DA, 0x5A483899E0498, 0x4AA60F951782F, 0x5DFDE36AA190F, 0x727EFC8686F6D, 0x2F686783C8CEE, 0x24ABF977AA7A7 },
+    { 0x6BB3476D75249, 0x215986073F838, 0x30D82A37329DB, 0x11080E69FEACF, 0x08D8E227AE468, 0x63B6DEE616919, 0x15BC0BE342546, 0x2A6B88FA7692E },
+    { 0x574FD3C6B7B93, 0x0000002D5B4C2, 0x79480A6C7C398, 0x0000001FCE604, 0x5C1FE6C24D2CF, 0x0000002B3B187, 0x179A52400F3C9, 0x00000063E1887 },
+    { 0x33B2DF3FADF22, 0x0000000000000, 0x6F0C452713FC5, 0x0000000000000, 0x7679C47CB2E73, 0x0000000000000, 0x70534A41A6E12, 0x0000000000000 } },
+  { { 0x7DECE871884FC, 0x3A1CCC270D6DC, 0x43291454C3482, 0x43D6F7D287CE1, 0x57ED0EF514CB6, 0x2249961CB2C94, 0x7388FACBC8782, 0x026022577C42A },
+    { 0x0ECD5B36EEBF4, 0x266DAA77E74A3, 0x4767E95155A98, 0x545B98C78A8CD, 0x2BC8F5A72A898, 0x018DCDD98DB24, 0x1DF9CBFC443CD, 0x73055AA57C642 },
+    { 0x1EEDA6C84EDA4, 0x37799DA1BE2B9, 0x6C19543C951CB, 0x17E9664844C22, 0x76AB423CA9CCE, 0x7D110A25D333F, 0x679B865F11779, 0x31A58C61A0279 },
+    { 0x661DC61714122, 0x0000003FCF808, 0x3CDFBA4003735, 0x0000003471933, 0x6638A74E5B5A7, 0x0000000A6E73E, 0x4B5FF16035F87, 0x000000485ECD4 },
+    { 0x2F394E7F05C7A, 0x0000000000000, 0x44FA999EEC710, 0x0000000000000, 0x3492F32240115, 0x0000000000000, 0x475F9631C81E4, 0x0000000000000 } },
+  { { 0x56E3C61DD69AF, 0x7D87E68343FD1, 0x19C17E95C1B84, 0x525A6F2BB33CA, 0x4CC8AF36CACF9, 0x48E0BE2FA5826, 0x504C4B3939D0A, 0x43E2E4388D2BC },
+    { 0x74B0C13C1A667, 0x02D92B4296C0C, 0x7AA0A40A7C47B, 0x075350484A376, 0x64F2851DC5C81, 0x2F590043CC84A, 0x661E2F2A21052, 0x3CFE56D50913E },
+    { 0x1D668A5C0BB8F, 0x5E76B563FB16E, 0x362369E45DC2A, 0x0A8AFF33CEBEB, 0x486AD3C9067F2, 0x623D02D1BA788, 0x002565AA2192D, 0x17B5E0A13627C },
+    { 0x2141B9BBE8E9B, 0x000000168B4BB, 0x49BAF759B33B4, 0x0000002D44529, 0x304DDFB4E707B, 0x0000005188A63, 0x65F9C676AA1BC, 0x0000002EE0F35 },
+    { 0x720FEE35FCF15, 0x0000000000000, 0x7A8A84C2652B7, 0x0000000000000, 0x0D790F2788EFD, 0x0000000000000, 0x3B0E78005013D, 0x0000000000000 } },
+  { { 0x5FB3C86186574, 0x77B944A6BAB64, 0x5CB761A76D222, 0x09F4307CAF8EA, 0x3C7FF34576CC0, 0x3E8CA7EA18DE9, 0x77369AD6321A6, 0x559DF7240D7F6 },
+    { 0x4C19AD22DEC7E, 0x47B57D9E4B07C, 0x729AA8B00DFA6, 0x52BBC5F98FC38, 0x3A5418CA34148, 0x0C6A4BBC10605, 0x5333B39A01112, 0x7D65B53514B0A },
+    { 0x443F1625D2CF5, 0x29BE5C9243178, 0x58A2305CD412D, 0x29AE0BE2CB7D5, 0x724A43D19A86E, 0x0F634659CCD7C, 0x0D94280A4292C, 0x5619F3078324A },
+    { 0x02FD1902DCFF9, 0x0000002179A60, 0x66FB3F656D592, 0x0000003323E9B, 0x1C6C3BAB3CB80, 0x000000340313D, 0x1BD3FA1576382, 0x0000003CBE83A },
+    { 0x145ECD22546C4, 0x0000000000000, 0x62C39C1494FC5, 0x0000000000000, 0x70E565659FA04, 0x0000000000000, 0x11B86843DFD50, 0x0000000000000 } },
+  { { 0x53E215CE874F1, 0x541D6E0A4DF8F, 0x74D3758B052BC, 0x4A1D65984190D, 0x6404840036573, 0x2502FD5ED81AA, 0x629441998660E, 0x5BE73121891AD },
+    { 0x3A93A103DD768, 0x0EAE7036E5B6D, 0x164B7315C252B, 0x5F090B0D002AF, 0x3BD5A9AA0463D, 0x20CE38E5F239F, 0x109997D194D77, 0x2B9F1823006A0 },
+    { 0x347CD6C1B9406, 0x6EF39188A8E58, 0x71EBC3A056B5B, 0x39096E592FC43, 0x3B73B0236728B, 0x0C44673AE262B, 0x383C8F3E91AAD, 0x387ADDB8456C5 },
+    { 0x18635DDD974A6, 0x0000006D79853, 0x7014A119A595F, 0x0000002307443, 0x3E4A3AF22ACEA, 0x000000474F8FE, 0x741632177141D, 0x0000002B9779E },
+    { 0x13576241FA856, 0x0000000000000, 0x68FA00C8780D1, 0x0000000000000, 0x16F90EEC08246, 0x0000000000000, 0x5D45D3EA78E52, 0x0000000000000 } },
+  { { 0x2A7216B3A1535, 0x6F45D567E1170, 0x290AE05830634, 0x03260E9038E3D, 0x4989B2C5217B7, 0x6460BB4740478, 0x12CC5CB81DBD2, 0x51EAF6C80B0F0 },
+    { 0x20D4F68372244, 0x70F50CA47E9EF, 0x5809547F5CDA9, 0x1854C28133939, 0x6E3CD9710FCA6, 0x64FE245979843, 0x074A4108CEBA2, 0x6E66098ECE6DA },
+    { 0x1540F38A51233, 0x61C579B1A082C, 0x1F28DA4D4C53D, 0x148DE07D06A9D, 0x18A505D601A40, 0x7D8833CB7D7E8, 0x557F9BFE6458D, 0x3C4D2113A3FCA },
+    { 0x2078326DC56C0, 0x000000341824D, 0x36FD51A3BB0C5, 0x0000002DF87BA, 0x1709F6D542E27, 0x0000002BC7D79, 0x22924A8E69558, 0x0000005245EF6 },
+    { 0x1005C0F05029C, 0x0000000000000, 0x3424CD9282705, 0x0000000000000, 0x37F79EBC1D8CF, 0x0000000000000, 0x274EF9FD109A2, 0x0000000000000 } },
+  { { 0x3C3E75ACC19F9, 0x799532CCB3670, 0x22B4D99AE5965, 0x4EEDC9DAEBB88, 0x02735DE93AF1B, 0x5C2E8F38335AD, 0x4D6E62F6497F1, 0x73CD9CF50983B },
+    { 0x4BF5E5E41E4BF, 0x5C3D142A7A319, 0x730DCE188B39A, 0x585959595F712, 0x54B970F32A0F5, 0x5A80830021CD9, 0x5A27DEAF9485D, 0x7F6399F6549AA },
+    { 0x6E7BDCA3DD7E6, 0x646CCB93405A6, 0x0F5B234566AE2, 0x46EC534859617, 0x69E8B633D5ACF, 0x15DEEAA12BA12, 0x3A3D0182711D2, 0x5757216C61100 },
+    { 0x1F2853303D3DA, 0x0000005A74E00, 0x3DACE2C2D8EBB, 0x00000029342C5, 0x6EAA1A1986825, 0x0000004E07D70, 0x238EBD2F71B10, 0x00000031D2E19 },
+    { 0x4515FE215C247, 0x0000000000000, 0x38D2C71BCE367, 0x0000000000000, 0x6C6CADBA288B7, 0x0000000000000, 0x401134BAAEC17, 0x0000000000000 } },
+  { { 0x21453CABBDAA0, 0x2BF480F33BDC6, 0x28B512DF208E3, 0x24E473A3CE376, 0x12A6DC053F35A, 0x46EEF9ED8EBAD, 0x2E5D065F51A01, 0x7E66902896D36 },
+    { 0x4C8238CE704E5, 0x0D6C23281C1D8, 0x5BF70C2519E53, 0x12E1279FEBD81, 0x24394ED07C9F3, 0x53CC173E1BC6A, 0x1CFA6F98ADB6A, 0x369E6E9FC9A2B },
+    { 0x4AE9DEAA2FD26, 0x01A99AF512F34, 0x3ADFEBDD75640, 0x2D38F4C43C530, 0x030A3BE3DF9E4, 0x4A6F5A3B490E0, 0x046CCDD31BDEC, 0x3824D21734C67 },
+    { 0x28A52B9CED978, 0x00000038DF2B3, 0x5A563781B3E0E, 0x0000003622F8D, 0x61E67A9C3525E, 0x00000049D985E, 0x0822CCA0C496C, 0x0000004ADE85A },
+    { 0x4380D9D567977, 0x0000000000000, 0x5F2627B5ABEB2, 0x0000000000000, 0x75835403AEAC9, 0x0000000000000, 0x326A12889EB76, 0x0000000000000 } },
+  { { 0x0840F3FE73046, 0x5E3A968BBBBF1, 0x20D3BF25FE778, 0x1E6724CBFB2E2, 0x2840B190AB098, 0x1FC87E3B72288, 0x231F53F154368, 0x3781B034D4AEE },
+    { 0x767B800CE4334, 0x44F1467462C8C, 0x144114F846151, 0x55F891BC64287, 0x12335EEC9AE84, 0x066C014CF1C92, 0x54DA9D9E3DC30, 0x7AF575B31F8C9 },
+    { 0x12E4CE8F4ACF0, 0x6141CE97F9AF7, 0x0CC9A7DC07472, 0x525D7AA7C42AF, 0x7B3DE8C6D6080, 0x0994BE8C3D0F8, 0x78EBD45CB9452, 0x003911E29C187 },
+    { 0x29D713AB08398, 0x0000003D39C35, 0x0695357931FCD, 0x00000014D1FC8, 0x4A31EC373D264, 0x0000002393523, 0x78D9ED5CA04F0, 0x000000347B08B },
+    { 0x63D710B2574F5, 0x0000000000000, 0x533396D396266, 0x0000000000000, 0x69C515A0E579F, 0x0000000000000, 0x03BD3D4A2C2E1, 0x0000000000000 } },
+  { { 0x50280ADB70322, 0x7075E49D0E832, 0x75EA897E915C2, 0x0CF9FC96BFB1F, 0x754CC588CDE7C, 0x6530CE5926113, 0x318E1EB99A7C6, 0x6E36B1CDF7F6C },
+    { 0x22C4FBBC8BB26, 0x3E65B56D29D9D, 0x182895C8A06F2, 0x3BBB9CC9E2DBD, 0x5747DED8E924E, 0x7FB2A134620FF, 0x562158C88B6C3, 0x31BD8E3AA5C63 },
+    { 0x3D89064F8D685, 0x5EB35D641AA21, 0x3B75B6C3792A8, 0x479EF209180D8, 0x23E8A6F59E675, 0x6F7DDA3B8CA89, 0x1DDD4DDCABD7C, 0x1E0045071C984 },
+    { 0x770FDD72B711F, 0x00000059D4D1A, 0x7567DAB2042CC, 0x00000021DA120, 0x1357F43754A90, 0x00000041C6020, 0x25DDAF2F615DB, 0x000000408B56B },
+    { 0x60EE738EC5A21, 0x0000000000000, 0x2BF900A11C6CA, 0x0000000000000, 0x5AE9E4252A6E7, 0x0000000000000, 0x1D2CBAB114922, 0x0000000000000 } },
+  { { 0x2F9BA0658EF94, 0x342E84A061836, 0x2852FB6A04279, 0x5A3761DF83B83, 0x356F3FB918988, 0x44D84154E5813, 0x05EAF04E21D5F, 0x436524D412E9B },
+    { 0x23D38FECCB560, 0x2EB0961622550, 0x16CE8223769B9, 0x23E36D835B1A8, 0x67FB375E36393, 0x3726BB7A10C37, 0x3546EB713285C, 0x41C22B56B28BA },
+    { 0x5A8277EDB5F9C, 0x6E8CA4B65D399, 0x7851178C50F38, 0x5EC6CF00192EF, 0x4EEDE0069C95E, 0x4B1AA5186A5EE, 0x4BC89CB16C6C7, 0x23526CDACEE44 },
+    { 0x1760740ACF0B8, 0x0000000EE40E4, 0x2E1F6FD56BEF4, 0x000000025E6F6, 0x42B08DB3B00AF, 0x000000533CFE8, 0x3C27DFFFB6717, 0x0000004869893 },
+    { 0x01C72E12CF71F, 0x0000000000000, 0x76C7BAA07D16F, 0x0000000000000, 0x5305801DB2A63, 0x0000000000000, 0x19A2C1CCE1B28, 0x0000000000000 } },
+  { { 0x3609BA4ECFBEB, 0x3D7E53E749F57, 0x21FC32D492EBF, 0x275F482014CE6, 0x29C1E8A9C742D, 0x7A77F13494AD6, 0x19E65E4D6B513, 0x3C69DC435F3FE },
+    { 0x2D6D4E76F4947, 0x16833AE0DE9C1, 0x01380E71BDBB4, 0x0E5051F518018, 0x6D629A9ABBE5A, 0x456B3F80ADBBC, 0x180EF586D17A5, 0x37B2CD43E9A33 },
+    { 0x033A87E0D3236, 0x53B81F5507004, 0x5BA8953D28893, 0x78337045CD3C6, 0x6947B22B4BF73, 0x44CABFA5CACB5, 0x308E37633BFD2, 0x47BFB618B6A9C },
+    { 0x71DC0D8F63410, 0x0000002DE15C3, 0x7170AF663165C, 0x0000000542F5D, 0x724DF7FD68738, 0x0000003A62861, 0x0865C9B0805E3, 0x000000441DFCF },
+    { 0x7F30F714F21E8, 0x0000000000000, 0x712E15AA8284E, 0x0000000000000, 0x7F0EF5AB55127, 0x0000000000000, 0x41923BC44E349, 0x0000000000000 } },
+  { { 0x7702C9B09AD13, 0x63631EF519D3D, 0x6B41D62AC02F0, 0x471EF5373572F, 0x5D6D18669215B, 0x3E679E33196F0, 0x45C222DAE0E70, 0x48D02B25485A8 },
+    { 0x7FE3A5E6FF663, 0x37AA521A0558F, 0x71806F00D4B0C, 0x056B45B799B09, 0x6B21B19A81AB6, 0x398B0F01CE05C, 0x7139D8DDB4E26, 0x443B85D21AA74 },
+    { 0x1A6BC7685DD44, 0x535935192C83A, 0x4E8DB5EA25E1C, 0x0F8C6F80BECA4, 0x5CEBF2B383379, 0x38432CE3B212C, 0x71075493D897D, 0x789C4AC6D00C8 },
+    { 0x349558AA1BD3A, 0x00000021AB3C2, 0x742A67C74FCBF, 0x00000031FF2A3, 0x5918EF860FEBB, 0x0000002F91DBF, 0x1C50944812617, 0x000000381C23E },
+    { 0x3A6323174B808, 0x0000000000000, 0x2F0DE3D096508, 0x0000000000000, 0x6E8D6C5229427, 0x0000000000000, 0x14FCD05CACA2D, 0x0000000000000 } },
+  { { 0x67DF4ACB8B937, 0x167D9BEC87595, 0x049107A8D4114, 0x45F1C690038BC, 0x3894F9627BE93, 0x3B884E95344E6, 0x4009F38AB254C, 0x2596EB0176DB1 },
+    { 0x6DD7E2CE5BCE6, 0x46DD21C8F68D8, 0x4E7870F6563BC, 0x162D066CD5D20, 0x3B997CD161A2A, 0x44829A9D950D9, 0x4BA01FC026083, 0x01CE3F3CC4CF3 },
+    { 0x4AF66AE479BD9, 0x645B6730F5275, 0x5CC8223389659, 0x3BBF429F69878, 0x2E9FD4D750C7D, 0x69033CC721BB7, 0x7259FCB69A575, 0x730A2BD1D3A49 },
+    { 0x08AE455F6C395, 0x0000001453D10, 0x0D99CA3D62B72, 0x0000001906C9B, 0x295B9320A293E, 0x00000038BF1E0, 0x7756621A9A341, 0x00000046E54C8 },
+    { 0x4009ABFFB80A9, 0x0000000000000, 0x1A2A1C4C88B90, 0x0000000000000, 0x0320DE9560F9C, 0x0000000000000, 0x2C1293E512979, 0x0000000000000 } },
+  { { 0x5B5E6E8890E37, 0x339BD296312EB, 0x11A5AD79C59B7, 0x5A056735ED684, 0x38DE45397087F, 0x2713ACBA8E6C3, 0x15F682A6723F9, 0x1F41DB3CF7AE2 },
+    { 0x11064AB367C7E, 0x178CB023AFCAE, 0x10B837D2A1E38, 0x14BD8463B3706, 0x6EFB647CE8A7C, 0x060EEF7C3BF5C, 0x7F598BDC77479, 0x10F88F198EAE4 },
+    { 0x1753F686A7C9E, 0x4C35A4F3EBD99, 0x1082A94E500DE, 0x72F8080387F33, 0x17CF31CFDA099, 0x52CFD25023154, 0x4E22C45E67EC2, 0x319FE6AF1A766 },
+    { 0x00AE354031386, 0x00000067F8CB2, 0x46623F6FCC892, 0x00000007F6835, 0x67B2955AD8031, 0x0000004A8A3BB, 0x10FE8E064CD8A, 0x000000492F8F4 },
+    { 0x6AD6BA1D28C6A, 0x0000000000000, 0x7F6B27AA38C58, 0x0000000000000, 0x437A27F5495B7, 0x0000000000000, 0x398F20428D27D, 0x0000000000000 } },
+  { { 0x2D1DDB0A630BB, 0x0AD20FCDA0BA5, 0x7B1D5F486F2AF, 0x3E40B399C0280, 0x3852CB933E777, 0x614A56A644225, 0x4404531DA5F15, 0x63DD942ADCF9D },
+    { 0x7ACEA981A3BD2, 0x1C0B8372E15E2, 0x3511937D8499D, 0x69B706AF43935, 0x741BE9EBB4C57, 0x344EF61122AB8, 0x2F29D8CBCCA47, 0x5467B9A03C451 },
+    { 0x3A2ABC327423A, 0x09E34E2ED4D26, 0x54B05BB631521, 0x254689820FA94, 0x6B6EB8A42BC7D, 0x7C9EEEDCFF01B, 0x380F7077C0457, 0x32AA1777A8AA4 },
+    { 0x5E8B7236F3B56, 0x0000002E5F595, 0x1899760585FB7, 0x0000002025A81, 0x288A916811C43, 0x00000035430E1, 0x52EEC5F405C9D, 0x0000003394ACD },
+    { 0x517F716AE7C8E, 0x0000000000000, 0x6B9C8CD47A3B7, 0x0000000000000, 0x19FBF05F2AFB3, 0x0000000000000, 0x7396CC938D8F0, 0x0000000000000 } },
+  { { 0x056B28EAF4E75, 0x4EE0F6633DCCA, 0x2AE710E7F3BAE, 0x4399CDA9DB30B, 0x489ED71E7D037, 0x02D9E0DFEE5AA, 0x4DFEAFDCE9D54, 0x52D71C4720BF4 },
+    { 0x2B69D03E2ED97, 0x749D25873CC19, 0x4AA568BAD6C10, 0x5F2C2BD9CB734, 0x64DA791F6FE85, 0x2F0E26E4DC9AB, 0x1A10425EBE249, 0x7CAD656CAAEA8 },
+    { 0x44614FFADE017, 0x06F933D4ED464, 0x7DCCA5508DD1F, 0x6590B1562FF1B, 0x2B61D1987232B, 0x02E6444D1EB48, 0x033A149CCFB79, 0x4841878013025 },
+    { 0x57558E7C10590, 0x00000036E4DAF, 0x3163CB40F6CAF, 0x0000001AA8651, 0x0FBF52B5D7B6B, 0x0000002BDAE32, 0x12D265E793F4C, 0x00000051B936B },
+    { 0x7E6916B81F4FB, 0x0000000000000, 0x7454FB43FB2D5, 0x0000000000000, 0x08D1B2B4AF356, 0x0000000000000, 0x09B0635FE1EA0, 0x0000000000000 } },
+  { { 0x2C0CF38A870BD, 0x56F3B1F18B847, 0x751828B1D55CC, 0x45F6BBFF99448, 0x67827504F608D, 0x52CB3DC589EDC, 0x548456CE52198, 0x1F038C9610E27 },
+    { 0x534BCD521C082, 0x73CB8D0403899, 0x3568FDDD103F2, 0x78DD88FC5DD5F, 0x79B4F52CD9667, 0x72C789BDE8B66, 0x216407C8782B4, 0x0A1531A034C06 },
+    { 0x380532081C011, 0x477F25C04F768, 0x3D1925BB18AF7, 0x7E41F4A7F162F, 0x3B5D74A3C4498, 0x5EC3FC15167F5, 0x60F38BFD14C53, 0x06E38A9FC1E16 },
+    { 0x16D9D0D1EAE32, 0x0000000EFFD60, 0x633299CA60CCD, 0x00000015832D5, 0x61E01CF2245B4, 0x000000500E1BF, 0x2249E0642640B, 0x0000004C518F6 },
+    { 0x010708EA4EADE, 0x0000000000000, 0x7AA2B57F080E0, 0x0000000000000, 0x4966F5A241209, 0x0000000000000, 0x3CAEA0B96637C, 0x0000000000000 } },
+  { { 0x4BEBFED18B7BE, 0x667BF61E95885, 0x2CEABA231CCB2, 0x0A5957091EC37, 0x59DCC5BFB6C3C, 0x4042325344874, 0x1057063EBF592, 0x7E2284CA10033 },
+    { 0x377017E901D26, 0x5448C71F06008, 0x7FA7C29363CF7, 0x2A102AE093A92, 0x4801A851833B9, 0x4FCB3DBD785B8, 0x14F0DA4789540, 0x719C40117A8B3 },
+    { 0x511DB29A2EC8C, 0x34B7F46582272, 0x769E316109E0E, 0x7EB2ECB0C3C13, 0x57ABC786768B0, 0x384BA33FF643A, 0x5E197A3DD948C, 0x6231B016ED6C2 },
+    { 0x4AB1CEA7209ED, 0x00000057C4A96, 0x07094C153A5D4, 0x00000026B6A94, 0x14A7BB46CB841, 0x00000078B26A4, 0x21E1F03C91FBE, 0x0000005F15E25 },
+    { 0x08BF43690FEC6, 0x0000000000000, 0x1E8F1126AEF91, 0x0000000000000, 0x234DAFA0707B9, 0x0000000000000, 0x2EDC11A30B66F, 0x0000000000000 } },
+  { { 0x038B0DA8BBAB4, 0x4EABD7303A2EE, 0x2CF16D4095C0B, 0x10FE48C61E873, 0x33C785FBBB7E6, 0x623300EA90A70, 0x5C424916A30D9, 0x621052BCF502E },
+    { 0x77270EEDA9203, 0x175E4AAAEC5A3, 0x19909821C09EC, 0x0697572254301, 0x7E8EB564B0060, 0x4BEF43ECC760F, 0x51FA3A2D4908F, 0x31DF43AA9887B },
+    { 0x1FA51075DA475, 0x54C0B2C97E961, 0x73BDC09DA68F9, 0x2CDB87E960905, 0x39A0FA821B60D, 0x155035BAA89DA, 0x1530EDFFC823C, 0x65DA5D49E29D6 },
+    { 0x1591442727FEB, 0x000000581B4C4, 0x5FA35418D637F, 0x00000024FA0C8, 0x270BAB6EDE7C1, 0x00000067FE42D, 0x3329DFD4E3E56, 0x00000052E8755 },
+    { 0x25D3DCA2ECFF4, 0x0000000000000, 0x77006C03E208F, 0x0000000000000, 0x63AA1ED581448, 0x0000000000000, 0x191D938290806, 0x0000000000000 } },
+  { { 0x6B5C45CB55DDD, 0x1CE7A4659FCD7, 0x244E1379B195F, 0x3A5B3781DC14C, 0x697B49F10CC0D, 0x0883F46960FE6, 0x40493F0DD71D7, 0x48E21F4FD9BA2 },
+    { 0x7C00A3B4BC379, 0x671FF92B5F0AF, 0x5FF879DCACFFD, 0x6804781C467AC, 0x5A6200877CA37, 0x623A980E43576, 0x6A15F11B8EFB0, 0x42C3903FDD619 },
+    { 0x7284DCD0A3CE5, 0x0908AE9C18760, 0x6C4F5A665FEA0, 0x7F19F5636DBE9, 0x2E0F4E06A2783, 0x057C2B208093C, 0x4DA6F316310BA, 0x7D798B296EA5B },
+    { 0x3EEDFB6558B68, 0x0000000E7184B, 0x49FB288408EA1, 0x00000013C85AB, 0x529665942C487, 0x0000004D67983, 0x48B8C595497A4, 0x00000040CF31D },
+    { 0x4B07BA5C2F7FC, 0x0000000000000, 0x7D3A7AB1A0F7A, 0x0000000000000, 0x414709E44129D, 0x0000000000000, 0x2F910FCED070F, 0x0000000000000 } },
+  { { 0x107C842C69744, 0x62F17D1B0A0BA, 0x3E245CDE62685, 0x21C29DB44C159, 0x4104A2958DB48, 0x36B95BC631D3C, 0x76243A6588683, 0x1CACD7ECF9C2C },
+    { 0x2D62B59A88B6B, 0x3DBEBEF8A66AC, 0x7FCE95F0E3363, 0x4F55CCDC08D81, 0x3D02D7F680B49, 0x227C6EC24C362, 0x5BB0FAADDCA3A, 0x59FEEB11B4E63 },
+    { 0x638B77726D704, 0x76DADC926E950, 0x1EB2D07591216, 0x4466175727151, 0x3CA52BE1218A1, 0x0978839B81B7F, 0x77F19E1F33FDE, 0x6F7BE964823BA },
+    { 0x19A3D9050B13D, 0x0000000B1E04B, 0x0FC9E8E75B6AE, 0x0000001228950, 0x618FF6FE79659, 0x00000047D0BF6, 0x4C2CB65F63F0F, 0x000000479E8E9 },
+    { 0x77ECA6B15F2B8, 0x0000000000000, 0x7A0FE463B5374, 0x0000000000000, 0x5106F727A3BE1, 0x0000000000000, 0x2E11EA446D68A, 0x0000000000000 } },
+  { { 0x092EA5046AF26, 0x5BD3E6D982987, 0x6F38F4AC2EB17, 0x05605FDD9CFFF, 0x564914AFEE6FC, 0x639AFDF4C76CE, 0x78A5815FDB397, 0x14E075500DFB0 },
+    { 0x206C814B2EE5F, 0x72DE0E0E8437B, 0x6F9D728530075, 0x314CB741578EE, 0x44BC2526CDDBF, 0x59495CD57F83E, 0x43260E1D8CD86, 0x023757C6B0B41 },
+    { 0x3690FF219A2F2, 0x6DC03FE85D705, 0x5B1D81BE53037, 0x54A35E3495B34, 0x0A8C104142FDF, 0x3868E579FD6A6, 0x7EB838BE89BD5, 0x2A3387795F289 },
+    { 0x233251E8A1FBD, 0x00000019C41EA, 0x6730BBC68E5A8, 0x0000001F977AB, 0x7B75C805E0292, 0x00000054B4F23, 0x2F76599740C71, 0x0000004BF4949 },
+    { 0x457FBD2B65800, 0x0000000000000, 0x2F27F9B7D805E, 0x0000000000000, 0x33CA43F340990, 0x0000000000000, 0x12A3B61A3147D, 0x0000000000000 } },
+  { { 0x564ECA68C8ACE, 0x31EA29DD94AA4, 0x2C370B9A1A716, 0x06A675778A306, 0x57A67E82016D0, 0x136877DE7C815, 0x2CA780BDA11B8, 0x74151B0D7B491 },
+    { 0x22A2CD304C620, 0x16A6CDBF1B449, 0x0F054630404C1, 0x44AB90CD02CEE, 0x04C40CC70734D, 0x14335360FB8A6, 0x34C1D907E9EFE, 0x7A1706F3CA9CE },
+    { 0x47DCD5A229072, 0x4863224BADEF2, 0x63672AC1550E4, 0x4686C32E49708, 0x70011ED32E8F3, 0x4FD1C3A1DE38C, 0x174D2262343CE, 0x42701C437E1FD },
+    { 0x76DDE4F0426B8, 0x00000020F2472, 0x5E54925A148CF, 0x0000000F29E19, 0x719805C01AE68, 0x00000034F4321, 0x15E262A5A0B7E, 0x0000004681F29 },
+    { 0x5892482BE9360, 0x0000000000000, 0x549CE06C7C723, 0x0000000000000, 0x736B37F0C3027, 0x0000000000000, 0x7CE7ABA840454, 0x0000000000000 } },
+  { { 0x29C57992CA865, 0x12640FAE0F2DD, 0x2960D9BDCA206, 0x2AEC14889CC53, 0x2C6DDD647FAB3, 0x2252BB7039C92, 0x53CA486D6BEB4, 0x071E7494CCAE5 },
+    { 0x44741D57A4B14, 0x6F5EFBECF5ACD, 0x00D51D6BD821A, 0x2664CE500296E, 0x7BBE2710B6F97, 0x6F9344F12A641, 0x77FB983A77414, 0x71BD6E36B9129 },
+    { 0x3953989D41DBB, 0x3B54EF8E06138, 0x7AED57D0D9E2A, 0x0F319F8EECBDE, 0x305DF7F3F3930, 0x6FDA8CA8ABA36, 0x0864A4449AA1F, 0x68AE588A9120A },
+    { 0x3C8A1053EB5A2, 0x0000002C0EB02, 0x4E1289D533574, 0x00000030525D0, 0x27B6D20FA18F2, 0x000000357C43D, 0x6D68FEF902AA0, 0x0000004972263 },
+    { 0x10BEA067561AC, 0x0000000000000, 0x30864F06FDF2B, 0x0000000000000, 0x69333583B9605, 0x0000000000000, 0x64382B67936BE, 0x0000000000000 } },
+  { { 0x726399260B44E, 0x34ACE3D8438B0, 0x18482497A2C8B, 0x4914993D06A5F, 0x0EBD0B10288A6, 0x2A8D94DA2B56C, 0x5F8A3D3BCD7AB, 0x55F60F58A9B6E },
+    { 0x3644937F973AF, 0x7CA1D18802FD5, 0x59A780C68D743, 0x1B66C3E6BB77A, 0x04A478DAFE7C2, 0x1E2C743593C4C, 0x3E15465922F8A, 0x2B51A639DC828 },
+    { 0x3CBBC0763C85D, 0x1050E8C15FFA7, 0x3ECBA3899E452, 0x742CFB6A3E26D, 0x739936C1B2209, 0x70C3BA363B5F0, 0x60FCE1B782D45, 0x17EFF1C0F7921 },
+    { 0x436D0737453F7, 0x00000045CF0F3, 0x3BC88D0AEAE64, 0x000000192E138, 0x5F5EE02ABB739, 0x0000007DC71A2, 0x05FFF637F95BD, 0x0000004ED15B0 },
+    { 0x080F8C473BBE9, 0x0000000000000, 0x569978B456DB6, 0x0000000000000, 0x7FA1B62182CB5, 0x0000000000000, 0x662735FC19150, 0x0000000000000 } },
+  { { 0x22CA328ADF9F2, 0x7B8DD80B3280F, 0x0D0BCFB15EB4A, 0x09C2BB878C5BA, 0x170C555D73026, 0x1416676A875CF, 0x3D1629FE3ADEC, 0x2F1E6A93C6A2B },
+    { 0x37A7C3C6E32E9, 0x3DFF6FD026AC6, 0x56634ACD3278A, 0x75EAC3BE1211B, 0x75ED2AA392815, 0x76CFA61906806, 0x25A980E279B01, 0x13BD04747F86D },
+    { 0x4D60D02102F41, 0x03211FCE3743E, 0x4C9EBCAE0A67F, 0x5E03886B888DF, 0x0549D47F42830, 0x3F0CD8AFF1A29, 0x002DE342E4AA2, 0x31B24C4A14EF6 },
+    { 0x34BAB65F27291, 0x0000002AD0A65, 0x6BCAB09771C32, 0x0000001878938, 0x08086F3E6340C, 0x0000005DF3E08, 0x3E3E85737DD45, 0x0000004617BA9 },
+    { 0x25C96B2A38C87, 0x0000000000000, 0x6E3328EF98382, 0x0000000000000, 0x6E55CDFC80BB3, 0x0000000000000, 0x06B10ADD8B22F, 0x0000000000000 } },
+  { { 0x4607EBC80BC5F, 0x683E2BE064580, 0x3ADE78417D759, 0x4E93A74DA2861, 0x011CAB4DB3E33, 0x5731F72BAAC63, 0x498C5A7988DD7, 0x1EF61D9163736 },
+    { 0x44EA4CC202FFA, 0x1AC7EAC4D2378, 0x7ACEC81B6C987, 0x66916C6E71662, 0x7529C9BE8598F, 0x685DCC3382F4C, 0x1F7A67372EAC1, 0x1A61FFC37BF88 },
+    { 0x0D407B5301AA8, 0x10D737B7B8112, 0x6592C5E635611, 0x2E0CE6BDC03A7, 0x32D9DA25952F5, 0x396C03386E0EA, 0x6B03C88873D48, 0x4C0FE5300014E },
+    { 0x4003BEA7783EC, 0x00000061A7434, 0x3E393819752D7, 0x00000030D385F, 0x71F585AAD0BF2, 0x00000026D7C94, 0x226C3D184E66F, 0x0000004C58009 },
+    { 0x0A144A51A54AF, 0x0000000000000, 0x2A43B16280B99, 0x0000000000000, 0x7851D24E8AEB2, 0x0000000000000, 0x65C0C0D4F9645, 0x0000000000000 } },
+  { { 0x50A7FB9BEF90C, 0x1DFBF190E5B44, 0x160EC931A6562, 0x0DC244B8E84A7, 0x1171E5B6137D2, 0x121B324BE56C9, 0x7F98524137790, 0x6809C2FF43B4E },
+    { 0x01FA21E99CF81, 0x621CC724D25BD, 0x2AC0841FF7AC0, 0x3DF41143DEA59, 0x2747AA40CC020, 0x21AC791E1731D, 0x4B1B0629D9AA0, 0x7CB26A6ECEB18 },
+    { 0x134548B77F478, 0x776C30A459944, 0x0FFD025758956, 0x3F177F0B69BA7, 0x216ED1B70A67F, 0x43B123AF17668, 0x341A8BC25A3CA, 0x5E3E5B66DDFB0 },
+    { 0x01141BED3B4A3, 0x0000002494A25, 0x52E6299444DB7, 0x00000024B3A09, 0x3211912387CA6, 0x00000062B4EDA, 0x411A497DF6444, 0x00000024D4816 },
+    { 0x18E657A0225D5, 0x0000000000000, 0x283DCE0CFF742, 0x0000000000000, 0x0F095F1784367, 0x0000000000000, 0x503EB4834337B, 0x0000000000000 } },
+  { { 0x1EB77863968BF, 0x01CC22D686F50, 0x794142B32750C, 0x1EB2C8CEA326B, 0x60C297FEAF05D, 0x53AD13D17FE74, 0x3930F93E4E272, 0x4C90569B55203 },
+    { 0x2F979A424022D, 0x4A1967BA4D273, 0x00F3E3E05346F, 0x6B3230B26C69E, 0x30B9638198EA4, 0x5DDE16F24B7B0, 0x578332AA5FFF6, 0x2D074136347AF },
+    { 0x2B61C21EFA8F1, 0x26BAA290B07D9, 0x7A9C1FD3EA5FC, 0x2CCA0B3E263DD, 0x1A3092C234CF1, 0x308525E1D3B66, 0x308F41452BA08, 0x0BE0942A6990F },
+    { 0x0D1F92C7727F3, 0x0000004EE31FF, 0x090875945D78A, 0x0000000FD474F, 0x58F71027D8174, 0x0000002034087, 0x6889E0062559D, 0x0000003DFF435 },
+    { 0x49665412CFD2B, 0x0000000000000, 0x72B1ED2A743BE, 0x0000000000000, 0x2740FF9011286, 0x0000000000000, 0x3A8366CCDA4A9, 0x0000000000000 } },
+  { { 0x64A952F8306E7, 0x1220D62F71B1E, 0x455B45A08454A, 0x09B51F0A8597C, 0x723644E236C41, 0x11CA3FC996FDA, 0x6218855B80746, 0x3DBBF2F7A1888 },
+    { 0x2AA3F6FA4AA06, 0x4777E733B2C66, 0x7C001C79F269E, 0x7508E16A93493, 0x42203EE509EE3, 0x3631F95218BC2, 0x33B2949EF00AE, 0x7EF318BACE363 },
+    { 0x08EA04D62335A, 0x3D905AF226676, 0x0807E5BD8323E, 0x21034603AA725, 0x53027B18506DF, 0x77932B695DC98, 0x39E97052863CE, 0x70320D5F55CED },
+    { 0x58DF8A8C58810, 0x000000185A0D5, 0x378106BE78EFC, 0x00000037DDEBB, 0x4CEAD938562A4, 0x000000494D45B, 0x08FD564EE7735, 0x00000046DC94F },
+    { 0x31BF1CFC8CF9D, 0x0000000000000, 0x19A848BF9C4A4, 0x0000000000000, 0x6AC289FA0953D, 0x0000000000000, 0x7A3DFB67DAF81, 0x0000000000000 } },
+  { { 0x73EC3A528EE84, 0x0320029B4FE4F, 0x27E062F4E458B, 0x3408F6AC41802, 0x5F5404D580CEE, 0x774CBAC50E333, 0x5D9A7329546B1, 0x5A2776106B87B },
+    { 0x6E72B0F191D4F, 0x2C415BF8A38FB, 0x28D7A754DC511, 0x192CD5EFD0EE1, 0x7085A765FB8D6, 0x2986B5C6285B9, 0x12CFA9ADF717F, 0x61EB4D222D1A5 },
+    { 0x5341D26675762, 0x7A89AF2536FBA, 0x57CFBA97ED249, 0x410984F587791, 0x0AF2AFBEFF7CC, 0x5831DCE129882, 0x32BD6CDA6CFFF, 0x0B8BDE9A0653F },
+    { 0x6CAAF72AF1AE5, 0x00000023D1D18, 0x5785902F1DA2E, 0x0000003F42FD3, 0x14D0EBE9CCC66, 0x00000031AC638, 0x5B3564B517C84, 0x00000046B939C },
+    { 0x22B3743266E42, 0x0000000000000, 0x7D4832113E3DD, 0x0000000000000, 0x7FEF95E540168, 0x0000000000000, 0x56B5FA9AD408E, 0x0000000000000 } },
+  { { 0x1D8E64DD34822, 0x6A2E6EC692502, 0x1963136F2AD1D, 0x5C8FE8046D578, 0x3F14EF815ACD2, 0x003133E7AD9F6, 0x64ED98FBBD51F, 0x5C83CD64CF716 },
+    { 0x471AB173FF198, 0x39720EA5AF437, 0x1E91E1BA2CD86, 0x3DBF585D57B62, 0x03562152F29CD, 0x5EF4A3A8CEBB3, 0x5E64228A38EB6, 0x30B2C9CAB8C1D },
+    { 0x1C4D6D6C8D114, 0x22BE07E4CF468, 0x0B4C4346C716F, 0x22DE94949D9D0, 0x550BA188AD4B1, 0x0A3EC60AB2720, 0x729FE05DB1CEF, 0x50E53F5A5A91B },
+    { 0x50E00B1A0E9B2, 0x0000005E587B7, 0x719879B50B6D5, 0x0000000BF4EE0, 0x6DA93C64061C8, 0x0000004D574A0, 0x6F283B4FC4F2E, 0x0000004F00A9B },
+    { 0x7804D7CD03345, 0x0000000000000, 0x55DC69507D4C4, 0x0000000000000, 0x13F11E6A1E875, 0x0000000000000, 0x378E05694A5FC, 0x0000000000000 } },
+  { { 0x3A2087766D009, 0x7AA3F8397C401, 0x554CF7D0772A0, 0x26494C8465DA7, 0x7FFFFFFFFFFFF, 0x4B8F062B15D47, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x58D7B2F252AAC, 0x06D8ADCA1EAED, 0x635E02B3F4E70, 0x08AB7D93E8B05, 0x7FFFFFFFFFFFF, 0x5A07148159EF1, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x463B2A876CD32, 0x65A6A1176BF6E, 0x5EBD46040344A, 0x4B1BED105D964, 0x7FFFFFFFFFFFF, 0x0BB9A2367E2FE, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x5960591BB9642, 0x0000002FF2374, 0x603F52E31F831, 0x00000021ED8BD, 0x7FFFFFFFFFFFF, 0x0000002341F27, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x6D4827C586162, 0x0000000000000, 0x43D504EF2BBCD, 0x0000000000000, 0x7DC1767AE2FFF, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x4D21FEF929167, 0x04AD9D191106A, 0x065BA8645E094, 0x61DA5114F69FF, 0x32DE0106D6E95, 0x298E7B93464B5, 0x79A4579BA1F68, 0x4C61C79760B20 },
+    { 0x06AE2B326AB72, 0x23B5A613E37B7, 0x290045781D77A, 0x6A7E595ECBFC1, 0x7951D4CD9548D, 0x4466ABF18440F, 0x56FFBA87E2885, 0x7D9DF8A69BC04 },
+    { 0x487D2A7CAED53, 0x062621CE323EE, 0x20340C9275512, 0x67C69DC17BB26, 0x3782D583512AC, 0x28C0670BC680C, 0x5FCBF36D8AAED, 0x471FEB187D0D3 },
+    { 0x2BA642A617C93, 0x0000005BF79B3, 0x711C6828BE524, 0x0000003A8385F, 0x5459BD59E836C, 0x00000031102E9, 0x0EE397D741ADB, 0x000000528443C },
+    { 0x5279A4717819A, 0x0000000000000, 0x39FC14690542C, 0x0000000000000, 0x248C357A13E65, 0x0000000000000, 0x3D09C58286BD3, 0x0000000000000 } }
+};
+
+static const vgelm_t ladder_table_B[OBOB_BITS-1] = {
+  { { 0x7C9EC5EFDD418, 0x50DC85CA0117C, 0x0000000000000, 0x0000000000000, 0x7C9EC57BB0D5E, 0x1A40C4412F08C, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x700FE1CFAE2A3, 0x64DCA008D6BEC, 0x0000000000000, 0x0000000000000, 0x700FE1CFAE2A3, 0x1AAC4AE9C8A6B, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x04F89290E3EA2, 0x1E37667EC779E, 0x0000000000000, 0x0000000000000, 0x04F89290E3EA2, 0x060D3F78F32B6, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x3BC6A508A104F, 0x000000255C1F0, 0x0000000000000, 0x0000000000000, 0x3BC6A508A104F, 0x000000604D311, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x2F484649BDEB1, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x175EED24ABEB1, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x2FC2A090320BB, 0x0A6E7F29E9493, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x08B263AAB30CB, 0x6192AD5B612A7, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x1875D13F940CD, 0x57D0AD6757B14, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x5133BDFAB43CD, 0x16773D2CEF02B, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x3489E968428E1, 0x1B7831AD62ECE, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x386F8DB187EEB, 0x35FCB9B208734, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x156E5A0879BA7, 0x0000006A792A2, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x42F384A879382, 0x000000577133A, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x05F40A43EC628, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x2FAE1D3F9DD71, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x3E0F432EE8FEB, 0x0547A9E38C0C0, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x11247E13DE1FD, 0x1FF846E95B8A0, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x63DAE2FCACB10, 0x0DB39EF82CEB9, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x7A4B7CCC5453B, 0x64D23D06704C7, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x36DED61393BCC, 0x43DEE72422979, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x0BC8B93593310, 0x04F23F6A2E2E3, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x544502FD69DBF, 0x000000702EDF0, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x783F52A862807, 0x00000056B6050, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x55FA8503DAEE9, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x1B9D50727F017, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x5F33344576BE4, 0x0772801903541, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x2E79724D6B092, 0x21F5FDCFFE967, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x12C33586DA125, 0x7D15A555F7D8A, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x35C0E030BA08E, 0x36B217CDDA029, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x04DF6F2BDD061, 0x5C2065D6570E8, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x4C9A8BEACF6F6, 0x651737B9B8456, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x465979E210285, 0x00000072F5178, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x19F8A5C69CD04, 0x000000362AB9B, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x6C8EC3A007EC0, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x6FCD1773A2137, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x7D951364573AA, 0x4B38E356DCAEB, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x24FDD6C35077A, 0x1E45FA1091014, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x6BBB6FA26E553, 0x412BCABE07115, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x7A085578F0E74, 0x43F7FB9C7C8EF, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x7EB8DFE6E3141, 0x14C22A289F424, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x7056032863609, 0x01359D9E47457, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x2C8F86B31122E, 0x0000007B2BA87, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x22A922092F03F, 0x000000409D8D0, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x70E6547EB7DE3, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x2BD71190A8D50, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x1778F77DB113C, 0x043C8C60A3B5C, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x75BF2DEF65E7A, 0x66C3897A3DD21, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x27BA23C631906, 0x7DA581FA5721E, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x29779452E85C8, 0x1DAB395D0DA5A, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x64C906D8A126A, 0x2A3204CFE8D3D, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x337B68E934A6C, 0x5BB1E998C430A, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x5B4B3DEB12045, 0x00000065F2388, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x02C0A5722B2CD, 0x000000399352E, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x76EF56B803EA1, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x1B98F0C074984, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x3AA0181E6854F, 0x3E3785158CF03, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x4BF1FFE8DBEE3, 0x16A7A478AE111, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x215B371168E91, 0x656E55B71619D, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x2EC9B65204B78, 0x364245BF9E855, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x370A46A2DF5DC, 0x386C12C1A1BCA, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x080B49361A108, 0x37871B8D2079F, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x1A726A3458EC4, 0x0000005FAF0ED, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x2FA62D16B024C, 0x000000309C9BD, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x3C711EFCEAF21, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x7E2172B05AB27, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x6E6829222DEA3, 0x0CCE3C301FDCF, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x509C53BAB2E5B, 0x1E3F44588970E, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x3972F078AE4EB, 0x500135405695E, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x6EA2E695F8478, 0x112F520B671BA, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x2FE0F34D8106B, 0x3E845DEA06840, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x507225E64D2FA, 0x15C3AC0D963CE, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x270D633454D74, 0x000000750A336, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x477F6153191EC, 0x00000045A6A6C, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x271FE9D83B388, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x7BC9C8B013D7E, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x3693AB2728CA6, 0x6719CDA909355, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x2B5FF36EDDE10, 0x5F6839EA0F459, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x2FA7319532A2A, 0x55CF3804772BF, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x1B94E04B872A9, 0x6C3AAAE74E0CE, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x045D4EC531E19, 0x2E2DCAEE07D15, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x76D74A85D872D, 0x4E98E508BB45C, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x78D47041B5147, 0x00000078FBC07, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x1CA75DF9818C5, 0x00000035673A0, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x1365B2C3C6E0C, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x7712CB0552322, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x53A50BFAA9D2E, 0x555ED358FBB25, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x6E3C907419F7A, 0x3FF3CE4E85002, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x73C4E9CC7EE73, 0x39E0E5D1065D1, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x1DACDBBDE537D, 0x37D3AF16FAC94, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x2FA1B84660241, 0x34E1ABDA840CA, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x5D65D7B05ED39, 0x34D17F8FE3295, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x2A8C9111BA05C, 0x00000066C7814, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x18054443D7885, 0x000000380872E, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x338159000633B, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x04F4ACB5AE0BA, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x5F30F2CC38AF5, 0x1E7692D684AFC, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x20C8C24A0F24B, 0x4F3482CAAF3FA, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x7BB77B4550AF0, 0x2C9300E73E767, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x42CBB25B19C69, 0x4872307A39E09, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x40DC50C1B993A, 0x5E363EFB9B7C4, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x07BB545915F26, 0x166444792C3B0, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x6F93E1D023DE2, 0x0000005A50BC2, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x65B22C64C8794, 0x0000003FBBFE3, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x3C5BBC57DC5E2, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x7D12A52DB71C8, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x5F5FE1BD08244, 0x19CC47B1E4C3B, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x6A068B7CA499C, 0x090F9AEB39364, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x47734D8CEA23D, 0x021B9A7F0A04F, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x3626BF0E2EECB, 0x2363C3D1ECB87, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x02CE3BF06F9B6, 0x4BD5F04423953, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x1993E463C0DCE, 0x08CB58EC5A2A2, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x411FC4A633A85, 0x0000006D6D0D2, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x352EB553AF6AC, 0x00000039BF51A, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x14B30F07E1FD3, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x785F55CDCAC04, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x5701F5A290E0A, 0x70D9D76DFAD8F, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x2CD12FEBEC132, 0x792432F6F3773, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x01242DE5A8577, 0x50FEF60CFE081, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x4AC59BBBE99FE, 0x70FD997366DC0, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x33492D0DF2181, 0x049A5DF25BED5, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x642B56CBDDD09, 0x3EFE96970C946, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x5898F96572C60, 0x0000006A804AE, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x634FB773C4D4C, 0x00000043F0A60, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x0298C3328FC2F, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x46536F73AF70F, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x7121FC94940AF, 0x034D5DD4EFE47, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x6AE17DD878FF3, 0x78B1A57828828, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x1084262FAC839, 0x1D5D2F38B8F97, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x54633AC0840D5, 0x0A4BB351DEA6C, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x4B69A322DB67C, 0x5C853C8D2ED38, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x04B046B6B9046, 0x2125AC3D3BEAA, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x78B791E9E606D, 0x00000051BEF4D, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x1B1D652DFD3E0, 0x0000003B64892, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x35D93E85D349F, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x35B0A7473D34B, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x2712B8B6A77EB, 0x1A21B66624DD2, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x29978959C758F, 0x1EC661D73ADD1, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x0AE07826CEF06, 0x2811D2F9CF539, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x54ADE82935F47, 0x07414FE8DEEEC, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x69710B6B3B770, 0x681CFF39E2410, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x3DD4358C8B8AE, 0x70B4C7403D08B, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x67E9A47B50C46, 0x0000006CCEEE7, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x10A9D995AF215, 0x0000004F8290B, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x00C2CDA0835D5, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x2DF096E2CD41E, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x4950F5776D6B5, 0x3E9DC8840D44C, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x669CF69F9F197, 0x22017253A551C, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x466A6929F2C75, 0x2BD3FE3AD0A32, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x484C01D9895D0, 0x1FA752FC45E63, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x1A44FCC3D7439, 0x2FB199B18D1A2, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x6076A98CC2325, 0x61E5A5367C164, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x0EC98BD5DC612, 0x00000066A662B, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x735A5750CABD0, 0x0000005A65276, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x7FDF33F9CAA1E, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x092F05C9A9D78, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x23A361D55B5F2, 0x597B5F055FCAA, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x3DE3A2B5B7084, 0x3E3BAECBF4A36, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x4F173B3250DAD, 0x2D8534BC05750, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x319B4E18B955D, 0x5276CFB8E2B4B, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x48B783A237273, 0x69CD6844A5D40, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x23D5D5102BBCB, 0x53CC0568B655E, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x03F53DB1FC99A, 0x00000060431F2, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x10718B4401786, 0x00000056FD952, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x409AAEC7E2533, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x49A468464D84F, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x59B9C109BAADD, 0x23BFD25E50D2A, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x057E7547FB775, 0x3BAF4664A2C2A, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x02191E733FA71, 0x2072015854C31, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x424E95169C3E6, 0x5967B15A7FFB5, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x39B5A80AC942D, 0x64C3C223ECFB9, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x535D6F597A66F, 0x790951BE7EC95, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x0369F8CD8D39F, 0x0000006EACFC7, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x60B2E4A5D444A, 0x0000002A22057, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x05BBAA9503499, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x0123FD8439B9C, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x69823942A1A55, 0x008397D2BDDF1, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x48A046CE2B16B, 0x7023FFE967E92, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x0DCF3865FCFCF, 0x33B9B1B0E1AAC, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x480A0A241FDD7, 0x706813D41AC86, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x53B9F9C63DB45, 0x30F45758569C3, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x4E49E25D27FFE, 0x2035F989099B9, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x4C80D0FA89A5D, 0x0000006D43F57, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x01159F47E31E9, 0x0000003DF2286, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x128D0CB4141B7, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x0508FA7BA8183, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x28785C43ED0F8, 0x6327450B1D469, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x1AB5821864724, 0x0C5BFFAB44290, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x594457F8E75A3, 0x1870D7D7AEC37, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x7F2BC02FA62EE, 0x550951680C7B7, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x7E574A4EF689B, 0x0040A88221249, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x0E6D31B2B1150, 0x6A8F23402E640, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x2EC13FE27C649, 0x0000006FD2068, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x2145D554DF6A1, 0x0000003C60800, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x6D1BCE09CAD8F, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x27964C38AA731, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x0B8807B5E7C02, 0x37745BC2E0519, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x2AA88FA68C23E, 0x27A4E6E1B5253, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x4A79DD905F887, 0x4534990F63CA0, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x72AD7014E18A4, 0x1B12246885BC2, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x5658BECF16652, 0x55C4F4933CFE7, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x692A057F26ADB, 0x3F20153A8B594, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x00F970BD5166F, 0x0000007F5894F, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x70ACEB953DE6A, 0x0000003C21A8D, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x6C98BFD47C6A4, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x7ACEC9C440786, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x0D219535FD473, 0x592ACB00ABA70, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x34661E96F3391, 0x07372C852F3A0, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x7D6B0B6BD8708, 0x200651D2A02E3, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x66D5C902D34B5, 0x71DE8986D5F87, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x0D38CA1205846, 0x417A6FD1AA4A8, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x626FF3627619A, 0x63AAF73226F01, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x772A08F038F67, 0x0000006AFF24A, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x0E97AF44A17D6, 0x00000025B27DB, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x0669841FDDA06, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x4EF9C2134EE93, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x41810F799E384, 0x2441351D8388B, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x4FCEEE826C23E, 0x78F2C49605BAD, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x4C269BB6ABC3B, 0x1FDDF11C80D3F, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x1C2CAC4CCF910, 0x74B0D84350F11, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x33B739DD3EBB4, 0x4673EC19C2A6B, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x4BF9CE50AAEC1, 0x1F5AE9A702F53, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x78FB1D9B83C37, 0x00000069C3E6F, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x4BF5E2DE2D506, 0x000000455BA7F, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x35AF5543EC1A4, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x74FE7B9045E4C, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x1E713957E43EF, 0x56F37D67BDC5A, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x52464FB155DEF, 0x3F7D96E128C59, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x6ADBE7E271C4D, 0x41C41E9E36D75, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x329F771919C86, 0x2A93A5783AD01, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x436B13554C952, 0x26D2ADD0E0131, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x7F13B9FA74BD7, 0x2508E00DB4CC3, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x2ACFA1E215D2B, 0x0000005BC8341, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x1FBE651A282FE, 0x0000004AAE154, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x0A026A80077B0, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x4A2B1000B9823, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x482D4F561CC37, 0x2E9FFE4808EE0, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x1763AC1807407, 0x34C112621D91D, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x0D928C5825BBD, 0x624719E62E451, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x69307DBAC5FE6, 0x46C978C1A29DA, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x56AEA36DFDD3E, 0x47040C92659C1, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x54EBC6DB11F1D, 0x38A8F56037A1F, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x6820DF71AFD92, 0x0000007E95875, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x69107979A78A8, 0x0000005264831, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x64CC426576DEB, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x3238CAAE8878B, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x0A19EE1986A5A, 0x009D794A1A809, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x52E33CB0439C4, 0x66EABEFCA4E11, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x49CB22D3625A5, 0x07751435560B7, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x078C03F25668D, 0x2087F2137284E, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x70144A9E8266E, 0x45DCACA0C218B, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x7AFE8ED924964, 0x1ABF794F9875E, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x3D27749E80BE8, 0x000000517DC4A, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x6D767D691790D, 0x0000004E47FF2, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x454CB880D7C6B, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x064EA27B3AB99, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x7FC9BEF5D6C6E, 0x70B36D260E779, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x2A3CC3078753A, 0x56AC25DA75DCF, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x0A986C6357997, 0x1FAE4882C2E37, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x1C7BF1EA981E4, 0x05E888078B345, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x7D4A799C1C3B8, 0x0DFCAC0597BE1, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x20926AEBA99AB, 0x6DC8785A69EB2, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x2EB7BCA9B3D9B, 0x0000006B330AD, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x71CEE2DE4A2C7, 0x000000400E181, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x0BFBC15FF88A3, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x7D65241D212CA, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x08070D2386576, 0x473FB8D7832E7, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x450B3C73CE73A, 0x214A02E04BD2F, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x21844391C733F, 0x174059FB7A803, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x518C81B883E40, 0x2C837925EFFC2, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x047B5DB9DC8C0, 0x467E6D21FEDE9, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x1B30057851268, 0x4A6A26B7C04D9, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x6F24FF9D7C16C, 0x0000004AF541B, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x0785B6C15F962, 0x00000046B4E4E, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x54AAA7101529E, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x3E3BF28F435CF, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x57285F320AFFD, 0x2AC1086DB9501, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x012731C4AA217, 0x1E46E1DF9FBCC, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x1234B4F12760F, 0x4D8B16EDDAB6F, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x6713422AAA7BF, 0x38B9DBEBE6A7A, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x564034277EA73, 0x2830BB07F7E8F, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x1374AEBD33375, 0x7BBED0A29C609, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x70D3B006776D9, 0x0000007B92F94, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x6BF510BD17C26, 0x00000047E6056, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x224D5BD8E839C, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x13650EEB92269, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x132DEAC1E74A1, 0x39680291CAD29, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x4579B4B350DD7, 0x795FF974D306B, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x3654136F3ADF7, 0x5B671A428B56B, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x1D0A4C6818C35, 0x4422033F6B83C, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x18CDDD2E769C1, 0x414C870CF6BD8, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x670E91AE6157D, 0x3C24A90966F41, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x3E2AA245A9EBE, 0x00000069F3C8C, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x2AAEAA1602CE1, 0x00000035421A3, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x6BAE164707B26, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x777089B81789E, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x7681D9308795E, 0x5A5A0DC751E6E, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x3A0F9EAD87D4E, 0x74173D8F98928, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x50332EB2D4F88, 0x03BBF5D676AED, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x75E259DFEAC54, 0x0A1DC1ED8DC6A, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x39472D8B0A722, 0x72350CA88BA9D, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x574F60347F0CB, 0x3F6F82DCC6A50, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x69589A9B0E717, 0x00000059381DF, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x40899C4EA06A6, 0x0000004D79B48, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x2DAA42E19B20E, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x4047367D4779C, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x0D91D94322CDD, 0x136C852B39150, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x665A94C561167, 0x187247CBB3438, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x676EA973ADDA3, 0x5C9B4E5677AAC, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x64124C1CED7C6, 0x788E2975D8CF0, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x4578C78746FC0, 0x738B33832B08B, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x18EA30EE522F8, 0x5A158A97C9287, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x4A5B9095CFCAF, 0x0000006928E7E, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x78FF364A977E6, 0x0000003C31C49, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x6E4A81DC30D04, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x57D6AAE189819, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x0435498D09602, 0x155E54A6506DF, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x3A0EFCAF1ADDE, 0x374125D1AE10A, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x635EDC92A84B6, 0x50FD45CBA9808, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x589194FF2D807, 0x53C0FA1C4325E, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x368E41ED5BB07, 0x1C05AC82CFAC8, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x2ACCF3FDB8A28, 0x7540BD8DDCFA4, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x21EB42C815B27, 0x0000006DB735D, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x285AB8511A802, 0x0000004F2B047, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x3B5682A348B6F, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x6EF4AA8CE55E6, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x6958D43E94520, 0x3ED294AC8D2C3, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x6A003B7DFBCA8, 0x3175413F2CE58, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x6C936C46A8A00, 0x02BCAB41674D0, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x4AC2544821CCF, 0x0F72D4AE1C0DB, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x624022E65619A, 0x78B2853015CA5, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x662E470A425C2, 0x0ACC04B59038E, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x5F8FBA78E951C, 0x0000005FC4445, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x10B5FA1343255, 0x00000030A6B84, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x159B513DE5CC8, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x37D31E0991AB2, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x1A9B75A056C64, 0x22D6A1C90A0A9, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x7D1B614D8BFE6, 0x541625FCF2BDA, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x11A2526774986, 0x73EF9A501C85A, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x316B6D27992AF, 0x2C9C6E7D944DA, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x343D2B3F6284A, 0x14CC67D2141B7, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x32520864EE733, 0x6DA308E85722C, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x7CEB8CF8EB95E, 0x00000054D0B58, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x27E4C3EBC1B11, 0x0000004EA3F6D, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x7BED84BFD65DB, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x3B06D3183DE20, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x4E38D75D71851, 0x62656184A2111, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x40E756CC99FE5, 0x794BEB30D03E0, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x548EC95105920, 0x66AF4DA6B4DC3, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x303B657420F9B, 0x36956AC590850, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x07EAB40021F2F, 0x4123B2F302570, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x07D0E99E7F793, 0x3872751F74A05, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x20CA1B2F2FA89, 0x00000081C7DF8, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x6005F702EBBFC, 0x000000469D9CE, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x7E1A591B2F20D, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x0A9D3017E9379, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x20EB5A11ACA13, 0x6AF30098FB043, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x1128B5F2F7C05, 0x72D5DD708338C, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x33E0C6D446B08, 0x7E66E337CCEC0, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x185C57AD254C9, 0x691354CDF0AA6, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x5CA4BE4EC5419, 0x2058AA2639882, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x6611A9FD3C36B, 0x2FE51F70F080D, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x264DF559927B8, 0x0000005331619, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x2BF505B85CBD7, 0x0000003E780E0, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x062EA923F7FDF, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x0A37CB8657B0D, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x7BA5D37CD171F, 0x65029FBBD36D0, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x04437707ABDC7, 0x664F71FF86DBD, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x6F62BF2CD7571, 0x55708E41A88CE, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x600A0C44A1039, 0x6E1CC2394ABE1, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x33819B36EEC61, 0x2EB885C6A907C, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x6A565BCA6BC45, 0x633C11901A970, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x49F9B461ACEA3, 0x0000006C41A78, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x35EDF4B9A2BBE, 0x0000005C48071, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x2BA91AB2B3AF0, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x289F88CDFB347, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x44817D21F402A, 0x5E709D35D5633, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x46ECD9A59086A, 0x67315C638258D, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x037125CC000B6, 0x727BFA019013D, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x38F03426ED6C2, 0x53CD5493C7DE0, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x76F322FF787D3, 0x29D29510BF50A, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x2437F1C35E215, 0x05436D93E3703, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x40D434A768929, 0x00000067689D6, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x22C01A505C26F, 0x000000424BD35, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x76DCCDA2E529C, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x35C6007AE46F8, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x13FDCAD694DDB, 0x02C02CDF981F6, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x442F6D709E8F3, 0x29164200D9C27, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x346FA381BC6F1, 0x4DD3F6D0939B9, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x2378ACD2C31E1, 0x53AB113B07331, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x1EF00F4099842, 0x59357287D4633, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x41121A13160CB, 0x220CC06B15042, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x0F42E1D1ABB80, 0x000000658B89D, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x6C4D865D9F5C9, 0x0000006288461, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x721CE41B19B2C, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x58F77614B280A, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x5EB438BA1F378, 0x64CC75D6F48B4, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x777B50B3E4BC4, 0x08CC8D51A9EA7, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x244E974FD3E33, 0x129A61426306F, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x5BB2160CC0E01, 0x4E606A1A19068, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x2AF18CF97435C, 0x08A2CD297FB63, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x720D0053A2BFD, 0x5EADD361C4F68, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x3D2F3E4EEAE7C, 0x0000006ACD2D8, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x3210A029F9ADA, 0x0000003CB72E2, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x20B2E0BA8FD82, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x3FBE33701F362, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x551E27C99DC9C, 0x38E552346A16D, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x31772F00E4FA6, 0x1530F1FCB6133, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x78B347B68C35A, 0x0ABF8BD3E75AB, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x0E80974C43BE0, 0x1998190E56950, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x0612AA6C4F3EC, 0x2186769097F29, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x2E432D676A87E, 0x7927245D3BFE9, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x7C331DEDD7149, 0x0000004C085AB, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x31700137F3333, 0x000000458276A, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x4A2CB5CBF6D2B, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x69AFFC45647F3, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x0638EB8F009E9, 0x11600CED79736, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x708EF3B7070F9, 0x41D4981F05535, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x6DE1D65FA2FD6, 0x20340515F2A30, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x6717A3E76F607, 0x3FEC61F610A36, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x2CE480CA37CCE, 0x302038EC930C0, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x020323BDD4814, 0x1EDC5C7EBE6F2, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x2B7038A8F4B09, 0x000000782678D, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x7FBC90CA4DA9B, 0x0000003A02E7E, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x27A25DB5926CE, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x2DF03D0318558, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x7D8F1379D76D9, 0x6C8F16CFB7577, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x63C80C42AE7E3, 0x6C6331491E9E0, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x0994EC6301F27, 0x707D4628C716D, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x1AD36D715C75B, 0x0691C9A0B4B5F, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x1F82775E49270, 0x56A915DE02686, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x41305DD1A8FCB, 0x3599EAE0C9CC9, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x2157182CC502A, 0x0000006B8BC3E, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x5684DF638E7C4, 0x0000005427E76, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x3ED8F109727B5, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x197C47FAE22EF, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x182E4DDBD51FF, 0x7B47E3A01FB68, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x17D1FB4122F85, 0x00AF8D2E5D003, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x68A5984C1958B, 0x7ECFE25FE9A2F, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x58941B185B2DD, 0x5706B86754A62, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x136CEA5E16E8C, 0x553F26900BA70, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x308ED5A5346E8, 0x691DCB1508790, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x0AC77C4B9EB2B, 0x0000006A119B0, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x4C3D9841F7CEF, 0x0000004AC98DA, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x18D9A5C24C8F4, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x2529CD6DA153F, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x75FCB8D4E8DCC, 0x5F272A22012DD, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x34391BC64C3F6, 0x307DB53D25018, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x1444B7C863CFA, 0x44F3092D5D83A, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x1EA475E3B589D, 0x3CC029A5BBDCE, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x229CFB87F3150, 0x33AB4265AD8E6, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x03DB827ACA6FB, 0x224B4E3487A98, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x3EFB0A826AF30, 0x0000006130C4C, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x4C8DB6C97950C, 0x0000005BE8BE7, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x2D18ECFD68B17, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x5A986D19CD5F3, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x11185F6A70548, 0x40647CDCD062C, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x29EC9076EFE22, 0x125AF228BB6C1, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x579C58543F2D3, 0x56E1FE81ECC85, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x017411B6AF4E2, 0x1339D9AB992EF, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x3FC3BC5AACB1D, 0x647E7356D2120, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x0E89C5098BEC3, 0x7B2C421DD555B, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x34C6E50D0DBF0, 0x000000724DF6F, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x73A80357B5423, 0x0000003C32807, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x77CC16A825D50, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x032572881F499, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x79836F04FCFDA, 0x2756FF7CEBBAD, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x2809197D98236, 0x7471C6BA9A2B2, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x0DD38D94D727E, 0x1588B36974215, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x3601695C1D0BA, 0x63864A7A6FE39, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x46CA9501BFCA8, 0x6F5F040EF4B4E, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x6058DB4DC3488, 0x02D04CB914FD1, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x79F9EF867CAD6, 0x0000005D58922, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x6B5ED6C5188E5, 0x0000004C447E0, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x71B0FE8223F45, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x6B542F2044296, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x197C15D941C7E, 0x44D97358CB433, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x26F480F5FB35E, 0x5C58D29A89ACF, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x44B02BBF34733, 0x534E6D705B9E8, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x320700804C4CD, 0x69E1D8E3945E5, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x2B12F1D166B42, 0x08515022BDB11, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x50C56F151AA70, 0x6DB6B83C18D06, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x3085C6E431D05, 0x0000005FF3A08, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x577AB4D42961C, 0x0000004C5FF82, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x598E346C393AF, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x1E0D98586BB02, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x66776648EF81E, 0x429CC77CFF0BA, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x2A6E8D852B0C2, 0x331A9A51F25BA, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x3B4CE18117F03, 0x3797DA9CDEE18, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x071D84853CF79, 0x4FBBA78D091E3, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x30CF4CCCFBB3C, 0x3D2443EDD7FBE, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x73C68EB1F1027, 0x1950EEAE91EEB, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x137218D8AB47B, 0x000000861D258, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x15FBDCCCB7445, 0x00000046F7335, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x54F9EC99CCC3C, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x68A8653A100F7, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x0974E27FC8FBB, 0x5BA9755462771, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x5C3ADBA088D9D, 0x56C268D3206F9, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x728A653FBACE6, 0x71019C95BD46C, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x19791ED4553AE, 0x050B88F5C3978, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x7E0B79D875D62, 0x278072E5D80FF, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x35789E0DF7D15, 0x273E3D96A632F, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x14136F0C0B685, 0x00000066AB130, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x3EC6030900794, 0x00000064D9C14, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x2F8355C30A475, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x4D5D83E82C205, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x478BD9788BC78, 0x44A3346FE4A26, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x6C9C227FEEC88, 0x6007D9C6B5635, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x197D0CDF5AE03, 0x59D754346A86A, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x36B8E114F8A71, 0x160B0EA925EF1, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x69817F1DB2F6C, 0x5B47FDB162C3C, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x245FCC3BBC5F0, 0x734CB1DD5311F, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x1669C87384F13, 0x0000007A37337, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x70892E20B69D7, 0x00000056626E5, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x16D8BAB5812A3, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x11DF05CDC093D, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x314C8FBE6C65C, 0x3F5A4F1D9404B, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x12858EB231C48, 0x7F456E7451873, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x4D410ED25F822, 0x641FB7955792B, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x70CA1992D23AF, 0x5E24B0B4DFC00, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x5C98EC3A8B3F8, 0x02AF23E2E74A2, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x1A9F365247C33, 0x086869A0B5365, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x6B1D1F12B0284, 0x0000006E331A4, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x7697557EBE967, 0x0000002C719E9, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x7DAB935F4C1F4, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x37A49D5794AEC, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x798C50CE336D3, 0x1756FA07648C8, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x0048E808CDB09, 0x3C8245C956141, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x1628B4BDD05AA, 0x659C0BF677900, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x23A85FA00E4F3, 0x22F57946ACBAC, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x0A5C235557461, 0x18CC65425FFC6, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x07386CC7232A5, 0x2294F3B187027, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x3825A9915A59F, 0x0000006F52E77, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x23964BBD1F027, 0x0000004801D76, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x6715E3E22FEB0, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x367C9E5E02C67, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x2856BDCB85D41, 0x3185F0415D764, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x0CD302CFE7F07, 0x36DD03C2D7DB6, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x737DB6D436378, 0x5F721375E6465, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x0DDAFA08A078C, 0x3766663646BED, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x0F1074C812063, 0x33A880CC2BB0D, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x1321AA441453D, 0x6E3AD1F4EC55A, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x1F64128AE10E4, 0x0000006AFA87B, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x273F7BBA3D69A, 0x00000029EA438, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x65CEBCC69F49D, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x7BA32636CE790, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x3C782AED8F32C, 0x5C2D7144F8A87, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x29D7F22BFD75A, 0x6046918B01767, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x7513D06060BB9, 0x2140D2AFC1C20, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x35CA203347D10, 0x3F46E417484C9, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x249382A538E4D, 0x24217BDFE41B7, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x526F3141169F0, 0x7F8432DF591FA, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x6A52C6D95D349, 0x0000005B56DB9, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x591E3E7B5195D, 0x000000430BB52, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x3D959C8916315, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x59F707C412670, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x69B251FD2DE41, 0x041161236DBFD, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x2BFBC7C64AA3B, 0x6843299667A07, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x289D76FC6B326, 0x0CC8C928C2C50, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x30E72FB5BF79C, 0x0CBAD45E31FC3, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x1D67637E43DDE, 0x3B96A063C5450, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x79402C04509A9, 0x3EB7FFEF339D4, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x6AB2DF70F5101, 0x0000005C4CC25, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x1AE7CED07FFF3, 0x0000003121C73, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x5302BA69366E1, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x1BDA78325E349, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x41B48B43CCA41, 0x201290EA2F3A3, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x3008759DA570B, 0x1C0CB52C895A8, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x56975B1703A54, 0x2D1BBF878D504, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x047ADC187F594, 0x261FE1B2C3B07, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x19853999AD05E, 0x3DC4B308DD002, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x1B80B61A2BC08, 0x0D73EE5719FB2, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x18509D92E465C, 0x000000505E4D8, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x61F02D4D6A82C, 0x000000429A494, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x785132581515D, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x3B54997E7199E, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x41C6F5ACD043E, 0x655A3CBC1F85D, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x5E9879292A4AA, 0x0887DED621239, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x43E2A0745A9F8, 0x79AC528F29BEA, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x6BA5B669B42FA, 0x2789F07E4E001, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x3D11230B67A28, 0x02B596898D48A, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x6702D374A9FFF, 0x2129FC02AF496, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x3FCBBDDAE902F, 0x0000006B878BB, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x6866C5F587670, 0x000000421FB3E, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x76DC98F004A53, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x4AEDF8615FB38, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x04AED91974B95, 0x19B0CD460ADE8, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x44FC532D69295, 0x42FB970EFFE20, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x7EF5F256A1561, 0x261B5B3F6DAF5, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x648852BC47F61, 0x10497BE5BC5FA, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x3DF4DC34D0F34, 0x38717139E184B, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x7AA1057028BD8, 0x5596F5E76563D, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x09EFBB3F30058, 0x0000007A960AF, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x568359A3A420B, 0x0000003FC5B62, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x2CFC7F63CDA73, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x797C8661D6B43, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x5DE8082B0C368, 0x5598E84DCB985, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x64D27A688BC00, 0x310970D447320, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x2F8B31FADA50C, 0x4E10004A663CD, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x218F4A8C9DC64, 0x5D573D94418D9, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x488F1AD4C46C5, 0x7EF5075834946, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x124D16DB4D08F, 0x51094FFAF87A7, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x1B83D5C960A8D, 0x0000005E27834, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x42F26993C2CBF, 0x0000005B2473E, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x23D668C921A38, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x546BFEFAB00A3, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x459BB750922D5, 0x4A62DDBD74378, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x66E633D517E0F, 0x2615675E13296, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x7D9515E4DD61F, 0x57AC2B2B696B3, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x713D75170B500, 0x76D4D3DB11D3E, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x1C977257FE06C, 0x24479C5C2DA45, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x331281035FFA5, 0x2300C1D06D7CB, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x46F439F3AFCDA, 0x0000007405CB0, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x5A6CE0E6AB7A7, 0x0000005D146C6, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x00FD2E1165307, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x17BAFB8F49168, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x09066B47B84E6, 0x10EE13B9CF6D5, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x1EEB6B479AE74, 0x662B1A8A1A4A7, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x4D98C0201E96F, 0x3B5132C56B7C4, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x7D1A77F90E278, 0x3D8E4CF138771, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x4163A161E983B, 0x57146B599F5DF, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x64F904982B4E3, 0x604AF839AAC7C, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x2465E386E4815, 0x00000078AE680, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x07A02CB4C7BB7, 0x00000038D0A17, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x30173D3F44977, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x291B98242C974, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x3BC075AF0C5CE, 0x3316D11926116, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x555548259F3FE, 0x34EFA6725AA50, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x0694E2177484C, 0x7572E3B871CAC, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x2A78D5F6E21B4, 0x4F6F1075640B3, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x0C33542C38E69, 0x1AD548372AB8D, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x7F4537CEBBE6A, 0x7B48DE896B677, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x756B2EA3F9302, 0x00000073486F1, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x494344A6B15FB, 0x0000002D9DF0E, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x465F25AB86D9A, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x0418CF22F74E6, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x374C4AE70C297, 0x56DB7294474B5, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x4BDC3FB5947E5, 0x6F7AA0193E9E9, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x6EA6F5011E268, 0x5A28D12212696, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x29CCAE2FD2EBD, 0x62EEA74B4D479, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x7FDB8B50DECDE, 0x43A3E5E6EC685, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x5BB1C4C0CBDE0, 0x3B34EDA7CE96C, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x4D01681D57515, 0x0000005F8E147, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x2357747112209, 0x00000052A12FE, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x2E107D5C4F597, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x02786F319EE84, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x7394024CE091B, 0x33C351B4BC310, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x2EC4426C06855, 0x57B091FF8C7A8, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x3DCE9E88D780E, 0x4F2047781BB52, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x767EF2A2230CB, 0x5C47237269037, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x4E63944F364A5, 0x618D55E3A45AA, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x21CBA6492A870, 0x47D5838ADACF2, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x0B16364D25754, 0x00000087FC8DF, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x5A4187F22BCA1, 0x0000004A98555, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x0CBF0368CD7DA, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x7FA190AE93AF7, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x755EFB9C0BCBB, 0x31F7805366FC4, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x36E4293591DC5, 0x710BF62431B99, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x4B71501C1425F, 0x046E81BBFA021, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x179D493FC31C0, 0x77D3BB632A3C1, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x73A6F62A3D2A9, 0x18A73A538C15A, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x5EDEF313EC341, 0x588D159EBB506, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x4FC31F6123A7B, 0x0000005F08030, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x010AE473D7187, 0x000000376C823, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x6E53A5F108754, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x1B98F5DBEDF9D, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x139EF8D4EBF8E, 0x1CD0692026223, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x6568C2BED1A8A, 0x7039DD8FCD537, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x6501BCFD1954F, 0x7B73577BD7A22, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x535C02F96052D, 0x0F02CBDB23813, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x37642765AC39C, 0x6B414F9470ECE, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x2BE256D46C12B, 0x4DD286596DD92, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x22F93EC2766A5, 0x0000007B93CFB, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x128F75ECA46EB, 0x000000568E7A4, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x45B26626B48DA, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x328E3332A302A, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x3545D702D656D, 0x576E0A35D3FC7, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x25331A374105F, 0x59F2D5675A8DD, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x404C26468E709, 0x2C0D190379249, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x35E001C466E6C, 0x1291A92F62FC0, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x038234FFB6DA7, 0x5C7B756174FBC, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x54E71CC6EA630, 0x3A71AE2E7B5CA, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x5D0579003EF73, 0x000000688A038, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x254463260FDB8, 0x0000005D59FCC, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x4DDFF86E41EDA, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x2A496BD4243F3, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x25F5B117366C2, 0x555B83F2807D5, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x5C5EAE2FD75FE, 0x4D6A59A1050CC, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x279246A87D40D, 0x70D5D11DE5235, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x3F9126FE30DA4, 0x586DA458E4B2F, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x40CCA9CB3283E, 0x3B48667CB9B1E, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x3354AE165E491, 0x3C921CC6985FC, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x18971041A2245, 0x00000061DBE0F, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x256F1B9E71A2A, 0x00000056B87F8, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x4A0633A469496, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x0BBFFB89A4F28, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x57B5B962233E7, 0x51B1E00C604CD, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x156183AA2CA53, 0x757DD4228E04E, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x4794401892946, 0x67F4CDC0D0594, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x4504F2A9732D7, 0x68C5A0235851C, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x2C3C6465A68B1, 0x55627D9EE9C8E, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x6AA79EC6B518D, 0x78879374CBCE0, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x4903FE61F3209, 0x0000006037C2E, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x7A93194C887D3, 0x0000005CA96F4, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x6DEBDA8CFA897, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x0B508F2BD3DA5, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x2B32726008F64, 0x45241E2DB105B, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x24691A4F72AFA, 0x4BE25B89D2FB1, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x2689B7A71F5BB, 0x6041EBD9C4DBC, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x5B5CE0AAFD762, 0x73A7E2C514578, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x009A2B34D7C79, 0x7E23136E95330, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x7AE750220C997, 0x7EA0B5E2A3521, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x5EF86928DD2D2, 0x0000007F907FF, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x2C8BAA693966A, 0x0000005327692, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x580A5DAEC3AC1, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x085304BA5701C, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x338DF204C34D3, 0x3F52AE770550E, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x04D1671145B7B, 0x5F6BBB91B7A67, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x66608C2B02F9F, 0x04FAAA0BFD53B, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x31202F964B086, 0x080DE2D8E686B, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x39F918251D29B, 0x3D6E6343BEF25, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x3F9D06A6330A0, 0x4659AF20B9A4B, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x569A005B222F8, 0x00000076183D8, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x3D4A4F6EA011F, 0x0000003B4A011, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x28D3685E671B9, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x58E0A2955B0A4, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x0EBE8F8992739, 0x29AE6996D5544, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x6F14A9D94BF5B, 0x7C17D45D46681, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x27A767A6DF132, 0x2F68A55BC7FA2, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x758451C9AEFF0, 0x0BC00950AC1EB, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x768FA0C5651CB, 0x1B964C8FD6E7C, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x3889683953168, 0x6F9589ACF18BF, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x5B0A80627B805, 0x0000006A87B7F, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x27D79EBB0A107, 0x0000003B89C02, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x2506F8127F56C, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x7490334131165, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x57E817F8D6D92, 0x6958213A290C2, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x11A95288F323E, 0x39A7928FB5DA8, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x07BB6723605A9, 0x7D41EEDD6D0CF, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x29BF61E26AFAB, 0x42A77F69665F8, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x67B0EDB7F3020, 0x335214AB93BD6, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x5401EF9BAE3F1, 0x58CB34FFA2550, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x2E2D53F7BC0BB, 0x0000006474411, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x110F2C6BB2511, 0x0000004878DBA, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x3A4D389442EA6, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x26087A3C19166, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x0CA156BAC7AE6, 0x5F9FB4AAEE75A, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x11590B379A5E2, 0x6CA2AC1EC4493, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x3C577EEFE9D1E, 0x3644BCDFFF0C8, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x3FEE72F359E3F, 0x1551A9573435F, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x4CA09EABE965C, 0x7E07D5D4FFAC5, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x6BCD56E7B873F, 0x0946CC5A92A96, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x0D6455AC07B24, 0x0000006159A99, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x41A3DA1B000B2, 0x0000006034797, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x5A64739F57128, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x6FFB68C7BC5CE, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x7CAB1FE520FE5, 0x15ACBA4FDC767, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x0451F370DB661, 0x26C2D487CF1D0, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x6829FD5F1D41B, 0x2866218B3C1FA, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x14C7BA58F501C, 0x7EF6AA873D28C, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x77A5645F2DF91, 0x32E883A32BE9A, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x2D6BA6BAB5F6E, 0x764F7ED55E968, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x730C6CC72DB66, 0x000000776B573, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x30665967CF494, 0x0000005440416, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x33F702710570E, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x36341F8BC9144, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x3C43D378E3ACC, 0x09EC7296CD470, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x05ECDB37C7DD6, 0x137B91A0291DD, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x79B5A95F07F4B, 0x27AED0E6854C5, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x4F5D5BACF0061, 0x4377FBF865CAC, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x734972DB85589, 0x51437CCFBB2D4, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x095D8D86A30FB, 0x4B0723B91D779, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x2CC6774447A6E, 0x0000006E3FC8F, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x2CF235CEF27AC, 0x00000062B4971, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x5343EE12C1529, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x0D628182BAAF3, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x7AF89418D1FC5, 0x7111F29348BA1, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x6C4F97A871035, 0x7F5295571604F, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x4C0CA8266CB11, 0x17FD6AA27581D, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x10EDA89F47B96, 0x473520C93D675, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x7783E14C300AC, 0x24F8365738791, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x0EB0E2DBE72E4, 0x79A39C7B5902A, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x39DFE1C1FF1F9, 0x0000005EB0C89, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x61AC7D8998E18, 0x0000005BCBB0C, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x5C63201039D6E, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x5B874D2B9486A, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x3644C9B9FCF70, 0x7FA29568C4387, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x521BA73DC58E4, 0x7C786F1F1EDDC, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x5413FD733F691, 0x00C1D57457284, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x021BB18E03FC8, 0x6B0F2D1F87F7F, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x59AB84EF2059F, 0x6A2CCB0F55E5E, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x705EA3DEDCEE0, 0x5E58AD90743D6, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x42540E03DC861, 0x000000742E172, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x3CC3D09C63DFE, 0x0000003C98F98, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x6EDC3963430AE, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x46BD28FA8A554, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x7C3A86633BEE4, 0x3DDDFF97A0114, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x324483117A42A, 0x3DA4101F20CE6, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x6365EB5C7001B, 0x635DE695126AD, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x4367707E4FC2D, 0x0A4D547E61456, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x340ACEF92A8CB, 0x4B295036E5082, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x205C4A7FA48E4, 0x221F39114C82A, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x7A5E50D8927E3, 0x000000703054C, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x383A521ED9F27, 0x0000002DE219F, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x09B7229F5A62F, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x73DF9B8E64DDF, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x1C2147DCE6E4C, 0x7EA51489C2F75, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x25EF9181A4722, 0x55393A11546A6, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x1F3D8C4457E84, 0x3FB0A435608FB, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x56C971684831F, 0x02E3E266C6495, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x6FA55F61E413D, 0x5982453F99CCB, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x35B6DCBBBC74B, 0x147FC0E0BF820, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x35B45C21F09B8, 0x00000068C651A, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x199E958932498, 0x0000003F0F222, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x5637EB193DF1E, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x6F400D5AEB91E, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x7617491290729, 0x1A10456DA762D, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x37B1C040B1A6F, 0x24BC0D66B7721, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x00C7935EB3142, 0x184715BAF1C67, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x022D8AE2D0ECD, 0x66DD7A254AF0F, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x3DAA5C3F395EA, 0x20750A3AF06B8, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x465BA34478176, 0x169B8677F945C, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x34E3C52ABF30C, 0x0000007529220, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x12F332C7DFEC0, 0x0000004625953, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x417D6111EA25E, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x29853D5E8E016, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x4795A0D5A67C7, 0x6429EF8A92382, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x6BFA5FFA9847B, 0x5919873010B57, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x40A748BF0036C, 0x57E23097AC0B8, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x1E315E86A99DA, 0x570F7128D724E, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x50AE002BC809C, 0x3C62A3982FF73, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x6B8AA3EF39A3D, 0x286E51C31D231, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x36353E433002B, 0x0000005570BF4, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x78E736C8C174A, 0x0000003D1B88D, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x46915A836630B, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x427DC09ADFE95, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x5333E499C5D3C, 0x3E86F30C5FCB1, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x59B1D666DA952, 0x1C69D6BDD1F9E, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x3BB03322E1647, 0x2E916E2DAC22B, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x714E17DF2039B, 0x0EA55946486C3, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x5021CC42EFC9C, 0x292B28978102D, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x5CBEF0649230B, 0x5AEEDE6123703, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x3DB020E015045, 0x00000064D0B14, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x0FB6845153479, 0x000000489140D, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x42DC15D08BDC4, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x4162931045FE5, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x4D65EECDB01F9, 0x2F1D38990C0AA, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x534EAB97D68FB, 0x2DC1DA51F595E, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x49287DE0D01E7, 0x664D7A428FC3F, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x7AE30F48F131B, 0x7AAF610A3DC86, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x5F1C33529A1BC, 0x4BC36828E30E4, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x2837DDFED75C5, 0x2F867715E8FF5, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x240D0B8D65871, 0x0000007B05659, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x48407A8C1BD14, 0x00000046BA93E, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x1399DF9AA40AC, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x430A2CF8A2823, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x2078D5203A463, 0x2FAA66BBF1168, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x32DDA85DC7CC3, 0x19E1069E0CF42, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x4714CAA93080B, 0x7B4055EF17588, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x77B638A6D5D98, 0x19751AD17224B, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x72C65E6034FE4, 0x0131E401A1C41, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x6234D6CFC3DB3, 0x0A28EED0564CB, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x6AE90D8260DFB, 0x00000072A9797, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x7B5E91BB9A2EE, 0x00000034782B7, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x518496CC713C5, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x5F915408BCB3E, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x5969AF5BDE197, 0x0F3C98453B7B8, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x4E62D11B32BB3, 0x6A3AFDAF8D3A0, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x52A22D934D15A, 0x40F2BB192D061, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x3CFE87989D11E, 0x5B1CF515B6F21, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x659C9850BF2CB, 0x2830E74AC26D8, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x688F0DB744643, 0x5B5FFF30CFB25, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x63BA74EA6D432, 0x0000004FF4CD8, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x185853EA93736, 0x0000003E1C24A, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x1D1CF61BF3F68, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x499248B8C347C, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x2F08BDC4F02BD, 0x6E219134D35E9, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x3661062389BFF, 0x438A2853983F7, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x08959A1EC8E9A, 0x29CD834727DBA, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x2354B1F6DEC15, 0x471B06C773410, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x7D337FEA36080, 0x5AF71BC36624D, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x73028AC77FC33, 0x5D2DED04AD001, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x2B084E1142698, 0x00000057D7FC1, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x18D84DE09E54B, 0x000000499EAF4, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x3BF1F14659AE2, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x24DECDA4E1614, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x73E8DC22D0334, 0x2EFB10B329ECA, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x7EA1EFB459764, 0x20E8DDFDD2135, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x39D511474FB8E, 0x5293A44173EE7, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x4FF04F51E0B12, 0x3280399E3DFEC, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x3EA191BDE61AB, 0x49E75382DB98C, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x66C4E7554AC07, 0x44318EB0D0CF9, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x0340933F1BD78, 0x0000007B4A85E, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x3292ADFE8BDD7, 0x00000040CED04, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x5C0D6C2E98472, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x4EA4CDCAE4884, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x0ACBB18466B2E, 0x342039092ECD2, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x1248543E67AE4, 0x584C57A3A4FEA, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x1894F6486724E, 0x2B30BFE797675, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x42B0978F19331, 0x23B764610BBE9, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x644815D4EA86D, 0x625B0436F7755, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x087D9037B61F6, 0x4A0CE0F7B4A2B, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x2B33C29F4F497, 0x0000004B1BAE5, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x408C9B49B2635, 0x00000048FBDB1, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x5488D5CD5D92A, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x7D8ABD38C6C78, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x501E1B4A5450E, 0x42FEDB3C65DC9, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x17DB090913D26, 0x29388924E0DA5, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x47E0BBE381F89, 0x027D0E965F5A2, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x4385DDC936972, 0x4D5DA4A35671A, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x22D4B5E4C7C34, 0x7493D06265360, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x6EF7B1FC1AE70, 0x649A92B648601, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x65427A2AB9EB5, 0x00000055AC3AF, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x231A0F9B6D2C2, 0x0000004CC8CF8, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x66EF5140B95EA, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x40B75886393AF, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x1C012E02D0A6F, 0x4A27604F014B0, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x5CB2CEDBBF085, 0x766677DCCD116, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x3D36CE039CE32, 0x05F1C9A8A3FF5, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x29E3696CA1272, 0x41326266A7E60, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x3DB391B57D324, 0x289F63B915CDE, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x0FCB714E8BD5E, 0x12D7E43CDDE0C, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x24419F1137F14, 0x00000073685AB, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x547796B499239, 0x0000003D54A1E, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x23770161DC023, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x60976A2CA0188, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x45515DF62C317, 0x03AE4C9598276, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x06AD99C3FC149, 0x5C4E76522BA28, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x23600D28A14F8, 0x577CB72468119, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x06B7A5339F998, 0x0CFF12DCDDFC4, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x05F4181A2264B, 0x5532251330F9F, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x6D30ADD577C46, 0x65994F90D674F, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x26F9D4175EF0B, 0x0000006C0120C, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x0C9D1BEDD2BA8, 0x00000052D1AEE, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x44AC3B742B674, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x0A5BF8B9A01C0, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x46DEC7F715AA4, 0x2C3B667AD4B26, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x47F51BFB39624, 0x2DBBE319CD3FC, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x1121E41603425, 0x1C91D5A7A9C1A, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x2A4219D3ABC97, 0x5EA4F27316CE2, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x3788CCF70B75B, 0x5DE927BFBC816, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x150B66D4EF7F1, 0x2437EA6AF6709, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x024034352A6FB, 0x000000752CACD, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x3C31BF455B03C, 0x0000004C63C3B, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x241F368339081, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x4E969C4376099, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x17A49CC9579E4, 0x2F679B7DF09E8, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x6610EE1BE21F8, 0x2550DC17C80BC, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x4335C2F8941DE, 0x326063CD0228B, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x10F0DC7A028E2, 0x39048FB246F4F, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x2F7E81D65E153, 0x6B14A88F2A7DB, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x3BB47E04898DE, 0x358494B7B6147, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x2A2E0372E202D, 0x000000808F703, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x0B6AD5F213F7C, 0x0000003DDCA60, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x4F3542B5F1464, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x565D823F50FDB, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x7F6ADF4D3806A, 0x233AE831DA8A0, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x75793614B1DF8, 0x608D48631E5B9, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x3B77077BA7FF7, 0x6914A93B4984D, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x01011C538B46E, 0x6FF8DC3DDCD65, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x774E8A1867319, 0x02745C686BC5A, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x6435663418E9E, 0x3DF0DDD70543C, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x581F9DDCD00C2, 0x0000005FE8230, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x323D46B0D0AF0, 0x000000482DF7E, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x6E8D4F5D0432F, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x1B9BB6C29AD69, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x2236CF6F4DEFD, 0x28FAD0D5DB993, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x0EF701984F367, 0x203371C8D7A8B, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x476B0F7632E11, 0x7F226BBD610B0, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x4ACF1C918008A, 0x6E8E1AB3ABD14, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x10FD83CA4CBBB, 0x78931F907F6CC, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x0E5B6DC6C1FF2, 0x603CB1D9EC6AE, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x40ACF74C7C22E, 0x000000724A81C, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x519D13BDD1E0C, 0x00000036255CB, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x0AE2E08C5BCC3, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x44A440BE6F69E, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x73E4AE1FD8BD7, 0x613FD1FBE122B, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x1BFCF67B4C45F, 0x7D4763B5E0695, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x610AE4577339F, 0x5CB611936A9AA, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x3321F8219AD48, 0x78482D2753FF1, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x3F0E22F7C0C07, 0x4368BAB96EF4C, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x345EB81A41DB5, 0x246F50DE6AB41, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x44C2757E74AA8, 0x0000004D45556, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x0C1769CC135DC, 0x000000498850C, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x5B0D1FD995F42, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x4510D6A806735, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x550B8F871580B, 0x3A9FD59ECF109, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x11B0379885503, 0x381E26EAB74D2, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x0998317F28C19, 0x4FA6D264F4C25, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x3186F6495AFD2, 0x2048AE338B821, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x750C96A80740B, 0x41543BCD91424, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x3CB05483B224D, 0x6BC21A069AB0F, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x13297B14A50F3, 0x00000069DD83F, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x53B110165B765, 0x000000293417B, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x5BEF21C74A469, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x7F6080117A245, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x6D6757FB4A12F, 0x6225C03102043, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x7E0D6E3A689B9, 0x113BF3FB48648, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x261C32174EEDB, 0x3F2BE2BD0842B, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x3FB0FC8742E32, 0x069CBB362CFD5, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x5B98A5912881C, 0x31A701F66CE99, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x4757E8979FE54, 0x051A19B73A601, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x4BD2DB5E17907, 0x0000007649DC3, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x17FB773DEB269, 0x00000033CD850, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x488BC4BE5852C, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x12BB1C3A79AEB, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x65B9788A77DB8, 0x09284C57CE763, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x41100A8462ECC, 0x0BA0CA1AEF65A, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x608240DE44C0F, 0x7D0D190CA3E36, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x508BFA4FB0169, 0x30EF90DB3534B, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x018271E932D4B, 0x5B139D429A204, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x489571EBBC402, 0x2628FAFD3523D, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x04E14B68BB202, 0x00000049281FC, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x164E2A9401D64, 0x00000044E4E05, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x159FED73D944A, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x2FE90E3145B14, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x21117DD63891E, 0x11E3C4BA6B7B6, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x3A1C27F0E16EA, 0x4ED25FAEF702A, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x727E10CCABE01, 0x7A04023EA3647, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x09274D12E2883, 0x3A7206EC2792B, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x4FD4783597C57, 0x0E4791C836F30, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x18EF101B3F4B1, 0x1A3E7D5973F13, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x184BBE6880860, 0x0000005D1D277, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x7606F5AA3C2AF, 0x0000004D557D6, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x08101AAB0257F, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x007564CFD6695, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x5B23B1B8FAF75, 0x7C43D77365897, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x32912A20EF8BB, 0x0D80D6646D568, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x43C6194A10A30, 0x73444C07B99CB, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x1AFF0F08170C7, 0x42A25D385613E, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x2B149AFB0C9DE, 0x75DA535E24F29, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x5D0B33727868C, 0x1B4D1A25F69C1, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x40585714946BD, 0x00000053AAE56, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x7AE7D2A8B9551, 0x0000004FCBC25, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x44AB81D523C1C, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x7C73CDB94C62E, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x582C3AD62821A, 0x27BE1555E46C6, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x6F52AFF84E1CA, 0x361701B1B5FDA, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x5B92F5AF6D42B, 0x5B65355F483A1, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x3FF0C9CB9F894, 0x5300F80F253D1, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x0C75321C127F5, 0x5457EF6257B66, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x2F28B9B4C7F71, 0x415B5CE3CE5F4, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x094FF68D3E8FE, 0x0000006CFBB65, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x20ADB8271DE12, 0x0000003E72D3F, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x2B798BB2C3D73, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x752D2EA8A7010, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x52270281DA159, 0x256C775368243, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x5F2D8EC200D9D, 0x10AF51CC1108A, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x3F502D297EF01, 0x2C5460C161246, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x08C759E61EF51, 0x6B921F836B265, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x623883AD79D92, 0x2E1E0B5512333, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x42ACCF8353E44, 0x5D1737F0E58CF, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x1AC4AC9923E65, 0x0000007C072A7, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x3CCA4A4838305, 0x0000003CBF905, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x6D7876C4141E6, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x18C2E179D6D38, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x7A1F90DB8B50B, 0x68904DF37E1C4, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x474184CAFC587, 0x4D00EEF86F3D9, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x6B324908D3656, 0x7F14A4023E971, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x72C5EA9F59C03, 0x0ECC0A16F8780, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x31108A4EA66C1, 0x073106EFD1570, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x3A06EEA458740, 0x6EAA9041D47A5, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x6D0F8E9E384B5, 0x0000004B69F2D, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x73B6149D03E17, 0x00000044FBE05, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x1CB61CF6F0987, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x5DC9F90AC944A, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x2ED424F94900D, 0x37B3F21E93E2D, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x737B7BCBC02FB, 0x16AAC2878740C, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x3A92F37A43266, 0x26C8524F46F5B, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x1CA9FFC784F54, 0x248B848604094, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x0161CE05A8466, 0x7126167D9F039, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x787EDDE46C26E, 0x0AE655B3CDC7F, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x5911673F21FAC, 0x00000076B0520, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x1C401AE5F945B, 0x00000055D0FD0, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x3579D7A3DC2EE, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x628320D92CC68, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x47CA2702C74D0, 0x5C1EAE712A802, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x3EF74A7741094, 0x291162AAFB7F1, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x79C4CA2B2E5F6, 0x120A0410CC25D, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x4E6CFE83B2905, 0x65022E221758F, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x5C72AF108BF9E, 0x2A8E62724289E, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x1896013EF7FAC, 0x65BD3397E9C0A, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x095DCE3C666A8, 0x0000006110BEF, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x2623CC30D0E44, 0x0000003E11AA2, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x13E2492A35D8C, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x54A7159AC148F, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x4034AC85AAEB5, 0x3EE9C7D9C100A, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x063D0BD265A95, 0x2FB852371E586, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x17D95FB498103, 0x7E4BCAFCC7CE5, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x436AA9A501BC6, 0x086426DC3A0FE, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x2363CEE9D6DA2, 0x600367054EEE8, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x0B48214662A97, 0x1B68980CE5EDB, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x08C7390EBFE6B, 0x000000607B8C3, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x0BC55B883EAB3, 0x00000038DFE0A, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x4E4A3A773B2E9, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x5C7E65467D46D, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x5365ADDBEF5AB, 0x18F30645C0CB0, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x09F34E0C54DD9, 0x422E3E13F163A, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x6D5AD2AB758B6, 0x19D008F30CCC5, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x322EBD2692DF1, 0x4A074CE88DD3C, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x1D1629AE7A7DE, 0x580515B3AEB81, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x63FDA9A007A36, 0x46275AE9489BC, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x1D0902CB6EB8A, 0x000000573E999, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x7DE18508DE465, 0x0000003E6CD18, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x025FE1C291BB5, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x537A8366CCA78, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x238614501E28D, 0x761FDBCF6C724, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x4F6626E02528F, 0x1C4ECA46F35E7, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x7EFDDBA5C39C6, 0x6190D34A4E511, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x5251C736FAA30, 0x021A36DF5F7A3, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x096B440935E9D, 0x2662211289789, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x5674CC3999219, 0x435CC85247F2C, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x66227C056DCF6, 0x0000007AF86A1, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x63B583B125FF0, 0x000000549F416, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x1AFBAB24A1203, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x77B645BED9F27, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x7F16E240D9DC5, 0x7D83DA38AF8C2, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x13C6D53A9435F, 0x43596345CFDC4, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x1CD81371A61C2, 0x7DA2D799C98C4, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x0B0444A28E2D9, 0x1B5A48B720A67, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x65F3E679E098E, 0x7BDE4A01B8F68, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x0BE3C4DD4D6C8, 0x788AA3718DE06, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x0874C27DEDD70, 0x0000006B8DA9F, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x38FBD23731F52, 0x0000002D49DCB, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x0A3EE28742578, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x3749EB1D5E0DD, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x26A78DD2C952E, 0x535FC1629DB27, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x03ACD8E00F8B4, 0x0E7C1AE3A3897, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x452F5FC81ACDA, 0x116513952FE15, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x52A7167D9C2A2, 0x364A0E17995D0, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x5F834B42BAC2A, 0x55EAE54500AE0, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x17A1284BB1FB1, 0x4E22E8A74C113, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x618347FD9DC13, 0x00000071521E3, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x17D3C83A48319, 0x00000056E6DC3, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x10E3E151F6EEF, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x3A991CD0CC30A, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x1D8C290DFF836, 0x3CBA24B0DA9F8, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x787F09B751FAC, 0x788AFEDB6A524, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x483A70E9D12A6, 0x5D9A6F12C5CCD, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x091A8BD76A1E1, 0x554DACDB8FC7B, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x4E23514996030, 0x457F8107F5C5F, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x751C32C02290A, 0x5D4688AE9B5A4, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x3FFCDA00EE189, 0x0000004C951CE, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x0144AE561B6F4, 0x0000004AC5EB6, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x6943EA6779C4D, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x58EF2AC416CC8, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x05A4671383F57, 0x5569AFBD675DF, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x6DC0B26C0A4C5, 0x3F430CBD64CE4, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x7AF6CD0EE1765, 0x72FDC29EC4B26, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x5B4DEEB8696B1, 0x4A9C1DBB7C893, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x2A9837E8310D4, 0x61F7A091E4B6C, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x22E1378A7D1F2, 0x455507928FE31, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x13EA2F35F7383, 0x0000004C778E0, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x45D80F57F9554, 0x000000572717D, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x3D0DF44104527, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x096AF8D2781B5, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x45BF2F14D4961, 0x7F90BC412B046, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x775831B071ADF, 0x0DCFE20C45E65, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x1A8667F577289, 0x1409A72C73C53, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x5E62ED4BAD62F, 0x38C0E72349162, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x0E27C5011D56D, 0x29921E384E4AE, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x127618A99ED3C, 0x56ECFAD3DCA1A, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x389FDB59F2D51, 0x0000007238947, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x20904C76A3731, 0x000000326B192, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x0116DB61D8850, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x0025C1E7BEF82, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x4E5F97C83982E, 0x1F23F30E78F52, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x768ACB10A1C52, 0x15E965FF52A6C, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x15E044F2B8519, 0x34FA4A6EC09BF, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x0C4486D285CAF, 0x5F9044E332582, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x1C101C69180D7, 0x3AAE00B413134, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x658B717802D1B, 0x3C6AD12EF6FBF, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x69CCA5D3DBDD1, 0x0000007B31662, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x7793EB199F682, 0x000000448512F, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x1EE9EAB036E18, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x763783F9AA51E, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x6926BD515E329, 0x3EDB4A7C792CA, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x4DF91E1CB3281, 0x1FBF86415C033, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x0D55F56362FA0, 0x38BA2F91D19FA, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x1A493B32353D8, 0x0D496A58DFC44, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x77DAC695C96B1, 0x35DAF530627D0, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x72A9E411C6FD9, 0x1F199694A47FA, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x42FE73C4399FD, 0x0000006D108F4, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x21F4962B8D1F0, 0x00000060EBA8B, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x3AE825E7D2764, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x2529325D8EBC7, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x5D494862BCCAA, 0x64CA5119779E7, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x023E513A25DCA, 0x7587D9E28CCAE, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x7B72E728B5C1E, 0x188E6508277D7, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x43AE07B49A734, 0x6DB4B8A907393, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x19A15674C50CD, 0x4B1C3D50142FA, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x02AFEC4346A09, 0x30DA6BF39007B, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x706D4F0116F7A, 0x0000006AF421E, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x70E81396EE34E, 0x0000003A16D6E, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x7CF87220B444E, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x73BB6E4DCBBE9, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x18FAC0EC15226, 0x19D181D9FFD0B, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x3E0F3C6FD9A06, 0x31BCD85587CA1, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x75279515A9896, 0x14BDC1F205C9A, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x192994272B870, 0x647AE517272F8, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x0BC337DA2B670, 0x62711C3BB5775, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x3EA9949614FF8, 0x52BA465B620E0, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x2AABED08ECA4A, 0x000000730C410, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x4103BF5A0C1B6, 0x0000005C9C0E9, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x060B9928B4E81, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x4BF53F3B485FE, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x782541FD32A18, 0x1CB6B2522F557, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x139D804DA5F22, 0x57B3AA400C3B5, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x4FEDC4B3D94B6, 0x5A328B6552087, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x6AAF5DBD55909, 0x22C48F02122B2, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x5CEEC7A14E97C, 0x34236741DC958, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x3ED31CFDEBE38, 0x30FDD3DBCD9E4, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x4C4E644FAED68, 0x00000067F4E44, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x0394C4340C4E6, 0x0000006239CE1, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x02F9D696508ED, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x5E8C82C3BC47B, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x131382109F201, 0x2FCF564F1E5AE, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x473D202BB9B03, 0x629757FD2A12E, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x54C05A8F3B8E4, 0x0216699FE1776, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x613B61967FB49, 0x1433D7537412F, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x5CA5E9786409E, 0x148D313295241, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x087AFD1ECC836, 0x0826EBF01A6A6, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x1D363B03D984A, 0x0000007DC4169, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x1C511E4CDB43B, 0x00000050E3F63, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x69AE4F76F296E, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x570794FED58C8, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x5910E2114CE2C, 0x0CABB9DC83C43, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x266D5B49566DE, 0x3067862E77043, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x3A16C360EE1C5, 0x5D61A7590A536, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x1248A17738BB7, 0x7DD848D477855, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x24BF9A564C036, 0x3B1CC3BF7FA84, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x4D7CBDA8CDA2F, 0x1B9731891F967, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x3980ED5E3A418, 0x0000006A4F859, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x54492F6C469C5, 0x000000692A58A, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x380538EB71D26, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x59E1343ACA166, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x12EE325D5149A, 0x24D2697E01DC3, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x7576B30AD45E0, 0x3EE1590D3E22A, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x3830B2575E146, 0x7E593E6960C7A, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x25151696741E1, 0x4FA3E8E170910, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x57692A778D2C4, 0x0C1FA0788710A, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x7BC58D8260783, 0x252E09CA86094, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x72ED8E3CC2DBD, 0x00000073A6C68, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x0BD1A7EE6AEF4, 0x000000480F846, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x175AC17E40C34, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x770A2AB6CD568, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x050BF9F2A20BD, 0x1F9BA9FD6E771, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x54A4FC26C4ED5, 0x09197BC7290D3, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x0F5DC4E124B43, 0x674F4A00B30B6, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x797B426388A46, 0x1B793AC2DA6EE, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x23A16F45C134E, 0x4194E46A857D4, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x3FE7B5A965DAC, 0x16425695D7917, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x15215E628407D, 0x0000007A2B453, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x7C623DC9FEB5F, 0x0000005548D91, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x58062FA62BB25, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x21C97677DA2A8, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x47D062723D2C9, 0x5B77529733B55, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x10354171C7379, 0x6C5F7D906C670, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x56FFF586C655B, 0x2BC7EA5973B07, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x586481BB98B68, 0x3B77673DF7939, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x08096B79CCE78, 0x404FF1DA4E70D, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x59CBDE9A01F32, 0x761724CC5EF2F, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x312B761F07BD4, 0x0000005EC472F, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x6CD9BDF907C21, 0x00000038DAC6E, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x0DCC859DA3474, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x5E69734EC5D82, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x7230A0693AD99, 0x727CA3EAB8D2F, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x6000AC5A1B73D, 0x2B7D5250D8E98, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x73B44A3FA9EA1, 0x1DE5B63235BB4, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x2288CBF5BFAE9, 0x207A0FB17AE41, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x7E4A0D7613B32, 0x17C8BA0BC507F, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x3E6301026DE10, 0x72FE06AA5B0B1, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x19F4A0954EA47, 0x00000057C818F, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x6BE89371453D0, 0x00000037D7B34, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x649970CA67AD2, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x30AFEAFB748E4, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x7E36B69DE262F, 0x6F132161EBF4F, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x53B3D6D4E479D, 0x76D8CD0610984, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x678B157F831A8, 0x0C3B358924E46, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x7BBA08EF08554, 0x3D7BDE122D1CC, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x3419312330E3E, 0x30E2E37A95535, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x092FBC3A2F97A, 0x53955E8B22B61, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x52AF4F0B91208, 0x0000007B82DA5, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x538355DCDA702, 0x0000004B2C4F6, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x4E11DA8587F16, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x136007CA95AAF, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x6CDB0D82667B5, 0x6F9632E8BE3CB, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x44B3BAB783809, 0x688115D49FA14, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x4410E5A1EAAA5, 0x4914FA219A107, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x695C6B902933C, 0x22D03CA16E09F, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x6BB9901A8218D, 0x79FA7EC999869, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x402FFAA43D6A3, 0x3D9B7345C1A11, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x26BB426287219, 0x0000007DB1C6E, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x148FFF2614BB9, 0x0000004A947FD, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x46ABCF511A57F, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x6DA1A0B548762, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x0C0B0E7E379AB, 0x26B527C1C3127, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x4EE0C495A06F9, 0x1009E6B843261, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x67096C71FCA7A, 0x513B2ABEC5D24, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x7CD645E524D85, 0x30B3B7D892C3D, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x48B39195D0A7B, 0x4CC7DF2567490, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x5249CFDB905CD, 0x1256F54BA8C65, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x3811F7D597498, 0x0000007562A07, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x46089436504C7, 0x000000314CEDC, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x4AAD8DF7ABA8E, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x4AA467FD7E989, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x557F23E364299, 0x149D08BDEF011, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x59746D13031CD, 0x318D3CFAE58DD, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x35F4AEBA4CC78, 0x7C9C9C3D3F6DD, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x0AAAE987D0681, 0x1C9F9D6976443, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x36E902EF33332, 0x5961E1B987CB1, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x23734387BBE56, 0x4802B59C4FF49, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x4B2490C67340A, 0x00000058276FD, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x74147CD47F197, 0x00000048830DF, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x4CBCC5E1AC2D4, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x743E21F328507, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x65245BC897DC5, 0x1EEB461288A6A, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x1545C745EADA9, 0x72423AF49CBF8, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x26FFC3C8B4796, 0x254F979FDEEA1, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x365B336B2CD72, 0x08D98E9BD0176, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x1D2CE4C570AEA, 0x37EC2454750C0, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x3957BC27014AB, 0x4917F7278F1A7, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x208761286E7B6, 0x000000713773C, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x77E8B9CFA50BF, 0x0000003711DE8, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x6C77BFA6CB927, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x623AAE92C2267, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x7A252DB03F1EB, 0x195129EC99C15, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x3905755569675, 0x1D8FB37EE5270, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x614307310D381, 0x712EA83D341A4, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x41191CE7241B8, 0x28ED2E9DFADD9, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x3015411A32CCF, 0x34E2712B2F71F, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x0523443FD149C, 0x6B5DD1C97929F, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x1BE81285BD500, 0x00000078C92F9, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x4AD9C103D842C, 0x000000326EE16, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x5CC8289375A85, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x5DB39B22A9AC6, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x2CC152AF1D09B, 0x058CE9897C02E, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x5E7F6C38D8751, 0x2D085CB9513C9, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x4C60CB038823D, 0x1F105FE2CC713, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x6D58BB9962D33, 0x494A2B564AC9C, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x2F3340931824F, 0x041BAF4C84C3A, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x6508DDC466AAE, 0x4450ECC7DDF92, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x4FC69960E69B5, 0x0000005438354, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x18BD8DFA8D960, 0x00000048F49CF, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x0E9B85F830475, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x46967CB52FAAE, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x09F9F7297E032, 0x34A5F1FB289F0, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x14AA4C1039C2A, 0x782E191746C9A, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x776C110435B48, 0x2418AE03C51F9, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x600ECB132F717, 0x7E2D4E49C2B62, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x72019B66CD80B, 0x06C5FDD7F1BD5, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x6AB0E6693FB54, 0x3DFA009314314, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x2A538D4419F44, 0x0000006DF3224, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x33DB4DA79414A, 0x00000036CCCA7, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x6F9126B2F5AB0, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x3BB7137396E34, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x07E42913A30DC, 0x494EBD1E748B3, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x2EF046017FC6E, 0x4B8754BEC838A, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x4C3F77D86C741, 0x19C435B836452, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x20789505A8783, 0x576F6B3B2C2CD, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x134E4C63CE555, 0x515CAF885407D, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x2B8457C2FF2AC, 0x6DE06394FC7AD, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x49FFFAC440D49, 0x00000079B6C53, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x62AED82ABC62C, 0x0000003D6F777, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x6126FA43B6D33, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x0164DA5B10888, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x66BB72F35A400, 0x1861C6372D04E, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x5949A45B80060, 0x60B8FB383CBE9, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x2DCED0680B2F7, 0x51D0465F25147, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x2D8F2D0A26D7F, 0x20BE2959780C5, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x0D15F29666EE8, 0x0606F6F563FE3, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x36C486050529D, 0x54CE75B7C108E, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x4EF2740EB4BE9, 0x0000005A95D23, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x610BEABA1D35E, 0x0000003E36290, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x4DCBBA9D031F4, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x61C523CD99231, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x65BFDB79302B8, 0x24822A0744DF8, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x6BE01458F69D0, 0x757E5DC5ED1EA, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x1CD231805138B, 0x4B9FEB8311D5F, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x36EA051AC10E4, 0x69C8E5E6B7040, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x71DDE9F1D75FB, 0x0BE36536AD25E, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x6BBD128938D22, 0x060C9E1FE74AD, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x6A62A23AB09CF, 0x00000075291BF, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x61AC65EBDDAA5, 0x0000003AEE261, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x6381CADD08C59, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x6D1B74299E1F2, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x5A9025ADDEE9F, 0x30BF6FF5F7F48, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x0CB2B10927963, 0x4FDC937ABBADB, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x2EA52360CF969, 0x2FB24FFA652A7, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x2FF46F5BD9942, 0x74D2D399D0EB7, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x7CA0E47892EA8, 0x34967FC7256C1, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x4DD84B237C8F0, 0x74FBA56A9C39A, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x7DCF5D6D4FB7D, 0x000000711564F, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x0C0D3470C3A1E, 0x00000034AAD22, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x1986DCC1ACEAC, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x4CB68F7A19470, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x3034E5EC331EB, 0x093145FADCAD3, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x3FF23554BCB6D, 0x2B90C6A474749, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x5DD61B473ADC9, 0x6E32F4E6E1D66, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x5B93B65EE6870, 0x2BEFCF9445269, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x5ED833B198F7B, 0x266E918A1DCB3, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x3C4F75A22C1F6, 0x2C8E4748CA2D6, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x2EF9B2D055BB0, 0x0000006361668, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x266D15B1F6D56, 0x0000005BE6BFB, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x290EDCBF50F3A, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x385260AD1D3E3, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x52901E8A7ED46, 0x53877648DA7FA, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x7138F7453BA04, 0x7E0D667DC5330, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x7CA42E62C6832, 0x4147221D09921, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x5C508B2F8072A, 0x497FD4C0FAA85, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x5BAB80024A7BC, 0x2AE4700827323, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x5A2F2E175C279, 0x2A098B4DD9F42, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x034EF6DF32984, 0x00000051C0293, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x1B5E1839333E1, 0x000000408AFE5, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x0C0A2D636F859, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x5E10D503EE88D, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x39EE2FEE4D471, 0x6DCB630C65E76, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x48ACBA6F1897F, 0x3D167487A968A, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x1E440DE49A0BC, 0x37D63DD802F22, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x36207AA2F916D, 0x6A486C5AAC685, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x59E5ABB06C0E4, 0x57B97BC988815, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x0C7BB2EA34A45, 0x17A7506C73DA0, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x0C39B088726D0, 0x00000084FB993, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x290BCB2A33228, 0x00000045CEB8A, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x5745BBB83D396, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x4F6960E7B1E78, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x2A3872A5906FE, 0x5DFF1762D1E10, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x313DCC8ACA63C, 0x2922D465387EE, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x5ADBF2787B2D1, 0x70AA793ED45E4, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x26D38ABC1A58D, 0x76027BA4065EF, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x7810DCE32437F, 0x7CF9CE346A339, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x3E5AF7FCC2FB0, 0x087A04161CB77, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x11750F86BC090, 0x0000007540DD4, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x09334C6F65D2B, 0x00000043220F6, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x34F2D36D655DB, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x6B962E1A6D0F1, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x57C75298576ED, 0x51D0C4504D098, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x7EFFFF1649399, 0x381D576ED5104, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x75CBC0DBCC482, 0x333993E490D47, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x33DC3DE4DC713, 0x5B7D2D7CBC7F9, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x065A2DA48123C, 0x23F4E42A90DDE, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x6168C63377DC4, 0x34A0C25FB3852, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x1F912BECDB9E0, 0x00000071B40C2, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x66234FDA20200, 0x0000003B628B4, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x5722E793B0B36, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x56330636DF38C, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x08886CFE03EBE, 0x1271FC447C53E, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x54713A35B2046, 0x1C8CEFB4C8F36, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x7AE9FCCBA4CC6, 0x51B7457D01967, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x566CBB3B7151F, 0x7770876A08F61, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x2DDC86AE202D2, 0x1D9DF5928D313, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x785BDC9D01AA1, 0x4CD5DE8647259, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x6A8D6DD3DBD62, 0x0000006FA6239, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x3114B7DF31664, 0x0000003F88FEC, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x01C77094A74D7, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x06852D3F67903, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x5DFB486A1A42A, 0x310FA7919E19F, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x0CCCBD308E690, 0x10690C56EC612, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x4F5A1804043D4, 0x228A99129CB5F, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x51B189B1CF1E2, 0x335C055D9444E, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x76EF47B1B8622, 0x23EF1F4343637, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x55EE64D43F88F, 0x341922B018B03, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x502CDFDB72D24, 0x00000060FA34F, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x4FA7352AAF1E5, 0x00000031573B4, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x5B306783BE267, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x501CAA6D41B2A, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x2B617E68D06DF, 0x1E5A977F13F2A, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x68CF5971160CB, 0x6FCA015E76BD2, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x19904D7699BD4, 0x4F22D10DEB73C, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x1B4D0666490BC, 0x3E6B198F5FB26, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x335B6A7FA82AD, 0x62A786CADDCB2, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x69D8F600EFB8D, 0x24B04CC991243, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x4D5AE59D3F884, 0x00000083AE84A, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x6D05466B94861, 0x0000003E37B02, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x5C1E03857DB6B, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x78718E8E9D8A1, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x6EE03F08C1468, 0x0375BADE8ADEC, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x57123CBD1402E, 0x0F763A6F7DEAE, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x4AFE379498F15, 0x2E25AD9DFF340, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x6F1BA497C8100, 0x01C3B39FBFDA2, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x6F787D159D18D, 0x71E7EB9C0BE7F, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x01C767635CD49, 0x106A2210F2071, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x276BCFBA93E50, 0x00000067268AE, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x39880D65153E2, 0x0000006498074, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x1BDC05692FCA7, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x2407E528FA54C, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x347EA4F40C002, 0x3DDA88DCA9DEA, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x5107D769FEF5C, 0x232D8C79D3EEE, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x6EED0F93CE7E6, 0x4EDB034D16215, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x2DDD16B475922, 0x75FF8B1FEB436, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x1870EB04C8D19, 0x14C91A2650C4A, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x153233CB00B0F, 0x22C9623BCD3DC, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x7695C12C58AF0, 0x00000075220E5, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x37D950A75A9BD, 0x0000004AD533C, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x746A727215E95, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x41CFFF81B7C35, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x418F5D1CCC5CF, 0x3DDF98FE67254, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x2C39B0538621B, 0x3E4A5B49188FE, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x7CD45F92A250F, 0x5AA24B19688F9, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x08DED7BCBEB45, 0x18B814730CE8D, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x7FAB2E5966281, 0x3F690C0F27EEE, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x5D95EA2313603, 0x00C47A18B7AB4, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x405EC402814F6, 0x00000066FA5E4, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x21F383B6FE6ED, 0x0000004D052E7, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x66318484523A3, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x56A01BCBE0968, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x67D9A226A59D0, 0x01610EAB5495C, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x50DA34FA6BF42, 0x71102EA8A9370, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x6BAC7CBBCB3D0, 0x41E5FF8433085, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x554AC59B3F44F, 0x2FE8BB101B57C, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x781501F131E03, 0x5D5F5FBC6EC1F, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x294C8F69409D2, 0x75720B411A36B, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x02FF4C57EE25A, 0x0000007AFE015, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x6602D9C0571FD, 0x0000004EF87DB, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x5AB0C3AB12AC6, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x514369650809C, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x1EB80B2096C49, 0x66384E45F95E7, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x63AA9D7C00D73, 0x6E91295362C4E, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x0D75FABDEEBEA, 0x36E3EB3EC0EB9, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x1DE2984E5648C, 0x62DBB44694D73, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x3D0FB4A81DCDD, 0x42F730912E28E, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x7C1975BAF3667, 0x0799BB2B75096, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x02F5DA76FA7EE, 0x0000006EB4922, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x7639930B83576, 0x0000003EEE5FD, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x66FAB046B9D37, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x35723E44C6257, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x6E90D75F67013, 0x17F17742338D6, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x20AD6C0A59249, 0x34690DC16F391, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x2C222AA08DC39, 0x773F0F2DB30F1, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x5537211669EE5, 0x4D4C1B949A7C3, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x3447CD451603E, 0x11BCD7B11A01D, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x451463434CDDF, 0x34BD826285E24, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x4D1CF85D483BE, 0x0000006F64EF0, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x3A4EA086C0E29, 0x000000527A8D7, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x455A41751C443, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x23E10622300B2, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x35F7B5963343E, 0x799300DC4B50A, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x21D9D4AF295DC, 0x02C25B961A710, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x7DD1F6D2FEE85, 0x3D8834BFAC7C5, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x3D2C439FB12D3, 0x7DB953F5372E9, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x21486E34F98D2, 0x3438F9266A1D2, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x1D5F5DF141CF3, 0x383656DA6B27C, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x5D8B2FF058AA1, 0x000000619FFB1, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x289F2485C019B, 0x0000003C9BD1D, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x443CC6A85C36D, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x17F8BA9E0F2BF, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x620F5943E1A8F, 0x05DCC73B96F60, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x05F61C1D9267D, 0x5967A0920B8E4, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x56770A8A5CC0B, 0x086E4139C2722, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x75E77030B2E78, 0x343828ADE438E, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x40F30AB145AA5, 0x4B940C4C58E98, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x6F7BDDB89299F, 0x1C066F99E2CDB, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x7AF4FA741ED34, 0x000000635A322, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x09691C587DE06, 0x0000005B35B7E, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x403195336F4C1, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x7F83BA0856A8B, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x732B7762753EB, 0x2A64F3E4717DC, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x4A856BF0DB133, 0x45AB2E5ED9161, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x14700DDD3B63B, 0x31FBC1AAF4BDB, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x72476BFB76F37, 0x2705D58CC2B7F, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x358311D2F8269, 0x3D9F541BC32B8, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x0A11B7D703361, 0x406638A60A08F, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x142FB6DE285A3, 0x00000067B58E3, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x02B03E3820E32, 0x0000002F38BFF, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x4D8C7CF359A90, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x70296EBB9EE65, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x37C9E83047EA0, 0x528B4D5899D59, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x7110834CDCEE6, 0x54466E7F427A4, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x1EDEBCE8EC78D, 0x38B5C918BD41D, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x2E5ED1328CFA2, 0x27328EF55F0E2, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x4FD467945E219, 0x047E9AF08A7BE, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x79583A2452268, 0x6736505523310, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x5C9CEBA5F6598, 0x000000689414B, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x6769909AD3A8B, 0x0000004DF343F, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x775C67B9887E2, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x41EF7BACDD034, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x298D2594317C7, 0x432C6A4942F4B, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x56BA993842863, 0x3604C4EBC7296, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x7342B4BA22217, 0x183FE01D08A30, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x08A2A67D9AC15, 0x694E4D486EC46, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x3D66B9D58CC7C, 0x6FD06A3F8C16A, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x4886267EAA022, 0x0A1CDF6D4A991, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x7ED339302FC73, 0x0000005ECC2ED, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x56081BF5653A7, 0x0000005180032, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x331DD3CD8E232, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x0349CA7610141, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x5DD51242813C2, 0x27D0823E0BDE2, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x21111EBF59E5C, 0x4E0DF8A23E6FA, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x0454B111AA2DF, 0x072842BD1D552, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x3CB0733F1CAAE, 0x5428815EFFD63, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x706E5D7C95084, 0x1AD232CCD7278, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x590A23E3982D1, 0x4704E602A8B66, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x378E81DDBEC14, 0x0000004BA27BA, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x1A57EE7CAEE23, 0x000000492ECB4, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x1EEA95AE182D1, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x128686307DB74, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x16EA1284FF2C0, 0x01642EF911EDD, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x30BFC0387F1EE, 0x62B4F5188B164, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x3579BCF56ACE7, 0x0A94D180DB229, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x512E02EE4A98E, 0x43B3617A5D7FF, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x69465C0811E4A, 0x4F924C2E3B721, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x2BF455437B726, 0x68ACBDB479D5D, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x133BF95CAE1A3, 0x0000006E1C57A, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x16EC9E28C8318, 0x0000004B94EB7, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x0E580E8DD6538, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x7428A3AE95DCF, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x7D03DF1DB2B59, 0x6002785009108, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x6A8D49CA5B45B, 0x7292CB31950AA, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x6F3161959442A, 0x6E1D9AFF0E7AE, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x19B3AA50FC2AA, 0x400EE21D3D8DA, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x703B377C6DCCC, 0x5B1FF4E881D4E, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x2453AAF4D0344, 0x23E163B458A9E, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x328C8E8C16DCD, 0x00000073A3522, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x4BD42FCDCCC0F, 0x0000004C2A560, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x7F58D61D38AD1, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x3B8377167C2C6, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x19418E27610ED, 0x0FF78DE032042, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x39E3E2774FF91, 0x29BFACEF15A4E, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x769120944D7F8, 0x624C9D6C52241, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x527D0FEF92FF7, 0x604E2785933D1, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x5E53E7399F434, 0x3048AB88B4061, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x09CDD8B1C304A, 0x2370D03878DB5, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x722B7745E7C98, 0x0000006904B65, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x0EB57DEEADE67, 0x00000055A1B4E, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x1B4065FA8F595, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x1A0676DDAF592, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x42512B4EFFB81, 0x361BEB044A89D, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x55397279D3A87, 0x190C27A468AB9, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x754C1D53F99D7, 0x464D0D5014AE5, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x5F8D7CC62B6C2, 0x184798B6F46C0, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x6B46C83F062AA, 0x215EF7DB4C3FD, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x5A7F5FF2FD8EC, 0x491A39E8C3140, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x59038A1FFAC02, 0x0000006BE00C2, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x0C4AE11B8D762, 0x0000002772956, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x231DDA7B04209, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x33812DB1279EA, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x0E67EBFEB5353, 0x697A53683F933, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x585F5D3AEECB7, 0x43E99C44B2633, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x59BFA6855C609, 0x685F49174A62F, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x651CAF0DD55E0, 0x2A2467C930758, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x5FC428571AD81, 0x1F80BB138B222, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x598B4D8A478DD, 0x4ED12B7572AEB, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x306924608FC5F, 0x00000081521DE, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x790ED808F354A, 0x0000004DA775D, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x01B4ED0967D1D, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x414185995A2B8, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x55861E5B11AAA, 0x2EFCCDBCF0DC3, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x2D01CE49D7618, 0x570403B3B63E3, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x0CBC13EB184C2, 0x0543545D0A607, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x42320ABF98697, 0x4437A9DD150C1, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x0F6A3A3D1116C, 0x626853F5C4A97, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x669BA008B7F20, 0x1ECC17F72F9E5, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x487253B86BEBE, 0x0000005508DA2, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x41284E67BE612, 0x00000040A9A98, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x68B6F079F3735, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x540610B501FDE, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x1BA53745F67F0, 0x2D39AE9B18714, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x6698D71F6FDE4, 0x4308A489BBA61, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x5C322EE2C09BF, 0x3435ED5B86C8E, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x4FD0C7DC0E0D3, 0x247EBF562235A, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x43CA5C7DF0D87, 0x089E38946791D, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x5AB34C2FAE834, 0x1392347D0B22F, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x3BBD2F166FE70, 0x0000005F76341, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x5DD663293F7BE, 0x000000318D587, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x152389B406223, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x4F23929F141F5, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x586FFF4EC0C57, 0x142454DA058B2, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x744BA0B36600F, 0x6527433BE660F, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x5084E6F5BBE18, 0x5AF797175FA20, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x0C16528EBC6F9, 0x275E3EAB8964F, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x449DEA310BB9F, 0x1C6FAD40D62B5, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x4F2F701EFDDEC, 0x3BCB7A583A1A6, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x2CC8E04F0F1F2, 0x00000068ECDAC, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x15647BB503901, 0x00000065ED7C0, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x4B72AB8C702B4, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x01F1743B5E0B7, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x26435A47BE369, 0x1EE7F9CCC440D, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x78C6B015B9849, 0x2921D47F5AA69, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x359EEE7F48C29, 0x797507E20D22A, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x3D528D74D7D70, 0x3D4E9AA0EFBF8, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x57EE9EC8F45B0, 0x60F7204CD2BB7, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x061373F4A3185, 0x0C89604BDEC9B, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x72E32FC2F4824, 0x00000066A2B70, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x2F05C6E6E5768, 0x0000004144055, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x3957822D19617, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x3F2658EB6BB08, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x04BA023C13E07, 0x7E2646AC78DD0, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x38F05AAB4C8B5, 0x1CD93D11098D8, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x3A1CF940A6484, 0x204237A34CF93, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x0ACA60E4F6C85, 0x04E790FF6E8A6, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x63BF3D334F9E5, 0x1783444C8C6C3, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x30FCB2957C47C, 0x31293C69D4437, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x228E08E3E8122, 0x00000061AC4ED, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x0DFC7012DE064, 0x0000005653031, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x06D54CE682781, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x6E6BBE1223563, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x148B4647E876B, 0x1E9F4423A5B1B, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x76590C1D9F50B, 0x1C4913C0F84F5, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x6749C7314AA81, 0x4DABAD8CC9F74, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x08B8426315D09, 0x303E1E6FE392E, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x78F5306F35B3E, 0x40215BA0E5737, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x3E9360853586F, 0x437EC0659ADCA, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x1A3ED3403DE89, 0x0000006DDAABD, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x3FCE6929B49C9, 0x0000002EE1D3F, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x0E4C789158018, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x26A2360810A51, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x0FC9F8B6BB0A6, 0x32245B6387628, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x417355F0CC2FC, 0x72A0AB8E05661, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x0D71DCB5C21E8, 0x4AA9057604CEA, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x01A810632DFFE, 0x1BDCF111F6771, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x6BA436217BFDB, 0x55F3F1D8B6364, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x48A879D0BEEDE, 0x689A9E8ABACA4, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x41844774A1077, 0x0000006AF2180, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x6A27BAD442927, 0x0000002C5B4D7, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x7A066889BC3B8, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x059B65AEA5A81, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x278355239F92C, 0x6FD5CD1EFEACA, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x78F4FC631CBB0, 0x3E9E8A014025B, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x2231BBE957E16, 0x1FCB42D3651E2, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x77CE26E02C371, 0x22A58B79BECCD, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x673B333F239EE, 0x6214FC21AAF9B, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x4FA173596C536, 0x2A96EE5CB8381, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x451AD2DA55535, 0x000000634C587, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x588FA84504349, 0x0000003108E64, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x35658C1B174C6, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x3658CB8BD915F, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x72722474F5B7C, 0x2DEBF3CD4CDC5, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x0A4ACDA9DC61E, 0x54EDC5B6598CF, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x3A2CE4C83E5C5, 0x4366E6149712E, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x79A0B794DB57D, 0x320DBA9CB03D0, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x2EBB1013C31DE, 0x7560F843E8D19, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x5A1A62E3D7525, 0x1E832277F6D45, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x6BBC1A50B2F20, 0x000000717952A, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x4F3FD2BFC3141, 0x000000361BC51, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x6C68D680736FB, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x6FFF7EC74D6AA, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x284828DBFEBF9, 0x082A9B1CEED92, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x6DE2DC188808F, 0x383E0AF8AEE8D, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x24FE521023A21, 0x2D92046D46085, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x5830152FA28DE, 0x33A9C554505DD, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x4C331EC51BD86, 0x25B3BC3CD1A25, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x4FE7E0E32DBAE, 0x6B008F2A69D88, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x2A841A1D9CE5E, 0x0000006F4B827, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x39B1C407FC209, 0x00000045F50B4, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x146A2745498D5, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x0C11F5DFBFDEE, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x23BC74DD2AEAD, 0x36E1B96CFC041, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x4C90BCB2B1107, 0x07E901D082A50, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x1F2DE75A1B0BD, 0x653F0BB26B986, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x3CC5AAB64481D, 0x46BF26F8F357A, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x6F1218AC198BA, 0x0201715A61545, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x132829A8F032A, 0x1A0D0612D1AF0, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x06C673DB44E82, 0x0000007747D74, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x05B0A9C5F6F92, 0x000000543F52B, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x5C3652A76E8FB, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x5B115A1067AA5, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x3BF049CAD70E1, 0x2FFB94B9AACA9, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x2435372C993A3, 0x22942AA5107D1, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x3775F44260ADB, 0x7A4827C249B36, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x349C31C889FF3, 0x7114ECD422824, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x350662AD75D5B, 0x3C4E729E03564, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x177A4AAA53313, 0x3274E2E473960, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x6E8133A662E0F, 0x000000532DA4D, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x23390B4414DE9, 0x0000003E9941F, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x23CA1F7AB21D6, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x379DBA01807BF, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x21CA635286B37, 0x4FC5DBFCAEE5F, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x415781621844B, 0x798932EFC4650, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x0B3205223EFDA, 0x3C37DFB66F0B7, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x41797204FF794, 0x74C891A4A26CD, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x6F27F7EC1F532, 0x28B0C0FB5A91E, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x5020E19CE07D5, 0x2D8B045198152, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x67D6EF6DC9DC3, 0x000000770CAC0, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x59432E7CE5F6D, 0x0000003EEB189, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x3FF57A852C953, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x75349FD37F785, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x74F0F89CAA1BF, 0x30A69EE31453F, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x6BF8FAF0B1C91, 0x45D92E1D3DD9D, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x2C1C11EEBC03C, 0x2DA9F2D1519A3, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x5E40DAACED674, 0x79952C3FC6D35, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x734C843221CE5, 0x04A069A361238, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x76D86F8B8E6E4, 0x383B0F890C6B3, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x252944CAA403A, 0x000000706E207, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x27B2992D1B083, 0x0000002FAA442, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x1EEFBC837EF54, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x1DD5355331310, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x4A6DDDFC7FB0F, 0x4F6A3FEC79F03, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x1130E026A6527, 0x04B484C35359B, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x3CC83B8E8DB09, 0x04FF2E9BAF9FC, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x3FE38830D9358, 0x66A88B4CBF258, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x4C45A1A6AB88B, 0x1F4DCE6CCD562, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x629C8AADEB68E, 0x6DF1D0F85B03E, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x7E62005ECAC44, 0x0000006C91AAA, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x1401A5E81B024, 0x0000003A0134C, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x7DE4FB32714A8, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x20CCDDDE8A59F, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x0CBA84751C69E, 0x09AF41AAA0DBA, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x0254E2A374B3A, 0x18FBBC4D36DA3, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x7DAFF233F75A7, 0x31A248214DFA6, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x668EAFC178DFD, 0x64802CCB52D2A, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x62E6FEB4E312D, 0x4F7AEF26E7B50, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x71AE8D2E48866, 0x5ACC9A126E47E, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x6BE90DEE3FFEC, 0x0000004AF7487, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x6A3A49C093BA0, 0x00000042348D7, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x303595D9B93DE, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x078D0E38CAFA0, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x39A6E9FB93A59, 0x2E5D9FA394CE2, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x01C59E5DB7003, 0x0428ABCE539C5, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x182BCFFF64162, 0x5B83D085AC586, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x27970485C599F, 0x62A1A1AB487FA, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x3A34C274FDA51, 0x62E4DFE1A29A6, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x3FA333A03A4C1, 0x23C3962C712C2, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x7C1721C5E3E6B, 0x00000059145CB, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x06FEDB2B7C6B6, 0x000000658104A, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x0B0B29CCFF395, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x19E28DAAB134F, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x36101209D5995, 0x5EE87949BF2EE, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x2F220F7E01859, 0x7EB6371717223, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x664B02B1466B2, 0x676CE183453A2, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x2D36A5FDC14F0, 0x2C8EC588F6B0F, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x03EDEB9E9545B, 0x6BDAD4EF2929A, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x3AF5CB1A46A31, 0x70407FC062169, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x34C37FB77D2F0, 0x0000007E83A0F, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x479B36A1DF3D2, 0x000000444A546, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x3CEFD6A0D6035, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x27CA3EF75A27D, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x465EFB06D1315, 0x309ED47BDE4F0, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x52FD5B5BB0E29, 0x563A63F7504D5, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x0F21B2E4E472F, 0x74A70FF73C761, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x589DA371F8319, 0x331D19769A172, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x493B0F6AD0625, 0x0CD99B6F54F04, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x686A8CDB830C9, 0x6B3EDD4E4F7CA, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x0187F842D3A79, 0x000000738BFF6, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x2C03A55530431, 0x00000052A5EA0, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x132AB34C400CB, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x1C181F74D06E5, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x0246D2905C1EC, 0x6A4713501DE54, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x33E7E6E10616E, 0x78DE6AA06B1AC, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x5581BDC7BC569, 0x24DE1C99C1086, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x25EF5A020F579, 0x3BBF4A6677E0A, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x7C8B71CDEEF22, 0x3BA4BC84FDC09, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x11D1BB6AE167A, 0x7C15096F7BFD1, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x4AF505238C99F, 0x0000005747815, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x7985F426D6035, 0x0000004D2AD7E, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x3734DDC024AB7, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x1C01095BC570D, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x2D16AC6481C56, 0x1EFE16CAC5BA9, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x55CBD28E98720, 0x4A7C7D77D7FE8, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x644DA47974718, 0x61D28FA9F296B, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x70CE017E134FA, 0x52E5887DB9AB0, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x479E09A4F50C9, 0x2CCF163B01F51, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x04B6BE674DA71, 0x6294843BD69EC, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x5EB124BFD0275, 0x0000006A16D71, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x732747E549A7D, 0x00000068C991D, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x2736B72C184D7, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x4E991526AF2C9, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x79611F8E7CE69, 0x60C3C140E0728, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x72B82CDC204A5, 0x2BFDEDB67BC12, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x7B66D4B4BA162, 0x769AA76E7F9D9, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x5BBC59D9326D1, 0x45CA89B182A1E, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x0A807E324EF70, 0x04FB533C984AA, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x3AFB983DC2D81, 0x12CBC29361A28, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x3A47A5CA8FB61, 0x00000068DA953, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x33AEB812A4CAD, 0x00000026B586E, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x4EA01B0D2967E, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x382943430EC63, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x53117F984F406, 0x3E8636F189344, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x6E611120EF8F2, 0x7E1F7B09751E7, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x260ED602D2282, 0x5D3457BA32CDE, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x4B2A2C3A2BFD5, 0x1020AAE094F9F, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x67F18DA7C1A89, 0x32C5016FDD78F, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x5220F23E96879, 0x3880686508328, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x60FE28587ADE6, 0x00000076968E6, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x407A9E18603AB, 0x0000004A1A8AB, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x2464CC788DCA0, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x6819DBBF40851, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x333D2B9EF135B, 0x7B9E3A1C6ADBF, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x527D7C44C0239, 0x5459F0E0CD934, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x49F83FAAD9531, 0x06A03EA7E5B01, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x383767EA79932, 0x02E8C16D3589C, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x19B9553F3A1B7, 0x39C406E38F935, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x4CCE6D9D2982F, 0x773B79AD810E7, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x3C01F3293CE90, 0x0000006A249DD, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x20E03F847DAA2, 0x000000553D673, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x7243444083971, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x7AB56EC03CC0D, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x72C55A7C40ADE, 0x3FB5A7E3EEB06, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x47E8965947760, 0x5A2336B44311B, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x43C43F964A5D4, 0x31AE1D5159390, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x0A88EF13DDD3B, 0x6EB6370DF8BBA, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x769BC24235C6D, 0x436877EF03469, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x476A5B7DBE6A8, 0x394B64AAEBD61, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x074C3E1C43A92, 0x000000692FF08, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x7CF4A929A7098, 0x00000028AAD31, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x2F1EDB9B163E7, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x3BADDF63B915E, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x32F2B8CB5413D, 0x2EB6811F01224, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x516155FFABEC3, 0x52A0C5C8E3BA2, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x24F2EA15387EC, 0x7F26A64B6EDE2, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x70B6595BF9229, 0x5FBE70CA29ACB, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x582922DD10E46, 0x5389DE176A41D, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x3A5C503E73023, 0x17695C2A523EA, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x70B5595C2CB19, 0x0000008385006, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x0F6663F733962, 0x000000483F72F, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x56532F5B71E73, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x432E1E76C3632, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x0B30E38EA2AC1, 0x44926D43744F6, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x116149B045625, 0x3DF7BEBDB1C7C, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x40A073240506D, 0x41BC793EDB6E3, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x4043D90969847, 0x43FC91D1F9F99, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x71D79D2EDB898, 0x66D1AB343AE02, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x1631790762DF6, 0x6479A31171497, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x1F31ADA344D7D, 0x000000586EDE7, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x2867BC15C5F46, 0x00000036D2843, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x2101A0095BCBD, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x5CEDC01FE25C2, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x336353C237158, 0x3DB0CACAAED14, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x4C65836376FF8, 0x121646AAF904F, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x5F6C9443E2892, 0x54D89973174CA, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x2DCC7AB555BD7, 0x7093879EC80A8, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x728D0CC6EC795, 0x2B104FACD52DF, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x2B2A5514DBDDC, 0x4558D97A93996, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x0DCBDCE0DAC3A, 0x0000006C89EB6, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x45DA2A9D935EE, 0x00000062112BB, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x354B7F0AA7EED, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x0D6307E5363B9, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x6C19F0A370F41, 0x78C597023980E, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x44084E3D35637, 0x637F5B3ED1EBE, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x6D7468EA6CC3D, 0x67C47160F8AB8, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x4DA868D1B8313, 0x6BD2C931C7401, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x6A78C266DE452, 0x23D2B5B641923, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x21C5540CBC3E0, 0x71554D1366B06, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x5D0DA8906EAAB, 0x0000005D533B9, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x2895C443CDAB4, 0x0000005C91E96, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x03A25D1256FA0, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x6981A7A388CB5, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x327195D85DA1D, 0x6742D00094379, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x36A32E712365F, 0x5783400F02280, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x4B5002D8D9A18, 0x327C19EF46527, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x5A5DF10519C35, 0x5BBA1F7D44C25, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x1DBB9703BFF82, 0x1A442C3B476C1, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x3F441DF183F57, 0x55837848DE982, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x060FB8337EA32, 0x0000006EA9BFA, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x762F42F5E9EB5, 0x000000368CC96, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x6C3C284B89DCF, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x0FA947C3379C4, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x2E4BA8994F1E7, 0x1D629E2548A32, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x4B1B325AEFAB5, 0x19DEF6492802D, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x295D104244C10, 0x15F6620FB0045, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x29466D4581F31, 0x197B18F5FDCCA, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x08D63EE327831, 0x131142A82D85C, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x34C64351DE8B0, 0x418E8042D84EF, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x6FDF719B569DF, 0x0000007324209, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x68A48FA17E7CE, 0x0000003589CC1, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x6C2FF473EF6E3, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x07573012DEAEB, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x4DBD01CAF9C17, 0x650FE45923D2B, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x63D7F1BCBE18B, 0x6A58E081FDE9A, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x00B7B73FF85FF, 0x5A08B80D58C61, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x5857701B31443, 0x333858C93BF1C, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x733A539B0B6FF, 0x4779691DA6472, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x15B2014EE6333, 0x7C598C2CCBF64, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x17A7B94557E63, 0x000000614DAE9, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x147CB95D95AA5, 0x000000310C1C7, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x41E521D0EAB20, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x2E069104290F2, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x6DE0143B9EC94, 0x3E218AD4E2C2E, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x1D6C932740C90, 0x65AA5CC49FC95, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x6DF0492CB9633, 0x2B791A597FC51, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x628D1F5534127, 0x2B16E5F8350FE, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x21D67240B2925, 0x1E31D45D2976F, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x309D3EAC6090C, 0x4A7953DB57E17, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x48CE7B4E0C529, 0x0000007517DBC, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x12E6044003637, 0x0000003B12CC2, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x095B0DEACF062, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x3D8E1E6F400FC, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x6F64C5B6E03CD, 0x3F6A5AB8DC483, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x189E48BD01045, 0x04DAB14E7C164, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x18C2A79B0D17D, 0x23993B3096BD3, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x6133F7C707119, 0x6B585F06C9C79, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x40CE75EBD0E39, 0x50A8FDF6366EE, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x2C59D945DFD8D, 0x33FD6945715D3, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x64D8E20A27786, 0x0000004EE5139, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x754D4A0BB9173, 0x000000449229B, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x37739916DC6AC, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x18C3C103CF1B0, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x4B38EE34B1AF2, 0x3BE72727E0BAF, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x399C2A396FE0A, 0x269968546E028, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x2EE6967582BF5, 0x4BB91D9D7BDA5, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x0F6919CFC6486, 0x583B7C127FFAC, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x024BE110497A1, 0x239E899A6F142, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x7AAA85F474D23, 0x4AC8B41ED83BB, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x6E72954BE6B1A, 0x000000737E995, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x0BD346ABFC38C, 0x0000005456854, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x702A03B675CBC, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x4827BFD749069, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x5E75DA03B4772, 0x6572658C6EA8C, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x5AC93E279B1E0, 0x3DAE6E73D0164, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x0488AF9BCD2B6, 0x648FF51B6B0C1, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x2E3D5008693C2, 0x69313054F9B3D, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x40893D52A9E13, 0x0E38E5F0841C7, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x2998688C22797, 0x61C0B00DE932D, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x79D167ECBF7A0, 0x0000005659A99, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x736D652AB81E9, 0x000000513BC46, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x53AA8C0FC726F, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x277F466F40AFE, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x4E308D8E0642D, 0x657F6A25B2211, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x2A82501D0C8B5, 0x5E9F28CA54062, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x2601E04731EB3, 0x1C32667C2EE8D, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x1554C9199E3D3, 0x5B6B1D7405968, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x7F2BD554EA8F7, 0x07C7B155FDC26, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x7D0CEAB7196F9, 0x3747D5635058A, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x4ADCF24387E1E, 0x0000007DC1CDC, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x1FE5498881E6A, 0x00000047733EB, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x57FE8F58B15B3, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x071CA59F11463, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x46103D2F99F85, 0x319178CC39E05, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x6BD202E934309, 0x287D64A7BE3CB, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x122FA003FBC81, 0x44B9ED98FCCB0, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x05BA5998B2661, 0x4A4C99BCDD669, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x280484265FB0A, 0x2D8B364942E3A, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x2DBB3A9F00A0B, 0x6204E956C9D41, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x31E90F542527F, 0x00000083FD738, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x5114C5CB09AB3, 0x00000045E67FA, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x7D4F313E76E38, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x4DCDEE1B66CB0, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x092E0A9FC8CD8, 0x5EE5171558CB8, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x79EB6448BC3EC, 0x00CE948F750B4, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x289ED0F5660B6, 0x0197EBF1AF141, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x1CD946309A661, 0x2F1C34E54D9CA, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x48332396B259F, 0x05F34AAEA7326, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x53F3AC47F9F91, 0x26D3D7CB06DBD, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x4519EA5D30F55, 0x0000004B1D4D1, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x593A6D4171C8D, 0x00000049F887F, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x550BCB6214A58, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x32F42ADEF721D, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x360E67FCD3238, 0x64DCF1FCD24EA, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x179BCB7B0833C, 0x4530224E0DCAB, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x66C8677F1BFFE, 0x17B9F5291C5DD, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x52B28DEBC95E0, 0x34918A8B86F9C, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x725F8B77F9517, 0x6E02D5518D907, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x44EA9B089E519, 0x638DF22DBD8E8, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x487869D42036B, 0x00000059BB84F, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x1DB434AC5C0EB, 0x00000033AF07C, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x50C9102A2DF83, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x5F23C0ADCF86F, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x132182271D331, 0x17E0941F92323, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x4434D05A1885D, 0x6C2403076853B, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x7AD29F25B4EFA, 0x62174373F4834, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x6AA14AA10AAE3, 0x34131E79AC9F9, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x611C49A3AF95E, 0x7768A04FA5B47, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x0BA35A6675C0B, 0x1B8BEEA0912A4, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x34A08E4FE2ABE, 0x000000364EF24, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x35EC43BB73B03, 0x00000071DB823, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x6E22E4A5AD1DB, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x211355D2D2145, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x75A54D06170BE, 0x558B95D933E6F, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x05E23F5853F54, 0x605EC55B3E1B9, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x4769C76CA6989, 0x25E4E804D8204, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x21C79DEF33FF1, 0x628809A8592F2, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x201CC82DEC539, 0x45BAFBE957430, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x64D77C973D4B6, 0x6F9D62254B6F7, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x5F406EB9D6F87, 0x0000005E63E89, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x659B3FDCEC98C, 0x00000037552A8, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x1561936CD61DF, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x6331EC970DD2E, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x156C9543D1B0C, 0x5CE77474A6061, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x7F6DD7195C224, 0x41DF5F4461F4D, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x53A52F5C463FF, 0x1DE37A95FDFE4, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x4746FF606A5E2, 0x72A4E4C248045, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x2B0488B39B5DA, 0x42CA5616ABBDC, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x1A659FA6C070E, 0x752648BF695FB, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x6B4AA221DA23E, 0x0000005E7E390, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x4826AAE49A2C5, 0x0000003D8D3EF, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x2338E69240371, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x5E239F5ACE9CC, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x7ED2733B7E20D, 0x5B494E7207ACD, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x18F14880E67CD, 0x070F497B880AA, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x1236383C7C040, 0x478D023BCF31D, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x3ADE56F9F431B, 0x2201BF116BB4A, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x3B4226E4BBA31, 0x73AC91CD6C8FB, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x11333E08F537A, 0x59FF768243B4A, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x4FE95E7C7AC27, 0x0000005F529BD, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x29A40D2B1BD18, 0x0000004DD6963, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x164002FC1136C, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x5BCD9102D17ED, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x042E50D6AE809, 0x7DA439754285C, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x326B35EE1795F, 0x5ED83D2AC6164, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x44CF5AA944715, 0x5385015F76AFC, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x4545525AA2D0A, 0x2049EB461FF6A, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x3F807BF44A1D2, 0x5D780504A1819, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x41027CDF0B7EB, 0x5C95CE3275E48, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x4FBBF353E9836, 0x0000007BE592F, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x470B80FBBC610, 0x00000048CE848, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x529A45A138BCE, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x7479221E3A0D6, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x59B4FA3A01146, 0x2D4639EE07068, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x38E8B27E93C12, 0x66E012D21D9BF, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x03C4829347AD5, 0x54F21803F5EDE, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x0D3E7F5E84832, 0x71F7A22739426, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x7B84C075932F9, 0x150C09CFD5508, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x6565EF04690CB, 0x725D892BCF5D1, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x335E9EF20993A, 0x0000008089B30, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x1EF9319483665, 0x0000004818CE2, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x5CAED277CBD60, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x593244ED8F651, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x1FBA4D3984B47, 0x3460A794D2837, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x7B5E4218ED7A9, 0x1734FCBD30EC0, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x3A68355444D83, 0x7A1F5121A5111, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x0E2080A4F1E20, 0x325B14F696B3E, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x4B69C22BD66AA, 0x2DF85B8A89F98, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x5E4AED6F21AB7, 0x5CB1AF0EB240D, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x459EE338FFBC5, 0x0000005BC6CD6, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x6EA0B9425B5AD, 0x0000005990F9B, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x40DB7E979248A, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x44A601359B21B, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x7E8DE512B62CB, 0x11537FAF7D62A, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x6B91182D41E1D, 0x225B58BD91FBF, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x4F7B174945D05, 0x21171BDEB857D, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x40475406CA825, 0x1730B4085EDB5, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x4E4599DF09EBF, 0x25559D1AC7000, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x51DEBF848B9C9, 0x5603CD500E1AA, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x280C708517C77, 0x000000719BBF0, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x4801CF45AE2AF, 0x00000035B8473, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x001C3C7242E28, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x005A5C7CEB8CF, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x2FB2D2F329918, 0x23D5DFE483CA6, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x7606164665A6E, 0x33237256C2842, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x143E61ED9332F, 0x77261EF79A7F7, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x634CE0805383F, 0x2B221083B34EC, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x6D14F18487AAF, 0x702D7028CA6AA, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x6553B59BB246A, 0x38FBAFC7215BF, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x0D959E840B4E8, 0x0000006261D79, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x316A08C025247, 0x0000006202BBA, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x1A43A208C4F95, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x3118C41AFBC0A, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x6AFDAF3D26D97, 0x658A470B909B5, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x492802795FEA5, 0x22EB084A3B0F8, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x5B1EC33A39F6F, 0x22C73D08A1888, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x14AE4CCB0FE7F, 0x0A2941589827D, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x425128CEB4E64, 0x03C9FDFBB5CF0, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x64704289747FA, 0x6AF96BA0D8F59, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x04CE628AC8042, 0x00000059DF7AD, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x454980FB7AFE5, 0x00000042BF6EF, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x32A5C8614538C, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x5A09EACBE4DF8, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x666DECB262F7E, 0x2F218CD019F43, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x2242D3B73CA9A, 0x5C4EBBC529499, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x40DC3CD406C1A, 0x5800FD4405D64, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x6AC920416CD18, 0x22CBD84C12408, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x42A8936979C94, 0x2288A967D7850, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x0A41D2071C5E9, 0x4AAA6339113E5, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x6A2BEC75144D2, 0x0000006931CB9, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x31D02C11C7ADC, 0x00000026A93A9, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x6A335B9C89540, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x1B83167287823, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } },
+  { { 0x18C67B0DCB162, 0x051493C2A415E, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F, 0x693FE6BFBAFB0, 0x2111072E8564C, 0x7FFFFFFFFFFFE, 0x171E0C562BA8F },
+    { 0x151EFECE93446, 0x0C80EFD36A503, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3, 0x196E7D5D6D994, 0x45BF85DFCC9AC, 0x7FFFFFFFFFFFF, 0x340E2902B3DE3 },
+    { 0x71E6DE9A6CFD6, 0x799CC32E68A15, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD, 0x43A2704D880D8, 0x3558F72886AAF, 0x7FFFFFFFFFFFF, 0x1773446CFC5FD },
+    { 0x2099E0700B578, 0x000000520A1E4, 0x7FFFFFFFFFFFF, 0x0000004683E4E, 0x4B274EA4DF362, 0x0000004B6DBBA, 0x7FFFFFFFFFFFF, 0x0000004683E4E },
+    { 0x0EA45130C0BB5, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000, 0x21EC4CA4DE423, 0x0000000000000, 0x7B82ECF5C5FFF, 0x0000000000000 } }
+};
+
+#endif
@@ -1,48 +1,188 @@
 /********************************************************************************************
-* Hardware-based random number generation function
+* Random number generation function
 *
-* It uses /dev/urandom in Linux and CNG's BCryptGenRandom function in Windows
-*********************************************************************************************/ 
+* Every thread runs its own AES-256 CTR generator with fast key erasure: each refill
+* encrypts a counter into 32 bytes of new key followed by RNG_BUFFER_BYTES of output,
+* so earlier outputs cannot be recomputed from the current state. The key is seeded
+* from getrandom() (/dev/urandom on kernels without it) on first use and reseeded
+* after every RNG_RESEED_BYTES bytes of output or on randombytes_reseed(). A pthread_atfork()
+* child handler wipes the state of the forking thread, the only thread of the child, so
+* a fork()ed child reseeds instead of repeating its parent's output. If the entropy source
+* fails the process is aborted, no output is ever produced from an unseeded generator
+*********************************************************************************************/
 
 #include "random.h"
 #include <stdlib.h>
+#include <string.h>
+#include <errno.h>
 #include <unistd.h>
 #include <fcntl.h>
-static int lock = -1;
+#include <pthread.h>
+#include <sys/random.h>
+#include <wmmintrin.h>
 
-#define passed 0 
+#define passed 0
 #define failed 1
 
+#define RNG_BUFFER_BYTES 512
+#define RNG_RESEED_BYTES (1ULL << 20)
 
-static __inline void delay(unsigned int count)
+typedef struct {
+  __m128i rk[15];                           // AES-256 round keys
+  unsigned char buf[RNG_BUFFER_BYTES];      // unused output, consumed from pos
+  unsigned int pos;
+  unsigned long long count;                 // bytes output since the last (re)seed
+  int seeded;
+} rng_state;
+
+static __thread rng_state rng;
+static pthread_once_t rng_atfork_once = PTHREAD_ONCE_INIT;
+
+static int os_entropy(unsigned char *x, unsigned long long xlen)
+{ // Seed material from the kernel
+  ssize_t r;
+  int fd;
+
+  while (xlen > 0) {
+    r = getrandom(x, xlen, 0);
+    if (r == -1) {
+      if (errno == EINTR) continue;
+      break;
+    }
+    x += r; xlen -= r;
+  }
+  if (xlen == 0) return passed;
+
+  // no getrandom() on this kernel
+  fd = open("/dev/urandom", O_RDONLY);
+  if (fd == -1) return failed;
+  while (xlen > 0) {
+    r = read(fd, x, xlen);
+    if (r == -1) {
+      if (errno == EINTR) continue;
+      close(fd);
+      return failed;
+    }
+    x += r; xlen -= r;
+  }
+  close(fd);
+
+  return passed;
+}
+
+static int (*entropy_source)(unsigned char *x, unsigned long long xlen) = os_entropy;
+
+#define AES256_EXPAND_EVEN(i, rcon)                                           \
+  t = _mm_shuffle_epi32(_mm_aeskeygenassist_si128(rk[i-1], rcon), 0xFF);      \
+  rk[i] = rk[i-2];                                                            \
+  rk[i] = _mm_xor_si128(rk[i], _mm_slli_si128(rk[i], 4));                     \
+  rk[i] = _mm_xor_si128(rk[i], _mm_slli_si128(rk[i], 8));                     \
+  rk[i] = _mm_xor_si128(rk[i], t)
+
+#define AES256_EXPAND_ODD(i)                                                  \
+  t = _mm_shuffle_epi32(_mm_aeskeygenassist_si128(rk[i-1], 0), 0xAA);         \
+  rk[i] = rk[i-2];                                                            \
+  rk[i] = _mm_xor_si128(rk[i], _mm_slli_si128(rk[i], 4));                     \
+  rk[i] = _mm_xor_si128(rk[i], _mm_slli_si128(rk[i], 8));                     \
+  rk[i] = _mm_xor_si128(rk[i], t)
+
+static void aes256_key_expansion(__m128i *rk, const unsigned char *key)
+{
+  __m128i t;
+
+  rk[0] = _mm_loadu_si128((const __m128i *)key);
+  rk[1] = _mm_loadu_si128((const __m128i *)(key+16));
+  AES256_EXPAND_EVEN( 2, 0x01); AES256_EXPAND_ODD( 3);
+  AES256_EXPAND_EVEN( 4, 0x02); AES256_EXPAND_ODD( 5);
+  AES256_EXPAND_EVEN( 6, 0x04); AES256_EXPAND_ODD( 7);
+  AES256_EXPAND_EVEN( 8, 0x08); AES256_EXPAND_ODD( 9);
+  AES256_EXPAND_EVEN(10, 0x10); AES256_EXPAND_ODD(11);
+  AES256_EXPAND_EVEN(12, 0x20); AES256_EXPAND_ODD(13);
+  AES256_EXPAND_EVEN(14, 0x40);
+}
+
+static void rng_refill()
+{ // Encrypt counter blocks 0, 1, ... under the current key, 8 blocks at a time:
+  // the first 32 bytes become the next key and the rest refill the buffer
+  unsigned char out[32+RNG_BUFFER_BYTES];
+  __m128i b[8];
+  int i, j, k;
+
+  for (i = 0; i < (int)sizeof(out)/16; i += 8) {
+    for (k = 0; k < 8; k++) b[k] = _mm_xor_si128(_mm_set_epi64x(0, i+k), rng.rk[0]);
+    for (j = 1; j < 14; j++)
+      for (k = 0; k < 8; k++) b[k] = _mm_aesenc_si128(b[k], rng.rk[j]);
+    for (k = 0; k < 8 && i+k < (int)sizeof(out)/16; k++)
+      _mm_storeu_si128((__m128i *)(out+16*(i+k)), _mm_aesenclast_si128(b[k], rng.rk[14]));
+  }
+
+  aes256_key_expansion(rng.rk, out);
+  memcpy(rng.buf, out+32, RNG_BUFFER_BYTES);
+  memset(out, 0, sizeof(out));
+  rng.pos = 0;
+}
+
+static void rng_atfork_child()
+{ // Runs in the child of fork(): drop the key and the buffered output shared with the parent
+  memset(&rng, 0, sizeof(rng));
+}
+
+static void rng_atfork_register()
 {
-    while (count--) {}
+  pthread_atfork(NULL, NULL, rng_atfork_child);
 }
 
+static int rng_seed()
+{ // Mix fresh entropy into the current key (which is all zero before the first seed)
+  unsigned char key[32], seed[32];
+  int i;
+
+  pthread_once(&rng_atfork_once, rng_atfork_register);
+  if (entropy_source(seed, sizeof(seed)) != passed) return failed;
+
+  _mm_storeu_si128((__m128i *)key, rng.rk[0]);
+  _mm_storeu_si128((__m128i *)(key+16), rng.rk[1]);
+  for (i = 0; i < 32; i++) key[i] ^= seed[i];
+  aes256_key_expansion(rng.rk, key);
+  memset(key, 0, sizeof(key));
+  memset(seed, 0, sizeof(seed));
+
+  rng_refill();
+  rng.count = 0;
+  rng.seeded = 1;
+
+  return passed;
+}
+
+void randombytes_set_entropy(int (*entropy)(unsigned char *x, unsigned long long xlen))
+{
+  entropy_source = (entropy != NULL) ? entropy : os_entropy;
+}
+
+void randombytes_reseed()
+{
+  rng.seeded = 0;
+}
 
 int randombytes(unsigned char* random_array, unsigned long long nbytes)
 { // Generation of "nbytes" of random values
-    
-  int r, n = (int)nbytes, count = 0;
-
-  if (lock == -1) {
-    do {
-      lock = open("/dev/urandom", O_RDONLY);
-      if (lock == -1) {
-          delay(0xFFFFF);
-      }
-    } while (lock == -1);
-  }
+  unsigned long long n;
+
+  while (nbytes > 0) {
+    if (!rng.seeded || rng.count >= RNG_RESEED_BYTES) {
+      // no entropy: abort rather than hand out output a caller might use as a key
+      if (rng_seed() != passed) abort();
+    }
+    if (rng.pos == RNG_BUFFER_BYTES) rng_refill();
 
-  while (n > 0) {
-    do {
-      r = read(lock, random_array+count, n);
-        if (r == -1) {
-          delay(0xFFFF);
-        }
-    } while (r == -1);
-    count += r;
-    n -= r;
+    n = RNG_BUFFER_BYTES - rng.pos;
+    if (n > nbytes) n = nbytes;
+    memcpy(random_array, rng.buf+rng.pos, n);
+    memset(rng.buf+rng.pos, 0, n);
+    rng.pos += n;
+    rng.count += n;
+    random_array += n;
+    nbytes -= n;
   }
 
   return passed;
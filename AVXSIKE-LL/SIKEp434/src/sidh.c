@@ -9,6 +9,7 @@
 
 #include "sidh.h"
 #include "random.h"
+#include "traversal.h"
 
 static void init_basis_1w(uint64_t *gen, f2elm_r51_t XP, f2elm_r51_t XQ, f2elm_r51_t XR)
 {
@@ -36,11 +37,11 @@ void random_mod_order_B(unsigned char* random_digits)
 // PKA in radix-2^64
 void EphemeralKeyGeneration_A(const unsigned char* PrivateKeyA, unsigned char* PublicKeyA)
 {
-  point_proj_r51_t R, phiP = { 0 }, phiQ = { 0 }, phiR = { 0 }, pts[MAX_INT_POINTS_ALICE];
-  f2elm_r51_t XPA, XQA, XRA, A24plus = { 0 }, C24 = { 0 }, A = { 0 };
+  point_proj_r51_t phiP = { 0 }, phiQ = { 0 }, phiR = { 0 };
+  f2elm_r51_t XPA, XQA, XRA, A24plus = { 0 }, C24 = { 0 };
   digit_t SecretKeyA[NWORDS_ORDER] = { 0 };
-  int i, row, m, index = 0, pts_index[MAX_INT_POINTS_ALICE], npts = 0, ii = 0;
-  vgelm_t vR, C24_A24plus, coeff__0, coeff2_1;
+  int i;
+  vgelm_t C24_A24plus, vphiP, vphiQ, vphiR, pts[MAX_INT_POINTS_ALICE+1];
   point_proj_t phiP64 = { 0 }, phiQ64 = { 0 }, phiR64 = { 0 };
 
   // Initialize basis points
@@ -54,14 +55,14 @@ void EphemeralKeyGeneration_A(const unsigned char* PrivateKeyA, unsigned char* P
   fpcopy_1w(A24plus[0], vmont_R);       // A24plus = 1
   mp2_add_1w(A24plus, A24plus, A24plus);// A24plus = 2
   mp2_add_1w(C24, A24plus, A24plus);    // C24 = 4
-  mp2_add_1w(A, A24plus, C24);          // A = 6 
   mp2_add_1w(A24plus, C24, C24);        // A24plus = 8
 
   // Retrieve kernel point
   decode_to_digits(PrivateKeyA, SecretKeyA, SECRETKEY_A_BYTES, NWORDS_ORDER);
-  // vectorized Montgomery ladder (ladder step is 1x4x2x1w)
-  // the ouput R is in radix-2^51
-  LADDER3PT_1x4x2x1w(XPA, XQA, XRA, SecretKeyA, ALICE, R, A); 
+  // fixed-basis Montgomery ladder (ladder step is 1x2x2x2w)
+  // the ouput R : < XR1' | XR1 | XR0' | XR0 | ZR1' | ZR1 | ZR0' | ZR0 > is 
+  // written into pts[0], the traversal keeps pts[] in this form 
+  LADDER3PT_fixed_1x2x2x2w(XPA, XRA, SecretKeyA, ALICE, pts[0]); 
 
   // intialize C24_A24plus : < C1' | C1 | C0' | C0 | A1' | A1 | A0' | A0 >
   for (i = 0; i < VGWORDS-1; i++) 
@@ -72,60 +73,28 @@ void EphemeralKeyGeneration_A(const unsigned char* PrivateKeyA, unsigned char* P
   C24_A24plus[i] = _SET(0,     C24[1][i], 0, C24[0][i], \
                         0, A24plus[1][i], 0, A24plus[0][i]);
   
-  // Traverse tree
-  index = 0;
-  for (row = 1; row < MAX_Alice; row++) {
-    // update vR : < XR1' | XR1 | XR0' | XR0 | ZR1' | ZR1 | ZR0' | ZR0 >
-    for (i = 0; i < VGWORDS-1; i++) 
-      vR[i] = _SET(R->X[1][i+VGWORDS], R->X[1][i], R->X[0][i+VGWORDS], R->X[0][i], \
-                   R->Z[1][i+VGWORDS], R->Z[1][i], R->Z[0][i+VGWORDS], R->Z[0][i]);
-    vR[i] = _SET(0, R->X[1][i], 0, R->X[0][i], \
-                 0, R->Z[1][i], 0, R->Z[0][i]);
-    
-    while (index < MAX_Alice-row) {
-      pointcopy_1w(pts[npts], R);
-      pts_index[npts++] = index;
-      m = strat_Alice[ii++];
-      xDBLe_1x2x2x2w(vR, R, C24_A24plus, 2*m);  // both vR and R get updated here
-      index += m;
-    }
-    
-    get_4_isog_1x2x2x2w(vR, C24_A24plus, coeff__0, coeff2_1);
-
-    // eval_4_isog could be parallelized in 1/2/4/8-way, depending on npts. 
-    eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, npts+3);
-
-    pointcopy_1w(R, pts[npts-1]);       // update R 
-    index = pts_index[npts-1];
-    npts -= 1;
-  }
+  pack_point_1x2x2x2w(vphiP, phiP);
+  pack_point_1x2x2x2w(vphiQ, phiQ);
+  pack_point_1x2x2x2w(vphiR, phiR);
 
-  // update vR : < XR1' | XR1 | XR0' | XR0 | ZR1' | ZR1 | ZR0' | ZR0 >
-  for (i = 0; i < VGWORDS-1; i++) 
-    vR[i] = _SET(R->X[1][i+VGWORDS], R->X[1][i], R->X[0][i+VGWORDS], R->X[0][i], \
-                 R->Z[1][i+VGWORDS], R->Z[1][i], R->Z[0][i+VGWORDS], R->Z[0][i]);
-  vR[i] = _SET(0, R->X[1][i], 0, R->X[0][i], \
-               0, R->Z[1][i], 0, R->Z[0][i]);
+  // Traverse tree
+  traverse_Alice_kg(pts, C24_A24plus, vphiP, vphiQ, vphiR);
 
-  get_4_isog_1x2x2x2w(vR, C24_A24plus, coeff__0, coeff2_1);
-  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 3);             
+  // unpack phiP, phiQ, phiR
+  unpack_point_1x2x2x2w(phiP, vphiP);
+  unpack_point_1x2x2x2w(phiQ, vphiQ);
+  unpack_point_1x2x2x2w(phiR, vphiR);
 
   // projective -> affine for phiP, phiQ, phiR
   // note that phiP, phiQ, phiR are now in radix-2^51 Montgomery domain (montR = 2^459)
   
   // 1. convert to radix-2^64
-  mpi_conv_51to64(phiP64->X[0], phiP->X[0], NWORDS_FIELD, VNWORDS);
-  mpi_conv_51to64(phiP64->X[1], phiP->X[1], NWORDS_FIELD, VNWORDS);
-  mpi_conv_51to64(phiP64->Z[0], phiP->Z[0], NWORDS_FIELD, VNWORDS);
-  mpi_conv_51to64(phiP64->Z[1], phiP->Z[1], NWORDS_FIELD, VNWORDS);
-  mpi_conv_51to64(phiQ64->X[0], phiQ->X[0], NWORDS_FIELD, VNWORDS);
-  mpi_conv_51to64(phiQ64->X[1], phiQ->X[1], NWORDS_FIELD, VNWORDS);
-  mpi_conv_51to64(phiQ64->Z[0], phiQ->Z[0], NWORDS_FIELD, VNWORDS);
-  mpi_conv_51to64(phiQ64->Z[1], phiQ->Z[1], NWORDS_FIELD, VNWORDS);
-  mpi_conv_51to64(phiR64->X[0], phiR->X[0], NWORDS_FIELD, VNWORDS);
-  mpi_conv_51to64(phiR64->X[1], phiR->X[1], NWORDS_FIELD, VNWORDS);
-  mpi_conv_51to64(phiR64->Z[0], phiR->Z[0], NWORDS_FIELD, VNWORDS);
-  mpi_conv_51to64(phiR64->Z[1], phiR->Z[1], NWORDS_FIELD, VNWORDS);
+  fp2conv_51to64_1w(phiP64->X, phiP->X);
+  fp2conv_51to64_1w(phiP64->Z, phiP->Z);
+  fp2conv_51to64_1w(phiQ64->X, phiQ->X);
+  fp2conv_51to64_1w(phiQ64->Z, phiQ->Z);
+  fp2conv_51to64_1w(phiR64->X, phiR->X);
+  fp2conv_51to64_1w(phiR64->Z, phiR->Z);
 
   // 2. convert phiP, phiQ, phiR to radix-2^64 Montgomery domain (montR = 2^448)
   // MontMul64(a', 2^437) = [a * 2^459] * 2^437 * 2^(-448) = a * 2^448 = a''
@@ -156,12 +125,12 @@ void EphemeralKeyGeneration_A(const unsigned char* PrivateKeyA, unsigned char* P
 
 void EphemeralSecretAgreement_A(const unsigned char* PrivateKeyA, const unsigned char* PublicKeyB, unsigned char* SharedSecretA)
 {
-  point_proj_r51_t R, pts[MAX_INT_POINTS_ALICE];
+  point_proj_r51_t R;
   f2elm_r51_t PKB[3];
   f2elm_r51_t A24plus = { 0 }, C24 = { 0 }, A = { 0 };
   digit_t SecretKeyA[NWORDS_ORDER] = { 0 };
-  int i, row, m, index = 0, pts_index[MAX_INT_POINTS_ALICE], npts = 0, ii = 0;
-  vgelm_t vR, C24_A24plus, coeff__0, coeff2_1;
+  int i;
+  vgelm_t C24_A24plus, pts[MAX_INT_POINTS_ALICE+1];
   f2elm_t PKB64[3], jinv64, A64 = { 0 }, C2464 = { 0 }, A24plus64 = { 0 };
 
   // Initialize images of Bob's basis
@@ -180,19 +149,15 @@ void EphemeralSecretAgreement_A(const unsigned char* PrivateKeyA, const unsigned
   fpmul_mont(PKB64[1][1], montRx2048, PKB64[1][1]);
   fpmul_mont(PKB64[2][0], montRx2048, PKB64[2][0]);
   fpmul_mont(PKB64[2][1], montRx2048, PKB64[2][1]);
-  mpi_conv_64to51(PKB[0][0], PKB64[0][0], VNWORDS, NWORDS_FIELD);
-  mpi_conv_64to51(PKB[0][1], PKB64[0][1], VNWORDS, NWORDS_FIELD);
-  mpi_conv_64to51(PKB[1][0], PKB64[1][0], VNWORDS, NWORDS_FIELD);
-  mpi_conv_64to51(PKB[1][1], PKB64[1][1], VNWORDS, NWORDS_FIELD);
-  mpi_conv_64to51(PKB[2][0], PKB64[2][0], VNWORDS, NWORDS_FIELD);
-  mpi_conv_64to51(PKB[2][1], PKB64[2][1], VNWORDS, NWORDS_FIELD);
+  fp2conv_64to51_1w(PKB[0], PKB64[0]);
+  fp2conv_64to51_1w(PKB[1], PKB64[1]);
+  fp2conv_64to51_1w(PKB[2], PKB64[2]);
 
   // convert A to radix-2^51
   // MontMul(A', 2^459) = [A * 2^448] * 2^459 * 2^(-448) = A * 2^459 = A''
   fpmul_mont(A64[0], montRx2048, A64[0]);
   fpmul_mont(A64[1], montRx2048, A64[1]);
-  mpi_conv_64to51(A[0], A64[0], VNWORDS, NWORDS_FIELD);
-  mpi_conv_64to51(A[1], A64[1], VNWORDS, NWORDS_FIELD);
+  fp2conv_64to51_1w(A, A64);
   mp_add_1w(C24[0], vmont_R, vmont_R);       // C24 = 2
   mp2_add_1w(A24plus, A, C24);               // A24plus = A+2C
   mp_add_1w(C24[0], C24[0], C24[0]);         // C24 = 4
@@ -210,42 +175,12 @@ void EphemeralSecretAgreement_A(const unsigned char* PrivateKeyA, const unsigned
   C24_A24plus[i] = _SET(0,     C24[1][i], 0, C24[0][i], \
                         0, A24plus[1][i], 0, A24plus[0][i]);
 
-  // Traverse tree
-  index = 0;
-  for (row = 1; row < MAX_Alice; row++) {
-    // update vR : < XR1' | XR1 | XR0' | XR0 | ZR1' | ZR1 | ZR0' | ZR0 >
-    for (i = 0; i < VGWORDS-1; i++) 
-      vR[i] = _SET(R->X[1][i+VGWORDS], R->X[1][i], R->X[0][i+VGWORDS], R->X[0][i], \
-                  R->Z[1][i+VGWORDS], R->Z[1][i], R->Z[0][i+VGWORDS], R->Z[0][i]);
-    vR[i] = _SET(0, R->X[1][i], 0, R->X[0][i], \
-                0, R->Z[1][i], 0, R->Z[0][i]);
-    
-    while (index < MAX_Alice-row) {
-      pointcopy_1w(pts[npts], R);
-      pts_index[npts++] = index;
-      m = strat_Alice[ii++];
-      xDBLe_1x2x2x2w(vR, R, C24_A24plus, 2*m);  // both vR and R get updated here
-      index += m;
-    }
-    
-    get_4_isog_1x2x2x2w(vR, C24_A24plus, coeff__0, coeff2_1);
-
-    // eval_4_isog could be parallelized in 1/2/4/8-way, depending on npts. 
-    eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, npts);
-
-    pointcopy_1w(R, pts[npts-1]);       // update R 
-    index = pts_index[npts-1];
-    npts -= 1;
-  }
-
-  // update vR : < XR1' | XR1 | XR0' | XR0 | ZR1' | ZR1 | ZR0' | ZR0 >
-  for (i = 0; i < VGWORDS-1; i++) 
-    vR[i] = _SET(R->X[1][i+VGWORDS], R->X[1][i], R->X[0][i+VGWORDS], R->X[0][i], \
-                 R->Z[1][i+VGWORDS], R->Z[1][i], R->Z[0][i+VGWORDS], R->Z[0][i]);
-  vR[i] = _SET(0, R->X[1][i], 0, R->X[0][i], \
-               0, R->Z[1][i], 0, R->Z[0][i]);
+  // pack R : < XR1' | XR1 | XR0' | XR0 | ZR1' | ZR1 | ZR0' | ZR0 > 
+  // R is packed into pts[0], the traversal keeps pts[] in this form 
+  pack_point_1x2x2x2w(pts[0], R);
 
-  get_4_isog_1x2x2x2w(vR, C24_A24plus, coeff__0, coeff2_1);
+  // Traverse tree
+  traverse_Alice_ss(pts, C24_A24plus);
 
   // extract constants
   get_channel_4x2w(A24plus[0], C24_A24plus, 0);
@@ -260,10 +195,8 @@ void EphemeralSecretAgreement_A(const unsigned char* PrivateKeyA, const unsigned
   carryp_1w(C24[1]);
 
   // convert A24plus, C24 to radix-2^64
-  mpi_conv_51to64(A24plus64[0], A24plus[0], NWORDS_FIELD, VNWORDS);
-  mpi_conv_51to64(A24plus64[1], A24plus[1], NWORDS_FIELD, VNWORDS);
-  mpi_conv_51to64(C2464[0], C24[0], NWORDS_FIELD, VNWORDS);
-  mpi_conv_51to64(C2464[1], C24[1], NWORDS_FIELD, VNWORDS);
+  fp2conv_51to64_1w(A24plus64, A24plus);
+  fp2conv_51to64_1w(C2464, C24);
   // MontMul64(a', 2^437) = [a * 2^459] * 2^437 * 2^(-448) = a * 2^448 = a''
   fpmul_mont(A24plus64[0], montRdiv2048, A24plus64[0]);
   fpmul_mont(A24plus64[1], montRdiv2048, A24plus64[1]);
@@ -279,11 +212,11 @@ void EphemeralSecretAgreement_A(const unsigned char* PrivateKeyA, const unsigned
 
 void EphemeralKeyGeneration_B(const unsigned char* PrivateKeyB, unsigned char* PublicKeyB)
 {
-  point_proj_r51_t R, phiP = { 0 }, phiQ = { 0 }, phiR = { 0 }, pts[MAX_INT_POINTS_BOB];
-  f2elm_r51_t XPB, XQB, XRB, A24plus = { 0 }, C24 = { 0 }, A = { 0 };
+  point_proj_r51_t phiP = { 0 }, phiQ = { 0 }, phiR = { 0 };
+  f2elm_r51_t XPB, XQB, XRB, A24plus = { 0 }, C24 = { 0 };
   digit_t SecretKeyB[NWORDS_ORDER] = { 0 };
-  int i, row, m, index = 0, pts_index[MAX_INT_POINTS_BOB], npts = 0, ii = 0;
-  vgelm_t vR, C24_A24plus, coeff1_0;
+  int i;
+  vgelm_t C24_A24plus, vphiP, vphiQ, vphiR, pts[MAX_INT_POINTS_BOB+1];
   point_proj_t phiP64 = { 0 }, phiQ64 = { 0 }, phiR64 = { 0 };
 
   // Initialize basis points
@@ -297,14 +230,14 @@ void EphemeralKeyGeneration_B(const unsigned char* PrivateKeyB, unsigned char* P
   fpcopy_1w(A24plus[0], vmont_R);       // A24plus = 1
   mp2_add_1w(A24plus, A24plus, A24plus);// A24plus = 2
   mp2_add_1w(C24, A24plus, A24plus);    // C24 = 4
-  mp2_add_1w(A, A24plus, C24);          // A = 6 
   mp2_add_1w(A24plus, C24, C24);        // A24plus = 8
 
   // Retrieve kernel point
   decode_to_digits(PrivateKeyB, SecretKeyB, SECRETKEY_B_BYTES, NWORDS_ORDER);
-  // vectorized Montgomery ladder (ladder step is 1x4x2x1w)
-  // the ouput R is in radix-2^51
-  LADDER3PT_1x4x2x1w(XPB, XQB, XRB, SecretKeyB, BOB, R, A); 
+  // fixed-basis Montgomery ladder (ladder step is 1x2x2x2w)
+  // the ouput R : < XR1' | XR1 | XR0' | XR0 | ZR1' | ZR1 | ZR0' | ZR0 > is 
+  // written into pts[0], the traversal keeps pts[] in this form 
+  LADDER3PT_fixed_1x2x2x2w(XPB, XRB, SecretKeyB, BOB, pts[0]); 
 
   // intialize C24_A24plus : < C1' | C1 | C0' | C0 | A1' | A1 | A0' | A0 >
   for (i = 0; i < VGWORDS-1; i++) 
@@ -315,60 +248,28 @@ void EphemeralKeyGeneration_B(const unsigned char* PrivateKeyB, unsigned char* P
   C24_A24plus[i] = _SET(0,     C24[1][i], 0, C24[0][i], \
                         0, A24plus[1][i], 0, A24plus[0][i]);
 
-  // Traverse tree 
-  index = 0;
-  for (row = 1; row < MAX_Bob; row++) {
-    // update vR : < XR1' | XR1 | XR0' | XR0 | ZR1' | ZR1 | ZR0' | ZR0 >
-    for (i = 0; i < VGWORDS-1; i++) 
-      vR[i] = _SET(R->X[1][i+VGWORDS], R->X[1][i], R->X[0][i+VGWORDS], R->X[0][i], \
-                  R->Z[1][i+VGWORDS], R->Z[1][i], R->Z[0][i+VGWORDS], R->Z[0][i]);
-    vR[i] = _SET(0, R->X[1][i], 0, R->X[0][i], \
-                 0, R->Z[1][i], 0, R->Z[0][i]);
-    
-    while (index < MAX_Bob-row) {
-      pointcopy_1w(pts[npts], R);
-      pts_index[npts++] = index;
-      m = strat_Bob[ii++];
-      xTPLe_1x2x2x2w(vR, R, C24_A24plus, m);    // both vR and R get updated here
-      index += m;
-    } 
-
-    get_3_isog_1x2x2x2w(vR, C24_A24plus, coeff1_0);
-
-    // eval_3_isog could be parallelized in 1/2/4/8-way, depending on npts. 
-    eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, npts+3);
-
-    pointcopy_1w(R, pts[npts-1]);       // update R 
-    index = pts_index[npts-1];
-    npts -= 1;
-  }
+  pack_point_1x2x2x2w(vphiP, phiP);
+  pack_point_1x2x2x2w(vphiQ, phiQ);
+  pack_point_1x2x2x2w(vphiR, phiR);
 
-  // update vR : < XR1' | XR1 | XR0' | XR0 | ZR1' | ZR1 | ZR0' | ZR0 >
-  for (i = 0; i < VGWORDS-1; i++) 
-    vR[i] = _SET(R->X[1][i+VGWORDS], R->X[1][i], R->X[0][i+VGWORDS], R->X[0][i], \
-                 R->Z[1][i+VGWORDS], R->Z[1][i], R->Z[0][i+VGWORDS], R->Z[0][i]);
-  vR[i] = _SET(0, R->X[1][i], 0, R->X[0][i], \
-               0, R->Z[1][i], 0, R->Z[0][i]);
+  // Traverse tree
+  traverse_Bob_kg(pts, C24_A24plus, vphiP, vphiQ, vphiR);
 
-  get_3_isog_1x2x2x2w(vR, C24_A24plus, coeff1_0);
-  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 3);           
+  // unpack phiP, phiQ, phiR
+  unpack_point_1x2x2x2w(phiP, vphiP);
+  unpack_point_1x2x2x2w(phiQ, vphiQ);
+  unpack_point_1x2x2x2w(phiR, vphiR);
 
   // projective -> affine for phiP, phiQ, phiR
   // note that phiP, phiQ, phiR are now in radix-2^51 Montgomery domain (montR = 2^459)
   
   // 1. convert to radix-2^64
-  mpi_conv_51to64(phiP64->X[0], phiP->X[0], NWORDS_FIELD, VNWORDS);
-  mpi_conv_51to64(phiP64->X[1], phiP->X[1], NWORDS_FIELD, VNWORDS);
-  mpi_conv_51to64(phiP64->Z[0], phiP->Z[0], NWORDS_FIELD, VNWORDS);
-  mpi_conv_51to64(phiP64->Z[1], phiP->Z[1], NWORDS_FIELD, VNWORDS);
-  mpi_conv_51to64(phiQ64->X[0], phiQ->X[0], NWORDS_FIELD, VNWORDS);
-  mpi_conv_51to64(phiQ64->X[1], phiQ->X[1], NWORDS_FIELD, VNWORDS);
-  mpi_conv_51to64(phiQ64->Z[0], phiQ->Z[0], NWORDS_FIELD, VNWORDS);
-  mpi_conv_51to64(phiQ64->Z[1], phiQ->Z[1], NWORDS_FIELD, VNWORDS);
-  mpi_conv_51to64(phiR64->X[0], phiR->X[0], NWORDS_FIELD, VNWORDS);
-  mpi_conv_51to64(phiR64->X[1], phiR->X[1], NWORDS_FIELD, VNWORDS);
-  mpi_conv_51to64(phiR64->Z[0], phiR->Z[0], NWORDS_FIELD, VNWORDS);
-  mpi_conv_51to64(phiR64->Z[1], phiR->Z[1], NWORDS_FIELD, VNWORDS);
+  fp2conv_51to64_1w(phiP64->X, phiP->X);
+  fp2conv_51to64_1w(phiP64->Z, phiP->Z);
+  fp2conv_51to64_1w(phiQ64->X, phiQ->X);
+  fp2conv_51to64_1w(phiQ64->Z, phiQ->Z);
+  fp2conv_51to64_1w(phiR64->X, phiR->X);
+  fp2conv_51to64_1w(phiR64->Z, phiR->Z);
 
   // 2. convert phiP, phiQ, phiR to radix-2^64 Montgomery domain (montR = 2^448)
   // MontMul64(a', 2^437) = [a * 2^459] * 2^437 * 2^(-448) = a * 2^448 = a''
@@ -399,12 +300,12 @@ void EphemeralKeyGeneration_B(const unsigned char* PrivateKeyB, unsigned char* P
 
 void EphemeralSecretAgreement_B(const unsigned char* PrivateKeyB, const unsigned char* PublicKeyA, unsigned char* SharedSecretB)
 {
-  point_proj_r51_t R, pts[MAX_INT_POINTS_BOB];
+  point_proj_r51_t R;
   f2elm_r51_t PKB[3];
   f2elm_r51_t A24plus = { 0 }, C24 = { 0 }, A = { 0 };
   digit_t SecretKeyB[NWORDS_ORDER] = { 0 };
-  int i, row, m, index = 0, pts_index[MAX_INT_POINTS_ALICE], npts = 0, ii = 0;
-  vgelm_t vR, C24_A24plus, coeff1_0;
+  int i;
+  vgelm_t C24_A24plus, pts[MAX_INT_POINTS_BOB+1];
   f2elm_t PKB64[3], jinv64, A64 = { 0 }, C2464 = { 0 }, A24plus64 = { 0 };
 
   // Initialize images of Alice's basis
@@ -423,19 +324,15 @@ void EphemeralSecretAgreement_B(const unsigned char* PrivateKeyB, const unsigned
   fpmul_mont(PKB64[1][1], montRx2048, PKB64[1][1]);
   fpmul_mont(PKB64[2][0], montRx2048, PKB64[2][0]);
   fpmul_mont(PKB64[2][1], montRx2048, PKB64[2][1]);
-  mpi_conv_64to51(PKB[0][0], PKB64[0][0], VNWORDS, NWORDS_FIELD);
-  mpi_conv_64to51(PKB[0][1], PKB64[0][1], VNWORDS, NWORDS_FIELD);
-  mpi_conv_64to51(PKB[1][0], PKB64[1][0], VNWORDS, NWORDS_FIELD);
-  mpi_conv_64to51(PKB[1][1], PKB64[1][1], VNWORDS, NWORDS_FIELD);
-  mpi_conv_64to51(PKB[2][0], PKB64[2][0], VNWORDS, NWORDS_FIELD);
-  mpi_conv_64to51(PKB[2][1], PKB64[2][1], VNWORDS, NWORDS_FIELD);
+  fp2conv_64to51_1w(PKB[0], PKB64[0]);
+  fp2conv_64to51_1w(PKB[1], PKB64[1]);
+  fp2conv_64to51_1w(PKB[2], PKB64[2]);
 
   // convert A to radix-2^51
   // MontMul(A', 2^459) = [A * 2^448] * 2^459 * 2^(-448) = A * 2^448 = A''
   fpmul_mont(A64[0], montRx2048, A64[0]);
   fpmul_mont(A64[1], montRx2048, A64[1]);
-  mpi_conv_64to51(A[0], A64[0], VNWORDS, NWORDS_FIELD);
-  mpi_conv_64to51(A[1], A64[1], VNWORDS, NWORDS_FIELD);
+  fp2conv_64to51_1w(A, A64);
   mp_add_1w(C24[0], vmont_R, vmont_R);       // C24 = 2
   mp2_add_1w(A24plus, A, C24);               // A24plus = A+2C
   mp_add_1w(C24[0], C24[0], C24[0]);         // C24 = 4
@@ -453,42 +350,12 @@ void EphemeralSecretAgreement_B(const unsigned char* PrivateKeyB, const unsigned
   C24_A24plus[i] = _SET(0,     C24[1][i], 0, C24[0][i], \
                         0, A24plus[1][i], 0, A24plus[0][i]);
 
-  // Traverse tree 
-  index = 0;
-  for (row = 1; row < MAX_Bob; row++) {
-    // update vR : < XR1' | XR1 | XR0' | XR0 | ZR1' | ZR1 | ZR0' | ZR0 >
-    for (i = 0; i < VGWORDS-1; i++) 
-      vR[i] = _SET(R->X[1][i+VGWORDS], R->X[1][i], R->X[0][i+VGWORDS], R->X[0][i], \
-                  R->Z[1][i+VGWORDS], R->Z[1][i], R->Z[0][i+VGWORDS], R->Z[0][i]);
-    vR[i] = _SET(0, R->X[1][i], 0, R->X[0][i], \
-                 0, R->Z[1][i], 0, R->Z[0][i]);
-    
-    while (index < MAX_Bob-row) {
-      pointcopy_1w(pts[npts], R);
-      pts_index[npts++] = index;
-      m = strat_Bob[ii++];
-      xTPLe_1x2x2x2w(vR, R, C24_A24plus, m);    // both vR and R get updated here
-      index += m;
-    } 
-
-    get_3_isog_1x2x2x2w(vR, C24_A24plus, coeff1_0);
-
-    // eval_3_isog could be parallelized in 1/2/4/8-way, depending on npts. 
-    eval_3_isog_parallel_ss(pts, coeff1_0, npts);
-
-    pointcopy_1w(R, pts[npts-1]);       // update R 
-    index = pts_index[npts-1];
-    npts -= 1;
-  }
+  // pack R : < XR1' | XR1 | XR0' | XR0 | ZR1' | ZR1 | ZR0' | ZR0 > 
+  // R is packed into pts[0], the traversal keeps pts[] in this form 
+  pack_point_1x2x2x2w(pts[0], R);
 
-  // update vR : < XR1' | XR1 | XR0' | XR0 | ZR1' | ZR1 | ZR0' | ZR0 >
-  for (i = 0; i < VGWORDS-1; i++) 
-    vR[i] = _SET(R->X[1][i+VGWORDS], R->X[1][i], R->X[0][i+VGWORDS], R->X[0][i], \
-                 R->Z[1][i+VGWORDS], R->Z[1][i], R->Z[0][i+VGWORDS], R->Z[0][i]);
-  vR[i] = _SET(0, R->X[1][i], 0, R->X[0][i], \
-               0, R->Z[1][i], 0, R->Z[0][i]);
-
-  get_3_isog_1x2x2x2w(vR, C24_A24plus, coeff1_0);
+  // Traverse tree
+  traverse_Bob_ss(pts, C24_A24plus);
 
   // extract constants
   get_channel_4x2w(A24plus[0], C24_A24plus, 0);
@@ -503,10 +370,8 @@ void EphemeralSecretAgreement_B(const unsigned char* PrivateKeyB, const unsigned
   carryp_1w(C24[1]);
 
   // convert A24plus, C24 to radix-2^64
-  mpi_conv_51to64(A24plus64[0], A24plus[0], NWORDS_FIELD, VNWORDS);
-  mpi_conv_51to64(A24plus64[1], A24plus[1], NWORDS_FIELD, VNWORDS);
-  mpi_conv_51to64(C2464[0], C24[0], NWORDS_FIELD, VNWORDS);
-  mpi_conv_51to64(C2464[1], C24[1], NWORDS_FIELD, VNWORDS);
+  fp2conv_51to64_1w(A24plus64, A24plus);
+  fp2conv_51to64_1w(C2464, C24);
   // MontMul64(a', 2^437) = [a * 2^459] * 2^437 * 2^(-448) = a * 2^448 = a''
   fpmul_mont(A24plus64[0], montRdiv2048, A24plus64[0]);
   fpmul_mont(A24plus64[1], montRdiv2048, A24plus64[1]);
@@ -520,20 +385,62 @@ void EphemeralSecretAgreement_B(const unsigned char* PrivateKeyB, const unsigned
   fp2_encode(jinv64, SharedSecretB);          // Format shared secret 
 }
 
-void EphemeralKeyGenSecAgr_A_parallel(const unsigned char* PrivateKeyA, unsigned char* PublicKeyA, const unsigned char* PublicKeyB, unsigned char* SharedSecretA)
+void PreparePublicKey_B(const unsigned char* PublicKeyB, prepared_pkB_t ppk)
+{ // Decode Bob's public key and compute the constants of his curve for repeated secret agreements
+  f2elm_r51_t PKB[3], A24plus = { 0 }, C24 = { 0 }, A = { 0 };
+  f2elm_t PKB64[3], A64 = { 0 };
+
+  // Initialize images of Bob's basis
+  fp2_decode(PublicKeyB, PKB64[0]);
+  fp2_decode(PublicKeyB + FP2_ENCODED_BYTES, PKB64[1]);
+  fp2_decode(PublicKeyB + 2*FP2_ENCODED_BYTES, PKB64[2]);
+
+  // Initialize constants: A24plus = A+2C, C24 = 4C, where C=1
+  get_A(PKB64[0], PKB64[1], PKB64[2], A64);
+
+  // convert PKB[3] to radix-2^51
+  // MontMul(PKB, 2^459) = [PKB * 2^448] * 2^459 * 2^(-448) = PKB * 2^459 = PKB''
+  fpmul_mont(PKB64[0][0], montRx2048, PKB64[0][0]);
+  fpmul_mont(PKB64[0][1], montRx2048, PKB64[0][1]);
+  fpmul_mont(PKB64[1][0], montRx2048, PKB64[1][0]);
+  fpmul_mont(PKB64[1][1], montRx2048, PKB64[1][1]);
+  fpmul_mont(PKB64[2][0], montRx2048, PKB64[2][0]);
+  fpmul_mont(PKB64[2][1], montRx2048, PKB64[2][1]);
+  fp2conv_64to51_1w(PKB[0], PKB64[0]);
+  fp2conv_64to51_1w(PKB[1], PKB64[1]);
+  fp2conv_64to51_1w(PKB[2], PKB64[2]);
+
+  // convert A to radix-2^51
+  // MontMul(A', 2^459) = [A * 2^448] * 2^459 * 2^(-448) = A * 2^448 = A''
+  fpmul_mont(A64[0], montRx2048, A64[0]);
+  fpmul_mont(A64[1], montRx2048, A64[1]);
+  fp2conv_64to51_1w(A, A64);
+  mp_add_1w(C24[0], vmont_R, vmont_R);          // C24 = 2
+  mp2_add_1w(A24plus, A, C24);                  // A24plus = A+2C
+  mp_add_1w(C24[0], C24[0], C24[0]);            // C24 = 4
+
+  fp2copy_1w(ppk->PKB[0], PKB[0]);
+  fp2copy_1w(ppk->PKB[1], PKB[1]);
+  fp2copy_1w(ppk->PKB[2], PKB[2]);
+  fp2copy_1w(ppk->A, A);
+  fp2copy_1w(ppk->A24plus, A24plus);
+  fp2copy_1w(ppk->C24, C24);
+}
+
+
+void EphemeralKeyGenSecAgr_A_prepared(const unsigned char* PrivateKeyA, unsigned char* PublicKeyA, const prepared_pkB_t ppk, unsigned char* SharedSecretA)
 {
-  point_proj_r51_t R, phiP = { 0 }, phiQ = { 0 }, phiR = { 0 }, pts[MAX_INT_POINTS_ALICE];
+  point_proj_r51_t R, phiP = { 0 }, phiQ = { 0 }, phiR = { 0 };
   f2elm_r51_t XPA, XQA, XRA, A24plus = { 0 }, C24 = { 0 }, A = { 0 };
   digit_t SecretKeyA[NWORDS_ORDER] = { 0 };
-  int i, row, m, index = 0, pts_index[MAX_INT_POINTS_ALICE], npts = 0, ii = 0;
+  int i;
   point_proj_t phiP64 = { 0 }, phiQ64 = { 0 }, phiR64 = { 0 };
 
-  point_proj_r51_t _R, _pts[MAX_INT_POINTS_ALICE];
-  f2elm_r51_t _PKB[3];
-  f2elm_r51_t _A24plus = { 0 }, _C24 = { 0 }, _A = { 0 };
-  f2elm_t _PKB64[3], _jinv64, _A64 = { 0 }, _C2464 = { 0 }, _A24plus64 = { 0 };
+  point_proj_r51_t _R;
+  f2elm_r51_t _A24plus, _C24;
+  f2elm_t _jinv64, _C2464 = { 0 }, _A24plus64 = { 0 };
 
-  vfelm_t vR, C24_A24plus, coeff__0, coeff2_1;
+  vfelm_t C24_A24plus, vphiP, vphiQ, vphiR, pts[MAX_INT_POINTS_ALICE+1];
 
   // ---------------------------------------------------------------------------
   // KeyGen part
@@ -555,38 +462,9 @@ void EphemeralKeyGenSecAgr_A_parallel(const unsigned char* PrivateKeyA, unsigned
   // ---------------------------------------------------------------------------
   // SecAgr part
 
-  // Initialize images of Bob's basis
-  fp2_decode(PublicKeyB, _PKB64[0]);
-  fp2_decode(PublicKeyB + FP2_ENCODED_BYTES, _PKB64[1]);
-  fp2_decode(PublicKeyB + 2*FP2_ENCODED_BYTES, _PKB64[2]);
-
-  // Initialize constants: A24plus = A+2C, C24 = 4C, where C=1
-  get_A(_PKB64[0], _PKB64[1], _PKB64[2], _A64);
-
-  // convert PKB[3] to radix-2^51
-  // MontMul(PKB, 2^459) = [PKB * 2^448] * 2^459 * 2^(-448) = PKB * 2^459 = PKB''
-  fpmul_mont(_PKB64[0][0], montRx2048, _PKB64[0][0]);
-  fpmul_mont(_PKB64[0][1], montRx2048, _PKB64[0][1]);
-  fpmul_mont(_PKB64[1][0], montRx2048, _PKB64[1][0]);
-  fpmul_mont(_PKB64[1][1], montRx2048, _PKB64[1][1]);
-  fpmul_mont(_PKB64[2][0], montRx2048, _PKB64[2][0]);
-  fpmul_mont(_PKB64[2][1], montRx2048, _PKB64[2][1]);
-  mpi_conv_64to51(_PKB[0][0], _PKB64[0][0], VNWORDS, NWORDS_FIELD);
-  mpi_conv_64to51(_PKB[0][1], _PKB64[0][1], VNWORDS, NWORDS_FIELD);
-  mpi_conv_64to51(_PKB[1][0], _PKB64[1][0], VNWORDS, NWORDS_FIELD);
-  mpi_conv_64to51(_PKB[1][1], _PKB64[1][1], VNWORDS, NWORDS_FIELD);
-  mpi_conv_64to51(_PKB[2][0], _PKB64[2][0], VNWORDS, NWORDS_FIELD);
-  mpi_conv_64to51(_PKB[2][1], _PKB64[2][1], VNWORDS, NWORDS_FIELD);
-
-  // convert A to radix-2^51
-  // MontMul(A', 2^459) = [A * 2^448] * 2^459 * 2^(-448) = A * 2^448 = A''
-  fpmul_mont(_A64[0], montRx2048, _A64[0]);
-  fpmul_mont(_A64[1], montRx2048, _A64[1]);
-  mpi_conv_64to51(_A[0], _A64[0], VNWORDS, NWORDS_FIELD);
-  mpi_conv_64to51(_A[1], _A64[1], VNWORDS, NWORDS_FIELD);
-  mp_add_1w(_C24[0], vmont_R, vmont_R);         // C24 = 2
-  mp2_add_1w(_A24plus, _A, _C24);               // A24plus = A+2C
-  mp_add_1w(_C24[0], _C24[0], _C24[0]);         // C24 = 4
+  // Constants of Bob's curve
+  fp2copy_1w(_A24plus, ppk->A24plus);
+  fp2copy_1w(_C24, ppk->C24);
 
   // ---------------------------------------------------------------------------
   // Parallel part
@@ -596,7 +474,7 @@ void EphemeralKeyGenSecAgr_A_parallel(const unsigned char* PrivateKeyA, unsigned
 
   // LADDER3PT_1x4x2x1w(XPA, XQA, XRA, SecretKeyA, ALICE, R, A); 
   // LADDER3PT_1x4x2x1w(_PKB[0], _PKB[1], _PKB[2], SecretKeyA, ALICE, _R, _A);   
-  LADDER3PT_2x4x1x1w(XPA, XQA, XRA, _PKB[0], _PKB[1], _PKB[2], SecretKeyA, ALICE, R, A, _R, _A);  
+  LADDER3PT_2x4x1x1w(XPA, XQA, XRA, ppk->PKB[0], ppk->PKB[1], ppk->PKB[2], SecretKeyA, ALICE, R, A, _R, ppk->A);
 
 
   // intialize C24_A24plus :  <  C1 | C0 | A1 | A0 | _C1 | _C0 | _A1 | _A0 >
@@ -604,42 +482,22 @@ void EphemeralKeyGenSecAgr_A_parallel(const unsigned char* PrivateKeyA, unsigned
     C24_A24plus[i] = _SET( C24[1][i],  C24[0][i],  A24plus[1][i],  A24plus[0][i], \
                           _C24[1][i], _C24[0][i], _A24plus[1][i], _A24plus[0][i]);
 
-  // Traverse tree 
-  // Use 2x2x2x1w isog instead of 1x2x2x2w isog -> 8x1w fp instead of 4x2w fp (big difference)
-  index = 0;
-  for (row = 1; row < MAX_Alice; row++) {
-    // update vR : < XR1 |  XR0 | ZR1 | ZR0 | _XR1 | _XR0 | _ZR1 |  _ZR0 >
-    for (i = 0; i < VNWORDS; i++) 
-      vR[i] = _SET( R->X[1][i],  R->X[0][i],  R->Z[1][i],  R->Z[0][i], \
-                   _R->X[1][i], _R->X[0][i], _R->Z[1][i], _R->Z[0][i]);
-
-    while (index < MAX_Alice-row) {
-      pointcopy_1w(pts[npts], R);
-      pointcopy_1w(_pts[npts], _R);
-      pts_index[npts++] = index;
-      m = strat_Alice[ii++];
-      xDBLe_2x2x2x1w(vR, R, _R, C24_A24plus, 2*m);  // all vR, R, _R get updated here
-      index += m;
-    }
-
-    get_4_isog_2x2x2x1w(vR, C24_A24plus, coeff__0, coeff2_1);
-
-    // eval_4_isog could be parallelized in 1/2/4/8-way, depending on npts. 
-    eval_4_isog_parallel_kgss(pts, _pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 2*npts+3);
-
-    pointcopy_1w(R, pts[npts-1]);       // update R 
-    pointcopy_1w(_R, _pts[npts-1]);     // update _R 
-    index = pts_index[npts-1];
-    npts -= 1;
-  }
+  // pack R, _R : < XR1 |  XR0 | ZR1 | ZR0 | _XR1 | _XR0 | _ZR1 |  _ZR0 >
+  // and phiP, phiQ, phiR : < X1 | X0 | Z1 | Z0 | % | % | % | % > 
+  // R, _R are packed into pts[0], the traversal keeps pts[] in this form 
+  pack_points_2x2x2x1w(pts[0], R, _R);
+  pack_points_2x2x2x1w(vphiP, phiP, phiP);
+  pack_points_2x2x2x1w(vphiQ, phiQ, phiQ);
+  pack_points_2x2x2x1w(vphiR, phiR, phiR);
 
-  // update vR : < XR1 |  XR0 | ZR1 | ZR0 | _XR1 | _XR0 | _ZR1 |  _ZR0 >
-  for (i = 0; i < VNWORDS; i++) 
-    vR[i] = _SET( R->X[1][i],  R->X[0][i],  R->Z[1][i],  R->Z[0][i], \
-                 _R->X[1][i], _R->X[0][i], _R->Z[1][i], _R->Z[0][i]);
+  // Traverse tree
+  // Use 2x2x2x1w isog instead of 1x2x2x2w isog -> 8x1w fp instead of 4x2w fp (big difference)
+  traverse_Alice_kgss(pts, C24_A24plus, vphiP, vphiQ, vphiR);
 
-  get_4_isog_2x2x2x1w(vR, C24_A24plus, coeff__0, coeff2_1);
-  eval_4_isog_parallel_kgss(pts, _pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 3); 
+  // unpack phiP, phiQ, phiR
+  unpack_point_2x2x2x1w(phiP, vphiP, 4);
+  unpack_point_2x2x2x1w(phiQ, vphiQ, 4);
+  unpack_point_2x2x2x1w(phiR, vphiR, 4);
 
   // ---------------------------------------------------------------------------
   // KeyGen part
@@ -647,18 +505,12 @@ void EphemeralKeyGenSecAgr_A_parallel(const unsigned char* PrivateKeyA, unsigned
   // note that phiP, phiQ, phiR are now in radix-2^51 Montgomery domain (montR = 2^459)
   
   // 1. convert to radix-2^64
-  mpi_conv_51to64(phiP64->X[0], phiP->X[0], NWORDS_FIELD, VNWORDS);
-  mpi_conv_51to64(phiP64->X[1], phiP->X[1], NWORDS_FIELD, VNWORDS);
-  mpi_conv_51to64(phiP64->Z[0], phiP->Z[0], NWORDS_FIELD, VNWORDS);
-  mpi_conv_51to64(phiP64->Z[1], phiP->Z[1], NWORDS_FIELD, VNWORDS);
-  mpi_conv_51to64(phiQ64->X[0], phiQ->X[0], NWORDS_FIELD, VNWORDS);
-  mpi_conv_51to64(phiQ64->X[1], phiQ->X[1], NWORDS_FIELD, VNWORDS);
-  mpi_conv_51to64(phiQ64->Z[0], phiQ->Z[0], NWORDS_FIELD, VNWORDS);
-  mpi_conv_51to64(phiQ64->Z[1], phiQ->Z[1], NWORDS_FIELD, VNWORDS);
-  mpi_conv_51to64(phiR64->X[0], phiR->X[0], NWORDS_FIELD, VNWORDS);
-  mpi_conv_51to64(phiR64->X[1], phiR->X[1], NWORDS_FIELD, VNWORDS);
-  mpi_conv_51to64(phiR64->Z[0], phiR->Z[0], NWORDS_FIELD, VNWORDS);
-  mpi_conv_51to64(phiR64->Z[1], phiR->Z[1], NWORDS_FIELD, VNWORDS);
+  fp2conv_51to64_1w(phiP64->X, phiP->X);
+  fp2conv_51to64_1w(phiP64->Z, phiP->Z);
+  fp2conv_51to64_1w(phiQ64->X, phiQ->X);
+  fp2conv_51to64_1w(phiQ64->Z, phiQ->Z);
+  fp2conv_51to64_1w(phiR64->X, phiR->X);
+  fp2conv_51to64_1w(phiR64->Z, phiR->Z);
 
   // 2. convert phiP, phiQ, phiR to radix-2^64 Montgomery domain (montR = 2^448)
   // MontMul64(a', 2^439) = [a * 2^459] * 2^439 * 2^(-448) = a * 2^448 = a''
@@ -696,10 +548,8 @@ void EphemeralKeyGenSecAgr_A_parallel(const unsigned char* PrivateKeyA, unsigned
   get_channel_8x1w(_C24[1], C24_A24plus, 3);
 
   // convert A24plus, C24 to radix-2^64
-  mpi_conv_51to64(_A24plus64[0], _A24plus[0], NWORDS_FIELD, VNWORDS);
-  mpi_conv_51to64(_A24plus64[1], _A24plus[1], NWORDS_FIELD, VNWORDS);
-  mpi_conv_51to64(_C2464[0], _C24[0], NWORDS_FIELD, VNWORDS);
-  mpi_conv_51to64(_C2464[1], _C24[1], NWORDS_FIELD, VNWORDS);
+  fp2conv_51to64_1w(_A24plus64, _A24plus);
+  fp2conv_51to64_1w(_C2464, _C24);
   // MontMul64(a', 2^439) = [a * 2^459] * 2^439 * 2^(-448) = a * 2^448 = a''
   fpmul_mont(_A24plus64[0], montRdiv2048, _A24plus64[0]);
   fpmul_mont(_A24plus64[1], montRdiv2048, _A24plus64[1]);
@@ -712,3 +562,12 @@ void EphemeralKeyGenSecAgr_A_parallel(const unsigned char* PrivateKeyA, unsigned
   j_inv(_A24plus64, _C2464, _jinv64);  
   fp2_encode(_jinv64, SharedSecretA);          // Format shared secret 
 }
+
+
+void EphemeralKeyGenSecAgr_A_parallel(const unsigned char* PrivateKeyA, unsigned char* PublicKeyA, const unsigned char* PublicKeyB, unsigned char* SharedSecretA)
+{
+  prepared_pkB_t ppk;
+
+  PreparePublicKey_B(PublicKeyB, ppk);
+  EphemeralKeyGenSecAgr_A_prepared(PrivateKeyA, PublicKeyA, ppk, SharedSecretA);
+}
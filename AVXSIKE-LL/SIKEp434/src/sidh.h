@@ -57,25 +57,60 @@ static const uint64_t vB_gen[6*VNWORDS] = {
 };
 
 // Fixed parameters for isogeny tree computation
-static const unsigned int strat_Alice[MAX_Alice-1] = { 
-  48, 28, 16, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 
-  2, 1, 1, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 
-  1, 1, 13, 7, 4, 2, 1, 1, 2, 1, 1, 3, 2, 1, 1, 
-  1, 1, 5, 4, 2, 1, 1, 2, 1, 1, 2, 1, 1, 1, 21, 
-  12, 7, 4, 2, 1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 
-  5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 9, 5, 3, 2, 1, 
-  1, 1, 1, 2, 1, 1, 1, 4, 2, 1, 1, 1, 2, 1, 1 };
-
-static const unsigned int strat_Bob[MAX_Bob-1] = { 
-  66, 33, 17, 9, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 4, 
-  2, 1, 1, 1, 2, 1, 1, 8, 4, 2, 1, 1, 1, 2, 1, 1, 4, 
-  2, 1, 1, 2, 1, 1, 16, 8, 4, 2, 1, 1, 1, 2, 1, 1, 
-  4, 2, 1, 1, 2, 1, 1, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 
-  1, 1, 2, 1, 1, 32, 16, 8, 4, 3, 1, 1, 1, 1, 2, 1, 
-  1, 4, 2, 1, 1, 2, 1, 1, 8, 4, 2, 1, 1, 2, 1, 1, 4, 
-  2, 1, 1, 2, 1, 1, 16, 8, 4, 2, 1, 1, 2, 1, 1, 4, 
-  2, 1, 1, 2, 1, 1, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 
-  1, 2, 1, 1 };
+// The strategies are optimal for the cost model of this implementation: a 
+// strategy step is a 1x2x2x2w xDBLe/xTPLe (2x2x2x1w xDBLe for kgss) and each 
+// isogeny is evaluated at all stacked points at once in the lanes of the 
+// parallel evaluation (eval_*_isog_parallel_*), whose cost grows in batches of
+// up to 8 points rather than per point. kg strategies also count the 3 
+// images phiP, phiQ, phiR. The tables are generated by tools/strategy.c.
+static const unsigned int strat_Alice_kg[MAX_Alice-1] = { 
+  35, 23, 15, 10, 7, 5, 4, 3, 2, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 3, 2, 1, 1,
+  1, 1, 1, 1, 1, 5, 3, 2, 1, 1, 1, 1, 1, 1, 1, 2,
+  1, 1, 1, 8, 5, 3, 2, 1, 1, 1, 1, 1, 1, 1, 2, 1,
+  1, 1, 3, 2, 1, 1, 1, 1, 1, 12, 8, 5, 3, 2, 1, 1,
+  1, 1, 1, 1, 1, 2, 1, 1, 1, 3, 2, 1, 1, 1, 1, 1,
+  4, 3, 2, 1, 1, 1, 1, 1, 1, 1, 1 };
+
+static const unsigned int strat_Alice_ss[MAX_Alice-1] = { 
+  32, 24, 17, 12, 8, 5, 3, 2, 1, 1, 1, 1, 1, 1, 1, 2,
+  1, 1, 1, 3, 2, 1, 1, 1, 1, 1, 4, 3, 2, 1, 1, 1,
+  1, 1, 1, 1, 1, 5, 4, 3, 2, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 7, 5, 4, 3, 2, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 9, 6, 5, 4,
+  3, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1,
+  1, 1, 1, 3, 2, 1, 1, 1, 1, 1, 1 };
+
+static const unsigned int strat_Alice_kgss[MAX_Alice-1] = { 
+  43, 28, 16, 9, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 4,
+  2, 1, 1, 1, 2, 1, 1, 7, 4, 2, 1, 1, 1, 2, 1, 1,
+  3, 2, 1, 1, 1, 1, 12, 7, 4, 2, 1, 1, 1, 2, 1, 1,
+  3, 2, 1, 1, 1, 1, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1,
+  1, 16, 11, 7, 4, 2, 1, 1, 1, 2, 1, 1, 3, 2, 1, 1,
+  1, 1, 4, 3, 2, 1, 1, 1, 1, 2, 1, 1, 7, 4, 2, 1,
+  1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1 };
+
+static const unsigned int strat_Bob_kg[MAX_Bob-1] = { 
+  36, 26, 19, 16, 13, 9, 6, 4, 3, 2, 1, 1, 1, 1, 1, 1,
+  1, 1, 2, 1, 1, 1, 1, 3, 2, 1, 1, 1, 1, 1, 1, 4,
+  3, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 4, 3, 3, 2, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 5, 4, 3, 2, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 7, 5, 4, 3,
+  2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2,
+  1, 1, 1, 1, 1, 10, 7, 5, 4, 3, 2, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 3,
+  2, 1, 1, 1, 1, 1, 1, 1 };
+
+static const unsigned int strat_Bob_ss[MAX_Bob-1] = { 
+  36, 26, 19, 14, 10, 11, 8, 5, 3, 2, 1, 1, 1, 1, 1, 2,
+  1, 1, 1, 3, 2, 1, 1, 1, 1, 1, 3, 3, 2, 1, 1, 1,
+  1, 1, 1, 1, 3, 2, 1, 1, 1, 1, 1, 1, 1, 4, 3, 2,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 5, 4, 3, 2, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 7, 5, 4, 3,
+  2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2,
+  1, 1, 1, 1, 1, 10, 7, 5, 4, 3, 2, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 3,
+  2, 1, 1, 1, 1, 1, 1, 1 };
 
 // 2^448 / 2^11 = 2^437
 static const uint64_t montRdiv2048[NWORDS_FIELD] = {
@@ -87,6 +122,11 @@ static const uint64_t montRx2048[NWORDS_FIELD] = {
   0x0000000003A1635C, 0x0000000000000000, 0x0000000000000000, 0x9B6230D6C000000, 
   0x3EC936E7377BF6E0, 0x72D0AE5FC7CFC438, 0x00005C9696AF9D6B };
 
+// Bob's public key in radix-2^51 Montgomery form with the constants of his curve: 
+// A, A24plus = A+2C, C24 = 4C (C = 1)
+typedef struct { f2elm_r51_t PKB[3]; f2elm_r51_t A; f2elm_r51_t A24plus; f2elm_r51_t C24; } prepared_pkB;
+typedef prepared_pkB prepared_pkB_t[1];
+
 void random_mod_order_B(unsigned char* random_digits);
 
 void EphemeralKeyGeneration_A(const unsigned char* PrivateKeyA, unsigned char* PublicKeyA);
@@ -95,6 +135,8 @@ void EphemeralSecretAgreement_A(const unsigned char* PrivateKeyA, const unsigned
 void EphemeralSecretAgreement_B(const unsigned char* PrivateKeyB, const unsigned char* PublicKeyA, unsigned char* SharedSecretB);
 
 void EphemeralKeyGenSecAgr_A_parallel(const unsigned char* PrivateKeyA, unsigned char* PublicKeyA, const unsigned char* PublicKeyB, unsigned char* SharedSecretA);
+void PreparePublicKey_B(const unsigned char* PublicKeyB, prepared_pkB_t ppk);
+void EphemeralKeyGenSecAgr_A_prepared(const unsigned char* PrivateKeyA, unsigned char* PublicKeyA, const prepared_pkB_t ppk, unsigned char* SharedSecretA);
 
 #endif
 
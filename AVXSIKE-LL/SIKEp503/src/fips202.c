@@ -378,6 +378,107 @@ static void keccak_squeezeblocks(unsigned char *h, unsigned long long int nblock
   }
 }
 
+// AVX-512 single-state implementation: the state is held in 5 row vectors a[y] 
+// with lane x of a[y] = A[x][y] (lanes 5..7 are unused). Theta and chi use 
+// vpternlogq and rho uses vprolvq. Pi permutes the lanes of every row such that 
+// lane y of row x holds the pi output B[x][y]: chi then combines whole vectors
+// without lane shifts, and a 5x5 transpose (vpermt2q) returns to rows
+#include "intrin.h"
+
+static inline void KeccakF1600_StatePermute_avx512(__m512i *a)
+{
+  const __m512i xm1 = VSET(0, 0, 0, 3, 2, 1, 0, 4), xp1 = VSET(0, 0, 0, 0, 4, 3, 2, 1);
+  const __m512i rho0 = VSET(0, 0, 0, 27, 28, 62,  1,  0), rho1 = VSET(0, 0, 0, 20, 55,  6, 44, 36);
+  const __m512i rho2 = VSET(0, 0, 0, 39, 25, 43, 10,  3), rho3 = VSET(0, 0, 0,  8, 21, 15, 45, 41);
+  const __m512i rho4 = VSET(0, 0, 0, 14, 56, 61,  2, 18);
+  const __m512i pi0 = VSET(0, 0, 0, 2, 4, 1, 3, 0), pi1 = VSET(0, 0, 0, 3, 0, 2, 4, 1);
+  const __m512i pi2 = VSET(0, 0, 0, 4, 1, 3, 0, 2), pi3 = VSET(0, 0, 0, 0, 2, 4, 1, 3);
+  const __m512i pi4 = VSET(0, 0, 0, 1, 3, 0, 2, 4);
+  const __m512i lo = VSET(11,  3, 10,  2,  9,  1,  8,  0), hi = VSET(0, 0, 0, 0, 0, 0, 12,  4);
+  const __m512i m0 = VSET(0, 0, 0, 0,  9,  8,  1,  0), m1 = VSET(0, 0, 0, 0, 11, 10,  3,  2);
+  const __m512i m2 = VSET(0, 0, 0, 0, 13, 12,  5,  4), m3 = VSET(0, 0, 0, 0, 15, 14,  7,  6);
+  __m512i c, d, b0, b1, b2, b3, b4, t0, t1, t2, t3;
+  int i;
+
+  for (i = 0; i < NROUNDS; i++) {
+    // theta
+    c = VTERNLOG(VTERNLOG(a[0], a[1], a[2], 0x96), a[3], a[4], 0x96);
+    d = VROL(VPERMV(xp1, c), 1);
+    c = VPERMV(xm1, c);
+
+    // rho + pi: lane y of b_x = rot(A[(x+3y)%5][x]) = B[x][y]
+    b0 = VPERMV(pi0, VROLV(VTERNLOG(a[0], c, d, 0x96), rho0));
+    b1 = VPERMV(pi1, VROLV(VTERNLOG(a[1], c, d, 0x96), rho1));
+    b2 = VPERMV(pi2, VROLV(VTERNLOG(a[2], c, d, 0x96), rho2));
+    b3 = VPERMV(pi3, VROLV(VTERNLOG(a[3], c, d, 0x96), rho3));
+    b4 = VPERMV(pi4, VROLV(VTERNLOG(a[4], c, d, 0x96), rho4));
+
+    // chi + iota: A[x][y] = B[x][y] ^ (~B[x+1][y] & B[x+2][y])
+    c  = VTERNLOG(b0, b1, b2, 0xD2);
+    d  = VTERNLOG(b1, b2, b3, 0xD2);
+    b2 = VTERNLOG(b2, b3, b4, 0xD2);
+    b3 = VTERNLOG(b3, b4, b0, 0xD2);
+    b4 = VTERNLOG(b4, b0, b1, 0xD2);
+    c  = VXOR(c, VSET(0, 0, 0, 0, 0, 0, 0, KeccakF_RoundConstants[i]));
+
+    // transpose back to rows
+    t0 = VPERMV2(c, lo, d);
+    t1 = VPERMV2(c, hi, d);
+    t2 = VPERMV2(b2, lo, b3);
+    t3 = VPERMV2(b2, hi, b3);
+    a[0] = VMPERMV(VPERMV2(t0, m0, t2), 0x10, VSET1(0), b4);
+    a[1] = VMPERMV(VPERMV2(t0, m1, t2), 0x10, VSET1(1), b4);
+    a[2] = VMPERMV(VPERMV2(t0, m2, t2), 0x10, VSET1(2), b4);
+    a[3] = VMPERMV(VPERMV2(t0, m3, t2), 0x10, VSET1(3), b4);
+    a[4] = VMPERMV(VPERMV2(t1, m0, t3), 0x10, VSET1(4), b4);
+  }
+}
+
+// add the first n <= 25 lanes of m to the row state 
+static inline void keccak_addlanes_avx512(__m512i *a, const unsigned char *m, unsigned int n)
+{
+  unsigned int y, k;
+
+  for (y = 0; y < 5 && 5*y < n; y++) {
+    k = (n-5*y < 5) ? n-5*y : 5;
+    a[y] = VXOR(a[y], VZLOAD((1 << k) - 1, m + 40*y));
+  }
+}
+
+static void keccak_absorb_avx512(__m512i *a, unsigned int r, const unsigned char *m, unsigned long long int mlen, unsigned char p)
+{
+  unsigned long long i;
+  unsigned char t[200] = { 0 };
+
+  while (mlen >= r) {
+    keccak_addlanes_avx512(a, m, r/8);
+    KeccakF1600_StatePermute_avx512(a);
+    mlen -= r;
+    m += r;
+  }
+
+  for (i = 0; i < mlen; ++i)
+    t[i] = m[i];
+  t[i] = p;
+  t[r - 1] |= 128;
+  keccak_addlanes_avx512(a, t, r/8);
+}
+
+static void keccak_squeezeblocks_avx512(unsigned char *h, unsigned long long int nblocks, __m512i *a, unsigned int r)
+{
+  unsigned int y, k;
+
+  while (nblocks > 0) {
+    KeccakF1600_StatePermute_avx512(a);
+    for (y = 0; y < 5 && 5*y < r/8; y++) {
+      k = (r/8-5*y < 5) ? r/8-5*y : 5;
+      VMSTORE(h + 40*y, (1 << k) - 1, a[y]);
+    }
+    h += r;
+    nblocks--;
+  }
+}
+
 /********** SHAKE256 ***********/
 
 void shake256_absorb(uint64_t *s, const unsigned char *input, unsigned int inputByteLen)
@@ -394,26 +495,26 @@ void shake256_squeezeblocks(unsigned char *output, unsigned long long nblocks, u
 
 void shake256(unsigned char *output, unsigned long long outlen, const unsigned char *input,  unsigned long long inlen)
 {
-  uint64_t s[25];
+  __m512i s[5];
   unsigned char t[SHAKE256_RATE];
   unsigned long long nblocks = outlen/SHAKE256_RATE;
   size_t i;
 
-  for (i = 0; i < 25; ++i)
-    s[i] = 0;
+  for (i = 0; i < 5; ++i)
+    s[i] = VZERO;
   
   /* Absorb input */
-  keccak_absorb(s, SHAKE256_RATE, input, inlen, 0x1F);
+  keccak_absorb_avx512(s, SHAKE256_RATE, input, inlen, 0x1F);
 
   /* Squeeze output */
-  keccak_squeezeblocks(output, nblocks, s, SHAKE256_RATE);
+  keccak_squeezeblocks_avx512(output, nblocks, s, SHAKE256_RATE);
 
   output += nblocks*SHAKE256_RATE;
   outlen -= nblocks*SHAKE256_RATE;
 
   if (outlen) 
   {
-    keccak_squeezeblocks(t, 1, s, SHAKE256_RATE);
+    keccak_squeezeblocks_avx512(t, 1, s, SHAKE256_RATE);
     for (i = 0; i < outlen; i++)
       output[i] = t[i];
   }
@@ -493,3 +594,35 @@ static void keccak_squeezeblocksx8(uint8_t *h0, uint8_t *h1, uint8_t *h2, uint8_
     nblocks--;
   }
 }
+
+// 8 independent SHAKE256 instances with equal input and output lengths 
+void shake256x8(uint8_t *out0, uint8_t *out1, uint8_t *out2, uint8_t *out3, 
+                uint8_t *out4, uint8_t *out5, uint8_t *out6, uint8_t *out7, unsigned long long outlen,
+                const uint8_t *in0, const uint8_t *in1, const uint8_t *in2, const uint8_t *in3, 
+                const uint8_t *in4, const uint8_t *in5, const uint8_t *in6, const uint8_t *in7, unsigned long long inlen)
+{
+  __m512i s[25];
+  uint8_t t0[SHAKE256_RATE], t1[SHAKE256_RATE], t2[SHAKE256_RATE], t3[SHAKE256_RATE];
+  uint8_t t4[SHAKE256_RATE], t5[SHAKE256_RATE], t6[SHAKE256_RATE], t7[SHAKE256_RATE];
+  unsigned long long nblocks = outlen/SHAKE256_RATE;
+  unsigned int i;
+
+  for (i = 0; i < 25; i++) s[i] = VZERO;
+
+  keccak_absorbx8(s, SHAKE256_RATE, in0, in1, in2, in3, in4, in5, in6, in7, inlen, 0x1F);
+  keccak_squeezeblocksx8(out0, out1, out2, out3, out4, out5, out6, out7, nblocks, s, SHAKE256_RATE);
+
+  out0 += nblocks*SHAKE256_RATE; out1 += nblocks*SHAKE256_RATE; 
+  out2 += nblocks*SHAKE256_RATE; out3 += nblocks*SHAKE256_RATE;
+  out4 += nblocks*SHAKE256_RATE; out5 += nblocks*SHAKE256_RATE; 
+  out6 += nblocks*SHAKE256_RATE; out7 += nblocks*SHAKE256_RATE;
+  outlen -= nblocks*SHAKE256_RATE;
+
+  if (outlen) {
+    keccak_squeezeblocksx8(t0, t1, t2, t3, t4, t5, t6, t7, 1, s, SHAKE256_RATE);
+    for (i = 0; i < outlen; i++) {
+      out0[i] = t0[i]; out1[i] = t1[i]; out2[i] = t2[i]; out3[i] = t3[i];
+      out4[i] = t4[i]; out5[i] = t5[i]; out6[i] = t6[i]; out7[i] = t7[i];
+    }
+  }
+}
@@ -1122,6 +1122,57 @@ void rdc_mont_4x2w(__m512i *r, const __m512i *a)
   r[0] = r0; r[1] = r1; r[2] = r2; r[3] = r3; r[4] = r4;
 }
 
+// -----------------------------------------------------------------------------
+// (1x8)-way fp arithmetic 
+// a single field element is spread horizontally over two vectors: 
+// a[0] = <a7 | a6 | a5 | a4 | a3 | a2 | a1 | a0>, a[1] = <0 | ... | a9, a8>
+
+// Montgomery multiplication r = a * b * R^-1 mod 2p, where R = 2^510 
+// (operand-scanning, the accumulator is shifted down by one limb per iteration)
+// since -p^-1 = 1 mod 2^51, the quotient digit u is the lowest limb itself; 
+// the low limbs of p+1 are zero, so lo(u*(p+1)) is added to the already shifted 
+// accumulator and hi(u*(p+1)) is merged one iteration later. 
+// some limbs are finally 52-bit not 51-bit 
+// squarings use it with b = a: the loop is bound by the latency of the reduction 
+// chain, which a symmetric squaring (each a_i*a_j once, doubled) does not shorten
+void fpmul_mont_1x8w(__m512i *r, const __m512i *a, const __m512i *b)
+{
+  __m512i a0 = a[0], a1 = a[1], b0 = b[0], b1 = b[1];
+  __m512i z0 = VZERO, z1 = VZERO, g0 = VZERO, g1 = VZERO;
+  __m512i h0, h1, c0, c1, tb, u;
+  const __m512i vp0  = VSET(vp503p1[7], vp503p1[6], vp503p1[5], vp503p1[4], vp503p1[3], vp503p1[2], vp503p1[1], vp503p1[0]);
+  const __m512i vp1  = VSET(0, 0, 0, 0, 0, 0, vp503p1[9], vp503p1[8]);
+  const __m512i vps0 = VSET(vp503p1[8], vp503p1[7], vp503p1[6], vp503p1[5], vp503p1[4], vp503p1[3], vp503p1[2], vp503p1[1]);
+  const __m512i vps1 = VSET(0, 0, 0, 0, 0, 0, 0, vp503p1[9]);
+  const __m512i vbmask = VSET1(VBMASK), vzero = VZERO;
+  int i;
+
+  for (i = 0; i < VNWORDS; i++) {
+    // z = z + a*b_i 
+    tb = VPERMV(VSET1(i & 7), (i < 8) ? b0 : b1);
+    z0 = VMACLO(z0, tb, a0); z1 = VMACLO(z1, tb, a1);
+    h0 = VMACHI(vzero, tb, a0); h1 = VMACHI(vzero, tb, a1);
+    // u = z_0 mod 2^51
+    u = VAND(VPERMV(vzero, z0), vbmask);
+    // z = z + 2*hi(u'*(p+1)), u' from the last iteration (z_0 is unchanged)
+    z0 = VADD(z0, VADD(g0, g0)); z1 = VADD(z1, VADD(g1, g1));
+    // z = (z - u) / 2^51 + 2*hi(a*b_i)
+    c0 = VADD(VADD(h0, h0), VZSRA(0x01, z0, VBRADIX)); c1 = VADD(h1, h1);
+    z0 = VADD(VALIGNR(z1, z0, 1), c0); z1 = VADD(VALIGNR(vzero, z1, 1), c1);
+    // z = z + lo(u*(p+1)) / 2^51
+    z0 = VMACLO(z0, u, vps0); z1 = VMACLO(z1, u, vps1);
+    g0 = VMACHI(vzero, u, vp0); g1 = VMACHI(vzero, u, vp1);
+  }
+  z0 = VADD(z0, VADD(g0, g0)); z1 = VADD(z1, VADD(g1, g1));
+
+  // *simple* carry propagation (one step for all limbs in parallel)
+  c0 = VSRA(z0, VBRADIX); z0 = VAND(z0, vbmask);
+  c1 = VSRA(z1, VBRADIX); z1 = VAND(z1, vbmask);
+  z0 = VADD(z0, VALIGNR(c0, vzero, 7)); z1 = VADD(z1, VALIGNR(c1, c0, 7));
+
+  r[0] = z0; r[1] = z1;
+}
+
 // -----------------------------------------------------------------------------
 // 1-way x64 Fp arithmetic (from PQCrypto-SIDH-3.4) 
 
@@ -73,6 +73,11 @@ void fpsub_4x2w(__m512i *r, const __m512i *a, const __m512i* b);
 void mp_mul_4x2w(__m512i *r, const __m512i *a, const __m512i *b);
 void rdc_mont_4x2w(__m512i *r, const __m512i *a);
 
+// -----------------------------------------------------------------------------
+// (1x8)-way fp arithmetic 
+
+void fpmul_mont_1x8w(__m512i *r, const __m512i *a, const __m512i *b);
+
 // -----------------------------------------------------------------------------
 // 1-way x64 fp arithmetic 
 
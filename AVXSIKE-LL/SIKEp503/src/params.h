@@ -22,8 +22,8 @@
 #define FP2_ENCODED_BYTES       2*((NBITS_FIELD + 7) / 8)
 
 // fixed parameters for isogeny tree computation
-#define MAX_INT_POINTS_ALICE    7        
-#define MAX_INT_POINTS_BOB      8  
+#define MAX_INT_POINTS_ALICE    12        
+#define MAX_INT_POINTS_BOB      12  
 #define MAX_Alice               125
 #define MAX_Bob                 159  
 
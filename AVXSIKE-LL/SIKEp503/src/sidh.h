@@ -57,20 +57,65 @@ static const uint64_t vB_gen[6*VNWORDS] = {
 };
 
 // Fixed parameters for isogeny tree computation
-static const unsigned int strat_Alice[MAX_Alice-1] = { 
-  61, 32, 16, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 8, 4, 2, 1, 1, 2, 1, 1, 
-  4, 2, 1, 1, 2, 1, 1, 16, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 8, 4, 2, 1, 
-  1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 29, 16, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 
-  1, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 13, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 
-  1, 1, 2, 1, 1, 5, 4, 2, 1, 1, 2, 1, 1, 2, 1, 1, 1 };
-
-static const unsigned int strat_Bob[MAX_Bob-1] = { 
-  71, 38, 21, 13, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 5, 4, 2, 1, 1, 2, 1, 
-  1, 2, 1, 1, 1, 9, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 4, 2, 1, 1, 1, 2, 1, 1, 17, 9, 
-  5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 4, 2, 1, 1, 1, 2, 1, 1, 8, 4, 2, 1, 1, 1, 2, 1, 
-  1, 4, 2, 1, 1, 2, 1, 1, 33, 17, 9, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 4, 2, 1, 1, 1, 
-  2, 1, 1, 8, 4, 2, 1, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 16, 8, 4, 2, 1, 1, 1, 2, 
-  1, 1, 4, 2, 1, 1, 2, 1, 1, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1 };
+// The strategies are optimal for the cost model of this implementation: a 
+// strategy step is a 1x2x2x2w xDBLe/xTPLe (2x2x2x1w xDBLe for kgss) and each 
+// isogeny is evaluated at all stacked points at once in the lanes of the 
+// parallel evaluation (eval_*_isog_parallel_*), whose cost grows in batches of
+// up to 8 points rather than per point. kg strategies also count the 3 
+// images phiP, phiQ, phiR. The tables are generated by tools/strategy.c.
+static const unsigned int strat_Alice_kg[MAX_Alice-1] = { 
+  38, 28, 19, 13, 9, 6, 4, 3, 2, 1, 1, 1, 1, 1, 1, 1,
+  1, 2, 1, 1, 1, 1, 3, 2, 1, 1, 1, 1, 1, 1, 4, 3,
+  2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 6, 4, 3, 2, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 9, 6, 4, 3,
+  2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 3,
+  2, 1, 1, 1, 1, 1, 1, 13, 8, 5, 3, 3, 2, 1, 1, 1,
+  1, 1, 1, 1, 1, 2, 1, 1, 1, 3, 2, 1, 1, 1, 1, 1,
+  5, 3, 2, 1, 1, 1, 1, 1, 2, 1, 1, 1 };
+
+static const unsigned int strat_Alice_ss[MAX_Alice-1] = { 
+  35, 33, 21, 13, 8, 5, 3, 2, 1, 1, 1, 1, 1, 1, 1, 2,
+  1, 1, 1, 3, 2, 1, 1, 1, 1, 1, 5, 3, 2, 1, 1, 1,
+  1, 1, 2, 1, 1, 1, 8, 5, 3, 2, 1, 1, 1, 1, 1, 2,
+  1, 1, 1, 3, 2, 1, 1, 1, 1, 1, 12, 8, 5, 3, 2, 1,
+  1, 1, 1, 1, 2, 1, 1, 1, 3, 2, 1, 1, 1, 1, 1, 4,
+  3, 2, 1, 1, 1, 1, 1, 1, 1, 1, 10, 7, 5, 5, 3, 2,
+  1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1,
+  1, 1, 1, 3, 2, 1, 1, 1, 1, 1, 1, 1 };
+
+static const unsigned int strat_Alice_kgss[MAX_Alice-1] = { 
+  48, 30, 20, 12, 7, 4, 2, 1, 1, 2, 1, 1, 3, 2, 1, 1,
+  1, 1, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 8, 5, 3,
+  2, 1, 1, 1, 1, 2, 1, 1, 1, 3, 2, 1, 1, 1, 1, 1,
+  12, 7, 4, 3, 2, 1, 1, 1, 1, 2, 1, 1, 3, 2, 1, 1,
+  1, 1, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 20, 12, 7,
+  4, 2, 1, 1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 5, 3,
+  2, 1, 1, 1, 1, 2, 1, 1, 1, 8, 5, 3, 2, 1, 1, 1,
+  1, 2, 1, 1, 1, 3, 2, 1, 1, 1, 1, 1 };
+
+static const unsigned int strat_Bob_kg[MAX_Bob-1] = { 
+  48, 34, 24, 17, 12, 8, 5, 3, 3, 2, 1, 1, 1, 1, 1, 1,
+  1, 2, 1, 1, 1, 3, 2, 1, 1, 1, 1, 1, 4, 3, 2, 1,
+  1, 1, 1, 1, 1, 1, 1, 5, 4, 3, 2, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 7, 5, 4, 3, 2, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 10, 7,
+  5, 4, 3, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  2, 1, 1, 1, 1, 1, 3, 2, 1, 1, 1, 1, 1, 1, 1, 14,
+  10, 7, 5, 4, 3, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 2, 1, 1, 1, 1, 1, 3, 2, 1, 1, 1, 1, 1, 1,
+  1, 4, 3, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 };
+
+static const unsigned int strat_Bob_ss[MAX_Bob-1] = { 
+  52, 35, 23, 15, 10, 7, 5, 4, 3, 2, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 3, 2, 1, 1,
+  1, 1, 1, 1, 1, 5, 3, 2, 1, 1, 1, 1, 1, 1, 1, 2,
+  1, 1, 1, 8, 5, 3, 2, 1, 1, 1, 1, 1, 1, 1, 2, 1,
+  1, 1, 3, 2, 1, 1, 1, 1, 1, 12, 8, 5, 3, 2, 1, 1,
+  1, 1, 1, 1, 1, 2, 1, 1, 1, 3, 2, 1, 1, 1, 1, 1,
+  4, 3, 2, 1, 1, 1, 1, 1, 1, 1, 1, 17, 12, 8, 5, 3,
+  2, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 3, 2, 1, 1,
+  1, 1, 1, 4, 3, 2, 1, 1, 1, 1, 1, 1, 1, 1, 5, 4,
+  3, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 };
 
 // 2^512 * 4 = 2^514
 static const uint64_t montRx4[NWORDS_FIELD] = {
@@ -82,6 +127,11 @@ static const uint64_t montRdiv4[NWORDS_FIELD] = {
   0x00000000000000FE, 0x0000000000000000, 0x0000000000000000, 0x5800000000000000, 
   0x1DB4DD92323C2E95, 0x9B412515787F4C4B, 0x7AC4CFA13D4A7984, 0x0019D8A901E41DDC, };
 
+// Bob's public key in radix-2^51 Montgomery form with the constants of his curve: 
+// A, A24plus = A+2C, C24 = 4C (C = 1)
+typedef struct { f2elm_r51_t PKB[3]; f2elm_r51_t A; f2elm_r51_t A24plus; f2elm_r51_t C24; } prepared_pkB;
+typedef prepared_pkB prepared_pkB_t[1];
+
 void random_mod_order_B(unsigned char* random_digits);
 
 void EphemeralKeyGeneration_A(const unsigned char* PrivateKeyA, unsigned char* PublicKeyA);
@@ -90,6 +140,8 @@ void EphemeralSecretAgreement_A(const unsigned char* PrivateKeyA, const unsigned
 void EphemeralSecretAgreement_B(const unsigned char* PrivateKeyB, const unsigned char* PublicKeyA, unsigned char* SharedSecretB);
 
 void EphemeralKeyGenSecAgr_A_parallel(const unsigned char* PrivateKeyA, unsigned char* PublicKeyA, const unsigned char* PublicKeyB, unsigned char* SharedSecretA);
+void PreparePublicKey_B(const unsigned char* PublicKeyB, prepared_pkB_t ppk);
+void EphemeralKeyGenSecAgr_A_prepared(const unsigned char* PrivateKeyA, unsigned char* PublicKeyA, const prepared_pkB_t ppk, unsigned char* SharedSecretA);
 
 #endif
 
@@ -15,9 +15,23 @@ int crypto_kem_keypair(unsigned char *pk, unsigned char *sk)
   // Outputs: secret key sk (CRYPTO_SECRETKEYBYTES = MSG_BYTES + SECRETKEY_B_BYTES + CRYPTO_PUBLICKEYBYTES bytes)
   //          public key pk (CRYPTO_PUBLICKEYBYTES bytes) 
 
+    unsigned char coins[CRYPTO_KEYPAIR_COINBYTES];
+
     // Generate lower portion of secret key sk <- s||SK
-    randombytes(sk, MSG_BYTES);
-    random_mod_order_B(sk + MSG_BYTES);
+    randombytes(coins, MSG_BYTES);
+    random_mod_order_B(coins + MSG_BYTES);
+
+    return crypto_kem_keypair_derand(pk, sk, coins);
+}
+
+int crypto_kem_keypair_derand(unsigned char *pk, unsigned char *sk, const unsigned char *coins)
+{ // SIKE's key generation from caller-supplied coins
+  // Input:   coins s||SK   (CRYPTO_KEYPAIR_COINBYTES = MSG_BYTES + SECRETKEY_B_BYTES bytes)
+  // Outputs: secret key sk (CRYPTO_SECRETKEYBYTES = MSG_BYTES + SECRETKEY_B_BYTES + CRYPTO_PUBLICKEYBYTES bytes)
+  //          public key pk (CRYPTO_PUBLICKEYBYTES bytes) 
+
+    memcpy(sk, coins, CRYPTO_KEYPAIR_COINBYTES);
+    sk[MSG_BYTES + SECRETKEY_B_BYTES - 1] &= MASK_BOB;
 
     // Generate public key pk
     EphemeralKeyGeneration_B(sk + MSG_BYTES, pk);
@@ -64,6 +78,51 @@ int crypto_kem_enc_opt(unsigned char *ct, unsigned char *ss, const unsigned char
 { // SIKE's encapsulation (optimized)
   // Input:   public key pk         (CRYPTO_PUBLICKEYBYTES bytes)
   // Outputs: shared secret ss      (CRYPTO_BYTES bytes)
+  //          ciphertext message ct (CRYPTO_CIPHERTEXTBYTES = CRYPTO_PUBLICKEYBYTES + MSG_BYTES bytes)
+    prepared_pk_t ppk;
+
+    crypto_kem_enc_prepare(ppk, pk);
+    return crypto_kem_enc_prepared(ct, ss, ppk);
+}
+
+int crypto_kem_enc_prepare(prepared_pk_t ppk, const unsigned char *pk)
+{ // Decode a public key once for several encapsulations
+  // Input:   public key pk         (CRYPTO_PUBLICKEYBYTES bytes)
+  // Output:  prepared public key ppk
+    memcpy(ppk->pk, pk, CRYPTO_PUBLICKEYBYTES);
+    PreparePublicKey_B(pk, ppk->pkB);
+
+    return 0;
+}
+
+int crypto_kem_enc_derand(unsigned char *ct, unsigned char *ss, const unsigned char *pk, const unsigned char *m)
+{ // SIKE's encapsulation (optimized) with a caller-supplied message
+  // Input:   public key pk         (CRYPTO_PUBLICKEYBYTES bytes)
+  //          message m             (CRYPTO_ENC_COINBYTES = MSG_BYTES bytes)
+  // Outputs: shared secret ss      (CRYPTO_BYTES bytes)
+  //          ciphertext message ct (CRYPTO_CIPHERTEXTBYTES = CRYPTO_PUBLICKEYBYTES + MSG_BYTES bytes)
+    prepared_pk_t ppk;
+
+    crypto_kem_enc_prepare(ppk, pk);
+    return crypto_kem_enc_prepared_derand(ct, ss, ppk, m);
+}
+
+int crypto_kem_enc_prepared(unsigned char *ct, unsigned char *ss, const prepared_pk_t ppk)
+{ // SIKE's encapsulation (optimized) to a prepared public key
+  // Input:   prepared public key ppk
+  // Outputs: shared secret ss      (CRYPTO_BYTES bytes)
+  //          ciphertext message ct (CRYPTO_CIPHERTEXTBYTES = CRYPTO_PUBLICKEYBYTES + MSG_BYTES bytes)
+    unsigned char m[CRYPTO_ENC_COINBYTES];
+
+    randombytes(m, MSG_BYTES);
+    return crypto_kem_enc_prepared_derand(ct, ss, ppk, m);
+}
+
+int crypto_kem_enc_prepared_derand(unsigned char *ct, unsigned char *ss, const prepared_pk_t ppk, const unsigned char *m)
+{ // SIKE's encapsulation (optimized) to a prepared public key with a caller-supplied message
+  // Input:   prepared public key ppk
+  //          message m             (CRYPTO_ENC_COINBYTES = MSG_BYTES bytes)
+  // Outputs: shared secret ss      (CRYPTO_BYTES bytes)
   //          ciphertext message ct (CRYPTO_CIPHERTEXTBYTES = CRYPTO_PUBLICKEYBYTES + MSG_BYTES bytes)
     unsigned char ephemeralsk[SECRETKEY_A_BYTES];
     unsigned char jinvariant[FP2_ENCODED_BYTES];
@@ -71,8 +130,8 @@ int crypto_kem_enc_opt(unsigned char *ct, unsigned char *ss, const unsigned char
     unsigned char temp[CRYPTO_CIPHERTEXTBYTES+MSG_BYTES];
 
     // Generate ephemeralsk <- G(m||pk) mod oA 
-    randombytes(temp, MSG_BYTES);
-    memcpy(&temp[MSG_BYTES], pk, CRYPTO_PUBLICKEYBYTES);
+    memcpy(temp, m, MSG_BYTES);
+    memcpy(&temp[MSG_BYTES], ppk->pk, CRYPTO_PUBLICKEYBYTES);
     shake256(ephemeralsk, SECRETKEY_A_BYTES, temp, CRYPTO_PUBLICKEYBYTES+MSG_BYTES);
     ephemeralsk[SECRETKEY_A_BYTES - 1] &= MASK_ALICE;
 
@@ -80,7 +139,7 @@ int crypto_kem_enc_opt(unsigned char *ct, unsigned char *ss, const unsigned char
     // Perform EphemeralKeyGeneration_A and EphemeralSecretAgreement_A in parallel 
     // EphemeralKeyGeneration_A(ephemeralsk, ct);
     // EphemeralSecretAgreement_A(ephemeralsk, pk, jinvariant);
-    EphemeralKeyGenSecAgr_A_parallel(ephemeralsk, ct, pk, jinvariant);
+    EphemeralKeyGenSecAgr_A_prepared(ephemeralsk, ct, ppk->pkB, jinvariant);
 
     shake256(h, MSG_BYTES, jinvariant, FP2_ENCODED_BYTES);
     for (int i = 0; i < MSG_BYTES; i++) {
@@ -127,3 +186,60 @@ int crypto_kem_dec(unsigned char *ss, const unsigned char *ct, const unsigned ch
 
     return 0;
 }
+
+int crypto_kem_dec_many(unsigned char *ss, const unsigned char *ct, const unsigned char *sk, const int n)
+{ // SIKE's decapsulation of n ciphertexts, the isogeny computations run one instance 
+  // at a time while the SHAKE256 calls of up to 8 instances share one 8-way Keccak
+  // Input:   n secret keys sk         (n*CRYPTO_SECRETKEYBYTES bytes)
+  //          n ciphertext messages ct (n*CRYPTO_CIPHERTEXTBYTES bytes) 
+  // Outputs: n shared secrets ss      (n*CRYPTO_BYTES bytes)
+    unsigned char ephemeralsk_[8][SECRETKEY_A_BYTES];
+    unsigned char jinvariant_[8][FP2_ENCODED_BYTES];
+    unsigned char h_[8][MSG_BYTES];
+    unsigned char c0_[CRYPTO_PUBLICKEYBYTES];
+    unsigned char temp[8][CRYPTO_CIPHERTEXTBYTES+MSG_BYTES];
+    unsigned char ss_[8][CRYPTO_BYTES];
+    int i, j, m;
+
+    // the lanes past the end of a partial batch hash whatever their buffers hold 
+    // and their outputs are dropped
+    memset(jinvariant_, 0, sizeof(jinvariant_));
+    memset(temp, 0, sizeof(temp));
+
+    for (i = 0; i < n; i += m, ss += m*CRYPTO_BYTES, ct += m*CRYPTO_CIPHERTEXTBYTES, sk += m*CRYPTO_SECRETKEYBYTES) {
+        m = (n-i < 8) ? n-i : 8;
+
+        // Decrypt
+        for (j = 0; j < m; j++)
+            EphemeralSecretAgreement_B(sk + j*CRYPTO_SECRETKEYBYTES + MSG_BYTES, ct + j*CRYPTO_CIPHERTEXTBYTES, jinvariant_[j]);
+        shake256x8(h_[0], h_[1], h_[2], h_[3], h_[4], h_[5], h_[6], h_[7], MSG_BYTES, 
+                   jinvariant_[0], jinvariant_[1], jinvariant_[2], jinvariant_[3], 
+                   jinvariant_[4], jinvariant_[5], jinvariant_[6], jinvariant_[7], FP2_ENCODED_BYTES);
+
+        // Generate ephemeralsk_ <- G(m||pk) mod oA
+        for (j = 0; j < m; j++) {
+            for (int k = 0; k < MSG_BYTES; k++) {
+                temp[j][k] = ct[j*CRYPTO_CIPHERTEXTBYTES + k + CRYPTO_PUBLICKEYBYTES] ^ h_[j][k];
+            }
+            memcpy(&temp[j][MSG_BYTES], &sk[j*CRYPTO_SECRETKEYBYTES + MSG_BYTES + SECRETKEY_B_BYTES], CRYPTO_PUBLICKEYBYTES);
+        }
+        shake256x8(ephemeralsk_[0], ephemeralsk_[1], ephemeralsk_[2], ephemeralsk_[3], 
+                   ephemeralsk_[4], ephemeralsk_[5], ephemeralsk_[6], ephemeralsk_[7], SECRETKEY_A_BYTES, 
+                   temp[0], temp[1], temp[2], temp[3], temp[4], temp[5], temp[6], temp[7], CRYPTO_PUBLICKEYBYTES+MSG_BYTES);
+
+        // Generate shared secret ss <- H(m||ct), or output ss <- H(s||ct) in case of ct verification failure
+        for (j = 0; j < m; j++) {
+            ephemeralsk_[j][SECRETKEY_A_BYTES - 1] &= MASK_ALICE;
+            EphemeralKeyGeneration_A(ephemeralsk_[j], c0_);
+            // If selector = 0 then do ss = H(m||ct), else if selector = -1 load s to do ss = H(s||ct)
+            int8_t selector = ct_compare(c0_, ct + j*CRYPTO_CIPHERTEXTBYTES, CRYPTO_PUBLICKEYBYTES);
+            ct_cmov(temp[j], sk + j*CRYPTO_SECRETKEYBYTES, MSG_BYTES, selector);
+            memcpy(&temp[j][MSG_BYTES], ct + j*CRYPTO_CIPHERTEXTBYTES, CRYPTO_CIPHERTEXTBYTES);
+        }
+        shake256x8(ss_[0], ss_[1], ss_[2], ss_[3], ss_[4], ss_[5], ss_[6], ss_[7], CRYPTO_BYTES, 
+                   temp[0], temp[1], temp[2], temp[3], temp[4], temp[5], temp[6], temp[7], CRYPTO_CIPHERTEXTBYTES+MSG_BYTES);
+        memcpy(ss, ss_, m*CRYPTO_BYTES);
+    }
+
+    return 0;
+}
@@ -13,9 +13,23 @@
 #include "sidh.h"
 #include "fips202.h"
 
+// Public key prepared for repeated encapsulations
+typedef struct { unsigned char pk[CRYPTO_PUBLICKEYBYTES]; prepared_pkB_t pkB; } prepared_pk;
+typedef prepared_pk prepared_pk_t[1];
+
+// coins of the deterministic (_derand) key generation and encapsulation
+#define CRYPTO_KEYPAIR_COINBYTES (MSG_BYTES+SECRETKEY_B_BYTES)
+#define CRYPTO_ENC_COINBYTES     MSG_BYTES
+
 int crypto_kem_keypair(unsigned char *pk, unsigned char *sk);
+int crypto_kem_keypair_derand(unsigned char *pk, unsigned char *sk, const unsigned char *coins);
 int crypto_kem_enc(unsigned char *ct, unsigned char *ss, const unsigned char *pk);
 int crypto_kem_enc_opt(unsigned char *ct, unsigned char *ss, const unsigned char *pk);
+int crypto_kem_enc_derand(unsigned char *ct, unsigned char *ss, const unsigned char *pk, const unsigned char *m);
+int crypto_kem_enc_prepare(prepared_pk_t ppk, const unsigned char *pk);
+int crypto_kem_enc_prepared(unsigned char *ct, unsigned char *ss, const prepared_pk_t ppk);
+int crypto_kem_enc_prepared_derand(unsigned char *ct, unsigned char *ss, const prepared_pk_t ppk, const unsigned char *m);
 int crypto_kem_dec(unsigned char *ss, const unsigned char *ct, const unsigned char *sk);
+int crypto_kem_dec_many(unsigned char *ss, const unsigned char *ct, const unsigned char *sk, const int n);
 
 #endif
\ No newline at end of file
@@ -49,6 +49,13 @@ static const uint64_t vmont_R2[VNWORDS] = {
   0x26030979EDE54, 0x744E105718847, 0x42E56CDD585D4, 0x277C0450B087A,
   0x6CBEFFAD0601E, 0x7CBD17B195293, 0x2BF3C820BCD5B, 0x07673F03D2224, }; 
 
+// (2^640)^2 * 2^-612 mod p610, converts an inverse computed in the radix-2^51
+// Montgomery domain back to the radix-2^64 one (see fpinv_mont)
+static const uint64_t vmont_R64x2[VNWORDS] = {
+  0x0CC8E66A81208, 0x00000000000CE, 0x0000000000000, 0x0000000000000,
+  0x0000000000000, 0x0000000000000, 0x7E4578F601AFC, 0x7B39C69E4E305,
+  0x2B9541B0A71A1, 0x6687CD10D89EC, 0x5AF9660BEBB09, 0x05D0ECA6B96A1, };
+
 // -----------------------------------------------------------------------------
 // (8x1)-way fp arithmetic 
 
@@ -73,6 +80,11 @@ void fpsub_4x2w(__m512i *r, const __m512i *a, const __m512i* b);
 void mp_mul_4x2w(__m512i *r, const __m512i *a, const __m512i *b);
 void rdc_mont_4x2w(__m512i *r, const __m512i *a);
 
+// -----------------------------------------------------------------------------
+// (1x8)-way fp arithmetic 
+
+void fpmul_mont_1x8w(__m512i *r, const __m512i *a, const __m512i *b);
+
 // -----------------------------------------------------------------------------
 // 1-way x64 fp arithmetic 
 
@@ -160,4 +160,12 @@ void fp2add(const f2elm_t a, const f2elm_t b, f2elm_t c);
 void fp2sqr_mont(const f2elm_t a, f2elm_t c);
 void mp2_add(const f2elm_t a, const f2elm_t b, f2elm_t c);
 
+// -----------------------------------------------------------------------------
+// 1-way radix conversion (radix-2^51 <-> radix-2^64).
+
+void fpconv_51to64_1w(felm_t r, const felm_r51_t a);
+void fpconv_64to51_1w(felm_r51_t r, const felm_t a);
+void fp2conv_51to64_1w(f2elm_t r, const f2elm_r51_t a);
+void fp2conv_64to51_1w(f2elm_r51_t r, const f2elm_t a);
+
 #endif
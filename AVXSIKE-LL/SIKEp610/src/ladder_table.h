@@ -0,0 +1,3671 @@
+// Fixed-basis ladder tables of LADDER3PT_fixed_1x2x2x2w computed by
+// tools/strategy.c (./strategy tables > src/ladder_table.h), do not edit.
+// ladder_table_X[i] = < XR0-ZR0 | XR0+ZR0 > for R0 = [2^i]Q, where Q is the
+// basis point of vX_gen on E0.
+
+#ifndef _LADDER_TABLE_H
+#define _LADDER_TABLE_H
+
+#include "curve.h"
+
+static const vgelm_t ladder_table_A[OALICE_BITS] = {
+  { { 0x25B91D7C945D9, 0x4C94587C1C766, 0x3C001E8B3AA23, 0x3CE2F006F57BA, 0x25B91D7C945CB, 0x31D82F064486D, 0x3C001E8B3AA21, 0x0235C58868EBB },
+    { 0x734BEF8259517, 0x08E32C99E8E5D, 0x2519663C11528, 0x5A9C3F51D98E0, 0x734BEF8259517, 0x78B6DE7433073, 0x2519663C11528, 0x6A95EB0351DBF },
+    { 0x3E1E616C072F8, 0x0A7472D15197F, 0x340899BA298F8, 0x7B6FA76EF62D0, 0x3E1E616C072F8, 0x0FBBFD98ADFBE, 0x340899BA298F8, 0x20C30466DECD9 },
+    { 0x417ADE291A8F4, 0x0042F27EB2B38, 0x3010A77B2FF02, 0x415BEA22EA74D, 0x417ADE291A8F4, 0x01A285D888279, 0x3010A77B2FF02, 0x0AB2B60B2D857 },
+    { 0x4A9FAA2D2CABF, 0x7E2F0460A661C, 0x018E22684A2D2, 0x374E4D25FBF90, 0x4A9FAA2D2CABF, 0x38D7230C1C4E3, 0x018E22684A2D2, 0x3FAF7619E83F6 },
+    { 0x169FD5EC8E9D9, 0x19D1FB53493C5, 0x4FA9E90A7B44A, 0x0A273544BB684, 0x169FD5EC8E9D9, 0x300DE49101EB6, 0x4FA9E90A7B44A, 0x31E69FBB43814 } },
+  { { 0x665F93E82C1F3, 0x0A854ADE39D92, 0x38C8311D6578B, 0x0655068FABE55, 0x7A49BD1FF1557, 0x583EAFAB1F410, 0x149AF07CB1F9D, 0x2D16DCA53283B },
+    { 0x58C92E9A615E5, 0x5DADDF1F5FFC1, 0x4BFC85FA4D4BB, 0x2C0C1D7DC2962, 0x638F5BB029489, 0x4A1C7CCC5463B, 0x2E96027B0F770, 0x35C18241CDDA9 },
+    { 0x169D52C393333, 0x445E1DD9DC882, 0x7ED8C26CC0A33, 0x4FE09774724E1, 0x5CC736B784B7F, 0x545311D41EDB4, 0x2B42021528AD5, 0x0D42A5B8316B9 },
+    { 0x584601B2D6AB1, 0x1C82D21A816B4, 0x66E98AF295FE2, 0x6C1E7B4269FB7, 0x1ADD7BE6B2347, 0x740BF25305DDA, 0x479A2FC0FE9AB, 0x036BD5E831C43 },
+    { 0x3D6FBDE84B2FE, 0x51EE4581F301E, 0x53814BB356D20, 0x39B0C89CC83BB, 0x6E89E4C487FCF, 0x7D910629E298E, 0x1DDAB7573DBD9, 0x5EC211DE5D806 },
+    { 0x0E8A68DA5535B, 0x0B1452488FC6B, 0x42B09EE1C63B0, 0x161DE1C4892AF, 0x5DFEE67DAA0BE, 0x1CE7BCFAD1015, 0x6EEAB66E34AD2, 0x1DE50F0FB5F01 } },
+  { { 0x69FA0F995AFFB, 0x7A6407A0AD31C, 0x0C7A9DE9D1FDD, 0x7C3032FEAA2C8, 0x74B544D99EE25, 0x25D4B56161751, 0x5B23791F3273D, 0x6054F2AA0F475 },
+    { 0x1A72CCE5706EC, 0x2B341712E9364, 0x11A394FF5B515, 0x4C98264A76A1B, 0x281E0B012EE6C, 0x67760E643E66C, 0x0B98B59CFEDA4, 0x2C0C79DB1DAD8 },
+    { 0x6EA558928A736, 0x387915F16145F, 0x6E62B185C0D6C, 0x14A6A568A0AEE, 0x1CD4E8200158B, 0x2FF9D0B893EE5, 0x3846843DB53D6, 0x5C33BCC9C709F },
+    { 0x1BEE50AAED61D, 0x07B905DE6580B, 0x4D41A12A89725, 0x2C7C8758C65B7, 0x4DD4FE81ED953, 0x3672B8BA5464F, 0x7802DD1873B79, 0x145725CB41615 },
+    { 0x1DC4CFFE3D871, 0x7F0440320B287, 0x75D967249857F, 0x56CD05B6F4D0C, 0x0E53F01245017, 0x58EE40452183B, 0x4D0868DA23142, 0x0C84CC5FC5E15 },
+    { 0x0AEFD7FCD35D2, 0x1610ECC335835, 0x11903C5C5C4FC, 0x1BA7AF9BA472B, 0x6C29DFA5F72CE, 0x29E1DD84603A4, 0x437D483C55075, 0x28BB2CCBFF2D8 } },
+  { { 0x6890F92D7783B, 0x5D17E4D540EFB, 0x72BD626FD266C, 0x599E10660CA5E, 0x5E0F0DDABCAA3, 0x56AC41E8665C8, 0x2567087ED8F4A, 0x1EC9C18FAD130 },
+    { 0x2EFB383863896, 0x387AA77B99797, 0x2E7DFFFDE9CD5, 0x3AC51907BA8EB, 0x01F74A56429F2, 0x440F0B3F20EB4, 0x78AFE55E4EB7F, 0x5CD353A9DA3CF },
+    { 0x6948B66F6A9BD, 0x1A63CDD8E6BDF, 0x52E2ECD8CD922, 0x7DC79BF9E9F84, 0x6B0F0D5284CB6, 0x26D13DF3D96B4, 0x680EB54B61DDE, 0x4CBAEF0860946 },
+    { 0x1673B829E12BA, 0x0046F0A43FEAC, 0x09C1EC9C8891D, 0x0F6D62F956629, 0x697CFFA17B439, 0x54B1289877BCE, 0x61E452817ADD1, 0x5BC5E04B541A1 },
+    { 0x458B08659C4F6, 0x7F8C4F9A13928, 0x1AEAC52585DBE, 0x3224A142273BC, 0x525FB45255067, 0x4048C6D2D9020, 0x4FE21F3796523, 0x0436C68ED9188 },
+    { 0x4EBFCE2E4D0B9, 0x06C8F23923024, 0x3CB450EC60603, 0x0DEF50C2783E8, 0x29F2998E50F0D, 0x226675154BBB1, 0x6A5EAAB582C8F, 0x2919BDC7E6454 } },
+  { { 0x20BDB0DE81957, 0x7A47AEEAEAC2A, 0x6C7896B7C58BC, 0x6CDAFC7F05F70, 0x61AD87E137C9F, 0x5B6D6B429527D, 0x5748DAFF5BC70, 0x4778783FEC3C8 },
+    { 0x0CC4E25C13A7C, 0x3E31E15E0DDA1, 0x129077F02EA81, 0x0141602783FF0, 0x2AA85A94BC061, 0x47CE715AA22C4, 0x316769F287C55, 0x4701F50206918 },
+    { 0x360F18952264C, 0x3366EF910B2CF, 0x3F4C0B7AD6343, 0x1A12D3248F212, 0x68C33978124E6, 0x399A84E2242CA, 0x66ECAC4B59FAF, 0x424E10D11A36C },
+    { 0x478A1CBE0BA92, 0x65CAE94F0EF35, 0x1624C6CB9CA76, 0x107C90F6D592C, 0x7116DE50292F4, 0x59E6FC358FE2F, 0x16C38CDCC1761, 0x2E143166C34BE },
+    { 0x351E8631A99F0, 0x461AF53BE00A0, 0x0E1881C06346D, 0x7CAA6A253DC48, 0x25943430BA15A, 0x53F65F736A743, 0x3218D1833CB39, 0x5446FFFAEA0B6 },
+    { 0x3DC5DAF69DC37, 0x14B43BDEE4A46, 0x4DA71B16A1BCC, 0x1BD0653FF91A4, 0x6704BFD2FA258, 0x3213037582037, 0x4A6FB1C83F030, 0x22304BC173DA0 } },
+  { { 0x74C7519DA6DDD, 0x3461279FA042F, 0x2F74289BA1CA5, 0x6F85F09572C1F, 0x7D1F233812DA7, 0x19601A98A8CA4, 0x49AE44C554D45, 0x43F67164EA99D },
+    { 0x2C938219D04C5, 0x554BE4BC6EF98, 0x755C2AD0C18A0, 0x505685BE4C9DA, 0x614B94E73DB16, 0x6836CBDDADF84, 0x0E189F0ED7841, 0x47CD510619127 },
+    { 0x750EC19951F6F, 0x6D51B65DA2B25, 0x4098A4B5D5005, 0x6109DA4F05261, 0x0C60D27CA5308, 0x23B30F1B49F30, 0x3797D7CC3297B, 0x480C7D529C933 },
+    { 0x65E154F7B0979, 0x2391FB14C2FB1, 0x09C136B57AC36, 0x0AF2307A4233F, 0x6D74EE3E28207, 0x7C2531535415D, 0x45F5FA0D0EA4B, 0x623C5307C0117 },
+    { 0x6E282A6FDCFEF, 0x1CF85FB3DC41B, 0x0E9BCB10ED307, 0x62D9089A7E182, 0x2D1707FE535DD, 0x534B9A25D5D6B, 0x5D17347BAB0C4, 0x1381B9EDA3F17 },
+    { 0x6A230A87B76E6, 0x0D42715602BA6, 0x4036742BC355F, 0x127F6CAEBF1BB, 0x2D7915F161469, 0x29E6FE93DBBD7, 0x18634A714CF98, 0x29056AF0710F7 } },
+  { { 0x27315ABF63A36, 0x7D7874C7DB358, 0x61E8081C5873B, 0x6398668B0AE74, 0x7178DADFA3840, 0x5876F1A6C9743, 0x09FB789E313AF, 0x757A54F73D2B7 },
+    { 0x39F17D0A1A5B0, 0x16DD977CE8C95, 0x221F7C6744AF8, 0x407BAE3EAA9C4, 0x22A4AD3C1ADB5, 0x31196B268C25B, 0x348999E6250AD, 0x6FFA955071032 },
+    { 0x56F91B8BC2F1E, 0x4E47A27ED4BFD, 0x03AC42EFE4BCA, 0x5D77F53545352, 0x5E448C4C78B17, 0x49E7FD200318B, 0x733A16EB0755A, 0x5A38219078DC4 },
+    { 0x1694543A17265, 0x1AA86210A8303, 0x761432934962C, 0x603D910744142, 0x54FCE342ABEE5, 0x19E21D413A84A, 0x7FA4EA2A38B61, 0x28346B92EC275 },
+    { 0x716FE0C15554C, 0x52484C41F1F80, 0x5AEAAC961CF40, 0x3F16270D94D8B, 0x132C4A96A419C, 0x0BAAF350BEC27, 0x48D5B7E32F026, 0x3100E3A18B019 },
+    { 0x1B4323430BCA3, 0x17CA29A6EB24E, 0x79D27A7FE6133, 0x0BF243710DCC3, 0x3C69A5FF543AF, 0x26F05F5BD5677, 0x5DB53BD8065A8, 0x27A5E5C3332A9 } },
+  { { 0x38E071FE20A05, 0x7AA8E30E89D2A, 0x2D4C349DA9E20, 0x5F7DCF369F080, 0x535CB0ECA87CD, 0x45EBFDDBBB3BA, 0x4F99FEA570296, 0x276B88E454D4C },
+    { 0x722D126396791, 0x007F089D261BA, 0x77FC07AFE9B19, 0x2653D85BDA787, 0x72E745FBAD4DD, 0x2352F74B8DC11, 0x110B74F7A5C74, 0x795B9E2B46F8B },
+    { 0x303F355CCC733, 0x0A017618AD933, 0x79E36F3099752, 0x3649BCAF00CA6, 0x0C94B043013C6, 0x4C0E6169F697F, 0x366EDF59AD2D7, 0x6B55EFB728D13 },
+    { 0x5FA30404F5E6A, 0x30A10CCC7CCB1, 0x767E42ED3CC82, 0x2BF88150F59B5, 0x7E389397C7098, 0x1B3B6FD0BD663, 0x527E9EF8B08B2, 0x7BEF9D864A184 },
+    { 0x5B11F3AE11866, 0x5881844C70C2A, 0x06493CC6859E8, 0x59CF60C8033E8, 0x25FB1E7FBDFEE, 0x3A3457D2FBFEE, 0x47E88FD157636, 0x24629BC1E5A00 },
+    { 0x7B9B40D01D4E3, 0x169AD0023C13D, 0x6489777A31BA3, 0x0A59587EDB965, 0x4C8C1666B6992, 0x31B3469F86915, 0x7D8797CC616FF, 0x244FB42AE99A3 } },
+  { { 0x474FE6BAFAF59, 0x6991FA285F365, 0x660A493830F10, 0x13B678A046302, 0x1FEA99F50270F, 0x24E74E805B6ED, 0x759FF24DD1F82, 0x568CDB9176C60 },
+    { 0x4A573025FD60F, 0x48A36C44249EC, 0x086C74E80C619, 0x1B07448B578B6, 0x64D758EE93C28, 0x6B2B74146E91A, 0x6AE840BC7C840, 0x57B0D2AD6D1C3 },
+    { 0x2A8C90093AF58, 0x3587E5A716CA2, 0x37FB7CA956926, 0x5D63B7626F4C6, 0x1E016FEB08C0D, 0x17DCCC8C3F24B, 0x09BF6761246F9, 0x62C902CFA4A6E },
+    { 0x50038C5947A52, 0x1CBEA81D66FBD, 0x3D302D5B1EE80, 0x5A1BAD5E8F6BE, 0x7387EE42BA500, 0x192B0F8D0AAA6, 0x34FA1A53642F7, 0x6D8C71EA2FAA1 },
+    { 0x217EBB8DA7BFA, 0x384ED7F1EE01D, 0x6B902AE6F212A, 0x138500E42A111, 0x69EACD1F8A8E1, 0x1FCF357D4B97B, 0x63C2FE497B776, 0x41CC5B501F868 },
+    { 0x4EA43F635615E, 0x1A7EB80C6FC3C, 0x48A7878D8FF4D, 0x16F87F2949556, 0x4B306CE308686, 0x1DAAB5E40FDF6, 0x2CE324D5E9D93, 0x2CB56F2A76ABE } },
+  { { 0x5C3BBDA2612D0, 0x11EBE8AA08422, 0x698E2355B19CE, 0x161BA92B7A8FF, 0x7D4808E655952, 0x4BF976F6EA19D, 0x22383E7828FA2, 0x1C0AE4AE04FB8 },
+    { 0x3177E72C2EF37, 0x157D9D5A5CFAD, 0x339DEDA18A7D9, 0x780D082B67CDA, 0x06A96389E057F, 0x7A6E15CFD6035, 0x2AB1E562B093D, 0x21B2DAFC4E606 },
+    { 0x76828F1E1CECA, 0x7798D34A246F4, 0x55684A856FB9E, 0x5C6378499F241, 0x033C530EBC3F4, 0x0B943E59FA69D, 0x747D9CE5A7A09, 0x279BB0BF3C446 },
+    { 0x66E987A641016, 0x438DD040AD068, 0x75B64DA94FED6, 0x7CBA43D3FCB4D, 0x51C7A46F2949D, 0x37101174B0D3E, 0x477B7EA33DD7C, 0x0A82066E4229A },
+    { 0x2704EAEDC4B00, 0x32206266E2615, 0x0481277C87DB3, 0x31C757B104591, 0x0AF286D935FE6, 0x2EBD9C70BE5B2, 0x60F23ED597642, 0x4303E4BEE3260 },
+    { 0x7FC7902E5919E, 0x1A8B9B2E158D1, 0x602404F27912D, 0x1919AB386B7AE, 0x682373B42ECE2, 0x296EFCD92703A, 0x424E0AFC88A64, 0x2274A507159E7 } },
+  { { 0x262B81BE72F28, 0x27AA57785FB1C, 0x27ECDCB16F1D9, 0x1A93C49AEC2F7, 0x17A1753685B58, 0x3ACCEFAE9DEB1, 0x44E64C1BEB12F, 0x28A80612D6A22 },
+    { 0x19FF970406B8A, 0x62234A7ED072F, 0x33DB9EAA519E6, 0x4BED33D6E5B52, 0x093165ED35E3A, 0x7662CB9184A1B, 0x26C9D5F5386A6, 0x6501510C15F27 },
+    { 0x0063B0F3F52E3, 0x774CCDDA463F8, 0x661AE7F564871, 0x7F228C6FC4B04, 0x23C4E35C72A21, 0x126C22E36CD48, 0x6F153942437AB, 0x0A93C9B79DE90 },
+    { 0x756C638698239, 0x22767B1170CB1, 0x0423A4B21A54D, 0x4DCD40ECF7663, 0x7C5B427C48618, 0x0A8B4B36965B3, 0x604F439FF9788, 0x44E7C287ADC78 },
+    { 0x58D304AF99877, 0x28249A66C6785, 0x1A95D9D105E6F, 0x50AC6A859CF73, 0x55A290CA87501, 0x5B2A1EF7DCAF4, 0x4CBF52273AD1C, 0x7BE1793E0F3B8 },
+    { 0x2112599CAF80E, 0x1D369C726FCD8, 0x2B0B3352800DF, 0x17D133DAD2BB0, 0x113F11DD70DBF, 0x31D1BF7521CE9, 0x59CB57F11A2C6, 0x33565D04AA255 } },
+  { { 0x7C3BF772CC2D8, 0x31AE7E476C6AD, 0x20DFD8E530E9A, 0x41904A49D405F, 0x7BCDC706C8D48, 0x005879DCDD581, 0x4707AF27BDCDC, 0x577293E6286B9 },
+    { 0x01CF9A82EAEF8, 0x745B33E5C500C, 0x4139942509637, 0x1F6C4C2AD6249, 0x08A0CFDB330CE, 0x785622F645682, 0x6AB8250CD4DF5, 0x11C585052ED16 },
+    { 0x3753654133AC2, 0x4A2B45773BE29, 0x330D02938587C, 0x016D02A927C5B, 0x5204FC292EC0C, 0x6915EADE57389, 0x1170F812C993A, 0x2FC3FC9C5AEEA },
+    { 0x2C19E191CFDF8, 0x7B2AFD9F243EA, 0x7BB59DEC930E2, 0x07BCBC89C3AC3, 0x16536087BBAEA, 0x53318B2F43570, 0x560B3F3E1B395, 0x1ED86EBF637A9 },
+    { 0x150E7D59E3BC5, 0x0F5F82FCE85AD, 0x63639FA1D4EE3, 0x61B151FABCBD5, 0x1807C7F143F7F, 0x24B6DDE173EFB, 0x6F96B8D9AAAC9, 0x56CC2275914AC },
+    { 0x531EF037CAF26, 0x1BF18CE5B3C95, 0x6CF22FED10B56, 0x0D766941475C3, 0x101FBA40BB454, 0x29CBD07C6EA0D, 0x22AA4B0BF32CC, 0x278029B3E7E44 } },
+  { { 0x4AD40B71058D4, 0x2E9EC3C584C49, 0x0835FA36DCD37, 0x1FB75906BBA36, 0x1D143B0D4B78E, 0x337D45195D357, 0x5F97A062E309F, 0x795C870565CD3 },
+    { 0x455D5555B44A6, 0x10F4BF36CA3B3, 0x2E152A357426A, 0x07A936B8A8361, 0x5B6E6E5BB2F6F, 0x0662D12F7FE69, 0x340D7D9E2601D, 0x1024DCDB8D9FC },
+    { 0x63304A8534DE6, 0x4F64095042F32, 0x1FD7AED232C53, 0x03260C3E7B9F8, 0x5977650B30096, 0x5B5173269B0C1, 0x6D75278222772, 0x24F025232B6AA },
+    { 0x5C1F3EF85F2B9, 0x1AE1797D390EE, 0x0764539E0C081, 0x39DBFBB8E6D0C, 0x178B41E7F9DA1, 0x03C9CA0216180, 0x13C6D6FAE4598, 0x3252F0F305F03 },
+    { 0x16AFF4C659E3E, 0x3890DC010937B, 0x6257193C28205, 0x259F278D32310, 0x1A7BE92806914, 0x55E11F0ED0D38, 0x66A18892128C5, 0x703CD759626B8 },
+    { 0x6B01FA7066F30, 0x1DD5DEDE62B9B, 0x21418262BCCCA, 0x11D35724161F2, 0x14FE5FEA12FC2, 0x1E070A3626976, 0x0AB291FD1C53A, 0x2C8CCA78F0D37 } },
+  { { 0x44031631C8263, 0x68B36E9D3BDE9, 0x13F2DEBE813E3, 0x23D0E7A71D819, 0x1B03E53DB3045, 0x11E99A23C2C34, 0x099ED1241ED43, 0x04A71E4D3DBC0 },
+    { 0x71E8C1D1C21D0, 0x1803C2FD60A6A, 0x299B6A6524BBD, 0x49D0BDF350398, 0x75334B5FBE036, 0x20FE2945CD83B, 0x1627D874F258A, 0x1D86DBEBFFB03 },
+    { 0x19B72536409C5, 0x5BA9C0CFBB9C6, 0x5FCCA05A34F77, 0x478FC722FC16A, 0x23F696C914D77, 0x7ADEBDECE0900, 0x605CB58B3DD7B, 0x3F68D1D0B033E },
+    { 0x336478630C029, 0x32681151145A2, 0x090720989EEA3, 0x787B9CD93E356, 0x6274EF4C3F16C, 0x7D8A403A4BF46, 0x40D55C510505F, 0x2AC266298C7A6 },
+    { 0x5A8BB62548B67, 0x6C7641F9A7241, 0x6E14B327A01F1, 0x0C3CA5BD8772F, 0x57B4268091E6D, 0x5BD6AFEE34903, 0x6FCB05C5B1210, 0x78B8939A5528D },
+    { 0x5AEE0BA70E7F4, 0x1406871710EFE, 0x414C9DF64ABBE, 0x09DA734D1265D, 0x013B5D1F9B96A, 0x3803620C3C7E3, 0x0A8C7319B6BFF, 0x2FA092E240963 } },
+  { { 0x2075F5D82CB8F, 0x54162B40349B4, 0x616E762A017F2, 0x74DAE677BE82C, 0x7335AAA4191CF, 0x26B5B20DA0D16, 0x0E38FC29DCF4C, 0x3F157A18F22C7 },
+    { 0x72294C5804ACF, 0x22DA956FF997A, 0x1488953E45B00, 0x03C18E0090D63, 0x0E301F531F1CC, 0x6D85CA2999070, 0x6ABFA924ECB4D, 0x214E65CA54D9F },
+    { 0x090BCBE3E1139, 0x67A2BCCEFA582, 0x5C826C7EC4001, 0x515A0C30ADE09, 0x3DDB1627A1931, 0x34589C786B940, 0x7C9AFC2782585, 0x49EC1FAFFCC73 },
+    { 0x6D37AC2566C84, 0x3D647CD8B4FB7, 0x0F126EB491A38, 0x769592212CC03, 0x575D11386481D, 0x0EA6FFD332462, 0x7D2E6DA0A8ADD, 0x2E7200BDA2AFC },
+    { 0x5698A5B744E37, 0x6FF8C78FFBF71, 0x26344D8E5449E, 0x008A3843F0C7B, 0x3783B411DC58E, 0x5F3EAA531D833, 0x2EAA97B6856DD, 0x3963963C39CB2 },
+    { 0x0542C5080BFB9, 0x1A8337DA67ACA, 0x211D58233E8C3, 0x18DAA577BDEE8, 0x0C88C01D98F76, 0x30B04D871860E, 0x36F3723662516, 0x27CF76148BEFB } },
+  { { 0x518443B3230C9, 0x0F34145B8FFFA, 0x7964BC95A292C, 0x028C700EDE855, 0x01F6061587CE9, 0x270854C4BEE08, 0x4F437D0F2CA22, 0x25FD58E5CA3CE },
+    { 0x5D8BC198A956D, 0x6D13391972407, 0x005A2BBF61A84, 0x69D0553248517, 0x6516168F5EAEE, 0x2686B5489AD07, 0x7CCA87FDA28D0, 0x6030F793A58EA },
+    { 0x49A8F9EED558E, 0x3F85629B7B948, 0x5207E68AB4C2B, 0x0AD7899AB4C30, 0x416FDF055C73B, 0x0E2DE218BF601, 0x262AB0F7E612C, 0x61426AC1FDE5B },
+    { 0x30545A7058EE2, 0x7823D47FCB3D9, 0x608683099F498, 0x0C913B1C155C0, 0x150E784451B88, 0x281D195D507B5, 0x5D74D2BA132B7, 0x15C552560EF58 },
+    { 0x2FE56F83FF7F4, 0x0B952A32EC4FC, 0x387A6C9525F4D, 0x219264558C47D, 0x3E4A213974FB4, 0x1DD921E09B367, 0x6934499790A66, 0x2B1FE91EF1868 },
+    { 0x45CDBC89CA011, 0x1A821760A8C13, 0x0BCAEA5BF3FF2, 0x0A21268D56502, 0x65D1D814B3DBB, 0x306FCE27565F2, 0x1DB0D88EC4AE2, 0x24EA93A494F8F } },
+  { { 0x2828409498929, 0x0B04C9CDD046D, 0x6535E8DF05505, 0x6E10F2D6189EB, 0x4BB7EE1E7FE89, 0x3490D17283BC2, 0x6454B390BA229, 0x49E3B71A03564 },
+    { 0x34FC34D859750, 0x71AB149E8AA8B, 0x66BA60283AC28, 0x30F0B8E745C7A, 0x4B5038AF70E78, 0x67CE75057C7D9, 0x0866A492B3609, 0x779356C2A1008 },
+    { 0x77C6E9249188E, 0x1641D86BB62E0, 0x4F165D9CCBD44, 0x22EC3E424C624, 0x08A64673191A1, 0x76FA167B2CC99, 0x53536FD08BA98, 0x05BDF70B45A9F },
+    { 0x2A1821763BD44, 0x32F212B8E368F, 0x2B28BB9BD3BC0, 0x261EF9FFE3C59, 0x5D3BCF8CFD6F4, 0x6EAD94B7B1FA9, 0x2827590748562, 0x23842C4790E5B },
+    { 0x091CAF2B20B8D, 0x5832102AE92DE, 0x748DF19587444, 0x28B421D26AA9F, 0x36FA076A57B78, 0x5A3C6B500CA6C, 0x5A55E2B380D3F, 0x75EBD0E4A4C00 },
+    { 0x70756D9B5A62D, 0x130A5EC78FEFE, 0x511690A27E3B4, 0x157CE1682C1BD, 0x7BB9FCA8D6AC0, 0x182E2C7EC6496, 0x015A0EED8B95D, 0x39A2601C1BD9E } },
+  { { 0x2C6F891ED7FAA, 0x18B7BC6933584, 0x045DD1F665B7A, 0x4EBCD375B9BDD, 0x04EAB6441BAD8, 0x0E77661805E71, 0x501D9FF17DB08, 0x758314531D330 },
+    { 0x112BB3B89175B, 0x6988F9D3B1EFC, 0x2AC2A9D5D13D2, 0x22D6345E6D5B9, 0x4525B486FB3D3, 0x3E78936C62FC3, 0x212772D34799F, 0x530710101B5EA },
+    { 0x214474361385F, 0x7A0F7B0F64650, 0x5AFECE1F3D582, 0x772DFAB19E964, 0x5B97BCE8B538C, 0x7FC302B86B132, 0x7626329820074, 0x6262D1F1F4081 },
+    { 0x562C9F76FC16F, 0x05A63C6683BA2, 0x3C918A50A06D7, 0x7529C44693D99, 0x5EA95A772BCC2, 0x7080917ABB0E8, 0x3FFBEB4B9FE99, 0x01CF92478F606 },
+    { 0x00FF26D9D5946, 0x11E900AF852B8, 0x330B9686EA594, 0x7BA4B1ADEB141, 0x2F12C803F6132, 0x0DE7357F41A74, 0x25356AEF7E77B, 0x71300D731BAF7 },
+    { 0x58250EE57F14F, 0x206C2B6D86E02, 0x5FA4D64DD3C28, 0x10954C5E364A1, 0x603BB685A60B3, 0x246EFDF7108A1, 0x5F019E718BBD3, 0x33FD656300596 } },
+  { { 0x0D755884C1213, 0x2A469CE7CE775, 0x44F003D60D50C, 0x797C13D33B5FF, 0x722FB6329208D, 0x0E68D95370677, 0x73C3D17EDB98A, 0x2C8A1977C78A9 },
+    { 0x3B19BD89B46DF, 0x7E34C89BA04D7, 0x1FFE08FE34B24, 0x50B4EA7ABE005, 0x4A46F7972B3DB, 0x36575B92077E1, 0x1C90C3B02FD65, 0x270D930A71108 },
+    { 0x4020BD2B3C3FC, 0x44A44D274CC71, 0x020DD43668D21, 0x0193BED49BBD4, 0x21BC1E7A20D4F, 0x3EBAEE384BFC1, 0x78A31C56CDBF4, 0x432E582A7425C },
+    { 0x27517282E402C, 0x2B123653811FF, 0x237F0B4481155, 0x68F1DCDB0D4A7, 0x489FD2618CFAF, 0x534D5A794F96B, 0x05ED68532B7A3, 0x0175E92A61EF0 },
+    { 0x42971C50B27D6, 0x62434BA9BE8B9, 0x04D6D517C44A9, 0x2CD92DA029CC4, 0x4B330E633976C, 0x67549BD0AFD1E, 0x5106AB2D893C9, 0x750E100E88A4E },
+    { 0x718AC67F57432, 0x1E82FE7245991, 0x5E0456EDAE509, 0x16D8367F2CEF2, 0x78C8E1D2D9587, 0x2C651A888C0B2, 0x7F3E69AD5CA96, 0x324CF6EE6218C } },
+  { { 0x50163FFD7F004, 0x04B0495356025, 0x282F04AA6F3FE, 0x23AC7A9901B02, 0x5503844F1F3E4, 0x38277966F46DD, 0x67180B3603588, 0x2A5985B8F2F6D },
+    { 0x638BBD2ACC07B, 0x1D455CA12E60A, 0x24455B4671D53, 0x6D9CD829E9A19, 0x404A3A00BFEBF, 0x3B09C5666254B, 0x3060945E36619, 0x6B6D65495541A },
+    { 0x1AD09A482E51A, 0x7712B74E67235, 0x369C727826717, 0x4C2390E7AE5A2, 0x6A07C7D982983, 0x37CFDBBB6FD23, 0x5D713223F4DC8, 0x13F1959C47D9A },
+    { 0x703215D9B5B3A, 0x0BD0423055B97, 0x1B9B4E8391A1C, 0x6C6C6ADE16D9F, 0x4FBF36E6F143D, 0x4E11E6DA5D47E, 0x6F08F520AEC43, 0x0E58ED158F725 },
+    { 0x7901E694BAEB4, 0x730C8C15AC0B3, 0x7729F26BD5FAF, 0x05ACCE9FC7407, 0x2A5EE5A1CB9D4, 0x2C0BE7312CD3E, 0x229E1F4275B29, 0x4F64E67E02073 },
+    { 0x485028AF1ACEA, 0x1BF7DEB32B6B1, 0x3C36795C91DDB, 0x0A715AF90E5E0, 0x47A17F5D29E05, 0x337849436CB96, 0x1B322AA305E0D, 0x2BE57E7759146 } },
+  { { 0x204DBAFC6F948, 0x7427C4FC4B8D8, 0x23763C8F330E0, 0x1CB725E15FB7D, 0x6F41164085B1C, 0x0AF3C750290C4, 0x1D52465BE48F2, 0x3E5B7896A2846 },
+    { 0x36850ABF1DC36, 0x2CD7E18890B99, 0x4B45ACE81F6A3, 0x7D9E054084B3B, 0x6B485EDC77FAE, 0x162745791EB33, 0x0B4C30AA8ED17, 0x182EB81152976 },
+    { 0x41F0C6904445E, 0x76AE33D5AE8D9, 0x1594F533A7CB3, 0x26AF392990D03, 0x4E40908188A6B, 0x098CA7D150E74, 0x606E6CAB5F5D8, 0x5986EC7B4925C },
+    { 0x0AE569DE1AA8D, 0x0F00D2A4E07D7, 0x69185A183D31E, 0x1B5BC94A3A676, 0x1DF4EE395EA57, 0x295238668AA5F, 0x4FF67E3BC61BC, 0x4CA9B525ECC7A },
+    { 0x5FF4EF3425404, 0x6A5E84D8E9C11, 0x118453A0ED06A, 0x0BA944E5717DB, 0x386BDED11278D, 0x270092003837A, 0x68A7BE386D21D, 0x0D00C5FF4CBEC },
+    { 0x3ADB28E82D214, 0x0FD3C4EC18677, 0x3C2DC82C0F760, 0x1F8918309DEB0, 0x729D4A87586A4, 0x3768F771BDF74, 0x0B1CBA2C41C16, 0x20FCDEB076168 } },
+  { { 0x64FED0DCFC2BC, 0x757AB6BD0D08C, 0x6FF73BBE74679, 0x31380388CCF4E, 0x21606CDB61992, 0x6453DFFA6A31B, 0x4A31EE5C343A9, 0x1EB4098780AEA },
+    { 0x0EB17BD258613, 0x522FB05082AC5, 0x0B7E0A5C19D09, 0x260930F5A1124, 0x744813BF2FAF7, 0x2FDC85A847074, 0x2CB91F90BE9A6, 0x03CB089595DF3 },
+    { 0x2E7FA573F9037, 0x2638982C6B44F, 0x77C74AFFFAFE2, 0x4E3CE9392558E, 0x55A511203FC26, 0x6442BF14BD7C0, 0x149AD31DEE001, 0x2E2D8B42BC9F3 },
+    { 0x40C89962037A5, 0x09CF10D864193, 0x2B2FD669FE82C, 0x5F9EC41DF7510, 0x32639001D9F5B, 0x4FFCD945E2570, 0x5496F51503456, 0x5DBE380696C2A },
+    { 0x65071881E5266, 0x623F1D50F92C0, 0x403CD7BAA4F2D, 0x3F77F870C5F6C, 0x24C30A0C5E4EE, 0x5C1F6D6E07173, 0x69EF999E84DA7, 0x292401D7A7EFA },
+    { 0x52BF29CF5CC17, 0x031DFB0C87F29, 0x7E374FBD3ABED, 0x0CAAE5C0BF863, 0x3C58C37B4E50E, 0x271A59BD7C771, 0x4E3DF6BD835E8, 0x344E4E8EFD842 } },
+  { { 0x5743CB05B68FA, 0x54573089AE595, 0x65D50B6F6010F, 0x7D7BC45E44777, 0x202D5E9EB1098, 0x0813614F48ED5, 0x002A2CC960375, 0x202A28909200F },
+    { 0x3712266FFB546, 0x42EE3DA8F4477, 0x59C3B7710E625, 0x420FAB8405942, 0x620131878AB5C, 0x28CC74F6478E7, 0x276295591A567, 0x1618C58857854 },
+    { 0x7625DB5580C14, 0x22B4F91A0240A, 0x1FE09FF8263B8, 0x4C9C385F0FD87, 0x2B06E9E93D261, 0x18206C58576DD, 0x7BE72CAFB457E, 0x04ADA1EFEA60E },
+    { 0x63F49FCB31FBE, 0x11044EF73FDA4, 0x427558FCDB434, 0x5D7E6E6FC9DED, 0x175397BBFF839, 0x389BFCEB0DB04, 0x2F2EDB40D1650, 0x7D7F38DC37703 },
+    { 0x3D01203DBAFC8, 0x45D1409F27D33, 0x2318AAA66E2FE, 0x5B85CBA508159, 0x50426282097FA, 0x0032E856DE93E, 0x538A64605E637, 0x4190E87F5758F },
+    { 0x5D77824F048CF, 0x13B3750A79C98, 0x789B5CCE46E3D, 0x02F39F0AE8BD0, 0x64C19940011A6, 0x1B591A551E22E, 0x629A2BACA48B6, 0x2A536B8E8E650 } },
+  { { 0x18D3D95FB9392, 0x483CCF0D1B0D6, 0x43F03119CF9B7, 0x74BA6F356D078, 0x7787C3FD05D48, 0x1392F75C0B9A4, 0x216F6467738D7, 0x2135B7E470EA4 },
+    { 0x449125D6983E9, 0x3583A0DF2F59C, 0x4672A6EE50849, 0x4C196CFB8386A, 0x419FA8C29EEEB, 0x0240C89EF26D6, 0x54FD4EDAD1BD8, 0x01C29F3F317CC },
+    { 0x64936EE2FEEA5, 0x65F8857BDBF51, 0x508BD51257806, 0x6E914EAC75542, 0x28E8D99C3C9A5, 0x074D15482B132, 0x56AFFFB6897C5, 0x1E4EB8EA62DE4 },
+    { 0x6E2DF6229E2FB, 0x16EDB81B8EC74, 0x33B1F3D097AB5, 0x20A971DF083E5, 0x58DBF7E9042CE, 0x76F21A05C85A3, 0x5BBA885E5F606, 0x1645943BEFC31 },
+    { 0x388BD9F83C895, 0x20CEE3C7DC669, 0x49F0868172DDC, 0x73C7BCEA08009, 0x7D48CE789FBA8, 0x3EEB18078A02B, 0x7B7B221D8E206, 0x5C694EEA24125 },
+    { 0x36D885B367DAE, 0x0A2764E4718B5, 0x7C86CD177FF69, 0x2608EA0EC32B6, 0x6AA4FA052A2DD, 0x3148613217AB4, 0x599045A415E29, 0x2955DF5F90D91 } },
+  { { 0x699A5BA583188, 0x28FE396F7EFC6, 0x03A960697B97A, 0x67F5CA683BA5B, 0x7FD35B5B42604, 0x1831EBF22C8BA, 0x0E6255DAA3EE4, 0x2C5EC089D6F4F },
+    { 0x44981C7DBC2A3, 0x73BCDFD8DDA97, 0x443F6DCC0C505, 0x1B34EF664D393, 0x1A9650545BB11, 0x5591F20D0F23E, 0x7089BF183867C, 0x6DD254E1FCEA3 },
+    { 0x532AB8E148FFE, 0x5D5A4AD53D94B, 0x332D3F02F1EE7, 0x03144F2A0334A, 0x33E727CF437A5, 0x1F17FBA11B6AA, 0x21CB2656AB2D2, 0x7624FE8118553 },
+    { 0x776476B2D704D, 0x277AF116646F9, 0x04FDB9253739D, 0x655B8719234D1, 0x7FBF955A7AC3C, 0x1724E4EFCCB17, 0x2240DC0281B33, 0x11AFA8228B9E9 },
+    { 0x66C4E199E4E78, 0x4F32AD9D22DA8, 0x773F6CF917FC7, 0x3298C997B2EA9, 0x7005D4BCD1E27, 0x4111B72723829, 0x4E51CF19C25AB, 0x1C3F1CD7E8796 },
+    { 0x03EE555C8323A, 0x1756FC9CE01A6, 0x1C27A88E14C7A, 0x109D061A6FF94, 0x66D93634F6FE3, 0x3066E8A27F4CD, 0x4B19178210111, 0x1F27FFDAAD513 } },
+  { { 0x4EBD47BCC0AED, 0x64ACB5EA5E3B9, 0x3BE9A555001A8, 0x24151DA98D201, 0x6A30D587ACABB, 0x0DD8E8C30B930, 0x1A6F8174A0C20, 0x6376F247158FC },
+    { 0x19B537EAFE864, 0x31FE2A6E79457, 0x2E783330A152C, 0x421FF64797568, 0x622150238EEB8, 0x32A23145F231D, 0x409F70404600D, 0x39854427976AF },
+    { 0x1E0E6A836A8E7, 0x1C376CB3280C1, 0x14C0BC66D1D86, 0x0BD4E738BDA2E, 0x7055222F6B5C3, 0x32BE7FCD6A968, 0x6310D1DBFD301, 0x79A5A5148220F },
+    { 0x19ABE8CC609B4, 0x183526031D4F6, 0x5C0493BC23CCE, 0x224669953DA43, 0x00418BD37ED2B, 0x598D3783467CA, 0x21DB294375F62, 0x0EC775FA7F28E },
+    { 0x440641200E970, 0x11DE52E842B08, 0x70C226DA4A849, 0x2E4D99B736235, 0x4D2CF9BDE14F9, 0x0F0A967AEECB2, 0x55CA1AAA08A79, 0x704DD575549DC },
+    { 0x31DCCD3BF946C, 0x10613F358A107, 0x4153FEBBA0AFA, 0x0A4F1043AAA76, 0x209C9F033E2DE, 0x1D97C297B698B, 0x57C747C25AB61, 0x2D479DB38F20A } },
+  { { 0x639D3BAB3741A, 0x1BC37F04A1B87, 0x7CBF8D0D6C229, 0x2ABE0A7BF16F4, 0x063D26D3B04F0, 0x224108FCBE4E7, 0x4AE19065CC85D, 0x030AEF50A689D },
+    { 0x51B5DA81CE2FB, 0x106A1F98B027E, 0x4CC3BE10BB2C4, 0x277278D4379DA, 0x27A67BB440844, 0x3601EC32495BA, 0x21FF0F6E68258, 0x4265C97BD5D7A },
+    { 0x5E716922C4FF6, 0x6B378F9910053, 0x6D075D5CF5C64, 0x7108439653C30, 0x64F47F40FB305, 0x61D6B6A38AB11, 0x649A4AA47B7EE, 0x70CF63D89FD92 },
+    { 0x7C9E346FBDECE, 0x1BB831CB93D3B, 0x2AF85F9DC396A, 0x37C13FC94DD97, 0x291589703365A, 0x48E8696A94643, 0x64BD190C0E8C0, 0x145D2BFAEFA6E },
+    { 0x00B3A83D3AF09, 0x4037608E1F1D6, 0x2F77AF7E2CA54, 0x6865263E8418A, 0x76BB0DD0A2758, 0x35941D6D95771, 0x105347D410CCA, 0x717203EC93AD5 },
+    { 0x6816C5163871E, 0x060770E506954, 0x2AA98F6EBF821, 0x0AADA85986923, 0x6422E74032652, 0x2A3B3AC2E181D, 0x70EF04EEE039F, 0x1DD9E953ECC34 } },
+  { { 0x336405F45C23C, 0x39AC4AF3B521F, 0x379A487D5E299, 0x3F24071DA5578, 0x1783D605C2F4E, 0x24DBAAF694745, 0x7128A0723CEA3, 0x6B7713A167D33 },
+    { 0x544585D873A5B, 0x57FF9412FF5FD, 0x4BE1896188DA3, 0x6D942E1457142, 0x5CFC553B733D0, 0x25C29BE5C2E8E, 0x0B2CFC91F3115, 0x46ECD02EE45E3 },
+    { 0x54F6147370C4E, 0x0776FE24464BE, 0x4D10B5D26B7DA, 0x1B02D555CD121, 0x4CFCC58C95492, 0x0A9208D107B71, 0x0A84CCDA3FB65, 0x074AE5A03956F },
+    { 0x385DE6C81F915, 0x32E74011FA3C3, 0x0A990277F0F7E, 0x564F7222767C8, 0x02204ED18EFE4, 0x4128EA8E96C38, 0x24FA929E09A4B, 0x24ECC4E45A1E5 },
+    { 0x416FFFDCF28F8, 0x1F6A1C3A1B86F, 0x35D9C4422A14E, 0x758E2C902F0D6, 0x0A366CB33F464, 0x6BE3BA8AAF53A, 0x0F8D4208E5936, 0x442C2908E77C5 },
+    { 0x403FD8BBC6A00, 0x161F7944AF2F6, 0x0EFDA92F8A299, 0x1BF03CF82ADB5, 0x5300DA479E8E6, 0x1BBE731BD70AE, 0x30E9E0AF3ADCD, 0x318B09FD82E9B } },
+  { { 0x5A26947BC1C70, 0x0C36B87326689, 0x71BE4E2437D83, 0x3C987E497B39B, 0x2D9325D81A856, 0x7C1D2A86D5598, 0x4838FB954816B, 0x5F8B9C781DF0B },
+    { 0x554396E65218F, 0x0FCD3D3604633, 0x1F5CECAA8F335, 0x074A5265FDA23, 0x55339A15DBA9C, 0x5452258E38189, 0x7D1348620436C, 0x304092EA52009 },
+    { 0x29FC125F72956, 0x624ECF32CF476, 0x704BB523643F6, 0x03E09E2D28FDE, 0x3A8EBB3286C6D, 0x4A6C78592478B, 0x5FBC2306212EF, 0x45D429E3DB8E9 },
+    { 0x3520630066D59, 0x7E5249B4D2229, 0x16095C7AF9F61, 0x12ECF2E04B6EB, 0x3E903DE74F4E5, 0x080B2ED1FBA4D, 0x539A3811B442F, 0x0333604F7A850 },
+    { 0x470E400F09D52, 0x0A3071BC0CC6F, 0x497E1DE28CCD2, 0x2381AACEAD49C, 0x7B3CA0F5F1D0D, 0x468D5D24703C5, 0x221A9CA44EF70, 0x36359C28871F6 },
+    { 0x63F185A1953CA, 0x09E1C4C460943, 0x47231C9C0C79A, 0x103643DB045FA, 0x7FF5E52005BE6, 0x269B9CBDEB62B, 0x615EB9977C025, 0x1BB33942966CB } },
+  { { 0x2A8D42EE422D3, 0x0D6B84D943782, 0x6F5E7923E217F, 0x468DC62BE5753, 0x409D4101E666F, 0x586FE38E237CB, 0x3472DA02E30EB, 0x7B8E5902A0D4C },
+    { 0x07E776E6280F3, 0x4D8A7306091FF, 0x0DEEB871C5362, 0x327DA8EF2782E, 0x41932BF1F4466, 0x5DC43F17F5653, 0x778C8DE4339DF, 0x08DD086422FBB },
+    { 0x7AA0C78E6261E, 0x7FE9DED520000, 0x31D18C9225E1E, 0x75E6286B7868F, 0x25C182DD717E6, 0x54A05932336F4, 0x7116A6123FDC4, 0x04911927A1926 },
+    { 0x0571BAE628930, 0x6F2034F82A2CF, 0x340C135B31AAC, 0x2D96BEF4F6554, 0x1C05CEDB2F86F, 0x08D9887D932C7, 0x269A1B2797AA9, 0x12B184DD02D49 },
+    { 0x087A745B5DF4F, 0x34A6BF913F89F, 0x63AE4BF7EC67B, 0x67FA7E8397E1D, 0x6D242BA300CFA, 0x09DE590E847D9, 0x493793CBB0D10, 0x7506375C1FD85 },
+    { 0x5B0B303590DB6, 0x1D0A964847355, 0x19DF47F0ABEC5, 0x251E21141BF41, 0x73256FDB70905, 0x25E472FB2F67D, 0x4EBB0F309A4A7, 0x29397D9AC1E77 } },
+  { { 0x0F945A58051A5, 0x54500A732073D, 0x0F3C187B83E7C, 0x7CD9A8991AD6C, 0x60CDBD0C4AB51, 0x0ED79C8B8C1A6, 0x2238E8C439E5E, 0x3949476FE57AB },
+    { 0x253CB5DBF5E43, 0x3D95322404647, 0x5BFF6F512109F, 0x0256DB27C74C6, 0x16993DD8D7FFE, 0x53EF610B25E14, 0x667FE40E28FCA, 0x1AC27515CC9AE },
+    { 0x5B3E0519C9A70, 0x52504E870D441, 0x674B82EF1BA31, 0x02CCA24164B39, 0x5019982FBAE55, 0x36A05DAD6530F, 0x33D6A873EF046, 0x52AB388A965CF },
+    { 0x6D7F5FEAD869A, 0x628E39475ADE6, 0x4F5EB99DAD8E5, 0x7FDF688BAB6CD, 0x13C512AA2A418, 0x1619C25DDBF36, 0x6CBA8C0022296, 0x5CDADCDF036DC },
+    { 0x4B20D3EED964B, 0x745D593B44533, 0x4F5D864B051F0, 0x134EB0E4847A4, 0x77516E1B4D1F8, 0x3FB8CC16F2C1D, 0x3614E1B109C4C, 0x755D84DAA196A },
+    { 0x78573564367F9, 0x194FAD71B9B58, 0x23B88EF4C3AFE, 0x14738E52C3063, 0x5AA7EC175D2D5, 0x350AD619DA990, 0x71C8735546528, 0x3AE430278FFB5 } },
+  { { 0x04C6B7A8E15A8, 0x2CB47FCBB1C83, 0x6171D7CB4099D, 0x73B0636446063, 0x4ED1F05677FB8, 0x0958834BD47B1, 0x0A39BB536FDFB, 0x2BC02D71977AE },
+    { 0x65567D785F8A5, 0x35C1ED5FB32DF, 0x473212254D1FD, 0x48FC2E8D585F7, 0x404A9EB880A4F, 0x0883146782F45, 0x5787C6BF821F6, 0x1FBAE6D9A8003 },
+    { 0x0ABB8E0EAAB69, 0x3E4E60DE75CC5, 0x0147681F4875D, 0x22B0E533312EC, 0x2C9E3D1881AD5, 0x143A76169D040, 0x46C2544806849, 0x4C12CD28589EC },
+    { 0x228C68A12F79F, 0x40BACEFB99BA2, 0x7F956D927A6C3, 0x2EBD895FDE741, 0x6F9FABBB89833, 0x1D7AE83DD8FFA, 0x1399677B2BCCD, 0x08AE2DA8B4696 },
+    { 0x2A06E319166BF, 0x18BE0CB430C19, 0x27200441BB54E, 0x4A9CAC262DCFF, 0x1BB51D14A6DE6, 0x152A71B8CD323, 0x132C183611390, 0x5581B45B72705 },
+    { 0x06B42FCE5BA3F, 0x14D91D439BE46, 0x2C3964AA2C064, 0x1B1C3BC4CF12C, 0x2B1D45A786D46, 0x349543B068CF7, 0x663A96E4F6B0D, 0x282692B51E6B9 } },
+  { { 0x68EEC905760E7, 0x64EF008DECE93, 0x5FAC82B900150, 0x3C0EC79251832, 0x50ECB37C60803, 0x3AF7BE778629F, 0x17E0DFC4F973C, 0x1098AF48DF9B6 },
+    { 0x42B7D62FBFCE8, 0x52862C1324605, 0x38076854146EB, 0x4F2A032F4D3C8, 0x07B14919EBAA7, 0x6CC674FABD0D4, 0x1A4A4D498ACCE, 0x3FB8248814FF1 },
+    { 0x42A89D5806BB3, 0x4C8241A0573A5, 0x2029D55E1F3E0, 0x110B6F733E0F8, 0x32A866A5A6B9D, 0x72686E7AB4117, 0x65ECD560A81D1, 0x67F98C8B1CF1B },
+    { 0x57DC070B74A51, 0x0D9671CCD5012, 0x1F252BA39BF5E, 0x2C0B1B36C1717, 0x75285E8D16B01, 0x7BB4FEEE79903, 0x136E4CA412F6B, 0x21BD598A7A86B },
+    { 0x0556E46771B0A, 0x1BCBC1E743EF6, 0x5B36E85C083BA, 0x359A2841B9A88, 0x19817EF6E9398, 0x1996E1A9BE684, 0x4C264CDAB8A7C, 0x71DAA6C0B8B48 },
+    { 0x1750EB15D8971, 0x16C7B892FCF05, 0x7AE947D7E0160, 0x150F0078EEFE2, 0x604609694A65A, 0x2AA39B8C8985A, 0x183B78FD30474, 0x2F6D46B7F7BDD } },
+  { { 0x7A024EFC64F7C, 0x395AAAA939B02, 0x3370595E2BD15, 0x29618E1D13E2B, 0x1077B6973002E, 0x69B8C4CA36580, 0x7B0DD1ED1709B, 0x69237DFBBBD49 },
+    { 0x6F74DFFDC2251, 0x55B9955FE2467, 0x1A0873CC824BB, 0x68B01325185A7, 0x459228FC547A9, 0x1C5A7F5F47B12, 0x5B908E9E0E606, 0x5DC5ED5BCC21B },
+    { 0x4267F863CD651, 0x33F0E43B52268, 0x4E060A7246F27, 0x3A02544A32FA5, 0x4B94DDF29804F, 0x5133CF6F6DD91, 0x4793D0A467D55, 0x248F6646B9680 },
+    { 0x25099D48584B1, 0x6D45B300042BE, 0x20EE3244E1A6F, 0x182435FD047AC, 0x085DA47EFC499, 0x27A83865298CB, 0x2E09183DA3F69, 0x1B69398212F9C },
+    { 0x6744780FA487D, 0x6A82BACDD3B56, 0x6C20B1F8F3CCA, 0x4C9B5828234F8, 0x4EC68D15C1F6E, 0x2252B64620D64, 0x1EEE22F68EF04, 0x58DA5A2E98F74 },
+    { 0x3508C4E9547D5, 0x1BF22CA8FD645, 0x2A08F57D24D11, 0x1F75C31DFDB05, 0x47E93F5D769CB, 0x2D7DDD60BEEC3, 0x549367B15CE22, 0x24173C52532A0 } },
+  { { 0x5D1CAED097F45, 0x4C6DDADADFB2F, 0x0B62F173C47E8, 0x4A6751146A259, 0x093A90117E189, 0x20CBE8C9B8F46, 0x7E2CE55AFD2D0, 0x1D15BB9935322 },
+    { 0x33ACA7311BC4D, 0x1120D7AE0E012, 0x15BACBB0994C9, 0x2BBDA8AE70FF6, 0x2F04017AF7FC6, 0x358F1D15D207C, 0x4572A323CFE3F, 0x7ADC91F48C0EC },
+    { 0x69CA41572C1E7, 0x142BB7B7BB6B7, 0x5331A4DAE6C7F, 0x7C38A3F3563BA, 0x4A7F33FE80AFE, 0x5C6DDA246C5B9, 0x439A6EDDF186F, 0x7EFE6C1EC2DED },
+    { 0x48C98E6939D2C, 0x2A96B82E8A845, 0x3A2DD3B03B7F8, 0x5DE4C15EF8483, 0x79210DD7A2939, 0x12154243D76A5, 0x69F34BFEFAAF6, 0x59A26633B0C4F },
+    { 0x07E955ABED285, 0x0887240FC684B, 0x2C0BAB01212BE, 0x0EE78313957B4, 0x1BB86D51C121C, 0x09899C6AC85D7, 0x17903C3783225, 0x101B8A0170DFD },
+    { 0x45C336814D447, 0x1245D5C1B2578, 0x0B73EC7F85E8D, 0x1FE393EA59478, 0x314469AFCC76A, 0x1D1C0913D50D3, 0x7973191D57BB4, 0x2E1427809E5A1 } },
+  { { 0x057A665BA9F17, 0x508CAF8905FC3, 0x1D4A34E95054E, 0x0927D076E71E1, 0x3AEB536A9DC1F, 0x5D4735BCE621F, 0x65E4C3F9BD32C, 0x3D6657010582C },
+    { 0x6CBB2EC869825, 0x766C58323E0CC, 0x2DC9A2201B72F, 0x2270D92A4DF2F, 0x73D8E2948A99F, 0x63343B2EC54DD, 0x09DD84A62837C, 0x5C24B31D2629B },
+    { 0x3AB11DD876CB0, 0x5EFF595DF4EF4, 0x7E47380974B42, 0x44E1FBBFAD658, 0x2F9DD1F430AA6, 0x626185341DF1C, 0x6709B5C622C24, 0x10CA4D1D425EA },
+    { 0x09A482E89289D, 0x384F4C9CCBB05, 0x2B41376C3228C, 0x054B86BFD3168, 0x7E303C4EA99D7, 0x506496B83010C, 0x692AF4DECAA7D, 0x73893E70DB2B3 },
+    { 0x4E62369271FD8, 0x09ED9A54A9302, 0x6CDE9DB18D9F6, 0x3527ED317D085, 0x421011F5A1A60, 0x1F50191B05632, 0x1CCD54A20C5F0, 0x7704312248A3F },
+    { 0x5BAACE7EF2C52, 0x0AE7859F8A3D1, 0x0DB521E657EE4, 0x1594D5E87B811, 0x7F3B7C47DCE69, 0x1DD8F89D33703, 0x29395CE026DB0, 0x1EBC5F5DC670B } },
+  { { 0x6DFED32E73E93, 0x19AC193C3ABE2, 0x75692829D0B89, 0x78B2586E4BFEF, 0x353B540A564A3, 0x30D41854EBCE1, 0x3576E19B796D9, 0x3305AFA03F7E6 },
+    { 0x2382DB30FD002, 0x1F0AF698CB1D5, 0x0FD8ECC9608A2, 0x523C903170B6D, 0x547C307B016B7, 0x5D65F0BB028FF, 0x1F3AD6CBCC59E, 0x1BF6D7B1F4DC7 },
+    { 0x60DA775BB5D2E, 0x21FA6B25BC384, 0x3A8DDC5C01B60, 0x08FE4C7203BFE, 0x76BC4854A22D1, 0x04544D70EBAE8, 0x777AC39F9953F, 0x1484C2FE46B64 },
+    { 0x29D825C7B67B5, 0x11DA722231002, 0x6138199D217F6, 0x11768FA26E245, 0x5F0A018C04E7F, 0x1A0EEB06360FB, 0x0EC7F3D42AD86, 0x7847DBB230DE5 },
+    { 0x31847CE2BDD25, 0x25A28FC660AB9, 0x68994EE93ADB6, 0x1F2E71C5646D1, 0x06EB0347D4039, 0x57F4452640E96, 0x4B91EECA70636, 0x236A0B1F4366F },
+    { 0x65318D40B8D82, 0x13D58B037EA60, 0x022EBE20C7A17, 0x06E447AC9AD57, 0x560F639DB8D75, 0x29E0593496C88, 0x0DBDBB8E69783, 0x2674964EBA908 } },
+  { { 0x2D0A0E3AD03A6, 0x5252773268294, 0x3116EDEB5974D, 0x1334C10D84670, 0x3744E46602F1C, 0x5C1A7BF4315F8, 0x412422F7D0A3D, 0x2A850EC4AE22D },
+    { 0x3474F0891C0D0, 0x6BE47EEEB5D35, 0x147815CE1EAC1, 0x49BF5B5DA7A67, 0x13C30DAA44467, 0x239462BADEE36, 0x1763C6FE13F76, 0x6610B1A4E2B69 },
+    { 0x60623F01EC30A, 0x57BCD64A1870F, 0x19DE989042AE1, 0x0EE760C0A929B, 0x6870DBB7D198A, 0x31EE891399426, 0x5AC343F7F907A, 0x5E8FE39EC5EC6 },
+    { 0x09ABF14ABF24E, 0x12842E80CB356, 0x33EEA4041B3D8, 0x67C5A1B828EF9, 0x434441FC304F2, 0x66CC229C583BF, 0x60C52166E0BC6, 0x51C87CABF91E1 },
+    { 0x058F936418448, 0x7763AF06162E7, 0x2E52527D65BB0, 0x533271F554BB5, 0x29478C218686C, 0x70F7ED2BC03EC, 0x5635001911281, 0x5669D66770BC8 },
+    { 0x7F8D32CF2C7C4, 0x1D1EF464DF4F1, 0x49AD505D4B574, 0x1772589B78668, 0x26024B8707466, 0x1E8CAD72FBBA5, 0x7887F1F74E27A, 0x243E52312F6FE } },
+  { { 0x28CA39E895DD2, 0x33FA56AB69342, 0x5E29F34E4AE6B, 0x67E5B8C068E31, 0x348290E3FB6BE, 0x3274AE03A8C85, 0x13B4A0360A405, 0x1F587768F7555 },
+    { 0x052363679AB0E, 0x127A429877045, 0x08FB346CDD2EC, 0x48D123BC3BDEB, 0x70B53446E7254, 0x1ACA2D4D918E2, 0x1FD694EF20D1F, 0x53F9D2FC23D9A },
+    { 0x48A6037E6CD1B, 0x43DC126CB85FB, 0x6A198B3A1ACDE, 0x6F5F3E4704B9E, 0x06A6F0FC38CDE, 0x241D075F43979, 0x0C28FBE9580CC, 0x5454BEAE16088 },
+    { 0x5427BF2F2E607, 0x62D9050A989E4, 0x298DC8B811AD7, 0x43FFCB51F1D45, 0x73F5A836E8109, 0x36C24EE5D7847, 0x7A6942C92AE49, 0x79182059854AB },
+    { 0x1057E8F796FED, 0x01347171161FD, 0x6298B64270326, 0x31BD78B929EB8, 0x655E90692B653, 0x0FEBCBAAE8DD3, 0x3A4921C61AFF7, 0x4DFA4E9310D9D },
+    { 0x0E8E90B9CABD9, 0x1807BA0D9C569, 0x1AE94AA6A3854, 0x1DFD485994D15, 0x238202107C79A, 0x367C0FC69B9FA, 0x78052E92FAB03, 0x2CFC2ED0E3FFC } },
+  { { 0x34ABD09D84524, 0x7F8356991D32C, 0x3927D2EE9593C, 0x6C14DA03977D8, 0x03706586346EA, 0x326C1BB20EA7B, 0x0CB4C90E32852, 0x565AE5F2776B7 },
+    { 0x6534D0806DCF2, 0x72D56E7894AAF, 0x133A57138266C, 0x59088DE6DB454, 0x3004538C44F0A, 0x6338E56FBC71E, 0x3DDD3A4049747, 0x192F5C307A60C },
+    { 0x20EA358F622CA, 0x7EAA5B0998C4A, 0x4F7D6FEEC607F, 0x3D08BEB659DC7, 0x62A4241046E73, 0x7D8AEACC97116, 0x69967412E7FB3, 0x16B1196404265 },
+    { 0x7D45111B74107, 0x53743126309F1, 0x2947471038744, 0x099DD24FBE08B, 0x24A5BC2AC9E02, 0x50431A146E8D2, 0x781B84A940335, 0x74485E923E760 },
+    { 0x0EFBDEC5329D3, 0x5439F74E351C0, 0x4999AEBDD11C2, 0x2C5A0F9A9F928, 0x704385CD437A7, 0x58F036D70B579, 0x3D680E60040AE, 0x6069FDD2E2542 },
+    { 0x4D33D635ED256, 0x219488A228B81, 0x548602F129F74, 0x15FE07FF0B5FC, 0x6C538255F7BE4, 0x2BF7BB695909E, 0x4498022EFDDEC, 0x1EABDF7CF2DC8 } },
+  { { 0x6E26165690766, 0x542BE7886410A, 0x1259E291C177D, 0x45BC8B3A6D2D9, 0x18F94B11DCE78, 0x390A3C5956E98, 0x7794710BDE79B, 0x752BFF7427EFB },
+    { 0x105DB637DDFE2, 0x3F57B6111B778, 0x2408D324B5F14, 0x12A5DC32F7064, 0x3B584C7AE16F5, 0x73BAB7BB0411E, 0x00C8F00657693, 0x0FCDCE652A888 },
+    { 0x67688B54B414B, 0x52F8365A0896B, 0x15D1A0243DF42, 0x6B434B13E801B, 0x0FFA51FAB5228, 0x1DE88AB227561, 0x479A8C9496FC8, 0x7861C87BB4DEA },
+    { 0x4706006152606, 0x3BE5A7EC8106C, 0x0B655492576D2, 0x30FE65323D623, 0x0F27860202239, 0x066386026350F, 0x22184C2B8A676, 0x5BA014440E030 },
+    { 0x52AA6BEB7FA36, 0x2A065C8C5E9E8, 0x1FF0244E43B77, 0x30B356A57D54B, 0x01379DB24FE01, 0x4FCFA0C48AA23, 0x4640D11751D8F, 0x7ECB7D2296DBC },
+    { 0x16B0211BB60DD, 0x1526302882AD4, 0x65BC0DEA94B93, 0x124ADC4F17659, 0x2F763450EC6D5, 0x2C749D3B159C4, 0x4E8553CD63CAF, 0x183D50C9EA450 } },
+  { { 0x0635741AAD167, 0x1E80F921D1BCF, 0x76763F3674132, 0x477D0E441ED31, 0x1200B4FED5515, 0x5EEF3828C532E, 0x2461ECB976D70, 0x351860FC441C1 },
+    { 0x21E62E262A7DA, 0x0F3EC75A9A4BF, 0x5DDB0E0EF8005, 0x391879A35FE35, 0x34CA85460B289, 0x69AA6C0026CEC, 0x1D2C9AF3AE6FC, 0x27D7B870AE0DD },
+    { 0x343EEFED1AF74, 0x296EA337A9F3C, 0x6C537187A102F, 0x2B9B716FEE70C, 0x118324EC1A7AF, 0x4EF6228333766, 0x55838AD892B16, 0x1567FE36F9013 },
+    { 0x650FD2CA883C1, 0x375D1149EC502, 0x082A52FDFBEFF, 0x4264D7956F29D, 0x3C9E7547331B4, 0x67F02AABE2CB0, 0x63B78812623FA, 0x2035677690A09 },
+    { 0x4C395748A351B, 0x0E01D4B7DD4C4, 0x18CE5A1F21BC2, 0x5DB886ACEE5C8, 0x3B727CC5BB186, 0x4D5A9CF265D70, 0x02F317AE4C986, 0x22FD8EB0981FB },
+    { 0x1E7E6B8157EC0, 0x131FAE36D1454, 0x7D4D932E2771F, 0x13A6FA191F807, 0x4DB58DA37404D, 0x2F227541C21AB, 0x0637040ED85EB, 0x221AE58849AF9 } },
+  { { 0x72537162FA61B, 0x1D1DA3304F708, 0x5B41118C8B193, 0x1462EC8E812DE, 0x17DCB5DF02605, 0x2BC06DE1FE406, 0x6D75806F67B67, 0x60102217D28C1 },
+    { 0x56EEAF980BD07, 0x1660052B209B3, 0x650CF83997A62, 0x46037705B46D4, 0x2F8D3C56B7157, 0x10005671EC6D3, 0x0AA02C0233545, 0x518AC8BABBC24 },
+    { 0x140D9AF568043, 0x1D8454DADB785, 0x42640FF5A2223, 0x1A140DE3478B7, 0x0D11E10E594D5, 0x2EE5F5D5C65AC, 0x1B7148856C146, 0x024DC046914A9 },
+    { 0x4BD8580007DEA, 0x735824FDB9AB2, 0x79D78A11A95E9, 0x3D43AFC63AC61, 0x4C236D804F3EF, 0x65D57BEF7749C, 0x66095EFE1BBC0, 0x6CE933184CF40 },
+    { 0x16F4AF2995931, 0x031E812068F25, 0x7D5FEA5648F18, 0x7781CAF997081, 0x2DCE1FC4BAFF5, 0x6532A66BE9EDB, 0x1BFEF7BE3FEF0, 0x0D7E62EC8BE02 },
+    { 0x5BF592771D69F, 0x1E9FD4D687022, 0x3A6DD17EE4F22, 0x23C4FE76AB706, 0x5EDEACAC129E5, 0x2C556C61E647B, 0x2BD712960A7BE, 0x27A835DA0B460 } },
+  { { 0x514817F41228B, 0x38997FCA152F9, 0x36FB1A5E04762, 0x3A9A0969FF205, 0x38AFD186C0733, 0x4C5C269860469, 0x18832FF70B2B6, 0x6B91EE9068050 },
+    { 0x04125745262C0, 0x736542E87115D, 0x79D87F3F903C8, 0x08EF11BA791B2, 0x3AD9EB0FDAC02, 0x5C0FBDE3B1F04, 0x16F5948C20048, 0x10BEB97E8CBA9 },
+    { 0x21177543C28E7, 0x59DD7A1FE0F49, 0x257AA6D823CEC, 0x32AE3CBA4A08F, 0x05787F5C216DB, 0x333EDC5F95AB9, 0x354EAFD35E5F3, 0x6E92CDD111F44 },
+    { 0x3944E5220F17F, 0x4356BBFBD7FAC, 0x7096CA9F749D2, 0x01A99C290DFD0, 0x42B961A38E642, 0x3F385D8D563EE, 0x7A14AEBBFBD3E, 0x5F0AD544B9C93 },
+    { 0x7942D0B757A28, 0x0323BB224E28B, 0x12C8B3CDD68F1, 0x52DA23F93FE00, 0x716483D3EF6F3, 0x58A674F09ECAB, 0x4F92E5419FF87, 0x6A4F64AD9112A },
+    { 0x4C7034530D66E, 0x244CCFEC90B14, 0x59FFD0033E7BC, 0x13A1144046418, 0x3BA22160D3024, 0x27537EDA65D1A, 0x583668EEAD7BD, 0x39D75B5AB3C7E } },
+  { { 0x79B7BD45DC465, 0x74D45743950A5, 0x56673BC9E7255, 0x05CA1F392678B, 0x7BE42738B4591, 0x717AA85B18832, 0x1A29E80A06935, 0x58B36DD11E761 },
+    { 0x7C41F18888949, 0x09ACBBDCA9951, 0x46C163CBFD8A3, 0x7890A2EF9FB12, 0x7E6D7E9A366C9, 0x458DC5F47FDAE, 0x59EB5E59BA440, 0x7AE8F1041EF5F },
+    { 0x41A840EB3176A, 0x34D2F39C05CB4, 0x76A770AA683A9, 0x0F9AF45EBECE6, 0x5F1518581367B, 0x17DA3C103A49C, 0x28E746D349141, 0x0A620AEA0F953 },
+    { 0x095BCE477E867, 0x776ECE49EA5CC, 0x62742137335FA, 0x76B083CC34FCC, 0x323E91D77826C, 0x416413096B6F0, 0x7E7EBCBDE48F5, 0x468F2170E26A0 },
+    { 0x512EDAFAAD8F0, 0x41B86C2D26EA8, 0x5C3B637C968B9, 0x426D8463AA5F8, 0x5D5EED6071F7C, 0x0E727CFC8E3AF, 0x0ABB8DDD8BA2B, 0x09719E8FE783B },
+    { 0x78931AB54055F, 0x147622171F6CA, 0x4E63D9B724393, 0x14EAB25228BB8, 0x18AA07F3AFDD3, 0x2251F9D8DEEE3, 0x33D58DA5B2CB2, 0x1ABE8C830920E } },
+  { { 0x06937385E9FC5, 0x0ADD72E21AA63, 0x4714B80D2EAD4, 0x459A1B2B2A2F7, 0x1F8407BACD67D, 0x6EB8AFEFCE667, 0x3527635904102, 0x0718BF360F10D },
+    { 0x56D8D9876F77A, 0x243B0111961C9, 0x06762229770AD, 0x5E0BFA44D0FD6, 0x2A9FE1CF571D3, 0x3D2446FDB60B6, 0x2BE334B873D24, 0x37E973912DB33 },
+    { 0x0EA8907B31040, 0x6105BE3E35003, 0x294D9A631305C, 0x0EF95AFE5258D, 0x46C6176DC7B4F, 0x4BB8ADF2C31F2, 0x131B01912D995, 0x75E0349B84A3B },
+    { 0x1DB21E4D16A3E, 0x1F807E73F4672, 0x5C74DBEEC9588, 0x54F3E7A2F98D6, 0x3CED3C5C002E3, 0x5C92F43441859, 0x12B7F749DA578, 0x7DDF071CD4F6F },
+    { 0x2C149E260FDE6, 0x7F7F386BC5E76, 0x1AFD8E410C538, 0x56614B2D0AE3D, 0x51DB9943B10B6, 0x5088117F2DC15, 0x7CB1D43A79A21, 0x45C667843811A },
+    { 0x1211543EC9326, 0x1717E777705E7, 0x0C6A9E2CC5520, 0x126670DFAFCEA, 0x4050A23428424, 0x1C3FB0F3F8016, 0x2B484E0A06391, 0x36F7A77F7D74C } },
+  { { 0x2FB5AAA9F22C9, 0x4357B90871EF1, 0x3F68E1AE3856D, 0x59FBACF1294BF, 0x0CD2F0CE8A29D, 0x537161D408ABD, 0x76430B18BBEB5, 0x632B0094F443F },
+    { 0x5E31A88156C01, 0x4F45A8F509463, 0x1F65F73EACA70, 0x6D84C51A9998E, 0x22B6021F2B769, 0x03923A3032B47, 0x58F43A1C01E98, 0x1B655FC3FB98E },
+    { 0x3CE066C5BA561, 0x1E325C59BE727, 0x505461ECE76FD, 0x3BF5C680DE9D9, 0x5B478B940F80C, 0x4074E98F56D04, 0x4A45A659FF7D5, 0x50B7807F4CCB4 },
+    { 0x3D44176288CDF, 0x715E10248E083, 0x1A013581F82A1, 0x13F26FF032B3B, 0x1D2D7753A2698, 0x2F37EF9BC639D, 0x217997E3973F7, 0x01F29AE7D7D29 },
+    { 0x4774EDF2BBE72, 0x5DD8E7BA2998A, 0x185315DAF2816, 0x105EDF4DDE411, 0x66BC47A18161F, 0x4B638A5F9C082, 0x0398495DE35D0, 0x199C71EC27299 },
+    { 0x23A8F21C79B98, 0x0BDAFC7297ABF, 0x2D0868D3A8886, 0x18AFD681FB3DA, 0x3CD63B40164C1, 0x2CB1B3279294C, 0x569CA6243F927, 0x1C76469E15201 } },
+  { { 0x0674EEC91B03A, 0x1C8C84A37C62B, 0x51AB92115FBDA, 0x0AACAF44F6F55, 0x28A0A50A1957C, 0x0264644A63EA8, 0x0100BDBAEDD2C, 0x0698D70EFC19A },
+    { 0x1125BA41C67DA, 0x1AA1204FFCF62, 0x279A2F03122C9, 0x5FC7DF1AD0FAC, 0x0D974C883A672, 0x49642E122725D, 0x4AF8281E6AB8C, 0x20FC4F9DA114B },
+    { 0x5306785A737C9, 0x4C51D6A566897, 0x6426629E2B5AC, 0x69B95DE82DF97, 0x33F8D0300E2D8, 0x4AAE11B80CD03, 0x7BC45B025FAC9, 0x584BEDFEFF273 },
+    { 0x557B18FBFDDDF, 0x57120C784DAE6, 0x418277A21F2F7, 0x4B0A353D7002A, 0x49BAB1C4C9091, 0x01FEB81BD078E, 0x5CFD4AFE8734C, 0x1CCB0ABAF7B99 },
+    { 0x28F87048C5DC2, 0x3B96366FA6098, 0x4939DA4E974EE, 0x200552A8A9F47, 0x551CA1D1DF4A4, 0x6BDDE5A5BD4CF, 0x134E257532131, 0x6721E46F9781C },
+    { 0x1B7DC238EBE4D, 0x08FBC1B379F1F, 0x0429B524DAD1E, 0x0D68D762DCB51, 0x1C59CB98EA3DF, 0x24D904DA20EC3, 0x7E6245EE45EF4, 0x1E42F809A8574 } },
+  { { 0x66A39CA537C67, 0x08F095B57E58F, 0x18C4974A25073, 0x3F935F4A9CB03, 0x2FC12ED65464F, 0x607FE046B8C0C, 0x391F9643E9397, 0x5F83F99E69639 },
+    { 0x01C6AD2302886, 0x296923AD88889, 0x180A7E1B605BB, 0x1966B0CAFC13D, 0x131600D3871B4, 0x0696A523C2D7D, 0x3D468EE3A3642, 0x4B898E8875031 },
+    { 0x166A4A9E91349, 0x5D3E898951ECE, 0x08E9C57E9405D, 0x3612A4324389F, 0x1ABBCCB4D971D, 0x457943BD44C65, 0x67F7C4D1808D0, 0x2AD18F8DCBB8F },
+    { 0x2CB68AE3D7E6F, 0x18DCCF901F364, 0x1042E830D9B16, 0x0BFCD30A5E046, 0x6EAE9D1BD6019, 0x7355FEFEA1940, 0x1EE118ACD01B5, 0x162FD787496F0 },
+    { 0x7F408F31C351E, 0x2A94C5C513AF0, 0x1574F717780BE, 0x7CBD033B74730, 0x530D2AE6937FE, 0x6D88C4356FF8E, 0x1D4A211EE1631, 0x42F7BC6E30395 },
+    { 0x63FAF60FD8E24, 0x0D793B2669C87, 0x132D2CCFAA12D, 0x08B1C42791DAE, 0x028633885EF36, 0x28322BFCF8B02, 0x5F871B237312C, 0x29EA60F74BC1A } },
+  { { 0x05A86EC3267ED, 0x348CCFC17D46B, 0x218B7ABD161C5, 0x1B04635AF23B1, 0x76A3CDACEA2A7, 0x4C91B34F05C70, 0x7BB4B01A327C5, 0x2D49C35CB2843 },
+    { 0x519D3A180CDB7, 0x362A3A66B4DAA, 0x5E4ED14FC1E5A, 0x6AB1351FA74F0, 0x02020D5D5EB53, 0x2F634BE2BF1DC, 0x5337E362E333F, 0x3AEEEE3253719 },
+    { 0x67A570E1634E4, 0x1D6EA51588B5D, 0x2927DEDD042E3, 0x45CBACFC0E753, 0x26FCACAA6D854, 0x56D404CD0898B, 0x5E273920597F9, 0x41D991330E160 },
+    { 0x3053DF4C91FC8, 0x59BC716744209, 0x2AF58A6C94470, 0x0B54B832094F6, 0x087326DAEF0D2, 0x1495C40C50940, 0x3EDDC49B233C6, 0x770954410BAE1 },
+    { 0x742E0A0648A24, 0x403094EBC0E42, 0x39CAAD4E9C0B7, 0x1FBBE304559FF, 0x1E4ED6C790DC7, 0x0B1158A1EF03E, 0x43078C2C4B053, 0x3FA7926DAC34C },
+    { 0x6BE1F4DD18E77, 0x2478A9BCEE8A0, 0x53BC90AA3F629, 0x0DB88D4A8B52E, 0x2C2C3761E0095, 0x2A13F771AA922, 0x0025D889F49F8, 0x34F23049606FA } },
+  { { 0x2109E78FF00B3, 0x0D0C1B3E2B584, 0x0C4AFC2EEA80D, 0x44AD1E0187865, 0x3798065BB70C3, 0x50EA2F57E0C19, 0x0DBB2D6CF542B, 0x7E6A6431A8615 },
+    { 0x58783FBBFF76A, 0x28FFD1A7AC323, 0x5F583780E41F5, 0x67C3CCE600C70, 0x150FE3BE911C9, 0x6D53D2B3120A6, 0x4E0137B3F8224, 0x044D15475A0BE },
+    { 0x46931D3B2ABB8, 0x370F71AC48D75, 0x5571300C19F03, 0x34EF3CDADC5F5, 0x76701FDD6BCEF, 0x7FCEEB86455B8, 0x3AB03697F6967, 0x02533EE72CCC6 },
+    { 0x1AFF4C36090E1, 0x5413840F75E88, 0x2C1AF15A4F5D7, 0x29698C1289265, 0x65E220DBD8FE6, 0x5819F87127C1E, 0x19C7A78E46AB9, 0x03F1077EE0D28 },
+    { 0x760D9B9CFCA1B, 0x75222C9BA547A, 0x053448E3035A8, 0x415A1280B5234, 0x7F9128E4873B2, 0x511A28C7077A3, 0x7F83623984915, 0x5F153F7B1A9E2 },
+    { 0x7F2690609F812, 0x1C685C77E7B54, 0x13B3B85572CD5, 0x10111CBCCD285, 0x74BDE490EB996, 0x21D0C45A83238, 0x426FBAABCF39B, 0x317181F28723A } },
+  { { 0x170B13238FDB0, 0x3DCCB239D60C1, 0x3D642DC8EB6CA, 0x16C0C195B9A15, 0x5F0892EEDCDDC, 0x6C668E2329916, 0x2ED74A4DA1BFA, 0x2198AB1548AE2 },
+    { 0x1CD8994148B83, 0x5CE5752C2C3FA, 0x535CB969DFCBF, 0x0B674693982DF, 0x7E6518831D75B, 0x5BA6950484159, 0x4C9012625AAE7, 0x18A670088F691 },
+    { 0x7586DBF2219C3, 0x203D527BEEBC6, 0x5E49B77397ED0, 0x1823E5E3733A5, 0x2B1EC8586DD94, 0x00B1DFFE07F7E, 0x673DB7B99A496, 0x5AE38D8A357A1 },
+    { 0x35D80C68CADB0, 0x26D3D00B7A5A1, 0x36CA0FE8CA631, 0x00A431FFB2468, 0x10E23575AE8FB, 0x51B3E00DDDE06, 0x518497F4B9D49, 0x67D27A4F044D6 },
+    { 0x39318AF223074, 0x00DA696F9794B, 0x0A8FD0C415918, 0x211A79DC4668D, 0x575D21E71BF1F, 0x7EFE42DBFF1C0, 0x7B45BFB600C8C, 0x2BF13FEFD1765 },
+    { 0x512F3E62AC43F, 0x18E560FAB4744, 0x5C4B774E8AC8D, 0x0F4990F5C782F, 0x6A1F9BACEC060, 0x31336CBFE6D47, 0x351362277BF87, 0x2E66EE939FD25 } },
+  { { 0x3E62D4B88DF0B, 0x0F4E1D326B93F, 0x53650E97539D0, 0x11B2DE632DF5F, 0x20041F3440D25, 0x00D7138CECF23, 0x6D0501209E2D8, 0x698820F5E2E1D },
+    { 0x35D1F83720DF8, 0x375E4AD7EBF7F, 0x20AA52115DE32, 0x465D474C6203A, 0x373C29A9FEDB2, 0x0F83A47C14E1E, 0x1518C34347249, 0x0A96A47F98DAF },
+    { 0x596E980021CFE, 0x34ADD894777D7, 0x72122C4D9F61F, 0x62C2278E1FC49, 0x560F4EFA42071, 0x1E6360E2CC7BE, 0x742FC353D16F9, 0x1E18AD8B4645D },
+    { 0x52BF4FED96FB2, 0x5072F52965F86, 0x4A1550ABF01BA, 0x64E35AC2E9DFC, 0x0A4342C3E3FE3, 0x45B1EBDE929EF, 0x78CD53C91CD20, 0x00C5D1D528D01 },
+    { 0x02C1D4DC464BF, 0x71A00988C25B2, 0x51474A92531B9, 0x7FD500F84621C, 0x5FE5633B6FAE7, 0x13288499243F1, 0x1FDBC983CA818, 0x7CC6B4AE76B81 },
+    { 0x04B788DE847A1, 0x095FBC6774044, 0x1FD6800DA982B, 0x210F887CE04D3, 0x310D8AECD0854, 0x29B7C43027F63, 0x3EA5CE0F7A119, 0x2961B5C44DF25 } },
+  { { 0x401E8422235C5, 0x041AE374AFDCC, 0x26C85CAA37C33, 0x453CCCFAB2DE1, 0x0965F9023E507, 0x222831BAB0EDD, 0x516683678EABB, 0x57F3B7347075A },
+    { 0x35927AC1CE52A, 0x55E1DB96C77D9, 0x1E06E8EEAD8C5, 0x6F34680C7B613, 0x5E1D1F03307AA, 0x49A9CB334B278, 0x6F819B3D3B123, 0x1C5DD5A23EF24 },
+    { 0x0B9F1AE52B15C, 0x2DE1EC785DAFF, 0x1EC9BF1740F1F, 0x1B77CEE6E0E62, 0x79543533A471E, 0x4FE2D9F576CAA, 0x62B9BCBD10BF8, 0x76287FEF3E564 },
+    { 0x131A2CC7F5BF7, 0x780C0D8E6971D, 0x6E9F1B3B43EA3, 0x0485B61B9542A, 0x5B742F39DFAC1, 0x422442D5F7B86, 0x55034ACB64C80, 0x5F87E70B1606B },
+    { 0x6851B44ECF4DE, 0x19C2ECEF68769, 0x562F14AF611A6, 0x2DF4479602F71, 0x2F01633DB7657, 0x5B9D05512773F, 0x7AA480E9DD8C7, 0x2ECD17298B242 },
+    { 0x02CA9C834B0F8, 0x1BDB3A703CDA7, 0x15A107A974CA0, 0x160C1A83CA656, 0x3F59E5AA3711A, 0x321BBC8BBFA1B, 0x2DF9C48812223, 0x38A5FC4DE1B45 } },
+  { { 0x59F60590AB386, 0x1439574AC8232, 0x74C099A00E1A1, 0x0FD0566AEB092, 0x1392EEA41DE3C, 0x6F0719B79BC48, 0x5ACBD7948D705, 0x36F9D902BBE36 },
+    { 0x7BBDA82E57561, 0x52A10499B6DA6, 0x2C6E4DAC26226, 0x177B454932F87, 0x223E8029CC1EA, 0x28377071E960E, 0x78C074C60BFD4, 0x05E2849D75B23 },
+    { 0x3A79E8AEC18EC, 0x1503F86B44A5A, 0x5251FD92C22ED, 0x508CAE4E37CD6, 0x2CE4E8EFE357E, 0x38E04BE96A178, 0x5515BF2A3CC06, 0x3B22D36C46FAA },
+    { 0x661AE3F74DAD8, 0x7D9D57C2A07CF, 0x25F4ABCD18718, 0x3C56C7E689F62, 0x04CEB0F9C5EF7, 0x63FECC86D4B71, 0x155C0B327D205, 0x6D4AAA37B4A87 },
+    { 0x57D5F54F58828, 0x2CB08B2B15819, 0x1C4CF2A502287, 0x02678563DA37D, 0x11D40CAD59DF5, 0x41298C7F68A7E, 0x702F823D432FE, 0x32C78FF3056A7 },
+    { 0x75C20F8D5A39C, 0x0D4A15639D877, 0x082A902D5C012, 0x1E591168F510B, 0x3DED0913D053C, 0x2975538C72DAE, 0x3340A1F01BA2B, 0x2ABEE21105E84 } },
+  { { 0x60AB248B204B7, 0x33E3EF1056B10, 0x5A38933E40F36, 0x363F7CFE042E8, 0x456E46BDC1535, 0x6A3C31AC9DEA4, 0x4100E84CFCECA, 0x2D36DDFA3FFAE },
+    { 0x358CF8FBEAFE9, 0x23ACEB017C9DB, 0x3A58C303A4992, 0x676FAE5B4C024, 0x1560B8EF611BC, 0x0667FC1D1A517, 0x6DADD41C538B2, 0x7095D04F87542 },
+    { 0x391DFA646C458, 0x300088EC451D8, 0x5B287930C8B02, 0x05AE6C452C0AF, 0x31652786F422C, 0x20FD7A33C8CC3, 0x7FE64D6E002B1, 0x352BFCF892F63 },
+    { 0x396E79180856C, 0x7A301BF974221, 0x082DAA2B7CDD6, 0x60D0657B37E3A, 0x0A0B6EB4ECFCF, 0x5E0D443C3979F, 0x28D7C6C3848A6, 0x20F182516AB46 },
+    { 0x2308BE03FA0CB, 0x6B32560538D34, 0x49E1BEA71BD05, 0x600899FF5DE3F, 0x0E97A7DBE3D02, 0x0063B4465B5D4, 0x22EF3CC3A2E2F, 0x26DBDE8A36D99 },
+    { 0x64D2194684D95, 0x17CA54E799B5C, 0x457A2433A08A2, 0x1D0000511BEB7, 0x56B999B96D4FF, 0x30675C5DADE9C, 0x5A31B7651B283, 0x2A35D9424FAAC } },
+  { { 0x31A1C4BFCCED6, 0x59A45C5A99449, 0x74170BEF6695A, 0x78BB5C77D4951, 0x37850B33679D8, 0x58E33B02B3403, 0x00CE3649F3D36, 0x2D9DD805753ED },
+    { 0x1E92BDF4995E4, 0x6814D7633FA13, 0x2CA2FBE2501A7, 0x41DBC6691B2E8, 0x7C15CA0370F79, 0x45F7643AB2088, 0x129E4DD12DC6F, 0x74136787B6B2C },
+    { 0x7524986F00ADC, 0x578F54779B2DB, 0x36247E671AFEF, 0x6A33D46ED5B95, 0x1A9826332FEF2, 0x512E6F432EEEC, 0x7EB80B10622AE, 0x316FA15F0F58D },
+    { 0x0842E1F345E0F, 0x34A190DC4438D, 0x7B20C8E037B88, 0x3D72E6F1DC126, 0x7B401664C2524, 0x651735D84B62E, 0x6D92C515617A7, 0x0A0A23F13F9C6 },
+    { 0x78F6E63230DD2, 0x7B75F4D33A823, 0x397295BAFCA8C, 0x43D143BBCCD36, 0x640409B618532, 0x3089E6AF1CB29, 0x579D30BABB460, 0x2B631F5D14EBC },
+    { 0x0D9DC2C5B41D2, 0x1763F6BF979CC, 0x3E2914D61549E, 0x1D18558505DE3, 0x6E49BFB0FED48, 0x336ABDADA624D, 0x4873B8655ACA6, 0x2F27ADBE8FFF4 } },
+  { { 0x058314FE485B8, 0x5CC1B108E5EB1, 0x3A744C42BE723, 0x75258AC51AF36, 0x10608891FB2CE, 0x34B74FE5BC4EB, 0x5EC45223CA673, 0x5F9A2D29167C5 },
+    { 0x0D0FF67F00A23, 0x37E8EE5001F39, 0x03F2F5111758F, 0x5A4057678FD28, 0x59D55E1CCD5D8, 0x14A3BA4C53EE4, 0x7EE01474EE036, 0x254B33354EEB8 },
+    { 0x6E72A1EAFC060, 0x4FDDB0A054D4C, 0x225F79ECED7E8, 0x75E516DCD1149, 0x71EB7DAE0FC32, 0x11482ECAF1D03, 0x34C45F5B9752C, 0x72FF77447B504 },
+    { 0x605D6CD48911B, 0x344DF3947260A, 0x0E0114C3F9CD7, 0x03668A57DB4B4, 0x3F3A1CA06FE39, 0x769EF64BF1447, 0x389CC44E6FD55, 0x7514609402B84 },
+    { 0x45A0FAA480EE6, 0x2C5F6E1C883A0, 0x2A92FBC16F248, 0x4CFFA44073666, 0x302D9C40A6792, 0x77B3BBF1ABDD6, 0x559398435941F, 0x37D280148516B },
+    { 0x3BA553A7F4E61, 0x129BAF1945783, 0x7C4E40F7E4D37, 0x1BD95BEED76A8, 0x477E5DF32E49A, 0x3199C74EE7767, 0x0F671F58E6A93, 0x2BFB43DC3AFBA } },
+  { { 0x005E9D2FDCA2F, 0x7609B7A945BCF, 0x1D8445DDA72AD, 0x603FFF5B18093, 0x35A9A475E31E3, 0x36DB356C9ED0C, 0x1227CB2402D69, 0x3EDB7A7832034 },
+    { 0x05160A8CC5768, 0x1C070BE706A1A, 0x6F1CB44321D72, 0x1C4F347B7D8E2, 0x5E4777F9BD628, 0x5E8708151180B, 0x78860ABE7879D, 0x25D1D39DDA917 },
+    { 0x2D8008C886CD0, 0x77324CE9F782E, 0x7CD7DC216BF35, 0x01130756A4432, 0x19C3324760619, 0x4BF4F1EF347C3, 0x088C1DAFB4198, 0x7570B1DA3702C },
+    { 0x2D229B615FE62, 0x33FCD3427B86D, 0x1E69996A5B2BF, 0x132221AE7E943, 0x0496564BE90D3, 0x51317D10111DD, 0x591BBFDE262D6, 0x199D8A76C9BE0 },
+    { 0x73FD882FF9E8C, 0x18800582FCFAF, 0x37BA4A9DED701, 0x0649B3413BBAF, 0x649FA290E00D8, 0x74332086FB540, 0x4E293894AC835, 0x5A36E669F411A },
+    { 0x55BD854EC014F, 0x16052BBE8935F, 0x74764334903FC, 0x0F000383478D0, 0x1FC9283709F0D, 0x20E4773309172, 0x5FB6714DC52D4, 0x1A5790740768C } },
+  { { 0x7795A72BCC249, 0x2CDEE2E27984C, 0x1DCC2F33C8A05, 0x5E47F67D2C06D, 0x58A5E8D410CC1, 0x7B0B1562B5EB5, 0x31B41725F9C79, 0x1C949124AFDDD },
+    { 0x3DE3DAAC87697, 0x47E10DC0639E6, 0x071C029B15195, 0x0DD7D4266C549, 0x16F429FAD33DC, 0x6EE4DC8D8FB11, 0x7F3562780A8F5, 0x0737499F9C31D },
+    { 0x7B2E6B538A385, 0x3200302172C84, 0x2695D00A50B45, 0x06E0AF4F79825, 0x39B842453C028, 0x4F41F7943833C, 0x744AE7CFEF254, 0x3D33F54800A7C },
+    { 0x71FC48E4DBD96, 0x36185DEF1230A, 0x44087F1EAC029, 0x1B9C23AABECBF, 0x1B521A9AED546, 0x2256E94783AE2, 0x24141A9D48E01, 0x6CABFB9D0EA0B },
+    { 0x4C5FD38CD2A88, 0x4F042F0D1944E, 0x46D0712C7A032, 0x7C42E52992115, 0x2D7A65C031CB9, 0x3F48FFD5C8E0D, 0x5B410D48B888B, 0x262FAD6F1DD7D },
+    { 0x18248AE54EE82, 0x1FA4D4345BD87, 0x4B52495CEC445, 0x13C247B756794, 0x694F6B1647AD9, 0x2D47A14DC2B7C, 0x0BE53E1F21BB8, 0x20EA961490316 } },
+  { { 0x04B56442DE9BD, 0x333ADCFB87009, 0x30287D26F91A1, 0x7B85CBACAA1D7, 0x66C3DDE5124E9, 0x17FBFEF2AF945, 0x3739A201D6B93, 0x0658C0A2ECF2B },
+    { 0x6D6298F066F2B, 0x5DF14F4882984, 0x22D921F0F41DC, 0x51DB2EDBD8A0E, 0x02537F183B749, 0x3868CF44D7AC3, 0x429034C623401, 0x760DC5B94E6E1 },
+    { 0x3C6F804DC218C, 0x31013EB0A53F5, 0x05786E51AFE1D, 0x3F8F681010FEC, 0x3FF372FBAB350, 0x60250A3955572, 0x5A28A97FC20C8, 0x4C73F70B3BDF6 },
+    { 0x23029EC10A804, 0x5A174F0E53B33, 0x2F8D77A2F2CD3, 0x415A411935094, 0x06744F011F26D, 0x17070506A01EB, 0x0B3598D03A19A, 0x4EEA0DC698E65 },
+    { 0x4B5327E9041FA, 0x1F9543C1583B8, 0x104713C6EFF5C, 0x3A6AD84CBCE68, 0x033606C4A7C2A, 0x55A0BAA886FAD, 0x1606765B047CA, 0x36789A7F2240D },
+    { 0x2B0FC2F819937, 0x1CA11D65CA829, 0x7E1AB0215E5CE, 0x09B69504D27FD, 0x586662EA95D2F, 0x20C69D15A9FC7, 0x3385DBAC1F0AA, 0x2270B9F3291C6 } },
+  { { 0x60564CAB2D7F4, 0x4E04FFDEA33AF, 0x5EE6A2D50F5D3, 0x30DAE7A5E2171, 0x1556C020F579E, 0x2E3F78403B0A2, 0x05CF7E8F0FCEF, 0x3989D52D0E8E9 },
+    { 0x37583A2171B19, 0x6670562B858BB, 0x407775A2364E0, 0x20788B16CA9DB, 0x72B58ACDC2A88, 0x5CF87ECD7CDAD, 0x33A922A23B002, 0x0499C1EB6F649 },
+    { 0x5C02B7F307D2A, 0x435AC7900FFAA, 0x3179016B33A0E, 0x6C3692689EC05, 0x0853D4D3A8714, 0x445A4A23141BE, 0x31289213A38F0, 0x7D2F3F0D0A7FB },
+    { 0x7BEE00959A3E6, 0x12E4B91DAB232, 0x1B662146442DA, 0x30FAD3A9B56F0, 0x64B8D2833C6F1, 0x1EAF1C9EB0D80, 0x661060C1F7A78, 0x4F04FBAFA324B },
+    { 0x558DF3642A366, 0x63E5F048C02A7, 0x63AE01754B2CC, 0x2F38E6914181C, 0x5F0D50BD38ED0, 0x5A0332730FBEE, 0x481067F419713, 0x3F452F7D83A44 },
+    { 0x1A4A943D04011, 0x12046CA9787C3, 0x3829356916CB1, 0x0C10ACF3E71FC, 0x0F3B821F06519, 0x2F0C59B1F66B8, 0x59BB7F2463C94, 0x289712FBC4D38 } },
+  { { 0x3D009DAA58089, 0x4434B4CD7E530, 0x37CB66D319E80, 0x37035F49BF86F, 0x55E38C9595BE9, 0x7CE76A19129A0, 0x3F685FC91D16E, 0x14DBB3D7ED956 },
+    { 0x4E6AE1B8670E6, 0x25D86F18855EB, 0x3CC1500E4ED00, 0x3F4B9B60728AA, 0x187FE14114207, 0x741042C2C6928, 0x1167E412D3A97, 0x4A8860A2CBE65 },
+    { 0x7C5DDA1A0F2C8, 0x74988E1D14F5D, 0x5CC82A810A67C, 0x1622878EFAF44, 0x69A6F0811BB47, 0x45A9DABBAA375, 0x2FBBA0B268522, 0x401811690066D },
+    { 0x6D92F87DBD79C, 0x5668C763D01EA, 0x61801CAED8228, 0x01694EE4820EC, 0x0E35BD2044965, 0x21FC27131BB1D, 0x637992F870DB1, 0x4A877217948A0 },
+    { 0x25DA9343C6BF3, 0x0F20187C12161, 0x7D8101068E6E7, 0x25D08929335C5, 0x5DF129170DAA6, 0x0BCC946FEDF73, 0x40B4134F65E7C, 0x57BACC3B029B2 },
+    { 0x4FB88945C56B3, 0x036EA272BF604, 0x14679CEEFDCC3, 0x1B0A61D958184, 0x635A4F7892DD9, 0x2ACDB67DC5FEF, 0x2DE6524FC1024, 0x2AF0914994245 } },
+  { { 0x59DF1D6AD37F0, 0x515EC56E5BD21, 0x0AB5E81088944, 0x7904BCE48D978, 0x3B3FFFFF90600, 0x0CA923FB0EA87, 0x1E3C2CBCE96BE, 0x79AEB4210DA49 },
+    { 0x3E5D914033EE1, 0x6C795E0FF4487, 0x559AF1396A83C, 0x007AB189A9F28, 0x384C86E915A5A, 0x31C5070254CF2, 0x0A09E8A9EFA45, 0x4408A632B6918 },
+    { 0x4F7337D296C28, 0x36ADB3AE1350B, 0x27CE15908F528, 0x3EAE1738F0204, 0x215918CFD46EA, 0x494A3225290BB, 0x7ADAB66EDB773, 0x24F2BECDBBF2E },
+    { 0x356A885DDFBCB, 0x32F2A9E1E5C1F, 0x6D794217F6CB7, 0x089C562B741A7, 0x31F9207A71F23, 0x1F52057715166, 0x230F6D3D967E4, 0x19A8E131BD5D2 },
+    { 0x18FE29B1D800C, 0x23E878E49944D, 0x0F0B99C2A44D6, 0x4B3365EC38AB2, 0x75F05D8958FE9, 0x5AFAE764EC837, 0x3FDA09A441213, 0x553652E15FA06 },
+    { 0x74A5BD653FB21, 0x0DBA29FCF9E8A, 0x02E2E130FA28A, 0x212A6DB564418, 0x533E26735DF0E, 0x29B488D1CBBCD, 0x6A9B0DE440366, 0x243DC5A6C1AC6 } },
+  { { 0x4B4507E94F033, 0x5D905E0C85D38, 0x4D8ADD754E41C, 0x4AC99DADDC583, 0x08C731E83B15B, 0x5ADDEC89383ED, 0x508A3738D28D6, 0x349013F61FE2E },
+    { 0x3AD21E3048861, 0x6BAA80CF4D5AE, 0x6112F994314C9, 0x02B5DE794CBC5, 0x7A2A28C962B52, 0x48FB908E9BBA1, 0x058E22FFDBC28, 0x1084EDBCD19A8 },
+    { 0x514411A0073A8, 0x6CF2E97F75860, 0x4FD0C4695009B, 0x08DF919420372, 0x369FAC4477780, 0x6A6531D225D39, 0x1F127552C7517, 0x2B39404799CB5 },
+    { 0x4C30D3B338236, 0x03DF5C8FAAEFC, 0x39B5850BEB418, 0x0D5986D09C272, 0x72BF9BF9D2BD4, 0x7301973712AE6, 0x151D909EF77CD, 0x6014729209EB3 },
+    { 0x152CD3E6FE125, 0x67490851B9FBC, 0x0B39247FB3154, 0x5956DD1868189, 0x082C6C0EADE5B, 0x5709DEE3EDCE2, 0x00142491F8356, 0x349A78D23741C },
+    { 0x258367856A2D2, 0x16C59A6F1EBBA, 0x4CE9370480EC2, 0x19102EEA8D4FE, 0x765B8F6087D30, 0x29D9B984A71D5, 0x53086220D9AD3, 0x350991D29C231 } },
+  { { 0x3A692374B79BE, 0x3F62C7B3AD62F, 0x1A37AC3BC5B4C, 0x466C454DCC08E, 0x5DC8CC38A0EDC, 0x279D764C57174, 0x7E3DB8A940C98, 0x5E2CA388E5219 },
+    { 0x77D20BEB65B62, 0x60094EB9F3755, 0x52F4A27B1163E, 0x2DD3404852CE2, 0x2732836367629, 0x54AC7AC475025, 0x1CC7569CDB107, 0x3E93EA96EE364 },
+    { 0x2376839F4507F, 0x094F7C0CB3AF0, 0x7FB3333618D1B, 0x7CB4A7DFD43F0, 0x5CEBE4AB961A9, 0x483CB5E420BF9, 0x54E8F13948EEB, 0x4BFC0DF8D204F },
+    { 0x55D7B3C8DA9C5, 0x7250961AD958E, 0x58B310CE5B045, 0x74BBEC74F377A, 0x5E355F85A78AB, 0x195FA47FF071B, 0x0AF74DBE72700, 0x144D4B7CD52AF },
+    { 0x488A6A16F4FCE, 0x1C8DBEBFB5D39, 0x6A33A7D99CDF4, 0x19C6294760358, 0x63BE20F1C6620, 0x4B9389F23F3BC, 0x5EEFDE9099431, 0x7E4AA148D716C },
+    { 0x72276948C694F, 0x10CEFB9EED0C5, 0x2F264EF672C1C, 0x09CD1D144BA74, 0x1FAFB3D8F371D, 0x1C6664AAB3C8C, 0x69835FCD41B93, 0x317A2531EDC87 } },
+  { { 0x2DE6CE727CD52, 0x47FCA1EF2C5C6, 0x15CC70059DA7C, 0x428BBAC49FA42, 0x4B14092C8FC6A, 0x05B7D7D60A281, 0x44FB421ED13AE, 0x6EC2D1655070F },
+    { 0x0C60856851B33, 0x36A866E44659C, 0x04B5CFBB69F6F, 0x3E72225D92CBB, 0x15B7A39B787ED, 0x1CC44EAED71FD, 0x0DD415A3A2CE2, 0x2B0F0DA0CF65D },
+    { 0x18684FC144DF0, 0x326FF86506987, 0x2632060D7DEBC, 0x5EAEB5F3E53AF, 0x601B6B3118B12, 0x6AC6BA0F5CD72, 0x20EEEBD02FDE8, 0x370F97BC1BC17 },
+    { 0x0684BCC99E58E, 0x0E124F1F23298, 0x4182C0D5AD337, 0x7B3215EFBBD0B, 0x42FFB2B88D020, 0x1ADD8949A9443, 0x03B7EC5FF97B2, 0x1B3955ACB1BF4 },
+    { 0x2967D039B7F55, 0x63465BDF17928, 0x6C0899E91B7EA, 0x7BA12378462C2, 0x1A78B26E28AB3, 0x6BBD79AA970C8, 0x7648AE592D8B6, 0x251FC9834F777 },
+    { 0x7400C83BB34D5, 0x0AA62B9DA13CB, 0x6494317828212, 0x15FB4AE786588, 0x59675143470D7, 0x2312B5A4AB7EE, 0x0B7B4D1377490, 0x23EA1BE6634AD } },
+  { { 0x0C7DA210FB1CE, 0x0F3C246BE4B47, 0x77DF5925DB7ED, 0x03DF760297F59, 0x0691D63F1539A, 0x6D66B463609D9, 0x79D9A38085225, 0x3D8F20344E999 },
+    { 0x6541D457566CE, 0x2CC0FB55D367D, 0x4FF9EBBCE3C5E, 0x517AE244E20FA, 0x11B7752F7D40C, 0x2BF85CC07EBD6, 0x7AF3FE18FE845, 0x1652B267ACA74 },
+    { 0x4025F97C97BAC, 0x7DFF3681D97E9, 0x69790B0515D2C, 0x2BD93D2A636EC, 0x052674C154515, 0x25DF3F5CA4464, 0x4FFE4F6BB3475, 0x637F24C64E406 },
+    { 0x65B1650547C28, 0x234A64A29E63D, 0x5818C768E48A5, 0x7D35BE1809493, 0x5AD1316DD3250, 0x73B8D5A2600D8, 0x346B4D47A1003, 0x7675C37A2DEAC },
+    { 0x69B2DA3AAD441, 0x2DEFA1FEF2BC0, 0x577DC74D3F971, 0x71F0D41A58DF4, 0x24E4919DB1140, 0x1DAE511044DDE, 0x5B73FDD854034, 0x12CCE7E595E58 },
+    { 0x55AF0EF2638A1, 0x11356A1363A03, 0x2FC6D5B236A3C, 0x0BFC2C054E3D6, 0x727EB4B70A983, 0x2576A5D2507AC, 0x25E9E753F9CF9, 0x2801CF3F54038 } },
+  { { 0x757B3AED8A4EA, 0x5B500B44ABE99, 0x65E4E08044E5A, 0x342D5D734096C, 0x213F084D2B3B4, 0x154CEBFC55272, 0x7C8D00F7B7238, 0x2F8A8547B55A8 },
+    { 0x063466654AD6C, 0x6AF0D2026CF24, 0x10CBD81F82ECD, 0x1DB91E0B7D482, 0x13A2F2EF31E8D, 0x2702E25EBCF63, 0x4525AAAF042B3, 0x5BB2F53BDC579 },
+    { 0x51796C9E21B0C, 0x3D5AD11C554D1, 0x078230B1DB118, 0x119FDDD09E16E, 0x4E02CAFCF126D, 0x101DE81D354CF, 0x16951D72BDFE4, 0x1F98033D6588B },
+    { 0x46CD05C4E4E2B, 0x318E6FEFC2E1F, 0x75745D7C7D6C1, 0x11A4F112680F2, 0x21B7F691FA425, 0x745BA3FE72AD5, 0x2EFF0CE7D1E26, 0x6506424033F9C },
+    { 0x309AAD4993DA7, 0x50C7EDF3BF4F5, 0x59E0734E5CA88, 0x1A067C602E170, 0x01F8567E929CB, 0x3BA85A3600A32, 0x1DEC9D8AFC488, 0x546F4F7850BED },
+    { 0x40FC478C23FAC, 0x157147ED2F495, 0x7B0C5357A1F34, 0x02E552746BF43, 0x62E005E7F228E, 0x2D19CC819C8FD, 0x5658D5E403DBF, 0x29B6F04468A17 } },
+  { { 0x32554B768D573, 0x4DBF19C3B6302, 0x1F966C9C0651F, 0x796572CCB0EE1, 0x3CAE61BF906DD, 0x35ACAA83F2140, 0x22227BF5F2907, 0x158C6843DEC1B },
+    { 0x3DDC6FD9C5604, 0x129C84312327C, 0x5723FAD92150A, 0x7702EF2E4010D, 0x1C357C3D7EC27, 0x6A389B1EC9402, 0x7FE662AD2AC71, 0x0392B49750759 },
+    { 0x076BE165230D2, 0x3EDDFE0A3575A, 0x2399FC5B666F4, 0x6BE22C9A33B0C, 0x31E4D753553A4, 0x47EE9F6310A09, 0x1B3ABAD233032, 0x6EDFE70CBC19F },
+    { 0x7D7EDA9B0D5C7, 0x71C13A7D0B36E, 0x40E238924199D, 0x7D72123039700, 0x5B3780A9633ED, 0x379F455CEB143, 0x12F438582A943, 0x63F1FBBCAB5E3 },
+    { 0x798FAD23943DC, 0x433F6304537BA, 0x734C34E2572E5, 0x3709959B8873D, 0x3B31A8ED73779, 0x33E1245612DF4, 0x76BA97E3287B5, 0x6BD00BCFF2ADE },
+    { 0x02D08F9618DDB, 0x1B2263BE1B78C, 0x6C0119F0AAE50, 0x06623B9283727, 0x2516A3EC54130, 0x298EA08EEB211, 0x6EB96EF7490F6, 0x2B956D5A30777 } },
+  { { 0x6188A4DEAEBE3, 0x653806D27020C, 0x270064E8325A1, 0x1FB73183B67D5, 0x18B0893E59255, 0x514FF58ADDEBD, 0x422A701D365D5, 0x47FBD3E04BB81 },
+    { 0x34DC896C9422D, 0x48BF9CCAA411F, 0x78103608E4C66, 0x5B0975D6961B2, 0x69C8016ADCE2D, 0x1B0353787ED71, 0x27E087B6ED243, 0x58F1728BF9F32 },
+    { 0x75E3423A7FFFB, 0x46022798F0D5B, 0x42261EE85CD26, 0x376BBE7E9F77D, 0x07C9D01D7B144, 0x3FE0D295F819F, 0x077862205ACFB, 0x372F3144ED86F },
+    { 0x5910153C7554A, 0x3E51DA790525E, 0x39498E2885FE3, 0x10E3F991B84B3, 0x64EE196E4BEC5, 0x39B7378D09821, 0x4A3A2C2DE5F42, 0x17CF313991643 },
+    { 0x59A9B81042445, 0x73CFAE46A7B1E, 0x2674C0DE23191, 0x5F40879A23BC6, 0x1DF30087E4EF4, 0x4ACA04B4AE296, 0x1E7FC7A196941, 0x20D93EF791331 },
+    { 0x07C3B2685EEBD, 0x086EEF64C5132, 0x634DCE57B6696, 0x11C68F3A24142, 0x03F8EA5BCC596, 0x21A237C728BF0, 0x50021B814EC62, 0x316360BBBE704 } },
+  { { 0x74A8329207D5B, 0x14E620419F1A3, 0x5599452AE7F84, 0x36126FB345046, 0x63945C811CF79, 0x14A4A4F99C0DB, 0x18562F6FEAD90, 0x1F4BE00C6BFD3 },
+    { 0x3D0F290B78554, 0x1FF871A567F14, 0x7BAC60EF6EB6F, 0x3AA403043AC15, 0x17B8421E047CF, 0x6F0BF7E2581F2, 0x61C918E3A5333, 0x2DA02DC0499A7 },
+    { 0x7E81433D30CD2, 0x2D7BEED5D443E, 0x5F847E13BC2E5, 0x1DB77CD66EEEE, 0x7A56B38808109, 0x2963C57D0FCD7, 0x2B2F54544B670, 0x64A7952977FF0 },
+    { 0x2FB618BFAE03C, 0x0BAE2F5B2D2A2, 0x73A2AD15C0AED, 0x1075D2610FB72, 0x10F1CBBAFF0F3, 0x7D2862418F88E, 0x6CC959D0C207F, 0x343F0678B3C63 },
+    { 0x06BAC25CA943E, 0x719B4E0FBF69C, 0x007622317E208, 0x5E0EFDECD4DB3, 0x754FA6EF2331D, 0x52746AF47584D, 0x43F50DCB7C6C1, 0x45E1ED9F62ECD },
+    { 0x2A9119582C7DA, 0x18EB89EBA91B8, 0x38CF84EB5F5A8, 0x1236DA20DA7DF, 0x2F1D5690384AD, 0x1E0799D15207B, 0x68E933AE64C20, 0x37C73BAA63578 } },
+  { { 0x5F8AB0C9BABEC, 0x50CD80A846B07, 0x5C3F1EB8A6CA5, 0x0557E384FD2A1, 0x529263F2429AE, 0x120E78F62D668, 0x264FC019E7211, 0x1CFB9FE148E49 },
+    { 0x171528EA11188, 0x708AD55AC4DAF, 0x27C1684CE52FE, 0x1B9411D07B907, 0x3462838B10B87, 0x611388FE3DEC1, 0x11FB8FCAD9E00, 0x4A1ED831E41D2 },
+    { 0x42651C08D9189, 0x30BFB74823F89, 0x63BBE1EE6B431, 0x2805530A855AA, 0x5C7B4BC95451E, 0x7BCE600C88E25, 0x1CF97EC9376F6, 0x66DE28785AE54 },
+    { 0x5DEE1CC07CD70, 0x56D64955C97FB, 0x4BC195C5EA657, 0x74C1ADCD037F5, 0x0D99AABC60D3C, 0x03F8199EA479C, 0x7C39A07F91C85, 0x5D07386D41287 },
+    { 0x01E40529DBBFC, 0x26580817F941C, 0x14B66C02AD850, 0x23A8D631814A1, 0x5397EB40A9FE1, 0x54098D768607B, 0x65104A1EC493D, 0x0BFEB5DE7E4E2 },
+    { 0x2A38578E46F21, 0x1E3D8611FCBC0, 0x786ADECD74819, 0x0DE1DE8C32581, 0x58777D3A6BBAC, 0x2639E58654AEC, 0x3FE9E550E1629, 0x2D7BED6500DD4 } },
+  { { 0x734C660278835, 0x3AFBB7BE06872, 0x347E1C12A728A, 0x73EDCA36FFB37, 0x6FEB59926ABB9, 0x44BD214B9482E, 0x232C0B00F9B82, 0x1CA28D59C4958 },
+    { 0x4D63FB302CFE4, 0x3DAFCBED94796, 0x0C40A867D2461, 0x6BEA58AF23E74, 0x60453F7DBDB95, 0x29B1D86AE6B17, 0x4521D227AF5F0, 0x44764BC313097 },
+    { 0x75C685F9ABE77, 0x21D7644F8D2D7, 0x6D90E9462B771, 0x4248E64193870, 0x4E772FA740C1A, 0x25D44A528CAFC, 0x67F0253A46238, 0x6575FACBB1CEC },
+    { 0x2E75B594D0F69, 0x087CAB2C13344, 0x6FE40FFB064DB, 0x1CC6BF1581711, 0x258088E032DB3, 0x0D6879ACC9167, 0x2B34396F9DBBE, 0x550A49664876E },
+    { 0x1BEBA58A0EF20, 0x5E191516581A1, 0x3F7D64C9CBF05, 0x00B54A73E631C, 0x677416AFC99F4, 0x2A87DA415A598, 0x391EE796ECD55, 0x7D52B92804B33 },
+    { 0x7C1BB681F6288, 0x12D20AAF3D1A5, 0x120177107074F, 0x1D792AE875B87, 0x442F7AFC743F9, 0x2BFEDA15E09AB, 0x78CCDDDA427FB, 0x32058E7E06717 } },
+  { { 0x462F3AA5B6B67, 0x076003FF3EDC3, 0x233A6AF5489C0, 0x1BCC8A389CD4E, 0x43AF07364CE21, 0x29D2F39D59C93, 0x10CB9B6FA89BE, 0x4EB6D761C38CE },
+    { 0x410FEB3E4A44A, 0x74005C80A836C, 0x6FA3F14DCBA11, 0x5733065EB5BBA, 0x61233BE445944, 0x4A220CC716B82, 0x476A71923550B, 0x1ADED8E272E4D },
+    { 0x33399A56C902F, 0x05EF076D61A6F, 0x335654BB8548F, 0x320D712E53D8C, 0x6436B7313264A, 0x67325D488A00C, 0x1574E6046E526, 0x3622D16EEABA3 },
+    { 0x7659E7F6D0464, 0x7C80DC8B8AECE, 0x2F820B0588528, 0x3AEABD2520F6D, 0x25AE698267125, 0x26CB07699FBAC, 0x7C428D40845EE, 0x1C947B2274AE0 },
+    { 0x505F2C3BDF629, 0x5375DA7D810A9, 0x2C11CFF6279A7, 0x753D78969D826, 0x024B00A8A8FA0, 0x4E66DD0C9AB66, 0x181BB659A95EF, 0x3F40DEAEE8639 },
+    { 0x38ADE6A5BB2E2, 0x0F015A1A53E0A, 0x11C49786F937F, 0x124676DBE5890, 0x6CE7CEEF17990, 0x26ABDA60D90DA, 0x040F559EFD302, 0x173564EA00A40 } },
+  { { 0x2EF18505B4C54, 0x0B84FEFEC846A, 0x51225F90D0346, 0x3928C13804780, 0x35C8315DC03E6, 0x5291B926DE97C, 0x7659310335D92, 0x4E727F2D6A114 },
+    { 0x0E5CAAE0C91F5, 0x2A2487E7038A0, 0x327ABD103E9DB, 0x147A2745C9586, 0x1BC40872F9B6A, 0x558792DB216B8, 0x491F4055867FD, 0x553828E23C666 },
+    { 0x6280FDDF8B361, 0x27092DEC05FDB, 0x2D121241CB46F, 0x6E299794FD2C8, 0x64CF414DDC084, 0x21F82F27CED2C, 0x18D637852DBD5, 0x74017666C9409 },
+    { 0x456F3F0AC9F30, 0x18CCCADB675FF, 0x6FAAA3B90E5A4, 0x3D9925E6A1E39, 0x218B2BFBD446E, 0x58F7CC39EA25B, 0x408AB9A84085A, 0x74A36934110A5 },
+    { 0x3410711254154, 0x55796C76FBD86, 0x75C1F579E8DAA, 0x5C8E86E5E6E43, 0x0F6209762EA9A, 0x6D3B330999053, 0x0F5C03352912C, 0x7D3159FBF679C },
+    { 0x6F7CD979836E9, 0x123493D02B9ED, 0x44A83FAA20854, 0x0F848D6B7C127, 0x71BAB3B4497D2, 0x1B0692350A4EC, 0x1E52E71706408, 0x2316DEF2DF9B8 } },
+  { { 0x31ECAE35D7689, 0x44416C39872C1, 0x63E4D61BD47E5, 0x29A9E84AABFA7, 0x7307CAA00BF69, 0x07D38FF87331F, 0x70AC8AC9DF431, 0x7FBB1426562E6 },
+    { 0x1C403CD299076, 0x24DE5D41F3B37, 0x794993F0CF6EA, 0x401BFFFA0C026, 0x00D3290D5C155, 0x603DE90C2BFD7, 0x794F1515A279E, 0x1CFF12304F5C5 },
+    { 0x0AE9F1BB05045, 0x3F2F700FAB213, 0x3D975C8E977CB, 0x5B1686541BB6C, 0x0498871BBE99E, 0x6D74AEED7F33F, 0x0FFA6372C1A0E, 0x0F3A526588FCE },
+    { 0x578EB37DAB167, 0x3D40375065C97, 0x14CB24C3B4ACF, 0x2E0921B383A18, 0x3E97A2C6D5858, 0x5AAC98C4674FD, 0x4821BF0B79ED8, 0x76ABDC33F33DB },
+    { 0x339E5CE7E6CBE, 0x2E950C9A63B1E, 0x471A670551268, 0x50EC21302C39B, 0x74ECF29F1257B, 0x702C702D827E4, 0x39F40B876157E, 0x3EE60D7518C06 },
+    { 0x23DC53491F525, 0x1A70D96FF4EAD, 0x1C006D5CCCF65, 0x0CD212F714D01, 0x30B7982B6CF94, 0x2F5619C1D84D1, 0x4B2EA84544D4A, 0x346F4361F3BE8 } },
+  { { 0x5E2407AE29CED, 0x1A44B2C076F05, 0x0BA8F4BF14ED6, 0x1E23E1B546C48, 0x77F7558FF7609, 0x3BF382B959B76, 0x1FF00E885448C, 0x3F3039E1AB4E5 },
+    { 0x61A42B7A2B0E6, 0x070DC71A5F9F2, 0x3CC230176C0B2, 0x777AF01988CE5, 0x236F32967F895, 0x2F4DFC1FDED6C, 0x7D5B3AF62FA6F, 0x0F31D69523370 },
+    { 0x05D28FA1FCD7C, 0x6E1E7DFCCA3A8, 0x1CED1BFA8FB18, 0x71AE3A7EA54E5, 0x3C230053B081D, 0x71B9402AD2776, 0x63F7A391DA884, 0x74758717EDDAD },
+    { 0x55E39F31567DD, 0x5E6487E9A1719, 0x2A617EE0850B8, 0x0FEEE2D89D2E8, 0x491DBE86095CF, 0x505E14687A410, 0x77669E38BD3EA, 0x631B541254B63 },
+    { 0x19704B878F308, 0x0109CEA22F172, 0x04AAE9591FB4D, 0x4DBB0BBB5D4CB, 0x50370F5A3AF71, 0x59E531041F8C6, 0x0A3B3991D4CFE, 0x76E184BDC5371 },
+    { 0x60177F9ADBAE9, 0x1044328224D42, 0x23AE45EB0B2AD, 0x0FBE2CA521FFD, 0x736E863798B1C, 0x2A71BE77FBB91, 0x688CEBF3ADD07, 0x2760FAD684E44 } },
+  { { 0x152B483D1A659, 0x06DDC869A34BB, 0x12D2E33A37142, 0x04D136FB51916, 0x7DF4F5B04DD07, 0x7FEC08467601B, 0x59A2447A1EA1E, 0x55B4056E23B3F },
+    { 0x23FA05B3B7617, 0x6696A6E9BD25C, 0x23EDB4B87220E, 0x5DA98C5958D80, 0x1881716AD1FF8, 0x33AB3BE8DAD2F, 0x4B4F35C91DBAF, 0x6BEC310236A31 },
+    { 0x682D6585FE8EE, 0x21B193530E0BC, 0x147F2CCB06E83, 0x085DB60B27A3F, 0x19D2297508A32, 0x70C3D5C0AD787, 0x388B48A82D958, 0x33995C0799E59 },
+    { 0x0C66F67748965, 0x5F2DFFD1D1EBD, 0x6778402065E29, 0x357D08C6380CF, 0x216FE40930098, 0x1BC91B9C4ABE8, 0x6CC4294752F1A, 0x32C95473EFAAA },
+    { 0x262B8100777CC, 0x3B48AF3B586F6, 0x01A09F0AFEC7D, 0x583CF190C36BE, 0x2B86AB8227102, 0x1F70DA0563608, 0x3DEBF4FDD45B0, 0x7A7AB8F59259F },
+    { 0x7E788AE18F114, 0x111959A00F7F7, 0x09F3EC5584955, 0x1E50144C51AAA, 0x22A631AF75246, 0x1934A488968A1, 0x345AE0F701EA7, 0x2EDE3ADEEDC9B } },
+  { { 0x5234E275D0224, 0x34FBD14CFD12B, 0x4A2BE3A6760C8, 0x5BA1628EEFCD9, 0x7E018DA98ED1E, 0x27AB787120F80, 0x66779FC3A3884, 0x0830F643A2515 },
+    { 0x6141A379980E1, 0x758EAAFED7D97, 0x15EE43D6890C4, 0x5A4098E7448BD, 0x34ADFBC58F863, 0x7DA9E4EAA37B4, 0x4BA38E4B8AAE6, 0x7B97ACEE151E0 },
+    { 0x1C2C8685C6733, 0x339FBB8D5B634, 0x331A5EF10A987, 0x6F0697437ACCB, 0x6DFC88A54C54B, 0x748F3E228B3F1, 0x0D46966C8ADC4, 0x10D1649D0856F },
+    { 0x6E363E2077316, 0x6E667FADAB172, 0x197B877D9D399, 0x66511570CE6CC, 0x19B2377500D4C, 0x52C64632A1A42, 0x40B8F515FAF48, 0x5C51716C51900 },
+    { 0x7926E100C8107, 0x5A6987C59625B, 0x4CD3FC56CADEA, 0x59019735FDEDA, 0x4E0AFB113B3C2, 0x702EAABF3F629, 0x6A491E2321B00, 0x5036832952BE7 },
+    { 0x02028678B5183, 0x06AB023E849E4, 0x113119E402EB4, 0x0A9985F718F5C, 0x1CC6B5922C09F, 0x2C1C756EDB03B, 0x04B067DD03529, 0x2D47A49CF751E } },
+  { { 0x7EB6ABF03F5C1, 0x31354358E8D84, 0x1404A8C4BC932, 0x1090D74F5AE3C, 0x3876511406435, 0x589FCB512E675, 0x356F77E8D3B28, 0x1C398AF5E4E19 },
+    { 0x3F7341EEB4215, 0x6E36F507D5D8F, 0x003ACDCFC4D06, 0x61771EB4BEAD9, 0x5654D338A153A, 0x1F7B7821B1C2C, 0x543165EFF59F3, 0x2D37E2ECCB034 },
+    { 0x645A25FC3BDB1, 0x21E307A1C6676, 0x664B763680D25, 0x63ABEC11A6CB2, 0x5DDAC1EFAA846, 0x3648E67C14371, 0x31B070A55E61D, 0x26559F064EACD },
+    { 0x37CDF7E61CFD5, 0x12568952EA89D, 0x5A34B32E8391F, 0x26C64AD658F1B, 0x5725223C3F963, 0x4D2684E898556, 0x51FB9D2DCA218, 0x2F0D4EBCCDCCF },
+    { 0x529D4F83A6401, 0x2ACF9C8BA6E57, 0x2BFB2031AEA0C, 0x001F29BED80C3, 0x7077A81DD9E4E, 0x64B04A5032DA0, 0x555054A1788A7, 0x0963CBA2F0FAA },
+    { 0x438C4D2122B50, 0x078D003F1AFDF, 0x6EC24739A41E9, 0x1DC9EB182447C, 0x7B333CC7115FD, 0x287017EC31172, 0x499D80DE80141, 0x252B9443BF87D } },
+  { { 0x75595C9CAC64C, 0x190D57F9B8253, 0x2D8B0BC216233, 0x4E112E7C1CBE0, 0x556307B5E26C6, 0x01FBF29B1A800, 0x760916A2E389B, 0x197BC5D77D2DE },
+    { 0x000C8C2259FA0, 0x0824B16F5BC30, 0x3F236F1EBF8AA, 0x111979CC4D9C7, 0x4CC3131CEAD60, 0x259C6791B7108, 0x2F764CC8B9311, 0x4B102FA113E85 },
+    { 0x30B3A458565B7, 0x09DF69B1F97CE, 0x00AC2DDFFEDF9, 0x3AEAFF7881D71, 0x5B3BA3B52225A, 0x68E39824B55CD, 0x78D38FCD80ABD, 0x3D71BC0A8BEE3 },
+    { 0x6219FEF1D0AF0, 0x1DE5CC36DD3FC, 0x3BF1B6909E480, 0x6208FD6864C39, 0x2987CFB454E8B, 0x20C3DEE506357, 0x5AA4C81AB9546, 0x534F7A22A3E2C },
+    { 0x535174DA04ADE, 0x633DB50549FC5, 0x337A7DC44D258, 0x06D68305E5DA7, 0x34E02A9EE90B2, 0x06982E5ADABBA, 0x0E57F6AA71BE9, 0x2A75292A93A0F },
+    { 0x766460BBB43FD, 0x144153C9449A1, 0x5D4D1A721704C, 0x1E240321A25ED, 0x7CAF4F58C91AF, 0x35769FCA388E3, 0x5E0B9779A8DEE, 0x2D3744C347268 } },
+  { { 0x5D6C876E0FB1D, 0x43523F725C941, 0x5E91808CB8262, 0x2E8C9A7D4F8BF, 0x6F7BD053BADC3, 0x357B0C72B2E64, 0x73E8E1F873C28, 0x1B51A4A48643C },
+    { 0x4B51E9032BD70, 0x60BEA51AF1347, 0x168F969004650, 0x3D12A29977B1E, 0x05D1B2038F647, 0x1DDC93B789CFB, 0x242E3B13F977F, 0x2E7AD6BAFAF7B },
+    { 0x5B15D3A32648A, 0x7F9E40F485D46, 0x59AE82224511F, 0x625AEC69688C8, 0x4C783681130B8, 0x5FFD4DD3CCFE2, 0x465B1F1D59EF5, 0x149D5EE7F2166 },
+    { 0x55244ABB58291, 0x0A1D59B4C1735, 0x59CCE4D85ACC0, 0x33DEA7870E0F3, 0x1049FD4EECB88, 0x382D3888CFD07, 0x59A41C4E67659, 0x53A26FB70379C },
+    { 0x5F44399ACCDDC, 0x6C2AB42149F3B, 0x3CC25AFED1E6A, 0x2C4A90DE0B79D, 0x0C7640E28ACA5, 0x722C9476D5613, 0x201217AE7735C, 0x1A0750E47FDB7 },
+    { 0x64129001FBBC5, 0x12CCC998C68D8, 0x60DDCBB34C9DE, 0x05B54D4B54FE9, 0x5237200C08465, 0x3889EA963DE9C, 0x49D8EB7921D60, 0x24DD71F566F89 } },
+  { { 0x2B6FD0F2BBD9B, 0x085E12B3E677B, 0x203063A5F50A8, 0x6A22D6FA313EB, 0x18D5CC467A82D, 0x26766E2E53F67, 0x34AE8767FF568, 0x15236FEAD8E00 },
+    { 0x3C9392A6E8030, 0x517EF43E0D829, 0x4C3F96D097894, 0x6867B18E223D5, 0x09461D49322DB, 0x601B01B639905, 0x2B554EE3DFF9B, 0x53C94A3F08445 },
+    { 0x218350A6F7231, 0x0F1DACF05A6F2, 0x56CE170D1B03E, 0x0CFCFED3D19DB, 0x24078E1292C9D, 0x5186CF8237BB0, 0x72333D31323F1, 0x35F445B51E1AE },
+    { 0x70D5C87E359B5, 0x6910ADF1DCA97, 0x72D54683F97FA, 0x017FAB924003A, 0x3E66910D6C323, 0x1856AB83156AF, 0x275E0BB00B616, 0x718B235CA006D },
+    { 0x7FF7F60531B80, 0x65AA8AC153C7F, 0x1077204CA9A9F, 0x2EA049DD40F2A, 0x2B8E3243AA969, 0x14394298C4A95, 0x1562DE5F3B868, 0x078382A20F33C },
+    { 0x532E3BFE2F6CD, 0x189D5F2A52324, 0x0A60ED9B9BC5B, 0x068C59A9622F9, 0x595B8CD74FD54, 0x343AD52FE3500, 0x5AAF5353B062A, 0x2B22EEA3FE34C } },
+  { { 0x0D1F1619A538A, 0x0CBE9B72802CC, 0x5D8E698D195EB, 0x547D941829551, 0x27AEB0BBEE710, 0x0AF62C28137B1, 0x497D599ED147F, 0x065FDBF188502 },
+    { 0x774A195A446F8, 0x5F1EE79A3EF13, 0x247F30FA461E5, 0x1C1E47429C819, 0x3C5AED735C3D6, 0x13B93224B9709, 0x1FB94FD7F0168, 0x623DF17967976 },
+    { 0x626273713650E, 0x3ECD170DB9D7C, 0x50111C1987E65, 0x4C4253C8B44A1, 0x631B5268D2FCB, 0x1A596A3B8A249, 0x7A9A316591712, 0x3223CD3BCA0EE },
+    { 0x5ED6D7D5D31AF, 0x4117495CC4DB1, 0x1AFF9DFB40CE6, 0x7577559698EC9, 0x2ABF11CC1F688, 0x635A4BF8E6F23, 0x18BA91979F088, 0x77D291840C62B },
+    { 0x3D64546F8F0C2, 0x3A81916613340, 0x2A5D98B5FBF63, 0x5B3E047F665D2, 0x6BC9C63FE1EF3, 0x63409ADDA7610, 0x75C92770C709A, 0x50E0253C90D95 },
+    { 0x5F0C1B719167D, 0x136EFB29E39DE, 0x2B9C97EC8C6B8, 0x26D7686611D03, 0x0E8471A33C4B9, 0x256FB9D32E7CF, 0x189E82CF528BB, 0x27B1C2ECCBB64 } },
+  { { 0x5BE644B3B34B0, 0x3D8E709F9ACAE, 0x4652A481A9945, 0x19A32760B26E0, 0x057D7E3FC3774, 0x465000CABB3BD, 0x52896B54D2CAF, 0x534897D843D3B },
+    { 0x39DA96184C6AD, 0x1BE4EC1232014, 0x667F1036878D8, 0x1DE799BE1E0DE, 0x2F52F3B76B8C7, 0x779FB80764EDE, 0x79C30D34ADE11, 0x60E5B8A789C08 },
+    { 0x090279B7F124F, 0x4FD3A59CA12AA, 0x492239CA6ACE5, 0x7AF3B882D4AF9, 0x599575A3C880A, 0x717B8E16F4F55, 0x1C0A27C3E3B97, 0x5741C55EDDA7A },
+    { 0x41AE893220F0C, 0x2AB17A2568BF4, 0x732193FE48667, 0x2E353A603CE50, 0x0BF9F8DEA2783, 0x5EA262DE4B21F, 0x38147D208A5BF, 0x0720729E89580 },
+    { 0x28F62FB50570F, 0x0484E4650C318, 0x6EC33C0F976C1, 0x3E1BF0CC0A4BD, 0x508812F67FE3B, 0x487EE4C4F132D, 0x234197CAE7019, 0x1C2554C51DDA3 },
+    { 0x122B256DCEBCA, 0x218C2472087BE, 0x274B7590AD020, 0x0E94023954298, 0x175AA6171BAA6, 0x22FE4A69F5EF4, 0x2A07F5D77B7FE, 0x1985035CC35D3 } },
+  { { 0x79236DA335B15, 0x7AE08E41A4F4B, 0x19351E2D9E7A1, 0x59D991EB723FC, 0x1F41DCB4BA2BD, 0x498DE8A4F5370, 0x70B2A742F57BB, 0x4012F67F819D6 },
+    { 0x54A14FAD32D84, 0x6621BE2E71D61, 0x4BB5D5DCC8CEA, 0x58D67B524D0BA, 0x3F4851D46F85E, 0x6B6785897AE71, 0x7E8C643437D42, 0x50F1A307B457F },
+    { 0x31FA6D372620B, 0x29E6792EC1E6C, 0x4111EBF2313BC, 0x3880D8AA3E73C, 0x0BF0090ADF78B, 0x53B5615DF17F7, 0x738C25D1EFFFD, 0x289DF4755AAD6 },
+    { 0x120052D10942F, 0x3558059D0C6EB, 0x02845CA1F404C, 0x61A518634A5EF, 0x514BBD7F4FA36, 0x572F6A7254D9F, 0x4AF4A5AF5369C, 0x681A5290F5B0D },
+    { 0x5BF82593E3D90, 0x6629D41DE1AC1, 0x2D7E05D641664, 0x60272951348B4, 0x29ED0E7EF1B32, 0x14F4720495D20, 0x34DE95CBFBD0B, 0x5E24C37530361 },
+    { 0x743F50171A23E, 0x16995E31A2E29, 0x5525EADD66966, 0x1043CCB1E4E4A, 0x31BDB79950CA6, 0x385562051299F, 0x58A75E39381D9, 0x2274FFBCAC0CF } },
+  { { 0x5F8829E6F7F56, 0x158D9EC663DF6, 0x6001843835033, 0x1B7F43FDD5A6A, 0x0088C1913FF32, 0x67A3A2E98EA07, 0x32869C417C855, 0x3765E782E7E3C },
+    { 0x6493514ACC0E2, 0x509B8A763811D, 0x5F03AFF5143A0, 0x0FF4AB343CF9B, 0x67EF67B7F25D3, 0x5DE4CFD263C5A, 0x45BD3BC697D4D, 0x672847CB28798 },
+    { 0x255FA77572B86, 0x0E319CFCE5FBD, 0x7969E4FD0C9F5, 0x24A6AF328A149, 0x6A9F75747B0A5, 0x0D5710EBFDF2E, 0x1EECE2C8BB442, 0x4ED08D841B867 },
+    { 0x21B3A9EE649BB, 0x17D1853B6A70F, 0x6059C7DEA216B, 0x628E237D20149, 0x79EC1C2DC7814, 0x7C04E343BDDD7, 0x16B2FD0719849, 0x603A35C9F16CB },
+    { 0x08774C2BC75F9, 0x0BD99C79954DF, 0x23A102F1E9B94, 0x742B0E0D084D2, 0x1B05F1CABC680, 0x48040D51F1B66, 0x75B1156DB310D, 0x1D0CDD6473F2F },
+    { 0x7CC5B535ED308, 0x03E7C687FEB6B, 0x713C9F40FD51F, 0x11072EBD7306F, 0x3944A3AE6867F, 0x25F5C13D5E215, 0x26CE27BF29FE1, 0x2FB98FE3D12AA } },
+  { { 0x37C5164F4FDE6, 0x1E27BCBFBA920, 0x47E596A02956C, 0x71F8BDA95B72E, 0x1BB568600DD02, 0x025371DB1B62D, 0x18CE2D38FAD62, 0x7DD6E90D60ADB },
+    { 0x6AB4FD731E4F6, 0x24CE2EC57ED42, 0x4AC0C616BD1FD, 0x0B5A3FA5D6DBB, 0x363973BF50A4F, 0x4A63BC6E5CD90, 0x53B46AB2F3B14, 0x695BEE62DF296 },
+    { 0x28C5710895BAB, 0x2F15A8A95D7B0, 0x6E13919AB098B, 0x4FC2180C16EC8, 0x510979EBBCAC0, 0x51B4A58E16196, 0x70D90B110CD18, 0x664D18DDA4C24 },
+    { 0x32CC31F37C3B4, 0x4D2F84479A3C0, 0x633D94CEB7F51, 0x2ADA23AF7755E, 0x1D1107A685D0B, 0x435F0D1092DA3, 0x3779D74BA0ACE, 0x5225146D62648 },
+    { 0x27C45C147390A, 0x66F38378F0E0B, 0x16433DEB5791F, 0x76E3407D212F2, 0x5E6DF7467342A, 0x21E0BE4B0A4E3, 0x37B8A9CB5EEA7, 0x756648A28CD85 },
+    { 0x144E1F0E0CAD9, 0x0A1BF6651040E, 0x6BCF71BE0CC1C, 0x09FBF5022F494, 0x77463217C1BD5, 0x2157D161C2942, 0x55674B2238CDA, 0x1FC74A4486738 } },
+  { { 0x6E8C7E14450D6, 0x22D5C50DD2562, 0x3466DC4049A34, 0x182D440C42FA6, 0x1D3E2CA69E9FE, 0x4F54EFD440466, 0x68749D785DD04, 0x6CC2D6D67133E },
+    { 0x022B0A086AFC1, 0x5075921A2746E, 0x1898A82659DC5, 0x6F969F0AE42CE, 0x1C4889B7160CB, 0x01DEA81753B5D, 0x52F911CBEC5C2, 0x213A7AF1CBCD9 },
+    { 0x6024056B3C28E, 0x15DDE3F925BA5, 0x603E7D6585D96, 0x089B7A64675C6, 0x4A545651A81EA, 0x5B0141A20514E, 0x790CB5E015300, 0x1C15C0B3D9EC1 },
+    { 0x5FF66AB44334A, 0x3A9FF867B1007, 0x2F0F838A45C84, 0x37D5520FC6BD5, 0x1B9999AD36A20, 0x20244A5B0CB2F, 0x1E3B31FAEE1ED, 0x22DDCA1537DE7 },
+    { 0x1A3119B35D918, 0x5D5179713532B, 0x0790E98E4F37F, 0x311386500A686, 0x4330F42F394FA, 0x6E83CA55BE7D1, 0x1F23F2E65A37E, 0x2F4E483ABDD8F },
+    { 0x584AAF093AA56, 0x172F2FB1427AA, 0x1EB5D9E786F8E, 0x16CFF733D7429, 0x0F539F6288BBC, 0x24B30E2756499, 0x3BD3250D58C43, 0x2837BB8D93D56 } },
+  { { 0x48156523E5921, 0x270EAFA1C00D1, 0x65837E67B50FE, 0x3592888EBA0BE, 0x4EDE3E8948BAF, 0x15D6624E67EC4, 0x302EA0F5B29D0, 0x1729CB46E341A },
+    { 0x7DD3F56AFD658, 0x46B1DA2737F59, 0x60D82896661AB, 0x6C88DCC49A7E9, 0x5E33D2F350B9F, 0x1651C1F3AC265, 0x5AFB03CFF5B3E, 0x629869E81008A },
+    { 0x1A4429FB18DA4, 0x00CFDEC5B331A, 0x34324AD9F28ED, 0x3750EB93484AC, 0x5B5BECCA965A0, 0x56D4A75191253, 0x45196FE784104, 0x7A7AEEF83A677 },
+    { 0x74EA3EBFF027F, 0x04B6771AC598A, 0x7CE6B20AC7F1E, 0x41639B10EB188, 0x6C10CBE64C3F2, 0x502565235622E, 0x29A9A4025AC81, 0x7FE6B147BCB1E },
+    { 0x03F70F3B94277, 0x1C8A3E0D15B2A, 0x7407574B95691, 0x6A2D90DA41B38, 0x13A045593EEC2, 0x0FED46CF3BFF0, 0x534E7FD00DDDE, 0x50E25554FE08E },
+    { 0x465DD1311552F, 0x0DCC398E65217, 0x1564E3BFCB132, 0x1D95A42971741, 0x6625EFD42F08F, 0x1DA25F1217805, 0x39FCB32AA9DD6, 0x2154505BB6ED0 } },
+  { { 0x3F222E993F26E, 0x641F12C98D990, 0x0943B7EB69AC4, 0x734E8E9BAA97A, 0x1BDFF74CEB75C, 0x023B5729AD206, 0x2FDDC26A95464, 0x3CA5B5AE1576A },
+    { 0x61766F9806170, 0x39B6BAA40D8E3, 0x06FBFAE9B138F, 0x6B922825B5F6E, 0x599239E6D1F75, 0x785A24D884574, 0x4C4AE39F8D9D6, 0x782F552E1AB2B },
+    { 0x36D72A010B3AB, 0x17D56CB9225AD, 0x029B2D3C65007, 0x75BC1016B9865, 0x3163BCD9FC953, 0x10FC152231E82, 0x63AEFC439246A, 0x0F027521E0A73 },
+    { 0x46DC652DE4A8A, 0x24D9CBFA1E316, 0x5429656060B13, 0x503216CCCF117, 0x5D8318F8774C0, 0x010EB6119A07B, 0x6E2D0575731F4, 0x74429EE598D3E },
+    { 0x4E7C84614E3A7, 0x7F3AAF0932DF0, 0x5D773E2D9C154, 0x477F528024BB7, 0x3D0DB1F25CF3E, 0x5243F1181A479, 0x4045ED842E465, 0x6C22AF2A112C0 },
+    { 0x329E275FCA14A, 0x183C555EB1527, 0x1B317DBCBD76E, 0x1B6AC7F128F11, 0x49E2ADB25629A, 0x24A4D817490F0, 0x6F8616B38C692, 0x2E8296CF9AAB2 } },
+  { { 0x409042BB297AC, 0x45C097D99B82A, 0x5C590220B70E1, 0x6F133FA66CE55, 0x287B53A331A4C, 0x56D4E6A159A3F, 0x1E8176C478595, 0x680A14848BA33 },
+    { 0x1A443ADEEA08E, 0x37F1BE932F6EC, 0x510DD7BECE5CF, 0x4E62171D29688, 0x5D1BEEF01E3D9, 0x4FE6DA481301B, 0x42D96346EA500, 0x3DB2D235154F2 },
+    { 0x67DFC8FD7ADBB, 0x645B412C959CD, 0x54959A331D7D2, 0x0AE94C8E2DDB8, 0x12A80642018C2, 0x6D611F372053B, 0x20C756AF9D270, 0x11879BE7FDEF6 },
+    { 0x3356CAE512820, 0x65DA05FDBAD52, 0x0536723483DA8, 0x57A403BE67512, 0x383045615150F, 0x13FC0F2AF9BE0, 0x32252BD7877EB, 0x626B218C24E74 },
+    { 0x6688BD6A330BD, 0x3DCB12198E4CC, 0x656B605CEFAF6, 0x6B4705FEA8E01, 0x13E7C36C5371D, 0x57537D4F3257F, 0x5175CB0EE4B95, 0x5E08C1CC1476B },
+    { 0x09FAD7ED75868, 0x224235EBA24F7, 0x0C66689F9C99B, 0x1036D4F535432, 0x47A5B5E7B03F5, 0x2272075527DE9, 0x7314D78E88783, 0x357BDA23EAC9B } },
+  { { 0x025BDBC2526FF, 0x32430F097DB8C, 0x060EE452736E8, 0x74A5194468425, 0x4EAD50D81AA4B, 0x4BBEEF10098B5, 0x247CCA3A78406, 0x12190AC69AF75 },
+    { 0x3DFEEB330F5E4, 0x3DD253F098893, 0x01385C9C7755F, 0x0866B6DFB9B9B, 0x6FA8705872E27, 0x3666CFB61FBD6, 0x5043F295969F7, 0x64128FD9EB8E3 },
+    { 0x79348A8F33A00, 0x7B360AD790857, 0x5157A1ED5A5F7, 0x24F8AAB088B20, 0x0B6CC4B63AAF9, 0x5907813720F56, 0x77B29A4BBC62F, 0x360B866ECB510 },
+    { 0x3AB2A13E4B4FD, 0x717685D1876FC, 0x6441689AE4359, 0x6EE6CEF8AF834, 0x7A2C8F163A3A4, 0x681EAAA1986E9, 0x183C8781435C2, 0x18F89F5460000 },
+    { 0x2A84FD448C3D9, 0x50869D9179EDA, 0x3B38E219F5BC4, 0x6E35E27C6695E, 0x6FF9C0748A61E, 0x7F00E59346ADD, 0x44470D08F03C7, 0x7353D1473FEFF },
+    { 0x61F47B670CADA, 0x0787773423AA0, 0x5284FC40FC30F, 0x185634AAA62B7, 0x41638C4004C11, 0x2405089507322, 0x0B393A4EEE251, 0x21662B866478D } },
+  { { 0x071EC91601660, 0x5C132C5CB2384, 0x76C80211521C4, 0x27422E9BDFF22, 0x3CEAE94D05FAE, 0x40CED3E7B5FBD, 0x499572FFE3BAA, 0x391048F1F6C67 },
+    { 0x642905DC70329, 0x29BA6A38DC356, 0x15416AA56D13D, 0x2EB3B0368B82C, 0x0CA3CA3318359, 0x3CA67D9115C58, 0x0F01DE26258F2, 0x797973D6CA218 },
+    { 0x6A1E0462E1A21, 0x609E4F03A4123, 0x2ABD197F04C17, 0x2CE52731042DD, 0x36204FF11C551, 0x08BC7835A58AC, 0x61258BC47D1B6, 0x4394579A0162E },
+    { 0x670652ED90CFB, 0x0861CCB129D38, 0x3553A48C59C2C, 0x7255AA56059A3, 0x07D1A27DD6686, 0x3C44EBB9EE7FC, 0x2A34CE94E5CB8, 0x47531FD8AF516 },
+    { 0x3E22D4EB7809D, 0x6F018BDC0A942, 0x0778C721F3CF4, 0x7E8D5CFCE46B2, 0x5E89ED76FF5FC, 0x21EF11E7E8746, 0x2457591BA8E0E, 0x5FB7D1DAD607F },
+    { 0x438E4830BF71E, 0x0F17DA350BE1A, 0x100C6F9539054, 0x1A0DC6A5DE0C4, 0x371A2802D7B49, 0x1EEF5028EE819, 0x07C1EC06D93A3, 0x238E07C6E2D57 } },
+  { { 0x5A70139F5166B, 0x498C4B580F2C8, 0x50BB35A1C9E4A, 0x4A59A334129DD, 0x7B03131DD5E83, 0x1A772A5C0415F, 0x17EC13ACCFFA2, 0x73DA08F933BBE },
+    { 0x690545483D99D, 0x1EB54F6ED6B43, 0x77B847F54F4E3, 0x401699CFCA341, 0x5C69C7A5B7EB5, 0x26F48481ED5F8, 0x489FFEE2DFD73, 0x143DB31D7D2EE },
+    { 0x627618359D453, 0x531C949E1A691, 0x50B9883E5DBF9, 0x59FFD5BD1392E, 0x3CAE7977ADE18, 0x2EED1E8741860, 0x079B6738F8CA5, 0x451EF8190A5E0 },
+    { 0x42851661081E4, 0x366B13E4CDF52, 0x70986B647897C, 0x1CBAF593C7545, 0x1BC8E3D87595A, 0x6875CFEEAC686, 0x41B14AABDB0FA, 0x7645AA4DF176B },
+    { 0x63C69C92BFD2A, 0x0BDF4B3BF9451, 0x20DF5AFAA5567, 0x16DA039C83E23, 0x348A8FE1ADFEC, 0x4699E6CC1E896, 0x0C3F41A991C9D, 0x1D4CADBCCB9C8 },
+    { 0x2C413B892492C, 0x23F2A1C5DBFBE, 0x1E0A55B42C17F, 0x127249D483B16, 0x526C91F4A9C7C, 0x26AFEF578E0F0, 0x27EC1864466BD, 0x2AA9A845CAFC0 } },
+  { { 0x65859C07CFAB0, 0x504D89C2A9B43, 0x65021C8A00D35, 0x3D18D75F18FEB, 0x2F1A209C8B14A, 0x7617AB49799B2, 0x4BC83FDDAC30D, 0x66635454BCDAC },
+    { 0x0504C1E83D289, 0x305A352B37F76, 0x0EBDC1391F90A, 0x36F52F3D9A02F, 0x1DD33FDF7A7C5, 0x759C3E8D97B5E, 0x36391D035A094, 0x629528629D0E1 },
+    { 0x155870D79134C, 0x26276303030BD, 0x61DCD5ECB42D5, 0x63DB7209E857C, 0x6663177B57FC3, 0x31F0C798E4E41, 0x2B2EA669A7F70, 0x2705A4F14A651 },
+    { 0x00CAC18A11A1E, 0x1454D0C67768D, 0x14E8CDA136E3F, 0x419215FD2096A, 0x3E21E950794CD, 0x1796560ADE124, 0x3A7E76CD2B705, 0x6BB678F4BEE6A },
+    { 0x6260907264941, 0x0D9337E889EF0, 0x03DFC964E17E1, 0x2DFC027B2C53C, 0x358E68928BD22, 0x151A697F3AF7C, 0x01FBCE2087FD9, 0x4207FD798CF8D },
+    { 0x5E44237AC6F45, 0x1778C1579B297, 0x63CCF66FAFB97, 0x1620955CECF0A, 0x0CDD744347590, 0x18B55FD6E3F17, 0x20A9CDB669C2A, 0x2788FA8E3E758 } },
+  { { 0x3EB389B59A3B9, 0x41AEC540E49DE, 0x1C9E215D8EF63, 0x6FB265BCA5C22, 0x6AD9588AE2CB7, 0x703607368268A, 0x79133442AD4E5, 0x19F8CBFAF98B5 },
+    { 0x1BF5266C8F73F, 0x67502E7797AAB, 0x13835FDDDB626, 0x17520C929DE81, 0x1DE40CB209413, 0x4AF16D745BB5B, 0x109C6DB696731, 0x6E72A64F2BC2A },
+    { 0x4C6979D33B003, 0x48F14E6A52A10, 0x4D4DE00DD93AA, 0x0941D4DF982DC, 0x06FE9380210A1, 0x32FD665B5F1DC, 0x53EFCBF803BBA, 0x0FE46BA5873DD },
+    { 0x646572BE722BB, 0x7533ED5E34D33, 0x475669C5E6C40, 0x7749FD9E08E38, 0x0D91865F36A55, 0x39A6421748171, 0x6F5BDD8F5B95B, 0x1DA9FD0B59D32 },
+    { 0x5A5788FEA09FB, 0x46D858C83C1D6, 0x3F02FA9A5E715, 0x186A08E270890, 0x35C581A693A95, 0x6DCCDB15959E9, 0x1AF8415BC2FD2, 0x216BB92FD56B5 },
+    { 0x335417998961E, 0x17315F03882B1, 0x39F9CE41B8460, 0x1FEADB1F7C25F, 0x66639A9B83489, 0x1F8CA05AC2EF8, 0x68897B58F88F3, 0x2AB3E602BB6AA } },
+  { { 0x3FA63A252BCAD, 0x6ABA1BD0A0D8C, 0x607B8B6A787AA, 0x4A62F651E5F71, 0x3C9B13C4E391F, 0x3DB4B2381681C, 0x45017971883D2, 0x34C196ADD6BAB },
+    { 0x642911AF56C8A, 0x53ADABD3D52F5, 0x1BC00F0C5D29C, 0x2240BA0B96D5D, 0x2579EA0D86585, 0x051A1BC546402, 0x1B081F944A326, 0x11F1ECC174602 },
+    { 0x21108C75C746E, 0x15BE9A71B5A01, 0x34EFE16607496, 0x5DF86F9C03DDC, 0x30C2D09CE5617, 0x213D65FF05FC3, 0x2B3A6E594FCF2, 0x7D94D82154294 },
+    { 0x59807E0096A74, 0x4AB0D680FF53D, 0x51B0E196B02DF, 0x7DFF048143D60, 0x1321D05A8C3FC, 0x7FACB131A9CEA, 0x3818F26CBB9B5, 0x15B4484FC6E9B },
+    { 0x3EEE9D36D6BC8, 0x69857D2AED73D, 0x27684A30C6DC3, 0x76AB69F854BC9, 0x2730A4CFDB8D0, 0x48E66A3681C99, 0x176C4C95AAC39, 0x6BCC012DA9218 },
+    { 0x52708E682DC8D, 0x20A6A128ECB54, 0x32364344B0AD6, 0x14256ECB158FA, 0x2E8F3B561C70B, 0x20EBB75EC67AC, 0x48ECE6BF49F1F, 0x19C581CB027E7 } },
+  { { 0x4778DCB8EC138, 0x4C0FD79FDCDC3, 0x23536B0385806, 0x7036E7A01B2C4, 0x2EDC859EC669C, 0x05E3A833A0CEC, 0x1237F9A305F96, 0x60F5DA94BFC35 },
+    { 0x2E301DA7C3B79, 0x5D6BB8B6787E4, 0x1BD9931FD499D, 0x1907E467BDABF, 0x40E961993A10A, 0x33A59664907B6, 0x11EDC44C289CF, 0x2471CA9E86EAE },
+    { 0x3E2AD1AEA0D03, 0x1C0D308304DE9, 0x4FE4CB18C4A7B, 0x01C1440AF06EB, 0x1EB5891FED8AD, 0x2037ADCC29654, 0x77BE19BFBA40C, 0x474F4E4C08201 },
+    { 0x0C42FF16D138B, 0x71E91CC350B36, 0x1C20F695F7619, 0x65D5DB1F5652E, 0x7331F5E402EA8, 0x36D8D4A0E4DDA, 0x38C8534F3849E, 0x15AB3EB92E82F },
+    { 0x130B7ED2CE9CA, 0x347442BFF097E, 0x058FE8472DD91, 0x335AA7462E1F9, 0x505B8F91162AD, 0x68A71C408AD54, 0x75DB425F249E9, 0x5A0AF662DA6BF },
+    { 0x7BF8BC862F25D, 0x1C11224647646, 0x5D05A6FE1DDDB, 0x1361241C75784, 0x0753D5A3A6E92, 0x1E589C2128AF3, 0x5E74381D4B2E0, 0x18631557C3C96 } },
+  { { 0x556FA058617E1, 0x47A1725EE74CD, 0x4F1F18BAA1CD6, 0x0C727D4C45F86, 0x6430638F619E3, 0x72F4128597D51, 0x000244F76522A, 0x70BF3E1C3CB45 },
+    { 0x01B3B0AEE27E1, 0x26F9C125475B2, 0x6B670EB62A7FE, 0x248DC8DC6BCF3, 0x623EBE305AC2E, 0x2A3AD6540E0C5, 0x47E6829D17658, 0x662787672DD38 },
+    { 0x31BDB18A2157C, 0x61928BE4F4363, 0x324A575947757, 0x27B57A5D14391, 0x0322FEBB3B732, 0x422EF31FA5900, 0x63A648F15470C, 0x6A0212565D876 },
+    { 0x6C6848EA24E0C, 0x6CCCDE9F1BAD1, 0x5949EEE3A1673, 0x636CF2BDF6BF3, 0x209CC171FDE06, 0x1403DFDB1BD14, 0x253D09CB0AE7B, 0x33C9AA7D9D5AF },
+    { 0x421FF0D323853, 0x5C05521A9E6F7, 0x4F6CBE36ED54D, 0x269A426A0B34C, 0x182947783B41C, 0x55164E8FB6DE3, 0x35D6CA2BFF4D0, 0x546B71B8E3CA9 },
+    { 0x57D1B24D23FD9, 0x154CFB0C1957C, 0x62F68324176E5, 0x166AEB5189CE5, 0x4087707ECD3A4, 0x1877140112A93, 0x46D644B5D12E2, 0x178D348D9F28F } },
+  { { 0x0079063735AEB, 0x7930FFBC06C4E, 0x4D745740A7242, 0x6DA9662AE90E6, 0x6DCCEF4B6914D, 0x2E1DC566217ED, 0x74AAC89B80950, 0x610A1A70CE648 },
+    { 0x14F60FCEF66C3, 0x08DDAF8DADB49, 0x017EEFC488744, 0x28C04DB8C4DB3, 0x5E848CB9DDE71, 0x606210A4D0C67, 0x18394A53D09F4, 0x2386DCF6D59D6 },
+    { 0x15D22E356C248, 0x5A8400C67F8B9, 0x76301E88042BC, 0x3E4BADECD50D4, 0x3695FA914A813, 0x439E486B6136F, 0x3B659749F3B75, 0x334485C44C92A },
+    { 0x3E9F8944D3213, 0x5048933824E8E, 0x37BE323E26DB6, 0x2D8E91333B752, 0x210E433CDE76F, 0x407937954D150, 0x3D1E681F0F33B, 0x14A37992DE2AD },
+    { 0x684F9C5DF300A, 0x56C55F58872E1, 0x3E5A314F8A2FF, 0x04E8EE4618F8D, 0x655198C8900EE, 0x03AF1C47F0D86, 0x402D72E63BB59, 0x27A4CB26F4393 },
+    { 0x3165F1EBF7889, 0x1E096F8510783, 0x1BC4AE6174B31, 0x09C1CF4D7D57B, 0x015C33BA1120D, 0x1E68117B632BE, 0x11185F2EAAEA2, 0x2E1049A8E249B } },
+  { { 0x70DCC58D6CFCD, 0x29CA01DECD633, 0x2F335FAB0258B, 0x0FD3E73017CEF, 0x584D71783EF57, 0x3E5CA7FA598FC, 0x498520B38B17D, 0x71522F656066D },
+    { 0x1ED476917E2FF, 0x266B21B9BA956, 0x619882B05D916, 0x7918148716CE6, 0x002016FE2952B, 0x45C70B1F3E31E, 0x67451CA4DB2BE, 0x159A4D9494C75 },
+    { 0x3F44D22A96D4F, 0x159A421E72965, 0x507DBFD865255, 0x0A29C410C7B09, 0x018B1447AF2E5, 0x52D38CF5D8BBD, 0x114CA73D343ED, 0x48B361351EA35 },
+    { 0x70062295F537C, 0x2334D32042CDC, 0x2E563686141B5, 0x369C268A042C7, 0x164ECBE921CB8, 0x1A70FC1799CC5, 0x0A8B292FC6B61, 0x1AFD1754FD52D },
+    { 0x117F849F0AB68, 0x3A8B21FCFF9F5, 0x5A9FE3074A7FC, 0x34B740D9AF79B, 0x127F6E3FD0E32, 0x17102B1F28CA7, 0x02AAD7F839D16, 0x04C0D04542EB7 },
+    { 0x56125409B7378, 0x1154D9E72EAF4, 0x597FA53DEEB5E, 0x0B6CB04D44069, 0x345B2F92E0920, 0x2F3F9A3A2956E, 0x7D076F114FE48, 0x2A7114645A4BA } },
+  { { 0x4FEFB048A7320, 0x1D10B6252C8E2, 0x26D9F43186B62, 0x489FF63D765BD, 0x2FFF32B8AF038, 0x16728A4EADB45, 0x6A53A66F77C3C, 0x010184DD620A4 },
+    { 0x4B3C3EF046760, 0x610968F190568, 0x3613A9349324E, 0x2E6E61B06112D, 0x4CD60EB9382F6, 0x17A136BFAF9C7, 0x32100009B4A39, 0x4CA34D4C59794 },
+    { 0x77D494D5BD176, 0x7E20C304A180A, 0x510128BDB8813, 0x74D0B490313F1, 0x5CF63309474E5, 0x24BD026C455CC, 0x6386C58F469BC, 0x1C4A99472CEE4 },
+    { 0x3DCD1E45BFA1F, 0x1EB1E71D8AB60, 0x0BAF5FCFBFFF1, 0x0D9E127A65371, 0x20CB605286D7B, 0x16951551130DF, 0x76558437F33E7, 0x75917037039C5 },
+    { 0x120A716B4FCCC, 0x1218B36396BCE, 0x13096027A04FA, 0x28169235C73E3, 0x334A18D0EAA3B, 0x0C0D0B0EF2DD9, 0x5B7C08DB097F7, 0x087487FA3AAEA },
+    { 0x0044DFE035334, 0x133074E28D614, 0x2AF21F7BC071E, 0x1558A8676B461, 0x3E64F972C4640, 0x18E52C4230D7D, 0x5660D6ABF0CC6, 0x19753852C36CD } },
+  { { 0x5904A4926CF6D, 0x53A9E7014752C, 0x6749CBEB17E91, 0x76751C1C31600, 0x313E2A61B9BA3, 0x1BF8150BE49BE, 0x4715C5BB7E383, 0x652320920CB76 },
+    { 0x46889CEF95C89, 0x10A4D7260B10B, 0x5CDD16D5D0713, 0x0D7963EA30BBC, 0x716DD5E9FB324, 0x08F950100083F, 0x6F540C9F379F2, 0x3A8446DF4F09B },
+    { 0x61A089E922D90, 0x5C5A2F1F23532, 0x31E5936775A28, 0x31EBDD0D0B269, 0x06CBEEBFAD2E7, 0x1DD5734933C9E, 0x2F8056FED391C, 0x101D3769C638C },
+    { 0x664CCA61C1B3D, 0x209D39DCE1754, 0x011B19637952B, 0x707CBAE8C161C, 0x0BBDECFE297AE, 0x3D0369FB6331F, 0x198428C1890DC, 0x3B2C22D60670B },
+    { 0x71218836B0056, 0x23AEA4161BDDA, 0x4C22F89A8BDE7, 0x58BD564B3A50D, 0x2BE46417E98E7, 0x64D123B264EDC, 0x4541ADF8A8055, 0x6634DB3751ABD },
+    { 0x4CFCD68DFF759, 0x0FC381E64D363, 0x48937CAB9BEDD, 0x07329254D037B, 0x0CC2FBCD25A92, 0x349EBE4CB7501, 0x5039E4F01B101, 0x2EB091E07376D } },
+  { { 0x76F0029037FC0, 0x3262C69DC7A61, 0x23E64FD8B5509, 0x4284C7CAD9A37, 0x3E93D06753C0C, 0x57A31233FF108, 0x30CDC741E1E9B, 0x6CD93A3C7673A },
+    { 0x784657BD17F0A, 0x1282C9B37E43A, 0x232A19E649D77, 0x08395126D830D, 0x29B86FDF65566, 0x5A412706EA846, 0x5ED2DD33C0B27, 0x6209686F81E5A },
+    { 0x65AB531E3CF99, 0x62AEB436A0869, 0x4E45AF077E50D, 0x3F509120F2044, 0x45FAADBCC0AA0, 0x2072CC51AA273, 0x11BA957B75D30, 0x32B9E59D6741D },
+    { 0x05D897EAE4888, 0x4A1A30FD5F69B, 0x2CED776C197BB, 0x606DD7568C924, 0x15A7FEAC7DCBA, 0x47E26EFBCE50C, 0x1944678E9D7EF, 0x2FF249E8E1E62 },
+    { 0x395F63B9E1315, 0x19DB8C1F220E5, 0x04DAA15B86133, 0x4F084B0C1C240, 0x1FAD585B4729C, 0x7422F143D10EC, 0x4950874E0CCBE, 0x4974B586018CF },
+    { 0x348C8E1B06181, 0x084AFAC4B18D5, 0x6AF0CCF774A18, 0x095C6CB5D164F, 0x213FAB1BB3FBE, 0x27A25DF35607B, 0x57B4F6474E837, 0x20D8C0E4FF884 } },
+  { { 0x4D5794614D39A, 0x6DEFF68C9F541, 0x06430F8660D3E, 0x40F7DA90FE6D1, 0x66F33A6E806A6, 0x7088A52DA1BE9, 0x104C21021E40A, 0x1EFF308907D35 },
+    { 0x63B1D60F12AA5, 0x2F99F62B9573F, 0x44E4AC815C5C1, 0x7255B5C751379, 0x7DDFDAEE156A4, 0x1C57F84293744, 0x19319B80CAEE4, 0x151313CDB259F },
+    { 0x36E065CF86CD0, 0x4127CEF3A0BC5, 0x118406DB2AD94, 0x20540B2B65EB3, 0x0D73601847584, 0x518D3620971E8, 0x3BE0DEE51FBC6, 0x2EF839F02F1F4 },
+    { 0x50370A23BE138, 0x41B9453A10D5E, 0x07A729D969C95, 0x5F1C733A56941, 0x31618E8483844, 0x0913A3C7D6361, 0x6D1E47C06C837, 0x5EC20C85FA3EB },
+    { 0x4416FD86FACF5, 0x31D339F777447, 0x03A582008670D, 0x771797D862E4E, 0x6604E311C54E9, 0x470360872B61B, 0x0EA8341B5DAF9, 0x5B7B912262B74 },
+    { 0x511C06F1C0D55, 0x1B02AB254190E, 0x1984F8B9BB922, 0x0BEE59CB543A4, 0x5C5A74441D977, 0x2559A54010F85, 0x3F96565D6C23A, 0x1EF67C623AB5A } },
+  { { 0x2E30E7BE75A57, 0x1BC1307835089, 0x4A3668190272F, 0x5848E4426840B, 0x715B8AC3628FB, 0x559525ABEE3E2, 0x6A9704D2C6AED, 0x535FD357DA2E0 },
+    { 0x19DE1A4167727, 0x2AE29A38D498B, 0x689804758219B, 0x0C5B5302A6DBB, 0x548DC47E3CDB7, 0x6E954B91EE02E, 0x2787235386E8B, 0x11E3E38684FAA },
+    { 0x2743D2797D48D, 0x771172A6A7DD2, 0x00660784E9D8D, 0x26D2CD322863E, 0x0E0B8BF2F44A1, 0x1F04CA4906A8A, 0x6E437CD90590D, 0x021670B5ADC47 },
+    { 0x6027D9815481B, 0x0A080B7EB18D9, 0x794F5E7CE901C, 0x06C76BCACA7C3, 0x1F64470D5F822, 0x003102308A996, 0x30DFD2226DCE3, 0x5AE4988687E05 },
+    { 0x12BEFFA1EDB3E, 0x104290CB77B55, 0x70D7123490E88, 0x28700C3DB4961, 0x4902C1E216E1F, 0x293D05692B692, 0x1FF4E1F91BAA3, 0x486CEA70CBBE7 },
+    { 0x58E93D2AD83DD, 0x07F81E8180545, 0x6195BCAB68789, 0x0A01BD0120AF8, 0x749EA23B9D610, 0x2E2996DBF4DF9, 0x70B42C4BEB2A1, 0x2DA33623B0639 } },
+  { { 0x56F451DD3D1A5, 0x18820B8D0B0A3, 0x14B455F2B06F4, 0x78A8C958A5F6F, 0x4F8F9B7D422CF, 0x7F7385E1965CB, 0x34FF40E6F02D4, 0x3F4CB51E48F97 },
+    { 0x2F3B7013FE1CC, 0x2A3310B1D9D9F, 0x7F12E6DEFFD5D, 0x0F28457FF7F3D, 0x54835B0A63B28, 0x33BA5B53CC8DF, 0x6EEF240824E33, 0x44A5B2B365133 },
+    { 0x72BEBFA209EA7, 0x6FADB399D89E7, 0x1252FA9087DB0, 0x39BCCED6A62DE, 0x268778180079B, 0x0E9DA78DEB34B, 0x4146BB8456A47, 0x40921600F4830 },
+    { 0x7634385478BA1, 0x30A3320BCAF5B, 0x36FB5ADAF9AFA, 0x3A971C1298F25, 0x113BB28D45222, 0x37BFFF0A67304, 0x3420E56679B5F, 0x495BC99FBCE27 },
+    { 0x4D71E356633A6, 0x67DD9604FAAD1, 0x632AF7E38A0E8, 0x3E33D7650CC9A, 0x7FC141623219F, 0x2FECC768993A2, 0x3D7D89DB23427, 0x69F13FA6202A7 },
+    { 0x4C0186642EC52, 0x0323133AE8A6A, 0x07B02F7230EC9, 0x1541CAC113B1D, 0x0BA2692C2C2BF, 0x26520796915A2, 0x300D45A3B8CEE, 0x36005462FF8E8 } },
+  { { 0x0A3E4E2649312, 0x1A428CEA1CA09, 0x7A5983B66F903, 0x39EDD6D1D7605, 0x3F19D38E60EFA, 0x0FC29296673D9, 0x34225E948046F, 0x48A5B3B355738 },
+    { 0x54DBD4B557C6A, 0x02ED999719ADB, 0x5CB73C6263872, 0x33454BFFB36F4, 0x4564A954A3EC5, 0x6237C954BE469, 0x0A23B08C70620, 0x241BDCA2CD1AD },
+    { 0x3A91B643E1D46, 0x125623F69AEBD, 0x3B9A103A761B6, 0x124274020ABB1, 0x47B019F816811, 0x472BE2D70F066, 0x56AC1487F4977, 0x5C9E7523B4D0A },
+    { 0x5251DA71D3F45, 0x0DEDEB81E6091, 0x2C5C92D83EF15, 0x1F314975AF686, 0x37D69194396B5, 0x336B036FD704E, 0x6DAC1E90459A8, 0x6701BDEEBC391 },
+    { 0x0F6A282EEAC2D, 0x44C2E6A17F335, 0x2E3453055C2E7, 0x4FBE3CD416790, 0x54287AA3B8479, 0x287DD43907DDD, 0x3E59236EDE27E, 0x4711655121571 },
+    { 0x21B46F66D75C7, 0x188E8A903785D, 0x651552CA06FC3, 0x07CE1E647E80F, 0x3AEFFAD87A811, 0x2B0A11C513AF2, 0x589114A25E553, 0x2DBF36C6AF76C } },
+  { { 0x09B3AD7E21861, 0x2931FE4F387BB, 0x72ABFC526F443, 0x7329C774FE62D, 0x2620F1B5D8D69, 0x3F57864DB6F06, 0x75192BEF1D661, 0x1FB2428F7BE82 },
+    { 0x7BC908327E427, 0x69DC046C3175F, 0x39B55089EDA40, 0x7F9242DF1F6B4, 0x1F3E5D08A129D, 0x127BA8CDDD903, 0x244D20DA9CBA5, 0x3DF0653F6BE70 },
+    { 0x5147CDACA7EDA, 0x71F18D69E820F, 0x3DA387F6A4341, 0x64CE950244323, 0x7988AD8731E51, 0x5ADD489C6DBCB, 0x28462044A1869, 0x628B72ED9D71E },
+    { 0x25BBD3AF66C70, 0x77E9359F69276, 0x30DE00B697D00, 0x3F99859FD5AB2, 0x267D143A97B35, 0x532E3BD6CD6E9, 0x7AA37EE08809B, 0x4D74F639A4101 },
+    { 0x2104825854ADA, 0x300571B38CC7A, 0x1B941FAD0EFC4, 0x6D64F1F47C1F9, 0x0DDE0C3388E12, 0x0B24AC24F5E4C, 0x5E31067767AAF, 0x138AABD86996B },
+    { 0x55AAC6E1BAEBB, 0x070015FB5E0CB, 0x0261F04A57EBD, 0x18BE86032F82A, 0x6C71B96D5A6A5, 0x2C76D2CC133A6, 0x612ECF300B235, 0x1B891573E0DAE } },
+  { { 0x7486BEFA587F4, 0x3CF47D4175313, 0x54FB9660EF57B, 0x57DC6D52A838F, 0x3DD8E0D8BF162, 0x435318AD5E20D, 0x4C3364FB2BA0D, 0x22BDBB0E2CEF9 },
+    { 0x417C4BCE5273C, 0x784F2EFB51CFE, 0x31E6EDB13BF41, 0x773F49FFD35A9, 0x49ABB65E7C878, 0x0AF5B45B03860, 0x4302687D26591, 0x27F1E55B0D36E },
+    { 0x44893FA4DD141, 0x06A4DE053AEA9, 0x293B7F502A76C, 0x66055A0E6E51D, 0x2BE278B6D7800, 0x3A7796A3CCFD6, 0x5FE7341685353, 0x1E1A90E98AA5A },
+    { 0x6F50960E12693, 0x1143FF83E3B28, 0x0BC9FFCDCCAF7, 0x0257659D49CF9, 0x466FEF3F399F1, 0x34FE1F30F1BDB, 0x3284F3992D155, 0x1C90FB2A1011E },
+    { 0x5B373755DBA4F, 0x6656DF0AC6484, 0x55E97E1BE0EAA, 0x4051E9BA5EC92, 0x470D9BA5E2EDD, 0x16B2D8E1147A7, 0x658D83739CA2E, 0x0B06A565B3DE7 },
+    { 0x7FBF9BE4E1175, 0x190C36C0D4E34, 0x5941CA6BB637A, 0x145C3491F1914, 0x1C8A0D9E4D3E5, 0x1E56AB6C14D00, 0x00801DD55A66C, 0x1A10F6E7A5419 } },
+  { { 0x02690AF254502, 0x7C40515FB7EB9, 0x06E16FE763B85, 0x2B379B78FCD74, 0x4AD45D25E54C2, 0x7368C8DAF358B, 0x721DD3C2E65A9, 0x3C0D549FAF920 },
+    { 0x243C3D75B377E, 0x4F406ADD46197, 0x1E1C8B9B66CB9, 0x56991C0916426, 0x09E4E48EFEDD3, 0x5D0243CAB2278, 0x25DAC1A7EFF99, 0x6FABEDE434037 },
+    { 0x10D1ED5851035, 0x448259070EC59, 0x36CDBE1A0033D, 0x122AA48EF5B2A, 0x1521552B66B5A, 0x707DEBF7CE3C4, 0x041C90E8EFC7C, 0x5A5AD67C06685 },
+    { 0x3EEEDDECE9922, 0x33F4256CED2CB, 0x058F0738DED3C, 0x5C6A7F23794C1, 0x5DA181473E317, 0x48265C5BE3DB1, 0x4933198C921F0, 0x122723725C7B9 },
+    { 0x039BF2C7E12DC, 0x36F86648BFEBB, 0x453F6C29879A4, 0x12C6BAE03BE86, 0x7101DFCA8EE4F, 0x041FC42D20103, 0x145B7EB7232F5, 0x505F6439C72A9 },
+    { 0x173EAE8B7156B, 0x077C24DAB0AF3, 0x16952091BB997, 0x1E16DE7DB46C8, 0x76B0ADA08CD79, 0x2A1AC65B68D18, 0x7672CF577F100, 0x28FEC9FD7EE41 } },
+  { { 0x227E461210F3C, 0x73598F409FFBE, 0x73DCD874C58B2, 0x0BC5DA4E21443, 0x435E38ACE3518, 0x7DFEC60A97260, 0x399BCE40290D2, 0x785A6D66F5494 },
+    { 0x78C869278CE49, 0x7B7F09CF8FE24, 0x30C177C498BD4, 0x7269A5036FC94, 0x30B33E39F62CF, 0x2CC61AF69B25C, 0x5102B24E1B403, 0x3E8854FCD494B },
+    { 0x48F599B5508A9, 0x32F476BDCCC8F, 0x1D00574ED98BD, 0x225413DA1F7A6, 0x3D9054733DBE1, 0x739520E95F221, 0x569C6E11EEF18, 0x316092C986D8B },
+    { 0x58DC9507B0DC4, 0x62FA1CA68DB7A, 0x2229ECF04AA5C, 0x01E576C1DAF07, 0x7D37DA852FD27, 0x014443B0AC54A, 0x70A93CD0B7195, 0x50670CB1FA2A9 },
+    { 0x6AC70D2CFAC19, 0x064FD2DA911CB, 0x454BAE1F5BF8A, 0x107D14917C2F5, 0x188D8D8FE6368, 0x686EFB3B18563, 0x58C55BD611D6C, 0x4A520E3A8CFA6 },
+    { 0x105FEDAB6E07E, 0x0CFBFEECDD8A8, 0x6694A485E19E1, 0x0DB1EEA5ED65F, 0x096D172CE5B6D, 0x1EA22298D0ECB, 0x2DBC5D45CF41A, 0x2D0974B3C629A } },
+  { { 0x33CD4FBC334D8, 0x5824F274DCED4, 0x621BFA86B1DFD, 0x768012BC648AC, 0x299DEDB483266, 0x0E5D9A31A9298, 0x05487FC9EA0F5, 0x48DE934EB8A21 },
+    { 0x7EEDF68A231C6, 0x22F81B03C8644, 0x78CB934B3956F, 0x78042611A3394, 0x0935755E6BD51, 0x2CADF6A9DDA30, 0x5979E4FA052CF, 0x0849B54382736 },
+    { 0x393804F692596, 0x6B907588E4056, 0x5C5521A5F557C, 0x17FD4CBB67D38, 0x594DB304C4B79, 0x492C3E65246EB, 0x643EA579E9339, 0x1A761A80DC5E0 },
+    { 0x6EC2EC41B6A1A, 0x2446355F61207, 0x02E14BEDBCDDE, 0x21CCEAADDF73F, 0x240E059389266, 0x467A7D5AF4688, 0x4C88E475766E1, 0x1D0ADA20ED3B4 },
+    { 0x7758E1AFB79DC, 0x5531F71604AB1, 0x5D0CCFF244BFD, 0x441C7CEE4BD2A, 0x66A13A3351509, 0x23C16D251359D, 0x5ABC336328B1F, 0x3D332B68A7792 },
+    { 0x41641DE39CF35, 0x13900A2D3CFA9, 0x372A0FB4A1A2D, 0x0C065F788D75B, 0x126C3A5C50A27, 0x2625C6A1691B1, 0x55F140755CD1B, 0x244FAF05142B5 } },
+  { { 0x775326D53CE46, 0x0408CA640602C, 0x72829831931AA, 0x5B654193FB6E7, 0x539156BB49204, 0x49868447747E6, 0x624A3ECF31D02, 0x4EABFD4B79435 },
+    { 0x2937DFE982808, 0x58C93FBF71C2C, 0x17FC112E66CBD, 0x70A8EEB702A64, 0x3F88B9FD90AF5, 0x459EAA55BA1DE, 0x60BD6BEBEFF98, 0x1D6AF6B136B15 },
+    { 0x207BD839D4D9B, 0x4760AE73B21CD, 0x6092A9A850DA1, 0x7E1B372931209, 0x5EE569D33364B, 0x67B0DA8304B85, 0x5F9134B45DD52, 0x3570FD91B5CED },
+    { 0x0C45BA828973F, 0x3FEA0105835E6, 0x1712A2C80BEAB, 0x2045A282EC68F, 0x754679B170989, 0x1523066E15992, 0x47F3D2157719E, 0x4F868F8E06E97 },
+    { 0x7881E11913FA4, 0x14F362F6A241F, 0x4B061D138A8F8, 0x44FB64E4EAF0F, 0x3A4396BB76E11, 0x1078EAB39622C, 0x616B7CED633A5, 0x0662C508E80E6 },
+    { 0x7694DC778BAC9, 0x17FA5251D1021, 0x590729BF3DE39, 0x0FF902C39765B, 0x6772F23057265, 0x2FFA704759199, 0x10F15A6FD9330, 0x316A42B092DEC } },
+  { { 0x727D8B6145806, 0x07352B86E346F, 0x761CF2FA30C2A, 0x24D39F250C9B1, 0x5E8293B30EAF4, 0x083A6D03B5100, 0x09EC5BF2940C8, 0x229152C178A2A },
+    { 0x4C095079F6253, 0x10F4D4A3272BD, 0x777163880C46B, 0x3A7470502237F, 0x1551CC0C95BED, 0x726730A35439A, 0x559446A92A0E5, 0x789473AF560AA },
+    { 0x25EBF11414326, 0x675A97E329983, 0x73F8893F5FF04, 0x2FA565C2E43C7, 0x53BF4EBF8E999, 0x2E3A0BC087717, 0x1C2124DC1659D, 0x6A362F5B0F513 },
+    { 0x05D1F23B40C75, 0x0B5621E03E86D, 0x64F798B4DBA29, 0x19AEFACF7E454, 0x2DBAA5579CE14, 0x402D440AF8413, 0x7CC01AD7FB1F0, 0x5EA4E1C4D99A3 },
+    { 0x27571EEE1AAAD, 0x4EC5DB24FECAF, 0x6B89C2803AE23, 0x4C9C8681C4930, 0x14D602C5A41B7, 0x722C58BFD4813, 0x0B0404432A39B, 0x6DA1B6CAF25A1 },
+    { 0x1C91842D921CD, 0x1B38712A89C9E, 0x0430752EBA37C, 0x1CBCE93511F90, 0x3BFD606420901, 0x24DF59D15EF71, 0x76BFA8CD80818, 0x274CD69E9AA04 } },
+  { { 0x1C8D15645BA24, 0x5AAA41A4C2DDB, 0x4432E681AE457, 0x7F2E696D5A6C3, 0x58B1A835A5660, 0x4817843F6A78A, 0x00E84FCE3AD73, 0x41FCC86D73F86 },
+    { 0x7838E883BD241, 0x194921B4C417C, 0x33C6971465E75, 0x2D00D603FB9F4, 0x34B00ABF1EAE8, 0x2FAEA36237B77, 0x51DDEDD07E317, 0x27CA8399AC7E4 },
+    { 0x3D6A084F6663A, 0x3A3FB3F0ECC9E, 0x12595FEB5B63A, 0x4CAC5DD0294FA, 0x23B95020C16A5, 0x78532AFB13F28, 0x22D6F84253BF4, 0x73D1B5DC0F568 },
+    { 0x05DC6862BC475, 0x15C9E937DAA3A, 0x277D0F62A6E83, 0x2FB4AE96BC3FF, 0x3C2F5E048C383, 0x2649A79326831, 0x4C2D0636D91FD, 0x00A4D1C9F8698 },
+    { 0x4911A31D262F6, 0x1CD6EEBF1C744, 0x1EC9DEF8F743E, 0x0B6BD02E32105, 0x7BB9E4FF1D7B8, 0x1C2ED9E1AD6B8, 0x74539CD8F380F, 0x4F571CDAD60F0 },
+    { 0x4FF10E77F413E, 0x15B5C4EBA2CC6, 0x7AF1FD2063B0F, 0x0C77C85417173, 0x372E14BC80865, 0x2F6CB96562FC5, 0x717821957CD51, 0x251E74AB75210 } },
+  { { 0x1F4B8ACE13D23, 0x7FCCD89CC276C, 0x637AFCCFB6DB9, 0x17142264F094A, 0x7F149225946E5, 0x7E801EADD83C3, 0x3EE535CCD6E57, 0x5B4BDB60F659A },
+    { 0x4BFED98C8F1BE, 0x2B2D5FD45A4DD, 0x76D5A1A90DCAA, 0x03952DCCE5D51, 0x34A32247C1B36, 0x38DFD1696CCDB, 0x4AF3639928DC9, 0x43CF8371FCA99 },
+    { 0x2444C26B609B6, 0x79FDA2B24079A, 0x3FEA3966006A9, 0x79E26F3FFDCF7, 0x709680889C861, 0x102E6331534BF, 0x6E9FFD543926A, 0x6F4C0F3B6D067 },
+    { 0x00E08FC35EC18, 0x113240173FDE2, 0x317B032F0AB2D, 0x7D1426827BF76, 0x4184B9D8BB6E8, 0x01A791CCD5B79, 0x324E49F764421, 0x1EA111E00D7A9 },
+    { 0x53F6D933B1AB6, 0x7A7B5FE98412C, 0x02B22A505E3A8, 0x678FCE9C84490, 0x1203A75BD9D26, 0x5B5156DE4E4FA, 0x3DE71C5FDA76A, 0x5BCDDE988497E },
+    { 0x30706C461D12B, 0x19F1463978A28, 0x0A036D4F55F27, 0x249B99A87C97A, 0x266A4FE22FB1D, 0x331489ECD742D, 0x5240A336815A7, 0x2646C1A71B0A1 } },
+  { { 0x3E1D7E8249D84, 0x0E8F73419FF9B, 0x2068F34EB6C66, 0x2BF3A3FD7F451, 0x5EA78E9E3CD34, 0x566B6EE20B7C4, 0x4B2A7AB7B3984, 0x5E77DD752CA62 },
+    { 0x312F2D7170814, 0x3D91C36B694A5, 0x0C3A1456D4024, 0x102130626D6DD, 0x73608FD0E8DA8, 0x6E3F7583B95A9, 0x41140CF07DFCD, 0x2327A9742D81B },
+    { 0x28A773602C9C2, 0x0FBB4A09AFE6A, 0x5A1A6B1C9E1EA, 0x644821A00BC54, 0x0ACBBF7AD678C, 0x34B7190A8F97F, 0x303D4B5D67941, 0x1B626A23730D3 },
+    { 0x01A62094BFBB5, 0x392D3F7AD92E0, 0x729F23440F44E, 0x430ED8A02EFFA, 0x28A342779DC41, 0x540F49872DFEB, 0x704E618DA290D, 0x67C0C629AB08D },
+    { 0x2856E601CCD95, 0x783A59F60D84E, 0x0E86A1D00F664, 0x4DD3A2BB40CDB, 0x2090CF2363217, 0x735D77C0D890F, 0x6FD7E1837A761, 0x7222F60A8F62D },
+    { 0x08F966665081E, 0x207705D09484B, 0x4BFB9AF98386B, 0x0C140859E6A39, 0x795772E372D78, 0x210AE4604C95D, 0x60726065B135B, 0x2AFA6DAB132E9 } },
+  { { 0x0FCCB44DBA69C, 0x1C8087C1F92D7, 0x74CD310786DA8, 0x6A408775884B1, 0x5779B68D78C2C, 0x17569AB7C78C1, 0x03DC127825294, 0x2AA8838B96CAC },
+    { 0x3BAECD91C06E9, 0x421A53B021A95, 0x462D0D4D4AD79, 0x3FBDA94D8A647, 0x4B66944B06BC3, 0x50FCA02461167, 0x25ADA0FA8B3A2, 0x30C1B00745CCE },
+    { 0x1FE3EAF7D034C, 0x0901C07C621CF, 0x5B00BCF0F8925, 0x6315FBBCE8F63, 0x3A3AD9BE2A581, 0x4BDA508231167, 0x5445833AFDCE4, 0x2AC3E873785FF },
+    { 0x22EE7DA05D654, 0x0BC2EE5D4EADF, 0x5553205A8100E, 0x254AB7C5C65EF, 0x0261E3AFEE7C6, 0x74BABBD8ED44A, 0x3BDA04398DAEF, 0x2C1C1D1E65E5E },
+    { 0x1AC9B04CE3135, 0x72297BE038234, 0x2CEF03A726483, 0x1306B59A53355, 0x7AD3F02B87F30, 0x555CF80DC524C, 0x55954A0706958, 0x0EFC9FCA8CCF7 },
+    { 0x67851A69440DE, 0x0CBC71666B1CC, 0x712B7971C9FD5, 0x0A6B78964EB88, 0x545C1E6646023, 0x1EBD0ABD3F397, 0x784DCBEE5BBB7, 0x1F284E07C9DA2 } },
+  { { 0x2E26AD77A8974, 0x10BC78868B211, 0x1453DA51A4562, 0x378AF1D24CB1D, 0x15D0B99D445E4, 0x30637160A5C4A, 0x2239026A9946C, 0x00E549331969A },
+    { 0x29A19A730A4F2, 0x0AA3979458F5D, 0x4C64FAB36D155, 0x3D98C12531891, 0x01F2482D4E45D, 0x3A0D7D1186099, 0x7E29F37FEA915, 0x62D3EFEE3A23B },
+    { 0x069FE08131BFC, 0x5998EAC37EC55, 0x594EEB48A9990, 0x03135D1499B30, 0x100C39738AF72, 0x487C0A30AE52C, 0x3C61CD23121E3, 0x64CC6A21C48A5 },
+    { 0x0F04D8B4D107A, 0x69EE75689263E, 0x4DAA45B6E3909, 0x76303FB1AC6B9, 0x1095DB1A33824, 0x74EFAD867B237, 0x3F327C2B48F22, 0x2D2CFC9F8F854 },
+    { 0x635499D6A2327, 0x06C729296AC3C, 0x76D3AFB8487CE, 0x1CB232D450989, 0x419319F9FC827, 0x43CF520C749AA, 0x7141F517532AF, 0x0B7F988320E29 },
+    { 0x4C18DF6CA9B3D, 0x083872BA4C766, 0x09E1BBF92BBE3, 0x06E4B035FFAD8, 0x777E2290D2F02, 0x2E9CAEE133A72, 0x4D6EC8C7ECB94, 0x271B09ADE9498 } },
+  { { 0x168AC378CC5C9, 0x46686FA2E8E8E, 0x0F9F26CC857C6, 0x1DF36E843F5E2, 0x3F222FB5E9F75, 0x49D35BBC9E44B, 0x73AC21B91B086, 0x054D11E96452C },
+    { 0x220B28646F2EB, 0x3F0C1377ED67F, 0x2D2FF46BC13F4, 0x2D218E92CF612, 0x65033D98B2F5C, 0x280F8AA951E56, 0x60C68FDFAEE04, 0x3152E990A9436 },
+    { 0x7BC7EC00B78D6, 0x3ED5D55A79055, 0x459CBDABE2DBC, 0x115B10B36A3D8, 0x50105BFE2E431, 0x6C585E6406C6F, 0x7AB810E53C945, 0x7AE492600EC93 },
+    { 0x472D28CBA0D8C, 0x237277DB7AE4D, 0x299FFA8B62FEE, 0x52BC46F03396B, 0x00F76C88E870C, 0x4D809A9E36665, 0x10E63A713BE37, 0x5903DA128C5E1 },
+    { 0x632D25894CC33, 0x4BAE4CEBC0266, 0x2C5037F4374EE, 0x129432C683D0A, 0x4EE7526C46BCF, 0x1F317890A1A65, 0x68DC187261DBF, 0x3E5449E58C1DF },
+    { 0x5E3B09BCF4383, 0x0DB5C83C5D64A, 0x63EE41CE7E99A, 0x1356D4F50C9F0, 0x6BA10731ACA8D, 0x2714F4CB8610D, 0x4827DEC13A5C7, 0x1789DA24B6EB9 } },
+  { { 0x7489B0A0E798D, 0x40A590FFA9BEB, 0x7733CE21F975C, 0x5215527749BF1, 0x239C1D69BF80F, 0x14B9EBB5902F5, 0x7874038D3E06C, 0x19C3A3DACA80B },
+    { 0x17084CD135808, 0x672A9774DC348, 0x05ABA8F4D69FC, 0x08190ADDE7A8B, 0x67C435281C2F0, 0x5F176D61E4030, 0x2AF8D6B7CCB84, 0x3C7B743DD0740 },
+    { 0x08EF5641DD440, 0x66189F3543F74, 0x52924EB72DB93, 0x715D2E31360CA, 0x587983FA24DB2, 0x56AAAE5BAB914, 0x6081796EBDA76, 0x77995AD28EE59 },
+    { 0x4B769BC0EF30F, 0x7BBBF29FCE2D2, 0x08CC6FA26242C, 0x1A90A7C18979F, 0x5DAECC581A583, 0x7F154FE1BBD8B, 0x4F1AC069889D9, 0x4AF9C85A2556E },
+    { 0x75BDA40C21A11, 0x5B20CECB2BF1E, 0x28CF83D05AC7F, 0x686DE8203BD13, 0x40EE689A6ACC9, 0x29954F3FA84BD, 0x75668913C1D31, 0x5D0E888494811 },
+    { 0x3A5AD140473EA, 0x08F041AE8589E, 0x2A17F00BC7887, 0x1C208E9D834BD, 0x7B04E1BB423B2, 0x2ECB0C73500C9, 0x61AD88163E721, 0x32B28FC6F8530 } },
+  { { 0x440DF7F53961B, 0x1A21E95976D40, 0x0ACCDBD856485, 0x00581A71C7DE4, 0x72714AF1A0E17, 0x59A50C632C150, 0x6B659F6A0B9EF, 0x28AC90B7BAFD4 },
+    { 0x706990AD75BB9, 0x0443CF92E80F9, 0x53CAE679326C7, 0x29FA184092AD5, 0x4F77D5CBB54D6, 0x01C752CB918D9, 0x6900905498352, 0x1E7F75278D952 },
+    { 0x57B8F6DAADBED, 0x140A0A0EE06B4, 0x1BC6FB14E2520, 0x27C017B1FFDF7, 0x1E9A0E5B54DFC, 0x32EF09DE61307, 0x31C052F26F8E7, 0x298FB785D0474 },
+    { 0x3F1FF0981B395, 0x7B461B296CDC5, 0x3AFCEC6B390F9, 0x6E8A5710E4FEA, 0x2343503E2919C, 0x03F1386377F97, 0x5FCE5DB9721A7, 0x68BEAF62956E0 },
+    { 0x08D72ACB4554C, 0x7807DC8FA11D5, 0x1AA042164AC5F, 0x730913543C91F, 0x6C2F32E0FDD5D, 0x0C7C8A99AC90D, 0x0A278FBA3ED7E, 0x5F48AA10CBD8A },
+    { 0x7939B8A8043D5, 0x0D7C9C1958D93, 0x104A18E3BC596, 0x16FB8A7D75F3C, 0x79C1A868903F2, 0x27FA933A44351, 0x334B03EE598CF, 0x230F7970866D0 } },
+  { { 0x6542CE597F90E, 0x79C7F9776345E, 0x009EBB15CAE8B, 0x07035D321F642, 0x44D7642EB85FE, 0x58138CAD49A21, 0x165A43F09A453, 0x74991D5BE4F5C },
+    { 0x133281B994B1E, 0x744D634F47020, 0x6B8552CE6BA88, 0x0B2B5DD03BB56, 0x4DA24955E3520, 0x21AEFBF52BAA7, 0x5B01F9F0B8DF3, 0x5DD88BFD2DF8A },
+    { 0x7DE90B9788000, 0x40812E382B771, 0x55E2A106EE33C, 0x74BADAEA28643, 0x15D7D0208D041, 0x49A511BB10AED, 0x79D548D9456B8, 0x17B240D7D4424 },
+    { 0x29AB77DC52FD3, 0x11D95CD3EDBC4, 0x25F3D24FA1E44, 0x159222AB7F15A, 0x221088DDD7C11, 0x703459188E567, 0x124D456EDC257, 0x2C01FF9C1ABD7 },
+    { 0x25EA71AEFF794, 0x49B502F7E7DD2, 0x23D3B5A16F5E0, 0x2806DA1F2A3C5, 0x35FC339916895, 0x1D585C93F12AB, 0x1853173DCF68D, 0x2637D17C676B3 },
+    { 0x4F1A5ABA278A3, 0x1CBE609D45201, 0x0F5CE79913743, 0x1C268B30FA3B5, 0x530BBBF7F9B3D, 0x1FDBB608A69CB, 0x738E3963479C5, 0x24191F0A4307D } },
+  { { 0x0E4FB3AF2E4A9, 0x3B77242DBFCA2, 0x4C18F3EB23279, 0x36A606946210F, 0x45B49CE01E6D7, 0x4A9C199FCBD94, 0x44BC0ED4B0917, 0x032592A68314E },
+    { 0x3FFB680977E2D, 0x17C5B83840F10, 0x4EA9B063A4285, 0x0A9DD8F06CD1C, 0x54779AE61648B, 0x2E7BE3BCA28D4, 0x1DFCDD428D7A4, 0x7F729BAEF4C85 },
+    { 0x547BB6F6B2F32, 0x4E6414FEB55D8, 0x6A78BAD5E5925, 0x37073C4010229, 0x34974ECD50157, 0x354DAFF0CA5B0, 0x48FD75E537FCA, 0x24BDAC880D4E5 },
+    { 0x7414A30531976, 0x01F5F4A07699C, 0x64B5817D7E123, 0x196A9AC14608C, 0x6F6DD38C8CAE9, 0x3CA04288912E6, 0x44170472B09B7, 0x76AC2E8451BB7 },
+    { 0x2DB8E5572F059, 0x02FC67351F2BF, 0x1E89CC71DD63F, 0x21510E3914DC9, 0x286938AF7978F, 0x200DE2F965943, 0x34ABF908D16AC, 0x1C12DB0C639AA },
+    { 0x4850D05631078, 0x06F85ABFA47EB, 0x1A003E16AC49C, 0x17CC1C718ED4E, 0x0EA2C115A29FA, 0x245123D06BD1B, 0x2F16A9AA0531E, 0x1A84CAA8F0689 } },
+  { { 0x66F0D3811C7B2, 0x0B609A0303110, 0x0BBDDC52427BA, 0x0F6739B86E52E, 0x4724AEDD2204A, 0x7F92DFA919B07, 0x604C0404FB94C, 0x5594B127AFB08 },
+    { 0x24A79E0B35442, 0x6C8890ED88C4D, 0x7492ECB96AF3E, 0x5DD98D8F7C17B, 0x668F33A0E3067, 0x751AB76D268FC, 0x75A3F17DFA8CF, 0x7C61254D2F8C1 },
+    { 0x2AA04D24B8342, 0x6E8778CD5EC04, 0x7E6E422F381EF, 0x07E2DD6CCEC3B, 0x0E31A9FFE88B6, 0x455F44D67C8AE, 0x7D8B24EACB48F, 0x2023B7064122C },
+    { 0x74E1256BF1657, 0x1B410AABACA51, 0x5A00982065404, 0x6DABDB45C6B90, 0x15A859B33E8DE, 0x3FE70785561AD, 0x1A606F8F5E54C, 0x653C54559610B },
+    { 0x264647372CDE7, 0x33F4E53724129, 0x52C415116CAE2, 0x6AE31BB52A495, 0x26CE79EE8DE9B, 0x51BF6C85429D5, 0x2C171C82B4350, 0x036796494B178 },
+    { 0x377458A1DE6F5, 0x02D45DD205483, 0x6501A20F44A13, 0x1449649456087, 0x4126B7DA97A25, 0x29A30DD4237B2, 0x0F64C0422FFEA, 0x29EB37463F616 } },
+  { { 0x0A1E2CBDAA1DD, 0x1C6215F3D12FD, 0x65A66566871B9, 0x0F4062D4F1F3A, 0x337868CCC822F, 0x375BDE72AACD0, 0x6BB0A1E68736D, 0x04014FB72857F },
+    { 0x58072F735C442, 0x4AF070BB9FACA, 0x0936FD10D73BC, 0x6A4EFBB7C9A4E, 0x5D713FC685567, 0x774485D6DC553, 0x6456006EB2869, 0x5DCBE43D68983 },
+    { 0x5EE837BAFFD13, 0x0C0C0795F48C4, 0x3880BBF1D4015, 0x5F5306609CF8B, 0x6A495251D094E, 0x4C8DFF80C5ADB, 0x210EA58670A5F, 0x3FC7915EDBA75 },
+    { 0x5932A914AF89E, 0x6775F693DDEAC, 0x7D4F60992F6B0, 0x521B4B2EDCEB9, 0x4F16D3D89E2E0, 0x7DF14A79DABD6, 0x270CC08153F4B, 0x417DB114F8F8D },
+    { 0x7DEE31EAD23A1, 0x724CE8517E07A, 0x2B2C9C9FFCE56, 0x651F05AB2E9E3, 0x251DEFB033E3E, 0x16E0946293056, 0x7F1BA3022568C, 0x6CECD7A4FB161 },
+    { 0x38E7CB68FF03F, 0x1075940D546BF, 0x6AEAEFCCE94B7, 0x18A9DE5667DDB, 0x3BFC97911C6DA, 0x2BB77EA8AD63B, 0x489D5A2748BE9, 0x1D2F512932405 } },
+  { { 0x54C3664617DAA, 0x417053B8D1869, 0x00E1A38BE5F74, 0x69F5597D4BD71, 0x6CCA2BAC4FA14, 0x5F8AC736E09AB, 0x2BBFCF9BA5758, 0x30054F675FD92 },
+    { 0x692E7A036BB22, 0x6EB27A511AAA0, 0x1539DEB2CAE62, 0x06D88352F6141, 0x57C0E3A395CE0, 0x3EC3D6787FBE7, 0x601C008BEE190, 0x69D56AAFD70CC },
+    { 0x7EA35CCE4708B, 0x6FA7052556ACF, 0x52C77BA28E2E8, 0x1A1599AB14D7A, 0x0839CCB959AEB, 0x0D55DC6A18414, 0x7E7ACE0DACBE0, 0x5D7EE315D0046 },
+    { 0x0265CBEA9B27A, 0x7209EA48AAE21, 0x711883AAAA9FD, 0x6FB8E4F2413CD, 0x56CE7B38877C4, 0x09153B2765307, 0x6D20A1FCF6E72, 0x3988EE1F3844E },
+    { 0x228222F5DC76F, 0x5658788C98039, 0x1BEF1E0D60DA5, 0x4601ED3F01978, 0x4C4A58E735C20, 0x538B259FBEB88, 0x5F864DA8B4EF4, 0x7D079BB71B6A9 },
+    { 0x2FE6B3E5665E1, 0x1033A81F9056C, 0x05D0BE8BDE300, 0x1CF126644F029, 0x0ACD36A9A381A, 0x1F67FAF01FAFD, 0x13E94B5B2A20F, 0x3176B67116BB2 } },
+  { { 0x5B6C01E62D8AD, 0x7799C3942132C, 0x292206AB054E3, 0x6921CCBB00C2C, 0x7FDB742DADEFB, 0x616047DE4C645, 0x7EB9D0F353A19, 0x339405261F8C4 },
+    { 0x11911117F4F71, 0x6BABBBB552378, 0x0A56E42FBA3B1, 0x13BBBE8E7D41D, 0x3775181B1F7F8, 0x6B86DEB16D2F5, 0x0A8C4F16BAD1C, 0x3AB3698929FB2 },
+    { 0x54488B436404D, 0x4DB06B609BE93, 0x68FEB02AF308A, 0x3A425A1E3313F, 0x7FB4EB181F26D, 0x0E50C0719556A, 0x50E607B54F8DE, 0x395D12EC0F529 },
+    { 0x11142CE6C86CC, 0x18F4D83D879F9, 0x5635C023C2D92, 0x784CAA6E7BCB3, 0x2D274B6D47BFC, 0x041E985B35EBD, 0x7E91A263B2CA0, 0x7BD1AD1AA0F8A },
+    { 0x5B6ACFA797D81, 0x1DBFEFD333AC6, 0x26268B73A6211, 0x155DBAE208BB1, 0x428ADF3D2C1C0, 0x379D1D8553F43, 0x23BB02A9153B3, 0x57CCB3F599A24 },
+    { 0x2F645FC376DA7, 0x0AFC2623F78DA, 0x0C10B581D10E5, 0x0D07E58A0C9F5, 0x6AC905D21A86A, 0x25CDDFD80CB34, 0x08D8872156B66, 0x269904FD5A54D } },
+  { { 0x5D2AD450E2F45, 0x76B91123E611C, 0x637B3FAC064D2, 0x726A061002A1D, 0x0914D6B78348B, 0x6666D80F3341B, 0x2523569B9D030, 0x76B61CC0D54F5 },
+    { 0x3A80E16678258, 0x3E537D7EFD096, 0x5FD6603B2F54F, 0x5105FD1764123, 0x0D37D9CE46749, 0x57DEF24F9FFF3, 0x6E484001D4225, 0x2BB344E3B32A5 },
+    { 0x34D6A7FC40A37, 0x6BF5571295F64, 0x7C600F8E44B6A, 0x22591277653C7, 0x59C45F071243E, 0x3DBF20E62E4B0, 0x04B97F14538B1, 0x3EEF928AF69E5 },
+    { 0x239A0CB0887D4, 0x151842398E5E2, 0x4B8A6F050A109, 0x45FEB72A57E24, 0x0064C5511F3F9, 0x71CADC7C66E71, 0x7625A8DB1CEAE, 0x4276CA6B69122 },
+    { 0x1243DFF41E453, 0x4D1EA95B10E84, 0x1E79F7E718F3B, 0x0AFF1BA884328, 0x77626678810AD, 0x781C61A7BD1E6, 0x75E77D90F8A7B, 0x0D74572B3ADD4 },
+    { 0x33CB3C0925033, 0x1F241ECD8AA75, 0x50B56CE4A0C61, 0x15C1EF8B977A6, 0x3E626BBD50A45, 0x2006B9016217D, 0x1B704D91C8C17, 0x2FE7A900E7A7F } },
+  { { 0x589FAE4B66B42, 0x14BF6852A5450, 0x0CAC03A3B40D1, 0x48794BF729FCE, 0x362CC7DEE72F2, 0x2357CC3525C73, 0x7045FB6F23521, 0x52241E4A80E35 },
+    { 0x38586A185D08E, 0x4B493A7B32BEB, 0x40E803CFD476C, 0x65D1E6E30AC7F, 0x51CF04E39DED8, 0x72AEA95F1CEA2, 0x00600949B74E4, 0x6CD50D873F6AE },
+    { 0x5AC74EF56576A, 0x1FCABA75CCB7F, 0x685CBEB6885FB, 0x051A36A656FA4, 0x4FA186E1CC6D1, 0x50A47407F3112, 0x36AE830EFD6BF, 0x087B02B30F2FC },
+    { 0x5FADDA55B77BC, 0x082D71985E5EC, 0x2EB32C5D1A1D5, 0x4F31326B82D9E, 0x1B0F3337E8C6B, 0x4624BAD393E31, 0x748F188648D24, 0x1629B4ACA76CB },
+    { 0x7949B9C1F7266, 0x3E69FB5E06A78, 0x1A91A9FA0273E, 0x1B68E0C61BFE9, 0x7D083B77603D9, 0x69617D75C3CFE, 0x6F43A5D6A92EC, 0x0213E58C5082F },
+    { 0x070649910C58D, 0x2376CF9749C4C, 0x7D9395CEEF6F6, 0x097B7DCB9CD39, 0x59A11DBFAFAF7, 0x27E251A6C63F8, 0x6D48DA594A478, 0x2FEFC1BEAEABC } },
+  { { 0x50CC27A519B01, 0x3987BAA604CC1, 0x7EA00FF17674D, 0x6DD6228F3EE55, 0x3C64D9F4C89D1, 0x4EAB2F7DAA35E, 0x285A414143A09, 0x447A6B8817419 },
+    { 0x6751F228AD53A, 0x1D4B7AA9CACA0, 0x188D3851A76B3, 0x0CB792C3D78ED, 0x0A9A7E115EA0E, 0x786F5179E85F4, 0x08F237D442D01, 0x2B58318EAE897 },
+    { 0x6AFF55C0DAD02, 0x4FAE83832AE6C, 0x1CA74C6676D71, 0x762B6706FCCDB, 0x4FB95F39F1C18, 0x65AC08828EB75, 0x2A6A5CC374F5D, 0x0BB137C57D5D3 },
+    { 0x2E9BEE3DF5AA7, 0x746E3322B3DA6, 0x69089C9B11D3B, 0x55CE3C7765452, 0x70CA79C3126D3, 0x334F2A5440718, 0x01D92F5075F86, 0x66384FB886F44 },
+    { 0x5260022D2CAEE, 0x3D329D47EA98D, 0x5FF4D527E2184, 0x1F394F9D31FC0, 0x016278D788F88, 0x680D1D8D01A19, 0x3991B0B05ABE7, 0x15FB6126B274B },
+    { 0x0C57C4D973D96, 0x14C93E3A82978, 0x5622FF6175873, 0x1AB16A4A2F24B, 0x30BB151E4C818, 0x24F2081DD69B8, 0x4FB23D389F56E, 0x2E890B1FF8595 } },
+  { { 0x79E0C648CA8AC, 0x200889096D005, 0x1FB643B4938B7, 0x3389883A6AC12, 0x6DA0E8458B5C0, 0x247B71F2102D8, 0x2FEC66A2FD55F, 0x08066401E07A1 },
+    { 0x095AF3271EBF8, 0x265377CFFE404, 0x495EB850DF8CE, 0x74D0EC6EFE489, 0x14E56CE0AB108, 0x178DC71095E49, 0x6F45B529E714D, 0x7C30A40A87AC1 },
+    { 0x0520D0B52AE3C, 0x3E819874D035F, 0x320FBF020F634, 0x269DC8807632E, 0x46CF0AD6E11F7, 0x42F097F8977AF, 0x2C4EFB3840641, 0x081B843038CE8 },
+    { 0x04AA85129B441, 0x4E94DF9E2D7EA, 0x0D27B57EEF38B, 0x3D50F41094E95, 0x7A3A9AE13E7DA, 0x5AD99021163BD, 0x4EEB1B1991A2D, 0x4E4D057704410 },
+    { 0x0BA39F5DA1EBB, 0x24D6010700F61, 0x7D5F179E38EF8, 0x4397FD40AE4B2, 0x06A3FE2899DC6, 0x6E11B28883209, 0x27711EC71189F, 0x2A5A224776B93 },
+    { 0x7DAA57D8620B3, 0x15125744D5424, 0x7740346EB8916, 0x13C8224A4F4BD, 0x3FAA43CB98C2F, 0x2BB7A79A50A09, 0x15B23E447844B, 0x16DCC42B37659 } },
+  { { 0x42517AF775A0F, 0x2C3CBD666F733, 0x781D317927F81, 0x306124B30EE91, 0x79BF4F00AE501, 0x7C9B1248C639C, 0x1181FB895319B, 0x581212C0AE727 },
+    { 0x7F36AF872FEE1, 0x5502AFB64086A, 0x6EB9B548442FD, 0x7CB8AF250F603, 0x5946FE76CAB07, 0x6A506F5CD15FE, 0x4DF0A4B65DF28, 0x45A5DBB3B222A },
+    { 0x03EEE8E393BE0, 0x7CE060EFE8675, 0x3737E2D4C012C, 0x0EC160A3A2387, 0x62C1A5C3A689A, 0x097CD65820243, 0x5EE63C943EF8D, 0x2616EEEFBC58E },
+    { 0x74282F5C044FD, 0x3F18DE1F11FD0, 0x2A08CFDDAACA2, 0x08550BB50CD58, 0x1A92A174CFFCF, 0x1685E8B960993, 0x444C48B9829B0, 0x3B5390465F3F2 },
+    { 0x59DE5A6653E7E, 0x38FD193392D13, 0x76EEC54EE07D7, 0x55CA67F4A08AB, 0x74517C03E1271, 0x4629B91370176, 0x373BFD74054EA, 0x13CDB74C003D8 },
+    { 0x10A27FF8FF853, 0x189B17734EBDF, 0x082E3AE02E538, 0x1174C405396C0, 0x3C7F151394077, 0x295D22BD29601, 0x45C23EC5AF1FD, 0x1AEDE861C411C } },
+  { { 0x7509AD11DF69A, 0x0E65DBC297117, 0x47CA60C3A0D5B, 0x1991F9D1120CF, 0x1C5BE67A97848, 0x69BF2E35E68F4, 0x7DA6AEB4B1B87, 0x3D3F38D8C4376 },
+    { 0x4F34F48A9DAC9, 0x5F8A9A5F9EF77, 0x68050A26D3292, 0x22F86F4AB8CE5, 0x36DD3B611ABF6, 0x124DF09013D59, 0x721619F67A405, 0x5068DCE8F5CB9 },
+    { 0x2EF0FAF8F1884, 0x4FDD83047ED53, 0x3BEC87ACB7295, 0x23A9863E3D959, 0x29AF90F8B1475, 0x5FB3EBCFF84CC, 0x54CF96C04DFA0, 0x0F48E6F604A27 },
+    { 0x1C238D5DEB97B, 0x1A0647AF9FF1E, 0x4BC049C30D500, 0x2E4FED5D8CBF5, 0x793A32C2AE22B, 0x622A45FBF8155, 0x7B8E71830BE8C, 0x47B6FB54ED58E },
+    { 0x7485C6D05D83F, 0x7C39879D6F584, 0x73403B520424F, 0x56E07C8457087, 0x6BD8ED96D0178, 0x32F2A3423C5EE, 0x3896C80ACDCD8, 0x4BDC3B245B0B6 },
+    { 0x0279934F0AF6A, 0x1C6FF7EE3FD91, 0x19388B7938313, 0x0A9F0F54AD4D8, 0x17BE626F3FBF1, 0x1E464B3B5E465, 0x1AD55B3C7AAC7, 0x29D4A79AD6411 } },
+  { { 0x40E2888D4E01E, 0x2AE96413B29C3, 0x7B4F901E1A398, 0x38E38298C93E1, 0x2DC60B06A9B8E, 0x7736AF8C56D77, 0x64CC6D27178C0, 0x49EDEFB230A59 },
+    { 0x1A0339A9C10F4, 0x1987CE2065808, 0x46D97114CD108, 0x6EB59A5FAEBB6, 0x282960B023B8A, 0x2C25E8C715315, 0x70F2D970B3046, 0x18F0839FDC8F5 },
+    { 0x0431E9783DE7D, 0x1CA78CB44D129, 0x73ECFF756D15E, 0x2D45F83C7B217, 0x48A31130D8013, 0x400B1A1757838, 0x51F7BD0121C7D, 0x6E805051CD693 },
+    { 0x4DB479B7A48B1, 0x39BA45273FE8C, 0x4C71C235A860D, 0x582EE80DFA7F6, 0x485616C742729, 0x1FF70642B220B, 0x6F3BB5C59C4AC, 0x4707451B3AC1F },
+    { 0x128F7B8A241C0, 0x4BDC1F8C38D1D, 0x69F798CE9E7C9, 0x3FF36E0728169, 0x08664224B3ED7, 0x49CFC87EA7A51, 0x699BFDB662D4E, 0x57F224982F683 },
+    { 0x24AAAAE4361F5, 0x1E54C215C157A, 0x71899FD68300F, 0x21DF73072E30D, 0x7045304C00BAE, 0x2192ABD418C78, 0x3BC36082425A8, 0x27BC5D2A45D86 } },
+  { { 0x59268593D17E5, 0x2CA910E3B83DF, 0x14BBF90A1DA0D, 0x314EAFB1E991C, 0x40249DEB67AFF, 0x3F839A3038B2A, 0x7851C7221222D, 0x1740C0A7C8DCD },
+    { 0x28E3A4DFD595A, 0x0199A86262C37, 0x720DBE0E7D8A2, 0x56B505B6A4B48, 0x12E49C7EF7B08, 0x58CC74B4567F4, 0x62111FC9691C8, 0x303421D108DA8 },
+    { 0x42D6096BA3995, 0x5A18076894F47, 0x68C256CCFB829, 0x6F9A646F8829F, 0x681407877D034, 0x414584205B386, 0x1EE5C1B242E54, 0x72ADA78B86EC4 },
+    { 0x467424D11FD77, 0x2B4107F56C4BB, 0x60C22A3360ACF, 0x59B46EF25D5CB, 0x01DD12CDFE207, 0x7C78ADEC153C2, 0x61FAD89913315, 0x53DC2E3C3C9EB },
+    { 0x1897B5308C7D7, 0x67E6377B135EC, 0x5BDCDF214CA30, 0x72E722C8BEE8F, 0x7DEEF72B4E238, 0x04B30343CD58B, 0x7A627154ADBC1, 0x46E6E0255C51A },
+    { 0x256D41667D337, 0x21FE52E26DFD4, 0x629E91CA0CCE5, 0x1935416B807AE, 0x4B6B9CCE88244, 0x28E1AB53DB98C, 0x2AAF139613F12, 0x30FC9D07355C9 } },
+  { { 0x720F897F60FC7, 0x23FF963407256, 0x506D397621AD8, 0x706A1872F2473, 0x17B9DB7FFE783, 0x77955082775D5, 0x01FAEB7C77E1C, 0x5C1F015B12320 },
+    { 0x723B9614CB58C, 0x4F2225A7A641A, 0x394279699C1EC, 0x4949AE86A4CCB, 0x65B48E9B1D4B1, 0x292A21C0EB211, 0x7E2D0B5F28AE5, 0x5CC1308C18BD2 },
+    { 0x3DC1E31587D8D, 0x0D9BC6A62EEFA, 0x7DEF01C821EC2, 0x72E3C71932F9F, 0x6505B2243C036, 0x4F51757C3AFAF, 0x2BD00F207B632, 0x59CC67CD4EDF9 },
+    { 0x2285EE1189297, 0x4ACDB40E9C3E0, 0x2A2EC55DCB5EF, 0x1EE70D394AB0E, 0x022AC491F2FA8, 0x70D23A9096432, 0x558DCE681BE9B, 0x6CACDC59D4ECB },
+    { 0x7398A027A6F29, 0x1787F07DCD25E, 0x7476450B6BD6A, 0x30C7B4CB7A255, 0x69ECCE7DE7E62, 0x218D8E1BC3431, 0x478ED286034A1, 0x57A314768D0F8 },
+    { 0x3553DE2A23BBB, 0x12CDB677ADD5E, 0x6996002B04D08, 0x1A71064048A3A, 0x1CE5204DDF048, 0x1698CDBB80F45, 0x69B24A2A6754E, 0x2F477416665C5 } },
+  { { 0x3114716AF7C01, 0x33FE744E748F2, 0x7F3B2DF9319C1, 0x6913BBFDE636C, 0x158DD6C3A9CA9, 0x1A48142E523F6, 0x7E34609266C9D, 0x68BD5F5174935 },
+    { 0x712D37A67090D, 0x40EA09877A661, 0x1D30D75BBA41C, 0x04D8D3FA69873, 0x3074DB7A226A9, 0x105CDD73E618D, 0x585EE44083A97, 0x0F385FE11686D },
+    { 0x05B139DDE68CC, 0x0F571594B5918, 0x78C19C6417B3F, 0x2FA08ECAAF534, 0x149931D110F29, 0x25F4D013ED3AE, 0x1E131B4B6F9DC, 0x19578EA6A36D1 },
+    { 0x48FD3104E9A3B, 0x5D4F8469609FB, 0x67BC0D1CBC4DA, 0x09B5BE35D1B9D, 0x72BF02EF60E41, 0x23E2884B540EF, 0x5ED3B798AC9B5, 0x499D84BF16229 },
+    { 0x2B79C2BF0EF09, 0x281EAFCCCC73B, 0x65D6B0106721F, 0x212EFAF0CFB46, 0x7B15B0E70F596, 0x2ED4B0A6F52FA, 0x510ABD93BA914, 0x3D435F6FBD578 },
+    { 0x2D19E2F180587, 0x1BC11C81E7942, 0x192881F811DAF, 0x1DBC290BB905E, 0x2B6FBFD7B44CA, 0x21F836B5DA602, 0x58E40C4F867F7, 0x319C915C5A090 } },
+  { { 0x12BC2BDC79954, 0x67FD9BD928D3B, 0x38D1301FF70BF, 0x1B2119B9E145D, 0x4C37561B87008, 0x350F8DD3B1A39, 0x61A18C4C8044D, 0x21480F34C2A58 },
+    { 0x482E82AF630F7, 0x24A91954E13EC, 0x6F9C775E20556, 0x14A4E9BEE2D0B, 0x2AD37F45589CB, 0x0948F497837D1, 0x27FDC3A5BE6BB, 0x2E8BC31D93EC8 },
+    { 0x095615B3766D0, 0x46B35942E1485, 0x4C6C5CA7F3CFE, 0x60965CBD64620, 0x56D4576B05739, 0x05241E84E5755, 0x7BA8533F83B4C, 0x30EC65DF75293 },
+    { 0x37903E2B5FA66, 0x65F990F3239B2, 0x72A176ED6E43A, 0x4251CD86021C0, 0x26415D0867771, 0x73B1351C1C8A0, 0x0E3EEF93FEA3C, 0x6A1A26E6A8BD1 },
+    { 0x03FFA9407E8DB, 0x3E92E29C9A6A4, 0x4F0210A5F5D1E, 0x794E6587637CF, 0x5177D9689FE38, 0x75FA7CC9ECB92, 0x62938EDB16E52, 0x1F62652DF1288 },
+    { 0x5BFFC81829B3D, 0x112E5D8E272B3, 0x2F9409DEFC4C3, 0x080213D37A53D, 0x1AD610CD4B7EC, 0x32E6762B50DF7, 0x467C6EC643D60, 0x2619825A98BDB } },
+  { { 0x33231F09A0F0C, 0x2EAA63C6DEF57, 0x3B47FB312A2BC, 0x1D04053EC190D, 0x2719401203CCE, 0x3FDFEF5F4A57B, 0x2897C257B3810, 0x05599FEDA72EF },
+    { 0x59E56A958DEF1, 0x0C1D6C2CAF1DC, 0x59DC990FE9872, 0x0B0C036101FEF, 0x68D9B2D4D4FC4, 0x1661DA66028C7, 0x16100EBE93104, 0x51D9845BF2719 },
+    { 0x311B0553BE7C7, 0x0FABCCF8E1E81, 0x5303388CABFF0, 0x12997099D0C8B, 0x7138962FD6CAD, 0x28B71BB979A22, 0x3ABC544E61F14, 0x0A0AC33CE6A6C },
+    { 0x48FF0B8F92FC0, 0x1646447E936A5, 0x1DABBA38F91BC, 0x169934F0325F8, 0x4CE92B027B93D, 0x5996FDDD8CDDF, 0x40716A5572E27, 0x02D68A3E71F09 },
+    { 0x343B8AF806974, 0x61E8F08DA52D4, 0x16F90DB2F690D, 0x6EDF3077A48A2, 0x7A83DBA0AF5D1, 0x69E2A7B260B3A, 0x58FE1BEED6553, 0x39F3A9402A159 },
+    { 0x4A3FB454A10BC, 0x1970B12BB6188, 0x52C5B08DEC04E, 0x1E2B637FB498F, 0x45DF8E4D5F87C, 0x35329741AE20A, 0x677F83C4B3BBF, 0x28996221BC0F1 } },
+  { { 0x2B6034EFBA883, 0x5E8799702B97D, 0x58B67CFF52981, 0x668E477939381, 0x5250ED1CB1CD5, 0x31F3B7DB4A992, 0x2A5541A35A185, 0x19352BE74797F },
+    { 0x54BB4BB6FF6E4, 0x253AE720FA82F, 0x1BCB2FEE226DF, 0x765A0812FC669, 0x63321D3FD0C6D, 0x0145C45842A8C, 0x41ED73610A5B5, 0x5D63D06351785 },
+    { 0x18E8A406B4134, 0x49618AFBA1424, 0x0F9866119BF9B, 0x47C919F81AB70, 0x141FB88604A0C, 0x5BB55DACA6EC4, 0x4BB88C633C008, 0x1B28451045B99 },
+    { 0x0A5580D145C1F, 0x56BFE4C387196, 0x190370641EA73, 0x4AAC32F9C7F83, 0x285C5EC301D2A, 0x0AD55AAEF9DA9, 0x1BB14AC255BF3, 0x513F5E43663E0 },
+    { 0x0AF3818DFAAA2, 0x0A0185541320C, 0x30AAC07DBAEDA, 0x3CA308E946DEE, 0x56E01DB1BC124, 0x27ADD24E22D68, 0x442C52190C48F, 0x72DEA9A9880E9 },
+    { 0x1764C529F6476, 0x0CE656775CEC2, 0x1CF5EE6B30534, 0x06625FD192E0A, 0x458FFD45EA66F, 0x25DC49DE8DD76, 0x4F60FB7A8D558, 0x253925CA69E34 } },
+  { { 0x599813FFCFB38, 0x376393EDE6E27, 0x50E127D00AE15, 0x3208FC2B0C9C7, 0x5CA67AEE527A4, 0x5CF3E195D3A98, 0x1C2D1DE9E78FD, 0x35829A2E1364B },
+    { 0x47DFD4B46CCF6, 0x4B200DC70BCD9, 0x2D6B960AA7182, 0x74AB69B135354, 0x4CCCF4445F4A9, 0x32A44C51A869C, 0x0FB2DD69AE96E, 0x5559D67302FBC },
+    { 0x098A574588BC1, 0x10414436E359F, 0x3B5DC6F447E5F, 0x466F15A19C5F1, 0x03246C7900FA5, 0x32F3C9C714114, 0x397CD3ED4939F, 0x19A83B791B8FB },
+    { 0x62590B08E108B, 0x133CD53BB886F, 0x2E6583355A835, 0x57F267066FE92, 0x406A91756C714, 0x5A77E9B18EC43, 0x35543DAD64114, 0x67846A227EBB6 },
+    { 0x16A910014C1E6, 0x15088019E97FF, 0x79FE6F8279A3D, 0x03B90D00AEBD8, 0x5900B3AA324A3, 0x757DB31771CC5, 0x11CC66BCA936A, 0x6CD0CB424F12A },
+    { 0x34CFD5D3AA984, 0x115BFA692D3D9, 0x204F565828390, 0x0E029F729C568, 0x22021D7408CE7, 0x1EDD3DBAFDB74, 0x64FC234701EAD, 0x31DBDCA2EA422 } },
+  { { 0x175F5B0B40523, 0x61131597D58C8, 0x057674E988FDF, 0x687FDF8C9B671, 0x60C4D1B7AF509, 0x2EA5B954B95A8, 0x55B7510329D7F, 0x17A14D45919E3 },
+    { 0x52D640E6274F7, 0x68EA12E780922, 0x53863D6572952, 0x4A5BF22F960EB, 0x28AD8D157D561, 0x7A9A0F130B762, 0x5DD90C9B5FF3F, 0x6763F3ED231B9 },
+    { 0x7FEF17575DB5A, 0x55AAF2D7E8ABC, 0x72448E9575E77, 0x611AB4EF18EA3, 0x01D619FB468BC, 0x3E8EE975BEFF5, 0x5B0CCCE705B73, 0x498D728401958 },
+    { 0x5E215E8BAD1D4, 0x5093EA78AAA71, 0x02CE7BA1C81A8, 0x48E9684EA2D3E, 0x63DA327046FA5, 0x474F8EBDF1B32, 0x7D95302678E5C, 0x195D75D05A324 },
+    { 0x3E1C5B288C5C3, 0x30DFAD9A97C67, 0x26E43D8286CD9, 0x4EC4FE537CC66, 0x522D00767C709, 0x00F1295C053DB, 0x6A739DDFAE58E, 0x3F8E08C15334B },
+    { 0x2036EE16445B0, 0x0537CD9995312, 0x7E1EB1A425CE2, 0x1C1CAFBBC7263, 0x628702A958B47, 0x2B04033B2C7BD, 0x08BDAAC585A49, 0x298956C11EB82 } },
+  { { 0x18FF523EC55B4, 0x231C80ADAD1DE, 0x276AC5EDD4D93, 0x71756565D9D71, 0x1A04FBF147D12, 0x7399B9D8C53E2, 0x0705306354E4F, 0x152CFB3955B12 },
+    { 0x780257D565296, 0x3017640924285, 0x4C99FC070D7DF, 0x33336A31620E0, 0x0DD10D05D7D0A, 0x219B85E001819, 0x29A4979ABD42D, 0x7782F0EF56A08 },
+    { 0x52C120296C227, 0x560469C0EACFB, 0x22A25CD84F87F, 0x10FA6B0F90FE6, 0x08673D92B9276, 0x2B2AF33B50450, 0x2C5E543BC1B5B, 0x2A4F11AD6D85E },
+    { 0x239B2F6A7EF95, 0x3005DF8F8E787, 0x20D728DE79B46, 0x7F36D5DD9E5C0, 0x00D89DF5AA2DC, 0x23C6E95F421C0, 0x2111CD3D19393, 0x1FA8BDDDAEC3C },
+    { 0x763CCF5709C4E, 0x03A6C04FB058D, 0x1CF4E7CA2FA70, 0x33C004BB57266, 0x1C2448A66985C, 0x0BD62F2BFD46A, 0x46DC38AA9A8C1, 0x04CA540CC3376 },
+    { 0x633459B740893, 0x106E2CB751D3B, 0x5238C5FF61C9D, 0x0CBA70245E73E, 0x60E7621E4EE5A, 0x28D59C6C62DBA, 0x7CEE57754C8EB, 0x30FE73218EF49 } },
+  { { 0x0EDFD5E185C3D, 0x64F38005FA48E, 0x3AC7FEC7D8F1A, 0x57C6674AFBC2E, 0x0A16EBF83EA8D, 0x742A73F479277, 0x6169089415B46, 0x712C498F82123 },
+    { 0x0D61F0D3CC350, 0x3EE7926E38803, 0x4201C43F17A87, 0x7BE2EE4179081, 0x67A9D44CEEABB, 0x1CB73EC08BFE8, 0x6BBA4FE7F5B9C, 0x728B6C0396E69 },
+    { 0x296371AD43FEB, 0x078C371172A65, 0x2A74428A9242F, 0x23F8CE692A2E9, 0x7507E72384C57, 0x2DBD40703BF16, 0x7AAB528B8C6A4, 0x351BD43306019 },
+    { 0x58EA6095B542E, 0x44FB8462D614D, 0x2B3477C73CD22, 0x1173E2CA9E72E, 0x2DB5E88295AF7, 0x263018E46A80C, 0x2BEDD4D6314A4, 0x7149BA0413637 },
+    { 0x6B323A0B8AA33, 0x64AF5E00CC486, 0x34D562C6D2494, 0x05C38ABEFF9E1, 0x7D160659AA114, 0x6D45A4EDC858D, 0x164EF43CA4BAE, 0x7ED550FF91D1F },
+    { 0x513486181432F, 0x0F3C1F089A9D9, 0x4BBBF846A9426, 0x048692EA639E3, 0x695C5A7EC22D1, 0x1AB4F2EFB14D5, 0x33D2D8A90BDE4, 0x29D1D5209F534 } },
+  { { 0x22FA210348852, 0x5905838A99928, 0x459C91368F915, 0x0910AA599ACF4, 0x19C28725F0BD2, 0x52DF94D71100D, 0x6D26FD0647CF9, 0x39DDCAAF555D2 },
+    { 0x4AFB1F441EF18, 0x66BD0C8581FE5, 0x2E0CA7EB3E671, 0x27DFF9D51BC6F, 0x6E92AFA986A1F, 0x353A62A989588, 0x3696491B50791, 0x3E039AC49AF84 },
+    { 0x443FBE29B695A, 0x11EA957B2737F, 0x67F3DC181E1E0, 0x2DDB75CD2FCC2, 0x52FD9628106F1, 0x04677CB899C1D, 0x227B0CCE4E4DC, 0x50E3340973880 },
+    { 0x3EE5C0788D613, 0x0668931DF0AAC, 0x5262C9BA2CA27, 0x5908CE50E9BE8, 0x56508C4F9FA55, 0x4AE03F327B176, 0x0C27B05FB96CF, 0x372584524E33A },
+    { 0x25265DBE5507E, 0x5FD10D6BC177C, 0x7BA2315E864AC, 0x4F6FC48F80718, 0x7CE2E5147DFAA, 0x0C350926AC712, 0x281A5FC59AE1B, 0x533241B9222A7 },
+    { 0x6C8DB62109CF6, 0x121ACCE0504D2, 0x65A3224971D64, 0x103990C2AEAEE, 0x47EC20172C0B3, 0x320CAEAB79047, 0x2C9651E364ABA, 0x22086B3E9DFA6 } },
+  { { 0x08669C6D2E70A, 0x212414215DF0B, 0x02FBA7299B767, 0x6A3BF75D258BE, 0x71538696F5B9E, 0x3F25F14125AC4, 0x32C8920942AF9, 0x4F9C6765656C4 },
+    { 0x1F613C84AC3C0, 0x46720471405E1, 0x6963C4FEB225F, 0x66E2D2C839E03, 0x49F9B41BBE735, 0x2954A2F1DD5E8, 0x15EDBC9F5E1D0, 0x5343E656782B4 },
+    { 0x4F5872BA0C063, 0x265D4D493D437, 0x680443F4222AA, 0x0E9245DB07FAB, 0x4832AD5C5482B, 0x1429EC6C82BA2, 0x028EDEC4153F6, 0x582B98A71249A },
+    { 0x4F80895B7FC8C, 0x3729E333315A1, 0x02AD5E17E2516, 0x10984289AD352, 0x4F070D9F2C048, 0x345B33E6E1919, 0x590BD6759D14E, 0x17EB4FB31FFFE },
+    { 0x35F6839D315BB, 0x5CCBEE71B5C38, 0x581EA08DC659C, 0x4E7FD3F19358E, 0x3BE33D542CF7B, 0x3295081288BF2, 0x774DDB2D81547, 0x29937AB246DB2 },
+    { 0x09BD5A6AA1FFF, 0x20E4D9072F458, 0x5228F06292B4B, 0x199DF03B0993E, 0x07B5ED62EB6E5, 0x2B3494E12C341, 0x2B55049F18019, 0x1D7969FB6F194 } },
+  { { 0x3EDAE2C409C5B, 0x5D1A70B128246, 0x3ED7CB70BD4B4, 0x27C14414BA2A2, 0x15BFAE9F61AD7, 0x51ABF37635A83, 0x4EF63B06FECE8, 0x0F1A3106C2E82 },
+    { 0x1211521730611, 0x6368714BE3623, 0x24FB631992CAA, 0x5DA51FCA3F5C3, 0x5A0CC5512B788, 0x0370E71A4E267, 0x38D5846B7419D, 0x67B65330F8CC7 },
+    { 0x20CEB22D229E2, 0x763A46F59CA38, 0x44D379CBE8F7C, 0x08ECE4AE01F52, 0x29FCB612AA76E, 0x6B0248785DAE8, 0x1E9C777EBE998, 0x048A4CE62F6DD },
+    { 0x5F2F191FC030C, 0x2E9FF5D331BEB, 0x43FDC06CEE82E, 0x36C0A0C67F330, 0x390E54F30D264, 0x7D8DF167AD9A5, 0x16A3C68B9DABD, 0x633F3723695F9 },
+    { 0x685087BA307BA, 0x0C8C7FB28451B, 0x4E0D327C47C38, 0x1FE6061C03AD3, 0x341709ADAB085, 0x3804026C5D346, 0x05E06F74FF8AC, 0x724DA30C3C178 },
+    { 0x73BC1A6828FAA, 0x13E37F0FB0A76, 0x5CB0E105027D0, 0x127FC78CBA13C, 0x029FFC1BE3A9E, 0x38324907A0005, 0x32204AF0B754C, 0x2B04D606F2712 } },
+  { { 0x1AC8F7F165C3D, 0x54B9E648BFF52, 0x48F9F889419E8, 0x470B485759DA9, 0x2BA5A3C05E4A9, 0x6EF2E48E6F6D8, 0x6FBE46DD5187C, 0x16D681B18CB7A },
+    { 0x4B7FEC1EC56CD, 0x7EAE6DBB7035B, 0x2BE0A94F48359, 0x62F8CB7983113, 0x22C39099B9892, 0x0587DDF9CEF1D, 0x5CD2DEEF50BE7, 0x0F9BDB2D98FC0 },
+    { 0x493782BC161DE, 0x221CA3B9C9FE2, 0x004461F8AC454, 0x7828A49D4021C, 0x4FE53D9DD914D, 0x5F6139E280209, 0x456EA91F36C66, 0x3C990AEF65B09 },
+    { 0x1C8FB133920F8, 0x7EABF8437E86D, 0x27B6B79B063E7, 0x49318DCD61370, 0x29E7B9A0C25DE, 0x31E604A584B2B, 0x01FE7A14745FB, 0x3EA34BEAEDD8C },
+    { 0x704DE2071E1EC, 0x2DB9C9796EFA9, 0x3D564B1A3B820, 0x770E8358B3E99, 0x7C9C62142567E, 0x4A4BF76D5D01A, 0x57AE04AB5C122, 0x6710298D0130E },
+    { 0x39ACF994535F9, 0x0B00B262EA3A1, 0x35606EBC48760, 0x152B0DDF37FC3, 0x14301394F90BB, 0x1F3145369D01D, 0x4AFA4AF1BB76F, 0x2C44744794561 } },
+  { { 0x75DB5AAA76B72, 0x5BB0FFC05AAAB, 0x1649A19F303C9, 0x69A059F73570B, 0x48547B37FAC32, 0x57461DB731DE4, 0x0EB21D9943759, 0x00BE470FB2C40 },
+    { 0x473BD95A4C0DE, 0x686CAEE9E0993, 0x40AF85FAB8097, 0x45E9C3FF83894, 0x5CDB63BFD05D1, 0x466DC16C2E589, 0x6B7DE368EA112, 0x6C8F6FCBF47CA },
+    { 0x66979C34CBD27, 0x72D42DA616E11, 0x201B0388FCA1F, 0x743DB7CAF639C, 0x1CB3378EA9056, 0x6EC9549AE0762, 0x68C6E648F3278, 0x68723513BCA3B },
+    { 0x169469EB04E9B, 0x5B9E0BB461848, 0x1A9D77205A9CB, 0x0183C29F2EF9A, 0x1610AC8FE25E2, 0x451872DB2EB38, 0x5FA001714DF8D, 0x64618C336ABC3 },
+    { 0x59A5614DB9AEF, 0x2224210E2409F, 0x1F1BA49F8D59E, 0x3EEDE713AB807, 0x33351895CB3F4, 0x704DD7904E9F5, 0x7B92BBB33D938, 0x6AE604C5CC748 },
+    { 0x5828D3ACC3C9D, 0x0A69DF81B3919, 0x4653E648F6FAA, 0x1437887432475, 0x342250B15AE7B, 0x296A4D72655ED, 0x7FA0AD56C77C2, 0x2B089C02A6F63 } },
+  { { 0x7D01759D58429, 0x57F42AC4073C5, 0x4D1F83DE10120, 0x47E3E854686A8, 0x16CF8D4A103DD, 0x5F0DE54318F7E, 0x75ECEABA38450, 0x589446EB566C9 },
+    { 0x1745603AB7DEE, 0x45EC139E13DDC, 0x62E773DEE8F63, 0x13B43B4B0C830, 0x6043CE756203D, 0x0B4233FFAEAB2, 0x22894DC01E2D5, 0x601D71B38062A },
+    { 0x0BC247E3E127C, 0x79A401D819E6F, 0x256417BCCF39A, 0x189AAEBE92D59, 0x603D7270DCA52, 0x095B78E50E5C1, 0x1F0DFB02FBB6D, 0x159750CA0EA03 },
+    { 0x7737382899DA6, 0x35D81696C23A7, 0x3FB5D344BA371, 0x55B8D7B65BDA6, 0x50707E2961C43, 0x5BDF98CBA7845, 0x36B578BD51B4D, 0x7A6481EC89CB1 },
+    { 0x79BC1914E9800, 0x4B23D8BD2391D, 0x4306096066DFB, 0x1F292D1EE0B5A, 0x529F9AFB93FA5, 0x70356B7ED1EC8, 0x00BCA6C7326A6, 0x5834B78FE9934 },
+    { 0x4A3EFF07EB5B4, 0x1667CB549858F, 0x1AA287E080317, 0x02BA4F59D8528, 0x1182B94E97F86, 0x1D1052165748D, 0x1DA1F8B19A1DA, 0x29583AD684899 } },
+  { { 0x7B03F90E8C59E, 0x117E7F971215D, 0x35B6F211FF17A, 0x370D4798AAC2F, 0x498FB704DBF1C, 0x5170A5277BC30, 0x0985D572C7F88, 0x407A3DEBC2124 },
+    { 0x585AF04B1DF8D, 0x6C5573DA4650A, 0x15D710E5B0FD6, 0x017D7A238667B, 0x2924A65F17F71, 0x7470B508E2FE2, 0x47010633A9FCD, 0x178E0DF01CF06 },
+    { 0x3EFAECFA12836, 0x6C74CC57C8BEB, 0x764D7C751A7EF, 0x7AD62D9204659, 0x7DD9DE7F082AD, 0x1AD997CFB8092, 0x6003C3D3AA781, 0x6984E7E5FE320 },
+    { 0x41BE48094CFB6, 0x38FF0057579C1, 0x73967ED11B2C6, 0x330A1522517B6, 0x6025F07EC32E1, 0x7D440FB8EFCC0, 0x0ADF5B2D78F5F, 0x2619CF7C35FB7 },
+    { 0x0F4ACB6B03B34, 0x40C28E60A3B92, 0x1D8DB0E249245, 0x25E70BBE81CA4, 0x600522992DCF5, 0x27904F31F98D9, 0x29C893125A12A, 0x41F8059AE2AB4 },
+    { 0x387AA6FDC119D, 0x1166F0EF83DB1, 0x0CD0EEBFC9700, 0x0A1FD3EEF7E97, 0x762578038B97B, 0x23346E0D2A89D, 0x4680FDA78DC6B, 0x2E9358F81FB64 } },
+  { { 0x5612E432EAABA, 0x5A0CBB919F837, 0x0D2EDE8B60157, 0x765C9FEC9DB4E, 0x7299693177692, 0x29948D1637D0A, 0x0F8077369694F, 0x3A457C00A1978 },
+    { 0x4AC8B99280F3C, 0x2754751770913, 0x6B8934FF76ED7, 0x4CD8D4940F3BF, 0x26FFCBF8E7B2A, 0x11874F46E070F, 0x130B8FDF2B511, 0x66AD278B90AE5 },
+    { 0x3070475F7D7E0, 0x5F70FFCAEA6BB, 0x17D8DDA9AF158, 0x38D2356C8DBC7, 0x6A3ED1148E80A, 0x1DFEF8B3E5983, 0x6247CD2C8B321, 0x0A24B54FDE776 },
+    { 0x4D1469E385E7B, 0x0A99DEB9C1488, 0x7F6DE92430619, 0x7D0103035FB9E, 0x5034765AD88E8, 0x264BACDC07D92, 0x7CBF7CF7065E9, 0x2B7CD23121E7A },
+    { 0x3496D9266B13E, 0x4F05A764A032F, 0x03567D735280B, 0x2B5ED26D52477, 0x7AA975E167E7A, 0x196B2DE96F738, 0x68B9C663EF5A3, 0x31AD65162C975 },
+    { 0x136CEE94D887C, 0x0F299C13B153D, 0x790E8F41F9147, 0x1032D02402BC1, 0x001B75EA936C3, 0x22945AF09371A, 0x2C7EFB34099CF, 0x1CA71592FE2F1 } },
+  { { 0x27D0C67E53B69, 0x30220015C9F4C, 0x7A29284F9202B, 0x4EA30129DB209, 0x03B9471DD87EB, 0x52CC18D3F6161, 0x270269579E2C7, 0x29E1CB0CF6EC7 },
+    { 0x57F7927C58BAE, 0x2AEFA7A6DC834, 0x0BEB5EE0A2970, 0x5232BFF21F1E3, 0x0C7825674BB1C, 0x7B4FCA27EACDA, 0x6C7B27DD2DEE0, 0x2A0F1A29F7CD0 },
+    { 0x4253399AE3574, 0x09F29B9060E5A, 0x09C535CC47DF2, 0x1558FE950827E, 0x3CF6AD6F0E856, 0x56E74849248A0, 0x433D14602496D, 0x61F74FEA6CA43 },
+    { 0x2C88551601F82, 0x0F6B75F6E403A, 0x4081D088D886C, 0x313EE115D6DEA, 0x5F0D4205CA960, 0x5FF25162A75BE, 0x748BF8C8DCB1A, 0x44AB06B655243 },
+    { 0x091DEAA211BE9, 0x6747C3501EB51, 0x114433DBD037A, 0x08BE6962697B1, 0x51327DBBA77E0, 0x74D153B86E0E2, 0x207460250CFB4, 0x215AAEE74BF21 },
+    { 0x7B73D566D9305, 0x16D37CADF2B7D, 0x0EC3A6E8D277E, 0x1687D6E9B1C84, 0x6E9E786169F25, 0x2878FB0E431EC, 0x0FE3165A55DFB, 0x2F6EAB3FF609D } },
+  { { 0x40DC35B2CCD6A, 0x0EBC95523E787, 0x7A9AF180FDDE7, 0x09A902451ACE8, 0x42DBE524EA218, 0x76A9B580A414A, 0x3B36996DD9F95, 0x5155648BE6F94 },
+    { 0x2EB76212FDA31, 0x4FAA1CF7366E4, 0x01A6FC604D257, 0x6AEEF7ADEB1E7, 0x5668ECC6E522C, 0x4BD19384CE4A8, 0x6071415EF8BA8, 0x046B39FD9DCF4 },
+    { 0x669E6BD4D5024, 0x4300F5BC4D7F7, 0x5BCB4067040A8, 0x16A8DDA4DC3E6, 0x4430A3166BBC3, 0x76E3AEDED209C, 0x2612A4226D744, 0x144C97DAEBFCF },
+    { 0x797B8C382A52D, 0x5D348C144F54E, 0x583303A7438EC, 0x12EA7F692E610, 0x2DFE630555294, 0x1DBB0AD8BC4EF, 0x14C9409F313C7, 0x35E4A12D3CFF1 },
+    { 0x45B6704CDE3D5, 0x66BC8D8CC4615, 0x7F78A427F02B0, 0x42A5E955F108F, 0x3ABC52466B19E, 0x63169EF0EAA84, 0x15C8D62619326, 0x476AEA31294B7 },
+    { 0x1DD07FC7E617C, 0x12FD817615C4A, 0x00938C028DB4C, 0x17CFC61EE2BDC, 0x2FF42D2D135C2, 0x175E7301A2003, 0x210BBDD354C23, 0x34784F3EE6512 } },
+  { { 0x4050A3753540F, 0x50686B33B2E94, 0x13F4DAB10F7DC, 0x7C106EFED4163, 0x4A7AD1F676E55, 0x31A7AA7E94875, 0x05FF1A4075568, 0x1FC289FD103F3 },
+    { 0x07B4AE8527D12, 0x55393ACEB2822, 0x77B0C8F157EF8, 0x2EA814791290A, 0x47D2BB98BCAF4, 0x653C2F33239C6, 0x3DFACF2053094, 0x7E805DCE09CEA },
+    { 0x5A066DCB2D70C, 0x0D34241A38024, 0x074242AD24B50, 0x073379DC5B610, 0x21B96C8AA8904, 0x2CB2B3B34BA62, 0x1D8616D0D1F75, 0x0E25B2543C425 },
+    { 0x16AE6922CD53C, 0x4DDB2F8104528, 0x7254AF76BE96C, 0x224B736A876CA, 0x7347362575564, 0x69E1BC8A37523, 0x29C10F18C9924, 0x11B521B8A49E4 },
+    { 0x294025FA6044B, 0x45BD9326817CD, 0x58ADDAB9AE261, 0x398409749DEE9, 0x3C855CBF0D6BB, 0x12FF5E500515E, 0x6CE749079E4D6, 0x0AAEC853F8BCB },
+    { 0x42F4510B5599F, 0x1D889E077F27F, 0x595693D01111D, 0x113DB63D0F831, 0x71D5AE241EE17, 0x1FE4205D226EA, 0x70E2A9386970E, 0x27223F844A384 } },
+  { { 0x560B0D700F86C, 0x05028758BC955, 0x552BD6EA67188, 0x7265D2B73CFE5, 0x232D3A5A58B06, 0x3019211697D28, 0x12DB72E4CBD08, 0x464539FF3A7BD },
+    { 0x09578AB985E07, 0x129BE37FF9BB1, 0x3BBE2A2E1948F, 0x6F1837E78BBB8, 0x79FE8EE84DE66, 0x47DD8D7784D9C, 0x0B93D63D83C5A, 0x0BE79BACBF05E },
+    { 0x5BB1CED998FF9, 0x23E171D626B4C, 0x528F9B81D1A7D, 0x0E5F2874B20E6, 0x5EF50D2E7FD91, 0x79F25A6F678D4, 0x54C6E08AA1A24, 0x636D4E0F15645 },
+    { 0x0C161CB9FE776, 0x2FE577874A7C1, 0x387D92C945957, 0x79C79759429C4, 0x0688BE3044F0F, 0x6842D0EE501DC, 0x542934B5A1374, 0x780CA30A39648 },
+    { 0x7DF6D0816C640, 0x4BDF59E24247D, 0x5918CE1B7AFD5, 0x32A0194AF25B9, 0x5716C93ABC6C7, 0x2A621E1BFD048, 0x0CBBF2988520C, 0x27D1B93FDC81F },
+    { 0x59F65281E78AD, 0x15CC75FA4D31E, 0x73FFDFD429847, 0x11BA3CF0FFEBF, 0x77FF2C8E0DE2C, 0x1FFEC5D020DD2, 0x7B3F3945946A7, 0x27F0E5DB74365 } },
+  { { 0x69D52FCA61C5A, 0x2B38FB7885ED3, 0x5DE2D4A341A24, 0x6040659CED9F0, 0x1C1D4BB95BCDA, 0x432E1158745E0, 0x415DAB8CFA4F0, 0x52D2550C32ADC },
+    { 0x57A72A95C96BF, 0x7B4E73C6B6D5A, 0x0179A616519A9, 0x5B5F3576BE414, 0x0C27245B3955E, 0x034658E2C9A6B, 0x2091198686113, 0x77156FAAE9CB0 },
+    { 0x39A78AA8AF59F, 0x00A4AF0FFF146, 0x70D76FB43F5C0, 0x22A3CE50C6599, 0x7A8DF80E9C17E, 0x2E08EA0B7E622, 0x068928680E2B7, 0x3F5575E8BCABF },
+    { 0x4F86545568E73, 0x6FC5720A37A2D, 0x7FE6F78C739FE, 0x6A0237CFF7883, 0x44CD5B25C5BE5, 0x047663BDF35F0, 0x7D200EDABF466, 0x001394C25273F },
+    { 0x52D04107F673A, 0x0AE60557CE8BD, 0x2B6BE927658EE, 0x6BB26BDEDA6E7, 0x37D479E6E1968, 0x6D5BFB46519B1, 0x2A330B75CEFDB, 0x53A1B97FAECE5 },
+    { 0x0B38D91C9BA65, 0x13772C1880B80, 0x45857704C1E98, 0x091C34A7A52E0, 0x4ADDC05B07E79, 0x27A00257982E0, 0x7825F954C3629, 0x2BBE5BB50D9F3 } },
+  { { 0x283AAD53CBB75, 0x4C5D96195DBC7, 0x01F5A941DD9C3, 0x67FEE4F6ACC1A, 0x474AD5A4D0DAF, 0x12C291F5D8B5A, 0x6D623BE743F79, 0x3A565B5629AA5 },
+    { 0x683D65212F044, 0x0488B4E3CE1C7, 0x5AC29758B61D8, 0x195FADBF80D18, 0x668CDA1524D3C, 0x22A2B71358C71, 0x242DCECE8B4CA, 0x4320CE197BEE7 },
+    { 0x13E2A8BF888B5, 0x0D92FCF665659, 0x7E92D04AB9A7A, 0x111E9D7E07328, 0x21EE6050DA511, 0x21B516DFF5275, 0x2C6EB41AB9648, 0x53B2A7BB2D629 },
+    { 0x6B2BCE81AA863, 0x0AFBB79036EA4, 0x1D744B90CFD39, 0x327B70792016C, 0x708C7FB05C628, 0x526AFC3170881, 0x6B89E69B10567, 0x1DF8B10C2F525 },
+    { 0x3A13C3B9169B9, 0x4C11CFC7CE574, 0x0FD1FC2D8A0F5, 0x384C59D61A6ED, 0x6DD416946B145, 0x1233F6C48942E, 0x7CAE22F58799A, 0x110EDAFE220E9 },
+    { 0x629EB98EACCBB, 0x0911B0500B25F, 0x1F87A3E2B01F0, 0x13BE7CEB584C5, 0x1CE3669C60C86, 0x2F57D86F28CCB, 0x501FB98988571, 0x2B3F76CAC4248 } },
+  { { 0x7B6F2C67068E2, 0x28993B8EB19DD, 0x1DC8D159FFE96, 0x78BAE6EE514F6, 0x1E6270EA99CE8, 0x2477A667AC3A0, 0x7AAE6C4F99196, 0x7190211ECE3BA },
+    { 0x77C8B80AC61E1, 0x672A71C3D387E, 0x7D0A5A9056917, 0x3A24BC9E1172B, 0x30B906D742E4F, 0x5B0D623E289B6, 0x1CE25E83E215D, 0x5AB35B8FC53D8 },
+    { 0x7AC87F74C8DE0, 0x706C315448C04, 0x45FD7AE16C313, 0x3E466E20802D6, 0x3BF3B15D1000D, 0x31ECC39903634, 0x5F620B7866564, 0x59337E7B38517 },
+    { 0x5D9E3CDE119DE, 0x62048328D1F2C, 0x1381706B21A04, 0x0EDCAFB7067A7, 0x709CADEFC268C, 0x5C8E6DA047635, 0x19693793F02F8, 0x39B67F526A804 },
+    { 0x69CB20C20E9D1, 0x332A3E53DED66, 0x2B1CC16D68394, 0x7322E5A863949, 0x3C21A874DEEBB, 0x792E88988209C, 0x75F6FE5E22E58, 0x6DC67FE7FF3F9 },
+    { 0x4934F894D4BD7, 0x10972DB360B8E, 0x4DC4BAE5A0E94, 0x145EEE84D6A8A, 0x01A8EA75D18F9, 0x1B847C175C809, 0x5FC1907C8DA3A, 0x197677A467497 } },
+  { { 0x627F8D6EFA412, 0x5A7987B17528C, 0x06195E7B5F886, 0x7EC1529ABD282, 0x2E089FF94978E, 0x4ED36D39E7C44, 0x57C83AD4C0AAA, 0x0B96322F8E263 },
+    { 0x1687B66B9D504, 0x6577FC3A9297D, 0x766BF86843C39, 0x73C13FC3D5AB2, 0x3A3C6F1A4F6AE, 0x3C4EC941741AB, 0x648A2AB64A94F, 0x3B6DD9332EB91 },
+    { 0x405B9E17B3BE1, 0x185D0854EF471, 0x3DC99AB586C81, 0x05604D9418A6E, 0x2BF4ED6CCE2DC, 0x576414DBFE5A8, 0x25FC8DF33022A, 0x57370F355ABF2 },
+    { 0x339777BD112A3, 0x3EFCE66A597C2, 0x23B86A55FFF1C, 0x14E1168A07F8F, 0x47D2BA4E12287, 0x24EEA67CA5CFA, 0x6683ECA340BD4, 0x11733FB1285B3 },
+    { 0x4D7848318F58B, 0x7513A8893EFD0, 0x2EEE9BF1D3711, 0x1E36D4096CEC6, 0x7F1E841183E0C, 0x1C01B0D6A7148, 0x292448DA7260C, 0x7B81F96B8090D },
+    { 0x32392F098387C, 0x08FCD67C0C772, 0x066423BCC3A72, 0x12394DDA69CFC, 0x50089459F9A55, 0x236B2584FE10D, 0x2FF883F5F9984, 0x38184A9E007C3 } },
+  { { 0x0EA87DDD07428, 0x117A6C0525199, 0x0DFBE26F423CE, 0x5306342CFFFB2, 0x630850D057640, 0x629E7D5694E5E, 0x0E0F2D527B5C8, 0x2B2178443B606 },
+    { 0x71A70D7CEF438, 0x24335E04335CF, 0x5FF2ADBD2F012, 0x0B97110F20DE2, 0x0412333590674, 0x760073D56A0E2, 0x3A9186D6513EB, 0x29A8B1D3CFA51 },
+    { 0x776B49999F5A0, 0x55789593C5388, 0x161AF1EB3CBB9, 0x05F435BBA61A1, 0x753F0A853E5E8, 0x6A551BA116FBF, 0x486AAB91F0C97, 0x0F566A31A9791 },
+    { 0x367B837EA7152, 0x5DB5B737B987A, 0x31A1A730D0226, 0x092A961981F2E, 0x2EAEE012BCC2A, 0x40D341EDCA14A, 0x3EE26CBE82AC6, 0x774DED1BB2E7A },
+    { 0x637D9DB6182BC, 0x77B194FD6BC5E, 0x1AEB0769FCA9A, 0x41C7B9BDB1BB2, 0x6AF2F918B943E, 0x55F7A36C704B9, 0x47CC96C8A1417, 0x6CABB6382CF3D },
+    { 0x13990A9F7E41A, 0x1157BB54FC61B, 0x1D8FD3C866B8F, 0x1DBFDB184B855, 0x2A4713DF0EE6C, 0x238C584331CF1, 0x68FA1A4F87BE3, 0x20F7108F00887 } },
+  { { 0x17C666CA9AF7F, 0x7EBCD1E8C55AA, 0x42045D690FBFC, 0x371F29DE4BE15, 0x104191B370911, 0x03CF7BE84ECB6, 0x69AFE161283AA, 0x60AD9C5908C5B },
+    { 0x1A4B9D031EAC8, 0x104283508FABA, 0x252EB1192FB71, 0x218B20014C0E9, 0x6B82036ED6D22, 0x142BA7556A05D, 0x6400F1B91E954, 0x0A145C0EFD848 },
+    { 0x7481FD9349B8E, 0x3CDEAA7785C3B, 0x0DB04018267B4, 0x6ED562B4481E8, 0x5994BE0E843C2, 0x5D1B73B8AA03F, 0x60627716DF9A6, 0x0195FC3A4C2B1 },
+    { 0x57038E0AA9175, 0x7A6618CB9C13C, 0x2057E5958613B, 0x6757D2B1E5BCB, 0x35D7B2C1DD5A7, 0x2D09A6F108474, 0x0A2923763227B, 0x197236EAE9631 },
+    { 0x1C7A900B24DDE, 0x5D36FB61ED004, 0x555BBF82E11B0, 0x381CA9FE214AC, 0x26D9497C497AF, 0x3A3535556BECB, 0x0BB60A2CD0AF1, 0x0E1EAA06E92B8 },
+    { 0x34E6B99E458FA, 0x1438E6E065AB5, 0x27E3A04202E88, 0x0A0985B3A27CD, 0x4F038E08540A6, 0x367262AF4525D, 0x55C07B757458F, 0x2F9F38DE2B98C } },
+  { { 0x0D7364062E2BF, 0x780B77CA58265, 0x1EC61C17A9446, 0x04F217F09090E, 0x4D6CCB9F4B321, 0x021AE95C03E80, 0x361634B313232, 0x083475F1313C8 },
+    { 0x7A808AB09A655, 0x7E8BB7AEDABFB, 0x40AAC9FE65ABD, 0x62BEA3FA5126F, 0x4DA0F03A712EF, 0x682DB30AA9D76, 0x13007AA40E855, 0x771A593EBEE68 },
+    { 0x5F901E3B4DE50, 0x39B66350F47E9, 0x40A77D52B4D49, 0x131A50E5C491B, 0x2DA5DA4BBE6B2, 0x4ADF287C39858, 0x4A610EE551A57, 0x400E61F7BD225 },
+    { 0x516CFF1BA3CB5, 0x0FCF056A6617B, 0x2E7BE5915ED03, 0x6CCDCD5A3818F, 0x70270362D6E25, 0x19C1CBF40CB1F, 0x5788909B6DB16, 0x353ABD7FBDD74 },
+    { 0x787EB5CA68AFF, 0x1D631F68B3C97, 0x418EA35163F34, 0x2C04EFFDAE709, 0x2300B42CC47EA, 0x2C241E6EE931C, 0x707D27E628252, 0x08DF8734FDC88 },
+    { 0x2B98F286298F9, 0x14A91F97F29C1, 0x18403DEA73F42, 0x17BD2B0A164AF, 0x11552FAE0BC31, 0x36ECFEE018245, 0x17DE24FC5CAC2, 0x1D692427CDF0D } },
+  { { 0x3689B63616A2D, 0x01A9F3AEF6B09, 0x182FF0033484C, 0x40988F9703329, 0x6D4C846E1582D, 0x5327556A9CF20, 0x3448666E0F032, 0x4A1438F05F3D7 },
+    { 0x12A67572A50F2, 0x0908B7B112593, 0x2D403B7779462, 0x3DB8B1CB68384, 0x2EE6A7039660C, 0x0E6AE5FD9FAA7, 0x147E00AF25639, 0x51E63E5195EFD },
+    { 0x411EE1E89E2A6, 0x7901A4853C411, 0x00E5CA28B47BA, 0x63877C2E5AF5D, 0x1CB21C5528264, 0x499736750B0E9, 0x579CCF2FF113D, 0x0A16F8C913951 },
+    { 0x269420D722B98, 0x3B8916316ABDD, 0x21E2AA71F9D92, 0x31A5A46CCB4FC, 0x5938E0845AD68, 0x1E703E1E317B9, 0x2B452A85FE67A, 0x7B2AE02601190 },
+    { 0x39C1B881FC0AF, 0x2FF7B6DB6ED88, 0x754D88C84624A, 0x35A46E84A5B56, 0x656E564591ACF, 0x476039B89EBF9, 0x2A7C3981A0296, 0x6EA6B96519CE5 },
+    { 0x75F13E28536EB, 0x0F06F6CBFEB33, 0x1E727DA0CC376, 0x16188469FA0A8, 0x2670283288811, 0x1C48CA58B61F0, 0x76CF7495076F7, 0x1B4C19FD931D0 } },
+  { { 0x3BEECD50C94B9, 0x167A4CD0327B7, 0x65683C409D6A2, 0x0CA274EAD74EF, 0x5DC32E05785AD, 0x2769B9A09BADA, 0x2B2B5FE88D2B2, 0x52A91FA0E154A },
+    { 0x0D3482277A6F5, 0x17B1D463E4048, 0x63B2561644F45, 0x6946969835FE5, 0x7F97668C057D4, 0x0A6CB6ED3D170, 0x75C1C42AE38E8, 0x2DF492F976042 },
+    { 0x1DC6EAD3ACA2D, 0x7B9B0EF7D3E2A, 0x4EB6284DF5A2C, 0x034753B4E1929, 0x2E8C173E2BE37, 0x736872D9A9145, 0x1AD996AB9150D, 0x3B0B978238219 },
+    { 0x0ED3AAA97A006, 0x4355E41A3EA0C, 0x17A4B69230A04, 0x6533C265F4AD2, 0x6B183D86A8E10, 0x204DDBFC60726, 0x100342F7BA3D1, 0x15917D51FAEF9 },
+    { 0x3BC4593D19400, 0x138E03C64DC44, 0x5D075E189FF44, 0x58DEEF222BF89, 0x5984C0F3F2518, 0x5F1DDDE629543, 0x2F877C46A12A2, 0x365FC9B641A8D },
+    { 0x2AEA18D3C561B, 0x1844631C566DD, 0x249F20DB39CFB, 0x08F15DBC24648, 0x5523F2F90D484, 0x18A622ECF07B2, 0x51FB6521B540F, 0x238C7733B4040 } },
+  { { 0x06185DB786AB5, 0x14A18B34DA658, 0x4E4B8E75252FB, 0x00B879C362792, 0x60857DB1B3759, 0x07871AA3A14AF, 0x7964F97BCE661, 0x18E422B653C56 },
+    { 0x1ADEDCC614C50, 0x6F746C1BB4450, 0x5EC0851E86FDA, 0x2BC1100F94BD2, 0x6794BCA82CD49, 0x19260A0143A97, 0x733FBC838C4BB, 0x28209949A8780 },
+    { 0x3D3F56DF6B1A8, 0x3DC3CC27FA49D, 0x304EFC0ED7486, 0x7611BC2FB9921, 0x1D312C5704702, 0x2F6EBBB96BC89, 0x5735BC1658147, 0x57F9FA045B1B0 },
+    { 0x108E82C0FB53F, 0x7DD5802A6D299, 0x7FBCB2FC8A6F0, 0x7F04ED8017FB0, 0x280294D1A8ACF, 0x420554BB98E8C, 0x7811C489F68C1, 0x2D644FA6138B1 },
+    { 0x4030797411FFC, 0x232373E462C08, 0x43C3168BF993C, 0x6CE1931E7E6EE, 0x24BE79E320C6F, 0x3337812B339B2, 0x42F5BEF35496F, 0x0DF6B9372A4D9 },
+    { 0x625A111D79D9B, 0x164119451608A, 0x41E857A606254, 0x0E46F03DD578F, 0x7439E5161C70A, 0x33B2E8C9BDDBE, 0x55DE4A780BA23, 0x1D8CC0FA14FAD } },
+  { { 0x4CE9BE82F69A6, 0x14ED81B2CAE7B, 0x2DF9536A2F7F7, 0x14E57BFC7A53A, 0x615529A4F8034, 0x67F98C6286952, 0x0CB841E5B9F75, 0x47E294554EBDA },
+    { 0x28C569EE9A62E, 0x774ACC0F1C001, 0x41CF03029E390, 0x76769F9AA2F7E, 0x6F2807B128B3E, 0x29D44A1F26B2B, 0x3CC8323DA2EC5, 0x2C00A0CD4F962 },
+    { 0x5F6969355223B, 0x02ADE99A8C3B8, 0x6378B3ADC66D8, 0x231DD8A5C78C9, 0x03804AB273149, 0x7BF7B595EAF03, 0x367D20C470CD8, 0x4A46D1911CD5A },
+    { 0x63574686F2009, 0x78A0D1E02FBE8, 0x0827D604F151B, 0x551C89020FAE8, 0x3431EAB068AEF, 0x75EC89E65D5B9, 0x6C2C7669651A8, 0x07E157BF34887 },
+    { 0x30CF2F02ACEEE, 0x74404856ECCC6, 0x0CA89A29FE345, 0x125827C40D6FE, 0x5865B47FDDD2B, 0x29C14C2DD68AB, 0x56D78775BBF18, 0x25EBD0825B2BC },
+    { 0x785551D9CA0F6, 0x1A50FECBD69A4, 0x48CA1F38A93D3, 0x12FEA2E4538C9, 0x79B3DC70C24B1, 0x34FB24A3D194F, 0x48576D396FB4F, 0x2BCD4832360A6 } },
+  { { 0x6F8A954A8E463, 0x49096FC9ECDA1, 0x497232711E264, 0x5E5B0C2AEB386, 0x01772AD722913, 0x5C99FF379DF0B, 0x29D03B1F209D0, 0x48F3CAE860292 },
+    { 0x4C6B45DD6310B, 0x4BECBD0C9FBB7, 0x7C94ECE5AC697, 0x7F4CE4983B001, 0x6F766A91DE13E, 0x7AD9E434B0920, 0x0EBAF4D419100, 0x423C1920C0CF9 },
+    { 0x7DEC1B5B667F7, 0x5D1C49FB48289, 0x7505DBD32CDBC, 0x00847AF3FDB79, 0x1D77E72E54F90, 0x6BFBF40BE3412, 0x1A824A09D9AF1, 0x25CB3D276E71F },
+    { 0x526D63FFCF47C, 0x5CFF8D7650C5E, 0x5CACB313E6B9E, 0x2912418FC78E5, 0x0D0F7C17387BA, 0x63B79806F9A6B, 0x4F8B50793FAEC, 0x0AABF5E567AA2 },
+    { 0x2BE33CA93F6EE, 0x11294A81F58E7, 0x7BB1F365CCA4B, 0x0920594034D3D, 0x7033711F63639, 0x4F99FB10F0AAE, 0x6FF0408E918EE, 0x342A8BD86F9DD },
+    { 0x1E5AD116949EA, 0x0538891AEEDA6, 0x2223514A3A20D, 0x110C51B7016D4, 0x394DE196F9588, 0x2A83CAC47C277, 0x15C649708A3EC, 0x16E547529F75F } },
+  { { 0x283B487339A83, 0x0373D40430BD5, 0x0DDF8F83DADC7, 0x2B95B5376E8FB, 0x3C0EDF8D800DD, 0x6D6F4DE1CF882, 0x4E5BA1CBAFE99, 0x3AE1FA7F60850 },
+    { 0x77BFF2001D7C4, 0x0C76A956C15AA, 0x307F79EF5DDF2, 0x330FBF92DAEC1, 0x0BBA29E9604D2, 0x4992E92C2DA9E, 0x19A95D1DC3572, 0x6CDBAD4C35322 },
+    { 0x4662B6DC8DC5B, 0x43BB58F1494F3, 0x39D7042715526, 0x219DEEA573731, 0x114896CCDB55D, 0x6E9EC62FEC535, 0x5E8DFA3C80E9B, 0x776731A03E028 },
+    { 0x65A80B1106EB6, 0x0CE2893146617, 0x65E7B1F8D1CED, 0x3BD5540F2A7A6, 0x64AF056405D21, 0x26F9153A0C0B2, 0x7FC00AA706822, 0x68BD8A137C1AC },
+    { 0x5FB0F71928D0E, 0x33371C1CBFEC9, 0x624DBB6CB0F40, 0x09A4CC2BAF2E3, 0x0867613BC3454, 0x6B72AC01907F4, 0x0849AF1B078CE, 0x28A381BC30594 },
+    { 0x497EBE24F7D60, 0x14B27E1645D23, 0x0788F040137EB, 0x1407B1BE2CBB7, 0x731F6070C517D, 0x35125A2F43F97, 0x4E69FEBA87E81, 0x36FEE0634A759 } },
+  { { 0x116E0BB672F9E, 0x77CA99EECF9E2, 0x1B2C0F142C267, 0x5478A27E492F7, 0x2733E14D444FA, 0x7B59575F6DE00, 0x5FAD792F8DABD, 0x387D6C51BDC6F },
+    { 0x6D003522447F8, 0x59D8E6A0CD18C, 0x6B3AF304F26E2, 0x088AAFF1AB600, 0x512EBB1412C76, 0x6C07F73493205, 0x007F33037E316, 0x2852AD3CB2C76 },
+    { 0x3DDA9C63774DB, 0x2A5F6E8F6080E, 0x4C6C0FABA8371, 0x63D70EADF1DEC, 0x51AA9AD83F771, 0x78185B983215A, 0x48C42398092E0, 0x7ACA6D0806400 },
+    { 0x3BBA84A3AD9F2, 0x0CF08009DB650, 0x4C746FF3BF4B9, 0x2B88FF8EEB278, 0x064C4FD08411C, 0x373939000B72C, 0x6A4C0479B7BD6, 0x692B43AA1DFFE },
+    { 0x7A589953B6789, 0x2C69B8B6E41BA, 0x157A197A4C057, 0x61F296B730F79, 0x327FB87098730, 0x27359E93B6558, 0x2563A4E189453, 0x68AD4FE67A808 },
+    { 0x3AC215A093C61, 0x02FB4F8B13302, 0x3A0EA20FFD39C, 0x02DA6F8A017E7, 0x26BE01B5F866E, 0x29B10BE06F2DB, 0x64C1BB7E311BB, 0x26E36905F5BD1 } },
+  { { 0x38E6A5A0E3D91, 0x630FA4DC791DC, 0x0E7F2A3FE037E, 0x73995B1E7E7BF, 0x4B1E9341A4DBF, 0x024F76ED3F47A, 0x593C6BADAB20C, 0x2922837D59DA3 },
+    { 0x7CB65AEC27060, 0x260866561348D, 0x4819F86B2830D, 0x1057E4CB043C2, 0x32E7F28AEE64A, 0x49651A5A404A1, 0x6CDF49B95A745, 0x6489783B87C30 },
+    { 0x35C860DC704C1, 0x04F11F7AF385A, 0x14205DFEAC308, 0x4E266E8E44AA8, 0x52013179B380C, 0x1A65B89C9D0AD, 0x7205A9F4ECE59, 0x642E092703E94 },
+    { 0x5A255EB73E849, 0x2B3FA2B9B1921, 0x13C3B008BB3B4, 0x3981419D7BAC9, 0x48CA194F4E913, 0x588B1D7722BA1, 0x206307B76A9B9, 0x5FD798FF76A62 },
+    { 0x315C78B395E20, 0x76AAC4F88185B, 0x24360761113EA, 0x6CE36EC95F0E2, 0x33965F415179D, 0x47D4D214A6240, 0x38208642CE85C, 0x27E131BF9B7ED },
+    { 0x516B3810BAA62, 0x13B87B8B70313, 0x305C75CA03253, 0x01FBCC94E7FD4, 0x37DE55B1FA9FF, 0x2EC9F387415DB, 0x6526EDB44ED84, 0x28584E414D110 } },
+  { { 0x40E5234663EBE, 0x31EE25FB906D3, 0x603446856ECD9, 0x5E70646FF5F16, 0x53950098B2B16, 0x3559ACEB4CB58, 0x007202D3A0943, 0x4CAF2A17CD92C },
+    { 0x205269D202FCB, 0x7D1D28FBE0246, 0x5F318462EC003, 0x73385A89649CB, 0x089C8723FD6BA, 0x075AB30039D46, 0x02CC4AF28885B, 0x3D7CB3107E171 },
+    { 0x5F498E4459CD4, 0x69834D93E9AAE, 0x6DCF017A78C63, 0x41085FCFC432E, 0x21492947E10C2, 0x4105FB5564343, 0x54A2D9A34F115, 0x49715F3EED477 },
+    { 0x310A7E6E9D4CE, 0x5ECBB80A557EE, 0x56242026FC9D5, 0x53EE666B3B90E, 0x28420B4319D30, 0x40166C3B05939, 0x77F9B959E6C8C, 0x4C11E6C491A4B },
+    { 0x17FBE80618308, 0x6734DF2F628B9, 0x2884C745719EB, 0x2BBEAF93A5A79, 0x173F35ED6CEA2, 0x1C7BB2D8EC320, 0x274763D9AC864, 0x7476A36EF87CA },
+    { 0x41C0E834CD2FE, 0x1D62639583E1D, 0x48BB99CAF29F4, 0x14E18F4834764, 0x3B5FEB043F15D, 0x2CBBAE0FF25F0, 0x79D0E8CCD0BDE, 0x393AC05E620DA } },
+  { { 0x2C0684A28648A, 0x5E042FA54BB18, 0x34B19AE1C0DD2, 0x0CCB5DDD76857, 0x377766B92577C, 0x06299CAA724D1, 0x5523122D74534, 0x78F56126505F4 },
+    { 0x2A1478EFA06AE, 0x29DD3904332B9, 0x3B7C324A143F5, 0x708F9E02A285D, 0x42C2FDC59C616, 0x2C5E11928DADC, 0x50B9B79B7ACCE, 0x6AFB11376F110 },
+    { 0x6E43E933D3CCE, 0x724742841DC6C, 0x379738E3AE483, 0x7E982B99EFD49, 0x3FCF38B09D036, 0x4632F9713D744, 0x31CBEF9F8FAA3, 0x2E94AA2891437 },
+    { 0x70597E9F430A5, 0x531534A9C5AB5, 0x300FD5C62E191, 0x3885CF9A86599, 0x49BD6B9AC0F53, 0x667C2DDA1080D, 0x451D2C6167D6A, 0x342309A47CB4A },
+    { 0x7E8EE9C033BF5, 0x479E7AB7E3A58, 0x220E63496E474, 0x0B8B7B45B2ED3, 0x20C830BCDD4ED, 0x024925937E2DB, 0x09F018E1922F9, 0x3484EE5CC8540 },
+    { 0x413245978AAFA, 0x10EF4DFAB38F6, 0x24AE71E1F68B4, 0x1A87EFA31DA0C, 0x2253153A1ED3C, 0x32F795364C46A, 0x710B935EB9E62, 0x2588B3C6A1963 } },
+  { { 0x301CB48C715AD, 0x7E48D134752C2, 0x1F6DDC597C9D1, 0x005BBA56EE778, 0x34F1D2035D097, 0x322DADFB6A169, 0x3FD7F6D0E9BA7, 0x401DDD3478FDB },
+    { 0x3C1B61738567D, 0x54DD05A1786EC, 0x47C7BE3A6006C, 0x474EE6152F4A5, 0x266F6C3D2B497, 0x0E75DF2EF15B2, 0x62E85BEF4E773, 0x0531CC3A9139F },
+    { 0x3A29C52D95B1E, 0x75CDD9B1BFAB8, 0x55FB063D49B54, 0x1B590CB714870, 0x245A868410FAB, 0x53F11A9A31E2F, 0x48502B27285EA, 0x5EFA0DB37EB7F },
+    { 0x5E1FCBAF3A105, 0x0A7B2919963C4, 0x20C9EB6BB701B, 0x054D309B229C5, 0x10776F04C8464, 0x304743D5711A8, 0x74638F2A41E67, 0x5AACE409C85C6 },
+    { 0x55FE83F74A2CE, 0x7A29DEF9E92AC, 0x1E9811896285E, 0x3DE15C8F005DD, 0x1547A09F0C960, 0x14DF21004DD02, 0x6FAF19AFFFE83, 0x0DA8D2924BE8E },
+    { 0x32E6C4E28B3E4, 0x18233DBD3BAD9, 0x0871944C65838, 0x16B5BC144328A, 0x1F01CE2622E95, 0x312076CA37D69, 0x1BA41108BE021, 0x1DA429CF16B3C } },
+  { { 0x206BBE3A5DD91, 0x11DD6C62256A6, 0x77946469B48B0, 0x470B2FD5573D0, 0x0016593C99C53, 0x6BC0204EE7F3C, 0x2AAE2C325E956, 0x13A0EC90C6B8B },
+    { 0x30C41AD99D200, 0x169F32646B8A4, 0x16E8DB1EF246E, 0x001CD8391C6DA, 0x5608F2A7CF10E, 0x695ED2B60182F, 0x70B784DEE7515, 0x41E527BAA6AA0 },
+    { 0x74EA1A85A27B1, 0x32BA0AA588E7F, 0x28F6681413A9D, 0x529C4A4FA27B3, 0x2D2D13856039D, 0x482758ECFD3ED, 0x4CAAAF9B19FC3, 0x0E5ECACA1FCD3 },
+    { 0x2B580833BC042, 0x7F56DAFA00DEA, 0x666E8B282BDE1, 0x40D4A384F5E2C, 0x0A1AF838566AF, 0x13D7360FDE86E, 0x392566761E5DF, 0x557FC6FA55965 },
+    { 0x3CA29B92612AB, 0x18DEC432D78E4, 0x56DD834688255, 0x32BC4B03B86A5, 0x60A4A0011B6DA, 0x6C757111947CB, 0x46A01767350F7, 0x48029FD0F182B },
+    { 0x0CAE502899516, 0x1C9FB5B480052, 0x3359BC783FAC3, 0x0F4A204E708BB, 0x2C8D376C93C03, 0x23F9817F97CF0, 0x5DDBBA5934C27, 0x34F7F39C9BC15 } },
+  { { 0x470B698656970, 0x15222B106F140, 0x688CC7A78336A, 0x64CEC8E44BC38, 0x57EB3C3C9DD5A, 0x653D927E817A1, 0x0BE8C8C525844, 0x6AAE6C2F0CC51 },
+    { 0x1A837099CFFC3, 0x14B562FF513C7, 0x4980800C08133, 0x26D43C5AFA6B3, 0x56A48121018B1, 0x60C473B03441C, 0x0D316C5F3FEF1, 0x692B659B3B216 },
+    { 0x539BE96BB4665, 0x33D9ADB6024BE, 0x7CD4D9ACEFC91, 0x476C78998226E, 0x289BA06B7DF65, 0x24376AA502FEE, 0x0D3A6D81237F8, 0x0B28648C39634 },
+    { 0x40355135B0342, 0x18E1273C003CC, 0x2BF7A8AC80F9B, 0x2FD9D7AED65AD, 0x2209D65653C71, 0x6C1DDCCC5E5D7, 0x01AC8613485DC, 0x5BED62CEA9C48 },
+    { 0x7C51B9D228686, 0x108634BC3E12D, 0x6BE7CA8669DF4, 0x3786CBB8108B2, 0x51CE67C264504, 0x09B76E0FD8B48, 0x3D218BAEFDA14, 0x65D20C2DCED5D },
+    { 0x04CB06E8102A5, 0x0CCCD01860027, 0x28FD553B9B2F2, 0x2431BA33ACD21, 0x4D86790B9F7A2, 0x30750EBDD6E68, 0x55FAE6E5F0BE1, 0x29E8515F55044 } },
+  { { 0x7D1D0D51B2256, 0x2BCAE08DAFFD6, 0x1B0BEFD16B938, 0x78CBB4CC5B7D0, 0x5A8F2DF805C14, 0x55CA35E24467C, 0x20404B8F2F73C, 0x211CE8F96335C },
+    { 0x7C5C2254C0B61, 0x1CD92B7FA4CF1, 0x4630CCC2520B2, 0x7040B0231CA6A, 0x273804647F8AF, 0x164C1A19D1E9F, 0x4F708147777B2, 0x70F4484F0DB7A },
+    { 0x5430921CE5FB4, 0x3950042B7BCFA, 0x31D31C9D82B34, 0x4A0F86DCD02D6, 0x7AE8FC9A91AD9, 0x12CFD0AB96CEA, 0x00EA086A08D3E, 0x36B4A7683E47F },
+    { 0x0BFCEA87DA84B, 0x39FFF9FBD6CEF, 0x72932642493AF, 0x43E068AD390EE, 0x4ECB4164282CB, 0x1E8C0071C921D, 0x611465ADC1EA9, 0x738FC4F18FD0C },
+    { 0x0003D6AC27898, 0x2509B2BFC05EE, 0x06099BBC8ECD0, 0x451ABC036AA86, 0x3EFDD10CBA0D5, 0x1AF552747C074, 0x300946A43B19C, 0x255C6365F1368 },
+    { 0x12EDF60AA864B, 0x181BE39751FC4, 0x13A6A900AF06C, 0x162D1F1D24AF2, 0x56158CCE2CBC5, 0x24D49AB302B2C, 0x19D633D2DA08C, 0x2F294FFCCA4E9 } },
+  { { 0x5A1EB63A0AC7B, 0x2FA6F53022011, 0x6B8C0BF755FCD, 0x4F1A7285CD35E, 0x6D3A9B3D005FF, 0x419336CFFD978, 0x66E95F2DC43D1, 0x5C5A5D728619C },
+    { 0x1643F01AC1309, 0x5C9F15381525C, 0x73EBC0F282FB6, 0x183C2BEFF8F7F, 0x1405C65AC82F9, 0x24A539138DB87, 0x38A8314CE3197, 0x37ECFEBB0AF35 },
+    { 0x3BF421ECB9824, 0x1695C2033DD4F, 0x0F8BA3076ED4D, 0x2721C1829CF10, 0x0D5FEEA3F6789, 0x564AF9C18536C, 0x3277862C03DD7, 0x6811378F99C07 },
+    { 0x66AAB18FFE06B, 0x65EC68F734513, 0x5BA8CE3E3C639, 0x4F89369FB8810, 0x2786CBA961330, 0x43B7F0D4173D6, 0x3AAF7DE852106, 0x369A316D9CF4A },
+    { 0x60B1A3ED01761, 0x62917E101CBC0, 0x0068ADF2EAC9B, 0x3F95D3F8C1B54, 0x372B7A7F6793C, 0x45D17563F0DE6, 0x64F83B1F54770, 0x2CB8FBDB333A3 },
+    { 0x33E62C9863468, 0x1E216E2B86C22, 0x273F4C805C617, 0x111E764DBEBD9, 0x717DFB205FCD7, 0x298E7A481918A, 0x1C3222A34A6E9, 0x37FFE352AAE7B } },
+  { { 0x2090BE2FF2126, 0x17D2F17375350, 0x3AF766374D892, 0x3008FD2B4E421, 0x3AC62ECAD1B0E, 0x00147B57D0525, 0x5A1C3B915A660, 0x26CE233D1142E },
+    { 0x70A6E91E82BD1, 0x1209810C6D397, 0x4FE3B4156C9FA, 0x6647C2C59794E, 0x25A8A26E1AEDC, 0x410CE02F5139F, 0x177363760EEC8, 0x78097EE24BFBB },
+    { 0x0E2DA5EF72516, 0x70341CD5CCE89, 0x7C2FBEAB2BB8B, 0x26E6D1EC274A6, 0x3E2468FFEE6F1, 0x4575473EFBCB1, 0x0FEBEEAD2FEAD, 0x08E5DF60549F1 },
+    { 0x667C93C3E2377, 0x67E138A37D17F, 0x4DA5901BF4126, 0x77D2CA55A8F91, 0x25AFAEFC400E4, 0x1279502B291A4, 0x409B5B15B6C6E, 0x45E586E8FD09E },
+    { 0x6F7A40EB15D0F, 0x25C03EFD91A96, 0x6A2D05F1B60DD, 0x30646C50514EF, 0x783F8AAABFE40, 0x1748BB3010098, 0x4EB12C118DEF3, 0x17DD426E9BEF8 },
+    { 0x1419CC2475B07, 0x133E86841E6B7, 0x47BCFA9A88862, 0x1C5FD404654F7, 0x28C5A1298F52E, 0x21E64BAED0B17, 0x245A9E5A936BD, 0x3236CDF09F779 } },
+  { { 0x75768A119F195, 0x346541114E083, 0x48932077A8B87, 0x557B55EA4E7A3, 0x49BF74995F009, 0x6A7C028A6AC21, 0x4E26EE310435B, 0x18896A6DB99BD },
+    { 0x0049F75AFFE6F, 0x158607BE4F19F, 0x12A4738920117, 0x206B820A20E7C, 0x5EBC32276B229, 0x34235C4E2ED0C, 0x1F7E44362BA6E, 0x7F09803F95707 },
+    { 0x18EFBBC1F3760, 0x11DE813112945, 0x00DC598907B96, 0x673013EC623A6, 0x66D51B6EB818B, 0x3356970E7125F, 0x59F6F0BB574F1, 0x46DF7D2A12822 },
+    { 0x39D5C1AA43C3F, 0x739908845D522, 0x50708C8145CF9, 0x631D00CDD5BF4, 0x0EE168B2C7F5F, 0x423A30DAE8A81, 0x20EA5FE7682D6, 0x2A79774002973 },
+    { 0x2B2C87C19A710, 0x2F1FC0E1C18AB, 0x5980507636611, 0x44554D8508F86, 0x1334936955F4B, 0x79D299BCD27F7, 0x6448EC591A099, 0x4E378F8DC3753 },
+    { 0x2E98282E4E220, 0x0E07435157978, 0x78812967B7754, 0x14928D7DAD5DF, 0x452124EBAF966, 0x273A24057E941, 0x18C7906AE8FAE, 0x363E4DCD1941D } },
+  { { 0x4E8D6ACF2E260, 0x153D6E82BB1FB, 0x037D39BDC2D73, 0x01CC82DACF398, 0x13A34BD05FCA0, 0x077779CE5927B, 0x217D3B98A49A1, 0x4C5715D0D054C },
+    { 0x4273F93218F90, 0x0AF986C962015, 0x1271BB357056D, 0x3208A36F93050, 0x24D131AA8BB21, 0x66D53DED8930B, 0x1A73AD2CFF37C, 0x149881C82797F },
+    { 0x44AB3E510B645, 0x3F28E91D5CD91, 0x4706A4368BF49, 0x7EF0342DCDC5C, 0x70CCCABBED253, 0x1CA069E9D50FE, 0x3B137C4D03E6F, 0x26FECD38BF7F2 },
+    { 0x24BD9AA1900ED, 0x1B971DC7A9581, 0x3F386B6BE3091, 0x37E9EE5032DD8, 0x4BA5A45C4E190, 0x6A298EC471E8A, 0x7066AC93956EB, 0x13FC9B18F0392 },
+    { 0x225CFF4F1B13E, 0x21A0E4578B0AB, 0x591E7BCE6281C, 0x16C34CEEC54F0, 0x653011F22FD04, 0x19E243607705E, 0x4BFB6597B8FF7, 0x67C792F263C40 },
+    { 0x16A6CD52E7DD3, 0x020263CB4705B, 0x074B0B3DE45DD, 0x06114183A29D7, 0x72B125F69D8B9, 0x267691F9F00E1, 0x1FC5A4455DF7B, 0x25F30A67270B0 } },
+  { { 0x19813CC2BF68D, 0x61C6E908F47AA, 0x23CC31C46DA33, 0x3543A322CB621, 0x4C532FF12E00D, 0x66E346458050B, 0x18BDADCB9C2CB, 0x69506D45331E6 },
+    { 0x6F46C1728DCA0, 0x687F27CBC8BDA, 0x5B7CB1B78F463, 0x4577F037398F8, 0x570F4949EE5F5, 0x45CC356F1731B, 0x12BBB1A851666, 0x509A4D82C1054 },
+    { 0x1F5B2AE743BCC, 0x5DD2F96D54B67, 0x630404652CC81, 0x79A70B69F7D1E, 0x55194295DEAD9, 0x46ADADB1A24DF, 0x019B812B78C76, 0x4AE2DB5D69A77 },
+    { 0x438A2D01954AD, 0x0875A4ABA02E9, 0x0BB91E0B9E94E, 0x2AA0AD90A6F58, 0x7B6CA3BC98AF6, 0x7F5EEB749E9F0, 0x0A63B008A9965, 0x6468A01F23BE0 },
+    { 0x5149803B32B3C, 0x0BBF3B0FF9DB9, 0x0DF79681F031A, 0x7521E27C4D859, 0x59826C7496E25, 0x4A85BE91F7BD6, 0x369F2FBF32101, 0x10C1ED502A30A },
+    { 0x552CF00EB08FB, 0x082914B46241E, 0x25E5578A481B8, 0x14D8FB07DF814, 0x7BC6A11200643, 0x2E3FABA1C6CC7, 0x38FB7D529C0AB, 0x261E7B74CC752 } },
+  { { 0x24468D7A1A697, 0x208FDB64867E9, 0x74CF03A44012C, 0x7E3B601860F98, 0x5E16082BADEA3, 0x53EA799D738CA, 0x07621519F8D78, 0x2E731CB8DF767 },
+    { 0x6D19A82BA16D8, 0x413B7C18F787C, 0x378AFCD766F65, 0x61CAC48410AC8, 0x2CE049DAFB70B, 0x084ED89689FD8, 0x19F504ECD9E56, 0x0480253DE1800 },
+    { 0x0B4E89E202975, 0x1511FAE59E783, 0x374E6631044DA, 0x30C94A5C04652, 0x12DB93B4A159A, 0x327870DC21C8F, 0x1444699A7196A, 0x06D779D4027AA },
+    { 0x4AB785360566F, 0x629CEE0B7C089, 0x4A858EF045F09, 0x413D7ACAA0A99, 0x4D1C2F2C851E5, 0x751F4139C83A9, 0x78D5C74A3C581, 0x60545B2898716 },
+    { 0x07AD9D9057DC8, 0x52EB8693FB11F, 0x399CE7350B976, 0x4DC9CB526D10A, 0x77BD0491A2F94, 0x21E68E1AA7861, 0x04CB009BE7D5B, 0x0B512FCD12714 },
+    { 0x0813C0241CAD5, 0x18CB886715FB8, 0x5503D5D6A2B34, 0x0B9035BB8C32A, 0x1C799DDC9BA63, 0x2404AEF301338, 0x63E25465223CD, 0x26FFD613240A4 } },
+  { { 0x2570CFD4FCF7F, 0x7DC8ED6D0BD71, 0x680888EA643FD, 0x76CA58AF50801, 0x2F586D65331E9, 0x49ADDCFA24DB9, 0x2700F2B0D3989, 0x4CE9CC896CA96 },
+    { 0x344D1351C9666, 0x6EC2CAD0238C8, 0x485BA2F8A74B0, 0x14962C06CB43A, 0x0B18E7FE49B74, 0x1B7FA079A75E6, 0x25AAE31B19755, 0x770D4FA8D6DCC },
+    { 0x24BB37375C212, 0x05A41A689C96E, 0x305ADAFEC27DA, 0x24C183D86036E, 0x24E7F578372F4, 0x2788FE920C814, 0x72A849D378050, 0x60D74292054DA },
+    { 0x561525948D638, 0x1A89CBC3CCA32, 0x34D034CFF6612, 0x3228E394DBA55, 0x24C874D752535, 0x4AD6903EC1BAF, 0x2FC82AF9EA286, 0x51772CA27B3A5 },
+    { 0x23CA76F7ABE1C, 0x526A431251FF8, 0x6B184F7A61E1C, 0x673332B4D1194, 0x5DDCDA4479927, 0x322C438235F1A, 0x5496C67EE70B0, 0x45619760CE224 },
+    { 0x447F77B257E42, 0x142D118913664, 0x3F4926307FA11, 0x10942E58893D2, 0x5140EBDFC32CF, 0x26A6FB992A72A, 0x636141306EAFA, 0x32ABDC05560F6 } },
+  { { 0x59887169806C8, 0x26842A0C99589, 0x2C7D3D8C503D2, 0x4C250794ACBE4, 0x4C1AD1B187D9A, 0x3D84925C148A7, 0x3DAF0C86025E8, 0x02E7013BBB1A8 },
+    { 0x1CEBB4507EAF7, 0x533708BE99F01, 0x064FF68DA50E8, 0x3BA969D29D486, 0x66CB1433F2E3D, 0x4594D6669C4E4, 0x3356A973FC7CD, 0x0F0F8F65A0BC2 },
+    { 0x6A38BB07B07AA, 0x5E6BDB64BD621, 0x09EE8937317E3, 0x09975BD135497, 0x6878A987C2A86, 0x482E7ACBB85AF, 0x6E8A7FC2E40E3, 0x1CD55EFBC17C2 },
+    { 0x2FBC6B9086056, 0x3003F781D7C4A, 0x19147517169E3, 0x5F7D2C1CD7A3B, 0x5AB92B7DFE0F2, 0x130F7758833DA, 0x4BA34BF450B37, 0x73B201443576B },
+    { 0x688670CCDE5AC, 0x459D14A062152, 0x0378F4F45ABB3, 0x4835E2162DF1D, 0x0A33BC5F99EF5, 0x5125ACF83334A, 0x1318D3C80CB58, 0x1F9BA31BF5543 },
+    { 0x4406E15336AC9, 0x1F2D780F5B40C, 0x14E7431A98144, 0x13098820B7F6A, 0x1C62B62890FC8, 0x245FAEF5E224E, 0x3A578903EA091, 0x24DD6B429EC7A } },
+  { { 0x51BDFEDC5745F, 0x4364905864A6A, 0x157821AABC5BC, 0x0C6EEB7B927A6, 0x4E048C426B6E5, 0x621FD7018ADA8, 0x5C566BC6C072E, 0x4F9E0E8696327 },
+    { 0x25893816ED67C, 0x557EE2135BE3D, 0x4575DE750C7C2, 0x37C745131DEEA, 0x218F494F425AC, 0x78CC2B7F8EA37, 0x79CCDBBFC3760, 0x5CC61A188A77F },
+    { 0x685C5C310A93D, 0x6141F4B7C28C9, 0x444E014A9093D, 0x007B82293572F, 0x44A603F5DA1CF, 0x263A0EC45DAB0, 0x64233EAC2989A, 0x2DD8E55FB9D8D },
+    { 0x7CD784AEB47DB, 0x7F63676FE5E6B, 0x71937CCAF2211, 0x5EBFA04F99B43, 0x086A6EE216168, 0x4C3B256525CA1, 0x4B42BC180E80B, 0x128F74AB99A31 },
+    { 0x0F0941487675B, 0x01092B0D432C1, 0x390BDD8F0BE0B, 0x53109EC51975D, 0x0F2A50FFE1C3B, 0x65C10A87F1DA4, 0x04397C92C363C, 0x31A16FD6D7E04 },
+    { 0x40589A14C0114, 0x0C00B86340450, 0x7766C285BDFC2, 0x09C09F060E2FA, 0x0275C619C3418, 0x28A72B294BE6D, 0x18475CA61F3A5, 0x22D89D816659C } },
+  { { 0x21E225458B735, 0x5C04A896B9261, 0x3D84E632A8DE7, 0x5A3B204E8810E, 0x71B3B55D8595D, 0x46C750DC3FF55, 0x3885151D4A9F1, 0x4D5C17742DC58 },
+    { 0x3DBB2A97019E0, 0x15544DCC30417, 0x3B2288978B7ED, 0x6BD97455B4984, 0x1DA3E3D996F28, 0x079733606972A, 0x6A711B37FC2A6, 0x7697D4AFE3259 },
+    { 0x24DD97D157337, 0x0C55F59321123, 0x335F08EFA306E, 0x767F7AFB26CF1, 0x538D336662D58, 0x2DD010830932A, 0x141CA70C22C78, 0x65C90A7B18A01 },
+    { 0x36BF9C3315BA3, 0x6867BBA92AA8A, 0x663BB3CD2BA51, 0x35986908BF09A, 0x06A16A12F55EC, 0x1C4B25CAF2BB2, 0x39735CDE477B5, 0x257F61684789A },
+    { 0x536FCC1DB37CF, 0x45B2833DA8956, 0x29465FD0C471B, 0x1E78C36A1718F, 0x3BB24FC1C3270, 0x1D391C4BA808A, 0x5F501A5DE664B, 0x24B093401FD4A },
+    { 0x2C819C376C8BC, 0x1406A3029DC21, 0x2BAE373645087, 0x167FB0BBA3AD5, 0x439AD8AF339DF, 0x16A360BF1CE79, 0x26F0C627D5C8E, 0x2DD2169711D93 } },
+  { { 0x65185B77FBB26, 0x0A3853E46C533, 0x5DC58C9A09402, 0x2BB48E92477DC, 0x459EA7C415B08, 0x5569A9E4C0B8E, 0x11DD072A628BA, 0x5DEC17C2DE997 },
+    { 0x4CF18BC7E1D59, 0x0FF4A5BC88778, 0x4F7EC6188D8D1, 0x7361318C5AAA0, 0x24760457F1C86, 0x28EC00121C0B8, 0x588CAEEF58EDF, 0x5E2BE720CC9AF },
+    { 0x207AC02932B8C, 0x60045A9F475E6, 0x787970718D3E5, 0x0C7A9BC11C5AE, 0x3785DC203E0E8, 0x21372D122F7E2, 0x2C66C4D4B257F, 0x1E3D1C7B796B7 },
+    { 0x7D9ACC0086915, 0x2E5A0433A35A6, 0x37E01FFE14C15, 0x14296A24F81A4, 0x07BA1DFAE880B, 0x5DA01B517546B, 0x7B7DB80314D01, 0x0FE1F0A9660C0 },
+    { 0x352965885190E, 0x004DB14B8AD0C, 0x5762F9616F19D, 0x7E6C2B0F9CE02, 0x42E2D28CE82A9, 0x79745FBC1E121, 0x3C58FF7A15F7E, 0x77D9512819E2C },
+    { 0x7588053D51790, 0x124D0ECA6C67E, 0x177B25039989A, 0x1367AA22B8F57, 0x5A3655102BD65, 0x33435C803805C, 0x77927F3AC8E2F, 0x2D692862BF37C } },
+  { { 0x0200FE639B1D3, 0x14D578AA588A8, 0x52EEE1749BA67, 0x32638679EC608, 0x00E6722D25E47, 0x78DA025C0D55C, 0x38999915041A3, 0x3A0C6EFC06AF0 },
+    { 0x48AB5CF02F3D6, 0x31561C8F45187, 0x7B0DE904AB007, 0x3AB46AC969011, 0x72A3A769DC289, 0x4DB22CB7B10C8, 0x6B32B91B0BC9D, 0x77A87353CF38C },
+    { 0x1351C7AF3501A, 0x262BD368CB9C4, 0x504AAFE86BAB4, 0x64F8E98E1BED3, 0x0E835AB0ECF51, 0x51BEC2AE1EA04, 0x22A2283200EB0, 0x7D94578A8799F },
+    { 0x2DE29335CAB48, 0x601FF0BD6F63C, 0x12B827CE00100, 0x120BE0DE55E36, 0x18C5E92F7DA03, 0x7D99EED158A06, 0x7296C89E6BE84, 0x71124A8D77C75 },
+    { 0x22DC61510E038, 0x75A07AA5856DA, 0x00A674F42D9F0, 0x2C2438FC6052F, 0x215254CE18ABE, 0x726AA8B81AA17, 0x30CE1DC0CC826, 0x34FB31A2715A8 },
+    { 0x4184444F487A1, 0x13AF6E379A666, 0x18635C0A3946D, 0x07CB48F45B95D, 0x1E9C8FEA95090, 0x27B97F1B55F22, 0x05CBF84D124D2, 0x202575B340CD2 } },
+  { { 0x7703A9B391E0A, 0x06AA1FE5CD5D8, 0x75996F17CFF66, 0x1D9EF29326698, 0x2AB817FDF6B0A, 0x12D3562B4545F, 0x45EFCBE006886, 0x3053F526B8469 },
+    { 0x3AE0E1EAAD968, 0x160435BE3619D, 0x10FB78EBEB32B, 0x2730EA9D466C7, 0x38E601BDD904A, 0x57FEB264396FB, 0x40A56D51D509B, 0x6DA9442C3EE89 },
+    { 0x5FF069BB3166B, 0x40D94AAFE9D02, 0x32B206AC1BFBE, 0x344C3ADE3C44D, 0x57B4649C39EE1, 0x03F5D8E473CC9, 0x2284CF1DF114E, 0x1269E8934A739 },
+    { 0x0CCF5B11619CB, 0x0151CBAC9ABE9, 0x0A16D192EECC8, 0x43420BABC9160, 0x7A491E889CDB1, 0x4AC107A434622, 0x152E7B7EC8B10, 0x5A26AB92C09F8 },
+    { 0x237E86A9C8A98, 0x564C601A1AD8C, 0x24B72C358314F, 0x4F9DDB756585B, 0x15C46032C6010, 0x2D9F8942349D5, 0x27107E1C9C65D, 0x46BE18F3B9443 },
+    { 0x11D8BD57AA970, 0x1693FC294C3AC, 0x1E4E7279269FA, 0x2149DB56BB941, 0x4AAAEACA42FB1, 0x192F4AA3C838C, 0x72108C36B0481, 0x2326BCC3920AC } },
+  { { 0x3BF07D8515B2E, 0x393EF5B4DD631, 0x521531708894F, 0x1503F70E08FCF, 0x0DCE8056C60CE, 0x379C0AED44781, 0x28F100BA4F5B5, 0x23B499F9D3A5D },
+    { 0x6F624BE4654E9, 0x7660A6D840C21, 0x7FD1C16746669, 0x782F65EB59B9D, 0x59BD7358057FC, 0x27411045DF610, 0x1C157748ABD2B, 0x6E2CD8CF4ED6A },
+    { 0x47FC0363FD338, 0x3CF780F746D2A, 0x418FA918FDFE2, 0x3EF6C82830097, 0x5BE8BD4961B90, 0x03F06ED4687D1, 0x7AAB79151D8BD, 0x05709D446668C },
+    { 0x3AB3B44B89541, 0x7D99082C10E9C, 0x74357E476BD67, 0x117E833C624BF, 0x6F34566205520, 0x52AB0B406A8D0, 0x040C4B2D9EC41, 0x62DB2FC653169 },
+    { 0x0B1569B7D18EA, 0x247FF2BCE4992, 0x66BA9DE2F1225, 0x57F950BD789DB, 0x08AA2D0EDF982, 0x1BD5724B8FC09, 0x749D9F2D015B9, 0x11068B533B2DF },
+    { 0x1671234181D10, 0x10E37D53939DC, 0x55B691B6DA083, 0x19AD29DC66A3B, 0x7CF6B5E63CA3C, 0x33F8E6BE44C31, 0x42C6D87286801, 0x34D33F1F9682F } },
+  { { 0x05E82AA16F2AE, 0x4C576DC0C0DC0, 0x34C4CC59274D0, 0x25878DA27EA6E, 0x115201ECA619C, 0x487430F0A5CA4, 0x21CABCF97B30C, 0x7D0030049F2D5 },
+    { 0x46A82651BECA2, 0x24788D390ACFC, 0x35B8DE5F771B3, 0x4906904E4976A, 0x4E79F2D650854, 0x5BF325C6F1DB6, 0x7C7BF5B576F62, 0x7C0456CA8CCDA },
+    { 0x0EAF20D7F4663, 0x4E744EF8F438D, 0x3412CEA4768F2, 0x6AD0BEDFECDFD, 0x0F0C602C0AB81, 0x5EBF888D494F6, 0x6393C798E0ECB, 0x593F05276DB88 },
+    { 0x72B1D319F38C9, 0x7565E2E4EC06B, 0x2A8A2E0C9710C, 0x112EBEB9EB656, 0x3EFE5A41B989F, 0x05DE6C67882CA, 0x7BDD76668649A, 0x2A18EE059D429 },
+    { 0x52042519276E5, 0x510441BCBA95D, 0x5DAD0A5BF3F6D, 0x7D9DD1C63B365, 0x22642D5435966, 0x62AE74B00F435, 0x53C7C9DED49BD, 0x22F8D82670C57 },
+    { 0x09F00AA6DBC3B, 0x1469795D97479, 0x4C8803B00C423, 0x147304449BAAF, 0x290A94A4B5AC3, 0x283A6036F9382, 0x0752F29E3FAFC, 0x1644A639B9114 } },
+  { { 0x0B48C2C1EA0C6, 0x2CCC2968D97EE, 0x501C655850C03, 0x413149415CB05, 0x769A79F6868CC, 0x5E64710BB963B, 0x35B7DEFB11D37, 0x592C511CF0E5D },
+    { 0x376B836B6E1D1, 0x6876783433F05, 0x56E545816753E, 0x2B1233E302A67, 0x3FBBC88096E01, 0x4B6B32F830792, 0x7EA676E8669CB, 0x02705BB15E41F },
+    { 0x15E6A6D0E146B, 0x3699DAC0B4327, 0x1BBA1C46A8DEA, 0x352627CBFDBD2, 0x0D486E02ADA2E, 0x001D0759C8802, 0x180B81025A5DD, 0x392B66A8E99B9 },
+    { 0x3B71C95765618, 0x08C3A994D9BCE, 0x74F958EC2A8D0, 0x253239DDA88F1, 0x122138C420DEE, 0x747C43FDBEC3C, 0x2842DFAA800B1, 0x5B9AFE5995353 },
+    { 0x6A021A67852D3, 0x0FA0D47607C49, 0x1EADAE43CBD73, 0x75774CBA376BD, 0x6DF0B1E9CED03, 0x126E210ABD0C2, 0x7BA03EB923C02, 0x72683984C0B12 },
+    { 0x52E86E29E58DD, 0x2347D32F3F8C1, 0x652451FE1BA32, 0x156633D93AB0C, 0x45EC07FBB28C9, 0x2A6A09EE058D0, 0x7713F4D71A2AF, 0x21519C44D8B22 } },
+  { { 0x695B71A5B1736, 0x0DB5AAD641963, 0x6D3DCD9F8BA19, 0x4D5BE2D808E33, 0x6EEF25F6FBE30, 0x5F2EC43B41DB1, 0x12B4272FB2D19, 0x771C713F0D220 },
+    { 0x68DBE56AF2CDE, 0x74BB24891EB20, 0x194E121BF8E76, 0x2C813B6B982B4, 0x3CCDB1B888B37, 0x3618B74F9BA95, 0x64F2ED6B4CC85, 0x64460ECE758A2 },
+    { 0x64B990636929F, 0x6F005C0B11758, 0x01EF8A7A927E9, 0x173AC12D3B332, 0x705E1F63F65C7, 0x70AB202E16CE1, 0x41AC1874C9FB2, 0x26B10B32F0A9F },
+    { 0x78497B94793A8, 0x3AF142C4920D9, 0x7DA8BADC53A04, 0x302F72EB3C1A4, 0x1F7ACB2AA78AA, 0x3D74992F9CD00, 0x06B91763B9AC6, 0x536FBE89E66A8 },
+    { 0x16F45F50A411E, 0x5F6DA1B3F6DC2, 0x74F8CBAC15F4B, 0x218A3E3FDA04C, 0x1E0050ADDF97B, 0x1FFE09D75C523, 0x654A08F79B507, 0x08CFB11A4E0F5 },
+    { 0x61A90653628BD, 0x1EAC246590C76, 0x17AE2653B2C03, 0x1CC9FB9620CA7, 0x30FDA4058F61C, 0x3082CFA2FE03D, 0x0DB2AB02C22EF, 0x2B1EFB8B84F3C } },
+  { { 0x457FCB467EDB3, 0x13A91A0613BB9, 0x4354EB9457744, 0x54E23B790A0C5, 0x27D43A75A6637, 0x58E577F9E97B1, 0x708355AE8988C, 0x00F5D01724E13 },
+    { 0x1604C0A8125B3, 0x39355575E2674, 0x567D5D05752FB, 0x2BCEBEB04C11A, 0x48CA57E6F4391, 0x4B9AA4DE088F9, 0x70ECA7B8BD35D, 0x51D524C3E2650 },
+    { 0x3B58C1D674D6C, 0x5AF67F7E6D7A6, 0x5774FC3CBE0E1, 0x39D7561E9E52D, 0x6B8D3BE7C4C70, 0x6D41A375648C3, 0x290891E8EF208, 0x159FC8776D504 },
+    { 0x46BE9BAF29677, 0x0D4E8B5AF6A68, 0x0B8D2D08E221D, 0x01768B6C98362, 0x17A4BACF18C33, 0x5C1C27981805A, 0x586652FBCBE93, 0x006AAA03E1D4B },
+    { 0x69278AD7E77A2, 0x4FDBE1A1D1CD9, 0x7100DADF81D13, 0x6F586A38C3AAF, 0x0436AA285EC03, 0x5069F8D4B46C4, 0x2C23313B1A590, 0x0C7A1E7222FD2 },
+    { 0x26CD26E754E49, 0x046B14152EA34, 0x6E1A21DE1659E, 0x200B18E7705D8, 0x4D0C157FAC00A, 0x29F63A41E89C4, 0x40BE0FEBBD7A9, 0x229A1FFB2083D } },
+  { { 0x6DADA93643222, 0x59ACE751A6B0C, 0x458A4104076DC, 0x69445AD014617, 0x52D8DED7F45F0, 0x6558AAC3E4FE8, 0x3858C802BC650, 0x3F5604155D2FC },
+    { 0x3141483A6BC55, 0x548A171BEF5FE, 0x5C52C5B8AAB3B, 0x18DB28CD0AC5B, 0x07FA6EA8730A9, 0x51698C0E15AB0, 0x3C4EE534B5471, 0x44AE4795A2E26 },
+    { 0x02B44D361C0E0, 0x55E8DAE591AFB, 0x359B7CD3D1C9C, 0x0550C00500A96, 0x73BBEE6491FD9, 0x148674D9E9DE0, 0x57244620A085A, 0x3C8B6F6C9232A },
+    { 0x7DE4D72F4A1BF, 0x3114E8636902B, 0x03FF90EB31B12, 0x0DB370E5FD822, 0x295B38017AA9D, 0x2DDFD5D91EC6E, 0x400B75D03C281, 0x6923953678D71 },
+    { 0x727377BC812B5, 0x1E8D458B77E34, 0x2A2C74375B785, 0x4E17C1EB7EE42, 0x6D0E18443796A, 0x44127884A474A, 0x44E1E75DB916D, 0x3C90C19E218E4 },
+    { 0x16E4BF965F2B9, 0x0955BD846BA01, 0x7C3AEC84544B9, 0x20AE93AB783E5, 0x71EA4E2F14FC8, 0x275216EF31D89, 0x629EA21D53416, 0x2C680F72855D5 } },
+  { { 0x380CBFDE9D156, 0x415116A787991, 0x17DD2D3AB4E7D, 0x18986344BB643, 0x510CD8C2A9006, 0x59735A29BAD45, 0x1D86E2B8D4E85, 0x65D4C5C76C87A },
+    { 0x6066D3B009DA7, 0x1EE6FE3B5D33F, 0x0346E1412C59E, 0x2E86D1861BC20, 0x01C02F623931B, 0x5D4F40691598D, 0x653E747C37BCC, 0x0A0558AB7D116 },
+    { 0x4B1D248D0A1EE, 0x2B825808AA3D4, 0x53672CA27AAF8, 0x1FE9730323730, 0x4A39BAFB15491, 0x3741BBC06B396, 0x7C6276E750167, 0x6BDBE322FDAE2 },
+    { 0x69DAB5156D3F6, 0x77A7159A9B02C, 0x4C4C76F8D3B99, 0x42AE935D57903, 0x2D23FFF704835, 0x4175EC6FB9B96, 0x18D4462E96818, 0x7EAD70D4FC6AB },
+    { 0x4589D99D42BCD, 0x545AF886C0C20, 0x450244ED8CF73, 0x6ED189A4813D4, 0x5C65E5C997536, 0x69BD50A76C761, 0x66F6B81E87916, 0x54E97035119C9 },
+    { 0x66A61092310F2, 0x0EF1020C329F8, 0x0C4449080A4EA, 0x1EB9446272986, 0x24A9B0DE70E21, 0x240BB9EB94A01, 0x6390F675CE322, 0x21105A9E70189 } },
+  { { 0x17BDCB048220F, 0x7D19F569C8A16, 0x5EB64AE46F1E1, 0x532CFB5CBFA9C, 0x6363136A03F15, 0x1FA951A9490CC, 0x7209872C9948B, 0x2205943C4731E },
+    { 0x338A4DA6C8EC2, 0x45174091D6914, 0x49B7B00C42BE1, 0x24B8A6DC077CB, 0x11E1EE22F7591, 0x713444475FE75, 0x7C8A8C6278340, 0x5CE7F4EA353DF },
+    { 0x54B21FE012D12, 0x3903879C06587, 0x3889E577751F4, 0x57D4DB12BFFFD, 0x58715C6A6F6B3, 0x24F68D512AA65, 0x530CE3736D359, 0x3765FEB864547 },
+    { 0x292EE559EBC63, 0x3A9FB122FCBD7, 0x295BD87D49FED, 0x0BD6E9604B743, 0x2EC520F3B1FD2, 0x7EBAE8D973C75, 0x0947F4C8E3EFC, 0x2524DB58E877F },
+    { 0x62365B40CDCAA, 0x089CA7DF4EFAB, 0x4C83D88692E68, 0x4D446F4FF19ED, 0x04FC6B92E1DDC, 0x36D53D2D99121, 0x35AC746DFBDF6, 0x751C1BF5E9FC0 },
+    { 0x272FAA84E8CB9, 0x21716C9504937, 0x4E2BF0F000079, 0x08BD421CEB8F6, 0x251EED992B4F7, 0x2904982EF3079, 0x01F8130855486, 0x2ABFC007D5ED7 } },
+  { { 0x16D08792972A4, 0x1EDF3B00538B5, 0x3E10215B7BEFB, 0x75B29793C180E, 0x5C700B8833FA0, 0x774D6E7288CB0, 0x515BB5E767AF5, 0x1AC9568EE6408 },
+    { 0x13CA9A8CFC40F, 0x58A91D32DB028, 0x7B5CB1F979E57, 0x66BE16D10CE33, 0x616B2ABB77187, 0x5528EF58FCF25, 0x3CDA51685E404, 0x7EB015C420425 },
+    { 0x224F57396A441, 0x5C2BE2B8D3578, 0x06E837F4502BF, 0x6F38A3471334E, 0x041DE06E4F5D7, 0x56A5C2B377E6C, 0x362962840BABD, 0x4D0E8FD6F2EA1 },
+    { 0x740A91F60C2F5, 0x00BB21A6C160C, 0x4206BC41A5A9E, 0x01EF121173706, 0x3F753B021B090, 0x02D299C75B9F7, 0x3142DC6EA7AEC, 0x1AC61AFA445EB },
+    { 0x27A34851DA896, 0x3046C2C5C2302, 0x5D6B650F3C26A, 0x1309305ABA760, 0x685C4454C06FF, 0x50B1665023373, 0x1DC634FB1D5C1, 0x6593968EC24DC },
+    { 0x79F6B27B17D8B, 0x0F20226C0BBC7, 0x0AF9EA6747D4C, 0x11C388AE96F20, 0x07EA3603115F7, 0x236E81791ED87, 0x4D3011C9A2741, 0x2CAB0B8A218FE } },
+  { { 0x586CBAA73F561, 0x1F71D5FC207F7, 0x249A2C10DE86B, 0x72FED4FC86717, 0x5E0401D4894EF, 0x63FEE7BE4DF8F, 0x1340FDB86C4D7, 0x5F8106009248E },
+    { 0x126E9278D2CC7, 0x56154046927D2, 0x0CF7ED7AA7617, 0x0C17F1C51FE76, 0x0310A48764722, 0x78F0EA091E112, 0x44742DE33D542, 0x3ABD8E97E834E },
+    { 0x607A9B1A5F8EE, 0x6F99FBCB35D7F, 0x33F47CCAA751A, 0x56E0BFC70FB1E, 0x07B0243B7EC6A, 0x133E865F081FD, 0x73FFF8EEEEEE2, 0x77918A2E21006 },
+    { 0x03FE3F8A23BC5, 0x1B97C75424B6A, 0x0C355172A0B11, 0x740B393F68151, 0x09257BEFC3C90, 0x1A3CFE021F33D, 0x1F1EA823A1A74, 0x041F110F8A499 },
+    { 0x5CE6FB3C995DD, 0x67BFDC55F8255, 0x554369125BB72, 0x1EC87F1B7277A, 0x313CBD2A122B8, 0x5F77968F2BC10, 0x2F2A3042F6D9B, 0x1A57A9B5863FE },
+    { 0x10932DDED72FC, 0x217A1DD1833B5, 0x5C4F4425A3DB6, 0x18115EA73E630, 0x139F6D349229B, 0x2C32E0C26CCDA, 0x60380F5FADCED, 0x21B94F50046AE } },
+  { { 0x74E28C881B977, 0x5C7541002A4AA, 0x02CC9F3D90162, 0x02DCD4C997FBB, 0x2D315FC70B423, 0x3A94AEC3ABC7B, 0x6765557FEE548, 0x41348643CF7C1 },
+    { 0x50443795751B0, 0x3881BC7601A7B, 0x6E5DAF5731C9A, 0x2AF6AF7FE427D, 0x1196DC134968A, 0x79B237FACFEA7, 0x1061196F4C645, 0x05B633D0A7408 },
+    { 0x3F338793444F6, 0x125E5D17D9503, 0x0BB20FA4EB49B, 0x3139CA19BF641, 0x2BE580BFA2648, 0x1CF4C4FE163ED, 0x6A9E2BF9ADB18, 0x797E876C25410 },
+    { 0x2B01D06AEAD51, 0x18B989B310FC9, 0x27E307572B8DC, 0x6F67BA531C8A3, 0x5B5C809FE7F34, 0x43468FDF4CC06, 0x649F0AB9506FE, 0x43327ACFD7A2F },
+    { 0x5F55C165CB1A2, 0x5F6D852D5DA73, 0x518C93679EF5F, 0x47FD31EA3F34E, 0x39FECD2CE3C9A, 0x7A78352EBAAA6, 0x39EE0BDBB7A12, 0x3876BF04AE447 },
+    { 0x7710EF4AB50F0, 0x21175E2F5AA35, 0x0CB9730F4C07C, 0x0827CCDDA0E50, 0x5379CD0827814, 0x2996DFA8C43BC, 0x1FEA2E7E0FE51, 0x2BFC958DB3A3A } },
+  { { 0x548A29A56724D, 0x186EB400D9288, 0x102AAEEB84514, 0x52BD9F7649B19, 0x31C113FDAF4A1, 0x6B0F8A05775CB, 0x3335EE9AF78DE, 0x72B76E747F300 },
+    { 0x315F861DB5C35, 0x00FB888834509, 0x7DFBB6C36550B, 0x544C95F3A7FDA, 0x3D2C036A2EEF2, 0x602F88E0C295A, 0x275CFA4DD2763, 0x18D2904C57FD9 },
+    { 0x491676F81E658, 0x55B8392775C23, 0x6CD2E5E170F9B, 0x12749698A0343, 0x46E3A9BFCDB5E, 0x3F9A57ABC1C00, 0x3459F15E6F5E7, 0x3E7E816B7A99D },
+    { 0x07911B4E371A7, 0x3A3B5CF2EFDB8, 0x10C2746D39374, 0x53343C774CB3B, 0x625356F809B9A, 0x79FF7F6B64570, 0x17F2D16DF8914, 0x3B9DFB7173199 },
+    { 0x2DEAA48F87A81, 0x477E2179A458B, 0x2F0238DE4B6FA, 0x1DE63BDE24788, 0x79EAA0EE5C9AD, 0x49A20FC116898, 0x324DD97117609, 0x17467D788BFD3 },
+    { 0x290138A0D7749, 0x15800EFF6869E, 0x057FB2AB154E1, 0x10DC367696FEC, 0x6584CFE725A9B, 0x2BD2DEEDFC5C6, 0x5C8EDF4B72C25, 0x1F62FB85BD2C0 } },
+  { { 0x5190374B551D7, 0x2F30DF0F1AECF, 0x17301F4EB0A50, 0x7969110D03E82, 0x2D6DB46AC1E03, 0x529886CD284AB, 0x1DB7DD51B7CB6, 0x63C62ACE7D681 },
+    { 0x4AAEC04336DDB, 0x3B48E3A856247, 0x47D811D584B00, 0x16050FBE63C5C, 0x5ACF99B3D4A35, 0x731D4CDE0F781, 0x522D3F1587C19, 0x4B362655F79A2 },
+    { 0x16797E470F2EC, 0x5EF8EDC6BE0CE, 0x0E43C78A40CC3, 0x0B267B36C5D4F, 0x15CA8B36D7333, 0x0E8B7CCE2841F, 0x2C6DA33B7F9C8, 0x2C8BFA31E4C40 },
+    { 0x63F8E6F1797D3, 0x335A162FD9533, 0x60BFE414982A3, 0x32A3021049517, 0x0F71B659CE292, 0x6C678836C60AE, 0x33F672783ADE5, 0x33098427B3B1F },
+    { 0x5A1A520D2E714, 0x02A9579E234A2, 0x5F64BB76402F0, 0x42E34EBAF8982, 0x3FC10207A4FDC, 0x4ED27D59CD903, 0x43A2F3678DD9D, 0x60082DB2493FF },
+    { 0x13D2A09E0B8FA, 0x2289CA1546DB0, 0x000C76BC6236D, 0x1772694AB9283, 0x0D6A9545D5D7A, 0x24E71F3E9CB15, 0x78D9C3296BA1A, 0x1E49AF6A60562 } },
+  { { 0x355AB0736100B, 0x391E6124DE574, 0x2F83AA14FE0FF, 0x08AE5639069A7, 0x52E0E30E7CFA7, 0x30F41E41D9871, 0x4BC0257CD5355, 0x15D09A1448E93 },
+    { 0x43B3F4EAF41DD, 0x4C7C05D6EC84C, 0x21882641B22F6, 0x72F4AFE98B122, 0x2E813010D7FBE, 0x2597FA524FD39, 0x002D87BEF3D55, 0x1EF95210BD8FB },
+    { 0x60AD1492C4AF4, 0x446F27830B4C7, 0x4A21610544F2E, 0x1B78F8C19374C, 0x4C1C9A6CB7C93, 0x3458B2F9C2DB5, 0x4184EA72EB9A9, 0x1832ED918A524 },
+    { 0x16EE57597B3AB, 0x2F2CC39189CA6, 0x60EE14526EFF5, 0x3737246C5E774, 0x5273E86CF8819, 0x7DB5B31E90D4D, 0x0471320BEACE6, 0x449B1553EFB9A },
+    { 0x4F42D873A9DEB, 0x19BBA7E019594, 0x05F262223252D, 0x0C5FBC2EF667F, 0x72DC3F31CDFA8, 0x7F441BBF8A9D2, 0x7B423D0697D34, 0x5BB6B248C08F3 },
+    { 0x4081C78B94D6B, 0x13483EA7BFE39, 0x4920D4C0D4A14, 0x15A4C9B760612, 0x4C6837A9C2E20, 0x2645AD260DDB6, 0x3BF4DEDE6B3D8, 0x2B0D47A8BBC3D } },
+  { { 0x6D69FA9B374A0, 0x6F4F504AFBD43, 0x02AA2F33367E1, 0x5384D97B7B458, 0x598E145AC5118, 0x272C8E32B5B17, 0x3134B6842A89B, 0x326FA4BD46E2A },
+    { 0x62DC2AB65B6C8, 0x0233BE15F345E, 0x191F05791E47A, 0x03EDE2AD7BDED, 0x49350AEF2AD88, 0x1948F2D1A831E, 0x58A0F81C7F259, 0x75D510B808268 },
+    { 0x10BA82777D0C1, 0x118B57FA24BFF, 0x2D5055762750A, 0x4A171B7C4F316, 0x5683488727406, 0x48C52CE063448, 0x50E7CD50DD828, 0x44C036130C9B0 },
+    { 0x0B07DD796F14B, 0x3B29C47C4B017, 0x4D6EA979C8C47, 0x7643515899568, 0x70984B6917102, 0x6C0AE001ADE74, 0x09ECEABDB5037, 0x19530409A3A62 },
+    { 0x3D6B5D59E4F37, 0x52E61EDF6A3A4, 0x383EB4B6B1CE7, 0x71384086EA103, 0x35698528393A0, 0x4C816534430E8, 0x608366D97D8E1, 0x1F904FF960AE6 },
+    { 0x106889DD9198D, 0x1F2B1538A2959, 0x58BE48316FB67, 0x1D295FAE713F8, 0x5883B697515D6, 0x1FF7607AAB652, 0x59B88A6ED1468, 0x2C40897AA657B } },
+  { { 0x1A7F4EDC0C806, 0x5A6A36B3DECB5, 0x3E02935A0E078, 0x0E06151E0BEC7, 0x15C0298D1E7DC, 0x6EDBE1723447E, 0x4B4F70B79398A, 0x21F928DB575E5 },
+    { 0x2EEE24FDE43B4, 0x1131E7C99CA56, 0x7F3476B458698, 0x62F740DB13B9B, 0x4992E1C4DC2D6, 0x6A869E3226845, 0x67C8A38CCF473, 0x2BC6B884E5FE8 },
+    { 0x4428CA3D7A779, 0x74905FA1F38A0, 0x715EB566E5DCC, 0x7BB011813F923, 0x084590CE37014, 0x4F1411E9DF608, 0x12A1ACEFF2EB1, 0x585F9B07F7374 },
+    { 0x4345A57C33EA4, 0x183732B16CB4B, 0x514C46CC5FA90, 0x21AE7FE1C562A, 0x17925F608F1FA, 0x6B78E943CD6C4, 0x2A8A27BF0E74E, 0x432581CF51A86 },
+    { 0x3CD3C781E2C84, 0x13EB43DD01172, 0x559E343DA79D5, 0x5A6E764A5C68A, 0x276F2AE1531B1, 0x29AF66E40280D, 0x6CCF2F59D3664, 0x1F99FA112752C },
+    { 0x0DC71F05EBC60, 0x0AB1D59EE33A8, 0x1CE11424F0476, 0x1873830265555, 0x1A4E57F55E6FE, 0x243D064F46B2F, 0x0648296414C13, 0x1C16231E8F389 } },
+  { { 0x12EBF90490D33, 0x7079A9F71CB7C, 0x53FD92A4503B1, 0x59AC47F34DCB9, 0x22D1B4031DB17, 0x610C94F9E7FB8, 0x1C2AE75BCCC17, 0x61DE7CCB53BE4 },
+    { 0x19EBA3BC962F9, 0x5CA12E049461D, 0x69DD4798D87AF, 0x211B0698DC5AE, 0x6291A4A4E65C4, 0x7BB93E458FE14, 0x38FCE1E657B3D, 0x35E94156D1FC4 },
+    { 0x434B95B40AAD3, 0x569C68605E867, 0x1B0FE48C3FC85, 0x4FA2AD1E38F6F, 0x5455D553A5411, 0x7090B51D09407, 0x741A8B553B229, 0x4B8CEAD33DC51 },
+    { 0x38B96A54EF3C5, 0x04E59EAB5005A, 0x5365AB284AE43, 0x79C7E1B57A137, 0x2838A33213B90, 0x24FF0FF6E79EE, 0x35ACA73AA9FB8, 0x712FFD7EF3087 },
+    { 0x148FAAC66C671, 0x36A27A193F585, 0x52487708625DC, 0x4CF01366639EA, 0x70B5CDB73B57F, 0x0B636C7E8D029, 0x49679DA2C0079, 0x30F7E2BFF29F9 },
+    { 0x10C03F879CF9E, 0x0E6B206BE3E34, 0x45DC86FE77B39, 0x14A6E8E0C6426, 0x5C9F410D8A6BA, 0x1E50E0AE4284E, 0x65B5A192E571D, 0x31F9F48D6E79F } },
+  { { 0x5387A619736F8, 0x6BC6E8BBEED57, 0x6AB8103A5C0C9, 0x1FAC30B6D01FA, 0x2562991F5DE18, 0x27543367CE5A3, 0x264CEC453C261, 0x476F58A34AA71 },
+    { 0x1F0DBCA2D7BC9, 0x717069D66949A, 0x3A24EBDCBD786, 0x48735F74EBA43, 0x29EA7A7087136, 0x1AEFE665DD1BD, 0x010A2FC857C49, 0x05FF454691E95 },
+    { 0x7F0151EF2C7AB, 0x66687908D640B, 0x5DCEE434DA4A4, 0x6E4822A22EB9B, 0x741EED99ACBCD, 0x03ADF1C67886F, 0x258B4A54FCACF, 0x4207F5AAF80C0 },
+    { 0x79B4F7CB209BA, 0x4166CFBAB93BB, 0x4231FF778EC02, 0x133E1A18EF341, 0x26A74B42E02CF, 0x46F58D78A5C9E, 0x768C29CC33EE9, 0x79D94B0F6E5F8 },
+    { 0x4D8AC617571CC, 0x0139C22195736, 0x74B5FA3330BC0, 0x26011DF016B1A, 0x328E901AF2E1B, 0x61EA33E2D8E61, 0x2950FAB9AEB3E, 0x0B8572BABF890 },
+    { 0x45F45AC7CBD64, 0x179588087A324, 0x0069CCD9415A4, 0x228F6E5936E27, 0x679FC77E3866B, 0x2BAC77039B6FA, 0x2C19B343535E7, 0x2BF5C44520B6C } },
+  { { 0x18483B4A988DC, 0x034C168E32ACD, 0x04B397C889B5C, 0x0624DEF78D2CF, 0x78C9EC2825AAA, 0x4F3EB636119C0, 0x1F223431F6520, 0x475311467CF4C },
+    { 0x18DBEA71894D6, 0x51AE52BD280C0, 0x4E8A02669B8FA, 0x18F0BC14C0F1D, 0x6AE427CDD062E, 0x2BFB6D3659CA5, 0x1C37709FBB486, 0x1FA6E5274A4D3 },
+    { 0x1156C28BE1535, 0x0B0947BF0F349, 0x5487502CB48CD, 0x1C639C83BC98C, 0x551103880F5CB, 0x60F3E2EABAB83, 0x46C9BF1C9738E, 0x1E47912C16631 },
+    { 0x243AD4324ECEB, 0x35107E1A0DD4E, 0x328CE64D2FC75, 0x3DAD1A48ED718, 0x4E1338B0B7283, 0x38AB16916AF5E, 0x45AE88824512E, 0x4974B853329C6 },
+    { 0x1FC86CD1D50D1, 0x6293AC6C2DB13, 0x6E2EABD606613, 0x16E0F11B17E1D, 0x645AB45F29038, 0x43FF2F736A04F, 0x44AAA90688377, 0x2EF4567767C34 },
+    { 0x7EE0F787BD3C0, 0x18DADA029DF9C, 0x22F0AEFDE3A6A, 0x120454C293C42, 0x79AF6ED22FA87, 0x33D1915EC4BA9, 0x06DD7617002AD, 0x1BBDBBCC11A7F } },
+  { { 0x40BDA2A8C11CB, 0x5C0AEE6A92235, 0x32B9074AED5C4, 0x3A95E93D55A8D, 0x14EC097942FEB, 0x42EAC92B3CB69, 0x7371009A39CB4, 0x4244CD8FFAA93 },
+    { 0x1C83386834E6D, 0x38D97925AFB52, 0x0014084689426, 0x4EA55D462FDEE, 0x7A91F53C52FDB, 0x7117FFE43D33F, 0x363DAAA82FCF3, 0x32760FD137160 },
+    { 0x03B32F94D6AFC, 0x04E4F11D37024, 0x05BC8267EC03B, 0x336F9E8292E21, 0x62FEA05F3D1D3, 0x48600FBA73F3F, 0x4844D2F8020E6, 0x68136E6D8C0B1 },
+    { 0x5476DD9BCA886, 0x0B93B7230FFD8, 0x472A2B2644CFC, 0x04C1078DB378C, 0x186F8C8946A9C, 0x0E98EE187F113, 0x37AF8F8617760, 0x13F5ECDB6E07D },
+    { 0x60AE3A499E28C, 0x6FFCC5F1502FE, 0x4F49F2AB1649F, 0x476F37666C005, 0x588F40B9C21DE, 0x5E892D81AC0D7, 0x4E913CA92EC6B, 0x0AA16A07D3328 },
+    { 0x47A430A61B529, 0x1BBED9B303094, 0x55C8408E799B4, 0x130B847565524, 0x1E729A023DA16, 0x2A05BD3E54EF3, 0x54D92D3BD6FFE, 0x17F678DEC4D08 } },
+  { { 0x34A85F447E0A4, 0x5CE56E12A3249, 0x417B5E58C73A8, 0x350382B4C0A86, 0x20089100B6E44, 0x25BE13451CA12, 0x1B42A26CB4366, 0x3B5FB63213440 },
+    { 0x716D71CC4F3CF, 0x036D49859CAE8, 0x1FAFF78AC7F77, 0x003FF0DD09198, 0x79D2FC1301457, 0x73272E5D3CB55, 0x642BA016DBE76, 0x7B59F95B0401F },
+    { 0x427510172CEB6, 0x0BC672DDA970A, 0x0F87B4F5E2203, 0x25B2AE5C4ACB3, 0x0814211F6A7C3, 0x4AE5F29BC556D, 0x7DF3E2A2A22FF, 0x4DB00406A856D },
+    { 0x7FB696257B08B, 0x21686FBD6C1C4, 0x77834EFC589EE, 0x26004F2AD0331, 0x57D4D35BE7D49, 0x53DE02133641A, 0x504906BC8507B, 0x214809A551A42 },
+    { 0x15F5B295F7C01, 0x2DD5C3C0C42EB, 0x1042B99C37CE5, 0x4CE7395F336FF, 0x379C085FA2F8E, 0x1113699953778, 0x3A6DF0E5961E8, 0x6B6BD18889EED },
+    { 0x704F3171D439E, 0x15F39B84A9E3E, 0x12B0EFE54A584, 0x0D48CAA500BBC, 0x4C4B019D577DE, 0x1A657FEF4E0CE, 0x0188BA92662DC, 0x28D8A888508DA } },
+  { { 0x29ECB6B17634B, 0x40BDD0B7AF25E, 0x04628B6AE4762, 0x68C1ABA53B6CA, 0x57D70C9CD44B5, 0x41873E2BF96BD, 0x7D8CFAF7912B0, 0x3D8A1F69C53EA },
+    { 0x7D49EA891C826, 0x51E65FC0DF473, 0x5B7731D00C5FC, 0x34FB87EAE68EF, 0x5EA1F9A2432F5, 0x09147B46D0219, 0x522FA05374052, 0x08A4D11725659 },
+    { 0x7BF893B1CBFA0, 0x084FFC8F67021, 0x49FAE3BE4B418, 0x66D1687E95FE4, 0x14BCA56A29C74, 0x4C4442157F531, 0x02C2719546BD6, 0x374F6211C0F11 },
+    { 0x67826772FAF5E, 0x2B971E70BE10A, 0x49F097944E466, 0x42BAA73D029D5, 0x01AD74AA87443, 0x4DE4A8C0DC9B8, 0x5D12ABCF71552, 0x3D0C2888C9D23 },
+    { 0x195FA5FAE4B56, 0x36E8DEAB379F5, 0x1B2796F7C7AC5, 0x76C2116675D6D, 0x6D3E7CF6119C2, 0x379DEB80ADFDE, 0x31E2F899DDC4B, 0x15D6B2C4A617A },
+    { 0x4F97F8DFD3E25, 0x1A7E5DA196210, 0x314A109B5CE9C, 0x107DC6594A160, 0x3D3FC4274CB9B, 0x2ACF186025003, 0x7A23058BE9074, 0x263A313C3BEF8 } },
+  { { 0x6E5E597BDDE1C, 0x2BED045F551A4, 0x61F01CF899CC2, 0x5D35B073EE9BE, 0x02E5241FB605E, 0x7BC17299673C8, 0x661B4E56D1008, 0x0430989753384 },
+    { 0x3DD644309FC6C, 0x3EE18599068E2, 0x5F34B5B158BB1, 0x5AFB1A0008090, 0x5085AC2E78EAB, 0x1277BF63DCB2A, 0x5BFC96280C973, 0x44B5DEEA64EBF },
+    { 0x31F1DC4218903, 0x3E8A9B678EB79, 0x1550E671C1270, 0x1181A637F457B, 0x0E6503EFF7ED1, 0x69B2809CE428F, 0x1CD54BA402952, 0x7FE3C8393A1DE },
+    { 0x3D8C2A474C594, 0x427F59D50572E, 0x76F561C1955FC, 0x0DDE898E8652C, 0x458359195D7BD, 0x6AD0008C14758, 0x53F2053A9189B, 0x50DE690FAE252 },
+    { 0x5347F7C9D1DAC, 0x421BBF56F0760, 0x1584B1FFED7B1, 0x2CF2CCC94AA4F, 0x3B1CF85B7DA50, 0x3898B3FED0170, 0x773CA8A501EF1, 0x31DA3EAB1C363 },
+    { 0x66BBBD11EB414, 0x12689DE387484, 0x6EC84D1FEE1C2, 0x070184772772B, 0x16256095D97B9, 0x18A4F465530C1, 0x77E1C386978EF, 0x223FF2D79682E } },
+  { { 0x64C5938C9ACA3, 0x541EF1836AA49, 0x1A88B389995F7, 0x429AFB95AB903, 0x28AF7C8B2ECD7, 0x2BC32204EA70F, 0x38ABB45C34921, 0x433E0CA428CDA },
+    { 0x53F43AB70C186, 0x14611C4146165, 0x27CDB8463272E, 0x53C00C545353F, 0x3C027E4737256, 0x452DA40B4E405, 0x68A381B793DBC, 0x4F365DDC5878D },
+    { 0x0FF3852402967, 0x4C6AFED97FF95, 0x4F41DE562F722, 0x3D776992C9D92, 0x79CED735D385F, 0x332800710E59D, 0x6A69CCBD64B7E, 0x3344677333DF6 },
+    { 0x5BC5BE3F375EB, 0x50B22E337815A, 0x06268BFD065A9, 0x47A6622133D94, 0x3783C69463952, 0x4D6BFAC528CDD, 0x1A19B5E8CDD6D, 0x5C69B5DA8F1ED },
+    { 0x5F9F05768C044, 0x7952DD29DB02F, 0x36F00DA652866, 0x7A59372679A1C, 0x16A221807E4D1, 0x143786E68DC4B, 0x2E63975AA1525, 0x4A4FF0F36F510 },
+    { 0x6EF54728A60D0, 0x0CB57BA9B9671, 0x00043C371DA3D, 0x1FEF641B98DC9, 0x20580BBAC13A1, 0x33689D943BABC, 0x62EFCD0384BA7, 0x2404CBAC89680 } },
+  { { 0x77FBCF8271F6E, 0x1F632A764DAA1, 0x3FE04F437128E, 0x17AD9A1D243EC, 0x472BDB927930C, 0x13B4674274BDA, 0x55201325F3D08, 0x2275E90999D91 },
+    { 0x6B026B3220F98, 0x53C7A07F86974, 0x7861B52911B65, 0x297210C071B08, 0x5957CB8C46C3B, 0x0A188F00ABE42, 0x30D1AD58B4188, 0x188CE2AF97F27 },
+    { 0x6E0580F0F8928, 0x124DEF50A616D, 0x0787B80223970, 0x72B70B8785006, 0x141813B51B029, 0x60538D479A998, 0x60568C50C04DC, 0x47B7380D3E1BF },
+    { 0x1254725777495, 0x7308C2E1971F6, 0x6D3DEF55C7D94, 0x1E463701512C9, 0x21F453A8224A2, 0x15E90B51D47D8, 0x4C4E1A79F928B, 0x0A9BC58054942 },
+    { 0x12A42BF8A3D1D, 0x3F9630A2FB1F8, 0x377F7726713E7, 0x5BC905C695EC1, 0x1DC5A4175CB32, 0x701ABA0526865, 0x1E4F0C97E5D1C, 0x59BAF2C6F27B3 },
+    { 0x19BB444828A68, 0x1B6D99E7AB8F9, 0x2584908EE9AED, 0x0D894414A613A, 0x0243389207DF0, 0x2F830B9DD2B4E, 0x426E162D96BB9, 0x2A5C59E7CA067 } },
+  { { 0x040B370FB71D8, 0x6629DE4811DA1, 0x4A30B59C3AD1D, 0x5D27C3899351B, 0x248913819F1F4, 0x78C24AFE0024E, 0x3B34BFBD86507, 0x2A21CD48296FD },
+    { 0x7803730F5F17D, 0x7BB1FCCA8F279, 0x1942F0AC06AB0, 0x0304EF3EB85EC, 0x0DE70F910EE83, 0x14F360F7677A6, 0x0B3B261AB80B9, 0x0F62A19CAD4A7 },
+    { 0x61C5A5272E524, 0x0B38CBF653A36, 0x6C9407035C26F, 0x7BFC972063EF9, 0x6E5BCB24D395D, 0x5B66114A8E7E7, 0x220F1BA4EC997, 0x156E4236E58ED },
+    { 0x6E0C9F73654C2, 0x4EF713F39836A, 0x6F8929C0AC6B3, 0x56AC46CDE91AA, 0x105FB7A1087F3, 0x710033E4B9C86, 0x57C21F798D08D, 0x7879C42E4E21B },
+    { 0x4B1533FA86C83, 0x1D6AB810E31FE, 0x23D54D594476C, 0x1FC504F7A051C, 0x0419849EDFC17, 0x5DBC8621EF8DD, 0x65E90664D9120, 0x72B5BA410F580 },
+    { 0x188A364B4765F, 0x13DCA96DF4C43, 0x17C077CCC0F94, 0x13BBF050A8AEA, 0x71DA26C92D659, 0x3A3C812F8F325, 0x469336BCFC539, 0x3B5EB4088C8AF } },
+  { { 0x1F4C400D536DA, 0x52ED5B69B892E, 0x0B7E4D4A01FBF, 0x012C8F8CF11CA, 0x0ECA5D968A44A, 0x1CDBB0D054548, 0x527DB6397C02B, 0x7A5D03E4CB111 },
+    { 0x2D351FFCE75CA, 0x6F4B3060ED014, 0x00647EF1A0CE1, 0x5C7B5CB791592, 0x0E9CDC3405B88, 0x3C3BB495308DD, 0x5BC831926F777, 0x6761CB0FFF2B6 },
+    { 0x38617CAAD0FA9, 0x7378B5C7985E1, 0x5C25E5AE66748, 0x5692FBABFC7A4, 0x66F4EB2029CB8, 0x3E59469192863, 0x11A23260FADA3, 0x6B4EA063BF90F },
+    { 0x22D10F5B4D2F5, 0x37E7EAC618A3D, 0x79A0B3472BD6C, 0x6AC2AD231D65E, 0x79B72DEA376B4, 0x0F789DECD0185, 0x644F34B462F8B, 0x2539D1876FBBE },
+    { 0x636D0E5F3A16D, 0x18AE99330ABAA, 0x5C3C2C9AF9C4F, 0x6ACAF75BBCAB1, 0x041E65BD4414F, 0x37E1996F42C02, 0x42C1E6C9E89CB, 0x5E3E03E78ECFD },
+    { 0x2B066FA927962, 0x14EB3ACEB4064, 0x0D57B080AF9CA, 0x0C2AEC3073FA7, 0x7F344B167E5D3, 0x395FDE3C35F84, 0x42EE037ACFCF6, 0x1EDE32DD41763 } },
+  { { 0x30CDC50F68CC7, 0x3DE60E4F4298F, 0x14C090195FFB1, 0x614033A909A82, 0x77DE922EBB2BF, 0x4DCD272A7157C, 0x07810B3472CF3, 0x208340FD5C649 },
+    { 0x30D20421F14C9, 0x00442E3042097, 0x4D82FC60982C3, 0x4E705C7D540F1, 0x787A346991E27, 0x2BED6337FC189, 0x3BF673E0F247D, 0x1A97A6FEF22B3 },
+    { 0x4AEF72B04FAF3, 0x4ECBAAFCF766F, 0x007D56AD98738, 0x6DEC33B6A2A7C, 0x052A3A15B9DC4, 0x15481AB42304E, 0x62454E1892D42, 0x4B4F012D7B6F9 },
+    { 0x736CA964B2091, 0x1E80B72AD442A, 0x66ADD192BA68F, 0x47727BEC0E0E9, 0x61991579B7F2E, 0x72115D0CD31F4, 0x404A080BF77DF, 0x178330F64E03E },
+    { 0x03BEF4356E5C7, 0x16FA35D65E70E, 0x47F04FEAE634B, 0x7C1C2B686CD26, 0x1B7B05C1A16E3, 0x7CB205644234C, 0x23E00F233F3EA, 0x75B3AD04C88AF },
+    { 0x1076445E75AE3, 0x099B937705EC0, 0x6EEBB366A95EF, 0x1F3B4105FCEEA, 0x7290EB01D38B3, 0x2C6ACDFA5928B, 0x319D076FC0CB3, 0x25E5A01E9E7B9 } },
+  { { 0x36285EEC5A193, 0x5C713A45746D8, 0x49C2FB3BC209F, 0x39ED2CAB3DD19, 0x36649960154FF, 0x762F1941850B4, 0x2797A9DC93823, 0x196031209ECEA },
+    { 0x5AB395F726FBC, 0x0F77D43F465D3, 0x774DE48E0B348, 0x75F8EB35B7364, 0x55AF2CEF33065, 0x2B61113599F14, 0x00AF303B75D1A, 0x6F497F77C7BF8 },
+    { 0x30F2EA80C21B7, 0x3A735F961A341, 0x111CC67591D61, 0x06780579CBB35, 0x4D83F70275678, 0x625890884DDAC, 0x1E36E4E7210D9, 0x6BDEF627F4EE9 },
+    { 0x6E8C9FC924DFA, 0x21BEC1CA87916, 0x58A45230B37F3, 0x7273365C56229, 0x1F9A2D4F39E5F, 0x7D12DF2816000, 0x07AE368A973C4, 0x5B921C3A5295A },
+    { 0x1DB7E2FFA8FB8, 0x22EE23CABF899, 0x253572AA058D1, 0x0A6962F2D7D0E, 0x128C3BBB7D177, 0x316033CEB8360, 0x43CDE0327B400, 0x5FE5A8DC97A64 },
+    { 0x504CE7A33CBF1, 0x083F70F69B60A, 0x2ECD39A9F8276, 0x1BEEDBCDA29E3, 0x66BAA34C9E2EF, 0x2F23D046F8A97, 0x20BB135D339CA, 0x2D32A24DEDA4D } },
+  { { 0x14AB4D931CAD5, 0x14F355D365AF4, 0x7B433CBABB8A7, 0x412B1C35D82BD, 0x19CA209CA0DDB, 0x67816A9C818E3, 0x3A5C440F53BF9, 0x5D81094225C9F },
+    { 0x2F9E9B8264B0C, 0x180A9FBE39B05, 0x5BA79CDDC679B, 0x33F52483F0730, 0x503E745715048, 0x39EF2D201A94B, 0x0CFDDDA805ECB, 0x5F253F5C4B784 },
+    { 0x14B8ABE10E8AE, 0x408579D3D8465, 0x32C3B8BF492C8, 0x5B13D380BB09B, 0x709B07F9A84D1, 0x27C9DDF712C44, 0x044D1F8E81890, 0x4C7197534622C },
+    { 0x1EB87CDC561C5, 0x446871CB85C7C, 0x66DBB9F6BD962, 0x2B60B09E76F9F, 0x56630013A8A62, 0x4F2EC04018A57, 0x594AC3A628D8A, 0x605BA1DDF3293 },
+    { 0x498FFEE332628, 0x2974EEAB44D87, 0x40061E5951A97, 0x06DE7D3099FA7, 0x733BF4BEE242B, 0x68A961DBF40BC, 0x54578F77578EC, 0x2D8F6FC23BDB9 },
+    { 0x6A5535ACEF9B3, 0x12A0F99A478AD, 0x304396107930C, 0x12370408B21F7, 0x2CE3A7433FCBF, 0x3498CF08428CD, 0x138893CFCA8AE, 0x20E676363930C } },
+  { { 0x2DA95223B24B4, 0x0E729713AB07F, 0x79E101F01C48C, 0x7BFA9A42A2953, 0x1618AEF91FCA8, 0x6970301199FAB, 0x2E3DB8283AAEA, 0x1B082528BD362 },
+    { 0x321EAE7003CB7, 0x491AB98419CE5, 0x1476AC9C2E327, 0x5CDC55FF6811B, 0x7298026CB6CE8, 0x3621E185A2BFA, 0x09800B13A1562, 0x404E5E594E9B1 },
+    { 0x072645BFE9C63, 0x005589261A111, 0x32D2605DBF539, 0x2E58C0163E797, 0x4C91951C1DDB8, 0x73C69029756D5, 0x66B2A97B1E7B1, 0x690AB7F4A9CCD },
+    { 0x0EEB5842EAD64, 0x4D68D886D785C, 0x48CC69D82C6F2, 0x5DF90253E8D1A, 0x6D4ED2605AA41, 0x66F1FED58BA3C, 0x0D39CEC77AF32, 0x51DC0B454B6C9 },
+    { 0x14EAACDF5ABCD, 0x703AFBD8D94A7, 0x4DFE5E19D19D1, 0x759537A925DC6, 0x25741B915344C, 0x4806AF0EEA553, 0x13946D87895AD, 0x71DAA064D6F74 },
+    { 0x6180D70F30CB9, 0x114C371D6ECBF, 0x6BF12BC653D07, 0x0BEB4A92EE3B5, 0x010849B640B2D, 0x28A86360BEF27, 0x3292ADF0C21E4, 0x22A7D2A534393 } },
+  { { 0x0E9D41A01C5DD, 0x2F76D9AEC8638, 0x626D4D9CC8B85, 0x6B86ED09D4E94, 0x323729F259463, 0x2D88FB1C11FE3, 0x277EF4426C459, 0x515BF5C55262E },
+    { 0x4772B32E1BED0, 0x06AF4CA0E0CD0, 0x145986833CA1B, 0x2C789F159DA77, 0x215B2DE58A090, 0x65FEFF67FDA81, 0x6752149EE516D, 0x13E7E6219F0E7 },
+    { 0x7830F8F810070, 0x626391AF2DC3A, 0x51F97445490C8, 0x59BAD09872F2D, 0x279022A869C01, 0x5CD6195878154, 0x0D8C2C0FBAE23, 0x535AFAFC8415A },
+    { 0x448C65478DE5E, 0x74FD7F1F38B40, 0x773B1457A6956, 0x76E872B7F5E52, 0x2414E4D06C283, 0x13EC33CEED500, 0x6D9A440383F2B, 0x739DB83DC145F },
+    { 0x75EEF72975D6E, 0x608323A2C6873, 0x32BBDDF418808, 0x26A30141F20E1, 0x7F50981DFAF14, 0x77D7A4951C905, 0x3A93BE4717720, 0x20622CB5C0ED5 },
+    { 0x3D09F871CF303, 0x14E64AF46088E, 0x59A7FEC0AA8CA, 0x0E873A0124267, 0x28841EB083208, 0x37B70618AB950, 0x2CB8C09CCB977, 0x1F04C19EE2480 } },
+  { { 0x76932D26BD145, 0x78EEC62FC77E3, 0x302475C7937AC, 0x4F95339FE20D3, 0x3DD3DBC410425, 0x6A7321484DD4E, 0x5FC7C8D508890, 0x06E8AA5F98DCD },
+    { 0x4969558C498FD, 0x15D47874A3809, 0x201581A8E1FF1, 0x2CCAAA7967AC2, 0x321E985DD5E27, 0x125DD22979066, 0x21051E0267FC4, 0x3829D4E1EA396 },
+    { 0x2DDB32700A092, 0x625181CB5FC61, 0x1D866D5C2A893, 0x517E194D0B19F, 0x32CA14A0DA5D2, 0x44A8ED6026656, 0x40BB3E7B83271, 0x3C879A0F4DCCE },
+    { 0x1045EBAD4A8B4, 0x5E25C08D4636A, 0x25568B37D8C57, 0x39D5C420EC57B, 0x69870AC6B7F52, 0x722B2D0F2AA95, 0x1A9251022AAFA, 0x02943B3EEA799 },
+    { 0x3A2C3161460C5, 0x14D559E88D0CA, 0x215ED276E2D1F, 0x335B39BAEB5BD, 0x50A88CFDA8F73, 0x024AFF9642E53, 0x133AA1DF4B791, 0x608A9C3CC50F5 },
+    { 0x6F66A8DE424D3, 0x19422E0FB29C5, 0x034104CDEEEEC, 0x1C6D9AA7A43F4, 0x52E4E7321B160, 0x1EE86794FDA50, 0x560E2B79D3FD2, 0x2FAB697F5BFA0 } },
+  { { 0x4B68688BB1F4E, 0x0D0DBEE87D957, 0x160E8DE20D851, 0x236CFD8D56410, 0x55E9274DC615E, 0x7E7D37DFCBBF9, 0x2449911F3C2DD, 0x4249C0D22394F },
+    { 0x7FB3583F66704, 0x3C2E729A04BFF, 0x2D4841DBF9AEA, 0x4D8AC4C9E41FA, 0x50B55280662B2, 0x0F767C14FE0A0, 0x7A96DCDB34804, 0x774FDD090B261 },
+    { 0x66316C8D315B9, 0x34C0D3F7B787B, 0x7B73E22F4AA15, 0x0A57DCDEBCD5F, 0x063AF7D9E3159, 0x14AA431702C47, 0x66A020E71B4FB, 0x441DE1D32FD95 },
+    { 0x3CDAA393436BE, 0x1E27E285A410E, 0x79BEDEDC1AABA, 0x72750FFE92D62, 0x0F9CE7DFBC38E, 0x4FE8BEB4B4B40, 0x2D664668CAB48, 0x7B39E97C2907A },
+    { 0x6608CD08EF5D7, 0x64D247BD8334B, 0x255B2E88055C8, 0x32C696EB18E3D, 0x7E9142ECD81E9, 0x0A2FD490F8E74, 0x4DF9E90367BC7, 0x1A81E472F697A },
+    { 0x7A684379B97C6, 0x11770749FF762, 0x1386B6B8D5D07, 0x19A2D48CD77D1, 0x3741B00168D71, 0x1A20555DD5BB1, 0x3CCAABB6F1F0A, 0x1DA6E07963331 } },
+  { { 0x53E769384356B, 0x157959D452367, 0x39CA7B06C4428, 0x6A9CF16B3BA63, 0x156D0042DA28B, 0x56EC42E06942B, 0x7A15664AB56C8, 0x30F8A69AAA68D },
+    { 0x45616DD69B0C8, 0x3712EF484043B, 0x0435B35144CFE, 0x36830E7F3B9E7, 0x516BC2A8BDFC9, 0x6BEEAAC56899D, 0x2C5E8D970127E, 0x71267FEDA5C46 },
+    { 0x5C6CFA2AF6C16, 0x400528AB14232, 0x0213E499DC4DA, 0x50921ACB0D278, 0x51DCD0E1B417D, 0x7657AF0A1985A, 0x3DC641C8F8A95, 0x340B318EA07E5 },
+    { 0x344DE22E2A9DD, 0x610D9138AB8CA, 0x6EA32E1BC7C41, 0x5F12070F5A213, 0x36DFB23484677, 0x12A9EE558C0D2, 0x197D0D566E685, 0x099612705AE14 },
+    { 0x70871EB404548, 0x08B1472D1564F, 0x1A8DC5F222F10, 0x20B75228F4604, 0x56B26C56C5742, 0x58F2AA4511B32, 0x6891989A73E94, 0x535C5C585C76C },
+    { 0x5B2B00D7BDD71, 0x113DA33956B4D, 0x29AC489717DD8, 0x0F34190FEB746, 0x37E449405DA3C, 0x25E013440E4A2, 0x7ABAFE068CBF0, 0x2E8E6CBCEEDB3 } },
+  { { 0x2BD69CF676317, 0x442BE318CBF8F, 0x216281A11DD62, 0x38334625876D1, 0x4B2AC8E4B4B75, 0x1EFC710E2FBF6, 0x0A7B31981A982, 0x22C22CD6B1469 },
+    { 0x2DCAF9353A87D, 0x1AE281AA7288A, 0x4C32CA815A0D7, 0x3D59320AC6CF7, 0x77291987B6D18, 0x38BAA7E8CC47F, 0x462D7250812C2, 0x26A42A2177E70 },
+    { 0x479ACD5876DF5, 0x65681795E08BF, 0x716FCA0923075, 0x659BED62B12EA, 0x6C51F2BD045B3, 0x0F2ED87EF7C27, 0x5C066AAA1672E, 0x4969184C5EEAA },
+    { 0x048392B694226, 0x1D3DB774BB0FE, 0x33D6B3604DFAC, 0x35C9FEFDD86F5, 0x21FC9CDC8BBDD, 0x608225E375E56, 0x3CD8F7A7A5BB7, 0x3301B04DFB13B },
+    { 0x76F04A9BE228D, 0x42A3859B24ED3, 0x1F32DF5DC9A3D, 0x5CBB7464BC461, 0x5B0A38D2B7586, 0x2E49419D611AB, 0x38BE690502796, 0x358F47941F07E },
+    { 0x142174308C4C0, 0x13FAA89326779, 0x1EDBBEB1958FA, 0x116788C6A7AA3, 0x62AC16EC5342C, 0x181705BA24EAA, 0x146B357EAEE48, 0x37E0137345586 } },
+  { { 0x74DB2DFF4D460, 0x5B80AC37CFA2E, 0x73D47808963FB, 0x49C11B8651930, 0x1463C13C18F4C, 0x59AA4F40C4FC1, 0x3E61E97920C59, 0x34F0A1F504ECD },
+    { 0x770D9E19BD68C, 0x7FE5572C076B6, 0x0DBB050B9732E, 0x3CC0EA0E82764, 0x51BDE1F379D44, 0x1B1A44E0BFDE2, 0x79B281BC04FB0, 0x6C8C19A94CD9D },
+    { 0x4083DBF716E84, 0x135DBCF80A71E, 0x10F078C3FF925, 0x6E58E9DF03737, 0x1C27D5ECC297F, 0x2FBA987372D67, 0x7D71F02649674, 0x69EBEE7FF94DC },
+    { 0x210B1D74F12B7, 0x6753B7052DA6E, 0x5CCF68321D4D0, 0x1D35E437827CB, 0x41FD21A3FBF70, 0x657F2097DC41A, 0x4F90D84FC1CF0, 0x797FCF2AAF230 },
+    { 0x0392D52C82E82, 0x2F397A09612EB, 0x59C7A9FC60C1A, 0x77ACBF9374A70, 0x3BA82AD955985, 0x56FAF1F5A7909, 0x476D36A0D0394, 0x4D0DFD748122E },
+    { 0x0FE42210C4AD8, 0x0CAADCE7969A5, 0x0F720EE09817A, 0x1835EF455BEE7, 0x07794E9ED853F, 0x2ECD0F48524D0, 0x74BDA783162B7, 0x30ECDF1E1C4C1 } },
+  { { 0x6087D2C9C5F2F, 0x386E1812067ED, 0x641A1FCC2C968, 0x412B9DE2B616E, 0x616D1B5AB43D5, 0x63A9C45ABC37F, 0x11DD4BCF026F8, 0x6566CFA2E703E },
+    { 0x5A080166B9CE3, 0x2F6271BFF3450, 0x49B91D4199280, 0x08C1024B6DFB6, 0x082E37CED48BD, 0x01720DEE7755C, 0x1EC6101B6F0FD, 0x3E90D7FA3B2EC },
+    { 0x0F7E1DEF869B1, 0x39519C05A0605, 0x2760694CBAA8F, 0x0932BFA917541, 0x11B0A58BEC3EF, 0x037946FDC85CF, 0x066927E3503D9, 0x368E83256B8F4 },
+    { 0x27FCBD8A5579F, 0x7F55EBFD92B64, 0x2ED68B439D9E3, 0x6EADF39F39D26, 0x29F30B99D0616, 0x6E859EEBA51D2, 0x609717B3CC569, 0x57EDF69BF2B7B },
+    { 0x1094517D1254B, 0x6524FD96AEFA6, 0x602111E7DB18D, 0x0CED12D27D410, 0x7D37C942B5F56, 0x34F38E7C3E08C, 0x56A3FB4F65BAF, 0x4BE9BF9B8FE84 },
+    { 0x7CE55A4224AEB, 0x10BF509275256, 0x030521921C32A, 0x0755F5C688875, 0x6B9EDA6418678, 0x259C75281C184, 0x6FB58D810FA29, 0x207F2F52C2E15 } },
+  { { 0x074E992561F38, 0x36780ED4E881E, 0x1D03884532A3E, 0x00FE2BD41A3FD, 0x74FA9239877D4, 0x6F6CD32973119, 0x5C100CD198CB4, 0x3E8CBA8FA7B3E },
+    { 0x2F16FB9B29A8A, 0x5996A48A664FD, 0x4BC84988255C4, 0x769A5EEC1316D, 0x53F2DDB113079, 0x28C33148B79BE, 0x490A281A233E7, 0x1137A7C6F74BB },
+    { 0x2D4103A9D2F0F, 0x5B10F764C39EE, 0x268E262E9390B, 0x6308C8DADED93, 0x2291C49B080EA, 0x0222EDB53E108, 0x1CC3DBBC55FAD, 0x463B3BF8E0ABF },
+    { 0x0507671C21A57, 0x34A204798F7EC, 0x01B4D6B4D27DA, 0x0D9574BE47A62, 0x2DA0D7151EEB6, 0x5105977F41518, 0x7871330201992, 0x1D25A5BFDC042 },
+    { 0x3F6B011230E3C, 0x014721D0ECD8E, 0x665FAF4DDB10A, 0x1957209117C97, 0x65B849BC8C879, 0x452BC35EA700D, 0x3293912DA027F, 0x4B73D8314E7C5 },
+    { 0x574CE40DBD6D8, 0x10B8AED526D30, 0x0CEFCDEA630AE, 0x17706FC9DFB7A, 0x16E4181123503, 0x30B4669116218, 0x1A8F0BACBB8A0, 0x2A64E22E4E1D8 } },
+  { { 0x6F64B53CB027D, 0x238CE2E713CF6, 0x7B1424ECDD7F2, 0x5FDDA9907B444, 0x666F9A437015B, 0x49472D48443CD, 0x1413636B1C9DE, 0x199B2BE864764 },
+    { 0x511C9F86E786E, 0x2E07BBCF6B4B5, 0x125F6DCFAEDA2, 0x49C179C8A6F1F, 0x4E238EF674422, 0x75FD537F3F18C, 0x653946A8FB86A, 0x1E5EC39D17690 },
+    { 0x65A66A447459F, 0x5DE216A941BBD, 0x5F2779B991E06, 0x7A282D5FFE3BB, 0x27597384A7695, 0x357943BFE51F6, 0x329D203F9CB1D, 0x05763C3470919 },
+    { 0x3310979CADE2F, 0x6BA7BD2CB5A4F, 0x7051602552559, 0x62FE0D6427023, 0x3A5EC34EFF3E7, 0x4F2A97D1D6D57, 0x730BFF60BD9C8, 0x7969B1EA22044 },
+    { 0x208A47755CBE8, 0x734483F82F69E, 0x312691B97BAC4, 0x36D88A8F182D5, 0x55AEB2B8A6E74, 0x669E3CD555E8D, 0x64E143299C156, 0x7058D38911AD4 },
+    { 0x42270957C15BE, 0x09B6999C392AB, 0x6F2FB838E8EB5, 0x1D450F3B7FD85, 0x75CDBD5B42D8F, 0x27A10EF8A780D, 0x60D0915254364, 0x1F1E893AEAE71 } },
+  { { 0x47EE849740A1C, 0x5EBA04B3E51C5, 0x495C98776C46D, 0x18A33C0E0BA75, 0x0D3AFD248C77C, 0x4857B7EA7F7F7, 0x28A40FEA1305D, 0x7751EFEC968E7 },
+    { 0x3F7BC0EED5363, 0x686E59B408E46, 0x160749AEA1D45, 0x55B26F12CABA1, 0x642B0CC03D0C3, 0x311A0E66A79DB, 0x62ACDF63C6EBA, 0x434CDE2505224 },
+    { 0x691FCCD837E76, 0x20D9FA4C85763, 0x388A29027293C, 0x0EE2900C11D63, 0x48F8E6CD76AED, 0x641652E4BF52A, 0x5D6B69AE7AC25, 0x0823747B8DBB1 },
+    { 0x40E157EDB2543, 0x6E52764BD0CC6, 0x3D7CE4AA9D1D8, 0x3761177907D74, 0x6ECFF34C3A709, 0x702EF2E19A42D, 0x3EAC79F7F8A45, 0x3F0EC11239E4B },
+    { 0x6EA03EBD26E78, 0x280121BA24E0B, 0x71E5F307FFA76, 0x608C181BFD09E, 0x20452728C7848, 0x00A4C51CE9613, 0x77CB912D6A2CF, 0x10F4A5AD3D61A },
+    { 0x09FEA65795DD1, 0x11969759816B1, 0x7352D0CB96A1E, 0x0FD3EB0EB0B07, 0x05565B8382BB4, 0x28E26CCBBF0A9, 0x50F9532D40815, 0x2331D2CBD0D5C } },
+  { { 0x6EA4F95FE4AE8, 0x4EF29A535B3E7, 0x5721F9DE26C08, 0x1D90B00A1FDCE, 0x179BC709CC3E4, 0x0A017087FE733, 0x4801A8DF8B0AE, 0x01550C8B34C3D },
+    { 0x41B7DAE3A6F1E, 0x5CFD71F7743A3, 0x56CD808FC2429, 0x75059EE41A7AC, 0x5C3C495A25674, 0x0AB8B658A11B5, 0x13025201ABC9A, 0x14FD240001598 },
+    { 0x3FCC2CCB6E1FC, 0x60C0EF1964F9F, 0x0B65FD8F6E31D, 0x0B20C00B49864, 0x51EE8F578EE1F, 0x0A757C1C650BD, 0x428E9805D4007, 0x7C193AE5C0D20 },
+    { 0x7B95A09741212, 0x4D4BFDB17E653, 0x28A3D389B9B59, 0x71FFBDB397E0E, 0x70289F8CC7579, 0x603613C723CEC, 0x5BCE8A7118BCD, 0x5DF003B222067 },
+    { 0x7313EBB45F750, 0x318E73B5F76E6, 0x08EBEA3E755A9, 0x106CC458FB285, 0x292022C62E0E5, 0x0C62B3CFFA14A, 0x46B99A06D8169, 0x48B04A0E96E61 },
+    { 0x4D9FEF844B974, 0x19763E1863137, 0x13536B93FC871, 0x1B6F9653341F4, 0x66FD96C6F61E6, 0x28A94FACC87CC, 0x5F027DE428405, 0x327CCABF63AE7 } },
+  { { 0x00046BF1690F3, 0x0D5E9007D3012, 0x22E73B7A55BA0, 0x615F24A4AAE3D, 0x069A97EE4223F, 0x0604F49EFA8A8, 0x03C2162BCA32E, 0x4B21FBF5BF172 },
+    { 0x2E203B0AC14B7, 0x3E086D7BE566E, 0x68031D6AC130D, 0x5247860E5BAFF, 0x4A612E65EDDBC, 0x57A1DE6A386BB, 0x3F32B0A59C179, 0x5C1598EA815BE },
+    { 0x4E6E9568F44F2, 0x17C63ECE98A95, 0x2FFB4194E47A4, 0x0B42E1DC08561, 0x6B18F31C91803, 0x509EF071D797A, 0x174D393943FF6, 0x06CEF5E322190 },
+    { 0x289AF9107204E, 0x6599BCE5D2555, 0x1BD5F87140A7E, 0x5694F10EF4349, 0x300B503018E74, 0x5AA15A1479601, 0x39C5E8CF7DFFE, 0x1BF888C0012C0 },
+    { 0x60B224E38AA4D, 0x6C48A119B20C6, 0x5EB0DB1028A97, 0x4359FAA1046AC, 0x1ADB40F39A359, 0x762BFBC7F1961, 0x10C54ECA97E5C, 0x67FAD3187BA96 },
+    { 0x25F62A0A097C2, 0x08B678E159152, 0x7F4F2299DF5FF, 0x19F4EA9B5667A, 0x57B8FE7EB32E2, 0x20F595252D26E, 0x3DCE18350406A, 0x241FBBD26391C } },
+  { { 0x6362024B37C37, 0x5BFB04446382B, 0x414D98448D621, 0x4E07066B5A923, 0x5B3FE863A190D, 0x47A2F6F7B23AE, 0x0F9ADD2080313, 0x2F340C90C9A7F },
+    { 0x265D89B30AED8, 0x0BE33C13FCF9B, 0x441E4DBF64C37, 0x10DDF02EE10FD, 0x6063F7D51B818, 0x0C4CD3B8530C9, 0x788DFE7EC6D74, 0x518C4390F6813 },
+    { 0x6A32F081E3FE7, 0x41F1B035834DE, 0x5E0C8FDDBFD99, 0x29A6F92AB3D36, 0x1F2171D690677, 0x6B62F351B36D5, 0x05F588B5A1067, 0x3CD6BB6A8AE0B },
+    { 0x07946CB972273, 0x27B959B758C27, 0x0BB92A1DA9B8B, 0x3FAF9AE4EF56A, 0x7C1FE72532FD4, 0x239BBA3E2EB55, 0x72E36BE52A8C3, 0x25EF8D9EBC3D7 },
+    { 0x1DE3AB0E1D93A, 0x5C9EC822AF07F, 0x2D0C23C4CCD4C, 0x514AB6DDA224D, 0x3E52E15AB197E, 0x7FEF2C59FD2DB, 0x09414A98CA375, 0x69E54CD858EDC },
+    { 0x3F339B86FD828, 0x18EA24183D2D6, 0x5C733730A1B9E, 0x1455483B3BA0A, 0x54A7F64B9A2F7, 0x32EC73B659164, 0x47C00B2D2CBCE, 0x2F589B70AA3A6 } },
+  { { 0x3D2DABE23F6ED, 0x4AF960DCE4422, 0x13F2B87CD2D9F, 0x09B0AC697085D, 0x532E78BB020ED, 0x52E158402B539, 0x733CCF317DAE1, 0x5783975FC6A1E },
+    { 0x10C85796AACB2, 0x427485AE7E923, 0x28F008F4D653D, 0x78BFD4DBB305D, 0x49063A0302409, 0x05647BF23204D, 0x50CBD534338CF, 0x0167EDB735BC5 },
+    { 0x57E7AB51CBEDA, 0x5F7337F347BBA, 0x7AFC34A7E9C44, 0x65E327848DA40, 0x6B5F110995943, 0x422B13999AB14, 0x1170F39899CEA, 0x37B46ACBE0D95 },
+    { 0x7BD14605F64C1, 0x33DCC5DA87083, 0x46677D25CBC3C, 0x43387AC9B1E83, 0x19A2CDEA21ACF, 0x41628F01B0510, 0x058876B78869E, 0x620944B9AB7CC },
+    { 0x2BF91E0B2978A, 0x3E9E36E1E72E4, 0x3B3F7953092F2, 0x01FA2CCE79284, 0x7E09C065D6806, 0x5BEA9772C941C, 0x6AEEB2691C33B, 0x517430DA3414B },
+    { 0x01328E6317702, 0x0CE98E1BE815E, 0x5DC2EA4039432, 0x165DB488C3D5D, 0x42234BC133165, 0x1CDD99C5AE197, 0x372F72D8F25D1, 0x24DAC46AD0FBD } },
+  { { 0x12840361E9153, 0x2BD3721443F60, 0x0288B05FAB1D5, 0x2F94DBD1FBBB4, 0x1146F95E9A3F3, 0x1FC7BBD6F429A, 0x13A52EE6EB419, 0x282AE4882718A },
+    { 0x4B7105B438B55, 0x3586C7687E5D3, 0x6956130665813, 0x280E569886FB4, 0x6D89A0F56BE6F, 0x2CD106B361A22, 0x57AA7CE1BDD60, 0x5C5AF506BC492 },
+    { 0x051EAEEFA9224, 0x2332C29828199, 0x21F3AA5096B73, 0x1AF9387A43DA8, 0x6B70B46AED91B, 0x072C1859C9EA5, 0x310476B398983, 0x0CB78B5AAC3AF },
+    { 0x120F976A8781A, 0x1A248540CF0D8, 0x6259DD791077B, 0x2F6F50A31B0DB, 0x563A71A4A0FE8, 0x4BB008D38B93D, 0x1F432295982C5, 0x5394A8A293B5F },
+    { 0x187081527598E, 0x5D84E8CF57C06, 0x414643CCF5267, 0x0882204429617, 0x7820918A64DFB, 0x06C9359005AAB, 0x5A48FDA6209D2, 0x1C96DCBF0B969 },
+    { 0x6A91FD133CCD0, 0x128E2E65ECE61, 0x4299735BB2A5C, 0x0ECA5EF9E1C11, 0x03DE822A57967, 0x16E9E4C4ECD93, 0x3966EC19E10CD, 0x2BF3886E4E80B } },
+  { { 0x2BA52D7CEF657, 0x67A4803E9DBCB, 0x595A41A2E2183, 0x709F86DDFE999, 0x0C6BEF288F10D, 0x72C16ACDBA423, 0x2D616B2493245, 0x6DAA2BA690696 },
+    { 0x23CFF7FC7287D, 0x63B0CF5A6A7AA, 0x32FF2932FFDEB, 0x1058644BF4AD2, 0x01B86291A4D3D, 0x6C54A849AC039, 0x4933D8E4FBAB7, 0x1CB87AAD0B8F5 },
+    { 0x587F81A0424AB, 0x23CD346DA26F4, 0x4AADE4AFB927A, 0x42FABCEFD4772, 0x5F899D23BE128, 0x299D9D1F0887C, 0x79021EFA260BB, 0x4F10C2EE9C1A7 },
+    { 0x0670BF13F3622, 0x255A3241F1D9C, 0x7534CD26A124A, 0x74D9BE719B303, 0x0495421AF5511, 0x449D735B98AD7, 0x5653D000CBA88, 0x6831DE9E5E7DF },
+    { 0x22725B9C8428E, 0x5424F660D95F4, 0x761274B2DF1E0, 0x2AD821FF93B3C, 0x35AD15000207D, 0x424FAA952C668, 0x2E6F1334A0208, 0x0EA6A4BF7CE73 },
+    { 0x7E5E56C2F575E, 0x1A6FC63E9AF4C, 0x7F13E1A50BABB, 0x198DFB489A57B, 0x2438EEBB0EDA0, 0x287457001B8DB, 0x2A70C418EEB38, 0x2D83956056765 } },
+  { { 0x694244F98BDD1, 0x4561E0070B2FD, 0x51B48E8718A14, 0x30695153AD22E, 0x0DE21746E4FB5, 0x5C61B73F2052F, 0x00CA99698E318, 0x70DEC6E67DFA8 },
+    { 0x0AF40B40AE6A7, 0x76046B46F98E8, 0x6A2BD4BD6BE16, 0x1C495E4DAD910, 0x75FDDC4C317E0, 0x0C699BB8A3158, 0x44A6B1FCC5154, 0x728A9557E712A },
+    { 0x4937BE6A08764, 0x65557A5D5031C, 0x1E03361813911, 0x2BE72D8A96325, 0x0622961519C1D, 0x498C411D404C4, 0x3B5DF81C6D17F, 0x2137D2DD08229 },
+    { 0x3D7110C2C9FB5, 0x1B2144EE02C25, 0x4116DC6DF86F2, 0x065B42BA80985, 0x7FFA47891AF49, 0x6CF7979FA6AFF, 0x1070F092271E1, 0x0CE11F308B6D5 },
+    { 0x05FAB67B03A64, 0x729CCFE7D3F1A, 0x38B3B556AE85F, 0x7BFF057F36260, 0x21DF8741529C7, 0x63E2E9C06F9B8, 0x5F63D9952B940, 0x312F15BED8762 },
+    { 0x0B588CCD69AD1, 0x173647D7DDAB2, 0x459A4B804A30A, 0x05D1D1D86CDC7, 0x331BA8421A82E, 0x2C1677E171BD5, 0x361136035AB33, 0x2785B71FA731A } },
+  { { 0x2C23915D7CF2E, 0x558AF0DF53197, 0x548EE42572894, 0x52584E5254B3C, 0x7DE026FBB3384, 0x15F74C4F47A32, 0x40A1C45202D9C, 0x7FAB48061C5D2 },
+    { 0x30B30F50236D4, 0x0B5E725336621, 0x0A515516E3254, 0x2896681BBF65E, 0x08280FD9EA37B, 0x66E6323630D60, 0x6A18349FBC28D, 0x10AB33D6C1CDC },
+    { 0x1EE146D20D4A3, 0x5475446CE8F14, 0x3E567A1F5860E, 0x423A8379054C9, 0x598F581E5922C, 0x1F632C4B43623, 0x67EB5F44E2F2E, 0x3D7BDCF7F90A8 },
+    { 0x27F1409A5BD70, 0x7D91432149D62, 0x767CF56661716, 0x008A6A2EBDFA9, 0x74DFBC31CDD3B, 0x0641DB98A6EB9, 0x2A49B2F40E698, 0x10A259BD6F3B4 },
+    { 0x120A8BAB2E492, 0x138BD8B183E13, 0x6C0D79C905053, 0x527E15897AA33, 0x32BA8D367C172, 0x225A4F16F18C1, 0x5C80E946C96CC, 0x5D58393D8DB62 },
+    { 0x4B8D9C3313141, 0x2004FA1CF50C1, 0x0FA7ABC022634, 0x0BF1633922EFE, 0x0BB09CCA9CAD0, 0x2D84F5974FDF8, 0x067BB5090BCF5, 0x2E54EE2175D55 } },
+  { { 0x025875B935487, 0x03D651D97A2EE, 0x432B9BD73AF86, 0x6A0D6185E737E, 0x6D6128A78C425, 0x0C6EE44F9716C, 0x655AC74704FB2, 0x57F65C5D79BF6 },
+    { 0x459A5FFD1E037, 0x05AC722935358, 0x5098082D68113, 0x628B6670BD86E, 0x054C8AEBE609E, 0x5627B8EAD7FA0, 0x6271A24C43EB9, 0x03D2487CBA6C0 },
+    { 0x0B67A9FF609A3, 0x2691C041F5990, 0x534BA521B915A, 0x75628B1FA01D8, 0x684D7D0A589FA, 0x1348018012F49, 0x3D545DD21ADEF, 0x55644CF584573 },
+    { 0x2C99E49FAC91C, 0x09630DEE8C638, 0x679BEFDCA85EC, 0x34FF9E3788E79, 0x5C6F178970743, 0x642A8EB7718C8, 0x534B48761E55B, 0x4522BCE00E79C },
+    { 0x23E2D2C1B8ED6, 0x54EF728BEB5E6, 0x0FAF8728F0DAB, 0x1104A5E5C3F56, 0x03267B1E9C219, 0x0C14C783B88AD, 0x3A7EDF311C40D, 0x70EF3A4E5F4A3 },
+    { 0x15DBFB5CD2548, 0x1A673D9F510DF, 0x739611E82120E, 0x178ED64B107D6, 0x0F318BA6F5441, 0x22268A8A2AC13, 0x79347D33C441F, 0x1AB77B954BFBF } },
+  { { 0x5997F5F5D7294, 0x1C2E79FECF5D8, 0x2DC38F363D1BC, 0x6AACD6B285307, 0x157AB9BE4434C, 0x29CA5AA900A69, 0x0704416E5A174, 0x7DB0C6300B297 },
+    { 0x27A3E13404F7E, 0x64D39119D1924, 0x6B646C2130B5E, 0x1E633A768C1A6, 0x7F615D80F21F2, 0x3E99E588BEAD5, 0x18F01A2696F9D, 0x7CE3100216FC6 },
+    { 0x68548F36B71BD, 0x4985947CA2D48, 0x6109175525062, 0x21251451B09D4, 0x7376CCEC4BBBA, 0x6980869E4AF18, 0x55E166B3527DF, 0x0C4E9455BA02D },
+    { 0x65F38210C5718, 0x7FC302277EF45, 0x45DE80246D1A1, 0x6B1B2F0302C0D, 0x0EE4CE4E73C53, 0x484E99CD14C80, 0x2A0F677A61792, 0x33238847A0784 },
+    { 0x65BD0746D5056, 0x4FE0832710F3F, 0x1401347A4F07D, 0x7FB218DEC1D33, 0x19CFAD6FEFBC9, 0x3089DBBE6CD09, 0x57F26D7917C12, 0x151E7F9C4D896 },
+    { 0x407DEAC6B1AFC, 0x15635B9878061, 0x1C65E6F71FDCB, 0x0A9C94EEBAFDD, 0x70655AB21F1B2, 0x2957FB2F01ADC, 0x7200A5C8F91F1, 0x2F4D4D6FF2734 } },
+  { { 0x58B178F957A0E, 0x59847FC70A863, 0x34F4DDC55835F, 0x2BC03706D8DC1, 0x5A11AD258F19A, 0x0127D41749855, 0x2D4EF94A6F9EF, 0x0256D84B7EDE4 },
+    { 0x0E1BC0F8E63EE, 0x5888ED3570297, 0x3C82038CA7DD8, 0x041BC5683D446, 0x1C9F39ACD08EB, 0x462C0E62F8CAD, 0x40CF35D1B8A63, 0x19309B35FFC9A },
+    { 0x07F42A8651B19, 0x156F9373D0473, 0x57C65D9F8055C, 0x703CF857974C4, 0x5A1816C7C6185, 0x33AC371E03CD8, 0x2CC19F3C3AD83, 0x7AB4C3E82178F },
+    { 0x1AA4ED9CB8840, 0x2B94295525F1A, 0x41F0D4FFEF20C, 0x39934B60062DE, 0x6814FAE7D0DF3, 0x397C8614CDF3A, 0x70198BE10E7B0, 0x59834C51BB396 },
+    { 0x04273BE91DD58, 0x4771B2FBC2A21, 0x114EC0D290EC1, 0x7F22509FFC517, 0x2B9D3683CEA7F, 0x6D0292CAC4F36, 0x63DAEE8DAE616, 0x4B0CDD310C13D },
+    { 0x2732B64307553, 0x139DDDD508D39, 0x43FC9EEFDDF34, 0x13AFE249CA26E, 0x4878C62261887, 0x34A701633F955, 0x020EC0D792A7D, 0x1E3F96DD681DF } },
+  { { 0x34143C89C153D, 0x31896FA2EA9B0, 0x4C6C6B421E542, 0x41AFBD09BCE4F, 0x7D420C312A8DD, 0x0E3EAB9203E98, 0x7682085D63332, 0x0B12C84E52A41 },
+    { 0x5E9700F93D7FE, 0x293463CBCAFB8, 0x7DE823784A3A8, 0x5E9548B4EBBE2, 0x292A1460EB22A, 0x1BA8664924783, 0x4F179554C160F, 0x3779C6D185AA0 },
+    { 0x0F378F05CF538, 0x4DCF5A1E203B1, 0x3D3DFEAC65F21, 0x358733CBDB30D, 0x0D4C1DF0215D3, 0x042F6F69265B8, 0x51038D9DF1C48, 0x5E7DE296C7D9F },
+    { 0x7925AC771C6B9, 0x67BAF177AD405, 0x1938CB5523EEB, 0x54C0757B51007, 0x02EB157E48D0E, 0x0C60C010BDE27, 0x286AC1580D00C, 0x592574E616DE9 },
+    { 0x5765AFFC7EAFC, 0x4065A9D3CCC00, 0x035799703ECE3, 0x20B420519A3F2, 0x10A59D3C81521, 0x1EFC8549D6575, 0x7A12338FA7551, 0x2B56B1BDCF286 },
+    { 0x54DF8B2A15E26, 0x116DB73A162D4, 0x32F4A005FD6FB, 0x12BFF69682ED4, 0x2FC1922F132BE, 0x18DBF092022FB, 0x05A0D16812140, 0x2234072C23766 } },
+  { { 0x17B36E3E93D44, 0x274B80FBDA64B, 0x4D41673B1D168, 0x6B2E5CBF83CF3, 0x106199533109A, 0x2B72D615DA5BC, 0x791166F99505E, 0x72EA15C920799 },
+    { 0x3B9E1895591F9, 0x0D52CFE5254BB, 0x3F9BB1C5F085D, 0x068A0B9E7935D, 0x1D7D15CF1F0EB, 0x264868E2C1418, 0x3BAA04CA06EF0, 0x77185A44F67C9 },
+    { 0x42E7C0D05E093, 0x07A817EBFBDAC, 0x0CC34EA0507F5, 0x6B55E08880422, 0x6305A23E06A6E, 0x67B0212B436D0, 0x20DF178C2E793, 0x4922926F48561 },
+    { 0x106579056060A, 0x6BB307321BEB2, 0x55E21EE5D5028, 0x67047CFD6ECF7, 0x4BC1925D71C2B, 0x4342DF0B7EFA1, 0x6C1F3E79CB73B, 0x00FEF6C1B1F5B },
+    { 0x77AF2B5F32FC3, 0x2DE8EE7B5460F, 0x3C0338824CF49, 0x560D56A68D9DF, 0x0CA5C953E143A, 0x017FC66057B0C, 0x4D63E99E3B56E, 0x48829F06A6807 },
+    { 0x21E9DBF23F1F7, 0x0F8C0527E7AFA, 0x07559EDCF020A, 0x1B3B62E5E496E, 0x4E43C754FCC48, 0x36366CBC98AE9, 0x6A1EE374E3ECB, 0x2D476E0961CC4 } },
+  { { 0x172FA9946A577, 0x2D4F702FDFFD5, 0x2B0FDD8F19230, 0x298C645698D91, 0x41A21ACF511DD, 0x37EBC925EF2F4, 0x5F5DE95ABE62A, 0x305B2B2714B12 },
+    { 0x0DDE57943290D, 0x4F0A67251DE72, 0x167F15F273343, 0x1548428BDC3A5, 0x494E9410A849B, 0x32CB85426F58D, 0x5010EC5FC21E8, 0x2CDC5A0C74395 },
+    { 0x772B5B66D5824, 0x5C18B48CFC220, 0x4286FFCBD7B04, 0x4726DA8000857, 0x3D82813C3347C, 0x17D48F897A76E, 0x293591A5C103F, 0x75AFEACF6D5BC },
+    { 0x0123F26486833, 0x52B0991B16F84, 0x04EEC0846C87D, 0x2E213AB258115, 0x3BCD40A7ECCED, 0x15B7F8514E372, 0x7042240D0D6B9, 0x1612DA366A777 },
+    { 0x13D7B178C9EF5, 0x1C01AEBD3C987, 0x6B71415A19279, 0x4EC6DF54617FA, 0x607DC5A10F5CB, 0x27C7F09310370, 0x19CE7A78F4428, 0x3594CFD196B0B },
+    { 0x0BF97B659389E, 0x167E0E957C90A, 0x1902B2348CB5C, 0x0F2CB9DB0B467, 0x5F3D6161D5DC5, 0x2AD55A2D6B9C2, 0x2F0B6D5EC6968, 0x1CF0EE02197C3 } },
+  { { 0x5C208E9FEC7D3, 0x7021F37F22D4A, 0x4A49E6D320904, 0x29404C214DB61, 0x115ED96A831FB, 0x412AF621AA81B, 0x00C8FB76D1E84, 0x12A8E045026C1 },
+    { 0x0ECD8DA947D1C, 0x0B525BFA22639, 0x509C59D6CFB4D, 0x7660AE617ABEC, 0x0A37B4D78B2F5, 0x0B27BF814E62B, 0x6B64198E0CE1F, 0x5768FA70433CF },
+    { 0x3AA5E9432FC89, 0x1944D397634B5, 0x370CAE61422E3, 0x3FC4866186276, 0x1CBF7239ACAE9, 0x743BFA663449A, 0x7740A395B15C9, 0x78115E1C7E197 },
+    { 0x68F45BA5618F8, 0x681DBBDB64082, 0x68E8BFB4AE99E, 0x053B67F9A36FF, 0x561416C4B6198, 0x4CBB65F659BE8, 0x4AD94EACC8AA0, 0x47DF2E9BC5E54 },
+    { 0x59C21611A8CD5, 0x43BFAA737D3E0, 0x41B3C8DAE3CF6, 0x58269B57DA12F, 0x22D21C128C109, 0x31FD0E5977574, 0x7628FB4E9AC92, 0x0E9BCC4B12993 },
+    { 0x60700570F1B39, 0x02A8AF04E2A4E, 0x6D16C0D061B99, 0x05CF71690F634, 0x34BB3A37CF8B1, 0x2593A2897DBA6, 0x708E6BAD4D37B, 0x2B2DF3E659C33 } },
+  { { 0x00C1299D5DC7E, 0x677E62982C397, 0x13BDDC1BF0857, 0x6BC093BE1FC77, 0x52960858334AE, 0x3CB69E2273772, 0x3DF9257DA33EF, 0x6B28A0FF24150 },
+    { 0x5090585B37E20, 0x77634E21E5033, 0x77D3DE52349C8, 0x76C5C0B5FBAD5, 0x78AA7C8C73198, 0x0001AAB816081, 0x6493840DAEA61, 0x7C50EF81D28F9 },
+    { 0x2F3F173FEA69A, 0x75DE4224AB13E, 0x13110D820B54C, 0x341F3428AA001, 0x57EB0FB2D762F, 0x4D9193060263C, 0x54AA04CE2C40C, 0x77E99856F1511 },
+    { 0x4F83F6BD83736, 0x2F610FCBAF3C1, 0x189D3417B9D4B, 0x7D7AC5379F91C, 0x674E3A106DD65, 0x549DD6BAF1FAC, 0x4E505C7FEA6A5, 0x36FF5B64CDA7B },
+    { 0x09FEF838170A0, 0x786411C41D256, 0x1DC644EE2AAAD, 0x01D6B32792684, 0x75A93CBE2DE5A, 0x01BC96FA90748, 0x3797470EC4090, 0x1F5BA28F5C909 },
+    { 0x739725BBCDE84, 0x1268CECDA5BAC, 0x2D6E52412B474, 0x1B449E864F692, 0x10108D4219BAE, 0x1F81BCCF4EC10, 0x7D585AD20D030, 0x223BCC7277F4F } },
+  { { 0x5E5C9C98CE1E3, 0x23F7FCCF77D8D, 0x3A5A474E2019E, 0x156B912F6E6B9, 0x2F271A88B1477, 0x7A02AC4914BF0, 0x4802F5FEB013E, 0x1B23D1758D0E2 },
+    { 0x564A0B95DDF02, 0x1899A7A0D7844, 0x0EAD7A5FBA102, 0x758DDDBCE9F57, 0x3051B047A8D98, 0x3C3430C9D527A, 0x6E967DF07F5CE, 0x1B728E58D7A7E },
+    { 0x38045F08AE408, 0x731DCC6F9BD82, 0x254391AB188E5, 0x0F3BBF56EFF2B, 0x24EF9B2AE90F9, 0x1D8AAFD6A94E0, 0x49B80BC264FA3, 0x1C5908CF8694D },
+    { 0x6EA5D707CBC14, 0x63036137D605C, 0x4A9F302A6F92A, 0x58604D4E0714E, 0x18F2B4685C8A2, 0x3BCF3BE1BB809, 0x3BA2B66874B90, 0x5920B352C31EA },
+    { 0x124225AB11701, 0x265B3E8B180E4, 0x2E7BBDFCBCF02, 0x78AFCBF05C963, 0x65474C9246AAF, 0x6E4CFE6A82D78, 0x02AB45674EF28, 0x656DBBE9C1039 },
+    { 0x0312B476BB187, 0x00773E8092871, 0x5484CBC8E82BD, 0x17B3FC327DE9E, 0x12C415719919C, 0x27FCBB00162B6, 0x3D785E471BC18, 0x35059CD6FEE0E } },
+  { { 0x33AC451681B70, 0x29C90630D2262, 0x4EA1E71196E14, 0x370E69C3AC36F, 0x2E852ADA5667A, 0x4301628F32CC8, 0x622399D0DFD64, 0x5D5D2F22FF390 },
+    { 0x0AF6028F549F5, 0x5E7CB1BB0A1A7, 0x67259113488FD, 0x4991F4D299DA4, 0x6D7C5AE75AAA6, 0x50383F271FA43, 0x272FFE29D53F9, 0x1842C6C8DADE2 },
+    { 0x069EB08F63BF1, 0x02F14FBD74682, 0x18CC2112CCFC8, 0x271FE24B9274E, 0x63E8F7D06F78D, 0x0941C8D939D17, 0x5DBC89D9B63C0, 0x4074FC9C32C1D },
+    { 0x7BFD6A168389B, 0x53B6521B0327E, 0x1E84FE126D3B3, 0x5E0D602854F1E, 0x68F7023099908, 0x11EA3DFD72E1D, 0x56C75F386CD2F, 0x5AA77A7E37153 },
+    { 0x730E48BD58CBA, 0x755357B9F1C2C, 0x779260D015945, 0x5393E2A961E13, 0x7AC6DD2DC6797, 0x44BACBB166912, 0x7FE11B88F47A9, 0x5AEA02E03C3CF },
+    { 0x05F4F319630CC, 0x21DB9F6EA5B72, 0x711CA3F0EF0A6, 0x1851CA71F5B60, 0x3115BA0DBB10A, 0x28EFA56091E17, 0x62331D1A69CBD, 0x34E9E9A763AEC } },
+  { { 0x0B7B2710DB1EB, 0x476FF11B11239, 0x1F1D407AA6546, 0x1F00CB6AEA050, 0x0AFDAF99CBA8D, 0x67C0D905EF0C1, 0x27429B39424A0, 0x09FB297843103 },
+    { 0x047E7515AD012, 0x55D8D7DED705F, 0x1E86D2BD011EA, 0x0419651D97161, 0x717C724360464, 0x1C29EDC4C6C1F, 0x5A718E892A6FB, 0x18B41E840B447 },
+    { 0x3EFB81BA8EA05, 0x3939A8F7A5E87, 0x7F211C0D63037, 0x1E159FF6E78DD, 0x61FAEE7362A6B, 0x4F13BD679D77E, 0x2FB90A44A7C0F, 0x07765BD8F3D08 },
+    { 0x34C3A9637663E, 0x04DC1583F910A, 0x0C3B4886D91CB, 0x6CA9D7C170F40, 0x47FDFCF8CBB81, 0x584177E026626, 0x67821D16ACF1C, 0x535E9E6D18BC7 },
+    { 0x5B6DB6D2C183E, 0x3A006D8FAC521, 0x70CCC2276696C, 0x1ECBAB519B3C8, 0x05CC9AF8D7A4C, 0x72F3338D9D4DD, 0x2F214AF4BCAD0, 0x3CE90B442A8D4 },
+    { 0x47334E1C8A502, 0x1A6F8F252C827, 0x3F3EBA6874675, 0x129E41D044A3A, 0x0990EACA029AD, 0x31C692288AE84, 0x6A7093DC5BC5D, 0x37B7118DA6756 } },
+  { { 0x2AC23C5D5F7CF, 0x364EC6504D1E7, 0x07983E76D4F33, 0x430E2A528AD0D, 0x0222F274C5EC1, 0x1D3B1259B77E4, 0x4CB91976D9F31, 0x45B8CA3EBEA57 },
+    { 0x6544FA90FF28D, 0x05D96302C6076, 0x5BB7BB9E2B2F0, 0x30F8A491FDF0A, 0x67A841C05D9F1, 0x4653C0777E0D4, 0x208C74FCA3606, 0x56DD3D60C5F68 },
+    { 0x2CBAF9C86F371, 0x7156E6584BB32, 0x50C1ADA6D19BF, 0x5CA6DE8E97A11, 0x664AB365AF973, 0x0FC95D4107B9B, 0x47E558C728D9D, 0x7CEA18972D6E5 },
+    { 0x5121F005A9258, 0x736D29114FF51, 0x64851ED4A4268, 0x2152946C6D9AE, 0x6AE29E1D0A19F, 0x5AE1E44D7E9A7, 0x3490A0B1B43C2, 0x546E9E97E1385 },
+    { 0x11E4AE26A6A70, 0x3A2EFC7C0F950, 0x347D0FD217D71, 0x52EAE8CAEC12A, 0x12C3A94BB3305, 0x65A7F8D58D795, 0x5D7A4A0F6B13B, 0x34FEFC8B6A9FB },
+    { 0x56972AEC257A1, 0x0EBE9E3C9CC31, 0x69CCE924DC380, 0x12D20C1188402, 0x2568E22F4E58F, 0x1D91D1AF18694, 0x217EAA6445C7C, 0x1E0173EAAC3F5 } },
+  { { 0x21D9590C91D00, 0x55D69963145E1, 0x4E5D4A352C400, 0x4229B0748CECC, 0x1E9D6494E0F70, 0x78F8DDD9E2D35, 0x63BF5EAFA2D7E, 0x2326B92AE6F3C },
+    { 0x39711CB5FADC4, 0x2F6D9F31CA608, 0x4F43F37977589, 0x6C1780FAA17CF, 0x27874F6173168, 0x7BD0A8B871022, 0x30DC1A58FB070, 0x511807D9524A5 },
+    { 0x4F7A4472B99F0, 0x42CCD1CE95152, 0x437287DB4C93F, 0x232390499BF03, 0x7EDDC2B8F7CED, 0x5250EF9087AB3, 0x1078335DC3035, 0x4CA28780993E8 },
+    { 0x3241178DEBE17, 0x4EC9801F13648, 0x350AF67C767FE, 0x0400CFA6C8CCF, 0x0FC4665B7AE28, 0x5F1D40C2789F8, 0x0863752771775, 0x0977CF840112E },
+    { 0x6FEFFDDCF942B, 0x1BEF57AC52A4B, 0x32E5B37E7D539, 0x0CEB0B8284EB7, 0x34EF68DBDEF04, 0x0F14A7D798744, 0x75610539C5DD8, 0x1747B991B6AA8 },
+    { 0x6D49BAB03B18A, 0x2334009C57FD0, 0x0C30077D384A5, 0x10ECCE6D6F353, 0x564C9161508D2, 0x23B3F5DD081D0, 0x098D002568ABA, 0x36D49C161AE4B } },
+  { { 0x148D31BA824C9, 0x70F72A43650F7, 0x7955C0A4CD71D, 0x1367A8EB43057, 0x794CFC0BE5693, 0x5513378391C4E, 0x2F7BDD3460E19, 0x5EC360461B280 },
+    { 0x25B1FEBD2485C, 0x39880CD37ADE7, 0x75DD0C79E97BA, 0x12B3E615756AB, 0x429BD43F185DA, 0x3045012AA59C8, 0x136B4616D8529, 0x7DCE5B6C2DA74 },
+    { 0x07FEFD6ED4B57, 0x5B5FD0D2E58BD, 0x5837C0DB785D1, 0x45A046BF61AE7, 0x26DB14F9C9706, 0x3F8C15312DB94, 0x484FFE0119F5C, 0x0B071E815FFD9 },
+    { 0x36C8BD2B13923, 0x3D01B59BCC442, 0x080ED8B719523, 0x0ED69169334AF, 0x77153089B9C99, 0x763641AB1E2FB, 0x65645450C997E, 0x20CFBA2E63AA5 },
+    { 0x5B768F51FCA67, 0x0DE9A1F460C52, 0x03CA09FF51BE8, 0x4AB973E90829F, 0x5BE5044F22EC6, 0x1D4E4AB62C7DA, 0x2F3DE836E6560, 0x258C8BBE5CC61 },
+    { 0x0F6D356A4007B, 0x1CB8AE283E6F4, 0x4FA244D34EFE5, 0x11D83B74D6D5D, 0x165455CB12B69, 0x258DCDCC35E4B, 0x1B27A7836C16E, 0x2C8E06D8CD96B } },
+  { { 0x350C441100A72, 0x692C044B4E565, 0x2F566086A8A68, 0x30D782B618F58, 0x5879E15329820, 0x1C8B4D896DDAB, 0x69A9002F9351A, 0x244CD17642C39 },
+    { 0x3BFE72511211F, 0x4E3C77A381897, 0x0CBB26F7C82BC, 0x62E5F69695E73, 0x7E2E981FE2545, 0x65F45E25AE0D2, 0x40772C259703D, 0x1C68151CAD608 },
+    { 0x45E54690684EA, 0x5CAC63B165384, 0x39D323D580DD3, 0x37766F7DDF3D5, 0x7BB9DDCD03709, 0x28DE7521E613D, 0x0AE756E15D60D, 0x1523286B64E3B },
+    { 0x345093A4D8AC8, 0x37424EAE7EBE7, 0x3A2D6E778ED71, 0x722AC31492455, 0x0F725D3BABA39, 0x2A43CC829F78D, 0x25F1C2C10FD82, 0x423AEABDCBE17 },
+    { 0x2DD0521284646, 0x3B9C76C3544EB, 0x279F8754DB106, 0x26F08AB62667A, 0x1E74C39F0282C, 0x33E3FD396C097, 0x052DEF40FCFA0, 0x559CE72B3B8A4 },
+    { 0x7EA01C94831CD, 0x19FFBE74DCDE8, 0x59D73C203F5FB, 0x137B833ABB8AC, 0x059FA8739BCCE, 0x31C86798F9CDF, 0x37C0E996832EE, 0x1DC7C67A5C1CD } },
+  { { 0x04D601E77CCD5, 0x32B1AEF1DA368, 0x0038D0B833505, 0x71C100BD7A627, 0x22A1F402E97BB, 0x40A38B08FFD5F, 0x4087F619CB449, 0x38A7551234227 },
+    { 0x6298E94F84B31, 0x7BB826CDCF295, 0x27152B4236B31, 0x48E2AEF4537E7, 0x18A9E6D69FFC7, 0x33ED5A25237CD, 0x5345E0FF3F620, 0x688AD02789B4C },
+    { 0x5C0F056A4C12D, 0x1396AA2E00B3E, 0x68B61A25DA751, 0x4C0F9F8B4AD35, 0x729DA7A54CF51, 0x099A5C146891E, 0x762EED25E3BAE, 0x6153DCB3D9E4F },
+    { 0x5CEA906A2C409, 0x11B6A15F6F6EC, 0x40E1A09A955AA, 0x7660BCB06EE10, 0x221D256D99057, 0x14F66BD2F2B8F, 0x5EBF927F53863, 0x486FB1A9EB981 },
+    { 0x2C495A7961F4F, 0x56F31D9D2B4E4, 0x5580F13C943ED, 0x1646ED988357F, 0x2503BBF936E9E, 0x5B29495B7E22F, 0x169570795DC35, 0x28F05B0475AEA },
+    { 0x033086BEEAF98, 0x13FA7552D8C98, 0x236C3362E7D87, 0x17F6FC9FE8795, 0x1BFE840C2C2DC, 0x36873AAB70065, 0x67B489A6C1F9A, 0x366DB8A0E1910 } },
+  { { 0x1EED6B029CD18, 0x5881E0FF7E5A9, 0x7463B1BBFB7C0, 0x3C692132B31A5, 0x1A008C73E49C6, 0x757F4EE7C119E, 0x591DAE9EEB254, 0x68A036C924749 },
+    { 0x7B8C8C296BB0A, 0x5807C9BF9CA2A, 0x60269670B8413, 0x5CDAC5E9A8885, 0x507D3A23BED95, 0x370D21125D096, 0x2D4233E5D7767, 0x6F6D0F328FB42 },
+    { 0x0E9E68E1F9F3D, 0x652889C34E966, 0x631B1D8A95BAD, 0x0BD26C2EE2CF0, 0x08A10B43DAD22, 0x1020FB386C1DC, 0x45BEA3D711DDF, 0x02DD56FF2861A },
+    { 0x72F7571A66764, 0x695D450A5389F, 0x3935D05CB177D, 0x7D87996A458B2, 0x67223D3F3D871, 0x4B7C10E35241E, 0x72814E98D47E5, 0x60FCA97E43C69 },
+    { 0x697E79A8FD8EB, 0x497680E8C734A, 0x0D4AF2D2B1D9A, 0x1E3B41DE0282A, 0x1026696D65389, 0x549E9E1A928EA, 0x5087BC6408903, 0x307BF39BE9441 },
+    { 0x5100E807C0529, 0x059A76FF1F620, 0x78F3BCF3F1ECB, 0x1AEC3F56EEB1A, 0x6E4B32C51599C, 0x228D323949F88, 0x699037AA44D37, 0x1D46F5F66075F } },
+  { { 0x3E2B265CAB1AF, 0x730B1DC016D9D, 0x68AFB721C415F, 0x1FFBADC9D19BB, 0x6CE4E9D7FA713, 0x39A3FDAED1B1D, 0x487BADF0E67E9, 0x043A34344E7F2 },
+    { 0x10F457EC0C781, 0x1E93E174D037E, 0x4DF9A06B0B1F1, 0x20BA378AECDE7, 0x69344322B548D, 0x1246AE1D88821, 0x49F9FBAA05936, 0x5BB9062AA9F76 },
+    { 0x00AA4AFAB4A39, 0x4359F284AF89D, 0x270FB05A97021, 0x19B3AE9068F07, 0x7F30056B750B5, 0x5F59ED6B1D303, 0x513847E207C63, 0x429C01EDBB3D0 },
+    { 0x61724DF191F8D, 0x3DD437BDC4FD3, 0x0AE2300D4D699, 0x7F431A8F5675C, 0x4FF202B65D2CE, 0x600163E7A5AED, 0x0CFD94B6F2050, 0x57034C612F19E },
+    { 0x200F0918F0215, 0x1F750A39B136B, 0x526B65348439B, 0x750917EE75780, 0x68FCF2C0B068E, 0x2603A990462EF, 0x5D3F640155B7A, 0x0A725C87C2BAD },
+    { 0x0B9CF06DB032C, 0x1223B0F13B15D, 0x6D7E6FA7DDAC9, 0x0DA2C64C6A8CE, 0x32DF969A0EC18, 0x397C53BFABF3A, 0x3DCDC7F926BC7, 0x32BCE67F7CE3C } },
+  { { 0x31316FA99533E, 0x2D61CFF9F67C0, 0x69218E8E54E1B, 0x0750D2A9290DA, 0x3BE8C8D1E2C5A, 0x0A391185E7AA8, 0x1D1CF9D98DE8B, 0x31C6C4A46A647 },
+    { 0x37AEC0C865925, 0x6F6E2E4C69C3F, 0x4C7761C76CBD6, 0x0D0A4F46C22A5, 0x414C2319CBD50, 0x1E1FFF92636E5, 0x7CA478CE20F02, 0x7C440B249AC63 },
+    { 0x1C93D630A91C4, 0x63315BE06F533, 0x6423574D20D1B, 0x6B242E18B23D7, 0x0D663937B1791, 0x0D785BC11F076, 0x0B72E7E149E94, 0x02ECCA70AE6D7 },
+    { 0x42C341AE79CA2, 0x3EB8C1C7C6A21, 0x4010F5913F772, 0x46C8D12F48281, 0x10C4E618BA88C, 0x04039F3C826C4, 0x5579525E63FA9, 0x03BC4B379415D },
+    { 0x00C6D0E2536C5, 0x1E3E9CD75DA84, 0x1D1B921DC9318, 0x08B531A72ECE7, 0x2DE47F49F3DE3, 0x5E02CECEBDB59, 0x5C18DADBF341A, 0x52BF16C0E680C },
+    { 0x1CBA666D0CCD8, 0x1F9E31A1C5A73, 0x69D7EB76F74DC, 0x16603ABFC8ECA, 0x14EBE93B7D39F, 0x262C06E293F90, 0x619534CD5DD76, 0x1E62E0F068FEE } },
+  { { 0x6925E6A3BE4D0, 0x12A3CE36B6C60, 0x50AA351A1D05E, 0x1B8DB583C099C, 0x6B87F2ABE5F02, 0x6E7D7E2D34838, 0x43C8AD3D16298, 0x44A9DB18213D8 },
+    { 0x726191C8B08F2, 0x4CFAB73B0BD73, 0x3813A2316FB62, 0x3D66FA9E3656A, 0x0030DD67AEA96, 0x68ADA00C54364, 0x67015C634ABF5, 0x548CABF2C1108 },
+    { 0x2A9F169247151, 0x041E73A5E6451, 0x42333683D851A, 0x76F29BB835088, 0x33EBC423EF282, 0x610F00CED0165, 0x32ECE38F3145F, 0x39AA86C8044DE },
+    { 0x251ECC8B775AE, 0x1875231DAF700, 0x16C8FBE990E28, 0x5C02DF5FBADDD, 0x316FDD919D093, 0x6792F36F6B53E, 0x04E1F560FEC7B, 0x6CCF756151CC0 },
+    { 0x5823F265DBDB3, 0x6F94E76EBDDDD, 0x3FA1B1EC21FA5, 0x46D33399D026D, 0x1E3499888F50A, 0x1C3B27E9780B8, 0x72A1A281532EF, 0x7F11BF3D98610 },
+    { 0x76154C72DDBE9, 0x20C24FC963AAE, 0x252BDF12F50A5, 0x06FA765A2B1D2, 0x633E28C64C5CE, 0x269D25F00E8CF, 0x493DE890A6E62, 0x2ADEEFC1D5AC3 } },
+  { { 0x27058187A90D6, 0x7866632DEC685, 0x0F2EBFEEBE7A5, 0x02D1504B31FF5, 0x375A639DEE08C, 0x353892D7D685C, 0x5DF00166E387F, 0x1D8239594F55D },
+    { 0x3249C10EF936B, 0x31DDA28D9C67B, 0x1C3B3B8D32CF3, 0x4DFF44C183B80, 0x34F00EE6934D0, 0x500A20A385D03, 0x067461C6DD054, 0x31B2F16150364 },
+    { 0x379FC84D64044, 0x00E853A06AE91, 0x2A769212C21B1, 0x0FFA51FA0C297, 0x4654F5D469838, 0x54184A7295661, 0x1C987AFE47F3C, 0x43CE94CFF7769 },
+    { 0x3E24FEE2F15AE, 0x1BFA15AC42F1B, 0x4393BDEDA82E7, 0x1DCACE05E9585, 0x0249C77A3B19F, 0x63B51FA4C59A5, 0x1267476720577, 0x417468E37BB3B },
+    { 0x3E03EC99A1024, 0x59042D9810093, 0x5BC7A471DD350, 0x2D831737B3B62, 0x4F213B6D71A3A, 0x2C1706737CEB4, 0x693493BC7456B, 0x6C8FD3B486AE1 },
+    { 0x50204323B38C3, 0x210B109731549, 0x4664063C3DCC2, 0x0E78CECC4F44A, 0x3FFD3C5FA641F, 0x2169BD8CF8614, 0x0BC50C00E47AD, 0x268296FEF2BB7 } },
+  { { 0x4D1F2E56CD413, 0x1A8F2A52FA505, 0x7A5B1AD0814D3, 0x6C6D822173C2D, 0x1E88889382883, 0x44E25E6067ACE, 0x2EC9E5E1163A1, 0x27149F219EAEF },
+    { 0x41D875772138D, 0x20819591621A1, 0x2FE959000D60D, 0x6F937AC882EB7, 0x5E55EA96B59CB, 0x243A1B82755CF, 0x40BC0534069F4, 0x74A9A14B62D8F },
+    { 0x57A3D3A143170, 0x31B6976B6E5B1, 0x79BAA40A49DE8, 0x7D7CE6FF22669, 0x49E683E873286, 0x106589D385E4B, 0x378951D5668DD, 0x65FC623C2935A },
+    { 0x6514119AE4328, 0x7344922E4B190, 0x519EB8EFE079F, 0x0740072F97138, 0x63A496FD58922, 0x154F7F7172346, 0x524532F315A9B, 0x014C9068FC294 },
+    { 0x35B9F182C70EC, 0x11EB52C5AED44, 0x7D7C2BFA6567B, 0x56E27C9A4C9A5, 0x6D1AEF8AEDD82, 0x59270216B76C9, 0x68C4E05A978E5, 0x6B84BD9B81D06 },
+    { 0x370B6DB69A142, 0x11AE6B3B386C0, 0x5CC04E5B31A0E, 0x21B3EF4E044E9, 0x0B8AA3BC92708, 0x28C31CD0DF35F, 0x281CC17C8CF62, 0x278865B47DC53 } },
+  { { 0x3207BEB42BCA7, 0x40EFB40BE7374, 0x00C27F4516176, 0x7A035A024B532, 0x378B0A32D9B39, 0x4DB68196F2836, 0x17845008C4704, 0x430862C3B4678 },
+    { 0x3BEF0124B49F8, 0x3AF85F257B8BB, 0x34FE09F87031F, 0x05F711D2434FC, 0x150753FB05A6E, 0x2D7B26A73F892, 0x391BA6EC686AD, 0x3087AF15CE224 },
+    { 0x5FD6F1E989893, 0x40EFA233C9B06, 0x4E37EB88F5D12, 0x2C28AFE57B5C1, 0x64201EF471F31, 0x29B34CCEDEBD8, 0x33E181FA10AE5, 0x6B49B6D30C056 },
+    { 0x19C85A15DC8CF, 0x212A4C688C1BC, 0x50172817134B8, 0x0DF87F2215C4D, 0x723922C38D42E, 0x65339AF9FE8F3, 0x0B83F1CB04353, 0x2B1FCD5CC62BE },
+    { 0x5E9A2746C17FB, 0x1395BA95CB19D, 0x2C9CA5C88059D, 0x36D625D9A041B, 0x633E0B4519F4B, 0x288CE0517B402, 0x7EFA31A92A44D, 0x6D197E7F1D9A0 },
+    { 0x677454F2FBFEE, 0x08F6BD17695E0, 0x28471C7B3FB56, 0x0C0BC34FFD8C2, 0x5BB7AB4E12589, 0x30090DF7F8FDF, 0x4B704286CFCAB, 0x21E132F35EC11 } },
+  { { 0x3821029810537, 0x09912D1232BE2, 0x7EC88A4889D4A, 0x0333F7AEBAC78, 0x5BE4E0AD16B7F, 0x1306953838D01, 0x4D947DDC5E092, 0x0FD18D11743CA },
+    { 0x43219C130822C, 0x2EF7B2695AD38, 0x70A89E27B3102, 0x5827EFF9594E1, 0x75F6257D75729, 0x1FE852F197F69, 0x66E1A2C12C761, 0x60EB5A1BA519C },
+    { 0x57F781838895B, 0x54A35C7938BFD, 0x74E1AAD12FC1D, 0x06E1AD408C17B, 0x70DA7CE8112B8, 0x67D69D6374C61, 0x16FB90D7A1489, 0x68194358F8062 },
+    { 0x6466893778020, 0x6ECE10687C9DD, 0x7EF4378BD2162, 0x7D811A61C3B75, 0x1F09789811B55, 0x7360C9047B779, 0x7FCFFBC201281, 0x35223ED7F0BB1 },
+    { 0x6D5B68FB5E5DC, 0x3880F6F0D73BE, 0x414BEB4C9EF21, 0x5B2D066281176, 0x2E9E39DBD3CF4, 0x030F734F024B7, 0x7529F37D85E42, 0x543CFEFD7EB75 },
+    { 0x36E2AB540C6DA, 0x26C057C89996D, 0x63FE810E27AD3, 0x1461273D1C672, 0x65ADAADC1A916, 0x26DC73F3D414C, 0x0F547436C7F7D, 0x2F6CF693D6990 } },
+  { { 0x327314D8A79E0, 0x3A63D8A92BEF2, 0x6B63C97020B8E, 0x76C659BF2C61A, 0x11D74AF73B74A, 0x154203820E6EE, 0x1EB13E8A9FA2E, 0x3EF61CCEC44F8 },
+    { 0x59B8B43635405, 0x74094BEA608BF, 0x41C724B67FB40, 0x1CE192EE47D5D, 0x3C9BFA1F90EA7, 0x770F769D5AF12, 0x0D6127B4461C3, 0x7261305520CE8 },
+    { 0x5F52CC8103720, 0x0EF0208B52572, 0x54237D8BAC780, 0x3AAF965A9419E, 0x732DDD87CE0A8, 0x0365CCABFB468, 0x7D5ECBF49FE85, 0x1B253579DD22D },
+    { 0x6AB6DA41B6A50, 0x4688FA7B5BC2D, 0x2860195EDCCD7, 0x1D36F175FD0D6, 0x61B66EEBDB040, 0x5B63EC5A8095F, 0x2E1C4E05464BD, 0x30AC1E515820C },
+    { 0x0CD5D8CC48F2A, 0x7C0D49DA4BF2D, 0x5CE3290617276, 0x0AB4861DA280E, 0x6C798E5AE36F5, 0x1B3F6E3A0B416, 0x241B2F7FEA038, 0x2B3E7B4A5EFF8 },
+    { 0x09ACD78F38F94, 0x088373219D220, 0x4C908A6AE7D18, 0x1B52A5DC48DAD, 0x2B5E71271C002, 0x2D1DBDEA22189, 0x11B31C1CC5EC2, 0x2C7549E117266 } },
+  { { 0x185089DA25A3B, 0x7BEA98DC5264B, 0x635E302F3702D, 0x2EBB692677A1C, 0x024108B708135, 0x34C692F2745D3, 0x30B15594D266D, 0x6F0256DD20C82 },
+    { 0x03A5665ABA2A0, 0x245D9FB9D124A, 0x2BC12A5A53368, 0x49924CAA419CF, 0x752912D3AEB43, 0x2E96A6561DAB7, 0x090D0E3BD2CCC, 0x3A6C1D5012626 },
+    { 0x30D4B1B4B86CC, 0x0439014EED10F, 0x2E8B904812001, 0x41FE5DD21DB1D, 0x4F8123749C70E, 0x20DC83436451D, 0x58288D3BF1477, 0x0D6D31F9DDCCC },
+    { 0x65634268634CC, 0x58E1765D35687, 0x20616401EA136, 0x7B52B5FF853E7, 0x617E4E2EEE949, 0x3246D2411333D, 0x1D3D2ABA96387, 0x124D3B85A4851 },
+    { 0x5A67CE8D319F5, 0x203E6FFBF9782, 0x283F9815C4272, 0x097498DEBB626, 0x5E059A4AC61F9, 0x430AED22318BE, 0x2D52A8048FCDB, 0x7E41DBB7151BA },
+    { 0x74FF3254970B0, 0x132015A092982, 0x561F32FE2635A, 0x1E5EB5C1DA377, 0x3549D1D0FC0FC, 0x3251F87B3F674, 0x13CA859B83400, 0x2C55E801AAEA7 } },
+  { { 0x53C18D4BD709E, 0x75C2D889CFBBC, 0x69C6A078E8DE8, 0x15EAD8D4ACF58, 0x5B5606EA996F8, 0x27059926627E3, 0x0D543D87959C0, 0x5DD8B2A64B0B9 },
+    { 0x0BA823AE3F25C, 0x302E6E5C4C84D, 0x7E757DB75843F, 0x0F3B7E70BC6BD, 0x1C4F600858431, 0x41502D3143EC6, 0x2BF51F4C1A4F9, 0x097BE395AA7B8 },
+    { 0x51662FD0EE01C, 0x3F8C676A205BE, 0x38F58BF805CC8, 0x118E2DD096D12, 0x6CCBA4719C878, 0x29CD190F14D16, 0x113DFD7BFDE3D, 0x7C89D8E83C48C },
+    { 0x2267ACD6E2C82, 0x0222ECB4F0658, 0x650703398999D, 0x41D7133FEDE7E, 0x362898FEA9CDE, 0x7BAB93D764CAE, 0x42BA026910698, 0x4F73CDA63B301 },
+    { 0x139407A18E73B, 0x403D4308D9EB4, 0x2FC7EC9E4D009, 0x75FE955AF504C, 0x3D779CAD73E3C, 0x7E0E6832A4F59, 0x7EA9549B08437, 0x4AA70AB16B359 },
+    { 0x05748A4B6B77D, 0x1B6605A808F88, 0x4EC9BF1076598, 0x0CF6CA7A180F7, 0x299C8EB944EF0, 0x1D843CBF095EF, 0x163BD03B3D2A7, 0x2DAD48FCE72A4 } },
+  { { 0x2CAB4661317C3, 0x105129C32F395, 0x6E242F6457A63, 0x682927B1ECE2F, 0x04CECCF37739F, 0x7B746B8EDCFE2, 0x6848CF4B9032F, 0x7FE4C20B9E26A },
+    { 0x470456B32798C, 0x2BCB5EEDAD3A7, 0x5AF87B02F88B7, 0x524DE4E3AF702, 0x72C1962667776, 0x44A6F43EF844F, 0x2351DD33642A3, 0x57CCEDABA13D3 },
+    { 0x6229A97258D7E, 0x34B70C9682287, 0x457E0D3A46B17, 0x5AD84E945C237, 0x2ED51B50428F4, 0x354EE3ED3597B, 0x4CF5E47B450FC, 0x641DCF4BD87C9 },
+    { 0x569A4DAC595B2, 0x783F14C7ED866, 0x17EE4DB6B9C10, 0x7D98A6C0A60AC, 0x5DCA074C15DB3, 0x60EABF39626BF, 0x6E13A1FC8A984, 0x2664733E2B551 },
+    { 0x424B8B67A3E8F, 0x1F34904D53395, 0x76E625F86A8CC, 0x7A7BF90A9D7D4, 0x31DA84FAC9E31, 0x50BA0A9F00E62, 0x39E0BF9E56663, 0x13D00ABB205EE },
+    { 0x05072D91D84DC, 0x0F4377BD6C2CB, 0x501D2C9A57A7C, 0x074869B7CE64F, 0x7F8A4E21C133E, 0x32384FA7A73B5, 0x4B77D7D9D97F7, 0x278DDB74148A1 } },
+  { { 0x0508333BC4486, 0x07CCB00E62C08, 0x55FB11A0D14B5, 0x5F98F0FB73DC1, 0x4416BE688DA08, 0x42C2C7EE3A1F5, 0x39EFEDF95D95B, 0x2EB6E30BB015C },
+    { 0x3ED8402DE4AB9, 0x69E056CFA86CB, 0x5A8EE26EEF9BD, 0x1A5E163E7F6A2, 0x0E67E2B1DEB8A, 0x471B1A08399C9, 0x304772FD5ED21, 0x00C7F26788F47 },
+    { 0x1785BAA83B379, 0x436BFA8BFAB60, 0x075EE96CCCAE7, 0x724BC59003133, 0x7A960B9F63D54, 0x4701957678189, 0x3793FAFECA8FC, 0x49D9102BD8C7F },
+    { 0x57A3BC1E2B80E, 0x696ABEEFC4A05, 0x6A8D921280B88, 0x15483ADDAD320, 0x14C45F7D8B8F0, 0x67DD68C8113FA, 0x0F299E86445E0, 0x5A4B9AB5A57E3 },
+    { 0x50AD4DA062541, 0x6FDD173711005, 0x11C4D35783E7A, 0x564AF5430676D, 0x6F50F5BD6DD90, 0x2B4E173992107, 0x38025D0669DDA, 0x0C52144A30092 },
+    { 0x1569CD3C32193, 0x2191DBAA094CE, 0x6F0DF717FA70B, 0x16531597C5294, 0x1D538B1DFEAA9, 0x2BF6F5780E716, 0x5EF31ADABDAC5, 0x19008739DD8F0 } },
+  { { 0x439EDBB17611C, 0x06E3A0E73092A, 0x0343C4CFAD449, 0x43DE8D0DF6C35, 0x75ACE58C3EBCC, 0x424003ADDC37D, 0x1DBFB3159B49D, 0x7AFDD8B533EEC },
+    { 0x268FCF025F708, 0x354973D0C7B86, 0x4E845C890F1D9, 0x5C311EA883201, 0x71467DCCB6001, 0x0D6F5BF5DFE25, 0x75D4D8A7DAC05, 0x0B0FA1E4EA01C },
+    { 0x6A6C359EC6C20, 0x2B515E185BC3A, 0x5A05E29AF7649, 0x5FC69C0BFCB46, 0x0DBD3FA7DB680, 0x79C56F6B94638, 0x76A8AA85212B0, 0x7AB2B2A98604B },
+    { 0x239982B243000, 0x6D278F5F06951, 0x7605407FF7970, 0x4B63975BEA797, 0x02E379758BA86, 0x5911853699BFE, 0x331B54AA11FA3, 0x6F38994BAE619 },
+    { 0x3399E9D01376E, 0x2002CB54308B1, 0x61E78A1C69A21, 0x050C9949AED28, 0x176B3DC41ADDA, 0x0F4C54523F7AA, 0x10C42C7E9C4F0, 0x72A46CFB1435A },
+    { 0x0AEA9CC3BC2F2, 0x1088A511354A3, 0x5FA1B074F7DF4, 0x15436D4AB329A, 0x2604939719865, 0x1CC9E9D2050CD, 0x32B5470194AF4, 0x3719DA8E3AD7F } },
+  { { 0x1D5CB05990843, 0x6AE9DE1011CD3, 0x6059777973635, 0x2DE29FCB25BE9, 0x15B1402CDCC39, 0x5B1A757A97EE7, 0x1ABB5C7AF2C77, 0x60790A51160E6 },
+    { 0x014FF0E90176B, 0x71ED69DC8168D, 0x68D4DD0139A17, 0x3F9CF0104739B, 0x115AABAD62EDA, 0x0D924148DF134, 0x6155FFECE3EE9, 0x376EB80769A56 },
+    { 0x5AAC02B878057, 0x6F638D5EE862E, 0x7879A361587F6, 0x3F6DB60325768, 0x46E2A6EC38186, 0x67E88A92C00D3, 0x3E4422EBAA6B1, 0x0B0DE97E2345B },
+    { 0x65C4C2E423CD2, 0x59F2B753D7F90, 0x1BD8945FC3A7F, 0x2EC97381C51D7, 0x58B47912B3A11, 0x1809FC3A7058A, 0x10ECA29683667, 0x2D66AF17373C3 },
+    { 0x4AB30A3E32C15, 0x093EEB706039F, 0x1BC2BAC510D5F, 0x192F2DE0EE83F, 0x602BC1F6BD712, 0x3B40063D5DB5D, 0x5193DC683DAE2, 0x0293039544065 },
+    { 0x4AE82ED79F313, 0x07755B5F94E5A, 0x5282BFBC0F777, 0x193A40069F002, 0x46C1A5473B98F, 0x2E86DD74D9C1B, 0x28D0BBE5862FC, 0x23D941BA77E7B } },
+  { { 0x7C24960F4547E, 0x3BDBA250C191C, 0x3280EA7DC8722, 0x442F0D6D01A96, 0x440F0072B78AA, 0x79830AEE0FB82, 0x15708F3848864, 0x183927072A460 },
+    { 0x5EBF043C76518, 0x128F0618149B1, 0x2565A54F56A2D, 0x16487D588C679, 0x6BC7EFF264BEE, 0x2CE35CA296E5F, 0x5836E11BD844E, 0x2E08ACF5EA858 },
+    { 0x335BCF0C034B0, 0x02C1DFD735887, 0x73B39EFDF5131, 0x29B6DFA7C66A2, 0x5EFF432A4DCFC, 0x5BD78A0492FB8, 0x74C2F6CC11738, 0x1F4CBF1474CBB },
+    { 0x02203C6B44ABA, 0x2BA2302975A71, 0x4647BA65C3F7D, 0x67662CE0DC5A2, 0x26A619819A173, 0x1AF3F46151369, 0x2E26818D23CD2, 0x6FC948A2C6020 },
+    { 0x337B0E58135F4, 0x02C7A1355C5B3, 0x54969877E7C1A, 0x05E80BFAE7A5E, 0x32AEB5AC4F77D, 0x18EF770D06C43, 0x577718FAEF233, 0x76701B717B253 },
+    { 0x75644614A4074, 0x14F8644ABE960, 0x0A3B59A8EA000, 0x0D4E6F20C94CD, 0x24A4D791CE69D, 0x3976725A05056, 0x3F1C9EB238908, 0x309BA0BC5CDC2 } },
+  { { 0x2EB708F610619, 0x03E42FBFA7901, 0x27D0D82B52C43, 0x338A3560D7AF5, 0x228D1443CF8B5, 0x69E297C05AC92, 0x74EE71280838B, 0x18DD0263856F7 },
+    { 0x455C22E851CC6, 0x51026F88EB651, 0x6C395A9217100, 0x462E109A20C0A, 0x6CF2D16C3F817, 0x3261EAAA9B13D, 0x48108EC799D43, 0x1CDAB64E959DC },
+    { 0x419919D9466DB, 0x64B3FC4871E0C, 0x6247DFD9B9635, 0x4548292BFB7E8, 0x2163CD8FD4B57, 0x5CF014190DB61, 0x1A8A894111704, 0x01C401834D027 },
+    { 0x2921A861ABFF9, 0x293925224CF34, 0x5D8CC118C894F, 0x4FD93A8B678B1, 0x063CC40D68A96, 0x03670A67BF2ED, 0x38C7EC9DBDB0F, 0x0617E6A01B553 },
+    { 0x0BF6E7296E212, 0x573BF4E9DED8F, 0x7E66F63835401, 0x1575B4FA96804, 0x45663FD1A8D7E, 0x42E8901D9C766, 0x5E3918F939BAF, 0x6827A68E21254 },
+    { 0x1E33692958BCC, 0x1A3331E2E96CF, 0x42D1BCEC0FC3F, 0x1589B21BBF9CF, 0x247D5A3548CD1, 0x2F108E5DDCEC4, 0x00DDD4DE2173A, 0x1C449EEE60392 } },
+  { { 0x4977AB8BF2E8E, 0x4BFA8479BB974, 0x2317E7A326B98, 0x7CA8C25727C3C, 0x3EC8CA3240B94, 0x1AF11A196B98D, 0x382AA70E2B758, 0x599FAE28072CD },
+    { 0x18A19F1C94EDA, 0x18D4DE836B6F6, 0x1BD62CAAABDBA, 0x69F52F5A2A7CB, 0x05AF422DDD868, 0x6A70837D61B3A, 0x27E6CAC950D6A, 0x4DC12045EF345 },
+    { 0x331018873E3F9, 0x6405F1A07321A, 0x1E869290E6DC3, 0x2D5EA168B5F67, 0x06B08B1756FF3, 0x122BB69214DF3, 0x1974FE75D55EF, 0x0BFE5B320E0F9 },
+    { 0x06FDD9D71B5BB, 0x043CAF008163C, 0x18E2C545F0A21, 0x2BB6134A4FC45, 0x5800FB55F56E1, 0x4E335DFEABB2F, 0x665DA136E8C06, 0x2336A26F44FDC },
+    { 0x0DA2410E6C52E, 0x07CF05D43134B, 0x764C0787A597C, 0x0E3E795FE65DB, 0x7949036A0DBBF, 0x3F11FD120A25F, 0x438B2CB3D99E2, 0x6E9B606964145 },
+    { 0x16D3BDBA70410, 0x1524546E29936, 0x45BBD98B5EB0D, 0x094D24B9481E3, 0x7B5CBECE19349, 0x34427A60B5E61, 0x27F2FAD335F72, 0x27F4119194B84 } },
+  { { 0x03C9545ACBD70, 0x05A5C00892390, 0x1DB5A5CAC2D50, 0x5AC46F0C08036, 0x7C85AB02C5D3E, 0x29E25FCC834A2, 0x0F0B35D3887CA, 0x47C0C0D3115A5 },
+    { 0x306572AAFCEFB, 0x3401F5259286E, 0x6CED49F5534CC, 0x3E04B8359174F, 0x32C0F7B29EB81, 0x0F97DA6107B73, 0x4245F3C926F35, 0x2CFE2E4408F73 },
+    { 0x52EFB350D2721, 0x415057FABFC1C, 0x23EA6C23CA630, 0x341D16E5DBB5F, 0x5BB796511B4EE, 0x0EB1E0F85AA97, 0x55B32E74EB81C, 0x34E38721F6FC5 },
+    { 0x7E9E18EB7A36F, 0x1DE00641EAEC6, 0x134ED64D067A8, 0x22913214694F1, 0x5D6F3E621BDC2, 0x1ABBB3A2EA936, 0x22807A1928767, 0x68B442AFCF7CE },
+    { 0x7FB93A3EC573B, 0x58C492D8294D6, 0x119B688F1846C, 0x585737160287D, 0x1BE9D72EFB786, 0x407301EEF90CD, 0x026D1C67CD7E5, 0x4A243ED2C9321 },
+    { 0x0E5D213E3ECE5, 0x12439BFF7FA0B, 0x41BD82C87F79E, 0x0FD5E1620B889, 0x018CA68B0BD47, 0x27E1A8CE95B2D, 0x3D2042CDCF1B3, 0x1DE7A1D9E3B15 } },
+  { { 0x519D4EED2F8B6, 0x5D8AA6DEFBC30, 0x36CDD70CF599A, 0x2C22732000722, 0x3B8C8ACB36B08, 0x06C9A46856E90, 0x1E0CC919C13D2, 0x32C28AD629DFE },
+    { 0x1DB16FB58D644, 0x0864C92ABACE8, 0x637C0BCDBDA40, 0x3D4DE636DE4ED, 0x7BDF7E386E0FE, 0x475B0703C9A51, 0x29F918C2A3E01, 0x3F9994F7D4E42 },
+    { 0x361DE9A78919C, 0x03394EAEC3439, 0x1A02CFEAE6607, 0x623B002A2DBFF, 0x367C5062BF6E4, 0x0DB94344FFEEB, 0x713CFD59D05FD, 0x3F7E79202FE45 },
+    { 0x47C391BD7B2E7, 0x234D810AF38EB, 0x4C17D44C7AE7E, 0x4F1410C14F078, 0x0048E9512949A, 0x0822F353E848D, 0x732E056004E8D, 0x0211E4EBBFDDA },
+    { 0x4234BE57303FA, 0x0DC65B17AEAD3, 0x36C73DAA86BDF, 0x3D2245643F949, 0x50C7B515F0852, 0x298B229F115CC, 0x00973BB4AEC6B, 0x161021E276F5A },
+    { 0x1C1E78AAB89C6, 0x142DFAE579F16, 0x257C4A7F3EA01, 0x1B8605D7C1621, 0x174AB6C3EB85C, 0x22013FB32B4CC, 0x5736FC7CD1937, 0x28D77135BF1FA } },
+  { { 0x626667518AAC3, 0x4AF3A285DEF28, 0x3C14CEDF0F2D5, 0x6C331C97EC80B, 0x2D477DDBD2083, 0x0B2970902C299, 0x22415E9E9D713, 0x6965FB11B8A5D },
+    { 0x4CD4468292D2D, 0x0D960C8FE21CF, 0x3AE2FCBB12106, 0x689559AA24B62, 0x6A32D6CA2B2E9, 0x6A71560C8847E, 0x3D875A80B1D09, 0x25BCB534443A9 },
+    { 0x40FA0D92A6F0F, 0x6A52A0ACF1886, 0x29E51B6570713, 0x61EEA1C041373, 0x6CE1C7FC91319, 0x279A7E9283EA7, 0x409366521521E, 0x60773CC7EBAAF },
+    { 0x50EA0645404ED, 0x27C048AF229D8, 0x6507786C21C03, 0x6CCDE8062A737, 0x30964CB8342CA, 0x71D85F2D25849, 0x13451A2878551, 0x1965678391251 },
+    { 0x4786049C18735, 0x64EDCB6F445CD, 0x64BA5A0A6450B, 0x47CF60C0280F3, 0x1E9F2DF8C9BA8, 0x021C4C894560D, 0x6FFB8D1CED441, 0x60D1E9B3FA645 },
+    { 0x13FE6D8E84249, 0x1B15C57AC857C, 0x547B85F0D4CE9, 0x0B18D753554C1, 0x6E6B212808811, 0x2820DEB2A2876, 0x5B43B74FA95B6, 0x29A0893ACA7D7 } },
+  { { 0x13FACF507169A, 0x5D3CAF1A395AE, 0x5195390994A4A, 0x446939132C160, 0x7C0D0A39BC30E, 0x2A0EE4D38F757, 0x0BA201CCC60A0, 0x4BE3F0E05AD74 },
+    { 0x6FAB2C11F4E00, 0x7695332A098B1, 0x758DE3C4B6C15, 0x78CC7A701BAD5, 0x156759601AEB3, 0x29242B38862EE, 0x3DC5669498FC8, 0x69BC68CD9B6FB },
+    { 0x5100A057C11C5, 0x1FF7FB18FA7B2, 0x6413E5D1B0FE7, 0x36F1BBCEEC30A, 0x0289C728F65AF, 0x006CF4F0B9345, 0x2417FE8C295EC, 0x3A23B6CB977BD },
+    { 0x2E289E04C2F87, 0x0E316F8414A69, 0x63D9A6E5B6FC1, 0x42D6DDE350922, 0x6B25923F421FA, 0x5468A9EDFC7ED, 0x54E090AB5A728, 0x026B8DE00836E },
+    { 0x3A31C23D31F1A, 0x515C58BD1C4D0, 0x675A93AFFF4F9, 0x64085E8954183, 0x491E5ECCCE980, 0x13E29C488EC1E, 0x555CF6F7C36F1, 0x3CA39B2FFC946 },
+    { 0x7E522166AFBD9, 0x1E60F77E0EF53, 0x0AF4EBAFAF7D1, 0x1AEC1E57C5505, 0x0F6C0BCF8DF4E, 0x2DD11A8F3D8D2, 0x6F89C14BBED5B, 0x292292454380C } },
+  { { 0x740497CCA7BE5, 0x25A2814945306, 0x6A8822F68941B, 0x2B7FB1FF821E9, 0x310875ACC0021, 0x7E4D1BE1A8FCA, 0x248460B745795, 0x6CF9940C0A5CF },
+    { 0x0B9333BECCD41, 0x297B981E04E08, 0x0F66CE8AE4825, 0x1C78644C7FC5E, 0x30A818303E218, 0x315DB3A9DF622, 0x6B7BDC0EE90C2, 0x595F2B24A93CB },
+    { 0x15CAD88600814, 0x6BA33B697B65B, 0x50E6C4F1E033A, 0x5F37A61E92478, 0x27A318D4ECD64, 0x54AC14B943C18, 0x664693130C47A, 0x24325A38AB7B3 },
+    { 0x7C8E589F60A4A, 0x35BF979216B3A, 0x74E1E9AF386B5, 0x70640CDE24C59, 0x489918E3C8DE0, 0x1CDF83B1CFF3B, 0x0566CB3C61995, 0x5DBA344059E96 },
+    { 0x15272F41BDB9C, 0x4259E352519B5, 0x467A8430DB22C, 0x7F4B30F098921, 0x1AACF0F70D00F, 0x2D5B51C16E4FB, 0x7ED0D84B21F0F, 0x4B20C570E6016 },
+    { 0x22117DFF3ACF4, 0x1352F20A65A0F, 0x2DA9F324C8F2F, 0x1E5FA635607CA, 0x2B1499B26E8D9, 0x1D4608500E882, 0x500DCFB23AEC3, 0x21082DBED4CC7 } },
+  { { 0x3FE92CA0BA845, 0x50D13CAD842C5, 0x3A5E3DA782E3E, 0x6E1DD6B9B9B81, 0x2CE9B76BE9C25, 0x672D792C231ED, 0x17B42605D150C, 0x366A6BC27025D },
+    { 0x07C8F45D3C017, 0x09E90816BA791, 0x59955D0E3C5E1, 0x5E020A91394C3, 0x423F7AD7C2566, 0x650EB44A11EA1, 0x09B74A9CB7343, 0x62A1460371F47 },
+    { 0x3C502CA59336A, 0x24E12B0BB0B7B, 0x0321EBD4DDDF1, 0x26D28CF678CCB, 0x0803417E859D3, 0x17B6C70CECFD8, 0x43478EFCC34D7, 0x07E916A3842F2 },
+    { 0x1244193BBBB32, 0x5711E54114BBE, 0x34E10C4F1C50F, 0x1FFF6944665BD, 0x6E0471D8CE9F0, 0x15BC2CB04D05E, 0x77A78F26CDCB8, 0x1F810935D35BF },
+    { 0x61C3ACD63A908, 0x2660AB675CC22, 0x776D22ACE4395, 0x46BCCADE5E8BB, 0x37764F23EE36B, 0x28955F428D684, 0x595512D5EC4AE, 0x4364D13526755 },
+    { 0x2C2A5583A96BC, 0x09031FB455B39, 0x2DA69877D39EE, 0x18AEA7696B155, 0x6F946E06FDA76, 0x27FF495C5C73E, 0x442DADA0D0092, 0x1C820581552C5 } },
+  { { 0x10F6E21C1A56B, 0x6C975A5A9B308, 0x7EF9FA456B95A, 0x0364C6BC21B4E, 0x1D50BE9E12CA9, 0x7C3D316751DCC, 0x479FC0173554E, 0x733E30F0E3DF5 },
+    { 0x132D91D9C19DE, 0x543C47B394C90, 0x75627B9D661FD, 0x053E9EB391F54, 0x3D327C1AF86BE, 0x6AB8643341588, 0x2CF31916DC9C7, 0x33A1ECEF6C246 },
+    { 0x4CDD6E48CBE4A, 0x560C5B57EE9BC, 0x5116F00EE7378, 0x252D3AFADDA03, 0x4D493EA658BF7, 0x3429F82006A02, 0x2406FECC3A479, 0x61E126F486DEC },
+    { 0x4A792EAA791E2, 0x3BE6BD6BC43C0, 0x0C9EFB669343C, 0x61F16AEAA4F45, 0x544AF60FBCABB, 0x5F4A0F01A106C, 0x40A6557A91618, 0x1B46E048DB530 },
+    { 0x740D9B92A7C65, 0x65419F1FD2D86, 0x491C009875D91, 0x03ACEC8885024, 0x759F69FA9C76B, 0x701CEB89671D7, 0x462C2E3BB48AE, 0x280A7E0AD7796 },
+    { 0x37CCC5C3D305F, 0x1A0D79A296B8F, 0x00E623570BFC5, 0x1379F7133397B, 0x64E41BA44891D, 0x2EAECA50078DF, 0x727D106796CE5, 0x3B01C1632F769 } },
+  { { 0x7CFD1DAC9FB9C, 0x1A6EC68C1F2D1, 0x024A065A6B429, 0x0110B8AD2176F, 0x60DF5A53F12CE, 0x1EF825040DD89, 0x37475F56590AB, 0x64148DB953B59 },
+    { 0x76971E4F94DF9, 0x7329EEC144780, 0x3222A8713E07E, 0x0FFFFFAD4A175, 0x36AD4DB32AC25, 0x459A4030905DA, 0x462CC3E21FFB7, 0x5CBC227098BF2 },
+    { 0x1118F85E4E473, 0x32E2AF1BDC68A, 0x12E472A685B19, 0x6B8C38CF3ACA2, 0x2AC91A79DAE03, 0x140B95AAEC114, 0x162B90BF8FB8F, 0x60D9688C7233B },
+    { 0x50305B9F4F883, 0x55C86402DB1F4, 0x2118BD2CF6709, 0x25557DDEA6DA9, 0x79429EAAAB931, 0x74A3B63279632, 0x5B1204A0AF361, 0x6022003893D67 },
+    { 0x469FDF963D9BE, 0x37EAA7D5DEF3B, 0x3D7B4D328C106, 0x44622230366FD, 0x691F5EB4B615C, 0x2E46749561DF4, 0x2498D3454BF3A, 0x44B2C2ADDFECC },
+    { 0x3EC91F0D47C9C, 0x1509B356D99B1, 0x72DAD092C5346, 0x181B90B263214, 0x297D2378A2E4F, 0x38B5E5165E106, 0x31C30F2111049, 0x32369CCEDA885 } },
+  { { 0x256C5BE2A1D0E, 0x10A00C7E2D05B, 0x64E9807BB3EF5, 0x1EDA66AEBDBB5, 0x2A6D33B28D626, 0x6E633A16095FA, 0x09CE4BE6E48CD, 0x66593ACB45ED3 },
+    { 0x2CFED582839FB, 0x59D595993C618, 0x05EB0713857D0, 0x48A34B0EA6F1F, 0x10B786D07B36E, 0x66F0203F1C700, 0x4BBD122624AD0, 0x7E0057233B254 },
+    { 0x61E9F7F3B0D3E, 0x61015A1D44663, 0x5CE89DCABD36F, 0x259E7FDC245D2, 0x30C34E234A3B7, 0x17C91BF299328, 0x2C97C9452591E, 0x157CC35A28EA8 },
+    { 0x46D662AF3FCDA, 0x1F9255EA82DFA, 0x398D7BADD712C, 0x65CDC022BD6C1, 0x419D200203020, 0x6C13F449FD2F6, 0x63EEB6B216050, 0x48C61442DAED5 },
+    { 0x4AC25FD97D88A, 0x4F5B4C3817EEF, 0x6E9721FCF99E5, 0x44BEB4852D794, 0x5B15DA02B9FF8, 0x1029022180486, 0x1C8635FE56C68, 0x647E7E7A9996F },
+    { 0x14763D71F5C77, 0x14B2B1869F282, 0x0A4F8A39E3832, 0x144818EC776AE, 0x2292F6B129AF8, 0x193B8DB3B0D0C, 0x0436904D46B70, 0x333E69661CDE4 } },
+  { { 0x28C22DA203BBE, 0x3ABDD367EDB60, 0x1BFE9A5AEF8BC, 0x2A05D97FEF2B6, 0x27C9D061B8992, 0x7C2A4EFFE973D, 0x21C49B88AAB12, 0x5CA415356D108 },
+    { 0x639BBE686C92F, 0x11EC6B1523BA7, 0x0643806C4D285, 0x4560C64B1B133, 0x27F1B0EC231AD, 0x07219C431C7E1, 0x07C4B0EADEDB6, 0x1EF6F98674755 },
+    { 0x7DFF9E3658684, 0x7A852FDBBA907, 0x716AE3D748A2D, 0x064BB5B86DC83, 0x06766D596CD4C, 0x16809A8DFBE4F, 0x7E5774656EDDF, 0x39DEBC61D155E },
+    { 0x545A3CE17ED71, 0x3CBF436984C4E, 0x5525DB177A3F8, 0x572F4C2BAD00C, 0x69758E47E3A5B, 0x551277EBF67F2, 0x020000298C224, 0x5AAAAA0A5F56A },
+    { 0x4EE0CD8E86975, 0x6A5379E646906, 0x06D20768BA871, 0x2045B052354CA, 0x5C2697E8A928D, 0x7CAE742A93144, 0x69A1EFD036BF9, 0x3EBF3C33B0688 },
+    { 0x787BF48BA20F1, 0x157B4344DFAA5, 0x220ABC7E34A77, 0x14E280CDE5280, 0x4E03497DC32ED, 0x19A034BE6C52C, 0x74606942EB9C4, 0x30084AC9C284F } },
+  { { 0x4CAB724E6B470, 0x352C4FA1F82D9, 0x66A35848BE54D, 0x7F8FC214E0D0C, 0x3F1793B2F2250, 0x6A3DA2F284D44, 0x2650F401CA08B, 0x1FC5DD24006C6 },
+    { 0x650D15CAECC25, 0x08B9FFEAD1908, 0x7745BA999ABFC, 0x4EA9E7F3E9D54, 0x29A76B60C0F79, 0x7ABEA24680E86, 0x4EE31E408CD49, 0x303841CD3A1E6 },
+    { 0x695698988E40B, 0x49B9878BDA55B, 0x6364F35C3D31B, 0x0E189D01976A0, 0x408E74FA33815, 0x677DEE116459C, 0x3217F23D99A00, 0x21E9D959B2EFD },
+    { 0x26D94BC11024B, 0x7AD20845CD341, 0x1F20745FC97D5, 0x4EE379ED17198, 0x34ACD9C2E129C, 0x3CEC8C79DFF5B, 0x0C9724675E560, 0x10860030B9A32 },
+    { 0x363DAFAF5CC1F, 0x1EBE6458F9B57, 0x6D099472817BF, 0x46700504B2386, 0x7F828F0FBB21C, 0x4FF43E86FE109, 0x26CE7E8A7E2C7, 0x4A1EED181A2A1 },
+    { 0x16E79F82A8845, 0x1BDD8E5364B7D, 0x467CFDD227F42, 0x137A3CC581E1F, 0x3591CC5034548, 0x32270F485A794, 0x3E57AA73D2A7C, 0x2EA6654E262DF } },
+  { { 0x4BFA08ED06ED8, 0x3AA8522C8C0FB, 0x05F1FB6E59732, 0x7497D8ABB7847, 0x0F2CA1DD76626, 0x6BCDF659B476D, 0x29C1B771430A6, 0x26ED0B6B86B0B },
+    { 0x15BD3D9B97CC4, 0x16E4E3751380D, 0x6574946E967A2, 0x0DBA02DC21511, 0x2CF3F77B0061A, 0x68F40989678BA, 0x48A1605068836, 0x02AE3347689F8 },
+    { 0x605DC9C2ADD38, 0x580DE552B2F5A, 0x113FD3B8707B8, 0x3BB2F7727CAAD, 0x5A640124647A5, 0x5AC7B3AB48629, 0x636D5DD9601DA, 0x635D824ABFD16 },
+    { 0x01A37A1429006, 0x6DE6AE46AD0D8, 0x74395DA63CFF6, 0x0B980092F5300, 0x452790BC7E649, 0x1D905EAAAA72F, 0x2369AC0FE58DA, 0x3F6EF44D9CF43 },
+    { 0x4457919C1A851, 0x36EDF52D6E204, 0x7CC19B5C9E768, 0x328F94C1DE548, 0x7C507E72C8562, 0x05E5B536ECAC9, 0x53493905928E8, 0x3A3F95E8D5D0F },
+    { 0x2E17EF0D9FA0C, 0x0AFD0F462488B, 0x133039F022D8F, 0x1EDBA4269DC47, 0x1591B18BD783A, 0x269942F96E145, 0x31DBE943186CD, 0x2E7906C6AC04E } },
+  { { 0x4BD4016D49250, 0x47BFCA20B6E2C, 0x480126A2F691A, 0x378ACC5FCC2A4, 0x717873F338532, 0x3BBDD08BA1EDB, 0x23B5D3745C89A, 0x7E2625EA91C05 },
+    { 0x1F15D8ED71FF3, 0x728CFF89004CE, 0x41DF4FC465A35, 0x3239ACB70922B, 0x38B8A58B08FB3, 0x62FA23996C635, 0x193BB56936B7B, 0x6700DBBA90DEA },
+    { 0x64CC2B745BDC5, 0x41E2D05880919, 0x6F463A3A53960, 0x038ABFF814FA1, 0x0E5ABEC33784A, 0x793DEB68A2064, 0x55D0F402D5FC8, 0x712E1C832871B },
+    { 0x2896E71E76F70, 0x4A97EB29A4B35, 0x271D3A105AEEA, 0x5B4941775A39F, 0x1405676665F50, 0x0D6535F890245, 0x7ABDCB5A20DFE, 0x31AF4E9026A0F },
+    { 0x5B34735D0C9B2, 0x03CBE4A58DAC8, 0x083F8C06F4743, 0x6296CDD85AD90, 0x55348A1616088, 0x4D8EA7DA27678, 0x033905462C7C5, 0x5A6A51527BF5E },
+    { 0x1FD1540840D63, 0x137E2556F24B0, 0x2C3C51A0A0E7F, 0x0E2731A59093B, 0x34B4DF756F828, 0x39E9791B2FB69, 0x6FECA07926AE6, 0x279F7EEEC5D2D } },
+  { { 0x44423AA8B5814, 0x242041E1366ED, 0x4A51EA42A9EE5, 0x46112288510F1, 0x2284D00E17250, 0x503358F37FDF2, 0x728FF395AE4C7, 0x4B383834D8080 },
+    { 0x004B4330359E5, 0x74AEC1EB40949, 0x577D46C0A7E09, 0x0D92DAAF2FFEA, 0x5064D56A07704, 0x5F523A9352277, 0x73D1F7EA83A43, 0x71499C17BE0FC },
+    { 0x2988590CAA7EC, 0x3888B2E42C98D, 0x08A877B474313, 0x4D803F27E3A0D, 0x613C5FCDAA2EE, 0x39B3A1FA7A48D, 0x19F9222790671, 0x526389FC64C53 },
+    { 0x6FF97EDFAC76B, 0x7EAACEE17D20D, 0x1B6EB3FD596E8, 0x2C484973528A2, 0x349BC20B3793B, 0x764E144EC1E89, 0x35B18A1447569, 0x6E120771727A8 },
+    { 0x55EA6C7A1A1EE, 0x5924338B169D4, 0x33D599BCCF752, 0x1700ABEB1AE48, 0x2CA65ED76ABE4, 0x328D668463315, 0x21B4CFB5BEE5C, 0x2E843D7F5F033 },
+    { 0x1602632999CF5, 0x1AB4B5521EFC4, 0x18552C7D0B8C6, 0x13E00256390BD, 0x7CBB0EDE3F598, 0x299B127676171, 0x42A86934D44FD, 0x2B80949B963D8 } },
+  { { 0x39EE3443ADED1, 0x00B8086149C2F, 0x2A7BA2EBE391F, 0x13820829522DD, 0x2ABDD86AE6789, 0x01C8A16934690, 0x5EF1A40C3BD2D, 0x253F9CC227889 },
+    { 0x7F17C25CC5119, 0x3D7FC3895E5C5, 0x49738E1DFAD0C, 0x29AC2B0B23F6D, 0x1A639947E0E6C, 0x4B3473DBC8857, 0x5D4AA96196CC0, 0x6C086DD655920 },
+    { 0x6DDE18B23A855, 0x2D8C7159E1E82, 0x05BE01F2A0656, 0x084C9C9B627B3, 0x20635B595FE71, 0x6053717453E34, 0x47C1E22D14585, 0x2F20F576AB129 },
+    { 0x5625D35422E4F, 0x4B4BCAE6FD627, 0x01E98AFB5AAA8, 0x0327E3EEE4C53, 0x49DFF0543EA28, 0x55074CFF63F8F, 0x098AB01EF72F1, 0x247684958C5A4 },
+    { 0x7ABB6C7502358, 0x157F1D47687C7, 0x5821B2B1C2871, 0x4BDC6B4F33AC4, 0x3B1ABA2D192A0, 0x17C19AF945D65, 0x446654C42E38E, 0x2E46BE456B65B },
+    { 0x73F7705F84803, 0x102DE883F4B04, 0x5B55FBF270E64, 0x1549275A295C2, 0x2BC8800107ACE, 0x344C3393A9FF4, 0x3149B5187FD71, 0x3169733B30830 } },
+  { { 0x6A98DDA77CE3D, 0x3A42477DE0715, 0x6783F337A82DD, 0x694250E02C7D7, 0x3E6BD7321BEB5, 0x2014682A18C62, 0x6A69FEB8A6F25, 0x4BF36F72DBC19 },
+    { 0x01615A7BF174E, 0x7638A6B4386C5, 0x3034B6BDA58F7, 0x7B174C1B253B0, 0x17F734EEAC054, 0x1A155919B956E, 0x5B4E1F00895E3, 0x070B6F9EF2412 },
+    { 0x4FFFA3D56A8B8, 0x2CAF5AD4B5E48, 0x09A427A89D6CE, 0x7077257941302, 0x1A8F4C8070B69, 0x1B55A10ECCE7D, 0x3A74930411A80, 0x7B528C0F62964 },
+    { 0x0FA3BE1A116EF, 0x4ECC447DC4CAA, 0x76D67013B7C04, 0x335DA4E9F4C43, 0x73139B29DBEEF, 0x17CAFB34D85EB, 0x2DC371521F139, 0x0995317F67931 },
+    { 0x34CAD31C5A7FA, 0x6BF80CA0D146C, 0x486AC17A93F33, 0x2E722B4430AA3, 0x258D0D4EFCFC5, 0x5C87EE13009EE, 0x63879DF21F148, 0x0C3897045401B },
+    { 0x28CB3303C5314, 0x067285B843074, 0x4EB9F5539077C, 0x22E8921E5B568, 0x11B15E790243D, 0x2A266ED90B91E, 0x2EE58D49CE4CB, 0x2BDD93371239F } },
+  { { 0x51691CA40D113, 0x10D3494926162, 0x3F8BD155DB763, 0x0C79748792AF1, 0x37BE7D55A8929, 0x10D7A91E07223, 0x05E9A4A4BE581, 0x352428269B525 },
+    { 0x356F1A219EC1D, 0x210418AF22965, 0x028EC9FEC64FF, 0x4C0745BCA523E, 0x405968891F4CB, 0x3ECE4238C7196, 0x3E77BF0F177E6, 0x5FC50B375E788 },
+    { 0x58BFF28951BE3, 0x2D53578487181, 0x0A28252D954D9, 0x6933E0007B1E9, 0x652EEAA3DA50A, 0x775D2F8A7F891, 0x5606F2711E369, 0x475D1186DCDE6 },
+    { 0x350C2B598A0F2, 0x3CD90F1943FD2, 0x6C2410B9A462D, 0x02808EEC31896, 0x0079B806DB3A9, 0x3ED38E5AA14BE, 0x677A2A91305D2, 0x094D48F095CDC },
+    { 0x40E17E73CA6E4, 0x056F43EA4B2D0, 0x3B71067859FB8, 0x5539D7E64EEF1, 0x1B9D58F7F02FA, 0x11F0FDB7E1311, 0x0D346CCDDF5C1, 0x131659E7622F4 },
+    { 0x6F7C0E7D24F88, 0x12F2DB960AB91, 0x606FD17E91223, 0x15BB89B985827, 0x5B611BA9D2389, 0x14E8F78043095, 0x4D19104AB95BC, 0x351D66DEA04C8 } },
+  { { 0x21C3F355DC083, 0x71BD1628AE066, 0x34E16E09C7DA3, 0x221CE58BF8016, 0x784A865E223D3, 0x30AD517A0AA7D, 0x3D04D2534F41F, 0x2BDA247676108 },
+    { 0x2E6516DF79704, 0x59CCF854F8D9D, 0x5CBB364E0D0DF, 0x11DFD02FB93C3, 0x159339CDBD05B, 0x346FF9893B59C, 0x4C4F28E9543EA, 0x212AC982A52EE },
+    { 0x10258F78A176A, 0x6DBDA391C1B64, 0x3482AB1FF0D25, 0x01BC077B80B2F, 0x606046E12AF73, 0x29F561F7FC2B5, 0x454C77D8CF25F, 0x72E0576072A33 },
+    { 0x50122EF67144D, 0x6D2BDEE0450A4, 0x44A0C422D3038, 0x60E02EA6B9C58, 0x32935315E0EC5, 0x7070C838B8070, 0x61575A744CEAB, 0x2345356380ECA },
+    { 0x3CA1E5D255344, 0x1B387F18E0D2E, 0x217A9501BA95E, 0x5F5D5FC7A1882, 0x1BC16614A9991, 0x570905E375CDF, 0x13573721C09D5, 0x5E0EA3B7B2EB7 },
+    { 0x074CE9458D415, 0x1EE5FE0BD20F6, 0x6D3095F1694E8, 0x111FF8C40C77A, 0x17DBAD112ACA3, 0x239FAE53F9C99, 0x3AFEE5B2B1C71, 0x37BE05C91C3C3 } },
+  { { 0x2F0C28D9782AB, 0x74FBA9ADB31B2, 0x1C308D163CDF5, 0x34CF8AA6752D6, 0x20C1ECCF9F563, 0x684E285A52D98, 0x538B3A91A9C15, 0x5AFE1E48F1944 },
+    { 0x366A4010E5264, 0x4BAD47C23DFEA, 0x7294D4BC4B8D5, 0x6701DC2A00274, 0x559E1D455E907, 0x501D8462A8A8A, 0x5AA8EB3750FB6, 0x18D1A9A6FEF15 },
+    { 0x1B3C798470840, 0x7AE94F38E1E1E, 0x3279EDF0369D0, 0x2ED13FDF46548, 0x733ABE8AACC0B, 0x0EB4E098B5FE4, 0x2F59E37CC84AF, 0x312056711FBA4 },
+    { 0x1F93E6483FFAE, 0x304156C1EC67F, 0x7A778C64BEDAB, 0x250330ACEB408, 0x16B723AED160F, 0x7EEF64D836771, 0x294A538D03916, 0x2EB69BD43865F },
+    { 0x5D1FD44DAC9CA, 0x7A63CA133A4E8, 0x332DB110EDE8E, 0x548543585FC98, 0x4AB15C4A9310C, 0x6D8D08C5AF96E, 0x448A2F0A65130, 0x7B3016BB8D855 },
+    { 0x530DE69E59482, 0x14559E51676F4, 0x19E912FD215DE, 0x12CBCBC07ACBD, 0x6406573B80A9F, 0x17590C9EDDFD6, 0x4E4ED4761AB09, 0x3225AB8570AAD } },
+  { { 0x69069BE318CB1, 0x528C44EE7ED70, 0x08CC59F799204, 0x40C0FC319B5FE, 0x1F64D9F145233, 0x4138BF1C38364, 0x5BDF7CD3A37D2, 0x448A70A0BAE72 },
+    { 0x283A53FB4E250, 0x453BB28D50BAF, 0x56819990F56FD, 0x520960071050E, 0x7258F51012A70, 0x436B139F60F24, 0x53646D6BCF991, 0x0B816B4316785 },
+    { 0x3DD4901094DD2, 0x39B46B7705E92, 0x26517C88BF921, 0x6F96327421A9C, 0x2CE3DB88085E9, 0x3D77745727708, 0x58C0FEC50CE7D, 0x568D15F7F588B },
+    { 0x6E82A7D0F2132, 0x7478F614869A4, 0x4FB4E9DB6A11A, 0x210DF43335FBD, 0x54993D357CCA4, 0x777399951AF38, 0x3F74631DE8501, 0x64C7C9C0F394B },
+    { 0x5B60C7DB3663A, 0x42BFC45223FA5, 0x5CEADBA0098E9, 0x4E1293F792144, 0x4A4B58E94D2F1, 0x53ED46DE8C3D0, 0x5815032F67C1F, 0x6243C7B4A39BC },
+    { 0x13505045380B4, 0x14DA5A1E8A00A, 0x60B007558E1C5, 0x1842F098E8D95, 0x7E62A39006C18, 0x3536D8CA8882E, 0x03AEA83F854E0, 0x1AA52F6546C14 } },
+  { { 0x16A51DFA680D0, 0x3C3A0AB1D25B9, 0x0E14CEF88A778, 0x344C7F52CE0B0, 0x271773FB09E5C, 0x7F8E999700851, 0x55CAD862BD486, 0x7371BB833CEE1 },
+    { 0x19D74000D805E, 0x1AEA3AA85B533, 0x34CEED754E154, 0x607321388D22E, 0x46111BA3D894D, 0x093F978E7975D, 0x233B723234ACA, 0x0F031BECBE185 },
+    { 0x5981B1E7B3BF4, 0x292832E51D261, 0x3B2AF52F40700, 0x2C2BC799566B4, 0x71F828E5908AB, 0x690F8BC2FE70D, 0x3C72C2F8D118E, 0x26393B3F8EA81 },
+    { 0x241BAB96454D1, 0x1E235FD8A5D9E, 0x07A0CFAFAC45B, 0x67F9A987E872D, 0x03AF17D9322CF, 0x5B1DCF0473711, 0x76461871D2275, 0x7FDE0F18003A1 },
+    { 0x4982773B3CCCC, 0x0D8A13A6F4247, 0x088EB601124C9, 0x42357A8E0DC96, 0x25C07C34C33CB, 0x5FC0227435923, 0x6C239F4DFAE92, 0x7387D228FA18E },
+    { 0x67E55AB408197, 0x052C04AE965BB, 0x0D2CFD6EA0960, 0x0CD1EF3534CA3, 0x069887FF892AF, 0x27DE1260745EF, 0x1A30319AF7EB2, 0x253E4C21F7888 } },
+  { { 0x470676C53A55F, 0x5337256CB4714, 0x46CAAEEAC9BAC, 0x1355D79EBC62D, 0x464ABFD22EA95, 0x51734F9D73383, 0x62F8FC56E1B66, 0x55CC7656D5C01 },
+    { 0x2978F17A0C363, 0x79A774162DA79, 0x070C9CBDFDB0D, 0x5723E4E8DB845, 0x1BDF498EDD469, 0x7CCA0E4E15555, 0x27941B86742A4, 0x6601347710C66 },
+    { 0x72D8FC99AD6D3, 0x3A84D0285FF08, 0x6AB5CA69CD7A4, 0x771210B542A51, 0x3DFF2F5C41C1D, 0x396BC8B9DA5C9, 0x16175CB6AAE6B, 0x4242C8A735FC4 },
+    { 0x3A259AF002249, 0x45BBFE3AFF145, 0x004CE432E85A6, 0x4A045830001F6, 0x3F1607FA91ABD, 0x5734E6513E19D, 0x07A22FBA5890F, 0x195DBCF1ED439 },
+    { 0x06485AF493533, 0x0126F9D671B18, 0x3F6AB0901AF83, 0x30CABF553810C, 0x49CAFBBAC6079, 0x23AC0D6117ED2, 0x13BFE9595A524, 0x279C4695668CD },
+    { 0x0AE3750D6A051, 0x1169356EC7012, 0x0CA0EB5058566, 0x1C91C91013ABE, 0x0A3CE23209B34, 0x2832E4C4DAC10, 0x6314A7EE9F1BA, 0x25DA86EE2AAAE } },
+  { { 0x07D46A6137AB4, 0x13A72812DA7F3, 0x0C7ADB2B05CEF, 0x29AE3457F4356, 0x0303BD228C34A, 0x10C58FAC7BB9F, 0x6A1729A63FA1B, 0x44860F8C5BD24 },
+    { 0x337B012E36F5C, 0x05A7F49BE5DC8, 0x28EA8BFE1140F, 0x440296FBC1843, 0x4E69F0551D45E, 0x5837510C10A0A, 0x7EF02DF8A0D19, 0x55AF1E019753F },
+    { 0x50F2109A14F0C, 0x370C74E58E462, 0x3094C1D9074CF, 0x1ECF2BA451C89, 0x12A0AECB00875, 0x7F9FD8630F8FA, 0x7C3C1ECA5E3C2, 0x3CD68AD288864 },
+    { 0x4CE3AC5DA10A5, 0x4CD5072078AFD, 0x01AF936052E2E, 0x133896CC574B6, 0x377B70C881613, 0x07580BBB1CFF5, 0x30FAD55A5419D, 0x30DE8D3043450 },
+    { 0x3491343FCA08F, 0x60D92153A8D37, 0x2A95291F03EE2, 0x32BF33B02EF70, 0x336C87ED73F56, 0x12B06F7A6419A, 0x71889787E8296, 0x56BDD45A52B0D },
+    { 0x3078569ABBA57, 0x1168E7C5B922B, 0x5694CF47B1A3E, 0x162B15B7BE50C, 0x2BC4D24528389, 0x19A9311CBD874, 0x00BC65A41681B, 0x265074B0DF115 } },
+  { { 0x558EFAE0FA86D, 0x46465E0F516F1, 0x58CB3BD5D91DB, 0x388C048938241, 0x17954E67486D1, 0x39B99776E7061, 0x0E2C96CF30D45, 0x6D024923E3EBE },
+    { 0x3ABA9BDD0B7C5, 0x566C823B5CAE9, 0x7DBF3D66C8624, 0x6B6748F52AF2A, 0x38AEC8A317406, 0x5C1DB8C0E9C25, 0x67A0454F15E95, 0x553C5C9D8E75E },
+    { 0x67568C93FCFB2, 0x0ACB6E37BE540, 0x3159A3288B328, 0x50CA7D26F00CD, 0x7EED1883C5063, 0x2BAEFF67C5F1D, 0x260F22C16C452, 0x2DC251DD0991F },
+    { 0x010B591FC17C3, 0x1D6B72B71FF05, 0x62D0AB430F12D, 0x00432A36006E9, 0x038B67619D5C6, 0x56659E073FD34, 0x04AE8EE18E374, 0x1659AD7D949C0 },
+    { 0x6FC1AE97D19AD, 0x4C280EB0D0516, 0x5ACE7D3D2DDC5, 0x6006FBE8CAB00, 0x5A28E2F9101CE, 0x208C2A8AA3BDD, 0x403BA00E2C624, 0x10D2176D48DB1 },
+    { 0x339D0E6149DC4, 0x17D294D7F3D00, 0x128968DB99889, 0x02F057BFD026F, 0x2C48606AF5115, 0x1F32FC83324F6, 0x38D5374CBEDD8, 0x270055E101586 } },
+  { { 0x76F69F20B235E, 0x784B39A5B26A1, 0x421DEA14E41F6, 0x0AD7283A04B91, 0x2617740214DDA, 0x07AB9A484A5A7, 0x794E6D400F4E0, 0x1451767846F75 },
+    { 0x7588DCCA3233F, 0x5704993AA2E60, 0x4F257A13C1D21, 0x1D3F26CFE0D71, 0x364C6D6988328, 0x3382F95678AEE, 0x1982E05E689D1, 0x01E6F483F9D72 },
+    { 0x69C69C8C4F9BE, 0x53D701F5F4F10, 0x2C16F02A011AC, 0x7E7495227DCA1, 0x1959114A87539, 0x031F95B0B4566, 0x0A845F902DE4B, 0x132C869359A64 },
+    { 0x5E9983B4BB9A4, 0x09AB31875683F, 0x29C7CEAC85E64, 0x33239EA74025D, 0x5EBA6CEB6BD59, 0x47CC7D8FBF6AB, 0x094FD212526C9, 0x50E69F366C5DC },
+    { 0x620FECE8AEF82, 0x0DC59FB7BDD8C, 0x09862404F1E03, 0x75032378012E3, 0x28285578BD2B2, 0x3596F9AA7B037, 0x568EAB09675A5, 0x2ECECF7C4C9E2 },
+    { 0x58C303CA708E5, 0x1271A8E026733, 0x1C74B2441B53C, 0x1372558AE1081, 0x58C9C6341D2A1, 0x2AB2450ECFE38, 0x5083C87375B95, 0x399FB6DA6630A } },
+  { { 0x4A7D4FB3B36AF, 0x0B1928ECD834C, 0x2F154468521BD, 0x0DC660A0FBA65, 0x32F0B44B914BD, 0x68F47225B754E, 0x1B540D6139A01, 0x2A0DFE8800155 },
+    { 0x7E3B68A4142B9, 0x0376D709CB279, 0x4BF0084C4582B, 0x03E9C11CD8128, 0x63E3296661E17, 0x428FCDB0E2FCD, 0x5CD92BB044064, 0x324961C059F67 },
+    { 0x270CA9498250B, 0x2EA72AECA619B, 0x725F6528A0AF0, 0x5F7C4543D4887, 0x4AF795B1F6D7A, 0x08A56BD30237F, 0x32755B7E1F07E, 0x558DA1DA19FD0 },
+    { 0x05E40A49F5367, 0x74AA8DE6F418C, 0x7538DB4260635, 0x7754C3FFA8741, 0x2CAB12592AC0E, 0x1DBF49E7CDE29, 0x2D687E26E74E7, 0x6F9343DCA7443 },
+    { 0x66DC02111083D, 0x3F52EB24A85FC, 0x530D3034B1997, 0x19ED28A8DE8D4, 0x3BE14841AC7F8, 0x1D0A6DDBB23C1, 0x4C8DB089B1FA9, 0x22F9F25C6E36C },
+    { 0x160C2E7425A0E, 0x0832F9B698D7A, 0x48C04ADA148DC, 0x1ECDF134352DC, 0x68C0F183786FD, 0x272389A5BC3A4, 0x38795EAADC4C0, 0x2E6F7CCFC2E49 } },
+  { { 0x7FFFFFFFFFFFF, 0x22A96AC0B9B80, 0x7FFFFFFFFFFFF, 0x22A96AC0B9B80, 0x3163C48AF428F, 0x05C913D21B690, 0x63194F0CA386B, 0x50D563064B5DC },
+    { 0x7FFFFFFFFFFFF, 0x47FCD5D8BC26F, 0x7FFFFFFFFFFFF, 0x47FCD5D8BC26F, 0x77A6572D075B4, 0x5E723459447FB, 0x22FB234CBD8A5, 0x43BC39C5DE4BC },
+    { 0x7FFFFFFFFFFFF, 0x52A9AE7BF4504, 0x7FFFFFFFFFFFF, 0x52A9AE7BF4504, 0x31AC68B84938B, 0x328265A141F3E, 0x2F5FDECCCEBF5, 0x03B4616FB7907 },
+    { 0x7FFFFFFFFFFFF, 0x64AB65F421884, 0x7FFFFFFFFFFFF, 0x64AB65F421884, 0x317D79EEF32D4, 0x6B0F9C1CD8FEF, 0x2E0D1F2726527, 0x59574ECE45962 },
+    { 0x7FFFFFFFFFFFF, 0x04309479F6232, 0x7FFFFFFFFFFFF, 0x04309479F6232, 0x744CAB90D50DC, 0x461849254C48C, 0x094266BC3BAFB, 0x7334A5CF81CB4 },
+    { 0x3FFFFFFFFFFFF, 0x13DFB53B440C8, 0x3FFFFFFFFFFFF, 0x13DFB53B440C8, 0x5A24404D7B6FC, 0x356386F5B3D9A, 0x6A8E29796C101, 0x24DDAE30CF96C } },
+  { { 0x10EDDDC7CD58B, 0x7CD442BB75064, 0x6FB1BB5523B9B, 0x2F4F5EB527F6A, 0x6F12223832A73, 0x487E92C5FE69C, 0x104E44AADC463, 0x160376CC4B796 },
+    { 0x3B3E495FCDB1B, 0x06D240338FC5F, 0x632B78AFE5FF3, 0x1B2D6C1DA5A2E, 0x44C1B6A0324E4, 0x09276B7DE887E, 0x1CD487501A00C, 0x74CC3F93D2AB0 },
+    { 0x063F86D1A9B85, 0x550DA19293504, 0x1029846FA7455, 0x6DDE4F35B3FC0, 0x79C0792E5647A, 0x5045BB6555505, 0x6FD67B9058BAA, 0x37750DC234A48 },
+    { 0x3A0C9B63014C0, 0x1371B07DA5690, 0x3E756BCD39CB7, 0x1A9C75251BA51, 0x45F3649CFEB3F, 0x35E51B6A9DA78, 0x418A9432C6348, 0x2EBA56C3276B7 },
+    { 0x1DFD5A28FB882, 0x09193FB676151, 0x186F979E1CFCC, 0x17EE06A1BD692, 0x6202A5D70477D, 0x7F47E93D76314, 0x67906861E3033, 0x707322522EDD3 },
+    { 0x6F672EA55030C, 0x03479B10DF9BA, 0x78BBA3D91059D, 0x07CE7C37A609B, 0x1098D15AAFCF3, 0x2477CF65A87D5, 0x07445C26EFA62, 0x1FF0EE3EE20F4 } }
+};
+
+static const vgelm_t ladder_table_B[OBOB_BITS-1] = {
+  { { 0x65A9F586DB4A7, 0x52F5C5BEAD174, 0x0000000000000, 0x0000000000000, 0x65A9F586DB499, 0x38399C48D527B, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x6E25E21B2BCD8, 0x14D8C5099F1A7, 0x0000000000000, 0x0000000000000, 0x6E25E21B2BCD8, 0x04AC76E3E93BD, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x6AB0EE0D612E1, 0x083662EA5CCC8, 0x0000000000000, 0x0000000000000, 0x6AB0EE0D612E1, 0x0D7DEDB1B9308, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x4C0C164130CEA, 0x696A272BAFC0C, 0x0000000000000, 0x0000000000000, 0x4C0C164130CEA, 0x6AC9BA858534D, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x08FD2304ECDAA, 0x7B2971CC1AE6B, 0x0000000000000, 0x0000000000000, 0x08FD2304ECDAA, 0x35D1907790D32, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x7853BCFA982AB, 0x1121C38A5CF7A, 0x0000000000000, 0x0000000000000, 0x7853BCFA982AB, 0x275DACC815A6B, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x6A655889084C8, 0x6ED1AC583E5F0, 0x0000000000000, 0x0000000000000, 0x441FF1BB6885E, 0x666D4BEDCDA73, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x085C151148863, 0x5F3EB36567A97, 0x0000000000000, 0x0000000000000, 0x35AE57F93125A, 0x179FF913055B0, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x44E2576B4AF8B, 0x198A1751078E7, 0x0000000000000, 0x0000000000000, 0x3B2A0E6455991, 0x0827CB0908601, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x23709CDE93967, 0x395A6CC4D5EF7, 0x0000000000000, 0x0000000000000, 0x341D6C052FCC8, 0x35C2F96F605F6, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x6DB60D2291632, 0x5053297B61AB3, 0x0000000000000, 0x0000000000000, 0x5027F026A6459, 0x657D136FF82F1, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x30A967DE6F5FF, 0x07F47154C3C08, 0x0000000000000, 0x0000000000000, 0x0E7FECDD5C31D, 0x24CDADFDE8602, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x51A95E9F3418B, 0x34DE6F31564B3, 0x0000000000000, 0x0000000000000, 0x573678BEEDF0F, 0x62E27C880FD4C, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x49115076B3000, 0x118F569AA2F53, 0x0000000000000, 0x0000000000000, 0x399A8F4F845A2, 0x214DCE1A8137D, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x13FB6615F21BF, 0x4F49A325DDEE9, 0x0000000000000, 0x0000000000000, 0x723439BD98A03, 0x2F0C95DF28DF2, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x07B8DDD1CE9B9, 0x10B983C8FAFEA, 0x0000000000000, 0x0000000000000, 0x21BD3F71E4A8B, 0x487719D8BD910, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x105F8339FE19A, 0x01BD1C60E360E, 0x0000000000000, 0x0000000000000, 0x1A1752D1C223E, 0x2A659E3FBD757, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x6DB05C42AC7C6, 0x25F0F5062A5F8, 0x0000000000000, 0x0000000000000, 0x6FE645A10F789, 0x2944564C3EB61, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x230EA89550095, 0x024A371E83630, 0x0000000000000, 0x0000000000000, 0x51631336A4E69, 0x4DA7EE3EA76EC, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x76A0CA920EAF1, 0x06BD0CA0AFDF6, 0x0000000000000, 0x0000000000000, 0x13566BA7CE5D5, 0x65067573BAD05, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x3CD51DACCEEF3, 0x5354D470AB468, 0x0000000000000, 0x0000000000000, 0x37238E5A4CF70, 0x1444EC079B4E7, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x28E9C65D4CAC1, 0x4A7DBB8EAE054, 0x0000000000000, 0x0000000000000, 0x0F348D71C1595, 0x24D43C32029DF, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x130DA3AE72164, 0x4F8F4B192600A, 0x0000000000000, 0x0000000000000, 0x09A2BBA81E642, 0x3501CDF76787B, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x7446CB0D73448, 0x079C1EFF8A848, 0x0000000000000, 0x0000000000000, 0x1FC64D0406244, 0x2838784CBD7CE, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x0FF3F10839240, 0x07E18A270AC5E, 0x0000000000000, 0x0000000000000, 0x21075FA70C28A, 0x04C9A7A9A7F86, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x3FC29B9BC6D0C, 0x02D53E7BC18C7, 0x0000000000000, 0x0000000000000, 0x36BF0ACC33E54, 0x7DA92CCCD3B6A, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x22755ABCC7174, 0x73F1B651F0E34, 0x0000000000000, 0x0000000000000, 0x54E892FFF38EC, 0x6E2990D8C41F5, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x2EA4F4B4B21B5, 0x306E0B9B1A779, 0x0000000000000, 0x0000000000000, 0x38CCA8373FF12, 0x0E2B931B42890, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x57819E1D57316, 0x502457E56EF61, 0x0000000000000, 0x0000000000000, 0x4868AEE78C429, 0x3B8BB4D67A0CD, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x4C6443301C212, 0x10EF19CDEF8BF, 0x0000000000000, 0x0000000000000, 0x7F70A6BB17B4C, 0x35C1114CC3A7C, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x3062CA497DDCB, 0x3E47431ADAA29, 0x0000000000000, 0x0000000000000, 0x35C33115D390B, 0x41CD87F78E91F, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x736FDFC133B54, 0x382C947E07286, 0x0000000000000, 0x0000000000000, 0x596C754013D51, 0x2DF45896AED27, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x35912195282C2, 0x25DCEDE386359, 0x0000000000000, 0x0000000000000, 0x4D01EBD5FFAF6, 0x235577EAD5D92, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x7E158310F3794, 0x27D3AAAF79584, 0x0000000000000, 0x0000000000000, 0x4807F0B223EC7, 0x19F06D5F445E6, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x3BC71E3ADA56F, 0x0CD222DE2CB9B, 0x0000000000000, 0x0000000000000, 0x68DAD6EBCEB90, 0x19049FB7600D5, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x4A13C3F76F23B, 0x1C4DAE0D90FDF, 0x0000000000000, 0x0000000000000, 0x64E2AF6051D6F, 0x1CC42EB01A24B, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x43E722F4655C5, 0x7A60C0F941DF0, 0x0000000000000, 0x0000000000000, 0x7C4C676AF5349, 0x45E1BA4850676, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x28E4CB97A8B4A, 0x59885757EBF51, 0x0000000000000, 0x0000000000000, 0x6C3ACDF9A4522, 0x0B779DAF86AB7, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x62DEB79779121, 0x5FF526B590245, 0x0000000000000, 0x0000000000000, 0x3BD22D161E2C7, 0x7EF4369FDF795, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x279E3C335D688, 0x2E99448D1CF3C, 0x0000000000000, 0x0000000000000, 0x2AC4606AD7BB7, 0x0E4FFF1DA908E, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x33D525BE1F7F9, 0x5F64A37B84040, 0x0000000000000, 0x0000000000000, 0x089E4AEB7AD2A, 0x2FEFBD0738238, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x5EA8C6E713906, 0x098204718A4BE, 0x0000000000000, 0x0000000000000, 0x12814879AE2AD, 0x2BF310CF2EE96, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x25B82CB65E650, 0x0C31D0D05CC40, 0x0000000000000, 0x0000000000000, 0x5B3F5EC9CE9EE, 0x5B2F5593B2BA3, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x444B9935807EC, 0x21429E2F55B8B, 0x0000000000000, 0x0000000000000, 0x64D0C5C70A4B3, 0x7FC1D5D022250, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x5B9EB109AB552, 0x5D64AC14A6ABC, 0x0000000000000, 0x0000000000000, 0x6DB8AF9F1BD66, 0x1A2EB07F501C4, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x67C999025AE70, 0x2939F5E8C61DE, 0x0000000000000, 0x0000000000000, 0x58C35C8974607, 0x50DBB43A523D8, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x3FC878FE7715F, 0x49D9025EDEC08, 0x0000000000000, 0x0000000000000, 0x7D0262E71F75A, 0x5AD4184374712, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x05B16D2990563, 0x12A7B0C282481, 0x0000000000000, 0x0000000000000, 0x68D97AAA9924F, 0x30365AE830452, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x2E232CD480E7A, 0x7B71075243AC5, 0x0000000000000, 0x0000000000000, 0x78586DAA01EBE, 0x4B127B014A1FF, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x28463A0862441, 0x18F63EA1856B6, 0x0000000000000, 0x0000000000000, 0x2EEA7B4328C16, 0x21C30A715D53E, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x583AD5084E007, 0x47489365A5E87, 0x0000000000000, 0x0000000000000, 0x3740DBE24CB81, 0x0F7C2758FFF04, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x509527C3BE8D5, 0x71C3C6CC9FF56, 0x0000000000000, 0x0000000000000, 0x257593E5C1423, 0x5F51DE1D656FD, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x6CA212381485A, 0x5282A355D2BA8, 0x0000000000000, 0x0000000000000, 0x0C8761E1E3E57, 0x41029B13721FB, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x3C85A4A2F1629, 0x092A3A40A6944, 0x0000000000000, 0x0000000000000, 0x368EC1874C958, 0x2C340A3592485, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x60F6228F68BDD, 0x7CDB2E706852D, 0x0000000000000, 0x0000000000000, 0x2748ED62BBD4B, 0x16FEE2FD1F051, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x38C05130C2743, 0x5BB02A1D3F5FC, 0x0000000000000, 0x0000000000000, 0x27C2C432C9788, 0x6F90DEE12BE1F, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x37332F71600E6, 0x68B79A0D49685, 0x0000000000000, 0x0000000000000, 0x7DC27C22C2C8F, 0x2B45FF45296E3, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x6A967A1CE7F16, 0x51CE0910A203A, 0x0000000000000, 0x0000000000000, 0x582D4287E1AF6, 0x65AC2F423D61B, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x264D86BE99218, 0x0392DEDA90853, 0x0000000000000, 0x0000000000000, 0x28D128163EE21, 0x1A3B8AE0DC925, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x4740AFA3000B3, 0x21D36FA9F341B, 0x0000000000000, 0x0000000000000, 0x0DAAA3E89B9CB, 0x25009E42830E4, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x44BE94F7EADE4, 0x07C3D6E5DDDFC, 0x0000000000000, 0x0000000000000, 0x58EF0781D242A, 0x1B99257CA9FE8, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x0D385EABB5EE9, 0x7C17D379AE96B, 0x0000000000000, 0x0000000000000, 0x0C3DC64B193D4, 0x63189792455FE, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x203259A863791, 0x79EFBC44321C4, 0x0000000000000, 0x0000000000000, 0x4CE7B4E776C63, 0x7210921063ACF, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x4C28BCAFA17A5, 0x37E1870AE3FE8, 0x0000000000000, 0x0000000000000, 0x41CF8BCD382C8, 0x401D707BC89AC, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x4EEBBDC4CA4E7, 0x01A847ED094D7, 0x0000000000000, 0x0000000000000, 0x18AC1772686F9, 0x56C152F66703B, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x265D37C222C57, 0x03960D06250C6, 0x0000000000000, 0x0000000000000, 0x4DA3D6CB394D9, 0x258EC603215DD, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x7CA1D88022A7B, 0x185E7C150BA10, 0x0000000000000, 0x0000000000000, 0x39387C52E034F, 0x40778553F11E0, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x01E86F4120994, 0x75D594C1AD8C6, 0x0000000000000, 0x0000000000000, 0x2C4161F4E4D88, 0x06C3C4535D859, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x5A520CBDA800F, 0x1CA0CA62185CA, 0x0000000000000, 0x0000000000000, 0x397DBD14464B9, 0x33026EC376612, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x4ECABF1630CD3, 0x6A8A0EF40AFFC, 0x0000000000000, 0x0000000000000, 0x6433F4B311D2E, 0x240C8D1235D96, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x4E783FA3EB65F, 0x08CFB9EF0C682, 0x0000000000000, 0x0000000000000, 0x4BA07C7668BA9, 0x091EBE6A735E9, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x4208B7866865E, 0x100D0564DF3AF, 0x0000000000000, 0x0000000000000, 0x155AC6BB4373B, 0x2979A0DC35187, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x73800F61B1BEC, 0x5FB0C6AA1E4A0, 0x0000000000000, 0x0000000000000, 0x2B0B7A8CD0EFE, 0x6755FCE366831, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x0BEDE5E06A596, 0x71405A1C83D58, 0x0000000000000, 0x0000000000000, 0x7CDA80B293C07, 0x3CDE59A503003, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x1300302ED6E93, 0x2C6E07FD68F17, 0x0000000000000, 0x0000000000000, 0x2B508E9E19253, 0x549D4EF107651, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x45FD8028E5C33, 0x37105AE3DBD5C, 0x0000000000000, 0x0000000000000, 0x27DD255047113, 0x40E79F3AF82FD, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x049E5DA4F94F4, 0x01AA3EC1B7587, 0x0000000000000, 0x0000000000000, 0x63356191E5498, 0x5A2549C7DA6DD, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x165E3D34710E4, 0x156DCD173D620, 0x0000000000000, 0x0000000000000, 0x6F7D329D2404E, 0x25C9B08D82E0B, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x5A35D99371D5A, 0x2D8AF2FA4400B, 0x0000000000000, 0x0000000000000, 0x390A2300FF0B6, 0x17125E31C8453, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x664237F3EC050, 0x07364D63A27A0, 0x0000000000000, 0x0000000000000, 0x4D38DBC4AEBBB, 0x47B500568F59D, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x330C703E7BBA3, 0x21E3EA7DBDFAB, 0x0000000000000, 0x0000000000000, 0x4627F0989210E, 0x5B6FA01EE9931, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x01C2573CC46FD, 0x633D7ED26A9F3, 0x0000000000000, 0x0000000000000, 0x26BBC85C1E6A3, 0x6890B12A27026, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x03CB68DADB9AF, 0x37DBD8AB0E071, 0x0000000000000, 0x0000000000000, 0x362E1DD17EE18, 0x7300DD6B1D65F, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x390413EDECB81, 0x1475F51ED07C4, 0x0000000000000, 0x0000000000000, 0x261F5DB721469, 0x1AD2EDFB6E965, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x181F617D6A974, 0x01DC286DCAE54, 0x0000000000000, 0x0000000000000, 0x3B29DBDF54EDC, 0x243A55C6BE4A8, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x2243BE4730660, 0x404CD0E93F396, 0x0000000000000, 0x0000000000000, 0x0D738AD79C318, 0x715F83A721892, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x77248CA378C24, 0x094B2BAB6C42C, 0x0000000000000, 0x0000000000000, 0x0CD0FCAADFB29, 0x36FFE03FC658C, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x0F7A0E80A2677, 0x7A4AAF8FA59DC, 0x0000000000000, 0x0000000000000, 0x1E72D2A85C2E1, 0x34FD5C262667F, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x1F5DB04A1133D, 0x157E2BDE031AE, 0x0000000000000, 0x0000000000000, 0x7BCEB5223A0DF, 0x1A967514D9379, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x55224FC6D4900, 0x1488122E32D10, 0x0000000000000, 0x0000000000000, 0x1ABFFE73DF4F6, 0x310DC39DF6BAE, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x3115DFB723F5F, 0x067FF470AE905, 0x0000000000000, 0x0000000000000, 0x55C549661F555, 0x6373AF2846D7D, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x399504961D93F, 0x53B3D933276B6, 0x0000000000000, 0x0000000000000, 0x1354794AEC95F, 0x200A9CAD871E6, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x509EC698473AE, 0x46B6D09BAE687, 0x0000000000000, 0x0000000000000, 0x0A5D9BA333502, 0x606174E5ECE0C, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x29FDDCB7B9C26, 0x5C10CA32554FE, 0x0000000000000, 0x0000000000000, 0x2CAD0877AE4A5, 0x46C756491DBB7, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x719C3F9103412, 0x776E948F4800D, 0x0000000000000, 0x0000000000000, 0x337A196401D42, 0x7A10612C2A9A2, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x1B71EB75B45EB, 0x08DE1C0D51C92, 0x0000000000000, 0x0000000000000, 0x33D489D72E953, 0x2856D70557511, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x3E6B4895AFAF7, 0x311F63CE4766C, 0x0000000000000, 0x0000000000000, 0x280C4A0CA845F, 0x3E0E0BE56FB95, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x04F0C60FA79FF, 0x058E494CCCFAD, 0x0000000000000, 0x0000000000000, 0x058D08277B099, 0x57DB4A1BEC88F, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x7D768508A5617, 0x02B621AA7CE9A, 0x0000000000000, 0x0000000000000, 0x67BA6C5442BCE, 0x5055180E4B950, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x42CE8A47D824C, 0x55EF1B9656A1B, 0x0000000000000, 0x0000000000000, 0x4E07F320C270A, 0x0DF561557C8C5, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x53B0EFB467029, 0x049FA61403348, 0x0000000000000, 0x0000000000000, 0x336B0A86A2582, 0x3FB1C4BD24580, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x324B64AE36C80, 0x2236FAA7C67E5, 0x0000000000000, 0x0000000000000, 0x79663E80B72BE, 0x2A3D4C85A89E6, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x1EBAE96B95A0F, 0x7B63FCD97D7FF, 0x0000000000000, 0x0000000000000, 0x44AB869C69BB1, 0x7237574351E5F, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x45A2004629DA9, 0x5C91E03307561, 0x0000000000000, 0x0000000000000, 0x21BFDE5ED0644, 0x6B29CBC1B1D63, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x0B658CD18A791, 0x1D698202C5578, 0x0000000000000, 0x0000000000000, 0x4E8686A1DAB1B, 0x696F84FC8A294, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x00B27E936C4A2, 0x36AE541EAA40B, 0x0000000000000, 0x0000000000000, 0x2736E47EB7D7E, 0x3ECB1FC74057D, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x33ECC7F731F95, 0x06D7B12A791B3, 0x0000000000000, 0x0000000000000, 0x50D6C4173B4E0, 0x7525680CC5698, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x67471AAA3DFDC, 0x13EB70C51CA51, 0x0000000000000, 0x0000000000000, 0x34B0188BF852C, 0x2F091AB280065, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x7645D38DB8D2C, 0x2E51DAC11A6E9, 0x0000000000000, 0x0000000000000, 0x008A2D2DB58B6, 0x11BD0F883423E, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x1138070E93295, 0x786CB4ADCCA7B, 0x0000000000000, 0x0000000000000, 0x265841847892B, 0x1A8DD124C6919, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x376A483086DBC, 0x6C7E2893CCC87, 0x0000000000000, 0x0000000000000, 0x25EE6CD7AAEE2, 0x345CCEBE29BF5, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x2D799ED5BA595, 0x43D5244550AD2, 0x0000000000000, 0x0000000000000, 0x15CC5AE347AEF, 0x0C5A5DC5A401A, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x02FE9755B6CB7, 0x0DC48C1692409, 0x0000000000000, 0x0000000000000, 0x06B74985A0D7C, 0x2BC9B4BB29A0F, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x2223AB5BAFBB2, 0x1E2D027FA3527, 0x0000000000000, 0x0000000000000, 0x77995C6715FA7, 0x1F77D51F0E045, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x383D1AA6409F5, 0x28F078F7EC309, 0x0000000000000, 0x0000000000000, 0x5C1FE9036377D, 0x38867AD34A253, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x0450C9C113E29, 0x1AB01B5AD2C7A, 0x0000000000000, 0x0000000000000, 0x63C5CABA4A50A, 0x26AA678871574, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x4748EDABF78A9, 0x0FFE0C6F52184, 0x0000000000000, 0x0000000000000, 0x29B4FE465AE33, 0x06EC6FA3ECC81, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x17906166366ED, 0x755433F81447D, 0x0000000000000, 0x0000000000000, 0x567C461429CF7, 0x3D7468746EEC1, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x4BF207A3F17CC, 0x025B1203D0C62, 0x0000000000000, 0x0000000000000, 0x3AEB1B3C80070, 0x181669855DDEC, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x687491B9A79C1, 0x13E467291D176, 0x0000000000000, 0x0000000000000, 0x40A69549EF3FC, 0x1A76D79D56E71, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x3A9DC8B3D6D91, 0x112E6530F3441, 0x0000000000000, 0x0000000000000, 0x101A3624AB57D, 0x088B82DFE7D13, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x45E8DFE05E8CE, 0x3093D40E18FEC, 0x0000000000000, 0x0000000000000, 0x647735165E139, 0x78EFFA9EF73F6, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x5DCE10441B4D0, 0x7C87B6F276AF6, 0x0000000000000, 0x0000000000000, 0x38ACE7C41F6BD, 0x232385D73D025, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x0F92C2EE1B34C, 0x2FCC844488942, 0x0000000000000, 0x0000000000000, 0x727E091B14CB2, 0x4235677D10BCA, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x11036DEC60081, 0x7EE7A05608B6D, 0x0000000000000, 0x0000000000000, 0x058C1507882B1, 0x5AF3A78F5E108, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x2FAE130A5BD76, 0x13A7CD7A7F982, 0x0000000000000, 0x0000000000000, 0x0D3C0679EB72B, 0x1EDE93DA97A95, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x5AD01052312CA, 0x6F9CB69F43436, 0x0000000000000, 0x0000000000000, 0x6083CE70C2750, 0x584B9D768E223, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x085D9DE6B707C, 0x77671CA5B762F, 0x0000000000000, 0x0000000000000, 0x31088DB033108, 0x1EF4A60E7A31B, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x533B8B3BD0575, 0x71629FE48E618, 0x0000000000000, 0x0000000000000, 0x5C9A16AF0E9C0, 0x1D13F186A4430, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x12EC6147DE2A8, 0x4D50CCB36C109, 0x0000000000000, 0x0000000000000, 0x70ACAD695DCED, 0x142FE058B719F, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x478A5095D6FD9, 0x7389FC30A7315, 0x0000000000000, 0x0000000000000, 0x077BA3E321815, 0x029D69895E979, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x56808CF0DB8B9, 0x09B6515E09EC4, 0x0000000000000, 0x0000000000000, 0x1ECA622F9B17C, 0x230ABA3C3A010, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x6BCB79072E97B, 0x53F70212F6543, 0x0000000000000, 0x0000000000000, 0x7AFAB0DE77541, 0x61B18C5E1E516, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x7F789DA0BDB52, 0x187ABEE500731, 0x0000000000000, 0x0000000000000, 0x755DE04E6F0B1, 0x7185B8F8651AF, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x7D71073BD948E, 0x26B4C570B99F9, 0x0000000000000, 0x0000000000000, 0x0B01188B46AB9, 0x6A36E6AF7925B, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x3BD5F6E1E5EAE, 0x7CC1B2074FFAC, 0x0000000000000, 0x0000000000000, 0x407D0F6C7E682, 0x77607E8B81E1A, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x149C6829E2B0C, 0x55276B92FE792, 0x0000000000000, 0x0000000000000, 0x369D63906A39F, 0x2EC53FDE38E51, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x0280504E3FCA2, 0x24D3E60235329, 0x0000000000000, 0x0000000000000, 0x42CFFE6E68AFE, 0x2734EEA679E03, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x25780297DE068, 0x059E65984000F, 0x0000000000000, 0x0000000000000, 0x6FF2B933C7E54, 0x42D20AB53C59F, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x4BDAA6FA44BC8, 0x4BC1D545F6A21, 0x0000000000000, 0x0000000000000, 0x7C2310F3CE5CE, 0x65710EFD1F329, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x6E5A016528E74, 0x761A687E88988, 0x0000000000000, 0x0000000000000, 0x6F3CD531B17DA, 0x37C3F7F98B470, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x765994A0ACC83, 0x64A094CCD4DFA, 0x0000000000000, 0x0000000000000, 0x35821B0798F1C, 0x0E88519DC7871, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x656375013C0B9, 0x15A67509FE611, 0x0000000000000, 0x0000000000000, 0x672649A5DAE60, 0x1E76BFEC73885, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x5166816441094, 0x05CC1D2B53F7E, 0x0000000000000, 0x0000000000000, 0x196B65E5C05D1, 0x261E65AC2DE05, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x054B638814D29, 0x5066B8A19DFF1, 0x0000000000000, 0x0000000000000, 0x2F8172F7CE50B, 0x4544280AF5F43, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x5CCDFA4CB7973, 0x4272D30E2EBFE, 0x0000000000000, 0x0000000000000, 0x7FA1DA3E9AB3C, 0x1BCF41A0C6ED3, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x3B464B3EE5788, 0x1F27A43201EC2, 0x0000000000000, 0x0000000000000, 0x508828FC3244A, 0x034EF548CB093, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x199FF3BF9C291, 0x7553D272CDCD8, 0x0000000000000, 0x0000000000000, 0x2BB4609633990, 0x3123726690CC8, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x00DB413109949, 0x3842017AA6816, 0x0000000000000, 0x0000000000000, 0x2B7F6F2DFF615, 0x2BBE0EBD7AC59, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x161CF1BBBB52B, 0x0E8F5E84E74C7, 0x0000000000000, 0x0000000000000, 0x04CA0DEC7BDB5, 0x23DD020D0F77D, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x38D9A499815F6, 0x7B9F4D46B35BF, 0x0000000000000, 0x0000000000000, 0x52BCEFDA759E0, 0x38B59510389DB, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x7D0C7BC44FAD0, 0x1DBBE2D4A8A5C, 0x0000000000000, 0x0000000000000, 0x42A68D28014FA, 0x55FFDDE9FCD46, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x4A3EC40520A92, 0x773352F7CBFC6, 0x0000000000000, 0x0000000000000, 0x1BE8E42E9C179, 0x4189BD8E4F4E9, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x6D50DDF3A189D, 0x054B9A7587A54, 0x0000000000000, 0x0000000000000, 0x78AA81882A7CA, 0x4884C40FE91B3, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x1E6B35414F430, 0x20D2AF207A2D7, 0x0000000000000, 0x0000000000000, 0x712C4FC9A8B11, 0x5EA1FBBC568F6, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x79DC4BC9A0271, 0x06913A005D1D7, 0x0000000000000, 0x0000000000000, 0x19A1F9C515355, 0x23B4F9B8E2138, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x203EAA387BB99, 0x2BAD8068CDA8C, 0x0000000000000, 0x0000000000000, 0x41D0DBD123A29, 0x43EB2ABAB8566, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x5F1667ED898A8, 0x7ECB78B8B5A3C, 0x0000000000000, 0x0000000000000, 0x65601593783EC, 0x1F7B9104E5865, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x301DF2A046674, 0x0E04CA8D13964, 0x0000000000000, 0x0000000000000, 0x3DE3C562C9E60, 0x5A73D9CB633FC, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x7CC69AAC1B96B, 0x3367EB73B6C1E, 0x0000000000000, 0x0000000000000, 0x5111D7B579012, 0x00B60EE3773BE, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x76094A315D145, 0x22531C483B54D, 0x0000000000000, 0x0000000000000, 0x3256B5933E1D8, 0x460DBECEB65E2, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x33BC0D5D3C8F9, 0x03A83485C1094, 0x0000000000000, 0x0000000000000, 0x0FDCA5E8E2365, 0x26A5F898CFF5B, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x298B273881389, 0x3A3766775DBD5, 0x0000000000000, 0x0000000000000, 0x40BC520E948AD, 0x0853097944BEB, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x68E0D005B8231, 0x6584EF711CC19, 0x0000000000000, 0x0000000000000, 0x2DDB0CFE6AA8C, 0x1B4A9214435E7, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x26CE7508CD53F, 0x385592350E5BC, 0x0000000000000, 0x0000000000000, 0x240AA51F38A7E, 0x1F63D5D62EFCF, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x73DBBA17FCB7B, 0x6E6D1552E4EC4, 0x0000000000000, 0x0000000000000, 0x1CC7ECEEFD2F6, 0x1DBC7E6280E1B, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x4C7A1A44FF728, 0x2C97271E08A7D, 0x0000000000000, 0x0000000000000, 0x270C387F20490, 0x60A8EDCC5ADD2, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x015DA76F3FEA4, 0x0AE9E829F10AF, 0x0000000000000, 0x0000000000000, 0x5D7B9C108D730, 0x2789FCD30727E, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x21AC56C05A95E, 0x7B167EBC4D3D4, 0x0000000000000, 0x0000000000000, 0x27E83AF95BDFC, 0x4412FE0A6A02C, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x440CBF391B35A, 0x19DD1DE90F6CD, 0x0000000000000, 0x0000000000000, 0x7046B753083ED, 0x48FEAEBD84D32, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x1F77A6AEA67A8, 0x247D9712E0FE6, 0x0000000000000, 0x0000000000000, 0x6F6FC425EA881, 0x0EA7AF02A9A97, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x094F707D82F63, 0x2D1A700FE6CF5, 0x0000000000000, 0x0000000000000, 0x2D789EA70945B, 0x259B0A55649B0, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x34AF13D81D7E3, 0x3DD7032266842, 0x0000000000000, 0x0000000000000, 0x48B34A0EB2543, 0x0400819B5AE77, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x48A7F775D5D93, 0x0DB8F6BA9B554, 0x0000000000000, 0x0000000000000, 0x38D6D32663525, 0x2189E7321923A, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x0765C9905F774, 0x4592F51A039DA, 0x0000000000000, 0x0000000000000, 0x5D75DCCE23B2E, 0x5F7F0F4D34850, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x707C521AB51B5, 0x59E1D551C48E6, 0x0000000000000, 0x0000000000000, 0x373D810514551, 0x363647FD0EF2A, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x3F6A2C4F5B114, 0x3396AF5334C94, 0x0000000000000, 0x0000000000000, 0x04DC1CD0D97B4, 0x231E2C20CF75C, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x6D4549B1B44B8, 0x6F6B913721DE2, 0x0000000000000, 0x0000000000000, 0x573EAB48EF746, 0x274C63B8B1F10, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x6BE85DEC3F600, 0x2C43F3554C2E8, 0x0000000000000, 0x0000000000000, 0x0D9BBCB35D095, 0x2E2E6990C7F19, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x2486F1912779D, 0x0F266824FB420, 0x0000000000000, 0x0000000000000, 0x745A33CF392F1, 0x310908156B18C, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x6A5BF30B05037, 0x10F21AB7DB9EB, 0x0000000000000, 0x0000000000000, 0x6C0765A51276F, 0x11FC332212BD9, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x721EF4EE41BA6, 0x4D7AD10E59C58, 0x0000000000000, 0x0000000000000, 0x02B4942A4A68B, 0x415BA7E74417E, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x3A1C37C4293A7, 0x067EF8F21FC8F, 0x0000000000000, 0x0000000000000, 0x4FA218956530F, 0x5BA2C7CD33330, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x310CC1054B305, 0x0CF54A7957180, 0x0000000000000, 0x0000000000000, 0x723DE6E4C0DA1, 0x67A55E73EF2CE, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x21423CDD12B2C, 0x4C2EA936D764B, 0x0000000000000, 0x0000000000000, 0x48754CB61BCE4, 0x1D58289BB884C, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x6D30C26EB0A68, 0x1592387D41CF2, 0x0000000000000, 0x0000000000000, 0x6ADED81D494BE, 0x234CCBCE79A87, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x7234BA9C54AE9, 0x741B1EA277413, 0x0000000000000, 0x0000000000000, 0x65BEB3FA6D90F, 0x03B6DF330DF7E, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x61F3B5C536B64, 0x083B4A7D65C51, 0x0000000000000, 0x0000000000000, 0x5833983394D01, 0x7E6945977843D, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x2D8E6FF354B6E, 0x03219B2E179A8, 0x0000000000000, 0x0000000000000, 0x31FB58CCF9CFD, 0x4FF0483907C6E, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x0F349C59891AD, 0x061A76B2B945E, 0x0000000000000, 0x0000000000000, 0x659BC421C229E, 0x533A8E8903412, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x1D3B401FB5FF4, 0x15A687BEB8B7C, 0x0000000000000, 0x0000000000000, 0x6A97866B59C2D, 0x36833ABC627E3, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x358AED2985529, 0x1D94A97788948, 0x0000000000000, 0x0000000000000, 0x5C749E2F2D82C, 0x1E8BA4EAA6CB9, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x0664E242CACD3, 0x5CA7DDD60A395, 0x0000000000000, 0x0000000000000, 0x2980E1F8ECD81, 0x047C78034C059, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x69B260791A822, 0x4FCA1E63015FB, 0x0000000000000, 0x0000000000000, 0x5BC83B47D349B, 0x4A58D2B6951C3, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x604021D692447, 0x0FBA6FA1DC7AF, 0x0000000000000, 0x0000000000000, 0x3ABBC99F88B68, 0x011D9D488ADA1, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x4D2C08A9B462C, 0x19E95185059D6, 0x0000000000000, 0x0000000000000, 0x60166A4674E9A, 0x7CF4F71AC0FF0, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x42BFF03EA64AC, 0x53786FDF2DD9E, 0x0000000000000, 0x0000000000000, 0x2B281397F309F, 0x0D9BFD7CC9F8C, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x5F7EFDEE83FF6, 0x0CB58CAB04E49, 0x0000000000000, 0x0000000000000, 0x0ABCE8D486DB0, 0x2A730BD35929D, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x7604D7F1DF300, 0x3AC80E5C64A7B, 0x0000000000000, 0x0000000000000, 0x4EBC077E5B0BC, 0x7317008776F18, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x64D12BCED4CB1, 0x53255206464B5, 0x0000000000000, 0x0000000000000, 0x09DBD52F33D60, 0x26F6015B7A9B6, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x1C0C7ECBEA08D, 0x441C3363703BB, 0x0000000000000, 0x0000000000000, 0x585FE2E32143F, 0x3490A16C195E8, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x2B4574248A9E5, 0x7A1DCB179FBF6, 0x0000000000000, 0x0000000000000, 0x2C86B345B9824, 0x2B78C0BD4FBE2, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x68470CC68FDB3, 0x7AB3C36268F3D, 0x0000000000000, 0x0000000000000, 0x14C40FD197E61, 0x46B19C34FFDEF, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x2359C4831A168, 0x10EDAFC783238, 0x0000000000000, 0x0000000000000, 0x37FA7F3946E5C, 0x2898179ED5A60, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x353D8A91E530A, 0x0FA210C4E2188, 0x0000000000000, 0x0000000000000, 0x0F86998923168, 0x4397520EA3D46, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x10FCB5ABCE0B7, 0x4278599A0B41A, 0x0000000000000, 0x0000000000000, 0x7F91717528772, 0x235DB2FB7FAF2, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x466D871873DDF, 0x5C1A0D0BDC13D, 0x0000000000000, 0x0000000000000, 0x7881DF3576EB0, 0x3C7AE89470DF3, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x737D0B4AA6EA4, 0x17B2B71132FDA, 0x0000000000000, 0x0000000000000, 0x4D100BF347C93, 0x557891A657CCC, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x172133089E2F0, 0x0FCBE17AD7CCF, 0x0000000000000, 0x0000000000000, 0x7901C2D2C840C, 0x5CFCAE9AD9E94, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x3C420A25081BD, 0x057909D2558DF, 0x0000000000000, 0x0000000000000, 0x4CFEABDF04DFE, 0x23F621FCC7875, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x08452782040D4, 0x72DD6137F2DB9, 0x0000000000000, 0x0000000000000, 0x50E28680A4166, 0x39D5C34F1CBC6, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x45D518ABC9B80, 0x23ED9402E7A69, 0x0000000000000, 0x0000000000000, 0x26B2258834B57, 0x2AB764768E636, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x5383713E2A4D1, 0x38476BB40EFEF, 0x0000000000000, 0x0000000000000, 0x0B88538C2B786, 0x2A6A7E3B3C50C, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x786E4B245E965, 0x11F9ED901C893, 0x0000000000000, 0x0000000000000, 0x4519EDF46C793, 0x36F3828F2DD87, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x7C485472EFF8C, 0x57EC749475C21, 0x0000000000000, 0x0000000000000, 0x4FC73D1B73889, 0x5C9F374099BDD, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x6406DF558D41D, 0x19505BDE64F26, 0x0000000000000, 0x0000000000000, 0x4026BDEBE75F7, 0x28642F066BEA2, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x60906E4E3355B, 0x703DF9F4B90C8, 0x0000000000000, 0x0000000000000, 0x080DCBDEA17C9, 0x6198480226F82, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x1C57586D1AA61, 0x370DED8FAF645, 0x0000000000000, 0x0000000000000, 0x4CB17CB152814, 0x54FEFBB9C2B35, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x333CD6E90E660, 0x69887F0D37FC2, 0x0000000000000, 0x0000000000000, 0x2EEADDA6CBBB3, 0x07EC35C558CB6, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x31E526FF6E4E2, 0x1466C13225C2E, 0x0000000000000, 0x0000000000000, 0x19ABBBCD52783, 0x6DF855BEEBB72, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x388C27E62759D, 0x6133E55D4157C, 0x0000000000000, 0x0000000000000, 0x09EF5216AE22D, 0x30B7C454ECD37, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x2FE2468F9FE2E, 0x17E36EF54EF61, 0x0000000000000, 0x0000000000000, 0x512C6AAF618C1, 0x26ED2C0F6902F, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x267855AE70EBD, 0x15357B8DD2C88, 0x0000000000000, 0x0000000000000, 0x72BAA542664DB, 0x720C69598AD5D, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x30CE2A96F7733, 0x7052CF214B404, 0x0000000000000, 0x0000000000000, 0x46997B38F361A, 0x1A580F3DA0018, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x725C8990EC0DF, 0x2E36461ABDAD1, 0x0000000000000, 0x0000000000000, 0x49FFABFF069EF, 0x3D010F2F8DB63, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x4A0EC1DE08E8F, 0x44513200487E8, 0x0000000000000, 0x0000000000000, 0x7F88BD92012A0, 0x53977ED13EF87, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x4961B84585365, 0x6899CDAD0DCEE, 0x0000000000000, 0x0000000000000, 0x7058403738139, 0x70EC31E8816F0, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x17E7231E686E0, 0x15A8A8C14AEA0, 0x0000000000000, 0x0000000000000, 0x07B260C7D8BEB, 0x2A3868C227AF8, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x609C0C9CA28E1, 0x3E64691E00C84, 0x0000000000000, 0x0000000000000, 0x320C6FE62095D, 0x2A231BEE16F16, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x3BE0085746B36, 0x45AA33F77F598, 0x0000000000000, 0x0000000000000, 0x22EDD91BBD29A, 0x39ACEA371DC3C, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x6CEA980F5B31D, 0x6296DF38B6D3B, 0x0000000000000, 0x0000000000000, 0x240263EDCFF68, 0x667CE68916FB6, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x155B098066562, 0x204864A29C839, 0x0000000000000, 0x0000000000000, 0x68DCF097DF69A, 0x46DB6BDF1647F, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x76D6472524D4B, 0x7A14D6B2B38DA, 0x0000000000000, 0x0000000000000, 0x594D4FE0937C7, 0x027ADBDC1BF6C, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x317167F414267, 0x21424CFBB4966, 0x0000000000000, 0x0000000000000, 0x07DE325FAEC2F, 0x24DA669997C1B, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x55D3BED0968C6, 0x0F6EABFCE2516, 0x0000000000000, 0x0000000000000, 0x6E30BF79FDC80, 0x74BF9B1DE3BC9, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x12A869B626B27, 0x719EB4354BD3E, 0x0000000000000, 0x0000000000000, 0x133DA3ABFB4C6, 0x4F6112985AA2F, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x07A86E064D87D, 0x272DBCCE9695D, 0x0000000000000, 0x0000000000000, 0x3D46FD5198766, 0x105F4C8535D58, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x0D8E9460AA4BD, 0x588AD41A56E1E, 0x0000000000000, 0x0000000000000, 0x600F124EA629C, 0x5DB12F23140BF, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x79DE7084E31BB, 0x2FE21401FC152, 0x0000000000000, 0x0000000000000, 0x54C5B16311715, 0x1186C0005805B, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x47B107BAE0AB0, 0x18D4ACEFC7FE8, 0x0000000000000, 0x0000000000000, 0x2A352C24905B0, 0x22695BF617E32, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x359632F632AB7, 0x20CC077144FC4, 0x0000000000000, 0x0000000000000, 0x5CD4714167A57, 0x007A7B209E063, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x61E296B9149E5, 0x628963F0DAACF, 0x0000000000000, 0x0000000000000, 0x5DDCA903A43C7, 0x573D04BEA9EE0, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x32325D04AE450, 0x26BD716D7357C, 0x0000000000000, 0x0000000000000, 0x30BCEC4D65B7C, 0x557AEE8CE8DB9, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x5C5E60B0D41F2, 0x27A568E65183D, 0x0000000000000, 0x0000000000000, 0x0672BD5287165, 0x32C118F8C6FBB, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x6F0CA792DDE20, 0x24D1A83E91573, 0x0000000000000, 0x0000000000000, 0x4309A1643A943, 0x7BD69C7A45C3C, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x6D92518C8B734, 0x14B559459993B, 0x0000000000000, 0x0000000000000, 0x2BE5CA6D3B920, 0x2641C0791AA93, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x7B2EDC69FBAD6, 0x2C5946688B53C, 0x0000000000000, 0x0000000000000, 0x7C35BFB11CF28, 0x33594A919B919, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x1724D4B5E3B0D, 0x06311E4443C2D, 0x0000000000000, 0x0000000000000, 0x655B9A62B4369, 0x708D857CF6B2D, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x7FBEF0CDD5FEF, 0x1EC44323496FB, 0x0000000000000, 0x0000000000000, 0x67051FEF47667, 0x74E70AC9A5D7B, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x721CD7E853BAC, 0x1425C78FF2262, 0x0000000000000, 0x0000000000000, 0x3153D19D5BA69, 0x2536564D85C90, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x58E63C8A33EF7, 0x56217BAD3D24D, 0x0000000000000, 0x0000000000000, 0x0D529CC2AF877, 0x27703D57D45FA, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x718427068502B, 0x140717DE1B7A8, 0x0000000000000, 0x0000000000000, 0x37399D585BC2E, 0x1B01BDBEA1911, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x4A6F78BFD6D37, 0x1CCC3C906372C, 0x0000000000000, 0x0000000000000, 0x50AA3C7A843A5, 0x4D8EE3F7D811D, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x11DA970295965, 0x532B769CD665C, 0x0000000000000, 0x0000000000000, 0x31A53174DCA37, 0x7CA889E4E2794, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x259792828EF29, 0x7EEE5D0EE6DD0, 0x0000000000000, 0x0000000000000, 0x26282492ED607, 0x6644F18DC4060, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x437BB6B5305FF, 0x0DD50251B6388, 0x0000000000000, 0x0000000000000, 0x215580F85C819, 0x68472F970AC39, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x13750E47A4B02, 0x05B153D2E0204, 0x0000000000000, 0x0000000000000, 0x786208C54CA5E, 0x23BAC3564F08A, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x03859D551A647, 0x0EE61767BB55D, 0x0000000000000, 0x0000000000000, 0x2D95CB641070F, 0x25727A80E98B8, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x04FAF35E31B25, 0x0A9E2F1485E2F, 0x0000000000000, 0x0000000000000, 0x5DF8870976C51, 0x122C3557AEB7E, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x120943E5A4AA1, 0x6E969EDC15451, 0x0000000000000, 0x0000000000000, 0x1A985134D16A5, 0x3F819024F4271, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x0D47ECE7B9E42, 0x338A00A270633, 0x0000000000000, 0x0000000000000, 0x03F1D19366139, 0x01D8D175CE4E2, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x647772853AF62, 0x63052C033F4C8, 0x0000000000000, 0x0000000000000, 0x6CB926DCE475B, 0x24C0A721D51CD, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x3FA66CA1E3DDB, 0x7A20CBE56142D, 0x0000000000000, 0x0000000000000, 0x3FB032E2CC723, 0x2BA06492A2739, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x3F8221C842FE7, 0x20C1408E83ED9, 0x0000000000000, 0x0000000000000, 0x6B885AAB6D164, 0x2D0D60D119E55, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x57FC645EDCFE3, 0x0AECEC5A082E1, 0x0000000000000, 0x0000000000000, 0x53B3B2361CFA1, 0x6A7A1CDEC367B, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x5D920EEF73538, 0x133E56CA3043A, 0x0000000000000, 0x0000000000000, 0x13CDCEB6294FD, 0x340DE658CEB4B, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x4B2700A4A6CAC, 0x044D688F2086E, 0x0000000000000, 0x0000000000000, 0x3BB88AF8A0F1B, 0x0DA300D6FC6B3, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x13FBB29EA7390, 0x15950C1868D53, 0x0000000000000, 0x0000000000000, 0x1FE5564E456AD, 0x1D54807C0347D, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x2FB81DB766E0C, 0x502811B0A8AF0, 0x0000000000000, 0x0000000000000, 0x0C1226F6106BA, 0x4B9AFEC0381A8, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x46B2B077A640D, 0x15533790EF634, 0x0000000000000, 0x0000000000000, 0x1B066F7C88A81, 0x359C2C01644A1, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x050B1967EE711, 0x6621F615FF978, 0x0000000000000, 0x0000000000000, 0x1A0539F2685E9, 0x375552ADF1321, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x518969A33DA8C, 0x3B50E0D019E7D, 0x0000000000000, 0x0000000000000, 0x554D1BD59B52E, 0x44ED2433D6680, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x68608CEEF1010, 0x774ED2E39F760, 0x0000000000000, 0x0000000000000, 0x109517F59C332, 0x41A7E2B388569, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x2BD3A3ACD439B, 0x5B5F61C406583, 0x0000000000000, 0x0000000000000, 0x77873B4D5904D, 0x7780AC76531EA, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x5D7EE9E2CF8DF, 0x2BA298F49E7A4, 0x0000000000000, 0x0000000000000, 0x388DD7C8C5105, 0x1C46F5A701C73, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x11C8B89D4513E, 0x081895748BA90, 0x0000000000000, 0x0000000000000, 0x451421D9442C4, 0x2BCEA55C799A5, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x2A3409B20E858, 0x562044A6D158A, 0x0000000000000, 0x0000000000000, 0x5FE9AE7C4D8BC, 0x7CFB1DE613449, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x78E7FF31341F1, 0x20936F3239EE3, 0x0000000000000, 0x0000000000000, 0x4FEA3706700AA, 0x77CD03C71FB6E, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x08B59F13267D9, 0x415201205436F, 0x0000000000000, 0x0000000000000, 0x11727D1FED104, 0x73E5DABC177A1, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x3366480E3418C, 0x50C00210151DD, 0x0000000000000, 0x0000000000000, 0x4ACDA6B586D05, 0x2E50A19CD2409, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x73F19AE005C32, 0x12396E1E917AF, 0x0000000000000, 0x0000000000000, 0x001B619E37F6A, 0x317B1F43177A3, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x791324B220B83, 0x0A853F1A0BA96, 0x0000000000000, 0x0000000000000, 0x16AF7C261DD93, 0x28BF7F12424C0, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x27F9A670208AE, 0x09445FB4A4C78, 0x0000000000000, 0x0000000000000, 0x456187B681C8E, 0x045D6DC386982, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x27CA5CB9DBC2C, 0x2B37734917728, 0x0000000000000, 0x0000000000000, 0x0A2B31FC66775, 0x0B21409EFBB91, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x42D02165DE6E6, 0x7E2CBCF8A3F68, 0x0000000000000, 0x0000000000000, 0x7A7927F898D55, 0x0A965CC48D5D7, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x4FD675C9686A0, 0x17D8E146338B9, 0x0000000000000, 0x0000000000000, 0x3DDF1E8CCD5C6, 0x029B240704E52, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x1347772EA21F3, 0x7E47D3D685DD5, 0x0000000000000, 0x0000000000000, 0x0B3177F11847E, 0x67ED9BFFE3C0A, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x0BBF79207CC1B, 0x0BDAFCD5FCC7E, 0x0000000000000, 0x0000000000000, 0x7D2803869C89F, 0x2FC14428DF788, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x66F575B14BC9B, 0x4787D18B15D90, 0x0000000000000, 0x0000000000000, 0x7C4D18A3A46AF, 0x0AC570E0B5F58, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x5D584D1A966E2, 0x437CFCED1FA1F, 0x0000000000000, 0x0000000000000, 0x7A6E4B9CE3E22, 0x2644DE343EE67, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x7A33BE4BB1BF3, 0x723D08DF7859E, 0x0000000000000, 0x0000000000000, 0x26F7C996A05D5, 0x470D62BE9D239, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x2C9A425227200, 0x54FA5509CF9AB, 0x0000000000000, 0x0000000000000, 0x674C5969275E0, 0x53814F9DC0C7D, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x443186E55FB4E, 0x1E33BB78913CF, 0x0000000000000, 0x0000000000000, 0x69A3BDB999696, 0x184CB14D4D9BD, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x5DEF2536800C2, 0x072273D52D9E0, 0x0000000000000, 0x0000000000000, 0x48F4FD51C8D25, 0x26A288F388E41, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x62B6F6E8E2E61, 0x66410DBD258DF, 0x0000000000000, 0x0000000000000, 0x42D2B1238A363, 0x1CDD4553CB95F, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x0DC5C247DE496, 0x1A1803300EFD1, 0x0000000000000, 0x0000000000000, 0x4611D22FDB665, 0x7CDB0806A35C8, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x2A6CA8F02D793, 0x2092A22FA3A40, 0x0000000000000, 0x0000000000000, 0x4A5823B64981A, 0x59BC674C167E4, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x625A0A1C3D53F, 0x24BE834C0AF0B, 0x0000000000000, 0x0000000000000, 0x5E7E5317CA6A2, 0x7B78FBD897924, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x0D6A41D99711D, 0x40149D3F952A7, 0x0000000000000, 0x0000000000000, 0x7A84F74DC777A, 0x56C454F812B4B, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x4B68B009C5082, 0x13283118A05CE, 0x0000000000000, 0x0000000000000, 0x1FC787DC05026, 0x2596FCB802125, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x13DD01994E1FF, 0x42D8CEAB25B61, 0x0000000000000, 0x0000000000000, 0x6E5CC0CFFAD75, 0x228CB628E1968, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x3270BD7F62542, 0x35DAA01C5B07B, 0x0000000000000, 0x0000000000000, 0x57308CADF3AD5, 0x54A041AA8995F, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x60E2686831FE5, 0x067BC0116F5AB, 0x0000000000000, 0x0000000000000, 0x095FF0733C8AE, 0x4939690AF43FB, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x73577A2478116, 0x7711EB9B7F40C, 0x0000000000000, 0x0000000000000, 0x677F9A70AFA3B, 0x280EAF8789A28, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x52C279CBECBCB, 0x346F70E5C152E, 0x0000000000000, 0x0000000000000, 0x4ABE9843826AE, 0x52B3E10096E78, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x5998E5092E922, 0x15B729B9DA3DF, 0x0000000000000, 0x0000000000000, 0x73874B4F5E503, 0x34E7DEBF979A3, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x1A904DBCEC8F0, 0x1BB0DB88DD43E, 0x0000000000000, 0x0000000000000, 0x0C8EE18F80A2A, 0x132A2BFF18FE4, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x588550E119436, 0x585A1B54F6927, 0x0000000000000, 0x0000000000000, 0x6816F58AA86ED, 0x128EB0271C6AD, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x0CC9D99637BF3, 0x014E2148B34B0, 0x0000000000000, 0x0000000000000, 0x4C7745D9F9E39, 0x3270A4675AA1C, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x1F8EF0699D135, 0x5B1F6D5AA535A, 0x0000000000000, 0x0000000000000, 0x534528B97B28A, 0x2EE18F520AF26, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x54B7CBA5AE6FD, 0x3D2EE58551E5F, 0x0000000000000, 0x0000000000000, 0x79DFD2C97D33F, 0x1256E129995AC, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x79F17B63A08FF, 0x01BC21E1FBD7B, 0x0000000000000, 0x0000000000000, 0x7996298B7299C, 0x28267581D9AAD, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x2DBEDBC94CB5B, 0x265B129B50D31, 0x0000000000000, 0x0000000000000, 0x6ABDDFFDECE33, 0x65FE94FAEFB25, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x2BC643B14B04B, 0x5B689A428DACE, 0x0000000000000, 0x0000000000000, 0x27F39DF5510E9, 0x7E0470A7E06A9, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x2ED4133313EE3, 0x3B6843729232E, 0x0000000000000, 0x0000000000000, 0x3EC7AF615D3A2, 0x3D4D77442616B, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x43A13DF0F2880, 0x4A6139FAE3F58, 0x0000000000000, 0x0000000000000, 0x25466F4D88EA4, 0x19F8A7C6F45DF, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x21781D3345C62, 0x72800111B1D04, 0x0000000000000, 0x0000000000000, 0x33E5035CB58C0, 0x345CE05F3D523, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x1E78E07A61854, 0x108CC35EEA84F, 0x0000000000000, 0x0000000000000, 0x469706FB539FC, 0x2E5F609CA0D1E, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x0E3D88D1DC4A4, 0x305112587562E, 0x0000000000000, 0x0000000000000, 0x6AD16E80C7CF0, 0x2E93D16F5B195, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x42EAC4D69AA75, 0x227A3AB61BECE, 0x0000000000000, 0x0000000000000, 0x7E5D84E3E522D, 0x6225A7FD9302B, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x5F0929F62034C, 0x5679C3064C3A7, 0x0000000000000, 0x0000000000000, 0x6F07299CF24F2, 0x12ECA2538A0D7, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x688F611DB2669, 0x24AEB6B0FE643, 0x0000000000000, 0x0000000000000, 0x259C872705A38, 0x62D3482C7009F, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x46270BBCC38A9, 0x1A9716E87F7AB, 0x0000000000000, 0x0000000000000, 0x6C504F714160A, 0x7193FBE835760, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x01CE74727F22C, 0x0984D610C124B, 0x0000000000000, 0x0000000000000, 0x279C19DC29612, 0x287933AD7EA23, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x731F0A1C8C331, 0x1FEEC1DF1002C, 0x0000000000000, 0x0000000000000, 0x0BE1998F0D265, 0x230846D40A426, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x1C6E7B81A68D6, 0x28E9C0584A29F, 0x0000000000000, 0x0000000000000, 0x404819314EB53, 0x0F420B49B3DFB, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x546537E734A22, 0x57B147CB05BEB, 0x0000000000000, 0x0000000000000, 0x49E2F70A57D35, 0x37600C9BAD998, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x24571158F2A26, 0x317D86FD77CC0, 0x0000000000000, 0x0000000000000, 0x6EEDDB1DBD604, 0x2DFADC0E75765, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x28A1F15DBC30F, 0x4942BCE29D475, 0x0000000000000, 0x0000000000000, 0x7AEA423EDD54C, 0x57468E17E124D, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x4A2DF861D38B3, 0x1A5935CA421EA, 0x0000000000000, 0x0000000000000, 0x106D98C90FAD2, 0x2E6D8C9E38A68, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x30193D9EB48F7, 0x5CAFFC91505AC, 0x0000000000000, 0x0000000000000, 0x183DEC51888FB, 0x0F714E28994B6, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x5B4B93C3F7A0C, 0x7A331B83ECF9E, 0x0000000000000, 0x0000000000000, 0x5B3453446B0F4, 0x7CA7654F15EA4, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x7E882CDA55AE9, 0x66FCE403241C2, 0x0000000000000, 0x0000000000000, 0x18974D9E09B21, 0x07F2B91C7D7C1, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x4952BC94F1F96, 0x404B3A1747C41, 0x0000000000000, 0x0000000000000, 0x1015D0D921026, 0x78FF82E153293, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x089B33476A2FA, 0x64ACD807066B6, 0x0000000000000, 0x0000000000000, 0x746D31F177900, 0x17AAA5186A012, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x0FA9014D9DD0E, 0x1A7772F5C8144, 0x0000000000000, 0x0000000000000, 0x62A4F46AC0C54, 0x21919F0E908F1, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x4AAF0DBABD2FF, 0x48682EFD81F80, 0x0000000000000, 0x0000000000000, 0x2D19A9197F32D, 0x7C61FEEC379F8, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x6D02F4D0494E3, 0x39ABCB96B186C, 0x0000000000000, 0x0000000000000, 0x5D40E46BB69F4, 0x3AF1B11F524BE, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x70CBF752CC503, 0x41504451CB956, 0x0000000000000, 0x0000000000000, 0x0B21C0D493D82, 0x7B54C7D1D4D70, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x5AD3A33788034, 0x037C7F5521BB8, 0x0000000000000, 0x0000000000000, 0x64D2CEC139282, 0x490A042F55F96, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x5C8F228BC58B0, 0x4C9F34F3905A6, 0x0000000000000, 0x0000000000000, 0x64A167A71DA84, 0x7B127B7A80A07, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x610842DF6A59A, 0x0DBFF01B6FDAB, 0x0000000000000, 0x0000000000000, 0x04986A7E83D15, 0x33305079AE3A5, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x71C10B3B3FCEE, 0x19E139D27DF14, 0x0000000000000, 0x0000000000000, 0x77771213236CA, 0x2EE928022886D, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x064FC6BB9C1F3, 0x19A442072DDB6, 0x0000000000000, 0x0000000000000, 0x2A9915BB1A3B9, 0x0093E2288FEE5, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x4D03B217FE5BD, 0x7E268ED073781, 0x0000000000000, 0x0000000000000, 0x7D0DBB0B27332, 0x108A1D04E165E, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x759020B5E3671, 0x5B4151609CF2E, 0x0000000000000, 0x0000000000000, 0x63337EC6BE904, 0x0E6BFDFB3CB1B, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x52565F6374863, 0x591BC157A7F2C, 0x0000000000000, 0x0000000000000, 0x48780B86966D1, 0x29D67A7A8E9DB, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x62B57CEF6D717, 0x1B097FED01F65, 0x0000000000000, 0x0000000000000, 0x3F7F374D52ED7, 0x307136D2B40BD, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x40FC499B95B66, 0x50F8FCA39AABB, 0x0000000000000, 0x0000000000000, 0x397A5D04FB28A, 0x792C75C69074D, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x041A5ACAFA1CF, 0x77856AD47E903, 0x0000000000000, 0x0000000000000, 0x2AE1DD37F1EC9, 0x068A2DD573EA6, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x637FA3F687491, 0x2A07C00762914, 0x0000000000000, 0x0000000000000, 0x174305857338B, 0x55FE1CDC8F226, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x4D6224635D22B, 0x7E08482CBBD21, 0x0000000000000, 0x0000000000000, 0x2C5592882F9E2, 0x5B7360D0B0B3F, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x166DBC302DE6E, 0x01AAE8F294954, 0x0000000000000, 0x0000000000000, 0x06B793E8B8ADB, 0x057FE0227F848, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x6485FCD61F4E6, 0x18E385700FED4, 0x0000000000000, 0x0000000000000, 0x0B455BBE5B52A, 0x2F23EC63345A0, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x3D9369787DCB1, 0x5C39FDC34709C, 0x0000000000000, 0x0000000000000, 0x5285762907C83, 0x0D367565D471A, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x7B20CC93BEDEC, 0x4A4E691FBE918, 0x0000000000000, 0x0000000000000, 0x2CD79219C8110, 0x2530A262A1ADA, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x436F6A952B7DB, 0x4E4A862748667, 0x0000000000000, 0x0000000000000, 0x1754540988FA5, 0x50013E65EBEF2, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x059A0D4FF1B36, 0x00AD9BA9FDA2A, 0x0000000000000, 0x0000000000000, 0x24F7EC205D98F, 0x0BEBDFC38B057, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x39CD1CEC6B758, 0x3AFF153B5B14A, 0x0000000000000, 0x0000000000000, 0x3D8DA8AB377DE, 0x7675121C32560, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x239AA03A53B31, 0x0D1FDE628A2A8, 0x0000000000000, 0x0000000000000, 0x1555AEF6F8A71, 0x1CBED74820C71, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x62F32BF9023A2, 0x4A2032CA1260A, 0x0000000000000, 0x0000000000000, 0x4CC47653F9FBA, 0x5AE42E0E308DA, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x17BD4A28FA1DE, 0x2C51A80DD8031, 0x0000000000000, 0x0000000000000, 0x213AC44C537C8, 0x28DA11C5CEA42, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x39D1D9DB8AC98, 0x191BEFB8B8F45, 0x0000000000000, 0x0000000000000, 0x299A5D39AA5C7, 0x0F1C2D8CB6320, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x0B1B4A51783C2, 0x367D8DBC4BD58, 0x0000000000000, 0x0000000000000, 0x4505EC2F0D327, 0x53C047702E5F4, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x170062A906C2A, 0x4855D542F0C2A, 0x0000000000000, 0x0000000000000, 0x43809E928F422, 0x6EA9CA7CA6B54, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x3D7D5777A945B, 0x0B766B9A1C103, 0x0000000000000, 0x0000000000000, 0x5BF322CDD57F0, 0x2D91317B5442B, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x2CCE843DA2D10, 0x32D629DD5D8F6, 0x0000000000000, 0x0000000000000, 0x63ED49388D63E, 0x33D8F8C39F122, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x66E3395FC5D0C, 0x6AA9E56948CB1, 0x0000000000000, 0x0000000000000, 0x15A05BBA2D15F, 0x495B92B5500EA, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x0DC36B42CFB47, 0x7F7EA6E05CDF5, 0x0000000000000, 0x0000000000000, 0x63605E00BEDF1, 0x68997BEDC999F, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x2BE73614D776F, 0x0AEE10BAA7A10, 0x0000000000000, 0x0000000000000, 0x63902D046613E, 0x79EF9B56EF550, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x61EAB573FF25B, 0x127A3DB8128C4, 0x0000000000000, 0x0000000000000, 0x37245D07B6F4B, 0x451F4D6FE59B3, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x7C3A66779B051, 0x18295DC46F305, 0x0000000000000, 0x0000000000000, 0x191FF4743670E, 0x1A15902433608, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x12EE73327FFBF, 0x7CE151BECF878, 0x0000000000000, 0x0000000000000, 0x670DFDBEE36D1, 0x58D6EF70EA79A, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x4A85B3F1A28AA, 0x59A615E375938, 0x0000000000000, 0x0000000000000, 0x53D20EB7F3C3B, 0x3B6D593C75326, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x7C81A276BB6AF, 0x471E73F62DC44, 0x0000000000000, 0x0000000000000, 0x4A26D15CD06A7, 0x15ECF89F412F9, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x58C700FBCCB33, 0x3F5A782E32C45, 0x0000000000000, 0x0000000000000, 0x136FDBCAFE2D2, 0x18F60D8044E13, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x3159FD4EB5762, 0x638F6862A16B8, 0x0000000000000, 0x0000000000000, 0x3BE2233CBFC83, 0x56BC805644EA1, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x1EF9AACCC9C89, 0x17734418141E0, 0x0000000000000, 0x0000000000000, 0x46B634BF4F8A2, 0x2D08D7F3DD15A, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x3F2B1E66CA26E, 0x111D9E276C82A, 0x0000000000000, 0x0000000000000, 0x121BB18F7A6E6, 0x059DF56FDCEBA, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x4CBF810EBF4FF, 0x0500B89AA69CB, 0x0000000000000, 0x0000000000000, 0x4DD2BB6639512, 0x2D88D414D81ED, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x3731CD7113A0C, 0x78FF48B9820C4, 0x0000000000000, 0x0000000000000, 0x5278A5FCCDEF0, 0x0B3D8087090E6, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x176D67C5D1B2F, 0x244FC70AD9CD2, 0x0000000000000, 0x0000000000000, 0x263F7885E9839, 0x605BDC44A672E, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x344D7846DBB09, 0x1DAA4E9FB4CDE, 0x0000000000000, 0x0000000000000, 0x3CAECEC4AA145, 0x6B0A052994D90, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x4EF930E542E33, 0x11E4E7EE92D17, 0x0000000000000, 0x0000000000000, 0x77DCF0205E6B1, 0x33A0AFE59C8BE, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x24E2072F493CE, 0x30AB6E310BD73, 0x0000000000000, 0x0000000000000, 0x1CB3B653D9FF6, 0x3C08E021FECB8, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x25FDCF6B3DADB, 0x04F3078F53BA1, 0x0000000000000, 0x0000000000000, 0x5810F69407324, 0x6574E434DF67A, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x0EAE6AA08C097, 0x0D3950FB0C8CD, 0x0000000000000, 0x0000000000000, 0x5E46A29F2EA63, 0x5641258512F24, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x6759341D9205B, 0x4793C0CB1351E, 0x0000000000000, 0x0000000000000, 0x63446BB50E311, 0x6C1C70D2C3272, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x4BF7DC87FD88A, 0x7F445459B9E05, 0x0000000000000, 0x0000000000000, 0x71ED7E79A9339, 0x1259C622BC500, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x6D740635A3530, 0x0DF6F53F17E9C, 0x0000000000000, 0x0000000000000, 0x00502E5ECE4B7, 0x2E21FA8393371, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x3AFD0AA0FD5A6, 0x467695B9424CA, 0x0000000000000, 0x0000000000000, 0x1BD8D63BEADBC, 0x0A73585459BBF, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x3CE73270FA8A7, 0x4F5E788FA6820, 0x0000000000000, 0x0000000000000, 0x6097F7C747D10, 0x2E89201FC4E43, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x6C03FF4D8F526, 0x616C25B765008, 0x0000000000000, 0x0000000000000, 0x15ED9480A6480, 0x0D962184C30CC, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x099B2BA821981, 0x22A49C5F2C421, 0x0000000000000, 0x0000000000000, 0x7E20E3C6A98DA, 0x0488D7B0D923C, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x277802CDAB6A2, 0x692C555712162, 0x0000000000000, 0x0000000000000, 0x4BEF99A1345AD, 0x2E905E1CD8C45, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x6385A73859C7D, 0x11BE41BAA8448, 0x0000000000000, 0x0000000000000, 0x5D561AD8B2151, 0x336EB95BF9D0D, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x6A5EFF5EA63EF, 0x571B35EC79168, 0x0000000000000, 0x0000000000000, 0x351F39AF04441, 0x3FD534A081C93, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x3EBFE14317DD3, 0x4E8A87866647F, 0x0000000000000, 0x0000000000000, 0x1770FEA28342A, 0x58B4DF37659CC, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x75D92E76C98DC, 0x78ED6DF14829B, 0x0000000000000, 0x0000000000000, 0x2CC2D9C16C259, 0x1667E632788CB, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x147C187AC7695, 0x3D5095E365050, 0x0000000000000, 0x0000000000000, 0x441C735D20191, 0x7A8F915A855D1, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x25AC607F37ECC, 0x50919B2CD09EB, 0x0000000000000, 0x0000000000000, 0x7320C0DB67C42, 0x10DA33EDE78AE, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x30DC36F779BAE, 0x14A8E62E2BF2E, 0x0000000000000, 0x0000000000000, 0x35A15B352C1D2, 0x2DBCF8AB4171A, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x637684DD4F624, 0x01723167451C1, 0x0000000000000, 0x0000000000000, 0x12A68D02681B6, 0x645D77F18563F, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x5C75FF965192B, 0x075D3909942CD, 0x0000000000000, 0x0000000000000, 0x2ECA826FDF910, 0x7C4CA7DF9E223, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x052923AC66561, 0x4372466B53FFB, 0x0000000000000, 0x0000000000000, 0x78567743B8294, 0x19A88F5D47DA8, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x29F667F9A5E8E, 0x657F93587D967, 0x0000000000000, 0x0000000000000, 0x00391B646CBEC, 0x62D44CDB74AC6, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x56A4C3878AD83, 0x03F500634FB3D, 0x0000000000000, 0x0000000000000, 0x5DF73978F7866, 0x658DFC91D415D, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x19DDFFA39AEDD, 0x0F868AC613F5B, 0x0000000000000, 0x0000000000000, 0x0C7B1831A67E2, 0x33A105BEE09E0, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x6BD080FB47FC2, 0x34A7483E39B41, 0x0000000000000, 0x0000000000000, 0x78BFB6C65DE72, 0x667BF7EA891DC, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x46C1476AEECAF, 0x45AD1A5D00ECB, 0x0000000000000, 0x0000000000000, 0x2E919CD633C87, 0x616998DE781C9, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x6C13A4486990F, 0x495B06E0E35F9, 0x0000000000000, 0x0000000000000, 0x402A6904F6A7D, 0x005574EAFD9EE, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x4A2C319A0904C, 0x493A36B689A60, 0x0000000000000, 0x0000000000000, 0x5C792E5D74B1F, 0x6446379D9A031, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x7CD5E28D76953, 0x3A86B6911C823, 0x0000000000000, 0x0000000000000, 0x57101B655D614, 0x72E965715BB36, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x5413522B4889F, 0x12CCB285D114A, 0x0000000000000, 0x0000000000000, 0x3429D493364C1, 0x1FEA565A60BA2, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x180D679A78A59, 0x607CF209934B2, 0x0000000000000, 0x0000000000000, 0x25C1E973D2C57, 0x5BD25EF190339, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x4A253107EB36E, 0x296E775243262, 0x0000000000000, 0x0000000000000, 0x0A55BE2CECBA3, 0x1ED354FBD66CC, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x5D6F6A1947E2A, 0x53F27D9218F96, 0x0000000000000, 0x0000000000000, 0x0736A7D0B6303, 0x7C2F42F3A2DBF, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x1349ED2F050AF, 0x161099E0E2B85, 0x0000000000000, 0x0000000000000, 0x4EA0FD34BCC0A, 0x6442AD05D9D71, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x5C24975BCD602, 0x78142098E3F6F, 0x0000000000000, 0x0000000000000, 0x37A30AFDE3EF5, 0x09D6CDE391061, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x300676F20EBC0, 0x0FC0698B8B009, 0x0000000000000, 0x0000000000000, 0x7D4894EC540D4, 0x1EB1D40CD1EDE, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x150587CC7C7AA, 0x796285DA9D337, 0x0000000000000, 0x0000000000000, 0x1B0FBF6A52F90, 0x19236A05FA2AD, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x606017EBB28C0, 0x2A32744B59F94, 0x0000000000000, 0x0000000000000, 0x1F0BCE6CE3F62, 0x02F192A28E6E7, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x52E872B855166, 0x3E5150EB74886, 0x0000000000000, 0x0000000000000, 0x0F88455E553C5, 0x79046041137D5, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x5C7CD4718C16F, 0x4E70132394F75, 0x0000000000000, 0x0000000000000, 0x666E9D50BEB19, 0x2FEC7740A2AB9, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x2C3F9685625DE, 0x3C970CBA8BF94, 0x0000000000000, 0x0000000000000, 0x33C4E96315EF9, 0x63C5B30E6B2F5, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x0FFFE4C5B8A4D, 0x14CA4CF793269, 0x0000000000000, 0x0000000000000, 0x6C605F87FA4A4, 0x2546AD3F6B53B, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x11D94E3EB9C06, 0x13DB18598BAA7, 0x0000000000000, 0x0000000000000, 0x3DF92D9C01260, 0x5E1F830280B63, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x74A2D40332205, 0x4592E50CD263F, 0x0000000000000, 0x0000000000000, 0x5C86116A8814F, 0x1019708BE0BB3, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x335FDB03D6DB5, 0x4225DB1B3E9A7, 0x0000000000000, 0x0000000000000, 0x73DA4CDB9EAFC, 0x41E3104282CD1, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x4EF6AF81B7416, 0x331EECEC89FE0, 0x0000000000000, 0x0000000000000, 0x7B9B1BA9088C2, 0x3FDD4B53DAA1A, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x526227F7C36BE, 0x79FC2E6CBF9BF, 0x0000000000000, 0x0000000000000, 0x42B72565A26D5, 0x31AD3B5CC7876, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x023B62EDCA8DE, 0x1580C5E948F9B, 0x0000000000000, 0x0000000000000, 0x10F2FD79502BC, 0x2E81B54F8B97F, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x651AA866C6764, 0x5E29C1D19AA7A, 0x0000000000000, 0x0000000000000, 0x45A6346F5A064, 0x306B71B0D26D8, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x41B85625E3C38, 0x0F1A50D80F38B, 0x0000000000000, 0x0000000000000, 0x1E9D605015B01, 0x0BEFEC4CEA8DC, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x4C11691453618, 0x4CB7338239519, 0x0000000000000, 0x0000000000000, 0x1D7C7BAC8A54A, 0x0C36CD84023EC, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x186635AF43C7A, 0x699B766B79409, 0x0000000000000, 0x0000000000000, 0x7B4D5BA7D7806, 0x611F97662085A, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x01965B4B06B2C, 0x564979B817362, 0x0000000000000, 0x0000000000000, 0x30E75FAD78600, 0x33134C0CC7393, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x25D0CA497D797, 0x2383D85E7E684, 0x0000000000000, 0x0000000000000, 0x5E136C5F7F72D, 0x2A0ED34C6D9C5, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x2969D92728084, 0x7569B5558EB77, 0x0000000000000, 0x0000000000000, 0x39AC25BF102A4, 0x6CC0EEE84C313, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x27427B24E77C2, 0x0372E56757D23, 0x0000000000000, 0x0000000000000, 0x4B53BD6A21823, 0x615C3C87CAEEE, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x2E6B0AE096473, 0x1B3157406A702, 0x0000000000000, 0x0000000000000, 0x026C26B8F8DAE, 0x783EAAFE5D0E7, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x6EE23775717EB, 0x47152064FA495, 0x0000000000000, 0x0000000000000, 0x337343D3B48E4, 0x0CD26318F9247, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x4C4D37E3ED23F, 0x44C3DE0B46C45, 0x0000000000000, 0x0000000000000, 0x590A39870DF9A, 0x7E63D52D691F0, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x57B91F33CAF17, 0x0CA55E75DF5D8, 0x0000000000000, 0x0000000000000, 0x53DB3FB9552B1, 0x2277F70E8975C, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x451B574D4D526, 0x1EE828E9615DF, 0x0000000000000, 0x0000000000000, 0x51B4D6D15A924, 0x27789B4FA729A, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x056281B56B8F7, 0x41E4E99430760, 0x0000000000000, 0x0000000000000, 0x382DD94222BF7, 0x7FF51E5DC6DAF, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x425EF3F46446E, 0x777E26592F0F4, 0x0000000000000, 0x0000000000000, 0x4FB19379D2637, 0x2E25B3ABBF604, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x66E43B5CC0472, 0x1BF6FBC128A68, 0x0000000000000, 0x0000000000000, 0x3FB796D3EDD1C, 0x1F2307E57C2DB, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x3C44A3B553600, 0x36D2A72A61757, 0x0000000000000, 0x0000000000000, 0x21CB68DDF6DA2, 0x38DA003117D22, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x21E2543B69601, 0x140371DD96C88, 0x0000000000000, 0x0000000000000, 0x212521F8E4329, 0x1F7C6C27BE5A6, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x70E16B8FD6346, 0x574CEC01D17B0, 0x0000000000000, 0x0000000000000, 0x2779C90999444, 0x7D921C0864E1E, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x502A1DD2DD0F1, 0x6C0866AB3CF9B, 0x0000000000000, 0x0000000000000, 0x6224600830539, 0x6C00319AEA8A2, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x06EA6F12E2DAD, 0x0B9DB216E416C, 0x0000000000000, 0x0000000000000, 0x166067FF2F436, 0x305EC19BDC477, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x24403FC1E4DD9, 0x7457710A13540, 0x0000000000000, 0x0000000000000, 0x7ABD219800171, 0x51C64BA7CA546, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x48791CE379789, 0x07ADF9272055A, 0x0000000000000, 0x0000000000000, 0x044900E4EC593, 0x2E6D0506F5B3F, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x3E45B23CEF666, 0x20A894DCB6458, 0x0000000000000, 0x0000000000000, 0x4FA4795192E5C, 0x2868E16C1EA7F, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x5C09160642CC6, 0x03EB84C40F487, 0x0000000000000, 0x0000000000000, 0x15E4E5A1ADEA0, 0x30604D8109692, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x104DBBB3A4765, 0x32CDC010D5674, 0x0000000000000, 0x0000000000000, 0x08A990B6BE13E, 0x6CCDA233360D6, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x5F206979662F9, 0x3E4C264B6556B, 0x0000000000000, 0x0000000000000, 0x4A7BCC34D48F6, 0x19AC437282DE4, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x6987FCD7B4C6D, 0x6B5DB254E7074, 0x0000000000000, 0x0000000000000, 0x64BF43FC39C41, 0x10852E9F2E622, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x628D7DF441D06, 0x6E10497FF6DFD, 0x0000000000000, 0x0000000000000, 0x04940EAD76373, 0x14EE1CDC94698, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x4E05C5D7F3743, 0x0A40E8D3E18BD, 0x0000000000000, 0x0000000000000, 0x2A340B8D17230, 0x21B79CD898A64, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x6B52CF45F5D48, 0x59624CFD5D58B, 0x0000000000000, 0x0000000000000, 0x1AB5BD68D1732, 0x1CC7D9BB2D3F0, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x719FEC22C5D41, 0x0D28FD1FC1D11, 0x0000000000000, 0x0000000000000, 0x400069F87F517, 0x05E1DC9F74857, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x49F9F19412234, 0x6072D289FF49E, 0x0000000000000, 0x0000000000000, 0x203FE19489DED, 0x1AB43BF7E81C2, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x2E9A016C9AB88, 0x6FB5955BDD629, 0x0000000000000, 0x0000000000000, 0x71584157F61BC, 0x476A1F4767D59, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x0BD19C90E3A33, 0x6F4A1E4428785, 0x0000000000000, 0x0000000000000, 0x47BC4FA5DE227, 0x4BAD38D7F516E, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x30162AC088060, 0x15376A7D974FD, 0x0000000000000, 0x0000000000000, 0x0F66205721C4C, 0x2D9066DF947A7, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x40127CFB3A12F, 0x42F75C1A4822C, 0x0000000000000, 0x0000000000000, 0x6837821B660EB, 0x1614AC1D2A72E, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x7FC2D11BFB906, 0x1D53D32BAB3BE, 0x0000000000000, 0x0000000000000, 0x071BDDD744D2E, 0x4A520C8AC2C9C, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x235E0ECED3155, 0x0FD3CD78F9D95, 0x0000000000000, 0x0000000000000, 0x3ECACB67EB986, 0x0228DAB4F4B4F, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x6C94309B5A89E, 0x63A6DB401E4D3, 0x0000000000000, 0x0000000000000, 0x52D5217EC7E3A, 0x50D5C0FF1BA13, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x430B1F2A26248, 0x66165C8742114, 0x0000000000000, 0x0000000000000, 0x5AEACD6DCEC1A, 0x34C942B07001E, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x3079DF47257AF, 0x16F886DB3A5E3, 0x0000000000000, 0x0000000000000, 0x1FA5F93F84B15, 0x22C53C489C29F, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x44E054A32195C, 0x06AE43022455C, 0x0000000000000, 0x0000000000000, 0x214503F935858, 0x131E98CE5EAFD, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x1108F7C4C3DB9, 0x174FD37DC6B14, 0x0000000000000, 0x0000000000000, 0x2B72DB31B40FA, 0x7DEC5E23CEA2B, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x7E393DCEB295B, 0x1BEDFE5FB3FE0, 0x0000000000000, 0x0000000000000, 0x37C8C513B6E0B, 0x710C8D86A8783, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x32E207C8CFCBE, 0x6CA3B6459A4CF, 0x0000000000000, 0x0000000000000, 0x3C886083CD01C, 0x2B5F9DA748BF3, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x21EB295567A56, 0x15CC6553DC816, 0x0000000000000, 0x0000000000000, 0x178EE12F191F3, 0x00E8FDF6F2ABD, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x448DB4C7B34D6, 0x0F091907CBABD, 0x0000000000000, 0x0000000000000, 0x61FEA1258E849, 0x33AAFE270C8B2, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x16AC653CCC7FE, 0x3C8BD6F4E8930, 0x0000000000000, 0x0000000000000, 0x58957BFB04AF8, 0x0B33AACFC3EDD, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x07F569D537835, 0x4C2497571E892, 0x0000000000000, 0x0000000000000, 0x078AA58E7CD28, 0x156CFAE84A174, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x75DFA8616EA85, 0x78B69CCBB5C04, 0x0000000000000, 0x0000000000000, 0x6861075F770BB, 0x5CE97DEFB2020, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x1C2C6BA1E13A6, 0x46BCBE6F3D390, 0x0000000000000, 0x0000000000000, 0x0CBE67A1EACB1, 0x108EB05D12694, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x0AD0ABCE4FE78, 0x3CF25B2AE9CD5, 0x0000000000000, 0x0000000000000, 0x423D1438CADBD, 0x08DC06AEAE071, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x24FFD3E2055C1, 0x1C6F2BBB662B8, 0x0000000000000, 0x0000000000000, 0x74E7544D72B7A, 0x2EBF35AF432C8, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x0490E66803AB1, 0x5AAA786E30CA9, 0x0000000000000, 0x0000000000000, 0x7FB3AD5C15657, 0x2C75483ED16FE, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x2B848C31A12B2, 0x3D6A2086E2916, 0x0000000000000, 0x0000000000000, 0x7666B4F5A58E8, 0x4655DE30B0F23, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x44A51E1FE1485, 0x2D3225F889F7A, 0x0000000000000, 0x0000000000000, 0x41502D74E23D5, 0x485A6648DDEA5, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x67512FA6BACCB, 0x011508BA31597, 0x0000000000000, 0x0000000000000, 0x4FE734894E946, 0x4C6DE7E43A69E, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x454369B90E063, 0x1C27A0146B551, 0x0000000000000, 0x0000000000000, 0x3A3B67233AA37, 0x091A1FF10CD9E, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x6AB7F887FB902, 0x1020BEA163FF6, 0x0000000000000, 0x0000000000000, 0x1E3BDBD491503, 0x3792CAA69653E, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x1FBCF085817EF, 0x6052E6B50A78C, 0x0000000000000, 0x0000000000000, 0x7C53F74F37E1F, 0x2F4742314D531, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x32AE99A569201, 0x5A0F1E01D1381, 0x0000000000000, 0x0000000000000, 0x365FDC665AA75, 0x71147C46CFB20, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x4147CB40B8F55, 0x2AA7E199EDC45, 0x0000000000000, 0x0000000000000, 0x24A3CE10AF91B, 0x3F81775E021D2, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x46737731CA7ED, 0x3F1C0C7DCF46F, 0x0000000000000, 0x0000000000000, 0x6D270F98290C2, 0x52459EC203BA8, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x2EE88870F204F, 0x7177661BA5F13, 0x0000000000000, 0x0000000000000, 0x63890BED6B50C, 0x25D3BE22C4DAB, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x419DDF9F1C88F, 0x13ABC9040CF62, 0x0000000000000, 0x0000000000000, 0x70AD0D187C4F1, 0x33EB1D2768647, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x2344454086A47, 0x57305D27DC839, 0x0000000000000, 0x0000000000000, 0x7DA8159A014D7, 0x31A8BD75B92F0, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x7C63DFD3F6030, 0x75E908144D633, 0x0000000000000, 0x0000000000000, 0x072CFBD5CA650, 0x6C88860AA04AB, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x764B8731B6550, 0x1377A8E82AC49, 0x0000000000000, 0x0000000000000, 0x627ADFE34C128, 0x779E2B423B043, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x74C0BFC809ACF, 0x2EC752A61B592, 0x0000000000000, 0x0000000000000, 0x68BBF375525B9, 0x203C504359833, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x50E15D357F844, 0x2B68898AB7494, 0x0000000000000, 0x0000000000000, 0x67FD20C3ECB1A, 0x277937F0BCF98, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x780EE83FE11D1, 0x1D8D0031E36A4, 0x0000000000000, 0x0000000000000, 0x27B2FF8AFBE49, 0x25B5815564288, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x29D3B8640ECAD, 0x6EF48513387D9, 0x0000000000000, 0x0000000000000, 0x4C151BA6CD0E7, 0x0139D715E8890, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x6F188FEA0FD5A, 0x63378F343DD0C, 0x0000000000000, 0x0000000000000, 0x2740FB9808504, 0x1724C0EB3B4FC, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x205B48873DFA8, 0x6948786D8E2BD, 0x0000000000000, 0x0000000000000, 0x594264F63F0FA, 0x40DE4F0C27C9F, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x26D37A3869528, 0x71BE57E2FE1C6, 0x0000000000000, 0x0000000000000, 0x6D2295BE099FA, 0x710AD8F026BA3, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x71259F4A7C1D9, 0x2B4D8698E5E6C, 0x0000000000000, 0x0000000000000, 0x41622C7F4182D, 0x1E5A11B4FA167, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x166BAB47A3BE6, 0x127DE55BCBB6F, 0x0000000000000, 0x0000000000000, 0x438878145D140, 0x2A66285A2648F, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x689BD5CABA1FA, 0x43DF96E061B25, 0x0000000000000, 0x0000000000000, 0x5B9E43EB814A4, 0x178BAE7CE30EE, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x491DE9532AA93, 0x1E555860B472A, 0x0000000000000, 0x0000000000000, 0x20BA5EBEC29B6, 0x694A8582CFDDB, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x6AA3563870110, 0x09C62C97D9EC5, 0x0000000000000, 0x0000000000000, 0x2BF8DF9FF00E8, 0x38D7B85A4C2C3, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x53BFAEBD53379, 0x3C8D675FC4292, 0x0000000000000, 0x0000000000000, 0x24BABC4B6BC45, 0x3BBE73EB5BC82, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x27EADF050FE8C, 0x4743F74FF1E8A, 0x0000000000000, 0x0000000000000, 0x044549E7AE894, 0x71E126779F0D2, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x434AF1AA8A791, 0x1B7AD960A37DB, 0x0000000000000, 0x0000000000000, 0x2AD009B8988F2, 0x245C5C171D880, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x3EDF179355E12, 0x5E61E03711A8C, 0x0000000000000, 0x0000000000000, 0x24E758FB42CEA, 0x1A07BB81B2735, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x1C15F9C5F5EF5, 0x2875C45DF95E6, 0x0000000000000, 0x0000000000000, 0x727D468E947B4, 0x5CCFB070C5F83, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x291CC514D16CD, 0x4BEC0926447BF, 0x0000000000000, 0x0000000000000, 0x0B6C177B18D83, 0x4FA6009E8E1E8, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x6F33F749E3A5C, 0x1974453B6AC68, 0x0000000000000, 0x0000000000000, 0x633B1DC82F705, 0x010C747DD1B03, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x4ACD58B0DC7AF, 0x737DAC57B8F99, 0x0000000000000, 0x0000000000000, 0x5C424D534F80B, 0x4B5001E8F046D, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x543EA1E88056A, 0x0404F9B933BF1, 0x0000000000000, 0x0000000000000, 0x0FD8E9DDDE71B, 0x2881520564897, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x23A1FA6EDE097, 0x2664851379859, 0x0000000000000, 0x0000000000000, 0x67647421737BD, 0x00F313D48BE54, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x090224AB8727C, 0x40A72E8C87DC2, 0x0000000000000, 0x0000000000000, 0x47584C68C6C26, 0x38ED0E08DCC52, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x0C668BFB68082, 0x46FFE83E50DA1, 0x0000000000000, 0x0000000000000, 0x12660010D71C1, 0x4B1C2C804DE1F, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x0C2D6D7C94AED, 0x5597BD81EF003, 0x0000000000000, 0x0000000000000, 0x203A97BAA25FC, 0x063504705B38F, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x77EC763795764, 0x6850F4C4E8C2D, 0x0000000000000, 0x0000000000000, 0x7664A3C46AD37, 0x236BEC1014833, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x79E6BC3BDAE1D, 0x163D3C571A276, 0x0000000000000, 0x0000000000000, 0x2E6E0A47793AD, 0x21365609AF90A, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x1F90FC46BD826, 0x1EBD33B9279B8, 0x0000000000000, 0x0000000000000, 0x08E15D89341A6, 0x602D0152C773F, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x6FCB2B0C024DF, 0x08781864B2278, 0x0000000000000, 0x0000000000000, 0x413F445D492ED, 0x475143368D9A6, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x6308E25611633, 0x3CC6714C07581, 0x0000000000000, 0x0000000000000, 0x151B5E8BAA507, 0x14E38BB3DF6B7, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x2224952B8CFC7, 0x18057B587A58A, 0x0000000000000, 0x0000000000000, 0x0F1F39216FA8F, 0x6E690DDBF40AE, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x2FEB669D89713, 0x381EC988A5CA2, 0x0000000000000, 0x0000000000000, 0x2754A369762A7, 0x596A7F69AEE86, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x334EFA5F3E664, 0x0C74AF04E98D4, 0x0000000000000, 0x0000000000000, 0x4073BFB8E45A4, 0x23BEAA27BF241, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x454BE84310EAB, 0x663F398B924DB, 0x0000000000000, 0x0000000000000, 0x12A31E180A2A3, 0x0FCF102D613A4, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x2E1A23EAEA32B, 0x31F3939FDB619, 0x0000000000000, 0x0000000000000, 0x5C4EAB0572A1A, 0x43C0D6BDFDCEC, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x029E4AE7B0FB4, 0x5F45A050FA094, 0x0000000000000, 0x0000000000000, 0x1B18AF4E398F7, 0x5FC4067569F2B, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x1FC5C2A825544, 0x3D1033E1D3ABC, 0x0000000000000, 0x0000000000000, 0x7703FECB8763E, 0x656FA4AECEC0A, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x783E48FA3FC55, 0x57765F31858CF, 0x0000000000000, 0x0000000000000, 0x6DADD2FE2978F, 0x7AC891A24EEC6, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x6F2B8D756ABB3, 0x15A4AB69C2470, 0x0000000000000, 0x0000000000000, 0x4CE397112535D, 0x1FC481773121F, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x378913DF8358A, 0x6C7B1182FAC0E, 0x0000000000000, 0x0000000000000, 0x59E804636B6B2, 0x4A51695C373C9, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x6AAFB68EE8C24, 0x670403E835153, 0x0000000000000, 0x0000000000000, 0x3E50CB93C050E, 0x78F8C9602B25D, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x738A5F7A36EC4, 0x3924CE1891FB1, 0x0000000000000, 0x0000000000000, 0x0A573C3ECDC24, 0x20843A5BBF8AC, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x2565B0249B782, 0x789BF690DE9FA, 0x0000000000000, 0x0000000000000, 0x5CCBD722F7D74, 0x77A5EB068F265, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x60C1D84FBE736, 0x79545B1A5487C, 0x0000000000000, 0x0000000000000, 0x0FA96C7222E86, 0x3A4A465A4B515, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x0F4DEE89416B4, 0x121F81DF02981, 0x0000000000000, 0x0000000000000, 0x0F83D022329C5, 0x17BDC500AF1E6, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x08B7FD08A43BE, 0x3D78B0C855623, 0x0000000000000, 0x0000000000000, 0x366E7C2C9D8A6, 0x4365C7D4FE29D, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x060987AD7E1D2, 0x5EBC13B7829E7, 0x0000000000000, 0x0000000000000, 0x64D92C2C5ACBC, 0x26306F398A1B4, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x25AC7EC2B4631, 0x05BB41A519884, 0x0000000000000, 0x0000000000000, 0x11CC392570661, 0x2A456BF1EBB61, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x76FFBBAAE40F1, 0x618135DD46F0D, 0x0000000000000, 0x0000000000000, 0x22C9EBFDA0F2C, 0x35D569E307C2F, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x1DA49931367DE, 0x224C9CBB1FCA9, 0x0000000000000, 0x0000000000000, 0x105B0E7FF6C13, 0x287FA8BE8CBF2, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x05C8D4689856A, 0x14429BA81D7AF, 0x0000000000000, 0x0000000000000, 0x475B32EB94331, 0x1F793D0F108C7, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x13B419D456B8F, 0x77126970617BC, 0x0000000000000, 0x0000000000000, 0x4DD92B72408B9, 0x7F0873081F4E6, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x38849736AE45C, 0x47A16A4BF3429, 0x0000000000000, 0x0000000000000, 0x1B6602D102D83, 0x24437EFBD7169, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x3A74148F0A42B, 0x1A981C08572CE, 0x0000000000000, 0x0000000000000, 0x30E8058E05CDA, 0x13FE8BF86A36C, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x0F3782EBECE3F, 0x5776E8FF640BF, 0x0000000000000, 0x0000000000000, 0x0E8688A0E5E71, 0x3416E4F6E66FB, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x049EF33015DEE, 0x71A623C4152FC, 0x0000000000000, 0x0000000000000, 0x733157AE9EFCB, 0x50E4C29531552, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x07A48531C0C32, 0x17082D0720533, 0x0000000000000, 0x0000000000000, 0x03C0B24E8E02E, 0x1A498CAC5C8BB, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x7FB7A66005D7B, 0x01484EEC4807F, 0x0000000000000, 0x0000000000000, 0x6162D066036A1, 0x29B3D3A47B439, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x26E1E697AEFC7, 0x15004F8FB40DA, 0x0000000000000, 0x0000000000000, 0x311BAC00913EF, 0x2266F22EB2B87, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x41A5B1ACC57EA, 0x219C5F4B17B3F, 0x0000000000000, 0x0000000000000, 0x518EFB745FBC9, 0x5B25A0C16CE78, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x22157B4C55487, 0x101E614BCF02C, 0x0000000000000, 0x0000000000000, 0x23CAADB432FC0, 0x3B9C26409E4F5, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x0A5DE24C2E226, 0x09895B40C7D31, 0x0000000000000, 0x0000000000000, 0x0FE9148D5102E, 0x2B2FB66D31E4D, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x30CD6FF3875EA, 0x1C164F2A6652E, 0x0000000000000, 0x0000000000000, 0x19D0B0FB06789, 0x2D488A3CCEBBC, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x6B104F744287A, 0x73457F702E12C, 0x0000000000000, 0x0000000000000, 0x74518AAF27162, 0x08897B2E5D12A, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x7FCE277F349D9, 0x65A628979DEF4, 0x0000000000000, 0x0000000000000, 0x0732500B3B020, 0x2F784DCC69A1C, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x36A289E75E82C, 0x34152FB4A1CBA, 0x0000000000000, 0x0000000000000, 0x53AA868BC4805, 0x22E173B7FB954, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x7395993ACD1A0, 0x026E4220CB64F, 0x0000000000000, 0x0000000000000, 0x2023D71004D98, 0x2920DBB4DC787, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x4C39478CCF62D, 0x69D1C27DC6DE2, 0x0000000000000, 0x0000000000000, 0x06B10E53680D0, 0x1C38FE6E5C908, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x40AF50675137D, 0x0881456B4DD42, 0x0000000000000, 0x0000000000000, 0x3F62829278F32, 0x26DD29372FC5F, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x79994EC9A98F3, 0x11F2C085A1564, 0x0000000000000, 0x0000000000000, 0x5EC2C917FB64F, 0x6F2A0A0B7DF7D, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x494580E874C4F, 0x194F28DAF594D, 0x0000000000000, 0x0000000000000, 0x1973A1BEBA9B6, 0x7084AB949C000, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x79FABEF40033C, 0x1943648DFE62B, 0x0000000000000, 0x0000000000000, 0x13AB6CDA59CC1, 0x0AAD1136CF06D, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x25790906BB006, 0x0DAF40D5D4468, 0x0000000000000, 0x0000000000000, 0x259F69EB5D2F3, 0x06F1E53A3D391, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x6BC1D8E7E83E2, 0x32E3C5DFA7831, 0x0000000000000, 0x0000000000000, 0x56DF2E97B1F2F, 0x4FA0CF2DD16A4, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x4333E6C760479, 0x198C7BC49711A, 0x0000000000000, 0x0000000000000, 0x4A415F5AE6EB0, 0x34B648925130E, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x0609F934242F1, 0x74AE8E87C9ADC, 0x0000000000000, 0x0000000000000, 0x1F14C9C77DDC7, 0x7ACA71DA45A11, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x7A785606E0DEC, 0x18FD0577A36CE, 0x0000000000000, 0x0000000000000, 0x0EDC4B1EDD17C, 0x01A621EFBE555, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x093D51EFFB94C, 0x47E7AB7C26DBD, 0x0000000000000, 0x0000000000000, 0x10CB92C1E030F, 0x51A4877E8055E, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x5CC74B3D5309C, 0x5ECCBE9BD05FE, 0x0000000000000, 0x0000000000000, 0x6ED4900FC035F, 0x5F335B49AAB46, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x709F322E7EA59, 0x1B318D4306076, 0x0000000000000, 0x0000000000000, 0x772DA5DD5FA11, 0x67ABFD5B4F6E0, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x7B0C5E806EC42, 0x1BD33AB18CE35, 0x0000000000000, 0x0000000000000, 0x164EFFF4969FD, 0x32875E76B69ED, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x3F62DE8782D2B, 0x4CB311ADA305B, 0x0000000000000, 0x0000000000000, 0x519BFB9B287FD, 0x6C4D17D00D91E, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x0219C065BDEF1, 0x6BC3CEF2EB335, 0x0000000000000, 0x0000000000000, 0x297F2773F3CCB, 0x6744F8524E077, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x2B325FA090878, 0x73237F4A03F79, 0x0000000000000, 0x0000000000000, 0x01E742BCED810, 0x611F14D0F2186, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x4F9E75F43AE11, 0x3ACEDA43717DD, 0x0000000000000, 0x0000000000000, 0x1C1B56F4E9621, 0x386A620D088B1, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x3CF735ADBC60D, 0x21F67B2A4B0E2, 0x0000000000000, 0x0000000000000, 0x4AC38F17A2799, 0x25760C3D59267, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x2BFF5526C3CB9, 0x1A004B15A063A, 0x0000000000000, 0x0000000000000, 0x2AFCCF6F22210, 0x2E016E71CB190, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x379BBE150AE4B, 0x02E2E6330FF28, 0x0000000000000, 0x0000000000000, 0x03659E072072D, 0x7706059D0D9D8, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x16D6E18750D0A, 0x5F0D853C14A5A, 0x0000000000000, 0x0000000000000, 0x6AC0998F0FB04, 0x7A258B8480A86, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x7E8B839D1E229, 0x7A7092AED4522, 0x0000000000000, 0x0000000000000, 0x4962C838506F8, 0x4346E39F1D2B8, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x5721021F4FF9B, 0x76650DA01F9B4, 0x0000000000000, 0x0000000000000, 0x18ADB93552264, 0x2179E110B3020, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x74F6EAEAC8B0D, 0x736B7646B8C67, 0x0000000000000, 0x0000000000000, 0x3E00F835CF449, 0x4FEFC7F964358, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x6B37846145A23, 0x1D74194709DD0, 0x0000000000000, 0x0000000000000, 0x53286B5F6F6DE, 0x2D64529E61A63, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x2F405D7194C3E, 0x59721475A54FA, 0x0000000000000, 0x0000000000000, 0x358787A5291C6, 0x5B1A5F1A36B47, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x684A7DED6B911, 0x5F040A112A974, 0x0000000000000, 0x0000000000000, 0x0B2AB459F5D52, 0x09FD8F10AB1D4, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x6E8B41AD137F3, 0x27E218D36C03B, 0x0000000000000, 0x0000000000000, 0x336D70380AB02, 0x075D87CD080EF, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x5356CCE3E1834, 0x63F5CD1DA2B65, 0x0000000000000, 0x0000000000000, 0x5049693AD8BF8, 0x63544D12A31A9, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x75B614BD441B2, 0x3094E76681C10, 0x0000000000000, 0x0000000000000, 0x24B17B2008D54, 0x49895BC2D1816, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x27B6FB344D42F, 0x16804C2D2D0C2, 0x0000000000000, 0x0000000000000, 0x68AE03120490C, 0x352106BEBD7D6, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x7157329665846, 0x2A15177510900, 0x0000000000000, 0x0000000000000, 0x1C21E4C3AB5B6, 0x6FA55AB50D1D0, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x60C5428B31CAD, 0x338648AFB6CD8, 0x0000000000000, 0x0000000000000, 0x1B7F9AB3B0899, 0x01F9980079558, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x4531483458B80, 0x4E4955DBEE72A, 0x0000000000000, 0x0000000000000, 0x3895F9F37FF52, 0x4D5435B353897, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x085554197FB6E, 0x1FF45CC876E7B, 0x0000000000000, 0x0000000000000, 0x705CC205FB6B8, 0x45112EB9CAFE2, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x61ECF83842C72, 0x1C221C023F2DD, 0x0000000000000, 0x0000000000000, 0x702282818BCD6, 0x765ECAA431EC5, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x2827CA74CD202, 0x12DDA1F08E6A3, 0x0000000000000, 0x0000000000000, 0x53EE279937AF5, 0x38FFCF3086E35, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x63944AD2A4368, 0x678300E7EDB62, 0x0000000000000, 0x0000000000000, 0x3BB760DD1580C, 0x13368F7BF1C88, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x7D51D5B445B0B, 0x696187E35E06A, 0x0000000000000, 0x0000000000000, 0x545399AB62239, 0x120C74CE36EC7, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x7CA2EE5A4F5D8, 0x56261CEA758B3, 0x0000000000000, 0x0000000000000, 0x2652FFBF112ED, 0x6AEC95A771FBF, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x5969D8E9D4F15, 0x352A1CCB06357, 0x0000000000000, 0x0000000000000, 0x0134F41118DAA, 0x0A4F82CD0F23E, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x385EAD5081D2F, 0x66BE0D425926E, 0x0000000000000, 0x0000000000000, 0x0210EB7A03EFC, 0x7F1DE98D284E0, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x641732F396B01, 0x07EA04461CF64, 0x0000000000000, 0x0000000000000, 0x4C325D5DA0EFE, 0x2B62DD93A19D8, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x18A38C2DC5746, 0x31FD06610733A, 0x0000000000000, 0x0000000000000, 0x05B8D34466F16, 0x23B36C7313849, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x75CCCE6979FEB, 0x2243553B70DC7, 0x0000000000000, 0x0000000000000, 0x62A589DC37A3D, 0x4838E4C1A753D, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x4F85C87ACA836, 0x47C61F3EC264A, 0x0000000000000, 0x0000000000000, 0x059121E861A46, 0x4EAB600F1F48F, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x6020571610C75, 0x2B00526B01B24, 0x0000000000000, 0x0000000000000, 0x55E655D531374, 0x3C12F0DF3B74A, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x5F139476625E5, 0x02EE0EAA82A47, 0x0000000000000, 0x0000000000000, 0x58C2D228BE572, 0x3C2246184C896, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x71CC673D92D17, 0x0EF973F1CFB86, 0x0000000000000, 0x0000000000000, 0x61F46D03E4C44, 0x1C9A7F0DA4B13, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x4EC3705A28316, 0x43A7D0B752BC9, 0x0000000000000, 0x0000000000000, 0x14DE6846152A6, 0x6E2D4BD634ABC, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x722FEB3F7C174, 0x7726DBE6C7AAB, 0x0000000000000, 0x0000000000000, 0x4BB5D43F3898B, 0x3730047BA4FB5, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x674950BB8AAAE, 0x2BBEDD313B126, 0x0000000000000, 0x0000000000000, 0x1BA06B7EEE1FB, 0x0AF3AC3C9AC25, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x0D4742B8807E0, 0x2D1965D0E439F, 0x0000000000000, 0x0000000000000, 0x575C3C9D70ED5, 0x2FD817229C3D3, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x15DE6B7948581, 0x017E19454A940, 0x0000000000000, 0x0000000000000, 0x482F9A0BA9F2D, 0x2250A68BB65D7, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x67BEE5C07716A, 0x1C51AD7606054, 0x0000000000000, 0x0000000000000, 0x171281F947A2E, 0x2135410ED77F3, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x5F3B6C7C79EFF, 0x4133E9222F753, 0x0000000000000, 0x0000000000000, 0x656D8B4DD0C95, 0x6DC92A1D22B00, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x4780665F96379, 0x2EA0866CBB55E, 0x0000000000000, 0x0000000000000, 0x368888D87A0B1, 0x40E0A5EE7E2DB, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x4F6BB903CA8E6, 0x519189714D207, 0x0000000000000, 0x0000000000000, 0x22ED3C9549C65, 0x010A96254F92E, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x04655BAE8BDDB, 0x5D061EC3D22F4, 0x0000000000000, 0x0000000000000, 0x021800CF8AA7E, 0x251C2E3FF11AF, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x4B447A963AC66, 0x4AA32AF50F816, 0x0000000000000, 0x0000000000000, 0x321F1ABE60359, 0x3C8B26B2C364F, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x6832F719EB687, 0x1B9E6EED48190, 0x0000000000000, 0x0000000000000, 0x63812D7572332, 0x2CCE7390D087A, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x42999A8A08841, 0x384B26C14A194, 0x0000000000000, 0x0000000000000, 0x6B3BE85DA4075, 0x38C57E62C65FD, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x5F3FB46090618, 0x756D843FF8DC7, 0x0000000000000, 0x0000000000000, 0x68B679F38F358, 0x61B5F839C8293, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x1C9F331DDADBC, 0x275A79012FAA0, 0x0000000000000, 0x0000000000000, 0x34B005F1B5345, 0x31742A7B66968, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x7DD6100C1BA1B, 0x1BB56AE4A1B1A, 0x0000000000000, 0x0000000000000, 0x6A299EEA7A63A, 0x703082DC8F3A5, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x30C4A877CBD92, 0x349589D6B9EC3, 0x0000000000000, 0x0000000000000, 0x0D58AD75B5C11, 0x3E8E897F0C23C, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x30FBC836AB0F9, 0x11D4BDFBD47E3, 0x0000000000000, 0x0000000000000, 0x4878851455B08, 0x2801C385253E0, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x250C56C7DF298, 0x5C4DB3C716B2D, 0x0000000000000, 0x0000000000000, 0x72121A28A2908, 0x58DCC167F5975, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x1D429616693FE, 0x3D2B9D366773C, 0x0000000000000, 0x0000000000000, 0x29708D440D60C, 0x0BA246FA5CEB3, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x7491527894F02, 0x75ECF6CA42A5C, 0x0000000000000, 0x0000000000000, 0x6B6DF89165900, 0x6B4B0E42355DE, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x01966474F8899, 0x47B5D2C81E46B, 0x0000000000000, 0x0000000000000, 0x1BE0CA11D9B75, 0x5DFD1F1E485A5, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x7F852E790742C, 0x6F456A9BA2F2C, 0x0000000000000, 0x0000000000000, 0x03CCCE5C38FC3, 0x3E670C17D0521, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x2427081AF2A54, 0x12CF018BA95B5, 0x0000000000000, 0x0000000000000, 0x6B3D4F3A43591, 0x1CE81384A372F, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x74A71F54C36A4, 0x0B26D44C9E577, 0x0000000000000, 0x0000000000000, 0x7C2439AE2CA7C, 0x2614430B32901, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x1D3C97EBAEB35, 0x5E7C11CC6FD00, 0x0000000000000, 0x0000000000000, 0x1999D4531AAF5, 0x311B95CB89004, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x037E2AE9CE781, 0x5212D87C61133, 0x0000000000000, 0x0000000000000, 0x404F5D0742E46, 0x475ABE2954737, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x179950094664B, 0x2EED02489D54D, 0x0000000000000, 0x0000000000000, 0x6A34751EBA3B1, 0x27AA9A7600D59, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x1A880C7022A37, 0x1BC8BA895759B, 0x0000000000000, 0x0000000000000, 0x6C9CD5F8324D3, 0x0F2D1045FB2AD, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x2A313CE520585, 0x0DEAFB8BCDB49, 0x0000000000000, 0x0000000000000, 0x17C43798734E3, 0x292C86000BC53, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x7F238C7EF2BE0, 0x1A35F70453C32, 0x0000000000000, 0x0000000000000, 0x51A55C5DACF42, 0x5325BBA61625F, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x32E1500F09EE2, 0x0B5318CA3669F, 0x0000000000000, 0x0000000000000, 0x68057CA4FEDCF, 0x62EC48EA2670A, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x4A9F730401163, 0x204B7DE2A25F8, 0x0000000000000, 0x0000000000000, 0x570CAA9E16A8D, 0x1062DD59E90E1, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x3DB3059F431AD, 0x18A2B7E0CD829, 0x0000000000000, 0x0000000000000, 0x65CC2AD9FE439, 0x63EDDACC89028, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x0A2928162BD8D, 0x4E102BC4BF56E, 0x0000000000000, 0x0000000000000, 0x59485D4F4257C, 0x03C94476FFC07, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x5168518420409, 0x161FF216008F4, 0x0000000000000, 0x0000000000000, 0x0AFA5AAB849A6, 0x38FFEF28E7BEC, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x414AD8C85802E, 0x2C1E5A0DF6B66, 0x0000000000000, 0x0000000000000, 0x6C90B4251D33E, 0x41A414FD62AB5, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x659D300DA70C1, 0x7EA3CDB6836FF, 0x0000000000000, 0x0000000000000, 0x2B1BD81578A93, 0x022D166F1A567, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x399D1CBD5B98C, 0x2A3BAC4AD5C48, 0x0000000000000, 0x0000000000000, 0x0B38DC1AEE61F, 0x186B660E30605, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x5A54AED4EF9E7, 0x4D6547F1E8E6D, 0x0000000000000, 0x0000000000000, 0x76BABD7FBEF83, 0x1125D0E3E55A7, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x0FFD115D3F0DA, 0x274815EF75602, 0x0000000000000, 0x0000000000000, 0x7F28937A6A4C2, 0x1CB14E4AE939E, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x36D2B775ADD67, 0x19F574A41F5B5, 0x0000000000000, 0x0000000000000, 0x2CA439D7D6B54, 0x273B971436CAF, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x549ED72B0905A, 0x150002FD6E06F, 0x0000000000000, 0x0000000000000, 0x4502E13143DB2, 0x30F58A7EF17FD, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x2357D16B5F930, 0x77063DB19BDE1, 0x0000000000000, 0x0000000000000, 0x632FDDB78A68B, 0x7EB27402E4CE6, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x271CE5BD36A7C, 0x3001AEF35FA61, 0x0000000000000, 0x0000000000000, 0x09BEFCA2766A5, 0x02B2412411078, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x09E666D1BF4DA, 0x5570878BD731F, 0x0000000000000, 0x0000000000000, 0x504DF5D2CDA88, 0x37B2403FFB7AC, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x2C3A42B3EECAA, 0x3D5EF7B7CAED6, 0x0000000000000, 0x0000000000000, 0x4F6FD021DEABE, 0x29AF1B2C0CB3F, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x023D936015CCA, 0x0ACCEA432CD25, 0x0000000000000, 0x0000000000000, 0x3FBAD3500491D, 0x2336CD8AEE840, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x0290EA0316DF9, 0x52EAF4A031D26, 0x0000000000000, 0x0000000000000, 0x20F4CF4B67E83, 0x77BA4E5B4EB5E, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x39D67796BAE48, 0x0C32DEB1CB3C7, 0x0000000000000, 0x0000000000000, 0x60FD41E3AA7DC, 0x1566C7A898356, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x6AD5E298AD567, 0x0AB16215593EC, 0x0000000000000, 0x0000000000000, 0x5AC50493280B6, 0x438B8220C035C, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x52348C0737837, 0x658DB27E8255F, 0x0000000000000, 0x0000000000000, 0x1EA32A4C1876E, 0x0D3B366DBB1EB, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x11F2EF09B7A0C, 0x0117435A4BF9C, 0x0000000000000, 0x0000000000000, 0x5F7902BB88B61, 0x2695D9A87B0FD, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x0C1D724377296, 0x0A7720A82866A, 0x0000000000000, 0x0000000000000, 0x0C5DF49F76384, 0x2D3D66C8D19D9, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x4B274B8817402, 0x74AF79A0E2869, 0x0000000000000, 0x0000000000000, 0x3168B741C1D98, 0x071901D4ACA62, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x24ED4CF088F23, 0x16BEAC7D1892C, 0x0000000000000, 0x0000000000000, 0x4DB46C0D11FB4, 0x2AF43C29F4A96, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x6EAF6CEECB2DA, 0x225B0BDEAD4DF, 0x0000000000000, 0x0000000000000, 0x48C46FC08C96D, 0x3DC8857090010, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x01680812D1CDC, 0x38EA4F7615A2B, 0x0000000000000, 0x0000000000000, 0x26ADC2F3795E1, 0x06BF7A325E649, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x6CD27995977FF, 0x6BFEC2DFE27AB, 0x0000000000000, 0x0000000000000, 0x46105DE1C5198, 0x19845199897CA, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x71512610B587D, 0x17E0A76E270FF, 0x0000000000000, 0x0000000000000, 0x50B3D60BFF7DC, 0x23F061EAABF99, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x4EEBC0E360DA5, 0x70F6A8146BE35, 0x0000000000000, 0x0000000000000, 0x28B51DE72C933, 0x43CA57002D0F6, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x0EC79F9AF7D1B, 0x2E0B038F3D33B, 0x0000000000000, 0x0000000000000, 0x7392105510377, 0x6AB4D1E760FC3, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x5F85C21E88C90, 0x6FEBF6CC2253C, 0x0000000000000, 0x0000000000000, 0x1A4FF299B46CE, 0x277EA420F512F, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x0D84754C3F399, 0x0443A1E7C82C7, 0x0000000000000, 0x0000000000000, 0x1435B30B5E0B6, 0x277C90379F526, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x477E822C1970A, 0x2EC2D6AC7D302, 0x0000000000000, 0x0000000000000, 0x25E0B5BDB7638, 0x2C90717FDE636, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x337C2B6E31D21, 0x0BCE2A99F5E54, 0x0000000000000, 0x0000000000000, 0x7F49BBFFBAD43, 0x22982066A560B, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x0D75F9E99EADB, 0x1D0A619A29051, 0x0000000000000, 0x0000000000000, 0x67D7634894E7F, 0x4ACD5F362D1D5, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x00A8BE27204A2, 0x79645529F8B0E, 0x0000000000000, 0x0000000000000, 0x3CEC87B5E9890, 0x2B38835F0193C, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x2A6923D6327BE, 0x3DB0A6BC84F0D, 0x0000000000000, 0x0000000000000, 0x365BDA36A37F5, 0x24356C2D50DB0, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x4C26F1503D59F, 0x79C0B1D7E4624, 0x0000000000000, 0x0000000000000, 0x184E950BF5291, 0x622EF82DBA4C3, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x19A84D0561223, 0x239B0195AEE1A, 0x0000000000000, 0x0000000000000, 0x4019781071FDA, 0x509E021B02ADF, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x1F7FFD5BA753E, 0x0E1CA033F1241, 0x0000000000000, 0x0000000000000, 0x407489C3FD053, 0x1FEBD4EC09CB2, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x30977B7F0D343, 0x1EAA287E0784B, 0x0000000000000, 0x0000000000000, 0x4B662CD5ED483, 0x5B6D804522F58, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x4E9D603764EBD, 0x0D0CAD8CF1192, 0x0000000000000, 0x0000000000000, 0x0787FADCEC825, 0x7E5F5F25E3955, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x6516C664CEA3C, 0x23DDB7DD89B8C, 0x0000000000000, 0x0000000000000, 0x14DAD90DCC78B, 0x4E28C5B1DC2B0, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x4C64CB5E71BDC, 0x2BE590223563A, 0x0000000000000, 0x0000000000000, 0x22C158B4E5DC0, 0x7B5C25F112697, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x3FA483BD80440, 0x52292F1CDEF5A, 0x0000000000000, 0x0000000000000, 0x0AC0197CC4437, 0x1F22280B55DB3, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x122C7B1DB222E, 0x17D2A5893C01A, 0x0000000000000, 0x0000000000000, 0x7072D884EF829, 0x1F280F87BA652, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x20CBB90306465, 0x7FE322E739029, 0x0000000000000, 0x0000000000000, 0x2C29383FF213D, 0x7EEA054436FCD, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x7BBA2EA111072, 0x55E939ECCF019, 0x0000000000000, 0x0000000000000, 0x583DA23390A64, 0x426643C52E48C, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x18161EEF3D10C, 0x2E9FE3B726589, 0x0000000000000, 0x0000000000000, 0x74FE84D2AB430, 0x7137BA595CEC2, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x0545DCB701712, 0x79BAF3C38E760, 0x0000000000000, 0x0000000000000, 0x1F180173EE2BC, 0x785CA354ED864, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x30DACBBEEB636, 0x6750BC1ABBFA3, 0x0000000000000, 0x0000000000000, 0x0AC4712A20C63, 0x5764FC37B8525, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x0507C40DD3624, 0x1C0478495962E, 0x0000000000000, 0x0000000000000, 0x0B5526E655D9C, 0x3195F986E106F, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x193C0C33BF546, 0x6B60159F47C4A, 0x0000000000000, 0x0000000000000, 0x452A1605CC4C4, 0x25C062DFDC12F, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x041EE12B4CA13, 0x0022C9B1E18D9, 0x0000000000000, 0x0000000000000, 0x0219BEF7A28A5, 0x754B68E3938D3, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x5EBC15A2F06F1, 0x2ED15585441F9, 0x0000000000000, 0x0000000000000, 0x7AEF186C6DDE7, 0x4968161578906, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x38F56C84A9913, 0x694E536D939F2, 0x0000000000000, 0x0000000000000, 0x7AD169FE44200, 0x330AB3C8631D5, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x76440916248F3, 0x291425F407622, 0x0000000000000, 0x0000000000000, 0x3860BEF6B4AF9, 0x0290518A56CBA, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x0BEE2AD17DE2A, 0x14160731E5E60, 0x0000000000000, 0x0000000000000, 0x2F32AC0690F29, 0x160A999CB8810, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x5D1B2792B8759, 0x6ADB76C1A34AF, 0x0000000000000, 0x0000000000000, 0x1DB0B0015C7A3, 0x1E2DB2D1440B4, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x5EF6CFB88917A, 0x48217A5825DD3, 0x0000000000000, 0x0000000000000, 0x5F4770BADFD9C, 0x3F55F0A41A59D, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x7BE3B5A418296, 0x5C6E5E9A3928D, 0x0000000000000, 0x0000000000000, 0x470F7B889E67F, 0x1DAC7EA1E1C4C, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x31FDC8932DEA6, 0x1688A65532A3A, 0x0000000000000, 0x0000000000000, 0x08343A82425BF, 0x4B0F70CEB222E, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x1558A6FDF0137, 0x7F94CDC08AFDE, 0x0000000000000, 0x0000000000000, 0x7CB14680AE7FC, 0x6E7066FCA78A8, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x1C99CA654694B, 0x16FC2F6C526C4, 0x0000000000000, 0x0000000000000, 0x745D26A184AE2, 0x1CA8E2EA2D743, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x220F46ED7E724, 0x3714CFDD2AC2B, 0x0000000000000, 0x0000000000000, 0x66DE1DC09D566, 0x6026C117C3342, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x34D8B5324AC34, 0x1F14468A2427E, 0x0000000000000, 0x0000000000000, 0x508AD502402F9, 0x1464F692CA40B, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x28FB325C6B78C, 0x0A426825938C5, 0x0000000000000, 0x0000000000000, 0x233AA1810941C, 0x2F9A48BEBC570, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x1CD435A9B7C73, 0x54621A1B8F487, 0x0000000000000, 0x0000000000000, 0x4A10B89AED8D5, 0x65597303CB568, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x10E42C514C205, 0x0E83842100877, 0x0000000000000, 0x0000000000000, 0x7DE033017FBCA, 0x6FDB43CA6B7BB, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x71A3C86707677, 0x18C43438526DF, 0x0000000000000, 0x0000000000000, 0x0233747E1B33F, 0x33A4DFE54CE65, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x58EBADAC4C342, 0x7106C078A4CEC, 0x0000000000000, 0x0000000000000, 0x107CD4C5BFCCA, 0x35AFB6AC75DA0, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x3A628217C02EE, 0x00387B78FC53F, 0x0000000000000, 0x0000000000000, 0x50F357425ADF8, 0x4BD08C51861C3, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x1FBFCE1B30F86, 0x5A82FDCF2EAE6, 0x0000000000000, 0x0000000000000, 0x1BA841562C22D, 0x55EB229281897, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x0FFA089A8ADF4, 0x4DCB1B5EA0F78, 0x0000000000000, 0x0000000000000, 0x6FDE87C73CF7B, 0x66C044B23481C, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x65979B98B5D43, 0x58A6885DF0527, 0x0000000000000, 0x0000000000000, 0x32992CA8D1162, 0x73FABBA101383, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x754290AFB2689, 0x0C04156CC8793, 0x0000000000000, 0x0000000000000, 0x515946A289878, 0x2E1A86ED4BCD7, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x727F22720E183, 0x157F5A69E1411, 0x0000000000000, 0x0000000000000, 0x0F248FDB639AB, 0x29F8E59F10F81, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x558003B0833BE, 0x3746DEA532D62, 0x0000000000000, 0x0000000000000, 0x29988BBFB0F0E, 0x01A3AE16823E5, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x4784695CF9F9F, 0x4F2A3B2779891, 0x0000000000000, 0x0000000000000, 0x442B4F9860F58, 0x79EE6CD7FE374, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x1B2F25CF204AE, 0x23C2FE386A12B, 0x0000000000000, 0x0000000000000, 0x5C3984CE70128, 0x3D2C8F40F7583, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x79F03D0D12AB9, 0x65649A84A2144, 0x0000000000000, 0x0000000000000, 0x735777FE25218, 0x4371527479FDD, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x54CF26A4A342B, 0x155B63068593C, 0x0000000000000, 0x0000000000000, 0x2B72A81BE0C3B, 0x32EF7C53F2E29, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x5B418A71AAAFE, 0x1EF479073D3BA, 0x0000000000000, 0x0000000000000, 0x379302AE01F78, 0x2259F09681AD0, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x4CE37E32A8CEC, 0x5DD0AD3C5DB83, 0x0000000000000, 0x0000000000000, 0x05416F5881FCD, 0x2A6130B16D92A, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x765462A04B0B7, 0x6A6AF6E9C2B57, 0x0000000000000, 0x0000000000000, 0x4FAFD5E61908D, 0x269668CF4711F, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x2D893AE645194, 0x772EB15F468DB, 0x0000000000000, 0x0000000000000, 0x2B14706B3E78A, 0x7BC04E8CCB33A, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x0F6B160DDB5AD, 0x02AC62B98FD84, 0x0000000000000, 0x0000000000000, 0x41165FD806374, 0x7D538B0A02769, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x717C008EE8EC4, 0x1742838D6FCF6, 0x0000000000000, 0x0000000000000, 0x143A82CB7C0EF, 0x31C46FF34527A, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x39A526C512655, 0x195F41BA49D78, 0x0000000000000, 0x0000000000000, 0x15D9B1C9F31DD, 0x0B6A5D0C2B17C, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x1635C11E06A4D, 0x67873D7ABDD55, 0x0000000000000, 0x0000000000000, 0x7C9C364B47CAB, 0x18CFF1432A30A, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x5BF7B7C6522B7, 0x765784590E29C, 0x0000000000000, 0x0000000000000, 0x0CD0D0F3896BA, 0x2CB519062D0C2, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x35C6646169F7D, 0x668213F69D741, 0x0000000000000, 0x0000000000000, 0x0806C71AB59C6, 0x76C0E0499002F, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x4AB0BD35778AF, 0x4549A19F81084, 0x0000000000000, 0x0000000000000, 0x6EE6DCEB3B8B3, 0x6D474EF641C3C, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x061F860434448, 0x1D87272DDB8AF, 0x0000000000000, 0x0000000000000, 0x5655D89097FB5, 0x1FBEAF856D231, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x14E5949E5D954, 0x17075AEF41A31, 0x0000000000000, 0x0000000000000, 0x7E0BE17D74DC4, 0x66FC45D097D02, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x632D0C0886455, 0x21D0BDA25956C, 0x0000000000000, 0x0000000000000, 0x247255767BE42, 0x1B2873E9FC002, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x36E324C97C2A3, 0x7CEEDC3F4EEAB, 0x0000000000000, 0x0000000000000, 0x2425E10384FD9, 0x320148111673B, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x33D104CFFD990, 0x048DE43C6E3D1, 0x0000000000000, 0x0000000000000, 0x3AF0FE0044062, 0x436F63CE2FBF7, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x0B0D8C40743CF, 0x491D89DDA4A50, 0x0000000000000, 0x0000000000000, 0x369B65AEFD8C2, 0x7B5882F570DE0, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x1A4622A3EEFF7, 0x13A62CCE207C8, 0x0000000000000, 0x0000000000000, 0x686FCB83FE2C3, 0x1C4FC541748D5, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x2432B277F0441, 0x036A64EB606B9, 0x0000000000000, 0x0000000000000, 0x16E36074CE437, 0x716C75F25D3D2, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x64C5A42850161, 0x7A4F44C1D2268, 0x0000000000000, 0x0000000000000, 0x44DFD19859231, 0x042FFB552D4C1, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x74B00486A477C, 0x02FCD6D0C37B4, 0x0000000000000, 0x0000000000000, 0x4D5FE8D362228, 0x35DFFA3C65FD2, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x1E549BFC49BC3, 0x6B474BE360DCB, 0x0000000000000, 0x0000000000000, 0x2CA9CDE9D134C, 0x2D4C41AFB3B05, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x5DCF9D14FF04C, 0x51FBBA16880A3, 0x0000000000000, 0x0000000000000, 0x6BD3E6B2427B8, 0x60C1057944537, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x491BD34A655C7, 0x0BE28408B2C6A, 0x0000000000000, 0x0000000000000, 0x6E8D84C1DA8C8, 0x28784E9F59493, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x4117114789F7D, 0x3A513AD31E7EE, 0x0000000000000, 0x0000000000000, 0x7AB06A066203B, 0x3E05F45484871, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x62B081FC72077, 0x22DA7139205E9, 0x0000000000000, 0x0000000000000, 0x59B30580F5787, 0x2E4003C638AF2, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x4C6349E18B31D, 0x0F444142202F8, 0x0000000000000, 0x0000000000000, 0x0A5DDB5F5345A, 0x601EECD9E1914, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x632CC6395003E, 0x295756E34E466, 0x0000000000000, 0x0000000000000, 0x453859F2FAC94, 0x2EE6A947139F2, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x50C531F8DEB52, 0x080902AE8BCC2, 0x0000000000000, 0x0000000000000, 0x6A5FE3B829EFA, 0x1967AB8F37F86, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x43C40767FF1C0, 0x1D86F3482E47E, 0x0000000000000, 0x0000000000000, 0x2154712806912, 0x235488B060B64, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x047EF7DCCFBAE, 0x54AA1DBB7580E, 0x0000000000000, 0x0000000000000, 0x1AC5010125692, 0x15C8C0A9C02A0, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x34AA14C95590C, 0x7BB83CFA16867, 0x0000000000000, 0x0000000000000, 0x373D357623741, 0x10342B1258043, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x28A67ADF65005, 0x236B8427AA391, 0x0000000000000, 0x0000000000000, 0x0C54915EAC2CD, 0x6BE7C85BC10F1, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x6DE79803050A1, 0x223D035860D03, 0x0000000000000, 0x0000000000000, 0x4C5A119B9B861, 0x2CD7830E30C26, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x4D5C3115174E6, 0x429ABE0C607C5, 0x0000000000000, 0x0000000000000, 0x40F6196BE4E9F, 0x0941E61529583, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x552B0CB81456D, 0x169CBBBE11D4A, 0x0000000000000, 0x0000000000000, 0x7E980F363EF52, 0x1EEDB1961AF15, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x3599029FD4BD8, 0x71E6C83B3AFAC, 0x0000000000000, 0x0000000000000, 0x381BEE4F3B712, 0x5616C951DB7ED, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x2DF05569C3802, 0x6A7093A8AA3D8, 0x0000000000000, 0x0000000000000, 0x1DFABD20C786C, 0x17B56E6EE91DF, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x0B3809906D4FC, 0x01D3ED34B4FFC, 0x0000000000000, 0x0000000000000, 0x1FB7AE63AFD5E, 0x509E28E72DBA1, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x7C1A361D7AFD2, 0x38946A43B71ED, 0x0000000000000, 0x0000000000000, 0x1BC8A6D48D29D, 0x4D370974182B8, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x7A1212B6A50EB, 0x54C884F6AB25D, 0x0000000000000, 0x0000000000000, 0x00873D4CD53CB, 0x0058182D2C9E8, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x3022C84F8F46F, 0x10329C453DB23, 0x0000000000000, 0x0000000000000, 0x1466691A6ADFE, 0x23622BB1EA926, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x5F97C45E151CE, 0x23090DDC9005E, 0x0000000000000, 0x0000000000000, 0x1F2830DC3D154, 0x0AC658D494B5C, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x4967308687AE1, 0x08A70D4BCA9D0, 0x0000000000000, 0x0000000000000, 0x4804AFFE85BA5, 0x43BCD6A48CCCB, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x302D700CEC16E, 0x698F60035B565, 0x0000000000000, 0x0000000000000, 0x5A90F1A25C308, 0x4BE442C701CBB, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x30A8F7FAABC5F, 0x032928D011201, 0x0000000000000, 0x0000000000000, 0x6CB730CFE194D, 0x137CA7C2B008E, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x3AE1E39F3E08C, 0x1E22B42121F6A, 0x0000000000000, 0x0000000000000, 0x2B571BF528874, 0x3334DB5C9D419, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x543D5066F35CE, 0x1180D1524923D, 0x0000000000000, 0x0000000000000, 0x1FB9DAD1014B3, 0x205EE4EF8BC1F, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x740564BF38162, 0x5FD8D1D630A78, 0x0000000000000, 0x0000000000000, 0x198A1EA53B6FE, 0x569B6F2DF370D, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x398E9C9BCB1F8, 0x6DEEC31C9FDE8, 0x0000000000000, 0x0000000000000, 0x7101068F82376, 0x41DF3C4BFD1B6, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x5F5A198E51908, 0x78F837BA99E2B, 0x0000000000000, 0x0000000000000, 0x5CEB06B5DAD5D, 0x5FF474E68391C, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x7FA5FC6102237, 0x40C7A095A909D, 0x0000000000000, 0x0000000000000, 0x7D24D4247D1CC, 0x4A64872C732E6, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x38907A103229D, 0x053E2B4156BA4, 0x0000000000000, 0x0000000000000, 0x136D508AA4EEC, 0x20C93D52906A4, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x1087C744B3797, 0x0CBBF044F669D, 0x0000000000000, 0x0000000000000, 0x1F9538DB14D69, 0x341C744E1C408, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x27AD1041B01D2, 0x646FEACD2A280, 0x0000000000000, 0x0000000000000, 0x2A43DA7CDBA8C, 0x7B617F8FA2E26, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x198C139F82616, 0x4783BFD438B9A, 0x0000000000000, 0x0000000000000, 0x34A02D76ABB7F, 0x177A417E0B0F5, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x5F6B76A3379C5, 0x51086D22B7578, 0x0000000000000, 0x0000000000000, 0x5CFD9038236B6, 0x65D293E86EC5D, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x48537F6326CDA, 0x770FD4688CAC3, 0x0000000000000, 0x0000000000000, 0x35258C5962766, 0x2BBC4423505B3, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x2E1C5FECBB328, 0x591B403D60A0F, 0x0000000000000, 0x0000000000000, 0x2D5EAE88B1D53, 0x673118D5B8CEF, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x49FEAF637A9BA, 0x21697DD42AE65, 0x0000000000000, 0x0000000000000, 0x21FD722B087DE, 0x2AEC3558170C8, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x5B3FEF2E6E6A4, 0x16555AF6FBA9D, 0x0000000000000, 0x0000000000000, 0x1E82735E29E60, 0x2276D7EFBBAEC, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x4B28C264E9598, 0x7804CDF606810, 0x0000000000000, 0x0000000000000, 0x70BD839DD161F, 0x3727062785FF1, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x0B42D62D1E32C, 0x73D675A7401A4, 0x0000000000000, 0x0000000000000, 0x5503F797FE3C8, 0x648F91B15B341, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x77FD2FAF46C33, 0x557AA3DF11FF1, 0x0000000000000, 0x0000000000000, 0x66AF6EDA66E87, 0x3FBE2CD797F57, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x7FAB7B530EDC1, 0x23753CE4E63AF, 0x0000000000000, 0x0000000000000, 0x37DCAA6D354DA, 0x65C9D2BC58DE8, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x2998F12F2937A, 0x0ABDDBDCD03F4, 0x0000000000000, 0x0000000000000, 0x34920B99D89D5, 0x2D315715220AB, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x32A284FC21EB1, 0x023CBFEB088C7, 0x0000000000000, 0x0000000000000, 0x0AFDD817A6217, 0x1EC79FEF26BA2, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x49B98DC3F7F5D, 0x6C6B5AB4E38DB, 0x0000000000000, 0x0000000000000, 0x7B797EB0CA7CE, 0x2A573038447C4, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x67B9D098191B8, 0x6FEB9CAD91FAB, 0x0000000000000, 0x0000000000000, 0x72C3D5B5B7B25, 0x4B6304CAEF61E, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x486106B1585E8, 0x3E823FC3EC500, 0x0000000000000, 0x0000000000000, 0x333AA48B50106, 0x4F68DE9171FA2, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x17B79B7313595, 0x78D1C130890B0, 0x0000000000000, 0x0000000000000, 0x3581CF232F91C, 0x2CD7A761A4CDF, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x166BFA7713ABB, 0x1A4427EDAE0CD, 0x0000000000000, 0x0000000000000, 0x56BEFD836AA7B, 0x294368FF1E098, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x3D7E84DAC62D6, 0x3F7D649C16979, 0x0000000000000, 0x0000000000000, 0x39C3FDF22B546, 0x428EF773AF9AB, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x27809E39A2814, 0x38C6BCEA4AE1B, 0x0000000000000, 0x0000000000000, 0x17899CCB9E6FE, 0x35F6CD292DF80, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x2EDC91D691CA8, 0x2DBA3F413B4A3, 0x0000000000000, 0x0000000000000, 0x0496C8A6E5B94, 0x0E11DB58B160D, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x7DBE4669A1B86, 0x5E9C7CA12D46C, 0x0000000000000, 0x0000000000000, 0x4DED27B6A33CF, 0x1A63E6F9B6C98, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x095A1BCFA3F0A, 0x50DB3195B90D5, 0x0000000000000, 0x0000000000000, 0x59E937296138C, 0x389A9CE3979F6, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x07EABD86EE838, 0x012F27FA353E7, 0x0000000000000, 0x0000000000000, 0x0593CFBF595B1, 0x273E5FE1CD260, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x519477AA7F416, 0x1EE1124CC2AC8, 0x0000000000000, 0x0000000000000, 0x62463C4F18F20, 0x6BC53C920504D, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x09361F506BDFC, 0x395269E07A4F7, 0x0000000000000, 0x0000000000000, 0x60EC4EF55A70D, 0x08CF91DDBE092, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x28C8122A38459, 0x6301E715149B6, 0x0000000000000, 0x0000000000000, 0x2CB785015D98B, 0x5D4FBA888D1B5, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x44E94B3C10174, 0x4BCE6947A859A, 0x0000000000000, 0x0000000000000, 0x2BE0C6A478002, 0x5306D3C1E951F, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x42C34613EE87C, 0x4B8338833CC6D, 0x0000000000000, 0x0000000000000, 0x5B764AEAF4918, 0x2469D6CC17557, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x4302C8D077A42, 0x16BE241CD653E, 0x0000000000000, 0x0000000000000, 0x4E7364F308B3B, 0x1946F47020B69, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x29E02F712CE6A, 0x47FB293F061A7, 0x0000000000000, 0x0000000000000, 0x57872062E9C82, 0x1ACF37813D60B, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x7FF244DAA802B, 0x6F8BFF22507F5, 0x0000000000000, 0x0000000000000, 0x4205E36A48E8C, 0x175263E8FA204, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x125A56ABF563C, 0x65B6B573E3442, 0x0000000000000, 0x0000000000000, 0x3D4958FC9A978, 0x6B4E9BA3AA54E, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x62E4B0899B582, 0x2C89D5F8F758D, 0x0000000000000, 0x0000000000000, 0x4D2796BBBF3BF, 0x0F157AE543E48, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x3B0A205365691, 0x6C0474F68177D, 0x0000000000000, 0x0000000000000, 0x5108430796511, 0x4B3C8F6E3F3A2, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x6312EA28B219F, 0x15B565BEC8F73, 0x0000000000000, 0x0000000000000, 0x05A94C9A71EE1, 0x20DDE84BBEACC, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x74FBAA336564C, 0x355B4AB05DC64, 0x0000000000000, 0x0000000000000, 0x45BE35E725B94, 0x6DEEBA3D80960, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x055BF93C297A1, 0x3615BB5C25095, 0x0000000000000, 0x0000000000000, 0x66F62BEF746AB, 0x6B5D64F6AF5F3, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x1AB223246B1F8, 0x6407E42B5BC2C, 0x0000000000000, 0x0000000000000, 0x75FA9E39462D4, 0x72DE35F8E1D21, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x444D0E0109A05, 0x7E0B02F706CFD, 0x0000000000000, 0x0000000000000, 0x1D12072AB9E46, 0x42EB64811EB7E, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x3896FDDB3CD38, 0x5F76CED9D78FA, 0x0000000000000, 0x0000000000000, 0x334C8E15E1CA7, 0x1F874D812BCA7, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x0C750E1831F65, 0x2195EF5E31C3D, 0x0000000000000, 0x0000000000000, 0x27C5822A4782A, 0x2B58D05D70842, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x3BD728C7EFCE0, 0x48CE91E8E074D, 0x0000000000000, 0x0000000000000, 0x04D3A11A2ED42, 0x726689F9523EF, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x5956A2F3AF123, 0x4653A863ABFB6, 0x0000000000000, 0x0000000000000, 0x0E5045734D180, 0x46D016FEFB7D9, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x6363531CD3EFE, 0x269EC9A9A8588, 0x0000000000000, 0x0000000000000, 0x650E65DFF26BE, 0x7E0C7550DE768, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x23FE69552B0C1, 0x13EA7F35EB4FB, 0x0000000000000, 0x0000000000000, 0x7E515F067260F, 0x02F12E5B2A165, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x45C204DAD3E62, 0x3B3B1D246B7E1, 0x0000000000000, 0x0000000000000, 0x69A52FF45CFAC, 0x101436AFAD37E, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x3BD18D384D16C, 0x1C74D281B2649, 0x0000000000000, 0x0000000000000, 0x73FBDFB9B3231, 0x219065CDAF5E9, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x5C1C3CC9D5628, 0x7C90623337171, 0x0000000000000, 0x0000000000000, 0x1095128E508F8, 0x7FB3FB7199AB1, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x201E217CA73EB, 0x04D5E5EC45DA7, 0x0000000000000, 0x0000000000000, 0x7BEFF7C0D0A24, 0x27CE852788E48, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x66366B823B73E, 0x6CAABEB9FA72E, 0x0000000000000, 0x0000000000000, 0x3C1DA3E9F072F, 0x4D7144A30A8B4, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x3BB941FE989F4, 0x0211B1ED0A89C, 0x0000000000000, 0x0000000000000, 0x08BAC9F391B67, 0x4D3F83E2EB401, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x74B336607199A, 0x227C26173953D, 0x0000000000000, 0x0000000000000, 0x762AD81606EB8, 0x60457FE7986E4, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x053146E13E595, 0x1C0632A5025B8, 0x0000000000000, 0x0000000000000, 0x253FB49EA3857, 0x214F9707AA76B, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x5103E5F52EAFF, 0x2A35A1EE4A7A1, 0x0000000000000, 0x0000000000000, 0x22ACBFDBD62A5, 0x3252C014CE422, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x718A7E431A9D2, 0x54AD75A9C6977, 0x0000000000000, 0x0000000000000, 0x45A866BAA442E, 0x6B14460C8D47D, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x1560769F905BC, 0x087CA555A236E, 0x0000000000000, 0x0000000000000, 0x642C01327EBAE, 0x6D7D5BAEF5AB7, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x21EF0E437A40C, 0x565C3DC17F3D6, 0x0000000000000, 0x0000000000000, 0x3585802F71E86, 0x14B8FDD424BF8, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x7C54FBFB86779, 0x1A40CB64C1A69, 0x0000000000000, 0x0000000000000, 0x0DD8BC858B7AF, 0x471CF25E544C3, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x12455EFD7B129, 0x0CBFA9C18857B, 0x0000000000000, 0x0000000000000, 0x7F41852876C33, 0x292FCB6BEC847, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x475EBB47D714F, 0x4F7DCD39D49DC, 0x0000000000000, 0x0000000000000, 0x13EAAFE303945, 0x2BBAB13DE7DB4, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x1776198B2E03D, 0x60A423CD6E826, 0x0000000000000, 0x0000000000000, 0x5D6B51DA0D473, 0x0825608180A82, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x48F61C12637A0, 0x05C96E355DF68, 0x0000000000000, 0x0000000000000, 0x746C2D85A4DD8, 0x34656DD0D8DB5, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x7628D20946E66, 0x2F7AC2189B986, 0x0000000000000, 0x0000000000000, 0x36B5601B86E9F, 0x7E2FB70AA7371, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x2EAE8B1A1B866, 0x6AF2462710E62, 0x0000000000000, 0x0000000000000, 0x5A1604E73D3E5, 0x30B0E7A25D950, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x431627A8AF289, 0x1A855FC188815, 0x0000000000000, 0x0000000000000, 0x45CE471D46E59, 0x306F313EAF31D, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x5AAF47C82EA20, 0x527F393854976, 0x0000000000000, 0x0000000000000, 0x2270EEB89FFCE, 0x7CACEC86AE16D, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x0B4AD082B7BCA, 0x5EE58956A7A81, 0x0000000000000, 0x0000000000000, 0x697822C735D71, 0x0A11A55F55C17, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x40275491DEC3A, 0x754A17AE94293, 0x0000000000000, 0x0000000000000, 0x0A6F7A11C1950, 0x2FEF5C8F61CBA, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x2705FC0143DD5, 0x53469A8575ABD, 0x0000000000000, 0x0000000000000, 0x6C56770B5C5EB, 0x7B770C0D3B75A, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x6CA8FC48722C2, 0x3E69C59CDB4C6, 0x0000000000000, 0x0000000000000, 0x491570C52E1D0, 0x4F76EE0C30F61, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x5C1ADB329A682, 0x1AE04D5683359, 0x0000000000000, 0x0000000000000, 0x21014034BC36D, 0x2996F2A73F42F, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x3DF9C2C7669A9, 0x042768B73D178, 0x0000000000000, 0x0000000000000, 0x621A09674C9BD, 0x253C0A4EE4FA5, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x4FE2860D88B9B, 0x421C32F28FED4, 0x0000000000000, 0x0000000000000, 0x7F11384E320A0, 0x21AD295D904FF, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x0B8DFCF29E6A8, 0x4B793BD6FF2B7, 0x0000000000000, 0x0000000000000, 0x760D9450F64AD, 0x52F3F8D844A73, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x0CE5C753C7FEC, 0x5A221473A733A, 0x0000000000000, 0x0000000000000, 0x1752CCD44AE91, 0x02B473B2E6411, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x58C81097C8831, 0x6A3AB47630F96, 0x0000000000000, 0x0000000000000, 0x42FF0215CA6E5, 0x4DCE1E4E267D0, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x62D973255D1A3, 0x0D3B21FA7E957, 0x0000000000000, 0x0000000000000, 0x756A6580C1F40, 0x26C92DD15B6E0, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x05BFEAD0D4F02, 0x43B3B6DCC737A, 0x0000000000000, 0x0000000000000, 0x0C676FCFF57D0, 0x493E90ED99612, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x3513874D7F8C4, 0x16F7A1E5C5713, 0x0000000000000, 0x0000000000000, 0x301EC10E3378A, 0x654E8F24CBCE7, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x720FAB3AA9905, 0x5C442EC6780C0, 0x0000000000000, 0x0000000000000, 0x77C2EA7B32CA8, 0x2AEB9A8D526B4, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x5B5C638DC8AD2, 0x4C38D66AC3C8A, 0x0000000000000, 0x0000000000000, 0x0A0B9AEB08F37, 0x17FE21D0A82F1, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x40CB2A521E65A, 0x09B4EFD4617F9, 0x0000000000000, 0x0000000000000, 0x557DFAB826226, 0x6F6D68BC38F90, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x42AC0E0C967E2, 0x1ACDC5992F1BE, 0x0000000000000, 0x0000000000000, 0x2F649823A4135, 0x1F02DAF53038A, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x526A7616681CD, 0x21C29A7341D0D, 0x0000000000000, 0x0000000000000, 0x0E0C2F5B1C011, 0x2608015FE429D, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x3A7A7D368BEFB, 0x269CC482A3232, 0x0000000000000, 0x0000000000000, 0x14DEBB969A8D8, 0x70B2105B58889, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x266C772AA89E8, 0x29404D1F9E51F, 0x0000000000000, 0x0000000000000, 0x38E155AC717ED, 0x4C1C25FEAB733, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x7F16476F48C55, 0x4539AA968DB2A, 0x0000000000000, 0x0000000000000, 0x785B2A6024A5E, 0x56976B796B53C, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x4306B7428991D, 0x6F4C916F040A8, 0x0000000000000, 0x0000000000000, 0x75B1C0CAE2AE9, 0x4828C05974FB8, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x5CD0A8FF02FBF, 0x08F1145EAF3CB, 0x0000000000000, 0x0000000000000, 0x3678FBD0A8A24, 0x21C65D9C6236C, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x44850FFA2D8CC, 0x0E1E3E673523F, 0x0000000000000, 0x0000000000000, 0x4605B0653868A, 0x37B5C44CB4A0A, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x69AE06C691E69, 0x50FAFB33E4798, 0x0000000000000, 0x0000000000000, 0x29586B42487F7, 0x3E58AF476F8D0, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x30CBC6AD26476, 0x133FD2DB903C3, 0x0000000000000, 0x0000000000000, 0x711FB5B7357B3, 0x377F05711EA6F, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x1935AE680537A, 0x1BA6F72970BA2, 0x0000000000000, 0x0000000000000, 0x6BEDCB51CC8DC, 0x55D683B51FC30, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x5978925A92915, 0x68ABFD776731A, 0x0000000000000, 0x0000000000000, 0x3CAFF88244934, 0x5D4D0EBB8C087, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x144BC28B630D1, 0x1BF5B09C6A679, 0x0000000000000, 0x0000000000000, 0x55EF214DCD8EF, 0x1FEDB10D68AC9, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x3721F13A6466B, 0x54E4201CD38C4, 0x0000000000000, 0x0000000000000, 0x783370743281B, 0x330E77F85DA80, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x6D035CFB90823, 0x40F2BDDDC34B3, 0x0000000000000, 0x0000000000000, 0x5881D54D9BAC5, 0x3C3BCE980E727, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x3089EA85993BA, 0x2D5AD666D1F54, 0x0000000000000, 0x0000000000000, 0x0323EB7EDF313, 0x38859D98FFA20, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x27AB041602A1F, 0x305EC7DF612E7, 0x0000000000000, 0x0000000000000, 0x6E86A5304A042, 0x72C458521B543, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x06079B85D39FB, 0x7DC488C7F099D, 0x0000000000000, 0x0000000000000, 0x7BFBDC9E02613, 0x6D3DBE6291D16, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x1D95836D4910B, 0x18AAD9C879639, 0x0000000000000, 0x0000000000000, 0x281F599BCA07D, 0x215654A99B26C, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x6C73D43FF18D7, 0x2118EFA2F4641, 0x0000000000000, 0x0000000000000, 0x777F947D63D19, 0x23F9B2B4E1099, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x24FFC7E979B97, 0x3DCB2AF22245C, 0x0000000000000, 0x0000000000000, 0x132157E690210, 0x06652DA359D9F, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x407503D1D3CEE, 0x42B9FF25DDBC3, 0x0000000000000, 0x0000000000000, 0x277229AFD6FBE, 0x5E4F67F8ED3ED, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x2A6EC94D97D1B, 0x7A739E21B37EE, 0x0000000000000, 0x0000000000000, 0x109C341E62BB1, 0x2BA282713E3D4, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x2AACBF3B9BC16, 0x11B85ED5DF0FB, 0x0000000000000, 0x0000000000000, 0x79372C8F9153E, 0x4AA02CCEF925F, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x154113E17A930, 0x1DEA212224DA3, 0x0000000000000, 0x0000000000000, 0x4F1A2EBD24E4D, 0x25EBBCEBB59E6, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x208211D8376C9, 0x638396FF275AD, 0x0000000000000, 0x0000000000000, 0x1AEC8D43D5AF1, 0x7CEC41F3D4F56, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x3CE448B5DDF5D, 0x7AD1D94E1CF0D, 0x0000000000000, 0x0000000000000, 0x623236DC14873, 0x35303ACC4EEE7, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x433865FE67422, 0x74A03FE8DD77F, 0x0000000000000, 0x0000000000000, 0x0D02E3BE14ADC, 0x3ED448A5A5821, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x47F6B1FA764B3, 0x4AD10F5DDE6AD, 0x0000000000000, 0x0000000000000, 0x457318D34B48D, 0x4498A472CD2BA, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x2382AC39DDF94, 0x6DF34824016FA, 0x0000000000000, 0x0000000000000, 0x456A58C9A7EB8, 0x7D6E77D29313E, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x725DFA74F76A4, 0x1251F1E5B64AD, 0x0000000000000, 0x0000000000000, 0x04B51F6B5A22F, 0x22832455A90A4, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x57D4F242E3F6E, 0x20B30B8478367, 0x0000000000000, 0x0000000000000, 0x20A8472DAF154, 0x60F9A14B7D55B, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x37F72685E0896, 0x7B5AE3251AE91, 0x0000000000000, 0x0000000000000, 0x6A9A90EE15902, 0x00457F6504F39, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x49E955031085E, 0x3EA0C8AA6FF78, 0x0000000000000, 0x0000000000000, 0x34EB8E6635249, 0x55186208219B6, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x31966BBDF727A, 0x0BDF4FB3052F4, 0x0000000000000, 0x0000000000000, 0x565A4B2A90A77, 0x5F0673D7AFD8C, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x178B453486129, 0x51EC4163DD272, 0x0000000000000, 0x0000000000000, 0x3ADB1170C461C, 0x534789A7657CC, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x1609E7893E537, 0x087FC4D8130A9, 0x0000000000000, 0x0000000000000, 0x4CB368F088736, 0x20B2478389A39, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x2843320610AF9, 0x2E95F23118E06, 0x0000000000000, 0x0000000000000, 0x7D1C0510F4303, 0x32DB0D2E01397, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x64AFC931C08D5, 0x67813FCFE38BC, 0x0000000000000, 0x0000000000000, 0x7746B2D5B1010, 0x6DABA1D7023A7, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x1358C13B2DE4F, 0x119FE926FA080, 0x0000000000000, 0x0000000000000, 0x3319BC9F46A6F, 0x7071B666F7ECE, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x1FBA06D69B4FD, 0x7CCCA8714FBE8, 0x0000000000000, 0x0000000000000, 0x6AE5C3AD6A244, 0x70BC1C7B0C24C, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x5BDD3A708DBD2, 0x264D37DC71364, 0x0000000000000, 0x0000000000000, 0x05F3C0EC054B6, 0x78674BBF63432, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x0B7AF3AF42419, 0x122C828F14E95, 0x0000000000000, 0x0000000000000, 0x0004F22F9AD83, 0x34C40546D5B7A, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x6EE15CA158C55, 0x1C02EA36943A3, 0x0000000000000, 0x0000000000000, 0x3B025225F1115, 0x13CFE1829AFD5, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x7861E5AC3E7C0, 0x67D3969D21C03, 0x0000000000000, 0x0000000000000, 0x3AA2BED013EA1, 0x6DE1866E7E2C9, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x4C26DF67DB4B8, 0x10A7979F9BA08, 0x0000000000000, 0x0000000000000, 0x21137A95FBCC0, 0x31053254FAA39, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x294AFE75F5881, 0x11C80ACFF4545, 0x0000000000000, 0x0000000000000, 0x215F4434DAD32, 0x0F7E0365D01E3, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x68A43030FCB39, 0x5B26BDD92C5B0, 0x0000000000000, 0x0000000000000, 0x6A3DD8065159C, 0x290242D522D8C, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x72B442BEFAF17, 0x0CF929DF111D6, 0x0000000000000, 0x0000000000000, 0x3DBE71C5089B1, 0x2999C05E17003, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x4A23D771E9194, 0x4350C63197927, 0x0000000000000, 0x0000000000000, 0x2A607404E95BE, 0x3E368AD44CA21, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x3C7DC2C3F1150, 0x4A143301730B2, 0x0000000000000, 0x0000000000000, 0x25F148D9A4B74, 0x2805535657798, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x2D49CB9DED8AB, 0x386D93A0029A7, 0x0000000000000, 0x0000000000000, 0x54ECBFE3ACB4D, 0x5C10242AD0858, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x2A9CC801A5FA4, 0x5BF0650EBAD2D, 0x0000000000000, 0x0000000000000, 0x19433D12FC96E, 0x5458B7AD525DB, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x30B56A41476F8, 0x7970135993959, 0x0000000000000, 0x0000000000000, 0x2C27CFF70ADC9, 0x225E4012AC215, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x0B62B4FE3ED1A, 0x0A0CD099A987C, 0x0000000000000, 0x0000000000000, 0x0182271CB51B4, 0x2F69A707DA70E, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x023C01805DD77, 0x56D53642C4FDD, 0x0000000000000, 0x0000000000000, 0x4C353D05A1033, 0x33E9E25C80334, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x1BFFEA780B91E, 0x09AF281EC8006, 0x0000000000000, 0x0000000000000, 0x15F3101F1E3B2, 0x1002044D89575, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x7BF5480595E60, 0x34438A22AD4C7, 0x0000000000000, 0x0000000000000, 0x140EAEE93F4F8, 0x5EC80D3CA3476, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x025EF8E5E60B4, 0x50088E488F27D, 0x0000000000000, 0x0000000000000, 0x0AE6EFA5A0032, 0x2143580A3BC20, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x1252319789C69, 0x25D91FC28263E, 0x0000000000000, 0x0000000000000, 0x1C7F92B5C9B83, 0x7899A7900C833, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x4111794304B2C, 0x15BC34D67DE88, 0x0000000000000, 0x0000000000000, 0x122D455CC3AA3, 0x38C839A60A732, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x01495736B193B, 0x47343C2BD7176, 0x0000000000000, 0x0000000000000, 0x0089CF207DB4B, 0x52F97FCAC7C5F, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x430EA70922428, 0x66FD00B753509, 0x0000000000000, 0x0000000000000, 0x26E82EF62F27C, 0x077B3BDA2CC1D, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x04261442F60F9, 0x1F0647B838803, 0x0000000000000, 0x0000000000000, 0x0D59DC178B24F, 0x0231E36CB263A, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x706319191EDED, 0x6EB3A0FB9F350, 0x0000000000000, 0x0000000000000, 0x7BD6F3C100947, 0x7666B96AB9EF1, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x6204FE40E5D13, 0x796C05891B89C, 0x0000000000000, 0x0000000000000, 0x0DCABEC95875B, 0x08AB5F595E077, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x026C2A2291927, 0x21635478DC245, 0x0000000000000, 0x0000000000000, 0x2E2226A178AD7, 0x23A1F7E6F745C, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x1B58ADC599903, 0x32D5D4C013DB6, 0x0000000000000, 0x0000000000000, 0x6988B99FE1951, 0x7DE26C9407377, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x31E5908C6688B, 0x634F56F63A48E, 0x0000000000000, 0x0000000000000, 0x634094F98FA4A, 0x0F632A6924681, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x563560C200558, 0x2799EF5A76B57, 0x0000000000000, 0x0000000000000, 0x51B758E9AF653, 0x3E48FFC152261, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x7F5F4CDA3B3EE, 0x1F39D2FC232A6, 0x0000000000000, 0x0000000000000, 0x6363D332D53CA, 0x6D10B249C6858, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x553A751BC56DC, 0x65E1ED41A9558, 0x0000000000000, 0x0000000000000, 0x38F8B868BEF1B, 0x3253D6AA8C81E, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x146B27A6CE225, 0x0884E6123192B, 0x0000000000000, 0x0000000000000, 0x1A4E88B4544C4, 0x2D6A10469903F, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x55FEAF425C302, 0x2DBE976901FFC, 0x0000000000000, 0x0000000000000, 0x5D5C78F6BB720, 0x7E4E0D2B74A53, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x3435D52B5A86F, 0x145B4CD16AF90, 0x0000000000000, 0x0000000000000, 0x16BE4CC424733, 0x5398D20E6CD59, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x1335E55A2E4D6, 0x4CE87488ADC10, 0x0000000000000, 0x0000000000000, 0x6F03D4E4A32A3, 0x6D2CB2590A4E6, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x59511CD14E4FB, 0x0E262164E4C10, 0x0000000000000, 0x0000000000000, 0x437AF4C86ED72, 0x0E30FB9B4E3CA, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x2BE143CF0643C, 0x67B99D720EF0F, 0x0000000000000, 0x0000000000000, 0x562C67FE8D2C4, 0x4CF06F13B6BD8, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x3E10BEF3E2155, 0x205FD65A65733, 0x0000000000000, 0x0000000000000, 0x55F16B97A7AD0, 0x216E703E204CA, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x7CD39D04C04C1, 0x534E0B1E15F5F, 0x0000000000000, 0x0000000000000, 0x6B436B2212989, 0x21DB0C2E02F25, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x3358569CB2828, 0x5317A7661F584, 0x0000000000000, 0x0000000000000, 0x30354A36AC2DA, 0x5055C4DC5393F, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x230765B6EA3E5, 0x258B7B49E0357, 0x0000000000000, 0x0000000000000, 0x3AA2D22D71D69, 0x3ADF1DB6CEEF0, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x782CADA72AF74, 0x38F85D141219F, 0x0000000000000, 0x0000000000000, 0x7702BA8611079, 0x02F7DB46D419E, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x4C0DC89369440, 0x670D85DF324E0, 0x0000000000000, 0x0000000000000, 0x5C1A11517A358, 0x17A0308392E5B, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x41204734B5F00, 0x13B2009EB516F, 0x0000000000000, 0x0000000000000, 0x58C8F445B9031, 0x1D8E0E6FF6A20, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x414910283D69F, 0x4570109B2B5D2, 0x0000000000000, 0x0000000000000, 0x4D9C47B061641, 0x754ED617EA2FA, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x200E054EDC928, 0x069DBA4F36EF5, 0x0000000000000, 0x0000000000000, 0x230AC666E7577, 0x2B01A0584F739, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x7AFB3A851BAD3, 0x586312C8E9432, 0x0000000000000, 0x0000000000000, 0x121C91D7B2F70, 0x18675149255B6, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x62638F017BCFE, 0x4BDE1EAB25895, 0x0000000000000, 0x0000000000000, 0x4955AAEE29036, 0x32DDCF0BCE77A, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x517546D4C2E6D, 0x0205CB5D1182A, 0x0000000000000, 0x0000000000000, 0x654B102360411, 0x0F114C5F15444, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x4A0CF9B393BA9, 0x0E0668BB1EDD3, 0x0000000000000, 0x0000000000000, 0x0B3E8542B61A1, 0x2D7D21E76C888, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x210166F1D7EFC, 0x109F9B5767CE3, 0x0000000000000, 0x0000000000000, 0x603563FC85410, 0x104A2C93A2F83, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x33A3886655180, 0x50F35EFEC4F1D, 0x0000000000000, 0x0000000000000, 0x373691111C814, 0x18F97137FFA0C, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x07A8457DC94F9, 0x0E724620967B3, 0x0000000000000, 0x0000000000000, 0x40CB72506C7F1, 0x4B09ACA27E4F5, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x72097D8EE573E, 0x4CA1445F05FFD, 0x0000000000000, 0x0000000000000, 0x488438C06E4DC, 0x09C63B42D5D5A, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x103F3CE01F629, 0x2C08AEA6D106C, 0x0000000000000, 0x0000000000000, 0x304A1381274EC, 0x51758833E3796, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x2505964B4DAF9, 0x12A3DC3A2DA86, 0x0000000000000, 0x0000000000000, 0x39BEF14608FA2, 0x343AC5ACFE7FD, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x77EE40546C085, 0x035CF0D025AB9, 0x0000000000000, 0x0000000000000, 0x4DFD167076949, 0x4D150506C715D, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x4AE6109397427, 0x3E6D31A42DB96, 0x0000000000000, 0x0000000000000, 0x77F92948034C9, 0x3EACEDDBED34E, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x236862223CF7F, 0x403336266DE57, 0x0000000000000, 0x0000000000000, 0x2C50C5202BC30, 0x26637C4FDC89D, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x73DA62597C338, 0x60B5F62A0DD19, 0x0000000000000, 0x0000000000000, 0x0C92B92B6DC45, 0x41BF6C776AA11, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x1593F6E1ABA08, 0x7F6006FA8E826, 0x0000000000000, 0x0000000000000, 0x63BF9FE92B7F0, 0x38F667B509C76, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x1ECAFAEC05C82, 0x24496E0E468D1, 0x0000000000000, 0x0000000000000, 0x5A99AA477FFA6, 0x26124CC0CE313, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x44F398363A505, 0x53AFD07110CAB, 0x0000000000000, 0x0000000000000, 0x3E7A94606054D, 0x49B9228F88975, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x7474CB8E34A38, 0x12CC8446973C3, 0x0000000000000, 0x0000000000000, 0x417DF2726C7AE, 0x3B9B611DEC866, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x43C43F8A3C7CE, 0x011A83979AE68, 0x0000000000000, 0x0000000000000, 0x2FE3A727F2F1E, 0x05EC4108A313B, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x71FF552FBEBB6, 0x44EDF71C60674, 0x0000000000000, 0x0000000000000, 0x7CB6E636A9822, 0x4BB5101B18E0F, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x7D191C9EDD9A3, 0x6711D071658A8, 0x0000000000000, 0x0000000000000, 0x7D4CA97F0018D, 0x1230F1687C89B, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x34377D74CC8D8, 0x13C594E06F4B9, 0x0000000000000, 0x0000000000000, 0x78C2875DDF298, 0x33CF48A2364F8, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x1753CCB6A3DD7, 0x22A7CB187A196, 0x0000000000000, 0x0000000000000, 0x1009904CF564B, 0x6C058A6D55E66, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x46BD2484AF657, 0x6FB29862030DE, 0x0000000000000, 0x0000000000000, 0x7A5BE9C703ACE, 0x3493E2993CC15, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x00CB1ED8D8196, 0x304AAA231D925, 0x0000000000000, 0x0000000000000, 0x6449A0839ED91, 0x2A58C4F39B418, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x6DAC3B48991C2, 0x658B54C16C882, 0x0000000000000, 0x0000000000000, 0x1412021C64F6C, 0x09D239A7CCDCE, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x0BDB57735F75E, 0x029DF3CEACDC6, 0x0000000000000, 0x0000000000000, 0x731D395D549DB, 0x391CBAD6AF4EF, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x6B0FC3D6DA707, 0x1A91F1D06D0E4, 0x0000000000000, 0x0000000000000, 0x10640C951B36F, 0x2F59168E9EC40, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x082E997B025DA, 0x1C263F0D5617C, 0x0000000000000, 0x0000000000000, 0x472D3BC74CA22, 0x0EE1F247D7354, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x30C808FB96DA5, 0x760D783FF8DB2, 0x0000000000000, 0x0000000000000, 0x033FA03D9772D, 0x2A623B15C40CE, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x369CC0BC81876, 0x47A67CF712839, 0x0000000000000, 0x0000000000000, 0x76B188A9B0CA0, 0x2535A64FC4FFA, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x6C7631341D7C4, 0x30A9F0FC183DE, 0x0000000000000, 0x0000000000000, 0x4E1D13E2B907E, 0x501AD5FCFBD6D, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x0FDF9A0B52152, 0x74C944AAAA03B, 0x0000000000000, 0x0000000000000, 0x4FF48F30724D3, 0x57F4026285F25, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x7ABB5C04F801B, 0x18886EEB08BDA, 0x0000000000000, 0x0000000000000, 0x2120EA68DA567, 0x34CBC0C246C23, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x4A6830F3A21CB, 0x5171857B1B1C3, 0x0000000000000, 0x0000000000000, 0x6C949413E9AA3, 0x5FCC1A6138D8C, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x26AD349664FA6, 0x62D2BB2DB7A85, 0x0000000000000, 0x0000000000000, 0x43B28B1877178, 0x133427E4E1C9B, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x1ED8081C894CD, 0x76768E0808433, 0x0000000000000, 0x0000000000000, 0x0F4D133604B48, 0x0A38C5D625FF8, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x4552284FC0500, 0x43382CE3C4E44, 0x0000000000000, 0x0000000000000, 0x3F0057706E12B, 0x350CE8730249E, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x376F7FFA5546D, 0x1C6B20FA10FF0, 0x0000000000000, 0x0000000000000, 0x3388E808A709D, 0x223E228EDD178, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x294E239427F3B, 0x090999B298D1E, 0x0000000000000, 0x0000000000000, 0x0C573EF9ACE84, 0x1F39C75C4B831, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x74273D71F4B4E, 0x0675E1637EED3, 0x0000000000000, 0x0000000000000, 0x2E3C7299B5684, 0x7B566BE087266, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x68BA1FE40900A, 0x23FE2F658999F, 0x0000000000000, 0x0000000000000, 0x768D80DC2A6AA, 0x5CAD4197D822E, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x70638A4BBCD50, 0x25E4585117325, 0x0000000000000, 0x0000000000000, 0x65C1FC97D056E, 0x264B591A55E64, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x3BAE4A85D1FEE, 0x04348DA90DC4E, 0x0000000000000, 0x0000000000000, 0x28DA40B0F9360, 0x4412C3AA8B87A, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x30F01759B1AB5, 0x79F1B1F231B39, 0x0000000000000, 0x0000000000000, 0x161793974E29F, 0x416410926B51C, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x44126D5C604ED, 0x1C049EAB5F41F, 0x0000000000000, 0x0000000000000, 0x545C075CD0137, 0x207EA5693D413, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x5CEA421931A62, 0x6E91AEF45E704, 0x0000000000000, 0x0000000000000, 0x7C24993EAB6CC, 0x7DEEF694ABCEA, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x0212A9035AA7C, 0x2307531EF2624, 0x0000000000000, 0x0000000000000, 0x5E02BD8B1E5B5, 0x0F1FFD4F255D8, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x7A66D0A0C6881, 0x55547D1896E6F, 0x0000000000000, 0x0000000000000, 0x0041CB6F0D6CC, 0x657308505197D, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x4211FFE904F44, 0x096984BDF1F8B, 0x0000000000000, 0x0000000000000, 0x3E5157AA8022C, 0x4820382310B2A, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x13D7E257B7138, 0x72426D98206CB, 0x0000000000000, 0x0000000000000, 0x65B8333251F5A, 0x624CAABF12C1B, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x144348E6C728D, 0x0D2401EDD23F9, 0x0000000000000, 0x0000000000000, 0x44FBACBE028D1, 0x1C20B6F7866EE, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x5663268829158, 0x371110111394D, 0x0000000000000, 0x0000000000000, 0x6BA93B178DDE8, 0x6095F56F7E27F, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x7054142617291, 0x7F99178EE1FD5, 0x0000000000000, 0x0000000000000, 0x242DC2641447E, 0x00A23CBDE9758, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x2CE9DC40D5DE6, 0x36B6491F7279A, 0x0000000000000, 0x0000000000000, 0x41F3A1EDDB783, 0x0111ACD965568, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x724406930C41A, 0x77933EDB7CA23, 0x0000000000000, 0x0000000000000, 0x1F7C711C13882, 0x796841111A8FF, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x0E5C53B210C5B, 0x18ED813A75F9D, 0x0000000000000, 0x0000000000000, 0x654DE247B61C4, 0x5A7FDD8665C3C, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x74FA8FA8992C1, 0x19753F6746FAD, 0x0000000000000, 0x0000000000000, 0x1E71685290DCC, 0x1BC4BDB2D15B9, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x110A919748705, 0x128AC14DA529E, 0x0000000000000, 0x0000000000000, 0x2B019BEE4218F, 0x1B1F0EBEA4A14, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x3A6B96CCB4840, 0x6983504709452, 0x0000000000000, 0x0000000000000, 0x4EDC25CF5ED6F, 0x56BCD70397C59, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x035F5AE4170AB, 0x0E690802AE84A, 0x0000000000000, 0x0000000000000, 0x36C8250262A4A, 0x50083E05332A0, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x458899BF118E3, 0x12CD335A27196, 0x0000000000000, 0x0000000000000, 0x132B40A665A30, 0x39AC9E2780330, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x63757E7BFE3A0, 0x2A6868B872DE8, 0x0000000000000, 0x0000000000000, 0x5F91A0ACAFC91, 0x49C1B8C0BB155, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x4DD244E0AB306, 0x080BC366A2558, 0x0000000000000, 0x0000000000000, 0x3503D66B69E5F, 0x29CFB20BB567D, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x60E5E440AB434, 0x48140EC188AC9, 0x0000000000000, 0x0000000000000, 0x4894AA855C4E0, 0x60A9F27A8FB6E, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x12730855259EC, 0x419D4C52B93FA, 0x0000000000000, 0x0000000000000, 0x24CE9771A8FCA, 0x7E6410FEEDA54, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x23E7562E2BF98, 0x3FA16B7DEB7D2, 0x0000000000000, 0x0000000000000, 0x29861C62EA73E, 0x62DD9F8DD44B9, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x7EC3F9A8CB4D4, 0x30E0AF0362D0C, 0x0000000000000, 0x0000000000000, 0x4B9A3C355003B, 0x21856E3A7ADF7, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x0FC3E4F833340, 0x7500028AA4391, 0x0000000000000, 0x0000000000000, 0x739956BD3D705, 0x773F5064D7444, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x4C344FBCDA9E2, 0x1875EDB3E200E, 0x0000000000000, 0x0000000000000, 0x3267778A95831, 0x24071C2A369EA, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x632DB0A375D20, 0x36180D667D833, 0x0000000000000, 0x0000000000000, 0x2E1C9DBF8D6A6, 0x48ECA69332490, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x3C892BA2DF32B, 0x48CBE2546B37D, 0x0000000000000, 0x0000000000000, 0x0E737032BE1D5, 0x23FA1ED3710E3, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x704439388498D, 0x11D8E77D3A1C9, 0x0000000000000, 0x0000000000000, 0x58B277FE78968, 0x7EFB1338C9A1F, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x2B355AE8C344D, 0x70B0E386127FE, 0x0000000000000, 0x0000000000000, 0x73564D403358C, 0x5CAB54F5C62C7, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x5B43E3049A76E, 0x793EE3FC79F45, 0x0000000000000, 0x0000000000000, 0x06EFF0669CA6D, 0x3C633FFCD21EA, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x2BEE4554BFF97, 0x0FD09C819E2B1, 0x0000000000000, 0x0000000000000, 0x6FE4213228D23, 0x254EF9827CE60, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x6253842737C17, 0x56E979DDE9763, 0x0000000000000, 0x0000000000000, 0x0370E7F497D31, 0x36DFD7435D7D8, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x2E369B35A4ACC, 0x1D3841EF26C27, 0x0000000000000, 0x0000000000000, 0x0B867147B8EE0, 0x5947D072C01AC, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x00390E2196A31, 0x044AE34AC570F, 0x0000000000000, 0x0000000000000, 0x490279ABD0637, 0x426C007214A9E, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x2046B67AA5AC8, 0x795129E834486, 0x0000000000000, 0x0000000000000, 0x279C1EAA4879F, 0x3279F2C100E5A, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x6F9F0906120B3, 0x3C6B97C7B5260, 0x0000000000000, 0x0000000000000, 0x0AE6CB390C1B3, 0x44EE004E665A1, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x561F5D4AF9BF6, 0x212E9A1A69D57, 0x0000000000000, 0x0000000000000, 0x7FBADC54DF41A, 0x2A7988B639EF9, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x7973813E48F30, 0x28DCB952C01BA, 0x0000000000000, 0x0000000000000, 0x6D32DA61515E6, 0x66346B01E402E, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x069AD7CE5DD30, 0x6AEB9C48A94B7, 0x0000000000000, 0x0000000000000, 0x358BBE462A782, 0x50F364233837A, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x37D664105F816, 0x31356E71B5F54, 0x0000000000000, 0x0000000000000, 0x318CBA623B6E4, 0x302ED23FF6E8D, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x006DEECFE4DB2, 0x58F0D2EF678B2, 0x0000000000000, 0x0000000000000, 0x7B82B574D76FC, 0x7B9B040058893, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x5F907B5E1A633, 0x6C2FB3740E506, 0x0000000000000, 0x0000000000000, 0x3EBF70378CC1E, 0x1995B89981A17, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x6DBE70A3BFED3, 0x0C89B0B601B62, 0x0000000000000, 0x0000000000000, 0x6ACD3F29B0E36, 0x29CB7C44DE582, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x323C2DF2B9590, 0x518105F2F1E20, 0x0000000000000, 0x0000000000000, 0x2FF4B9FC7CF2E, 0x2ADD149DDC2D1, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x37BF33AEE8E7D, 0x026A8364DCAA4, 0x0000000000000, 0x0000000000000, 0x3D704CFA6EFB2, 0x1DB81680F2C07, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x7205E2C331753, 0x34990EFC1BD92, 0x0000000000000, 0x0000000000000, 0x67E62742D0AFF, 0x1C2B1E90282AA, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x2F7F5D9B313DF, 0x0C29DA7349DDB, 0x0000000000000, 0x0000000000000, 0x0C767639F3074, 0x1AC46DD22D2F3, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x54DD89ECEDF9F, 0x4773874AF353E, 0x0000000000000, 0x0000000000000, 0x4CFFBAD9F1FA2, 0x57B8D08E40EBA, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x0A07898F0FFBB, 0x15CB37A863830, 0x0000000000000, 0x0000000000000, 0x74AF7C0A7AFFE, 0x1FB9E89633173, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x41F454F90433B, 0x01FB15DC6DA91, 0x0000000000000, 0x0000000000000, 0x316D4C102835D, 0x4C8A71F87F0AC, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x7F6EDB633161C, 0x6736E70CEA661, 0x0000000000000, 0x0000000000000, 0x036BA63F52DD9, 0x6F9C55C02C161, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x0EF2B783BF99F, 0x6D74CB11F617F, 0x0000000000000, 0x0000000000000, 0x0D8B6100C596B, 0x3C49E2BAEB1F0, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x47004637DBFC6, 0x3BA6463B539AB, 0x0000000000000, 0x0000000000000, 0x6CFCE4C339B97, 0x1DC0DC986AFD3, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x75A6E48413F5B, 0x65E8E44DC2DB6, 0x0000000000000, 0x0000000000000, 0x5155F39760D85, 0x65A918CBAC603, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x185E1D2D6A5A9, 0x045BD777579AE, 0x0000000000000, 0x0000000000000, 0x65D07072FB305, 0x28E9D4972DE83, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x01395D4A8724D, 0x373D796769D0E, 0x0000000000000, 0x0000000000000, 0x2D78E370C80D5, 0x0118AD3EEBD3B, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x617FCFCF60F08, 0x12DDD9950CB4C, 0x0000000000000, 0x0000000000000, 0x2AB1983A76B98, 0x2C04D4347347C, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x2ECFBF91DFD8A, 0x6E288CDA73968, 0x0000000000000, 0x0000000000000, 0x02BF9937721B9, 0x616C97E1DCE99, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x66C72482F0452, 0x6733AAFEA560C, 0x0000000000000, 0x0000000000000, 0x062BA918ED2D8, 0x136247EB11F7F, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x7D7D5556EA483, 0x3CF78422C13B0, 0x0000000000000, 0x0000000000000, 0x6EA5D2162D1E8, 0x036C54E0E742C, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x7B37BD9000495, 0x123296A01614F, 0x0000000000000, 0x0000000000000, 0x110F6CC3CACB3, 0x311708877F503, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x7ECFC7A40B582, 0x2DB14CC7473CD, 0x0000000000000, 0x0000000000000, 0x777A318E4C518, 0x05C94D1805668, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x7833F94ADA6B0, 0x08770A670AC64, 0x0000000000000, 0x0000000000000, 0x7472A172BCB8C, 0x0B45C4160FFC1, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x43966CFD18825, 0x10E2ED972C98D, 0x0000000000000, 0x0000000000000, 0x03A1124655358, 0x7AFAEEA96F42E, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x133FF9B526727, 0x64D6771E9BC63, 0x0000000000000, 0x0000000000000, 0x2A4C1719C1DA5, 0x2EE2763DA73FF, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x1FB53AB776B7F, 0x333F877CF9D2B, 0x0000000000000, 0x0000000000000, 0x46EC9F8BE64AA, 0x3C4D4ACC8CB96, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x5C5A8BC8E14FD, 0x1A6A8797D4612, 0x0000000000000, 0x0000000000000, 0x4E4B4503D7082, 0x22E66648C6686, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x4387BF3062053, 0x3964C4C486A04, 0x0000000000000, 0x0000000000000, 0x41F5F75C7F269, 0x3E496DF5DE970, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x3DBCBBE8742B2, 0x3E51F3EF322D9, 0x0000000000000, 0x0000000000000, 0x39E220A73A6D1, 0x4CA3009FBAC62, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x0BDDAC8AC647C, 0x5FB1ED62BBDE5, 0x0000000000000, 0x0000000000000, 0x4301DB4BAC28A, 0x3903F7E799BB3, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x0CC79D0C984C1, 0x0A0D523183931, 0x0000000000000, 0x0000000000000, 0x419F1652C4C94, 0x26CD0230008BD, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x13C88B37BBE08, 0x030ED5FBAF4F1, 0x0000000000000, 0x0000000000000, 0x32E392F254185, 0x62E325989BE3B, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x6D050B4FC93A6, 0x0E49F780AC70B, 0x0000000000000, 0x0000000000000, 0x1AF1779BC803C, 0x1A7ECD8AEBD63, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x16E530DB53F91, 0x050CADCE6F434, 0x0000000000000, 0x0000000000000, 0x1F7629186BDD9, 0x4B312AC833105, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x25AFF63E34D39, 0x31A95C8EAE14B, 0x0000000000000, 0x0000000000000, 0x189EECD7CAE98, 0x71C4F2BD324EC, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x6193AE1E9C93E, 0x39896F5CD0A70, 0x0000000000000, 0x0000000000000, 0x0BE96BA7E23AE, 0x6366E705B5A40, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x289CDBD05A291, 0x127DC584B23A3, 0x0000000000000, 0x0000000000000, 0x14BAEE2D8F5D3, 0x0199940174D11, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x6D9E2BFBF7357, 0x026BC15C89530, 0x0000000000000, 0x0000000000000, 0x3DD83F0490237, 0x7B9088C995C8F, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x71CA11E6F3B43, 0x1CFC75C5ECF6C, 0x0000000000000, 0x0000000000000, 0x308357DF0D5DD, 0x1D52B9764DBD4, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x319E75535B0D0, 0x000A7EE53362A, 0x0000000000000, 0x0000000000000, 0x3423E9B89372C, 0x591CE2622323B, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x017B07B0547EA, 0x4FAC4BFEF59D6, 0x0000000000000, 0x0000000000000, 0x51B518FBFE32D, 0x6DADDD2C861D2, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x236A311F48F5E, 0x052A8D2472E6C, 0x0000000000000, 0x0000000000000, 0x7A238148E06D4, 0x32E045796D92B, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x0820F1120D8E3, 0x5031EDE43019E, 0x0000000000000, 0x0000000000000, 0x79EFEAAFDB97B, 0x09ED10710D211, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x3A1A7E1502002, 0x6C831778FDDB1, 0x0000000000000, 0x0000000000000, 0x5284D324793B2, 0x5F22D8D0B9BFF, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x78972BD4DB5F6, 0x0DEFD706A0CE7, 0x0000000000000, 0x0000000000000, 0x6BE422C44CBDB, 0x26FF2549154B2, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x5572D18697F31, 0x18E20F09C9CC1, 0x0000000000000, 0x0000000000000, 0x026CEE0A3261B, 0x2F009B6F54908, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x260F4BF458867, 0x2F3102F20693D, 0x0000000000000, 0x0000000000000, 0x766CF9C33C3C8, 0x224A5A35498A5, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x6A9DDEEBDA27E, 0x51B5EDAE4EE44, 0x0000000000000, 0x0000000000000, 0x371DD8F4A7E22, 0x1C83D7735E177, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x566E2112D87CB, 0x380C5C0622371, 0x0000000000000, 0x0000000000000, 0x74AD554DB0CBB, 0x3107F95E72252, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x6DB630DF833F3, 0x714ACE56AA693, 0x0000000000000, 0x0000000000000, 0x478C733BCA235, 0x4FD4FD476AD5B, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x4DD2858C8935E, 0x0CF556F99C525, 0x0000000000000, 0x0000000000000, 0x4865FA3D8A742, 0x1BF8EEADA1E12, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x15C83F981E7FA, 0x15C01239D6334, 0x0000000000000, 0x0000000000000, 0x0E8C2C8E99770, 0x6F579304E76F0, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x2E4185909633A, 0x552497843C39A, 0x0000000000000, 0x0000000000000, 0x39FD394AAAD6C, 0x6F6168014B152, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x615C67CD6BFD6, 0x496AB88DB72AE, 0x0000000000000, 0x0000000000000, 0x457FF880D6569, 0x3C967F31F2678, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x32DA73D2E6577, 0x322DFD9DAAC99, 0x0000000000000, 0x0000000000000, 0x551A94C8E53C8, 0x25A6930CC7ACB, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x2CE8759B67A58, 0x63613AC3C30F9, 0x0000000000000, 0x0000000000000, 0x0A64FDA5FF9C2, 0x3E4A7C8B752AC, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x66F11DB53FEAC, 0x165061BBBB7AC, 0x0000000000000, 0x0000000000000, 0x5B4370BB90E0B, 0x3670CD9AE7FE1, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x6901BC2D23133, 0x1C8F2CA3A7C4A, 0x0000000000000, 0x0000000000000, 0x0676F4D35F111, 0x4C3213C0965B6, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x705D3F6B24475, 0x020EA383AEB44, 0x0000000000000, 0x0000000000000, 0x3A7B824579B89, 0x50D2C722F8FFB, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x03833E3103060, 0x4B2719AC151B7, 0x0000000000000, 0x0000000000000, 0x28B214604D493, 0x58716E65C4E58, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x5B4F1CB275C87, 0x016B2EB17C060, 0x0000000000000, 0x0000000000000, 0x7AD4BED56C2EA, 0x432C28949A1BF, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x791722F4DEB51, 0x6C35C18197FEE, 0x0000000000000, 0x0000000000000, 0x168AD2E1BC15D, 0x24409E467C09F, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x3F71ECE7E126E, 0x0F8EF132174B8, 0x0000000000000, 0x0000000000000, 0x52B1A78BFE222, 0x263C2318015D7, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x0DFAEE520D1D3, 0x19116DCEBB617, 0x0000000000000, 0x0000000000000, 0x48183EB261EBF, 0x794A64D4156C2, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x3F4B3FDB46DE2, 0x3E9F4084EF190, 0x0000000000000, 0x0000000000000, 0x12D2A88E0ECD4, 0x6860D2F446285, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x6A5D0A2178E7E, 0x5F3EAD36871A8, 0x0000000000000, 0x0000000000000, 0x7EAF01931DBE9, 0x49B5EBB11B98E, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x2ADBE92476BC9, 0x0A2466A4C650D, 0x0000000000000, 0x0000000000000, 0x7D67DF702B234, 0x00955B7CE3B38, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x3AFE5C951B984, 0x10EA15E3D5D5E, 0x0000000000000, 0x0000000000000, 0x0B34ABD78AB79, 0x3585E7777E899, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x04E36A2C444DE, 0x1FC2EB7D79F00, 0x0000000000000, 0x0000000000000, 0x688E600F3B44C, 0x29A0BF0F43EFB, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x5CD056EFEEFFB, 0x0BFD1BB9523EE, 0x0000000000000, 0x0000000000000, 0x5D8AB12C46665, 0x5BAA10F917FC7, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x5CA9290400AF8, 0x316DC9B915245, 0x0000000000000, 0x0000000000000, 0x5D076FCCB12B7, 0x73CC6EE9A709E, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x28219958A5EAC, 0x1F6C8C3D7766F, 0x0000000000000, 0x0000000000000, 0x61BF65956D624, 0x12A0157540066, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x0A015CCE3AD45, 0x2FC56CE16775A, 0x0000000000000, 0x0000000000000, 0x7063837ED1CCB, 0x2AD0A30AAE24B, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x7EDB9E74C52AA, 0x581248F85A569, 0x0000000000000, 0x0000000000000, 0x7D9F639084D77, 0x6A27D92557755, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x762C54728DF84, 0x0685F686A411E, 0x0000000000000, 0x0000000000000, 0x7AFC845C90D53, 0x223B2E7FF5CAA, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x672C4749E34EF, 0x10D57AF9415B3, 0x0000000000000, 0x0000000000000, 0x6BD965EFD325F, 0x61D9FEE265AC0, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x006ED72F808AE, 0x0BC7A685474F5, 0x0000000000000, 0x0000000000000, 0x4BB6272A9B558, 0x38445903F4479, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x037C18DBB1ACD, 0x7BE95C7D2911D, 0x0000000000000, 0x0000000000000, 0x673D63255DA6F, 0x2333A633E8CC3, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x62ECD0A71489B, 0x080C1D8623197, 0x0000000000000, 0x0000000000000, 0x56E705EF50BD3, 0x6BE6FA95127D9, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x486E27BB06E09, 0x44BA5AB7327C0, 0x0000000000000, 0x0000000000000, 0x0298FFA4F0E8A, 0x290FD6ABDFB9F, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x7858ACB207A36, 0x1CF670C3D74A3, 0x0000000000000, 0x0000000000000, 0x0BEA65C8D74C3, 0x1D78884C8A070, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x59B8E506403C9, 0x65164924DC1BA, 0x0000000000000, 0x0000000000000, 0x2FE02D9E2EE77, 0x11C25C6180163, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x4BBFF067E6A6F, 0x209040C91C18A, 0x0000000000000, 0x0000000000000, 0x6932B998E8A78, 0x44ABF840E0305, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x546B28C2AF5A4, 0x693F262474FD9, 0x0000000000000, 0x0000000000000, 0x0DDA4CB708A9B, 0x44A999F985A31, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x374A2294584B1, 0x429875B3DA5FD, 0x0000000000000, 0x0000000000000, 0x0A5418F0EC739, 0x089CACDA98573, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x72A08788238FD, 0x0AFD0F854F94F, 0x0000000000000, 0x0000000000000, 0x6410FB0897E77, 0x684A33C23F4DA, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x696943F498D59, 0x04720AC77AE46, 0x0000000000000, 0x0000000000000, 0x78A5034E91813, 0x265D76BB6B159, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x41D10B794EDAE, 0x090AF05FE967E, 0x0000000000000, 0x0000000000000, 0x2A493C1FA0552, 0x3A2C31DC2D7D3, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x1162CC7DE7258, 0x75B70579B63EF, 0x0000000000000, 0x0000000000000, 0x076EDD89B1016, 0x42F1F5976230A, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x587BD540E1604, 0x50C1D2ED3B5D2, 0x0000000000000, 0x0000000000000, 0x7E9D9E6EFEDC9, 0x4F0540AEF29BE, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x424F651982A22, 0x5573F0B80BABA, 0x0000000000000, 0x0000000000000, 0x186E364B7B0D2, 0x4DB7A53582E9E, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x00F6076F81DDA, 0x66E73D633849C, 0x0000000000000, 0x0000000000000, 0x44C314AF72F72, 0x48BEF7F2887F1, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x73DDD47D06372, 0x1A95443800973, 0x0000000000000, 0x0000000000000, 0x032FC5E215757, 0x2F71089B3909A, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x08883BD7F1123, 0x6652DAB5E8CA3, 0x0000000000000, 0x0000000000000, 0x3CD44D7B09871, 0x4629DE6FFF755, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x7435F285F9EF4, 0x676F0F713E54D, 0x0000000000000, 0x0000000000000, 0x5F3AB7B18C7AC, 0x4596D8B7DA94E, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x615E4B217FD02, 0x414B6B02AC7F1, 0x0000000000000, 0x0000000000000, 0x5D189DBB49987, 0x247C66721BFFE, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x01AF3DCBF267E, 0x6E22512BBF5F7, 0x0000000000000, 0x0000000000000, 0x333B0DE3D7128, 0x4213119E970E7, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x7A1FD437B008A, 0x374511AA8B342, 0x0000000000000, 0x0000000000000, 0x35B5F64F4E137, 0x467419AD9638C, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x2BF768684E1A9, 0x15A3F20D3156F, 0x0000000000000, 0x0000000000000, 0x3EEA9650A6183, 0x22666D9E54244, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x7892AD3FEFD6F, 0x6D3762F7C779F, 0x0000000000000, 0x0000000000000, 0x4F10FA4D30EEF, 0x2E3BB108B7E17, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x1AD2B6167840C, 0x51EC5978C6637, 0x0000000000000, 0x0000000000000, 0x59774A0999505, 0x276D943E22BDC, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x5295095590C0B, 0x1B9F69FFEE6A1, 0x0000000000000, 0x0000000000000, 0x65E5A86F4BB0F, 0x4F4FEBB64378A, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x1E72750FD9B48, 0x1727585CD715D, 0x0000000000000, 0x0000000000000, 0x14922F1607B25, 0x5D993C1CA45C1, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x61C9DDFD21ACF, 0x5E08B9DA3F94E, 0x0000000000000, 0x0000000000000, 0x3CF4B216C957B, 0x080EE7C043E16, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x345CD1E2D01B5, 0x16E6E46A5F144, 0x0000000000000, 0x0000000000000, 0x19AC9911B0C7B, 0x2F45BB38987CC, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x2D06A2BD7EBE9, 0x0C93B3967AD76, 0x0000000000000, 0x0000000000000, 0x5CA3C1FD66E89, 0x1C2D8471AC983, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x526F4B8D85E69, 0x0AB4D69D86668, 0x0000000000000, 0x0000000000000, 0x4595D58F32428, 0x3D8379813B087, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x5CBBE1430C50E, 0x27C9F903AE05A, 0x0000000000000, 0x0000000000000, 0x5D33793A97E4D, 0x3C729E2405ADC, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x77181A6DCAF30, 0x2AA136EB0D07D, 0x0000000000000, 0x0000000000000, 0x7DE1475922F04, 0x4582D3D11572D, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x24C9226ECE293, 0x29A0EDF1D5AEB, 0x0000000000000, 0x0000000000000, 0x322D8719975A8, 0x4362EA966F754, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x7B74C04972E12, 0x1643141CA12C9, 0x0000000000000, 0x0000000000000, 0x766172DBFC2AE, 0x3673A17D99555, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x36EF545FDF913, 0x67FFB11EB1F04, 0x0000000000000, 0x0000000000000, 0x2B0A10C282DD7, 0x74BCAA2A71137, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x36ECD284F7918, 0x518F39BA5D132, 0x0000000000000, 0x0000000000000, 0x5D07852F6C7D3, 0x2961CBCDCCAAC, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x5B6964F9E8E1C, 0x79E47FD131E28, 0x0000000000000, 0x0000000000000, 0x1075FE8E64EB0, 0x1DF34D849A61C, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x5125F53F8B9D2, 0x2185959B84C0A, 0x0000000000000, 0x0000000000000, 0x02E9BD8564E0B, 0x2633D4BBF1D80, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x65E8B0C5D1028, 0x602903FD5A06D, 0x0000000000000, 0x0000000000000, 0x0D07EC24C2835, 0x00AE3560FE255, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x40BE2662ADF47, 0x180D47A390881, 0x0000000000000, 0x0000000000000, 0x64E4E48C17E36, 0x232DD350EE129, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x169E7855A5A84, 0x183670491D8E5, 0x0000000000000, 0x0000000000000, 0x34F43D518FA2C, 0x78A7B15E37BBB, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x4565FFEFB9D7D, 0x5886B48A81EC0, 0x0000000000000, 0x0000000000000, 0x6E7D10241F620, 0x36BB8590ED74E, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x72FD0048A10A8, 0x29234FF80565E, 0x0000000000000, 0x0000000000000, 0x7A61B722C89F0, 0x2D15B3E0A1EB2, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x2CFAACEB3F4F9, 0x33F5AFCC18DC7, 0x0000000000000, 0x0000000000000, 0x7828F7E52BF38, 0x57137EA8E7647, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x7A80008277612, 0x4C86431263C26, 0x0000000000000, 0x0000000000000, 0x02342DB595EF7, 0x1CF8DB4DEE391, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x24B54BF75B0B2, 0x0BD498D71BBD6, 0x0000000000000, 0x0000000000000, 0x56040BE1C35B9, 0x2047D1845A029, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x64413C4CFA2A5, 0x6EA7EA6C7109C, 0x0000000000000, 0x0000000000000, 0x2E6D20CC6FB31, 0x4D11E21849F6E, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x202953DABF142, 0x76D4327693B9C, 0x0000000000000, 0x0000000000000, 0x221DD722C3F6F, 0x771AB0798AEF4, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x617FD7C426D9D, 0x140A4FE6C0812, 0x0000000000000, 0x0000000000000, 0x7311DFFAEC51B, 0x7C61BD12A68D2, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x7B15D5EB995C2, 0x69158F6F0A878, 0x0000000000000, 0x0000000000000, 0x6EF9560DA55DC, 0x77B5CDFEFECC4, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x27878CFDC388B, 0x5EAC81349177D, 0x0000000000000, 0x0000000000000, 0x5289C12CDD6F8, 0x746931588FB8E, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x756B39CA341DF, 0x1D66082716E64, 0x0000000000000, 0x0000000000000, 0x735D3C2EBF0B8, 0x30BCC6572C579, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x421719D790AA2, 0x0D39C5A852FB0, 0x0000000000000, 0x0000000000000, 0x4F436577D4ED6, 0x2F98A6A8A892C, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x2D2B83C0E65CB, 0x1EACEC6618EC4, 0x0000000000000, 0x0000000000000, 0x76DC31C0D5961, 0x23C8E8F9B9B68, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x58428BD4011EF, 0x12326A61B8BE6, 0x0000000000000, 0x0000000000000, 0x0BCFD18F4ECC0, 0x4A85F49CA1A7D, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x549E03A5EF800, 0x24390C044C1A6, 0x0000000000000, 0x0000000000000, 0x46CEBB57162C5, 0x1F2B6CE2645FC, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x6CD3BEF842044, 0x37412117267BF, 0x0000000000000, 0x0000000000000, 0x2FEC4F9123D37, 0x3EECD6EBB2D6E, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x4B2544E948D3C, 0x0862B53A579A7, 0x0000000000000, 0x0000000000000, 0x7658E5D19B60D, 0x2244C890C8647, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x311C9037499E0, 0x45EEEE7A7C75F, 0x0000000000000, 0x0000000000000, 0x02D7826336318, 0x42ADAB72F9CD2, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x55E361B84FD2F, 0x19DEE7BB8C7C4, 0x0000000000000, 0x0000000000000, 0x127A1D8E5B775, 0x28EB22F0E5684, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x0FD4531450185, 0x4203F1D6EFE47, 0x0000000000000, 0x0000000000000, 0x56FD83B94E4CE, 0x4D53159C85462, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x08DA2A5ED528E, 0x7D4B247CD9DEE, 0x0000000000000, 0x0000000000000, 0x7F11BD0B45131, 0x298DDAB9CD758, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x520DF91B9FB20, 0x5AC8366C704B8, 0x0000000000000, 0x0000000000000, 0x0B5B6A677A694, 0x4F1203086C504, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x38EB51A5416A4, 0x1CE480C0EA615, 0x0000000000000, 0x0000000000000, 0x50E0CA42B9046, 0x25AFD9246B88A, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x2B6C6D6567061, 0x7A87B308A5135, 0x0000000000000, 0x0000000000000, 0x2BCBD365D3CF9, 0x2B2CD6C952770, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x75BBBF24B4E39, 0x18521E2F02C17, 0x0000000000000, 0x0000000000000, 0x1B4ACC254E678, 0x560202E8D64E4, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x78A8935725B6B, 0x77B0C16398E3B, 0x0000000000000, 0x0000000000000, 0x3846A3A19D26A, 0x15C317D1F8F06, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x5F76CE1373599, 0x77B647FBC0DE1, 0x0000000000000, 0x0000000000000, 0x3A66C4D3D107E, 0x34C817466BDB4, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x76096B8AB1EF6, 0x4D3DAFF604A2A, 0x0000000000000, 0x0000000000000, 0x77069A526A098, 0x2D178A238FE3A, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x63481AA49D657, 0x11E09ABADDDFF, 0x0000000000000, 0x0000000000000, 0x4E5111910D267, 0x258003D8CEAAC, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x63661EDD09D17, 0x3B2C8C09666E2, 0x0000000000000, 0x0000000000000, 0x2914A5E9EF507, 0x077B277F64833, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x2D955C036C334, 0x56911B6EF9911, 0x0000000000000, 0x0000000000000, 0x2860E1F1BCD23, 0x6BA7F5E4861C3, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x0E708C7ABFDA8, 0x48D2EB8931A95, 0x0000000000000, 0x0000000000000, 0x7EEEC9C31103D, 0x37EE45FB52BC8, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x31468A741F3F3, 0x018998E1BFAB6, 0x0000000000000, 0x0000000000000, 0x357CC3F86E487, 0x7D841AF3A1BB6, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x50037222BD0BA, 0x035C2ABF10962, 0x0000000000000, 0x0000000000000, 0x2CD38A7F3BC4C, 0x471146CB45DFB, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x48F7EA8954B34, 0x0DE8E90038F18, 0x0000000000000, 0x0000000000000, 0x61B7F94DA8B3A, 0x2B6C44D8A1101, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x120874452D7B1, 0x6124B98104193, 0x0000000000000, 0x0000000000000, 0x664CDBB5545E9, 0x0B957A328CC3C, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x04672289F841F, 0x771CE0F4ACA35, 0x0000000000000, 0x0000000000000, 0x70557B29E11C5, 0x7FCA9AAF839F5, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x18F412958E040, 0x4F5698494A199, 0x0000000000000, 0x0000000000000, 0x0781363A32E52, 0x42768762DD432, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x21F8B27F6F7D1, 0x3309874634AA3, 0x0000000000000, 0x0000000000000, 0x5ACB5254CDF8F, 0x219C4F6D51CB0, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x729234B157445, 0x5682080FE533A, 0x0000000000000, 0x0000000000000, 0x52C5EAA5EC4F4, 0x784F76459338F, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x402D94485C6F2, 0x097D258C198AB, 0x0000000000000, 0x0000000000000, 0x6C60E0D7134CA, 0x1FE23FC2F40C8, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x461B2187C1CE5, 0x0CAE23C190FE0, 0x0000000000000, 0x0000000000000, 0x578A728D6B62D, 0x70445C19EC41C, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x7B2C7C1D18D6B, 0x1E30686BC8A2F, 0x0000000000000, 0x0000000000000, 0x482A4666E88ED, 0x259D22221AB3B, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x5AE967398CC8F, 0x42F63F1C4D2AD, 0x0000000000000, 0x0000000000000, 0x3CF657D2A2554, 0x61DE119BA9699, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x044EBC1365AD7, 0x506A974FBE3E7, 0x0000000000000, 0x0000000000000, 0x25B95D9595F76, 0x00C11697E230E, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x327B1E1FCC2D3, 0x22545B3C88177, 0x0000000000000, 0x0000000000000, 0x23A130ED7BAD5, 0x528899F39C9F3, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x04AB015967D37, 0x0F61F44FDE267, 0x0000000000000, 0x0000000000000, 0x3259108E6E8B6, 0x2314DD2A411BB, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x233DBC15D613B, 0x7B07E7FA0DB2D, 0x0000000000000, 0x0000000000000, 0x3879E4B6FBB95, 0x2640E4352910F, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x5F881A17D166E, 0x1BADDD9A053F8, 0x0000000000000, 0x0000000000000, 0x2169A61F527D0, 0x5A2FB967C5529, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x2B303F78DA218, 0x715F991E4BD03, 0x0000000000000, 0x0000000000000, 0x5CCB9B54DC4DE, 0x3C35E25864A63, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x7A81D820861EB, 0x637ACAF46177C, 0x0000000000000, 0x0000000000000, 0x05CB3D8932DC8, 0x30CF20B516908, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x1F58C8858CBAA, 0x7F8BDFB6F5C24, 0x0000000000000, 0x0000000000000, 0x71476A2C6EBC4, 0x3157E789C6DB5, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x296ED8E5E8D7F, 0x15ACA3523A632, 0x0000000000000, 0x0000000000000, 0x32DB041FB2A6F, 0x2B86A87DE576C, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x0C576750C64FC, 0x3E012FB2B460F, 0x0000000000000, 0x0000000000000, 0x7CCF9DE03CC4A, 0x3BD60977F7051, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x47F374115EE41, 0x7F5F6F539E28C, 0x0000000000000, 0x0000000000000, 0x17E52B50C23E5, 0x2A4B333BA17E3, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x71824469CF8CB, 0x6E08B4E21BD50, 0x0000000000000, 0x0000000000000, 0x020CCA90B5BC0, 0x3991748BD61F9, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x2D80C751FBB11, 0x58B46DFDD3613, 0x0000000000000, 0x0000000000000, 0x4DFE501AF1778, 0x6D6F992C0400C, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x544A35B50A5C6, 0x4D643451348C4, 0x0000000000000, 0x0000000000000, 0x2BA7C9C53E818, 0x2A8CF7124FC63, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x0C9060C245FAA, 0x1163DF68F9340, 0x0000000000000, 0x0000000000000, 0x6BA371E63A24B, 0x35D182D1A18BA, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x46002F5C344EC, 0x0C0A8A06768B4, 0x0000000000000, 0x0000000000000, 0x681CD32F15AC4, 0x6715E877F3BBF, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x1C5DCD0A7C856, 0x1FC8F2BF0FB25, 0x0000000000000, 0x0000000000000, 0x4E36F7FD4B9BA, 0x6547C3C4821EC, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x43B6DD3E6E36C, 0x1FA6D13DB55EC, 0x0000000000000, 0x0000000000000, 0x793D5FE7417A1, 0x090ECC767A1D3, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x3BE8522AFA2BF, 0x4927E47C2ACDF, 0x0000000000000, 0x0000000000000, 0x704192C72B91D, 0x35070DBBE40C1, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x55B13E69169D5, 0x5B55C4006286E, 0x0000000000000, 0x0000000000000, 0x3CC839C01C822, 0x52E8D1D863E4A, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x4BF688DECD167, 0x2088FAB2285CF, 0x0000000000000, 0x0000000000000, 0x65D7FB1EE2FDA, 0x2121021549227, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x4B73B24792760, 0x7BE93EC1791D6, 0x0000000000000, 0x0000000000000, 0x1C36BDE546260, 0x18E5A9F98F6A9, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x6441A1A33742F, 0x5C07BA1A369D9, 0x0000000000000, 0x0000000000000, 0x385B316D800DE, 0x6F2F4E02963FB, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x4800B0BBAF982, 0x0F3CDDC7A918B, 0x0000000000000, 0x0000000000000, 0x6A5FCCA082E65, 0x439BFE2DC2219, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x3F0ADC910E7CB, 0x510D4379F6EC5, 0x0000000000000, 0x0000000000000, 0x113E87C475237, 0x3A81F54DD1858, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x6CED2FC632B9C, 0x4FAECB0EFDBAC, 0x0000000000000, 0x0000000000000, 0x391459FC8EB77, 0x6857BE3CA2E8F, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x2607C1293A830, 0x11787563966F7, 0x0000000000000, 0x0000000000000, 0x4D1CBAF55183B, 0x2ED4729F7A3E4, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x11A7AEE3269FC, 0x5B689DC31F40D, 0x0000000000000, 0x0000000000000, 0x07E3FECB659B8, 0x4B7FC58D06878, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x0E6DCF42C39DD, 0x0E296EE2B4DF0, 0x0000000000000, 0x0000000000000, 0x3EEDDF04E681C, 0x43BC63B6E2EC7, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x6AF5BE8C80E35, 0x0A0646C497066, 0x0000000000000, 0x0000000000000, 0x4E9FEB41AA7BB, 0x149F98318B1A7, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x382D6D565D8C4, 0x7F7E8241A9715, 0x0000000000000, 0x0000000000000, 0x5609DD5FAA13C, 0x3EAFF5685F2FD, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x31A9812C857C5, 0x2BC787346F7A7, 0x0000000000000, 0x0000000000000, 0x67E339ABEA2E0, 0x37A9C7B43ABF5, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x20C85BEC44B6B, 0x1166F0B86204C, 0x0000000000000, 0x0000000000000, 0x4C49681FD2728, 0x1CA9575C5A438, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x3D1F3A3074B92, 0x51745FE43A568, 0x0000000000000, 0x0000000000000, 0x04E4F8B1F14FE, 0x2047DEF80A336, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x4D9B79DB6CDD5, 0x060F649E8D4C8, 0x0000000000000, 0x0000000000000, 0x3B3FDA4A74345, 0x596CB9C3B1A89, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x1E09BA1D18EE4, 0x38D2DB3EC29F1, 0x0000000000000, 0x0000000000000, 0x202CA8E37D989, 0x21EED1C48A61D, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x03DBD5E8053D6, 0x63DBC2346030A, 0x0000000000000, 0x0000000000000, 0x515D4E9979C2D, 0x37BE1266A5C1D, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x7FA34C42F0BB5, 0x0E8BD73119946, 0x0000000000000, 0x0000000000000, 0x32EAD104CC603, 0x7C299B7E5D7DB, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x08BA1DC8E7A1B, 0x1D24384F7BB9E, 0x0000000000000, 0x0000000000000, 0x635BAC0B8A614, 0x2FD0360F97C6D, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x6B0AFA6CB21EE, 0x39B0194816BFF, 0x0000000000000, 0x0000000000000, 0x2021E7861224C, 0x787FE82D1EF6E, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x5081ADAF1BA89, 0x34F42ECDD6ADB, 0x0000000000000, 0x0000000000000, 0x700325D74F47D, 0x52AF9AA685986, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x5E7F2D4D4B363, 0x4CFF860F867D4, 0x0000000000000, 0x0000000000000, 0x195E70786CD71, 0x39B78972C14DD, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x2DB67B7453003, 0x48FB2CC509264, 0x0000000000000, 0x0000000000000, 0x63A9F394D888C, 0x738EE3E66270A, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x76FD0C537E529, 0x13D58FFC0ADDF, 0x0000000000000, 0x0000000000000, 0x4FE0925E02155, 0x6078C7E08FE56, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x4D5DA8F4647C4, 0x08322A610F8D7, 0x0000000000000, 0x0000000000000, 0x7645AE2CE8BB6, 0x26D1B79168F77, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x70C1D2FEBA90E, 0x0356C57469EF9, 0x0000000000000, 0x0000000000000, 0x7CF7E3B366E1C, 0x630DBF8012F54, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x473AE59248328, 0x76283FB77162D, 0x0000000000000, 0x0000000000000, 0x3615EE06E0DF0, 0x7248E59ED2D0C, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x357A2E11EBA71, 0x3D2989280519A, 0x0000000000000, 0x0000000000000, 0x0D8E9A54726D8, 0x5EF091EABAE96, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x3818C923AEB49, 0x1B3777EF49755, 0x0000000000000, 0x0000000000000, 0x76C242FFD5130, 0x7EC66950BC058, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x1B3EBAC9FD740, 0x2AA80B3756089, 0x0000000000000, 0x0000000000000, 0x7433D35D3A1AE, 0x715067A6C01B8, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x43C2F27AADDB4, 0x1E7A140DFD1FD, 0x0000000000000, 0x0000000000000, 0x075C1EB37084C, 0x2BF6E4A55404F, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x3C31552E7329D, 0x092A0611C70EA, 0x0000000000000, 0x0000000000000, 0x2445656F6A2AD, 0x3FC300212C35C, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x0863027D6AB82, 0x6D81A66484F59, 0x0000000000000, 0x0000000000000, 0x3F7224FA38C8F, 0x181917ADE10FE, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x406D9242B855E, 0x10082A9B064EC, 0x0000000000000, 0x0000000000000, 0x65B3AE10D6328, 0x415B420583914, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x4E824CC45DE23, 0x63D0B4B13B725, 0x0000000000000, 0x0000000000000, 0x32557883D6347, 0x65A0A1FBE7722, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x031C0F67B87F9, 0x4E48EFC21FB75, 0x0000000000000, 0x0000000000000, 0x2723249432AA0, 0x595C579E872D4, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x70F812DBA35D3, 0x0E9433E42879F, 0x0000000000000, 0x0000000000000, 0x6DAAD1FDC2F69, 0x324C2083CA0EE, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x63BA7A306463F, 0x1E654C0DA99D9, 0x0000000000000, 0x0000000000000, 0x34F0CA13610B1, 0x0A35F8242C1EC, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x3F395E6DD0A42, 0x24A3F7188ED62, 0x0000000000000, 0x0000000000000, 0x60F775E98D675, 0x615DF12B36FD6, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x2C834C71430CB, 0x1EAF7DB222A6C, 0x0000000000000, 0x0000000000000, 0x70D2AD7E26E4A, 0x17AD187CE15D0, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x02942CCB563C4, 0x3CF7332AA39AE, 0x0000000000000, 0x0000000000000, 0x4CCB300F5BE7E, 0x3F047436AA45E, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x48916F83C5B7A, 0x43E31B19186BD, 0x0000000000000, 0x0000000000000, 0x0F4B3BB3FF06C, 0x349E2C99E08C9, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x29979C7B0581A, 0x0BD018A237C3F, 0x0000000000000, 0x0000000000000, 0x3116E8A8DB74E, 0x32E201C75442C, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x6D658FC94DEEC, 0x3560B8774C175, 0x0000000000000, 0x0000000000000, 0x6F8AC05328104, 0x2731D353DECC5, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x2B35BF9EDE908, 0x3EB504E72DFA9, 0x0000000000000, 0x0000000000000, 0x666C08C31CC8B, 0x53F90E0618549, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x192E8FE370B03, 0x60C4819D84C97, 0x0000000000000, 0x0000000000000, 0x328D584104FFF, 0x143608CAF743B, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x7C3BFD9008CFD, 0x2B797D827A746, 0x0000000000000, 0x0000000000000, 0x43030E6A3AF77, 0x6E43E3DAD66C9, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x127DD431F2DB6, 0x27C55CE235F2E, 0x0000000000000, 0x0000000000000, 0x568BC29387CF0, 0x7C7E1779B0E30, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x140F7F2CDFA2C, 0x0B19F220761FC, 0x0000000000000, 0x0000000000000, 0x44B6DE1B32224, 0x27946B2FC016C, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x38A7CA3C08EA6, 0x08C57F6C8A778, 0x0000000000000, 0x0000000000000, 0x6FE47B1724CAC, 0x1553EBBCFFFAC, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x7365F74DA690C, 0x6C2E10CD8296A, 0x0000000000000, 0x0000000000000, 0x4E3262AD11D19, 0x63D812F1D9947, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x315B741D3BA6C, 0x051C521ED16C9, 0x0000000000000, 0x0000000000000, 0x586EB86BF14A4, 0x44125CE5F1617, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x6EB38E8A3227F, 0x0F6FD80F785DB, 0x0000000000000, 0x0000000000000, 0x6FBC10EC8A741, 0x0753AF468342B, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x46098EFF3A530, 0x18ED082B0160C, 0x0000000000000, 0x0000000000000, 0x0DF98C410D434, 0x10D353E1384BD, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x3BD5E57124170, 0x1B324923CB9B5, 0x0000000000000, 0x0000000000000, 0x1402D74B668F6, 0x332A5FA461261, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x564CC0965B1A9, 0x18F6BA9BDC86A, 0x0000000000000, 0x0000000000000, 0x3DFBAF02FDBB3, 0x51FF411705CB2, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x1F5B734071C2E, 0x78FBD48F17717, 0x0000000000000, 0x0000000000000, 0x1523CD1001B20, 0x20AD0379FEEA4, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x0CC6BB8328EAF, 0x3C7D14ECF8D9E, 0x0000000000000, 0x0000000000000, 0x16C566EE2002D, 0x3649F65F7B994, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x735D3BD846418, 0x4A6A06409BDE3, 0x0000000000000, 0x0000000000000, 0x5767E77A02BA6, 0x53380C4EF3B13, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x742D0B22C6DF3, 0x7F02C4AC79307, 0x0000000000000, 0x0000000000000, 0x5D3BCBB824114, 0x55D94510983C4, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x7DE850556B898, 0x08DE9258A29D9, 0x0000000000000, 0x0000000000000, 0x7F4893F349011, 0x2FD0E8B9A68A2, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x4B443FE715A9B, 0x55BF8C8CF6E3A, 0x0000000000000, 0x0000000000000, 0x2025590E710BD, 0x5105C67424FA6, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x5C533707373DF, 0x57514E40DD0DF, 0x0000000000000, 0x0000000000000, 0x5DD6F06339480, 0x39A3DE6E40282, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x453BB58FE7474, 0x1B2641AA847ED, 0x0000000000000, 0x0000000000000, 0x6E078A6247ECA, 0x2EFD070C840FC, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x0CC8B7AB87EA3, 0x2A6F6688ACC41, 0x0000000000000, 0x0000000000000, 0x2CAA75470405A, 0x3D54EDE8E1F07, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x27734C289DD49, 0x59F56AEFBD789, 0x0000000000000, 0x0000000000000, 0x2E55E4E255638, 0x58BCD89C168AC, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x4247F8BD97DB8, 0x1DD2636EDEFC3, 0x0000000000000, 0x0000000000000, 0x2D121A14E4B9C, 0x24044AB1DB69F, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x190881C4A9460, 0x49BBAD98DBA65, 0x0000000000000, 0x0000000000000, 0x46111F5207A50, 0x743370742F3C3, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x49FE659201385, 0x26040A3FFC964, 0x0000000000000, 0x0000000000000, 0x0F5CD3E493C1B, 0x35D574D21BB45, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x4E329D1D04D9E, 0x2FA47664DF34B, 0x0000000000000, 0x0000000000000, 0x1644D6849A277, 0x4AF69F01F07AB, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x23E0152D6051D, 0x25774A65687CE, 0x0000000000000, 0x0000000000000, 0x40F6FC5878C56, 0x1DF329206A472, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x741022AF38003, 0x40150C83681A1, 0x0000000000000, 0x0000000000000, 0x00E74C5461005, 0x55164DA7F4ACD, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x569009F5896E1, 0x182F80970F67B, 0x0000000000000, 0x0000000000000, 0x20C44376F6F95, 0x3173A86E5F6DD, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x1BFB011C896CC, 0x6A8AA9BEAFFA9, 0x0000000000000, 0x0000000000000, 0x3AAF70C36AFC2, 0x680AF57D8FC9D, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x1CCB5AC57BDCF, 0x25087B26BBDA4, 0x0000000000000, 0x0000000000000, 0x375E64EE95612, 0x68910ACE7A38C, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x65D9A1F8C41ED, 0x387525D9803E4, 0x0000000000000, 0x0000000000000, 0x3162A404DD22C, 0x328711CD4853A, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x5F0A6DC9FB34C, 0x7EB9421433C9F, 0x0000000000000, 0x0000000000000, 0x4A458ABA7A156, 0x05E3FA11522C9, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x15826F8797FAE, 0x2DD72A2EEF39E, 0x0000000000000, 0x0000000000000, 0x5E9FF3776BA8A, 0x565A9948861CA, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x4BF19FF29EF4D, 0x13F857A292EAC, 0x0000000000000, 0x0000000000000, 0x58E37BF0A04A9, 0x27BA402AF6997, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x3E76DA4A1EC87, 0x0411D88EB9504, 0x0000000000000, 0x0000000000000, 0x28A50E851F2EF, 0x5F7E4366FA8B4, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x5052D92AAB63C, 0x7348F6802E12F, 0x0000000000000, 0x0000000000000, 0x3B851DDF1F22E, 0x5A48D583E8F49, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x39485F774E798, 0x747AED8F42350, 0x0000000000000, 0x0000000000000, 0x7A41D4C05AE98, 0x04062231FE23F, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x63467CBEC38E0, 0x28E24BD3C1947, 0x0000000000000, 0x0000000000000, 0x3C0DDA75B6E7E, 0x28A6FBBEFABC0, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x418149614BF03, 0x736B8E8B5AE3A, 0x0000000000000, 0x0000000000000, 0x3E0ECCE8654E2, 0x1995977E072F8, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x4818F69B4923B, 0x141E1E50ABEB3, 0x0000000000000, 0x0000000000000, 0x694096BCF11BD, 0x26BA627F95C4B, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x6D50241CE8D66, 0x614A3DEC53DE9, 0x0000000000000, 0x0000000000000, 0x05F760254412A, 0x597BADA498983, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x1CAF7F9D07D9C, 0x54249214E420F, 0x0000000000000, 0x0000000000000, 0x0FA122139A06C, 0x72D9DBD8A3BB6, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x7F1F96F1693A2, 0x526FF2D4A5043, 0x0000000000000, 0x0000000000000, 0x6E89AFEF109C2, 0x5CC7E81BB467A, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x5C372527EEE93, 0x7AE5FEBC592F4, 0x0000000000000, 0x0000000000000, 0x5DF3022FB03AB, 0x01A4EF5FA2C04, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x439624EA8B92D, 0x5619E7AEA672C, 0x0000000000000, 0x0000000000000, 0x16ED78A8F3D8F, 0x183FACBD55509, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x2BD550FF77020, 0x169F1E6CB760B, 0x0000000000000, 0x0000000000000, 0x0DDCD48810E80, 0x2C21401F2CF35, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x0B85E22D4941B, 0x4C6AE15FE728E, 0x0000000000000, 0x0000000000000, 0x2786B5ABC30E1, 0x6D1B1BA81C938, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x69F78FC03AAB0, 0x518236EB099D1, 0x0000000000000, 0x0000000000000, 0x2B0C44AB0C3E3, 0x503B2E71B6E3A, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x61A01F2F69D6E, 0x4EE74B5A38BC7, 0x0000000000000, 0x0000000000000, 0x018BCDB8B2357, 0x1455958D0CD87, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x6D892A5EC8817, 0x72F1AFCE06F80, 0x0000000000000, 0x0000000000000, 0x587B4B754F95A, 0x43F864F300104, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x4556F3DF4AB2F, 0x72A263E0E57E1, 0x0000000000000, 0x0000000000000, 0x2CA451E251F0E, 0x204E9D6F55D85, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x43B4962FDEC05, 0x0411663096B8D, 0x0000000000000, 0x0000000000000, 0x07D6171F19BD9, 0x28F72DA82974F, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x202B7CC2CBC58, 0x3C70356DAF59D, 0x0000000000000, 0x0000000000000, 0x085F79CD5CE16, 0x22A9276BCE44C, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x3552FD54C6656, 0x7713F27AE1FA5, 0x0000000000000, 0x0000000000000, 0x507E2AEE49E44, 0x06068D4DE796F, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x6DF4607D3F5D5, 0x5976D7BE9CBA5, 0x0000000000000, 0x0000000000000, 0x2EF37A6940736, 0x39BD70236D18A, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x055B1572B745D, 0x15A7DCDD555AC, 0x0000000000000, 0x0000000000000, 0x205C2E5A781DF, 0x0E4CA692C4A0E, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x6FD5A0FFEBD1B, 0x39AA48E30E2D3, 0x0000000000000, 0x0000000000000, 0x32A565E3CA3C0, 0x28E23A7C668E8, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x2AE404F8646A5, 0x1625C422A242A, 0x0000000000000, 0x0000000000000, 0x75B930E3F6546, 0x1ED31E15DDC33, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x677025950D6F6, 0x24978889811DA, 0x0000000000000, 0x0000000000000, 0x31EC130F1F170, 0x3E66F9837BCF2, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x44B0E1DAED93A, 0x6F9C2FC3D1EDB, 0x0000000000000, 0x0000000000000, 0x2620BA9D80BCE, 0x3A731838CE731, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x14062BE009378, 0x3F15A35E11BC2, 0x0000000000000, 0x0000000000000, 0x3F8FDDD10E39A, 0x2940583607B38, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x0782771718F1B, 0x48A987EC3D8B4, 0x0000000000000, 0x0000000000000, 0x0B9B3876E939E, 0x7B55B94DEB0FA, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x747871497E4EF, 0x73069CF20227F, 0x0000000000000, 0x0000000000000, 0x06CFCB84A6771, 0x68C8B46038410, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x5738496B94025, 0x168728631EC4F, 0x0000000000000, 0x0000000000000, 0x25837A9B5FCC3, 0x188B7870972FE, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x687BA19297785, 0x0833D79D2B6B9, 0x0000000000000, 0x0000000000000, 0x2B487B590144F, 0x2B546D19A3A7E, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x458E00CD67CFC, 0x34D859C306B52, 0x0000000000000, 0x0000000000000, 0x0160736DC758E, 0x0D78F5096364B, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x1FEC7E77C8662, 0x3CD9BCEF833B1, 0x0000000000000, 0x0000000000000, 0x3EBBE5892D777, 0x4D1CAAD4886A7, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x62B6DC1806C34, 0x7DDB943921BD4, 0x0000000000000, 0x0000000000000, 0x690F64880DC47, 0x7D25722AAD267, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x315A299F806D4, 0x17A4E1BBAC3FF, 0x0000000000000, 0x0000000000000, 0x584FE3F29ABA7, 0x7B8C9CAA249F5, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x1F964364A931E, 0x10D1CF52853C8, 0x0000000000000, 0x0000000000000, 0x35368EE20A6C5, 0x2ADBE7164E20E, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x7546CF274BA8F, 0x57530B707A239, 0x0000000000000, 0x0000000000000, 0x22CD1AD1A59E1, 0x5F0AD2B27A177, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x5495EA7F4BCDA, 0x118F9451A8920, 0x0000000000000, 0x0000000000000, 0x169A0D4258992, 0x2CDD7D8146EE8, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x28DABBEBBCE93, 0x13EBE6B67B623, 0x0000000000000, 0x0000000000000, 0x5EA44CB3259E0, 0x626B1CCEB80AB, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x34C972B78033D, 0x6DA704D229BA3, 0x0000000000000, 0x0000000000000, 0x30178618D035F, 0x364043015458F, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x3498DC6AFB285, 0x6E7F29B91DD76, 0x0000000000000, 0x0000000000000, 0x631BEA5651992, 0x0808D40EA86C8, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x195A6F5AE62CB, 0x2074EDAB30FA9, 0x0000000000000, 0x0000000000000, 0x55F17E41C2383, 0x207636D671E6E, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x4C233E8CD0AC3, 0x7D4B9B5642DE4, 0x0000000000000, 0x0000000000000, 0x130F8B91836F3, 0x7C0C857B1F6A1, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x2140121CEBFE7, 0x5B278CB625429, 0x0000000000000, 0x0000000000000, 0x373CEEBA3745A, 0x6A89F9C55976B, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x1D13B5BA23624, 0x7E3B464F1DC46, 0x0000000000000, 0x0000000000000, 0x47287E8F8BA32, 0x04F62306F7479, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x4979F5CFF751D, 0x32C056DE43DED, 0x0000000000000, 0x0000000000000, 0x4A252ABC9F039, 0x25E83BD5AFCA1, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x7FD14185BC4D4, 0x23FC880072B97, 0x0000000000000, 0x0000000000000, 0x310A331A57552, 0x771696C4E78A3, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x7AB3C8C1694CC, 0x1FBCFF8E786B7, 0x0000000000000, 0x0000000000000, 0x7C1146305BBB7, 0x2DAAF68A4BBD0, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x0CA4534187836, 0x609ACF78AA5E1, 0x0000000000000, 0x0000000000000, 0x05693BDDED840, 0x0026FE48ED043, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x111D71768506C, 0x039B9621F7B35, 0x0000000000000, 0x0000000000000, 0x4B3B69B4C9331, 0x67D8376BF2FD8, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x27E6DFCF261F6, 0x32EF58D293427, 0x0000000000000, 0x0000000000000, 0x09814D9B6DDF6, 0x0A1174E80D3C0, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x384FF9D2DBB43, 0x1F61070EA9447, 0x0000000000000, 0x0000000000000, 0x1B8640F208BF5, 0x363AB04EE132E, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x77EC9B8EAF0CE, 0x1E495943C7132, 0x0000000000000, 0x0000000000000, 0x05D529083FB2D, 0x7CEB86DD75778, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x0BDBBCFDD3D0C, 0x1E5AE3C5C4BD8, 0x0000000000000, 0x0000000000000, 0x5947C13C52345, 0x2344AF67F79C0, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x6EAE399AF00C5, 0x1B1DD58B96350, 0x0000000000000, 0x0000000000000, 0x3E27840386567, 0x2EF3EC4AC48E5, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x4F06B7A8F3D96, 0x6EA21A7E5DB11, 0x0000000000000, 0x0000000000000, 0x3012986437927, 0x79840C72BF9B7, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x23AA68A1E94ED, 0x6B8CB71D750DD, 0x0000000000000, 0x0000000000000, 0x3ECDD2BE90EAC, 0x42C7BE93EDC36, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x2D7C806E30BFC, 0x156FA82FFEE91, 0x0000000000000, 0x0000000000000, 0x7E72CD420B1FB, 0x6BC450C5A3421, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x1623F4465DF87, 0x5DD8AA66FE3C9, 0x0000000000000, 0x0000000000000, 0x20BF8FAA8AC91, 0x55A65F59B274B, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x420FB7A15A640, 0x10B9F75E36903, 0x0000000000000, 0x0000000000000, 0x1E1198BA3E4E4, 0x288D11B98F2AB, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x2BC4F29CB6374, 0x05EF9F9E47962, 0x0000000000000, 0x0000000000000, 0x41BB854B4A69A, 0x197AB1E9C06FB, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x19C9ED5F87CBA, 0x3274DFF335B3D, 0x0000000000000, 0x0000000000000, 0x14804F30ACD8B, 0x49E8EEB0B1481, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x0077078E06781, 0x0902E10A9FA3A, 0x0000000000000, 0x0000000000000, 0x5212B60313E0A, 0x33F1B8E31C86C, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x2AA3F24E3B04B, 0x498229089EB80, 0x0000000000000, 0x0000000000000, 0x1004840EF646B, 0x15A12B95215B3, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x46186A9D17117, 0x317DEBBF2F6C0, 0x0000000000000, 0x0000000000000, 0x36F8670FF8FBD, 0x07AF6588041CF, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x5B10E90B4DDA7, 0x170954517315E, 0x0000000000000, 0x0000000000000, 0x2ECDF3295DC60, 0x18A04353DF4C2, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x3091033354C06, 0x48CC106941113, 0x0000000000000, 0x0000000000000, 0x7E4D167134CBA, 0x11EE8CD069B1E, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x233C7246D3697, 0x256D19A937AD6, 0x0000000000000, 0x0000000000000, 0x32DFF3871C69D, 0x602A4BCD359A3, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x5FEC81BA3B7B8, 0x21EDD53B923C4, 0x0000000000000, 0x0000000000000, 0x0AA91C63E2B52, 0x313F0AB66C459, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x7705A32BF6656, 0x48FF4FD8D56B7, 0x0000000000000, 0x0000000000000, 0x140E812BD2B7F, 0x1A99C5D7534DA, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x4EBCC8A93491E, 0x082F7E71C9235, 0x0000000000000, 0x0000000000000, 0x29BA723D4DDBC, 0x4C549DE3F4D43, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x1FA5798A3C1F2, 0x0EB421C011D1C, 0x0000000000000, 0x0000000000000, 0x45AB559DE3C14, 0x1A83B3362FE75, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x5CC4C4549EF3B, 0x04F0B99BC1539, 0x0000000000000, 0x0000000000000, 0x4C7129D2A2C25, 0x42FCC6EC566CD, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x116174E16E472, 0x7EC465353A17D, 0x0000000000000, 0x0000000000000, 0x4FA66C2E15B5C, 0x68431D58A73B1, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x1BC683A694085, 0x558C439112A98, 0x0000000000000, 0x0000000000000, 0x3161630EC5E59, 0x095016DB9EE3F, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x28ACA637A4264, 0x51D5069F1EBBD, 0x0000000000000, 0x0000000000000, 0x4C05D2BAEE3EB, 0x2C28426B8DA85, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x0AEE3CB355C1D, 0x69E96A9F1986A, 0x0000000000000, 0x0000000000000, 0x17375B2A417AD, 0x7CC2FC22AA572, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x0272F00F548D3, 0x1EC6315926DDE, 0x0000000000000, 0x0000000000000, 0x2B836C6CE56BC, 0x21A2F707440A7, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x132B1EB8203A7, 0x4F361D84E72F6, 0x0000000000000, 0x0000000000000, 0x598731FA1F1BB, 0x1F3519CE198CF, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x2E035C03D5489, 0x3B1F34D37E29E, 0x0000000000000, 0x0000000000000, 0x198B8ACE282AD, 0x581FD4A2B3D66, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x2F03A582FEB56, 0x54D0ABF2D0878, 0x0000000000000, 0x0000000000000, 0x0DFC06E7409E4, 0x65AA7DE12403D, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x67BCEAABB2E71, 0x6A1FCBD47774F, 0x0000000000000, 0x0000000000000, 0x64EC74203B57B, 0x4ECDFD6D50788, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x023F3052A93FF, 0x4C27B8A5F3F11, 0x0000000000000, 0x0000000000000, 0x72DB78C6BF422, 0x1A0F344E43C49, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x48BD8EA5C18A5, 0x159F61357DD3A, 0x0000000000000, 0x0000000000000, 0x44C0B1AB1D114, 0x30D883CD201EC, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x4B6386026998D, 0x47345770C4A1D, 0x0000000000000, 0x0000000000000, 0x281426FCA1B01, 0x2127756ACDEA2, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x056C48015557A, 0x2D861BB2CC4BE, 0x0000000000000, 0x0000000000000, 0x646A414CEF89D, 0x06ED1892542D9, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x01C7F2B2DEA31, 0x6A5A60FA973EC, 0x0000000000000, 0x0000000000000, 0x55F6E0D958A9E, 0x13CAA939AB482, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x6040A86FEFA63, 0x2D02D1738ECC4, 0x0000000000000, 0x0000000000000, 0x1BBF7B5E56874, 0x5789360D94015, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x396728406DDCA, 0x186C9F8B79A12, 0x0000000000000, 0x0000000000000, 0x5160CF885DA7A, 0x4EC8A74B08BFB, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x6EA8B65F39F12, 0x1333199DE8CAB, 0x0000000000000, 0x0000000000000, 0x6FFE7F25DD4E8, 0x39974EB740D43, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x3A34314ED544A, 0x7CE7C7C88ADE8, 0x0000000000000, 0x0000000000000, 0x6116BD9E5479C, 0x4337F914B6E61, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x01D2D41A3B79E, 0x4E7A8ED2DEC08, 0x0000000000000, 0x0000000000000, 0x553BF393C9771, 0x07E3A238D7AB0, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x598978CDCF6A6, 0x289FE9C701E03, 0x0000000000000, 0x0000000000000, 0x2D07493207223, 0x53CBC74762B69, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x2D4953721CF95, 0x25C62E366D478, 0x0000000000000, 0x0000000000000, 0x633A232F16EB2, 0x3DEBAE16A73F2, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x11D92CB17FB99, 0x1BB0994E27D24, 0x0000000000000, 0x0000000000000, 0x10E2499764C1E, 0x6809181B7AF23, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x137FA045C9E79, 0x11908F79FCAB5, 0x0000000000000, 0x0000000000000, 0x655ADEF943B4A, 0x16B75DA086A6E, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x0E6645DFD6AE3, 0x176BB9B979E72, 0x0000000000000, 0x0000000000000, 0x19FD6F2A38691, 0x116DA8EEEC9DD, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x61BD08171F696, 0x72E36DE224BFD, 0x0000000000000, 0x0000000000000, 0x5B9AD4BA5DD1E, 0x4A41505CB58BF, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x06C0BBFBA7EE2, 0x7F51826B73D80, 0x0000000000000, 0x0000000000000, 0x778D7AB5A8350, 0x013DE8DA2A555, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x1C4BFB1981217, 0x0FD1F6E7165AC, 0x0000000000000, 0x0000000000000, 0x212FF4BB96F5D, 0x2C4C82CE507CE, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x1A2D56E462314, 0x675B7E40161F4, 0x0000000000000, 0x0000000000000, 0x184115FAC724A, 0x3193E515C2F1A, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x4F1BCB1F5B6DE, 0x203EA55F8FB48, 0x0000000000000, 0x0000000000000, 0x4BFD0F9C02B34, 0x2AF5A05CB09CA, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x0AAC89AB5E8D9, 0x41A9D481A27A8, 0x0000000000000, 0x0000000000000, 0x6440434626D23, 0x64246674C8B73, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x6BFAC6D1FC447, 0x5548E0149760F, 0x0000000000000, 0x0000000000000, 0x683564004585E, 0x72B364E339060, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x760760EC1E15F, 0x3BE7BFDA379D1, 0x0000000000000, 0x0000000000000, 0x1289A8A3245AB, 0x0B5C7CCEB8BEA, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x494AD1A847899, 0x31EA8F0155F15, 0x0000000000000, 0x0000000000000, 0x675E2A5A035BE, 0x61F958EE2C447, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x21285F8EE7300, 0x2FBD3C80026AA, 0x0000000000000, 0x0000000000000, 0x7CC253DDF33D6, 0x504C392C3D314, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x1B9170829D1AC, 0x1DD0E34C82E01, 0x0000000000000, 0x0000000000000, 0x5E86A231B1225, 0x24BC8BAE1EA27, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x1F36777C530BC, 0x0DEC1ACE594CF, 0x0000000000000, 0x0000000000000, 0x72E4188CAA316, 0x417F0B851C448, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x7B39D6802820C, 0x06D51B7EC8EC4, 0x0000000000000, 0x0000000000000, 0x458809EF7A08D, 0x77273671F31DB, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x36ADD4170FB62, 0x26CE0F5642C5A, 0x0000000000000, 0x0000000000000, 0x251D4B9202688, 0x6E6A513D9CA8B, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x1C06C5C656D1F, 0x50F6473CCF23A, 0x0000000000000, 0x0000000000000, 0x229D3DA66971D, 0x1E582300064B1, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x1B09BD26B6309, 0x65A8A86BCF478, 0x0000000000000, 0x0000000000000, 0x3D7D31B26DBFE, 0x320D3ED0A5EA4, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x22614E6E79CF1, 0x1A418F7EC651D, 0x0000000000000, 0x0000000000000, 0x5FCDE0858E0DB, 0x1AE11A7AD1A65, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x65A848B986996, 0x6F60AC2A7BCF3, 0x0000000000000, 0x0000000000000, 0x2C9E4B4100DFA, 0x1B1B1AC2F780D, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x507865F6FC861, 0x5983E935385FE, 0x0000000000000, 0x0000000000000, 0x515BA24ED617C, 0x7D1B797EAA420, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x2438C4697C977, 0x538B41730A685, 0x0000000000000, 0x0000000000000, 0x38BF818BDBDCD, 0x2019EF00F6BF0, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x6E4DE971456F5, 0x68B8EBDA2FF32, 0x0000000000000, 0x0000000000000, 0x010B65CFED21A, 0x526D50992A444, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x402E7139A477B, 0x33F994615FB9A, 0x0000000000000, 0x0000000000000, 0x1EC03943D6A5D, 0x1C42655AD039A, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x0EB2660A1B790, 0x126CE6B5BA80D, 0x0000000000000, 0x0000000000000, 0x60286CF3A01BE, 0x1C39F9EB71256, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x782560417BD14, 0x6A6D9808D362E, 0x0000000000000, 0x0000000000000, 0x1ADF2B0162238, 0x3E7F6B5CEC2A3, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x7F1F8918DC406, 0x6BF5EF6E95A71, 0x0000000000000, 0x0000000000000, 0x511C1BCEA09A6, 0x5CCC96BCB1208, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x75BB6EFEB6C56, 0x5EBB4DACA034D, 0x0000000000000, 0x0000000000000, 0x73D163E957F5E, 0x773817A609040, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x210E77F3D238D, 0x25D2855D5F12A, 0x0000000000000, 0x0000000000000, 0x7D49AAB8DFD22, 0x7E18821141008, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x2E8824BBBCE27, 0x5E61255ACFBD1, 0x0000000000000, 0x0000000000000, 0x0F14B106C89C9, 0x40D5B82E9E042, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x78368EAE21900, 0x209E7A819779C, 0x0000000000000, 0x0000000000000, 0x0A4994B340638, 0x23F0EB0F8472B, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x37B8083DAE0B5, 0x419F57A1F15E9, 0x0000000000000, 0x0000000000000, 0x17F4749748F43, 0x491C90E5BCDE0, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x3A0B6DB618DD1, 0x1E298E4F03951, 0x0000000000000, 0x0000000000000, 0x3F5F919F2DCCB, 0x24C8AF1C23374, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x2378D8CD623BD, 0x0B28DDE45AE60, 0x0000000000000, 0x0000000000000, 0x020DF3D2F55D9, 0x124A81B7479A3, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x2301BF1634D42, 0x20E7EA1334EBA, 0x0000000000000, 0x0000000000000, 0x58F7A30163857, 0x7A16BBA0DB4C2, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x56446D641D871, 0x6E78DCCD8BE39, 0x0000000000000, 0x0000000000000, 0x4F0672DAB8108, 0x3A66DC3BD2CB8, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x3AF5709112253, 0x1B1E6D1DB3D70, 0x0000000000000, 0x0000000000000, 0x576D7AC5F0554, 0x2EE0CAC7D387B, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x0B50A2D39F2E8, 0x0857A843100DC, 0x0000000000000, 0x0000000000000, 0x5058F52766C82, 0x5F2E684DA3E8E, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x359F361AC59C5, 0x002AB2B637BA5, 0x0000000000000, 0x0000000000000, 0x0DE2AF5433141, 0x2B0CDB2F765B2, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x5887E60CAF13D, 0x1F7F37443CB8A, 0x0000000000000, 0x0000000000000, 0x48DA92A278A06, 0x0CB16F7E71778, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x0B46C4032F7B5, 0x399BD880E8D67, 0x0000000000000, 0x0000000000000, 0x779201F275226, 0x4C51100F260F4, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x71C802046EB88, 0x029CDBEC604CA, 0x0000000000000, 0x0000000000000, 0x6C375094BB9A1, 0x11997021C69D5, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x6E9469D535D23, 0x15E6CFD7AA528, 0x0000000000000, 0x0000000000000, 0x120B5B3806D27, 0x2651FFD4D14A2, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x220A6C56242BF, 0x5296226492EE3, 0x0000000000000, 0x0000000000000, 0x02FCD350E0B81, 0x43830D3C7D2A0, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x2898421C30CF6, 0x7CAA136BD44D7, 0x0000000000000, 0x0000000000000, 0x741DBA8AEA7A7, 0x0D2D846EDB612, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x701325B65FFBC, 0x36E75060484C1, 0x0000000000000, 0x0000000000000, 0x4ED2D30A40724, 0x6B6FE57A840B8, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x011CEE77AA9A2, 0x16E3CE9A18374, 0x0000000000000, 0x0000000000000, 0x130605DF438BE, 0x397E8D96AAAFC, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x6F7278FF99D1D, 0x273434C912BDA, 0x0000000000000, 0x0000000000000, 0x110B4746AA959, 0x7088CDF1A4C6F, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x58814366FE9BD, 0x256585ABC38AB, 0x0000000000000, 0x0000000000000, 0x77A0875DDD486, 0x2768E2D2CAC61, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x334F2FFB1197E, 0x5E3363EFFD607, 0x0000000000000, 0x0000000000000, 0x648F7F90C7DA2, 0x4F73A6A1897AE, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x299A9404F3B8A, 0x316FC446DC86B, 0x0000000000000, 0x0000000000000, 0x10507BA36954A, 0x741C47D25722E, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x5AFF4B2C24471, 0x6BBAE3FE3B401, 0x0000000000000, 0x0000000000000, 0x5C6A0360F9172, 0x0E76B015BFFFA, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x16A4C63DA69A8, 0x3641906EEFDBF, 0x0000000000000, 0x0000000000000, 0x12B8B4C2B2740, 0x5530C1B5BAABB, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x43E69AC5C64C8, 0x4E040D4445C7A, 0x0000000000000, 0x0000000000000, 0x77076752122A0, 0x6D290E4DB269E, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x7969E05A970D2, 0x1DC8A784F7200, 0x0000000000000, 0x0000000000000, 0x1E2279DDD57BF, 0x22446EED4191A, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x1286A55A2CB3D, 0x5FBAF5E47D023, 0x0000000000000, 0x0000000000000, 0x17B702D5E8D5F, 0x5E99869E428F2, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x70AE4671429F1, 0x16AF1BB185329, 0x0000000000000, 0x0000000000000, 0x0884FCE9B1FEF, 0x2DA39F7BE37FB, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x778948422D9AE, 0x49AD04913CFE0, 0x0000000000000, 0x0000000000000, 0x52433DC44F829, 0x6F5E3D40A5BAD, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x27BA827D5ADB8, 0x0364B6AE278E6, 0x0000000000000, 0x0000000000000, 0x48AFFFFF1D672, 0x75F25A39F371C, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x4816FFE7460E0, 0x421CEAAE661EC, 0x0000000000000, 0x0000000000000, 0x751BEB4E15C83, 0x759714ED050F2, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x3697D21CC1775, 0x0E50653C099A3, 0x0000000000000, 0x0000000000000, 0x383892AFEC032, 0x28E9D801E4666, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x2206B65B414BA, 0x6A1DB0CB9D61F, 0x0000000000000, 0x0000000000000, 0x0D8A53F023E38, 0x0F11B5D3D404E, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x3F746AF17714F, 0x7F562D88F6452, 0x0000000000000, 0x0000000000000, 0x2E3AD68D4DA5A, 0x1D8D07D938673, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x3C15CC5F03AEE, 0x2C1839C74E9DE, 0x0000000000000, 0x0000000000000, 0x04071A7BE72E4, 0x6DB4F25EF85F2, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x1EF65C90917B2, 0x0736369C4B1F7, 0x0000000000000, 0x0000000000000, 0x28B53A651192E, 0x495631C721345, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x4E724487D232A, 0x3160C679EC362, 0x0000000000000, 0x0000000000000, 0x71655C990F80A, 0x1C14A1163B6D1, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x064246B370A7E, 0x0B79A20B4764C, 0x0000000000000, 0x0000000000000, 0x0AAC6FA395565, 0x2B3E1451267F9, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x58E45001ECD4B, 0x494B78F153B63, 0x0000000000000, 0x0000000000000, 0x36D67ED1EAB51, 0x50688FCB9A73F, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x071CB50BC73FB, 0x7CB75F2EE51C2, 0x0000000000000, 0x0000000000000, 0x63464E774730A, 0x1FD54A45EB889, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x5EC777A4AEA1A, 0x643CD4B5CE367, 0x0000000000000, 0x0000000000000, 0x47567FE631BC1, 0x1CE6BC76BC800, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x43506397BCEEF, 0x03706AD2F9895, 0x0000000000000, 0x0000000000000, 0x704DECF12A8CB, 0x45B7BBB1A2CA4, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x09549CCE8CAF6, 0x773EE8447CE5A, 0x0000000000000, 0x0000000000000, 0x0D0E77765009A, 0x6BA06F59283E1, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x6685DB09744B7, 0x19AC5DA7471B4, 0x0000000000000, 0x0000000000000, 0x7CA8ACC7A6C8D, 0x2C69BE11AFEE6, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x2B913A2A38700, 0x52473FC13BCD7, 0x0000000000000, 0x0000000000000, 0x06E866D034D50, 0x0113ED7F4C7CD, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x6F2297933F822, 0x6B289C05B521E, 0x0000000000000, 0x0000000000000, 0x57C6B3C2DCF3F, 0x4AB1E983C2EE4, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x40598FB0C73C7, 0x7598368ED2BE5, 0x0000000000000, 0x0000000000000, 0x2632FFC6DEB30, 0x3BE5D4DD2C62E, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x2E39AB5855AB7, 0x4FABE7C10F401, 0x0000000000000, 0x0000000000000, 0x78DC885CDFECB, 0x682BF78A3A271, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x2881672018C4E, 0x47DE576178218, 0x0000000000000, 0x0000000000000, 0x76AF9EE157E47, 0x4E6EF40C24FCC, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x241C4B9FFAD24, 0x0F0C18A86D96D, 0x0000000000000, 0x0000000000000, 0x0212160C23678, 0x368BAA626A645, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x444F1B8F73FFE, 0x308F60076C2A2, 0x0000000000000, 0x0000000000000, 0x14A996DCDD07E, 0x21EA5EE6428A4, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x37D2B30775EE9, 0x44539F7304016, 0x0000000000000, 0x0000000000000, 0x1A6A9FF3FCCAE, 0x4259583157A8C, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x38370A1EAC49D, 0x3DD9EAB913495, 0x0000000000000, 0x0000000000000, 0x65243CC238DC6, 0x3E5DBE8E918D6, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x3C3B6F69EC389, 0x3B5B2F0F2DCFE, 0x0000000000000, 0x0000000000000, 0x66C31D8AFD9F6, 0x5EA19EB5ED259, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x3CDEC47F6D4F8, 0x2E00D589FC9D1, 0x0000000000000, 0x0000000000000, 0x1C65524639BF0, 0x1B6572DF1635E, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x471983D92EE70, 0x12C887A8366B8, 0x0000000000000, 0x0000000000000, 0x163B727FFB4D8, 0x393F8A728C6AC, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x4F542CB56EAA0, 0x323C7E0774141, 0x0000000000000, 0x0000000000000, 0x36E59C4BC47FA, 0x2B9938D0D33E8, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x59F197CA61E7D, 0x2F9BE108C2A3E, 0x0000000000000, 0x0000000000000, 0x61B018A375D3F, 0x4DDEB9CF7ADB5, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x240CC8B57827F, 0x2262B1E883F14, 0x0000000000000, 0x0000000000000, 0x3F83FF7DDFAAB, 0x30F08BC3152BC, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x5824E9CBBB832, 0x27F2139C416B4, 0x0000000000000, 0x0000000000000, 0x5B051866F94B2, 0x75D4F77EDF9AC, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x285B558E84014, 0x18FAF6BE41EC7, 0x0000000000000, 0x0000000000000, 0x4BA35BC89EB4C, 0x6B1DD9385386E, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x49ECEDCF34990, 0x1400BB1D3558D, 0x0000000000000, 0x0000000000000, 0x408E00B580E26, 0x1DD07F254AD68, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x5827568226C1E, 0x45260DDE4EA64, 0x0000000000000, 0x0000000000000, 0x057AC559E1F64, 0x6D00B68F7ADB1, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x1001B1D56108F, 0x013566D1236E7, 0x0000000000000, 0x0000000000000, 0x2A33A266B86A5, 0x45F6FC0DC44FF, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x38E01CDEEC8BA, 0x04311B95A9D29, 0x0000000000000, 0x0000000000000, 0x7BA7B493C29E8, 0x5004BA204AB8A, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x0609E7EDDD03E, 0x3FF7970C64223, 0x0000000000000, 0x0000000000000, 0x076F3884430D5, 0x060229FEA0401, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x75CD046F2199A, 0x26D1FA47BD8BC, 0x0000000000000, 0x0000000000000, 0x2DB5EDA44C1ED, 0x6B8B16697DCEF, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x20CBC0EEF3CA4, 0x0280A97E6B7E2, 0x0000000000000, 0x0000000000000, 0x1E4DB882386AB, 0x25E811A82E82E, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x62D3287CD3FC7, 0x00445A6773F2B, 0x0000000000000, 0x0000000000000, 0x19F0FF42331D1, 0x7A19CAA348496, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x5D7DFE9ACE82A, 0x5F579F6E7A9B4, 0x0000000000000, 0x0000000000000, 0x154F360D6DE72, 0x151BB0FEB707B, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x482CC05D249F9, 0x488285A891E85, 0x0000000000000, 0x0000000000000, 0x5FFD535B4CE2F, 0x503B4FB720544, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x50F13FB351FDC, 0x6ABFA432E3D6A, 0x0000000000000, 0x0000000000000, 0x4CC717D122B7F, 0x3EE80BB277552, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x042C7FFE8B433, 0x1C304F9551A01, 0x0000000000000, 0x0000000000000, 0x2FB85ABB5A83B, 0x60D9AEA0DF89A, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x469A02D0B0B05, 0x10ACA3B112FB9, 0x0000000000000, 0x0000000000000, 0x62F291660CFCE, 0x2D592C0DBB55C, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x3F9CF66EA54AE, 0x23C45828B4F52, 0x0000000000000, 0x0000000000000, 0x543932EE568A0, 0x4C94E190825D6, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x2DC8A98E109C2, 0x187855C09C4E8, 0x0000000000000, 0x0000000000000, 0x6D6D6B275D3B8, 0x14684AF1A1DB9, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x1C502FE3EF020, 0x4C9570331E7BD, 0x0000000000000, 0x0000000000000, 0x0B8E1C6972B55, 0x25DFE8E0E6718, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x57FDE6E08D7E0, 0x66B5E44893D53, 0x0000000000000, 0x0000000000000, 0x024DCEA698C01, 0x31E14F3384F3B, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x1028C886A4579, 0x190AB1A695D10, 0x0000000000000, 0x0000000000000, 0x46FD95BE4761C, 0x3398632BCEA3A, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x0464B53F28C9F, 0x06132A14CD14D, 0x0000000000000, 0x0000000000000, 0x087AAC83E4751, 0x28B274368CA20, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x36BDFB444E56B, 0x39EF76F2BAFC6, 0x0000000000000, 0x0000000000000, 0x6F44D67193FE7, 0x4E1BDC4121A08, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x6C89F27E1BE99, 0x422A5C5338FB5, 0x0000000000000, 0x0000000000000, 0x26F1333DBFFA3, 0x40E4D21FD97F7, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x7A489978817A3, 0x351E8DE58CE5F, 0x0000000000000, 0x0000000000000, 0x1C5B1724AF17B, 0x24BD5ADED24C9, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x79ED4250879B1, 0x3FB28E71D7557, 0x0000000000000, 0x0000000000000, 0x781CF79975627, 0x0A130145C8D17, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x2A972A610A760, 0x1F790CBCD6570, 0x0000000000000, 0x0000000000000, 0x249E4E985A674, 0x70D9409246B10, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x0966CA60D40D5, 0x157FB2ABFF011, 0x0000000000000, 0x0000000000000, 0x65674B2F2A224, 0x25AF8691D7382, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x699276620DA46, 0x4EAB5B6FCB8FB, 0x0000000000000, 0x0000000000000, 0x4FC38D5BA403A, 0x0462C491B7FCC, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x60276A9A5B197, 0x55104F555E96A, 0x0000000000000, 0x0000000000000, 0x54F3390C1D322, 0x2A4A28D7C350F, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x3EB17A8E9AE68, 0x10DB8457EA56B, 0x0000000000000, 0x0000000000000, 0x48FA9E93DBA07, 0x329127528F911, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x656CEB8834358, 0x4E9021AFDC3D1, 0x0000000000000, 0x0000000000000, 0x2299D939FFE13, 0x64EF656A8E51B, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x3BC6C92A7D267, 0x08ECB62A69B6D, 0x0000000000000, 0x0000000000000, 0x63994136E7139, 0x52ACC9A6D9664, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x0543AEC7107BA, 0x138B82B721284, 0x0000000000000, 0x0000000000000, 0x3D2BCA2FFFF2F, 0x35C1BA8E581EC, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x76BB44D463D8F, 0x6F6B97448114D, 0x0000000000000, 0x0000000000000, 0x1D3AB2F682BBD, 0x198E98D3055C9, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x34C046F16CE1F, 0x0C51DFCB76BA4, 0x0000000000000, 0x0000000000000, 0x66B490C59174C, 0x26FE418511AF2, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x7C404CEF3CED2, 0x2B6E1F30BFDA9, 0x0000000000000, 0x0000000000000, 0x3A025E5DF5319, 0x43355CCCC0A33, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x2A942A93A9DA4, 0x378C4572E56F0, 0x0000000000000, 0x0000000000000, 0x1E30BBE2CFD5E, 0x32424E427C6A1, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x5BEF70EBC1F49, 0x727286EB6293D, 0x0000000000000, 0x0000000000000, 0x19DE9B54F8468, 0x38DDF87F0A1D6, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x6897E6BE699A9, 0x09336325A778F, 0x0000000000000, 0x0000000000000, 0x478F9B7873EFE, 0x2E725AA093181, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x14A9C01E9AC68, 0x57DB187434138, 0x0000000000000, 0x0000000000000, 0x36861F0CBD2F6, 0x6B63A21B0F559, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x3C020F1816558, 0x6104144A2496B, 0x0000000000000, 0x0000000000000, 0x413CBBBB3E19E, 0x52C822352B7E4, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x4A640E6CCC6E0, 0x28D22FB35A87C, 0x0000000000000, 0x0000000000000, 0x2952FA225197D, 0x4CCF1B0C552D7, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x5A448BA6A5238, 0x1D0B0B13A44E1, 0x0000000000000, 0x0000000000000, 0x718FA30B04E48, 0x623996E8F7F7F, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x4906F1E82B235, 0x323FC5D76714C, 0x0000000000000, 0x0000000000000, 0x78B3F4671A7CF, 0x2C2A25CE5403A, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x1AD1BA028FBE8, 0x08591BEFA48C2, 0x0000000000000, 0x0000000000000, 0x0172424E0C919, 0x2DFE3B4DAB98F, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x47C89CB65E42D, 0x2A6B7F0801C78, 0x0000000000000, 0x0000000000000, 0x234F940112733, 0x32A0E7E96EFD3, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x7BBD6251DBD2A, 0x5635D60405521, 0x0000000000000, 0x0000000000000, 0x48050A29A99F9, 0x2C945E503FB32, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x4F89D331D39BA, 0x5326A884A537B, 0x0000000000000, 0x0000000000000, 0x782289C58887C, 0x0827F4D690FA3, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x2426B14B36707, 0x6E07CBEEFF4A2, 0x0000000000000, 0x0000000000000, 0x41B11574965B9, 0x12F114FB55BF1, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x1669C1F567C1E, 0x0E260FBFC76AD, 0x0000000000000, 0x0000000000000, 0x6A71A56230347, 0x000F61218290B, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x07BA5A523E4F8, 0x1CD171FBA60FC, 0x0000000000000, 0x0000000000000, 0x148E7595500E1, 0x1F8B158AE050C, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x68E46BC8D9E8E, 0x1763E46D91B45, 0x0000000000000, 0x0000000000000, 0x3F3F98E6BA508, 0x06D79596A450B, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x5049F83839C03, 0x32DB007D7C573, 0x0000000000000, 0x0000000000000, 0x4CF9769F4986C, 0x5E6B70D92398B, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x31565D582F68C, 0x64A06054A260B, 0x0000000000000, 0x0000000000000, 0x2DBD280201533, 0x4FFAB65D04554, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x10AF73F63C1E0, 0x49D11E9A058A3, 0x0000000000000, 0x0000000000000, 0x50B82163B9739, 0x19237221BB888, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x285FED38D9FE3, 0x46FD541B055BF, 0x0000000000000, 0x0000000000000, 0x5570FD096CA02, 0x1B060FCEB25DC, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x36E75181020C9, 0x18F5EC97C0CA5, 0x0000000000000, 0x0000000000000, 0x3E28A0A87AC6C, 0x2F14F224B04B4, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x7D446E4935E42, 0x5A086DC2BD5E3, 0x0000000000000, 0x0000000000000, 0x6181A04933B40, 0x35B39E78A50EA, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x66F37AC1DC5B7, 0x36C343089B2E2, 0x0000000000000, 0x0000000000000, 0x6DEFF78797751, 0x11AF9227C6B4A, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x463B6CE4985E3, 0x04BAA0C7FC328, 0x0000000000000, 0x0000000000000, 0x7C87D005094E1, 0x244E4B75FFC96, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x628CD811D7A63, 0x78F062CDAB51B, 0x0000000000000, 0x0000000000000, 0x717ED58656390, 0x6E2F4CD19FDC2, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x488D966FACA67, 0x6D25AF58E3CE2, 0x0000000000000, 0x0000000000000, 0x2A3B149193795, 0x612969FEEFC3C, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x66B4B4F939242, 0x10A1B34766168, 0x0000000000000, 0x0000000000000, 0x330D49C4F4A23, 0x2A582A60251B2, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x3608047FEA32B, 0x114BFECC01701, 0x0000000000000, 0x0000000000000, 0x67DB3C60A5F73, 0x276E8298B1D60, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x4026107548E15, 0x683543B83AD4A, 0x0000000000000, 0x0000000000000, 0x156429A25D657, 0x523D898BFB45F, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x17058A37945D6, 0x6B53FDBFF4E87, 0x0000000000000, 0x0000000000000, 0x5CAC7ED328CB4, 0x3F0F05DA75810, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x1CFFBCCA553B5, 0x11821AC18A9C2, 0x0000000000000, 0x0000000000000, 0x69A2AB8E8B38D, 0x026DAFAEE92A5, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x691E5458D7707, 0x77D9DF5403B39, 0x0000000000000, 0x0000000000000, 0x39074F6FD7099, 0x2F6DF09C644ED, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x3EADA58F52580, 0x1D2FF83F0D69A, 0x0000000000000, 0x0000000000000, 0x679F364520260, 0x286CFEE71189A, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x52EAEA8C9AB22, 0x7BD04470FA640, 0x0000000000000, 0x0000000000000, 0x137EFE44EC65A, 0x370690067AEE8, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x562683B4E2F9E, 0x1C183FFFB4F59, 0x0000000000000, 0x0000000000000, 0x334A822A7FD8A, 0x5C8DAC829FECB, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x596BDEC483293, 0x40B001CD798C9, 0x0000000000000, 0x0000000000000, 0x054775940D7D0, 0x1E765EADE0A3A, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x4A74E384B19B2, 0x0D169F676ED50, 0x0000000000000, 0x0000000000000, 0x20455D241A2A6, 0x3A3DBFFF26C70, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x33694448BD9F9, 0x13D8971E04D2F, 0x0000000000000, 0x0000000000000, 0x358DEC67EDBA2, 0x5D72817463EF1, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x518F8D26EC029, 0x10F82A113C3EC, 0x0000000000000, 0x0000000000000, 0x012213F19904C, 0x2B29CA58E1018, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x0B5B4A96D8AC3, 0x6C287972F8530, 0x0000000000000, 0x0000000000000, 0x5DD4C60D2BD8B, 0x27B3B581E275F, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x0C67BA3694116, 0x246CD3A3DC384, 0x0000000000000, 0x0000000000000, 0x55B95CEC5C939, 0x5609F7D03A30A, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x362B683BB6EE7, 0x3B72ADB9E6F4D, 0x0000000000000, 0x0000000000000, 0x373F2E2A3D08F, 0x23A6C9BB773E1, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x4981FB393907F, 0x689EB7D674958, 0x0000000000000, 0x0000000000000, 0x63B6B4C1B665D, 0x6F2C0C214A1CC, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x3C7FC66D3389D, 0x4E40D383A1386, 0x0000000000000, 0x0000000000000, 0x1B01ADACDA2F7, 0x2EFA9DC41E206, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x66EABB0EFDA3C, 0x14A61A7CF8321, 0x0000000000000, 0x0000000000000, 0x361451D68F5CE, 0x14BA6C20FADD4, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x2665BA795DFC4, 0x7E8D529FF9F80, 0x0000000000000, 0x0000000000000, 0x189AB8E186C92, 0x3F585E9033578, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x68C7F55AF9B52, 0x60974736B87C5, 0x0000000000000, 0x0000000000000, 0x0CBEF38DDA379, 0x3F62D890F12C2, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x6A4542FE5D60E, 0x3A08B68AE7E27, 0x0000000000000, 0x0000000000000, 0x72CBBE249DA9F, 0x079762E396E36, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x3A9466554C8F6, 0x02A72BC2FED3D, 0x0000000000000, 0x0000000000000, 0x516E6B76D223A, 0x2124299C713A8, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x317EE9AAF5679, 0x42573DADAC167, 0x0000000000000, 0x0000000000000, 0x56F799ED02F1A, 0x337EFA013D7A9, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x24B4E66EF1075, 0x15EDCCF126529, 0x0000000000000, 0x0000000000000, 0x3191E87AE83D5, 0x23B261366DF9E, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x41382611514D1, 0x3220866ADB68E, 0x0000000000000, 0x0000000000000, 0x496273F529923, 0x229FF8E02F895, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x3332CCFE83FD6, 0x1007F0DDFB0AB, 0x0000000000000, 0x0000000000000, 0x1CB40E88AF789, 0x6DFF75EE999D1, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x0D314F3AE3481, 0x5120520E641A2, 0x0000000000000, 0x0000000000000, 0x72D80669702FD, 0x50E92A9EE589C, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x6CA4B7B9286E2, 0x4ED65FB2E6CC5, 0x0000000000000, 0x0000000000000, 0x71CCCC3BDB810, 0x56591B153B186, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x410FC996581DD, 0x261E1400888E1, 0x0000000000000, 0x0000000000000, 0x725F354BC2579, 0x710455C15864C, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x6B369BAB64DDB, 0x15EADFA801545, 0x0000000000000, 0x0000000000000, 0x13F6F6296170E, 0x2CCEF517AED82, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x72B30E471F7A4, 0x572FF4CD56DAD, 0x0000000000000, 0x0000000000000, 0x0943AEAA41CFE, 0x68487EEDBA7FC, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x6C7BDA98B9270, 0x68F6706B236F8, 0x0000000000000, 0x0000000000000, 0x3D5497BFE8C46, 0x7A8EE164A6A0B, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x52CF31A932A6B, 0x1EEF7478B18F7, 0x0000000000000, 0x0000000000000, 0x7AC187152A4E6, 0x0ED3FF3E6D3C4, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x0035EC581BD47, 0x5F10F8F7A3DC9, 0x0000000000000, 0x0000000000000, 0x56A4144BE0666, 0x2C0B92609C157, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x1F125030F0F7E, 0x34B7AA5281D38, 0x0000000000000, 0x0000000000000, 0x64008CCCE043C, 0x0D91C77EE802D, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x0F286A40F7C89, 0x1019F224046A4, 0x0000000000000, 0x0000000000000, 0x00E61C04A4CC8, 0x34998703E511B, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x6843883CA9597, 0x130B77F175678, 0x0000000000000, 0x0000000000000, 0x0EFECBD15DBC5, 0x6CDC13FA2E462, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x4F94D388AA388, 0x26E21E1F6355A, 0x0000000000000, 0x0000000000000, 0x4497756C89F2E, 0x5850235A47315, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x200AA9AF213CD, 0x70CE1B13E393A, 0x0000000000000, 0x0000000000000, 0x3BC945DB80B06, 0x756C4BB02BD7C, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x688F0F016EE34, 0x00CFBD51F0495, 0x0000000000000, 0x0000000000000, 0x14257A64CECB4, 0x0603EE86463FE, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x7B9F1A81381B1, 0x369150036BF49, 0x0000000000000, 0x0000000000000, 0x24F170B232C5A, 0x659D77D349FCE, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x431314E1D6C51, 0x04E9AF529835E, 0x0000000000000, 0x0000000000000, 0x1D6181D61FC2A, 0x2943BAC4188AC, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x617AFA006235C, 0x5A4D50D985946, 0x0000000000000, 0x0000000000000, 0x1EC63C1B7D074, 0x518BA17FC57A8, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x391187A580617, 0x1A5F718F9D15F, 0x0000000000000, 0x0000000000000, 0x07CF4E946E9A2, 0x42F396755FA4D, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x01BF731583872, 0x0386041B386F9, 0x0000000000000, 0x0000000000000, 0x6922D5916A911, 0x234B12438D6E1, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x3333978549491, 0x1EA1AC2AD82B0, 0x0000000000000, 0x0000000000000, 0x605BFD7A73BB3, 0x10783ECD57451, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x3AA9C39CDFD3A, 0x0887B7E33ECFF, 0x0000000000000, 0x0000000000000, 0x00B0DAE316D04, 0x7FD2B9BD5FC6E, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x4A082559D9D6B, 0x1FF32DEE0CA49, 0x0000000000000, 0x0000000000000, 0x31AE6FD4C360E, 0x2D4E557BC912E, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x5E0EE71FA597F, 0x46939DFF3969B, 0x0000000000000, 0x0000000000000, 0x67565632BE4D1, 0x6ADA61C4173A4, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x1BEE6887AB288, 0x56E469D9B090E, 0x0000000000000, 0x0000000000000, 0x720E6A06EEA28, 0x5A9730AD8EBA4, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x7FE056996C0E4, 0x650CD6CDA0A52, 0x0000000000000, 0x0000000000000, 0x4B44E4E9CB94D, 0x3C23048662147, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x480A54E94CA9C, 0x2332FF5CC0694, 0x0000000000000, 0x0000000000000, 0x5099A11BE2CC1, 0x623AF59DBB43D, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x3B832DAF35C6B, 0x73CDAD66F0A4B, 0x0000000000000, 0x0000000000000, 0x639D211FBC521, 0x12F41CC5AAE3F, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x2F220FCF821D2, 0x151FA60CB8D78, 0x0000000000000, 0x0000000000000, 0x5144E3A9FCDAF, 0x2A698E75A6CCD, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x616A9647D8D0E, 0x5994C25825366, 0x0000000000000, 0x0000000000000, 0x7C2040B45B4A8, 0x3B0B589813997, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x6499A831DCC04, 0x66BF4A17CDF01, 0x0000000000000, 0x0000000000000, 0x2C935DE8A3F21, 0x6D82CF1934647, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x5F8D82290E465, 0x6104C90E59EC6, 0x0000000000000, 0x0000000000000, 0x1894CFB3A8399, 0x6981D2FF51008, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x2B18B59370EE0, 0x3BEFB9F94EA5A, 0x0000000000000, 0x0000000000000, 0x79428B92D7B81, 0x77D111D57C3BB, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x0691573D87258, 0x77C3FF1EF72E1, 0x0000000000000, 0x0000000000000, 0x1BDEF49D853A9, 0x5EC3D6C17D064, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x7E148A1005B6D, 0x10C3B67B14FC7, 0x0000000000000, 0x0000000000000, 0x11D49929D5BA5, 0x184AFC05325C3, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x0605BEE025209, 0x7311A205DE4F7, 0x0000000000000, 0x0000000000000, 0x698E9AC76F0ED, 0x5464760B76CD7, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x3A565919DCAAE, 0x1F3074E11B692, 0x0000000000000, 0x0000000000000, 0x335B41F59F096, 0x427515FFB75FD, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x7DD319335846F, 0x51B31D09FC064, 0x0000000000000, 0x0000000000000, 0x2C91DEE39D2AB, 0x4BD2505EE6E8F, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x7617F27317D04, 0x141A681A30FB7, 0x0000000000000, 0x0000000000000, 0x724960486F25F, 0x645C0361B9F5F, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x6952148F72F4C, 0x6E64F8EF0E601, 0x0000000000000, 0x0000000000000, 0x0319EEEAB8A45, 0x2518A4D6E155D, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x1222597C6BDAA, 0x24C6F6E691A54, 0x0000000000000, 0x0000000000000, 0x324B20E598BF9, 0x281C09A9377A2, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x73325949CBEBF, 0x0A3D8D0FD6543, 0x0000000000000, 0x0000000000000, 0x483947E607237, 0x34BD4F4D4446B, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x60976E30FFE4E, 0x7D9EC3E98C7DD, 0x0000000000000, 0x0000000000000, 0x6723BEB7C467F, 0x4E9C97F0C5C93, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x3AB4AA1DD6120, 0x03399D1CF12A1, 0x0000000000000, 0x0000000000000, 0x1CDA260D3F1EE, 0x38480966B5B90, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x01AA4A49D5CDC, 0x70E555B28ECE3, 0x0000000000000, 0x0000000000000, 0x0F9010FAD8704, 0x1D1E6C0616292, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x09872C73EA53D, 0x25DB9D24E4992, 0x0000000000000, 0x0000000000000, 0x39B8D5DD43756, 0x07498C34FD284, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x2097C35A0B109, 0x21A9B1A3A38FD, 0x0000000000000, 0x0000000000000, 0x569B2EBB95D73, 0x236FB7DB5B702, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x13F63E2E2EEBB, 0x1518C3267A10B, 0x0000000000000, 0x0000000000000, 0x76EFF75026957, 0x3AAC202E9D996, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x4B8E076EE1FD9, 0x542E1AD060B49, 0x0000000000000, 0x0000000000000, 0x441A47AACF7CF, 0x2AE8871852FB9, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x2F5048F036620, 0x012C42D587245, 0x0000000000000, 0x0000000000000, 0x074C2B88E56DE, 0x7D7E253A9E1A8, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x0F73D6B388AA0, 0x42CD51485E44A, 0x0000000000000, 0x0000000000000, 0x4056769C2C52E, 0x5BAB9CF19D1EC, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x3B2C9C0E3195C, 0x08AD7AFDC2D78, 0x0000000000000, 0x0000000000000, 0x053110D7EC97B, 0x4B45714515EA0, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x309898AF80FCC, 0x13CA56172F1B7, 0x0000000000000, 0x0000000000000, 0x6500508762C88, 0x184EF33A1521D, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x20F83761FD35C, 0x651E017E334AE, 0x0000000000000, 0x0000000000000, 0x3CBC93CAEF7A8, 0x7A1D9CFD74657, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x7FE2E2D88EDB7, 0x19E12A00D6C65, 0x0000000000000, 0x0000000000000, 0x5A0F67B113090, 0x428F2CE9D64CC, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x52F5C0F91783A, 0x6BA734AC9C94D, 0x0000000000000, 0x0000000000000, 0x1DABDF223E538, 0x1B62E9E0174B9, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x3F8EEB3D86F19, 0x7C587D8A8029B, 0x0000000000000, 0x0000000000000, 0x652AC9BD8A216, 0x61B36BAA753A6, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x6B92C310BE8AE, 0x5E50B0D2E0D22, 0x0000000000000, 0x0000000000000, 0x6B2EDCE3ACC13, 0x04481F358FB50, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x1AA958044EBBB, 0x135CBE4F5FB78, 0x0000000000000, 0x0000000000000, 0x662ECF9649F4F, 0x32CD36E8B8248, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x452B2A68FFD41, 0x3A5A8CAAB0BA5, 0x0000000000000, 0x0000000000000, 0x7484DAAF06367, 0x48F522E990A99, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x5BA48BC0F4667, 0x7360027A522E4, 0x0000000000000, 0x0000000000000, 0x53EF9B3258791, 0x664DFC51ACBE9, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x2410F7678C95A, 0x33B43C76AC88C, 0x0000000000000, 0x0000000000000, 0x6A7BF7CBB4ACD, 0x019CC904767F2, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x65A4B2D55C0DC, 0x17793F6D3366A, 0x0000000000000, 0x0000000000000, 0x1DB1EF8A13E82, 0x6914D58BC6547, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x622A8B4D13FEC, 0x5298B406B8E70, 0x0000000000000, 0x0000000000000, 0x451238201F47A, 0x16265E3E933EB, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x53F566467788A, 0x1205C99305ECA, 0x0000000000000, 0x0000000000000, 0x0A5CBF209CC7F, 0x1C7293208414C, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x2050B15C45DB4, 0x066AF40422E72, 0x0000000000000, 0x0000000000000, 0x7682E53F5F1BA, 0x29A9B5190463A, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x25339C5952A34, 0x4ACB686E7748A, 0x0000000000000, 0x0000000000000, 0x7BC1150CEF618, 0x69A0548DCC4AE, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x2E680A3298367, 0x2D14745AF0570, 0x0000000000000, 0x0000000000000, 0x177C14625C501, 0x31DDBDB7F81AB, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x2FDD58EFBDBF0, 0x6818F6E3C78B6, 0x0000000000000, 0x0000000000000, 0x3409A4326964A, 0x3BFA9D5AD1DBB, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x2F00AE6451C0B, 0x6CF4F196701ED, 0x0000000000000, 0x0000000000000, 0x6A668BF426F65, 0x538D78647623F, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x46111375AF01D, 0x0E1D84A3C2CF3, 0x0000000000000, 0x0000000000000, 0x131179C45C78B, 0x1B7A130A565D5, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x79273B4F00B90, 0x1EB6F1378BAB4, 0x0000000000000, 0x0000000000000, 0x6B5CA02E54F18, 0x5C82213D91350, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x6B93A00B9AA49, 0x27C8052052A1A, 0x0000000000000, 0x0000000000000, 0x6248F36AD16C3, 0x314BF20427839, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x74B96E9F8605D, 0x384FDAE99EE4E, 0x0000000000000, 0x0000000000000, 0x7BC096BCD11FC, 0x67FED1209F540, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x1C0C60B8F1DC3, 0x000CB9EDBADEE, 0x0000000000000, 0x0000000000000, 0x1164FFFFA3408, 0x61A44BD5113B7, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x2E17DFA0AE7EF, 0x57E1BCAD7B7F7, 0x0000000000000, 0x0000000000000, 0x1F8C8189E5818, 0x7CCAB9D20B2EC, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x58E06A28AA796, 0x084A02FE27AB3, 0x0000000000000, 0x0000000000000, 0x006AA82763751, 0x29002D9266187, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x207E648741327, 0x03D17D6327731, 0x0000000000000, 0x0000000000000, 0x28CB276BE7979, 0x12159421EE2BF, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x3238AB930CC0D, 0x491A406F5F5EA, 0x0000000000000, 0x0000000000000, 0x377F70526EB79, 0x28F2E6BCCFDE1, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x0D945D753EF90, 0x298997E01C3CC, 0x0000000000000, 0x0000000000000, 0x6F23D200191E7, 0x40F0A1A77CB33, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x4B5F269403DCE, 0x65ACDAB1AD061, 0x0000000000000, 0x0000000000000, 0x28284D093ED53, 0x39293239DCBC1, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x0897CE46C0250, 0x34B79F59D1D60, 0x0000000000000, 0x0000000000000, 0x59EB683D43E01, 0x1E055FAA974C1, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x028AD7160233D, 0x140A5FA591F7B, 0x0000000000000, 0x0000000000000, 0x3D6EC65EF576E, 0x36ADE53B8DDCD, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x2806E84D17B52, 0x055050FCB51C3, 0x0000000000000, 0x0000000000000, 0x59E31EC5C2002, 0x54EB9EAE3976A, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x48DD8CA2941CC, 0x5C99418EF609F, 0x0000000000000, 0x0000000000000, 0x7FCF256E204A0, 0x43006F1860314, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x0F17E05A4A9DE, 0x0D6DEC208A356, 0x0000000000000, 0x0000000000000, 0x3F45258A71D56, 0x132EA4B338A9A, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x301C12180241B, 0x474A1A5B50FB2, 0x0000000000000, 0x0000000000000, 0x122A692035B97, 0x45333DF758E15, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x3D622C78694E0, 0x4247E5C4BA7DE, 0x0000000000000, 0x0000000000000, 0x30070B78E604E, 0x5B524FB41F4F0, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x017B8F3BD7441, 0x0D0802F165B03, 0x0000000000000, 0x0000000000000, 0x383BE942F5182, 0x1D4DCEA2CF8E0, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x0369C839884D0, 0x5BB0F26D20DAF, 0x0000000000000, 0x0000000000000, 0x5B5C82D87AFB0, 0x7DA32D9F310A2, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x53AA4C3D63678, 0x0E71AE3AD7457, 0x0000000000000, 0x0000000000000, 0x73C911A738475, 0x5377465E106DB, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x4D72676086FD2, 0x735C83341B089, 0x0000000000000, 0x0000000000000, 0x311D4FB4177C9, 0x46B3CC5497D62, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x504A3AC9A34D5, 0x7C90EE46A9A06, 0x0000000000000, 0x0000000000000, 0x4E3F150B3A83A, 0x4A5BBA4CC69B6, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x66EE34DBCD1A5, 0x3C41B3AC11BFA, 0x0000000000000, 0x0000000000000, 0x355B627189367, 0x48114A70CEF66, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x640A91B29B20F, 0x0E1A82C0C8025, 0x0000000000000, 0x0000000000000, 0x72B43960E4E07, 0x31FA9762FE481, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x72BFB0E271423, 0x3E809C1542216, 0x0000000000000, 0x0000000000000, 0x027FFB01E14B5, 0x6F7EB60A69F54, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x3ABCEDAB4F460, 0x3E1D5B49CEF12, 0x0000000000000, 0x0000000000000, 0x0C236360926C4, 0x3154B1D91B54B, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x7E608A262959C, 0x6D3202E4A6281, 0x0000000000000, 0x0000000000000, 0x1CADE82D36213, 0x1BF517D74569F, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x14378D2949628, 0x3A5C091DF3EE8, 0x0000000000000, 0x0000000000000, 0x5D577C3F259CE, 0x5DB2BCCF80089, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x261A5BB969256, 0x1456E28118C05, 0x0000000000000, 0x0000000000000, 0x6E7DAFA2BB064, 0x53B6F2DBC346C, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x117F3DE9A7B4B, 0x10EB4664E8A08, 0x0000000000000, 0x0000000000000, 0x31082DE08E850, 0x3260964DEB8CE, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x22610982C4905, 0x1F045732548C9, 0x0000000000000, 0x0000000000000, 0x6F9EBE7BE4CCF, 0x2F26A105C8AC7, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x5F20225E80F77, 0x54E38CE1FB4E1, 0x0000000000000, 0x0000000000000, 0x2976EA7A4BC25, 0x348073DE36AB1, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x68E01F14FF94F, 0x5EB514235AC60, 0x0000000000000, 0x0000000000000, 0x328A4C9F1275B, 0x192CC434DDC9A, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x6AF6C7A17622E, 0x1046320C5D726, 0x0000000000000, 0x0000000000000, 0x1D7C2A23504CF, 0x4CF9B817B6AE5, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x4C3B2B3B13A3A, 0x54F6D7F1C35E9, 0x0000000000000, 0x0000000000000, 0x55AB43B5AEAE3, 0x4E406941C8A80, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x1A34D3B21AC85, 0x100B9D767A70A, 0x0000000000000, 0x0000000000000, 0x36F301DED1FAC, 0x2D41645C32BEF, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x1547E005E7FC6, 0x0C8EFB00CB7A7, 0x0000000000000, 0x0000000000000, 0x6EC6F52FDBDC6, 0x2EB0D4D2324F6, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x4604F0A03DB82, 0x72205F37C737E, 0x0000000000000, 0x0000000000000, 0x3BA28A5B51831, 0x136BE2A8B579E, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x61DC3BD1FEA6A, 0x2DBC22B1BC64D, 0x0000000000000, 0x0000000000000, 0x094097DF38570, 0x73529C419DF11, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x3F6415B855264, 0x34120EA76A32D, 0x0000000000000, 0x0000000000000, 0x1094C140F859E, 0x61025EC905347, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x2776C30EC3740, 0x15967D62130E8, 0x0000000000000, 0x0000000000000, 0x07E70E3CA924E, 0x5787CBD3A78B9, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x7F73DA4D07646, 0x11C9990B699FE, 0x0000000000000, 0x0000000000000, 0x134DFFA2E4EDD, 0x1C993BE4CD9A4, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x3E7A1B5D34A73, 0x1BE517B568A92, 0x0000000000000, 0x0000000000000, 0x29464DFD18B57, 0x46735FC121667, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x1D8E13480824F, 0x0D2B97E3FE297, 0x0000000000000, 0x0000000000000, 0x48B61E5720D08, 0x6ED34554FC6D1, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x26196F34F7154, 0x112DA200C66EB, 0x0000000000000, 0x0000000000000, 0x3C87E187CD777, 0x5B5375B97A0B1, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x0DB54BED078F5, 0x0B3A0A82B9444, 0x0000000000000, 0x0000000000000, 0x6E3A0441BE6C0, 0x287E68B3603B6, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x4653636F0350B, 0x0CCB35B59EC24, 0x0000000000000, 0x0000000000000, 0x6B2567A66D615, 0x1890C57295D83, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x0E836A0D229F5, 0x133965F8DF785, 0x0000000000000, 0x0000000000000, 0x2E268F0519CEC, 0x394BE43E6D25F, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x42AD8720AE16F, 0x5D8E24375D96A, 0x0000000000000, 0x0000000000000, 0x2462D99E92D91, 0x34D841237D9D7, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x5D7E83E19C78A, 0x6FEA37A0C2B61, 0x0000000000000, 0x0000000000000, 0x27132CDA15D0C, 0x61254AF459C61, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x6159CBE1CF9CA, 0x3D28980744990, 0x0000000000000, 0x0000000000000, 0x3EC01B0331827, 0x1412A34F84E3D, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x0AAA6866377A2, 0x0FDFEDC081CA2, 0x0000000000000, 0x0000000000000, 0x2F198D7FD9F18, 0x3B98253716545, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x663BBE562AA6C, 0x506F488C5193C, 0x0000000000000, 0x0000000000000, 0x5DE953A79DBDF, 0x1B13967D946FE, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x06F481EFC9444, 0x099A64516750D, 0x0000000000000, 0x0000000000000, 0x636D3AAB0A138, 0x21E20DFE45EF5, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x5577D29DF6A54, 0x13A0C8A1E333C, 0x0000000000000, 0x0000000000000, 0x76433A5CEEAEE, 0x21DCAE5A8BBA4, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x2E0EEF892E0DB, 0x56A892FC47782, 0x0000000000000, 0x0000000000000, 0x370A3650DABBA, 0x3FE05006274FA, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x4B91D1311ECF5, 0x5C445D3EF91F6, 0x0000000000000, 0x0000000000000, 0x230DC0C0A2E2E, 0x7CFF83FDD960E, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x01F1FF286BA97, 0x3C722B15BB70A, 0x0000000000000, 0x0000000000000, 0x50E685616F964, 0x563372168937C, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x7E71409309BCD, 0x5A7D50476C530, 0x0000000000000, 0x0000000000000, 0x6570626A9E521, 0x12E3339A313B5, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x668297754E6DC, 0x23945B73380CF, 0x0000000000000, 0x0000000000000, 0x30FB598B20A63, 0x2B66239FA7D9F, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x1B3062EE5820C, 0x1F71EC13CC903, 0x0000000000000, 0x0000000000000, 0x5E41F88249742, 0x288E5A622DE0E, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x71FE78B290068, 0x51AA550CA22E0, 0x0000000000000, 0x0000000000000, 0x57B5BE9066B75, 0x4B22F42DFDF7C, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x3204C225558B6, 0x717F65CC8CA6D, 0x0000000000000, 0x0000000000000, 0x7707FE5A5EA63, 0x29043977906FC, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x352D6A68E5A47, 0x2A2419074741C, 0x0000000000000, 0x0000000000000, 0x7A28CF9616932, 0x5BA7840C69336, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x0B1FA53A4A7A3, 0x11DE4D96D3D78, 0x0000000000000, 0x0000000000000, 0x0B40DF7F4F819, 0x6BEBF4F6883B3, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x730368B7130D0, 0x0E546D96C321B, 0x0000000000000, 0x0000000000000, 0x10BDC372D783D, 0x1A7A3005BB0F5, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x2E9A1C5CF2471, 0x54059CDA9774D, 0x0000000000000, 0x0000000000000, 0x261B4AD0E4D5D, 0x28D921D882BDB, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x37D1551501956, 0x658D4785A0AA4, 0x0000000000000, 0x0000000000000, 0x2CFC5F1F52248, 0x1683F7D1E3FE3, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x72446BA60F753, 0x0BB3845677AE5, 0x0000000000000, 0x0000000000000, 0x784E5BB6C15D5, 0x7B22C6340471E, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x00018D5EF9D08, 0x5DED1573AD88A, 0x0000000000000, 0x0000000000000, 0x336C20B25FB8E, 0x41F92078E11AF, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x6CECA146B6530, 0x63897952A31FD, 0x0000000000000, 0x0000000000000, 0x5B1A9536A81C9, 0x2DA4C1B1A29AE, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x1EA8E48222A26, 0x16B18D5740193, 0x0000000000000, 0x0000000000000, 0x122F29B0C6D79, 0x345E2EC1096D6, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x72787E2844EAD, 0x1F1983DFFE2AE, 0x0000000000000, 0x0000000000000, 0x144E4F79C8121, 0x222062FCED153, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x59B97B4A2F1B9, 0x698DE83DB5AC3, 0x0000000000000, 0x0000000000000, 0x7BDC0F9136723, 0x1AB5A5D5549C3, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x7E012D792050C, 0x0CF31C426F8D3, 0x0000000000000, 0x0000000000000, 0x0B0966ACBE5F7, 0x6779C3C73A0BE, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x18E77B9A232F9, 0x1A320D8633ADA, 0x0000000000000, 0x0000000000000, 0x0C31C03F524D6, 0x14563F55D62CF, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x21866435703F5, 0x19AD88FEAD570, 0x0000000000000, 0x0000000000000, 0x797E1EF87D338, 0x11A8073322753, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x2EC29815AA350, 0x0797D2E7C94FA, 0x0000000000000, 0x0000000000000, 0x216866D19F390, 0x220A3861B29F1, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x39B4C9D465C67, 0x2A4DAEBDB0210, 0x0000000000000, 0x0000000000000, 0x00361ED60EAB9, 0x335B27F00F798, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x7E9B577A85760, 0x62B72BE054ADB, 0x0000000000000, 0x0000000000000, 0x340BE6CD11113, 0x37EFC29E00BE3, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x78AB91E35D4F8, 0x4B296C7B56CFF, 0x0000000000000, 0x0000000000000, 0x23D7A6B039F32, 0x1C2D9BBCD463F, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x6537AB4E6B0A6, 0x2257AF71700A4, 0x0000000000000, 0x0000000000000, 0x36E1F3C313ED2, 0x7EA91E0A6943E, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x0ED36E307448C, 0x63C7E55D6B3C1, 0x0000000000000, 0x0000000000000, 0x197B9A2E9DFB7, 0x26030C1739BBF, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x376BF61D8466E, 0x169DADFD6BFB6, 0x0000000000000, 0x0000000000000, 0x2503CF2ACAC08, 0x19B21F861821E, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x05783913407B9, 0x36AE94E5F59BB, 0x0000000000000, 0x0000000000000, 0x4A930301A7C57, 0x11BB435B1AD8A, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x1A9344F9CA0E6, 0x6C28B8E871781, 0x0000000000000, 0x0000000000000, 0x5C32BDD55F647, 0x37ECB12D555B7, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x5120C2CD08E7E, 0x1B7E66BF158B0, 0x0000000000000, 0x0000000000000, 0x2E6629E63AB00, 0x78C4D24DE0DE8, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x2710627B1F33E, 0x7C1DC630C9C70, 0x0000000000000, 0x0000000000000, 0x49BEF61197B91, 0x181EFE64FD87E, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x1211894620BED, 0x184C872D1D4DA, 0x0000000000000, 0x0000000000000, 0x43C72622B0696, 0x1BB4BC293AC28, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x4467BD644FD07, 0x093A91B555D25, 0x0000000000000, 0x0000000000000, 0x710D8C39DA464, 0x261BF734EC247, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x5F2955372E3CE, 0x257416F7290F1, 0x0000000000000, 0x0000000000000, 0x06AF55337A9A2, 0x44AC8EC8BB772, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x56EB326366F19, 0x18EC1AF52C805, 0x0000000000000, 0x0000000000000, 0x7E4E6C666EBDF, 0x625DE5B7D3894, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x25EE96B379E96, 0x108352FFCC5A7, 0x0000000000000, 0x0000000000000, 0x02537C789FA14, 0x65B46FB0BD1EC, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x52FBAC0B71DEC, 0x7E2F7D2691CEF, 0x0000000000000, 0x0000000000000, 0x16E6FB6728E61, 0x2467821A9F159, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x52863C469E908, 0x7B5FE4DAE3592, 0x0000000000000, 0x0000000000000, 0x3AF978980976B, 0x2429D95BBAECC, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x6508FFB4C745F, 0x0F6DABF5CD0B6, 0x0000000000000, 0x0000000000000, 0x1D346B72594EB, 0x3290F410F9219, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x1A1196432E6C9, 0x08CA6787ED05D, 0x0000000000000, 0x0000000000000, 0x7CC77CD4874C5, 0x5473CE16C8E3C, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x557181F6DBBF9, 0x429AA490E0515, 0x0000000000000, 0x0000000000000, 0x08FE18B177811, 0x7F5389597E20F, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x5C7E21270D3F1, 0x4261511F9446B, 0x0000000000000, 0x0000000000000, 0x3EE62EC2F7D41, 0x7FB444A229102, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x6673EA76B5A99, 0x52BF1D8CAA87A, 0x0000000000000, 0x0000000000000, 0x4FBD85A58A7D2, 0x7E4A4913170C5, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x73B51E5FD45D7, 0x1D2CE69B9EF92, 0x0000000000000, 0x0000000000000, 0x05D0C8BAD496C, 0x58A6309EC91FF, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x61322360E2886, 0x043545DD7747E, 0x0000000000000, 0x0000000000000, 0x4A608342FB6FB, 0x2448C007B1C44, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x375B5268BB17B, 0x0C5EECAB45271, 0x0000000000000, 0x0000000000000, 0x15E3B4BF61197, 0x2543EED9C2224, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x7A08FF9A008C7, 0x4331A8C9517F6, 0x0000000000000, 0x0000000000000, 0x50825F80EE92A, 0x2ECE28C90145D, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x6340BDF935F41, 0x64A4A2F305E93, 0x0000000000000, 0x0000000000000, 0x7F70C4AC6140A, 0x533DD36BCED36, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x502CC0433420C, 0x72DF2C65C3843, 0x0000000000000, 0x0000000000000, 0x298F42BD4D437, 0x12FFF9D97B567, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x1BDF6CB1E7D5B, 0x451B5F5AC38E6, 0x0000000000000, 0x0000000000000, 0x72365B73C239D, 0x45E30A2B1FE08, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x267BAA792C917, 0x0B0E269184640, 0x0000000000000, 0x0000000000000, 0x4BE064332F18F, 0x213C8F10A7437, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x114BE8A9D126F, 0x6409581E5D21A, 0x0000000000000, 0x0000000000000, 0x21C75CEAAB565, 0x10B0A8EBFA71B, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x259B20CB14898, 0x3492971BF4557, 0x0000000000000, 0x0000000000000, 0x33249A58B144E, 0x37FE227282B81, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x5486D43405E51, 0x648635EDBAA88, 0x0000000000000, 0x0000000000000, 0x23DB56C98F682, 0x4A3A24D9394E3, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x58CDD36D9684D, 0x59C95272DE0F9, 0x0000000000000, 0x0000000000000, 0x4E0C93A4FB723, 0x5CFAD1C6F825E, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x66F55407BDC41, 0x143B8B7DD226A, 0x0000000000000, 0x0000000000000, 0x102E4344DF373, 0x04FFC3E1BB168, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x0D2BEEBCB4285, 0x09BEB3DFE8C69, 0x0000000000000, 0x0000000000000, 0x0829BBEDBA427, 0x2AC41FFCD2223, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x0EBAC85A4203A, 0x67256072915EF, 0x0000000000000, 0x0000000000000, 0x0C5E6BB51D8BA, 0x60A1A30620A6E, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x6681A23FF5EC3, 0x64133F0008179, 0x0000000000000, 0x0000000000000, 0x22D4383BD70AF, 0x05CBDB5152475, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x69AA6A91C650D, 0x488002226DA0D, 0x0000000000000, 0x0000000000000, 0x47779D9D7905A, 0x0194F9A2ABD76, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x6EB81E24A0F51, 0x73B37D26FD4D2, 0x0000000000000, 0x0000000000000, 0x65A5A53810543, 0x5EC46F9274DD0, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x436611F3E2B76, 0x34734B6997E84, 0x0000000000000, 0x0000000000000, 0x504AD4834F466, 0x32D780D9C0B1E, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x13910DC334517, 0x1465C417C0D6C, 0x0000000000000, 0x0000000000000, 0x490DE4C9EFC69, 0x3773F2ABE36BF, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x13F2B4DC892CB, 0x3A6CE75C1AD06, 0x0000000000000, 0x0000000000000, 0x0BFF3C06A4B1D, 0x0AE4CDA0798F8, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x5D436D685A89A, 0x405CBFA62888E, 0x0000000000000, 0x0000000000000, 0x3EEADB58D5566, 0x6B67814A19E6A, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x0448AA7F46CEF, 0x711085872AEAA, 0x0000000000000, 0x0000000000000, 0x2FCBADB94220F, 0x66223EC4F7D02, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x6067C8A3F7B77, 0x34C83195C499A, 0x0000000000000, 0x0000000000000, 0x6D81D163054AD, 0x0986C52162154, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x461456B492E1C, 0x0E75FEADF4628, 0x0000000000000, 0x0000000000000, 0x1D994A891C885, 0x0EA487FD49A18, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x30ADA6D94BCD1, 0x1E3673D46A975, 0x0000000000000, 0x0000000000000, 0x28B5AB82EABC9, 0x30CF733A96986, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x53E2366CF6F8F, 0x11BE1F2A20A27, 0x0000000000000, 0x0000000000000, 0x5E5AE73D173ED, 0x36DBA67DA4309, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x57451481F9452, 0x1F2108F573621, 0x0000000000000, 0x0000000000000, 0x1C8904D55C04A, 0x4024E4BF1A911, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x50B7678A8F0A8, 0x2DA3C6694B193, 0x0000000000000, 0x0000000000000, 0x745313F5B28D5, 0x12DA8ADB72F79, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x48291A699BD14, 0x38601E256C4B4, 0x0000000000000, 0x0000000000000, 0x0DA6AA0C272BB, 0x4E818DD236657, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x6D1A58A0948EA, 0x13C794C7FC29F, 0x0000000000000, 0x0000000000000, 0x638FBC3975D39, 0x2209DD0FEF1BC, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x194F949C11F2D, 0x16C46B724B12F, 0x0000000000000, 0x0000000000000, 0x33968A1C4D109, 0x2FF8C6280B391, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x4BD8482491306, 0x2816C526A1618, 0x0000000000000, 0x0000000000000, 0x46BBCE3D25AC8, 0x1A740E7B4CB77, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x0F66CC1E36DFF, 0x582A4F95160BE, 0x0000000000000, 0x0000000000000, 0x44AF00448B197, 0x138D8265C368C, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x62E27BA6B1ECD, 0x6BF6255AF76FA, 0x0000000000000, 0x0000000000000, 0x173425D10B801, 0x35183C6DC7CF4, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x46EF5DECD700A, 0x15625F9195351, 0x0000000000000, 0x0000000000000, 0x059C3AB92DC2C, 0x11364A377F2CA, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x12C2AA04F77B2, 0x1866197B26459, 0x0000000000000, 0x0000000000000, 0x289BDCF36E2ED, 0x66AB52F5F13EB, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x021EE31EFCD44, 0x1E05837C18F26, 0x0000000000000, 0x0000000000000, 0x4F23CA48811AE, 0x231B0AFCEC62F, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x600E45DE68B34, 0x2BBC670DF3D43, 0x0000000000000, 0x0000000000000, 0x41FEBC13C8B96, 0x30486285395D8, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x0D90699105E03, 0x1B2B10C2544E7, 0x0000000000000, 0x0000000000000, 0x02C6A97F918A7, 0x599666C8C9C32, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x59E10EBB84221, 0x7FA74F6A05193, 0x0000000000000, 0x0000000000000, 0x7295FEBC235BB, 0x4F1ED974EB9E4, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x5A66AA2DCE04B, 0x0CFDA89B21E7E, 0x0000000000000, 0x0000000000000, 0x562B779A1BFE0, 0x7C535A2E79FD1, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x2A401CD7E36A2, 0x12AB099EFE4F8, 0x0000000000000, 0x0000000000000, 0x192DF03C12BDB, 0x4BACF7AD5739B, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x3A0487E77E919, 0x199EF6BDF0B3A, 0x0000000000000, 0x0000000000000, 0x4A482BDD19564, 0x2DDEE6DC913FA, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x735057A183DDE, 0x2F623AD844C53, 0x0000000000000, 0x0000000000000, 0x0B099FFDC6476, 0x6100396726FE8, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x46EB79C907F3B, 0x13BE01BE316F6, 0x0000000000000, 0x0000000000000, 0x1640507C5D4DD, 0x5DAD88DAC8C94, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x408252BAB921F, 0x02EAC7D7EAFCA, 0x0000000000000, 0x0000000000000, 0x5A37E8BE64397, 0x22E997ED6188B, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x3FB814731FD53, 0x381A82D68F061, 0x0000000000000, 0x0000000000000, 0x661907CC38B5C, 0x06485055ED1AF, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x439635171E8F5, 0x51B6BD5345B07, 0x0000000000000, 0x0000000000000, 0x29791D968CDF3, 0x5596B4CE71D70, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x7F81D17627822, 0x1DCE47719BF6B, 0x0000000000000, 0x0000000000000, 0x13C3C2AF3DB79, 0x2449AB6B4AE3C, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x5F30F9CD24720, 0x70A114265D15F, 0x0000000000000, 0x0000000000000, 0x318ECC4992F60, 0x2E675E48C6198, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x1F67D793267FE, 0x6BC9D91B2B7C1, 0x0000000000000, 0x0000000000000, 0x45356CE15D22A, 0x44CC7E56F3433, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x35F8790D3FA8B, 0x168EF01AFCCCE, 0x0000000000000, 0x0000000000000, 0x06EE7F4760F48, 0x2A7F91144E90F, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x716BFC7222716, 0x348866CCCEC4B, 0x0000000000000, 0x0000000000000, 0x6A8417DC8DA2A, 0x70FB20A1C7EDE, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x2E99BDF8B0BC6, 0x340B0B46A1F38, 0x0000000000000, 0x0000000000000, 0x2CC4D9F5B643F, 0x56EA19DBF7A73, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x251075EEA9750, 0x0E34D4F0A2B52, 0x0000000000000, 0x0000000000000, 0x23D312CE0F582, 0x24680FCB30261, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x0B6E2A0D689D3, 0x2BC3B2B9C9146, 0x0000000000000, 0x0000000000000, 0x00872AAC66383, 0x1C978558B6C21, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x39A517FB8155E, 0x67B29E251123E, 0x0000000000000, 0x0000000000000, 0x02ACF30721493, 0x68BD2C2920569, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x1C037BE959CF8, 0x716CD32FA5598, 0x0000000000000, 0x0000000000000, 0x0F2F46298A20A, 0x0D45CED11FC80, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x595A0077BEB59, 0x4AADABB6F4694, 0x0000000000000, 0x0000000000000, 0x6FA25DD2DC645, 0x7B0FFFD4026BE, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x49F5CFA677330, 0x229258EF5AC84, 0x0000000000000, 0x0000000000000, 0x4DBDA5CCC8014, 0x50487FEDD0295, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x251EE20841E8C, 0x12398C1C26A2C, 0x0000000000000, 0x0000000000000, 0x0F724D04A2006, 0x15C5AE9D593F6, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x3D54EFBFFF1CC, 0x495FDBAEDC5DB, 0x0000000000000, 0x0000000000000, 0x3E69EBB8DA104, 0x28CBEB8940DAF, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x6EFFA25C054DE, 0x0CE0156854BD8, 0x0000000000000, 0x0000000000000, 0x31E0A9D628162, 0x62D9C97B5DAE2, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x7A69BF8BEC142, 0x0EB9B94AC08F1, 0x0000000000000, 0x0000000000000, 0x03EB818709A02, 0x4FF061AF69A11, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x6D6B083A3784E, 0x18BDAA75539C2, 0x0000000000000, 0x0000000000000, 0x4E0A539442661, 0x59140C0708B06, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x3E9D40ACF98F4, 0x7851AAC34D602, 0x0000000000000, 0x0000000000000, 0x2F5E5979324FD, 0x60EEFCEA0824C, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x3A507E67CA6CA, 0x1F28012421F91, 0x0000000000000, 0x0000000000000, 0x2473B6B600E15, 0x2DE62FB3A830E, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x2C6A7AA2A6524, 0x7B457C6698106, 0x0000000000000, 0x0000000000000, 0x35F01E76DA972, 0x6359D9CF4B20F, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x6DFD601CB780E, 0x1383423E00C8A, 0x0000000000000, 0x0000000000000, 0x06761600BB8DC, 0x3D23F8648C0F3, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x3DF23E55D4263, 0x1F4D29405E28D, 0x0000000000000, 0x0000000000000, 0x61F1150306AC2, 0x712F0F94D3EA4, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x1A914BF3B78EC, 0x5FDF5FC1F445C, 0x0000000000000, 0x0000000000000, 0x666FBB14798F7, 0x1478604BAA77E, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x134F3DE5DEA43, 0x11BA943A01D6A, 0x0000000000000, 0x0000000000000, 0x1AD9D95F10044, 0x62AC8607F31C3, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x640FAD10A5203, 0x1B95B3ECAC93B, 0x0000000000000, 0x0000000000000, 0x73784328B2215, 0x1BD53BDDBA029, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } },
+  { { 0x7494F6AC4C3FA, 0x467E48647F169, 0x0000000000000, 0x0000000000000, 0x1882A3940CC20, 0x39C308D2A1594, 0x7FFFFFFFFFFFE, 0x4552D58173700 },
+    { 0x2891B462099D4, 0x2B6C9E9FD93AC, 0x0000000000000, 0x0000000000000, 0x19202454B1319, 0x1C9EAAB8B9254, 0x7FFFFFFFFFFFF, 0x0FF9ABB1784DE },
+    { 0x776E9825CBE19, 0x636984DABEF71, 0x0000000000000, 0x0000000000000, 0x6C6434F30980A, 0x0513ED978331D, 0x7FFFFFFFFFFFF, 0x25535CF7E8A09 },
+    { 0x33C4B6039BE43, 0x4B31BB61069AC, 0x0000000000000, 0x0000000000000, 0x1CB120743100E, 0x68021888A0CCF, 0x7FFFFFFFFFFFF, 0x4956CBE843109 },
+    { 0x04ED41CC3990B, 0x58D41E1E5DA9C, 0x0000000000000, 0x0000000000000, 0x04382C0A6AECB, 0x4E68D3BBA829A, 0x7FFFFFFFFFFFF, 0x086128F3EC465 },
+    { 0x7592B1AD85F75, 0x1D1229965AF60, 0x0000000000000, 0x0000000000000, 0x5B17A7EBBD79A, 0x2814F2F55F579, 0x7FFFFFFFFFFFF, 0x27BF6A7688190 } }
+};
+
+#endif
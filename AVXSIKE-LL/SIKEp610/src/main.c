@@ -15,6 +15,8 @@
 #include "utils.h"
 #include "testvec.h"
 #include <string.h>
+#include <unistd.h>
+#include <sys/wait.h>
 
 // the function of measuring CPU cycles 
 extern uint64_t read_tsc();
@@ -49,7 +51,9 @@ void test_fp()
   uint64_t a51[VNWORDS], b51[VNWORDS], r51[VNWORDS];
   __m512i a_8x1w[VNWORDS], b_8x1w[VNWORDS], r_8x1w[VNWORDS], z_8x1w[2*VNWORDS];
   __m512i a_4x2w[VGWORDS], b_4x2w[VGWORDS], r_4x2w[VGWORDS], z_4x2w[3*VGWORDS];
-  int i;
+  __m512i a_1x8w[2], b_1x8w[2], r_1x8w[2];
+  uint64_t z64[2*NWORDS_FIELD], m64[3][NWORDS_FIELD], s64[2][NWORDS_FIELD];
+  int i, wrong;
 
   mpi_conv_64to51(a51, a64, VNWORDS, NWORDS_FIELD);
   mpi_conv_64to51(b51, b64, VNWORDS, NWORDS_FIELD);
@@ -64,6 +68,10 @@ void test_fp()
     b_4x2w[i] = VSET(0, 0, 0, 0, 0, 0, b51[i+VGWORDS], b51[i]);
   }
 
+
+  a_1x8w[0] = _mm512_loadu_si512(a51); a_1x8w[1] = _mm512_maskz_loadu_epi64(0x0F, &a51[8]);
+  b_1x8w[0] = _mm512_loadu_si512(b51); b_1x8w[1] = _mm512_maskz_loadu_epi64(0x0F, &b51[8]);
+
   // 8x1w Mont mul 
   mp_mul_8x1w(z_8x1w, a_8x1w, b_8x1w);
   rdc_mont_8x1w(r_8x1w, z_8x1w);
@@ -71,6 +79,7 @@ void test_fp()
   get_channel_8x1w(r51, r_8x1w, 0);
   mpi_conv_51to64(r64, r51, NWORDS_FIELD, VNWORDS);
   mpi_print("* 8x1w MONT MUL R: ", r64, NWORDS_FIELD);
+  memcpy(m64[0], r64, sizeof(r64));
 
   // 4x2w Mont mul
   mp_mul_4x2w(z_4x2w, a_4x2w, b_4x2w);
@@ -80,6 +89,37 @@ void test_fp()
   carryp(r51);
   mpi_conv_51to64(r64, r51, NWORDS_FIELD, VNWORDS);
   mpi_print("* 4x2w MONT MUL R: ", r64, NWORDS_FIELD);
+  memcpy(m64[1], r64, sizeof(r64));
+
+  // 1x8w Mont mul
+  fpmul_mont_1x8w(r_1x8w, a_1x8w, b_1x8w);
+
+  _mm512_storeu_si512(r51, r_1x8w[0]); _mm512_mask_storeu_epi64(&r51[8], 0x0F, r_1x8w[1]);
+  carryp(r51);
+  mpi_conv_51to64(r64, r51, NWORDS_FIELD, VNWORDS);
+  mpi_print("* 1x8w MONT MUL R: ", r64, NWORDS_FIELD);
+  memcpy(m64[2], r64, sizeof(r64));
+
+  // 8x1w Mont sqr, and the 1x8w one, which is the 1x8w Mont mul with b = a
+  mp_mul_8x1w(z_8x1w, a_8x1w, a_8x1w);
+  rdc_mont_8x1w(r_8x1w, z_8x1w);
+
+  get_channel_8x1w(r51, r_8x1w, 0);
+  mpi_conv_51to64(s64[0], r51, NWORDS_FIELD, VNWORDS);
+  mpi_print("* 8x1w MONT SQR R: ", s64[0], NWORDS_FIELD);
+
+  fpmul_mont_1x8w(r_1x8w, a_1x8w, a_1x8w);
+
+  _mm512_storeu_si512(r51, r_1x8w[0]); _mm512_mask_storeu_epi64(&r51[8], 0x0F, r_1x8w[1]);
+  carryp(r51);
+  mpi_conv_51to64(s64[1], r51, NWORDS_FIELD, VNWORDS);
+  mpi_print("* 1x8w MONT SQR R: ", s64[1], NWORDS_FIELD);
+
+  wrong  = memcmp(m64[0], m64[1], sizeof(m64[0])) | memcmp(m64[0], m64[2], sizeof(m64[0]));
+  wrong |= memcmp(s64[0], s64[1], sizeof(s64[0]));
+
+  if (wrong == 0) printf("\x1b[32m EQUAL!\x1b[0m\n");
+  else            printf("\x1b[31m NOT EQUAL!\x1b[0m\n");
 
   // ---------------------------------------------------------------------------
   // measure timings 
@@ -92,6 +132,16 @@ void test_fp()
   LOAD_CACHE(mp_mul_4x2w(z_4x2w, a_4x2w, b_4x2w), ITER_M);
   MEASURE_TIME(mp_mul_4x2w(z_4x2w, a_4x2w, b_4x2w), ITER_L);
   printf("* 4x2w INT MUL: %ld\n", diff_cycles);
+
+  puts("");
+
+  LOAD_CACHE(fpmul_mont_1x8w(r_1x8w, a_1x8w, b_1x8w), ITER_M);
+  MEASURE_TIME(fpmul_mont_1x8w(r_1x8w, a_1x8w, b_1x8w), ITER_L);
+  printf("* 1x8w MONT MUL: %ld\n", diff_cycles);
+
+  LOAD_CACHE((mul610_asm(a64, b64, z64), rdc610_asm(z64, r64)), ITER_M);
+  MEASURE_TIME((mul610_asm(a64, b64, z64), rdc610_asm(z64, r64)), ITER_L);
+  printf("* x64 MONT MUL (mul610_asm + rdc610_asm): %ld\n", diff_cycles);
 }
 
 void test_fpx()
@@ -1207,14 +1257,22 @@ void test_sidh()
   printf("* SecAgrB: %ld\n", diff_cycles);
 }
 
+#define DEC_MANY 11
+
 void test_sike()
 {
-  int i, wrong = 0;
+  int i, j, wrong = 0;
+  unsigned int c;
   unsigned char sk[CRYPTO_SECRETKEYBYTES] = { 0 };
   unsigned char pk[CRYPTO_PUBLICKEYBYTES] = { 0 };
   unsigned char ct[CRYPTO_CIPHERTEXTBYTES] = { 0 };
   unsigned char ss[CRYPTO_BYTES] = { 0 };
   unsigned char ss_[CRYPTO_BYTES] = { 0 };
+  prepared_pk_t ppk;
+  static unsigned char pks[3][CRYPTO_PUBLICKEYBYTES], sks[DEC_MANY][CRYPTO_SECRETKEYBYTES];
+  static unsigned char cts[DEC_MANY][CRYPTO_CIPHERTEXTBYTES];
+  static unsigned char sss[DEC_MANY][CRYPTO_BYTES], sss_[DEC_MANY][CRYPTO_BYTES];
+  unsigned char kcoins[CRYPTO_KEYPAIR_COINBYTES], ecoins[CRYPTO_ENC_COINBYTES];
 
   crypto_kem_keypair(pk, sk);
   // crypto_kem_enc(ct, ss, pk);
@@ -1234,6 +1292,83 @@ void test_sike()
   if (wrong == 0) printf("\x1b[32m EQUAL!\x1b[0m\n");
   else            printf("\x1b[31m NOT EQUAL!\x1b[0m\n");
 
+  // repeated encapsulations to a prepared public key
+  crypto_kem_enc_prepare(ppk, pk);
+  wrong = 0;
+  for (i = 0; i < 2; i++) {
+    crypto_kem_enc_prepared(ct, ss, ppk);
+    crypto_kem_dec(ss_, ct, sk);
+    wrong |= memcmp(ss, ss_, CRYPTO_BYTES);
+  }
+
+  printf("Prepared pk:");
+  if (wrong == 0) printf("\x1b[32m EQUAL!\x1b[0m\n");
+  else            printf("\x1b[31m NOT EQUAL!\x1b[0m\n");
+
+  // deterministic key generation and encapsulation: equal coins give equal outputs
+  for (i = 0; i < CRYPTO_KEYPAIR_COINBYTES; i++) kcoins[i] = (unsigned char)(3*i+1);
+  for (i = 0; i < CRYPTO_ENC_COINBYTES; i++) ecoins[i] = (unsigned char)(5*i+2);
+  crypto_kem_keypair_derand(pks[0], sks[0], kcoins);
+  crypto_kem_enc_derand(cts[0], sss[0], pks[0], ecoins);
+  crypto_kem_keypair_derand(pk, sk, kcoins);
+  crypto_kem_enc_derand(ct, ss, pk, ecoins);
+  crypto_kem_dec(ss_, ct, sk);
+  wrong = memcmp(sk, sks[0], CRYPTO_SECRETKEYBYTES) | memcmp(pk, pks[0], CRYPTO_PUBLICKEYBYTES);
+  wrong |= memcmp(ct, cts[0], CRYPTO_CIPHERTEXTBYTES) | memcmp(ss, sss[0], CRYPTO_BYTES);
+  wrong |= memcmp(ss, ss_, CRYPTO_BYTES);
+
+  printf("Derand:");
+  if (wrong == 0) printf("\x1b[32m EQUAL!\x1b[0m\n");
+  else            printf("\x1b[31m NOT EQUAL!\x1b[0m\n");
+
+  // implicit rejection: a ct with a flipped bit in c0 or c1, or with c0 re-encoded 
+  // non-canonically as x+p, must be rejected, i.e. its shared secret H(s||ct) 
+  // changes with s, while the unmodified ct still decapsulates to the sender's 
+  // secret. cts[j] and cts[j+4] hold variant j under sk and under sk with s modified
+  crypto_kem_keypair(pk, sk);
+  crypto_kem_enc_opt(ct, ss, pk);
+  for (j = 0; j < 4; j++) {
+    memcpy(cts[j], ct, CRYPTO_CIPHERTEXTBYTES);
+    if (j == 1) cts[j][0] ^= 1;
+    if (j == 2) cts[j][CRYPTO_CIPHERTEXTBYTES-1] ^= 0x80;
+    if (j == 3) {
+      for (i = 0, c = 0; i < FP2_ENCODED_BYTES/2; i++) {
+        c += cts[j][i] + ((p610[i/8] >> (8*(i%8))) & 0xFF);
+        cts[j][i] = (unsigned char)c; c >>= 8;
+      }
+    }
+    memcpy(cts[j+4], cts[j], CRYPTO_CIPHERTEXTBYTES);
+    memcpy(sks[j], sk, CRYPTO_SECRETKEYBYTES);
+    memcpy(sks[j+4], sk, CRYPTO_SECRETKEYBYTES);
+    sks[j+4][0] ^= 1;
+    crypto_kem_dec(sss[j], cts[j], sks[j]);
+    crypto_kem_dec(sss[j+4], cts[j+4], sks[j+4]);
+  }
+  crypto_kem_dec_many(sss_[0], cts[0], sks[0], 8);
+  wrong = memcmp(sss, sss_, 8*CRYPTO_BYTES);
+  wrong |= memcmp(ss, sss[0], CRYPTO_BYTES) | memcmp(ss, sss[4], CRYPTO_BYTES);
+  for (j = 1; j < 4; j++) wrong |= memcmp(sss[j], sss[j+4], CRYPTO_BYTES) == 0;
+
+  printf("Rejection:");
+  if (wrong == 0) printf("\x1b[32m EQUAL!\x1b[0m\n");
+  else            printf("\x1b[31m NOT EQUAL!\x1b[0m\n");
+
+  // batched decapsulation of a full and a partial batch under 3 key pairs, 
+  // one ciphertext is corrupted to take the implicit rejection path 
+  for (i = 0; i < DEC_MANY; i++) {
+    if (i < 3) crypto_kem_keypair(pks[i], sks[i]);
+    else       memcpy(sks[i], sks[i%3], CRYPTO_SECRETKEYBYTES);
+    crypto_kem_enc_opt(cts[i], sss[i], pks[i%3]);
+  }
+  cts[4][CRYPTO_CIPHERTEXTBYTES-1] ^= 1;
+  crypto_kem_dec(sss[4], cts[4], sks[4]);
+  crypto_kem_dec_many(sss_[0], cts[0], sks[0], DEC_MANY);
+  wrong = memcmp(sss, sss_, sizeof(sss));
+
+  printf("Batched decaps:");
+  if (wrong == 0) printf("\x1b[32m EQUAL!\x1b[0m\n");
+  else            printf("\x1b[31m NOT EQUAL!\x1b[0m\n");
+
   // ---------------------------------------------------------------------------
   // measure timings 
   uint64_t start_cycles, end_cycles, diff_cycles;
@@ -1252,19 +1387,55 @@ void test_sike()
   MEASURE_TIME(crypto_kem_enc_opt(ct, ss, pk), ITER_M);
   printf("* Encaps: %ld\n", diff_cycles);
 
+  LOAD_CACHE(crypto_kem_enc_prepared(ct, ss, ppk), ITER_S);
+  MEASURE_TIME(crypto_kem_enc_prepared(ct, ss, ppk), ITER_M);
+  printf("* Encaps (prepared pk): %ld\n", diff_cycles);
+
   LOAD_CACHE(crypto_kem_dec(ss_, ct, sk), ITER_S);
   MEASURE_TIME(crypto_kem_dec(ss_, ct, sk), ITER_M);
   printf("* Decaps: %ld\n", diff_cycles);
+
+  LOAD_CACHE(crypto_kem_dec_many(sss_[0], cts[0], sks[0], 8), ITER_S/8);
+  MEASURE_TIME(crypto_kem_dec_many(sss_[0], cts[0], sks[0], 8), ITER_M/8);
+  printf("* Decaps (batch of 8, per decaps): %ld\n", diff_cycles/8);
+}
+
+// fork test: parent and child must draw different bytes after the fork
+void test_randombytes_fork()
+{
+  unsigned char a[64], b[64];
+  int fd[2], wrong = 1;
+  pid_t pid;
+
+  randombytes(a, 1);                              // seed the generator before forking
+  if (pipe(fd) == 0) {
+    pid = fork();
+    if (pid == 0) {
+      randombytes(b, sizeof(b));
+      _exit(write(fd[1], b, sizeof(b)) != sizeof(b));
+    }
+    if (pid > 0) {
+      randombytes(a, sizeof(a));
+      wrong = read(fd[0], b, sizeof(b)) != sizeof(b) || memcmp(a, b, sizeof(a)) == 0;
+      waitpid(pid, NULL, 0);
+    }
+    close(fd[0]); close(fd[1]);
+  }
+
+  printf("Fork:");
+  if (wrong == 0) printf("\x1b[32m EQUAL!\x1b[0m\n");
+  else            printf("\x1b[31m NOT EQUAL!\x1b[0m\n");
 }
 
 int main()
 {
-  // test_fp();
+  test_fp();
   // test_fpx();
   // test_curve();
   // test_isog();
   // test_sidh();
   test_sike();
+  test_randombytes_fork();
 
   return 0;
 }
@@ -23,8 +23,8 @@
 
 
 // fixed parameters for isogeny tree computation
-#define MAX_INT_POINTS_ALICE    8        
-#define MAX_INT_POINTS_BOB      10  
+#define MAX_INT_POINTS_ALICE    12        
+#define MAX_INT_POINTS_BOB      12  
 #define MAX_Alice               152
 #define MAX_Bob                 192  
 
@@ -0,0 +1,3389 @@
+// Straight-line isogeny tree traversals compiled from the strategy tables of
+// sidh.h by tools/strategy.c (./strategy compile > src/traversal.h), do not edit.
+// On input pts[0] holds the kernel point, the point that is multiplied lives
+// in pts[npts] right above the npts stacked points.
+
+#ifndef _TRAVERSAL_H
+#define _TRAVERSAL_H
+
+#include "sidh.h"
+
+static void traverse_Alice_kg(vgelm_t *pts, vgelm_t C24_A24plus, vgelm_t phiP, vgelm_t phiQ, vgelm_t phiR)
+{
+  vgelm_t coeff__0, coeff2_1;
+
+  xDBLe_1x2x2x2w(pts[0], pts[1], C24_A24plus, 86);
+  xDBLe_1x2x2x2w(pts[1], pts[2], C24_A24plus, 68);
+  xDBLe_1x2x2x2w(pts[2], pts[3], C24_A24plus, 48);
+  xDBLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 34);
+  xDBLe_1x2x2x2w(pts[4], pts[5], C24_A24plus, 24);
+  xDBLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 16);
+  xDBLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 10);
+  xDBLe_1x2x2x2w(pts[7], pts[8], C24_A24plus, 6);
+  xDBLe_1x2x2x2w(pts[8], pts[9], C24_A24plus, 4);
+  xDBLe_1x2x2x2w(pts[9], pts[10], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[10], pts[11], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[11], pts[12], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[12], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 15);
+
+  get_4_isog_1x2x2x2w(pts[11], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 14);
+
+  get_4_isog_1x2x2x2w(pts[10], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 13);
+
+  get_4_isog_1x2x2x2w(pts[9], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 12);
+
+  xDBLe_1x2x2x2w(pts[8], pts[9], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[9], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 12);
+
+  get_4_isog_1x2x2x2w(pts[8], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 11);
+
+  xDBLe_1x2x2x2w(pts[7], pts[8], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[8], pts[9], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[9], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 12);
+
+  get_4_isog_1x2x2x2w(pts[8], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 11);
+
+  get_4_isog_1x2x2x2w(pts[7], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 10);
+
+  xDBLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 4);
+  xDBLe_1x2x2x2w(pts[7], pts[8], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[8], pts[9], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[9], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 12);
+
+  get_4_isog_1x2x2x2w(pts[8], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 11);
+
+  get_4_isog_1x2x2x2w(pts[7], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 10);
+
+  xDBLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[7], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 10);
+
+  get_4_isog_1x2x2x2w(pts[6], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 9);
+
+  xDBLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 6);
+  xDBLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 4);
+  xDBLe_1x2x2x2w(pts[7], pts[8], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[8], pts[9], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[9], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 12);
+
+  get_4_isog_1x2x2x2w(pts[8], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 11);
+
+  get_4_isog_1x2x2x2w(pts[7], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 10);
+
+  xDBLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[7], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 10);
+
+  get_4_isog_1x2x2x2w(pts[6], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 9);
+
+  xDBLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[7], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 10);
+
+  get_4_isog_1x2x2x2w(pts[6], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 9);
+
+  get_4_isog_1x2x2x2w(pts[5], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 8);
+
+  xDBLe_1x2x2x2w(pts[4], pts[5], C24_A24plus, 8);
+  xDBLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 6);
+  xDBLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 4);
+  xDBLe_1x2x2x2w(pts[7], pts[8], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[8], pts[9], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[9], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 12);
+
+  get_4_isog_1x2x2x2w(pts[8], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 11);
+
+  get_4_isog_1x2x2x2w(pts[7], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 10);
+
+  xDBLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[7], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 10);
+
+  get_4_isog_1x2x2x2w(pts[6], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 9);
+
+  xDBLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[7], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 10);
+
+  get_4_isog_1x2x2x2w(pts[6], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 9);
+
+  get_4_isog_1x2x2x2w(pts[5], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 8);
+
+  xDBLe_1x2x2x2w(pts[4], pts[5], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[7], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 10);
+
+  get_4_isog_1x2x2x2w(pts[6], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 9);
+
+  get_4_isog_1x2x2x2w(pts[5], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 8);
+
+  get_4_isog_1x2x2x2w(pts[4], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 7);
+
+  xDBLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 10);
+  xDBLe_1x2x2x2w(pts[4], pts[5], C24_A24plus, 8);
+  xDBLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 6);
+  xDBLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 4);
+  xDBLe_1x2x2x2w(pts[7], pts[8], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[8], pts[9], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[9], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 12);
+
+  get_4_isog_1x2x2x2w(pts[8], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 11);
+
+  get_4_isog_1x2x2x2w(pts[7], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 10);
+
+  xDBLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[7], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 10);
+
+  get_4_isog_1x2x2x2w(pts[6], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 9);
+
+  xDBLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[7], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 10);
+
+  get_4_isog_1x2x2x2w(pts[6], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 9);
+
+  get_4_isog_1x2x2x2w(pts[5], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 8);
+
+  xDBLe_1x2x2x2w(pts[4], pts[5], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[7], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 10);
+
+  get_4_isog_1x2x2x2w(pts[6], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 9);
+
+  get_4_isog_1x2x2x2w(pts[5], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 8);
+
+  get_4_isog_1x2x2x2w(pts[4], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 7);
+
+  xDBLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[4], pts[5], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[7], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 10);
+
+  get_4_isog_1x2x2x2w(pts[6], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 9);
+
+  get_4_isog_1x2x2x2w(pts[5], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 8);
+
+  get_4_isog_1x2x2x2w(pts[4], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 7);
+
+  get_4_isog_1x2x2x2w(pts[3], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 6);
+
+  xDBLe_1x2x2x2w(pts[2], pts[3], C24_A24plus, 14);
+  xDBLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 10);
+  xDBLe_1x2x2x2w(pts[4], pts[5], C24_A24plus, 8);
+  xDBLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 6);
+  xDBLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 4);
+  xDBLe_1x2x2x2w(pts[7], pts[8], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[8], pts[9], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[9], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 12);
+
+  get_4_isog_1x2x2x2w(pts[8], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 11);
+
+  get_4_isog_1x2x2x2w(pts[7], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 10);
+
+  xDBLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[7], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 10);
+
+  get_4_isog_1x2x2x2w(pts[6], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 9);
+
+  xDBLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[7], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 10);
+
+  get_4_isog_1x2x2x2w(pts[6], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 9);
+
+  get_4_isog_1x2x2x2w(pts[5], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 8);
+
+  xDBLe_1x2x2x2w(pts[4], pts[5], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[7], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 10);
+
+  get_4_isog_1x2x2x2w(pts[6], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 9);
+
+  get_4_isog_1x2x2x2w(pts[5], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 8);
+
+  get_4_isog_1x2x2x2w(pts[4], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 7);
+
+  xDBLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[4], pts[5], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[7], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 10);
+
+  get_4_isog_1x2x2x2w(pts[6], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 9);
+
+  get_4_isog_1x2x2x2w(pts[5], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 8);
+
+  get_4_isog_1x2x2x2w(pts[4], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 7);
+
+  get_4_isog_1x2x2x2w(pts[3], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 6);
+
+  xDBLe_1x2x2x2w(pts[2], pts[3], C24_A24plus, 4);
+  xDBLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[4], pts[5], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[7], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 10);
+
+  get_4_isog_1x2x2x2w(pts[6], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 9);
+
+  get_4_isog_1x2x2x2w(pts[5], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 8);
+
+  get_4_isog_1x2x2x2w(pts[4], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 7);
+
+  get_4_isog_1x2x2x2w(pts[3], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 6);
+
+  xDBLe_1x2x2x2w(pts[2], pts[3], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[3], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 6);
+
+  get_4_isog_1x2x2x2w(pts[2], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 5);
+
+  xDBLe_1x2x2x2w(pts[1], pts[2], C24_A24plus, 20);
+  xDBLe_1x2x2x2w(pts[2], pts[3], C24_A24plus, 14);
+  xDBLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 10);
+  xDBLe_1x2x2x2w(pts[4], pts[5], C24_A24plus, 8);
+  xDBLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 6);
+  xDBLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 4);
+  xDBLe_1x2x2x2w(pts[7], pts[8], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[8], pts[9], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[9], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 12);
+
+  get_4_isog_1x2x2x2w(pts[8], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 11);
+
+  get_4_isog_1x2x2x2w(pts[7], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 10);
+
+  xDBLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[7], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 10);
+
+  get_4_isog_1x2x2x2w(pts[6], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 9);
+
+  xDBLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[7], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 10);
+
+  get_4_isog_1x2x2x2w(pts[6], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 9);
+
+  get_4_isog_1x2x2x2w(pts[5], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 8);
+
+  xDBLe_1x2x2x2w(pts[4], pts[5], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[7], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 10);
+
+  get_4_isog_1x2x2x2w(pts[6], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 9);
+
+  get_4_isog_1x2x2x2w(pts[5], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 8);
+
+  get_4_isog_1x2x2x2w(pts[4], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 7);
+
+  xDBLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[4], pts[5], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[7], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 10);
+
+  get_4_isog_1x2x2x2w(pts[6], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 9);
+
+  get_4_isog_1x2x2x2w(pts[5], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 8);
+
+  get_4_isog_1x2x2x2w(pts[4], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 7);
+
+  get_4_isog_1x2x2x2w(pts[3], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 6);
+
+  xDBLe_1x2x2x2w(pts[2], pts[3], C24_A24plus, 4);
+  xDBLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[4], pts[5], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[7], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 10);
+
+  get_4_isog_1x2x2x2w(pts[6], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 9);
+
+  get_4_isog_1x2x2x2w(pts[5], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 8);
+
+  get_4_isog_1x2x2x2w(pts[4], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 7);
+
+  get_4_isog_1x2x2x2w(pts[3], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 6);
+
+  xDBLe_1x2x2x2w(pts[2], pts[3], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[3], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 6);
+
+  get_4_isog_1x2x2x2w(pts[2], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 5);
+
+  xDBLe_1x2x2x2w(pts[1], pts[2], C24_A24plus, 6);
+  xDBLe_1x2x2x2w(pts[2], pts[3], C24_A24plus, 4);
+  xDBLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[4], pts[5], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[7], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 10);
+
+  get_4_isog_1x2x2x2w(pts[6], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 9);
+
+  get_4_isog_1x2x2x2w(pts[5], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 8);
+
+  get_4_isog_1x2x2x2w(pts[4], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 7);
+
+  get_4_isog_1x2x2x2w(pts[3], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 6);
+
+  xDBLe_1x2x2x2w(pts[2], pts[3], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[3], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 6);
+
+  get_4_isog_1x2x2x2w(pts[2], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 5);
+
+  xDBLe_1x2x2x2w(pts[1], pts[2], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[2], pts[3], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[3], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 6);
+
+  get_4_isog_1x2x2x2w(pts[2], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 5);
+
+  get_4_isog_1x2x2x2w(pts[1], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 4);
+
+  xDBLe_1x2x2x2w(pts[0], pts[1], C24_A24plus, 28);
+  xDBLe_1x2x2x2w(pts[1], pts[2], C24_A24plus, 18);
+  xDBLe_1x2x2x2w(pts[2], pts[3], C24_A24plus, 12);
+  xDBLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 8);
+  xDBLe_1x2x2x2w(pts[4], pts[5], C24_A24plus, 6);
+  xDBLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 4);
+  xDBLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 4);
+  xDBLe_1x2x2x2w(pts[7], pts[8], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[8], pts[9], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[9], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 12);
+
+  get_4_isog_1x2x2x2w(pts[8], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 11);
+
+  get_4_isog_1x2x2x2w(pts[7], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 10);
+
+  xDBLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[7], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 10);
+
+  get_4_isog_1x2x2x2w(pts[6], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 9);
+
+  xDBLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[6], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 9);
+
+  get_4_isog_1x2x2x2w(pts[5], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 8);
+
+  xDBLe_1x2x2x2w(pts[4], pts[5], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[6], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 9);
+
+  get_4_isog_1x2x2x2w(pts[5], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 8);
+
+  get_4_isog_1x2x2x2w(pts[4], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 7);
+
+  xDBLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[4], pts[5], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[6], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 9);
+
+  get_4_isog_1x2x2x2w(pts[5], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 8);
+
+  get_4_isog_1x2x2x2w(pts[4], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 7);
+
+  get_4_isog_1x2x2x2w(pts[3], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 6);
+
+  xDBLe_1x2x2x2w(pts[2], pts[3], C24_A24plus, 4);
+  xDBLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[4], pts[5], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[6], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 9);
+
+  get_4_isog_1x2x2x2w(pts[5], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 8);
+
+  get_4_isog_1x2x2x2w(pts[4], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 7);
+
+  get_4_isog_1x2x2x2w(pts[3], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 6);
+
+  xDBLe_1x2x2x2w(pts[2], pts[3], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[3], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 6);
+
+  get_4_isog_1x2x2x2w(pts[2], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 5);
+
+  xDBLe_1x2x2x2w(pts[1], pts[2], C24_A24plus, 6);
+  xDBLe_1x2x2x2w(pts[2], pts[3], C24_A24plus, 4);
+  xDBLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[4], pts[5], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[6], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 9);
+
+  get_4_isog_1x2x2x2w(pts[5], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 8);
+
+  get_4_isog_1x2x2x2w(pts[4], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 7);
+
+  get_4_isog_1x2x2x2w(pts[3], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 6);
+
+  xDBLe_1x2x2x2w(pts[2], pts[3], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[3], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 6);
+
+  get_4_isog_1x2x2x2w(pts[2], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 5);
+
+  xDBLe_1x2x2x2w(pts[1], pts[2], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[2], pts[3], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[3], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 6);
+
+  get_4_isog_1x2x2x2w(pts[2], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 5);
+
+  get_4_isog_1x2x2x2w(pts[1], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 4);
+
+  xDBLe_1x2x2x2w(pts[0], pts[1], C24_A24plus, 10);
+  xDBLe_1x2x2x2w(pts[1], pts[2], C24_A24plus, 6);
+  xDBLe_1x2x2x2w(pts[2], pts[3], C24_A24plus, 4);
+  xDBLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[4], pts[5], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[6], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 9);
+
+  get_4_isog_1x2x2x2w(pts[5], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 8);
+
+  get_4_isog_1x2x2x2w(pts[4], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 7);
+
+  get_4_isog_1x2x2x2w(pts[3], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 6);
+
+  xDBLe_1x2x2x2w(pts[2], pts[3], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[3], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 6);
+
+  get_4_isog_1x2x2x2w(pts[2], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 5);
+
+  xDBLe_1x2x2x2w(pts[1], pts[2], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[2], pts[3], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[3], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 6);
+
+  get_4_isog_1x2x2x2w(pts[2], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 5);
+
+  get_4_isog_1x2x2x2w(pts[1], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 4);
+
+  xDBLe_1x2x2x2w(pts[0], pts[1], C24_A24plus, 4);
+  xDBLe_1x2x2x2w(pts[1], pts[2], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[2], pts[3], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[3], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 6);
+
+  get_4_isog_1x2x2x2w(pts[2], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 5);
+
+  get_4_isog_1x2x2x2w(pts[1], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 4);
+
+  xDBLe_1x2x2x2w(pts[0], pts[1], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[1], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 4);
+
+  get_4_isog_1x2x2x2w(pts[0], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 3);
+}
+
+static void traverse_Alice_ss(vgelm_t *pts, vgelm_t C24_A24plus)
+{
+  vgelm_t coeff__0, coeff2_1;
+
+  xDBLe_1x2x2x2w(pts[0], pts[1], C24_A24plus, 102);
+  xDBLe_1x2x2x2w(pts[1], pts[2], C24_A24plus, 68);
+  xDBLe_1x2x2x2w(pts[2], pts[3], C24_A24plus, 44);
+  xDBLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 28);
+  xDBLe_1x2x2x2w(pts[4], pts[5], C24_A24plus, 18);
+  xDBLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 12);
+  xDBLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 8);
+  xDBLe_1x2x2x2w(pts[7], pts[8], C24_A24plus, 8);
+  xDBLe_1x2x2x2w(pts[8], pts[9], C24_A24plus, 6);
+  xDBLe_1x2x2x2w(pts[9], pts[10], C24_A24plus, 4);
+  xDBLe_1x2x2x2w(pts[10], pts[11], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[11], pts[12], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[12], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 12);
+
+  get_4_isog_1x2x2x2w(pts[11], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 11);
+
+  get_4_isog_1x2x2x2w(pts[10], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 10);
+
+  xDBLe_1x2x2x2w(pts[9], pts[10], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[10], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 10);
+
+  get_4_isog_1x2x2x2w(pts[9], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 9);
+
+  xDBLe_1x2x2x2w(pts[8], pts[9], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[9], pts[10], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[10], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 10);
+
+  get_4_isog_1x2x2x2w(pts[9], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 9);
+
+  get_4_isog_1x2x2x2w(pts[8], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 8);
+
+  xDBLe_1x2x2x2w(pts[7], pts[8], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[8], pts[9], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[9], pts[10], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[10], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 10);
+
+  get_4_isog_1x2x2x2w(pts[9], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 9);
+
+  get_4_isog_1x2x2x2w(pts[8], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 8);
+
+  get_4_isog_1x2x2x2w(pts[7], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 7);
+
+  xDBLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[7], pts[8], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[8], pts[9], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[9], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 9);
+
+  get_4_isog_1x2x2x2w(pts[8], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 8);
+
+  get_4_isog_1x2x2x2w(pts[7], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 7);
+
+  get_4_isog_1x2x2x2w(pts[6], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 6);
+
+  xDBLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 4);
+  xDBLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[7], pts[8], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[8], pts[9], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[9], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 9);
+
+  get_4_isog_1x2x2x2w(pts[8], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 8);
+
+  get_4_isog_1x2x2x2w(pts[7], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 7);
+
+  get_4_isog_1x2x2x2w(pts[6], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 6);
+
+  xDBLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[6], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 6);
+
+  get_4_isog_1x2x2x2w(pts[5], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 5);
+
+  xDBLe_1x2x2x2w(pts[4], pts[5], C24_A24plus, 6);
+  xDBLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 4);
+  xDBLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[7], pts[8], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[8], pts[9], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[9], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 9);
+
+  get_4_isog_1x2x2x2w(pts[8], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 8);
+
+  get_4_isog_1x2x2x2w(pts[7], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 7);
+
+  get_4_isog_1x2x2x2w(pts[6], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 6);
+
+  xDBLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[6], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 6);
+
+  get_4_isog_1x2x2x2w(pts[5], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 5);
+
+  xDBLe_1x2x2x2w(pts[4], pts[5], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[6], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 6);
+
+  get_4_isog_1x2x2x2w(pts[5], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 5);
+
+  get_4_isog_1x2x2x2w(pts[4], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 4);
+
+  xDBLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 10);
+  xDBLe_1x2x2x2w(pts[4], pts[5], C24_A24plus, 6);
+  xDBLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 4);
+  xDBLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[7], pts[8], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[8], pts[9], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[9], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 9);
+
+  get_4_isog_1x2x2x2w(pts[8], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 8);
+
+  get_4_isog_1x2x2x2w(pts[7], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 7);
+
+  get_4_isog_1x2x2x2w(pts[6], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 6);
+
+  xDBLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[6], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 6);
+
+  get_4_isog_1x2x2x2w(pts[5], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 5);
+
+  xDBLe_1x2x2x2w(pts[4], pts[5], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[6], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 6);
+
+  get_4_isog_1x2x2x2w(pts[5], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 5);
+
+  get_4_isog_1x2x2x2w(pts[4], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 4);
+
+  xDBLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 4);
+  xDBLe_1x2x2x2w(pts[4], pts[5], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[6], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 6);
+
+  get_4_isog_1x2x2x2w(pts[5], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 5);
+
+  get_4_isog_1x2x2x2w(pts[4], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 4);
+
+  xDBLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[4], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 4);
+
+  get_4_isog_1x2x2x2w(pts[3], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 3);
+
+  xDBLe_1x2x2x2w(pts[2], pts[3], C24_A24plus, 16);
+  xDBLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 10);
+  xDBLe_1x2x2x2w(pts[4], pts[5], C24_A24plus, 6);
+  xDBLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 4);
+  xDBLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[7], pts[8], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[8], pts[9], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[9], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 9);
+
+  get_4_isog_1x2x2x2w(pts[8], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 8);
+
+  get_4_isog_1x2x2x2w(pts[7], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 7);
+
+  get_4_isog_1x2x2x2w(pts[6], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 6);
+
+  xDBLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[6], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 6);
+
+  get_4_isog_1x2x2x2w(pts[5], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 5);
+
+  xDBLe_1x2x2x2w(pts[4], pts[5], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[6], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 6);
+
+  get_4_isog_1x2x2x2w(pts[5], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 5);
+
+  get_4_isog_1x2x2x2w(pts[4], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 4);
+
+  xDBLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 4);
+  xDBLe_1x2x2x2w(pts[4], pts[5], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[6], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 6);
+
+  get_4_isog_1x2x2x2w(pts[5], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 5);
+
+  get_4_isog_1x2x2x2w(pts[4], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 4);
+
+  xDBLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[4], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 4);
+
+  get_4_isog_1x2x2x2w(pts[3], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 3);
+
+  xDBLe_1x2x2x2w(pts[2], pts[3], C24_A24plus, 6);
+  xDBLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 4);
+  xDBLe_1x2x2x2w(pts[4], pts[5], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[6], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 6);
+
+  get_4_isog_1x2x2x2w(pts[5], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 5);
+
+  get_4_isog_1x2x2x2w(pts[4], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 4);
+
+  xDBLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[4], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 4);
+
+  get_4_isog_1x2x2x2w(pts[3], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 3);
+
+  xDBLe_1x2x2x2w(pts[2], pts[3], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[4], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 4);
+
+  get_4_isog_1x2x2x2w(pts[3], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 3);
+
+  get_4_isog_1x2x2x2w(pts[2], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 2);
+
+  xDBLe_1x2x2x2w(pts[1], pts[2], C24_A24plus, 24);
+  xDBLe_1x2x2x2w(pts[2], pts[3], C24_A24plus, 16);
+  xDBLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 10);
+  xDBLe_1x2x2x2w(pts[4], pts[5], C24_A24plus, 6);
+  xDBLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 4);
+  xDBLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[7], pts[8], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[8], pts[9], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[9], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 9);
+
+  get_4_isog_1x2x2x2w(pts[8], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 8);
+
+  get_4_isog_1x2x2x2w(pts[7], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 7);
+
+  get_4_isog_1x2x2x2w(pts[6], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 6);
+
+  xDBLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[6], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 6);
+
+  get_4_isog_1x2x2x2w(pts[5], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 5);
+
+  xDBLe_1x2x2x2w(pts[4], pts[5], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[6], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 6);
+
+  get_4_isog_1x2x2x2w(pts[5], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 5);
+
+  get_4_isog_1x2x2x2w(pts[4], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 4);
+
+  xDBLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 4);
+  xDBLe_1x2x2x2w(pts[4], pts[5], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[6], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 6);
+
+  get_4_isog_1x2x2x2w(pts[5], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 5);
+
+  get_4_isog_1x2x2x2w(pts[4], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 4);
+
+  xDBLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[4], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 4);
+
+  get_4_isog_1x2x2x2w(pts[3], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 3);
+
+  xDBLe_1x2x2x2w(pts[2], pts[3], C24_A24plus, 6);
+  xDBLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 4);
+  xDBLe_1x2x2x2w(pts[4], pts[5], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[6], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 6);
+
+  get_4_isog_1x2x2x2w(pts[5], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 5);
+
+  get_4_isog_1x2x2x2w(pts[4], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 4);
+
+  xDBLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[4], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 4);
+
+  get_4_isog_1x2x2x2w(pts[3], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 3);
+
+  xDBLe_1x2x2x2w(pts[2], pts[3], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[4], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 4);
+
+  get_4_isog_1x2x2x2w(pts[3], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 3);
+
+  get_4_isog_1x2x2x2w(pts[2], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 2);
+
+  xDBLe_1x2x2x2w(pts[1], pts[2], C24_A24plus, 8);
+  xDBLe_1x2x2x2w(pts[2], pts[3], C24_A24plus, 6);
+  xDBLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 4);
+  xDBLe_1x2x2x2w(pts[4], pts[5], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[6], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 6);
+
+  get_4_isog_1x2x2x2w(pts[5], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 5);
+
+  get_4_isog_1x2x2x2w(pts[4], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 4);
+
+  xDBLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[4], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 4);
+
+  get_4_isog_1x2x2x2w(pts[3], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 3);
+
+  xDBLe_1x2x2x2w(pts[2], pts[3], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[4], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 4);
+
+  get_4_isog_1x2x2x2w(pts[3], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 3);
+
+  get_4_isog_1x2x2x2w(pts[2], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 2);
+
+  xDBLe_1x2x2x2w(pts[1], pts[2], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[2], pts[3], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[4], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 4);
+
+  get_4_isog_1x2x2x2w(pts[3], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 3);
+
+  get_4_isog_1x2x2x2w(pts[2], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 2);
+
+  get_4_isog_1x2x2x2w(pts[1], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 1);
+
+  xDBLe_1x2x2x2w(pts[0], pts[1], C24_A24plus, 34);
+  xDBLe_1x2x2x2w(pts[1], pts[2], C24_A24plus, 24);
+  xDBLe_1x2x2x2w(pts[2], pts[3], C24_A24plus, 16);
+  xDBLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 10);
+  xDBLe_1x2x2x2w(pts[4], pts[5], C24_A24plus, 6);
+  xDBLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 4);
+  xDBLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[7], pts[8], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[8], pts[9], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[9], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 9);
+
+  get_4_isog_1x2x2x2w(pts[8], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 8);
+
+  get_4_isog_1x2x2x2w(pts[7], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 7);
+
+  get_4_isog_1x2x2x2w(pts[6], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 6);
+
+  xDBLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[6], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 6);
+
+  get_4_isog_1x2x2x2w(pts[5], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 5);
+
+  xDBLe_1x2x2x2w(pts[4], pts[5], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[6], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 6);
+
+  get_4_isog_1x2x2x2w(pts[5], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 5);
+
+  get_4_isog_1x2x2x2w(pts[4], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 4);
+
+  xDBLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 4);
+  xDBLe_1x2x2x2w(pts[4], pts[5], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[6], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 6);
+
+  get_4_isog_1x2x2x2w(pts[5], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 5);
+
+  get_4_isog_1x2x2x2w(pts[4], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 4);
+
+  xDBLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[4], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 4);
+
+  get_4_isog_1x2x2x2w(pts[3], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 3);
+
+  xDBLe_1x2x2x2w(pts[2], pts[3], C24_A24plus, 6);
+  xDBLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 4);
+  xDBLe_1x2x2x2w(pts[4], pts[5], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[6], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 6);
+
+  get_4_isog_1x2x2x2w(pts[5], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 5);
+
+  get_4_isog_1x2x2x2w(pts[4], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 4);
+
+  xDBLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[4], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 4);
+
+  get_4_isog_1x2x2x2w(pts[3], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 3);
+
+  xDBLe_1x2x2x2w(pts[2], pts[3], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[4], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 4);
+
+  get_4_isog_1x2x2x2w(pts[3], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 3);
+
+  get_4_isog_1x2x2x2w(pts[2], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 2);
+
+  xDBLe_1x2x2x2w(pts[1], pts[2], C24_A24plus, 8);
+  xDBLe_1x2x2x2w(pts[2], pts[3], C24_A24plus, 6);
+  xDBLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 4);
+  xDBLe_1x2x2x2w(pts[4], pts[5], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[6], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 6);
+
+  get_4_isog_1x2x2x2w(pts[5], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 5);
+
+  get_4_isog_1x2x2x2w(pts[4], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 4);
+
+  xDBLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[4], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 4);
+
+  get_4_isog_1x2x2x2w(pts[3], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 3);
+
+  xDBLe_1x2x2x2w(pts[2], pts[3], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[4], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 4);
+
+  get_4_isog_1x2x2x2w(pts[3], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 3);
+
+  get_4_isog_1x2x2x2w(pts[2], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 2);
+
+  xDBLe_1x2x2x2w(pts[1], pts[2], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[2], pts[3], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[4], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 4);
+
+  get_4_isog_1x2x2x2w(pts[3], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 3);
+
+  get_4_isog_1x2x2x2w(pts[2], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 2);
+
+  get_4_isog_1x2x2x2w(pts[1], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 1);
+
+  xDBLe_1x2x2x2w(pts[0], pts[1], C24_A24plus, 10);
+  xDBLe_1x2x2x2w(pts[1], pts[2], C24_A24plus, 8);
+  xDBLe_1x2x2x2w(pts[2], pts[3], C24_A24plus, 6);
+  xDBLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 4);
+  xDBLe_1x2x2x2w(pts[4], pts[5], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[6], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 6);
+
+  get_4_isog_1x2x2x2w(pts[5], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 5);
+
+  get_4_isog_1x2x2x2w(pts[4], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 4);
+
+  xDBLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[4], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 4);
+
+  get_4_isog_1x2x2x2w(pts[3], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 3);
+
+  xDBLe_1x2x2x2w(pts[2], pts[3], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[4], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 4);
+
+  get_4_isog_1x2x2x2w(pts[3], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 3);
+
+  get_4_isog_1x2x2x2w(pts[2], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 2);
+
+  xDBLe_1x2x2x2w(pts[1], pts[2], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[2], pts[3], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[4], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 4);
+
+  get_4_isog_1x2x2x2w(pts[3], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 3);
+
+  get_4_isog_1x2x2x2w(pts[2], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 2);
+
+  get_4_isog_1x2x2x2w(pts[1], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 1);
+
+  xDBLe_1x2x2x2w(pts[0], pts[1], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[1], pts[2], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[2], pts[3], C24_A24plus, 2);
+  xDBLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 2);
+  get_4_isog_1x2x2x2w(pts[4], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 4);
+
+  get_4_isog_1x2x2x2w(pts[3], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 3);
+
+  get_4_isog_1x2x2x2w(pts[2], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 2);
+
+  get_4_isog_1x2x2x2w(pts[1], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_ss(pts, coeff__0, coeff2_1, 1);
+
+  get_4_isog_1x2x2x2w(pts[0], C24_A24plus, coeff__0, coeff2_1);
+}
+
+static void traverse_Alice_kgss(vfelm_t *pts, vfelm_t C24_A24plus, vfelm_t phiP, vfelm_t phiQ, vfelm_t phiR)
+{
+  vfelm_t coeff__0, coeff2_1;
+
+  xDBLe_2x2x2x1w(pts[0], pts[1], C24_A24plus, 118);
+  xDBLe_2x2x2x1w(pts[1], pts[2], C24_A24plus, 76);
+  xDBLe_2x2x2x1w(pts[2], pts[3], C24_A24plus, 44);
+  xDBLe_2x2x2x1w(pts[3], pts[4], C24_A24plus, 26);
+  xDBLe_2x2x2x1w(pts[4], pts[5], C24_A24plus, 16);
+  xDBLe_2x2x2x1w(pts[5], pts[6], C24_A24plus, 10);
+  xDBLe_2x2x2x1w(pts[6], pts[7], C24_A24plus, 6);
+  xDBLe_2x2x2x1w(pts[7], pts[8], C24_A24plus, 4);
+  xDBLe_2x2x2x1w(pts[8], pts[9], C24_A24plus, 2);
+  get_4_isog_2x2x2x1w(pts[9], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 21);
+
+  get_4_isog_2x2x2x1w(pts[8], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 19);
+
+  xDBLe_2x2x2x1w(pts[7], pts[8], C24_A24plus, 2);
+  get_4_isog_2x2x2x1w(pts[8], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 19);
+
+  get_4_isog_2x2x2x1w(pts[7], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 17);
+
+  xDBLe_2x2x2x1w(pts[6], pts[7], C24_A24plus, 2);
+  xDBLe_2x2x2x1w(pts[7], pts[8], C24_A24plus, 2);
+  get_4_isog_2x2x2x1w(pts[8], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 19);
+
+  get_4_isog_2x2x2x1w(pts[7], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 17);
+
+  get_4_isog_2x2x2x1w(pts[6], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 15);
+
+  xDBLe_2x2x2x1w(pts[5], pts[6], C24_A24plus, 4);
+  xDBLe_2x2x2x1w(pts[6], pts[7], C24_A24plus, 2);
+  xDBLe_2x2x2x1w(pts[7], pts[8], C24_A24plus, 2);
+  get_4_isog_2x2x2x1w(pts[8], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 19);
+
+  get_4_isog_2x2x2x1w(pts[7], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 17);
+
+  get_4_isog_2x2x2x1w(pts[6], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 15);
+
+  xDBLe_2x2x2x1w(pts[5], pts[6], C24_A24plus, 2);
+  get_4_isog_2x2x2x1w(pts[6], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 15);
+
+  get_4_isog_2x2x2x1w(pts[5], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 13);
+
+  xDBLe_2x2x2x1w(pts[4], pts[5], C24_A24plus, 6);
+  xDBLe_2x2x2x1w(pts[5], pts[6], C24_A24plus, 4);
+  xDBLe_2x2x2x1w(pts[6], pts[7], C24_A24plus, 2);
+  xDBLe_2x2x2x1w(pts[7], pts[8], C24_A24plus, 2);
+  get_4_isog_2x2x2x1w(pts[8], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 19);
+
+  get_4_isog_2x2x2x1w(pts[7], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 17);
+
+  get_4_isog_2x2x2x1w(pts[6], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 15);
+
+  xDBLe_2x2x2x1w(pts[5], pts[6], C24_A24plus, 2);
+  get_4_isog_2x2x2x1w(pts[6], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 15);
+
+  get_4_isog_2x2x2x1w(pts[5], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 13);
+
+  xDBLe_2x2x2x1w(pts[4], pts[5], C24_A24plus, 2);
+  xDBLe_2x2x2x1w(pts[5], pts[6], C24_A24plus, 2);
+  get_4_isog_2x2x2x1w(pts[6], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 15);
+
+  get_4_isog_2x2x2x1w(pts[5], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 13);
+
+  get_4_isog_2x2x2x1w(pts[4], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 11);
+
+  xDBLe_2x2x2x1w(pts[3], pts[4], C24_A24plus, 10);
+  xDBLe_2x2x2x1w(pts[4], pts[5], C24_A24plus, 6);
+  xDBLe_2x2x2x1w(pts[5], pts[6], C24_A24plus, 4);
+  xDBLe_2x2x2x1w(pts[6], pts[7], C24_A24plus, 2);
+  xDBLe_2x2x2x1w(pts[7], pts[8], C24_A24plus, 2);
+  get_4_isog_2x2x2x1w(pts[8], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 19);
+
+  get_4_isog_2x2x2x1w(pts[7], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 17);
+
+  get_4_isog_2x2x2x1w(pts[6], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 15);
+
+  xDBLe_2x2x2x1w(pts[5], pts[6], C24_A24plus, 2);
+  get_4_isog_2x2x2x1w(pts[6], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 15);
+
+  get_4_isog_2x2x2x1w(pts[5], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 13);
+
+  xDBLe_2x2x2x1w(pts[4], pts[5], C24_A24plus, 2);
+  xDBLe_2x2x2x1w(pts[5], pts[6], C24_A24plus, 2);
+  get_4_isog_2x2x2x1w(pts[6], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 15);
+
+  get_4_isog_2x2x2x1w(pts[5], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 13);
+
+  get_4_isog_2x2x2x1w(pts[4], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 11);
+
+  xDBLe_2x2x2x1w(pts[3], pts[4], C24_A24plus, 4);
+  xDBLe_2x2x2x1w(pts[4], pts[5], C24_A24plus, 2);
+  xDBLe_2x2x2x1w(pts[5], pts[6], C24_A24plus, 2);
+  get_4_isog_2x2x2x1w(pts[6], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 15);
+
+  get_4_isog_2x2x2x1w(pts[5], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 13);
+
+  get_4_isog_2x2x2x1w(pts[4], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 11);
+
+  xDBLe_2x2x2x1w(pts[3], pts[4], C24_A24plus, 2);
+  get_4_isog_2x2x2x1w(pts[4], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 11);
+
+  get_4_isog_2x2x2x1w(pts[3], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 9);
+
+  xDBLe_2x2x2x1w(pts[2], pts[3], C24_A24plus, 18);
+  xDBLe_2x2x2x1w(pts[3], pts[4], C24_A24plus, 10);
+  xDBLe_2x2x2x1w(pts[4], pts[5], C24_A24plus, 6);
+  xDBLe_2x2x2x1w(pts[5], pts[6], C24_A24plus, 4);
+  xDBLe_2x2x2x1w(pts[6], pts[7], C24_A24plus, 2);
+  xDBLe_2x2x2x1w(pts[7], pts[8], C24_A24plus, 2);
+  get_4_isog_2x2x2x1w(pts[8], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 19);
+
+  get_4_isog_2x2x2x1w(pts[7], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 17);
+
+  get_4_isog_2x2x2x1w(pts[6], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 15);
+
+  xDBLe_2x2x2x1w(pts[5], pts[6], C24_A24plus, 2);
+  get_4_isog_2x2x2x1w(pts[6], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 15);
+
+  get_4_isog_2x2x2x1w(pts[5], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 13);
+
+  xDBLe_2x2x2x1w(pts[4], pts[5], C24_A24plus, 2);
+  xDBLe_2x2x2x1w(pts[5], pts[6], C24_A24plus, 2);
+  get_4_isog_2x2x2x1w(pts[6], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 15);
+
+  get_4_isog_2x2x2x1w(pts[5], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 13);
+
+  get_4_isog_2x2x2x1w(pts[4], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 11);
+
+  xDBLe_2x2x2x1w(pts[3], pts[4], C24_A24plus, 4);
+  xDBLe_2x2x2x1w(pts[4], pts[5], C24_A24plus, 2);
+  xDBLe_2x2x2x1w(pts[5], pts[6], C24_A24plus, 2);
+  get_4_isog_2x2x2x1w(pts[6], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 15);
+
+  get_4_isog_2x2x2x1w(pts[5], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 13);
+
+  get_4_isog_2x2x2x1w(pts[4], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 11);
+
+  xDBLe_2x2x2x1w(pts[3], pts[4], C24_A24plus, 2);
+  get_4_isog_2x2x2x1w(pts[4], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 11);
+
+  get_4_isog_2x2x2x1w(pts[3], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 9);
+
+  xDBLe_2x2x2x1w(pts[2], pts[3], C24_A24plus, 8);
+  xDBLe_2x2x2x1w(pts[3], pts[4], C24_A24plus, 4);
+  xDBLe_2x2x2x1w(pts[4], pts[5], C24_A24plus, 2);
+  xDBLe_2x2x2x1w(pts[5], pts[6], C24_A24plus, 2);
+  get_4_isog_2x2x2x1w(pts[6], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 15);
+
+  get_4_isog_2x2x2x1w(pts[5], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 13);
+
+  get_4_isog_2x2x2x1w(pts[4], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 11);
+
+  xDBLe_2x2x2x1w(pts[3], pts[4], C24_A24plus, 2);
+  get_4_isog_2x2x2x1w(pts[4], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 11);
+
+  get_4_isog_2x2x2x1w(pts[3], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 9);
+
+  xDBLe_2x2x2x1w(pts[2], pts[3], C24_A24plus, 4);
+  xDBLe_2x2x2x1w(pts[3], pts[4], C24_A24plus, 2);
+  get_4_isog_2x2x2x1w(pts[4], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 11);
+
+  get_4_isog_2x2x2x1w(pts[3], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 9);
+
+  xDBLe_2x2x2x1w(pts[2], pts[3], C24_A24plus, 2);
+  get_4_isog_2x2x2x1w(pts[3], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 9);
+
+  get_4_isog_2x2x2x1w(pts[2], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 7);
+
+  xDBLe_2x2x2x1w(pts[1], pts[2], C24_A24plus, 32);
+  xDBLe_2x2x2x1w(pts[2], pts[3], C24_A24plus, 18);
+  xDBLe_2x2x2x1w(pts[3], pts[4], C24_A24plus, 10);
+  xDBLe_2x2x2x1w(pts[4], pts[5], C24_A24plus, 6);
+  xDBLe_2x2x2x1w(pts[5], pts[6], C24_A24plus, 4);
+  xDBLe_2x2x2x1w(pts[6], pts[7], C24_A24plus, 2);
+  xDBLe_2x2x2x1w(pts[7], pts[8], C24_A24plus, 2);
+  get_4_isog_2x2x2x1w(pts[8], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 19);
+
+  get_4_isog_2x2x2x1w(pts[7], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 17);
+
+  get_4_isog_2x2x2x1w(pts[6], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 15);
+
+  xDBLe_2x2x2x1w(pts[5], pts[6], C24_A24plus, 2);
+  get_4_isog_2x2x2x1w(pts[6], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 15);
+
+  get_4_isog_2x2x2x1w(pts[5], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 13);
+
+  xDBLe_2x2x2x1w(pts[4], pts[5], C24_A24plus, 2);
+  xDBLe_2x2x2x1w(pts[5], pts[6], C24_A24plus, 2);
+  get_4_isog_2x2x2x1w(pts[6], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 15);
+
+  get_4_isog_2x2x2x1w(pts[5], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 13);
+
+  get_4_isog_2x2x2x1w(pts[4], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 11);
+
+  xDBLe_2x2x2x1w(pts[3], pts[4], C24_A24plus, 4);
+  xDBLe_2x2x2x1w(pts[4], pts[5], C24_A24plus, 2);
+  xDBLe_2x2x2x1w(pts[5], pts[6], C24_A24plus, 2);
+  get_4_isog_2x2x2x1w(pts[6], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 15);
+
+  get_4_isog_2x2x2x1w(pts[5], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 13);
+
+  get_4_isog_2x2x2x1w(pts[4], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 11);
+
+  xDBLe_2x2x2x1w(pts[3], pts[4], C24_A24plus, 2);
+  get_4_isog_2x2x2x1w(pts[4], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 11);
+
+  get_4_isog_2x2x2x1w(pts[3], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 9);
+
+  xDBLe_2x2x2x1w(pts[2], pts[3], C24_A24plus, 8);
+  xDBLe_2x2x2x1w(pts[3], pts[4], C24_A24plus, 4);
+  xDBLe_2x2x2x1w(pts[4], pts[5], C24_A24plus, 2);
+  xDBLe_2x2x2x1w(pts[5], pts[6], C24_A24plus, 2);
+  get_4_isog_2x2x2x1w(pts[6], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 15);
+
+  get_4_isog_2x2x2x1w(pts[5], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 13);
+
+  get_4_isog_2x2x2x1w(pts[4], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 11);
+
+  xDBLe_2x2x2x1w(pts[3], pts[4], C24_A24plus, 2);
+  get_4_isog_2x2x2x1w(pts[4], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 11);
+
+  get_4_isog_2x2x2x1w(pts[3], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 9);
+
+  xDBLe_2x2x2x1w(pts[2], pts[3], C24_A24plus, 4);
+  xDBLe_2x2x2x1w(pts[3], pts[4], C24_A24plus, 2);
+  get_4_isog_2x2x2x1w(pts[4], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 11);
+
+  get_4_isog_2x2x2x1w(pts[3], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 9);
+
+  xDBLe_2x2x2x1w(pts[2], pts[3], C24_A24plus, 2);
+  get_4_isog_2x2x2x1w(pts[3], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 9);
+
+  get_4_isog_2x2x2x1w(pts[2], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 7);
+
+  xDBLe_2x2x2x1w(pts[1], pts[2], C24_A24plus, 14);
+  xDBLe_2x2x2x1w(pts[2], pts[3], C24_A24plus, 8);
+  xDBLe_2x2x2x1w(pts[3], pts[4], C24_A24plus, 4);
+  xDBLe_2x2x2x1w(pts[4], pts[5], C24_A24plus, 2);
+  xDBLe_2x2x2x1w(pts[5], pts[6], C24_A24plus, 2);
+  get_4_isog_2x2x2x1w(pts[6], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 15);
+
+  get_4_isog_2x2x2x1w(pts[5], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 13);
+
+  get_4_isog_2x2x2x1w(pts[4], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 11);
+
+  xDBLe_2x2x2x1w(pts[3], pts[4], C24_A24plus, 2);
+  get_4_isog_2x2x2x1w(pts[4], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 11);
+
+  get_4_isog_2x2x2x1w(pts[3], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 9);
+
+  xDBLe_2x2x2x1w(pts[2], pts[3], C24_A24plus, 4);
+  xDBLe_2x2x2x1w(pts[3], pts[4], C24_A24plus, 2);
+  get_4_isog_2x2x2x1w(pts[4], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 11);
+
+  get_4_isog_2x2x2x1w(pts[3], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 9);
+
+  xDBLe_2x2x2x1w(pts[2], pts[3], C24_A24plus, 2);
+  get_4_isog_2x2x2x1w(pts[3], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 9);
+
+  get_4_isog_2x2x2x1w(pts[2], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 7);
+
+  xDBLe_2x2x2x1w(pts[1], pts[2], C24_A24plus, 6);
+  xDBLe_2x2x2x1w(pts[2], pts[3], C24_A24plus, 4);
+  xDBLe_2x2x2x1w(pts[3], pts[4], C24_A24plus, 2);
+  get_4_isog_2x2x2x1w(pts[4], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 11);
+
+  get_4_isog_2x2x2x1w(pts[3], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 9);
+
+  xDBLe_2x2x2x1w(pts[2], pts[3], C24_A24plus, 2);
+  get_4_isog_2x2x2x1w(pts[3], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 9);
+
+  get_4_isog_2x2x2x1w(pts[2], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 7);
+
+  xDBLe_2x2x2x1w(pts[1], pts[2], C24_A24plus, 2);
+  xDBLe_2x2x2x1w(pts[2], pts[3], C24_A24plus, 2);
+  get_4_isog_2x2x2x1w(pts[3], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 9);
+
+  get_4_isog_2x2x2x1w(pts[2], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 7);
+
+  get_4_isog_2x2x2x1w(pts[1], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 5);
+
+  xDBLe_2x2x2x1w(pts[0], pts[1], C24_A24plus, 44);
+  xDBLe_2x2x2x1w(pts[1], pts[2], C24_A24plus, 30);
+  xDBLe_2x2x2x1w(pts[2], pts[3], C24_A24plus, 18);
+  xDBLe_2x2x2x1w(pts[3], pts[4], C24_A24plus, 10);
+  xDBLe_2x2x2x1w(pts[4], pts[5], C24_A24plus, 6);
+  xDBLe_2x2x2x1w(pts[5], pts[6], C24_A24plus, 4);
+  xDBLe_2x2x2x1w(pts[6], pts[7], C24_A24plus, 2);
+  xDBLe_2x2x2x1w(pts[7], pts[8], C24_A24plus, 2);
+  get_4_isog_2x2x2x1w(pts[8], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 19);
+
+  get_4_isog_2x2x2x1w(pts[7], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 17);
+
+  get_4_isog_2x2x2x1w(pts[6], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 15);
+
+  xDBLe_2x2x2x1w(pts[5], pts[6], C24_A24plus, 2);
+  get_4_isog_2x2x2x1w(pts[6], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 15);
+
+  get_4_isog_2x2x2x1w(pts[5], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 13);
+
+  xDBLe_2x2x2x1w(pts[4], pts[5], C24_A24plus, 2);
+  xDBLe_2x2x2x1w(pts[5], pts[6], C24_A24plus, 2);
+  get_4_isog_2x2x2x1w(pts[6], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 15);
+
+  get_4_isog_2x2x2x1w(pts[5], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 13);
+
+  get_4_isog_2x2x2x1w(pts[4], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 11);
+
+  xDBLe_2x2x2x1w(pts[3], pts[4], C24_A24plus, 4);
+  xDBLe_2x2x2x1w(pts[4], pts[5], C24_A24plus, 2);
+  xDBLe_2x2x2x1w(pts[5], pts[6], C24_A24plus, 2);
+  get_4_isog_2x2x2x1w(pts[6], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 15);
+
+  get_4_isog_2x2x2x1w(pts[5], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 13);
+
+  get_4_isog_2x2x2x1w(pts[4], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 11);
+
+  xDBLe_2x2x2x1w(pts[3], pts[4], C24_A24plus, 2);
+  get_4_isog_2x2x2x1w(pts[4], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 11);
+
+  get_4_isog_2x2x2x1w(pts[3], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 9);
+
+  xDBLe_2x2x2x1w(pts[2], pts[3], C24_A24plus, 8);
+  xDBLe_2x2x2x1w(pts[3], pts[4], C24_A24plus, 4);
+  xDBLe_2x2x2x1w(pts[4], pts[5], C24_A24plus, 2);
+  xDBLe_2x2x2x1w(pts[5], pts[6], C24_A24plus, 2);
+  get_4_isog_2x2x2x1w(pts[6], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 15);
+
+  get_4_isog_2x2x2x1w(pts[5], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 13);
+
+  get_4_isog_2x2x2x1w(pts[4], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 11);
+
+  xDBLe_2x2x2x1w(pts[3], pts[4], C24_A24plus, 2);
+  get_4_isog_2x2x2x1w(pts[4], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 11);
+
+  get_4_isog_2x2x2x1w(pts[3], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 9);
+
+  xDBLe_2x2x2x1w(pts[2], pts[3], C24_A24plus, 4);
+  xDBLe_2x2x2x1w(pts[3], pts[4], C24_A24plus, 2);
+  get_4_isog_2x2x2x1w(pts[4], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 11);
+
+  get_4_isog_2x2x2x1w(pts[3], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 9);
+
+  xDBLe_2x2x2x1w(pts[2], pts[3], C24_A24plus, 2);
+  get_4_isog_2x2x2x1w(pts[3], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 9);
+
+  get_4_isog_2x2x2x1w(pts[2], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 7);
+
+  xDBLe_2x2x2x1w(pts[1], pts[2], C24_A24plus, 12);
+  xDBLe_2x2x2x1w(pts[2], pts[3], C24_A24plus, 8);
+  xDBLe_2x2x2x1w(pts[3], pts[4], C24_A24plus, 4);
+  xDBLe_2x2x2x1w(pts[4], pts[5], C24_A24plus, 2);
+  xDBLe_2x2x2x1w(pts[5], pts[6], C24_A24plus, 2);
+  get_4_isog_2x2x2x1w(pts[6], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 15);
+
+  get_4_isog_2x2x2x1w(pts[5], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 13);
+
+  get_4_isog_2x2x2x1w(pts[4], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 11);
+
+  xDBLe_2x2x2x1w(pts[3], pts[4], C24_A24plus, 2);
+  get_4_isog_2x2x2x1w(pts[4], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 11);
+
+  get_4_isog_2x2x2x1w(pts[3], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 9);
+
+  xDBLe_2x2x2x1w(pts[2], pts[3], C24_A24plus, 4);
+  xDBLe_2x2x2x1w(pts[3], pts[4], C24_A24plus, 2);
+  get_4_isog_2x2x2x1w(pts[4], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 11);
+
+  get_4_isog_2x2x2x1w(pts[3], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 9);
+
+  xDBLe_2x2x2x1w(pts[2], pts[3], C24_A24plus, 2);
+  get_4_isog_2x2x2x1w(pts[3], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 9);
+
+  get_4_isog_2x2x2x1w(pts[2], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 7);
+
+  xDBLe_2x2x2x1w(pts[1], pts[2], C24_A24plus, 4);
+  xDBLe_2x2x2x1w(pts[2], pts[3], C24_A24plus, 4);
+  xDBLe_2x2x2x1w(pts[3], pts[4], C24_A24plus, 2);
+  get_4_isog_2x2x2x1w(pts[4], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 11);
+
+  get_4_isog_2x2x2x1w(pts[3], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 9);
+
+  xDBLe_2x2x2x1w(pts[2], pts[3], C24_A24plus, 2);
+  get_4_isog_2x2x2x1w(pts[3], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 9);
+
+  get_4_isog_2x2x2x1w(pts[2], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 7);
+
+  xDBLe_2x2x2x1w(pts[1], pts[2], C24_A24plus, 2);
+  get_4_isog_2x2x2x1w(pts[2], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 7);
+
+  get_4_isog_2x2x2x1w(pts[1], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 5);
+
+  xDBLe_2x2x2x1w(pts[0], pts[1], C24_A24plus, 18);
+  xDBLe_2x2x2x1w(pts[1], pts[2], C24_A24plus, 10);
+  xDBLe_2x2x2x1w(pts[2], pts[3], C24_A24plus, 6);
+  xDBLe_2x2x2x1w(pts[3], pts[4], C24_A24plus, 4);
+  xDBLe_2x2x2x1w(pts[4], pts[5], C24_A24plus, 2);
+  xDBLe_2x2x2x1w(pts[5], pts[6], C24_A24plus, 2);
+  get_4_isog_2x2x2x1w(pts[6], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 15);
+
+  get_4_isog_2x2x2x1w(pts[5], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 13);
+
+  get_4_isog_2x2x2x1w(pts[4], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 11);
+
+  xDBLe_2x2x2x1w(pts[3], pts[4], C24_A24plus, 2);
+  get_4_isog_2x2x2x1w(pts[4], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 11);
+
+  get_4_isog_2x2x2x1w(pts[3], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 9);
+
+  xDBLe_2x2x2x1w(pts[2], pts[3], C24_A24plus, 2);
+  xDBLe_2x2x2x1w(pts[3], pts[4], C24_A24plus, 2);
+  get_4_isog_2x2x2x1w(pts[4], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 11);
+
+  get_4_isog_2x2x2x1w(pts[3], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 9);
+
+  get_4_isog_2x2x2x1w(pts[2], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 7);
+
+  xDBLe_2x2x2x1w(pts[1], pts[2], C24_A24plus, 4);
+  xDBLe_2x2x2x1w(pts[2], pts[3], C24_A24plus, 2);
+  xDBLe_2x2x2x1w(pts[3], pts[4], C24_A24plus, 2);
+  get_4_isog_2x2x2x1w(pts[4], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 11);
+
+  get_4_isog_2x2x2x1w(pts[3], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 9);
+
+  get_4_isog_2x2x2x1w(pts[2], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 7);
+
+  xDBLe_2x2x2x1w(pts[1], pts[2], C24_A24plus, 2);
+  get_4_isog_2x2x2x1w(pts[2], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 7);
+
+  get_4_isog_2x2x2x1w(pts[1], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 5);
+
+  xDBLe_2x2x2x1w(pts[0], pts[1], C24_A24plus, 8);
+  xDBLe_2x2x2x1w(pts[1], pts[2], C24_A24plus, 4);
+  xDBLe_2x2x2x1w(pts[2], pts[3], C24_A24plus, 2);
+  xDBLe_2x2x2x1w(pts[3], pts[4], C24_A24plus, 2);
+  get_4_isog_2x2x2x1w(pts[4], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 11);
+
+  get_4_isog_2x2x2x1w(pts[3], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 9);
+
+  get_4_isog_2x2x2x1w(pts[2], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 7);
+
+  xDBLe_2x2x2x1w(pts[1], pts[2], C24_A24plus, 2);
+  get_4_isog_2x2x2x1w(pts[2], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 7);
+
+  get_4_isog_2x2x2x1w(pts[1], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 5);
+
+  xDBLe_2x2x2x1w(pts[0], pts[1], C24_A24plus, 4);
+  xDBLe_2x2x2x1w(pts[1], pts[2], C24_A24plus, 2);
+  get_4_isog_2x2x2x1w(pts[2], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 7);
+
+  get_4_isog_2x2x2x1w(pts[1], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 5);
+
+  xDBLe_2x2x2x1w(pts[0], pts[1], C24_A24plus, 2);
+  get_4_isog_2x2x2x1w(pts[1], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 5);
+
+  get_4_isog_2x2x2x1w(pts[0], C24_A24plus, coeff__0, coeff2_1);
+  eval_4_isog_parallel_kgss(pts, phiP, phiQ, phiR, coeff__0, coeff2_1, 3);
+}
+
+static void traverse_Bob_kg(vgelm_t *pts, vgelm_t C24_A24plus, vgelm_t phiP, vgelm_t phiQ, vgelm_t phiR)
+{
+  vgelm_t coeff1_0;
+
+  xTPLe_1x2x2x2w(pts[0], pts[1], C24_A24plus, 54);
+  xTPLe_1x2x2x2w(pts[1], pts[2], C24_A24plus, 42);
+  xTPLe_1x2x2x2w(pts[2], pts[3], C24_A24plus, 29);
+  xTPLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 20);
+  xTPLe_1x2x2x2w(pts[4], pts[5], C24_A24plus, 14);
+  xTPLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 10);
+  xTPLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 7);
+  xTPLe_1x2x2x2w(pts[7], pts[8], C24_A24plus, 5);
+  xTPLe_1x2x2x2w(pts[8], pts[9], C24_A24plus, 4);
+  xTPLe_1x2x2x2w(pts[9], pts[10], C24_A24plus, 3);
+  xTPLe_1x2x2x2w(pts[10], pts[11], C24_A24plus, 2);
+  xTPLe_1x2x2x2w(pts[11], pts[12], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[12], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 15);
+
+  get_3_isog_1x2x2x2w(pts[11], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 14);
+
+  xTPLe_1x2x2x2w(pts[10], pts[11], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[11], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 14);
+
+  get_3_isog_1x2x2x2w(pts[10], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 13);
+
+  xTPLe_1x2x2x2w(pts[9], pts[10], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[10], pts[11], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[11], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 14);
+
+  get_3_isog_1x2x2x2w(pts[10], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 13);
+
+  get_3_isog_1x2x2x2w(pts[9], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 12);
+
+  xTPLe_1x2x2x2w(pts[8], pts[9], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[9], pts[10], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[10], pts[11], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[11], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 14);
+
+  get_3_isog_1x2x2x2w(pts[10], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 13);
+
+  get_3_isog_1x2x2x2w(pts[9], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 12);
+
+  get_3_isog_1x2x2x2w(pts[8], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 11);
+
+  xTPLe_1x2x2x2w(pts[7], pts[8], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[8], pts[9], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[9], pts[10], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[10], pts[11], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[11], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 14);
+
+  get_3_isog_1x2x2x2w(pts[10], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 13);
+
+  get_3_isog_1x2x2x2w(pts[9], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 12);
+
+  get_3_isog_1x2x2x2w(pts[8], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 11);
+
+  get_3_isog_1x2x2x2w(pts[7], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 10);
+
+  xTPLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 2);
+  xTPLe_1x2x2x2w(pts[7], pts[8], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[8], pts[9], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[9], pts[10], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[10], pts[11], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[11], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 14);
+
+  get_3_isog_1x2x2x2w(pts[10], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 13);
+
+  get_3_isog_1x2x2x2w(pts[9], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 12);
+
+  get_3_isog_1x2x2x2w(pts[8], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 11);
+
+  get_3_isog_1x2x2x2w(pts[7], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 10);
+
+  xTPLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[7], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 10);
+
+  get_3_isog_1x2x2x2w(pts[6], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 9);
+
+  xTPLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 3);
+  xTPLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 2);
+  xTPLe_1x2x2x2w(pts[7], pts[8], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[8], pts[9], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[9], pts[10], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[10], pts[11], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[11], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 14);
+
+  get_3_isog_1x2x2x2w(pts[10], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 13);
+
+  get_3_isog_1x2x2x2w(pts[9], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 12);
+
+  get_3_isog_1x2x2x2w(pts[8], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 11);
+
+  get_3_isog_1x2x2x2w(pts[7], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 10);
+
+  xTPLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[7], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 10);
+
+  get_3_isog_1x2x2x2w(pts[6], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 9);
+
+  xTPLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[7], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 10);
+
+  get_3_isog_1x2x2x2w(pts[6], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 9);
+
+  get_3_isog_1x2x2x2w(pts[5], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 8);
+
+  xTPLe_1x2x2x2w(pts[4], pts[5], C24_A24plus, 4);
+  xTPLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 3);
+  xTPLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 2);
+  xTPLe_1x2x2x2w(pts[7], pts[8], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[8], pts[9], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[9], pts[10], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[10], pts[11], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[11], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 14);
+
+  get_3_isog_1x2x2x2w(pts[10], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 13);
+
+  get_3_isog_1x2x2x2w(pts[9], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 12);
+
+  get_3_isog_1x2x2x2w(pts[8], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 11);
+
+  get_3_isog_1x2x2x2w(pts[7], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 10);
+
+  xTPLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[7], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 10);
+
+  get_3_isog_1x2x2x2w(pts[6], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 9);
+
+  xTPLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[7], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 10);
+
+  get_3_isog_1x2x2x2w(pts[6], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 9);
+
+  get_3_isog_1x2x2x2w(pts[5], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 8);
+
+  xTPLe_1x2x2x2w(pts[4], pts[5], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[7], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 10);
+
+  get_3_isog_1x2x2x2w(pts[6], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 9);
+
+  get_3_isog_1x2x2x2w(pts[5], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 8);
+
+  get_3_isog_1x2x2x2w(pts[4], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 7);
+
+  xTPLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 6);
+  xTPLe_1x2x2x2w(pts[4], pts[5], C24_A24plus, 4);
+  xTPLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 3);
+  xTPLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 2);
+  xTPLe_1x2x2x2w(pts[7], pts[8], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[8], pts[9], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[9], pts[10], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[10], pts[11], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[11], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 14);
+
+  get_3_isog_1x2x2x2w(pts[10], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 13);
+
+  get_3_isog_1x2x2x2w(pts[9], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 12);
+
+  get_3_isog_1x2x2x2w(pts[8], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 11);
+
+  get_3_isog_1x2x2x2w(pts[7], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 10);
+
+  xTPLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[7], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 10);
+
+  get_3_isog_1x2x2x2w(pts[6], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 9);
+
+  xTPLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[7], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 10);
+
+  get_3_isog_1x2x2x2w(pts[6], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 9);
+
+  get_3_isog_1x2x2x2w(pts[5], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 8);
+
+  xTPLe_1x2x2x2w(pts[4], pts[5], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[7], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 10);
+
+  get_3_isog_1x2x2x2w(pts[6], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 9);
+
+  get_3_isog_1x2x2x2w(pts[5], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 8);
+
+  get_3_isog_1x2x2x2w(pts[4], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 7);
+
+  xTPLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 2);
+  xTPLe_1x2x2x2w(pts[4], pts[5], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[7], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 10);
+
+  get_3_isog_1x2x2x2w(pts[6], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 9);
+
+  get_3_isog_1x2x2x2w(pts[5], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 8);
+
+  get_3_isog_1x2x2x2w(pts[4], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 7);
+
+  xTPLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[4], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 7);
+
+  get_3_isog_1x2x2x2w(pts[3], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 6);
+
+  xTPLe_1x2x2x2w(pts[2], pts[3], C24_A24plus, 9);
+  xTPLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 6);
+  xTPLe_1x2x2x2w(pts[4], pts[5], C24_A24plus, 4);
+  xTPLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 3);
+  xTPLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 2);
+  xTPLe_1x2x2x2w(pts[7], pts[8], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[8], pts[9], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[9], pts[10], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[10], pts[11], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[11], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 14);
+
+  get_3_isog_1x2x2x2w(pts[10], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 13);
+
+  get_3_isog_1x2x2x2w(pts[9], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 12);
+
+  get_3_isog_1x2x2x2w(pts[8], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 11);
+
+  get_3_isog_1x2x2x2w(pts[7], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 10);
+
+  xTPLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[7], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 10);
+
+  get_3_isog_1x2x2x2w(pts[6], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 9);
+
+  xTPLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[7], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 10);
+
+  get_3_isog_1x2x2x2w(pts[6], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 9);
+
+  get_3_isog_1x2x2x2w(pts[5], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 8);
+
+  xTPLe_1x2x2x2w(pts[4], pts[5], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[7], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 10);
+
+  get_3_isog_1x2x2x2w(pts[6], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 9);
+
+  get_3_isog_1x2x2x2w(pts[5], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 8);
+
+  get_3_isog_1x2x2x2w(pts[4], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 7);
+
+  xTPLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 2);
+  xTPLe_1x2x2x2w(pts[4], pts[5], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[7], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 10);
+
+  get_3_isog_1x2x2x2w(pts[6], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 9);
+
+  get_3_isog_1x2x2x2w(pts[5], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 8);
+
+  get_3_isog_1x2x2x2w(pts[4], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 7);
+
+  xTPLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[4], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 7);
+
+  get_3_isog_1x2x2x2w(pts[3], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 6);
+
+  xTPLe_1x2x2x2w(pts[2], pts[3], C24_A24plus, 3);
+  xTPLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 2);
+  xTPLe_1x2x2x2w(pts[4], pts[5], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[7], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 10);
+
+  get_3_isog_1x2x2x2w(pts[6], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 9);
+
+  get_3_isog_1x2x2x2w(pts[5], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 8);
+
+  get_3_isog_1x2x2x2w(pts[4], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 7);
+
+  xTPLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[4], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 7);
+
+  get_3_isog_1x2x2x2w(pts[3], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 6);
+
+  xTPLe_1x2x2x2w(pts[2], pts[3], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[4], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 7);
+
+  get_3_isog_1x2x2x2w(pts[3], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 6);
+
+  get_3_isog_1x2x2x2w(pts[2], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 5);
+
+  xTPLe_1x2x2x2w(pts[1], pts[2], C24_A24plus, 13);
+  xTPLe_1x2x2x2w(pts[2], pts[3], C24_A24plus, 9);
+  xTPLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 6);
+  xTPLe_1x2x2x2w(pts[4], pts[5], C24_A24plus, 4);
+  xTPLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 3);
+  xTPLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 2);
+  xTPLe_1x2x2x2w(pts[7], pts[8], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[8], pts[9], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[9], pts[10], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[10], pts[11], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[11], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 14);
+
+  get_3_isog_1x2x2x2w(pts[10], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 13);
+
+  get_3_isog_1x2x2x2w(pts[9], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 12);
+
+  get_3_isog_1x2x2x2w(pts[8], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 11);
+
+  get_3_isog_1x2x2x2w(pts[7], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 10);
+
+  xTPLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[7], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 10);
+
+  get_3_isog_1x2x2x2w(pts[6], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 9);
+
+  xTPLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[7], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 10);
+
+  get_3_isog_1x2x2x2w(pts[6], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 9);
+
+  get_3_isog_1x2x2x2w(pts[5], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 8);
+
+  xTPLe_1x2x2x2w(pts[4], pts[5], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[7], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 10);
+
+  get_3_isog_1x2x2x2w(pts[6], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 9);
+
+  get_3_isog_1x2x2x2w(pts[5], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 8);
+
+  get_3_isog_1x2x2x2w(pts[4], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 7);
+
+  xTPLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 2);
+  xTPLe_1x2x2x2w(pts[4], pts[5], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[7], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 10);
+
+  get_3_isog_1x2x2x2w(pts[6], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 9);
+
+  get_3_isog_1x2x2x2w(pts[5], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 8);
+
+  get_3_isog_1x2x2x2w(pts[4], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 7);
+
+  xTPLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[4], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 7);
+
+  get_3_isog_1x2x2x2w(pts[3], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 6);
+
+  xTPLe_1x2x2x2w(pts[2], pts[3], C24_A24plus, 3);
+  xTPLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 2);
+  xTPLe_1x2x2x2w(pts[4], pts[5], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[7], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 10);
+
+  get_3_isog_1x2x2x2w(pts[6], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 9);
+
+  get_3_isog_1x2x2x2w(pts[5], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 8);
+
+  get_3_isog_1x2x2x2w(pts[4], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 7);
+
+  xTPLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[4], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 7);
+
+  get_3_isog_1x2x2x2w(pts[3], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 6);
+
+  xTPLe_1x2x2x2w(pts[2], pts[3], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[4], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 7);
+
+  get_3_isog_1x2x2x2w(pts[3], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 6);
+
+  get_3_isog_1x2x2x2w(pts[2], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 5);
+
+  xTPLe_1x2x2x2w(pts[1], pts[2], C24_A24plus, 4);
+  xTPLe_1x2x2x2w(pts[2], pts[3], C24_A24plus, 3);
+  xTPLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 2);
+  xTPLe_1x2x2x2w(pts[4], pts[5], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[7], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 10);
+
+  get_3_isog_1x2x2x2w(pts[6], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 9);
+
+  get_3_isog_1x2x2x2w(pts[5], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 8);
+
+  get_3_isog_1x2x2x2w(pts[4], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 7);
+
+  xTPLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[4], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 7);
+
+  get_3_isog_1x2x2x2w(pts[3], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 6);
+
+  xTPLe_1x2x2x2w(pts[2], pts[3], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[4], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 7);
+
+  get_3_isog_1x2x2x2w(pts[3], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 6);
+
+  get_3_isog_1x2x2x2w(pts[2], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 5);
+
+  xTPLe_1x2x2x2w(pts[1], pts[2], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[2], pts[3], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[4], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 7);
+
+  get_3_isog_1x2x2x2w(pts[3], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 6);
+
+  get_3_isog_1x2x2x2w(pts[2], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 5);
+
+  get_3_isog_1x2x2x2w(pts[1], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 4);
+
+  xTPLe_1x2x2x2w(pts[0], pts[1], C24_A24plus, 14);
+  xTPLe_1x2x2x2w(pts[1], pts[2], C24_A24plus, 11);
+  xTPLe_1x2x2x2w(pts[2], pts[3], C24_A24plus, 9);
+  xTPLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 6);
+  xTPLe_1x2x2x2w(pts[4], pts[5], C24_A24plus, 4);
+  xTPLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 3);
+  xTPLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 2);
+  xTPLe_1x2x2x2w(pts[7], pts[8], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[8], pts[9], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[9], pts[10], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[10], pts[11], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[11], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 14);
+
+  get_3_isog_1x2x2x2w(pts[10], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 13);
+
+  get_3_isog_1x2x2x2w(pts[9], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 12);
+
+  get_3_isog_1x2x2x2w(pts[8], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 11);
+
+  get_3_isog_1x2x2x2w(pts[7], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 10);
+
+  xTPLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[7], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 10);
+
+  get_3_isog_1x2x2x2w(pts[6], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 9);
+
+  xTPLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[7], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 10);
+
+  get_3_isog_1x2x2x2w(pts[6], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 9);
+
+  get_3_isog_1x2x2x2w(pts[5], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 8);
+
+  xTPLe_1x2x2x2w(pts[4], pts[5], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[7], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 10);
+
+  get_3_isog_1x2x2x2w(pts[6], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 9);
+
+  get_3_isog_1x2x2x2w(pts[5], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 8);
+
+  get_3_isog_1x2x2x2w(pts[4], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 7);
+
+  xTPLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 2);
+  xTPLe_1x2x2x2w(pts[4], pts[5], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[7], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 10);
+
+  get_3_isog_1x2x2x2w(pts[6], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 9);
+
+  get_3_isog_1x2x2x2w(pts[5], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 8);
+
+  get_3_isog_1x2x2x2w(pts[4], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 7);
+
+  xTPLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[4], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 7);
+
+  get_3_isog_1x2x2x2w(pts[3], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 6);
+
+  xTPLe_1x2x2x2w(pts[2], pts[3], C24_A24plus, 3);
+  xTPLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 2);
+  xTPLe_1x2x2x2w(pts[4], pts[5], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[7], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 10);
+
+  get_3_isog_1x2x2x2w(pts[6], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 9);
+
+  get_3_isog_1x2x2x2w(pts[5], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 8);
+
+  get_3_isog_1x2x2x2w(pts[4], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 7);
+
+  xTPLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[4], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 7);
+
+  get_3_isog_1x2x2x2w(pts[3], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 6);
+
+  xTPLe_1x2x2x2w(pts[2], pts[3], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[4], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 7);
+
+  get_3_isog_1x2x2x2w(pts[3], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 6);
+
+  get_3_isog_1x2x2x2w(pts[2], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 5);
+
+  xTPLe_1x2x2x2w(pts[1], pts[2], C24_A24plus, 3);
+  xTPLe_1x2x2x2w(pts[2], pts[3], C24_A24plus, 2);
+  xTPLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 2);
+  xTPLe_1x2x2x2w(pts[4], pts[5], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[7], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 10);
+
+  get_3_isog_1x2x2x2w(pts[6], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 9);
+
+  get_3_isog_1x2x2x2w(pts[5], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 8);
+
+  get_3_isog_1x2x2x2w(pts[4], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 7);
+
+  xTPLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[4], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 7);
+
+  get_3_isog_1x2x2x2w(pts[3], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 6);
+
+  xTPLe_1x2x2x2w(pts[2], pts[3], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[3], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 6);
+
+  get_3_isog_1x2x2x2w(pts[2], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 5);
+
+  xTPLe_1x2x2x2w(pts[1], pts[2], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[2], pts[3], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[3], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 6);
+
+  get_3_isog_1x2x2x2w(pts[2], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 5);
+
+  get_3_isog_1x2x2x2w(pts[1], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 4);
+
+  xTPLe_1x2x2x2w(pts[0], pts[1], C24_A24plus, 4);
+  xTPLe_1x2x2x2w(pts[1], pts[2], C24_A24plus, 3);
+  xTPLe_1x2x2x2w(pts[2], pts[3], C24_A24plus, 2);
+  xTPLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[4], pts[5], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[7], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 10);
+
+  get_3_isog_1x2x2x2w(pts[6], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 9);
+
+  get_3_isog_1x2x2x2w(pts[5], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 8);
+
+  get_3_isog_1x2x2x2w(pts[4], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 7);
+
+  get_3_isog_1x2x2x2w(pts[3], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 6);
+
+  xTPLe_1x2x2x2w(pts[2], pts[3], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[3], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 6);
+
+  get_3_isog_1x2x2x2w(pts[2], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 5);
+
+  xTPLe_1x2x2x2w(pts[1], pts[2], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[2], pts[3], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[3], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 6);
+
+  get_3_isog_1x2x2x2w(pts[2], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 5);
+
+  get_3_isog_1x2x2x2w(pts[1], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 4);
+
+  xTPLe_1x2x2x2w(pts[0], pts[1], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[1], pts[2], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[2], pts[3], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[3], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 6);
+
+  get_3_isog_1x2x2x2w(pts[2], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 5);
+
+  get_3_isog_1x2x2x2w(pts[1], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 4);
+
+  get_3_isog_1x2x2x2w(pts[0], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff1_0, 3);
+}
+
+static void traverse_Bob_ss(vgelm_t *pts, vgelm_t C24_A24plus)
+{
+  vgelm_t coeff1_0;
+
+  xTPLe_1x2x2x2w(pts[0], pts[1], C24_A24plus, 59);
+  xTPLe_1x2x2x2w(pts[1], pts[2], C24_A24plus, 41);
+  xTPLe_1x2x2x2w(pts[2], pts[3], C24_A24plus, 28);
+  xTPLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 19);
+  xTPLe_1x2x2x2w(pts[4], pts[5], C24_A24plus, 13);
+  xTPLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 11);
+  xTPLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 8);
+  xTPLe_1x2x2x2w(pts[7], pts[8], C24_A24plus, 5);
+  xTPLe_1x2x2x2w(pts[8], pts[9], C24_A24plus, 3);
+  xTPLe_1x2x2x2w(pts[9], pts[10], C24_A24plus, 2);
+  xTPLe_1x2x2x2w(pts[10], pts[11], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[11], pts[12], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[12], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 12);
+
+  get_3_isog_1x2x2x2w(pts[11], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 11);
+
+  get_3_isog_1x2x2x2w(pts[10], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 10);
+
+  xTPLe_1x2x2x2w(pts[9], pts[10], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[10], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 10);
+
+  get_3_isog_1x2x2x2w(pts[9], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 9);
+
+  xTPLe_1x2x2x2w(pts[8], pts[9], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[9], pts[10], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[10], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 10);
+
+  get_3_isog_1x2x2x2w(pts[9], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 9);
+
+  get_3_isog_1x2x2x2w(pts[8], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 8);
+
+  xTPLe_1x2x2x2w(pts[7], pts[8], C24_A24plus, 2);
+  xTPLe_1x2x2x2w(pts[8], pts[9], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[9], pts[10], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[10], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 10);
+
+  get_3_isog_1x2x2x2w(pts[9], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 9);
+
+  get_3_isog_1x2x2x2w(pts[8], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 8);
+
+  xTPLe_1x2x2x2w(pts[7], pts[8], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[8], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 8);
+
+  get_3_isog_1x2x2x2w(pts[7], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 7);
+
+  xTPLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 3);
+  xTPLe_1x2x2x2w(pts[7], pts[8], C24_A24plus, 2);
+  xTPLe_1x2x2x2w(pts[8], pts[9], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[9], pts[10], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[10], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 10);
+
+  get_3_isog_1x2x2x2w(pts[9], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 9);
+
+  get_3_isog_1x2x2x2w(pts[8], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 8);
+
+  xTPLe_1x2x2x2w(pts[7], pts[8], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[8], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 8);
+
+  get_3_isog_1x2x2x2w(pts[7], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 7);
+
+  xTPLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[7], pts[8], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[8], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 8);
+
+  get_3_isog_1x2x2x2w(pts[7], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 7);
+
+  get_3_isog_1x2x2x2w(pts[6], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 6);
+
+  xTPLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 3);
+  xTPLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 3);
+  xTPLe_1x2x2x2w(pts[7], pts[8], C24_A24plus, 2);
+  xTPLe_1x2x2x2w(pts[8], pts[9], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[9], pts[10], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[10], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 10);
+
+  get_3_isog_1x2x2x2w(pts[9], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 9);
+
+  get_3_isog_1x2x2x2w(pts[8], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 8);
+
+  xTPLe_1x2x2x2w(pts[7], pts[8], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[8], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 8);
+
+  get_3_isog_1x2x2x2w(pts[7], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 7);
+
+  xTPLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[7], pts[8], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[8], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 8);
+
+  get_3_isog_1x2x2x2w(pts[7], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 7);
+
+  get_3_isog_1x2x2x2w(pts[6], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 6);
+
+  xTPLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[7], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 7);
+
+  get_3_isog_1x2x2x2w(pts[6], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 6);
+
+  get_3_isog_1x2x2x2w(pts[5], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 5);
+
+  xTPLe_1x2x2x2w(pts[4], pts[5], C24_A24plus, 4);
+  xTPLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 3);
+  xTPLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 2);
+  xTPLe_1x2x2x2w(pts[7], pts[8], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[8], pts[9], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[9], pts[10], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[10], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 10);
+
+  get_3_isog_1x2x2x2w(pts[9], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 9);
+
+  get_3_isog_1x2x2x2w(pts[8], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 8);
+
+  get_3_isog_1x2x2x2w(pts[7], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 7);
+
+  xTPLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[7], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 7);
+
+  get_3_isog_1x2x2x2w(pts[6], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 6);
+
+  xTPLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[7], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 7);
+
+  get_3_isog_1x2x2x2w(pts[6], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 6);
+
+  get_3_isog_1x2x2x2w(pts[5], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 5);
+
+  xTPLe_1x2x2x2w(pts[4], pts[5], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[7], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 7);
+
+  get_3_isog_1x2x2x2w(pts[6], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 6);
+
+  get_3_isog_1x2x2x2w(pts[5], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 5);
+
+  get_3_isog_1x2x2x2w(pts[4], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 4);
+
+  xTPLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 6);
+  xTPLe_1x2x2x2w(pts[4], pts[5], C24_A24plus, 4);
+  xTPLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 3);
+  xTPLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 2);
+  xTPLe_1x2x2x2w(pts[7], pts[8], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[8], pts[9], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[9], pts[10], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[10], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 10);
+
+  get_3_isog_1x2x2x2w(pts[9], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 9);
+
+  get_3_isog_1x2x2x2w(pts[8], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 8);
+
+  get_3_isog_1x2x2x2w(pts[7], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 7);
+
+  xTPLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[7], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 7);
+
+  get_3_isog_1x2x2x2w(pts[6], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 6);
+
+  xTPLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[7], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 7);
+
+  get_3_isog_1x2x2x2w(pts[6], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 6);
+
+  get_3_isog_1x2x2x2w(pts[5], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 5);
+
+  xTPLe_1x2x2x2w(pts[4], pts[5], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[7], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 7);
+
+  get_3_isog_1x2x2x2w(pts[6], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 6);
+
+  get_3_isog_1x2x2x2w(pts[5], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 5);
+
+  get_3_isog_1x2x2x2w(pts[4], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 4);
+
+  xTPLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 2);
+  xTPLe_1x2x2x2w(pts[4], pts[5], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[7], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 7);
+
+  get_3_isog_1x2x2x2w(pts[6], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 6);
+
+  get_3_isog_1x2x2x2w(pts[5], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 5);
+
+  get_3_isog_1x2x2x2w(pts[4], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 4);
+
+  xTPLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[4], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 4);
+
+  get_3_isog_1x2x2x2w(pts[3], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 3);
+
+  xTPLe_1x2x2x2w(pts[2], pts[3], C24_A24plus, 9);
+  xTPLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 6);
+  xTPLe_1x2x2x2w(pts[4], pts[5], C24_A24plus, 4);
+  xTPLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 3);
+  xTPLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 2);
+  xTPLe_1x2x2x2w(pts[7], pts[8], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[8], pts[9], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[9], pts[10], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[10], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 10);
+
+  get_3_isog_1x2x2x2w(pts[9], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 9);
+
+  get_3_isog_1x2x2x2w(pts[8], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 8);
+
+  get_3_isog_1x2x2x2w(pts[7], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 7);
+
+  xTPLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[7], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 7);
+
+  get_3_isog_1x2x2x2w(pts[6], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 6);
+
+  xTPLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[7], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 7);
+
+  get_3_isog_1x2x2x2w(pts[6], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 6);
+
+  get_3_isog_1x2x2x2w(pts[5], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 5);
+
+  xTPLe_1x2x2x2w(pts[4], pts[5], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[7], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 7);
+
+  get_3_isog_1x2x2x2w(pts[6], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 6);
+
+  get_3_isog_1x2x2x2w(pts[5], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 5);
+
+  get_3_isog_1x2x2x2w(pts[4], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 4);
+
+  xTPLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 2);
+  xTPLe_1x2x2x2w(pts[4], pts[5], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[7], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 7);
+
+  get_3_isog_1x2x2x2w(pts[6], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 6);
+
+  get_3_isog_1x2x2x2w(pts[5], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 5);
+
+  get_3_isog_1x2x2x2w(pts[4], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 4);
+
+  xTPLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[4], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 4);
+
+  get_3_isog_1x2x2x2w(pts[3], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 3);
+
+  xTPLe_1x2x2x2w(pts[2], pts[3], C24_A24plus, 3);
+  xTPLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 2);
+  xTPLe_1x2x2x2w(pts[4], pts[5], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[7], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 7);
+
+  get_3_isog_1x2x2x2w(pts[6], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 6);
+
+  get_3_isog_1x2x2x2w(pts[5], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 5);
+
+  get_3_isog_1x2x2x2w(pts[4], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 4);
+
+  xTPLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[4], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 4);
+
+  get_3_isog_1x2x2x2w(pts[3], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 3);
+
+  xTPLe_1x2x2x2w(pts[2], pts[3], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[4], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 4);
+
+  get_3_isog_1x2x2x2w(pts[3], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 3);
+
+  get_3_isog_1x2x2x2w(pts[2], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 2);
+
+  xTPLe_1x2x2x2w(pts[1], pts[2], C24_A24plus, 13);
+  xTPLe_1x2x2x2w(pts[2], pts[3], C24_A24plus, 9);
+  xTPLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 6);
+  xTPLe_1x2x2x2w(pts[4], pts[5], C24_A24plus, 4);
+  xTPLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 3);
+  xTPLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 2);
+  xTPLe_1x2x2x2w(pts[7], pts[8], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[8], pts[9], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[9], pts[10], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[10], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 10);
+
+  get_3_isog_1x2x2x2w(pts[9], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 9);
+
+  get_3_isog_1x2x2x2w(pts[8], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 8);
+
+  get_3_isog_1x2x2x2w(pts[7], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 7);
+
+  xTPLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[7], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 7);
+
+  get_3_isog_1x2x2x2w(pts[6], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 6);
+
+  xTPLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[7], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 7);
+
+  get_3_isog_1x2x2x2w(pts[6], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 6);
+
+  get_3_isog_1x2x2x2w(pts[5], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 5);
+
+  xTPLe_1x2x2x2w(pts[4], pts[5], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[7], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 7);
+
+  get_3_isog_1x2x2x2w(pts[6], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 6);
+
+  get_3_isog_1x2x2x2w(pts[5], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 5);
+
+  get_3_isog_1x2x2x2w(pts[4], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 4);
+
+  xTPLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 2);
+  xTPLe_1x2x2x2w(pts[4], pts[5], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[7], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 7);
+
+  get_3_isog_1x2x2x2w(pts[6], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 6);
+
+  get_3_isog_1x2x2x2w(pts[5], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 5);
+
+  get_3_isog_1x2x2x2w(pts[4], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 4);
+
+  xTPLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[4], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 4);
+
+  get_3_isog_1x2x2x2w(pts[3], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 3);
+
+  xTPLe_1x2x2x2w(pts[2], pts[3], C24_A24plus, 3);
+  xTPLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 2);
+  xTPLe_1x2x2x2w(pts[4], pts[5], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[7], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 7);
+
+  get_3_isog_1x2x2x2w(pts[6], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 6);
+
+  get_3_isog_1x2x2x2w(pts[5], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 5);
+
+  get_3_isog_1x2x2x2w(pts[4], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 4);
+
+  xTPLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[4], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 4);
+
+  get_3_isog_1x2x2x2w(pts[3], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 3);
+
+  xTPLe_1x2x2x2w(pts[2], pts[3], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[4], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 4);
+
+  get_3_isog_1x2x2x2w(pts[3], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 3);
+
+  get_3_isog_1x2x2x2w(pts[2], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 2);
+
+  xTPLe_1x2x2x2w(pts[1], pts[2], C24_A24plus, 4);
+  xTPLe_1x2x2x2w(pts[2], pts[3], C24_A24plus, 3);
+  xTPLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 2);
+  xTPLe_1x2x2x2w(pts[4], pts[5], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[7], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 7);
+
+  get_3_isog_1x2x2x2w(pts[6], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 6);
+
+  get_3_isog_1x2x2x2w(pts[5], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 5);
+
+  get_3_isog_1x2x2x2w(pts[4], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 4);
+
+  xTPLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[4], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 4);
+
+  get_3_isog_1x2x2x2w(pts[3], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 3);
+
+  xTPLe_1x2x2x2w(pts[2], pts[3], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[4], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 4);
+
+  get_3_isog_1x2x2x2w(pts[3], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 3);
+
+  get_3_isog_1x2x2x2w(pts[2], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 2);
+
+  xTPLe_1x2x2x2w(pts[1], pts[2], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[2], pts[3], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[4], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 4);
+
+  get_3_isog_1x2x2x2w(pts[3], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 3);
+
+  get_3_isog_1x2x2x2w(pts[2], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 2);
+
+  get_3_isog_1x2x2x2w(pts[1], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 1);
+
+  xTPLe_1x2x2x2w(pts[0], pts[1], C24_A24plus, 18);
+  xTPLe_1x2x2x2w(pts[1], pts[2], C24_A24plus, 13);
+  xTPLe_1x2x2x2w(pts[2], pts[3], C24_A24plus, 9);
+  xTPLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 6);
+  xTPLe_1x2x2x2w(pts[4], pts[5], C24_A24plus, 4);
+  xTPLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 3);
+  xTPLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 2);
+  xTPLe_1x2x2x2w(pts[7], pts[8], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[8], pts[9], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[9], pts[10], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[10], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 10);
+
+  get_3_isog_1x2x2x2w(pts[9], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 9);
+
+  get_3_isog_1x2x2x2w(pts[8], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 8);
+
+  get_3_isog_1x2x2x2w(pts[7], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 7);
+
+  xTPLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[7], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 7);
+
+  get_3_isog_1x2x2x2w(pts[6], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 6);
+
+  xTPLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[7], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 7);
+
+  get_3_isog_1x2x2x2w(pts[6], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 6);
+
+  get_3_isog_1x2x2x2w(pts[5], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 5);
+
+  xTPLe_1x2x2x2w(pts[4], pts[5], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[7], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 7);
+
+  get_3_isog_1x2x2x2w(pts[6], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 6);
+
+  get_3_isog_1x2x2x2w(pts[5], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 5);
+
+  get_3_isog_1x2x2x2w(pts[4], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 4);
+
+  xTPLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 2);
+  xTPLe_1x2x2x2w(pts[4], pts[5], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[7], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 7);
+
+  get_3_isog_1x2x2x2w(pts[6], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 6);
+
+  get_3_isog_1x2x2x2w(pts[5], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 5);
+
+  get_3_isog_1x2x2x2w(pts[4], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 4);
+
+  xTPLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[4], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 4);
+
+  get_3_isog_1x2x2x2w(pts[3], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 3);
+
+  xTPLe_1x2x2x2w(pts[2], pts[3], C24_A24plus, 3);
+  xTPLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 2);
+  xTPLe_1x2x2x2w(pts[4], pts[5], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[7], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 7);
+
+  get_3_isog_1x2x2x2w(pts[6], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 6);
+
+  get_3_isog_1x2x2x2w(pts[5], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 5);
+
+  get_3_isog_1x2x2x2w(pts[4], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 4);
+
+  xTPLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[4], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 4);
+
+  get_3_isog_1x2x2x2w(pts[3], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 3);
+
+  xTPLe_1x2x2x2w(pts[2], pts[3], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[4], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 4);
+
+  get_3_isog_1x2x2x2w(pts[3], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 3);
+
+  get_3_isog_1x2x2x2w(pts[2], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 2);
+
+  xTPLe_1x2x2x2w(pts[1], pts[2], C24_A24plus, 4);
+  xTPLe_1x2x2x2w(pts[2], pts[3], C24_A24plus, 3);
+  xTPLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 2);
+  xTPLe_1x2x2x2w(pts[4], pts[5], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[7], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 7);
+
+  get_3_isog_1x2x2x2w(pts[6], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 6);
+
+  get_3_isog_1x2x2x2w(pts[5], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 5);
+
+  get_3_isog_1x2x2x2w(pts[4], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 4);
+
+  xTPLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[4], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 4);
+
+  get_3_isog_1x2x2x2w(pts[3], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 3);
+
+  xTPLe_1x2x2x2w(pts[2], pts[3], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[4], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 4);
+
+  get_3_isog_1x2x2x2w(pts[3], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 3);
+
+  get_3_isog_1x2x2x2w(pts[2], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 2);
+
+  xTPLe_1x2x2x2w(pts[1], pts[2], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[2], pts[3], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[4], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 4);
+
+  get_3_isog_1x2x2x2w(pts[3], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 3);
+
+  get_3_isog_1x2x2x2w(pts[2], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 2);
+
+  get_3_isog_1x2x2x2w(pts[1], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 1);
+
+  xTPLe_1x2x2x2w(pts[0], pts[1], C24_A24plus, 5);
+  xTPLe_1x2x2x2w(pts[1], pts[2], C24_A24plus, 4);
+  xTPLe_1x2x2x2w(pts[2], pts[3], C24_A24plus, 3);
+  xTPLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 2);
+  xTPLe_1x2x2x2w(pts[4], pts[5], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[5], pts[6], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[6], pts[7], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[7], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 7);
+
+  get_3_isog_1x2x2x2w(pts[6], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 6);
+
+  get_3_isog_1x2x2x2w(pts[5], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 5);
+
+  get_3_isog_1x2x2x2w(pts[4], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 4);
+
+  xTPLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[4], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 4);
+
+  get_3_isog_1x2x2x2w(pts[3], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 3);
+
+  xTPLe_1x2x2x2w(pts[2], pts[3], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[4], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 4);
+
+  get_3_isog_1x2x2x2w(pts[3], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 3);
+
+  get_3_isog_1x2x2x2w(pts[2], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 2);
+
+  xTPLe_1x2x2x2w(pts[1], pts[2], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[2], pts[3], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[4], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 4);
+
+  get_3_isog_1x2x2x2w(pts[3], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 3);
+
+  get_3_isog_1x2x2x2w(pts[2], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 2);
+
+  get_3_isog_1x2x2x2w(pts[1], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 1);
+
+  xTPLe_1x2x2x2w(pts[0], pts[1], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[1], pts[2], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[2], pts[3], C24_A24plus, 1);
+  xTPLe_1x2x2x2w(pts[3], pts[4], C24_A24plus, 1);
+  get_3_isog_1x2x2x2w(pts[4], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 4);
+
+  get_3_isog_1x2x2x2w(pts[3], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 3);
+
+  get_3_isog_1x2x2x2w(pts[2], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 2);
+
+  get_3_isog_1x2x2x2w(pts[1], C24_A24plus, coeff1_0);
+  eval_3_isog_parallel_ss(pts, coeff1_0, 1);
+
+  get_3_isog_1x2x2x2w(pts[0], C24_A24plus, coeff1_0);
+}
+
+#endif
@@ -0,0 +1,370 @@
+/**
+ *******************************************************************************
+ * @version 0.1
+ * @date 2021-12-16
+ * @copyright Copyright © 2021 by University of Luxembourg
+ * @author Hao Cheng
+ *******************************************************************************
+ */
+
+// Cost-calibrated optimal strategies for the isogeny tree traversal.
+// The tool measures the cost of a strategy step (1x2x2x2w xDBLe/xTPLe, 
+// 2x2x2x1w xDBLe for kgss) and of evaluating an isogeny at n stacked points 
+// on this machine. The evaluation is timed with the very call the traversal 
+// makes, eval_*_isog_parallel_kg/ss/kgss, which packs the points into the 
+// lanes and pays per batch rather than per point. The tool runs the dynamic 
+// program for optimal strategies on these costs and prints the strategy tables
+// of sidh.h together with the modeled cost of the current and the new tables. 
+// With the argument "compile", it instead compiles the strategy tables of 
+// sidh.h into the straight-line traversals of src/traversal.h, and with 
+// "tables" it prints the fixed-basis ladder tables of src/ladder_table.h.
+//
+//   $ make strategy
+//   $ ./strategy
+//   $ ./strategy compile > src/traversal.h
+//   $ ./strategy tables > src/ladder_table.h
+
+#include "sidh.h"
+#include <stdio.h>
+#include <string.h>
+#include <x86intrin.h>
+
+// read_tsc serializes with cpuid, which traps under virtualization and 
+// distorts the short kernels measured here; lfence + rdtsc is used instead
+static uint64_t strat_tsc()
+{
+  uint64_t t;
+
+  _mm_lfence();
+  t = __rdtsc();
+  _mm_lfence();
+
+  return t;
+}
+
+#define STRAT_PASSES    32        // #passes over all kernels, interleaved 
+#define STRAT_RUNS      50        // #runs per kernel and pass, the minimum is taken
+#define STRAT_ITER      10        // #calls per run
+#define MAX_DEPTH       (MAX_INT_POINTS_ALICE > MAX_INT_POINTS_BOB ? MAX_INT_POINTS_ALICE : MAX_INT_POINTS_BOB)
+#define MAX_LEAVES      (MAX_Alice > MAX_Bob ? MAX_Alice : MAX_Bob)
+#define COST_INF        ((uint64_t)-1 >> 1)
+
+// T is the minimum over all runs so far
+#define MEASURE_MIN(X, T)                                 \
+  for (r = 0; r < STRAT_RUNS; r++) {                      \
+    start_cycles = strat_tsc();                           \
+    for (i = 0; i < STRAT_ITER; i++) (X);                 \
+    end_cycles = strat_tsc();                             \
+    if ((end_cycles-start_cycles)/STRAT_ITER < (T))       \
+      T = (end_cycles-start_cycles)/STRAT_ITER;           \
+  }
+
+// costs of the isogeny tree traversal
+// step:    cost of one strategy step 
+// eval[n]: cost of the evaluation of an isogeny with n stacked points, as 
+//          called by the traversal (the kernel point of the next isogeny is 
+//          one of the points; kg and kgss also evaluate phiP, phiQ, phiR)
+typedef struct {
+  uint64_t step;
+  uint64_t eval[MAX_DEPTH+1];
+} strat_cost_t;
+
+static uint64_t C[MAX_LEAVES+1][MAX_DEPTH+2];
+static int K[MAX_LEAVES+1][MAX_DEPTH+2];
+
+// --------------------------------------------------------------------------
+// measurement 
+
+static void measure_costs(strat_cost_t *cAkg, strat_cost_t *cAss, strat_cost_t *cAA, strat_cost_t *cBkg, strat_cost_t *cBss)
+{
+  static vgelm_t pts[MAX_DEPTH];
+  static vfelm_t fpts[MAX_INT_POINTS_ALICE];
+  vgelm_t phiP, phiQ, phiR, C24_A24plus, coeff0, coeff1;
+  vfelm_t fphiP, fphiQ, fphiR, fC24_A24plus, fcoeff0, fcoeff1;
+  uint64_t start_cycles, end_cycles;
+  int i, n, p, r;
+
+  // any reduced limbs will do, the kernels are constant-time
+  for (i = 0; i < (int)(sizeof(pts)/8); i++) ((uint64_t *)pts)[i] = (i*0x9E3779B97F4A7C15ULL) & VBMASK;
+  for (i = 0; i < (int)(sizeof(fpts)/8); i++) ((uint64_t *)fpts)[i] = (i*0x9E3779B97F4A7C15ULL) & VBMASK;
+  for (i = 0; i < VGWORDS; i++) 
+    phiP[i] = phiQ[i] = phiR[i] = C24_A24plus[i] = coeff0[i] = coeff1[i] = VSET1(i+1);
+  for (i = 0; i < VNWORDS; i++) 
+    fphiP[i] = fphiQ[i] = fphiR[i] = fC24_A24plus[i] = fcoeff0[i] = fcoeff1[i] = VSET1(i+1);
+
+  cAkg->step = cAA->step = cBkg->step = COST_INF;
+  for (n = 0; n <= MAX_DEPTH; n++) 
+    cAkg->eval[n] = cAss->eval[n] = cAA->eval[n] = cBkg->eval[n] = cBss->eval[n] = COST_INF;
+
+  for (p = 0; p < STRAT_PASSES; p++) {
+    MEASURE_MIN(xDBLe_1x2x2x2w(pts[0], pts[1], C24_A24plus, 2), cAkg->step);
+    MEASURE_MIN(xDBLe_2x2x2x1w(fpts[0], fpts[1], fC24_A24plus, 2), cAA->step);
+    MEASURE_MIN(xTPLe_1x2x2x2w(pts[0], pts[1], C24_A24plus, 1), cBkg->step);
+    for (n = 0; n <= MAX_INT_POINTS_ALICE; n++) {
+      MEASURE_MIN(eval_4_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff0, coeff1, n+3), cAkg->eval[n]);
+      MEASURE_MIN(eval_4_isog_parallel_kgss(fpts, fphiP, fphiQ, fphiR, fcoeff0, fcoeff1, 2*n+3), cAA->eval[n]);
+      if (n > 0) MEASURE_MIN(eval_4_isog_parallel_ss(pts, coeff0, coeff1, n), cAss->eval[n]);
+    }
+    for (n = 0; n <= MAX_INT_POINTS_BOB; n++) {
+      MEASURE_MIN(eval_3_isog_parallel_kg(pts, phiP, phiQ, phiR, coeff0, n+3), cBkg->eval[n]);
+      if (n > 0) MEASURE_MIN(eval_3_isog_parallel_ss(pts, coeff0, n), cBss->eval[n]);
+    }
+  }
+  cAss->step = cAkg->step;
+  cBss->step = cBkg->step;
+  // the secret agreement skips the last evaluation
+  cAss->eval[0] = cBss->eval[0] = 0;
+
+  // a larger batch never costs less, suppress the measurement noise
+  for (n = 1; n <= MAX_DEPTH; n++) {
+    if (cAkg->eval[n] < cAkg->eval[n-1]) cAkg->eval[n] = cAkg->eval[n-1];
+    if (cAss->eval[n] < cAss->eval[n-1]) cAss->eval[n] = cAss->eval[n-1];
+    if (cAA->eval[n] < cAA->eval[n-1]) cAA->eval[n] = cAA->eval[n-1];
+    if (cBkg->eval[n] < cBkg->eval[n-1]) cBkg->eval[n] = cBkg->eval[n-1];
+    if (cBss->eval[n] < cBss->eval[n-1]) cBss->eval[n] = cBss->eval[n-1];
+  }
+}
+
+// --------------------------------------------------------------------------
+// strategies 
+
+// modeled cost of a strategy, following the tree traversal in sidh.c
+static uint64_t strategy_cost(const unsigned int *strat, const int MAX, const strat_cost_t *c, int *maxpts)
+{
+  int row, m, index = 0, pts_index[MAX_LEAVES], npts = 0, ii = 0;
+  uint64_t cost = 0;
+
+  *maxpts = 0;
+  for (row = 1; row < MAX; row++) {
+    while (index < MAX-row) {
+      pts_index[npts++] = index;
+      if (npts > *maxpts) *maxpts = npts;
+      m = strat[ii++];
+      cost += m*c->step;
+      index += m;
+    }
+    cost += c->eval[npts];
+    index = pts_index[npts-1];
+    npts -= 1;
+  }
+
+  return cost + c->eval[0];   // the last isogeny
+}
+
+static void emit_strategy(unsigned int *strat, int *ii, const int n, const int d)
+{
+  int k;
+
+  if (n == 1) return;
+  k = K[n][d];
+  strat[(*ii)++] = k;
+  emit_strategy(strat, ii, n-k, d+1);   // the points pushed on the way down
+  emit_strategy(strat, ii, k, d);       
+}
+
+// optimal strategy for a tree with MAX leaves and at most dmax stacked points
+// C(1, d) = eval[d]
+// C(n, d) = min_{0<k<n} k*step + C(n-k, d+1) + C(k, d)
+static uint64_t optimal_strategy(unsigned int *strat, const int MAX, const strat_cost_t *c, const int dmax)
+{
+  int n, d, k, ii = 0;
+  uint64_t t;
+
+  for (d = 0; d <= dmax+1; d++) C[1][d] = (d <= dmax) ? c->eval[d] : COST_INF;
+  for (n = 2; n <= MAX; n++) {
+    for (d = 0; d <= dmax+1; d++) {
+      C[n][d] = COST_INF; K[n][d] = 0;
+      if (d == dmax+1) continue;
+      for (k = 1; k < n; k++) {
+        if (C[n-k][d+1] == COST_INF || C[k][d] == COST_INF) continue;
+        t = k*c->step + C[n-k][d+1] + C[k][d];
+        if (t < C[n][d]) { C[n][d] = t; K[n][d] = k; }
+      }
+    }
+  }
+  emit_strategy(strat, &ii, MAX, 0);
+
+  return C[MAX][0];
+}
+
+static void print_strategy(const char *name, const char *size, const unsigned int *strat, const int len)
+{
+  int i;
+
+  printf("static const unsigned int %s[%s] = { \n", name, size);
+  for (i = 0; i < len; i++) 
+    printf("%s%u%s", (i%16 == 0) ? "  " : "", strat[i], (i == len-1) ? " };\n" : ((i%16 == 15) ? ",\n" : ", "));
+}
+
+static void generate(const char *name, const char *size, const unsigned int *cur, const int MAX, const strat_cost_t *c, const int dmax)
+{
+  unsigned int strat[MAX_LEAVES];
+  uint64_t cost_cur, cost_opt;
+  int maxpts_cur, maxpts_opt;
+
+  cost_cur = strategy_cost(cur, MAX, c, &maxpts_cur);
+  cost_opt = optimal_strategy(strat, MAX, c, dmax);
+  strategy_cost(strat, MAX, c, &maxpts_opt);
+  printf("// %s: modeled cost %llu -> %llu cycles (%.2f%%), max #points %d -> %d\n", name,
+         (unsigned long long)cost_cur, (unsigned long long)cost_opt, 
+         100.0*((double)cost_opt-(double)cost_cur)/(double)cost_cur, maxpts_cur, maxpts_opt);
+  print_strategy(name, size, strat, MAX-1);
+  printf("\n");
+}
+
+// --------------------------------------------------------------------------
+// strategy compiler 
+// The traversal is unrolled into straight-line code with static point slots: 
+// the point that is multiplied lives in pts[npts] right above the npts stacked
+// points, so a strategy step writes the next slot (out-of-place xDBLe/xTPLe) 
+// and the pop after an isogeny is free. No point is copied.
+
+#define TRAVERSE_KG     0         // 1x2x2x2w, also evaluates phiP, phiQ, phiR
+#define TRAVERSE_SS     1         // 1x2x2x2w
+#define TRAVERSE_KGSS   2         // 2x2x2x1w, kg and ss instances in one vector
+
+static void compile_strategy(const char *name, const unsigned int *strat, const int MAX, const int iso, const int kind)
+{
+  const char *form = (kind == TRAVERSE_KGSS) ? "2x2x2x1w" : "1x2x2x2w";
+  const char *elm = (kind == TRAVERSE_KGSS) ? "vfelm_t" : "vgelm_t";
+  const char *coeff = (iso == 4) ? "coeff__0, coeff2_1" : "coeff1_0";
+  int row, m, index = 0, pts_index[MAX_LEAVES], npts = 0, ii = 0;
+
+  printf("static void traverse_%s(%s *pts, %s C24_A24plus", name, elm, elm);
+  if (kind != TRAVERSE_SS) printf(", %s phiP, %s phiQ, %s phiR", elm, elm, elm);
+  printf(")\n{\n");
+  if (kind == TRAVERSE_KGSS) 
+    printf("  vfelm_t coeff__0, coeff2_1;\n");
+  else
+    printf("  vgelm_t %s;\n", coeff);
+
+  for (row = 1; row < MAX; row++) {
+    printf("\n");
+    while (index < MAX-row) {
+      pts_index[npts++] = index;
+      m = strat[ii++];
+      if (iso == 4) printf("  xDBLe_%s(pts[%d], pts[%d], C24_A24plus, %d);\n", form, npts-1, npts, 2*m);
+      else printf("  xTPLe_%s(pts[%d], pts[%d], C24_A24plus, %d);\n", form, npts-1, npts, m);
+      index += m;
+    }
+    printf("  get_%d_isog_%s(pts[%d], C24_A24plus, %s);\n", iso, form, npts, coeff);
+    if (kind == TRAVERSE_KG) 
+      printf("  eval_%d_isog_parallel_kg(pts, phiP, phiQ, phiR, %s, %d);\n", iso, coeff, npts+3);
+    else if (kind == TRAVERSE_KGSS)
+      printf("  eval_%d_isog_parallel_kgss(pts, phiP, phiQ, phiR, %s, %d);\n", iso, coeff, 2*npts+3);
+    else 
+      printf("  eval_%d_isog_parallel_ss(pts, %s, %d);\n", iso, coeff, npts);
+    index = pts_index[npts-1];
+    npts -= 1;
+  }
+
+  printf("\n  get_%d_isog_%s(pts[0], C24_A24plus, %s);\n", iso, form, coeff);
+  if (kind == TRAVERSE_KG) 
+    printf("  eval_%d_isog_parallel_kg(pts, phiP, phiQ, phiR, %s, 3);\n", iso, coeff);
+  else if (kind == TRAVERSE_KGSS)
+    printf("  eval_%d_isog_parallel_kgss(pts, phiP, phiQ, phiR, %s, 3);\n", iso, coeff);
+  printf("}\n\n");
+}
+
+static void compile_all()
+{
+  printf("// Straight-line isogeny tree traversals compiled from the strategy tables of\n");
+  printf("// sidh.h by tools/strategy.c (./strategy compile > src/traversal.h), do not edit.\n");
+  printf("// On input pts[0] holds the kernel point, the point that is multiplied lives\n");
+  printf("// in pts[npts] right above the npts stacked points.\n\n");
+  printf("#ifndef _TRAVERSAL_H\n#define _TRAVERSAL_H\n\n#include \"sidh.h\"\n\n");
+  compile_strategy("Alice_kg", strat_Alice_kg, MAX_Alice, 4, TRAVERSE_KG);
+  compile_strategy("Alice_ss", strat_Alice_ss, MAX_Alice, 4, TRAVERSE_SS);
+  compile_strategy("Alice_kgss", strat_Alice_kgss, MAX_Alice, 4, TRAVERSE_KGSS);
+  compile_strategy("Bob_kg", strat_Bob_kg, MAX_Bob, 3, TRAVERSE_KG);
+  compile_strategy("Bob_ss", strat_Bob_ss, MAX_Bob, 3, TRAVERSE_SS);
+  printf("#endif\n");
+}
+
+// --------------------------------------------------------------------------
+// fixed-basis ladder tables 
+
+// < XR0-ZR0 | XR0+ZR0 > for R0 = [2^i]Q, 0 <= i < nbits, where Q is the basis 
+// point of gen on E0 (A = 6, C = 1)
+static void print_table(const char *name, const char *size, const uint64_t *gen, const int nbits)
+{
+  static vgelm_t tab[OALICE_BITS > OBOB_BITS ? OALICE_BITS : OBOB_BITS];
+  point_proj_r51_t C = { 0 };
+  f2elm_r51_t xQ;
+  vgelm_t C24_A24plus;
+  int i, j, k;
+
+  for (j = 0; j < VNWORDS; j++) {
+    xQ[0][j] = gen[j+2*VNWORDS];
+    xQ[1][j] = gen[j+3*VNWORDS];
+  }
+  fpcopy_1w(C->Z[0], vmont_R);          // A24plus = 1
+  mp2_add_1w(C->Z, C->Z, C->Z);         // A24plus = 2
+  mp2_add_1w(C->X, C->Z, C->Z);         // C24 = 4
+  mp2_add_1w(C->Z, C->X, C->X);         // A24plus = 8
+  pack_point_1x2x2x2w(C24_A24plus, C);
+  ladder_table_1x2x2x2w(tab, xQ, C24_A24plus, nbits);
+
+  printf("static const vgelm_t %s[%s] = {\n", name, size);
+  for (i = 0; i < nbits; i++) {
+    for (j = 0; j < VGWORDS; j++) {
+      printf(j == 0 ? "  { {" : "    {");
+      for (k = 0; k < 8; k++)
+        printf(" 0x%013llX%s", (unsigned long long)((uint64_t *)&tab[i][j])[k], k < 7 ? "," : " ");
+      printf(j < VGWORDS-1 ? "},\n" : "} }%s\n", i < nbits-1 ? "," : "");
+    }
+  }
+  printf("};\n\n");
+}
+
+static void tables_all()
+{
+  printf("// Fixed-basis ladder tables of LADDER3PT_fixed_1x2x2x2w computed by\n");
+  printf("// tools/strategy.c (./strategy tables > src/ladder_table.h), do not edit.\n");
+  printf("// ladder_table_X[i] = < XR0-ZR0 | XR0+ZR0 > for R0 = [2^i]Q, where Q is the\n");
+  printf("// basis point of vX_gen on E0.\n\n");
+  printf("#ifndef _LADDER_TABLE_H\n#define _LADDER_TABLE_H\n\n#include \"curve.h\"\n\n");
+  print_table("ladder_table_A", "OALICE_BITS", vA_gen, OALICE_BITS);
+  print_table("ladder_table_B", "OBOB_BITS-1", vB_gen, OBOB_BITS-1);
+  printf("#endif\n");
+}
+
+int main(int argc, char *argv[])
+{
+  strat_cost_t cAkg, cAss, cAA, cBkg, cBss;
+  int n;
+
+  if (argc > 1 && strcmp(argv[1], "compile") == 0) {
+    compile_all();
+    return 0;
+  }
+  if (argc > 1 && strcmp(argv[1], "tables") == 0) {
+    tables_all();
+    return 0;
+  }
+
+  measure_costs(&cAkg, &cAss, &cAA, &cBkg, &cBss);
+
+  printf("// measured costs in cycles\n");
+  printf("// 1x2x2x2w xDBLe(2): %llu, 2x2x2x1w xDBLe(2): %llu, 1x2x2x2w xTPLe(1): %llu\n", 
+         (unsigned long long)cAkg.step, (unsigned long long)cAA.step, (unsigned long long)cBkg.step);
+  printf("// eval_4_isog_parallel_kg(n+3):  ");
+  for (n = 0; n <= MAX_INT_POINTS_ALICE; n++) printf(" %llu", (unsigned long long)cAkg.eval[n]);
+  printf("\n// eval_4_isog_parallel_ss(n):    ");
+  for (n = 0; n <= MAX_INT_POINTS_ALICE; n++) printf(" %llu", (unsigned long long)cAss.eval[n]);
+  printf("\n// eval_4_isog_parallel_kgss(2n+3):");
+  for (n = 0; n <= MAX_INT_POINTS_ALICE; n++) printf(" %llu", (unsigned long long)cAA.eval[n]);
+  printf("\n// eval_3_isog_parallel_kg(n+3):  ");
+  for (n = 0; n <= MAX_INT_POINTS_BOB; n++) printf(" %llu", (unsigned long long)cBkg.eval[n]);
+  printf("\n// eval_3_isog_parallel_ss(n):    ");
+  for (n = 0; n <= MAX_INT_POINTS_BOB; n++) printf(" %llu", (unsigned long long)cBss.eval[n]);
+  printf("\n\n");
+
+  generate("strat_Alice_kg", "MAX_Alice-1", strat_Alice_kg, MAX_Alice, &cAkg, MAX_INT_POINTS_ALICE);
+  generate("strat_Alice_ss", "MAX_Alice-1", strat_Alice_ss, MAX_Alice, &cAss, MAX_INT_POINTS_ALICE);
+  generate("strat_Alice_kgss", "MAX_Alice-1", strat_Alice_kgss, MAX_Alice, &cAA, MAX_INT_POINTS_ALICE);
+  generate("strat_Bob_kg", "MAX_Bob-1", strat_Bob_kg, MAX_Bob, &cBkg, MAX_INT_POINTS_BOB);
+  generate("strat_Bob_ss", "MAX_Bob-1", strat_Bob_ss, MAX_Bob, &cBss, MAX_INT_POINTS_BOB);
+
+  return 0;
+}
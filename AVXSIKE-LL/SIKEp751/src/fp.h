@@ -55,6 +55,14 @@ static const uint64_t vmont_R2[VNWORDS] = {
   0x4CBAC01F5A7FE, 0x299B961575678, 0x7C1E37997D67B, 0x32A3645EDD616,
   0x2ADB4B9F5ED39, 0x24EB2C434A0E2, 0x0000ABF39813E, }; 
 
+// (2^768)^2 * 2^-765 mod p751, converts an inverse computed in the radix-2^51
+// Montgomery domain back to the radix-2^64 one (see fpinv_mont)
+static const uint64_t vmont_R64x2[VNWORDS] = {
+  0x0000000124D6B, 0x0000000000000, 0x0000000000000, 0x0000000000000,
+  0x0000000000000, 0x0000000000000, 0x0000000000000, 0x7CFC9CA638000,
+  0x11DFD77CB91DC, 0x77F7D9577D238, 0x7D177787AE03A, 0x0BD12226F1600,
+  0x65AA16D4FD82C, 0x378BB09C309C2, 0x00006C9E98852, };
+
 // -----------------------------------------------------------------------------
 // (8x1)-way fp arithmetic 
 
@@ -75,6 +83,11 @@ void fpsub_4x2w(__m512i *r, const __m512i *a, const __m512i* b);
 void mp_mul_4x2w(__m512i *r, const __m512i *a, const __m512i *b);
 void rdc_mont_4x2w(__m512i *r, const __m512i *a);
 
+// -----------------------------------------------------------------------------
+// (1x8)-way fp arithmetic 
+
+void fpmul_mont_1x8w(__m512i *r, const __m512i *a, const __m512i *b);
+
 // -----------------------------------------------------------------------------
 // 1-way x64 fp arithmetic 
 
@@ -8,6 +8,7 @@
  */
 
 #include "fpx.h"
+#include "utils.h"
 #include <string.h>
 
 int8_t ct_compare(const uint8_t *a, const uint8_t *b, unsigned int len) 
@@ -18,7 +19,7 @@ int8_t ct_compare(const uint8_t *a, const uint8_t *b, unsigned int len)
     for (unsigned int i = 0; i < len; i++)
         r |= a[i] ^ b[i];
 
-    return (-(int8_t)r) >> (8*sizeof(uint8_t)-1);
+    return (int8_t)((-(int32_t)r) >> (8*sizeof(int32_t)-1));
 }
 
 void ct_cmov(uint8_t *r, const uint8_t *a, unsigned int len, int8_t selector) 
@@ -924,6 +925,70 @@ void mp2_add_1w(f2elm_r51_t r, const f2elm_r51_t a, const f2elm_r51_t b)
   mp_add_1w(r[1], a[1], b[1]);
 }
 
+// -----------------------------------------------------------------------------
+// 1-way radix conversion between radix-2^51 and radix-2^64. 
+// Both elements fit in two zmm words; every output word is assembled from the 
+// (at most three) input words it overlaps, picked by a 2-source permute and 
+// aligned by variable shifts, so one call is a handful of vector instructions.
+
+// r = a in radix-2^64 (a in radix-2^51)
+void fpconv_51to64_1w(felm_t r, const felm_r51_t a)
+{
+  // word i of r holds bits [64i, 64i+64), i.e. a[q] >> s | a[q+1] << (51-s) | 
+  // a[q+2] << (102-s) with q = 64i/51 and s = 64i%51 (shifts by >= 64 give 0)
+  const __m512i q[2] = { VSET( 8,  7,  6,  5,  3,  2,  1,  0), VSET(18, 17, 16, 15, 13, 12, 11, 10) };
+  const __m512i s[2] = { VSET(40, 27, 14,  1, 39, 26, 13,  0), VSET(42, 29, 16,  3, 41, 28, 15,  2) };
+  const __m512i one = VSET1(1), radix = VSET1(VBRADIX);
+  __m512i a0, a1, t, u;
+  int i;
+
+  // limbs beyond VNWORDS are loaded as 0
+  a0 = VZLOAD(0xFF, &a[0]); 
+  a1 = VZLOAD((1 << (VNWORDS-8)) - 1, &a[8]);
+
+  for (i = 0; i*8 < NWORDS_FIELD; i++) {
+    t = VSHRV(VPERMV2(a0, q[i], a1), s[i]);
+    u = VSUB(radix, s[i]);
+    t = VOR(t, VSHLV(VPERMV2(a0, VADD(q[i], one), a1), u));
+    u = VADD(u, radix);
+    t = VOR(t, VSHLV(VPERMV2(a0, VADD(q[i], VADD(one, one)), a1), u));
+    VMSTORE(&r[8*i], (NWORDS_FIELD-8*i >= 8) ? 0xFF : (1 << (NWORDS_FIELD-8*i)) - 1, t);
+  }
+}
+
+// r = a in radix-2^51 (a in radix-2^64)
+void fpconv_64to51_1w(felm_r51_t r, const felm_t a)
+{
+  // limb i of r holds bits [51i, 51i+51), i.e. the low 51 bits of a[j+1]:a[j] >> s
+  // with j = 51i/64 and s = 51i%64
+  const __m512i j[2] = { VSET( 5,  4,  3,  3,  2,  1,  0,  0), VSET(11, 11, 10,  9,  8,  7,  7,  6) };
+  const __m512i s[2] = { VSET(37, 50, 63, 12, 25, 38, 51,  0), VSET(61, 10, 23, 36, 49, 62, 11, 24) };
+  const __m512i one = VSET1(1), mask = VSET1(VBMASK);
+  __m512i a0, a1, t;
+  int i;
+
+  // words beyond NWORDS_FIELD are loaded as 0
+  a0 = VZLOAD((NWORDS_FIELD >= 8) ? 0xFF : (1 << NWORDS_FIELD) - 1, &a[0]); 
+  a1 = VZLOAD((NWORDS_FIELD > 8) ? (1 << (NWORDS_FIELD-8)) - 1 : 0, &a[8]);
+
+  for (i = 0; i*8 < VNWORDS; i++) {
+    t = VSHRDV(VPERMV2(a0, j[i], a1), VPERMV2(a0, VADD(j[i], one), a1), s[i]);
+    VMSTORE(&r[8*i], (VNWORDS-8*i >= 8) ? 0xFF : (1 << (VNWORDS-8*i)) - 1, VAND(t, mask));
+  }
+}
+
+void fp2conv_51to64_1w(f2elm_t r, const f2elm_r51_t a)
+{
+  fpconv_51to64_1w(r[0], a[0]);
+  fpconv_51to64_1w(r[1], a[1]);
+}
+
+void fp2conv_64to51_1w(f2elm_r51_t r, const f2elm_t a)
+{
+  fpconv_64to51_1w(r[0], a[0]);
+  fpconv_64to51_1w(r[1], a[1]);
+}
+
 // -----------------------------------------------------------------------------
 // 1-way x64 implementation from PQCrypto-SIDH-3.4
 
@@ -1146,15 +1211,172 @@ void fpinv_chain_mont(felm_t a)
     fpcopy(tt, a);  
 }
 
+static void fpinv_chain_mont_1x8w(__m512i *a)
+{ // Chain to compute a^(p-3)/4 using (1x8)-way Montgomery arithmetic (radix-2^51).
+    unsigned int i, j;
+    
+    __m512i t[27][2], tt[2];
+    
+    // Precomputed table
+    fpmul_mont_1x8w(tt, a, a);
+    fpmul_mont_1x8w(t[0], a, tt);
+    fpmul_mont_1x8w(t[1], t[0], tt);
+    fpmul_mont_1x8w(t[2], t[1], tt);
+    fpmul_mont_1x8w(t[3], t[2], tt); 
+    fpmul_mont_1x8w(t[3], t[3], tt);
+    for (i = 3; i <= 8; i++) fpmul_mont_1x8w(t[i+1], t[i], tt);
+    fpmul_mont_1x8w(t[9], t[9], tt);
+    for (i = 9; i <= 20; i++) fpmul_mont_1x8w(t[i+1], t[i], tt);
+    fpmul_mont_1x8w(t[21], t[21], tt); 
+    for (i = 21; i <= 24; i++) fpmul_mont_1x8w(t[i+1], t[i], tt); 
+    fpmul_mont_1x8w(t[25], t[25], tt);
+    fpmul_mont_1x8w(t[26], t[25], tt);
+
+    tt[0] = a[0]; tt[1] = a[1];
+    for (i = 0; i < 6; i++) fpmul_mont_1x8w(tt, tt, tt);
+    fpmul_mont_1x8w(tt, t[20], tt);
+    for (i = 0; i < 6; i++) fpmul_mont_1x8w(tt, tt, tt);
+    fpmul_mont_1x8w(tt, t[24], tt);
+    for (i = 0; i < 6; i++) fpmul_mont_1x8w(tt, tt, tt);
+    fpmul_mont_1x8w(tt, t[11], tt);
+    for (i = 0; i < 6; i++) fpmul_mont_1x8w(tt, tt, tt);
+    fpmul_mont_1x8w(tt, t[8], tt);
+    for (i = 0; i < 8; i++) fpmul_mont_1x8w(tt, tt, tt);
+    fpmul_mont_1x8w(tt, t[2], tt);
+    for (i = 0; i < 6; i++) fpmul_mont_1x8w(tt, tt, tt);
+    fpmul_mont_1x8w(tt, t[23], tt);
+    for (i = 0; i < 6; i++) fpmul_mont_1x8w(tt, tt, tt);
+    fpmul_mont_1x8w(tt, t[2], tt);
+    for (i = 0; i < 9; i++) fpmul_mont_1x8w(tt, tt, tt);
+    fpmul_mont_1x8w(tt, t[2], tt);
+    for (i = 0; i < 10; i++) fpmul_mont_1x8w(tt, tt, tt);
+    fpmul_mont_1x8w(tt, t[15], tt);
+    for (i = 0; i < 8; i++) fpmul_mont_1x8w(tt, tt, tt);
+    fpmul_mont_1x8w(tt, t[13], tt);
+    for (i = 0; i < 8; i++) fpmul_mont_1x8w(tt, tt, tt);
+    fpmul_mont_1x8w(tt, t[26], tt);
+    for (i = 0; i < 8; i++) fpmul_mont_1x8w(tt, tt, tt);
+    fpmul_mont_1x8w(tt, t[20], tt);
+    for (i = 0; i < 6; i++) fpmul_mont_1x8w(tt, tt, tt);
+    fpmul_mont_1x8w(tt, t[11], tt);
+    for (i = 0; i < 6; i++) fpmul_mont_1x8w(tt, tt, tt);
+    fpmul_mont_1x8w(tt, t[10], tt);
+    for (i = 0; i < 6; i++) fpmul_mont_1x8w(tt, tt, tt);
+    fpmul_mont_1x8w(tt, t[14], tt);
+    for (i = 0; i < 6; i++) fpmul_mont_1x8w(tt, tt, tt);
+    fpmul_mont_1x8w(tt, t[4], tt);
+    for (i = 0; i < 10; i++) fpmul_mont_1x8w(tt, tt, tt);
+    fpmul_mont_1x8w(tt, t[18], tt);
+    for (i = 0; i < 6; i++) fpmul_mont_1x8w(tt, tt, tt);
+    fpmul_mont_1x8w(tt, t[1], tt);
+    for (i = 0; i < 7; i++) fpmul_mont_1x8w(tt, tt, tt);
+    fpmul_mont_1x8w(tt, t[22], tt);
+    for (i = 0; i < 10; i++) fpmul_mont_1x8w(tt, tt, tt);
+    fpmul_mont_1x8w(tt, t[6], tt);
+    for (i = 0; i < 7; i++) fpmul_mont_1x8w(tt, tt, tt);
+    fpmul_mont_1x8w(tt, t[24], tt);
+    for (i = 0; i < 6; i++) fpmul_mont_1x8w(tt, tt, tt);
+    fpmul_mont_1x8w(tt, t[9], tt);
+    for (i = 0; i < 8; i++) fpmul_mont_1x8w(tt, tt, tt);
+    fpmul_mont_1x8w(tt, t[18], tt);
+    for (i = 0; i < 6; i++) fpmul_mont_1x8w(tt, tt, tt);
+    fpmul_mont_1x8w(tt, t[17], tt);
+    for (i = 0; i < 8; i++) fpmul_mont_1x8w(tt, tt, tt);
+    fpmul_mont_1x8w(tt, a, tt);
+    for (i = 0; i < 10; i++) fpmul_mont_1x8w(tt, tt, tt);
+    fpmul_mont_1x8w(tt, t[16], tt);
+    for (i = 0; i < 6; i++) fpmul_mont_1x8w(tt, tt, tt);
+    fpmul_mont_1x8w(tt, t[7], tt);
+    for (i = 0; i < 6; i++) fpmul_mont_1x8w(tt, tt, tt);
+    fpmul_mont_1x8w(tt, t[0], tt);
+    for (i = 0; i < 7; i++) fpmul_mont_1x8w(tt, tt, tt);
+    fpmul_mont_1x8w(tt, t[12], tt);
+    for (i = 0; i < 7; i++) fpmul_mont_1x8w(tt, tt, tt);
+    fpmul_mont_1x8w(tt, t[19], tt);
+    for (i = 0; i < 6; i++) fpmul_mont_1x8w(tt, tt, tt);
+    fpmul_mont_1x8w(tt, t[22], tt);
+    for (i = 0; i < 6; i++) fpmul_mont_1x8w(tt, tt, tt);
+    fpmul_mont_1x8w(tt, t[25], tt);
+    for (i = 0; i < 7; i++) fpmul_mont_1x8w(tt, tt, tt);
+    fpmul_mont_1x8w(tt, t[2], tt);
+    for (i = 0; i < 6; i++) fpmul_mont_1x8w(tt, tt, tt);
+    fpmul_mont_1x8w(tt, t[10], tt);
+    for (i = 0; i < 7; i++) fpmul_mont_1x8w(tt, tt, tt);
+    fpmul_mont_1x8w(tt, t[22], tt);
+    for (i = 0; i < 8; i++) fpmul_mont_1x8w(tt, tt, tt);
+    fpmul_mont_1x8w(tt, t[18], tt);
+    for (i = 0; i < 6; i++) fpmul_mont_1x8w(tt, tt, tt);
+    fpmul_mont_1x8w(tt, t[4], tt);
+    for (i = 0; i < 6; i++) fpmul_mont_1x8w(tt, tt, tt);
+    fpmul_mont_1x8w(tt, t[14], tt);
+    for (i = 0; i < 7; i++) fpmul_mont_1x8w(tt, tt, tt);
+    fpmul_mont_1x8w(tt, t[13], tt);
+    for (i = 0; i < 6; i++) fpmul_mont_1x8w(tt, tt, tt);
+    fpmul_mont_1x8w(tt, t[5], tt);
+    for (i = 0; i < 6; i++) fpmul_mont_1x8w(tt, tt, tt);
+    fpmul_mont_1x8w(tt, t[23], tt);
+    for (i = 0; i < 6; i++) fpmul_mont_1x8w(tt, tt, tt);
+    fpmul_mont_1x8w(tt, t[21], tt);
+    for (i = 0; i < 6; i++) fpmul_mont_1x8w(tt, tt, tt);
+    fpmul_mont_1x8w(tt, t[2], tt);
+    for (i = 0; i < 7; i++) fpmul_mont_1x8w(tt, tt, tt);
+    fpmul_mont_1x8w(tt, t[23], tt);
+    for (i = 0; i < 8; i++) fpmul_mont_1x8w(tt, tt, tt);
+    fpmul_mont_1x8w(tt, t[12], tt);
+    for (i = 0; i < 6; i++) fpmul_mont_1x8w(tt, tt, tt);
+    fpmul_mont_1x8w(tt, t[9], tt);
+    for (i = 0; i < 6; i++) fpmul_mont_1x8w(tt, tt, tt);
+    fpmul_mont_1x8w(tt, t[3], tt);
+    for (i = 0; i < 7; i++) fpmul_mont_1x8w(tt, tt, tt);
+    fpmul_mont_1x8w(tt, t[13], tt);
+    for (i = 0; i < 7; i++) fpmul_mont_1x8w(tt, tt, tt);
+    fpmul_mont_1x8w(tt, t[17], tt);
+    for (i = 0; i < 8; i++) fpmul_mont_1x8w(tt, tt, tt);
+    fpmul_mont_1x8w(tt, t[26], tt);
+    for (i = 0; i < 8; i++) fpmul_mont_1x8w(tt, tt, tt);
+    fpmul_mont_1x8w(tt, t[5], tt);
+    for (i = 0; i < 8; i++) fpmul_mont_1x8w(tt, tt, tt);
+    fpmul_mont_1x8w(tt, t[8], tt);
+    for (i = 0; i < 6; i++) fpmul_mont_1x8w(tt, tt, tt);
+    fpmul_mont_1x8w(tt, t[2], tt);
+    for (i = 0; i < 6; i++) fpmul_mont_1x8w(tt, tt, tt);
+    fpmul_mont_1x8w(tt, t[11], tt);
+    for (i = 0; i < 7; i++) fpmul_mont_1x8w(tt, tt, tt);
+    fpmul_mont_1x8w(tt, t[20], tt);
+    for (j = 0; j < 61; j++) {
+        for (i = 0; i < 6; i++) fpmul_mont_1x8w(tt, tt, tt);
+        fpmul_mont_1x8w(tt, t[26], tt);
+    }
+    a[0] = tt[0]; a[1] = tt[1];  
+}
+
 void fpinv_mont(felm_t a)
 { // Field inversion using Montgomery arithmetic, a = a^(-1)*R mod p.
-    felm_t tt;
-
-    fpcopy(a, tt);
-    fpinv_chain_mont(tt);
-    fpsqr_mont(tt, tt);
-    fpsqr_mont(tt, tt);
-    fpmul_mont(a, tt, a);
+  // The exponentiation is done by the (1x8)-way kernel, which has lower latency than 
+  // the x64 one for this prime. a*R = (a*R/R') * R' is taken as an element of the 
+  // radix-2^51 Montgomery domain (R' = 2^765), its inverse a^(-1)*R'^2/R is then 
+  // converted back by multiplying with R^2/R' (R = 2^768).
+    uint64_t t51[2*8] = { 0 };
+    __m512i ta[2], tt[2], tk[2];
+    int i;
+
+    fpconv_64to51_1w(t51, a);
+    ta[0] = _mm512_loadu_si512(t51); ta[1] = _mm512_maskz_loadu_epi64(0x7F, &t51[8]);
+    tk[0] = _mm512_loadu_si512(vmont_R64x2); tk[1] = _mm512_maskz_loadu_epi64(0x7F, &vmont_R64x2[8]);
+
+    tt[0] = ta[0]; tt[1] = ta[1];
+    fpinv_chain_mont_1x8w(tt);
+    fpmul_mont_1x8w(tt, tt, tt);
+    fpmul_mont_1x8w(tt, tt, tt);
+    fpmul_mont_1x8w(tt, ta, tt);
+    fpmul_mont_1x8w(tt, tt, tk);
+
+    _mm512_storeu_si512(t51, tt[0]); _mm512_mask_storeu_epi64(&t51[8], 0x7F, tt[1]);
+    for (i = 0; i < VNWORDS-1; i++) {
+      t51[i+1] += t51[i] >> VBRADIX;
+      t51[i] &= VBMASK;
+    }
+    fpconv_51to64_1w(a, t51);
 }
 
 void fp2inv_mont(f2elm_t a)
@@ -33,8 +33,20 @@
 #define VMXOR(X, Y, Z, W)     _mm512_mask_xor_epi64(X, Y, Z, W)
 #define VSHR(X, Y)            _mm512_srli_epi64(X, Y)
 #define VSHL(X, Y)            _mm512_slli_epi64(X, Y)
+#define VSHRV(X, Y)           _mm512_srlv_epi64(X, Y)
+#define VSHLV(X, Y)           _mm512_sllv_epi64(X, Y)
 #define VSRA(X, Y)            _mm512_srai_epi64(X, Y)
 #define VZSRA(X, Y, Z)        _mm512_maskz_srai_epi64(X, Y, Z)
+#define VROL(X, Y)            _mm512_rol_epi64(X, Y)
+#define VROLV(X, Y)           _mm512_rolv_epi64(X, Y)
+#define VTERNLOG(X, Y, Z, W)  _mm512_ternarylogic_epi64(X, Y, Z, W)
+
+// concatenated shift right (AVX-512VBMI2, emulated with two shifts without it)
+#if defined(__AVX512VBMI2__)
+#define VSHRDV(X, Y, Z)       _mm512_shrdv_epi64(X, Y, Z)
+#else
+#define VSHRDV(X, Y, Z)       VOR(VSHRV(X, Z), VSHLV(Y, VSUB(VSET1(64), Z)))
+#endif
 
 // broadcast operations
 #define VZERO                 _mm512_setzero_si512()
@@ -52,5 +64,11 @@
 #define VZSHUF(X, Y, Z)       _mm512_maskz_shuffle_epi32(X, Y, Z)
 #define VMBLEND(X, Y, Z)      _mm512_mask_blend_epi64(X, Y, Z)
 #define VALIGNR(X, Y, Z)      _mm512_alignr_epi64(X, Y, Z)
+#define VPERMV2(X, Y, Z)      _mm512_permutex2var_epi64(X, Y, Z)
+#define VMPERMV(W, X, Y, Z)   _mm512_mask_permutexvar_epi64(W, X, Y, Z)
+
+// masked memory operations
+#define VZLOAD(X, Y)          _mm512_maskz_loadu_epi64(X, Y)
+#define VMSTORE(X, Y, Z)      _mm512_mask_storeu_epi64(X, Y, Z)
 
 #endif
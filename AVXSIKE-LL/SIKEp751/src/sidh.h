@@ -69,25 +69,87 @@ static const uint64_t vB_gen[6*VNWORDS] = {
 };
 
 // Fixed parameters for isogeny tree computation
-static const unsigned int strat_Alice[MAX_Alice-1] = { 
-  80, 48, 27, 15, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 7, 4, 2, 1, 1, 2, 1, 
-  1, 3, 2, 1, 1, 1, 1, 12, 7, 4, 2, 1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 5, 3, 2, 1, 1, 
-  1, 1, 2, 1, 1, 1, 21, 12, 7, 4, 2, 1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 5, 3, 2, 1, 
-  1, 1, 1, 2, 1, 1, 1, 9, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 4, 2, 1, 1, 1, 2, 1, 1, 
-  33, 20, 12, 7, 4, 2, 1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 5, 3, 2, 1, 1, 1, 1, 2, 1, 
-  1, 1, 8, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 4, 2, 1, 1, 2, 1, 1, 16, 8, 4, 2, 1, 1, 
-  1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1 };
-
-static const unsigned int strat_Bob[MAX_Bob-1] = { 
-  112, 63, 32, 16, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 8, 4, 2, 1, 1, 2, 1, 
-  1, 4, 2, 1, 1, 2, 1, 1, 16, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 8, 4, 2, 
-  1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 31, 16, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 
-  1, 1, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 15, 8, 4, 2, 1, 1, 2, 1, 1, 4, 
-  2, 1, 1, 2, 1, 1, 7, 4, 2, 1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 49, 31, 16, 8, 4, 2, 
-  1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 
-  15, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 7, 4, 2, 1, 1, 2, 1, 1, 3, 2, 1, 
-  1, 1, 1, 21, 12, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 5, 3, 2, 1, 1, 1, 1, 
-  2, 1, 1, 1, 9, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 4, 2, 1, 1, 1, 2, 1, 1 };
+// The strategies are optimal for the cost model of this implementation: a 
+// strategy step is a 1x2x2x2w xDBLe/xTPLe (2x2x2x1w xDBLe for kgss) and each 
+// isogeny is evaluated at all stacked points at once in the lanes of the 
+// parallel evaluation (eval_*_isog_parallel_*), whose cost grows in batches of
+// up to 8 points rather than per point. kg strategies also count the 3 
+// images phiP, phiQ, phiR. The tables are generated by tools/strategy.c.
+static const unsigned int strat_Alice_kg[MAX_Alice-1] = { 
+  59, 40, 31, 21, 13, 8, 5, 3, 2, 1, 1, 1, 1, 1, 1, 2,
+  1, 1, 1, 3, 2, 1, 1, 1, 1, 1, 5, 3, 2, 1, 1, 1,
+  1, 1, 2, 1, 1, 1, 8, 5, 3, 2, 1, 1, 1, 1, 1, 2,
+  1, 1, 1, 3, 2, 1, 1, 1, 1, 1, 10, 8, 5, 3, 2, 1,
+  1, 1, 1, 1, 2, 1, 1, 1, 3, 2, 1, 1, 1, 1, 1, 3,
+  2, 2, 1, 1, 1, 1, 1, 1, 13, 9, 6, 4, 3, 2, 1, 1,
+  1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 3, 2, 1, 1, 1,
+  1, 1, 1, 4, 3, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 19,
+  13, 9, 6, 4, 3, 2, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1,
+  1, 1, 1, 3, 2, 1, 1, 1, 1, 1, 1, 4, 3, 2, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 6, 4, 3, 2, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 2, 1, 1, 1, 1 };
+
+static const unsigned int strat_Alice_ss[MAX_Alice-1] = { 
+  58, 41, 28, 19, 13, 9, 6, 4, 3, 2, 1, 1, 1, 1, 1, 1,
+  1, 1, 2, 1, 1, 1, 1, 3, 2, 1, 1, 1, 1, 1, 1, 4,
+  3, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 6, 4, 3, 2, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 9, 6, 4,
+  3, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1,
+  3, 2, 1, 1, 1, 1, 1, 1, 13, 9, 6, 4, 3, 2, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 3, 2, 1, 1,
+  1, 1, 1, 1, 4, 3, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  17, 13, 9, 6, 4, 3, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  2, 1, 1, 1, 1, 3, 2, 1, 1, 1, 1, 1, 1, 4, 3, 2,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 5, 4, 3, 2, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1 };
+
+static const unsigned int strat_Alice_kgss[MAX_Alice-1] = { 
+  71, 49, 28, 16, 9, 5, 3, 2, 1, 1, 1, 1, 1, 2, 1, 1,
+  1, 4, 2, 1, 1, 1, 2, 1, 1, 7, 4, 2, 1, 1, 1, 2,
+  1, 1, 3, 2, 1, 1, 1, 1, 12, 7, 4, 2, 1, 1, 1, 2,
+  1, 1, 3, 2, 1, 1, 1, 1, 5, 3, 2, 1, 1, 1, 1, 2,
+  1, 1, 1, 21, 12, 7, 4, 2, 1, 1, 1, 2, 1, 1, 3, 2,
+  1, 1, 1, 1, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 9,
+  5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 4, 2, 1, 1, 1,
+  2, 1, 1, 32, 17, 9, 5, 3, 2, 1, 1, 1, 1, 1, 2, 1,
+  1, 1, 4, 2, 1, 1, 1, 2, 1, 1, 8, 4, 2, 1, 1, 1,
+  2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 15, 8, 4, 2, 1, 1,
+  1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 7, 4, 2, 1, 1,
+  2, 1, 1, 3, 2, 1, 1, 1, 1 };
+
+static const unsigned int strat_Bob_kg[MAX_Bob-1] = { 
+  76, 52, 35, 23, 15, 12, 9, 6, 4, 3, 2, 1, 1, 1, 1, 1,
+  1, 1, 2, 1, 1, 1, 1, 3, 2, 1, 1, 1, 1, 1, 1, 3,
+  3, 2, 1, 1, 1, 1, 1, 1, 1, 1, 5, 3, 2, 1, 1, 1,
+  1, 1, 1, 1, 2, 1, 1, 1, 8, 5, 3, 2, 1, 1, 1, 1,
+  1, 1, 1, 2, 1, 1, 1, 3, 2, 1, 1, 1, 1, 1, 12, 8,
+  5, 3, 2, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 3, 2,
+  1, 1, 1, 1, 1, 4, 3, 2, 1, 1, 1, 1, 1, 1, 1, 1,
+  17, 12, 8, 5, 3, 2, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1,
+  1, 3, 2, 1, 1, 1, 1, 1, 4, 3, 2, 1, 1, 1, 1, 1,
+  1, 1, 1, 5, 4, 3, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 24, 17, 12, 8, 5, 3, 2, 1, 1, 1, 1, 1, 1,
+  1, 2, 1, 1, 1, 3, 2, 1, 1, 1, 1, 1, 4, 3, 2, 1,
+  1, 1, 1, 1, 1, 1, 1, 5, 4, 3, 2, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 7, 5, 4, 3, 2, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1 };
+
+static const unsigned int strat_Bob_ss[MAX_Bob-1] = { 
+  68, 49, 35, 25, 18, 13, 9, 7, 5, 4, 3, 2, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 3, 2, 1, 1,
+  1, 1, 1, 1, 4, 3, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  5, 4, 3, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 7, 5, 4, 3, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 2, 1, 1, 1, 1, 1, 10, 7, 5, 4, 3, 2, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1,
+  1, 1, 3, 2, 1, 1, 1, 1, 1, 1, 1, 14, 10, 7, 5, 4,
+  3, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2,
+  1, 1, 1, 1, 1, 3, 2, 1, 1, 1, 1, 1, 1, 1, 4, 3,
+  2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 19, 14, 10, 7, 5,
+  4, 3, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  2, 1, 1, 1, 1, 1, 3, 2, 1, 1, 1, 1, 1, 1, 1, 4,
+  3, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 5, 4, 3, 2,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 };
 
 // 2^768 * 8 = 2^771
 static const uint64_t montRx8[NWORDS_FIELD] = {
@@ -101,6 +163,11 @@ static const uint64_t montRdiv8[NWORDS_FIELD] = {
   0x0000000000000000, 0x6590000000000000, 0x5918D44FD526D8F6, 0x15CC73E83464C464, 
   0xDE44D6373BDEFB10, 0x3CF247A9F43063B7, 0xCAEA8CB14D7722BD, 0x00004B9B09E0D72D, };
 
+// Bob's public key in radix-2^51 Montgomery form with the constants of his curve: 
+// A, A24plus = A+2C, C24 = 4C (C = 1)
+typedef struct { f2elm_r51_t PKB[3]; f2elm_r51_t A; f2elm_r51_t A24plus; f2elm_r51_t C24; } prepared_pkB;
+typedef prepared_pkB prepared_pkB_t[1];
+
 void random_mod_order_B(unsigned char* random_digits);
 
 void EphemeralKeyGeneration_A(const unsigned char* PrivateKeyA, unsigned char* PublicKeyA);
@@ -109,6 +176,8 @@ void EphemeralSecretAgreement_A(const unsigned char* PrivateKeyA, const unsigned
 void EphemeralSecretAgreement_B(const unsigned char* PrivateKeyB, const unsigned char* PublicKeyA, unsigned char* SharedSecretB);
 
 void EphemeralKeyGenSecAgr_A_parallel(const unsigned char* PrivateKeyA, unsigned char* PublicKeyA, const unsigned char* PublicKeyB, unsigned char* SharedSecretA);
+void PreparePublicKey_B(const unsigned char* PublicKeyB, prepared_pkB_t ppk);
+void EphemeralKeyGenSecAgr_A_prepared(const unsigned char* PrivateKeyA, unsigned char* PublicKeyA, const prepared_pkB_t ppk, unsigned char* SharedSecretA);
 
 #endif
 